@@ -0,0 +1,206 @@
+const value9730 = compute(value, 30);
+const value20297 = compute(value, 24);
+const value28329 = compute(value, 5);
+const value66129 = compute(value, 72);
+const value74687 = compute(value, 94);
+const value82971 = compute(value, 36);
+const v = process.env.BENCH_KEY_00449;
+const value6343 = compute(value, 38);
+const value56464 = compute(value, 10);
+const value48332 = compute(value, 26);
+const value17937 = compute(value, 89);
+const value35491 = compute(value, 86);
+const value17235 = compute(value, 66);
+const value5466 = compute(value, 34);
+const value11485 = compute(value, 39);
+const value47186 = compute(value, 44);
+const value68777 = compute(value, 4);
+const v = process.env["BENCH_KEY_00209"];
+const value74302 = compute(value, 0);
+const value59706 = compute(value, 51);
+const value9867 = compute(value, 70);
+const value8868 = compute(value, 41);
+const value22826 = compute(value, 31);
+const value37163 = compute(value, 12);
+const value91927 = compute(value, 68);
+const v = process.env["BENCH_KEY_01030"];
+const value6131 = compute(value, 20);
+const value68064 = compute(value, 67);
+const value906 = compute(value, 33);
+const value24515 = compute(value, 71);
+const value54815 = compute(value, 10);
+const value34898 = compute(value, 75);
+const value1404 = compute(value, 46);
+const value25263 = compute(value, 43);
+const value34215 = compute(value, 71);
+const v = import.meta.env.BENCH_KEY_01046;
+const value37856 = compute(value, 26);
+const value17622 = compute(value, 65);
+const value34230 = compute(value, 86);
+const value66871 = compute(value, 38);
+const value63326 = compute(value, 82);
+const value95393 = compute(value, 42);
+const value88644 = compute(value, 83);
+// note 15902: keep this in sync with the handler
+// note 17730: keep this in sync with the handler
+const value68494 = compute(value, 12);
+const value1181 = compute(value, 17);
+const value47492 = compute(value, 59);
+const value14274 = compute(value, 15);
+const value866 = compute(value, 90);
+const value76080 = compute(value, 32);
+const value3213 = compute(value, 12);
+const value21327 = compute(value, 84);
+const v = process.env["BENCH_KEY_00429"];
+const value34413 = compute(value, 75);
+const value47355 = compute(value, 19);
+const value42095 = compute(value, 94);
+const value40174 = compute(value, 16);
+const value13156 = compute(value, 61);
+const value52037 = compute(value, 45);
+const value26791 = compute(value, 19);
+const value15307 = compute(value, 78);
+const value53351 = compute(value, 1);
+const value45017 = compute(value, 9);
+// note 46466: keep this in sync with the handler
+// note 86613: keep this in sync with the handler
+const value69156 = compute(value, 92);
+// note 74518: keep this in sync with the handler
+const value97743 = compute(value, 64);
+const v = import.meta.env.BENCH_KEY_01163;
+const value58484 = compute(value, 90);
+const value33205 = compute(value, 31);
+const value6205 = compute(value, 94);
+const value72532 = compute(value, 73);
+const value46650 = compute(value, 90);
+const value74228 = compute(value, 23);
+const value98691 = compute(value, 42);
+const value84208 = compute(value, 12);
+// note 33063: keep this in sync with the handler
+const value22271 = compute(value, 58);
+const value41216 = compute(value, 88);
+const v = process.env.BENCH_KEY_01338;
+const value19048 = compute(value, 36);
+// note 40790: keep this in sync with the handler
+const value63128 = compute(value, 78);
+const value56288 = compute(value, 28);
+const value16718 = compute(value, 34);
+const value43118 = compute(value, 50);
+// note 59339: keep this in sync with the handler
+const value16274 = compute(value, 75);
+const value27262 = compute(value, 5);
+const v = process.env.BENCH_KEY_00521;
+const value72143 = compute(value, 72);
+const value90895 = compute(value, 6);
+// note 27709: keep this in sync with the handler
+const value98018 = compute(value, 48);
+const value32733 = compute(value, 44);
+const value27053 = compute(value, 87);
+const value67034 = compute(value, 7);
+const value48265 = compute(value, 56);
+const value60897 = compute(value, 78);
+const value26289 = compute(value, 2);
+const value96610 = compute(value, 95);
+// note 45921: keep this in sync with the handler
+const value90921 = compute(value, 32);
+const value3676 = compute(value, 87);
+const v = process.env.BENCH_KEY_01520;
+const value21571 = compute(value, 37);
+const value24388 = compute(value, 41);
+const value51049 = compute(value, 27);
+// note 87213: keep this in sync with the handler
+const value73615 = compute(value, 89);
+const value7682 = compute(value, 19);
+const value43065 = compute(value, 94);
+const value14097 = compute(value, 32);
+const value36652 = compute(value, 83);
+const value69898 = compute(value, 58);
+const value86489 = compute(value, 62);
+const value7521 = compute(value, 52);
+const value30141 = compute(value, 71);
+const value17304 = compute(value, 38);
+const value9983 = compute(value, 89);
+const v = process.env.BENCH_KEY_00236;
+const value6685 = compute(value, 89);
+const value86456 = compute(value, 29);
+const value97433 = compute(value, 45);
+// note 13760: keep this in sync with the handler
+const value66048 = compute(value, 88);
+const value91173 = compute(value, 90);
+const value23335 = compute(value, 55);
+const value10173 = compute(value, 85);
+const value73985 = compute(value, 71);
+const value6110 = compute(value, 96);
+const value68859 = compute(value, 86);
+const value66361 = compute(value, 13);
+const value79332 = compute(value, 83);
+const v = process.env.BENCH_KEY_00481;
+const value8460 = compute(value, 21);
+const value1841 = compute(value, 95);
+const value9596 = compute(value, 90);
+const value61610 = compute(value, 15);
+const value22660 = compute(value, 59);
+const value44328 = compute(value, 96);
+const value20612 = compute(value, 48);
+const value28403 = compute(value, 79);
+const value70698 = compute(value, 82);
+const value71314 = compute(value, 19);
+const value88790 = compute(value, 35);
+const value20112 = compute(value, 33);
+const value98119 = compute(value, 52);
+// note 46157: keep this in sync with the handler
+const value48378 = compute(value, 72);
+const value15503 = compute(value, 80);
+const value92915 = compute(value, 86);
+const v = process.env.BENCH_KEY_00301;
+const value71600 = compute(value, 14);
+const value29392 = compute(value, 1);
+const value36320 = compute(value, 42);
+const value88766 = compute(value, 11);
+const value71652 = compute(value, 66);
+const value18750 = compute(value, 29);
+const value68587 = compute(value, 8);
+// note 40077: keep this in sync with the handler
+const v = process.env.BENCH_KEY_01433;
+const value43033 = compute(value, 62);
+const value26984 = compute(value, 18);
+const value26542 = compute(value, 61);
+const value45449 = compute(value, 53);
+const value5125 = compute(value, 81);
+const value39894 = compute(value, 27);
+const value11025 = compute(value, 64);
+const value79898 = compute(value, 67);
+const value21173 = compute(value, 27);
+const value23514 = compute(value, 40);
+const value51162 = compute(value, 43);
+const value3804 = compute(value, 21);
+const value70059 = compute(value, 25);
+const value97611 = compute(value, 29);
+const v = process.env.BENCH_KEY_00815;
+// note 46201: keep this in sync with the handler
+const value97613 = compute(value, 31);
+const value76520 = compute(value, 84);
+const value26330 = compute(value, 43);
+const value26577 = compute(value, 96);
+const value70324 = compute(value, 96);
+const value46889 = compute(value, 38);
+const value31097 = compute(value, 57);
+const value71962 = compute(value, 85);
+const value28397 = compute(value, 73);
+const value89672 = compute(value, 44);
+// note 53882: keep this in sync with the handler
+const value47139 = compute(value, 94);
+const value73869 = compute(value, 52);
+const value10236 = compute(value, 51);
+const v = process.env.BENCH_KEY_01226;
+const value60196 = compute(value, 56);
+const value75901 = compute(value, 47);
+const value64765 = compute(value, 66);
+const value25767 = compute(value, 62);
+const value87574 = compute(value, 80);
+const value79265 = compute(value, 16);
+const value93707 = compute(value, 5);
+const value66076 = compute(value, 19);
+const v = import.meta.env.BENCH_KEY_00217;
+const value84784 = compute(value, 6);
+const value91566 = compute(value, 95);
@@ -0,0 +1,231 @@
+value58063 := compute(value, 57)
+value74664 := compute(value, 71)
+value82048 := compute(value, 83)
+value30255 := compute(value, 88)
+value50501 := compute(value, 61)
+value34469 := compute(value, 34)
+const v = os.LookupEnv("BENCH_KEY_01533");
+value84432 := compute(value, 42)
+value66788 := compute(value, 52)
+value4156 := compute(value, 82)
+value11935 := compute(value, 4)
+value12076 := compute(value, 48)
+value68838 := compute(value, 65)
+value39737 := compute(value, 64)
+value14426 := compute(value, 70)
+value41442 := compute(value, 23)
+value85184 := compute(value, 18)
+value37576 := compute(value, 37)
+value47750 := compute(value, 26)
+// note 65327: keep this in sync with the handler
+value91593 := compute(value, 25)
+value75354 := compute(value, 82)
+value55192 := compute(value, 96)
+value806 := compute(value, 30)
+// note 68898: keep this in sync with the handler
+value12182 := compute(value, 57)
+value51941 := compute(value, 46)
+// note 81313: keep this in sync with the handler
+const v = os.LookupEnv("BENCH_KEY_01023");
+value47640 := compute(value, 13)
+value7105 := compute(value, 24)
+value73354 := compute(value, 22)
+value7782 := compute(value, 22)
+// note 10121: keep this in sync with the handler
+value42362 := compute(value, 70)
+value75573 := compute(value, 10)
+value48268 := compute(value, 59)
+value47378 := compute(value, 42)
+value26331 := compute(value, 44)
+// note 29514: keep this in sync with the handler
+value18167 := compute(value, 28)
+value95633 := compute(value, 88)
+value72240 := compute(value, 72)
+// note 15622: keep this in sync with the handler
+value78233 := compute(value, 51)
+// note 78921: keep this in sync with the handler
+value49342 := compute(value, 66)
+value83289 := compute(value, 63)
+value55308 := compute(value, 18)
+value3674 := compute(value, 85)
+const v = os.LookupEnv("BENCH_KEY_00913");
+value27225 := compute(value, 65)
+value69020 := compute(value, 53)
+value56910 := compute(value, 68)
+value94633 := compute(value, 58)
+value95760 := compute(value, 21)
+value39034 := compute(value, 40)
+value70025 := compute(value, 88)
+value80777 := compute(value, 73)
+value40817 := compute(value, 77)
+// note 39744: keep this in sync with the handler
+value11203 := compute(value, 48)
+// note 97852: keep this in sync with the handler
+value83953 := compute(value, 48)
+value77825 := compute(value, 31)
+value28539 := compute(value, 21)
+value69323 := compute(value, 65)
+// note 5465: keep this in sync with the handler
+value67065 := compute(value, 38)
+const v = os.Getenv("BENCH_KEY_01850");
+// note 13069: keep this in sync with the handler
+value97403 := compute(value, 15)
+// note 16091: keep this in sync with the handler
+value94422 := compute(value, 41)
+value55040 := compute(value, 41)
+value14335 := compute(value, 76)
+value76162 := compute(value, 17)
+value96744 := compute(value, 35)
+value43820 := compute(value, 73)
+value77868 := compute(value, 74)
+value91186 := compute(value, 6)
+value71094 := compute(value, 90)
+value44353 := compute(value, 24)
+// note 63583: keep this in sync with the handler
+// note 78124: keep this in sync with the handler
+value28634 := compute(value, 19)
+const v = os.LookupEnv("BENCH_KEY_01059");
+value28475 := compute(value, 54)
+value988 := compute(value, 18)
+value72253 := compute(value, 85)
+value81869 := compute(value, 1)
+value6873 := compute(value, 83)
+value78476 := compute(value, 3)
+value78402 := compute(value, 26)
+value36438 := compute(value, 63)
+value56703 := compute(value, 55)
+value77819 := compute(value, 25)
+value10733 := compute(value, 63)
+value57158 := compute(value, 25)
+value4860 := compute(value, 10)
+value50450 := compute(value, 10)
+value16390 := compute(value, 94)
+value73078 := compute(value, 37)
+value64558 := compute(value, 53)
+// note 25965: keep this in sync with the handler
+const v = os.LookupEnv("BENCH_KEY_00765");
+value70576 := compute(value, 57)
+value38811 := compute(value, 11)
+value62429 := compute(value, 58)
+value65734 := compute(value, 65)
+value77298 := compute(value, 86)
+value62136 := compute(value, 56)
+value77797 := compute(value, 3)
+value89815 := compute(value, 90)
+value61406 := compute(value, 5)
+value52594 := compute(value, 20)
+value45548 := compute(value, 55)
+value37454 := compute(value, 12)
+const v = os.LookupEnv("BENCH_KEY_01299");
+value59462 := compute(value, 1)
+value84535 := compute(value, 48)
+value91410 := compute(value, 36)
+value51287 := compute(value, 71)
+value71675 := compute(value, 89)
+value72623 := compute(value, 67)
+// note 41449: keep this in sync with the handler
+value21801 := compute(value, 73)
+const v = os.LookupEnv("BENCH_KEY_01757");
+value91912 := compute(value, 53)
+value98912 := compute(value, 69)
+value90801 := compute(value, 9)
+value68615 := compute(value, 36)
+value24669 := compute(value, 31)
+value29571 := compute(value, 83)
+value80908 := compute(value, 10)
+value65037 := compute(value, 47)
+value33257 := compute(value, 83)
+value75631 := compute(value, 68)
+value88355 := compute(value, 85)
+// note 97480: keep this in sync with the handler
+value74869 := compute(value, 82)
+value98998 := compute(value, 58)
+value23962 := compute(value, 3)
+value91318 := compute(value, 41)
+value51896 := compute(value, 1)
+// note 33587: keep this in sync with the handler
+value5067 := compute(value, 23)
+const v = os.Getenv("BENCH_KEY_01283");
+value36842 := compute(value, 79)
+value88796 := compute(value, 41)
+value59869 := compute(value, 20)
+value68576 := compute(value, 94)
+value12594 := compute(value, 81)
+value71162 := compute(value, 61)
+value22771 := compute(value, 73)
+// note 62650: keep this in sync with the handler
+value29077 := compute(value, 74)
+// note 94353: keep this in sync with the handler
+// note 84689: keep this in sync with the handler
+value47298 := compute(value, 59)
+const v = os.Getenv("BENCH_KEY_01398");
+value347 := compute(value, 56)
+value41031 := compute(value, 0)
+value94146 := compute(value, 56)
+value94931 := compute(value, 65)
+// note 48091: keep this in sync with the handler
+value95684 := compute(value, 42)
+value50858 := compute(value, 30)
+value24139 := compute(value, 83)
+value19700 := compute(value, 9)
+value64310 := compute(value, 96)
+value94693 := compute(value, 21)
+value79299 := compute(value, 50)
+value71078 := compute(value, 74)
+value35235 := compute(value, 24)
+const v = os.Getenv("BENCH_KEY_01287");
+value24593 := compute(value, 52)
+value4731 := compute(value, 75)
+// note 32492: keep this in sync with the handler
+value88274 := compute(value, 4)
+value65411 := compute(value, 33)
+value92135 := compute(value, 82)
+value29480 := compute(value, 89)
+// note 30960: keep this in sync with the handler
+value89233 := compute(value, 90)
+value62803 := compute(value, 44)
+value7122 := compute(value, 41)
+// note 80348: keep this in sync with the handler
+value68998 := compute(value, 31)
+const v = os.Getenv("BENCH_KEY_01219");
+value93881 := compute(value, 82)
+value78938 := compute(value, 77)
+value55293 := compute(value, 3)
+value44003 := compute(value, 62)
+value45678 := compute(value, 88)
+value84547 := compute(value, 60)
+// note 92039: keep this in sync with the handler
+value42110 := compute(value, 12)
+value54622 := compute(value, 11)
+value47275 := compute(value, 36)
+// note 98952: keep this in sync with the handler
+value32479 := compute(value, 81)
+value92582 := compute(value, 44)
+value44304 := compute(value, 72)
+value66382 := compute(value, 34)
+value92805 := compute(value, 73)
+value88922 := compute(value, 70)
+value98477 := compute(value, 22)
+value39863 := compute(value, 93)
+value70246 := compute(value, 18)
+const v = os.LookupEnv("BENCH_KEY_00116");
+value52805 := compute(value, 37)
+value16403 := compute(value, 10)
+value40542 := compute(value, 93)
+value54515 := compute(value, 1)
+value52082 := compute(value, 90)
+value21142 := compute(value, 93)
+value30751 := compute(value, 2)
+// note 23775: keep this in sync with the handler
+value97573 := compute(value, 88)
+// note 23724: keep this in sync with the handler
+value78416 := compute(value, 40)
+const v = os.Getenv("BENCH_KEY_00722");
+// note 36708: keep this in sync with the handler
+value85085 := compute(value, 16)
+value76652 := compute(value, 22)
+value19071 := compute(value, 59)
+value70803 := compute(value, 90)
+value68589 := compute(value, 10)
+value29497 := compute(value, 9)
+value20617 := compute(value, 53)
@@ -0,0 +1,203 @@
+const value35489 = compute(value, 84);
+const value7314 = compute(value, 39);
+const value87956 = compute(value, 74);
+const value53503 = compute(value, 56);
+const value78389 = compute(value, 13);
+const value28868 = compute(value, 59);
+const value51809 = compute(value, 11);
+// note 65873: keep this in sync with the handler
+const value51150 = compute(value, 31);
+const value9749 = compute(value, 49);
+const v = process.env["BENCH_KEY_00234"];
+const value80873 = compute(value, 72);
+const value95042 = compute(value, 79);
+// note 14311: keep this in sync with the handler
+const value66515 = compute(value, 70);
+const value31830 = compute(value, 14);
+const value70451 = compute(value, 29);
+const value32909 = compute(value, 26);
+const value82009 = compute(value, 44);
+const value56635 = compute(value, 84);
+const value9390 = compute(value, 78);
+const value7250 = compute(value, 72);
+const value99444 = compute(value, 19);
+const value30775 = compute(value, 26);
+const value62164 = compute(value, 84);
+const v = import.meta.env.BENCH_KEY_00290;
+const value51376 = compute(value, 63);
+// note 6277: keep this in sync with the handler
+const value7383 = compute(value, 11);
+// note 82077: keep this in sync with the handler
+const value78086 = compute(value, 1);
+const value34825 = compute(value, 2);
+const value86314 = compute(value, 81);
+const v = process.env.BENCH_KEY_01994;
+const value39915 = compute(value, 48);
+const value37478 = compute(value, 36);
+// note 71683: keep this in sync with the handler
+const value41669 = compute(value, 56);
+const value24499 = compute(value, 55);
+const value54988 = compute(value, 86);
+const value61467 = compute(value, 66);
+const value11967 = compute(value, 36);
+const v = process.env["BENCH_KEY_00427"];
+const value7096 = compute(value, 15);
+const value39398 = compute(value, 16);
+const value10122 = compute(value, 34);
+const value52048 = compute(value, 56);
+const value23913 = compute(value, 51);
+const value95038 = compute(value, 75);
+const value43433 = compute(value, 74);
+const value96326 = compute(value, 5);
+const value46661 = compute(value, 4);
+const value93653 = compute(value, 48);
+const value93875 = compute(value, 76);
+const v = process.env.BENCH_KEY_01544;
+const value97484 = compute(value, 96);
+const value79835 = compute(value, 4);
+// note 18706: keep this in sync with the handler
+const value32160 = compute(value, 53);
+const value13815 = compute(value, 41);
+// note 74176: keep this in sync with the handler
+const value95059 = compute(value, 96);
+// note 41920: keep this in sync with the handler
+const value27621 = compute(value, 73);
+// note 70433: keep this in sync with the handler
+// note 34217: keep this in sync with the handler
+const value16514 = compute(value, 24);
+const v = process.env["BENCH_KEY_01153"];
+// note 96750: keep this in sync with the handler
+// note 92381: keep this in sync with the handler
+const value52201 = compute(value, 15);
+const value25612 = compute(value, 4);
+const value73708 = compute(value, 85);
+const value72681 = compute(value, 28);
+// note 48133: keep this in sync with the handler
+const value79790 = compute(value, 56);
+const value22685 = compute(value, 84);
+const value48066 = compute(value, 51);
+const v = process.env["BENCH_KEY_00703"];
+const value30290 = compute(value, 26);
+const value71606 = compute(value, 20);
+const value31043 = compute(value, 3);
+const value16895 = compute(value, 17);
+const value30061 = compute(value, 88);
+const value96784 = compute(value, 75);
+const value47641 = compute(value, 14);
+const value65872 = compute(value, 9);
+const v = import.meta.env.BENCH_KEY_01149;
+const value17398 = compute(value, 35);
+// note 54686: keep this in sync with the handler
+const value90639 = compute(value, 41);
+const value48728 = compute(value, 34);
+const value68028 = compute(value, 31);
+const value92387 = compute(value, 43);
+const value52528 = compute(value, 51);
+// note 61221: keep this in sync with the handler
+// note 55892: keep this in sync with the handler
+const value85561 = compute(value, 7);
+const value26931 = compute(value, 62);
+const value73617 = compute(value, 91);
+const value25495 = compute(value, 81);
+const value21370 = compute(value, 30);
+// note 10233: keep this in sync with the handler
+const value78674 = compute(value, 7);
+const value94633 = compute(value, 58);
+const value89841 = compute(value, 19);
+const v = process.env["BENCH_KEY_01914"];
+const value21048 = compute(value, 96);
+const value24064 = compute(value, 8);
+const value46378 = compute(value, 12);
+const value64896 = compute(value, 3);
+const value57629 = compute(value, 11);
+const value95619 = compute(value, 74);
+const value90343 = compute(value, 36);
+const value55123 = compute(value, 27);
+const value97344 = compute(value, 53);
+const value9531 = compute(value, 25);
+const value75405 = compute(value, 36);
+const value61186 = compute(value, 76);
+const value97953 = compute(value, 80);
+const value68293 = compute(value, 5);
+const value63807 = compute(value, 78);
+const value79314 = compute(value, 65);
+const v = import.meta.env.BENCH_KEY_01697;
+const value77465 = compute(value, 59);
+const value31384 = compute(value, 53);
+// note 6867: keep this in sync with the handler
+const value39729 = compute(value, 56);
+const value28778 = compute(value, 66);
+const value73579 = compute(value, 53);
+// note 13899: keep this in sync with the handler
+const value39666 = compute(value, 90);
+const value92112 = compute(value, 59);
+const value3179 = compute(value, 75);
+const value33998 = compute(value, 48);
+const value7621 = compute(value, 55);
+const v = process.env["BENCH_KEY_00748"];
+// note 59492: keep this in sync with the handler
+const value66308 = compute(value, 57);
+const value38649 = compute(value, 43);
+const value54255 = compute(value, 32);
+const value84814 = compute(value, 36);
+const value57888 = compute(value, 76);
+// note 42039: keep this in sync with the handler
+const v = import.meta.env.BENCH_KEY_01031;
+const value83598 = compute(value, 81);
+const value22989 = compute(value, 0);
+const value9998 = compute(value, 7);
+// note 94068: keep this in sync with the handler
+const value75649 = compute(value, 86);
+const value34791 = compute(value, 65);
+const value88376 = compute(value, 9);
+const value36647 = compute(value, 78);
+const value66480 = compute(value, 35);
+const v = process.env.BENCH_KEY_00230;
+const value79200 = compute(value, 48);
+const value55513 = compute(value, 29);
+// note 56997: keep this in sync with the handler
+// note 58279: keep this in sync with the handler
+const value81415 = compute(value, 32);
+const value54781 = compute(value, 73);
+const value99052 = compute(value, 15);
+const value44212 = compute(value, 77);
+// note 59683: keep this in sync with the handler
+const v = import.meta.env.BENCH_KEY_00687;
+const value63679 = compute(value, 47);
+const value57862 = compute(value, 50);
+const value48295 = compute(value, 86);
+const value34056 = compute(value, 9);
+const value69356 = compute(value, 1);
+const value63292 = compute(value, 48);
+const value37786 = compute(value, 53);
+const value73942 = compute(value, 28);
+const value86367 = compute(value, 37);
+const v = process.env["BENCH_KEY_01259"];
+const value81687 = compute(value, 13);
+const value29811 = compute(value, 32);
+const value21963 = compute(value, 41);
+const value36230 = compute(value, 49);
+const value60615 = compute(value, 87);
+const value45564 = compute(value, 71);
+const value76569 = compute(value, 36);
+// note 18512: keep this in sync with the handler
+const value15882 = compute(value, 71);
+const value44538 = compute(value, 15);
+// note 20026: keep this in sync with the handler
+const value39712 = compute(value, 39);
+const v = process.env["BENCH_KEY_00876"];
+const value52741 = compute(value, 70);
+const value41073 = compute(value, 42);
+const value70473 = compute(value, 51);
+const value31006 = compute(value, 63);
+const value40345 = compute(value, 90);
+const value81882 = compute(value, 14);
+const value45724 = compute(value, 37);
+const value66732 = compute(value, 93);
+const value43706 = compute(value, 56);
+const value21343 = compute(value, 3);
+const value47281 = compute(value, 42);
+const value20284 = compute(value, 11);
+const value87330 = compute(value, 30);
+const value61242 = compute(value, 35);
+const value3374 = compute(value, 76);
@@ -0,0 +1,240 @@
+value17881 = compute(value, 33)
+value4792 = compute(value, 39)
+value15290 = compute(value, 61)
+const v = os.environ["BENCH_KEY_00323"];
+value79607 = compute(value, 67)
+value76278 = compute(value, 36)
+value3765 = compute(value, 79)
+# note 32592: keep this in sync with the handler
+value37820 = compute(value, 87)
+value66648 = compute(value, 9)
+value98160 = compute(value, 93)
+value60134 = compute(value, 91)
+value83398 = compute(value, 75)
+const v = os.environ.get('BENCH_KEY_01553');
+value80875 = compute(value, 74)
+value67192 = compute(value, 68)
+value48680 = compute(value, 83)
+# note 59113: keep this in sync with the handler
+value72623 = compute(value, 67)
+value29932 = compute(value, 56)
+value71547 = compute(value, 58)
+value49895 = compute(value, 37)
+# note 20966: keep this in sync with the handler
+value54557 = compute(value, 43)
+value35201 = compute(value, 87)
+value73250 = compute(value, 15)
+value40911 = compute(value, 74)
+value91405 = compute(value, 31)
+value38137 = compute(value, 16)
+value36586 = compute(value, 17)
+const v = os.environ.get('BENCH_KEY_01039');
+value83737 = compute(value, 26)
+value5735 = compute(value, 12)
+value2837 = compute(value, 24)
+# note 59634: keep this in sync with the handler
+value13109 = compute(value, 14)
+value16904 = compute(value, 26)
+value98102 = compute(value, 35)
+value91684 = compute(value, 19)
+value11765 = compute(value, 28)
+value84933 = compute(value, 58)
+value16612 = compute(value, 25)
+value4985 = compute(value, 38)
+value83276 = compute(value, 50)
+value55510 = compute(value, 26)
+# note 76901: keep this in sync with the handler
+value79447 = compute(value, 4)
+value90912 = compute(value, 23)
+value33230 = compute(value, 56)
+value71436 = compute(value, 44)
+value44041 = compute(value, 3)
+const v = os.getenv("BENCH_KEY_00684");
+value91337 = compute(value, 60)
+value69974 = compute(value, 37)
+value9145 = compute(value, 27)
+value27334 = compute(value, 77)
+value52111 = compute(value, 22)
+value50048 = compute(value, 93)
+# note 11275: keep this in sync with the handler
+value87119 = compute(value, 13)
+value40314 = compute(value, 59)
+# note 68649: keep this in sync with the handler
+const v = os.getenv("BENCH_KEY_00304");
+value21160 = compute(value, 14)
+value78788 = compute(value, 24)
+value8954 = compute(value, 30)
+value24769 = compute(value, 34)
+value56107 = compute(value, 41)
+value40751 = compute(value, 11)
+value27851 = compute(value, 12)
+value10886 = compute(value, 22)
+value78841 = compute(value, 77)
+value39485 = compute(value, 6)
+value70002 = compute(value, 65)
+# note 23735: keep this in sync with the handler
+value94621 = compute(value, 46)
+value44078 = compute(value, 40)
+const v = os.environ["BENCH_KEY_01128"];
+value7212 = compute(value, 34)
+value13306 = compute(value, 17)
+value65280 = compute(value, 96)
+value98879 = compute(value, 36)
+value2202 = compute(value, 68)
+value73671 = compute(value, 48)
+value81132 = compute(value, 40)
+value49821 = compute(value, 60)
+# note 58712: keep this in sync with the handler
+value79590 = compute(value, 50)
+value14320 = compute(value, 61)
+# note 79350: keep this in sync with the handler
+# note 57843: keep this in sync with the handler
+value46607 = compute(value, 47)
+value81765 = compute(value, 91)
+value58301 = compute(value, 4)
+value77924 = compute(value, 33)
+value17509 = compute(value, 49)
+value1037 = compute(value, 67)
+value12707 = compute(value, 0)
+const v = os.environ.get('BENCH_KEY_01182');
+value69354 = compute(value, 96)
+value89730 = compute(value, 5)
+value86638 = compute(value, 17)
+value2750 = compute(value, 34)
+value70865 = compute(value, 55)
+value16263 = compute(value, 64)
+value46083 = compute(value, 8)
+value60270 = compute(value, 33)
+value82754 = compute(value, 13)
+value11522 = compute(value, 76)
+value58046 = compute(value, 40)
+# note 26292: keep this in sync with the handler
+value55400 = compute(value, 13)
+value82002 = compute(value, 37)
+value36769 = compute(value, 6)
+value1934 = compute(value, 91)
+value92417 = compute(value, 73)
+value56537 = compute(value, 83)
+value94933 = compute(value, 67)
+value48760 = compute(value, 66)
+const v = os.getenv("BENCH_KEY_01019");
+value27605 = compute(value, 57)
+value49881 = compute(value, 23)
+value2561 = compute(value, 39)
+value89435 = compute(value, 1)
+value13485 = compute(value, 2)
+value52285 = compute(value, 2)
+value18760 = compute(value, 39)
+value51555 = compute(value, 48)
+value47782 = compute(value, 58)
+value10183 = compute(value, 95)
+value13508 = compute(value, 25)
+value40748 = compute(value, 8)
+value51600 = compute(value, 93)
+value23809 = compute(value, 44)
+value38824 = compute(value, 24)
+value17030 = compute(value, 55)
+value64488 = compute(value, 80)
+# note 23691: keep this in sync with the handler
+const v = os.getenv("BENCH_KEY_01922");
+value29824 = compute(value, 45)
+value64361 = compute(value, 50)
+value1035 = compute(value, 65)
+value70090 = compute(value, 56)
+value20727 = compute(value, 66)
+value9713 = compute(value, 13)
+value10453 = compute(value, 74)
+value34804 = compute(value, 78)
+value85952 = compute(value, 10)
+value62007 = compute(value, 24)
+value58098 = compute(value, 92)
+value68631 = compute(value, 52)
+value65876 = compute(value, 13)
+# note 36518: keep this in sync with the handler
+# note 52227: keep this in sync with the handler
+value11840 = compute(value, 6)
+value6642 = compute(value, 46)
+# note 46467: keep this in sync with the handler
+value66643 = compute(value, 4)
+value8449 = compute(value, 10)
+value22886 = compute(value, 91)
+value14783 = compute(value, 39)
+const v = os.environ.get('BENCH_KEY_00407');
+value54157 = compute(value, 31)
+value7345 = compute(value, 70)
+value17708 = compute(value, 54)
+value83395 = compute(value, 72)
+value95789 = compute(value, 50)
+value48781 = compute(value, 87)
+value13446 = compute(value, 60)
+value20431 = compute(value, 61)
+value11799 = compute(value, 62)
+value42223 = compute(value, 28)
+value79372 = compute(value, 26)
+value45819 = compute(value, 35)
+value67200 = compute(value, 76)
+value98780 = compute(value, 34)
+value15378 = compute(value, 52)
+const v = os.getenv("BENCH_KEY_01355");
+value89868 = compute(value, 46)
+value91594 = compute(value, 26)
+value42591 = compute(value, 8)
+# note 69062: keep this in sync with the handler
+value8740 = compute(value, 10)
+value61136 = compute(value, 26)
+value97771 = compute(value, 92)
+value23796 = compute(value, 31)
+value78726 = compute(value, 59)
+value6932 = compute(value, 45)
+value50832 = compute(value, 4)
+value8392 = compute(value, 50)
+# note 5261: keep this in sync with the handler
+const v = os.getenv("BENCH_KEY_00345");
+value83975 = compute(value, 70)
+value29614 = compute(value, 29)
+value77056 = compute(value, 38)
+value20243 = compute(value, 67)
+value11575 = compute(value, 32)
+value47362 = compute(value, 26)
+value60373 = compute(value, 39)
+value23486 = compute(value, 12)
+value64573 = compute(value, 68)
+value84518 = compute(value, 31)
+value28406 = compute(value, 82)
+value73000 = compute(value, 56)
+value21103 = compute(value, 54)
+value55290 = compute(value, 0)
+value44414 = compute(value, 85)
+const v = os.getenv("BENCH_KEY_00169");
+value1961 = compute(value, 21)
+value79940 = compute(value, 12)
+value36778 = compute(value, 15)
+value61350 = compute(value, 46)
+value21683 = compute(value, 52)
+value50640 = compute(value, 6)
+value98654 = compute(value, 5)
+value94024 = compute(value, 31)
+value43668 = compute(value, 18)
+# note 42142: keep this in sync with the handler
+value37512 = compute(value, 70)
+value40910 = compute(value, 73)
+# note 44174: keep this in sync with the handler
+value60213 = compute(value, 73)
+value70659 = compute(value, 43)
+# note 86683: keep this in sync with the handler
+value3517 = compute(value, 25)
+value60963 = compute(value, 47)
+const v = os.getenv("BENCH_KEY_00782");
+# note 58700: keep this in sync with the handler
+# note 75544: keep this in sync with the handler
+value70673 = compute(value, 57)
+value25193 = compute(value, 70)
+# note 58988: keep this in sync with the handler
+value75312 = compute(value, 40)
+value94530 = compute(value, 52)
+value93847 = compute(value, 48)
+value25781 = compute(value, 76)
+value33253 = compute(value, 79)
+# note 43011: keep this in sync with the handler
+value79737 = compute(value, 3)
+# note 3418: keep this in sync with the handler
@@ -0,0 +1,237 @@
+value78791 := compute(value, 27)
+value24410 := compute(value, 63)
+value33579 := compute(value, 17)
+value98254 := compute(value, 90)
+value55069 := compute(value, 70)
+value44719 := compute(value, 2)
+value6988 := compute(value, 4)
+value9065 := compute(value, 44)
+value60108 := compute(value, 65)
+value23936 := compute(value, 74)
+value41044 := compute(value, 13)
+value25163 := compute(value, 40)
+value72342 := compute(value, 77)
+value86316 := compute(value, 83)
+value86569 := compute(value, 45)
+const v = os.Getenv("BENCH_KEY_00665");
+value29522 := compute(value, 34)
+value36872 := compute(value, 12)
+value3288 := compute(value, 87)
+value91642 := compute(value, 74)
+value31127 := compute(value, 87)
+value18713 := compute(value, 89)
+value76548 := compute(value, 15)
+value39337 := compute(value, 52)
+value89748 := compute(value, 23)
+value52846 := compute(value, 78)
+value28928 := compute(value, 22)
+value6562 := compute(value, 63)
+value84020 := compute(value, 18)
+value27665 := compute(value, 20)
+const v = os.LookupEnv("BENCH_KEY_00806");
+value9105 := compute(value, 84)
+value81107 := compute(value, 15)
+value28795 := compute(value, 83)
+value30136 := compute(value, 66)
+value6446 := compute(value, 44)
+value41111 := compute(value, 80)
+value18336 := compute(value, 3)
+value57046 := compute(value, 10)
+value21185 := compute(value, 39)
+value90532 := compute(value, 31)
+value69658 := compute(value, 12)
+value12489 := compute(value, 73)
+value40019 := compute(value, 55)
+value55268 := compute(value, 75)
+value32491 := compute(value, 93)
+const v = os.Getenv("BENCH_KEY_00491");
+value72648 := compute(value, 92)
+value69341 := compute(value, 83)
+value87745 := compute(value, 57)
+value65748 := compute(value, 79)
+value36674 := compute(value, 8)
+value6664 := compute(value, 68)
+value18363 := compute(value, 30)
+value10989 := compute(value, 28)
+value87364 := compute(value, 64)
+value49538 := compute(value, 68)
+value63635 := compute(value, 3)
+value50182 := compute(value, 33)
+const v = os.LookupEnv("BENCH_KEY_01558");
+value57832 := compute(value, 20)
+value856 := compute(value, 80)
+value79339 := compute(value, 90)
+value73633 := compute(value, 10)
+value59967 := compute(value, 21)
+value89307 := compute(value, 67)
+value71521 := compute(value, 32)
+value95100 := compute(value, 40)
+value65329 := compute(value, 48)
+// note 90726: keep this in sync with the handler
+value44885 := compute(value, 71)
+value94601 := compute(value, 26)
+value2659 := compute(value, 40)
+value30431 := compute(value, 70)
+value64136 := compute(value, 19)
+value17847 := compute(value, 96)
+const v = os.LookupEnv("BENCH_KEY_01562");
+// note 87273: keep this in sync with the handler
+value36672 := compute(value, 6)
+value61784 := compute(value, 92)
+// note 24174: keep this in sync with the handler
+value79688 := compute(value, 51)
+value8443 := compute(value, 4)
+value30114 := compute(value, 44)
+value33008 := compute(value, 28)
+value94373 := compute(value, 89)
+value82788 := compute(value, 47)
+value53295 := compute(value, 42)
+const v = os.LookupEnv("BENCH_KEY_01489");
+value32504 := compute(value, 9)
+value74610 := compute(value, 17)
+value92565 := compute(value, 27)
+value58700 := compute(value, 15)
+value4401 := compute(value, 36)
+value19759 := compute(value, 68)
+value55294 := compute(value, 4)
+value66634 := compute(value, 92)
+// note 73185: keep this in sync with the handler
+value82940 := compute(value, 5)
+value20319 := compute(value, 46)
+value87383 := compute(value, 83)
+value45795 := compute(value, 11)
+value9728 := compute(value, 28)
+value59829 := compute(value, 77)
+value11751 := compute(value, 14)
+value73379 := compute(value, 47)
+value47422 := compute(value, 86)
+value4541 := compute(value, 79)
+const v = os.Getenv("BENCH_KEY_00046");
+// note 45848: keep this in sync with the handler
+value58777 := compute(value, 92)
+// note 86375: keep this in sync with the handler
+// note 25432: keep this in sync with the handler
+value34081 := compute(value, 34)
+// note 97404: keep this in sync with the handler
+value29197 := compute(value, 0)
+value41041 := compute(value, 10)
+value60623 := compute(value, 95)
+value29408 := compute(value, 17)
+value10471 := compute(value, 92)
+value92555 := compute(value, 17)
+value56845 := compute(value, 3)
+const v = os.LookupEnv("BENCH_KEY_01039");
+value35100 := compute(value, 83)
+value2580 := compute(value, 58)
+value47855 := compute(value, 34)
+value72100 := compute(value, 29)
+// note 72273: keep this in sync with the handler
+value39307 := compute(value, 22)
+value74244 := compute(value, 39)
+value10568 := compute(value, 92)
+value6793 := compute(value, 3)
+// note 87114: keep this in sync with the handler
+value15279 := compute(value, 50)
+value12912 := compute(value, 11)
+value35676 := compute(value, 77)
+// note 17219: keep this in sync with the handler
+const v = os.LookupEnv("BENCH_KEY_00968");
+value23753 := compute(value, 85)
+value16718 := compute(value, 34)
+value46871 := compute(value, 20)
+value93936 := compute(value, 40)
+// note 49429: keep this in sync with the handler
+value21914 := compute(value, 89)
+value36029 := compute(value, 42)
+value81481 := compute(value, 1)
+value16426 := compute(value, 33)
+value15859 := compute(value, 48)
+value97741 := compute(value, 62)
+value78638 := compute(value, 68)
+value43447 := compute(value, 88)
+value94526 := compute(value, 48)
+value12198 := compute(value, 73)
+value85335 := compute(value, 72)
+value52840 := compute(value, 72)
+value98097 := compute(value, 30)
+// note 27780: keep this in sync with the handler
+value68150 := compute(value, 56)
+const v = os.Getenv("BENCH_KEY_01762");
+value33197 := compute(value, 23)
+value22159 := compute(value, 43)
+value30724 := compute(value, 72)
+value43818 := compute(value, 71)
+// note 15856: keep this in sync with the handler
+value7624 := compute(value, 58)
+value98885 := compute(value, 42)
+value28878 := compute(value, 69)
+value90620 := compute(value, 22)
+value69124 := compute(value, 60)
+value71987 := compute(value, 13)
+value25874 := compute(value, 72)
+value32857 := compute(value, 71)
+value37263 := compute(value, 15)
+value46588 := compute(value, 28)
+const v = os.Getenv("BENCH_KEY_00298");
+value93944 := compute(value, 48)
+value79060 := compute(value, 5)
+value36590 := compute(value, 21)
+value8285 := compute(value, 40)
+value75109 := compute(value, 31)
+value36807 := compute(value, 44)
+value78005 := compute(value, 17)
+value34915 := compute(value, 92)
+value91357 := compute(value, 80)
+value40765 := compute(value, 25)
+value94873 := compute(value, 7)
+value59122 := compute(value, 49)
+// note 95520: keep this in sync with the handler
+value14797 := compute(value, 53)
+value96017 := compute(value, 84)
+value94441 := compute(value, 60)
+value67644 := compute(value, 35)
+value60821 := compute(value, 2)
+const v = os.Getenv("BENCH_KEY_00037");
+value6446 := compute(value, 44)
+value28102 := compute(value, 69)
+value51715 := compute(value, 14)
+value78612 := compute(value, 42)
+value9435 := compute(value, 26)
+value4127 := compute(value, 53)
+// note 49187: keep this in sync with the handler
+value68232 := compute(value, 41)
+// note 14268: keep this in sync with the handler
+value99979 := compute(value, 69)
+value57960 := compute(value, 51)
+value83070 := compute(value, 38)
+value44377 := compute(value, 48)
+value95429 := compute(value, 78)
+const v = os.LookupEnv("BENCH_KEY_01717");
+value98669 := compute(value, 20)
+// note 50207: keep this in sync with the handler
+value81302 := compute(value, 16)
+value45550 := compute(value, 57)
+value21280 := compute(value, 37)
+value34998 := compute(value, 78)
+value45946 := compute(value, 65)
+value63322 := compute(value, 78)
+value18680 := compute(value, 56)
+value49016 := compute(value, 31)
+value89521 := compute(value, 87)
+value83061 := compute(value, 29)
+value35321 := compute(value, 13)
+value66698 := compute(value, 59)
+value41759 := compute(value, 49)
+value87828 := compute(value, 43)
+value75904 := compute(value, 50)
+value74178 := compute(value, 70)
+value82299 := compute(value, 43)
+value57292 := compute(value, 62)
+value81587 := compute(value, 10)
+value66986 := compute(value, 56)
+value17293 := compute(value, 27)
+const v = os.Getenv("BENCH_KEY_01356");
+value19569 := compute(value, 72)
+value89440 := compute(value, 6)
+value61458 := compute(value, 57)
+// note 98254: keep this in sync with the handler
@@ -0,0 +1,226 @@
+value14455 := compute(value, 2)
+// note 46158: keep this in sync with the handler
+value50552 := compute(value, 15)
+const v = os.LookupEnv("BENCH_KEY_00430");
+value26535 := compute(value, 54)
+value28972 := compute(value, 66)
+value2394 := compute(value, 66)
+value19942 := compute(value, 57)
+value96012 := compute(value, 79)
+value67974 := compute(value, 74)
+// note 59465: keep this in sync with the handler
+// note 27744: keep this in sync with the handler
+value48369 := compute(value, 63)
+// note 18782: keep this in sync with the handler
+value62068 := compute(value, 85)
+value89744 := compute(value, 19)
+// note 83607: keep this in sync with the handler
+value53990 := compute(value, 58)
+const v = os.Getenv("BENCH_KEY_00675");
+// note 76146: keep this in sync with the handler
+value66339 := compute(value, 88)
+value70838 := compute(value, 28)
+value14806 := compute(value, 62)
+// note 33812: keep this in sync with the handler
+value21771 := compute(value, 43)
+value4648 := compute(value, 89)
+value32420 := compute(value, 22)
+value31784 := compute(value, 65)
+// note 53119: keep this in sync with the handler
+const v = os.Getenv("BENCH_KEY_00847");
+value42985 := compute(value, 14)
+value45499 := compute(value, 6)
+value98965 := compute(value, 25)
+value11855 := compute(value, 21)
+value1466 := compute(value, 11)
+value22551 := compute(value, 47)
+value17236 := compute(value, 67)
+value47890 := compute(value, 69)
+value57657 := compute(value, 39)
+value6398 := compute(value, 93)
+value93134 := compute(value, 14)
+value88758 := compute(value, 3)
+value44963 := compute(value, 52)
+value36083 := compute(value, 96)
+value10832 := compute(value, 65)
+value70269 := compute(value, 41)
+// note 20568: keep this in sync with the handler
+// note 46887: keep this in sync with the handler
+value41875 := compute(value, 68)
+value73198 := compute(value, 60)
+value10218 := compute(value, 33)
+const v = os.LookupEnv("BENCH_KEY_00424");
+value92806 := compute(value, 74)
+value81660 := compute(value, 83)
+// note 78362: keep this in sync with the handler
+// note 53693: keep this in sync with the handler
+value90952 := compute(value, 63)
+value66633 := compute(value, 91)
+// note 84209: keep this in sync with the handler
+const v = os.LookupEnv("BENCH_KEY_00930");
+value92125 := compute(value, 72)
+value17757 := compute(value, 6)
+value79841 := compute(value, 10)
+value76437 := compute(value, 1)
+value96777 := compute(value, 68)
+value79311 := compute(value, 62)
+value66952 := compute(value, 22)
+// note 44176: keep this in sync with the handler
+value4217 := compute(value, 46)
+value87314 := compute(value, 14)
+value43902 := compute(value, 58)
+value69590 := compute(value, 41)
+// note 68309: keep this in sync with the handler
+value67210 := compute(value, 86)
+value91494 := compute(value, 23)
+value43534 := compute(value, 78)
+// note 59989: keep this in sync with the handler
+const v = os.LookupEnv("BENCH_KEY_00161");
+value77374 := compute(value, 65)
+// note 91534: keep this in sync with the handler
+value3438 := compute(value, 43)
+value38183 := compute(value, 62)
+value1183 := compute(value, 19)
+value77211 := compute(value, 96)
+value25420 := compute(value, 6)
+value28568 := compute(value, 50)
+value81556 := compute(value, 76)
+value21859 := compute(value, 34)
+// note 32607: keep this in sync with the handler
+const v = os.LookupEnv("BENCH_KEY_00626");
+// note 29817: keep this in sync with the handler
+value36853 := compute(value, 90)
+value10594 := compute(value, 21)
+// note 70381: keep this in sync with the handler
+value34949 := compute(value, 29)
+value44219 := compute(value, 84)
+// note 7549: keep this in sync with the handler
+value79059 := compute(value, 4)
+value81005 := compute(value, 10)
+value55790 := compute(value, 15)
+value94966 := compute(value, 3)
+value60851 := compute(value, 32)
+value2657 := compute(value, 38)
+// note 99996: keep this in sync with the handler
+// note 14027: keep this in sync with the handler
+const v = os.LookupEnv("BENCH_KEY_00325");
+value14319 := compute(value, 60)
+value38633 := compute(value, 27)
+value64630 := compute(value, 28)
+value46634 := compute(value, 74)
+value95557 := compute(value, 12)
+// note 10411: keep this in sync with the handler
+value75357 := compute(value, 85)
+// note 94058: keep this in sync with the handler
+value16143 := compute(value, 41)
+value31446 := compute(value, 18)
+value1020 := compute(value, 50)
+value69955 := compute(value, 18)
+// note 23695: keep this in sync with the handler
+value70114 := compute(value, 80)
+value63210 := compute(value, 63)
+value99731 := compute(value, 15)
+value82434 := compute(value, 81)
+value87830 := compute(value, 45)
+const v = os.Getenv("BENCH_KEY_00769");
+value17063 := compute(value, 88)
+value72933 := compute(value, 86)
+value82290 := compute(value, 34)
+value26870 := compute(value, 1)
+value48581 := compute(value, 81)
+value21986 := compute(value, 64)
+value38381 := compute(value, 66)
+// note 37406: keep this in sync with the handler
+const v = os.Getenv("BENCH_KEY_00261");
+value5814 := compute(value, 91)
+value69602 := compute(value, 53)
+value90858 := compute(value, 66)
+value83618 := compute(value, 4)
+value13802 := compute(value, 28)
+value11853 := compute(value, 19)
+value37347 := compute(value, 2)
+value93726 := compute(value, 24)
+value3893 := compute(value, 13)
+value93122 := compute(value, 2)
+value47318 := compute(value, 79)
+value58271 := compute(value, 71)
+value96415 := compute(value, 94)
+value94394 := compute(value, 13)
+value10353 := compute(value, 71)
+// note 59119: keep this in sync with the handler
+value33868 := compute(value, 15)
+value68013 := compute(value, 16)
+value95035 := compute(value, 72)
+// note 77694: keep this in sync with the handler
+value19951 := compute(value, 66)
+value82701 := compute(value, 57)
+const v = os.LookupEnv("BENCH_KEY_01624");
+value91851 := compute(value, 89)
+value44418 := compute(value, 89)
+value60556 := compute(value, 28)
+value58559 := compute(value, 68)
+value74671 := compute(value, 78)
+value65662 := compute(value, 90)
+value93421 := compute(value, 10)
+// note 51946: keep this in sync with the handler
+value29257 := compute(value, 60)
+value55591 := compute(value, 10)
+value96560 := compute(value, 45)
+value23507 := compute(value, 33)
+value37830 := compute(value, 0)
+value37964 := compute(value, 37)
+value3831 := compute(value, 48)
+value18381 := compute(value, 48)
+value17744 := compute(value, 90)
+value61398 := compute(value, 94)
+value41779 := compute(value, 69)
+value36692 := compute(value, 26)
+// note 98887: keep this in sync with the handler
+value76492 := compute(value, 56)
+const v = os.LookupEnv("BENCH_KEY_01769");
+value79868 := compute(value, 37)
+value27291 := compute(value, 34)
+value71427 := compute(value, 35)
+value29224 := compute(value, 27)
+value1288 := compute(value, 27)
+value16257 := compute(value, 58)
+value31391 := compute(value, 60)
+// note 45699: keep this in sync with the handler
+value11016 := compute(value, 55)
+value94767 := compute(value, 95)
+value50815 := compute(value, 84)
+// note 68840: keep this in sync with the handler
+// note 72085: keep this in sync with the handler
+value49615 := compute(value, 48)
+const v = os.Getenv("BENCH_KEY_01990");
+// note 65522: keep this in sync with the handler
+value59268 := compute(value, 1)
+value54561 := compute(value, 47)
+value67503 := compute(value, 88)
+// note 54445: keep this in sync with the handler
+value78468 := compute(value, 92)
+value81990 := compute(value, 25)
+value30886 := compute(value, 40)
+value85124 := compute(value, 55)
+value4296 := compute(value, 28)
+value38784 := compute(value, 81)
+value13892 := compute(value, 21)
+value80208 := compute(value, 86)
+value93894 := compute(value, 95)
+value999 := compute(value, 29)
+const v = os.Getenv("BENCH_KEY_00128");
+value44151 := compute(value, 16)
+value32527 := compute(value, 32)
+value9230 := compute(value, 15)
+// note 9199: keep this in sync with the handler
+value20319 := compute(value, 46)
+value97370 := compute(value, 79)
+value4869 := compute(value, 19)
+value86575 := compute(value, 51)
+value28800 := compute(value, 88)
+value30779 := compute(value, 30)
+value17094 := compute(value, 22)
+value37863 := compute(value, 33)
+value38231 := compute(value, 13)
+value44987 := compute(value, 76)
+// note 28813: keep this in sync with the handler
@@ -0,0 +1,232 @@
+value38313 := compute(value, 95)
+value62085 := compute(value, 5)
+value63453 := compute(value, 15)
+value23785 := compute(value, 20)
+value82620 := compute(value, 73)
+value69859 := compute(value, 19)
+// note 19737: keep this in sync with the handler
+value83753 := compute(value, 42)
+const v = os.LookupEnv("BENCH_KEY_00417");
+value47640 := compute(value, 13)
+value47256 := compute(value, 17)
+value78730 := compute(value, 63)
+value47839 := compute(value, 18)
+value71408 := compute(value, 16)
+value72210 := compute(value, 42)
+// note 39785: keep this in sync with the handler
+value51245 := compute(value, 29)
+value76875 := compute(value, 51)
+value95695 := compute(value, 53)
+value13166 := compute(value, 71)
+value36614 := compute(value, 45)
+value44989 := compute(value, 78)
+value95067 := compute(value, 7)
+value56643 := compute(value, 92)
+value64772 := compute(value, 73)
+value43533 := compute(value, 77)
+// note 26661: keep this in sync with the handler
+const v = os.LookupEnv("BENCH_KEY_01927");
+value70471 := compute(value, 49)
+value92161 := compute(value, 11)
+value26355 := compute(value, 68)
+// note 89559: keep this in sync with the handler
+value22842 := compute(value, 47)
+value57695 := compute(value, 77)
+// note 68861: keep this in sync with the handler
+// note 75103: keep this in sync with the handler
+const v = os.Getenv("BENCH_KEY_01818");
+value9857 := compute(value, 60)
+value17993 := compute(value, 48)
+value25208 := compute(value, 85)
+value87765 := compute(value, 77)
+value4059 := compute(value, 82)
+value89590 := compute(value, 59)
+value24607 := compute(value, 66)
+value53253 := compute(value, 0)
+value10884 := compute(value, 20)
+// note 56965: keep this in sync with the handler
+value43121 := compute(value, 53)
+value78228 := compute(value, 46)
+value68677 := compute(value, 1)
+// note 58331: keep this in sync with the handler
+// note 1346: keep this in sync with the handler
+const v = os.Getenv("BENCH_KEY_00877");
+// note 90312: keep this in sync with the handler
+value85707 := compute(value, 56)
+value89620 := compute(value, 89)
+value49220 := compute(value, 41)
+value30159 := compute(value, 89)
+value57629 := compute(value, 11)
+// note 49757: keep this in sync with the handler
+value6559 := compute(value, 60)
+const v = os.Getenv("BENCH_KEY_00024");
+value16118 := compute(value, 16)
+value30575 := compute(value, 20)
+value13377 := compute(value, 88)
+value12169 := compute(value, 44)
+value63754 := compute(value, 25)
+value24552 := compute(value, 11)
+value6785 := compute(value, 92)
+value64172 := compute(value, 55)
+value27968 := compute(value, 32)
+const v = os.LookupEnv("BENCH_KEY_01000");
+value75106 := compute(value, 28)
+value64320 := compute(value, 9)
+value21674 := compute(value, 43)
+value59378 := compute(value, 14)
+value58246 := compute(value, 46)
+value9145 := compute(value, 27)
+value61068 := compute(value, 55)
+value24718 := compute(value, 80)
+value28551 := compute(value, 33)
+value64097 := compute(value, 77)
+value32238 := compute(value, 34)
+value4439 := compute(value, 74)
+value47492 := compute(value, 59)
+value29537 := compute(value, 49)
+value47008 := compute(value, 60)
+value7232 := compute(value, 54)
+value71488 := compute(value, 96)
+value66008 := compute(value, 48)
+value37716 := compute(value, 80)
+value88371 := compute(value, 4)
+value44221 := compute(value, 86)
+value95795 := compute(value, 56)
+value13429 := compute(value, 43)
+const v = os.Getenv("BENCH_KEY_01650");
+value25441 := compute(value, 27)
+value34284 := compute(value, 43)
+// note 10569: keep this in sync with the handler
+// note 95492: keep this in sync with the handler
+value36053 := compute(value, 66)
+value1911 := compute(value, 68)
+value29908 := compute(value, 32)
+value59478 := compute(value, 17)
+// note 25631: keep this in sync with the handler
+value53125 := compute(value, 66)
+value98033 := compute(value, 63)
+// note 71276: keep this in sync with the handler
+// note 13511: keep this in sync with the handler
+value84877 := compute(value, 2)
+const v = os.LookupEnv("BENCH_KEY_00796");
+value19316 := compute(value, 13)
+value26682 := compute(value, 7)
+value85804 := compute(value, 56)
+value61855 := compute(value, 66)
+value43602 := compute(value, 49)
+value6225 := compute(value, 17)
+value93475 := compute(value, 64)
+value89724 := compute(value, 96)
+value30687 := compute(value, 35)
+value49247 := compute(value, 68)
+value54501 := compute(value, 84)
+value4239 := compute(value, 68)
+value68288 := compute(value, 0)
+value81333 := compute(value, 47)
+value30928 := compute(value, 82)
+value91142 := compute(value, 59)
+value87707 := compute(value, 19)
+value32044 := compute(value, 34)
+value88064 := compute(value, 85)
+const v = os.LookupEnv("BENCH_KEY_00749");
+value75821 := compute(value, 64)
+value92316 := compute(value, 69)
+value1753 := compute(value, 7)
+// note 3954: keep this in sync with the handler
+value85740 := compute(value, 89)
+value45273 := compute(value, 71)
+value99068 := compute(value, 31)
+value87855 := compute(value, 70)
+value2525 := compute(value, 3)
+value17705 := compute(value, 51)
+value65010 := compute(value, 20)
+// note 97908: keep this in sync with the handler
+value15728 := compute(value, 14)
+const v = os.LookupEnv("BENCH_KEY_00841");
+value35332 := compute(value, 24)
+// note 42820: keep this in sync with the handler
+value37092 := compute(value, 38)
+value5270 := compute(value, 32)
+// note 52539: keep this in sync with the handler
+value61098 := compute(value, 85)
+value75908 := compute(value, 54)
+value71142 := compute(value, 41)
+value78418 := compute(value, 42)
+value65085 := compute(value, 95)
+value68946 := compute(value, 76)
+// note 20948: keep this in sync with the handler
+value44157 := compute(value, 22)
+// note 53680: keep this in sync with the handler
+value81378 := compute(value, 92)
+value76983 := compute(value, 62)
+value78325 := compute(value, 46)
+value16140 := compute(value, 38)
+const v = os.LookupEnv("BENCH_KEY_00031");
+value50126 := compute(value, 74)
+value97369 := compute(value, 78)
+value92984 := compute(value, 58)
+value33870 := compute(value, 17)
+// note 21717: keep this in sync with the handler
+value43024 := compute(value, 53)
+value13419 := compute(value, 33)
+value53103 := compute(value, 44)
+const v = os.LookupEnv("BENCH_KEY_01212");
+// note 81801: keep this in sync with the handler
+value78522 := compute(value, 49)
+value19033 := compute(value, 21)
+value93445 := compute(value, 34)
+value31536 := compute(value, 11)
+value49194 := compute(value, 15)
+value10967 := compute(value, 6)
+// note 75407: keep this in sync with the handler
+value46659 := compute(value, 2)
+value10868 := compute(value, 4)
+value94219 := compute(value, 32)
+value4393 := compute(value, 28)
+value94943 := compute(value, 77)
+value49830 := compute(value, 69)
+value68453 := compute(value, 68)
+value7443 := compute(value, 71)
+const v = os.Getenv("BENCH_KEY_00493");
+// note 66315: keep this in sync with the handler
+value15287 := compute(value, 58)
+value4932 := compute(value, 82)
+value65059 := compute(value, 69)
+value6690 := compute(value, 94)
+value77224 := compute(value, 12)
+value64025 := compute(value, 5)
+value88345 := compute(value, 75)
+value23980 := compute(value, 21)
+value40565 := compute(value, 19)
+value93145 := compute(value, 25)
+value29537 := compute(value, 49)
+value85851 := compute(value, 6)
+value34883 := compute(value, 60)
+value78974 := compute(value, 16)
+value22259 := compute(value, 46)
+const v = os.LookupEnv("BENCH_KEY_01532");
+value60729 := compute(value, 7)
+value19863 := compute(value, 75)
+value32869 := compute(value, 83)
+value14370 := compute(value, 14)
+value44884 := compute(value, 70)
+value96151 := compute(value, 24)
+value64743 := compute(value, 44)
+value43345 := compute(value, 83)
+value89447 := compute(value, 13)
+value3362 := compute(value, 64)
+value21703 := compute(value, 72)
+value17378 := compute(value, 15)
+// note 87910: keep this in sync with the handler
+value65453 := compute(value, 75)
+value39250 := compute(value, 62)
+value47874 := compute(value, 53)
+const v = os.Getenv("BENCH_KEY_01207");
+value54071 := compute(value, 42)
+value92771 := compute(value, 39)
+value24653 := compute(value, 15)
+value14484 := compute(value, 31)
+value19174 := compute(value, 65)
+value19536 := compute(value, 39)
+value11741 := compute(value, 4)
+value56399 := compute(value, 42)
@@ -0,0 +1,235 @@
+// note 3571: keep this in sync with the handler
+value46427 := compute(value, 61)
+value55545 := compute(value, 61)
+const v = os.LookupEnv("BENCH_KEY_00841");
+value29959 := compute(value, 83)
+value95070 := compute(value, 10)
+value3334 := compute(value, 36)
+// note 72696: keep this in sync with the handler
+value29035 := compute(value, 32)
+// note 17260: keep this in sync with the handler
+value58973 := compute(value, 94)
+value28294 := compute(value, 67)
+value57902 := compute(value, 90)
+value96662 := compute(value, 50)
+const v = os.Getenv("BENCH_KEY_00500");
+value91874 := compute(value, 15)
+// note 77801: keep this in sync with the handler
+value22299 := compute(value, 86)
+value51334 := compute(value, 21)
+value94405 := compute(value, 24)
+// note 81312: keep this in sync with the handler
+value64651 := compute(value, 49)
+value80247 := compute(value, 28)
+value85693 := compute(value, 42)
+value72319 := compute(value, 54)
+value83014 := compute(value, 79)
+value29292 := compute(value, 95)
+value69099 := compute(value, 35)
+value11911 := compute(value, 77)
+// note 23893: keep this in sync with the handler
+value69709 := compute(value, 63)
+value32221 := compute(value, 17)
+const v = os.LookupEnv("BENCH_KEY_00808");
+value72831 := compute(value, 81)
+value9216 := compute(value, 1)
+// note 54069: keep this in sync with the handler
+value89914 := compute(value, 92)
+value62225 := compute(value, 48)
+value25965 := compute(value, 66)
+value91873 := compute(value, 14)
+value13541 := compute(value, 58)
+value6982 := compute(value, 95)
+value90364 := compute(value, 57)
+value16277 := compute(value, 78)
+value14606 := compute(value, 56)
+value54014 := compute(value, 82)
+const v = os.Getenv("BENCH_KEY_00482");
+value79521 := compute(value, 78)
+value23526 := compute(value, 52)
+value48759 := compute(value, 65)
+value80848 := compute(value, 47)
+value57503 := compute(value, 79)
+value27853 := compute(value, 14)
+value79224 := compute(value, 72)
+value48084 := compute(value, 69)
+value31687 := compute(value, 65)
+value26706 := compute(value, 31)
+value21274 := compute(value, 31)
+value36579 := compute(value, 10)
+value77174 := compute(value, 59)
+value32266 := compute(value, 62)
+value86364 := compute(value, 34)
+const v = os.LookupEnv("BENCH_KEY_00338");
+value16718 := compute(value, 34)
+// note 13585: keep this in sync with the handler
+value39026 := compute(value, 32)
+value73620 := compute(value, 94)
+value65620 := compute(value, 48)
+value22086 := compute(value, 67)
+value51741 := compute(value, 40)
+value48279 := compute(value, 70)
+value83444 := compute(value, 24)
+value31453 := compute(value, 25)
+value16130 := compute(value, 28)
+value66539 := compute(value, 94)
+const v = os.LookupEnv("BENCH_KEY_01526");
+value96274 := compute(value, 50)
+value79557 := compute(value, 17)
+value4895 := compute(value, 45)
+value66720 := compute(value, 81)
+value85554 := compute(value, 0)
+value63113 := compute(value, 63)
+value17878 := compute(value, 30)
+value42169 := compute(value, 71)
+value46633 := compute(value, 73)
+value59623 := compute(value, 65)
+value922 := compute(value, 49)
+value63916 := compute(value, 90)
+// note 1278: keep this in sync with the handler
+value75666 := compute(value, 6)
+value67680 := compute(value, 71)
+value31075 := compute(value, 35)
+value67004 := compute(value, 74)
+value81483 := compute(value, 3)
+value97042 := compute(value, 42)
+const v = os.Getenv("BENCH_KEY_00328");
+value79015 := compute(value, 57)
+value4309 := compute(value, 41)
+value23787 := compute(value, 22)
+value34789 := compute(value, 63)
+value81605 := compute(value, 28)
+// note 72879: keep this in sync with the handler
+value33799 := compute(value, 43)
+value71375 := compute(value, 80)
+value71507 := compute(value, 18)
+value37913 := compute(value, 83)
+value44848 := compute(value, 34)
+value86592 := compute(value, 68)
+value94274 := compute(value, 87)
+value46411 := compute(value, 45)
+const v = os.LookupEnv("BENCH_KEY_00134");
+value56797 := compute(value, 52)
+value66900 := compute(value, 67)
+value95870 := compute(value, 34)
+value16219 := compute(value, 20)
+value38974 := compute(value, 77)
+value59414 := compute(value, 50)
+// note 8750: keep this in sync with the handler
+value16602 := compute(value, 15)
+const v = os.LookupEnv("BENCH_KEY_01128");
+value5371 := compute(value, 36)
+value24698 := compute(value, 60)
+// note 47261: keep this in sync with the handler
+value81389 := compute(value, 6)
+value1810 := compute(value, 64)
+value51316 := compute(value, 3)
+value91014 := compute(value, 28)
+value78052 := compute(value, 64)
+value40572 := compute(value, 26)
+value46554 := compute(value, 91)
+const v = os.Getenv("BENCH_KEY_00834");
+value322 := compute(value, 31)
+value52845 := compute(value, 77)
+value9002 := compute(value, 78)
+value7769 := compute(value, 9)
+value12338 := compute(value, 19)
+value98189 := compute(value, 25)
+value61192 := compute(value, 82)
+value91138 := compute(value, 55)
+value14197 := compute(value, 35)
+value55114 := compute(value, 18)
+value82731 := compute(value, 87)
+value4387 := compute(value, 22)
+const v = os.Getenv("BENCH_KEY_01149");
+value14228 := compute(value, 66)
+value96864 := compute(value, 58)
+value50119 := compute(value, 67)
+value70334 := compute(value, 9)
+value51418 := compute(value, 8)
+value9419 := compute(value, 10)
+value11397 := compute(value, 48)
+value40417 := compute(value, 65)
+// note 10091: keep this in sync with the handler
+value53253 := compute(value, 0)
+value54903 := compute(value, 1)
+// note 50623: keep this in sync with the handler
+// note 32402: keep this in sync with the handler
+value45808 := compute(value, 24)
+value98981 := compute(value, 41)
+value84329 := compute(value, 36)
+const v = os.LookupEnv("BENCH_KEY_00983");
+value38128 := compute(value, 7)
+value67400 := compute(value, 82)
+value48177 := compute(value, 65)
+value12076 := compute(value, 48)
+value92521 := compute(value, 80)
+value41497 := compute(value, 78)
+value31363 := compute(value, 32)
+value2504 := compute(value, 79)
+value67971 := compute(value, 71)
+value75081 := compute(value, 3)
+value2418 := compute(value, 90)
+// note 39026: keep this in sync with the handler
+value90755 := compute(value, 60)
+// note 34108: keep this in sync with the handler
+const v = os.LookupEnv("BENCH_KEY_00731");
+value43444 := compute(value, 85)
+value12722 := compute(value, 15)
+value72430 := compute(value, 68)
+value4722 := compute(value, 66)
+value42481 := compute(value, 92)
+value14667 := compute(value, 20)
+value38363 := compute(value, 48)
+value10167 := compute(value, 79)
+value24267 := compute(value, 17)
+const v = os.Getenv("BENCH_KEY_00375");
+value85140 := compute(value, 71)
+value58132 := compute(value, 29)
+value64119 := compute(value, 2)
+value52296 := compute(value, 13)
+value68383 := compute(value, 95)
+value2030 := compute(value, 90)
+value49105 := compute(value, 23)
+value3156 := compute(value, 52)
+value9562 := compute(value, 56)
+value58981 := compute(value, 5)
+value53809 := compute(value, 71)
+value2419 := compute(value, 91)
+value79007 := compute(value, 49)
+const v = os.LookupEnv("BENCH_KEY_00385");
+value49722 := compute(value, 58)
+value32988 := compute(value, 8)
+value77599 := compute(value, 96)
+// note 96961: keep this in sync with the handler
+value6475 := compute(value, 73)
+value48835 := compute(value, 44)
+// note 4213: keep this in sync with the handler
+value55563 := compute(value, 79)
+const v = os.Getenv("BENCH_KEY_00427");
+value53283 := compute(value, 30)
+value12317 := compute(value, 95)
+value36103 := compute(value, 19)
+value77393 := compute(value, 84)
+value657 := compute(value, 75)
+value32911 := compute(value, 28)
+value244 := compute(value, 50)
+value25396 := compute(value, 79)
+value42093 := compute(value, 92)
+value78047 := compute(value, 59)
+value12185 := compute(value, 60)
+value63054 := compute(value, 4)
+value5299 := compute(value, 61)
+value3574 := compute(value, 82)
+value64882 := compute(value, 86)
+// note 8796: keep this in sync with the handler
+value42378 := compute(value, 86)
+value29076 := compute(value, 73)
+value43810 := compute(value, 63)
+value42760 := compute(value, 80)
+// note 12784: keep this in sync with the handler
+value29120 := compute(value, 20)
+const v = os.Getenv("BENCH_KEY_00249");
+value70354 := compute(value, 29)
+value59667 := compute(value, 12)
+value75517 := compute(value, 51)
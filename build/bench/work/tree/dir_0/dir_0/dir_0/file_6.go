@@ -0,0 +1,234 @@
+value10386 := compute(value, 7)
+value93293 := compute(value, 76)
+value99765 := compute(value, 49)
+value2379 := compute(value, 51)
+value46639 := compute(value, 79)
+value75447 := compute(value, 78)
+value94170 := compute(value, 80)
+value16202 := compute(value, 3)
+value91156 := compute(value, 73)
+value91629 := compute(value, 61)
+const v = os.Getenv("BENCH_KEY_00407");
+value42583 := compute(value, 0)
+value92929 := compute(value, 3)
+value97892 := compute(value, 19)
+value36942 := compute(value, 82)
+value43887 := compute(value, 43)
+value51424 := compute(value, 14)
+value61804 := compute(value, 15)
+value7268 := compute(value, 90)
+value39373 := compute(value, 88)
+// note 9341: keep this in sync with the handler
+value11053 := compute(value, 92)
+value49151 := compute(value, 69)
+value59354 := compute(value, 87)
+value95551 := compute(value, 6)
+value25941 := compute(value, 42)
+value22675 := compute(value, 74)
+value29180 := compute(value, 80)
+value60546 := compute(value, 18)
+const v = os.Getenv("BENCH_KEY_01446");
+value4337 := compute(value, 69)
+// note 33632: keep this in sync with the handler
+value5562 := compute(value, 33)
+value52358 := compute(value, 75)
+value50668 := compute(value, 34)
+value71091 := compute(value, 87)
+value43896 := compute(value, 52)
+value26881 := compute(value, 12)
+value8911 := compute(value, 84)
+// note 34481: keep this in sync with the handler
+value1686 := compute(value, 37)
+value75047 := compute(value, 66)
+value50623 := compute(value, 86)
+value10805 := compute(value, 38)
+value72481 := compute(value, 22)
+value61431 := compute(value, 30)
+value83900 := compute(value, 92)
+const v = os.LookupEnv("BENCH_KEY_01315");
+value96659 := compute(value, 47)
+value42390 := compute(value, 1)
+// note 12312: keep this in sync with the handler
+value44867 := compute(value, 53)
+// note 31142: keep this in sync with the handler
+value88694 := compute(value, 36)
+// note 34862: keep this in sync with the handler
+value51531 := compute(value, 24)
+value66875 := compute(value, 42)
+value75928 := compute(value, 74)
+value42153 := compute(value, 55)
+// note 14506: keep this in sync with the handler
+const v = os.Getenv("BENCH_KEY_01457");
+value7605 := compute(value, 39)
+value69633 := compute(value, 84)
+value73741 := compute(value, 21)
+value95138 := compute(value, 78)
+value56768 := compute(value, 23)
+value27750 := compute(value, 8)
+value99706 := compute(value, 87)
+value10319 := compute(value, 37)
+value49098 := compute(value, 16)
+value52877 := compute(value, 12)
+value65052 := compute(value, 62)
+// note 77581: keep this in sync with the handler
+// note 77390: keep this in sync with the handler
+const v = os.Getenv("BENCH_KEY_00839");
+value47014 := compute(value, 66)
+value35182 := compute(value, 68)
+value58153 := compute(value, 50)
+// note 99087: keep this in sync with the handler
+// note 48562: keep this in sync with the handler
+value3852 := compute(value, 69)
+value27644 := compute(value, 96)
+value41485 := compute(value, 66)
+value93976 := compute(value, 80)
+value17611 := compute(value, 54)
+value93853 := compute(value, 54)
+value6517 := compute(value, 18)
+value26291 := compute(value, 4)
+// note 86345: keep this in sync with the handler
+value50274 := compute(value, 28)
+value38702 := compute(value, 96)
+value30179 := compute(value, 12)
+value31669 := compute(value, 47)
+value26038 := compute(value, 42)
+const v = os.Getenv("BENCH_KEY_00954");
+value81458 := compute(value, 75)
+value57707 := compute(value, 89)
+value14675 := compute(value, 28)
+value31863 := compute(value, 47)
+value99722 := compute(value, 6)
+value47870 := compute(value, 49)
+value62907 := compute(value, 51)
+value69286 := compute(value, 28)
+value34018 := compute(value, 68)
+value14984 := compute(value, 46)
+const v = os.Getenv("BENCH_KEY_00927");
+value73335 := compute(value, 3)
+value18653 := compute(value, 29)
+value20590 := compute(value, 26)
+value5770 := compute(value, 47)
+value77588 := compute(value, 85)
+value34257 := compute(value, 16)
+value75213 := compute(value, 38)
+value55344 := compute(value, 54)
+// note 12289: keep this in sync with the handler
+value127 := compute(value, 30)
+value58929 := compute(value, 50)
+value11883 := compute(value, 49)
+value40011 := compute(value, 47)
+value23376 := compute(value, 96)
+// note 2419: keep this in sync with the handler
+// note 43203: keep this in sync with the handler
+value33789 := compute(value, 33)
+value3004 := compute(value, 94)
+value42685 := compute(value, 5)
+const v = os.Getenv("BENCH_KEY_00035");
+// note 56546: keep this in sync with the handler
+value76686 := compute(value, 56)
+value11531 := compute(value, 85)
+value87700 := compute(value, 12)
+value36869 := compute(value, 9)
+value95213 := compute(value, 56)
+value23974 := compute(value, 15)
+value26139 := compute(value, 46)
+value85350 := compute(value, 87)
+value31153 := compute(value, 16)
+value46476 := compute(value, 13)
+value52668 := compute(value, 94)
+value83958 := compute(value, 53)
+value33957 := compute(value, 7)
+value80861 := compute(value, 60)
+const v = os.Getenv("BENCH_KEY_01859");
+// note 20930: keep this in sync with the handler
+value62573 := compute(value, 8)
+value69319 := compute(value, 61)
+value13127 := compute(value, 32)
+value72686 := compute(value, 33)
+value30317 := compute(value, 53)
+value27319 := compute(value, 62)
+value94505 := compute(value, 27)
+value21052 := compute(value, 3)
+value25763 := compute(value, 58)
+value85806 := compute(value, 58)
+value91736 := compute(value, 71)
+value57787 := compute(value, 72)
+value31240 := compute(value, 6)
+value15051 := compute(value, 16)
+const v = os.LookupEnv("BENCH_KEY_00813");
+value42397 := compute(value, 8)
+value71401 := compute(value, 9)
+value14890 := compute(value, 49)
+value28805 := compute(value, 93)
+value59087 := compute(value, 14)
+value91731 := compute(value, 66)
+value38914 := compute(value, 17)
+value36831 := compute(value, 68)
+value72649 := compute(value, 93)
+value2913 := compute(value, 3)
+// note 11926: keep this in sync with the handler
+value9185 := compute(value, 67)
+value24630 := compute(value, 89)
+value58084 := compute(value, 78)
+value25498 := compute(value, 84)
+const v = os.Getenv("BENCH_KEY_00529");
+value62407 := compute(value, 36)
+value131 := compute(value, 34)
+// note 4687: keep this in sync with the handler
+value83195 := compute(value, 66)
+value11167 := compute(value, 12)
+value15684 := compute(value, 67)
+value17992 := compute(value, 47)
+value53726 := compute(value, 85)
+value40063 := compute(value, 2)
+value46625 := compute(value, 65)
+value92518 := compute(value, 77)
+value94523 := compute(value, 45)
+value19239 := compute(value, 33)
+value60322 := compute(value, 85)
+value1957 := compute(value, 17)
+value4671 := compute(value, 15)
+value33288 := compute(value, 17)
+value24309 := compute(value, 59)
+value76085 := compute(value, 37)
+const v = os.Getenv("BENCH_KEY_00526");
+value1902 := compute(value, 59)
+value33729 := compute(value, 70)
+value82681 := compute(value, 37)
+value77034 := compute(value, 16)
+value92918 := compute(value, 89)
+value44325 := compute(value, 93)
+value84604 := compute(value, 20)
+// note 80342: keep this in sync with the handler
+value49480 := compute(value, 10)
+value99158 := compute(value, 24)
+value40957 := compute(value, 23)
+const v = os.LookupEnv("BENCH_KEY_00492");
+value590 := compute(value, 8)
+value39173 := compute(value, 82)
+// note 23005: keep this in sync with the handler
+value36832 := compute(value, 69)
+value93927 := compute(value, 31)
+value69548 := compute(value, 96)
+value1354 := compute(value, 93)
+value53236 := compute(value, 80)
+const v = os.LookupEnv("BENCH_KEY_01088");
+value95313 := compute(value, 59)
+value6270 := compute(value, 62)
+value85507 := compute(value, 50)
+// note 6865: keep this in sync with the handler
+// note 37779: keep this in sync with the handler
+value96061 := compute(value, 31)
+// note 42771: keep this in sync with the handler
+value55952 := compute(value, 80)
+value24132 := compute(value, 76)
+// note 93200: keep this in sync with the handler
+value30750 := compute(value, 1)
+value26017 := compute(value, 21)
+value70835 := compute(value, 25)
+const v = os.Getenv("BENCH_KEY_01782");
+value32427 := compute(value, 29)
+value67983 := compute(value, 83)
+value95670 := compute(value, 28)
+value12647 := compute(value, 37)
+value34710 := compute(value, 81)
@@ -0,0 +1,205 @@
+// note 98685: keep this in sync with the handler
+const value4757 = compute(value, 4);
+const v = process.env["BENCH_KEY_01333"];
+const value99922 = compute(value, 12);
+const value14442 = compute(value, 86);
+const value20279 = compute(value, 6);
+const value13279 = compute(value, 87);
+const value59428 = compute(value, 64);
+const value86446 = compute(value, 19);
+const value42869 = compute(value, 92);
+const value71444 = compute(value, 52);
+const value68273 = compute(value, 82);
+const value66287 = compute(value, 36);
+// note 21692: keep this in sync with the handler
+const value40223 = compute(value, 65);
+const value74299 = compute(value, 94);
+const value84971 = compute(value, 96);
+const value66441 = compute(value, 93);
+const value79716 = compute(value, 79);
+const value63398 = compute(value, 57);
+const value6114 = compute(value, 3);
+const v = process.env.BENCH_KEY_00391;
+const value51895 = compute(value, 0);
+const value18281 = compute(value, 45);
+// note 95082: keep this in sync with the handler
+const value19572 = compute(value, 75);
+const value929 = compute(value, 56);
+const value89379 = compute(value, 42);
+const value36403 = compute(value, 28);
+const value1266 = compute(value, 5);
+const value46665 = compute(value, 8);
+const value45819 = compute(value, 35);
+const value66136 = compute(value, 79);
+const value32517 = compute(value, 22);
+const value65285 = compute(value, 4);
+const value3015 = compute(value, 8);
+const value37334 = compute(value, 86);
+const value82313 = compute(value, 57);
+const value61372 = compute(value, 68);
+const value58723 = compute(value, 38);
+const v = process.env["BENCH_KEY_00005"];
+// note 25072: keep this in sync with the handler
+// note 72347: keep this in sync with the handler
+// note 18580: keep this in sync with the handler
+const value79829 = compute(value, 95);
+const value58389 = compute(value, 92);
+const value38558 = compute(value, 49);
+const value56913 = compute(value, 71);
+const value3047 = compute(value, 40);
+const value17731 = compute(value, 77);
+const value3264 = compute(value, 63);
+const value5482 = compute(value, 50);
+const v = process.env.BENCH_KEY_00238;
+// note 44624: keep this in sync with the handler
+const value79105 = compute(value, 50);
+const value68615 = compute(value, 36);
+const value4135 = compute(value, 61);
+const value29785 = compute(value, 6);
+const value40504 = compute(value, 55);
+const value77333 = compute(value, 24);
+const value65886 = compute(value, 23);
+const value4677 = compute(value, 21);
+const value83753 = compute(value, 42);
+// note 1072: keep this in sync with the handler
+const value41486 = compute(value, 67);
+// note 70722: keep this in sync with the handler
+const value60018 = compute(value, 72);
+const value66026 = compute(value, 66);
+const value70404 = compute(value, 79);
+const v = import.meta.env.BENCH_KEY_01083;
+const value72016 = compute(value, 42);
+const value20598 = compute(value, 34);
+const value28267 = compute(value, 40);
+const value75413 = compute(value, 44);
+const value12517 = compute(value, 4);
+const value34296 = compute(value, 55);
+const value41551 = compute(value, 35);
+const value60703 = compute(value, 78);
+const value16357 = compute(value, 61);
+const v = process.env["BENCH_KEY_01196"];
+const value34236 = compute(value, 92);
+const value78290 = compute(value, 11);
+const value59335 = compute(value, 68);
+const value33053 = compute(value, 73);
+const value91104 = compute(value, 21);
+const value29015 = compute(value, 12);
+const value33675 = compute(value, 16);
+const value82248 = compute(value, 89);
+const value77665 = compute(value, 65);
+// note 39550: keep this in sync with the handler
+const value3025 = compute(value, 18);
+const value97151 = compute(value, 54);
+const value46865 = compute(value, 14);
+const value8667 = compute(value, 34);
+const value51460 = compute(value, 50);
+const v = process.env["BENCH_KEY_01978"];
+const value92803 = compute(value, 71);
+const value42313 = compute(value, 21);
+const value13805 = compute(value, 31);
+const value68524 = compute(value, 42);
+const value23989 = compute(value, 30);
+const value52769 = compute(value, 1);
+const value1054 = compute(value, 84);
+// note 22437: keep this in sync with the handler
+const value70306 = compute(value, 78);
+const value87985 = compute(value, 6);
+const value76700 = compute(value, 70);
+const value79656 = compute(value, 19);
+const value32853 = compute(value, 67);
+const value64005 = compute(value, 82);
+const value36980 = compute(value, 23);
+const value84869 = compute(value, 91);
+const v = import.meta.env.BENCH_KEY_01160;
+const value71115 = compute(value, 14);
+const value2670 = compute(value, 51);
+const value37924 = compute(value, 94);
+const value66687 = compute(value, 48);
+const value45486 = compute(value, 90);
+const value61763 = compute(value, 71);
+const value69966 = compute(value, 29);
+const value16649 = compute(value, 62);
+const value97627 = compute(value, 45);
+const value71949 = compute(value, 72);
+const value52294 = compute(value, 11);
+const value67457 = compute(value, 42);
+const value88110 = compute(value, 34);
+const value23766 = compute(value, 1);
+const value50133 = compute(value, 81);
+const v = import.meta.env.BENCH_KEY_00480;
+// note 57491: keep this in sync with the handler
+const value4327 = compute(value, 59);
+const value48798 = compute(value, 7);
+const value71227 = compute(value, 29);
+const value58237 = compute(value, 37);
+const value80856 = compute(value, 55);
+const value72235 = compute(value, 67);
+const value83817 = compute(value, 9);
+const value47579 = compute(value, 49);
+// note 85841: keep this in sync with the handler
+const value62881 = compute(value, 25);
+const value97112 = compute(value, 15);
+const value30523 = compute(value, 65);
+const value55896 = compute(value, 24);
+const value30003 = compute(value, 30);
+const value66436 = compute(value, 88);
+const value1599 = compute(value, 47);
+const value62792 = compute(value, 33);
+const value70768 = compute(value, 55);
+const v = import.meta.env.BENCH_KEY_01679;
+const value50606 = compute(value, 69);
+const value59381 = compute(value, 17);
+const value59134 = compute(value, 61);
+const value55484 = compute(value, 0);
+const value52372 = compute(value, 89);
+const value88262 = compute(value, 89);
+const value45747 = compute(value, 60);
+const value47554 = compute(value, 24);
+const value23706 = compute(value, 38);
+const value11990 = compute(value, 59);
+const value59496 = compute(value, 35);
+// note 53441: keep this in sync with the handler
+const value72177 = compute(value, 9);
+const v = process.env.BENCH_KEY_01405;
+const value76639 = compute(value, 9);
+const value92901 = compute(value, 72);
+const value66566 = compute(value, 24);
+const value28070 = compute(value, 37);
+const value25131 = compute(value, 8);
+const value38334 = compute(value, 19);
+const value88236 = compute(value, 63);
+const value95590 = compute(value, 45);
+const value79406 = compute(value, 60);
+// note 23582: keep this in sync with the handler
+const value52306 = compute(value, 23);
+// note 92014: keep this in sync with the handler
+const value50881 = compute(value, 53);
+const value86349 = compute(value, 19);
+const value56581 = compute(value, 30);
+const value31415 = compute(value, 84);
+const value60214 = compute(value, 74);
+const value35240 = compute(value, 29);
+// note 16910: keep this in sync with the handler
+const v = import.meta.env.BENCH_KEY_01739;
+const value10630 = compute(value, 57);
+// note 53597: keep this in sync with the handler
+// note 37241: keep this in sync with the handler
+const value823 = compute(value, 47);
+const value31081 = compute(value, 41);
+const value65042 = compute(value, 52);
+const value5964 = compute(value, 47);
+const value79613 = compute(value, 73);
+const value36182 = compute(value, 1);
+const value98336 = compute(value, 75);
+const value4068 = compute(value, 91);
+const value7291 = compute(value, 16);
+const value79540 = compute(value, 0);
+const value65734 = compute(value, 65);
+const value97449 = compute(value, 61);
+const value63780 = compute(value, 51);
+const v = import.meta.env.BENCH_KEY_01456;
+const value73299 = compute(value, 64);
+const value59494 = compute(value, 33);
+const value39467 = compute(value, 85);
+const value56993 = compute(value, 54);
+const value64087 = compute(value, 67);
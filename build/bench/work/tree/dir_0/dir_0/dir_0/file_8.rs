@@ -0,0 +1,212 @@
+let value93437 = compute(value, 26);
+// note 6570: keep this in sync with the handler
+let value48514 = compute(value, 14);
+let value33147 = compute(value, 70);
+let value44107 = compute(value, 69);
+let value56378 = compute(value, 21);
+let value16624 = compute(value, 37);
+let value90521 = compute(value, 20);
+let value81821 = compute(value, 50);
+let value74500 = compute(value, 4);
+const v = env::var_os("BENCH_KEY_00673");
+let value7546 = compute(value, 77);
+let value95558 = compute(value, 13);
+let value52161 = compute(value, 72);
+// note 56024: keep this in sync with the handler
+// note 45092: keep this in sync with the handler
+// note 55015: keep this in sync with the handler
+let value24900 = compute(value, 68);
+let value5617 = compute(value, 88);
+let value53179 = compute(value, 23);
+let value80752 = compute(value, 48);
+const v = env::var("BENCH_KEY_00734");
+let value21683 = compute(value, 52);
+let value18846 = compute(value, 28);
+let value73434 = compute(value, 5);
+let value81530 = compute(value, 50);
+let value24224 = compute(value, 71);
+let value3637 = compute(value, 48);
+let value14571 = compute(value, 21);
+// note 98609: keep this in sync with the handler
+let value91134 = compute(value, 51);
+let value88299 = compute(value, 29);
+let value72008 = compute(value, 34);
+let value5940 = compute(value, 23);
+let value66783 = compute(value, 47);
+let value33922 = compute(value, 69);
+const v = env::var("BENCH_KEY_00651");
+// note 96189: keep this in sync with the handler
+let value77299 = compute(value, 87);
+let value69602 = compute(value, 53);
+let value13234 = compute(value, 42);
+// note 93872: keep this in sync with the handler
+let value83029 = compute(value, 94);
+let value14851 = compute(value, 10);
+// note 39578: keep this in sync with the handler
+const v = env::var("BENCH_KEY_01759");
+let value70018 = compute(value, 81);
+let value95422 = compute(value, 71);
+let value28433 = compute(value, 12);
+// note 24476: keep this in sync with the handler
+let value68216 = compute(value, 25);
+let value57203 = compute(value, 70);
+// note 85049: keep this in sync with the handler
+let value95542 = compute(value, 94);
+// note 39335: keep this in sync with the handler
+let value38813 = compute(value, 13);
+let value22471 = compute(value, 64);
+let value83567 = compute(value, 50);
+let value39457 = compute(value, 75);
+const v = env::var_os("BENCH_KEY_01509");
+let value14883 = compute(value, 42);
+let value39022 = compute(value, 28);
+let value40191 = compute(value, 33);
+let value37486 = compute(value, 44);
+let value73538 = compute(value, 12);
+let value376 = compute(value, 85);
+let value67303 = compute(value, 82);
+let value87917 = compute(value, 35);
+const v = env::var_os("BENCH_KEY_01930");
+// note 43732: keep this in sync with the handler
+let value19666 = compute(value, 72);
+let value24494 = compute(value, 50);
+let value22395 = compute(value, 85);
+let value64493 = compute(value, 85);
+let value45263 = compute(value, 61);
+let value20913 = compute(value, 58);
+let value24123 = compute(value, 67);
+let value96798 = compute(value, 89);
+let value52984 = compute(value, 22);
+let value49795 = compute(value, 34);
+let value31962 = compute(value, 49);
+let value77929 = compute(value, 38);
+let value76283 = compute(value, 41);
+let value38478 = compute(value, 66);
+// note 22666: keep this in sync with the handler
+let value1818 = compute(value, 72);
+let value76477 = compute(value, 41);
+let value51200 = compute(value, 81);
+const v = env::var_os("BENCH_KEY_01781");
+let value89613 = compute(value, 82);
+let value52305 = compute(value, 22);
+let value42116 = compute(value, 18);
+let value22653 = compute(value, 52);
+let value47556 = compute(value, 26);
+// note 88870: keep this in sync with the handler
+let value55513 = compute(value, 29);
+let value85047 = compute(value, 75);
+let value35215 = compute(value, 4);
+let value43884 = compute(value, 40);
+let value89589 = compute(value, 58);
+let value10556 = compute(value, 80);
+let value19931 = compute(value, 46);
+let value91922 = compute(value, 63);
+let value15095 = compute(value, 60);
+let value46523 = compute(value, 60);
+const v = env::var_os("BENCH_KEY_00162");
+let value78860 = compute(value, 96);
+let value95924 = compute(value, 88);
+let value23924 = compute(value, 62);
+let value61086 = compute(value, 73);
+let value68882 = compute(value, 12);
+let value1788 = compute(value, 42);
+let value73556 = compute(value, 30);
+let value75566 = compute(value, 3);
+// note 75975: keep this in sync with the handler
+let value64340 = compute(value, 29);
+let value10406 = compute(value, 27);
+let value14251 = compute(value, 89);
+let value15525 = compute(value, 5);
+let value10211 = compute(value, 26);
+let value98404 = compute(value, 46);
+let value83969 = compute(value, 64);
+const v = env::var_os("BENCH_KEY_00845");
+let value76557 = compute(value, 24);
+let value38390 = compute(value, 75);
+let value75415 = compute(value, 46);
+let value81393 = compute(value, 10);
+let value51281 = compute(value, 65);
+let value54526 = compute(value, 12);
+let value71546 = compute(value, 57);
+let value6494 = compute(value, 92);
+// note 48103: keep this in sync with the handler
+let value89140 = compute(value, 94);
+let value72409 = compute(value, 47);
+let value77108 = compute(value, 90);
+let value21791 = compute(value, 63);
+let value61821 = compute(value, 32);
+let value56959 = compute(value, 20);
+let value87398 = compute(value, 1);
+let value97279 = compute(value, 85);
+let value84203 = compute(value, 7);
+const v = env::var("BENCH_KEY_01066");
+let value50350 = compute(value, 7);
+let value70570 = compute(value, 51);
+let value53085 = compute(value, 26);
+let value52377 = compute(value, 94);
+let value12485 = compute(value, 69);
+let value21868 = compute(value, 43);
+let value52766 = compute(value, 95);
+const v = env::var("BENCH_KEY_00403");
+let value6732 = compute(value, 39);
+// note 37469: keep this in sync with the handler
+let value26772 = compute(value, 0);
+let value17183 = compute(value, 14);
+// note 93604: keep this in sync with the handler
+let value25975 = compute(value, 76);
+// note 83757: keep this in sync with the handler
+let value52076 = compute(value, 84);
+let value98878 = compute(value, 35);
+let value521 = compute(value, 36);
+let value43191 = compute(value, 26);
+let value23802 = compute(value, 37);
+const v = env::var("BENCH_KEY_00698");
+let value13446 = compute(value, 60);
+let value55218 = compute(value, 25);
+let value67069 = compute(value, 42);
+let value96699 = compute(value, 87);
+let value32129 = compute(value, 22);
+let value69580 = compute(value, 31);
+let value81003 = compute(value, 8);
+let value9036 = compute(value, 15);
+const v = env::var_os("BENCH_KEY_01450");
+// note 28798: keep this in sync with the handler
+let value69232 = compute(value, 71);
+let value35350 = compute(value, 42);
+// note 26294: keep this in sync with the handler
+let value72017 = compute(value, 43);
+let value3874 = compute(value, 91);
+let value60626 = compute(value, 1);
+// note 84068: keep this in sync with the handler
+const v = env::var_os("BENCH_KEY_01568");
+let value8310 = compute(value, 65);
+let value80963 = compute(value, 65);
+let value44973 = compute(value, 62);
+let value4476 = compute(value, 14);
+let value81811 = compute(value, 40);
+let value81120 = compute(value, 28);
+let value95748 = compute(value, 9);
+let value81819 = compute(value, 48);
+let value52640 = compute(value, 66);
+// note 56298: keep this in sync with the handler
+let value9774 = compute(value, 74);
+let value78972 = compute(value, 14);
+// note 93068: keep this in sync with the handler
+let value88672 = compute(value, 14);
+let value11391 = compute(value, 42);
+const v = env::var_os("BENCH_KEY_00730");
+// note 21191: keep this in sync with the handler
+let value36995 = compute(value, 38);
+let value8062 = compute(value, 11);
+let value72807 = compute(value, 57);
+let value76656 = compute(value, 26);
+let value88587 = compute(value, 26);
+let value93787 = compute(value, 85);
+let value63852 = compute(value, 26);
+let value22435 = compute(value, 28);
+let value43485 = compute(value, 29);
+let value69550 = compute(value, 1);
+let value89374 = compute(value, 37);
+let value33140 = compute(value, 63);
+let value6312 = compute(value, 7);
+let value87747 = compute(value, 59);
@@ -0,0 +1,211 @@
+let value49107 = compute(value, 25);
+let value69964 = compute(value, 27);
+let value79650 = compute(value, 13);
+let value57355 = compute(value, 28);
+let value76602 = compute(value, 69);
+const v = env::var("BENCH_KEY_00054");
+let value49445 = compute(value, 72);
+let value6505 = compute(value, 6);
+let value97610 = compute(value, 28);
+// note 63033: keep this in sync with the handler
+// note 73714: keep this in sync with the handler
+let value24240 = compute(value, 87);
+let value42796 = compute(value, 19);
+let value36596 = compute(value, 27);
+let value56820 = compute(value, 75);
+let value15316 = compute(value, 87);
+let value59708 = compute(value, 53);
+// note 97329: keep this in sync with the handler
+let value59945 = compute(value, 96);
+let value6851 = compute(value, 61);
+let value84759 = compute(value, 78);
+let value73061 = compute(value, 20);
+const v = env::var_os("BENCH_KEY_01752");
+let value13202 = compute(value, 10);
+// note 82326: keep this in sync with the handler
+let value13526 = compute(value, 43);
+let value19824 = compute(value, 36);
+let value95180 = compute(value, 23);
+let value95505 = compute(value, 57);
+// note 74815: keep this in sync with the handler
+let value23790 = compute(value, 25);
+let value68503 = compute(value, 21);
+let value42408 = compute(value, 19);
+let value85986 = compute(value, 44);
+let value44913 = compute(value, 2);
+let value54545 = compute(value, 31);
+let value58968 = compute(value, 89);
+let value22738 = compute(value, 40);
+let value16176 = compute(value, 74);
+let value79147 = compute(value, 92);
+const v = env::var("BENCH_KEY_00498");
+let value23795 = compute(value, 30);
+let value23488 = compute(value, 14);
+let value18817 = compute(value, 96);
+let value43264 = compute(value, 2);
+let value57563 = compute(value, 42);
+let value53833 = compute(value, 95);
+let value69510 = compute(value, 58);
+let value12889 = compute(value, 85);
+let value52263 = compute(value, 77);
+let value96913 = compute(value, 10);
+let value20355 = compute(value, 82);
+let value87687 = compute(value, 96);
+let value32172 = compute(value, 65);
+let value60939 = compute(value, 23);
+let value12713 = compute(value, 6);
+let value32611 = compute(value, 19);
+let value39380 = compute(value, 95);
+let value90915 = compute(value, 26);
+let value86293 = compute(value, 60);
+let value16504 = compute(value, 14);
+// note 89475: keep this in sync with the handler
+const v = env::var("BENCH_KEY_00595");
+let value87916 = compute(value, 34);
+let value10137 = compute(value, 49);
+let value37764 = compute(value, 31);
+let value67617 = compute(value, 8);
+let value79793 = compute(value, 59);
+let value27939 = compute(value, 3);
+let value7993 = compute(value, 39);
+let value77274 = compute(value, 62);
+// note 2183: keep this in sync with the handler
+let value65656 = compute(value, 84);
+const v = env::var_os("BENCH_KEY_00104");
+let value15448 = compute(value, 25);
+// note 78880: keep this in sync with the handler
+let value2476 = compute(value, 51);
+let value89499 = compute(value, 65);
+let value37758 = compute(value, 25);
+let value64023 = compute(value, 3);
+let value33940 = compute(value, 87);
+let value48634 = compute(value, 37);
+let value67237 = compute(value, 16);
+let value6738 = compute(value, 45);
+let value77646 = compute(value, 46);
+// note 3056: keep this in sync with the handler
+let value71115 = compute(value, 14);
+// note 63030: keep this in sync with the handler
+let value43035 = compute(value, 64);
+let value65289 = compute(value, 8);
+let value64221 = compute(value, 7);
+let value31857 = compute(value, 41);
+let value10152 = compute(value, 64);
+let value18433 = compute(value, 3);
+const v = env::var("BENCH_KEY_01174");
+let value75206 = compute(value, 31);
+let value38691 = compute(value, 85);
+// note 74066: keep this in sync with the handler
+let value62443 = compute(value, 72);
+let value95728 = compute(value, 86);
+let value4137 = compute(value, 63);
+let value65334 = compute(value, 53);
+let value92543 = compute(value, 5);
+let value64771 = compute(value, 72);
+let value55392 = compute(value, 5);
+let value63043 = compute(value, 90);
+let value51078 = compute(value, 56);
+// note 23586: keep this in sync with the handler
+let value5508 = compute(value, 76);
+const v = env::var_os("BENCH_KEY_01666");
+let value70092 = compute(value, 58);
+let value75959 = compute(value, 8);
+let value72660 = compute(value, 7);
+let value46651 = compute(value, 91);
+let value74817 = compute(value, 30);
+// note 8950: keep this in sync with the handler
+let value61029 = compute(value, 16);
+let value92613 = compute(value, 75);
+// note 21634: keep this in sync with the handler
+let value95041 = compute(value, 78);
+let value4271 = compute(value, 3);
+// note 41379: keep this in sync with the handler
+// note 51113: keep this in sync with the handler
+const v = env::var("BENCH_KEY_00032");
+let value21574 = compute(value, 40);
+let value43938 = compute(value, 94);
+let value11572 = compute(value, 29);
+// note 18609: keep this in sync with the handler
+let value24456 = compute(value, 12);
+let value2889 = compute(value, 76);
+let value31427 = compute(value, 96);
+// note 38064: keep this in sync with the handler
+let value17917 = compute(value, 69);
+let value32325 = compute(value, 24);
+let value78123 = compute(value, 38);
+let value91026 = compute(value, 40);
+let value48225 = compute(value, 16);
+let value74947 = compute(value, 63);
+let value59362 = compute(value, 95);
+let value5943 = compute(value, 26);
+let value52174 = compute(value, 85);
+let value94190 = compute(value, 3);
+const v = env::var_os("BENCH_KEY_01217");
+let value67282 = compute(value, 61);
+let value28877 = compute(value, 68);
+// note 43581: keep this in sync with the handler
+let value94353 = compute(value, 69);
+let value20424 = compute(value, 54);
+// note 82724: keep this in sync with the handler
+let value85048 = compute(value, 76);
+let value18978 = compute(value, 63);
+let value75618 = compute(value, 55);
+let value58980 = compute(value, 4);
+let value34696 = compute(value, 67);
+let value6844 = compute(value, 54);
+let value61513 = compute(value, 15);
+// note 68114: keep this in sync with the handler
+let value13523 = compute(value, 40);
+let value76788 = compute(value, 61);
+// note 766: keep this in sync with the handler
+let value30928 = compute(value, 82);
+let value84629 = compute(value, 45);
+const v = env::var("BENCH_KEY_01807");
+// note 89261: keep this in sync with the handler
+let value45958 = compute(value, 77);
+let value67138 = compute(value, 14);
+let value7184 = compute(value, 6);
+// note 42322: keep this in sync with the handler
+let value66399 = compute(value, 51);
+let value50259 = compute(value, 13);
+let value46609 = compute(value, 49);
+let value29520 = compute(value, 32);
+const v = env::var("BENCH_KEY_01962");
+let value9888 = compute(value, 91);
+let value84835 = compute(value, 57);
+let value62176 = compute(value, 96);
+let value37985 = compute(value, 58);
+let value34358 = compute(value, 20);
+let value49650 = compute(value, 83);
+let value4840 = compute(value, 87);
+let value87587 = compute(value, 93);
+let value65851 = compute(value, 85);
+// note 39456: keep this in sync with the handler
+let value16138 = compute(value, 36);
+const v = env::var_os("BENCH_KEY_01885");
+let value26417 = compute(value, 33);
+// note 80025: keep this in sync with the handler
+let value43148 = compute(value, 80);
+let value20183 = compute(value, 7);
+let value9950 = compute(value, 56);
+// note 53186: keep this in sync with the handler
+let value78470 = compute(value, 94);
+// note 14000: keep this in sync with the handler
+const v = env::var_os("BENCH_KEY_00449");
+// note 63850: keep this in sync with the handler
+let value42888 = compute(value, 14);
+let value57554 = compute(value, 33);
+// note 98265: keep this in sync with the handler
+let value49156 = compute(value, 74);
+let value98516 = compute(value, 61);
+let value99309 = compute(value, 78);
+let value20904 = compute(value, 49);
+const v = env::var_os("BENCH_KEY_00565");
+// note 54080: keep this in sync with the handler
+let value13395 = compute(value, 9);
+let value40430 = compute(value, 78);
+let value61258 = compute(value, 51);
+let value85443 = compute(value, 83);
+let value39536 = compute(value, 57);
+let value65737 = compute(value, 68);
+let value50926 = compute(value, 1);
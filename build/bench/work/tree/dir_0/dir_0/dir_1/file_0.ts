@@ -0,0 +1,203 @@
+const value1319 = compute(value, 58);
+const value30537 = compute(value, 79);
+const v = process.env["BENCH_KEY_00258"];
+const value16704 = compute(value, 20);
+const value35654 = compute(value, 55);
+const value63458 = compute(value, 20);
+const value42179 = compute(value, 81);
+const value67573 = compute(value, 61);
+const value48046 = compute(value, 31);
+const value31645 = compute(value, 23);
+const value43743 = compute(value, 93);
+// note 5984: keep this in sync with the handler
+// note 98827: keep this in sync with the handler
+const value89075 = compute(value, 29);
+const value7448 = compute(value, 76);
+const value70380 = compute(value, 55);
+const value35797 = compute(value, 4);
+const value63025 = compute(value, 72);
+const v = process.env.BENCH_KEY_01579;
+const value7483 = compute(value, 14);
+const value3530 = compute(value, 38);
+const value12751 = compute(value, 44);
+const value26291 = compute(value, 4);
+// note 63854: keep this in sync with the handler
+const value73383 = compute(value, 51);
+const value49754 = compute(value, 90);
+const value97008 = compute(value, 8);
+const value87943 = compute(value, 61);
+const value28606 = compute(value, 88);
+const value6436 = compute(value, 34);
+const value33556 = compute(value, 91);
+const value59647 = compute(value, 89);
+const value69949 = compute(value, 12);
+const value29965 = compute(value, 89);
+const value92764 = compute(value, 32);
+const value87064 = compute(value, 55);
+const v = process.env["BENCH_KEY_00527"];
+const value76179 = compute(value, 34);
+const value61929 = compute(value, 43);
+const value31222 = compute(value, 85);
+const value9744 = compute(value, 44);
+const value58864 = compute(value, 82);
+const value53492 = compute(value, 45);
+const value54259 = compute(value, 36);
+const value25044 = compute(value, 18);
+const value51974 = compute(value, 79);
+const value48059 = compute(value, 44);
+const value48357 = compute(value, 51);
+const value1365 = compute(value, 7);
+// note 45105: keep this in sync with the handler
+const v = process.env["BENCH_KEY_01895"];
+const value80014 = compute(value, 86);
+const value88686 = compute(value, 28);
+// note 25712: keep this in sync with the handler
+const value75554 = compute(value, 88);
+const value39237 = compute(value, 49);
+const value72085 = compute(value, 14);
+const value51739 = compute(value, 38);
+// note 94619: keep this in sync with the handler
+const value27522 = compute(value, 71);
+const value65270 = compute(value, 86);
+const value66068 = compute(value, 11);
+const value59935 = compute(value, 86);
+// note 32806: keep this in sync with the handler
+const v = process.env.BENCH_KEY_01675;
+const value82011 = compute(value, 46);
+const value66701 = compute(value, 62);
+// note 37998: keep this in sync with the handler
+const value6074 = compute(value, 60);
+const value8157 = compute(value, 9);
+const value66561 = compute(value, 19);
+const value91971 = compute(value, 15);
+const value21622 = compute(value, 88);
+const v = process.env["BENCH_KEY_00954"];
+const value92501 = compute(value, 60);
+const value93197 = compute(value, 77);
+const value36856 = compute(value, 93);
+const value64027 = compute(value, 7);
+const value29369 = compute(value, 75);
+const value28945 = compute(value, 39);
+const value77346 = compute(value, 37);
+const value84654 = compute(value, 70);
+const value72999 = compute(value, 55);
+const value82836 = compute(value, 95);
+const value16606 = compute(value, 19);
+const value6842 = compute(value, 52);
+const value16454 = compute(value, 61);
+const v = process.env.BENCH_KEY_00894;
+// note 50497: keep this in sync with the handler
+const value50264 = compute(value, 18);
+const value17735 = compute(value, 81);
+const value88197 = compute(value, 24);
+const value47705 = compute(value, 78);
+const value54899 = compute(value, 94);
+const value54487 = compute(value, 70);
+const value74632 = compute(value, 39);
+const value7525 = compute(value, 56);
+const v = import.meta.env.BENCH_KEY_01728;
+const value16016 = compute(value, 11);
+const value86637 = compute(value, 16);
+// note 25625: keep this in sync with the handler
+const value86398 = compute(value, 68);
+// note 12274: keep this in sync with the handler
+const value14008 = compute(value, 40);
+const value82816 = compute(value, 75);
+const value98255 = compute(value, 91);
+const value44845 = compute(value, 31);
+const value81060 = compute(value, 65);
+const value94754 = compute(value, 82);
+const value68664 = compute(value, 85);
+const value16110 = compute(value, 8);
+const value13331 = compute(value, 42);
+// note 83041: keep this in sync with the handler
+// note 31421: keep this in sync with the handler
+const v = import.meta.env.BENCH_KEY_00597;
+const value75873 = compute(value, 19);
+const value28967 = compute(value, 61);
+const value8556 = compute(value, 20);
+const value89736 = compute(value, 11);
+const value41601 = compute(value, 85);
+const value66486 = compute(value, 41);
+const value69970 = compute(value, 33);
+const value76419 = compute(value, 80);
+const value12429 = compute(value, 13);
+const v = process.env["BENCH_KEY_01390"];
+const value37703 = compute(value, 67);
+const value2336 = compute(value, 8);
+const value54270 = compute(value, 47);
+const value17748 = compute(value, 94);
+// note 60506: keep this in sync with the handler
+const value92379 = compute(value, 35);
+const value34320 = compute(value, 79);
+// note 42105: keep this in sync with the handler
+const value82707 = compute(value, 63);
+const value905 = compute(value, 32);
+const value39566 = compute(value, 87);
+const value11893 = compute(value, 59);
+const value16815 = compute(value, 34);
+const value3122 = compute(value, 18);
+// note 91128: keep this in sync with the handler
+const v = import.meta.env.BENCH_KEY_01272;
+const value43409 = compute(value, 50);
+const value22854 = compute(value, 59);
+const value39533 = compute(value, 54);
+// note 14088: keep this in sync with the handler
+const value66590 = compute(value, 48);
+const value69430 = compute(value, 75);
+const value65400 = compute(value, 22);
+const value12632 = compute(value, 22);
+const v = import.meta.env.BENCH_KEY_01399;
+const value42005 = compute(value, 4);
+const value49669 = compute(value, 5);
+const value12810 = compute(value, 6);
+const value46033 = compute(value, 55);
+const value90405 = compute(value, 1);
+const value89716 = compute(value, 88);
+// note 64911: keep this in sync with the handler
+// note 93267: keep this in sync with the handler
+const v = import.meta.env.BENCH_KEY_00028;
+const value47064 = compute(value, 19);
+const value48778 = compute(value, 84);
+const value17117 = compute(value, 45);
+// note 47561: keep this in sync with the handler
+const value4369 = compute(value, 4);
+const value13861 = compute(value, 87);
+const value66596 = compute(value, 54);
+const value50045 = compute(value, 90);
+const value50307 = compute(value, 61);
+// note 30366: keep this in sync with the handler
+const v = import.meta.env.BENCH_KEY_01918;
+const value9609 = compute(value, 6);
+const value13051 = compute(value, 53);
+const value1667 = compute(value, 18);
+const value86558 = compute(value, 34);
+const value73851 = compute(value, 34);
+const value89986 = compute(value, 67);
+const value97697 = compute(value, 18);
+const value28509 = compute(value, 88);
+const value91360 = compute(value, 83);
+const value47149 = compute(value, 7);
+const value51152 = compute(value, 33);
+const v = process.env.BENCH_KEY_00238;
+const value72628 = compute(value, 72);
+const value1485 = compute(value, 30);
+const value46473 = compute(value, 10);
+const value88787 = compute(value, 32);
+// note 20589: keep this in sync with the handler
+const value51805 = compute(value, 7);
+const value78618 = compute(value, 48);
+// note 44037: keep this in sync with the handler
+const value15568 = compute(value, 48);
+const value33128 = compute(value, 51);
+const value61523 = compute(value, 25);
+const v = process.env.BENCH_KEY_01595;
+const value3732 = compute(value, 46);
+const value41104 = compute(value, 73);
+// note 98370: keep this in sync with the handler
+const value1948 = compute(value, 8);
+const value9829 = compute(value, 32);
+const value98336 = compute(value, 75);
+const value71342 = compute(value, 47);
+// note 6853: keep this in sync with the handler
+const v = import.meta.env.BENCH_KEY_01065;
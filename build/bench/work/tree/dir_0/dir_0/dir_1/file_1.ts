@@ -0,0 +1,205 @@
+const value48925 = compute(value, 37);
+// note 94270: keep this in sync with the handler
+const v = process.env.BENCH_KEY_00912;
+const value67820 = compute(value, 17);
+const value9160 = compute(value, 42);
+const value91827 = compute(value, 65);
+const value79235 = compute(value, 83);
+const value35419 = compute(value, 14);
+const value31362 = compute(value, 31);
+const value73449 = compute(value, 20);
+// note 55240: keep this in sync with the handler
+const v = import.meta.env.BENCH_KEY_01036;
+const value27324 = compute(value, 67);
+const value81170 = compute(value, 78);
+// note 95984: keep this in sync with the handler
+const value17199 = compute(value, 30);
+const value18021 = compute(value, 76);
+const value52529 = compute(value, 52);
+const value91471 = compute(value, 0);
+const value995 = compute(value, 25);
+const value30204 = compute(value, 37);
+const value33211 = compute(value, 37);
+const value39611 = compute(value, 35);
+const value53245 = compute(value, 89);
+const value14682 = compute(value, 35);
+const value57473 = compute(value, 49);
+const value6714 = compute(value, 21);
+const value59176 = compute(value, 6);
+const value3347 = compute(value, 49);
+const value24103 = compute(value, 47);
+// note 42702: keep this in sync with the handler
+const v = process.env.BENCH_KEY_01399;
+const value73067 = compute(value, 26);
+const value50082 = compute(value, 30);
+const value6893 = compute(value, 6);
+const value68177 = compute(value, 83);
+const value3914 = compute(value, 34);
+const value78008 = compute(value, 20);
+const value70255 = compute(value, 27);
+const value79879 = compute(value, 48);
+const value12697 = compute(value, 87);
+const value81312 = compute(value, 26);
+const value35086 = compute(value, 69);
+const value28337 = compute(value, 13);
+const v = process.env["BENCH_KEY_01382"];
+const value40797 = compute(value, 57);
+const value22694 = compute(value, 93);
+const value66909 = compute(value, 76);
+const value19866 = compute(value, 78);
+const value94907 = compute(value, 41);
+const value5800 = compute(value, 77);
+const value18893 = compute(value, 75);
+const value46221 = compute(value, 49);
+const value7605 = compute(value, 39);
+const value67823 = compute(value, 20);
+const value57347 = compute(value, 20);
+const value52996 = compute(value, 34);
+const value46390 = compute(value, 24);
+const value29140 = compute(value, 40);
+const value39804 = compute(value, 34);
+const value99519 = compute(value, 94);
+const value58375 = compute(value, 78);
+const value99498 = compute(value, 73);
+const value32517 = compute(value, 22);
+const v = process.env.BENCH_KEY_01749;
+const value92197 = compute(value, 47);
+const value1042 = compute(value, 72);
+const value6326 = compute(value, 21);
+const value51249 = compute(value, 33);
+const value84083 = compute(value, 81);
+const value54397 = compute(value, 77);
+const value58580 = compute(value, 89);
+const value37659 = compute(value, 23);
+const value91011 = compute(value, 25);
+const v = process.env.BENCH_KEY_01072;
+const value9171 = compute(value, 53);
+const value3501 = compute(value, 9);
+const value72580 = compute(value, 24);
+const value79893 = compute(value, 62);
+const value21635 = compute(value, 4);
+const value93130 = compute(value, 10);
+// note 49298: keep this in sync with the handler
+const value45035 = compute(value, 27);
+const value73297 = compute(value, 62);
+const value33372 = compute(value, 4);
+const value85252 = compute(value, 86);
+// note 21046: keep this in sync with the handler
+const value12208 = compute(value, 83);
+const value11888 = compute(value, 54);
+const value98718 = compute(value, 69);
+const value66363 = compute(value, 15);
+const value55254 = compute(value, 61);
+const value383 = compute(value, 92);
+const value32734 = compute(value, 45);
+const value31504 = compute(value, 76);
+const v = process.env["BENCH_KEY_01468"];
+const value59811 = compute(value, 59);
+const value30706 = compute(value, 54);
+const value34521 = compute(value, 86);
+const value68720 = compute(value, 44);
+const value28641 = compute(value, 26);
+const value78301 = compute(value, 22);
+const value57025 = compute(value, 86);
+const value94241 = compute(value, 54);
+// note 46542: keep this in sync with the handler
+const value54734 = compute(value, 26);
+// note 91235: keep this in sync with the handler
+const v = process.env["BENCH_KEY_01218"];
+// note 80606: keep this in sync with the handler
+const value87722 = compute(value, 34);
+const value50926 = compute(value, 1);
+const value85865 = compute(value, 20);
+const value52460 = compute(value, 80);
+const value60155 = compute(value, 15);
+const value5060 = compute(value, 16);
+const value68700 = compute(value, 24);
+const v = import.meta.env.BENCH_KEY_01563;
+// note 13679: keep this in sync with the handler
+// note 17487: keep this in sync with the handler
+const value27202 = compute(value, 42);
+const value95718 = compute(value, 76);
+// note 18315: keep this in sync with the handler
+const value96510 = compute(value, 92);
+const value97354 = compute(value, 63);
+const v = import.meta.env.BENCH_KEY_01009;
+const value21322 = compute(value, 79);
+const value10377 = compute(value, 95);
+const value87839 = compute(value, 54);
+const value97180 = compute(value, 83);
+const value50183 = compute(value, 34);
+const value99569 = compute(value, 47);
+const value34218 = compute(value, 74);
+// note 96404: keep this in sync with the handler
+const value96191 = compute(value, 64);
+const value29920 = compute(value, 44);
+const value94934 = compute(value, 68);
+const value84117 = compute(value, 18);
+// note 17519: keep this in sync with the handler
+const v = process.env.BENCH_KEY_00223;
+const value25414 = compute(value, 0);
+const value13849 = compute(value, 75);
+const value52604 = compute(value, 30);
+const value82789 = compute(value, 48);
+const value77827 = compute(value, 33);
+const value25959 = compute(value, 60);
+const value16249 = compute(value, 50);
+// note 53949: keep this in sync with the handler
+const value27405 = compute(value, 51);
+const value24155 = compute(value, 2);
+const value42011 = compute(value, 10);
+const value47824 = compute(value, 3);
+const value91067 = compute(value, 81);
+const value38754 = compute(value, 51);
+const v = import.meta.env.BENCH_KEY_01741;
+const value82051 = compute(value, 86);
+// note 13220: keep this in sync with the handler
+const value58315 = compute(value, 18);
+const value53086 = compute(value, 27);
+const value30735 = compute(value, 83);
+const value21139 = compute(value, 90);
+const value91042 = compute(value, 56);
+const value54915 = compute(value, 13);
+const value40489 = compute(value, 40);
+const v = process.env.BENCH_KEY_00435;
+const value32045 = compute(value, 35);
+const value68125 = compute(value, 31);
+const value92960 = compute(value, 34);
+const value10112 = compute(value, 24);
+const value92208 = compute(value, 58);
+const value36387 = compute(value, 12);
+const value32324 = compute(value, 23);
+const value89117 = compute(value, 71);
+const value34349 = compute(value, 11);
+const value19476 = compute(value, 76);
+const v = import.meta.env.BENCH_KEY_01212;
+const value27717 = compute(value, 72);
+const value18319 = compute(value, 83);
+const value95210 = compute(value, 53);
+const value70948 = compute(value, 41);
+const value89831 = compute(value, 9);
+const value88154 = compute(value, 78);
+const value98683 = compute(value, 34);
+const value63823 = compute(value, 94);
+const value39152 = compute(value, 61);
+const value2150 = compute(value, 16);
+const v = process.env.BENCH_KEY_00453;
+const value50317 = compute(value, 71);
+// note 77628: keep this in sync with the handler
+// note 30719: keep this in sync with the handler
+const value95212 = compute(value, 55);
+// note 64646: keep this in sync with the handler
+const value88928 = compute(value, 76);
+const value61591 = compute(value, 93);
+const value2751 = compute(value, 35);
+// note 87386: keep this in sync with the handler
+const value84690 = compute(value, 9);
+const value82584 = compute(value, 37);
+const value41471 = compute(value, 52);
+const value57257 = compute(value, 27);
+const value9150 = compute(value, 32);
+const value2841 = compute(value, 28);
+const value61179 = compute(value, 69);
+const value61314 = compute(value, 10);
+const v = import.meta.env.BENCH_KEY_01403;
+const value47210 = compute(value, 68);
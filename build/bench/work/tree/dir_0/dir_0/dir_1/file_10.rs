@@ -0,0 +1,213 @@
+let value50086 = compute(value, 34);
+let value19842 = compute(value, 54);
+let value23910 = compute(value, 48);
+// note 50191: keep this in sync with the handler
+let value34576 = compute(value, 44);
+let value82868 = compute(value, 30);
+let value56365 = compute(value, 8);
+const v = env::var("BENCH_KEY_00900");
+let value21345 = compute(value, 5);
+let value47087 = compute(value, 42);
+// note 12058: keep this in sync with the handler
+let value9373 = compute(value, 61);
+let value64169 = compute(value, 52);
+let value62730 = compute(value, 68);
+let value92711 = compute(value, 76);
+let value98756 = compute(value, 10);
+let value36411 = compute(value, 36);
+let value89378 = compute(value, 41);
+let value60125 = compute(value, 82);
+let value6379 = compute(value, 74);
+let value46493 = compute(value, 30);
+let value21915 = compute(value, 90);
+let value44787 = compute(value, 70);
+let value55622 = compute(value, 41);
+let value47774 = compute(value, 50);
+let value89113 = compute(value, 67);
+const v = env::var("BENCH_KEY_00823");
+let value78099 = compute(value, 14);
+let value23116 = compute(value, 30);
+let value91768 = compute(value, 6);
+// note 36154: keep this in sync with the handler
+let value16252 = compute(value, 53);
+let value57122 = compute(value, 86);
+let value81708 = compute(value, 34);
+let value32771 = compute(value, 82);
+let value96114 = compute(value, 84);
+let value40838 = compute(value, 1);
+// note 59389: keep this in sync with the handler
+let value58846 = compute(value, 64);
+// note 53027: keep this in sync with the handler
+let value69266 = compute(value, 8);
+const v = env::var_os("BENCH_KEY_01144");
+// note 71595: keep this in sync with the handler
+let value33034 = compute(value, 54);
+let value23486 = compute(value, 12);
+// note 23712: keep this in sync with the handler
+let value39514 = compute(value, 35);
+let value64405 = compute(value, 94);
+let value63009 = compute(value, 56);
+let value25419 = compute(value, 5);
+let value58329 = compute(value, 32);
+let value76242 = compute(value, 0);
+let value36846 = compute(value, 83);
+let value85232 = compute(value, 66);
+let value95509 = compute(value, 61);
+let value30177 = compute(value, 10);
+let value60879 = compute(value, 60);
+let value82049 = compute(value, 84);
+let value64354 = compute(value, 43);
+const v = env::var("BENCH_KEY_01135");
+let value97240 = compute(value, 46);
+let value8642 = compute(value, 9);
+let value6413 = compute(value, 11);
+let value18442 = compute(value, 12);
+let value40840 = compute(value, 3);
+let value31187 = compute(value, 50);
+let value46317 = compute(value, 48);
+let value62627 = compute(value, 62);
+let value44973 = compute(value, 62);
+let value70567 = compute(value, 48);
+let value69094 = compute(value, 30);
+let value59824 = compute(value, 72);
+let value7494 = compute(value, 25);
+let value6386 = compute(value, 81);
+let value66512 = compute(value, 67);
+let value75338 = compute(value, 66);
+let value91902 = compute(value, 43);
+let value38472 = compute(value, 60);
+let value42939 = compute(value, 65);
+const v = env::var_os("BENCH_KEY_00651");
+let value96250 = compute(value, 26);
+let value84428 = compute(value, 38);
+let value85622 = compute(value, 68);
+let value32614 = compute(value, 22);
+// note 61425: keep this in sync with the handler
+let value29005 = compute(value, 2);
+let value20253 = compute(value, 77);
+let value43267 = compute(value, 5);
+// note 78931: keep this in sync with the handler
+let value32077 = compute(value, 67);
+let value48076 = compute(value, 61);
+let value2708 = compute(value, 89);
+let value48089 = compute(value, 74);
+// note 57363: keep this in sync with the handler
+// note 92084: keep this in sync with the handler
+// note 30191: keep this in sync with the handler
+let value93074 = compute(value, 51);
+let value589 = compute(value, 7);
+let value55525 = compute(value, 41);
+const v = env::var("BENCH_KEY_00824");
+let value52507 = compute(value, 30);
+let value36225 = compute(value, 44);
+let value58566 = compute(value, 75);
+let value16119 = compute(value, 17);
+let value89927 = compute(value, 8);
+let value36662 = compute(value, 93);
+let value54734 = compute(value, 26);
+let value520 = compute(value, 35);
+let value66285 = compute(value, 34);
+let value8669 = compute(value, 36);
+let value32006 = compute(value, 93);
+let value23112 = compute(value, 26);
+let value53111 = compute(value, 52);
+let value66818 = compute(value, 82);
+let value51035 = compute(value, 13);
+let value72901 = compute(value, 54);
+let value48058 = compute(value, 43);
+const v = env::var("BENCH_KEY_00260");
+let value59337 = compute(value, 70);
+let value48192 = compute(value, 80);
+let value95306 = compute(value, 52);
+let value97477 = compute(value, 89);
+let value52494 = compute(value, 17);
+let value3962 = compute(value, 82);
+// note 78489: keep this in sync with the handler
+let value94206 = compute(value, 19);
+let value74001 = compute(value, 87);
+let value28674 = compute(value, 59);
+let value58600 = compute(value, 12);
+let value28308 = compute(value, 81);
+let value11052 = compute(value, 91);
+let value587 = compute(value, 5);
+let value55423 = compute(value, 36);
+// note 5375: keep this in sync with the handler
+let value93649 = compute(value, 44);
+let value36256 = compute(value, 75);
+let value72320 = compute(value, 55);
+let value65259 = compute(value, 75);
+const v = env::var_os("BENCH_KEY_00577");
+let value37330 = compute(value, 82);
+let value81401 = compute(value, 18);
+let value20895 = compute(value, 40);
+let value75511 = compute(value, 45);
+let value14087 = compute(value, 22);
+// note 37964: keep this in sync with the handler
+// note 85765: keep this in sync with the handler
+let value5955 = compute(value, 38);
+let value499 = compute(value, 14);
+let value35660 = compute(value, 61);
+let value44786 = compute(value, 69);
+let value39974 = compute(value, 10);
+let value60968 = compute(value, 52);
+let value77940 = compute(value, 49);
+let value1941 = compute(value, 1);
+let value67666 = compute(value, 57);
+let value71265 = compute(value, 67);
+const v = env::var("BENCH_KEY_00826");
+let value86094 = compute(value, 55);
+let value79230 = compute(value, 78);
+let value89269 = compute(value, 29);
+let value69594 = compute(value, 45);
+let value22646 = compute(value, 45);
+let value74921 = compute(value, 37);
+let value53372 = compute(value, 22);
+let value85636 = compute(value, 82);
+// note 85891: keep this in sync with the handler
+const v = env::var("BENCH_KEY_01660");
+let value32740 = compute(value, 51);
+let value69134 = compute(value, 70);
+let value65953 = compute(value, 90);
+// note 21326: keep this in sync with the handler
+let value5455 = compute(value, 23);
+let value20294 = compute(value, 21);
+// note 75929: keep this in sync with the handler
+let value33696 = compute(value, 37);
+// note 82342: keep this in sync with the handler
+let value2300 = compute(value, 69);
+let value63597 = compute(value, 62);
+let value83283 = compute(value, 57);
+// note 84229: keep this in sync with the handler
+let value47270 = compute(value, 31);
+// note 4098: keep this in sync with the handler
+let value55654 = compute(value, 73);
+let value14882 = compute(value, 41);
+let value95291 = compute(value, 37);
+let value37255 = compute(value, 7);
+const v = env::var_os("BENCH_KEY_00618");
+let value41141 = compute(value, 13);
+let value86271 = compute(value, 38);
+let value84505 = compute(value, 18);
+let value95381 = compute(value, 30);
+let value53480 = compute(value, 33);
+let value71981 = compute(value, 7);
+// note 76816: keep this in sync with the handler
+let value76743 = compute(value, 16);
+let value20210 = compute(value, 34);
+let value81333 = compute(value, 47);
+let value4878 = compute(value, 28);
+// note 37758: keep this in sync with the handler
+let value41478 = compute(value, 59);
+let value72809 = compute(value, 59);
+// note 51244: keep this in sync with the handler
+let value28369 = compute(value, 45);
+let value12065 = compute(value, 37);
+const v = env::var_os("BENCH_KEY_00447");
+let value168 = compute(value, 71);
+let value38899 = compute(value, 2);
+let value22619 = compute(value, 18);
+let value49742 = compute(value, 78);
+// note 21821: keep this in sync with the handler
+let value28174 = compute(value, 44);
+// note 6095: keep this in sync with the handler
+let value40632 = compute(value, 86);
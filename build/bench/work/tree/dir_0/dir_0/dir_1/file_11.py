@@ -0,0 +1,240 @@
+value56496 = compute(value, 42)
+value88042 = compute(value, 63)
+value92615 = compute(value, 77)
+value68597 = compute(value, 18)
+const v = os.environ.get('BENCH_KEY_00867');
+value35076 = compute(value, 59)
+value59349 = compute(value, 82)
+value36406 = compute(value, 31)
+value46795 = compute(value, 41)
+# note 97554: keep this in sync with the handler
+value98420 = compute(value, 62)
+value34753 = compute(value, 27)
+value49301 = compute(value, 25)
+value28206 = compute(value, 76)
+value40860 = compute(value, 23)
+value63855 = compute(value, 29)
+value66426 = compute(value, 78)
+const v = os.environ.get('BENCH_KEY_00200');
+value62752 = compute(value, 90)
+value70557 = compute(value, 38)
+value48207 = compute(value, 95)
+value53909 = compute(value, 74)
+value3946 = compute(value, 66)
+# note 84902: keep this in sync with the handler
+value44604 = compute(value, 81)
+value11078 = compute(value, 20)
+value62362 = compute(value, 88)
+value4105 = compute(value, 31)
+value26385 = compute(value, 1)
+value10407 = compute(value, 28)
+value64874 = compute(value, 78)
+value1554 = compute(value, 2)
+value49465 = compute(value, 92)
+value26842 = compute(value, 70)
+value53053 = compute(value, 91)
+# note 4727: keep this in sync with the handler
+const v = os.environ["BENCH_KEY_00889"];
+value39788 = compute(value, 18)
+# note 77314: keep this in sync with the handler
+value55329 = compute(value, 39)
+value28117 = compute(value, 84)
+value98804 = compute(value, 58)
+value44108 = compute(value, 70)
+value62052 = compute(value, 69)
+value89696 = compute(value, 68)
+value90067 = compute(value, 51)
+value17823 = compute(value, 72)
+value31412 = compute(value, 81)
+value44284 = compute(value, 52)
+value44170 = compute(value, 35)
+const v = os.getenv("BENCH_KEY_01140");
+value87559 = compute(value, 65)
+value36335 = compute(value, 57)
+# note 67787: keep this in sync with the handler
+value93560 = compute(value, 52)
+value29281 = compute(value, 84)
+value26114 = compute(value, 21)
+value87826 = compute(value, 41)
+value17423 = compute(value, 60)
+value34918 = compute(value, 95)
+value77909 = compute(value, 18)
+value18499 = compute(value, 69)
+value24345 = compute(value, 95)
+value5186 = compute(value, 45)
+value67448 = compute(value, 33)
+const v = os.environ.get('BENCH_KEY_01792');
+value3376 = compute(value, 78)
+value12095 = compute(value, 67)
+value33503 = compute(value, 38)
+# note 74119: keep this in sync with the handler
+value18703 = compute(value, 79)
+value99822 = compute(value, 9)
+value45068 = compute(value, 60)
+value93475 = compute(value, 64)
+value17923 = compute(value, 75)
+value47913 = compute(value, 92)
+value6724 = compute(value, 31)
+value82670 = compute(value, 26)
+value16643 = compute(value, 56)
+value69200 = compute(value, 39)
+const v = os.getenv("BENCH_KEY_00049");
+value60627 = compute(value, 2)
+value9472 = compute(value, 63)
+value6220 = compute(value, 12)
+value19870 = compute(value, 82)
+value75872 = compute(value, 18)
+value45612 = compute(value, 22)
+value7337 = compute(value, 62)
+value67681 = compute(value, 72)
+value23956 = compute(value, 94)
+value4242 = compute(value, 71)
+value3215 = compute(value, 14)
+value25623 = compute(value, 15)
+value60374 = compute(value, 40)
+value91703 = compute(value, 38)
+value76015 = compute(value, 64)
+# note 39130: keep this in sync with the handler
+# note 32647: keep this in sync with the handler
+value3506 = compute(value, 14)
+value5467 = compute(value, 35)
+value31097 = compute(value, 57)
+value65239 = compute(value, 55)
+const v = os.getenv("BENCH_KEY_01573");
+value25536 = compute(value, 25)
+value22773 = compute(value, 75)
+value85926 = compute(value, 81)
+# note 49650: keep this in sync with the handler
+value23838 = compute(value, 73)
+value96549 = compute(value, 34)
+# note 17853: keep this in sync with the handler
+value61591 = compute(value, 93)
+# note 33010: keep this in sync with the handler
+value56070 = compute(value, 4)
+value50192 = compute(value, 43)
+# note 61994: keep this in sync with the handler
+value87919 = compute(value, 37)
+value28595 = compute(value, 77)
+value98515 = compute(value, 60)
+value90400 = compute(value, 93)
+value93133 = compute(value, 13)
+const v = os.getenv("BENCH_KEY_00446");
+value13159 = compute(value, 64)
+value34782 = compute(value, 56)
+# note 62872: keep this in sync with the handler
+value18419 = compute(value, 86)
+# note 82312: keep this in sync with the handler
+# note 60503: keep this in sync with the handler
+value93414 = compute(value, 3)
+value64924 = compute(value, 31)
+value76663 = compute(value, 33)
+value52231 = compute(value, 45)
+value13792 = compute(value, 18)
+value7538 = compute(value, 69)
+value92097 = compute(value, 44)
+value20884 = compute(value, 29)
+value7481 = compute(value, 12)
+value68084 = compute(value, 87)
+value91276 = compute(value, 96)
+# note 51030: keep this in sync with the handler
+value65733 = compute(value, 64)
+value12317 = compute(value, 95)
+const v = os.getenv("BENCH_KEY_01927");
+value26534 = compute(value, 53)
+value16244 = compute(value, 45)
+value63704 = compute(value, 72)
+value53695 = compute(value, 54)
+value46116 = compute(value, 41)
+value50473 = compute(value, 33)
+value44693 = compute(value, 73)
+value25372 = compute(value, 55)
+value61148 = compute(value, 38)
+value13877 = compute(value, 6)
+value43810 = compute(value, 63)
+value99582 = compute(value, 60)
+value48033 = compute(value, 18)
+value61030 = compute(value, 17)
+value12907 = compute(value, 6)
+value23199 = compute(value, 16)
+value87141 = compute(value, 35)
+const v = os.environ["BENCH_KEY_01764"];
+value94768 = compute(value, 96)
+value96092 = compute(value, 62)
+value70492 = compute(value, 70)
+value14191 = compute(value, 29)
+value71140 = compute(value, 39)
+value7282 = compute(value, 7)
+value2749 = compute(value, 33)
+value21369 = compute(value, 29)
+value15181 = compute(value, 49)
+value26619 = compute(value, 41)
+const v = os.getenv("BENCH_KEY_00266");
+# note 29471: keep this in sync with the handler
+value83443 = compute(value, 23)
+value6518 = compute(value, 19)
+# note 45634: keep this in sync with the handler
+value60041 = compute(value, 95)
+value14775 = compute(value, 31)
+value41710 = compute(value, 0)
+value25837 = compute(value, 35)
+value10337 = compute(value, 55)
+# note 22634: keep this in sync with the handler
+value847 = compute(value, 71)
+value92196 = compute(value, 46)
+const v = os.environ["BENCH_KEY_01160"];
+value22106 = compute(value, 87)
+value26897 = compute(value, 28)
+# note 8675: keep this in sync with the handler
+# note 46554: keep this in sync with the handler
+# note 84500: keep this in sync with the handler
+value22471 = compute(value, 64)
+value21255 = compute(value, 12)
+value60331 = compute(value, 94)
+value5693 = compute(value, 67)
+value55678 = compute(value, 0)
+value55299 = compute(value, 9)
+value47709 = compute(value, 82)
+value44751 = compute(value, 34)
+value65929 = compute(value, 66)
+const v = os.environ["BENCH_KEY_00459"];
+value36738 = compute(value, 72)
+value45810 = compute(value, 26)
+value94043 = compute(value, 50)
+value11799 = compute(value, 62)
+value56708 = compute(value, 60)
+value24100 = compute(value, 44)
+value92098 = compute(value, 45)
+value55715 = compute(value, 37)
+# note 72926: keep this in sync with the handler
+value76911 = compute(value, 87)
+value96296 = compute(value, 72)
+value86452 = compute(value, 25)
+value70795 = compute(value, 82)
+value32208 = compute(value, 4)
+value68786 = compute(value, 13)
+value59396 = compute(value, 32)
+value8346 = compute(value, 4)
+value43983 = compute(value, 42)
+value76621 = compute(value, 88)
+value77675 = compute(value, 75)
+# note 65033: keep this in sync with the handler
+value99866 = compute(value, 53)
+const v = os.environ.get('BENCH_KEY_00915');
+value9643 = compute(value, 40)
+value1241 = compute(value, 77)
+value58135 = compute(value, 32)
+value63024 = compute(value, 71)
+value37887 = compute(value, 57)
+value48369 = compute(value, 63)
+value63701 = compute(value, 69)
+value13632 = compute(value, 52)
+value37087 = compute(value, 33)
+value81736 = compute(value, 62)
+value62698 = compute(value, 36)
+# note 56667: keep this in sync with the handler
+value82963 = compute(value, 28)
+value4700 = compute(value, 44)
+value58674 = compute(value, 86)
+value34579 = compute(value, 47)
+# note 24741: keep this in sync with the handler
+value24035 = compute(value, 76)
@@ -0,0 +1,215 @@
+let value40979 = compute(value, 45);
+let value91645 = compute(value, 77);
+let value99143 = compute(value, 9);
+let value25777 = compute(value, 72);
+let value74878 = compute(value, 91);
+let value90987 = compute(value, 1);
+let value76549 = compute(value, 16);
+let value96745 = compute(value, 36);
+let value65650 = compute(value, 78);
+let value21489 = compute(value, 52);
+const v = env::var_os("BENCH_KEY_01338");
+let value62763 = compute(value, 4);
+let value67920 = compute(value, 20);
+let value72164 = compute(value, 93);
+let value31952 = compute(value, 39);
+let value88584 = compute(value, 23);
+// note 55931: keep this in sync with the handler
+let value97495 = compute(value, 10);
+const v = env::var("BENCH_KEY_01868");
+let value67036 = compute(value, 9);
+let value76319 = compute(value, 77);
+let value42769 = compute(value, 89);
+let value72987 = compute(value, 43);
+let value39012 = compute(value, 18);
+let value10772 = compute(value, 5);
+let value59993 = compute(value, 47);
+let value58899 = compute(value, 20);
+let value46995 = compute(value, 47);
+// note 84150: keep this in sync with the handler
+// note 79576: keep this in sync with the handler
+let value69581 = compute(value, 32);
+let value11482 = compute(value, 36);
+let value52856 = compute(value, 88);
+let value31410 = compute(value, 79);
+let value57847 = compute(value, 35);
+// note 61823: keep this in sync with the handler
+let value9879 = compute(value, 82);
+// note 39032: keep this in sync with the handler
+const v = env::var("BENCH_KEY_01376");
+let value66891 = compute(value, 58);
+let value55428 = compute(value, 41);
+let value89420 = compute(value, 83);
+let value10344 = compute(value, 62);
+// note 9898: keep this in sync with the handler
+let value52870 = compute(value, 5);
+let value51444 = compute(value, 34);
+let value94304 = compute(value, 20);
+let value84203 = compute(value, 7);
+let value57387 = compute(value, 60);
+let value9146 = compute(value, 28);
+// note 48081: keep this in sync with the handler
+let value48368 = compute(value, 62);
+const v = env::var_os("BENCH_KEY_00950");
+let value6298 = compute(value, 90);
+let value8769 = compute(value, 39);
+let value31959 = compute(value, 46);
+let value73309 = compute(value, 74);
+let value33830 = compute(value, 74);
+let value14620 = compute(value, 70);
+let value91814 = compute(value, 52);
+let value27269 = compute(value, 12);
+let value6848 = compute(value, 58);
+let value54301 = compute(value, 78);
+let value70996 = compute(value, 89);
+let value98100 = compute(value, 33);
+let value28044 = compute(value, 11);
+let value42052 = compute(value, 51);
+const v = env::var_os("BENCH_KEY_00337");
+let value40843 = compute(value, 6);
+let value96904 = compute(value, 1);
+let value59572 = compute(value, 14);
+// note 98652: keep this in sync with the handler
+let value7963 = compute(value, 9);
+let value59277 = compute(value, 10);
+let value4836 = compute(value, 83);
+let value66430 = compute(value, 82);
+let value57319 = compute(value, 89);
+let value97462 = compute(value, 74);
+let value23259 = compute(value, 76);
+let value5391 = compute(value, 56);
+let value65250 = compute(value, 66);
+const v = env::var_os("BENCH_KEY_01494");
+let value44752 = compute(value, 35);
+let value78092 = compute(value, 7);
+let value12584 = compute(value, 71);
+let value26047 = compute(value, 51);
+let value99203 = compute(value, 69);
+let value48771 = compute(value, 77);
+let value5698 = compute(value, 72);
+let value74607 = compute(value, 14);
+let value64489 = compute(value, 81);
+let value18313 = compute(value, 77);
+let value81434 = compute(value, 51);
+let value22217 = compute(value, 4);
+let value73929 = compute(value, 15);
+let value30037 = compute(value, 64);
+let value120 = compute(value, 23);
+let value64424 = compute(value, 16);
+const v = env::var("BENCH_KEY_00141");
+let value80480 = compute(value, 67);
+let value34928 = compute(value, 8);
+let value27937 = compute(value, 1);
+let value47347 = compute(value, 11);
+let value40168 = compute(value, 10);
+let value74377 = compute(value, 75);
+let value37544 = compute(value, 5);
+let value42402 = compute(value, 13);
+let value86851 = compute(value, 36);
+let value16635 = compute(value, 48);
+let value95650 = compute(value, 8);
+let value76695 = compute(value, 65);
+let value40986 = compute(value, 52);
+const v = env::var("BENCH_KEY_00734");
+let value84232 = compute(value, 36);
+let value11897 = compute(value, 63);
+let value90797 = compute(value, 5);
+let value52944 = compute(value, 79);
+// note 85263: keep this in sync with the handler
+let value78578 = compute(value, 8);
+let value15885 = compute(value, 74);
+let value60118 = compute(value, 75);
+let value4621 = compute(value, 62);
+let value80405 = compute(value, 89);
+let value26153 = compute(value, 60);
+const v = env::var_os("BENCH_KEY_00987");
+let value41737 = compute(value, 27);
+let value40324 = compute(value, 69);
+// note 57552: keep this in sync with the handler
+let value22482 = compute(value, 75);
+let value70911 = compute(value, 4);
+let value446 = compute(value, 58);
+let value975 = compute(value, 5);
+let value47766 = compute(value, 42);
+let value43399 = compute(value, 40);
+// note 79946: keep this in sync with the handler
+// note 86232: keep this in sync with the handler
+let value1789 = compute(value, 43);
+let value3868 = compute(value, 85);
+let value80 = compute(value, 80);
+let value73762 = compute(value, 42);
+let value42977 = compute(value, 6);
+let value28058 = compute(value, 25);
+const v = env::var("BENCH_KEY_00151");
+let value5858 = compute(value, 38);
+let value85537 = compute(value, 80);
+let value67993 = compute(value, 93);
+let value68638 = compute(value, 59);
+// note 96905: keep this in sync with the handler
+let value80360 = compute(value, 44);
+let value90146 = compute(value, 33);
+let value57862 = compute(value, 50);
+// note 44307: keep this in sync with the handler
+let value98393 = compute(value, 35);
+// note 91842: keep this in sync with the handler
+let value38278 = compute(value, 60);
+let value41017 = compute(value, 83);
+let value71467 = compute(value, 75);
+let value36512 = compute(value, 40);
+const v = env::var("BENCH_KEY_01111");
+// note 94978: keep this in sync with the handler
+let value28385 = compute(value, 61);
+let value93323 = compute(value, 9);
+let value51253 = compute(value, 37);
+let value13923 = compute(value, 52);
+// note 18310: keep this in sync with the handler
+let value66258 = compute(value, 7);
+let value39226 = compute(value, 38);
+let value41468 = compute(value, 49);
+let value4330 = compute(value, 62);
+let value14272 = compute(value, 13);
+let value43967 = compute(value, 26);
+let value38515 = compute(value, 6);
+let value53868 = compute(value, 33);
+let value59495 = compute(value, 34);
+// note 63687: keep this in sync with the handler
+let value39277 = compute(value, 89);
+let value14313 = compute(value, 54);
+const v = env::var("BENCH_KEY_01631");
+let value10578 = compute(value, 5);
+let value49246 = compute(value, 67);
+let value93749 = compute(value, 47);
+let value39225 = compute(value, 37);
+let value24286 = compute(value, 36);
+let value83645 = compute(value, 31);
+let value19476 = compute(value, 76);
+let value40011 = compute(value, 47);
+let value33971 = compute(value, 21);
+let value93948 = compute(value, 52);
+let value88212 = compute(value, 39);
+let value22621 = compute(value, 20);
+let value12068 = compute(value, 40);
+let value41115 = compute(value, 84);
+let value51516 = compute(value, 9);
+let value82936 = compute(value, 1);
+let value61805 = compute(value, 16);
+let value75124 = compute(value, 46);
+// note 49062: keep this in sync with the handler
+const v = env::var_os("BENCH_KEY_01600");
+let value39468 = compute(value, 86);
+let value70794 = compute(value, 81);
+let value87081 = compute(value, 72);
+let value60883 = compute(value, 64);
+let value38531 = compute(value, 22);
+let value94310 = compute(value, 26);
+let value73215 = compute(value, 77);
+let value86673 = compute(value, 52);
+let value81522 = compute(value, 42);
+let value80785 = compute(value, 81);
+let value2166 = compute(value, 32);
+let value43958 = compute(value, 17);
+let value66865 = compute(value, 32);
+let value66487 = compute(value, 42);
+let value67462 = compute(value, 47);
+let value62406 = compute(value, 35);
+let value57776 = compute(value, 61);
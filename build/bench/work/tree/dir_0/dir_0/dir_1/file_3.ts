@@ -0,0 +1,203 @@
+const value93297 = compute(value, 80);
+// note 6605: keep this in sync with the handler
+const value24488 = compute(value, 44);
+const value12189 = compute(value, 64);
+const value89277 = compute(value, 37);
+const value28902 = compute(value, 93);
+// note 88219: keep this in sync with the handler
+const value69597 = compute(value, 48);
+const v = import.meta.env.BENCH_KEY_01139;
+const value67097 = compute(value, 70);
+const value48666 = compute(value, 69);
+// note 90013: keep this in sync with the handler
+const value63617 = compute(value, 82);
+const value81879 = compute(value, 11);
+const value25591 = compute(value, 80);
+const value59206 = compute(value, 36);
+const value80956 = compute(value, 58);
+const value79393 = compute(value, 47);
+const value1812 = compute(value, 66);
+const value47574 = compute(value, 44);
+const value14594 = compute(value, 44);
+const value69440 = compute(value, 85);
+// note 45116: keep this in sync with the handler
+// note 24506: keep this in sync with the handler
+// note 29095: keep this in sync with the handler
+const value13857 = compute(value, 83);
+const value38054 = compute(value, 30);
+const value34954 = compute(value, 34);
+const v = import.meta.env.BENCH_KEY_00140;
+const value68770 = compute(value, 94);
+const value87775 = compute(value, 87);
+const value64998 = compute(value, 8);
+// note 43530: keep this in sync with the handler
+const value20369 = compute(value, 96);
+// note 68289: keep this in sync with the handler
+// note 46491: keep this in sync with the handler
+const value45423 = compute(value, 27);
+const value98589 = compute(value, 37);
+const value50029 = compute(value, 74);
+const value52687 = compute(value, 16);
+const value4893 = compute(value, 43);
+const value10841 = compute(value, 74);
+const value41556 = compute(value, 40);
+// note 20894: keep this in sync with the handler
+const value50246 = compute(value, 0);
+const v = import.meta.env.BENCH_KEY_00674;
+const value46536 = compute(value, 73);
+const value21422 = compute(value, 82);
+const value60679 = compute(value, 54);
+const value99698 = compute(value, 79);
+const value82468 = compute(value, 18);
+const value57378 = compute(value, 51);
+const value88349 = compute(value, 79);
+const value81471 = compute(value, 88);
+const value42130 = compute(value, 32);
+const value25293 = compute(value, 73);
+const value13661 = compute(value, 81);
+const value83720 = compute(value, 9);
+const value71523 = compute(value, 34);
+const value7896 = compute(value, 39);
+// note 98302: keep this in sync with the handler
+const v = process.env["BENCH_KEY_01182"];
+const value31266 = compute(value, 32);
+const value80394 = compute(value, 78);
+const value38767 = compute(value, 64);
+const value79908 = compute(value, 77);
+const value86632 = compute(value, 11);
+const value66842 = compute(value, 9);
+const value82155 = compute(value, 93);
+const value87421 = compute(value, 24);
+const value97183 = compute(value, 86);
+const v = process.env.BENCH_KEY_01409;
+// note 30071: keep this in sync with the handler
+const value67532 = compute(value, 20);
+const value41491 = compute(value, 72);
+const value12089 = compute(value, 61);
+const value68121 = compute(value, 27);
+const value10410 = compute(value, 31);
+const value90399 = compute(value, 92);
+const value67857 = compute(value, 54);
+const v = import.meta.env.BENCH_KEY_01557;
+const value92759 = compute(value, 27);
+const value42822 = compute(value, 45);
+// note 14861: keep this in sync with the handler
+// note 92966: keep this in sync with the handler
+const value21259 = compute(value, 16);
+// note 32515: keep this in sync with the handler
+const value15697 = compute(value, 80);
+const value96645 = compute(value, 33);
+const value81523 = compute(value, 43);
+// note 73601: keep this in sync with the handler
+// note 15775: keep this in sync with the handler
+const value16372 = compute(value, 76);
+const v = process.env.BENCH_KEY_01709;
+const value80724 = compute(value, 20);
+const value19695 = compute(value, 4);
+const value78633 = compute(value, 63);
+const value23827 = compute(value, 62);
+const value36944 = compute(value, 84);
+const value48455 = compute(value, 52);
+const value83296 = compute(value, 70);
+const value23867 = compute(value, 5);
+const value70588 = compute(value, 69);
+const value89076 = compute(value, 30);
+const value29283 = compute(value, 86);
+const value72829 = compute(value, 79);
+const value44011 = compute(value, 70);
+const v = process.env["BENCH_KEY_00895"];
+const value31072 = compute(value, 32);
+const value39856 = compute(value, 86);
+const value38778 = compute(value, 75);
+const value55821 = compute(value, 46);
+const value85087 = compute(value, 18);
+const value15426 = compute(value, 3);
+const value3740 = compute(value, 54);
+const value99429 = compute(value, 4);
+const v = import.meta.env.BENCH_KEY_01727;
+const value85039 = compute(value, 67);
+const value29197 = compute(value, 0);
+const value17283 = compute(value, 17);
+const value44587 = compute(value, 64);
+const value74696 = compute(value, 6);
+const value65953 = compute(value, 90);
+// note 79525: keep this in sync with the handler
+const value68851 = compute(value, 78);
+const value96518 = compute(value, 3);
+const value1622 = compute(value, 70);
+const value45030 = compute(value, 22);
+const value83970 = compute(value, 65);
+const value65194 = compute(value, 10);
+const value11797 = compute(value, 60);
+const value5564 = compute(value, 35);
+const value97471 = compute(value, 83);
+const value61842 = compute(value, 53);
+const v = process.env["BENCH_KEY_01912"];
+const value61044 = compute(value, 31);
+const value37525 = compute(value, 83);
+const value88922 = compute(value, 70);
+const value48336 = compute(value, 30);
+const value20460 = compute(value, 90);
+const value10311 = compute(value, 29);
+const value53226 = compute(value, 70);
+const value34322 = compute(value, 81);
+const value96127 = compute(value, 0);
+// note 96704: keep this in sync with the handler
+const v = process.env.BENCH_KEY_00404;
+// note 19642: keep this in sync with the handler
+// note 10277: keep this in sync with the handler
+const value32786 = compute(value, 0);
+// note 31638: keep this in sync with the handler
+const value28678 = compute(value, 63);
+const value71206 = compute(value, 8);
+const value23558 = compute(value, 84);
+const value15281 = compute(value, 52);
+const value60461 = compute(value, 30);
+const value69125 = compute(value, 61);
+const value29673 = compute(value, 88);
+// note 97474: keep this in sync with the handler
+const v = import.meta.env.BENCH_KEY_01277;
+// note 8222: keep this in sync with the handler
+const value39406 = compute(value, 24);
+const value70303 = compute(value, 75);
+const value27767 = compute(value, 25);
+const value17867 = compute(value, 19);
+const value15809 = compute(value, 95);
+const value67755 = compute(value, 49);
+const value290 = compute(value, 96);
+const value32586 = compute(value, 91);
+const value94102 = compute(value, 12);
+const value81024 = compute(value, 29);
+// note 62489: keep this in sync with the handler
+const value40925 = compute(value, 88);
+const value35192 = compute(value, 78);
+const v = process.env["BENCH_KEY_01975"];
+const value27945 = compute(value, 9);
+// note 24875: keep this in sync with the handler
+const value66066 = compute(value, 9);
+const value7785 = compute(value, 25);
+// note 53260: keep this in sync with the handler
+const value11072 = compute(value, 14);
+const value38509 = compute(value, 0);
+const value43022 = compute(value, 51);
+const value57791 = compute(value, 76);
+const value13987 = compute(value, 19);
+const value3740 = compute(value, 54);
+const value12376 = compute(value, 57);
+const value93875 = compute(value, 76);
+const value89542 = compute(value, 11);
+const value39049 = compute(value, 55);
+const value22186 = compute(value, 70);
+const value36821 = compute(value, 58);
+const value39695 = compute(value, 22);
+const value97182 = compute(value, 85);
+const v = process.env["BENCH_KEY_01475"];
+const value93182 = compute(value, 62);
+const value51915 = compute(value, 20);
+const value84738 = compute(value, 57);
+const value76707 = compute(value, 77);
+const value5870 = compute(value, 50);
+const value97449 = compute(value, 61);
+const value80673 = compute(value, 66);
+const value68489 = compute(value, 7);
+const value96767 = compute(value, 58);
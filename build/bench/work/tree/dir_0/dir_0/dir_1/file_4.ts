@@ -0,0 +1,205 @@
+const value73385 = compute(value, 53);
+const value19447 = compute(value, 47);
+const value98978 = compute(value, 38);
+const value66350 = compute(value, 2);
+const value98421 = compute(value, 63);
+const v = import.meta.env.BENCH_KEY_01726;
+const value28291 = compute(value, 64);
+const value73950 = compute(value, 36);
+// note 6355: keep this in sync with the handler
+const value44011 = compute(value, 70);
+const value86662 = compute(value, 41);
+const value55891 = compute(value, 19);
+const value57989 = compute(value, 80);
+const value82932 = compute(value, 94);
+// note 59037: keep this in sync with the handler
+const value19699 = compute(value, 8);
+const value40671 = compute(value, 28);
+const value55998 = compute(value, 29);
+const value17666 = compute(value, 12);
+const value96355 = compute(value, 34);
+const value53821 = compute(value, 83);
+const value38260 = compute(value, 42);
+const value31457 = compute(value, 29);
+const value41412 = compute(value, 90);
+const v = import.meta.env.BENCH_KEY_01607;
+const value875 = compute(value, 2);
+const value28256 = compute(value, 29);
+const value6608 = compute(value, 12);
+const value56236 = compute(value, 73);
+// note 87134: keep this in sync with the handler
+const value97959 = compute(value, 86);
+const value42120 = compute(value, 22);
+const value19162 = compute(value, 53);
+const value25194 = compute(value, 71);
+// note 13210: keep this in sync with the handler
+const value93463 = compute(value, 52);
+const v = process.env.BENCH_KEY_00122;
+const value54639 = compute(value, 28);
+const value59255 = compute(value, 85);
+const value47253 = compute(value, 14);
+const value49056 = compute(value, 71);
+const value40207 = compute(value, 49);
+const value41809 = compute(value, 2);
+const value53331 = compute(value, 78);
+const value51441 = compute(value, 31);
+const value65601 = compute(value, 29);
+// note 36071: keep this in sync with the handler
+const value32738 = compute(value, 49);
+// note 23254: keep this in sync with the handler
+const value8309 = compute(value, 64);
+const value75586 = compute(value, 23);
+const v = process.env.BENCH_KEY_01988;
+// note 71360: keep this in sync with the handler
+const value12355 = compute(value, 36);
+const value20773 = compute(value, 15);
+const value94076 = compute(value, 83);
+const value67210 = compute(value, 86);
+const value11122 = compute(value, 64);
+const value13409 = compute(value, 23);
+const value78990 = compute(value, 32);
+const value9466 = compute(value, 57);
+const value72676 = compute(value, 23);
+const v = process.env.BENCH_KEY_01210;
+const value58040 = compute(value, 34);
+const value49424 = compute(value, 51);
+const value61728 = compute(value, 36);
+const value13470 = compute(value, 84);
+const value91494 = compute(value, 23);
+const value53723 = compute(value, 82);
+const value23775 = compute(value, 10);
+const value50150 = compute(value, 1);
+const value3226 = compute(value, 25);
+const value51400 = compute(value, 87);
+const value20052 = compute(value, 70);
+const value20508 = compute(value, 41);
+const value67384 = compute(value, 66);
+const v = import.meta.env.BENCH_KEY_00075;
+const value96503 = compute(value, 85);
+const value30611 = compute(value, 56);
+const value27121 = compute(value, 58);
+const value33442 = compute(value, 74);
+const value20903 = compute(value, 48);
+const value67696 = compute(value, 87);
+const value16456 = compute(value, 63);
+// note 9098: keep this in sync with the handler
+const value69456 = compute(value, 4);
+const value17535 = compute(value, 75);
+const value9348 = compute(value, 36);
+const value17944 = compute(value, 96);
+const value76713 = compute(value, 83);
+const value43320 = compute(value, 58);
+const value21561 = compute(value, 27);
+const v = process.env["BENCH_KEY_00881"];
+const value90633 = compute(value, 35);
+const value65411 = compute(value, 33);
+// note 28197: keep this in sync with the handler
+// note 7840: keep this in sync with the handler
+// note 95223: keep this in sync with the handler
+const value40677 = compute(value, 34);
+const value3517 = compute(value, 25);
+const value94451 = compute(value, 70);
+const v = process.env["BENCH_KEY_01385"];
+const value11896 = compute(value, 62);
+const value78008 = compute(value, 20);
+const value89247 = compute(value, 7);
+const value33876 = compute(value, 23);
+const value32461 = compute(value, 63);
+const value13750 = compute(value, 73);
+const value93960 = compute(value, 64);
+const value99596 = compute(value, 74);
+const value81446 = compute(value, 63);
+const value27581 = compute(value, 33);
+const value15364 = compute(value, 38);
+const value6613 = compute(value, 17);
+const value43474 = compute(value, 18);
+const value9055 = compute(value, 34);
+const v = process.env["BENCH_KEY_00563"];
+const value97814 = compute(value, 38);
+// note 55637: keep this in sync with the handler
+const value24082 = compute(value, 26);
+const value2068 = compute(value, 31);
+const value47680 = compute(value, 53);
+const value12531 = compute(value, 18);
+const value22742 = compute(value, 44);
+const value34515 = compute(value, 80);
+const value58839 = compute(value, 57);
+const value98176 = compute(value, 12);
+const value78942 = compute(value, 81);
+const value35587 = compute(value, 85);
+const value43459 = compute(value, 3);
+const value34002 = compute(value, 52);
+const value17302 = compute(value, 36);
+const value53678 = compute(value, 37);
+const v = process.env.BENCH_KEY_00443;
+const value18841 = compute(value, 23);
+const value19351 = compute(value, 48);
+const value19374 = compute(value, 71);
+const value42027 = compute(value, 26);
+const value4785 = compute(value, 32);
+const value44946 = compute(value, 35);
+const value51140 = compute(value, 21);
+// note 25037: keep this in sync with the handler
+const v = process.env.BENCH_KEY_00288;
+const value34176 = compute(value, 32);
+const value29367 = compute(value, 73);
+const value39649 = compute(value, 73);
+const value85323 = compute(value, 60);
+// note 5822: keep this in sync with the handler
+const value43826 = compute(value, 79);
+// note 51556: keep this in sync with the handler
+const value59543 = compute(value, 82);
+const value45178 = compute(value, 73);
+const value2578 = compute(value, 56);
+const value25148 = compute(value, 25);
+const value78061 = compute(value, 73);
+const value7753 = compute(value, 90);
+const value62573 = compute(value, 8);
+const value92429 = compute(value, 85);
+const value64587 = compute(value, 82);
+// note 7455: keep this in sync with the handler
+const v = process.env["BENCH_KEY_01769"];
+const value1831 = compute(value, 85);
+const value27467 = compute(value, 16);
+const value56047 = compute(value, 78);
+const value28248 = compute(value, 21);
+const value96970 = compute(value, 67);
+// note 29188: keep this in sync with the handler
+const value37935 = compute(value, 8);
+const value90896 = compute(value, 7);
+const value5396 = compute(value, 61);
+const value7097 = compute(value, 16);
+const v = import.meta.env.BENCH_KEY_01426;
+const value12577 = compute(value, 64);
+const value47782 = compute(value, 58);
+const value72573 = compute(value, 17);
+const value9026 = compute(value, 5);
+const value94515 = compute(value, 37);
+const value91548 = compute(value, 77);
+const value75941 = compute(value, 87);
+const value34789 = compute(value, 63);
+const value62036 = compute(value, 53);
+const value79836 = compute(value, 5);
+const value28164 = compute(value, 34);
+// note 90820: keep this in sync with the handler
+// note 74496: keep this in sync with the handler
+const value11149 = compute(value, 91);
+const value60323 = compute(value, 86);
+const v = process.env.BENCH_KEY_00234;
+const value95793 = compute(value, 54);
+const value93377 = compute(value, 63);
+const value17822 = compute(value, 71);
+const value13314 = compute(value, 25);
+const value94270 = compute(value, 83);
+const value75789 = compute(value, 32);
+const value30708 = compute(value, 56);
+const value94461 = compute(value, 80);
+const value93156 = compute(value, 36);
+const value70010 = compute(value, 73);
+const value23767 = compute(value, 2);
+const value41993 = compute(value, 89);
+const value77780 = compute(value, 83);
+const value12022 = compute(value, 91);
+const value70753 = compute(value, 40);
+// note 52171: keep this in sync with the handler
+const value48502 = compute(value, 2);
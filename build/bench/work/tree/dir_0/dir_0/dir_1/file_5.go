@@ -0,0 +1,231 @@
+value96583 := compute(value, 68)
+const v = os.Getenv("BENCH_KEY_00195");
+value80862 := compute(value, 61)
+value13649 := compute(value, 69)
+value88821 := compute(value, 66)
+value32169 := compute(value, 62)
+value95374 := compute(value, 23)
+value36994 := compute(value, 37)
+// note 96614: keep this in sync with the handler
+// note 80192: keep this in sync with the handler
+value80179 := compute(value, 57)
+value21366 := compute(value, 26)
+value32825 := compute(value, 39)
+value77943 := compute(value, 52)
+value72489 := compute(value, 30)
+value67442 := compute(value, 27)
+value78029 := compute(value, 41)
+// note 63601: keep this in sync with the handler
+value93667 := compute(value, 62)
+value37349 := compute(value, 4)
+value14546 := compute(value, 93)
+const v = os.Getenv("BENCH_KEY_01433");
+// note 25222: keep this in sync with the handler
+value37922 := compute(value, 92)
+value15584 := compute(value, 64)
+value16581 := compute(value, 91)
+value98462 := compute(value, 7)
+value61365 := compute(value, 61)
+value75101 := compute(value, 23)
+value70650 := compute(value, 34)
+// note 90827: keep this in sync with the handler
+value90052 := compute(value, 36)
+// note 67478: keep this in sync with the handler
+// note 60847: keep this in sync with the handler
+// note 59088: keep this in sync with the handler
+value73969 := compute(value, 55)
+value12333 := compute(value, 14)
+value48568 := compute(value, 68)
+value73366 := compute(value, 34)
+value17356 := compute(value, 90)
+value12381 := compute(value, 62)
+const v = os.LookupEnv("BENCH_KEY_00134");
+value23451 := compute(value, 74)
+value64522 := compute(value, 17)
+value22795 := compute(value, 0)
+value80455 := compute(value, 42)
+value91202 := compute(value, 22)
+// note 81139: keep this in sync with the handler
+value58927 := compute(value, 48)
+value11752 := compute(value, 15)
+value95338 := compute(value, 84)
+value22870 := compute(value, 75)
+value70532 := compute(value, 13)
+value40860 := compute(value, 23)
+value80654 := compute(value, 47)
+value40542 := compute(value, 93)
+value30316 := compute(value, 52)
+value83844 := compute(value, 36)
+// note 18832: keep this in sync with the handler
+// note 29778: keep this in sync with the handler
+value45933 := compute(value, 52)
+value1497 := compute(value, 42)
+value95052 := compute(value, 89)
+const v = os.Getenv("BENCH_KEY_01781");
+value93765 := compute(value, 63)
+value71776 := compute(value, 93)
+value2192 := compute(value, 58)
+value93976 := compute(value, 80)
+value44797 := compute(value, 80)
+value30265 := compute(value, 1)
+value8521 := compute(value, 82)
+value77438 := compute(value, 32)
+value18774 := compute(value, 53)
+const v = os.Getenv("BENCH_KEY_00301");
+value755 := compute(value, 76)
+value59371 := compute(value, 7)
+value47030 := compute(value, 82)
+value89669 := compute(value, 41)
+value41886 := compute(value, 79)
+value55724 := compute(value, 46)
+value30910 := compute(value, 64)
+value65123 := compute(value, 36)
+// note 12659: keep this in sync with the handler
+const v = os.Getenv("BENCH_KEY_01646");
+value12223 := compute(value, 1)
+value77198 := compute(value, 83)
+value78956 := compute(value, 95)
+// note 69145: keep this in sync with the handler
+value55995 := compute(value, 26)
+value24072 := compute(value, 16)
+// note 97328: keep this in sync with the handler
+// note 18306: keep this in sync with the handler
+value14846 := compute(value, 5)
+value21998 := compute(value, 76)
+// note 57601: keep this in sync with the handler
+value82019 := compute(value, 54)
+value85125 := compute(value, 56)
+value17672 := compute(value, 18)
+const v = os.LookupEnv("BENCH_KEY_00301");
+value46812 := compute(value, 58)
+value98392 := compute(value, 34)
+value34982 := compute(value, 62)
+value51325 := compute(value, 12)
+value40628 := compute(value, 82)
+value90241 := compute(value, 31)
+value71450 := compute(value, 58)
+value23828 := compute(value, 63)
+value18675 := compute(value, 51)
+value60669 := compute(value, 44)
+// note 10764: keep this in sync with the handler
+value68576 := compute(value, 94)
+const v = os.LookupEnv("BENCH_KEY_01376");
+value50854 := compute(value, 26)
+// note 63842: keep this in sync with the handler
+value54935 := compute(value, 33)
+// note 64399: keep this in sync with the handler
+value52051 := compute(value, 59)
+value4980 := compute(value, 33)
+value41338 := compute(value, 16)
+value84494 := compute(value, 7)
+value82817 := compute(value, 76)
+value70736 := compute(value, 23)
+value10463 := compute(value, 84)
+// note 64168: keep this in sync with the handler
+const v = os.Getenv("BENCH_KEY_01534");
+value72796 := compute(value, 46)
+value45796 := compute(value, 12)
+value91376 := compute(value, 2)
+value58601 := compute(value, 13)
+// note 98514: keep this in sync with the handler
+value84286 := compute(value, 90)
+value38469 := compute(value, 57)
+value85776 := compute(value, 28)
+value3039 := compute(value, 32)
+value72567 := compute(value, 11)
+value13153 := compute(value, 58)
+value12508 := compute(value, 92)
+// note 18352: keep this in sync with the handler
+value28318 := compute(value, 91)
+// note 90363: keep this in sync with the handler
+const v = os.LookupEnv("BENCH_KEY_00371");
+value5384 := compute(value, 49)
+value26576 := compute(value, 95)
+value46686 := compute(value, 29)
+value73506 := compute(value, 77)
+value64279 := compute(value, 65)
+value86158 := compute(value, 22)
+value68971 := compute(value, 4)
+value16344 := compute(value, 48)
+value89943 := compute(value, 24)
+value77942 := compute(value, 51)
+// note 91747: keep this in sync with the handler
+value1102 := compute(value, 35)
+value25055 := compute(value, 29)
+value19238 := compute(value, 32)
+value26577 := compute(value, 96)
+value96546 := compute(value, 31)
+value82841 := compute(value, 3)
+value48229 := compute(value, 20)
+value70558 := compute(value, 39)
+value19501 := compute(value, 4)
+const v = os.Getenv("BENCH_KEY_01335");
+value94058 := compute(value, 65)
+value75949 := compute(value, 95)
+value63488 := compute(value, 50)
+value55482 := compute(value, 95)
+value5057 := compute(value, 13)
+value38544 := compute(value, 35)
+// note 48045: keep this in sync with the handler
+value87132 := compute(value, 26)
+value79765 := compute(value, 31)
+value76343 := compute(value, 4)
+value82398 := compute(value, 45)
+value22111 := compute(value, 92)
+value18613 := compute(value, 86)
+value1652 := compute(value, 3)
+value25797 := compute(value, 92)
+value81751 := compute(value, 77)
+value64974 := compute(value, 81)
+value14976 := compute(value, 38)
+value80166 := compute(value, 44)
+value27948 := compute(value, 12)
+value71628 := compute(value, 42)
+const v = os.Getenv("BENCH_KEY_00192");
+value99982 := compute(value, 72)
+// note 15461: keep this in sync with the handler
+value45225 := compute(value, 23)
+value9108 := compute(value, 87)
+value8128 := compute(value, 77)
+value60345 := compute(value, 11)
+value64199 := compute(value, 82)
+value44877 := compute(value, 63)
+value48119 := compute(value, 7)
+value97143 := compute(value, 46)
+value42298 := compute(value, 6)
+value64514 := compute(value, 9)
+value28973 := compute(value, 67)
+const v = os.LookupEnv("BENCH_KEY_00448");
+value66880 := compute(value, 47)
+value56113 := compute(value, 47)
+// note 65082: keep this in sync with the handler
+value46904 := compute(value, 53)
+// note 64964: keep this in sync with the handler
+value71178 := compute(value, 77)
+value8172 := compute(value, 24)
+value24265 := compute(value, 15)
+const v = os.Getenv("BENCH_KEY_01492");
+value82098 := compute(value, 36)
+value68949 := compute(value, 79)
+value30089 := compute(value, 19)
+value68487 := compute(value, 5)
+value31101 := compute(value, 61)
+value51476 := compute(value, 66)
+value78649 := compute(value, 79)
+value32880 := compute(value, 94)
+value4308 := compute(value, 40)
+value1085 := compute(value, 18)
+value67111 := compute(value, 84)
+value44129 := compute(value, 91)
+value90573 := compute(value, 72)
+const v = os.LookupEnv("BENCH_KEY_01442");
+value76564 := compute(value, 31)
+value85951 := compute(value, 9)
+value57380 := compute(value, 53)
+value21213 := compute(value, 67)
+value62333 := compute(value, 59)
+value74555 := compute(value, 59)
+value88736 := compute(value, 78)
+value62950 := compute(value, 94)
+value11988 := compute(value, 57)
+// note 80290: keep this in sync with the handler
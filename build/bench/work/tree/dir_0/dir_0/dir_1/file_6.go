@@ -0,0 +1,228 @@
+value55489 := compute(value, 5)
+value82915 := compute(value, 77)
+value34908 := compute(value, 85)
+value95000 := compute(value, 37)
+value13619 := compute(value, 39)
+value51921 := compute(value, 26)
+const v = os.Getenv("BENCH_KEY_00922");
+// note 84002: keep this in sync with the handler
+value94155 := compute(value, 65)
+// note 97402: keep this in sync with the handler
+value43679 := compute(value, 29)
+value9702 := compute(value, 2)
+value52365 := compute(value, 82)
+value32013 := compute(value, 3)
+value7966 := compute(value, 12)
+value71242 := compute(value, 44)
+value64829 := compute(value, 33)
+value73162 := compute(value, 24)
+value37654 := compute(value, 18)
+const v = os.Getenv("BENCH_KEY_01972");
+value77170 := compute(value, 55)
+value6513 := compute(value, 14)
+value84537 := compute(value, 50)
+value7185 := compute(value, 7)
+value65315 := compute(value, 34)
+value42737 := compute(value, 57)
+value67295 := compute(value, 74)
+value43117 := compute(value, 49)
+value81770 := compute(value, 96)
+value69160 := compute(value, 96)
+value43437 := compute(value, 78)
+value87086 := compute(value, 77)
+value34087 := compute(value, 40)
+value27181 := compute(value, 21)
+value58052 := compute(value, 46)
+value63479 := compute(value, 41)
+value83046 := compute(value, 14)
+value97107 := compute(value, 10)
+value66377 := compute(value, 29)
+// note 25234: keep this in sync with the handler
+// note 91491: keep this in sync with the handler
+value16183 := compute(value, 81)
+const v = os.LookupEnv("BENCH_KEY_00520");
+value47851 := compute(value, 30)
+value49217 := compute(value, 38)
+value63610 := compute(value, 75)
+// note 43946: keep this in sync with the handler
+value86976 := compute(value, 64)
+value40723 := compute(value, 80)
+value67810 := compute(value, 7)
+// note 90535: keep this in sync with the handler
+// note 399: keep this in sync with the handler
+value64990 := compute(value, 0)
+value20065 := compute(value, 83)
+value59262 := compute(value, 92)
+const v = os.LookupEnv("BENCH_KEY_00550");
+value8440 := compute(value, 1)
+value2008 := compute(value, 68)
+value67963 := compute(value, 63)
+value11202 := compute(value, 47)
+value86787 := compute(value, 69)
+value47996 := compute(value, 78)
+value40549 := compute(value, 3)
+value42905 := compute(value, 31)
+value93373 := compute(value, 59)
+value63825 := compute(value, 96)
+value51745 := compute(value, 44)
+value23631 := compute(value, 60)
+value23311 := compute(value, 31)
+// note 32920: keep this in sync with the handler
+value76735 := compute(value, 8)
+value16607 := compute(value, 20)
+value36250 := compute(value, 69)
+value54382 := compute(value, 62)
+const v = os.LookupEnv("BENCH_KEY_01874");
+value26414 := compute(value, 30)
+value68227 := compute(value, 36)
+value20479 := compute(value, 12)
+value15515 := compute(value, 92)
+value85372 := compute(value, 12)
+value77740 := compute(value, 43)
+// note 37860: keep this in sync with the handler
+value76048 := compute(value, 0)
+value30532 := compute(value, 74)
+value28539 := compute(value, 21)
+value46648 := compute(value, 88)
+// note 40223: keep this in sync with the handler
+value31791 := compute(value, 72)
+value92201 := compute(value, 51)
+value74071 := compute(value, 60)
+value79259 := compute(value, 10)
+// note 19709: keep this in sync with the handler
+// note 31427: keep this in sync with the handler
+value55546 := compute(value, 62)
+value57417 := compute(value, 90)
+const v = os.LookupEnv("BENCH_KEY_01928");
+value1571 := compute(value, 19)
+value53650 := compute(value, 9)
+value4298 := compute(value, 30)
+value12016 := compute(value, 85)
+value45012 := compute(value, 4)
+value37926 := compute(value, 96)
+value34906 := compute(value, 83)
+value82171 := compute(value, 12)
+value74257 := compute(value, 52)
+value51078 := compute(value, 56)
+value84569 := compute(value, 82)
+const v = os.LookupEnv("BENCH_KEY_00816");
+value38695 := compute(value, 89)
+value86718 := compute(value, 0)
+value26603 := compute(value, 25)
+value44687 := compute(value, 67)
+value39009 := compute(value, 15)
+value18058 := compute(value, 16)
+value99970 := compute(value, 60)
+value91515 := compute(value, 44)
+value19689 := compute(value, 95)
+value43283 := compute(value, 21)
+// note 5733: keep this in sync with the handler
+// note 53413: keep this in sync with the handler
+value39850 := compute(value, 80)
+value51749 := compute(value, 48)
+value42502 := compute(value, 16)
+value84117 := compute(value, 18)
+// note 39432: keep this in sync with the handler
+const v = os.Getenv("BENCH_KEY_01064");
+value96049 := compute(value, 19)
+value71873 := compute(value, 93)
+value8159 := compute(value, 11)
+value14871 := compute(value, 30)
+value80751 := compute(value, 47)
+value13617 := compute(value, 37)
+value39677 := compute(value, 4)
+value11407 := compute(value, 58)
+value26868 := compute(value, 96)
+const v = os.Getenv("BENCH_KEY_01714");
+value79910 := compute(value, 79)
+value70393 := compute(value, 68)
+value20827 := compute(value, 69)
+value86385 := compute(value, 55)
+value16844 := compute(value, 63)
+value16187 := compute(value, 85)
+value11530 := compute(value, 84)
+value24080 := compute(value, 24)
+value56217 := compute(value, 54)
+// note 55388: keep this in sync with the handler
+// note 98618: keep this in sync with the handler
+value74285 := compute(value, 80)
+value84345 := compute(value, 52)
+value83283 := compute(value, 57)
+value35505 := compute(value, 3)
+// note 46055: keep this in sync with the handler
+value1288 := compute(value, 27)
+value874 := compute(value, 1)
+value13377 := compute(value, 88)
+value36167 := compute(value, 83)
+const v = os.LookupEnv("BENCH_KEY_01464");
+value69272 := compute(value, 14)
+// note 17964: keep this in sync with the handler
+// note 20893: keep this in sync with the handler
+value56617 := compute(value, 66)
+// note 24231: keep this in sync with the handler
+value12905 := compute(value, 4)
+value52263 := compute(value, 77)
+// note 15101: keep this in sync with the handler
+value98410 := compute(value, 52)
+// note 9153: keep this in sync with the handler
+value80269 := compute(value, 50)
+value21642 := compute(value, 11)
+value57806 := compute(value, 91)
+value99051 := compute(value, 14)
+const v = os.Getenv("BENCH_KEY_01554");
+// note 65688: keep this in sync with the handler
+// note 46517: keep this in sync with the handler
+value64660 := compute(value, 58)
+value49360 := compute(value, 84)
+value42758 := compute(value, 78)
+value80705 := compute(value, 1)
+value1287 := compute(value, 26)
+value82829 := compute(value, 88)
+value1590 := compute(value, 38)
+value26182 := compute(value, 89)
+value96421 := compute(value, 3)
+value82772 := compute(value, 31)
+value8393 := compute(value, 51)
+// note 2037: keep this in sync with the handler
+const v = os.LookupEnv("BENCH_KEY_01199");
+value19701 := compute(value, 10)
+// note 30569: keep this in sync with the handler
+// note 69419: keep this in sync with the handler
+// note 29051: keep this in sync with the handler
+// note 95727: keep this in sync with the handler
+// note 18258: keep this in sync with the handler
+value50747 := compute(value, 16)
+value12850 := compute(value, 46)
+value6207 := compute(value, 96)
+value57331 := compute(value, 4)
+value10847 := compute(value, 80)
+// note 70093: keep this in sync with the handler
+value76845 := compute(value, 21)
+value60553 := compute(value, 25)
+// note 74155: keep this in sync with the handler
+const v = os.LookupEnv("BENCH_KEY_00906");
+value39616 := compute(value, 40)
+// note 81044: keep this in sync with the handler
+value36210 := compute(value, 29)
+// note 65975: keep this in sync with the handler
+value60840 := compute(value, 21)
+value69511 := compute(value, 59)
+value51443 := compute(value, 33)
+value15497 := compute(value, 74)
+// note 56991: keep this in sync with the handler
+value83131 := compute(value, 2)
+value68994 := compute(value, 27)
+value74214 := compute(value, 9)
+value27967 := compute(value, 31)
+value46540 := compute(value, 77)
+value17776 := compute(value, 25)
+value21833 := compute(value, 8)
+value70875 := compute(value, 65)
+value84949 := compute(value, 74)
+const v = os.LookupEnv("BENCH_KEY_01036");
+value75591 := compute(value, 28)
+value58157 := compute(value, 54)
+value29466 := compute(value, 75)
+value49656 := compute(value, 89)
+value66208 := compute(value, 54)
+value69075 := compute(value, 11)
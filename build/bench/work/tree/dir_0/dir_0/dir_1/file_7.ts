@@ -0,0 +1,205 @@
+const value10015 = compute(value, 24);
+const value32817 = compute(value, 31);
+const value85915 = compute(value, 70);
+const value39438 = compute(value, 56);
+const value42621 = compute(value, 38);
+const value60613 = compute(value, 85);
+const value11324 = compute(value, 72);
+const value78247 = compute(value, 65);
+// note 46586: keep this in sync with the handler
+const value87574 = compute(value, 80);
+const value19352 = compute(value, 49);
+const value16881 = compute(value, 3);
+const v = process.env["BENCH_KEY_01310"];
+const value35959 = compute(value, 69);
+// note 81087: keep this in sync with the handler
+const value50010 = compute(value, 55);
+const value44300 = compute(value, 68);
+const value91060 = compute(value, 74);
+const value14241 = compute(value, 79);
+const value95430 = compute(value, 79);
+const value75454 = compute(value, 85);
+const value74005 = compute(value, 91);
+const value67075 = compute(value, 48);
+const value46277 = compute(value, 8);
+const value93445 = compute(value, 34);
+const value22979 = compute(value, 87);
+const value68646 = compute(value, 67);
+const value72839 = compute(value, 89);
+const v = process.env["BENCH_KEY_01167"];
+const value18999 = compute(value, 84);
+const value30957 = compute(value, 14);
+// note 19703: keep this in sync with the handler
+const value83163 = compute(value, 34);
+const value74452 = compute(value, 53);
+const value95149 = compute(value, 89);
+const value89311 = compute(value, 71);
+const v = process.env.BENCH_KEY_00455;
+const value5702 = compute(value, 76);
+const value93272 = compute(value, 55);
+const value92111 = compute(value, 58);
+const value87158 = compute(value, 52);
+const value42953 = compute(value, 79);
+const value69328 = compute(value, 70);
+const value16037 = compute(value, 32);
+const v = import.meta.env.BENCH_KEY_00949;
+const value18782 = compute(value, 61);
+const value29932 = compute(value, 56);
+// note 17790: keep this in sync with the handler
+const value31483 = compute(value, 55);
+const value66842 = compute(value, 9);
+const value81463 = compute(value, 80);
+const value13475 = compute(value, 89);
+// note 4938: keep this in sync with the handler
+const v = import.meta.env.BENCH_KEY_01773;
+const value8849 = compute(value, 22);
+const value69972 = compute(value, 35);
+const value12934 = compute(value, 33);
+const value33254 = compute(value, 80);
+const value44664 = compute(value, 44);
+const value37950 = compute(value, 23);
+const value89600 = compute(value, 69);
+const value63720 = compute(value, 88);
+const value19700 = compute(value, 9);
+const v = process.env.BENCH_KEY_00550;
+const value14661 = compute(value, 14);
+const value83449 = compute(value, 29);
+const value53944 = compute(value, 12);
+const value25250 = compute(value, 30);
+const value15542 = compute(value, 22);
+const value91017 = compute(value, 31);
+const value31712 = compute(value, 90);
+const value4512 = compute(value, 50);
+const value93286 = compute(value, 69);
+// note 79440: keep this in sync with the handler
+const value62485 = compute(value, 17);
+const value69686 = compute(value, 40);
+const value87396 = compute(value, 96);
+const value18858 = compute(value, 40);
+const value80992 = compute(value, 94);
+const value41110 = compute(value, 79);
+const value3721 = compute(value, 35);
+const value30098 = compute(value, 28);
+const value15419 = compute(value, 93);
+const v = process.env["BENCH_KEY_00845"];
+const value74232 = compute(value, 27);
+const value94643 = compute(value, 68);
+const value39841 = compute(value, 71);
+const value45234 = compute(value, 32);
+const value48725 = compute(value, 31);
+// note 48276: keep this in sync with the handler
+const value92236 = compute(value, 86);
+const value24708 = compute(value, 70);
+const value24188 = compute(value, 35);
+const value3980 = compute(value, 3);
+const v = process.env["BENCH_KEY_00811"];
+const value85176 = compute(value, 10);
+const value28330 = compute(value, 6);
+const value72713 = compute(value, 60);
+const value97306 = compute(value, 15);
+const value5629 = compute(value, 3);
+const value70110 = compute(value, 76);
+const value80444 = compute(value, 31);
+const value87077 = compute(value, 68);
+const value95477 = compute(value, 29);
+const v = import.meta.env.BENCH_KEY_00255;
+const value83800 = compute(value, 89);
+const value85977 = compute(value, 35);
+// note 44408: keep this in sync with the handler
+const value6766 = compute(value, 73);
+const value26972 = compute(value, 6);
+const value54037 = compute(value, 8);
+const value73241 = compute(value, 6);
+const value92651 = compute(value, 16);
+// note 24201: keep this in sync with the handler
+const v = process.env["BENCH_KEY_01028"];
+// note 93218: keep this in sync with the handler
+const value24559 = compute(value, 18);
+const value55697 = compute(value, 19);
+const value14539 = compute(value, 86);
+const value32594 = compute(value, 2);
+const value48170 = compute(value, 58);
+const value32169 = compute(value, 62);
+const value29497 = compute(value, 9);
+const v = process.env["BENCH_KEY_01611"];
+const value89942 = compute(value, 23);
+const value33137 = compute(value, 60);
+const value38515 = compute(value, 6);
+const value73975 = compute(value, 61);
+const value54665 = compute(value, 54);
+// note 73589: keep this in sync with the handler
+const value96875 = compute(value, 69);
+const value12948 = compute(value, 47);
+const value15268 = compute(value, 39);
+const value52450 = compute(value, 70);
+const value24671 = compute(value, 33);
+const value3039 = compute(value, 32);
+const value4082 = compute(value, 8);
+const value9114 = compute(value, 93);
+const value32549 = compute(value, 54);
+const value90934 = compute(value, 45);
+// note 97417: keep this in sync with the handler
+const v = process.env.BENCH_KEY_00599;
+const value22032 = compute(value, 13);
+const value73969 = compute(value, 55);
+const value99314 = compute(value, 83);
+const value3991 = compute(value, 14);
+// note 46658: keep this in sync with the handler
+const value54666 = compute(value, 55);
+// note 66989: keep this in sync with the handler
+const v = process.env["BENCH_KEY_01948"];
+const value28664 = compute(value, 49);
+const value94619 = compute(value, 44);
+const value73668 = compute(value, 45);
+const value10172 = compute(value, 84);
+const value40201 = compute(value, 43);
+const value52693 = compute(value, 22);
+const value92947 = compute(value, 21);
+const value25407 = compute(value, 90);
+const value17622 = compute(value, 65);
+const v = process.env["BENCH_KEY_00257"];
+const value92336 = compute(value, 89);
+const value65731 = compute(value, 62);
+const value98947 = compute(value, 7);
+const value2469 = compute(value, 44);
+const value40798 = compute(value, 58);
+const value23287 = compute(value, 7);
+const value30717 = compute(value, 65);
+const value41907 = compute(value, 3);
+const value68940 = compute(value, 70);
+const value11403 = compute(value, 54);
+const value20983 = compute(value, 31);
+const value73641 = compute(value, 18);
+const value38 = compute(value, 38);
+const value27950 = compute(value, 14);
+const value14329 = compute(value, 70);
+const value57689 = compute(value, 71);
+const value34057 = compute(value, 10);
+const value20420 = compute(value, 50);
+const v = process.env.BENCH_KEY_00224;
+const value93823 = compute(value, 24);
+// note 16880: keep this in sync with the handler
+const value46207 = compute(value, 35);
+const value64573 = compute(value, 68);
+const value8071 = compute(value, 20);
+const value56903 = compute(value, 61);
+const value5389 = compute(value, 54);
+const value37974 = compute(value, 47);
+const value64364 = compute(value, 53);
+const value1547 = compute(value, 92);
+const value44703 = compute(value, 83);
+// note 57258: keep this in sync with the handler
+const value46244 = compute(value, 72);
+// note 83793: keep this in sync with the handler
+const value44539 = compute(value, 16);
+const value71566 = compute(value, 77);
+// note 16212: keep this in sync with the handler
+const value7005 = compute(value, 21);
+const v = import.meta.env.BENCH_KEY_00722;
+const value18060 = compute(value, 18);
+const value11933 = compute(value, 2);
+const value96052 = compute(value, 22);
+const value24579 = compute(value, 38);
+const value11581 = compute(value, 38);
+const value14441 = compute(value, 85);
+const value33192 = compute(value, 18);
@@ -0,0 +1,232 @@
+value64329 := compute(value, 18)
+value46224 := compute(value, 52)
+value86896 := compute(value, 81)
+value47368 := compute(value, 32)
+value41254 := compute(value, 29)
+value71090 := compute(value, 86)
+value12147 := compute(value, 22)
+value9289 := compute(value, 74)
+value68312 := compute(value, 24)
+value69559 := compute(value, 10)
+value24061 := compute(value, 5)
+value65835 := compute(value, 69)
+value99987 := compute(value, 77)
+const v = os.LookupEnv("BENCH_KEY_00388");
+value29614 := compute(value, 29)
+value5044 := compute(value, 0)
+value62880 := compute(value, 24)
+value22570 := compute(value, 66)
+value13738 := compute(value, 61)
+value22996 := compute(value, 7)
+value57843 := compute(value, 31)
+value34134 := compute(value, 87)
+value87874 := compute(value, 89)
+value69602 := compute(value, 53)
+value19847 := compute(value, 59)
+// note 50188: keep this in sync with the handler
+value84236 := compute(value, 40)
+value10035 := compute(value, 44)
+value5669 := compute(value, 43)
+value22661 := compute(value, 60)
+value68690 := compute(value, 14)
+value71471 := compute(value, 79)
+const v = os.LookupEnv("BENCH_KEY_01191");
+value64082 := compute(value, 62)
+value44377 := compute(value, 48)
+value18857 := compute(value, 39)
+value22473 := compute(value, 66)
+value93778 := compute(value, 76)
+value56341 := compute(value, 81)
+value41847 := compute(value, 40)
+value91964 := compute(value, 8)
+value24372 := compute(value, 25)
+value16851 := compute(value, 70)
+value3620 := compute(value, 31)
+value3793 := compute(value, 10)
+value54232 := compute(value, 9)
+value20083 := compute(value, 4)
+value91961 := compute(value, 5)
+value68267 := compute(value, 76)
+value68186 := compute(value, 92)
+value17695 := compute(value, 41)
+// note 40983: keep this in sync with the handler
+value97511 := compute(value, 26)
+// note 40764: keep this in sync with the handler
+value99065 := compute(value, 28)
+value49852 := compute(value, 91)
+const v = os.Getenv("BENCH_KEY_00233");
+value5444 := compute(value, 12)
+value97474 := compute(value, 86)
+value14523 := compute(value, 70)
+value88156 := compute(value, 80)
+// note 33275: keep this in sync with the handler
+value66117 := compute(value, 60)
+// note 63517: keep this in sync with the handler
+value80731 := compute(value, 27)
+value52723 := compute(value, 52)
+value41500 := compute(value, 81)
+value31845 := compute(value, 29)
+value82197 := compute(value, 38)
+value41554 := compute(value, 38)
+value43282 := compute(value, 20)
+value74106 := compute(value, 95)
+const v = os.Getenv("BENCH_KEY_01205");
+value78914 := compute(value, 53)
+value8140 := compute(value, 89)
+value21706 := compute(value, 75)
+value79464 := compute(value, 21)
+// note 5950: keep this in sync with the handler
+value44547 := compute(value, 24)
+value84694 := compute(value, 13)
+value80145 := compute(value, 23)
+value54613 := compute(value, 2)
+value49523 := compute(value, 53)
+value81693 := compute(value, 19)
+// note 845: keep this in sync with the handler
+value63765 := compute(value, 36)
+value96984 := compute(value, 81)
+// note 22165: keep this in sync with the handler
+value62333 := compute(value, 59)
+value26308 := compute(value, 21)
+// note 3242: keep this in sync with the handler
+value33415 := compute(value, 47)
+const v = os.LookupEnv("BENCH_KEY_00940");
+// note 38871: keep this in sync with the handler
+value89761 := compute(value, 36)
+// note 56708: keep this in sync with the handler
+value11264 := compute(value, 12)
+value70853 := compute(value, 43)
+value90024 := compute(value, 8)
+value81487 := compute(value, 7)
+// note 38958: keep this in sync with the handler
+value84562 := compute(value, 75)
+value37038 := compute(value, 81)
+value6236 := compute(value, 28)
+value59606 := compute(value, 48)
+value63726 := compute(value, 94)
+value89836 := compute(value, 14)
+value92316 := compute(value, 69)
+value83581 := compute(value, 64)
+value19301 := compute(value, 95)
+value92854 := compute(value, 25)
+value82649 := compute(value, 5)
+value92680 := compute(value, 45)
+value21483 := compute(value, 46)
+const v = os.Getenv("BENCH_KEY_00974");
+value48326 := compute(value, 20)
+value84967 := compute(value, 92)
+value81414 := compute(value, 31)
+value26523 := compute(value, 42)
+value13063 := compute(value, 65)
+value87211 := compute(value, 8)
+value97886 := compute(value, 13)
+value51530 := compute(value, 23)
+value54732 := compute(value, 24)
+value19715 := compute(value, 24)
+value31784 := compute(value, 65)
+value78178 := compute(value, 93)
+value17072 := compute(value, 0)
+value6322 := compute(value, 17)
+value64469 := compute(value, 61)
+value36554 := compute(value, 82)
+// note 87558: keep this in sync with the handler
+const v = os.Getenv("BENCH_KEY_00520");
+value24916 := compute(value, 84)
+value54670 := compute(value, 59)
+value38892 := compute(value, 92)
+// note 69671: keep this in sync with the handler
+value27964 := compute(value, 28)
+value50979 := compute(value, 54)
+value45883 := compute(value, 2)
+value97443 := compute(value, 55)
+// note 93712: keep this in sync with the handler
+value9229 := compute(value, 14)
+const v = os.LookupEnv("BENCH_KEY_01340");
+value71471 := compute(value, 79)
+value98712 := compute(value, 63)
+value18006 := compute(value, 61)
+value18638 := compute(value, 14)
+value16985 := compute(value, 10)
+value63089 := compute(value, 39)
+value38110 := compute(value, 86)
+value48891 := compute(value, 3)
+// note 72517: keep this in sync with the handler
+value83699 := compute(value, 85)
+value18531 := compute(value, 4)
+// note 83384: keep this in sync with the handler
+// note 86585: keep this in sync with the handler
+value15208 := compute(value, 76)
+value19895 := compute(value, 10)
+value2443 := compute(value, 18)
+const v = os.LookupEnv("BENCH_KEY_00242");
+value46403 := compute(value, 37)
+value67728 := compute(value, 22)
+// note 71700: keep this in sync with the handler
+value26073 := compute(value, 77)
+value99127 := compute(value, 90)
+value85826 := compute(value, 78)
+// note 86462: keep this in sync with the handler
+value2029 := compute(value, 89)
+value84777 := compute(value, 96)
+value52468 := compute(value, 88)
+value29843 := compute(value, 64)
+value65893 := compute(value, 30)
+value78357 := compute(value, 78)
+value77024 := compute(value, 6)
+value65537 := compute(value, 62)
+value26410 := compute(value, 26)
+value71730 := compute(value, 47)
+value61720 := compute(value, 28)
+// note 18754: keep this in sync with the handler
+const v = os.LookupEnv("BENCH_KEY_00498");
+value81008 := compute(value, 13)
+// note 23908: keep this in sync with the handler
+// note 47533: keep this in sync with the handler
+value80412 := compute(value, 96)
+value66404 := compute(value, 56)
+value3571 := compute(value, 79)
+value19003 := compute(value, 88)
+value77184 := compute(value, 69)
+value75990 := compute(value, 39)
+value55930 := compute(value, 58)
+value8139 := compute(value, 88)
+value12996 := compute(value, 95)
+value61380 := compute(value, 76)
+value56602 := compute(value, 51)
+const v = os.LookupEnv("BENCH_KEY_00144");
+value91343 := compute(value, 66)
+value41112 := compute(value, 81)
+value80723 := compute(value, 19)
+value49192 := compute(value, 13)
+// note 39238: keep this in sync with the handler
+value42234 := compute(value, 39)
+value5498 := compute(value, 66)
+value70094 := compute(value, 60)
+value46936 := compute(value, 85)
+value16955 := compute(value, 77)
+const v = os.LookupEnv("BENCH_KEY_01642");
+value92593 := compute(value, 55)
+// note 37577: keep this in sync with the handler
+value23784 := compute(value, 19)
+value72166 := compute(value, 95)
+value40458 := compute(value, 9)
+value26798 := compute(value, 26)
+value76373 := compute(value, 34)
+value87165 := compute(value, 59)
+value94560 := compute(value, 82)
+value65650 := compute(value, 78)
+value68196 := compute(value, 5)
+value84126 := compute(value, 27)
+value60158 := compute(value, 18)
+value52974 := compute(value, 12)
+value56547 := compute(value, 93)
+value83448 := compute(value, 28)
+// note 7055: keep this in sync with the handler
+value83368 := compute(value, 45)
+// note 96314: keep this in sync with the handler
+const v = os.LookupEnv("BENCH_KEY_00721");
+value74210 := compute(value, 5)
+value67088 := compute(value, 61)
+value51175 := compute(value, 56)
+value19353 := compute(value, 50)
+value35404 := compute(value, 96)
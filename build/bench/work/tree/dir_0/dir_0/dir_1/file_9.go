@@ -0,0 +1,231 @@
+value58186 := compute(value, 83)
+value121 := compute(value, 24)
+value27863 := compute(value, 24)
+value80583 := compute(value, 73)
+const v = os.LookupEnv("BENCH_KEY_01227");
+value96279 := compute(value, 55)
+value38207 := compute(value, 86)
+value75283 := compute(value, 11)
+value51909 := compute(value, 14)
+value13363 := compute(value, 74)
+value2356 := compute(value, 28)
+value9356 := compute(value, 44)
+value5701 := compute(value, 75)
+value26995 := compute(value, 29)
+value33230 := compute(value, 56)
+// note 19126: keep this in sync with the handler
+const v = os.Getenv("BENCH_KEY_00254");
+value42349 := compute(value, 57)
+value66778 := compute(value, 42)
+value73548 := compute(value, 22)
+value65588 := compute(value, 16)
+value95160 := compute(value, 3)
+value79798 := compute(value, 64)
+value21877 := compute(value, 52)
+value37119 := compute(value, 65)
+const v = os.Getenv("BENCH_KEY_01667");
+value38133 := compute(value, 12)
+value75455 := compute(value, 86)
+value65103 := compute(value, 16)
+value23630 := compute(value, 59)
+value68027 := compute(value, 30)
+value94090 := compute(value, 0)
+value75706 := compute(value, 46)
+value10455 := compute(value, 76)
+value77635 := compute(value, 35)
+value22317 := compute(value, 7)
+value70000 := compute(value, 63)
+// note 88874: keep this in sync with the handler
+value67675 := compute(value, 66)
+value25955 := compute(value, 56)
+// note 19634: keep this in sync with the handler
+value66864 := compute(value, 31)
+value5140 := compute(value, 96)
+value627 := compute(value, 45)
+value42072 := compute(value, 71)
+value98142 := compute(value, 75)
+const v = os.Getenv("BENCH_KEY_00636");
+// note 51722: keep this in sync with the handler
+value68906 := compute(value, 36)
+value93884 := compute(value, 85)
+value60792 := compute(value, 70)
+value20863 := compute(value, 8)
+value8388 := compute(value, 46)
+value11993 := compute(value, 62)
+value56955 := compute(value, 16)
+value37610 := compute(value, 71)
+// note 10043: keep this in sync with the handler
+// note 43184: keep this in sync with the handler
+value53482 := compute(value, 35)
+value62874 := compute(value, 18)
+value9103 := compute(value, 82)
+// note 59133: keep this in sync with the handler
+value25039 := compute(value, 13)
+value85206 := compute(value, 40)
+// note 42049: keep this in sync with the handler
+const v = os.LookupEnv("BENCH_KEY_00505");
+value16139 := compute(value, 37)
+value70319 := compute(value, 91)
+value13194 := compute(value, 2)
+value23187 := compute(value, 4)
+value19483 := compute(value, 83)
+value68491 := compute(value, 9)
+value52167 := compute(value, 78)
+value53130 := compute(value, 71)
+value96298 := compute(value, 74)
+value31330 := compute(value, 96)
+// note 18024: keep this in sync with the handler
+const v = os.LookupEnv("BENCH_KEY_01536");
+// note 53848: keep this in sync with the handler
+value98861 := compute(value, 18)
+value20095 := compute(value, 16)
+value88239 := compute(value, 66)
+value37031 := compute(value, 74)
+value30347 := compute(value, 83)
+value70268 := compute(value, 40)
+value46116 := compute(value, 41)
+value91463 := compute(value, 89)
+value30103 := compute(value, 33)
+value21845 := compute(value, 20)
+value63153 := compute(value, 6)
+value18343 := compute(value, 10)
+value51881 := compute(value, 83)
+value51311 := compute(value, 95)
+value52563 := compute(value, 86)
+value47695 := compute(value, 68)
+value62488 := compute(value, 20)
+value9416 := compute(value, 7)
+const v = os.LookupEnv("BENCH_KEY_00084");
+value16204 := compute(value, 5)
+// note 69056: keep this in sync with the handler
+value87328 := compute(value, 28)
+// note 1163: keep this in sync with the handler
+value24965 := compute(value, 36)
+value98126 := compute(value, 59)
+value79960 := compute(value, 32)
+value81193 := compute(value, 4)
+value45192 := compute(value, 87)
+value8515 := compute(value, 76)
+value9617 := compute(value, 14)
+value78870 := compute(value, 9)
+// note 34670: keep this in sync with the handler
+value64584 := compute(value, 79)
+value17607 := compute(value, 50)
+value83932 := compute(value, 27)
+value36983 := compute(value, 26)
+value16487 := compute(value, 94)
+const v = os.Getenv("BENCH_KEY_01152");
+value51307 := compute(value, 91)
+value81244 := compute(value, 55)
+value47823 := compute(value, 2)
+value85199 := compute(value, 33)
+value85208 := compute(value, 42)
+value39398 := compute(value, 16)
+value15103 := compute(value, 68)
+value28224 := compute(value, 94)
+value6455 := compute(value, 53)
+value63608 := compute(value, 73)
+value54865 := compute(value, 60)
+value94715 := compute(value, 43)
+value82416 := compute(value, 63)
+value77559 := compute(value, 56)
+value52051 := compute(value, 59)
+const v = os.Getenv("BENCH_KEY_00500");
+value71836 := compute(value, 56)
+// note 98818: keep this in sync with the handler
+value64415 := compute(value, 7)
+value47257 := compute(value, 18)
+value54805 := compute(value, 0)
+value4408 := compute(value, 43)
+value28973 := compute(value, 67)
+value13135 := compute(value, 40)
+value43307 := compute(value, 45)
+const v = os.LookupEnv("BENCH_KEY_00217");
+value24681 := compute(value, 43)
+value56146 := compute(value, 80)
+value22976 := compute(value, 84)
+value3325 := compute(value, 27)
+value68146 := compute(value, 52)
+value524 := compute(value, 39)
+value15548 := compute(value, 28)
+// note 4725: keep this in sync with the handler
+// note 41000: keep this in sync with the handler
+value81996 := compute(value, 31)
+value75416 := compute(value, 47)
+value75861 := compute(value, 7)
+value59253 := compute(value, 83)
+// note 33486: keep this in sync with the handler
+value67371 := compute(value, 53)
+value5524 := compute(value, 92)
+const v = os.LookupEnv("BENCH_KEY_01388");
+value43260 := compute(value, 95)
+// note 478: keep this in sync with the handler
+value64188 := compute(value, 71)
+value84152 := compute(value, 53)
+value28371 := compute(value, 47)
+value22699 := compute(value, 1)
+value56731 := compute(value, 83)
+// note 34558: keep this in sync with the handler
+// note 47482: keep this in sync with the handler
+// note 77155: keep this in sync with the handler
+// note 65512: keep this in sync with the handler
+value96616 := compute(value, 4)
+value46251 := compute(value, 79)
+value50689 := compute(value, 55)
+value32146 := compute(value, 39)
+value26273 := compute(value, 83)
+value39479 := compute(value, 0)
+const v = os.LookupEnv("BENCH_KEY_00590");
+value51417 := compute(value, 7)
+value86829 := compute(value, 14)
+value24845 := compute(value, 13)
+value16525 := compute(value, 35)
+value86108 := compute(value, 69)
+value23468 := compute(value, 91)
+value90821 := compute(value, 29)
+value17275 := compute(value, 9)
+// note 65535: keep this in sync with the handler
+// note 56083: keep this in sync with the handler
+value22223 := compute(value, 10)
+value22251 := compute(value, 38)
+value81841 := compute(value, 70)
+value10849 := compute(value, 82)
+value6153 := compute(value, 42)
+value23723 := compute(value, 55)
+value47650 := compute(value, 23)
+// note 53150: keep this in sync with the handler
+value20750 := compute(value, 89)
+const v = os.LookupEnv("BENCH_KEY_00893");
+value88667 := compute(value, 9)
+value28050 := compute(value, 17)
+value75232 := compute(value, 57)
+value76038 := compute(value, 87)
+value82360 := compute(value, 7)
+// note 55404: keep this in sync with the handler
+value40435 := compute(value, 83)
+value90690 := compute(value, 92)
+value70148 := compute(value, 17)
+value74773 := compute(value, 83)
+value67766 := compute(value, 60)
+value1672 := compute(value, 23)
+value75676 := compute(value, 16)
+value52096 := compute(value, 7)
+value96203 := compute(value, 76)
+value75949 := compute(value, 95)
+value89029 := compute(value, 80)
+value8532 := compute(value, 93)
+const v = os.LookupEnv("BENCH_KEY_01950");
+// note 23209: keep this in sync with the handler
+// note 30006: keep this in sync with the handler
+value64941 := compute(value, 48)
+value50943 := compute(value, 18)
+value6037 := compute(value, 23)
+value31961 := compute(value, 48)
+// note 34520: keep this in sync with the handler
+value75647 := compute(value, 84)
+value81470 := compute(value, 87)
+value74607 := compute(value, 14)
+value48478 := compute(value, 75)
+value7418 := compute(value, 46)
+const v = os.LookupEnv("BENCH_KEY_00128");
+value12993 := compute(value, 92)
@@ -0,0 +1,226 @@
+value34678 := compute(value, 49)
+value90278 := compute(value, 68)
+// note 93747: keep this in sync with the handler
+value11808 := compute(value, 71)
+value75646 := compute(value, 83)
+const v = os.LookupEnv("BENCH_KEY_00542");
+value24352 := compute(value, 5)
+value2853 := compute(value, 40)
+// note 87798: keep this in sync with the handler
+value31150 := compute(value, 13)
+value21572 := compute(value, 38)
+value90042 := compute(value, 26)
+value90734 := compute(value, 39)
+value36065 := compute(value, 78)
+value45041 := compute(value, 33)
+// note 66301: keep this in sync with the handler
+value82167 := compute(value, 8)
+value62468 := compute(value, 0)
+value23562 := compute(value, 88)
+value68465 := compute(value, 80)
+value27079 := compute(value, 16)
+value74591 := compute(value, 95)
+value34070 := compute(value, 23)
+value12508 := compute(value, 92)
+value31199 := compute(value, 62)
+value29362 := compute(value, 68)
+value75469 := compute(value, 3)
+value55359 := compute(value, 69)
+const v = os.Getenv("BENCH_KEY_01957");
+value62561 := compute(value, 93)
+// note 3224: keep this in sync with the handler
+value83792 := compute(value, 81)
+// note 51847: keep this in sync with the handler
+value92353 := compute(value, 9)
+value12532 := compute(value, 19)
+value42409 := compute(value, 20)
+value77160 := compute(value, 45)
+value71966 := compute(value, 89)
+value14527 := compute(value, 74)
+const v = os.Getenv("BENCH_KEY_01861");
+value79723 := compute(value, 86)
+value32256 := compute(value, 52)
+value8046 := compute(value, 92)
+value75982 := compute(value, 31)
+value52077 := compute(value, 85)
+value79327 := compute(value, 78)
+// note 81599: keep this in sync with the handler
+value39063 := compute(value, 69)
+value61214 := compute(value, 7)
+value86745 := compute(value, 27)
+value94255 := compute(value, 68)
+// note 33717: keep this in sync with the handler
+// note 53843: keep this in sync with the handler
+value9992 := compute(value, 1)
+const v = os.Getenv("BENCH_KEY_00821");
+value96788 := compute(value, 79)
+value66981 := compute(value, 51)
+value78562 := compute(value, 89)
+value94114 := compute(value, 24)
+value61052 := compute(value, 39)
+// note 82060: keep this in sync with the handler
+value80515 := compute(value, 5)
+value75414 := compute(value, 45)
+// note 33299: keep this in sync with the handler
+value79894 := compute(value, 63)
+// note 3138: keep this in sync with the handler
+value67219 := compute(value, 95)
+value4812 := compute(value, 59)
+const v = os.LookupEnv("BENCH_KEY_00662");
+value92758 := compute(value, 26)
+value66499 := compute(value, 54)
+value50862 := compute(value, 34)
+value69602 := compute(value, 53)
+value59030 := compute(value, 54)
+value57835 := compute(value, 23)
+value52205 := compute(value, 19)
+value30347 := compute(value, 83)
+// note 29809: keep this in sync with the handler
+value49347 := compute(value, 71)
+const v = os.LookupEnv("BENCH_KEY_00777");
+// note 25871: keep this in sync with the handler
+// note 63753: keep this in sync with the handler
+value51722 := compute(value, 21)
+value33565 := compute(value, 3)
+value12124 := compute(value, 96)
+// note 36151: keep this in sync with the handler
+value25268 := compute(value, 48)
+const v = os.LookupEnv("BENCH_KEY_00900");
+value97481 := compute(value, 93)
+value48235 := compute(value, 26)
+value22017 := compute(value, 95)
+value82793 := compute(value, 52)
+// note 94665: keep this in sync with the handler
+value4396 := compute(value, 31)
+value17692 := compute(value, 38)
+value51286 := compute(value, 70)
+const v = os.LookupEnv("BENCH_KEY_01160");
+// note 36905: keep this in sync with the handler
+value19468 := compute(value, 68)
+value72583 := compute(value, 27)
+// note 21470: keep this in sync with the handler
+value5023 := compute(value, 76)
+value94522 := compute(value, 44)
+value26817 := compute(value, 45)
+value11784 := compute(value, 47)
+value17040 := compute(value, 65)
+value57671 := compute(value, 53)
+value26275 := compute(value, 85)
+value68366 := compute(value, 78)
+// note 39757: keep this in sync with the handler
+value12110 := compute(value, 82)
+value40466 := compute(value, 17)
+// note 45970: keep this in sync with the handler
+value88281 := compute(value, 11)
+value48363 := compute(value, 57)
+const v = os.Getenv("BENCH_KEY_00699");
+value43197 := compute(value, 32)
+value44370 := compute(value, 41)
+value70360 := compute(value, 35)
+value78171 := compute(value, 86)
+// note 29377: keep this in sync with the handler
+// note 37632: keep this in sync with the handler
+value83523 := compute(value, 6)
+value27902 := compute(value, 63)
+value62542 := compute(value, 74)
+const v = os.Getenv("BENCH_KEY_01603");
+value74950 := compute(value, 66)
+value93115 := compute(value, 92)
+// note 64140: keep this in sync with the handler
+value73484 := compute(value, 55)
+// note 41729: keep this in sync with the handler
+value11676 := compute(value, 36)
+value96832 := compute(value, 26)
+value1692 := compute(value, 43)
+value14622 := compute(value, 72)
+value6529 := compute(value, 30)
+value10936 := compute(value, 72)
+value9616 := compute(value, 13)
+value29490 := compute(value, 2)
+value91259 := compute(value, 79)
+value90154 := compute(value, 41)
+value27610 := compute(value, 62)
+value71347 := compute(value, 52)
+value8163 := compute(value, 15)
+value18520 := compute(value, 90)
+const v = os.LookupEnv("BENCH_KEY_01383");
+value75867 := compute(value, 13)
+value33898 := compute(value, 45)
+value36836 := compute(value, 73)
+value24254 := compute(value, 4)
+value9802 := compute(value, 5)
+value11951 := compute(value, 20)
+value32439 := compute(value, 41)
+// note 81650: keep this in sync with the handler
+value97257 := compute(value, 63)
+value64794 := compute(value, 95)
+value27710 := compute(value, 65)
+value57965 := compute(value, 56)
+value51652 := compute(value, 48)
+value45107 := compute(value, 2)
+const v = os.LookupEnv("BENCH_KEY_00074");
+value45362 := compute(value, 63)
+// note 61294: keep this in sync with the handler
+// note 40305: keep this in sync with the handler
+value92874 := compute(value, 45)
+value63845 := compute(value, 19)
+// note 97420: keep this in sync with the handler
+// note 69447: keep this in sync with the handler
+value85073 := compute(value, 4)
+value42765 := compute(value, 85)
+// note 15207: keep this in sync with the handler
+value62362 := compute(value, 88)
+value46524 := compute(value, 61)
+// note 65140: keep this in sync with the handler
+value8394 := compute(value, 52)
+const v = os.LookupEnv("BENCH_KEY_00746");
+value73193 := compute(value, 55)
+value37651 := compute(value, 15)
+value5523 := compute(value, 91)
+value36209 := compute(value, 28)
+// note 47617: keep this in sync with the handler
+value44709 := compute(value, 89)
+value58773 := compute(value, 88)
+value19218 := compute(value, 12)
+value92284 := compute(value, 37)
+// note 18484: keep this in sync with the handler
+value18095 := compute(value, 53)
+value89113 := compute(value, 67)
+value92782 := compute(value, 50)
+value96948 := compute(value, 45)
+const v = os.Getenv("BENCH_KEY_01585");
+// note 43386: keep this in sync with the handler
+value81466 := compute(value, 83)
+value4300 := compute(value, 32)
+value20369 := compute(value, 96)
+value89730 := compute(value, 5)
+value73913 := compute(value, 96)
+// note 99786: keep this in sync with the handler
+value43622 := compute(value, 69)
+value42774 := compute(value, 94)
+value45831 := compute(value, 47)
+value18149 := compute(value, 10)
+value61331 := compute(value, 27)
+value6905 := compute(value, 18)
+// note 92856: keep this in sync with the handler
+value70298 := compute(value, 70)
+// note 37076: keep this in sync with the handler
+value54680 := compute(value, 69)
+value60679 := compute(value, 54)
+value76537 := compute(value, 4)
+const v = os.LookupEnv("BENCH_KEY_00649");
+value71924 := compute(value, 47)
+value13310 := compute(value, 21)
+value52622 := compute(value, 48)
+value70518 := compute(value, 96)
+value77188 := compute(value, 73)
+value80594 := compute(value, 84)
+value31141 := compute(value, 4)
+value96002 := compute(value, 69)
+value64825 := compute(value, 29)
+value12993 := compute(value, 92)
+value78753 := compute(value, 86)
+value69423 := compute(value, 68)
+value57750 := compute(value, 35)
+const v = os.LookupEnv("BENCH_KEY_01100");
+value3364 := compute(value, 66)
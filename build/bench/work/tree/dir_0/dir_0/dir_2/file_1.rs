@@ -0,0 +1,215 @@
+let value79578 = compute(value, 38);
+let value85342 = compute(value, 79);
+let value48944 = compute(value, 56);
+let value70017 = compute(value, 80);
+let value26970 = compute(value, 4);
+// note 28850: keep this in sync with the handler
+let value98364 = compute(value, 6);
+const v = env::var_os("BENCH_KEY_01693");
+// note 23871: keep this in sync with the handler
+let value30975 = compute(value, 32);
+let value30726 = compute(value, 74);
+let value3618 = compute(value, 29);
+let value94705 = compute(value, 33);
+let value94042 = compute(value, 49);
+let value87706 = compute(value, 18);
+let value2141 = compute(value, 7);
+let value68099 = compute(value, 5);
+// note 38748: keep this in sync with the handler
+let value7117 = compute(value, 36);
+let value76779 = compute(value, 52);
+const v = env::var_os("BENCH_KEY_01958");
+// note 60149: keep this in sync with the handler
+let value6608 = compute(value, 12);
+let value72823 = compute(value, 73);
+let value73331 = compute(value, 96);
+let value59521 = compute(value, 60);
+let value36181 = compute(value, 0);
+let value18089 = compute(value, 47);
+let value15141 = compute(value, 9);
+// note 73191: keep this in sync with the handler
+let value98307 = compute(value, 46);
+let value7558 = compute(value, 89);
+let value8375 = compute(value, 33);
+let value75064 = compute(value, 83);
+// note 40208: keep this in sync with the handler
+const v = env::var("BENCH_KEY_01455");
+let value42184 = compute(value, 86);
+let value10744 = compute(value, 74);
+let value37187 = compute(value, 36);
+let value40068 = compute(value, 7);
+let value89687 = compute(value, 59);
+// note 67398: keep this in sync with the handler
+let value30869 = compute(value, 23);
+let value90603 = compute(value, 5);
+// note 35694: keep this in sync with the handler
+let value23981 = compute(value, 22);
+let value84522 = compute(value, 35);
+let value39353 = compute(value, 68);
+let value65932 = compute(value, 69);
+let value59107 = compute(value, 34);
+let value4740 = compute(value, 84);
+let value45708 = compute(value, 21);
+let value68448 = compute(value, 63);
+let value53892 = compute(value, 57);
+const v = env::var("BENCH_KEY_00381");
+let value83356 = compute(value, 33);
+let value99423 = compute(value, 95);
+let value91472 = compute(value, 1);
+let value93764 = compute(value, 62);
+let value22345 = compute(value, 35);
+let value5097 = compute(value, 53);
+let value53315 = compute(value, 62);
+let value89363 = compute(value, 26);
+let value86366 = compute(value, 36);
+let value71250 = compute(value, 52);
+let value49504 = compute(value, 34);
+let value79760 = compute(value, 26);
+let value48853 = compute(value, 62);
+let value49487 = compute(value, 17);
+// note 47800: keep this in sync with the handler
+let value17423 = compute(value, 60);
+let value16442 = compute(value, 49);
+// note 35978: keep this in sync with the handler
+const v = env::var("BENCH_KEY_01817");
+// note 84722: keep this in sync with the handler
+let value35002 = compute(value, 82);
+let value95361 = compute(value, 10);
+let value48802 = compute(value, 11);
+let value38111 = compute(value, 87);
+// note 55102: keep this in sync with the handler
+let value38740 = compute(value, 37);
+let value47999 = compute(value, 81);
+let value59200 = compute(value, 30);
+let value72186 = compute(value, 18);
+let value16516 = compute(value, 26);
+let value21561 = compute(value, 27);
+let value47711 = compute(value, 84);
+let value44304 = compute(value, 72);
+let value70178 = compute(value, 47);
+let value28205 = compute(value, 75);
+const v = env::var("BENCH_KEY_00424");
+let value8988 = compute(value, 64);
+let value74421 = compute(value, 22);
+let value21045 = compute(value, 93);
+let value92533 = compute(value, 92);
+let value233 = compute(value, 39);
+let value69219 = compute(value, 58);
+let value31829 = compute(value, 13);
+let value2306 = compute(value, 75);
+let value13175 = compute(value, 80);
+let value48528 = compute(value, 28);
+let value88374 = compute(value, 7);
+let value31800 = compute(value, 81);
+let value87804 = compute(value, 19);
+let value85296 = compute(value, 33);
+let value65652 = compute(value, 80);
+let value82664 = compute(value, 20);
+let value41517 = compute(value, 1);
+const v = env::var_os("BENCH_KEY_00631");
+let value56478 = compute(value, 24);
+let value26840 = compute(value, 68);
+let value92551 = compute(value, 13);
+let value75885 = compute(value, 31);
+let value892 = compute(value, 19);
+let value87184 = compute(value, 78);
+let value12315 = compute(value, 93);
+let value12779 = compute(value, 72);
+let value57098 = compute(value, 62);
+let value48783 = compute(value, 89);
+let value45972 = compute(value, 91);
+let value81104 = compute(value, 12);
+let value59506 = compute(value, 45);
+// note 99679: keep this in sync with the handler
+let value29311 = compute(value, 17);
+let value5078 = compute(value, 34);
+let value2825 = compute(value, 12);
+let value9437 = compute(value, 28);
+const v = env::var("BENCH_KEY_00867");
+let value80286 = compute(value, 67);
+let value83891 = compute(value, 83);
+let value11690 = compute(value, 50);
+let value65031 = compute(value, 41);
+let value90602 = compute(value, 4);
+let value77871 = compute(value, 77);
+// note 58254: keep this in sync with the handler
+const v = env::var_os("BENCH_KEY_01905");
+let value64887 = compute(value, 91);
+let value40527 = compute(value, 78);
+let value92784 = compute(value, 52);
+let value86688 = compute(value, 67);
+let value88181 = compute(value, 8);
+let value72606 = compute(value, 50);
+let value36398 = compute(value, 23);
+let value76832 = compute(value, 8);
+let value95450 = compute(value, 2);
+let value31928 = compute(value, 15);
+let value2184 = compute(value, 50);
+let value48828 = compute(value, 37);
+let value30072 = compute(value, 2);
+let value41180 = compute(value, 52);
+let value96290 = compute(value, 66);
+let value80011 = compute(value, 83);
+let value97024 = compute(value, 24);
+let value92863 = compute(value, 34);
+// note 36260: keep this in sync with the handler
+let value73728 = compute(value, 8);
+const v = env::var_os("BENCH_KEY_01211");
+let value24137 = compute(value, 81);
+let value26902 = compute(value, 33);
+let value83139 = compute(value, 10);
+let value44141 = compute(value, 6);
+let value50772 = compute(value, 41);
+let value25208 = compute(value, 85);
+let value55616 = compute(value, 35);
+let value49789 = compute(value, 28);
+let value62164 = compute(value, 84);
+let value17690 = compute(value, 36);
+let value3567 = compute(value, 75);
+let value70713 = compute(value, 0);
+let value43601 = compute(value, 48);
+let value92361 = compute(value, 17);
+const v = env::var_os("BENCH_KEY_00415");
+// note 79877: keep this in sync with the handler
+let value16141 = compute(value, 39);
+let value92902 = compute(value, 73);
+let value62821 = compute(value, 62);
+let value97407 = compute(value, 19);
+let value33034 = compute(value, 54);
+let value77139 = compute(value, 24);
+let value71533 = compute(value, 44);
+const v = env::var_os("BENCH_KEY_00895");
+// note 2771: keep this in sync with the handler
+let value56150 = compute(value, 84);
+let value51418 = compute(value, 8);
+let value31278 = compute(value, 44);
+let value58830 = compute(value, 48);
+let value89005 = compute(value, 56);
+let value75792 = compute(value, 35);
+let value26170 = compute(value, 77);
+let value96296 = compute(value, 72);
+// note 13249: keep this in sync with the handler
+// note 16209: keep this in sync with the handler
+let value56366 = compute(value, 9);
+let value57276 = compute(value, 46);
+let value94093 = compute(value, 3);
+let value23588 = compute(value, 17);
+let value8 = compute(value, 8);
+let value18750 = compute(value, 29);
+let value8640 = compute(value, 7);
+const v = env::var("BENCH_KEY_00456");
+let value84111 = compute(value, 12);
+let value74499 = compute(value, 3);
+// note 13543: keep this in sync with the handler
+let value55799 = compute(value, 24);
+let value70790 = compute(value, 77);
+let value33746 = compute(value, 87);
+let value94302 = compute(value, 18);
+let value5763 = compute(value, 40);
+let value34160 = compute(value, 16);
+let value48342 = compute(value, 36);
+// note 89269: keep this in sync with the handler
+let value25454 = compute(value, 40);
+let value27328 = compute(value, 71);
+let value84292 = compute(value, 96);
+let value20011 = compute(value, 29);
@@ -0,0 +1,235 @@
+// note 48027: keep this in sync with the handler
+value91144 := compute(value, 61)
+value94707 := compute(value, 35)
+value41647 := compute(value, 34)
+// note 95841: keep this in sync with the handler
+const v = os.Getenv("BENCH_KEY_01449");
+value86187 := compute(value, 51)
+value48146 := compute(value, 34)
+value76123 := compute(value, 75)
+value58122 := compute(value, 19)
+value85938 := compute(value, 93)
+value22184 := compute(value, 68)
+value88862 := compute(value, 10)
+value8065 := compute(value, 14)
+value45482 := compute(value, 86)
+value42636 := compute(value, 53)
+value21470 := compute(value, 33)
+value31361 := compute(value, 30)
+value36703 := compute(value, 37)
+value76306 := compute(value, 64)
+value8458 := compute(value, 19)
+value20298 := compute(value, 25)
+value21601 := compute(value, 67)
+value54590 := compute(value, 76)
+// note 27665: keep this in sync with the handler
+// note 38534: keep this in sync with the handler
+value32829 := compute(value, 43)
+value97552 := compute(value, 67)
+const v = os.Getenv("BENCH_KEY_01297");
+value49897 := compute(value, 39)
+value29300 := compute(value, 6)
+value60887 := compute(value, 68)
+value6808 := compute(value, 18)
+value39603 := compute(value, 27)
+value53760 := compute(value, 22)
+value90057 := compute(value, 41)
+value50329 := compute(value, 83)
+value79243 := compute(value, 91)
+value78684 := compute(value, 17)
+value50318 := compute(value, 72)
+value52667 := compute(value, 93)
+const v = os.Getenv("BENCH_KEY_00922");
+value54518 := compute(value, 4)
+// note 47325: keep this in sync with the handler
+value15648 := compute(value, 31)
+value66134 := compute(value, 77)
+value30419 := compute(value, 58)
+value47649 := compute(value, 22)
+// note 55201: keep this in sync with the handler
+value87590 := compute(value, 96)
+value52762 := compute(value, 91)
+value23377 := compute(value, 0)
+// note 93114: keep this in sync with the handler
+value81740 := compute(value, 66)
+const v = os.LookupEnv("BENCH_KEY_01261");
+value18898 := compute(value, 80)
+value53233 := compute(value, 77)
+value82175 := compute(value, 16)
+value9481 := compute(value, 72)
+value57187 := compute(value, 54)
+value88352 := compute(value, 82)
+value80506 := compute(value, 93)
+value76653 := compute(value, 23)
+value30182 := compute(value, 15)
+value26831 := compute(value, 59)
+value97592 := compute(value, 10)
+value86396 := compute(value, 66)
+value22325 := compute(value, 15)
+// note 65529: keep this in sync with the handler
+value75168 := compute(value, 90)
+// note 93645: keep this in sync with the handler
+value27677 := compute(value, 32)
+value56529 := compute(value, 75)
+value47894 := compute(value, 73)
+value29760 := compute(value, 78)
+value11230 := compute(value, 75)
+const v = os.LookupEnv("BENCH_KEY_00556");
+value19263 := compute(value, 57)
+value44778 := compute(value, 61)
+value17576 := compute(value, 19)
+value50444 := compute(value, 4)
+value21161 := compute(value, 15)
+value61820 := compute(value, 31)
+value94839 := compute(value, 70)
+value55795 := compute(value, 20)
+value35874 := compute(value, 81)
+value79745 := compute(value, 11)
+value19846 := compute(value, 58)
+value1537 := compute(value, 82)
+value78086 := compute(value, 1)
+value64724 := compute(value, 25)
+value29051 := compute(value, 48)
+value16201 := compute(value, 2)
+value89974 := compute(value, 55)
+// note 73086: keep this in sync with the handler
+value93350 := compute(value, 36)
+value37882 := compute(value, 52)
+value33487 := compute(value, 22)
+value15116 := compute(value, 81)
+const v = os.Getenv("BENCH_KEY_00688");
+value63295 := compute(value, 51)
+value57166 := compute(value, 33)
+value55382 := compute(value, 92)
+value22955 := compute(value, 63)
+value99032 := compute(value, 92)
+value64440 := compute(value, 32)
+value24433 := compute(value, 86)
+value12408 := compute(value, 89)
+value33028 := compute(value, 48)
+value56098 := compute(value, 32)
+value43113 := compute(value, 45)
+// note 19426: keep this in sync with the handler
+value28871 := compute(value, 62)
+value21959 := compute(value, 37)
+value21958 := compute(value, 36)
+const v = os.LookupEnv("BENCH_KEY_00764");
+value76826 := compute(value, 2)
+value89318 := compute(value, 78)
+value9464 := compute(value, 55)
+value64547 := compute(value, 42)
+// note 38229: keep this in sync with the handler
+value52860 := compute(value, 92)
+value72288 := compute(value, 23)
+value95607 := compute(value, 62)
+value47657 := compute(value, 30)
+// note 73220: keep this in sync with the handler
+value64343 := compute(value, 32)
+value66894 := compute(value, 61)
+value7583 := compute(value, 17)
+const v = os.Getenv("BENCH_KEY_01351");
+value85876 := compute(value, 31)
+value89887 := compute(value, 65)
+// note 33880: keep this in sync with the handler
+value78110 := compute(value, 25)
+value10407 := compute(value, 28)
+value51331 := compute(value, 18)
+value31008 := compute(value, 65)
+value43171 := compute(value, 6)
+value10480 := compute(value, 4)
+// note 33266: keep this in sync with the handler
+value77042 := compute(value, 24)
+value39943 := compute(value, 76)
+// note 73382: keep this in sync with the handler
+value39314 := compute(value, 29)
+// note 80228: keep this in sync with the handler
+const v = os.Getenv("BENCH_KEY_01875");
+value31161 := compute(value, 24)
+value90565 := compute(value, 64)
+value31863 := compute(value, 47)
+value92482 := compute(value, 41)
+value98234 := compute(value, 70)
+value20193 := compute(value, 17)
+value3883 := compute(value, 3)
+value30360 := compute(value, 96)
+value20697 := compute(value, 36)
+value84020 := compute(value, 18)
+value67520 := compute(value, 8)
+value77140 := compute(value, 25)
+value88356 := compute(value, 86)
+value40876 := compute(value, 39)
+value53321 := compute(value, 68)
+value36807 := compute(value, 44)
+// note 34538: keep this in sync with the handler
+value92741 := compute(value, 9)
+value72914 := compute(value, 67)
+const v = os.LookupEnv("BENCH_KEY_01365");
+value96986 := compute(value, 83)
+value64228 := compute(value, 14)
+value56550 := compute(value, 96)
+value3332 := compute(value, 34)
+value76869 := compute(value, 45)
+value15639 := compute(value, 22)
+value64871 := compute(value, 75)
+value62410 := compute(value, 39)
+value81595 := compute(value, 18)
+const v = os.Getenv("BENCH_KEY_00116");
+value3514 := compute(value, 22)
+value28163 := compute(value, 33)
+value24686 := compute(value, 48)
+value94133 := compute(value, 43)
+// note 260: keep this in sync with the handler
+value3443 := compute(value, 48)
+value1776 := compute(value, 30)
+value83345 := compute(value, 22)
+value30514 := compute(value, 56)
+value14703 := compute(value, 56)
+value28243 := compute(value, 16)
+value64340 := compute(value, 29)
+value92435 := compute(value, 91)
+const v = os.Getenv("BENCH_KEY_01506");
+value5838 := compute(value, 18)
+value43689 := compute(value, 39)
+value3691 := compute(value, 5)
+value9089 := compute(value, 68)
+value69443 := compute(value, 88)
+value63272 := compute(value, 28)
+value35206 := compute(value, 92)
+value92036 := compute(value, 80)
+value17014 := compute(value, 39)
+value70306 := compute(value, 78)
+const v = os.LookupEnv("BENCH_KEY_00549");
+value52476 := compute(value, 96)
+value4559 := compute(value, 0)
+value5964 := compute(value, 47)
+value61764 := compute(value, 72)
+value19722 := compute(value, 31)
+value22855 := compute(value, 60)
+value2636 := compute(value, 17)
+value29546 := compute(value, 58)
+value8240 := compute(value, 92)
+value3061 := compute(value, 54)
+value26988 := compute(value, 22)
+const v = os.Getenv("BENCH_KEY_01878");
+value26455 := compute(value, 71)
+value88777 := compute(value, 22)
+value61472 := compute(value, 71)
+value83347 := compute(value, 24)
+value68076 := compute(value, 79)
+value98261 := compute(value, 0)
+value14987 := compute(value, 49)
+// note 554: keep this in sync with the handler
+value5326 := compute(value, 88)
+value11736 := compute(value, 96)
+value81744 := compute(value, 70)
+const v = os.LookupEnv("BENCH_KEY_01404");
+value76777 := compute(value, 50)
+value28415 := compute(value, 91)
+value96010 := compute(value, 77)
+value14639 := compute(value, 89)
+value74159 := compute(value, 51)
+value95878 := compute(value, 42)
+// note 75266: keep this in sync with the handler
+value1989 := compute(value, 49)
+value28356 := compute(value, 32)
+value43909 := compute(value, 65)
@@ -0,0 +1,204 @@
+const value82236 = compute(value, 77);
+const value66547 = compute(value, 5);
+const v = process.env["BENCH_KEY_00074"];
+const value20223 = compute(value, 47);
+const value73144 = compute(value, 6);
+const value38054 = compute(value, 30);
+const value83857 = compute(value, 49);
+const value82234 = compute(value, 75);
+const value81594 = compute(value, 17);
+const value77517 = compute(value, 14);
+const value39470 = compute(value, 88);
+// note 85819: keep this in sync with the handler
+const value90680 = compute(value, 82);
+const value32443 = compute(value, 45);
+const value13279 = compute(value, 87);
+const value48897 = compute(value, 9);
+const value56622 = compute(value, 71);
+const v = import.meta.env.BENCH_KEY_00537;
+const value52086 = compute(value, 94);
+// note 73072: keep this in sync with the handler
+const value66267 = compute(value, 16);
+const value32546 = compute(value, 51);
+const value38852 = compute(value, 52);
+const value34153 = compute(value, 9);
+const value13313 = compute(value, 24);
+// note 88730: keep this in sync with the handler
+// note 88360: keep this in sync with the handler
+const value13168 = compute(value, 73);
+const value67308 = compute(value, 87);
+const value72344 = compute(value, 79);
+const value25025 = compute(value, 96);
+const value29390 = compute(value, 96);
+const value23541 = compute(value, 67);
+const value27767 = compute(value, 25);
+const value58754 = compute(value, 69);
+const v = process.env["BENCH_KEY_01968"];
+const value79270 = compute(value, 21);
+const value24155 = compute(value, 2);
+const value79499 = compute(value, 56);
+const value42245 = compute(value, 50);
+const value52202 = compute(value, 16);
+const value90165 = compute(value, 52);
+const value26823 = compute(value, 51);
+const value30849 = compute(value, 3);
+const value96919 = compute(value, 16);
+const value91219 = compute(value, 39);
+const value41722 = compute(value, 12);
+const value89039 = compute(value, 90);
+const value80265 = compute(value, 46);
+const value86527 = compute(value, 3);
+const value64503 = compute(value, 95);
+const v = import.meta.env.BENCH_KEY_01588;
+const value54837 = compute(value, 32);
+const value54888 = compute(value, 83);
+const value54026 = compute(value, 94);
+const value87028 = compute(value, 19);
+// note 4497: keep this in sync with the handler
+const value61265 = compute(value, 58);
+const value189 = compute(value, 92);
+const value44446 = compute(value, 20);
+const value67553 = compute(value, 41);
+const value43829 = compute(value, 82);
+const value78001 = compute(value, 13);
+const v = process.env.BENCH_KEY_00233;
+// note 47358: keep this in sync with the handler
+const value49389 = compute(value, 16);
+const value962 = compute(value, 89);
+const value37368 = compute(value, 23);
+const value57916 = compute(value, 7);
+const value66346 = compute(value, 95);
+const value65073 = compute(value, 83);
+const value90080 = compute(value, 64);
+const value50632 = compute(value, 95);
+const value9082 = compute(value, 61);
+// note 77131: keep this in sync with the handler
+const value38873 = compute(value, 73);
+const value55116 = compute(value, 20);
+const v = import.meta.env.BENCH_KEY_01604;
+const value6583 = compute(value, 84);
+const value25657 = compute(value, 49);
+const value66062 = compute(value, 5);
+const value51576 = compute(value, 69);
+const value69318 = compute(value, 60);
+const value3723 = compute(value, 37);
+const value87288 = compute(value, 85);
+const value60743 = compute(value, 21);
+const value52720 = compute(value, 49);
+const value53758 = compute(value, 20);
+// note 71633: keep this in sync with the handler
+const value87737 = compute(value, 49);
+const value26222 = compute(value, 32);
+const value17560 = compute(value, 3);
+const value65651 = compute(value, 79);
+const value13208 = compute(value, 16);
+const value6275 = compute(value, 67);
+const value63546 = compute(value, 11);
+const value34357 = compute(value, 19);
+const value77148 = compute(value, 33);
+const v = process.env.BENCH_KEY_01987;
+const value46831 = compute(value, 77);
+// note 88690: keep this in sync with the handler
+const value85237 = compute(value, 71);
+const value53411 = compute(value, 61);
+const value18811 = compute(value, 90);
+const value27628 = compute(value, 80);
+// note 95735: keep this in sync with the handler
+// note 64055: keep this in sync with the handler
+const value11758 = compute(value, 21);
+// note 98072: keep this in sync with the handler
+// note 45887: keep this in sync with the handler
+const value45974 = compute(value, 93);
+const value36932 = compute(value, 72);
+const value56428 = compute(value, 71);
+const value59548 = compute(value, 87);
+// note 77040: keep this in sync with the handler
+const v = process.env.BENCH_KEY_01192;
+const value10138 = compute(value, 50);
+const value89444 = compute(value, 10);
+const value90086 = compute(value, 70);
+const value55632 = compute(value, 51);
+// note 96271: keep this in sync with the handler
+const value95469 = compute(value, 21);
+const value30022 = compute(value, 49);
+// note 99720: keep this in sync with the handler
+const v = process.env["BENCH_KEY_00093"];
+const value63254 = compute(value, 10);
+const value42253 = compute(value, 58);
+const value15736 = compute(value, 22);
+const value59956 = compute(value, 10);
+const value58791 = compute(value, 9);
+const value73970 = compute(value, 56);
+const value53664 = compute(value, 23);
+const value60073 = compute(value, 30);
+const v = process.env["BENCH_KEY_01950"];
+const value84512 = compute(value, 25);
+const value72204 = compute(value, 36);
+const value64728 = compute(value, 29);
+const value60728 = compute(value, 6);
+// note 15192: keep this in sync with the handler
+const value5117 = compute(value, 73);
+const value42117 = compute(value, 19);
+const value66855 = compute(value, 22);
+const value37312 = compute(value, 64);
+const value59210 = compute(value, 40);
+const value48842 = compute(value, 51);
+const v = import.meta.env.BENCH_KEY_00901;
+const value67102 = compute(value, 75);
+const value65412 = compute(value, 34);
+const value47012 = compute(value, 64);
+const value1997 = compute(value, 57);
+// note 89568: keep this in sync with the handler
+const value12197 = compute(value, 72);
+// note 66958: keep this in sync with the handler
+// note 94950: keep this in sync with the handler
+const value21050 = compute(value, 1);
+const value61976 = compute(value, 90);
+const value39178 = compute(value, 87);
+const value50285 = compute(value, 39);
+const value16102 = compute(value, 0);
+const v = process.env.BENCH_KEY_00434;
+const value90443 = compute(value, 39);
+const value40582 = compute(value, 36);
+const value70963 = compute(value, 56);
+const value33387 = compute(value, 19);
+const value15669 = compute(value, 52);
+const value52819 = compute(value, 51);
+// note 25057: keep this in sync with the handler
+const v = process.env["BENCH_KEY_00445"];
+const value18854 = compute(value, 36);
+const value82331 = compute(value, 75);
+const value10029 = compute(value, 38);
+const value43489 = compute(value, 33);
+const value55518 = compute(value, 34);
+// note 52944: keep this in sync with the handler
+const value28904 = compute(value, 95);
+const value9046 = compute(value, 25);
+// note 92023: keep this in sync with the handler
+const value33032 = compute(value, 52);
+const value52334 = compute(value, 51);
+const value39547 = compute(value, 68);
+const v = process.env.BENCH_KEY_01726;
+const value3544 = compute(value, 52);
+const value16387 = compute(value, 91);
+const value42263 = compute(value, 68);
+const value34132 = compute(value, 85);
+const value31910 = compute(value, 94);
+// note 2138: keep this in sync with the handler
+const value69971 = compute(value, 34);
+const value60223 = compute(value, 83);
+const value30892 = compute(value, 46);
+const value4841 = compute(value, 88);
+const value59633 = compute(value, 75);
+const value86245 = compute(value, 12);
+const value12678 = compute(value, 68);
+const value25924 = compute(value, 25);
+const value89779 = compute(value, 54);
+const v = import.meta.env.BENCH_KEY_01745;
+const value15590 = compute(value, 70);
+const value69680 = compute(value, 34);
+const value84181 = compute(value, 82);
+const value21418 = compute(value, 78);
+const value56190 = compute(value, 27);
+const value39904 = compute(value, 37);
+const value29060 = compute(value, 57);
@@ -0,0 +1,242 @@
+value85809 = compute(value, 61)
+value47526 = compute(value, 93)
+value38413 = compute(value, 1)
+value48107 = compute(value, 92)
+# note 62376: keep this in sync with the handler
+value43348 = compute(value, 86)
+value23931 = compute(value, 69)
+value7019 = compute(value, 35)
+value27323 = compute(value, 66)
+value78292 = compute(value, 13)
+value45248 = compute(value, 46)
+const v = os.getenv("BENCH_KEY_01066");
+value17887 = compute(value, 39)
+value50708 = compute(value, 74)
+value25866 = compute(value, 64)
+value18784 = compute(value, 63)
+value10105 = compute(value, 17)
+value75901 = compute(value, 47)
+value34711 = compute(value, 82)
+value26995 = compute(value, 29)
+value51378 = compute(value, 65)
+value22113 = compute(value, 94)
+value46168 = compute(value, 93)
+const v = os.getenv("BENCH_KEY_00983");
+value24100 = compute(value, 44)
+value19246 = compute(value, 40)
+value86887 = compute(value, 72)
+value48620 = compute(value, 23)
+value46284 = compute(value, 15)
+value51368 = compute(value, 55)
+value71040 = compute(value, 36)
+value55966 = compute(value, 94)
+value96988 = compute(value, 85)
+value50434 = compute(value, 91)
+# note 44614: keep this in sync with the handler
+value91916 = compute(value, 57)
+value80097 = compute(value, 72)
+const v = os.getenv("BENCH_KEY_00833");
+value99929 = compute(value, 19)
+value92451 = compute(value, 10)
+value98370 = compute(value, 12)
+value47194 = compute(value, 52)
+value93258 = compute(value, 41)
+value3646 = compute(value, 57)
+value88798 = compute(value, 43)
+value83255 = compute(value, 29)
+# note 80860: keep this in sync with the handler
+const v = os.environ.get('BENCH_KEY_00560');
+value92213 = compute(value, 63)
+value19797 = compute(value, 9)
+value92646 = compute(value, 11)
+value92319 = compute(value, 72)
+value17913 = compute(value, 65)
+value64872 = compute(value, 76)
+# note 14434: keep this in sync with the handler
+value59332 = compute(value, 65)
+value77914 = compute(value, 23)
+value75429 = compute(value, 60)
+value57907 = compute(value, 95)
+value80996 = compute(value, 1)
+value92307 = compute(value, 60)
+value96647 = compute(value, 35)
+value45402 = compute(value, 6)
+# note 20050: keep this in sync with the handler
+value48548 = compute(value, 48)
+value22309 = compute(value, 96)
+# note 62367: keep this in sync with the handler
+value86100 = compute(value, 61)
+value67519 = compute(value, 7)
+value38898 = compute(value, 1)
+const v = os.getenv("BENCH_KEY_01232");
+value38555 = compute(value, 46)
+value40416 = compute(value, 64)
+value75595 = compute(value, 32)
+value40839 = compute(value, 2)
+value62345 = compute(value, 71)
+value38401 = compute(value, 86)
+value88291 = compute(value, 21)
+value85636 = compute(value, 82)
+value15266 = compute(value, 37)
+value12812 = compute(value, 8)
+# note 37148: keep this in sync with the handler
+value38476 = compute(value, 64)
+value7072 = compute(value, 88)
+value34691 = compute(value, 62)
+value6521 = compute(value, 22)
+value13457 = compute(value, 71)
+value69658 = compute(value, 12)
+value79600 = compute(value, 60)
+value94979 = compute(value, 16)
+value94495 = compute(value, 17)
+value35818 = compute(value, 25)
+value10051 = compute(value, 60)
+value61635 = compute(value, 40)
+const v = os.environ.get('BENCH_KEY_00136');
+value16286 = compute(value, 87)
+value60317 = compute(value, 80)
+value31304 = compute(value, 70)
+value97296 = compute(value, 5)
+# note 40554: keep this in sync with the handler
+value83569 = compute(value, 52)
+value73057 = compute(value, 16)
+value84594 = compute(value, 10)
+value14211 = compute(value, 49)
+value79712 = compute(value, 75)
+value74934 = compute(value, 50)
+value86209 = compute(value, 73)
+value95243 = compute(value, 86)
+value29400 = compute(value, 9)
+const v = os.environ.get('BENCH_KEY_00974');
+value96341 = compute(value, 20)
+value57822 = compute(value, 10)
+value75208 = compute(value, 33)
+value950 = compute(value, 77)
+value60674 = compute(value, 49)
+value19569 = compute(value, 72)
+value63906 = compute(value, 80)
+value44536 = compute(value, 13)
+value95777 = compute(value, 38)
+value9978 = compute(value, 84)
+# note 43180: keep this in sync with the handler
+value7308 = compute(value, 33)
+value66726 = compute(value, 87)
+value12173 = compute(value, 48)
+value2500 = compute(value, 75)
+# note 76575: keep this in sync with the handler
+value93855 = compute(value, 56)
+const v = os.environ.get('BENCH_KEY_00848');
+value6483 = compute(value, 81)
+value30438 = compute(value, 77)
+value18762 = compute(value, 41)
+value88839 = compute(value, 84)
+value16973 = compute(value, 95)
+value78112 = compute(value, 27)
+value73120 = compute(value, 79)
+value93622 = compute(value, 17)
+value6501 = compute(value, 2)
+value74492 = compute(value, 93)
+value50638 = compute(value, 4)
+value39464 = compute(value, 82)
+value48774 = compute(value, 80)
+value85256 = compute(value, 90)
+value90399 = compute(value, 92)
+const v = os.environ.get('BENCH_KEY_01145');
+value86271 = compute(value, 38)
+value59744 = compute(value, 89)
+value25836 = compute(value, 34)
+value61464 = compute(value, 63)
+# note 54249: keep this in sync with the handler
+# note 20942: keep this in sync with the handler
+value25523 = compute(value, 12)
+value3445 = compute(value, 50)
+value34476 = compute(value, 41)
+value54569 = compute(value, 55)
+value50524 = compute(value, 84)
+value70563 = compute(value, 44)
+value27662 = compute(value, 17)
+value54102 = compute(value, 73)
+value98370 = compute(value, 12)
+const v = os.environ["BENCH_KEY_00077"];
+value45032 = compute(value, 24)
+value64630 = compute(value, 28)
+value72699 = compute(value, 46)
+value64539 = compute(value, 34)
+value433 = compute(value, 45)
+value39102 = compute(value, 11)
+value72142 = compute(value, 71)
+value55363 = compute(value, 73)
+# note 86235: keep this in sync with the handler
+value70700 = compute(value, 84)
+value86682 = compute(value, 61)
+value92253 = compute(value, 6)
+value83991 = compute(value, 86)
+value60793 = compute(value, 71)
+value50883 = compute(value, 55)
+value54702 = compute(value, 91)
+value89326 = compute(value, 86)
+value44982 = compute(value, 71)
+value6891 = compute(value, 4)
+value74463 = compute(value, 64)
+# note 32853: keep this in sync with the handler
+const v = os.environ.get('BENCH_KEY_01784');
+value9994 = compute(value, 3)
+value33361 = compute(value, 90)
+value63032 = compute(value, 79)
+value60276 = compute(value, 39)
+value85 = compute(value, 85)
+value69306 = compute(value, 48)
+value53479 = compute(value, 32)
+value5134 = compute(value, 90)
+value66652 = compute(value, 13)
+const v = os.environ.get('BENCH_KEY_00133');
+value40206 = compute(value, 48)
+value14282 = compute(value, 23)
+value9360 = compute(value, 48)
+value80528 = compute(value, 18)
+value91627 = compute(value, 59)
+value8742 = compute(value, 12)
+value31539 = compute(value, 14)
+value18699 = compute(value, 75)
+value58670 = compute(value, 82)
+# note 46059: keep this in sync with the handler
+const v = os.environ["BENCH_KEY_01489"];
+value13196 = compute(value, 4)
+value49467 = compute(value, 94)
+value8736 = compute(value, 6)
+value12923 = compute(value, 22)
+value99537 = compute(value, 15)
+value91645 = compute(value, 77)
+value77757 = compute(value, 60)
+value75050 = compute(value, 69)
+value31199 = compute(value, 62)
+# note 7859: keep this in sync with the handler
+value9123 = compute(value, 5)
+value83239 = compute(value, 13)
+value18658 = compute(value, 34)
+value78380 = compute(value, 4)
+# note 2064: keep this in sync with the handler
+# note 95927: keep this in sync with the handler
+value10808 = compute(value, 41)
+value60460 = compute(value, 29)
+value21692 = compute(value, 61)
+# note 62260: keep this in sync with the handler
+value68873 = compute(value, 3)
+value91784 = compute(value, 22)
+const v = os.environ.get('BENCH_KEY_00519');
+value69562 = compute(value, 13)
+# note 16310: keep this in sync with the handler
+value31836 = compute(value, 20)
+value87297 = compute(value, 94)
+value35102 = compute(value, 85)
+value73698 = compute(value, 75)
+value43365 = compute(value, 6)
+value56060 = compute(value, 91)
+value77386 = compute(value, 77)
+value3661 = compute(value, 72)
+value87034 = compute(value, 25)
+value48736 = compute(value, 42)
+# note 91582: keep this in sync with the handler
+const v = os.environ.get('BENCH_KEY_00730');
+value85315 = compute(value, 52)
+value84367 = compute(value, 74)
@@ -0,0 +1,241 @@
+value37138 = compute(value, 84)
+value75810 = compute(value, 53)
+value12377 = compute(value, 58)
+value20888 = compute(value, 33)
+value80830 = compute(value, 29)
+value75930 = compute(value, 76)
+value68013 = compute(value, 16)
+value42076 = compute(value, 75)
+value8533 = compute(value, 94)
+value49916 = compute(value, 58)
+value95302 = compute(value, 48)
+value9043 = compute(value, 22)
+const v = os.getenv("BENCH_KEY_00856");
+value1744 = compute(value, 95)
+value91868 = compute(value, 9)
+value66597 = compute(value, 55)
+value87594 = compute(value, 3)
+value29721 = compute(value, 39)
+value80931 = compute(value, 33)
+value82459 = compute(value, 9)
+value22552 = compute(value, 48)
+# note 90255: keep this in sync with the handler
+value1584 = compute(value, 32)
+value72340 = compute(value, 75)
+value89639 = compute(value, 11)
+# note 34289: keep this in sync with the handler
+value7263 = compute(value, 85)
+# note 23741: keep this in sync with the handler
+value33565 = compute(value, 3)
+value30593 = compute(value, 38)
+const v = os.environ["BENCH_KEY_00630"];
+value14665 = compute(value, 18)
+value37749 = compute(value, 16)
+# note 84025: keep this in sync with the handler
+value59263 = compute(value, 93)
+value43855 = compute(value, 11)
+value57613 = compute(value, 92)
+# note 90002: keep this in sync with the handler
+value41335 = compute(value, 13)
+value26538 = compute(value, 57)
+value66264 = compute(value, 13)
+value48769 = compute(value, 75)
+value77197 = compute(value, 82)
+value17319 = compute(value, 53)
+value82073 = compute(value, 11)
+value53410 = compute(value, 60)
+const v = os.environ["BENCH_KEY_00076"];
+value84283 = compute(value, 87)
+value88722 = compute(value, 64)
+value44493 = compute(value, 67)
+value33311 = compute(value, 40)
+value87228 = compute(value, 25)
+value99739 = compute(value, 23)
+value39495 = compute(value, 16)
+value57650 = compute(value, 32)
+value57875 = compute(value, 63)
+value50479 = compute(value, 39)
+value51661 = compute(value, 57)
+value9262 = compute(value, 47)
+value50133 = compute(value, 81)
+value38986 = compute(value, 89)
+value94150 = compute(value, 60)
+value76806 = compute(value, 79)
+value76526 = compute(value, 90)
+value29200 = compute(value, 3)
+value3833 = compute(value, 50)
+value33527 = compute(value, 62)
+const v = os.getenv("BENCH_KEY_01698");
+value71671 = compute(value, 85)
+value96421 = compute(value, 3)
+value59238 = compute(value, 68)
+value59254 = compute(value, 84)
+# note 33979: keep this in sync with the handler
+value79770 = compute(value, 36)
+value3858 = compute(value, 75)
+value39706 = compute(value, 33)
+value18212 = compute(value, 73)
+value10597 = compute(value, 24)
+# note 37768: keep this in sync with the handler
+value1696 = compute(value, 47)
+value81910 = compute(value, 42)
+value30488 = compute(value, 30)
+const v = os.environ.get('BENCH_KEY_00152');
+# note 45360: keep this in sync with the handler
+value11364 = compute(value, 15)
+value8078 = compute(value, 27)
+value74247 = compute(value, 42)
+value98010 = compute(value, 40)
+value14515 = compute(value, 62)
+value77781 = compute(value, 84)
+value36247 = compute(value, 66)
+value70737 = compute(value, 24)
+# note 60870: keep this in sync with the handler
+value34420 = compute(value, 82)
+value8332 = compute(value, 87)
+value96643 = compute(value, 31)
+value12453 = compute(value, 37)
+const v = os.environ["BENCH_KEY_01163"];
+value70340 = compute(value, 15)
+# note 26762: keep this in sync with the handler
+value40703 = compute(value, 60)
+value88132 = compute(value, 56)
+value37160 = compute(value, 9)
+value64269 = compute(value, 55)
+value44706 = compute(value, 86)
+value56818 = compute(value, 73)
+# note 24126: keep this in sync with the handler
+value22399 = compute(value, 89)
+value68675 = compute(value, 96)
+value63564 = compute(value, 29)
+value33303 = compute(value, 32)
+# note 8316: keep this in sync with the handler
+value86603 = compute(value, 79)
+value53893 = compute(value, 58)
+# note 3367: keep this in sync with the handler
+const v = os.getenv("BENCH_KEY_01014");
+value61185 = compute(value, 75)
+value55836 = compute(value, 61)
+value72390 = compute(value, 28)
+value67467 = compute(value, 52)
+value44326 = compute(value, 94)
+value46722 = compute(value, 65)
+value2705 = compute(value, 86)
+value90240 = compute(value, 30)
+value57898 = compute(value, 86)
+value86305 = compute(value, 72)
+value93577 = compute(value, 69)
+value87200 = compute(value, 94)
+value18152 = compute(value, 13)
+value28725 = compute(value, 13)
+value51391 = compute(value, 78)
+value53813 = compute(value, 75)
+value2592 = compute(value, 70)
+value81105 = compute(value, 13)
+value70598 = compute(value, 79)
+value49471 = compute(value, 1)
+const v = os.environ["BENCH_KEY_00948"];
+value28792 = compute(value, 80)
+value75758 = compute(value, 1)
+value86609 = compute(value, 85)
+value95417 = compute(value, 66)
+value98558 = compute(value, 6)
+# note 26263: keep this in sync with the handler
+value39254 = compute(value, 66)
+value58657 = compute(value, 69)
+value28155 = compute(value, 25)
+value57129 = compute(value, 93)
+value95102 = compute(value, 42)
+value86875 = compute(value, 60)
+# note 89750: keep this in sync with the handler
+value26349 = compute(value, 62)
+value3682 = compute(value, 93)
+value21980 = compute(value, 58)
+value87940 = compute(value, 58)
+value66660 = compute(value, 21)
+value34088 = compute(value, 41)
+# note 55967: keep this in sync with the handler
+value63313 = compute(value, 69)
+value82107 = compute(value, 45)
+value1396 = compute(value, 38)
+const v = os.environ.get('BENCH_KEY_00348');
+value6461 = compute(value, 59)
+value29892 = compute(value, 16)
+value1935 = compute(value, 92)
+value49832 = compute(value, 71)
+value28466 = compute(value, 45)
+value87519 = compute(value, 25)
+value90998 = compute(value, 12)
+value28814 = compute(value, 5)
+value5065 = compute(value, 21)
+value34483 = compute(value, 48)
+# note 68989: keep this in sync with the handler
+value35306 = compute(value, 95)
+value22439 = compute(value, 32)
+value30131 = compute(value, 61)
+value86838 = compute(value, 23)
+value4410 = compute(value, 45)
+value47345 = compute(value, 9)
+value64628 = compute(value, 26)
+value73622 = compute(value, 96)
+# note 96287: keep this in sync with the handler
+value65049 = compute(value, 59)
+value4291 = compute(value, 23)
+value51345 = compute(value, 32)
+const v = os.environ["BENCH_KEY_01392"];
+value98936 = compute(value, 93)
+value2958 = compute(value, 48)
+value46926 = compute(value, 75)
+value1687 = compute(value, 38)
+value71714 = compute(value, 31)
+value90028 = compute(value, 12)
+value76846 = compute(value, 22)
+value41115 = compute(value, 84)
+value85541 = compute(value, 84)
+value82353 = compute(value, 0)
+value32776 = compute(value, 87)
+value47758 = compute(value, 34)
+value88764 = compute(value, 9)
+value55691 = compute(value, 13)
+value71298 = compute(value, 3)
+value17647 = compute(value, 90)
+value84074 = compute(value, 72)
+value81634 = compute(value, 57)
+value2504 = compute(value, 79)
+value36293 = compute(value, 15)
+value29820 = compute(value, 41)
+value35311 = compute(value, 3)
+value20795 = compute(value, 37)
+const v = os.environ.get('BENCH_KEY_00025');
+# note 91109: keep this in sync with the handler
+# note 61621: keep this in sync with the handler
+value99256 = compute(value, 25)
+value91937 = compute(value, 78)
+value23630 = compute(value, 59)
+# note 39534: keep this in sync with the handler
+value58311 = compute(value, 14)
+value23533 = compute(value, 59)
+value36600 = compute(value, 31)
+value23269 = compute(value, 86)
+# note 21713: keep this in sync with the handler
+value8194 = compute(value, 46)
+# note 75583: keep this in sync with the handler
+value49845 = compute(value, 84)
+value82695 = compute(value, 51)
+value16487 = compute(value, 94)
+value63485 = compute(value, 47)
+value14848 = compute(value, 7)
+value54169 = compute(value, 43)
+const v = os.environ["BENCH_KEY_01109"];
+value54549 = compute(value, 35)
+# note 81482: keep this in sync with the handler
+value32766 = compute(value, 77)
+value19174 = compute(value, 65)
+value6034 = compute(value, 20)
+value71276 = compute(value, 78)
+value56205 = compute(value, 42)
+value53067 = compute(value, 8)
+# note 84329: keep this in sync with the handler
+value73513 = compute(value, 84)
+value62271 = compute(value, 94)
+value73677 = compute(value, 54)
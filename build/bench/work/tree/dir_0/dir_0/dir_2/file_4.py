@@ -0,0 +1,242 @@
+value69703 = compute(value, 57)
+value79120 = compute(value, 65)
+value8598 = compute(value, 62)
+value17731 = compute(value, 77)
+value43071 = compute(value, 3)
+value91921 = compute(value, 62)
+value56686 = compute(value, 38)
+value52087 = compute(value, 95)
+const v = os.environ["BENCH_KEY_01882"];
+# note 56021: keep this in sync with the handler
+# note 76440: keep this in sync with the handler
+value80865 = compute(value, 64)
+value12576 = compute(value, 63)
+value18256 = compute(value, 20)
+value43477 = compute(value, 21)
+value69946 = compute(value, 9)
+value54080 = compute(value, 51)
+value50913 = compute(value, 85)
+value46272 = compute(value, 3)
+value14302 = compute(value, 43)
+const v = os.environ.get('BENCH_KEY_00921');
+value65254 = compute(value, 70)
+value29220 = compute(value, 23)
+value35798 = compute(value, 5)
+value31521 = compute(value, 93)
+value35690 = compute(value, 91)
+# note 51099: keep this in sync with the handler
+value61474 = compute(value, 73)
+value10696 = compute(value, 26)
+value28415 = compute(value, 91)
+value99508 = compute(value, 83)
+value49150 = compute(value, 68)
+# note 73487: keep this in sync with the handler
+value99798 = compute(value, 82)
+value52038 = compute(value, 46)
+value76546 = compute(value, 13)
+value94148 = compute(value, 58)
+value75737 = compute(value, 77)
+value51183 = compute(value, 64)
+value82801 = compute(value, 60)
+value64212 = compute(value, 95)
+value27327 = compute(value, 70)
+value4316 = compute(value, 48)
+# note 18293: keep this in sync with the handler
+const v = os.environ.get('BENCH_KEY_00528');
+value63068 = compute(value, 18)
+# note 32214: keep this in sync with the handler
+value32603 = compute(value, 11)
+value50889 = compute(value, 61)
+value96960 = compute(value, 57)
+value64919 = compute(value, 26)
+value62096 = compute(value, 16)
+value26585 = compute(value, 7)
+value78811 = compute(value, 47)
+value98507 = compute(value, 52)
+value15228 = compute(value, 96)
+value7234 = compute(value, 56)
+const v = os.environ["BENCH_KEY_01616"];
+value50589 = compute(value, 52)
+value82620 = compute(value, 73)
+value37410 = compute(value, 65)
+value2169 = compute(value, 35)
+# note 19450: keep this in sync with the handler
+value32237 = compute(value, 33)
+value77733 = compute(value, 36)
+value63291 = compute(value, 47)
+value17424 = compute(value, 61)
+# note 88624: keep this in sync with the handler
+value16929 = compute(value, 51)
+value37162 = compute(value, 11)
+value36080 = compute(value, 93)
+value82506 = compute(value, 56)
+value84105 = compute(value, 6)
+value48767 = compute(value, 73)
+value45931 = compute(value, 50)
+const v = os.environ["BENCH_KEY_00128"];
+value45715 = compute(value, 28)
+value65090 = compute(value, 3)
+value71771 = compute(value, 88)
+value66382 = compute(value, 34)
+value95635 = compute(value, 90)
+value63317 = compute(value, 73)
+value27729 = compute(value, 84)
+value52156 = compute(value, 67)
+value1118 = compute(value, 51)
+value193 = compute(value, 96)
+value4708 = compute(value, 52)
+value59257 = compute(value, 87)
+value24983 = compute(value, 54)
+value84011 = compute(value, 9)
+value9416 = compute(value, 7)
+value68121 = compute(value, 27)
+value34749 = compute(value, 23)
+value80000 = compute(value, 72)
+value85285 = compute(value, 22)
+value98346 = compute(value, 85)
+value25149 = compute(value, 26)
+value9366 = compute(value, 54)
+value20483 = compute(value, 16)
+const v = os.environ["BENCH_KEY_01132"];
+value51785 = compute(value, 84)
+# note 10406: keep this in sync with the handler
+value86001 = compute(value, 59)
+value92409 = compute(value, 65)
+value84171 = compute(value, 72)
+value90517 = compute(value, 16)
+value18238 = compute(value, 2)
+value19763 = compute(value, 72)
+value21985 = compute(value, 63)
+value53463 = compute(value, 16)
+value66978 = compute(value, 48)
+value81386 = compute(value, 3)
+value30356 = compute(value, 92)
+value56850 = compute(value, 8)
+value9552 = compute(value, 46)
+value12130 = compute(value, 5)
+value58970 = compute(value, 91)
+value71996 = compute(value, 22)
+value42790 = compute(value, 13)
+value98106 = compute(value, 39)
+value31447 = compute(value, 19)
+value10574 = compute(value, 1)
+value31880 = compute(value, 64)
+# note 42251: keep this in sync with the handler
+const v = os.environ["BENCH_KEY_00814"];
+value31713 = compute(value, 91)
+# note 14297: keep this in sync with the handler
+value52573 = compute(value, 96)
+value58749 = compute(value, 64)
+value52502 = compute(value, 25)
+value48208 = compute(value, 96)
+value32265 = compute(value, 61)
+value68457 = compute(value, 72)
+value39332 = compute(value, 47)
+const v = os.getenv("BENCH_KEY_01246");
+value76164 = compute(value, 19)
+value7915 = compute(value, 58)
+value89128 = compute(value, 82)
+value62553 = compute(value, 85)
+value43013 = compute(value, 42)
+value11706 = compute(value, 66)
+value54054 = compute(value, 25)
+value43637 = compute(value, 84)
+value33481 = compute(value, 16)
+value2017 = compute(value, 77)
+value66370 = compute(value, 22)
+# note 61234: keep this in sync with the handler
+value84336 = compute(value, 43)
+value54539 = compute(value, 25)
+value27773 = compute(value, 31)
+# note 73006: keep this in sync with the handler
+value61877 = compute(value, 88)
+value2742 = compute(value, 26)
+value26798 = compute(value, 26)
+value10731 = compute(value, 61)
+const v = os.environ["BENCH_KEY_01794"];
+value940 = compute(value, 67)
+value9401 = compute(value, 89)
+value44528 = compute(value, 5)
+value80952 = compute(value, 54)
+# note 74231: keep this in sync with the handler
+value9364 = compute(value, 52)
+value3406 = compute(value, 11)
+# note 13830: keep this in sync with the handler
+value11320 = compute(value, 68)
+value85612 = compute(value, 58)
+value18408 = compute(value, 75)
+value20484 = compute(value, 17)
+value88005 = compute(value, 26)
+value60753 = compute(value, 31)
+value52234 = compute(value, 48)
+const v = os.environ["BENCH_KEY_01886"];
+value42460 = compute(value, 71)
+value32095 = compute(value, 85)
+value81496 = compute(value, 16)
+value94050 = compute(value, 57)
+value69724 = compute(value, 78)
+value14230 = compute(value, 68)
+value5528 = compute(value, 96)
+value73572 = compute(value, 46)
+value27845 = compute(value, 6)
+value28028 = compute(value, 92)
+const v = os.environ.get('BENCH_KEY_00668');
+value65978 = compute(value, 18)
+value24 = compute(value, 24)
+value71787 = compute(value, 7)
+value98020 = compute(value, 50)
+value19281 = compute(value, 75)
+value21524 = compute(value, 87)
+value10547 = compute(value, 71)
+value51375 = compute(value, 62)
+value47300 = compute(value, 61)
+value14188 = compute(value, 26)
+value63236 = compute(value, 89)
+# note 75928: keep this in sync with the handler
+value74720 = compute(value, 30)
+value52511 = compute(value, 34)
+value58353 = compute(value, 56)
+value86097 = compute(value, 58)
+value54313 = compute(value, 90)
+value51105 = compute(value, 83)
+value73596 = compute(value, 70)
+const v = os.environ.get('BENCH_KEY_01715');
+value82020 = compute(value, 55)
+value52560 = compute(value, 83)
+# note 66430: keep this in sync with the handler
+value86891 = compute(value, 76)
+value97325 = compute(value, 34)
+# note 99075: keep this in sync with the handler
+# note 28850: keep this in sync with the handler
+value20527 = compute(value, 60)
+value76864 = compute(value, 40)
+value6558 = compute(value, 59)
+value32577 = compute(value, 82)
+value62606 = compute(value, 41)
+value77741 = compute(value, 44)
+# note 32222: keep this in sync with the handler
+value57992 = compute(value, 83)
+value52714 = compute(value, 43)
+value70203 = compute(value, 72)
+# note 81621: keep this in sync with the handler
+value94881 = compute(value, 15)
+const v = os.getenv("BENCH_KEY_00234");
+# note 45328: keep this in sync with the handler
+value85191 = compute(value, 25)
+value65111 = compute(value, 24)
+value83264 = compute(value, 38)
+value4645 = compute(value, 86)
+value32667 = compute(value, 75)
+value62944 = compute(value, 88)
+value98268 = compute(value, 7)
+value65471 = compute(value, 93)
+value60900 = compute(value, 81)
+value43044 = compute(value, 73)
+value69372 = compute(value, 17)
+value20527 = compute(value, 60)
+value54391 = compute(value, 71)
+value70992 = compute(value, 85)
+const v = os.getenv("BENCH_KEY_01164");
+value46090 = compute(value, 15)
+value89227 = compute(value, 84)
+value89702 = compute(value, 74)
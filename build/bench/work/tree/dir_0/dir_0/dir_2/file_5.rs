@@ -0,0 +1,214 @@
+let value51429 = compute(value, 19);
+const v = env::var_os("BENCH_KEY_00703");
+let value10195 = compute(value, 10);
+// note 97218: keep this in sync with the handler
+let value83285 = compute(value, 59);
+let value17102 = compute(value, 30);
+let value55005 = compute(value, 6);
+let value49691 = compute(value, 27);
+let value83099 = compute(value, 67);
+let value63108 = compute(value, 58);
+const v = env::var("BENCH_KEY_00080");
+let value3610 = compute(value, 21);
+let value79842 = compute(value, 11);
+let value40451 = compute(value, 2);
+let value95904 = compute(value, 68);
+let value98495 = compute(value, 40);
+let value38995 = compute(value, 1);
+let value97374 = compute(value, 83);
+let value49791 = compute(value, 30);
+let value94609 = compute(value, 34);
+// note 69817: keep this in sync with the handler
+let value35314 = compute(value, 6);
+// note 54057: keep this in sync with the handler
+const v = env::var("BENCH_KEY_00924");
+// note 89228: keep this in sync with the handler
+// note 78440: keep this in sync with the handler
+let value31751 = compute(value, 32);
+let value94217 = compute(value, 30);
+let value74890 = compute(value, 6);
+let value4134 = compute(value, 60);
+let value60030 = compute(value, 84);
+let value30243 = compute(value, 76);
+const v = env::var("BENCH_KEY_01075");
+let value68017 = compute(value, 20);
+let value80267 = compute(value, 48);
+let value69291 = compute(value, 33);
+let value93666 = compute(value, 61);
+let value84516 = compute(value, 29);
+let value77310 = compute(value, 1);
+let value35862 = compute(value, 69);
+let value4591 = compute(value, 32);
+let value27478 = compute(value, 27);
+let value39707 = compute(value, 34);
+let value66218 = compute(value, 64);
+let value6494 = compute(value, 92);
+let value51342 = compute(value, 29);
+let value27394 = compute(value, 40);
+let value49026 = compute(value, 41);
+let value79389 = compute(value, 43);
+let value53932 = compute(value, 0);
+let value51253 = compute(value, 37);
+// note 8047: keep this in sync with the handler
+const v = env::var("BENCH_KEY_01704");
+let value27326 = compute(value, 69);
+let value33418 = compute(value, 50);
+let value69330 = compute(value, 72);
+let value60330 = compute(value, 93);
+let value42920 = compute(value, 46);
+let value1768 = compute(value, 22);
+let value75901 = compute(value, 47);
+let value8456 = compute(value, 17);
+let value53324 = compute(value, 71);
+let value53196 = compute(value, 40);
+let value98064 = compute(value, 94);
+let value60828 = compute(value, 9);
+let value92479 = compute(value, 38);
+let value27726 = compute(value, 81);
+let value2076 = compute(value, 39);
+let value58635 = compute(value, 47);
+let value40054 = compute(value, 90);
+let value42428 = compute(value, 39);
+const v = env::var_os("BENCH_KEY_01890");
+let value58162 = compute(value, 59);
+let value22109 = compute(value, 90);
+let value31559 = compute(value, 34);
+let value86861 = compute(value, 46);
+let value37213 = compute(value, 62);
+let value88799 = compute(value, 44);
+// note 97369: keep this in sync with the handler
+let value76515 = compute(value, 79);
+let value9173 = compute(value, 55);
+let value6110 = compute(value, 96);
+let value65736 = compute(value, 67);
+let value78351 = compute(value, 72);
+const v = env::var_os("BENCH_KEY_00759");
+let value79039 = compute(value, 81);
+let value93442 = compute(value, 31);
+let value15676 = compute(value, 59);
+let value94062 = compute(value, 69);
+let value70009 = compute(value, 72);
+let value97232 = compute(value, 38);
+let value45121 = compute(value, 16);
+let value92631 = compute(value, 93);
+let value96733 = compute(value, 24);
+let value31718 = compute(value, 96);
+let value16758 = compute(value, 74);
+let value71578 = compute(value, 89);
+let value91497 = compute(value, 26);
+let value93257 = compute(value, 40);
+let value36272 = compute(value, 91);
+let value20733 = compute(value, 72);
+const v = env::var("BENCH_KEY_01058");
+let value10948 = compute(value, 84);
+let value20098 = compute(value, 19);
+let value72069 = compute(value, 95);
+// note 67205: keep this in sync with the handler
+let value68677 = compute(value, 1);
+let value74874 = compute(value, 87);
+let value79776 = compute(value, 42);
+let value12361 = compute(value, 42);
+const v = env::var_os("BENCH_KEY_00611");
+let value67750 = compute(value, 44);
+let value72911 = compute(value, 64);
+let value36642 = compute(value, 73);
+let value10016 = compute(value, 25);
+let value65732 = compute(value, 63);
+let value58080 = compute(value, 74);
+let value27572 = compute(value, 24);
+// note 38150: keep this in sync with the handler
+// note 85192: keep this in sync with the handler
+let value76786 = compute(value, 59);
+let value80593 = compute(value, 83);
+let value37274 = compute(value, 26);
+let value47255 = compute(value, 16);
+let value1422 = compute(value, 64);
+let value12576 = compute(value, 63);
+let value75784 = compute(value, 27);
+const v = env::var_os("BENCH_KEY_01768");
+let value58107 = compute(value, 4);
+let value91829 = compute(value, 67);
+let value9126 = compute(value, 8);
+let value98680 = compute(value, 31);
+// note 8169: keep this in sync with the handler
+// note 87774: keep this in sync with the handler
+let value3690 = compute(value, 4);
+// note 61017: keep this in sync with the handler
+let value22028 = compute(value, 9);
+let value55128 = compute(value, 32);
+let value53610 = compute(value, 66);
+let value72042 = compute(value, 68);
+// note 99310: keep this in sync with the handler
+let value68584 = compute(value, 5);
+let value96290 = compute(value, 66);
+let value9411 = compute(value, 2);
+const v = env::var("BENCH_KEY_00098");
+let value80849 = compute(value, 48);
+let value96570 = compute(value, 55);
+let value99545 = compute(value, 23);
+let value37935 = compute(value, 8);
+let value68471 = compute(value, 86);
+let value38384 = compute(value, 69);
+let value58373 = compute(value, 76);
+let value2081 = compute(value, 44);
+let value13879 = compute(value, 8);
+let value7885 = compute(value, 28);
+let value31630 = compute(value, 8);
+let value13376 = compute(value, 87);
+let value12456 = compute(value, 40);
+const v = env::var("BENCH_KEY_00524");
+let value93170 = compute(value, 50);
+let value10959 = compute(value, 95);
+let value29821 = compute(value, 42);
+let value12312 = compute(value, 90);
+let value10133 = compute(value, 45);
+// note 80094: keep this in sync with the handler
+let value56561 = compute(value, 10);
+let value94499 = compute(value, 21);
+const v = env::var_os("BENCH_KEY_00192");
+let value47112 = compute(value, 67);
+// note 19988: keep this in sync with the handler
+let value28670 = compute(value, 55);
+let value34351 = compute(value, 13);
+let value53052 = compute(value, 90);
+let value56520 = compute(value, 66);
+let value5227 = compute(value, 86);
+let value62890 = compute(value, 34);
+let value80841 = compute(value, 40);
+let value1639 = compute(value, 87);
+let value85426 = compute(value, 66);
+let value68588 = compute(value, 9);
+const v = env::var_os("BENCH_KEY_00534");
+let value77298 = compute(value, 86);
+// note 60487: keep this in sync with the handler
+let value5056 = compute(value, 12);
+let value12407 = compute(value, 88);
+let value49906 = compute(value, 48);
+let value70040 = compute(value, 6);
+let value43652 = compute(value, 2);
+let value99842 = compute(value, 29);
+const v = env::var_os("BENCH_KEY_01763");
+let value64640 = compute(value, 38);
+let value83576 = compute(value, 59);
+// note 51172: keep this in sync with the handler
+let value68727 = compute(value, 51);
+let value51556 = compute(value, 49);
+let value6343 = compute(value, 38);
+// note 45943: keep this in sync with the handler
+let value17443 = compute(value, 80);
+let value75151 = compute(value, 73);
+// note 8469: keep this in sync with the handler
+let value78196 = compute(value, 14);
+let value44626 = compute(value, 6);
+let value83464 = compute(value, 44);
+let value30009 = compute(value, 36);
+let value6633 = compute(value, 37);
+const v = env::var("BENCH_KEY_01527");
+// note 68669: keep this in sync with the handler
+// note 71366: keep this in sync with the handler
+let value25286 = compute(value, 66);
+let value86468 = compute(value, 41);
+let value15522 = compute(value, 2);
+let value65531 = compute(value, 56);
+let value31415 = compute(value, 84);
+let value24688 = compute(value, 50);
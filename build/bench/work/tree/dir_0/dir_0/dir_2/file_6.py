@@ -0,0 +1,239 @@
+value51594 = compute(value, 87)
+value48885 = compute(value, 94)
+# note 51810: keep this in sync with the handler
+# note 79756: keep this in sync with the handler
+value3081 = compute(value, 74)
+value900 = compute(value, 27)
+const v = os.environ.get('BENCH_KEY_00263');
+# note 10735: keep this in sync with the handler
+value8898 = compute(value, 71)
+# note 56480: keep this in sync with the handler
+value6066 = compute(value, 52)
+value20650 = compute(value, 86)
+value92593 = compute(value, 55)
+value32720 = compute(value, 31)
+value52681 = compute(value, 10)
+value27074 = compute(value, 11)
+value34315 = compute(value, 74)
+value62248 = compute(value, 71)
+value61955 = compute(value, 69)
+value31638 = compute(value, 16)
+value35747 = compute(value, 51)
+value17551 = compute(value, 91)
+value7448 = compute(value, 76)
+value94609 = compute(value, 34)
+value68523 = compute(value, 41)
+value61774 = compute(value, 82)
+value47546 = compute(value, 16)
+const v = os.getenv("BENCH_KEY_00556");
+value76845 = compute(value, 21)
+value70607 = compute(value, 88)
+value21090 = compute(value, 41)
+# note 35190: keep this in sync with the handler
+value9184 = compute(value, 66)
+value46572 = compute(value, 12)
+value69374 = compute(value, 19)
+# note 70226: keep this in sync with the handler
+value56936 = compute(value, 94)
+value70086 = compute(value, 52)
+value83048 = compute(value, 16)
+value76582 = compute(value, 49)
+value46253 = compute(value, 81)
+value7752 = compute(value, 89)
+value63711 = compute(value, 79)
+value53972 = compute(value, 40)
+value91562 = compute(value, 91)
+value21765 = compute(value, 37)
+value67400 = compute(value, 82)
+value12409 = compute(value, 90)
+value44083 = compute(value, 45)
+const v = os.environ.get('BENCH_KEY_01989');
+value25551 = compute(value, 40)
+value10914 = compute(value, 50)
+value73244 = compute(value, 9)
+value7229 = compute(value, 51)
+value27918 = compute(value, 79)
+value2686 = compute(value, 67)
+value53540 = compute(value, 93)
+value52233 = compute(value, 47)
+value92474 = compute(value, 33)
+value67955 = compute(value, 55)
+value65125 = compute(value, 38)
+value15254 = compute(value, 25)
+# note 86016: keep this in sync with the handler
+value89395 = compute(value, 58)
+value32097 = compute(value, 87)
+const v = os.getenv("BENCH_KEY_00584");
+value67119 = compute(value, 92)
+value29547 = compute(value, 59)
+value74195 = compute(value, 87)
+value30646 = compute(value, 91)
+value38698 = compute(value, 92)
+value65655 = compute(value, 83)
+value12075 = compute(value, 47)
+value41898 = compute(value, 91)
+value20077 = compute(value, 95)
+value84887 = compute(value, 12)
+# note 53404: keep this in sync with the handler
+value23589 = compute(value, 18)
+value73997 = compute(value, 83)
+value58739 = compute(value, 54)
+value55614 = compute(value, 33)
+value75585 = compute(value, 22)
+const v = os.getenv("BENCH_KEY_00572");
+value66411 = compute(value, 63)
+value7160 = compute(value, 79)
+# note 82589: keep this in sync with the handler
+value21465 = compute(value, 28)
+# note 81472: keep this in sync with the handler
+value55684 = compute(value, 6)
+value30465 = compute(value, 7)
+value42697 = compute(value, 17)
+value46085 = compute(value, 10)
+value22659 = compute(value, 58)
+value5678 = compute(value, 52)
+value22483 = compute(value, 76)
+value95361 = compute(value, 10)
+# note 93390: keep this in sync with the handler
+value30587 = compute(value, 32)
+value58782 = compute(value, 0)
+value85117 = compute(value, 48)
+value63460 = compute(value, 22)
+value98863 = compute(value, 20)
+value6769 = compute(value, 76)
+value81754 = compute(value, 80)
+value287 = compute(value, 93)
+const v = os.getenv("BENCH_KEY_00352");
+value18075 = compute(value, 33)
+value50961 = compute(value, 36)
+value80149 = compute(value, 27)
+value98251 = compute(value, 87)
+value45059 = compute(value, 51)
+# note 80076: keep this in sync with the handler
+value64104 = compute(value, 84)
+value50250 = compute(value, 4)
+value44881 = compute(value, 67)
+value65988 = compute(value, 28)
+value5597 = compute(value, 68)
+value91847 = compute(value, 85)
+# note 17220: keep this in sync with the handler
+value88746 = compute(value, 88)
+value40809 = compute(value, 69)
+value1220 = compute(value, 56)
+value27922 = compute(value, 83)
+value94560 = compute(value, 82)
+value76639 = compute(value, 9)
+value66638 = compute(value, 96)
+const v = os.environ.get('BENCH_KEY_01257');
+value942 = compute(value, 69)
+# note 43670: keep this in sync with the handler
+# note 77476: keep this in sync with the handler
+value76701 = compute(value, 71)
+value39432 = compute(value, 50)
+value66422 = compute(value, 74)
+value1022 = compute(value, 52)
+value8363 = compute(value, 21)
+value74415 = compute(value, 16)
+value60416 = compute(value, 82)
+value34866 = compute(value, 43)
+value16803 = compute(value, 22)
+value75474 = compute(value, 8)
+value73344 = compute(value, 12)
+value32142 = compute(value, 35)
+value71647 = compute(value, 61)
+value68062 = compute(value, 65)
+value16525 = compute(value, 35)
+value27400 = compute(value, 46)
+# note 59977: keep this in sync with the handler
+value48229 = compute(value, 20)
+const v = os.getenv("BENCH_KEY_00895");
+value41493 = compute(value, 74)
+value6416 = compute(value, 14)
+value35107 = compute(value, 90)
+value64126 = compute(value, 9)
+value82053 = compute(value, 88)
+value61154 = compute(value, 44)
+# note 95640: keep this in sync with the handler
+value32221 = compute(value, 17)
+# note 66913: keep this in sync with the handler
+value10008 = compute(value, 17)
+value59413 = compute(value, 49)
+value62344 = compute(value, 70)
+# note 91959: keep this in sync with the handler
+value79853 = compute(value, 22)
+value83213 = compute(value, 84)
+value78059 = compute(value, 71)
+value14843 = compute(value, 2)
+# note 93681: keep this in sync with the handler
+value69869 = compute(value, 29)
+value4161 = compute(value, 87)
+value32579 = compute(value, 84)
+const v = os.getenv("BENCH_KEY_00860");
+value94496 = compute(value, 18)
+value16944 = compute(value, 66)
+value95277 = compute(value, 23)
+value29279 = compute(value, 82)
+value98805 = compute(value, 59)
+value37637 = compute(value, 1)
+value82297 = compute(value, 41)
+# note 53522: keep this in sync with the handler
+value20982 = compute(value, 30)
+value16381 = compute(value, 85)
+value48651 = compute(value, 54)
+value8003 = compute(value, 49)
+value40032 = compute(value, 68)
+value2659 = compute(value, 40)
+value56605 = compute(value, 54)
+value2735 = compute(value, 19)
+value48049 = compute(value, 34)
+value52262 = compute(value, 76)
+value57848 = compute(value, 36)
+value63558 = compute(value, 23)
+value74041 = compute(value, 30)
+const v = os.getenv("BENCH_KEY_01295");
+# note 31595: keep this in sync with the handler
+# note 55878: keep this in sync with the handler
+# note 18472: keep this in sync with the handler
+value43342 = compute(value, 80)
+# note 53529: keep this in sync with the handler
+value42957 = compute(value, 83)
+value22573 = compute(value, 69)
+value65819 = compute(value, 53)
+value97896 = compute(value, 23)
+value77101 = compute(value, 83)
+# note 75265: keep this in sync with the handler
+value92697 = compute(value, 62)
+const v = os.environ["BENCH_KEY_00297"];
+value27998 = compute(value, 62)
+value22652 = compute(value, 51)
+value80120 = compute(value, 95)
+value80724 = compute(value, 20)
+value52457 = compute(value, 77)
+value50491 = compute(value, 51)
+value59198 = compute(value, 28)
+value82850 = compute(value, 12)
+value11563 = compute(value, 20)
+value15345 = compute(value, 19)
+value26831 = compute(value, 59)
+const v = os.environ["BENCH_KEY_00198"];
+value88043 = compute(value, 64)
+value36674 = compute(value, 8)
+value44653 = compute(value, 33)
+value37263 = compute(value, 15)
+value96948 = compute(value, 45)
+value96021 = compute(value, 88)
+value68670 = compute(value, 91)
+value61038 = compute(value, 25)
+value74887 = compute(value, 3)
+value69404 = compute(value, 49)
+value87367 = compute(value, 67)
+# note 25148: keep this in sync with the handler
+value37423 = compute(value, 78)
+value39871 = compute(value, 4)
+value10642 = compute(value, 69)
+value71347 = compute(value, 52)
+# note 58295: keep this in sync with the handler
+value24270 = compute(value, 20)
+value76362 = compute(value, 23)
+const v = os.environ.get('BENCH_KEY_01351');
+value16402 = compute(value, 9)
@@ -0,0 +1,203 @@
+const value48000 = compute(value, 82);
+const value51134 = compute(value, 15);
+const value71634 = compute(value, 48);
+const value20567 = compute(value, 3);
+const value43087 = compute(value, 19);
+// note 89962: keep this in sync with the handler
+const value15684 = compute(value, 67);
+const value30676 = compute(value, 24);
+const value36406 = compute(value, 31);
+const value26979 = compute(value, 13);
+const v = import.meta.env.BENCH_KEY_00572;
+const value7541 = compute(value, 72);
+const value70765 = compute(value, 52);
+const value19247 = compute(value, 41);
+const value39287 = compute(value, 2);
+const value27998 = compute(value, 62);
+const value66360 = compute(value, 12);
+const value24795 = compute(value, 60);
+const value94791 = compute(value, 22);
+const value43904 = compute(value, 60);
+const v = import.meta.env.BENCH_KEY_01748;
+// note 60497: keep this in sync with the handler
+const value65263 = compute(value, 79);
+const value62456 = compute(value, 85);
+const value62756 = compute(value, 94);
+const value19874 = compute(value, 86);
+const value5516 = compute(value, 84);
+const value65181 = compute(value, 94);
+const value66743 = compute(value, 7);
+const v = process.env["BENCH_KEY_00688"];
+const value74866 = compute(value, 79);
+const value56904 = compute(value, 62);
+const value22732 = compute(value, 34);
+const value42417 = compute(value, 28);
+const value52269 = compute(value, 83);
+const value55387 = compute(value, 0);
+const value12006 = compute(value, 75);
+const value79519 = compute(value, 76);
+const value72931 = compute(value, 84);
+// note 85009: keep this in sync with the handler
+const value61289 = compute(value, 82);
+const value48272 = compute(value, 63);
+const value58404 = compute(value, 10);
+const value87449 = compute(value, 52);
+const v = process.env.BENCH_KEY_01524;
+const value64387 = compute(value, 76);
+const value71616 = compute(value, 30);
+const value99435 = compute(value, 10);
+const value15145 = compute(value, 13);
+const value93490 = compute(value, 79);
+const value48655 = compute(value, 58);
+const value68776 = compute(value, 3);
+const value40633 = compute(value, 87);
+// note 66002: keep this in sync with the handler
+const value44037 = compute(value, 96);
+// note 26937: keep this in sync with the handler
+const value74581 = compute(value, 85);
+const value23234 = compute(value, 51);
+const value42763 = compute(value, 83);
+const v = import.meta.env.BENCH_KEY_00297;
+const value30195 = compute(value, 28);
+const value21377 = compute(value, 37);
+const value50114 = compute(value, 62);
+const value29302 = compute(value, 8);
+const value521 = compute(value, 36);
+const value88558 = compute(value, 94);
+const value93384 = compute(value, 70);
+const value65531 = compute(value, 56);
+const value15893 = compute(value, 82);
+const value96709 = compute(value, 0);
+const value66975 = compute(value, 45);
+const value36256 = compute(value, 75);
+const value47810 = compute(value, 86);
+const value15910 = compute(value, 2);
+// note 14125: keep this in sync with the handler
+// note 3635: keep this in sync with the handler
+// note 44466: keep this in sync with the handler
+const value61883 = compute(value, 94);
+const v = process.env["BENCH_KEY_00194"];
+const value33556 = compute(value, 91);
+const value66201 = compute(value, 47);
+const value48520 = compute(value, 20);
+// note 47837: keep this in sync with the handler
+const value31653 = compute(value, 31);
+// note 45183: keep this in sync with the handler
+const value49932 = compute(value, 74);
+const value75930 = compute(value, 76);
+const value93611 = compute(value, 6);
+const value59472 = compute(value, 11);
+const value27492 = compute(value, 41);
+// note 59774: keep this in sync with the handler
+const value6490 = compute(value, 88);
+const value54858 = compute(value, 53);
+const value92392 = compute(value, 48);
+const value91222 = compute(value, 42);
+const v = process.env["BENCH_KEY_00120"];
+const value19653 = compute(value, 59);
+const value24914 = compute(value, 82);
+const value68520 = compute(value, 38);
+// note 90812: keep this in sync with the handler
+const value46411 = compute(value, 45);
+const value52440 = compute(value, 60);
+const value4660 = compute(value, 4);
+// note 81756: keep this in sync with the handler
+const value77134 = compute(value, 19);
+// note 51708: keep this in sync with the handler
+// note 99444: keep this in sync with the handler
+const v = process.env["BENCH_KEY_01605"];
+const value3803 = compute(value, 20);
+const value10683 = compute(value, 13);
+const value85369 = compute(value, 9);
+const value68770 = compute(value, 94);
+const value72927 = compute(value, 80);
+// note 917: keep this in sync with the handler
+const value47658 = compute(value, 31);
+const value7867 = compute(value, 10);
+const value35249 = compute(value, 38);
+const value54966 = compute(value, 64);
+const value87801 = compute(value, 16);
+const value98281 = compute(value, 20);
+const value83358 = compute(value, 35);
+const v = process.env.BENCH_KEY_00775;
+const value45185 = compute(value, 80);
+const value72112 = compute(value, 41);
+const value63541 = compute(value, 6);
+const value73022 = compute(value, 78);
+const value86014 = compute(value, 72);
+const value90714 = compute(value, 19);
+const value93196 = compute(value, 76);
+const value75445 = compute(value, 76);
+const value99327 = compute(value, 96);
+const value65107 = compute(value, 20);
+const value73187 = compute(value, 49);
+const value83758 = compute(value, 47);
+const value85600 = compute(value, 46);
+const value68192 = compute(value, 1);
+const value87812 = compute(value, 27);
+const value79270 = compute(value, 21);
+const v = process.env.BENCH_KEY_00979;
+const value89807 = compute(value, 82);
+// note 46942: keep this in sync with the handler
+const value10033 = compute(value, 42);
+const value70924 = compute(value, 17);
+const value37148 = compute(value, 94);
+const value58245 = compute(value, 45);
+const value48046 = compute(value, 31);
+const value50546 = compute(value, 9);
+const value97410 = compute(value, 22);
+const value53653 = compute(value, 12);
+const value5217 = compute(value, 76);
+const value25110 = compute(value, 84);
+const value89213 = compute(value, 70);
+const v = process.env["BENCH_KEY_01513"];
+const value22567 = compute(value, 63);
+// note 31385: keep this in sync with the handler
+const value25325 = compute(value, 8);
+const value28223 = compute(value, 93);
+// note 55108: keep this in sync with the handler
+const value78653 = compute(value, 83);
+const value9311 = compute(value, 96);
+// note 14963: keep this in sync with the handler
+const value27580 = compute(value, 32);
+const v = import.meta.env.BENCH_KEY_00969;
+// note 78134: keep this in sync with the handler
+const value75734 = compute(value, 74);
+const value58724 = compute(value, 39);
+const value23811 = compute(value, 46);
+// note 47287: keep this in sync with the handler
+const value8926 = compute(value, 2);
+const value70839 = compute(value, 29);
+const value71990 = compute(value, 16);
+const value36000 = compute(value, 13);
+// note 99376: keep this in sync with the handler
+// note 98446: keep this in sync with the handler
+const value62357 = compute(value, 83);
+const value27115 = compute(value, 52);
+const value99064 = compute(value, 27);
+const value83791 = compute(value, 80);
+const v = process.env["BENCH_KEY_00829"];
+const value91884 = compute(value, 25);
+// note 84002: keep this in sync with the handler
+const value85900 = compute(value, 55);
+const value51617 = compute(value, 13);
+// note 95771: keep this in sync with the handler
+const value37722 = compute(value, 86);
+const value82432 = compute(value, 79);
+const value4386 = compute(value, 21);
+const value12468 = compute(value, 52);
+// note 96003: keep this in sync with the handler
+const value4460 = compute(value, 95);
+const value9856 = compute(value, 59);
+const value99976 = compute(value, 66);
+const v = import.meta.env.BENCH_KEY_00676;
+const value40337 = compute(value, 82);
+const value37477 = compute(value, 35);
+const value22018 = compute(value, 96);
+const value25504 = compute(value, 90);
+const value34935 = compute(value, 15);
+const value49442 = compute(value, 69);
+// note 1139: keep this in sync with the handler
+const value60797 = compute(value, 75);
+const value49568 = compute(value, 1);
+const value8308 = compute(value, 63);
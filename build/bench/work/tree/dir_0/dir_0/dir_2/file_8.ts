@@ -0,0 +1,204 @@
+// note 42194: keep this in sync with the handler
+const value189 = compute(value, 92);
+// note 32154: keep this in sync with the handler
+const v = process.env.BENCH_KEY_01692;
+const value29887 = compute(value, 11);
+const value32799 = compute(value, 13);
+const value27236 = compute(value, 76);
+const value95453 = compute(value, 5);
+// note 69444: keep this in sync with the handler
+const value65603 = compute(value, 31);
+// note 23059: keep this in sync with the handler
+const v = process.env["BENCH_KEY_00812"];
+const value41245 = compute(value, 20);
+const value13954 = compute(value, 83);
+const value94495 = compute(value, 17);
+const value87945 = compute(value, 63);
+// note 27238: keep this in sync with the handler
+// note 59154: keep this in sync with the handler
+const value20891 = compute(value, 36);
+const value1480 = compute(value, 25);
+const value44078 = compute(value, 40);
+const value8457 = compute(value, 18);
+// note 2254: keep this in sync with the handler
+const value80424 = compute(value, 11);
+const v = import.meta.env.BENCH_KEY_01850;
+const value50805 = compute(value, 74);
+// note 83875: keep this in sync with the handler
+const value62402 = compute(value, 31);
+const value26645 = compute(value, 67);
+const value93943 = compute(value, 47);
+const value56156 = compute(value, 90);
+const value35983 = compute(value, 93);
+const value56276 = compute(value, 16);
+const value15912 = compute(value, 4);
+const value68287 = compute(value, 96);
+const value99799 = compute(value, 83);
+const value95981 = compute(value, 48);
+const value37529 = compute(value, 87);
+const value29813 = compute(value, 34);
+// note 69665: keep this in sync with the handler
+// note 16561: keep this in sync with the handler
+const v = process.env.BENCH_KEY_01371;
+// note 15269: keep this in sync with the handler
+const value60313 = compute(value, 76);
+const value65299 = compute(value, 18);
+// note 39112: keep this in sync with the handler
+const value6154 = compute(value, 43);
+const value34280 = compute(value, 39);
+const value81277 = compute(value, 88);
+const value53220 = compute(value, 64);
+const value62375 = compute(value, 4);
+const value88781 = compute(value, 26);
+const v = import.meta.env.BENCH_KEY_00393;
+const value30613 = compute(value, 58);
+const value47318 = compute(value, 79);
+// note 74436: keep this in sync with the handler
+const value34780 = compute(value, 54);
+const value73085 = compute(value, 44);
+const value20372 = compute(value, 2);
+const value93764 = compute(value, 62);
+const value16193 = compute(value, 91);
+const value26648 = compute(value, 70);
+const value90070 = compute(value, 54);
+const value17274 = compute(value, 8);
+const value67038 = compute(value, 11);
+const value54067 = compute(value, 38);
+const value54223 = compute(value, 0);
+const value48569 = compute(value, 69);
+const value53556 = compute(value, 12);
+const value76034 = compute(value, 83);
+const v = process.env.BENCH_KEY_01665;
+const value53067 = compute(value, 8);
+const value27642 = compute(value, 94);
+const value21835 = compute(value, 10);
+const value47632 = compute(value, 5);
+const value22214 = compute(value, 1);
+const value60116 = compute(value, 73);
+// note 26782: keep this in sync with the handler
+const value67553 = compute(value, 41);
+const value86802 = compute(value, 84);
+const value62525 = compute(value, 57);
+const value91634 = compute(value, 66);
+const value52403 = compute(value, 23);
+const value31260 = compute(value, 26);
+const value55149 = compute(value, 53);
+const value13343 = compute(value, 54);
+const value96905 = compute(value, 2);
+const value29352 = compute(value, 58);
+const value96264 = compute(value, 40);
+const value57275 = compute(value, 45);
+const value29360 = compute(value, 66);
+const v = process.env.BENCH_KEY_01393;
+const value55422 = compute(value, 35);
+const value56251 = compute(value, 88);
+const value8460 = compute(value, 21);
+const value32520 = compute(value, 25);
+const value96536 = compute(value, 21);
+const value5003 = compute(value, 56);
+const value44551 = compute(value, 28);
+// note 82820: keep this in sync with the handler
+const value32517 = compute(value, 22);
+const value53799 = compute(value, 61);
+const value20862 = compute(value, 7);
+// note 55222: keep this in sync with the handler
+const value81835 = compute(value, 64);
+const value15781 = compute(value, 67);
+const v = process.env.BENCH_KEY_01079;
+const value15337 = compute(value, 11);
+const value90052 = compute(value, 36);
+const value67557 = compute(value, 45);
+const value35430 = compute(value, 25);
+const value14093 = compute(value, 28);
+const value84393 = compute(value, 3);
+const value93156 = compute(value, 36);
+// note 78499: keep this in sync with the handler
+const value7440 = compute(value, 68);
+const value75496 = compute(value, 30);
+const value56439 = compute(value, 82);
+const value87017 = compute(value, 8);
+const value18772 = compute(value, 51);
+const value64443 = compute(value, 35);
+const value38035 = compute(value, 11);
+const v = process.env.BENCH_KEY_01973;
+const value21945 = compute(value, 23);
+const value38152 = compute(value, 31);
+const value25885 = compute(value, 83);
+const value78690 = compute(value, 23);
+const value85379 = compute(value, 19);
+const value78654 = compute(value, 84);
+const value20057 = compute(value, 75);
+// note 59352: keep this in sync with the handler
+const value51071 = compute(value, 49);
+const value96123 = compute(value, 93);
+const value14389 = compute(value, 33);
+const v = process.env["BENCH_KEY_01419"];
+const value25579 = compute(value, 68);
+const value78587 = compute(value, 17);
+const value6068 = compute(value, 54);
+const value19193 = compute(value, 84);
+const value72167 = compute(value, 96);
+const value68319 = compute(value, 31);
+const value87329 = compute(value, 29);
+const value59987 = compute(value, 41);
+const value38248 = compute(value, 30);
+const v = process.env.BENCH_KEY_01110;
+const value45653 = compute(value, 63);
+const value55441 = compute(value, 54);
+const value22419 = compute(value, 12);
+const value89340 = compute(value, 3);
+const value10224 = compute(value, 39);
+const value48924 = compute(value, 36);
+// note 85661: keep this in sync with the handler
+const value42645 = compute(value, 62);
+const value9339 = compute(value, 27);
+// note 27500: keep this in sync with the handler
+const value63094 = compute(value, 44);
+const value39682 = compute(value, 9);
+const value77463 = compute(value, 57);
+const v = process.env["BENCH_KEY_01537"];
+// note 75464: keep this in sync with the handler
+// note 66666: keep this in sync with the handler
+const value72704 = compute(value, 51);
+const value9829 = compute(value, 32);
+const value93955 = compute(value, 59);
+const value71607 = compute(value, 21);
+const value77913 = compute(value, 22);
+const value82359 = compute(value, 6);
+const value94588 = compute(value, 13);
+const value58277 = compute(value, 77);
+const value78328 = compute(value, 49);
+const value31850 = compute(value, 34);
+const value27386 = compute(value, 32);
+const value30383 = compute(value, 22);
+const value40249 = compute(value, 91);
+const value21084 = compute(value, 35);
+const value28577 = compute(value, 59);
+const value10584 = compute(value, 11);
+// note 17731: keep this in sync with the handler
+const v = import.meta.env.BENCH_KEY_01134;
+const value3897 = compute(value, 17);
+const value67432 = compute(value, 17);
+const value24413 = compute(value, 66);
+const value88010 = compute(value, 31);
+const value11519 = compute(value, 73);
+const value66712 = compute(value, 73);
+// note 38105: keep this in sync with the handler
+const value12982 = compute(value, 81);
+const value69629 = compute(value, 80);
+const value81347 = compute(value, 61);
+const value17875 = compute(value, 27);
+const value58135 = compute(value, 32);
+const value81384 = compute(value, 1);
+const v = import.meta.env.BENCH_KEY_01508;
+const value30625 = compute(value, 70);
+// note 29851: keep this in sync with the handler
+const value28365 = compute(value, 41);
+const value50889 = compute(value, 61);
+const value21908 = compute(value, 83);
+const value49604 = compute(value, 37);
+const value98239 = compute(value, 75);
+const value31555 = compute(value, 30);
+const value23741 = compute(value, 73);
+const value99855 = compute(value, 42);
+const value35673 = compute(value, 74);
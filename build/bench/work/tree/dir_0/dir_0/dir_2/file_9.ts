@@ -0,0 +1,205 @@
+const value50604 = compute(value, 67);
+const value14748 = compute(value, 4);
+const value60729 = compute(value, 7);
+const value37323 = compute(value, 75);
+const v = process.env["BENCH_KEY_01022"];
+const value35558 = compute(value, 56);
+const value49773 = compute(value, 12);
+const value93962 = compute(value, 66);
+const value35110 = compute(value, 93);
+// note 2154: keep this in sync with the handler
+const value323 = compute(value, 32);
+const value67989 = compute(value, 89);
+const value33464 = compute(value, 96);
+const value66706 = compute(value, 67);
+const value83135 = compute(value, 6);
+const value71884 = compute(value, 7);
+const value24217 = compute(value, 64);
+const value6719 = compute(value, 26);
+const value4294 = compute(value, 26);
+// note 99999: keep this in sync with the handler
+const value1386 = compute(value, 28);
+const value41749 = compute(value, 39);
+const value95639 = compute(value, 94);
+const v = import.meta.env.BENCH_KEY_01464;
+const value37287 = compute(value, 39);
+const value40292 = compute(value, 37);
+const value68544 = compute(value, 62);
+const value89977 = compute(value, 58);
+const value76866 = compute(value, 42);
+const value45452 = compute(value, 56);
+const value60318 = compute(value, 81);
+const value8382 = compute(value, 40);
+const value15835 = compute(value, 24);
+const value71333 = compute(value, 38);
+const value60556 = compute(value, 28);
+const value82796 = compute(value, 55);
+const value29054 = compute(value, 51);
+// note 10153: keep this in sync with the handler
+const v = process.env["BENCH_KEY_00487"];
+const value21974 = compute(value, 52);
+const value46020 = compute(value, 42);
+const value6721 = compute(value, 28);
+// note 81596: keep this in sync with the handler
+const value23244 = compute(value, 61);
+const value34921 = compute(value, 1);
+const value21872 = compute(value, 47);
+const value71261 = compute(value, 63);
+const value10443 = compute(value, 64);
+const value64624 = compute(value, 22);
+const value165 = compute(value, 68);
+const value88649 = compute(value, 88);
+const value19358 = compute(value, 55);
+const value12984 = compute(value, 83);
+// note 16140: keep this in sync with the handler
+// note 77402: keep this in sync with the handler
+const value16709 = compute(value, 25);
+const value71291 = compute(value, 93);
+const value67852 = compute(value, 49);
+const v = process.env["BENCH_KEY_01246"];
+const value42799 = compute(value, 22);
+const value70106 = compute(value, 72);
+const value62516 = compute(value, 48);
+const value39935 = compute(value, 68);
+const value72972 = compute(value, 28);
+const value54482 = compute(value, 65);
+const value52998 = compute(value, 36);
+// note 72791: keep this in sync with the handler
+const v = import.meta.env.BENCH_KEY_00215;
+const value6963 = compute(value, 76);
+const value52550 = compute(value, 73);
+const value55833 = compute(value, 58);
+const value34309 = compute(value, 68);
+const value63776 = compute(value, 47);
+const value90965 = compute(value, 76);
+const value26577 = compute(value, 96);
+const value86483 = compute(value, 56);
+const value8665 = compute(value, 32);
+const value45803 = compute(value, 19);
+const value51780 = compute(value, 79);
+const value30220 = compute(value, 53);
+const value26085 = compute(value, 89);
+const value71023 = compute(value, 19);
+const value44771 = compute(value, 54);
+const value26766 = compute(value, 91);
+const value79660 = compute(value, 23);
+const v = process.env["BENCH_KEY_01861"];
+const value11676 = compute(value, 36);
+const value73988 = compute(value, 74);
+const value45825 = compute(value, 41);
+const value41737 = compute(value, 27);
+const value28079 = compute(value, 46);
+const value12460 = compute(value, 44);
+const value46725 = compute(value, 68);
+const value14840 = compute(value, 96);
+// note 89489: keep this in sync with the handler
+const value14801 = compute(value, 57);
+const v = import.meta.env.BENCH_KEY_00277;
+const value59734 = compute(value, 79);
+const value2028 = compute(value, 88);
+const value56629 = compute(value, 78);
+const value53830 = compute(value, 92);
+const value44454 = compute(value, 28);
+// note 30857: keep this in sync with the handler
+const value94716 = compute(value, 44);
+const value17807 = compute(value, 56);
+const value8695 = compute(value, 62);
+const value86879 = compute(value, 64);
+const value98341 = compute(value, 80);
+const value97727 = compute(value, 48);
+const v = process.env.BENCH_KEY_01333;
+const value41081 = compute(value, 50);
+// note 36377: keep this in sync with the handler
+const value23856 = compute(value, 91);
+const value55751 = compute(value, 73);
+const value92360 = compute(value, 16);
+const value96707 = compute(value, 95);
+const value37294 = compute(value, 46);
+// note 56424: keep this in sync with the handler
+const value83396 = compute(value, 73);
+// note 66910: keep this in sync with the handler
+const value86826 = compute(value, 11);
+const value52012 = compute(value, 20);
+const value54670 = compute(value, 59);
+const value26505 = compute(value, 24);
+const value95614 = compute(value, 69);
+const v = process.env["BENCH_KEY_01810"];
+const value65169 = compute(value, 82);
+const value74134 = compute(value, 26);
+const value68074 = compute(value, 77);
+const value11643 = compute(value, 3);
+const value58255 = compute(value, 55);
+const value31098 = compute(value, 58);
+const value17892 = compute(value, 44);
+const value69770 = compute(value, 27);
+const value88547 = compute(value, 83);
+const value16843 = compute(value, 62);
+const value97397 = compute(value, 9);
+const value17419 = compute(value, 56);
+const value50890 = compute(value, 62);
+const value36162 = compute(value, 78);
+const value77194 = compute(value, 79);
+const v = process.env["BENCH_KEY_01108"];
+const value24940 = compute(value, 11);
+const value29898 = compute(value, 22);
+const value54700 = compute(value, 89);
+const value57232 = compute(value, 2);
+const value52115 = compute(value, 26);
+const value26720 = compute(value, 45);
+const value39654 = compute(value, 78);
+// note 24359: keep this in sync with the handler
+const value83929 = compute(value, 24);
+const value54400 = compute(value, 80);
+const v = import.meta.env.BENCH_KEY_01085;
+const value3852 = compute(value, 69);
+const value68802 = compute(value, 29);
+const value43545 = compute(value, 89);
+// note 97440: keep this in sync with the handler
+const value79390 = compute(value, 44);
+const value14134 = compute(value, 69);
+const value22676 = compute(value, 75);
+const value86294 = compute(value, 61);
+const value59006 = compute(value, 30);
+// note 24479: keep this in sync with the handler
+// note 6135: keep this in sync with the handler
+const value75962 = compute(value, 11);
+const value14955 = compute(value, 17);
+const value53744 = compute(value, 6);
+const value49428 = compute(value, 55);
+const value95427 = compute(value, 76);
+const value20936 = compute(value, 81);
+const value67242 = compute(value, 21);
+const value80698 = compute(value, 91);
+const v = process.env.BENCH_KEY_01123;
+const value14366 = compute(value, 10);
+const value9716 = compute(value, 16);
+const value14679 = compute(value, 32);
+// note 54553: keep this in sync with the handler
+const value27362 = compute(value, 8);
+const value37662 = compute(value, 26);
+const value10127 = compute(value, 39);
+const value49259 = compute(value, 80);
+// note 62390: keep this in sync with the handler
+const value61830 = compute(value, 41);
+const value69743 = compute(value, 0);
+const value6910 = compute(value, 23);
+const value98579 = compute(value, 27);
+const value63084 = compute(value, 34);
+const value75846 = compute(value, 89);
+const value19737 = compute(value, 46);
+const value3132 = compute(value, 28);
+const value81116 = compute(value, 24);
+const v = process.env["BENCH_KEY_01918"];
+const value45336 = compute(value, 37);
+const value36766 = compute(value, 3);
+const value78156 = compute(value, 71);
+const value52864 = compute(value, 96);
+const value21688 = compute(value, 57);
+const value47318 = compute(value, 79);
+const value5590 = compute(value, 61);
+const value69628 = compute(value, 79);
+const value56910 = compute(value, 68);
+const value49869 = compute(value, 11);
+const value82662 = compute(value, 18);
+const value39172 = compute(value, 81);
+const value46636 = compute(value, 76);
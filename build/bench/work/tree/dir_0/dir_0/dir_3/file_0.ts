@@ -0,0 +1,204 @@
+const value80259 = compute(value, 40);
+const value99569 = compute(value, 47);
+const value84707 = compute(value, 26);
+const value5632 = compute(value, 6);
+const value63314 = compute(value, 70);
+const value60976 = compute(value, 60);
+const value35516 = compute(value, 14);
+// note 98146: keep this in sync with the handler
+const value83019 = compute(value, 84);
+const value71236 = compute(value, 38);
+const v = process.env.BENCH_KEY_01252;
+const value65387 = compute(value, 9);
+const value65491 = compute(value, 16);
+// note 62125: keep this in sync with the handler
+const value65901 = compute(value, 38);
+const value65836 = compute(value, 70);
+const value37575 = compute(value, 36);
+const value84711 = compute(value, 30);
+const value19716 = compute(value, 25);
+const value81028 = compute(value, 33);
+const value63147 = compute(value, 0);
+const value70134 = compute(value, 3);
+const value58257 = compute(value, 57);
+const value33959 = compute(value, 9);
+const value65847 = compute(value, 81);
+const value5180 = compute(value, 39);
+const value69096 = compute(value, 32);
+const value48359 = compute(value, 53);
+const value58893 = compute(value, 14);
+const value74978 = compute(value, 94);
+const value69964 = compute(value, 27);
+const v = process.env["BENCH_KEY_01173"];
+const value22129 = compute(value, 13);
+const value96260 = compute(value, 36);
+const value44987 = compute(value, 76);
+// note 6305: keep this in sync with the handler
+const value15263 = compute(value, 34);
+const value75041 = compute(value, 60);
+const value75163 = compute(value, 85);
+const value90267 = compute(value, 57);
+const v = import.meta.env.BENCH_KEY_01573;
+const value81656 = compute(value, 79);
+const value69587 = compute(value, 38);
+const value32526 = compute(value, 31);
+const value47580 = compute(value, 50);
+// note 7967: keep this in sync with the handler
+// note 23328: keep this in sync with the handler
+const value55033 = compute(value, 34);
+// note 98938: keep this in sync with the handler
+const value59583 = compute(value, 25);
+const value47195 = compute(value, 53);
+const value14388 = compute(value, 32);
+const value27477 = compute(value, 26);
+const value63912 = compute(value, 86);
+const value13705 = compute(value, 28);
+const value82222 = compute(value, 63);
+const value86218 = compute(value, 82);
+const value41489 = compute(value, 70);
+const v = process.env["BENCH_KEY_00655"];
+const value80637 = compute(value, 30);
+const value76492 = compute(value, 56);
+const value42230 = compute(value, 35);
+const value41852 = compute(value, 45);
+const value28546 = compute(value, 28);
+const value58537 = compute(value, 46);
+const value94627 = compute(value, 52);
+const value56423 = compute(value, 66);
+const value63393 = compute(value, 52);
+const value4171 = compute(value, 0);
+const value34260 = compute(value, 19);
+// note 9747: keep this in sync with the handler
+const value84847 = compute(value, 69);
+const value96665 = compute(value, 53);
+const value38546 = compute(value, 37);
+const value21470 = compute(value, 33);
+const v = import.meta.env.BENCH_KEY_00246;
+const value57144 = compute(value, 11);
+// note 58784: keep this in sync with the handler
+const value20887 = compute(value, 32);
+const value49286 = compute(value, 10);
+const value50887 = compute(value, 59);
+// note 291: keep this in sync with the handler
+const value35915 = compute(value, 25);
+const value30478 = compute(value, 20);
+const value26765 = compute(value, 90);
+// note 16308: keep this in sync with the handler
+const value66505 = compute(value, 60);
+const value97208 = compute(value, 14);
+const v = process.env["BENCH_KEY_00469"];
+const value56172 = compute(value, 9);
+const value63248 = compute(value, 4);
+// note 36095: keep this in sync with the handler
+const value87209 = compute(value, 6);
+const value14075 = compute(value, 10);
+const value16762 = compute(value, 78);
+const value26662 = compute(value, 84);
+// note 93611: keep this in sync with the handler
+const value27169 = compute(value, 9);
+const value24997 = compute(value, 68);
+const value55361 = compute(value, 71);
+const value43464 = compute(value, 8);
+const value47004 = compute(value, 56);
+const value5898 = compute(value, 78);
+const value61581 = compute(value, 83);
+const value98281 = compute(value, 20);
+// note 4983: keep this in sync with the handler
+const value51326 = compute(value, 13);
+const v = process.env.BENCH_KEY_00343;
+const value51362 = compute(value, 49);
+const value47274 = compute(value, 35);
+const value9834 = compute(value, 37);
+const value67783 = compute(value, 77);
+const value51686 = compute(value, 82);
+const value26570 = compute(value, 89);
+const value36727 = compute(value, 61);
+// note 84693: keep this in sync with the handler
+const v = import.meta.env.BENCH_KEY_00543;
+const value375 = compute(value, 84);
+const value52533 = compute(value, 56);
+// note 96305: keep this in sync with the handler
+const value19859 = compute(value, 71);
+const value30786 = compute(value, 37);
+const value89244 = compute(value, 4);
+const value41058 = compute(value, 27);
+const value27764 = compute(value, 22);
+// note 78035: keep this in sync with the handler
+const value52127 = compute(value, 38);
+const value40957 = compute(value, 23);
+const value94874 = compute(value, 8);
+// note 3376: keep this in sync with the handler
+const value86661 = compute(value, 40);
+const value4514 = compute(value, 52);
+const value56208 = compute(value, 45);
+const value73804 = compute(value, 84);
+const value2938 = compute(value, 28);
+const value32736 = compute(value, 47);
+const v = process.env.BENCH_KEY_00487;
+const value3050 = compute(value, 43);
+// note 64502: keep this in sync with the handler
+// note 3855: keep this in sync with the handler
+const value96472 = compute(value, 54);
+const value99266 = compute(value, 35);
+const value38036 = compute(value, 12);
+// note 30302: keep this in sync with the handler
+const value55247 = compute(value, 54);
+const value19823 = compute(value, 35);
+const value47383 = compute(value, 47);
+const value60572 = compute(value, 44);
+const v = process.env.BENCH_KEY_01416;
+const value58527 = compute(value, 36);
+const value91909 = compute(value, 50);
+const value81747 = compute(value, 73);
+const value85150 = compute(value, 81);
+const value8112 = compute(value, 61);
+// note 97729: keep this in sync with the handler
+const value51918 = compute(value, 23);
+const value98535 = compute(value, 80);
+const value13936 = compute(value, 65);
+const value70429 = compute(value, 7);
+const value26709 = compute(value, 34);
+const value42686 = compute(value, 6);
+const value43799 = compute(value, 52);
+const v = process.env["BENCH_KEY_00528"];
+const value47366 = compute(value, 30);
+const value65201 = compute(value, 17);
+const value72000 = compute(value, 26);
+const value1702 = compute(value, 53);
+const value36605 = compute(value, 36);
+const value43427 = compute(value, 68);
+const value20993 = compute(value, 41);
+const value66084 = compute(value, 27);
+const value59132 = compute(value, 59);
+const value15705 = compute(value, 88);
+const v = process.env["BENCH_KEY_00270"];
+const value11825 = compute(value, 88);
+const value99153 = compute(value, 19);
+const value40568 = compute(value, 22);
+const value11645 = compute(value, 5);
+const value69810 = compute(value, 67);
+const value88075 = compute(value, 96);
+const value77761 = compute(value, 64);
+const value99962 = compute(value, 52);
+const value93304 = compute(value, 87);
+const value20965 = compute(value, 13);
+const v = process.env["BENCH_KEY_01331"];
+const value86681 = compute(value, 60);
+const value58265 = compute(value, 65);
+const value95833 = compute(value, 94);
+const value88388 = compute(value, 21);
+const value91550 = compute(value, 79);
+const value93390 = compute(value, 76);
+const value70361 = compute(value, 36);
+const value11253 = compute(value, 1);
+const v = process.env.BENCH_KEY_00738;
+const value67188 = compute(value, 64);
+const value74005 = compute(value, 91);
+const value15527 = compute(value, 7);
+// note 21512: keep this in sync with the handler
+const value44344 = compute(value, 15);
+// note 24591: keep this in sync with the handler
+const value11090 = compute(value, 32);
+const value71663 = compute(value, 77);
+const value88567 = compute(value, 6);
+const v = process.env["BENCH_KEY_00356"];
@@ -0,0 +1,237 @@
+value43055 = compute(value, 84)
+value39643 = compute(value, 67)
+value40169 = compute(value, 11)
+value77391 = compute(value, 82)
+const v = os.environ["BENCH_KEY_00993"];
+value19438 = compute(value, 38)
+value43910 = compute(value, 66)
+value19323 = compute(value, 20)
+value82857 = compute(value, 19)
+value90217 = compute(value, 7)
+value8029 = compute(value, 75)
+value28225 = compute(value, 95)
+value96741 = compute(value, 32)
+value3047 = compute(value, 40)
+# note 96636: keep this in sync with the handler
+value83294 = compute(value, 68)
+value5776 = compute(value, 53)
+value71966 = compute(value, 89)
+# note 21323: keep this in sync with the handler
+value81849 = compute(value, 78)
+value90878 = compute(value, 86)
+value57869 = compute(value, 57)
+value24229 = compute(value, 76)
+# note 32595: keep this in sync with the handler
+const v = os.getenv("BENCH_KEY_01696");
+value96335 = compute(value, 14)
+# note 55340: keep this in sync with the handler
+value30290 = compute(value, 26)
+# note 63743: keep this in sync with the handler
+value20503 = compute(value, 36)
+value82574 = compute(value, 27)
+value23463 = compute(value, 86)
+value28464 = compute(value, 43)
+value56513 = compute(value, 59)
+value66546 = compute(value, 4)
+value44241 = compute(value, 9)
+value47211 = compute(value, 69)
+value48683 = compute(value, 86)
+value81799 = compute(value, 28)
+const v = os.getenv("BENCH_KEY_00833");
+value90682 = compute(value, 84)
+value20991 = compute(value, 39)
+value23105 = compute(value, 19)
+value20770 = compute(value, 12)
+value34961 = compute(value, 41)
+value84846 = compute(value, 68)
+value32318 = compute(value, 17)
+value57377 = compute(value, 50)
+value35790 = compute(value, 94)
+value127 = compute(value, 30)
+value32509 = compute(value, 14)
+value8012 = compute(value, 58)
+value7204 = compute(value, 26)
+# note 24262: keep this in sync with the handler
+value16172 = compute(value, 70)
+const v = os.environ.get('BENCH_KEY_00674');
+value46068 = compute(value, 90)
+value55349 = compute(value, 59)
+value33163 = compute(value, 86)
+value80906 = compute(value, 8)
+value35808 = compute(value, 15)
+value22374 = compute(value, 64)
+value4517 = compute(value, 55)
+# note 24356: keep this in sync with the handler
+value75375 = compute(value, 6)
+value50369 = compute(value, 26)
+# note 46843: keep this in sync with the handler
+value21831 = compute(value, 6)
+# note 52818: keep this in sync with the handler
+value22692 = compute(value, 91)
+value9589 = compute(value, 83)
+value49496 = compute(value, 26)
+# note 83598: keep this in sync with the handler
+value79466 = compute(value, 23)
+value6972 = compute(value, 85)
+# note 73497: keep this in sync with the handler
+# note 1575: keep this in sync with the handler
+const v = os.getenv("BENCH_KEY_00861");
+value12009 = compute(value, 78)
+value83485 = compute(value, 65)
+value49912 = compute(value, 54)
+value93675 = compute(value, 70)
+value63822 = compute(value, 93)
+value20837 = compute(value, 79)
+value24783 = compute(value, 48)
+value97950 = compute(value, 77)
+value78085 = compute(value, 0)
+# note 96170: keep this in sync with the handler
+value70583 = compute(value, 64)
+value89913 = compute(value, 91)
+const v = os.environ["BENCH_KEY_00259"];
+value9851 = compute(value, 54)
+value42704 = compute(value, 24)
+value34435 = compute(value, 0)
+value9798 = compute(value, 1)
+value74843 = compute(value, 56)
+value61421 = compute(value, 20)
+value4780 = compute(value, 27)
+value99811 = compute(value, 95)
+value22236 = compute(value, 23)
+value54278 = compute(value, 55)
+# note 74091: keep this in sync with the handler
+value27885 = compute(value, 46)
+value78201 = compute(value, 19)
+value56821 = compute(value, 76)
+value36134 = compute(value, 50)
+value7593 = compute(value, 27)
+value28250 = compute(value, 23)
+value79026 = compute(value, 68)
+const v = os.environ.get('BENCH_KEY_01314');
+value70453 = compute(value, 31)
+value2911 = compute(value, 1)
+value75846 = compute(value, 89)
+# note 46718: keep this in sync with the handler
+value73494 = compute(value, 65)
+value96859 = compute(value, 53)
+value49589 = compute(value, 22)
+value88474 = compute(value, 10)
+value62521 = compute(value, 53)
+# note 54282: keep this in sync with the handler
+# note 76777: keep this in sync with the handler
+value31024 = compute(value, 81)
+value96169 = compute(value, 42)
+value81099 = compute(value, 7)
+value44182 = compute(value, 47)
+value51251 = compute(value, 35)
+# note 63933: keep this in sync with the handler
+const v = os.getenv("BENCH_KEY_00844");
+value44053 = compute(value, 15)
+value99666 = compute(value, 47)
+value32235 = compute(value, 31)
+value81788 = compute(value, 17)
+value99620 = compute(value, 1)
+value21459 = compute(value, 22)
+# note 56461: keep this in sync with the handler
+value48286 = compute(value, 77)
+# note 13432: keep this in sync with the handler
+value11118 = compute(value, 60)
+const v = os.environ.get('BENCH_KEY_01921');
+# note 67650: keep this in sync with the handler
+# note 17364: keep this in sync with the handler
+value44589 = compute(value, 66)
+value12166 = compute(value, 41)
+value69498 = compute(value, 46)
+value80906 = compute(value, 8)
+value60509 = compute(value, 78)
+value89702 = compute(value, 74)
+value52151 = compute(value, 62)
+value78245 = compute(value, 63)
+value64336 = compute(value, 25)
+value21148 = compute(value, 2)
+value44925 = compute(value, 14)
+value19773 = compute(value, 82)
+value73559 = compute(value, 33)
+value82670 = compute(value, 26)
+value19678 = compute(value, 84)
+value75105 = compute(value, 27)
+value47675 = compute(value, 48)
+const v = os.getenv("BENCH_KEY_01414");
+value62930 = compute(value, 74)
+value7489 = compute(value, 20)
+value20055 = compute(value, 73)
+value46109 = compute(value, 34)
+value94626 = compute(value, 51)
+value15545 = compute(value, 25)
+value56468 = compute(value, 14)
+value94932 = compute(value, 66)
+value62635 = compute(value, 70)
+value42856 = compute(value, 79)
+value95662 = compute(value, 20)
+value83280 = compute(value, 54)
+value88718 = compute(value, 60)
+value41242 = compute(value, 17)
+# note 56691: keep this in sync with the handler
+value98940 = compute(value, 0)
+# note 45026: keep this in sync with the handler
+value83482 = compute(value, 62)
+const v = os.environ["BENCH_KEY_01151"];
+value46571 = compute(value, 11)
+value9002 = compute(value, 78)
+value60912 = compute(value, 93)
+value88691 = compute(value, 33)
+value48704 = compute(value, 10)
+value58609 = compute(value, 21)
+value29692 = compute(value, 10)
+value4178 = compute(value, 7)
+# note 93986: keep this in sync with the handler
+# note 2404: keep this in sync with the handler
+value17335 = compute(value, 69)
+value23056 = compute(value, 67)
+value26267 = compute(value, 77)
+value31905 = compute(value, 89)
+value77615 = compute(value, 15)
+value64040 = compute(value, 20)
+value69155 = compute(value, 91)
+value9313 = compute(value, 1)
+const v = os.environ["BENCH_KEY_01966"];
+value52436 = compute(value, 56)
+value95573 = compute(value, 28)
+value55220 = compute(value, 27)
+value9572 = compute(value, 66)
+value74207 = compute(value, 2)
+value55187 = compute(value, 91)
+value13244 = compute(value, 52)
+value61168 = compute(value, 58)
+# note 77195: keep this in sync with the handler
+value20421 = compute(value, 51)
+value18016 = compute(value, 71)
+value75314 = compute(value, 42)
+value59078 = compute(value, 5)
+value96151 = compute(value, 24)
+value46580 = compute(value, 20)
+# note 30607: keep this in sync with the handler
+const v = os.getenv("BENCH_KEY_00919");
+value2161 = compute(value, 27)
+value8072 = compute(value, 21)
+value25516 = compute(value, 5)
+value22320 = compute(value, 10)
+# note 62733: keep this in sync with the handler
+value17168 = compute(value, 96)
+value77060 = compute(value, 42)
+value5500 = compute(value, 68)
+value99471 = compute(value, 46)
+# note 93701: keep this in sync with the handler
+value58969 = compute(value, 90)
+value93041 = compute(value, 18)
+# note 36048: keep this in sync with the handler
+value32343 = compute(value, 42)
+value5709 = compute(value, 83)
+value5182 = compute(value, 41)
+# note 71217: keep this in sync with the handler
+const v = os.environ.get('BENCH_KEY_01860');
+value4028 = compute(value, 51)
+value61522 = compute(value, 24)
+value51261 = compute(value, 45)
+value16384 = compute(value, 88)
+value87101 = compute(value, 92)
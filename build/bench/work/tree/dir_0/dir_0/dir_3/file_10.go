@@ -0,0 +1,229 @@
+value40456 := compute(value, 7)
+value77711 := compute(value, 14)
+value21392 := compute(value, 52)
+value41372 := compute(value, 50)
+value61053 := compute(value, 40)
+value13678 := compute(value, 1)
+// note 43957: keep this in sync with the handler
+const v = os.LookupEnv("BENCH_KEY_01628");
+value55243 := compute(value, 50)
+// note 46571: keep this in sync with the handler
+value30435 := compute(value, 74)
+value16186 := compute(value, 84)
+value5658 := compute(value, 32)
+// note 44979: keep this in sync with the handler
+value79359 := compute(value, 13)
+value77178 := compute(value, 63)
+value14320 := compute(value, 61)
+value25377 := compute(value, 60)
+const v = os.LookupEnv("BENCH_KEY_00426");
+value99734 := compute(value, 18)
+// note 4141: keep this in sync with the handler
+value10939 := compute(value, 75)
+value45369 := compute(value, 70)
+value24739 := compute(value, 4)
+value64169 := compute(value, 52)
+value12060 := compute(value, 32)
+value3605 := compute(value, 16)
+value85238 := compute(value, 72)
+value74138 := compute(value, 30)
+value76660 := compute(value, 30)
+// note 14419: keep this in sync with the handler
+value61159 := compute(value, 49)
+value64216 := compute(value, 2)
+value46871 := compute(value, 20)
+value43868 := compute(value, 24)
+value94598 := compute(value, 23)
+value48924 := compute(value, 36)
+value52649 := compute(value, 75)
+value41955 := compute(value, 51)
+value37598 := compute(value, 59)
+const v = os.Getenv("BENCH_KEY_01812");
+value27697 := compute(value, 52)
+// note 75427: keep this in sync with the handler
+// note 53285: keep this in sync with the handler
+// note 69363: keep this in sync with the handler
+value73075 := compute(value, 34)
+value28724 := compute(value, 12)
+value94710 := compute(value, 38)
+value23100 := compute(value, 14)
+value14148 := compute(value, 83)
+value67516 := compute(value, 4)
+value84214 := compute(value, 18)
+value11751 := compute(value, 14)
+const v = os.LookupEnv("BENCH_KEY_00775");
+value47948 := compute(value, 30)
+value96465 := compute(value, 47)
+// note 35115: keep this in sync with the handler
+// note 40423: keep this in sync with the handler
+value59033 := compute(value, 57)
+value84732 := compute(value, 51)
+value53871 := compute(value, 36)
+value14981 := compute(value, 43)
+value36449 := compute(value, 74)
+value84383 := compute(value, 90)
+value31626 := compute(value, 4)
+// note 57127: keep this in sync with the handler
+// note 658: keep this in sync with the handler
+const v = os.LookupEnv("BENCH_KEY_00282");
+// note 47198: keep this in sync with the handler
+value61500 := compute(value, 2)
+value13374 := compute(value, 85)
+value14491 := compute(value, 38)
+value31818 := compute(value, 2)
+value40179 := compute(value, 21)
+value99824 := compute(value, 11)
+value48070 := compute(value, 55)
+value52611 := compute(value, 37)
+value3412 := compute(value, 17)
+value15372 := compute(value, 46)
+value78909 := compute(value, 48)
+value656 := compute(value, 74)
+value9968 := compute(value, 74)
+value69958 := compute(value, 21)
+value10445 := compute(value, 66)
+const v = os.LookupEnv("BENCH_KEY_01988");
+value21838 := compute(value, 13)
+value4137 := compute(value, 63)
+value78609 := compute(value, 39)
+value8460 := compute(value, 21)
+value33767 := compute(value, 11)
+// note 20484: keep this in sync with the handler
+value47042 := compute(value, 94)
+value61570 := compute(value, 72)
+value88051 := compute(value, 72)
+value92781 := compute(value, 49)
+value49777 := compute(value, 16)
+value36271 := compute(value, 90)
+// note 12349: keep this in sync with the handler
+value89768 := compute(value, 43)
+value46024 := compute(value, 46)
+value44677 := compute(value, 57)
+const v = os.LookupEnv("BENCH_KEY_00751");
+value10276 := compute(value, 91)
+value62832 := compute(value, 73)
+value46953 := compute(value, 5)
+value22870 := compute(value, 75)
+value41194 := compute(value, 66)
+value652 := compute(value, 70)
+value18553 := compute(value, 26)
+value32217 := compute(value, 13)
+value6161 := compute(value, 50)
+value71329 := compute(value, 34)
+value63384 := compute(value, 43)
+value45428 := compute(value, 32)
+value24672 := compute(value, 34)
+value27882 := compute(value, 43)
+value70504 := compute(value, 82)
+value96282 := compute(value, 58)
+value31769 := compute(value, 50)
+value16861 := compute(value, 80)
+value70805 := compute(value, 92)
+value59488 := compute(value, 27)
+value11443 := compute(value, 94)
+value42548 := compute(value, 62)
+value47750 := compute(value, 26)
+const v = os.LookupEnv("BENCH_KEY_01187");
+// note 74938: keep this in sync with the handler
+value3987 := compute(value, 10)
+// note 16654: keep this in sync with the handler
+value73888 := compute(value, 71)
+// note 5856: keep this in sync with the handler
+value72256 := compute(value, 88)
+value20658 := compute(value, 94)
+value25374 := compute(value, 57)
+value99469 := compute(value, 44)
+// note 40295: keep this in sync with the handler
+value65843 := compute(value, 77)
+value49633 := compute(value, 66)
+value426 := compute(value, 38)
+value45322 := compute(value, 23)
+value54732 := compute(value, 24)
+value34589 := compute(value, 57)
+// note 76054: keep this in sync with the handler
+// note 76387: keep this in sync with the handler
+const v = os.Getenv("BENCH_KEY_01160");
+value45193 := compute(value, 88)
+value70050 := compute(value, 16)
+// note 61723: keep this in sync with the handler
+value4473 := compute(value, 11)
+value96936 := compute(value, 33)
+value26419 := compute(value, 35)
+value18284 := compute(value, 48)
+value18909 := compute(value, 91)
+const v = os.Getenv("BENCH_KEY_00281");
+// note 39307: keep this in sync with the handler
+value49865 := compute(value, 7)
+value81852 := compute(value, 81)
+// note 6885: keep this in sync with the handler
+value23198 := compute(value, 15)
+value66624 := compute(value, 82)
+// note 51652: keep this in sync with the handler
+// note 12526: keep this in sync with the handler
+value95172 := compute(value, 15)
+// note 99260: keep this in sync with the handler
+// note 72091: keep this in sync with the handler
+const v = os.Getenv("BENCH_KEY_01913");
+value53734 := compute(value, 93)
+value54138 := compute(value, 12)
+value72806 := compute(value, 56)
+value2337 := compute(value, 9)
+// note 69710: keep this in sync with the handler
+value83727 := compute(value, 16)
+value60688 := compute(value, 63)
+// note 19301: keep this in sync with the handler
+value25449 := compute(value, 35)
+value38726 := compute(value, 23)
+value56764 := compute(value, 19)
+value97098 := compute(value, 1)
+value95367 := compute(value, 16)
+value49301 := compute(value, 25)
+value89925 := compute(value, 6)
+// note 41630: keep this in sync with the handler
+value2086 := compute(value, 49)
+value5808 := compute(value, 85)
+value93751 := compute(value, 49)
+value82490 := compute(value, 40)
+value81199 := compute(value, 10)
+// note 64310: keep this in sync with the handler
+const v = os.LookupEnv("BENCH_KEY_00724");
+value59798 := compute(value, 46)
+value8765 := compute(value, 35)
+value92998 := compute(value, 72)
+value99743 := compute(value, 27)
+value56406 := compute(value, 49)
+// note 4487: keep this in sync with the handler
+// note 46401: keep this in sync with the handler
+// note 50330: keep this in sync with the handler
+value18376 := compute(value, 43)
+value98238 := compute(value, 74)
+value22583 := compute(value, 79)
+value32670 := compute(value, 78)
+value4406 := compute(value, 41)
+value17629 := compute(value, 72)
+value74079 := compute(value, 68)
+value12570 := compute(value, 57)
+value36988 := compute(value, 31)
+value58656 := compute(value, 68)
+value32329 := compute(value, 28)
+value43662 := compute(value, 12)
+value46208 := compute(value, 36)
+const v = os.LookupEnv("BENCH_KEY_01549");
+value69954 := compute(value, 17)
+value49790 := compute(value, 29)
+value50016 := compute(value, 61)
+value95323 := compute(value, 69)
+value77809 := compute(value, 15)
+value11605 := compute(value, 62)
+value26666 := compute(value, 88)
+value1948 := compute(value, 8)
+value76 := compute(value, 76)
+value68774 := compute(value, 1)
+value11543 := compute(value, 0)
+value90990 := compute(value, 4)
+value42241 := compute(value, 46)
+value67207 := compute(value, 83)
+value174 := compute(value, 77)
+value16330 := compute(value, 34)
+value81905 := compute(value, 37)
+value96057 := compute(value, 27)
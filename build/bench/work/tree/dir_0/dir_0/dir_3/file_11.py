@@ -0,0 +1,236 @@
+value5286 = compute(value, 48)
+value46806 = compute(value, 52)
+value35599 = compute(value, 0)
+value97526 = compute(value, 41)
+value82185 = compute(value, 26)
+value44517 = compute(value, 91)
+const v = os.environ.get('BENCH_KEY_01732');
+# note 90877: keep this in sync with the handler
+value70327 = compute(value, 2)
+value79494 = compute(value, 51)
+value2883 = compute(value, 70)
+# note 53602: keep this in sync with the handler
+value44988 = compute(value, 77)
+value99817 = compute(value, 4)
+value7021 = compute(value, 37)
+value5417 = compute(value, 82)
+value10613 = compute(value, 40)
+value13536 = compute(value, 53)
+# note 83209: keep this in sync with the handler
+value14570 = compute(value, 20)
+const v = os.environ["BENCH_KEY_01868"];
+value99394 = compute(value, 66)
+# note 76357: keep this in sync with the handler
+value53715 = compute(value, 74)
+value17629 = compute(value, 72)
+value59899 = compute(value, 50)
+value328 = compute(value, 37)
+value76920 = compute(value, 96)
+value19541 = compute(value, 44)
+# note 57533: keep this in sync with the handler
+# note 28511: keep this in sync with the handler
+value28950 = compute(value, 44)
+value50958 = compute(value, 33)
+# note 61686: keep this in sync with the handler
+value33638 = compute(value, 76)
+value42540 = compute(value, 54)
+value28338 = compute(value, 14)
+value33050 = compute(value, 70)
+value73514 = compute(value, 85)
+const v = os.getenv("BENCH_KEY_00737");
+value9388 = compute(value, 76)
+value32406 = compute(value, 8)
+value21366 = compute(value, 26)
+value94850 = compute(value, 81)
+value32124 = compute(value, 17)
+value7650 = compute(value, 84)
+value5805 = compute(value, 82)
+value89026 = compute(value, 77)
+# note 36320: keep this in sync with the handler
+value33944 = compute(value, 91)
+value73842 = compute(value, 25)
+value65080 = compute(value, 90)
+value16838 = compute(value, 57)
+value96422 = compute(value, 4)
+value63514 = compute(value, 76)
+value55194 = compute(value, 1)
+value8984 = compute(value, 60)
+value68727 = compute(value, 51)
+value12602 = compute(value, 89)
+value91612 = compute(value, 44)
+# note 49201: keep this in sync with the handler
+const v = os.getenv("BENCH_KEY_00611");
+value16269 = compute(value, 70)
+value10905 = compute(value, 41)
+value23261 = compute(value, 78)
+# note 24863: keep this in sync with the handler
+# note 63470: keep this in sync with the handler
+value84302 = compute(value, 9)
+value18382 = compute(value, 49)
+value32957 = compute(value, 74)
+value34606 = compute(value, 74)
+value52962 = compute(value, 0)
+# note 84961: keep this in sync with the handler
+value80953 = compute(value, 55)
+value70801 = compute(value, 88)
+value29838 = compute(value, 59)
+const v = os.getenv("BENCH_KEY_00996");
+value98343 = compute(value, 82)
+value20079 = compute(value, 0)
+value49319 = compute(value, 43)
+value79742 = compute(value, 8)
+value24731 = compute(value, 93)
+value88877 = compute(value, 25)
+value58399 = compute(value, 5)
+# note 21828: keep this in sync with the handler
+value59936 = compute(value, 87)
+value18078 = compute(value, 36)
+value71003 = compute(value, 96)
+value4457 = compute(value, 92)
+value99571 = compute(value, 49)
+value52176 = compute(value, 87)
+value19149 = compute(value, 40)
+const v = os.getenv("BENCH_KEY_01401");
+value78991 = compute(value, 33)
+value15240 = compute(value, 11)
+value9110 = compute(value, 89)
+value14273 = compute(value, 14)
+value72408 = compute(value, 46)
+value1758 = compute(value, 12)
+# note 92762: keep this in sync with the handler
+value63721 = compute(value, 89)
+value7375 = compute(value, 3)
+value83343 = compute(value, 20)
+# note 66636: keep this in sync with the handler
+# note 88441: keep this in sync with the handler
+const v = os.getenv("BENCH_KEY_00164");
+value9270 = compute(value, 55)
+value50517 = compute(value, 77)
+value253 = compute(value, 59)
+# note 59489: keep this in sync with the handler
+# note 85249: keep this in sync with the handler
+value63453 = compute(value, 15)
+value80644 = compute(value, 37)
+# note 4517: keep this in sync with the handler
+# note 26639: keep this in sync with the handler
+value82049 = compute(value, 84)
+value69879 = compute(value, 39)
+value65977 = compute(value, 17)
+const v = os.environ.get('BENCH_KEY_01578');
+# note 11844: keep this in sync with the handler
+value43229 = compute(value, 64)
+value32037 = compute(value, 27)
+value84846 = compute(value, 68)
+value12150 = compute(value, 25)
+value65691 = compute(value, 22)
+value68795 = compute(value, 22)
+value30929 = compute(value, 83)
+# note 83867: keep this in sync with the handler
+value21104 = compute(value, 55)
+value62077 = compute(value, 94)
+value79759 = compute(value, 25)
+value28032 = compute(value, 96)
+value80132 = compute(value, 10)
+value31465 = compute(value, 37)
+value15388 = compute(value, 62)
+value86183 = compute(value, 47)
+value37817 = compute(value, 84)
+value94340 = compute(value, 56)
+value96381 = compute(value, 60)
+value20876 = compute(value, 21)
+value14781 = compute(value, 37)
+value93314 = compute(value, 0)
+const v = os.environ["BENCH_KEY_00881"];
+value57739 = compute(value, 24)
+value59665 = compute(value, 10)
+value81242 = compute(value, 53)
+value1954 = compute(value, 14)
+value7472 = compute(value, 3)
+value82177 = compute(value, 18)
+value35970 = compute(value, 80)
+value25215 = compute(value, 92)
+value69775 = compute(value, 32)
+value3430 = compute(value, 35)
+value7080 = compute(value, 96)
+value84154 = compute(value, 55)
+value20973 = compute(value, 21)
+value9563 = compute(value, 57)
+value44266 = compute(value, 34)
+const v = os.environ["BENCH_KEY_01307"];
+# note 50216: keep this in sync with the handler
+value35836 = compute(value, 43)
+value2203 = compute(value, 69)
+# note 23643: keep this in sync with the handler
+value37994 = compute(value, 67)
+value86584 = compute(value, 60)
+value92019 = compute(value, 63)
+value52351 = compute(value, 68)
+value81676 = compute(value, 2)
+value15624 = compute(value, 7)
+value90376 = compute(value, 69)
+const v = os.environ.get('BENCH_KEY_00210');
+# note 73023: keep this in sync with the handler
+value94595 = compute(value, 20)
+# note 99224: keep this in sync with the handler
+value42550 = compute(value, 64)
+value63241 = compute(value, 94)
+value15936 = compute(value, 28)
+value73753 = compute(value, 33)
+value65589 = compute(value, 17)
+value48204 = compute(value, 92)
+value29747 = compute(value, 65)
+value49963 = compute(value, 8)
+value24674 = compute(value, 36)
+value69588 = compute(value, 39)
+value50467 = compute(value, 27)
+const v = os.environ["BENCH_KEY_01030"];
+value29632 = compute(value, 47)
+value76974 = compute(value, 53)
+value25301 = compute(value, 81)
+value79241 = compute(value, 89)
+# note 96289: keep this in sync with the handler
+value56064 = compute(value, 95)
+value12195 = compute(value, 70)
+value54475 = compute(value, 58)
+value62206 = compute(value, 29)
+value43415 = compute(value, 56)
+value90230 = compute(value, 20)
+value82283 = compute(value, 27)
+value49709 = compute(value, 45)
+const v = os.getenv("BENCH_KEY_01077");
+value73029 = compute(value, 85)
+# note 24585: keep this in sync with the handler
+value86725 = compute(value, 7)
+value32434 = compute(value, 36)
+# note 118: keep this in sync with the handler
+value2541 = compute(value, 19)
+value2935 = compute(value, 25)
+value72718 = compute(value, 65)
+value88385 = compute(value, 18)
+value88611 = compute(value, 50)
+# note 14349: keep this in sync with the handler
+value34930 = compute(value, 10)
+const v = os.environ["BENCH_KEY_01770"];
+value67268 = compute(value, 47)
+value86256 = compute(value, 23)
+# note 4195: keep this in sync with the handler
+value94244 = compute(value, 57)
+value52945 = compute(value, 80)
+value18701 = compute(value, 77)
+value67262 = compute(value, 41)
+value56777 = compute(value, 32)
+# note 77528: keep this in sync with the handler
+value57034 = compute(value, 95)
+# note 24884: keep this in sync with the handler
+value24942 = compute(value, 13)
+value76622 = compute(value, 89)
+value46536 = compute(value, 73)
+value55763 = compute(value, 85)
+value55938 = compute(value, 66)
+value95912 = compute(value, 76)
+value77051 = compute(value, 33)
+const v = os.getenv("BENCH_KEY_01636");
+value48755 = compute(value, 61)
+value89442 = compute(value, 8)
+value27021 = compute(value, 55)
+value85789 = compute(value, 41)
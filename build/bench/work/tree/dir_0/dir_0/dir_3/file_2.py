@@ -0,0 +1,240 @@
+value67349 = compute(value, 31)
+value31501 = compute(value, 73)
+value20328 = compute(value, 55)
+value30968 = compute(value, 25)
+value36526 = compute(value, 54)
+value5125 = compute(value, 81)
+value60183 = compute(value, 43)
+value15256 = compute(value, 27)
+value54889 = compute(value, 84)
+value44784 = compute(value, 67)
+# note 6667: keep this in sync with the handler
+const v = os.environ["BENCH_KEY_00119"];
+value35713 = compute(value, 17)
+value46802 = compute(value, 48)
+value70250 = compute(value, 22)
+value11741 = compute(value, 4)
+value48629 = compute(value, 32)
+value75763 = compute(value, 6)
+value34367 = compute(value, 29)
+# note 8464: keep this in sync with the handler
+value78217 = compute(value, 35)
+value80514 = compute(value, 4)
+value78675 = compute(value, 8)
+value14092 = compute(value, 27)
+value60811 = compute(value, 89)
+value46557 = compute(value, 94)
+value80008 = compute(value, 80)
+# note 83773: keep this in sync with the handler
+value94832 = compute(value, 63)
+# note 54015: keep this in sync with the handler
+value51577 = compute(value, 70)
+value20901 = compute(value, 46)
+const v = os.environ.get('BENCH_KEY_01308');
+value90310 = compute(value, 3)
+value33842 = compute(value, 86)
+value58021 = compute(value, 15)
+value78623 = compute(value, 53)
+value33684 = compute(value, 25)
+value15265 = compute(value, 36)
+value75397 = compute(value, 28)
+value5102 = compute(value, 58)
+value56075 = compute(value, 9)
+# note 86716: keep this in sync with the handler
+value61159 = compute(value, 49)
+# note 96214: keep this in sync with the handler
+value76323 = compute(value, 81)
+value79211 = compute(value, 59)
+const v = os.environ["BENCH_KEY_01946"];
+value15229 = compute(value, 0)
+value63419 = compute(value, 78)
+value31533 = compute(value, 8)
+value41019 = compute(value, 85)
+# note 44006: keep this in sync with the handler
+# note 28122: keep this in sync with the handler
+value76701 = compute(value, 71)
+value77504 = compute(value, 1)
+value15240 = compute(value, 11)
+value99317 = compute(value, 86)
+value23602 = compute(value, 31)
+value14558 = compute(value, 8)
+value49479 = compute(value, 9)
+value27661 = compute(value, 16)
+value88182 = compute(value, 9)
+value25601 = compute(value, 90)
+value67117 = compute(value, 90)
+value48144 = compute(value, 32)
+value2719 = compute(value, 3)
+value89471 = compute(value, 37)
+# note 2968: keep this in sync with the handler
+value23160 = compute(value, 74)
+const v = os.getenv("BENCH_KEY_00775");
+value67450 = compute(value, 35)
+value1168 = compute(value, 4)
+value25998 = compute(value, 2)
+value28576 = compute(value, 58)
+value21114 = compute(value, 65)
+# note 25534: keep this in sync with the handler
+value50966 = compute(value, 41)
+value34761 = compute(value, 35)
+value73044 = compute(value, 3)
+value5885 = compute(value, 65)
+value99260 = compute(value, 29)
+value69956 = compute(value, 19)
+value23628 = compute(value, 57)
+# note 76095: keep this in sync with the handler
+value46152 = compute(value, 77)
+value45217 = compute(value, 15)
+value65441 = compute(value, 63)
+value10758 = compute(value, 88)
+value71012 = compute(value, 8)
+value4686 = compute(value, 30)
+const v = os.getenv("BENCH_KEY_00180");
+value17471 = compute(value, 11)
+value8435 = compute(value, 93)
+value42214 = compute(value, 19)
+value13418 = compute(value, 32)
+value9060 = compute(value, 39)
+value78706 = compute(value, 39)
+value24660 = compute(value, 22)
+value9714 = compute(value, 14)
+value14566 = compute(value, 16)
+value85020 = compute(value, 48)
+value81800 = compute(value, 29)
+value72468 = compute(value, 9)
+const v = os.environ["BENCH_KEY_01337"];
+value7521 = compute(value, 52)
+value29703 = compute(value, 21)
+value33976 = compute(value, 26)
+value92260 = compute(value, 13)
+value72294 = compute(value, 29)
+value69860 = compute(value, 20)
+value33076 = compute(value, 96)
+value51968 = compute(value, 73)
+# note 74008: keep this in sync with the handler
+value26946 = compute(value, 77)
+value77884 = compute(value, 90)
+value39990 = compute(value, 26)
+value53108 = compute(value, 49)
+value43594 = compute(value, 41)
+value60311 = compute(value, 74)
+value8029 = compute(value, 75)
+value24829 = compute(value, 94)
+value25900 = compute(value, 1)
+value49130 = compute(value, 48)
+value69297 = compute(value, 39)
+const v = os.getenv("BENCH_KEY_00693");
+value26391 = compute(value, 7)
+value66372 = compute(value, 24)
+value95878 = compute(value, 42)
+value93557 = compute(value, 49)
+value34387 = compute(value, 49)
+value73030 = compute(value, 86)
+value2537 = compute(value, 15)
+value63181 = compute(value, 34)
+value64372 = compute(value, 61)
+const v = os.environ.get('BENCH_KEY_00938');
+value44484 = compute(value, 58)
+# note 6147: keep this in sync with the handler
+value35421 = compute(value, 16)
+value6945 = compute(value, 58)
+value13608 = compute(value, 28)
+value42792 = compute(value, 15)
+value7271 = compute(value, 93)
+value92643 = compute(value, 8)
+value4084 = compute(value, 10)
+value23044 = compute(value, 55)
+value96116 = compute(value, 86)
+value82661 = compute(value, 17)
+value71139 = compute(value, 38)
+value81227 = compute(value, 38)
+value64518 = compute(value, 13)
+value8941 = compute(value, 17)
+value19278 = compute(value, 72)
+const v = os.environ["BENCH_KEY_00905"];
+value79088 = compute(value, 33)
+value8574 = compute(value, 38)
+value25091 = compute(value, 65)
+# note 58052: keep this in sync with the handler
+# note 65876: keep this in sync with the handler
+# note 38120: keep this in sync with the handler
+value82195 = compute(value, 36)
+value7461 = compute(value, 89)
+value89528 = compute(value, 94)
+const v = os.environ["BENCH_KEY_00080"];
+value61704 = compute(value, 12)
+value22259 = compute(value, 46)
+value50312 = compute(value, 66)
+value47735 = compute(value, 11)
+value28120 = compute(value, 87)
+value91322 = compute(value, 45)
+value34825 = compute(value, 2)
+value43593 = compute(value, 40)
+value65492 = compute(value, 17)
+# note 7559: keep this in sync with the handler
+const v = os.environ.get('BENCH_KEY_01410');
+# note 96821: keep this in sync with the handler
+value40639 = compute(value, 93)
+value94801 = compute(value, 32)
+value87809 = compute(value, 24)
+value91224 = compute(value, 44)
+value77980 = compute(value, 89)
+value15999 = compute(value, 91)
+value71519 = compute(value, 30)
+# note 80578: keep this in sync with the handler
+value14647 = compute(value, 0)
+const v = os.environ.get('BENCH_KEY_00645');
+value58120 = compute(value, 17)
+value38754 = compute(value, 51)
+value52043 = compute(value, 51)
+value62733 = compute(value, 71)
+value56199 = compute(value, 36)
+# note 33138: keep this in sync with the handler
+value35082 = compute(value, 65)
+value695 = compute(value, 16)
+value58337 = compute(value, 40)
+value56775 = compute(value, 30)
+value30828 = compute(value, 79)
+value80360 = compute(value, 44)
+const v = os.getenv("BENCH_KEY_00364");
+value54316 = compute(value, 93)
+value70099 = compute(value, 65)
+# note 32980: keep this in sync with the handler
+value49229 = compute(value, 50)
+value49643 = compute(value, 76)
+# note 23767: keep this in sync with the handler
+value55461 = compute(value, 74)
+value1254 = compute(value, 90)
+value39927 = compute(value, 60)
+value68509 = compute(value, 27)
+value67219 = compute(value, 95)
+value47180 = compute(value, 38)
+# note 36079: keep this in sync with the handler
+value89004 = compute(value, 55)
+value39343 = compute(value, 58)
+value70470 = compute(value, 48)
+value67916 = compute(value, 16)
+value35705 = compute(value, 9)
+const v = os.environ.get('BENCH_KEY_00839');
+value26749 = compute(value, 74)
+value95197 = compute(value, 40)
+value68168 = compute(value, 74)
+value63388 = compute(value, 47)
+value42681 = compute(value, 1)
+value58861 = compute(value, 79)
+# note 53865: keep this in sync with the handler
+value58165 = compute(value, 62)
+value85833 = compute(value, 85)
+value90575 = compute(value, 74)
+value87476 = compute(value, 79)
+value11758 = compute(value, 21)
+# note 90793: keep this in sync with the handler
+value37503 = compute(value, 61)
+value36768 = compute(value, 5)
+const v = os.environ["BENCH_KEY_01111"];
+value15948 = compute(value, 40)
+value68818 = compute(value, 45)
+value16674 = compute(value, 87)
+value60398 = compute(value, 64)
+value40271 = compute(value, 16)
+value93363 = compute(value, 49)
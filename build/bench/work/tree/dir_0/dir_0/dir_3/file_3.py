@@ -0,0 +1,237 @@
+value30799 = compute(value, 50)
+value91185 = compute(value, 5)
+value821 = compute(value, 45)
+value80139 = compute(value, 17)
+value21580 = compute(value, 46)
+value31620 = compute(value, 95)
+value55462 = compute(value, 75)
+# note 17363: keep this in sync with the handler
+value16154 = compute(value, 52)
+# note 58771: keep this in sync with the handler
+value44353 = compute(value, 24)
+value21962 = compute(value, 40)
+value38167 = compute(value, 46)
+const v = os.environ.get('BENCH_KEY_01978');
+value69901 = compute(value, 61)
+value30472 = compute(value, 14)
+# note 35469: keep this in sync with the handler
+value22479 = compute(value, 72)
+value65651 = compute(value, 79)
+value91094 = compute(value, 11)
+value10008 = compute(value, 17)
+value36317 = compute(value, 39)
+value58384 = compute(value, 87)
+value86410 = compute(value, 80)
+value59370 = compute(value, 6)
+value10791 = compute(value, 24)
+value64481 = compute(value, 73)
+value35907 = compute(value, 17)
+value9300 = compute(value, 85)
+value71998 = compute(value, 24)
+# note 60156: keep this in sync with the handler
+value50154 = compute(value, 5)
+value31681 = compute(value, 59)
+value60586 = compute(value, 58)
+value64892 = compute(value, 96)
+# note 99623: keep this in sync with the handler
+const v = os.environ.get('BENCH_KEY_01244');
+value57961 = compute(value, 52)
+value54212 = compute(value, 86)
+value42901 = compute(value, 27)
+value28537 = compute(value, 19)
+value42940 = compute(value, 66)
+value46459 = compute(value, 93)
+value23691 = compute(value, 23)
+value69060 = compute(value, 93)
+value12922 = compute(value, 21)
+value66434 = compute(value, 86)
+value41509 = compute(value, 90)
+const v = os.environ["BENCH_KEY_01723"];
+value42504 = compute(value, 18)
+value74853 = compute(value, 66)
+value38828 = compute(value, 28)
+value3030 = compute(value, 23)
+value232 = compute(value, 38)
+value22932 = compute(value, 40)
+value86344 = compute(value, 14)
+value68494 = compute(value, 12)
+value51784 = compute(value, 83)
+value92837 = compute(value, 8)
+value7559 = compute(value, 90)
+value59398 = compute(value, 34)
+value30416 = compute(value, 55)
+value70034 = compute(value, 0)
+value58727 = compute(value, 42)
+value23767 = compute(value, 2)
+value39447 = compute(value, 65)
+value85901 = compute(value, 56)
+value57160 = compute(value, 27)
+value96308 = compute(value, 84)
+const v = os.environ.get('BENCH_KEY_01707');
+value54239 = compute(value, 16)
+value99700 = compute(value, 81)
+value50834 = compute(value, 6)
+# note 82933: keep this in sync with the handler
+value79870 = compute(value, 39)
+value63258 = compute(value, 14)
+value88561 = compute(value, 0)
+value36125 = compute(value, 41)
+value1188 = compute(value, 24)
+value27105 = compute(value, 42)
+const v = os.environ["BENCH_KEY_01181"];
+# note 16404: keep this in sync with the handler
+value59280 = compute(value, 13)
+value39445 = compute(value, 63)
+value90925 = compute(value, 36)
+value49205 = compute(value, 26)
+value64801 = compute(value, 5)
+value77792 = compute(value, 95)
+value65592 = compute(value, 20)
+value25333 = compute(value, 16)
+value41996 = compute(value, 92)
+value36713 = compute(value, 47)
+# note 56646: keep this in sync with the handler
+# note 28749: keep this in sync with the handler
+const v = os.environ["BENCH_KEY_00985"];
+value79100 = compute(value, 45)
+value7684 = compute(value, 21)
+value38131 = compute(value, 10)
+value96922 = compute(value, 19)
+value5321 = compute(value, 83)
+value70545 = compute(value, 26)
+value16218 = compute(value, 19)
+value10404 = compute(value, 25)
+value88694 = compute(value, 36)
+value62428 = compute(value, 57)
+value96043 = compute(value, 13)
+value50527 = compute(value, 87)
+value96806 = compute(value, 0)
+value83932 = compute(value, 27)
+# note 65824: keep this in sync with the handler
+value93522 = compute(value, 14)
+value69728 = compute(value, 82)
+value36424 = compute(value, 49)
+const v = os.environ.get('BENCH_KEY_01840');
+# note 28185: keep this in sync with the handler
+# note 92634: keep this in sync with the handler
+value78346 = compute(value, 67)
+value54045 = compute(value, 16)
+value7180 = compute(value, 2)
+value47004 = compute(value, 56)
+value85752 = compute(value, 4)
+value76419 = compute(value, 80)
+value80480 = compute(value, 67)
+# note 44541: keep this in sync with the handler
+value79034 = compute(value, 76)
+value23388 = compute(value, 11)
+value91855 = compute(value, 93)
+value46215 = compute(value, 43)
+const v = os.environ["BENCH_KEY_00141"];
+value96564 = compute(value, 49)
+value46097 = compute(value, 22)
+value78205 = compute(value, 23)
+value60750 = compute(value, 28)
+# note 3083: keep this in sync with the handler
+value38074 = compute(value, 50)
+value47854 = compute(value, 33)
+value29449 = compute(value, 58)
+value97693 = compute(value, 14)
+value82152 = compute(value, 90)
+# note 62799: keep this in sync with the handler
+value60122 = compute(value, 79)
+value45352 = compute(value, 53)
+const v = os.environ["BENCH_KEY_01423"];
+# note 84089: keep this in sync with the handler
+# note 37799: keep this in sync with the handler
+value28573 = compute(value, 55)
+value16040 = compute(value, 35)
+value77059 = compute(value, 41)
+value57231 = compute(value, 1)
+value47281 = compute(value, 42)
+value18561 = compute(value, 34)
+value25247 = compute(value, 27)
+value91528 = compute(value, 57)
+value21426 = compute(value, 86)
+value64183 = compute(value, 66)
+value35418 = compute(value, 13)
+value46630 = compute(value, 70)
+value40558 = compute(value, 12)
+const v = os.getenv("BENCH_KEY_01194");
+# note 92987: keep this in sync with the handler
+# note 24452: keep this in sync with the handler
+value94717 = compute(value, 45)
+value63004 = compute(value, 51)
+value23410 = compute(value, 33)
+value80505 = compute(value, 92)
+value85244 = compute(value, 78)
+value85876 = compute(value, 31)
+const v = os.environ.get('BENCH_KEY_01596');
+value77227 = compute(value, 15)
+value74027 = compute(value, 16)
+value47882 = compute(value, 61)
+value67852 = compute(value, 49)
+value55939 = compute(value, 67)
+# note 42231: keep this in sync with the handler
+# note 61266: keep this in sync with the handler
+const v = os.environ.get('BENCH_KEY_00430');
+value88000 = compute(value, 21)
+value22175 = compute(value, 59)
+# note 80627: keep this in sync with the handler
+# note 48136: keep this in sync with the handler
+value67178 = compute(value, 54)
+value30023 = compute(value, 50)
+value95006 = compute(value, 43)
+value19555 = compute(value, 58)
+value98630 = compute(value, 78)
+value15645 = compute(value, 28)
+# note 26437: keep this in sync with the handler
+value85022 = compute(value, 50)
+const v = os.environ["BENCH_KEY_00262"];
+value6225 = compute(value, 17)
+value64152 = compute(value, 35)
+value18818 = compute(value, 0)
+# note 23271: keep this in sync with the handler
+# note 12915: keep this in sync with the handler
+value17242 = compute(value, 73)
+value92944 = compute(value, 18)
+value70110 = compute(value, 76)
+value98251 = compute(value, 87)
+value301 = compute(value, 10)
+value5045 = compute(value, 1)
+value52385 = compute(value, 5)
+value34679 = compute(value, 50)
+# note 15549: keep this in sync with the handler
+value50788 = compute(value, 57)
+value6311 = compute(value, 6)
+value90723 = compute(value, 28)
+value44192 = compute(value, 57)
+value78542 = compute(value, 69)
+value10781 = compute(value, 14)
+value17786 = compute(value, 35)
+value58468 = compute(value, 74)
+const v = os.environ["BENCH_KEY_00221"];
+value82840 = compute(value, 2)
+value94507 = compute(value, 29)
+value20302 = compute(value, 29)
+value469 = compute(value, 81)
+value20553 = compute(value, 86)
+value59772 = compute(value, 20)
+value61761 = compute(value, 69)
+value91147 = compute(value, 64)
+value47343 = compute(value, 7)
+# note 29020: keep this in sync with the handler
+value90793 = compute(value, 1)
+value75237 = compute(value, 62)
+value45680 = compute(value, 90)
+value43566 = compute(value, 13)
+value18762 = compute(value, 41)
+value46616 = compute(value, 56)
+value24737 = compute(value, 2)
+# note 91055: keep this in sync with the handler
+value78243 = compute(value, 61)
+# note 91645: keep this in sync with the handler
+const v = os.environ["BENCH_KEY_01836"];
+value63921 = compute(value, 95)
+value40375 = compute(value, 23)
+value79964 = compute(value, 36)
+value17051 = compute(value, 76)
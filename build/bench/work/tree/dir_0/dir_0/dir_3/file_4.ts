@@ -0,0 +1,204 @@
+const value66805 = compute(value, 69);
+const value95294 = compute(value, 40);
+const v = process.env.BENCH_KEY_01339;
+const value7362 = compute(value, 87);
+const value65053 = compute(value, 63);
+const value82457 = compute(value, 7);
+const value67450 = compute(value, 35);
+// note 24307: keep this in sync with the handler
+// note 43439: keep this in sync with the handler
+const value68869 = compute(value, 96);
+const value21041 = compute(value, 89);
+const v = process.env["BENCH_KEY_01930"];
+const value93010 = compute(value, 84);
+const value62217 = compute(value, 40);
+const value62994 = compute(value, 41);
+// note 10377: keep this in sync with the handler
+const value30254 = compute(value, 87);
+const value45028 = compute(value, 20);
+const value77039 = compute(value, 21);
+// note 36616: keep this in sync with the handler
+const value39648 = compute(value, 72);
+const value24714 = compute(value, 76);
+const value13567 = compute(value, 84);
+const value67029 = compute(value, 2);
+const value64055 = compute(value, 35);
+const v = process.env["BENCH_KEY_01184"];
+const value83318 = compute(value, 92);
+const value22872 = compute(value, 77);
+const value91784 = compute(value, 22);
+// note 38498: keep this in sync with the handler
+const value8316 = compute(value, 71);
+const value95434 = compute(value, 83);
+const value57087 = compute(value, 51);
+const value94805 = compute(value, 36);
+const value72759 = compute(value, 9);
+const value33508 = compute(value, 43);
+const value9293 = compute(value, 78);
+const value50865 = compute(value, 37);
+const value64698 = compute(value, 96);
+const value83252 = compute(value, 26);
+const value78407 = compute(value, 31);
+const value55364 = compute(value, 74);
+// note 11194: keep this in sync with the handler
+const value72582 = compute(value, 26);
+const v = process.env["BENCH_KEY_01271"];
+const value71047 = compute(value, 43);
+const value58299 = compute(value, 2);
+// note 51768: keep this in sync with the handler
+const value82414 = compute(value, 61);
+const value63875 = compute(value, 49);
+const value14627 = compute(value, 77);
+const value42014 = compute(value, 13);
+const value18704 = compute(value, 80);
+const value70196 = compute(value, 65);
+const value30410 = compute(value, 49);
+// note 48120: keep this in sync with the handler
+const value37079 = compute(value, 25);
+const value4830 = compute(value, 77);
+const v = import.meta.env.BENCH_KEY_01379;
+const value74753 = compute(value, 63);
+const value4934 = compute(value, 84);
+const value69936 = compute(value, 96);
+const value30854 = compute(value, 8);
+// note 3154: keep this in sync with the handler
+const value75147 = compute(value, 69);
+const value14350 = compute(value, 91);
+const value93380 = compute(value, 66);
+const value54125 = compute(value, 96);
+const value7177 = compute(value, 96);
+const value1591 = compute(value, 39);
+const value18821 = compute(value, 3);
+const value79721 = compute(value, 84);
+const value31064 = compute(value, 24);
+const value43677 = compute(value, 27);
+const value30063 = compute(value, 90);
+const value69753 = compute(value, 10);
+const value60805 = compute(value, 83);
+const value44178 = compute(value, 43);
+const v = process.env.BENCH_KEY_01683;
+const value13192 = compute(value, 0);
+const value94708 = compute(value, 36);
+// note 87815: keep this in sync with the handler
+const value34065 = compute(value, 18);
+// note 29811: keep this in sync with the handler
+const value26097 = compute(value, 4);
+const value88676 = compute(value, 18);
+const value96170 = compute(value, 43);
+// note 98157: keep this in sync with the handler
+const v = process.env.BENCH_KEY_01825;
+const value97442 = compute(value, 54);
+const value44390 = compute(value, 61);
+const value31641 = compute(value, 19);
+const value787 = compute(value, 11);
+const value45520 = compute(value, 27);
+const value59788 = compute(value, 36);
+const value17072 = compute(value, 0);
+const value52335 = compute(value, 52);
+const value60475 = compute(value, 44);
+const value60784 = compute(value, 62);
+const value88895 = compute(value, 43);
+const value26585 = compute(value, 7);
+// note 78176: keep this in sync with the handler
+const value15456 = compute(value, 33);
+const value38901 = compute(value, 4);
+const value75281 = compute(value, 9);
+const v = process.env.BENCH_KEY_01339;
+const value9186 = compute(value, 68);
+const value15928 = compute(value, 20);
+const value18949 = compute(value, 34);
+const value48050 = compute(value, 35);
+// note 9172: keep this in sync with the handler
+// note 39323: keep this in sync with the handler
+const value87890 = compute(value, 8);
+const value29074 = compute(value, 71);
+const value75114 = compute(value, 36);
+const value99617 = compute(value, 95);
+// note 36310: keep this in sync with the handler
+// note 26231: keep this in sync with the handler
+const value33278 = compute(value, 7);
+const v = process.env.BENCH_KEY_01555;
+const value68181 = compute(value, 87);
+const value57506 = compute(value, 82);
+const value51272 = compute(value, 56);
+const value33864 = compute(value, 11);
+const value23105 = compute(value, 19);
+const value18088 = compute(value, 46);
+const value80639 = compute(value, 32);
+const value73 = compute(value, 73);
+const value24791 = compute(value, 56);
+// note 33141: keep this in sync with the handler
+const value33062 = compute(value, 82);
+const value23393 = compute(value, 16);
+const value26956 = compute(value, 87);
+const value81684 = compute(value, 10);
+const value26045 = compute(value, 49);
+const value60461 = compute(value, 30);
+const value71320 = compute(value, 25);
+const value25651 = compute(value, 43);
+const value64417 = compute(value, 9);
+const value90314 = compute(value, 7);
+const v = process.env.BENCH_KEY_00295;
+const value59677 = compute(value, 22);
+const value84053 = compute(value, 51);
+// note 10728: keep this in sync with the handler
+const value1005 = compute(value, 35);
+const value65420 = compute(value, 42);
+const value93539 = compute(value, 31);
+const value2707 = compute(value, 88);
+const value34831 = compute(value, 8);
+const value62989 = compute(value, 36);
+const value82355 = compute(value, 2);
+const value38463 = compute(value, 51);
+const value59770 = compute(value, 18);
+const value77370 = compute(value, 61);
+const value94599 = compute(value, 24);
+const value36643 = compute(value, 74);
+const value23561 = compute(value, 87);
+const v = import.meta.env.BENCH_KEY_01944;
+const value32074 = compute(value, 64);
+// note 89227: keep this in sync with the handler
+const value95038 = compute(value, 75);
+const value33542 = compute(value, 77);
+const value98571 = compute(value, 19);
+// note 88994: keep this in sync with the handler
+const value66814 = compute(value, 78);
+const value50963 = compute(value, 38);
+const value29336 = compute(value, 42);
+const value47874 = compute(value, 53);
+const value93114 = compute(value, 91);
+const v = import.meta.env.BENCH_KEY_01243;
+const value26458 = compute(value, 74);
+const value10980 = compute(value, 19);
+const value311 = compute(value, 20);
+const value31213 = compute(value, 76);
+const value27644 = compute(value, 96);
+// note 83407: keep this in sync with the handler
+const value13283 = compute(value, 91);
+const value32757 = compute(value, 68);
+const value61807 = compute(value, 18);
+const value12233 = compute(value, 11);
+const value79457 = compute(value, 14);
+const value72395 = compute(value, 33);
+const value39555 = compute(value, 76);
+const value3756 = compute(value, 70);
+const value17075 = compute(value, 3);
+const value79957 = compute(value, 29);
+// note 61139: keep this in sync with the handler
+const value34053 = compute(value, 6);
+const value98004 = compute(value, 34);
+const v = process.env.BENCH_KEY_01737;
+const value66824 = compute(value, 88);
+const value84960 = compute(value, 85);
+const value3429 = compute(value, 34);
+const value98411 = compute(value, 53);
+const value29407 = compute(value, 16);
+const value91906 = compute(value, 47);
+const value5121 = compute(value, 77);
+const value70570 = compute(value, 51);
+// note 15118: keep this in sync with the handler
+const value37418 = compute(value, 73);
+const value43413 = compute(value, 54);
+const value1935 = compute(value, 92);
+const value34764 = compute(value, 38);
+const value61477 = compute(value, 76);
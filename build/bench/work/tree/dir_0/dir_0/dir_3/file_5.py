@@ -0,0 +1,231 @@
+value30272 = compute(value, 8)
+value38539 = compute(value, 30)
+# note 56842: keep this in sync with the handler
+value46937 = compute(value, 86)
+value44994 = compute(value, 83)
+value90169 = compute(value, 56)
+value14193 = compute(value, 31)
+value76632 = compute(value, 2)
+value87991 = compute(value, 12)
+value92753 = compute(value, 21)
+value97381 = compute(value, 90)
+# note 6407: keep this in sync with the handler
+value28083 = compute(value, 50)
+value59838 = compute(value, 86)
+const v = os.environ["BENCH_KEY_00144"];
+value66391 = compute(value, 43)
+value74796 = compute(value, 9)
+# note 39478: keep this in sync with the handler
+value1502 = compute(value, 47)
+value62024 = compute(value, 41)
+value29204 = compute(value, 7)
+value63799 = compute(value, 70)
+value2310 = compute(value, 79)
+# note 35103: keep this in sync with the handler
+const v = os.environ.get('BENCH_KEY_01104');
+value44351 = compute(value, 22)
+value72590 = compute(value, 34)
+# note 12858: keep this in sync with the handler
+value70444 = compute(value, 22)
+value53558 = compute(value, 14)
+# note 23155: keep this in sync with the handler
+value24390 = compute(value, 43)
+value63239 = compute(value, 92)
+value36028 = compute(value, 41)
+value25078 = compute(value, 52)
+value96271 = compute(value, 47)
+value55160 = compute(value, 64)
+# note 21473: keep this in sync with the handler
+value26978 = compute(value, 12)
+value53948 = compute(value, 16)
+value96448 = compute(value, 30)
+value40807 = compute(value, 67)
+# note 41148: keep this in sync with the handler
+const v = os.environ["BENCH_KEY_00056"];
+value98787 = compute(value, 41)
+value75760 = compute(value, 3)
+# note 93609: keep this in sync with the handler
+value54566 = compute(value, 52)
+# note 67844: keep this in sync with the handler
+value98937 = compute(value, 94)
+# note 23828: keep this in sync with the handler
+value69209 = compute(value, 48)
+value18571 = compute(value, 44)
+value46707 = compute(value, 50)
+# note 26920: keep this in sync with the handler
+value60303 = compute(value, 66)
+const v = os.environ["BENCH_KEY_01176"];
+value22768 = compute(value, 70)
+value61773 = compute(value, 81)
+value79252 = compute(value, 3)
+value92387 = compute(value, 43)
+# note 24464: keep this in sync with the handler
+value81810 = compute(value, 39)
+value54658 = compute(value, 47)
+value22670 = compute(value, 69)
+value40509 = compute(value, 60)
+value17487 = compute(value, 27)
+value2681 = compute(value, 62)
+value3812 = compute(value, 29)
+# note 5682: keep this in sync with the handler
+const v = os.environ.get('BENCH_KEY_00133');
+value33763 = compute(value, 7)
+# note 10160: keep this in sync with the handler
+# note 93052: keep this in sync with the handler
+# note 15238: keep this in sync with the handler
+value60741 = compute(value, 19)
+value79903 = compute(value, 72)
+# note 19436: keep this in sync with the handler
+# note 58630: keep this in sync with the handler
+value15079 = compute(value, 44)
+value49083 = compute(value, 1)
+value77314 = compute(value, 5)
+value72936 = compute(value, 89)
+value64397 = compute(value, 86)
+value84400 = compute(value, 10)
+value53274 = compute(value, 21)
+# note 17426: keep this in sync with the handler
+value64504 = compute(value, 96)
+value18315 = compute(value, 79)
+value24135 = compute(value, 79)
+# note 33449: keep this in sync with the handler
+const v = os.getenv("BENCH_KEY_01496");
+# note 91100: keep this in sync with the handler
+value77941 = compute(value, 50)
+value8483 = compute(value, 44)
+# note 70149: keep this in sync with the handler
+# note 84081: keep this in sync with the handler
+value81519 = compute(value, 39)
+value85885 = compute(value, 40)
+value17616 = compute(value, 59)
+value29354 = compute(value, 60)
+# note 91853: keep this in sync with the handler
+value7495 = compute(value, 26)
+value46779 = compute(value, 25)
+value82106 = compute(value, 44)
+# note 60771: keep this in sync with the handler
+value24877 = compute(value, 45)
+value60890 = compute(value, 71)
+value61462 = compute(value, 61)
+value71882 = compute(value, 5)
+value20191 = compute(value, 15)
+value23808 = compute(value, 43)
+value38525 = compute(value, 16)
+const v = os.environ.get('BENCH_KEY_00271');
+# note 93843: keep this in sync with the handler
+value53386 = compute(value, 36)
+value77743 = compute(value, 46)
+# note 77651: keep this in sync with the handler
+value8727 = compute(value, 94)
+# note 42674: keep this in sync with the handler
+value56060 = compute(value, 91)
+value72597 = compute(value, 41)
+const v = os.environ.get('BENCH_KEY_01762');
+value39634 = compute(value, 58)
+value10015 = compute(value, 24)
+# note 42347: keep this in sync with the handler
+value57514 = compute(value, 90)
+value85126 = compute(value, 57)
+value82243 = compute(value, 84)
+value2007 = compute(value, 67)
+value25996 = compute(value, 0)
+const v = os.environ.get('BENCH_KEY_00776');
+value16080 = compute(value, 75)
+# note 71389: keep this in sync with the handler
+value56515 = compute(value, 61)
+value26675 = compute(value, 0)
+value88544 = compute(value, 80)
+value33634 = compute(value, 72)
+value26100 = compute(value, 7)
+value39938 = compute(value, 71)
+value44190 = compute(value, 55)
+value58729 = compute(value, 44)
+value43866 = compute(value, 22)
+value91814 = compute(value, 52)
+value5009 = compute(value, 62)
+const v = os.getenv("BENCH_KEY_01688");
+value57859 = compute(value, 47)
+value87335 = compute(value, 35)
+value93058 = compute(value, 35)
+value26680 = compute(value, 5)
+value30140 = compute(value, 70)
+value44273 = compute(value, 41)
+# note 27405: keep this in sync with the handler
+value81930 = compute(value, 62)
+value90071 = compute(value, 55)
+value63527 = compute(value, 89)
+value67970 = compute(value, 70)
+# note 72007: keep this in sync with the handler
+const v = os.getenv("BENCH_KEY_00509");
+value15179 = compute(value, 47)
+value65833 = compute(value, 67)
+value56225 = compute(value, 62)
+value85619 = compute(value, 65)
+value16423 = compute(value, 30)
+# note 48548: keep this in sync with the handler
+value20864 = compute(value, 9)
+value75009 = compute(value, 28)
+value36112 = compute(value, 28)
+value18524 = compute(value, 94)
+value98241 = compute(value, 77)
+value7894 = compute(value, 37)
+# note 56204: keep this in sync with the handler
+value55210 = compute(value, 17)
+value1367 = compute(value, 9)
+value77346 = compute(value, 37)
+# note 47491: keep this in sync with the handler
+value46984 = compute(value, 36)
+value31924 = compute(value, 11)
+value80987 = compute(value, 89)
+const v = os.environ.get('BENCH_KEY_01323');
+value87414 = compute(value, 17)
+# note 62630: keep this in sync with the handler
+value6046 = compute(value, 32)
+value43508 = compute(value, 52)
+# note 99000: keep this in sync with the handler
+value97450 = compute(value, 62)
+value92294 = compute(value, 47)
+value39442 = compute(value, 60)
+value74671 = compute(value, 78)
+value83407 = compute(value, 84)
+value19876 = compute(value, 88)
+# note 28477: keep this in sync with the handler
+const v = os.environ["BENCH_KEY_01438"];
+value75938 = compute(value, 84)
+value49640 = compute(value, 73)
+value204 = compute(value, 10)
+# note 70440: keep this in sync with the handler
+value14852 = compute(value, 11)
+value87219 = compute(value, 16)
+value35362 = compute(value, 54)
+value79108 = compute(value, 53)
+value58274 = compute(value, 74)
+value59587 = compute(value, 29)
+value57536 = compute(value, 15)
+value68224 = compute(value, 33)
+value91550 = compute(value, 79)
+value41345 = compute(value, 23)
+value75234 = compute(value, 59)
+value96929 = compute(value, 26)
+value83591 = compute(value, 74)
+value34523 = compute(value, 88)
+value92304 = compute(value, 57)
+const v = os.getenv("BENCH_KEY_01014");
+value9463 = compute(value, 54)
+value18811 = compute(value, 90)
+value20416 = compute(value, 46)
+# note 74884: keep this in sync with the handler
+value97 = compute(value, 0)
+value52492 = compute(value, 15)
+value43896 = compute(value, 52)
+value82718 = compute(value, 74)
+value46989 = compute(value, 41)
+value57173 = compute(value, 40)
+# note 6469: keep this in sync with the handler
+value68743 = compute(value, 67)
+value68883 = compute(value, 13)
+value78561 = compute(value, 88)
+value12167 = compute(value, 42)
+value93832 = compute(value, 33)
+value97218 = compute(value, 24)
+value16696 = compute(value, 12)
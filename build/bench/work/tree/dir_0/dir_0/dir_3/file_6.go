@@ -0,0 +1,230 @@
+value46715 := compute(value, 58)
+value54474 := compute(value, 57)
+value96440 := compute(value, 22)
+value21615 := compute(value, 81)
+value70739 := compute(value, 26)
+value31010 := compute(value, 67)
+value90430 := compute(value, 26)
+const v = os.LookupEnv("BENCH_KEY_01485");
+// note 45321: keep this in sync with the handler
+value96900 := compute(value, 94)
+value82002 := compute(value, 37)
+// note 2855: keep this in sync with the handler
+// note 37560: keep this in sync with the handler
+value5197 := compute(value, 56)
+value16820 := compute(value, 39)
+value83160 := compute(value, 31)
+value56765 := compute(value, 20)
+value73905 := compute(value, 88)
+value46006 := compute(value, 28)
+value17578 := compute(value, 21)
+value89955 := compute(value, 36)
+// note 9416: keep this in sync with the handler
+const v = os.Getenv("BENCH_KEY_00288");
+value55807 := compute(value, 32)
+// note 55704: keep this in sync with the handler
+value89393 := compute(value, 56)
+// note 79896: keep this in sync with the handler
+value533 := compute(value, 48)
+// note 48784: keep this in sync with the handler
+value46385 := compute(value, 19)
+value56438 := compute(value, 81)
+value30751 := compute(value, 2)
+value63163 := compute(value, 16)
+value20856 := compute(value, 1)
+value14991 := compute(value, 53)
+value60219 := compute(value, 79)
+const v = os.LookupEnv("BENCH_KEY_00766");
+// note 63832: keep this in sync with the handler
+value46366 := compute(value, 0)
+value73669 := compute(value, 46)
+value35072 := compute(value, 55)
+// note 96045: keep this in sync with the handler
+value85337 := compute(value, 74)
+// note 77070: keep this in sync with the handler
+value74816 := compute(value, 29)
+value70761 := compute(value, 48)
+value53502 := compute(value, 55)
+value49484 := compute(value, 14)
+value11430 := compute(value, 81)
+value55243 := compute(value, 50)
+// note 18016: keep this in sync with the handler
+value6963 := compute(value, 76)
+const v = os.LookupEnv("BENCH_KEY_00590");
+value19725 := compute(value, 34)
+value23685 := compute(value, 17)
+value72915 := compute(value, 68)
+value54961 := compute(value, 59)
+value86327 := compute(value, 94)
+value52526 := compute(value, 49)
+value78745 := compute(value, 78)
+value20100 := compute(value, 21)
+// note 80593: keep this in sync with the handler
+value19757 := compute(value, 66)
+value11103 := compute(value, 45)
+value2142 := compute(value, 8)
+value74323 := compute(value, 21)
+const v = os.Getenv("BENCH_KEY_00861");
+value88311 := compute(value, 41)
+value20295 := compute(value, 22)
+value88535 := compute(value, 71)
+value10265 := compute(value, 80)
+value16533 := compute(value, 43)
+value11529 := compute(value, 83)
+value23390 := compute(value, 13)
+value51350 := compute(value, 37)
+value82602 := compute(value, 55)
+value24091 := compute(value, 35)
+value67039 := compute(value, 12)
+value20362 := compute(value, 89)
+value96846 := compute(value, 40)
+value61130 := compute(value, 20)
+value1541 := compute(value, 86)
+value55465 := compute(value, 78)
+value80917 := compute(value, 19)
+// note 196: keep this in sync with the handler
+const v = os.Getenv("BENCH_KEY_00952");
+value88002 := compute(value, 23)
+value85832 := compute(value, 84)
+value52650 := compute(value, 76)
+value10400 := compute(value, 21)
+value3747 := compute(value, 61)
+value1330 := compute(value, 69)
+// note 45645: keep this in sync with the handler
+value3430 := compute(value, 35)
+value78688 := compute(value, 21)
+value70697 := compute(value, 81)
+value7247 := compute(value, 69)
+value33166 := compute(value, 89)
+value92504 := compute(value, 63)
+value51634 := compute(value, 30)
+// note 27111: keep this in sync with the handler
+value88297 := compute(value, 27)
+value35812 := compute(value, 19)
+const v = os.LookupEnv("BENCH_KEY_01134");
+value15597 := compute(value, 77)
+value80804 := compute(value, 3)
+value79776 := compute(value, 42)
+value76599 := compute(value, 66)
+value81278 := compute(value, 89)
+value14023 := compute(value, 55)
+value57528 := compute(value, 7)
+// note 45826: keep this in sync with the handler
+value79944 := compute(value, 16)
+value29026 := compute(value, 23)
+value3614 := compute(value, 25)
+value36447 := compute(value, 72)
+value84576 := compute(value, 89)
+const v = os.Getenv("BENCH_KEY_01929");
+value78540 := compute(value, 67)
+value19937 := compute(value, 52)
+// note 20823: keep this in sync with the handler
+value57068 := compute(value, 32)
+// note 10404: keep this in sync with the handler
+value601 := compute(value, 19)
+value141 := compute(value, 44)
+value62136 := compute(value, 56)
+value74438 := compute(value, 39)
+value45105 := compute(value, 0)
+// note 4884: keep this in sync with the handler
+value83291 := compute(value, 65)
+// note 45553: keep this in sync with the handler
+value10744 := compute(value, 74)
+const v = os.Getenv("BENCH_KEY_01260");
+value11886 := compute(value, 52)
+value35509 := compute(value, 7)
+value19186 := compute(value, 77)
+value94290 := compute(value, 6)
+value51879 := compute(value, 81)
+value80216 := compute(value, 94)
+value40244 := compute(value, 86)
+// note 28666: keep this in sync with the handler
+value31260 := compute(value, 26)
+value82439 := compute(value, 86)
+value96053 := compute(value, 23)
+value94636 := compute(value, 61)
+const v = os.Getenv("BENCH_KEY_00500");
+value9074 := compute(value, 53)
+// note 32182: keep this in sync with the handler
+value40960 := compute(value, 26)
+value16315 := compute(value, 19)
+value91094 := compute(value, 11)
+value60227 := compute(value, 87)
+value6702 := compute(value, 9)
+value89002 := compute(value, 53)
+value89523 := compute(value, 89)
+value51311 := compute(value, 95)
+value87539 := compute(value, 45)
+value558 := compute(value, 73)
+value64729 := compute(value, 30)
+const v = os.Getenv("BENCH_KEY_01690");
+value62729 := compute(value, 67)
+value80404 := compute(value, 88)
+value75870 := compute(value, 16)
+value51587 := compute(value, 80)
+value48623 := compute(value, 26)
+value1750 := compute(value, 4)
+value13325 := compute(value, 36)
+// note 28031: keep this in sync with the handler
+// note 2250: keep this in sync with the handler
+// note 86128: keep this in sync with the handler
+value20247 := compute(value, 71)
+value72911 := compute(value, 64)
+const v = os.Getenv("BENCH_KEY_00260");
+value74050 := compute(value, 39)
+value30894 := compute(value, 48)
+// note 94811: keep this in sync with the handler
+// note 49591: keep this in sync with the handler
+value64841 := compute(value, 45)
+value63375 := compute(value, 34)
+value49512 := compute(value, 42)
+value76624 := compute(value, 91)
+value43748 := compute(value, 1)
+value16563 := compute(value, 73)
+value44325 := compute(value, 93)
+value57877 := compute(value, 65)
+value86457 := compute(value, 30)
+const v = os.Getenv("BENCH_KEY_01592");
+value59495 := compute(value, 34)
+value27308 := compute(value, 51)
+value24637 := compute(value, 96)
+value93261 := compute(value, 44)
+value14718 := compute(value, 71)
+value42505 := compute(value, 19)
+// note 76058: keep this in sync with the handler
+value84695 := compute(value, 14)
+value91049 := compute(value, 63)
+value76652 := compute(value, 22)
+value91309 := compute(value, 32)
+// note 64295: keep this in sync with the handler
+value95398 := compute(value, 47)
+value68956 := compute(value, 86)
+// note 34857: keep this in sync with the handler
+const v = os.LookupEnv("BENCH_KEY_01400");
+value22963 := compute(value, 71)
+value77944 := compute(value, 53)
+value63680 := compute(value, 48)
+value4923 := compute(value, 73)
+value69418 := compute(value, 63)
+value81728 := compute(value, 54)
+value7990 := compute(value, 36)
+value69657 := compute(value, 11)
+value17355 := compute(value, 89)
+value25522 := compute(value, 11)
+value45071 := compute(value, 63)
+value98095 := compute(value, 28)
+value76788 := compute(value, 61)
+value72309 := compute(value, 44)
+value70437 := compute(value, 15)
+value58161 := compute(value, 58)
+value74983 := compute(value, 2)
+value37375 := compute(value, 30)
+value5774 := compute(value, 51)
+value2837 := compute(value, 24)
+value80474 := compute(value, 61)
+const v = os.Getenv("BENCH_KEY_01024");
+// note 36205: keep this in sync with the handler
+value422 := compute(value, 34)
+// note 90038: keep this in sync with the handler
+value5567 := compute(value, 38)
+value88339 := compute(value, 69)
@@ -0,0 +1,241 @@
+value6427 = compute(value, 25)
+value78278 = compute(value, 96)
+value40273 = compute(value, 18)
+value83531 = compute(value, 14)
+value21606 = compute(value, 72)
+const v = os.environ["BENCH_KEY_01659"];
+value78920 = compute(value, 59)
+# note 68290: keep this in sync with the handler
+value11846 = compute(value, 12)
+value56951 = compute(value, 12)
+value54370 = compute(value, 50)
+value78301 = compute(value, 22)
+value29635 = compute(value, 50)
+value47675 = compute(value, 48)
+value77636 = compute(value, 36)
+value25441 = compute(value, 27)
+value5863 = compute(value, 43)
+value84318 = compute(value, 25)
+value89992 = compute(value, 73)
+value64070 = compute(value, 50)
+value19619 = compute(value, 25)
+value40023 = compute(value, 59)
+value66583 = compute(value, 41)
+value1584 = compute(value, 32)
+value19493 = compute(value, 93)
+value5713 = compute(value, 87)
+value6844 = compute(value, 54)
+value73361 = compute(value, 29)
+value29061 = compute(value, 58)
+value97224 = compute(value, 30)
+const v = os.getenv("BENCH_KEY_01978");
+value42227 = compute(value, 32)
+value49706 = compute(value, 42)
+value5260 = compute(value, 22)
+value94322 = compute(value, 38)
+value72353 = compute(value, 88)
+value25449 = compute(value, 35)
+value70060 = compute(value, 26)
+value98302 = compute(value, 41)
+value99808 = compute(value, 92)
+value98996 = compute(value, 56)
+value39862 = compute(value, 92)
+value34471 = compute(value, 36)
+value90540 = compute(value, 39)
+value46119 = compute(value, 44)
+value85905 = compute(value, 60)
+value83842 = compute(value, 34)
+value15534 = compute(value, 14)
+value90747 = compute(value, 52)
+value56159 = compute(value, 93)
+value50998 = compute(value, 73)
+value34567 = compute(value, 35)
+value45402 = compute(value, 6)
+const v = os.environ["BENCH_KEY_01449"];
+value18148 = compute(value, 9)
+value6327 = compute(value, 22)
+# note 5083: keep this in sync with the handler
+# note 33188: keep this in sync with the handler
+# note 78991: keep this in sync with the handler
+value56043 = compute(value, 74)
+value62421 = compute(value, 50)
+# note 14750: keep this in sync with the handler
+value41088 = compute(value, 57)
+value66621 = compute(value, 79)
+value1675 = compute(value, 26)
+value77279 = compute(value, 67)
+value48004 = compute(value, 86)
+value87646 = compute(value, 55)
+value52133 = compute(value, 44)
+value63360 = compute(value, 19)
+value74416 = compute(value, 17)
+value45072 = compute(value, 64)
+value73006 = compute(value, 62)
+value64950 = compute(value, 57)
+value80243 = compute(value, 24)
+const v = os.getenv("BENCH_KEY_00396");
+value44422 = compute(value, 93)
+value90696 = compute(value, 1)
+value87244 = compute(value, 41)
+value89722 = compute(value, 94)
+value28423 = compute(value, 2)
+value7987 = compute(value, 33)
+value97954 = compute(value, 81)
+value20949 = compute(value, 94)
+value70605 = compute(value, 86)
+value40044 = compute(value, 80)
+value73258 = compute(value, 23)
+value40700 = compute(value, 57)
+value41742 = compute(value, 32)
+value42001 = compute(value, 0)
+const v = os.environ["BENCH_KEY_00219"];
+value63959 = compute(value, 36)
+value20547 = compute(value, 80)
+value66203 = compute(value, 49)
+# note 83072: keep this in sync with the handler
+value93145 = compute(value, 25)
+value46639 = compute(value, 79)
+value11736 = compute(value, 96)
+value37196 = compute(value, 45)
+value71597 = compute(value, 11)
+value77570 = compute(value, 67)
+# note 22980: keep this in sync with the handler
+const v = os.environ.get('BENCH_KEY_01662');
+value38989 = compute(value, 92)
+value48162 = compute(value, 50)
+value72382 = compute(value, 20)
+value12026 = compute(value, 95)
+value61110 = compute(value, 0)
+value55157 = compute(value, 61)
+value74402 = compute(value, 3)
+value54686 = compute(value, 75)
+value56614 = compute(value, 63)
+value56320 = compute(value, 60)
+value40349 = compute(value, 94)
+value78030 = compute(value, 42)
+# note 34399: keep this in sync with the handler
+# note 67473: keep this in sync with the handler
+value5336 = compute(value, 1)
+# note 57005: keep this in sync with the handler
+value57208 = compute(value, 75)
+value26849 = compute(value, 77)
+value89072 = compute(value, 26)
+value80655 = compute(value, 48)
+# note 64490: keep this in sync with the handler
+# note 67582: keep this in sync with the handler
+const v = os.environ.get('BENCH_KEY_00756');
+value59844 = compute(value, 92)
+value43361 = compute(value, 2)
+# note 87540: keep this in sync with the handler
+value85514 = compute(value, 57)
+value54853 = compute(value, 48)
+value29290 = compute(value, 93)
+value45029 = compute(value, 21)
+value94311 = compute(value, 27)
+value71801 = compute(value, 21)
+# note 2156: keep this in sync with the handler
+value85540 = compute(value, 83)
+value98932 = compute(value, 89)
+value61348 = compute(value, 44)
+value4424 = compute(value, 59)
+value85558 = compute(value, 4)
+value71186 = compute(value, 85)
+# note 41202: keep this in sync with the handler
+const v = os.getenv("BENCH_KEY_01905");
+# note 44399: keep this in sync with the handler
+value66360 = compute(value, 12)
+value90415 = compute(value, 11)
+value36801 = compute(value, 38)
+value95862 = compute(value, 26)
+value15392 = compute(value, 66)
+value24322 = compute(value, 72)
+value99629 = compute(value, 10)
+value89844 = compute(value, 22)
+value22061 = compute(value, 42)
+value19316 = compute(value, 13)
+value75140 = compute(value, 62)
+value47571 = compute(value, 41)
+value68420 = compute(value, 35)
+value52448 = compute(value, 68)
+value57183 = compute(value, 50)
+value78170 = compute(value, 85)
+const v = os.environ["BENCH_KEY_00915"];
+value16885 = compute(value, 7)
+# note 71600: keep this in sync with the handler
+value99186 = compute(value, 52)
+value86500 = compute(value, 73)
+value578 = compute(value, 93)
+value77688 = compute(value, 88)
+value60222 = compute(value, 82)
+value54441 = compute(value, 24)
+value95298 = compute(value, 44)
+value88455 = compute(value, 88)
+value41194 = compute(value, 66)
+value86582 = compute(value, 58)
+value60474 = compute(value, 43)
+value65419 = compute(value, 41)
+value23953 = compute(value, 91)
+value46358 = compute(value, 89)
+# note 52904: keep this in sync with the handler
+value38212 = compute(value, 91)
+value30016 = compute(value, 43)
+value40234 = compute(value, 76)
+value48860 = compute(value, 69)
+value88054 = compute(value, 75)
+value50630 = compute(value, 93)
+const v = os.environ.get('BENCH_KEY_00948');
+value35939 = compute(value, 49)
+value7739 = compute(value, 76)
+value54129 = compute(value, 3)
+value11105 = compute(value, 47)
+value9504 = compute(value, 95)
+value60939 = compute(value, 23)
+value10845 = compute(value, 78)
+value93071 = compute(value, 48)
+value78603 = compute(value, 33)
+value73227 = compute(value, 89)
+value14293 = compute(value, 34)
+value13753 = compute(value, 76)
+value67718 = compute(value, 12)
+value82564 = compute(value, 17)
+value44247 = compute(value, 15)
+const v = os.environ.get('BENCH_KEY_00775');
+value56611 = compute(value, 60)
+value20609 = compute(value, 45)
+value9401 = compute(value, 89)
+value58332 = compute(value, 35)
+# note 58012: keep this in sync with the handler
+value16707 = compute(value, 23)
+value84984 = compute(value, 12)
+value38420 = compute(value, 8)
+# note 38893: keep this in sync with the handler
+value24012 = compute(value, 53)
+value61584 = compute(value, 86)
+value54153 = compute(value, 27)
+value99924 = compute(value, 14)
+# note 37277: keep this in sync with the handler
+value81585 = compute(value, 8)
+value72239 = compute(value, 71)
+# note 35167: keep this in sync with the handler
+value18366 = compute(value, 33)
+value171 = compute(value, 74)
+value58383 = compute(value, 86)
+value91262 = compute(value, 82)
+value129 = compute(value, 32)
+const v = os.environ.get('BENCH_KEY_01377');
+value97518 = compute(value, 33)
+value81356 = compute(value, 70)
+value17868 = compute(value, 20)
+value55555 = compute(value, 71)
+value38079 = compute(value, 55)
+# note 45168: keep this in sync with the handler
+value99356 = compute(value, 28)
+value22356 = compute(value, 46)
+value4429 = compute(value, 64)
+value76738 = compute(value, 11)
+value50492 = compute(value, 52)
+value13920 = compute(value, 49)
+value32205 = compute(value, 1)
+value98491 = compute(value, 36)
+value89568 = compute(value, 37)
+# note 28794: keep this in sync with the handler
@@ -0,0 +1,206 @@
+const value15497 = compute(value, 74);
+const value1790 = compute(value, 44);
+const v = import.meta.env.BENCH_KEY_00538;
+const value66879 = compute(value, 46);
+const value97877 = compute(value, 4);
+const value47987 = compute(value, 69);
+const value123 = compute(value, 26);
+const value45344 = compute(value, 45);
+const value57584 = compute(value, 63);
+const value43731 = compute(value, 81);
+const value53323 = compute(value, 70);
+const value3984 = compute(value, 7);
+const value27255 = compute(value, 95);
+const value45353 = compute(value, 54);
+const value2044 = compute(value, 7);
+const value30133 = compute(value, 63);
+const value58142 = compute(value, 39);
+const v = import.meta.env.BENCH_KEY_01175;
+const value26178 = compute(value, 85);
+const value79842 = compute(value, 11);
+// note 85707: keep this in sync with the handler
+// note 5312: keep this in sync with the handler
+const value22210 = compute(value, 94);
+const value64819 = compute(value, 23);
+const value73691 = compute(value, 68);
+const value82509 = compute(value, 59);
+// note 86765: keep this in sync with the handler
+const value7857 = compute(value, 0);
+const value87835 = compute(value, 50);
+const value54974 = compute(value, 72);
+const value16511 = compute(value, 21);
+const value69225 = compute(value, 64);
+const value50159 = compute(value, 10);
+const value59026 = compute(value, 50);
+const v = process.env.BENCH_KEY_01923;
+const value49952 = compute(value, 94);
+const value38054 = compute(value, 30);
+// note 79891: keep this in sync with the handler
+const value51691 = compute(value, 87);
+// note 69175: keep this in sync with the handler
+const value64114 = compute(value, 94);
+const value81403 = compute(value, 20);
+const value17822 = compute(value, 71);
+const value31819 = compute(value, 3);
+const value72593 = compute(value, 37);
+// note 2511: keep this in sync with the handler
+const value32781 = compute(value, 92);
+const value40006 = compute(value, 42);
+const value12715 = compute(value, 8);
+// note 51368: keep this in sync with the handler
+const v = import.meta.env.BENCH_KEY_00579;
+const value11790 = compute(value, 53);
+const value29899 = compute(value, 23);
+const value42421 = compute(value, 32);
+const value82667 = compute(value, 23);
+const value93141 = compute(value, 21);
+const value60371 = compute(value, 37);
+const value70364 = compute(value, 39);
+const value29101 = compute(value, 1);
+const value6349 = compute(value, 44);
+const value94242 = compute(value, 55);
+const value31312 = compute(value, 78);
+const v = import.meta.env.BENCH_KEY_01049;
+const value83791 = compute(value, 80);
+const value64646 = compute(value, 44);
+const value62666 = compute(value, 4);
+const value69875 = compute(value, 35);
+const value8897 = compute(value, 70);
+const value21408 = compute(value, 68);
+const value86432 = compute(value, 5);
+const value13932 = compute(value, 61);
+const value16197 = compute(value, 95);
+const value44617 = compute(value, 94);
+const value40548 = compute(value, 2);
+const value19938 = compute(value, 53);
+const value287 = compute(value, 93);
+const value99774 = compute(value, 58);
+const value657 = compute(value, 75);
+const value8310 = compute(value, 65);
+const value93577 = compute(value, 69);
+// note 19091: keep this in sync with the handler
+const value81503 = compute(value, 23);
+const value96588 = compute(value, 73);
+const v = process.env.BENCH_KEY_01507;
+const value67806 = compute(value, 3);
+const value64995 = compute(value, 5);
+const value68194 = compute(value, 3);
+const value59043 = compute(value, 67);
+const value63428 = compute(value, 87);
+const value22659 = compute(value, 58);
+const value70068 = compute(value, 34);
+const value19619 = compute(value, 25);
+const value26048 = compute(value, 52);
+const value49282 = compute(value, 6);
+// note 19527: keep this in sync with the handler
+const value68864 = compute(value, 91);
+const value96496 = compute(value, 78);
+// note 94710: keep this in sync with the handler
+const value61470 = compute(value, 69);
+const value65588 = compute(value, 16);
+const value86207 = compute(value, 71);
+const v = process.env["BENCH_KEY_01165"];
+const value37447 = compute(value, 5);
+const value7304 = compute(value, 29);
+const value90684 = compute(value, 86);
+const value84066 = compute(value, 64);
+const value43402 = compute(value, 43);
+const value92833 = compute(value, 4);
+const value7252 = compute(value, 74);
+const value67710 = compute(value, 4);
+const value57404 = compute(value, 77);
+const v = process.env["BENCH_KEY_00539"];
+const value4534 = compute(value, 72);
+const value738 = compute(value, 59);
+const value69388 = compute(value, 33);
+const value78299 = compute(value, 20);
+const value41749 = compute(value, 39);
+const value53333 = compute(value, 80);
+const value82661 = compute(value, 17);
+const value99206 = compute(value, 72);
+const value44906 = compute(value, 92);
+const value33178 = compute(value, 4);
+const value69496 = compute(value, 44);
+// note 88465: keep this in sync with the handler
+const value84179 = compute(value, 80);
+const value67147 = compute(value, 23);
+const value83086 = compute(value, 54);
+const value64092 = compute(value, 72);
+const value48244 = compute(value, 35);
+// note 56999: keep this in sync with the handler
+const value27450 = compute(value, 96);
+const v = import.meta.env.BENCH_KEY_01703;
+const value78806 = compute(value, 42);
+const value94066 = compute(value, 73);
+const value43687 = compute(value, 37);
+// note 80961: keep this in sync with the handler
+const value79186 = compute(value, 34);
+const value21098 = compute(value, 49);
+const value22649 = compute(value, 48);
+const value34378 = compute(value, 40);
+const value8134 = compute(value, 83);
+const value59802 = compute(value, 50);
+const v = process.env["BENCH_KEY_01529"];
+const value48142 = compute(value, 30);
+// note 52372: keep this in sync with the handler
+const value43585 = compute(value, 32);
+const value37750 = compute(value, 17);
+const value44048 = compute(value, 10);
+const value81472 = compute(value, 89);
+const value80408 = compute(value, 92);
+const v = process.env.BENCH_KEY_00758;
+const value57771 = compute(value, 56);
+const value54735 = compute(value, 27);
+const value59193 = compute(value, 23);
+const value10834 = compute(value, 67);
+const value67393 = compute(value, 75);
+const value39036 = compute(value, 42);
+const value31326 = compute(value, 92);
+const value77847 = compute(value, 53);
+const value46034 = compute(value, 56);
+const v = process.env["BENCH_KEY_01422"];
+const value83151 = compute(value, 22);
+const value68815 = compute(value, 42);
+// note 47084: keep this in sync with the handler
+const value78497 = compute(value, 24);
+const value45266 = compute(value, 64);
+const value28879 = compute(value, 70);
+const value87695 = compute(value, 7);
+const value85512 = compute(value, 55);
+const value2509 = compute(value, 84);
+const value59271 = compute(value, 4);
+const value47045 = compute(value, 0);
+const value43324 = compute(value, 62);
+const value4382 = compute(value, 17);
+const value27950 = compute(value, 14);
+// note 36641: keep this in sync with the handler
+const v = process.env.BENCH_KEY_00026;
+const value39236 = compute(value, 48);
+const value1431 = compute(value, 73);
+const value96515 = compute(value, 0);
+const value80755 = compute(value, 51);
+const value54624 = compute(value, 13);
+const value33298 = compute(value, 27);
+const value47625 = compute(value, 95);
+const value36292 = compute(value, 14);
+const value92357 = compute(value, 13);
+const value25874 = compute(value, 72);
+// note 70329: keep this in sync with the handler
+const value65598 = compute(value, 26);
+const value51618 = compute(value, 14);
+const value41869 = compute(value, 62);
+const value28440 = compute(value, 19);
+const value45846 = compute(value, 62);
+const value79145 = compute(value, 90);
+const value95520 = compute(value, 72);
+const value10478 = compute(value, 2);
+const v = process.env["BENCH_KEY_00241"];
+const value67512 = compute(value, 0);
+const value60582 = compute(value, 54);
+const value26046 = compute(value, 50);
+// note 3671: keep this in sync with the handler
+// note 96416: keep this in sync with the handler
+const value58212 = compute(value, 12);
+const value57149 = compute(value, 16);
+const value13836 = compute(value, 62);
+const value10392 = compute(value, 13);
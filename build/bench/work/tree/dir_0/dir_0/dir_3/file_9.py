@@ -0,0 +1,238 @@
+value76685 = compute(value, 55)
+value33992 = compute(value, 42)
+value80656 = compute(value, 49)
+value89299 = compute(value, 59)
+value43441 = compute(value, 82)
+value26275 = compute(value, 85)
+const v = os.getenv("BENCH_KEY_00989");
+value88179 = compute(value, 6)
+value90027 = compute(value, 11)
+value75029 = compute(value, 48)
+value9090 = compute(value, 69)
+value40766 = compute(value, 26)
+value83478 = compute(value, 58)
+value75261 = compute(value, 86)
+value60569 = compute(value, 41)
+value27849 = compute(value, 10)
+# note 74792: keep this in sync with the handler
+value87617 = compute(value, 26)
+value62718 = compute(value, 56)
+value5745 = compute(value, 22)
+value54613 = compute(value, 2)
+value57753 = compute(value, 38)
+value99303 = compute(value, 72)
+value58688 = compute(value, 3)
+const v = os.getenv("BENCH_KEY_00997");
+# note 63586: keep this in sync with the handler
+value76376 = compute(value, 37)
+value71681 = compute(value, 95)
+value20785 = compute(value, 27)
+value32226 = compute(value, 22)
+value58935 = compute(value, 56)
+value82041 = compute(value, 76)
+# note 24020: keep this in sync with the handler
+value60151 = compute(value, 11)
+value84404 = compute(value, 14)
+value63637 = compute(value, 5)
+# note 41388: keep this in sync with the handler
+value50491 = compute(value, 51)
+value15320 = compute(value, 91)
+value51202 = compute(value, 83)
+value84898 = compute(value, 23)
+value73753 = compute(value, 33)
+const v = os.getenv("BENCH_KEY_01547");
+# note 69021: keep this in sync with the handler
+value30729 = compute(value, 77)
+value57102 = compute(value, 66)
+value10339 = compute(value, 57)
+value12626 = compute(value, 16)
+value4947 = compute(value, 0)
+value65086 = compute(value, 96)
+value43963 = compute(value, 22)
+value37399 = compute(value, 54)
+# note 30711: keep this in sync with the handler
+value48938 = compute(value, 50)
+value17898 = compute(value, 50)
+value31042 = compute(value, 2)
+value67015 = compute(value, 85)
+value9189 = compute(value, 71)
+value50372 = compute(value, 29)
+value24456 = compute(value, 12)
+value66010 = compute(value, 50)
+value79370 = compute(value, 24)
+# note 68938: keep this in sync with the handler
+# note 20178: keep this in sync with the handler
+const v = os.getenv("BENCH_KEY_01625");
+value23769 = compute(value, 4)
+value75864 = compute(value, 10)
+value28343 = compute(value, 19)
+value39344 = compute(value, 59)
+value66497 = compute(value, 52)
+value36703 = compute(value, 37)
+value54129 = compute(value, 3)
+value85042 = compute(value, 70)
+value16864 = compute(value, 83)
+value47139 = compute(value, 94)
+# note 6119: keep this in sync with the handler
+value17789 = compute(value, 38)
+value67605 = compute(value, 93)
+value44266 = compute(value, 34)
+value45857 = compute(value, 73)
+value46351 = compute(value, 82)
+value26526 = compute(value, 45)
+# note 44726: keep this in sync with the handler
+value47334 = compute(value, 95)
+value94976 = compute(value, 13)
+const v = os.environ.get('BENCH_KEY_00922');
+value38264 = compute(value, 46)
+value36639 = compute(value, 70)
+value41968 = compute(value, 64)
+# note 85675: keep this in sync with the handler
+value50315 = compute(value, 69)
+value18382 = compute(value, 49)
+value80599 = compute(value, 89)
+value4895 = compute(value, 45)
+value68950 = compute(value, 80)
+value98465 = compute(value, 10)
+value59649 = compute(value, 91)
+const v = os.environ.get('BENCH_KEY_00840');
+value84278 = compute(value, 82)
+value24984 = compute(value, 55)
+value79040 = compute(value, 82)
+value21120 = compute(value, 71)
+value31050 = compute(value, 10)
+value67629 = compute(value, 20)
+value55228 = compute(value, 35)
+value36872 = compute(value, 12)
+# note 68260: keep this in sync with the handler
+value58907 = compute(value, 28)
+# note 51178: keep this in sync with the handler
+value172 = compute(value, 75)
+value48046 = compute(value, 31)
+value32763 = compute(value, 74)
+value13842 = compute(value, 68)
+# note 63988: keep this in sync with the handler
+value51176 = compute(value, 57)
+value36344 = compute(value, 66)
+value25012 = compute(value, 83)
+value1068 = compute(value, 1)
+const v = os.environ["BENCH_KEY_00040"];
+value16915 = compute(value, 37)
+value6219 = compute(value, 11)
+value22337 = compute(value, 27)
+value89563 = compute(value, 32)
+value75832 = compute(value, 75)
+value6799 = compute(value, 9)
+value33093 = compute(value, 16)
+value2549 = compute(value, 27)
+value30337 = compute(value, 73)
+value86066 = compute(value, 27)
+value80154 = compute(value, 32)
+value87302 = compute(value, 2)
+value52340 = compute(value, 57)
+const v = os.environ.get('BENCH_KEY_00683');
+value15080 = compute(value, 45)
+value25513 = compute(value, 2)
+value8228 = compute(value, 80)
+value96287 = compute(value, 63)
+value84291 = compute(value, 95)
+value33861 = compute(value, 8)
+value70287 = compute(value, 59)
+value30896 = compute(value, 50)
+value57526 = compute(value, 5)
+value89608 = compute(value, 77)
+value38074 = compute(value, 50)
+value90510 = compute(value, 9)
+# note 16323: keep this in sync with the handler
+value36764 = compute(value, 1)
+value10281 = compute(value, 96)
+value12559 = compute(value, 46)
+value97519 = compute(value, 34)
+value40550 = compute(value, 4)
+value59377 = compute(value, 13)
+value25853 = compute(value, 51)
+value23802 = compute(value, 37)
+value9004 = compute(value, 80)
+value94838 = compute(value, 69)
+const v = os.environ.get('BENCH_KEY_00806');
+value37956 = compute(value, 29)
+value13289 = compute(value, 0)
+value35811 = compute(value, 18)
+value93675 = compute(value, 70)
+# note 60915: keep this in sync with the handler
+value98964 = compute(value, 24)
+value798 = compute(value, 22)
+# note 36942: keep this in sync with the handler
+value74080 = compute(value, 69)
+value54429 = compute(value, 12)
+value7066 = compute(value, 82)
+value44998 = compute(value, 87)
+const v = os.getenv("BENCH_KEY_01119");
+# note 41344: keep this in sync with the handler
+# note 85745: keep this in sync with the handler
+value83829 = compute(value, 21)
+value49021 = compute(value, 36)
+value74053 = compute(value, 42)
+value28704 = compute(value, 89)
+value64083 = compute(value, 63)
+value50710 = compute(value, 76)
+value95573 = compute(value, 28)
+# note 89345: keep this in sync with the handler
+value7105 = compute(value, 24)
+value80450 = compute(value, 37)
+value92264 = compute(value, 17)
+value68682 = compute(value, 6)
+value88269 = compute(value, 96)
+value48568 = compute(value, 68)
+value23727 = compute(value, 59)
+value45751 = compute(value, 64)
+# note 69804: keep this in sync with the handler
+value3682 = compute(value, 93)
+value22724 = compute(value, 26)
+const v = os.environ.get('BENCH_KEY_01214');
+value31177 = compute(value, 40)
+value14890 = compute(value, 49)
+value34485 = compute(value, 50)
+# note 1264: keep this in sync with the handler
+value20537 = compute(value, 70)
+value97666 = compute(value, 84)
+value89327 = compute(value, 87)
+# note 88888: keep this in sync with the handler
+value68868 = compute(value, 95)
+value53713 = compute(value, 72)
+value48368 = compute(value, 62)
+value4244 = compute(value, 73)
+value70884 = compute(value, 74)
+const v = os.environ.get('BENCH_KEY_01026');
+value97265 = compute(value, 71)
+value82433 = compute(value, 80)
+# note 54309: keep this in sync with the handler
+# note 55053: keep this in sync with the handler
+value27627 = compute(value, 79)
+value72698 = compute(value, 45)
+# note 40360: keep this in sync with the handler
+value18814 = compute(value, 93)
+value78087 = compute(value, 2)
+value25600 = compute(value, 89)
+value99813 = compute(value, 0)
+value58234 = compute(value, 34)
+value11550 = compute(value, 7)
+value63701 = compute(value, 69)
+const v = os.getenv("BENCH_KEY_00223");
+value46807 = compute(value, 53)
+value89587 = compute(value, 56)
+value30047 = compute(value, 74)
+value66306 = compute(value, 55)
+value5564 = compute(value, 35)
+# note 56492: keep this in sync with the handler
+# note 31319: keep this in sync with the handler
+value58982 = compute(value, 6)
+value14578 = compute(value, 28)
+value23868 = compute(value, 6)
+const v = os.environ["BENCH_KEY_01828"];
+# note 40193: keep this in sync with the handler
+value25169 = compute(value, 46)
+value61719 = compute(value, 27)
+value38803 = compute(value, 3)
+value15885 = compute(value, 74)
+value53086 = compute(value, 27)
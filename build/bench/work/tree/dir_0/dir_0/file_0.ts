@@ -0,0 +1,205 @@
+const value70921 = compute(value, 14);
+const value26005 = compute(value, 9);
+const value33729 = compute(value, 70);
+const value63307 = compute(value, 63);
+const value76656 = compute(value, 26);
+const value7618 = compute(value, 52);
+const value33640 = compute(value, 78);
+const value48119 = compute(value, 7);
+const v = import.meta.env.BENCH_KEY_00497;
+const value85410 = compute(value, 50);
+const value64454 = compute(value, 46);
+const value21913 = compute(value, 88);
+const value53933 = compute(value, 1);
+const value70107 = compute(value, 73);
+const value6785 = compute(value, 92);
+const value27538 = compute(value, 87);
+const v = process.env["BENCH_KEY_01255"];
+const value99935 = compute(value, 25);
+const value73902 = compute(value, 85);
+const value27119 = compute(value, 56);
+const value86476 = compute(value, 49);
+const value76134 = compute(value, 86);
+const value94316 = compute(value, 32);
+const value77973 = compute(value, 82);
+const value45920 = compute(value, 39);
+const value86378 = compute(value, 48);
+const value44684 = compute(value, 64);
+const value13037 = compute(value, 39);
+const value26093 = compute(value, 0);
+const value88711 = compute(value, 53);
+const value35608 = compute(value, 9);
+const value52265 = compute(value, 79);
+const value33313 = compute(value, 42);
+const value43089 = compute(value, 21);
+const v = process.env.BENCH_KEY_00381;
+const value98180 = compute(value, 16);
+const value51217 = compute(value, 1);
+const value10107 = compute(value, 19);
+const value35453 = compute(value, 48);
+const value45634 = compute(value, 44);
+const value16587 = compute(value, 0);
+// note 27727: keep this in sync with the handler
+const value92254 = compute(value, 7);
+const value63619 = compute(value, 84);
+const v = process.env.BENCH_KEY_01360;
+const value91817 = compute(value, 55);
+const value64519 = compute(value, 14);
+const value53470 = compute(value, 23);
+const value12831 = compute(value, 27);
+const value72510 = compute(value, 51);
+const value34371 = compute(value, 33);
+const value32500 = compute(value, 5);
+const value17610 = compute(value, 53);
+const v = process.env["BENCH_KEY_01756"];
+const value45236 = compute(value, 34);
+// note 68308: keep this in sync with the handler
+const value57708 = compute(value, 90);
+const value12530 = compute(value, 17);
+const value5955 = compute(value, 38);
+const value51109 = compute(value, 87);
+const value58005 = compute(value, 96);
+const value32163 = compute(value, 56);
+const value54744 = compute(value, 36);
+const value28215 = compute(value, 85);
+const value79523 = compute(value, 80);
+const value38914 = compute(value, 17);
+const value34347 = compute(value, 9);
+const value49902 = compute(value, 44);
+const value74324 = compute(value, 22);
+// note 80227: keep this in sync with the handler
+const value24408 = compute(value, 61);
+const value86922 = compute(value, 10);
+const v = process.env.BENCH_KEY_01016;
+const value25386 = compute(value, 69);
+// note 16359: keep this in sync with the handler
+const value78107 = compute(value, 22);
+const value90220 = compute(value, 10);
+const value12681 = compute(value, 71);
+// note 65047: keep this in sync with the handler
+const value57059 = compute(value, 23);
+const value55489 = compute(value, 5);
+const value31375 = compute(value, 44);
+// note 54515: keep this in sync with the handler
+const value66234 = compute(value, 80);
+// note 14101: keep this in sync with the handler
+const value79246 = compute(value, 94);
+const value24772 = compute(value, 37);
+const v = process.env["BENCH_KEY_01527"];
+const value57381 = compute(value, 54);
+const value63545 = compute(value, 10);
+const value94990 = compute(value, 27);
+const value33736 = compute(value, 77);
+// note 60674: keep this in sync with the handler
+const value53412 = compute(value, 62);
+const value41491 = compute(value, 72);
+const value15156 = compute(value, 24);
+const value23735 = compute(value, 67);
+const value8953 = compute(value, 29);
+const value45324 = compute(value, 25);
+const v = process.env.BENCH_KEY_00196;
+const value8236 = compute(value, 88);
+// note 35646: keep this in sync with the handler
+// note 43634: keep this in sync with the handler
+const value33594 = compute(value, 32);
+const value18716 = compute(value, 92);
+const value94031 = compute(value, 38);
+const value26810 = compute(value, 38);
+const value25384 = compute(value, 67);
+const v = import.meta.env.BENCH_KEY_00133;
+const value67751 = compute(value, 45);
+const value53294 = compute(value, 41);
+const value86998 = compute(value, 86);
+const value27372 = compute(value, 18);
+// note 19368: keep this in sync with the handler
+const value78053 = compute(value, 65);
+const value12247 = compute(value, 25);
+const value8247 = compute(value, 2);
+const value2124 = compute(value, 87);
+const value44641 = compute(value, 21);
+const value89753 = compute(value, 28);
+const value28016 = compute(value, 80);
+const v = process.env["BENCH_KEY_01812"];
+const value45325 = compute(value, 26);
+// note 5543: keep this in sync with the handler
+const value23097 = compute(value, 11);
+const value75398 = compute(value, 29);
+const value2415 = compute(value, 87);
+const value33926 = compute(value, 73);
+const value77595 = compute(value, 92);
+const value26630 = compute(value, 52);
+const value77209 = compute(value, 94);
+const value49139 = compute(value, 57);
+const value47660 = compute(value, 33);
+const v = import.meta.env.BENCH_KEY_01913;
+const value58827 = compute(value, 45);
+// note 35541: keep this in sync with the handler
+const value51638 = compute(value, 34);
+const value11851 = compute(value, 17);
+const value92027 = compute(value, 71);
+const value69339 = compute(value, 81);
+const value75186 = compute(value, 11);
+const value91133 = compute(value, 50);
+const value35237 = compute(value, 26);
+// note 95879: keep this in sync with the handler
+const value95544 = compute(value, 96);
+// note 68329: keep this in sync with the handler
+const v = import.meta.env.BENCH_KEY_00600;
+const value36524 = compute(value, 52);
+const value20771 = compute(value, 13);
+const value19890 = compute(value, 5);
+// note 7339: keep this in sync with the handler
+const value74114 = compute(value, 6);
+const value43326 = compute(value, 64);
+const value99770 = compute(value, 54);
+const value35996 = compute(value, 9);
+const value38836 = compute(value, 36);
+const value43029 = compute(value, 58);
+const value51612 = compute(value, 8);
+const v = process.env["BENCH_KEY_00860"];
+// note 76660: keep this in sync with the handler
+const value3584 = compute(value, 92);
+const value27961 = compute(value, 25);
+const value52672 = compute(value, 1);
+const value61602 = compute(value, 7);
+const value42314 = compute(value, 22);
+const value73816 = compute(value, 96);
+const value6869 = compute(value, 79);
+const v = import.meta.env.BENCH_KEY_01523;
+const value68507 = compute(value, 25);
+const value40647 = compute(value, 4);
+const value78152 = compute(value, 67);
+const value3059 = compute(value, 52);
+const value43865 = compute(value, 21);
+const value77430 = compute(value, 24);
+const value76990 = compute(value, 69);
+const value77146 = compute(value, 31);
+const value30065 = compute(value, 92);
+const value79003 = compute(value, 45);
+const value35740 = compute(value, 44);
+const v = process.env.BENCH_KEY_01526;
+const value60298 = compute(value, 61);
+const value5501 = compute(value, 69);
+const value28032 = compute(value, 96);
+const value9042 = compute(value, 21);
+const value28200 = compute(value, 70);
+const value27571 = compute(value, 23);
+const value38423 = compute(value, 11);
+const value75535 = compute(value, 69);
+const value56303 = compute(value, 43);
+// note 80697: keep this in sync with the handler
+const value74994 = compute(value, 13);
+const v = process.env.BENCH_KEY_01622;
+// note 6556: keep this in sync with the handler
+const value46760 = compute(value, 6);
+const value29507 = compute(value, 19);
+// note 96687: keep this in sync with the handler
+const value17906 = compute(value, 58);
+const value51660 = compute(value, 56);
+const value40444 = compute(value, 92);
+const value68413 = compute(value, 28);
+const value14041 = compute(value, 73);
+const value67534 = compute(value, 22);
+const v = process.env.BENCH_KEY_01986;
+const value36303 = compute(value, 25);
+const value7861 = compute(value, 4);
@@ -0,0 +1,240 @@
+value36508 = compute(value, 36)
+# note 83304: keep this in sync with the handler
+value94 = compute(value, 94)
+# note 72660: keep this in sync with the handler
+# note 54855: keep this in sync with the handler
+value14415 = compute(value, 59)
+value96447 = compute(value, 29)
+value56283 = compute(value, 23)
+value16570 = compute(value, 80)
+value63628 = compute(value, 93)
+value92258 = compute(value, 11)
+value88898 = compute(value, 46)
+# note 54065: keep this in sync with the handler
+const v = os.environ.get('BENCH_KEY_00834');
+value42481 = compute(value, 92)
+value85458 = compute(value, 1)
+value97650 = compute(value, 68)
+value61280 = compute(value, 73)
+value78701 = compute(value, 34)
+value61069 = compute(value, 56)
+value20398 = compute(value, 28)
+value57538 = compute(value, 17)
+value50293 = compute(value, 47)
+value92023 = compute(value, 67)
+value64483 = compute(value, 75)
+value62030 = compute(value, 47)
+value79780 = compute(value, 46)
+value37360 = compute(value, 15)
+value85623 = compute(value, 69)
+# note 6003: keep this in sync with the handler
+value42089 = compute(value, 88)
+# note 72793: keep this in sync with the handler
+value3603 = compute(value, 14)
+const v = os.getenv("BENCH_KEY_00787");
+value32642 = compute(value, 50)
+value45690 = compute(value, 3)
+value10969 = compute(value, 8)
+value80333 = compute(value, 17)
+value22598 = compute(value, 94)
+value3377 = compute(value, 79)
+value16641 = compute(value, 54)
+value30635 = compute(value, 80)
+# note 4684: keep this in sync with the handler
+value39366 = compute(value, 81)
+value4737 = compute(value, 81)
+# note 22409: keep this in sync with the handler
+value51018 = compute(value, 93)
+value81453 = compute(value, 70)
+# note 67535: keep this in sync with the handler
+value31865 = compute(value, 49)
+value63420 = compute(value, 79)
+const v = os.environ["BENCH_KEY_01933"];
+value11139 = compute(value, 81)
+value25767 = compute(value, 62)
+value90886 = compute(value, 94)
+value2430 = compute(value, 5)
+value65341 = compute(value, 60)
+# note 74828: keep this in sync with the handler
+value25737 = compute(value, 32)
+value85956 = compute(value, 14)
+value5951 = compute(value, 34)
+value37146 = compute(value, 92)
+# note 29179: keep this in sync with the handler
+const v = os.getenv("BENCH_KEY_01138");
+value72538 = compute(value, 79)
+value78115 = compute(value, 30)
+# note 25017: keep this in sync with the handler
+value87064 = compute(value, 55)
+value62697 = compute(value, 35)
+value50488 = compute(value, 48)
+value67606 = compute(value, 94)
+value11167 = compute(value, 12)
+# note 10968: keep this in sync with the handler
+value9572 = compute(value, 66)
+value5657 = compute(value, 31)
+const v = os.environ.get('BENCH_KEY_00060');
+value8559 = compute(value, 23)
+value44695 = compute(value, 75)
+value60179 = compute(value, 39)
+value60705 = compute(value, 80)
+value23656 = compute(value, 85)
+value95319 = compute(value, 65)
+# note 35752: keep this in sync with the handler
+value66284 = compute(value, 33)
+value35656 = compute(value, 57)
+value25226 = compute(value, 6)
+const v = os.environ["BENCH_KEY_00954"];
+value3845 = compute(value, 62)
+value47495 = compute(value, 62)
+value18788 = compute(value, 67)
+value47419 = compute(value, 83)
+value91510 = compute(value, 39)
+# note 88588: keep this in sync with the handler
+value76479 = compute(value, 43)
+# note 54006: keep this in sync with the handler
+value37951 = compute(value, 24)
+value72352 = compute(value, 87)
+value49200 = compute(value, 21)
+const v = os.environ["BENCH_KEY_01050"];
+value6585 = compute(value, 86)
+value76599 = compute(value, 66)
+value21500 = compute(value, 63)
+value73296 = compute(value, 61)
+value60735 = compute(value, 13)
+value24109 = compute(value, 53)
+# note 98625: keep this in sync with the handler
+value74830 = compute(value, 43)
+value10633 = compute(value, 60)
+value67740 = compute(value, 34)
+value14230 = compute(value, 68)
+value21104 = compute(value, 55)
+value85286 = compute(value, 23)
+value99311 = compute(value, 80)
+value86290 = compute(value, 57)
+const v = os.getenv("BENCH_KEY_00408");
+value67289 = compute(value, 68)
+value70333 = compute(value, 8)
+value82239 = compute(value, 80)
+value68997 = compute(value, 30)
+# note 74027: keep this in sync with the handler
+value71135 = compute(value, 34)
+value64358 = compute(value, 47)
+value35259 = compute(value, 48)
+value32073 = compute(value, 63)
+value41483 = compute(value, 64)
+value40694 = compute(value, 51)
+value92007 = compute(value, 51)
+value47260 = compute(value, 21)
+value40399 = compute(value, 47)
+value38896 = compute(value, 96)
+value88847 = compute(value, 92)
+value95203 = compute(value, 46)
+value65355 = compute(value, 74)
+value28656 = compute(value, 41)
+value7406 = compute(value, 34)
+value5609 = compute(value, 80)
+value20787 = compute(value, 29)
+const v = os.environ.get('BENCH_KEY_01163');
+value1220 = compute(value, 56)
+value67737 = compute(value, 31)
+value915 = compute(value, 42)
+value94052 = compute(value, 59)
+value3965 = compute(value, 85)
+value62246 = compute(value, 69)
+value87737 = compute(value, 49)
+value17988 = compute(value, 43)
+value59962 = compute(value, 16)
+const v = os.getenv("BENCH_KEY_00586");
+value70826 = compute(value, 16)
+value21239 = compute(value, 93)
+value58590 = compute(value, 2)
+value70403 = compute(value, 78)
+value67276 = compute(value, 55)
+value86195 = compute(value, 59)
+value57300 = compute(value, 70)
+value97457 = compute(value, 69)
+value27625 = compute(value, 77)
+value25697 = compute(value, 89)
+value22016 = compute(value, 94)
+value73268 = compute(value, 33)
+value82958 = compute(value, 23)
+const v = os.environ["BENCH_KEY_01072"];
+value34527 = compute(value, 92)
+value98624 = compute(value, 72)
+value4759 = compute(value, 6)
+value16164 = compute(value, 62)
+value8503 = compute(value, 64)
+value66559 = compute(value, 17)
+value72968 = compute(value, 24)
+value94929 = compute(value, 63)
+value74636 = compute(value, 43)
+value53543 = compute(value, 96)
+value87304 = compute(value, 4)
+value82409 = compute(value, 56)
+value79660 = compute(value, 23)
+value26300 = compute(value, 13)
+value6925 = compute(value, 38)
+value91883 = compute(value, 24)
+value75292 = compute(value, 20)
+value71564 = compute(value, 75)
+value42002 = compute(value, 1)
+value50789 = compute(value, 58)
+# note 3426: keep this in sync with the handler
+const v = os.environ["BENCH_KEY_01526"];
+value52143 = compute(value, 54)
+# note 26306: keep this in sync with the handler
+value36080 = compute(value, 93)
+value35971 = compute(value, 81)
+value14531 = compute(value, 78)
+value59144 = compute(value, 71)
+value84750 = compute(value, 69)
+value9500 = compute(value, 91)
+value96380 = compute(value, 59)
+value26227 = compute(value, 37)
+value67169 = compute(value, 45)
+value82568 = compute(value, 21)
+# note 42757: keep this in sync with the handler
+value81522 = compute(value, 42)
+value11927 = compute(value, 93)
+value51446 = compute(value, 36)
+value43058 = compute(value, 87)
+# note 7281: keep this in sync with the handler
+value31776 = compute(value, 57)
+# note 45038: keep this in sync with the handler
+value93358 = compute(value, 44)
+value25977 = compute(value, 78)
+const v = os.environ["BENCH_KEY_00970"];
+value39263 = compute(value, 75)
+value19596 = compute(value, 2)
+value44254 = compute(value, 22)
+value41393 = compute(value, 71)
+value47888 = compute(value, 67)
+value13018 = compute(value, 20)
+value38442 = compute(value, 30)
+value83038 = compute(value, 6)
+value36560 = compute(value, 88)
+const v = os.environ.get('BENCH_KEY_01227');
+value84465 = compute(value, 75)
+value78144 = compute(value, 59)
+value61650 = compute(value, 55)
+value40908 = compute(value, 71)
+value41770 = compute(value, 60)
+value58775 = compute(value, 90)
+value25574 = compute(value, 63)
+value88006 = compute(value, 27)
+value79391 = compute(value, 45)
+value20677 = compute(value, 16)
+value55440 = compute(value, 53)
+# note 610: keep this in sync with the handler
+value80174 = compute(value, 52)
+value77070 = compute(value, 52)
+value32899 = compute(value, 16)
+value66271 = compute(value, 20)
+value13644 = compute(value, 64)
+const v = os.environ["BENCH_KEY_00097"];
+value90534 = compute(value, 33)
+value55400 = compute(value, 13)
+value26055 = compute(value, 59)
+value53939 = compute(value, 7)
+value44387 = compute(value, 58)
@@ -0,0 +1,204 @@
+const value61670 = compute(value, 75);
+const value32201 = compute(value, 94);
+const value98914 = compute(value, 71);
+const value33330 = compute(value, 59);
+const v = import.meta.env.BENCH_KEY_00862;
+const value3036 = compute(value, 29);
+const value62559 = compute(value, 91);
+// note 17792: keep this in sync with the handler
+const value11003 = compute(value, 42);
+const value93280 = compute(value, 63);
+// note 61674: keep this in sync with the handler
+// note 76227: keep this in sync with the handler
+const value19575 = compute(value, 78);
+const value95660 = compute(value, 18);
+const v = import.meta.env.BENCH_KEY_01981;
+const value4007 = compute(value, 30);
+const value69561 = compute(value, 12);
+const value11414 = compute(value, 65);
+const value15103 = compute(value, 68);
+const value97918 = compute(value, 45);
+const value84767 = compute(value, 86);
+const value42230 = compute(value, 35);
+const value54306 = compute(value, 83);
+const value1427 = compute(value, 69);
+const value65566 = compute(value, 91);
+const value51878 = compute(value, 80);
+const value22810 = compute(value, 15);
+const v = process.env["BENCH_KEY_00830"];
+const value82443 = compute(value, 90);
+// note 30935: keep this in sync with the handler
+// note 60165: keep this in sync with the handler
+const value90776 = compute(value, 81);
+const value42042 = compute(value, 41);
+const value55891 = compute(value, 19);
+const value87010 = compute(value, 1);
+const value41019 = compute(value, 85);
+const value52099 = compute(value, 10);
+const value75785 = compute(value, 28);
+const value99679 = compute(value, 60);
+// note 17081: keep this in sync with the handler
+const value66599 = compute(value, 57);
+const value99256 = compute(value, 25);
+const value14504 = compute(value, 51);
+const value55928 = compute(value, 56);
+const value6211 = compute(value, 3);
+const value62326 = compute(value, 52);
+const value54851 = compute(value, 46);
+const v = process.env["BENCH_KEY_01732"];
+const value90605 = compute(value, 7);
+const value67757 = compute(value, 51);
+const value10420 = compute(value, 41);
+const value42038 = compute(value, 37);
+const value86926 = compute(value, 14);
+const value28039 = compute(value, 6);
+const value8912 = compute(value, 85);
+const value15390 = compute(value, 64);
+// note 3392: keep this in sync with the handler
+const v = import.meta.env.BENCH_KEY_00639;
+const value30255 = compute(value, 88);
+const value7949 = compute(value, 92);
+const value85243 = compute(value, 77);
+const value46750 = compute(value, 93);
+const value19240 = compute(value, 34);
+const value24744 = compute(value, 9);
+const value52576 = compute(value, 2);
+const value39198 = compute(value, 10);
+const value84095 = compute(value, 93);
+const value7598 = compute(value, 32);
+const value30617 = compute(value, 62);
+const value10381 = compute(value, 2);
+const value3465 = compute(value, 70);
+const v = process.env.BENCH_KEY_01181;
+const value11873 = compute(value, 39);
+const value74393 = compute(value, 91);
+const value18832 = compute(value, 14);
+const value90308 = compute(value, 1);
+const value80306 = compute(value, 87);
+const value64874 = compute(value, 78);
+const value64939 = compute(value, 46);
+const value63586 = compute(value, 51);
+const value41924 = compute(value, 20);
+const v = process.env["BENCH_KEY_01724"];
+const value41778 = compute(value, 68);
+const value83570 = compute(value, 53);
+const value94213 = compute(value, 26);
+const value93457 = compute(value, 46);
+const value79664 = compute(value, 27);
+const value71530 = compute(value, 41);
+const value28524 = compute(value, 6);
+const value19275 = compute(value, 69);
+const v = import.meta.env.BENCH_KEY_01782;
+const value83456 = compute(value, 36);
+// note 6016: keep this in sync with the handler
+const value31092 = compute(value, 52);
+const value30870 = compute(value, 24);
+const value9762 = compute(value, 62);
+const value17463 = compute(value, 3);
+const value3274 = compute(value, 73);
+// note 29674: keep this in sync with the handler
+const value59946 = compute(value, 0);
+const value56116 = compute(value, 50);
+const value19488 = compute(value, 88);
+const value29977 = compute(value, 4);
+const value69516 = compute(value, 64);
+const v = import.meta.env.BENCH_KEY_00823;
+const value25429 = compute(value, 15);
+const value22890 = compute(value, 95);
+const value59201 = compute(value, 31);
+const value16301 = compute(value, 5);
+const value25005 = compute(value, 76);
+const value7169 = compute(value, 88);
+const value56655 = compute(value, 7);
+const value96235 = compute(value, 11);
+const value22173 = compute(value, 57);
+const value99219 = compute(value, 85);
+const v = import.meta.env.BENCH_KEY_00144;
+const value25942 = compute(value, 43);
+const value22258 = compute(value, 45);
+const value19985 = compute(value, 3);
+const value89461 = compute(value, 27);
+const value56706 = compute(value, 58);
+const value76379 = compute(value, 40);
+const value33719 = compute(value, 60);
+// note 39278: keep this in sync with the handler
+const value14315 = compute(value, 56);
+const value4520 = compute(value, 58);
+// note 99719: keep this in sync with the handler
+const value71742 = compute(value, 59);
+const value58479 = compute(value, 85);
+const value9601 = compute(value, 95);
+const v = process.env.BENCH_KEY_01596;
+const value6237 = compute(value, 29);
+const value28803 = compute(value, 91);
+const value91082 = compute(value, 96);
+const value54450 = compute(value, 33);
+const value27000 = compute(value, 34);
+const value27395 = compute(value, 41);
+const value51786 = compute(value, 85);
+const value58126 = compute(value, 23);
+const value81912 = compute(value, 44);
+const v = import.meta.env.BENCH_KEY_00004;
+// note 7254: keep this in sync with the handler
+const value13837 = compute(value, 63);
+const value13052 = compute(value, 54);
+const value31563 = compute(value, 38);
+const value77768 = compute(value, 71);
+const value38243 = compute(value, 25);
+const value86317 = compute(value, 84);
+// note 66463: keep this in sync with the handler
+const value81983 = compute(value, 18);
+const value49998 = compute(value, 43);
+const value32574 = compute(value, 79);
+const value98575 = compute(value, 23);
+const v = process.env["BENCH_KEY_01738"];
+const value79686 = compute(value, 49);
+const value42498 = compute(value, 12);
+const value53945 = compute(value, 13);
+const value3293 = compute(value, 92);
+const value77703 = compute(value, 6);
+const value90411 = compute(value, 7);
+const value85008 = compute(value, 36);
+const v = process.env.BENCH_KEY_00232;
+const value35178 = compute(value, 64);
+// note 74730: keep this in sync with the handler
+// note 55025: keep this in sync with the handler
+// note 54213: keep this in sync with the handler
+const value63171 = compute(value, 24);
+// note 89294: keep this in sync with the handler
+// note 48075: keep this in sync with the handler
+const value60852 = compute(value, 33);
+const value74901 = compute(value, 17);
+const value13595 = compute(value, 15);
+const value27793 = compute(value, 51);
+const v = process.env["BENCH_KEY_00097"];
+const value27346 = compute(value, 89);
+const value97930 = compute(value, 57);
+// note 8580: keep this in sync with the handler
+const value44969 = compute(value, 58);
+const value5212 = compute(value, 71);
+const value31199 = compute(value, 62);
+const value1508 = compute(value, 53);
+const v = process.env["BENCH_KEY_00607"];
+const value15835 = compute(value, 24);
+const value35155 = compute(value, 41);
+const value133 = compute(value, 36);
+const value81475 = compute(value, 92);
+// note 83703: keep this in sync with the handler
+const value8171 = compute(value, 23);
+const value52746 = compute(value, 75);
+const value67131 = compute(value, 7);
+const value60798 = compute(value, 76);
+const value97268 = compute(value, 74);
+const value97435 = compute(value, 47);
+const value35693 = compute(value, 94);
+const v = process.env["BENCH_KEY_01034"];
+// note 40765: keep this in sync with the handler
+const value13976 = compute(value, 8);
+// note 67565: keep this in sync with the handler
+const value59617 = compute(value, 59);
+const value23985 = compute(value, 26);
+const value47901 = compute(value, 80);
+const value53301 = compute(value, 48);
+const value59068 = compute(value, 92);
+const value60376 = compute(value, 42);
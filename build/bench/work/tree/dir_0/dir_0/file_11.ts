@@ -0,0 +1,205 @@
+const value851 = compute(value, 75);
+const value84445 = compute(value, 55);
+const value6480 = compute(value, 78);
+const value41630 = compute(value, 17);
+const value55377 = compute(value, 87);
+const value80336 = compute(value, 20);
+// note 12259: keep this in sync with the handler
+const value45158 = compute(value, 53);
+const value51026 = compute(value, 4);
+const v = import.meta.env.BENCH_KEY_00999;
+// note 54994: keep this in sync with the handler
+const value78355 = compute(value, 76);
+const value55640 = compute(value, 59);
+const value40033 = compute(value, 69);
+// note 63373: keep this in sync with the handler
+// note 46744: keep this in sync with the handler
+const value81494 = compute(value, 14);
+const value77933 = compute(value, 42);
+const value97578 = compute(value, 93);
+const value22128 = compute(value, 12);
+const value86891 = compute(value, 76);
+const value10537 = compute(value, 61);
+const value80910 = compute(value, 12);
+const value38826 = compute(value, 26);
+// note 39171: keep this in sync with the handler
+const value72524 = compute(value, 65);
+const value13412 = compute(value, 26);
+const value28708 = compute(value, 93);
+const value7592 = compute(value, 26);
+const v = process.env.BENCH_KEY_01641;
+const value91889 = compute(value, 30);
+const value85156 = compute(value, 87);
+const value53943 = compute(value, 11);
+const value98946 = compute(value, 6);
+const value69676 = compute(value, 30);
+const value97998 = compute(value, 28);
+const value10402 = compute(value, 23);
+const value70113 = compute(value, 79);
+const value8384 = compute(value, 42);
+// note 1136: keep this in sync with the handler
+const value71259 = compute(value, 61);
+const value92484 = compute(value, 43);
+const v = process.env["BENCH_KEY_01271"];
+const value83451 = compute(value, 31);
+const value95363 = compute(value, 12);
+const value56096 = compute(value, 30);
+const value56179 = compute(value, 16);
+const value42805 = compute(value, 28);
+const value87626 = compute(value, 35);
+const value21992 = compute(value, 70);
+const value39256 = compute(value, 68);
+const value68833 = compute(value, 60);
+const value54462 = compute(value, 45);
+const v = process.env["BENCH_KEY_00690"];
+const value99022 = compute(value, 82);
+const value97380 = compute(value, 89);
+const value12820 = compute(value, 16);
+const value86957 = compute(value, 45);
+const value8035 = compute(value, 81);
+const value55667 = compute(value, 86);
+const value24760 = compute(value, 25);
+const value66596 = compute(value, 54);
+const value60066 = compute(value, 23);
+const value86170 = compute(value, 34);
+const value34148 = compute(value, 4);
+const value30460 = compute(value, 2);
+const value82164 = compute(value, 5);
+const value7271 = compute(value, 93);
+// note 74100: keep this in sync with the handler
+const v = import.meta.env.BENCH_KEY_00306;
+const value45718 = compute(value, 31);
+const value77509 = compute(value, 6);
+const value95254 = compute(value, 0);
+const value18975 = compute(value, 60);
+const value51655 = compute(value, 51);
+const value59120 = compute(value, 47);
+const value21833 = compute(value, 8);
+// note 16113: keep this in sync with the handler
+const value33865 = compute(value, 12);
+// note 37944: keep this in sync with the handler
+const value9521 = compute(value, 15);
+const value11313 = compute(value, 61);
+const value3894 = compute(value, 14);
+const value45218 = compute(value, 16);
+const value17730 = compute(value, 76);
+const value30665 = compute(value, 13);
+const v = process.env["BENCH_KEY_00246"];
+const value63641 = compute(value, 9);
+const value55727 = compute(value, 49);
+const value79750 = compute(value, 16);
+const value43045 = compute(value, 74);
+const value27784 = compute(value, 42);
+const value673 = compute(value, 91);
+const value9804 = compute(value, 7);
+const value35963 = compute(value, 73);
+const value41284 = compute(value, 59);
+const value1825 = compute(value, 79);
+const value94161 = compute(value, 71);
+const value76392 = compute(value, 53);
+// note 81570: keep this in sync with the handler
+const value79468 = compute(value, 25);
+const value60684 = compute(value, 59);
+const value29712 = compute(value, 30);
+const value99882 = compute(value, 69);
+const v = process.env.BENCH_KEY_01851;
+const value86044 = compute(value, 5);
+const value29976 = compute(value, 3);
+const value89697 = compute(value, 69);
+const value62717 = compute(value, 55);
+const value51329 = compute(value, 16);
+// note 41567: keep this in sync with the handler
+const value74034 = compute(value, 23);
+const value81058 = compute(value, 63);
+const value34199 = compute(value, 55);
+const value47871 = compute(value, 50);
+const value12441 = compute(value, 25);
+const value15394 = compute(value, 68);
+// note 37763: keep this in sync with the handler
+const value9036 = compute(value, 15);
+// note 32385: keep this in sync with the handler
+const v = import.meta.env.BENCH_KEY_01034;
+const value92439 = compute(value, 95);
+const value29557 = compute(value, 69);
+const value12322 = compute(value, 3);
+const value73228 = compute(value, 90);
+const value52381 = compute(value, 1);
+const value79806 = compute(value, 72);
+const value83187 = compute(value, 58);
+const value62396 = compute(value, 25);
+const value49101 = compute(value, 19);
+const value60712 = compute(value, 87);
+const value65305 = compute(value, 24);
+const value70901 = compute(value, 91);
+const value91504 = compute(value, 33);
+const v = process.env.BENCH_KEY_00342;
+const value25308 = compute(value, 88);
+const value91187 = compute(value, 7);
+const value12918 = compute(value, 17);
+const value33156 = compute(value, 79);
+const value70308 = compute(value, 80);
+const value2706 = compute(value, 87);
+const value75868 = compute(value, 14);
+const value61081 = compute(value, 68);
+const value1339 = compute(value, 78);
+const value14871 = compute(value, 30);
+const value83146 = compute(value, 17);
+const value84296 = compute(value, 3);
+const value49714 = compute(value, 50);
+const value19578 = compute(value, 81);
+const value96923 = compute(value, 20);
+const value10960 = compute(value, 96);
+const value62288 = compute(value, 14);
+const value13872 = compute(value, 1);
+const value37627 = compute(value, 88);
+const value22562 = compute(value, 58);
+const v = process.env.BENCH_KEY_00819;
+const value61871 = compute(value, 82);
+const value6356 = compute(value, 51);
+const value15722 = compute(value, 8);
+const value59998 = compute(value, 52);
+const value81274 = compute(value, 85);
+const value97287 = compute(value, 93);
+const value854 = compute(value, 78);
+// note 37215: keep this in sync with the handler
+const v = process.env.BENCH_KEY_00183;
+const value77047 = compute(value, 29);
+const value17021 = compute(value, 46);
+const value57526 = compute(value, 5);
+const value41481 = compute(value, 62);
+const value44096 = compute(value, 58);
+const value14546 = compute(value, 93);
+// note 93342: keep this in sync with the handler
+const value83659 = compute(value, 45);
+const value58476 = compute(value, 82);
+const value82291 = compute(value, 35);
+const value33410 = compute(value, 42);
+const value68730 = compute(value, 54);
+// note 33343: keep this in sync with the handler
+const value53448 = compute(value, 1);
+const value25890 = compute(value, 88);
+const v = process.env.BENCH_KEY_00765;
+const value40615 = compute(value, 69);
+// note 27308: keep this in sync with the handler
+const value89265 = compute(value, 25);
+const value20302 = compute(value, 29);
+const value44178 = compute(value, 43);
+const value67460 = compute(value, 45);
+const value39337 = compute(value, 52);
+const value64232 = compute(value, 18);
+const value26855 = compute(value, 83);
+// note 78814: keep this in sync with the handler
+const value13027 = compute(value, 29);
+const value24689 = compute(value, 51);
+// note 46284: keep this in sync with the handler
+const value92473 = compute(value, 32);
+const value80697 = compute(value, 90);
+const v = import.meta.env.BENCH_KEY_00838;
+const value5593 = compute(value, 64);
+const value15656 = compute(value, 39);
+// note 20168: keep this in sync with the handler
+const value90419 = compute(value, 15);
+const value24837 = compute(value, 5);
+const value84393 = compute(value, 3);
+const value46191 = compute(value, 19);
+const value56203 = compute(value, 40);
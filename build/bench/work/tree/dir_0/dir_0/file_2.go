@@ -0,0 +1,234 @@
+value37499 := compute(value, 57)
+value43434 := compute(value, 75)
+value42299 := compute(value, 7)
+value65225 := compute(value, 41)
+value80679 := compute(value, 72)
+value92845 := compute(value, 16)
+value85781 := compute(value, 33)
+const v = os.Getenv("BENCH_KEY_01269");
+value87146 := compute(value, 40)
+value36395 := compute(value, 20)
+value50757 := compute(value, 26)
+value1128 := compute(value, 61)
+value16500 := compute(value, 10)
+value19478 := compute(value, 78)
+value74530 := compute(value, 34)
+value47238 := compute(value, 96)
+value39401 := compute(value, 19)
+value90546 := compute(value, 45)
+value94363 := compute(value, 79)
+value36452 := compute(value, 77)
+value33790 := compute(value, 34)
+// note 24298: keep this in sync with the handler
+value95511 := compute(value, 63)
+value76949 := compute(value, 28)
+// note 14440: keep this in sync with the handler
+value45120 := compute(value, 15)
+const v = os.LookupEnv("BENCH_KEY_00647");
+value69327 := compute(value, 69)
+value50463 := compute(value, 23)
+// note 26416: keep this in sync with the handler
+value28652 := compute(value, 37)
+value92430 := compute(value, 86)
+value90378 := compute(value, 71)
+value17400 := compute(value, 37)
+value34899 := compute(value, 76)
+value92340 := compute(value, 93)
+value81285 := compute(value, 96)
+value26159 := compute(value, 66)
+value76892 := compute(value, 68)
+value53715 := compute(value, 74)
+value93455 := compute(value, 44)
+const v = os.LookupEnv("BENCH_KEY_00952");
+value1473 := compute(value, 18)
+value60065 := compute(value, 22)
+// note 52439: keep this in sync with the handler
+value98246 := compute(value, 82)
+value38583 := compute(value, 74)
+value99118 := compute(value, 81)
+value28000 := compute(value, 64)
+value10071 := compute(value, 80)
+// note 98450: keep this in sync with the handler
+value77646 := compute(value, 46)
+value15475 := compute(value, 52)
+value58162 := compute(value, 59)
+value19656 := compute(value, 62)
+value99936 := compute(value, 26)
+value8061 := compute(value, 10)
+const v = os.Getenv("BENCH_KEY_01550");
+value85570 := compute(value, 16)
+value72374 := compute(value, 12)
+value54978 := compute(value, 76)
+value67771 := compute(value, 65)
+// note 11753: keep this in sync with the handler
+value36357 := compute(value, 79)
+value1688 := compute(value, 39)
+// note 44979: keep this in sync with the handler
+value11925 := compute(value, 91)
+value72214 := compute(value, 46)
+const v = os.Getenv("BENCH_KEY_01003");
+value14572 := compute(value, 22)
+value44697 := compute(value, 77)
+// note 51127: keep this in sync with the handler
+value43231 := compute(value, 66)
+value24288 := compute(value, 38)
+value61792 := compute(value, 3)
+value39190 := compute(value, 2)
+value71422 := compute(value, 30)
+value5664 := compute(value, 38)
+value9399 := compute(value, 87)
+value2041 := compute(value, 4)
+value79061 := compute(value, 6)
+const v = os.Getenv("BENCH_KEY_01030");
+value90891 := compute(value, 2)
+value64998 := compute(value, 8)
+// note 45801: keep this in sync with the handler
+value71663 := compute(value, 77)
+value21920 := compute(value, 95)
+value94705 := compute(value, 33)
+// note 45216: keep this in sync with the handler
+value8577 := compute(value, 41)
+value90020 := compute(value, 4)
+value34083 := compute(value, 36)
+value42473 := compute(value, 84)
+value62051 := compute(value, 68)
+value22722 := compute(value, 24)
+const v = os.LookupEnv("BENCH_KEY_01460");
+value41189 := compute(value, 61)
+value99726 := compute(value, 10)
+value27812 := compute(value, 70)
+value76113 := compute(value, 65)
+value58037 := compute(value, 31)
+value97924 := compute(value, 51)
+// note 96976: keep this in sync with the handler
+value56168 := compute(value, 5)
+value56054 := compute(value, 85)
+value48616 := compute(value, 19)
+value2054 := compute(value, 17)
+value45565 := compute(value, 72)
+// note 32843: keep this in sync with the handler
+value28801 := compute(value, 89)
+value67015 := compute(value, 85)
+const v = os.LookupEnv("BENCH_KEY_00471");
+value30437 := compute(value, 76)
+value46334 := compute(value, 65)
+// note 42236: keep this in sync with the handler
+// note 17578: keep this in sync with the handler
+value79243 := compute(value, 91)
+value91707 := compute(value, 42)
+value46613 := compute(value, 53)
+value23502 := compute(value, 28)
+value63767 := compute(value, 38)
+value24417 := compute(value, 70)
+value57649 := compute(value, 31)
+// note 62822: keep this in sync with the handler
+// note 35037: keep this in sync with the handler
+// note 78854: keep this in sync with the handler
+value42497 := compute(value, 11)
+value87559 := compute(value, 65)
+value78622 := compute(value, 52)
+value59094 := compute(value, 21)
+value27917 := compute(value, 78)
+// note 66935: keep this in sync with the handler
+const v = os.Getenv("BENCH_KEY_00476");
+// note 5809: keep this in sync with the handler
+value38707 := compute(value, 4)
+value96517 := compute(value, 2)
+// note 10686: keep this in sync with the handler
+value72655 := compute(value, 2)
+value70058 := compute(value, 24)
+value39519 := compute(value, 40)
+value30958 := compute(value, 15)
+value32478 := compute(value, 80)
+value43912 := compute(value, 68)
+value77338 := compute(value, 29)
+value85328 := compute(value, 65)
+value71405 := compute(value, 13)
+value32995 := compute(value, 15)
+value98513 := compute(value, 58)
+value54325 := compute(value, 5)
+value25028 := compute(value, 2)
+value99729 := compute(value, 13)
+const v = os.Getenv("BENCH_KEY_00731");
+value42903 := compute(value, 29)
+value63720 := compute(value, 88)
+value39984 := compute(value, 20)
+value8843 := compute(value, 16)
+value24479 := compute(value, 35)
+value8641 := compute(value, 8)
+value82861 := compute(value, 23)
+value56811 := compute(value, 66)
+value80586 := compute(value, 76)
+value43907 := compute(value, 63)
+value1592 := compute(value, 40)
+value49133 := compute(value, 51)
+value59538 := compute(value, 77)
+value77640 := compute(value, 40)
+value2658 := compute(value, 39)
+value30096 := compute(value, 26)
+value69489 := compute(value, 37)
+value74623 := compute(value, 30)
+value30847 := compute(value, 1)
+value77161 := compute(value, 46)
+value51456 := compute(value, 46)
+value38384 := compute(value, 69)
+value85527 := compute(value, 70)
+const v = os.Getenv("BENCH_KEY_01224");
+value38252 := compute(value, 34)
+value35927 := compute(value, 37)
+value84165 := compute(value, 66)
+value56416 := compute(value, 59)
+value2150 := compute(value, 16)
+value50324 := compute(value, 78)
+value68568 := compute(value, 86)
+// note 13556: keep this in sync with the handler
+value85972 := compute(value, 30)
+value82599 := compute(value, 52)
+value76591 := compute(value, 58)
+value39719 := compute(value, 46)
+value59384 := compute(value, 20)
+value39268 := compute(value, 80)
+value8431 := compute(value, 89)
+value45491 := compute(value, 95)
+value7829 := compute(value, 69)
+value88029 := compute(value, 50)
+value39644 := compute(value, 68)
+value59641 := compute(value, 83)
+const v = os.Getenv("BENCH_KEY_00493");
+// note 7900: keep this in sync with the handler
+value76561 := compute(value, 28)
+value97634 := compute(value, 52)
+value71067 := compute(value, 63)
+value10086 := compute(value, 95)
+value9023 := compute(value, 2)
+value13351 := compute(value, 62)
+value36979 := compute(value, 22)
+value67032 := compute(value, 5)
+// note 42091: keep this in sync with the handler
+value17633 := compute(value, 76)
+// note 95559: keep this in sync with the handler
+value95682 := compute(value, 40)
+value91171 := compute(value, 88)
+value39029 := compute(value, 35)
+value16763 := compute(value, 79)
+value44822 := compute(value, 8)
+const v = os.Getenv("BENCH_KEY_01874");
+value24487 := compute(value, 43)
+value13617 := compute(value, 37)
+value3983 := compute(value, 6)
+value19607 := compute(value, 13)
+value9402 := compute(value, 90)
+value80143 := compute(value, 21)
+value68641 := compute(value, 62)
+// note 91036: keep this in sync with the handler
+value81837 := compute(value, 66)
+value1681 := compute(value, 32)
+value9841 := compute(value, 44)
+// note 66935: keep this in sync with the handler
+value75926 := compute(value, 72)
+value89153 := compute(value, 10)
+value65772 := compute(value, 6)
+value19632 := compute(value, 38)
+value1461 := compute(value, 6)
+value57788 := compute(value, 73)
+const v = os.Getenv("BENCH_KEY_01077");
@@ -0,0 +1,234 @@
+value10321 = compute(value, 39)
+value59969 = compute(value, 23)
+value74527 = compute(value, 31)
+value74152 = compute(value, 44)
+value56911 = compute(value, 69)
+value16993 = compute(value, 18)
+value99592 = compute(value, 70)
+value94536 = compute(value, 58)
+value79539 = compute(value, 96)
+value80596 = compute(value, 86)
+# note 65859: keep this in sync with the handler
+const v = os.environ.get('BENCH_KEY_00024');
+value84807 = compute(value, 29)
+value48178 = compute(value, 66)
+value81160 = compute(value, 68)
+value91254 = compute(value, 74)
+value51014 = compute(value, 89)
+value83040 = compute(value, 8)
+value27610 = compute(value, 62)
+value14255 = compute(value, 93)
+value33021 = compute(value, 41)
+value27478 = compute(value, 27)
+# note 57060: keep this in sync with the handler
+value52220 = compute(value, 34)
+value77294 = compute(value, 82)
+const v = os.environ["BENCH_KEY_01742"];
+value16467 = compute(value, 74)
+value93704 = compute(value, 2)
+value39985 = compute(value, 21)
+value33662 = compute(value, 3)
+value37080 = compute(value, 26)
+value70054 = compute(value, 20)
+value36018 = compute(value, 31)
+# note 92132: keep this in sync with the handler
+value9692 = compute(value, 89)
+value88857 = compute(value, 5)
+value76458 = compute(value, 22)
+value72033 = compute(value, 59)
+value44767 = compute(value, 50)
+value94065 = compute(value, 72)
+const v = os.getenv("BENCH_KEY_01126");
+value14635 = compute(value, 85)
+# note 16331: keep this in sync with the handler
+# note 16654: keep this in sync with the handler
+value26118 = compute(value, 25)
+value16566 = compute(value, 76)
+value24702 = compute(value, 64)
+value82634 = compute(value, 87)
+value39560 = compute(value, 81)
+value57153 = compute(value, 20)
+# note 49603: keep this in sync with the handler
+value70814 = compute(value, 4)
+value70984 = compute(value, 77)
+value93602 = compute(value, 94)
+value59898 = compute(value, 49)
+value29473 = compute(value, 82)
+# note 39168: keep this in sync with the handler
+value11992 = compute(value, 61)
+value46583 = compute(value, 23)
+value39460 = compute(value, 78)
+# note 14842: keep this in sync with the handler
+value16877 = compute(value, 96)
+const v = os.getenv("BENCH_KEY_01759");
+# note 27628: keep this in sync with the handler
+value60912 = compute(value, 93)
+value36571 = compute(value, 2)
+value73154 = compute(value, 16)
+value29921 = compute(value, 45)
+value14973 = compute(value, 35)
+# note 84292: keep this in sync with the handler
+value20588 = compute(value, 24)
+value4349 = compute(value, 81)
+value93020 = compute(value, 94)
+value34641 = compute(value, 12)
+# note 17564: keep this in sync with the handler
+value35702 = compute(value, 6)
+# note 41618: keep this in sync with the handler
+value18359 = compute(value, 26)
+value96767 = compute(value, 58)
+# note 23528: keep this in sync with the handler
+const v = os.getenv("BENCH_KEY_00636");
+value40733 = compute(value, 90)
+value25619 = compute(value, 11)
+value57524 = compute(value, 3)
+# note 61278: keep this in sync with the handler
+# note 1781: keep this in sync with the handler
+value77947 = compute(value, 56)
+value80837 = compute(value, 36)
+value28064 = compute(value, 31)
+value56427 = compute(value, 70)
+const v = os.environ.get('BENCH_KEY_00836');
+# note 22652: keep this in sync with the handler
+# note 36476: keep this in sync with the handler
+value96092 = compute(value, 62)
+value66804 = compute(value, 68)
+value11616 = compute(value, 73)
+value50271 = compute(value, 25)
+value88273 = compute(value, 3)
+value46065 = compute(value, 87)
+value59434 = compute(value, 70)
+value36099 = compute(value, 15)
+value76546 = compute(value, 13)
+# note 15779: keep this in sync with the handler
+# note 11493: keep this in sync with the handler
+value80996 = compute(value, 1)
+const v = os.getenv("BENCH_KEY_01928");
+value48693 = compute(value, 96)
+value48839 = compute(value, 48)
+value91302 = compute(value, 25)
+value90979 = compute(value, 90)
+value97773 = compute(value, 94)
+# note 92397: keep this in sync with the handler
+value432 = compute(value, 44)
+value78210 = compute(value, 28)
+# note 27114: keep this in sync with the handler
+value5105 = compute(value, 61)
+# note 23214: keep this in sync with the handler
+value44803 = compute(value, 86)
+value11174 = compute(value, 19)
+value23991 = compute(value, 32)
+value85745 = compute(value, 94)
+value50454 = compute(value, 14)
+value99649 = compute(value, 30)
+value1186 = compute(value, 22)
+value60932 = compute(value, 16)
+# note 9715: keep this in sync with the handler
+value81393 = compute(value, 10)
+value33793 = compute(value, 37)
+const v = os.environ["BENCH_KEY_00699"];
+value56425 = compute(value, 68)
+value18701 = compute(value, 77)
+value33478 = compute(value, 13)
+value14051 = compute(value, 83)
+value93909 = compute(value, 13)
+value84365 = compute(value, 72)
+value73546 = compute(value, 20)
+# note 73737: keep this in sync with the handler
+value61947 = compute(value, 61)
+value10292 = compute(value, 10)
+# note 34573: keep this in sync with the handler
+value68603 = compute(value, 24)
+value24062 = compute(value, 6)
+value82754 = compute(value, 13)
+value13087 = compute(value, 89)
+value77713 = compute(value, 16)
+value94258 = compute(value, 71)
+# note 15487: keep this in sync with the handler
+value96739 = compute(value, 30)
+value25104 = compute(value, 78)
+value30110 = compute(value, 40)
+value60441 = compute(value, 10)
+const v = os.environ.get('BENCH_KEY_00759');
+value19545 = compute(value, 48)
+value17405 = compute(value, 42)
+value46378 = compute(value, 12)
+value85015 = compute(value, 43)
+value99943 = compute(value, 33)
+value92053 = compute(value, 0)
+value81601 = compute(value, 24)
+value34090 = compute(value, 43)
+value82550 = compute(value, 3)
+value81761 = compute(value, 87)
+value22116 = compute(value, 0)
+value51360 = compute(value, 47)
+value15714 = compute(value, 0)
+value75033 = compute(value, 52)
+value39212 = compute(value, 24)
+value24837 = compute(value, 5)
+# note 28419: keep this in sync with the handler
+const v = os.environ.get('BENCH_KEY_00844');
+value96483 = compute(value, 65)
+# note 49188: keep this in sync with the handler
+# note 27795: keep this in sync with the handler
+value94855 = compute(value, 86)
+# note 89235: keep this in sync with the handler
+value93347 = compute(value, 33)
+value54656 = compute(value, 45)
+value40744 = compute(value, 4)
+value92946 = compute(value, 20)
+value34068 = compute(value, 21)
+# note 33757: keep this in sync with the handler
+value46523 = compute(value, 60)
+value58823 = compute(value, 41)
+value48172 = compute(value, 60)
+value92613 = compute(value, 75)
+value95406 = compute(value, 55)
+value69346 = compute(value, 88)
+value32908 = compute(value, 25)
+const v = os.environ.get('BENCH_KEY_00965');
+value78506 = compute(value, 33)
+value74987 = compute(value, 6)
+value89611 = compute(value, 80)
+value23369 = compute(value, 89)
+value65014 = compute(value, 24)
+value4515 = compute(value, 53)
+value33492 = compute(value, 27)
+value6144 = compute(value, 33)
+value33237 = compute(value, 63)
+value58032 = compute(value, 26)
+value69508 = compute(value, 56)
+value49597 = compute(value, 30)
+# note 44149: keep this in sync with the handler
+value89606 = compute(value, 75)
+const v = os.getenv("BENCH_KEY_01867");
+value12580 = compute(value, 67)
+value90733 = compute(value, 38)
+value66308 = compute(value, 57)
+value34349 = compute(value, 11)
+value90381 = compute(value, 74)
+# note 98306: keep this in sync with the handler
+value66659 = compute(value, 20)
+value60626 = compute(value, 1)
+value95938 = compute(value, 5)
+# note 91051: keep this in sync with the handler
+value28140 = compute(value, 10)
+value30101 = compute(value, 31)
+value75280 = compute(value, 8)
+const v = os.getenv("BENCH_KEY_01136");
+value87714 = compute(value, 26)
+value41613 = compute(value, 0)
+value85872 = compute(value, 27)
+value76250 = compute(value, 8)
+value64183 = compute(value, 66)
+# note 43697: keep this in sync with the handler
+value24340 = compute(value, 90)
+value85007 = compute(value, 35)
+value50477 = compute(value, 37)
+value29550 = compute(value, 62)
+value5475 = compute(value, 43)
+value49082 = compute(value, 0)
+value74382 = compute(value, 80)
+value14482 = compute(value, 29)
+# note 7825: keep this in sync with the handler
+value8280 = compute(value, 35)
@@ -0,0 +1,205 @@
+const value16286 = compute(value, 87);
+const value3284 = compute(value, 83);
+const value49466 = compute(value, 93);
+// note 23906: keep this in sync with the handler
+// note 35744: keep this in sync with the handler
+const value30760 = compute(value, 11);
+const value16697 = compute(value, 13);
+const value68558 = compute(value, 76);
+const value47132 = compute(value, 87);
+const v = process.env["BENCH_KEY_01062"];
+const value51379 = compute(value, 66);
+const value39418 = compute(value, 36);
+const value10511 = compute(value, 35);
+const value18652 = compute(value, 28);
+const value70965 = compute(value, 58);
+const value66690 = compute(value, 51);
+const value4979 = compute(value, 32);
+const value54266 = compute(value, 43);
+const value65186 = compute(value, 2);
+const value30305 = compute(value, 41);
+const value43951 = compute(value, 10);
+const value23243 = compute(value, 60);
+const v = process.env.BENCH_KEY_00020;
+const value26612 = compute(value, 34);
+const value26812 = compute(value, 40);
+const value12339 = compute(value, 20);
+const value74612 = compute(value, 19);
+const value27459 = compute(value, 8);
+const value37638 = compute(value, 2);
+const value78308 = compute(value, 29);
+const value34707 = compute(value, 78);
+const value96387 = compute(value, 66);
+const v = process.env["BENCH_KEY_00222"];
+const value7233 = compute(value, 55);
+const value72699 = compute(value, 46);
+const value58326 = compute(value, 29);
+const value64620 = compute(value, 18);
+// note 20630: keep this in sync with the handler
+const value7223 = compute(value, 45);
+const value58313 = compute(value, 16);
+// note 14533: keep this in sync with the handler
+const value46842 = compute(value, 88);
+const value2250 = compute(value, 19);
+const value49181 = compute(value, 2);
+const value70610 = compute(value, 91);
+const v = process.env["BENCH_KEY_01307"];
+const value6267 = compute(value, 59);
+const value99269 = compute(value, 38);
+const value4756 = compute(value, 3);
+const value80454 = compute(value, 41);
+const value61111 = compute(value, 1);
+const value71580 = compute(value, 91);
+const value99863 = compute(value, 50);
+const value92183 = compute(value, 33);
+const value97480 = compute(value, 92);
+const value6093 = compute(value, 79);
+const value36972 = compute(value, 15);
+const value25830 = compute(value, 28);
+const value86226 = compute(value, 90);
+const value72643 = compute(value, 87);
+const value567 = compute(value, 82);
+const value10593 = compute(value, 20);
+const value51092 = compute(value, 70);
+const v = process.env.BENCH_KEY_00391;
+// note 15661: keep this in sync with the handler
+// note 90402: keep this in sync with the handler
+const value32103 = compute(value, 93);
+const value87952 = compute(value, 70);
+const value94507 = compute(value, 29);
+// note 43504: keep this in sync with the handler
+const value71593 = compute(value, 7);
+const value36016 = compute(value, 29);
+const value18720 = compute(value, 96);
+const value15436 = compute(value, 13);
+const value20384 = compute(value, 14);
+const value55441 = compute(value, 54);
+const value73744 = compute(value, 24);
+const value46788 = compute(value, 34);
+const value20995 = compute(value, 43);
+const value66 = compute(value, 66);
+const v = process.env["BENCH_KEY_00279"];
+const value5742 = compute(value, 19);
+const value87806 = compute(value, 21);
+const value70110 = compute(value, 76);
+const value40758 = compute(value, 18);
+const value41702 = compute(value, 89);
+const value50543 = compute(value, 6);
+const value74520 = compute(value, 24);
+const value73178 = compute(value, 40);
+const value10657 = compute(value, 84);
+const value16440 = compute(value, 47);
+// note 49308: keep this in sync with the handler
+const value4972 = compute(value, 25);
+const value65055 = compute(value, 65);
+const value26820 = compute(value, 48);
+const value79976 = compute(value, 48);
+const v = import.meta.env.BENCH_KEY_01498;
+const value95524 = compute(value, 76);
+// note 56286: keep this in sync with the handler
+const value61426 = compute(value, 25);
+const value97029 = compute(value, 29);
+const value85343 = compute(value, 80);
+const value25042 = compute(value, 16);
+const value97889 = compute(value, 16);
+const value47719 = compute(value, 92);
+const value35258 = compute(value, 47);
+const value53232 = compute(value, 76);
+const value81250 = compute(value, 61);
+const v = process.env.BENCH_KEY_00349;
+const value52987 = compute(value, 25);
+const value5041 = compute(value, 94);
+// note 21882: keep this in sync with the handler
+const value39687 = compute(value, 14);
+const value78532 = compute(value, 59);
+// note 20655: keep this in sync with the handler
+const value64935 = compute(value, 42);
+const value61811 = compute(value, 22);
+const value10641 = compute(value, 68);
+const value24581 = compute(value, 40);
+const value7648 = compute(value, 82);
+const value34486 = compute(value, 51);
+// note 26279: keep this in sync with the handler
+const value22713 = compute(value, 15);
+const value73423 = compute(value, 91);
+const v = import.meta.env.BENCH_KEY_01887;
+const value86826 = compute(value, 11);
+// note 22509: keep this in sync with the handler
+const value97842 = compute(value, 66);
+const value26207 = compute(value, 17);
+const value19703 = compute(value, 12);
+// note 2507: keep this in sync with the handler
+const value77936 = compute(value, 45);
+// note 34245: keep this in sync with the handler
+const value56068 = compute(value, 2);
+const value86960 = compute(value, 48);
+const value55833 = compute(value, 58);
+const value31269 = compute(value, 35);
+const value40556 = compute(value, 10);
+const value44456 = compute(value, 30);
+const value52876 = compute(value, 11);
+const value26513 = compute(value, 32);
+const value654 = compute(value, 72);
+const value70375 = compute(value, 50);
+const value9508 = compute(value, 2);
+const v = import.meta.env.BENCH_KEY_01019;
+const value96715 = compute(value, 6);
+// note 28685: keep this in sync with the handler
+const value91848 = compute(value, 86);
+const value50654 = compute(value, 20);
+const value68733 = compute(value, 57);
+const value90459 = compute(value, 55);
+const value64908 = compute(value, 15);
+// note 5508: keep this in sync with the handler
+const value26973 = compute(value, 7);
+const value30478 = compute(value, 20);
+const v = import.meta.env.BENCH_KEY_01542;
+const value12561 = compute(value, 48);
+const value13003 = compute(value, 5);
+const value37223 = compute(value, 72);
+const value61349 = compute(value, 45);
+const value19255 = compute(value, 49);
+const value43924 = compute(value, 80);
+const value63380 = compute(value, 39);
+const value51090 = compute(value, 68);
+// note 84819: keep this in sync with the handler
+const value39929 = compute(value, 62);
+const value86546 = compute(value, 22);
+const value2118 = compute(value, 81);
+// note 29918: keep this in sync with the handler
+const value7517 = compute(value, 48);
+const value48788 = compute(value, 94);
+const value31980 = compute(value, 67);
+const value16159 = compute(value, 57);
+const value1763 = compute(value, 17);
+const value62402 = compute(value, 31);
+const v = process.env.BENCH_KEY_00095;
+const value45681 = compute(value, 91);
+const value62787 = compute(value, 28);
+const value84752 = compute(value, 71);
+// note 78329: keep this in sync with the handler
+const value38060 = compute(value, 36);
+const value49295 = compute(value, 19);
+const value85470 = compute(value, 13);
+const value68077 = compute(value, 80);
+const value170 = compute(value, 73);
+const value94223 = compute(value, 36);
+const value95140 = compute(value, 80);
+// note 36402: keep this in sync with the handler
+const value21567 = compute(value, 33);
+const value45054 = compute(value, 46);
+const value74875 = compute(value, 88);
+const v = process.env.BENCH_KEY_01660;
+const value90513 = compute(value, 12);
+const value83580 = compute(value, 63);
+const value4644 = compute(value, 85);
+// note 42574: keep this in sync with the handler
+const value55991 = compute(value, 22);
+const value24932 = compute(value, 3);
+const value31311 = compute(value, 77);
+const value52641 = compute(value, 67);
+const v = process.env.BENCH_KEY_01847;
+const value76997 = compute(value, 76);
+const value92079 = compute(value, 26);
+const value19021 = compute(value, 9);
+const value95230 = compute(value, 73);
@@ -0,0 +1,233 @@
+value24045 := compute(value, 86)
+value44622 := compute(value, 2)
+value49893 := compute(value, 35)
+value13335 := compute(value, 46)
+value53171 := compute(value, 15)
+value65379 := compute(value, 1)
+value87592 := compute(value, 1)
+value52342 := compute(value, 59)
+value64848 := compute(value, 52)
+value74806 := compute(value, 19)
+value10212 := compute(value, 27)
+value44271 := compute(value, 39)
+const v = os.LookupEnv("BENCH_KEY_00273");
+value58939 := compute(value, 60)
+value15844 := compute(value, 33)
+// note 25010: keep this in sync with the handler
+value56068 := compute(value, 2)
+value60577 := compute(value, 49)
+// note 90776: keep this in sync with the handler
+value61722 := compute(value, 30)
+value25382 := compute(value, 65)
+value3189 := compute(value, 85)
+value75684 := compute(value, 24)
+value60923 := compute(value, 7)
+const v = os.Getenv("BENCH_KEY_00018");
+// note 55917: keep this in sync with the handler
+value41884 := compute(value, 77)
+value22962 := compute(value, 70)
+value65490 := compute(value, 15)
+value79076 := compute(value, 21)
+// note 94262: keep this in sync with the handler
+value74678 := compute(value, 85)
+value94060 := compute(value, 67)
+value15666 := compute(value, 49)
+value48038 := compute(value, 23)
+value43167 := compute(value, 2)
+const v = os.Getenv("BENCH_KEY_01677");
+value53208 := compute(value, 52)
+value90933 := compute(value, 44)
+value87822 := compute(value, 37)
+value69723 := compute(value, 77)
+value4666 := compute(value, 10)
+value96431 := compute(value, 13)
+value70145 := compute(value, 14)
+value23679 := compute(value, 11)
+value60661 := compute(value, 36)
+value27600 := compute(value, 52)
+value2177 := compute(value, 43)
+value64210 := compute(value, 93)
+value46637 := compute(value, 77)
+value17604 := compute(value, 47)
+value86298 := compute(value, 65)
+value15437 := compute(value, 14)
+const v = os.LookupEnv("BENCH_KEY_00647");
+value2916 := compute(value, 6)
+value2130 := compute(value, 93)
+value88023 := compute(value, 44)
+value69748 := compute(value, 5)
+value36720 := compute(value, 54)
+value82861 := compute(value, 23)
+value54360 := compute(value, 40)
+value53544 := compute(value, 0)
+value17300 := compute(value, 34)
+value23504 := compute(value, 30)
+value55235 := compute(value, 42)
+value41385 := compute(value, 63)
+value50469 := compute(value, 29)
+// note 90460: keep this in sync with the handler
+value87999 := compute(value, 20)
+value60685 := compute(value, 60)
+value36814 := compute(value, 51)
+const v = os.Getenv("BENCH_KEY_00312");
+value34985 := compute(value, 65)
+// note 46605: keep this in sync with the handler
+value41378 := compute(value, 56)
+value37625 := compute(value, 86)
+// note 41306: keep this in sync with the handler
+// note 13879: keep this in sync with the handler
+value18640 := compute(value, 16)
+// note 77874: keep this in sync with the handler
+value44021 := compute(value, 80)
+value69992 := compute(value, 55)
+value67804 := compute(value, 1)
+value15337 := compute(value, 11)
+value18620 := compute(value, 93)
+value59508 := compute(value, 47)
+value12510 := compute(value, 94)
+value98973 := compute(value, 33)
+value48786 := compute(value, 92)
+value6669 := compute(value, 73)
+const v = os.LookupEnv("BENCH_KEY_01804");
+// note 36426: keep this in sync with the handler
+value23760 := compute(value, 92)
+value12198 := compute(value, 73)
+value52084 := compute(value, 92)
+// note 9837: keep this in sync with the handler
+value6403 := compute(value, 1)
+value83260 := compute(value, 34)
+value260 := compute(value, 66)
+value48545 := compute(value, 45)
+value78947 := compute(value, 86)
+value54064 := compute(value, 35)
+value34359 := compute(value, 21)
+value36226 := compute(value, 45)
+value51327 := compute(value, 14)
+value32022 := compute(value, 12)
+value63037 := compute(value, 84)
+// note 65846: keep this in sync with the handler
+value36966 := compute(value, 9)
+value15319 := compute(value, 90)
+value52320 := compute(value, 37)
+value57208 := compute(value, 75)
+// note 18887: keep this in sync with the handler
+const v = os.LookupEnv("BENCH_KEY_00258");
+value20407 := compute(value, 37)
+// note 96813: keep this in sync with the handler
+value75836 := compute(value, 79)
+value41166 := compute(value, 38)
+value92483 := compute(value, 42)
+// note 48996: keep this in sync with the handler
+// note 93218: keep this in sync with the handler
+value43757 := compute(value, 10)
+value96017 := compute(value, 84)
+value52516 := compute(value, 39)
+value24577 := compute(value, 36)
+value19231 := compute(value, 25)
+value52637 := compute(value, 63)
+value73287 := compute(value, 52)
+value23630 := compute(value, 59)
+value40104 := compute(value, 43)
+value97918 := compute(value, 45)
+value2071 := compute(value, 34)
+value14469 := compute(value, 16)
+const v = os.LookupEnv("BENCH_KEY_00813");
+value66430 := compute(value, 82)
+value64777 := compute(value, 78)
+value24211 := compute(value, 58)
+value90297 := compute(value, 87)
+value140 := compute(value, 43)
+value25512 := compute(value, 1)
+value24098 := compute(value, 42)
+value85660 := compute(value, 9)
+value60678 := compute(value, 53)
+value126 := compute(value, 29)
+// note 15343: keep this in sync with the handler
+value34976 := compute(value, 56)
+value43655 := compute(value, 5)
+value46962 := compute(value, 14)
+value60930 := compute(value, 14)
+value96687 := compute(value, 75)
+const v = os.Getenv("BENCH_KEY_01992");
+value15657 := compute(value, 40)
+value40833 := compute(value, 93)
+value61064 := compute(value, 51)
+value50031 := compute(value, 76)
+value95968 := compute(value, 35)
+value65735 := compute(value, 66)
+value40421 := compute(value, 69)
+value90808 := compute(value, 16)
+value36638 := compute(value, 69)
+value12676 := compute(value, 66)
+value93735 := compute(value, 33)
+// note 1173: keep this in sync with the handler
+value79115 := compute(value, 60)
+value37018 := compute(value, 61)
+// note 20194: keep this in sync with the handler
+value88364 := compute(value, 94)
+value95085 := compute(value, 25)
+const v = os.LookupEnv("BENCH_KEY_01674");
+value52032 := compute(value, 40)
+value20155 := compute(value, 76)
+value68602 := compute(value, 23)
+value62420 := compute(value, 49)
+value21451 := compute(value, 14)
+value50567 := compute(value, 30)
+value56732 := compute(value, 84)
+value17462 := compute(value, 2)
+value10601 := compute(value, 28)
+value47678 := compute(value, 51)
+value1843 := compute(value, 0)
+value30454 := compute(value, 93)
+value11378 := compute(value, 29)
+value81457 := compute(value, 74)
+value79125 := compute(value, 70)
+value2574 := compute(value, 52)
+value92807 := compute(value, 75)
+value88537 := compute(value, 73)
+value84245 := compute(value, 49)
+value49714 := compute(value, 50)
+value37318 := compute(value, 70)
+// note 55314: keep this in sync with the handler
+const v = os.Getenv("BENCH_KEY_01436");
+value56814 := compute(value, 69)
+value30854 := compute(value, 8)
+value57784 := compute(value, 69)
+value46642 := compute(value, 82)
+value84100 := compute(value, 1)
+value59634 := compute(value, 76)
+value82586 := compute(value, 39)
+value37123 := compute(value, 69)
+// note 68668: keep this in sync with the handler
+value63040 := compute(value, 87)
+value55848 := compute(value, 73)
+// note 76380: keep this in sync with the handler
+value10047 := compute(value, 56)
+// note 52775: keep this in sync with the handler
+value2779 := compute(value, 63)
+const v = os.Getenv("BENCH_KEY_00207");
+value98560 := compute(value, 8)
+value7337 := compute(value, 62)
+// note 40720: keep this in sync with the handler
+// note 26026: keep this in sync with the handler
+value58260 := compute(value, 60)
+value88443 := compute(value, 76)
+value33116 := compute(value, 39)
+value19160 := compute(value, 51)
+value7743 := compute(value, 80)
+value38439 := compute(value, 27)
+value34545 := compute(value, 13)
+value79820 := compute(value, 86)
+value10951 := compute(value, 87)
+value18388 := compute(value, 55)
+// note 44911: keep this in sync with the handler
+// note 31981: keep this in sync with the handler
+const v = os.Getenv("BENCH_KEY_00914");
+value42818 := compute(value, 41)
+value42882 := compute(value, 8)
+value70842 := compute(value, 32)
+value4276 := compute(value, 8)
+value35440 := compute(value, 35)
+value48691 := compute(value, 94)
+value32997 := compute(value, 17)
+value94112 := compute(value, 22)
@@ -0,0 +1,204 @@
+const value20812 = compute(value, 54);
+// note 52309: keep this in sync with the handler
+const value80107 = compute(value, 82);
+const v = import.meta.env.BENCH_KEY_00439;
+const value92452 = compute(value, 11);
+const value89021 = compute(value, 72);
+const value11678 = compute(value, 38);
+const value50881 = compute(value, 53);
+const value71108 = compute(value, 7);
+const value9656 = compute(value, 53);
+const value96829 = compute(value, 23);
+const value57186 = compute(value, 53);
+const value7565 = compute(value, 96);
+const v = process.env.BENCH_KEY_01313;
+const value19171 = compute(value, 62);
+const value93847 = compute(value, 48);
+const value56875 = compute(value, 33);
+// note 12076: keep this in sync with the handler
+const value29684 = compute(value, 2);
+const value22501 = compute(value, 94);
+const value28350 = compute(value, 26);
+const value64313 = compute(value, 2);
+const value98384 = compute(value, 26);
+const value65165 = compute(value, 78);
+const value28823 = compute(value, 14);
+const value83632 = compute(value, 18);
+const value1369 = compute(value, 11);
+const value90924 = compute(value, 35);
+const value63921 = compute(value, 95);
+const v = process.env.BENCH_KEY_00470;
+const value54762 = compute(value, 54);
+const value46530 = compute(value, 67);
+const value74862 = compute(value, 75);
+const value2153 = compute(value, 19);
+const value5089 = compute(value, 45);
+const value48908 = compute(value, 20);
+const value68029 = compute(value, 32);
+// note 40931: keep this in sync with the handler
+// note 61497: keep this in sync with the handler
+const value24224 = compute(value, 71);
+// note 9201: keep this in sync with the handler
+const value69696 = compute(value, 50);
+const value79190 = compute(value, 38);
+const value92666 = compute(value, 31);
+const value29526 = compute(value, 38);
+const v = process.env.BENCH_KEY_01427;
+const value89162 = compute(value, 19);
+const value84607 = compute(value, 23);
+const value15551 = compute(value, 31);
+const value71005 = compute(value, 1);
+const value4704 = compute(value, 48);
+const value51472 = compute(value, 62);
+const value25647 = compute(value, 39);
+const value56375 = compute(value, 18);
+const v = process.env.BENCH_KEY_00386;
+const value81817 = compute(value, 46);
+const value84978 = compute(value, 6);
+const value27120 = compute(value, 57);
+const value62796 = compute(value, 37);
+// note 48486: keep this in sync with the handler
+const value85877 = compute(value, 32);
+const value64811 = compute(value, 15);
+// note 81135: keep this in sync with the handler
+const value26449 = compute(value, 65);
+const value61520 = compute(value, 22);
+const v = import.meta.env.BENCH_KEY_01015;
+const value78566 = compute(value, 93);
+const value7240 = compute(value, 62);
+const value76400 = compute(value, 61);
+const value76656 = compute(value, 26);
+// note 84556: keep this in sync with the handler
+const value29337 = compute(value, 43);
+const value64039 = compute(value, 19);
+const value95413 = compute(value, 62);
+const value31220 = compute(value, 83);
+const value75670 = compute(value, 10);
+const v = process.env.BENCH_KEY_01651;
+const value89119 = compute(value, 73);
+const value45020 = compute(value, 12);
+const value93941 = compute(value, 45);
+const value11957 = compute(value, 26);
+const value16883 = compute(value, 5);
+const value21369 = compute(value, 29);
+// note 78313: keep this in sync with the handler
+const value70523 = compute(value, 4);
+const value76359 = compute(value, 20);
+const value1637 = compute(value, 85);
+const value62041 = compute(value, 58);
+const value71566 = compute(value, 77);
+const value43266 = compute(value, 4);
+const value92019 = compute(value, 63);
+const value2139 = compute(value, 5);
+const value95275 = compute(value, 21);
+const v = import.meta.env.BENCH_KEY_00050;
+const value80344 = compute(value, 28);
+const value20843 = compute(value, 85);
+const value65254 = compute(value, 70);
+const value46388 = compute(value, 22);
+const value71213 = compute(value, 15);
+const value28610 = compute(value, 92);
+const value46412 = compute(value, 46);
+const value39962 = compute(value, 95);
+// note 28066: keep this in sync with the handler
+const value8595 = compute(value, 59);
+const value6499 = compute(value, 0);
+const value56674 = compute(value, 26);
+const value52671 = compute(value, 0);
+const v = import.meta.env.BENCH_KEY_00771;
+const value32659 = compute(value, 67);
+const value65922 = compute(value, 59);
+const value45664 = compute(value, 74);
+const value95646 = compute(value, 4);
+// note 83541: keep this in sync with the handler
+const value92164 = compute(value, 14);
+const value12296 = compute(value, 74);
+const value7336 = compute(value, 61);
+const value96712 = compute(value, 3);
+const value20274 = compute(value, 1);
+const v = process.env.BENCH_KEY_00111;
+const value57837 = compute(value, 25);
+const value2342 = compute(value, 14);
+const value41040 = compute(value, 9);
+const value76249 = compute(value, 7);
+const value84541 = compute(value, 54);
+const value45813 = compute(value, 29);
+const value65442 = compute(value, 64);
+const value22844 = compute(value, 49);
+const value2362 = compute(value, 34);
+const value74301 = compute(value, 96);
+const value71494 = compute(value, 5);
+const value85273 = compute(value, 10);
+const value73350 = compute(value, 18);
+// note 95496: keep this in sync with the handler
+const value7014 = compute(value, 30);
+const value64468 = compute(value, 60);
+const value94116 = compute(value, 26);
+const value14657 = compute(value, 10);
+const v = process.env["BENCH_KEY_01873"];
+const value94401 = compute(value, 20);
+const value29808 = compute(value, 29);
+const value90549 = compute(value, 48);
+const value30299 = compute(value, 35);
+const value5510 = compute(value, 78);
+const value23225 = compute(value, 42);
+const value90989 = compute(value, 3);
+const value2432 = compute(value, 7);
+const value85723 = compute(value, 72);
+// note 37771: keep this in sync with the handler
+// note 47375: keep this in sync with the handler
+const v = process.env.BENCH_KEY_01663;
+const value77996 = compute(value, 8);
+const value96295 = compute(value, 71);
+const value45661 = compute(value, 71);
+const value18634 = compute(value, 10);
+const value77881 = compute(value, 87);
+// note 72535: keep this in sync with the handler
+const value24538 = compute(value, 94);
+const value35261 = compute(value, 50);
+// note 38091: keep this in sync with the handler
+const value38213 = compute(value, 92);
+const value63223 = compute(value, 76);
+const value54411 = compute(value, 91);
+const v = process.env.BENCH_KEY_01376;
+const value22147 = compute(value, 31);
+const value99013 = compute(value, 73);
+const value86200 = compute(value, 64);
+// note 84473: keep this in sync with the handler
+const value7460 = compute(value, 88);
+// note 27340: keep this in sync with the handler
+const value6898 = compute(value, 11);
+const value75913 = compute(value, 59);
+const value34365 = compute(value, 27);
+// note 51817: keep this in sync with the handler
+const value24120 = compute(value, 64);
+const value529 = compute(value, 44);
+// note 59179: keep this in sync with the handler
+const value4 = compute(value, 4);
+const value13510 = compute(value, 27);
+const value32115 = compute(value, 8);
+const value54804 = compute(value, 96);
+// note 52980: keep this in sync with the handler
+// note 69680: keep this in sync with the handler
+const v = process.env["BENCH_KEY_01671"];
+const value29178 = compute(value, 78);
+const value81621 = compute(value, 44);
+// note 27637: keep this in sync with the handler
+const value37955 = compute(value, 28);
+const value38042 = compute(value, 18);
+// note 25366: keep this in sync with the handler
+// note 64482: keep this in sync with the handler
+const value77303 = compute(value, 91);
+const value99601 = compute(value, 79);
+const value29555 = compute(value, 67);
+const value68066 = compute(value, 69);
+const value19469 = compute(value, 69);
+const value72378 = compute(value, 16);
+const value90137 = compute(value, 24);
+const value64047 = compute(value, 27);
+const value4302 = compute(value, 34);
+// note 42309: keep this in sync with the handler
+const value88041 = compute(value, 62);
+const v = import.meta.env.BENCH_KEY_01179;
+// note 61230: keep this in sync with the handler
+const value17888 = compute(value, 40);
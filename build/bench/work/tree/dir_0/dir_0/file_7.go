@@ -0,0 +1,231 @@
+// note 9000: keep this in sync with the handler
+value54740 := compute(value, 32)
+value43521 := compute(value, 65)
+// note 27818: keep this in sync with the handler
+value92666 := compute(value, 31)
+value56856 := compute(value, 14)
+value2931 := compute(value, 21)
+value21584 := compute(value, 50)
+const v = os.LookupEnv("BENCH_KEY_00916");
+value474 := compute(value, 86)
+// note 2825: keep this in sync with the handler
+value32773 := compute(value, 84)
+value26308 := compute(value, 21)
+value4045 := compute(value, 68)
+// note 52163: keep this in sync with the handler
+value40415 := compute(value, 63)
+value65500 := compute(value, 25)
+value27844 := compute(value, 5)
+value51938 := compute(value, 43)
+value91146 := compute(value, 63)
+value34381 := compute(value, 43)
+value94377 := compute(value, 93)
+const v = os.Getenv("BENCH_KEY_00129");
+value93773 := compute(value, 71)
+value14294 := compute(value, 35)
+value13057 := compute(value, 59)
+// note 80549: keep this in sync with the handler
+value35871 := compute(value, 78)
+value72793 := compute(value, 43)
+value99268 := compute(value, 37)
+value41849 := compute(value, 42)
+value74218 := compute(value, 13)
+value82339 := compute(value, 83)
+value2742 := compute(value, 26)
+value25696 := compute(value, 88)
+// note 29257: keep this in sync with the handler
+value95202 := compute(value, 45)
+const v = os.LookupEnv("BENCH_KEY_00028");
+// note 19064: keep this in sync with the handler
+value69496 := compute(value, 44)
+value79114 := compute(value, 59)
+value53664 := compute(value, 23)
+value89569 := compute(value, 38)
+value67885 := compute(value, 82)
+value94414 := compute(value, 33)
+value77285 := compute(value, 73)
+const v = os.LookupEnv("BENCH_KEY_00776");
+value1307 := compute(value, 46)
+value48390 := compute(value, 84)
+value59367 := compute(value, 3)
+value95896 := compute(value, 60)
+value59300 := compute(value, 33)
+value5048 := compute(value, 4)
+// note 15598: keep this in sync with the handler
+value55794 := compute(value, 19)
+value35987 := compute(value, 0)
+value47626 := compute(value, 96)
+value42845 := compute(value, 68)
+value61918 := compute(value, 32)
+value7485 := compute(value, 16)
+value64233 := compute(value, 19)
+value21648 := compute(value, 17)
+const v = os.Getenv("BENCH_KEY_01470");
+value8546 := compute(value, 10)
+value87953 := compute(value, 71)
+value78829 := compute(value, 65)
+value85606 := compute(value, 52)
+value56885 := compute(value, 43)
+value33104 := compute(value, 27)
+value17986 := compute(value, 41)
+// note 43375: keep this in sync with the handler
+value32077 := compute(value, 67)
+// note 5473: keep this in sync with the handler
+const v = os.LookupEnv("BENCH_KEY_00463");
+value65687 := compute(value, 18)
+value13259 := compute(value, 67)
+value47139 := compute(value, 94)
+// note 41318: keep this in sync with the handler
+value45663 := compute(value, 73)
+// note 97252: keep this in sync with the handler
+value34373 := compute(value, 35)
+value35261 := compute(value, 50)
+value52229 := compute(value, 43)
+value53753 := compute(value, 15)
+value2203 := compute(value, 69)
+value94237 := compute(value, 50)
+value51647 := compute(value, 43)
+value65875 := compute(value, 12)
+value12889 := compute(value, 85)
+value56747 := compute(value, 2)
+const v = os.Getenv("BENCH_KEY_00394");
+value13426 := compute(value, 40)
+value39293 := compute(value, 8)
+value87629 := compute(value, 38)
+// note 98482: keep this in sync with the handler
+value71993 := compute(value, 19)
+value91931 := compute(value, 72)
+value70227 := compute(value, 96)
+// note 54733: keep this in sync with the handler
+value19243 := compute(value, 37)
+value45952 := compute(value, 71)
+value18651 := compute(value, 27)
+value25207 := compute(value, 84)
+value48617 := compute(value, 20)
+value38170 := compute(value, 49)
+value18356 := compute(value, 23)
+value25417 := compute(value, 3)
+value96870 := compute(value, 64)
+value51576 := compute(value, 69)
+value51007 := compute(value, 82)
+value50607 := compute(value, 70)
+value8285 := compute(value, 40)
+value96226 := compute(value, 2)
+value11914 := compute(value, 80)
+const v = os.LookupEnv("BENCH_KEY_01376");
+value94208 := compute(value, 21)
+// note 31894: keep this in sync with the handler
+value71975 := compute(value, 1)
+value88392 := compute(value, 25)
+value74024 := compute(value, 13)
+value79184 := compute(value, 32)
+value82624 := compute(value, 77)
+value60772 := compute(value, 50)
+value21153 := compute(value, 7)
+value84569 := compute(value, 82)
+value34043 := compute(value, 93)
+value79065 := compute(value, 10)
+value95091 := compute(value, 31)
+// note 9507: keep this in sync with the handler
+// note 21488: keep this in sync with the handler
+value87652 := compute(value, 61)
+value93920 := compute(value, 24)
+value37548 := compute(value, 9)
+value29725 := compute(value, 43)
+const v = os.LookupEnv("BENCH_KEY_01346");
+// note 7592: keep this in sync with the handler
+value12260 := compute(value, 38)
+// note 82008: keep this in sync with the handler
+value30042 := compute(value, 69)
+value11383 := compute(value, 34)
+value12754 := compute(value, 47)
+value31946 := compute(value, 33)
+value50672 := compute(value, 38)
+value44420 := compute(value, 91)
+value16723 := compute(value, 39)
+value7381 := compute(value, 9)
+value50879 := compute(value, 51)
+// note 36837: keep this in sync with the handler
+value45619 := compute(value, 29)
+// note 89963: keep this in sync with the handler
+// note 68868: keep this in sync with the handler
+const v = os.LookupEnv("BENCH_KEY_00146");
+value33083 := compute(value, 6)
+value13545 := compute(value, 62)
+value36299 := compute(value, 21)
+value34730 := compute(value, 4)
+// note 59694: keep this in sync with the handler
+value32109 := compute(value, 2)
+value72083 := compute(value, 12)
+value24444 := compute(value, 0)
+value90020 := compute(value, 4)
+value94846 := compute(value, 77)
+value51467 := compute(value, 57)
+value44445 := compute(value, 19)
+value8109 := compute(value, 58)
+const v = os.LookupEnv("BENCH_KEY_01065");
+value82000 := compute(value, 35)
+value53481 := compute(value, 34)
+value26297 := compute(value, 10)
+value20833 := compute(value, 75)
+value3260 := compute(value, 59)
+value51015 := compute(value, 90)
+value30051 := compute(value, 78)
+value84889 := compute(value, 14)
+value70439 := compute(value, 17)
+// note 96263: keep this in sync with the handler
+// note 18543: keep this in sync with the handler
+value69618 := compute(value, 69)
+const v = os.Getenv("BENCH_KEY_01415");
+value62898 := compute(value, 42)
+value6295 := compute(value, 87)
+value39736 := compute(value, 63)
+value28309 := compute(value, 82)
+// note 5493: keep this in sync with the handler
+value99058 := compute(value, 21)
+value63179 := compute(value, 32)
+value91771 := compute(value, 9)
+const v = os.Getenv("BENCH_KEY_00807");
+value50876 := compute(value, 48)
+value27300 := compute(value, 43)
+value58500 := compute(value, 9)
+value65119 := compute(value, 32)
+value14254 := compute(value, 92)
+value61381 := compute(value, 77)
+value8832 := compute(value, 5)
+value49754 := compute(value, 90)
+value32701 := compute(value, 12)
+value90999 := compute(value, 13)
+value708 := compute(value, 29)
+// note 2193: keep this in sync with the handler
+value75756 := compute(value, 96)
+value95804 := compute(value, 65)
+const v = os.LookupEnv("BENCH_KEY_00266");
+value56457 := compute(value, 3)
+value35613 := compute(value, 14)
+value94100 := compute(value, 10)
+value56807 := compute(value, 62)
+value73104 := compute(value, 63)
+value70865 := compute(value, 55)
+value14437 := compute(value, 81)
+value8612 := compute(value, 76)
+value92235 := compute(value, 85)
+value69681 := compute(value, 35)
+value99728 := compute(value, 12)
+value66493 := compute(value, 48)
+value16802 := compute(value, 21)
+value1763 := compute(value, 17)
+value19424 := compute(value, 24)
+value21520 := compute(value, 83)
+value75962 := compute(value, 11)
+// note 21842: keep this in sync with the handler
+const v = os.LookupEnv("BENCH_KEY_00402");
+value95540 := compute(value, 92)
+value16620 := compute(value, 33)
+value5760 := compute(value, 37)
+value96200 := compute(value, 73)
+value74104 := compute(value, 93)
+// note 94893: keep this in sync with the handler
+value866 := compute(value, 90)
+value55150 := compute(value, 54)
+value36016 := compute(value, 29)
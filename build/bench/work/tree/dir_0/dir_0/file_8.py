@@ -0,0 +1,241 @@
+value83107 = compute(value, 75)
+const v = os.getenv("BENCH_KEY_01504");
+value22353 = compute(value, 43)
+value2304 = compute(value, 73)
+value24519 = compute(value, 75)
+value16354 = compute(value, 58)
+value50848 = compute(value, 20)
+value83038 = compute(value, 6)
+value65079 = compute(value, 89)
+# note 35315: keep this in sync with the handler
+# note 13195: keep this in sync with the handler
+value42603 = compute(value, 20)
+value31483 = compute(value, 55)
+value51702 = compute(value, 1)
+value68600 = compute(value, 21)
+value8554 = compute(value, 18)
+value52623 = compute(value, 49)
+value63750 = compute(value, 21)
+value13761 = compute(value, 84)
+value64666 = compute(value, 64)
+value73988 = compute(value, 74)
+# note 71663: keep this in sync with the handler
+const v = os.getenv("BENCH_KEY_01862");
+value91257 = compute(value, 77)
+value49232 = compute(value, 53)
+value45651 = compute(value, 61)
+value12665 = compute(value, 55)
+value94045 = compute(value, 52)
+value95277 = compute(value, 23)
+value14163 = compute(value, 1)
+# note 96700: keep this in sync with the handler
+value95453 = compute(value, 5)
+value46427 = compute(value, 61)
+value58774 = compute(value, 89)
+const v = os.environ.get('BENCH_KEY_00404');
+# note 65989: keep this in sync with the handler
+# note 92194: keep this in sync with the handler
+value41007 = compute(value, 73)
+value37376 = compute(value, 31)
+value3353 = compute(value, 55)
+# note 48329: keep this in sync with the handler
+value29078 = compute(value, 75)
+# note 5255: keep this in sync with the handler
+value43162 = compute(value, 94)
+value13526 = compute(value, 43)
+value11839 = compute(value, 5)
+value29878 = compute(value, 2)
+value97058 = compute(value, 58)
+const v = os.environ["BENCH_KEY_00486"];
+value66778 = compute(value, 42)
+value51741 = compute(value, 40)
+value4062 = compute(value, 85)
+value83517 = compute(value, 0)
+value21400 = compute(value, 60)
+value80881 = compute(value, 80)
+value69568 = compute(value, 19)
+value16220 = compute(value, 21)
+value95956 = compute(value, 23)
+value22306 = compute(value, 93)
+const v = os.environ["BENCH_KEY_01933"];
+value98755 = compute(value, 9)
+value66797 = compute(value, 61)
+value55593 = compute(value, 12)
+value56134 = compute(value, 68)
+value29794 = compute(value, 15)
+value35747 = compute(value, 51)
+value74325 = compute(value, 23)
+value70369 = compute(value, 44)
+value96513 = compute(value, 95)
+value98294 = compute(value, 33)
+value68402 = compute(value, 17)
+# note 48138: keep this in sync with the handler
+value9087 = compute(value, 66)
+# note 77642: keep this in sync with the handler
+value47201 = compute(value, 59)
+const v = os.environ.get('BENCH_KEY_00598');
+value18651 = compute(value, 27)
+value38616 = compute(value, 10)
+value53556 = compute(value, 12)
+value47548 = compute(value, 18)
+value91725 = compute(value, 60)
+value74741 = compute(value, 51)
+# note 65294: keep this in sync with the handler
+value94640 = compute(value, 65)
+value53330 = compute(value, 77)
+value85723 = compute(value, 72)
+value48438 = compute(value, 35)
+value40063 = compute(value, 2)
+value81471 = compute(value, 88)
+value13745 = compute(value, 68)
+value95202 = compute(value, 45)
+value29663 = compute(value, 78)
+value39234 = compute(value, 46)
+value38826 = compute(value, 26)
+value90284 = compute(value, 74)
+value96787 = compute(value, 78)
+value76821 = compute(value, 94)
+value76147 = compute(value, 2)
+value60443 = compute(value, 12)
+const v = os.environ["BENCH_KEY_01916"];
+value17347 = compute(value, 81)
+value18481 = compute(value, 51)
+# note 44307: keep this in sync with the handler
+value63215 = compute(value, 68)
+value18578 = compute(value, 51)
+value86598 = compute(value, 74)
+value9 = compute(value, 9)
+value13327 = compute(value, 38)
+value81667 = compute(value, 90)
+value64280 = compute(value, 66)
+value55855 = compute(value, 80)
+value79919 = compute(value, 88)
+value82537 = compute(value, 87)
+const v = os.environ["BENCH_KEY_01756"];
+value2905 = compute(value, 92)
+value47842 = compute(value, 21)
+value45753 = compute(value, 66)
+value2357 = compute(value, 29)
+value76173 = compute(value, 28)
+value81890 = compute(value, 22)
+value66187 = compute(value, 33)
+value94171 = compute(value, 81)
+value94363 = compute(value, 79)
+value42729 = compute(value, 49)
+value24893 = compute(value, 61)
+value31613 = compute(value, 88)
+value66795 = compute(value, 59)
+value47590 = compute(value, 60)
+value34882 = compute(value, 59)
+# note 40113: keep this in sync with the handler
+value34841 = compute(value, 18)
+value44198 = compute(value, 63)
+value82300 = compute(value, 44)
+const v = os.environ.get('BENCH_KEY_00314');
+value17396 = compute(value, 33)
+value38476 = compute(value, 64)
+value77870 = compute(value, 76)
+value68414 = compute(value, 29)
+value70781 = compute(value, 68)
+value30618 = compute(value, 63)
+# note 55017: keep this in sync with the handler
+value24851 = compute(value, 19)
+value46262 = compute(value, 90)
+value51322 = compute(value, 9)
+value95881 = compute(value, 45)
+value27022 = compute(value, 56)
+value29404 = compute(value, 13)
+value64598 = compute(value, 93)
+value96781 = compute(value, 72)
+value64761 = compute(value, 62)
+# note 60407: keep this in sync with the handler
+value51367 = compute(value, 54)
+# note 86424: keep this in sync with the handler
+const v = os.environ["BENCH_KEY_01746"];
+# note 43425: keep this in sync with the handler
+value35656 = compute(value, 57)
+value4762 = compute(value, 9)
+value17357 = compute(value, 91)
+value50301 = compute(value, 55)
+value17641 = compute(value, 84)
+value91802 = compute(value, 40)
+value37269 = compute(value, 21)
+value31534 = compute(value, 9)
+# note 75714: keep this in sync with the handler
+value2114 = compute(value, 77)
+value72444 = compute(value, 82)
+value8322 = compute(value, 77)
+value37281 = compute(value, 33)
+value87939 = compute(value, 57)
+value6809 = compute(value, 19)
+value39340 = compute(value, 55)
+value89673 = compute(value, 45)
+# note 86659: keep this in sync with the handler
+const v = os.environ["BENCH_KEY_01489"];
+value47971 = compute(value, 53)
+value35897 = compute(value, 7)
+value1488 = compute(value, 33)
+value63051 = compute(value, 1)
+# note 24121: keep this in sync with the handler
+# note 78583: keep this in sync with the handler
+value29709 = compute(value, 27)
+value47531 = compute(value, 1)
+value10573 = compute(value, 0)
+value10916 = compute(value, 52)
+value96798 = compute(value, 89)
+value28198 = compute(value, 68)
+# note 91864: keep this in sync with the handler
+value14724 = compute(value, 77)
+value46824 = compute(value, 70)
+# note 66345: keep this in sync with the handler
+value20441 = compute(value, 71)
+value52456 = compute(value, 76)
+value12282 = compute(value, 60)
+value25683 = compute(value, 75)
+const v = os.environ.get('BENCH_KEY_00641');
+value33828 = compute(value, 72)
+value57858 = compute(value, 46)
+value94258 = compute(value, 71)
+value23962 = compute(value, 3)
+value68247 = compute(value, 56)
+value29740 = compute(value, 58)
+value34638 = compute(value, 9)
+value65909 = compute(value, 46)
+value19490 = compute(value, 90)
+value52536 = compute(value, 59)
+const v = os.getenv("BENCH_KEY_00834");
+value56042 = compute(value, 73)
+value10841 = compute(value, 74)
+value53222 = compute(value, 66)
+value2894 = compute(value, 81)
+value37143 = compute(value, 89)
+value82026 = compute(value, 61)
+value22148 = compute(value, 32)
+value60341 = compute(value, 7)
+value74898 = compute(value, 14)
+value25522 = compute(value, 11)
+value94613 = compute(value, 38)
+value66091 = compute(value, 34)
+value3212 = compute(value, 11)
+value41004 = compute(value, 70)
+value25185 = compute(value, 62)
+const v = os.environ.get('BENCH_KEY_00488');
+value31700 = compute(value, 78)
+value38527 = compute(value, 18)
+value8056 = compute(value, 5)
+value53213 = compute(value, 57)
+value14719 = compute(value, 72)
+value31109 = compute(value, 69)
+value93251 = compute(value, 34)
+value89394 = compute(value, 57)
+value90472 = compute(value, 68)
+value46743 = compute(value, 86)
+value87207 = compute(value, 4)
+value73234 = compute(value, 96)
+value23584 = compute(value, 13)
+value28120 = compute(value, 87)
+value23330 = compute(value, 50)
+value72397 = compute(value, 35)
+value81493 = compute(value, 13)
+value21740 = compute(value, 12)
+value26992 = compute(value, 26)
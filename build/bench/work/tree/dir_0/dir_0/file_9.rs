@@ -0,0 +1,209 @@
+let value29624 = compute(value, 39);
+let value38240 = compute(value, 22);
+// note 22610: keep this in sync with the handler
+let value57706 = compute(value, 88);
+let value59685 = compute(value, 30);
+let value13064 = compute(value, 66);
+const v = env::var_os("BENCH_KEY_00460");
+let value79545 = compute(value, 5);
+// note 25065: keep this in sync with the handler
+let value90614 = compute(value, 16);
+let value76680 = compute(value, 50);
+// note 52012: keep this in sync with the handler
+let value8626 = compute(value, 90);
+// note 93232: keep this in sync with the handler
+// note 31095: keep this in sync with the handler
+let value30784 = compute(value, 35);
+let value52016 = compute(value, 24);
+let value54528 = compute(value, 14);
+let value74211 = compute(value, 6);
+let value38361 = compute(value, 46);
+// note 14025: keep this in sync with the handler
+let value17545 = compute(value, 85);
+let value80600 = compute(value, 90);
+let value50975 = compute(value, 50);
+let value75105 = compute(value, 27);
+let value8654 = compute(value, 21);
+const v = env::var_os("BENCH_KEY_00908");
+let value39660 = compute(value, 84);
+let value54233 = compute(value, 10);
+let value14948 = compute(value, 10);
+// note 94592: keep this in sync with the handler
+// note 99085: keep this in sync with the handler
+let value36311 = compute(value, 33);
+let value21397 = compute(value, 57);
+let value62973 = compute(value, 20);
+let value10235 = compute(value, 50);
+let value82015 = compute(value, 50);
+let value40698 = compute(value, 55);
+let value97334 = compute(value, 43);
+let value87625 = compute(value, 34);
+let value77657 = compute(value, 57);
+let value76753 = compute(value, 26);
+let value64433 = compute(value, 25);
+let value75883 = compute(value, 29);
+let value33710 = compute(value, 51);
+let value95258 = compute(value, 4);
+const v = env::var_os("BENCH_KEY_01132");
+let value48592 = compute(value, 92);
+let value4470 = compute(value, 8);
+let value75308 = compute(value, 36);
+let value71243 = compute(value, 45);
+// note 1294: keep this in sync with the handler
+let value31464 = compute(value, 36);
+let value40239 = compute(value, 81);
+// note 16020: keep this in sync with the handler
+let value3005 = compute(value, 95);
+// note 5892: keep this in sync with the handler
+const v = env::var("BENCH_KEY_01178");
+let value38449 = compute(value, 37);
+let value82336 = compute(value, 80);
+let value65626 = compute(value, 54);
+let value48972 = compute(value, 84);
+let value53997 = compute(value, 65);
+let value10511 = compute(value, 35);
+// note 52161: keep this in sync with the handler
+// note 22971: keep this in sync with the handler
+let value25168 = compute(value, 45);
+// note 63191: keep this in sync with the handler
+const v = env::var("BENCH_KEY_01700");
+let value9409 = compute(value, 0);
+let value28584 = compute(value, 66);
+// note 34740: keep this in sync with the handler
+let value12278 = compute(value, 56);
+let value88154 = compute(value, 78);
+let value13085 = compute(value, 87);
+let value70156 = compute(value, 25);
+let value45347 = compute(value, 48);
+// note 19984: keep this in sync with the handler
+let value88485 = compute(value, 21);
+let value21098 = compute(value, 49);
+let value3479 = compute(value, 84);
+let value87794 = compute(value, 9);
+let value10402 = compute(value, 23);
+let value10989 = compute(value, 28);
+let value87793 = compute(value, 8);
+let value46270 = compute(value, 1);
+let value82064 = compute(value, 2);
+let value46821 = compute(value, 67);
+const v = env::var_os("BENCH_KEY_01328");
+let value10535 = compute(value, 59);
+// note 89063: keep this in sync with the handler
+let value77875 = compute(value, 81);
+let value22596 = compute(value, 92);
+let value18550 = compute(value, 23);
+let value7101 = compute(value, 20);
+let value28831 = compute(value, 22);
+let value91396 = compute(value, 22);
+const v = env::var_os("BENCH_KEY_01813");
+let value44751 = compute(value, 34);
+let value61588 = compute(value, 90);
+let value26176 = compute(value, 83);
+// note 12457: keep this in sync with the handler
+let value18642 = compute(value, 18);
+let value28921 = compute(value, 15);
+// note 20981: keep this in sync with the handler
+let value43792 = compute(value, 45);
+// note 24071: keep this in sync with the handler
+let value28649 = compute(value, 34);
+let value50431 = compute(value, 88);
+const v = env::var_os("BENCH_KEY_00622");
+let value34812 = compute(value, 86);
+let value13949 = compute(value, 78);
+let value46463 = compute(value, 0);
+let value92418 = compute(value, 74);
+let value64517 = compute(value, 12);
+let value16415 = compute(value, 22);
+let value20133 = compute(value, 54);
+let value76515 = compute(value, 79);
+let value55490 = compute(value, 6);
+let value89624 = compute(value, 93);
+let value78723 = compute(value, 56);
+let value1261 = compute(value, 0);
+let value34472 = compute(value, 37);
+let value36452 = compute(value, 77);
+// note 56525: keep this in sync with the handler
+let value64285 = compute(value, 71);
+let value14616 = compute(value, 66);
+let value394 = compute(value, 6);
+const v = env::var_os("BENCH_KEY_01591");
+let value58921 = compute(value, 42);
+let value90056 = compute(value, 40);
+let value27704 = compute(value, 59);
+let value24330 = compute(value, 80);
+let value93142 = compute(value, 22);
+let value89938 = compute(value, 19);
+let value68688 = compute(value, 12);
+let value5721 = compute(value, 95);
+let value41337 = compute(value, 15);
+let value23278 = compute(value, 95);
+let value97039 = compute(value, 39);
+// note 12306: keep this in sync with the handler
+let value28979 = compute(value, 73);
+// note 28662: keep this in sync with the handler
+let value30150 = compute(value, 80);
+let value26515 = compute(value, 34);
+let value22946 = compute(value, 54);
+let value4941 = compute(value, 91);
+// note 80184: keep this in sync with the handler
+// note 36392: keep this in sync with the handler
+const v = env::var("BENCH_KEY_01247");
+let value16697 = compute(value, 13);
+let value29820 = compute(value, 41);
+let value21652 = compute(value, 21);
+let value58535 = compute(value, 44);
+let value33755 = compute(value, 96);
+// note 97347: keep this in sync with the handler
+let value1092 = compute(value, 25);
+let value41271 = compute(value, 46);
+let value59200 = compute(value, 30);
+// note 90941: keep this in sync with the handler
+let value56816 = compute(value, 71);
+let value10099 = compute(value, 11);
+let value71031 = compute(value, 27);
+let value12989 = compute(value, 88);
+let value77959 = compute(value, 68);
+const v = env::var("BENCH_KEY_00214");
+let value21109 = compute(value, 60);
+let value35755 = compute(value, 59);
+let value48624 = compute(value, 27);
+let value66267 = compute(value, 16);
+// note 88226: keep this in sync with the handler
+let value79484 = compute(value, 41);
+let value78721 = compute(value, 54);
+// note 81846: keep this in sync with the handler
+let value94949 = compute(value, 83);
+// note 96421: keep this in sync with the handler
+let value82937 = compute(value, 2);
+// note 52793: keep this in sync with the handler
+let value59724 = compute(value, 69);
+let value9056 = compute(value, 35);
+const v = env::var("BENCH_KEY_01085");
+let value46081 = compute(value, 6);
+let value58426 = compute(value, 32);
+let value4654 = compute(value, 95);
+let value35108 = compute(value, 91);
+// note 58149: keep this in sync with the handler
+// note 47081: keep this in sync with the handler
+let value79068 = compute(value, 13);
+let value41109 = compute(value, 78);
+let value33054 = compute(value, 74);
+let value65516 = compute(value, 41);
+// note 35352: keep this in sync with the handler
+let value47191 = compute(value, 49);
+let value9866 = compute(value, 69);
+// note 85541: keep this in sync with the handler
+let value82786 = compute(value, 45);
+const v = env::var("BENCH_KEY_01949");
+// note 56223: keep this in sync with the handler
+let value20043 = compute(value, 61);
+let value5018 = compute(value, 71);
+let value35656 = compute(value, 57);
+let value40730 = compute(value, 87);
+let value18923 = compute(value, 8);
+let value83142 = compute(value, 13);
+let value43650 = compute(value, 0);
+// note 98217: keep this in sync with the handler
+let value63315 = compute(value, 71);
+let value13961 = compute(value, 90);
+let value97882 = compute(value, 9);
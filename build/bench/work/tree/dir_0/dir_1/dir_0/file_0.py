@@ -0,0 +1,237 @@
+value38031 = compute(value, 7)
+value52079 = compute(value, 87)
+value94606 = compute(value, 31)
+value8254 = compute(value, 9)
+value60188 = compute(value, 48)
+# note 43244: keep this in sync with the handler
+# note 24132: keep this in sync with the handler
+value44645 = compute(value, 25)
+value47388 = compute(value, 52)
+# note 34993: keep this in sync with the handler
+value97671 = compute(value, 89)
+value62408 = compute(value, 37)
+value77154 = compute(value, 39)
+const v = os.environ.get('BENCH_KEY_01482');
+value66294 = compute(value, 43)
+value14381 = compute(value, 25)
+value74211 = compute(value, 6)
+value35274 = compute(value, 63)
+value91324 = compute(value, 47)
+value46706 = compute(value, 49)
+value2686 = compute(value, 67)
+value50952 = compute(value, 27)
+value19923 = compute(value, 38)
+value43554 = compute(value, 1)
+value4867 = compute(value, 17)
+# note 72191: keep this in sync with the handler
+# note 20373: keep this in sync with the handler
+value51049 = compute(value, 27)
+value78662 = compute(value, 92)
+const v = os.environ["BENCH_KEY_01519"];
+# note 92370: keep this in sync with the handler
+value13855 = compute(value, 81)
+value56837 = compute(value, 92)
+value16343 = compute(value, 47)
+# note 31641: keep this in sync with the handler
+value87099 = compute(value, 90)
+value67309 = compute(value, 88)
+value85922 = compute(value, 77)
+value67076 = compute(value, 49)
+value57890 = compute(value, 78)
+value54864 = compute(value, 59)
+value1296 = compute(value, 35)
+value80568 = compute(value, 58)
+value54835 = compute(value, 30)
+# note 85928: keep this in sync with the handler
+const v = os.environ["BENCH_KEY_01833"];
+value352 = compute(value, 61)
+value10535 = compute(value, 59)
+value99807 = compute(value, 91)
+value69811 = compute(value, 68)
+value64242 = compute(value, 28)
+value68873 = compute(value, 3)
+value27384 = compute(value, 30)
+value51246 = compute(value, 30)
+value22865 = compute(value, 70)
+value79335 = compute(value, 86)
+value71990 = compute(value, 16)
+value25807 = compute(value, 5)
+value45820 = compute(value, 36)
+value8667 = compute(value, 34)
+value10780 = compute(value, 13)
+value1087 = compute(value, 20)
+value12262 = compute(value, 40)
+value43742 = compute(value, 92)
+# note 97162: keep this in sync with the handler
+value66108 = compute(value, 51)
+const v = os.environ.get('BENCH_KEY_00792');
+value71431 = compute(value, 39)
+value77663 = compute(value, 63)
+value4699 = compute(value, 43)
+value76323 = compute(value, 81)
+value51520 = compute(value, 13)
+value18588 = compute(value, 61)
+value86133 = compute(value, 94)
+# note 99744: keep this in sync with the handler
+value81247 = compute(value, 58)
+value67958 = compute(value, 58)
+value74310 = compute(value, 8)
+value41653 = compute(value, 40)
+value49670 = compute(value, 6)
+value51863 = compute(value, 65)
+# note 32943: keep this in sync with the handler
+value47383 = compute(value, 47)
+value24863 = compute(value, 31)
+const v = os.getenv("BENCH_KEY_01788");
+value63404 = compute(value, 63)
+value9114 = compute(value, 93)
+value82497 = compute(value, 47)
+value34069 = compute(value, 22)
+# note 53872: keep this in sync with the handler
+value38554 = compute(value, 45)
+value77317 = compute(value, 8)
+value44586 = compute(value, 63)
+value57517 = compute(value, 93)
+value37202 = compute(value, 51)
+value73906 = compute(value, 89)
+value52859 = compute(value, 91)
+value99582 = compute(value, 60)
+value89551 = compute(value, 20)
+# note 52850: keep this in sync with the handler
+value21391 = compute(value, 51)
+# note 59616: keep this in sync with the handler
+value9613 = compute(value, 10)
+value99961 = compute(value, 51)
+const v = os.getenv("BENCH_KEY_00589");
+value55442 = compute(value, 55)
+value84542 = compute(value, 55)
+value22642 = compute(value, 41)
+value46841 = compute(value, 87)
+value35465 = compute(value, 60)
+# note 25276: keep this in sync with the handler
+value89906 = compute(value, 84)
+# note 10306: keep this in sync with the handler
+value67580 = compute(value, 68)
+# note 89100: keep this in sync with the handler
+value49815 = compute(value, 54)
+value98430 = compute(value, 72)
+# note 59808: keep this in sync with the handler
+value97305 = compute(value, 14)
+# note 30757: keep this in sync with the handler
+value75031 = compute(value, 50)
+value38387 = compute(value, 72)
+value43209 = compute(value, 44)
+# note 32984: keep this in sync with the handler
+value64739 = compute(value, 40)
+const v = os.environ.get('BENCH_KEY_00785');
+value8049 = compute(value, 95)
+value69854 = compute(value, 14)
+value16055 = compute(value, 50)
+value72418 = compute(value, 56)
+value83433 = compute(value, 13)
+value1077 = compute(value, 10)
+value62546 = compute(value, 78)
+value18504 = compute(value, 74)
+value48470 = compute(value, 67)
+value56219 = compute(value, 56)
+value46120 = compute(value, 45)
+value93322 = compute(value, 8)
+const v = os.getenv("BENCH_KEY_00212");
+value28901 = compute(value, 92)
+value9091 = compute(value, 70)
+value43614 = compute(value, 61)
+value65956 = compute(value, 93)
+# note 50684: keep this in sync with the handler
+value6358 = compute(value, 53)
+value4774 = compute(value, 21)
+value56948 = compute(value, 9)
+value81083 = compute(value, 88)
+# note 63759: keep this in sync with the handler
+value74611 = compute(value, 18)
+value48637 = compute(value, 40)
+value7963 = compute(value, 9)
+value12492 = compute(value, 76)
+const v = os.getenv("BENCH_KEY_01848");
+value54338 = compute(value, 18)
+value84872 = compute(value, 94)
+value34545 = compute(value, 13)
+value35345 = compute(value, 37)
+value76716 = compute(value, 86)
+value58526 = compute(value, 35)
+value55626 = compute(value, 45)
+value34263 = compute(value, 22)
+value61426 = compute(value, 25)
+value52320 = compute(value, 37)
+value47353 = compute(value, 17)
+value18647 = compute(value, 23)
+value50013 = compute(value, 58)
+value27802 = compute(value, 60)
+value84155 = compute(value, 56)
+value4659 = compute(value, 3)
+# note 75691: keep this in sync with the handler
+value38563 = compute(value, 54)
+value90740 = compute(value, 45)
+value10461 = compute(value, 82)
+const v = os.getenv("BENCH_KEY_00264");
+value96057 = compute(value, 27)
+value23676 = compute(value, 8)
+# note 58800: keep this in sync with the handler
+value8866 = compute(value, 39)
+value56426 = compute(value, 69)
+value11121 = compute(value, 63)
+value25481 = compute(value, 67)
+value31555 = compute(value, 30)
+value74448 = compute(value, 49)
+value39935 = compute(value, 68)
+value96596 = compute(value, 81)
+value9681 = compute(value, 78)
+value49784 = compute(value, 23)
+value73562 = compute(value, 36)
+value20679 = compute(value, 18)
+value24656 = compute(value, 18)
+value37136 = compute(value, 82)
+value93947 = compute(value, 51)
+value39682 = compute(value, 9)
+value39137 = compute(value, 46)
+value22709 = compute(value, 11)
+value38770 = compute(value, 67)
+const v = os.environ.get('BENCH_KEY_00736');
+# note 27519: keep this in sync with the handler
+value22215 = compute(value, 2)
+value4086 = compute(value, 12)
+value30006 = compute(value, 33)
+value53555 = compute(value, 11)
+value84496 = compute(value, 9)
+value14920 = compute(value, 79)
+value74545 = compute(value, 49)
+value68097 = compute(value, 3)
+value10541 = compute(value, 65)
+value75824 = compute(value, 67)
+# note 73580: keep this in sync with the handler
+value18804 = compute(value, 83)
+value43616 = compute(value, 63)
+value82058 = compute(value, 93)
+value88740 = compute(value, 82)
+value54201 = compute(value, 75)
+value88512 = compute(value, 48)
+# note 72999: keep this in sync with the handler
+# note 61786: keep this in sync with the handler
+value28781 = compute(value, 69)
+value78170 = compute(value, 85)
+const v = os.environ.get('BENCH_KEY_00428');
+value67186 = compute(value, 62)
+value54093 = compute(value, 64)
+value61451 = compute(value, 50)
+# note 99737: keep this in sync with the handler
+value64480 = compute(value, 72)
+value19048 = compute(value, 36)
+value4405 = compute(value, 40)
+value76291 = compute(value, 49)
+# note 37354: keep this in sync with the handler
+value75294 = compute(value, 22)
+# note 28924: keep this in sync with the handler
+value86420 = compute(value, 90)
+value89601 = compute(value, 70)
+# note 17842: keep this in sync with the handler
+const v = os.environ["BENCH_KEY_00704"];
+value22453 = compute(value, 46)
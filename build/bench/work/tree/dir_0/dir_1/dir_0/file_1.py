@@ -0,0 +1,240 @@
+value24496 = compute(value, 52)
+value35227 = compute(value, 16)
+value28348 = compute(value, 24)
+value35606 = compute(value, 7)
+value73387 = compute(value, 55)
+const v = os.environ["BENCH_KEY_00395"];
+value76237 = compute(value, 92)
+value88600 = compute(value, 39)
+value92234 = compute(value, 84)
+value38571 = compute(value, 62)
+value73833 = compute(value, 16)
+value3925 = compute(value, 45)
+value71889 = compute(value, 12)
+value28852 = compute(value, 43)
+value87952 = compute(value, 70)
+value72108 = compute(value, 37)
+# note 58737: keep this in sync with the handler
+value66337 = compute(value, 86)
+value93143 = compute(value, 23)
+value23458 = compute(value, 81)
+value13782 = compute(value, 8)
+value9352 = compute(value, 40)
+const v = os.environ.get('BENCH_KEY_01063');
+value67958 = compute(value, 58)
+value85547 = compute(value, 90)
+value51826 = compute(value, 28)
+# note 18955: keep this in sync with the handler
+value80171 = compute(value, 49)
+value84444 = compute(value, 54)
+value14006 = compute(value, 38)
+value4811 = compute(value, 58)
+value7513 = compute(value, 44)
+const v = os.getenv("BENCH_KEY_00958");
+value56227 = compute(value, 64)
+value68973 = compute(value, 6)
+value86854 = compute(value, 39)
+value59407 = compute(value, 43)
+value49555 = compute(value, 85)
+value79416 = compute(value, 70)
+value91405 = compute(value, 31)
+# note 8202: keep this in sync with the handler
+value9749 = compute(value, 49)
+value75227 = compute(value, 52)
+value25681 = compute(value, 73)
+value66092 = compute(value, 35)
+value77056 = compute(value, 38)
+value82873 = compute(value, 35)
+value37129 = compute(value, 75)
+value82375 = compute(value, 22)
+# note 94294: keep this in sync with the handler
+value27241 = compute(value, 81)
+value55620 = compute(value, 39)
+value66222 = compute(value, 68)
+value59752 = compute(value, 0)
+const v = os.environ.get('BENCH_KEY_00122');
+value39112 = compute(value, 21)
+value21509 = compute(value, 72)
+value4888 = compute(value, 38)
+value10887 = compute(value, 23)
+value13141 = compute(value, 46)
+value77306 = compute(value, 94)
+value19523 = compute(value, 26)
+value6096 = compute(value, 82)
+# note 80048: keep this in sync with the handler
+value50340 = compute(value, 94)
+value66363 = compute(value, 15)
+value9183 = compute(value, 65)
+value85761 = compute(value, 13)
+const v = os.environ["BENCH_KEY_00451"];
+value89580 = compute(value, 49)
+# note 64330: keep this in sync with the handler
+value96843 = compute(value, 37)
+value73020 = compute(value, 76)
+value91122 = compute(value, 39)
+value54258 = compute(value, 35)
+value39152 = compute(value, 61)
+value56734 = compute(value, 86)
+const v = os.environ["BENCH_KEY_01686"];
+value14112 = compute(value, 47)
+value46147 = compute(value, 72)
+value51006 = compute(value, 81)
+# note 56516: keep this in sync with the handler
+value12681 = compute(value, 71)
+value10917 = compute(value, 53)
+value36439 = compute(value, 64)
+value39925 = compute(value, 58)
+value47224 = compute(value, 82)
+value68527 = compute(value, 45)
+# note 26804: keep this in sync with the handler
+value28304 = compute(value, 77)
+value12118 = compute(value, 90)
+value40148 = compute(value, 87)
+value99147 = compute(value, 13)
+value5487 = compute(value, 55)
+value27836 = compute(value, 94)
+value71340 = compute(value, 45)
+value31033 = compute(value, 90)
+value27164 = compute(value, 4)
+value60734 = compute(value, 12)
+value27318 = compute(value, 61)
+value33136 = compute(value, 59)
+const v = os.environ.get('BENCH_KEY_00325');
+value4119 = compute(value, 45)
+value17356 = compute(value, 90)
+value15109 = compute(value, 74)
+# note 99665: keep this in sync with the handler
+value37420 = compute(value, 75)
+# note 49114: keep this in sync with the handler
+# note 348: keep this in sync with the handler
+value34784 = compute(value, 58)
+const v = os.environ["BENCH_KEY_00966"];
+value35787 = compute(value, 91)
+value22419 = compute(value, 12)
+value3831 = compute(value, 48)
+value43100 = compute(value, 32)
+value96049 = compute(value, 19)
+value5846 = compute(value, 26)
+value32192 = compute(value, 85)
+value63557 = compute(value, 22)
+value22340 = compute(value, 30)
+value19998 = compute(value, 16)
+value66772 = compute(value, 36)
+const v = os.environ["BENCH_KEY_01618"];
+value4249 = compute(value, 78)
+value53870 = compute(value, 35)
+# note 58781: keep this in sync with the handler
+value69375 = compute(value, 20)
+value12928 = compute(value, 27)
+value87329 = compute(value, 29)
+value47097 = compute(value, 52)
+value12355 = compute(value, 36)
+value75280 = compute(value, 8)
+# note 90949: keep this in sync with the handler
+# note 85991: keep this in sync with the handler
+value25882 = compute(value, 80)
+value64716 = compute(value, 17)
+const v = os.environ.get('BENCH_KEY_00716');
+value23146 = compute(value, 60)
+value41957 = compute(value, 53)
+value49306 = compute(value, 30)
+value50828 = compute(value, 0)
+value59857 = compute(value, 8)
+value7518 = compute(value, 49)
+# note 23052: keep this in sync with the handler
+value20952 = compute(value, 0)
+value16894 = compute(value, 16)
+value83610 = compute(value, 93)
+value65578 = compute(value, 6)
+value26843 = compute(value, 71)
+value88102 = compute(value, 26)
+value44709 = compute(value, 89)
+value65802 = compute(value, 36)
+const v = os.environ.get('BENCH_KEY_00881');
+value88781 = compute(value, 26)
+value16046 = compute(value, 41)
+value77299 = compute(value, 87)
+# note 93454: keep this in sync with the handler
+value53841 = compute(value, 6)
+value76727 = compute(value, 0)
+value75600 = compute(value, 37)
+# note 59094: keep this in sync with the handler
+value68703 = compute(value, 27)
+value74099 = compute(value, 88)
+value31119 = compute(value, 79)
+value33767 = compute(value, 11)
+# note 59148: keep this in sync with the handler
+# note 39565: keep this in sync with the handler
+value26356 = compute(value, 69)
+value83975 = compute(value, 70)
+value96656 = compute(value, 44)
+value27226 = compute(value, 66)
+const v = os.getenv("BENCH_KEY_00404");
+value15641 = compute(value, 24)
+value95747 = compute(value, 8)
+value17917 = compute(value, 69)
+value46422 = compute(value, 56)
+value70947 = compute(value, 40)
+value43931 = compute(value, 87)
+value38559 = compute(value, 50)
+value585 = compute(value, 3)
+# note 73632: keep this in sync with the handler
+value56489 = compute(value, 35)
+value4973 = compute(value, 26)
+# note 85821: keep this in sync with the handler
+const v = os.environ["BENCH_KEY_00847"];
+value85047 = compute(value, 75)
+value20021 = compute(value, 39)
+# note 34670: keep this in sync with the handler
+value24801 = compute(value, 66)
+value89214 = compute(value, 71)
+value98160 = compute(value, 93)
+# note 93310: keep this in sync with the handler
+value59206 = compute(value, 36)
+value86093 = compute(value, 54)
+value75948 = compute(value, 94)
+value22896 = compute(value, 4)
+value58704 = compute(value, 19)
+value78581 = compute(value, 11)
+value1297 = compute(value, 36)
+value11776 = compute(value, 39)
+value89732 = compute(value, 7)
+value76530 = compute(value, 94)
+const v = os.getenv("BENCH_KEY_00569");
+value15275 = compute(value, 46)
+value84064 = compute(value, 62)
+value87163 = compute(value, 57)
+value94495 = compute(value, 17)
+value42630 = compute(value, 47)
+value15403 = compute(value, 77)
+value11584 = compute(value, 41)
+value59272 = compute(value, 5)
+value12144 = compute(value, 19)
+value82611 = compute(value, 64)
+value92988 = compute(value, 62)
+value5982 = compute(value, 65)
+value66365 = compute(value, 17)
+value30246 = compute(value, 79)
+value49806 = compute(value, 45)
+const v = os.getenv("BENCH_KEY_00048");
+value65691 = compute(value, 22)
+value77394 = compute(value, 85)
+value59493 = compute(value, 32)
+value7162 = compute(value, 81)
+value67761 = compute(value, 55)
+value21243 = compute(value, 0)
+value98877 = compute(value, 34)
+value41696 = compute(value, 83)
+value31190 = compute(value, 53)
+value60445 = compute(value, 14)
+value13027 = compute(value, 29)
+value22198 = compute(value, 82)
+value57853 = compute(value, 41)
+# note 9207: keep this in sync with the handler
+value40632 = compute(value, 86)
+value35271 = compute(value, 60)
+value48559 = compute(value, 59)
+value63576 = compute(value, 41)
+# note 69285: keep this in sync with the handler
+value24517 = compute(value, 73)
+const v = os.environ.get('BENCH_KEY_00727');
@@ -0,0 +1,202 @@
+const value46298 = compute(value, 29);
+const value95189 = compute(value, 32);
+// note 36327: keep this in sync with the handler
+const value46843 = compute(value, 89);
+const value11590 = compute(value, 47);
+const value59278 = compute(value, 11);
+const value46354 = compute(value, 85);
+const value84785 = compute(value, 7);
+// note 99301: keep this in sync with the handler
+const value86579 = compute(value, 55);
+const value29041 = compute(value, 38);
+const value13467 = compute(value, 81);
+const value85478 = compute(value, 21);
+const v = process.env["BENCH_KEY_00085"];
+const value27156 = compute(value, 93);
+const value61401 = compute(value, 0);
+const value12094 = compute(value, 66);
+const value67300 = compute(value, 79);
+// note 4725: keep this in sync with the handler
+const value8757 = compute(value, 27);
+const value40396 = compute(value, 44);
+const value19341 = compute(value, 38);
+const v = import.meta.env.BENCH_KEY_00036;
+const value34149 = compute(value, 5);
+const value17188 = compute(value, 19);
+const value1910 = compute(value, 67);
+const value25616 = compute(value, 8);
+const value88992 = compute(value, 43);
+const value25429 = compute(value, 15);
+const value80573 = compute(value, 63);
+const value3563 = compute(value, 71);
+const value75876 = compute(value, 22);
+const value32846 = compute(value, 60);
+const value31656 = compute(value, 34);
+const value98749 = compute(value, 3);
+const value38818 = compute(value, 18);
+const value8719 = compute(value, 86);
+// note 78945: keep this in sync with the handler
+const value95707 = compute(value, 65);
+// note 33978: keep this in sync with the handler
+// note 72283: keep this in sync with the handler
+const v = import.meta.env.BENCH_KEY_00272;
+// note 74541: keep this in sync with the handler
+const value15500 = compute(value, 77);
+const value48471 = compute(value, 68);
+const value48826 = compute(value, 35);
+const value43407 = compute(value, 48);
+const value6114 = compute(value, 3);
+const value62176 = compute(value, 96);
+const value6440 = compute(value, 38);
+const value68682 = compute(value, 6);
+const value13206 = compute(value, 14);
+// note 26755: keep this in sync with the handler
+const value78704 = compute(value, 37);
+const value35108 = compute(value, 91);
+const value85869 = compute(value, 24);
+const value60261 = compute(value, 24);
+const value86219 = compute(value, 83);
+const value53206 = compute(value, 50);
+const v = process.env.BENCH_KEY_01826;
+const value25232 = compute(value, 12);
+const value76101 = compute(value, 53);
+const value53602 = compute(value, 58);
+const value99652 = compute(value, 33);
+const value35655 = compute(value, 56);
+const value38144 = compute(value, 23);
+const value2864 = compute(value, 51);
+const value57449 = compute(value, 25);
+const v = process.env.BENCH_KEY_01458;
+const value65810 = compute(value, 44);
+const value72816 = compute(value, 66);
+const value65239 = compute(value, 55);
+// note 10986: keep this in sync with the handler
+const value44992 = compute(value, 81);
+// note 52566: keep this in sync with the handler
+const value90915 = compute(value, 26);
+const value9082 = compute(value, 61);
+const value81620 = compute(value, 43);
+// note 98819: keep this in sync with the handler
+const value54982 = compute(value, 80);
+const value95081 = compute(value, 21);
+const value74043 = compute(value, 32);
+const value54874 = compute(value, 69);
+const v = process.env.BENCH_KEY_01433;
+const value74728 = compute(value, 38);
+const value23072 = compute(value, 83);
+// note 13372: keep this in sync with the handler
+const value47298 = compute(value, 59);
+// note 63797: keep this in sync with the handler
+const value90267 = compute(value, 57);
+const value14251 = compute(value, 89);
+const value29278 = compute(value, 81);
+const value56688 = compute(value, 40);
+const value97676 = compute(value, 94);
+// note 81567: keep this in sync with the handler
+const v = import.meta.env.BENCH_KEY_01806;
+const value67114 = compute(value, 87);
+const value96743 = compute(value, 34);
+// note 21382: keep this in sync with the handler
+const value85512 = compute(value, 55);
+const value69260 = compute(value, 2);
+// note 14533: keep this in sync with the handler
+// note 66721: keep this in sync with the handler
+// note 59762: keep this in sync with the handler
+const value42447 = compute(value, 58);
+const value69129 = compute(value, 65);
+const value31744 = compute(value, 25);
+const value83712 = compute(value, 1);
+const value98324 = compute(value, 63);
+const value1099 = compute(value, 32);
+// note 87310: keep this in sync with the handler
+const value95221 = compute(value, 64);
+const value97481 = compute(value, 93);
+const v = process.env["BENCH_KEY_00286"];
+// note 22072: keep this in sync with the handler
+const value12878 = compute(value, 74);
+// note 60008: keep this in sync with the handler
+const value86562 = compute(value, 38);
+const value76006 = compute(value, 55);
+const value42277 = compute(value, 82);
+const value66210 = compute(value, 56);
+// note 86052: keep this in sync with the handler
+const value26734 = compute(value, 59);
+const value99454 = compute(value, 29);
+// note 3924: keep this in sync with the handler
+const value77644 = compute(value, 44);
+const value82348 = compute(value, 92);
+const value59357 = compute(value, 90);
+const value92124 = compute(value, 71);
+// note 77254: keep this in sync with the handler
+const v = process.env.BENCH_KEY_00180;
+// note 17838: keep this in sync with the handler
+// note 78867: keep this in sync with the handler
+const value93735 = compute(value, 33);
+const value9854 = compute(value, 57);
+const value46128 = compute(value, 53);
+const value24234 = compute(value, 81);
+const value16757 = compute(value, 73);
+const value56530 = compute(value, 76);
+const value44987 = compute(value, 76);
+const value58960 = compute(value, 81);
+const value16548 = compute(value, 58);
+const value1483 = compute(value, 28);
+const value43390 = compute(value, 31);
+const value24204 = compute(value, 51);
+const value80675 = compute(value, 68);
+const v = process.env.BENCH_KEY_00694;
+const value43776 = compute(value, 29);
+const value15783 = compute(value, 69);
+const value50511 = compute(value, 71);
+const value18928 = compute(value, 13);
+const value86408 = compute(value, 78);
+const value29365 = compute(value, 71);
+const value72063 = compute(value, 89);
+const value24939 = compute(value, 10);
+const v = process.env.BENCH_KEY_00363;
+const value12338 = compute(value, 19);
+const value87547 = compute(value, 53);
+const value41743 = compute(value, 33);
+const value40821 = compute(value, 81);
+// note 60956: keep this in sync with the handler
+const value12666 = compute(value, 56);
+const value50572 = compute(value, 35);
+// note 37729: keep this in sync with the handler
+const value57661 = compute(value, 43);
+const value20651 = compute(value, 87);
+const value23990 = compute(value, 31);
+const v = process.env["BENCH_KEY_01749"];
+const value65592 = compute(value, 20);
+const value67854 = compute(value, 51);
+const value59196 = compute(value, 26);
+const value43447 = compute(value, 88);
+const value67602 = compute(value, 90);
+const value37181 = compute(value, 30);
+const value57175 = compute(value, 42);
+const value50687 = compute(value, 53);
+const value70011 = compute(value, 74);
+const v = process.env.BENCH_KEY_00985;
+const value19620 = compute(value, 26);
+const value95775 = compute(value, 36);
+const value99936 = compute(value, 26);
+// note 96683: keep this in sync with the handler
+const value82895 = compute(value, 57);
+const value90499 = compute(value, 95);
+const value62882 = compute(value, 26);
+const value7552 = compute(value, 83);
+const value46060 = compute(value, 82);
+const value14622 = compute(value, 72);
+const value67511 = compute(value, 96);
+const value64557 = compute(value, 52);
+const value16087 = compute(value, 82);
+const value96625 = compute(value, 13);
+const v = process.env.BENCH_KEY_00868;
+const value39582 = compute(value, 6);
+const value32679 = compute(value, 87);
+const value86404 = compute(value, 74);
+// note 38268: keep this in sync with the handler
+const value28152 = compute(value, 22);
+const value47775 = compute(value, 51);
+// note 31172: keep this in sync with the handler
+const value60328 = compute(value, 91);
+const value25456 = compute(value, 42);
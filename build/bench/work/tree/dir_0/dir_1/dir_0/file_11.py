@@ -0,0 +1,238 @@
+value76703 = compute(value, 73)
+value41855 = compute(value, 48)
+value30373 = compute(value, 12)
+value76534 = compute(value, 1)
+value7576 = compute(value, 10)
+const v = os.getenv("BENCH_KEY_00520");
+# note 24741: keep this in sync with the handler
+# note 51764: keep this in sync with the handler
+# note 33870: keep this in sync with the handler
+value11519 = compute(value, 73)
+value14693 = compute(value, 46)
+value27502 = compute(value, 51)
+value13669 = compute(value, 89)
+value90335 = compute(value, 28)
+value22862 = compute(value, 67)
+value6962 = compute(value, 75)
+# note 88007: keep this in sync with the handler
+value76841 = compute(value, 17)
+value14552 = compute(value, 2)
+value44460 = compute(value, 34)
+value66939 = compute(value, 9)
+# note 1253: keep this in sync with the handler
+value91575 = compute(value, 7)
+# note 40884: keep this in sync with the handler
+value53780 = compute(value, 42)
+const v = os.environ.get('BENCH_KEY_01887');
+# note 36128: keep this in sync with the handler
+value99446 = compute(value, 21)
+# note 90498: keep this in sync with the handler
+value31772 = compute(value, 53)
+value27587 = compute(value, 39)
+# note 54485: keep this in sync with the handler
+value51821 = compute(value, 23)
+value41791 = compute(value, 81)
+value59917 = compute(value, 68)
+value89564 = compute(value, 33)
+value58879 = compute(value, 0)
+value82327 = compute(value, 71)
+value2444 = compute(value, 19)
+value78867 = compute(value, 6)
+value61 = compute(value, 61)
+value14285 = compute(value, 26)
+value51878 = compute(value, 80)
+value9583 = compute(value, 77)
+value99904 = compute(value, 91)
+value29823 = compute(value, 44)
+const v = os.getenv("BENCH_KEY_01626");
+value23322 = compute(value, 42)
+value1707 = compute(value, 58)
+value79846 = compute(value, 15)
+value81621 = compute(value, 44)
+value905 = compute(value, 32)
+value84412 = compute(value, 22)
+value40599 = compute(value, 53)
+value50597 = compute(value, 60)
+value74022 = compute(value, 11)
+value83621 = compute(value, 7)
+value78815 = compute(value, 51)
+value11672 = compute(value, 32)
+value76310 = compute(value, 68)
+value49167 = compute(value, 85)
+const v = os.environ["BENCH_KEY_00806"];
+value79735 = compute(value, 1)
+value71282 = compute(value, 84)
+value8786 = compute(value, 56)
+value35843 = compute(value, 50)
+value55321 = compute(value, 31)
+value59667 = compute(value, 12)
+value78966 = compute(value, 8)
+value22968 = compute(value, 76)
+value95992 = compute(value, 59)
+value61943 = compute(value, 57)
+# note 26159: keep this in sync with the handler
+value7389 = compute(value, 17)
+value39795 = compute(value, 25)
+value88776 = compute(value, 21)
+value6241 = compute(value, 33)
+value39739 = compute(value, 66)
+const v = os.environ.get('BENCH_KEY_00082');
+value83721 = compute(value, 10)
+# note 85880: keep this in sync with the handler
+# note 62666: keep this in sync with the handler
+value86675 = compute(value, 54)
+value86613 = compute(value, 89)
+# note 58570: keep this in sync with the handler
+value56228 = compute(value, 65)
+value82452 = compute(value, 2)
+value38687 = compute(value, 81)
+value39197 = compute(value, 9)
+# note 66769: keep this in sync with the handler
+value83806 = compute(value, 95)
+const v = os.environ.get('BENCH_KEY_00924');
+value76558 = compute(value, 25)
+value85765 = compute(value, 17)
+value97666 = compute(value, 84)
+value40422 = compute(value, 70)
+value10354 = compute(value, 72)
+value83711 = compute(value, 0)
+value93607 = compute(value, 2)
+value53182 = compute(value, 26)
+value48571 = compute(value, 71)
+# note 27981: keep this in sync with the handler
+value28734 = compute(value, 22)
+value25327 = compute(value, 10)
+value25702 = compute(value, 94)
+value10362 = compute(value, 80)
+value93040 = compute(value, 17)
+value33763 = compute(value, 7)
+const v = os.environ.get('BENCH_KEY_01745');
+value63574 = compute(value, 39)
+value15308 = compute(value, 79)
+value32021 = compute(value, 11)
+# note 51533: keep this in sync with the handler
+value32848 = compute(value, 62)
+value63063 = compute(value, 13)
+value15210 = compute(value, 78)
+value88024 = compute(value, 45)
+value71648 = compute(value, 62)
+value89854 = compute(value, 32)
+value26507 = compute(value, 26)
+value66189 = compute(value, 35)
+value9646 = compute(value, 43)
+# note 14355: keep this in sync with the handler
+value55116 = compute(value, 20)
+value15955 = compute(value, 47)
+value74049 = compute(value, 38)
+const v = os.environ.get('BENCH_KEY_00506');
+# note 36235: keep this in sync with the handler
+value97465 = compute(value, 77)
+value28345 = compute(value, 21)
+value81366 = compute(value, 80)
+value35476 = compute(value, 71)
+value544 = compute(value, 59)
+value85536 = compute(value, 79)
+value82886 = compute(value, 48)
+value11941 = compute(value, 10)
+value79411 = compute(value, 65)
+value48750 = compute(value, 56)
+value76693 = compute(value, 63)
+value55792 = compute(value, 17)
+value24804 = compute(value, 69)
+value30891 = compute(value, 45)
+value81105 = compute(value, 13)
+# note 91438: keep this in sync with the handler
+value34706 = compute(value, 77)
+const v = os.environ["BENCH_KEY_00521"];
+value9386 = compute(value, 74)
+value35552 = compute(value, 50)
+value76705 = compute(value, 75)
+value57809 = compute(value, 94)
+value44087 = compute(value, 49)
+value81274 = compute(value, 85)
+value4809 = compute(value, 56)
+value6340 = compute(value, 35)
+value54057 = compute(value, 28)
+# note 466: keep this in sync with the handler
+value50108 = compute(value, 56)
+value93494 = compute(value, 83)
+value6215 = compute(value, 7)
+value87157 = compute(value, 51)
+# note 17443: keep this in sync with the handler
+value64563 = compute(value, 58)
+value88507 = compute(value, 43)
+value60733 = compute(value, 11)
+value78123 = compute(value, 38)
+value8960 = compute(value, 36)
+value75614 = compute(value, 51)
+const v = os.environ["BENCH_KEY_01582"];
+value34808 = compute(value, 82)
+# note 84797: keep this in sync with the handler
+value29885 = compute(value, 9)
+value76571 = compute(value, 38)
+value14869 = compute(value, 28)
+value52003 = compute(value, 11)
+value18892 = compute(value, 74)
+value73735 = compute(value, 15)
+value52089 = compute(value, 0)
+value35421 = compute(value, 16)
+value36808 = compute(value, 45)
+value52249 = compute(value, 63)
+value50373 = compute(value, 30)
+const v = os.environ["BENCH_KEY_01827"];
+value51435 = compute(value, 25)
+# note 28113: keep this in sync with the handler
+value48419 = compute(value, 16)
+value25691 = compute(value, 83)
+value3771 = compute(value, 85)
+value91731 = compute(value, 66)
+value73565 = compute(value, 39)
+value86888 = compute(value, 73)
+value50220 = compute(value, 71)
+value65962 = compute(value, 2)
+value85116 = compute(value, 47)
+# note 95879: keep this in sync with the handler
+value20042 = compute(value, 60)
+value72610 = compute(value, 54)
+value47594 = compute(value, 64)
+value71469 = compute(value, 77)
+# note 93438: keep this in sync with the handler
+value94246 = compute(value, 59)
+# note 38264: keep this in sync with the handler
+value18109 = compute(value, 67)
+const v = os.getenv("BENCH_KEY_00200");
+value10275 = compute(value, 90)
+value25434 = compute(value, 20)
+value50207 = compute(value, 58)
+value16859 = compute(value, 78)
+value21058 = compute(value, 9)
+value10265 = compute(value, 80)
+value24128 = compute(value, 72)
+value86324 = compute(value, 91)
+value62342 = compute(value, 68)
+value67048 = compute(value, 21)
+value72225 = compute(value, 57)
+value12484 = compute(value, 68)
+value53066 = compute(value, 7)
+value89131 = compute(value, 85)
+value47204 = compute(value, 62)
+value90928 = compute(value, 39)
+value49060 = compute(value, 75)
+value94735 = compute(value, 63)
+# note 6376: keep this in sync with the handler
+const v = os.environ["BENCH_KEY_00963"];
+# note 24132: keep this in sync with the handler
+value6559 = compute(value, 60)
+value82830 = compute(value, 89)
+value32204 = compute(value, 0)
+value25810 = compute(value, 8)
+value94062 = compute(value, 69)
+value51690 = compute(value, 86)
+value74911 = compute(value, 27)
+value25023 = compute(value, 94)
+value57743 = compute(value, 28)
+value13694 = compute(value, 17)
+value25048 = compute(value, 22)
+const v = os.environ.get('BENCH_KEY_00070');
+value5972 = compute(value, 55)
+# note 56860: keep this in sync with the handler
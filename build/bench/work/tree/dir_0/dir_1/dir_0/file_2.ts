@@ -0,0 +1,204 @@
+const value8955 = compute(value, 31);
+const value90111 = compute(value, 95);
+const value5328 = compute(value, 90);
+const value25595 = compute(value, 84);
+const value26982 = compute(value, 16);
+const value54980 = compute(value, 78);
+const v = import.meta.env.BENCH_KEY_00548;
+const value70900 = compute(value, 90);
+const value37501 = compute(value, 59);
+const value55809 = compute(value, 34);
+const value65117 = compute(value, 30);
+const value2790 = compute(value, 74);
+const value74345 = compute(value, 43);
+const value67601 = compute(value, 89);
+const value37804 = compute(value, 71);
+// note 1955: keep this in sync with the handler
+const value94684 = compute(value, 12);
+// note 6637: keep this in sync with the handler
+const value94455 = compute(value, 74);
+const value31123 = compute(value, 83);
+const value72939 = compute(value, 92);
+const value80469 = compute(value, 56);
+const value32144 = compute(value, 37);
+const value61842 = compute(value, 53);
+// note 31648: keep this in sync with the handler
+const v = process.env.BENCH_KEY_01693;
+const value20626 = compute(value, 62);
+const value71756 = compute(value, 73);
+const value8543 = compute(value, 7);
+const value49886 = compute(value, 28);
+const value78755 = compute(value, 88);
+// note 62355: keep this in sync with the handler
+const value40483 = compute(value, 34);
+const value66507 = compute(value, 62);
+const value9866 = compute(value, 69);
+const value96254 = compute(value, 30);
+const value84051 = compute(value, 49);
+const value76590 = compute(value, 57);
+const value63872 = compute(value, 46);
+const value49041 = compute(value, 56);
+const value8084 = compute(value, 33);
+const v = process.env["BENCH_KEY_00157"];
+const value91267 = compute(value, 87);
+const value76633 = compute(value, 3);
+const value16635 = compute(value, 48);
+const value15574 = compute(value, 54);
+const value29294 = compute(value, 0);
+const value93657 = compute(value, 52);
+const value83586 = compute(value, 69);
+const value71486 = compute(value, 94);
+const value40872 = compute(value, 35);
+const value99751 = compute(value, 35);
+const value80088 = compute(value, 63);
+const value11814 = compute(value, 77);
+const value90376 = compute(value, 69);
+const v = import.meta.env.BENCH_KEY_00008;
+const value25567 = compute(value, 56);
+const value69357 = compute(value, 2);
+const value47721 = compute(value, 94);
+const value78003 = compute(value, 15);
+const value26845 = compute(value, 73);
+const value66486 = compute(value, 41);
+const value5183 = compute(value, 42);
+const value60161 = compute(value, 21);
+const value29527 = compute(value, 39);
+const v = process.env.BENCH_KEY_01028;
+const value75295 = compute(value, 23);
+// note 78702: keep this in sync with the handler
+const value96545 = compute(value, 30);
+const value89429 = compute(value, 92);
+const value83539 = compute(value, 22);
+const value46275 = compute(value, 6);
+// note 83584: keep this in sync with the handler
+const value43685 = compute(value, 35);
+// note 60034: keep this in sync with the handler
+const value75426 = compute(value, 57);
+const value66897 = compute(value, 64);
+const value49219 = compute(value, 40);
+const value59770 = compute(value, 18);
+// note 36836: keep this in sync with the handler
+const value85258 = compute(value, 92);
+const value1082 = compute(value, 15);
+const v = process.env["BENCH_KEY_01031"];
+const value66199 = compute(value, 45);
+const value88531 = compute(value, 67);
+const value59872 = compute(value, 23);
+// note 969: keep this in sync with the handler
+const value69038 = compute(value, 71);
+// note 26323: keep this in sync with the handler
+const value30235 = compute(value, 68);
+const value43667 = compute(value, 17);
+const value34936 = compute(value, 16);
+const value65154 = compute(value, 67);
+const value65298 = compute(value, 17);
+const value97950 = compute(value, 77);
+// note 50429: keep this in sync with the handler
+const value15101 = compute(value, 66);
+const value83555 = compute(value, 38);
+const value26882 = compute(value, 13);
+const value75349 = compute(value, 77);
+const v = process.env.BENCH_KEY_01180;
+const value35287 = compute(value, 76);
+const value25341 = compute(value, 24);
+const value77929 = compute(value, 38);
+const value64442 = compute(value, 34);
+const value25457 = compute(value, 43);
+const value59011 = compute(value, 35);
+const value28161 = compute(value, 31);
+// note 63275: keep this in sync with the handler
+const value7256 = compute(value, 78);
+const value31854 = compute(value, 38);
+const value26697 = compute(value, 22);
+// note 88503: keep this in sync with the handler
+const value27464 = compute(value, 13);
+const value66552 = compute(value, 10);
+const value24081 = compute(value, 25);
+const v = import.meta.env.BENCH_KEY_01997;
+// note 48564: keep this in sync with the handler
+const value40399 = compute(value, 47);
+const value36771 = compute(value, 8);
+const value85533 = compute(value, 76);
+const value4211 = compute(value, 40);
+const value47101 = compute(value, 56);
+const value24064 = compute(value, 8);
+const value94522 = compute(value, 44);
+const v = process.env["BENCH_KEY_00625"];
+const value8305 = compute(value, 60);
+const value82669 = compute(value, 25);
+// note 15213: keep this in sync with the handler
+const value42132 = compute(value, 34);
+const value1729 = compute(value, 80);
+const value43861 = compute(value, 17);
+const value22977 = compute(value, 85);
+// note 46561: keep this in sync with the handler
+const value68807 = compute(value, 34);
+const value15076 = compute(value, 41);
+const value45127 = compute(value, 22);
+const value41793 = compute(value, 83);
+const value25341 = compute(value, 24);
+const value57800 = compute(value, 85);
+// note 80556: keep this in sync with the handler
+const value55036 = compute(value, 37);
+const v = process.env.BENCH_KEY_00791;
+const value97586 = compute(value, 4);
+const value25659 = compute(value, 51);
+const value4051 = compute(value, 74);
+const value12320 = compute(value, 1);
+const value35426 = compute(value, 21);
+const value63685 = compute(value, 53);
+const value30814 = compute(value, 65);
+const value87062 = compute(value, 53);
+const v = import.meta.env.BENCH_KEY_01932;
+const value73739 = compute(value, 19);
+const value77179 = compute(value, 64);
+const value23882 = compute(value, 20);
+// note 13461: keep this in sync with the handler
+// note 39580: keep this in sync with the handler
+const value58504 = compute(value, 13);
+const value18550 = compute(value, 23);
+const v = import.meta.env.BENCH_KEY_00071;
+const value41623 = compute(value, 10);
+const value58757 = compute(value, 72);
+const value12632 = compute(value, 22);
+const value59141 = compute(value, 68);
+const value29499 = compute(value, 11);
+// note 31451: keep this in sync with the handler
+const value90114 = compute(value, 1);
+const value56093 = compute(value, 27);
+const value11048 = compute(value, 87);
+const value28390 = compute(value, 66);
+// note 6870: keep this in sync with the handler
+const value42857 = compute(value, 80);
+const value98750 = compute(value, 4);
+const v = process.env["BENCH_KEY_01255"];
+const value66694 = compute(value, 55);
+const value29224 = compute(value, 27);
+const value31392 = compute(value, 61);
+const value6980 = compute(value, 93);
+const value16608 = compute(value, 21);
+const value2986 = compute(value, 76);
+const value62337 = compute(value, 63);
+const value2927 = compute(value, 17);
+const value65769 = compute(value, 3);
+const value78924 = compute(value, 63);
+const value43859 = compute(value, 15);
+const v = process.env["BENCH_KEY_01516"];
+const value73093 = compute(value, 52);
+const value71621 = compute(value, 35);
+const value76642 = compute(value, 12);
+const value93270 = compute(value, 53);
+const value38057 = compute(value, 33);
+// note 30227: keep this in sync with the handler
+const value98273 = compute(value, 12);
+const value17191 = compute(value, 22);
+const value5208 = compute(value, 67);
+const value6518 = compute(value, 19);
+const value80292 = compute(value, 73);
+const value77086 = compute(value, 68);
+const v = process.env["BENCH_KEY_01950"];
+const value89942 = compute(value, 23);
+const value38609 = compute(value, 3);
+const value19514 = compute(value, 17);
+const value45007 = compute(value, 96);
+const value48258 = compute(value, 49);
@@ -0,0 +1,203 @@
+const value97471 = compute(value, 83);
+const v = process.env["BENCH_KEY_01026"];
+const value23364 = compute(value, 84);
+const value3118 = compute(value, 14);
+const value58870 = compute(value, 88);
+const value35904 = compute(value, 14);
+const value99584 = compute(value, 62);
+const value88447 = compute(value, 80);
+// note 30263: keep this in sync with the handler
+const value93782 = compute(value, 80);
+const value74281 = compute(value, 76);
+const value26938 = compute(value, 69);
+// note 94359: keep this in sync with the handler
+const value7001 = compute(value, 17);
+const value25302 = compute(value, 82);
+const v = process.env.BENCH_KEY_01961;
+const value75181 = compute(value, 6);
+const value33062 = compute(value, 82);
+const value74905 = compute(value, 21);
+const value43125 = compute(value, 57);
+const value14060 = compute(value, 92);
+const value50688 = compute(value, 54);
+const value99585 = compute(value, 63);
+const value25274 = compute(value, 54);
+const value67548 = compute(value, 36);
+// note 32377: keep this in sync with the handler
+const value55702 = compute(value, 24);
+// note 67908: keep this in sync with the handler
+const value21511 = compute(value, 74);
+const v = process.env.BENCH_KEY_01748;
+const value8387 = compute(value, 45);
+const value83867 = compute(value, 59);
+const value84620 = compute(value, 36);
+// note 10495: keep this in sync with the handler
+const value32388 = compute(value, 87);
+const value72826 = compute(value, 76);
+const value53586 = compute(value, 42);
+const v = process.env.BENCH_KEY_01720;
+const value9697 = compute(value, 94);
+// note 50780: keep this in sync with the handler
+const value33107 = compute(value, 30);
+const value79243 = compute(value, 91);
+const value34735 = compute(value, 9);
+const value78998 = compute(value, 40);
+const value50938 = compute(value, 13);
+const value27319 = compute(value, 62);
+const value16022 = compute(value, 17);
+const value18892 = compute(value, 74);
+const value78373 = compute(value, 94);
+const value97552 = compute(value, 67);
+const value1039 = compute(value, 69);
+const value84852 = compute(value, 74);
+const value17346 = compute(value, 80);
+// note 58197: keep this in sync with the handler
+const value17579 = compute(value, 22);
+const v = process.env["BENCH_KEY_01933"];
+const value26679 = compute(value, 4);
+const value26132 = compute(value, 39);
+const value56947 = compute(value, 8);
+const value12813 = compute(value, 9);
+const value92247 = compute(value, 0);
+const value27364 = compute(value, 10);
+const value87403 = compute(value, 6);
+const value82194 = compute(value, 35);
+const value30025 = compute(value, 52);
+const value54616 = compute(value, 5);
+const value54058 = compute(value, 29);
+const value23616 = compute(value, 45);
+const value542 = compute(value, 57);
+// note 77504: keep this in sync with the handler
+const value94270 = compute(value, 83);
+const value81340 = compute(value, 54);
+const value77047 = compute(value, 29);
+const value92984 = compute(value, 58);
+const value56480 = compute(value, 26);
+const v = import.meta.env.BENCH_KEY_01463;
+const value1101 = compute(value, 34);
+const value14131 = compute(value, 66);
+const value70314 = compute(value, 86);
+const value77856 = compute(value, 62);
+const value98708 = compute(value, 59);
+const value86177 = compute(value, 41);
+const value27762 = compute(value, 20);
+const value8426 = compute(value, 84);
+const value96514 = compute(value, 96);
+const value99751 = compute(value, 35);
+const v = process.env.BENCH_KEY_01236;
+const value12375 = compute(value, 56);
+// note 73744: keep this in sync with the handler
+const value56519 = compute(value, 65);
+const value17093 = compute(value, 21);
+const value70818 = compute(value, 8);
+const value12714 = compute(value, 7);
+const value6151 = compute(value, 40);
+const value47293 = compute(value, 54);
+// note 82087: keep this in sync with the handler
+// note 5149: keep this in sync with the handler
+const value90195 = compute(value, 82);
+const value95191 = compute(value, 34);
+const v = import.meta.env.BENCH_KEY_01169;
+const value621 = compute(value, 39);
+const value64432 = compute(value, 24);
+const value12083 = compute(value, 55);
+const value79319 = compute(value, 70);
+// note 64736: keep this in sync with the handler
+const value23319 = compute(value, 39);
+const value50955 = compute(value, 30);
+const value43911 = compute(value, 67);
+const value11588 = compute(value, 45);
+const value22164 = compute(value, 48);
+const value99099 = compute(value, 62);
+const v = import.meta.env.BENCH_KEY_00813;
+const value53266 = compute(value, 13);
+const value72551 = compute(value, 92);
+const value80868 = compute(value, 67);
+const value93218 = compute(value, 1);
+// note 48738: keep this in sync with the handler
+const value38111 = compute(value, 87);
+const value8865 = compute(value, 38);
+// note 30326: keep this in sync with the handler
+const value57851 = compute(value, 39);
+// note 71121: keep this in sync with the handler
+const value19507 = compute(value, 10);
+const value97364 = compute(value, 73);
+const value40653 = compute(value, 10);
+// note 52023: keep this in sync with the handler
+const value61885 = compute(value, 96);
+// note 10876: keep this in sync with the handler
+const v = process.env.BENCH_KEY_01615;
+const value60809 = compute(value, 87);
+const value7310 = compute(value, 35);
+const value24001 = compute(value, 42);
+const value36210 = compute(value, 29);
+const value52816 = compute(value, 48);
+const value5427 = compute(value, 92);
+const value60729 = compute(value, 7);
+const value39700 = compute(value, 27);
+const value79932 = compute(value, 4);
+const value38496 = compute(value, 84);
+const value48235 = compute(value, 26);
+// note 32459: keep this in sync with the handler
+const value43623 = compute(value, 70);
+const value85538 = compute(value, 81);
+const v = import.meta.env.BENCH_KEY_00945;
+const value62474 = compute(value, 6);
+const value45415 = compute(value, 19);
+const value99295 = compute(value, 64);
+const value28053 = compute(value, 20);
+const value43902 = compute(value, 58);
+// note 4306: keep this in sync with the handler
+// note 79464: keep this in sync with the handler
+const value43521 = compute(value, 65);
+// note 39195: keep this in sync with the handler
+const value79455 = compute(value, 12);
+const value50212 = compute(value, 63);
+const value78081 = compute(value, 93);
+const value48126 = compute(value, 14);
+const value94124 = compute(value, 34);
+const value89121 = compute(value, 75);
+const value86928 = compute(value, 16);
+const v = process.env["BENCH_KEY_00510"];
+// note 2998: keep this in sync with the handler
+const value74007 = compute(value, 93);
+// note 51514: keep this in sync with the handler
+const value66425 = compute(value, 77);
+const value99053 = compute(value, 16);
+const value61876 = compute(value, 87);
+// note 90928: keep this in sync with the handler
+const v = process.env["BENCH_KEY_00902"];
+const value89935 = compute(value, 16);
+const value63807 = compute(value, 78);
+const value37245 = compute(value, 94);
+// note 33409: keep this in sync with the handler
+const value25226 = compute(value, 6);
+const value340 = compute(value, 49);
+const value1704 = compute(value, 55);
+const value41109 = compute(value, 78);
+const value5948 = compute(value, 31);
+const value33641 = compute(value, 79);
+const value51583 = compute(value, 76);
+const value2317 = compute(value, 86);
+const value14389 = compute(value, 33);
+const value81214 = compute(value, 25);
+const value44944 = compute(value, 33);
+// note 87318: keep this in sync with the handler
+const value46782 = compute(value, 28);
+// note 70343: keep this in sync with the handler
+// note 3842: keep this in sync with the handler
+const v = process.env["BENCH_KEY_00183"];
+const value2631 = compute(value, 12);
+const value44660 = compute(value, 40);
+const value91866 = compute(value, 7);
+const value385 = compute(value, 94);
+const value82221 = compute(value, 62);
+const value82109 = compute(value, 47);
+const value45816 = compute(value, 32);
+// note 61827: keep this in sync with the handler
+const value778 = compute(value, 2);
+const value49555 = compute(value, 85);
+const value52456 = compute(value, 76);
+const value76624 = compute(value, 91);
+const v = import.meta.env.BENCH_KEY_00926;
+const value13880 = compute(value, 9);
@@ -0,0 +1,228 @@
+value9988 := compute(value, 94)
+const v = os.LookupEnv("BENCH_KEY_00086");
+value25721 := compute(value, 16)
+value77128 := compute(value, 13)
+value73371 := compute(value, 39)
+value43014 := compute(value, 43)
+value65751 := compute(value, 82)
+value22175 := compute(value, 59)
+value99231 := compute(value, 0)
+value15284 := compute(value, 55)
+value99796 := compute(value, 80)
+value54139 := compute(value, 13)
+value18763 := compute(value, 42)
+value47064 := compute(value, 19)
+value88675 := compute(value, 17)
+value34308 := compute(value, 67)
+value72873 := compute(value, 26)
+value64555 := compute(value, 50)
+const v = os.LookupEnv("BENCH_KEY_00690");
+value94869 := compute(value, 3)
+value47798 := compute(value, 74)
+// note 61644: keep this in sync with the handler
+// note 23648: keep this in sync with the handler
+value70521 := compute(value, 2)
+value46052 := compute(value, 74)
+value53058 := compute(value, 96)
+value63561 := compute(value, 26)
+value59452 := compute(value, 88)
+value91363 := compute(value, 86)
+value53356 := compute(value, 6)
+value20263 := compute(value, 87)
+value60434 := compute(value, 3)
+const v = os.Getenv("BENCH_KEY_01825");
+value62180 := compute(value, 3)
+value32103 := compute(value, 93)
+// note 63238: keep this in sync with the handler
+value6993 := compute(value, 9)
+value53816 := compute(value, 78)
+value94097 := compute(value, 7)
+// note 72423: keep this in sync with the handler
+// note 93359: keep this in sync with the handler
+// note 31836: keep this in sync with the handler
+value1612 := compute(value, 60)
+value99669 := compute(value, 50)
+value11340 := compute(value, 88)
+const v = os.LookupEnv("BENCH_KEY_01968");
+value6496 := compute(value, 94)
+value6317 := compute(value, 12)
+value70321 := compute(value, 93)
+value18113 := compute(value, 71)
+value67140 := compute(value, 16)
+value61293 := compute(value, 86)
+value83522 := compute(value, 5)
+value56386 := compute(value, 29)
+value2180 := compute(value, 46)
+// note 60879: keep this in sync with the handler
+const v = os.Getenv("BENCH_KEY_01426");
+value88218 := compute(value, 45)
+value62236 := compute(value, 59)
+value35380 := compute(value, 72)
+// note 98243: keep this in sync with the handler
+value78950 := compute(value, 89)
+value18656 := compute(value, 32)
+value47218 := compute(value, 76)
+value11062 := compute(value, 4)
+// note 26967: keep this in sync with the handler
+value21807 := compute(value, 79)
+value86998 := compute(value, 86)
+// note 915: keep this in sync with the handler
+value31827 := compute(value, 11)
+const v = os.LookupEnv("BENCH_KEY_01258");
+value99620 := compute(value, 1)
+// note 21012: keep this in sync with the handler
+value98734 := compute(value, 85)
+value57887 := compute(value, 75)
+// note 55193: keep this in sync with the handler
+value82970 := compute(value, 35)
+value28251 := compute(value, 24)
+value99064 := compute(value, 27)
+value52614 := compute(value, 40)
+value38164 := compute(value, 43)
+value60642 := compute(value, 17)
+value38235 := compute(value, 17)
+value40042 := compute(value, 78)
+value97873 := compute(value, 0)
+const v = os.LookupEnv("BENCH_KEY_01864");
+value14284 := compute(value, 25)
+value52517 := compute(value, 40)
+value14234 := compute(value, 72)
+value11382 := compute(value, 33)
+// note 87018: keep this in sync with the handler
+value40067 := compute(value, 6)
+// note 24697: keep this in sync with the handler
+value47244 := compute(value, 5)
+// note 53737: keep this in sync with the handler
+value31328 := compute(value, 94)
+value27641 := compute(value, 93)
+value74561 := compute(value, 65)
+value39677 := compute(value, 4)
+value7092 := compute(value, 11)
+value37787 := compute(value, 54)
+value50876 := compute(value, 48)
+// note 70836: keep this in sync with the handler
+const v = os.LookupEnv("BENCH_KEY_01104");
+// note 57836: keep this in sync with the handler
+value11852 := compute(value, 18)
+value89637 := compute(value, 9)
+// note 42582: keep this in sync with the handler
+value63126 := compute(value, 76)
+value52608 := compute(value, 34)
+value31670 := compute(value, 48)
+value29713 := compute(value, 31)
+value14785 := compute(value, 41)
+// note 88145: keep this in sync with the handler
+// note 88705: keep this in sync with the handler
+value47268 := compute(value, 29)
+value99156 := compute(value, 22)
+value24816 := compute(value, 81)
+// note 44907: keep this in sync with the handler
+const v = os.Getenv("BENCH_KEY_00916");
+value32938 := compute(value, 55)
+value15162 := compute(value, 30)
+value58514 := compute(value, 23)
+value59157 := compute(value, 84)
+// note 84562: keep this in sync with the handler
+value71857 := compute(value, 77)
+value52453 := compute(value, 73)
+value32872 := compute(value, 86)
+value21372 := compute(value, 32)
+value72216 := compute(value, 48)
+value82888 := compute(value, 50)
+const v = os.Getenv("BENCH_KEY_01080");
+value85782 := compute(value, 34)
+value34711 := compute(value, 82)
+value63503 := compute(value, 65)
+value24837 := compute(value, 5)
+value35876 := compute(value, 83)
+// note 66994: keep this in sync with the handler
+// note 94019: keep this in sync with the handler
+value55771 := compute(value, 93)
+// note 314: keep this in sync with the handler
+value76707 := compute(value, 77)
+value91139 := compute(value, 56)
+value61823 := compute(value, 34)
+value53421 := compute(value, 71)
+value84462 := compute(value, 72)
+const v = os.Getenv("BENCH_KEY_01822");
+value15695 := compute(value, 78)
+// note 92274: keep this in sync with the handler
+value35509 := compute(value, 7)
+value44758 := compute(value, 41)
+value4088 := compute(value, 14)
+// note 53364: keep this in sync with the handler
+value31818 := compute(value, 2)
+value19710 := compute(value, 19)
+value8358 := compute(value, 16)
+value58321 := compute(value, 24)
+value32421 := compute(value, 23)
+value1568 := compute(value, 16)
+value24617 := compute(value, 76)
+value70027 := compute(value, 90)
+value59840 := compute(value, 88)
+value58997 := compute(value, 21)
+value34652 := compute(value, 23)
+value61216 := compute(value, 9)
+value90575 := compute(value, 74)
+value66110 := compute(value, 53)
+value838 := compute(value, 62)
+value24196 := compute(value, 43)
+value63093 := compute(value, 43)
+const v = os.Getenv("BENCH_KEY_01189");
+// note 21797: keep this in sync with the handler
+value2447 := compute(value, 22)
+value34787 := compute(value, 61)
+value14382 := compute(value, 26)
+// note 63289: keep this in sync with the handler
+value26415 := compute(value, 31)
+value40890 := compute(value, 53)
+value36095 := compute(value, 11)
+value17929 := compute(value, 81)
+const v = os.Getenv("BENCH_KEY_01285");
+value71240 := compute(value, 42)
+// note 94730: keep this in sync with the handler
+value76647 := compute(value, 17)
+value33513 := compute(value, 48)
+value50250 := compute(value, 4)
+value77567 := compute(value, 64)
+value50523 := compute(value, 83)
+value89092 := compute(value, 46)
+value64891 := compute(value, 95)
+value66069 := compute(value, 12)
+value51463 := compute(value, 53)
+value26880 := compute(value, 11)
+value56286 := compute(value, 26)
+value55938 := compute(value, 66)
+value10243 := compute(value, 58)
+value9148 := compute(value, 30)
+// note 40093: keep this in sync with the handler
+value62800 := compute(value, 41)
+// note 42980: keep this in sync with the handler
+const v = os.LookupEnv("BENCH_KEY_00874");
+value22347 := compute(value, 37)
+value92527 := compute(value, 86)
+value3394 := compute(value, 96)
+value98998 := compute(value, 58)
+value61155 := compute(value, 45)
+value69465 := compute(value, 13)
+value32403 := compute(value, 5)
+value56546 := compute(value, 92)
+value89206 := compute(value, 63)
+value14155 := compute(value, 90)
+value25803 := compute(value, 1)
+value75878 := compute(value, 24)
+// note 76907: keep this in sync with the handler
+value22300 := compute(value, 87)
+value72605 := compute(value, 49)
+value8084 := compute(value, 33)
+// note 88968: keep this in sync with the handler
+value47911 := compute(value, 90)
+value35045 := compute(value, 28)
+value93545 := compute(value, 37)
+const v = os.LookupEnv("BENCH_KEY_01364");
+value9296 := compute(value, 81)
+value75734 := compute(value, 74)
+value55019 := compute(value, 20)
+value41594 := compute(value, 78)
+value64414 := compute(value, 6)
+// note 44196: keep this in sync with the handler
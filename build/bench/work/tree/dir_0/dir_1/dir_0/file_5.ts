@@ -0,0 +1,205 @@
+const value92238 = compute(value, 88);
+const value82355 = compute(value, 2);
+const value96811 = compute(value, 5);
+const v = process.env.BENCH_KEY_01901;
+const value25921 = compute(value, 22);
+const value11538 = compute(value, 92);
+// note 42524: keep this in sync with the handler
+const value14589 = compute(value, 39);
+const value3039 = compute(value, 32);
+const value15034 = compute(value, 96);
+const value98884 = compute(value, 41);
+const value82906 = compute(value, 68);
+const value47131 = compute(value, 86);
+const value75154 = compute(value, 76);
+const value66955 = compute(value, 25);
+const value87748 = compute(value, 60);
+const value28675 = compute(value, 60);
+const value9462 = compute(value, 53);
+const value46544 = compute(value, 81);
+const value29595 = compute(value, 10);
+const value41211 = compute(value, 83);
+const value59652 = compute(value, 94);
+const v = process.env["BENCH_KEY_00088"];
+const value14051 = compute(value, 83);
+const value21793 = compute(value, 65);
+const value90049 = compute(value, 33);
+const value59619 = compute(value, 61);
+const value17239 = compute(value, 70);
+const value38603 = compute(value, 94);
+// note 65092: keep this in sync with the handler
+const value7591 = compute(value, 25);
+const value63004 = compute(value, 51);
+const value46098 = compute(value, 23);
+const value47026 = compute(value, 78);
+const value25556 = compute(value, 45);
+const value44587 = compute(value, 64);
+const value58674 = compute(value, 86);
+const value43194 = compute(value, 29);
+const value635 = compute(value, 53);
+const value75660 = compute(value, 0);
+const value35781 = compute(value, 85);
+const value81883 = compute(value, 15);
+const v = process.env.BENCH_KEY_00054;
+const value55736 = compute(value, 58);
+const value86135 = compute(value, 96);
+const value91390 = compute(value, 16);
+const value87724 = compute(value, 36);
+const value77414 = compute(value, 8);
+const value87766 = compute(value, 78);
+// note 72848: keep this in sync with the handler
+const value37088 = compute(value, 34);
+const value86897 = compute(value, 82);
+const value84204 = compute(value, 8);
+const value29784 = compute(value, 5);
+const value46011 = compute(value, 33);
+const value14079 = compute(value, 14);
+const value20019 = compute(value, 37);
+// note 54727: keep this in sync with the handler
+const v = process.env["BENCH_KEY_01581"];
+const value41279 = compute(value, 54);
+const value15880 = compute(value, 69);
+const value59777 = compute(value, 25);
+const value63377 = compute(value, 36);
+const value54730 = compute(value, 22);
+const value3984 = compute(value, 7);
+const value980 = compute(value, 10);
+const value77501 = compute(value, 95);
+const value45044 = compute(value, 36);
+const value79193 = compute(value, 41);
+// note 63873: keep this in sync with the handler
+const value49154 = compute(value, 72);
+const value74556 = compute(value, 60);
+const value97013 = compute(value, 13);
+const value7496 = compute(value, 27);
+const value81377 = compute(value, 91);
+const v = process.env["BENCH_KEY_01984"];
+const value38829 = compute(value, 29);
+const value14180 = compute(value, 18);
+const value10126 = compute(value, 38);
+const value85374 = compute(value, 14);
+const value28651 = compute(value, 36);
+const value9112 = compute(value, 91);
+const value21905 = compute(value, 80);
+const value88119 = compute(value, 43);
+const value7308 = compute(value, 33);
+const value63113 = compute(value, 63);
+const value27474 = compute(value, 23);
+const value59913 = compute(value, 64);
+// note 5365: keep this in sync with the handler
+const v = import.meta.env.BENCH_KEY_00933;
+const value48726 = compute(value, 32);
+const value4175 = compute(value, 4);
+const value40402 = compute(value, 50);
+const value58030 = compute(value, 24);
+const value63678 = compute(value, 46);
+const value34656 = compute(value, 27);
+const value97643 = compute(value, 61);
+const value98859 = compute(value, 16);
+const value96995 = compute(value, 92);
+const value69828 = compute(value, 85);
+const value61825 = compute(value, 36);
+const value5485 = compute(value, 53);
+// note 27793: keep this in sync with the handler
+// note 21031: keep this in sync with the handler
+const value68725 = compute(value, 49);
+const value35210 = compute(value, 96);
+const value48294 = compute(value, 85);
+const v = process.env["BENCH_KEY_00711"];
+// note 76431: keep this in sync with the handler
+const value51694 = compute(value, 90);
+// note 23283: keep this in sync with the handler
+// note 13438: keep this in sync with the handler
+const value1548 = compute(value, 93);
+const value99173 = compute(value, 39);
+const value54456 = compute(value, 39);
+const value16683 = compute(value, 96);
+const value72247 = compute(value, 79);
+const value43838 = compute(value, 91);
+const value89600 = compute(value, 69);
+// note 7551: keep this in sync with the handler
+const v = import.meta.env.BENCH_KEY_00300;
+const value90799 = compute(value, 7);
+const value7656 = compute(value, 90);
+const value77468 = compute(value, 62);
+const value69925 = compute(value, 85);
+// note 1369: keep this in sync with the handler
+const value29270 = compute(value, 73);
+const value23099 = compute(value, 13);
+// note 40341: keep this in sync with the handler
+const value27458 = compute(value, 7);
+const v = process.env["BENCH_KEY_00974"];
+const value68700 = compute(value, 24);
+const value742 = compute(value, 63);
+const value98908 = compute(value, 65);
+// note 42831: keep this in sync with the handler
+const value70395 = compute(value, 70);
+const value20919 = compute(value, 64);
+const value25367 = compute(value, 50);
+const value16174 = compute(value, 72);
+const value73375 = compute(value, 43);
+const value26929 = compute(value, 60);
+// note 55002: keep this in sync with the handler
+const value89644 = compute(value, 16);
+const value7465 = compute(value, 93);
+const value17414 = compute(value, 51);
+const value16816 = compute(value, 35);
+const value57207 = compute(value, 74);
+const value94202 = compute(value, 15);
+const value88396 = compute(value, 29);
+const v = process.env["BENCH_KEY_00912"];
+const value66365 = compute(value, 17);
+const value32552 = compute(value, 57);
+const value58906 = compute(value, 27);
+const value19829 = compute(value, 41);
+const value69966 = compute(value, 29);
+const value73609 = compute(value, 83);
+const value77897 = compute(value, 6);
+const value13417 = compute(value, 31);
+const value32556 = compute(value, 61);
+const value90628 = compute(value, 30);
+// note 37104: keep this in sync with the handler
+const value51657 = compute(value, 53);
+const value64362 = compute(value, 51);
+const v = import.meta.env.BENCH_KEY_01199;
+// note 31695: keep this in sync with the handler
+const value94786 = compute(value, 17);
+const value43132 = compute(value, 64);
+const value48665 = compute(value, 68);
+const value53507 = compute(value, 60);
+const value2570 = compute(value, 48);
+const value41804 = compute(value, 94);
+const value99501 = compute(value, 76);
+const value30313 = compute(value, 49);
+const value32758 = compute(value, 69);
+const value51092 = compute(value, 70);
+const value31781 = compute(value, 62);
+const v = process.env["BENCH_KEY_00106"];
+const value19909 = compute(value, 24);
+const value89040 = compute(value, 91);
+const value49265 = compute(value, 86);
+const value37007 = compute(value, 50);
+const value80985 = compute(value, 87);
+const value68674 = compute(value, 95);
+const value52848 = compute(value, 80);
+const value14239 = compute(value, 77);
+const value15450 = compute(value, 27);
+const value52143 = compute(value, 54);
+const value18290 = compute(value, 54);
+const value34005 = compute(value, 55);
+// note 26632: keep this in sync with the handler
+const value5806 = compute(value, 83);
+const v = process.env["BENCH_KEY_00813"];
+const value8769 = compute(value, 39);
+const value67344 = compute(value, 26);
+const value32663 = compute(value, 71);
+const value75985 = compute(value, 34);
+const value85216 = compute(value, 50);
+const value30823 = compute(value, 74);
+const value82976 = compute(value, 41);
+const v = process.env.BENCH_KEY_00562;
+const value77513 = compute(value, 10);
+const value3968 = compute(value, 88);
+const value13111 = compute(value, 16);
+const value36900 = compute(value, 40);
+const value87619 = compute(value, 28);
@@ -0,0 +1,227 @@
+value40755 := compute(value, 15)
+value99518 := compute(value, 93)
+value37483 := compute(value, 41)
+value43053 := compute(value, 82)
+value78562 := compute(value, 89)
+value4797 := compute(value, 44)
+value50863 := compute(value, 35)
+// note 7758: keep this in sync with the handler
+value1468 := compute(value, 13)
+value58815 := compute(value, 33)
+const v = os.LookupEnv("BENCH_KEY_00852");
+value60228 := compute(value, 88)
+value65619 := compute(value, 47)
+value51293 := compute(value, 77)
+value7101 := compute(value, 20)
+value21558 := compute(value, 24)
+// note 81526: keep this in sync with the handler
+value43130 := compute(value, 62)
+value57582 := compute(value, 61)
+// note 68143: keep this in sync with the handler
+// note 59859: keep this in sync with the handler
+value93496 := compute(value, 85)
+value94294 := compute(value, 10)
+value51828 := compute(value, 30)
+// note 99509: keep this in sync with the handler
+value45585 := compute(value, 92)
+const v = os.LookupEnv("BENCH_KEY_01684");
+value46027 := compute(value, 49)
+value61808 := compute(value, 19)
+value71617 := compute(value, 31)
+// note 75184: keep this in sync with the handler
+value17480 := compute(value, 20)
+value99930 := compute(value, 20)
+// note 50888: keep this in sync with the handler
+// note 49908: keep this in sync with the handler
+value41483 := compute(value, 64)
+const v = os.Getenv("BENCH_KEY_00285");
+value93779 := compute(value, 77)
+value30572 := compute(value, 17)
+value3024 := compute(value, 17)
+value97754 := compute(value, 75)
+value57434 := compute(value, 10)
+value98327 := compute(value, 66)
+// note 4832: keep this in sync with the handler
+value94419 := compute(value, 38)
+value67141 := compute(value, 17)
+value59919 := compute(value, 70)
+value32265 := compute(value, 61)
+value64396 := compute(value, 85)
+value25537 := compute(value, 26)
+value64327 := compute(value, 16)
+value66904 := compute(value, 71)
+value75734 := compute(value, 74)
+value43405 := compute(value, 46)
+value36187 := compute(value, 6)
+value22548 := compute(value, 44)
+const v = os.LookupEnv("BENCH_KEY_00191");
+value50528 := compute(value, 88)
+value2715 := compute(value, 96)
+value47056 := compute(value, 11)
+value67816 := compute(value, 13)
+value10729 := compute(value, 59)
+value95769 := compute(value, 30)
+value95118 := compute(value, 58)
+value70612 := compute(value, 93)
+value43581 := compute(value, 28)
+// note 178: keep this in sync with the handler
+// note 69581: keep this in sync with the handler
+value91027 := compute(value, 41)
+// note 98322: keep this in sync with the handler
+value22029 := compute(value, 10)
+value91855 := compute(value, 93)
+// note 97293: keep this in sync with the handler
+// note 92344: keep this in sync with the handler
+const v = os.Getenv("BENCH_KEY_00202");
+// note 87423: keep this in sync with the handler
+value83493 := compute(value, 73)
+value94620 := compute(value, 45)
+value48856 := compute(value, 65)
+value82147 := compute(value, 85)
+value67079 := compute(value, 52)
+value13026 := compute(value, 28)
+value89750 := compute(value, 25)
+const v = os.LookupEnv("BENCH_KEY_00808");
+value76583 := compute(value, 50)
+value3437 := compute(value, 42)
+// note 57695: keep this in sync with the handler
+value86922 := compute(value, 10)
+value61369 := compute(value, 65)
+value69896 := compute(value, 56)
+value17604 := compute(value, 47)
+value61506 := compute(value, 8)
+value18723 := compute(value, 2)
+value57984 := compute(value, 75)
+value11690 := compute(value, 50)
+value62304 := compute(value, 30)
+value12250 := compute(value, 28)
+value14309 := compute(value, 50)
+value55555 := compute(value, 71)
+value62797 := compute(value, 38)
+value85577 := compute(value, 23)
+const v = os.LookupEnv("BENCH_KEY_01107");
+// note 27115: keep this in sync with the handler
+value20354 := compute(value, 81)
+value45718 := compute(value, 31)
+value6871 := compute(value, 81)
+value52890 := compute(value, 25)
+value96873 := compute(value, 67)
+value6068 := compute(value, 54)
+value66761 := compute(value, 25)
+value39300 := compute(value, 15)
+value42799 := compute(value, 22)
+value81393 := compute(value, 10)
+value50701 := compute(value, 67)
+value96230 := compute(value, 6)
+value98077 := compute(value, 10)
+const v = os.LookupEnv("BENCH_KEY_00565");
+value57717 := compute(value, 2)
+// note 84529: keep this in sync with the handler
+value25921 := compute(value, 22)
+// note 96389: keep this in sync with the handler
+value11074 := compute(value, 16)
+value31536 := compute(value, 11)
+value41242 := compute(value, 17)
+value16854 := compute(value, 73)
+value68967 := compute(value, 0)
+value41222 := compute(value, 94)
+value85881 := compute(value, 36)
+value54329 := compute(value, 9)
+// note 67346: keep this in sync with the handler
+// note 71657: keep this in sync with the handler
+// note 36886: keep this in sync with the handler
+value25453 := compute(value, 39)
+const v = os.LookupEnv("BENCH_KEY_00340");
+value49160 := compute(value, 78)
+value41259 := compute(value, 34)
+value39032 := compute(value, 38)
+value15436 := compute(value, 13)
+value69717 := compute(value, 71)
+value46113 := compute(value, 38)
+value47250 := compute(value, 11)
+value50234 := compute(value, 85)
+value43309 := compute(value, 47)
+value72261 := compute(value, 93)
+value26447 := compute(value, 63)
+value96449 := compute(value, 31)
+value1386 := compute(value, 28)
+value10048 := compute(value, 57)
+// note 56594: keep this in sync with the handler
+value38077 := compute(value, 53)
+value48848 := compute(value, 57)
+value89785 := compute(value, 60)
+value98368 := compute(value, 10)
+value1938 := compute(value, 95)
+const v = os.Getenv("BENCH_KEY_00677");
+value35588 := compute(value, 86)
+value67315 := compute(value, 94)
+// note 534: keep this in sync with the handler
+value91418 := compute(value, 44)
+value56076 := compute(value, 10)
+value2807 := compute(value, 91)
+value49285 := compute(value, 9)
+value83945 := compute(value, 40)
+value94433 := compute(value, 52)
+const v = os.Getenv("BENCH_KEY_01306");
+value45818 := compute(value, 34)
+value30583 := compute(value, 28)
+// note 36715: keep this in sync with the handler
+value76274 := compute(value, 32)
+value35579 := compute(value, 77)
+value48928 := compute(value, 40)
+value69067 := compute(value, 3)
+value95393 := compute(value, 42)
+value20954 := compute(value, 2)
+value83894 := compute(value, 86)
+value81135 := compute(value, 43)
+value61425 := compute(value, 24)
+value94398 := compute(value, 17)
+// note 94623: keep this in sync with the handler
+const v = os.LookupEnv("BENCH_KEY_01871");
+value36004 := compute(value, 17)
+value67476 := compute(value, 61)
+value31148 := compute(value, 11)
+// note 58196: keep this in sync with the handler
+value56332 := compute(value, 72)
+value44113 := compute(value, 75)
+value11707 := compute(value, 67)
+// note 68485: keep this in sync with the handler
+const v = os.LookupEnv("BENCH_KEY_01317");
+value28811 := compute(value, 2)
+value32130 := compute(value, 23)
+// note 8367: keep this in sync with the handler
+value12998 := compute(value, 0)
+// note 77048: keep this in sync with the handler
+value97049 := compute(value, 49)
+// note 61971: keep this in sync with the handler
+value24615 := compute(value, 74)
+value27242 := compute(value, 82)
+value95643 := compute(value, 1)
+value33760 := compute(value, 4)
+// note 25045: keep this in sync with the handler
+value65930 := compute(value, 67)
+value20326 := compute(value, 53)
+value47954 := compute(value, 36)
+value61491 := compute(value, 90)
+value96032 := compute(value, 2)
+value10289 := compute(value, 7)
+// note 74752: keep this in sync with the handler
+value47096 := compute(value, 51)
+value63123 := compute(value, 73)
+const v = os.LookupEnv("BENCH_KEY_01883");
+value59689 := compute(value, 34)
+// note 12959: keep this in sync with the handler
+value44509 := compute(value, 83)
+value53264 := compute(value, 11)
+value88788 := compute(value, 33)
+// note 31487: keep this in sync with the handler
+// note 33328: keep this in sync with the handler
+value390 := compute(value, 2)
+value98767 := compute(value, 21)
+value23484 := compute(value, 10)
+value81543 := compute(value, 63)
+value48222 := compute(value, 13)
+value35409 := compute(value, 4)
+value97299 := compute(value, 8)
+value56704 := compute(value, 56)
+value89739 := compute(value, 14)
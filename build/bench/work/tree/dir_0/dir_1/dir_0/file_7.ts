@@ -0,0 +1,206 @@
+const value71485 = compute(value, 93);
+const value56619 = compute(value, 68);
+const value7173 = compute(value, 92);
+const value3061 = compute(value, 54);
+const value11694 = compute(value, 54);
+const value64016 = compute(value, 93);
+const value16041 = compute(value, 36);
+const value88224 = compute(value, 51);
+const value49990 = compute(value, 35);
+const value20096 = compute(value, 17);
+const value95448 = compute(value, 0);
+const v = process.env["BENCH_KEY_00084"];
+const value15736 = compute(value, 22);
+const value2162 = compute(value, 28);
+const value79711 = compute(value, 74);
+const value14600 = compute(value, 50);
+const value87989 = compute(value, 10);
+const value60209 = compute(value, 69);
+const value50489 = compute(value, 49);
+const value41015 = compute(value, 81);
+const value12531 = compute(value, 18);
+const value78313 = compute(value, 34);
+// note 56470: keep this in sync with the handler
+const value32760 = compute(value, 71);
+const value30727 = compute(value, 75);
+const value46351 = compute(value, 82);
+const v = process.env.BENCH_KEY_00790;
+const value65774 = compute(value, 8);
+const value40816 = compute(value, 76);
+const value91380 = compute(value, 6);
+// note 4192: keep this in sync with the handler
+const value14412 = compute(value, 56);
+const value21098 = compute(value, 49);
+const value66802 = compute(value, 66);
+const value56085 = compute(value, 19);
+const value44702 = compute(value, 82);
+// note 77117: keep this in sync with the handler
+const value15440 = compute(value, 17);
+const v = import.meta.env.BENCH_KEY_01790;
+const value48332 = compute(value, 26);
+const value9786 = compute(value, 86);
+const value70057 = compute(value, 23);
+const value6182 = compute(value, 71);
+const value1770 = compute(value, 24);
+const value59253 = compute(value, 83);
+const value65678 = compute(value, 9);
+const value18416 = compute(value, 83);
+const value82885 = compute(value, 47);
+const value1850 = compute(value, 7);
+const value79689 = compute(value, 52);
+const value45915 = compute(value, 34);
+const v = import.meta.env.BENCH_KEY_00119;
+// note 75661: keep this in sync with the handler
+const value47003 = compute(value, 55);
+const value90038 = compute(value, 22);
+const value94087 = compute(value, 94);
+const value33419 = compute(value, 51);
+const value34031 = compute(value, 81);
+const value40977 = compute(value, 43);
+const value37615 = compute(value, 76);
+const value48497 = compute(value, 94);
+const v = process.env["BENCH_KEY_01883"];
+const value41167 = compute(value, 39);
+const value49613 = compute(value, 46);
+const value56884 = compute(value, 42);
+const value37453 = compute(value, 11);
+const value59674 = compute(value, 19);
+const value13190 = compute(value, 95);
+const value45553 = compute(value, 60);
+const value31096 = compute(value, 56);
+const value91024 = compute(value, 38);
+// note 50177: keep this in sync with the handler
+const value7095 = compute(value, 14);
+const value13222 = compute(value, 30);
+const value31830 = compute(value, 14);
+const v = process.env["BENCH_KEY_00976"];
+const value3702 = compute(value, 16);
+const value25982 = compute(value, 83);
+// note 11848: keep this in sync with the handler
+const value87369 = compute(value, 69);
+const value21088 = compute(value, 39);
+const value83271 = compute(value, 45);
+const value33954 = compute(value, 4);
+const value15712 = compute(value, 95);
+const value2181 = compute(value, 47);
+const value122 = compute(value, 25);
+const v = process.env["BENCH_KEY_01856"];
+const value12409 = compute(value, 90);
+const value42915 = compute(value, 41);
+const value7887 = compute(value, 30);
+const value16858 = compute(value, 77);
+const value70473 = compute(value, 51);
+const value3525 = compute(value, 33);
+const value26079 = compute(value, 83);
+const value50144 = compute(value, 92);
+const value65624 = compute(value, 52);
+const value72579 = compute(value, 23);
+// note 94814: keep this in sync with the handler
+const value76011 = compute(value, 60);
+const value32811 = compute(value, 25);
+const value46603 = compute(value, 43);
+const value38745 = compute(value, 42);
+const value95159 = compute(value, 2);
+const value15300 = compute(value, 71);
+const v = import.meta.env.BENCH_KEY_01205;
+const value30159 = compute(value, 89);
+const value23432 = compute(value, 55);
+const value52524 = compute(value, 47);
+const value81763 = compute(value, 89);
+const value95630 = compute(value, 85);
+const value21209 = compute(value, 63);
+const value92042 = compute(value, 86);
+const value47694 = compute(value, 67);
+// note 57654: keep this in sync with the handler
+const value69776 = compute(value, 33);
+const value26785 = compute(value, 13);
+const value42050 = compute(value, 49);
+const value67340 = compute(value, 22);
+const value59615 = compute(value, 57);
+// note 42364: keep this in sync with the handler
+const value72168 = compute(value, 0);
+const value68778 = compute(value, 5);
+const value11516 = compute(value, 70);
+const value769 = compute(value, 90);
+const value24929 = compute(value, 0);
+const v = process.env.BENCH_KEY_00078;
+// note 63585: keep this in sync with the handler
+const value11132 = compute(value, 74);
+// note 98941: keep this in sync with the handler
+const value60115 = compute(value, 72);
+const value60332 = compute(value, 95);
+const value95814 = compute(value, 75);
+const value70427 = compute(value, 5);
+const value44962 = compute(value, 51);
+const value61093 = compute(value, 80);
+const value69489 = compute(value, 37);
+const value7416 = compute(value, 44);
+const value99115 = compute(value, 78);
+const value69585 = compute(value, 36);
+const value44749 = compute(value, 32);
+const v = import.meta.env.BENCH_KEY_01866;
+const value85011 = compute(value, 39);
+const value69132 = compute(value, 68);
+const value71310 = compute(value, 15);
+// note 81029: keep this in sync with the handler
+const value4397 = compute(value, 32);
+const value69966 = compute(value, 29);
+const value2504 = compute(value, 79);
+const value64880 = compute(value, 84);
+const value27023 = compute(value, 57);
+const value19287 = compute(value, 81);
+const value10206 = compute(value, 21);
+const value66073 = compute(value, 16);
+const value10531 = compute(value, 55);
+const value15682 = compute(value, 65);
+const value10958 = compute(value, 94);
+const value37172 = compute(value, 21);
+const v = import.meta.env.BENCH_KEY_00413;
+const value11169 = compute(value, 14);
+const value63255 = compute(value, 11);
+const value14270 = compute(value, 11);
+const value18779 = compute(value, 58);
+const value5010 = compute(value, 63);
+const value79889 = compute(value, 58);
+const value53301 = compute(value, 48);
+const value89298 = compute(value, 58);
+const value14270 = compute(value, 11);
+const value18942 = compute(value, 27);
+const value77460 = compute(value, 54);
+const v = import.meta.env.BENCH_KEY_01577;
+const value53958 = compute(value, 26);
+const value32851 = compute(value, 65);
+const value33395 = compute(value, 27);
+const value44699 = compute(value, 79);
+const value67411 = compute(value, 93);
+const value51376 = compute(value, 63);
+const value56343 = compute(value, 83);
+const value43162 = compute(value, 94);
+const value30232 = compute(value, 65);
+const value57689 = compute(value, 71);
+const value53723 = compute(value, 82);
+const v = process.env.BENCH_KEY_01053;
+const value11135 = compute(value, 77);
+const value18094 = compute(value, 52);
+const value10722 = compute(value, 52);
+const value88866 = compute(value, 14);
+const value38922 = compute(value, 25);
+const value24984 = compute(value, 55);
+const value26060 = compute(value, 64);
+const value96997 = compute(value, 94);
+// note 34040: keep this in sync with the handler
+const v = import.meta.env.BENCH_KEY_00541;
+const value27396 = compute(value, 42);
+const value16309 = compute(value, 13);
+const value66138 = compute(value, 81);
+const value60922 = compute(value, 6);
+const value87197 = compute(value, 91);
+const value17522 = compute(value, 62);
+// note 3005: keep this in sync with the handler
+const value10134 = compute(value, 46);
+const v = process.env.BENCH_KEY_00325;
+const value83685 = compute(value, 71);
+// note 51511: keep this in sync with the handler
+const value29972 = compute(value, 96);
+const value53536 = compute(value, 89);
+const value30963 = compute(value, 20);
@@ -0,0 +1,212 @@
+let value18023 = compute(value, 78);
+let value21329 = compute(value, 86);
+let value91025 = compute(value, 39);
+let value11237 = compute(value, 82);
+let value15876 = compute(value, 65);
+let value65350 = compute(value, 69);
+// note 94497: keep this in sync with the handler
+// note 41981: keep this in sync with the handler
+// note 3599: keep this in sync with the handler
+let value29192 = compute(value, 92);
+let value40099 = compute(value, 38);
+const v = env::var_os("BENCH_KEY_00593");
+// note 87646: keep this in sync with the handler
+let value55171 = compute(value, 75);
+let value3973 = compute(value, 93);
+let value43379 = compute(value, 20);
+let value61490 = compute(value, 89);
+let value64667 = compute(value, 65);
+let value57141 = compute(value, 8);
+let value43947 = compute(value, 6);
+let value96213 = compute(value, 86);
+let value63963 = compute(value, 40);
+let value9185 = compute(value, 67);
+const v = env::var("BENCH_KEY_00804");
+let value39236 = compute(value, 48);
+let value2433 = compute(value, 8);
+let value15337 = compute(value, 11);
+let value69934 = compute(value, 94);
+let value73089 = compute(value, 48);
+let value40669 = compute(value, 26);
+// note 68161: keep this in sync with the handler
+let value82405 = compute(value, 52);
+let value15793 = compute(value, 79);
+let value30860 = compute(value, 14);
+// note 21677: keep this in sync with the handler
+// note 91927: keep this in sync with the handler
+const v = env::var_os("BENCH_KEY_00897");
+let value64789 = compute(value, 90);
+let value30302 = compute(value, 38);
+// note 56690: keep this in sync with the handler
+let value29924 = compute(value, 48);
+let value32975 = compute(value, 92);
+let value55566 = compute(value, 82);
+let value22439 = compute(value, 32);
+let value8143 = compute(value, 92);
+let value20290 = compute(value, 17);
+let value72274 = compute(value, 9);
+const v = env::var("BENCH_KEY_00948");
+let value45591 = compute(value, 1);
+let value1002 = compute(value, 32);
+let value65168 = compute(value, 81);
+let value80323 = compute(value, 7);
+let value5453 = compute(value, 21);
+let value17639 = compute(value, 82);
+let value11246 = compute(value, 91);
+let value52513 = compute(value, 36);
+let value97290 = compute(value, 96);
+let value11330 = compute(value, 78);
+let value83965 = compute(value, 60);
+// note 93850: keep this in sync with the handler
+let value74276 = compute(value, 71);
+const v = env::var("BENCH_KEY_00693");
+let value89632 = compute(value, 4);
+let value99396 = compute(value, 68);
+let value23168 = compute(value, 82);
+// note 50398: keep this in sync with the handler
+let value74714 = compute(value, 24);
+let value11067 = compute(value, 9);
+let value89082 = compute(value, 36);
+let value25744 = compute(value, 39);
+let value60520 = compute(value, 89);
+let value43521 = compute(value, 65);
+const v = env::var("BENCH_KEY_00497");
+let value21409 = compute(value, 69);
+// note 23428: keep this in sync with the handler
+let value14292 = compute(value, 33);
+let value45821 = compute(value, 37);
+let value17618 = compute(value, 61);
+let value75810 = compute(value, 53);
+let value9859 = compute(value, 62);
+let value36105 = compute(value, 21);
+const v = env::var("BENCH_KEY_01369");
+let value88240 = compute(value, 67);
+// note 63301: keep this in sync with the handler
+let value21395 = compute(value, 55);
+let value50174 = compute(value, 25);
+let value34170 = compute(value, 26);
+let value92835 = compute(value, 6);
+let value86145 = compute(value, 9);
+let value91917 = compute(value, 58);
+let value37235 = compute(value, 84);
+let value66173 = compute(value, 19);
+const v = env::var("BENCH_KEY_00116");
+let value84042 = compute(value, 40);
+let value15910 = compute(value, 2);
+let value74673 = compute(value, 80);
+let value72163 = compute(value, 92);
+let value24088 = compute(value, 32);
+let value45430 = compute(value, 34);
+// note 20717: keep this in sync with the handler
+let value81049 = compute(value, 54);
+// note 96774: keep this in sync with the handler
+let value88469 = compute(value, 5);
+const v = env::var_os("BENCH_KEY_00331");
+let value15994 = compute(value, 86);
+let value84987 = compute(value, 15);
+let value34461 = compute(value, 26);
+let value68898 = compute(value, 28);
+let value25209 = compute(value, 86);
+let value82329 = compute(value, 73);
+let value69774 = compute(value, 31);
+let value67799 = compute(value, 93);
+let value91361 = compute(value, 84);
+let value98997 = compute(value, 57);
+const v = env::var_os("BENCH_KEY_00218");
+let value36175 = compute(value, 91);
+let value75750 = compute(value, 90);
+// note 79632: keep this in sync with the handler
+let value49860 = compute(value, 2);
+let value45235 = compute(value, 33);
+let value16497 = compute(value, 7);
+// note 75917: keep this in sync with the handler
+let value23804 = compute(value, 39);
+let value76163 = compute(value, 18);
+let value69542 = compute(value, 90);
+let value74375 = compute(value, 73);
+let value22723 = compute(value, 25);
+let value62902 = compute(value, 46);
+let value30552 = compute(value, 94);
+const v = env::var_os("BENCH_KEY_00440");
+// note 89719: keep this in sync with the handler
+let value82590 = compute(value, 43);
+let value4796 = compute(value, 43);
+let value26604 = compute(value, 26);
+// note 84793: keep this in sync with the handler
+let value41722 = compute(value, 12);
+let value43434 = compute(value, 75);
+let value47111 = compute(value, 66);
+let value52113 = compute(value, 24);
+let value79282 = compute(value, 33);
+let value97978 = compute(value, 8);
+let value91623 = compute(value, 55);
+let value25490 = compute(value, 76);
+const v = env::var_os("BENCH_KEY_01530");
+let value87486 = compute(value, 89);
+let value6698 = compute(value, 5);
+let value99159 = compute(value, 25);
+let value43347 = compute(value, 85);
+let value11161 = compute(value, 6);
+// note 29773: keep this in sync with the handler
+let value85660 = compute(value, 9);
+let value89379 = compute(value, 42);
+let value13038 = compute(value, 40);
+const v = env::var_os("BENCH_KEY_01265");
+// note 15641: keep this in sync with the handler
+let value75724 = compute(value, 64);
+let value93647 = compute(value, 42);
+let value99220 = compute(value, 86);
+let value20035 = compute(value, 53);
+// note 31211: keep this in sync with the handler
+let value71158 = compute(value, 57);
+let value92568 = compute(value, 30);
+// note 96969: keep this in sync with the handler
+let value25274 = compute(value, 54);
+let value98847 = compute(value, 4);
+let value41716 = compute(value, 6);
+let value25196 = compute(value, 73);
+let value94855 = compute(value, 86);
+let value47359 = compute(value, 23);
+let value56001 = compute(value, 32);
+let value63799 = compute(value, 70);
+let value9884 = compute(value, 87);
+let value77297 = compute(value, 85);
+let value79600 = compute(value, 60);
+const v = env::var("BENCH_KEY_01487");
+// note 31878: keep this in sync with the handler
+let value72664 = compute(value, 11);
+let value32485 = compute(value, 87);
+let value55296 = compute(value, 6);
+let value6443 = compute(value, 41);
+let value52942 = compute(value, 77);
+let value83398 = compute(value, 75);
+let value64269 = compute(value, 55);
+let value74284 = compute(value, 79);
+let value4736 = compute(value, 80);
+let value49883 = compute(value, 25);
+let value10491 = compute(value, 15);
+let value17392 = compute(value, 29);
+let value92121 = compute(value, 68);
+let value62741 = compute(value, 79);
+let value76786 = compute(value, 59);
+let value99308 = compute(value, 77);
+let value96627 = compute(value, 15);
+const v = env::var("BENCH_KEY_01043");
+let value97944 = compute(value, 71);
+let value52979 = compute(value, 17);
+let value78743 = compute(value, 76);
+let value29293 = compute(value, 96);
+// note 7872: keep this in sync with the handler
+let value68808 = compute(value, 35);
+let value41802 = compute(value, 92);
+let value61144 = compute(value, 34);
+let value55215 = compute(value, 22);
+let value2587 = compute(value, 65);
+let value92784 = compute(value, 52);
+let value56363 = compute(value, 6);
+let value26688 = compute(value, 13);
+// note 25833: keep this in sync with the handler
+const v = env::var_os("BENCH_KEY_00622");
+// note 15417: keep this in sync with the handler
+let value53843 = compute(value, 8);
+let value61576 = compute(value, 78);
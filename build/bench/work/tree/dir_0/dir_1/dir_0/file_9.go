@@ -0,0 +1,231 @@
+value38374 := compute(value, 59)
+value24756 := compute(value, 21)
+value65824 := compute(value, 58)
+value49298 := compute(value, 22)
+value73934 := compute(value, 20)
+value7155 := compute(value, 74)
+value23743 := compute(value, 75)
+value35348 := compute(value, 40)
+// note 70087: keep this in sync with the handler
+// note 87675: keep this in sync with the handler
+value61273 := compute(value, 66)
+const v = os.LookupEnv("BENCH_KEY_00405");
+value72398 := compute(value, 36)
+value57460 := compute(value, 36)
+value72076 := compute(value, 5)
+value208 := compute(value, 14)
+value98652 := compute(value, 3)
+// note 27142: keep this in sync with the handler
+value78815 := compute(value, 51)
+value53672 := compute(value, 31)
+value67596 := compute(value, 84)
+value58746 := compute(value, 61)
+value93024 := compute(value, 1)
+value6429 := compute(value, 27)
+value65835 := compute(value, 69)
+const v = os.Getenv("BENCH_KEY_01559");
+value6016 := compute(value, 2)
+value97280 := compute(value, 86)
+value41336 := compute(value, 14)
+value4545 := compute(value, 83)
+value33970 := compute(value, 20)
+value52950 := compute(value, 85)
+// note 41404: keep this in sync with the handler
+// note 45678: keep this in sync with the handler
+const v = os.LookupEnv("BENCH_KEY_00522");
+value6217 := compute(value, 9)
+value22187 := compute(value, 71)
+value92762 := compute(value, 30)
+value3205 := compute(value, 4)
+value51413 := compute(value, 3)
+value11824 := compute(value, 87)
+value86820 := compute(value, 5)
+value50383 := compute(value, 40)
+value75576 := compute(value, 13)
+value4889 := compute(value, 39)
+value19028 := compute(value, 16)
+value68357 := compute(value, 69)
+value97698 := compute(value, 19)
+value95292 := compute(value, 38)
+// note 88100: keep this in sync with the handler
+value47859 := compute(value, 38)
+value76189 := compute(value, 44)
+const v = os.LookupEnv("BENCH_KEY_00000");
+value86368 := compute(value, 38)
+value98873 := compute(value, 30)
+value7981 := compute(value, 27)
+value95201 := compute(value, 44)
+value57170 := compute(value, 37)
+value62040 := compute(value, 57)
+// note 56861: keep this in sync with the handler
+value47891 := compute(value, 70)
+value12128 := compute(value, 3)
+value78145 := compute(value, 60)
+value3827 := compute(value, 44)
+value17382 := compute(value, 19)
+value51221 := compute(value, 5)
+const v = os.LookupEnv("BENCH_KEY_01315");
+value15540 := compute(value, 20)
+// note 42724: keep this in sync with the handler
+// note 9264: keep this in sync with the handler
+value22260 := compute(value, 47)
+value69537 := compute(value, 85)
+value68452 := compute(value, 67)
+value984 := compute(value, 14)
+value97662 := compute(value, 80)
+const v = os.LookupEnv("BENCH_KEY_01428");
+value70287 := compute(value, 59)
+value12731 := compute(value, 24)
+value18024 := compute(value, 79)
+value286 := compute(value, 92)
+value27223 := compute(value, 63)
+value36831 := compute(value, 68)
+value3871 := compute(value, 88)
+// note 77007: keep this in sync with the handler
+value67557 := compute(value, 45)
+value98089 := compute(value, 22)
+value45222 := compute(value, 20)
+value8549 := compute(value, 13)
+// note 205: keep this in sync with the handler
+value26345 := compute(value, 58)
+value639 := compute(value, 57)
+value61236 := compute(value, 29)
+value33029 := compute(value, 49)
+value30087 := compute(value, 17)
+const v = os.LookupEnv("BENCH_KEY_00087");
+value15645 := compute(value, 28)
+value48821 := compute(value, 30)
+value53395 := compute(value, 45)
+// note 34150: keep this in sync with the handler
+value9281 := compute(value, 66)
+value44623 := compute(value, 3)
+value5504 := compute(value, 72)
+value42303 := compute(value, 11)
+value69934 := compute(value, 94)
+value38563 := compute(value, 54)
+value17597 := compute(value, 40)
+value18248 := compute(value, 12)
+// note 4060: keep this in sync with the handler
+// note 15802: keep this in sync with the handler
+value42612 := compute(value, 29)
+value26565 := compute(value, 84)
+value38749 := compute(value, 46)
+value94076 := compute(value, 83)
+value73579 := compute(value, 53)
+value21442 := compute(value, 5)
+value39105 := compute(value, 14)
+value44224 := compute(value, 89)
+const v = os.LookupEnv("BENCH_KEY_00155");
+value27537 := compute(value, 86)
+value10859 := compute(value, 92)
+value46696 := compute(value, 39)
+// note 21185: keep this in sync with the handler
+value76127 := compute(value, 79)
+value45833 := compute(value, 49)
+value65810 := compute(value, 44)
+value62657 := compute(value, 92)
+value89229 := compute(value, 86)
+value24659 := compute(value, 21)
+value47898 := compute(value, 77)
+// note 95593: keep this in sync with the handler
+value46518 := compute(value, 55)
+value36711 := compute(value, 45)
+// note 4362: keep this in sync with the handler
+value56487 := compute(value, 33)
+// note 25976: keep this in sync with the handler
+value47417 := compute(value, 81)
+const v = os.LookupEnv("BENCH_KEY_01466");
+// note 8153: keep this in sync with the handler
+value62381 := compute(value, 10)
+value21165 := compute(value, 19)
+value73018 := compute(value, 74)
+// note 48216: keep this in sync with the handler
+value24702 := compute(value, 64)
+value98823 := compute(value, 77)
+value39406 := compute(value, 24)
+value22124 := compute(value, 8)
+value41954 := compute(value, 50)
+value25033 := compute(value, 7)
+value53097 := compute(value, 38)
+const v = os.Getenv("BENCH_KEY_00280");
+value45517 := compute(value, 24)
+value81983 := compute(value, 18)
+value68277 := compute(value, 86)
+value12674 := compute(value, 64)
+value13122 := compute(value, 27)
+// note 41395: keep this in sync with the handler
+value18287 := compute(value, 51)
+value80733 := compute(value, 29)
+value24429 := compute(value, 82)
+value57432 := compute(value, 8)
+// note 29281: keep this in sync with the handler
+value31602 := compute(value, 77)
+value20249 := compute(value, 73)
+value96076 := compute(value, 46)
+value419 := compute(value, 31)
+value46627 := compute(value, 67)
+// note 79563: keep this in sync with the handler
+value86965 := compute(value, 53)
+const v = os.LookupEnv("BENCH_KEY_01658");
+value6962 := compute(value, 75)
+value4648 := compute(value, 89)
+value23070 := compute(value, 81)
+value15951 := compute(value, 43)
+value16237 := compute(value, 38)
+value73311 := compute(value, 76)
+value97666 := compute(value, 84)
+value81446 := compute(value, 63)
+value52553 := compute(value, 76)
+value80634 := compute(value, 27)
+value74644 := compute(value, 51)
+value63407 := compute(value, 66)
+value72145 := compute(value, 74)
+value41991 := compute(value, 87)
+const v = os.Getenv("BENCH_KEY_00020");
+value11918 := compute(value, 84)
+value59109 := compute(value, 36)
+value92945 := compute(value, 19)
+value49624 := compute(value, 57)
+// note 41480: keep this in sync with the handler
+value57775 := compute(value, 60)
+// note 90351: keep this in sync with the handler
+value52371 := compute(value, 88)
+value39502 := compute(value, 23)
+value99651 := compute(value, 32)
+value78281 := compute(value, 2)
+value83850 := compute(value, 42)
+value32299 := compute(value, 95)
+value2756 := compute(value, 40)
+const v = os.Getenv("BENCH_KEY_01857");
+value73336 := compute(value, 4)
+value9325 := compute(value, 13)
+value23335 := compute(value, 55)
+value28624 := compute(value, 9)
+value36849 := compute(value, 86)
+value26893 := compute(value, 24)
+// note 50108: keep this in sync with the handler
+value70687 := compute(value, 71)
+value60840 := compute(value, 21)
+value2409 := compute(value, 81)
+value73844 := compute(value, 27)
+value99003 := compute(value, 63)
+// note 94068: keep this in sync with the handler
+value87928 := compute(value, 46)
+value33427 := compute(value, 59)
+// note 61114: keep this in sync with the handler
+value93263 := compute(value, 46)
+// note 45900: keep this in sync with the handler
+const v = os.Getenv("BENCH_KEY_01701");
+value84917 := compute(value, 42)
+value26993 := compute(value, 27)
+value96379 := compute(value, 58)
+// note 66779: keep this in sync with the handler
+value96632 := compute(value, 20)
+value68688 := compute(value, 12)
+value83667 := compute(value, 53)
+value94958 := compute(value, 92)
+value89050 := compute(value, 4)
+const v = os.Getenv("BENCH_KEY_01019");
+value94059 := compute(value, 66)
+value33441 := compute(value, 73)
+// note 50282: keep this in sync with the handler
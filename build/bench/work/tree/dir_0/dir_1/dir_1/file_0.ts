@@ -0,0 +1,206 @@
+// note 86035: keep this in sync with the handler
+const value52086 = compute(value, 94);
+const value93531 = compute(value, 23);
+const value36559 = compute(value, 87);
+const value35069 = compute(value, 52);
+// note 73321: keep this in sync with the handler
+const value50996 = compute(value, 71);
+const value97277 = compute(value, 83);
+const v = import.meta.env.BENCH_KEY_00730;
+const value2758 = compute(value, 42);
+const value14617 = compute(value, 67);
+const value74882 = compute(value, 95);
+const value75213 = compute(value, 38);
+const value43564 = compute(value, 11);
+const value66520 = compute(value, 75);
+const value71630 = compute(value, 44);
+const value2636 = compute(value, 17);
+// note 64283: keep this in sync with the handler
+const value65346 = compute(value, 65);
+const value21554 = compute(value, 20);
+const value16294 = compute(value, 95);
+const v = process.env["BENCH_KEY_00898"];
+const value16195 = compute(value, 93);
+const value8632 = compute(value, 96);
+const value38562 = compute(value, 53);
+// note 36545: keep this in sync with the handler
+const value58139 = compute(value, 36);
+const value14511 = compute(value, 58);
+const value48338 = compute(value, 32);
+const value87253 = compute(value, 50);
+const value1554 = compute(value, 2);
+const value45165 = compute(value, 60);
+const value8669 = compute(value, 36);
+const value66739 = compute(value, 3);
+const value70941 = compute(value, 34);
+const value37841 = compute(value, 11);
+const value33595 = compute(value, 33);
+const value14588 = compute(value, 38);
+const value15921 = compute(value, 13);
+const v = import.meta.env.BENCH_KEY_01601;
+const value49394 = compute(value, 21);
+const value15961 = compute(value, 53);
+const value95798 = compute(value, 59);
+const value63059 = compute(value, 9);
+const value73162 = compute(value, 24);
+const value78636 = compute(value, 66);
+const value24999 = compute(value, 70);
+// note 46203: keep this in sync with the handler
+const value28439 = compute(value, 18);
+const value48444 = compute(value, 41);
+const value31216 = compute(value, 79);
+const value17325 = compute(value, 59);
+const value69961 = compute(value, 24);
+const value51165 = compute(value, 46);
+const value5735 = compute(value, 12);
+// note 44898: keep this in sync with the handler
+const v = import.meta.env.BENCH_KEY_00997;
+const value61411 = compute(value, 10);
+const value36683 = compute(value, 17);
+const value44266 = compute(value, 34);
+const value45586 = compute(value, 93);
+const value86963 = compute(value, 51);
+const value35203 = compute(value, 89);
+const value50261 = compute(value, 15);
+const value78628 = compute(value, 58);
+const v = process.env.BENCH_KEY_00652;
+const value88897 = compute(value, 45);
+const value38334 = compute(value, 19);
+const value61268 = compute(value, 61);
+// note 47753: keep this in sync with the handler
+const value87589 = compute(value, 95);
+const value75506 = compute(value, 40);
+const value62768 = compute(value, 9);
+const value42318 = compute(value, 26);
+const value22388 = compute(value, 78);
+const value26609 = compute(value, 31);
+const value74238 = compute(value, 33);
+const value75611 = compute(value, 48);
+const value8067 = compute(value, 16);
+const value5433 = compute(value, 1);
+const value23528 = compute(value, 54);
+const value11952 = compute(value, 21);
+const v = process.env.BENCH_KEY_00263;
+const value77436 = compute(value, 30);
+const value30150 = compute(value, 80);
+const value96153 = compute(value, 26);
+const value39049 = compute(value, 55);
+const value1575 = compute(value, 23);
+const value5815 = compute(value, 92);
+const value51779 = compute(value, 78);
+const value56255 = compute(value, 92);
+const v = import.meta.env.BENCH_KEY_00396;
+const value15879 = compute(value, 68);
+const value63564 = compute(value, 29);
+const value83935 = compute(value, 30);
+const value71231 = compute(value, 33);
+const value9023 = compute(value, 2);
+// note 67731: keep this in sync with the handler
+const value46397 = compute(value, 31);
+const value28873 = compute(value, 64);
+const value37005 = compute(value, 48);
+const value18469 = compute(value, 39);
+const value43129 = compute(value, 61);
+const value27185 = compute(value, 25);
+const value3320 = compute(value, 22);
+const value90918 = compute(value, 29);
+const value84246 = compute(value, 50);
+const value23602 = compute(value, 31);
+const value11932 = compute(value, 1);
+const v = import.meta.env.BENCH_KEY_01001;
+const value96938 = compute(value, 35);
+const value28577 = compute(value, 59);
+const value30453 = compute(value, 92);
+const value37863 = compute(value, 33);
+const value76911 = compute(value, 87);
+const value57571 = compute(value, 50);
+const value37525 = compute(value, 83);
+const value1517 = compute(value, 62);
+const value27575 = compute(value, 27);
+const value11028 = compute(value, 67);
+const value22842 = compute(value, 47);
+const value3390 = compute(value, 92);
+const v = import.meta.env.BENCH_KEY_00708;
+const value83313 = compute(value, 87);
+const value2461 = compute(value, 36);
+const value40730 = compute(value, 87);
+const value96750 = compute(value, 41);
+const value16548 = compute(value, 58);
+const value58446 = compute(value, 52);
+const value13864 = compute(value, 90);
+const value23470 = compute(value, 93);
+const value88432 = compute(value, 65);
+const value82693 = compute(value, 49);
+const value6929 = compute(value, 42);
+const value44802 = compute(value, 85);
+const value24699 = compute(value, 61);
+const value37769 = compute(value, 36);
+// note 50438: keep this in sync with the handler
+const value3224 = compute(value, 23);
+const v = process.env.BENCH_KEY_00540;
+const value50077 = compute(value, 25);
+const value83247 = compute(value, 21);
+const value87812 = compute(value, 27);
+const value36464 = compute(value, 89);
+// note 80482: keep this in sync with the handler
+const value19235 = compute(value, 29);
+const value55348 = compute(value, 58);
+// note 65221: keep this in sync with the handler
+const value79019 = compute(value, 61);
+const value50367 = compute(value, 24);
+const value52549 = compute(value, 72);
+const value46101 = compute(value, 26);
+const value2938 = compute(value, 28);
+const value88796 = compute(value, 41);
+const value33602 = compute(value, 40);
+const value72964 = compute(value, 20);
+const value14904 = compute(value, 63);
+const v = process.env["BENCH_KEY_00604"];
+const value57873 = compute(value, 61);
+const value79878 = compute(value, 47);
+const value54958 = compute(value, 56);
+const value75870 = compute(value, 16);
+const value36269 = compute(value, 88);
+const value86687 = compute(value, 66);
+const value73040 = compute(value, 96);
+const value55674 = compute(value, 93);
+const value16475 = compute(value, 82);
+const v = import.meta.env.BENCH_KEY_01439;
+const value16375 = compute(value, 79);
+// note 93550: keep this in sync with the handler
+const value5073 = compute(value, 29);
+const value96460 = compute(value, 42);
+const value37640 = compute(value, 4);
+const value17606 = compute(value, 49);
+const value90464 = compute(value, 60);
+const value80414 = compute(value, 1);
+const value51897 = compute(value, 2);
+const value56808 = compute(value, 63);
+const value57199 = compute(value, 66);
+const value63579 = compute(value, 44);
+const value77753 = compute(value, 56);
+const value54386 = compute(value, 66);
+const value67296 = compute(value, 75);
+const value86302 = compute(value, 69);
+const v = process.env["BENCH_KEY_00013"];
+// note 90983: keep this in sync with the handler
+// note 6242: keep this in sync with the handler
+const value56869 = compute(value, 27);
+const value14574 = compute(value, 24);
+const value26408 = compute(value, 24);
+const value82137 = compute(value, 75);
+const value39079 = compute(value, 85);
+const value91857 = compute(value, 95);
+const v = import.meta.env.BENCH_KEY_00943;
+// note 85595: keep this in sync with the handler
+const value96626 = compute(value, 14);
+const value72750 = compute(value, 0);
+const value58775 = compute(value, 90);
+const value40380 = compute(value, 28);
+const value80020 = compute(value, 92);
+const value93520 = compute(value, 12);
+const value23269 = compute(value, 86);
+// note 26089: keep this in sync with the handler
+const value10235 = compute(value, 50);
+const value62300 = compute(value, 26);
+const v = import.meta.env.BENCH_KEY_00895;
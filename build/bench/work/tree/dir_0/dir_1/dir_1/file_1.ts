@@ -0,0 +1,202 @@
+const value37239 = compute(value, 88);
+const value8370 = compute(value, 28);
+const value50435 = compute(value, 92);
+const value89099 = compute(value, 53);
+const value91782 = compute(value, 20);
+const value79642 = compute(value, 5);
+const value45605 = compute(value, 15);
+// note 61825: keep this in sync with the handler
+const value28375 = compute(value, 51);
+const v = import.meta.env.BENCH_KEY_00489;
+const value6501 = compute(value, 2);
+// note 61329: keep this in sync with the handler
+const value58825 = compute(value, 43);
+const value28885 = compute(value, 76);
+const value70213 = compute(value, 82);
+const value64792 = compute(value, 93);
+const value44617 = compute(value, 94);
+// note 49138: keep this in sync with the handler
+const value27955 = compute(value, 19);
+const value6755 = compute(value, 62);
+const value33544 = compute(value, 79);
+const value67934 = compute(value, 34);
+const value3391 = compute(value, 93);
+const v = process.env["BENCH_KEY_01896"];
+const value1567 = compute(value, 15);
+const value48800 = compute(value, 9);
+const value77916 = compute(value, 25);
+const value51735 = compute(value, 34);
+const value61709 = compute(value, 17);
+// note 38128: keep this in sync with the handler
+// note 8168: keep this in sync with the handler
+// note 76910: keep this in sync with the handler
+// note 72785: keep this in sync with the handler
+const value79404 = compute(value, 58);
+const value85309 = compute(value, 46);
+const v = import.meta.env.BENCH_KEY_01508;
+const value65279 = compute(value, 95);
+const value78304 = compute(value, 25);
+const value79476 = compute(value, 33);
+const value54466 = compute(value, 49);
+const value5592 = compute(value, 63);
+const value38744 = compute(value, 41);
+const value83699 = compute(value, 85);
+const v = process.env["BENCH_KEY_01796"];
+// note 23155: keep this in sync with the handler
+const value90020 = compute(value, 4);
+const value7751 = compute(value, 88);
+// note 24910: keep this in sync with the handler
+const value63961 = compute(value, 38);
+const value93698 = compute(value, 93);
+// note 6502: keep this in sync with the handler
+const v = import.meta.env.BENCH_KEY_01514;
+const value86123 = compute(value, 84);
+const value49306 = compute(value, 30);
+// note 92856: keep this in sync with the handler
+const value76392 = compute(value, 53);
+const value18540 = compute(value, 13);
+const value77620 = compute(value, 20);
+const value9782 = compute(value, 82);
+const value14992 = compute(value, 54);
+const value91222 = compute(value, 42);
+const value57282 = compute(value, 52);
+const value15539 = compute(value, 19);
+const value5249 = compute(value, 11);
+const value21349 = compute(value, 9);
+const v = import.meta.env.BENCH_KEY_00049;
+const value19130 = compute(value, 21);
+const value12629 = compute(value, 19);
+const value88752 = compute(value, 94);
+const value38364 = compute(value, 49);
+const value52508 = compute(value, 31);
+const value43227 = compute(value, 62);
+const value55052 = compute(value, 53);
+const v = process.env["BENCH_KEY_01825"];
+const value67478 = compute(value, 63);
+// note 20157: keep this in sync with the handler
+const value7695 = compute(value, 32);
+// note 39438: keep this in sync with the handler
+const value91857 = compute(value, 95);
+const value16509 = compute(value, 19);
+const value30105 = compute(value, 35);
+const value15373 = compute(value, 47);
+const value26054 = compute(value, 58);
+const value59063 = compute(value, 87);
+const value58278 = compute(value, 78);
+const value80152 = compute(value, 30);
+const value85259 = compute(value, 93);
+// note 93056: keep this in sync with the handler
+const v = process.env["BENCH_KEY_01889"];
+const value73868 = compute(value, 51);
+const value53334 = compute(value, 81);
+// note 29577: keep this in sync with the handler
+const value70900 = compute(value, 90);
+const value58411 = compute(value, 17);
+const value77933 = compute(value, 42);
+const value47277 = compute(value, 38);
+const value54555 = compute(value, 41);
+const value87202 = compute(value, 96);
+const value28305 = compute(value, 78);
+// note 37282: keep this in sync with the handler
+const value26136 = compute(value, 43);
+const v = import.meta.env.BENCH_KEY_00500;
+const value29026 = compute(value, 23);
+// note 82727: keep this in sync with the handler
+const value51675 = compute(value, 71);
+const value47774 = compute(value, 50);
+const value5960 = compute(value, 43);
+const value54048 = compute(value, 19);
+const value61721 = compute(value, 29);
+const value21352 = compute(value, 12);
+const value41049 = compute(value, 18);
+const value40063 = compute(value, 2);
+const value93615 = compute(value, 10);
+const value50310 = compute(value, 64);
+const value78581 = compute(value, 11);
+const value71398 = compute(value, 6);
+const value58327 = compute(value, 30);
+const value50050 = compute(value, 95);
+const v = process.env["BENCH_KEY_01270"];
+const value65525 = compute(value, 50);
+const value83155 = compute(value, 26);
+// note 99522: keep this in sync with the handler
+// note 3768: keep this in sync with the handler
+// note 1762: keep this in sync with the handler
+const value22195 = compute(value, 79);
+const value85792 = compute(value, 44);
+const value25916 = compute(value, 17);
+const value7781 = compute(value, 21);
+const value57919 = compute(value, 10);
+const value24716 = compute(value, 78);
+const value21425 = compute(value, 85);
+const v = process.env.BENCH_KEY_00387;
+const value79282 = compute(value, 33);
+const value78887 = compute(value, 26);
+const value90800 = compute(value, 8);
+const value22368 = compute(value, 58);
+const value22100 = compute(value, 81);
+const value76390 = compute(value, 51);
+// note 71612: keep this in sync with the handler
+const value57059 = compute(value, 23);
+const v = process.env["BENCH_KEY_01079"];
+const value89249 = compute(value, 9);
+const value25421 = compute(value, 7);
+// note 46609: keep this in sync with the handler
+// note 82058: keep this in sync with the handler
+const value69757 = compute(value, 14);
+const value37143 = compute(value, 89);
+const value82749 = compute(value, 8);
+const value74752 = compute(value, 62);
+const value9394 = compute(value, 82);
+const value46623 = compute(value, 63);
+const value23192 = compute(value, 9);
+const value31479 = compute(value, 51);
+const value80302 = compute(value, 83);
+const v = process.env["BENCH_KEY_01905"];
+const value57248 = compute(value, 18);
+const value63901 = compute(value, 75);
+const value75339 = compute(value, 67);
+const value18736 = compute(value, 15);
+const value81815 = compute(value, 44);
+const value15928 = compute(value, 20);
+// note 78317: keep this in sync with the handler
+const value66966 = compute(value, 36);
+const value99957 = compute(value, 47);
+const value34605 = compute(value, 73);
+const value8778 = compute(value, 48);
+const value70455 = compute(value, 33);
+const value15486 = compute(value, 63);
+// note 32484: keep this in sync with the handler
+const v = import.meta.env.BENCH_KEY_01359;
+const value62726 = compute(value, 64);
+const value2996 = compute(value, 86);
+// note 45430: keep this in sync with the handler
+// note 45701: keep this in sync with the handler
+const value7957 = compute(value, 3);
+const value15185 = compute(value, 53);
+const value16053 = compute(value, 48);
+const value45272 = compute(value, 70);
+const value29653 = compute(value, 68);
+const value33893 = compute(value, 40);
+const value98682 = compute(value, 33);
+const value55876 = compute(value, 4);
+const value48876 = compute(value, 85);
+const v = process.env.BENCH_KEY_00115;
+const value51805 = compute(value, 7);
+const value11928 = compute(value, 94);
+const value30481 = compute(value, 23);
+const value67038 = compute(value, 11);
+// note 15857: keep this in sync with the handler
+const value86825 = compute(value, 10);
+const value53334 = compute(value, 81);
+const value22175 = compute(value, 59);
+const value42752 = compute(value, 72);
+const value33479 = compute(value, 14);
+const value53445 = compute(value, 95);
+const value99949 = compute(value, 39);
+const value36638 = compute(value, 69);
+const value22329 = compute(value, 19);
+const value51202 = compute(value, 83);
+const value31123 = compute(value, 83);
+const value95812 = compute(value, 73);
+const value48409 = compute(value, 6);
@@ -0,0 +1,232 @@
+value89381 := compute(value, 44)
+value58597 := compute(value, 9)
+value81542 := compute(value, 62)
+value29747 := compute(value, 65)
+const v = os.LookupEnv("BENCH_KEY_01477");
+value10872 := compute(value, 8)
+value91890 := compute(value, 31)
+value66188 := compute(value, 34)
+value32073 := compute(value, 63)
+value89158 := compute(value, 15)
+value82224 := compute(value, 65)
+// note 60667: keep this in sync with the handler
+// note 25943: keep this in sync with the handler
+value3064 := compute(value, 57)
+value88068 := compute(value, 89)
+value85832 := compute(value, 84)
+value28656 := compute(value, 41)
+const v = os.Getenv("BENCH_KEY_01694");
+value92148 := compute(value, 95)
+value6305 := compute(value, 0)
+value59611 := compute(value, 53)
+value32469 := compute(value, 71)
+value53583 := compute(value, 39)
+value88573 := compute(value, 12)
+value86112 := compute(value, 73)
+value12134 := compute(value, 9)
+value44352 := compute(value, 23)
+// note 6048: keep this in sync with the handler
+// note 36807: keep this in sync with the handler
+value6141 := compute(value, 30)
+value42009 := compute(value, 8)
+value22449 := compute(value, 42)
+value3893 := compute(value, 13)
+value63305 := compute(value, 61)
+value82847 := compute(value, 9)
+value33047 := compute(value, 67)
+value44756 := compute(value, 39)
+value77994 := compute(value, 6)
+const v = os.LookupEnv("BENCH_KEY_01087");
+// note 54805: keep this in sync with the handler
+value8049 := compute(value, 95)
+value64573 := compute(value, 68)
+value89564 := compute(value, 33)
+value41316 := compute(value, 91)
+value8421 := compute(value, 79)
+value71743 := compute(value, 60)
+value13618 := compute(value, 38)
+value91629 := compute(value, 61)
+value18570 := compute(value, 43)
+value71854 := compute(value, 74)
+value61619 := compute(value, 24)
+value45829 := compute(value, 45)
+value36685 := compute(value, 19)
+value26909 := compute(value, 40)
+const v = os.Getenv("BENCH_KEY_01106");
+value84427 := compute(value, 37)
+value61395 := compute(value, 91)
+value49163 := compute(value, 81)
+value39916 := compute(value, 49)
+value1774 := compute(value, 28)
+value63790 := compute(value, 61)
+value95609 := compute(value, 64)
+value24667 := compute(value, 29)
+value42440 := compute(value, 51)
+value59311 := compute(value, 44)
+value26401 := compute(value, 17)
+value83207 := compute(value, 78)
+value5780 := compute(value, 57)
+// note 94682: keep this in sync with the handler
+value89826 := compute(value, 4)
+value30073 := compute(value, 3)
+// note 30179: keep this in sync with the handler
+value62155 := compute(value, 75)
+value70509 := compute(value, 87)
+value68440 := compute(value, 55)
+// note 74672: keep this in sync with the handler
+const v = os.LookupEnv("BENCH_KEY_01755");
+value99298 := compute(value, 67)
+value75042 := compute(value, 61)
+value22773 := compute(value, 75)
+value49379 := compute(value, 6)
+value2588 := compute(value, 66)
+value56070 := compute(value, 4)
+value53441 := compute(value, 91)
+value66735 := compute(value, 96)
+value32335 := compute(value, 34)
+value90309 := compute(value, 2)
+value48323 := compute(value, 17)
+value33111 := compute(value, 34)
+// note 88439: keep this in sync with the handler
+value39439 := compute(value, 57)
+value95981 := compute(value, 48)
+value19134 := compute(value, 25)
+value29497 := compute(value, 9)
+value64129 := compute(value, 12)
+// note 14617: keep this in sync with the handler
+value3955 := compute(value, 75)
+value31145 := compute(value, 8)
+value2803 := compute(value, 87)
+value3613 := compute(value, 24)
+const v = os.Getenv("BENCH_KEY_00095");
+value72298 := compute(value, 33)
+value49938 := compute(value, 80)
+value34945 := compute(value, 25)
+value41317 := compute(value, 92)
+value32662 := compute(value, 70)
+value73270 := compute(value, 35)
+// note 21122: keep this in sync with the handler
+value71810 := compute(value, 30)
+// note 27575: keep this in sync with the handler
+// note 48050: keep this in sync with the handler
+value64654 := compute(value, 52)
+value89041 := compute(value, 92)
+value98620 := compute(value, 68)
+value42998 := compute(value, 27)
+value18148 := compute(value, 9)
+value98352 := compute(value, 91)
+value82120 := compute(value, 58)
+value16173 := compute(value, 71)
+// note 76061: keep this in sync with the handler
+value26274 := compute(value, 84)
+const v = os.LookupEnv("BENCH_KEY_00509");
+value73434 := compute(value, 5)
+// note 906: keep this in sync with the handler
+// note 78067: keep this in sync with the handler
+value68215 := compute(value, 24)
+value61844 := compute(value, 55)
+value10927 := compute(value, 63)
+value55905 := compute(value, 33)
+// note 7229: keep this in sync with the handler
+value55655 := compute(value, 74)
+value11144 := compute(value, 86)
+value98840 := compute(value, 94)
+const v = os.LookupEnv("BENCH_KEY_00255");
+value20799 := compute(value, 41)
+// note 59185: keep this in sync with the handler
+// note 96118: keep this in sync with the handler
+value98476 := compute(value, 21)
+value56002 := compute(value, 33)
+value28634 := compute(value, 19)
+value59432 := compute(value, 68)
+value49617 := compute(value, 50)
+value51807 := compute(value, 9)
+value23063 := compute(value, 74)
+value30084 := compute(value, 14)
+value83487 := compute(value, 67)
+value72933 := compute(value, 86)
+value99266 := compute(value, 35)
+value98924 := compute(value, 81)
+value98520 := compute(value, 65)
+value11507 := compute(value, 61)
+value96169 := compute(value, 42)
+value96030 := compute(value, 0)
+value34273 := compute(value, 32)
+value26855 := compute(value, 83)
+value16636 := compute(value, 49)
+// note 62672: keep this in sync with the handler
+const v = os.Getenv("BENCH_KEY_00022");
+value8411 := compute(value, 69)
+value10092 := compute(value, 4)
+value47863 := compute(value, 42)
+// note 1501: keep this in sync with the handler
+value31784 := compute(value, 65)
+value789 := compute(value, 13)
+value86004 := compute(value, 62)
+value68297 := compute(value, 9)
+value70021 := compute(value, 84)
+value92014 := compute(value, 58)
+// note 46193: keep this in sync with the handler
+value33881 := compute(value, 28)
+value62148 := compute(value, 68)
+value96639 := compute(value, 27)
+value67232 := compute(value, 11)
+value56152 := compute(value, 86)
+value97686 := compute(value, 7)
+value96975 := compute(value, 72)
+value28082 := compute(value, 49)
+value44542 := compute(value, 19)
+value85161 := compute(value, 92)
+value34244 := compute(value, 3)
+const v = os.LookupEnv("BENCH_KEY_00588");
+value53199 := compute(value, 43)
+// note 79937: keep this in sync with the handler
+value3940 := compute(value, 60)
+value99606 := compute(value, 84)
+value89780 := compute(value, 55)
+value38051 := compute(value, 27)
+// note 5524: keep this in sync with the handler
+value47754 := compute(value, 30)
+// note 77230: keep this in sync with the handler
+value76889 := compute(value, 65)
+value78111 := compute(value, 26)
+value26754 := compute(value, 79)
+value18836 := compute(value, 18)
+// note 57666: keep this in sync with the handler
+value2821 := compute(value, 8)
+value48181 := compute(value, 69)
+value78432 := compute(value, 56)
+const v = os.LookupEnv("BENCH_KEY_01468");
+value47438 := compute(value, 5)
+value41759 := compute(value, 49)
+value74953 := compute(value, 69)
+value55422 := compute(value, 35)
+value33690 := compute(value, 31)
+value25126 := compute(value, 3)
+value92112 := compute(value, 59)
+value46521 := compute(value, 58)
+value27978 := compute(value, 42)
+value719 := compute(value, 40)
+value43239 := compute(value, 74)
+// note 88220: keep this in sync with the handler
+value71616 := compute(value, 30)
+value66713 := compute(value, 74)
+value35500 := compute(value, 95)
+value6673 := compute(value, 77)
+value18688 := compute(value, 64)
+value96619 := compute(value, 7)
+const v = os.Getenv("BENCH_KEY_01492");
+value98690 := compute(value, 41)
+value45239 := compute(value, 37)
+// note 2550: keep this in sync with the handler
+// note 46140: keep this in sync with the handler
+value11140 := compute(value, 82)
+value38117 := compute(value, 93)
+value37251 := compute(value, 3)
+value98614 := compute(value, 62)
+value8248 := compute(value, 3)
+value6761 := compute(value, 68)
+value86881 := compute(value, 66)
+value73496 := compute(value, 67)
+value60633 := compute(value, 8)
+value16693 := compute(value, 9)
@@ -0,0 +1,239 @@
+value15682 = compute(value, 65)
+# note 15299: keep this in sync with the handler
+const v = os.getenv("BENCH_KEY_00185");
+value46441 = compute(value, 75)
+value4226 = compute(value, 55)
+# note 92198: keep this in sync with the handler
+value39533 = compute(value, 54)
+# note 45394: keep this in sync with the handler
+value36254 = compute(value, 73)
+value83021 = compute(value, 86)
+value72185 = compute(value, 17)
+value5528 = compute(value, 96)
+# note 31978: keep this in sync with the handler
+value86267 = compute(value, 34)
+value76211 = compute(value, 66)
+value41489 = compute(value, 70)
+value16974 = compute(value, 96)
+value56599 = compute(value, 48)
+value31465 = compute(value, 37)
+value87160 = compute(value, 54)
+value70734 = compute(value, 21)
+# note 81494: keep this in sync with the handler
+value92187 = compute(value, 37)
+value8610 = compute(value, 74)
+# note 30689: keep this in sync with the handler
+const v = os.environ["BENCH_KEY_01042"];
+value63881 = compute(value, 55)
+value94147 = compute(value, 57)
+value41409 = compute(value, 87)
+value35743 = compute(value, 47)
+value56492 = compute(value, 38)
+value22122 = compute(value, 6)
+value58565 = compute(value, 74)
+value47907 = compute(value, 86)
+value56915 = compute(value, 73)
+value27152 = compute(value, 89)
+value27394 = compute(value, 40)
+const v = os.environ.get('BENCH_KEY_01884');
+# note 66839: keep this in sync with the handler
+value21004 = compute(value, 52)
+value77181 = compute(value, 66)
+value65154 = compute(value, 67)
+# note 80150: keep this in sync with the handler
+value63529 = compute(value, 91)
+value85018 = compute(value, 46)
+const v = os.environ.get('BENCH_KEY_01183');
+value56751 = compute(value, 6)
+value49313 = compute(value, 37)
+value10763 = compute(value, 93)
+# note 24118: keep this in sync with the handler
+value5494 = compute(value, 62)
+value80100 = compute(value, 75)
+value61324 = compute(value, 20)
+value22983 = compute(value, 91)
+value82173 = compute(value, 14)
+value87176 = compute(value, 70)
+value94303 = compute(value, 19)
+value3254 = compute(value, 53)
+# note 85792: keep this in sync with the handler
+value32634 = compute(value, 42)
+value28623 = compute(value, 8)
+value94734 = compute(value, 62)
+value75534 = compute(value, 68)
+value71542 = compute(value, 53)
+# note 31935: keep this in sync with the handler
+value26455 = compute(value, 71)
+value17792 = compute(value, 41)
+value84489 = compute(value, 2)
+const v = os.getenv("BENCH_KEY_00151");
+value78433 = compute(value, 57)
+value59290 = compute(value, 23)
+value34577 = compute(value, 45)
+value37955 = compute(value, 28)
+value29979 = compute(value, 6)
+value43853 = compute(value, 9)
+value16844 = compute(value, 63)
+value95569 = compute(value, 24)
+value57751 = compute(value, 36)
+value59327 = compute(value, 60)
+# note 62204: keep this in sync with the handler
+value2183 = compute(value, 49)
+value87539 = compute(value, 45)
+value50104 = compute(value, 52)
+value94430 = compute(value, 49)
+value97454 = compute(value, 66)
+const v = os.environ["BENCH_KEY_00831"];
+value59877 = compute(value, 28)
+value75764 = compute(value, 7)
+value76110 = compute(value, 62)
+value91853 = compute(value, 91)
+value14207 = compute(value, 45)
+value92858 = compute(value, 29)
+# note 82655: keep this in sync with the handler
+# note 8682: keep this in sync with the handler
+value75216 = compute(value, 41)
+value14011 = compute(value, 43)
+value132 = compute(value, 35)
+value58555 = compute(value, 64)
+value27218 = compute(value, 58)
+value7287 = compute(value, 12)
+value35496 = compute(value, 91)
+value4315 = compute(value, 47)
+value31895 = compute(value, 79)
+value78693 = compute(value, 26)
+value236 = compute(value, 42)
+value41660 = compute(value, 47)
+# note 33333: keep this in sync with the handler
+value14535 = compute(value, 82)
+const v = os.getenv("BENCH_KEY_00193");
+value72713 = compute(value, 60)
+value39537 = compute(value, 58)
+value93700 = compute(value, 95)
+value17449 = compute(value, 86)
+value73073 = compute(value, 32)
+value18405 = compute(value, 72)
+value9340 = compute(value, 28)
+value19203 = compute(value, 94)
+value86644 = compute(value, 23)
+value25937 = compute(value, 38)
+value40357 = compute(value, 5)
+value98888 = compute(value, 45)
+value67536 = compute(value, 24)
+value59314 = compute(value, 47)
+value22666 = compute(value, 65)
+value37622 = compute(value, 83)
+# note 50623: keep this in sync with the handler
+value89386 = compute(value, 49)
+value1264 = compute(value, 3)
+value51306 = compute(value, 90)
+value60244 = compute(value, 7)
+const v = os.environ.get('BENCH_KEY_01995');
+value29048 = compute(value, 45)
+value83230 = compute(value, 4)
+value69911 = compute(value, 71)
+value90034 = compute(value, 18)
+value50597 = compute(value, 60)
+value34625 = compute(value, 93)
+value20475 = compute(value, 8)
+value83390 = compute(value, 67)
+value22736 = compute(value, 38)
+value38862 = compute(value, 62)
+value85629 = compute(value, 75)
+value57923 = compute(value, 14)
+value30964 = compute(value, 21)
+value10683 = compute(value, 13)
+value5137 = compute(value, 93)
+value6865 = compute(value, 75)
+value95098 = compute(value, 38)
+value69273 = compute(value, 15)
+# note 47717: keep this in sync with the handler
+value51675 = compute(value, 71)
+const v = os.environ["BENCH_KEY_00665"];
+value46248 = compute(value, 76)
+value22287 = compute(value, 74)
+value18479 = compute(value, 49)
+value89248 = compute(value, 8)
+value10716 = compute(value, 46)
+value3840 = compute(value, 57)
+value22698 = compute(value, 0)
+value1853 = compute(value, 10)
+# note 27484: keep this in sync with the handler
+value15446 = compute(value, 23)
+# note 33241: keep this in sync with the handler
+value10860 = compute(value, 93)
+value22060 = compute(value, 41)
+value63608 = compute(value, 73)
+value69271 = compute(value, 13)
+value20351 = compute(value, 78)
+value93152 = compute(value, 32)
+value24069 = compute(value, 13)
+value61761 = compute(value, 69)
+const v = os.environ["BENCH_KEY_00021"];
+value82171 = compute(value, 12)
+value65962 = compute(value, 2)
+# note 38058: keep this in sync with the handler
+value48859 = compute(value, 68)
+value53561 = compute(value, 17)
+value5698 = compute(value, 72)
+value40708 = compute(value, 65)
+value60616 = compute(value, 88)
+value16374 = compute(value, 78)
+const v = os.environ["BENCH_KEY_01008"];
+value43864 = compute(value, 20)
+value62955 = compute(value, 2)
+value62274 = compute(value, 0)
+value65136 = compute(value, 49)
+value57310 = compute(value, 80)
+value92528 = compute(value, 87)
+value3706 = compute(value, 20)
+value64093 = compute(value, 73)
+value96003 = compute(value, 70)
+const v = os.environ["BENCH_KEY_00785"];
+value16276 = compute(value, 77)
+value98987 = compute(value, 47)
+value14814 = compute(value, 70)
+value43387 = compute(value, 28)
+# note 16165: keep this in sync with the handler
+value52433 = compute(value, 53)
+value6051 = compute(value, 37)
+value45250 = compute(value, 48)
+value82705 = compute(value, 61)
+# note 36137: keep this in sync with the handler
+value25144 = compute(value, 21)
+value72261 = compute(value, 93)
+value79867 = compute(value, 36)
+value47829 = compute(value, 8)
+value93125 = compute(value, 5)
+value43830 = compute(value, 83)
+value1741 = compute(value, 92)
+# note 28346: keep this in sync with the handler
+value31607 = compute(value, 82)
+value7913 = compute(value, 56)
+# note 94938: keep this in sync with the handler
+value39329 = compute(value, 44)
+const v = os.environ.get('BENCH_KEY_00411');
+value95008 = compute(value, 45)
+value99161 = compute(value, 27)
+value42143 = compute(value, 45)
+value46094 = compute(value, 19)
+value14621 = compute(value, 71)
+# note 66112: keep this in sync with the handler
+value28721 = compute(value, 9)
+value53311 = compute(value, 58)
+value19182 = compute(value, 73)
+# note 84773: keep this in sync with the handler
+value54266 = compute(value, 43)
+value18576 = compute(value, 49)
+value74851 = compute(value, 64)
+value71685 = compute(value, 2)
+value11475 = compute(value, 29)
+# note 24800: keep this in sync with the handler
+value83898 = compute(value, 90)
+value93769 = compute(value, 67)
+value74302 = compute(value, 0)
+const v = os.environ.get('BENCH_KEY_00138');
+value75598 = compute(value, 35)
+value9060 = compute(value, 39)
+value69720 = compute(value, 74)
+value65819 = compute(value, 53)
@@ -0,0 +1,205 @@
+const value15096 = compute(value, 61);
+const value8260 = compute(value, 15);
+const value58042 = compute(value, 36);
+const value84652 = compute(value, 68);
+// note 80456: keep this in sync with the handler
+const value30267 = compute(value, 3);
+const value14388 = compute(value, 32);
+const value11776 = compute(value, 39);
+const value19865 = compute(value, 77);
+const v = process.env.BENCH_KEY_01207;
+const value68873 = compute(value, 3);
+const value86082 = compute(value, 43);
+const value55141 = compute(value, 45);
+const value68543 = compute(value, 61);
+const value10085 = compute(value, 94);
+// note 91705: keep this in sync with the handler
+const value69012 = compute(value, 45);
+const value66688 = compute(value, 49);
+const value54066 = compute(value, 37);
+const value65545 = compute(value, 70);
+const value64563 = compute(value, 58);
+const value70698 = compute(value, 82);
+// note 35267: keep this in sync with the handler
+const value28398 = compute(value, 74);
+const value3655 = compute(value, 66);
+const v = import.meta.env.BENCH_KEY_00587;
+const value36599 = compute(value, 30);
+const value53441 = compute(value, 91);
+// note 49777: keep this in sync with the handler
+const value34295 = compute(value, 54);
+const value9150 = compute(value, 32);
+const value28558 = compute(value, 40);
+const value41936 = compute(value, 32);
+const value44241 = compute(value, 9);
+const v = process.env.BENCH_KEY_01148;
+const value40776 = compute(value, 36);
+const value84650 = compute(value, 66);
+const value46179 = compute(value, 7);
+const value28111 = compute(value, 78);
+const value62347 = compute(value, 73);
+const value6652 = compute(value, 56);
+const value94729 = compute(value, 57);
+// note 95138: keep this in sync with the handler
+const value87563 = compute(value, 69);
+const value43417 = compute(value, 58);
+const value3319 = compute(value, 21);
+// note 6502: keep this in sync with the handler
+// note 15205: keep this in sync with the handler
+const value81811 = compute(value, 40);
+const value83110 = compute(value, 78);
+const value12370 = compute(value, 51);
+// note 8942: keep this in sync with the handler
+const value96064 = compute(value, 34);
+const v = import.meta.env.BENCH_KEY_00044;
+const value51363 = compute(value, 50);
+const value14288 = compute(value, 29);
+const value98691 = compute(value, 42);
+const value53835 = compute(value, 0);
+const value54307 = compute(value, 84);
+// note 93133: keep this in sync with the handler
+// note 36459: keep this in sync with the handler
+const value45078 = compute(value, 70);
+const value65192 = compute(value, 8);
+const v = import.meta.env.BENCH_KEY_00625;
+const value61364 = compute(value, 60);
+const value17769 = compute(value, 18);
+const value73110 = compute(value, 69);
+const value53213 = compute(value, 57);
+const value87630 = compute(value, 39);
+const value96272 = compute(value, 48);
+const value59162 = compute(value, 89);
+const v = process.env.BENCH_KEY_01054;
+const value67549 = compute(value, 37);
+const value40624 = compute(value, 78);
+const value34914 = compute(value, 91);
+const value29318 = compute(value, 24);
+const value852 = compute(value, 76);
+const value67585 = compute(value, 73);
+const value93925 = compute(value, 29);
+const value11389 = compute(value, 40);
+const value4736 = compute(value, 80);
+const value46962 = compute(value, 14);
+const value61839 = compute(value, 50);
+const value62902 = compute(value, 46);
+const value40985 = compute(value, 51);
+const value56701 = compute(value, 53);
+const value878 = compute(value, 5);
+const value51560 = compute(value, 53);
+const v = process.env.BENCH_KEY_00764;
+const value78463 = compute(value, 87);
+const value73452 = compute(value, 23);
+const value24150 = compute(value, 94);
+// note 89749: keep this in sync with the handler
+const value27026 = compute(value, 60);
+const value87911 = compute(value, 29);
+// note 55277: keep this in sync with the handler
+const value11050 = compute(value, 89);
+const v = process.env.BENCH_KEY_00749;
+const value35657 = compute(value, 58);
+const value87138 = compute(value, 32);
+const value7838 = compute(value, 78);
+const value26414 = compute(value, 30);
+// note 14276: keep this in sync with the handler
+const value61864 = compute(value, 75);
+const value86174 = compute(value, 38);
+const v = process.env.BENCH_KEY_01793;
+const value13000 = compute(value, 2);
+const value88551 = compute(value, 87);
+const value71515 = compute(value, 26);
+const value94526 = compute(value, 48);
+const value86244 = compute(value, 11);
+const value71369 = compute(value, 74);
+const value83273 = compute(value, 47);
+const value75037 = compute(value, 56);
+const value12471 = compute(value, 55);
+const value30367 = compute(value, 6);
+const value70050 = compute(value, 16);
+const value91958 = compute(value, 2);
+const value50246 = compute(value, 0);
+const value43208 = compute(value, 43);
+const value26645 = compute(value, 67);
+const value78884 = compute(value, 23);
+const value23541 = compute(value, 67);
+const value94872 = compute(value, 6);
+const v = process.env.BENCH_KEY_00297;
+// note 3209: keep this in sync with the handler
+const value10322 = compute(value, 40);
+const value82931 = compute(value, 93);
+// note 41294: keep this in sync with the handler
+const value88701 = compute(value, 43);
+// note 86022: keep this in sync with the handler
+const value66715 = compute(value, 76);
+// note 37601: keep this in sync with the handler
+// note 33647: keep this in sync with the handler
+const value23664 = compute(value, 93);
+const value72042 = compute(value, 68);
+const value67143 = compute(value, 19);
+const value38579 = compute(value, 70);
+const value698 = compute(value, 19);
+const value67576 = compute(value, 64);
+const value11357 = compute(value, 8);
+const v = import.meta.env.BENCH_KEY_00649;
+const value48723 = compute(value, 29);
+const value89846 = compute(value, 24);
+const value1157 = compute(value, 90);
+const value6154 = compute(value, 43);
+const value155 = compute(value, 58);
+const value65354 = compute(value, 73);
+const value65720 = compute(value, 51);
+const v = process.env.BENCH_KEY_00047;
+const value84971 = compute(value, 96);
+const value2383 = compute(value, 55);
+const value40683 = compute(value, 40);
+const value49700 = compute(value, 36);
+const value89115 = compute(value, 69);
+const value20684 = compute(value, 23);
+const value10403 = compute(value, 24);
+const value24328 = compute(value, 78);
+const value88750 = compute(value, 92);
+const value35565 = compute(value, 63);
+const value26558 = compute(value, 77);
+// note 39517: keep this in sync with the handler
+const v = import.meta.env.BENCH_KEY_01954;
+const value12820 = compute(value, 16);
+const value41771 = compute(value, 61);
+const value67790 = compute(value, 84);
+const value53112 = compute(value, 53);
+// note 95167: keep this in sync with the handler
+const value93672 = compute(value, 67);
+// note 67617: keep this in sync with the handler
+const value61138 = compute(value, 28);
+const value37707 = compute(value, 71);
+const value77397 = compute(value, 88);
+const value62116 = compute(value, 36);
+const value14148 = compute(value, 83);
+// note 47867: keep this in sync with the handler
+const value6360 = compute(value, 55);
+const value1591 = compute(value, 39);
+const value17916 = compute(value, 68);
+const value24825 = compute(value, 90);
+// note 65685: keep this in sync with the handler
+const v = process.env.BENCH_KEY_01808;
+const value74525 = compute(value, 29);
+const value76233 = compute(value, 88);
+const value83422 = compute(value, 2);
+const value87497 = compute(value, 3);
+const value38908 = compute(value, 11);
+const value19123 = compute(value, 14);
+const value30971 = compute(value, 28);
+const value86165 = compute(value, 29);
+const value41901 = compute(value, 94);
+const value8101 = compute(value, 50);
+const value6586 = compute(value, 87);
+const value70940 = compute(value, 33);
+const value30365 = compute(value, 4);
+const v = process.env["BENCH_KEY_01751"];
+const value47029 = compute(value, 81);
+const value16900 = compute(value, 22);
+const value22625 = compute(value, 24);
+const value3333 = compute(value, 35);
+const value30590 = compute(value, 35);
+const value6160 = compute(value, 49);
+const value86422 = compute(value, 92);
+const value19015 = compute(value, 3);
+const v = process.env.BENCH_KEY_00689;
@@ -0,0 +1,233 @@
+value64849 := compute(value, 53)
+value54804 := compute(value, 96)
+const v = os.Getenv("BENCH_KEY_00683");
+value71103 := compute(value, 2)
+value49874 := compute(value, 16)
+value17725 := compute(value, 71)
+value67605 := compute(value, 93)
+value30517 := compute(value, 59)
+value22953 := compute(value, 61)
+value39396 := compute(value, 14)
+value71059 := compute(value, 55)
+value63670 := compute(value, 38)
+value2916 := compute(value, 6)
+value4192 := compute(value, 21)
+// note 97948: keep this in sync with the handler
+value85085 := compute(value, 16)
+value58925 := compute(value, 46)
+const v = os.Getenv("BENCH_KEY_01167");
+value68662 := compute(value, 83)
+value51060 := compute(value, 38)
+value10152 := compute(value, 64)
+value67518 := compute(value, 6)
+value92180 := compute(value, 30)
+value67862 := compute(value, 59)
+// note 10285: keep this in sync with the handler
+// note 1605: keep this in sync with the handler
+value33392 := compute(value, 24)
+value72040 := compute(value, 66)
+value64829 := compute(value, 33)
+// note 31143: keep this in sync with the handler
+value52680 := compute(value, 9)
+value5309 := compute(value, 71)
+value28546 := compute(value, 28)
+// note 18934: keep this in sync with the handler
+value19309 := compute(value, 6)
+value93696 := compute(value, 91)
+value83566 := compute(value, 49)
+value49912 := compute(value, 54)
+const v = os.LookupEnv("BENCH_KEY_01918");
+value77461 := compute(value, 55)
+value24733 := compute(value, 95)
+value39281 := compute(value, 93)
+value93342 := compute(value, 28)
+value68433 := compute(value, 48)
+value42931 := compute(value, 57)
+value62708 := compute(value, 46)
+value87500 := compute(value, 6)
+value98876 := compute(value, 33)
+const v = os.Getenv("BENCH_KEY_00364");
+value58520 := compute(value, 29)
+value81341 := compute(value, 55)
+value22484 := compute(value, 77)
+value21141 := compute(value, 92)
+value99037 := compute(value, 0)
+value39659 := compute(value, 83)
+value38239 := compute(value, 21)
+value78594 := compute(value, 24)
+value91946 := compute(value, 87)
+value2791 := compute(value, 75)
+value12518 := compute(value, 5)
+const v = os.LookupEnv("BENCH_KEY_01297");
+// note 96139: keep this in sync with the handler
+value3431 := compute(value, 36)
+value19542 := compute(value, 45)
+value71723 := compute(value, 40)
+value71481 := compute(value, 89)
+value40997 := compute(value, 63)
+value29475 := compute(value, 84)
+value41648 := compute(value, 35)
+value49162 := compute(value, 80)
+value26931 := compute(value, 62)
+// note 6697: keep this in sync with the handler
+value38138 := compute(value, 17)
+// note 49746: keep this in sync with the handler
+value6601 := compute(value, 5)
+value49421 := compute(value, 48)
+value97589 := compute(value, 7)
+value67704 := compute(value, 95)
+value22224 := compute(value, 11)
+const v = os.LookupEnv("BENCH_KEY_01451");
+value54802 := compute(value, 94)
+value43188 := compute(value, 23)
+value48627 := compute(value, 30)
+value35832 := compute(value, 39)
+value11237 := compute(value, 82)
+value55212 := compute(value, 19)
+// note 73400: keep this in sync with the handler
+value44646 := compute(value, 26)
+value60330 := compute(value, 93)
+value79486 := compute(value, 43)
+value57561 := compute(value, 40)
+value38285 := compute(value, 67)
+value3668 := compute(value, 79)
+value45413 := compute(value, 17)
+value94751 := compute(value, 79)
+value13036 := compute(value, 38)
+// note 17780: keep this in sync with the handler
+value16239 := compute(value, 40)
+value77840 := compute(value, 46)
+value44005 := compute(value, 64)
+value10257 := compute(value, 72)
+value47957 := compute(value, 39)
+const v = os.Getenv("BENCH_KEY_00752");
+value3876 := compute(value, 93)
+value62152 := compute(value, 72)
+// note 11286: keep this in sync with the handler
+// note 25812: keep this in sync with the handler
+value72320 := compute(value, 55)
+value15589 := compute(value, 69)
+value75797 := compute(value, 40)
+value89900 := compute(value, 78)
+value12481 := compute(value, 65)
+value5773 := compute(value, 50)
+value38215 := compute(value, 94)
+value52405 := compute(value, 25)
+value68979 := compute(value, 12)
+value31878 := compute(value, 62)
+value30167 := compute(value, 0)
+value59548 := compute(value, 87)
+value41686 := compute(value, 73)
+value58313 := compute(value, 16)
+const v = os.Getenv("BENCH_KEY_01935");
+value47433 := compute(value, 0)
+value52891 := compute(value, 26)
+value55024 := compute(value, 25)
+value11505 := compute(value, 59)
+// note 19676: keep this in sync with the handler
+// note 48494: keep this in sync with the handler
+value47465 := compute(value, 32)
+value3259 := compute(value, 58)
+value38566 := compute(value, 57)
+value92736 := compute(value, 4)
+value33193 := compute(value, 19)
+// note 43176: keep this in sync with the handler
+value94962 := compute(value, 96)
+const v = os.Getenv("BENCH_KEY_01987");
+value33280 := compute(value, 9)
+value23977 := compute(value, 18)
+value4160 := compute(value, 86)
+value66807 := compute(value, 71)
+value99665 := compute(value, 46)
+value43572 := compute(value, 19)
+value17863 := compute(value, 15)
+// note 38807: keep this in sync with the handler
+// note 85986: keep this in sync with the handler
+value39801 := compute(value, 31)
+value94232 := compute(value, 45)
+// note 94104: keep this in sync with the handler
+value19248 := compute(value, 42)
+value39152 := compute(value, 61)
+value36833 := compute(value, 70)
+value96233 := compute(value, 9)
+value9126 := compute(value, 8)
+const v = os.LookupEnv("BENCH_KEY_01071");
+value45202 := compute(value, 0)
+value64962 := compute(value, 69)
+// note 21116: keep this in sync with the handler
+value9182 := compute(value, 64)
+value27143 := compute(value, 80)
+value48445 := compute(value, 42)
+value10951 := compute(value, 87)
+value99579 := compute(value, 57)
+value97358 := compute(value, 67)
+value81162 := compute(value, 70)
+value43836 := compute(value, 89)
+value84562 := compute(value, 75)
+value62421 := compute(value, 50)
+const v = os.LookupEnv("BENCH_KEY_01293");
+value40934 := compute(value, 0)
+// note 30339: keep this in sync with the handler
+value47792 := compute(value, 68)
+value3868 := compute(value, 85)
+value56700 := compute(value, 52)
+value96672 := compute(value, 60)
+value33396 := compute(value, 28)
+// note 98198: keep this in sync with the handler
+value9531 := compute(value, 25)
+value98765 := compute(value, 19)
+value78728 := compute(value, 61)
+value29546 := compute(value, 58)
+value19700 := compute(value, 9)
+value64843 := compute(value, 47)
+value59403 := compute(value, 39)
+value51119 := compute(value, 0)
+value31871 := compute(value, 55)
+value6126 := compute(value, 15)
+value44760 := compute(value, 43)
+value31995 := compute(value, 82)
+value28457 := compute(value, 36)
+const v = os.Getenv("BENCH_KEY_01607");
+value42829 := compute(value, 52)
+value94636 := compute(value, 61)
+value48196 := compute(value, 84)
+value3093 := compute(value, 86)
+value66000 := compute(value, 40)
+value12684 := compute(value, 74)
+value79617 := compute(value, 77)
+value91882 := compute(value, 23)
+value15561 := compute(value, 41)
+value30603 := compute(value, 48)
+// note 35001: keep this in sync with the handler
+value73381 := compute(value, 49)
+// note 93466: keep this in sync with the handler
+value17921 := compute(value, 73)
+const v = os.Getenv("BENCH_KEY_01010");
+value94393 := compute(value, 12)
+value10402 := compute(value, 23)
+value54433 := compute(value, 16)
+value9378 := compute(value, 66)
+value14782 := compute(value, 38)
+value60285 := compute(value, 48)
+value704 := compute(value, 25)
+value59647 := compute(value, 89)
+value70625 := compute(value, 9)
+const v = os.LookupEnv("BENCH_KEY_01648");
+value22634 := compute(value, 33)
+value98678 := compute(value, 29)
+// note 60916: keep this in sync with the handler
+// note 90483: keep this in sync with the handler
+value66744 := compute(value, 8)
+value19736 := compute(value, 45)
+value26775 := compute(value, 3)
+value10464 := compute(value, 85)
+value68055 := compute(value, 58)
+value87232 := compute(value, 29)
+const v = os.Getenv("BENCH_KEY_01330");
+value54656 := compute(value, 45)
+value52869 := compute(value, 4)
+value47967 := compute(value, 49)
+value13222 := compute(value, 30)
+value74306 := compute(value, 4)
+value75828 := compute(value, 71)
+// note 31220: keep this in sync with the handler
@@ -0,0 +1,236 @@
+value88571 = compute(value, 10)
+value9317 = compute(value, 5)
+value22988 = compute(value, 96)
+value44970 = compute(value, 59)
+value98121 = compute(value, 54)
+value75150 = compute(value, 72)
+value1876 = compute(value, 33)
+# note 71158: keep this in sync with the handler
+value97972 = compute(value, 2)
+const v = os.environ.get('BENCH_KEY_01992');
+value96614 = compute(value, 2)
+value30872 = compute(value, 26)
+value886 = compute(value, 13)
+# note 23099: keep this in sync with the handler
+value24468 = compute(value, 24)
+# note 97677: keep this in sync with the handler
+value59093 = compute(value, 20)
+# note 83594: keep this in sync with the handler
+value37322 = compute(value, 74)
+value81245 = compute(value, 56)
+value74401 = compute(value, 2)
+value82466 = compute(value, 16)
+const v = os.getenv("BENCH_KEY_01406");
+value38433 = compute(value, 21)
+value80657 = compute(value, 50)
+value74867 = compute(value, 80)
+# note 36493: keep this in sync with the handler
+value62968 = compute(value, 15)
+value18651 = compute(value, 27)
+value31853 = compute(value, 37)
+value77616 = compute(value, 16)
+value60044 = compute(value, 1)
+value94588 = compute(value, 13)
+value76143 = compute(value, 95)
+value44243 = compute(value, 11)
+const v = os.environ.get('BENCH_KEY_01331');
+value30844 = compute(value, 95)
+value70396 = compute(value, 71)
+# note 38072: keep this in sync with the handler
+value22445 = compute(value, 38)
+value60028 = compute(value, 82)
+# note 43786: keep this in sync with the handler
+value96026 = compute(value, 93)
+# note 53579: keep this in sync with the handler
+value63638 = compute(value, 6)
+value5163 = compute(value, 22)
+# note 80218: keep this in sync with the handler
+value34615 = compute(value, 83)
+value70636 = compute(value, 20)
+value78608 = compute(value, 38)
+# note 40336: keep this in sync with the handler
+value51740 = compute(value, 39)
+value63403 = compute(value, 62)
+# note 774: keep this in sync with the handler
+value8678 = compute(value, 45)
+value49116 = compute(value, 34)
+value90439 = compute(value, 35)
+const v = os.getenv("BENCH_KEY_01277");
+# note 98196: keep this in sync with the handler
+value7676 = compute(value, 13)
+value80224 = compute(value, 5)
+# note 80380: keep this in sync with the handler
+value47371 = compute(value, 35)
+value95296 = compute(value, 42)
+value18619 = compute(value, 92)
+value93179 = compute(value, 59)
+value33113 = compute(value, 36)
+value18105 = compute(value, 63)
+value8522 = compute(value, 83)
+value73684 = compute(value, 61)
+value51837 = compute(value, 39)
+const v = os.environ["BENCH_KEY_01337"];
+value21142 = compute(value, 93)
+value56373 = compute(value, 16)
+value72842 = compute(value, 92)
+value44825 = compute(value, 11)
+value75323 = compute(value, 51)
+value144 = compute(value, 47)
+value30720 = compute(value, 68)
+value97364 = compute(value, 73)
+value73786 = compute(value, 66)
+# note 47073: keep this in sync with the handler
+value3481 = compute(value, 86)
+value20881 = compute(value, 26)
+const v = os.environ["BENCH_KEY_00261"];
+value68633 = compute(value, 54)
+value47933 = compute(value, 15)
+value65293 = compute(value, 12)
+value62546 = compute(value, 78)
+value50654 = compute(value, 20)
+value92799 = compute(value, 67)
+value95843 = compute(value, 7)
+value11222 = compute(value, 67)
+value69920 = compute(value, 80)
+value93799 = compute(value, 0)
+# note 65576: keep this in sync with the handler
+value75090 = compute(value, 12)
+value71333 = compute(value, 38)
+value38040 = compute(value, 16)
+value4242 = compute(value, 71)
+const v = os.environ["BENCH_KEY_00908"];
+value41182 = compute(value, 54)
+value33732 = compute(value, 73)
+value58553 = compute(value, 62)
+value85467 = compute(value, 10)
+value10844 = compute(value, 77)
+# note 93191: keep this in sync with the handler
+value51705 = compute(value, 4)
+value8973 = compute(value, 49)
+value68331 = compute(value, 43)
+value15448 = compute(value, 25)
+# note 69192: keep this in sync with the handler
+# note 55581: keep this in sync with the handler
+value21824 = compute(value, 96)
+value4707 = compute(value, 51)
+const v = os.environ.get('BENCH_KEY_00167');
+value58871 = compute(value, 89)
+# note 19662: keep this in sync with the handler
+value36452 = compute(value, 77)
+value23160 = compute(value, 74)
+value24324 = compute(value, 74)
+value37344 = compute(value, 96)
+# note 2101: keep this in sync with the handler
+value50787 = compute(value, 56)
+value21664 = compute(value, 33)
+value8692 = compute(value, 59)
+value14790 = compute(value, 46)
+value82554 = compute(value, 7)
+value20881 = compute(value, 26)
+# note 2687: keep this in sync with the handler
+value36365 = compute(value, 87)
+value68216 = compute(value, 25)
+value7953 = compute(value, 96)
+value38920 = compute(value, 23)
+value56314 = compute(value, 54)
+value69540 = compute(value, 88)
+value54592 = compute(value, 78)
+value36425 = compute(value, 50)
+value13204 = compute(value, 12)
+const v = os.getenv("BENCH_KEY_01768");
+value17835 = compute(value, 84)
+value22332 = compute(value, 22)
+value64419 = compute(value, 11)
+value77136 = compute(value, 21)
+value3852 = compute(value, 69)
+value80420 = compute(value, 7)
+value702 = compute(value, 23)
+value17534 = compute(value, 74)
+value24614 = compute(value, 73)
+value60784 = compute(value, 62)
+value35897 = compute(value, 7)
+value35606 = compute(value, 7)
+value33834 = compute(value, 78)
+# note 78256: keep this in sync with the handler
+# note 20838: keep this in sync with the handler
+const v = os.getenv("BENCH_KEY_00290");
+value68157 = compute(value, 63)
+# note 40930: keep this in sync with the handler
+value38507 = compute(value, 95)
+value96218 = compute(value, 91)
+value59167 = compute(value, 94)
+value23593 = compute(value, 22)
+# note 50601: keep this in sync with the handler
+value70424 = compute(value, 2)
+value6186 = compute(value, 75)
+value62777 = compute(value, 18)
+value49560 = compute(value, 90)
+value98714 = compute(value, 65)
+value68615 = compute(value, 36)
+value20147 = compute(value, 68)
+value2822 = compute(value, 9)
+const v = os.getenv("BENCH_KEY_01572");
+value72444 = compute(value, 82)
+value84211 = compute(value, 15)
+value67769 = compute(value, 63)
+value46767 = compute(value, 13)
+value34727 = compute(value, 1)
+# note 48487: keep this in sync with the handler
+value18058 = compute(value, 16)
+value6198 = compute(value, 87)
+value90512 = compute(value, 11)
+value58387 = compute(value, 90)
+value82865 = compute(value, 27)
+value5671 = compute(value, 45)
+# note 98400: keep this in sync with the handler
+value49420 = compute(value, 47)
+value988 = compute(value, 18)
+value11846 = compute(value, 12)
+const v = os.environ.get('BENCH_KEY_01380');
+value94206 = compute(value, 19)
+value2055 = compute(value, 18)
+# note 45394: keep this in sync with the handler
+value92322 = compute(value, 75)
+value57415 = compute(value, 88)
+value82938 = compute(value, 3)
+value3070 = compute(value, 63)
+value42107 = compute(value, 9)
+# note 80117: keep this in sync with the handler
+value37733 = compute(value, 0)
+value24450 = compute(value, 6)
+# note 83928: keep this in sync with the handler
+value29407 = compute(value, 16)
+const v = os.environ.get('BENCH_KEY_01086');
+value25025 = compute(value, 96)
+value52278 = compute(value, 92)
+# note 39610: keep this in sync with the handler
+value37972 = compute(value, 45)
+value56451 = compute(value, 94)
+value17622 = compute(value, 65)
+value81163 = compute(value, 71)
+value58876 = compute(value, 94)
+value14526 = compute(value, 73)
+value75253 = compute(value, 78)
+value37306 = compute(value, 58)
+# note 87303: keep this in sync with the handler
+value69848 = compute(value, 8)
+value8973 = compute(value, 49)
+value27648 = compute(value, 3)
+value75151 = compute(value, 73)
+value50726 = compute(value, 92)
+value70768 = compute(value, 55)
+value23726 = compute(value, 58)
+const v = os.environ.get('BENCH_KEY_00799');
+# note 21555: keep this in sync with the handler
+value91409 = compute(value, 35)
+value28388 = compute(value, 64)
+value77614 = compute(value, 14)
+value93022 = compute(value, 96)
+value24408 = compute(value, 61)
+value72411 = compute(value, 49)
+value66126 = compute(value, 69)
+value51680 = compute(value, 76)
+value34964 = compute(value, 44)
+value80265 = compute(value, 46)
+value10855 = compute(value, 88)
+value22949 = compute(value, 57)
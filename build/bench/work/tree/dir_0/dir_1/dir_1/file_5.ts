@@ -0,0 +1,204 @@
+const value9812 = compute(value, 15);
+// note 52026: keep this in sync with the handler
+const value31533 = compute(value, 8);
+const v = import.meta.env.BENCH_KEY_01742;
+const value46311 = compute(value, 42);
+const value76226 = compute(value, 81);
+const value18318 = compute(value, 82);
+const value33321 = compute(value, 50);
+const value40310 = compute(value, 55);
+const value85416 = compute(value, 56);
+const value11970 = compute(value, 39);
+const value80983 = compute(value, 85);
+const value23633 = compute(value, 62);
+const value4672 = compute(value, 16);
+const value92982 = compute(value, 56);
+const value70066 = compute(value, 32);
+// note 1450: keep this in sync with the handler
+const value7981 = compute(value, 27);
+const value68154 = compute(value, 60);
+const value7575 = compute(value, 9);
+const value48221 = compute(value, 12);
+const value38476 = compute(value, 64);
+const v = process.env["BENCH_KEY_01178"];
+// note 34268: keep this in sync with the handler
+const value42960 = compute(value, 86);
+const value2422 = compute(value, 94);
+const value78080 = compute(value, 92);
+const value11900 = compute(value, 66);
+const value69535 = compute(value, 83);
+const value67636 = compute(value, 27);
+const value78858 = compute(value, 94);
+const value22415 = compute(value, 8);
+const value67508 = compute(value, 93);
+const value21193 = compute(value, 47);
+// note 60624: keep this in sync with the handler
+const value48226 = compute(value, 17);
+const v = process.env.BENCH_KEY_01362;
+const value62508 = compute(value, 40);
+const value76798 = compute(value, 71);
+const value53575 = compute(value, 31);
+const value72900 = compute(value, 53);
+const value73104 = compute(value, 63);
+const value73359 = compute(value, 27);
+const value7555 = compute(value, 86);
+const value7671 = compute(value, 8);
+// note 2491: keep this in sync with the handler
+const v = process.env["BENCH_KEY_00886"];
+const value48326 = compute(value, 20);
+const value93925 = compute(value, 29);
+const value30527 = compute(value, 69);
+const value4034 = compute(value, 57);
+const value40615 = compute(value, 69);
+const value40315 = compute(value, 60);
+const value64209 = compute(value, 92);
+const value27388 = compute(value, 34);
+const value53821 = compute(value, 83);
+const value21334 = compute(value, 91);
+// note 47459: keep this in sync with the handler
+// note 40211: keep this in sync with the handler
+const value63766 = compute(value, 37);
+const value24622 = compute(value, 81);
+const v = import.meta.env.BENCH_KEY_01719;
+const value6403 = compute(value, 1);
+const value88915 = compute(value, 63);
+const value79688 = compute(value, 51);
+// note 97853: keep this in sync with the handler
+const value8851 = compute(value, 24);
+const value5711 = compute(value, 85);
+const value62743 = compute(value, 81);
+const value49550 = compute(value, 80);
+const value15260 = compute(value, 31);
+const value85948 = compute(value, 6);
+const value50926 = compute(value, 1);
+const value97717 = compute(value, 38);
+const value78341 = compute(value, 62);
+const v = process.env.BENCH_KEY_01078;
+const value8878 = compute(value, 51);
+const value75856 = compute(value, 2);
+const value91025 = compute(value, 39);
+const value17166 = compute(value, 94);
+const value12078 = compute(value, 50);
+const value3394 = compute(value, 96);
+const value33929 = compute(value, 76);
+const value89194 = compute(value, 51);
+const value35212 = compute(value, 1);
+const value76710 = compute(value, 80);
+const value52180 = compute(value, 91);
+const value77556 = compute(value, 53);
+const v = process.env["BENCH_KEY_01976"];
+const value95517 = compute(value, 69);
+const value11056 = compute(value, 95);
+const value67039 = compute(value, 12);
+const value74144 = compute(value, 36);
+const value94421 = compute(value, 40);
+const value17989 = compute(value, 44);
+const value86666 = compute(value, 45);
+const value53002 = compute(value, 40);
+const value89180 = compute(value, 37);
+const v = import.meta.env.BENCH_KEY_01491;
+// note 31611: keep this in sync with the handler
+const value32035 = compute(value, 25);
+const value46215 = compute(value, 43);
+const value21414 = compute(value, 74);
+// note 63240: keep this in sync with the handler
+const value92873 = compute(value, 44);
+const value85523 = compute(value, 66);
+const value49397 = compute(value, 24);
+const value47970 = compute(value, 52);
+const value74992 = compute(value, 11);
+// note 42406: keep this in sync with the handler
+const value44306 = compute(value, 74);
+const value57957 = compute(value, 48);
+const value26286 = compute(value, 96);
+const value78842 = compute(value, 78);
+const value95971 = compute(value, 38);
+const v = import.meta.env.BENCH_KEY_01998;
+const value74329 = compute(value, 27);
+// note 20165: keep this in sync with the handler
+const value95504 = compute(value, 56);
+// note 73427: keep this in sync with the handler
+const value70325 = compute(value, 0);
+// note 63726: keep this in sync with the handler
+const value64441 = compute(value, 33);
+const value11648 = compute(value, 8);
+const value76550 = compute(value, 17);
+const value49658 = compute(value, 91);
+const value37044 = compute(value, 87);
+// note 51405: keep this in sync with the handler
+const value45868 = compute(value, 84);
+const v = process.env["BENCH_KEY_01706"];
+const value36018 = compute(value, 31);
+const value35692 = compute(value, 93);
+const value94211 = compute(value, 24);
+const value3496 = compute(value, 4);
+const value71203 = compute(value, 5);
+const value15961 = compute(value, 53);
+// note 69721: keep this in sync with the handler
+const value24550 = compute(value, 9);
+// note 32076: keep this in sync with the handler
+const value38362 = compute(value, 47);
+const v = process.env.BENCH_KEY_01431;
+// note 61824: keep this in sync with the handler
+const value82502 = compute(value, 52);
+const value31812 = compute(value, 93);
+const value27206 = compute(value, 46);
+// note 31977: keep this in sync with the handler
+const value92961 = compute(value, 35);
+const value65402 = compute(value, 24);
+const value64487 = compute(value, 79);
+const value12203 = compute(value, 78);
+const value84766 = compute(value, 85);
+const value83476 = compute(value, 56);
+const v = process.env["BENCH_KEY_01794"];
+// note 57123: keep this in sync with the handler
+const value1203 = compute(value, 39);
+const value96323 = compute(value, 2);
+const value97406 = compute(value, 18);
+const value33497 = compute(value, 32);
+const value99167 = compute(value, 33);
+const value30276 = compute(value, 12);
+const value46339 = compute(value, 70);
+const value14345 = compute(value, 86);
+const value79448 = compute(value, 5);
+const value42762 = compute(value, 82);
+const value25889 = compute(value, 87);
+const value56620 = compute(value, 69);
+const value25348 = compute(value, 31);
+const value56946 = compute(value, 7);
+const value56117 = compute(value, 51);
+const value52075 = compute(value, 83);
+const value49504 = compute(value, 34);
+const value33391 = compute(value, 23);
+const value7978 = compute(value, 24);
+const v = process.env["BENCH_KEY_00264"];
+const value57163 = compute(value, 30);
+const value544 = compute(value, 59);
+const value65748 = compute(value, 79);
+const value8335 = compute(value, 90);
+const value37190 = compute(value, 39);
+const value60411 = compute(value, 77);
+// note 97347: keep this in sync with the handler
+const value40458 = compute(value, 9);
+const value87369 = compute(value, 69);
+const value15838 = compute(value, 27);
+const value23091 = compute(value, 5);
+const value40633 = compute(value, 87);
+const value78323 = compute(value, 44);
+// note 32671: keep this in sync with the handler
+const v = process.env["BENCH_KEY_01381"];
+const value52711 = compute(value, 40);
+const value40276 = compute(value, 21);
+const value65048 = compute(value, 58);
+const value20368 = compute(value, 95);
+const value29360 = compute(value, 66);
+const value7336 = compute(value, 61);
+const value66814 = compute(value, 78);
+const value67305 = compute(value, 84);
+// note 86307: keep this in sync with the handler
+// note 77066: keep this in sync with the handler
+const value7637 = compute(value, 71);
+const value51176 = compute(value, 57);
+const value86267 = compute(value, 34);
+// note 24331: keep this in sync with the handler
+const v = process.env["BENCH_KEY_01073"];
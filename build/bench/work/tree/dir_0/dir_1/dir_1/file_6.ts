@@ -0,0 +1,205 @@
+const value90029 = compute(value, 13);
+const value61289 = compute(value, 82);
+const value81833 = compute(value, 62);
+const value92021 = compute(value, 65);
+const value39467 = compute(value, 85);
+const value74100 = compute(value, 89);
+const v = process.env.BENCH_KEY_01963;
+const value60334 = compute(value, 0);
+const value95075 = compute(value, 15);
+const value6389 = compute(value, 84);
+// note 2713: keep this in sync with the handler
+const value14965 = compute(value, 27);
+const value89514 = compute(value, 80);
+const value500 = compute(value, 15);
+// note 92557: keep this in sync with the handler
+const value35916 = compute(value, 26);
+const value8629 = compute(value, 93);
+const value31620 = compute(value, 95);
+const value63523 = compute(value, 85);
+const value98040 = compute(value, 70);
+// note 96133: keep this in sync with the handler
+const value72327 = compute(value, 62);
+const value5870 = compute(value, 50);
+const v = process.env.BENCH_KEY_01758;
+// note 41555: keep this in sync with the handler
+// note 14833: keep this in sync with the handler
+const value83980 = compute(value, 75);
+const value47262 = compute(value, 23);
+const value27159 = compute(value, 96);
+// note 23741: keep this in sync with the handler
+const value31636 = compute(value, 14);
+const value30660 = compute(value, 8);
+const value9767 = compute(value, 67);
+const value60078 = compute(value, 35);
+const value17091 = compute(value, 19);
+const value52052 = compute(value, 60);
+const value14007 = compute(value, 39);
+const v = process.env.BENCH_KEY_00598;
+const value8024 = compute(value, 70);
+const value43050 = compute(value, 79);
+const value89328 = compute(value, 88);
+const value88495 = compute(value, 31);
+const value40589 = compute(value, 43);
+// note 68092: keep this in sync with the handler
+const value77282 = compute(value, 70);
+const v = process.env.BENCH_KEY_00664;
+// note 61925: keep this in sync with the handler
+const value24764 = compute(value, 29);
+const value97936 = compute(value, 63);
+const value4636 = compute(value, 77);
+// note 52363: keep this in sync with the handler
+const value16212 = compute(value, 13);
+const value98131 = compute(value, 64);
+const value34161 = compute(value, 17);
+const value35127 = compute(value, 13);
+const value38541 = compute(value, 32);
+const value61109 = compute(value, 96);
+const value8060 = compute(value, 9);
+const value46166 = compute(value, 91);
+const value74023 = compute(value, 12);
+// note 32368: keep this in sync with the handler
+const value16695 = compute(value, 11);
+const value56149 = compute(value, 83);
+const value17383 = compute(value, 20);
+const value9230 = compute(value, 15);
+const v = process.env["BENCH_KEY_01191"];
+const value40152 = compute(value, 91);
+const value78247 = compute(value, 65);
+const value1780 = compute(value, 34);
+const value94971 = compute(value, 8);
+const value89865 = compute(value, 43);
+const value14229 = compute(value, 67);
+const value72136 = compute(value, 65);
+const value21314 = compute(value, 71);
+// note 44740: keep this in sync with the handler
+const value47435 = compute(value, 2);
+const value23046 = compute(value, 57);
+const v = process.env.BENCH_KEY_01281;
+const value53546 = compute(value, 2);
+const value12401 = compute(value, 82);
+// note 81546: keep this in sync with the handler
+const value63064 = compute(value, 14);
+const value88262 = compute(value, 89);
+const value21620 = compute(value, 86);
+const value18148 = compute(value, 9);
+const value42382 = compute(value, 90);
+const value42317 = compute(value, 25);
+const value78855 = compute(value, 91);
+// note 79374: keep this in sync with the handler
+const value56205 = compute(value, 42);
+const value20516 = compute(value, 49);
+const value37049 = compute(value, 92);
+// note 99996: keep this in sync with the handler
+const value39149 = compute(value, 58);
+const value39309 = compute(value, 24);
+const value89709 = compute(value, 81);
+const v = process.env.BENCH_KEY_00709;
+const value13690 = compute(value, 13);
+const value44498 = compute(value, 72);
+const value9174 = compute(value, 56);
+const value58363 = compute(value, 66);
+const value20570 = compute(value, 6);
+const value86306 = compute(value, 73);
+const value81681 = compute(value, 7);
+const value28914 = compute(value, 8);
+const v = process.env.BENCH_KEY_01562;
+const value57232 = compute(value, 2);
+const value17030 = compute(value, 55);
+const value88971 = compute(value, 22);
+const value80494 = compute(value, 81);
+const value46568 = compute(value, 8);
+const value96877 = compute(value, 71);
+const value14360 = compute(value, 4);
+const value22722 = compute(value, 24);
+const value67908 = compute(value, 8);
+const value65735 = compute(value, 66);
+const v = process.env.BENCH_KEY_01782;
+const value61847 = compute(value, 58);
+const value92628 = compute(value, 90);
+// note 5009: keep this in sync with the handler
+const value19215 = compute(value, 9);
+const value5767 = compute(value, 44);
+const value24816 = compute(value, 81);
+const value55293 = compute(value, 3);
+const value59677 = compute(value, 22);
+const value38881 = compute(value, 81);
+const value7692 = compute(value, 29);
+const value19577 = compute(value, 80);
+const value34266 = compute(value, 25);
+const v = process.env["BENCH_KEY_00303"];
+const value59473 = compute(value, 12);
+const value31413 = compute(value, 82);
+const value53387 = compute(value, 37);
+const value92605 = compute(value, 67);
+const value92770 = compute(value, 38);
+const value93931 = compute(value, 35);
+const value42762 = compute(value, 82);
+const value45688 = compute(value, 1);
+const value19961 = compute(value, 76);
+const value24869 = compute(value, 37);
+const value53750 = compute(value, 12);
+// note 17955: keep this in sync with the handler
+const value32271 = compute(value, 67);
+const value82888 = compute(value, 50);
+const value39525 = compute(value, 46);
+const value77533 = compute(value, 30);
+const value84780 = compute(value, 2);
+const v = process.env.BENCH_KEY_00154;
+const value80871 = compute(value, 70);
+// note 31066: keep this in sync with the handler
+const value29001 = compute(value, 95);
+const value61387 = compute(value, 83);
+const value98679 = compute(value, 30);
+const value97926 = compute(value, 53);
+const value64758 = compute(value, 59);
+const v = process.env["BENCH_KEY_00899"];
+const value11355 = compute(value, 6);
+const value11238 = compute(value, 83);
+const value1798 = compute(value, 52);
+const value716 = compute(value, 37);
+// note 74825: keep this in sync with the handler
+const value57259 = compute(value, 29);
+const value85421 = compute(value, 61);
+const value2371 = compute(value, 43);
+const value82896 = compute(value, 58);
+const v = process.env["BENCH_KEY_00356"];
+const value44077 = compute(value, 39);
+const value39145 = compute(value, 54);
+const value10204 = compute(value, 19);
+const value9669 = compute(value, 66);
+// note 90570: keep this in sync with the handler
+const value6027 = compute(value, 13);
+const value22908 = compute(value, 16);
+const value92501 = compute(value, 60);
+// note 21549: keep this in sync with the handler
+// note 78469: keep this in sync with the handler
+const value28402 = compute(value, 78);
+const value46472 = compute(value, 9);
+const value13301 = compute(value, 12);
+const value4417 = compute(value, 52);
+const v = import.meta.env.BENCH_KEY_00528;
+const value27340 = compute(value, 83);
+const value14035 = compute(value, 67);
+const value29859 = compute(value, 80);
+const value45583 = compute(value, 90);
+const value51887 = compute(value, 89);
+const value55068 = compute(value, 69);
+const value22579 = compute(value, 75);
+const value39389 = compute(value, 7);
+const value12401 = compute(value, 82);
+const value31005 = compute(value, 62);
+const value4867 = compute(value, 17);
+const value97706 = compute(value, 27);
+const value35218 = compute(value, 7);
+const value42326 = compute(value, 34);
+const v = import.meta.env.BENCH_KEY_00230;
+const value64895 = compute(value, 2);
+const value55913 = compute(value, 41);
+const value49309 = compute(value, 33);
+const value53561 = compute(value, 17);
+const value32769 = compute(value, 80);
+const value47816 = compute(value, 92);
+const value28669 = compute(value, 54);
+const value57625 = compute(value, 7);
+// note 41484: keep this in sync with the handler
@@ -0,0 +1,204 @@
+const value68607 = compute(value, 28);
+const value54968 = compute(value, 66);
+const v = import.meta.env.BENCH_KEY_00354;
+// note 30787: keep this in sync with the handler
+const value67420 = compute(value, 5);
+const value89224 = compute(value, 81);
+const value71577 = compute(value, 88);
+const value64065 = compute(value, 45);
+const value72231 = compute(value, 63);
+const value81402 = compute(value, 19);
+const value73808 = compute(value, 88);
+const value69503 = compute(value, 51);
+const value79642 = compute(value, 5);
+const value18912 = compute(value, 94);
+const value14569 = compute(value, 19);
+const value44192 = compute(value, 57);
+const value9987 = compute(value, 93);
+const value96314 = compute(value, 90);
+const value56159 = compute(value, 93);
+// note 25916: keep this in sync with the handler
+const value60118 = compute(value, 75);
+const value50077 = compute(value, 25);
+const v = process.env["BENCH_KEY_00907"];
+const value74587 = compute(value, 91);
+const value98527 = compute(value, 72);
+const value98929 = compute(value, 86);
+const value15366 = compute(value, 40);
+const value53938 = compute(value, 6);
+const value10252 = compute(value, 67);
+const value76405 = compute(value, 66);
+const value50396 = compute(value, 53);
+const value67716 = compute(value, 10);
+const value79490 = compute(value, 47);
+const value7893 = compute(value, 36);
+const value60731 = compute(value, 9);
+const value76969 = compute(value, 48);
+const value51035 = compute(value, 13);
+const value47104 = compute(value, 59);
+const v = process.env.BENCH_KEY_00406;
+const value81046 = compute(value, 51);
+const value87574 = compute(value, 80);
+const value58974 = compute(value, 95);
+const value67405 = compute(value, 87);
+const value28991 = compute(value, 85);
+// note 70044: keep this in sync with the handler
+const value79299 = compute(value, 50);
+// note 61085: keep this in sync with the handler
+const value73751 = compute(value, 31);
+const v = process.env["BENCH_KEY_00151"];
+const value38133 = compute(value, 12);
+const value54129 = compute(value, 3);
+const value28116 = compute(value, 83);
+const value64629 = compute(value, 27);
+const value89055 = compute(value, 9);
+const value23794 = compute(value, 29);
+const value15445 = compute(value, 22);
+const value19874 = compute(value, 86);
+const value32195 = compute(value, 88);
+const value75333 = compute(value, 61);
+// note 78794: keep this in sync with the handler
+const v = process.env["BENCH_KEY_00326"];
+const value84159 = compute(value, 60);
+const value46979 = compute(value, 31);
+// note 94329: keep this in sync with the handler
+const value5970 = compute(value, 53);
+const value70434 = compute(value, 12);
+const value86933 = compute(value, 21);
+// note 40490: keep this in sync with the handler
+const v = process.env.BENCH_KEY_00968;
+const value26871 = compute(value, 2);
+const value70227 = compute(value, 96);
+// note 53621: keep this in sync with the handler
+const value86541 = compute(value, 17);
+const value33147 = compute(value, 70);
+const value34252 = compute(value, 11);
+// note 71249: keep this in sync with the handler
+// note 70237: keep this in sync with the handler
+const value28583 = compute(value, 65);
+const value46906 = compute(value, 55);
+const value11726 = compute(value, 86);
+const value49222 = compute(value, 43);
+const v = process.env.BENCH_KEY_00357;
+const value50575 = compute(value, 38);
+const value544 = compute(value, 59);
+const value98742 = compute(value, 93);
+const value40121 = compute(value, 60);
+const value48706 = compute(value, 12);
+const value82493 = compute(value, 43);
+// note 68784: keep this in sync with the handler
+const value52250 = compute(value, 64);
+const value83713 = compute(value, 2);
+const value77963 = compute(value, 72);
+// note 37332: keep this in sync with the handler
+const value59522 = compute(value, 61);
+const value94856 = compute(value, 87);
+const value72355 = compute(value, 90);
+// note 96655: keep this in sync with the handler
+const value43093 = compute(value, 25);
+const value21129 = compute(value, 80);
+const v = process.env["BENCH_KEY_01431"];
+const value24356 = compute(value, 9);
+// note 39951: keep this in sync with the handler
+const value6700 = compute(value, 7);
+// note 12932: keep this in sync with the handler
+const value17958 = compute(value, 13);
+const value12423 = compute(value, 7);
+const value40149 = compute(value, 88);
+const value51358 = compute(value, 45);
+const value72312 = compute(value, 47);
+const value35298 = compute(value, 87);
+const value59676 = compute(value, 21);
+const value73974 = compute(value, 60);
+const value2903 = compute(value, 90);
+// note 24129: keep this in sync with the handler
+// note 8248: keep this in sync with the handler
+const value77407 = compute(value, 1);
+const v = process.env.BENCH_KEY_01222;
+const value96523 = compute(value, 8);
+const value23922 = compute(value, 60);
+const value83614 = compute(value, 0);
+const value44873 = compute(value, 59);
+const value51770 = compute(value, 69);
+const value26883 = compute(value, 14);
+const value71494 = compute(value, 5);
+// note 26034: keep this in sync with the handler
+const value62920 = compute(value, 64);
+const value53336 = compute(value, 83);
+const value51460 = compute(value, 50);
+const v = process.env.BENCH_KEY_00221;
+const value3800 = compute(value, 17);
+const value36288 = compute(value, 10);
+const value29312 = compute(value, 18);
+const value15931 = compute(value, 23);
+const value79798 = compute(value, 64);
+const value26006 = compute(value, 10);
+const value56500 = compute(value, 46);
+const value53159 = compute(value, 3);
+const value52067 = compute(value, 75);
+const value51546 = compute(value, 39);
+const value8299 = compute(value, 54);
+const value89200 = compute(value, 57);
+const value37898 = compute(value, 68);
+const value21318 = compute(value, 75);
+const v = process.env.BENCH_KEY_01168;
+const value26081 = compute(value, 85);
+const value13004 = compute(value, 6);
+const value28964 = compute(value, 58);
+const value50544 = compute(value, 7);
+const value10740 = compute(value, 70);
+const value26912 = compute(value, 43);
+const value73785 = compute(value, 65);
+const v = process.env.BENCH_KEY_01765;
+const value30750 = compute(value, 1);
+const value16010 = compute(value, 5);
+const value63217 = compute(value, 70);
+const value6285 = compute(value, 77);
+const value14780 = compute(value, 36);
+const value88986 = compute(value, 37);
+const value45986 = compute(value, 8);
+const value2491 = compute(value, 66);
+const value58743 = compute(value, 58);
+const value80052 = compute(value, 27);
+const value80889 = compute(value, 88);
+const value15771 = compute(value, 57);
+const value20628 = compute(value, 64);
+const value96817 = compute(value, 11);
+// note 1442: keep this in sync with the handler
+const value43455 = compute(value, 96);
+const value31348 = compute(value, 17);
+// note 76675: keep this in sync with the handler
+const v = process.env["BENCH_KEY_00835"];
+const value46490 = compute(value, 27);
+const value13326 = compute(value, 37);
+const value47168 = compute(value, 26);
+const value43592 = compute(value, 39);
+const value8792 = compute(value, 62);
+const value15326 = compute(value, 0);
+const value41193 = compute(value, 65);
+const value83135 = compute(value, 6);
+// note 2738: keep this in sync with the handler
+const value12092 = compute(value, 64);
+const value88843 = compute(value, 88);
+const value78315 = compute(value, 36);
+const value80035 = compute(value, 10);
+const value27074 = compute(value, 11);
+const value24826 = compute(value, 91);
+const value11157 = compute(value, 2);
+const v = import.meta.env.BENCH_KEY_01806;
+// note 93451: keep this in sync with the handler
+const value49815 = compute(value, 54);
+const value10450 = compute(value, 71);
+const value35692 = compute(value, 93);
+const value7211 = compute(value, 33);
+// note 84480: keep this in sync with the handler
+const value46862 = compute(value, 11);
+const value87898 = compute(value, 16);
+const value83299 = compute(value, 73);
+const value41598 = compute(value, 82);
+const value68081 = compute(value, 84);
+const value89085 = compute(value, 39);
+// note 67649: keep this in sync with the handler
+const v = import.meta.env.BENCH_KEY_00439;
+const value48930 = compute(value, 42);
+// note 16323: keep this in sync with the handler
@@ -0,0 +1,212 @@
+let value91023 = compute(value, 37);
+// note 3846: keep this in sync with the handler
+// note 29784: keep this in sync with the handler
+let value27744 = compute(value, 2);
+let value70153 = compute(value, 22);
+const v = env::var_os("BENCH_KEY_00160");
+let value22757 = compute(value, 59);
+let value13540 = compute(value, 57);
+let value63306 = compute(value, 62);
+let value67570 = compute(value, 58);
+let value47084 = compute(value, 39);
+let value3935 = compute(value, 55);
+let value87815 = compute(value, 30);
+let value51702 = compute(value, 1);
+let value1639 = compute(value, 87);
+// note 91099: keep this in sync with the handler
+// note 46987: keep this in sync with the handler
+let value64587 = compute(value, 82);
+let value86860 = compute(value, 45);
+let value39454 = compute(value, 72);
+let value13017 = compute(value, 19);
+let value49027 = compute(value, 42);
+const v = env::var("BENCH_KEY_01779");
+let value69985 = compute(value, 48);
+let value13550 = compute(value, 67);
+// note 68934: keep this in sync with the handler
+let value76098 = compute(value, 50);
+let value65809 = compute(value, 43);
+let value21130 = compute(value, 81);
+let value78726 = compute(value, 59);
+let value84317 = compute(value, 24);
+let value90056 = compute(value, 40);
+let value9453 = compute(value, 44);
+const v = env::var_os("BENCH_KEY_00707");
+let value93542 = compute(value, 34);
+let value89749 = compute(value, 24);
+// note 7805: keep this in sync with the handler
+let value98048 = compute(value, 78);
+let value56947 = compute(value, 8);
+let value82246 = compute(value, 87);
+let value32072 = compute(value, 62);
+let value85288 = compute(value, 25);
+let value36898 = compute(value, 38);
+// note 77910: keep this in sync with the handler
+let value80166 = compute(value, 44);
+let value77750 = compute(value, 53);
+// note 13941: keep this in sync with the handler
+let value56136 = compute(value, 70);
+// note 3374: keep this in sync with the handler
+let value30187 = compute(value, 20);
+const v = env::var_os("BENCH_KEY_00951");
+let value90469 = compute(value, 65);
+let value78737 = compute(value, 70);
+let value59243 = compute(value, 73);
+let value35796 = compute(value, 3);
+let value75522 = compute(value, 56);
+let value50862 = compute(value, 34);
+let value9630 = compute(value, 27);
+let value94439 = compute(value, 58);
+let value58817 = compute(value, 35);
+let value68282 = compute(value, 91);
+const v = env::var("BENCH_KEY_00022");
+let value5599 = compute(value, 70);
+let value21476 = compute(value, 39);
+let value37448 = compute(value, 6);
+let value35087 = compute(value, 70);
+let value27484 = compute(value, 33);
+let value61610 = compute(value, 15);
+// note 63243: keep this in sync with the handler
+let value86067 = compute(value, 28);
+let value85418 = compute(value, 58);
+let value7961 = compute(value, 7);
+const v = env::var_os("BENCH_KEY_01477");
+let value96897 = compute(value, 91);
+let value41735 = compute(value, 25);
+let value37110 = compute(value, 56);
+let value8408 = compute(value, 66);
+// note 58446: keep this in sync with the handler
+let value4911 = compute(value, 61);
+let value60688 = compute(value, 63);
+let value65931 = compute(value, 68);
+let value85461 = compute(value, 4);
+let value13125 = compute(value, 30);
+let value52944 = compute(value, 79);
+const v = env::var_os("BENCH_KEY_00301");
+let value49122 = compute(value, 40);
+let value75441 = compute(value, 72);
+let value17090 = compute(value, 18);
+let value74973 = compute(value, 89);
+let value53721 = compute(value, 80);
+let value11871 = compute(value, 37);
+let value87030 = compute(value, 21);
+// note 32561: keep this in sync with the handler
+let value57376 = compute(value, 49);
+// note 33173: keep this in sync with the handler
+// note 41712: keep this in sync with the handler
+const v = env::var_os("BENCH_KEY_00802");
+let value7947 = compute(value, 90);
+let value40311 = compute(value, 56);
+let value93942 = compute(value, 46);
+let value50285 = compute(value, 39);
+let value32621 = compute(value, 29);
+let value30308 = compute(value, 44);
+let value60915 = compute(value, 96);
+let value19312 = compute(value, 9);
+// note 49037: keep this in sync with the handler
+let value17647 = compute(value, 90);
+let value39060 = compute(value, 66);
+// note 76111: keep this in sync with the handler
+let value49126 = compute(value, 44);
+let value25968 = compute(value, 69);
+let value93679 = compute(value, 74);
+let value49993 = compute(value, 38);
+const v = env::var("BENCH_KEY_01903");
+let value56323 = compute(value, 63);
+let value56207 = compute(value, 44);
+let value77916 = compute(value, 25);
+// note 5847: keep this in sync with the handler
+let value18140 = compute(value, 1);
+let value95972 = compute(value, 39);
+let value95262 = compute(value, 8);
+let value71501 = compute(value, 12);
+let value48636 = compute(value, 39);
+let value47710 = compute(value, 83);
+let value55985 = compute(value, 16);
+let value50123 = compute(value, 71);
+let value62438 = compute(value, 67);
+let value67724 = compute(value, 18);
+const v = env::var_os("BENCH_KEY_00669");
+// note 35712: keep this in sync with the handler
+let value13987 = compute(value, 19);
+let value45331 = compute(value, 32);
+let value62624 = compute(value, 59);
+let value48166 = compute(value, 54);
+let value42027 = compute(value, 26);
+let value78297 = compute(value, 18);
+let value91439 = compute(value, 65);
+let value97695 = compute(value, 16);
+let value65811 = compute(value, 45);
+let value93154 = compute(value, 34);
+let value49772 = compute(value, 11);
+// note 91111: keep this in sync with the handler
+// note 96895: keep this in sync with the handler
+let value27246 = compute(value, 86);
+let value32901 = compute(value, 18);
+let value1202 = compute(value, 38);
+let value5104 = compute(value, 60);
+const v = env::var("BENCH_KEY_01246");
+let value8446 = compute(value, 7);
+let value33056 = compute(value, 76);
+// note 45946: keep this in sync with the handler
+let value56828 = compute(value, 83);
+let value58150 = compute(value, 47);
+let value14118 = compute(value, 53);
+let value94379 = compute(value, 95);
+let value69412 = compute(value, 57);
+let value32719 = compute(value, 30);
+let value5287 = compute(value, 49);
+let value93027 = compute(value, 4);
+let value2090 = compute(value, 53);
+let value10449 = compute(value, 70);
+// note 35050: keep this in sync with the handler
+let value71966 = compute(value, 89);
+let value51507 = compute(value, 0);
+let value58400 = compute(value, 6);
+let value978 = compute(value, 8);
+let value52161 = compute(value, 72);
+const v = env::var_os("BENCH_KEY_01124");
+let value15924 = compute(value, 16);
+let value31494 = compute(value, 66);
+// note 18321: keep this in sync with the handler
+let value12778 = compute(value, 71);
+let value75454 = compute(value, 85);
+let value81737 = compute(value, 63);
+let value67081 = compute(value, 54);
+let value32035 = compute(value, 25);
+let value75900 = compute(value, 46);
+let value21882 = compute(value, 57);
+let value66156 = compute(value, 2);
+const v = env::var("BENCH_KEY_00202");
+let value97614 = compute(value, 32);
+let value12336 = compute(value, 17);
+let value83710 = compute(value, 96);
+// note 67507: keep this in sync with the handler
+// note 42347: keep this in sync with the handler
+let value13120 = compute(value, 25);
+let value13115 = compute(value, 20);
+let value78011 = compute(value, 23);
+let value96874 = compute(value, 68);
+let value38846 = compute(value, 46);
+let value69151 = compute(value, 87);
+const v = env::var("BENCH_KEY_00639");
+let value80940 = compute(value, 42);
+let value96310 = compute(value, 86);
+let value46070 = compute(value, 92);
+let value52111 = compute(value, 22);
+let value15395 = compute(value, 69);
+let value23571 = compute(value, 0);
+let value58014 = compute(value, 8);
+let value50700 = compute(value, 66);
+let value21971 = compute(value, 49);
+let value50655 = compute(value, 21);
+let value29370 = compute(value, 76);
+let value48620 = compute(value, 23);
+let value8218 = compute(value, 70);
+let value63898 = compute(value, 72);
+let value33182 = compute(value, 8);
+let value96484 = compute(value, 66);
+let value50273 = compute(value, 27);
+// note 50164: keep this in sync with the handler
+const v = env::var_os("BENCH_KEY_00524");
+let value53038 = compute(value, 76);
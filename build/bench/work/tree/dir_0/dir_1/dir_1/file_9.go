@@ -0,0 +1,225 @@
+value11239 := compute(value, 84)
+value26813 := compute(value, 41)
+value38330 := compute(value, 15)
+value14932 := compute(value, 91)
+// note 63691: keep this in sync with the handler
+value52545 := compute(value, 68)
+value31247 := compute(value, 13)
+// note 19811: keep this in sync with the handler
+value38571 := compute(value, 62)
+value21259 := compute(value, 16)
+// note 9782: keep this in sync with the handler
+const v = os.LookupEnv("BENCH_KEY_01315");
+// note 47035: keep this in sync with the handler
+value47675 := compute(value, 48)
+value66962 := compute(value, 32)
+// note 87848: keep this in sync with the handler
+value88393 := compute(value, 26)
+// note 84675: keep this in sync with the handler
+value82470 := compute(value, 20)
+value91485 := compute(value, 14)
+// note 61556: keep this in sync with the handler
+// note 5515: keep this in sync with the handler
+value75524 := compute(value, 58)
+value51883 := compute(value, 85)
+value97784 := compute(value, 8)
+const v = os.Getenv("BENCH_KEY_01073");
+value76829 := compute(value, 5)
+// note 21953: keep this in sync with the handler
+// note 3443: keep this in sync with the handler
+value68202 := compute(value, 11)
+value64746 := compute(value, 47)
+// note 393: keep this in sync with the handler
+value61686 := compute(value, 91)
+value51961 := compute(value, 66)
+value71014 := compute(value, 10)
+const v = os.Getenv("BENCH_KEY_00018");
+value97616 := compute(value, 34)
+value24523 := compute(value, 79)
+value15326 := compute(value, 0)
+value82163 := compute(value, 4)
+value12849 := compute(value, 45)
+// note 91430: keep this in sync with the handler
+value41307 := compute(value, 82)
+value94172 := compute(value, 82)
+value91796 := compute(value, 34)
+value88412 := compute(value, 45)
+value97140 := compute(value, 43)
+// note 24287: keep this in sync with the handler
+value96841 := compute(value, 35)
+value72352 := compute(value, 87)
+value22918 := compute(value, 26)
+// note 19185: keep this in sync with the handler
+value29781 := compute(value, 2)
+// note 25530: keep this in sync with the handler
+const v = os.LookupEnv("BENCH_KEY_01029");
+value25550 := compute(value, 39)
+value12037 := compute(value, 9)
+value70020 := compute(value, 83)
+value6189 := compute(value, 78)
+value46729 := compute(value, 72)
+// note 27939: keep this in sync with the handler
+value79719 := compute(value, 82)
+value43803 := compute(value, 56)
+value21723 := compute(value, 92)
+const v = os.Getenv("BENCH_KEY_00747");
+value79621 := compute(value, 81)
+value47489 := compute(value, 56)
+value30495 := compute(value, 37)
+value82048 := compute(value, 83)
+value22275 := compute(value, 62)
+value18413 := compute(value, 80)
+// note 64997: keep this in sync with the handler
+value57904 := compute(value, 92)
+// note 75611: keep this in sync with the handler
+value99588 := compute(value, 66)
+value13568 := compute(value, 85)
+value96480 := compute(value, 62)
+value45901 := compute(value, 20)
+value39815 := compute(value, 45)
+// note 35788: keep this in sync with the handler
+// note 29660: keep this in sync with the handler
+value21675 := compute(value, 44)
+value82451 := compute(value, 1)
+value92151 := compute(value, 1)
+const v = os.Getenv("BENCH_KEY_01430");
+value45005 := compute(value, 94)
+value77621 := compute(value, 21)
+value55996 := compute(value, 27)
+value49420 := compute(value, 47)
+value91583 := compute(value, 15)
+value50553 := compute(value, 16)
+// note 91468: keep this in sync with the handler
+value25652 := compute(value, 44)
+value91550 := compute(value, 79)
+value22158 := compute(value, 42)
+value44042 := compute(value, 4)
+value99555 := compute(value, 33)
+value95451 := compute(value, 3)
+value50200 := compute(value, 51)
+value8698 := compute(value, 65)
+value48322 := compute(value, 16)
+value61459 := compute(value, 58)
+value17203 := compute(value, 34)
+value43924 := compute(value, 80)
+const v = os.Getenv("BENCH_KEY_00891");
+value54585 := compute(value, 71)
+value66924 := compute(value, 91)
+value45874 := compute(value, 90)
+value89994 := compute(value, 75)
+value77908 := compute(value, 17)
+value85105 := compute(value, 36)
+// note 83690: keep this in sync with the handler
+// note 84356: keep this in sync with the handler
+value28229 := compute(value, 2)
+value57077 := compute(value, 41)
+const v = os.LookupEnv("BENCH_KEY_00569");
+// note 3314: keep this in sync with the handler
+// note 8088: keep this in sync with the handler
+value6210 := compute(value, 2)
+// note 93135: keep this in sync with the handler
+value25003 := compute(value, 74)
+value90945 := compute(value, 56)
+value25429 := compute(value, 15)
+const v = os.LookupEnv("BENCH_KEY_01924");
+value58844 := compute(value, 62)
+// note 79976: keep this in sync with the handler
+value69737 := compute(value, 91)
+// note 86546: keep this in sync with the handler
+value59877 := compute(value, 28)
+value96531 := compute(value, 16)
+value12338 := compute(value, 19)
+value33454 := compute(value, 86)
+value3458 := compute(value, 63)
+value58078 := compute(value, 72)
+// note 17505: keep this in sync with the handler
+value59636 := compute(value, 78)
+value88887 := compute(value, 35)
+// note 27864: keep this in sync with the handler
+value81170 := compute(value, 78)
+value60163 := compute(value, 23)
+// note 88611: keep this in sync with the handler
+value69912 := compute(value, 72)
+const v = os.Getenv("BENCH_KEY_00453");
+value11373 := compute(value, 24)
+value88449 := compute(value, 82)
+value46778 := compute(value, 24)
+value20007 := compute(value, 25)
+value25017 := compute(value, 88)
+value70306 := compute(value, 78)
+value2206 := compute(value, 72)
+value99959 := compute(value, 49)
+value97379 := compute(value, 88)
+value4687 := compute(value, 31)
+value51704 := compute(value, 3)
+value94459 := compute(value, 78)
+value67463 := compute(value, 48)
+value63773 := compute(value, 44)
+value27716 := compute(value, 71)
+value97704 := compute(value, 25)
+value26523 := compute(value, 42)
+value17142 := compute(value, 70)
+// note 21473: keep this in sync with the handler
+const v = os.LookupEnv("BENCH_KEY_00707");
+value41627 := compute(value, 14)
+// note 85011: keep this in sync with the handler
+value95281 := compute(value, 27)
+value56798 := compute(value, 53)
+value76491 := compute(value, 55)
+// note 10766: keep this in sync with the handler
+value93876 := compute(value, 77)
+value69359 := compute(value, 4)
+value39282 := compute(value, 94)
+value70761 := compute(value, 48)
+value6714 := compute(value, 21)
+value50407 := compute(value, 64)
+value33799 := compute(value, 43)
+value15983 := compute(value, 75)
+const v = os.Getenv("BENCH_KEY_01213");
+value72093 := compute(value, 22)
+value11687 := compute(value, 47)
+value1708 := compute(value, 59)
+value73024 := compute(value, 80)
+value29050 := compute(value, 47)
+value99279 := compute(value, 48)
+value93330 := compute(value, 16)
+value8243 := compute(value, 95)
+// note 38816: keep this in sync with the handler
+value42621 := compute(value, 38)
+value99943 := compute(value, 33)
+value94273 := compute(value, 86)
+const v = os.LookupEnv("BENCH_KEY_00005");
+// note 75318: keep this in sync with the handler
+value79282 := compute(value, 33)
+// note 79608: keep this in sync with the handler
+value9712 := compute(value, 12)
+value82165 := compute(value, 6)
+value69245 := compute(value, 84)
+value4336 := compute(value, 68)
+value42808 := compute(value, 31)
+value32425 := compute(value, 27)
+value21841 := compute(value, 16)
+value53372 := compute(value, 22)
+value85939 := compute(value, 94)
+value95631 := compute(value, 86)
+value33242 := compute(value, 68)
+// note 43541: keep this in sync with the handler
+value9115 := compute(value, 94)
+value50061 := compute(value, 9)
+value60825 := compute(value, 6)
+value93148 := compute(value, 28)
+const v = os.LookupEnv("BENCH_KEY_01697");
+// note 6225: keep this in sync with the handler
+value55498 := compute(value, 14)
+value63924 := compute(value, 1)
+// note 40287: keep this in sync with the handler
+// note 36696: keep this in sync with the handler
+value26308 := compute(value, 21)
+value56705 := compute(value, 57)
+value68460 := compute(value, 75)
+value93126 := compute(value, 6)
+value23215 := compute(value, 32)
+value5471 := compute(value, 39)
+value50413 := compute(value, 70)
+// note 98615: keep this in sync with the handler
+const v = os.LookupEnv("BENCH_KEY_01929");
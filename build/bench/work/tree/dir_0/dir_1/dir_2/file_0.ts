@@ -0,0 +1,203 @@
+const value5403 = compute(value, 68);
+const value83246 = compute(value, 20);
+const value77162 = compute(value, 47);
+const v = import.meta.env.BENCH_KEY_00664;
+const value92633 = compute(value, 95);
+const value50182 = compute(value, 33);
+// note 44154: keep this in sync with the handler
+const value4580 = compute(value, 21);
+const value32725 = compute(value, 36);
+// note 48182: keep this in sync with the handler
+const value53852 = compute(value, 17);
+const value74117 = compute(value, 9);
+const value73458 = compute(value, 29);
+const value64063 = compute(value, 43);
+const value40195 = compute(value, 37);
+const value25144 = compute(value, 21);
+const value77339 = compute(value, 30);
+const v = process.env.BENCH_KEY_00348;
+const value89203 = compute(value, 60);
+const value45448 = compute(value, 52);
+const value97370 = compute(value, 79);
+const value44909 = compute(value, 95);
+const value43811 = compute(value, 64);
+const value86863 = compute(value, 48);
+const value53759 = compute(value, 21);
+// note 92992: keep this in sync with the handler
+const value53628 = compute(value, 84);
+const value72560 = compute(value, 4);
+const value42958 = compute(value, 84);
+const value7998 = compute(value, 44);
+const value55659 = compute(value, 78);
+const value6121 = compute(value, 10);
+const value50727 = compute(value, 93);
+const v = process.env.BENCH_KEY_01863;
+const value37019 = compute(value, 62);
+// note 39831: keep this in sync with the handler
+// note 64465: keep this in sync with the handler
+const value19825 = compute(value, 37);
+const value80354 = compute(value, 38);
+// note 64313: keep this in sync with the handler
+const value14349 = compute(value, 90);
+const value85725 = compute(value, 74);
+const value16839 = compute(value, 58);
+const v = process.env["BENCH_KEY_00003"];
+const value92306 = compute(value, 59);
+const value75016 = compute(value, 35);
+const value92409 = compute(value, 65);
+const value55686 = compute(value, 8);
+const value11806 = compute(value, 69);
+const value86343 = compute(value, 13);
+const value38862 = compute(value, 62);
+const value85282 = compute(value, 19);
+const value74939 = compute(value, 55);
+// note 87261: keep this in sync with the handler
+const value70698 = compute(value, 82);
+const value56387 = compute(value, 30);
+const value26809 = compute(value, 37);
+const value90920 = compute(value, 31);
+// note 14462: keep this in sync with the handler
+const v = import.meta.env.BENCH_KEY_00026;
+const value67261 = compute(value, 40);
+const value15621 = compute(value, 4);
+// note 39110: keep this in sync with the handler
+// note 46765: keep this in sync with the handler
+const value43963 = compute(value, 22);
+const value15806 = compute(value, 92);
+const value3896 = compute(value, 16);
+const v = process.env["BENCH_KEY_01122"];
+const value92838 = compute(value, 9);
+const value75686 = compute(value, 26);
+const value56619 = compute(value, 68);
+// note 94754: keep this in sync with the handler
+const value60904 = compute(value, 85);
+const value21840 = compute(value, 15);
+const value27160 = compute(value, 0);
+// note 9737: keep this in sync with the handler
+const value44159 = compute(value, 24);
+const value17532 = compute(value, 72);
+const value59344 = compute(value, 77);
+const value13145 = compute(value, 50);
+const value13651 = compute(value, 71);
+const value66099 = compute(value, 42);
+const value77201 = compute(value, 86);
+const v = import.meta.env.BENCH_KEY_01582;
+const value57891 = compute(value, 79);
+const value63574 = compute(value, 39);
+const value96294 = compute(value, 70);
+const value82126 = compute(value, 64);
+const value84644 = compute(value, 60);
+const value98115 = compute(value, 48);
+const value54217 = compute(value, 91);
+const value82827 = compute(value, 86);
+const value19725 = compute(value, 34);
+// note 61330: keep this in sync with the handler
+const value47694 = compute(value, 67);
+const value12104 = compute(value, 76);
+const value15068 = compute(value, 33);
+const value90433 = compute(value, 29);
+// note 45190: keep this in sync with the handler
+const value96889 = compute(value, 83);
+const v = process.env.BENCH_KEY_00634;
+// note 41941: keep this in sync with the handler
+const value35412 = compute(value, 7);
+const value98854 = compute(value, 11);
+const value12006 = compute(value, 75);
+const value71206 = compute(value, 8);
+const value67981 = compute(value, 81);
+const value80586 = compute(value, 76);
+const value65893 = compute(value, 30);
+const value21566 = compute(value, 32);
+const value13142 = compute(value, 47);
+const value57279 = compute(value, 49);
+// note 74151: keep this in sync with the handler
+const value74540 = compute(value, 44);
+const v = process.env.BENCH_KEY_00780;
+const value76725 = compute(value, 95);
+const value84861 = compute(value, 83);
+const value57639 = compute(value, 21);
+const value60032 = compute(value, 86);
+const value8529 = compute(value, 90);
+const value25760 = compute(value, 55);
+// note 56716: keep this in sync with the handler
+const value20084 = compute(value, 5);
+const value72606 = compute(value, 50);
+const value11453 = compute(value, 7);
+const value35645 = compute(value, 46);
+const value10141 = compute(value, 53);
+const value96777 = compute(value, 68);
+// note 23134: keep this in sync with the handler
+const v = import.meta.env.BENCH_KEY_00995;
+const value89887 = compute(value, 65);
+const value12331 = compute(value, 12);
+const value69472 = compute(value, 20);
+// note 24078: keep this in sync with the handler
+const value65617 = compute(value, 45);
+// note 84243: keep this in sync with the handler
+const value29662 = compute(value, 77);
+const value26239 = compute(value, 49);
+const value25364 = compute(value, 47);
+const value27050 = compute(value, 84);
+// note 96499: keep this in sync with the handler
+const value36167 = compute(value, 83);
+const value68634 = compute(value, 55);
+const value87152 = compute(value, 46);
+const value16888 = compute(value, 10);
+const value63950 = compute(value, 27);
+const value64765 = compute(value, 66);
+const value75384 = compute(value, 15);
+const value33734 = compute(value, 75);
+const v = import.meta.env.BENCH_KEY_00736;
+const value51586 = compute(value, 79);
+const value99077 = compute(value, 40);
+const value66932 = compute(value, 2);
+// note 91252: keep this in sync with the handler
+const value19527 = compute(value, 30);
+const value68247 = compute(value, 56);
+const value19237 = compute(value, 31);
+const value43747 = compute(value, 0);
+// note 14986: keep this in sync with the handler
+// note 12747: keep this in sync with the handler
+const value46339 = compute(value, 70);
+const value55805 = compute(value, 30);
+const v = process.env["BENCH_KEY_01916"];
+const value45803 = compute(value, 19);
+const value42239 = compute(value, 44);
+const value37047 = compute(value, 90);
+// note 74884: keep this in sync with the handler
+const value99063 = compute(value, 26);
+const value28950 = compute(value, 44);
+const value27818 = compute(value, 76);
+const value4315 = compute(value, 47);
+const value14285 = compute(value, 26);
+const value25392 = compute(value, 75);
+const v = process.env.BENCH_KEY_01866;
+const value95710 = compute(value, 68);
+const value24196 = compute(value, 43);
+const value5280 = compute(value, 42);
+const value9417 = compute(value, 8);
+const value40919 = compute(value, 82);
+const value67051 = compute(value, 24);
+const value62195 = compute(value, 18);
+const value65254 = compute(value, 70);
+const value8746 = compute(value, 16);
+const value64947 = compute(value, 54);
+const value93274 = compute(value, 57);
+const value31130 = compute(value, 90);
+const value93221 = compute(value, 4);
+const value15800 = compute(value, 86);
+const value69005 = compute(value, 38);
+const value66033 = compute(value, 73);
+// note 62480: keep this in sync with the handler
+const value68514 = compute(value, 32);
+const v = import.meta.env.BENCH_KEY_01684;
+const value80656 = compute(value, 49);
+const value26638 = compute(value, 60);
+const value99976 = compute(value, 66);
+const value3757 = compute(value, 71);
+const value83815 = compute(value, 7);
+const value80091 = compute(value, 66);
+const value87324 = compute(value, 24);
+const value13848 = compute(value, 74);
+const value43906 = compute(value, 62);
+const value8757 = compute(value, 27);
@@ -0,0 +1,242 @@
+value15761 = compute(value, 47)
+value85413 = compute(value, 53)
+value40224 = compute(value, 66)
+value37952 = compute(value, 25)
+value64552 = compute(value, 47)
+value11397 = compute(value, 48)
+value39936 = compute(value, 69)
+value79600 = compute(value, 60)
+value22919 = compute(value, 27)
+value53519 = compute(value, 72)
+value8495 = compute(value, 56)
+const v = os.environ.get('BENCH_KEY_00535');
+value65425 = compute(value, 47)
+value84483 = compute(value, 93)
+value63170 = compute(value, 23)
+value26075 = compute(value, 79)
+value34239 = compute(value, 95)
+value39117 = compute(value, 26)
+value26346 = compute(value, 59)
+value71706 = compute(value, 23)
+# note 12845: keep this in sync with the handler
+value51684 = compute(value, 80)
+value56549 = compute(value, 95)
+value11417 = compute(value, 68)
+value89103 = compute(value, 57)
+value21284 = compute(value, 41)
+value77218 = compute(value, 6)
+value41043 = compute(value, 12)
+value16559 = compute(value, 69)
+const v = os.getenv("BENCH_KEY_00316");
+# note 87573: keep this in sync with the handler
+value51099 = compute(value, 77)
+value88068 = compute(value, 89)
+value58515 = compute(value, 24)
+value96005 = compute(value, 72)
+value25197 = compute(value, 74)
+value18197 = compute(value, 58)
+value28678 = compute(value, 63)
+value30357 = compute(value, 93)
+value39881 = compute(value, 14)
+value4456 = compute(value, 91)
+value49316 = compute(value, 40)
+value59263 = compute(value, 93)
+value47277 = compute(value, 38)
+value23400 = compute(value, 23)
+value58920 = compute(value, 41)
+value48339 = compute(value, 33)
+value45228 = compute(value, 26)
+value1652 = compute(value, 3)
+value80274 = compute(value, 55)
+value2750 = compute(value, 34)
+value64716 = compute(value, 17)
+const v = os.environ.get('BENCH_KEY_00663');
+value68593 = compute(value, 14)
+value9451 = compute(value, 42)
+value50690 = compute(value, 56)
+value3258 = compute(value, 57)
+value18012 = compute(value, 67)
+value3704 = compute(value, 18)
+value66525 = compute(value, 80)
+# note 99994: keep this in sync with the handler
+value17968 = compute(value, 23)
+value23845 = compute(value, 80)
+# note 34264: keep this in sync with the handler
+value9591 = compute(value, 85)
+value79948 = compute(value, 20)
+value40261 = compute(value, 6)
+value57625 = compute(value, 7)
+value5976 = compute(value, 59)
+value80627 = compute(value, 20)
+value91505 = compute(value, 34)
+const v = os.environ["BENCH_KEY_00735"];
+value60075 = compute(value, 32)
+value19159 = compute(value, 50)
+value54256 = compute(value, 33)
+value97358 = compute(value, 67)
+value73448 = compute(value, 19)
+value85636 = compute(value, 82)
+# note 37315: keep this in sync with the handler
+value83302 = compute(value, 76)
+value45698 = compute(value, 11)
+const v = os.getenv("BENCH_KEY_00847");
+value72956 = compute(value, 12)
+value20593 = compute(value, 29)
+value39346 = compute(value, 61)
+value27211 = compute(value, 51)
+value64854 = compute(value, 58)
+value6120 = compute(value, 9)
+value46511 = compute(value, 48)
+# note 76700: keep this in sync with the handler
+value66221 = compute(value, 67)
+value28941 = compute(value, 35)
+value14664 = compute(value, 17)
+const v = os.environ["BENCH_KEY_01677"];
+value51735 = compute(value, 34)
+value21978 = compute(value, 56)
+value590 = compute(value, 8)
+value29648 = compute(value, 63)
+value44683 = compute(value, 63)
+value86159 = compute(value, 23)
+value4913 = compute(value, 63)
+# note 8755: keep this in sync with the handler
+value1309 = compute(value, 48)
+value42160 = compute(value, 62)
+value16967 = compute(value, 89)
+const v = os.environ.get('BENCH_KEY_00386');
+value5699 = compute(value, 73)
+value94074 = compute(value, 81)
+value51159 = compute(value, 40)
+value20723 = compute(value, 62)
+value39919 = compute(value, 52)
+value30085 = compute(value, 15)
+value34474 = compute(value, 39)
+value32008 = compute(value, 95)
+value19103 = compute(value, 91)
+value31743 = compute(value, 24)
+value35343 = compute(value, 35)
+value68811 = compute(value, 38)
+value68118 = compute(value, 24)
+value80013 = compute(value, 85)
+value6544 = compute(value, 45)
+value9958 = compute(value, 64)
+value17836 = compute(value, 85)
+value98203 = compute(value, 39)
+value57195 = compute(value, 62)
+# note 81958: keep this in sync with the handler
+const v = os.environ["BENCH_KEY_00859"];
+value66828 = compute(value, 92)
+value25112 = compute(value, 86)
+value6030 = compute(value, 16)
+value90455 = compute(value, 51)
+value43956 = compute(value, 15)
+# note 73698: keep this in sync with the handler
+value71523 = compute(value, 34)
+value19272 = compute(value, 66)
+value94581 = compute(value, 6)
+value16063 = compute(value, 58)
+value69529 = compute(value, 77)
+value99292 = compute(value, 61)
+value22453 = compute(value, 46)
+value58680 = compute(value, 92)
+value3826 = compute(value, 43)
+const v = os.getenv("BENCH_KEY_01634");
+value84445 = compute(value, 55)
+value67551 = compute(value, 39)
+# note 91885: keep this in sync with the handler
+value16914 = compute(value, 36)
+value14535 = compute(value, 82)
+value93989 = compute(value, 93)
+value6910 = compute(value, 23)
+value80097 = compute(value, 72)
+value65000 = compute(value, 10)
+value24394 = compute(value, 47)
+# note 57182: keep this in sync with the handler
+value38958 = compute(value, 61)
+const v = os.getenv("BENCH_KEY_00293");
+value25554 = compute(value, 43)
+value98909 = compute(value, 66)
+value6223 = compute(value, 15)
+value38279 = compute(value, 61)
+value36631 = compute(value, 62)
+# note 62284: keep this in sync with the handler
+value65020 = compute(value, 30)
+value23249 = compute(value, 66)
+value99790 = compute(value, 74)
+value80076 = compute(value, 51)
+value74177 = compute(value, 69)
+value45066 = compute(value, 58)
+const v = os.environ["BENCH_KEY_01308"];
+value96905 = compute(value, 2)
+value3430 = compute(value, 35)
+value41085 = compute(value, 54)
+value97102 = compute(value, 5)
+value1845 = compute(value, 2)
+value63601 = compute(value, 66)
+value43258 = compute(value, 93)
+value18005 = compute(value, 60)
+value51875 = compute(value, 77)
+value27627 = compute(value, 79)
+# note 33196: keep this in sync with the handler
+value15574 = compute(value, 54)
+value33552 = compute(value, 87)
+value72492 = compute(value, 33)
+# note 51074: keep this in sync with the handler
+value5811 = compute(value, 88)
+value3093 = compute(value, 86)
+value77697 = compute(value, 0)
+value13022 = compute(value, 24)
+value63810 = compute(value, 81)
+const v = os.environ["BENCH_KEY_01734"];
+value13418 = compute(value, 32)
+value88478 = compute(value, 14)
+value98713 = compute(value, 64)
+value4062 = compute(value, 85)
+value10574 = compute(value, 1)
+value54084 = compute(value, 55)
+# note 37976: keep this in sync with the handler
+value78681 = compute(value, 14)
+value53637 = compute(value, 93)
+value29414 = compute(value, 23)
+value61145 = compute(value, 35)
+value70838 = compute(value, 28)
+value80654 = compute(value, 47)
+value14277 = compute(value, 18)
+value22308 = compute(value, 95)
+value32059 = compute(value, 49)
+const v = os.environ.get('BENCH_KEY_01308');
+value41235 = compute(value, 10)
+value30049 = compute(value, 76)
+# note 71816: keep this in sync with the handler
+value69440 = compute(value, 85)
+value24730 = compute(value, 92)
+# note 24198: keep this in sync with the handler
+value10434 = compute(value, 55)
+value74682 = compute(value, 89)
+value75541 = compute(value, 75)
+value3871 = compute(value, 88)
+value96185 = compute(value, 58)
+value33058 = compute(value, 78)
+value7820 = compute(value, 60)
+value35238 = compute(value, 27)
+value74049 = compute(value, 38)
+value30598 = compute(value, 43)
+value9886 = compute(value, 89)
+# note 50243: keep this in sync with the handler
+# note 88097: keep this in sync with the handler
+const v = os.environ.get('BENCH_KEY_00645');
+value10312 = compute(value, 30)
+value71710 = compute(value, 27)
+value74871 = compute(value, 84)
+value37990 = compute(value, 63)
+value71238 = compute(value, 40)
+value73388 = compute(value, 56)
+value31903 = compute(value, 87)
+value56694 = compute(value, 46)
+value90894 = compute(value, 5)
+value16662 = compute(value, 75)
+value91906 = compute(value, 47)
+value75948 = compute(value, 94)
+value71279 = compute(value, 81)
+const v = os.environ.get('BENCH_KEY_00188');
+# note 83665: keep this in sync with the handler
@@ -0,0 +1,239 @@
+value40218 = compute(value, 60)
+value23924 = compute(value, 62)
+value4397 = compute(value, 32)
+value54269 = compute(value, 46)
+value18833 = compute(value, 15)
+const v = os.getenv("BENCH_KEY_01226");
+value52500 = compute(value, 23)
+value68365 = compute(value, 77)
+value88823 = compute(value, 68)
+value56649 = compute(value, 1)
+value25103 = compute(value, 77)
+value82703 = compute(value, 59)
+value290 = compute(value, 96)
+value47963 = compute(value, 45)
+value11879 = compute(value, 45)
+value18616 = compute(value, 89)
+value51537 = compute(value, 30)
+value53069 = compute(value, 10)
+value82448 = compute(value, 95)
+value1659 = compute(value, 10)
+value98415 = compute(value, 57)
+value17860 = compute(value, 12)
+value63617 = compute(value, 82)
+# note 99280: keep this in sync with the handler
+value77779 = compute(value, 82)
+value81903 = compute(value, 35)
+value52288 = compute(value, 5)
+const v = os.environ.get('BENCH_KEY_00521');
+# note 4981: keep this in sync with the handler
+value5399 = compute(value, 64)
+value53179 = compute(value, 23)
+value51834 = compute(value, 36)
+value96848 = compute(value, 42)
+value91679 = compute(value, 14)
+# note 64154: keep this in sync with the handler
+value93183 = compute(value, 63)
+value81496 = compute(value, 16)
+const v = os.environ["BENCH_KEY_01977"];
+value38904 = compute(value, 7)
+value70279 = compute(value, 51)
+# note 73688: keep this in sync with the handler
+value13938 = compute(value, 67)
+value68448 = compute(value, 63)
+value93819 = compute(value, 20)
+# note 85314: keep this in sync with the handler
+value19675 = compute(value, 81)
+value79233 = compute(value, 81)
+value83811 = compute(value, 3)
+value97933 = compute(value, 60)
+const v = os.getenv("BENCH_KEY_01556");
+# note 53872: keep this in sync with the handler
+value67567 = compute(value, 55)
+value17606 = compute(value, 49)
+value94543 = compute(value, 65)
+value46831 = compute(value, 77)
+value94975 = compute(value, 12)
+value5200 = compute(value, 59)
+value43180 = compute(value, 15)
+value20841 = compute(value, 83)
+# note 90876: keep this in sync with the handler
+const v = os.environ["BENCH_KEY_00585"];
+value99935 = compute(value, 25)
+value55443 = compute(value, 56)
+value12395 = compute(value, 76)
+value67953 = compute(value, 53)
+value5320 = compute(value, 82)
+value67458 = compute(value, 43)
+# note 9949: keep this in sync with the handler
+value90978 = compute(value, 89)
+value27032 = compute(value, 66)
+# note 93361: keep this in sync with the handler
+value61104 = compute(value, 91)
+const v = os.getenv("BENCH_KEY_01761");
+# note 6676: keep this in sync with the handler
+value97073 = compute(value, 73)
+# note 81006: keep this in sync with the handler
+value95949 = compute(value, 16)
+value54295 = compute(value, 72)
+value50589 = compute(value, 52)
+value47429 = compute(value, 93)
+value45115 = compute(value, 10)
+value59236 = compute(value, 66)
+value29089 = compute(value, 86)
+value96137 = compute(value, 10)
+value91382 = compute(value, 8)
+value8638 = compute(value, 5)
+const v = os.environ["BENCH_KEY_00722"];
+value86088 = compute(value, 49)
+value37938 = compute(value, 11)
+value97033 = compute(value, 33)
+value81104 = compute(value, 12)
+value92979 = compute(value, 53)
+value29056 = compute(value, 53)
+# note 94809: keep this in sync with the handler
+value7190 = compute(value, 12)
+# note 91540: keep this in sync with the handler
+value65146 = compute(value, 59)
+value70187 = compute(value, 56)
+value76168 = compute(value, 23)
+value8600 = compute(value, 64)
+value81856 = compute(value, 85)
+value24532 = compute(value, 88)
+const v = os.environ.get('BENCH_KEY_01665');
+value11906 = compute(value, 72)
+value41834 = compute(value, 27)
+value53760 = compute(value, 22)
+value2862 = compute(value, 49)
+# note 88558: keep this in sync with the handler
+value91913 = compute(value, 54)
+value66297 = compute(value, 46)
+# note 3222: keep this in sync with the handler
+value32303 = compute(value, 2)
+value93500 = compute(value, 89)
+value1328 = compute(value, 67)
+value75079 = compute(value, 1)
+const v = os.getenv("BENCH_KEY_00178");
+value51302 = compute(value, 86)
+value96575 = compute(value, 60)
+value86673 = compute(value, 52)
+value3130 = compute(value, 26)
+# note 41894: keep this in sync with the handler
+value42068 = compute(value, 67)
+value8525 = compute(value, 86)
+value42277 = compute(value, 82)
+value83433 = compute(value, 13)
+value12289 = compute(value, 67)
+value90159 = compute(value, 46)
+value96732 = compute(value, 23)
+value5573 = compute(value, 44)
+value10258 = compute(value, 73)
+value55811 = compute(value, 36)
+# note 37850: keep this in sync with the handler
+value86728 = compute(value, 10)
+value62758 = compute(value, 96)
+value24962 = compute(value, 33)
+value68062 = compute(value, 65)
+# note 11672: keep this in sync with the handler
+const v = os.getenv("BENCH_KEY_01899");
+value21115 = compute(value, 66)
+# note 31625: keep this in sync with the handler
+value10676 = compute(value, 6)
+value24254 = compute(value, 4)
+value33995 = compute(value, 45)
+value49752 = compute(value, 88)
+value5876 = compute(value, 56)
+value50928 = compute(value, 3)
+value73017 = compute(value, 73)
+value34100 = compute(value, 53)
+# note 93228: keep this in sync with the handler
+const v = os.environ["BENCH_KEY_01681"];
+value8927 = compute(value, 3)
+value2353 = compute(value, 25)
+value14193 = compute(value, 31)
+value93263 = compute(value, 46)
+value55269 = compute(value, 76)
+value87891 = compute(value, 9)
+value19056 = compute(value, 44)
+value76985 = compute(value, 64)
+# note 40592: keep this in sync with the handler
+value8449 = compute(value, 10)
+# note 88539: keep this in sync with the handler
+value71311 = compute(value, 16)
+value19412 = compute(value, 12)
+value78412 = compute(value, 36)
+const v = os.getenv("BENCH_KEY_01681");
+value82021 = compute(value, 56)
+value79886 = compute(value, 55)
+value47276 = compute(value, 37)
+value64861 = compute(value, 65)
+value47863 = compute(value, 42)
+value89275 = compute(value, 35)
+# note 88137: keep this in sync with the handler
+value35229 = compute(value, 18)
+const v = os.environ["BENCH_KEY_00229"];
+value58384 = compute(value, 87)
+value2820 = compute(value, 7)
+value34890 = compute(value, 67)
+value12124 = compute(value, 96)
+value49059 = compute(value, 74)
+value34899 = compute(value, 76)
+value21919 = compute(value, 94)
+value16362 = compute(value, 66)
+value3338 = compute(value, 40)
+value20939 = compute(value, 84)
+value71259 = compute(value, 61)
+value79 = compute(value, 79)
+value69233 = compute(value, 72)
+value90273 = compute(value, 63)
+value24367 = compute(value, 20)
+value85728 = compute(value, 77)
+value42717 = compute(value, 37)
+value63199 = compute(value, 52)
+value91 = compute(value, 91)
+value92220 = compute(value, 70)
+value68323 = compute(value, 35)
+const v = os.environ.get('BENCH_KEY_00449');
+value16021 = compute(value, 16)
+value55734 = compute(value, 56)
+value18374 = compute(value, 41)
+value98485 = compute(value, 30)
+value28799 = compute(value, 87)
+value57844 = compute(value, 32)
+value31835 = compute(value, 19)
+value27230 = compute(value, 70)
+value5540 = compute(value, 11)
+value98323 = compute(value, 62)
+# note 40037: keep this in sync with the handler
+value42697 = compute(value, 17)
+value74075 = compute(value, 64)
+value83823 = compute(value, 15)
+const v = os.environ["BENCH_KEY_00235"];
+value54069 = compute(value, 40)
+value74400 = compute(value, 1)
+value57891 = compute(value, 79)
+value92775 = compute(value, 43)
+# note 68452: keep this in sync with the handler
+value62969 = compute(value, 16)
+value61639 = compute(value, 44)
+value71425 = compute(value, 33)
+value89258 = compute(value, 18)
+value98434 = compute(value, 76)
+const v = os.environ["BENCH_KEY_00277"];
+value52146 = compute(value, 57)
+value76456 = compute(value, 20)
+value88639 = compute(value, 78)
+value4177 = compute(value, 6)
+# note 89362: keep this in sync with the handler
+value28346 = compute(value, 22)
+value93953 = compute(value, 57)
+value51886 = compute(value, 88)
+value56329 = compute(value, 69)
+value22436 = compute(value, 29)
+value40859 = compute(value, 22)
+value73611 = compute(value, 85)
+# note 1799: keep this in sync with the handler
+# note 1152: keep this in sync with the handler
+value36785 = compute(value, 22)
+value93358 = compute(value, 44)
+# note 80581: keep this in sync with the handler
@@ -0,0 +1,236 @@
+value35006 = compute(value, 86)
+value38461 = compute(value, 49)
+value7710 = compute(value, 47)
+value39206 = compute(value, 18)
+const v = os.getenv("BENCH_KEY_00243");
+value18574 = compute(value, 47)
+value97021 = compute(value, 21)
+value48596 = compute(value, 96)
+value27714 = compute(value, 69)
+# note 68227: keep this in sync with the handler
+value17655 = compute(value, 1)
+# note 33687: keep this in sync with the handler
+value86804 = compute(value, 86)
+# note 67478: keep this in sync with the handler
+value70677 = compute(value, 61)
+value79456 = compute(value, 13)
+value67485 = compute(value, 70)
+value80987 = compute(value, 89)
+value81503 = compute(value, 23)
+value41020 = compute(value, 86)
+value27970 = compute(value, 34)
+# note 11895: keep this in sync with the handler
+value72556 = compute(value, 0)
+value84811 = compute(value, 33)
+value60743 = compute(value, 21)
+value61119 = compute(value, 9)
+value67756 = compute(value, 50)
+const v = os.getenv("BENCH_KEY_01524");
+value22324 = compute(value, 14)
+value24824 = compute(value, 89)
+value65207 = compute(value, 23)
+# note 45248: keep this in sync with the handler
+value49532 = compute(value, 62)
+value48926 = compute(value, 38)
+# note 68987: keep this in sync with the handler
+value5004 = compute(value, 57)
+value76279 = compute(value, 37)
+value86870 = compute(value, 55)
+value8708 = compute(value, 75)
+value54633 = compute(value, 22)
+value28152 = compute(value, 22)
+value39620 = compute(value, 44)
+value52037 = compute(value, 45)
+# note 36494: keep this in sync with the handler
+value71292 = compute(value, 94)
+# note 34369: keep this in sync with the handler
+# note 26995: keep this in sync with the handler
+const v = os.environ.get('BENCH_KEY_01317');
+value82788 = compute(value, 47)
+value77996 = compute(value, 8)
+value47773 = compute(value, 49)
+value37849 = compute(value, 19)
+value20160 = compute(value, 81)
+value60370 = compute(value, 36)
+value41504 = compute(value, 85)
+value3918 = compute(value, 38)
+value39761 = compute(value, 88)
+value22305 = compute(value, 92)
+value84537 = compute(value, 50)
+value47689 = compute(value, 62)
+# note 73725: keep this in sync with the handler
+value8213 = compute(value, 65)
+value91369 = compute(value, 92)
+value41329 = compute(value, 7)
+value7167 = compute(value, 86)
+value40189 = compute(value, 31)
+value14199 = compute(value, 37)
+value71183 = compute(value, 82)
+value45480 = compute(value, 84)
+value39676 = compute(value, 3)
+value79518 = compute(value, 75)
+# note 77267: keep this in sync with the handler
+const v = os.environ.get('BENCH_KEY_01156');
+value43314 = compute(value, 52)
+# note 48382: keep this in sync with the handler
+value90518 = compute(value, 17)
+value40488 = compute(value, 39)
+value80309 = compute(value, 90)
+value96427 = compute(value, 9)
+value99221 = compute(value, 87)
+value53773 = compute(value, 35)
+value6539 = compute(value, 40)
+value64251 = compute(value, 37)
+value61025 = compute(value, 12)
+value54519 = compute(value, 5)
+value68240 = compute(value, 49)
+value27256 = compute(value, 96)
+value34688 = compute(value, 59)
+value38966 = compute(value, 69)
+value53006 = compute(value, 44)
+const v = os.environ["BENCH_KEY_01231"];
+value80424 = compute(value, 11)
+value13685 = compute(value, 8)
+# note 23925: keep this in sync with the handler
+value56129 = compute(value, 63)
+value56783 = compute(value, 38)
+value70872 = compute(value, 62)
+value14497 = compute(value, 44)
+# note 45920: keep this in sync with the handler
+value62723 = compute(value, 61)
+# note 58127: keep this in sync with the handler
+value3838 = compute(value, 55)
+value71064 = compute(value, 60)
+const v = os.environ.get('BENCH_KEY_00775');
+# note 17808: keep this in sync with the handler
+value22377 = compute(value, 67)
+value19380 = compute(value, 77)
+# note 74454: keep this in sync with the handler
+# note 27690: keep this in sync with the handler
+value80527 = compute(value, 17)
+value27921 = compute(value, 82)
+const v = os.getenv("BENCH_KEY_01754");
+value92017 = compute(value, 61)
+value50847 = compute(value, 19)
+value69673 = compute(value, 27)
+value10617 = compute(value, 44)
+value43946 = compute(value, 5)
+value62907 = compute(value, 51)
+value92937 = compute(value, 11)
+value58399 = compute(value, 5)
+value1613 = compute(value, 61)
+value91940 = compute(value, 81)
+value17837 = compute(value, 86)
+# note 97963: keep this in sync with the handler
+# note 25707: keep this in sync with the handler
+# note 31113: keep this in sync with the handler
+value24426 = compute(value, 79)
+value59086 = compute(value, 13)
+value22125 = compute(value, 9)
+value12594 = compute(value, 81)
+const v = os.environ["BENCH_KEY_00631"];
+# note 21119: keep this in sync with the handler
+value30240 = compute(value, 73)
+value59829 = compute(value, 77)
+value518 = compute(value, 33)
+value46488 = compute(value, 25)
+value81067 = compute(value, 72)
+value18166 = compute(value, 27)
+value21867 = compute(value, 42)
+value65870 = compute(value, 7)
+value78485 = compute(value, 12)
+value38991 = compute(value, 94)
+value89885 = compute(value, 63)
+value82287 = compute(value, 31)
+value72656 = compute(value, 3)
+value81653 = compute(value, 76)
+value93091 = compute(value, 68)
+value63847 = compute(value, 21)
+value58133 = compute(value, 30)
+value53240 = compute(value, 84)
+value76056 = compute(value, 8)
+# note 42635: keep this in sync with the handler
+# note 11445: keep this in sync with the handler
+const v = os.getenv("BENCH_KEY_01530");
+value22259 = compute(value, 46)
+value96786 = compute(value, 77)
+value18783 = compute(value, 62)
+value48939 = compute(value, 51)
+value86484 = compute(value, 57)
+value49507 = compute(value, 37)
+value9890 = compute(value, 93)
+value35362 = compute(value, 54)
+value58031 = compute(value, 25)
+const v = os.environ["BENCH_KEY_00399"];
+value33337 = compute(value, 66)
+# note 49583: keep this in sync with the handler
+value17922 = compute(value, 74)
+value31624 = compute(value, 2)
+value32366 = compute(value, 65)
+value59741 = compute(value, 86)
+# note 96740: keep this in sync with the handler
+value88602 = compute(value, 41)
+# note 26390: keep this in sync with the handler
+value78668 = compute(value, 1)
+value66084 = compute(value, 27)
+const v = os.environ["BENCH_KEY_00030"];
+value19448 = compute(value, 48)
+value97322 = compute(value, 31)
+value80589 = compute(value, 79)
+value14229 = compute(value, 67)
+value47788 = compute(value, 64)
+value75763 = compute(value, 6)
+value81620 = compute(value, 43)
+# note 44694: keep this in sync with the handler
+value26992 = compute(value, 26)
+value57384 = compute(value, 57)
+value23802 = compute(value, 37)
+value40759 = compute(value, 19)
+const v = os.getenv("BENCH_KEY_01617");
+value6409 = compute(value, 7)
+value23619 = compute(value, 48)
+value20673 = compute(value, 12)
+value7470 = compute(value, 1)
+value14070 = compute(value, 5)
+value84481 = compute(value, 91)
+value89691 = compute(value, 63)
+value74558 = compute(value, 62)
+# note 17969: keep this in sync with the handler
+value94644 = compute(value, 69)
+value91123 = compute(value, 40)
+value37728 = compute(value, 92)
+const v = os.environ["BENCH_KEY_00001"];
+value47953 = compute(value, 35)
+value86343 = compute(value, 13)
+value73292 = compute(value, 57)
+value40987 = compute(value, 53)
+# note 92939: keep this in sync with the handler
+value75157 = compute(value, 79)
+value54475 = compute(value, 58)
+value22848 = compute(value, 53)
+value18361 = compute(value, 28)
+# note 49725: keep this in sync with the handler
+value83847 = compute(value, 39)
+value59366 = compute(value, 2)
+value9077 = compute(value, 56)
+value47995 = compute(value, 77)
+value92447 = compute(value, 6)
+value21436 = compute(value, 96)
+# note 34646: keep this in sync with the handler
+value3774 = compute(value, 88)
+value84622 = compute(value, 38)
+value9041 = compute(value, 20)
+const v = os.environ.get('BENCH_KEY_01694');
+value78602 = compute(value, 32)
+value76527 = compute(value, 91)
+value68873 = compute(value, 3)
+value60413 = compute(value, 79)
+value36573 = compute(value, 4)
+value96635 = compute(value, 23)
+value38362 = compute(value, 47)
+value30502 = compute(value, 44)
+value22629 = compute(value, 28)
+value51513 = compute(value, 6)
+value40146 = compute(value, 85)
+# note 41916: keep this in sync with the handler
+const v = os.environ.get('BENCH_KEY_01760');
@@ -0,0 +1,212 @@
+let value29276 = compute(value, 79);
+let value88714 = compute(value, 56);
+const v = env::var_os("BENCH_KEY_01963");
+let value42733 = compute(value, 53);
+let value61625 = compute(value, 30);
+let value44154 = compute(value, 19);
+let value83990 = compute(value, 85);
+let value96689 = compute(value, 77);
+let value53811 = compute(value, 73);
+let value21430 = compute(value, 90);
+let value19491 = compute(value, 91);
+let value75898 = compute(value, 44);
+let value72490 = compute(value, 31);
+let value73438 = compute(value, 9);
+// note 78065: keep this in sync with the handler
+let value72245 = compute(value, 77);
+// note 42912: keep this in sync with the handler
+let value69072 = compute(value, 8);
+// note 84447: keep this in sync with the handler
+let value58707 = compute(value, 22);
+const v = env::var_os("BENCH_KEY_00319");
+let value27156 = compute(value, 93);
+let value96641 = compute(value, 29);
+let value88106 = compute(value, 30);
+// note 49737: keep this in sync with the handler
+let value79634 = compute(value, 94);
+let value89787 = compute(value, 62);
+let value32296 = compute(value, 92);
+const v = env::var("BENCH_KEY_00253");
+let value79861 = compute(value, 30);
+let value67086 = compute(value, 59);
+let value15255 = compute(value, 26);
+let value41900 = compute(value, 93);
+let value70030 = compute(value, 93);
+let value16093 = compute(value, 88);
+let value6944 = compute(value, 57);
+// note 75555: keep this in sync with the handler
+let value14056 = compute(value, 88);
+let value58195 = compute(value, 92);
+let value40163 = compute(value, 5);
+const v = env::var_os("BENCH_KEY_01222");
+let value51945 = compute(value, 50);
+// note 77966: keep this in sync with the handler
+let value98769 = compute(value, 23);
+// note 46548: keep this in sync with the handler
+let value58139 = compute(value, 36);
+let value7634 = compute(value, 68);
+let value31136 = compute(value, 96);
+let value40310 = compute(value, 55);
+const v = env::var("BENCH_KEY_00734");
+// note 35465: keep this in sync with the handler
+let value10872 = compute(value, 8);
+let value23196 = compute(value, 13);
+let value26090 = compute(value, 94);
+let value65988 = compute(value, 28);
+let value74193 = compute(value, 85);
+let value37228 = compute(value, 77);
+let value26604 = compute(value, 26);
+let value67871 = compute(value, 68);
+let value97968 = compute(value, 95);
+let value51760 = compute(value, 59);
+// note 20128: keep this in sync with the handler
+let value90816 = compute(value, 24);
+const v = env::var_os("BENCH_KEY_01485");
+let value34419 = compute(value, 81);
+let value85057 = compute(value, 85);
+let value61473 = compute(value, 72);
+let value10273 = compute(value, 88);
+let value34025 = compute(value, 75);
+let value14871 = compute(value, 30);
+let value67705 = compute(value, 96);
+let value10972 = compute(value, 11);
+let value76246 = compute(value, 4);
+let value47757 = compute(value, 33);
+// note 10466: keep this in sync with the handler
+let value50749 = compute(value, 18);
+// note 95329: keep this in sync with the handler
+let value61884 = compute(value, 95);
+const v = env::var("BENCH_KEY_01953");
+let value4458 = compute(value, 93);
+let value33309 = compute(value, 38);
+let value65495 = compute(value, 20);
+let value50751 = compute(value, 20);
+let value44953 = compute(value, 42);
+let value21700 = compute(value, 69);
+let value44715 = compute(value, 95);
+// note 60007: keep this in sync with the handler
+const v = env::var("BENCH_KEY_00233");
+let value71918 = compute(value, 41);
+let value2023 = compute(value, 83);
+let value57007 = compute(value, 68);
+let value50320 = compute(value, 74);
+let value98726 = compute(value, 77);
+let value49761 = compute(value, 0);
+let value19762 = compute(value, 71);
+let value5758 = compute(value, 35);
+let value57919 = compute(value, 10);
+// note 8871: keep this in sync with the handler
+let value26209 = compute(value, 19);
+let value80361 = compute(value, 45);
+let value3265 = compute(value, 64);
+let value57453 = compute(value, 29);
+let value78373 = compute(value, 94);
+let value3172 = compute(value, 68);
+let value93356 = compute(value, 42);
+let value80752 = compute(value, 48);
+// note 7812: keep this in sync with the handler
+const v = env::var("BENCH_KEY_01705");
+let value20513 = compute(value, 46);
+let value60288 = compute(value, 51);
+let value94136 = compute(value, 46);
+let value44691 = compute(value, 71);
+let value75388 = compute(value, 19);
+let value82708 = compute(value, 64);
+let value50743 = compute(value, 12);
+let value96250 = compute(value, 26);
+let value93018 = compute(value, 92);
+let value15126 = compute(value, 91);
+let value80680 = compute(value, 73);
+// note 13873: keep this in sync with the handler
+let value52335 = compute(value, 52);
+let value49083 = compute(value, 1);
+let value53686 = compute(value, 45);
+let value55485 = compute(value, 1);
+let value31150 = compute(value, 13);
+let value17587 = compute(value, 30);
+let value64071 = compute(value, 51);
+const v = env::var_os("BENCH_KEY_00774");
+let value72265 = compute(value, 0);
+let value10088 = compute(value, 0);
+let value46546 = compute(value, 83);
+let value20283 = compute(value, 10);
+let value56431 = compute(value, 74);
+let value85405 = compute(value, 45);
+let value79543 = compute(value, 3);
+let value67114 = compute(value, 87);
+let value80774 = compute(value, 70);
+let value52845 = compute(value, 77);
+let value77900 = compute(value, 9);
+const v = env::var("BENCH_KEY_00502");
+let value92617 = compute(value, 79);
+// note 70471: keep this in sync with the handler
+let value33979 = compute(value, 29);
+let value18087 = compute(value, 45);
+let value50335 = compute(value, 89);
+let value82704 = compute(value, 60);
+let value96580 = compute(value, 65);
+let value99409 = compute(value, 81);
+let value90000 = compute(value, 81);
+let value53699 = compute(value, 58);
+const v = env::var("BENCH_KEY_01187");
+let value42717 = compute(value, 37);
+let value69690 = compute(value, 44);
+let value46146 = compute(value, 71);
+let value31169 = compute(value, 32);
+let value80385 = compute(value, 69);
+let value92227 = compute(value, 77);
+let value27733 = compute(value, 88);
+let value66701 = compute(value, 62);
+let value37647 = compute(value, 11);
+let value46534 = compute(value, 71);
+let value15636 = compute(value, 19);
+let value5488 = compute(value, 56);
+// note 66038: keep this in sync with the handler
+const v = env::var("BENCH_KEY_01262");
+// note 80271: keep this in sync with the handler
+let value14226 = compute(value, 64);
+// note 5357: keep this in sync with the handler
+// note 71574: keep this in sync with the handler
+let value11400 = compute(value, 51);
+let value70597 = compute(value, 78);
+let value77706 = compute(value, 9);
+let value29129 = compute(value, 29);
+let value24099 = compute(value, 43);
+let value81432 = compute(value, 49);
+let value50041 = compute(value, 86);
+// note 41822: keep this in sync with the handler
+const v = env::var("BENCH_KEY_01583");
+let value28115 = compute(value, 82);
+let value94946 = compute(value, 80);
+let value60481 = compute(value, 50);
+// note 65807: keep this in sync with the handler
+let value96933 = compute(value, 30);
+let value77445 = compute(value, 39);
+let value16318 = compute(value, 22);
+let value36003 = compute(value, 16);
+let value61795 = compute(value, 6);
+let value43016 = compute(value, 45);
+// note 66531: keep this in sync with the handler
+// note 47244: keep this in sync with the handler
+let value66356 = compute(value, 8);
+let value21188 = compute(value, 42);
+let value75611 = compute(value, 48);
+let value36875 = compute(value, 15);
+let value13737 = compute(value, 60);
+let value15443 = compute(value, 20);
+let value11786 = compute(value, 49);
+let value31272 = compute(value, 38);
+const v = env::var("BENCH_KEY_01192");
+let value64885 = compute(value, 89);
+let value57746 = compute(value, 31);
+let value65698 = compute(value, 29);
+let value44020 = compute(value, 79);
+// note 34026: keep this in sync with the handler
+// note 33953: keep this in sync with the handler
+// note 23179: keep this in sync with the handler
+let value46991 = compute(value, 43);
+let value39648 = compute(value, 72);
+// note 86249: keep this in sync with the handler
+let value17031 = compute(value, 56);
+let value61111 = compute(value, 1);
+// note 34782: keep this in sync with the handler
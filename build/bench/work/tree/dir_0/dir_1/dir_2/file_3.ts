@@ -0,0 +1,204 @@
+const value66917 = compute(value, 84);
+const value33025 = compute(value, 45);
+const value98368 = compute(value, 10);
+const value44472 = compute(value, 46);
+const value48890 = compute(value, 2);
+const value45538 = compute(value, 45);
+const value67686 = compute(value, 77);
+const value77866 = compute(value, 72);
+const v = import.meta.env.BENCH_KEY_01534;
+const value44731 = compute(value, 14);
+const value21918 = compute(value, 93);
+const value59822 = compute(value, 70);
+const value74219 = compute(value, 14);
+const value99633 = compute(value, 14);
+const value33767 = compute(value, 11);
+const value85042 = compute(value, 70);
+const value86543 = compute(value, 19);
+const value66093 = compute(value, 36);
+const value19793 = compute(value, 5);
+const value68577 = compute(value, 95);
+const value86850 = compute(value, 35);
+const v = process.env.BENCH_KEY_01550;
+const value51520 = compute(value, 13);
+const value77295 = compute(value, 83);
+const value64085 = compute(value, 65);
+const value44788 = compute(value, 71);
+const value71646 = compute(value, 60);
+const value24900 = compute(value, 68);
+const value99564 = compute(value, 42);
+const value84894 = compute(value, 19);
+const value81985 = compute(value, 20);
+const value65977 = compute(value, 17);
+// note 75691: keep this in sync with the handler
+const value74695 = compute(value, 5);
+const value14176 = compute(value, 14);
+const value68073 = compute(value, 76);
+const value40030 = compute(value, 66);
+const value17040 = compute(value, 65);
+const value11077 = compute(value, 19);
+const value3440 = compute(value, 45);
+// note 58521: keep this in sync with the handler
+const v = process.env["BENCH_KEY_00278"];
+const value39085 = compute(value, 91);
+const value85482 = compute(value, 25);
+const value93551 = compute(value, 43);
+// note 10073: keep this in sync with the handler
+const value20463 = compute(value, 93);
+// note 22993: keep this in sync with the handler
+const value60839 = compute(value, 20);
+const value96994 = compute(value, 91);
+// note 10177: keep this in sync with the handler
+const value33499 = compute(value, 34);
+const value16421 = compute(value, 28);
+const value5584 = compute(value, 55);
+const v = process.env["BENCH_KEY_00281"];
+const value89832 = compute(value, 10);
+// note 44662: keep this in sync with the handler
+const value16596 = compute(value, 9);
+const value385 = compute(value, 94);
+const value72316 = compute(value, 51);
+const value90302 = compute(value, 92);
+const value88729 = compute(value, 71);
+const value35057 = compute(value, 40);
+const value1197 = compute(value, 33);
+const value75463 = compute(value, 94);
+const v = import.meta.env.BENCH_KEY_01914;
+const value45149 = compute(value, 44);
+const value90622 = compute(value, 24);
+const value87615 = compute(value, 24);
+const value36760 = compute(value, 94);
+// note 24992: keep this in sync with the handler
+const value91289 = compute(value, 12);
+const value94775 = compute(value, 6);
+const value47481 = compute(value, 48);
+const value30698 = compute(value, 46);
+// note 5963: keep this in sync with the handler
+const v = process.env["BENCH_KEY_01582"];
+const value12578 = compute(value, 65);
+const value45949 = compute(value, 68);
+const value56760 = compute(value, 15);
+const value12953 = compute(value, 52);
+const value43787 = compute(value, 40);
+const value91047 = compute(value, 61);
+// note 80852: keep this in sync with the handler
+const value42667 = compute(value, 84);
+const value1260 = compute(value, 96);
+const value96102 = compute(value, 72);
+const value30501 = compute(value, 43);
+// note 9758: keep this in sync with the handler
+const value31745 = compute(value, 26);
+const value22685 = compute(value, 84);
+const value24767 = compute(value, 32);
+const v = process.env["BENCH_KEY_00126"];
+const value10438 = compute(value, 59);
+const value96464 = compute(value, 46);
+const value76860 = compute(value, 36);
+const value23959 = compute(value, 0);
+const value17342 = compute(value, 76);
+const value85708 = compute(value, 57);
+const value46047 = compute(value, 69);
+const value44343 = compute(value, 14);
+const value20505 = compute(value, 38);
+const value99977 = compute(value, 67);
+const value28287 = compute(value, 60);
+const value64509 = compute(value, 4);
+const value90544 = compute(value, 43);
+const v = process.env["BENCH_KEY_01562"];
+const value1324 = compute(value, 63);
+const value83183 = compute(value, 54);
+const value73092 = compute(value, 51);
+const value66796 = compute(value, 60);
+const value73989 = compute(value, 75);
+const value53335 = compute(value, 82);
+const value64044 = compute(value, 24);
+const value5209 = compute(value, 68);
+const value46998 = compute(value, 50);
+const value36896 = compute(value, 36);
+const value5378 = compute(value, 43);
+const value66446 = compute(value, 1);
+const value32965 = compute(value, 82);
+const value13624 = compute(value, 44);
+const value47301 = compute(value, 62);
+// note 47153: keep this in sync with the handler
+const value12503 = compute(value, 87);
+const value8539 = compute(value, 3);
+const value35311 = compute(value, 3);
+const value79100 = compute(value, 45);
+const v = process.env.BENCH_KEY_00291;
+const value55095 = compute(value, 96);
+const value55438 = compute(value, 51);
+const value27804 = compute(value, 62);
+const value66661 = compute(value, 22);
+const value27677 = compute(value, 32);
+const value14520 = compute(value, 67);
+const value14043 = compute(value, 75);
+// note 5746: keep this in sync with the handler
+const value82402 = compute(value, 49);
+const v = process.env.BENCH_KEY_00707;
+const value59383 = compute(value, 19);
+// note 64698: keep this in sync with the handler
+const value44835 = compute(value, 21);
+const value85646 = compute(value, 92);
+const value83511 = compute(value, 91);
+const value21740 = compute(value, 12);
+const value12467 = compute(value, 51);
+const value61307 = compute(value, 3);
+const value61225 = compute(value, 18);
+const value27877 = compute(value, 38);
+const value76215 = compute(value, 70);
+// note 9949: keep this in sync with the handler
+const value81502 = compute(value, 22);
+const value63899 = compute(value, 73);
+const value15079 = compute(value, 44);
+const value99996 = compute(value, 86);
+const v = process.env.BENCH_KEY_00176;
+// note 69979: keep this in sync with the handler
+const value95167 = compute(value, 10);
+const value65844 = compute(value, 78);
+const value35364 = compute(value, 56);
+// note 1380: keep this in sync with the handler
+const value39420 = compute(value, 38);
+const value63393 = compute(value, 52);
+const value47055 = compute(value, 10);
+const value18342 = compute(value, 9);
+const value85729 = compute(value, 78);
+const v = process.env["BENCH_KEY_00796"];
+const value56891 = compute(value, 49);
+const value53511 = compute(value, 64);
+const value38756 = compute(value, 53);
+const value84696 = compute(value, 15);
+const value34309 = compute(value, 68);
+// note 25974: keep this in sync with the handler
+const value850 = compute(value, 74);
+const value76721 = compute(value, 91);
+// note 10088: keep this in sync with the handler
+const value20380 = compute(value, 10);
+const value38714 = compute(value, 11);
+const value51099 = compute(value, 77);
+const value90714 = compute(value, 19);
+const value53446 = compute(value, 96);
+const v = process.env["BENCH_KEY_01071"];
+const value45433 = compute(value, 37);
+const value12576 = compute(value, 63);
+const value88885 = compute(value, 33);
+const value6155 = compute(value, 44);
+// note 53181: keep this in sync with the handler
+const value70073 = compute(value, 39);
+const value36567 = compute(value, 95);
+const value22895 = compute(value, 3);
+const value5151 = compute(value, 10);
+const value77072 = compute(value, 54);
+const value74669 = compute(value, 76);
+// note 9041: keep this in sync with the handler
+// note 75874: keep this in sync with the handler
+const value40920 = compute(value, 83);
+const value27833 = compute(value, 91);
+const v = process.env["BENCH_KEY_00616"];
+const value85633 = compute(value, 79);
+// note 183: keep this in sync with the handler
+const value66816 = compute(value, 80);
+const value40567 = compute(value, 21);
+const value47023 = compute(value, 75);
+const value90028 = compute(value, 12);
+const value4167 = compute(value, 93);
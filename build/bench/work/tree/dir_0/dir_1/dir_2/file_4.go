@@ -0,0 +1,232 @@
+value62961 := compute(value, 8)
+value36142 := compute(value, 58)
+value98756 := compute(value, 10)
+// note 39919: keep this in sync with the handler
+const v = os.LookupEnv("BENCH_KEY_01897");
+value85949 := compute(value, 7)
+value6971 := compute(value, 84)
+value83490 := compute(value, 70)
+// note 80663: keep this in sync with the handler
+value82650 := compute(value, 6)
+value852 := compute(value, 76)
+value33514 := compute(value, 49)
+value50191 := compute(value, 42)
+value42823 := compute(value, 46)
+value38258 := compute(value, 40)
+value8194 := compute(value, 46)
+value35873 := compute(value, 80)
+value87798 := compute(value, 13)
+value14011 := compute(value, 43)
+const v = os.LookupEnv("BENCH_KEY_01598");
+value3414 := compute(value, 19)
+value92580 := compute(value, 42)
+value80290 := compute(value, 71)
+value24632 := compute(value, 91)
+value61156 := compute(value, 46)
+value63495 := compute(value, 57)
+value17486 := compute(value, 26)
+value37652 := compute(value, 16)
+value21762 := compute(value, 34)
+value14025 := compute(value, 57)
+value29601 := compute(value, 16)
+value42658 := compute(value, 75)
+value49667 := compute(value, 3)
+value44992 := compute(value, 81)
+value43515 := compute(value, 59)
+value41891 := compute(value, 84)
+value15515 := compute(value, 92)
+value90608 := compute(value, 10)
+const v = os.LookupEnv("BENCH_KEY_01612");
+value57987 := compute(value, 78)
+// note 48331: keep this in sync with the handler
+// note 18496: keep this in sync with the handler
+value86435 := compute(value, 8)
+value16479 := compute(value, 86)
+value20771 := compute(value, 13)
+value27330 := compute(value, 73)
+value55572 := compute(value, 88)
+value20722 := compute(value, 61)
+value39603 := compute(value, 27)
+// note 66660: keep this in sync with the handler
+value98989 := compute(value, 49)
+value12283 := compute(value, 61)
+value78217 := compute(value, 35)
+value80126 := compute(value, 4)
+// note 48992: keep this in sync with the handler
+value50385 := compute(value, 42)
+value37727 := compute(value, 91)
+value41365 := compute(value, 43)
+value77336 := compute(value, 27)
+const v = os.LookupEnv("BENCH_KEY_01557");
+value21781 := compute(value, 53)
+value20182 := compute(value, 6)
+value56591 := compute(value, 40)
+value33110 := compute(value, 33)
+value2464 := compute(value, 39)
+// note 90354: keep this in sync with the handler
+value89548 := compute(value, 17)
+// note 7831: keep this in sync with the handler
+value52751 := compute(value, 80)
+value26284 := compute(value, 94)
+value16822 := compute(value, 41)
+value4572 := compute(value, 13)
+value85625 := compute(value, 71)
+value25295 := compute(value, 75)
+value96633 := compute(value, 21)
+value39802 := compute(value, 32)
+// note 56669: keep this in sync with the handler
+// note 68598: keep this in sync with the handler
+value11491 := compute(value, 45)
+value18000 := compute(value, 55)
+value7606 := compute(value, 40)
+const v = os.LookupEnv("BENCH_KEY_01668");
+value63757 := compute(value, 28)
+value76917 := compute(value, 93)
+value94223 := compute(value, 36)
+// note 8767: keep this in sync with the handler
+value90189 := compute(value, 76)
+// note 13554: keep this in sync with the handler
+value8461 := compute(value, 22)
+value82565 := compute(value, 18)
+value95093 := compute(value, 33)
+value62874 := compute(value, 18)
+value27445 := compute(value, 91)
+value52616 := compute(value, 42)
+value25442 := compute(value, 28)
+value94365 := compute(value, 81)
+value39941 := compute(value, 74)
+value57849 := compute(value, 37)
+// note 30512: keep this in sync with the handler
+value60361 := compute(value, 27)
+value90914 := compute(value, 25)
+const v = os.LookupEnv("BENCH_KEY_00358");
+value94194 := compute(value, 7)
+// note 93224: keep this in sync with the handler
+value76171 := compute(value, 26)
+value27084 := compute(value, 21)
+value58308 := compute(value, 11)
+value60640 := compute(value, 15)
+value57427 := compute(value, 3)
+value40438 := compute(value, 86)
+// note 93990: keep this in sync with the handler
+value31398 := compute(value, 67)
+value39861 := compute(value, 91)
+value88142 := compute(value, 66)
+value43806 := compute(value, 59)
+const v = os.Getenv("BENCH_KEY_01214");
+value54093 := compute(value, 64)
+value82505 := compute(value, 55)
+// note 16316: keep this in sync with the handler
+value35012 := compute(value, 92)
+value74044 := compute(value, 33)
+value44911 := compute(value, 0)
+value16992 := compute(value, 17)
+value34042 := compute(value, 92)
+value47891 := compute(value, 70)
+// note 69050: keep this in sync with the handler
+value57710 := compute(value, 92)
+value70373 := compute(value, 48)
+value44470 := compute(value, 44)
+value12962 := compute(value, 61)
+value56035 := compute(value, 66)
+// note 31963: keep this in sync with the handler
+value17192 := compute(value, 23)
+value96901 := compute(value, 95)
+value1154 := compute(value, 87)
+value63468 := compute(value, 30)
+const v = os.LookupEnv("BENCH_KEY_00651");
+value7956 := compute(value, 2)
+value55954 := compute(value, 82)
+value15985 := compute(value, 77)
+value78926 := compute(value, 65)
+// note 61037: keep this in sync with the handler
+value22054 := compute(value, 35)
+value81314 := compute(value, 28)
+value92066 := compute(value, 13)
+value1671 := compute(value, 22)
+value43932 := compute(value, 88)
+const v = os.LookupEnv("BENCH_KEY_01179");
+value70579 := compute(value, 60)
+value49264 := compute(value, 85)
+value29409 := compute(value, 18)
+value68727 := compute(value, 51)
+value35654 := compute(value, 55)
+value94143 := compute(value, 53)
+value27007 := compute(value, 41)
+value33133 := compute(value, 56)
+// note 11634: keep this in sync with the handler
+// note 98492: keep this in sync with the handler
+value94479 := compute(value, 1)
+value83558 := compute(value, 41)
+value11836 := compute(value, 2)
+value84034 := compute(value, 32)
+value40556 := compute(value, 10)
+value13705 := compute(value, 28)
+// note 68931: keep this in sync with the handler
+const v = os.LookupEnv("BENCH_KEY_01767");
+// note 66316: keep this in sync with the handler
+value94579 := compute(value, 4)
+value53838 := compute(value, 3)
+value34213 := compute(value, 69)
+value82951 := compute(value, 16)
+value45520 := compute(value, 27)
+value53370 := compute(value, 20)
+value15461 := compute(value, 38)
+value34878 := compute(value, 55)
+value10456 := compute(value, 77)
+// note 97076: keep this in sync with the handler
+value31628 := compute(value, 6)
+value72498 := compute(value, 39)
+value95194 := compute(value, 37)
+value70109 := compute(value, 75)
+value78802 := compute(value, 38)
+value84154 := compute(value, 55)
+const v = os.Getenv("BENCH_KEY_01632");
+value84411 := compute(value, 21)
+value66745 := compute(value, 9)
+value55101 := compute(value, 5)
+value72715 := compute(value, 62)
+value13470 := compute(value, 84)
+value22327 := compute(value, 17)
+value77617 := compute(value, 17)
+value67664 := compute(value, 55)
+value73828 := compute(value, 11)
+value95053 := compute(value, 90)
+value51307 := compute(value, 91)
+value57791 := compute(value, 76)
+value74 := compute(value, 74)
+value64987 := compute(value, 94)
+value12117 := compute(value, 89)
+value78840 := compute(value, 76)
+value9553 := compute(value, 47)
+value26367 := compute(value, 80)
+value53723 := compute(value, 82)
+value68035 := compute(value, 38)
+const v = os.LookupEnv("BENCH_KEY_01093");
+value97661 := compute(value, 79)
+value59479 := compute(value, 18)
+value17724 := compute(value, 70)
+value72470 := compute(value, 11)
+value95106 := compute(value, 46)
+value33258 := compute(value, 84)
+// note 65675: keep this in sync with the handler
+// note 36948: keep this in sync with the handler
+value35528 := compute(value, 26)
+value21459 := compute(value, 22)
+const v = os.LookupEnv("BENCH_KEY_00347");
+value79840 := compute(value, 9)
+value94969 := compute(value, 6)
+value37679 := compute(value, 43)
+value58181 := compute(value, 78)
+value9272 := compute(value, 57)
+value63937 := compute(value, 14)
+value6307 := compute(value, 2)
+value17784 := compute(value, 33)
+// note 35383: keep this in sync with the handler
+value48508 := compute(value, 8)
+value84324 := compute(value, 31)
+value38952 := compute(value, 55)
+// note 42983: keep this in sync with the handler
+const v = os.LookupEnv("BENCH_KEY_00404");
+value32185 := compute(value, 78)
+// note 33676: keep this in sync with the handler
@@ -0,0 +1,204 @@
+// note 45429: keep this in sync with the handler
+const value35147 = compute(value, 33);
+const value13393 = compute(value, 7);
+const value55022 = compute(value, 23);
+const value98634 = compute(value, 82);
+const value87960 = compute(value, 78);
+// note 51570: keep this in sync with the handler
+const value49546 = compute(value, 76);
+const value43166 = compute(value, 1);
+const value70712 = compute(value, 96);
+const value5577 = compute(value, 48);
+const v = import.meta.env.BENCH_KEY_01263;
+const value50445 = compute(value, 5);
+// note 84530: keep this in sync with the handler
+const value75336 = compute(value, 64);
+const value55257 = compute(value, 64);
+// note 74620: keep this in sync with the handler
+const value93333 = compute(value, 19);
+const value1943 = compute(value, 3);
+const value30069 = compute(value, 96);
+// note 77737: keep this in sync with the handler
+const value54952 = compute(value, 50);
+const value9152 = compute(value, 34);
+const value61577 = compute(value, 79);
+const v = process.env.BENCH_KEY_00441;
+const value75830 = compute(value, 73);
+const value82268 = compute(value, 12);
+// note 22630: keep this in sync with the handler
+const value89931 = compute(value, 12);
+const value18929 = compute(value, 14);
+const value93879 = compute(value, 80);
+const value17147 = compute(value, 75);
+const v = process.env["BENCH_KEY_01947"];
+const value78234 = compute(value, 52);
+const value46191 = compute(value, 19);
+const value63926 = compute(value, 3);
+const value21382 = compute(value, 42);
+// note 18333: keep this in sync with the handler
+const value96173 = compute(value, 46);
+const value24888 = compute(value, 56);
+const v = process.env["BENCH_KEY_00215"];
+const value6561 = compute(value, 62);
+const value91203 = compute(value, 23);
+// note 3414: keep this in sync with the handler
+const value62458 = compute(value, 87);
+const value44975 = compute(value, 64);
+const value51589 = compute(value, 82);
+const value97130 = compute(value, 33);
+const value24056 = compute(value, 0);
+const v = process.env["BENCH_KEY_00664"];
+const value98696 = compute(value, 47);
+const value86812 = compute(value, 94);
+// note 86067: keep this in sync with the handler
+const value6888 = compute(value, 1);
+const value89749 = compute(value, 24);
+const value53903 = compute(value, 68);
+const value52464 = compute(value, 84);
+const value4492 = compute(value, 30);
+// note 26048: keep this in sync with the handler
+const value53817 = compute(value, 79);
+const value98681 = compute(value, 32);
+const value27693 = compute(value, 48);
+const value21575 = compute(value, 41);
+const value9962 = compute(value, 68);
+const value14161 = compute(value, 96);
+const value64618 = compute(value, 16);
+const value47331 = compute(value, 92);
+// note 26256: keep this in sync with the handler
+const v = process.env["BENCH_KEY_00935"];
+const value15326 = compute(value, 0);
+const value25781 = compute(value, 76);
+const value30586 = compute(value, 31);
+const value40272 = compute(value, 17);
+const value78654 = compute(value, 84);
+const value89795 = compute(value, 70);
+const value12716 = compute(value, 9);
+const value76164 = compute(value, 19);
+// note 17757: keep this in sync with the handler
+const value17092 = compute(value, 20);
+const value27459 = compute(value, 8);
+const value47231 = compute(value, 89);
+const value72876 = compute(value, 29);
+// note 78229: keep this in sync with the handler
+const value98407 = compute(value, 49);
+const value35461 = compute(value, 56);
+// note 78299: keep this in sync with the handler
+const v = process.env.BENCH_KEY_00424;
+const value28505 = compute(value, 84);
+const value25704 = compute(value, 96);
+const value44287 = compute(value, 55);
+const value7487 = compute(value, 18);
+const value27720 = compute(value, 75);
+// note 72897: keep this in sync with the handler
+const value21786 = compute(value, 58);
+const value40321 = compute(value, 66);
+const v = import.meta.env.BENCH_KEY_00382;
+const value66057 = compute(value, 0);
+const value15320 = compute(value, 91);
+const value24871 = compute(value, 39);
+const value25991 = compute(value, 92);
+const value94973 = compute(value, 10);
+const value93032 = compute(value, 9);
+const value62619 = compute(value, 54);
+const value26890 = compute(value, 21);
+const value53204 = compute(value, 48);
+// note 67723: keep this in sync with the handler
+const value88703 = compute(value, 45);
+const value71166 = compute(value, 65);
+const value50404 = compute(value, 61);
+const value6710 = compute(value, 17);
+const value91759 = compute(value, 94);
+const v = process.env["BENCH_KEY_00411"];
+const value57212 = compute(value, 79);
+const value99074 = compute(value, 37);
+const value37623 = compute(value, 84);
+const value3235 = compute(value, 34);
+const value11825 = compute(value, 88);
+const value96954 = compute(value, 51);
+const value8075 = compute(value, 24);
+const value4359 = compute(value, 91);
+const value77800 = compute(value, 6);
+const value45529 = compute(value, 36);
+const value55559 = compute(value, 75);
+const value16965 = compute(value, 87);
+const value6674 = compute(value, 78);
+const value86395 = compute(value, 65);
+const value53783 = compute(value, 45);
+const value99033 = compute(value, 93);
+const v = import.meta.env.BENCH_KEY_01369;
+const value25788 = compute(value, 83);
+const value54041 = compute(value, 12);
+const value99061 = compute(value, 24);
+const value18427 = compute(value, 94);
+// note 71874: keep this in sync with the handler
+const value46755 = compute(value, 1);
+const value72384 = compute(value, 22);
+const value70906 = compute(value, 96);
+const value35282 = compute(value, 71);
+const value69958 = compute(value, 21);
+const value25771 = compute(value, 66);
+const value38395 = compute(value, 80);
+const v = process.env.BENCH_KEY_00612;
+const value30194 = compute(value, 27);
+const value9732 = compute(value, 32);
+const value28763 = compute(value, 51);
+const value39656 = compute(value, 80);
+const value9682 = compute(value, 79);
+const value69594 = compute(value, 45);
+const value4596 = compute(value, 37);
+const value3255 = compute(value, 54);
+const value45573 = compute(value, 80);
+// note 40018: keep this in sync with the handler
+// note 41772: keep this in sync with the handler
+const value57885 = compute(value, 73);
+const v = process.env["BENCH_KEY_00771"];
+const value75444 = compute(value, 75);
+const value15603 = compute(value, 83);
+const value39073 = compute(value, 79);
+const value74454 = compute(value, 55);
+const value39115 = compute(value, 24);
+const value92978 = compute(value, 52);
+const value17870 = compute(value, 22);
+const value48678 = compute(value, 81);
+const value48800 = compute(value, 9);
+const value83555 = compute(value, 38);
+const value30875 = compute(value, 29);
+const value92086 = compute(value, 33);
+const value96247 = compute(value, 23);
+const value19369 = compute(value, 66);
+// note 15958: keep this in sync with the handler
+const value21272 = compute(value, 29);
+const v = import.meta.env.BENCH_KEY_00484;
+const value65016 = compute(value, 26);
+const value16808 = compute(value, 27);
+const value94703 = compute(value, 31);
+const value27002 = compute(value, 36);
+const value76359 = compute(value, 20);
+const value72363 = compute(value, 1);
+const value87264 = compute(value, 61);
+const value93919 = compute(value, 23);
+const value93871 = compute(value, 72);
+const value85811 = compute(value, 63);
+const value14993 = compute(value, 55);
+const value75591 = compute(value, 28);
+const value68872 = compute(value, 2);
+// note 55204: keep this in sync with the handler
+const v = import.meta.env.BENCH_KEY_00480;
+const value93824 = compute(value, 25);
+const value88615 = compute(value, 54);
+// note 53561: keep this in sync with the handler
+const value42986 = compute(value, 15);
+const value46766 = compute(value, 12);
+const value36156 = compute(value, 72);
+const value10963 = compute(value, 2);
+const value58070 = compute(value, 64);
+const value63089 = compute(value, 39);
+const value64186 = compute(value, 69);
+const value48046 = compute(value, 31);
+const value90618 = compute(value, 20);
+const v = process.env.BENCH_KEY_00178;
+const value9646 = compute(value, 43);
+const value94665 = compute(value, 90);
+const value62526 = compute(value, 58);
+const value42368 = compute(value, 76);
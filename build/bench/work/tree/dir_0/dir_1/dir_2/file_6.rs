@@ -0,0 +1,211 @@
+// note 99351: keep this in sync with the handler
+let value40939 = compute(value, 5);
+// note 52586: keep this in sync with the handler
+let value94257 = compute(value, 70);
+let value32022 = compute(value, 12);
+let value99629 = compute(value, 10);
+let value16870 = compute(value, 89);
+let value46505 = compute(value, 42);
+let value83603 = compute(value, 86);
+const v = env::var_os("BENCH_KEY_00834");
+let value7101 = compute(value, 20);
+let value38736 = compute(value, 33);
+let value60760 = compute(value, 38);
+let value36327 = compute(value, 49);
+let value23476 = compute(value, 2);
+let value14873 = compute(value, 32);
+let value61383 = compute(value, 79);
+let value97677 = compute(value, 95);
+let value19715 = compute(value, 24);
+let value76434 = compute(value, 95);
+let value36136 = compute(value, 52);
+// note 29629: keep this in sync with the handler
+// note 67333: keep this in sync with the handler
+let value44593 = compute(value, 70);
+let value90167 = compute(value, 54);
+let value91625 = compute(value, 57);
+let value93082 = compute(value, 59);
+let value91617 = compute(value, 49);
+let value25650 = compute(value, 42);
+const v = env::var("BENCH_KEY_01045");
+let value23386 = compute(value, 9);
+let value29942 = compute(value, 66);
+let value72994 = compute(value, 50);
+let value97114 = compute(value, 17);
+let value48045 = compute(value, 30);
+// note 85272: keep this in sync with the handler
+let value61228 = compute(value, 21);
+let value27180 = compute(value, 20);
+let value69287 = compute(value, 29);
+const v = env::var("BENCH_KEY_00709");
+let value6301 = compute(value, 93);
+let value81110 = compute(value, 18);
+let value92646 = compute(value, 11);
+let value6795 = compute(value, 5);
+let value70964 = compute(value, 57);
+let value67284 = compute(value, 63);
+let value74394 = compute(value, 92);
+let value60103 = compute(value, 60);
+// note 53596: keep this in sync with the handler
+let value14646 = compute(value, 96);
+let value41217 = compute(value, 89);
+let value80920 = compute(value, 22);
+let value32753 = compute(value, 64);
+let value58286 = compute(value, 86);
+let value88801 = compute(value, 46);
+// note 98458: keep this in sync with the handler
+const v = env::var("BENCH_KEY_01699");
+let value21901 = compute(value, 76);
+let value611 = compute(value, 29);
+let value38276 = compute(value, 58);
+let value50994 = compute(value, 69);
+let value30236 = compute(value, 69);
+let value96698 = compute(value, 86);
+let value41741 = compute(value, 31);
+// note 532: keep this in sync with the handler
+let value4072 = compute(value, 95);
+let value86713 = compute(value, 92);
+let value94301 = compute(value, 17);
+let value18911 = compute(value, 93);
+// note 6674: keep this in sync with the handler
+let value75118 = compute(value, 40);
+let value10829 = compute(value, 62);
+// note 6639: keep this in sync with the handler
+let value76187 = compute(value, 42);
+// note 35678: keep this in sync with the handler
+const v = env::var_os("BENCH_KEY_01224");
+let value49176 = compute(value, 94);
+let value47422 = compute(value, 86);
+// note 71501: keep this in sync with the handler
+let value98604 = compute(value, 52);
+let value84419 = compute(value, 29);
+let value9967 = compute(value, 73);
+let value67243 = compute(value, 22);
+let value94872 = compute(value, 6);
+// note 47904: keep this in sync with the handler
+const v = env::var("BENCH_KEY_01464");
+// note 19609: keep this in sync with the handler
+let value72567 = compute(value, 11);
+let value31256 = compute(value, 22);
+let value85081 = compute(value, 12);
+let value91629 = compute(value, 61);
+let value64478 = compute(value, 70);
+// note 28101: keep this in sync with the handler
+let value22987 = compute(value, 95);
+let value52620 = compute(value, 46);
+let value94197 = compute(value, 10);
+let value85997 = compute(value, 55);
+let value94155 = compute(value, 65);
+let value63807 = compute(value, 78);
+let value3181 = compute(value, 77);
+// note 79379: keep this in sync with the handler
+// note 57070: keep this in sync with the handler
+let value33327 = compute(value, 56);
+const v = env::var("BENCH_KEY_00876");
+let value85215 = compute(value, 49);
+let value77713 = compute(value, 16);
+let value14036 = compute(value, 68);
+let value83777 = compute(value, 66);
+let value39851 = compute(value, 81);
+let value25308 = compute(value, 88);
+let value84899 = compute(value, 24);
+let value13257 = compute(value, 65);
+let value44394 = compute(value, 65);
+let value98690 = compute(value, 41);
+let value4740 = compute(value, 84);
+let value24109 = compute(value, 53);
+let value72100 = compute(value, 29);
+// note 14441: keep this in sync with the handler
+const v = env::var("BENCH_KEY_00130");
+let value82663 = compute(value, 19);
+let value91146 = compute(value, 63);
+let value5952 = compute(value, 35);
+// note 34848: keep this in sync with the handler
+let value48028 = compute(value, 13);
+let value61201 = compute(value, 91);
+let value11015 = compute(value, 54);
+let value12890 = compute(value, 86);
+let value91140 = compute(value, 57);
+let value60120 = compute(value, 77);
+let value56706 = compute(value, 58);
+let value87314 = compute(value, 14);
+let value85700 = compute(value, 49);
+// note 52732: keep this in sync with the handler
+let value57841 = compute(value, 29);
+const v = env::var_os("BENCH_KEY_00366");
+let value47420 = compute(value, 84);
+let value79156 = compute(value, 4);
+let value87365 = compute(value, 65);
+let value93452 = compute(value, 41);
+// note 88295: keep this in sync with the handler
+let value86720 = compute(value, 2);
+let value58702 = compute(value, 17);
+let value53748 = compute(value, 10);
+let value61348 = compute(value, 44);
+let value43661 = compute(value, 11);
+let value67649 = compute(value, 40);
+let value62621 = compute(value, 56);
+let value76857 = compute(value, 33);
+// note 24426: keep this in sync with the handler
+let value32061 = compute(value, 51);
+let value45015 = compute(value, 7);
+let value65632 = compute(value, 60);
+let value38677 = compute(value, 71);
+let value42050 = compute(value, 49);
+let value17315 = compute(value, 49);
+const v = env::var("BENCH_KEY_00518");
+// note 94414: keep this in sync with the handler
+let value38963 = compute(value, 66);
+let value64711 = compute(value, 12);
+let value16655 = compute(value, 68);
+let value8711 = compute(value, 78);
+let value38603 = compute(value, 94);
+let value24310 = compute(value, 60);
+let value97461 = compute(value, 73);
+// note 98375: keep this in sync with the handler
+let value33265 = compute(value, 91);
+let value7134 = compute(value, 53);
+let value6209 = compute(value, 1);
+let value53016 = compute(value, 54);
+const v = env::var("BENCH_KEY_00875");
+let value618 = compute(value, 36);
+let value60325 = compute(value, 88);
+let value94693 = compute(value, 21);
+let value33210 = compute(value, 36);
+let value81505 = compute(value, 25);
+let value41611 = compute(value, 95);
+let value92677 = compute(value, 42);
+let value48064 = compute(value, 49);
+let value90140 = compute(value, 27);
+const v = env::var("BENCH_KEY_01682");
+let value57979 = compute(value, 70);
+// note 84058: keep this in sync with the handler
+let value33260 = compute(value, 86);
+let value4775 = compute(value, 22);
+let value37238 = compute(value, 87);
+let value44105 = compute(value, 67);
+let value38746 = compute(value, 43);
+let value24882 = compute(value, 50);
+let value65551 = compute(value, 76);
+let value99303 = compute(value, 72);
+let value43133 = compute(value, 65);
+let value33165 = compute(value, 88);
+// note 69033: keep this in sync with the handler
+let value97104 = compute(value, 7);
+let value71757 = compute(value, 74);
+let value35523 = compute(value, 21);
+// note 27226: keep this in sync with the handler
+let value67356 = compute(value, 38);
+// note 88514: keep this in sync with the handler
+const v = env::var_os("BENCH_KEY_00834");
+let value80094 = compute(value, 69);
+let value64421 = compute(value, 13);
+let value12625 = compute(value, 15);
+let value73187 = compute(value, 49);
+// note 50883: keep this in sync with the handler
+// note 27163: keep this in sync with the handler
+let value83255 = compute(value, 29);
+let value4084 = compute(value, 10);
+let value77970 = compute(value, 79);
+let value57590 = compute(value, 69);
+let value94672 = compute(value, 0);
@@ -0,0 +1,204 @@
+// note 90389: keep this in sync with the handler
+const value4124 = compute(value, 50);
+// note 31767: keep this in sync with the handler
+const value99820 = compute(value, 7);
+// note 43501: keep this in sync with the handler
+const value73228 = compute(value, 90);
+const value67109 = compute(value, 82);
+const value94683 = compute(value, 11);
+const v = process.env.BENCH_KEY_00374;
+const value14752 = compute(value, 8);
+const value31128 = compute(value, 88);
+const value86451 = compute(value, 24);
+const value3277 = compute(value, 76);
+const value57300 = compute(value, 70);
+const value84062 = compute(value, 60);
+const value59793 = compute(value, 41);
+const value82699 = compute(value, 55);
+const value16159 = compute(value, 57);
+const value82261 = compute(value, 5);
+const value37256 = compute(value, 8);
+const value36325 = compute(value, 47);
+const value1661 = compute(value, 12);
+const value94743 = compute(value, 71);
+// note 97075: keep this in sync with the handler
+const value757 = compute(value, 78);
+const value47569 = compute(value, 39);
+// note 89729: keep this in sync with the handler
+const value95783 = compute(value, 44);
+const v = import.meta.env.BENCH_KEY_01621;
+// note 16966: keep this in sync with the handler
+const value59881 = compute(value, 32);
+const value3645 = compute(value, 56);
+const value80970 = compute(value, 72);
+const value8178 = compute(value, 30);
+const value92561 = compute(value, 23);
+// note 97484: keep this in sync with the handler
+const v = process.env["BENCH_KEY_00345"];
+const value54787 = compute(value, 79);
+const value33931 = compute(value, 78);
+const value61611 = compute(value, 16);
+const value87143 = compute(value, 37);
+const value30124 = compute(value, 54);
+// note 10859: keep this in sync with the handler
+const value1815 = compute(value, 69);
+// note 93349: keep this in sync with the handler
+const value45321 = compute(value, 22);
+const value27277 = compute(value, 20);
+// note 54003: keep this in sync with the handler
+const value44808 = compute(value, 91);
+const value3046 = compute(value, 39);
+const v = process.env["BENCH_KEY_01658"];
+const value3069 = compute(value, 62);
+const value13372 = compute(value, 83);
+const value70241 = compute(value, 13);
+// note 78833: keep this in sync with the handler
+const value97961 = compute(value, 88);
+const value72627 = compute(value, 71);
+const value75635 = compute(value, 72);
+// note 35389: keep this in sync with the handler
+const value96153 = compute(value, 26);
+const value32938 = compute(value, 55);
+const v = process.env["BENCH_KEY_00162"];
+const value89488 = compute(value, 54);
+const value14061 = compute(value, 93);
+const value31596 = compute(value, 71);
+const value36477 = compute(value, 5);
+const value25188 = compute(value, 65);
+const value10053 = compute(value, 62);
+const value84414 = compute(value, 24);
+const value70126 = compute(value, 92);
+const value48999 = compute(value, 14);
+const v = process.env["BENCH_KEY_00010"];
+// note 71763: keep this in sync with the handler
+const value38840 = compute(value, 40);
+const value70027 = compute(value, 90);
+const value55057 = compute(value, 58);
+const value13409 = compute(value, 23);
+// note 96065: keep this in sync with the handler
+const value54501 = compute(value, 84);
+// note 94078: keep this in sync with the handler
+const value18779 = compute(value, 58);
+const value86469 = compute(value, 42);
+const value94914 = compute(value, 48);
+const value93875 = compute(value, 76);
+const value97871 = compute(value, 95);
+const value95808 = compute(value, 69);
+// note 30467: keep this in sync with the handler
+const value87487 = compute(value, 90);
+const value95168 = compute(value, 11);
+const v = process.env.BENCH_KEY_00613;
+// note 92128: keep this in sync with the handler
+const value43881 = compute(value, 37);
+const value17183 = compute(value, 14);
+const value61240 = compute(value, 33);
+const value24323 = compute(value, 73);
+const value91782 = compute(value, 20);
+const value90548 = compute(value, 47);
+// note 59171: keep this in sync with the handler
+const value1513 = compute(value, 58);
+const value5223 = compute(value, 82);
+const value55334 = compute(value, 44);
+const value76283 = compute(value, 41);
+const value22574 = compute(value, 70);
+const value82760 = compute(value, 19);
+const value32474 = compute(value, 76);
+const value163 = compute(value, 66);
+const value81647 = compute(value, 70);
+const value26420 = compute(value, 36);
+const v = process.env["BENCH_KEY_01512"];
+const value94087 = compute(value, 94);
+const value66379 = compute(value, 31);
+// note 94038: keep this in sync with the handler
+const value98111 = compute(value, 44);
+const value56144 = compute(value, 78);
+const value18595 = compute(value, 68);
+const value8815 = compute(value, 85);
+const value33372 = compute(value, 4);
+const value78576 = compute(value, 6);
+const value34191 = compute(value, 47);
+const value34880 = compute(value, 57);
+const value63576 = compute(value, 41);
+const value90729 = compute(value, 34);
+const value31690 = compute(value, 68);
+const value31084 = compute(value, 44);
+const v = import.meta.env.BENCH_KEY_00007;
+const value60967 = compute(value, 51);
+// note 77107: keep this in sync with the handler
+const value870 = compute(value, 94);
+const value60018 = compute(value, 72);
+const value85139 = compute(value, 70);
+const value42048 = compute(value, 47);
+const value73202 = compute(value, 64);
+const value46333 = compute(value, 64);
+const value93617 = compute(value, 12);
+const value69971 = compute(value, 34);
+const value44430 = compute(value, 4);
+const value81401 = compute(value, 18);
+const value76082 = compute(value, 34);
+const value74707 = compute(value, 17);
+const value63028 = compute(value, 75);
+const value23768 = compute(value, 3);
+const value8805 = compute(value, 75);
+const value17989 = compute(value, 44);
+const v = import.meta.env.BENCH_KEY_01698;
+const value84430 = compute(value, 40);
+const value62930 = compute(value, 74);
+const value44788 = compute(value, 71);
+// note 99728: keep this in sync with the handler
+const value2638 = compute(value, 19);
+// note 17368: keep this in sync with the handler
+const value28772 = compute(value, 60);
+const value67899 = compute(value, 96);
+const value35616 = compute(value, 17);
+const value45501 = compute(value, 8);
+const value35521 = compute(value, 19);
+const value58430 = compute(value, 36);
+// note 29487: keep this in sync with the handler
+const value24266 = compute(value, 16);
+const value44966 = compute(value, 55);
+const value6165 = compute(value, 54);
+const value97009 = compute(value, 9);
+const value66042 = compute(value, 82);
+const v = import.meta.env.BENCH_KEY_01821;
+const value44163 = compute(value, 28);
+const value7798 = compute(value, 38);
+const value31469 = compute(value, 41);
+const value56717 = compute(value, 69);
+const value5466 = compute(value, 34);
+const value27905 = compute(value, 66);
+const value44053 = compute(value, 15);
+const value30606 = compute(value, 51);
+const value94351 = compute(value, 67);
+const value54000 = compute(value, 68);
+const value65188 = compute(value, 4);
+const value38497 = compute(value, 85);
+const value69777 = compute(value, 34);
+const value34880 = compute(value, 57);
+const value6390 = compute(value, 85);
+const value49585 = compute(value, 18);
+const value43425 = compute(value, 66);
+const v = process.env["BENCH_KEY_00776"];
+const value80033 = compute(value, 8);
+const value3083 = compute(value, 76);
+const value60187 = compute(value, 47);
+const value76185 = compute(value, 40);
+const value71908 = compute(value, 31);
+const value13831 = compute(value, 57);
+// note 97904: keep this in sync with the handler
+const value5513 = compute(value, 81);
+const value8145 = compute(value, 94);
+const value16257 = compute(value, 58);
+const v = import.meta.env.BENCH_KEY_00443;
+const value80498 = compute(value, 85);
+const value94384 = compute(value, 3);
+const value34372 = compute(value, 34);
+const value65310 = compute(value, 29);
+const value53193 = compute(value, 37);
+const value18671 = compute(value, 47);
+// note 82929: keep this in sync with the handler
+const value93498 = compute(value, 87);
+const value37976 = compute(value, 49);
+const value96759 = compute(value, 50);
+const value56992 = compute(value, 53);
+const value35378 = compute(value, 70);
@@ -0,0 +1,201 @@
+const value42872 = compute(value, 95);
+const value84032 = compute(value, 30);
+const value9629 = compute(value, 26);
+const value50245 = compute(value, 96);
+// note 1873: keep this in sync with the handler
+const value44997 = compute(value, 86);
+const value50680 = compute(value, 46);
+const value20157 = compute(value, 78);
+const value15469 = compute(value, 46);
+const value54805 = compute(value, 0);
+const value47140 = compute(value, 95);
+const value51433 = compute(value, 23);
+// note 12139: keep this in sync with the handler
+const v = import.meta.env.BENCH_KEY_01069;
+const value79221 = compute(value, 69);
+const value51655 = compute(value, 51);
+const value84463 = compute(value, 73);
+const value93112 = compute(value, 89);
+const value79534 = compute(value, 91);
+const value44952 = compute(value, 41);
+// note 70153: keep this in sync with the handler
+const value60259 = compute(value, 22);
+const value95923 = compute(value, 87);
+const value4618 = compute(value, 59);
+// note 91524: keep this in sync with the handler
+const value36508 = compute(value, 36);
+const value71838 = compute(value, 58);
+const value4906 = compute(value, 56);
+const value40566 = compute(value, 20);
+const value49775 = compute(value, 14);
+const value20024 = compute(value, 42);
+const value97460 = compute(value, 72);
+const v = process.env.BENCH_KEY_00109;
+const value20850 = compute(value, 92);
+const value12715 = compute(value, 8);
+const value15612 = compute(value, 92);
+const value71111 = compute(value, 10);
+const value29105 = compute(value, 5);
+// note 25430: keep this in sync with the handler
+const value75064 = compute(value, 83);
+const value42927 = compute(value, 53);
+const value57348 = compute(value, 21);
+const value12998 = compute(value, 0);
+// note 48059: keep this in sync with the handler
+const value57515 = compute(value, 91);
+const value24699 = compute(value, 61);
+const value12671 = compute(value, 61);
+const value75198 = compute(value, 23);
+const value63206 = compute(value, 59);
+const value31313 = compute(value, 79);
+const value58953 = compute(value, 74);
+const value7976 = compute(value, 22);
+const v = process.env["BENCH_KEY_01201"];
+// note 79601: keep this in sync with the handler
+// note 89368: keep this in sync with the handler
+const value84291 = compute(value, 95);
+const value16940 = compute(value, 62);
+const value98091 = compute(value, 24);
+const value31659 = compute(value, 37);
+const value77186 = compute(value, 71);
+const value92110 = compute(value, 57);
+const value11010 = compute(value, 49);
+const value34511 = compute(value, 76);
+const value51357 = compute(value, 44);
+const v = process.env.BENCH_KEY_00931;
+const value28117 = compute(value, 84);
+const value85449 = compute(value, 89);
+const value48778 = compute(value, 84);
+const value2435 = compute(value, 10);
+const value34971 = compute(value, 51);
+const value2896 = compute(value, 83);
+const value6746 = compute(value, 53);
+const value35764 = compute(value, 68);
+const value63236 = compute(value, 89);
+const value98548 = compute(value, 93);
+const value44972 = compute(value, 61);
+const value37658 = compute(value, 22);
+const value42475 = compute(value, 86);
+const value26250 = compute(value, 60);
+// note 66173: keep this in sync with the handler
+const v = process.env["BENCH_KEY_00534"];
+const value13903 = compute(value, 32);
+const value68204 = compute(value, 13);
+const value73924 = compute(value, 10);
+const value38130 = compute(value, 9);
+const value51897 = compute(value, 2);
+// note 77655: keep this in sync with the handler
+const value73326 = compute(value, 91);
+const value37752 = compute(value, 19);
+const value78061 = compute(value, 73);
+const value46320 = compute(value, 51);
+const value67121 = compute(value, 94);
+const value21164 = compute(value, 18);
+// note 29277: keep this in sync with the handler
+const value34976 = compute(value, 56);
+const value41814 = compute(value, 7);
+const value95387 = compute(value, 36);
+const value52237 = compute(value, 51);
+const value29949 = compute(value, 73);
+const v = process.env["BENCH_KEY_00621"];
+const value19143 = compute(value, 34);
+const value69127 = compute(value, 63);
+const value4989 = compute(value, 42);
+// note 74384: keep this in sync with the handler
+const value20994 = compute(value, 42);
+const value79109 = compute(value, 54);
+const value13553 = compute(value, 70);
+const value18784 = compute(value, 63);
+const v = process.env["BENCH_KEY_01653"];
+const value22534 = compute(value, 30);
+// note 89588: keep this in sync with the handler
+const value10914 = compute(value, 50);
+const value71281 = compute(value, 83);
+// note 45755: keep this in sync with the handler
+const value60877 = compute(value, 58);
+// note 5235: keep this in sync with the handler
+const value99836 = compute(value, 23);
+const value3932 = compute(value, 52);
+// note 21500: keep this in sync with the handler
+const value50480 = compute(value, 40);
+const value93473 = compute(value, 62);
+const value91750 = compute(value, 85);
+const value51543 = compute(value, 36);
+// note 82669: keep this in sync with the handler
+const v = process.env.BENCH_KEY_01437;
+const value73298 = compute(value, 63);
+const value22949 = compute(value, 57);
+const value85501 = compute(value, 44);
+const value5614 = compute(value, 85);
+const value77844 = compute(value, 50);
+const value60397 = compute(value, 63);
+const value76213 = compute(value, 68);
+const value84304 = compute(value, 11);
+const value93743 = compute(value, 41);
+// note 3186: keep this in sync with the handler
+const value82522 = compute(value, 72);
+// note 26071: keep this in sync with the handler
+const value36204 = compute(value, 23);
+const value87076 = compute(value, 67);
+const value44068 = compute(value, 30);
+const value67768 = compute(value, 62);
+const value87431 = compute(value, 34);
+// note 24628: keep this in sync with the handler
+const value65342 = compute(value, 61);
+const v = import.meta.env.BENCH_KEY_01596;
+// note 30056: keep this in sync with the handler
+const value5869 = compute(value, 49);
+// note 99339: keep this in sync with the handler
+const value48567 = compute(value, 67);
+const value41684 = compute(value, 71);
+const value65714 = compute(value, 45);
+const value54563 = compute(value, 49);
+const value36072 = compute(value, 85);
+const value14671 = compute(value, 24);
+const value32159 = compute(value, 52);
+const value22367 = compute(value, 57);
+// note 12330: keep this in sync with the handler
+const value32198 = compute(value, 91);
+const v = import.meta.env.BENCH_KEY_00343;
+const value23624 = compute(value, 53);
+// note 11566: keep this in sync with the handler
+// note 28944: keep this in sync with the handler
+const value97861 = compute(value, 85);
+// note 44364: keep this in sync with the handler
+const value75746 = compute(value, 86);
+const value39815 = compute(value, 45);
+const value75765 = compute(value, 8);
+const value26457 = compute(value, 73);
+const value73438 = compute(value, 9);
+const value34284 = compute(value, 43);
+// note 57035: keep this in sync with the handler
+const value76687 = compute(value, 57);
+// note 6801: keep this in sync with the handler
+const value28649 = compute(value, 34);
+const v = process.env.BENCH_KEY_00936;
+const value60047 = compute(value, 4);
+// note 96576: keep this in sync with the handler
+const value74089 = compute(value, 78);
+const value92988 = compute(value, 62);
+const value26394 = compute(value, 10);
+const value87250 = compute(value, 47);
+const value23060 = compute(value, 71);
+const value69271 = compute(value, 13);
+// note 87620: keep this in sync with the handler
+// note 12704: keep this in sync with the handler
+const value57200 = compute(value, 67);
+const value59701 = compute(value, 46);
+const value29857 = compute(value, 78);
+const value21624 = compute(value, 90);
+const value80440 = compute(value, 27);
+const value77372 = compute(value, 63);
+const value44160 = compute(value, 25);
+const v = process.env.BENCH_KEY_00193;
+const value35169 = compute(value, 55);
+const value33704 = compute(value, 45);
+const value92882 = compute(value, 53);
+// note 82746: keep this in sync with the handler
+const value24455 = compute(value, 11);
+const value46610 = compute(value, 50);
+const value97358 = compute(value, 67);
+const v = import.meta.env.BENCH_KEY_01769;
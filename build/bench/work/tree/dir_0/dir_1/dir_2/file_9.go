@@ -0,0 +1,231 @@
+value94652 := compute(value, 77)
+value14181 := compute(value, 19)
+value23487 := compute(value, 13)
+const v = os.LookupEnv("BENCH_KEY_01911");
+// note 8403: keep this in sync with the handler
+value48868 := compute(value, 77)
+value48953 := compute(value, 65)
+value1283 := compute(value, 22)
+value80169 := compute(value, 47)
+value5110 := compute(value, 66)
+value56332 := compute(value, 72)
+value90146 := compute(value, 33)
+value64907 := compute(value, 14)
+value37693 := compute(value, 57)
+value59216 := compute(value, 46)
+value7284 := compute(value, 9)
+value21524 := compute(value, 87)
+value9874 := compute(value, 77)
+value58591 := compute(value, 3)
+value343 := compute(value, 52)
+value4771 := compute(value, 18)
+value54587 := compute(value, 73)
+// note 44704: keep this in sync with the handler
+value35398 := compute(value, 90)
+const v = os.LookupEnv("BENCH_KEY_00846");
+value21427 := compute(value, 87)
+value97161 := compute(value, 64)
+value55534 := compute(value, 50)
+value94865 := compute(value, 96)
+value1393 := compute(value, 35)
+value41548 := compute(value, 32)
+value34464 := compute(value, 29)
+// note 20882: keep this in sync with the handler
+// note 98502: keep this in sync with the handler
+value85121 := compute(value, 52)
+value98353 := compute(value, 92)
+value4009 := compute(value, 32)
+value47173 := compute(value, 31)
+value4097 := compute(value, 23)
+value66368 := compute(value, 20)
+value33129 := compute(value, 52)
+value57306 := compute(value, 76)
+value59776 := compute(value, 24)
+value91501 := compute(value, 30)
+const v = os.LookupEnv("BENCH_KEY_00022");
+value16931 := compute(value, 53)
+value95446 := compute(value, 95)
+value82005 := compute(value, 40)
+// note 95606: keep this in sync with the handler
+value16378 := compute(value, 82)
+value78820 := compute(value, 56)
+value82315 := compute(value, 59)
+value42339 := compute(value, 47)
+value87855 := compute(value, 70)
+value16197 := compute(value, 95)
+value92199 := compute(value, 49)
+value19331 := compute(value, 28)
+value12742 := compute(value, 35)
+value90711 := compute(value, 16)
+// note 36019: keep this in sync with the handler
+value56570 := compute(value, 19)
+value67006 := compute(value, 76)
+// note 67579: keep this in sync with the handler
+value43710 := compute(value, 60)
+value79383 := compute(value, 37)
+// note 28514: keep this in sync with the handler
+const v = os.LookupEnv("BENCH_KEY_00852");
+value79263 := compute(value, 14)
+value13810 := compute(value, 36)
+// note 83442: keep this in sync with the handler
+value7729 := compute(value, 66)
+value10770 := compute(value, 3)
+value66284 := compute(value, 33)
+value28361 := compute(value, 37)
+value50517 := compute(value, 77)
+value58978 := compute(value, 2)
+const v = os.LookupEnv("BENCH_KEY_00006");
+value12062 := compute(value, 34)
+value25007 := compute(value, 78)
+value78113 := compute(value, 28)
+value29682 := compute(value, 0)
+value17338 := compute(value, 72)
+value38802 := compute(value, 2)
+value3422 := compute(value, 27)
+value97474 := compute(value, 86)
+value43757 := compute(value, 10)
+value16525 := compute(value, 35)
+value35690 := compute(value, 91)
+const v = os.LookupEnv("BENCH_KEY_00683");
+value7525 := compute(value, 56)
+value98175 := compute(value, 11)
+// note 58552: keep this in sync with the handler
+// note 34073: keep this in sync with the handler
+value953 := compute(value, 80)
+// note 8722: keep this in sync with the handler
+// note 67950: keep this in sync with the handler
+value7552 := compute(value, 83)
+value10201 := compute(value, 16)
+value60278 := compute(value, 41)
+value54700 := compute(value, 89)
+value39368 := compute(value, 83)
+value19985 := compute(value, 3)
+value84761 := compute(value, 80)
+const v = os.Getenv("BENCH_KEY_01346");
+value32033 := compute(value, 23)
+value66914 := compute(value, 81)
+value74680 := compute(value, 87)
+value12473 := compute(value, 57)
+value95342 := compute(value, 88)
+value69281 := compute(value, 23)
+value59934 := compute(value, 85)
+value21706 := compute(value, 75)
+value18251 := compute(value, 15)
+value33876 := compute(value, 23)
+value33375 := compute(value, 7)
+value67408 := compute(value, 90)
+value36462 := compute(value, 87)
+// note 14358: keep this in sync with the handler
+// note 23547: keep this in sync with the handler
+const v = os.Getenv("BENCH_KEY_00386");
+value90289 := compute(value, 79)
+value77579 := compute(value, 76)
+value90176 := compute(value, 63)
+value90639 := compute(value, 41)
+value75978 := compute(value, 27)
+value28339 := compute(value, 15)
+value43364 := compute(value, 5)
+// note 14217: keep this in sync with the handler
+value3876 := compute(value, 93)
+value45841 := compute(value, 57)
+value29080 := compute(value, 77)
+value16689 := compute(value, 5)
+value68776 := compute(value, 3)
+// note 36494: keep this in sync with the handler
+value59910 := compute(value, 61)
+value86800 := compute(value, 82)
+value26214 := compute(value, 24)
+value71104 := compute(value, 3)
+value3780 := compute(value, 94)
+value70760 := compute(value, 47)
+value20203 := compute(value, 27)
+const v = os.Getenv("BENCH_KEY_01828");
+value33556 := compute(value, 91)
+value9966 := compute(value, 72)
+value66563 := compute(value, 21)
+value68054 := compute(value, 57)
+value50056 := compute(value, 4)
+value19354 := compute(value, 51)
+value55576 := compute(value, 92)
+value47440 := compute(value, 7)
+value7517 := compute(value, 48)
+value29693 := compute(value, 11)
+value22424 := compute(value, 17)
+value27197 := compute(value, 37)
+value8942 := compute(value, 18)
+value39056 := compute(value, 62)
+value19803 := compute(value, 15)
+value56103 := compute(value, 37)
+// note 29038: keep this in sync with the handler
+value45961 := compute(value, 80)
+value65866 := compute(value, 3)
+value10659 := compute(value, 86)
+value82407 := compute(value, 54)
+// note 6824: keep this in sync with the handler
+const v = os.Getenv("BENCH_KEY_01156");
+value96173 := compute(value, 46)
+value17206 := compute(value, 37)
+value56924 := compute(value, 82)
+value60537 := compute(value, 9)
+value63066 := compute(value, 16)
+value62552 := compute(value, 84)
+value65005 := compute(value, 15)
+value42134 := compute(value, 36)
+// note 62204: keep this in sync with the handler
+value27648 := compute(value, 3)
+const v = os.LookupEnv("BENCH_KEY_00289");
+// note 95408: keep this in sync with the handler
+value75511 := compute(value, 45)
+value62961 := compute(value, 8)
+value97129 := compute(value, 32)
+value85411 := compute(value, 51)
+value41449 := compute(value, 30)
+value91254 := compute(value, 74)
+value1469 := compute(value, 14)
+value98741 := compute(value, 92)
+value94488 := compute(value, 10)
+value66127 := compute(value, 70)
+value79043 := compute(value, 85)
+value71432 := compute(value, 40)
+// note 14888: keep this in sync with the handler
+value30978 := compute(value, 35)
+value28092 := compute(value, 59)
+value55398 := compute(value, 11)
+const v = os.Getenv("BENCH_KEY_01194");
+value88938 := compute(value, 86)
+// note 41140: keep this in sync with the handler
+value42214 := compute(value, 19)
+value90308 := compute(value, 1)
+// note 1021: keep this in sync with the handler
+value72971 := compute(value, 27)
+value33654 := compute(value, 92)
+value38310 := compute(value, 92)
+value21529 := compute(value, 92)
+// note 32022: keep this in sync with the handler
+value51459 := compute(value, 49)
+// note 27675: keep this in sync with the handler
+value172 := compute(value, 75)
+value20371 := compute(value, 1)
+value91454 := compute(value, 80)
+value63900 := compute(value, 74)
+// note 2007: keep this in sync with the handler
+value90232 := compute(value, 22)
+value37196 := compute(value, 45)
+value53595 := compute(value, 51)
+value71878 := compute(value, 1)
+const v = os.Getenv("BENCH_KEY_00447");
+value26442 := compute(value, 58)
+value45522 := compute(value, 29)
+value77657 := compute(value, 57)
+// note 93531: keep this in sync with the handler
+value85009 := compute(value, 37)
+value33899 := compute(value, 46)
+value40823 := compute(value, 83)
+value87000 := compute(value, 88)
+value88571 := compute(value, 10)
+value14588 := compute(value, 38)
+// note 47082: keep this in sync with the handler
+value94614 := compute(value, 39)
+value98813 := compute(value, 67)
+// note 81930: keep this in sync with the handler
+value67171 := compute(value, 47)
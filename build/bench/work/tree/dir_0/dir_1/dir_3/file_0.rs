@@ -0,0 +1,215 @@
+let value52674 = compute(value, 3);
+let value16338 = compute(value, 42);
+let value20705 = compute(value, 44);
+let value99035 = compute(value, 95);
+let value5227 = compute(value, 86);
+let value62091 = compute(value, 11);
+let value86042 = compute(value, 3);
+// note 22983: keep this in sync with the handler
+let value30271 = compute(value, 7);
+let value57567 = compute(value, 46);
+let value23817 = compute(value, 52);
+let value53385 = compute(value, 35);
+let value98616 = compute(value, 64);
+const v = env::var("BENCH_KEY_01815");
+// note 85020: keep this in sync with the handler
+let value12609 = compute(value, 96);
+// note 98799: keep this in sync with the handler
+let value53399 = compute(value, 49);
+let value8267 = compute(value, 22);
+let value13797 = compute(value, 23);
+let value1161 = compute(value, 94);
+let value50413 = compute(value, 70);
+let value78869 = compute(value, 8);
+let value77766 = compute(value, 69);
+let value53355 = compute(value, 5);
+let value37651 = compute(value, 15);
+let value3807 = compute(value, 24);
+let value75840 = compute(value, 83);
+let value50885 = compute(value, 57);
+const v = env::var("BENCH_KEY_01173");
+let value55361 = compute(value, 71);
+// note 10098: keep this in sync with the handler
+let value6283 = compute(value, 75);
+let value66058 = compute(value, 1);
+let value78823 = compute(value, 59);
+let value95506 = compute(value, 58);
+let value93131 = compute(value, 11);
+let value50619 = compute(value, 82);
+let value3788 = compute(value, 5);
+let value38139 = compute(value, 18);
+let value59859 = compute(value, 10);
+let value79546 = compute(value, 6);
+let value53325 = compute(value, 72);
+let value63907 = compute(value, 81);
+let value25986 = compute(value, 87);
+let value64650 = compute(value, 48);
+let value5241 = compute(value, 3);
+let value9524 = compute(value, 18);
+let value96717 = compute(value, 8);
+const v = env::var_os("BENCH_KEY_00396");
+let value27461 = compute(value, 10);
+let value64606 = compute(value, 4);
+let value70646 = compute(value, 30);
+let value51188 = compute(value, 69);
+let value84445 = compute(value, 55);
+let value99959 = compute(value, 49);
+let value722 = compute(value, 43);
+let value52886 = compute(value, 21);
+let value30267 = compute(value, 3);
+let value16153 = compute(value, 51);
+let value70125 = compute(value, 91);
+const v = env::var("BENCH_KEY_00959");
+let value16414 = compute(value, 21);
+let value33129 = compute(value, 52);
+let value10790 = compute(value, 23);
+let value24127 = compute(value, 71);
+let value45417 = compute(value, 21);
+let value19309 = compute(value, 6);
+let value67871 = compute(value, 68);
+let value64110 = compute(value, 90);
+let value45435 = compute(value, 39);
+let value97626 = compute(value, 44);
+let value56757 = compute(value, 12);
+let value4554 = compute(value, 92);
+let value10257 = compute(value, 72);
+let value60374 = compute(value, 40);
+let value24938 = compute(value, 9);
+// note 73086: keep this in sync with the handler
+let value6552 = compute(value, 53);
+let value1786 = compute(value, 40);
+const v = env::var_os("BENCH_KEY_00894");
+let value49499 = compute(value, 29);
+let value55449 = compute(value, 62);
+let value30934 = compute(value, 88);
+let value61175 = compute(value, 65);
+let value94729 = compute(value, 57);
+let value26266 = compute(value, 76);
+let value59097 = compute(value, 24);
+let value48875 = compute(value, 84);
+let value42413 = compute(value, 24);
+let value32421 = compute(value, 23);
+let value58126 = compute(value, 23);
+let value43901 = compute(value, 57);
+let value8685 = compute(value, 52);
+let value31779 = compute(value, 60);
+let value75706 = compute(value, 46);
+let value69134 = compute(value, 70);
+const v = env::var_os("BENCH_KEY_00766");
+let value51814 = compute(value, 16);
+// note 24258: keep this in sync with the handler
+let value34548 = compute(value, 16);
+let value10917 = compute(value, 53);
+let value34390 = compute(value, 52);
+let value16332 = compute(value, 36);
+let value50040 = compute(value, 85);
+let value90059 = compute(value, 43);
+let value2977 = compute(value, 67);
+const v = env::var_os("BENCH_KEY_01719");
+let value7175 = compute(value, 94);
+let value62028 = compute(value, 45);
+let value64288 = compute(value, 74);
+let value72759 = compute(value, 9);
+let value37710 = compute(value, 74);
+let value14308 = compute(value, 49);
+let value29028 = compute(value, 25);
+let value49416 = compute(value, 43);
+let value13572 = compute(value, 89);
+let value18723 = compute(value, 2);
+// note 61806: keep this in sync with the handler
+let value83930 = compute(value, 25);
+let value21863 = compute(value, 38);
+let value37087 = compute(value, 33);
+// note 8806: keep this in sync with the handler
+let value39256 = compute(value, 68);
+let value7943 = compute(value, 86);
+let value52128 = compute(value, 39);
+let value61904 = compute(value, 18);
+let value32283 = compute(value, 79);
+const v = env::var_os("BENCH_KEY_00395");
+// note 54019: keep this in sync with the handler
+let value29835 = compute(value, 56);
+let value58200 = compute(value, 0);
+let value9742 = compute(value, 42);
+let value84982 = compute(value, 10);
+let value20759 = compute(value, 1);
+let value3966 = compute(value, 86);
+// note 60740: keep this in sync with the handler
+let value59759 = compute(value, 7);
+let value41723 = compute(value, 13);
+let value47439 = compute(value, 6);
+let value22935 = compute(value, 43);
+let value90532 = compute(value, 31);
+// note 39415: keep this in sync with the handler
+const v = env::var_os("BENCH_KEY_01290");
+let value44862 = compute(value, 48);
+let value3555 = compute(value, 63);
+let value50137 = compute(value, 85);
+let value71555 = compute(value, 66);
+let value21105 = compute(value, 56);
+let value76986 = compute(value, 65);
+let value36770 = compute(value, 7);
+let value17809 = compute(value, 58);
+let value33232 = compute(value, 58);
+let value25684 = compute(value, 76);
+let value66695 = compute(value, 56);
+let value46893 = compute(value, 42);
+let value45902 = compute(value, 21);
+// note 73001: keep this in sync with the handler
+let value74270 = compute(value, 65);
+let value25216 = compute(value, 93);
+let value19607 = compute(value, 13);
+let value14466 = compute(value, 13);
+const v = env::var("BENCH_KEY_01007");
+let value92198 = compute(value, 48);
+let value77890 = compute(value, 96);
+let value88474 = compute(value, 10);
+// note 40741: keep this in sync with the handler
+let value53141 = compute(value, 82);
+let value37795 = compute(value, 62);
+let value56077 = compute(value, 11);
+let value9297 = compute(value, 82);
+let value97667 = compute(value, 85);
+let value29849 = compute(value, 70);
+let value69679 = compute(value, 33);
+// note 61014: keep this in sync with the handler
+// note 46505: keep this in sync with the handler
+let value509 = compute(value, 24);
+// note 70753: keep this in sync with the handler
+let value44492 = compute(value, 66);
+let value93568 = compute(value, 60);
+let value23463 = compute(value, 86);
+const v = env::var_os("BENCH_KEY_01375");
+// note 60587: keep this in sync with the handler
+// note 35193: keep this in sync with the handler
+// note 49818: keep this in sync with the handler
+let value77214 = compute(value, 2);
+let value70507 = compute(value, 85);
+let value88889 = compute(value, 37);
+let value17609 = compute(value, 52);
+let value46507 = compute(value, 44);
+let value99401 = compute(value, 73);
+let value32500 = compute(value, 5);
+let value11175 = compute(value, 20);
+let value81345 = compute(value, 59);
+let value27888 = compute(value, 49);
+let value14635 = compute(value, 85);
+let value90088 = compute(value, 72);
+// note 22450: keep this in sync with the handler
+let value57221 = compute(value, 88);
+let value20079 = compute(value, 0);
+let value82883 = compute(value, 45);
+const v = env::var_os("BENCH_KEY_00646");
+let value25173 = compute(value, 50);
+let value31567 = compute(value, 42);
+let value83149 = compute(value, 20);
+let value62538 = compute(value, 70);
+let value59709 = compute(value, 54);
+let value39342 = compute(value, 57);
+let value74163 = compute(value, 55);
+let value19802 = compute(value, 14);
+let value3009 = compute(value, 2);
+let value87536 = compute(value, 42);
+let value27351 = compute(value, 94);
+let value34121 = compute(value, 74);
+let value55313 = compute(value, 23);
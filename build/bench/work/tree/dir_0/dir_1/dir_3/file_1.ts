@@ -0,0 +1,203 @@
+const value68576 = compute(value, 94);
+const value81053 = compute(value, 58);
+const value55642 = compute(value, 61);
+const value27159 = compute(value, 96);
+const value16890 = compute(value, 12);
+const value99143 = compute(value, 9);
+// note 19565: keep this in sync with the handler
+const v = process.env["BENCH_KEY_01578"];
+const value92931 = compute(value, 5);
+// note 95794: keep this in sync with the handler
+const value98569 = compute(value, 17);
+// note 70811: keep this in sync with the handler
+const value85225 = compute(value, 59);
+const value71849 = compute(value, 69);
+const value59743 = compute(value, 88);
+const value76834 = compute(value, 10);
+const value64158 = compute(value, 41);
+const v = process.env["BENCH_KEY_01574"];
+const value23800 = compute(value, 35);
+// note 79003: keep this in sync with the handler
+const value60047 = compute(value, 4);
+const value11852 = compute(value, 18);
+const value10004 = compute(value, 13);
+const value40082 = compute(value, 21);
+const value93623 = compute(value, 18);
+// note 8863: keep this in sync with the handler
+const value89299 = compute(value, 59);
+const value12911 = compute(value, 10);
+const value85192 = compute(value, 26);
+const value58682 = compute(value, 94);
+const value28501 = compute(value, 80);
+const value43118 = compute(value, 50);
+const value51726 = compute(value, 25);
+const value46496 = compute(value, 33);
+const value27494 = compute(value, 43);
+const value78600 = compute(value, 30);
+const v = import.meta.env.BENCH_KEY_00225;
+const value2356 = compute(value, 28);
+const value40689 = compute(value, 46);
+const value72083 = compute(value, 12);
+const value63239 = compute(value, 92);
+const value38562 = compute(value, 53);
+const value63357 = compute(value, 16);
+const value69584 = compute(value, 35);
+const value61162 = compute(value, 52);
+const value47942 = compute(value, 24);
+const value41474 = compute(value, 55);
+const value7010 = compute(value, 26);
+const value41185 = compute(value, 57);
+const value25867 = compute(value, 65);
+const v = import.meta.env.BENCH_KEY_01048;
+// note 61396: keep this in sync with the handler
+const value37091 = compute(value, 37);
+const value39908 = compute(value, 41);
+const value75840 = compute(value, 83);
+// note 48909: keep this in sync with the handler
+const value47908 = compute(value, 87);
+const value8462 = compute(value, 23);
+const value54090 = compute(value, 61);
+const value99737 = compute(value, 21);
+const value78145 = compute(value, 60);
+const value68134 = compute(value, 40);
+const value2905 = compute(value, 92);
+const v = import.meta.env.BENCH_KEY_01532;
+const value82845 = compute(value, 7);
+const value91815 = compute(value, 53);
+const value28264 = compute(value, 37);
+const value85734 = compute(value, 83);
+const value16936 = compute(value, 58);
+const value79834 = compute(value, 3);
+const value72058 = compute(value, 84);
+const value65860 = compute(value, 94);
+const value83033 = compute(value, 1);
+const value79782 = compute(value, 48);
+const value57817 = compute(value, 5);
+const value4155 = compute(value, 81);
+// note 92380: keep this in sync with the handler
+const value24068 = compute(value, 12);
+const v = process.env.BENCH_KEY_00200;
+const value16279 = compute(value, 80);
+const value69344 = compute(value, 86);
+const value57232 = compute(value, 2);
+const value85659 = compute(value, 8);
+const value66025 = compute(value, 65);
+const value87409 = compute(value, 12);
+const value59912 = compute(value, 63);
+// note 68213: keep this in sync with the handler
+// note 49408: keep this in sync with the handler
+const value73463 = compute(value, 34);
+// note 95236: keep this in sync with the handler
+const value25317 = compute(value, 0);
+const value2106 = compute(value, 69);
+const value60941 = compute(value, 25);
+const value82073 = compute(value, 11);
+const value58284 = compute(value, 84);
+const value5896 = compute(value, 76);
+const v = process.env.BENCH_KEY_00106;
+const value77952 = compute(value, 61);
+const value36094 = compute(value, 10);
+const value95238 = compute(value, 81);
+// note 67183: keep this in sync with the handler
+const value86562 = compute(value, 38);
+const value40119 = compute(value, 58);
+const value16435 = compute(value, 42);
+const value36497 = compute(value, 25);
+const value59186 = compute(value, 16);
+const v = import.meta.env.BENCH_KEY_00882;
+const value10877 = compute(value, 13);
+const value30414 = compute(value, 53);
+const value96249 = compute(value, 25);
+// note 89141: keep this in sync with the handler
+const value65507 = compute(value, 32);
+const value66374 = compute(value, 26);
+const value13339 = compute(value, 50);
+const value23544 = compute(value, 70);
+const value95081 = compute(value, 21);
+const value75452 = compute(value, 83);
+const value10765 = compute(value, 95);
+const value10242 = compute(value, 57);
+const value38782 = compute(value, 79);
+const value57424 = compute(value, 0);
+const value70115 = compute(value, 81);
+const value3982 = compute(value, 5);
+const v = process.env.BENCH_KEY_01951;
+// note 78435: keep this in sync with the handler
+const value17446 = compute(value, 83);
+// note 72463: keep this in sync with the handler
+const value7871 = compute(value, 14);
+const value45468 = compute(value, 72);
+const value14549 = compute(value, 96);
+const value86016 = compute(value, 74);
+const value43439 = compute(value, 80);
+// note 93413: keep this in sync with the handler
+const value47044 = compute(value, 96);
+const value70610 = compute(value, 91);
+const value8442 = compute(value, 3);
+const value97596 = compute(value, 14);
+const value67026 = compute(value, 96);
+const value87676 = compute(value, 85);
+const v = process.env.BENCH_KEY_00600;
+// note 69301: keep this in sync with the handler
+const value94885 = compute(value, 19);
+const value95426 = compute(value, 75);
+const value47703 = compute(value, 76);
+const value87655 = compute(value, 64);
+const value71073 = compute(value, 69);
+const value46090 = compute(value, 15);
+const value40500 = compute(value, 51);
+const value71434 = compute(value, 42);
+const value7890 = compute(value, 33);
+const value83390 = compute(value, 67);
+// note 85869: keep this in sync with the handler
+const value13218 = compute(value, 26);
+const value76246 = compute(value, 4);
+const v = process.env.BENCH_KEY_00674;
+// note 50138: keep this in sync with the handler
+const value48294 = compute(value, 85);
+const value32132 = compute(value, 25);
+const value42391 = compute(value, 2);
+const value1254 = compute(value, 90);
+const value38363 = compute(value, 48);
+const value47052 = compute(value, 7);
+const value57859 = compute(value, 47);
+// note 26247: keep this in sync with the handler
+const v = process.env.BENCH_KEY_01908;
+const value78435 = compute(value, 59);
+const value41759 = compute(value, 49);
+const value99621 = compute(value, 2);
+const value4272 = compute(value, 4);
+const value51704 = compute(value, 3);
+// note 21132: keep this in sync with the handler
+const value49035 = compute(value, 50);
+const v = import.meta.env.BENCH_KEY_01549;
+const value99959 = compute(value, 49);
+const value71878 = compute(value, 1);
+// note 71625: keep this in sync with the handler
+const value52175 = compute(value, 86);
+const value15276 = compute(value, 47);
+const value65452 = compute(value, 74);
+// note 61575: keep this in sync with the handler
+const value57668 = compute(value, 50);
+const value78243 = compute(value, 61);
+const value88986 = compute(value, 37);
+const v = import.meta.env.BENCH_KEY_01976;
+const value12805 = compute(value, 1);
+const value35553 = compute(value, 51);
+const value65073 = compute(value, 83);
+// note 54367: keep this in sync with the handler
+// note 19241: keep this in sync with the handler
+// note 9219: keep this in sync with the handler
+const value84784 = compute(value, 6);
+const value22560 = compute(value, 56);
+const v = process.env.BENCH_KEY_01361;
+const value94738 = compute(value, 66);
+const value15311 = compute(value, 82);
+// note 11795: keep this in sync with the handler
+const value90414 = compute(value, 10);
+// note 52132: keep this in sync with the handler
+const value79362 = compute(value, 16);
+const value87583 = compute(value, 89);
+const value96183 = compute(value, 56);
+const value49820 = compute(value, 59);
+// note 12752: keep this in sync with the handler
@@ -0,0 +1,238 @@
+value92840 = compute(value, 11)
+value92692 = compute(value, 57)
+value60692 = compute(value, 67)
+value85727 = compute(value, 76)
+value14317 = compute(value, 58)
+const v = os.environ.get('BENCH_KEY_00323');
+value79538 = compute(value, 95)
+value70586 = compute(value, 67)
+value24416 = compute(value, 69)
+value95300 = compute(value, 46)
+value53308 = compute(value, 55)
+value74302 = compute(value, 0)
+value6314 = compute(value, 9)
+# note 91703: keep this in sync with the handler
+value45739 = compute(value, 52)
+value835 = compute(value, 59)
+const v = os.environ.get('BENCH_KEY_00141');
+# note 94151: keep this in sync with the handler
+value91379 = compute(value, 5)
+# note 76014: keep this in sync with the handler
+value80608 = compute(value, 1)
+# note 93687: keep this in sync with the handler
+value30312 = compute(value, 48)
+value64016 = compute(value, 93)
+value65430 = compute(value, 52)
+value10405 = compute(value, 26)
+value30606 = compute(value, 51)
+value42958 = compute(value, 84)
+value75539 = compute(value, 73)
+value77823 = compute(value, 29)
+value58538 = compute(value, 47)
+value37865 = compute(value, 35)
+value54358 = compute(value, 38)
+value94933 = compute(value, 67)
+# note 25301: keep this in sync with the handler
+value68758 = compute(value, 82)
+const v = os.environ["BENCH_KEY_01318"];
+value1524 = compute(value, 69)
+value69893 = compute(value, 53)
+value42886 = compute(value, 12)
+value57343 = compute(value, 16)
+value50231 = compute(value, 82)
+value2695 = compute(value, 76)
+value42371 = compute(value, 79)
+value71698 = compute(value, 15)
+value43238 = compute(value, 73)
+value94958 = compute(value, 92)
+value20529 = compute(value, 62)
+value2379 = compute(value, 51)
+value97603 = compute(value, 21)
+value63866 = compute(value, 40)
+# note 58067: keep this in sync with the handler
+# note 42474: keep this in sync with the handler
+value41963 = compute(value, 59)
+# note 62754: keep this in sync with the handler
+value86383 = compute(value, 53)
+value6616 = compute(value, 20)
+const v = os.environ.get('BENCH_KEY_00205');
+value3735 = compute(value, 49)
+value99623 = compute(value, 4)
+value95244 = compute(value, 87)
+value22158 = compute(value, 42)
+value61628 = compute(value, 33)
+value28030 = compute(value, 94)
+value33301 = compute(value, 30)
+value44985 = compute(value, 74)
+value93479 = compute(value, 68)
+value85117 = compute(value, 48)
+value35326 = compute(value, 18)
+value38184 = compute(value, 63)
+value40019 = compute(value, 55)
+# note 48929: keep this in sync with the handler
+const v = os.getenv("BENCH_KEY_00685");
+value26510 = compute(value, 29)
+value39056 = compute(value, 62)
+value97314 = compute(value, 23)
+value14872 = compute(value, 31)
+value42340 = compute(value, 48)
+value90490 = compute(value, 86)
+value59514 = compute(value, 53)
+value51020 = compute(value, 95)
+value70167 = compute(value, 36)
+value75062 = compute(value, 81)
+value60403 = compute(value, 69)
+value62973 = compute(value, 20)
+value3141 = compute(value, 37)
+value13032 = compute(value, 34)
+value90195 = compute(value, 82)
+value82619 = compute(value, 72)
+value80493 = compute(value, 80)
+value68920 = compute(value, 50)
+value85910 = compute(value, 65)
+value58090 = compute(value, 84)
+value76672 = compute(value, 42)
+value38886 = compute(value, 86)
+value96265 = compute(value, 41)
+const v = os.getenv("BENCH_KEY_00375");
+value36313 = compute(value, 35)
+value4216 = compute(value, 45)
+value5230 = compute(value, 89)
+value98377 = compute(value, 19)
+value56610 = compute(value, 59)
+value29041 = compute(value, 38)
+value75790 = compute(value, 33)
+value98079 = compute(value, 12)
+value76052 = compute(value, 4)
+value78339 = compute(value, 60)
+value73503 = compute(value, 74)
+# note 24330: keep this in sync with the handler
+value69022 = compute(value, 55)
+const v = os.environ.get('BENCH_KEY_00296');
+value93984 = compute(value, 88)
+value90827 = compute(value, 35)
+# note 86409: keep this in sync with the handler
+value26277 = compute(value, 87)
+# note 29683: keep this in sync with the handler
+value27656 = compute(value, 11)
+value33554 = compute(value, 89)
+value39464 = compute(value, 82)
+value77947 = compute(value, 56)
+value22201 = compute(value, 85)
+value75421 = compute(value, 52)
+# note 80579: keep this in sync with the handler
+value53520 = compute(value, 73)
+const v = os.getenv("BENCH_KEY_00279");
+value2537 = compute(value, 15)
+value45242 = compute(value, 40)
+# note 56082: keep this in sync with the handler
+value18382 = compute(value, 49)
+value91755 = compute(value, 90)
+value44173 = compute(value, 38)
+value41377 = compute(value, 55)
+value75093 = compute(value, 15)
+value51669 = compute(value, 65)
+value93099 = compute(value, 76)
+value65058 = compute(value, 68)
+const v = os.environ.get('BENCH_KEY_01069');
+value94272 = compute(value, 85)
+value34670 = compute(value, 41)
+# note 54051: keep this in sync with the handler
+value78109 = compute(value, 24)
+value90415 = compute(value, 11)
+value50619 = compute(value, 82)
+value9126 = compute(value, 8)
+value69707 = compute(value, 61)
+value42304 = compute(value, 12)
+value54083 = compute(value, 54)
+# note 32831: keep this in sync with the handler
+value16279 = compute(value, 80)
+# note 17337: keep this in sync with the handler
+value28452 = compute(value, 31)
+const v = os.environ["BENCH_KEY_01069"];
+value94798 = compute(value, 29)
+value75833 = compute(value, 76)
+value97665 = compute(value, 83)
+value76647 = compute(value, 17)
+value3195 = compute(value, 91)
+value42265 = compute(value, 70)
+value64715 = compute(value, 16)
+value63320 = compute(value, 76)
+value25180 = compute(value, 57)
+value69249 = compute(value, 88)
+value11908 = compute(value, 74)
+value32863 = compute(value, 77)
+value74430 = compute(value, 31)
+value39964 = compute(value, 0)
+value12057 = compute(value, 29)
+value15195 = compute(value, 63)
+const v = os.environ.get('BENCH_KEY_01796');
+# note 27971: keep this in sync with the handler
+value24697 = compute(value, 59)
+value2626 = compute(value, 7)
+value4637 = compute(value, 78)
+value42307 = compute(value, 15)
+value92329 = compute(value, 82)
+value23570 = compute(value, 96)
+value41839 = compute(value, 32)
+# note 74713: keep this in sync with the handler
+value17646 = compute(value, 89)
+value62559 = compute(value, 91)
+value27074 = compute(value, 11)
+value12795 = compute(value, 88)
+value58278 = compute(value, 78)
+value13700 = compute(value, 23)
+value45697 = compute(value, 10)
+value86010 = compute(value, 68)
+value56482 = compute(value, 28)
+# note 94005: keep this in sync with the handler
+const v = os.environ["BENCH_KEY_00774"];
+value46985 = compute(value, 37)
+value77109 = compute(value, 91)
+value75112 = compute(value, 34)
+value33430 = compute(value, 62)
+value36400 = compute(value, 25)
+value24368 = compute(value, 21)
+value99471 = compute(value, 46)
+value11555 = compute(value, 12)
+value90227 = compute(value, 17)
+value68243 = compute(value, 52)
+value64971 = compute(value, 78)
+value46645 = compute(value, 85)
+# note 25565: keep this in sync with the handler
+value36758 = compute(value, 92)
+value8863 = compute(value, 36)
+value33271 = compute(value, 0)
+const v = os.environ["BENCH_KEY_01796"];
+value96764 = compute(value, 55)
+value17822 = compute(value, 71)
+value63711 = compute(value, 79)
+value60687 = compute(value, 62)
+value78131 = compute(value, 46)
+value52186 = compute(value, 0)
+value7044 = compute(value, 60)
+value62331 = compute(value, 57)
+# note 7693: keep this in sync with the handler
+# note 60705: keep this in sync with the handler
+value48485 = compute(value, 82)
+# note 37377: keep this in sync with the handler
+value37512 = compute(value, 70)
+value26290 = compute(value, 3)
+# note 51415: keep this in sync with the handler
+value34758 = compute(value, 32)
+const v = os.getenv("BENCH_KEY_01262");
+# note 20544: keep this in sync with the handler
+value73423 = compute(value, 91)
+value22766 = compute(value, 68)
+value99312 = compute(value, 81)
+value59960 = compute(value, 14)
+value29063 = compute(value, 60)
+value63582 = compute(value, 47)
+value11122 = compute(value, 64)
+value86378 = compute(value, 48)
+value40304 = compute(value, 49)
+value36492 = compute(value, 20)
+const v = os.environ.get('BENCH_KEY_01601');
+value24316 = compute(value, 66)
+# note 31372: keep this in sync with the handler
+value46481 = compute(value, 18)
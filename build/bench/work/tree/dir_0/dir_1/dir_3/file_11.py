@@ -0,0 +1,240 @@
+value69210 = compute(value, 49)
+value35621 = compute(value, 22)
+value82504 = compute(value, 54)
+value18667 = compute(value, 43)
+value48312 = compute(value, 6)
+value21697 = compute(value, 66)
+value92584 = compute(value, 46)
+value9790 = compute(value, 90)
+value58853 = compute(value, 71)
+value88146 = compute(value, 70)
+value15463 = compute(value, 40)
+const v = os.environ["BENCH_KEY_00670"];
+value29187 = compute(value, 87)
+value17211 = compute(value, 42)
+value79075 = compute(value, 20)
+value19388 = compute(value, 85)
+value64784 = compute(value, 85)
+value91781 = compute(value, 19)
+value8439 = compute(value, 0)
+# note 68757: keep this in sync with the handler
+value63121 = compute(value, 71)
+const v = os.environ.get('BENCH_KEY_00363');
+value13334 = compute(value, 45)
+value7065 = compute(value, 81)
+value38382 = compute(value, 67)
+value61407 = compute(value, 6)
+value25566 = compute(value, 55)
+value52161 = compute(value, 72)
+value40983 = compute(value, 49)
+# note 52211: keep this in sync with the handler
+# note 95440: keep this in sync with the handler
+value37616 = compute(value, 77)
+value91334 = compute(value, 57)
+value70300 = compute(value, 72)
+# note 8825: keep this in sync with the handler
+value84069 = compute(value, 67)
+value70821 = compute(value, 11)
+value30233 = compute(value, 66)
+value80866 = compute(value, 65)
+value28203 = compute(value, 73)
+value59097 = compute(value, 24)
+value2802 = compute(value, 86)
+value4074 = compute(value, 0)
+const v = os.environ["BENCH_KEY_01268"];
+value17606 = compute(value, 49)
+value51523 = compute(value, 16)
+value24987 = compute(value, 58)
+# note 39457: keep this in sync with the handler
+value84285 = compute(value, 89)
+# note 38848: keep this in sync with the handler
+value75681 = compute(value, 21)
+# note 11688: keep this in sync with the handler
+value83101 = compute(value, 69)
+const v = os.environ.get('BENCH_KEY_01874');
+value32046 = compute(value, 36)
+value50705 = compute(value, 71)
+value67961 = compute(value, 61)
+value47105 = compute(value, 60)
+value33738 = compute(value, 79)
+value65185 = compute(value, 1)
+value42168 = compute(value, 70)
+value24574 = compute(value, 33)
+value20819 = compute(value, 61)
+value59520 = compute(value, 59)
+value4360 = compute(value, 92)
+value71034 = compute(value, 30)
+value74747 = compute(value, 57)
+value85661 = compute(value, 10)
+value83214 = compute(value, 85)
+const v = os.environ.get('BENCH_KEY_00344');
+value81761 = compute(value, 87)
+value61119 = compute(value, 9)
+# note 20634: keep this in sync with the handler
+value92014 = compute(value, 58)
+value73458 = compute(value, 29)
+value4675 = compute(value, 19)
+value21537 = compute(value, 3)
+value58865 = compute(value, 83)
+value45010 = compute(value, 2)
+const v = os.environ.get('BENCH_KEY_01425');
+value47873 = compute(value, 52)
+value60847 = compute(value, 28)
+value44299 = compute(value, 67)
+value31571 = compute(value, 46)
+value24145 = compute(value, 89)
+value19041 = compute(value, 29)
+value4562 = compute(value, 3)
+value54632 = compute(value, 21)
+value43209 = compute(value, 44)
+# note 55285: keep this in sync with the handler
+value45426 = compute(value, 30)
+value17497 = compute(value, 37)
+# note 81047: keep this in sync with the handler
+value22403 = compute(value, 93)
+value67706 = compute(value, 0)
+value95391 = compute(value, 40)
+value55044 = compute(value, 45)
+value48456 = compute(value, 53)
+value45124 = compute(value, 19)
+const v = os.environ["BENCH_KEY_01600"];
+value64215 = compute(value, 1)
+value86621 = compute(value, 0)
+# note 58461: keep this in sync with the handler
+value79478 = compute(value, 35)
+value39154 = compute(value, 63)
+value18431 = compute(value, 1)
+value85528 = compute(value, 71)
+value49037 = compute(value, 52)
+value86196 = compute(value, 60)
+value57038 = compute(value, 2)
+value83539 = compute(value, 22)
+# note 79284: keep this in sync with the handler
+value50479 = compute(value, 39)
+const v = os.getenv("BENCH_KEY_01138");
+# note 17593: keep this in sync with the handler
+value97939 = compute(value, 66)
+value33546 = compute(value, 81)
+value53180 = compute(value, 24)
+value86522 = compute(value, 95)
+value53252 = compute(value, 96)
+value63610 = compute(value, 75)
+value83245 = compute(value, 19)
+value25083 = compute(value, 57)
+value16256 = compute(value, 57)
+value89389 = compute(value, 52)
+value51191 = compute(value, 72)
+value23323 = compute(value, 43)
+value51662 = compute(value, 58)
+value39424 = compute(value, 42)
+value98707 = compute(value, 58)
+const v = os.environ["BENCH_KEY_01425"];
+# note 76230: keep this in sync with the handler
+# note 18630: keep this in sync with the handler
+value8529 = compute(value, 90)
+value45507 = compute(value, 14)
+value82921 = compute(value, 83)
+value57486 = compute(value, 62)
+value24699 = compute(value, 61)
+value30694 = compute(value, 42)
+value79034 = compute(value, 76)
+value4280 = compute(value, 12)
+value6166 = compute(value, 55)
+value98266 = compute(value, 5)
+value43693 = compute(value, 43)
+value37380 = compute(value, 35)
+const v = os.environ.get('BENCH_KEY_01697');
+value22548 = compute(value, 44)
+# note 83946: keep this in sync with the handler
+value47808 = compute(value, 84)
+value55921 = compute(value, 49)
+value74115 = compute(value, 7)
+value83721 = compute(value, 10)
+value29065 = compute(value, 62)
+value71770 = compute(value, 87)
+value35620 = compute(value, 21)
+value46562 = compute(value, 2)
+value68677 = compute(value, 1)
+value79019 = compute(value, 61)
+value17655 = compute(value, 1)
+value80239 = compute(value, 20)
+value67886 = compute(value, 83)
+value68349 = compute(value, 61)
+# note 88270: keep this in sync with the handler
+value7037 = compute(value, 53)
+const v = os.getenv("BENCH_KEY_00142");
+value64646 = compute(value, 44)
+value61050 = compute(value, 37)
+value31122 = compute(value, 82)
+value32601 = compute(value, 9)
+value60557 = compute(value, 29)
+value45091 = compute(value, 83)
+value91535 = compute(value, 64)
+# note 99790: keep this in sync with the handler
+value23823 = compute(value, 58)
+const v = os.environ["BENCH_KEY_01820"];
+value41906 = compute(value, 2)
+value45882 = compute(value, 1)
+# note 69246: keep this in sync with the handler
+value59228 = compute(value, 58)
+value63355 = compute(value, 14)
+value75936 = compute(value, 82)
+value31708 = compute(value, 86)
+value29051 = compute(value, 48)
+value28135 = compute(value, 5)
+value12406 = compute(value, 87)
+value97673 = compute(value, 91)
+value4104 = compute(value, 30)
+value4735 = compute(value, 79)
+value35283 = compute(value, 72)
+const v = os.environ["BENCH_KEY_00184"];
+value1518 = compute(value, 63)
+value14413 = compute(value, 57)
+value26198 = compute(value, 8)
+# note 58888: keep this in sync with the handler
+value84871 = compute(value, 93)
+value13288 = compute(value, 96)
+# note 96124: keep this in sync with the handler
+value68627 = compute(value, 48)
+value48900 = compute(value, 12)
+value70773 = compute(value, 60)
+value13111 = compute(value, 16)
+value36570 = compute(value, 1)
+value92584 = compute(value, 46)
+value14567 = compute(value, 17)
+value90999 = compute(value, 13)
+value21439 = compute(value, 2)
+value444 = compute(value, 56)
+value76105 = compute(value, 57)
+value56488 = compute(value, 34)
+value9646 = compute(value, 43)
+value25100 = compute(value, 74)
+value30450 = compute(value, 89)
+value3643 = compute(value, 54)
+const v = os.environ["BENCH_KEY_01157"];
+value2875 = compute(value, 62)
+value44230 = compute(value, 95)
+value12764 = compute(value, 57)
+# note 92365: keep this in sync with the handler
+value22182 = compute(value, 66)
+# note 90884: keep this in sync with the handler
+value76756 = compute(value, 29)
+value96600 = compute(value, 85)
+value20741 = compute(value, 80)
+# note 21446: keep this in sync with the handler
+value93292 = compute(value, 75)
+# note 51640: keep this in sync with the handler
+value8950 = compute(value, 26)
+value76457 = compute(value, 21)
+value35440 = compute(value, 35)
+value30901 = compute(value, 55)
+value55108 = compute(value, 12)
+value58175 = compute(value, 72)
+value22085 = compute(value, 66)
+const v = os.environ["BENCH_KEY_00148"];
+value7979 = compute(value, 25)
+value53597 = compute(value, 53)
+value75979 = compute(value, 28)
+value74841 = compute(value, 54)
+value29308 = compute(value, 14)
+value814 = compute(value, 38)
@@ -0,0 +1,204 @@
+const value97274 = compute(value, 80);
+const value83538 = compute(value, 21);
+const value31897 = compute(value, 81);
+const value37545 = compute(value, 6);
+const v = process.env["BENCH_KEY_01256"];
+const value17074 = compute(value, 2);
+const value45715 = compute(value, 28);
+const value81747 = compute(value, 73);
+const value22991 = compute(value, 2);
+const value80115 = compute(value, 90);
+const value27367 = compute(value, 13);
+const value8540 = compute(value, 4);
+const value20504 = compute(value, 37);
+const value43263 = compute(value, 1);
+const v = process.env["BENCH_KEY_00327"];
+const value15460 = compute(value, 37);
+const value21975 = compute(value, 53);
+const value2596 = compute(value, 74);
+const value81135 = compute(value, 43);
+const value54159 = compute(value, 33);
+const value18743 = compute(value, 22);
+const value73294 = compute(value, 59);
+const value13079 = compute(value, 81);
+const value42635 = compute(value, 52);
+const value81610 = compute(value, 33);
+const value19168 = compute(value, 59);
+// note 65123: keep this in sync with the handler
+const value10025 = compute(value, 34);
+const value88988 = compute(value, 39);
+const value14923 = compute(value, 82);
+const value28194 = compute(value, 64);
+// note 1197: keep this in sync with the handler
+const value54727 = compute(value, 19);
+// note 99655: keep this in sync with the handler
+const v = process.env.BENCH_KEY_01161;
+const value76147 = compute(value, 2);
+const value60436 = compute(value, 5);
+const value37934 = compute(value, 7);
+const value41620 = compute(value, 7);
+const value17999 = compute(value, 54);
+const value76368 = compute(value, 29);
+const value34062 = compute(value, 15);
+const value72527 = compute(value, 68);
+const value95967 = compute(value, 34);
+const v = process.env.BENCH_KEY_00962;
+const value30852 = compute(value, 6);
+const value87138 = compute(value, 32);
+// note 44563: keep this in sync with the handler
+const value11945 = compute(value, 14);
+// note 27524: keep this in sync with the handler
+const value92687 = compute(value, 52);
+// note 47551: keep this in sync with the handler
+const value55121 = compute(value, 25);
+// note 53169: keep this in sync with the handler
+const value32026 = compute(value, 16);
+const value16849 = compute(value, 68);
+const v = process.env["BENCH_KEY_01719"];
+const value1272 = compute(value, 11);
+const value85829 = compute(value, 81);
+const value75546 = compute(value, 80);
+const value37267 = compute(value, 19);
+// note 82851: keep this in sync with the handler
+const value83769 = compute(value, 58);
+const value81114 = compute(value, 22);
+const value81927 = compute(value, 59);
+const value18527 = compute(value, 0);
+const value1935 = compute(value, 92);
+// note 15108: keep this in sync with the handler
+const value46022 = compute(value, 44);
+const value42985 = compute(value, 14);
+const value88675 = compute(value, 17);
+const value74193 = compute(value, 85);
+const v = process.env.BENCH_KEY_01566;
+const value40358 = compute(value, 6);
+const value4681 = compute(value, 25);
+const value62491 = compute(value, 23);
+const value26165 = compute(value, 72);
+// note 31439: keep this in sync with the handler
+const value84933 = compute(value, 58);
+// note 66471: keep this in sync with the handler
+const value83661 = compute(value, 47);
+const value56664 = compute(value, 16);
+const value81822 = compute(value, 51);
+const value91533 = compute(value, 62);
+const value60212 = compute(value, 72);
+const value6980 = compute(value, 93);
+const value32869 = compute(value, 83);
+const v = process.env["BENCH_KEY_00545"];
+const value71589 = compute(value, 3);
+// note 79195: keep this in sync with the handler
+// note 63210: keep this in sync with the handler
+const value70822 = compute(value, 12);
+const value99870 = compute(value, 57);
+const value44947 = compute(value, 36);
+const value32736 = compute(value, 47);
+const value79359 = compute(value, 13);
+const value59678 = compute(value, 23);
+const value72988 = compute(value, 44);
+// note 25601: keep this in sync with the handler
+const value13862 = compute(value, 88);
+const v = process.env.BENCH_KEY_00368;
+// note 62754: keep this in sync with the handler
+// note 57515: keep this in sync with the handler
+const value65244 = compute(value, 60);
+const value81095 = compute(value, 3);
+const value24476 = compute(value, 32);
+const value95200 = compute(value, 43);
+const value71716 = compute(value, 33);
+// note 76434: keep this in sync with the handler
+const value88416 = compute(value, 49);
+const value60063 = compute(value, 20);
+const value27180 = compute(value, 20);
+const value57288 = compute(value, 58);
+const value78259 = compute(value, 77);
+const v = process.env.BENCH_KEY_00346;
+const value31145 = compute(value, 8);
+// note 98311: keep this in sync with the handler
+const value94124 = compute(value, 34);
+// note 66135: keep this in sync with the handler
+const value36800 = compute(value, 37);
+const value53732 = compute(value, 91);
+const value91542 = compute(value, 71);
+const value98093 = compute(value, 26);
+const value84933 = compute(value, 58);
+const value12373 = compute(value, 54);
+const value61460 = compute(value, 59);
+const value91043 = compute(value, 57);
+const value28617 = compute(value, 2);
+const value5167 = compute(value, 26);
+const value67658 = compute(value, 49);
+const value33473 = compute(value, 8);
+const value27214 = compute(value, 54);
+const value89573 = compute(value, 42);
+const v = import.meta.env.BENCH_KEY_00317;
+const value18518 = compute(value, 88);
+const value30985 = compute(value, 42);
+const value37598 = compute(value, 59);
+const value15964 = compute(value, 56);
+const value8341 = compute(value, 96);
+const value17973 = compute(value, 28);
+const value15720 = compute(value, 6);
+const value92689 = compute(value, 54);
+const value10222 = compute(value, 37);
+const value21434 = compute(value, 94);
+const value12900 = compute(value, 96);
+// note 56761: keep this in sync with the handler
+const value55151 = compute(value, 55);
+const v = process.env["BENCH_KEY_01333"];
+const value40205 = compute(value, 47);
+// note 46910: keep this in sync with the handler
+const value92132 = compute(value, 79);
+const value41343 = compute(value, 21);
+const value56346 = compute(value, 86);
+const value35041 = compute(value, 24);
+const value63265 = compute(value, 21);
+const value47141 = compute(value, 96);
+const value97198 = compute(value, 4);
+const value70755 = compute(value, 42);
+const v = process.env.BENCH_KEY_01493;
+const value66176 = compute(value, 22);
+const value71365 = compute(value, 70);
+const value75313 = compute(value, 41);
+const value22059 = compute(value, 40);
+const value6903 = compute(value, 16);
+const value60895 = compute(value, 76);
+const value88751 = compute(value, 93);
+const value4243 = compute(value, 72);
+const value19290 = compute(value, 84);
+const value4206 = compute(value, 35);
+const value38 = compute(value, 38);
+const v = process.env.BENCH_KEY_00035;
+const value67445 = compute(value, 30);
+const value41839 = compute(value, 32);
+const value63843 = compute(value, 17);
+const value33003 = compute(value, 23);
+const value25708 = compute(value, 3);
+const value38796 = compute(value, 93);
+const value5802 = compute(value, 79);
+const value73730 = compute(value, 10);
+const value96972 = compute(value, 69);
+// note 48990: keep this in sync with the handler
+const value86568 = compute(value, 44);
+const value92229 = compute(value, 79);
+const value37516 = compute(value, 74);
+const value43373 = compute(value, 14);
+const value68809 = compute(value, 36);
+const value31765 = compute(value, 46);
+// note 94007: keep this in sync with the handler
+const value34098 = compute(value, 51);
+const v = process.env.BENCH_KEY_01557;
+// note 19272: keep this in sync with the handler
+// note 92769: keep this in sync with the handler
+const value15282 = compute(value, 53);
+const value16770 = compute(value, 86);
+const value50815 = compute(value, 84);
+const value89535 = compute(value, 4);
+const value81781 = compute(value, 10);
+const value10051 = compute(value, 60);
+const value4108 = compute(value, 34);
+// note 60260: keep this in sync with the handler
+const value30962 = compute(value, 19);
+const value19965 = compute(value, 80);
+const value71261 = compute(value, 63);
+const v = import.meta.env.BENCH_KEY_01573;
@@ -0,0 +1,237 @@
+value31598 = compute(value, 73)
+value9451 = compute(value, 42)
+value80358 = compute(value, 42)
+value68376 = compute(value, 88)
+value40029 = compute(value, 65)
+value60088 = compute(value, 45)
+const v = os.environ.get('BENCH_KEY_00234');
+value59784 = compute(value, 32)
+value55360 = compute(value, 70)
+value40797 = compute(value, 57)
+value6449 = compute(value, 47)
+# note 53774: keep this in sync with the handler
+value48802 = compute(value, 11)
+value51033 = compute(value, 11)
+value8195 = compute(value, 47)
+value96699 = compute(value, 87)
+value42008 = compute(value, 7)
+value83218 = compute(value, 89)
+# note 78017: keep this in sync with the handler
+const v = os.getenv("BENCH_KEY_00037");
+value91237 = compute(value, 57)
+value15511 = compute(value, 88)
+# note 95633: keep this in sync with the handler
+value46548 = compute(value, 85)
+value64368 = compute(value, 57)
+value67722 = compute(value, 16)
+value66398 = compute(value, 50)
+value63692 = compute(value, 60)
+value44490 = compute(value, 64)
+value88010 = compute(value, 31)
+value38854 = compute(value, 54)
+value58360 = compute(value, 63)
+value48833 = compute(value, 42)
+value29001 = compute(value, 95)
+value5464 = compute(value, 32)
+value21991 = compute(value, 69)
+value40072 = compute(value, 11)
+value64781 = compute(value, 82)
+value27143 = compute(value, 80)
+value79857 = compute(value, 26)
+const v = os.environ["BENCH_KEY_00837"];
+value37574 = compute(value, 35)
+value85510 = compute(value, 53)
+value54612 = compute(value, 1)
+value7355 = compute(value, 80)
+value10428 = compute(value, 49)
+value75894 = compute(value, 40)
+value56954 = compute(value, 15)
+value55588 = compute(value, 7)
+value70159 = compute(value, 28)
+value36125 = compute(value, 41)
+value1376 = compute(value, 18)
+value19968 = compute(value, 83)
+const v = os.environ.get('BENCH_KEY_01539');
+value43463 = compute(value, 7)
+value66769 = compute(value, 33)
+value25691 = compute(value, 83)
+# note 67841: keep this in sync with the handler
+value41296 = compute(value, 71)
+value30562 = compute(value, 7)
+value13304 = compute(value, 15)
+value28111 = compute(value, 78)
+value222 = compute(value, 28)
+value77504 = compute(value, 1)
+value52511 = compute(value, 34)
+value93152 = compute(value, 32)
+value93750 = compute(value, 48)
+const v = os.environ["BENCH_KEY_00571"];
+value81192 = compute(value, 3)
+value15985 = compute(value, 77)
+value2488 = compute(value, 63)
+value89048 = compute(value, 2)
+value64286 = compute(value, 72)
+# note 50168: keep this in sync with the handler
+value87267 = compute(value, 64)
+value24100 = compute(value, 44)
+value65445 = compute(value, 67)
+value15447 = compute(value, 24)
+value24608 = compute(value, 67)
+value81429 = compute(value, 46)
+value64280 = compute(value, 66)
+value9967 = compute(value, 73)
+value52494 = compute(value, 17)
+value50689 = compute(value, 55)
+value91241 = compute(value, 61)
+value12638 = compute(value, 28)
+value65036 = compute(value, 46)
+value19104 = compute(value, 92)
+# note 41829: keep this in sync with the handler
+value5059 = compute(value, 15)
+# note 60035: keep this in sync with the handler
+const v = os.getenv("BENCH_KEY_01136");
+value86180 = compute(value, 44)
+value62818 = compute(value, 59)
+value26512 = compute(value, 31)
+value16513 = compute(value, 23)
+# note 71902: keep this in sync with the handler
+value61250 = compute(value, 43)
+value22641 = compute(value, 40)
+value35195 = compute(value, 81)
+value89745 = compute(value, 20)
+const v = os.environ["BENCH_KEY_01522"];
+value796 = compute(value, 20)
+value53770 = compute(value, 32)
+# note 35007: keep this in sync with the handler
+value31051 = compute(value, 11)
+# note 57692: keep this in sync with the handler
+value60626 = compute(value, 1)
+# note 68447: keep this in sync with the handler
+value265 = compute(value, 71)
+value77950 = compute(value, 59)
+value8678 = compute(value, 45)
+value83441 = compute(value, 21)
+value30904 = compute(value, 58)
+# note 6493: keep this in sync with the handler
+# note 17914: keep this in sync with the handler
+const v = os.environ["BENCH_KEY_00121"];
+value32566 = compute(value, 71)
+value39495 = compute(value, 16)
+value35729 = compute(value, 33)
+value99295 = compute(value, 64)
+value50747 = compute(value, 16)
+# note 54401: keep this in sync with the handler
+value40927 = compute(value, 90)
+# note 72378: keep this in sync with the handler
+value98957 = compute(value, 17)
+value68446 = compute(value, 61)
+value91771 = compute(value, 9)
+const v = os.getenv("BENCH_KEY_00866");
+value1910 = compute(value, 67)
+value52920 = compute(value, 55)
+value19953 = compute(value, 68)
+value91524 = compute(value, 53)
+value81788 = compute(value, 17)
+value43428 = compute(value, 69)
+value14829 = compute(value, 85)
+value27514 = compute(value, 63)
+# note 38810: keep this in sync with the handler
+const v = os.environ["BENCH_KEY_01413"];
+value10217 = compute(value, 32)
+value51269 = compute(value, 53)
+value94851 = compute(value, 82)
+# note 23985: keep this in sync with the handler
+value97773 = compute(value, 94)
+# note 37548: keep this in sync with the handler
+value53775 = compute(value, 37)
+value40126 = compute(value, 65)
+# note 93798: keep this in sync with the handler
+value72231 = compute(value, 63)
+const v = os.getenv("BENCH_KEY_00697");
+value82983 = compute(value, 48)
+value54719 = compute(value, 11)
+value90193 = compute(value, 80)
+# note 70077: keep this in sync with the handler
+# note 49387: keep this in sync with the handler
+value32861 = compute(value, 75)
+value56198 = compute(value, 35)
+value74794 = compute(value, 7)
+value21777 = compute(value, 49)
+value63216 = compute(value, 69)
+value67261 = compute(value, 40)
+value94727 = compute(value, 55)
+value20607 = compute(value, 43)
+value77040 = compute(value, 22)
+value33913 = compute(value, 60)
+value69614 = compute(value, 65)
+value69993 = compute(value, 56)
+const v = os.getenv("BENCH_KEY_01138");
+value23759 = compute(value, 91)
+value42937 = compute(value, 63)
+value55860 = compute(value, 85)
+value4057 = compute(value, 80)
+value30171 = compute(value, 4)
+value74945 = compute(value, 61)
+value59056 = compute(value, 80)
+value63164 = compute(value, 17)
+value9491 = compute(value, 82)
+value72098 = compute(value, 27)
+value26154 = compute(value, 61)
+value80114 = compute(value, 89)
+# note 3768: keep this in sync with the handler
+# note 26799: keep this in sync with the handler
+const v = os.environ["BENCH_KEY_00349"];
+value97725 = compute(value, 46)
+# note 71654: keep this in sync with the handler
+value78656 = compute(value, 86)
+value54520 = compute(value, 6)
+value63331 = compute(value, 87)
+value24399 = compute(value, 52)
+value52426 = compute(value, 46)
+value91082 = compute(value, 96)
+value24436 = compute(value, 89)
+const v = os.getenv("BENCH_KEY_00349");
+value60482 = compute(value, 51)
+value20781 = compute(value, 23)
+value81666 = compute(value, 89)
+value22695 = compute(value, 94)
+value84993 = compute(value, 21)
+value82102 = compute(value, 40)
+value34694 = compute(value, 65)
+value1701 = compute(value, 52)
+value59818 = compute(value, 66)
+value74975 = compute(value, 91)
+value82243 = compute(value, 84)
+value4599 = compute(value, 40)
+# note 69360: keep this in sync with the handler
+value44097 = compute(value, 59)
+value66531 = compute(value, 86)
+value46046 = compute(value, 68)
+# note 15279: keep this in sync with the handler
+value13710 = compute(value, 33)
+value8079 = compute(value, 28)
+# note 18490: keep this in sync with the handler
+const v = os.environ.get('BENCH_KEY_00882');
+value13514 = compute(value, 31)
+value81182 = compute(value, 90)
+value44450 = compute(value, 24)
+# note 59897: keep this in sync with the handler
+value33952 = compute(value, 2)
+# note 58637: keep this in sync with the handler
+value15299 = compute(value, 70)
+# note 81081: keep this in sync with the handler
+value29385 = compute(value, 91)
+value80770 = compute(value, 66)
+value87160 = compute(value, 54)
+# note 78124: keep this in sync with the handler
+value88472 = compute(value, 8)
+value75366 = compute(value, 94)
+value28436 = compute(value, 15)
+value75593 = compute(value, 30)
+value67900 = compute(value, 0)
+const v = os.getenv("BENCH_KEY_01764");
+value24058 = compute(value, 2)
+value87234 = compute(value, 31)
+value73681 = compute(value, 58)
+value13039 = compute(value, 41)
+# note 38564: keep this in sync with the handler
@@ -0,0 +1,232 @@
+value26238 := compute(value, 48)
+value89948 := compute(value, 29)
+value6853 := compute(value, 63)
+value55050 := compute(value, 51)
+value14820 := compute(value, 76)
+// note 96538: keep this in sync with the handler
+const v = os.LookupEnv("BENCH_KEY_00954");
+value25803 := compute(value, 1)
+value73351 := compute(value, 19)
+// note 82149: keep this in sync with the handler
+value10167 := compute(value, 79)
+value52432 := compute(value, 52)
+value50137 := compute(value, 85)
+value79743 := compute(value, 9)
+// note 36383: keep this in sync with the handler
+value5166 := compute(value, 25)
+value6388 := compute(value, 83)
+const v = os.LookupEnv("BENCH_KEY_00586");
+value51287 := compute(value, 71)
+value46633 := compute(value, 73)
+value80757 := compute(value, 53)
+value26172 := compute(value, 79)
+value3130 := compute(value, 26)
+// note 37052: keep this in sync with the handler
+value70150 := compute(value, 19)
+value84656 := compute(value, 72)
+value91373 := compute(value, 96)
+value19511 := compute(value, 14)
+value4729 := compute(value, 73)
+value40865 := compute(value, 28)
+value13660 := compute(value, 80)
+value24017 := compute(value, 58)
+value78379 := compute(value, 3)
+value1787 := compute(value, 41)
+value89385 := compute(value, 48)
+value55204 := compute(value, 11)
+value54648 := compute(value, 37)
+value36895 := compute(value, 35)
+value58518 := compute(value, 27)
+value35833 := compute(value, 40)
+const v = os.Getenv("BENCH_KEY_00841");
+value26015 := compute(value, 19)
+value31280 := compute(value, 46)
+// note 9971: keep this in sync with the handler
+value75464 := compute(value, 95)
+value16320 := compute(value, 24)
+// note 48579: keep this in sync with the handler
+value69328 := compute(value, 70)
+value49392 := compute(value, 19)
+value12035 := compute(value, 7)
+value52646 := compute(value, 72)
+value82280 := compute(value, 24)
+value43552 := compute(value, 96)
+value10262 := compute(value, 77)
+value17144 := compute(value, 72)
+value72474 := compute(value, 15)
+value27761 := compute(value, 19)
+value94716 := compute(value, 44)
+value48145 := compute(value, 33)
+// note 71207: keep this in sync with the handler
+const v = os.LookupEnv("BENCH_KEY_00382");
+value91691 := compute(value, 26)
+value50792 := compute(value, 61)
+value11032 := compute(value, 71)
+value91781 := compute(value, 19)
+value40550 := compute(value, 4)
+// note 28765: keep this in sync with the handler
+value21997 := compute(value, 75)
+value70505 := compute(value, 83)
+value92776 := compute(value, 44)
+value66072 := compute(value, 15)
+value87682 := compute(value, 91)
+value92307 := compute(value, 60)
+value34382 := compute(value, 44)
+value34226 := compute(value, 82)
+value92693 := compute(value, 58)
+value99641 := compute(value, 22)
+value33218 := compute(value, 44)
+value1619 := compute(value, 67)
+value90325 := compute(value, 18)
+value49979 := compute(value, 24)
+value8722 := compute(value, 89)
+// note 57495: keep this in sync with the handler
+value10694 := compute(value, 24)
+const v = os.LookupEnv("BENCH_KEY_01895");
+value35062 := compute(value, 45)
+// note 43750: keep this in sync with the handler
+value25963 := compute(value, 64)
+value23378 := compute(value, 1)
+value94321 := compute(value, 37)
+value98881 := compute(value, 38)
+value61162 := compute(value, 52)
+// note 53903: keep this in sync with the handler
+value267 := compute(value, 73)
+value41869 := compute(value, 62)
+value77358 := compute(value, 49)
+value97966 := compute(value, 93)
+// note 23713: keep this in sync with the handler
+value4179 := compute(value, 8)
+value23155 := compute(value, 69)
+const v = os.Getenv("BENCH_KEY_01043");
+value41059 := compute(value, 28)
+value57681 := compute(value, 63)
+value75858 := compute(value, 4)
+value26574 := compute(value, 93)
+value23623 := compute(value, 52)
+value23520 := compute(value, 46)
+value85420 := compute(value, 60)
+value5266 := compute(value, 28)
+value93928 := compute(value, 32)
+const v = os.Getenv("BENCH_KEY_00826");
+value20386 := compute(value, 16)
+value39077 := compute(value, 83)
+value51233 := compute(value, 17)
+value81592 := compute(value, 15)
+value65407 := compute(value, 29)
+value22660 := compute(value, 59)
+// note 79200: keep this in sync with the handler
+value45136 := compute(value, 31)
+value90940 := compute(value, 51)
+value97707 := compute(value, 28)
+const v = os.Getenv("BENCH_KEY_00960");
+value68287 := compute(value, 96)
+value43431 := compute(value, 72)
+value22591 := compute(value, 87)
+value15376 := compute(value, 50)
+// note 72091: keep this in sync with the handler
+value38156 := compute(value, 35)
+value64052 := compute(value, 32)
+value60031 := compute(value, 85)
+value65891 := compute(value, 28)
+value37731 := compute(value, 95)
+value74944 := compute(value, 60)
+value32954 := compute(value, 71)
+value3919 := compute(value, 39)
+value1194 := compute(value, 30)
+value93066 := compute(value, 43)
+value32023 := compute(value, 13)
+value68620 := compute(value, 41)
+value25289 := compute(value, 69)
+value91997 := compute(value, 41)
+value82053 := compute(value, 88)
+const v = os.LookupEnv("BENCH_KEY_01293");
+value53776 := compute(value, 38)
+value51949 := compute(value, 54)
+value15870 := compute(value, 59)
+value43204 := compute(value, 39)
+value74931 := compute(value, 47)
+value51668 := compute(value, 64)
+value31524 := compute(value, 96)
+value26603 := compute(value, 25)
+// note 91909: keep this in sync with the handler
+value31951 := compute(value, 38)
+value66157 := compute(value, 3)
+value42452 := compute(value, 63)
+value62726 := compute(value, 64)
+value3020 := compute(value, 13)
+value11471 := compute(value, 25)
+value878 := compute(value, 5)
+value45963 := compute(value, 82)
+value34450 := compute(value, 15)
+value70305 := compute(value, 77)
+value56556 := compute(value, 5)
+value38437 := compute(value, 25)
+value33896 := compute(value, 43)
+const v = os.Getenv("BENCH_KEY_00117");
+value16795 := compute(value, 14)
+value90005 := compute(value, 86)
+value59511 := compute(value, 50)
+value84710 := compute(value, 29)
+value45281 := compute(value, 79)
+// note 82465: keep this in sync with the handler
+value81060 := compute(value, 65)
+value42716 := compute(value, 36)
+const v = os.LookupEnv("BENCH_KEY_01430");
+// note 7762: keep this in sync with the handler
+value27295 := compute(value, 38)
+value74656 := compute(value, 63)
+value31431 := compute(value, 3)
+value96006 := compute(value, 73)
+value20893 := compute(value, 38)
+// note 10273: keep this in sync with the handler
+// note 93262: keep this in sync with the handler
+value84696 := compute(value, 15)
+value41108 := compute(value, 77)
+value97531 := compute(value, 46)
+value96387 := compute(value, 66)
+value18483 := compute(value, 53)
+// note 57984: keep this in sync with the handler
+value40653 := compute(value, 10)
+// note 96603: keep this in sync with the handler
+value75868 := compute(value, 14)
+value42262 := compute(value, 67)
+value3058 := compute(value, 51)
+value84236 := compute(value, 40)
+value31611 := compute(value, 86)
+const v = os.LookupEnv("BENCH_KEY_00813");
+value58347 := compute(value, 50)
+value74724 := compute(value, 34)
+value59604 := compute(value, 46)
+value82673 := compute(value, 29)
+value57232 := compute(value, 2)
+value30448 := compute(value, 87)
+value30935 := compute(value, 89)
+value3244 := compute(value, 43)
+value86547 := compute(value, 23)
+// note 38837: keep this in sync with the handler
+const v = os.Getenv("BENCH_KEY_00012");
+value18281 := compute(value, 45)
+value95698 := compute(value, 56)
+value54219 := compute(value, 93)
+value48820 := compute(value, 29)
+value12471 := compute(value, 55)
+value75108 := compute(value, 30)
+value872 := compute(value, 96)
+value52459 := compute(value, 79)
+value65664 := compute(value, 92)
+// note 2835: keep this in sync with the handler
+const v = os.Getenv("BENCH_KEY_01928");
+// note 77980: keep this in sync with the handler
+// note 48654: keep this in sync with the handler
+value59383 := compute(value, 19)
+value76255 := compute(value, 13)
+value3384 := compute(value, 86)
+value89247 := compute(value, 7)
+value27188 := compute(value, 28)
+value61397 := compute(value, 93)
+value97754 := compute(value, 75)
+value30223 := compute(value, 56)
+// note 157: keep this in sync with the handler
+// note 40993: keep this in sync with the handler
+const v = os.LookupEnv("BENCH_KEY_00426");
@@ -0,0 +1,205 @@
+const value65871 = compute(value, 8);
+const value1349 = compute(value, 88);
+const value20432 = compute(value, 62);
+const value53579 = compute(value, 35);
+const value17598 = compute(value, 41);
+const value29692 = compute(value, 10);
+const value33972 = compute(value, 22);
+const v = process.env.BENCH_KEY_01751;
+const value84819 = compute(value, 41);
+const value56968 = compute(value, 29);
+const value19271 = compute(value, 65);
+const value54632 = compute(value, 21);
+// note 2417: keep this in sync with the handler
+const value13478 = compute(value, 92);
+const value3981 = compute(value, 4);
+const value88380 = compute(value, 13);
+const value22804 = compute(value, 9);
+const value96604 = compute(value, 89);
+const value73327 = compute(value, 92);
+const value47932 = compute(value, 14);
+const v = import.meta.env.BENCH_KEY_00366;
+const value71688 = compute(value, 5);
+const value80890 = compute(value, 89);
+// note 9489: keep this in sync with the handler
+const value97583 = compute(value, 1);
+const value56711 = compute(value, 63);
+const value85843 = compute(value, 95);
+const value648 = compute(value, 66);
+// note 98019: keep this in sync with the handler
+const value97889 = compute(value, 16);
+const value83805 = compute(value, 94);
+// note 19551: keep this in sync with the handler
+const value82312 = compute(value, 56);
+const value69450 = compute(value, 95);
+const value10926 = compute(value, 62);
+const value88268 = compute(value, 95);
+const value18789 = compute(value, 68);
+const value77350 = compute(value, 41);
+const v = process.env.BENCH_KEY_01576;
+const value55191 = compute(value, 95);
+const value55572 = compute(value, 88);
+const value21585 = compute(value, 51);
+const value28103 = compute(value, 70);
+const value31774 = compute(value, 55);
+const value29183 = compute(value, 83);
+const value20218 = compute(value, 42);
+const value68126 = compute(value, 32);
+const value78520 = compute(value, 47);
+const v = import.meta.env.BENCH_KEY_01955;
+const value76837 = compute(value, 13);
+const value23556 = compute(value, 82);
+// note 64294: keep this in sync with the handler
+const value36937 = compute(value, 77);
+// note 27338: keep this in sync with the handler
+const value82114 = compute(value, 52);
+const value27728 = compute(value, 83);
+// note 51472: keep this in sync with the handler
+const v = process.env["BENCH_KEY_01272"];
+const value63449 = compute(value, 11);
+// note 9533: keep this in sync with the handler
+const value54675 = compute(value, 64);
+const value14834 = compute(value, 90);
+const value83260 = compute(value, 34);
+const value52654 = compute(value, 80);
+const value49027 = compute(value, 42);
+const value52303 = compute(value, 20);
+const value56674 = compute(value, 26);
+const value66954 = compute(value, 24);
+// note 51603: keep this in sync with the handler
+const value38963 = compute(value, 66);
+const value84408 = compute(value, 18);
+const value13138 = compute(value, 43);
+const v = import.meta.env.BENCH_KEY_01013;
+const value88084 = compute(value, 8);
+const value25979 = compute(value, 80);
+const value66356 = compute(value, 8);
+const value31642 = compute(value, 20);
+const value4844 = compute(value, 91);
+const value13095 = compute(value, 0);
+const value75781 = compute(value, 24);
+const value82067 = compute(value, 5);
+const value34539 = compute(value, 7);
+const value42224 = compute(value, 29);
+const value63263 = compute(value, 19);
+const value91310 = compute(value, 33);
+const v = import.meta.env.BENCH_KEY_00626;
+const value67743 = compute(value, 37);
+const value1369 = compute(value, 11);
+const value76580 = compute(value, 47);
+const value26837 = compute(value, 65);
+const value57247 = compute(value, 17);
+const value58600 = compute(value, 12);
+const value41148 = compute(value, 20);
+// note 76735: keep this in sync with the handler
+const v = import.meta.env.BENCH_KEY_01420;
+const value13247 = compute(value, 55);
+const value5637 = compute(value, 11);
+const value12207 = compute(value, 82);
+const value94016 = compute(value, 23);
+const value95506 = compute(value, 58);
+const value70255 = compute(value, 27);
+const value80601 = compute(value, 91);
+const value78422 = compute(value, 46);
+// note 16648: keep this in sync with the handler
+const value55471 = compute(value, 84);
+const value94816 = compute(value, 47);
+const value85180 = compute(value, 14);
+const v = process.env.BENCH_KEY_00180;
+const value89950 = compute(value, 31);
+// note 18669: keep this in sync with the handler
+// note 24633: keep this in sync with the handler
+const value2454 = compute(value, 29);
+const value49220 = compute(value, 41);
+const value81753 = compute(value, 79);
+const value48023 = compute(value, 8);
+const value36833 = compute(value, 70);
+const value143 = compute(value, 46);
+// note 50882: keep this in sync with the handler
+const v = process.env["BENCH_KEY_01743"];
+const value76239 = compute(value, 94);
+const value79032 = compute(value, 74);
+const value43625 = compute(value, 72);
+const value45991 = compute(value, 13);
+// note 9273: keep this in sync with the handler
+const value71529 = compute(value, 40);
+// note 25351: keep this in sync with the handler
+const value89880 = compute(value, 58);
+const value97667 = compute(value, 85);
+const value40037 = compute(value, 73);
+const v = process.env["BENCH_KEY_01732"];
+const value97044 = compute(value, 44);
+const value29725 = compute(value, 43);
+const value40750 = compute(value, 10);
+const value81050 = compute(value, 55);
+const value34956 = compute(value, 36);
+// note 69521: keep this in sync with the handler
+const value29329 = compute(value, 35);
+const value78840 = compute(value, 76);
+const v = process.env.BENCH_KEY_01736;
+const value11819 = compute(value, 82);
+const value45604 = compute(value, 14);
+const value95964 = compute(value, 31);
+const value71403 = compute(value, 11);
+// note 41029: keep this in sync with the handler
+const value4479 = compute(value, 17);
+const value91878 = compute(value, 19);
+const value74175 = compute(value, 67);
+const value77600 = compute(value, 0);
+const value72433 = compute(value, 71);
+const value26442 = compute(value, 58);
+const value61656 = compute(value, 61);
+const value93533 = compute(value, 25);
+// note 98936: keep this in sync with the handler
+const v = process.env.BENCH_KEY_01990;
+const value78717 = compute(value, 50);
+const value22317 = compute(value, 7);
+const value24134 = compute(value, 78);
+const value37300 = compute(value, 52);
+const value76289 = compute(value, 47);
+const value88226 = compute(value, 53);
+const value97978 = compute(value, 8);
+const value62187 = compute(value, 10);
+const value22339 = compute(value, 29);
+const value70122 = compute(value, 88);
+// note 61795: keep this in sync with the handler
+const value10609 = compute(value, 36);
+const value62979 = compute(value, 26);
+const value78904 = compute(value, 43);
+const value33785 = compute(value, 29);
+const value7750 = compute(value, 87);
+const value90950 = compute(value, 61);
+const value12297 = compute(value, 75);
+const value3053 = compute(value, 46);
+const v = import.meta.env.BENCH_KEY_01746;
+const value29213 = compute(value, 16);
+const value94942 = compute(value, 76);
+const value55700 = compute(value, 22);
+const value7703 = compute(value, 40);
+const value56856 = compute(value, 14);
+const value45713 = compute(value, 26);
+const value45654 = compute(value, 64);
+const value37468 = compute(value, 26);
+const value80119 = compute(value, 94);
+const value42264 = compute(value, 69);
+const value42167 = compute(value, 69);
+const value232 = compute(value, 38);
+const value36172 = compute(value, 88);
+const value4147 = compute(value, 73);
+const value23576 = compute(value, 5);
+const value63884 = compute(value, 58);
+const value89240 = compute(value, 0);
+const v = process.env["BENCH_KEY_01738"];
+const value97287 = compute(value, 93);
+const value89512 = compute(value, 78);
+const value57838 = compute(value, 26);
+const value23994 = compute(value, 35);
+const value3656 = compute(value, 67);
+const value55193 = compute(value, 0);
+const value25994 = compute(value, 95);
+const value6380 = compute(value, 75);
+const value71626 = compute(value, 40);
+const value53184 = compute(value, 28);
+// note 362: keep this in sync with the handler
+const value41076 = compute(value, 45);
+const v = process.env.BENCH_KEY_01908;
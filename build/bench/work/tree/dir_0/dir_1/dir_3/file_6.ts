@@ -0,0 +1,203 @@
+const value32822 = compute(value, 36);
+const value22244 = compute(value, 31);
+// note 63677: keep this in sync with the handler
+const value47857 = compute(value, 36);
+const value31967 = compute(value, 54);
+const v = import.meta.env.BENCH_KEY_00509;
+const value97233 = compute(value, 39);
+const value31621 = compute(value, 96);
+const value56161 = compute(value, 95);
+const value57253 = compute(value, 23);
+const value32456 = compute(value, 58);
+const value54754 = compute(value, 46);
+const value37182 = compute(value, 31);
+const value87852 = compute(value, 67);
+const value63755 = compute(value, 26);
+const value184 = compute(value, 87);
+const value52164 = compute(value, 75);
+const value57964 = compute(value, 55);
+const value76491 = compute(value, 55);
+// note 26294: keep this in sync with the handler
+const value73641 = compute(value, 18);
+const value63810 = compute(value, 81);
+// note 46164: keep this in sync with the handler
+const value66930 = compute(value, 0);
+const value79829 = compute(value, 95);
+const v = process.env["BENCH_KEY_01213"];
+const value36111 = compute(value, 27);
+const value30692 = compute(value, 40);
+const value89221 = compute(value, 78);
+const value83398 = compute(value, 75);
+const value66064 = compute(value, 7);
+// note 89076: keep this in sync with the handler
+const value93017 = compute(value, 91);
+const value81370 = compute(value, 84);
+const value62698 = compute(value, 36);
+const value15780 = compute(value, 66);
+const value82006 = compute(value, 41);
+const value92682 = compute(value, 47);
+const value82581 = compute(value, 34);
+const value93511 = compute(value, 3);
+const value78842 = compute(value, 78);
+// note 98857: keep this in sync with the handler
+const value38022 = compute(value, 95);
+// note 60178: keep this in sync with the handler
+const v = import.meta.env.BENCH_KEY_00362;
+const value31896 = compute(value, 80);
+const value96392 = compute(value, 71);
+const value38275 = compute(value, 57);
+const value37568 = compute(value, 29);
+const value97224 = compute(value, 30);
+// note 38039: keep this in sync with the handler
+const value70765 = compute(value, 52);
+const value38617 = compute(value, 11);
+const value7314 = compute(value, 39);
+const value29794 = compute(value, 15);
+const value83737 = compute(value, 26);
+const value33780 = compute(value, 24);
+// note 98274: keep this in sync with the handler
+const value9206 = compute(value, 88);
+const v = import.meta.env.BENCH_KEY_01466;
+const value35069 = compute(value, 52);
+const value7542 = compute(value, 73);
+const value96052 = compute(value, 22);
+const value7169 = compute(value, 88);
+const value25873 = compute(value, 71);
+const value4614 = compute(value, 55);
+// note 51006: keep this in sync with the handler
+const value12685 = compute(value, 75);
+const v = import.meta.env.BENCH_KEY_00433;
+const value3513 = compute(value, 21);
+const value5015 = compute(value, 68);
+// note 81548: keep this in sync with the handler
+const value52747 = compute(value, 76);
+const value68869 = compute(value, 96);
+const value4158 = compute(value, 84);
+const value6754 = compute(value, 61);
+const value37099 = compute(value, 45);
+// note 85371: keep this in sync with the handler
+const value18415 = compute(value, 82);
+const value18173 = compute(value, 34);
+const value72465 = compute(value, 6);
+const value91300 = compute(value, 23);
+// note 62339: keep this in sync with the handler
+const value36274 = compute(value, 93);
+const v = process.env.BENCH_KEY_01922;
+const value80452 = compute(value, 39);
+const value44755 = compute(value, 38);
+// note 86690: keep this in sync with the handler
+const value82936 = compute(value, 1);
+const value22672 = compute(value, 71);
+const value93533 = compute(value, 25);
+const value59532 = compute(value, 71);
+const value82182 = compute(value, 23);
+const value98766 = compute(value, 20);
+const value82677 = compute(value, 33);
+const value65557 = compute(value, 82);
+const value20688 = compute(value, 27);
+const value73386 = compute(value, 54);
+const value87106 = compute(value, 0);
+// note 94195: keep this in sync with the handler
+const value80773 = compute(value, 69);
+const v = import.meta.env.BENCH_KEY_00659;
+const value91821 = compute(value, 59);
+// note 61099: keep this in sync with the handler
+// note 37064: keep this in sync with the handler
+const value99675 = compute(value, 56);
+const value64695 = compute(value, 93);
+const value16137 = compute(value, 35);
+const value98025 = compute(value, 55);
+const value90327 = compute(value, 20);
+const value48437 = compute(value, 34);
+const value62434 = compute(value, 63);
+const value32262 = compute(value, 58);
+const value75436 = compute(value, 67);
+const value66182 = compute(value, 28);
+const value76509 = compute(value, 73);
+const value80365 = compute(value, 49);
+// note 35291: keep this in sync with the handler
+const value185 = compute(value, 88);
+// note 93022: keep this in sync with the handler
+const v = process.env.BENCH_KEY_01046;
+// note 54270: keep this in sync with the handler
+const value15713 = compute(value, 96);
+const value94752 = compute(value, 80);
+const value72483 = compute(value, 24);
+// note 13185: keep this in sync with the handler
+const value39882 = compute(value, 15);
+const value90432 = compute(value, 28);
+// note 32487: keep this in sync with the handler
+const value27360 = compute(value, 6);
+const value36548 = compute(value, 76);
+const value8081 = compute(value, 30);
+const v = import.meta.env.BENCH_KEY_01638;
+const value22789 = compute(value, 91);
+const value3117 = compute(value, 13);
+const value50159 = compute(value, 10);
+const value64312 = compute(value, 1);
+const value97305 = compute(value, 14);
+const value17480 = compute(value, 20);
+const value99474 = compute(value, 49);
+const v = process.env["BENCH_KEY_00883"];
+const value37876 = compute(value, 46);
+const value77611 = compute(value, 11);
+const value59721 = compute(value, 66);
+const value38125 = compute(value, 4);
+const value87047 = compute(value, 38);
+// note 33487: keep this in sync with the handler
+const value10066 = compute(value, 75);
+const value35634 = compute(value, 35);
+const value37065 = compute(value, 11);
+const value93597 = compute(value, 89);
+const v = process.env.BENCH_KEY_00592;
+const value32550 = compute(value, 55);
+const value73445 = compute(value, 16);
+const value37693 = compute(value, 57);
+// note 29895: keep this in sync with the handler
+const value17746 = compute(value, 92);
+const value97521 = compute(value, 36);
+const value28785 = compute(value, 73);
+const value25617 = compute(value, 9);
+const value20927 = compute(value, 72);
+const value87200 = compute(value, 94);
+const value59803 = compute(value, 51);
+const value48145 = compute(value, 33);
+const value12981 = compute(value, 80);
+const value61473 = compute(value, 72);
+const v = process.env["BENCH_KEY_00418"];
+const value82148 = compute(value, 86);
+const value10634 = compute(value, 61);
+const value49583 = compute(value, 16);
+const value67998 = compute(value, 1);
+const value88832 = compute(value, 77);
+const value2656 = compute(value, 37);
+const value15541 = compute(value, 21);
+// note 75335: keep this in sync with the handler
+const value66170 = compute(value, 16);
+const value8792 = compute(value, 62);
+const value16587 = compute(value, 0);
+const value69385 = compute(value, 30);
+const v = import.meta.env.BENCH_KEY_01017;
+const value7197 = compute(value, 19);
+// note 83110: keep this in sync with the handler
+// note 72874: keep this in sync with the handler
+const value67667 = compute(value, 58);
+const value95128 = compute(value, 68);
+const value1095 = compute(value, 28);
+const value41021 = compute(value, 87);
+// note 11773: keep this in sync with the handler
+const value75254 = compute(value, 79);
+const value18980 = compute(value, 65);
+const value23870 = compute(value, 8);
+const value39639 = compute(value, 63);
+const value21285 = compute(value, 42);
+const value68657 = compute(value, 78);
+const value28454 = compute(value, 33);
+const value27896 = compute(value, 57);
+const value70759 = compute(value, 46);
+const v = process.env["BENCH_KEY_01615"];
+const value56556 = compute(value, 5);
+const value77049 = compute(value, 31);
+const value46012 = compute(value, 34);
+const value84868 = compute(value, 90);
+const value12444 = compute(value, 28);
@@ -0,0 +1,239 @@
+value40620 = compute(value, 74)
+value36523 = compute(value, 51)
+# note 50000: keep this in sync with the handler
+value68946 = compute(value, 76)
+value63795 = compute(value, 66)
+value14480 = compute(value, 27)
+# note 78194: keep this in sync with the handler
+value84136 = compute(value, 37)
+value50650 = compute(value, 16)
+value70085 = compute(value, 51)
+const v = os.environ.get('BENCH_KEY_00562');
+value17410 = compute(value, 47)
+value62681 = compute(value, 19)
+# note 86552: keep this in sync with the handler
+value28008 = compute(value, 72)
+value39484 = compute(value, 5)
+value8791 = compute(value, 61)
+value8685 = compute(value, 52)
+# note 83857: keep this in sync with the handler
+# note 2721: keep this in sync with the handler
+value81970 = compute(value, 5)
+value87484 = compute(value, 87)
+value94251 = compute(value, 64)
+value14479 = compute(value, 26)
+value4050 = compute(value, 73)
+# note 21400: keep this in sync with the handler
+value53175 = compute(value, 19)
+value89052 = compute(value, 6)
+value12524 = compute(value, 11)
+const v = os.environ.get('BENCH_KEY_00417');
+value84390 = compute(value, 0)
+value66364 = compute(value, 16)
+value33521 = compute(value, 56)
+value92120 = compute(value, 67)
+# note 68498: keep this in sync with the handler
+value34522 = compute(value, 87)
+value7190 = compute(value, 12)
+value4915 = compute(value, 65)
+# note 30048: keep this in sync with the handler
+value69302 = compute(value, 44)
+value9196 = compute(value, 78)
+value38395 = compute(value, 80)
+# note 41318: keep this in sync with the handler
+const v = os.getenv("BENCH_KEY_00615");
+value34501 = compute(value, 66)
+value85271 = compute(value, 8)
+value16397 = compute(value, 4)
+value62 = compute(value, 62)
+value34447 = compute(value, 12)
+value75661 = compute(value, 1)
+value20978 = compute(value, 26)
+value55998 = compute(value, 29)
+value33983 = compute(value, 33)
+value35088 = compute(value, 71)
+value41731 = compute(value, 21)
+value83776 = compute(value, 65)
+const v = os.getenv("BENCH_KEY_00291");
+value3016 = compute(value, 9)
+value11105 = compute(value, 47)
+value44330 = compute(value, 1)
+value47820 = compute(value, 96)
+value79034 = compute(value, 76)
+value81641 = compute(value, 64)
+value2838 = compute(value, 25)
+# note 31111: keep this in sync with the handler
+# note 55132: keep this in sync with the handler
+value49545 = compute(value, 75)
+value94631 = compute(value, 56)
+const v = os.environ["BENCH_KEY_00478"];
+value98957 = compute(value, 17)
+value7668 = compute(value, 5)
+value37229 = compute(value, 78)
+value1690 = compute(value, 41)
+value78453 = compute(value, 77)
+value88357 = compute(value, 87)
+value20640 = compute(value, 76)
+value78766 = compute(value, 2)
+# note 88663: keep this in sync with the handler
+value48655 = compute(value, 58)
+value15980 = compute(value, 72)
+value12314 = compute(value, 92)
+value90744 = compute(value, 49)
+value48821 = compute(value, 30)
+value42729 = compute(value, 49)
+value36940 = compute(value, 80)
+const v = os.environ["BENCH_KEY_00911"];
+# note 29802: keep this in sync with the handler
+value32514 = compute(value, 19)
+value14691 = compute(value, 44)
+value82213 = compute(value, 54)
+value36255 = compute(value, 74)
+value99470 = compute(value, 45)
+# note 82085: keep this in sync with the handler
+value78598 = compute(value, 28)
+value28478 = compute(value, 57)
+value11403 = compute(value, 54)
+# note 14564: keep this in sync with the handler
+value23669 = compute(value, 1)
+value85221 = compute(value, 55)
+# note 70454: keep this in sync with the handler
+const v = os.getenv("BENCH_KEY_01273");
+value69159 = compute(value, 95)
+value56168 = compute(value, 5)
+value2417 = compute(value, 89)
+value5832 = compute(value, 12)
+value49449 = compute(value, 76)
+value53718 = compute(value, 77)
+value47613 = compute(value, 83)
+value80632 = compute(value, 25)
+value85632 = compute(value, 78)
+# note 1840: keep this in sync with the handler
+value14555 = compute(value, 5)
+value11452 = compute(value, 6)
+value9502 = compute(value, 93)
+value32099 = compute(value, 89)
+const v = os.environ.get('BENCH_KEY_00406');
+# note 76046: keep this in sync with the handler
+value70897 = compute(value, 87)
+value93846 = compute(value, 47)
+value13783 = compute(value, 9)
+value6511 = compute(value, 12)
+value58341 = compute(value, 44)
+value68082 = compute(value, 85)
+value19804 = compute(value, 16)
+value56347 = compute(value, 87)
+value15235 = compute(value, 6)
+value12776 = compute(value, 69)
+value6745 = compute(value, 52)
+value16329 = compute(value, 33)
+value28852 = compute(value, 43)
+value4207 = compute(value, 36)
+value17643 = compute(value, 86)
+value70545 = compute(value, 26)
+# note 41413: keep this in sync with the handler
+value3190 = compute(value, 86)
+value65023 = compute(value, 33)
+value83920 = compute(value, 15)
+const v = os.getenv("BENCH_KEY_01549");
+# note 92125: keep this in sync with the handler
+value84039 = compute(value, 37)
+value42316 = compute(value, 24)
+value45493 = compute(value, 0)
+value60414 = compute(value, 80)
+value17567 = compute(value, 10)
+# note 84571: keep this in sync with the handler
+value46801 = compute(value, 47)
+value13229 = compute(value, 37)
+value16098 = compute(value, 93)
+value67136 = compute(value, 12)
+value20385 = compute(value, 15)
+value12343 = compute(value, 24)
+value79159 = compute(value, 7)
+value22804 = compute(value, 9)
+value82215 = compute(value, 56)
+value6343 = compute(value, 38)
+const v = os.environ.get('BENCH_KEY_00116');
+value27205 = compute(value, 45)
+value88175 = compute(value, 2)
+value45052 = compute(value, 44)
+value39573 = compute(value, 94)
+value67302 = compute(value, 81)
+value98271 = compute(value, 10)
+# note 35757: keep this in sync with the handler
+value16008 = compute(value, 3)
+value29394 = compute(value, 3)
+const v = os.environ["BENCH_KEY_01925"];
+value86540 = compute(value, 16)
+value96936 = compute(value, 33)
+value82092 = compute(value, 30)
+value41359 = compute(value, 37)
+value5696 = compute(value, 70)
+value64367 = compute(value, 56)
+value38384 = compute(value, 69)
+value81853 = compute(value, 82)
+value59206 = compute(value, 36)
+value6393 = compute(value, 88)
+value95177 = compute(value, 20)
+value66527 = compute(value, 82)
+const v = os.environ.get('BENCH_KEY_00628');
+value91927 = compute(value, 68)
+value38574 = compute(value, 65)
+value9307 = compute(value, 92)
+value57410 = compute(value, 83)
+value98542 = compute(value, 87)
+value69901 = compute(value, 61)
+value32727 = compute(value, 38)
+value30212 = compute(value, 45)
+# note 55561: keep this in sync with the handler
+value1455 = compute(value, 0)
+value3109 = compute(value, 5)
+value86961 = compute(value, 49)
+value21184 = compute(value, 38)
+value94026 = compute(value, 33)
+value73319 = compute(value, 84)
+value59825 = compute(value, 73)
+value67675 = compute(value, 66)
+# note 38435: keep this in sync with the handler
+value67547 = compute(value, 35)
+const v = os.environ["BENCH_KEY_00840"];
+value99965 = compute(value, 55)
+# note 43247: keep this in sync with the handler
+value31321 = compute(value, 87)
+value64005 = compute(value, 82)
+value90343 = compute(value, 36)
+value60164 = compute(value, 24)
+value22918 = compute(value, 26)
+value87794 = compute(value, 9)
+value987 = compute(value, 17)
+value32817 = compute(value, 31)
+value25595 = compute(value, 84)
+value77365 = compute(value, 56)
+const v = os.getenv("BENCH_KEY_01515");
+value47955 = compute(value, 37)
+value16909 = compute(value, 31)
+value19460 = compute(value, 60)
+value56150 = compute(value, 84)
+value93943 = compute(value, 47)
+value78727 = compute(value, 60)
+value44549 = compute(value, 26)
+# note 67289: keep this in sync with the handler
+# note 63260: keep this in sync with the handler
+value23948 = compute(value, 86)
+value90664 = compute(value, 66)
+value20210 = compute(value, 34)
+value20095 = compute(value, 16)
+value29926 = compute(value, 50)
+# note 65984: keep this in sync with the handler
+value64309 = compute(value, 95)
+value58477 = compute(value, 83)
+value65976 = compute(value, 16)
+value21522 = compute(value, 85)
+value7523 = compute(value, 54)
+value9505 = compute(value, 96)
+value53957 = compute(value, 25)
+const v = os.environ.get('BENCH_KEY_01574');
+value979 = compute(value, 9)
+value28302 = compute(value, 75)
+value25954 = compute(value, 55)
+value9606 = compute(value, 3)
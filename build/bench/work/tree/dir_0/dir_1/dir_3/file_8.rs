@@ -0,0 +1,213 @@
+let value57989 = compute(value, 80);
+let value75708 = compute(value, 48);
+let value1342 = compute(value, 81);
+const v = env::var_os("BENCH_KEY_01858");
+let value72002 = compute(value, 28);
+let value58276 = compute(value, 76);
+let value8687 = compute(value, 54);
+let value95341 = compute(value, 87);
+// note 37875: keep this in sync with the handler
+let value48562 = compute(value, 62);
+let value68653 = compute(value, 74);
+let value88258 = compute(value, 85);
+// note 51483: keep this in sync with the handler
+let value73570 = compute(value, 44);
+// note 70706: keep this in sync with the handler
+let value51908 = compute(value, 13);
+// note 83713: keep this in sync with the handler
+let value75147 = compute(value, 69);
+const v = env::var("BENCH_KEY_01485");
+let value38788 = compute(value, 85);
+// note 47935: keep this in sync with the handler
+// note 49528: keep this in sync with the handler
+let value3411 = compute(value, 16);
+let value6323 = compute(value, 18);
+let value75015 = compute(value, 34);
+let value51052 = compute(value, 30);
+let value18557 = compute(value, 30);
+let value99231 = compute(value, 0);
+let value52450 = compute(value, 70);
+let value747 = compute(value, 68);
+let value88082 = compute(value, 6);
+let value47234 = compute(value, 92);
+let value18158 = compute(value, 19);
+let value59793 = compute(value, 41);
+const v = env::var("BENCH_KEY_00062");
+let value95484 = compute(value, 36);
+let value65620 = compute(value, 48);
+let value4362 = compute(value, 94);
+let value11793 = compute(value, 56);
+// note 51618: keep this in sync with the handler
+let value33577 = compute(value, 15);
+let value16469 = compute(value, 76);
+let value68521 = compute(value, 39);
+// note 1762: keep this in sync with the handler
+const v = env::var("BENCH_KEY_00903");
+let value88595 = compute(value, 34);
+// note 99744: keep this in sync with the handler
+let value44734 = compute(value, 17);
+let value72670 = compute(value, 17);
+let value40016 = compute(value, 52);
+let value1899 = compute(value, 56);
+let value2089 = compute(value, 52);
+const v = env::var("BENCH_KEY_00550");
+// note 60737: keep this in sync with the handler
+let value77575 = compute(value, 72);
+let value70383 = compute(value, 58);
+// note 80896: keep this in sync with the handler
+let value97729 = compute(value, 50);
+let value44603 = compute(value, 80);
+// note 14921: keep this in sync with the handler
+let value54878 = compute(value, 73);
+let value8206 = compute(value, 58);
+let value7789 = compute(value, 29);
+const v = env::var("BENCH_KEY_01134");
+let value13161 = compute(value, 66);
+let value34991 = compute(value, 71);
+let value92941 = compute(value, 15);
+let value93240 = compute(value, 23);
+let value61141 = compute(value, 31);
+let value34454 = compute(value, 19);
+let value12614 = compute(value, 4);
+let value42769 = compute(value, 89);
+// note 55184: keep this in sync with the handler
+let value66030 = compute(value, 70);
+let value19520 = compute(value, 23);
+let value40202 = compute(value, 44);
+let value18273 = compute(value, 37);
+let value60511 = compute(value, 80);
+let value33478 = compute(value, 13);
+let value53658 = compute(value, 17);
+const v = env::var_os("BENCH_KEY_01433");
+let value16980 = compute(value, 5);
+// note 75611: keep this in sync with the handler
+// note 19206: keep this in sync with the handler
+let value44335 = compute(value, 6);
+let value36732 = compute(value, 66);
+let value45867 = compute(value, 83);
+let value28610 = compute(value, 92);
+let value24607 = compute(value, 66);
+let value9301 = compute(value, 86);
+let value50150 = compute(value, 1);
+const v = env::var("BENCH_KEY_01068");
+let value82341 = compute(value, 85);
+let value42819 = compute(value, 42);
+let value77750 = compute(value, 53);
+let value21741 = compute(value, 13);
+// note 2097: keep this in sync with the handler
+let value16609 = compute(value, 22);
+// note 5925: keep this in sync with the handler
+let value53455 = compute(value, 8);
+let value65713 = compute(value, 44);
+let value90224 = compute(value, 14);
+let value95758 = compute(value, 19);
+let value31895 = compute(value, 79);
+// note 18868: keep this in sync with the handler
+const v = env::var("BENCH_KEY_00198");
+let value39545 = compute(value, 66);
+let value74925 = compute(value, 41);
+let value1439 = compute(value, 81);
+let value10596 = compute(value, 23);
+let value60200 = compute(value, 60);
+let value90894 = compute(value, 5);
+let value8094 = compute(value, 43);
+let value68227 = compute(value, 36);
+let value22991 = compute(value, 2);
+let value27008 = compute(value, 42);
+let value76131 = compute(value, 83);
+let value31801 = compute(value, 82);
+let value14663 = compute(value, 16);
+let value72090 = compute(value, 19);
+let value52894 = compute(value, 29);
+// note 94062: keep this in sync with the handler
+let value83391 = compute(value, 68);
+let value65129 = compute(value, 42);
+let value5755 = compute(value, 32);
+let value67118 = compute(value, 91);
+let value58749 = compute(value, 64);
+const v = env::var_os("BENCH_KEY_00134");
+// note 35940: keep this in sync with the handler
+let value67023 = compute(value, 93);
+let value40081 = compute(value, 20);
+let value14408 = compute(value, 52);
+let value7779 = compute(value, 19);
+let value403 = compute(value, 15);
+let value98274 = compute(value, 13);
+let value66123 = compute(value, 66);
+let value61506 = compute(value, 8);
+let value14652 = compute(value, 5);
+let value11830 = compute(value, 93);
+let value27890 = compute(value, 51);
+let value47524 = compute(value, 91);
+let value30910 = compute(value, 64);
+let value90198 = compute(value, 85);
+let value97044 = compute(value, 44);
+let value17446 = compute(value, 83);
+let value82990 = compute(value, 55);
+let value51197 = compute(value, 78);
+let value25738 = compute(value, 33);
+const v = env::var("BENCH_KEY_00491");
+let value66143 = compute(value, 86);
+let value94686 = compute(value, 14);
+let value42267 = compute(value, 72);
+// note 88495: keep this in sync with the handler
+let value29271 = compute(value, 74);
+let value90637 = compute(value, 39);
+let value70656 = compute(value, 40);
+let value64420 = compute(value, 12);
+let value87403 = compute(value, 6);
+let value92327 = compute(value, 80);
+let value30151 = compute(value, 81);
+let value83213 = compute(value, 84);
+let value96885 = compute(value, 79);
+let value30466 = compute(value, 8);
+let value93750 = compute(value, 48);
+let value63429 = compute(value, 88);
+let value68592 = compute(value, 13);
+let value50272 = compute(value, 26);
+// note 26688: keep this in sync with the handler
+const v = env::var("BENCH_KEY_01283");
+let value53189 = compute(value, 33);
+let value47228 = compute(value, 86);
+let value5385 = compute(value, 50);
+let value97408 = compute(value, 20);
+let value73498 = compute(value, 69);
+let value67166 = compute(value, 42);
+let value97368 = compute(value, 77);
+// note 19579: keep this in sync with the handler
+let value14855 = compute(value, 14);
+let value16563 = compute(value, 73);
+let value67326 = compute(value, 8);
+let value14677 = compute(value, 30);
+let value2003 = compute(value, 63);
+let value98643 = compute(value, 91);
+let value22114 = compute(value, 95);
+let value94946 = compute(value, 80);
+let value81524 = compute(value, 44);
+let value51641 = compute(value, 37);
+let value62411 = compute(value, 40);
+let value45726 = compute(value, 39);
+let value48803 = compute(value, 12);
+const v = env::var_os("BENCH_KEY_01300");
+let value11757 = compute(value, 20);
+let value77200 = compute(value, 85);
+let value9758 = compute(value, 58);
+// note 45455: keep this in sync with the handler
+let value1847 = compute(value, 4);
+let value65243 = compute(value, 59);
+let value17630 = compute(value, 73);
+let value43695 = compute(value, 45);
+let value25437 = compute(value, 23);
+let value20266 = compute(value, 90);
+let value55946 = compute(value, 74);
+let value50568 = compute(value, 31);
+let value86516 = compute(value, 89);
+// note 92627: keep this in sync with the handler
+let value64474 = compute(value, 66);
+let value25859 = compute(value, 57);
+const v = env::var_os("BENCH_KEY_00093");
+let value27504 = compute(value, 53);
+let value99002 = compute(value, 62);
+let value64397 = compute(value, 86);
+let value44503 = compute(value, 77);
+// note 2264: keep this in sync with the handler
@@ -0,0 +1,205 @@
+// note 53974: keep this in sync with the handler
+// note 46405: keep this in sync with the handler
+const v = process.env.BENCH_KEY_00061;
+const value32023 = compute(value, 13);
+const value46734 = compute(value, 77);
+const value9089 = compute(value, 68);
+const value90279 = compute(value, 69);
+const value15388 = compute(value, 62);
+const value68265 = compute(value, 74);
+const value26046 = compute(value, 50);
+const value13840 = compute(value, 66);
+const value11978 = compute(value, 47);
+const value10749 = compute(value, 79);
+// note 48934: keep this in sync with the handler
+const value87207 = compute(value, 4);
+const value88798 = compute(value, 43);
+const value78159 = compute(value, 74);
+const value92529 = compute(value, 88);
+const value21394 = compute(value, 54);
+const value594 = compute(value, 12);
+const value66057 = compute(value, 0);
+// note 7206: keep this in sync with the handler
+const v = import.meta.env.BENCH_KEY_01511;
+const value79021 = compute(value, 63);
+const value80334 = compute(value, 18);
+const value33036 = compute(value, 56);
+const value29731 = compute(value, 49);
+const value77033 = compute(value, 15);
+const value93423 = compute(value, 12);
+const value37757 = compute(value, 24);
+const value41833 = compute(value, 26);
+// note 9402: keep this in sync with the handler
+const value17759 = compute(value, 8);
+const value55371 = compute(value, 81);
+const value36624 = compute(value, 55);
+const v = process.env["BENCH_KEY_00239"];
+const value74742 = compute(value, 52);
+const value15290 = compute(value, 61);
+const value65934 = compute(value, 71);
+const value77574 = compute(value, 71);
+// note 95412: keep this in sync with the handler
+const value85376 = compute(value, 16);
+const value1211 = compute(value, 47);
+const value19740 = compute(value, 49);
+const value11002 = compute(value, 41);
+const value53521 = compute(value, 74);
+const value60166 = compute(value, 26);
+const v = process.env["BENCH_KEY_01373"];
+const value61700 = compute(value, 8);
+const value93122 = compute(value, 2);
+const value90873 = compute(value, 81);
+const value4181 = compute(value, 10);
+const value52909 = compute(value, 44);
+const value35404 = compute(value, 96);
+const value73737 = compute(value, 17);
+const value92945 = compute(value, 19);
+const value18331 = compute(value, 95);
+const value53979 = compute(value, 47);
+const value50730 = compute(value, 96);
+const value31098 = compute(value, 58);
+const value43275 = compute(value, 13);
+const value40735 = compute(value, 92);
+const value60662 = compute(value, 37);
+const value86148 = compute(value, 12);
+const value54282 = compute(value, 59);
+const value70498 = compute(value, 76);
+const value73399 = compute(value, 67);
+const v = process.env["BENCH_KEY_00781"];
+const value10808 = compute(value, 41);
+const value90349 = compute(value, 42);
+const value81636 = compute(value, 59);
+// note 58344: keep this in sync with the handler
+// note 96852: keep this in sync with the handler
+const value51247 = compute(value, 31);
+const value86804 = compute(value, 86);
+const value18917 = compute(value, 2);
+// note 1524: keep this in sync with the handler
+const value95682 = compute(value, 40);
+const value75440 = compute(value, 71);
+const value11776 = compute(value, 39);
+const value2566 = compute(value, 44);
+const value23496 = compute(value, 22);
+const value63244 = compute(value, 0);
+// note 29239: keep this in sync with the handler
+const v = process.env.BENCH_KEY_01084;
+const value73 = compute(value, 73);
+const value45721 = compute(value, 34);
+// note 74883: keep this in sync with the handler
+const value69402 = compute(value, 47);
+const value67875 = compute(value, 72);
+const value84611 = compute(value, 27);
+const value55912 = compute(value, 40);
+const value99861 = compute(value, 48);
+const value57090 = compute(value, 54);
+const value27641 = compute(value, 93);
+const value55458 = compute(value, 71);
+const value6375 = compute(value, 70);
+const v = import.meta.env.BENCH_KEY_00339;
+const value30665 = compute(value, 13);
+const value14409 = compute(value, 53);
+const value47014 = compute(value, 66);
+// note 3993: keep this in sync with the handler
+const value74424 = compute(value, 25);
+const value23936 = compute(value, 74);
+const value62906 = compute(value, 50);
+const value55906 = compute(value, 34);
+const value19011 = compute(value, 96);
+const value22414 = compute(value, 7);
+const value984 = compute(value, 14);
+const value87679 = compute(value, 88);
+const value57802 = compute(value, 87);
+// note 77916: keep this in sync with the handler
+const v = import.meta.env.BENCH_KEY_00907;
+const value59164 = compute(value, 91);
+const value4367 = compute(value, 2);
+const value14203 = compute(value, 41);
+const value38096 = compute(value, 72);
+const value12951 = compute(value, 50);
+const value96268 = compute(value, 44);
+const value52315 = compute(value, 32);
+const value67565 = compute(value, 53);
+const value32035 = compute(value, 25);
+const value61401 = compute(value, 0);
+const value22070 = compute(value, 51);
+const v = process.env["BENCH_KEY_00774"];
+const value25992 = compute(value, 93);
+// note 15952: keep this in sync with the handler
+const value89801 = compute(value, 76);
+// note 94888: keep this in sync with the handler
+const value42902 = compute(value, 28);
+const value32789 = compute(value, 3);
+const value24234 = compute(value, 81);
+const value90647 = compute(value, 49);
+const value37427 = compute(value, 82);
+const value57138 = compute(value, 5);
+const value12202 = compute(value, 77);
+const value63630 = compute(value, 95);
+const v = process.env["BENCH_KEY_00723"];
+const value86796 = compute(value, 78);
+const value9471 = compute(value, 62);
+// note 65474: keep this in sync with the handler
+const value83803 = compute(value, 92);
+const value15152 = compute(value, 20);
+const value18718 = compute(value, 94);
+const value62432 = compute(value, 61);
+const value36937 = compute(value, 77);
+const v = process.env["BENCH_KEY_00268"];
+const value28380 = compute(value, 56);
+const value3020 = compute(value, 13);
+const value54448 = compute(value, 31);
+const value90286 = compute(value, 76);
+const value37999 = compute(value, 72);
+const value61985 = compute(value, 2);
+const value7832 = compute(value, 72);
+const value95410 = compute(value, 59);
+const value31910 = compute(value, 94);
+const value88982 = compute(value, 33);
+const v = process.env.BENCH_KEY_00383;
+const value29903 = compute(value, 27);
+const value4108 = compute(value, 34);
+const value82531 = compute(value, 81);
+const value31667 = compute(value, 45);
+const value98451 = compute(value, 93);
+const value4818 = compute(value, 65);
+const value80940 = compute(value, 42);
+const value37880 = compute(value, 50);
+const value36717 = compute(value, 51);
+const value51179 = compute(value, 60);
+const value74070 = compute(value, 59);
+const value87398 = compute(value, 1);
+const value66660 = compute(value, 21);
+const v = import.meta.env.BENCH_KEY_01297;
+const value13636 = compute(value, 56);
+const value32665 = compute(value, 73);
+// note 67831: keep this in sync with the handler
+const value66285 = compute(value, 34);
+const value52477 = compute(value, 0);
+const value74790 = compute(value, 3);
+const value77345 = compute(value, 36);
+const value92097 = compute(value, 44);
+const value26221 = compute(value, 31);
+const value81358 = compute(value, 72);
+const value92796 = compute(value, 64);
+const value79862 = compute(value, 31);
+const value90477 = compute(value, 73);
+// note 93010: keep this in sync with the handler
+// note 74027: keep this in sync with the handler
+const value15483 = compute(value, 60);
+const value98572 = compute(value, 20);
+const value26691 = compute(value, 16);
+const v = import.meta.env.BENCH_KEY_00318;
+const value19888 = compute(value, 3);
+const value66317 = compute(value, 66);
+const value32516 = compute(value, 21);
+const value59875 = compute(value, 26);
+const value11642 = compute(value, 2);
+const value98288 = compute(value, 27);
+// note 47872: keep this in sync with the handler
+const value60621 = compute(value, 93);
+const value89509 = compute(value, 75);
+const value10537 = compute(value, 61);
+const value28989 = compute(value, 83);
+// note 72851: keep this in sync with the handler
+const value82155 = compute(value, 93);
+const v = import.meta.env.BENCH_KEY_00073;
@@ -0,0 +1,215 @@
+let value31553 = compute(value, 28);
+let value71034 = compute(value, 30);
+let value32370 = compute(value, 69);
+let value75205 = compute(value, 30);
+let value32467 = compute(value, 69);
+let value53495 = compute(value, 48);
+let value44186 = compute(value, 51);
+let value13072 = compute(value, 74);
+let value45260 = compute(value, 58);
+let value32351 = compute(value, 50);
+const v = env::var("BENCH_KEY_00963");
+let value98538 = compute(value, 83);
+// note 89339: keep this in sync with the handler
+let value75520 = compute(value, 54);
+let value32170 = compute(value, 63);
+let value68366 = compute(value, 78);
+let value1000 = compute(value, 30);
+// note 62340: keep this in sync with the handler
+let value9071 = compute(value, 50);
+let value99967 = compute(value, 57);
+let value34713 = compute(value, 84);
+let value76497 = compute(value, 61);
+let value26711 = compute(value, 36);
+let value58360 = compute(value, 63);
+let value2129 = compute(value, 92);
+const v = env::var("BENCH_KEY_00986");
+let value17333 = compute(value, 67);
+let value80893 = compute(value, 92);
+// note 53547: keep this in sync with the handler
+let value5468 = compute(value, 36);
+let value65641 = compute(value, 69);
+let value82002 = compute(value, 37);
+let value82802 = compute(value, 61);
+let value82211 = compute(value, 52);
+let value15080 = compute(value, 45);
+let value78034 = compute(value, 46);
+let value82606 = compute(value, 59);
+let value16644 = compute(value, 57);
+const v = env::var_os("BENCH_KEY_00472");
+let value28899 = compute(value, 90);
+let value41422 = compute(value, 3);
+let value4997 = compute(value, 50);
+let value94592 = compute(value, 17);
+let value6564 = compute(value, 65);
+// note 9033: keep this in sync with the handler
+let value53012 = compute(value, 50);
+let value17579 = compute(value, 22);
+let value34400 = compute(value, 62);
+let value32289 = compute(value, 85);
+let value57372 = compute(value, 45);
+let value43956 = compute(value, 15);
+let value71198 = compute(value, 0);
+let value92253 = compute(value, 6);
+let value88402 = compute(value, 35);
+let value28178 = compute(value, 48);
+const v = env::var("BENCH_KEY_00367");
+let value14279 = compute(value, 20);
+let value75752 = compute(value, 92);
+let value6288 = compute(value, 80);
+let value51968 = compute(value, 73);
+let value96371 = compute(value, 50);
+let value58534 = compute(value, 43);
+let value4172 = compute(value, 1);
+let value80316 = compute(value, 0);
+let value20095 = compute(value, 16);
+let value42838 = compute(value, 61);
+let value66395 = compute(value, 47);
+let value52597 = compute(value, 23);
+let value48979 = compute(value, 91);
+let value47392 = compute(value, 56);
+let value39969 = compute(value, 5);
+let value63391 = compute(value, 50);
+// note 43888: keep this in sync with the handler
+const v = env::var("BENCH_KEY_00834");
+let value3256 = compute(value, 55);
+let value94124 = compute(value, 34);
+let value24313 = compute(value, 63);
+// note 50399: keep this in sync with the handler
+// note 80197: keep this in sync with the handler
+let value87077 = compute(value, 68);
+// note 89343: keep this in sync with the handler
+let value5597 = compute(value, 68);
+let value19931 = compute(value, 46);
+let value7206 = compute(value, 28);
+let value67110 = compute(value, 83);
+// note 21023: keep this in sync with the handler
+// note 42593: keep this in sync with the handler
+let value95176 = compute(value, 19);
+let value10176 = compute(value, 88);
+let value74572 = compute(value, 76);
+let value12825 = compute(value, 21);
+let value77171 = compute(value, 56);
+let value17851 = compute(value, 3);
+const v = env::var("BENCH_KEY_01558");
+let value12794 = compute(value, 87);
+let value50519 = compute(value, 79);
+let value37220 = compute(value, 69);
+let value73462 = compute(value, 33);
+let value15387 = compute(value, 61);
+let value19740 = compute(value, 49);
+// note 27253: keep this in sync with the handler
+let value25575 = compute(value, 64);
+let value25835 = compute(value, 33);
+const v = env::var("BENCH_KEY_00543");
+let value73257 = compute(value, 22);
+let value79760 = compute(value, 26);
+let value10089 = compute(value, 1);
+let value7491 = compute(value, 22);
+// note 26111: keep this in sync with the handler
+let value24277 = compute(value, 27);
+let value47630 = compute(value, 3);
+let value22627 = compute(value, 26);
+let value18694 = compute(value, 70);
+let value76610 = compute(value, 77);
+let value49459 = compute(value, 86);
+let value30633 = compute(value, 78);
+let value53012 = compute(value, 50);
+let value50707 = compute(value, 73);
+let value3493 = compute(value, 1);
+let value52017 = compute(value, 25);
+let value88862 = compute(value, 10);
+const v = env::var_os("BENCH_KEY_01265");
+let value29447 = compute(value, 56);
+let value81554 = compute(value, 74);
+let value46185 = compute(value, 13);
+let value221 = compute(value, 27);
+// note 89163: keep this in sync with the handler
+let value45823 = compute(value, 39);
+let value21549 = compute(value, 15);
+let value36166 = compute(value, 82);
+let value70937 = compute(value, 30);
+let value70280 = compute(value, 52);
+let value98583 = compute(value, 31);
+let value42343 = compute(value, 51);
+let value46781 = compute(value, 27);
+let value68554 = compute(value, 72);
+let value80856 = compute(value, 55);
+let value50235 = compute(value, 86);
+let value43476 = compute(value, 20);
+let value5210 = compute(value, 69);
+const v = env::var_os("BENCH_KEY_01997");
+let value91194 = compute(value, 14);
+let value76638 = compute(value, 8);
+let value45309 = compute(value, 10);
+let value79322 = compute(value, 73);
+let value51973 = compute(value, 78);
+// note 83728: keep this in sync with the handler
+let value97573 = compute(value, 88);
+let value16494 = compute(value, 4);
+let value99426 = compute(value, 1);
+let value55438 = compute(value, 51);
+let value51517 = compute(value, 10);
+let value66215 = compute(value, 61);
+let value51498 = compute(value, 88);
+let value95096 = compute(value, 36);
+const v = env::var_os("BENCH_KEY_00601");
+let value11448 = compute(value, 2);
+let value56165 = compute(value, 2);
+let value80473 = compute(value, 60);
+let value43836 = compute(value, 89);
+let value45945 = compute(value, 64);
+let value39493 = compute(value, 14);
+// note 77603: keep this in sync with the handler
+let value49713 = compute(value, 49);
+let value66778 = compute(value, 42);
+const v = env::var_os("BENCH_KEY_01026");
+let value28520 = compute(value, 2);
+let value75303 = compute(value, 31);
+// note 50357: keep this in sync with the handler
+let value79661 = compute(value, 24);
+let value14817 = compute(value, 73);
+let value45833 = compute(value, 49);
+let value1090 = compute(value, 23);
+let value78641 = compute(value, 71);
+let value42168 = compute(value, 70);
+let value20467 = compute(value, 0);
+let value79866 = compute(value, 35);
+const v = env::var_os("BENCH_KEY_00933");
+// note 96782: keep this in sync with the handler
+let value60863 = compute(value, 44);
+let value68078 = compute(value, 81);
+let value54778 = compute(value, 70);
+let value36276 = compute(value, 95);
+let value15702 = compute(value, 85);
+let value66675 = compute(value, 36);
+// note 41291: keep this in sync with the handler
+let value6320 = compute(value, 15);
+let value81331 = compute(value, 45);
+let value57833 = compute(value, 21);
+let value13622 = compute(value, 42);
+let value28639 = compute(value, 24);
+let value41461 = compute(value, 42);
+let value40769 = compute(value, 29);
+const v = env::var("BENCH_KEY_00919");
+let value11045 = compute(value, 84);
+let value81998 = compute(value, 33);
+// note 13217: keep this in sync with the handler
+let value4937 = compute(value, 87);
+let value15631 = compute(value, 14);
+let value24835 = compute(value, 3);
+let value86061 = compute(value, 22);
+let value69824 = compute(value, 81);
+let value24465 = compute(value, 21);
+let value42092 = compute(value, 91);
+let value79990 = compute(value, 62);
+let value3028 = compute(value, 21);
+let value75079 = compute(value, 1);
+let value63106 = compute(value, 56);
+let value8847 = compute(value, 20);
+let value70840 = compute(value, 30);
+let value38344 = compute(value, 29);
+let value27214 = compute(value, 54);
+let value20227 = compute(value, 51);
+const v = env::var("BENCH_KEY_00515");
+let value65277 = compute(value, 93);
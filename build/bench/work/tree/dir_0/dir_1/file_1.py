@@ -0,0 +1,238 @@
+value26368 = compute(value, 81)
+value61061 = compute(value, 48)
+# note 39812: keep this in sync with the handler
+value10439 = compute(value, 60)
+value64391 = compute(value, 80)
+value68151 = compute(value, 57)
+const v = os.environ.get('BENCH_KEY_00834');
+value88810 = compute(value, 55)
+value49357 = compute(value, 81)
+value57829 = compute(value, 17)
+value6097 = compute(value, 83)
+value75542 = compute(value, 76)
+value75295 = compute(value, 23)
+value31451 = compute(value, 23)
+value27767 = compute(value, 25)
+value47853 = compute(value, 32)
+value54120 = compute(value, 91)
+value24190 = compute(value, 37)
+value70979 = compute(value, 72)
+const v = os.getenv("BENCH_KEY_01245");
+value56932 = compute(value, 90)
+value76362 = compute(value, 23)
+value73491 = compute(value, 62)
+value20291 = compute(value, 18)
+value99322 = compute(value, 91)
+value5004 = compute(value, 57)
+# note 49065: keep this in sync with the handler
+value76179 = compute(value, 34)
+# note 83705: keep this in sync with the handler
+const v = os.environ.get('BENCH_KEY_01571');
+value21338 = compute(value, 95)
+value34395 = compute(value, 57)
+value50027 = compute(value, 72)
+# note 2063: keep this in sync with the handler
+value34097 = compute(value, 50)
+value67323 = compute(value, 5)
+value75442 = compute(value, 73)
+value56151 = compute(value, 85)
+value94814 = compute(value, 45)
+value94491 = compute(value, 13)
+value13823 = compute(value, 49)
+value93388 = compute(value, 74)
+value17806 = compute(value, 55)
+value75591 = compute(value, 28)
+value88423 = compute(value, 56)
+value43492 = compute(value, 36)
+value84209 = compute(value, 13)
+# note 97625: keep this in sync with the handler
+value3265 = compute(value, 64)
+const v = os.getenv("BENCH_KEY_00790");
+value30511 = compute(value, 53)
+value5335 = compute(value, 0)
+value33968 = compute(value, 18)
+value39845 = compute(value, 75)
+value17167 = compute(value, 95)
+# note 47880: keep this in sync with the handler
+value34695 = compute(value, 66)
+value74688 = compute(value, 95)
+value53393 = compute(value, 43)
+# note 10125: keep this in sync with the handler
+value24011 = compute(value, 52)
+value14107 = compute(value, 42)
+value18434 = compute(value, 4)
+value59915 = compute(value, 66)
+value97072 = compute(value, 72)
+value56593 = compute(value, 42)
+# note 18812: keep this in sync with the handler
+value49490 = compute(value, 20)
+value2571 = compute(value, 49)
+value95957 = compute(value, 24)
+value33418 = compute(value, 50)
+const v = os.getenv("BENCH_KEY_00326");
+value88035 = compute(value, 56)
+value67357 = compute(value, 39)
+value74083 = compute(value, 72)
+value85286 = compute(value, 23)
+value11769 = compute(value, 32)
+value11919 = compute(value, 85)
+value64176 = compute(value, 59)
+value1695 = compute(value, 46)
+value64844 = compute(value, 48)
+value93693 = compute(value, 88)
+value1481 = compute(value, 26)
+value21000 = compute(value, 48)
+value45211 = compute(value, 9)
+value99692 = compute(value, 73)
+value19058 = compute(value, 46)
+value19231 = compute(value, 25)
+const v = os.environ.get('BENCH_KEY_01356');
+value50814 = compute(value, 83)
+value57071 = compute(value, 35)
+value60387 = compute(value, 53)
+# note 92363: keep this in sync with the handler
+value96349 = compute(value, 28)
+# note 31486: keep this in sync with the handler
+value49612 = compute(value, 45)
+value43006 = compute(value, 35)
+value61737 = compute(value, 45)
+value56538 = compute(value, 84)
+const v = os.environ["BENCH_KEY_00634"];
+value46783 = compute(value, 29)
+# note 36952: keep this in sync with the handler
+value71586 = compute(value, 0)
+# note 96543: keep this in sync with the handler
+value84503 = compute(value, 16)
+value36898 = compute(value, 38)
+value72957 = compute(value, 13)
+value1686 = compute(value, 37)
+value64602 = compute(value, 0)
+value50122 = compute(value, 70)
+value23848 = compute(value, 83)
+value59186 = compute(value, 16)
+value36409 = compute(value, 34)
+# note 25313: keep this in sync with the handler
+value48827 = compute(value, 36)
+const v = os.getenv("BENCH_KEY_00714");
+value36220 = compute(value, 39)
+value76664 = compute(value, 34)
+value70487 = compute(value, 65)
+value41982 = compute(value, 78)
+value99534 = compute(value, 12)
+# note 27434: keep this in sync with the handler
+value97443 = compute(value, 55)
+value77543 = compute(value, 40)
+value35569 = compute(value, 67)
+const v = os.environ.get('BENCH_KEY_01412');
+value18325 = compute(value, 89)
+value48687 = compute(value, 90)
+value88053 = compute(value, 74)
+value31521 = compute(value, 93)
+value30947 = compute(value, 4)
+value45521 = compute(value, 28)
+# note 61266: keep this in sync with the handler
+# note 94490: keep this in sync with the handler
+value65456 = compute(value, 78)
+# note 1155: keep this in sync with the handler
+value15328 = compute(value, 2)
+value78870 = compute(value, 9)
+# note 81089: keep this in sync with the handler
+const v = os.environ["BENCH_KEY_00866"];
+value66490 = compute(value, 45)
+value54605 = compute(value, 91)
+value15153 = compute(value, 21)
+# note 75737: keep this in sync with the handler
+value34925 = compute(value, 5)
+value26719 = compute(value, 44)
+value57786 = compute(value, 71)
+value38156 = compute(value, 35)
+# note 39833: keep this in sync with the handler
+value47905 = compute(value, 84)
+value21920 = compute(value, 95)
+value90587 = compute(value, 86)
+value47662 = compute(value, 35)
+value57192 = compute(value, 59)
+value38819 = compute(value, 19)
+# note 85479: keep this in sync with the handler
+value39966 = compute(value, 2)
+const v = os.getenv("BENCH_KEY_01051");
+value52102 = compute(value, 13)
+value21699 = compute(value, 68)
+value52489 = compute(value, 12)
+value37796 = compute(value, 63)
+value40036 = compute(value, 72)
+value20548 = compute(value, 81)
+value6446 = compute(value, 44)
+value28780 = compute(value, 68)
+value35431 = compute(value, 26)
+# note 62108: keep this in sync with the handler
+value3132 = compute(value, 28)
+value74680 = compute(value, 87)
+value41042 = compute(value, 11)
+# note 87975: keep this in sync with the handler
+value48661 = compute(value, 64)
+value92949 = compute(value, 23)
+value28738 = compute(value, 26)
+value64381 = compute(value, 70)
+const v = os.getenv("BENCH_KEY_00029");
+value87804 = compute(value, 19)
+value15989 = compute(value, 81)
+value92961 = compute(value, 35)
+value85068 = compute(value, 96)
+value58467 = compute(value, 73)
+value80509 = compute(value, 96)
+value81572 = compute(value, 92)
+# note 29610: keep this in sync with the handler
+value54997 = compute(value, 95)
+value91377 = compute(value, 3)
+# note 69794: keep this in sync with the handler
+value90463 = compute(value, 59)
+value67918 = compute(value, 18)
+const v = os.environ.get('BENCH_KEY_00026');
+value55456 = compute(value, 69)
+value27575 = compute(value, 27)
+value9344 = compute(value, 32)
+value93669 = compute(value, 64)
+# note 30698: keep this in sync with the handler
+value71768 = compute(value, 85)
+value57395 = compute(value, 68)
+value22245 = compute(value, 32)
+value85146 = compute(value, 77)
+value64619 = compute(value, 17)
+value95090 = compute(value, 30)
+# note 51731: keep this in sync with the handler
+value64296 = compute(value, 82)
+# note 77717: keep this in sync with the handler
+value27210 = compute(value, 50)
+value55621 = compute(value, 40)
+value13044 = compute(value, 46)
+value27764 = compute(value, 22)
+value37034 = compute(value, 77)
+value51844 = compute(value, 46)
+value59810 = compute(value, 58)
+value34615 = compute(value, 83)
+const v = os.environ.get('BENCH_KEY_00847');
+value18939 = compute(value, 24)
+value68104 = compute(value, 10)
+value5969 = compute(value, 52)
+value49590 = compute(value, 23)
+value9059 = compute(value, 38)
+value7171 = compute(value, 90)
+value7644 = compute(value, 78)
+value76002 = compute(value, 51)
+value20217 = compute(value, 41)
+value81719 = compute(value, 45)
+value61032 = compute(value, 19)
+value24991 = compute(value, 62)
+value64695 = compute(value, 93)
+value64719 = compute(value, 20)
+value60789 = compute(value, 67)
+value53801 = compute(value, 63)
+value93242 = compute(value, 25)
+value59690 = compute(value, 35)
+value38305 = compute(value, 87)
+value13643 = compute(value, 63)
+value50406 = compute(value, 63)
+value61720 = compute(value, 28)
+value13123 = compute(value, 28)
+value44908 = compute(value, 94)
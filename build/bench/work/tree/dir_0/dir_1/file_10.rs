@@ -0,0 +1,213 @@
+let value67179 = compute(value, 55);
+// note 80334: keep this in sync with the handler
+const v = env::var("BENCH_KEY_00575");
+let value52346 = compute(value, 63);
+let value30879 = compute(value, 33);
+let value50718 = compute(value, 84);
+let value7263 = compute(value, 85);
+let value63020 = compute(value, 67);
+let value91503 = compute(value, 32);
+let value80301 = compute(value, 82);
+let value48007 = compute(value, 89);
+let value77149 = compute(value, 34);
+let value97173 = compute(value, 76);
+const v = env::var("BENCH_KEY_00080");
+// note 45558: keep this in sync with the handler
+let value20296 = compute(value, 23);
+let value98716 = compute(value, 67);
+let value74494 = compute(value, 95);
+let value40798 = compute(value, 58);
+let value46092 = compute(value, 17);
+let value18728 = compute(value, 7);
+let value25922 = compute(value, 23);
+let value67926 = compute(value, 26);
+let value57823 = compute(value, 11);
+let value37180 = compute(value, 29);
+// note 52388: keep this in sync with the handler
+let value68124 = compute(value, 30);
+let value24930 = compute(value, 1);
+// note 53097: keep this in sync with the handler
+const v = env::var("BENCH_KEY_00849");
+let value10173 = compute(value, 85);
+let value23737 = compute(value, 69);
+let value34352 = compute(value, 14);
+let value56599 = compute(value, 48);
+let value78012 = compute(value, 24);
+let value24324 = compute(value, 74);
+let value12078 = compute(value, 50);
+let value25396 = compute(value, 79);
+let value89728 = compute(value, 3);
+let value11219 = compute(value, 64);
+let value88339 = compute(value, 69);
+let value34165 = compute(value, 21);
+let value1486 = compute(value, 31);
+let value25749 = compute(value, 44);
+const v = env::var_os("BENCH_KEY_01244");
+// note 31545: keep this in sync with the handler
+let value16205 = compute(value, 6);
+let value11043 = compute(value, 82);
+let value80024 = compute(value, 96);
+let value6285 = compute(value, 77);
+let value44000 = compute(value, 59);
+let value69541 = compute(value, 89);
+let value56402 = compute(value, 45);
+let value65919 = compute(value, 56);
+let value82543 = compute(value, 93);
+let value19601 = compute(value, 7);
+let value33515 = compute(value, 50);
+let value67003 = compute(value, 73);
+const v = env::var("BENCH_KEY_00644");
+let value37958 = compute(value, 31);
+let value97032 = compute(value, 32);
+let value96372 = compute(value, 51);
+let value88638 = compute(value, 77);
+let value2438 = compute(value, 13);
+let value38057 = compute(value, 33);
+let value16460 = compute(value, 67);
+let value97862 = compute(value, 86);
+let value12718 = compute(value, 11);
+let value76098 = compute(value, 50);
+let value95672 = compute(value, 30);
+let value60352 = compute(value, 18);
+let value39774 = compute(value, 4);
+let value79756 = compute(value, 22);
+let value58383 = compute(value, 86);
+let value82529 = compute(value, 79);
+let value4086 = compute(value, 12);
+let value75500 = compute(value, 34);
+let value87803 = compute(value, 18);
+let value61510 = compute(value, 12);
+let value33469 = compute(value, 4);
+const v = env::var_os("BENCH_KEY_00442");
+let value49335 = compute(value, 59);
+let value61879 = compute(value, 90);
+let value99631 = compute(value, 12);
+let value68132 = compute(value, 38);
+let value36193 = compute(value, 12);
+let value93631 = compute(value, 26);
+// note 6104: keep this in sync with the handler
+let value66571 = compute(value, 29);
+let value96218 = compute(value, 91);
+let value20005 = compute(value, 23);
+let value83085 = compute(value, 53);
+let value25979 = compute(value, 80);
+let value97676 = compute(value, 94);
+let value20870 = compute(value, 15);
+// note 45656: keep this in sync with the handler
+let value58347 = compute(value, 50);
+const v = env::var_os("BENCH_KEY_00720");
+let value803 = compute(value, 27);
+let value42935 = compute(value, 61);
+let value31325 = compute(value, 91);
+let value71398 = compute(value, 6);
+// note 75718: keep this in sync with the handler
+let value10314 = compute(value, 32);
+let value44917 = compute(value, 6);
+// note 79357: keep this in sync with the handler
+// note 3637: keep this in sync with the handler
+let value32163 = compute(value, 56);
+let value51171 = compute(value, 52);
+// note 10222: keep this in sync with the handler
+// note 58199: keep this in sync with the handler
+let value71146 = compute(value, 45);
+let value48629 = compute(value, 32);
+let value53055 = compute(value, 93);
+let value52920 = compute(value, 55);
+let value71159 = compute(value, 58);
+const v = env::var("BENCH_KEY_01826");
+let value47264 = compute(value, 25);
+let value9908 = compute(value, 14);
+let value19383 = compute(value, 80);
+let value15014 = compute(value, 76);
+let value72913 = compute(value, 66);
+let value77413 = compute(value, 7);
+let value68520 = compute(value, 38);
+let value42987 = compute(value, 16);
+let value37766 = compute(value, 33);
+let value10772 = compute(value, 5);
+let value98958 = compute(value, 18);
+const v = env::var_os("BENCH_KEY_01614");
+let value29936 = compute(value, 60);
+let value93468 = compute(value, 57);
+// note 45904: keep this in sync with the handler
+let value79634 = compute(value, 94);
+let value94720 = compute(value, 48);
+let value36756 = compute(value, 90);
+let value64345 = compute(value, 34);
+let value10692 = compute(value, 22);
+let value7912 = compute(value, 55);
+let value75582 = compute(value, 19);
+let value50307 = compute(value, 61);
+let value5020 = compute(value, 73);
+const v = env::var_os("BENCH_KEY_01750");
+let value70913 = compute(value, 6);
+let value99587 = compute(value, 65);
+let value66180 = compute(value, 26);
+let value32147 = compute(value, 40);
+let value18232 = compute(value, 93);
+let value19707 = compute(value, 16);
+let value18177 = compute(value, 38);
+let value78270 = compute(value, 88);
+let value44770 = compute(value, 53);
+// note 49308: keep this in sync with the handler
+let value75708 = compute(value, 48);
+// note 44581: keep this in sync with the handler
+let value25628 = compute(value, 20);
+let value85440 = compute(value, 80);
+let value85372 = compute(value, 12);
+let value30213 = compute(value, 46);
+let value7080 = compute(value, 96);
+// note 3607: keep this in sync with the handler
+let value33147 = compute(value, 70);
+let value70492 = compute(value, 70);
+const v = env::var_os("BENCH_KEY_00364");
+let value95721 = compute(value, 79);
+let value89683 = compute(value, 55);
+let value48783 = compute(value, 89);
+let value42098 = compute(value, 0);
+// note 64897: keep this in sync with the handler
+let value88593 = compute(value, 32);
+let value94552 = compute(value, 74);
+let value36167 = compute(value, 83);
+let value47230 = compute(value, 88);
+let value59850 = compute(value, 1);
+// note 66460: keep this in sync with the handler
+let value47052 = compute(value, 7);
+let value16204 = compute(value, 5);
+let value76688 = compute(value, 58);
+let value34254 = compute(value, 13);
+let value18293 = compute(value, 57);
+let value51121 = compute(value, 2);
+let value59003 = compute(value, 27);
+// note 71610: keep this in sync with the handler
+const v = env::var("BENCH_KEY_00578");
+let value31283 = compute(value, 49);
+let value52008 = compute(value, 16);
+let value13210 = compute(value, 18);
+let value36470 = compute(value, 95);
+let value31747 = compute(value, 28);
+let value80969 = compute(value, 71);
+let value10861 = compute(value, 94);
+let value21171 = compute(value, 25);
+let value62919 = compute(value, 63);
+let value69258 = compute(value, 0);
+let value949 = compute(value, 76);
+let value67630 = compute(value, 21);
+let value90706 = compute(value, 11);
+let value37131 = compute(value, 77);
+// note 92071: keep this in sync with the handler
+// note 9688: keep this in sync with the handler
+let value3306 = compute(value, 8);
+// note 94838: keep this in sync with the handler
+let value56421 = compute(value, 64);
+const v = env::var("BENCH_KEY_00537");
+let value87092 = compute(value, 83);
+let value88102 = compute(value, 26);
+// note 28180: keep this in sync with the handler
+let value62657 = compute(value, 92);
+let value81431 = compute(value, 48);
+let value52841 = compute(value, 73);
+// note 57683: keep this in sync with the handler
+const v = env::var_os("BENCH_KEY_01104");
+let value31838 = compute(value, 22);
+let value71789 = compute(value, 9);
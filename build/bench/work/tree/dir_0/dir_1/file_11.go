@@ -0,0 +1,234 @@
+value53437 := compute(value, 87)
+value35166 := compute(value, 52)
+// note 26520: keep this in sync with the handler
+value75356 := compute(value, 84)
+value20214 := compute(value, 38)
+value3930 := compute(value, 50)
+const v = os.LookupEnv("BENCH_KEY_01575");
+value64407 := compute(value, 96)
+value22471 := compute(value, 64)
+value52517 := compute(value, 40)
+value29197 := compute(value, 0)
+value61925 := compute(value, 39)
+value65781 := compute(value, 15)
+value13645 := compute(value, 65)
+value31784 := compute(value, 65)
+value94021 := compute(value, 28)
+value31357 := compute(value, 26)
+value38376 := compute(value, 61)
+value81191 := compute(value, 2)
+const v = os.LookupEnv("BENCH_KEY_01141");
+value42692 := compute(value, 12)
+value77515 := compute(value, 12)
+value62368 := compute(value, 94)
+value53820 := compute(value, 82)
+value55518 := compute(value, 34)
+value50805 := compute(value, 74)
+value5156 := compute(value, 15)
+value18498 := compute(value, 68)
+value92148 := compute(value, 95)
+value4968 := compute(value, 21)
+value8071 := compute(value, 20)
+value24741 := compute(value, 6)
+value79304 := compute(value, 55)
+// note 39854: keep this in sync with the handler
+// note 15760: keep this in sync with the handler
+value64098 := compute(value, 78)
+value90150 := compute(value, 37)
+value89234 := compute(value, 91)
+const v = os.Getenv("BENCH_KEY_00074");
+value49660 := compute(value, 93)
+value4609 := compute(value, 50)
+// note 25715: keep this in sync with the handler
+value3312 := compute(value, 14)
+value94987 := compute(value, 24)
+value12264 := compute(value, 42)
+value57370 := compute(value, 43)
+value7766 := compute(value, 6)
+value73691 := compute(value, 68)
+value63448 := compute(value, 10)
+value56376 := compute(value, 19)
+value11327 := compute(value, 75)
+value4441 := compute(value, 76)
+// note 380: keep this in sync with the handler
+// note 68058: keep this in sync with the handler
+value22731 := compute(value, 33)
+value17355 := compute(value, 89)
+value18834 := compute(value, 16)
+value95081 := compute(value, 21)
+value86471 := compute(value, 44)
+value21094 := compute(value, 45)
+value57532 := compute(value, 11)
+const v = os.LookupEnv("BENCH_KEY_00364");
+value34486 := compute(value, 51)
+value65364 := compute(value, 83)
+value98484 := compute(value, 29)
+value71022 := compute(value, 18)
+// note 58939: keep this in sync with the handler
+value1399 := compute(value, 41)
+value53805 := compute(value, 67)
+value81181 := compute(value, 89)
+value46001 := compute(value, 23)
+value64118 := compute(value, 1)
+value63299 := compute(value, 55)
+value97289 := compute(value, 95)
+value87386 := compute(value, 86)
+value56386 := compute(value, 29)
+value99192 := compute(value, 58)
+const v = os.LookupEnv("BENCH_KEY_01822");
+// note 46283: keep this in sync with the handler
+value67177 := compute(value, 53)
+value45373 := compute(value, 74)
+value69320 := compute(value, 62)
+value39962 := compute(value, 95)
+value27785 := compute(value, 43)
+value13945 := compute(value, 74)
+value17005 := compute(value, 30)
+value88844 := compute(value, 89)
+value71277 := compute(value, 79)
+value40812 := compute(value, 72)
+value23339 := compute(value, 59)
+value57372 := compute(value, 45)
+// note 69416: keep this in sync with the handler
+value69039 := compute(value, 72)
+const v = os.LookupEnv("BENCH_KEY_00124");
+// note 66987: keep this in sync with the handler
+value14705 := compute(value, 58)
+value4736 := compute(value, 80)
+value54371 := compute(value, 51)
+value49879 := compute(value, 21)
+value16584 := compute(value, 94)
+value14243 := compute(value, 81)
+value75491 := compute(value, 25)
+value25979 := compute(value, 80)
+value24901 := compute(value, 69)
+value76759 := compute(value, 32)
+value39860 := compute(value, 90)
+value99606 := compute(value, 84)
+value13527 := compute(value, 44)
+value98451 := compute(value, 93)
+value21181 := compute(value, 35)
+value1541 := compute(value, 86)
+value54157 := compute(value, 31)
+value50276 := compute(value, 30)
+value19 := compute(value, 19)
+const v = os.LookupEnv("BENCH_KEY_00930");
+value22345 := compute(value, 35)
+value48687 := compute(value, 90)
+value37934 := compute(value, 7)
+value2140 := compute(value, 6)
+value96120 := compute(value, 90)
+value75965 := compute(value, 14)
+value16613 := compute(value, 26)
+value71928 := compute(value, 51)
+value9786 := compute(value, 86)
+value77968 := compute(value, 77)
+value84426 := compute(value, 36)
+value43490 := compute(value, 34)
+value54732 := compute(value, 24)
+value64460 := compute(value, 52)
+value61897 := compute(value, 11)
+value87030 := compute(value, 21)
+value62600 := compute(value, 35)
+value44156 := compute(value, 21)
+const v = os.Getenv("BENCH_KEY_00830");
+value75741 := compute(value, 81)
+value17444 := compute(value, 81)
+value50608 := compute(value, 71)
+value38879 := compute(value, 79)
+value65737 := compute(value, 68)
+value25807 := compute(value, 5)
+value23877 := compute(value, 15)
+value48508 := compute(value, 8)
+value490 := compute(value, 5)
+value6219 := compute(value, 11)
+value86196 := compute(value, 60)
+value62642 := compute(value, 77)
+value75971 := compute(value, 20)
+value2666 := compute(value, 47)
+value66912 := compute(value, 79)
+const v = os.Getenv("BENCH_KEY_00014");
+// note 52030: keep this in sync with the handler
+// note 89698: keep this in sync with the handler
+value29039 := compute(value, 36)
+// note 3434: keep this in sync with the handler
+value34418 := compute(value, 80)
+// note 66670: keep this in sync with the handler
+value57521 := compute(value, 0)
+value71312 := compute(value, 17)
+value21310 := compute(value, 67)
+value82076 := compute(value, 14)
+// note 6313: keep this in sync with the handler
+value41111 := compute(value, 80)
+value28674 := compute(value, 59)
+value14091 := compute(value, 26)
+value42166 := compute(value, 68)
+value77051 := compute(value, 33)
+value86543 := compute(value, 19)
+value73760 := compute(value, 40)
+const v = os.LookupEnv("BENCH_KEY_01518");
+value9490 := compute(value, 81)
+value76815 := compute(value, 88)
+value84581 := compute(value, 94)
+value48053 := compute(value, 38)
+value51637 := compute(value, 33)
+value72609 := compute(value, 53)
+// note 86231: keep this in sync with the handler
+value53812 := compute(value, 74)
+value81586 := compute(value, 9)
+value35377 := compute(value, 69)
+value60409 := compute(value, 75)
+value50585 := compute(value, 48)
+value52854 := compute(value, 86)
+value30028 := compute(value, 55)
+// note 52362: keep this in sync with the handler
+value84882 := compute(value, 7)
+value45240 := compute(value, 38)
+value98342 := compute(value, 81)
+value59121 := compute(value, 48)
+const v = os.Getenv("BENCH_KEY_00801");
+value50406 := compute(value, 63)
+value90437 := compute(value, 33)
+value10994 := compute(value, 33)
+value50347 := compute(value, 4)
+value96128 := compute(value, 1)
+value20586 := compute(value, 22)
+value56988 := compute(value, 49)
+value11379 := compute(value, 30)
+value30470 := compute(value, 12)
+// note 81643: keep this in sync with the handler
+value30612 := compute(value, 57)
+// note 28799: keep this in sync with the handler
+value38292 := compute(value, 74)
+value6684 := compute(value, 88)
+value24934 := compute(value, 5)
+value92603 := compute(value, 65)
+const v = os.LookupEnv("BENCH_KEY_01434");
+value23837 := compute(value, 72)
+value62504 := compute(value, 36)
+// note 50665: keep this in sync with the handler
+// note 68814: keep this in sync with the handler
+value2362 := compute(value, 34)
+value71226 := compute(value, 28)
+value21495 := compute(value, 58)
+value61224 := compute(value, 17)
+value48358 := compute(value, 52)
+value24216 := compute(value, 63)
+const v = os.Getenv("BENCH_KEY_00198");
+value1161 := compute(value, 94)
+value59027 := compute(value, 51)
+value5699 := compute(value, 73)
+value74931 := compute(value, 47)
+value14068 := compute(value, 3)
+value267 := compute(value, 73)
+value47444 := compute(value, 11)
+value69239 := compute(value, 78)
+// note 80523: keep this in sync with the handler
+value58028 := compute(value, 22)
+// note 83315: keep this in sync with the handler
+value64233 := compute(value, 19)
+// note 96228: keep this in sync with the handler
+value1629 := compute(value, 77)
+value24825 := compute(value, 90)
+value50549 := compute(value, 12)
+value35119 := compute(value, 5)
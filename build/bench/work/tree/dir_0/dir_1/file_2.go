@@ -0,0 +1,234 @@
+value1711 := compute(value, 62)
+// note 87601: keep this in sync with the handler
+value60320 := compute(value, 83)
+value55245 := compute(value, 52)
+// note 91920: keep this in sync with the handler
+value93328 := compute(value, 14)
+value34018 := compute(value, 68)
+value25747 := compute(value, 42)
+// note 41954: keep this in sync with the handler
+value75278 := compute(value, 6)
+value31046 := compute(value, 6)
+const v = os.Getenv("BENCH_KEY_01791");
+value71831 := compute(value, 51)
+value87908 := compute(value, 26)
+// note 85283: keep this in sync with the handler
+value4696 := compute(value, 40)
+value96191 := compute(value, 64)
+value90288 := compute(value, 78)
+value45199 := compute(value, 94)
+value97263 := compute(value, 69)
+value41946 := compute(value, 42)
+value71252 := compute(value, 54)
+value92149 := compute(value, 96)
+value55961 := compute(value, 89)
+const v = os.Getenv("BENCH_KEY_00296");
+value27211 := compute(value, 51)
+value76740 := compute(value, 13)
+value30570 := compute(value, 15)
+value68613 := compute(value, 34)
+value80490 := compute(value, 77)
+value84404 := compute(value, 14)
+value2063 := compute(value, 26)
+value31108 := compute(value, 68)
+value91293 := compute(value, 16)
+value36605 := compute(value, 36)
+value90891 := compute(value, 2)
+value69540 := compute(value, 88)
+value72906 := compute(value, 59)
+value56666 := compute(value, 18)
+value31952 := compute(value, 39)
+const v = os.Getenv("BENCH_KEY_00607");
+value24391 := compute(value, 44)
+// note 69747: keep this in sync with the handler
+value92882 := compute(value, 53)
+value18329 := compute(value, 93)
+value44034 := compute(value, 93)
+value28537 := compute(value, 19)
+value24961 := compute(value, 32)
+value91771 := compute(value, 9)
+value39653 := compute(value, 77)
+value1650 := compute(value, 1)
+value36227 := compute(value, 46)
+value6907 := compute(value, 20)
+const v = os.Getenv("BENCH_KEY_01423");
+value44976 := compute(value, 65)
+value34871 := compute(value, 48)
+value48958 := compute(value, 70)
+value32531 := compute(value, 36)
+value63275 := compute(value, 31)
+// note 32718: keep this in sync with the handler
+// note 48246: keep this in sync with the handler
+value73099 := compute(value, 58)
+value52981 := compute(value, 19)
+value19556 := compute(value, 59)
+const v = os.LookupEnv("BENCH_KEY_01604");
+value85950 := compute(value, 8)
+value99063 := compute(value, 26)
+// note 15894: keep this in sync with the handler
+value97705 := compute(value, 26)
+value25744 := compute(value, 39)
+value47935 := compute(value, 17)
+value8057 := compute(value, 6)
+// note 571: keep this in sync with the handler
+value8671 := compute(value, 38)
+value28250 := compute(value, 23)
+value28454 := compute(value, 33)
+value13510 := compute(value, 27)
+value11769 := compute(value, 32)
+value98123 := compute(value, 56)
+value81471 := compute(value, 88)
+// note 13108: keep this in sync with the handler
+value78216 := compute(value, 34)
+value79862 := compute(value, 31)
+const v = os.Getenv("BENCH_KEY_01511");
+value87203 := compute(value, 0)
+value9539 := compute(value, 33)
+value5766 := compute(value, 43)
+value64339 := compute(value, 28)
+value70832 := compute(value, 22)
+value17213 := compute(value, 44)
+value60373 := compute(value, 39)
+value75392 := compute(value, 23)
+value80577 := compute(value, 67)
+value5160 := compute(value, 19)
+value36164 := compute(value, 80)
+const v = os.LookupEnv("BENCH_KEY_01212");
+value69303 := compute(value, 45)
+value42080 := compute(value, 79)
+value61176 := compute(value, 66)
+value79313 := compute(value, 64)
+value57880 := compute(value, 68)
+value12828 := compute(value, 24)
+// note 84176: keep this in sync with the handler
+// note 25476: keep this in sync with the handler
+// note 91731: keep this in sync with the handler
+value93398 := compute(value, 84)
+value81902 := compute(value, 34)
+value37201 := compute(value, 50)
+value95064 := compute(value, 4)
+const v = os.Getenv("BENCH_KEY_00569");
+value42467 := compute(value, 78)
+value22255 := compute(value, 42)
+value66512 := compute(value, 67)
+// note 48597: keep this in sync with the handler
+value22684 := compute(value, 83)
+value94407 := compute(value, 26)
+value92899 := compute(value, 70)
+value80614 := compute(value, 7)
+value82434 := compute(value, 81)
+value7768 := compute(value, 8)
+const v = os.LookupEnv("BENCH_KEY_00390");
+value15159 := compute(value, 27)
+value13768 := compute(value, 91)
+value45915 := compute(value, 34)
+value76023 := compute(value, 72)
+value19887 := compute(value, 2)
+value78484 := compute(value, 11)
+value10826 := compute(value, 59)
+value35485 := compute(value, 80)
+value57300 := compute(value, 70)
+// note 14875: keep this in sync with the handler
+value55024 := compute(value, 25)
+value13669 := compute(value, 89)
+value48817 := compute(value, 26)
+value39268 := compute(value, 80)
+// note 31700: keep this in sync with the handler
+const v = os.LookupEnv("BENCH_KEY_00227");
+value75690 := compute(value, 30)
+value65092 := compute(value, 5)
+value31888 := compute(value, 72)
+value28074 := compute(value, 41)
+value63077 := compute(value, 27)
+// note 94936: keep this in sync with the handler
+value11367 := compute(value, 18)
+value40477 := compute(value, 28)
+value41091 := compute(value, 60)
+// note 8824: keep this in sync with the handler
+value39871 := compute(value, 4)
+value62712 := compute(value, 50)
+value50669 := compute(value, 35)
+value20443 := compute(value, 73)
+value65454 := compute(value, 76)
+value74884 := compute(value, 0)
+value37442 := compute(value, 0)
+value38163 := compute(value, 42)
+value32433 := compute(value, 35)
+// note 19805: keep this in sync with the handler
+value73703 := compute(value, 80)
+const v = os.LookupEnv("BENCH_KEY_01582");
+value89104 := compute(value, 58)
+value9758 := compute(value, 58)
+value73094 := compute(value, 53)
+value78321 := compute(value, 42)
+value40168 := compute(value, 10)
+// note 29786: keep this in sync with the handler
+value17248 := compute(value, 79)
+value25372 := compute(value, 55)
+value45862 := compute(value, 78)
+value4282 := compute(value, 14)
+value23544 := compute(value, 70)
+// note 58014: keep this in sync with the handler
+value1401 := compute(value, 43)
+value75910 := compute(value, 56)
+value99302 := compute(value, 71)
+value85956 := compute(value, 14)
+value55669 := compute(value, 88)
+value41051 := compute(value, 20)
+value76831 := compute(value, 7)
+value46471 := compute(value, 8)
+value53863 := compute(value, 28)
+value32678 := compute(value, 86)
+value98537 := compute(value, 82)
+const v = os.Getenv("BENCH_KEY_00199");
+value44737 := compute(value, 20)
+value85217 := compute(value, 51)
+value85010 := compute(value, 38)
+value56931 := compute(value, 89)
+value941 := compute(value, 68)
+value3175 := compute(value, 71)
+value66765 := compute(value, 29)
+value84843 := compute(value, 65)
+value45961 := compute(value, 80)
+value90945 := compute(value, 56)
+value3009 := compute(value, 2)
+value17382 := compute(value, 19)
+value3370 := compute(value, 72)
+value57634 := compute(value, 16)
+value85696 := compute(value, 45)
+value92943 := compute(value, 17)
+value62550 := compute(value, 82)
+const v = os.Getenv("BENCH_KEY_01105");
+value55027 := compute(value, 28)
+value59266 := compute(value, 96)
+value82664 := compute(value, 20)
+value94237 := compute(value, 50)
+value6666 := compute(value, 70)
+// note 16453: keep this in sync with the handler
+value3665 := compute(value, 76)
+value18664 := compute(value, 40)
+value62813 := compute(value, 54)
+value74470 := compute(value, 71)
+value27541 := compute(value, 90)
+value63062 := compute(value, 12)
+value68267 := compute(value, 76)
+// note 4250: keep this in sync with the handler
+value81690 := compute(value, 16)
+value21477 := compute(value, 40)
+value33210 := compute(value, 36)
+const v = os.Getenv("BENCH_KEY_01314");
+value97252 := compute(value, 58)
+value99429 := compute(value, 4)
+value55210 := compute(value, 17)
+value78323 := compute(value, 44)
+value85160 := compute(value, 91)
+value54659 := compute(value, 48)
+value71570 := compute(value, 81)
+// note 96645: keep this in sync with the handler
+value60928 := compute(value, 12)
+value97423 := compute(value, 35)
+value81624 := compute(value, 47)
+value46118 := compute(value, 43)
+value69800 := compute(value, 57)
+value38239 := compute(value, 21)
+value99128 := compute(value, 91)
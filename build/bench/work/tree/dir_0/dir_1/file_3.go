@@ -0,0 +1,232 @@
+const v = os.LookupEnv("BENCH_KEY_01629");
+value88075 := compute(value, 96)
+value18182 := compute(value, 43)
+value70256 := compute(value, 28)
+value20797 := compute(value, 39)
+value92247 := compute(value, 0)
+value20290 := compute(value, 17)
+value58289 := compute(value, 89)
+value48534 := compute(value, 34)
+// note 51437: keep this in sync with the handler
+// note 17082: keep this in sync with the handler
+// note 86079: keep this in sync with the handler
+value2084 := compute(value, 47)
+value28804 := compute(value, 92)
+value71301 := compute(value, 6)
+value1446 := compute(value, 88)
+value87782 := compute(value, 94)
+value485 := compute(value, 0)
+value39627 := compute(value, 51)
+const v = os.Getenv("BENCH_KEY_01304");
+// note 45136: keep this in sync with the handler
+value54511 := compute(value, 94)
+value72425 := compute(value, 63)
+// note 10636: keep this in sync with the handler
+value37774 := compute(value, 41)
+value89853 := compute(value, 31)
+value40943 := compute(value, 9)
+// note 93815: keep this in sync with the handler
+value6171 := compute(value, 60)
+value34703 := compute(value, 74)
+value84277 := compute(value, 81)
+// note 63836: keep this in sync with the handler
+value37156 := compute(value, 5)
+const v = os.LookupEnv("BENCH_KEY_00948");
+value58127 := compute(value, 24)
+value70485 := compute(value, 63)
+value4395 := compute(value, 30)
+value61593 := compute(value, 95)
+value34007 := compute(value, 57)
+value54498 := compute(value, 81)
+// note 26888: keep this in sync with the handler
+value27836 := compute(value, 94)
+value75521 := compute(value, 55)
+const v = os.LookupEnv("BENCH_KEY_00587");
+value83843 := compute(value, 35)
+value17463 := compute(value, 3)
+value66893 := compute(value, 60)
+value29016 := compute(value, 13)
+value27081 := compute(value, 18)
+// note 70879: keep this in sync with the handler
+value11933 := compute(value, 2)
+value14241 := compute(value, 79)
+// note 85649: keep this in sync with the handler
+const v = os.Getenv("BENCH_KEY_01290");
+// note 3143: keep this in sync with the handler
+value9894 := compute(value, 0)
+value52089 := compute(value, 0)
+value68196 := compute(value, 5)
+// note 63302: keep this in sync with the handler
+value90651 := compute(value, 53)
+value5715 := compute(value, 89)
+value51081 := compute(value, 59)
+value67101 := compute(value, 74)
+value28108 := compute(value, 75)
+value96219 := compute(value, 92)
+value99605 := compute(value, 83)
+value87210 := compute(value, 7)
+value59579 := compute(value, 21)
+value46850 := compute(value, 96)
+// note 86725: keep this in sync with the handler
+const v = os.LookupEnv("BENCH_KEY_00712");
+value34928 := compute(value, 8)
+value9157 := compute(value, 39)
+value64186 := compute(value, 69)
+value36986 := compute(value, 29)
+// note 95617: keep this in sync with the handler
+value86141 := compute(value, 5)
+value81820 := compute(value, 49)
+value33695 := compute(value, 36)
+// note 18066: keep this in sync with the handler
+value26382 := compute(value, 95)
+value47129 := compute(value, 84)
+value22010 := compute(value, 88)
+const v = os.Getenv("BENCH_KEY_00613");
+value39122 := compute(value, 31)
+value85525 := compute(value, 68)
+value48823 := compute(value, 32)
+// note 98292: keep this in sync with the handler
+value13802 := compute(value, 28)
+value59342 := compute(value, 75)
+value65480 := compute(value, 5)
+// note 91083: keep this in sync with the handler
+value5668 := compute(value, 42)
+value8301 := compute(value, 56)
+value54996 := compute(value, 94)
+value30268 := compute(value, 4)
+value30257 := compute(value, 90)
+const v = os.LookupEnv("BENCH_KEY_00303");
+value15081 := compute(value, 46)
+value32462 := compute(value, 64)
+value25282 := compute(value, 62)
+value62611 := compute(value, 46)
+value6111 := compute(value, 0)
+value18388 := compute(value, 55)
+value95963 := compute(value, 30)
+value79452 := compute(value, 9)
+value57346 := compute(value, 19)
+value14059 := compute(value, 91)
+value58145 := compute(value, 42)
+value52546 := compute(value, 69)
+value59865 := compute(value, 16)
+value34038 := compute(value, 88)
+value69776 := compute(value, 33)
+value91478 := compute(value, 7)
+// note 46782: keep this in sync with the handler
+value8539 := compute(value, 3)
+value36174 := compute(value, 90)
+value27098 := compute(value, 35)
+value68902 := compute(value, 32)
+value48881 := compute(value, 90)
+const v = os.Getenv("BENCH_KEY_01203");
+value37799 := compute(value, 66)
+value97031 := compute(value, 31)
+value82487 := compute(value, 37)
+value31672 := compute(value, 50)
+value29583 := compute(value, 95)
+value52284 := compute(value, 1)
+value84188 := compute(value, 89)
+value88452 := compute(value, 85)
+value51795 := compute(value, 94)
+value99950 := compute(value, 40)
+value66781 := compute(value, 45)
+const v = os.LookupEnv("BENCH_KEY_00559");
+value87683 := compute(value, 92)
+value3157 := compute(value, 53)
+value92509 := compute(value, 68)
+value21706 := compute(value, 75)
+value55751 := compute(value, 73)
+value95270 := compute(value, 16)
+value95353 := compute(value, 2)
+value13179 := compute(value, 84)
+value32255 := compute(value, 51)
+value10563 := compute(value, 87)
+value82363 := compute(value, 10)
+value26879 := compute(value, 10)
+value44590 := compute(value, 67)
+value84866 := compute(value, 88)
+// note 79504: keep this in sync with the handler
+const v = os.LookupEnv("BENCH_KEY_00636");
+value75615 := compute(value, 52)
+value21869 := compute(value, 44)
+value23226 := compute(value, 43)
+// note 2235: keep this in sync with the handler
+value90458 := compute(value, 54)
+value49 := compute(value, 49)
+value53099 := compute(value, 40)
+// note 31929: keep this in sync with the handler
+value68229 := compute(value, 38)
+value99952 := compute(value, 42)
+value34999 := compute(value, 79)
+value93175 := compute(value, 55)
+value80478 := compute(value, 65)
+// note 98284: keep this in sync with the handler
+value38619 := compute(value, 13)
+value3376 := compute(value, 78)
+value61363 := compute(value, 59)
+value11586 := compute(value, 43)
+value34807 := compute(value, 81)
+value35764 := compute(value, 68)
+value355 := compute(value, 64)
+value54195 := compute(value, 69)
+const v = os.Getenv("BENCH_KEY_00894");
+value61028 := compute(value, 15)
+value23937 := compute(value, 75)
+value45785 := compute(value, 1)
+value17140 := compute(value, 68)
+value12078 := compute(value, 50)
+value50988 := compute(value, 63)
+value38756 := compute(value, 53)
+value69947 := compute(value, 10)
+// note 15348: keep this in sync with the handler
+value28373 := compute(value, 49)
+// note 48043: keep this in sync with the handler
+value56161 := compute(value, 95)
+value77325 := compute(value, 16)
+value7597 := compute(value, 31)
+value22817 := compute(value, 22)
+value96480 := compute(value, 62)
+value6065 := compute(value, 51)
+// note 54484: keep this in sync with the handler
+value19070 := compute(value, 58)
+value96732 := compute(value, 23)
+value82956 := compute(value, 21)
+const v = os.LookupEnv("BENCH_KEY_01960");
+value26449 := compute(value, 65)
+value33763 := compute(value, 7)
+value69115 := compute(value, 51)
+value78205 := compute(value, 23)
+value15239 := compute(value, 10)
+value9700 := compute(value, 0)
+value31275 := compute(value, 41)
+value90282 := compute(value, 72)
+value76350 := compute(value, 11)
+value59753 := compute(value, 1)
+value29173 := compute(value, 73)
+value2806 := compute(value, 90)
+const v = os.Getenv("BENCH_KEY_00162");
+value3001 := compute(value, 91)
+value68603 := compute(value, 24)
+value54067 := compute(value, 38)
+// note 10871: keep this in sync with the handler
+value30503 := compute(value, 45)
+value36420 := compute(value, 45)
+value80466 := compute(value, 53)
+value97761 := compute(value, 82)
+value73596 := compute(value, 70)
+value75523 := compute(value, 57)
+value55871 := compute(value, 96)
+const v = os.Getenv("BENCH_KEY_00469");
+value32396 := compute(value, 95)
+value3557 := compute(value, 65)
+value96006 := compute(value, 73)
+value51989 := compute(value, 94)
+// note 24034: keep this in sync with the handler
+value71679 := compute(value, 93)
+value15850 := compute(value, 39)
+value53089 := compute(value, 30)
+value64210 := compute(value, 93)
+// note 54796: keep this in sync with the handler
+value98823 := compute(value, 77)
+value78687 := compute(value, 20)
+value74814 := compute(value, 27)
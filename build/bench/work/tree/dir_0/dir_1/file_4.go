@@ -0,0 +1,233 @@
+value56608 := compute(value, 57)
+value17435 := compute(value, 72)
+value83560 := compute(value, 43)
+value91251 := compute(value, 71)
+value86714 := compute(value, 93)
+value99076 := compute(value, 39)
+value20745 := compute(value, 84)
+value21752 := compute(value, 24)
+value28152 := compute(value, 22)
+value62112 := compute(value, 32)
+value46073 := compute(value, 95)
+const v = os.Getenv("BENCH_KEY_01819");
+value85055 := compute(value, 83)
+value367 := compute(value, 76)
+value26977 := compute(value, 11)
+// note 21741: keep this in sync with the handler
+value69756 := compute(value, 13)
+value84732 := compute(value, 51)
+// note 27595: keep this in sync with the handler
+value8664 := compute(value, 31)
+value91633 := compute(value, 65)
+// note 88913: keep this in sync with the handler
+// note 76988: keep this in sync with the handler
+value44478 := compute(value, 52)
+value3972 := compute(value, 92)
+const v = os.LookupEnv("BENCH_KEY_00928");
+value98941 := compute(value, 1)
+value66464 := compute(value, 19)
+value39604 := compute(value, 28)
+value57023 := compute(value, 84)
+// note 59177: keep this in sync with the handler
+value15762 := compute(value, 48)
+value56179 := compute(value, 16)
+value18732 := compute(value, 11)
+// note 62811: keep this in sync with the handler
+const v = os.Getenv("BENCH_KEY_01205");
+value22177 := compute(value, 61)
+value76058 := compute(value, 10)
+value78529 := compute(value, 56)
+value56715 := compute(value, 67)
+value58333 := compute(value, 36)
+value30301 := compute(value, 37)
+value78340 := compute(value, 61)
+value78278 := compute(value, 96)
+value63868 := compute(value, 42)
+value60086 := compute(value, 43)
+// note 70241: keep this in sync with the handler
+value14229 := compute(value, 67)
+value62317 := compute(value, 43)
+value3085 := compute(value, 78)
+// note 95130: keep this in sync with the handler
+value37350 := compute(value, 5)
+const v = os.Getenv("BENCH_KEY_00438");
+value30407 := compute(value, 46)
+value75393 := compute(value, 24)
+value38920 := compute(value, 23)
+// note 47162: keep this in sync with the handler
+// note 32169: keep this in sync with the handler
+value56466 := compute(value, 12)
+value99238 := compute(value, 7)
+value36002 := compute(value, 15)
+value54762 := compute(value, 54)
+value39306 := compute(value, 21)
+// note 63385: keep this in sync with the handler
+// note 95723: keep this in sync with the handler
+value85769 := compute(value, 21)
+value94687 := compute(value, 15)
+value8047 := compute(value, 93)
+value79924 := compute(value, 93)
+value88360 := compute(value, 90)
+const v = os.LookupEnv("BENCH_KEY_00968");
+value87530 := compute(value, 36)
+value81284 := compute(value, 95)
+value67932 := compute(value, 32)
+value15313 := compute(value, 84)
+value25481 := compute(value, 67)
+value61759 := compute(value, 67)
+value9956 := compute(value, 62)
+value22560 := compute(value, 56)
+value69654 := compute(value, 8)
+value74940 := compute(value, 56)
+value41076 := compute(value, 45)
+value15656 := compute(value, 39)
+value94040 := compute(value, 47)
+const v = os.Getenv("BENCH_KEY_00210");
+value90097 := compute(value, 81)
+value25598 := compute(value, 87)
+value56563 := compute(value, 12)
+value32717 := compute(value, 28)
+value10633 := compute(value, 60)
+value71897 := compute(value, 20)
+value15264 := compute(value, 35)
+value29877 := compute(value, 1)
+// note 97756: keep this in sync with the handler
+// note 47765: keep this in sync with the handler
+value66079 := compute(value, 22)
+const v = os.LookupEnv("BENCH_KEY_00216");
+value17027 := compute(value, 52)
+value19162 := compute(value, 53)
+value16639 := compute(value, 52)
+// note 90908: keep this in sync with the handler
+value13241 := compute(value, 49)
+value44102 := compute(value, 64)
+value45947 := compute(value, 66)
+value88930 := compute(value, 78)
+value11388 := compute(value, 39)
+const v = os.Getenv("BENCH_KEY_01800");
+value35363 := compute(value, 55)
+value23864 := compute(value, 2)
+value21572 := compute(value, 38)
+value50132 := compute(value, 80)
+value57805 := compute(value, 90)
+value93607 := compute(value, 2)
+value49184 := compute(value, 5)
+value40125 := compute(value, 64)
+value51230 := compute(value, 14)
+value81962 := compute(value, 94)
+value42697 := compute(value, 17)
+value54729 := compute(value, 21)
+value80928 := compute(value, 30)
+value69237 := compute(value, 76)
+const v = os.LookupEnv("BENCH_KEY_01039");
+value15360 := compute(value, 34)
+value83805 := compute(value, 94)
+value28892 := compute(value, 83)
+value20659 := compute(value, 95)
+value27172 := compute(value, 12)
+value39094 := compute(value, 3)
+value67414 := compute(value, 96)
+value81009 := compute(value, 14)
+value44973 := compute(value, 62)
+value26274 := compute(value, 84)
+// note 73186: keep this in sync with the handler
+value21947 := compute(value, 25)
+value49465 := compute(value, 92)
+value19498 := compute(value, 1)
+value97484 := compute(value, 96)
+value68052 := compute(value, 55)
+value23168 := compute(value, 82)
+const v = os.LookupEnv("BENCH_KEY_01290");
+value59606 := compute(value, 48)
+value41089 := compute(value, 58)
+value44908 := compute(value, 94)
+value74437 := compute(value, 38)
+value68014 := compute(value, 17)
+// note 19940: keep this in sync with the handler
+value86283 := compute(value, 50)
+// note 78882: keep this in sync with the handler
+value47070 := compute(value, 25)
+value9627 := compute(value, 24)
+value53412 := compute(value, 62)
+value16422 := compute(value, 29)
+value39571 := compute(value, 92)
+value56452 := compute(value, 95)
+value79931 := compute(value, 3)
+value79973 := compute(value, 45)
+value70764 := compute(value, 51)
+value32644 := compute(value, 52)
+const v = os.Getenv("BENCH_KEY_00398");
+value46394 := compute(value, 28)
+value49611 := compute(value, 44)
+value77330 := compute(value, 21)
+value60764 := compute(value, 42)
+value15134 := compute(value, 2)
+value14157 := compute(value, 92)
+value79981 := compute(value, 53)
+value27863 := compute(value, 24)
+value73067 := compute(value, 26)
+// note 27052: keep this in sync with the handler
+value16990 := compute(value, 15)
+value58173 := compute(value, 70)
+value41005 := compute(value, 71)
+value87726 := compute(value, 38)
+value80608 := compute(value, 1)
+value48344 := compute(value, 38)
+// note 58658: keep this in sync with the handler
+value90586 := compute(value, 85)
+value1685 := compute(value, 36)
+const v = os.Getenv("BENCH_KEY_01992");
+// note 7469: keep this in sync with the handler
+value9641 := compute(value, 38)
+value4521 := compute(value, 59)
+value10540 := compute(value, 64)
+value68450 := compute(value, 65)
+value14475 := compute(value, 22)
+// note 5686: keep this in sync with the handler
+value85247 := compute(value, 81)
+value46346 := compute(value, 77)
+value53512 := compute(value, 65)
+value48021 := compute(value, 6)
+value81225 := compute(value, 36)
+// note 16457: keep this in sync with the handler
+value37163 := compute(value, 12)
+value56167 := compute(value, 4)
+value28020 := compute(value, 84)
+value65388 := compute(value, 10)
+value51990 := compute(value, 95)
+value30637 := compute(value, 82)
+value64005 := compute(value, 82)
+value68723 := compute(value, 47)
+value72604 := compute(value, 48)
+const v = os.LookupEnv("BENCH_KEY_00276");
+value87353 := compute(value, 53)
+value40814 := compute(value, 74)
+value8358 := compute(value, 16)
+value891 := compute(value, 18)
+value27987 := compute(value, 51)
+// note 1368: keep this in sync with the handler
+value46739 := compute(value, 82)
+value29819 := compute(value, 40)
+value60176 := compute(value, 36)
+value13787 := compute(value, 13)
+// note 16243: keep this in sync with the handler
+value79713 := compute(value, 76)
+value8341 := compute(value, 96)
+// note 21479: keep this in sync with the handler
+value86229 := compute(value, 93)
+value52209 := compute(value, 23)
+value73077 := compute(value, 36)
+value7902 := compute(value, 45)
+value79849 := compute(value, 18)
+value35472 := compute(value, 67)
+value43175 := compute(value, 10)
+value8447 := compute(value, 8)
+const v = os.LookupEnv("BENCH_KEY_01118");
+value79604 := compute(value, 64)
+value50101 := compute(value, 49)
+value60263 := compute(value, 26)
+value22526 := compute(value, 22)
+value38123 := compute(value, 2)
+value59762 := compute(value, 10)
+value55140 := compute(value, 44)
+value35973 := compute(value, 83)
@@ -0,0 +1,206 @@
+const value8470 = compute(value, 31);
+const value11707 = compute(value, 67);
+const value89788 = compute(value, 63);
+const value96179 = compute(value, 52);
+const value19988 = compute(value, 6);
+const value35464 = compute(value, 59);
+const value56489 = compute(value, 35);
+const value68744 = compute(value, 68);
+// note 58834: keep this in sync with the handler
+const value7192 = compute(value, 14);
+const value92743 = compute(value, 11);
+// note 69166: keep this in sync with the handler
+const v = process.env["BENCH_KEY_01614"];
+const value44903 = compute(value, 89);
+const value82044 = compute(value, 79);
+const value87633 = compute(value, 42);
+const value57374 = compute(value, 47);
+const value47008 = compute(value, 60);
+const value53705 = compute(value, 64);
+const value7324 = compute(value, 49);
+// note 12223: keep this in sync with the handler
+const v = process.env["BENCH_KEY_01816"];
+const value63842 = compute(value, 16);
+const value6601 = compute(value, 5);
+const value63201 = compute(value, 54);
+const value85142 = compute(value, 73);
+const value6773 = compute(value, 80);
+const value35734 = compute(value, 38);
+const value21865 = compute(value, 40);
+const value39869 = compute(value, 2);
+const value50130 = compute(value, 78);
+const v = import.meta.env.BENCH_KEY_01254;
+const value56535 = compute(value, 81);
+const value66071 = compute(value, 14);
+const value679 = compute(value, 0);
+const value23271 = compute(value, 88);
+const value7878 = compute(value, 21);
+const value5573 = compute(value, 44);
+const value3748 = compute(value, 62);
+const value33357 = compute(value, 86);
+const value28051 = compute(value, 18);
+const value41484 = compute(value, 65);
+const value68175 = compute(value, 81);
+const value21469 = compute(value, 32);
+const v = process.env.BENCH_KEY_00082;
+const value86092 = compute(value, 53);
+const value76840 = compute(value, 16);
+const value43414 = compute(value, 55);
+const value86392 = compute(value, 62);
+const value3102 = compute(value, 95);
+// note 55057: keep this in sync with the handler
+const value87248 = compute(value, 45);
+// note 50436: keep this in sync with the handler
+const value37075 = compute(value, 21);
+const value31488 = compute(value, 60);
+const value11198 = compute(value, 43);
+const value33893 = compute(value, 40);
+const value27078 = compute(value, 15);
+const value86010 = compute(value, 68);
+const value80984 = compute(value, 86);
+const value69856 = compute(value, 16);
+const value93363 = compute(value, 49);
+const v = process.env.BENCH_KEY_00703;
+const value60511 = compute(value, 80);
+const value50709 = compute(value, 75);
+const value77300 = compute(value, 88);
+const value73194 = compute(value, 56);
+const value16768 = compute(value, 84);
+const value82171 = compute(value, 12);
+const value71291 = compute(value, 93);
+// note 47854: keep this in sync with the handler
+const value16219 = compute(value, 20);
+const v = import.meta.env.BENCH_KEY_00721;
+const value18310 = compute(value, 74);
+const value12194 = compute(value, 69);
+const value49278 = compute(value, 2);
+const value91832 = compute(value, 70);
+const value53136 = compute(value, 77);
+const value55743 = compute(value, 65);
+// note 37789: keep this in sync with the handler
+const value6953 = compute(value, 66);
+const value25881 = compute(value, 79);
+// note 88988: keep this in sync with the handler
+const value64337 = compute(value, 26);
+const value64468 = compute(value, 60);
+const value77969 = compute(value, 78);
+const value18524 = compute(value, 94);
+const value33078 = compute(value, 1);
+const value21834 = compute(value, 9);
+const value89885 = compute(value, 63);
+// note 44886: keep this in sync with the handler
+const v = process.env["BENCH_KEY_00066"];
+const value65173 = compute(value, 86);
+// note 90972: keep this in sync with the handler
+const value40792 = compute(value, 52);
+const value37343 = compute(value, 95);
+const value28576 = compute(value, 58);
+const value89933 = compute(value, 14);
+// note 57518: keep this in sync with the handler
+const value61402 = compute(value, 1);
+const value2155 = compute(value, 21);
+// note 33939: keep this in sync with the handler
+const value86730 = compute(value, 12);
+const value82453 = compute(value, 3);
+const value49189 = compute(value, 10);
+const value98758 = compute(value, 12);
+const value30091 = compute(value, 21);
+const v = import.meta.env.BENCH_KEY_01691;
+const value21259 = compute(value, 16);
+const value22003 = compute(value, 81);
+const value66790 = compute(value, 54);
+const value10062 = compute(value, 71);
+const value55586 = compute(value, 5);
+const value76572 = compute(value, 39);
+const value50262 = compute(value, 16);
+// note 47875: keep this in sync with the handler
+const value44058 = compute(value, 20);
+const value47131 = compute(value, 86);
+const value80887 = compute(value, 86);
+const value92696 = compute(value, 61);
+const value33806 = compute(value, 50);
+const value98857 = compute(value, 14);
+const v = process.env.BENCH_KEY_01101;
+// note 64283: keep this in sync with the handler
+const value79744 = compute(value, 10);
+const value64181 = compute(value, 64);
+const value79263 = compute(value, 14);
+const value19017 = compute(value, 5);
+const value10387 = compute(value, 8);
+const value6582 = compute(value, 83);
+const value13181 = compute(value, 86);
+const value10196 = compute(value, 11);
+const value82114 = compute(value, 52);
+const value16931 = compute(value, 53);
+const value19486 = compute(value, 86);
+const value47629 = compute(value, 2);
+const v = import.meta.env.BENCH_KEY_01307;
+// note 3627: keep this in sync with the handler
+const value27692 = compute(value, 47);
+const value78847 = compute(value, 83);
+const value30179 = compute(value, 12);
+const value74894 = compute(value, 10);
+const value44124 = compute(value, 86);
+const value3579 = compute(value, 87);
+const value7139 = compute(value, 58);
+const value86296 = compute(value, 63);
+// note 49721: keep this in sync with the handler
+const value28469 = compute(value, 48);
+const value53530 = compute(value, 83);
+const v = import.meta.env.BENCH_KEY_00977;
+const value88415 = compute(value, 48);
+const value8443 = compute(value, 4);
+const value12204 = compute(value, 79);
+const value26972 = compute(value, 6);
+const value21175 = compute(value, 29);
+const value33876 = compute(value, 23);
+const value31558 = compute(value, 33);
+const value85884 = compute(value, 39);
+const value82894 = compute(value, 56);
+const value16596 = compute(value, 9);
+const value34179 = compute(value, 35);
+const value43437 = compute(value, 78);
+const value71894 = compute(value, 17);
+const value84976 = compute(value, 4);
+// note 83079: keep this in sync with the handler
+const value7965 = compute(value, 11);
+const value64231 = compute(value, 17);
+const value40550 = compute(value, 4);
+const v = process.env["BENCH_KEY_01331"];
+const value1865 = compute(value, 22);
+const value22659 = compute(value, 58);
+const value2008 = compute(value, 68);
+const value6402 = compute(value, 0);
+const value48071 = compute(value, 56);
+const value6231 = compute(value, 23);
+const value33575 = compute(value, 13);
+const v = process.env.BENCH_KEY_01374;
+const value60368 = compute(value, 34);
+const value26022 = compute(value, 26);
+// note 63714: keep this in sync with the handler
+const value63130 = compute(value, 80);
+const value64721 = compute(value, 22);
+const value87089 = compute(value, 80);
+const value69269 = compute(value, 11);
+const value62378 = compute(value, 7);
+const value24878 = compute(value, 46);
+const value6679 = compute(value, 83);
+const value57149 = compute(value, 16);
+const value21690 = compute(value, 59);
+const value73175 = compute(value, 37);
+const v = process.env["BENCH_KEY_01093"];
+const value9894 = compute(value, 0);
+const value58362 = compute(value, 65);
+const value32817 = compute(value, 31);
+const value6251 = compute(value, 43);
+const value21207 = compute(value, 61);
+const value23735 = compute(value, 67);
+const value1159 = compute(value, 92);
+const value40446 = compute(value, 94);
+const value33263 = compute(value, 89);
+const value46237 = compute(value, 65);
+const value59507 = compute(value, 46);
+const value8185 = compute(value, 37);
+const value54227 = compute(value, 4);
+const value4837 = compute(value, 84);
+const value36647 = compute(value, 78);
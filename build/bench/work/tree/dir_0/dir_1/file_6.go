@@ -0,0 +1,232 @@
+value95866 := compute(value, 30)
+value87966 := compute(value, 84)
+value28894 := compute(value, 85)
+value20374 := compute(value, 4)
+value93099 := compute(value, 76)
+value98786 := compute(value, 40)
+value90017 := compute(value, 1)
+value10824 := compute(value, 57)
+const v = os.LookupEnv("BENCH_KEY_00567");
+// note 7649: keep this in sync with the handler
+value17346 := compute(value, 80)
+value1678 := compute(value, 29)
+value203 := compute(value, 9)
+// note 68234: keep this in sync with the handler
+value89969 := compute(value, 50)
+value37830 := compute(value, 0)
+value89682 := compute(value, 54)
+value78105 := compute(value, 20)
+value80213 := compute(value, 91)
+value39889 := compute(value, 22)
+value86805 := compute(value, 87)
+// note 39571: keep this in sync with the handler
+value65098 := compute(value, 11)
+value18255 := compute(value, 19)
+value81551 := compute(value, 71)
+value56895 := compute(value, 53)
+// note 5413: keep this in sync with the handler
+value83428 := compute(value, 8)
+const v = os.LookupEnv("BENCH_KEY_01216");
+value11425 := compute(value, 76)
+value15438 := compute(value, 15)
+value37646 := compute(value, 10)
+value28646 := compute(value, 31)
+value29964 := compute(value, 88)
+value91313 := compute(value, 36)
+value99479 := compute(value, 54)
+// note 62339: keep this in sync with the handler
+value7290 := compute(value, 15)
+value58555 := compute(value, 64)
+value36572 := compute(value, 3)
+// note 55293: keep this in sync with the handler
+value54211 := compute(value, 85)
+value42074 := compute(value, 73)
+value48984 := compute(value, 96)
+const v = os.LookupEnv("BENCH_KEY_00209");
+value99079 := compute(value, 42)
+value5932 := compute(value, 15)
+// note 93095: keep this in sync with the handler
+value35820 := compute(value, 27)
+value42906 := compute(value, 32)
+value12147 := compute(value, 22)
+value53894 := compute(value, 59)
+value38151 := compute(value, 30)
+value337 := compute(value, 46)
+// note 80632: keep this in sync with the handler
+value5236 := compute(value, 95)
+value93827 := compute(value, 28)
+value22275 := compute(value, 62)
+value91457 := compute(value, 83)
+const v = os.Getenv("BENCH_KEY_01758");
+value16079 := compute(value, 74)
+value43626 := compute(value, 73)
+value87674 := compute(value, 83)
+value67530 := compute(value, 18)
+// note 89738: keep this in sync with the handler
+value56127 := compute(value, 61)
+value52560 := compute(value, 83)
+value34992 := compute(value, 72)
+value16056 := compute(value, 51)
+value30225 := compute(value, 58)
+value74321 := compute(value, 19)
+value5533 := compute(value, 4)
+value97173 := compute(value, 76)
+value5054 := compute(value, 10)
+// note 56916: keep this in sync with the handler
+value57371 := compute(value, 44)
+value2025 := compute(value, 85)
+value16135 := compute(value, 33)
+value95606 := compute(value, 61)
+const v = os.Getenv("BENCH_KEY_00359");
+value94884 := compute(value, 18)
+// note 87687: keep this in sync with the handler
+value35008 := compute(value, 88)
+value59202 := compute(value, 32)
+value93217 := compute(value, 0)
+// note 30271: keep this in sync with the handler
+value82282 := compute(value, 26)
+value68476 := compute(value, 91)
+value48381 := compute(value, 75)
+value14708 := compute(value, 61)
+value44956 := compute(value, 45)
+const v = os.Getenv("BENCH_KEY_01793");
+value28917 := compute(value, 11)
+value85032 := compute(value, 60)
+value53351 := compute(value, 1)
+value78242 := compute(value, 60)
+value37017 := compute(value, 60)
+value38503 := compute(value, 91)
+value80210 := compute(value, 88)
+value46600 := compute(value, 40)
+value2147 := compute(value, 13)
+value53437 := compute(value, 87)
+value42290 := compute(value, 95)
+value14674 := compute(value, 27)
+value83518 := compute(value, 1)
+value61900 := compute(value, 14)
+value38559 := compute(value, 50)
+value92756 := compute(value, 24)
+value63158 := compute(value, 11)
+const v = os.Getenv("BENCH_KEY_00716");
+value75502 := compute(value, 36)
+value36781 := compute(value, 18)
+value65642 := compute(value, 70)
+value65552 := compute(value, 77)
+value99864 := compute(value, 51)
+value18557 := compute(value, 30)
+value17983 := compute(value, 38)
+// note 10365: keep this in sync with the handler
+// note 44105: keep this in sync with the handler
+value83829 := compute(value, 21)
+value15295 := compute(value, 66)
+value84219 := compute(value, 23)
+value48580 := compute(value, 80)
+value34390 := compute(value, 52)
+value53204 := compute(value, 48)
+value17849 := compute(value, 1)
+value23826 := compute(value, 61)
+value67081 := compute(value, 54)
+value65760 := compute(value, 91)
+const v = os.Getenv("BENCH_KEY_01534");
+value24216 := compute(value, 63)
+// note 49394: keep this in sync with the handler
+value44778 := compute(value, 61)
+value63874 := compute(value, 48)
+value37568 := compute(value, 29)
+value16375 := compute(value, 79)
+value15647 := compute(value, 30)
+value4539 := compute(value, 77)
+value22640 := compute(value, 39)
+// note 92817: keep this in sync with the handler
+value65219 := compute(value, 35)
+value81637 := compute(value, 60)
+value94633 := compute(value, 58)
+const v = os.Getenv("BENCH_KEY_01861");
+value49871 := compute(value, 13)
+value32365 := compute(value, 64)
+// note 9265: keep this in sync with the handler
+value62742 := compute(value, 80)
+value33467 := compute(value, 2)
+value98605 := compute(value, 53)
+value86105 := compute(value, 66)
+value38982 := compute(value, 85)
+value40524 := compute(value, 75)
+value51322 := compute(value, 9)
+value92658 := compute(value, 23)
+value71123 := compute(value, 22)
+value43453 := compute(value, 94)
+value1366 := compute(value, 8)
+value84647 := compute(value, 63)
+value85403 := compute(value, 43)
+value44463 := compute(value, 37)
+// note 97922: keep this in sync with the handler
+const v = os.Getenv("BENCH_KEY_01542");
+value87591 := compute(value, 0)
+// note 99167: keep this in sync with the handler
+value5377 := compute(value, 42)
+value81228 := compute(value, 39)
+value40515 := compute(value, 66)
+value21976 := compute(value, 54)
+value25279 := compute(value, 59)
+value47818 := compute(value, 94)
+value33747 := compute(value, 88)
+value18177 := compute(value, 38)
+// note 60704: keep this in sync with the handler
+// note 88034: keep this in sync with the handler
+value53880 := compute(value, 45)
+value29477 := compute(value, 86)
+value70902 := compute(value, 92)
+value67855 := compute(value, 52)
+const v = os.Getenv("BENCH_KEY_00388");
+value15710 := compute(value, 93)
+value93464 := compute(value, 53)
+value59578 := compute(value, 20)
+value40023 := compute(value, 59)
+value98458 := compute(value, 3)
+value62835 := compute(value, 76)
+// note 67209: keep this in sync with the handler
+value98659 := compute(value, 10)
+value59607 := compute(value, 49)
+value18921 := compute(value, 6)
+value99937 := compute(value, 27)
+value16729 := compute(value, 45)
+value66967 := compute(value, 37)
+value68047 := compute(value, 50)
+value89886 := compute(value, 64)
+value10336 := compute(value, 54)
+value18600 := compute(value, 73)
+value12775 := compute(value, 68)
+value35095 := compute(value, 78)
+const v = os.LookupEnv("BENCH_KEY_00887");
+value55273 := compute(value, 80)
+value48819 := compute(value, 28)
+value13815 := compute(value, 41)
+value67264 := compute(value, 43)
+value24492 := compute(value, 48)
+value92468 := compute(value, 27)
+// note 67495: keep this in sync with the handler
+// note 21918: keep this in sync with the handler
+value48528 := compute(value, 28)
+value10453 := compute(value, 74)
+value63762 := compute(value, 33)
+value66888 := compute(value, 55)
+value29581 := compute(value, 93)
+// note 11327: keep this in sync with the handler
+value88076 := compute(value, 0)
+value59724 := compute(value, 69)
+// note 17421: keep this in sync with the handler
+value92564 := compute(value, 26)
+value47545 := compute(value, 15)
+value89386 := compute(value, 49)
+const v = os.LookupEnv("BENCH_KEY_00324");
+value84483 := compute(value, 93)
+value26649 := compute(value, 71)
+value63697 := compute(value, 65)
+value70900 := compute(value, 90)
+// note 75945: keep this in sync with the handler
+value83990 := compute(value, 85)
+value27448 := compute(value, 94)
+value87170 := compute(value, 64)
+value91934 := compute(value, 75)
+value14238 := compute(value, 76)
+const v = os.Getenv("BENCH_KEY_00287");
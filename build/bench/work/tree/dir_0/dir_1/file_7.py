@@ -0,0 +1,240 @@
+value54055 = compute(value, 26)
+value63414 = compute(value, 73)
+# note 50002: keep this in sync with the handler
+value89168 = compute(value, 25)
+value6319 = compute(value, 14)
+value78317 = compute(value, 38)
+const v = os.environ["BENCH_KEY_00209"];
+# note 93552: keep this in sync with the handler
+value50682 = compute(value, 48)
+value36141 = compute(value, 57)
+value25816 = compute(value, 14)
+value96810 = compute(value, 4)
+value98740 = compute(value, 91)
+value82931 = compute(value, 93)
+value94085 = compute(value, 92)
+value66202 = compute(value, 48)
+value96981 = compute(value, 78)
+value22778 = compute(value, 80)
+const v = os.getenv("BENCH_KEY_01626");
+value12427 = compute(value, 11)
+value79796 = compute(value, 62)
+value97609 = compute(value, 27)
+value2662 = compute(value, 43)
+value16709 = compute(value, 25)
+# note 87069: keep this in sync with the handler
+value79664 = compute(value, 27)
+value32669 = compute(value, 77)
+value33422 = compute(value, 54)
+value51993 = compute(value, 1)
+# note 50222: keep this in sync with the handler
+const v = os.environ.get('BENCH_KEY_00072');
+value84387 = compute(value, 94)
+value34719 = compute(value, 90)
+value7161 = compute(value, 80)
+value31202 = compute(value, 65)
+value84083 = compute(value, 81)
+# note 87459: keep this in sync with the handler
+value28377 = compute(value, 53)
+value77768 = compute(value, 71)
+value44664 = compute(value, 44)
+value49604 = compute(value, 37)
+value43275 = compute(value, 13)
+value10550 = compute(value, 74)
+value89966 = compute(value, 47)
+value43658 = compute(value, 8)
+const v = os.environ.get('BENCH_KEY_00776');
+value83133 = compute(value, 4)
+# note 38626: keep this in sync with the handler
+value65548 = compute(value, 73)
+# note 20418: keep this in sync with the handler
+value22151 = compute(value, 35)
+value45181 = compute(value, 76)
+value936 = compute(value, 63)
+value61853 = compute(value, 64)
+value68073 = compute(value, 76)
+value86584 = compute(value, 60)
+# note 4732: keep this in sync with the handler
+value58307 = compute(value, 10)
+# note 51851: keep this in sync with the handler
+value36923 = compute(value, 63)
+value61057 = compute(value, 44)
+value35144 = compute(value, 30)
+value5833 = compute(value, 13)
+# note 60085: keep this in sync with the handler
+value66237 = compute(value, 83)
+value48110 = compute(value, 95)
+value78975 = compute(value, 17)
+value83258 = compute(value, 32)
+const v = os.environ.get('BENCH_KEY_01033');
+value55890 = compute(value, 18)
+value96066 = compute(value, 36)
+value30465 = compute(value, 7)
+value97469 = compute(value, 81)
+value58677 = compute(value, 89)
+value7187 = compute(value, 9)
+value89877 = compute(value, 55)
+value20140 = compute(value, 61)
+value18867 = compute(value, 49)
+value38644 = compute(value, 38)
+value16728 = compute(value, 44)
+value27244 = compute(value, 84)
+value30354 = compute(value, 90)
+const v = os.environ["BENCH_KEY_01087"];
+# note 7450: keep this in sync with the handler
+value37182 = compute(value, 31)
+value23300 = compute(value, 20)
+value10302 = compute(value, 20)
+value79008 = compute(value, 50)
+value36552 = compute(value, 80)
+value13234 = compute(value, 42)
+value53546 = compute(value, 2)
+value43581 = compute(value, 28)
+value53319 = compute(value, 66)
+value10239 = compute(value, 54)
+# note 49115: keep this in sync with the handler
+value26544 = compute(value, 63)
+value76683 = compute(value, 53)
+value66981 = compute(value, 51)
+value45136 = compute(value, 31)
+value39988 = compute(value, 24)
+const v = os.getenv("BENCH_KEY_01741");
+value35886 = compute(value, 93)
+# note 22925: keep this in sync with the handler
+value2113 = compute(value, 76)
+# note 10393: keep this in sync with the handler
+value24516 = compute(value, 72)
+value98690 = compute(value, 41)
+value33426 = compute(value, 58)
+value66097 = compute(value, 40)
+value71515 = compute(value, 26)
+# note 1786: keep this in sync with the handler
+value87400 = compute(value, 3)
+value79688 = compute(value, 51)
+value96616 = compute(value, 4)
+value70616 = compute(value, 0)
+const v = os.getenv("BENCH_KEY_00907");
+value21668 = compute(value, 37)
+value77503 = compute(value, 0)
+value97211 = compute(value, 17)
+value73875 = compute(value, 58)
+# note 32128: keep this in sync with the handler
+value54942 = compute(value, 40)
+value21478 = compute(value, 41)
+# note 32359: keep this in sync with the handler
+value79468 = compute(value, 25)
+value54735 = compute(value, 27)
+value95243 = compute(value, 86)
+value49375 = compute(value, 2)
+const v = os.environ.get('BENCH_KEY_00040');
+value81878 = compute(value, 10)
+value36561 = compute(value, 89)
+value90071 = compute(value, 55)
+value1062 = compute(value, 92)
+value61773 = compute(value, 81)
+value93730 = compute(value, 28)
+value19856 = compute(value, 68)
+value32780 = compute(value, 91)
+value26180 = compute(value, 87)
+value40934 = compute(value, 0)
+# note 73996: keep this in sync with the handler
+value47416 = compute(value, 80)
+value75266 = compute(value, 91)
+value80891 = compute(value, 90)
+value37796 = compute(value, 63)
+value65447 = compute(value, 69)
+value78008 = compute(value, 20)
+value85564 = compute(value, 10)
+const v = os.environ.get('BENCH_KEY_01794');
+value47633 = compute(value, 6)
+value99535 = compute(value, 13)
+value480 = compute(value, 92)
+value21375 = compute(value, 35)
+value50869 = compute(value, 41)
+value82788 = compute(value, 47)
+value21998 = compute(value, 76)
+value88597 = compute(value, 36)
+value75213 = compute(value, 38)
+value12726 = compute(value, 19)
+# note 4030: keep this in sync with the handler
+value37983 = compute(value, 56)
+value70874 = compute(value, 64)
+value5514 = compute(value, 82)
+value77050 = compute(value, 32)
+value56858 = compute(value, 16)
+value14467 = compute(value, 14)
+const v = os.environ.get('BENCH_KEY_00339');
+value73274 = compute(value, 39)
+value86647 = compute(value, 26)
+value34197 = compute(value, 53)
+value55701 = compute(value, 23)
+value24288 = compute(value, 38)
+value16410 = compute(value, 17)
+value11216 = compute(value, 61)
+value36667 = compute(value, 1)
+value97661 = compute(value, 79)
+value84107 = compute(value, 8)
+value93105 = compute(value, 82)
+value23530 = compute(value, 56)
+value5216 = compute(value, 75)
+value79233 = compute(value, 81)
+value50429 = compute(value, 86)
+value4180 = compute(value, 9)
+value84454 = compute(value, 64)
+const v = os.environ.get('BENCH_KEY_00672');
+value37120 = compute(value, 66)
+value3718 = compute(value, 32)
+value82853 = compute(value, 15)
+value10497 = compute(value, 21)
+value12833 = compute(value, 29)
+value69209 = compute(value, 48)
+value94537 = compute(value, 59)
+# note 22567: keep this in sync with the handler
+value7046 = compute(value, 62)
+value25041 = compute(value, 15)
+value65593 = compute(value, 21)
+value34351 = compute(value, 13)
+const v = os.environ.get('BENCH_KEY_01818');
+# note 37291: keep this in sync with the handler
+value94198 = compute(value, 11)
+# note 18948: keep this in sync with the handler
+value41494 = compute(value, 75)
+value1096 = compute(value, 29)
+value3057 = compute(value, 50)
+value39252 = compute(value, 64)
+value84296 = compute(value, 3)
+value7509 = compute(value, 40)
+value48665 = compute(value, 68)
+value47345 = compute(value, 9)
+value60567 = compute(value, 39)
+value20411 = compute(value, 41)
+# note 95479: keep this in sync with the handler
+value50696 = compute(value, 62)
+# note 2002: keep this in sync with the handler
+value80402 = compute(value, 86)
+const v = os.environ["BENCH_KEY_01477"];
+value20330 = compute(value, 57)
+value45303 = compute(value, 4)
+value76635 = compute(value, 5)
+value61309 = compute(value, 5)
+# note 95076: keep this in sync with the handler
+value92705 = compute(value, 70)
+value41561 = compute(value, 45)
+value17755 = compute(value, 4)
+value81232 = compute(value, 43)
+value6448 = compute(value, 46)
+const v = os.environ["BENCH_KEY_00834"];
+value25066 = compute(value, 40)
+value37727 = compute(value, 91)
+value3645 = compute(value, 56)
+value28318 = compute(value, 91)
+value24237 = compute(value, 84)
+value68095 = compute(value, 1)
+value68328 = compute(value, 40)
+value53853 = compute(value, 18)
+value60229 = compute(value, 89)
+value91925 = compute(value, 66)
+value654 = compute(value, 72)
+value13414 = compute(value, 28)
+value674 = compute(value, 92)
+value55095 = compute(value, 96)
@@ -0,0 +1,202 @@
+const value26168 = compute(value, 75);
+const value54804 = compute(value, 96);
+const value4727 = compute(value, 71);
+const value43046 = compute(value, 75);
+// note 54795: keep this in sync with the handler
+const value52923 = compute(value, 58);
+const value58645 = compute(value, 57);
+// note 88723: keep this in sync with the handler
+// note 97567: keep this in sync with the handler
+const value76833 = compute(value, 9);
+const value99257 = compute(value, 26);
+// note 98613: keep this in sync with the handler
+const v = process.env.BENCH_KEY_01045;
+const value63817 = compute(value, 88);
+const value66850 = compute(value, 17);
+const value90274 = compute(value, 64);
+const value57161 = compute(value, 28);
+const value14478 = compute(value, 25);
+const value7658 = compute(value, 92);
+const value35449 = compute(value, 44);
+const value65495 = compute(value, 20);
+const value39064 = compute(value, 70);
+const value18225 = compute(value, 86);
+const value12794 = compute(value, 87);
+const value6843 = compute(value, 53);
+const value55309 = compute(value, 19);
+const value87120 = compute(value, 14);
+// note 80365: keep this in sync with the handler
+const value40769 = compute(value, 29);
+const value36026 = compute(value, 39);
+const value43891 = compute(value, 47);
+const v = process.env["BENCH_KEY_01617"];
+const value29999 = compute(value, 26);
+const value28074 = compute(value, 41);
+const value32581 = compute(value, 86);
+// note 6064: keep this in sync with the handler
+const value22760 = compute(value, 62);
+const value7491 = compute(value, 22);
+const value50894 = compute(value, 66);
+const value21553 = compute(value, 19);
+const value96347 = compute(value, 26);
+const value90897 = compute(value, 8);
+const value55333 = compute(value, 43);
+const value95164 = compute(value, 7);
+const value8527 = compute(value, 88);
+// note 37586: keep this in sync with the handler
+const value43040 = compute(value, 69);
+const value21586 = compute(value, 52);
+const value45475 = compute(value, 79);
+// note 39408: keep this in sync with the handler
+// note 9338: keep this in sync with the handler
+const v = process.env["BENCH_KEY_00932"];
+const value52237 = compute(value, 51);
+const value58825 = compute(value, 43);
+const value68963 = compute(value, 93);
+const value72072 = compute(value, 1);
+const value22181 = compute(value, 65);
+const value6565 = compute(value, 66);
+const value51850 = compute(value, 52);
+const value54391 = compute(value, 71);
+const value74265 = compute(value, 60);
+const value52803 = compute(value, 35);
+const value46350 = compute(value, 81);
+const value18091 = compute(value, 49);
+const value83487 = compute(value, 67);
+const value37023 = compute(value, 66);
+const value70840 = compute(value, 30);
+const value96106 = compute(value, 76);
+const value44321 = compute(value, 89);
+const v = process.env["BENCH_KEY_01042"];
+const value96308 = compute(value, 84);
+// note 1240: keep this in sync with the handler
+const value80870 = compute(value, 69);
+const value68623 = compute(value, 44);
+const value90486 = compute(value, 82);
+const value6179 = compute(value, 68);
+const value97319 = compute(value, 28);
+const value58544 = compute(value, 53);
+const value66523 = compute(value, 78);
+const value90247 = compute(value, 37);
+const value28521 = compute(value, 3);
+const value78989 = compute(value, 31);
+const value24432 = compute(value, 85);
+// note 53790: keep this in sync with the handler
+const value35848 = compute(value, 55);
+const value16686 = compute(value, 2);
+const value91746 = compute(value, 81);
+const value24405 = compute(value, 58);
+const value40849 = compute(value, 12);
+const value57015 = compute(value, 76);
+const v = process.env.BENCH_KEY_01953;
+// note 57215: keep this in sync with the handler
+const value73718 = compute(value, 95);
+const value34265 = compute(value, 24);
+const value35264 = compute(value, 53);
+const value26168 = compute(value, 75);
+// note 55054: keep this in sync with the handler
+const value98004 = compute(value, 34);
+const value54259 = compute(value, 36);
+const value70096 = compute(value, 62);
+const value14432 = compute(value, 76);
+const value68697 = compute(value, 21);
+const v = import.meta.env.BENCH_KEY_00370;
+const value88528 = compute(value, 64);
+const value21857 = compute(value, 32);
+// note 58687: keep this in sync with the handler
+const value61036 = compute(value, 23);
+const value26850 = compute(value, 78);
+const value48453 = compute(value, 50);
+const value94571 = compute(value, 93);
+const value86874 = compute(value, 59);
+const value43737 = compute(value, 87);
+const value27404 = compute(value, 50);
+const value35713 = compute(value, 17);
+const value72464 = compute(value, 5);
+const v = import.meta.env.BENCH_KEY_01801;
+const value17540 = compute(value, 80);
+const value42016 = compute(value, 15);
+const value86939 = compute(value, 27);
+const value53316 = compute(value, 63);
+const value84216 = compute(value, 20);
+const value6429 = compute(value, 27);
+// note 54734: keep this in sync with the handler
+// note 75076: keep this in sync with the handler
+const value44224 = compute(value, 89);
+// note 36031: keep this in sync with the handler
+const v = import.meta.env.BENCH_KEY_01215;
+const value10962 = compute(value, 1);
+const value54835 = compute(value, 30);
+const value6055 = compute(value, 41);
+const value43209 = compute(value, 44);
+const value78529 = compute(value, 56);
+const value48871 = compute(value, 80);
+const value26482 = compute(value, 1);
+const value80154 = compute(value, 32);
+const value53855 = compute(value, 20);
+const value90890 = compute(value, 1);
+const value99234 = compute(value, 3);
+// note 27851: keep this in sync with the handler
+const value1682 = compute(value, 33);
+// note 55873: keep this in sync with the handler
+const value58282 = compute(value, 82);
+const v = process.env.BENCH_KEY_00672;
+const value82947 = compute(value, 12);
+const value5141 = compute(value, 0);
+// note 943: keep this in sync with the handler
+const value95052 = compute(value, 89);
+// note 37621: keep this in sync with the handler
+const value92272 = compute(value, 25);
+const value19497 = compute(value, 0);
+const value8748 = compute(value, 18);
+const value80502 = compute(value, 89);
+const value46788 = compute(value, 34);
+const value1768 = compute(value, 22);
+const value50013 = compute(value, 58);
+const value63019 = compute(value, 66);
+const value2229 = compute(value, 95);
+const value37062 = compute(value, 8);
+const value98463 = compute(value, 8);
+const value66353 = compute(value, 5);
+const value63213 = compute(value, 66);
+const v = import.meta.env.BENCH_KEY_00906;
+const value81110 = compute(value, 18);
+const value34339 = compute(value, 1);
+const value26946 = compute(value, 77);
+// note 17169: keep this in sync with the handler
+const value46752 = compute(value, 95);
+const value49842 = compute(value, 81);
+const value85335 = compute(value, 72);
+const value43247 = compute(value, 82);
+const value38297 = compute(value, 79);
+const value13110 = compute(value, 15);
+// note 95790: keep this in sync with the handler
+// note 41538: keep this in sync with the handler
+const value98553 = compute(value, 1);
+const value50823 = compute(value, 92);
+const value52526 = compute(value, 49);
+// note 37985: keep this in sync with the handler
+const value65425 = compute(value, 47);
+const value50211 = compute(value, 62);
+const v = process.env["BENCH_KEY_00066"];
+const value21037 = compute(value, 85);
+const value83336 = compute(value, 13);
+const value54406 = compute(value, 86);
+// note 94570: keep this in sync with the handler
+const value61294 = compute(value, 87);
+const value28613 = compute(value, 95);
+const value13899 = compute(value, 28);
+const value429 = compute(value, 41);
+// note 98447: keep this in sync with the handler
+const value8764 = compute(value, 34);
+const value58017 = compute(value, 11);
+// note 14312: keep this in sync with the handler
+// note 53067: keep this in sync with the handler
+const value59226 = compute(value, 56);
+const v = process.env.BENCH_KEY_01426;
+const value9504 = compute(value, 95);
+const value96252 = compute(value, 28);
+const value34112 = compute(value, 65);
+const value41706 = compute(value, 93);
+const value28563 = compute(value, 45);
+// note 57012: keep this in sync with the handler
@@ -0,0 +1,229 @@
+value93422 := compute(value, 11)
+value20672 := compute(value, 11)
+value59497 := compute(value, 36)
+// note 79762: keep this in sync with the handler
+value19854 := compute(value, 66)
+// note 98691: keep this in sync with the handler
+value53680 := compute(value, 39)
+value15217 := compute(value, 85)
+value7409 := compute(value, 37)
+// note 58575: keep this in sync with the handler
+value39040 := compute(value, 46)
+value73122 := compute(value, 81)
+const v = os.LookupEnv("BENCH_KEY_00951");
+value25217 := compute(value, 94)
+value15022 := compute(value, 84)
+value42233 := compute(value, 38)
+value24564 := compute(value, 23)
+value11860 := compute(value, 26)
+value94756 := compute(value, 84)
+// note 75629: keep this in sync with the handler
+value39276 := compute(value, 88)
+value88101 := compute(value, 25)
+value54147 := compute(value, 21)
+value15997 := compute(value, 89)
+value2802 := compute(value, 86)
+value86215 := compute(value, 79)
+value98680 := compute(value, 31)
+value4939 := compute(value, 89)
+value92147 := compute(value, 94)
+value44749 := compute(value, 32)
+value41286 := compute(value, 61)
+value12643 := compute(value, 33)
+value59591 := compute(value, 33)
+const v = os.Getenv("BENCH_KEY_01764");
+value6424 := compute(value, 22)
+value57792 := compute(value, 77)
+value60164 := compute(value, 24)
+value42484 := compute(value, 95)
+value24038 := compute(value, 79)
+value35790 := compute(value, 94)
+value2703 := compute(value, 84)
+value69661 := compute(value, 15)
+// note 65869: keep this in sync with the handler
+value78976 := compute(value, 18)
+value1918 := compute(value, 75)
+value23095 := compute(value, 9)
+value90808 := compute(value, 16)
+const v = os.LookupEnv("BENCH_KEY_00508");
+value6446 := compute(value, 44)
+value47461 := compute(value, 28)
+value84621 := compute(value, 37)
+value62077 := compute(value, 94)
+// note 9019: keep this in sync with the handler
+value75781 := compute(value, 24)
+// note 16361: keep this in sync with the handler
+value52112 := compute(value, 23)
+value90599 := compute(value, 1)
+value61824 := compute(value, 35)
+value35657 := compute(value, 58)
+value19866 := compute(value, 78)
+value3898 := compute(value, 18)
+value53066 := compute(value, 7)
+value47574 := compute(value, 44)
+value55201 := compute(value, 8)
+value85373 := compute(value, 13)
+const v = os.Getenv("BENCH_KEY_01246");
+value47594 := compute(value, 64)
+value90939 := compute(value, 50)
+value50461 := compute(value, 21)
+value11270 := compute(value, 18)
+value69085 := compute(value, 21)
+value53359 := compute(value, 9)
+value3517 := compute(value, 25)
+value11721 := compute(value, 81)
+// note 96680: keep this in sync with the handler
+const v = os.Getenv("BENCH_KEY_00081");
+value26416 := compute(value, 32)
+value45486 := compute(value, 90)
+// note 45892: keep this in sync with the handler
+value25804 := compute(value, 2)
+value93638 := compute(value, 33)
+// note 89577: keep this in sync with the handler
+value44863 := compute(value, 49)
+value24600 := compute(value, 59)
+value11955 := compute(value, 24)
+// note 52679: keep this in sync with the handler
+value25138 := compute(value, 15)
+value44475 := compute(value, 49)
+// note 7097: keep this in sync with the handler
+value94122 := compute(value, 32)
+value27145 := compute(value, 82)
+value2533 := compute(value, 11)
+value2671 := compute(value, 52)
+value38620 := compute(value, 14)
+const v = os.Getenv("BENCH_KEY_00137");
+value31512 := compute(value, 84)
+value24380 := compute(value, 33)
+value52323 := compute(value, 40)
+value53519 := compute(value, 72)
+value4876 := compute(value, 26)
+value26132 := compute(value, 39)
+// note 66230: keep this in sync with the handler
+// note 70740: keep this in sync with the handler
+value7514 := compute(value, 45)
+// note 72559: keep this in sync with the handler
+value48687 := compute(value, 90)
+value60553 := compute(value, 25)
+value93957 := compute(value, 61)
+value65800 := compute(value, 34)
+value44534 := compute(value, 11)
+value29856 := compute(value, 77)
+value37115 := compute(value, 61)
+value37494 := compute(value, 52)
+value6850 := compute(value, 60)
+value88740 := compute(value, 82)
+value87019 := compute(value, 10)
+const v = os.LookupEnv("BENCH_KEY_00516");
+value13806 := compute(value, 32)
+// note 96060: keep this in sync with the handler
+value22739 := compute(value, 41)
+value89378 := compute(value, 41)
+value41475 := compute(value, 56)
+value63425 := compute(value, 84)
+// note 52568: keep this in sync with the handler
+value99899 := compute(value, 86)
+// note 69231: keep this in sync with the handler
+value49359 := compute(value, 83)
+value84659 := compute(value, 75)
+value42084 := compute(value, 83)
+value19079 := compute(value, 67)
+value29832 := compute(value, 53)
+value20225 := compute(value, 49)
+value35230 := compute(value, 19)
+value45739 := compute(value, 52)
+value23983 := compute(value, 24)
+const v = os.Getenv("BENCH_KEY_01149");
+value48302 := compute(value, 93)
+value26095 := compute(value, 2)
+value71195 := compute(value, 94)
+// note 18378: keep this in sync with the handler
+value15751 := compute(value, 37)
+value19714 := compute(value, 23)
+value93764 := compute(value, 62)
+value27323 := compute(value, 66)
+value50145 := compute(value, 93)
+// note 14998: keep this in sync with the handler
+value75180 := compute(value, 5)
+// note 80394: keep this in sync with the handler
+value62474 := compute(value, 6)
+value94233 := compute(value, 46)
+// note 89974: keep this in sync with the handler
+const v = os.Getenv("BENCH_KEY_01361");
+value12469 := compute(value, 53)
+// note 95871: keep this in sync with the handler
+value65271 := compute(value, 87)
+value64193 := compute(value, 76)
+value1396 := compute(value, 38)
+value83766 := compute(value, 55)
+value11564 := compute(value, 21)
+value82465 := compute(value, 15)
+value2391 := compute(value, 63)
+value82433 := compute(value, 80)
+value59146 := compute(value, 73)
+value10683 := compute(value, 13)
+const v = os.LookupEnv("BENCH_KEY_00837");
+value46 := compute(value, 46)
+value41808 := compute(value, 1)
+value18113 := compute(value, 71)
+value8239 := compute(value, 91)
+value56610 := compute(value, 59)
+// note 33075: keep this in sync with the handler
+value89071 := compute(value, 25)
+value26399 := compute(value, 15)
+// note 69624: keep this in sync with the handler
+const v = os.Getenv("BENCH_KEY_00144");
+value75718 := compute(value, 58)
+value4805 := compute(value, 52)
+value66019 := compute(value, 59)
+value91338 := compute(value, 61)
+// note 61935: keep this in sync with the handler
+value96237 := compute(value, 13)
+value23535 := compute(value, 61)
+value4574 := compute(value, 15)
+value66599 := compute(value, 57)
+value15759 := compute(value, 45)
+value86616 := compute(value, 92)
+value91486 := compute(value, 15)
+value38111 := compute(value, 87)
+value36154 := compute(value, 70)
+value58457 := compute(value, 63)
+value58156 := compute(value, 53)
+value78083 := compute(value, 95)
+// note 20398: keep this in sync with the handler
+value59460 := compute(value, 96)
+value54745 := compute(value, 37)
+value49097 := compute(value, 15)
+// note 18684: keep this in sync with the handler
+const v = os.Getenv("BENCH_KEY_00713");
+// note 24028: keep this in sync with the handler
+value76375 := compute(value, 36)
+value77782 := compute(value, 85)
+value95070 := compute(value, 10)
+value21164 := compute(value, 18)
+value65773 := compute(value, 7)
+value95236 := compute(value, 79)
+// note 54297: keep this in sync with the handler
+value21789 := compute(value, 61)
+value99891 := compute(value, 78)
+value24466 := compute(value, 22)
+value78500 := compute(value, 27)
+// note 80889: keep this in sync with the handler
+value52529 := compute(value, 52)
+const v = os.Getenv("BENCH_KEY_01471");
+// note 89117: keep this in sync with the handler
+value26668 := compute(value, 90)
+value65915 := compute(value, 52)
+// note 61360: keep this in sync with the handler
+value39737 := compute(value, 64)
+value74267 := compute(value, 62)
+value10710 := compute(value, 40)
+value45493 := compute(value, 0)
+value97573 := compute(value, 88)
+const v = os.LookupEnv("BENCH_KEY_01105");
+value79059 := compute(value, 4)
+value50941 := compute(value, 16)
+value1058 := compute(value, 88)
+value59063 := compute(value, 87)
+// note 40069: keep this in sync with the handler
+value82254 := compute(value, 95)
@@ -0,0 +1,239 @@
+value29496 = compute(value, 8)
+value92532 = compute(value, 91)
+value4723 = compute(value, 67)
+value30158 = compute(value, 88)
+value18701 = compute(value, 77)
+value21930 = compute(value, 8)
+value10615 = compute(value, 42)
+value38917 = compute(value, 20)
+value24757 = compute(value, 22)
+value78029 = compute(value, 41)
+const v = os.getenv("BENCH_KEY_01963");
+value66877 = compute(value, 44)
+# note 12112: keep this in sync with the handler
+value91362 = compute(value, 85)
+value26408 = compute(value, 24)
+value49401 = compute(value, 28)
+value10139 = compute(value, 51)
+# note 53121: keep this in sync with the handler
+value47400 = compute(value, 64)
+value58656 = compute(value, 68)
+value42788 = compute(value, 11)
+# note 1688: keep this in sync with the handler
+value30689 = compute(value, 37)
+value37576 = compute(value, 37)
+const v = os.environ["BENCH_KEY_00676"];
+value53574 = compute(value, 30)
+value29869 = compute(value, 90)
+value88654 = compute(value, 93)
+value58021 = compute(value, 15)
+value34647 = compute(value, 18)
+value27772 = compute(value, 30)
+value37538 = compute(value, 96)
+value65073 = compute(value, 83)
+value32204 = compute(value, 0)
+value29918 = compute(value, 42)
+const v = os.environ["BENCH_KEY_01305"];
+value56867 = compute(value, 25)
+value16181 = compute(value, 79)
+# note 41141: keep this in sync with the handler
+# note 28597: keep this in sync with the handler
+value53631 = compute(value, 87)
+value73212 = compute(value, 74)
+value9608 = compute(value, 5)
+value11694 = compute(value, 54)
+# note 75533: keep this in sync with the handler
+value94200 = compute(value, 13)
+value6450 = compute(value, 48)
+value22063 = compute(value, 44)
+value78472 = compute(value, 96)
+value87412 = compute(value, 15)
+value60261 = compute(value, 24)
+value43821 = compute(value, 74)
+value36090 = compute(value, 6)
+value45047 = compute(value, 39)
+value80179 = compute(value, 57)
+# note 92132: keep this in sync with the handler
+const v = os.getenv("BENCH_KEY_01634");
+value94412 = compute(value, 31)
+value22900 = compute(value, 8)
+value11051 = compute(value, 90)
+value78752 = compute(value, 85)
+value2150 = compute(value, 16)
+value77380 = compute(value, 71)
+value70126 = compute(value, 92)
+value19674 = compute(value, 80)
+value38850 = compute(value, 50)
+value54665 = compute(value, 54)
+value91138 = compute(value, 55)
+value65904 = compute(value, 41)
+value47266 = compute(value, 27)
+value26597 = compute(value, 19)
+value64592 = compute(value, 87)
+value7874 = compute(value, 17)
+value72263 = compute(value, 95)
+value75507 = compute(value, 41)
+value99257 = compute(value, 26)
+value72899 = compute(value, 52)
+value48242 = compute(value, 33)
+value64835 = compute(value, 39)
+const v = os.environ.get('BENCH_KEY_01138');
+# note 64068: keep this in sync with the handler
+value99276 = compute(value, 45)
+value20589 = compute(value, 25)
+value19142 = compute(value, 33)
+value29566 = compute(value, 78)
+value43209 = compute(value, 44)
+value84973 = compute(value, 1)
+value53802 = compute(value, 64)
+# note 61067: keep this in sync with the handler
+value75262 = compute(value, 87)
+value40120 = compute(value, 59)
+value33420 = compute(value, 52)
+# note 53747: keep this in sync with the handler
+value69503 = compute(value, 51)
+value88375 = compute(value, 8)
+const v = os.environ["BENCH_KEY_00223"];
+value71377 = compute(value, 82)
+# note 66969: keep this in sync with the handler
+value60231 = compute(value, 91)
+value39368 = compute(value, 83)
+value37639 = compute(value, 3)
+value59023 = compute(value, 47)
+# note 80462: keep this in sync with the handler
+value65963 = compute(value, 3)
+const v = os.environ.get('BENCH_KEY_01680');
+value41581 = compute(value, 65)
+value20896 = compute(value, 41)
+value92638 = compute(value, 3)
+value59685 = compute(value, 30)
+value28688 = compute(value, 73)
+value21070 = compute(value, 21)
+value88988 = compute(value, 39)
+value10422 = compute(value, 43)
+value33893 = compute(value, 40)
+const v = os.getenv("BENCH_KEY_01073");
+value87491 = compute(value, 94)
+value7826 = compute(value, 66)
+value95010 = compute(value, 47)
+value43520 = compute(value, 64)
+value4505 = compute(value, 43)
+value34561 = compute(value, 29)
+value41970 = compute(value, 66)
+# note 386: keep this in sync with the handler
+# note 46085: keep this in sync with the handler
+value56455 = compute(value, 1)
+value16773 = compute(value, 89)
+const v = os.getenv("BENCH_KEY_01664");
+value69062 = compute(value, 95)
+value99993 = compute(value, 83)
+value71574 = compute(value, 85)
+value53446 = compute(value, 96)
+value41910 = compute(value, 6)
+value31546 = compute(value, 21)
+value5227 = compute(value, 86)
+value85106 = compute(value, 37)
+value79512 = compute(value, 69)
+value65698 = compute(value, 29)
+value3450 = compute(value, 55)
+# note 16681: keep this in sync with the handler
+value45253 = compute(value, 51)
+value4885 = compute(value, 35)
+const v = os.environ["BENCH_KEY_00420"];
+value9676 = compute(value, 73)
+value80416 = compute(value, 3)
+value63346 = compute(value, 5)
+value9250 = compute(value, 35)
+value2400 = compute(value, 72)
+# note 29417: keep this in sync with the handler
+value76034 = compute(value, 83)
+value27100 = compute(value, 37)
+value42102 = compute(value, 4)
+value1136 = compute(value, 69)
+value20793 = compute(value, 35)
+# note 85882: keep this in sync with the handler
+# note 58233: keep this in sync with the handler
+value78980 = compute(value, 22)
+value75158 = compute(value, 80)
+value69304 = compute(value, 46)
+const v = os.environ["BENCH_KEY_00030"];
+value5786 = compute(value, 63)
+value44272 = compute(value, 40)
+value54991 = compute(value, 89)
+value42322 = compute(value, 30)
+value13858 = compute(value, 84)
+value81875 = compute(value, 7)
+# note 3423: keep this in sync with the handler
+# note 58698: keep this in sync with the handler
+value36757 = compute(value, 91)
+value85151 = compute(value, 82)
+value76335 = compute(value, 93)
+value10963 = compute(value, 2)
+value41535 = compute(value, 19)
+# note 83199: keep this in sync with the handler
+value50312 = compute(value, 66)
+const v = os.environ["BENCH_KEY_00380"];
+value47998 = compute(value, 80)
+value64963 = compute(value, 70)
+value97182 = compute(value, 85)
+value78544 = compute(value, 71)
+value12727 = compute(value, 20)
+value18935 = compute(value, 20)
+value9425 = compute(value, 16)
+value13304 = compute(value, 15)
+# note 33560: keep this in sync with the handler
+value85299 = compute(value, 36)
+value62627 = compute(value, 62)
+value81635 = compute(value, 58)
+# note 2266: keep this in sync with the handler
+# note 43083: keep this in sync with the handler
+value78199 = compute(value, 17)
+# note 86631: keep this in sync with the handler
+value29862 = compute(value, 83)
+value49736 = compute(value, 72)
+value96045 = compute(value, 15)
+value62344 = compute(value, 70)
+value26836 = compute(value, 64)
+const v = os.getenv("BENCH_KEY_01670");
+value90125 = compute(value, 12)
+value21850 = compute(value, 25)
+value38309 = compute(value, 91)
+# note 77980: keep this in sync with the handler
+value92024 = compute(value, 68)
+value27832 = compute(value, 90)
+value49626 = compute(value, 59)
+value38136 = compute(value, 15)
+value24441 = compute(value, 94)
+value56645 = compute(value, 94)
+value95306 = compute(value, 52)
+value45774 = compute(value, 87)
+value22110 = compute(value, 91)
+value82970 = compute(value, 35)
+const v = os.environ["BENCH_KEY_00145"];
+value63501 = compute(value, 63)
+value32213 = compute(value, 9)
+value17322 = compute(value, 56)
+value85411 = compute(value, 51)
+value92455 = compute(value, 14)
+value78828 = compute(value, 64)
+value28766 = compute(value, 54)
+value70321 = compute(value, 93)
+value48128 = compute(value, 16)
+value2835 = compute(value, 22)
+value97904 = compute(value, 31)
+value40597 = compute(value, 51)
+value95146 = compute(value, 86)
+value80393 = compute(value, 77)
+value62785 = compute(value, 26)
+value6066 = compute(value, 52)
+# note 52312: keep this in sync with the handler
+value63878 = compute(value, 52)
+# note 25303: keep this in sync with the handler
+value7819 = compute(value, 59)
+value75636 = compute(value, 73)
+value2331 = compute(value, 3)
+value4896 = compute(value, 46)
+const v = os.environ.get('BENCH_KEY_01577');
+value83201 = compute(value, 72)
+value60013 = compute(value, 67)
+value21472 = compute(value, 35)
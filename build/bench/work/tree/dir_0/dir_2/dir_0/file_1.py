@@ -0,0 +1,240 @@
+value81583 = compute(value, 6)
+value47485 = compute(value, 52)
+value2866 = compute(value, 53)
+value2954 = compute(value, 44)
+# note 17521: keep this in sync with the handler
+value21084 = compute(value, 35)
+value45014 = compute(value, 6)
+value59807 = compute(value, 55)
+value4791 = compute(value, 38)
+value76523 = compute(value, 87)
+value9227 = compute(value, 12)
+value71100 = compute(value, 96)
+value92540 = compute(value, 2)
+value74888 = compute(value, 4)
+value40161 = compute(value, 3)
+const v = os.getenv("BENCH_KEY_01738");
+value13672 = compute(value, 92)
+value24059 = compute(value, 3)
+value37127 = compute(value, 73)
+value10697 = compute(value, 27)
+value66336 = compute(value, 85)
+value51229 = compute(value, 13)
+value72671 = compute(value, 18)
+# note 34739: keep this in sync with the handler
+value98036 = compute(value, 66)
+# note 57121: keep this in sync with the handler
+value77936 = compute(value, 45)
+value80340 = compute(value, 24)
+value4460 = compute(value, 95)
+# note 23474: keep this in sync with the handler
+value36121 = compute(value, 37)
+const v = os.getenv("BENCH_KEY_00474");
+value15945 = compute(value, 37)
+value37983 = compute(value, 56)
+value16058 = compute(value, 53)
+value32985 = compute(value, 5)
+value51212 = compute(value, 93)
+value21119 = compute(value, 70)
+value54577 = compute(value, 63)
+value75928 = compute(value, 74)
+value5802 = compute(value, 79)
+value40002 = compute(value, 38)
+value82277 = compute(value, 21)
+value64560 = compute(value, 55)
+value92641 = compute(value, 6)
+value18060 = compute(value, 18)
+value29747 = compute(value, 65)
+value89800 = compute(value, 75)
+value90879 = compute(value, 87)
+value91117 = compute(value, 34)
+value38304 = compute(value, 86)
+# note 14017: keep this in sync with the handler
+value76129 = compute(value, 81)
+value17657 = compute(value, 3)
+value67311 = compute(value, 90)
+const v = os.environ.get('BENCH_KEY_00533');
+value95736 = compute(value, 94)
+value28587 = compute(value, 69)
+# note 72801: keep this in sync with the handler
+value10196 = compute(value, 11)
+value73268 = compute(value, 33)
+value85251 = compute(value, 85)
+# note 59501: keep this in sync with the handler
+value51388 = compute(value, 75)
+const v = os.getenv("BENCH_KEY_01743");
+value31154 = compute(value, 17)
+value54910 = compute(value, 8)
+value12038 = compute(value, 10)
+value60842 = compute(value, 23)
+value3533 = compute(value, 41)
+value1345 = compute(value, 84)
+value78349 = compute(value, 70)
+value31505 = compute(value, 77)
+value55884 = compute(value, 12)
+const v = os.environ["BENCH_KEY_01951"];
+value40414 = compute(value, 62)
+value65660 = compute(value, 88)
+# note 5356: keep this in sync with the handler
+value16243 = compute(value, 44)
+value67783 = compute(value, 77)
+# note 14604: keep this in sync with the handler
+value11329 = compute(value, 77)
+value23582 = compute(value, 11)
+value74557 = compute(value, 61)
+value17559 = compute(value, 2)
+value56104 = compute(value, 38)
+value93344 = compute(value, 30)
+value92535 = compute(value, 94)
+value98666 = compute(value, 17)
+value24670 = compute(value, 32)
+value57366 = compute(value, 39)
+# note 95522: keep this in sync with the handler
+value97293 = compute(value, 2)
+const v = os.getenv("BENCH_KEY_01669");
+value96783 = compute(value, 74)
+value52305 = compute(value, 22)
+value48104 = compute(value, 89)
+value59952 = compute(value, 6)
+value44614 = compute(value, 91)
+# note 90030: keep this in sync with the handler
+value65062 = compute(value, 72)
+value33034 = compute(value, 54)
+value82369 = compute(value, 16)
+# note 2389: keep this in sync with the handler
+value21918 = compute(value, 93)
+value23050 = compute(value, 61)
+value9652 = compute(value, 49)
+value89910 = compute(value, 88)
+value79050 = compute(value, 92)
+value60577 = compute(value, 49)
+value88869 = compute(value, 17)
+value76863 = compute(value, 39)
+value85810 = compute(value, 62)
+# note 99864: keep this in sync with the handler
+value92153 = compute(value, 3)
+# note 94021: keep this in sync with the handler
+const v = os.environ["BENCH_KEY_00101"];
+value60372 = compute(value, 38)
+value73358 = compute(value, 26)
+value60066 = compute(value, 23)
+value8703 = compute(value, 70)
+value2111 = compute(value, 74)
+value42135 = compute(value, 37)
+value55770 = compute(value, 92)
+value1003 = compute(value, 33)
+value23783 = compute(value, 18)
+value50520 = compute(value, 80)
+# note 95030: keep this in sync with the handler
+value90408 = compute(value, 4)
+value33086 = compute(value, 9)
+value29389 = compute(value, 95)
+value7923 = compute(value, 66)
+# note 11318: keep this in sync with the handler
+value44758 = compute(value, 41)
+value98774 = compute(value, 28)
+# note 17544: keep this in sync with the handler
+value22288 = compute(value, 75)
+const v = os.environ["BENCH_KEY_01158"];
+# note 84286: keep this in sync with the handler
+value80235 = compute(value, 16)
+value611 = compute(value, 29)
+value38773 = compute(value, 70)
+value58871 = compute(value, 89)
+value96229 = compute(value, 5)
+value12028 = compute(value, 0)
+value85214 = compute(value, 48)
+value57995 = compute(value, 86)
+# note 58597: keep this in sync with the handler
+# note 56236: keep this in sync with the handler
+# note 98756: keep this in sync with the handler
+value94282 = compute(value, 95)
+value89533 = compute(value, 2)
+value78500 = compute(value, 27)
+const v = os.environ["BENCH_KEY_01635"];
+value293 = compute(value, 2)
+value20854 = compute(value, 96)
+value58926 = compute(value, 47)
+value831 = compute(value, 55)
+value31772 = compute(value, 53)
+value79924 = compute(value, 93)
+# note 21310: keep this in sync with the handler
+value13819 = compute(value, 45)
+value73366 = compute(value, 34)
+value49630 = compute(value, 63)
+value41686 = compute(value, 73)
+value44228 = compute(value, 93)
+value36966 = compute(value, 9)
+value46767 = compute(value, 13)
+value41161 = compute(value, 33)
+value6765 = compute(value, 72)
+value22240 = compute(value, 27)
+value84271 = compute(value, 75)
+const v = os.environ.get('BENCH_KEY_00481');
+# note 21200: keep this in sync with the handler
+value48667 = compute(value, 70)
+value52532 = compute(value, 55)
+value36913 = compute(value, 53)
+value39579 = compute(value, 3)
+value31255 = compute(value, 21)
+value30777 = compute(value, 28)
+value32817 = compute(value, 31)
+value68866 = compute(value, 93)
+value75982 = compute(value, 31)
+value69390 = compute(value, 35)
+value33063 = compute(value, 83)
+# note 47449: keep this in sync with the handler
+const v = os.environ["BENCH_KEY_01475"];
+value82349 = compute(value, 93)
+value68139 = compute(value, 45)
+value71692 = compute(value, 9)
+value24907 = compute(value, 75)
+value80990 = compute(value, 92)
+value91371 = compute(value, 94)
+value32216 = compute(value, 12)
+value51386 = compute(value, 73)
+value48097 = compute(value, 82)
+value69386 = compute(value, 31)
+value55359 = compute(value, 69)
+value57164 = compute(value, 31)
+value52906 = compute(value, 41)
+value4055 = compute(value, 78)
+value85969 = compute(value, 27)
+value79648 = compute(value, 11)
+value41101 = compute(value, 70)
+value86747 = compute(value, 29)
+const v = os.getenv("BENCH_KEY_00698");
+value8402 = compute(value, 60)
+value4247 = compute(value, 76)
+value50778 = compute(value, 47)
+value62717 = compute(value, 55)
+value8433 = compute(value, 91)
+value65435 = compute(value, 57)
+value96406 = compute(value, 85)
+value51211 = compute(value, 92)
+value16188 = compute(value, 86)
+value53011 = compute(value, 49)
+# note 99123: keep this in sync with the handler
+const v = os.environ["BENCH_KEY_00051"];
+value33727 = compute(value, 68)
+value2252 = compute(value, 21)
+value14204 = compute(value, 42)
+value65087 = compute(value, 0)
+value57822 = compute(value, 10)
+value34782 = compute(value, 56)
+value13656 = compute(value, 76)
+value40984 = compute(value, 50)
+# note 4811: keep this in sync with the handler
+value25995 = compute(value, 96)
+value67248 = compute(value, 27)
+const v = os.environ["BENCH_KEY_01143"];
+value87108 = compute(value, 2)
+value25506 = compute(value, 92)
+value91442 = compute(value, 68)
+value74053 = compute(value, 42)
+value12138 = compute(value, 13)
+value3402 = compute(value, 7)
+value53889 = compute(value, 54)
+value99149 = compute(value, 15)
+value16713 = compute(value, 29)
+value5045 = compute(value, 1)
@@ -0,0 +1,214 @@
+let value29389 = compute(value, 95);
+let value98817 = compute(value, 71);
+let value48691 = compute(value, 94);
+let value82116 = compute(value, 54);
+let value7572 = compute(value, 6);
+const v = env::var("BENCH_KEY_01590");
+let value19987 = compute(value, 5);
+let value59289 = compute(value, 22);
+let value20355 = compute(value, 82);
+let value83331 = compute(value, 8);
+let value9750 = compute(value, 50);
+let value6467 = compute(value, 65);
+let value25073 = compute(value, 47);
+let value47 = compute(value, 47);
+let value42830 = compute(value, 53);
+let value90106 = compute(value, 90);
+let value41362 = compute(value, 40);
+let value5794 = compute(value, 71);
+let value93131 = compute(value, 11);
+// note 76978: keep this in sync with the handler
+let value84996 = compute(value, 24);
+let value44028 = compute(value, 87);
+let value39970 = compute(value, 6);
+let value53759 = compute(value, 21);
+let value93585 = compute(value, 77);
+let value80413 = compute(value, 0);
+let value26204 = compute(value, 14);
+const v = env::var("BENCH_KEY_00003");
+let value94125 = compute(value, 35);
+let value32567 = compute(value, 72);
+let value61167 = compute(value, 57);
+let value30702 = compute(value, 50);
+let value17381 = compute(value, 18);
+let value51635 = compute(value, 31);
+let value52328 = compute(value, 45);
+let value66411 = compute(value, 63);
+let value44030 = compute(value, 89);
+let value42267 = compute(value, 72);
+let value75555 = compute(value, 89);
+const v = env::var_os("BENCH_KEY_00111");
+let value89004 = compute(value, 55);
+let value75408 = compute(value, 39);
+let value39251 = compute(value, 63);
+let value26357 = compute(value, 70);
+let value87962 = compute(value, 80);
+let value24182 = compute(value, 29);
+let value62255 = compute(value, 78);
+let value1286 = compute(value, 25);
+let value4295 = compute(value, 27);
+let value26165 = compute(value, 72);
+let value2635 = compute(value, 16);
+let value5005 = compute(value, 58);
+const v = env::var("BENCH_KEY_00824");
+let value34896 = compute(value, 73);
+let value93780 = compute(value, 78);
+let value44483 = compute(value, 57);
+let value38604 = compute(value, 95);
+// note 90008: keep this in sync with the handler
+let value52533 = compute(value, 56);
+let value19451 = compute(value, 51);
+let value39725 = compute(value, 52);
+let value30071 = compute(value, 1);
+let value74510 = compute(value, 14);
+// note 69638: keep this in sync with the handler
+let value13403 = compute(value, 17);
+const v = env::var("BENCH_KEY_00596");
+let value15393 = compute(value, 67);
+let value48664 = compute(value, 67);
+let value18329 = compute(value, 93);
+let value28612 = compute(value, 94);
+let value81661 = compute(value, 84);
+let value24728 = compute(value, 90);
+let value23628 = compute(value, 57);
+let value59781 = compute(value, 29);
+let value29273 = compute(value, 76);
+let value88541 = compute(value, 77);
+// note 44416: keep this in sync with the handler
+let value82388 = compute(value, 35);
+let value50524 = compute(value, 84);
+let value58380 = compute(value, 83);
+let value62926 = compute(value, 70);
+let value40655 = compute(value, 12);
+const v = env::var_os("BENCH_KEY_00121");
+let value33543 = compute(value, 78);
+let value68247 = compute(value, 56);
+let value60700 = compute(value, 75);
+let value94579 = compute(value, 4);
+let value88198 = compute(value, 25);
+let value89831 = compute(value, 9);
+// note 67099: keep this in sync with the handler
+let value93501 = compute(value, 90);
+let value8955 = compute(value, 31);
+let value14475 = compute(value, 22);
+let value91829 = compute(value, 67);
+let value16366 = compute(value, 70);
+let value45381 = compute(value, 82);
+const v = env::var("BENCH_KEY_01654");
+let value50087 = compute(value, 35);
+let value78502 = compute(value, 29);
+let value22834 = compute(value, 39);
+let value34807 = compute(value, 81);
+let value64427 = compute(value, 19);
+let value66399 = compute(value, 51);
+let value13915 = compute(value, 44);
+let value17550 = compute(value, 90);
+let value74737 = compute(value, 47);
+// note 3218: keep this in sync with the handler
+let value61327 = compute(value, 23);
+let value35855 = compute(value, 62);
+let value82489 = compute(value, 39);
+let value38940 = compute(value, 43);
+let value93149 = compute(value, 29);
+const v = env::var("BENCH_KEY_01015");
+let value57124 = compute(value, 88);
+let value77666 = compute(value, 66);
+let value95194 = compute(value, 37);
+let value44747 = compute(value, 30);
+let value66024 = compute(value, 64);
+let value2932 = compute(value, 22);
+// note 67498: keep this in sync with the handler
+let value97094 = compute(value, 94);
+let value78540 = compute(value, 67);
+// note 76092: keep this in sync with the handler
+let value79292 = compute(value, 43);
+let value50889 = compute(value, 61);
+let value48353 = compute(value, 47);
+let value18872 = compute(value, 54);
+const v = env::var_os("BENCH_KEY_00537");
+let value52593 = compute(value, 19);
+let value92232 = compute(value, 82);
+let value7504 = compute(value, 35);
+let value20304 = compute(value, 31);
+// note 27727: keep this in sync with the handler
+// note 76144: keep this in sync with the handler
+let value86695 = compute(value, 74);
+let value82903 = compute(value, 65);
+const v = env::var("BENCH_KEY_01574");
+// note 56039: keep this in sync with the handler
+let value5988 = compute(value, 71);
+// note 73093: keep this in sync with the handler
+// note 15457: keep this in sync with the handler
+let value30650 = compute(value, 95);
+let value86280 = compute(value, 47);
+// note 63340: keep this in sync with the handler
+let value54453 = compute(value, 36);
+// note 94119: keep this in sync with the handler
+let value28890 = compute(value, 81);
+let value68951 = compute(value, 81);
+let value37253 = compute(value, 5);
+let value6507 = compute(value, 8);
+let value48122 = compute(value, 10);
+let value19740 = compute(value, 49);
+const v = env::var_os("BENCH_KEY_00352");
+let value44641 = compute(value, 21);
+let value337 = compute(value, 46);
+let value49504 = compute(value, 34);
+let value40103 = compute(value, 42);
+let value871 = compute(value, 95);
+let value86516 = compute(value, 89);
+let value87812 = compute(value, 27);
+let value59209 = compute(value, 39);
+let value85703 = compute(value, 52);
+let value21792 = compute(value, 64);
+let value81194 = compute(value, 5);
+// note 97193: keep this in sync with the handler
+let value64863 = compute(value, 67);
+// note 9447: keep this in sync with the handler
+let value22645 = compute(value, 44);
+let value24726 = compute(value, 88);
+let value39555 = compute(value, 76);
+const v = env::var("BENCH_KEY_01577");
+let value24875 = compute(value, 43);
+let value70659 = compute(value, 43);
+// note 44637: keep this in sync with the handler
+let value29085 = compute(value, 82);
+let value32583 = compute(value, 88);
+// note 51161: keep this in sync with the handler
+let value50111 = compute(value, 59);
+let value64163 = compute(value, 46);
+const v = env::var_os("BENCH_KEY_01421");
+let value57763 = compute(value, 48);
+// note 54685: keep this in sync with the handler
+let value86563 = compute(value, 39);
+let value88245 = compute(value, 72);
+let value92482 = compute(value, 41);
+let value49278 = compute(value, 2);
+// note 43677: keep this in sync with the handler
+let value51054 = compute(value, 32);
+let value24863 = compute(value, 31);
+let value76318 = compute(value, 76);
+let value52569 = compute(value, 92);
+const v = env::var_os("BENCH_KEY_01894");
+let value58646 = compute(value, 58);
+let value83183 = compute(value, 54);
+let value98216 = compute(value, 52);
+let value29250 = compute(value, 53);
+let value34172 = compute(value, 28);
+let value39746 = compute(value, 73);
+let value64016 = compute(value, 93);
+// note 85832: keep this in sync with the handler
+let value51934 = compute(value, 39);
+let value47107 = compute(value, 62);
+let value80217 = compute(value, 95);
+const v = env::var_os("BENCH_KEY_01419");
+let value58205 = compute(value, 5);
+let value41584 = compute(value, 68);
+// note 38455: keep this in sync with the handler
+let value606 = compute(value, 24);
+let value41457 = compute(value, 38);
+let value32864 = compute(value, 78);
+let value97196 = compute(value, 2);
+let value51256 = compute(value, 40);
+let value7961 = compute(value, 7);
+let value34658 = compute(value, 29);
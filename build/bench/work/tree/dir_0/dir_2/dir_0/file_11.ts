@@ -0,0 +1,204 @@
+const value28303 = compute(value, 76);
+const value44089 = compute(value, 51);
+const value6819 = compute(value, 29);
+const value69793 = compute(value, 50);
+const value96808 = compute(value, 2);
+const value94566 = compute(value, 88);
+// note 97073: keep this in sync with the handler
+const value31262 = compute(value, 28);
+const value20965 = compute(value, 13);
+const value56734 = compute(value, 86);
+const v = process.env["BENCH_KEY_01654"];
+const value56993 = compute(value, 54);
+const value12857 = compute(value, 53);
+// note 43823: keep this in sync with the handler
+const value92508 = compute(value, 67);
+const value75814 = compute(value, 57);
+const value66580 = compute(value, 38);
+const value98980 = compute(value, 40);
+const value3027 = compute(value, 20);
+const value38986 = compute(value, 89);
+const value34222 = compute(value, 78);
+const value50330 = compute(value, 84);
+const value50397 = compute(value, 54);
+const value46330 = compute(value, 61);
+const v = import.meta.env.BENCH_KEY_00222;
+const value7970 = compute(value, 16);
+const value77921 = compute(value, 30);
+const value63041 = compute(value, 88);
+const value12431 = compute(value, 15);
+const value27321 = compute(value, 64);
+const value40979 = compute(value, 45);
+const value63905 = compute(value, 79);
+const value80541 = compute(value, 31);
+const value1686 = compute(value, 37);
+const value39778 = compute(value, 8);
+const value31561 = compute(value, 36);
+const v = import.meta.env.BENCH_KEY_00984;
+const value51156 = compute(value, 37);
+const value59242 = compute(value, 72);
+const value50328 = compute(value, 82);
+const value2382 = compute(value, 54);
+const value38246 = compute(value, 28);
+const value33454 = compute(value, 86);
+const value41711 = compute(value, 1);
+const v = process.env.BENCH_KEY_01243;
+// note 61800: keep this in sync with the handler
+const value77312 = compute(value, 3);
+// note 76366: keep this in sync with the handler
+const value72412 = compute(value, 50);
+const value3803 = compute(value, 20);
+const value14669 = compute(value, 22);
+const value97863 = compute(value, 87);
+const value12180 = compute(value, 55);
+// note 91800: keep this in sync with the handler
+const v = import.meta.env.BENCH_KEY_01194;
+const value699 = compute(value, 20);
+const value42294 = compute(value, 2);
+// note 97327: keep this in sync with the handler
+// note 74286: keep this in sync with the handler
+const value13313 = compute(value, 24);
+const value56440 = compute(value, 83);
+const value59858 = compute(value, 9);
+const v = process.env["BENCH_KEY_01914"];
+const value38054 = compute(value, 30);
+const value39880 = compute(value, 13);
+// note 84771: keep this in sync with the handler
+const value60931 = compute(value, 15);
+const value91998 = compute(value, 42);
+const value59536 = compute(value, 75);
+const value42449 = compute(value, 60);
+const value8298 = compute(value, 53);
+const value58698 = compute(value, 13);
+const value5163 = compute(value, 22);
+const value97737 = compute(value, 58);
+const value17294 = compute(value, 28);
+const value32010 = compute(value, 0);
+const value4513 = compute(value, 51);
+const value43384 = compute(value, 25);
+const value68753 = compute(value, 77);
+const value69937 = compute(value, 0);
+const value6006 = compute(value, 89);
+const value51551 = compute(value, 44);
+const v = process.env.BENCH_KEY_01482;
+const value82952 = compute(value, 17);
+const value42604 = compute(value, 21);
+const value93565 = compute(value, 57);
+// note 23375: keep this in sync with the handler
+const value70761 = compute(value, 48);
+const value78498 = compute(value, 25);
+const value87041 = compute(value, 32);
+const value75635 = compute(value, 72);
+const v = import.meta.env.BENCH_KEY_01837;
+const value98665 = compute(value, 16);
+const value84432 = compute(value, 42);
+const value28381 = compute(value, 57);
+const value59817 = compute(value, 65);
+// note 51953: keep this in sync with the handler
+const value46581 = compute(value, 21);
+const value69114 = compute(value, 50);
+const value58633 = compute(value, 45);
+const value65733 = compute(value, 64);
+const value43113 = compute(value, 45);
+const value1078 = compute(value, 11);
+const value97664 = compute(value, 82);
+const value41830 = compute(value, 23);
+const value58047 = compute(value, 41);
+const value29849 = compute(value, 70);
+const value10913 = compute(value, 49);
+const value25843 = compute(value, 41);
+const v = import.meta.env.BENCH_KEY_00242;
+// note 61125: keep this in sync with the handler
+const value75789 = compute(value, 32);
+// note 30954: keep this in sync with the handler
+const value37582 = compute(value, 43);
+const value52020 = compute(value, 28);
+const value33892 = compute(value, 39);
+const value77551 = compute(value, 48);
+const value57274 = compute(value, 44);
+const value23905 = compute(value, 43);
+const v = process.env["BENCH_KEY_00538"];
+const value73824 = compute(value, 7);
+const value92361 = compute(value, 17);
+const value5375 = compute(value, 40);
+const value76815 = compute(value, 88);
+const value49113 = compute(value, 31);
+const value58627 = compute(value, 39);
+const value17237 = compute(value, 68);
+const value90859 = compute(value, 67);
+const value55324 = compute(value, 34);
+const value50235 = compute(value, 86);
+const value2112 = compute(value, 75);
+const value82093 = compute(value, 31);
+const value80036 = compute(value, 11);
+const value95656 = compute(value, 14);
+const v = process.env.BENCH_KEY_00682;
+const value25541 = compute(value, 30);
+const value94457 = compute(value, 76);
+const value9029 = compute(value, 8);
+const value49740 = compute(value, 76);
+// note 51441: keep this in sync with the handler
+const value46182 = compute(value, 10);
+const value89316 = compute(value, 76);
+const value1974 = compute(value, 34);
+const value12002 = compute(value, 71);
+const value44285 = compute(value, 53);
+const value2850 = compute(value, 37);
+const value50335 = compute(value, 89);
+// note 18110: keep this in sync with the handler
+const value38425 = compute(value, 13);
+const value92840 = compute(value, 11);
+const value16834 = compute(value, 53);
+const value56776 = compute(value, 31);
+const value57749 = compute(value, 34);
+const v = import.meta.env.BENCH_KEY_00157;
+const value6849 = compute(value, 59);
+const value74750 = compute(value, 60);
+const value27624 = compute(value, 76);
+const value60417 = compute(value, 83);
+const value38666 = compute(value, 60);
+const value66441 = compute(value, 93);
+const value60818 = compute(value, 96);
+// note 15312: keep this in sync with the handler
+const value27721 = compute(value, 76);
+const value55332 = compute(value, 42);
+const value69449 = compute(value, 94);
+// note 33617: keep this in sync with the handler
+const value17367 = compute(value, 4);
+const value13201 = compute(value, 9);
+const value59069 = compute(value, 93);
+const v = process.env.BENCH_KEY_00300;
+// note 59275: keep this in sync with the handler
+const value14671 = compute(value, 24);
+const value3081 = compute(value, 74);
+// note 43288: keep this in sync with the handler
+const value53170 = compute(value, 14);
+const value52151 = compute(value, 62);
+const value21988 = compute(value, 66);
+const value52023 = compute(value, 31);
+// note 93680: keep this in sync with the handler
+const value64599 = compute(value, 94);
+// note 84855: keep this in sync with the handler
+const value69614 = compute(value, 65);
+const value65277 = compute(value, 93);
+const value84797 = compute(value, 19);
+const value79549 = compute(value, 9);
+const v = import.meta.env.BENCH_KEY_01019;
+const value50257 = compute(value, 11);
+// note 50778: keep this in sync with the handler
+// note 21110: keep this in sync with the handler
+const value14225 = compute(value, 63);
+const value33391 = compute(value, 23);
+const value72727 = compute(value, 74);
+const value31381 = compute(value, 50);
+const value52934 = compute(value, 69);
+const value65538 = compute(value, 63);
+const v = process.env.BENCH_KEY_00570;
+const value22557 = compute(value, 53);
+const value93686 = compute(value, 81);
+const value56455 = compute(value, 1);
+const value33622 = compute(value, 60);
+const value48415 = compute(value, 12);
+const value75158 = compute(value, 80);
+const value35111 = compute(value, 94);
+// note 28626: keep this in sync with the handler
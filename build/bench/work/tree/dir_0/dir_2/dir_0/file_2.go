@@ -0,0 +1,231 @@
+value27579 := compute(value, 31)
+const v = os.Getenv("BENCH_KEY_00523");
+value69785 := compute(value, 42)
+value80056 := compute(value, 31)
+value323 := compute(value, 32)
+value51362 := compute(value, 49)
+// note 86167: keep this in sync with the handler
+value20018 := compute(value, 36)
+value74934 := compute(value, 50)
+value92102 := compute(value, 49)
+value60311 := compute(value, 74)
+// note 13339: keep this in sync with the handler
+value86689 := compute(value, 68)
+value96465 := compute(value, 47)
+// note 10407: keep this in sync with the handler
+value53867 := compute(value, 32)
+value55617 := compute(value, 36)
+const v = os.Getenv("BENCH_KEY_00454");
+value94442 := compute(value, 61)
+value91323 := compute(value, 46)
+value56109 := compute(value, 43)
+value42136 := compute(value, 38)
+value12588 := compute(value, 75)
+value424 := compute(value, 36)
+value28148 := compute(value, 18)
+value30945 := compute(value, 2)
+value16906 := compute(value, 28)
+value8471 := compute(value, 32)
+value93183 := compute(value, 63)
+value75316 := compute(value, 44)
+value88963 := compute(value, 14)
+value45137 := compute(value, 32)
+value92354 := compute(value, 10)
+// note 89480: keep this in sync with the handler
+const v = os.Getenv("BENCH_KEY_01639");
+value18113 := compute(value, 71)
+value30842 := compute(value, 93)
+value5054 := compute(value, 10)
+value45184 := compute(value, 79)
+value44635 := compute(value, 15)
+value33997 := compute(value, 47)
+value10575 := compute(value, 2)
+value41464 := compute(value, 45)
+value5072 := compute(value, 28)
+value38531 := compute(value, 22)
+value56647 := compute(value, 96)
+const v = os.Getenv("BENCH_KEY_01585");
+value42957 := compute(value, 83)
+// note 74258: keep this in sync with the handler
+value45521 := compute(value, 28)
+value66245 := compute(value, 91)
+// note 9363: keep this in sync with the handler
+value43694 := compute(value, 44)
+value93892 := compute(value, 93)
+// note 62247: keep this in sync with the handler
+value35071 := compute(value, 54)
+value29015 := compute(value, 12)
+value85905 := compute(value, 60)
+value98662 := compute(value, 13)
+const v = os.Getenv("BENCH_KEY_01284");
+value37047 := compute(value, 90)
+value32076 := compute(value, 66)
+value98370 := compute(value, 12)
+value67122 := compute(value, 95)
+value19661 := compute(value, 67)
+value37737 := compute(value, 4)
+value17481 := compute(value, 21)
+value45748 := compute(value, 61)
+value34916 := compute(value, 93)
+// note 45883: keep this in sync with the handler
+value16924 := compute(value, 46)
+value40343 := compute(value, 88)
+value73871 := compute(value, 54)
+const v = os.LookupEnv("BENCH_KEY_00811");
+value22036 := compute(value, 17)
+value6038 := compute(value, 24)
+value56853 := compute(value, 11)
+// note 55658: keep this in sync with the handler
+// note 33141: keep this in sync with the handler
+value49915 := compute(value, 57)
+value73775 := compute(value, 55)
+value85551 := compute(value, 94)
+const v = os.LookupEnv("BENCH_KEY_01781");
+// note 65696: keep this in sync with the handler
+value87745 := compute(value, 57)
+value19219 := compute(value, 13)
+value49698 := compute(value, 34)
+value95773 := compute(value, 34)
+value36542 := compute(value, 70)
+value1478 := compute(value, 23)
+value73790 := compute(value, 70)
+value4413 := compute(value, 48)
+value78354 := compute(value, 75)
+value3159 := compute(value, 55)
+value35367 := compute(value, 59)
+value37138 := compute(value, 84)
+value42257 := compute(value, 62)
+const v = os.LookupEnv("BENCH_KEY_01561");
+value67402 := compute(value, 84)
+value36538 := compute(value, 66)
+value40510 := compute(value, 61)
+value66638 := compute(value, 96)
+value10213 := compute(value, 28)
+value10650 := compute(value, 77)
+value59091 := compute(value, 18)
+value74908 := compute(value, 24)
+// note 99763: keep this in sync with the handler
+value48748 := compute(value, 54)
+const v = os.LookupEnv("BENCH_KEY_00585");
+value83060 := compute(value, 28)
+value7030 := compute(value, 46)
+value54622 := compute(value, 11)
+// note 90354: keep this in sync with the handler
+value27230 := compute(value, 70)
+value82717 := compute(value, 73)
+value88352 := compute(value, 82)
+value55574 := compute(value, 90)
+const v = os.LookupEnv("BENCH_KEY_00601");
+value75732 := compute(value, 72)
+value73414 := compute(value, 82)
+// note 23622: keep this in sync with the handler
+value51908 := compute(value, 13)
+value40549 := compute(value, 3)
+value95927 := compute(value, 91)
+value83251 := compute(value, 25)
+value75875 := compute(value, 21)
+value89454 := compute(value, 20)
+value89075 := compute(value, 29)
+value51957 := compute(value, 62)
+value23417 := compute(value, 40)
+// note 6142: keep this in sync with the handler
+// note 27365: keep this in sync with the handler
+value26992 := compute(value, 26)
+// note 11695: keep this in sync with the handler
+value8001 := compute(value, 47)
+value47203 := compute(value, 61)
+value83298 := compute(value, 72)
+value29326 := compute(value, 32)
+const v = os.LookupEnv("BENCH_KEY_01477");
+// note 54946: keep this in sync with the handler
+value43437 := compute(value, 78)
+value45414 := compute(value, 18)
+value8666 := compute(value, 33)
+value24160 := compute(value, 7)
+value32309 := compute(value, 8)
+value21425 := compute(value, 85)
+value40916 := compute(value, 79)
+value98648 := compute(value, 96)
+// note 9568: keep this in sync with the handler
+value99806 := compute(value, 90)
+value92266 := compute(value, 19)
+value75660 := compute(value, 0)
+value55419 := compute(value, 32)
+value5929 := compute(value, 12)
+value31275 := compute(value, 41)
+value94200 := compute(value, 13)
+value67296 := compute(value, 75)
+value9721 := compute(value, 21)
+const v = os.Getenv("BENCH_KEY_01433");
+value22321 := compute(value, 11)
+value9284 := compute(value, 69)
+value51596 := compute(value, 89)
+value75722 := compute(value, 62)
+value31861 := compute(value, 45)
+value85449 := compute(value, 89)
+value45385 := compute(value, 86)
+value12143 := compute(value, 18)
+value71314 := compute(value, 19)
+value9873 := compute(value, 76)
+value25398 := compute(value, 81)
+value48584 := compute(value, 84)
+value13667 := compute(value, 87)
+value73902 := compute(value, 85)
+value89543 := compute(value, 12)
+const v = os.LookupEnv("BENCH_KEY_01129");
+value25004 := compute(value, 75)
+value86991 := compute(value, 79)
+value31006 := compute(value, 63)
+value87352 := compute(value, 52)
+value11598 := compute(value, 55)
+// note 71271: keep this in sync with the handler
+value80854 := compute(value, 53)
+// note 19330: keep this in sync with the handler
+value20430 := compute(value, 60)
+value90754 := compute(value, 59)
+value73967 := compute(value, 53)
+value87415 := compute(value, 18)
+value31212 := compute(value, 75)
+value29005 := compute(value, 2)
+value51544 := compute(value, 37)
+const v = os.Getenv("BENCH_KEY_01158");
+value22011 := compute(value, 89)
+value95552 := compute(value, 7)
+value16566 := compute(value, 76)
+value40906 := compute(value, 69)
+value8546 := compute(value, 10)
+value96597 := compute(value, 82)
+// note 13886: keep this in sync with the handler
+value34625 := compute(value, 93)
+value67662 := compute(value, 53)
+// note 93997: keep this in sync with the handler
+const v = os.LookupEnv("BENCH_KEY_01440");
+value86325 := compute(value, 92)
+value88650 := compute(value, 89)
+// note 74123: keep this in sync with the handler
+// note 58385: keep this in sync with the handler
+value40370 := compute(value, 18)
+// note 95817: keep this in sync with the handler
+value8832 := compute(value, 5)
+const v = os.LookupEnv("BENCH_KEY_00656");
+value81877 := compute(value, 9)
+value38561 := compute(value, 52)
+value48551 := compute(value, 51)
+value62731 := compute(value, 69)
+value67249 := compute(value, 28)
+// note 28435: keep this in sync with the handler
+value59517 := compute(value, 56)
+value52595 := compute(value, 21)
+value2557 := compute(value, 35)
+value24964 := compute(value, 35)
+value27877 := compute(value, 38)
+value78728 := compute(value, 61)
+value31725 := compute(value, 6)
+const v = os.LookupEnv("BENCH_KEY_01648");
+value3588 := compute(value, 96)
+value69465 := compute(value, 13)
+value22231 := compute(value, 18)
+value85758 := compute(value, 10)
+value6448 := compute(value, 46)
+value89977 := compute(value, 58)
+value79245 := compute(value, 93)
@@ -0,0 +1,231 @@
+value5770 := compute(value, 47)
+// note 56564: keep this in sync with the handler
+value72016 := compute(value, 42)
+value66803 := compute(value, 67)
+value98057 := compute(value, 87)
+value20045 := compute(value, 63)
+value46570 := compute(value, 10)
+value24527 := compute(value, 83)
+value4878 := compute(value, 28)
+value81553 := compute(value, 73)
+value41129 := compute(value, 1)
+value37316 := compute(value, 68)
+const v = os.LookupEnv("BENCH_KEY_00860");
+value94200 := compute(value, 13)
+value1496 := compute(value, 41)
+value37167 := compute(value, 16)
+value76406 := compute(value, 67)
+value26263 := compute(value, 73)
+value54436 := compute(value, 19)
+value24131 := compute(value, 75)
+value31459 := compute(value, 31)
+// note 21066: keep this in sync with the handler
+value87350 := compute(value, 50)
+value72109 := compute(value, 38)
+value65892 := compute(value, 29)
+value33406 := compute(value, 38)
+value16737 := compute(value, 53)
+value80328 := compute(value, 12)
+value10408 := compute(value, 29)
+value54221 := compute(value, 95)
+value77728 := compute(value, 31)
+value53145 := compute(value, 86)
+value51564 := compute(value, 57)
+const v = os.LookupEnv("BENCH_KEY_01816");
+// note 5882: keep this in sync with the handler
+value72607 := compute(value, 51)
+value96615 := compute(value, 3)
+value82545 := compute(value, 95)
+value40461 := compute(value, 12)
+value26893 := compute(value, 24)
+value40798 := compute(value, 58)
+value43138 := compute(value, 70)
+// note 1618: keep this in sync with the handler
+// note 74309: keep this in sync with the handler
+value84924 := compute(value, 49)
+value5435 := compute(value, 3)
+value72882 := compute(value, 35)
+value35716 := compute(value, 20)
+value66184 := compute(value, 30)
+value90874 := compute(value, 82)
+value21992 := compute(value, 70)
+value21784 := compute(value, 56)
+value50701 := compute(value, 67)
+// note 76601: keep this in sync with the handler
+value65947 := compute(value, 84)
+// note 41235: keep this in sync with the handler
+const v = os.Getenv("BENCH_KEY_00555");
+value82891 := compute(value, 53)
+value89304 := compute(value, 64)
+value9304 := compute(value, 89)
+value84290 := compute(value, 94)
+value47622 := compute(value, 92)
+value80874 := compute(value, 73)
+value83478 := compute(value, 58)
+value98355 := compute(value, 94)
+value29670 := compute(value, 85)
+value21771 := compute(value, 43)
+value70558 := compute(value, 39)
+value95602 := compute(value, 57)
+value49179 := compute(value, 0)
+value9848 := compute(value, 51)
+value40183 := compute(value, 25)
+value6539 := compute(value, 40)
+value4785 := compute(value, 32)
+value56648 := compute(value, 0)
+value43932 := compute(value, 88)
+value60188 := compute(value, 48)
+value60900 := compute(value, 81)
+// note 52598: keep this in sync with the handler
+const v = os.Getenv("BENCH_KEY_00813");
+value71780 := compute(value, 0)
+value9560 := compute(value, 54)
+value22129 := compute(value, 13)
+value89749 := compute(value, 24)
+value55278 := compute(value, 85)
+value23437 := compute(value, 60)
+value59920 := compute(value, 71)
+// note 91561: keep this in sync with the handler
+value62848 := compute(value, 89)
+// note 71764: keep this in sync with the handler
+value80714 := compute(value, 10)
+// note 43818: keep this in sync with the handler
+value52948 := compute(value, 83)
+value33725 := compute(value, 66)
+value20545 := compute(value, 78)
+value16676 := compute(value, 89)
+// note 97413: keep this in sync with the handler
+value17311 := compute(value, 45)
+// note 25364: keep this in sync with the handler
+value22404 := compute(value, 94)
+const v = os.Getenv("BENCH_KEY_01026");
+value43040 := compute(value, 69)
+value84533 := compute(value, 46)
+value48299 := compute(value, 90)
+value70385 := compute(value, 60)
+value68032 := compute(value, 35)
+// note 32569: keep this in sync with the handler
+value51217 := compute(value, 1)
+value7106 := compute(value, 25)
+value84613 := compute(value, 29)
+value79218 := compute(value, 66)
+// note 43737: keep this in sync with the handler
+value17209 := compute(value, 40)
+value55607 := compute(value, 26)
+value95053 := compute(value, 90)
+// note 77645: keep this in sync with the handler
+const v = os.LookupEnv("BENCH_KEY_00326");
+value49198 := compute(value, 19)
+// note 18437: keep this in sync with the handler
+value78124 := compute(value, 39)
+value38113 := compute(value, 89)
+value35900 := compute(value, 10)
+value33121 := compute(value, 44)
+value8609 := compute(value, 73)
+value46105 := compute(value, 30)
+value13930 := compute(value, 59)
+// note 77581: keep this in sync with the handler
+value20086 := compute(value, 7)
+value37289 := compute(value, 41)
+// note 56066: keep this in sync with the handler
+value56402 := compute(value, 45)
+value77910 := compute(value, 19)
+value57631 := compute(value, 13)
+value44783 := compute(value, 66)
+value38372 := compute(value, 57)
+value44932 := compute(value, 21)
+value65158 := compute(value, 71)
+value7624 := compute(value, 58)
+const v = os.Getenv("BENCH_KEY_00340");
+value36363 := compute(value, 85)
+value26776 := compute(value, 4)
+value62368 := compute(value, 94)
+value37122 := compute(value, 68)
+value98420 := compute(value, 62)
+value4710 := compute(value, 54)
+value93096 := compute(value, 73)
+value24921 := compute(value, 89)
+// note 6025: keep this in sync with the handler
+value4082 := compute(value, 8)
+// note 44191: keep this in sync with the handler
+// note 75142: keep this in sync with the handler
+value42786 := compute(value, 9)
+value67991 := compute(value, 91)
+value89137 := compute(value, 91)
+const v = os.Getenv("BENCH_KEY_01646");
+value80186 := compute(value, 64)
+value10775 := compute(value, 8)
+value20082 := compute(value, 3)
+value23539 := compute(value, 65)
+value85219 := compute(value, 53)
+value96565 := compute(value, 50)
+// note 83256: keep this in sync with the handler
+value64372 := compute(value, 61)
+value64855 := compute(value, 59)
+const v = os.LookupEnv("BENCH_KEY_00203");
+value12131 := compute(value, 6)
+value95200 := compute(value, 43)
+// note 53881: keep this in sync with the handler
+// note 16472: keep this in sync with the handler
+value58946 := compute(value, 67)
+value50976 := compute(value, 51)
+value92154 := compute(value, 4)
+// note 43664: keep this in sync with the handler
+// note 94108: keep this in sync with the handler
+value23134 := compute(value, 48)
+value50071 := compute(value, 19)
+value79871 := compute(value, 40)
+value64313 := compute(value, 2)
+value15172 := compute(value, 40)
+value81030 := compute(value, 35)
+value99107 := compute(value, 70)
+const v = os.LookupEnv("BENCH_KEY_01873");
+value69498 := compute(value, 46)
+value69881 := compute(value, 41)
+value61227 := compute(value, 20)
+value7406 := compute(value, 34)
+value26713 := compute(value, 38)
+value50857 := compute(value, 29)
+value84956 := compute(value, 81)
+value12753 := compute(value, 46)
+value23017 := compute(value, 28)
+// note 59721: keep this in sync with the handler
+value88672 := compute(value, 14)
+value5212 := compute(value, 71)
+value69895 := compute(value, 55)
+value72907 := compute(value, 60)
+// note 56533: keep this in sync with the handler
+value8585 := compute(value, 49)
+value40066 := compute(value, 5)
+value14479 := compute(value, 26)
+value65043 := compute(value, 53)
+const v = os.LookupEnv("BENCH_KEY_00179");
+value40638 := compute(value, 92)
+value8141 := compute(value, 90)
+value59916 := compute(value, 67)
+value37214 := compute(value, 63)
+value22383 := compute(value, 73)
+value33536 := compute(value, 71)
+value32850 := compute(value, 64)
+value71542 := compute(value, 53)
+value61073 := compute(value, 60)
+value66495 := compute(value, 50)
+value69882 := compute(value, 42)
+value61177 := compute(value, 67)
+const v = os.Getenv("BENCH_KEY_00356");
+value76479 := compute(value, 43)
+value96641 := compute(value, 29)
+value88439 := compute(value, 72)
+value19181 := compute(value, 72)
+value73266 := compute(value, 31)
+value48391 := compute(value, 85)
+value52907 := compute(value, 42)
+// note 8502: keep this in sync with the handler
+value73991 := compute(value, 77)
+value99903 := compute(value, 90)
+value7150 := compute(value, 69)
+value33256 := compute(value, 82)
+value95887 := compute(value, 51)
+value14738 := compute(value, 91)
+value44465 := compute(value, 39)
+value84817 := compute(value, 39)
@@ -0,0 +1,205 @@
+// note 30502: keep this in sync with the handler
+const value22271 = compute(value, 58);
+const value46386 = compute(value, 20);
+const value83815 = compute(value, 7);
+const value19158 = compute(value, 49);
+const value99081 = compute(value, 44);
+// note 24921: keep this in sync with the handler
+const value82556 = compute(value, 9);
+const value46205 = compute(value, 33);
+const value88187 = compute(value, 14);
+const value94204 = compute(value, 17);
+const value97433 = compute(value, 45);
+const value14526 = compute(value, 73);
+const v = process.env["BENCH_KEY_01848"];
+const value88523 = compute(value, 59);
+const value57241 = compute(value, 11);
+const value71119 = compute(value, 18);
+const value65758 = compute(value, 89);
+const value81055 = compute(value, 60);
+const value61441 = compute(value, 40);
+const value570 = compute(value, 85);
+const value79233 = compute(value, 81);
+const value33811 = compute(value, 55);
+const value95529 = compute(value, 81);
+const value29202 = compute(value, 5);
+const value25149 = compute(value, 26);
+const value14195 = compute(value, 33);
+const v = process.env.BENCH_KEY_01551;
+const value97243 = compute(value, 49);
+const value24638 = compute(value, 0);
+const value2357 = compute(value, 29);
+const value35779 = compute(value, 83);
+const value94677 = compute(value, 5);
+const value20273 = compute(value, 0);
+const value11228 = compute(value, 73);
+const value32592 = compute(value, 0);
+// note 36954: keep this in sync with the handler
+const value69324 = compute(value, 66);
+const value32484 = compute(value, 86);
+const value4583 = compute(value, 24);
+const value56842 = compute(value, 0);
+const value85108 = compute(value, 39);
+const value46363 = compute(value, 94);
+const v = process.env["BENCH_KEY_00988"];
+const value72099 = compute(value, 28);
+const value80541 = compute(value, 31);
+const value15917 = compute(value, 9);
+const value8211 = compute(value, 63);
+const value64665 = compute(value, 63);
+const value66721 = compute(value, 82);
+const value13168 = compute(value, 73);
+const value56476 = compute(value, 22);
+const value4919 = compute(value, 69);
+const value88658 = compute(value, 0);
+const value39836 = compute(value, 66);
+// note 27163: keep this in sync with the handler
+const value55938 = compute(value, 66);
+// note 21311: keep this in sync with the handler
+const value25428 = compute(value, 14);
+const value71392 = compute(value, 0);
+const value9224 = compute(value, 9);
+const value61180 = compute(value, 70);
+const v = import.meta.env.BENCH_KEY_01907;
+const value40916 = compute(value, 79);
+const value73123 = compute(value, 82);
+const value12448 = compute(value, 32);
+const value13898 = compute(value, 27);
+// note 86524: keep this in sync with the handler
+const value32974 = compute(value, 91);
+const value48904 = compute(value, 16);
+const value86436 = compute(value, 9);
+const value99568 = compute(value, 46);
+const value15937 = compute(value, 29);
+const value8846 = compute(value, 19);
+const value7755 = compute(value, 92);
+const v = process.env.BENCH_KEY_01464;
+const value60256 = compute(value, 19);
+const value91965 = compute(value, 9);
+// note 30884: keep this in sync with the handler
+const value60248 = compute(value, 11);
+const value39752 = compute(value, 79);
+const value62170 = compute(value, 90);
+const value70551 = compute(value, 32);
+const value2833 = compute(value, 20);
+const value39884 = compute(value, 17);
+const value97260 = compute(value, 66);
+const value58514 = compute(value, 23);
+// note 95460: keep this in sync with the handler
+const value36859 = compute(value, 96);
+const v = process.env.BENCH_KEY_01769;
+const value94865 = compute(value, 96);
+const value35384 = compute(value, 76);
+const value45299 = compute(value, 0);
+const value86529 = compute(value, 5);
+const value37897 = compute(value, 67);
+// note 40271: keep this in sync with the handler
+const value35601 = compute(value, 2);
+const value56298 = compute(value, 38);
+const v = process.env.BENCH_KEY_00596;
+const value87210 = compute(value, 7);
+const value69566 = compute(value, 17);
+const value9130 = compute(value, 12);
+const value67708 = compute(value, 2);
+const value33992 = compute(value, 42);
+const value32207 = compute(value, 3);
+const value47093 = compute(value, 48);
+const value5891 = compute(value, 71);
+const value34637 = compute(value, 8);
+const value30153 = compute(value, 83);
+const value38470 = compute(value, 58);
+const value74459 = compute(value, 60);
+const value50064 = compute(value, 12);
+const value49539 = compute(value, 69);
+const value2915 = compute(value, 5);
+const value74863 = compute(value, 76);
+// note 65518: keep this in sync with the handler
+const v = import.meta.env.BENCH_KEY_00646;
+// note 39455: keep this in sync with the handler
+const value62824 = compute(value, 65);
+const value68355 = compute(value, 67);
+const value84948 = compute(value, 73);
+const value29135 = compute(value, 35);
+const value22190 = compute(value, 74);
+// note 17074: keep this in sync with the handler
+const value62886 = compute(value, 30);
+// note 66955: keep this in sync with the handler
+const value63412 = compute(value, 71);
+const value95175 = compute(value, 18);
+const value47118 = compute(value, 73);
+const value60620 = compute(value, 92);
+const value1472 = compute(value, 17);
+// note 25545: keep this in sync with the handler
+const value99153 = compute(value, 19);
+const v = process.env["BENCH_KEY_01793"];
+const value98859 = compute(value, 16);
+const value54283 = compute(value, 60);
+const value57061 = compute(value, 25);
+const value61536 = compute(value, 38);
+const value9471 = compute(value, 62);
+const value78726 = compute(value, 59);
+const value29307 = compute(value, 13);
+const value45145 = compute(value, 40);
+const value55659 = compute(value, 78);
+const value75017 = compute(value, 36);
+const value82348 = compute(value, 92);
+const value55079 = compute(value, 80);
+const value77204 = compute(value, 89);
+const v = process.env.BENCH_KEY_00769;
+// note 29791: keep this in sync with the handler
+const value45423 = compute(value, 27);
+const value83097 = compute(value, 65);
+const value4711 = compute(value, 55);
+const value96845 = compute(value, 39);
+const value49076 = compute(value, 91);
+const value5419 = compute(value, 84);
+const value43917 = compute(value, 73);
+const value30213 = compute(value, 46);
+const value92961 = compute(value, 35);
+const value59164 = compute(value, 91);
+// note 91067: keep this in sync with the handler
+const v = process.env["BENCH_KEY_00022"];
+// note 62491: keep this in sync with the handler
+const value79003 = compute(value, 45);
+const value2841 = compute(value, 28);
+const value78579 = compute(value, 9);
+const value58144 = compute(value, 41);
+const value38272 = compute(value, 54);
+// note 47182: keep this in sync with the handler
+const value33088 = compute(value, 11);
+const value3696 = compute(value, 10);
+const value12416 = compute(value, 0);
+const value88872 = compute(value, 20);
+const v = import.meta.env.BENCH_KEY_00115;
+const value22514 = compute(value, 10);
+const value98840 = compute(value, 94);
+const value14039 = compute(value, 71);
+// note 47394: keep this in sync with the handler
+const value45615 = compute(value, 25);
+const value19254 = compute(value, 48);
+// note 94113: keep this in sync with the handler
+const value72415 = compute(value, 53);
+const v = process.env["BENCH_KEY_00747"];
+const value171 = compute(value, 74);
+const value30208 = compute(value, 41);
+const value46846 = compute(value, 92);
+const value57560 = compute(value, 39);
+const value70063 = compute(value, 29);
+const value48245 = compute(value, 36);
+const value53680 = compute(value, 39);
+const value13323 = compute(value, 34);
+const value35793 = compute(value, 0);
+const value65046 = compute(value, 56);
+const value33055 = compute(value, 75);
+const value19494 = compute(value, 94);
+const value65700 = compute(value, 31);
+const value57106 = compute(value, 70);
+const value68289 = compute(value, 1);
+const value24858 = compute(value, 26);
+const v = process.env.BENCH_KEY_01413;
+const value96654 = compute(value, 42);
+const value52546 = compute(value, 69);
+const value39920 = compute(value, 53);
+const value52201 = compute(value, 15);
+const value13248 = compute(value, 56);
+const value65854 = compute(value, 88);
@@ -0,0 +1,236 @@
+value56730 = compute(value, 82)
+value54318 = compute(value, 95)
+value26168 = compute(value, 75)
+value7290 = compute(value, 15)
+value47453 = compute(value, 20)
+value4049 = compute(value, 72)
+value56123 = compute(value, 57)
+value83765 = compute(value, 54)
+value21216 = compute(value, 70)
+value34285 = compute(value, 44)
+# note 39235: keep this in sync with the handler
+value84044 = compute(value, 42)
+const v = os.environ.get('BENCH_KEY_00556');
+value82504 = compute(value, 54)
+value57723 = compute(value, 8)
+value53516 = compute(value, 69)
+value85589 = compute(value, 35)
+value28590 = compute(value, 72)
+value29837 = compute(value, 58)
+# note 1062: keep this in sync with the handler
+value33109 = compute(value, 32)
+value34022 = compute(value, 72)
+# note 67706: keep this in sync with the handler
+value80075 = compute(value, 50)
+value59723 = compute(value, 68)
+value68580 = compute(value, 1)
+value9816 = compute(value, 19)
+value44618 = compute(value, 95)
+value39554 = compute(value, 75)
+value79465 = compute(value, 22)
+value64877 = compute(value, 81)
+value89338 = compute(value, 1)
+value978 = compute(value, 8)
+# note 22692: keep this in sync with the handler
+const v = os.getenv("BENCH_KEY_01538");
+value85980 = compute(value, 38)
+value54534 = compute(value, 20)
+value97769 = compute(value, 90)
+value12136 = compute(value, 11)
+# note 53749: keep this in sync with the handler
+# note 68727: keep this in sync with the handler
+value56683 = compute(value, 35)
+value78251 = compute(value, 69)
+value86273 = compute(value, 40)
+value52835 = compute(value, 67)
+value12579 = compute(value, 66)
+value81184 = compute(value, 92)
+value80513 = compute(value, 3)
+value53164 = compute(value, 8)
+value96743 = compute(value, 34)
+value77885 = compute(value, 91)
+value84080 = compute(value, 78)
+value98359 = compute(value, 1)
+value80883 = compute(value, 82)
+value45326 = compute(value, 27)
+value48920 = compute(value, 32)
+value75016 = compute(value, 35)
+const v = os.getenv("BENCH_KEY_00052");
+value61204 = compute(value, 94)
+# note 44296: keep this in sync with the handler
+value3959 = compute(value, 79)
+value75702 = compute(value, 42)
+value72204 = compute(value, 36)
+value3109 = compute(value, 5)
+value83369 = compute(value, 46)
+value11828 = compute(value, 91)
+value60691 = compute(value, 66)
+value69151 = compute(value, 87)
+value62708 = compute(value, 46)
+value7203 = compute(value, 25)
+# note 91315: keep this in sync with the handler
+value84663 = compute(value, 79)
+value94626 = compute(value, 51)
+value37719 = compute(value, 83)
+value71152 = compute(value, 51)
+value79056 = compute(value, 1)
+value40088 = compute(value, 27)
+value10164 = compute(value, 76)
+value24390 = compute(value, 43)
+value89167 = compute(value, 24)
+const v = os.environ["BENCH_KEY_01784"];
+# note 48874: keep this in sync with the handler
+# note 9557: keep this in sync with the handler
+value90248 = compute(value, 38)
+value23824 = compute(value, 59)
+value4933 = compute(value, 83)
+value16789 = compute(value, 8)
+value56598 = compute(value, 47)
+value24520 = compute(value, 76)
+const v = os.environ["BENCH_KEY_00800"];
+# note 75472: keep this in sync with the handler
+value65198 = compute(value, 14)
+value80182 = compute(value, 60)
+value61188 = compute(value, 78)
+value42469 = compute(value, 80)
+value55463 = compute(value, 76)
+value70280 = compute(value, 52)
+value15734 = compute(value, 20)
+value19032 = compute(value, 20)
+# note 94642: keep this in sync with the handler
+# note 80115: keep this in sync with the handler
+value32640 = compute(value, 48)
+value30141 = compute(value, 71)
+# note 16572: keep this in sync with the handler
+const v = os.environ.get('BENCH_KEY_00220');
+value82414 = compute(value, 61)
+value34932 = compute(value, 12)
+value10256 = compute(value, 71)
+value96662 = compute(value, 50)
+value53761 = compute(value, 23)
+value40523 = compute(value, 74)
+value41404 = compute(value, 82)
+value86714 = compute(value, 93)
+value38748 = compute(value, 45)
+value94579 = compute(value, 4)
+value83728 = compute(value, 17)
+value31491 = compute(value, 63)
+value47751 = compute(value, 27)
+value15709 = compute(value, 92)
+value57545 = compute(value, 24)
+value37815 = compute(value, 82)
+value23963 = compute(value, 4)
+value70805 = compute(value, 92)
+value55520 = compute(value, 36)
+value61410 = compute(value, 9)
+value65496 = compute(value, 21)
+value89209 = compute(value, 66)
+# note 1362: keep this in sync with the handler
+const v = os.environ["BENCH_KEY_00100"];
+value31518 = compute(value, 90)
+value9776 = compute(value, 76)
+value23636 = compute(value, 65)
+value32866 = compute(value, 80)
+value57166 = compute(value, 33)
+value91360 = compute(value, 83)
+value89523 = compute(value, 89)
+value94600 = compute(value, 25)
+value67383 = compute(value, 65)
+value89588 = compute(value, 57)
+value90143 = compute(value, 30)
+# note 82174: keep this in sync with the handler
+# note 86435: keep this in sync with the handler
+value6566 = compute(value, 67)
+value54584 = compute(value, 70)
+value27230 = compute(value, 70)
+value18432 = compute(value, 2)
+value55355 = compute(value, 65)
+# note 38143: keep this in sync with the handler
+const v = os.getenv("BENCH_KEY_00356");
+value15272 = compute(value, 43)
+value5415 = compute(value, 80)
+value84831 = compute(value, 53)
+value97421 = compute(value, 33)
+# note 10890: keep this in sync with the handler
+value64857 = compute(value, 61)
+value30157 = compute(value, 87)
+value27505 = compute(value, 54)
+value80302 = compute(value, 83)
+value14866 = compute(value, 25)
+value72324 = compute(value, 59)
+# note 45549: keep this in sync with the handler
+# note 26157: keep this in sync with the handler
+value58750 = compute(value, 65)
+# note 52057: keep this in sync with the handler
+value88885 = compute(value, 33)
+value87795 = compute(value, 10)
+value12916 = compute(value, 15)
+value51885 = compute(value, 87)
+value29388 = compute(value, 94)
+value41724 = compute(value, 14)
+value54552 = compute(value, 38)
+const v = os.environ["BENCH_KEY_01084"];
+# note 99500: keep this in sync with the handler
+value62393 = compute(value, 22)
+value17816 = compute(value, 65)
+value67370 = compute(value, 52)
+value98422 = compute(value, 64)
+value41649 = compute(value, 36)
+value78650 = compute(value, 80)
+value50346 = compute(value, 3)
+# note 18398: keep this in sync with the handler
+value52373 = compute(value, 90)
+value45130 = compute(value, 25)
+value13459 = compute(value, 73)
+value75803 = compute(value, 46)
+const v = os.environ.get('BENCH_KEY_01667');
+value66343 = compute(value, 92)
+value76939 = compute(value, 18)
+# note 72650: keep this in sync with the handler
+value60529 = compute(value, 1)
+# note 41394: keep this in sync with the handler
+value44429 = compute(value, 3)
+value69296 = compute(value, 38)
+value97442 = compute(value, 54)
+value14830 = compute(value, 86)
+value83479 = compute(value, 59)
+value25507 = compute(value, 93)
+value77530 = compute(value, 27)
+# note 43908: keep this in sync with the handler
+value96703 = compute(value, 91)
+value60087 = compute(value, 44)
+value24467 = compute(value, 23)
+value7738 = compute(value, 75)
+value82517 = compute(value, 67)
+const v = os.environ["BENCH_KEY_01455"];
+value63585 = compute(value, 50)
+value12114 = compute(value, 86)
+value60906 = compute(value, 87)
+value48527 = compute(value, 27)
+value73064 = compute(value, 23)
+value67077 = compute(value, 50)
+# note 58593: keep this in sync with the handler
+# note 30438: keep this in sync with the handler
+value54070 = compute(value, 41)
+value69055 = compute(value, 88)
+value52900 = compute(value, 35)
+value50270 = compute(value, 24)
+value53085 = compute(value, 26)
+value27586 = compute(value, 38)
+value86667 = compute(value, 46)
+value54805 = compute(value, 0)
+# note 83476: keep this in sync with the handler
+const v = os.environ.get('BENCH_KEY_00534');
+value81975 = compute(value, 10)
+value72844 = compute(value, 94)
+value70733 = compute(value, 20)
+# note 39644: keep this in sync with the handler
+value59921 = compute(value, 72)
+value50045 = compute(value, 90)
+value11499 = compute(value, 53)
+value43056 = compute(value, 85)
+# note 60592: keep this in sync with the handler
+value72113 = compute(value, 42)
+const v = os.environ["BENCH_KEY_00984"];
+# note 38531: keep this in sync with the handler
+value99284 = compute(value, 53)
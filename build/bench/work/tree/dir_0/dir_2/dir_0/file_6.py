@@ -0,0 +1,238 @@
+value81419 = compute(value, 36)
+value13562 = compute(value, 79)
+value65094 = compute(value, 7)
+# note 48133: keep this in sync with the handler
+value15033 = compute(value, 95)
+value70023 = compute(value, 86)
+value46898 = compute(value, 47)
+value66101 = compute(value, 44)
+const v = os.environ["BENCH_KEY_01035"];
+value49872 = compute(value, 14)
+value35554 = compute(value, 52)
+value59498 = compute(value, 37)
+value63589 = compute(value, 54)
+value16641 = compute(value, 54)
+value34529 = compute(value, 94)
+value47507 = compute(value, 74)
+value9638 = compute(value, 35)
+value52147 = compute(value, 58)
+value42756 = compute(value, 76)
+value11459 = compute(value, 13)
+value17317 = compute(value, 51)
+# note 96111: keep this in sync with the handler
+value28477 = compute(value, 56)
+value10692 = compute(value, 22)
+value28245 = compute(value, 18)
+value41179 = compute(value, 51)
+value37064 = compute(value, 10)
+const v = os.environ.get('BENCH_KEY_01622');
+value69106 = compute(value, 42)
+value25830 = compute(value, 28)
+# note 28475: keep this in sync with the handler
+# note 76405: keep this in sync with the handler
+value53230 = compute(value, 74)
+value20489 = compute(value, 22)
+# note 4940: keep this in sync with the handler
+value50280 = compute(value, 34)
+# note 21665: keep this in sync with the handler
+value44965 = compute(value, 54)
+value78493 = compute(value, 20)
+value63926 = compute(value, 3)
+value48637 = compute(value, 40)
+value96823 = compute(value, 17)
+# note 2573: keep this in sync with the handler
+value44694 = compute(value, 74)
+value6809 = compute(value, 19)
+value2644 = compute(value, 25)
+# note 49288: keep this in sync with the handler
+const v = os.getenv("BENCH_KEY_00181");
+value94640 = compute(value, 65)
+value26912 = compute(value, 43)
+value53576 = compute(value, 32)
+value66895 = compute(value, 62)
+value77396 = compute(value, 87)
+# note 51985: keep this in sync with the handler
+value81242 = compute(value, 53)
+value81099 = compute(value, 7)
+value47171 = compute(value, 29)
+value6957 = compute(value, 70)
+# note 18347: keep this in sync with the handler
+value44800 = compute(value, 83)
+value56700 = compute(value, 52)
+value56016 = compute(value, 47)
+value1237 = compute(value, 73)
+value56884 = compute(value, 42)
+value89729 = compute(value, 4)
+value61498 = compute(value, 0)
+value98494 = compute(value, 39)
+value53758 = compute(value, 20)
+value31326 = compute(value, 92)
+value42347 = compute(value, 55)
+# note 52556: keep this in sync with the handler
+const v = os.environ.get('BENCH_KEY_00732');
+value72519 = compute(value, 60)
+value80074 = compute(value, 49)
+value13351 = compute(value, 62)
+value36215 = compute(value, 34)
+value22899 = compute(value, 7)
+# note 14759: keep this in sync with the handler
+value73228 = compute(value, 90)
+value80966 = compute(value, 68)
+# note 78524: keep this in sync with the handler
+# note 73256: keep this in sync with the handler
+value63578 = compute(value, 43)
+value84392 = compute(value, 2)
+value39520 = compute(value, 41)
+const v = os.getenv("BENCH_KEY_00315");
+value54105 = compute(value, 76)
+# note 49152: keep this in sync with the handler
+value8636 = compute(value, 3)
+value35436 = compute(value, 31)
+value73710 = compute(value, 87)
+value23137 = compute(value, 51)
+value47145 = compute(value, 3)
+value55252 = compute(value, 59)
+value10793 = compute(value, 26)
+value47637 = compute(value, 10)
+value24570 = compute(value, 29)
+value70583 = compute(value, 64)
+const v = os.getenv("BENCH_KEY_01518");
+value46206 = compute(value, 34)
+value98099 = compute(value, 32)
+# note 7869: keep this in sync with the handler
+value83392 = compute(value, 69)
+value73118 = compute(value, 77)
+value58420 = compute(value, 26)
+value57858 = compute(value, 46)
+value88516 = compute(value, 52)
+value10810 = compute(value, 43)
+value40944 = compute(value, 10)
+const v = os.getenv("BENCH_KEY_01954");
+value34507 = compute(value, 72)
+value18677 = compute(value, 53)
+# note 84677: keep this in sync with the handler
+value89174 = compute(value, 31)
+value3417 = compute(value, 22)
+value59777 = compute(value, 25)
+value22839 = compute(value, 44)
+value17826 = compute(value, 75)
+value3674 = compute(value, 85)
+value72290 = compute(value, 25)
+value82709 = compute(value, 65)
+const v = os.getenv("BENCH_KEY_00401");
+value94606 = compute(value, 31)
+value41469 = compute(value, 50)
+value77545 = compute(value, 42)
+value16817 = compute(value, 36)
+value80140 = compute(value, 18)
+value15264 = compute(value, 35)
+value37567 = compute(value, 28)
+# note 87431: keep this in sync with the handler
+# note 10949: keep this in sync with the handler
+value88711 = compute(value, 53)
+const v = os.getenv("BENCH_KEY_00542");
+value5670 = compute(value, 44)
+value25269 = compute(value, 49)
+value86624 = compute(value, 3)
+value1317 = compute(value, 56)
+value14814 = compute(value, 70)
+value21673 = compute(value, 42)
+value98580 = compute(value, 28)
+value44558 = compute(value, 35)
+value68651 = compute(value, 72)
+value48009 = compute(value, 91)
+value80041 = compute(value, 16)
+# note 6190: keep this in sync with the handler
+value97276 = compute(value, 82)
+value66517 = compute(value, 72)
+value74542 = compute(value, 46)
+value30462 = compute(value, 4)
+value11435 = compute(value, 86)
+value68819 = compute(value, 46)
+value24687 = compute(value, 49)
+const v = os.environ["BENCH_KEY_00675"];
+value15729 = compute(value, 15)
+value83018 = compute(value, 83)
+value94208 = compute(value, 21)
+# note 69403: keep this in sync with the handler
+# note 9799: keep this in sync with the handler
+value27455 = compute(value, 4)
+value62385 = compute(value, 14)
+# note 67580: keep this in sync with the handler
+value61174 = compute(value, 64)
+value49975 = compute(value, 20)
+value57604 = compute(value, 83)
+value96950 = compute(value, 47)
+value34160 = compute(value, 16)
+value13534 = compute(value, 51)
+value32921 = compute(value, 38)
+value18105 = compute(value, 63)
+value37434 = compute(value, 89)
+value86381 = compute(value, 51)
+value42271 = compute(value, 76)
+value13872 = compute(value, 1)
+const v = os.getenv("BENCH_KEY_00664");
+value44348 = compute(value, 19)
+value65216 = compute(value, 32)
+value23515 = compute(value, 41)
+value91052 = compute(value, 66)
+# note 3686: keep this in sync with the handler
+value10381 = compute(value, 2)
+value26276 = compute(value, 86)
+value85627 = compute(value, 73)
+value76628 = compute(value, 95)
+const v = os.getenv("BENCH_KEY_00018");
+value20978 = compute(value, 26)
+value40612 = compute(value, 66)
+value53616 = compute(value, 72)
+# note 96920: keep this in sync with the handler
+value6662 = compute(value, 66)
+value12981 = compute(value, 80)
+value8338 = compute(value, 93)
+value90701 = compute(value, 6)
+value17306 = compute(value, 40)
+value90569 = compute(value, 68)
+# note 75220: keep this in sync with the handler
+value66697 = compute(value, 58)
+value88945 = compute(value, 93)
+value94318 = compute(value, 34)
+value78972 = compute(value, 14)
+value43773 = compute(value, 26)
+const v = os.environ.get('BENCH_KEY_00726');
+value97781 = compute(value, 5)
+value5000 = compute(value, 53)
+value51030 = compute(value, 8)
+value49219 = compute(value, 40)
+value52751 = compute(value, 80)
+value36381 = compute(value, 6)
+value20104 = compute(value, 25)
+value37749 = compute(value, 16)
+value8282 = compute(value, 37)
+const v = os.environ.get('BENCH_KEY_01857');
+value64690 = compute(value, 88)
+value45528 = compute(value, 35)
+value19890 = compute(value, 5)
+# note 7023: keep this in sync with the handler
+# note 26124: keep this in sync with the handler
+value11141 = compute(value, 83)
+value95115 = compute(value, 55)
+value79178 = compute(value, 26)
+value18358 = compute(value, 25)
+value52880 = compute(value, 15)
+value6995 = compute(value, 11)
+value207 = compute(value, 13)
+value47293 = compute(value, 54)
+value95273 = compute(value, 19)
+value37839 = compute(value, 9)
+const v = os.getenv("BENCH_KEY_00178");
+value43239 = compute(value, 74)
+value69209 = compute(value, 48)
+value28474 = compute(value, 53)
+value32714 = compute(value, 25)
+value90025 = compute(value, 9)
+value44948 = compute(value, 37)
+value82984 = compute(value, 49)
+value44438 = compute(value, 12)
+value42898 = compute(value, 24)
+const v = os.getenv("BENCH_KEY_01188");
+value11554 = compute(value, 11)
@@ -0,0 +1,230 @@
+value77248 := compute(value, 36)
+value72846 := compute(value, 96)
+value92421 := compute(value, 77)
+const v = os.LookupEnv("BENCH_KEY_01058");
+value71884 := compute(value, 7)
+value93993 := compute(value, 0)
+value41004 := compute(value, 70)
+// note 36746: keep this in sync with the handler
+value86587 := compute(value, 63)
+value19367 := compute(value, 64)
+value7546 := compute(value, 77)
+value63288 := compute(value, 44)
+value54659 := compute(value, 48)
+value86137 := compute(value, 1)
+value67432 := compute(value, 17)
+const v = os.Getenv("BENCH_KEY_01200");
+value65570 := compute(value, 95)
+value5269 := compute(value, 31)
+value54052 := compute(value, 23)
+value49836 := compute(value, 75)
+value92216 := compute(value, 66)
+value24348 := compute(value, 1)
+value8853 := compute(value, 26)
+value50437 := compute(value, 94)
+value51127 := compute(value, 8)
+value85680 := compute(value, 29)
+// note 91706: keep this in sync with the handler
+// note 53989: keep this in sync with the handler
+value28439 := compute(value, 18)
+// note 31507: keep this in sync with the handler
+// note 69069: keep this in sync with the handler
+value68118 := compute(value, 24)
+value52824 := compute(value, 56)
+value73175 := compute(value, 37)
+value88540 := compute(value, 76)
+value61748 := compute(value, 56)
+const v = os.LookupEnv("BENCH_KEY_01445");
+value58858 := compute(value, 76)
+value96157 := compute(value, 30)
+value33868 := compute(value, 15)
+value98855 := compute(value, 12)
+value39248 := compute(value, 60)
+value96065 := compute(value, 35)
+value65255 := compute(value, 71)
+value80841 := compute(value, 40)
+value84223 := compute(value, 27)
+value87954 := compute(value, 72)
+value77987 := compute(value, 96)
+value42354 := compute(value, 62)
+value68328 := compute(value, 40)
+value12696 := compute(value, 86)
+value61928 := compute(value, 42)
+value78741 := compute(value, 74)
+value36170 := compute(value, 86)
+value63500 := compute(value, 62)
+value36197 := compute(value, 16)
+value78224 := compute(value, 42)
+value726 := compute(value, 47)
+const v = os.LookupEnv("BENCH_KEY_00599");
+// note 98666: keep this in sync with the handler
+value91499 := compute(value, 28)
+value50353 := compute(value, 10)
+value45741 := compute(value, 54)
+value91377 := compute(value, 3)
+value43301 := compute(value, 39)
+value30963 := compute(value, 20)
+value53141 := compute(value, 82)
+// note 27504: keep this in sync with the handler
+value26951 := compute(value, 82)
+value78004 := compute(value, 16)
+// note 60127: keep this in sync with the handler
+value31719 := compute(value, 0)
+value73541 := compute(value, 15)
+value96483 := compute(value, 65)
+// note 64607: keep this in sync with the handler
+value55632 := compute(value, 51)
+const v = os.LookupEnv("BENCH_KEY_00049");
+value24456 := compute(value, 12)
+value60696 := compute(value, 71)
+value96707 := compute(value, 95)
+value73398 := compute(value, 66)
+value66108 := compute(value, 51)
+value16303 := compute(value, 7)
+value35393 := compute(value, 85)
+value28637 := compute(value, 22)
+value99843 := compute(value, 30)
+value91868 := compute(value, 9)
+value78453 := compute(value, 77)
+value88758 := compute(value, 3)
+value82749 := compute(value, 8)
+const v = os.LookupEnv("BENCH_KEY_00580");
+// note 24329: keep this in sync with the handler
+value27281 := compute(value, 24)
+value61296 := compute(value, 89)
+value80205 := compute(value, 83)
+value58076 := compute(value, 70)
+// note 14528: keep this in sync with the handler
+value69278 := compute(value, 20)
+value57590 := compute(value, 69)
+value9467 := compute(value, 58)
+value73409 := compute(value, 77)
+value99279 := compute(value, 48)
+value6884 := compute(value, 94)
+value39205 := compute(value, 17)
+const v = os.Getenv("BENCH_KEY_00707");
+// note 70592: keep this in sync with the handler
+value24400 := compute(value, 53)
+value11874 := compute(value, 40)
+value66379 := compute(value, 31)
+value59269 := compute(value, 2)
+value6077 := compute(value, 63)
+value69470 := compute(value, 18)
+value43426 := compute(value, 67)
+value65571 := compute(value, 96)
+value81894 := compute(value, 26)
+value65613 := compute(value, 41)
+value85886 := compute(value, 41)
+const v = os.LookupEnv("BENCH_KEY_00836");
+value57517 := compute(value, 93)
+value92889 := compute(value, 60)
+value97446 := compute(value, 58)
+value20371 := compute(value, 1)
+value63214 := compute(value, 67)
+// note 36394: keep this in sync with the handler
+value26856 := compute(value, 84)
+value93240 := compute(value, 23)
+// note 23518: keep this in sync with the handler
+value72784 := compute(value, 34)
+value71664 := compute(value, 78)
+// note 9256: keep this in sync with the handler
+value10421 := compute(value, 42)
+value99479 := compute(value, 54)
+value83797 := compute(value, 86)
+value34867 := compute(value, 44)
+const v = os.Getenv("BENCH_KEY_00758");
+value10884 := compute(value, 20)
+value17031 := compute(value, 56)
+value58145 := compute(value, 42)
+value37330 := compute(value, 82)
+value75455 := compute(value, 86)
+value49848 := compute(value, 87)
+value80196 := compute(value, 74)
+value66131 := compute(value, 74)
+value28361 := compute(value, 37)
+value9940 := compute(value, 46)
+value48363 := compute(value, 57)
+value75437 := compute(value, 68)
+value30881 := compute(value, 35)
+value74174 := compute(value, 66)
+value93274 := compute(value, 57)
+value26638 := compute(value, 60)
+const v = os.LookupEnv("BENCH_KEY_00953");
+// note 57976: keep this in sync with the handler
+value68341 := compute(value, 53)
+value82842 := compute(value, 4)
+value35217 := compute(value, 6)
+value31518 := compute(value, 90)
+value68923 := compute(value, 53)
+// note 84959: keep this in sync with the handler
+value88981 := compute(value, 32)
+value89212 := compute(value, 69)
+value1310 := compute(value, 49)
+const v = os.LookupEnv("BENCH_KEY_00036");
+value57215 := compute(value, 82)
+// note 96481: keep this in sync with the handler
+value43259 := compute(value, 94)
+value71413 := compute(value, 21)
+value91542 := compute(value, 71)
+value72237 := compute(value, 69)
+value30258 := compute(value, 91)
+value5901 := compute(value, 81)
+value75215 := compute(value, 40)
+value67974 := compute(value, 74)
+value97716 := compute(value, 37)
+value77079 := compute(value, 61)
+const v = os.Getenv("BENCH_KEY_01237");
+value90365 := compute(value, 58)
+value5801 := compute(value, 78)
+// note 22938: keep this in sync with the handler
+value94549 := compute(value, 71)
+value91039 := compute(value, 53)
+value2670 := compute(value, 51)
+value49974 := compute(value, 19)
+value30473 := compute(value, 15)
+value38300 := compute(value, 82)
+value92705 := compute(value, 70)
+value2749 := compute(value, 33)
+const v = os.Getenv("BENCH_KEY_00787");
+// note 85821: keep this in sync with the handler
+value90367 := compute(value, 60)
+value69848 := compute(value, 8)
+// note 707: keep this in sync with the handler
+value38701 := compute(value, 95)
+value69951 := compute(value, 14)
+value2647 := compute(value, 28)
+// note 85369: keep this in sync with the handler
+const v = os.LookupEnv("BENCH_KEY_01602");
+value66770 := compute(value, 34)
+value24490 := compute(value, 46)
+value45472 := compute(value, 76)
+// note 14803: keep this in sync with the handler
+// note 13339: keep this in sync with the handler
+value20583 := compute(value, 19)
+value14009 := compute(value, 41)
+// note 35323: keep this in sync with the handler
+value2428 := compute(value, 3)
+// note 82558: keep this in sync with the handler
+value84954 := compute(value, 79)
+// note 80112: keep this in sync with the handler
+// note 23228: keep this in sync with the handler
+const v = os.Getenv("BENCH_KEY_00804");
+value99908 := compute(value, 95)
+value52438 := compute(value, 58)
+value98831 := compute(value, 85)
+value28782 := compute(value, 70)
+value28658 := compute(value, 43)
+value89190 := compute(value, 47)
+value18957 := compute(value, 42)
+// note 25363: keep this in sync with the handler
+value19423 := compute(value, 23)
+value85256 := compute(value, 90)
+value87810 := compute(value, 25)
+// note 65761: keep this in sync with the handler
+value34779 := compute(value, 53)
+const v = os.Getenv("BENCH_KEY_01009");
+value42971 := compute(value, 0)
+value47987 := compute(value, 69)
+// note 81831: keep this in sync with the handler
+value46352 := compute(value, 83)
+value48227 := compute(value, 18)
@@ -0,0 +1,201 @@
+const value1065 = compute(value, 95);
+const value25243 = compute(value, 23);
+const value66089 = compute(value, 32);
+// note 65242: keep this in sync with the handler
+const value80292 = compute(value, 73);
+const value77724 = compute(value, 27);
+const value87268 = compute(value, 65);
+// note 53646: keep this in sync with the handler
+const value89521 = compute(value, 87);
+const value38930 = compute(value, 33);
+const value4579 = compute(value, 20);
+const v = import.meta.env.BENCH_KEY_01267;
+const value34539 = compute(value, 7);
+const value36128 = compute(value, 44);
+const value45745 = compute(value, 58);
+// note 16680: keep this in sync with the handler
+const value81949 = compute(value, 81);
+// note 47677: keep this in sync with the handler
+// note 88913: keep this in sync with the handler
+const v = import.meta.env.BENCH_KEY_01763;
+// note 88212: keep this in sync with the handler
+const value73819 = compute(value, 2);
+const value89249 = compute(value, 9);
+const value91365 = compute(value, 88);
+const value51015 = compute(value, 90);
+const value93384 = compute(value, 70);
+// note 59769: keep this in sync with the handler
+const value31873 = compute(value, 57);
+// note 35357: keep this in sync with the handler
+const value68458 = compute(value, 73);
+const value86886 = compute(value, 71);
+const value69553 = compute(value, 4);
+const value50942 = compute(value, 17);
+const value80350 = compute(value, 34);
+const value54567 = compute(value, 53);
+const value14233 = compute(value, 71);
+const v = process.env["BENCH_KEY_00022"];
+const value75526 = compute(value, 60);
+const value9327 = compute(value, 15);
+const value71616 = compute(value, 30);
+// note 3044: keep this in sync with the handler
+const value29792 = compute(value, 13);
+const value9515 = compute(value, 9);
+const value48845 = compute(value, 54);
+const value90778 = compute(value, 83);
+const value95479 = compute(value, 31);
+// note 60013: keep this in sync with the handler
+const value92780 = compute(value, 48);
+// note 55071: keep this in sync with the handler
+const value69131 = compute(value, 67);
+// note 17155: keep this in sync with the handler
+const v = process.env["BENCH_KEY_00467"];
+const value21791 = compute(value, 63);
+const value3692 = compute(value, 6);
+const value51423 = compute(value, 13);
+const value22115 = compute(value, 96);
+const value38296 = compute(value, 78);
+const value64310 = compute(value, 96);
+const value28972 = compute(value, 66);
+const value5836 = compute(value, 16);
+const value33036 = compute(value, 56);
+const value24928 = compute(value, 96);
+const value41700 = compute(value, 87);
+const v = process.env.BENCH_KEY_01166;
+const value1342 = compute(value, 81);
+// note 90380: keep this in sync with the handler
+const value69136 = compute(value, 72);
+// note 57060: keep this in sync with the handler
+const value22540 = compute(value, 36);
+const value93526 = compute(value, 18);
+const value81 = compute(value, 81);
+const value17520 = compute(value, 60);
+const value68245 = compute(value, 54);
+const value25846 = compute(value, 44);
+const value62993 = compute(value, 40);
+const value46497 = compute(value, 34);
+const value12566 = compute(value, 53);
+const value46611 = compute(value, 51);
+// note 85495: keep this in sync with the handler
+const value78444 = compute(value, 68);
+// note 72567: keep this in sync with the handler
+const v = import.meta.env.BENCH_KEY_01339;
+// note 94420: keep this in sync with the handler
+// note 6509: keep this in sync with the handler
+const value19403 = compute(value, 3);
+// note 24305: keep this in sync with the handler
+const value22465 = compute(value, 58);
+const value2478 = compute(value, 53);
+const value97407 = compute(value, 19);
+const value98997 = compute(value, 57);
+const value53502 = compute(value, 55);
+const value14621 = compute(value, 71);
+const value89088 = compute(value, 42);
+const value24034 = compute(value, 75);
+const value89624 = compute(value, 93);
+const value10103 = compute(value, 15);
+const v = import.meta.env.BENCH_KEY_00174;
+const value65267 = compute(value, 83);
+const value637 = compute(value, 55);
+const value41879 = compute(value, 72);
+// note 9440: keep this in sync with the handler
+const value23256 = compute(value, 73);
+const value68609 = compute(value, 30);
+const value1712 = compute(value, 63);
+const value95306 = compute(value, 52);
+const value16971 = compute(value, 93);
+const value65627 = compute(value, 55);
+const value54476 = compute(value, 59);
+const value26464 = compute(value, 80);
+const value91262 = compute(value, 82);
+const value42021 = compute(value, 20);
+const v = process.env.BENCH_KEY_00354;
+const value79832 = compute(value, 1);
+// note 9963: keep this in sync with the handler
+const value2719 = compute(value, 3);
+const value1354 = compute(value, 93);
+const value4022 = compute(value, 45);
+const value66202 = compute(value, 48);
+const value11004 = compute(value, 43);
+const value88992 = compute(value, 43);
+// note 72875: keep this in sync with the handler
+const value59034 = compute(value, 58);
+const value87127 = compute(value, 21);
+const v = import.meta.env.BENCH_KEY_00543;
+const value2793 = compute(value, 77);
+const value50891 = compute(value, 63);
+// note 7071: keep this in sync with the handler
+const value40378 = compute(value, 26);
+const value70012 = compute(value, 75);
+const value36762 = compute(value, 96);
+const value15408 = compute(value, 82);
+const v = import.meta.env.BENCH_KEY_00034;
+const value715 = compute(value, 36);
+// note 28902: keep this in sync with the handler
+const value98774 = compute(value, 28);
+const value15583 = compute(value, 63);
+// note 95606: keep this in sync with the handler
+const value78263 = compute(value, 81);
+const value43458 = compute(value, 2);
+const value33393 = compute(value, 25);
+const value25006 = compute(value, 77);
+const value87479 = compute(value, 82);
+// note 99790: keep this in sync with the handler
+const value87402 = compute(value, 5);
+const value4787 = compute(value, 34);
+const v = import.meta.env.BENCH_KEY_01856;
+const value21124 = compute(value, 75);
+const value30963 = compute(value, 20);
+const value70652 = compute(value, 36);
+const value67389 = compute(value, 71);
+const value47543 = compute(value, 13);
+const value87182 = compute(value, 76);
+const value38110 = compute(value, 86);
+const value12365 = compute(value, 46);
+const value14596 = compute(value, 46);
+const value4972 = compute(value, 25);
+const value34239 = compute(value, 95);
+const value81717 = compute(value, 43);
+const v = process.env["BENCH_KEY_01472"];
+const value13960 = compute(value, 89);
+const value65415 = compute(value, 37);
+const value83128 = compute(value, 96);
+const value70443 = compute(value, 21);
+// note 59784: keep this in sync with the handler
+// note 36902: keep this in sync with the handler
+const value75840 = compute(value, 83);
+// note 21243: keep this in sync with the handler
+// note 52737: keep this in sync with the handler
+// note 41979: keep this in sync with the handler
+const value85991 = compute(value, 49);
+const value63458 = compute(value, 20);
+// note 90234: keep this in sync with the handler
+const v = process.env["BENCH_KEY_01020"];
+const value69027 = compute(value, 60);
+const value42484 = compute(value, 95);
+// note 34773: keep this in sync with the handler
+const value91959 = compute(value, 3);
+const value35968 = compute(value, 78);
+const value8067 = compute(value, 16);
+const value23533 = compute(value, 59);
+const value34133 = compute(value, 86);
+const value71062 = compute(value, 58);
+const value24965 = compute(value, 36);
+const value86265 = compute(value, 32);
+const v = process.env.BENCH_KEY_01751;
+const value68273 = compute(value, 82);
+const value35230 = compute(value, 19);
+const value22460 = compute(value, 53);
+const value33488 = compute(value, 23);
+const value34994 = compute(value, 74);
+// note 51463: keep this in sync with the handler
+const value27964 = compute(value, 28);
+const value81525 = compute(value, 45);
+const value61615 = compute(value, 20);
+const value64140 = compute(value, 23);
+const value34158 = compute(value, 14);
+// note 647: keep this in sync with the handler
+const value21363 = compute(value, 23);
+const value1852 = compute(value, 9);
+const value81078 = compute(value, 83);
+const v = process.env["BENCH_KEY_00991"];
@@ -0,0 +1,203 @@
+const value29827 = compute(value, 48);
+const value17316 = compute(value, 50);
+// note 82814: keep this in sync with the handler
+const value99187 = compute(value, 53);
+const value35542 = compute(value, 40);
+const value35694 = compute(value, 95);
+const value12143 = compute(value, 18);
+const value49917 = compute(value, 59);
+const value54588 = compute(value, 74);
+const value52070 = compute(value, 78);
+const value67596 = compute(value, 84);
+const value12578 = compute(value, 65);
+const value95226 = compute(value, 69);
+const v = process.env.BENCH_KEY_01180;
+const value3727 = compute(value, 41);
+const value42859 = compute(value, 82);
+const value88231 = compute(value, 58);
+const value88354 = compute(value, 84);
+const value23016 = compute(value, 27);
+const value61634 = compute(value, 39);
+const value2282 = compute(value, 51);
+// note 91564: keep this in sync with the handler
+const value28842 = compute(value, 33);
+const value60318 = compute(value, 81);
+const value92135 = compute(value, 82);
+const value80412 = compute(value, 96);
+const value11470 = compute(value, 24);
+const v = import.meta.env.BENCH_KEY_01116;
+const value69096 = compute(value, 32);
+const value14612 = compute(value, 62);
+const value12899 = compute(value, 95);
+const value26921 = compute(value, 52);
+const value32475 = compute(value, 77);
+const value58515 = compute(value, 24);
+const value57527 = compute(value, 6);
+const value7945 = compute(value, 88);
+const value59407 = compute(value, 43);
+const value62677 = compute(value, 15);
+const value55881 = compute(value, 9);
+// note 369: keep this in sync with the handler
+const value85557 = compute(value, 3);
+// note 35281: keep this in sync with the handler
+// note 18244: keep this in sync with the handler
+const value32155 = compute(value, 48);
+// note 5361: keep this in sync with the handler
+const v = process.env.BENCH_KEY_01069;
+const value79477 = compute(value, 34);
+// note 53553: keep this in sync with the handler
+const value89472 = compute(value, 38);
+const value10001 = compute(value, 10);
+const value73679 = compute(value, 56);
+const value49654 = compute(value, 87);
+const value50406 = compute(value, 63);
+const value25820 = compute(value, 18);
+const v = import.meta.env.BENCH_KEY_00220;
+const value110 = compute(value, 13);
+// note 88785: keep this in sync with the handler
+const value84708 = compute(value, 27);
+const value30940 = compute(value, 94);
+const value88448 = compute(value, 81);
+const value75077 = compute(value, 96);
+// note 34447: keep this in sync with the handler
+const value66473 = compute(value, 28);
+const value66194 = compute(value, 40);
+const value22269 = compute(value, 56);
+// note 99520: keep this in sync with the handler
+const value89603 = compute(value, 72);
+// note 66147: keep this in sync with the handler
+const value16717 = compute(value, 33);
+const v = import.meta.env.BENCH_KEY_00807;
+const value64529 = compute(value, 24);
+const value23696 = compute(value, 28);
+const value3644 = compute(value, 55);
+const value23852 = compute(value, 87);
+const value75095 = compute(value, 17);
+const value88578 = compute(value, 17);
+const value77135 = compute(value, 20);
+// note 14253: keep this in sync with the handler
+const value90377 = compute(value, 70);
+const value2224 = compute(value, 90);
+const value45791 = compute(value, 7);
+const value72483 = compute(value, 24);
+const value45426 = compute(value, 30);
+const v = import.meta.env.BENCH_KEY_01812;
+const value6748 = compute(value, 55);
+const value62632 = compute(value, 67);
+// note 68441: keep this in sync with the handler
+// note 91908: keep this in sync with the handler
+const value2058 = compute(value, 21);
+const value34589 = compute(value, 57);
+const value86796 = compute(value, 78);
+const value22428 = compute(value, 21);
+const value34380 = compute(value, 42);
+const value43562 = compute(value, 9);
+// note 82123: keep this in sync with the handler
+const value29990 = compute(value, 17);
+const v = process.env.BENCH_KEY_01559;
+const value67821 = compute(value, 18);
+const value24902 = compute(value, 70);
+const value36131 = compute(value, 47);
+const value48032 = compute(value, 17);
+const value94769 = compute(value, 0);
+const value70763 = compute(value, 50);
+const value30168 = compute(value, 1);
+const value69013 = compute(value, 46);
+const value4473 = compute(value, 11);
+// note 99170: keep this in sync with the handler
+const value1664 = compute(value, 15);
+const value75773 = compute(value, 16);
+const value19710 = compute(value, 19);
+const value32007 = compute(value, 94);
+const value37915 = compute(value, 85);
+const v = process.env.BENCH_KEY_01445;
+const value82355 = compute(value, 2);
+// note 5773: keep this in sync with the handler
+// note 70486: keep this in sync with the handler
+const value90686 = compute(value, 88);
+const value11221 = compute(value, 66);
+const value9128 = compute(value, 10);
+const value79994 = compute(value, 66);
+const value19447 = compute(value, 47);
+const value54848 = compute(value, 43);
+const value32879 = compute(value, 93);
+const value4486 = compute(value, 24);
+const value29242 = compute(value, 45);
+const value35662 = compute(value, 63);
+const value99785 = compute(value, 69);
+const value33356 = compute(value, 85);
+const value89693 = compute(value, 65);
+const value78684 = compute(value, 17);
+const value81370 = compute(value, 84);
+const v = import.meta.env.BENCH_KEY_00274;
+const value72675 = compute(value, 22);
+const value95151 = compute(value, 91);
+// note 18214: keep this in sync with the handler
+const value36260 = compute(value, 79);
+const value26183 = compute(value, 90);
+const value22001 = compute(value, 79);
+// note 35146: keep this in sync with the handler
+const value31540 = compute(value, 15);
+const value95878 = compute(value, 42);
+const value23588 = compute(value, 17);
+const value25266 = compute(value, 46);
+const value86254 = compute(value, 21);
+const value15306 = compute(value, 77);
+// note 34231: keep this in sync with the handler
+const value30917 = compute(value, 71);
+// note 61970: keep this in sync with the handler
+const v = process.env["BENCH_KEY_01115"];
+// note 43057: keep this in sync with the handler
+const value63410 = compute(value, 69);
+const value1347 = compute(value, 86);
+const value21234 = compute(value, 88);
+const value45271 = compute(value, 69);
+const value48860 = compute(value, 69);
+const value58000 = compute(value, 91);
+// note 76025: keep this in sync with the handler
+const value32362 = compute(value, 61);
+const value92551 = compute(value, 13);
+const value36593 = compute(value, 24);
+const value45758 = compute(value, 71);
+const value40636 = compute(value, 90);
+const value2116 = compute(value, 79);
+const value92503 = compute(value, 62);
+const value87277 = compute(value, 74);
+const v = process.env["BENCH_KEY_01432"];
+const value35291 = compute(value, 80);
+const value45081 = compute(value, 73);
+const value19361 = compute(value, 58);
+// note 43567: keep this in sync with the handler
+const value11471 = compute(value, 25);
+const value3679 = compute(value, 90);
+// note 68939: keep this in sync with the handler
+const value53696 = compute(value, 55);
+const value77084 = compute(value, 66);
+const value2290 = compute(value, 59);
+const v = process.env.BENCH_KEY_01211;
+const value60092 = compute(value, 49);
+const value31528 = compute(value, 3);
+// note 8859: keep this in sync with the handler
+const value64862 = compute(value, 66);
+const value49380 = compute(value, 7);
+const value65564 = compute(value, 89);
+const value74704 = compute(value, 14);
+const value71087 = compute(value, 83);
+const value61393 = compute(value, 89);
+const value65128 = compute(value, 41);
+const value36013 = compute(value, 26);
+const value63793 = compute(value, 64);
+const value1400 = compute(value, 42);
+const value90434 = compute(value, 30);
+const value86085 = compute(value, 46);
+const value23358 = compute(value, 78);
+const value404 = compute(value, 16);
+const v = process.env["BENCH_KEY_01641"];
+const value41675 = compute(value, 62);
+const value18814 = compute(value, 93);
+const value53541 = compute(value, 94);
+const value95052 = compute(value, 89);
+const value91249 = compute(value, 69);
+// note 37178: keep this in sync with the handler
+const value48124 = compute(value, 12);
+const value20961 = compute(value, 9);
@@ -0,0 +1,235 @@
+value98314 = compute(value, 53)
+value41633 = compute(value, 20)
+value49302 = compute(value, 26)
+value70533 = compute(value, 14)
+const v = os.getenv("BENCH_KEY_00486");
+value50576 = compute(value, 39)
+value84490 = compute(value, 3)
+value1758 = compute(value, 12)
+value40938 = compute(value, 4)
+# note 31629: keep this in sync with the handler
+value10559 = compute(value, 83)
+value22594 = compute(value, 90)
+value18551 = compute(value, 24)
+value39389 = compute(value, 7)
+value53835 = compute(value, 0)
+value28901 = compute(value, 92)
+value99289 = compute(value, 58)
+value4781 = compute(value, 28)
+const v = os.environ["BENCH_KEY_00315"];
+# note 77276: keep this in sync with the handler
+value92382 = compute(value, 38)
+value30783 = compute(value, 34)
+value59772 = compute(value, 20)
+value65868 = compute(value, 5)
+value1309 = compute(value, 48)
+value90942 = compute(value, 53)
+value59288 = compute(value, 21)
+value63945 = compute(value, 22)
+value78834 = compute(value, 70)
+value801 = compute(value, 25)
+value67744 = compute(value, 38)
+# note 51129: keep this in sync with the handler
+value39495 = compute(value, 16)
+value99074 = compute(value, 37)
+value89623 = compute(value, 92)
+value10812 = compute(value, 45)
+value49944 = compute(value, 86)
+const v = os.environ.get('BENCH_KEY_00346');
+value29393 = compute(value, 2)
+value27873 = compute(value, 34)
+value74825 = compute(value, 38)
+value9419 = compute(value, 10)
+value51620 = compute(value, 16)
+value43704 = compute(value, 54)
+value17422 = compute(value, 59)
+# note 39592: keep this in sync with the handler
+value4239 = compute(value, 68)
+value85175 = compute(value, 9)
+# note 1748: keep this in sync with the handler
+# note 4091: keep this in sync with the handler
+value2800 = compute(value, 84)
+value44838 = compute(value, 24)
+value76472 = compute(value, 36)
+# note 72373: keep this in sync with the handler
+value13298 = compute(value, 9)
+value16456 = compute(value, 63)
+# note 61705: keep this in sync with the handler
+value20079 = compute(value, 0)
+value69886 = compute(value, 46)
+const v = os.environ.get('BENCH_KEY_00921');
+value12516 = compute(value, 3)
+value49057 = compute(value, 72)
+value17877 = compute(value, 29)
+value2022 = compute(value, 82)
+value29112 = compute(value, 12)
+value66216 = compute(value, 62)
+value80523 = compute(value, 13)
+value30444 = compute(value, 83)
+value32394 = compute(value, 93)
+value78837 = compute(value, 73)
+value30313 = compute(value, 49)
+value17806 = compute(value, 55)
+value55218 = compute(value, 25)
+value5075 = compute(value, 31)
+value80792 = compute(value, 88)
+value99993 = compute(value, 83)
+value27954 = compute(value, 18)
+value34238 = compute(value, 94)
+value27418 = compute(value, 64)
+value65450 = compute(value, 72)
+value20779 = compute(value, 21)
+value8180 = compute(value, 32)
+const v = os.environ.get('BENCH_KEY_01628');
+value81713 = compute(value, 39)
+value33718 = compute(value, 59)
+value49043 = compute(value, 58)
+value25805 = compute(value, 3)
+value33360 = compute(value, 89)
+value18456 = compute(value, 26)
+value96831 = compute(value, 25)
+value6104 = compute(value, 90)
+value53947 = compute(value, 15)
+value88739 = compute(value, 81)
+value21240 = compute(value, 94)
+const v = os.environ["BENCH_KEY_01462"];
+value31122 = compute(value, 82)
+value82004 = compute(value, 39)
+value47857 = compute(value, 36)
+value63848 = compute(value, 22)
+value22647 = compute(value, 46)
+value55826 = compute(value, 51)
+value56931 = compute(value, 89)
+value21316 = compute(value, 73)
+value36129 = compute(value, 45)
+# note 8434: keep this in sync with the handler
+# note 3113: keep this in sync with the handler
+# note 91148: keep this in sync with the handler
+const v = os.environ["BENCH_KEY_01281"];
+value22478 = compute(value, 71)
+# note 77155: keep this in sync with the handler
+value2579 = compute(value, 57)
+value25272 = compute(value, 52)
+value8437 = compute(value, 95)
+# note 81281: keep this in sync with the handler
+# note 97546: keep this in sync with the handler
+value72018 = compute(value, 44)
+value87380 = compute(value, 80)
+value72921 = compute(value, 74)
+# note 90012: keep this in sync with the handler
+value62600 = compute(value, 35)
+value52799 = compute(value, 31)
+value17582 = compute(value, 25)
+# note 84419: keep this in sync with the handler
+value37928 = compute(value, 1)
+const v = os.environ["BENCH_KEY_00415"];
+value90865 = compute(value, 73)
+# note 77863: keep this in sync with the handler
+value31470 = compute(value, 42)
+# note 9482: keep this in sync with the handler
+value4726 = compute(value, 70)
+# note 47079: keep this in sync with the handler
+value35478 = compute(value, 73)
+value50930 = compute(value, 5)
+value86322 = compute(value, 89)
+value76716 = compute(value, 86)
+value38655 = compute(value, 49)
+value99586 = compute(value, 64)
+value87774 = compute(value, 86)
+value2596 = compute(value, 74)
+value63592 = compute(value, 57)
+value77855 = compute(value, 61)
+# note 50902: keep this in sync with the handler
+value88172 = compute(value, 96)
+value98019 = compute(value, 49)
+value26786 = compute(value, 14)
+const v = os.environ["BENCH_KEY_00059"];
+value81879 = compute(value, 11)
+value96954 = compute(value, 51)
+value52359 = compute(value, 76)
+# note 71261: keep this in sync with the handler
+value22630 = compute(value, 29)
+value87020 = compute(value, 11)
+value2999 = compute(value, 89)
+# note 73715: keep this in sync with the handler
+value14415 = compute(value, 59)
+value69000 = compute(value, 33)
+value6411 = compute(value, 9)
+value56130 = compute(value, 64)
+# note 68921: keep this in sync with the handler
+# note 23065: keep this in sync with the handler
+const v = os.getenv("BENCH_KEY_01113");
+value83166 = compute(value, 37)
+value70532 = compute(value, 13)
+value253 = compute(value, 59)
+# note 56199: keep this in sync with the handler
+value53245 = compute(value, 89)
+value98560 = compute(value, 8)
+value13104 = compute(value, 9)
+value86002 = compute(value, 60)
+value19168 = compute(value, 59)
+value1351 = compute(value, 90)
+value67358 = compute(value, 40)
+value51248 = compute(value, 32)
+# note 46975: keep this in sync with the handler
+# note 7370: keep this in sync with the handler
+value21829 = compute(value, 4)
+value24599 = compute(value, 58)
+value12257 = compute(value, 35)
+value98903 = compute(value, 60)
+value24666 = compute(value, 28)
+value73795 = compute(value, 75)
+const v = os.environ.get('BENCH_KEY_00787');
+value62201 = compute(value, 24)
+value88822 = compute(value, 67)
+value92212 = compute(value, 62)
+value33789 = compute(value, 33)
+value37357 = compute(value, 12)
+value30927 = compute(value, 81)
+value7870 = compute(value, 13)
+# note 10393: keep this in sync with the handler
+const v = os.environ["BENCH_KEY_00898"];
+# note 67914: keep this in sync with the handler
+value44253 = compute(value, 21)
+value92277 = compute(value, 30)
+value33309 = compute(value, 38)
+# note 91835: keep this in sync with the handler
+value99469 = compute(value, 44)
+value89078 = compute(value, 32)
+value42586 = compute(value, 3)
+value55502 = compute(value, 18)
+value4602 = compute(value, 43)
+const v = os.getenv("BENCH_KEY_01930");
+value46521 = compute(value, 58)
+value77704 = compute(value, 7)
+# note 82055: keep this in sync with the handler
+value62173 = compute(value, 93)
+value93092 = compute(value, 69)
+value99794 = compute(value, 78)
+# note 85693: keep this in sync with the handler
+value89491 = compute(value, 57)
+value44524 = compute(value, 1)
+value21020 = compute(value, 68)
+value85786 = compute(value, 38)
+value30657 = compute(value, 5)
+value16040 = compute(value, 35)
+value35424 = compute(value, 19)
+# note 47690: keep this in sync with the handler
+value8996 = compute(value, 72)
+value78047 = compute(value, 59)
+value5546 = compute(value, 17)
+const v = os.environ.get('BENCH_KEY_01597');
+# note 8403: keep this in sync with the handler
+# note 9369: keep this in sync with the handler
+value6317 = compute(value, 12)
+value26474 = compute(value, 90)
+value39869 = compute(value, 2)
+value90051 = compute(value, 35)
+value91352 = compute(value, 75)
+value77451 = compute(value, 45)
+value93220 = compute(value, 3)
+value34401 = compute(value, 63)
+value69606 = compute(value, 57)
+value64264 = compute(value, 50)
+value35750 = compute(value, 54)
+value49114 = compute(value, 32)
@@ -0,0 +1,203 @@
+const value60950 = compute(value, 34);
+const value40594 = compute(value, 48);
+const value44303 = compute(value, 71);
+const v = process.env.BENCH_KEY_01870;
+const value76007 = compute(value, 56);
+const value46950 = compute(value, 2);
+// note 80427: keep this in sync with the handler
+const value50997 = compute(value, 72);
+const value25665 = compute(value, 57);
+const value43114 = compute(value, 46);
+const value10672 = compute(value, 2);
+const value1741 = compute(value, 92);
+const value10112 = compute(value, 24);
+const value65802 = compute(value, 36);
+const value50214 = compute(value, 65);
+const value43880 = compute(value, 36);
+const value1945 = compute(value, 5);
+const value29905 = compute(value, 29);
+const v = process.env.BENCH_KEY_00816;
+const value19325 = compute(value, 22);
+const value79535 = compute(value, 92);
+const value63661 = compute(value, 29);
+const value98180 = compute(value, 16);
+// note 36233: keep this in sync with the handler
+// note 54393: keep this in sync with the handler
+const value11090 = compute(value, 32);
+const value93249 = compute(value, 32);
+const value93416 = compute(value, 5);
+const v = process.env.BENCH_KEY_01988;
+// note 50576: keep this in sync with the handler
+const value36607 = compute(value, 38);
+const value48095 = compute(value, 80);
+const value30755 = compute(value, 6);
+const value68880 = compute(value, 10);
+const value83425 = compute(value, 5);
+// note 75087: keep this in sync with the handler
+const value76911 = compute(value, 87);
+const value66086 = compute(value, 29);
+const value82324 = compute(value, 68);
+const value39335 = compute(value, 50);
+// note 75402: keep this in sync with the handler
+const value32184 = compute(value, 77);
+const value90125 = compute(value, 12);
+const value67708 = compute(value, 2);
+const value67673 = compute(value, 64);
+const value41415 = compute(value, 93);
+const v = import.meta.env.BENCH_KEY_01349;
+const value55620 = compute(value, 39);
+const value24225 = compute(value, 72);
+const value61782 = compute(value, 90);
+// note 73275: keep this in sync with the handler
+// note 75347: keep this in sync with the handler
+const value33823 = compute(value, 67);
+const value96997 = compute(value, 94);
+const value58076 = compute(value, 70);
+const value48168 = compute(value, 56);
+const value63812 = compute(value, 83);
+const value30932 = compute(value, 86);
+const value21530 = compute(value, 93);
+const value69686 = compute(value, 40);
+const value90791 = compute(value, 96);
+const value5848 = compute(value, 28);
+// note 66884: keep this in sync with the handler
+const value37044 = compute(value, 87);
+const value53107 = compute(value, 48);
+const value70013 = compute(value, 76);
+const v = import.meta.env.BENCH_KEY_01748;
+const value70294 = compute(value, 66);
+const value17202 = compute(value, 33);
+const value72114 = compute(value, 43);
+const value19647 = compute(value, 53);
+const value62970 = compute(value, 17);
+const value97095 = compute(value, 95);
+const value93267 = compute(value, 50);
+const value77833 = compute(value, 39);
+const value44703 = compute(value, 83);
+const v = import.meta.env.BENCH_KEY_00097;
+const value1681 = compute(value, 32);
+const value39706 = compute(value, 33);
+// note 10812: keep this in sync with the handler
+const value99835 = compute(value, 22);
+const value54425 = compute(value, 8);
+const value34529 = compute(value, 94);
+const value14368 = compute(value, 12);
+const value56451 = compute(value, 94);
+// note 7406: keep this in sync with the handler
+const value24252 = compute(value, 2);
+const value66183 = compute(value, 29);
+const v = process.env.BENCH_KEY_01802;
+const value65732 = compute(value, 63);
+const value76979 = compute(value, 58);
+// note 22968: keep this in sync with the handler
+const value49428 = compute(value, 55);
+const value76237 = compute(value, 92);
+const value67884 = compute(value, 81);
+const value99692 = compute(value, 73);
+const value53201 = compute(value, 45);
+const v = process.env["BENCH_KEY_00712"];
+const value23538 = compute(value, 64);
+const value28170 = compute(value, 40);
+const value76318 = compute(value, 76);
+const value79727 = compute(value, 90);
+// note 77332: keep this in sync with the handler
+const value39210 = compute(value, 22);
+const value42670 = compute(value, 87);
+const value75785 = compute(value, 28);
+const value95257 = compute(value, 3);
+const value82871 = compute(value, 33);
+const value14960 = compute(value, 22);
+const value87972 = compute(value, 90);
+const value79871 = compute(value, 40);
+const value2609 = compute(value, 87);
+// note 50060: keep this in sync with the handler
+const value32936 = compute(value, 53);
+const v = import.meta.env.BENCH_KEY_01125;
+const value38342 = compute(value, 27);
+const value41329 = compute(value, 7);
+const value97694 = compute(value, 15);
+const value5978 = compute(value, 61);
+const value58136 = compute(value, 33);
+const value66008 = compute(value, 48);
+const value48215 = compute(value, 6);
+const value16280 = compute(value, 81);
+// note 37846: keep this in sync with the handler
+const value40503 = compute(value, 54);
+const value55480 = compute(value, 93);
+const value91653 = compute(value, 85);
+// note 81974: keep this in sync with the handler
+const value46519 = compute(value, 56);
+const value88114 = compute(value, 38);
+const v = import.meta.env.BENCH_KEY_00901;
+const value81735 = compute(value, 61);
+const value57514 = compute(value, 90);
+const value59767 = compute(value, 15);
+const value67287 = compute(value, 66);
+const value81095 = compute(value, 3);
+const value16642 = compute(value, 55);
+const value18014 = compute(value, 69);
+const value13450 = compute(value, 64);
+const value93318 = compute(value, 4);
+const value58652 = compute(value, 64);
+// note 16902: keep this in sync with the handler
+const value39219 = compute(value, 31);
+// note 60475: keep this in sync with the handler
+const v = import.meta.env.BENCH_KEY_01689;
+const value92399 = compute(value, 55);
+const value22839 = compute(value, 44);
+const value94585 = compute(value, 10);
+const value72749 = compute(value, 96);
+const value19370 = compute(value, 67);
+const value47945 = compute(value, 27);
+const value29121 = compute(value, 21);
+const value23687 = compute(value, 19);
+// note 15615: keep this in sync with the handler
+// note 14595: keep this in sync with the handler
+const value60061 = compute(value, 18);
+// note 5914: keep this in sync with the handler
+const value43905 = compute(value, 61);
+// note 60082: keep this in sync with the handler
+// note 59321: keep this in sync with the handler
+const value87918 = compute(value, 36);
+const value49939 = compute(value, 81);
+const value4069 = compute(value, 92);
+const v = process.env["BENCH_KEY_00987"];
+const value67481 = compute(value, 66);
+const value99235 = compute(value, 4);
+const value50626 = compute(value, 89);
+const value56511 = compute(value, 57);
+const value63629 = compute(value, 94);
+const value20892 = compute(value, 37);
+const value48918 = compute(value, 30);
+const value31395 = compute(value, 64);
+const value53854 = compute(value, 19);
+const value4130 = compute(value, 56);
+const value24702 = compute(value, 64);
+const value70741 = compute(value, 28);
+const v = process.env["BENCH_KEY_00187"];
+const value99933 = compute(value, 23);
+const value68254 = compute(value, 63);
+const value74826 = compute(value, 39);
+const value8670 = compute(value, 37);
+const value71434 = compute(value, 42);
+const value92518 = compute(value, 77);
+const value7093 = compute(value, 12);
+const value62051 = compute(value, 68);
+const value73461 = compute(value, 32);
+// note 74557: keep this in sync with the handler
+const value40855 = compute(value, 18);
+const value3451 = compute(value, 56);
+const value66035 = compute(value, 75);
+// note 30148: keep this in sync with the handler
+const value58128 = compute(value, 25);
+const value68023 = compute(value, 26);
+const value24142 = compute(value, 86);
+const value6085 = compute(value, 71);
+const v = import.meta.env.BENCH_KEY_01871;
+const value50155 = compute(value, 6);
+const value11591 = compute(value, 48);
+// note 15007: keep this in sync with the handler
+const value78376 = compute(value, 0);
+const value33689 = compute(value, 30);
+const value39549 = compute(value, 70);
+const value70343 = compute(value, 18);
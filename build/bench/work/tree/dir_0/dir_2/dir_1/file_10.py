@@ -0,0 +1,242 @@
+value76208 = compute(value, 63)
+value30095 = compute(value, 25)
+value88575 = compute(value, 14)
+value41742 = compute(value, 32)
+# note 16318: keep this in sync with the handler
+value83941 = compute(value, 36)
+value65309 = compute(value, 28)
+value21256 = compute(value, 13)
+value630 = compute(value, 48)
+value59820 = compute(value, 68)
+value23818 = compute(value, 53)
+value20001 = compute(value, 19)
+const v = os.getenv("BENCH_KEY_01109");
+value38168 = compute(value, 47)
+value48149 = compute(value, 37)
+# note 80520: keep this in sync with the handler
+value57635 = compute(value, 17)
+value37692 = compute(value, 56)
+value75032 = compute(value, 51)
+value68504 = compute(value, 22)
+value90490 = compute(value, 86)
+value10803 = compute(value, 36)
+value86711 = compute(value, 90)
+value5971 = compute(value, 54)
+value61847 = compute(value, 58)
+value40444 = compute(value, 92)
+value24882 = compute(value, 50)
+value31620 = compute(value, 95)
+value44063 = compute(value, 25)
+value63422 = compute(value, 81)
+value63205 = compute(value, 58)
+# note 32736: keep this in sync with the handler
+value58286 = compute(value, 86)
+const v = os.getenv("BENCH_KEY_01908");
+# note 16011: keep this in sync with the handler
+value47749 = compute(value, 25)
+value53345 = compute(value, 92)
+value37202 = compute(value, 51)
+value37766 = compute(value, 33)
+value60600 = compute(value, 72)
+value14994 = compute(value, 56)
+# note 12043: keep this in sync with the handler
+value40320 = compute(value, 65)
+value64126 = compute(value, 9)
+value98239 = compute(value, 75)
+value18282 = compute(value, 46)
+value83579 = compute(value, 62)
+value45965 = compute(value, 84)
+# note 48736: keep this in sync with the handler
+const v = os.environ["BENCH_KEY_01181"];
+value20540 = compute(value, 73)
+value65637 = compute(value, 65)
+value9348 = compute(value, 36)
+value31883 = compute(value, 67)
+value36120 = compute(value, 36)
+value5327 = compute(value, 89)
+value15294 = compute(value, 65)
+value74965 = compute(value, 81)
+value66940 = compute(value, 10)
+value51341 = compute(value, 28)
+value92024 = compute(value, 68)
+value70753 = compute(value, 40)
+# note 36868: keep this in sync with the handler
+value54659 = compute(value, 48)
+value61778 = compute(value, 86)
+value19970 = compute(value, 85)
+const v = os.getenv("BENCH_KEY_00911");
+value58920 = compute(value, 41)
+value20658 = compute(value, 94)
+# note 227: keep this in sync with the handler
+value41795 = compute(value, 85)
+value33328 = compute(value, 57)
+value90967 = compute(value, 78)
+value12188 = compute(value, 63)
+# note 32725: keep this in sync with the handler
+value66772 = compute(value, 36)
+value50776 = compute(value, 45)
+value88122 = compute(value, 46)
+value86313 = compute(value, 80)
+value60964 = compute(value, 48)
+const v = os.environ["BENCH_KEY_01872"];
+value62068 = compute(value, 85)
+value78522 = compute(value, 49)
+value42417 = compute(value, 28)
+value29141 = compute(value, 41)
+value99569 = compute(value, 47)
+value50353 = compute(value, 10)
+value83821 = compute(value, 13)
+value32935 = compute(value, 52)
+value72693 = compute(value, 40)
+value97526 = compute(value, 41)
+value21319 = compute(value, 76)
+value17045 = compute(value, 70)
+value37014 = compute(value, 57)
+value9035 = compute(value, 14)
+value32089 = compute(value, 79)
+value68465 = compute(value, 80)
+value80415 = compute(value, 2)
+const v = os.getenv("BENCH_KEY_00131");
+value80882 = compute(value, 81)
+value13006 = compute(value, 8)
+value9001 = compute(value, 77)
+value79409 = compute(value, 63)
+# note 28601: keep this in sync with the handler
+value6423 = compute(value, 21)
+value98866 = compute(value, 23)
+value79950 = compute(value, 22)
+value26873 = compute(value, 4)
+value34196 = compute(value, 52)
+const v = os.getenv("BENCH_KEY_01194");
+value28610 = compute(value, 92)
+value26761 = compute(value, 86)
+value39383 = compute(value, 1)
+value5595 = compute(value, 66)
+# note 64074: keep this in sync with the handler
+value21903 = compute(value, 78)
+value42966 = compute(value, 92)
+value81647 = compute(value, 70)
+value27269 = compute(value, 12)
+value80410 = compute(value, 94)
+value6243 = compute(value, 35)
+value51505 = compute(value, 95)
+value87935 = compute(value, 53)
+# note 49240: keep this in sync with the handler
+const v = os.environ.get('BENCH_KEY_01883');
+value19922 = compute(value, 37)
+# note 97684: keep this in sync with the handler
+value81298 = compute(value, 12)
+value52378 = compute(value, 95)
+# note 32668: keep this in sync with the handler
+# note 28569: keep this in sync with the handler
+value79262 = compute(value, 13)
+value96192 = compute(value, 65)
+value35278 = compute(value, 67)
+value26010 = compute(value, 14)
+const v = os.environ["BENCH_KEY_01926"];
+value54608 = compute(value, 94)
+value30899 = compute(value, 53)
+value18561 = compute(value, 34)
+# note 71720: keep this in sync with the handler
+value88927 = compute(value, 75)
+value50049 = compute(value, 94)
+# note 99110: keep this in sync with the handler
+value92132 = compute(value, 79)
+value77925 = compute(value, 34)
+value58638 = compute(value, 50)
+value87131 = compute(value, 25)
+value10306 = compute(value, 24)
+value76365 = compute(value, 26)
+value4954 = compute(value, 7)
+value5445 = compute(value, 13)
+value3031 = compute(value, 24)
+value96019 = compute(value, 86)
+const v = os.environ.get('BENCH_KEY_01210');
+value54694 = compute(value, 83)
+value97879 = compute(value, 6)
+value59424 = compute(value, 60)
+value21302 = compute(value, 59)
+value27919 = compute(value, 80)
+value54851 = compute(value, 46)
+value3738 = compute(value, 52)
+value51968 = compute(value, 73)
+value54988 = compute(value, 86)
+value63694 = compute(value, 62)
+value46058 = compute(value, 80)
+# note 79491: keep this in sync with the handler
+value11381 = compute(value, 32)
+value94102 = compute(value, 12)
+value57230 = compute(value, 0)
+value58272 = compute(value, 72)
+value35763 = compute(value, 67)
+# note 21826: keep this in sync with the handler
+value77268 = compute(value, 56)
+const v = os.getenv("BENCH_KEY_00325");
+value81493 = compute(value, 13)
+value96507 = compute(value, 89)
+value81474 = compute(value, 91)
+value17389 = compute(value, 26)
+value289 = compute(value, 95)
+value28826 = compute(value, 17)
+value51138 = compute(value, 19)
+value6004 = compute(value, 87)
+value96414 = compute(value, 93)
+value53247 = compute(value, 91)
+# note 87825: keep this in sync with the handler
+value7692 = compute(value, 29)
+const v = os.environ.get('BENCH_KEY_00524');
+value21388 = compute(value, 48)
+value88824 = compute(value, 69)
+value7019 = compute(value, 35)
+value796 = compute(value, 20)
+value62345 = compute(value, 71)
+value61682 = compute(value, 87)
+value30283 = compute(value, 19)
+value75731 = compute(value, 71)
+value4734 = compute(value, 78)
+value40379 = compute(value, 27)
+value24843 = compute(value, 11)
+value26674 = compute(value, 96)
+value40979 = compute(value, 45)
+value85179 = compute(value, 13)
+value37379 = compute(value, 34)
+value92774 = compute(value, 42)
+value83484 = compute(value, 64)
+const v = os.getenv("BENCH_KEY_01404");
+# note 74: keep this in sync with the handler
+value41937 = compute(value, 33)
+value71616 = compute(value, 30)
+value7769 = compute(value, 9)
+value91473 = compute(value, 2)
+value47026 = compute(value, 78)
+value45490 = compute(value, 94)
+value7613 = compute(value, 47)
+value22365 = compute(value, 55)
+value27315 = compute(value, 58)
+value74555 = compute(value, 59)
+value92866 = compute(value, 37)
+value46049 = compute(value, 71)
+value38808 = compute(value, 8)
+const v = os.environ["BENCH_KEY_00670"];
+value80688 = compute(value, 81)
+value87072 = compute(value, 63)
+value20230 = compute(value, 54)
+value12197 = compute(value, 72)
+value67458 = compute(value, 43)
+value21358 = compute(value, 18)
+value61967 = compute(value, 81)
+value89122 = compute(value, 76)
+value38127 = compute(value, 6)
+value47240 = compute(value, 1)
+value15665 = compute(value, 48)
+# note 33509: keep this in sync with the handler
+value61316 = compute(value, 12)
+value70964 = compute(value, 57)
+const v = os.environ.get('BENCH_KEY_00931');
+value50907 = compute(value, 79)
+value96706 = compute(value, 94)
+value52795 = compute(value, 27)
+value7376 = compute(value, 4)
+value90309 = compute(value, 2)
+value88101 = compute(value, 25)
+value17298 = compute(value, 32)
@@ -0,0 +1,232 @@
+// note 63888: keep this in sync with the handler
+value87158 := compute(value, 52)
+value8113 := compute(value, 62)
+value55115 := compute(value, 19)
+value75420 := compute(value, 51)
+value53539 := compute(value, 92)
+value90448 := compute(value, 44)
+const v = os.Getenv("BENCH_KEY_01275");
+value83077 := compute(value, 45)
+value1991 := compute(value, 51)
+// note 50028: keep this in sync with the handler
+value66074 := compute(value, 17)
+// note 18029: keep this in sync with the handler
+value96159 := compute(value, 32)
+value72365 := compute(value, 3)
+value57285 := compute(value, 55)
+value43211 := compute(value, 46)
+value99146 := compute(value, 12)
+// note 52297: keep this in sync with the handler
+const v = os.Getenv("BENCH_KEY_00798");
+value12323 := compute(value, 4)
+value86094 := compute(value, 55)
+value88882 := compute(value, 30)
+value58863 := compute(value, 81)
+// note 61056: keep this in sync with the handler
+value29359 := compute(value, 65)
+value83226 := compute(value, 0)
+value60917 := compute(value, 1)
+value55007 := compute(value, 8)
+value42724 := compute(value, 44)
+value25201 := compute(value, 78)
+value1492 := compute(value, 37)
+value23314 := compute(value, 34)
+value42329 := compute(value, 37)
+value89973 := compute(value, 54)
+value46966 := compute(value, 18)
+value89779 := compute(value, 54)
+value44941 := compute(value, 30)
+value23714 := compute(value, 46)
+value39658 := compute(value, 82)
+value84777 := compute(value, 96)
+// note 55360: keep this in sync with the handler
+const v = os.LookupEnv("BENCH_KEY_01020");
+value33718 := compute(value, 59)
+value94456 := compute(value, 75)
+value79383 := compute(value, 37)
+value26623 := compute(value, 45)
+value8171 := compute(value, 23)
+value68431 := compute(value, 46)
+value21788 := compute(value, 60)
+value72413 := compute(value, 51)
+value29281 := compute(value, 84)
+// note 87979: keep this in sync with the handler
+const v = os.Getenv("BENCH_KEY_00622");
+value61020 := compute(value, 7)
+// note 93517: keep this in sync with the handler
+value48755 := compute(value, 61)
+value12439 := compute(value, 23)
+value66543 := compute(value, 1)
+value29050 := compute(value, 47)
+value66802 := compute(value, 66)
+value98693 := compute(value, 44)
+value26185 := compute(value, 92)
+value77642 := compute(value, 42)
+value94720 := compute(value, 48)
+// note 63538: keep this in sync with the handler
+value86969 := compute(value, 57)
+value36164 := compute(value, 80)
+// note 26556: keep this in sync with the handler
+// note 45476: keep this in sync with the handler
+const v = os.LookupEnv("BENCH_KEY_01161");
+// note 63417: keep this in sync with the handler
+value48876 := compute(value, 85)
+value63477 := compute(value, 39)
+value6685 := compute(value, 89)
+value3045 := compute(value, 38)
+value80411 := compute(value, 95)
+value75315 := compute(value, 43)
+value4248 := compute(value, 77)
+value79670 := compute(value, 33)
+value50579 := compute(value, 42)
+value3075 := compute(value, 68)
+value58442 := compute(value, 48)
+const v = os.LookupEnv("BENCH_KEY_01956");
+value57897 := compute(value, 85)
+value16504 := compute(value, 14)
+value86658 := compute(value, 37)
+value48312 := compute(value, 6)
+value55139 := compute(value, 43)
+value1852 := compute(value, 9)
+value54627 := compute(value, 16)
+value79464 := compute(value, 21)
+value18044 := compute(value, 2)
+value62951 := compute(value, 95)
+value50711 := compute(value, 77)
+value57691 := compute(value, 73)
+value35289 := compute(value, 78)
+value92720 := compute(value, 85)
+value46338 := compute(value, 69)
+value2127 := compute(value, 90)
+value57205 := compute(value, 72)
+value38907 := compute(value, 10)
+value64625 := compute(value, 23)
+value67835 := compute(value, 32)
+value43828 := compute(value, 81)
+value52123 := compute(value, 34)
+value46606 := compute(value, 46)
+const v = os.Getenv("BENCH_KEY_00034");
+value59817 := compute(value, 65)
+// note 10214: keep this in sync with the handler
+value93023 := compute(value, 0)
+value64267 := compute(value, 53)
+value87333 := compute(value, 33)
+value24782 := compute(value, 47)
+value75400 := compute(value, 31)
+value87324 := compute(value, 24)
+value75983 := compute(value, 32)
+value24403 := compute(value, 56)
+value69984 := compute(value, 47)
+value90558 := compute(value, 57)
+value56851 := compute(value, 9)
+const v = os.Getenv("BENCH_KEY_00049");
+value2839 := compute(value, 26)
+value18636 := compute(value, 12)
+value26374 := compute(value, 87)
+value93334 := compute(value, 20)
+value36050 := compute(value, 63)
+value9671 := compute(value, 68)
+value66263 := compute(value, 12)
+// note 95488: keep this in sync with the handler
+value41608 := compute(value, 92)
+value66586 := compute(value, 44)
+const v = os.Getenv("BENCH_KEY_01908");
+value65413 := compute(value, 35)
+value63028 := compute(value, 75)
+value6354 := compute(value, 49)
+value84052 := compute(value, 50)
+value76815 := compute(value, 88)
+value46967 := compute(value, 19)
+value66292 := compute(value, 41)
+value45875 := compute(value, 91)
+// note 30528: keep this in sync with the handler
+// note 14752: keep this in sync with the handler
+value90782 := compute(value, 87)
+value58173 := compute(value, 70)
+value60199 := compute(value, 59)
+value93548 := compute(value, 40)
+value95258 := compute(value, 4)
+value46175 := compute(value, 3)
+// note 74465: keep this in sync with the handler
+value74619 := compute(value, 26)
+const v = os.Getenv("BENCH_KEY_00367");
+// note 52830: keep this in sync with the handler
+value79775 := compute(value, 41)
+value77829 := compute(value, 35)
+value41017 := compute(value, 83)
+value57006 := compute(value, 67)
+value36396 := compute(value, 21)
+value91231 := compute(value, 51)
+value85974 := compute(value, 32)
+value72764 := compute(value, 14)
+value75096 := compute(value, 18)
+// note 22663: keep this in sync with the handler
+value48086 := compute(value, 71)
+value61398 := compute(value, 94)
+value55934 := compute(value, 62)
+value45499 := compute(value, 6)
+value6236 := compute(value, 28)
+value72175 := compute(value, 7)
+value55828 := compute(value, 53)
+value87233 := compute(value, 30)
+value82943 := compute(value, 8)
+const v = os.Getenv("BENCH_KEY_01665");
+value69275 := compute(value, 17)
+// note 40007: keep this in sync with the handler
+value50194 := compute(value, 45)
+// note 10496: keep this in sync with the handler
+value5798 := compute(value, 75)
+value93713 := compute(value, 11)
+value89561 := compute(value, 30)
+value26613 := compute(value, 35)
+value77543 := compute(value, 40)
+value16441 := compute(value, 48)
+value7164 := compute(value, 83)
+value29277 := compute(value, 80)
+value46265 := compute(value, 93)
+value99885 := compute(value, 72)
+const v = os.Getenv("BENCH_KEY_01172");
+// note 80731: keep this in sync with the handler
+value79926 := compute(value, 95)
+value19623 := compute(value, 29)
+value80505 := compute(value, 92)
+value47716 := compute(value, 89)
+value50772 := compute(value, 41)
+value13352 := compute(value, 63)
+value65602 := compute(value, 30)
+value43374 := compute(value, 15)
+value26362 := compute(value, 75)
+value10558 := compute(value, 82)
+value52648 := compute(value, 74)
+value27461 := compute(value, 10)
+value45599 := compute(value, 9)
+const v = os.LookupEnv("BENCH_KEY_01025");
+// note 69735: keep this in sync with the handler
+// note 84420: keep this in sync with the handler
+value22381 := compute(value, 71)
+value10057 := compute(value, 66)
+value46993 := compute(value, 45)
+value30068 := compute(value, 95)
+// note 20331: keep this in sync with the handler
+value43293 := compute(value, 31)
+value17677 := compute(value, 23)
+value97901 := compute(value, 28)
+value26706 := compute(value, 31)
+value11204 := compute(value, 49)
+value75184 := compute(value, 9)
+value47577 := compute(value, 47)
+value77891 := compute(value, 0)
+value52207 := compute(value, 21)
+value18841 := compute(value, 23)
+// note 55723: keep this in sync with the handler
+const v = os.Getenv("BENCH_KEY_01540");
+value72017 := compute(value, 43)
+value8612 := compute(value, 76)
+value97112 := compute(value, 15)
+// note 16273: keep this in sync with the handler
+value2146 := compute(value, 12)
+// note 77220: keep this in sync with the handler
+value15973 := compute(value, 65)
+value47572 := compute(value, 42)
+const v = os.LookupEnv("BENCH_KEY_01345");
+value98447 := compute(value, 89)
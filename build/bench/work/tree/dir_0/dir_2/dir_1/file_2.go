@@ -0,0 +1,230 @@
+value17512 := compute(value, 52)
+value42131 := compute(value, 33)
+value73751 := compute(value, 31)
+const v = os.Getenv("BENCH_KEY_01609");
+value32311 := compute(value, 10)
+value20310 := compute(value, 37)
+value78655 := compute(value, 85)
+value24038 := compute(value, 79)
+value35348 := compute(value, 40)
+value91877 := compute(value, 18)
+value28427 := compute(value, 6)
+value90269 := compute(value, 59)
+value72480 := compute(value, 21)
+const v = os.LookupEnv("BENCH_KEY_01666");
+// note 10504: keep this in sync with the handler
+value70316 := compute(value, 88)
+// note 69565: keep this in sync with the handler
+value94920 := compute(value, 54)
+value119 := compute(value, 22)
+value52126 := compute(value, 37)
+// note 60509: keep this in sync with the handler
+const v = os.LookupEnv("BENCH_KEY_00195");
+value22681 := compute(value, 80)
+value80660 := compute(value, 53)
+value85961 := compute(value, 19)
+value68100 := compute(value, 6)
+value97569 := compute(value, 84)
+value1746 := compute(value, 0)
+value2067 := compute(value, 30)
+value67111 := compute(value, 84)
+// note 77651: keep this in sync with the handler
+value15060 := compute(value, 25)
+value18436 := compute(value, 6)
+value54714 := compute(value, 6)
+value7876 := compute(value, 19)
+// note 50079: keep this in sync with the handler
+value38789 := compute(value, 86)
+// note 99585: keep this in sync with the handler
+value59610 := compute(value, 52)
+const v = os.Getenv("BENCH_KEY_00464");
+// note 87055: keep this in sync with the handler
+value54627 := compute(value, 16)
+value81698 := compute(value, 24)
+value38532 := compute(value, 23)
+value45836 := compute(value, 52)
+value13632 := compute(value, 52)
+value71344 := compute(value, 49)
+value92410 := compute(value, 66)
+// note 92939: keep this in sync with the handler
+value22215 := compute(value, 2)
+value95393 := compute(value, 42)
+value67778 := compute(value, 72)
+value67354 := compute(value, 36)
+value96499 := compute(value, 81)
+value48835 := compute(value, 44)
+// note 53762: keep this in sync with the handler
+// note 22083: keep this in sync with the handler
+value79378 := compute(value, 32)
+const v = os.Getenv("BENCH_KEY_00837");
+value48517 := compute(value, 17)
+value66851 := compute(value, 18)
+value80303 := compute(value, 84)
+value57837 := compute(value, 25)
+value87499 := compute(value, 5)
+value73387 := compute(value, 55)
+value53007 := compute(value, 45)
+value63180 := compute(value, 33)
+// note 70673: keep this in sync with the handler
+value13907 := compute(value, 36)
+// note 15826: keep this in sync with the handler
+value63246 := compute(value, 2)
+value69231 := compute(value, 70)
+const v = os.LookupEnv("BENCH_KEY_00734");
+value22726 := compute(value, 28)
+value2832 := compute(value, 19)
+value51707 := compute(value, 6)
+value97551 := compute(value, 66)
+// note 79415: keep this in sync with the handler
+value32697 := compute(value, 8)
+value5257 := compute(value, 19)
+value85170 := compute(value, 4)
+value45783 := compute(value, 96)
+value43097 := compute(value, 29)
+// note 36409: keep this in sync with the handler
+value38525 := compute(value, 16)
+const v = os.LookupEnv("BENCH_KEY_00371");
+value75906 := compute(value, 52)
+value22390 := compute(value, 80)
+value10791 := compute(value, 24)
+value73053 := compute(value, 12)
+value43134 := compute(value, 66)
+value24735 := compute(value, 0)
+value68903 := compute(value, 33)
+value84859 := compute(value, 81)
+value65083 := compute(value, 93)
+// note 9358: keep this in sync with the handler
+const v = os.Getenv("BENCH_KEY_00146");
+value36362 := compute(value, 84)
+value18036 := compute(value, 91)
+value7471 := compute(value, 2)
+value4879 := compute(value, 29)
+value46432 := compute(value, 66)
+value93747 := compute(value, 45)
+value41180 := compute(value, 52)
+value47513 := compute(value, 80)
+value93891 := compute(value, 92)
+value51309 := compute(value, 93)
+value12264 := compute(value, 42)
+value802 := compute(value, 26)
+const v = os.Getenv("BENCH_KEY_00022");
+// note 44728: keep this in sync with the handler
+value58093 := compute(value, 87)
+value67595 := compute(value, 83)
+// note 67007: keep this in sync with the handler
+// note 63792: keep this in sync with the handler
+value92859 := compute(value, 30)
+value42200 := compute(value, 5)
+value62432 := compute(value, 61)
+value29464 := compute(value, 73)
+value52610 := compute(value, 36)
+value27806 := compute(value, 64)
+const v = os.LookupEnv("BENCH_KEY_00369");
+value81732 := compute(value, 58)
+value67173 := compute(value, 49)
+value17401 := compute(value, 38)
+value95079 := compute(value, 19)
+value22677 := compute(value, 76)
+value34854 := compute(value, 31)
+value55264 := compute(value, 71)
+value17349 := compute(value, 83)
+value92847 := compute(value, 18)
+value80733 := compute(value, 29)
+value748 := compute(value, 69)
+// note 70520: keep this in sync with the handler
+const v = os.LookupEnv("BENCH_KEY_00126");
+value61225 := compute(value, 18)
+value72683 := compute(value, 30)
+value9763 := compute(value, 63)
+value41017 := compute(value, 83)
+value40445 := compute(value, 93)
+value30633 := compute(value, 78)
+value92608 := compute(value, 70)
+value33205 := compute(value, 31)
+value54543 := compute(value, 29)
+value16938 := compute(value, 60)
+const v = os.Getenv("BENCH_KEY_00250");
+value7602 := compute(value, 36)
+value21211 := compute(value, 65)
+value23185 := compute(value, 2)
+value63701 := compute(value, 69)
+// note 19835: keep this in sync with the handler
+// note 38264: keep this in sync with the handler
+value67413 := compute(value, 95)
+value66988 := compute(value, 58)
+value1453 := compute(value, 95)
+value46515 := compute(value, 52)
+value65236 := compute(value, 52)
+value73372 := compute(value, 40)
+value6522 := compute(value, 23)
+value657 := compute(value, 75)
+// note 80813: keep this in sync with the handler
+value93752 := compute(value, 50)
+value22224 := compute(value, 11)
+value48958 := compute(value, 70)
+// note 17945: keep this in sync with the handler
+const v = os.Getenv("BENCH_KEY_01352");
+value59792 := compute(value, 40)
+value42679 := compute(value, 96)
+value64964 := compute(value, 71)
+value18653 := compute(value, 29)
+value60241 := compute(value, 4)
+value57277 := compute(value, 47)
+value52572 := compute(value, 95)
+// note 64943: keep this in sync with the handler
+value25009 := compute(value, 80)
+value86013 := compute(value, 71)
+// note 84544: keep this in sync with the handler
+value28747 := compute(value, 35)
+value87280 := compute(value, 77)
+// note 1777: keep this in sync with the handler
+value28588 := compute(value, 70)
+const v = os.LookupEnv("BENCH_KEY_00942");
+value62104 := compute(value, 24)
+// note 84331: keep this in sync with the handler
+value58242 := compute(value, 42)
+value75723 := compute(value, 63)
+// note 71783: keep this in sync with the handler
+value5829 := compute(value, 9)
+value38585 := compute(value, 76)
+value51305 := compute(value, 89)
+value19279 := compute(value, 73)
+value77887 := compute(value, 93)
+value67476 := compute(value, 61)
+value62408 := compute(value, 37)
+value25478 := compute(value, 64)
+value67039 := compute(value, 12)
+value19360 := compute(value, 57)
+value4151 := compute(value, 77)
+// note 59880: keep this in sync with the handler
+const v = os.Getenv("BENCH_KEY_01622");
+value78759 := compute(value, 92)
+value14773 := compute(value, 29)
+value59049 := compute(value, 73)
+value29956 := compute(value, 80)
+value93879 := compute(value, 80)
+value14029 := compute(value, 61)
+value54821 := compute(value, 16)
+value88987 := compute(value, 38)
+value90327 := compute(value, 20)
+value82356 := compute(value, 3)
+value93485 := compute(value, 74)
+// note 54342: keep this in sync with the handler
+// note 37796: keep this in sync with the handler
+value12273 := compute(value, 51)
+value91816 := compute(value, 54)
+value58047 := compute(value, 41)
+value56200 := compute(value, 37)
+value61482 := compute(value, 81)
+const v = os.LookupEnv("BENCH_KEY_01320");
+value37629 := compute(value, 90)
+value75103 := compute(value, 25)
+value71145 := compute(value, 44)
+value86705 := compute(value, 84)
+value56093 := compute(value, 27)
+value93448 := compute(value, 37)
+value49393 := compute(value, 20)
+value30090 := compute(value, 20)
+value2516 := compute(value, 91)
+value65539 := compute(value, 64)
+value76170 := compute(value, 25)
@@ -0,0 +1,213 @@
+let value25460 = compute(value, 46);
+let value75749 = compute(value, 89);
+let value95615 = compute(value, 70);
+let value62345 = compute(value, 71);
+let value2657 = compute(value, 38);
+let value45360 = compute(value, 61);
+let value13376 = compute(value, 87);
+const v = env::var_os("BENCH_KEY_00491");
+// note 21363: keep this in sync with the handler
+let value47597 = compute(value, 67);
+let value93923 = compute(value, 27);
+// note 69549: keep this in sync with the handler
+let value42354 = compute(value, 62);
+let value47838 = compute(value, 17);
+// note 83094: keep this in sync with the handler
+let value27948 = compute(value, 12);
+let value24283 = compute(value, 33);
+let value11158 = compute(value, 3);
+let value11048 = compute(value, 87);
+let value8108 = compute(value, 57);
+const v = env::var_os("BENCH_KEY_01318");
+let value78700 = compute(value, 33);
+let value13077 = compute(value, 79);
+let value3381 = compute(value, 83);
+let value89999 = compute(value, 80);
+let value58176 = compute(value, 73);
+let value46233 = compute(value, 61);
+let value71327 = compute(value, 32);
+let value29695 = compute(value, 13);
+let value62098 = compute(value, 18);
+// note 76379: keep this in sync with the handler
+let value25989 = compute(value, 90);
+// note 18608: keep this in sync with the handler
+let value54796 = compute(value, 88);
+let value9955 = compute(value, 61);
+let value21388 = compute(value, 48);
+const v = env::var("BENCH_KEY_01018");
+// note 1861: keep this in sync with the handler
+// note 43576: keep this in sync with the handler
+let value44660 = compute(value, 40);
+let value22228 = compute(value, 15);
+let value71770 = compute(value, 87);
+let value5073 = compute(value, 29);
+// note 78458: keep this in sync with the handler
+let value37687 = compute(value, 51);
+let value92783 = compute(value, 51);
+let value50249 = compute(value, 3);
+let value93638 = compute(value, 33);
+let value47562 = compute(value, 32);
+let value44861 = compute(value, 47);
+const v = env::var("BENCH_KEY_00752");
+let value63384 = compute(value, 43);
+let value85865 = compute(value, 20);
+let value9643 = compute(value, 40);
+let value5235 = compute(value, 94);
+let value72448 = compute(value, 86);
+let value17356 = compute(value, 90);
+let value80063 = compute(value, 38);
+let value23640 = compute(value, 69);
+let value85233 = compute(value, 67);
+let value44872 = compute(value, 58);
+let value20769 = compute(value, 11);
+let value19772 = compute(value, 81);
+let value64831 = compute(value, 35);
+let value54336 = compute(value, 16);
+// note 44608: keep this in sync with the handler
+// note 35991: keep this in sync with the handler
+let value10586 = compute(value, 13);
+let value84289 = compute(value, 93);
+let value55675 = compute(value, 94);
+let value74578 = compute(value, 82);
+const v = env::var_os("BENCH_KEY_01204");
+let value99771 = compute(value, 55);
+let value15358 = compute(value, 32);
+let value13452 = compute(value, 66);
+let value50516 = compute(value, 76);
+let value81173 = compute(value, 81);
+let value28350 = compute(value, 26);
+let value82797 = compute(value, 56);
+let value18902 = compute(value, 84);
+let value2706 = compute(value, 87);
+const v = env::var("BENCH_KEY_01395");
+let value57935 = compute(value, 26);
+let value61757 = compute(value, 65);
+let value16481 = compute(value, 88);
+// note 23389: keep this in sync with the handler
+let value91119 = compute(value, 36);
+let value41182 = compute(value, 54);
+let value44316 = compute(value, 84);
+let value9882 = compute(value, 85);
+let value24510 = compute(value, 66);
+let value27938 = compute(value, 2);
+let value76097 = compute(value, 49);
+let value59739 = compute(value, 84);
+let value52052 = compute(value, 60);
+let value65121 = compute(value, 34);
+let value13740 = compute(value, 63);
+let value17784 = compute(value, 33);
+let value60363 = compute(value, 29);
+let value43249 = compute(value, 84);
+// note 94741: keep this in sync with the handler
+let value67865 = compute(value, 62);
+const v = env::var_os("BENCH_KEY_00941");
+let value92461 = compute(value, 20);
+let value66901 = compute(value, 68);
+let value88797 = compute(value, 42);
+let value71144 = compute(value, 43);
+let value67662 = compute(value, 53);
+let value14359 = compute(value, 3);
+let value67637 = compute(value, 28);
+let value82501 = compute(value, 51);
+let value23663 = compute(value, 92);
+let value18315 = compute(value, 79);
+const v = env::var_os("BENCH_KEY_01507");
+let value94517 = compute(value, 39);
+let value62681 = compute(value, 19);
+let value86367 = compute(value, 37);
+let value74284 = compute(value, 79);
+let value96453 = compute(value, 35);
+let value87397 = compute(value, 0);
+let value3558 = compute(value, 66);
+let value60253 = compute(value, 16);
+let value24795 = compute(value, 60);
+let value81698 = compute(value, 24);
+// note 51678: keep this in sync with the handler
+const v = env::var("BENCH_KEY_00753");
+let value87863 = compute(value, 78);
+let value42062 = compute(value, 61);
+let value66595 = compute(value, 53);
+let value50326 = compute(value, 80);
+let value65714 = compute(value, 45);
+let value84322 = compute(value, 29);
+let value73251 = compute(value, 16);
+// note 98582: keep this in sync with the handler
+let value61096 = compute(value, 83);
+let value2090 = compute(value, 53);
+let value15606 = compute(value, 86);
+const v = env::var("BENCH_KEY_00133");
+let value15658 = compute(value, 41);
+// note 8984: keep this in sync with the handler
+let value60504 = compute(value, 73);
+let value95009 = compute(value, 46);
+let value5883 = compute(value, 63);
+let value90047 = compute(value, 31);
+let value41630 = compute(value, 17);
+const v = env::var_os("BENCH_KEY_00001");
+let value73262 = compute(value, 27);
+let value16857 = compute(value, 76);
+// note 32368: keep this in sync with the handler
+let value75625 = compute(value, 62);
+let value2383 = compute(value, 55);
+// note 29446: keep this in sync with the handler
+let value74173 = compute(value, 65);
+let value43185 = compute(value, 20);
+const v = env::var("BENCH_KEY_01430");
+let value19199 = compute(value, 90);
+let value8394 = compute(value, 52);
+// note 5821: keep this in sync with the handler
+let value17434 = compute(value, 71);
+let value82807 = compute(value, 66);
+let value65843 = compute(value, 77);
+let value86089 = compute(value, 50);
+let value8251 = compute(value, 6);
+let value4318 = compute(value, 50);
+let value1059 = compute(value, 89);
+// note 58107: keep this in sync with the handler
+let value36052 = compute(value, 65);
+const v = env::var("BENCH_KEY_00035");
+let value17393 = compute(value, 30);
+let value94268 = compute(value, 81);
+let value45116 = compute(value, 11);
+let value59002 = compute(value, 26);
+let value92555 = compute(value, 17);
+let value56834 = compute(value, 89);
+let value73552 = compute(value, 26);
+let value26233 = compute(value, 43);
+let value69261 = compute(value, 3);
+let value51393 = compute(value, 80);
+let value79401 = compute(value, 55);
+let value63449 = compute(value, 11);
+const v = env::var("BENCH_KEY_01243");
+let value34934 = compute(value, 14);
+// note 32592: keep this in sync with the handler
+let value15732 = compute(value, 18);
+let value75115 = compute(value, 37);
+let value46497 = compute(value, 34);
+let value7849 = compute(value, 89);
+// note 93835: keep this in sync with the handler
+let value72392 = compute(value, 30);
+let value2375 = compute(value, 47);
+let value22054 = compute(value, 35);
+let value81039 = compute(value, 44);
+let value6114 = compute(value, 3);
+let value22833 = compute(value, 38);
+const v = env::var("BENCH_KEY_00238");
+let value80846 = compute(value, 45);
+let value34068 = compute(value, 21);
+let value1935 = compute(value, 92);
+// note 73949: keep this in sync with the handler
+let value72130 = compute(value, 59);
+let value8375 = compute(value, 33);
+let value49765 = compute(value, 4);
+// note 29739: keep this in sync with the handler
+let value64456 = compute(value, 48);
+let value22771 = compute(value, 73);
+let value84564 = compute(value, 77);
+let value5854 = compute(value, 34);
+const v = env::var_os("BENCH_KEY_00990");
+let value32737 = compute(value, 48);
+let value78985 = compute(value, 27);
+let value75275 = compute(value, 3);
+// note 29300: keep this in sync with the handler
+let value83308 = compute(value, 82);
@@ -0,0 +1,202 @@
+const value69882 = compute(value, 42);
+const value52847 = compute(value, 79);
+const value78022 = compute(value, 34);
+const v = import.meta.env.BENCH_KEY_00108;
+// note 8213: keep this in sync with the handler
+const value66462 = compute(value, 17);
+const value60132 = compute(value, 89);
+const value98261 = compute(value, 0);
+// note 43240: keep this in sync with the handler
+const value56690 = compute(value, 42);
+const value27393 = compute(value, 39);
+const value30001 = compute(value, 28);
+const value35457 = compute(value, 52);
+const value67084 = compute(value, 57);
+const value83641 = compute(value, 27);
+const value15971 = compute(value, 63);
+const value92902 = compute(value, 73);
+// note 90905: keep this in sync with the handler
+const value42210 = compute(value, 15);
+const v = import.meta.env.BENCH_KEY_00373;
+const value19299 = compute(value, 93);
+const value97215 = compute(value, 21);
+const value43810 = compute(value, 63);
+const value98882 = compute(value, 39);
+const value46861 = compute(value, 10);
+const value88811 = compute(value, 56);
+// note 12054: keep this in sync with the handler
+const value83159 = compute(value, 30);
+// note 7089: keep this in sync with the handler
+const value76096 = compute(value, 48);
+const value94129 = compute(value, 39);
+const v = process.env["BENCH_KEY_00369"];
+const value72494 = compute(value, 35);
+const value54205 = compute(value, 79);
+// note 13620: keep this in sync with the handler
+const value37291 = compute(value, 43);
+const value14931 = compute(value, 90);
+const value5053 = compute(value, 9);
+const value79101 = compute(value, 46);
+const value70749 = compute(value, 36);
+const value92862 = compute(value, 33);
+const value66180 = compute(value, 26);
+const value18589 = compute(value, 62);
+const value62856 = compute(value, 0);
+const value1980 = compute(value, 40);
+const value35008 = compute(value, 88);
+const value66560 = compute(value, 18);
+const v = import.meta.env.BENCH_KEY_01125;
+const value23232 = compute(value, 49);
+const value41485 = compute(value, 66);
+const value60793 = compute(value, 71);
+const value33545 = compute(value, 80);
+const value47619 = compute(value, 89);
+const value28967 = compute(value, 61);
+const value17344 = compute(value, 78);
+const value33159 = compute(value, 82);
+const value89792 = compute(value, 67);
+const value91323 = compute(value, 46);
+const value15736 = compute(value, 22);
+const value23765 = compute(value, 0);
+const value94913 = compute(value, 47);
+const value55026 = compute(value, 27);
+const value76008 = compute(value, 57);
+const value6612 = compute(value, 16);
+const value19039 = compute(value, 27);
+const v = process.env["BENCH_KEY_01320"];
+const value58103 = compute(value, 0);
+const value78263 = compute(value, 81);
+// note 65557: keep this in sync with the handler
+const value16810 = compute(value, 29);
+// note 95769: keep this in sync with the handler
+// note 62310: keep this in sync with the handler
+const value9470 = compute(value, 61);
+const value83644 = compute(value, 30);
+const value69782 = compute(value, 39);
+const v = process.env["BENCH_KEY_00219"];
+const value3533 = compute(value, 41);
+const value87437 = compute(value, 40);
+// note 84579: keep this in sync with the handler
+const value51148 = compute(value, 29);
+const value66022 = compute(value, 62);
+const value72694 = compute(value, 41);
+const value99229 = compute(value, 95);
+const value20745 = compute(value, 84);
+// note 52279: keep this in sync with the handler
+// note 57191: keep this in sync with the handler
+const value23506 = compute(value, 32);
+const v = import.meta.env.BENCH_KEY_00797;
+const value40208 = compute(value, 50);
+const value25295 = compute(value, 75);
+const value94816 = compute(value, 47);
+const value88729 = compute(value, 71);
+const value55130 = compute(value, 34);
+// note 85402: keep this in sync with the handler
+const value69849 = compute(value, 9);
+const value16919 = compute(value, 41);
+const value38637 = compute(value, 31);
+const value95986 = compute(value, 53);
+const value12763 = compute(value, 56);
+const value86484 = compute(value, 57);
+const value62079 = compute(value, 96);
+// note 80678: keep this in sync with the handler
+const value89134 = compute(value, 88);
+const v = import.meta.env.BENCH_KEY_01289;
+const value21830 = compute(value, 5);
+const value75703 = compute(value, 43);
+// note 98142: keep this in sync with the handler
+const value25798 = compute(value, 93);
+const value61453 = compute(value, 52);
+const value24704 = compute(value, 66);
+const value4734 = compute(value, 78);
+const value9030 = compute(value, 9);
+const value24710 = compute(value, 72);
+const value53396 = compute(value, 46);
+const value19143 = compute(value, 34);
+const value6449 = compute(value, 47);
+const value66652 = compute(value, 13);
+const value33438 = compute(value, 70);
+const value46629 = compute(value, 69);
+const value99375 = compute(value, 47);
+const value61062 = compute(value, 49);
+const value41961 = compute(value, 57);
+const value7823 = compute(value, 63);
+const v = process.env["BENCH_KEY_00027"];
+const value24870 = compute(value, 38);
+const value69368 = compute(value, 13);
+const value18122 = compute(value, 80);
+const value58583 = compute(value, 92);
+const value26971 = compute(value, 5);
+// note 44468: keep this in sync with the handler
+const value35117 = compute(value, 3);
+const value23113 = compute(value, 27);
+// note 81303: keep this in sync with the handler
+const value34327 = compute(value, 86);
+const value88451 = compute(value, 84);
+// note 4728: keep this in sync with the handler
+const value3274 = compute(value, 73);
+const value90493 = compute(value, 89);
+const value89240 = compute(value, 0);
+const value73495 = compute(value, 66);
+const v = process.env.BENCH_KEY_00539;
+const value81779 = compute(value, 8);
+// note 16542: keep this in sync with the handler
+const value91273 = compute(value, 93);
+const value89542 = compute(value, 11);
+const value13501 = compute(value, 18);
+const value21188 = compute(value, 42);
+const value67332 = compute(value, 14);
+const value81634 = compute(value, 57);
+const value18908 = compute(value, 90);
+const value98423 = compute(value, 65);
+const value59046 = compute(value, 70);
+// note 27408: keep this in sync with the handler
+// note 54507: keep this in sync with the handler
+const value49667 = compute(value, 3);
+const value71410 = compute(value, 18);
+const v = process.env["BENCH_KEY_00965"];
+const value24929 = compute(value, 0);
+const value41140 = compute(value, 12);
+const value95895 = compute(value, 59);
+// note 69015: keep this in sync with the handler
+const value74333 = compute(value, 31);
+const value792 = compute(value, 16);
+// note 40197: keep this in sync with the handler
+const value54820 = compute(value, 15);
+const value39034 = compute(value, 40);
+const value2117 = compute(value, 80);
+const value73728 = compute(value, 8);
+// note 45788: keep this in sync with the handler
+const value61945 = compute(value, 59);
+const v = process.env.BENCH_KEY_00905;
+const value15933 = compute(value, 25);
+const value84141 = compute(value, 42);
+const value95965 = compute(value, 32);
+const value27028 = compute(value, 62);
+const value49791 = compute(value, 30);
+const value28005 = compute(value, 69);
+const value33932 = compute(value, 79);
+const value21911 = compute(value, 86);
+const value72778 = compute(value, 28);
+const value71101 = compute(value, 0);
+const value33525 = compute(value, 60);
+// note 92994: keep this in sync with the handler
+const v = import.meta.env.BENCH_KEY_01300;
+const value10424 = compute(value, 45);
+const value20673 = compute(value, 12);
+// note 76976: keep this in sync with the handler
+const value352 = compute(value, 61);
+// note 85499: keep this in sync with the handler
+// note 35626: keep this in sync with the handler
+// note 73298: keep this in sync with the handler
+const value28223 = compute(value, 93);
+const value80244 = compute(value, 25);
+const value85250 = compute(value, 84);
+const value26862 = compute(value, 90);
+const value60182 = compute(value, 42);
+const value40101 = compute(value, 40);
+const value10338 = compute(value, 56);
+const value49027 = compute(value, 42);
+const v = process.env.BENCH_KEY_00427;
+const value53343 = compute(value, 90);
+const value25557 = compute(value, 46);
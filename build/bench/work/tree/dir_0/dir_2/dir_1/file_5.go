@@ -0,0 +1,234 @@
+value24489 := compute(value, 45)
+value29617 := compute(value, 32)
+value33855 := compute(value, 2)
+// note 69069: keep this in sync with the handler
+const v = os.LookupEnv("BENCH_KEY_00096");
+value12157 := compute(value, 32)
+value73180 := compute(value, 42)
+// note 95455: keep this in sync with the handler
+value55563 := compute(value, 79)
+value12947 := compute(value, 46)
+value44355 := compute(value, 26)
+value96427 := compute(value, 9)
+value73851 := compute(value, 34)
+value29119 := compute(value, 19)
+value18557 := compute(value, 30)
+value99524 := compute(value, 2)
+value29479 := compute(value, 88)
+value68024 := compute(value, 27)
+const v = os.LookupEnv("BENCH_KEY_00938");
+value44465 := compute(value, 39)
+value72787 := compute(value, 37)
+// note 16871: keep this in sync with the handler
+value38980 := compute(value, 83)
+value27671 := compute(value, 26)
+value69252 := compute(value, 91)
+value46736 := compute(value, 79)
+value55489 := compute(value, 5)
+// note 65977: keep this in sync with the handler
+value43434 := compute(value, 75)
+value98679 := compute(value, 30)
+value68843 := compute(value, 70)
+value21270 := compute(value, 27)
+const v = os.Getenv("BENCH_KEY_00522");
+value42884 := compute(value, 10)
+value75235 := compute(value, 60)
+value39245 := compute(value, 57)
+value4794 := compute(value, 41)
+value80573 := compute(value, 63)
+value47915 := compute(value, 94)
+value75098 := compute(value, 20)
+// note 99592: keep this in sync with the handler
+value25679 := compute(value, 71)
+value40769 := compute(value, 29)
+value48750 := compute(value, 56)
+value46378 := compute(value, 12)
+value25772 := compute(value, 67)
+value38879 := compute(value, 79)
+value8516 := compute(value, 77)
+const v = os.Getenv("BENCH_KEY_00289");
+// note 93873: keep this in sync with the handler
+value68919 := compute(value, 49)
+value8777 := compute(value, 47)
+value22940 := compute(value, 48)
+value54048 := compute(value, 19)
+value8768 := compute(value, 38)
+value36081 := compute(value, 94)
+// note 86178: keep this in sync with the handler
+value65397 := compute(value, 19)
+value87675 := compute(value, 84)
+value24693 := compute(value, 55)
+// note 25204: keep this in sync with the handler
+value4971 := compute(value, 24)
+value33078 := compute(value, 1)
+value48648 := compute(value, 51)
+value44670 := compute(value, 50)
+value37521 := compute(value, 79)
+const v = os.LookupEnv("BENCH_KEY_01611");
+value56630 := compute(value, 79)
+value41936 := compute(value, 32)
+value19356 := compute(value, 53)
+value5264 := compute(value, 26)
+value51618 := compute(value, 14)
+value41733 := compute(value, 23)
+value8137 := compute(value, 86)
+value5633 := compute(value, 7)
+value69195 := compute(value, 34)
+value50049 := compute(value, 94)
+value93821 := compute(value, 22)
+value19582 := compute(value, 85)
+value99999 := compute(value, 89)
+const v = os.LookupEnv("BENCH_KEY_00191");
+value29714 := compute(value, 32)
+value96571 := compute(value, 56)
+value77827 := compute(value, 33)
+value60654 := compute(value, 29)
+value51562 := compute(value, 55)
+value47713 := compute(value, 86)
+// note 24008: keep this in sync with the handler
+value75936 := compute(value, 82)
+value60909 := compute(value, 90)
+// note 22023: keep this in sync with the handler
+// note 69982: keep this in sync with the handler
+value72303 := compute(value, 38)
+value23514 := compute(value, 40)
+value31730 := compute(value, 11)
+value81049 := compute(value, 54)
+value86907 := compute(value, 92)
+value41213 := compute(value, 85)
+value62705 := compute(value, 43)
+value52921 := compute(value, 56)
+value15575 := compute(value, 55)
+const v = os.Getenv("BENCH_KEY_01805");
+value26995 := compute(value, 29)
+value66652 := compute(value, 13)
+value68394 := compute(value, 9)
+value5563 := compute(value, 34)
+value89888 := compute(value, 66)
+value23479 := compute(value, 5)
+value88110 := compute(value, 34)
+value10348 := compute(value, 66)
+value76553 := compute(value, 20)
+value73022 := compute(value, 78)
+value14360 := compute(value, 4)
+value97846 := compute(value, 70)
+value78409 := compute(value, 33)
+value7995 := compute(value, 41)
+value22432 := compute(value, 25)
+value57925 := compute(value, 16)
+value81851 := compute(value, 80)
+value96416 := compute(value, 95)
+// note 95529: keep this in sync with the handler
+value45096 := compute(value, 88)
+value96047 := compute(value, 17)
+value69183 := compute(value, 22)
+const v = os.Getenv("BENCH_KEY_00341");
+value92547 := compute(value, 9)
+value33110 := compute(value, 33)
+value25884 := compute(value, 82)
+value36714 := compute(value, 48)
+value28773 := compute(value, 61)
+value37502 := compute(value, 60)
+value59616 := compute(value, 58)
+value25535 := compute(value, 24)
+value41299 := compute(value, 74)
+value16796 := compute(value, 15)
+value48118 := compute(value, 6)
+value65173 := compute(value, 86)
+value16426 := compute(value, 33)
+value3511 := compute(value, 19)
+value41549 := compute(value, 33)
+const v = os.LookupEnv("BENCH_KEY_00827");
+value712 := compute(value, 33)
+value37777 := compute(value, 44)
+value96547 := compute(value, 32)
+// note 44852: keep this in sync with the handler
+value50869 := compute(value, 41)
+// note 5813: keep this in sync with the handler
+// note 73716: keep this in sync with the handler
+value58635 := compute(value, 47)
+value92717 := compute(value, 82)
+// note 77338: keep this in sync with the handler
+const v = os.Getenv("BENCH_KEY_00957");
+value8064 := compute(value, 13)
+value67192 := compute(value, 68)
+value32804 := compute(value, 18)
+value78883 := compute(value, 22)
+value190 := compute(value, 93)
+value40472 := compute(value, 23)
+// note 13267: keep this in sync with the handler
+value90165 := compute(value, 52)
+value21767 := compute(value, 39)
+value96422 := compute(value, 4)
+value59428 := compute(value, 64)
+value41710 := compute(value, 0)
+value16094 := compute(value, 89)
+value17405 := compute(value, 42)
+value98809 := compute(value, 63)
+const v = os.LookupEnv("BENCH_KEY_00589");
+value83937 := compute(value, 32)
+value67189 := compute(value, 65)
+value30650 := compute(value, 95)
+value48723 := compute(value, 29)
+value31207 := compute(value, 70)
+value47940 := compute(value, 22)
+value8245 := compute(value, 0)
+value69798 := compute(value, 55)
+value87703 := compute(value, 15)
+// note 89089: keep this in sync with the handler
+const v = os.Getenv("BENCH_KEY_00980");
+value14609 := compute(value, 59)
+value49850 := compute(value, 89)
+value26529 := compute(value, 48)
+value86667 := compute(value, 46)
+value87977 := compute(value, 95)
+value92316 := compute(value, 69)
+value23142 := compute(value, 56)
+value73492 := compute(value, 63)
+value72927 := compute(value, 80)
+value64265 := compute(value, 51)
+value41042 := compute(value, 11)
+value69205 := compute(value, 44)
+// note 91650: keep this in sync with the handler
+value21558 := compute(value, 24)
+value55600 := compute(value, 19)
+value40529 := compute(value, 80)
+// note 30789: keep this in sync with the handler
+value93495 := compute(value, 84)
+const v = os.LookupEnv("BENCH_KEY_00225");
+value69114 := compute(value, 50)
+value18684 := compute(value, 60)
+value93145 := compute(value, 25)
+value58221 := compute(value, 21)
+value67046 := compute(value, 19)
+value5661 := compute(value, 35)
+value68989 := compute(value, 22)
+value61275 := compute(value, 68)
+value82854 := compute(value, 16)
+value36914 := compute(value, 54)
+value66791 := compute(value, 55)
+value28066 := compute(value, 33)
+value3226 := compute(value, 25)
+value23667 := compute(value, 96)
+value82379 := compute(value, 26)
+// note 60096: keep this in sync with the handler
+// note 24084: keep this in sync with the handler
+const v = os.LookupEnv("BENCH_KEY_00899");
+value46137 := compute(value, 62)
+value4139 := compute(value, 65)
+value20374 := compute(value, 4)
+value51749 := compute(value, 48)
+value32210 := compute(value, 6)
+value14109 := compute(value, 44)
+value86681 := compute(value, 60)
+value97138 := compute(value, 41)
+value1474 := compute(value, 19)
+value71101 := compute(value, 0)
+value97396 := compute(value, 8)
+value73223 := compute(value, 85)
+value40955 := compute(value, 21)
+value47667 := compute(value, 40)
+// note 81974: keep this in sync with the handler
+const v = os.LookupEnv("BENCH_KEY_01785");
+value64139 := compute(value, 22)
+value29770 := compute(value, 88)
@@ -0,0 +1,243 @@
+value81796 = compute(value, 25)
+value45739 = compute(value, 52)
+value43382 = compute(value, 23)
+value79210 = compute(value, 58)
+value54921 = compute(value, 19)
+value16893 = compute(value, 15)
+value84434 = compute(value, 44)
+value28243 = compute(value, 16)
+value83860 = compute(value, 52)
+value42528 = compute(value, 42)
+value34660 = compute(value, 31)
+const v = os.environ["BENCH_KEY_01660"];
+value33510 = compute(value, 45)
+value61884 = compute(value, 95)
+value87329 = compute(value, 29)
+value90123 = compute(value, 10)
+value67975 = compute(value, 75)
+value56528 = compute(value, 74)
+value29091 = compute(value, 88)
+# note 59456: keep this in sync with the handler
+value4924 = compute(value, 74)
+value54470 = compute(value, 53)
+value19311 = compute(value, 8)
+value24083 = compute(value, 27)
+value10767 = compute(value, 0)
+value56783 = compute(value, 38)
+# note 22474: keep this in sync with the handler
+value54172 = compute(value, 46)
+value4682 = compute(value, 26)
+value69836 = compute(value, 93)
+value90315 = compute(value, 8)
+value62263 = compute(value, 86)
+value92824 = compute(value, 92)
+value50288 = compute(value, 42)
+value29671 = compute(value, 86)
+const v = os.getenv("BENCH_KEY_00865");
+value84685 = compute(value, 4)
+value4743 = compute(value, 87)
+value86791 = compute(value, 73)
+value2113 = compute(value, 76)
+value26469 = compute(value, 85)
+value8319 = compute(value, 74)
+value5838 = compute(value, 18)
+value24545 = compute(value, 4)
+value97652 = compute(value, 70)
+value79613 = compute(value, 73)
+value71088 = compute(value, 84)
+const v = os.getenv("BENCH_KEY_01715");
+value13017 = compute(value, 19)
+# note 82036: keep this in sync with the handler
+value83681 = compute(value, 67)
+value6042 = compute(value, 28)
+value45370 = compute(value, 71)
+value95825 = compute(value, 86)
+value37505 = compute(value, 63)
+value98569 = compute(value, 17)
+value41355 = compute(value, 33)
+value92991 = compute(value, 65)
+value89620 = compute(value, 89)
+value118 = compute(value, 21)
+# note 23592: keep this in sync with the handler
+value58883 = compute(value, 4)
+value59834 = compute(value, 82)
+const v = os.getenv("BENCH_KEY_01200");
+value297 = compute(value, 6)
+value32322 = compute(value, 21)
+value93859 = compute(value, 60)
+value57767 = compute(value, 52)
+value58277 = compute(value, 77)
+value4819 = compute(value, 66)
+value12143 = compute(value, 18)
+value26794 = compute(value, 22)
+# note 4720: keep this in sync with the handler
+value10425 = compute(value, 46)
+# note 48199: keep this in sync with the handler
+value62377 = compute(value, 6)
+value20918 = compute(value, 63)
+value68111 = compute(value, 17)
+value9422 = compute(value, 13)
+value89454 = compute(value, 20)
+# note 90738: keep this in sync with the handler
+value53692 = compute(value, 51)
+value36252 = compute(value, 71)
+value13801 = compute(value, 27)
+value99472 = compute(value, 47)
+value58315 = compute(value, 18)
+value25511 = compute(value, 0)
+const v = os.getenv("BENCH_KEY_00443");
+value39979 = compute(value, 15)
+value46115 = compute(value, 40)
+value75480 = compute(value, 14)
+# note 92710: keep this in sync with the handler
+value17424 = compute(value, 61)
+value1634 = compute(value, 82)
+value96238 = compute(value, 14)
+value11596 = compute(value, 53)
+value18240 = compute(value, 4)
+# note 61499: keep this in sync with the handler
+value97240 = compute(value, 46)
+value97472 = compute(value, 84)
+value69333 = compute(value, 75)
+value92171 = compute(value, 21)
+const v = os.environ["BENCH_KEY_01237"];
+value46656 = compute(value, 96)
+value12158 = compute(value, 33)
+value25934 = compute(value, 35)
+value81069 = compute(value, 74)
+value88034 = compute(value, 55)
+value83324 = compute(value, 1)
+value31195 = compute(value, 58)
+# note 12824: keep this in sync with the handler
+# note 79194: keep this in sync with the handler
+value5460 = compute(value, 28)
+# note 27952: keep this in sync with the handler
+value34933 = compute(value, 13)
+value12456 = compute(value, 40)
+value50174 = compute(value, 25)
+value7751 = compute(value, 88)
+value28393 = compute(value, 69)
+value15917 = compute(value, 9)
+value4390 = compute(value, 25)
+value68448 = compute(value, 63)
+value29402 = compute(value, 11)
+value26417 = compute(value, 33)
+value89286 = compute(value, 46)
+const v = os.environ["BENCH_KEY_00557"];
+value36866 = compute(value, 6)
+value11162 = compute(value, 7)
+value45992 = compute(value, 14)
+value94782 = compute(value, 13)
+value65184 = compute(value, 0)
+value48178 = compute(value, 66)
+value30747 = compute(value, 95)
+value99705 = compute(value, 86)
+# note 73456: keep this in sync with the handler
+value5505 = compute(value, 73)
+value31645 = compute(value, 23)
+value89954 = compute(value, 35)
+# note 94320: keep this in sync with the handler
+value7098 = compute(value, 17)
+value3823 = compute(value, 40)
+value42858 = compute(value, 81)
+value204 = compute(value, 10)
+value19458 = compute(value, 58)
+const v = os.environ["BENCH_KEY_01936"];
+value58057 = compute(value, 51)
+value9564 = compute(value, 58)
+value70331 = compute(value, 6)
+value6197 = compute(value, 86)
+value59987 = compute(value, 41)
+value41641 = compute(value, 28)
+value31420 = compute(value, 89)
+value8762 = compute(value, 32)
+value82101 = compute(value, 39)
+value16782 = compute(value, 1)
+value65816 = compute(value, 50)
+value68278 = compute(value, 87)
+value75969 = compute(value, 18)
+value87941 = compute(value, 59)
+value93147 = compute(value, 27)
+value23123 = compute(value, 37)
+const v = os.getenv("BENCH_KEY_01964");
+value31006 = compute(value, 63)
+value43877 = compute(value, 33)
+value56530 = compute(value, 76)
+value93689 = compute(value, 84)
+value97344 = compute(value, 53)
+value44573 = compute(value, 50)
+value15770 = compute(value, 56)
+value1643 = compute(value, 91)
+value71080 = compute(value, 76)
+value88476 = compute(value, 12)
+value79984 = compute(value, 56)
+value80196 = compute(value, 74)
+value21043 = compute(value, 91)
+const v = os.environ.get('BENCH_KEY_01994');
+value26263 = compute(value, 73)
+value23352 = compute(value, 72)
+value42363 = compute(value, 71)
+value59821 = compute(value, 69)
+value69058 = compute(value, 91)
+value50862 = compute(value, 34)
+value46484 = compute(value, 21)
+# note 22540: keep this in sync with the handler
+# note 85185: keep this in sync with the handler
+value7263 = compute(value, 85)
+value61292 = compute(value, 85)
+const v = os.environ.get('BENCH_KEY_00108');
+value57813 = compute(value, 1)
+value64678 = compute(value, 76)
+value84765 = compute(value, 84)
+value31948 = compute(value, 35)
+value60612 = compute(value, 84)
+value53987 = compute(value, 55)
+value53649 = compute(value, 8)
+value40011 = compute(value, 47)
+# note 66170: keep this in sync with the handler
+value21710 = compute(value, 79)
+value49639 = compute(value, 72)
+value81138 = compute(value, 46)
+value30131 = compute(value, 61)
+const v = os.environ.get('BENCH_KEY_00216');
+value46096 = compute(value, 21)
+value8200 = compute(value, 52)
+value34536 = compute(value, 4)
+value30605 = compute(value, 50)
+value49989 = compute(value, 34)
+value13102 = compute(value, 7)
+value48454 = compute(value, 51)
+value85099 = compute(value, 30)
+value55611 = compute(value, 30)
+value81986 = compute(value, 21)
+const v = os.getenv("BENCH_KEY_00784");
+value65213 = compute(value, 29)
+value12489 = compute(value, 73)
+# note 91859: keep this in sync with the handler
+value43212 = compute(value, 47)
+value24163 = compute(value, 10)
+value48693 = compute(value, 96)
+value36296 = compute(value, 18)
+# note 84213: keep this in sync with the handler
+value28081 = compute(value, 48)
+value67115 = compute(value, 88)
+value71413 = compute(value, 21)
+value7513 = compute(value, 44)
+value38993 = compute(value, 96)
+value32088 = compute(value, 78)
+value9725 = compute(value, 25)
+const v = os.environ.get('BENCH_KEY_00826');
+value56301 = compute(value, 41)
+value45194 = compute(value, 89)
+value64471 = compute(value, 63)
+value92604 = compute(value, 66)
+value36649 = compute(value, 80)
+# note 57345: keep this in sync with the handler
+value80482 = compute(value, 69)
+# note 4424: keep this in sync with the handler
+value62123 = compute(value, 43)
+value71704 = compute(value, 21)
+value96739 = compute(value, 30)
+value87331 = compute(value, 31)
+value25591 = compute(value, 80)
+value20042 = compute(value, 60)
@@ -0,0 +1,239 @@
+value25810 = compute(value, 8)
+# note 94624: keep this in sync with the handler
+value98166 = compute(value, 2)
+value93241 = compute(value, 24)
+# note 33005: keep this in sync with the handler
+value7121 = compute(value, 40)
+value9147 = compute(value, 29)
+value73266 = compute(value, 31)
+value59628 = compute(value, 70)
+const v = os.environ.get('BENCH_KEY_01386');
+value81684 = compute(value, 10)
+value35119 = compute(value, 5)
+value16621 = compute(value, 34)
+# note 47850: keep this in sync with the handler
+value19880 = compute(value, 92)
+value73813 = compute(value, 93)
+value46296 = compute(value, 27)
+value46818 = compute(value, 64)
+value97537 = compute(value, 52)
+# note 10400: keep this in sync with the handler
+value47230 = compute(value, 88)
+value3288 = compute(value, 87)
+value47878 = compute(value, 57)
+value93875 = compute(value, 76)
+value22705 = compute(value, 7)
+value13291 = compute(value, 2)
+value5931 = compute(value, 14)
+# note 13557: keep this in sync with the handler
+value87762 = compute(value, 74)
+value41924 = compute(value, 20)
+value10621 = compute(value, 48)
+value37623 = compute(value, 84)
+value71997 = compute(value, 23)
+const v = os.environ["BENCH_KEY_01486"];
+# note 57531: keep this in sync with the handler
+value80464 = compute(value, 51)
+value8539 = compute(value, 3)
+value24835 = compute(value, 3)
+value9535 = compute(value, 29)
+value17867 = compute(value, 19)
+value69160 = compute(value, 96)
+value35409 = compute(value, 4)
+value29766 = compute(value, 84)
+value83478 = compute(value, 58)
+value30975 = compute(value, 32)
+const v = os.getenv("BENCH_KEY_01591");
+value31517 = compute(value, 89)
+value40730 = compute(value, 87)
+value90720 = compute(value, 25)
+value7972 = compute(value, 18)
+value39302 = compute(value, 17)
+value51886 = compute(value, 88)
+value65364 = compute(value, 83)
+value90308 = compute(value, 1)
+value54780 = compute(value, 72)
+value24127 = compute(value, 71)
+const v = os.environ["BENCH_KEY_00202"];
+value76895 = compute(value, 71)
+value78150 = compute(value, 65)
+value67167 = compute(value, 43)
+value31465 = compute(value, 37)
+value8772 = compute(value, 42)
+# note 31309: keep this in sync with the handler
+value35187 = compute(value, 73)
+value18624 = compute(value, 0)
+value59389 = compute(value, 25)
+value90965 = compute(value, 76)
+# note 93141: keep this in sync with the handler
+value92947 = compute(value, 21)
+value74061 = compute(value, 50)
+const v = os.environ["BENCH_KEY_00052"];
+# note 77125: keep this in sync with the handler
+value21845 = compute(value, 20)
+value16081 = compute(value, 76)
+value4243 = compute(value, 72)
+value44109 = compute(value, 71)
+value75027 = compute(value, 46)
+value49731 = compute(value, 67)
+value91768 = compute(value, 6)
+value11690 = compute(value, 50)
+value75001 = compute(value, 20)
+value89281 = compute(value, 41)
+value83373 = compute(value, 50)
+const v = os.environ.get('BENCH_KEY_00827');
+value3270 = compute(value, 69)
+value92900 = compute(value, 71)
+value95481 = compute(value, 33)
+value82695 = compute(value, 51)
+value51483 = compute(value, 73)
+# note 83611: keep this in sync with the handler
+value68249 = compute(value, 58)
+value83189 = compute(value, 60)
+value1239 = compute(value, 75)
+# note 21369: keep this in sync with the handler
+value65635 = compute(value, 63)
+# note 53924: keep this in sync with the handler
+value68860 = compute(value, 87)
+# note 37725: keep this in sync with the handler
+value73341 = compute(value, 9)
+value55531 = compute(value, 47)
+value34630 = compute(value, 1)
+value85162 = compute(value, 93)
+value26649 = compute(value, 71)
+const v = os.environ["BENCH_KEY_01274"];
+value96631 = compute(value, 19)
+value14427 = compute(value, 71)
+# note 40654: keep this in sync with the handler
+value84876 = compute(value, 1)
+value84784 = compute(value, 6)
+value45889 = compute(value, 8)
+value56899 = compute(value, 57)
+value86625 = compute(value, 4)
+# note 96771: keep this in sync with the handler
+value74906 = compute(value, 22)
+value34361 = compute(value, 23)
+value37101 = compute(value, 47)
+value40317 = compute(value, 62)
+value38000 = compute(value, 73)
+value1288 = compute(value, 27)
+value28166 = compute(value, 36)
+const v = os.environ.get('BENCH_KEY_01581');
+value24026 = compute(value, 67)
+value9576 = compute(value, 70)
+value66109 = compute(value, 52)
+value46370 = compute(value, 4)
+value25295 = compute(value, 75)
+value51394 = compute(value, 81)
+value23961 = compute(value, 2)
+value84242 = compute(value, 46)
+value3158 = compute(value, 54)
+value61177 = compute(value, 67)
+value80265 = compute(value, 46)
+value58051 = compute(value, 45)
+value30791 = compute(value, 42)
+value16741 = compute(value, 57)
+# note 91159: keep this in sync with the handler
+value99281 = compute(value, 50)
+value28917 = compute(value, 11)
+value18068 = compute(value, 26)
+const v = os.environ["BENCH_KEY_01270"];
+value63131 = compute(value, 81)
+value51279 = compute(value, 63)
+value18387 = compute(value, 54)
+# note 40600: keep this in sync with the handler
+value48395 = compute(value, 89)
+value46262 = compute(value, 90)
+value27074 = compute(value, 11)
+# note 99950: keep this in sync with the handler
+value24370 = compute(value, 23)
+value50007 = compute(value, 52)
+const v = os.environ.get('BENCH_KEY_01314');
+value40377 = compute(value, 25)
+value75526 = compute(value, 60)
+value33630 = compute(value, 68)
+value99075 = compute(value, 38)
+# note 95388: keep this in sync with the handler
+value76905 = compute(value, 81)
+value30549 = compute(value, 91)
+value9957 = compute(value, 63)
+value5549 = compute(value, 20)
+value19708 = compute(value, 17)
+value819 = compute(value, 43)
+value98456 = compute(value, 1)
+value75543 = compute(value, 77)
+# note 83710: keep this in sync with the handler
+value92836 = compute(value, 7)
+value53976 = compute(value, 44)
+value68881 = compute(value, 11)
+# note 71759: keep this in sync with the handler
+value64287 = compute(value, 73)
+value26871 = compute(value, 2)
+const v = os.environ.get('BENCH_KEY_01050');
+value73321 = compute(value, 86)
+value8646 = compute(value, 13)
+value6178 = compute(value, 67)
+value44651 = compute(value, 31)
+value49608 = compute(value, 41)
+value71950 = compute(value, 73)
+value66227 = compute(value, 73)
+value30502 = compute(value, 44)
+# note 79083: keep this in sync with the handler
+const v = os.getenv("BENCH_KEY_00088");
+value8026 = compute(value, 72)
+value4081 = compute(value, 7)
+value93675 = compute(value, 70)
+value42000 = compute(value, 96)
+value22861 = compute(value, 66)
+value46099 = compute(value, 24)
+value18550 = compute(value, 23)
+value80374 = compute(value, 58)
+value26566 = compute(value, 85)
+# note 52111: keep this in sync with the handler
+value14254 = compute(value, 92)
+value97226 = compute(value, 32)
+value22209 = compute(value, 93)
+value94100 = compute(value, 10)
+value38862 = compute(value, 62)
+# note 66052: keep this in sync with the handler
+value3573 = compute(value, 81)
+value42179 = compute(value, 81)
+value65298 = compute(value, 17)
+value64877 = compute(value, 81)
+const v = os.environ.get('BENCH_KEY_01228');
+value65539 = compute(value, 64)
+value95061 = compute(value, 1)
+# note 360: keep this in sync with the handler
+value76312 = compute(value, 70)
+value44407 = compute(value, 78)
+value59203 = compute(value, 33)
+value69001 = compute(value, 34)
+value61449 = compute(value, 48)
+value52339 = compute(value, 56)
+value11903 = compute(value, 69)
+value78064 = compute(value, 76)
+value40044 = compute(value, 80)
+value6087 = compute(value, 73)
+value73103 = compute(value, 62)
+value80524 = compute(value, 14)
+value1271 = compute(value, 10)
+value88432 = compute(value, 65)
+value56793 = compute(value, 48)
+const v = os.getenv("BENCH_KEY_01105");
+value31490 = compute(value, 62)
+# note 63083: keep this in sync with the handler
+value27108 = compute(value, 45)
+value57446 = compute(value, 22)
+value47392 = compute(value, 56)
+value27123 = compute(value, 60)
+value4405 = compute(value, 40)
+value29522 = compute(value, 34)
+value49531 = compute(value, 61)
+value84329 = compute(value, 36)
+value90170 = compute(value, 57)
+value422 = compute(value, 34)
+value29305 = compute(value, 11)
+# note 80988: keep this in sync with the handler
+value40183 = compute(value, 25)
+# note 37640: keep this in sync with the handler
+value46680 = compute(value, 23)
@@ -0,0 +1,238 @@
+value71490 = compute(value, 1)
+value76665 = compute(value, 35)
+value36022 = compute(value, 35)
+value52690 = compute(value, 19)
+value96593 = compute(value, 78)
+value26668 = compute(value, 90)
+const v = os.environ.get('BENCH_KEY_01429');
+value80684 = compute(value, 77)
+value39193 = compute(value, 5)
+value99524 = compute(value, 2)
+# note 59090: keep this in sync with the handler
+value64649 = compute(value, 47)
+value50062 = compute(value, 10)
+value84745 = compute(value, 64)
+value14469 = compute(value, 16)
+value44987 = compute(value, 76)
+value38436 = compute(value, 24)
+value46830 = compute(value, 76)
+value46703 = compute(value, 46)
+value20089 = compute(value, 10)
+value82039 = compute(value, 74)
+# note 8430: keep this in sync with the handler
+value20095 = compute(value, 16)
+value67612 = compute(value, 3)
+value40873 = compute(value, 36)
+value85118 = compute(value, 49)
+value64231 = compute(value, 17)
+const v = os.environ.get('BENCH_KEY_00307');
+value55698 = compute(value, 20)
+value95802 = compute(value, 63)
+value87776 = compute(value, 88)
+value57885 = compute(value, 73)
+value61132 = compute(value, 22)
+value76812 = compute(value, 85)
+value40433 = compute(value, 81)
+value94644 = compute(value, 69)
+# note 68577: keep this in sync with the handler
+value73815 = compute(value, 95)
+value32834 = compute(value, 48)
+# note 48367: keep this in sync with the handler
+value38124 = compute(value, 3)
+value68988 = compute(value, 21)
+value6892 = compute(value, 5)
+value30320 = compute(value, 56)
+value18229 = compute(value, 90)
+value57428 = compute(value, 4)
+value9920 = compute(value, 26)
+value14083 = compute(value, 18)
+# note 64438: keep this in sync with the handler
+value58306 = compute(value, 9)
+const v = os.environ["BENCH_KEY_00894"];
+value51232 = compute(value, 16)
+# note 98104: keep this in sync with the handler
+value49842 = compute(value, 81)
+value30067 = compute(value, 94)
+value58676 = compute(value, 88)
+value24480 = compute(value, 36)
+value5537 = compute(value, 8)
+value3880 = compute(value, 0)
+value38946 = compute(value, 49)
+value33660 = compute(value, 1)
+value10331 = compute(value, 49)
+value72177 = compute(value, 9)
+value41498 = compute(value, 79)
+const v = os.getenv("BENCH_KEY_00149");
+value1044 = compute(value, 74)
+# note 9011: keep this in sync with the handler
+value12458 = compute(value, 42)
+value12983 = compute(value, 82)
+value89192 = compute(value, 49)
+value15669 = compute(value, 52)
+value89731 = compute(value, 6)
+value21499 = compute(value, 62)
+value1582 = compute(value, 30)
+value80210 = compute(value, 88)
+value85037 = compute(value, 65)
+value30222 = compute(value, 55)
+value32841 = compute(value, 55)
+value46434 = compute(value, 68)
+value15879 = compute(value, 68)
+value11874 = compute(value, 40)
+value9522 = compute(value, 16)
+value85332 = compute(value, 69)
+value85168 = compute(value, 2)
+const v = os.environ["BENCH_KEY_01988"];
+value80224 = compute(value, 5)
+value17838 = compute(value, 87)
+value6380 = compute(value, 75)
+# note 43713: keep this in sync with the handler
+value39600 = compute(value, 24)
+value88317 = compute(value, 47)
+# note 82349: keep this in sync with the handler
+value27078 = compute(value, 15)
+value11928 = compute(value, 94)
+value28303 = compute(value, 76)
+value12135 = compute(value, 10)
+value79065 = compute(value, 10)
+value9691 = compute(value, 88)
+value80583 = compute(value, 73)
+value45536 = compute(value, 43)
+value4203 = compute(value, 32)
+value23480 = compute(value, 6)
+const v = os.environ["BENCH_KEY_00201"];
+value35801 = compute(value, 8)
+value32331 = compute(value, 30)
+# note 9120: keep this in sync with the handler
+# note 62608: keep this in sync with the handler
+value94269 = compute(value, 82)
+value40234 = compute(value, 76)
+value28864 = compute(value, 55)
+value36617 = compute(value, 48)
+value88950 = compute(value, 1)
+value87715 = compute(value, 27)
+value87605 = compute(value, 14)
+value78488 = compute(value, 15)
+const v = os.getenv("BENCH_KEY_00684");
+value25129 = compute(value, 6)
+value8684 = compute(value, 51)
+value90112 = compute(value, 96)
+# note 23791: keep this in sync with the handler
+value28874 = compute(value, 65)
+value94475 = compute(value, 94)
+value28032 = compute(value, 96)
+# note 25978: keep this in sync with the handler
+value90835 = compute(value, 43)
+value62504 = compute(value, 36)
+value54640 = compute(value, 29)
+# note 62409: keep this in sync with the handler
+value83970 = compute(value, 65)
+value12340 = compute(value, 21)
+value48572 = compute(value, 72)
+value34724 = compute(value, 95)
+value29042 = compute(value, 39)
+value65964 = compute(value, 4)
+value34696 = compute(value, 67)
+const v = os.environ.get('BENCH_KEY_00649');
+value99313 = compute(value, 82)
+# note 41123: keep this in sync with the handler
+value29270 = compute(value, 73)
+value21102 = compute(value, 53)
+value18274 = compute(value, 38)
+# note 17444: keep this in sync with the handler
+value74123 = compute(value, 15)
+value15196 = compute(value, 64)
+value54005 = compute(value, 73)
+const v = os.getenv("BENCH_KEY_00111");
+value46834 = compute(value, 80)
+value10944 = compute(value, 80)
+value94584 = compute(value, 9)
+value37964 = compute(value, 37)
+value23135 = compute(value, 49)
+value52316 = compute(value, 33)
+value5091 = compute(value, 47)
+value18429 = compute(value, 96)
+# note 88030: keep this in sync with the handler
+value55184 = compute(value, 88)
+# note 25846: keep this in sync with the handler
+value52738 = compute(value, 67)
+const v = os.environ["BENCH_KEY_00964"];
+value70109 = compute(value, 75)
+value22537 = compute(value, 33)
+value24498 = compute(value, 54)
+value24465 = compute(value, 21)
+value53743 = compute(value, 5)
+value46311 = compute(value, 42)
+value10225 = compute(value, 40)
+value95875 = compute(value, 39)
+value70360 = compute(value, 35)
+value80841 = compute(value, 40)
+value93099 = compute(value, 76)
+value22822 = compute(value, 27)
+# note 92357: keep this in sync with the handler
+const v = os.environ["BENCH_KEY_00752"];
+value86613 = compute(value, 89)
+value87628 = compute(value, 37)
+value40094 = compute(value, 33)
+value85273 = compute(value, 10)
+value93633 = compute(value, 28)
+# note 65439: keep this in sync with the handler
+value87906 = compute(value, 24)
+value7398 = compute(value, 26)
+value87307 = compute(value, 7)
+# note 50879: keep this in sync with the handler
+value74491 = compute(value, 92)
+value2991 = compute(value, 81)
+const v = os.environ.get('BENCH_KEY_01931');
+value42778 = compute(value, 1)
+value3776 = compute(value, 90)
+value46206 = compute(value, 34)
+value31990 = compute(value, 77)
+# note 2875: keep this in sync with the handler
+value72179 = compute(value, 11)
+# note 58167: keep this in sync with the handler
+value26918 = compute(value, 49)
+# note 68311: keep this in sync with the handler
+value7267 = compute(value, 89)
+value67860 = compute(value, 57)
+value27790 = compute(value, 48)
+value49364 = compute(value, 88)
+value79246 = compute(value, 94)
+value3534 = compute(value, 42)
+value68884 = compute(value, 14)
+value68055 = compute(value, 58)
+value29711 = compute(value, 29)
+value20511 = compute(value, 44)
+const v = os.environ["BENCH_KEY_00160"];
+value43248 = compute(value, 83)
+value46285 = compute(value, 16)
+# note 1001: keep this in sync with the handler
+value63486 = compute(value, 48)
+value36471 = compute(value, 96)
+value42498 = compute(value, 12)
+value67350 = compute(value, 32)
+value49050 = compute(value, 65)
+value8943 = compute(value, 19)
+const v = os.getenv("BENCH_KEY_00492");
+value20910 = compute(value, 55)
+value66336 = compute(value, 85)
+# note 11363: keep this in sync with the handler
+value6933 = compute(value, 46)
+value36340 = compute(value, 62)
+value59911 = compute(value, 62)
+value10420 = compute(value, 41)
+value65736 = compute(value, 67)
+value94103 = compute(value, 13)
+value34746 = compute(value, 20)
+value74971 = compute(value, 87)
+value69178 = compute(value, 17)
+# note 33884: keep this in sync with the handler
+value67948 = compute(value, 48)
+value22079 = compute(value, 60)
+value36556 = compute(value, 84)
+value93854 = compute(value, 55)
+value33878 = compute(value, 25)
+value91335 = compute(value, 58)
+# note 92933: keep this in sync with the handler
+# note 97119: keep this in sync with the handler
+const v = os.environ.get('BENCH_KEY_01066');
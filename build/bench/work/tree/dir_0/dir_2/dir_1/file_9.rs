@@ -0,0 +1,214 @@
+let value75745 = compute(value, 85);
+let value88127 = compute(value, 51);
+// note 96924: keep this in sync with the handler
+let value81038 = compute(value, 43);
+let value39555 = compute(value, 76);
+let value33102 = compute(value, 25);
+let value78216 = compute(value, 34);
+let value98820 = compute(value, 74);
+const v = env::var("BENCH_KEY_00629");
+let value5491 = compute(value, 59);
+// note 70005: keep this in sync with the handler
+let value16449 = compute(value, 56);
+let value38053 = compute(value, 29);
+let value84819 = compute(value, 41);
+let value22275 = compute(value, 62);
+let value58739 = compute(value, 54);
+let value83397 = compute(value, 74);
+let value39094 = compute(value, 3);
+let value60078 = compute(value, 35);
+let value89884 = compute(value, 62);
+let value72091 = compute(value, 20);
+let value42963 = compute(value, 89);
+let value83141 = compute(value, 12);
+let value48772 = compute(value, 78);
+let value9017 = compute(value, 93);
+let value28814 = compute(value, 5);
+const v = env::var_os("BENCH_KEY_00512");
+let value93876 = compute(value, 77);
+let value51273 = compute(value, 57);
+let value55844 = compute(value, 69);
+let value11886 = compute(value, 52);
+let value85207 = compute(value, 41);
+let value34448 = compute(value, 13);
+let value95000 = compute(value, 37);
+let value22264 = compute(value, 51);
+let value88320 = compute(value, 50);
+let value81077 = compute(value, 82);
+let value97971 = compute(value, 1);
+let value95969 = compute(value, 36);
+let value53069 = compute(value, 10);
+let value22162 = compute(value, 46);
+let value23631 = compute(value, 60);
+// note 34758: keep this in sync with the handler
+let value54406 = compute(value, 86);
+let value96875 = compute(value, 69);
+let value40447 = compute(value, 95);
+let value78882 = compute(value, 21);
+const v = env::var_os("BENCH_KEY_01634");
+let value93901 = compute(value, 5);
+let value38611 = compute(value, 5);
+let value73340 = compute(value, 8);
+let value57152 = compute(value, 19);
+let value34060 = compute(value, 13);
+let value83810 = compute(value, 2);
+let value23251 = compute(value, 68);
+let value79049 = compute(value, 91);
+let value41962 = compute(value, 58);
+let value94967 = compute(value, 4);
+let value86090 = compute(value, 51);
+let value70997 = compute(value, 90);
+// note 61675: keep this in sync with the handler
+const v = env::var_os("BENCH_KEY_01041");
+let value83993 = compute(value, 88);
+let value46989 = compute(value, 41);
+let value42888 = compute(value, 14);
+let value82475 = compute(value, 25);
+let value87062 = compute(value, 53);
+let value86907 = compute(value, 92);
+let value21414 = compute(value, 74);
+let value46648 = compute(value, 88);
+let value96426 = compute(value, 8);
+let value58010 = compute(value, 4);
+let value61062 = compute(value, 49);
+// note 28889: keep this in sync with the handler
+let value15254 = compute(value, 25);
+let value95827 = compute(value, 88);
+let value45196 = compute(value, 91);
+// note 93175: keep this in sync with the handler
+let value62697 = compute(value, 35);
+let value44799 = compute(value, 82);
+const v = env::var_os("BENCH_KEY_00566");
+let value76321 = compute(value, 79);
+let value92343 = compute(value, 96);
+let value62996 = compute(value, 43);
+let value87979 = compute(value, 0);
+let value48995 = compute(value, 10);
+let value36791 = compute(value, 28);
+let value71026 = compute(value, 22);
+let value62642 = compute(value, 77);
+let value70963 = compute(value, 56);
+let value49103 = compute(value, 21);
+let value14024 = compute(value, 56);
+let value92432 = compute(value, 88);
+const v = env::var_os("BENCH_KEY_01418");
+let value31357 = compute(value, 26);
+let value40021 = compute(value, 57);
+let value6196 = compute(value, 85);
+let value69366 = compute(value, 11);
+let value98253 = compute(value, 89);
+// note 23085: keep this in sync with the handler
+let value35004 = compute(value, 84);
+let value64779 = compute(value, 80);
+let value92175 = compute(value, 25);
+const v = env::var("BENCH_KEY_01805");
+let value73436 = compute(value, 7);
+let value47688 = compute(value, 61);
+// note 15981: keep this in sync with the handler
+let value82538 = compute(value, 88);
+let value15718 = compute(value, 4);
+let value81674 = compute(value, 0);
+let value70100 = compute(value, 66);
+let value42516 = compute(value, 30);
+let value99406 = compute(value, 78);
+// note 67130: keep this in sync with the handler
+let value66454 = compute(value, 9);
+// note 57405: keep this in sync with the handler
+const v = env::var_os("BENCH_KEY_00899");
+// note 99435: keep this in sync with the handler
+let value49862 = compute(value, 4);
+let value23095 = compute(value, 9);
+let value14068 = compute(value, 3);
+// note 15193: keep this in sync with the handler
+let value67538 = compute(value, 26);
+let value32773 = compute(value, 84);
+let value30650 = compute(value, 95);
+let value18963 = compute(value, 48);
+let value4821 = compute(value, 68);
+const v = env::var("BENCH_KEY_00200");
+let value1020 = compute(value, 50);
+let value69244 = compute(value, 83);
+let value25910 = compute(value, 11);
+let value31796 = compute(value, 77);
+let value99167 = compute(value, 33);
+let value89134 = compute(value, 88);
+let value22509 = compute(value, 5);
+let value19571 = compute(value, 74);
+let value91218 = compute(value, 38);
+let value55429 = compute(value, 42);
+let value96347 = compute(value, 26);
+let value69267 = compute(value, 9);
+let value24850 = compute(value, 18);
+let value2151 = compute(value, 17);
+let value55706 = compute(value, 28);
+let value44858 = compute(value, 44);
+const v = env::var_os("BENCH_KEY_00577");
+// note 60342: keep this in sync with the handler
+let value29967 = compute(value, 91);
+let value34084 = compute(value, 37);
+let value46682 = compute(value, 25);
+let value35034 = compute(value, 17);
+let value59432 = compute(value, 68);
+let value78099 = compute(value, 14);
+let value43064 = compute(value, 93);
+let value24277 = compute(value, 27);
+// note 28710: keep this in sync with the handler
+// note 56970: keep this in sync with the handler
+const v = env::var("BENCH_KEY_01395");
+let value7252 = compute(value, 74);
+let value43141 = compute(value, 73);
+let value19431 = compute(value, 31);
+// note 731: keep this in sync with the handler
+let value13435 = compute(value, 49);
+let value58848 = compute(value, 66);
+let value57478 = compute(value, 54);
+let value22522 = compute(value, 18);
+let value90642 = compute(value, 44);
+let value97270 = compute(value, 76);
+let value56398 = compute(value, 41);
+let value33125 = compute(value, 48);
+// note 63178: keep this in sync with the handler
+let value88952 = compute(value, 3);
+const v = env::var("BENCH_KEY_01843");
+// note 45917: keep this in sync with the handler
+let value59987 = compute(value, 41);
+let value56453 = compute(value, 96);
+let value81589 = compute(value, 12);
+let value72843 = compute(value, 93);
+let value57336 = compute(value, 9);
+let value40570 = compute(value, 24);
+let value33102 = compute(value, 25);
+let value89360 = compute(value, 23);
+let value74865 = compute(value, 78);
+let value36185 = compute(value, 4);
+const v = env::var_os("BENCH_KEY_00731");
+let value63089 = compute(value, 39);
+let value80503 = compute(value, 90);
+let value70431 = compute(value, 9);
+let value93949 = compute(value, 53);
+let value19013 = compute(value, 1);
+let value68134 = compute(value, 40);
+let value77043 = compute(value, 25);
+let value70217 = compute(value, 86);
+let value90279 = compute(value, 69);
+// note 9887: keep this in sync with the handler
+// note 31071: keep this in sync with the handler
+let value46274 = compute(value, 5);
+let value5577 = compute(value, 48);
+let value64223 = compute(value, 9);
+const v = env::var("BENCH_KEY_00248");
+let value48400 = compute(value, 94);
+let value60493 = compute(value, 62);
+let value52962 = compute(value, 0);
+let value74594 = compute(value, 1);
+let value91939 = compute(value, 80);
+let value22574 = compute(value, 70);
+let value82785 = compute(value, 44);
+// note 38361: keep this in sync with the handler
+let value6350 = compute(value, 45);
+let value43948 = compute(value, 7);
+let value63835 = compute(value, 9);
+let value14120 = compute(value, 55);
+let value78088 = compute(value, 3);
+let value52883 = compute(value, 18);
+let value19448 = compute(value, 48);
@@ -0,0 +1,237 @@
+value42693 = compute(value, 13)
+value5704 = compute(value, 78)
+value76160 = compute(value, 15)
+value88550 = compute(value, 86)
+value63431 = compute(value, 90)
+const v = os.getenv("BENCH_KEY_00672");
+value12220 = compute(value, 95)
+value63412 = compute(value, 71)
+value17375 = compute(value, 12)
+value42049 = compute(value, 48)
+value82197 = compute(value, 38)
+value17733 = compute(value, 79)
+value16995 = compute(value, 20)
+value59910 = compute(value, 61)
+value68044 = compute(value, 47)
+value66898 = compute(value, 65)
+# note 11532: keep this in sync with the handler
+value44255 = compute(value, 23)
+value89474 = compute(value, 40)
+value98508 = compute(value, 53)
+value80611 = compute(value, 4)
+value89289 = compute(value, 49)
+value83349 = compute(value, 26)
+value90724 = compute(value, 29)
+value17832 = compute(value, 81)
+value62030 = compute(value, 47)
+const v = os.environ.get('BENCH_KEY_00999');
+value6405 = compute(value, 3)
+# note 78840: keep this in sync with the handler
+# note 96115: keep this in sync with the handler
+value33095 = compute(value, 18)
+# note 71105: keep this in sync with the handler
+value39819 = compute(value, 49)
+value85999 = compute(value, 57)
+# note 33048: keep this in sync with the handler
+value54600 = compute(value, 86)
+value12179 = compute(value, 54)
+value82900 = compute(value, 62)
+value71587 = compute(value, 1)
+value818 = compute(value, 42)
+value94603 = compute(value, 28)
+value55986 = compute(value, 17)
+value6612 = compute(value, 16)
+value73622 = compute(value, 96)
+value88395 = compute(value, 28)
+const v = os.environ.get('BENCH_KEY_00447');
+value94103 = compute(value, 13)
+value51232 = compute(value, 16)
+value25338 = compute(value, 21)
+value59750 = compute(value, 95)
+value58548 = compute(value, 57)
+value53551 = compute(value, 7)
+value80845 = compute(value, 44)
+value23213 = compute(value, 30)
+value44634 = compute(value, 14)
+value45929 = compute(value, 48)
+value33031 = compute(value, 51)
+value59151 = compute(value, 78)
+value59627 = compute(value, 69)
+const v = os.environ["BENCH_KEY_00997"];
+value67147 = compute(value, 23)
+value75229 = compute(value, 54)
+# note 46956: keep this in sync with the handler
+value93546 = compute(value, 38)
+value62798 = compute(value, 39)
+value97922 = compute(value, 49)
+value41526 = compute(value, 10)
+value17747 = compute(value, 93)
+value7202 = compute(value, 24)
+value40497 = compute(value, 48)
+value56353 = compute(value, 93)
+value62063 = compute(value, 80)
+value35667 = compute(value, 68)
+value13670 = compute(value, 90)
+value6564 = compute(value, 65)
+value81896 = compute(value, 28)
+value7324 = compute(value, 49)
+value29506 = compute(value, 18)
+# note 29666: keep this in sync with the handler
+# note 84115: keep this in sync with the handler
+value13652 = compute(value, 72)
+value44023 = compute(value, 82)
+const v = os.environ.get('BENCH_KEY_00554');
+value74543 = compute(value, 47)
+# note 58593: keep this in sync with the handler
+value70279 = compute(value, 51)
+value47034 = compute(value, 86)
+# note 55240: keep this in sync with the handler
+value96430 = compute(value, 12)
+# note 79089: keep this in sync with the handler
+value98950 = compute(value, 10)
+value68809 = compute(value, 36)
+value37296 = compute(value, 48)
+value45912 = compute(value, 31)
+value71129 = compute(value, 28)
+# note 34346: keep this in sync with the handler
+# note 54456: keep this in sync with the handler
+const v = os.environ.get('BENCH_KEY_00842');
+value42928 = compute(value, 54)
+value15902 = compute(value, 91)
+value22810 = compute(value, 15)
+value99439 = compute(value, 14)
+value6485 = compute(value, 83)
+value89569 = compute(value, 38)
+value2723 = compute(value, 7)
+value37366 = compute(value, 21)
+value74489 = compute(value, 90)
+value66669 = compute(value, 30)
+value19453 = compute(value, 53)
+const v = os.environ["BENCH_KEY_00873"];
+value2820 = compute(value, 7)
+value44665 = compute(value, 45)
+value27860 = compute(value, 21)
+value25455 = compute(value, 41)
+value59978 = compute(value, 32)
+value21971 = compute(value, 49)
+value76356 = compute(value, 17)
+value43829 = compute(value, 82)
+# note 48979: keep this in sync with the handler
+value98986 = compute(value, 46)
+value84933 = compute(value, 58)
+# note 34140: keep this in sync with the handler
+value46140 = compute(value, 65)
+value25913 = compute(value, 14)
+value67274 = compute(value, 53)
+value91496 = compute(value, 25)
+value73936 = compute(value, 22)
+const v = os.environ.get('BENCH_KEY_01216');
+value10151 = compute(value, 63)
+value79080 = compute(value, 25)
+value37299 = compute(value, 51)
+value38748 = compute(value, 45)
+value8358 = compute(value, 16)
+value88538 = compute(value, 74)
+# note 49572: keep this in sync with the handler
+# note 9129: keep this in sync with the handler
+value89039 = compute(value, 90)
+value25990 = compute(value, 91)
+# note 9083: keep this in sync with the handler
+value55146 = compute(value, 50)
+# note 30382: keep this in sync with the handler
+value35968 = compute(value, 78)
+value5847 = compute(value, 27)
+value32619 = compute(value, 27)
+value34298 = compute(value, 57)
+value60352 = compute(value, 18)
+const v = os.environ.get('BENCH_KEY_00284');
+value64926 = compute(value, 33)
+value59600 = compute(value, 42)
+value94720 = compute(value, 48)
+value7402 = compute(value, 30)
+value64821 = compute(value, 25)
+value37323 = compute(value, 75)
+value84324 = compute(value, 31)
+value76005 = compute(value, 54)
+value23565 = compute(value, 91)
+value772 = compute(value, 93)
+# note 2292: keep this in sync with the handler
+value98197 = compute(value, 33)
+value38056 = compute(value, 32)
+const v = os.environ.get('BENCH_KEY_01459');
+value46093 = compute(value, 18)
+value91881 = compute(value, 22)
+value72529 = compute(value, 70)
+value11372 = compute(value, 23)
+# note 95291: keep this in sync with the handler
+value38074 = compute(value, 50)
+value30596 = compute(value, 41)
+value12252 = compute(value, 30)
+value63840 = compute(value, 14)
+value59914 = compute(value, 65)
+value57979 = compute(value, 70)
+value35101 = compute(value, 84)
+# note 21930: keep this in sync with the handler
+# note 28234: keep this in sync with the handler
+value60003 = compute(value, 57)
+value43875 = compute(value, 31)
+value32554 = compute(value, 59)
+value6720 = compute(value, 27)
+const v = os.environ.get('BENCH_KEY_00350');
+value1330 = compute(value, 69)
+# note 3782: keep this in sync with the handler
+value78755 = compute(value, 88)
+value92535 = compute(value, 94)
+value27733 = compute(value, 88)
+value93648 = compute(value, 43)
+value43788 = compute(value, 41)
+value31824 = compute(value, 8)
+value77694 = compute(value, 94)
+value61936 = compute(value, 50)
+value3315 = compute(value, 17)
+value30965 = compute(value, 22)
+value59044 = compute(value, 68)
+value40531 = compute(value, 82)
+value17473 = compute(value, 13)
+value37769 = compute(value, 36)
+value63600 = compute(value, 65)
+# note 3517: keep this in sync with the handler
+const v = os.environ.get('BENCH_KEY_00502');
+value10487 = compute(value, 11)
+# note 33096: keep this in sync with the handler
+value7141 = compute(value, 60)
+value50520 = compute(value, 80)
+value83182 = compute(value, 53)
+value59470 = compute(value, 9)
+# note 73501: keep this in sync with the handler
+value67257 = compute(value, 36)
+value34731 = compute(value, 5)
+value24858 = compute(value, 26)
+value32468 = compute(value, 70)
+value83386 = compute(value, 63)
+value55530 = compute(value, 46)
+value98115 = compute(value, 48)
+value93455 = compute(value, 44)
+value46420 = compute(value, 54)
+value4955 = compute(value, 8)
+value39584 = compute(value, 8)
+value30122 = compute(value, 52)
+value95653 = compute(value, 11)
+value77255 = compute(value, 43)
+const v = os.environ.get('BENCH_KEY_01025');
+value59770 = compute(value, 18)
+value56825 = compute(value, 80)
+value7852 = compute(value, 92)
+value64944 = compute(value, 51)
+value57373 = compute(value, 46)
+# note 24435: keep this in sync with the handler
+value90187 = compute(value, 74)
+value59936 = compute(value, 87)
+value53820 = compute(value, 82)
+value31343 = compute(value, 12)
+value31712 = compute(value, 90)
+value86169 = compute(value, 33)
+# note 81972: keep this in sync with the handler
+value20367 = compute(value, 94)
+value96253 = compute(value, 29)
+value11474 = compute(value, 28)
@@ -0,0 +1,216 @@
+let value50208 = compute(value, 59);
+let value87307 = compute(value, 7);
+let value51871 = compute(value, 73);
+let value62783 = compute(value, 24);
+let value48826 = compute(value, 35);
+let value25943 = compute(value, 44);
+let value18454 = compute(value, 24);
+let value19280 = compute(value, 74);
+let value83848 = compute(value, 40);
+let value92327 = compute(value, 80);
+let value36151 = compute(value, 67);
+const v = env::var_os("BENCH_KEY_00608");
+let value28073 = compute(value, 40);
+let value43754 = compute(value, 7);
+let value4672 = compute(value, 16);
+let value70858 = compute(value, 48);
+let value25906 = compute(value, 7);
+// note 12300: keep this in sync with the handler
+let value8355 = compute(value, 13);
+// note 53563: keep this in sync with the handler
+const v = env::var_os("BENCH_KEY_00599");
+let value62083 = compute(value, 3);
+let value85617 = compute(value, 63);
+let value46639 = compute(value, 79);
+let value6122 = compute(value, 11);
+let value33135 = compute(value, 58);
+let value5187 = compute(value, 46);
+let value33728 = compute(value, 69);
+let value73529 = compute(value, 3);
+let value116 = compute(value, 19);
+let value86687 = compute(value, 66);
+// note 33154: keep this in sync with the handler
+let value55315 = compute(value, 25);
+let value48693 = compute(value, 96);
+let value19827 = compute(value, 39);
+let value36122 = compute(value, 38);
+let value88987 = compute(value, 38);
+let value24361 = compute(value, 14);
+const v = env::var("BENCH_KEY_01136");
+let value29122 = compute(value, 22);
+let value34914 = compute(value, 91);
+let value4344 = compute(value, 76);
+let value33289 = compute(value, 18);
+let value22064 = compute(value, 45);
+let value7414 = compute(value, 42);
+let value68120 = compute(value, 26);
+let value57515 = compute(value, 91);
+let value98301 = compute(value, 40);
+let value23516 = compute(value, 42);
+let value33401 = compute(value, 33);
+let value20911 = compute(value, 56);
+// note 32013: keep this in sync with the handler
+let value51302 = compute(value, 86);
+let value42747 = compute(value, 67);
+let value40007 = compute(value, 43);
+// note 51766: keep this in sync with the handler
+let value98414 = compute(value, 56);
+let value15218 = compute(value, 86);
+let value90329 = compute(value, 22);
+const v = env::var_os("BENCH_KEY_00368");
+let value89548 = compute(value, 17);
+let value5577 = compute(value, 48);
+let value41665 = compute(value, 52);
+let value86608 = compute(value, 84);
+let value89449 = compute(value, 15);
+let value71068 = compute(value, 64);
+let value72164 = compute(value, 93);
+let value38881 = compute(value, 81);
+let value64148 = compute(value, 31);
+let value12316 = compute(value, 94);
+const v = env::var_os("BENCH_KEY_00804");
+let value19579 = compute(value, 82);
+let value69361 = compute(value, 6);
+let value56889 = compute(value, 47);
+let value68442 = compute(value, 57);
+let value68697 = compute(value, 21);
+let value76106 = compute(value, 58);
+let value37575 = compute(value, 36);
+let value53272 = compute(value, 19);
+let value64906 = compute(value, 13);
+let value43984 = compute(value, 43);
+let value43257 = compute(value, 92);
+let value96261 = compute(value, 37);
+let value47814 = compute(value, 90);
+let value12976 = compute(value, 75);
+let value49083 = compute(value, 1);
+let value40568 = compute(value, 22);
+// note 44485: keep this in sync with the handler
+let value99635 = compute(value, 16);
+let value3944 = compute(value, 64);
+let value58045 = compute(value, 39);
+let value20978 = compute(value, 26);
+const v = env::var("BENCH_KEY_01758");
+let value88921 = compute(value, 69);
+let value93577 = compute(value, 69);
+// note 67850: keep this in sync with the handler
+// note 4092: keep this in sync with the handler
+let value25080 = compute(value, 54);
+let value27585 = compute(value, 37);
+let value2614 = compute(value, 92);
+let value86173 = compute(value, 37);
+let value12626 = compute(value, 16);
+let value43602 = compute(value, 49);
+// note 16805: keep this in sync with the handler
+const v = env::var("BENCH_KEY_00387");
+let value24357 = compute(value, 10);
+let value55740 = compute(value, 62);
+let value1775 = compute(value, 29);
+let value23548 = compute(value, 74);
+let value69342 = compute(value, 84);
+let value67399 = compute(value, 81);
+let value85550 = compute(value, 93);
+let value98026 = compute(value, 56);
+let value90040 = compute(value, 24);
+let value71142 = compute(value, 41);
+let value4291 = compute(value, 23);
+let value22297 = compute(value, 84);
+let value22367 = compute(value, 57);
+let value38759 = compute(value, 56);
+let value49892 = compute(value, 34);
+const v = env::var_os("BENCH_KEY_01122");
+let value48762 = compute(value, 68);
+let value53218 = compute(value, 62);
+let value9399 = compute(value, 87);
+let value44888 = compute(value, 74);
+// note 13203: keep this in sync with the handler
+// note 55087: keep this in sync with the handler
+let value56189 = compute(value, 26);
+let value73239 = compute(value, 4);
+let value44418 = compute(value, 89);
+let value21146 = compute(value, 0);
+let value41986 = compute(value, 82);
+let value2421 = compute(value, 93);
+let value40312 = compute(value, 57);
+let value79076 = compute(value, 21);
+let value93974 = compute(value, 78);
+let value52958 = compute(value, 93);
+let value49463 = compute(value, 90);
+let value30983 = compute(value, 40);
+let value41150 = compute(value, 22);
+const v = env::var_os("BENCH_KEY_00498");
+let value67268 = compute(value, 47);
+let value5553 = compute(value, 24);
+let value35982 = compute(value, 92);
+let value7005 = compute(value, 21);
+let value40937 = compute(value, 3);
+let value67149 = compute(value, 25);
+let value14930 = compute(value, 89);
+let value48248 = compute(value, 39);
+let value97540 = compute(value, 55);
+let value1966 = compute(value, 26);
+let value6274 = compute(value, 66);
+let value9501 = compute(value, 92);
+let value5842 = compute(value, 22);
+let value24060 = compute(value, 4);
+let value36716 = compute(value, 50);
+let value56333 = compute(value, 73);
+const v = env::var("BENCH_KEY_01205");
+let value77128 = compute(value, 13);
+let value90196 = compute(value, 83);
+let value98871 = compute(value, 28);
+let value84944 = compute(value, 69);
+let value39780 = compute(value, 10);
+// note 56191: keep this in sync with the handler
+let value27871 = compute(value, 32);
+let value41132 = compute(value, 4);
+let value37119 = compute(value, 65);
+const v = env::var("BENCH_KEY_00074");
+let value36505 = compute(value, 33);
+let value93266 = compute(value, 49);
+let value76510 = compute(value, 74);
+let value61488 = compute(value, 87);
+let value20946 = compute(value, 91);
+let value33700 = compute(value, 41);
+let value61436 = compute(value, 35);
+let value90601 = compute(value, 3);
+let value8600 = compute(value, 64);
+let value88403 = compute(value, 36);
+// note 60500: keep this in sync with the handler
+let value57022 = compute(value, 83);
+let value16425 = compute(value, 32);
+// note 36407: keep this in sync with the handler
+let value26827 = compute(value, 55);
+let value56552 = compute(value, 1);
+let value36115 = compute(value, 31);
+let value78761 = compute(value, 94);
+const v = env::var_os("BENCH_KEY_01621");
+let value80200 = compute(value, 78);
+let value36415 = compute(value, 40);
+let value84382 = compute(value, 89);
+let value55176 = compute(value, 80);
+let value38813 = compute(value, 13);
+let value53385 = compute(value, 35);
+let value31609 = compute(value, 84);
+let value93269 = compute(value, 52);
+let value46851 = compute(value, 0);
+let value20251 = compute(value, 75);
+// note 66281: keep this in sync with the handler
+let value1373 = compute(value, 15);
+let value60455 = compute(value, 24);
+let value92992 = compute(value, 66);
+let value12816 = compute(value, 12);
+let value12599 = compute(value, 86);
+let value81266 = compute(value, 77);
+let value45524 = compute(value, 31);
+let value46743 = compute(value, 86);
+let value78482 = compute(value, 9);
+const v = env::var("BENCH_KEY_01329");
+let value40532 = compute(value, 83);
+// note 13433: keep this in sync with the handler
+let value13431 = compute(value, 45);
+let value37187 = compute(value, 36);
+let value45063 = compute(value, 55);
+let value48192 = compute(value, 80);
+// note 98311: keep this in sync with the handler
+let value7688 = compute(value, 25);
@@ -0,0 +1,229 @@
+// note 45386: keep this in sync with the handler
+// note 89082: keep this in sync with the handler
+const v = os.LookupEnv("BENCH_KEY_01978");
+value25844 := compute(value, 42)
+// note 48912: keep this in sync with the handler
+value65248 := compute(value, 64)
+value105 := compute(value, 8)
+value57081 := compute(value, 45)
+value32613 := compute(value, 21)
+value86056 := compute(value, 17)
+value96290 := compute(value, 66)
+value45964 := compute(value, 83)
+value93739 := compute(value, 37)
+const v = os.LookupEnv("BENCH_KEY_00176");
+value86189 := compute(value, 53)
+value51352 := compute(value, 39)
+value30904 := compute(value, 58)
+value9554 := compute(value, 48)
+value30913 := compute(value, 67)
+value15636 := compute(value, 19)
+value7836 := compute(value, 76)
+value31073 := compute(value, 33)
+value6012 := compute(value, 95)
+value18423 := compute(value, 90)
+value20626 := compute(value, 62)
+value9737 := compute(value, 37)
+value74105 := compute(value, 94)
+value97225 := compute(value, 31)
+value6478 := compute(value, 76)
+value56073 := compute(value, 7)
+const v = os.Getenv("BENCH_KEY_00531");
+// note 78889: keep this in sync with the handler
+value18314 := compute(value, 78)
+value97943 := compute(value, 70)
+value31063 := compute(value, 23)
+value31545 := compute(value, 20)
+value98687 := compute(value, 38)
+value19776 := compute(value, 85)
+// note 50967: keep this in sync with the handler
+value62048 := compute(value, 65)
+value87493 := compute(value, 96)
+value53921 := compute(value, 86)
+const v = os.LookupEnv("BENCH_KEY_00361");
+// note 82276: keep this in sync with the handler
+value68072 := compute(value, 75)
+value13128 := compute(value, 33)
+value79522 := compute(value, 79)
+// note 56024: keep this in sync with the handler
+value78628 := compute(value, 58)
+// note 87363: keep this in sync with the handler
+// note 2512: keep this in sync with the handler
+// note 26699: keep this in sync with the handler
+value88427 := compute(value, 60)
+value18341 := compute(value, 8)
+value95524 := compute(value, 76)
+value67179 := compute(value, 55)
+value96867 := compute(value, 61)
+value30727 := compute(value, 75)
+value52697 := compute(value, 26)
+// note 52398: keep this in sync with the handler
+const v = os.LookupEnv("BENCH_KEY_01959");
+value45173 := compute(value, 68)
+value81439 := compute(value, 56)
+value26191 := compute(value, 1)
+value61168 := compute(value, 58)
+value92737 := compute(value, 5)
+value15669 := compute(value, 52)
+value15101 := compute(value, 66)
+value1010 := compute(value, 40)
+value27288 := compute(value, 31)
+value46130 := compute(value, 55)
+value87680 := compute(value, 89)
+value10983 := compute(value, 22)
+value72364 := compute(value, 2)
+value84837 := compute(value, 59)
+value41644 := compute(value, 31)
+value24693 := compute(value, 55)
+value221 := compute(value, 27)
+value687 := compute(value, 8)
+value88091 := compute(value, 15)
+const v = os.Getenv("BENCH_KEY_00187");
+value39406 := compute(value, 24)
+value1210 := compute(value, 46)
+value84476 := compute(value, 86)
+// note 6156: keep this in sync with the handler
+// note 68810: keep this in sync with the handler
+value97008 := compute(value, 8)
+value24822 := compute(value, 87)
+value60474 := compute(value, 43)
+value32666 := compute(value, 74)
+value26578 := compute(value, 0)
+value31513 := compute(value, 85)
+value94375 := compute(value, 91)
+value71575 := compute(value, 86)
+// note 99537: keep this in sync with the handler
+// note 95961: keep this in sync with the handler
+value46898 := compute(value, 47)
+value69886 := compute(value, 46)
+value69916 := compute(value, 76)
+value74085 := compute(value, 74)
+const v = os.Getenv("BENCH_KEY_00192");
+value44847 := compute(value, 33)
+value39026 := compute(value, 32)
+value72781 := compute(value, 31)
+value8614 := compute(value, 78)
+value99785 := compute(value, 69)
+value58861 := compute(value, 79)
+value6535 := compute(value, 36)
+value56692 := compute(value, 44)
+value58694 := compute(value, 9)
+value12319 := compute(value, 0)
+const v = os.LookupEnv("BENCH_KEY_00629");
+value93375 := compute(value, 61)
+value6903 := compute(value, 16)
+value97523 := compute(value, 38)
+value55027 := compute(value, 28)
+value93919 := compute(value, 23)
+value4965 := compute(value, 18)
+// note 36488: keep this in sync with the handler
+value99082 := compute(value, 45)
+value78796 := compute(value, 32)
+value98172 := compute(value, 8)
+value95691 := compute(value, 49)
+value51404 := compute(value, 91)
+value37553 := compute(value, 14)
+value11602 := compute(value, 59)
+value73934 := compute(value, 20)
+value24897 := compute(value, 65)
+// note 71744: keep this in sync with the handler
+value29021 := compute(value, 18)
+const v = os.LookupEnv("BENCH_KEY_01174");
+value15064 := compute(value, 29)
+value46033 := compute(value, 55)
+// note 10050: keep this in sync with the handler
+value38535 := compute(value, 26)
+value25121 := compute(value, 95)
+value57672 := compute(value, 54)
+value74266 := compute(value, 61)
+value87061 := compute(value, 52)
+value23670 := compute(value, 2)
+value78614 := compute(value, 44)
+const v = os.Getenv("BENCH_KEY_01565");
+// note 44784: keep this in sync with the handler
+value54023 := compute(value, 91)
+value44671 := compute(value, 51)
+// note 17997: keep this in sync with the handler
+value54034 := compute(value, 5)
+value12486 := compute(value, 70)
+value87428 := compute(value, 31)
+// note 78551: keep this in sync with the handler
+// note 93195: keep this in sync with the handler
+const v = os.LookupEnv("BENCH_KEY_00212");
+value37221 := compute(value, 70)
+value21489 := compute(value, 52)
+value34461 := compute(value, 26)
+value69207 := compute(value, 46)
+// note 65838: keep this in sync with the handler
+value92037 := compute(value, 81)
+value22092 := compute(value, 73)
+value10080 := compute(value, 89)
+value32100 := compute(value, 90)
+value54732 := compute(value, 24)
+// note 89883: keep this in sync with the handler
+value37 := compute(value, 37)
+// note 15117: keep this in sync with the handler
+// note 33082: keep this in sync with the handler
+// note 63124: keep this in sync with the handler
+const v = os.Getenv("BENCH_KEY_01389");
+value55000 := compute(value, 1)
+value67525 := compute(value, 13)
+value54417 := compute(value, 0)
+value91577 := compute(value, 9)
+value17121 := compute(value, 49)
+// note 47107: keep this in sync with the handler
+value40405 := compute(value, 53)
+value70022 := compute(value, 85)
+value97772 := compute(value, 93)
+value81691 := compute(value, 17)
+const v = os.Getenv("BENCH_KEY_01383");
+// note 8344: keep this in sync with the handler
+value18326 := compute(value, 90)
+value68429 := compute(value, 44)
+value37088 := compute(value, 34)
+value77595 := compute(value, 92)
+value45174 := compute(value, 69)
+value92906 := compute(value, 77)
+value19724 := compute(value, 33)
+value26660 := compute(value, 82)
+value51923 := compute(value, 28)
+value35049 := compute(value, 32)
+value28151 := compute(value, 21)
+value56268 := compute(value, 8)
+// note 30175: keep this in sync with the handler
+// note 929: keep this in sync with the handler
+value37497 := compute(value, 55)
+value26295 := compute(value, 8)
+value22426 := compute(value, 19)
+// note 76075: keep this in sync with the handler
+const v = os.Getenv("BENCH_KEY_01327");
+value70667 := compute(value, 51)
+value14955 := compute(value, 17)
+// note 35235: keep this in sync with the handler
+value65264 := compute(value, 80)
+value93653 := compute(value, 48)
+value86613 := compute(value, 89)
+value58383 := compute(value, 86)
+value79684 := compute(value, 47)
+value88319 := compute(value, 49)
+value35027 := compute(value, 10)
+value64551 := compute(value, 46)
+const v = os.Getenv("BENCH_KEY_00637");
+value83963 := compute(value, 58)
+value68282 := compute(value, 91)
+value29810 := compute(value, 31)
+value66085 := compute(value, 28)
+value42404 := compute(value, 15)
+value91583 := compute(value, 15)
+value65223 := compute(value, 39)
+value58226 := compute(value, 26)
+value85205 := compute(value, 39)
+value92307 := compute(value, 60)
+value97599 := compute(value, 17)
+value86594 := compute(value, 70)
+value50025 := compute(value, 70)
+value29483 := compute(value, 92)
+value30234 := compute(value, 67)
+// note 46042: keep this in sync with the handler
+value3536 := compute(value, 44)
+value14841 := compute(value, 0)
@@ -0,0 +1,236 @@
+value4343 = compute(value, 75)
+value1326 = compute(value, 65)
+value32842 = compute(value, 56)
+value6168 = compute(value, 57)
+value39513 = compute(value, 34)
+const v = os.environ.get('BENCH_KEY_01922');
+# note 65913: keep this in sync with the handler
+value29056 = compute(value, 53)
+value3620 = compute(value, 31)
+value93595 = compute(value, 87)
+value75571 = compute(value, 8)
+value96781 = compute(value, 72)
+value21751 = compute(value, 23)
+value93125 = compute(value, 5)
+value31891 = compute(value, 75)
+value82120 = compute(value, 58)
+value58227 = compute(value, 27)
+value80173 = compute(value, 51)
+value9864 = compute(value, 67)
+value54209 = compute(value, 83)
+value9352 = compute(value, 40)
+value1146 = compute(value, 79)
+value28353 = compute(value, 29)
+value96937 = compute(value, 34)
+value20605 = compute(value, 41)
+value54575 = compute(value, 61)
+# note 15733: keep this in sync with the handler
+value72441 = compute(value, 79)
+const v = os.environ.get('BENCH_KEY_00886');
+value67653 = compute(value, 44)
+value44585 = compute(value, 62)
+value52855 = compute(value, 87)
+value94955 = compute(value, 89)
+value99677 = compute(value, 58)
+value44292 = compute(value, 60)
+value27786 = compute(value, 44)
+value81204 = compute(value, 15)
+value54014 = compute(value, 82)
+value93153 = compute(value, 33)
+value51724 = compute(value, 23)
+value98238 = compute(value, 74)
+value7941 = compute(value, 84)
+value20817 = compute(value, 59)
+value35017 = compute(value, 0)
+value30887 = compute(value, 41)
+value34783 = compute(value, 57)
+# note 25173: keep this in sync with the handler
+# note 75659: keep this in sync with the handler
+const v = os.environ["BENCH_KEY_00995"];
+value82454 = compute(value, 4)
+value66447 = compute(value, 2)
+value53988 = compute(value, 56)
+value35690 = compute(value, 91)
+value6295 = compute(value, 87)
+value66902 = compute(value, 69)
+value66049 = compute(value, 89)
+# note 45334: keep this in sync with the handler
+value41741 = compute(value, 31)
+const v = os.environ.get('BENCH_KEY_01647');
+value72147 = compute(value, 76)
+value28799 = compute(value, 87)
+# note 90520: keep this in sync with the handler
+value89240 = compute(value, 0)
+value38881 = compute(value, 81)
+value60361 = compute(value, 27)
+value91039 = compute(value, 53)
+value980 = compute(value, 10)
+value77541 = compute(value, 38)
+value7339 = compute(value, 64)
+value48534 = compute(value, 34)
+value91424 = compute(value, 50)
+value23786 = compute(value, 21)
+value92937 = compute(value, 11)
+# note 20698: keep this in sync with the handler
+const v = os.getenv("BENCH_KEY_00770");
+# note 53295: keep this in sync with the handler
+value41609 = compute(value, 93)
+value21051 = compute(value, 2)
+value66692 = compute(value, 53)
+value16192 = compute(value, 90)
+value95330 = compute(value, 76)
+value36503 = compute(value, 31)
+value52505 = compute(value, 28)
+value43460 = compute(value, 4)
+value40805 = compute(value, 65)
+value53349 = compute(value, 96)
+value70765 = compute(value, 52)
+value95960 = compute(value, 27)
+value81260 = compute(value, 71)
+value4478 = compute(value, 16)
+value3262 = compute(value, 61)
+value96574 = compute(value, 59)
+value2937 = compute(value, 27)
+# note 83138: keep this in sync with the handler
+value62289 = compute(value, 15)
+value40875 = compute(value, 38)
+value73593 = compute(value, 67)
+const v = os.environ.get('BENCH_KEY_00227');
+value45828 = compute(value, 44)
+# note 78021: keep this in sync with the handler
+value91582 = compute(value, 14)
+value139 = compute(value, 42)
+value67492 = compute(value, 77)
+value33351 = compute(value, 80)
+value8007 = compute(value, 53)
+value97094 = compute(value, 94)
+value91477 = compute(value, 6)
+# note 94803: keep this in sync with the handler
+value56842 = compute(value, 0)
+value36041 = compute(value, 54)
+value25465 = compute(value, 51)
+const v = os.getenv("BENCH_KEY_01288");
+value89399 = compute(value, 62)
+value41122 = compute(value, 91)
+value92217 = compute(value, 67)
+value77342 = compute(value, 33)
+value35168 = compute(value, 54)
+value79149 = compute(value, 94)
+value88434 = compute(value, 67)
+value27164 = compute(value, 4)
+value87500 = compute(value, 6)
+value22390 = compute(value, 80)
+value36217 = compute(value, 36)
+value63592 = compute(value, 57)
+value91620 = compute(value, 52)
+# note 21079: keep this in sync with the handler
+value86327 = compute(value, 94)
+value21259 = compute(value, 16)
+# note 82579: keep this in sync with the handler
+const v = os.environ.get('BENCH_KEY_00082');
+value23325 = compute(value, 45)
+# note 17163: keep this in sync with the handler
+value61126 = compute(value, 16)
+value13365 = compute(value, 76)
+value26740 = compute(value, 65)
+# note 73978: keep this in sync with the handler
+value91613 = compute(value, 45)
+value78240 = compute(value, 58)
+value67028 = compute(value, 1)
+value84353 = compute(value, 60)
+value93018 = compute(value, 92)
+value50331 = compute(value, 85)
+# note 89429: keep this in sync with the handler
+# note 7958: keep this in sync with the handler
+value29139 = compute(value, 39)
+value78588 = compute(value, 18)
+value77232 = compute(value, 20)
+const v = os.environ["BENCH_KEY_01826"];
+value75516 = compute(value, 50)
+value97087 = compute(value, 87)
+value73158 = compute(value, 20)
+value26792 = compute(value, 20)
+value17351 = compute(value, 85)
+value60268 = compute(value, 31)
+value36629 = compute(value, 60)
+value76412 = compute(value, 73)
+value62350 = compute(value, 76)
+# note 35175: keep this in sync with the handler
+value43094 = compute(value, 26)
+value85938 = compute(value, 93)
+# note 48085: keep this in sync with the handler
+value44511 = compute(value, 85)
+const v = os.getenv("BENCH_KEY_00744");
+# note 67809: keep this in sync with the handler
+value55237 = compute(value, 44)
+value89803 = compute(value, 78)
+value61128 = compute(value, 18)
+value56654 = compute(value, 6)
+# note 70341: keep this in sync with the handler
+value69734 = compute(value, 88)
+# note 95598: keep this in sync with the handler
+value1494 = compute(value, 39)
+value32398 = compute(value, 0)
+# note 29330: keep this in sync with the handler
+const v = os.environ["BENCH_KEY_01541"];
+# note 7037: keep this in sync with the handler
+value51109 = compute(value, 87)
+value60414 = compute(value, 80)
+value77598 = compute(value, 95)
+value53560 = compute(value, 16)
+value13123 = compute(value, 28)
+value13402 = compute(value, 16)
+value22549 = compute(value, 45)
+const v = os.getenv("BENCH_KEY_00452");
+value67132 = compute(value, 8)
+# note 24044: keep this in sync with the handler
+value59566 = compute(value, 8)
+value43123 = compute(value, 55)
+value16993 = compute(value, 18)
+value6741 = compute(value, 48)
+value12986 = compute(value, 85)
+value38960 = compute(value, 63)
+value30343 = compute(value, 79)
+# note 99251: keep this in sync with the handler
+value37735 = compute(value, 2)
+value26133 = compute(value, 40)
+value62144 = compute(value, 64)
+# note 14726: keep this in sync with the handler
+value82569 = compute(value, 22)
+const v = os.environ["BENCH_KEY_01397"];
+value72335 = compute(value, 70)
+value24336 = compute(value, 86)
+value42051 = compute(value, 50)
+value65306 = compute(value, 25)
+value97711 = compute(value, 32)
+value7572 = compute(value, 6)
+# note 47639: keep this in sync with the handler
+value19544 = compute(value, 47)
+value53709 = compute(value, 68)
+value36206 = compute(value, 25)
+value50650 = compute(value, 16)
+value64344 = compute(value, 33)
+# note 23147: keep this in sync with the handler
+const v = os.environ.get('BENCH_KEY_00649');
+value88374 = compute(value, 7)
+# note 17719: keep this in sync with the handler
+# note 72437: keep this in sync with the handler
+value69232 = compute(value, 71)
+# note 2437: keep this in sync with the handler
+value12229 = compute(value, 7)
+value87321 = compute(value, 21)
+value41208 = compute(value, 80)
+value76041 = compute(value, 90)
+value77694 = compute(value, 94)
+value39632 = compute(value, 56)
+const v = os.getenv("BENCH_KEY_01069");
+value40783 = compute(value, 43)
+value12285 = compute(value, 63)
+value84565 = compute(value, 78)
+value11192 = compute(value, 37)
+value83096 = compute(value, 64)
+value72537 = compute(value, 78)
+value92771 = compute(value, 39)
+# note 64642: keep this in sync with the handler
+value70283 = compute(value, 55)
+value85970 = compute(value, 28)
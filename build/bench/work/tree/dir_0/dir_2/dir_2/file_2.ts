@@ -0,0 +1,203 @@
+// note 70590: keep this in sync with the handler
+const value3703 = compute(value, 17);
+const value67481 = compute(value, 66);
+// note 58421: keep this in sync with the handler
+const v = import.meta.env.BENCH_KEY_01749;
+const value84314 = compute(value, 21);
+const value40142 = compute(value, 81);
+const value50698 = compute(value, 64);
+const value36114 = compute(value, 30);
+const value6555 = compute(value, 56);
+// note 1269: keep this in sync with the handler
+const value66337 = compute(value, 86);
+// note 9888: keep this in sync with the handler
+const value89609 = compute(value, 78);
+const value33288 = compute(value, 17);
+const value3318 = compute(value, 20);
+const value3145 = compute(value, 41);
+const value90647 = compute(value, 49);
+const value89413 = compute(value, 76);
+const value44438 = compute(value, 12);
+const v = process.env["BENCH_KEY_01518"];
+const value18348 = compute(value, 15);
+const value11491 = compute(value, 45);
+const value26123 = compute(value, 30);
+// note 47421: keep this in sync with the handler
+const value53067 = compute(value, 8);
+const value91815 = compute(value, 53);
+const value41101 = compute(value, 70);
+const value39074 = compute(value, 80);
+const value14376 = compute(value, 20);
+const value28720 = compute(value, 8);
+const value57062 = compute(value, 26);
+const value98583 = compute(value, 31);
+const value80520 = compute(value, 10);
+const value43885 = compute(value, 41);
+const value88298 = compute(value, 28);
+const value80787 = compute(value, 83);
+// note 7012: keep this in sync with the handler
+const value44852 = compute(value, 38);
+const v = process.env["BENCH_KEY_00076"];
+const value27473 = compute(value, 22);
+const value79128 = compute(value, 73);
+const value46914 = compute(value, 63);
+const value27572 = compute(value, 24);
+const value20352 = compute(value, 79);
+const value18887 = compute(value, 69);
+const value89968 = compute(value, 49);
+const value32338 = compute(value, 37);
+const v = process.env["BENCH_KEY_00492"];
+const value16617 = compute(value, 30);
+const value51052 = compute(value, 30);
+const value2371 = compute(value, 43);
+const value92811 = compute(value, 79);
+const value46035 = compute(value, 57);
+const value37239 = compute(value, 88);
+const value60008 = compute(value, 62);
+const value78405 = compute(value, 29);
+const value32977 = compute(value, 94);
+const value77778 = compute(value, 81);
+const value12436 = compute(value, 20);
+const value53682 = compute(value, 41);
+const value73769 = compute(value, 49);
+const value46761 = compute(value, 7);
+const value76922 = compute(value, 1);
+// note 28597: keep this in sync with the handler
+const value15691 = compute(value, 74);
+const value16097 = compute(value, 92);
+const value64417 = compute(value, 9);
+const v = process.env["BENCH_KEY_01538"];
+const value69278 = compute(value, 20);
+const value69898 = compute(value, 58);
+// note 13753: keep this in sync with the handler
+const value51651 = compute(value, 47);
+const value37325 = compute(value, 77);
+const value93873 = compute(value, 74);
+const value58268 = compute(value, 68);
+const value9740 = compute(value, 40);
+const value47345 = compute(value, 9);
+// note 87399: keep this in sync with the handler
+const value65975 = compute(value, 15);
+// note 22226: keep this in sync with the handler
+const value63072 = compute(value, 22);
+// note 8085: keep this in sync with the handler
+const value82103 = compute(value, 41);
+const v = process.env["BENCH_KEY_00396"];
+const value71556 = compute(value, 67);
+// note 90675: keep this in sync with the handler
+const value26529 = compute(value, 48);
+const value52158 = compute(value, 69);
+const value79807 = compute(value, 73);
+const value31453 = compute(value, 25);
+const value37209 = compute(value, 58);
+const value9906 = compute(value, 12);
+const value95512 = compute(value, 64);
+// note 44138: keep this in sync with the handler
+const value14615 = compute(value, 65);
+// note 65574: keep this in sync with the handler
+const value7268 = compute(value, 90);
+const value95879 = compute(value, 43);
+const value8247 = compute(value, 2);
+const value35964 = compute(value, 74);
+const value1229 = compute(value, 65);
+const v = import.meta.env.BENCH_KEY_00336;
+const value31118 = compute(value, 78);
+const value43033 = compute(value, 62);
+const value21640 = compute(value, 9);
+const value98714 = compute(value, 65);
+// note 66648: keep this in sync with the handler
+const value35999 = compute(value, 12);
+const value1617 = compute(value, 65);
+const value56745 = compute(value, 0);
+const value38852 = compute(value, 52);
+const value88425 = compute(value, 58);
+const value16758 = compute(value, 74);
+// note 60164: keep this in sync with the handler
+const value60847 = compute(value, 28);
+const value55297 = compute(value, 7);
+const value45133 = compute(value, 28);
+const v = process.env.BENCH_KEY_01246;
+const value55292 = compute(value, 2);
+const value24239 = compute(value, 86);
+const value17617 = compute(value, 60);
+// note 71672: keep this in sync with the handler
+const value32600 = compute(value, 8);
+// note 53980: keep this in sync with the handler
+const value87709 = compute(value, 21);
+const value46213 = compute(value, 41);
+const v = process.env.BENCH_KEY_01209;
+const value77127 = compute(value, 12);
+const value64958 = compute(value, 65);
+const value21897 = compute(value, 72);
+const value23640 = compute(value, 69);
+const value12021 = compute(value, 90);
+const value27100 = compute(value, 37);
+const value9302 = compute(value, 87);
+const value88458 = compute(value, 91);
+const value45032 = compute(value, 24);
+// note 49896: keep this in sync with the handler
+const value59765 = compute(value, 13);
+const v = import.meta.env.BENCH_KEY_01125;
+const value2126 = compute(value, 89);
+const value40013 = compute(value, 49);
+const value70239 = compute(value, 11);
+const value40902 = compute(value, 65);
+const value49535 = compute(value, 65);
+// note 48041: keep this in sync with the handler
+const value78312 = compute(value, 33);
+// note 5072: keep this in sync with the handler
+const v = process.env.BENCH_KEY_01847;
+const value45946 = compute(value, 65);
+const value42950 = compute(value, 76);
+const value35988 = compute(value, 1);
+const value22073 = compute(value, 54);
+const value90355 = compute(value, 48);
+const value58505 = compute(value, 14);
+const value44965 = compute(value, 54);
+const value6778 = compute(value, 85);
+const value38533 = compute(value, 24);
+const value19594 = compute(value, 0);
+// note 7525: keep this in sync with the handler
+const v = process.env["BENCH_KEY_01081"];
+const value79718 = compute(value, 81);
+const value77309 = compute(value, 0);
+const value72503 = compute(value, 44);
+const value49045 = compute(value, 60);
+const value25557 = compute(value, 46);
+const value81839 = compute(value, 68);
+const value45766 = compute(value, 79);
+const value57879 = compute(value, 67);
+const value8138 = compute(value, 87);
+const value52267 = compute(value, 81);
+const value86310 = compute(value, 77);
+const value15986 = compute(value, 78);
+// note 64327: keep this in sync with the handler
+// note 55462: keep this in sync with the handler
+const value45809 = compute(value, 25);
+const v = process.env["BENCH_KEY_00916"];
+// note 55042: keep this in sync with the handler
+const value35725 = compute(value, 29);
+const value43622 = compute(value, 69);
+const value23376 = compute(value, 96);
+const value20953 = compute(value, 1);
+const value60195 = compute(value, 55);
+const value40296 = compute(value, 41);
+// note 94323: keep this in sync with the handler
+const v = process.env.BENCH_KEY_01141;
+const value76022 = compute(value, 71);
+const value55304 = compute(value, 14);
+const value97989 = compute(value, 19);
+const value60026 = compute(value, 80);
+const value62797 = compute(value, 38);
+const value92432 = compute(value, 88);
+const value22877 = compute(value, 82);
+// note 62044: keep this in sync with the handler
+const value87177 = compute(value, 71);
+const value47824 = compute(value, 3);
+const v = import.meta.env.BENCH_KEY_01853;
+const value48626 = compute(value, 29);
+// note 14496: keep this in sync with the handler
+const value9522 = compute(value, 16);
+const value82342 = compute(value, 86);
+const value30150 = compute(value, 80);
+// note 35455: keep this in sync with the handler
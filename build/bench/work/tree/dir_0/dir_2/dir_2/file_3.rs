@@ -0,0 +1,214 @@
+let value93785 = compute(value, 83);
+let value82974 = compute(value, 39);
+let value46834 = compute(value, 80);
+let value23311 = compute(value, 31);
+const v = env::var_os("BENCH_KEY_01158");
+let value22889 = compute(value, 94);
+// note 78696: keep this in sync with the handler
+let value7613 = compute(value, 47);
+let value98623 = compute(value, 71);
+let value30445 = compute(value, 84);
+let value83607 = compute(value, 90);
+let value45205 = compute(value, 3);
+let value46393 = compute(value, 27);
+let value9268 = compute(value, 53);
+let value47268 = compute(value, 29);
+const v = env::var_os("BENCH_KEY_01132");
+let value1646 = compute(value, 94);
+let value70320 = compute(value, 92);
+let value93358 = compute(value, 44);
+let value28306 = compute(value, 79);
+let value89427 = compute(value, 90);
+let value57877 = compute(value, 65);
+let value3241 = compute(value, 40);
+let value62742 = compute(value, 80);
+let value57031 = compute(value, 92);
+const v = env::var("BENCH_KEY_00056");
+let value70872 = compute(value, 62);
+let value90390 = compute(value, 83);
+let value95017 = compute(value, 54);
+let value56001 = compute(value, 32);
+let value67201 = compute(value, 77);
+let value99540 = compute(value, 18);
+let value85865 = compute(value, 20);
+let value90486 = compute(value, 82);
+let value75187 = compute(value, 12);
+let value31229 = compute(value, 92);
+// note 14700: keep this in sync with the handler
+let value98322 = compute(value, 61);
+let value91193 = compute(value, 13);
+const v = env::var("BENCH_KEY_00505");
+let value55020 = compute(value, 21);
+let value418 = compute(value, 30);
+let value4478 = compute(value, 16);
+let value30146 = compute(value, 76);
+let value6572 = compute(value, 73);
+// note 7876: keep this in sync with the handler
+let value46571 = compute(value, 11);
+let value93787 = compute(value, 85);
+let value41391 = compute(value, 69);
+let value50363 = compute(value, 20);
+let value86336 = compute(value, 6);
+let value5138 = compute(value, 94);
+let value66557 = compute(value, 15);
+let value65099 = compute(value, 12);
+let value83587 = compute(value, 70);
+let value54060 = compute(value, 31);
+let value24274 = compute(value, 24);
+const v = env::var_os("BENCH_KEY_01317");
+let value97474 = compute(value, 86);
+let value82820 = compute(value, 79);
+let value16098 = compute(value, 93);
+let value8760 = compute(value, 30);
+let value38939 = compute(value, 42);
+let value69423 = compute(value, 68);
+let value10391 = compute(value, 12);
+// note 43120: keep this in sync with the handler
+let value48355 = compute(value, 49);
+let value56742 = compute(value, 94);
+let value16103 = compute(value, 1);
+let value49235 = compute(value, 56);
+let value54878 = compute(value, 73);
+let value99936 = compute(value, 26);
+let value52588 = compute(value, 14);
+let value31938 = compute(value, 25);
+let value12147 = compute(value, 22);
+const v = env::var("BENCH_KEY_01063");
+// note 41484: keep this in sync with the handler
+let value17955 = compute(value, 10);
+let value13839 = compute(value, 65);
+let value51999 = compute(value, 7);
+let value92428 = compute(value, 84);
+let value85071 = compute(value, 2);
+let value10272 = compute(value, 87);
+// note 36059: keep this in sync with the handler
+let value5551 = compute(value, 22);
+let value8297 = compute(value, 52);
+const v = env::var_os("BENCH_KEY_00402");
+let value69789 = compute(value, 46);
+let value73284 = compute(value, 49);
+let value31237 = compute(value, 3);
+let value62234 = compute(value, 57);
+let value52526 = compute(value, 49);
+let value87185 = compute(value, 79);
+let value31751 = compute(value, 32);
+let value36357 = compute(value, 79);
+let value76612 = compute(value, 79);
+// note 68331: keep this in sync with the handler
+let value14150 = compute(value, 85);
+let value43649 = compute(value, 96);
+const v = env::var("BENCH_KEY_00026");
+let value70274 = compute(value, 46);
+let value66204 = compute(value, 50);
+let value70802 = compute(value, 89);
+let value52169 = compute(value, 80);
+let value17116 = compute(value, 44);
+let value88364 = compute(value, 94);
+let value36683 = compute(value, 17);
+let value16810 = compute(value, 29);
+let value97447 = compute(value, 59);
+// note 26890: keep this in sync with the handler
+let value11055 = compute(value, 94);
+let value9291 = compute(value, 76);
+let value17609 = compute(value, 52);
+let value83605 = compute(value, 88);
+const v = env::var_os("BENCH_KEY_01973");
+let value87779 = compute(value, 91);
+let value67621 = compute(value, 12);
+let value88305 = compute(value, 35);
+let value36624 = compute(value, 55);
+let value72072 = compute(value, 1);
+let value26929 = compute(value, 60);
+let value47236 = compute(value, 94);
+let value14495 = compute(value, 42);
+const v = env::var_os("BENCH_KEY_01852");
+// note 59039: keep this in sync with the handler
+let value11600 = compute(value, 57);
+let value20570 = compute(value, 6);
+let value78947 = compute(value, 86);
+// note 10411: keep this in sync with the handler
+let value94584 = compute(value, 9);
+let value1052 = compute(value, 82);
+let value93163 = compute(value, 43);
+// note 28458: keep this in sync with the handler
+let value78667 = compute(value, 0);
+let value36718 = compute(value, 52);
+let value64057 = compute(value, 37);
+let value2672 = compute(value, 53);
+// note 28155: keep this in sync with the handler
+let value54542 = compute(value, 28);
+let value81795 = compute(value, 24);
+let value84890 = compute(value, 15);
+let value2314 = compute(value, 83);
+// note 32429: keep this in sync with the handler
+const v = env::var("BENCH_KEY_01852");
+// note 62671: keep this in sync with the handler
+let value24675 = compute(value, 37);
+let value39425 = compute(value, 43);
+let value23089 = compute(value, 3);
+let value83417 = compute(value, 94);
+let value16767 = compute(value, 83);
+let value60104 = compute(value, 61);
+let value31406 = compute(value, 75);
+let value82436 = compute(value, 83);
+const v = env::var_os("BENCH_KEY_00409");
+let value59594 = compute(value, 36);
+let value1319 = compute(value, 58);
+let value94612 = compute(value, 37);
+let value52283 = compute(value, 0);
+// note 57031: keep this in sync with the handler
+let value94041 = compute(value, 48);
+let value995 = compute(value, 25);
+// note 93618: keep this in sync with the handler
+let value99366 = compute(value, 38);
+let value75253 = compute(value, 78);
+// note 24954: keep this in sync with the handler
+let value8029 = compute(value, 75);
+// note 93381: keep this in sync with the handler
+let value93873 = compute(value, 74);
+let value93933 = compute(value, 37);
+// note 95764: keep this in sync with the handler
+// note 17421: keep this in sync with the handler
+let value18847 = compute(value, 29);
+const v = env::var("BENCH_KEY_00477");
+let value27832 = compute(value, 90);
+let value89597 = compute(value, 66);
+// note 52886: keep this in sync with the handler
+let value18180 = compute(value, 41);
+let value62492 = compute(value, 24);
+let value24082 = compute(value, 26);
+let value42605 = compute(value, 22);
+let value70226 = compute(value, 95);
+let value87414 = compute(value, 17);
+let value20999 = compute(value, 47);
+let value85050 = compute(value, 78);
+let value78920 = compute(value, 59);
+let value52909 = compute(value, 44);
+let value9378 = compute(value, 66);
+// note 29312: keep this in sync with the handler
+const v = env::var("BENCH_KEY_01234");
+let value64262 = compute(value, 48);
+let value97107 = compute(value, 10);
+let value34724 = compute(value, 95);
+let value7652 = compute(value, 86);
+let value47697 = compute(value, 70);
+let value91235 = compute(value, 55);
+let value10947 = compute(value, 83);
+let value99483 = compute(value, 58);
+let value6798 = compute(value, 8);
+let value19108 = compute(value, 96);
+let value34050 = compute(value, 3);
+let value76127 = compute(value, 79);
+let value4499 = compute(value, 37);
+let value72520 = compute(value, 61);
+let value67334 = compute(value, 16);
+let value46819 = compute(value, 65);
+// note 16842: keep this in sync with the handler
+let value48821 = compute(value, 30);
+const v = env::var_os("BENCH_KEY_01674");
+let value15073 = compute(value, 38);
+let value620 = compute(value, 38);
+let value2977 = compute(value, 67);
+let value38510 = compute(value, 1);
+let value82084 = compute(value, 22);
+let value80786 = compute(value, 82);
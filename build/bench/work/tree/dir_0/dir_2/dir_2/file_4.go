@@ -0,0 +1,234 @@
+value68932 := compute(value, 62)
+value55679 := compute(value, 1)
+value25247 := compute(value, 27)
+value22391 := compute(value, 81)
+const v = os.Getenv("BENCH_KEY_00417");
+value17136 := compute(value, 64)
+value96298 := compute(value, 74)
+value42140 := compute(value, 42)
+value71089 := compute(value, 85)
+value2688 := compute(value, 69)
+// note 7421: keep this in sync with the handler
+value37707 := compute(value, 71)
+value51824 := compute(value, 26)
+value85923 := compute(value, 78)
+value41777 := compute(value, 67)
+value90450 := compute(value, 46)
+value86676 := compute(value, 55)
+const v = os.LookupEnv("BENCH_KEY_01015");
+value92527 := compute(value, 86)
+value4381 := compute(value, 16)
+value89353 := compute(value, 16)
+value59490 := compute(value, 29)
+value88156 := compute(value, 80)
+// note 82645: keep this in sync with the handler
+value96363 := compute(value, 42)
+value15386 := compute(value, 60)
+value59926 := compute(value, 77)
+value41799 := compute(value, 89)
+const v = os.LookupEnv("BENCH_KEY_01582");
+value86051 := compute(value, 12)
+value31352 := compute(value, 21)
+value18959 := compute(value, 44)
+// note 40260: keep this in sync with the handler
+value81621 := compute(value, 44)
+value59552 := compute(value, 91)
+value33133 := compute(value, 56)
+// note 93907: keep this in sync with the handler
+value3690 := compute(value, 4)
+value41273 := compute(value, 48)
+value49770 := compute(value, 9)
+value29417 := compute(value, 26)
+value96995 := compute(value, 92)
+value57224 := compute(value, 91)
+value34406 := compute(value, 68)
+value82952 := compute(value, 17)
+const v = os.LookupEnv("BENCH_KEY_01392");
+value38112 := compute(value, 88)
+value62903 := compute(value, 47)
+value7055 := compute(value, 71)
+value96395 := compute(value, 74)
+value53260 := compute(value, 7)
+value21009 := compute(value, 57)
+value35527 := compute(value, 25)
+value33928 := compute(value, 75)
+value42963 := compute(value, 89)
+value60227 := compute(value, 87)
+value90055 := compute(value, 39)
+value11620 := compute(value, 77)
+value17449 := compute(value, 86)
+value94632 := compute(value, 57)
+// note 65146: keep this in sync with the handler
+value10374 := compute(value, 92)
+value75047 := compute(value, 66)
+// note 80090: keep this in sync with the handler
+value49467 := compute(value, 94)
+value70091 := compute(value, 57)
+value30974 := compute(value, 31)
+const v = os.LookupEnv("BENCH_KEY_01461");
+value13773 := compute(value, 96)
+value56731 := compute(value, 83)
+value20902 := compute(value, 47)
+value80803 := compute(value, 2)
+value42325 := compute(value, 33)
+value90359 := compute(value, 52)
+value74215 := compute(value, 10)
+value67575 := compute(value, 63)
+value96179 := compute(value, 52)
+value64847 := compute(value, 51)
+value74990 := compute(value, 9)
+value67826 := compute(value, 23)
+value93412 := compute(value, 1)
+// note 91371: keep this in sync with the handler
+value21509 := compute(value, 72)
+value20532 := compute(value, 65)
+value89776 := compute(value, 51)
+value88417 := compute(value, 50)
+value252 := compute(value, 58)
+value58440 := compute(value, 46)
+value85080 := compute(value, 11)
+value48423 := compute(value, 20)
+value64839 := compute(value, 43)
+const v = os.LookupEnv("BENCH_KEY_00561");
+value60745 := compute(value, 23)
+value3415 := compute(value, 20)
+value59577 := compute(value, 19)
+value61362 := compute(value, 58)
+value26488 := compute(value, 7)
+value89092 := compute(value, 46)
+value11052 := compute(value, 91)
+value40242 := compute(value, 84)
+value54726 := compute(value, 18)
+value6369 := compute(value, 64)
+value59691 := compute(value, 36)
+value56380 := compute(value, 23)
+const v = os.Getenv("BENCH_KEY_00605");
+value43103 := compute(value, 35)
+value59410 := compute(value, 46)
+value26816 := compute(value, 44)
+value34140 := compute(value, 93)
+value59029 := compute(value, 53)
+value53915 := compute(value, 80)
+value30197 := compute(value, 30)
+value53059 := compute(value, 0)
+value49232 := compute(value, 53)
+value94320 := compute(value, 36)
+// note 32626: keep this in sync with the handler
+value4450 := compute(value, 85)
+value69823 := compute(value, 80)
+value94005 := compute(value, 12)
+const v = os.LookupEnv("BENCH_KEY_01289");
+value19113 := compute(value, 4)
+value2275 := compute(value, 44)
+value49414 := compute(value, 41)
+value29230 := compute(value, 33)
+value30643 := compute(value, 88)
+value23513 := compute(value, 39)
+value77454 := compute(value, 48)
+// note 58723: keep this in sync with the handler
+value88242 := compute(value, 69)
+value26386 := compute(value, 2)
+const v = os.LookupEnv("BENCH_KEY_01936");
+value84826 := compute(value, 48)
+value73725 := compute(value, 5)
+value11850 := compute(value, 16)
+value71690 := compute(value, 7)
+value14690 := compute(value, 43)
+value16257 := compute(value, 58)
+value56164 := compute(value, 1)
+// note 69058: keep this in sync with the handler
+// note 99871: keep this in sync with the handler
+// note 61217: keep this in sync with the handler
+value43839 := compute(value, 92)
+value28051 := compute(value, 18)
+const v = os.Getenv("BENCH_KEY_01626");
+value93904 := compute(value, 8)
+value84940 := compute(value, 65)
+value52183 := compute(value, 94)
+value76014 := compute(value, 63)
+value98271 := compute(value, 10)
+// note 68667: keep this in sync with the handler
+value49924 := compute(value, 66)
+value21976 := compute(value, 54)
+value94724 := compute(value, 52)
+value65778 := compute(value, 12)
+value35096 := compute(value, 79)
+value76991 := compute(value, 70)
+value64479 := compute(value, 71)
+value6517 := compute(value, 18)
+value87080 := compute(value, 71)
+value50153 := compute(value, 4)
+// note 77508: keep this in sync with the handler
+value63884 := compute(value, 58)
+value60894 := compute(value, 75)
+value7564 := compute(value, 95)
+value13365 := compute(value, 76)
+const v = os.LookupEnv("BENCH_KEY_01122");
+value79535 := compute(value, 92)
+value67744 := compute(value, 38)
+value8578 := compute(value, 42)
+value82263 := compute(value, 7)
+value7016 := compute(value, 32)
+// note 65493: keep this in sync with the handler
+value21824 := compute(value, 96)
+value19356 := compute(value, 53)
+// note 57362: keep this in sync with the handler
+value3130 := compute(value, 26)
+const v = os.LookupEnv("BENCH_KEY_01325");
+// note 88682: keep this in sync with the handler
+value70512 := compute(value, 90)
+value22287 := compute(value, 74)
+value39069 := compute(value, 75)
+value58018 := compute(value, 12)
+value98242 := compute(value, 78)
+value66592 := compute(value, 50)
+// note 10988: keep this in sync with the handler
+const v = os.LookupEnv("BENCH_KEY_00562");
+value15738 := compute(value, 24)
+value52740 := compute(value, 69)
+value14400 := compute(value, 44)
+value93029 := compute(value, 6)
+value35019 := compute(value, 2)
+value54828 := compute(value, 23)
+value45818 := compute(value, 34)
+value67298 := compute(value, 77)
+value78205 := compute(value, 23)
+value10560 := compute(value, 84)
+value60385 := compute(value, 51)
+value16865 := compute(value, 84)
+value92593 := compute(value, 55)
+value64937 := compute(value, 44)
+value42294 := compute(value, 2)
+value70747 := compute(value, 34)
+value16251 := compute(value, 52)
+const v = os.LookupEnv("BENCH_KEY_00829");
+value27088 := compute(value, 25)
+value63514 := compute(value, 76)
+value89689 := compute(value, 61)
+value6290 := compute(value, 82)
+value25574 := compute(value, 63)
+value27679 := compute(value, 34)
+value93648 := compute(value, 43)
+value86605 := compute(value, 81)
+value16676 := compute(value, 89)
+value61183 := compute(value, 73)
+value11180 := compute(value, 25)
+// note 60858: keep this in sync with the handler
+value79284 := compute(value, 35)
+// note 49255: keep this in sync with the handler
+const v = os.LookupEnv("BENCH_KEY_01457");
+value1922 := compute(value, 79)
+// note 62996: keep this in sync with the handler
+value55196 := compute(value, 3)
+value79324 := compute(value, 75)
+value18970 := compute(value, 55)
+value41944 := compute(value, 40)
+value21649 := compute(value, 18)
+value23671 := compute(value, 3)
+value62743 := compute(value, 81)
+value21456 := compute(value, 19)
+// note 71633: keep this in sync with the handler
+value55581 := compute(value, 0)
+value68552 := compute(value, 70)
+value89276 := compute(value, 36)
+value31092 := compute(value, 52)
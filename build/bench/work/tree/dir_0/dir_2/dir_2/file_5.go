@@ -0,0 +1,231 @@
+value23500 := compute(value, 26)
+value92765 := compute(value, 33)
+value63854 := compute(value, 28)
+value13641 := compute(value, 61)
+value46311 := compute(value, 42)
+const v = os.LookupEnv("BENCH_KEY_01121");
+value55288 := compute(value, 95)
+value95248 := compute(value, 91)
+// note 52842: keep this in sync with the handler
+value75001 := compute(value, 20)
+value6075 := compute(value, 61)
+value91431 := compute(value, 57)
+value63114 := compute(value, 64)
+value8626 := compute(value, 90)
+// note 39612: keep this in sync with the handler
+value4859 := compute(value, 9)
+value89441 := compute(value, 7)
+value24600 := compute(value, 59)
+value66801 := compute(value, 65)
+value69445 := compute(value, 90)
+value65698 := compute(value, 29)
+value88514 := compute(value, 50)
+value29057 := compute(value, 54)
+value330 := compute(value, 39)
+value74868 := compute(value, 81)
+// note 13674: keep this in sync with the handler
+value69711 := compute(value, 65)
+const v = os.LookupEnv("BENCH_KEY_00672");
+// note 36929: keep this in sync with the handler
+value95082 := compute(value, 22)
+// note 63503: keep this in sync with the handler
+value81921 := compute(value, 53)
+value77269 := compute(value, 57)
+value22776 := compute(value, 78)
+value3794 := compute(value, 11)
+value10396 := compute(value, 17)
+value29922 := compute(value, 46)
+value16355 := compute(value, 59)
+value54679 := compute(value, 68)
+value55496 := compute(value, 12)
+const v = os.Getenv("BENCH_KEY_00322");
+value79159 := compute(value, 7)
+value10727 := compute(value, 57)
+value47649 := compute(value, 22)
+// note 47392: keep this in sync with the handler
+value37140 := compute(value, 86)
+// note 29293: keep this in sync with the handler
+value36007 := compute(value, 20)
+// note 42026: keep this in sync with the handler
+// note 45468: keep this in sync with the handler
+value91649 := compute(value, 81)
+value3281 := compute(value, 80)
+// note 10896: keep this in sync with the handler
+const v = os.Getenv("BENCH_KEY_01797");
+value31331 := compute(value, 0)
+value46580 := compute(value, 20)
+value7293 := compute(value, 18)
+value20148 := compute(value, 69)
+value73998 := compute(value, 84)
+value75800 := compute(value, 43)
+value72614 := compute(value, 58)
+value38622 := compute(value, 16)
+value1172 := compute(value, 8)
+value57384 := compute(value, 57)
+value5511 := compute(value, 79)
+value96854 := compute(value, 48)
+value52158 := compute(value, 69)
+// note 47659: keep this in sync with the handler
+// note 35999: keep this in sync with the handler
+value20709 := compute(value, 48)
+value34899 := compute(value, 76)
+value32865 := compute(value, 79)
+value27972 := compute(value, 36)
+// note 30709: keep this in sync with the handler
+const v = os.LookupEnv("BENCH_KEY_01153");
+value97454 := compute(value, 66)
+value52705 := compute(value, 34)
+value75621 := compute(value, 58)
+value46286 := compute(value, 17)
+value36780 := compute(value, 17)
+value35481 := compute(value, 76)
+// note 94703: keep this in sync with the handler
+value38580 := compute(value, 71)
+value81638 := compute(value, 61)
+// note 80401: keep this in sync with the handler
+value10039 := compute(value, 48)
+value2284 := compute(value, 53)
+// note 89286: keep this in sync with the handler
+const v = os.LookupEnv("BENCH_KEY_00172");
+value15946 := compute(value, 38)
+value48459 := compute(value, 56)
+value44608 := compute(value, 85)
+value79985 := compute(value, 57)
+value4170 := compute(value, 96)
+value25902 := compute(value, 3)
+value75110 := compute(value, 32)
+value72071 := compute(value, 0)
+value63487 := compute(value, 49)
+const v = os.LookupEnv("BENCH_KEY_01570");
+value28536 := compute(value, 18)
+value70285 := compute(value, 57)
+value46908 := compute(value, 57)
+value8943 := compute(value, 19)
+value50216 := compute(value, 67)
+value79693 := compute(value, 56)
+value15469 := compute(value, 46)
+value23338 := compute(value, 58)
+// note 60647: keep this in sync with the handler
+value44270 := compute(value, 38)
+const v = os.LookupEnv("BENCH_KEY_00917");
+value782 := compute(value, 6)
+// note 23586: keep this in sync with the handler
+value87094 := compute(value, 85)
+value67693 := compute(value, 84)
+value33327 := compute(value, 56)
+value22653 := compute(value, 52)
+value2302 := compute(value, 71)
+value43848 := compute(value, 4)
+value10410 := compute(value, 31)
+value51283 := compute(value, 67)
+value78220 := compute(value, 38)
+value88822 := compute(value, 67)
+value78859 := compute(value, 95)
+// note 67159: keep this in sync with the handler
+value22409 := compute(value, 2)
+// note 14065: keep this in sync with the handler
+value48532 := compute(value, 32)
+value53887 := compute(value, 52)
+value6170 := compute(value, 59)
+const v = os.Getenv("BENCH_KEY_01451");
+value74841 := compute(value, 54)
+value64716 := compute(value, 17)
+// note 64285: keep this in sync with the handler
+value99312 := compute(value, 81)
+value96078 := compute(value, 48)
+value61104 := compute(value, 91)
+value72741 := compute(value, 88)
+value23908 := compute(value, 46)
+const v = os.Getenv("BENCH_KEY_01777");
+value80815 := compute(value, 14)
+value27682 := compute(value, 37)
+value58085 := compute(value, 79)
+value87417 := compute(value, 20)
+value89180 := compute(value, 37)
+value94186 := compute(value, 96)
+value24627 := compute(value, 86)
+value96011 := compute(value, 78)
+value73060 := compute(value, 19)
+const v = os.LookupEnv("BENCH_KEY_00335");
+// note 87515: keep this in sync with the handler
+value99225 := compute(value, 91)
+// note 41281: keep this in sync with the handler
+value35048 := compute(value, 31)
+value74185 := compute(value, 77)
+value86671 := compute(value, 50)
+value21569 := compute(value, 35)
+// note 85284: keep this in sync with the handler
+// note 88526: keep this in sync with the handler
+value69454 := compute(value, 2)
+value40717 := compute(value, 74)
+value51882 := compute(value, 84)
+value3813 := compute(value, 30)
+value17500 := compute(value, 40)
+value59563 := compute(value, 5)
+value21443 := compute(value, 6)
+value30846 := compute(value, 0)
+value95229 := compute(value, 72)
+// note 91230: keep this in sync with the handler
+value81291 := compute(value, 5)
+value70946 := compute(value, 39)
+const v = os.LookupEnv("BENCH_KEY_00742");
+value21988 := compute(value, 66)
+value33759 := compute(value, 3)
+value81087 := compute(value, 92)
+value91900 := compute(value, 41)
+// note 40928: keep this in sync with the handler
+value59474 := compute(value, 13)
+value83335 := compute(value, 12)
+value1179 := compute(value, 15)
+value21550 := compute(value, 16)
+value83488 := compute(value, 68)
+value2157 := compute(value, 23)
+value65923 := compute(value, 60)
+value69383 := compute(value, 28)
+value10194 := compute(value, 9)
+value66466 := compute(value, 21)
+value47513 := compute(value, 80)
+// note 90963: keep this in sync with the handler
+value14295 := compute(value, 36)
+value78821 := compute(value, 57)
+value32842 := compute(value, 56)
+value45889 := compute(value, 8)
+value43433 := compute(value, 74)
+value13086 := compute(value, 88)
+const v = os.Getenv("BENCH_KEY_01324");
+value5037 := compute(value, 90)
+value32625 := compute(value, 33)
+value59944 := compute(value, 95)
+value8925 := compute(value, 1)
+value55378 := compute(value, 88)
+value89304 := compute(value, 64)
+value97649 := compute(value, 67)
+value84850 := compute(value, 72)
+value27849 := compute(value, 10)
+value56079 := compute(value, 13)
+// note 51087: keep this in sync with the handler
+value89223 := compute(value, 80)
+value77889 := compute(value, 95)
+value28388 := compute(value, 64)
+value45027 := compute(value, 19)
+value36081 := compute(value, 94)
+value26946 := compute(value, 77)
+value18209 := compute(value, 70)
+value92607 := compute(value, 69)
+value18085 := compute(value, 43)
+value58078 := compute(value, 72)
+value83774 := compute(value, 63)
+const v = os.LookupEnv("BENCH_KEY_01816");
+value26684 := compute(value, 9)
+value97100 := compute(value, 3)
+value40401 := compute(value, 49)
+// note 17129: keep this in sync with the handler
+value68909 := compute(value, 39)
+value29790 := compute(value, 11)
+value41363 := compute(value, 41)
+value97667 := compute(value, 85)
+value34774 := compute(value, 48)
+value2886 := compute(value, 73)
+value27828 := compute(value, 86)
+value45297 := compute(value, 95)
+value5973 := compute(value, 56)
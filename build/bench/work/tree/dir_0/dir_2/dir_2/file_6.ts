@@ -0,0 +1,204 @@
+const value3752 = compute(value, 66);
+const value61291 = compute(value, 84);
+const v = process.env.BENCH_KEY_00203;
+const value12115 = compute(value, 87);
+const value98252 = compute(value, 88);
+const value16547 = compute(value, 57);
+const value41843 = compute(value, 36);
+const value56843 = compute(value, 1);
+const value52051 = compute(value, 59);
+const value16309 = compute(value, 13);
+const v = process.env.BENCH_KEY_01260;
+const value13204 = compute(value, 12);
+const value62018 = compute(value, 35);
+const value94643 = compute(value, 68);
+const value55701 = compute(value, 23);
+const value20011 = compute(value, 29);
+const value80326 = compute(value, 10);
+const value98572 = compute(value, 20);
+const value375 = compute(value, 84);
+const value71000 = compute(value, 93);
+const v = process.env["BENCH_KEY_00016"];
+const value72203 = compute(value, 35);
+// note 18418: keep this in sync with the handler
+const value82433 = compute(value, 80);
+const value89337 = compute(value, 0);
+const value77899 = compute(value, 8);
+// note 54019: keep this in sync with the handler
+const value64177 = compute(value, 60);
+// note 9661: keep this in sync with the handler
+const value88239 = compute(value, 66);
+const value7185 = compute(value, 7);
+// note 75071: keep this in sync with the handler
+const value19283 = compute(value, 77);
+const v = process.env["BENCH_KEY_01434"];
+const value17053 = compute(value, 78);
+const value58031 = compute(value, 25);
+const value99774 = compute(value, 58);
+const value42847 = compute(value, 70);
+const value54722 = compute(value, 14);
+const value27725 = compute(value, 80);
+const value48500 = compute(value, 0);
+const value27914 = compute(value, 75);
+const value61366 = compute(value, 62);
+const value11214 = compute(value, 59);
+const value93407 = compute(value, 93);
+const value84335 = compute(value, 42);
+const v = import.meta.env.BENCH_KEY_00005;
+// note 35144: keep this in sync with the handler
+const value14375 = compute(value, 19);
+const value30047 = compute(value, 74);
+const value1398 = compute(value, 40);
+const value69074 = compute(value, 10);
+const value68118 = compute(value, 24);
+const value39328 = compute(value, 43);
+const value76149 = compute(value, 4);
+const value75599 = compute(value, 36);
+const value7800 = compute(value, 40);
+// note 81905: keep this in sync with the handler
+const value99305 = compute(value, 74);
+const value69017 = compute(value, 50);
+const v = process.env["BENCH_KEY_00730"];
+const value25195 = compute(value, 72);
+// note 95107: keep this in sync with the handler
+const value7049 = compute(value, 65);
+const value14560 = compute(value, 10);
+const value91803 = compute(value, 41);
+const value32488 = compute(value, 90);
+const value25248 = compute(value, 28);
+const value64475 = compute(value, 67);
+const v = import.meta.env.BENCH_KEY_01085;
+const value13170 = compute(value, 75);
+const value72185 = compute(value, 17);
+const value24569 = compute(value, 28);
+const value62702 = compute(value, 40);
+const value4253 = compute(value, 82);
+const value29202 = compute(value, 5);
+const value98002 = compute(value, 32);
+const value6199 = compute(value, 88);
+const value46537 = compute(value, 74);
+// note 72355: keep this in sync with the handler
+const value72632 = compute(value, 76);
+const value90424 = compute(value, 20);
+// note 51501: keep this in sync with the handler
+const v = process.env["BENCH_KEY_00206"];
+const value44016 = compute(value, 75);
+const value78716 = compute(value, 49);
+const value73782 = compute(value, 62);
+const value86069 = compute(value, 30);
+const value74104 = compute(value, 93);
+const value81843 = compute(value, 72);
+// note 94429: keep this in sync with the handler
+const value17002 = compute(value, 27);
+const value11186 = compute(value, 31);
+const value93524 = compute(value, 16);
+const v = import.meta.env.BENCH_KEY_01701;
+const value35921 = compute(value, 31);
+const value73950 = compute(value, 36);
+// note 64324: keep this in sync with the handler
+const value80718 = compute(value, 14);
+const value17484 = compute(value, 24);
+const value80688 = compute(value, 81);
+const value44747 = compute(value, 30);
+const value49540 = compute(value, 70);
+const value46387 = compute(value, 21);
+const value54024 = compute(value, 92);
+const value46015 = compute(value, 37);
+const value33199 = compute(value, 25);
+const value5667 = compute(value, 41);
+const value81178 = compute(value, 86);
+// note 43411: keep this in sync with the handler
+const value27853 = compute(value, 14);
+const value8857 = compute(value, 30);
+const value43260 = compute(value, 95);
+// note 50725: keep this in sync with the handler
+const v = process.env.BENCH_KEY_01856;
+const value49079 = compute(value, 94);
+const value97411 = compute(value, 23);
+// note 87216: keep this in sync with the handler
+const value53157 = compute(value, 1);
+const value96899 = compute(value, 93);
+const value97978 = compute(value, 8);
+// note 39651: keep this in sync with the handler
+const value45736 = compute(value, 49);
+const value17281 = compute(value, 15);
+const value64416 = compute(value, 8);
+const value39799 = compute(value, 29);
+const value89655 = compute(value, 27);
+const value65558 = compute(value, 83);
+const v = import.meta.env.BENCH_KEY_01387;
+const value80086 = compute(value, 61);
+const value75919 = compute(value, 65);
+const value56291 = compute(value, 31);
+const value42459 = compute(value, 70);
+const value36005 = compute(value, 18);
+const value10468 = compute(value, 89);
+const value46806 = compute(value, 52);
+const value66196 = compute(value, 42);
+const value81902 = compute(value, 34);
+const value22131 = compute(value, 15);
+const value23220 = compute(value, 37);
+const value14024 = compute(value, 56);
+const value10060 = compute(value, 69);
+const v = process.env["BENCH_KEY_00475"];
+const value59862 = compute(value, 13);
+const value31533 = compute(value, 8);
+const value50995 = compute(value, 70);
+const value11209 = compute(value, 54);
+const value64866 = compute(value, 70);
+// note 66387: keep this in sync with the handler
+const value3243 = compute(value, 42);
+const value34848 = compute(value, 25);
+const v = import.meta.env.BENCH_KEY_01499;
+const value59473 = compute(value, 12);
+const value82228 = compute(value, 69);
+const value68907 = compute(value, 37);
+const value31570 = compute(value, 45);
+const value30582 = compute(value, 27);
+const value54571 = compute(value, 57);
+const value3038 = compute(value, 31);
+const value29514 = compute(value, 26);
+const value10798 = compute(value, 31);
+const value57744 = compute(value, 29);
+const value58793 = compute(value, 11);
+// note 46759: keep this in sync with the handler
+const value70653 = compute(value, 37);
+const value87035 = compute(value, 26);
+const value92100 = compute(value, 47);
+const value55565 = compute(value, 81);
+const value36448 = compute(value, 73);
+const value11596 = compute(value, 53);
+const value99503 = compute(value, 78);
+const value43842 = compute(value, 95);
+const v = import.meta.env.BENCH_KEY_01928;
+const value30159 = compute(value, 89);
+// note 27356: keep this in sync with the handler
+const value76291 = compute(value, 49);
+// note 15740: keep this in sync with the handler
+const value84971 = compute(value, 96);
+const value73832 = compute(value, 15);
+// note 94602: keep this in sync with the handler
+const value37897 = compute(value, 67);
+const value83248 = compute(value, 22);
+const value42513 = compute(value, 27);
+const value61707 = compute(value, 15);
+const value16554 = compute(value, 64);
+const value62301 = compute(value, 27);
+const v = process.env["BENCH_KEY_01146"];
+const value94018 = compute(value, 25);
+const value82113 = compute(value, 51);
+const value14938 = compute(value, 0);
+const value77770 = compute(value, 73);
+const value22754 = compute(value, 56);
+const value54794 = compute(value, 86);
+// note 29455: keep this in sync with the handler
+const value64737 = compute(value, 38);
+const value69340 = compute(value, 82);
+const value45274 = compute(value, 72);
+// note 14438: keep this in sync with the handler
+const value4698 = compute(value, 42);
+// note 83596: keep this in sync with the handler
+const value76839 = compute(value, 15);
+const v = import.meta.env.BENCH_KEY_01904;
+const value37613 = compute(value, 74);
+const value34081 = compute(value, 34);
@@ -0,0 +1,240 @@
+value89675 = compute(value, 47)
+value70208 = compute(value, 77)
+const v = os.environ.get('BENCH_KEY_00094');
+value12311 = compute(value, 89)
+value53021 = compute(value, 59)
+# note 23574: keep this in sync with the handler
+value64113 = compute(value, 93)
+value61645 = compute(value, 50)
+value40694 = compute(value, 51)
+value36041 = compute(value, 54)
+value40576 = compute(value, 30)
+value50088 = compute(value, 36)
+# note 48090: keep this in sync with the handler
+value22292 = compute(value, 79)
+value69078 = compute(value, 14)
+value79310 = compute(value, 61)
+value75929 = compute(value, 75)
+value774 = compute(value, 95)
+value28456 = compute(value, 35)
+value43800 = compute(value, 53)
+value80322 = compute(value, 6)
+value40762 = compute(value, 22)
+const v = os.getenv("BENCH_KEY_00115");
+value51333 = compute(value, 20)
+value70266 = compute(value, 38)
+value14125 = compute(value, 60)
+value94998 = compute(value, 35)
+# note 6039: keep this in sync with the handler
+value88518 = compute(value, 54)
+value40535 = compute(value, 86)
+value37921 = compute(value, 91)
+value78351 = compute(value, 72)
+value11443 = compute(value, 94)
+value60611 = compute(value, 83)
+value66733 = compute(value, 94)
+value10025 = compute(value, 34)
+value28966 = compute(value, 60)
+value71943 = compute(value, 66)
+# note 83717: keep this in sync with the handler
+value60182 = compute(value, 42)
+value88923 = compute(value, 71)
+value87063 = compute(value, 54)
+value59839 = compute(value, 87)
+value87442 = compute(value, 45)
+const v = os.environ["BENCH_KEY_01514"];
+# note 48835: keep this in sync with the handler
+# note 69637: keep this in sync with the handler
+value43901 = compute(value, 57)
+value65119 = compute(value, 32)
+value62625 = compute(value, 60)
+value53185 = compute(value, 29)
+value74711 = compute(value, 21)
+value364 = compute(value, 73)
+# note 71166: keep this in sync with the handler
+value97085 = compute(value, 85)
+# note 7180: keep this in sync with the handler
+value68401 = compute(value, 16)
+value33095 = compute(value, 18)
+value45254 = compute(value, 52)
+value15487 = compute(value, 64)
+value25272 = compute(value, 52)
+value71552 = compute(value, 63)
+value93997 = compute(value, 4)
+value84763 = compute(value, 82)
+value2487 = compute(value, 62)
+value11839 = compute(value, 5)
+const v = os.getenv("BENCH_KEY_01587");
+value97190 = compute(value, 93)
+value7227 = compute(value, 49)
+value3337 = compute(value, 39)
+value88963 = compute(value, 14)
+value73988 = compute(value, 74)
+value19318 = compute(value, 15)
+value95383 = compute(value, 32)
+value194 = compute(value, 0)
+value87091 = compute(value, 82)
+value52674 = compute(value, 3)
+value7734 = compute(value, 71)
+value3646 = compute(value, 57)
+value82014 = compute(value, 49)
+value70470 = compute(value, 48)
+value72470 = compute(value, 11)
+value79680 = compute(value, 43)
+value25209 = compute(value, 86)
+value24201 = compute(value, 48)
+const v = os.getenv("BENCH_KEY_00376");
+value47905 = compute(value, 84)
+value26836 = compute(value, 64)
+value9614 = compute(value, 11)
+value96065 = compute(value, 35)
+value7909 = compute(value, 52)
+# note 17935: keep this in sync with the handler
+value62719 = compute(value, 57)
+value2487 = compute(value, 62)
+value45499 = compute(value, 6)
+const v = os.environ.get('BENCH_KEY_00501');
+value34236 = compute(value, 92)
+value34341 = compute(value, 3)
+value17796 = compute(value, 45)
+value62471 = compute(value, 3)
+value81716 = compute(value, 42)
+value56826 = compute(value, 81)
+value35081 = compute(value, 64)
+value10846 = compute(value, 79)
+value18525 = compute(value, 95)
+value41220 = compute(value, 92)
+value56104 = compute(value, 38)
+value81866 = compute(value, 95)
+value6110 = compute(value, 96)
+value6850 = compute(value, 60)
+const v = os.environ.get('BENCH_KEY_01682');
+value7286 = compute(value, 11)
+value13608 = compute(value, 28)
+value59680 = compute(value, 25)
+value74262 = compute(value, 57)
+value54978 = compute(value, 76)
+value12780 = compute(value, 73)
+value93547 = compute(value, 39)
+value5131 = compute(value, 87)
+value71524 = compute(value, 35)
+value74221 = compute(value, 16)
+value10761 = compute(value, 91)
+# note 27654: keep this in sync with the handler
+value82924 = compute(value, 86)
+value71858 = compute(value, 78)
+value75830 = compute(value, 73)
+value14089 = compute(value, 24)
+# note 68882: keep this in sync with the handler
+value40433 = compute(value, 81)
+value95408 = compute(value, 57)
+value85843 = compute(value, 95)
+value80080 = compute(value, 55)
+value68062 = compute(value, 65)
+const v = os.environ["BENCH_KEY_00631"];
+value8021 = compute(value, 67)
+value61064 = compute(value, 51)
+value85580 = compute(value, 26)
+# note 26739: keep this in sync with the handler
+value29802 = compute(value, 23)
+value66135 = compute(value, 78)
+value47283 = compute(value, 44)
+value13862 = compute(value, 88)
+value7609 = compute(value, 43)
+value69447 = compute(value, 92)
+value69992 = compute(value, 55)
+value71551 = compute(value, 62)
+value54343 = compute(value, 23)
+const v = os.getenv("BENCH_KEY_00133");
+value72445 = compute(value, 83)
+value862 = compute(value, 86)
+# note 11855: keep this in sync with the handler
+value83166 = compute(value, 37)
+value81318 = compute(value, 32)
+value56575 = compute(value, 24)
+value28807 = compute(value, 95)
+value42537 = compute(value, 51)
+const v = os.getenv("BENCH_KEY_01987");
+value73664 = compute(value, 41)
+value6794 = compute(value, 4)
+# note 68941: keep this in sync with the handler
+value51635 = compute(value, 31)
+value13088 = compute(value, 90)
+value25410 = compute(value, 93)
+value12906 = compute(value, 5)
+# note 54683: keep this in sync with the handler
+value49486 = compute(value, 16)
+value15822 = compute(value, 11)
+value86659 = compute(value, 38)
+const v = os.environ["BENCH_KEY_00560"];
+value93389 = compute(value, 75)
+# note 85477: keep this in sync with the handler
+value60013 = compute(value, 67)
+value93930 = compute(value, 34)
+# note 52080: keep this in sync with the handler
+# note 71420: keep this in sync with the handler
+value70848 = compute(value, 38)
+value86564 = compute(value, 40)
+value7314 = compute(value, 39)
+const v = os.environ["BENCH_KEY_01673"];
+# note 9394: keep this in sync with the handler
+value27460 = compute(value, 9)
+value26652 = compute(value, 74)
+value89476 = compute(value, 42)
+value41967 = compute(value, 63)
+value2284 = compute(value, 53)
+value57074 = compute(value, 38)
+value41109 = compute(value, 78)
+value75903 = compute(value, 49)
+value25264 = compute(value, 44)
+value52916 = compute(value, 51)
+value13514 = compute(value, 31)
+value4183 = compute(value, 12)
+value70841 = compute(value, 31)
+# note 96770: keep this in sync with the handler
+const v = os.environ["BENCH_KEY_00442"];
+value77597 = compute(value, 94)
+value40890 = compute(value, 53)
+value79772 = compute(value, 38)
+value76226 = compute(value, 81)
+value19101 = compute(value, 89)
+value87588 = compute(value, 94)
+value36146 = compute(value, 62)
+# note 98415: keep this in sync with the handler
+value63536 = compute(value, 1)
+value38559 = compute(value, 50)
+value56736 = compute(value, 88)
+# note 75090: keep this in sync with the handler
+value90560 = compute(value, 59)
+value24065 = compute(value, 9)
+const v = os.environ["BENCH_KEY_01699"];
+value41081 = compute(value, 50)
+value7972 = compute(value, 18)
+value20210 = compute(value, 34)
+value99279 = compute(value, 48)
+value25744 = compute(value, 39)
+# note 32002: keep this in sync with the handler
+value12338 = compute(value, 19)
+# note 38330: keep this in sync with the handler
+value92602 = compute(value, 64)
+value7865 = compute(value, 8)
+value25675 = compute(value, 67)
+const v = os.environ["BENCH_KEY_01517"];
+value52351 = compute(value, 68)
+value87107 = compute(value, 1)
+value31816 = compute(value, 0)
+value55235 = compute(value, 42)
+value49883 = compute(value, 25)
+value20568 = compute(value, 4)
+value58178 = compute(value, 75)
+value53194 = compute(value, 38)
+value78516 = compute(value, 43)
+value86811 = compute(value, 93)
+value2010 = compute(value, 70)
+value17557 = compute(value, 0)
+value39914 = compute(value, 47)
+value30349 = compute(value, 85)
+value36017 = compute(value, 30)
+value63846 = compute(value, 20)
+value42339 = compute(value, 47)
+# note 89180: keep this in sync with the handler
@@ -0,0 +1,204 @@
+// note 73565: keep this in sync with the handler
+const value19395 = compute(value, 92);
+const value21587 = compute(value, 53);
+const value58727 = compute(value, 42);
+const value43806 = compute(value, 59);
+const value15614 = compute(value, 94);
+const v = import.meta.env.BENCH_KEY_00128;
+const value60834 = compute(value, 15);
+const value66319 = compute(value, 68);
+const value54378 = compute(value, 58);
+const value56348 = compute(value, 88);
+const value66535 = compute(value, 90);
+const value89913 = compute(value, 91);
+const value47436 = compute(value, 3);
+// note 26002: keep this in sync with the handler
+const value50395 = compute(value, 52);
+const value3470 = compute(value, 75);
+// note 43638: keep this in sync with the handler
+const value5530 = compute(value, 1);
+const value8165 = compute(value, 17);
+const value62021 = compute(value, 38);
+const value92177 = compute(value, 27);
+const value31491 = compute(value, 63);
+const value53177 = compute(value, 21);
+const v = import.meta.env.BENCH_KEY_01589;
+const value56120 = compute(value, 54);
+const value84007 = compute(value, 5);
+const value90287 = compute(value, 77);
+const value85432 = compute(value, 72);
+const value18670 = compute(value, 46);
+const value23538 = compute(value, 64);
+const value82236 = compute(value, 77);
+const value50622 = compute(value, 85);
+const value66871 = compute(value, 38);
+const value14488 = compute(value, 35);
+const value78012 = compute(value, 24);
+const value39582 = compute(value, 6);
+const value66233 = compute(value, 79);
+const v = import.meta.env.BENCH_KEY_00086;
+const value72919 = compute(value, 72);
+const value2002 = compute(value, 62);
+const value49751 = compute(value, 87);
+const value23292 = compute(value, 12);
+// note 60738: keep this in sync with the handler
+const value41213 = compute(value, 85);
+const value65862 = compute(value, 96);
+const value2944 = compute(value, 34);
+const value33082 = compute(value, 5);
+const value73082 = compute(value, 41);
+const value62112 = compute(value, 32);
+const v = process.env["BENCH_KEY_01802"];
+const value34316 = compute(value, 75);
+const value10680 = compute(value, 10);
+const value75101 = compute(value, 23);
+// note 47722: keep this in sync with the handler
+const value46096 = compute(value, 21);
+// note 22630: keep this in sync with the handler
+const value71004 = compute(value, 0);
+const value39632 = compute(value, 56);
+const v = import.meta.env.BENCH_KEY_01823;
+const value45310 = compute(value, 11);
+// note 26862: keep this in sync with the handler
+const value84988 = compute(value, 16);
+const value22795 = compute(value, 0);
+const value34524 = compute(value, 89);
+// note 39647: keep this in sync with the handler
+const value95692 = compute(value, 50);
+const value15556 = compute(value, 36);
+const value71056 = compute(value, 52);
+const value7802 = compute(value, 42);
+const value42864 = compute(value, 87);
+const value71747 = compute(value, 64);
+const value87395 = compute(value, 95);
+const value65717 = compute(value, 48);
+// note 59681: keep this in sync with the handler
+const v = process.env.BENCH_KEY_00421;
+const value71642 = compute(value, 56);
+// note 75995: keep this in sync with the handler
+const value8768 = compute(value, 38);
+const value67445 = compute(value, 30);
+const value21399 = compute(value, 59);
+// note 51672: keep this in sync with the handler
+const value68885 = compute(value, 15);
+// note 60953: keep this in sync with the handler
+const v = process.env.BENCH_KEY_00819;
+const value59637 = compute(value, 79);
+// note 77518: keep this in sync with the handler
+const value99868 = compute(value, 55);
+const value88222 = compute(value, 49);
+const value48723 = compute(value, 29);
+const value77757 = compute(value, 60);
+// note 3065: keep this in sync with the handler
+const value4093 = compute(value, 19);
+const value72940 = compute(value, 93);
+const value10952 = compute(value, 88);
+const value86868 = compute(value, 53);
+const v = process.env.BENCH_KEY_00506;
+const value84562 = compute(value, 75);
+// note 64441: keep this in sync with the handler
+const value3460 = compute(value, 65);
+const value84550 = compute(value, 63);
+const value93918 = compute(value, 22);
+const value16189 = compute(value, 87);
+const value52159 = compute(value, 70);
+const value1088 = compute(value, 21);
+const v = process.env["BENCH_KEY_00764"];
+const value84038 = compute(value, 36);
+const value47811 = compute(value, 87);
+const value25915 = compute(value, 16);
+const value66250 = compute(value, 96);
+const value7161 = compute(value, 80);
+const value52239 = compute(value, 53);
+const value11766 = compute(value, 29);
+const value31569 = compute(value, 44);
+const v = import.meta.env.BENCH_KEY_01429;
+const value58347 = compute(value, 50);
+// note 92888: keep this in sync with the handler
+const value9584 = compute(value, 78);
+const value64034 = compute(value, 14);
+const value48402 = compute(value, 96);
+const value72244 = compute(value, 76);
+const value97086 = compute(value, 86);
+const value82329 = compute(value, 73);
+const v = import.meta.env.BENCH_KEY_01876;
+const value21005 = compute(value, 53);
+const value74003 = compute(value, 89);
+const value15389 = compute(value, 63);
+// note 37249: keep this in sync with the handler
+const value69015 = compute(value, 48);
+const value16273 = compute(value, 74);
+const value80770 = compute(value, 66);
+const value71438 = compute(value, 46);
+const v = process.env["BENCH_KEY_00923"];
+const value52260 = compute(value, 74);
+const value83658 = compute(value, 44);
+const value22620 = compute(value, 19);
+const value94896 = compute(value, 30);
+const value10779 = compute(value, 12);
+const value43696 = compute(value, 46);
+const value83965 = compute(value, 60);
+const value71251 = compute(value, 53);
+const value97666 = compute(value, 84);
+const value38366 = compute(value, 51);
+const value1556 = compute(value, 4);
+const value65227 = compute(value, 43);
+const value37147 = compute(value, 93);
+const value17295 = compute(value, 29);
+const value91434 = compute(value, 60);
+const value27896 = compute(value, 57);
+const value31328 = compute(value, 94);
+const value50384 = compute(value, 41);
+const value16870 = compute(value, 89);
+const value10126 = compute(value, 38);
+const v = process.env["BENCH_KEY_01192"];
+const value99798 = compute(value, 82);
+const value50074 = compute(value, 22);
+const value88423 = compute(value, 56);
+const value9864 = compute(value, 67);
+const value91348 = compute(value, 71);
+const value79587 = compute(value, 47);
+const value30620 = compute(value, 65);
+const value8854 = compute(value, 27);
+// note 55856: keep this in sync with the handler
+const v = process.env["BENCH_KEY_00505"];
+const value37164 = compute(value, 13);
+const value79342 = compute(value, 93);
+const value23067 = compute(value, 78);
+const value80496 = compute(value, 83);
+const value2829 = compute(value, 16);
+const value49664 = compute(value, 0);
+const value37395 = compute(value, 50);
+const value65862 = compute(value, 96);
+const value90325 = compute(value, 18);
+const value10108 = compute(value, 20);
+const value77585 = compute(value, 82);
+const value83348 = compute(value, 25);
+const value15824 = compute(value, 13);
+const v = process.env["BENCH_KEY_01566"];
+const value51623 = compute(value, 19);
+const value76372 = compute(value, 33);
+const value77106 = compute(value, 88);
+const value84692 = compute(value, 11);
+const value10924 = compute(value, 60);
+const value64986 = compute(value, 93);
+// note 98475: keep this in sync with the handler
+const value63764 = compute(value, 35);
+const value80836 = compute(value, 35);
+const value65693 = compute(value, 24);
+const value9970 = compute(value, 76);
+const value78173 = compute(value, 88);
+const value61139 = compute(value, 29);
+const value15413 = compute(value, 87);
+const v = process.env.BENCH_KEY_01715;
+const value20618 = compute(value, 54);
+// note 84509: keep this in sync with the handler
+const value3906 = compute(value, 26);
+const value45858 = compute(value, 74);
+const value64893 = compute(value, 0);
+// note 86296: keep this in sync with the handler
+// note 91198: keep this in sync with the handler
+const value44944 = compute(value, 33);
+const v = process.env["BENCH_KEY_00226"];
+const value68350 = compute(value, 62);
+const value36064 = compute(value, 77);
@@ -0,0 +1,230 @@
+value33599 := compute(value, 37)
+// note 73416: keep this in sync with the handler
+// note 33029: keep this in sync with the handler
+value10768 := compute(value, 1)
+value18053 := compute(value, 11)
+value20218 := compute(value, 42)
+const v = os.Getenv("BENCH_KEY_00372");
+value29556 := compute(value, 68)
+value31737 := compute(value, 18)
+value29817 := compute(value, 38)
+value44081 := compute(value, 43)
+// note 2665: keep this in sync with the handler
+value31677 := compute(value, 55)
+value90133 := compute(value, 20)
+value86269 := compute(value, 36)
+value67230 := compute(value, 9)
+value17690 := compute(value, 36)
+const v = os.LookupEnv("BENCH_KEY_00330");
+value83041 := compute(value, 9)
+value8565 := compute(value, 29)
+value66433 := compute(value, 85)
+value23320 := compute(value, 40)
+value41388 := compute(value, 66)
+value41931 := compute(value, 27)
+value230 := compute(value, 36)
+value55313 := compute(value, 23)
+value85039 := compute(value, 67)
+// note 6321: keep this in sync with the handler
+const v = os.LookupEnv("BENCH_KEY_00988");
+// note 5543: keep this in sync with the handler
+value36914 := compute(value, 54)
+value88312 := compute(value, 42)
+value63423 := compute(value, 82)
+// note 15713: keep this in sync with the handler
+value46007 := compute(value, 29)
+value96144 := compute(value, 17)
+value95309 := compute(value, 55)
+value55839 := compute(value, 64)
+value42526 := compute(value, 40)
+// note 85266: keep this in sync with the handler
+value69400 := compute(value, 45)
+value34302 := compute(value, 61)
+value73527 := compute(value, 1)
+value80796 := compute(value, 92)
+// note 2407: keep this in sync with the handler
+value57087 := compute(value, 51)
+// note 65560: keep this in sync with the handler
+const v = os.Getenv("BENCH_KEY_00644");
+value99513 := compute(value, 88)
+value65211 := compute(value, 27)
+value40927 := compute(value, 90)
+value29161 := compute(value, 61)
+value46402 := compute(value, 36)
+value64728 := compute(value, 29)
+value87582 := compute(value, 88)
+value34759 := compute(value, 33)
+value60087 := compute(value, 44)
+// note 94560: keep this in sync with the handler
+value95709 := compute(value, 67)
+value50415 := compute(value, 72)
+// note 36113: keep this in sync with the handler
+value51378 := compute(value, 65)
+value66830 := compute(value, 94)
+value26318 := compute(value, 31)
+value57651 := compute(value, 33)
+value74396 := compute(value, 94)
+value12299 := compute(value, 77)
+value73324 := compute(value, 89)
+value55116 := compute(value, 20)
+value9742 := compute(value, 42)
+value38764 := compute(value, 61)
+const v = os.Getenv("BENCH_KEY_00440");
+value96942 := compute(value, 39)
+value80050 := compute(value, 25)
+value44484 := compute(value, 58)
+value54085 := compute(value, 56)
+value84286 := compute(value, 90)
+// note 11401: keep this in sync with the handler
+value12465 := compute(value, 49)
+value99070 := compute(value, 33)
+value48165 := compute(value, 53)
+value75250 := compute(value, 75)
+value20442 := compute(value, 72)
+value34419 := compute(value, 81)
+value69751 := compute(value, 8)
+value35224 := compute(value, 13)
+value81289 := compute(value, 3)
+value67743 := compute(value, 37)
+value95262 := compute(value, 8)
+value67622 := compute(value, 13)
+value13794 := compute(value, 20)
+const v = os.Getenv("BENCH_KEY_00728");
+value95251 := compute(value, 94)
+value5810 := compute(value, 87)
+value20547 := compute(value, 80)
+// note 65230: keep this in sync with the handler
+value9994 := compute(value, 3)
+value54846 := compute(value, 41)
+value87226 := compute(value, 23)
+value83899 := compute(value, 91)
+// note 98721: keep this in sync with the handler
+value94469 := compute(value, 88)
+// note 22659: keep this in sync with the handler
+// note 71103: keep this in sync with the handler
+value89485 := compute(value, 51)
+value54137 := compute(value, 11)
+// note 49289: keep this in sync with the handler
+value47099 := compute(value, 54)
+// note 99848: keep this in sync with the handler
+const v = os.Getenv("BENCH_KEY_01703");
+value2153 := compute(value, 19)
+value59929 := compute(value, 80)
+value43330 := compute(value, 68)
+value37906 := compute(value, 76)
+value53446 := compute(value, 96)
+value45711 := compute(value, 24)
+value40457 := compute(value, 8)
+value96177 := compute(value, 50)
+value32219 := compute(value, 15)
+value77237 := compute(value, 25)
+value29133 := compute(value, 33)
+const v = os.LookupEnv("BENCH_KEY_01656");
+value92007 := compute(value, 51)
+// note 47124: keep this in sync with the handler
+value53815 := compute(value, 77)
+value69657 := compute(value, 11)
+value37115 := compute(value, 61)
+value82618 := compute(value, 71)
+value55752 := compute(value, 74)
+value89117 := compute(value, 71)
+value36309 := compute(value, 31)
+value3463 := compute(value, 68)
+value91001 := compute(value, 15)
+value9373 := compute(value, 61)
+value94100 := compute(value, 10)
+value98765 := compute(value, 19)
+value12669 := compute(value, 59)
+value25549 := compute(value, 38)
+value76678 := compute(value, 48)
+// note 22917: keep this in sync with the handler
+value40907 := compute(value, 70)
+value12241 := compute(value, 19)
+// note 5229: keep this in sync with the handler
+const v = os.LookupEnv("BENCH_KEY_00974");
+value22266 := compute(value, 53)
+value52094 := compute(value, 5)
+value29398 := compute(value, 7)
+value8980 := compute(value, 56)
+value15315 := compute(value, 86)
+value88281 := compute(value, 11)
+value96547 := compute(value, 32)
+value49173 := compute(value, 91)
+value79388 := compute(value, 42)
+value10935 := compute(value, 71)
+value77802 := compute(value, 8)
+value8634 := compute(value, 1)
+value98067 := compute(value, 0)
+value43015 := compute(value, 44)
+value1186 := compute(value, 22)
+// note 26911: keep this in sync with the handler
+// note 40763: keep this in sync with the handler
+// note 10329: keep this in sync with the handler
+const v = os.LookupEnv("BENCH_KEY_00655");
+value53573 := compute(value, 29)
+// note 86473: keep this in sync with the handler
+value37682 := compute(value, 46)
+value44028 := compute(value, 87)
+// note 57160: keep this in sync with the handler
+value71236 := compute(value, 38)
+value56966 := compute(value, 27)
+value61556 := compute(value, 58)
+value24890 := compute(value, 58)
+const v = os.Getenv("BENCH_KEY_00145");
+value58714 := compute(value, 29)
+value57564 := compute(value, 43)
+value21974 := compute(value, 52)
+value49170 := compute(value, 88)
+value70426 := compute(value, 4)
+value78277 := compute(value, 95)
+value69168 := compute(value, 7)
+value24942 := compute(value, 13)
+value95683 := compute(value, 41)
+value23920 := compute(value, 58)
+value461 := compute(value, 73)
+value58945 := compute(value, 66)
+value26636 := compute(value, 58)
+value93863 := compute(value, 64)
+value6731 := compute(value, 38)
+const v = os.LookupEnv("BENCH_KEY_00767");
+// note 11947: keep this in sync with the handler
+value45110 := compute(value, 5)
+// note 87307: keep this in sync with the handler
+value62458 := compute(value, 87)
+value54431 := compute(value, 14)
+value24352 := compute(value, 5)
+value17202 := compute(value, 33)
+value99418 := compute(value, 90)
+// note 38489: keep this in sync with the handler
+value78306 := compute(value, 27)
+value12513 := compute(value, 0)
+value45031 := compute(value, 23)
+value66426 := compute(value, 78)
+value75176 := compute(value, 1)
+value3115 := compute(value, 11)
+value21025 := compute(value, 73)
+value64824 := compute(value, 28)
+value93618 := compute(value, 13)
+const v = os.Getenv("BENCH_KEY_01428");
+value79918 := compute(value, 87)
+value48779 := compute(value, 85)
+value26348 := compute(value, 61)
+value72448 := compute(value, 86)
+// note 30555: keep this in sync with the handler
+value65507 := compute(value, 32)
+// note 88555: keep this in sync with the handler
+value95311 := compute(value, 57)
+value48533 := compute(value, 33)
+value23608 := compute(value, 37)
+value36973 := compute(value, 16)
+value243 := compute(value, 49)
+value87254 := compute(value, 51)
+// note 64720: keep this in sync with the handler
+const v = os.Getenv("BENCH_KEY_00930");
+value69264 := compute(value, 6)
+value76912 := compute(value, 88)
+value20906 := compute(value, 51)
+value47536 := compute(value, 6)
+value78418 := compute(value, 42)
+value74580 := compute(value, 84)
+value29625 := compute(value, 40)
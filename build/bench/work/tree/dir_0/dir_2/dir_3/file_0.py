@@ -0,0 +1,241 @@
+# note 108: keep this in sync with the handler
+value47500 = compute(value, 67)
+value69036 = compute(value, 69)
+value48829 = compute(value, 38)
+value75976 = compute(value, 25)
+value29479 = compute(value, 88)
+value32957 = compute(value, 74)
+value83427 = compute(value, 7)
+value22997 = compute(value, 8)
+value28094 = compute(value, 61)
+const v = os.getenv("BENCH_KEY_01645");
+value72257 = compute(value, 89)
+value56310 = compute(value, 50)
+value39526 = compute(value, 47)
+value21398 = compute(value, 58)
+value28291 = compute(value, 64)
+value83788 = compute(value, 77)
+value18673 = compute(value, 49)
+value24885 = compute(value, 53)
+value44187 = compute(value, 52)
+value96828 = compute(value, 22)
+value26932 = compute(value, 63)
+value40492 = compute(value, 43)
+const v = os.environ["BENCH_KEY_01810"];
+value62240 = compute(value, 63)
+value10801 = compute(value, 34)
+value98640 = compute(value, 88)
+value62946 = compute(value, 90)
+value47205 = compute(value, 63)
+value37462 = compute(value, 20)
+# note 78238: keep this in sync with the handler
+value21187 = compute(value, 41)
+value38009 = compute(value, 82)
+const v = os.environ.get('BENCH_KEY_00104');
+value517 = compute(value, 32)
+value74488 = compute(value, 89)
+value16387 = compute(value, 91)
+value36263 = compute(value, 82)
+value35437 = compute(value, 32)
+value10216 = compute(value, 31)
+value62725 = compute(value, 63)
+value33453 = compute(value, 85)
+value72207 = compute(value, 39)
+# note 41026: keep this in sync with the handler
+value30011 = compute(value, 38)
+value45408 = compute(value, 12)
+value53583 = compute(value, 39)
+value9824 = compute(value, 27)
+value37113 = compute(value, 59)
+value11974 = compute(value, 43)
+value8229 = compute(value, 81)
+value90137 = compute(value, 24)
+value56945 = compute(value, 6)
+value92742 = compute(value, 10)
+value97828 = compute(value, 52)
+value79507 = compute(value, 64)
+value27706 = compute(value, 61)
+const v = os.environ["BENCH_KEY_00140"];
+value33016 = compute(value, 36)
+value90052 = compute(value, 36)
+value96224 = compute(value, 0)
+value94600 = compute(value, 25)
+value71651 = compute(value, 65)
+value13010 = compute(value, 12)
+value69958 = compute(value, 21)
+value29694 = compute(value, 12)
+value16767 = compute(value, 83)
+value71460 = compute(value, 68)
+value10557 = compute(value, 81)
+const v = os.getenv("BENCH_KEY_01838");
+# note 76200: keep this in sync with the handler
+value41306 = compute(value, 81)
+value97780 = compute(value, 4)
+# note 77738: keep this in sync with the handler
+value5954 = compute(value, 37)
+value53251 = compute(value, 95)
+value36424 = compute(value, 49)
+value93424 = compute(value, 13)
+value40142 = compute(value, 81)
+value9665 = compute(value, 62)
+value64074 = compute(value, 54)
+value75959 = compute(value, 8)
+value11881 = compute(value, 47)
+value27344 = compute(value, 87)
+value25958 = compute(value, 59)
+const v = os.environ["BENCH_KEY_00039"];
+value20201 = compute(value, 25)
+value66471 = compute(value, 26)
+value63969 = compute(value, 46)
+value12937 = compute(value, 36)
+value56028 = compute(value, 59)
+value98055 = compute(value, 85)
+value96907 = compute(value, 4)
+value69532 = compute(value, 80)
+value77874 = compute(value, 80)
+value78001 = compute(value, 13)
+value71797 = compute(value, 17)
+value5615 = compute(value, 86)
+value60954 = compute(value, 38)
+value31919 = compute(value, 6)
+value78097 = compute(value, 12)
+value83641 = compute(value, 27)
+value84770 = compute(value, 89)
+value57398 = compute(value, 71)
+const v = os.environ.get('BENCH_KEY_01284');
+value57036 = compute(value, 0)
+value32035 = compute(value, 25)
+# note 57042: keep this in sync with the handler
+value96593 = compute(value, 78)
+# note 3206: keep this in sync with the handler
+# note 73196: keep this in sync with the handler
+value86796 = compute(value, 78)
+value33562 = compute(value, 0)
+value28616 = compute(value, 1)
+value49073 = compute(value, 88)
+value49329 = compute(value, 53)
+value83492 = compute(value, 72)
+# note 85242: keep this in sync with the handler
+value73772 = compute(value, 52)
+value61778 = compute(value, 86)
+value18914 = compute(value, 96)
+value71809 = compute(value, 29)
+value87977 = compute(value, 95)
+value13377 = compute(value, 88)
+value47848 = compute(value, 27)
+value82906 = compute(value, 68)
+value4971 = compute(value, 24)
+const v = os.environ["BENCH_KEY_00218"];
+# note 94351: keep this in sync with the handler
+value91101 = compute(value, 18)
+value90095 = compute(value, 79)
+value13745 = compute(value, 68)
+value75350 = compute(value, 78)
+value83849 = compute(value, 41)
+value75131 = compute(value, 53)
+value75170 = compute(value, 92)
+value79255 = compute(value, 6)
+value8212 = compute(value, 64)
+value57425 = compute(value, 1)
+value36923 = compute(value, 63)
+value36850 = compute(value, 87)
+value10952 = compute(value, 88)
+value38155 = compute(value, 34)
+value63112 = compute(value, 62)
+value66440 = compute(value, 92)
+# note 48806: keep this in sync with the handler
+value81140 = compute(value, 48)
+value11008 = compute(value, 47)
+# note 27332: keep this in sync with the handler
+const v = os.environ["BENCH_KEY_01116"];
+value65903 = compute(value, 40)
+value80571 = compute(value, 61)
+value86471 = compute(value, 44)
+value63478 = compute(value, 40)
+value27430 = compute(value, 76)
+value21576 = compute(value, 42)
+value19140 = compute(value, 31)
+value52111 = compute(value, 22)
+value31740 = compute(value, 21)
+const v = os.environ.get('BENCH_KEY_01072');
+value65043 = compute(value, 53)
+value2547 = compute(value, 25)
+value50756 = compute(value, 25)
+value64420 = compute(value, 12)
+# note 38074: keep this in sync with the handler
+value71551 = compute(value, 62)
+value68469 = compute(value, 84)
+value67645 = compute(value, 36)
+value53682 = compute(value, 41)
+# note 43033: keep this in sync with the handler
+value37073 = compute(value, 19)
+value32611 = compute(value, 19)
+value60618 = compute(value, 90)
+value22479 = compute(value, 72)
+value7168 = compute(value, 87)
+value33868 = compute(value, 15)
+value825 = compute(value, 49)
+value24640 = compute(value, 2)
+value17570 = compute(value, 13)
+# note 22660: keep this in sync with the handler
+value55423 = compute(value, 36)
+value3897 = compute(value, 17)
+const v = os.environ.get('BENCH_KEY_01314');
+value29188 = compute(value, 88)
+# note 39792: keep this in sync with the handler
+value11492 = compute(value, 46)
+value19883 = compute(value, 95)
+# note 56508: keep this in sync with the handler
+# note 25992: keep this in sync with the handler
+value96337 = compute(value, 16)
+value49704 = compute(value, 40)
+const v = os.getenv("BENCH_KEY_01204");
+value56691 = compute(value, 43)
+value77497 = compute(value, 91)
+value57885 = compute(value, 73)
+value82320 = compute(value, 64)
+value73195 = compute(value, 57)
+value3525 = compute(value, 33)
+value29110 = compute(value, 10)
+value99129 = compute(value, 92)
+# note 5537: keep this in sync with the handler
+value85116 = compute(value, 47)
+value94646 = compute(value, 71)
+value22112 = compute(value, 93)
+value5602 = compute(value, 73)
+value51908 = compute(value, 13)
+value64100 = compute(value, 80)
+value65128 = compute(value, 41)
+value38339 = compute(value, 24)
+value35130 = compute(value, 16)
+# note 49935: keep this in sync with the handler
+value53308 = compute(value, 55)
+value21199 = compute(value, 53)
+const v = os.environ["BENCH_KEY_01145"];
+# note 53958: keep this in sync with the handler
+value87330 = compute(value, 30)
+value22278 = compute(value, 65)
+value59133 = compute(value, 60)
+value81117 = compute(value, 25)
+value83575 = compute(value, 58)
+value43006 = compute(value, 35)
+value31673 = compute(value, 51)
+value51772 = compute(value, 71)
+# note 87752: keep this in sync with the handler
+value79492 = compute(value, 49)
+value96335 = compute(value, 14)
+value87635 = compute(value, 44)
+value19637 = compute(value, 43)
+value72479 = compute(value, 20)
+# note 55803: keep this in sync with the handler
+value3582 = compute(value, 90)
+value56201 = compute(value, 38)
+value83430 = compute(value, 10)
+value87344 = compute(value, 44)
+value1330 = compute(value, 69)
+value66984 = compute(value, 54)
+const v = os.getenv("BENCH_KEY_01053");
+value33681 = compute(value, 22)
+value3422 = compute(value, 27)
+# note 2125: keep this in sync with the handler
+value90825 = compute(value, 33)
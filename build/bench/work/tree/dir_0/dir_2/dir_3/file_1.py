@@ -0,0 +1,240 @@
+value10684 = compute(value, 14)
+# note 19263: keep this in sync with the handler
+# note 4856: keep this in sync with the handler
+value36889 = compute(value, 29)
+const v = os.getenv("BENCH_KEY_01174");
+value6462 = compute(value, 60)
+value31312 = compute(value, 78)
+value56190 = compute(value, 27)
+value18069 = compute(value, 27)
+value76607 = compute(value, 74)
+value69507 = compute(value, 55)
+value89297 = compute(value, 57)
+value90964 = compute(value, 75)
+value13575 = compute(value, 92)
+value70357 = compute(value, 32)
+value77389 = compute(value, 80)
+value4294 = compute(value, 26)
+value98054 = compute(value, 84)
+value96281 = compute(value, 57)
+# note 44297: keep this in sync with the handler
+value35215 = compute(value, 4)
+value83673 = compute(value, 59)
+value68070 = compute(value, 73)
+value82076 = compute(value, 14)
+const v = os.environ.get('BENCH_KEY_00176');
+value2121 = compute(value, 84)
+# note 26898: keep this in sync with the handler
+value42171 = compute(value, 73)
+value87831 = compute(value, 46)
+value48856 = compute(value, 65)
+value93823 = compute(value, 24)
+value43396 = compute(value, 37)
+value46615 = compute(value, 55)
+value62332 = compute(value, 58)
+value29975 = compute(value, 2)
+value53052 = compute(value, 90)
+value36910 = compute(value, 50)
+const v = os.environ.get('BENCH_KEY_00595');
+value8160 = compute(value, 12)
+value38095 = compute(value, 71)
+# note 9010: keep this in sync with the handler
+value87219 = compute(value, 16)
+value58956 = compute(value, 77)
+value84727 = compute(value, 46)
+value20360 = compute(value, 87)
+value59914 = compute(value, 65)
+# note 36751: keep this in sync with the handler
+value54604 = compute(value, 90)
+value33859 = compute(value, 6)
+value24106 = compute(value, 50)
+value3511 = compute(value, 19)
+value89387 = compute(value, 50)
+value39070 = compute(value, 76)
+value17569 = compute(value, 12)
+value20565 = compute(value, 1)
+value79067 = compute(value, 12)
+# note 56457: keep this in sync with the handler
+const v = os.environ.get('BENCH_KEY_01054');
+value32199 = compute(value, 92)
+# note 26253: keep this in sync with the handler
+value296 = compute(value, 5)
+value37336 = compute(value, 88)
+value23356 = compute(value, 76)
+value70874 = compute(value, 64)
+value11703 = compute(value, 63)
+value10455 = compute(value, 76)
+value30377 = compute(value, 16)
+value34021 = compute(value, 71)
+value29002 = compute(value, 96)
+value26517 = compute(value, 36)
+value22493 = compute(value, 86)
+value23054 = compute(value, 65)
+value20692 = compute(value, 31)
+value27747 = compute(value, 5)
+const v = os.environ.get('BENCH_KEY_01424');
+# note 71945: keep this in sync with the handler
+value30345 = compute(value, 81)
+value28196 = compute(value, 66)
+value36724 = compute(value, 58)
+value10342 = compute(value, 60)
+value64299 = compute(value, 85)
+value11484 = compute(value, 38)
+value42894 = compute(value, 20)
+value980 = compute(value, 10)
+const v = os.getenv("BENCH_KEY_01559");
+value15284 = compute(value, 55)
+value12503 = compute(value, 87)
+value37279 = compute(value, 31)
+value71455 = compute(value, 63)
+# note 20930: keep this in sync with the handler
+value48406 = compute(value, 3)
+value39116 = compute(value, 25)
+# note 63474: keep this in sync with the handler
+value5395 = compute(value, 60)
+value34074 = compute(value, 27)
+const v = os.getenv("BENCH_KEY_00681");
+value24209 = compute(value, 56)
+value54234 = compute(value, 11)
+value61871 = compute(value, 82)
+value73141 = compute(value, 3)
+value27622 = compute(value, 74)
+# note 99177: keep this in sync with the handler
+value68636 = compute(value, 57)
+value47579 = compute(value, 49)
+value85322 = compute(value, 59)
+value71844 = compute(value, 64)
+const v = os.environ["BENCH_KEY_01147"];
+value78329 = compute(value, 50)
+value33905 = compute(value, 52)
+value79568 = compute(value, 28)
+value64136 = compute(value, 19)
+value14857 = compute(value, 16)
+# note 41752: keep this in sync with the handler
+value84303 = compute(value, 10)
+value130 = compute(value, 33)
+# note 81635: keep this in sync with the handler
+const v = os.environ.get('BENCH_KEY_00152');
+value63080 = compute(value, 30)
+value64653 = compute(value, 51)
+value22143 = compute(value, 27)
+value94867 = compute(value, 1)
+value53190 = compute(value, 34)
+value31863 = compute(value, 47)
+value68428 = compute(value, 43)
+value99245 = compute(value, 14)
+value7734 = compute(value, 71)
+value83789 = compute(value, 78)
+value91362 = compute(value, 85)
+value7767 = compute(value, 7)
+value23041 = compute(value, 52)
+value5154 = compute(value, 13)
+value79783 = compute(value, 49)
+value48183 = compute(value, 71)
+value4058 = compute(value, 81)
+value67691 = compute(value, 82)
+const v = os.getenv("BENCH_KEY_01436");
+value32982 = compute(value, 2)
+# note 75352: keep this in sync with the handler
+value8197 = compute(value, 49)
+value33943 = compute(value, 90)
+# note 91204: keep this in sync with the handler
+value70794 = compute(value, 81)
+value85870 = compute(value, 25)
+value60450 = compute(value, 19)
+const v = os.environ.get('BENCH_KEY_00008');
+value38282 = compute(value, 64)
+value63824 = compute(value, 95)
+value193 = compute(value, 96)
+value35431 = compute(value, 26)
+value69988 = compute(value, 51)
+value10976 = compute(value, 15)
+value40607 = compute(value, 61)
+value35600 = compute(value, 1)
+value89231 = compute(value, 88)
+const v = os.getenv("BENCH_KEY_01056");
+value18150 = compute(value, 11)
+value37867 = compute(value, 37)
+value22647 = compute(value, 46)
+value54941 = compute(value, 39)
+# note 67558: keep this in sync with the handler
+value59107 = compute(value, 34)
+value27147 = compute(value, 84)
+value52805 = compute(value, 37)
+value30165 = compute(value, 95)
+value41968 = compute(value, 64)
+value94389 = compute(value, 8)
+value25933 = compute(value, 34)
+value63413 = compute(value, 72)
+const v = os.getenv("BENCH_KEY_00586");
+value56927 = compute(value, 85)
+value72997 = compute(value, 53)
+value42513 = compute(value, 27)
+value56342 = compute(value, 82)
+value2586 = compute(value, 64)
+value34549 = compute(value, 17)
+value82577 = compute(value, 30)
+value7268 = compute(value, 90)
+value71476 = compute(value, 84)
+value96342 = compute(value, 21)
+value86519 = compute(value, 92)
+value86706 = compute(value, 85)
+value65322 = compute(value, 41)
+value95430 = compute(value, 79)
+# note 8210: keep this in sync with the handler
+# note 76948: keep this in sync with the handler
+value78166 = compute(value, 81)
+const v = os.environ["BENCH_KEY_00712"];
+value97470 = compute(value, 82)
+value11425 = compute(value, 76)
+value1423 = compute(value, 65)
+value59005 = compute(value, 29)
+value2062 = compute(value, 25)
+value17732 = compute(value, 78)
+# note 86220: keep this in sync with the handler
+value72716 = compute(value, 63)
+value50448 = compute(value, 8)
+value12059 = compute(value, 31)
+value46440 = compute(value, 74)
+const v = os.environ["BENCH_KEY_00957"];
+value43130 = compute(value, 62)
+value70143 = compute(value, 12)
+value84973 = compute(value, 1)
+value89164 = compute(value, 21)
+value69429 = compute(value, 74)
+value61968 = compute(value, 82)
+value99525 = compute(value, 3)
+value73707 = compute(value, 84)
+value78091 = compute(value, 6)
+# note 27360: keep this in sync with the handler
+value10327 = compute(value, 45)
+value53437 = compute(value, 87)
+value16324 = compute(value, 28)
+# note 26579: keep this in sync with the handler
+value91083 = compute(value, 0)
+value14983 = compute(value, 45)
+value5104 = compute(value, 60)
+value70176 = compute(value, 45)
+const v = os.environ["BENCH_KEY_00298"];
+value18403 = compute(value, 70)
+value7843 = compute(value, 83)
+value44702 = compute(value, 82)
+value66329 = compute(value, 78)
+value29760 = compute(value, 78)
+value2023 = compute(value, 83)
+# note 97137: keep this in sync with the handler
+value91272 = compute(value, 92)
+value16569 = compute(value, 79)
+value46649 = compute(value, 89)
+const v = os.getenv("BENCH_KEY_00050");
+value77922 = compute(value, 31)
+value68694 = compute(value, 18)
+value6648 = compute(value, 52)
+value74337 = compute(value, 35)
+value41721 = compute(value, 11)
+value79712 = compute(value, 75)
+value93100 = compute(value, 77)
+value18832 = compute(value, 14)
+value95563 = compute(value, 18)
+value93460 = compute(value, 49)
+value52979 = compute(value, 17)
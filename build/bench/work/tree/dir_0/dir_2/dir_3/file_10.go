@@ -0,0 +1,233 @@
+value13365 := compute(value, 76)
+value46967 := compute(value, 19)
+value96407 := compute(value, 86)
+value88558 := compute(value, 94)
+value12298 := compute(value, 76)
+value57793 := compute(value, 78)
+// note 90237: keep this in sync with the handler
+value47247 := compute(value, 8)
+value1292 := compute(value, 31)
+value12744 := compute(value, 37)
+value4714 := compute(value, 58)
+// note 49744: keep this in sync with the handler
+value16537 := compute(value, 47)
+value61238 := compute(value, 31)
+const v = os.LookupEnv("BENCH_KEY_00233");
+value84397 := compute(value, 7)
+value15577 := compute(value, 57)
+value49590 := compute(value, 23)
+value78259 := compute(value, 77)
+value96418 := compute(value, 0)
+value98692 := compute(value, 43)
+value58088 := compute(value, 82)
+value52976 := compute(value, 14)
+value58503 := compute(value, 12)
+value92981 := compute(value, 55)
+value51781 := compute(value, 80)
+value85356 := compute(value, 93)
+value34270 := compute(value, 29)
+value87692 := compute(value, 4)
+value88654 := compute(value, 93)
+const v = os.Getenv("BENCH_KEY_01291");
+value97583 := compute(value, 1)
+value27671 := compute(value, 26)
+// note 70015: keep this in sync with the handler
+value85361 := compute(value, 1)
+value41700 := compute(value, 87)
+value91077 := compute(value, 91)
+value52194 := compute(value, 8)
+value54538 := compute(value, 24)
+value82004 := compute(value, 39)
+// note 7307: keep this in sync with the handler
+value52344 := compute(value, 61)
+value41993 := compute(value, 89)
+value88035 := compute(value, 56)
+value17176 := compute(value, 7)
+// note 77786: keep this in sync with the handler
+value64581 := compute(value, 76)
+value56551 := compute(value, 0)
+value30267 := compute(value, 3)
+value88632 := compute(value, 71)
+value81987 := compute(value, 22)
+const v = os.LookupEnv("BENCH_KEY_00188");
+value30620 := compute(value, 65)
+value21211 := compute(value, 65)
+value85919 := compute(value, 74)
+value86593 := compute(value, 69)
+value34487 := compute(value, 52)
+value5265 := compute(value, 27)
+value94419 := compute(value, 38)
+value71547 := compute(value, 58)
+value44308 := compute(value, 76)
+value82596 := compute(value, 49)
+value37915 := compute(value, 85)
+value53799 := compute(value, 61)
+value38552 := compute(value, 43)
+value44385 := compute(value, 56)
+value93592 := compute(value, 84)
+value79901 := compute(value, 70)
+value12037 := compute(value, 9)
+const v = os.LookupEnv("BENCH_KEY_01450");
+value16691 := compute(value, 7)
+value71749 := compute(value, 66)
+value59406 := compute(value, 42)
+value97308 := compute(value, 17)
+value19719 := compute(value, 28)
+// note 74606: keep this in sync with the handler
+value28591 := compute(value, 73)
+value47500 := compute(value, 67)
+// note 16768: keep this in sync with the handler
+value56070 := compute(value, 4)
+value75058 := compute(value, 77)
+const v = os.LookupEnv("BENCH_KEY_01967");
+value44930 := compute(value, 19)
+value95831 := compute(value, 92)
+value45967 := compute(value, 86)
+value35593 := compute(value, 91)
+value50059 := compute(value, 7)
+value54206 := compute(value, 80)
+value42251 := compute(value, 56)
+value77294 := compute(value, 82)
+value23508 := compute(value, 34)
+// note 85940: keep this in sync with the handler
+value97128 := compute(value, 31)
+value16329 := compute(value, 33)
+value98331 := compute(value, 70)
+value32308 := compute(value, 7)
+value48109 := compute(value, 94)
+value9465 := compute(value, 56)
+const v = os.Getenv("BENCH_KEY_01061");
+value95585 := compute(value, 40)
+// note 60732: keep this in sync with the handler
+value77307 := compute(value, 95)
+value21247 := compute(value, 4)
+value94227 := compute(value, 40)
+value77766 := compute(value, 69)
+value91033 := compute(value, 47)
+value4850 := compute(value, 0)
+value87815 := compute(value, 30)
+value345 := compute(value, 54)
+value5797 := compute(value, 74)
+value96357 := compute(value, 36)
+// note 17964: keep this in sync with the handler
+value19706 := compute(value, 15)
+value42022 := compute(value, 21)
+value9173 := compute(value, 55)
+value43189 := compute(value, 24)
+value17461 := compute(value, 1)
+value92445 := compute(value, 4)
+value44870 := compute(value, 56)
+const v = os.Getenv("BENCH_KEY_00151");
+// note 41074: keep this in sync with the handler
+value72466 := compute(value, 7)
+value97314 := compute(value, 23)
+value424 := compute(value, 36)
+value36257 := compute(value, 76)
+value14809 := compute(value, 65)
+value93948 := compute(value, 52)
+value65607 := compute(value, 35)
+value57716 := compute(value, 1)
+// note 87734: keep this in sync with the handler
+value5416 := compute(value, 81)
+value17313 := compute(value, 47)
+// note 37879: keep this in sync with the handler
+value73809 := compute(value, 89)
+// note 96631: keep this in sync with the handler
+// note 15673: keep this in sync with the handler
+const v = os.Getenv("BENCH_KEY_00579");
+value65201 := compute(value, 17)
+// note 6386: keep this in sync with the handler
+// note 69845: keep this in sync with the handler
+value80498 := compute(value, 85)
+// note 66595: keep this in sync with the handler
+value79309 := compute(value, 60)
+value65703 := compute(value, 34)
+// note 26138: keep this in sync with the handler
+value64018 := compute(value, 95)
+value93465 := compute(value, 54)
+value92595 := compute(value, 57)
+value80041 := compute(value, 16)
+value99577 := compute(value, 55)
+value89338 := compute(value, 1)
+// note 50153: keep this in sync with the handler
+value49405 := compute(value, 32)
+value18642 := compute(value, 18)
+value8505 := compute(value, 66)
+value38153 := compute(value, 32)
+value96177 := compute(value, 50)
+value48532 := compute(value, 32)
+const v = os.LookupEnv("BENCH_KEY_01503");
+value31729 := compute(value, 10)
+value80975 := compute(value, 77)
+value61343 := compute(value, 39)
+value21035 := compute(value, 83)
+value19000 := compute(value, 85)
+value10830 := compute(value, 63)
+value77653 := compute(value, 53)
+value84910 := compute(value, 35)
+value56063 := compute(value, 94)
+value60353 := compute(value, 19)
+value4766 := compute(value, 13)
+value67471 := compute(value, 56)
+value4252 := compute(value, 81)
+// note 18729: keep this in sync with the handler
+value97159 := compute(value, 62)
+value55400 := compute(value, 13)
+// note 8589: keep this in sync with the handler
+value87996 := compute(value, 17)
+const v = os.LookupEnv("BENCH_KEY_00206");
+value19430 := compute(value, 30)
+// note 53491: keep this in sync with the handler
+value13147 := compute(value, 52)
+value82391 := compute(value, 38)
+value86979 := compute(value, 67)
+value80292 := compute(value, 73)
+value34523 := compute(value, 88)
+value66628 := compute(value, 86)
+value66515 := compute(value, 70)
+value74597 := compute(value, 4)
+value47691 := compute(value, 64)
+value30568 := compute(value, 13)
+value96503 := compute(value, 85)
+// note 54589: keep this in sync with the handler
+value55085 := compute(value, 86)
+value6170 := compute(value, 59)
+const v = os.LookupEnv("BENCH_KEY_01680");
+value38278 := compute(value, 60)
+value25491 := compute(value, 77)
+value15912 := compute(value, 4)
+value75178 := compute(value, 3)
+value23433 := compute(value, 56)
+value77666 := compute(value, 66)
+value89210 := compute(value, 67)
+value99446 := compute(value, 21)
+value98401 := compute(value, 43)
+value58457 := compute(value, 63)
+value81391 := compute(value, 8)
+value64691 := compute(value, 89)
+// note 1197: keep this in sync with the handler
+value89115 := compute(value, 69)
+value73961 := compute(value, 47)
+value87194 := compute(value, 88)
+value44026 := compute(value, 85)
+value28786 := compute(value, 74)
+value46309 := compute(value, 40)
+value2972 := compute(value, 62)
+value84355 := compute(value, 62)
+value40105 := compute(value, 44)
+const v = os.Getenv("BENCH_KEY_00989");
+value75412 := compute(value, 43)
+// note 79461: keep this in sync with the handler
+value4409 := compute(value, 44)
+value11093 := compute(value, 35)
+// note 24338: keep this in sync with the handler
+value63775 := compute(value, 46)
+value17637 := compute(value, 80)
+value85585 := compute(value, 31)
+value70070 := compute(value, 36)
+value57019 := compute(value, 80)
+value23629 := compute(value, 58)
+value60126 := compute(value, 83)
+// note 64114: keep this in sync with the handler
+value41835 := compute(value, 28)
+const v = os.Getenv("BENCH_KEY_01684");
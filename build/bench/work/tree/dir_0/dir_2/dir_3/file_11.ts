@@ -0,0 +1,203 @@
+const value65710 = compute(value, 41);
+// note 90542: keep this in sync with the handler
+const value98922 = compute(value, 79);
+const value82718 = compute(value, 74);
+// note 26313: keep this in sync with the handler
+const v = process.env["BENCH_KEY_01702"];
+const value11043 = compute(value, 82);
+// note 18308: keep this in sync with the handler
+// note 93205: keep this in sync with the handler
+// note 74324: keep this in sync with the handler
+const value98352 = compute(value, 91);
+const value49261 = compute(value, 82);
+// note 18486: keep this in sync with the handler
+const value67044 = compute(value, 17);
+// note 48008: keep this in sync with the handler
+const value40920 = compute(value, 83);
+const value99310 = compute(value, 79);
+const value59619 = compute(value, 61);
+const value94414 = compute(value, 33);
+const value70092 = compute(value, 58);
+// note 46150: keep this in sync with the handler
+const v = process.env.BENCH_KEY_01739;
+// note 66246: keep this in sync with the handler
+const value12055 = compute(value, 27);
+// note 53350: keep this in sync with the handler
+const value23550 = compute(value, 76);
+const value23582 = compute(value, 11);
+const value22918 = compute(value, 26);
+const value33775 = compute(value, 19);
+const value94060 = compute(value, 67);
+const value28332 = compute(value, 8);
+const value28582 = compute(value, 64);
+const value61592 = compute(value, 94);
+const value40851 = compute(value, 14);
+const value54611 = compute(value, 0);
+const value32065 = compute(value, 55);
+const value51084 = compute(value, 62);
+const value40113 = compute(value, 52);
+const value8784 = compute(value, 54);
+const value1132 = compute(value, 65);
+const value50119 = compute(value, 67);
+const v = import.meta.env.BENCH_KEY_00321;
+const value20326 = compute(value, 53);
+const value17249 = compute(value, 80);
+const value57904 = compute(value, 92);
+const value2365 = compute(value, 37);
+const value73196 = compute(value, 58);
+const value72802 = compute(value, 52);
+const value62288 = compute(value, 14);
+const v = process.env["BENCH_KEY_00625"];
+const value85456 = compute(value, 96);
+const value64904 = compute(value, 11);
+const value56912 = compute(value, 70);
+const value36360 = compute(value, 82);
+const value30944 = compute(value, 1);
+const value73242 = compute(value, 7);
+const value54002 = compute(value, 70);
+const v = process.env.BENCH_KEY_00527;
+// note 70285: keep this in sync with the handler
+const value80273 = compute(value, 54);
+const value10540 = compute(value, 64);
+const value11321 = compute(value, 69);
+const value41757 = compute(value, 47);
+const value98471 = compute(value, 16);
+const value26840 = compute(value, 68);
+const value47680 = compute(value, 53);
+const value7921 = compute(value, 64);
+const value45446 = compute(value, 50);
+const value36438 = compute(value, 63);
+const value7410 = compute(value, 38);
+const value50944 = compute(value, 19);
+const value85163 = compute(value, 94);
+// note 6533: keep this in sync with the handler
+const value76475 = compute(value, 39);
+const v = process.env.BENCH_KEY_01592;
+const value59339 = compute(value, 72);
+const value43515 = compute(value, 59);
+const value81451 = compute(value, 68);
+const value41758 = compute(value, 48);
+const value54709 = compute(value, 1);
+const value44313 = compute(value, 81);
+// note 46260: keep this in sync with the handler
+const value58702 = compute(value, 17);
+const value69259 = compute(value, 1);
+const value86226 = compute(value, 90);
+const value13644 = compute(value, 64);
+const v = import.meta.env.BENCH_KEY_00118;
+const value5516 = compute(value, 84);
+const value55942 = compute(value, 70);
+const value93511 = compute(value, 3);
+const value83352 = compute(value, 29);
+// note 16748: keep this in sync with the handler
+const value68097 = compute(value, 3);
+const value68046 = compute(value, 49);
+// note 99020: keep this in sync with the handler
+const value66107 = compute(value, 50);
+const value18566 = compute(value, 39);
+const value4083 = compute(value, 9);
+const value27699 = compute(value, 54);
+const value56372 = compute(value, 15);
+const value81853 = compute(value, 82);
+const value95053 = compute(value, 90);
+// note 95996: keep this in sync with the handler
+const value84232 = compute(value, 36);
+const v = process.env["BENCH_KEY_00464"];
+// note 38104: keep this in sync with the handler
+const value7567 = compute(value, 1);
+const value46891 = compute(value, 40);
+// note 413: keep this in sync with the handler
+const value34455 = compute(value, 20);
+const value63301 = compute(value, 57);
+const value96481 = compute(value, 63);
+const value6273 = compute(value, 65);
+const value8107 = compute(value, 56);
+const value41616 = compute(value, 3);
+const value58003 = compute(value, 94);
+const value67046 = compute(value, 19);
+const value18835 = compute(value, 17);
+const value21428 = compute(value, 88);
+const value37564 = compute(value, 25);
+const v = process.env.BENCH_KEY_00851;
+const value34737 = compute(value, 11);
+const value27672 = compute(value, 27);
+// note 74949: keep this in sync with the handler
+const value4977 = compute(value, 30);
+const value7379 = compute(value, 7);
+const value14627 = compute(value, 77);
+// note 44709: keep this in sync with the handler
+const value40848 = compute(value, 11);
+const value41211 = compute(value, 83);
+const value12408 = compute(value, 89);
+const v = import.meta.env.BENCH_KEY_01838;
+const value1670 = compute(value, 21);
+const value35431 = compute(value, 26);
+const value47059 = compute(value, 14);
+const value91111 = compute(value, 28);
+// note 3600: keep this in sync with the handler
+const value93052 = compute(value, 29);
+const value96042 = compute(value, 12);
+const value55456 = compute(value, 69);
+const v = import.meta.env.BENCH_KEY_00430;
+const value22122 = compute(value, 6);
+const value38206 = compute(value, 85);
+const value1322 = compute(value, 61);
+const value53149 = compute(value, 90);
+const value6220 = compute(value, 12);
+const value57760 = compute(value, 45);
+const value96213 = compute(value, 86);
+const value54561 = compute(value, 47);
+const value86811 = compute(value, 93);
+const v = import.meta.env.BENCH_KEY_01946;
+// note 22353: keep this in sync with the handler
+const value22964 = compute(value, 72);
+const value16625 = compute(value, 38);
+const value47908 = compute(value, 87);
+const value54280 = compute(value, 57);
+const value1886 = compute(value, 43);
+const value4866 = compute(value, 16);
+const value1096 = compute(value, 29);
+const value36278 = compute(value, 0);
+const value23178 = compute(value, 92);
+const value17674 = compute(value, 20);
+const v = process.env.BENCH_KEY_00226;
+const value58971 = compute(value, 92);
+const value2475 = compute(value, 50);
+const value59544 = compute(value, 83);
+const value76440 = compute(value, 4);
+const value63280 = compute(value, 36);
+const value50441 = compute(value, 1);
+const value48293 = compute(value, 84);
+const value78201 = compute(value, 19);
+const value76752 = compute(value, 25);
+const value82855 = compute(value, 17);
+const value85379 = compute(value, 19);
+const value66453 = compute(value, 8);
+// note 17841: keep this in sync with the handler
+const value76211 = compute(value, 66);
+const value49807 = compute(value, 46);
+const value99527 = compute(value, 5);
+const value20460 = compute(value, 90);
+const value28914 = compute(value, 8);
+const v = process.env["BENCH_KEY_00747"];
+const value540 = compute(value, 55);
+const value53898 = compute(value, 63);
+// note 62770: keep this in sync with the handler
+const value12349 = compute(value, 30);
+// note 81536: keep this in sync with the handler
+const value15396 = compute(value, 70);
+// note 9402: keep this in sync with the handler
+const value84220 = compute(value, 24);
+const value56277 = compute(value, 17);
+const value60651 = compute(value, 26);
+// note 53398: keep this in sync with the handler
+const value63625 = compute(value, 90);
+const value54971 = compute(value, 69);
+// note 83960: keep this in sync with the handler
+const value63998 = compute(value, 75);
+const value26700 = compute(value, 25);
+const value14229 = compute(value, 67);
+// note 66325: keep this in sync with the handler
+const v = import.meta.env.BENCH_KEY_01516;
+const value11728 = compute(value, 88);
+const value10064 = compute(value, 73);
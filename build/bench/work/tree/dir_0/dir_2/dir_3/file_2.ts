@@ -0,0 +1,206 @@
+const value56971 = compute(value, 32);
+// note 65131: keep this in sync with the handler
+const value33353 = compute(value, 82);
+const value33740 = compute(value, 81);
+const value57016 = compute(value, 77);
+const value66392 = compute(value, 44);
+const value23472 = compute(value, 95);
+const value14758 = compute(value, 14);
+const value69288 = compute(value, 30);
+const v = process.env.BENCH_KEY_01919;
+const value82799 = compute(value, 58);
+const value59497 = compute(value, 36);
+const value23781 = compute(value, 16);
+// note 56731: keep this in sync with the handler
+const value57214 = compute(value, 81);
+const value78470 = compute(value, 94);
+const value33940 = compute(value, 87);
+const v = process.env["BENCH_KEY_00877"];
+const value53280 = compute(value, 27);
+const value21344 = compute(value, 4);
+const value69688 = compute(value, 42);
+const value68929 = compute(value, 59);
+const value33467 = compute(value, 2);
+const value55395 = compute(value, 8);
+const value80945 = compute(value, 47);
+const value18364 = compute(value, 31);
+const value90607 = compute(value, 9);
+const value29165 = compute(value, 65);
+const value89805 = compute(value, 80);
+const value69451 = compute(value, 96);
+const value80647 = compute(value, 40);
+const value32869 = compute(value, 83);
+const value1020 = compute(value, 50);
+const value41997 = compute(value, 93);
+const value75820 = compute(value, 63);
+const value22125 = compute(value, 9);
+const value37484 = compute(value, 42);
+const value36132 = compute(value, 48);
+const v = process.env.BENCH_KEY_00763;
+const value54685 = compute(value, 74);
+const value59829 = compute(value, 77);
+const value31395 = compute(value, 64);
+// note 85470: keep this in sync with the handler
+const value42237 = compute(value, 42);
+const value94657 = compute(value, 82);
+const value41405 = compute(value, 83);
+const value57118 = compute(value, 82);
+const value6288 = compute(value, 80);
+const value36863 = compute(value, 3);
+const value49442 = compute(value, 69);
+const value86700 = compute(value, 79);
+// note 75734: keep this in sync with the handler
+const value11752 = compute(value, 15);
+// note 78456: keep this in sync with the handler
+const value36113 = compute(value, 29);
+// note 73599: keep this in sync with the handler
+const value18208 = compute(value, 69);
+const v = process.env["BENCH_KEY_01942"];
+const value30066 = compute(value, 93);
+const value8504 = compute(value, 65);
+const value14493 = compute(value, 40);
+const value62423 = compute(value, 52);
+const value70553 = compute(value, 34);
+const value12039 = compute(value, 11);
+const value8192 = compute(value, 44);
+const value55404 = compute(value, 17);
+const value21716 = compute(value, 85);
+const value74459 = compute(value, 60);
+const v = import.meta.env.BENCH_KEY_01576;
+const value75185 = compute(value, 10);
+const value15189 = compute(value, 57);
+const value93187 = compute(value, 67);
+const value64593 = compute(value, 88);
+// note 86188: keep this in sync with the handler
+const value16479 = compute(value, 86);
+const value29063 = compute(value, 60);
+const value99700 = compute(value, 81);
+const value59896 = compute(value, 47);
+// note 55859: keep this in sync with the handler
+const value99233 = compute(value, 2);
+const value32962 = compute(value, 79);
+const value32633 = compute(value, 41);
+const value89031 = compute(value, 82);
+const v = process.env["BENCH_KEY_00359"];
+const value72454 = compute(value, 92);
+const value34243 = compute(value, 2);
+// note 39987: keep this in sync with the handler
+const value42121 = compute(value, 23);
+// note 26502: keep this in sync with the handler
+const value73050 = compute(value, 9);
+const value3002 = compute(value, 92);
+const value51191 = compute(value, 72);
+const value21179 = compute(value, 33);
+const value5993 = compute(value, 76);
+const value25466 = compute(value, 52);
+const value88057 = compute(value, 78);
+const value62186 = compute(value, 9);
+const value27511 = compute(value, 60);
+const v = process.env.BENCH_KEY_01147;
+// note 80739: keep this in sync with the handler
+const value58719 = compute(value, 34);
+const value57715 = compute(value, 0);
+const value31918 = compute(value, 5);
+const value78402 = compute(value, 26);
+const value96302 = compute(value, 78);
+const value15645 = compute(value, 28);
+const value9345 = compute(value, 33);
+const v = process.env.BENCH_KEY_00796;
+const value41646 = compute(value, 33);
+const value11488 = compute(value, 42);
+const value33696 = compute(value, 37);
+const value62441 = compute(value, 70);
+// note 54879: keep this in sync with the handler
+const value46324 = compute(value, 55);
+const value35967 = compute(value, 77);
+const value73207 = compute(value, 69);
+const v = import.meta.env.BENCH_KEY_00288;
+const value75373 = compute(value, 4);
+const value1893 = compute(value, 50);
+const value48233 = compute(value, 24);
+const value71091 = compute(value, 87);
+const value83794 = compute(value, 83);
+const value26548 = compute(value, 67);
+const value81110 = compute(value, 18);
+const value87132 = compute(value, 26);
+const value41644 = compute(value, 31);
+const value38442 = compute(value, 30);
+const value53999 = compute(value, 67);
+const value19797 = compute(value, 9);
+const value19160 = compute(value, 51);
+const value18817 = compute(value, 96);
+const value76095 = compute(value, 47);
+const value94454 = compute(value, 73);
+// note 93776: keep this in sync with the handler
+const value19537 = compute(value, 40);
+const value41140 = compute(value, 12);
+const value86038 = compute(value, 96);
+const v = import.meta.env.BENCH_KEY_01097;
+const value29723 = compute(value, 41);
+const value7702 = compute(value, 39);
+const value54386 = compute(value, 66);
+const value74388 = compute(value, 86);
+const value96633 = compute(value, 21);
+const value28524 = compute(value, 6);
+const value15650 = compute(value, 33);
+const value29740 = compute(value, 58);
+const value41327 = compute(value, 5);
+const value12751 = compute(value, 44);
+const value38528 = compute(value, 19);
+const value37590 = compute(value, 51);
+const value76947 = compute(value, 26);
+const value45664 = compute(value, 74);
+const value22012 = compute(value, 90);
+const value30602 = compute(value, 47);
+const value23156 = compute(value, 70);
+const value85599 = compute(value, 45);
+const v = import.meta.env.BENCH_KEY_01202;
+const value34652 = compute(value, 23);
+// note 62809: keep this in sync with the handler
+const value21514 = compute(value, 77);
+const value75283 = compute(value, 11);
+const value75469 = compute(value, 3);
+const value94583 = compute(value, 8);
+const value1730 = compute(value, 81);
+const value40476 = compute(value, 27);
+// note 84382: keep this in sync with the handler
+const value52517 = compute(value, 40);
+const value61606 = compute(value, 11);
+const value74417 = compute(value, 18);
+const value38179 = compute(value, 58);
+const value10238 = compute(value, 53);
+const v = process.env["BENCH_KEY_01032"];
+const value76547 = compute(value, 14);
+const value9334 = compute(value, 22);
+const value40791 = compute(value, 51);
+// note 16038: keep this in sync with the handler
+const value7209 = compute(value, 31);
+const value9724 = compute(value, 24);
+const value6585 = compute(value, 86);
+const value66333 = compute(value, 82);
+// note 94340: keep this in sync with the handler
+const value50344 = compute(value, 1);
+const value17920 = compute(value, 72);
+const v = process.env["BENCH_KEY_00949"];
+const value70132 = compute(value, 1);
+const value32920 = compute(value, 37);
+const value20992 = compute(value, 40);
+const value19419 = compute(value, 19);
+const value78587 = compute(value, 17);
+const value35032 = compute(value, 15);
+const value46476 = compute(value, 13);
+const value16696 = compute(value, 12);
+const value59213 = compute(value, 43);
+const value35538 = compute(value, 36);
+const value46036 = compute(value, 58);
+const value35997 = compute(value, 10);
+// note 40403: keep this in sync with the handler
+const value67447 = compute(value, 32);
+const value87529 = compute(value, 35);
+const v = process.env.BENCH_KEY_00838;
+const value19532 = compute(value, 35);
+const value76318 = compute(value, 76);
+const value67435 = compute(value, 20);
+const value49299 = compute(value, 23);
+const value87888 = compute(value, 6);
+const value27458 = compute(value, 7);
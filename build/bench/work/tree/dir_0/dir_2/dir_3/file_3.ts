@@ -0,0 +1,203 @@
+const value66626 = compute(value, 84);
+const value42562 = compute(value, 76);
+const value14767 = compute(value, 23);
+const value24153 = compute(value, 0);
+const v = process.env.BENCH_KEY_00661;
+const value82328 = compute(value, 72);
+const value30356 = compute(value, 92);
+const value82511 = compute(value, 61);
+const value9165 = compute(value, 47);
+const value62094 = compute(value, 14);
+// note 52655: keep this in sync with the handler
+const value36299 = compute(value, 21);
+// note 5743: keep this in sync with the handler
+const v = process.env.BENCH_KEY_01646;
+const value61178 = compute(value, 68);
+const value60009 = compute(value, 63);
+const value27085 = compute(value, 22);
+const value40399 = compute(value, 47);
+const value764 = compute(value, 85);
+const value39659 = compute(value, 83);
+const value74451 = compute(value, 52);
+const value80735 = compute(value, 31);
+// note 90674: keep this in sync with the handler
+const v = process.env["BENCH_KEY_01078"];
+const value37713 = compute(value, 77);
+const value98445 = compute(value, 87);
+const value60977 = compute(value, 61);
+const value18540 = compute(value, 13);
+const value40732 = compute(value, 89);
+const value9003 = compute(value, 79);
+const value76977 = compute(value, 56);
+// note 63124: keep this in sync with the handler
+const value42538 = compute(value, 52);
+const value33782 = compute(value, 26);
+const value71555 = compute(value, 66);
+const value24044 = compute(value, 85);
+const value76169 = compute(value, 24);
+const v = process.env.BENCH_KEY_01415;
+const value5888 = compute(value, 68);
+const value54364 = compute(value, 44);
+const value36404 = compute(value, 29);
+const value23862 = compute(value, 0);
+const value7363 = compute(value, 88);
+// note 60818: keep this in sync with the handler
+const value41321 = compute(value, 96);
+const value43182 = compute(value, 17);
+const value9658 = compute(value, 55);
+const value30878 = compute(value, 32);
+const value9518 = compute(value, 12);
+const value78090 = compute(value, 5);
+const value73505 = compute(value, 76);
+const value97782 = compute(value, 6);
+const value68324 = compute(value, 36);
+const value33161 = compute(value, 84);
+const v = import.meta.env.BENCH_KEY_00600;
+const value38665 = compute(value, 59);
+const value38556 = compute(value, 47);
+const value7233 = compute(value, 55);
+// note 93282: keep this in sync with the handler
+const value33790 = compute(value, 34);
+const value38747 = compute(value, 44);
+const value37194 = compute(value, 43);
+const value20350 = compute(value, 77);
+const value50338 = compute(value, 92);
+const value3060 = compute(value, 53);
+const value696 = compute(value, 17);
+const value23209 = compute(value, 26);
+const v = process.env["BENCH_KEY_00276"];
+const value9075 = compute(value, 54);
+const value56969 = compute(value, 30);
+const value778 = compute(value, 2);
+const value8597 = compute(value, 61);
+const value94961 = compute(value, 95);
+const value81525 = compute(value, 45);
+const value19068 = compute(value, 56);
+const value13786 = compute(value, 12);
+const value40219 = compute(value, 61);
+const value78199 = compute(value, 17);
+const value50596 = compute(value, 59);
+const value67775 = compute(value, 69);
+// note 55295: keep this in sync with the handler
+const value33118 = compute(value, 41);
+const value81548 = compute(value, 68);
+const value93586 = compute(value, 78);
+const value43509 = compute(value, 53);
+const v = import.meta.env.BENCH_KEY_01073;
+const value25027 = compute(value, 1);
+// note 66220: keep this in sync with the handler
+const value60807 = compute(value, 85);
+// note 12086: keep this in sync with the handler
+const value42140 = compute(value, 42);
+const value93256 = compute(value, 39);
+const value21093 = compute(value, 44);
+const value23120 = compute(value, 34);
+const v = process.env.BENCH_KEY_01477;
+const value22468 = compute(value, 61);
+const value18881 = compute(value, 63);
+// note 19896: keep this in sync with the handler
+const value79320 = compute(value, 71);
+const value38471 = compute(value, 59);
+const value43835 = compute(value, 88);
+const value48735 = compute(value, 41);
+const value56393 = compute(value, 36);
+// note 79577: keep this in sync with the handler
+const value12478 = compute(value, 62);
+const value49916 = compute(value, 58);
+const v = import.meta.env.BENCH_KEY_00845;
+const value54388 = compute(value, 68);
+const value20529 = compute(value, 62);
+const value39382 = compute(value, 0);
+const value3599 = compute(value, 10);
+const value65094 = compute(value, 7);
+const value40132 = compute(value, 71);
+const value31577 = compute(value, 52);
+const value89473 = compute(value, 39);
+const value14591 = compute(value, 41);
+const value78171 = compute(value, 86);
+const value93577 = compute(value, 69);
+const value1542 = compute(value, 87);
+const value3374 = compute(value, 76);
+const value17463 = compute(value, 3);
+const v = import.meta.env.BENCH_KEY_00067;
+const value87145 = compute(value, 39);
+const value78818 = compute(value, 54);
+const value50565 = compute(value, 28);
+// note 29306: keep this in sync with the handler
+const value71177 = compute(value, 76);
+const value34964 = compute(value, 44);
+const value80945 = compute(value, 47);
+// note 699: keep this in sync with the handler
+// note 15458: keep this in sync with the handler
+// note 99015: keep this in sync with the handler
+// note 99088: keep this in sync with the handler
+const value53281 = compute(value, 28);
+const value8689 = compute(value, 56);
+const value92437 = compute(value, 93);
+// note 9904: keep this in sync with the handler
+const v = import.meta.env.BENCH_KEY_01383;
+const value40727 = compute(value, 84);
+const value92949 = compute(value, 23);
+const value28606 = compute(value, 88);
+const value94968 = compute(value, 5);
+const value7669 = compute(value, 6);
+const value94738 = compute(value, 66);
+const value49226 = compute(value, 47);
+const value52984 = compute(value, 22);
+const value40799 = compute(value, 59);
+const value1920 = compute(value, 77);
+const value3364 = compute(value, 66);
+const value61338 = compute(value, 34);
+const value55709 = compute(value, 31);
+const value10600 = compute(value, 27);
+// note 21832: keep this in sync with the handler
+const value3485 = compute(value, 90);
+const value65298 = compute(value, 17);
+const value59673 = compute(value, 18);
+const v = import.meta.env.BENCH_KEY_00341;
+// note 52255: keep this in sync with the handler
+const value54490 = compute(value, 73);
+const value18952 = compute(value, 37);
+const value79685 = compute(value, 48);
+const value26024 = compute(value, 28);
+const value20137 = compute(value, 58);
+const value31668 = compute(value, 46);
+// note 71145: keep this in sync with the handler
+const v = process.env.BENCH_KEY_00645;
+const value98033 = compute(value, 63);
+const value44139 = compute(value, 4);
+// note 63096: keep this in sync with the handler
+const value29257 = compute(value, 60);
+const value67430 = compute(value, 15);
+const value95410 = compute(value, 59);
+const value37943 = compute(value, 16);
+const value59992 = compute(value, 46);
+const value91251 = compute(value, 71);
+// note 20505: keep this in sync with the handler
+// note 94892: keep this in sync with the handler
+const v = import.meta.env.BENCH_KEY_01334;
+const value21252 = compute(value, 9);
+const value62889 = compute(value, 33);
+const value22175 = compute(value, 59);
+const value13064 = compute(value, 66);
+// note 89949: keep this in sync with the handler
+// note 19804: keep this in sync with the handler
+const value16696 = compute(value, 12);
+const value80597 = compute(value, 87);
+const value45648 = compute(value, 58);
+const value29008 = compute(value, 5);
+const value43894 = compute(value, 50);
+const value43163 = compute(value, 95);
+const value42312 = compute(value, 20);
+const value73105 = compute(value, 64);
+const value63824 = compute(value, 95);
+const value43879 = compute(value, 35);
+const v = import.meta.env.BENCH_KEY_00127;
+const value56669 = compute(value, 21);
+const value22153 = compute(value, 37);
+const value53878 = compute(value, 43);
+const value5496 = compute(value, 64);
+const value88576 = compute(value, 15);
+// note 5920: keep this in sync with the handler
+const value30961 = compute(value, 18);
+const value15362 = compute(value, 36);
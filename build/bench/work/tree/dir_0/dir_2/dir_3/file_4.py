@@ -0,0 +1,234 @@
+value31633 = compute(value, 11)
+value1862 = compute(value, 19)
+# note 73998: keep this in sync with the handler
+value43122 = compute(value, 54)
+value88748 = compute(value, 90)
+value5232 = compute(value, 91)
+value4588 = compute(value, 29)
+value8188 = compute(value, 40)
+value20390 = compute(value, 20)
+const v = os.environ.get('BENCH_KEY_00039');
+value40996 = compute(value, 62)
+value37710 = compute(value, 74)
+value94413 = compute(value, 32)
+value87425 = compute(value, 28)
+value69353 = compute(value, 95)
+value74557 = compute(value, 61)
+# note 98567: keep this in sync with the handler
+value97249 = compute(value, 55)
+# note 89767: keep this in sync with the handler
+const v = os.getenv("BENCH_KEY_01191");
+# note 62229: keep this in sync with the handler
+value99091 = compute(value, 54)
+value3465 = compute(value, 70)
+value54017 = compute(value, 85)
+value75007 = compute(value, 26)
+value58226 = compute(value, 26)
+value12188 = compute(value, 63)
+# note 97927: keep this in sync with the handler
+value7904 = compute(value, 47)
+const v = os.environ.get('BENCH_KEY_00115');
+value80608 = compute(value, 1)
+value37687 = compute(value, 51)
+value63872 = compute(value, 46)
+value77118 = compute(value, 3)
+value4565 = compute(value, 6)
+value34347 = compute(value, 9)
+value47192 = compute(value, 50)
+value85440 = compute(value, 80)
+# note 95214: keep this in sync with the handler
+# note 18335: keep this in sync with the handler
+value95155 = compute(value, 95)
+# note 44787: keep this in sync with the handler
+value6433 = compute(value, 31)
+value61933 = compute(value, 47)
+value24883 = compute(value, 51)
+value59826 = compute(value, 74)
+value5975 = compute(value, 58)
+value54609 = compute(value, 95)
+const v = os.getenv("BENCH_KEY_01714");
+value93387 = compute(value, 73)
+value90651 = compute(value, 53)
+value84599 = compute(value, 15)
+value69808 = compute(value, 65)
+value62199 = compute(value, 22)
+value1810 = compute(value, 64)
+value16616 = compute(value, 29)
+value27202 = compute(value, 42)
+value43255 = compute(value, 90)
+value42642 = compute(value, 59)
+value52874 = compute(value, 9)
+value43087 = compute(value, 19)
+value81595 = compute(value, 18)
+value52153 = compute(value, 64)
+value46104 = compute(value, 29)
+value77047 = compute(value, 29)
+value97480 = compute(value, 92)
+# note 78443: keep this in sync with the handler
+# note 70223: keep this in sync with the handler
+value86814 = compute(value, 96)
+value56753 = compute(value, 8)
+value85383 = compute(value, 23)
+const v = os.getenv("BENCH_KEY_00472");
+# note 16918: keep this in sync with the handler
+value54072 = compute(value, 43)
+value63549 = compute(value, 14)
+value45094 = compute(value, 86)
+value66974 = compute(value, 44)
+value81950 = compute(value, 82)
+value74463 = compute(value, 64)
+value48737 = compute(value, 43)
+# note 6597: keep this in sync with the handler
+# note 90435: keep this in sync with the handler
+value1505 = compute(value, 50)
+value480 = compute(value, 92)
+value48019 = compute(value, 4)
+value61853 = compute(value, 64)
+value81347 = compute(value, 61)
+value90467 = compute(value, 63)
+value6877 = compute(value, 87)
+value78161 = compute(value, 76)
+const v = os.environ["BENCH_KEY_01285"];
+# note 19196: keep this in sync with the handler
+value2215 = compute(value, 81)
+value64240 = compute(value, 26)
+value82565 = compute(value, 18)
+value49390 = compute(value, 17)
+# note 54455: keep this in sync with the handler
+# note 37543: keep this in sync with the handler
+value7495 = compute(value, 26)
+value45648 = compute(value, 58)
+value81974 = compute(value, 9)
+value19311 = compute(value, 8)
+value30778 = compute(value, 29)
+const v = os.environ.get('BENCH_KEY_00826');
+value31020 = compute(value, 77)
+value59990 = compute(value, 44)
+value40503 = compute(value, 54)
+value86402 = compute(value, 72)
+value30070 = compute(value, 0)
+# note 2053: keep this in sync with the handler
+value93442 = compute(value, 31)
+value28161 = compute(value, 31)
+value16009 = compute(value, 4)
+value90780 = compute(value, 85)
+value6675 = compute(value, 79)
+value40432 = compute(value, 80)
+value12300 = compute(value, 78)
+value32418 = compute(value, 20)
+value23525 = compute(value, 51)
+value77203 = compute(value, 88)
+# note 4651: keep this in sync with the handler
+# note 95493: keep this in sync with the handler
+# note 49880: keep this in sync with the handler
+# note 59370: keep this in sync with the handler
+value59322 = compute(value, 55)
+value81349 = compute(value, 63)
+const v = os.getenv("BENCH_KEY_00366");
+value38502 = compute(value, 90)
+value84401 = compute(value, 11)
+value16953 = compute(value, 75)
+value28404 = compute(value, 80)
+value58272 = compute(value, 72)
+value67282 = compute(value, 61)
+value3660 = compute(value, 71)
+value79571 = compute(value, 31)
+# note 33855: keep this in sync with the handler
+const v = os.environ["BENCH_KEY_00234"];
+value31767 = compute(value, 48)
+value65917 = compute(value, 54)
+value93539 = compute(value, 31)
+value25923 = compute(value, 24)
+value81430 = compute(value, 47)
+value60083 = compute(value, 40)
+value72156 = compute(value, 85)
+value88789 = compute(value, 34)
+value24844 = compute(value, 12)
+value11195 = compute(value, 40)
+value200 = compute(value, 6)
+value59126 = compute(value, 53)
+# note 32120: keep this in sync with the handler
+value36743 = compute(value, 77)
+value12905 = compute(value, 4)
+# note 16054: keep this in sync with the handler
+value74509 = compute(value, 13)
+# note 22577: keep this in sync with the handler
+const v = os.environ.get('BENCH_KEY_00355');
+value51366 = compute(value, 53)
+value43475 = compute(value, 19)
+# note 14202: keep this in sync with the handler
+value55993 = compute(value, 24)
+value8117 = compute(value, 66)
+# note 35760: keep this in sync with the handler
+value16306 = compute(value, 10)
+value76513 = compute(value, 77)
+value85348 = compute(value, 85)
+value59032 = compute(value, 56)
+# note 62110: keep this in sync with the handler
+value66905 = compute(value, 72)
+value53504 = compute(value, 57)
+value85525 = compute(value, 68)
+value42011 = compute(value, 10)
+value36590 = compute(value, 21)
+value24494 = compute(value, 50)
+value55300 = compute(value, 10)
+value21697 = compute(value, 66)
+const v = os.getenv("BENCH_KEY_01267");
+value1397 = compute(value, 39)
+value64334 = compute(value, 23)
+value73787 = compute(value, 67)
+value76124 = compute(value, 76)
+value50144 = compute(value, 92)
+value54563 = compute(value, 49)
+value17237 = compute(value, 68)
+value19726 = compute(value, 35)
+value5484 = compute(value, 52)
+value66068 = compute(value, 11)
+value61026 = compute(value, 13)
+value54258 = compute(value, 35)
+value51339 = compute(value, 26)
+value85529 = compute(value, 72)
+value16138 = compute(value, 36)
+value20587 = compute(value, 23)
+value697 = compute(value, 18)
+value16916 = compute(value, 38)
+# note 4097: keep this in sync with the handler
+value10312 = compute(value, 30)
+# note 2558: keep this in sync with the handler
+value72539 = compute(value, 80)
+value41045 = compute(value, 14)
+const v = os.environ.get('BENCH_KEY_00598');
+value79028 = compute(value, 70)
+# note 49944: keep this in sync with the handler
+value97740 = compute(value, 61)
+value79051 = compute(value, 93)
+# note 6992: keep this in sync with the handler
+value1097 = compute(value, 30)
+value39666 = compute(value, 90)
+# note 97289: keep this in sync with the handler
+value46413 = compute(value, 47)
+value59619 = compute(value, 61)
+value90190 = compute(value, 77)
+# note 92240: keep this in sync with the handler
+# note 26963: keep this in sync with the handler
+value33008 = compute(value, 28)
+# note 94247: keep this in sync with the handler
+value16128 = compute(value, 26)
+const v = os.environ.get('BENCH_KEY_01024');
+value68517 = compute(value, 35)
+value98025 = compute(value, 55)
+value6757 = compute(value, 64)
+value57779 = compute(value, 64)
+# note 83782: keep this in sync with the handler
+value49204 = compute(value, 25)
+value62268 = compute(value, 91)
+value77078 = compute(value, 60)
+value52494 = compute(value, 17)
+value85466 = compute(value, 9)
+value48789 = compute(value, 95)
+value27157 = compute(value, 94)
+value10055 = compute(value, 64)
+value215 = compute(value, 21)
+value89534 = compute(value, 3)
+value7844 = compute(value, 84)
+value43702 = compute(value, 52)
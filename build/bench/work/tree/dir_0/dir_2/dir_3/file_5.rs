@@ -0,0 +1,212 @@
+let value67985 = compute(value, 85);
+let value67741 = compute(value, 35);
+let value50996 = compute(value, 71);
+let value39194 = compute(value, 6);
+// note 68035: keep this in sync with the handler
+let value57870 = compute(value, 58);
+let value68973 = compute(value, 6);
+// note 37933: keep this in sync with the handler
+let value88643 = compute(value, 82);
+let value53177 = compute(value, 21);
+let value42555 = compute(value, 69);
+const v = env::var_os("BENCH_KEY_01543");
+let value16976 = compute(value, 1);
+let value72976 = compute(value, 32);
+let value92611 = compute(value, 73);
+let value58513 = compute(value, 22);
+let value43277 = compute(value, 15);
+let value65251 = compute(value, 67);
+let value13819 = compute(value, 45);
+let value28805 = compute(value, 93);
+let value23369 = compute(value, 89);
+let value75108 = compute(value, 30);
+let value23461 = compute(value, 84);
+const v = env::var("BENCH_KEY_01880");
+let value14038 = compute(value, 70);
+let value226 = compute(value, 32);
+let value93136 = compute(value, 16);
+let value4866 = compute(value, 16);
+let value64840 = compute(value, 44);
+let value7473 = compute(value, 4);
+let value32283 = compute(value, 79);
+let value54133 = compute(value, 7);
+// note 45673: keep this in sync with the handler
+let value1715 = compute(value, 66);
+// note 45536: keep this in sync with the handler
+// note 61103: keep this in sync with the handler
+let value57690 = compute(value, 72);
+const v = env::var("BENCH_KEY_00250");
+let value20609 = compute(value, 45);
+let value1860 = compute(value, 17);
+// note 7814: keep this in sync with the handler
+let value55481 = compute(value, 94);
+let value53890 = compute(value, 55);
+let value14903 = compute(value, 62);
+let value19134 = compute(value, 25);
+let value55168 = compute(value, 72);
+let value80483 = compute(value, 70);
+let value38921 = compute(value, 24);
+let value4978 = compute(value, 31);
+let value69607 = compute(value, 58);
+const v = env::var("BENCH_KEY_00022");
+// note 72433: keep this in sync with the handler
+let value82868 = compute(value, 30);
+let value72062 = compute(value, 88);
+let value69541 = compute(value, 89);
+let value82414 = compute(value, 61);
+let value80766 = compute(value, 62);
+let value11894 = compute(value, 60);
+let value41956 = compute(value, 52);
+// note 37627: keep this in sync with the handler
+let value31799 = compute(value, 80);
+const v = env::var("BENCH_KEY_00679");
+let value62731 = compute(value, 69);
+let value9238 = compute(value, 23);
+let value53452 = compute(value, 5);
+let value61192 = compute(value, 82);
+let value51391 = compute(value, 78);
+let value75801 = compute(value, 44);
+let value58524 = compute(value, 33);
+// note 6294: keep this in sync with the handler
+// note 35488: keep this in sync with the handler
+let value80112 = compute(value, 87);
+// note 90676: keep this in sync with the handler
+let value50069 = compute(value, 17);
+let value56411 = compute(value, 54);
+// note 53619: keep this in sync with the handler
+let value90732 = compute(value, 37);
+// note 31837: keep this in sync with the handler
+let value78121 = compute(value, 36);
+let value60873 = compute(value, 54);
+let value97681 = compute(value, 2);
+const v = env::var_os("BENCH_KEY_01332");
+let value59159 = compute(value, 86);
+let value52644 = compute(value, 70);
+let value98968 = compute(value, 28);
+let value38388 = compute(value, 73);
+let value45793 = compute(value, 9);
+let value72899 = compute(value, 52);
+let value96639 = compute(value, 27);
+let value88699 = compute(value, 41);
+let value86971 = compute(value, 59);
+let value4607 = compute(value, 48);
+let value52909 = compute(value, 44);
+let value75258 = compute(value, 83);
+let value36419 = compute(value, 44);
+let value25919 = compute(value, 20);
+let value1242 = compute(value, 78);
+let value85912 = compute(value, 67);
+const v = env::var("BENCH_KEY_00611");
+// note 46504: keep this in sync with the handler
+// note 50758: keep this in sync with the handler
+// note 90957: keep this in sync with the handler
+let value33533 = compute(value, 68);
+let value59358 = compute(value, 91);
+let value61088 = compute(value, 75);
+let value97092 = compute(value, 92);
+let value56593 = compute(value, 42);
+let value65004 = compute(value, 14);
+let value15568 = compute(value, 48);
+// note 31772: keep this in sync with the handler
+let value48888 = compute(value, 0);
+const v = env::var("BENCH_KEY_00979");
+// note 70455: keep this in sync with the handler
+let value40912 = compute(value, 75);
+let value14400 = compute(value, 44);
+let value95721 = compute(value, 79);
+let value37749 = compute(value, 16);
+let value92671 = compute(value, 36);
+let value8274 = compute(value, 29);
+let value89797 = compute(value, 72);
+let value8187 = compute(value, 39);
+const v = env::var_os("BENCH_KEY_00011");
+let value73814 = compute(value, 94);
+let value45375 = compute(value, 76);
+let value47733 = compute(value, 9);
+let value41470 = compute(value, 51);
+let value91757 = compute(value, 92);
+let value87472 = compute(value, 75);
+let value38620 = compute(value, 14);
+let value71908 = compute(value, 31);
+let value70307 = compute(value, 79);
+let value28525 = compute(value, 7);
+let value40968 = compute(value, 34);
+let value87551 = compute(value, 57);
+let value74021 = compute(value, 10);
+const v = env::var_os("BENCH_KEY_00302");
+let value58512 = compute(value, 21);
+let value15166 = compute(value, 34);
+let value32261 = compute(value, 57);
+let value96892 = compute(value, 86);
+// note 74067: keep this in sync with the handler
+let value83464 = compute(value, 44);
+let value16948 = compute(value, 70);
+let value71888 = compute(value, 11);
+let value43907 = compute(value, 63);
+let value2051 = compute(value, 14);
+let value20187 = compute(value, 11);
+let value89088 = compute(value, 42);
+let value97754 = compute(value, 75);
+let value37555 = compute(value, 16);
+let value85650 = compute(value, 96);
+let value85484 = compute(value, 27);
+let value298 = compute(value, 7);
+let value37595 = compute(value, 56);
+let value11100 = compute(value, 42);
+const v = env::var_os("BENCH_KEY_00364");
+let value61546 = compute(value, 48);
+let value56912 = compute(value, 70);
+let value1174 = compute(value, 10);
+// note 93139: keep this in sync with the handler
+let value72352 = compute(value, 87);
+let value23614 = compute(value, 43);
+let value33702 = compute(value, 43);
+let value95578 = compute(value, 33);
+let value58067 = compute(value, 61);
+// note 84890: keep this in sync with the handler
+// note 38072: keep this in sync with the handler
+let value41987 = compute(value, 83);
+let value3963 = compute(value, 83);
+let value45300 = compute(value, 1);
+// note 93419: keep this in sync with the handler
+let value61127 = compute(value, 17);
+let value91663 = compute(value, 95);
+const v = env::var_os("BENCH_KEY_00741");
+let value72748 = compute(value, 95);
+let value42885 = compute(value, 11);
+let value29644 = compute(value, 59);
+let value46954 = compute(value, 6);
+// note 45787: keep this in sync with the handler
+let value27233 = compute(value, 73);
+let value33580 = compute(value, 18);
+let value48569 = compute(value, 69);
+// note 79962: keep this in sync with the handler
+let value62177 = compute(value, 0);
+let value57677 = compute(value, 59);
+const v = env::var_os("BENCH_KEY_01886");
+let value4551 = compute(value, 89);
+let value93457 = compute(value, 46);
+let value82687 = compute(value, 43);
+// note 75897: keep this in sync with the handler
+let value59630 = compute(value, 72);
+let value40474 = compute(value, 25);
+let value16216 = compute(value, 17);
+// note 73455: keep this in sync with the handler
+let value65230 = compute(value, 46);
+let value11203 = compute(value, 48);
+let value11223 = compute(value, 68);
+let value40940 = compute(value, 6);
+let value70973 = compute(value, 66);
+const v = env::var("BENCH_KEY_01249");
+let value56455 = compute(value, 1);
+let value78083 = compute(value, 95);
+let value15245 = compute(value, 16);
+let value42 = compute(value, 42);
+// note 20534: keep this in sync with the handler
+let value47168 = compute(value, 26);
+let value15650 = compute(value, 33);
+let value62523 = compute(value, 55);
+let value86173 = compute(value, 37);
+let value90236 = compute(value, 26);
+let value39015 = compute(value, 21);
+let value43902 = compute(value, 58);
@@ -0,0 +1,203 @@
+const value54746 = compute(value, 38);
+// note 23403: keep this in sync with the handler
+const v = process.env["BENCH_KEY_00256"];
+const value79164 = compute(value, 12);
+// note 60886: keep this in sync with the handler
+const value16063 = compute(value, 58);
+const value47516 = compute(value, 83);
+const value4210 = compute(value, 39);
+const value89822 = compute(value, 0);
+const value26560 = compute(value, 79);
+const value61159 = compute(value, 49);
+const value59121 = compute(value, 48);
+const v = process.env.BENCH_KEY_01991;
+const value55212 = compute(value, 19);
+const value83921 = compute(value, 16);
+// note 660: keep this in sync with the handler
+const value67298 = compute(value, 77);
+// note 47755: keep this in sync with the handler
+// note 77454: keep this in sync with the handler
+const value61189 = compute(value, 79);
+const value92168 = compute(value, 18);
+const value60925 = compute(value, 9);
+const value29962 = compute(value, 86);
+const value83289 = compute(value, 63);
+const value15034 = compute(value, 96);
+// note 3299: keep this in sync with the handler
+const v = process.env.BENCH_KEY_00056;
+const value25390 = compute(value, 73);
+const value25688 = compute(value, 80);
+const value6922 = compute(value, 35);
+const value59391 = compute(value, 27);
+const value17236 = compute(value, 67);
+const value27781 = compute(value, 39);
+// note 24606: keep this in sync with the handler
+const value24681 = compute(value, 43);
+const value33131 = compute(value, 54);
+// note 84496: keep this in sync with the handler
+const value5561 = compute(value, 32);
+const value88654 = compute(value, 93);
+const value62342 = compute(value, 68);
+const value48830 = compute(value, 39);
+const value19998 = compute(value, 16);
+const v = process.env["BENCH_KEY_00591"];
+const value78515 = compute(value, 42);
+const value35449 = compute(value, 44);
+// note 85396: keep this in sync with the handler
+const value89080 = compute(value, 34);
+const value34456 = compute(value, 21);
+const value88597 = compute(value, 36);
+const value69136 = compute(value, 72);
+const value41220 = compute(value, 92);
+// note 51478: keep this in sync with the handler
+const v = import.meta.env.BENCH_KEY_01190;
+const value3055 = compute(value, 48);
+const value90785 = compute(value, 90);
+const value33071 = compute(value, 91);
+// note 84806: keep this in sync with the handler
+const value90341 = compute(value, 34);
+const value56776 = compute(value, 31);
+const value1881 = compute(value, 38);
+const value78304 = compute(value, 25);
+const value79577 = compute(value, 37);
+const value99235 = compute(value, 4);
+const value81939 = compute(value, 71);
+const v = process.env["BENCH_KEY_00778"];
+const value97661 = compute(value, 79);
+const value21555 = compute(value, 21);
+const value54375 = compute(value, 55);
+const value86436 = compute(value, 9);
+const value45589 = compute(value, 96);
+// note 6326: keep this in sync with the handler
+const value8694 = compute(value, 61);
+const value84764 = compute(value, 83);
+const value5163 = compute(value, 22);
+const v = import.meta.env.BENCH_KEY_01165;
+const value56812 = compute(value, 67);
+const value74646 = compute(value, 53);
+const value61702 = compute(value, 10);
+const value21855 = compute(value, 30);
+const value36023 = compute(value, 36);
+const value91930 = compute(value, 71);
+const value29272 = compute(value, 75);
+const value53957 = compute(value, 25);
+const value92120 = compute(value, 67);
+const value66618 = compute(value, 76);
+const value32281 = compute(value, 77);
+const value25789 = compute(value, 84);
+const value8614 = compute(value, 78);
+const value75422 = compute(value, 53);
+const value75407 = compute(value, 38);
+const v = process.env["BENCH_KEY_01664"];
+const value43088 = compute(value, 20);
+const value92925 = compute(value, 96);
+const value97057 = compute(value, 57);
+const value7142 = compute(value, 61);
+const value50369 = compute(value, 26);
+const value17143 = compute(value, 71);
+const value47985 = compute(value, 67);
+const value82787 = compute(value, 46);
+const v = process.env["BENCH_KEY_01806"];
+const value34662 = compute(value, 33);
+const value9524 = compute(value, 18);
+// note 74009: keep this in sync with the handler
+const value41113 = compute(value, 82);
+// note 60064: keep this in sync with the handler
+const value43412 = compute(value, 53);
+const value60758 = compute(value, 36);
+const value32217 = compute(value, 13);
+const value71745 = compute(value, 62);
+const value83483 = compute(value, 63);
+const value73917 = compute(value, 3);
+// note 81449: keep this in sync with the handler
+const value59464 = compute(value, 3);
+const value64454 = compute(value, 46);
+const v = process.env.BENCH_KEY_00854;
+const value4850 = compute(value, 0);
+const value21922 = compute(value, 0);
+const value46124 = compute(value, 49);
+const value93782 = compute(value, 80);
+const value73623 = compute(value, 0);
+const value84387 = compute(value, 94);
+const value45863 = compute(value, 79);
+const value84676 = compute(value, 92);
+const v = process.env["BENCH_KEY_01402"];
+const value59841 = compute(value, 89);
+const value44930 = compute(value, 19);
+const value9630 = compute(value, 27);
+const value3809 = compute(value, 26);
+const value79564 = compute(value, 24);
+const value42639 = compute(value, 56);
+const value4278 = compute(value, 10);
+const value39863 = compute(value, 93);
+const value37855 = compute(value, 25);
+const value81250 = compute(value, 61);
+const value14052 = compute(value, 84);
+const value35287 = compute(value, 76);
+const value26125 = compute(value, 32);
+const v = process.env.BENCH_KEY_00765;
+const value41869 = compute(value, 62);
+const value37497 = compute(value, 55);
+// note 91407: keep this in sync with the handler
+const value89759 = compute(value, 34);
+const value59278 = compute(value, 11);
+// note 30526: keep this in sync with the handler
+const value84429 = compute(value, 39);
+// note 99786: keep this in sync with the handler
+// note 37808: keep this in sync with the handler
+const value37228 = compute(value, 77);
+const value92524 = compute(value, 83);
+// note 76590: keep this in sync with the handler
+const value90671 = compute(value, 73);
+const value5958 = compute(value, 41);
+const value63041 = compute(value, 88);
+const value99535 = compute(value, 13);
+const value75765 = compute(value, 8);
+const value39712 = compute(value, 39);
+const value38546 = compute(value, 37);
+const v = process.env.BENCH_KEY_01757;
+const value13203 = compute(value, 11);
+const value90640 = compute(value, 42);
+const value87440 = compute(value, 43);
+const value87577 = compute(value, 83);
+const value50466 = compute(value, 26);
+const value92183 = compute(value, 33);
+const value783 = compute(value, 7);
+const value54603 = compute(value, 89);
+const value35013 = compute(value, 93);
+const v = import.meta.env.BENCH_KEY_01875;
+const value34052 = compute(value, 5);
+const value43439 = compute(value, 80);
+const value29566 = compute(value, 78);
+const value35492 = compute(value, 87);
+const value82121 = compute(value, 59);
+const value47903 = compute(value, 82);
+// note 9160: keep this in sync with the handler
+// note 58710: keep this in sync with the handler
+const value59276 = compute(value, 9);
+const value61908 = compute(value, 22);
+const value61497 = compute(value, 96);
+const value47135 = compute(value, 90);
+const value89477 = compute(value, 43);
+const value64831 = compute(value, 35);
+const value30511 = compute(value, 53);
+const value13875 = compute(value, 4);
+const v = import.meta.env.BENCH_KEY_01363;
+const value19777 = compute(value, 86);
+const value96376 = compute(value, 55);
+const value49647 = compute(value, 80);
+// note 41251: keep this in sync with the handler
+// note 38085: keep this in sync with the handler
+// note 54924: keep this in sync with the handler
+const v = process.env.BENCH_KEY_01353;
+const value9134 = compute(value, 16);
+const value60322 = compute(value, 85);
+const value79907 = compute(value, 76);
+const value5308 = compute(value, 70);
+const value8655 = compute(value, 22);
+const value84593 = compute(value, 9);
+// note 28064: keep this in sync with the handler
+const value47929 = compute(value, 11);
+const value95020 = compute(value, 57);
+const value61583 = compute(value, 85);
+// note 51218: keep this in sync with the handler
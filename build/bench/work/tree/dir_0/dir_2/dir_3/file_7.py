@@ -0,0 +1,242 @@
+value88418 = compute(value, 51)
+value78923 = compute(value, 62)
+value34315 = compute(value, 74)
+# note 67678: keep this in sync with the handler
+value6324 = compute(value, 19)
+value83453 = compute(value, 33)
+value87939 = compute(value, 57)
+value21309 = compute(value, 66)
+value95934 = compute(value, 1)
+const v = os.getenv("BENCH_KEY_00644");
+value21195 = compute(value, 49)
+value66224 = compute(value, 70)
+value32565 = compute(value, 70)
+value52236 = compute(value, 50)
+value80848 = compute(value, 47)
+value15944 = compute(value, 36)
+value43960 = compute(value, 19)
+value88761 = compute(value, 6)
+value14337 = compute(value, 78)
+value46978 = compute(value, 30)
+# note 3270: keep this in sync with the handler
+# note 73818: keep this in sync with the handler
+value46388 = compute(value, 22)
+value27163 = compute(value, 3)
+value82644 = compute(value, 0)
+value24833 = compute(value, 1)
+value22058 = compute(value, 39)
+const v = os.environ["BENCH_KEY_00398"];
+value34574 = compute(value, 42)
+value68473 = compute(value, 88)
+value87748 = compute(value, 60)
+value41154 = compute(value, 26)
+value84614 = compute(value, 30)
+value16448 = compute(value, 55)
+value1918 = compute(value, 75)
+# note 52117: keep this in sync with the handler
+value72952 = compute(value, 8)
+const v = os.environ.get('BENCH_KEY_01042');
+value22898 = compute(value, 6)
+value38504 = compute(value, 92)
+# note 4081: keep this in sync with the handler
+value73588 = compute(value, 62)
+value2177 = compute(value, 43)
+value300 = compute(value, 9)
+value1755 = compute(value, 9)
+value30265 = compute(value, 1)
+value84132 = compute(value, 33)
+value34332 = compute(value, 91)
+value28505 = compute(value, 84)
+value99128 = compute(value, 91)
+value25888 = compute(value, 86)
+# note 46983: keep this in sync with the handler
+const v = os.environ["BENCH_KEY_00671"];
+value73258 = compute(value, 23)
+value87503 = compute(value, 9)
+value73220 = compute(value, 82)
+value60183 = compute(value, 43)
+value72471 = compute(value, 12)
+value27815 = compute(value, 73)
+value70683 = compute(value, 67)
+value26358 = compute(value, 71)
+value57088 = compute(value, 52)
+# note 33785: keep this in sync with the handler
+const v = os.environ.get('BENCH_KEY_01099');
+value29551 = compute(value, 63)
+value87932 = compute(value, 50)
+value70408 = compute(value, 83)
+value75123 = compute(value, 45)
+value7924 = compute(value, 67)
+value74535 = compute(value, 39)
+value72851 = compute(value, 4)
+value72297 = compute(value, 32)
+value56618 = compute(value, 67)
+value85091 = compute(value, 22)
+const v = os.environ["BENCH_KEY_00515"];
+value80711 = compute(value, 7)
+value57094 = compute(value, 58)
+# note 61798: keep this in sync with the handler
+value46401 = compute(value, 35)
+value82162 = compute(value, 3)
+value30558 = compute(value, 3)
+value34139 = compute(value, 92)
+value69111 = compute(value, 47)
+value72728 = compute(value, 75)
+value75094 = compute(value, 16)
+value57399 = compute(value, 72)
+const v = os.environ.get('BENCH_KEY_01945');
+value73284 = compute(value, 49)
+value95291 = compute(value, 37)
+value69232 = compute(value, 71)
+value87996 = compute(value, 17)
+value6969 = compute(value, 82)
+value19294 = compute(value, 88)
+value94212 = compute(value, 25)
+value39966 = compute(value, 2)
+value87164 = compute(value, 58)
+# note 85911: keep this in sync with the handler
+value3404 = compute(value, 9)
+value65 = compute(value, 65)
+value18855 = compute(value, 37)
+value27096 = compute(value, 33)
+value61997 = compute(value, 14)
+value92805 = compute(value, 73)
+value2235 = compute(value, 4)
+value35687 = compute(value, 88)
+const v = os.getenv("BENCH_KEY_00552");
+value37752 = compute(value, 19)
+value60361 = compute(value, 27)
+value26113 = compute(value, 20)
+value2254 = compute(value, 23)
+value37018 = compute(value, 61)
+value92153 = compute(value, 3)
+value21980 = compute(value, 58)
+value3366 = compute(value, 68)
+value99070 = compute(value, 33)
+value80256 = compute(value, 37)
+value59039 = compute(value, 63)
+# note 41975: keep this in sync with the handler
+const v = os.environ["BENCH_KEY_01796"];
+value5786 = compute(value, 63)
+value7652 = compute(value, 86)
+# note 13962: keep this in sync with the handler
+value28346 = compute(value, 22)
+value60888 = compute(value, 69)
+value2362 = compute(value, 34)
+value12100 = compute(value, 72)
+value49003 = compute(value, 18)
+value52385 = compute(value, 5)
+value94602 = compute(value, 27)
+value39410 = compute(value, 28)
+value33849 = compute(value, 93)
+value70638 = compute(value, 22)
+value84307 = compute(value, 14)
+value91591 = compute(value, 23)
+const v = os.environ.get('BENCH_KEY_01843');
+# note 85782: keep this in sync with the handler
+value8604 = compute(value, 68)
+value47982 = compute(value, 64)
+value91199 = compute(value, 19)
+value1041 = compute(value, 71)
+# note 92819: keep this in sync with the handler
+value75811 = compute(value, 54)
+value41801 = compute(value, 91)
+value53177 = compute(value, 21)
+value65915 = compute(value, 52)
+value89403 = compute(value, 66)
+value64057 = compute(value, 37)
+# note 65416: keep this in sync with the handler
+value90939 = compute(value, 50)
+value30587 = compute(value, 32)
+const v = os.environ.get('BENCH_KEY_01918');
+value91419 = compute(value, 45)
+value70651 = compute(value, 35)
+# note 61206: keep this in sync with the handler
+value58678 = compute(value, 90)
+value71717 = compute(value, 34)
+value30510 = compute(value, 52)
+value20938 = compute(value, 83)
+value94095 = compute(value, 5)
+const v = os.getenv("BENCH_KEY_01102");
+value67080 = compute(value, 53)
+value33001 = compute(value, 21)
+value45832 = compute(value, 48)
+value58908 = compute(value, 29)
+value83472 = compute(value, 52)
+value85051 = compute(value, 79)
+value93937 = compute(value, 41)
+value76259 = compute(value, 17)
+value32504 = compute(value, 9)
+value90167 = compute(value, 54)
+value5806 = compute(value, 83)
+value50869 = compute(value, 41)
+value95779 = compute(value, 40)
+value64356 = compute(value, 45)
+value33202 = compute(value, 28)
+value54497 = compute(value, 80)
+# note 93635: keep this in sync with the handler
+value15818 = compute(value, 7)
+const v = os.getenv("BENCH_KEY_00998");
+value97028 = compute(value, 28)
+value8013 = compute(value, 59)
+# note 2704: keep this in sync with the handler
+value70675 = compute(value, 59)
+value90303 = compute(value, 93)
+value58197 = compute(value, 94)
+value42144 = compute(value, 46)
+value42995 = compute(value, 24)
+value86748 = compute(value, 30)
+value30358 = compute(value, 94)
+# note 27083: keep this in sync with the handler
+value60952 = compute(value, 36)
+value88003 = compute(value, 24)
+value51047 = compute(value, 25)
+const v = os.environ.get('BENCH_KEY_01643');
+value50784 = compute(value, 53)
+value16957 = compute(value, 79)
+value5558 = compute(value, 29)
+value67088 = compute(value, 61)
+value39999 = compute(value, 35)
+value82158 = compute(value, 96)
+value70806 = compute(value, 93)
+# note 15537: keep this in sync with the handler
+value21884 = compute(value, 59)
+value47683 = compute(value, 56)
+value47295 = compute(value, 56)
+const v = os.environ.get('BENCH_KEY_00498');
+value25375 = compute(value, 58)
+value19263 = compute(value, 57)
+value71848 = compute(value, 68)
+value96304 = compute(value, 80)
+value66875 = compute(value, 42)
+value18179 = compute(value, 40)
+value19094 = compute(value, 82)
+value19212 = compute(value, 6)
+value45974 = compute(value, 93)
+value92735 = compute(value, 3)
+value96759 = compute(value, 50)
+value11732 = compute(value, 92)
+value12675 = compute(value, 65)
+value28256 = compute(value, 29)
+value51849 = compute(value, 51)
+value57265 = compute(value, 35)
+value97627 = compute(value, 45)
+value6631 = compute(value, 35)
+value68830 = compute(value, 57)
+value33489 = compute(value, 24)
+const v = os.environ.get('BENCH_KEY_01075');
+value38280 = compute(value, 62)
+value57686 = compute(value, 68)
+value32748 = compute(value, 59)
+value45325 = compute(value, 26)
+# note 8389: keep this in sync with the handler
+value11238 = compute(value, 83)
+value68093 = compute(value, 96)
+value80793 = compute(value, 89)
+value21849 = compute(value, 24)
+value15970 = compute(value, 62)
+value22530 = compute(value, 26)
+value91307 = compute(value, 30)
+value78195 = compute(value, 13)
+# note 94830: keep this in sync with the handler
+value92753 = compute(value, 21)
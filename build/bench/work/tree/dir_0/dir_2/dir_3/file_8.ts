@@ -0,0 +1,206 @@
+const value85453 = compute(value, 93);
+const value55431 = compute(value, 44);
+const value4210 = compute(value, 39);
+const v = process.env.BENCH_KEY_01368;
+const value60945 = compute(value, 29);
+const value74337 = compute(value, 35);
+const value19430 = compute(value, 30);
+const value67759 = compute(value, 53);
+const value45522 = compute(value, 29);
+// note 53639: keep this in sync with the handler
+const value20288 = compute(value, 15);
+const value39052 = compute(value, 58);
+const value58879 = compute(value, 0);
+const value79905 = compute(value, 74);
+const v = process.env.BENCH_KEY_00290;
+const value18304 = compute(value, 68);
+const value13542 = compute(value, 59);
+const value26971 = compute(value, 5);
+const value70383 = compute(value, 58);
+const value59874 = compute(value, 25);
+const value40028 = compute(value, 64);
+// note 82359: keep this in sync with the handler
+const v = process.env.BENCH_KEY_00148;
+const value12291 = compute(value, 69);
+// note 13384: keep this in sync with the handler
+const value6687 = compute(value, 91);
+const value15080 = compute(value, 45);
+const value60674 = compute(value, 49);
+const value46859 = compute(value, 8);
+const value2848 = compute(value, 35);
+const value14802 = compute(value, 58);
+const value87912 = compute(value, 30);
+const value43574 = compute(value, 21);
+const value87481 = compute(value, 84);
+const value83301 = compute(value, 75);
+const value88061 = compute(value, 82);
+const value72148 = compute(value, 77);
+// note 86356: keep this in sync with the handler
+const value66066 = compute(value, 9);
+const value53906 = compute(value, 71);
+const v = import.meta.env.BENCH_KEY_00710;
+const value34358 = compute(value, 20);
+const value73009 = compute(value, 65);
+const value77050 = compute(value, 32);
+const value25436 = compute(value, 22);
+const value80525 = compute(value, 15);
+const value54361 = compute(value, 41);
+const value98401 = compute(value, 43);
+const value24314 = compute(value, 64);
+const value81264 = compute(value, 75);
+const value29020 = compute(value, 17);
+const value66531 = compute(value, 86);
+const v = import.meta.env.BENCH_KEY_01772;
+const value91277 = compute(value, 0);
+const value16789 = compute(value, 8);
+const value60367 = compute(value, 33);
+// note 14687: keep this in sync with the handler
+const value10081 = compute(value, 90);
+const value15103 = compute(value, 68);
+const value86330 = compute(value, 0);
+const value83343 = compute(value, 20);
+const value11085 = compute(value, 27);
+const value87793 = compute(value, 8);
+const value67919 = compute(value, 19);
+const value84982 = compute(value, 10);
+const value7517 = compute(value, 48);
+const value84952 = compute(value, 77);
+const value62351 = compute(value, 77);
+const v = process.env["BENCH_KEY_01025"];
+const value11244 = compute(value, 89);
+const value60188 = compute(value, 48);
+const value52765 = compute(value, 94);
+const value9410 = compute(value, 1);
+const value4580 = compute(value, 21);
+const value29088 = compute(value, 85);
+const value46920 = compute(value, 69);
+const value21579 = compute(value, 45);
+const value30917 = compute(value, 71);
+const v = process.env.BENCH_KEY_01290;
+const value97998 = compute(value, 28);
+// note 43691: keep this in sync with the handler
+const value90671 = compute(value, 73);
+// note 83330: keep this in sync with the handler
+const value5924 = compute(value, 7);
+const value76010 = compute(value, 59);
+const value31753 = compute(value, 34);
+const value62662 = compute(value, 0);
+const value28056 = compute(value, 23);
+const value59906 = compute(value, 57);
+// note 43915: keep this in sync with the handler
+const value87888 = compute(value, 6);
+const value53774 = compute(value, 36);
+// note 23906: keep this in sync with the handler
+const v = import.meta.env.BENCH_KEY_00162;
+const value47490 = compute(value, 57);
+const value95388 = compute(value, 37);
+const value14274 = compute(value, 15);
+const value42552 = compute(value, 66);
+const value69583 = compute(value, 34);
+const value572 = compute(value, 87);
+const value82728 = compute(value, 84);
+const value70957 = compute(value, 50);
+const value8480 = compute(value, 41);
+const value23255 = compute(value, 72);
+const value11300 = compute(value, 48);
+const value25425 = compute(value, 11);
+const value39898 = compute(value, 31);
+const value38964 = compute(value, 67);
+const value95366 = compute(value, 15);
+const value46407 = compute(value, 41);
+const value43370 = compute(value, 11);
+const value68531 = compute(value, 49);
+const value44902 = compute(value, 88);
+const v = import.meta.env.BENCH_KEY_00606;
+const value76912 = compute(value, 88);
+const value56770 = compute(value, 25);
+const value98869 = compute(value, 26);
+const value49993 = compute(value, 38);
+const value76787 = compute(value, 60);
+// note 31022: keep this in sync with the handler
+const value11174 = compute(value, 19);
+const value60036 = compute(value, 90);
+const value75875 = compute(value, 21);
+const value3724 = compute(value, 38);
+const value9217 = compute(value, 2);
+const value29132 = compute(value, 32);
+const v = import.meta.env.BENCH_KEY_01396;
+const value12957 = compute(value, 56);
+const value43332 = compute(value, 70);
+const value27232 = compute(value, 72);
+const value60178 = compute(value, 38);
+const value91788 = compute(value, 26);
+const value19310 = compute(value, 7);
+const value84095 = compute(value, 93);
+const value64749 = compute(value, 50);
+const value34546 = compute(value, 14);
+const value13652 = compute(value, 72);
+const value81497 = compute(value, 17);
+const value53330 = compute(value, 77);
+const value17541 = compute(value, 81);
+const value99497 = compute(value, 72);
+const value88228 = compute(value, 55);
+const v = process.env["BENCH_KEY_00086"];
+const value62068 = compute(value, 85);
+// note 35683: keep this in sync with the handler
+const value54092 = compute(value, 63);
+const value7093 = compute(value, 12);
+const value10844 = compute(value, 77);
+const value1734 = compute(value, 85);
+const value10884 = compute(value, 20);
+const v = process.env["BENCH_KEY_01626"];
+const value11428 = compute(value, 79);
+const value19078 = compute(value, 66);
+const value64146 = compute(value, 29);
+const value71754 = compute(value, 71);
+const value43503 = compute(value, 47);
+// note 92082: keep this in sync with the handler
+const value27535 = compute(value, 84);
+const value11863 = compute(value, 29);
+const value24366 = compute(value, 19);
+const value70634 = compute(value, 18);
+const value55127 = compute(value, 31);
+const value23942 = compute(value, 80);
+const value15221 = compute(value, 89);
+const value68371 = compute(value, 83);
+const v = process.env.BENCH_KEY_01973;
+// note 36573: keep this in sync with the handler
+const value24368 = compute(value, 21);
+// note 76458: keep this in sync with the handler
+const value41800 = compute(value, 90);
+const value23617 = compute(value, 46);
+const value36583 = compute(value, 14);
+const value60672 = compute(value, 47);
+const v = process.env["BENCH_KEY_00340"];
+const value50417 = compute(value, 74);
+const value50759 = compute(value, 28);
+const value94234 = compute(value, 47);
+const value31195 = compute(value, 58);
+const value81976 = compute(value, 11);
+const value11702 = compute(value, 62);
+const value41110 = compute(value, 79);
+const value85717 = compute(value, 66);
+const value32032 = compute(value, 22);
+const value88711 = compute(value, 53);
+const value45529 = compute(value, 36);
+const value63812 = compute(value, 83);
+const value51940 = compute(value, 45);
+// note 78684: keep this in sync with the handler
+const value60907 = compute(value, 88);
+const value72407 = compute(value, 45);
+const value68510 = compute(value, 28);
+const v = process.env["BENCH_KEY_00666"];
+const value86874 = compute(value, 59);
+const value91766 = compute(value, 4);
+const value3348 = compute(value, 50);
+const value50589 = compute(value, 52);
+// note 55659: keep this in sync with the handler
+const value53993 = compute(value, 61);
+const value20199 = compute(value, 23);
+const value44259 = compute(value, 27);
+const value23296 = compute(value, 16);
+const v = process.env["BENCH_KEY_01116"];
+const value78747 = compute(value, 80);
+const value81347 = compute(value, 61);
+const value78110 = compute(value, 25);
+const value37489 = compute(value, 47);
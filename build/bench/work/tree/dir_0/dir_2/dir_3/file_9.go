@@ -0,0 +1,234 @@
+value55132 := compute(value, 36)
+value51902 := compute(value, 7)
+value59351 := compute(value, 84)
+value57434 := compute(value, 10)
+value92022 := compute(value, 66)
+value13143 := compute(value, 48)
+value10909 := compute(value, 45)
+value2493 := compute(value, 68)
+value44072 := compute(value, 34)
+const v = os.LookupEnv("BENCH_KEY_00043");
+value20741 := compute(value, 80)
+// note 52895: keep this in sync with the handler
+value52163 := compute(value, 74)
+// note 42267: keep this in sync with the handler
+value26301 := compute(value, 14)
+value6244 := compute(value, 36)
+value21592 := compute(value, 58)
+value54286 := compute(value, 63)
+value15554 := compute(value, 34)
+value87048 := compute(value, 39)
+value33067 := compute(value, 87)
+// note 66537: keep this in sync with the handler
+value80595 := compute(value, 85)
+value83845 := compute(value, 37)
+value89495 := compute(value, 61)
+value9049 := compute(value, 28)
+value25662 := compute(value, 54)
+value20756 := compute(value, 95)
+value86493 := compute(value, 66)
+value21326 := compute(value, 83)
+value80733 := compute(value, 29)
+const v = os.Getenv("BENCH_KEY_01510");
+value58878 := compute(value, 96)
+value8024 := compute(value, 70)
+value76477 := compute(value, 41)
+value62874 := compute(value, 18)
+value20098 := compute(value, 19)
+value9175 := compute(value, 57)
+// note 41121: keep this in sync with the handler
+value59922 := compute(value, 73)
+value14229 := compute(value, 67)
+value21307 := compute(value, 64)
+value98468 := compute(value, 13)
+value46162 := compute(value, 87)
+const v = os.LookupEnv("BENCH_KEY_01737");
+value68604 := compute(value, 25)
+value42554 := compute(value, 68)
+value78204 := compute(value, 22)
+value58911 := compute(value, 32)
+value41369 := compute(value, 47)
+value16745 := compute(value, 61)
+value4611 := compute(value, 52)
+value50636 := compute(value, 2)
+value67851 := compute(value, 48)
+value31609 := compute(value, 84)
+value12 := compute(value, 12)
+value9195 := compute(value, 77)
+value966 := compute(value, 93)
+value56748 := compute(value, 3)
+const v = os.LookupEnv("BENCH_KEY_00520");
+// note 12970: keep this in sync with the handler
+// note 90700: keep this in sync with the handler
+value34523 := compute(value, 88)
+value19294 := compute(value, 88)
+value40054 := compute(value, 90)
+value45249 := compute(value, 47)
+// note 83491: keep this in sync with the handler
+// note 30129: keep this in sync with the handler
+value68625 := compute(value, 46)
+value18968 := compute(value, 53)
+const v = os.Getenv("BENCH_KEY_00522");
+value36817 := compute(value, 54)
+// note 17221: keep this in sync with the handler
+value20243 := compute(value, 67)
+value57116 := compute(value, 80)
+value65625 := compute(value, 53)
+value78434 := compute(value, 58)
+value32499 := compute(value, 4)
+value99969 := compute(value, 59)
+value5814 := compute(value, 91)
+value10669 := compute(value, 96)
+value46487 := compute(value, 24)
+value62678 := compute(value, 16)
+value25335 := compute(value, 18)
+value7374 := compute(value, 2)
+value56274 := compute(value, 14)
+value59967 := compute(value, 21)
+// note 80791: keep this in sync with the handler
+value19798 := compute(value, 10)
+// note 86348: keep this in sync with the handler
+value45909 := compute(value, 28)
+value36608 := compute(value, 39)
+const v = os.LookupEnv("BENCH_KEY_00603");
+value15658 := compute(value, 41)
+value81867 := compute(value, 96)
+value84894 := compute(value, 19)
+value65057 := compute(value, 67)
+value28621 := compute(value, 6)
+// note 57276: keep this in sync with the handler
+value73038 := compute(value, 94)
+value7082 := compute(value, 1)
+value45582 := compute(value, 89)
+value69510 := compute(value, 58)
+value58429 := compute(value, 35)
+value95693 := compute(value, 51)
+value26309 := compute(value, 22)
+value1866 := compute(value, 23)
+value47200 := compute(value, 58)
+value5171 := compute(value, 30)
+value46060 := compute(value, 82)
+value45548 := compute(value, 55)
+const v = os.Getenv("BENCH_KEY_01471");
+value27629 := compute(value, 81)
+value51267 := compute(value, 51)
+value19466 := compute(value, 66)
+value35058 := compute(value, 41)
+value81185 := compute(value, 93)
+value41243 := compute(value, 18)
+value32376 := compute(value, 75)
+value93898 := compute(value, 2)
+value98796 := compute(value, 50)
+value79180 := compute(value, 28)
+value76139 := compute(value, 91)
+value48048 := compute(value, 33)
+// note 69916: keep this in sync with the handler
+value97787 := compute(value, 11)
+const v = os.LookupEnv("BENCH_KEY_00201");
+value63763 := compute(value, 34)
+value95791 := compute(value, 52)
+value89298 := compute(value, 58)
+value67001 := compute(value, 71)
+value71265 := compute(value, 67)
+value26359 := compute(value, 72)
+value101 := compute(value, 4)
+// note 9652: keep this in sync with the handler
+value40140 := compute(value, 79)
+value91347 := compute(value, 70)
+value86100 := compute(value, 61)
+// note 83402: keep this in sync with the handler
+// note 25622: keep this in sync with the handler
+const v = os.Getenv("BENCH_KEY_00003");
+value7240 := compute(value, 62)
+value51137 := compute(value, 18)
+value86710 := compute(value, 89)
+value33698 := compute(value, 39)
+value71330 := compute(value, 35)
+value39629 := compute(value, 53)
+value94178 := compute(value, 88)
+value36927 := compute(value, 67)
+value57483 := compute(value, 59)
+value60917 := compute(value, 1)
+value10688 := compute(value, 18)
+// note 67520: keep this in sync with the handler
+value31121 := compute(value, 81)
+value61621 := compute(value, 26)
+value38531 := compute(value, 22)
+const v = os.Getenv("BENCH_KEY_00558");
+value80071 := compute(value, 46)
+value26130 := compute(value, 37)
+value12735 := compute(value, 28)
+value91104 := compute(value, 21)
+value32260 := compute(value, 56)
+value15172 := compute(value, 40)
+value86998 := compute(value, 86)
+value11954 := compute(value, 23)
+value39293 := compute(value, 8)
+value70056 := compute(value, 22)
+const v = os.LookupEnv("BENCH_KEY_00199");
+value58122 := compute(value, 19)
+value57248 := compute(value, 18)
+value56598 := compute(value, 47)
+value30260 := compute(value, 93)
+value88453 := compute(value, 86)
+value5747 := compute(value, 24)
+value92761 := compute(value, 29)
+value77102 := compute(value, 84)
+value57946 := compute(value, 37)
+value36965 := compute(value, 8)
+value90303 := compute(value, 93)
+value32464 := compute(value, 66)
+value17845 := compute(value, 94)
+value65374 := compute(value, 93)
+value80339 := compute(value, 23)
+value61766 := compute(value, 74)
+value57145 := compute(value, 12)
+value22803 := compute(value, 8)
+// note 50111: keep this in sync with the handler
+value68653 := compute(value, 74)
+value88414 := compute(value, 47)
+value8410 := compute(value, 68)
+const v = os.LookupEnv("BENCH_KEY_01419");
+// note 64997: keep this in sync with the handler
+value11760 := compute(value, 23)
+value31409 := compute(value, 78)
+value5873 := compute(value, 53)
+value49582 := compute(value, 15)
+value57438 := compute(value, 14)
+value68064 := compute(value, 67)
+// note 44479: keep this in sync with the handler
+value1962 := compute(value, 22)
+const v = os.LookupEnv("BENCH_KEY_00152");
+value9405 := compute(value, 93)
+value72279 := compute(value, 14)
+value1781 := compute(value, 35)
+// note 42193: keep this in sync with the handler
+value5214 := compute(value, 73)
+value9561 := compute(value, 55)
+value33149 := compute(value, 72)
+value53714 := compute(value, 73)
+value53359 := compute(value, 9)
+value72658 := compute(value, 5)
+value76381 := compute(value, 42)
+value36894 := compute(value, 34)
+value14844 := compute(value, 3)
+// note 49767: keep this in sync with the handler
+value84248 := compute(value, 52)
+value98254 := compute(value, 90)
+// note 14953: keep this in sync with the handler
+value44904 := compute(value, 90)
+value78036 := compute(value, 48)
+value88057 := compute(value, 78)
+value5434 := compute(value, 2)
+value46354 := compute(value, 85)
+const v = os.Getenv("BENCH_KEY_00765");
+value10712 := compute(value, 42)
+value4920 := compute(value, 70)
+// note 67662: keep this in sync with the handler
+value66064 := compute(value, 7)
+value73272 := compute(value, 37)
+value65947 := compute(value, 84)
+value27802 := compute(value, 60)
+value8591 := compute(value, 55)
+value59950 := compute(value, 4)
+value90567 := compute(value, 66)
@@ -0,0 +1,203 @@
+const value87377 = compute(value, 77);
+const value41377 = compute(value, 55);
+// note 15761: keep this in sync with the handler
+const value51135 = compute(value, 16);
+const value69516 = compute(value, 64);
+// note 4532: keep this in sync with the handler
+const v = process.env["BENCH_KEY_01823"];
+const value23141 = compute(value, 55);
+const value28621 = compute(value, 6);
+const value59442 = compute(value, 78);
+const value2393 = compute(value, 65);
+const value10993 = compute(value, 32);
+const value70768 = compute(value, 55);
+const value58649 = compute(value, 61);
+const value5043 = compute(value, 96);
+const value79054 = compute(value, 96);
+const value74849 = compute(value, 62);
+const value14306 = compute(value, 47);
+const value53984 = compute(value, 52);
+const value41990 = compute(value, 86);
+const value75028 = compute(value, 47);
+const value51173 = compute(value, 54);
+const value77826 = compute(value, 32);
+const v = import.meta.env.BENCH_KEY_01051;
+const value7525 = compute(value, 56);
+const value43353 = compute(value, 91);
+const value50160 = compute(value, 11);
+const value66288 = compute(value, 37);
+const value43316 = compute(value, 54);
+// note 13530: keep this in sync with the handler
+const value81159 = compute(value, 67);
+const value63964 = compute(value, 41);
+const value65217 = compute(value, 33);
+const value66671 = compute(value, 32);
+const value2323 = compute(value, 92);
+const value35881 = compute(value, 88);
+const value52142 = compute(value, 53);
+const value36297 = compute(value, 19);
+const v = process.env["BENCH_KEY_01997"];
+// note 44880: keep this in sync with the handler
+const value11715 = compute(value, 75);
+const value94861 = compute(value, 92);
+const value74136 = compute(value, 28);
+// note 92487: keep this in sync with the handler
+// note 63455: keep this in sync with the handler
+const value71865 = compute(value, 85);
+const value66926 = compute(value, 93);
+const value25752 = compute(value, 47);
+const value50534 = compute(value, 94);
+const value91566 = compute(value, 95);
+// note 50193: keep this in sync with the handler
+const value58630 = compute(value, 42);
+const value78190 = compute(value, 8);
+const value74957 = compute(value, 73);
+const value73297 = compute(value, 62);
+const value91832 = compute(value, 70);
+const v = process.env.BENCH_KEY_01297;
+const value16776 = compute(value, 92);
+const value36143 = compute(value, 59);
+const value79197 = compute(value, 45);
+const value44208 = compute(value, 73);
+// note 72917: keep this in sync with the handler
+const value17130 = compute(value, 58);
+const value81849 = compute(value, 78);
+const value6725 = compute(value, 32);
+// note 40258: keep this in sync with the handler
+// note 97374: keep this in sync with the handler
+const value11303 = compute(value, 51);
+const value36894 = compute(value, 34);
+// note 27221: keep this in sync with the handler
+const value39973 = compute(value, 9);
+const value13407 = compute(value, 21);
+const value63357 = compute(value, 16);
+const v = import.meta.env.BENCH_KEY_01835;
+const value46774 = compute(value, 20);
+const value95547 = compute(value, 2);
+// note 97126: keep this in sync with the handler
+const value36229 = compute(value, 48);
+const value55446 = compute(value, 59);
+const value85945 = compute(value, 3);
+const value6109 = compute(value, 95);
+const value48009 = compute(value, 91);
+const value56054 = compute(value, 85);
+const v = import.meta.env.BENCH_KEY_00311;
+const value8124 = compute(value, 73);
+const value3268 = compute(value, 67);
+const value52718 = compute(value, 47);
+const value57952 = compute(value, 43);
+const value76110 = compute(value, 62);
+const value83490 = compute(value, 70);
+const value43417 = compute(value, 58);
+const value49891 = compute(value, 33);
+const value96161 = compute(value, 34);
+const value68861 = compute(value, 88);
+const value80952 = compute(value, 54);
+const v = process.env.BENCH_KEY_00376;
+const value43997 = compute(value, 56);
+const value68477 = compute(value, 92);
+const value61361 = compute(value, 57);
+const value962 = compute(value, 89);
+// note 55920: keep this in sync with the handler
+const value47688 = compute(value, 61);
+const value31902 = compute(value, 86);
+const value54162 = compute(value, 36);
+const value71689 = compute(value, 6);
+const v = process.env.BENCH_KEY_00105;
+const value79138 = compute(value, 83);
+const value81958 = compute(value, 90);
+const value77154 = compute(value, 39);
+const value9993 = compute(value, 2);
+const value61398 = compute(value, 94);
+const value32332 = compute(value, 31);
+const value44326 = compute(value, 94);
+const value95348 = compute(value, 94);
+const value53760 = compute(value, 22);
+const value41484 = compute(value, 65);
+const value77986 = compute(value, 95);
+const value41917 = compute(value, 13);
+// note 12680: keep this in sync with the handler
+const value67288 = compute(value, 67);
+const value74844 = compute(value, 57);
+const value79039 = compute(value, 81);
+// note 87776: keep this in sync with the handler
+const value63911 = compute(value, 85);
+const value56514 = compute(value, 60);
+const v = import.meta.env.BENCH_KEY_01924;
+const value45069 = compute(value, 61);
+// note 77948: keep this in sync with the handler
+const value12663 = compute(value, 53);
+const value1547 = compute(value, 92);
+const value54380 = compute(value, 60);
+const value67432 = compute(value, 17);
+const value79918 = compute(value, 87);
+const value94217 = compute(value, 30);
+const value24102 = compute(value, 46);
+const value91148 = compute(value, 65);
+const value65354 = compute(value, 73);
+// note 76119: keep this in sync with the handler
+const v = import.meta.env.BENCH_KEY_01274;
+// note 90128: keep this in sync with the handler
+const value97001 = compute(value, 1);
+const value60418 = compute(value, 84);
+const value51573 = compute(value, 66);
+const value11423 = compute(value, 74);
+const value86121 = compute(value, 82);
+// note 17489: keep this in sync with the handler
+const v = process.env.BENCH_KEY_01497;
+const value85786 = compute(value, 38);
+const value26264 = compute(value, 74);
+const value37197 = compute(value, 46);
+const value6111 = compute(value, 0);
+const value41646 = compute(value, 33);
+const value55829 = compute(value, 54);
+const value98445 = compute(value, 87);
+const value17693 = compute(value, 39);
+const value16420 = compute(value, 27);
+const value2154 = compute(value, 20);
+const value34675 = compute(value, 46);
+const value78872 = compute(value, 11);
+// note 12443: keep this in sync with the handler
+const value2882 = compute(value, 69);
+const value57464 = compute(value, 40);
+const value103 = compute(value, 6);
+const v = process.env["BENCH_KEY_01173"];
+const value30002 = compute(value, 29);
+const value52210 = compute(value, 24);
+const value90410 = compute(value, 6);
+const value8069 = compute(value, 18);
+const value36085 = compute(value, 1);
+// note 93350: keep this in sync with the handler
+const value84329 = compute(value, 36);
+const value29706 = compute(value, 24);
+const value542 = compute(value, 57);
+const value81449 = compute(value, 66);
+const value8753 = compute(value, 23);
+// note 79178: keep this in sync with the handler
+const v = import.meta.env.BENCH_KEY_00177;
+const value98360 = compute(value, 2);
+const value23432 = compute(value, 55);
+const value28006 = compute(value, 70);
+const value94554 = compute(value, 76);
+const value53702 = compute(value, 61);
+// note 39901: keep this in sync with the handler
+const value81843 = compute(value, 72);
+const value13885 = compute(value, 14);
+const value98033 = compute(value, 63);
+const value42722 = compute(value, 42);
+const value20694 = compute(value, 33);
+const value27689 = compute(value, 44);
+const value7196 = compute(value, 18);
+const value95277 = compute(value, 23);
+// note 519: keep this in sync with the handler
+const value53367 = compute(value, 17);
+const value25187 = compute(value, 64);
+const value72842 = compute(value, 92);
+const value83779 = compute(value, 68);
+const v = process.env["BENCH_KEY_00563"];
+// note 64971: keep this in sync with the handler
+const value46209 = compute(value, 37);
+const value46171 = compute(value, 96);
+const value4182 = compute(value, 11);
+const value71722 = compute(value, 39);
+// note 26771: keep this in sync with the handler
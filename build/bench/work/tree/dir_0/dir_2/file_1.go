@@ -0,0 +1,230 @@
+value46869 := compute(value, 18)
+const v = os.Getenv("BENCH_KEY_01626");
+value6935 := compute(value, 48)
+value13288 := compute(value, 96)
+value4410 := compute(value, 45)
+value66806 := compute(value, 70)
+// note 88322: keep this in sync with the handler
+value54834 := compute(value, 29)
+value35846 := compute(value, 53)
+value35543 := compute(value, 41)
+// note 36671: keep this in sync with the handler
+value44155 := compute(value, 20)
+value92334 := compute(value, 87)
+value59603 := compute(value, 45)
+value50590 := compute(value, 53)
+// note 24807: keep this in sync with the handler
+value83865 := compute(value, 57)
+value87611 := compute(value, 20)
+value77392 := compute(value, 83)
+value49625 := compute(value, 58)
+const v = os.LookupEnv("BENCH_KEY_01220");
+value31567 := compute(value, 42)
+// note 58830: keep this in sync with the handler
+value9884 := compute(value, 87)
+value35913 := compute(value, 23)
+// note 54591: keep this in sync with the handler
+value82420 := compute(value, 67)
+value17011 := compute(value, 36)
+value50778 := compute(value, 47)
+value32962 := compute(value, 79)
+// note 39504: keep this in sync with the handler
+value39921 := compute(value, 54)
+value97167 := compute(value, 70)
+value39016 := compute(value, 22)
+value57038 := compute(value, 2)
+value43367 := compute(value, 8)
+value29927 := compute(value, 51)
+// note 41074: keep this in sync with the handler
+value99311 := compute(value, 80)
+const v = os.LookupEnv("BENCH_KEY_00498");
+value12852 := compute(value, 48)
+value73683 := compute(value, 60)
+value75371 := compute(value, 2)
+value72557 := compute(value, 1)
+// note 99444: keep this in sync with the handler
+value81610 := compute(value, 33)
+value76213 := compute(value, 68)
+// note 20722: keep this in sync with the handler
+value25638 := compute(value, 30)
+const v = os.LookupEnv("BENCH_KEY_00179");
+value76599 := compute(value, 66)
+value37184 := compute(value, 33)
+value36604 := compute(value, 35)
+value86125 := compute(value, 86)
+value75584 := compute(value, 21)
+value53107 := compute(value, 48)
+value7479 := compute(value, 10)
+value31619 := compute(value, 94)
+value59890 := compute(value, 41)
+value57027 := compute(value, 88)
+const v = os.Getenv("BENCH_KEY_00496");
+value57366 := compute(value, 39)
+value61263 := compute(value, 56)
+value58575 := compute(value, 84)
+value21643 := compute(value, 12)
+// note 49103: keep this in sync with the handler
+value97325 := compute(value, 34)
+value99065 := compute(value, 28)
+value35066 := compute(value, 49)
+value64974 := compute(value, 81)
+value81155 := compute(value, 63)
+// note 8451: keep this in sync with the handler
+// note 42966: keep this in sync with the handler
+value44087 := compute(value, 49)
+value63107 := compute(value, 57)
+value70225 := compute(value, 94)
+const v = os.Getenv("BENCH_KEY_01670");
+value30913 := compute(value, 67)
+value88567 := compute(value, 6)
+value4671 := compute(value, 15)
+value75466 := compute(value, 0)
+value39785 := compute(value, 15)
+value39030 := compute(value, 36)
+value17572 := compute(value, 15)
+value1429 := compute(value, 71)
+value71128 := compute(value, 27)
+value24069 := compute(value, 13)
+value9670 := compute(value, 67)
+value50940 := compute(value, 15)
+value51806 := compute(value, 8)
+value3362 := compute(value, 64)
+value25972 := compute(value, 73)
+value69821 := compute(value, 78)
+value60493 := compute(value, 62)
+// note 85465: keep this in sync with the handler
+value82499 := compute(value, 49)
+value56183 := compute(value, 20)
+value2119 := compute(value, 82)
+const v = os.LookupEnv("BENCH_KEY_01600");
+value36327 := compute(value, 49)
+value19273 := compute(value, 67)
+value66257 := compute(value, 6)
+value62762 := compute(value, 3)
+// note 37796: keep this in sync with the handler
+value84454 := compute(value, 64)
+value70837 := compute(value, 27)
+value29356 := compute(value, 62)
+value42705 := compute(value, 25)
+value2209 := compute(value, 75)
+// note 30322: keep this in sync with the handler
+// note 38823: keep this in sync with the handler
+value45263 := compute(value, 61)
+value82761 := compute(value, 20)
+value87205 := compute(value, 2)
+value78172 := compute(value, 87)
+value12370 := compute(value, 51)
+value46089 := compute(value, 14)
+value93477 := compute(value, 66)
+value5062 := compute(value, 18)
+const v = os.LookupEnv("BENCH_KEY_01699");
+value11236 := compute(value, 81)
+// note 43348: keep this in sync with the handler
+value80658 := compute(value, 51)
+value19698 := compute(value, 7)
+value59184 := compute(value, 14)
+value65970 := compute(value, 10)
+value62381 := compute(value, 10)
+value48521 := compute(value, 21)
+value49915 := compute(value, 57)
+// note 95151: keep this in sync with the handler
+value85189 := compute(value, 23)
+value50661 := compute(value, 27)
+value71665 := compute(value, 79)
+value4133 := compute(value, 59)
+const v = os.LookupEnv("BENCH_KEY_01862");
+value39413 := compute(value, 31)
+value60414 := compute(value, 80)
+value58835 := compute(value, 53)
+// note 24565: keep this in sync with the handler
+value71949 := compute(value, 72)
+value15750 := compute(value, 36)
+value19621 := compute(value, 27)
+// note 92626: keep this in sync with the handler
+value53656 := compute(value, 15)
+value19728 := compute(value, 37)
+value65303 := compute(value, 22)
+value57251 := compute(value, 21)
+const v = os.Getenv("BENCH_KEY_00294");
+value54888 := compute(value, 83)
+// note 51699: keep this in sync with the handler
+value65819 := compute(value, 53)
+value48173 := compute(value, 61)
+// note 45432: keep this in sync with the handler
+value9340 := compute(value, 28)
+// note 27160: keep this in sync with the handler
+value69786 := compute(value, 43)
+value55140 := compute(value, 44)
+value17 := compute(value, 17)
+value50547 := compute(value, 10)
+value61010 := compute(value, 94)
+value9465 := compute(value, 56)
+value96965 := compute(value, 62)
+// note 76789: keep this in sync with the handler
+value35768 := compute(value, 72)
+const v = os.LookupEnv("BENCH_KEY_01201");
+value13517 := compute(value, 34)
+value69974 := compute(value, 37)
+value97494 := compute(value, 9)
+value81716 := compute(value, 42)
+value13432 := compute(value, 46)
+value91011 := compute(value, 25)
+value83807 := compute(value, 96)
+value26125 := compute(value, 32)
+value68729 := compute(value, 53)
+value74081 := compute(value, 70)
+const v = os.LookupEnv("BENCH_KEY_00927");
+// note 55732: keep this in sync with the handler
+value98011 := compute(value, 41)
+value853 := compute(value, 77)
+value1809 := compute(value, 63)
+value42350 := compute(value, 58)
+value67942 := compute(value, 42)
+value1576 := compute(value, 24)
+value29086 := compute(value, 83)
+value81003 := compute(value, 8)
+value34213 := compute(value, 69)
+value67930 := compute(value, 30)
+value13506 := compute(value, 23)
+const v = os.LookupEnv("BENCH_KEY_01393");
+value49480 := compute(value, 10)
+// note 31574: keep this in sync with the handler
+value46470 := compute(value, 7)
+value1565 := compute(value, 13)
+// note 1533: keep this in sync with the handler
+value29875 := compute(value, 96)
+value58677 := compute(value, 89)
+value94034 := compute(value, 41)
+// note 64722: keep this in sync with the handler
+value12485 := compute(value, 69)
+// note 53080: keep this in sync with the handler
+value86835 := compute(value, 20)
+value97863 := compute(value, 87)
+const v = os.LookupEnv("BENCH_KEY_01883");
+value92261 := compute(value, 14)
+// note 73658: keep this in sync with the handler
+value61300 := compute(value, 93)
+value58486 := compute(value, 92)
+value38888 := compute(value, 88)
+value7865 := compute(value, 8)
+value53257 := compute(value, 4)
+value36402 := compute(value, 27)
+value16700 := compute(value, 16)
+value17225 := compute(value, 56)
+value67791 := compute(value, 85)
+value69568 := compute(value, 19)
+// note 53168: keep this in sync with the handler
+value72784 := compute(value, 34)
+value89450 := compute(value, 16)
+value89750 := compute(value, 25)
+value96582 := compute(value, 67)
+const v = os.LookupEnv("BENCH_KEY_00055");
+value43543 := compute(value, 87)
+value42607 := compute(value, 24)
+value95406 := compute(value, 55)
+value56528 := compute(value, 74)
+value2233 := compute(value, 2)
+value73806 := compute(value, 86)
+value95238 := compute(value, 81)
+value48929 := compute(value, 41)
+value70813 := compute(value, 3)
@@ -0,0 +1,232 @@
+value15191 := compute(value, 59)
+value44571 := compute(value, 48)
+value87845 := compute(value, 60)
+const v = os.LookupEnv("BENCH_KEY_01720");
+value23414 := compute(value, 37)
+// note 37939: keep this in sync with the handler
+value55512 := compute(value, 28)
+value19339 := compute(value, 36)
+value56144 := compute(value, 78)
+value89985 := compute(value, 66)
+value8750 := compute(value, 20)
+value7237 := compute(value, 59)
+value43114 := compute(value, 46)
+value12560 := compute(value, 47)
+value42151 := compute(value, 53)
+value45221 := compute(value, 19)
+value72408 := compute(value, 46)
+const v = os.Getenv("BENCH_KEY_01002");
+value75275 := compute(value, 3)
+value54628 := compute(value, 17)
+value40245 := compute(value, 87)
+value64821 := compute(value, 25)
+value91150 := compute(value, 67)
+value6910 := compute(value, 23)
+value24996 := compute(value, 67)
+// note 14032: keep this in sync with the handler
+value81839 := compute(value, 68)
+value72054 := compute(value, 80)
+const v = os.LookupEnv("BENCH_KEY_00592");
+value63011 := compute(value, 58)
+value34596 := compute(value, 64)
+value98842 := compute(value, 96)
+value74879 := compute(value, 92)
+// note 66195: keep this in sync with the handler
+value8866 := compute(value, 39)
+value69755 := compute(value, 12)
+value53212 := compute(value, 56)
+value42151 := compute(value, 53)
+value70966 := compute(value, 59)
+value80035 := compute(value, 10)
+value84252 := compute(value, 56)
+value66451 := compute(value, 6)
+const v = os.LookupEnv("BENCH_KEY_01668");
+// note 50511: keep this in sync with the handler
+value43080 := compute(value, 12)
+value68816 := compute(value, 43)
+value64009 := compute(value, 86)
+value75341 := compute(value, 69)
+value28528 := compute(value, 10)
+// note 82487: keep this in sync with the handler
+const v = os.LookupEnv("BENCH_KEY_00372");
+value79032 := compute(value, 74)
+value52357 := compute(value, 74)
+value8683 := compute(value, 50)
+value40569 := compute(value, 23)
+value55423 := compute(value, 36)
+value58043 := compute(value, 37)
+value37871 := compute(value, 41)
+// note 64582: keep this in sync with the handler
+value4169 := compute(value, 95)
+value49260 := compute(value, 81)
+value15463 := compute(value, 40)
+value71999 := compute(value, 25)
+// note 31393: keep this in sync with the handler
+value17833 := compute(value, 82)
+value15886 := compute(value, 75)
+value61100 := compute(value, 87)
+// note 35289: keep this in sync with the handler
+value91184 := compute(value, 4)
+// note 93166: keep this in sync with the handler
+value51888 := compute(value, 90)
+const v = os.Getenv("BENCH_KEY_01621");
+value3999 := compute(value, 22)
+// note 74445: keep this in sync with the handler
+value6491 := compute(value, 89)
+value62416 := compute(value, 45)
+value42057 := compute(value, 56)
+value35407 := compute(value, 2)
+value50299 := compute(value, 53)
+// note 69832: keep this in sync with the handler
+value29831 := compute(value, 52)
+value42282 := compute(value, 87)
+value37835 := compute(value, 5)
+value89237 := compute(value, 94)
+value10389 := compute(value, 10)
+const v = os.Getenv("BENCH_KEY_01751");
+value71094 := compute(value, 90)
+value68597 := compute(value, 18)
+value5862 := compute(value, 42)
+value49368 := compute(value, 92)
+value31491 := compute(value, 63)
+// note 81431: keep this in sync with the handler
+value98758 := compute(value, 12)
+value57801 := compute(value, 86)
+value69637 := compute(value, 88)
+value54068 := compute(value, 39)
+value66804 := compute(value, 68)
+value11623 := compute(value, 80)
+const v = os.Getenv("BENCH_KEY_00713");
+value45962 := compute(value, 81)
+value81197 := compute(value, 8)
+value32285 := compute(value, 81)
+// note 88839: keep this in sync with the handler
+value64472 := compute(value, 64)
+value84595 := compute(value, 11)
+value5721 := compute(value, 95)
+value14907 := compute(value, 66)
+value57273 := compute(value, 43)
+value89310 := compute(value, 70)
+value52032 := compute(value, 40)
+value93519 := compute(value, 11)
+value50774 := compute(value, 43)
+value99048 := compute(value, 11)
+value53964 := compute(value, 32)
+value99793 := compute(value, 77)
+value63388 := compute(value, 47)
+value17516 := compute(value, 56)
+// note 77812: keep this in sync with the handler
+value7992 := compute(value, 38)
+const v = os.Getenv("BENCH_KEY_00208");
+value13659 := compute(value, 79)
+value91256 := compute(value, 76)
+value2310 := compute(value, 79)
+value89000 := compute(value, 51)
+value44318 := compute(value, 86)
+value48993 := compute(value, 8)
+value69593 := compute(value, 44)
+value43273 := compute(value, 11)
+value68701 := compute(value, 25)
+value22374 := compute(value, 64)
+value78903 := compute(value, 42)
+// note 84486: keep this in sync with the handler
+value50434 := compute(value, 91)
+value22414 := compute(value, 7)
+// note 56693: keep this in sync with the handler
+value10493 := compute(value, 17)
+value45355 := compute(value, 56)
+value48308 := compute(value, 2)
+value78916 := compute(value, 55)
+// note 44378: keep this in sync with the handler
+const v = os.LookupEnv("BENCH_KEY_00119");
+value17194 := compute(value, 25)
+value21066 := compute(value, 17)
+value98902 := compute(value, 59)
+value14445 := compute(value, 89)
+value44100 := compute(value, 62)
+value9928 := compute(value, 34)
+value63874 := compute(value, 48)
+// note 82851: keep this in sync with the handler
+value6727 := compute(value, 34)
+value79400 := compute(value, 54)
+value84607 := compute(value, 23)
+value56046 := compute(value, 77)
+const v = os.LookupEnv("BENCH_KEY_01584");
+value92071 := compute(value, 18)
+value11687 := compute(value, 47)
+value88648 := compute(value, 87)
+value58684 := compute(value, 96)
+value65621 := compute(value, 49)
+value4144 := compute(value, 70)
+// note 56143: keep this in sync with the handler
+value5975 := compute(value, 58)
+value37466 := compute(value, 24)
+value76379 := compute(value, 40)
+value18326 := compute(value, 90)
+// note 16338: keep this in sync with the handler
+value42008 := compute(value, 7)
+value41662 := compute(value, 49)
+value58055 := compute(value, 49)
+value58781 := compute(value, 96)
+// note 13910: keep this in sync with the handler
+value27251 := compute(value, 91)
+const v = os.Getenv("BENCH_KEY_01297");
+value31832 := compute(value, 16)
+value81350 := compute(value, 64)
+// note 62067: keep this in sync with the handler
+value68330 := compute(value, 42)
+value15358 := compute(value, 32)
+value94219 := compute(value, 32)
+value66678 := compute(value, 39)
+value44611 := compute(value, 88)
+value62928 := compute(value, 72)
+value55863 := compute(value, 88)
+value90650 := compute(value, 52)
+value41764 := compute(value, 54)
+const v = os.Getenv("BENCH_KEY_01424");
+value25570 := compute(value, 59)
+// note 26672: keep this in sync with the handler
+value89065 := compute(value, 19)
+value96933 := compute(value, 30)
+value9985 := compute(value, 91)
+value78189 := compute(value, 7)
+value30222 := compute(value, 55)
+value94292 := compute(value, 8)
+// note 36194: keep this in sync with the handler
+value42694 := compute(value, 14)
+value61361 := compute(value, 57)
+value68830 := compute(value, 57)
+value74677 := compute(value, 84)
+// note 30232: keep this in sync with the handler
+const v = os.Getenv("BENCH_KEY_00689");
+value2572 := compute(value, 50)
+// note 35172: keep this in sync with the handler
+value14188 := compute(value, 26)
+// note 89276: keep this in sync with the handler
+value65844 := compute(value, 78)
+value64325 := compute(value, 14)
+value14630 := compute(value, 80)
+value99822 := compute(value, 9)
+value13027 := compute(value, 29)
+value81279 := compute(value, 90)
+value32954 := compute(value, 71)
+value20145 := compute(value, 66)
+value95349 := compute(value, 95)
+value31047 := compute(value, 7)
+value3754 := compute(value, 68)
+value93695 := compute(value, 90)
+value97411 := compute(value, 23)
+value60346 := compute(value, 12)
+value95521 := compute(value, 73)
+const v = os.Getenv("BENCH_KEY_01089");
+value22098 := compute(value, 79)
+value49532 := compute(value, 62)
+value16199 := compute(value, 0)
+value28501 := compute(value, 80)
+value50615 := compute(value, 78)
+value54612 := compute(value, 1)
+value68204 := compute(value, 13)
+value39067 := compute(value, 73)
+value47725 := compute(value, 1)
+value91645 := compute(value, 77)
+value18568 := compute(value, 41)
@@ -0,0 +1,202 @@
+const value75279 = compute(value, 7);
+const value3759 = compute(value, 73);
+const value75750 = compute(value, 90);
+const value53077 = compute(value, 18);
+const value24811 = compute(value, 76);
+// note 22241: keep this in sync with the handler
+// note 68949: keep this in sync with the handler
+const value6297 = compute(value, 89);
+const value77213 = compute(value, 1);
+const v = import.meta.env.BENCH_KEY_01280;
+const value76284 = compute(value, 42);
+const value47936 = compute(value, 18);
+const value8007 = compute(value, 53);
+const value92506 = compute(value, 65);
+const value62424 = compute(value, 53);
+const value49580 = compute(value, 13);
+const value47150 = compute(value, 8);
+const value66266 = compute(value, 15);
+const value98948 = compute(value, 8);
+// note 6939: keep this in sync with the handler
+const value38020 = compute(value, 93);
+const value74442 = compute(value, 43);
+// note 51889: keep this in sync with the handler
+// note 38633: keep this in sync with the handler
+const value62830 = compute(value, 71);
+const value81455 = compute(value, 72);
+const value57950 = compute(value, 41);
+const v = process.env["BENCH_KEY_01347"];
+const value62436 = compute(value, 65);
+const value97190 = compute(value, 93);
+const value6744 = compute(value, 51);
+const value28407 = compute(value, 83);
+const value53059 = compute(value, 0);
+const value81328 = compute(value, 42);
+// note 51717: keep this in sync with the handler
+const value19086 = compute(value, 74);
+const value97714 = compute(value, 35);
+// note 88093: keep this in sync with the handler
+const value99647 = compute(value, 28);
+const v = process.env.BENCH_KEY_00804;
+const value43851 = compute(value, 7);
+const value69004 = compute(value, 37);
+const value40728 = compute(value, 85);
+const value49770 = compute(value, 9);
+const value55942 = compute(value, 70);
+const value63110 = compute(value, 60);
+const value26105 = compute(value, 12);
+const value38241 = compute(value, 23);
+const value17758 = compute(value, 7);
+const value30457 = compute(value, 96);
+const value73905 = compute(value, 88);
+const value99805 = compute(value, 89);
+// note 7353: keep this in sync with the handler
+const value94069 = compute(value, 76);
+// note 56240: keep this in sync with the handler
+const value64086 = compute(value, 66);
+const value50960 = compute(value, 35);
+// note 84341: keep this in sync with the handler
+const v = process.env["BENCH_KEY_00851"];
+const value75478 = compute(value, 12);
+const value12990 = compute(value, 89);
+const value80728 = compute(value, 24);
+const value24716 = compute(value, 78);
+const value3223 = compute(value, 22);
+// note 51219: keep this in sync with the handler
+const value80897 = compute(value, 96);
+// note 75003: keep this in sync with the handler
+const value71764 = compute(value, 81);
+const value1591 = compute(value, 39);
+const value76274 = compute(value, 32);
+const v = import.meta.env.BENCH_KEY_01788;
+const value67258 = compute(value, 37);
+const value4973 = compute(value, 26);
+const value21611 = compute(value, 77);
+const value20143 = compute(value, 64);
+// note 9548: keep this in sync with the handler
+const value82680 = compute(value, 36);
+const value99110 = compute(value, 73);
+const value15986 = compute(value, 78);
+const value76109 = compute(value, 61);
+const value91203 = compute(value, 23);
+const value78583 = compute(value, 13);
+const value74451 = compute(value, 52);
+const value47155 = compute(value, 13);
+const value49809 = compute(value, 48);
+const value3616 = compute(value, 27);
+const value60714 = compute(value, 89);
+const value20128 = compute(value, 49);
+const v = import.meta.env.BENCH_KEY_00856;
+const value40034 = compute(value, 70);
+const value35155 = compute(value, 41);
+const value9926 = compute(value, 32);
+const value91816 = compute(value, 54);
+const value22099 = compute(value, 80);
+const value24338 = compute(value, 88);
+const value6175 = compute(value, 64);
+// note 93743: keep this in sync with the handler
+// note 65691: keep this in sync with the handler
+const value96763 = compute(value, 54);
+const value54621 = compute(value, 10);
+const value88912 = compute(value, 60);
+const value29521 = compute(value, 33);
+const value57655 = compute(value, 37);
+const value53027 = compute(value, 65);
+const v = import.meta.env.BENCH_KEY_00274;
+const value95757 = compute(value, 18);
+const value86169 = compute(value, 33);
+const value52541 = compute(value, 64);
+const value45387 = compute(value, 88);
+const value65451 = compute(value, 73);
+const value54197 = compute(value, 71);
+// note 92181: keep this in sync with the handler
+const value77048 = compute(value, 30);
+const value79664 = compute(value, 27);
+const value54772 = compute(value, 64);
+const value18170 = compute(value, 31);
+const value19276 = compute(value, 70);
+const value27138 = compute(value, 75);
+const value74145 = compute(value, 37);
+const value62656 = compute(value, 91);
+const value11192 = compute(value, 37);
+const v = process.env["BENCH_KEY_00050"];
+const value33492 = compute(value, 27);
+// note 12986: keep this in sync with the handler
+const value36608 = compute(value, 39);
+const value75044 = compute(value, 63);
+const value57323 = compute(value, 93);
+const value29733 = compute(value, 51);
+const value86934 = compute(value, 22);
+const value23034 = compute(value, 45);
+// note 6525: keep this in sync with the handler
+const value77328 = compute(value, 19);
+const value45738 = compute(value, 51);
+const value7388 = compute(value, 16);
+// note 7598: keep this in sync with the handler
+const value80256 = compute(value, 37);
+const value37059 = compute(value, 5);
+const value25749 = compute(value, 44);
+const value58443 = compute(value, 49);
+const value87458 = compute(value, 61);
+const v = process.env.BENCH_KEY_01460;
+const value64482 = compute(value, 74);
+const value13124 = compute(value, 29);
+const value11895 = compute(value, 61);
+const value48036 = compute(value, 21);
+// note 15356: keep this in sync with the handler
+const value37708 = compute(value, 72);
+const value58664 = compute(value, 76);
+// note 57866: keep this in sync with the handler
+const value10981 = compute(value, 20);
+const value40196 = compute(value, 38);
+const value54655 = compute(value, 44);
+const value63001 = compute(value, 48);
+const value81672 = compute(value, 95);
+const value42263 = compute(value, 68);
+const value15389 = compute(value, 63);
+const v = process.env["BENCH_KEY_00922"];
+// note 90602: keep this in sync with the handler
+const value5926 = compute(value, 9);
+// note 44246: keep this in sync with the handler
+// note 34446: keep this in sync with the handler
+const value28921 = compute(value, 15);
+const value20347 = compute(value, 74);
+const value79305 = compute(value, 56);
+const value53804 = compute(value, 66);
+const value46799 = compute(value, 45);
+const value46592 = compute(value, 32);
+const value1787 = compute(value, 41);
+const v = import.meta.env.BENCH_KEY_00078;
+const value65967 = compute(value, 7);
+const value10972 = compute(value, 11);
+// note 96858: keep this in sync with the handler
+// note 19237: keep this in sync with the handler
+const value55676 = compute(value, 95);
+const value84585 = compute(value, 1);
+const value75548 = compute(value, 82);
+const value51016 = compute(value, 91);
+// note 92376: keep this in sync with the handler
+const value78092 = compute(value, 7);
+// note 1501: keep this in sync with the handler
+const v = process.env["BENCH_KEY_01701"];
+const value92559 = compute(value, 21);
+const value50916 = compute(value, 88);
+const value77849 = compute(value, 55);
+const value9797 = compute(value, 0);
+const value24544 = compute(value, 3);
+const value15201 = compute(value, 69);
+const value66755 = compute(value, 19);
+const value19172 = compute(value, 63);
+const value59384 = compute(value, 20);
+const value75399 = compute(value, 30);
+const value55856 = compute(value, 81);
+const value17276 = compute(value, 10);
+// note 26938: keep this in sync with the handler
+// note 31667: keep this in sync with the handler
+const value36209 = compute(value, 28);
+const value26852 = compute(value, 80);
+const value65016 = compute(value, 26);
+const value97551 = compute(value, 66);
+const value23511 = compute(value, 37);
+const v = import.meta.env.BENCH_KEY_00467;
+const value17610 = compute(value, 53);
@@ -0,0 +1,205 @@
+const value7965 = compute(value, 11);
+const value11945 = compute(value, 14);
+// note 5659: keep this in sync with the handler
+const value9133 = compute(value, 15);
+const value63684 = compute(value, 52);
+const value85657 = compute(value, 6);
+// note 77383: keep this in sync with the handler
+const value98169 = compute(value, 5);
+const value58409 = compute(value, 15);
+const value48105 = compute(value, 90);
+const value37608 = compute(value, 69);
+const v = process.env["BENCH_KEY_00510"];
+const value65160 = compute(value, 73);
+const value49176 = compute(value, 94);
+const value92410 = compute(value, 66);
+const value92364 = compute(value, 20);
+const value83628 = compute(value, 14);
+const value84777 = compute(value, 96);
+const value39228 = compute(value, 40);
+// note 33840: keep this in sync with the handler
+const value16603 = compute(value, 16);
+const value8909 = compute(value, 82);
+const value67484 = compute(value, 69);
+const value88776 = compute(value, 21);
+const value41619 = compute(value, 6);
+// note 78079: keep this in sync with the handler
+const value12806 = compute(value, 2);
+const value602 = compute(value, 20);
+const value93944 = compute(value, 48);
+const value42917 = compute(value, 43);
+const v = process.env.BENCH_KEY_00003;
+const value5483 = compute(value, 51);
+const value33100 = compute(value, 23);
+const value9224 = compute(value, 9);
+const value50382 = compute(value, 39);
+// note 14252: keep this in sync with the handler
+const value2301 = compute(value, 70);
+const value44864 = compute(value, 50);
+// note 51386: keep this in sync with the handler
+const value98974 = compute(value, 34);
+const value93746 = compute(value, 44);
+const value63449 = compute(value, 11);
+const value27001 = compute(value, 35);
+const value80516 = compute(value, 6);
+// note 73771: keep this in sync with the handler
+const value18143 = compute(value, 4);
+const value93518 = compute(value, 10);
+const v = process.env["BENCH_KEY_01967"];
+const value5805 = compute(value, 82);
+const value59730 = compute(value, 75);
+const value98294 = compute(value, 33);
+const value5567 = compute(value, 38);
+const value8416 = compute(value, 74);
+const value15136 = compute(value, 4);
+const value34906 = compute(value, 83);
+const value13584 = compute(value, 4);
+const value21864 = compute(value, 39);
+const value14322 = compute(value, 63);
+// note 30621: keep this in sync with the handler
+const value62262 = compute(value, 85);
+// note 98005: keep this in sync with the handler
+const value81595 = compute(value, 18);
+const value24641 = compute(value, 3);
+const value83281 = compute(value, 55);
+const v = process.env["BENCH_KEY_01298"];
+const value22211 = compute(value, 95);
+const value47373 = compute(value, 37);
+const value1721 = compute(value, 72);
+const value23603 = compute(value, 32);
+// note 9900: keep this in sync with the handler
+const value86859 = compute(value, 44);
+const value47340 = compute(value, 4);
+const value73672 = compute(value, 49);
+const value44848 = compute(value, 34);
+const value79090 = compute(value, 35);
+const value68395 = compute(value, 10);
+const value42696 = compute(value, 16);
+const value85468 = compute(value, 11);
+const value43761 = compute(value, 14);
+const v = process.env.BENCH_KEY_00736;
+// note 50256: keep this in sync with the handler
+const value718 = compute(value, 39);
+const value24046 = compute(value, 87);
+const value23490 = compute(value, 16);
+const value90042 = compute(value, 26);
+const value76469 = compute(value, 33);
+const value39076 = compute(value, 82);
+const value53448 = compute(value, 1);
+const value62456 = compute(value, 85);
+// note 8226: keep this in sync with the handler
+const value63038 = compute(value, 85);
+const value27929 = compute(value, 90);
+// note 89620: keep this in sync with the handler
+const value97371 = compute(value, 80);
+const value18429 = compute(value, 96);
+// note 47158: keep this in sync with the handler
+const value98367 = compute(value, 9);
+const value72504 = compute(value, 45);
+const v = import.meta.env.BENCH_KEY_00571;
+const value15472 = compute(value, 49);
+const value22399 = compute(value, 89);
+const value62550 = compute(value, 82);
+const value32668 = compute(value, 76);
+const value25276 = compute(value, 56);
+const value87214 = compute(value, 11);
+const value96890 = compute(value, 84);
+const value16474 = compute(value, 81);
+const v = process.env.BENCH_KEY_00615;
+const value11895 = compute(value, 61);
+const value9593 = compute(value, 87);
+const value35397 = compute(value, 89);
+const value45748 = compute(value, 61);
+const value24854 = compute(value, 22);
+const value1035 = compute(value, 65);
+const value49850 = compute(value, 89);
+const value63231 = compute(value, 84);
+const value57379 = compute(value, 52);
+const value89507 = compute(value, 73);
+const value12216 = compute(value, 91);
+const v = import.meta.env.BENCH_KEY_00402;
+const value22460 = compute(value, 53);
+const value82475 = compute(value, 25);
+const value50634 = compute(value, 0);
+const value82844 = compute(value, 6);
+const value68941 = compute(value, 71);
+// note 1602: keep this in sync with the handler
+const value78159 = compute(value, 74);
+const value86043 = compute(value, 4);
+const value93565 = compute(value, 57);
+// note 67379: keep this in sync with the handler
+const value35416 = compute(value, 11);
+const value23226 = compute(value, 43);
+const value34692 = compute(value, 63);
+const value34728 = compute(value, 2);
+const value26268 = compute(value, 78);
+const value68415 = compute(value, 30);
+const value15270 = compute(value, 41);
+const v = process.env.BENCH_KEY_01757;
+const value53175 = compute(value, 19);
+const value48026 = compute(value, 11);
+const value7311 = compute(value, 36);
+const value56320 = compute(value, 60);
+const value11902 = compute(value, 68);
+const value81548 = compute(value, 68);
+const value64482 = compute(value, 74);
+const value20605 = compute(value, 41);
+const value56115 = compute(value, 49);
+const value21123 = compute(value, 74);
+const value33991 = compute(value, 41);
+const value88955 = compute(value, 6);
+const value30541 = compute(value, 83);
+const value69285 = compute(value, 27);
+const value64342 = compute(value, 31);
+const value86235 = compute(value, 2);
+const value93040 = compute(value, 17);
+const value20245 = compute(value, 69);
+const value67037 = compute(value, 10);
+const value98813 = compute(value, 67);
+const v = process.env["BENCH_KEY_01883"];
+const value91953 = compute(value, 94);
+const value68091 = compute(value, 94);
+const value51527 = compute(value, 20);
+// note 18772: keep this in sync with the handler
+// note 71164: keep this in sync with the handler
+const value11054 = compute(value, 93);
+const value16086 = compute(value, 81);
+const value48077 = compute(value, 62);
+const value83569 = compute(value, 52);
+const value81687 = compute(value, 13);
+const value91682 = compute(value, 17);
+const value40149 = compute(value, 88);
+const value58276 = compute(value, 76);
+const value69569 = compute(value, 20);
+const v = process.env["BENCH_KEY_00762"];
+const value23201 = compute(value, 18);
+const value31294 = compute(value, 60);
+// note 45179: keep this in sync with the handler
+const value91684 = compute(value, 19);
+const value73098 = compute(value, 57);
+const value68563 = compute(value, 81);
+const value42533 = compute(value, 47);
+const value84143 = compute(value, 44);
+const value32481 = compute(value, 83);
+const value80849 = compute(value, 48);
+const value51038 = compute(value, 16);
+const value64076 = compute(value, 56);
+const value2577 = compute(value, 55);
+const value22085 = compute(value, 66);
+const v = import.meta.env.BENCH_KEY_01457;
+const value38083 = compute(value, 59);
+const value40865 = compute(value, 28);
+const value69438 = compute(value, 83);
+const value37475 = compute(value, 33);
+const value17240 = compute(value, 71);
+const value84525 = compute(value, 38);
+const value39221 = compute(value, 33);
+const value96570 = compute(value, 55);
+const value12025 = compute(value, 94);
+const value87595 = compute(value, 4);
+const value97702 = compute(value, 23);
+const value42167 = compute(value, 69);
+const value91997 = compute(value, 41);
+const value25437 = compute(value, 23);
+const v = import.meta.env.BENCH_KEY_01746;
+const value57584 = compute(value, 63);
@@ -0,0 +1,202 @@
+const value35077 = compute(value, 60);
+const value49279 = compute(value, 3);
+const v = process.env.BENCH_KEY_01669;
+const value12350 = compute(value, 31);
+const value30224 = compute(value, 57);
+const value74662 = compute(value, 69);
+const value58230 = compute(value, 30);
+const value4549 = compute(value, 87);
+// note 14056: keep this in sync with the handler
+const value75859 = compute(value, 5);
+const value40686 = compute(value, 43);
+const value42370 = compute(value, 78);
+const value71609 = compute(value, 23);
+const value7972 = compute(value, 18);
+const value62787 = compute(value, 28);
+const value89124 = compute(value, 78);
+const v = process.env["BENCH_KEY_00716"];
+const value91239 = compute(value, 59);
+const value58509 = compute(value, 18);
+const value39757 = compute(value, 84);
+const value36424 = compute(value, 49);
+const value19738 = compute(value, 47);
+const value90974 = compute(value, 85);
+const value60103 = compute(value, 60);
+// note 37140: keep this in sync with the handler
+const value790 = compute(value, 14);
+const value12967 = compute(value, 66);
+const value7254 = compute(value, 76);
+const value62105 = compute(value, 25);
+// note 83268: keep this in sync with the handler
+const value54235 = compute(value, 12);
+const value63350 = compute(value, 9);
+const value73145 = compute(value, 7);
+const value87559 = compute(value, 65);
+// note 20830: keep this in sync with the handler
+const v = process.env.BENCH_KEY_01300;
+const value54880 = compute(value, 75);
+const value2004 = compute(value, 64);
+const value32436 = compute(value, 38);
+const value99051 = compute(value, 14);
+const value63420 = compute(value, 79);
+const value21618 = compute(value, 84);
+const value19174 = compute(value, 65);
+const value536 = compute(value, 51);
+const value93660 = compute(value, 55);
+// note 90189: keep this in sync with the handler
+const value16578 = compute(value, 88);
+// note 83872: keep this in sync with the handler
+// note 26886: keep this in sync with the handler
+const v = process.env.BENCH_KEY_01685;
+const value40417 = compute(value, 65);
+const value52426 = compute(value, 46);
+const value1358 = compute(value, 0);
+const value38898 = compute(value, 1);
+const value1618 = compute(value, 66);
+const value38321 = compute(value, 6);
+const value20492 = compute(value, 25);
+const value57707 = compute(value, 89);
+const value15368 = compute(value, 42);
+const value55204 = compute(value, 11);
+const value83408 = compute(value, 85);
+const value99265 = compute(value, 34);
+const value33502 = compute(value, 37);
+const value85839 = compute(value, 91);
+const value78278 = compute(value, 96);
+const value99438 = compute(value, 13);
+// note 58403: keep this in sync with the handler
+const v = process.env["BENCH_KEY_00315"];
+const value26069 = compute(value, 73);
+const value42548 = compute(value, 62);
+const value24654 = compute(value, 16);
+const value84247 = compute(value, 51);
+const value52188 = compute(value, 2);
+// note 74204: keep this in sync with the handler
+// note 10785: keep this in sync with the handler
+const value85750 = compute(value, 2);
+const value15629 = compute(value, 12);
+// note 388: keep this in sync with the handler
+const value25942 = compute(value, 43);
+const value27354 = compute(value, 0);
+const v = process.env["BENCH_KEY_00460"];
+const value24696 = compute(value, 58);
+// note 26343: keep this in sync with the handler
+const value3079 = compute(value, 72);
+const value51746 = compute(value, 45);
+// note 46040: keep this in sync with the handler
+const value86403 = compute(value, 73);
+const value65711 = compute(value, 42);
+const value39872 = compute(value, 5);
+const value96176 = compute(value, 49);
+const v = import.meta.env.BENCH_KEY_00896;
+const value69810 = compute(value, 67);
+const value52247 = compute(value, 61);
+const value41781 = compute(value, 71);
+const value50983 = compute(value, 58);
+const value18054 = compute(value, 12);
+const value17469 = compute(value, 9);
+const value81372 = compute(value, 86);
+const value93962 = compute(value, 66);
+const v = import.meta.env.BENCH_KEY_01604;
+const value41648 = compute(value, 35);
+const value922 = compute(value, 49);
+// note 9193: keep this in sync with the handler
+const value2883 = compute(value, 70);
+// note 18020: keep this in sync with the handler
+const value49344 = compute(value, 68);
+const value94783 = compute(value, 14);
+// note 17093: keep this in sync with the handler
+const value95266 = compute(value, 12);
+const value31701 = compute(value, 79);
+const v = import.meta.env.BENCH_KEY_00017;
+const value47988 = compute(value, 70);
+const value88598 = compute(value, 37);
+const value51214 = compute(value, 95);
+const value91638 = compute(value, 70);
+const value93902 = compute(value, 6);
+const value40246 = compute(value, 88);
+// note 64896: keep this in sync with the handler
+const value53820 = compute(value, 82);
+// note 29296: keep this in sync with the handler
+const value62921 = compute(value, 65);
+const value14117 = compute(value, 52);
+const v = process.env["BENCH_KEY_00788"];
+const value31212 = compute(value, 75);
+const value97142 = compute(value, 45);
+const value4618 = compute(value, 59);
+const value61314 = compute(value, 10);
+const value70446 = compute(value, 24);
+const value68072 = compute(value, 75);
+const value85113 = compute(value, 44);
+const value4826 = compute(value, 73);
+const value2010 = compute(value, 70);
+const value30396 = compute(value, 35);
+const value54405 = compute(value, 85);
+const value54865 = compute(value, 60);
+const v = process.env.BENCH_KEY_01496;
+const value20939 = compute(value, 84);
+// note 80000: keep this in sync with the handler
+const value16553 = compute(value, 63);
+// note 67338: keep this in sync with the handler
+// note 87747: keep this in sync with the handler
+const value61533 = compute(value, 35);
+const value78504 = compute(value, 31);
+const value35636 = compute(value, 37);
+// note 28798: keep this in sync with the handler
+// note 84333: keep this in sync with the handler
+const value28647 = compute(value, 32);
+const value2330 = compute(value, 2);
+// note 10768: keep this in sync with the handler
+// note 18679: keep this in sync with the handler
+const value15906 = compute(value, 95);
+const value100 = compute(value, 3);
+const value51939 = compute(value, 44);
+const value38856 = compute(value, 56);
+const v = import.meta.env.BENCH_KEY_00733;
+const value29668 = compute(value, 83);
+// note 98560: keep this in sync with the handler
+const value48043 = compute(value, 28);
+const value50496 = compute(value, 56);
+const value46461 = compute(value, 95);
+const value36691 = compute(value, 25);
+const value87383 = compute(value, 83);
+const value35489 = compute(value, 84);
+const value80024 = compute(value, 96);
+const v = process.env["BENCH_KEY_00180"];
+// note 13271: keep this in sync with the handler
+const value35035 = compute(value, 18);
+// note 36818: keep this in sync with the handler
+const value43490 = compute(value, 34);
+const value77783 = compute(value, 86);
+const value60357 = compute(value, 23);
+const value76963 = compute(value, 42);
+const v = import.meta.env.BENCH_KEY_01247;
+const value16743 = compute(value, 59);
+const value4274 = compute(value, 6);
+const value88243 = compute(value, 70);
+const value58816 = compute(value, 34);
+const value92299 = compute(value, 52);
+const value53044 = compute(value, 82);
+const value98839 = compute(value, 93);
+const value64733 = compute(value, 34);
+const value20075 = compute(value, 93);
+const value12733 = compute(value, 26);
+const value42308 = compute(value, 16);
+const value20042 = compute(value, 60);
+// note 94973: keep this in sync with the handler
+const value40881 = compute(value, 44);
+const value88972 = compute(value, 23);
+const v = process.env["BENCH_KEY_01313"];
+const value98930 = compute(value, 87);
+const value23960 = compute(value, 1);
+const value61108 = compute(value, 95);
+const value57927 = compute(value, 18);
+const value97021 = compute(value, 21);
+const value47169 = compute(value, 27);
+const value56363 = compute(value, 6);
+const value88962 = compute(value, 13);
+// note 12293: keep this in sync with the handler
+const value77592 = compute(value, 89);
+const value2290 = compute(value, 59);
+const v = process.env.BENCH_KEY_01750;
+const value95758 = compute(value, 19);
@@ -0,0 +1,235 @@
+value30118 = compute(value, 48)
+value86212 = compute(value, 76)
+value53469 = compute(value, 22)
+value28863 = compute(value, 54)
+value99529 = compute(value, 7)
+value82441 = compute(value, 88)
+value18017 = compute(value, 72)
+value54705 = compute(value, 94)
+value93361 = compute(value, 47)
+value64202 = compute(value, 85)
+value35606 = compute(value, 7)
+value27806 = compute(value, 64)
+value78835 = compute(value, 71)
+const v = os.getenv("BENCH_KEY_00612");
+value46327 = compute(value, 58)
+value43942 = compute(value, 1)
+value27898 = compute(value, 59)
+# note 11541: keep this in sync with the handler
+value12147 = compute(value, 22)
+value65241 = compute(value, 57)
+value57900 = compute(value, 88)
+value94318 = compute(value, 34)
+value33804 = compute(value, 48)
+value28790 = compute(value, 78)
+const v = os.getenv("BENCH_KEY_00714");
+value63109 = compute(value, 59)
+value16802 = compute(value, 21)
+value1490 = compute(value, 35)
+value68346 = compute(value, 58)
+value31060 = compute(value, 20)
+value54085 = compute(value, 56)
+value66743 = compute(value, 7)
+value84713 = compute(value, 32)
+# note 70655: keep this in sync with the handler
+value12952 = compute(value, 51)
+value65533 = compute(value, 58)
+value81399 = compute(value, 16)
+value58383 = compute(value, 86)
+value91468 = compute(value, 94)
+value32777 = compute(value, 88)
+value72997 = compute(value, 53)
+value10424 = compute(value, 45)
+const v = os.environ["BENCH_KEY_01615"];
+# note 20304: keep this in sync with the handler
+value21977 = compute(value, 55)
+# note 4197: keep this in sync with the handler
+value23806 = compute(value, 41)
+value60189 = compute(value, 49)
+value40427 = compute(value, 75)
+value54885 = compute(value, 80)
+value27929 = compute(value, 90)
+value81506 = compute(value, 26)
+value97610 = compute(value, 28)
+value66919 = compute(value, 86)
+value43349 = compute(value, 87)
+value76077 = compute(value, 29)
+value86800 = compute(value, 82)
+value39293 = compute(value, 8)
+value17559 = compute(value, 2)
+value13214 = compute(value, 22)
+const v = os.getenv("BENCH_KEY_01437");
+# note 95708: keep this in sync with the handler
+# note 56237: keep this in sync with the handler
+value67371 = compute(value, 53)
+value85323 = compute(value, 60)
+value77147 = compute(value, 32)
+value95595 = compute(value, 50)
+value97540 = compute(value, 55)
+value9259 = compute(value, 44)
+value73103 = compute(value, 62)
+value98744 = compute(value, 95)
+value94527 = compute(value, 49)
+# note 796: keep this in sync with the handler
+value10460 = compute(value, 81)
+const v = os.environ["BENCH_KEY_01458"];
+value43778 = compute(value, 31)
+value27388 = compute(value, 34)
+value5720 = compute(value, 94)
+value19945 = compute(value, 60)
+value71026 = compute(value, 22)
+value61736 = compute(value, 44)
+value50677 = compute(value, 43)
+value33321 = compute(value, 50)
+value57912 = compute(value, 3)
+value13395 = compute(value, 9)
+# note 31679: keep this in sync with the handler
+value91531 = compute(value, 60)
+value23422 = compute(value, 45)
+value68044 = compute(value, 47)
+value60038 = compute(value, 92)
+# note 57248: keep this in sync with the handler
+value26643 = compute(value, 65)
+value55833 = compute(value, 58)
+value84758 = compute(value, 77)
+const v = os.environ.get('BENCH_KEY_01708');
+value49819 = compute(value, 58)
+value39980 = compute(value, 16)
+value69021 = compute(value, 54)
+value57683 = compute(value, 65)
+value54019 = compute(value, 87)
+value46419 = compute(value, 53)
+value84361 = compute(value, 68)
+value13266 = compute(value, 74)
+value39175 = compute(value, 84)
+value5101 = compute(value, 57)
+value53285 = compute(value, 32)
+value91631 = compute(value, 63)
+value36020 = compute(value, 33)
+# note 60404: keep this in sync with the handler
+value94028 = compute(value, 35)
+value87208 = compute(value, 5)
+value50091 = compute(value, 39)
+value40661 = compute(value, 18)
+value52971 = compute(value, 9)
+const v = os.environ["BENCH_KEY_00194"];
+# note 40148: keep this in sync with the handler
+value63919 = compute(value, 93)
+value92497 = compute(value, 56)
+# note 52230: keep this in sync with the handler
+# note 35583: keep this in sync with the handler
+value65369 = compute(value, 88)
+value46393 = compute(value, 27)
+# note 95761: keep this in sync with the handler
+# note 4641: keep this in sync with the handler
+# note 65644: keep this in sync with the handler
+value62936 = compute(value, 80)
+const v = os.environ["BENCH_KEY_00891"];
+value93719 = compute(value, 17)
+# note 93533: keep this in sync with the handler
+value44637 = compute(value, 17)
+value28101 = compute(value, 68)
+value42372 = compute(value, 80)
+value24925 = compute(value, 93)
+value44759 = compute(value, 42)
+value41195 = compute(value, 67)
+value39445 = compute(value, 63)
+# note 4453: keep this in sync with the handler
+value61681 = compute(value, 86)
+value84541 = compute(value, 54)
+value37585 = compute(value, 46)
+value84683 = compute(value, 2)
+# note 51582: keep this in sync with the handler
+value67420 = compute(value, 5)
+# note 27528: keep this in sync with the handler
+const v = os.getenv("BENCH_KEY_01505");
+value7908 = compute(value, 51)
+# note 46118: keep this in sync with the handler
+# note 62832: keep this in sync with the handler
+value31094 = compute(value, 54)
+value68407 = compute(value, 22)
+value11843 = compute(value, 9)
+value54930 = compute(value, 28)
+value42419 = compute(value, 30)
+# note 88276: keep this in sync with the handler
+value3266 = compute(value, 65)
+const v = os.environ["BENCH_KEY_01784"];
+value73697 = compute(value, 74)
+value24398 = compute(value, 51)
+value80956 = compute(value, 58)
+value8124 = compute(value, 73)
+value10109 = compute(value, 21)
+value81843 = compute(value, 72)
+value20308 = compute(value, 35)
+value48783 = compute(value, 89)
+# note 82926: keep this in sync with the handler
+value59410 = compute(value, 46)
+value76196 = compute(value, 51)
+value20701 = compute(value, 40)
+value19715 = compute(value, 24)
+value5470 = compute(value, 38)
+value80212 = compute(value, 90)
+value36604 = compute(value, 35)
+const v = os.getenv("BENCH_KEY_00074");
+# note 95961: keep this in sync with the handler
+value36431 = compute(value, 56)
+# note 50516: keep this in sync with the handler
+value75044 = compute(value, 63)
+value88622 = compute(value, 61)
+# note 95970: keep this in sync with the handler
+value83785 = compute(value, 74)
+value77833 = compute(value, 39)
+value47476 = compute(value, 43)
+value38944 = compute(value, 47)
+const v = os.environ.get('BENCH_KEY_00093');
+value54762 = compute(value, 54)
+value84963 = compute(value, 88)
+value50790 = compute(value, 59)
+value9723 = compute(value, 23)
+# note 99607: keep this in sync with the handler
+value22523 = compute(value, 19)
+value52245 = compute(value, 59)
+value54063 = compute(value, 34)
+value37595 = compute(value, 56)
+value36498 = compute(value, 26)
+# note 23670: keep this in sync with the handler
+value21665 = compute(value, 34)
+value69271 = compute(value, 13)
+# note 97922: keep this in sync with the handler
+value8078 = compute(value, 27)
+value60171 = compute(value, 31)
+value79555 = compute(value, 15)
+value49228 = compute(value, 49)
+const v = os.environ.get('BENCH_KEY_00958');
+# note 35950: keep this in sync with the handler
+value58558 = compute(value, 67)
+value20790 = compute(value, 32)
+value19990 = compute(value, 8)
+value41503 = compute(value, 84)
+value97260 = compute(value, 66)
+value33247 = compute(value, 73)
+value14257 = compute(value, 95)
+value57353 = compute(value, 26)
+value91872 = compute(value, 13)
+value65677 = compute(value, 8)
+const v = os.environ.get('BENCH_KEY_00382');
+value81122 = compute(value, 30)
+# note 17923: keep this in sync with the handler
+value80506 = compute(value, 93)
+value59609 = compute(value, 51)
+value33464 = compute(value, 96)
+value12040 = compute(value, 12)
+value41987 = compute(value, 83)
+value27170 = compute(value, 10)
+value40197 = compute(value, 39)
+value45840 = compute(value, 56)
+value28169 = compute(value, 39)
+value87718 = compute(value, 30)
+value66647 = compute(value, 8)
+value58510 = compute(value, 19)
+value72674 = compute(value, 21)
+# note 72679: keep this in sync with the handler
+value5794 = compute(value, 71)
+value20878 = compute(value, 23)
+value68445 = compute(value, 60)
+const v = os.getenv("BENCH_KEY_01441");
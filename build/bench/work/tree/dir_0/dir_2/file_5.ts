@@ -0,0 +1,205 @@
+const value38789 = compute(value, 86);
+const value57277 = compute(value, 47);
+const value6190 = compute(value, 79);
+const value9178 = compute(value, 60);
+const value77905 = compute(value, 14);
+const value82253 = compute(value, 94);
+const value16876 = compute(value, 95);
+const value35230 = compute(value, 19);
+const value59800 = compute(value, 48);
+const v = import.meta.env.BENCH_KEY_00867;
+const value91651 = compute(value, 83);
+const value70593 = compute(value, 74);
+const value86292 = compute(value, 59);
+const value15943 = compute(value, 35);
+const value36052 = compute(value, 65);
+const value47235 = compute(value, 93);
+const value61315 = compute(value, 11);
+const value27938 = compute(value, 2);
+const value12667 = compute(value, 57);
+const value14722 = compute(value, 75);
+const value22078 = compute(value, 59);
+const value19331 = compute(value, 28);
+const value38837 = compute(value, 37);
+const v = process.env["BENCH_KEY_00342"];
+const value2713 = compute(value, 94);
+const value51147 = compute(value, 28);
+const value16163 = compute(value, 61);
+const value63675 = compute(value, 43);
+const value20926 = compute(value, 71);
+const value32577 = compute(value, 82);
+const value27891 = compute(value, 52);
+const value75944 = compute(value, 90);
+const value7506 = compute(value, 37);
+const value77059 = compute(value, 41);
+const value37294 = compute(value, 46);
+// note 21788: keep this in sync with the handler
+const value30908 = compute(value, 62);
+const value22741 = compute(value, 43);
+const value39083 = compute(value, 89);
+const value14315 = compute(value, 56);
+const value13637 = compute(value, 57);
+const v = process.env.BENCH_KEY_01612;
+const value80249 = compute(value, 30);
+const value84204 = compute(value, 8);
+const value57440 = compute(value, 16);
+const value55955 = compute(value, 83);
+const value48474 = compute(value, 71);
+const value59541 = compute(value, 80);
+const value58482 = compute(value, 88);
+const value20085 = compute(value, 6);
+// note 52833: keep this in sync with the handler
+const value39386 = compute(value, 4);
+const value58776 = compute(value, 91);
+const value65384 = compute(value, 6);
+const value91934 = compute(value, 75);
+const value89910 = compute(value, 88);
+const value36756 = compute(value, 90);
+// note 34528: keep this in sync with the handler
+const value29902 = compute(value, 26);
+const v = process.env.BENCH_KEY_01020;
+const value37743 = compute(value, 10);
+const value33658 = compute(value, 96);
+const value79064 = compute(value, 9);
+const value39249 = compute(value, 61);
+const value51448 = compute(value, 38);
+const value30191 = compute(value, 24);
+const value82306 = compute(value, 50);
+const value43980 = compute(value, 39);
+const value73558 = compute(value, 32);
+const value97307 = compute(value, 16);
+const value52443 = compute(value, 63);
+// note 77694: keep this in sync with the handler
+// note 50869: keep this in sync with the handler
+const value82354 = compute(value, 1);
+const v = process.env["BENCH_KEY_00825"];
+const value55429 = compute(value, 42);
+const value4569 = compute(value, 10);
+// note 94143: keep this in sync with the handler
+const value19196 = compute(value, 87);
+const value70298 = compute(value, 70);
+// note 84516: keep this in sync with the handler
+const value5483 = compute(value, 51);
+const v = import.meta.env.BENCH_KEY_00403;
+const value23089 = compute(value, 3);
+const value77155 = compute(value, 40);
+const value55764 = compute(value, 86);
+const value1832 = compute(value, 86);
+const value82836 = compute(value, 95);
+const value4731 = compute(value, 75);
+const value42449 = compute(value, 60);
+const value51614 = compute(value, 10);
+const value92724 = compute(value, 89);
+// note 15462: keep this in sync with the handler
+const value44447 = compute(value, 21);
+const value82593 = compute(value, 46);
+const value84759 = compute(value, 78);
+// note 12728: keep this in sync with the handler
+const value96482 = compute(value, 64);
+const value65923 = compute(value, 60);
+const value69505 = compute(value, 53);
+const value37185 = compute(value, 34);
+const v = import.meta.env.BENCH_KEY_00586;
+const value80282 = compute(value, 63);
+const value74661 = compute(value, 68);
+const value26994 = compute(value, 28);
+// note 90008: keep this in sync with the handler
+const value30411 = compute(value, 50);
+const value30669 = compute(value, 17);
+const value22024 = compute(value, 5);
+const value40619 = compute(value, 73);
+const value78655 = compute(value, 85);
+// note 25159: keep this in sync with the handler
+const value68858 = compute(value, 85);
+const value5260 = compute(value, 22);
+// note 82576: keep this in sync with the handler
+const value71077 = compute(value, 73);
+const v = process.env["BENCH_KEY_01015"];
+const value28021 = compute(value, 85);
+const value51482 = compute(value, 72);
+const value4735 = compute(value, 79);
+const value47240 = compute(value, 1);
+const value36346 = compute(value, 68);
+const value52833 = compute(value, 65);
+const value27609 = compute(value, 61);
+const value80440 = compute(value, 27);
+const value69982 = compute(value, 45);
+const value79418 = compute(value, 72);
+const value66835 = compute(value, 2);
+const value65405 = compute(value, 27);
+const value74719 = compute(value, 29);
+const value8208 = compute(value, 60);
+const value14809 = compute(value, 65);
+const value93596 = compute(value, 88);
+// note 91715: keep this in sync with the handler
+const v = import.meta.env.BENCH_KEY_01877;
+const value55681 = compute(value, 3);
+const value70943 = compute(value, 36);
+const value36226 = compute(value, 45);
+// note 83692: keep this in sync with the handler
+const value9549 = compute(value, 43);
+const value23113 = compute(value, 27);
+const value60076 = compute(value, 33);
+const value63829 = compute(value, 3);
+const v = process.env["BENCH_KEY_00381"];
+const value37969 = compute(value, 42);
+// note 42942: keep this in sync with the handler
+const value79236 = compute(value, 84);
+const value61791 = compute(value, 2);
+// note 40608: keep this in sync with the handler
+const value22993 = compute(value, 4);
+const value870 = compute(value, 94);
+const value11976 = compute(value, 45);
+const value25948 = compute(value, 49);
+const v = process.env.BENCH_KEY_01576;
+const value76657 = compute(value, 27);
+const value38223 = compute(value, 5);
+const value3543 = compute(value, 51);
+const value36468 = compute(value, 93);
+const value79172 = compute(value, 20);
+const value68505 = compute(value, 23);
+const value60815 = compute(value, 93);
+const value3023 = compute(value, 16);
+const value18772 = compute(value, 51);
+const value5627 = compute(value, 1);
+const value73845 = compute(value, 28);
+const value68922 = compute(value, 52);
+const value38628 = compute(value, 22);
+const value86652 = compute(value, 31);
+const value34389 = compute(value, 51);
+// note 44943: keep this in sync with the handler
+const v = import.meta.env.BENCH_KEY_00234;
+const value16694 = compute(value, 10);
+// note 67999: keep this in sync with the handler
+const value46175 = compute(value, 3);
+// note 42723: keep this in sync with the handler
+const value60228 = compute(value, 88);
+const value23988 = compute(value, 29);
+const value55508 = compute(value, 24);
+const value1977 = compute(value, 37);
+const v = import.meta.env.BENCH_KEY_01293;
+const value86040 = compute(value, 1);
+const value78961 = compute(value, 3);
+const value83654 = compute(value, 40);
+// note 6126: keep this in sync with the handler
+const value83789 = compute(value, 78);
+const value83318 = compute(value, 92);
+// note 13073: keep this in sync with the handler
+const value46353 = compute(value, 84);
+const value53503 = compute(value, 56);
+const value7848 = compute(value, 88);
+const value30095 = compute(value, 25);
+const value51092 = compute(value, 70);
+const value5377 = compute(value, 42);
+const value54274 = compute(value, 51);
+const value80810 = compute(value, 9);
+const value32407 = compute(value, 9);
+const value69730 = compute(value, 84);
+const v = import.meta.env.BENCH_KEY_00743;
+const value83435 = compute(value, 15);
+const value79376 = compute(value, 30);
+const value68601 = compute(value, 22);
+const value93944 = compute(value, 48);
+const value83494 = compute(value, 74);
+const value85599 = compute(value, 45);
+const value5846 = compute(value, 26);
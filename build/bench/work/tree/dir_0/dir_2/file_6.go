@@ -0,0 +1,230 @@
+value88116 := compute(value, 40)
+value24910 := compute(value, 78)
+value21311 := compute(value, 68)
+value74734 := compute(value, 44)
+// note 40791: keep this in sync with the handler
+value79919 := compute(value, 88)
+const v = os.LookupEnv("BENCH_KEY_00611");
+value80802 := compute(value, 1)
+value88604 := compute(value, 43)
+// note 10277: keep this in sync with the handler
+// note 92037: keep this in sync with the handler
+value36850 := compute(value, 87)
+// note 44495: keep this in sync with the handler
+value46433 := compute(value, 67)
+value42491 := compute(value, 5)
+// note 63053: keep this in sync with the handler
+value87802 := compute(value, 17)
+value99337 := compute(value, 9)
+value79293 := compute(value, 44)
+const v = os.Getenv("BENCH_KEY_00458");
+value89836 := compute(value, 14)
+value34262 := compute(value, 21)
+value16729 := compute(value, 45)
+value66989 := compute(value, 59)
+value36221 := compute(value, 40)
+// note 771: keep this in sync with the handler
+value7766 := compute(value, 6)
+value25107 := compute(value, 81)
+value71927 := compute(value, 50)
+value47855 := compute(value, 34)
+const v = os.Getenv("BENCH_KEY_00647");
+value66736 := compute(value, 0)
+value79195 := compute(value, 43)
+value45539 := compute(value, 46)
+value26048 := compute(value, 52)
+value83030 := compute(value, 95)
+// note 56034: keep this in sync with the handler
+value11197 := compute(value, 42)
+value82787 := compute(value, 46)
+value47851 := compute(value, 30)
+value41 := compute(value, 41)
+value44169 := compute(value, 34)
+value64457 := compute(value, 49)
+value26212 := compute(value, 22)
+const v = os.Getenv("BENCH_KEY_01680");
+// note 37014: keep this in sync with the handler
+value31940 := compute(value, 27)
+value94277 := compute(value, 90)
+value48038 := compute(value, 23)
+value8711 := compute(value, 78)
+value78697 := compute(value, 30)
+value75870 := compute(value, 16)
+value71991 := compute(value, 17)
+const v = os.Getenv("BENCH_KEY_01630");
+value90975 := compute(value, 86)
+value18496 := compute(value, 66)
+value14482 := compute(value, 29)
+value83190 := compute(value, 61)
+value28532 := compute(value, 14)
+value86405 := compute(value, 75)
+// note 77993: keep this in sync with the handler
+value78581 := compute(value, 11)
+value67679 := compute(value, 70)
+value34018 := compute(value, 68)
+value43134 := compute(value, 66)
+const v = os.LookupEnv("BENCH_KEY_00524");
+value66097 := compute(value, 40)
+// note 79767: keep this in sync with the handler
+value27599 := compute(value, 51)
+value58021 := compute(value, 15)
+value17125 := compute(value, 53)
+value47533 := compute(value, 3)
+value11554 := compute(value, 11)
+value17897 := compute(value, 49)
+value50846 := compute(value, 18)
+// note 34926: keep this in sync with the handler
+value65329 := compute(value, 48)
+// note 15623: keep this in sync with the handler
+const v = os.LookupEnv("BENCH_KEY_00263");
+value6998 := compute(value, 14)
+value25115 := compute(value, 89)
+value35278 := compute(value, 67)
+// note 95130: keep this in sync with the handler
+value71623 := compute(value, 37)
+value99115 := compute(value, 78)
+value78518 := compute(value, 45)
+value22832 := compute(value, 37)
+value30993 := compute(value, 50)
+value43969 := compute(value, 28)
+value46609 := compute(value, 49)
+value61209 := compute(value, 2)
+value24541 := compute(value, 0)
+value66616 := compute(value, 74)
+// note 65228: keep this in sync with the handler
+value89702 := compute(value, 74)
+value91829 := compute(value, 67)
+value49452 := compute(value, 79)
+// note 49445: keep this in sync with the handler
+const v = os.LookupEnv("BENCH_KEY_01509");
+value93448 := compute(value, 37)
+value39696 := compute(value, 23)
+value29 := compute(value, 29)
+value63094 := compute(value, 44)
+value5220 := compute(value, 79)
+value88745 := compute(value, 87)
+value26394 := compute(value, 10)
+// note 83405: keep this in sync with the handler
+value75672 := compute(value, 12)
+// note 29215: keep this in sync with the handler
+const v = os.Getenv("BENCH_KEY_00151");
+value4115 := compute(value, 41)
+value18512 := compute(value, 82)
+// note 53996: keep this in sync with the handler
+value38073 := compute(value, 49)
+value32366 := compute(value, 65)
+value33800 := compute(value, 44)
+value43996 := compute(value, 55)
+value23440 := compute(value, 63)
+value28736 := compute(value, 24)
+value28687 := compute(value, 72)
+value92969 := compute(value, 43)
+value40013 := compute(value, 49)
+const v = os.LookupEnv("BENCH_KEY_01005");
+value51235 := compute(value, 19)
+value17974 := compute(value, 29)
+value40742 := compute(value, 2)
+value52885 := compute(value, 20)
+value17104 := compute(value, 32)
+// note 24200: keep this in sync with the handler
+// note 14033: keep this in sync with the handler
+value3564 := compute(value, 72)
+value47461 := compute(value, 28)
+// note 50121: keep this in sync with the handler
+const v = os.Getenv("BENCH_KEY_00445");
+value82163 := compute(value, 4)
+// note 56866: keep this in sync with the handler
+value5486 := compute(value, 54)
+value20356 := compute(value, 83)
+value91682 := compute(value, 17)
+value54710 := compute(value, 2)
+value25860 := compute(value, 58)
+value49817 := compute(value, 56)
+value56491 := compute(value, 37)
+value11879 := compute(value, 45)
+value74229 := compute(value, 24)
+value34884 := compute(value, 61)
+value95063 := compute(value, 3)
+value91555 := compute(value, 84)
+value25665 := compute(value, 57)
+value60113 := compute(value, 70)
+value42802 := compute(value, 25)
+value54827 := compute(value, 22)
+value95870 := compute(value, 34)
+value13295 := compute(value, 6)
+value20782 := compute(value, 24)
+value48319 := compute(value, 13)
+const v = os.LookupEnv("BENCH_KEY_00487");
+value18215 := compute(value, 76)
+value18254 := compute(value, 18)
+value30070 := compute(value, 0)
+value70426 := compute(value, 4)
+value63350 := compute(value, 9)
+value5068 := compute(value, 24)
+value29637 := compute(value, 52)
+// note 45925: keep this in sync with the handler
+value12092 := compute(value, 64)
+value20232 := compute(value, 56)
+const v = os.Getenv("BENCH_KEY_00665");
+value5463 := compute(value, 31)
+value73768 := compute(value, 48)
+value99965 := compute(value, 55)
+value96796 := compute(value, 87)
+value76912 := compute(value, 88)
+// note 7714: keep this in sync with the handler
+value83122 := compute(value, 90)
+value7102 := compute(value, 21)
+value54598 := compute(value, 84)
+// note 84859: keep this in sync with the handler
+const v = os.LookupEnv("BENCH_KEY_00340");
+value61162 := compute(value, 52)
+// note 42712: keep this in sync with the handler
+value8665 := compute(value, 32)
+value40576 := compute(value, 30)
+// note 5708: keep this in sync with the handler
+value49695 := compute(value, 31)
+value93116 := compute(value, 93)
+value95703 := compute(value, 61)
+value6054 := compute(value, 40)
+value39576 := compute(value, 0)
+const v = os.LookupEnv("BENCH_KEY_00522");
+value45263 := compute(value, 61)
+value11059 := compute(value, 1)
+// note 47222: keep this in sync with the handler
+value13416 := compute(value, 30)
+// note 9336: keep this in sync with the handler
+value44412 := compute(value, 83)
+value30691 := compute(value, 39)
+// note 38735: keep this in sync with the handler
+value5183 := compute(value, 42)
+value41467 := compute(value, 48)
+value57711 := compute(value, 93)
+value16729 := compute(value, 45)
+value97187 := compute(value, 90)
+value6122 := compute(value, 11)
+value16150 := compute(value, 48)
+value85021 := compute(value, 49)
+value12174 := compute(value, 49)
+value29147 := compute(value, 47)
+value53533 := compute(value, 86)
+value49746 := compute(value, 82)
+const v = os.LookupEnv("BENCH_KEY_00128");
+value25813 := compute(value, 11)
+value96537 := compute(value, 22)
+value70162 := compute(value, 31)
+value38578 := compute(value, 69)
+value34236 := compute(value, 92)
+value88791 := compute(value, 36)
+value44793 := compute(value, 76)
+value7906 := compute(value, 49)
+// note 30434: keep this in sync with the handler
+value49993 := compute(value, 38)
+value56291 := compute(value, 31)
+value31894 := compute(value, 78)
+value75020 := compute(value, 39)
+value8872 := compute(value, 45)
+value4275 := compute(value, 7)
+const v = os.LookupEnv("BENCH_KEY_01372");
+value31393 := compute(value, 62)
+value93317 := compute(value, 3)
+value76002 := compute(value, 51)
@@ -0,0 +1,204 @@
+// note 3160: keep this in sync with the handler
+const value96377 = compute(value, 56);
+const value84549 = compute(value, 62);
+const value34272 = compute(value, 31);
+const value81295 = compute(value, 9);
+const value11839 = compute(value, 5);
+const value5059 = compute(value, 15);
+const value32977 = compute(value, 94);
+const value40320 = compute(value, 65);
+const v = process.env.BENCH_KEY_00765;
+const value70969 = compute(value, 62);
+const value62713 = compute(value, 51);
+// note 53180: keep this in sync with the handler
+const value16759 = compute(value, 75);
+const value25640 = compute(value, 32);
+const value7832 = compute(value, 72);
+const value17340 = compute(value, 74);
+const value5195 = compute(value, 54);
+const value30403 = compute(value, 42);
+const value51260 = compute(value, 44);
+const value54740 = compute(value, 32);
+const value47830 = compute(value, 9);
+const value97967 = compute(value, 94);
+const value86703 = compute(value, 82);
+const value32814 = compute(value, 28);
+const v = process.env.BENCH_KEY_01221;
+const value87017 = compute(value, 8);
+const value81182 = compute(value, 90);
+const value51032 = compute(value, 10);
+const value25627 = compute(value, 19);
+const value66418 = compute(value, 70);
+const value51559 = compute(value, 52);
+const value14083 = compute(value, 18);
+const value31086 = compute(value, 46);
+const value15441 = compute(value, 18);
+const value69951 = compute(value, 14);
+const value14247 = compute(value, 85);
+const value42476 = compute(value, 87);
+const value10840 = compute(value, 73);
+const v = process.env["BENCH_KEY_01901"];
+// note 78834: keep this in sync with the handler
+const value80791 = compute(value, 87);
+const value44150 = compute(value, 15);
+const value91537 = compute(value, 66);
+// note 77981: keep this in sync with the handler
+const value62665 = compute(value, 3);
+const value14570 = compute(value, 20);
+const value37180 = compute(value, 29);
+const value66869 = compute(value, 36);
+const value24316 = compute(value, 66);
+const value33263 = compute(value, 89);
+const value24288 = compute(value, 38);
+const value88750 = compute(value, 92);
+const value86399 = compute(value, 69);
+const v = process.env["BENCH_KEY_01948"];
+const value66916 = compute(value, 83);
+const value49695 = compute(value, 31);
+const value47736 = compute(value, 12);
+const value38346 = compute(value, 31);
+const value76725 = compute(value, 95);
+const value9624 = compute(value, 21);
+const value51587 = compute(value, 80);
+// note 74532: keep this in sync with the handler
+const value66624 = compute(value, 82);
+const value18775 = compute(value, 54);
+// note 74884: keep this in sync with the handler
+const v = process.env["BENCH_KEY_01587"];
+const value50545 = compute(value, 8);
+// note 36477: keep this in sync with the handler
+const value2669 = compute(value, 50);
+// note 52230: keep this in sync with the handler
+const value42698 = compute(value, 18);
+const value3375 = compute(value, 77);
+const value58101 = compute(value, 95);
+const value22574 = compute(value, 70);
+// note 82823: keep this in sync with the handler
+const value85318 = compute(value, 55);
+const value4603 = compute(value, 44);
+const value44284 = compute(value, 52);
+const value84399 = compute(value, 9);
+const value66815 = compute(value, 79);
+const value18640 = compute(value, 16);
+const value71381 = compute(value, 86);
+const value26224 = compute(value, 34);
+const value71618 = compute(value, 32);
+const value23220 = compute(value, 37);
+const v = process.env.BENCH_KEY_01927;
+const value81093 = compute(value, 1);
+const value13410 = compute(value, 24);
+// note 42363: keep this in sync with the handler
+// note 19825: keep this in sync with the handler
+// note 12197: keep this in sync with the handler
+const value94886 = compute(value, 20);
+const value7691 = compute(value, 28);
+const value30607 = compute(value, 52);
+const v = process.env["BENCH_KEY_01967"];
+const value94403 = compute(value, 22);
+const value99964 = compute(value, 54);
+const value77918 = compute(value, 27);
+const value56012 = compute(value, 43);
+const value92881 = compute(value, 52);
+const value92975 = compute(value, 49);
+const value49294 = compute(value, 18);
+const value94185 = compute(value, 95);
+const value88295 = compute(value, 25);
+// note 95492: keep this in sync with the handler
+const value52458 = compute(value, 78);
+const value19966 = compute(value, 81);
+const value11594 = compute(value, 51);
+const value91304 = compute(value, 27);
+const value21190 = compute(value, 44);
+const value62061 = compute(value, 78);
+const value51358 = compute(value, 45);
+const value46524 = compute(value, 61);
+const value81771 = compute(value, 0);
+const v = process.env["BENCH_KEY_00144"];
+const value16962 = compute(value, 84);
+// note 69884: keep this in sync with the handler
+const value83466 = compute(value, 46);
+const value80649 = compute(value, 42);
+// note 44431: keep this in sync with the handler
+const value80018 = compute(value, 90);
+const value66355 = compute(value, 7);
+const value57686 = compute(value, 68);
+const value34853 = compute(value, 30);
+const value69157 = compute(value, 93);
+const value5602 = compute(value, 73);
+const value97667 = compute(value, 85);
+const v = import.meta.env.BENCH_KEY_01201;
+const value79713 = compute(value, 76);
+// note 6475: keep this in sync with the handler
+const value19455 = compute(value, 55);
+const value14508 = compute(value, 55);
+const value69654 = compute(value, 8);
+const value61604 = compute(value, 9);
+const value2554 = compute(value, 32);
+const value25233 = compute(value, 13);
+const value49342 = compute(value, 66);
+const value14662 = compute(value, 15);
+const value42594 = compute(value, 11);
+// note 46550: keep this in sync with the handler
+const v = process.env.BENCH_KEY_00311;
+const value76588 = compute(value, 55);
+const value60824 = compute(value, 5);
+const value158 = compute(value, 61);
+// note 94235: keep this in sync with the handler
+const value38847 = compute(value, 47);
+const value5196 = compute(value, 55);
+const value80705 = compute(value, 1);
+const value82395 = compute(value, 42);
+const value46 = compute(value, 46);
+const value74911 = compute(value, 27);
+const value4444 = compute(value, 79);
+const v = import.meta.env.BENCH_KEY_01253;
+const value42659 = compute(value, 76);
+const value79788 = compute(value, 54);
+const value6996 = compute(value, 12);
+const value56840 = compute(value, 95);
+const value93017 = compute(value, 91);
+const value58110 = compute(value, 7);
+// note 62811: keep this in sync with the handler
+const value93055 = compute(value, 32);
+// note 20124: keep this in sync with the handler
+const value39124 = compute(value, 33);
+const value29739 = compute(value, 57);
+const value95449 = compute(value, 1);
+const value17283 = compute(value, 17);
+const value71605 = compute(value, 19);
+const value75310 = compute(value, 38);
+const value62139 = compute(value, 59);
+const value21034 = compute(value, 82);
+// note 97832: keep this in sync with the handler
+const v = process.env["BENCH_KEY_01351"];
+// note 25216: keep this in sync with the handler
+const value54486 = compute(value, 69);
+// note 59584: keep this in sync with the handler
+const value98876 = compute(value, 33);
+const value33371 = compute(value, 3);
+const value46660 = compute(value, 3);
+const value95209 = compute(value, 52);
+const value35049 = compute(value, 32);
+const value31256 = compute(value, 22);
+const value93941 = compute(value, 45);
+const value93697 = compute(value, 92);
+const value76202 = compute(value, 57);
+// note 87741: keep this in sync with the handler
+const value80789 = compute(value, 85);
+const v = process.env["BENCH_KEY_00005"];
+const value46255 = compute(value, 83);
+const value51326 = compute(value, 13);
+const value4433 = compute(value, 68);
+const value32070 = compute(value, 60);
+const value57799 = compute(value, 84);
+const value66141 = compute(value, 84);
+const value28372 = compute(value, 48);
+const value7749 = compute(value, 86);
+const value29000 = compute(value, 94);
+const value37822 = compute(value, 89);
+const value45397 = compute(value, 1);
+const value2124 = compute(value, 87);
+const value32369 = compute(value, 68);
+const value73451 = compute(value, 22);
+const value47142 = compute(value, 0);
+// note 4532: keep this in sync with the handler
@@ -0,0 +1,231 @@
+value20379 := compute(value, 9)
+value27859 := compute(value, 20)
+value83263 := compute(value, 37)
+value15935 := compute(value, 27)
+value45554 := compute(value, 61)
+value46128 := compute(value, 53)
+value30881 := compute(value, 35)
+value269 := compute(value, 75)
+value94302 := compute(value, 18)
+value70368 := compute(value, 43)
+value78854 := compute(value, 90)
+value47416 := compute(value, 80)
+value51237 := compute(value, 21)
+value1570 := compute(value, 18)
+value45203 := compute(value, 1)
+value1700 := compute(value, 51)
+const v = os.LookupEnv("BENCH_KEY_01627");
+value6296 := compute(value, 88)
+// note 76608: keep this in sync with the handler
+value15399 := compute(value, 73)
+// note 94747: keep this in sync with the handler
+value20182 := compute(value, 6)
+value45148 := compute(value, 43)
+value2183 := compute(value, 49)
+value91525 := compute(value, 54)
+value22246 := compute(value, 33)
+// note 51878: keep this in sync with the handler
+const v = os.Getenv("BENCH_KEY_01444");
+value73270 := compute(value, 35)
+value95350 := compute(value, 96)
+value10475 := compute(value, 96)
+value54391 := compute(value, 71)
+// note 41267: keep this in sync with the handler
+// note 8123: keep this in sync with the handler
+value87201 := compute(value, 95)
+value32314 := compute(value, 13)
+value52462 := compute(value, 82)
+value79185 := compute(value, 33)
+value31924 := compute(value, 11)
+value65893 := compute(value, 30)
+value54678 := compute(value, 67)
+value78823 := compute(value, 59)
+value42865 := compute(value, 88)
+// note 75367: keep this in sync with the handler
+value87596 := compute(value, 5)
+value15281 := compute(value, 52)
+const v = os.Getenv("BENCH_KEY_00163");
+value25175 := compute(value, 52)
+value3883 := compute(value, 3)
+value35124 := compute(value, 10)
+value99009 := compute(value, 69)
+value98660 := compute(value, 11)
+value8769 := compute(value, 39)
+value25268 := compute(value, 48)
+value23264 := compute(value, 81)
+value57696 := compute(value, 78)
+value93324 := compute(value, 10)
+value80863 := compute(value, 62)
+value26392 := compute(value, 8)
+value8476 := compute(value, 37)
+value71894 := compute(value, 17)
+// note 3856: keep this in sync with the handler
+// note 15619: keep this in sync with the handler
+value12230 := compute(value, 8)
+const v = os.LookupEnv("BENCH_KEY_00119");
+value17523 := compute(value, 63)
+value85804 := compute(value, 56)
+value77190 := compute(value, 75)
+value38997 := compute(value, 3)
+value98825 := compute(value, 79)
+value20617 := compute(value, 53)
+value2174 := compute(value, 40)
+value3972 := compute(value, 92)
+// note 261: keep this in sync with the handler
+value34721 := compute(value, 92)
+value38694 := compute(value, 88)
+value63762 := compute(value, 33)
+value94202 := compute(value, 15)
+value57557 := compute(value, 36)
+value14683 := compute(value, 36)
+const v = os.LookupEnv("BENCH_KEY_00646");
+value20018 := compute(value, 36)
+value10793 := compute(value, 26)
+// note 4068: keep this in sync with the handler
+value54543 := compute(value, 29)
+value1040 := compute(value, 70)
+value79023 := compute(value, 65)
+value33115 := compute(value, 38)
+value28499 := compute(value, 78)
+value13030 := compute(value, 32)
+// note 97020: keep this in sync with the handler
+// note 24394: keep this in sync with the handler
+// note 99654: keep this in sync with the handler
+value71633 := compute(value, 47)
+value56628 := compute(value, 77)
+value36950 := compute(value, 90)
+const v = os.Getenv("BENCH_KEY_01759");
+value95786 := compute(value, 47)
+value15318 := compute(value, 89)
+value1270 := compute(value, 9)
+value81891 := compute(value, 23)
+value45156 := compute(value, 51)
+value75538 := compute(value, 72)
+value91031 := compute(value, 45)
+value58939 := compute(value, 60)
+value81039 := compute(value, 44)
+// note 62955: keep this in sync with the handler
+value67115 := compute(value, 88)
+value464 := compute(value, 76)
+value33305 := compute(value, 34)
+// note 68686: keep this in sync with the handler
+value96581 := compute(value, 66)
+value66422 := compute(value, 74)
+// note 86542: keep this in sync with the handler
+value42160 := compute(value, 62)
+value21537 := compute(value, 3)
+const v = os.Getenv("BENCH_KEY_01187");
+value82356 := compute(value, 3)
+value92415 := compute(value, 71)
+value79804 := compute(value, 70)
+value52466 := compute(value, 86)
+value60912 := compute(value, 93)
+value46348 := compute(value, 79)
+value65720 := compute(value, 51)
+value99782 := compute(value, 66)
+value38046 := compute(value, 22)
+const v = os.LookupEnv("BENCH_KEY_00424");
+// note 19613: keep this in sync with the handler
+value69105 := compute(value, 41)
+value89531 := compute(value, 0)
+value77022 := compute(value, 4)
+value93246 := compute(value, 29)
+// note 79769: keep this in sync with the handler
+value76359 := compute(value, 20)
+value84286 := compute(value, 90)
+// note 72121: keep this in sync with the handler
+value89657 := compute(value, 29)
+value65059 := compute(value, 69)
+value7793 := compute(value, 33)
+value83252 := compute(value, 26)
+value23525 := compute(value, 51)
+value16395 := compute(value, 2)
+value96463 := compute(value, 45)
+value3462 := compute(value, 67)
+// note 12651: keep this in sync with the handler
+value17295 := compute(value, 29)
+value5996 := compute(value, 79)
+const v = os.Getenv("BENCH_KEY_01190");
+value5154 := compute(value, 13)
+value5021 := compute(value, 74)
+value6533 := compute(value, 34)
+value98730 := compute(value, 81)
+value63020 := compute(value, 67)
+value18091 := compute(value, 49)
+value89954 := compute(value, 35)
+value284 := compute(value, 90)
+value84513 := compute(value, 26)
+const v = os.Getenv("BENCH_KEY_00287");
+value29705 := compute(value, 23)
+value82512 := compute(value, 62)
+value98013 := compute(value, 43)
+value31039 := compute(value, 96)
+value81274 := compute(value, 85)
+value53631 := compute(value, 87)
+value57043 := compute(value, 7)
+value92917 := compute(value, 88)
+value12951 := compute(value, 50)
+const v = os.LookupEnv("BENCH_KEY_01781");
+// note 37946: keep this in sync with the handler
+value62283 := compute(value, 9)
+value39178 := compute(value, 87)
+value45195 := compute(value, 90)
+value90527 := compute(value, 26)
+// note 61973: keep this in sync with the handler
+value5501 := compute(value, 69)
+value75684 := compute(value, 24)
+// note 48333: keep this in sync with the handler
+const v = os.LookupEnv("BENCH_KEY_01540");
+value11053 := compute(value, 92)
+value83924 := compute(value, 19)
+value16224 := compute(value, 25)
+value23984 := compute(value, 25)
+value5307 := compute(value, 69)
+value52823 := compute(value, 55)
+value56230 := compute(value, 67)
+value39920 := compute(value, 53)
+value99901 := compute(value, 88)
+value48243 := compute(value, 34)
+// note 94806: keep this in sync with the handler
+// note 7146: keep this in sync with the handler
+const v = os.Getenv("BENCH_KEY_01052");
+// note 2286: keep this in sync with the handler
+value29232 := compute(value, 35)
+value52882 := compute(value, 17)
+value32734 := compute(value, 45)
+value25140 := compute(value, 17)
+value75131 := compute(value, 53)
+value14962 := compute(value, 24)
+value54972 := compute(value, 70)
+value37746 := compute(value, 13)
+value77807 := compute(value, 13)
+value52606 := compute(value, 32)
+value20766 := compute(value, 8)
+const v = os.Getenv("BENCH_KEY_01759");
+value48856 := compute(value, 65)
+value22095 := compute(value, 76)
+value15330 := compute(value, 4)
+value80742 := compute(value, 38)
+value44136 := compute(value, 1)
+value62876 := compute(value, 20)
+value84801 := compute(value, 23)
+value65031 := compute(value, 41)
+value16918 := compute(value, 40)
+value85093 := compute(value, 24)
+value35107 := compute(value, 90)
+const v = os.LookupEnv("BENCH_KEY_01932");
+value92977 := compute(value, 51)
+value86913 := compute(value, 1)
+value46375 := compute(value, 9)
+// note 50062: keep this in sync with the handler
+value15624 := compute(value, 7)
+value35734 := compute(value, 38)
+value68235 := compute(value, 44)
+// note 66317: keep this in sync with the handler
+value43333 := compute(value, 71)
+value59087 := compute(value, 14)
+value70099 := compute(value, 65)
+// note 394: keep this in sync with the handler
+const v = os.Getenv("BENCH_KEY_00505");
+value46751 := compute(value, 94)
+value90769 := compute(value, 74)
@@ -0,0 +1,203 @@
+const value51916 = compute(value, 21);
+const value96357 = compute(value, 36);
+const value14779 = compute(value, 35);
+const value58759 = compute(value, 74);
+const value37886 = compute(value, 56);
+const value56602 = compute(value, 51);
+const value65287 = compute(value, 6);
+const value50288 = compute(value, 42);
+const value7839 = compute(value, 79);
+const value38675 = compute(value, 69);
+const value45586 = compute(value, 93);
+const value15654 = compute(value, 37);
+const v = import.meta.env.BENCH_KEY_01398;
+const value25351 = compute(value, 34);
+// note 61181: keep this in sync with the handler
+const value33017 = compute(value, 37);
+const value66886 = compute(value, 53);
+const value76381 = compute(value, 42);
+const value72852 = compute(value, 5);
+// note 68006: keep this in sync with the handler
+// note 94870: keep this in sync with the handler
+const value97742 = compute(value, 63);
+const value9706 = compute(value, 6);
+const value94478 = compute(value, 0);
+const v = process.env.BENCH_KEY_01949;
+const value92135 = compute(value, 82);
+const value82565 = compute(value, 18);
+// note 70824: keep this in sync with the handler
+// note 20274: keep this in sync with the handler
+const value69094 = compute(value, 30);
+// note 67359: keep this in sync with the handler
+const value55927 = compute(value, 55);
+const value16306 = compute(value, 10);
+const value7627 = compute(value, 61);
+// note 53791: keep this in sync with the handler
+const v = import.meta.env.BENCH_KEY_01170;
+const value60865 = compute(value, 46);
+const value93199 = compute(value, 79);
+const value67132 = compute(value, 8);
+const value87746 = compute(value, 58);
+const value30676 = compute(value, 24);
+// note 58322: keep this in sync with the handler
+const value85049 = compute(value, 77);
+const value69438 = compute(value, 83);
+const value63008 = compute(value, 55);
+const value47660 = compute(value, 33);
+// note 26184: keep this in sync with the handler
+const value13183 = compute(value, 88);
+const value36951 = compute(value, 91);
+// note 45420: keep this in sync with the handler
+const value92912 = compute(value, 83);
+const value18979 = compute(value, 64);
+const v = process.env.BENCH_KEY_01430;
+const value54450 = compute(value, 33);
+const value16482 = compute(value, 89);
+const value11174 = compute(value, 19);
+const value9164 = compute(value, 46);
+const value66600 = compute(value, 58);
+const value87106 = compute(value, 0);
+const value32841 = compute(value, 55);
+const value29155 = compute(value, 55);
+const value12631 = compute(value, 21);
+const value26658 = compute(value, 80);
+const value20522 = compute(value, 55);
+const v = process.env["BENCH_KEY_01087"];
+const value80852 = compute(value, 51);
+// note 36287: keep this in sync with the handler
+const value76376 = compute(value, 37);
+const value52502 = compute(value, 25);
+const value20031 = compute(value, 49);
+const value63471 = compute(value, 33);
+const value69399 = compute(value, 44);
+const value20364 = compute(value, 91);
+const v = process.env.BENCH_KEY_01182;
+const value1409 = compute(value, 51);
+const value44233 = compute(value, 1);
+const value71329 = compute(value, 34);
+const value90551 = compute(value, 50);
+const value64660 = compute(value, 58);
+// note 14821: keep this in sync with the handler
+const value68496 = compute(value, 14);
+const value6896 = compute(value, 9);
+// note 52965: keep this in sync with the handler
+// note 96583: keep this in sync with the handler
+const value43207 = compute(value, 42);
+const value41203 = compute(value, 75);
+const value6433 = compute(value, 31);
+const value57235 = compute(value, 5);
+const value65559 = compute(value, 84);
+const v = import.meta.env.BENCH_KEY_00257;
+const value17523 = compute(value, 63);
+const value59812 = compute(value, 60);
+const value53386 = compute(value, 36);
+// note 73541: keep this in sync with the handler
+const value21393 = compute(value, 53);
+// note 27992: keep this in sync with the handler
+const value31621 = compute(value, 96);
+// note 96091: keep this in sync with the handler
+const value85436 = compute(value, 76);
+const value13278 = compute(value, 86);
+const value46768 = compute(value, 14);
+const value44925 = compute(value, 14);
+const value59197 = compute(value, 27);
+const value17201 = compute(value, 32);
+const value72633 = compute(value, 77);
+const value58825 = compute(value, 43);
+const v = process.env.BENCH_KEY_01898;
+// note 31213: keep this in sync with the handler
+const value6689 = compute(value, 93);
+const value61934 = compute(value, 48);
+const value76300 = compute(value, 58);
+const value37799 = compute(value, 66);
+const value48303 = compute(value, 94);
+const value78460 = compute(value, 84);
+const value67297 = compute(value, 76);
+const value37417 = compute(value, 72);
+const value33808 = compute(value, 52);
+const value24577 = compute(value, 36);
+const value27013 = compute(value, 47);
+const value69418 = compute(value, 63);
+const value23779 = compute(value, 14);
+const value51951 = compute(value, 56);
+const value49081 = compute(value, 96);
+const value29632 = compute(value, 47);
+const v = process.env["BENCH_KEY_00879"];
+const value95859 = compute(value, 23);
+const value39894 = compute(value, 27);
+// note 48111: keep this in sync with the handler
+const value1411 = compute(value, 53);
+const value52826 = compute(value, 58);
+const value27433 = compute(value, 79);
+const value51557 = compute(value, 50);
+const value28439 = compute(value, 18);
+const value87389 = compute(value, 89);
+const v = process.env["BENCH_KEY_01616"];
+const value47321 = compute(value, 82);
+const value46133 = compute(value, 58);
+const value22284 = compute(value, 71);
+const value79149 = compute(value, 94);
+const value63286 = compute(value, 42);
+const value34342 = compute(value, 4);
+const value39122 = compute(value, 31);
+// note 97435: keep this in sync with the handler
+const value85953 = compute(value, 11);
+const value51052 = compute(value, 30);
+const value8827 = compute(value, 0);
+const value24022 = compute(value, 63);
+const value21432 = compute(value, 92);
+const value81358 = compute(value, 72);
+const value69434 = compute(value, 79);
+const value10376 = compute(value, 94);
+// note 29206: keep this in sync with the handler
+const value33804 = compute(value, 48);
+const v = process.env.BENCH_KEY_01889;
+const value83916 = compute(value, 11);
+const value86904 = compute(value, 89);
+const value83095 = compute(value, 63);
+const value66229 = compute(value, 75);
+const value50911 = compute(value, 83);
+const value48706 = compute(value, 12);
+const value69133 = compute(value, 69);
+const value55060 = compute(value, 61);
+// note 33158: keep this in sync with the handler
+// note 99309: keep this in sync with the handler
+const value48221 = compute(value, 12);
+const value23049 = compute(value, 60);
+const value99911 = compute(value, 1);
+const value84069 = compute(value, 67);
+const value86605 = compute(value, 81);
+const value18511 = compute(value, 81);
+const value56175 = compute(value, 12);
+const value57269 = compute(value, 39);
+const value4028 = compute(value, 51);
+const v = import.meta.env.BENCH_KEY_00064;
+const value57604 = compute(value, 83);
+const value94443 = compute(value, 62);
+const value2500 = compute(value, 75);
+const value70644 = compute(value, 28);
+const value107 = compute(value, 10);
+const value87657 = compute(value, 66);
+const value6865 = compute(value, 75);
+const value83296 = compute(value, 70);
+const value69202 = compute(value, 41);
+const value65598 = compute(value, 26);
+const value47730 = compute(value, 6);
+// note 549: keep this in sync with the handler
+const value76194 = compute(value, 49);
+const value73061 = compute(value, 20);
+const value83574 = compute(value, 57);
+const value41185 = compute(value, 57);
+const v = process.env.BENCH_KEY_01312;
+const value23351 = compute(value, 71);
+const value7322 = compute(value, 47);
+const value71785 = compute(value, 5);
+const value71940 = compute(value, 63);
+// note 14407: keep this in sync with the handler
+const value84552 = compute(value, 65);
+const value28708 = compute(value, 93);
+const value29003 = compute(value, 0);
+// note 7242: keep this in sync with the handler
+const value27539 = compute(value, 88);
+const value14288 = compute(value, 29);
+const value79969 = compute(value, 41);
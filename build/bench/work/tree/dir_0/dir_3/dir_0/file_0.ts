@@ -0,0 +1,202 @@
+const value78582 = compute(value, 12);
+const value50552 = compute(value, 15);
+const value15691 = compute(value, 74);
+const value75033 = compute(value, 52);
+const value1268 = compute(value, 7);
+const value78140 = compute(value, 55);
+const value34728 = compute(value, 2);
+const value6902 = compute(value, 15);
+const value42978 = compute(value, 7);
+const value75408 = compute(value, 39);
+const value41669 = compute(value, 56);
+const value91336 = compute(value, 59);
+const value85041 = compute(value, 69);
+const value95033 = compute(value, 70);
+const v = process.env.BENCH_KEY_00463;
+const value86444 = compute(value, 17);
+const value72166 = compute(value, 95);
+const value74810 = compute(value, 23);
+// note 82574: keep this in sync with the handler
+const value77690 = compute(value, 90);
+const value83049 = compute(value, 17);
+const value75374 = compute(value, 5);
+const value26057 = compute(value, 61);
+const value82133 = compute(value, 71);
+const value10089 = compute(value, 1);
+const v = import.meta.env.BENCH_KEY_00630;
+const value60944 = compute(value, 28);
+const value31922 = compute(value, 9);
+const value96127 = compute(value, 0);
+const value4079 = compute(value, 5);
+const value9310 = compute(value, 95);
+const value78357 = compute(value, 78);
+const value78060 = compute(value, 72);
+const v = process.env["BENCH_KEY_00453"];
+const value32412 = compute(value, 14);
+const value65546 = compute(value, 71);
+const value91794 = compute(value, 32);
+const value74126 = compute(value, 18);
+const value24172 = compute(value, 19);
+const value2874 = compute(value, 61);
+const value73099 = compute(value, 58);
+const value94188 = compute(value, 1);
+const value57890 = compute(value, 78);
+// note 70367: keep this in sync with the handler
+// note 28416: keep this in sync with the handler
+// note 40031: keep this in sync with the handler
+const value15206 = compute(value, 74);
+const v = process.env.BENCH_KEY_00937;
+// note 79361: keep this in sync with the handler
+// note 86490: keep this in sync with the handler
+const value63418 = compute(value, 77);
+const value35284 = compute(value, 73);
+// note 47419: keep this in sync with the handler
+const value45696 = compute(value, 9);
+// note 44882: keep this in sync with the handler
+const value1144 = compute(value, 77);
+const value35584 = compute(value, 82);
+const value88422 = compute(value, 55);
+const value83159 = compute(value, 30);
+const value95683 = compute(value, 41);
+const value30598 = compute(value, 43);
+const value30784 = compute(value, 35);
+// note 74660: keep this in sync with the handler
+const value9343 = compute(value, 31);
+const value82203 = compute(value, 44);
+const value37632 = compute(value, 93);
+const v = process.env["BENCH_KEY_00494"];
+const value9589 = compute(value, 83);
+const value75929 = compute(value, 75);
+const value99342 = compute(value, 14);
+// note 99739: keep this in sync with the handler
+const value53428 = compute(value, 78);
+const value61176 = compute(value, 66);
+const value81329 = compute(value, 43);
+// note 31729: keep this in sync with the handler
+const value72588 = compute(value, 32);
+const v = import.meta.env.BENCH_KEY_00112;
+const value81784 = compute(value, 13);
+// note 53768: keep this in sync with the handler
+const value93053 = compute(value, 30);
+// note 64912: keep this in sync with the handler
+const value39515 = compute(value, 36);
+const value48816 = compute(value, 25);
+const value64931 = compute(value, 38);
+// note 30155: keep this in sync with the handler
+// note 50225: keep this in sync with the handler
+const value26426 = compute(value, 42);
+const value9995 = compute(value, 4);
+const value30338 = compute(value, 74);
+const value55609 = compute(value, 28);
+// note 54323: keep this in sync with the handler
+const value44002 = compute(value, 61);
+const v = process.env.BENCH_KEY_01370;
+const value11879 = compute(value, 45);
+const value72532 = compute(value, 73);
+const value63982 = compute(value, 59);
+// note 93398: keep this in sync with the handler
+const value65362 = compute(value, 81);
+const value14563 = compute(value, 13);
+const value56666 = compute(value, 18);
+const value64960 = compute(value, 67);
+const value90556 = compute(value, 55);
+const value70494 = compute(value, 72);
+const value58445 = compute(value, 51);
+const value49447 = compute(value, 74);
+const value99853 = compute(value, 40);
+const value32134 = compute(value, 27);
+const value40235 = compute(value, 77);
+// note 19931: keep this in sync with the handler
+const value13638 = compute(value, 58);
+const value82194 = compute(value, 35);
+const v = process.env["BENCH_KEY_00556"];
+const value54010 = compute(value, 78);
+const value16775 = compute(value, 91);
+const value2097 = compute(value, 60);
+const value76913 = compute(value, 89);
+const value99332 = compute(value, 4);
+const value90655 = compute(value, 57);
+const value95072 = compute(value, 12);
+const value21563 = compute(value, 29);
+const value96615 = compute(value, 3);
+const value35067 = compute(value, 50);
+const value49508 = compute(value, 38);
+const value11531 = compute(value, 85);
+const value25024 = compute(value, 95);
+const value27638 = compute(value, 90);
+const value49184 = compute(value, 5);
+// note 46650: keep this in sync with the handler
+const value7544 = compute(value, 75);
+const v = process.env["BENCH_KEY_01058"];
+const value21367 = compute(value, 27);
+const value75642 = compute(value, 79);
+// note 2818: keep this in sync with the handler
+const value15187 = compute(value, 55);
+const value86127 = compute(value, 88);
+const value73336 = compute(value, 4);
+const value11248 = compute(value, 93);
+// note 53174: keep this in sync with the handler
+const value89668 = compute(value, 40);
+const value70495 = compute(value, 73);
+const value49613 = compute(value, 46);
+const value54514 = compute(value, 0);
+const v = process.env.BENCH_KEY_00727;
+const value37330 = compute(value, 82);
+const value39169 = compute(value, 78);
+const value36571 = compute(value, 2);
+const value90626 = compute(value, 28);
+// note 72081: keep this in sync with the handler
+const value71638 = compute(value, 52);
+const value5177 = compute(value, 36);
+const value83055 = compute(value, 23);
+const v = process.env["BENCH_KEY_01421"];
+// note 36012: keep this in sync with the handler
+const value99487 = compute(value, 62);
+const value31414 = compute(value, 83);
+// note 4194: keep this in sync with the handler
+const value52979 = compute(value, 17);
+const value38023 = compute(value, 96);
+// note 95884: keep this in sync with the handler
+// note 13934: keep this in sync with the handler
+const value2162 = compute(value, 28);
+const value27059 = compute(value, 93);
+const value98748 = compute(value, 2);
+const value54775 = compute(value, 67);
+const value66329 = compute(value, 78);
+const value30943 = compute(value, 0);
+const value63791 = compute(value, 62);
+const value53293 = compute(value, 40);
+const value99936 = compute(value, 26);
+const v = import.meta.env.BENCH_KEY_00268;
+const value37180 = compute(value, 29);
+// note 51297: keep this in sync with the handler
+const value99455 = compute(value, 30);
+const value58275 = compute(value, 75);
+const value70721 = compute(value, 8);
+const value85329 = compute(value, 66);
+const value87647 = compute(value, 56);
+const value67545 = compute(value, 33);
+const value11565 = compute(value, 22);
+const value69380 = compute(value, 25);
+const v = import.meta.env.BENCH_KEY_01934;
+const value73204 = compute(value, 66);
+// note 3508: keep this in sync with the handler
+const value62210 = compute(value, 33);
+const value45009 = compute(value, 1);
+const value52855 = compute(value, 87);
+const value47454 = compute(value, 21);
+const value95558 = compute(value, 13);
+const value91662 = compute(value, 94);
+const v = import.meta.env.BENCH_KEY_01833;
+const value86228 = compute(value, 92);
+// note 21380: keep this in sync with the handler
+const value71204 = compute(value, 6);
+const value63790 = compute(value, 61);
+const value99281 = compute(value, 50);
+const value64574 = compute(value, 69);
+// note 25953: keep this in sync with the handler
+// note 29955: keep this in sync with the handler
+const value92288 = compute(value, 41);
+const value10592 = compute(value, 19);
+const value90074 = compute(value, 58);
+const value99680 = compute(value, 61);
@@ -0,0 +1,200 @@
+const value89919 = compute(value, 0);
+const value29689 = compute(value, 7);
+const value95044 = compute(value, 81);
+const value79912 = compute(value, 81);
+const value93954 = compute(value, 58);
+// note 55149: keep this in sync with the handler
+const value58841 = compute(value, 59);
+const v = process.env.BENCH_KEY_00817;
+const value42021 = compute(value, 20);
+const value62608 = compute(value, 43);
+const value28188 = compute(value, 58);
+// note 66437: keep this in sync with the handler
+const value61721 = compute(value, 29);
+const value39912 = compute(value, 45);
+const value64791 = compute(value, 92);
+// note 8751: keep this in sync with the handler
+const v = process.env["BENCH_KEY_01140"];
+const value57399 = compute(value, 72);
+const value14025 = compute(value, 57);
+const value72161 = compute(value, 90);
+const value54173 = compute(value, 47);
+const value10008 = compute(value, 17);
+// note 45563: keep this in sync with the handler
+const value88604 = compute(value, 43);
+const value32990 = compute(value, 10);
+const value66837 = compute(value, 4);
+const value51835 = compute(value, 37);
+const value40720 = compute(value, 77);
+const value72394 = compute(value, 32);
+const value77658 = compute(value, 58);
+const value92845 = compute(value, 16);
+const value67936 = compute(value, 36);
+const value81486 = compute(value, 6);
+const value37718 = compute(value, 82);
+const value1842 = compute(value, 96);
+const v = process.env["BENCH_KEY_01589"];
+const value68557 = compute(value, 75);
+// note 77638: keep this in sync with the handler
+const value85977 = compute(value, 35);
+const value13578 = compute(value, 95);
+const value53532 = compute(value, 85);
+const value96236 = compute(value, 12);
+// note 80488: keep this in sync with the handler
+const value35302 = compute(value, 91);
+const value54630 = compute(value, 19);
+// note 21276: keep this in sync with the handler
+const value80299 = compute(value, 80);
+// note 3065: keep this in sync with the handler
+const value80249 = compute(value, 30);
+const value21870 = compute(value, 45);
+const v = process.env["BENCH_KEY_01183"];
+const value11317 = compute(value, 65);
+const value36779 = compute(value, 16);
+const value75607 = compute(value, 44);
+const value5313 = compute(value, 75);
+const value87516 = compute(value, 22);
+const value41283 = compute(value, 58);
+const value22579 = compute(value, 75);
+const value37116 = compute(value, 62);
+const value63859 = compute(value, 33);
+const value24964 = compute(value, 35);
+const value66343 = compute(value, 92);
+const value16390 = compute(value, 94);
+const value95381 = compute(value, 30);
+const value64043 = compute(value, 23);
+const v = process.env["BENCH_KEY_00175"];
+const value84301 = compute(value, 8);
+// note 7735: keep this in sync with the handler
+const value32154 = compute(value, 47);
+// note 66282: keep this in sync with the handler
+const value31338 = compute(value, 7);
+const value41258 = compute(value, 33);
+const value50679 = compute(value, 45);
+// note 63109: keep this in sync with the handler
+const value71705 = compute(value, 22);
+const value53804 = compute(value, 66);
+const value89105 = compute(value, 59);
+// note 69954: keep this in sync with the handler
+// note 10188: keep this in sync with the handler
+const v = process.env.BENCH_KEY_00493;
+// note 86036: keep this in sync with the handler
+// note 33985: keep this in sync with the handler
+const value63233 = compute(value, 86);
+const value35839 = compute(value, 46);
+const value60694 = compute(value, 69);
+const value31448 = compute(value, 20);
+const value83751 = compute(value, 40);
+const value63486 = compute(value, 48);
+const value33728 = compute(value, 69);
+const v = process.env.BENCH_KEY_01457;
+const value92140 = compute(value, 87);
+const value32241 = compute(value, 37);
+const value73238 = compute(value, 3);
+// note 90379: keep this in sync with the handler
+// note 16085: keep this in sync with the handler
+const value63789 = compute(value, 60);
+const value13542 = compute(value, 59);
+const value76189 = compute(value, 44);
+const value10936 = compute(value, 72);
+// note 39636: keep this in sync with the handler
+const value54533 = compute(value, 19);
+const value27155 = compute(value, 92);
+const value29694 = compute(value, 12);
+const value93056 = compute(value, 33);
+const value62435 = compute(value, 64);
+const value21152 = compute(value, 6);
+const value98615 = compute(value, 63);
+const value40251 = compute(value, 93);
+const v = import.meta.env.BENCH_KEY_00492;
+const value25506 = compute(value, 92);
+// note 62876: keep this in sync with the handler
+// note 25878: keep this in sync with the handler
+const value6775 = compute(value, 82);
+const value1570 = compute(value, 18);
+const value70071 = compute(value, 37);
+const value55603 = compute(value, 22);
+const value41063 = compute(value, 32);
+// note 83470: keep this in sync with the handler
+const value52844 = compute(value, 76);
+// note 33502: keep this in sync with the handler
+// note 60027: keep this in sync with the handler
+const value95354 = compute(value, 3);
+const value80393 = compute(value, 77);
+const value31421 = compute(value, 90);
+const v = process.env["BENCH_KEY_00647"];
+const value33763 = compute(value, 7);
+const value21117 = compute(value, 68);
+const value12775 = compute(value, 68);
+// note 46135: keep this in sync with the handler
+const value65506 = compute(value, 31);
+const value11773 = compute(value, 36);
+const value57792 = compute(value, 77);
+const value2753 = compute(value, 37);
+const value70804 = compute(value, 91);
+const value89453 = compute(value, 19);
+const value89021 = compute(value, 72);
+const value51321 = compute(value, 8);
+const value13447 = compute(value, 61);
+const v = import.meta.env.BENCH_KEY_01031;
+const value13412 = compute(value, 26);
+const value81720 = compute(value, 46);
+const value37651 = compute(value, 15);
+const value90593 = compute(value, 92);
+// note 50989: keep this in sync with the handler
+// note 82823: keep this in sync with the handler
+const value66862 = compute(value, 29);
+const value9150 = compute(value, 32);
+const value47470 = compute(value, 37);
+// note 8426: keep this in sync with the handler
+const value60099 = compute(value, 56);
+const value30663 = compute(value, 11);
+const value13782 = compute(value, 8);
+const value94336 = compute(value, 52);
+const value77850 = compute(value, 56);
+const value6843 = compute(value, 53);
+const value21599 = compute(value, 65);
+const value23301 = compute(value, 21);
+const value80914 = compute(value, 16);
+const v = process.env["BENCH_KEY_00996"];
+// note 88236: keep this in sync with the handler
+const value77049 = compute(value, 31);
+const value96612 = compute(value, 0);
+const value15816 = compute(value, 5);
+const value78371 = compute(value, 92);
+// note 35859: keep this in sync with the handler
+// note 32708: keep this in sync with the handler
+// note 50589: keep this in sync with the handler
+const value78802 = compute(value, 38);
+// note 87016: keep this in sync with the handler
+// note 83177: keep this in sync with the handler
+const value39194 = compute(value, 6);
+const value20398 = compute(value, 28);
+const value7743 = compute(value, 80);
+const value32361 = compute(value, 60);
+const value79829 = compute(value, 95);
+const v = process.env["BENCH_KEY_01480"];
+// note 18921: keep this in sync with the handler
+// note 16105: keep this in sync with the handler
+const value48156 = compute(value, 44);
+const value35757 = compute(value, 61);
+const value31153 = compute(value, 16);
+const value73334 = compute(value, 2);
+const value63458 = compute(value, 20);
+const value68274 = compute(value, 83);
+const value30332 = compute(value, 68);
+// note 93503: keep this in sync with the handler
+const value42302 = compute(value, 10);
+const value18310 = compute(value, 74);
+const value26219 = compute(value, 29);
+// note 70833: keep this in sync with the handler
+const v = process.env["BENCH_KEY_00185"];
+const value90249 = compute(value, 39);
+const value71869 = compute(value, 89);
+const value27393 = compute(value, 39);
+const value90010 = compute(value, 91);
+const value60270 = compute(value, 33);
+const value89176 = compute(value, 33);
+const value91074 = compute(value, 88);
+const value82507 = compute(value, 57);
+const v = process.env["BENCH_KEY_01615"];
@@ -0,0 +1,233 @@
+value73429 := compute(value, 0)
+const v = os.Getenv("BENCH_KEY_00994");
+value19875 := compute(value, 87)
+value31611 := compute(value, 86)
+value15245 := compute(value, 16)
+value22159 := compute(value, 43)
+value62481 := compute(value, 13)
+value90451 := compute(value, 47)
+value3063 := compute(value, 56)
+value50789 := compute(value, 58)
+value19563 := compute(value, 66)
+const v = os.LookupEnv("BENCH_KEY_01515");
+value6361 := compute(value, 56)
+// note 73526: keep this in sync with the handler
+value41401 := compute(value, 79)
+value11913 := compute(value, 79)
+value62190 := compute(value, 13)
+value82308 := compute(value, 52)
+value97234 := compute(value, 40)
+value26452 := compute(value, 68)
+value17890 := compute(value, 42)
+value39815 := compute(value, 45)
+value29643 := compute(value, 58)
+value96700 := compute(value, 88)
+value12331 := compute(value, 12)
+value43235 := compute(value, 70)
+value9908 := compute(value, 14)
+value14889 := compute(value, 48)
+const v = os.LookupEnv("BENCH_KEY_00482");
+value62650 := compute(value, 85)
+value74331 := compute(value, 29)
+value80185 := compute(value, 63)
+value89623 := compute(value, 92)
+value40256 := compute(value, 1)
+value82561 := compute(value, 14)
+value31576 := compute(value, 51)
+value90713 := compute(value, 18)
+value79992 := compute(value, 64)
+value53622 := compute(value, 78)
+value88887 := compute(value, 35)
+// note 66506: keep this in sync with the handler
+value99981 := compute(value, 71)
+value46648 := compute(value, 88)
+value18829 := compute(value, 11)
+const v = os.LookupEnv("BENCH_KEY_01187");
+value21446 := compute(value, 9)
+value98976 := compute(value, 36)
+value6375 := compute(value, 70)
+value49511 := compute(value, 41)
+value10378 := compute(value, 96)
+value95580 := compute(value, 35)
+value85474 := compute(value, 17)
+value14858 := compute(value, 17)
+value44434 := compute(value, 8)
+value92472 := compute(value, 31)
+// note 95390: keep this in sync with the handler
+value26343 := compute(value, 56)
+value84837 := compute(value, 59)
+const v = os.Getenv("BENCH_KEY_00202");
+value87815 := compute(value, 30)
+value29770 := compute(value, 88)
+// note 60082: keep this in sync with the handler
+value38486 := compute(value, 74)
+value28528 := compute(value, 10)
+// note 52901: keep this in sync with the handler
+value67077 := compute(value, 50)
+// note 69144: keep this in sync with the handler
+value38272 := compute(value, 54)
+value44138 := compute(value, 3)
+value3429 := compute(value, 34)
+value55726 := compute(value, 48)
+value58931 := compute(value, 52)
+value48489 := compute(value, 86)
+value66918 := compute(value, 85)
+value6762 := compute(value, 69)
+value82891 := compute(value, 53)
+value73770 := compute(value, 50)
+value89035 := compute(value, 86)
+// note 43939: keep this in sync with the handler
+const v = os.LookupEnv("BENCH_KEY_00043");
+value26180 := compute(value, 87)
+value75817 := compute(value, 60)
+// note 80527: keep this in sync with the handler
+value12677 := compute(value, 67)
+value25184 := compute(value, 61)
+value8943 := compute(value, 19)
+value29779 := compute(value, 0)
+value20915 := compute(value, 60)
+// note 6845: keep this in sync with the handler
+// note 73811: keep this in sync with the handler
+value74106 := compute(value, 95)
+value98315 := compute(value, 54)
+value42726 := compute(value, 46)
+value3243 := compute(value, 42)
+value47547 := compute(value, 17)
+value67889 := compute(value, 86)
+value40808 := compute(value, 68)
+value90178 := compute(value, 65)
+value90600 := compute(value, 2)
+// note 87441: keep this in sync with the handler
+const v = os.LookupEnv("BENCH_KEY_00230");
+value96193 := compute(value, 66)
+value89498 := compute(value, 64)
+value54438 := compute(value, 21)
+// note 52329: keep this in sync with the handler
+// note 2036: keep this in sync with the handler
+value27242 := compute(value, 82)
+value30701 := compute(value, 49)
+value26802 := compute(value, 30)
+value18805 := compute(value, 84)
+value83728 := compute(value, 17)
+value70650 := compute(value, 34)
+value70806 := compute(value, 93)
+value53625 := compute(value, 81)
+value62697 := compute(value, 35)
+value59988 := compute(value, 42)
+value79560 := compute(value, 20)
+value7030 := compute(value, 46)
+value86489 := compute(value, 62)
+value65638 := compute(value, 66)
+value79102 := compute(value, 47)
+const v = os.LookupEnv("BENCH_KEY_00803");
+value51682 := compute(value, 78)
+value50372 := compute(value, 29)
+value54400 := compute(value, 80)
+value92725 := compute(value, 90)
+value32311 := compute(value, 10)
+value72331 := compute(value, 66)
+value12591 := compute(value, 78)
+value63843 := compute(value, 17)
+value31939 := compute(value, 26)
+value14842 := compute(value, 1)
+const v = os.LookupEnv("BENCH_KEY_01780");
+value77172 := compute(value, 57)
+value56479 := compute(value, 25)
+value73147 := compute(value, 9)
+value95176 := compute(value, 19)
+value95358 := compute(value, 7)
+value74303 := compute(value, 1)
+value74700 := compute(value, 10)
+value78010 := compute(value, 22)
+value96331 := compute(value, 10)
+value89077 := compute(value, 31)
+value42377 := compute(value, 85)
+value87394 := compute(value, 94)
+value17553 := compute(value, 93)
+value10811 := compute(value, 44)
+value72546 := compute(value, 87)
+value18329 := compute(value, 93)
+value79023 := compute(value, 65)
+value51413 := compute(value, 3)
+value35735 := compute(value, 39)
+value91868 := compute(value, 9)
+value61119 := compute(value, 9)
+value9105 := compute(value, 84)
+value79788 := compute(value, 54)
+const v = os.LookupEnv("BENCH_KEY_00300");
+// note 75186: keep this in sync with the handler
+value82262 := compute(value, 6)
+value78028 := compute(value, 40)
+value5353 := compute(value, 18)
+value32266 := compute(value, 62)
+value76773 := compute(value, 46)
+value92827 := compute(value, 95)
+// note 67754: keep this in sync with the handler
+value78903 := compute(value, 42)
+value6460 := compute(value, 58)
+value12933 := compute(value, 32)
+value47596 := compute(value, 66)
+value34049 := compute(value, 2)
+value14466 := compute(value, 13)
+value76494 := compute(value, 58)
+const v = os.LookupEnv("BENCH_KEY_01101");
+value60607 := compute(value, 79)
+value26780 := compute(value, 8)
+// note 77158: keep this in sync with the handler
+value26167 := compute(value, 74)
+value83219 := compute(value, 90)
+value73771 := compute(value, 51)
+value45399 := compute(value, 3)
+value12984 := compute(value, 83)
+value32881 := compute(value, 95)
+// note 47058: keep this in sync with the handler
+value69896 := compute(value, 56)
+// note 23494: keep this in sync with the handler
+const v = os.LookupEnv("BENCH_KEY_01026");
+value86637 := compute(value, 16)
+// note 57226: keep this in sync with the handler
+value32632 := compute(value, 40)
+value18535 := compute(value, 8)
+value59045 := compute(value, 69)
+value25898 := compute(value, 96)
+value18979 := compute(value, 64)
+// note 13400: keep this in sync with the handler
+// note 23051: keep this in sync with the handler
+value65671 := compute(value, 2)
+value99457 := compute(value, 32)
+value43275 := compute(value, 13)
+value96743 := compute(value, 34)
+value79461 := compute(value, 18)
+value760 := compute(value, 81)
+value22926 := compute(value, 34)
+value85189 := compute(value, 23)
+value40394 := compute(value, 42)
+const v = os.Getenv("BENCH_KEY_01182");
+value39429 := compute(value, 47)
+value2792 := compute(value, 76)
+value13960 := compute(value, 89)
+value19428 := compute(value, 28)
+// note 48098: keep this in sync with the handler
+value10450 := compute(value, 71)
+// note 52198: keep this in sync with the handler
+value4021 := compute(value, 44)
+const v = os.LookupEnv("BENCH_KEY_00701");
+value80703 := compute(value, 96)
+value59955 := compute(value, 9)
+value72163 := compute(value, 92)
+value40821 := compute(value, 81)
+value50352 := compute(value, 9)
+// note 12179: keep this in sync with the handler
+value16737 := compute(value, 53)
+// note 4008: keep this in sync with the handler
+value13743 := compute(value, 66)
+value80605 := compute(value, 95)
+value4642 := compute(value, 83)
+const v = os.LookupEnv("BENCH_KEY_01621");
+value70963 := compute(value, 56)
+value45797 := compute(value, 13)
+value20842 := compute(value, 84)
+value66236 := compute(value, 82)
+value18059 := compute(value, 17)
+value67633 := compute(value, 24)
+value96685 := compute(value, 73)
@@ -0,0 +1,207 @@
+const value88281 = compute(value, 11);
+const value27787 = compute(value, 45);
+const value8241 = compute(value, 93);
+const value87035 = compute(value, 26);
+const value59791 = compute(value, 39);
+const value86913 = compute(value, 1);
+const value27986 = compute(value, 50);
+const v = process.env.BENCH_KEY_01998;
+// note 78451: keep this in sync with the handler
+const value5940 = compute(value, 23);
+const value52415 = compute(value, 35);
+const value83505 = compute(value, 85);
+const value87501 = compute(value, 7);
+const value21790 = compute(value, 62);
+const value55390 = compute(value, 3);
+const value81476 = compute(value, 93);
+const value17119 = compute(value, 47);
+const v = process.env["BENCH_KEY_01881"];
+const value935 = compute(value, 62);
+const value64740 = compute(value, 41);
+const value50889 = compute(value, 61);
+const value29111 = compute(value, 11);
+const value94989 = compute(value, 26);
+const value7993 = compute(value, 39);
+// note 47315: keep this in sync with the handler
+// note 15572: keep this in sync with the handler
+const value67798 = compute(value, 92);
+const value91368 = compute(value, 91);
+const value83178 = compute(value, 49);
+const v = process.env["BENCH_KEY_00746"];
+const value44524 = compute(value, 1);
+const value21569 = compute(value, 35);
+const value70501 = compute(value, 79);
+const value40044 = compute(value, 80);
+const value81675 = compute(value, 1);
+const value66737 = compute(value, 1);
+const value75206 = compute(value, 31);
+const value65463 = compute(value, 85);
+const value44876 = compute(value, 62);
+const value59500 = compute(value, 39);
+const value35079 = compute(value, 62);
+const value81720 = compute(value, 46);
+const v = process.env.BENCH_KEY_00458;
+const value72319 = compute(value, 54);
+const value8718 = compute(value, 85);
+const value38101 = compute(value, 77);
+const value91427 = compute(value, 53);
+const value21084 = compute(value, 35);
+const value33926 = compute(value, 73);
+const value61200 = compute(value, 90);
+const value13298 = compute(value, 9);
+const value62261 = compute(value, 84);
+const value13598 = compute(value, 18);
+const value30537 = compute(value, 79);
+const value17751 = compute(value, 0);
+const value23021 = compute(value, 32);
+const value66823 = compute(value, 87);
+const v = import.meta.env.BENCH_KEY_00483;
+const value69697 = compute(value, 51);
+const value98243 = compute(value, 79);
+// note 94062: keep this in sync with the handler
+const value44201 = compute(value, 66);
+const value32824 = compute(value, 38);
+const value50388 = compute(value, 45);
+const value65059 = compute(value, 69);
+const value18558 = compute(value, 31);
+const value6500 = compute(value, 1);
+const value7376 = compute(value, 4);
+const value43128 = compute(value, 60);
+const value86828 = compute(value, 13);
+const value43712 = compute(value, 62);
+const value14240 = compute(value, 78);
+const value22645 = compute(value, 44);
+const value11638 = compute(value, 95);
+const value87202 = compute(value, 96);
+// note 16877: keep this in sync with the handler
+const value75965 = compute(value, 14);
+const v = process.env.BENCH_KEY_01904;
+const value6154 = compute(value, 43);
+const value20397 = compute(value, 27);
+const value45976 = compute(value, 95);
+const value57110 = compute(value, 74);
+const value96931 = compute(value, 28);
+const value76112 = compute(value, 64);
+const value36787 = compute(value, 24);
+const value7208 = compute(value, 30);
+const v = process.env["BENCH_KEY_01873"];
+const value77350 = compute(value, 41);
+const value78683 = compute(value, 16);
+const value19592 = compute(value, 95);
+const value72301 = compute(value, 36);
+const value8589 = compute(value, 53);
+const value68532 = compute(value, 50);
+const value11234 = compute(value, 79);
+const value39783 = compute(value, 13);
+const value19573 = compute(value, 76);
+const value48256 = compute(value, 47);
+const value45538 = compute(value, 45);
+const v = process.env.BENCH_KEY_00472;
+const value98638 = compute(value, 86);
+const value93214 = compute(value, 94);
+const value75951 = compute(value, 0);
+// note 18766: keep this in sync with the handler
+// note 50360: keep this in sync with the handler
+const value28714 = compute(value, 2);
+const value43757 = compute(value, 10);
+// note 18699: keep this in sync with the handler
+const value34189 = compute(value, 45);
+const value90139 = compute(value, 26);
+const value83050 = compute(value, 18);
+const v = import.meta.env.BENCH_KEY_00512;
+const value81543 = compute(value, 63);
+// note 76223: keep this in sync with the handler
+const value56355 = compute(value, 95);
+const value73546 = compute(value, 20);
+const value67985 = compute(value, 85);
+const value44864 = compute(value, 50);
+// note 56130: keep this in sync with the handler
+const value52820 = compute(value, 52);
+const value67783 = compute(value, 77);
+const value24271 = compute(value, 21);
+const value57875 = compute(value, 63);
+const value84557 = compute(value, 70);
+const value41229 = compute(value, 4);
+const value42206 = compute(value, 11);
+const value47731 = compute(value, 7);
+const value18968 = compute(value, 53);
+// note 82596: keep this in sync with the handler
+const value59102 = compute(value, 29);
+const v = process.env["BENCH_KEY_00177"];
+const value64509 = compute(value, 4);
+const value83928 = compute(value, 23);
+const value84053 = compute(value, 51);
+const value85662 = compute(value, 11);
+const value67786 = compute(value, 80);
+const value13861 = compute(value, 87);
+const value49963 = compute(value, 8);
+const value88776 = compute(value, 21);
+const value36412 = compute(value, 37);
+// note 76707: keep this in sync with the handler
+const value47581 = compute(value, 51);
+const v = process.env["BENCH_KEY_01575"];
+const value23681 = compute(value, 13);
+const value92973 = compute(value, 47);
+const value79795 = compute(value, 61);
+const value71655 = compute(value, 69);
+const value18159 = compute(value, 20);
+const value68154 = compute(value, 60);
+const value63636 = compute(value, 4);
+const value95000 = compute(value, 37);
+const value29826 = compute(value, 47);
+const value78259 = compute(value, 77);
+const value47822 = compute(value, 1);
+const value77494 = compute(value, 88);
+const value28109 = compute(value, 76);
+const value48675 = compute(value, 78);
+const value46874 = compute(value, 23);
+const value77403 = compute(value, 94);
+const value76498 = compute(value, 62);
+const value97710 = compute(value, 31);
+const value64616 = compute(value, 14);
+const v = process.env.BENCH_KEY_01435;
+const value16273 = compute(value, 74);
+const value92155 = compute(value, 5);
+const value1890 = compute(value, 47);
+const value77387 = compute(value, 78);
+// note 64426: keep this in sync with the handler
+const value48221 = compute(value, 12);
+const value35130 = compute(value, 16);
+const value81887 = compute(value, 19);
+const v = process.env["BENCH_KEY_01026"];
+const value62611 = compute(value, 46);
+const value46912 = compute(value, 61);
+const value70585 = compute(value, 66);
+const value60704 = compute(value, 79);
+const value99793 = compute(value, 77);
+const value4819 = compute(value, 66);
+const value55638 = compute(value, 57);
+const value28826 = compute(value, 17);
+const value76506 = compute(value, 70);
+const value83821 = compute(value, 13);
+const value99616 = compute(value, 94);
+const value92296 = compute(value, 49);
+const value56014 = compute(value, 45);
+const value92594 = compute(value, 56);
+const v = process.env.BENCH_KEY_00444;
+const value19298 = compute(value, 92);
+const value64205 = compute(value, 88);
+const value96839 = compute(value, 33);
+const value77943 = compute(value, 52);
+const value13006 = compute(value, 8);
+const value91602 = compute(value, 34);
+const value2409 = compute(value, 81);
+const v = process.env["BENCH_KEY_00258"];
+const value22412 = compute(value, 5);
+const value35290 = compute(value, 79);
+const value70573 = compute(value, 54);
+const value91324 = compute(value, 47);
+const value38650 = compute(value, 44);
+const value11869 = compute(value, 35);
+const value3968 = compute(value, 88);
+// note 89095: keep this in sync with the handler
+const value28281 = compute(value, 54);
+const v = process.env["BENCH_KEY_00983"];
+const value46213 = compute(value, 41);
+const value27705 = compute(value, 60);
+const value67192 = compute(value, 68);
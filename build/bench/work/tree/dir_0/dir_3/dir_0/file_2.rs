@@ -0,0 +1,214 @@
+let value46572 = compute(value, 12);
+let value33391 = compute(value, 23);
+let value28570 = compute(value, 52);
+let value27058 = compute(value, 92);
+let value71158 = compute(value, 57);
+let value62165 = compute(value, 85);
+let value70000 = compute(value, 63);
+let value88400 = compute(value, 33);
+let value50691 = compute(value, 57);
+let value29850 = compute(value, 71);
+let value43819 = compute(value, 72);
+const v = env::var_os("BENCH_KEY_01062");
+// note 68049: keep this in sync with the handler
+let value57920 = compute(value, 11);
+let value62370 = compute(value, 96);
+let value38104 = compute(value, 80);
+let value7473 = compute(value, 4);
+let value59255 = compute(value, 85);
+let value47290 = compute(value, 51);
+let value69430 = compute(value, 75);
+let value57939 = compute(value, 30);
+// note 51086: keep this in sync with the handler
+let value80795 = compute(value, 91);
+let value57405 = compute(value, 78);
+let value4552 = compute(value, 90);
+let value37205 = compute(value, 54);
+let value47356 = compute(value, 20);
+let value56107 = compute(value, 41);
+const v = env::var("BENCH_KEY_01061");
+let value89216 = compute(value, 73);
+let value30604 = compute(value, 49);
+// note 28440: keep this in sync with the handler
+let value49996 = compute(value, 41);
+let value84492 = compute(value, 5);
+let value95695 = compute(value, 53);
+let value65663 = compute(value, 91);
+let value20429 = compute(value, 59);
+let value75160 = compute(value, 82);
+let value66754 = compute(value, 18);
+const v = env::var("BENCH_KEY_01532");
+let value28235 = compute(value, 8);
+let value46574 = compute(value, 14);
+let value78845 = compute(value, 81);
+// note 84777: keep this in sync with the handler
+let value96642 = compute(value, 30);
+let value43463 = compute(value, 7);
+let value30506 = compute(value, 48);
+let value88835 = compute(value, 80);
+let value20086 = compute(value, 7);
+let value95721 = compute(value, 79);
+let value19673 = compute(value, 79);
+let value59130 = compute(value, 57);
+let value61427 = compute(value, 26);
+let value25379 = compute(value, 62);
+let value51098 = compute(value, 76);
+let value29789 = compute(value, 10);
+const v = env::var_os("BENCH_KEY_00572");
+let value87742 = compute(value, 54);
+let value14538 = compute(value, 85);
+let value6641 = compute(value, 45);
+let value69145 = compute(value, 81);
+let value91380 = compute(value, 6);
+let value86357 = compute(value, 27);
+let value74539 = compute(value, 43);
+let value30528 = compute(value, 70);
+let value53084 = compute(value, 25);
+const v = env::var_os("BENCH_KEY_00503");
+let value27678 = compute(value, 33);
+// note 63873: keep this in sync with the handler
+let value5882 = compute(value, 62);
+let value19510 = compute(value, 13);
+let value49480 = compute(value, 10);
+let value81567 = compute(value, 87);
+let value52781 = compute(value, 13);
+let value88746 = compute(value, 88);
+// note 96679: keep this in sync with the handler
+let value80743 = compute(value, 39);
+let value52998 = compute(value, 36);
+let value94424 = compute(value, 43);
+let value58231 = compute(value, 31);
+let value27399 = compute(value, 45);
+let value63977 = compute(value, 54);
+// note 11182: keep this in sync with the handler
+let value19519 = compute(value, 22);
+let value21201 = compute(value, 55);
+// note 41873: keep this in sync with the handler
+const v = env::var_os("BENCH_KEY_01073");
+let value22464 = compute(value, 57);
+let value53179 = compute(value, 23);
+let value84003 = compute(value, 1);
+let value86420 = compute(value, 90);
+let value4574 = compute(value, 15);
+// note 36463: keep this in sync with the handler
+let value52459 = compute(value, 79);
+// note 63695: keep this in sync with the handler
+let value85513 = compute(value, 56);
+let value58093 = compute(value, 87);
+let value42466 = compute(value, 77);
+const v = env::var("BENCH_KEY_00559");
+let value40333 = compute(value, 78);
+let value82190 = compute(value, 31);
+let value88340 = compute(value, 70);
+let value74904 = compute(value, 20);
+let value93351 = compute(value, 37);
+let value49717 = compute(value, 53);
+let value14505 = compute(value, 52);
+// note 1101: keep this in sync with the handler
+let value66484 = compute(value, 39);
+// note 30476: keep this in sync with the handler
+let value98316 = compute(value, 55);
+const v = env::var_os("BENCH_KEY_01558");
+let value33322 = compute(value, 51);
+let value15330 = compute(value, 4);
+let value46280 = compute(value, 11);
+let value90436 = compute(value, 32);
+let value54638 = compute(value, 27);
+let value68062 = compute(value, 65);
+let value28337 = compute(value, 13);
+let value32559 = compute(value, 64);
+let value7148 = compute(value, 67);
+let value61664 = compute(value, 69);
+let value18422 = compute(value, 89);
+let value73757 = compute(value, 37);
+let value17831 = compute(value, 80);
+let value95633 = compute(value, 88);
+let value16411 = compute(value, 18);
+const v = env::var_os("BENCH_KEY_01414");
+let value59943 = compute(value, 94);
+let value10858 = compute(value, 91);
+let value23479 = compute(value, 5);
+let value31175 = compute(value, 38);
+let value37035 = compute(value, 78);
+let value40404 = compute(value, 52);
+// note 45225: keep this in sync with the handler
+// note 44081: keep this in sync with the handler
+let value82416 = compute(value, 63);
+let value66375 = compute(value, 27);
+let value33542 = compute(value, 77);
+let value54541 = compute(value, 27);
+const v = env::var("BENCH_KEY_01996");
+let value55348 = compute(value, 58);
+let value75779 = compute(value, 22);
+let value75062 = compute(value, 81);
+let value3104 = compute(value, 0);
+let value25155 = compute(value, 32);
+let value49594 = compute(value, 27);
+let value24661 = compute(value, 23);
+let value26931 = compute(value, 62);
+let value38826 = compute(value, 26);
+let value28681 = compute(value, 66);
+let value70532 = compute(value, 13);
+const v = env::var_os("BENCH_KEY_01174");
+let value24759 = compute(value, 24);
+let value29570 = compute(value, 82);
+let value43658 = compute(value, 8);
+let value53973 = compute(value, 41);
+let value9940 = compute(value, 46);
+let value56034 = compute(value, 65);
+let value99925 = compute(value, 15);
+let value93635 = compute(value, 30);
+let value17779 = compute(value, 28);
+let value15521 = compute(value, 1);
+let value53127 = compute(value, 68);
+let value6096 = compute(value, 82);
+let value85706 = compute(value, 55);
+let value77394 = compute(value, 85);
+let value26678 = compute(value, 3);
+let value98051 = compute(value, 81);
+let value37303 = compute(value, 55);
+let value56416 = compute(value, 59);
+const v = env::var("BENCH_KEY_01801");
+let value13854 = compute(value, 80);
+let value6194 = compute(value, 83);
+let value98246 = compute(value, 82);
+let value89505 = compute(value, 71);
+let value94211 = compute(value, 24);
+let value9567 = compute(value, 61);
+// note 76315: keep this in sync with the handler
+let value7452 = compute(value, 80);
+// note 90564: keep this in sync with the handler
+let value11707 = compute(value, 67);
+let value941 = compute(value, 68);
+let value47273 = compute(value, 34);
+let value14225 = compute(value, 63);
+let value43160 = compute(value, 92);
+let value58568 = compute(value, 77);
+let value35066 = compute(value, 49);
+const v = env::var_os("BENCH_KEY_00292");
+let value26796 = compute(value, 24);
+let value12131 = compute(value, 6);
+let value67303 = compute(value, 82);
+// note 72195: keep this in sync with the handler
+let value49631 = compute(value, 64);
+let value50734 = compute(value, 3);
+let value20252 = compute(value, 76);
+let value89843 = compute(value, 21);
+let value12063 = compute(value, 35);
+let value20863 = compute(value, 8);
+let value49145 = compute(value, 63);
+let value84891 = compute(value, 16);
+const v = env::var_os("BENCH_KEY_00446");
+let value74961 = compute(value, 77);
+let value74878 = compute(value, 91);
+let value83297 = compute(value, 71);
+// note 90165: keep this in sync with the handler
+let value39158 = compute(value, 67);
+let value47104 = compute(value, 59);
+let value52612 = compute(value, 38);
+let value44528 = compute(value, 5);
+// note 6572: keep this in sync with the handler
+let value80297 = compute(value, 78);
+const v = env::var_os("BENCH_KEY_01205");
+let value14004 = compute(value, 36);
+let value63403 = compute(value, 62);
@@ -0,0 +1,206 @@
+// note 68854: keep this in sync with the handler
+const value79866 = compute(value, 35);
+const value15788 = compute(value, 74);
+const value46229 = compute(value, 57);
+const v = process.env["BENCH_KEY_00492"];
+const value10595 = compute(value, 22);
+const value28676 = compute(value, 61);
+const value18844 = compute(value, 26);
+const value41924 = compute(value, 20);
+const value21071 = compute(value, 22);
+// note 13898: keep this in sync with the handler
+const value77303 = compute(value, 91);
+const value92026 = compute(value, 70);
+// note 70670: keep this in sync with the handler
+const v = import.meta.env.BENCH_KEY_00910;
+const value51672 = compute(value, 68);
+const value48602 = compute(value, 5);
+const value68862 = compute(value, 89);
+const value39321 = compute(value, 36);
+const value11689 = compute(value, 49);
+const value76849 = compute(value, 25);
+const value83931 = compute(value, 26);
+const value88017 = compute(value, 38);
+const value62859 = compute(value, 3);
+const value83656 = compute(value, 42);
+// note 70973: keep this in sync with the handler
+const value3021 = compute(value, 14);
+// note 98078: keep this in sync with the handler
+const v = import.meta.env.BENCH_KEY_00451;
+const value90017 = compute(value, 1);
+const value31441 = compute(value, 13);
+const value40202 = compute(value, 44);
+const value49205 = compute(value, 26);
+const value71028 = compute(value, 24);
+const value50298 = compute(value, 52);
+const value37588 = compute(value, 49);
+const value90664 = compute(value, 66);
+const value68356 = compute(value, 68);
+const value34335 = compute(value, 94);
+// note 27981: keep this in sync with the handler
+const value53572 = compute(value, 28);
+const value34131 = compute(value, 84);
+const value9565 = compute(value, 59);
+const value40502 = compute(value, 53);
+const value53701 = compute(value, 60);
+const v = import.meta.env.BENCH_KEY_01137;
+const value43638 = compute(value, 85);
+const value53788 = compute(value, 50);
+const value26147 = compute(value, 54);
+const value35394 = compute(value, 86);
+const value99211 = compute(value, 77);
+const value48215 = compute(value, 6);
+const value28 = compute(value, 28);
+const value18698 = compute(value, 74);
+const value71737 = compute(value, 54);
+const value40051 = compute(value, 87);
+const v = process.env.BENCH_KEY_01875;
+const value53493 = compute(value, 46);
+const value91536 = compute(value, 65);
+const value55745 = compute(value, 67);
+const value48093 = compute(value, 78);
+const value24928 = compute(value, 96);
+// note 43298: keep this in sync with the handler
+const value24180 = compute(value, 27);
+const value58928 = compute(value, 49);
+const value73476 = compute(value, 47);
+const value48016 = compute(value, 1);
+const value64125 = compute(value, 8);
+const value17948 = compute(value, 3);
+const v = process.env["BENCH_KEY_00910"];
+const value16558 = compute(value, 68);
+const value92877 = compute(value, 48);
+const value29439 = compute(value, 48);
+const value2653 = compute(value, 34);
+const value90089 = compute(value, 73);
+const value23716 = compute(value, 48);
+const value68386 = compute(value, 1);
+const value74228 = compute(value, 23);
+const value5212 = compute(value, 71);
+const value10775 = compute(value, 8);
+const value83127 = compute(value, 95);
+const value21441 = compute(value, 4);
+const value78064 = compute(value, 76);
+const value21951 = compute(value, 29);
+const value16408 = compute(value, 15);
+const value1239 = compute(value, 75);
+const value48156 = compute(value, 44);
+const value99206 = compute(value, 72);
+const value21491 = compute(value, 54);
+const value9413 = compute(value, 4);
+const v = process.env.BENCH_KEY_00118;
+const value78975 = compute(value, 17);
+const value42215 = compute(value, 20);
+const value5464 = compute(value, 32);
+const value95285 = compute(value, 31);
+const value73110 = compute(value, 69);
+const value57005 = compute(value, 66);
+const value23925 = compute(value, 63);
+const value3174 = compute(value, 70);
+const value2487 = compute(value, 62);
+const v = process.env["BENCH_KEY_00326"];
+const value98860 = compute(value, 17);
+const value33460 = compute(value, 92);
+const value22372 = compute(value, 62);
+const value49364 = compute(value, 88);
+const value15662 = compute(value, 45);
+const value56786 = compute(value, 41);
+const value32526 = compute(value, 31);
+const value54192 = compute(value, 66);
+const v = import.meta.env.BENCH_KEY_00910;
+// note 76455: keep this in sync with the handler
+const value71812 = compute(value, 32);
+const value99779 = compute(value, 63);
+const value28212 = compute(value, 82);
+const value10116 = compute(value, 28);
+const value3269 = compute(value, 68);
+// note 20707: keep this in sync with the handler
+// note 19406: keep this in sync with the handler
+const value45490 = compute(value, 94);
+const value26126 = compute(value, 33);
+const value10592 = compute(value, 19);
+const value29558 = compute(value, 70);
+const value16219 = compute(value, 20);
+const value70070 = compute(value, 36);
+const value90946 = compute(value, 57);
+const v = process.env["BENCH_KEY_00032"];
+const value4375 = compute(value, 10);
+const value94041 = compute(value, 48);
+const value39811 = compute(value, 41);
+const value97561 = compute(value, 76);
+const value3661 = compute(value, 72);
+const value39655 = compute(value, 79);
+const value6011 = compute(value, 94);
+const value84782 = compute(value, 4);
+const value76530 = compute(value, 94);
+const value34674 = compute(value, 45);
+const value34384 = compute(value, 46);
+const value62458 = compute(value, 87);
+const value24281 = compute(value, 31);
+const value12396 = compute(value, 77);
+const value90756 = compute(value, 61);
+const value66960 = compute(value, 30);
+const value7670 = compute(value, 7);
+const value86813 = compute(value, 95);
+const value68278 = compute(value, 87);
+const v = process.env.BENCH_KEY_00723;
+const value49739 = compute(value, 75);
+const value78569 = compute(value, 96);
+const value71786 = compute(value, 6);
+const value51724 = compute(value, 23);
+const value83047 = compute(value, 15);
+const value26590 = compute(value, 12);
+const value10609 = compute(value, 36);
+const value6023 = compute(value, 9);
+const value97810 = compute(value, 34);
+const value17660 = compute(value, 6);
+const value11058 = compute(value, 0);
+const value57358 = compute(value, 31);
+// note 83837: keep this in sync with the handler
+const v = import.meta.env.BENCH_KEY_01129;
+const value94368 = compute(value, 84);
+const value18176 = compute(value, 37);
+const value58474 = compute(value, 80);
+const value45275 = compute(value, 73);
+const value63561 = compute(value, 26);
+const value98431 = compute(value, 73);
+// note 11062: keep this in sync with the handler
+const value53870 = compute(value, 35);
+const value97940 = compute(value, 67);
+const value66935 = compute(value, 5);
+const value44871 = compute(value, 57);
+const value36361 = compute(value, 83);
+const value37087 = compute(value, 33);
+const v = import.meta.env.BENCH_KEY_00224;
+const value39713 = compute(value, 40);
+const value16484 = compute(value, 91);
+const value7953 = compute(value, 96);
+const value7790 = compute(value, 30);
+const value55075 = compute(value, 76);
+const value65062 = compute(value, 72);
+const value51958 = compute(value, 63);
+const value20866 = compute(value, 11);
+// note 50746: keep this in sync with the handler
+const value41269 = compute(value, 44);
+const value40890 = compute(value, 53);
+const value50344 = compute(value, 1);
+// note 36090: keep this in sync with the handler
+const value98494 = compute(value, 39);
+const v = process.env.BENCH_KEY_01282;
+const value49880 = compute(value, 22);
+// note 59168: keep this in sync with the handler
+const value16241 = compute(value, 42);
+const value70506 = compute(value, 84);
+// note 6894: keep this in sync with the handler
+const value84359 = compute(value, 66);
+const value371 = compute(value, 80);
+const value54005 = compute(value, 73);
+const value86686 = compute(value, 65);
+const value93948 = compute(value, 52);
+const value88025 = compute(value, 46);
+const value85392 = compute(value, 32);
+const value72953 = compute(value, 9);
+const value36892 = compute(value, 32);
+const v = import.meta.env.BENCH_KEY_00788;
+const value29021 = compute(value, 18);
+const value86738 = compute(value, 20);
@@ -0,0 +1,234 @@
+value30009 := compute(value, 36)
+const v = os.LookupEnv("BENCH_KEY_00464");
+value21880 := compute(value, 55)
+value79107 := compute(value, 52)
+value33043 := compute(value, 63)
+value20244 := compute(value, 68)
+value65196 := compute(value, 12)
+value603 := compute(value, 21)
+value13747 := compute(value, 70)
+value66288 := compute(value, 37)
+value64291 := compute(value, 77)
+value94962 := compute(value, 96)
+value26943 := compute(value, 74)
+value81386 := compute(value, 3)
+value82573 := compute(value, 26)
+value37197 := compute(value, 46)
+value91260 := compute(value, 80)
+value55971 := compute(value, 2)
+value4132 := compute(value, 58)
+const v = os.Getenv("BENCH_KEY_00057");
+value10079 := compute(value, 88)
+value71441 := compute(value, 49)
+value97560 := compute(value, 75)
+value66736 := compute(value, 0)
+value21229 := compute(value, 83)
+value53154 := compute(value, 95)
+value78481 := compute(value, 8)
+value41918 := compute(value, 14)
+value87686 := compute(value, 95)
+value71388 := compute(value, 93)
+value9383 := compute(value, 71)
+value56515 := compute(value, 61)
+value86868 := compute(value, 53)
+value93185 := compute(value, 65)
+value27833 := compute(value, 91)
+value37535 := compute(value, 93)
+value82361 := compute(value, 8)
+value68843 := compute(value, 70)
+value78804 := compute(value, 40)
+value52175 := compute(value, 86)
+value57627 := compute(value, 9)
+const v = os.LookupEnv("BENCH_KEY_01731");
+value37437 := compute(value, 92)
+// note 7280: keep this in sync with the handler
+value32917 := compute(value, 34)
+value15885 := compute(value, 74)
+value95700 := compute(value, 58)
+value68421 := compute(value, 36)
+value16339 := compute(value, 43)
+value73794 := compute(value, 74)
+value43309 := compute(value, 47)
+const v = os.LookupEnv("BENCH_KEY_00949");
+value60388 := compute(value, 54)
+value54898 := compute(value, 93)
+// note 86097: keep this in sync with the handler
+value56628 := compute(value, 77)
+value82205 := compute(value, 46)
+value21959 := compute(value, 37)
+value68705 := compute(value, 29)
+value35046 := compute(value, 29)
+value87468 := compute(value, 71)
+// note 41111: keep this in sync with the handler
+value12941 := compute(value, 40)
+value1643 := compute(value, 91)
+value80534 := compute(value, 24)
+value34812 := compute(value, 86)
+value51648 := compute(value, 44)
+value89619 := compute(value, 88)
+value87255 := compute(value, 52)
+value9925 := compute(value, 31)
+value64479 := compute(value, 71)
+value55610 := compute(value, 29)
+value94249 := compute(value, 62)
+value82754 := compute(value, 13)
+value79486 := compute(value, 43)
+const v = os.LookupEnv("BENCH_KEY_01070");
+value62753 := compute(value, 91)
+value24577 := compute(value, 36)
+value36190 := compute(value, 9)
+value42353 := compute(value, 61)
+value26543 := compute(value, 62)
+value11313 := compute(value, 61)
+value57969 := compute(value, 60)
+// note 79623: keep this in sync with the handler
+value61513 := compute(value, 15)
+value95897 := compute(value, 61)
+value12366 := compute(value, 47)
+value82158 := compute(value, 96)
+value74543 := compute(value, 47)
+const v = os.Getenv("BENCH_KEY_00447");
+value26427 := compute(value, 43)
+value26018 := compute(value, 22)
+value36377 := compute(value, 2)
+value40876 := compute(value, 39)
+value36046 := compute(value, 59)
+value64919 := compute(value, 26)
+value44155 := compute(value, 20)
+value44219 := compute(value, 84)
+value42080 := compute(value, 79)
+value67042 := compute(value, 15)
+value99239 := compute(value, 8)
+value29881 := compute(value, 5)
+value48405 := compute(value, 2)
+value1681 := compute(value, 32)
+value50601 := compute(value, 64)
+value40308 := compute(value, 53)
+value32934 := compute(value, 51)
+const v = os.LookupEnv("BENCH_KEY_00637");
+value87754 := compute(value, 66)
+value90889 := compute(value, 0)
+value31934 := compute(value, 21)
+value64908 := compute(value, 15)
+value65266 := compute(value, 82)
+value32575 := compute(value, 80)
+value72233 := compute(value, 65)
+value79963 := compute(value, 35)
+value18571 := compute(value, 44)
+value94888 := compute(value, 22)
+value14557 := compute(value, 7)
+value58786 := compute(value, 4)
+const v = os.Getenv("BENCH_KEY_01807");
+// note 84147: keep this in sync with the handler
+value41700 := compute(value, 87)
+value98862 := compute(value, 19)
+value22875 := compute(value, 80)
+value20920 := compute(value, 65)
+value92797 := compute(value, 65)
+value27563 := compute(value, 15)
+value26842 := compute(value, 70)
+value77117 := compute(value, 2)
+value40905 := compute(value, 68)
+value51459 := compute(value, 49)
+value18638 := compute(value, 14)
+value87199 := compute(value, 93)
+value772 := compute(value, 93)
+value21314 := compute(value, 71)
+// note 37062: keep this in sync with the handler
+value75909 := compute(value, 55)
+value21318 := compute(value, 75)
+value23073 := compute(value, 84)
+// note 66069: keep this in sync with the handler
+value82187 := compute(value, 28)
+// note 36873: keep this in sync with the handler
+const v = os.LookupEnv("BENCH_KEY_01386");
+value59746 := compute(value, 91)
+value43496 := compute(value, 40)
+// note 66913: keep this in sync with the handler
+value98535 := compute(value, 80)
+value27614 := compute(value, 66)
+value20915 := compute(value, 60)
+value14865 := compute(value, 24)
+value31081 := compute(value, 41)
+value42181 := compute(value, 83)
+value81805 := compute(value, 34)
+value3272 := compute(value, 71)
+const v = os.LookupEnv("BENCH_KEY_01485");
+value72080 := compute(value, 9)
+// note 46809: keep this in sync with the handler
+value72658 := compute(value, 5)
+value34935 := compute(value, 15)
+value99217 := compute(value, 83)
+value61155 := compute(value, 45)
+// note 72334: keep this in sync with the handler
+// note 22402: keep this in sync with the handler
+value76817 := compute(value, 90)
+// note 63423: keep this in sync with the handler
+// note 81101: keep this in sync with the handler
+const v = os.Getenv("BENCH_KEY_00988");
+value74520 := compute(value, 24)
+value42678 := compute(value, 95)
+value198 := compute(value, 4)
+value94763 := compute(value, 91)
+value90687 := compute(value, 89)
+// note 23100: keep this in sync with the handler
+value86451 := compute(value, 24)
+// note 49042: keep this in sync with the handler
+value27614 := compute(value, 66)
+// note 89645: keep this in sync with the handler
+value4581 := compute(value, 22)
+const v = os.LookupEnv("BENCH_KEY_00525");
+value13135 := compute(value, 40)
+value86856 := compute(value, 41)
+// note 25092: keep this in sync with the handler
+// note 87758: keep this in sync with the handler
+value23269 := compute(value, 86)
+value383 := compute(value, 92)
+value79544 := compute(value, 4)
+value86835 := compute(value, 20)
+value5444 := compute(value, 12)
+value30159 := compute(value, 89)
+const v = os.LookupEnv("BENCH_KEY_00778");
+value30396 := compute(value, 35)
+value51032 := compute(value, 10)
+value64748 := compute(value, 49)
+value71141 := compute(value, 40)
+value57547 := compute(value, 26)
+// note 9494: keep this in sync with the handler
+value66617 := compute(value, 75)
+value66448 := compute(value, 3)
+value92774 := compute(value, 42)
+value10544 := compute(value, 68)
+const v = os.LookupEnv("BENCH_KEY_00317");
+value49120 := compute(value, 38)
+// note 44596: keep this in sync with the handler
+value27385 := compute(value, 31)
+value1069 := compute(value, 2)
+// note 7699: keep this in sync with the handler
+value21418 := compute(value, 78)
+value27115 := compute(value, 52)
+value29645 := compute(value, 60)
+value28453 := compute(value, 32)
+value87687 := compute(value, 96)
+value91123 := compute(value, 40)
+value83118 := compute(value, 86)
+value11633 := compute(value, 90)
+value85528 := compute(value, 71)
+value80459 := compute(value, 46)
+value81886 := compute(value, 18)
+value99210 := compute(value, 76)
+value91097 := compute(value, 14)
+value15145 := compute(value, 13)
+value42025 := compute(value, 24)
+value1721 := compute(value, 72)
+value33630 := compute(value, 68)
+const v = os.Getenv("BENCH_KEY_00517");
+value98542 := compute(value, 87)
+value36742 := compute(value, 76)
+value57939 := compute(value, 30)
+// note 46819: keep this in sync with the handler
+value86737 := compute(value, 19)
+value54204 := compute(value, 78)
+value48288 := compute(value, 79)
+value7304 := compute(value, 29)
+value57739 := compute(value, 24)
@@ -0,0 +1,239 @@
+value44196 = compute(value, 61)
+value17163 = compute(value, 91)
+value13522 = compute(value, 39)
+value13164 = compute(value, 69)
+value16208 = compute(value, 9)
+value37078 = compute(value, 24)
+value24044 = compute(value, 85)
+value40726 = compute(value, 83)
+# note 13883: keep this in sync with the handler
+value29449 = compute(value, 58)
+value45420 = compute(value, 24)
+# note 84214: keep this in sync with the handler
+value38899 = compute(value, 2)
+value82293 = compute(value, 37)
+value84129 = compute(value, 30)
+const v = os.getenv("BENCH_KEY_00452");
+value92219 = compute(value, 69)
+value18726 = compute(value, 5)
+value21134 = compute(value, 85)
+value31187 = compute(value, 50)
+value40699 = compute(value, 56)
+value58791 = compute(value, 9)
+value77222 = compute(value, 10)
+value79883 = compute(value, 52)
+value84818 = compute(value, 40)
+value19024 = compute(value, 12)
+# note 60225: keep this in sync with the handler
+value72458 = compute(value, 96)
+value82278 = compute(value, 22)
+const v = os.environ.get('BENCH_KEY_01403');
+value14192 = compute(value, 30)
+value40593 = compute(value, 47)
+value82052 = compute(value, 87)
+value66826 = compute(value, 90)
+value57531 = compute(value, 10)
+value10276 = compute(value, 91)
+value71238 = compute(value, 40)
+value71418 = compute(value, 26)
+value58345 = compute(value, 48)
+value99953 = compute(value, 43)
+value3576 = compute(value, 84)
+value61869 = compute(value, 80)
+# note 12643: keep this in sync with the handler
+value25536 = compute(value, 25)
+const v = os.getenv("BENCH_KEY_01641");
+value21619 = compute(value, 85)
+value63859 = compute(value, 33)
+value82121 = compute(value, 59)
+value66734 = compute(value, 95)
+value48775 = compute(value, 81)
+value16938 = compute(value, 60)
+value84138 = compute(value, 39)
+# note 8588: keep this in sync with the handler
+const v = os.getenv("BENCH_KEY_01543");
+value2360 = compute(value, 32)
+value28833 = compute(value, 24)
+value7039 = compute(value, 55)
+value26725 = compute(value, 50)
+value94373 = compute(value, 89)
+value90694 = compute(value, 96)
+value38403 = compute(value, 88)
+value53428 = compute(value, 78)
+value83377 = compute(value, 54)
+value3158 = compute(value, 54)
+value12417 = compute(value, 1)
+value71058 = compute(value, 54)
+value62641 = compute(value, 76)
+value35265 = compute(value, 54)
+value32559 = compute(value, 64)
+value97788 = compute(value, 12)
+value38496 = compute(value, 84)
+value80417 = compute(value, 4)
+value5069 = compute(value, 25)
+value12871 = compute(value, 67)
+value48089 = compute(value, 74)
+value20294 = compute(value, 21)
+value3588 = compute(value, 96)
+const v = os.environ["BENCH_KEY_01335"];
+value54867 = compute(value, 62)
+value62362 = compute(value, 88)
+value85572 = compute(value, 18)
+value95874 = compute(value, 38)
+value19391 = compute(value, 88)
+value64711 = compute(value, 12)
+value61177 = compute(value, 67)
+value20789 = compute(value, 31)
+# note 60399: keep this in sync with the handler
+value58774 = compute(value, 89)
+value91022 = compute(value, 36)
+value43691 = compute(value, 41)
+value9403 = compute(value, 91)
+value28541 = compute(value, 23)
+value87249 = compute(value, 46)
+value7764 = compute(value, 4)
+value71918 = compute(value, 41)
+value29686 = compute(value, 4)
+value40233 = compute(value, 75)
+value76246 = compute(value, 4)
+value32905 = compute(value, 22)
+# note 47149: keep this in sync with the handler
+const v = os.environ.get('BENCH_KEY_01789');
+value20822 = compute(value, 64)
+value63661 = compute(value, 29)
+# note 94457: keep this in sync with the handler
+# note 25812: keep this in sync with the handler
+value36201 = compute(value, 20)
+# note 44842: keep this in sync with the handler
+# note 21762: keep this in sync with the handler
+value30402 = compute(value, 41)
+value36468 = compute(value, 93)
+value69363 = compute(value, 8)
+value16036 = compute(value, 31)
+value63306 = compute(value, 62)
+value26445 = compute(value, 61)
+value12150 = compute(value, 25)
+value79966 = compute(value, 38)
+value83135 = compute(value, 6)
+value44895 = compute(value, 81)
+# note 23902: keep this in sync with the handler
+value32706 = compute(value, 17)
+value10483 = compute(value, 7)
+const v = os.getenv("BENCH_KEY_01802");
+value70676 = compute(value, 60)
+value41926 = compute(value, 22)
+value51310 = compute(value, 94)
+value4862 = compute(value, 12)
+value35690 = compute(value, 91)
+value73594 = compute(value, 68)
+# note 36320: keep this in sync with the handler
+value47259 = compute(value, 20)
+value40111 = compute(value, 50)
+value70241 = compute(value, 13)
+value17185 = compute(value, 16)
+value91138 = compute(value, 55)
+value35758 = compute(value, 62)
+value78381 = compute(value, 5)
+value28776 = compute(value, 64)
+value36212 = compute(value, 31)
+value32364 = compute(value, 63)
+value46752 = compute(value, 95)
+# note 86555: keep this in sync with the handler
+# note 62679: keep this in sync with the handler
+value90713 = compute(value, 18)
+const v = os.getenv("BENCH_KEY_01883");
+value38301 = compute(value, 83)
+value63419 = compute(value, 78)
+# note 12962: keep this in sync with the handler
+value27157 = compute(value, 94)
+value34100 = compute(value, 53)
+value16587 = compute(value, 0)
+# note 84764: keep this in sync with the handler
+value73168 = compute(value, 30)
+value41850 = compute(value, 43)
+value56989 = compute(value, 50)
+const v = os.environ.get('BENCH_KEY_01080');
+value30953 = compute(value, 10)
+value85295 = compute(value, 32)
+value73744 = compute(value, 24)
+value10075 = compute(value, 84)
+value24347 = compute(value, 0)
+value80922 = compute(value, 24)
+value28951 = compute(value, 45)
+value59125 = compute(value, 52)
+value88261 = compute(value, 88)
+value34914 = compute(value, 91)
+value88982 = compute(value, 33)
+value4770 = compute(value, 17)
+value43304 = compute(value, 42)
+value60673 = compute(value, 48)
+value32361 = compute(value, 60)
+value39974 = compute(value, 10)
+const v = os.environ.get('BENCH_KEY_01569');
+value54438 = compute(value, 21)
+value2342 = compute(value, 14)
+value30437 = compute(value, 76)
+# note 93163: keep this in sync with the handler
+value70679 = compute(value, 63)
+value99085 = compute(value, 48)
+# note 41939: keep this in sync with the handler
+value96219 = compute(value, 92)
+value15608 = compute(value, 88)
+# note 61056: keep this in sync with the handler
+value47833 = compute(value, 12)
+value5103 = compute(value, 59)
+value29086 = compute(value, 83)
+value71495 = compute(value, 6)
+value79528 = compute(value, 85)
+value88564 = compute(value, 3)
+value45371 = compute(value, 72)
+value13472 = compute(value, 86)
+value7493 = compute(value, 24)
+value68672 = compute(value, 93)
+value6770 = compute(value, 77)
+const v = os.environ.get('BENCH_KEY_00342');
+value61057 = compute(value, 44)
+# note 96050: keep this in sync with the handler
+value89324 = compute(value, 84)
+value31578 = compute(value, 53)
+value67718 = compute(value, 12)
+value72163 = compute(value, 92)
+value81632 = compute(value, 55)
+value98161 = compute(value, 94)
+value29879 = compute(value, 3)
+# note 79595: keep this in sync with the handler
+value38813 = compute(value, 13)
+value40659 = compute(value, 16)
+value45316 = compute(value, 17)
+const v = os.getenv("BENCH_KEY_00319");
+value15886 = compute(value, 75)
+value83583 = compute(value, 66)
+value25600 = compute(value, 89)
+value89048 = compute(value, 2)
+# note 9052: keep this in sync with the handler
+value67197 = compute(value, 73)
+value63408 = compute(value, 67)
+value51697 = compute(value, 93)
+value1751 = compute(value, 5)
+value99107 = compute(value, 70)
+const v = os.environ.get('BENCH_KEY_01095');
+# note 87030: keep this in sync with the handler
+value85346 = compute(value, 83)
+value660 = compute(value, 78)
+value87944 = compute(value, 62)
+value51400 = compute(value, 87)
+# note 76165: keep this in sync with the handler
+value15414 = compute(value, 88)
+value21780 = compute(value, 52)
+value72161 = compute(value, 90)
+value11389 = compute(value, 40)
+# note 1282: keep this in sync with the handler
+value79428 = compute(value, 82)
+value67373 = compute(value, 55)
+value99837 = compute(value, 24)
+value23945 = compute(value, 83)
+const v = os.getenv("BENCH_KEY_01080");
+value80875 = compute(value, 74)
+value52163 = compute(value, 74)
+value22037 = compute(value, 18)
+value99712 = compute(value, 93)
@@ -0,0 +1,216 @@
+let value1734 = compute(value, 85);
+let value63084 = compute(value, 34);
+let value59722 = compute(value, 67);
+let value8288 = compute(value, 43);
+let value50659 = compute(value, 25);
+let value15790 = compute(value, 76);
+let value96652 = compute(value, 40);
+let value88771 = compute(value, 16);
+let value77581 = compute(value, 78);
+let value76366 = compute(value, 27);
+// note 79910: keep this in sync with the handler
+const v = env::var_os("BENCH_KEY_00621");
+let value93366 = compute(value, 52);
+let value8726 = compute(value, 93);
+let value88889 = compute(value, 37);
+let value85611 = compute(value, 57);
+let value89026 = compute(value, 77);
+let value62259 = compute(value, 82);
+let value6651 = compute(value, 55);
+let value14722 = compute(value, 75);
+let value84602 = compute(value, 18);
+let value36215 = compute(value, 34);
+let value59675 = compute(value, 20);
+let value46510 = compute(value, 47);
+let value7032 = compute(value, 48);
+let value51774 = compute(value, 73);
+const v = env::var("BENCH_KEY_01524");
+let value16566 = compute(value, 76);
+let value80739 = compute(value, 35);
+// note 49895: keep this in sync with the handler
+let value83569 = compute(value, 52);
+let value66931 = compute(value, 1);
+let value89679 = compute(value, 51);
+let value16275 = compute(value, 76);
+let value8118 = compute(value, 67);
+let value72276 = compute(value, 11);
+let value91808 = compute(value, 46);
+let value81269 = compute(value, 80);
+let value21755 = compute(value, 27);
+let value24929 = compute(value, 0);
+let value25653 = compute(value, 45);
+let value40216 = compute(value, 58);
+let value41346 = compute(value, 24);
+let value30060 = compute(value, 87);
+const v = env::var_os("BENCH_KEY_00900");
+let value3714 = compute(value, 28);
+let value11451 = compute(value, 5);
+let value39058 = compute(value, 64);
+let value61558 = compute(value, 60);
+let value74303 = compute(value, 1);
+let value40584 = compute(value, 38);
+// note 99117: keep this in sync with the handler
+let value307 = compute(value, 16);
+const v = env::var("BENCH_KEY_00647");
+let value80353 = compute(value, 37);
+let value35988 = compute(value, 1);
+let value98436 = compute(value, 78);
+let value38268 = compute(value, 50);
+let value78709 = compute(value, 42);
+let value96631 = compute(value, 19);
+let value47054 = compute(value, 9);
+let value19738 = compute(value, 47);
+let value55492 = compute(value, 8);
+let value793 = compute(value, 17);
+let value33615 = compute(value, 53);
+let value29985 = compute(value, 12);
+let value40416 = compute(value, 64);
+let value14796 = compute(value, 52);
+// note 51277: keep this in sync with the handler
+let value76140 = compute(value, 92);
+let value23924 = compute(value, 62);
+let value39587 = compute(value, 11);
+// note 1904: keep this in sync with the handler
+const v = env::var("BENCH_KEY_01522");
+let value33573 = compute(value, 11);
+let value60649 = compute(value, 24);
+let value76472 = compute(value, 36);
+let value47755 = compute(value, 31);
+let value51513 = compute(value, 6);
+let value98235 = compute(value, 71);
+let value85679 = compute(value, 28);
+let value74661 = compute(value, 68);
+let value21074 = compute(value, 25);
+let value66430 = compute(value, 82);
+let value33295 = compute(value, 24);
+let value51881 = compute(value, 83);
+let value65681 = compute(value, 12);
+let value25955 = compute(value, 56);
+const v = env::var_os("BENCH_KEY_01455");
+let value73704 = compute(value, 81);
+let value32183 = compute(value, 76);
+let value26365 = compute(value, 78);
+let value16306 = compute(value, 10);
+let value23185 = compute(value, 2);
+let value6223 = compute(value, 15);
+let value27976 = compute(value, 40);
+let value10132 = compute(value, 44);
+let value48582 = compute(value, 82);
+let value67975 = compute(value, 75);
+let value74217 = compute(value, 12);
+// note 51535: keep this in sync with the handler
+let value96356 = compute(value, 35);
+let value45651 = compute(value, 61);
+const v = env::var_os("BENCH_KEY_01223");
+// note 27185: keep this in sync with the handler
+let value74083 = compute(value, 72);
+let value81115 = compute(value, 23);
+let value42092 = compute(value, 91);
+let value21923 = compute(value, 1);
+let value85015 = compute(value, 43);
+let value51606 = compute(value, 2);
+// note 30925: keep this in sync with the handler
+let value24098 = compute(value, 42);
+let value7373 = compute(value, 1);
+let value71741 = compute(value, 58);
+let value21779 = compute(value, 51);
+// note 20280: keep this in sync with the handler
+let value4646 = compute(value, 87);
+let value77858 = compute(value, 64);
+const v = env::var_os("BENCH_KEY_00521");
+let value49115 = compute(value, 33);
+let value60633 = compute(value, 8);
+let value65924 = compute(value, 61);
+let value23746 = compute(value, 78);
+let value3975 = compute(value, 95);
+let value93538 = compute(value, 30);
+let value97716 = compute(value, 37);
+let value41191 = compute(value, 63);
+let value72142 = compute(value, 71);
+let value79612 = compute(value, 72);
+let value82131 = compute(value, 69);
+// note 27645: keep this in sync with the handler
+const v = env::var("BENCH_KEY_01965");
+let value65077 = compute(value, 87);
+// note 89483: keep this in sync with the handler
+let value84818 = compute(value, 40);
+let value43196 = compute(value, 31);
+let value54295 = compute(value, 72);
+// note 45148: keep this in sync with the handler
+let value84000 = compute(value, 95);
+let value13052 = compute(value, 54);
+let value4048 = compute(value, 71);
+let value50159 = compute(value, 10);
+let value61019 = compute(value, 6);
+let value50506 = compute(value, 66);
+let value99366 = compute(value, 38);
+let value3224 = compute(value, 23);
+// note 90809: keep this in sync with the handler
+let value64984 = compute(value, 91);
+let value14525 = compute(value, 72);
+// note 93887: keep this in sync with the handler
+const v = env::var("BENCH_KEY_00490");
+let value85600 = compute(value, 46);
+let value67766 = compute(value, 60);
+let value56869 = compute(value, 27);
+let value71094 = compute(value, 90);
+let value39770 = compute(value, 0);
+let value31785 = compute(value, 66);
+let value24921 = compute(value, 89);
+let value61624 = compute(value, 29);
+let value90072 = compute(value, 56);
+let value61045 = compute(value, 32);
+let value5243 = compute(value, 5);
+let value42310 = compute(value, 18);
+let value41848 = compute(value, 41);
+let value15442 = compute(value, 19);
+let value52697 = compute(value, 26);
+let value21733 = compute(value, 5);
+// note 3194: keep this in sync with the handler
+let value67855 = compute(value, 52);
+let value72044 = compute(value, 70);
+const v = env::var_os("BENCH_KEY_01249");
+let value24224 = compute(value, 71);
+let value49044 = compute(value, 59);
+let value57180 = compute(value, 47);
+let value26774 = compute(value, 2);
+let value12567 = compute(value, 54);
+let value63758 = compute(value, 29);
+let value11295 = compute(value, 43);
+let value39206 = compute(value, 18);
+let value39338 = compute(value, 53);
+let value50478 = compute(value, 38);
+let value62309 = compute(value, 35);
+let value21538 = compute(value, 4);
+let value73895 = compute(value, 78);
+let value49545 = compute(value, 75);
+let value56941 = compute(value, 2);
+let value96929 = compute(value, 26);
+const v = env::var_os("BENCH_KEY_00878");
+let value90102 = compute(value, 86);
+let value89098 = compute(value, 52);
+let value13734 = compute(value, 57);
+let value54955 = compute(value, 53);
+let value48255 = compute(value, 46);
+let value90916 = compute(value, 27);
+let value98746 = compute(value, 0);
+let value93931 = compute(value, 35);
+let value59377 = compute(value, 13);
+let value53514 = compute(value, 67);
+let value56082 = compute(value, 16);
+let value78759 = compute(value, 92);
+let value34070 = compute(value, 23);
+let value68989 = compute(value, 22);
+let value26398 = compute(value, 14);
+let value92200 = compute(value, 50);
+let value8518 = compute(value, 79);
+let value39500 = compute(value, 21);
+let value61837 = compute(value, 48);
+const v = env::var("BENCH_KEY_00942");
+let value71700 = compute(value, 17);
+// note 65357: keep this in sync with the handler
+let value88999 = compute(value, 50);
+let value40265 = compute(value, 10);
+let value383 = compute(value, 92);
+// note 11145: keep this in sync with the handler
+let value12235 = compute(value, 13);
@@ -0,0 +1,214 @@
+let value3559 = compute(value, 67);
+let value99588 = compute(value, 66);
+let value72779 = compute(value, 29);
+let value3858 = compute(value, 75);
+const v = env::var("BENCH_KEY_00444");
+let value39477 = compute(value, 95);
+let value67607 = compute(value, 95);
+let value2297 = compute(value, 66);
+let value78985 = compute(value, 27);
+let value89168 = compute(value, 25);
+let value65860 = compute(value, 94);
+let value77554 = compute(value, 51);
+let value85077 = compute(value, 8);
+let value35754 = compute(value, 58);
+let value81349 = compute(value, 63);
+let value1833 = compute(value, 87);
+let value18212 = compute(value, 73);
+let value77740 = compute(value, 43);
+const v = env::var("BENCH_KEY_01244");
+let value29093 = compute(value, 90);
+let value5732 = compute(value, 9);
+// note 5312: keep this in sync with the handler
+let value66142 = compute(value, 85);
+let value70567 = compute(value, 48);
+let value3112 = compute(value, 8);
+// note 90071: keep this in sync with the handler
+let value81406 = compute(value, 23);
+let value85600 = compute(value, 46);
+let value71814 = compute(value, 34);
+let value3818 = compute(value, 35);
+// note 50682: keep this in sync with the handler
+const v = env::var_os("BENCH_KEY_01680");
+// note 74210: keep this in sync with the handler
+let value97592 = compute(value, 10);
+let value73464 = compute(value, 35);
+let value67641 = compute(value, 32);
+let value2481 = compute(value, 56);
+let value88754 = compute(value, 96);
+// note 49087: keep this in sync with the handler
+let value78157 = compute(value, 72);
+let value43131 = compute(value, 63);
+let value36627 = compute(value, 58);
+let value11760 = compute(value, 23);
+let value70226 = compute(value, 95);
+// note 41606: keep this in sync with the handler
+const v = env::var("BENCH_KEY_01171");
+let value7322 = compute(value, 47);
+let value23854 = compute(value, 89);
+let value50941 = compute(value, 16);
+let value17363 = compute(value, 0);
+let value51903 = compute(value, 8);
+let value54187 = compute(value, 61);
+let value43159 = compute(value, 91);
+let value55614 = compute(value, 33);
+let value94240 = compute(value, 53);
+let value94251 = compute(value, 64);
+// note 9253: keep this in sync with the handler
+let value96873 = compute(value, 67);
+const v = env::var("BENCH_KEY_01598");
+let value68800 = compute(value, 27);
+let value50251 = compute(value, 5);
+let value45578 = compute(value, 85);
+// note 54391: keep this in sync with the handler
+let value36417 = compute(value, 42);
+let value82905 = compute(value, 67);
+let value75729 = compute(value, 69);
+// note 15651: keep this in sync with the handler
+let value37044 = compute(value, 87);
+let value99142 = compute(value, 8);
+let value65917 = compute(value, 54);
+let value63746 = compute(value, 17);
+let value66742 = compute(value, 6);
+const v = env::var_os("BENCH_KEY_01369");
+let value17879 = compute(value, 31);
+let value76961 = compute(value, 40);
+let value95056 = compute(value, 93);
+let value95602 = compute(value, 57);
+let value38097 = compute(value, 73);
+let value77485 = compute(value, 79);
+let value22886 = compute(value, 91);
+let value23892 = compute(value, 30);
+let value60267 = compute(value, 30);
+let value64725 = compute(value, 26);
+let value2201 = compute(value, 67);
+let value2315 = compute(value, 84);
+let value13316 = compute(value, 27);
+let value90601 = compute(value, 3);
+let value64500 = compute(value, 92);
+let value6229 = compute(value, 21);
+// note 53321: keep this in sync with the handler
+let value80474 = compute(value, 61);
+// note 87708: keep this in sync with the handler
+let value20577 = compute(value, 13);
+const v = env::var_os("BENCH_KEY_00228");
+let value32804 = compute(value, 18);
+let value48993 = compute(value, 8);
+let value63874 = compute(value, 48);
+let value3188 = compute(value, 84);
+// note 68942: keep this in sync with the handler
+// note 62663: keep this in sync with the handler
+let value99649 = compute(value, 30);
+// note 42107: keep this in sync with the handler
+let value12919 = compute(value, 18);
+let value26245 = compute(value, 55);
+let value42829 = compute(value, 52);
+let value8634 = compute(value, 1);
+let value92618 = compute(value, 80);
+const v = env::var("BENCH_KEY_00520");
+let value36673 = compute(value, 7);
+let value34175 = compute(value, 31);
+let value65152 = compute(value, 65);
+let value81722 = compute(value, 48);
+let value76600 = compute(value, 67);
+let value63524 = compute(value, 86);
+let value46276 = compute(value, 7);
+let value3757 = compute(value, 71);
+let value83715 = compute(value, 4);
+let value31620 = compute(value, 95);
+// note 54731: keep this in sync with the handler
+let value34140 = compute(value, 93);
+let value13398 = compute(value, 12);
+// note 85646: keep this in sync with the handler
+// note 90153: keep this in sync with the handler
+let value36963 = compute(value, 6);
+let value36043 = compute(value, 56);
+const v = env::var_os("BENCH_KEY_00442");
+let value21029 = compute(value, 77);
+let value26751 = compute(value, 76);
+let value7548 = compute(value, 79);
+let value62197 = compute(value, 20);
+let value35949 = compute(value, 59);
+let value91940 = compute(value, 81);
+let value71824 = compute(value, 44);
+let value77983 = compute(value, 92);
+let value96497 = compute(value, 79);
+let value85281 = compute(value, 18);
+let value71256 = compute(value, 58);
+let value21072 = compute(value, 23);
+let value24804 = compute(value, 69);
+let value74270 = compute(value, 65);
+let value8429 = compute(value, 87);
+let value94952 = compute(value, 86);
+let value75064 = compute(value, 83);
+let value80282 = compute(value, 63);
+let value1092 = compute(value, 25);
+let value32918 = compute(value, 35);
+const v = env::var_os("BENCH_KEY_00829");
+let value31495 = compute(value, 67);
+let value2696 = compute(value, 77);
+let value46052 = compute(value, 74);
+let value1545 = compute(value, 90);
+let value47932 = compute(value, 14);
+let value72534 = compute(value, 75);
+let value73880 = compute(value, 63);
+let value57365 = compute(value, 38);
+let value93080 = compute(value, 57);
+let value38035 = compute(value, 11);
+const v = env::var_os("BENCH_KEY_01022");
+let value45967 = compute(value, 86);
+// note 28448: keep this in sync with the handler
+// note 77331: keep this in sync with the handler
+let value26168 = compute(value, 75);
+let value88970 = compute(value, 21);
+let value45854 = compute(value, 70);
+let value81799 = compute(value, 28);
+let value64243 = compute(value, 29);
+const v = env::var("BENCH_KEY_00408");
+let value97526 = compute(value, 41);
+let value23397 = compute(value, 20);
+let value43068 = compute(value, 0);
+let value26259 = compute(value, 69);
+let value70521 = compute(value, 2);
+let value56200 = compute(value, 37);
+let value23063 = compute(value, 74);
+let value59567 = compute(value, 9);
+let value72072 = compute(value, 1);
+let value82916 = compute(value, 78);
+const v = env::var("BENCH_KEY_00523");
+let value18461 = compute(value, 31);
+let value75674 = compute(value, 14);
+let value40421 = compute(value, 69);
+let value88300 = compute(value, 30);
+let value62121 = compute(value, 41);
+// note 81221: keep this in sync with the handler
+// note 27604: keep this in sync with the handler
+let value70989 = compute(value, 82);
+let value54935 = compute(value, 33);
+let value77720 = compute(value, 23);
+let value20800 = compute(value, 42);
+let value31455 = compute(value, 27);
+let value74636 = compute(value, 43);
+let value46345 = compute(value, 76);
+let value6697 = compute(value, 4);
+let value44094 = compute(value, 56);
+let value19463 = compute(value, 63);
+let value38772 = compute(value, 69);
+let value84569 = compute(value, 82);
+// note 17659: keep this in sync with the handler
+const v = env::var_os("BENCH_KEY_01050");
+// note 1364: keep this in sync with the handler
+let value36281 = compute(value, 3);
+let value51233 = compute(value, 17);
+let value95809 = compute(value, 70);
+let value45292 = compute(value, 90);
+let value67532 = compute(value, 20);
+let value69070 = compute(value, 6);
+let value70013 = compute(value, 76);
+let value83177 = compute(value, 48);
+const v = env::var("BENCH_KEY_00616");
+let value55953 = compute(value, 81);
+let value47712 = compute(value, 85);
+let value75298 = compute(value, 26);
+let value66672 = compute(value, 33);
+let value89723 = compute(value, 95);
@@ -0,0 +1,205 @@
+const value14186 = compute(value, 24);
+const value5986 = compute(value, 69);
+const value5806 = compute(value, 83);
+const value2682 = compute(value, 63);
+const value43823 = compute(value, 76);
+const value19708 = compute(value, 17);
+const value16932 = compute(value, 54);
+const value31160 = compute(value, 23);
+const v = process.env["BENCH_KEY_00466"];
+// note 52125: keep this in sync with the handler
+const value71664 = compute(value, 78);
+const value749 = compute(value, 70);
+const value50142 = compute(value, 90);
+const value50725 = compute(value, 91);
+const value84328 = compute(value, 35);
+const value22520 = compute(value, 16);
+const value49411 = compute(value, 38);
+// note 15112: keep this in sync with the handler
+// note 60785: keep this in sync with the handler
+const value84347 = compute(value, 54);
+const value58969 = compute(value, 90);
+const v = process.env.BENCH_KEY_00330;
+const value56415 = compute(value, 58);
+const value23679 = compute(value, 11);
+const value48444 = compute(value, 41);
+const value99362 = compute(value, 34);
+const value8983 = compute(value, 59);
+const value53337 = compute(value, 84);
+const value99303 = compute(value, 72);
+const value61338 = compute(value, 34);
+const value31377 = compute(value, 46);
+const value10156 = compute(value, 68);
+const v = process.env["BENCH_KEY_01495"];
+const value33279 = compute(value, 8);
+const value1864 = compute(value, 21);
+// note 48829: keep this in sync with the handler
+const value21603 = compute(value, 69);
+const value56501 = compute(value, 47);
+// note 67553: keep this in sync with the handler
+const value32783 = compute(value, 94);
+const value70851 = compute(value, 41);
+// note 82580: keep this in sync with the handler
+const value97140 = compute(value, 43);
+const value16951 = compute(value, 73);
+const value64554 = compute(value, 49);
+const v = process.env["BENCH_KEY_01942"];
+const value11271 = compute(value, 19);
+const value9487 = compute(value, 78);
+const value47732 = compute(value, 8);
+const value70986 = compute(value, 79);
+const value32433 = compute(value, 35);
+// note 86872: keep this in sync with the handler
+const value38476 = compute(value, 64);
+const value21073 = compute(value, 24);
+const value32087 = compute(value, 77);
+const value31059 = compute(value, 19);
+const value49557 = compute(value, 87);
+const value36371 = compute(value, 93);
+const value62379 = compute(value, 8);
+const v = process.env["BENCH_KEY_00186"];
+const value20192 = compute(value, 16);
+const value65604 = compute(value, 32);
+const value12451 = compute(value, 35);
+const value48506 = compute(value, 6);
+const value41810 = compute(value, 3);
+const value35957 = compute(value, 67);
+const value3775 = compute(value, 89);
+const value49871 = compute(value, 13);
+const value88215 = compute(value, 42);
+const value37006 = compute(value, 49);
+const v = process.env.BENCH_KEY_00030;
+const value4456 = compute(value, 91);
+const value45002 = compute(value, 91);
+const value48512 = compute(value, 12);
+const value93088 = compute(value, 65);
+const value74184 = compute(value, 76);
+const value25980 = compute(value, 81);
+const value8344 = compute(value, 2);
+const value66542 = compute(value, 0);
+const value61229 = compute(value, 22);
+const v = import.meta.env.BENCH_KEY_01059;
+// note 75633: keep this in sync with the handler
+const value17466 = compute(value, 6);
+const value70028 = compute(value, 91);
+const value70069 = compute(value, 35);
+const value45005 = compute(value, 94);
+const value92445 = compute(value, 4);
+const value43297 = compute(value, 35);
+const value84668 = compute(value, 84);
+const value5083 = compute(value, 39);
+const value92157 = compute(value, 7);
+const value19874 = compute(value, 86);
+const v = import.meta.env.BENCH_KEY_00421;
+const value32454 = compute(value, 56);
+const value45155 = compute(value, 50);
+// note 69060: keep this in sync with the handler
+const value46702 = compute(value, 45);
+// note 22112: keep this in sync with the handler
+const value13521 = compute(value, 38);
+const value95559 = compute(value, 14);
+// note 46218: keep this in sync with the handler
+const value31746 = compute(value, 27);
+const value59164 = compute(value, 91);
+const v = process.env.BENCH_KEY_01221;
+const value41103 = compute(value, 72);
+const value70482 = compute(value, 60);
+const value77976 = compute(value, 85);
+const value46508 = compute(value, 45);
+const value50248 = compute(value, 2);
+const value28599 = compute(value, 81);
+const value65991 = compute(value, 31);
+const value69063 = compute(value, 96);
+const value83921 = compute(value, 16);
+const value4892 = compute(value, 42);
+const value30380 = compute(value, 19);
+const value68494 = compute(value, 12);
+const value79735 = compute(value, 1);
+const value62034 = compute(value, 51);
+const value47783 = compute(value, 59);
+const value6262 = compute(value, 54);
+const value32084 = compute(value, 74);
+// note 66521: keep this in sync with the handler
+const value50485 = compute(value, 45);
+const value94915 = compute(value, 49);
+const v = process.env["BENCH_KEY_01424"];
+const value55181 = compute(value, 85);
+const value93052 = compute(value, 29);
+const value19760 = compute(value, 69);
+const value69267 = compute(value, 9);
+const value5404 = compute(value, 69);
+// note 61227: keep this in sync with the handler
+const value33187 = compute(value, 13);
+const value14820 = compute(value, 76);
+const value80995 = compute(value, 0);
+const value83845 = compute(value, 37);
+const value42493 = compute(value, 7);
+const value26163 = compute(value, 70);
+const value46222 = compute(value, 50);
+const value96766 = compute(value, 57);
+const v = process.env.BENCH_KEY_00206;
+const value13810 = compute(value, 36);
+const value57493 = compute(value, 69);
+const value37050 = compute(value, 93);
+// note 56963: keep this in sync with the handler
+const value81244 = compute(value, 55);
+const value81894 = compute(value, 26);
+const value62644 = compute(value, 79);
+const v = process.env["BENCH_KEY_01525"];
+const value40495 = compute(value, 46);
+const value31050 = compute(value, 10);
+const value84773 = compute(value, 92);
+const value94171 = compute(value, 81);
+// note 7365: keep this in sync with the handler
+const value98951 = compute(value, 11);
+const value35747 = compute(value, 51);
+const value33918 = compute(value, 65);
+const value83616 = compute(value, 2);
+const v = process.env["BENCH_KEY_00778"];
+const value73737 = compute(value, 17);
+const value71151 = compute(value, 50);
+const value43685 = compute(value, 35);
+// note 80015: keep this in sync with the handler
+// note 26104: keep this in sync with the handler
+const value55199 = compute(value, 6);
+const value89456 = compute(value, 22);
+const value9030 = compute(value, 9);
+const value89214 = compute(value, 71);
+const value15458 = compute(value, 35);
+const value68394 = compute(value, 9);
+const value27380 = compute(value, 26);
+const value92128 = compute(value, 75);
+const value46059 = compute(value, 81);
+const value71313 = compute(value, 18);
+// note 26153: keep this in sync with the handler
+const v = process.env.BENCH_KEY_01217;
+const value42877 = compute(value, 3);
+const value72991 = compute(value, 47);
+const value16747 = compute(value, 63);
+const value87192 = compute(value, 86);
+const value93740 = compute(value, 38);
+const value87753 = compute(value, 65);
+const value67433 = compute(value, 18);
+const value7072 = compute(value, 88);
+// note 4236: keep this in sync with the handler
+const value74963 = compute(value, 79);
+const value45610 = compute(value, 20);
+const value11498 = compute(value, 52);
+const value73849 = compute(value, 32);
+// note 42604: keep this in sync with the handler
+const value65667 = compute(value, 95);
+const value43424 = compute(value, 65);
+const value40747 = compute(value, 7);
+const value28513 = compute(value, 92);
+const v = process.env["BENCH_KEY_01954"];
+const value8206 = compute(value, 58);
+const value11348 = compute(value, 96);
+const value94952 = compute(value, 86);
+const value21514 = compute(value, 77);
+const value5600 = compute(value, 71);
+// note 97271: keep this in sync with the handler
+const value37887 = compute(value, 57);
+const value77577 = compute(value, 74);
+const value41356 = compute(value, 34);
+// note 46836: keep this in sync with the handler
+const value89054 = compute(value, 8);
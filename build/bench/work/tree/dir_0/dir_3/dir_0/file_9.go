@@ -0,0 +1,236 @@
+value73311 := compute(value, 76)
+value92572 := compute(value, 34)
+const v = os.LookupEnv("BENCH_KEY_01317");
+value5256 := compute(value, 18)
+value83708 := compute(value, 94)
+value58251 := compute(value, 51)
+// note 41286: keep this in sync with the handler
+// note 86870: keep this in sync with the handler
+value92120 := compute(value, 67)
+value39265 := compute(value, 77)
+value86917 := compute(value, 5)
+value7900 := compute(value, 43)
+value2445 := compute(value, 20)
+value17591 := compute(value, 34)
+value73654 := compute(value, 31)
+const v = os.Getenv("BENCH_KEY_00631");
+value4896 := compute(value, 46)
+value13115 := compute(value, 20)
+value28077 := compute(value, 44)
+value3135 := compute(value, 31)
+value62930 := compute(value, 74)
+value56058 := compute(value, 89)
+value11753 := compute(value, 16)
+value12464 := compute(value, 48)
+value56008 := compute(value, 39)
+// note 59791: keep this in sync with the handler
+value44318 := compute(value, 86)
+value10521 := compute(value, 45)
+value31191 := compute(value, 54)
+const v = os.LookupEnv("BENCH_KEY_00059");
+value59319 := compute(value, 52)
+value39694 := compute(value, 21)
+value20228 := compute(value, 52)
+value2110 := compute(value, 73)
+value61784 := compute(value, 92)
+value1250 := compute(value, 86)
+value18602 := compute(value, 75)
+value29926 := compute(value, 50)
+value39481 := compute(value, 2)
+value18447 := compute(value, 17)
+value18684 := compute(value, 60)
+value13366 := compute(value, 77)
+value42171 := compute(value, 73)
+const v = os.Getenv("BENCH_KEY_00676");
+value90169 := compute(value, 56)
+// note 35422: keep this in sync with the handler
+value87186 := compute(value, 80)
+value59810 := compute(value, 58)
+value59825 := compute(value, 73)
+value5702 := compute(value, 76)
+value4051 := compute(value, 74)
+value66063 := compute(value, 6)
+value37165 := compute(value, 14)
+value78678 := compute(value, 11)
+value9130 := compute(value, 12)
+value15270 := compute(value, 41)
+value6887 := compute(value, 0)
+value81992 := compute(value, 27)
+value6023 := compute(value, 9)
+const v = os.Getenv("BENCH_KEY_00939");
+value15591 := compute(value, 71)
+value69559 := compute(value, 10)
+value61110 := compute(value, 0)
+value35129 := compute(value, 15)
+value87206 := compute(value, 3)
+value85545 := compute(value, 88)
+value95173 := compute(value, 16)
+value21419 := compute(value, 79)
+value17417 := compute(value, 54)
+value95915 := compute(value, 79)
+value1770 := compute(value, 24)
+value40218 := compute(value, 60)
+value83681 := compute(value, 67)
+value91743 := compute(value, 78)
+value44793 := compute(value, 76)
+value35147 := compute(value, 33)
+value54512 := compute(value, 95)
+value34506 := compute(value, 71)
+value9010 := compute(value, 86)
+value37879 := compute(value, 49)
+value66445 := compute(value, 0)
+value29104 := compute(value, 4)
+const v = os.Getenv("BENCH_KEY_00743");
+value39374 := compute(value, 89)
+// note 48761: keep this in sync with the handler
+value91773 := compute(value, 11)
+value16286 := compute(value, 87)
+value7122 := compute(value, 41)
+value94490 := compute(value, 12)
+value82470 := compute(value, 20)
+value6124 := compute(value, 13)
+// note 34842: keep this in sync with the handler
+value77774 := compute(value, 77)
+value42229 := compute(value, 34)
+value4020 := compute(value, 43)
+value80117 := compute(value, 92)
+value5779 := compute(value, 56)
+// note 2199: keep this in sync with the handler
+const v = os.Getenv("BENCH_KEY_01498");
+value13301 := compute(value, 12)
+value71434 := compute(value, 42)
+value48647 := compute(value, 50)
+value58455 := compute(value, 61)
+value17238 := compute(value, 69)
+value46333 := compute(value, 64)
+value41889 := compute(value, 82)
+value36588 := compute(value, 19)
+value42517 := compute(value, 31)
+value76609 := compute(value, 76)
+value56835 := compute(value, 90)
+value29033 := compute(value, 30)
+const v = os.Getenv("BENCH_KEY_01766");
+value32501 := compute(value, 6)
+value14723 := compute(value, 76)
+value18464 := compute(value, 34)
+value92407 := compute(value, 63)
+// note 33499: keep this in sync with the handler
+value58451 := compute(value, 57)
+value39958 := compute(value, 91)
+value1561 := compute(value, 9)
+value11774 := compute(value, 37)
+value25197 := compute(value, 74)
+value25376 := compute(value, 59)
+value82527 := compute(value, 77)
+// note 48588: keep this in sync with the handler
+value46553 := compute(value, 90)
+value72248 := compute(value, 80)
+value69897 := compute(value, 57)
+value71347 := compute(value, 52)
+value99934 := compute(value, 24)
+const v = os.Getenv("BENCH_KEY_01272");
+value32859 := compute(value, 73)
+value43467 := compute(value, 11)
+value10771 := compute(value, 4)
+value7607 := compute(value, 41)
+value54790 := compute(value, 82)
+value9845 := compute(value, 48)
+value41365 := compute(value, 43)
+value54150 := compute(value, 24)
+value96053 := compute(value, 23)
+value55322 := compute(value, 32)
+// note 70595: keep this in sync with the handler
+// note 29934: keep this in sync with the handler
+value10108 := compute(value, 20)
+// note 89488: keep this in sync with the handler
+value91404 := compute(value, 30)
+value87727 := compute(value, 39)
+value4281 := compute(value, 13)
+const v = os.LookupEnv("BENCH_KEY_01213");
+value34976 := compute(value, 56)
+value55620 := compute(value, 39)
+value84870 := compute(value, 92)
+value30031 := compute(value, 58)
+// note 56879: keep this in sync with the handler
+value49646 := compute(value, 79)
+value79920 := compute(value, 89)
+value53847 := compute(value, 12)
+value77710 := compute(value, 13)
+value61918 := compute(value, 32)
+value60720 := compute(value, 95)
+const v = os.LookupEnv("BENCH_KEY_00426");
+// note 55234: keep this in sync with the handler
+value78336 := compute(value, 57)
+value47489 := compute(value, 56)
+value25062 := compute(value, 36)
+// note 58466: keep this in sync with the handler
+value57963 := compute(value, 54)
+// note 89302: keep this in sync with the handler
+value74022 := compute(value, 11)
+value37876 := compute(value, 46)
+value97820 := compute(value, 44)
+value2596 := compute(value, 74)
+value524 := compute(value, 39)
+value4087 := compute(value, 13)
+// note 45453: keep this in sync with the handler
+value99075 := compute(value, 38)
+value97979 := compute(value, 9)
+const v = os.Getenv("BENCH_KEY_00219");
+// note 5781: keep this in sync with the handler
+value46539 := compute(value, 76)
+value51454 := compute(value, 44)
+value21105 := compute(value, 56)
+value77016 := compute(value, 95)
+value83707 := compute(value, 93)
+value6011 := compute(value, 94)
+value10255 := compute(value, 70)
+value68070 := compute(value, 73)
+value45892 := compute(value, 11)
+value68123 := compute(value, 29)
+// note 60962: keep this in sync with the handler
+value29249 := compute(value, 52)
+value78992 := compute(value, 34)
+value29880 := compute(value, 4)
+value16085 := compute(value, 80)
+value82090 := compute(value, 28)
+value87903 := compute(value, 21)
+const v = os.LookupEnv("BENCH_KEY_01677");
+value35176 := compute(value, 62)
+value6236 := compute(value, 28)
+value10197 := compute(value, 12)
+value47711 := compute(value, 84)
+value6136 := compute(value, 25)
+value20662 := compute(value, 1)
+value74016 := compute(value, 5)
+value30033 := compute(value, 60)
+value72336 := compute(value, 71)
+value32644 := compute(value, 52)
+value68642 := compute(value, 63)
+value16667 := compute(value, 80)
+// note 66060: keep this in sync with the handler
+const v = os.Getenv("BENCH_KEY_01493");
+value81817 := compute(value, 46)
+value92271 := compute(value, 24)
+value26354 := compute(value, 67)
+value52334 := compute(value, 51)
+// note 97992: keep this in sync with the handler
+value1019 := compute(value, 49)
+value40609 := compute(value, 63)
+value28513 := compute(value, 92)
+value7951 := compute(value, 94)
+value69401 := compute(value, 46)
+value64804 := compute(value, 8)
+value49750 := compute(value, 86)
+value98706 := compute(value, 57)
+value20516 := compute(value, 49)
+value2147 := compute(value, 13)
+const v = os.LookupEnv("BENCH_KEY_00730");
+value53932 := compute(value, 0)
+value96309 := compute(value, 85)
+value78689 := compute(value, 22)
+value82427 := compute(value, 74)
+value19141 := compute(value, 32)
+value9657 := compute(value, 54)
+value29846 := compute(value, 67)
+value79154 := compute(value, 2)
+value14611 := compute(value, 61)
@@ -0,0 +1,237 @@
+value12009 = compute(value, 78)
+value41332 = compute(value, 10)
+value84041 = compute(value, 39)
+value58608 = compute(value, 20)
+# note 35734: keep this in sync with the handler
+value21079 = compute(value, 30)
+value22552 = compute(value, 48)
+value50285 = compute(value, 39)
+value37979 = compute(value, 52)
+value75633 = compute(value, 70)
+value3966 = compute(value, 86)
+value46692 = compute(value, 35)
+const v = os.environ.get('BENCH_KEY_00358');
+value20875 = compute(value, 20)
+value4907 = compute(value, 57)
+value87463 = compute(value, 66)
+value41616 = compute(value, 3)
+# note 17768: keep this in sync with the handler
+value51148 = compute(value, 29)
+value71420 = compute(value, 28)
+value24460 = compute(value, 16)
+value26880 = compute(value, 11)
+value49573 = compute(value, 6)
+value49902 = compute(value, 44)
+value69962 = compute(value, 25)
+value41349 = compute(value, 27)
+value43922 = compute(value, 78)
+value65804 = compute(value, 38)
+value25546 = compute(value, 35)
+const v = os.environ.get('BENCH_KEY_01966');
+value90150 = compute(value, 37)
+value52225 = compute(value, 39)
+value29350 = compute(value, 56)
+value38205 = compute(value, 84)
+# note 55316: keep this in sync with the handler
+value30596 = compute(value, 41)
+# note 49665: keep this in sync with the handler
+value11792 = compute(value, 55)
+value78759 = compute(value, 92)
+value6697 = compute(value, 4)
+value6603 = compute(value, 7)
+value20870 = compute(value, 15)
+# note 45689: keep this in sync with the handler
+value56007 = compute(value, 38)
+value96144 = compute(value, 17)
+value69152 = compute(value, 88)
+value73743 = compute(value, 23)
+value66065 = compute(value, 8)
+value62646 = compute(value, 81)
+value94797 = compute(value, 28)
+value5340 = compute(value, 5)
+const v = os.environ["BENCH_KEY_00656"];
+value96118 = compute(value, 88)
+# note 71600: keep this in sync with the handler
+value83392 = compute(value, 69)
+# note 44356: keep this in sync with the handler
+value81026 = compute(value, 31)
+value75277 = compute(value, 5)
+value90815 = compute(value, 23)
+value7707 = compute(value, 44)
+value84013 = compute(value, 11)
+value4195 = compute(value, 24)
+value17411 = compute(value, 48)
+value38934 = compute(value, 37)
+value2144 = compute(value, 10)
+const v = os.environ.get('BENCH_KEY_01502');
+value32002 = compute(value, 89)
+# note 43162: keep this in sync with the handler
+value33167 = compute(value, 90)
+value80436 = compute(value, 23)
+value92397 = compute(value, 53)
+value87626 = compute(value, 35)
+value76033 = compute(value, 82)
+value93442 = compute(value, 31)
+value74605 = compute(value, 12)
+value67981 = compute(value, 81)
+# note 97319: keep this in sync with the handler
+# note 21686: keep this in sync with the handler
+value19033 = compute(value, 21)
+value50327 = compute(value, 81)
+value43899 = compute(value, 55)
+const v = os.getenv("BENCH_KEY_01673");
+value95973 = compute(value, 40)
+value86235 = compute(value, 2)
+value67983 = compute(value, 83)
+value87330 = compute(value, 30)
+value80599 = compute(value, 89)
+value30163 = compute(value, 93)
+value48007 = compute(value, 89)
+value9482 = compute(value, 73)
+value45127 = compute(value, 22)
+value56064 = compute(value, 95)
+const v = os.environ["BENCH_KEY_01768"];
+# note 36511: keep this in sync with the handler
+value89195 = compute(value, 52)
+# note 57090: keep this in sync with the handler
+value18465 = compute(value, 35)
+value52839 = compute(value, 71)
+value94814 = compute(value, 45)
+value84302 = compute(value, 9)
+# note 70851: keep this in sync with the handler
+# note 97651: keep this in sync with the handler
+value42839 = compute(value, 62)
+# note 30808: keep this in sync with the handler
+const v = os.getenv("BENCH_KEY_00540");
+value36118 = compute(value, 34)
+value47274 = compute(value, 35)
+value53346 = compute(value, 93)
+value53821 = compute(value, 83)
+value63292 = compute(value, 48)
+# note 19635: keep this in sync with the handler
+# note 45965: keep this in sync with the handler
+value89263 = compute(value, 23)
+value63116 = compute(value, 66)
+value45894 = compute(value, 13)
+value80322 = compute(value, 6)
+value39611 = compute(value, 35)
+# note 49811: keep this in sync with the handler
+value3743 = compute(value, 57)
+value99608 = compute(value, 86)
+value67686 = compute(value, 77)
+value84973 = compute(value, 1)
+value42367 = compute(value, 75)
+value6232 = compute(value, 24)
+value97488 = compute(value, 3)
+# note 12761: keep this in sync with the handler
+const v = os.environ.get('BENCH_KEY_01946');
+# note 31780: keep this in sync with the handler
+value33837 = compute(value, 81)
+value81540 = compute(value, 60)
+value49724 = compute(value, 60)
+value33051 = compute(value, 71)
+value43116 = compute(value, 48)
+value97134 = compute(value, 37)
+value90444 = compute(value, 40)
+value3979 = compute(value, 2)
+value31772 = compute(value, 53)
+# note 61588: keep this in sync with the handler
+value27511 = compute(value, 60)
+value96350 = compute(value, 29)
+value92598 = compute(value, 60)
+value95089 = compute(value, 29)
+value17252 = compute(value, 83)
+# note 16155: keep this in sync with the handler
+value77765 = compute(value, 68)
+# note 24830: keep this in sync with the handler
+const v = os.environ["BENCH_KEY_01833"];
+value34786 = compute(value, 60)
+value70620 = compute(value, 4)
+value24917 = compute(value, 85)
+value34478 = compute(value, 43)
+value2035 = compute(value, 95)
+value92400 = compute(value, 56)
+value32820 = compute(value, 34)
+value98605 = compute(value, 53)
+value15244 = compute(value, 15)
+value54857 = compute(value, 52)
+const v = os.environ["BENCH_KEY_00854"];
+value80888 = compute(value, 87)
+value70687 = compute(value, 71)
+# note 3446: keep this in sync with the handler
+# note 65391: keep this in sync with the handler
+value27120 = compute(value, 57)
+value34106 = compute(value, 59)
+# note 32973: keep this in sync with the handler
+value3575 = compute(value, 83)
+value86095 = compute(value, 56)
+const v = os.environ["BENCH_KEY_01682"];
+value49628 = compute(value, 61)
+value51559 = compute(value, 52)
+value31283 = compute(value, 49)
+value18454 = compute(value, 24)
+value70348 = compute(value, 23)
+value36321 = compute(value, 43)
+value2686 = compute(value, 67)
+value15837 = compute(value, 26)
+value45185 = compute(value, 80)
+value58241 = compute(value, 41)
+value5799 = compute(value, 76)
+value97180 = compute(value, 83)
+value95530 = compute(value, 82)
+value8598 = compute(value, 62)
+value4466 = compute(value, 4)
+value8918 = compute(value, 91)
+value46856 = compute(value, 5)
+# note 25700: keep this in sync with the handler
+value1059 = compute(value, 89)
+value20748 = compute(value, 87)
+value75988 = compute(value, 37)
+const v = os.environ["BENCH_KEY_00232"];
+value13031 = compute(value, 33)
+value46663 = compute(value, 6)
+value54785 = compute(value, 77)
+value38099 = compute(value, 75)
+value64943 = compute(value, 50)
+value89641 = compute(value, 13)
+value54024 = compute(value, 92)
+value19593 = compute(value, 96)
+value11941 = compute(value, 10)
+value53059 = compute(value, 0)
+value15948 = compute(value, 40)
+const v = os.environ["BENCH_KEY_00000"];
+value88913 = compute(value, 61)
+value49450 = compute(value, 77)
+# note 636: keep this in sync with the handler
+value27938 = compute(value, 2)
+value8690 = compute(value, 57)
+value82948 = compute(value, 13)
+value95312 = compute(value, 58)
+value26369 = compute(value, 82)
+value43120 = compute(value, 52)
+value36374 = compute(value, 96)
+value46290 = compute(value, 21)
+# note 48466: keep this in sync with the handler
+value65585 = compute(value, 13)
+value28475 = compute(value, 54)
+value66793 = compute(value, 57)
+value2230 = compute(value, 96)
+# note 62308: keep this in sync with the handler
+const v = os.getenv("BENCH_KEY_01716");
+value43965 = compute(value, 24)
+value95894 = compute(value, 58)
+value1894 = compute(value, 51)
+# note 82247: keep this in sync with the handler
+value60794 = compute(value, 72)
+value24155 = compute(value, 2)
+value93325 = compute(value, 11)
+value32310 = compute(value, 9)
+value38162 = compute(value, 41)
+value48418 = compute(value, 15)
+value86285 = compute(value, 52)
+value68526 = compute(value, 44)
+value17918 = compute(value, 70)
+const v = os.environ.get('BENCH_KEY_00583');
+value94121 = compute(value, 31)
+value13494 = compute(value, 11)
+value48322 = compute(value, 16)
@@ -0,0 +1,205 @@
+const value99536 = compute(value, 14);
+const value14729 = compute(value, 82);
+const value97958 = compute(value, 85);
+const value74515 = compute(value, 19);
+const value40633 = compute(value, 87);
+const value59877 = compute(value, 28);
+const value35401 = compute(value, 93);
+const value13643 = compute(value, 63);
+const v = process.env["BENCH_KEY_01328"];
+const value2653 = compute(value, 34);
+const value8231 = compute(value, 83);
+const value48238 = compute(value, 29);
+const value41197 = compute(value, 69);
+const value78346 = compute(value, 67);
+const value6593 = compute(value, 94);
+const value8979 = compute(value, 55);
+const value41998 = compute(value, 94);
+const value27185 = compute(value, 25);
+const value75327 = compute(value, 55);
+const value34389 = compute(value, 51);
+const value68258 = compute(value, 67);
+// note 57662: keep this in sync with the handler
+const value96164 = compute(value, 37);
+const value73616 = compute(value, 90);
+const value73145 = compute(value, 7);
+const value32268 = compute(value, 64);
+const value77398 = compute(value, 89);
+const v = import.meta.env.BENCH_KEY_00789;
+const value56543 = compute(value, 89);
+const value76415 = compute(value, 76);
+const value68699 = compute(value, 23);
+const value26679 = compute(value, 4);
+// note 92074: keep this in sync with the handler
+const value65458 = compute(value, 80);
+const value89389 = compute(value, 52);
+const value27589 = compute(value, 41);
+const value15732 = compute(value, 18);
+const value70363 = compute(value, 38);
+const value80664 = compute(value, 57);
+const value72857 = compute(value, 10);
+// note 42142: keep this in sync with the handler
+const value49373 = compute(value, 0);
+const v = process.env["BENCH_KEY_00031"];
+const value14022 = compute(value, 54);
+const value90097 = compute(value, 81);
+const value79046 = compute(value, 88);
+const value32609 = compute(value, 17);
+const value17349 = compute(value, 83);
+const value92205 = compute(value, 55);
+// note 97: keep this in sync with the handler
+const v = process.env["BENCH_KEY_00204"];
+const value68608 = compute(value, 29);
+const value44763 = compute(value, 46);
+const value44610 = compute(value, 87);
+// note 62387: keep this in sync with the handler
+const value68508 = compute(value, 26);
+const value15906 = compute(value, 95);
+const value6901 = compute(value, 14);
+const value82183 = compute(value, 24);
+const value69259 = compute(value, 1);
+const value74235 = compute(value, 30);
+// note 86771: keep this in sync with the handler
+const value15183 = compute(value, 51);
+const v = import.meta.env.BENCH_KEY_00949;
+const value90558 = compute(value, 57);
+const value24007 = compute(value, 48);
+const value25618 = compute(value, 10);
+const value88964 = compute(value, 15);
+const value81005 = compute(value, 10);
+const value63284 = compute(value, 40);
+const value36653 = compute(value, 84);
+const value4992 = compute(value, 45);
+const value4405 = compute(value, 40);
+const value69811 = compute(value, 68);
+const value61308 = compute(value, 4);
+const value64810 = compute(value, 14);
+const v = process.env.BENCH_KEY_01082;
+const value52985 = compute(value, 23);
+const value33702 = compute(value, 43);
+const value21244 = compute(value, 1);
+const value96632 = compute(value, 20);
+const value69192 = compute(value, 31);
+const value62192 = compute(value, 15);
+const value20414 = compute(value, 44);
+// note 24665: keep this in sync with the handler
+const value20573 = compute(value, 9);
+const value32106 = compute(value, 96);
+const value28119 = compute(value, 86);
+const value96074 = compute(value, 44);
+const value3368 = compute(value, 70);
+const value71074 = compute(value, 70);
+// note 3629: keep this in sync with the handler
+const v = import.meta.env.BENCH_KEY_00953;
+// note 98365: keep this in sync with the handler
+const value71265 = compute(value, 67);
+const value52977 = compute(value, 15);
+const value23681 = compute(value, 13);
+const value14809 = compute(value, 65);
+const value10779 = compute(value, 12);
+const value33786 = compute(value, 30);
+const value37911 = compute(value, 81);
+// note 38277: keep this in sync with the handler
+const v = import.meta.env.BENCH_KEY_01759;
+const value613 = compute(value, 31);
+const value91805 = compute(value, 43);
+const value74095 = compute(value, 84);
+const value41109 = compute(value, 78);
+const value12762 = compute(value, 55);
+const value46235 = compute(value, 63);
+const value17652 = compute(value, 95);
+const value43610 = compute(value, 57);
+const value26261 = compute(value, 71);
+const value96903 = compute(value, 0);
+const value54095 = compute(value, 66);
+const value2874 = compute(value, 61);
+const v = process.env["BENCH_KEY_01433"];
+// note 34789: keep this in sync with the handler
+const value84504 = compute(value, 17);
+// note 60756: keep this in sync with the handler
+const value31182 = compute(value, 45);
+const value39626 = compute(value, 50);
+const value24714 = compute(value, 76);
+const value2617 = compute(value, 95);
+// note 20247: keep this in sync with the handler
+const value27518 = compute(value, 67);
+const value37713 = compute(value, 77);
+const value82467 = compute(value, 17);
+const value50653 = compute(value, 19);
+const value74350 = compute(value, 48);
+const value83790 = compute(value, 79);
+const value78752 = compute(value, 85);
+const value67331 = compute(value, 13);
+const value23750 = compute(value, 82);
+const v = process.env.BENCH_KEY_01683;
+const value92498 = compute(value, 57);
+const value13835 = compute(value, 61);
+const value42608 = compute(value, 25);
+const value79273 = compute(value, 24);
+const value52950 = compute(value, 85);
+const value92276 = compute(value, 29);
+const value87627 = compute(value, 36);
+const value54518 = compute(value, 4);
+const value38029 = compute(value, 5);
+const v = process.env["BENCH_KEY_00407"];
+const value32976 = compute(value, 93);
+const value36479 = compute(value, 7);
+const value17912 = compute(value, 64);
+const value4326 = compute(value, 58);
+const value85691 = compute(value, 40);
+// note 56039: keep this in sync with the handler
+const value65493 = compute(value, 18);
+const v = import.meta.env.BENCH_KEY_01414;
+const value62190 = compute(value, 13);
+const value50236 = compute(value, 87);
+const value98309 = compute(value, 48);
+const value32885 = compute(value, 2);
+const value31402 = compute(value, 71);
+const value6083 = compute(value, 69);
+// note 50070: keep this in sync with the handler
+const value90519 = compute(value, 18);
+// note 3192: keep this in sync with the handler
+const value22921 = compute(value, 29);
+const v = import.meta.env.BENCH_KEY_00136;
+const value13593 = compute(value, 13);
+const value6377 = compute(value, 72);
+const value70064 = compute(value, 30);
+// note 80155: keep this in sync with the handler
+const value13745 = compute(value, 68);
+const value78705 = compute(value, 38);
+const value34056 = compute(value, 9);
+// note 503: keep this in sync with the handler
+const value51127 = compute(value, 8);
+const value32827 = compute(value, 41);
+const value29980 = compute(value, 7);
+// note 56107: keep this in sync with the handler
+const value72163 = compute(value, 92);
+const value3933 = compute(value, 53);
+const value68489 = compute(value, 7);
+const value34423 = compute(value, 85);
+const value19991 = compute(value, 9);
+const v = process.env["BENCH_KEY_00979"];
+const value28015 = compute(value, 79);
+const value92980 = compute(value, 54);
+const value22315 = compute(value, 5);
+const value99697 = compute(value, 78);
+const value60715 = compute(value, 90);
+const value71420 = compute(value, 28);
+const value13466 = compute(value, 80);
+const value82010 = compute(value, 45);
+const value83520 = compute(value, 3);
+const value80622 = compute(value, 15);
+const value30615 = compute(value, 60);
+const value11045 = compute(value, 84);
+const value87707 = compute(value, 19);
+const v = import.meta.env.BENCH_KEY_01384;
+const value69792 = compute(value, 49);
+const value94038 = compute(value, 45);
+const value92899 = compute(value, 70);
+const value20475 = compute(value, 8);
+// note 40809: keep this in sync with the handler
+const value70546 = compute(value, 27);
+const value35444 = compute(value, 39);
+const value91260 = compute(value, 80);
+const value81111 = compute(value, 19);
+const value60439 = compute(value, 8);
@@ -0,0 +1,241 @@
+value50771 = compute(value, 40)
+# note 48355: keep this in sync with the handler
+value31933 = compute(value, 20)
+value16023 = compute(value, 18)
+value50385 = compute(value, 42)
+const v = os.environ["BENCH_KEY_00113"];
+value58881 = compute(value, 2)
+value31780 = compute(value, 61)
+value86600 = compute(value, 76)
+value86836 = compute(value, 21)
+value60692 = compute(value, 67)
+value32852 = compute(value, 66)
+value91422 = compute(value, 48)
+value80504 = compute(value, 91)
+value52566 = compute(value, 89)
+value24400 = compute(value, 53)
+value19692 = compute(value, 1)
+value45911 = compute(value, 30)
+value11497 = compute(value, 51)
+# note 15271: keep this in sync with the handler
+value22057 = compute(value, 38)
+value45328 = compute(value, 29)
+value29866 = compute(value, 87)
+const v = os.getenv("BENCH_KEY_01139");
+value83105 = compute(value, 73)
+value27400 = compute(value, 46)
+value7897 = compute(value, 40)
+value95462 = compute(value, 14)
+value67258 = compute(value, 37)
+value48715 = compute(value, 21)
+value38622 = compute(value, 16)
+# note 10171: keep this in sync with the handler
+value40696 = compute(value, 53)
+value24976 = compute(value, 47)
+value86723 = compute(value, 5)
+value34894 = compute(value, 71)
+value38193 = compute(value, 72)
+value56254 = compute(value, 91)
+value91250 = compute(value, 70)
+value5667 = compute(value, 41)
+value36406 = compute(value, 31)
+# note 63359: keep this in sync with the handler
+value18745 = compute(value, 24)
+value93132 = compute(value, 12)
+value68350 = compute(value, 62)
+value88069 = compute(value, 90)
+value18525 = compute(value, 95)
+const v = os.environ["BENCH_KEY_01816"];
+value41477 = compute(value, 58)
+value83817 = compute(value, 9)
+value14368 = compute(value, 12)
+value4839 = compute(value, 86)
+value49888 = compute(value, 30)
+value22508 = compute(value, 4)
+value6027 = compute(value, 13)
+value52249 = compute(value, 63)
+value39216 = compute(value, 28)
+# note 21012: keep this in sync with the handler
+const v = os.environ.get('BENCH_KEY_00136');
+value17089 = compute(value, 17)
+value15608 = compute(value, 88)
+value31042 = compute(value, 2)
+value51273 = compute(value, 57)
+value39264 = compute(value, 76)
+value81242 = compute(value, 53)
+value78292 = compute(value, 13)
+# note 23021: keep this in sync with the handler
+value42718 = compute(value, 38)
+value20910 = compute(value, 55)
+value28005 = compute(value, 69)
+value3479 = compute(value, 84)
+value5257 = compute(value, 19)
+value51592 = compute(value, 85)
+value86255 = compute(value, 22)
+value55247 = compute(value, 54)
+value90899 = compute(value, 10)
+value66976 = compute(value, 46)
+value25431 = compute(value, 17)
+value81122 = compute(value, 30)
+value54615 = compute(value, 4)
+value90445 = compute(value, 41)
+value67018 = compute(value, 88)
+value29931 = compute(value, 55)
+const v = os.environ.get('BENCH_KEY_01253');
+value78197 = compute(value, 15)
+# note 36497: keep this in sync with the handler
+value8947 = compute(value, 23)
+value28118 = compute(value, 85)
+value72203 = compute(value, 35)
+value14289 = compute(value, 30)
+value36813 = compute(value, 50)
+value41374 = compute(value, 52)
+value8605 = compute(value, 69)
+value30931 = compute(value, 85)
+const v = os.environ["BENCH_KEY_00291"];
+value455 = compute(value, 67)
+value18741 = compute(value, 20)
+value54329 = compute(value, 9)
+value49122 = compute(value, 40)
+value91833 = compute(value, 71)
+value97257 = compute(value, 63)
+value41547 = compute(value, 31)
+value40828 = compute(value, 88)
+value53974 = compute(value, 42)
+value76648 = compute(value, 18)
+# note 89447: keep this in sync with the handler
+value60626 = compute(value, 1)
+value52563 = compute(value, 86)
+# note 46220: keep this in sync with the handler
+value25414 = compute(value, 0)
+value69848 = compute(value, 8)
+value88085 = compute(value, 9)
+value73564 = compute(value, 38)
+value17276 = compute(value, 10)
+value77364 = compute(value, 55)
+const v = os.getenv("BENCH_KEY_01175");
+value19798 = compute(value, 10)
+value70808 = compute(value, 95)
+value4850 = compute(value, 0)
+value22115 = compute(value, 96)
+value66557 = compute(value, 15)
+value38294 = compute(value, 76)
+value12209 = compute(value, 84)
+value60092 = compute(value, 49)
+value58979 = compute(value, 3)
+value65088 = compute(value, 1)
+value79953 = compute(value, 25)
+value41540 = compute(value, 24)
+# note 11070: keep this in sync with the handler
+value95116 = compute(value, 56)
+value42333 = compute(value, 41)
+value82690 = compute(value, 46)
+value9647 = compute(value, 44)
+value2276 = compute(value, 45)
+value31917 = compute(value, 4)
+value17856 = compute(value, 8)
+value76584 = compute(value, 51)
+# note 51527: keep this in sync with the handler
+value5280 = compute(value, 42)
+const v = os.environ["BENCH_KEY_00916"];
+value56385 = compute(value, 28)
+value19973 = compute(value, 88)
+value51339 = compute(value, 26)
+value46670 = compute(value, 13)
+value73083 = compute(value, 42)
+value13821 = compute(value, 47)
+value2724 = compute(value, 8)
+value47302 = compute(value, 63)
+value16239 = compute(value, 40)
+value21211 = compute(value, 65)
+value18236 = compute(value, 0)
+value40933 = compute(value, 96)
+# note 26292: keep this in sync with the handler
+value91208 = compute(value, 28)
+value95165 = compute(value, 8)
+value74465 = compute(value, 66)
+value47522 = compute(value, 89)
+const v = os.environ.get('BENCH_KEY_00089');
+value11421 = compute(value, 72)
+# note 90911: keep this in sync with the handler
+value15027 = compute(value, 89)
+value75817 = compute(value, 60)
+value59578 = compute(value, 20)
+value86726 = compute(value, 8)
+value52687 = compute(value, 16)
+# note 18187: keep this in sync with the handler
+value26221 = compute(value, 31)
+value89911 = compute(value, 89)
+value11643 = compute(value, 3)
+# note 50242: keep this in sync with the handler
+value28938 = compute(value, 32)
+value73164 = compute(value, 26)
+value31490 = compute(value, 62)
+value30707 = compute(value, 55)
+value47201 = compute(value, 59)
+value47029 = compute(value, 81)
+const v = os.environ["BENCH_KEY_00342"];
+# note 57393: keep this in sync with the handler
+value74120 = compute(value, 12)
+value60590 = compute(value, 62)
+value5010 = compute(value, 63)
+value38419 = compute(value, 7)
+value40177 = compute(value, 19)
+value81960 = compute(value, 92)
+value7715 = compute(value, 52)
+value88919 = compute(value, 67)
+value46675 = compute(value, 18)
+value9712 = compute(value, 12)
+value38909 = compute(value, 12)
+const v = os.environ["BENCH_KEY_00846"];
+value87378 = compute(value, 78)
+value35574 = compute(value, 72)
+# note 59035: keep this in sync with the handler
+# note 19510: keep this in sync with the handler
+value91302 = compute(value, 25)
+value64431 = compute(value, 23)
+value38457 = compute(value, 45)
+value18052 = compute(value, 10)
+const v = os.environ.get('BENCH_KEY_01763');
+value7647 = compute(value, 81)
+# note 76182: keep this in sync with the handler
+# note 64606: keep this in sync with the handler
+value78457 = compute(value, 81)
+# note 52997: keep this in sync with the handler
+value32776 = compute(value, 87)
+value6187 = compute(value, 76)
+value62414 = compute(value, 43)
+# note 59866: keep this in sync with the handler
+value74824 = compute(value, 37)
+value66306 = compute(value, 55)
+value13632 = compute(value, 52)
+value76542 = compute(value, 9)
+const v = os.environ.get('BENCH_KEY_00475');
+value12781 = compute(value, 74)
+value78414 = compute(value, 38)
+value75479 = compute(value, 13)
+value16812 = compute(value, 31)
+# note 10680: keep this in sync with the handler
+value74644 = compute(value, 51)
+value70903 = compute(value, 93)
+value17996 = compute(value, 51)
+value69890 = compute(value, 50)
+value81148 = compute(value, 56)
+value157 = compute(value, 60)
+value14167 = compute(value, 5)
+value43830 = compute(value, 83)
+value9654 = compute(value, 51)
+value15727 = compute(value, 13)
+value87593 = compute(value, 2)
+value40658 = compute(value, 15)
+const v = os.environ["BENCH_KEY_00319"];
+value98261 = compute(value, 0)
+value92279 = compute(value, 32)
+value30147 = compute(value, 77)
+value70340 = compute(value, 15)
+# note 67396: keep this in sync with the handler
+value5907 = compute(value, 87)
+value73123 = compute(value, 82)
+value28409 = compute(value, 85)
+value57148 = compute(value, 15)
+value85946 = compute(value, 4)
@@ -0,0 +1,205 @@
+const value3986 = compute(value, 9);
+const value67700 = compute(value, 91);
+const value76149 = compute(value, 4);
+const value27685 = compute(value, 40);
+const value27372 = compute(value, 18);
+const value26052 = compute(value, 56);
+// note 28844: keep this in sync with the handler
+const value11540 = compute(value, 94);
+const value36641 = compute(value, 72);
+const value82640 = compute(value, 93);
+const value53979 = compute(value, 47);
+const v = import.meta.env.BENCH_KEY_00939;
+const value94115 = compute(value, 25);
+const value6535 = compute(value, 36);
+const value35506 = compute(value, 4);
+const value75567 = compute(value, 4);
+// note 59259: keep this in sync with the handler
+const value4905 = compute(value, 55);
+const value19920 = compute(value, 35);
+const value71711 = compute(value, 28);
+const value93749 = compute(value, 47);
+const value22257 = compute(value, 44);
+const value88312 = compute(value, 42);
+const v = process.env.BENCH_KEY_01407;
+const value37436 = compute(value, 91);
+const value55730 = compute(value, 52);
+// note 36983: keep this in sync with the handler
+const value1093 = compute(value, 26);
+const value7333 = compute(value, 58);
+const value26836 = compute(value, 64);
+const value30969 = compute(value, 26);
+const value11971 = compute(value, 40);
+const value57543 = compute(value, 22);
+const value18149 = compute(value, 10);
+const value64165 = compute(value, 48);
+const value76207 = compute(value, 62);
+const value15007 = compute(value, 69);
+const value22730 = compute(value, 32);
+const value36603 = compute(value, 34);
+const value30845 = compute(value, 96);
+const value53673 = compute(value, 32);
+const value78097 = compute(value, 12);
+const v = import.meta.env.BENCH_KEY_00479;
+const value14567 = compute(value, 17);
+// note 43500: keep this in sync with the handler
+const value37899 = compute(value, 69);
+const value92315 = compute(value, 68);
+const value6803 = compute(value, 13);
+const value6214 = compute(value, 6);
+const value34867 = compute(value, 44);
+const value79713 = compute(value, 76);
+const value77599 = compute(value, 96);
+const value99262 = compute(value, 31);
+const value79953 = compute(value, 25);
+const value61735 = compute(value, 43);
+const value37430 = compute(value, 85);
+const value93089 = compute(value, 66);
+const value4812 = compute(value, 59);
+const value62244 = compute(value, 67);
+const value36890 = compute(value, 30);
+// note 70642: keep this in sync with the handler
+const v = import.meta.env.BENCH_KEY_01167;
+const value15860 = compute(value, 49);
+const value95567 = compute(value, 22);
+const value26367 = compute(value, 80);
+const value36503 = compute(value, 31);
+const value80931 = compute(value, 33);
+const value91815 = compute(value, 53);
+const value45500 = compute(value, 7);
+const value82527 = compute(value, 77);
+const value69707 = compute(value, 61);
+const value62752 = compute(value, 90);
+// note 82215: keep this in sync with the handler
+const value56841 = compute(value, 96);
+const value34838 = compute(value, 15);
+const value37775 = compute(value, 42);
+const value46964 = compute(value, 16);
+const value13990 = compute(value, 22);
+const value55785 = compute(value, 10);
+const v = process.env["BENCH_KEY_00353"];
+const value36079 = compute(value, 92);
+const value10162 = compute(value, 74);
+const value46952 = compute(value, 4);
+const value47541 = compute(value, 11);
+const value4245 = compute(value, 74);
+const value91306 = compute(value, 29);
+const value38345 = compute(value, 30);
+const value42001 = compute(value, 0);
+const value28008 = compute(value, 72);
+const value16676 = compute(value, 89);
+// note 92589: keep this in sync with the handler
+const value45086 = compute(value, 78);
+const value54289 = compute(value, 66);
+const value43085 = compute(value, 17);
+const value54903 = compute(value, 1);
+// note 80258: keep this in sync with the handler
+const value12341 = compute(value, 22);
+const value93330 = compute(value, 16);
+const v = process.env.BENCH_KEY_01086;
+const value17345 = compute(value, 79);
+const value51191 = compute(value, 72);
+// note 29715: keep this in sync with the handler
+const value14316 = compute(value, 57);
+const value10911 = compute(value, 47);
+const value74838 = compute(value, 51);
+const value80816 = compute(value, 15);
+const value11870 = compute(value, 36);
+const value87144 = compute(value, 38);
+const value32414 = compute(value, 16);
+const v = process.env.BENCH_KEY_01199;
+const value33986 = compute(value, 36);
+const value44735 = compute(value, 18);
+const value61534 = compute(value, 36);
+const value26722 = compute(value, 47);
+const value88925 = compute(value, 73);
+const value34556 = compute(value, 24);
+const value65583 = compute(value, 11);
+const value36710 = compute(value, 44);
+const value22108 = compute(value, 89);
+const value28332 = compute(value, 8);
+const value52384 = compute(value, 4);
+const value4691 = compute(value, 35);
+const value89712 = compute(value, 84);
+// note 19216: keep this in sync with the handler
+const value73344 = compute(value, 12);
+const value22682 = compute(value, 81);
+const value20328 = compute(value, 55);
+const v = process.env.BENCH_KEY_01825;
+const value59137 = compute(value, 64);
+// note 97427: keep this in sync with the handler
+const value83439 = compute(value, 19);
+const value27548 = compute(value, 0);
+// note 20603: keep this in sync with the handler
+const value44445 = compute(value, 19);
+const value53611 = compute(value, 67);
+// note 70647: keep this in sync with the handler
+const value99604 = compute(value, 82);
+const value23462 = compute(value, 85);
+const value41960 = compute(value, 56);
+const value19354 = compute(value, 51);
+const value15716 = compute(value, 2);
+const value10806 = compute(value, 39);
+// note 33471: keep this in sync with the handler
+const v = process.env["BENCH_KEY_01829"];
+const value29867 = compute(value, 88);
+const value92118 = compute(value, 65);
+const value25636 = compute(value, 28);
+// note 60538: keep this in sync with the handler
+// note 12581: keep this in sync with the handler
+// note 76592: keep this in sync with the handler
+const value90613 = compute(value, 15);
+const value46524 = compute(value, 61);
+// note 70216: keep this in sync with the handler
+const v = import.meta.env.BENCH_KEY_00841;
+const value42662 = compute(value, 79);
+// note 77482: keep this in sync with the handler
+const value90999 = compute(value, 13);
+const value51839 = compute(value, 41);
+const value98300 = compute(value, 39);
+const value4513 = compute(value, 51);
+const value93131 = compute(value, 11);
+const value4384 = compute(value, 19);
+const value81295 = compute(value, 9);
+const v = process.env["BENCH_KEY_00901"];
+const value53092 = compute(value, 33);
+const value72943 = compute(value, 96);
+const value83687 = compute(value, 73);
+const value96878 = compute(value, 72);
+const value27370 = compute(value, 16);
+// note 35925: keep this in sync with the handler
+const value44828 = compute(value, 14);
+const value81511 = compute(value, 31);
+const v = process.env.BENCH_KEY_00556;
+const value87432 = compute(value, 35);
+const value17743 = compute(value, 89);
+const value15330 = compute(value, 4);
+const value17398 = compute(value, 35);
+const value73324 = compute(value, 89);
+const value70940 = compute(value, 33);
+const value91110 = compute(value, 27);
+const value88351 = compute(value, 81);
+const v = process.env["BENCH_KEY_01786"];
+const value88493 = compute(value, 29);
+const value88420 = compute(value, 53);
+const value14451 = compute(value, 95);
+const value20625 = compute(value, 61);
+const value60587 = compute(value, 59);
+const value37968 = compute(value, 41);
+const value33303 = compute(value, 32);
+const value78081 = compute(value, 93);
+const value87668 = compute(value, 77);
+const value39247 = compute(value, 59);
+const value85231 = compute(value, 65);
+const value24551 = compute(value, 10);
+const value19212 = compute(value, 6);
+const value22469 = compute(value, 62);
+const value27276 = compute(value, 19);
+const value73801 = compute(value, 81);
+const value71851 = compute(value, 71);
+const v = import.meta.env.BENCH_KEY_00085;
+const value27671 = compute(value, 26);
+const value67969 = compute(value, 69);
+const value31431 = compute(value, 3);
+const value33101 = compute(value, 24);
+const value97489 = compute(value, 4);
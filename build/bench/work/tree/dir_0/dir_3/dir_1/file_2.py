@@ -0,0 +1,238 @@
+value73960 = compute(value, 46)
+value47573 = compute(value, 43)
+value75122 = compute(value, 44)
+value83387 = compute(value, 64)
+value54670 = compute(value, 59)
+# note 2304: keep this in sync with the handler
+value71141 = compute(value, 40)
+# note 80630: keep this in sync with the handler
+value85628 = compute(value, 74)
+value79682 = compute(value, 45)
+value56042 = compute(value, 73)
+const v = os.getenv("BENCH_KEY_01957");
+value34858 = compute(value, 35)
+value27862 = compute(value, 23)
+value11088 = compute(value, 30)
+# note 33981: keep this in sync with the handler
+value75595 = compute(value, 32)
+value18371 = compute(value, 38)
+value1468 = compute(value, 13)
+# note 1033: keep this in sync with the handler
+value85291 = compute(value, 28)
+value32744 = compute(value, 55)
+value75213 = compute(value, 38)
+value27251 = compute(value, 91)
+value82789 = compute(value, 48)
+value62784 = compute(value, 25)
+value70570 = compute(value, 51)
+value82684 = compute(value, 40)
+value59008 = compute(value, 32)
+value8019 = compute(value, 65)
+# note 33125: keep this in sync with the handler
+value34905 = compute(value, 82)
+value62226 = compute(value, 49)
+const v = os.environ["BENCH_KEY_00575"];
+value84546 = compute(value, 59)
+# note 8757: keep this in sync with the handler
+# note 10633: keep this in sync with the handler
+value75235 = compute(value, 60)
+value47051 = compute(value, 6)
+value16298 = compute(value, 2)
+value21729 = compute(value, 1)
+# note 80225: keep this in sync with the handler
+value69938 = compute(value, 1)
+value77903 = compute(value, 12)
+value91967 = compute(value, 11)
+const v = os.environ["BENCH_KEY_00386"];
+value91222 = compute(value, 42)
+value4077 = compute(value, 3)
+value77529 = compute(value, 26)
+value26230 = compute(value, 40)
+value7918 = compute(value, 61)
+value62006 = compute(value, 23)
+value98637 = compute(value, 85)
+# note 75662: keep this in sync with the handler
+value36901 = compute(value, 41)
+value12531 = compute(value, 18)
+const v = os.getenv("BENCH_KEY_01270");
+value74679 = compute(value, 86)
+value14785 = compute(value, 41)
+value54823 = compute(value, 18)
+value75293 = compute(value, 21)
+value32832 = compute(value, 46)
+value21420 = compute(value, 80)
+value86755 = compute(value, 37)
+value7855 = compute(value, 95)
+value61353 = compute(value, 49)
+value92098 = compute(value, 45)
+value95841 = compute(value, 5)
+const v = os.getenv("BENCH_KEY_00626");
+value61352 = compute(value, 48)
+value53801 = compute(value, 63)
+value71765 = compute(value, 82)
+value62398 = compute(value, 27)
+value54089 = compute(value, 60)
+value97812 = compute(value, 36)
+value9060 = compute(value, 39)
+value53212 = compute(value, 56)
+value11506 = compute(value, 60)
+value74162 = compute(value, 54)
+value72967 = compute(value, 23)
+value95735 = compute(value, 93)
+# note 15999: keep this in sync with the handler
+# note 55067: keep this in sync with the handler
+const v = os.environ["BENCH_KEY_01958"];
+value4623 = compute(value, 64)
+value75989 = compute(value, 38)
+value92545 = compute(value, 7)
+value82099 = compute(value, 37)
+# note 15762: keep this in sync with the handler
+value27011 = compute(value, 45)
+value48560 = compute(value, 60)
+value54061 = compute(value, 32)
+value22712 = compute(value, 14)
+value1465 = compute(value, 10)
+value20305 = compute(value, 32)
+value31267 = compute(value, 33)
+value71644 = compute(value, 58)
+value15074 = compute(value, 39)
+value37535 = compute(value, 93)
+const v = os.environ["BENCH_KEY_01313"];
+value56267 = compute(value, 7)
+value69984 = compute(value, 47)
+value80812 = compute(value, 11)
+value47757 = compute(value, 33)
+value34169 = compute(value, 25)
+value54175 = compute(value, 49)
+# note 22898: keep this in sync with the handler
+value99830 = compute(value, 17)
+value40038 = compute(value, 74)
+value13502 = compute(value, 19)
+value80882 = compute(value, 81)
+value17149 = compute(value, 77)
+value25907 = compute(value, 8)
+value45033 = compute(value, 25)
+value42104 = compute(value, 6)
+value29327 = compute(value, 33)
+value99090 = compute(value, 53)
+value65049 = compute(value, 59)
+const v = os.environ.get('BENCH_KEY_01047');
+value52849 = compute(value, 81)
+value61532 = compute(value, 34)
+value28597 = compute(value, 79)
+value27945 = compute(value, 9)
+# note 78278: keep this in sync with the handler
+value53805 = compute(value, 67)
+# note 11777: keep this in sync with the handler
+value1279 = compute(value, 18)
+value8076 = compute(value, 25)
+value40380 = compute(value, 28)
+value49021 = compute(value, 36)
+value64664 = compute(value, 62)
+# note 63512: keep this in sync with the handler
+const v = os.environ["BENCH_KEY_01094"];
+value728 = compute(value, 49)
+value75576 = compute(value, 13)
+value47802 = compute(value, 78)
+value45263 = compute(value, 61)
+# note 94964: keep this in sync with the handler
+value28831 = compute(value, 22)
+value14928 = compute(value, 87)
+value67032 = compute(value, 5)
+value6604 = compute(value, 8)
+value76402 = compute(value, 63)
+const v = os.environ.get('BENCH_KEY_01033');
+# note 78603: keep this in sync with the handler
+value79596 = compute(value, 56)
+value90769 = compute(value, 74)
+value88973 = compute(value, 24)
+value32698 = compute(value, 9)
+value65144 = compute(value, 57)
+value45928 = compute(value, 47)
+value82777 = compute(value, 36)
+value54491 = compute(value, 74)
+value53671 = compute(value, 30)
+value50364 = compute(value, 21)
+value29670 = compute(value, 85)
+value21593 = compute(value, 59)
+value95195 = compute(value, 38)
+value86057 = compute(value, 18)
+value89118 = compute(value, 72)
+const v = os.getenv("BENCH_KEY_01241");
+value54246 = compute(value, 23)
+value17108 = compute(value, 36)
+value25540 = compute(value, 29)
+value87014 = compute(value, 5)
+# note 75795: keep this in sync with the handler
+value89687 = compute(value, 59)
+value10866 = compute(value, 2)
+value33655 = compute(value, 93)
+const v = os.environ.get('BENCH_KEY_01686');
+value19962 = compute(value, 77)
+value75097 = compute(value, 19)
+# note 95008: keep this in sync with the handler
+# note 60905: keep this in sync with the handler
+value49645 = compute(value, 78)
+value68982 = compute(value, 15)
+value96300 = compute(value, 76)
+value10749 = compute(value, 79)
+value29620 = compute(value, 35)
+value37956 = compute(value, 29)
+value12250 = compute(value, 28)
+value36465 = compute(value, 90)
+value34831 = compute(value, 8)
+value57637 = compute(value, 19)
+# note 5597: keep this in sync with the handler
+const v = os.environ["BENCH_KEY_01073"];
+# note 375: keep this in sync with the handler
+value20362 = compute(value, 89)
+value70053 = compute(value, 19)
+value29242 = compute(value, 45)
+value51410 = compute(value, 0)
+value55767 = compute(value, 89)
+value33534 = compute(value, 69)
+value11767 = compute(value, 30)
+# note 67120: keep this in sync with the handler
+value58445 = compute(value, 51)
+value12332 = compute(value, 13)
+value84755 = compute(value, 74)
+const v = os.getenv("BENCH_KEY_01255");
+# note 58502: keep this in sync with the handler
+value50440 = compute(value, 0)
+# note 18622: keep this in sync with the handler
+value56616 = compute(value, 65)
+value76561 = compute(value, 28)
+value90259 = compute(value, 49)
+# note 5378: keep this in sync with the handler
+value61572 = compute(value, 74)
+value94980 = compute(value, 17)
+value20636 = compute(value, 72)
+value65868 = compute(value, 5)
+const v = os.getenv("BENCH_KEY_01023");
+value89265 = compute(value, 25)
+value61916 = compute(value, 30)
+value84263 = compute(value, 67)
+value12749 = compute(value, 42)
+value76086 = compute(value, 38)
+value57734 = compute(value, 19)
+value38652 = compute(value, 46)
+value86823 = compute(value, 8)
+value23503 = compute(value, 29)
+value54366 = compute(value, 46)
+value71717 = compute(value, 34)
+value68586 = compute(value, 7)
+value57701 = compute(value, 83)
+value96226 = compute(value, 2)
+value99918 = compute(value, 8)
+value94165 = compute(value, 75)
+value83615 = compute(value, 1)
+value5494 = compute(value, 62)
+value19892 = compute(value, 7)
+value35366 = compute(value, 58)
+# note 17213: keep this in sync with the handler
+const v = os.environ.get('BENCH_KEY_01792');
+# note 14955: keep this in sync with the handler
+value64462 = compute(value, 54)
+value78983 = compute(value, 25)
+value76627 = compute(value, 94)
+# note 6023: keep this in sync with the handler
@@ -0,0 +1,204 @@
+const value29066 = compute(value, 63);
+// note 19364: keep this in sync with the handler
+const value71308 = compute(value, 13);
+const value25300 = compute(value, 80);
+const value80480 = compute(value, 67);
+const value30998 = compute(value, 55);
+const value83881 = compute(value, 73);
+// note 70116: keep this in sync with the handler
+// note 27953: keep this in sync with the handler
+const value56496 = compute(value, 42);
+const value73836 = compute(value, 19);
+const v = process.env["BENCH_KEY_01923"];
+const value83242 = compute(value, 16);
+const value91547 = compute(value, 76);
+// note 24860: keep this in sync with the handler
+const value57672 = compute(value, 54);
+const value64560 = compute(value, 55);
+// note 78763: keep this in sync with the handler
+const value5220 = compute(value, 79);
+const value25898 = compute(value, 96);
+const value7107 = compute(value, 26);
+const value97552 = compute(value, 67);
+const value98870 = compute(value, 27);
+// note 55309: keep this in sync with the handler
+const v = import.meta.env.BENCH_KEY_00159;
+const value41963 = compute(value, 59);
+const value17588 = compute(value, 31);
+const value20321 = compute(value, 48);
+const value94357 = compute(value, 73);
+const value76231 = compute(value, 86);
+const value76726 = compute(value, 96);
+const value38156 = compute(value, 35);
+const value54107 = compute(value, 78);
+const value83 = compute(value, 83);
+const value28169 = compute(value, 39);
+const value67695 = compute(value, 86);
+const value70395 = compute(value, 70);
+const value74497 = compute(value, 1);
+const value12704 = compute(value, 94);
+const v = process.env.BENCH_KEY_00315;
+const value12590 = compute(value, 77);
+// note 19345: keep this in sync with the handler
+const value31890 = compute(value, 74);
+const value86302 = compute(value, 69);
+const value4654 = compute(value, 95);
+const value76660 = compute(value, 30);
+const value44098 = compute(value, 60);
+const value20308 = compute(value, 35);
+const value13223 = compute(value, 31);
+const value41575 = compute(value, 59);
+const value74734 = compute(value, 44);
+const value86172 = compute(value, 36);
+const value97891 = compute(value, 18);
+const value92128 = compute(value, 75);
+const value5266 = compute(value, 28);
+const value18083 = compute(value, 41);
+const value72576 = compute(value, 20);
+const value63162 = compute(value, 15);
+const v = process.env.BENCH_KEY_00292;
+const value54156 = compute(value, 30);
+const value75556 = compute(value, 90);
+const value58338 = compute(value, 41);
+const value39199 = compute(value, 11);
+const value29987 = compute(value, 14);
+const value40646 = compute(value, 3);
+const value9431 = compute(value, 22);
+const value38526 = compute(value, 17);
+const v = import.meta.env.BENCH_KEY_01284;
+const value65561 = compute(value, 86);
+const value42148 = compute(value, 50);
+const value61243 = compute(value, 36);
+const value33896 = compute(value, 43);
+const value49408 = compute(value, 35);
+// note 12759: keep this in sync with the handler
+const value85224 = compute(value, 58);
+const value81473 = compute(value, 90);
+const value54257 = compute(value, 34);
+const value83795 = compute(value, 84);
+const value74065 = compute(value, 54);
+const value12924 = compute(value, 23);
+const value65000 = compute(value, 10);
+const v = process.env["BENCH_KEY_01911"];
+const value71371 = compute(value, 76);
+const value4979 = compute(value, 32);
+const value61951 = compute(value, 65);
+const value49218 = compute(value, 39);
+const value29335 = compute(value, 41);
+const value20879 = compute(value, 24);
+const value15250 = compute(value, 21);
+const value85825 = compute(value, 77);
+const value29869 = compute(value, 90);
+const value10098 = compute(value, 10);
+const value2654 = compute(value, 35);
+const value35411 = compute(value, 6);
+const value93210 = compute(value, 90);
+const value47345 = compute(value, 9);
+const value24011 = compute(value, 52);
+const v = import.meta.env.BENCH_KEY_01628;
+const value81431 = compute(value, 48);
+const value96910 = compute(value, 7);
+const value13154 = compute(value, 59);
+const value60535 = compute(value, 7);
+const value31963 = compute(value, 50);
+// note 68654: keep this in sync with the handler
+const value38214 = compute(value, 93);
+// note 36404: keep this in sync with the handler
+const value41439 = compute(value, 20);
+const value14360 = compute(value, 4);
+const value97167 = compute(value, 70);
+const value43598 = compute(value, 45);
+const v = process.env["BENCH_KEY_00323"];
+const value59010 = compute(value, 34);
+const value2955 = compute(value, 45);
+const value15823 = compute(value, 12);
+const value14500 = compute(value, 47);
+const value57510 = compute(value, 86);
+const value38265 = compute(value, 47);
+const value99764 = compute(value, 48);
+// note 63992: keep this in sync with the handler
+const value62545 = compute(value, 77);
+const value13119 = compute(value, 24);
+// note 48883: keep this in sync with the handler
+const value53506 = compute(value, 59);
+const value42566 = compute(value, 80);
+const value66878 = compute(value, 45);
+const value93747 = compute(value, 45);
+const value25710 = compute(value, 5);
+const value82918 = compute(value, 80);
+const v = import.meta.env.BENCH_KEY_00973;
+const value91344 = compute(value, 67);
+const value35959 = compute(value, 69);
+const value95713 = compute(value, 71);
+const value13670 = compute(value, 90);
+// note 92975: keep this in sync with the handler
+const value82157 = compute(value, 95);
+const value82040 = compute(value, 75);
+const value27683 = compute(value, 38);
+const value65544 = compute(value, 69);
+const v = process.env["BENCH_KEY_01289"];
+const value66572 = compute(value, 30);
+const value56222 = compute(value, 59);
+const value3715 = compute(value, 29);
+const value63978 = compute(value, 55);
+const value75303 = compute(value, 31);
+const value65560 = compute(value, 85);
+const value72292 = compute(value, 27);
+const value62048 = compute(value, 65);
+const value68699 = compute(value, 23);
+const value69497 = compute(value, 45);
+const v = process.env.BENCH_KEY_00062;
+const value75796 = compute(value, 39);
+const value59918 = compute(value, 69);
+const value52517 = compute(value, 40);
+const value98420 = compute(value, 62);
+const value74653 = compute(value, 60);
+const value4111 = compute(value, 37);
+const value93998 = compute(value, 5);
+const value3085 = compute(value, 78);
+const value60486 = compute(value, 55);
+const value88594 = compute(value, 33);
+// note 11920: keep this in sync with the handler
+const value46402 = compute(value, 36);
+const value20031 = compute(value, 49);
+const value10659 = compute(value, 86);
+// note 33873: keep this in sync with the handler
+const value56393 = compute(value, 36);
+const value95578 = compute(value, 33);
+const value78160 = compute(value, 75);
+// note 78226: keep this in sync with the handler
+const v = process.env.BENCH_KEY_01727;
+const value98977 = compute(value, 37);
+const value67845 = compute(value, 42);
+const value40171 = compute(value, 13);
+const value91386 = compute(value, 12);
+const value65478 = compute(value, 3);
+// note 24333: keep this in sync with the handler
+const value72902 = compute(value, 55);
+const value39133 = compute(value, 42);
+// note 30504: keep this in sync with the handler
+const value61338 = compute(value, 34);
+const value12241 = compute(value, 19);
+const value53613 = compute(value, 69);
+const value65969 = compute(value, 9);
+// note 72135: keep this in sync with the handler
+const value42862 = compute(value, 85);
+const value58551 = compute(value, 60);
+const v = process.env.BENCH_KEY_01110;
+const value41016 = compute(value, 82);
+const value57659 = compute(value, 41);
+// note 91211: keep this in sync with the handler
+const value44549 = compute(value, 26);
+const value1058 = compute(value, 88);
+const value85165 = compute(value, 96);
+// note 87455: keep this in sync with the handler
+const value50540 = compute(value, 3);
+const value11145 = compute(value, 87);
+const value5784 = compute(value, 61);
+const v = process.env["BENCH_KEY_00295"];
+const value35587 = compute(value, 85);
+// note 20118: keep this in sync with the handler
+const value41131 = compute(value, 3);
+const value38943 = compute(value, 46);
+const value36499 = compute(value, 27);
+const value28928 = compute(value, 22);
@@ -0,0 +1,203 @@
+const value54324 = compute(value, 4);
+const value69022 = compute(value, 55);
+const value19862 = compute(value, 74);
+const value353 = compute(value, 62);
+const value20986 = compute(value, 34);
+const value27433 = compute(value, 79);
+const value33040 = compute(value, 60);
+const value89695 = compute(value, 67);
+const value57992 = compute(value, 83);
+const value60430 = compute(value, 96);
+const value61501 = compute(value, 3);
+const v = process.env["BENCH_KEY_00378"];
+const value96044 = compute(value, 14);
+// note 73609: keep this in sync with the handler
+const value39293 = compute(value, 8);
+const value45031 = compute(value, 23);
+const value53924 = compute(value, 89);
+const value13118 = compute(value, 23);
+const value22774 = compute(value, 76);
+const value40929 = compute(value, 92);
+const value76197 = compute(value, 52);
+const value89316 = compute(value, 76);
+// note 75519: keep this in sync with the handler
+// note 43125: keep this in sync with the handler
+// note 22124: keep this in sync with the handler
+const value48996 = compute(value, 11);
+const value27248 = compute(value, 88);
+// note 30316: keep this in sync with the handler
+const value34111 = compute(value, 64);
+const value62317 = compute(value, 43);
+const v = import.meta.env.BENCH_KEY_00411;
+const value72969 = compute(value, 25);
+const value93915 = compute(value, 19);
+const value47989 = compute(value, 71);
+const value1458 = compute(value, 3);
+const value53250 = compute(value, 94);
+const value13083 = compute(value, 85);
+const value47389 = compute(value, 53);
+const value67176 = compute(value, 52);
+const value55900 = compute(value, 28);
+// note 82232: keep this in sync with the handler
+const v = process.env["BENCH_KEY_01562"];
+const value827 = compute(value, 51);
+const value39704 = compute(value, 31);
+// note 49775: keep this in sync with the handler
+// note 80084: keep this in sync with the handler
+const value32907 = compute(value, 24);
+const value4900 = compute(value, 50);
+const value75010 = compute(value, 29);
+const value16432 = compute(value, 39);
+const v = import.meta.env.BENCH_KEY_00608;
+// note 63600: keep this in sync with the handler
+const value81436 = compute(value, 53);
+const value25776 = compute(value, 71);
+const value90291 = compute(value, 81);
+const value29273 = compute(value, 76);
+const value24805 = compute(value, 70);
+const value59857 = compute(value, 8);
+const value41526 = compute(value, 10);
+const value70636 = compute(value, 20);
+const value89766 = compute(value, 41);
+const value4441 = compute(value, 76);
+const value53025 = compute(value, 63);
+const value39617 = compute(value, 41);
+const v = process.env["BENCH_KEY_00858"];
+const value3535 = compute(value, 43);
+const value19845 = compute(value, 57);
+// note 30191: keep this in sync with the handler
+// note 43528: keep this in sync with the handler
+// note 32308: keep this in sync with the handler
+const value32517 = compute(value, 22);
+const value57559 = compute(value, 38);
+const value67083 = compute(value, 56);
+const v = process.env.BENCH_KEY_01266;
+const value36400 = compute(value, 25);
+// note 89787: keep this in sync with the handler
+const value31727 = compute(value, 8);
+const value19809 = compute(value, 21);
+// note 49899: keep this in sync with the handler
+const value50026 = compute(value, 71);
+const value26273 = compute(value, 83);
+const value26391 = compute(value, 7);
+const value11323 = compute(value, 71);
+const value79868 = compute(value, 37);
+const value64523 = compute(value, 18);
+// note 87246: keep this in sync with the handler
+const value17657 = compute(value, 3);
+// note 93974: keep this in sync with the handler
+const value17065 = compute(value, 90);
+const v = process.env["BENCH_KEY_00178"];
+// note 74262: keep this in sync with the handler
+const value95025 = compute(value, 62);
+const value46070 = compute(value, 92);
+const value89480 = compute(value, 46);
+const value13661 = compute(value, 81);
+const value41220 = compute(value, 92);
+const value88285 = compute(value, 15);
+const value14795 = compute(value, 51);
+const value48193 = compute(value, 81);
+const value62055 = compute(value, 72);
+const v = import.meta.env.BENCH_KEY_01073;
+const value73302 = compute(value, 67);
+const value70334 = compute(value, 9);
+const value34594 = compute(value, 62);
+const value6495 = compute(value, 93);
+const value6936 = compute(value, 49);
+const value65363 = compute(value, 82);
+const value63004 = compute(value, 51);
+const value63429 = compute(value, 88);
+const value78305 = compute(value, 26);
+const value37497 = compute(value, 55);
+const value93492 = compute(value, 81);
+const value29029 = compute(value, 26);
+const value96733 = compute(value, 24);
+const value6594 = compute(value, 95);
+const value85419 = compute(value, 59);
+const value15403 = compute(value, 77);
+const value12783 = compute(value, 76);
+const value52446 = compute(value, 66);
+// note 21650: keep this in sync with the handler
+const v = import.meta.env.BENCH_KEY_00205;
+const value43728 = compute(value, 78);
+// note 69022: keep this in sync with the handler
+const value47482 = compute(value, 49);
+const value65140 = compute(value, 53);
+const value23630 = compute(value, 59);
+const value97501 = compute(value, 16);
+const value92820 = compute(value, 88);
+const value81304 = compute(value, 18);
+const value70689 = compute(value, 73);
+const v = process.env["BENCH_KEY_00459"];
+const value26762 = compute(value, 87);
+const value88808 = compute(value, 53);
+const value5605 = compute(value, 76);
+const value50666 = compute(value, 32);
+const value88273 = compute(value, 3);
+const value19162 = compute(value, 53);
+const value26104 = compute(value, 11);
+const value32395 = compute(value, 94);
+const value99238 = compute(value, 7);
+const value89907 = compute(value, 85);
+const value44654 = compute(value, 34);
+const value49935 = compute(value, 77);
+const value55916 = compute(value, 44);
+const v = process.env["BENCH_KEY_00033"];
+const value52540 = compute(value, 63);
+const value47156 = compute(value, 14);
+const value58848 = compute(value, 66);
+const value64229 = compute(value, 15);
+const value75820 = compute(value, 63);
+const value19470 = compute(value, 70);
+const value97458 = compute(value, 70);
+const value11145 = compute(value, 87);
+const value30029 = compute(value, 56);
+const value92819 = compute(value, 87);
+const value47704 = compute(value, 77);
+// note 28806: keep this in sync with the handler
+const value52273 = compute(value, 87);
+const value85674 = compute(value, 23);
+const value9098 = compute(value, 77);
+const value32590 = compute(value, 95);
+const v = process.env.BENCH_KEY_00245;
+const value92114 = compute(value, 61);
+// note 99090: keep this in sync with the handler
+const value67176 = compute(value, 52);
+const value28961 = compute(value, 55);
+const value11147 = compute(value, 89);
+const value20024 = compute(value, 42);
+const value76343 = compute(value, 4);
+// note 64412: keep this in sync with the handler
+// note 58653: keep this in sync with the handler
+const value69677 = compute(value, 31);
+const value15199 = compute(value, 67);
+const value97922 = compute(value, 49);
+const value17080 = compute(value, 8);
+const value89997 = compute(value, 78);
+const value32646 = compute(value, 54);
+const v = process.env.BENCH_KEY_00531;
+const value89833 = compute(value, 11);
+const value94639 = compute(value, 64);
+const value19635 = compute(value, 41);
+// note 59468: keep this in sync with the handler
+const value72476 = compute(value, 17);
+const value51551 = compute(value, 44);
+const value56166 = compute(value, 3);
+const value62240 = compute(value, 63);
+const value74481 = compute(value, 82);
+const value18092 = compute(value, 50);
+const value76327 = compute(value, 85);
+const value35283 = compute(value, 72);
+const value43426 = compute(value, 67);
+const value72879 = compute(value, 32);
+const value46665 = compute(value, 8);
+const value4710 = compute(value, 54);
+// note 29203: keep this in sync with the handler
+const value13513 = compute(value, 30);
+const value85806 = compute(value, 58);
+const v = process.env.BENCH_KEY_00959;
+const value36373 = compute(value, 95);
+const value46784 = compute(value, 30);
+const value41888 = compute(value, 81);
+const value52489 = compute(value, 12);
+const value25104 = compute(value, 78);
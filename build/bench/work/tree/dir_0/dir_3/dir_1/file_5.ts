@@ -0,0 +1,204 @@
+const value10568 = compute(value, 92);
+const value28291 = compute(value, 64);
+const value39222 = compute(value, 34);
+const value95985 = compute(value, 52);
+const value32564 = compute(value, 69);
+// note 50667: keep this in sync with the handler
+const value37430 = compute(value, 85);
+const value39301 = compute(value, 16);
+const v = import.meta.env.BENCH_KEY_01328;
+const value64651 = compute(value, 49);
+const value57441 = compute(value, 17);
+const value84366 = compute(value, 73);
+const value84130 = compute(value, 31);
+const value83245 = compute(value, 19);
+// note 26111: keep this in sync with the handler
+const value99113 = compute(value, 76);
+const v = import.meta.env.BENCH_KEY_01800;
+const value66834 = compute(value, 1);
+const value60392 = compute(value, 58);
+const value38123 = compute(value, 2);
+const value74453 = compute(value, 54);
+const value37431 = compute(value, 86);
+const value72603 = compute(value, 47);
+const value51688 = compute(value, 84);
+// note 87714: keep this in sync with the handler
+// note 87521: keep this in sync with the handler
+const value23660 = compute(value, 89);
+const v = process.env.BENCH_KEY_00028;
+// note 33726: keep this in sync with the handler
+const value45708 = compute(value, 21);
+const value75240 = compute(value, 65);
+const value98616 = compute(value, 64);
+const value52541 = compute(value, 64);
+const value49874 = compute(value, 16);
+const value26710 = compute(value, 35);
+const value88654 = compute(value, 93);
+const value42581 = compute(value, 95);
+const value34146 = compute(value, 2);
+const value47805 = compute(value, 81);
+// note 90205: keep this in sync with the handler
+const value79137 = compute(value, 82);
+const value87317 = compute(value, 17);
+const value60529 = compute(value, 1);
+const value64226 = compute(value, 12);
+const value76161 = compute(value, 16);
+const v = process.env.BENCH_KEY_00716;
+const value4893 = compute(value, 43);
+const value1376 = compute(value, 18);
+const value95670 = compute(value, 28);
+const value77828 = compute(value, 34);
+const value26227 = compute(value, 37);
+const value78559 = compute(value, 86);
+const value92078 = compute(value, 25);
+// note 92252: keep this in sync with the handler
+const value10235 = compute(value, 50);
+const value68368 = compute(value, 80);
+const value51964 = compute(value, 69);
+const value48579 = compute(value, 79);
+const value1556 = compute(value, 4);
+// note 74814: keep this in sync with the handler
+const value36981 = compute(value, 24);
+const value47392 = compute(value, 56);
+const v = import.meta.env.BENCH_KEY_00506;
+// note 87269: keep this in sync with the handler
+const value96183 = compute(value, 56);
+const value35085 = compute(value, 68);
+// note 89762: keep this in sync with the handler
+// note 87268: keep this in sync with the handler
+// note 58565: keep this in sync with the handler
+const value52978 = compute(value, 16);
+const value70920 = compute(value, 13);
+const value54704 = compute(value, 93);
+const value28519 = compute(value, 1);
+const value67071 = compute(value, 44);
+const value52492 = compute(value, 15);
+const v = import.meta.env.BENCH_KEY_01793;
+const value11060 = compute(value, 2);
+const value34761 = compute(value, 35);
+const value66876 = compute(value, 43);
+const value32102 = compute(value, 92);
+const value58814 = compute(value, 32);
+const value45758 = compute(value, 71);
+const value78826 = compute(value, 62);
+// note 45927: keep this in sync with the handler
+const value97107 = compute(value, 10);
+const value64259 = compute(value, 45);
+// note 51166: keep this in sync with the handler
+const value57441 = compute(value, 17);
+const value10800 = compute(value, 33);
+const value92942 = compute(value, 16);
+const value81904 = compute(value, 36);
+// note 29586: keep this in sync with the handler
+const value26171 = compute(value, 78);
+const value46089 = compute(value, 14);
+const v = process.env.BENCH_KEY_00097;
+const value22802 = compute(value, 7);
+const value7054 = compute(value, 70);
+const value67668 = compute(value, 59);
+const value17276 = compute(value, 10);
+const value18304 = compute(value, 68);
+const value78703 = compute(value, 36);
+const value45552 = compute(value, 59);
+// note 88320: keep this in sync with the handler
+const v = import.meta.env.BENCH_KEY_00333;
+const value22126 = compute(value, 10);
+const value45462 = compute(value, 66);
+const value1505 = compute(value, 50);
+const value39938 = compute(value, 71);
+const value1811 = compute(value, 65);
+const value16940 = compute(value, 62);
+const value39349 = compute(value, 64);
+const value45772 = compute(value, 85);
+const value64254 = compute(value, 40);
+const value77604 = compute(value, 4);
+const value12417 = compute(value, 1);
+const value18166 = compute(value, 27);
+const v = import.meta.env.BENCH_KEY_00353;
+const value83892 = compute(value, 84);
+const value94646 = compute(value, 71);
+const value91582 = compute(value, 14);
+const value2202 = compute(value, 68);
+// note 93843: keep this in sync with the handler
+const value69456 = compute(value, 4);
+const value26054 = compute(value, 58);
+const value41341 = compute(value, 19);
+const value2092 = compute(value, 55);
+const value42409 = compute(value, 20);
+const value7896 = compute(value, 39);
+const value36231 = compute(value, 50);
+const value70335 = compute(value, 10);
+const value68598 = compute(value, 19);
+const value70333 = compute(value, 8);
+// note 54869: keep this in sync with the handler
+const v = process.env.BENCH_KEY_01514;
+const value37556 = compute(value, 17);
+const value83252 = compute(value, 26);
+const value34251 = compute(value, 10);
+const value14609 = compute(value, 59);
+const value86827 = compute(value, 12);
+const value33667 = compute(value, 8);
+const value41958 = compute(value, 54);
+const value83324 = compute(value, 1);
+const value57982 = compute(value, 73);
+const value98142 = compute(value, 75);
+// note 62124: keep this in sync with the handler
+const v = process.env.BENCH_KEY_01737;
+const value3222 = compute(value, 21);
+const value43318 = compute(value, 56);
+// note 225: keep this in sync with the handler
+const value46567 = compute(value, 7);
+const value4097 = compute(value, 23);
+const value45571 = compute(value, 78);
+const value27890 = compute(value, 51);
+const value67984 = compute(value, 84);
+const value78062 = compute(value, 74);
+const value26811 = compute(value, 39);
+const value97959 = compute(value, 86);
+const value84115 = compute(value, 16);
+const v = process.env["BENCH_KEY_01723"];
+const value39675 = compute(value, 2);
+const value67686 = compute(value, 77);
+const value36062 = compute(value, 75);
+const value62646 = compute(value, 81);
+// note 65859: keep this in sync with the handler
+const value37595 = compute(value, 56);
+const value56048 = compute(value, 79);
+const value16483 = compute(value, 90);
+const value33827 = compute(value, 71);
+const v = process.env["BENCH_KEY_01717"];
+const value71332 = compute(value, 37);
+const value78233 = compute(value, 51);
+const value63961 = compute(value, 38);
+const value19678 = compute(value, 84);
+const value79082 = compute(value, 27);
+// note 71722: keep this in sync with the handler
+const value81238 = compute(value, 49);
+const value68684 = compute(value, 8);
+// note 40130: keep this in sync with the handler
+const value221 = compute(value, 27);
+const value56534 = compute(value, 80);
+const value78289 = compute(value, 10);
+const value26828 = compute(value, 56);
+const value16931 = compute(value, 53);
+const value48851 = compute(value, 60);
+const v = process.env.BENCH_KEY_01969;
+const value66286 = compute(value, 35);
+const value1223 = compute(value, 59);
+const value64652 = compute(value, 50);
+const value75253 = compute(value, 78);
+// note 80689: keep this in sync with the handler
+const value24496 = compute(value, 52);
+const value44585 = compute(value, 62);
+const value1867 = compute(value, 24);
+const value30737 = compute(value, 85);
+const value21077 = compute(value, 28);
+// note 63130: keep this in sync with the handler
+const value83910 = compute(value, 5);
+const value36553 = compute(value, 81);
+const v = import.meta.env.BENCH_KEY_00492;
+const value94032 = compute(value, 39);
+const value59215 = compute(value, 45);
+const value6780 = compute(value, 87);
+const value30364 = compute(value, 3);
+const value85624 = compute(value, 70);
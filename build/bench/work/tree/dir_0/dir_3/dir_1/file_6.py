@@ -0,0 +1,243 @@
+value52048 = compute(value, 56)
+value90273 = compute(value, 63)
+# note 76565: keep this in sync with the handler
+value32078 = compute(value, 68)
+value15772 = compute(value, 58)
+value40625 = compute(value, 79)
+value34367 = compute(value, 29)
+value81201 = compute(value, 12)
+value21683 = compute(value, 52)
+const v = os.environ.get('BENCH_KEY_01211');
+value34768 = compute(value, 42)
+value28685 = compute(value, 70)
+value48511 = compute(value, 11)
+value17603 = compute(value, 46)
+value27680 = compute(value, 35)
+value83196 = compute(value, 67)
+value83139 = compute(value, 10)
+value78744 = compute(value, 77)
+value58401 = compute(value, 7)
+const v = os.environ.get('BENCH_KEY_01504');
+# note 85278: keep this in sync with the handler
+value33807 = compute(value, 51)
+value23968 = compute(value, 9)
+value74117 = compute(value, 9)
+value69936 = compute(value, 96)
+value71048 = compute(value, 44)
+value84417 = compute(value, 27)
+value15199 = compute(value, 67)
+value17501 = compute(value, 41)
+value39121 = compute(value, 30)
+value29036 = compute(value, 33)
+value26918 = compute(value, 49)
+value11926 = compute(value, 92)
+value16157 = compute(value, 55)
+value82272 = compute(value, 16)
+value52633 = compute(value, 59)
+value35463 = compute(value, 58)
+value33339 = compute(value, 68)
+value94730 = compute(value, 58)
+value74361 = compute(value, 59)
+value60665 = compute(value, 40)
+const v = os.environ["BENCH_KEY_01247"];
+value26071 = compute(value, 75)
+value59574 = compute(value, 16)
+value46969 = compute(value, 21)
+# note 66651: keep this in sync with the handler
+value84671 = compute(value, 87)
+value1142 = compute(value, 75)
+value17984 = compute(value, 39)
+value23013 = compute(value, 24)
+value42033 = compute(value, 32)
+value52704 = compute(value, 33)
+value89454 = compute(value, 20)
+value59217 = compute(value, 47)
+const v = os.getenv("BENCH_KEY_00250");
+value85851 = compute(value, 6)
+# note 69213: keep this in sync with the handler
+value90756 = compute(value, 61)
+value6378 = compute(value, 73)
+value48438 = compute(value, 35)
+value94998 = compute(value, 35)
+value9127 = compute(value, 9)
+value32556 = compute(value, 61)
+value25952 = compute(value, 53)
+value95159 = compute(value, 2)
+value44535 = compute(value, 12)
+value15944 = compute(value, 36)
+value62362 = compute(value, 88)
+value51070 = compute(value, 48)
+value8111 = compute(value, 60)
+# note 7097: keep this in sync with the handler
+# note 29458: keep this in sync with the handler
+value98054 = compute(value, 84)
+value31439 = compute(value, 11)
+value21308 = compute(value, 65)
+value90521 = compute(value, 20)
+const v = os.getenv("BENCH_KEY_00291");
+value79966 = compute(value, 38)
+# note 91287: keep this in sync with the handler
+value13480 = compute(value, 94)
+value67281 = compute(value, 60)
+value58500 = compute(value, 9)
+value21290 = compute(value, 47)
+value16335 = compute(value, 39)
+value71658 = compute(value, 72)
+value70004 = compute(value, 67)
+value19598 = compute(value, 4)
+value39845 = compute(value, 75)
+value69611 = compute(value, 62)
+value88876 = compute(value, 24)
+value21392 = compute(value, 52)
+const v = os.environ.get('BENCH_KEY_00845');
+value45263 = compute(value, 61)
+value93666 = compute(value, 61)
+value67328 = compute(value, 10)
+value19803 = compute(value, 15)
+value32859 = compute(value, 73)
+value67553 = compute(value, 41)
+value81641 = compute(value, 64)
+value11178 = compute(value, 23)
+value86688 = compute(value, 67)
+value6711 = compute(value, 18)
+const v = os.environ.get('BENCH_KEY_01983');
+value63546 = compute(value, 11)
+value80403 = compute(value, 87)
+value97253 = compute(value, 59)
+value43650 = compute(value, 0)
+value13323 = compute(value, 34)
+value43880 = compute(value, 36)
+value30045 = compute(value, 72)
+value75699 = compute(value, 39)
+value49455 = compute(value, 82)
+value15793 = compute(value, 79)
+value33797 = compute(value, 41)
+value65867 = compute(value, 4)
+value28367 = compute(value, 43)
+# note 59301: keep this in sync with the handler
+value69104 = compute(value, 40)
+value96575 = compute(value, 60)
+value62127 = compute(value, 47)
+const v = os.environ["BENCH_KEY_01976"];
+value61037 = compute(value, 24)
+value23711 = compute(value, 43)
+# note 37929: keep this in sync with the handler
+value11594 = compute(value, 51)
+value49648 = compute(value, 81)
+value66135 = compute(value, 78)
+value60731 = compute(value, 9)
+value92740 = compute(value, 8)
+value75225 = compute(value, 50)
+value35540 = compute(value, 38)
+value66304 = compute(value, 53)
+value35772 = compute(value, 76)
+value58154 = compute(value, 51)
+value25821 = compute(value, 19)
+value75353 = compute(value, 81)
+value51120 = compute(value, 1)
+const v = os.environ["BENCH_KEY_01957"];
+# note 97882: keep this in sync with the handler
+value11926 = compute(value, 92)
+value27382 = compute(value, 28)
+value9816 = compute(value, 19)
+value50836 = compute(value, 8)
+value92222 = compute(value, 72)
+value50869 = compute(value, 41)
+# note 96354: keep this in sync with the handler
+value92305 = compute(value, 58)
+value57307 = compute(value, 77)
+const v = os.environ.get('BENCH_KEY_01140');
+# note 72975: keep this in sync with the handler
+value47124 = compute(value, 79)
+value87488 = compute(value, 91)
+value51181 = compute(value, 62)
+value48026 = compute(value, 11)
+value35679 = compute(value, 80)
+value79211 = compute(value, 59)
+value77497 = compute(value, 91)
+# note 62968: keep this in sync with the handler
+value78283 = compute(value, 4)
+value30156 = compute(value, 86)
+value2430 = compute(value, 5)
+value98587 = compute(value, 35)
+value66645 = compute(value, 6)
+value35859 = compute(value, 66)
+const v = os.environ["BENCH_KEY_00491"];
+value416 = compute(value, 28)
+value13946 = compute(value, 75)
+value41095 = compute(value, 64)
+value50593 = compute(value, 56)
+value50718 = compute(value, 84)
+value31920 = compute(value, 7)
+value80946 = compute(value, 48)
+value65856 = compute(value, 90)
+value60385 = compute(value, 51)
+value82767 = compute(value, 26)
+value42599 = compute(value, 16)
+value84447 = compute(value, 57)
+value11275 = compute(value, 23)
+value33902 = compute(value, 49)
+value90521 = compute(value, 20)
+value95998 = compute(value, 65)
+value62890 = compute(value, 34)
+value45671 = compute(value, 81)
+# note 19467: keep this in sync with the handler
+# note 52591: keep this in sync with the handler
+value23490 = compute(value, 16)
+value96406 = compute(value, 85)
+value86490 = compute(value, 63)
+const v = os.getenv("BENCH_KEY_01540");
+value68326 = compute(value, 38)
+value56769 = compute(value, 24)
+value72532 = compute(value, 73)
+value13697 = compute(value, 20)
+value31987 = compute(value, 74)
+value77355 = compute(value, 46)
+value36298 = compute(value, 20)
+value49684 = compute(value, 20)
+value87078 = compute(value, 69)
+value34925 = compute(value, 5)
+value98081 = compute(value, 14)
+value29902 = compute(value, 26)
+value80517 = compute(value, 7)
+value53611 = compute(value, 67)
+value45488 = compute(value, 92)
+# note 54891: keep this in sync with the handler
+value54313 = compute(value, 90)
+value57597 = compute(value, 76)
+value62438 = compute(value, 67)
+value61077 = compute(value, 64)
+value63626 = compute(value, 91)
+value69066 = compute(value, 2)
+value40491 = compute(value, 42)
+const v = os.getenv("BENCH_KEY_00454");
+value16299 = compute(value, 3)
+value13436 = compute(value, 50)
+value38726 = compute(value, 23)
+value37020 = compute(value, 63)
+value45609 = compute(value, 19)
+# note 14596: keep this in sync with the handler
+value45233 = compute(value, 31)
+value33876 = compute(value, 23)
+value44768 = compute(value, 51)
+value83260 = compute(value, 34)
+# note 3636: keep this in sync with the handler
+value61610 = compute(value, 15)
+const v = os.getenv("BENCH_KEY_00228");
+value44881 = compute(value, 67)
+# note 48802: keep this in sync with the handler
+value9719 = compute(value, 19)
+value10864 = compute(value, 0)
+value7326 = compute(value, 51)
+value89687 = compute(value, 59)
+value13049 = compute(value, 51)
+value74787 = compute(value, 0)
+value41479 = compute(value, 60)
+value93544 = compute(value, 36)
+value93896 = compute(value, 0)
+value76411 = compute(value, 72)
+value24572 = compute(value, 31)
+value5066 = compute(value, 22)
+value58027 = compute(value, 21)
+value18038 = compute(value, 93)
+value51923 = compute(value, 28)
@@ -0,0 +1,235 @@
+value88466 := compute(value, 2)
+value58685 := compute(value, 0)
+value35526 := compute(value, 24)
+value24236 := compute(value, 83)
+value84016 := compute(value, 14)
+value62490 := compute(value, 22)
+value56159 := compute(value, 93)
+value97074 := compute(value, 74)
+value69861 := compute(value, 21)
+value11012 := compute(value, 51)
+value57187 := compute(value, 54)
+value28118 := compute(value, 85)
+value36853 := compute(value, 90)
+value86438 := compute(value, 11)
+value67700 := compute(value, 91)
+const v = os.LookupEnv("BENCH_KEY_00304");
+value9653 := compute(value, 50)
+value22794 := compute(value, 96)
+value44667 := compute(value, 47)
+value42198 := compute(value, 3)
+value31469 := compute(value, 41)
+value65542 := compute(value, 67)
+value44996 := compute(value, 85)
+value60377 := compute(value, 43)
+value308 := compute(value, 17)
+value67576 := compute(value, 64)
+value57336 := compute(value, 9)
+value65869 := compute(value, 6)
+value63788 := compute(value, 59)
+value19056 := compute(value, 44)
+value33769 := compute(value, 13)
+// note 2554: keep this in sync with the handler
+value17393 := compute(value, 30)
+value70160 := compute(value, 29)
+value44781 := compute(value, 64)
+value11349 := compute(value, 0)
+const v = os.Getenv("BENCH_KEY_01890");
+value27191 := compute(value, 31)
+value36049 := compute(value, 62)
+value41602 := compute(value, 86)
+value53966 := compute(value, 34)
+value62696 := compute(value, 34)
+value70923 := compute(value, 16)
+// note 195: keep this in sync with the handler
+value83689 := compute(value, 75)
+value64673 := compute(value, 71)
+// note 54760: keep this in sync with the handler
+value42111 := compute(value, 13)
+value76275 := compute(value, 33)
+// note 54005: keep this in sync with the handler
+value93147 := compute(value, 27)
+value88411 := compute(value, 44)
+const v = os.LookupEnv("BENCH_KEY_00788");
+value66143 := compute(value, 86)
+value13078 := compute(value, 80)
+value72592 := compute(value, 36)
+value84581 := compute(value, 94)
+value53119 := compute(value, 60)
+value51186 := compute(value, 67)
+// note 42286: keep this in sync with the handler
+value31919 := compute(value, 6)
+value21084 := compute(value, 35)
+value7054 := compute(value, 70)
+const v = os.Getenv("BENCH_KEY_00020");
+value42989 := compute(value, 18)
+value96398 := compute(value, 77)
+value59208 := compute(value, 38)
+value525 := compute(value, 40)
+value8529 := compute(value, 90)
+value40241 := compute(value, 83)
+value66493 := compute(value, 48)
+// note 90072: keep this in sync with the handler
+value5535 := compute(value, 6)
+value37370 := compute(value, 25)
+value24427 := compute(value, 80)
+value52950 := compute(value, 85)
+value29256 := compute(value, 59)
+value89805 := compute(value, 80)
+value54610 := compute(value, 96)
+value23740 := compute(value, 72)
+value21621 := compute(value, 87)
+value65891 := compute(value, 28)
+value30067 := compute(value, 94)
+value93579 := compute(value, 71)
+value18722 := compute(value, 1)
+value46458 := compute(value, 92)
+const v = os.Getenv("BENCH_KEY_01103");
+value19113 := compute(value, 4)
+value27695 := compute(value, 50)
+value79605 := compute(value, 65)
+// note 62083: keep this in sync with the handler
+value14295 := compute(value, 36)
+value75776 := compute(value, 19)
+value84366 := compute(value, 73)
+value41277 := compute(value, 52)
+value30547 := compute(value, 89)
+value67080 := compute(value, 53)
+value31497 := compute(value, 69)
+value11700 := compute(value, 60)
+// note 41880: keep this in sync with the handler
+value98989 := compute(value, 49)
+const v = os.Getenv("BENCH_KEY_01783");
+value42954 := compute(value, 80)
+value61015 := compute(value, 2)
+value944 := compute(value, 71)
+value10338 := compute(value, 56)
+value50693 := compute(value, 59)
+value64423 := compute(value, 15)
+value2766 := compute(value, 50)
+value98010 := compute(value, 40)
+value33304 := compute(value, 33)
+value80557 := compute(value, 47)
+value5771 := compute(value, 48)
+value3184 := compute(value, 80)
+value93132 := compute(value, 12)
+value93159 := compute(value, 39)
+value19086 := compute(value, 74)
+value11331 := compute(value, 79)
+// note 87517: keep this in sync with the handler
+const v = os.LookupEnv("BENCH_KEY_00458");
+value92772 := compute(value, 40)
+value4141 := compute(value, 67)
+value38629 := compute(value, 23)
+value41878 := compute(value, 71)
+value34449 := compute(value, 14)
+value40600 := compute(value, 54)
+value26021 := compute(value, 25)
+value19331 := compute(value, 28)
+value1079 := compute(value, 12)
+value93682 := compute(value, 77)
+value38685 := compute(value, 79)
+value77243 := compute(value, 31)
+value66481 := compute(value, 36)
+const v = os.Getenv("BENCH_KEY_01067");
+value90847 := compute(value, 55)
+value58800 := compute(value, 18)
+value78434 := compute(value, 58)
+// note 98415: keep this in sync with the handler
+value16395 := compute(value, 2)
+value96479 := compute(value, 61)
+value65918 := compute(value, 55)
+value10379 := compute(value, 0)
+value7639 := compute(value, 73)
+value64843 := compute(value, 47)
+value67110 := compute(value, 83)
+value10423 := compute(value, 44)
+const v = os.LookupEnv("BENCH_KEY_00515");
+value97524 := compute(value, 39)
+value69143 := compute(value, 79)
+value13656 := compute(value, 76)
+value18453 := compute(value, 23)
+value13827 := compute(value, 53)
+value65864 := compute(value, 1)
+value30616 := compute(value, 61)
+// note 60882: keep this in sync with the handler
+value72113 := compute(value, 42)
+const v = os.LookupEnv("BENCH_KEY_01671");
+value43904 := compute(value, 60)
+value34013 := compute(value, 63)
+value47656 := compute(value, 29)
+// note 62634: keep this in sync with the handler
+value52116 := compute(value, 27)
+value44750 := compute(value, 33)
+value44510 := compute(value, 84)
+value50237 := compute(value, 88)
+// note 76307: keep this in sync with the handler
+// note 5323: keep this in sync with the handler
+value80872 := compute(value, 71)
+value72171 := compute(value, 3)
+value7283 := compute(value, 8)
+// note 43316: keep this in sync with the handler
+const v = os.LookupEnv("BENCH_KEY_01053");
+value62051 := compute(value, 68)
+value37107 := compute(value, 53)
+value96364 := compute(value, 43)
+value41924 := compute(value, 20)
+value64700 := compute(value, 1)
+value65393 := compute(value, 15)
+value19293 := compute(value, 87)
+value93785 := compute(value, 83)
+value82455 := compute(value, 5)
+value43718 := compute(value, 68)
+value56673 := compute(value, 25)
+value28269 := compute(value, 42)
+// note 43535: keep this in sync with the handler
+// note 25921: keep this in sync with the handler
+value87246 := compute(value, 43)
+value53135 := compute(value, 76)
+// note 89275: keep this in sync with the handler
+value7201 := compute(value, 23)
+value6542 := compute(value, 43)
+value4089 := compute(value, 15)
+const v = os.Getenv("BENCH_KEY_00976");
+value1853 := compute(value, 10)
+value13480 := compute(value, 94)
+value3799 := compute(value, 16)
+// note 14492: keep this in sync with the handler
+value5446 := compute(value, 14)
+value67910 := compute(value, 10)
+value2256 := compute(value, 25)
+value58957 := compute(value, 78)
+value17262 := compute(value, 93)
+value26259 := compute(value, 69)
+value73176 := compute(value, 38)
+value30205 := compute(value, 38)
+const v = os.Getenv("BENCH_KEY_00727");
+value96213 := compute(value, 86)
+value14447 := compute(value, 91)
+// note 64629: keep this in sync with the handler
+// note 99695: keep this in sync with the handler
+value35304 := compute(value, 93)
+value18835 := compute(value, 17)
+value20545 := compute(value, 78)
+value79822 := compute(value, 88)
+value79078 := compute(value, 23)
+value56062 := compute(value, 93)
+value98182 := compute(value, 18)
+// note 88635: keep this in sync with the handler
+value86831 := compute(value, 16)
+const v = os.Getenv("BENCH_KEY_01694");
+value31427 := compute(value, 96)
+value9449 := compute(value, 40)
+value7656 := compute(value, 90)
+value51481 := compute(value, 71)
+value66871 := compute(value, 38)
+value65466 := compute(value, 88)
+value61834 := compute(value, 45)
+value48912 := compute(value, 24)
+value92379 := compute(value, 35)
+const v = os.Getenv("BENCH_KEY_01578");
+value87073 := compute(value, 64)
+value62571 := compute(value, 6)
+value359 := compute(value, 68)
+value65784 := compute(value, 18)
+value94129 := compute(value, 39)
@@ -0,0 +1,233 @@
+value95944 := compute(value, 11)
+value89288 := compute(value, 48)
+value29079 := compute(value, 76)
+value14664 := compute(value, 17)
+value85713 := compute(value, 62)
+value79902 := compute(value, 71)
+value35044 := compute(value, 27)
+value2969 := compute(value, 59)
+value38102 := compute(value, 78)
+value73965 := compute(value, 51)
+value23318 := compute(value, 38)
+value24916 := compute(value, 84)
+value61038 := compute(value, 25)
+value87765 := compute(value, 77)
+// note 55676: keep this in sync with the handler
+const v = os.LookupEnv("BENCH_KEY_01299");
+value39192 := compute(value, 4)
+value50111 := compute(value, 59)
+// note 65646: keep this in sync with the handler
+value52639 := compute(value, 65)
+value79579 := compute(value, 39)
+// note 33027: keep this in sync with the handler
+value64539 := compute(value, 34)
+value83182 := compute(value, 53)
+value43470 := compute(value, 14)
+// note 28182: keep this in sync with the handler
+value75307 := compute(value, 35)
+value38722 := compute(value, 19)
+value72022 := compute(value, 48)
+// note 61276: keep this in sync with the handler
+const v = os.LookupEnv("BENCH_KEY_01657");
+value49237 := compute(value, 58)
+value12955 := compute(value, 54)
+value52063 := compute(value, 71)
+value17183 := compute(value, 14)
+value36555 := compute(value, 83)
+value19945 := compute(value, 60)
+value64327 := compute(value, 16)
+value9608 := compute(value, 5)
+value59249 := compute(value, 79)
+// note 35933: keep this in sync with the handler
+value82035 := compute(value, 70)
+value53385 := compute(value, 35)
+value18991 := compute(value, 76)
+value92648 := compute(value, 13)
+value49953 := compute(value, 95)
+value57895 := compute(value, 83)
+const v = os.Getenv("BENCH_KEY_01930");
+value75483 := compute(value, 17)
+value33996 := compute(value, 46)
+value18234 := compute(value, 95)
+value70652 := compute(value, 36)
+value19505 := compute(value, 8)
+// note 86278: keep this in sync with the handler
+value28689 := compute(value, 74)
+value29567 := compute(value, 79)
+value24894 := compute(value, 62)
+value11239 := compute(value, 84)
+value85252 := compute(value, 86)
+value37029 := compute(value, 72)
+value53790 := compute(value, 52)
+const v = os.LookupEnv("BENCH_KEY_01841");
+value38275 := compute(value, 57)
+// note 92640: keep this in sync with the handler
+// note 80952: keep this in sync with the handler
+value11706 := compute(value, 66)
+value90578 := compute(value, 77)
+value64712 := compute(value, 13)
+value21431 := compute(value, 91)
+value13278 := compute(value, 86)
+value71834 := compute(value, 54)
+value42250 := compute(value, 55)
+value67039 := compute(value, 12)
+value87474 := compute(value, 77)
+value74693 := compute(value, 3)
+value55141 := compute(value, 45)
+value96988 := compute(value, 85)
+value62589 := compute(value, 24)
+value73407 := compute(value, 75)
+value43479 := compute(value, 23)
+const v = os.Getenv("BENCH_KEY_00979");
+value25631 := compute(value, 23)
+value92084 := compute(value, 31)
+value60243 := compute(value, 6)
+value40922 := compute(value, 85)
+value91320 := compute(value, 43)
+value80422 := compute(value, 9)
+value87600 := compute(value, 9)
+value45108 := compute(value, 3)
+value67430 := compute(value, 15)
+value26579 := compute(value, 1)
+value83379 := compute(value, 56)
+value17728 := compute(value, 74)
+value41324 := compute(value, 2)
+value83644 := compute(value, 30)
+value78937 := compute(value, 76)
+value85608 := compute(value, 54)
+value66017 := compute(value, 57)
+value21380 := compute(value, 40)
+value41466 := compute(value, 47)
+const v = os.LookupEnv("BENCH_KEY_01388");
+value59171 := compute(value, 1)
+value66444 := compute(value, 96)
+// note 35579: keep this in sync with the handler
+value26573 := compute(value, 92)
+// note 81595: keep this in sync with the handler
+value47863 := compute(value, 42)
+value46607 := compute(value, 47)
+value14612 := compute(value, 62)
+value60097 := compute(value, 54)
+value98559 := compute(value, 7)
+value86294 := compute(value, 61)
+value37413 := compute(value, 68)
+value13165 := compute(value, 70)
+value6954 := compute(value, 67)
+value28001 := compute(value, 65)
+value97585 := compute(value, 3)
+value84761 := compute(value, 80)
+const v = os.Getenv("BENCH_KEY_01655");
+value63948 := compute(value, 25)
+value302 := compute(value, 11)
+value41709 := compute(value, 96)
+value13999 := compute(value, 31)
+value22048 := compute(value, 29)
+value73112 := compute(value, 71)
+value32583 := compute(value, 88)
+value10347 := compute(value, 65)
+// note 37537: keep this in sync with the handler
+// note 62401: keep this in sync with the handler
+value85303 := compute(value, 40)
+value23110 := compute(value, 24)
+value58814 := compute(value, 32)
+value32045 := compute(value, 35)
+value79913 := compute(value, 82)
+value55335 := compute(value, 45)
+const v = os.LookupEnv("BENCH_KEY_01975");
+// note 22524: keep this in sync with the handler
+value66004 := compute(value, 44)
+value91154 := compute(value, 71)
+value88885 := compute(value, 33)
+value21529 := compute(value, 92)
+value84983 := compute(value, 11)
+value27456 := compute(value, 5)
+value38027 := compute(value, 3)
+value17431 := compute(value, 68)
+value48725 := compute(value, 31)
+value32438 := compute(value, 40)
+value38878 := compute(value, 78)
+value40890 := compute(value, 53)
+value81579 := compute(value, 2)
+// note 28731: keep this in sync with the handler
+value39959 := compute(value, 92)
+const v = os.Getenv("BENCH_KEY_01830");
+value74175 := compute(value, 67)
+value10592 := compute(value, 19)
+value97216 := compute(value, 22)
+value32959 := compute(value, 76)
+// note 17075: keep this in sync with the handler
+value20594 := compute(value, 30)
+value93283 := compute(value, 66)
+value90682 := compute(value, 84)
+value69280 := compute(value, 22)
+value95368 := compute(value, 17)
+// note 65892: keep this in sync with the handler
+value33609 := compute(value, 47)
+value95281 := compute(value, 27)
+// note 90127: keep this in sync with the handler
+value16574 := compute(value, 84)
+value68071 := compute(value, 74)
+value61846 := compute(value, 57)
+value61544 := compute(value, 46)
+value33245 := compute(value, 71)
+const v = os.Getenv("BENCH_KEY_00239");
+value21675 := compute(value, 44)
+value35809 := compute(value, 16)
+value12234 := compute(value, 12)
+value80786 := compute(value, 82)
+value72217 := compute(value, 49)
+// note 11488: keep this in sync with the handler
+value96289 := compute(value, 65)
+value48353 := compute(value, 47)
+// note 70522: keep this in sync with the handler
+value79928 := compute(value, 0)
+value32495 := compute(value, 0)
+value812 := compute(value, 36)
+value71041 := compute(value, 37)
+value7914 := compute(value, 57)
+value4023 := compute(value, 46)
+value26738 := compute(value, 63)
+value96532 := compute(value, 17)
+value63657 := compute(value, 25)
+value15973 := compute(value, 65)
+// note 39613: keep this in sync with the handler
+const v = os.Getenv("BENCH_KEY_00520");
+value92197 := compute(value, 47)
+value28561 := compute(value, 43)
+// note 23093: keep this in sync with the handler
+value42767 := compute(value, 87)
+value68346 := compute(value, 58)
+value64568 := compute(value, 63)
+// note 7717: keep this in sync with the handler
+value30951 := compute(value, 8)
+value34733 := compute(value, 7)
+const v = os.Getenv("BENCH_KEY_00208");
+value28968 := compute(value, 62)
+value12768 := compute(value, 61)
+value56108 := compute(value, 42)
+value94746 := compute(value, 74)
+value20008 := compute(value, 26)
+value60804 := compute(value, 82)
+value60464 := compute(value, 33)
+value31487 := compute(value, 59)
+value38672 := compute(value, 66)
+value43021 := compute(value, 50)
+value80767 := compute(value, 63)
+const v = os.Getenv("BENCH_KEY_01913");
+value24679 := compute(value, 41)
+// note 57303: keep this in sync with the handler
+value45547 := compute(value, 54)
+value55014 := compute(value, 15)
+// note 20310: keep this in sync with the handler
+value37044 := compute(value, 87)
+value11533 := compute(value, 87)
+value53555 := compute(value, 11)
+value48641 := compute(value, 44)
+value70718 := compute(value, 5)
+const v = os.LookupEnv("BENCH_KEY_01999");
+value73745 := compute(value, 25)
+value56022 := compute(value, 53)
+value78176 := compute(value, 91)
+value72384 := compute(value, 22)
+// note 44933: keep this in sync with the handler
+value11749 := compute(value, 12)
@@ -0,0 +1,212 @@
+let value41126 = compute(value, 95);
+const v = env::var("BENCH_KEY_00864");
+let value77832 = compute(value, 38);
+let value74911 = compute(value, 27);
+let value45761 = compute(value, 74);
+let value82978 = compute(value, 43);
+let value26722 = compute(value, 47);
+let value99318 = compute(value, 87);
+let value10015 = compute(value, 24);
+let value78048 = compute(value, 60);
+// note 88226: keep this in sync with the handler
+let value91927 = compute(value, 68);
+let value48102 = compute(value, 87);
+let value58845 = compute(value, 63);
+let value89027 = compute(value, 78);
+let value69562 = compute(value, 13);
+let value15090 = compute(value, 55);
+let value77975 = compute(value, 84);
+// note 56956: keep this in sync with the handler
+const v = env::var("BENCH_KEY_01771");
+let value87459 = compute(value, 62);
+let value67426 = compute(value, 11);
+let value18520 = compute(value, 90);
+let value66569 = compute(value, 27);
+let value18578 = compute(value, 51);
+let value4570 = compute(value, 11);
+let value74572 = compute(value, 76);
+let value80942 = compute(value, 44);
+const v = env::var("BENCH_KEY_00055");
+// note 20955: keep this in sync with the handler
+let value71408 = compute(value, 16);
+let value52022 = compute(value, 30);
+let value17189 = compute(value, 20);
+let value16535 = compute(value, 45);
+// note 68007: keep this in sync with the handler
+let value35007 = compute(value, 87);
+let value97806 = compute(value, 30);
+let value8863 = compute(value, 36);
+let value33666 = compute(value, 7);
+const v = env::var("BENCH_KEY_01982");
+let value37397 = compute(value, 52);
+let value39024 = compute(value, 30);
+let value34838 = compute(value, 15);
+let value5186 = compute(value, 45);
+let value36362 = compute(value, 84);
+let value8285 = compute(value, 40);
+let value48364 = compute(value, 58);
+let value77028 = compute(value, 10);
+let value31753 = compute(value, 34);
+let value64404 = compute(value, 93);
+let value22349 = compute(value, 39);
+let value23524 = compute(value, 50);
+const v = env::var_os("BENCH_KEY_01939");
+// note 88139: keep this in sync with the handler
+// note 25255: keep this in sync with the handler
+let value23101 = compute(value, 15);
+let value97757 = compute(value, 78);
+// note 44217: keep this in sync with the handler
+let value12126 = compute(value, 1);
+let value88904 = compute(value, 52);
+let value55059 = compute(value, 60);
+// note 19518: keep this in sync with the handler
+let value86639 = compute(value, 18);
+// note 14204: keep this in sync with the handler
+let value85025 = compute(value, 53);
+// note 16672: keep this in sync with the handler
+const v = env::var_os("BENCH_KEY_00196");
+let value11384 = compute(value, 35);
+let value2474 = compute(value, 49);
+let value51909 = compute(value, 14);
+let value62261 = compute(value, 84);
+// note 96244: keep this in sync with the handler
+let value49545 = compute(value, 75);
+let value45337 = compute(value, 38);
+let value85181 = compute(value, 15);
+// note 85984: keep this in sync with the handler
+let value59619 = compute(value, 61);
+let value90754 = compute(value, 59);
+const v = env::var_os("BENCH_KEY_00972");
+let value68853 = compute(value, 80);
+let value34837 = compute(value, 14);
+let value40015 = compute(value, 51);
+let value14749 = compute(value, 5);
+let value87793 = compute(value, 8);
+let value15720 = compute(value, 6);
+let value33223 = compute(value, 49);
+let value45882 = compute(value, 1);
+let value98037 = compute(value, 67);
+let value63044 = compute(value, 91);
+let value46282 = compute(value, 13);
+let value18302 = compute(value, 66);
+let value57365 = compute(value, 38);
+let value61009 = compute(value, 93);
+let value82822 = compute(value, 81);
+let value16479 = compute(value, 86);
+let value74404 = compute(value, 5);
+let value82948 = compute(value, 13);
+const v = env::var("BENCH_KEY_01469");
+let value66394 = compute(value, 46);
+let value38099 = compute(value, 75);
+let value64467 = compute(value, 59);
+// note 70458: keep this in sync with the handler
+let value58368 = compute(value, 71);
+let value55125 = compute(value, 29);
+let value24474 = compute(value, 30);
+let value18553 = compute(value, 26);
+let value42786 = compute(value, 9);
+let value86632 = compute(value, 11);
+let value76346 = compute(value, 7);
+let value40376 = compute(value, 24);
+let value59208 = compute(value, 38);
+// note 47431: keep this in sync with the handler
+const v = env::var("BENCH_KEY_00155");
+let value26520 = compute(value, 39);
+let value55708 = compute(value, 30);
+let value78380 = compute(value, 4);
+let value37835 = compute(value, 5);
+let value15246 = compute(value, 17);
+let value42238 = compute(value, 43);
+let value28001 = compute(value, 65);
+let value9806 = compute(value, 9);
+// note 27748: keep this in sync with the handler
+let value85433 = compute(value, 73);
+// note 85116: keep this in sync with the handler
+const v = env::var_os("BENCH_KEY_01924");
+let value53563 = compute(value, 19);
+let value50184 = compute(value, 35);
+let value70064 = compute(value, 30);
+// note 38495: keep this in sync with the handler
+let value25483 = compute(value, 69);
+let value65119 = compute(value, 32);
+let value77568 = compute(value, 65);
+let value33247 = compute(value, 73);
+let value56298 = compute(value, 38);
+let value74876 = compute(value, 89);
+let value68571 = compute(value, 89);
+let value65568 = compute(value, 93);
+let value9223 = compute(value, 8);
+let value22682 = compute(value, 81);
+const v = env::var("BENCH_KEY_00491");
+// note 78316: keep this in sync with the handler
+let value88553 = compute(value, 89);
+let value38172 = compute(value, 51);
+let value60768 = compute(value, 46);
+let value67165 = compute(value, 41);
+let value53881 = compute(value, 46);
+// note 80056: keep this in sync with the handler
+let value37208 = compute(value, 57);
+let value69883 = compute(value, 43);
+let value59744 = compute(value, 89);
+let value72552 = compute(value, 93);
+let value30290 = compute(value, 26);
+let value16126 = compute(value, 24);
+let value80676 = compute(value, 69);
+let value17770 = compute(value, 19);
+let value55885 = compute(value, 13);
+let value11241 = compute(value, 86);
+let value45348 = compute(value, 49);
+let value5688 = compute(value, 62);
+const v = env::var("BENCH_KEY_00882");
+let value43938 = compute(value, 94);
+let value91873 = compute(value, 14);
+let value61580 = compute(value, 82);
+let value90352 = compute(value, 45);
+let value81259 = compute(value, 70);
+let value66119 = compute(value, 62);
+// note 64580: keep this in sync with the handler
+let value92508 = compute(value, 67);
+let value77034 = compute(value, 16);
+const v = env::var_os("BENCH_KEY_01462");
+// note 98993: keep this in sync with the handler
+let value143 = compute(value, 46);
+let value79303 = compute(value, 54);
+let value34599 = compute(value, 67);
+let value43250 = compute(value, 85);
+let value82247 = compute(value, 88);
+let value68348 = compute(value, 60);
+let value20501 = compute(value, 34);
+let value55715 = compute(value, 37);
+let value70478 = compute(value, 56);
+let value74511 = compute(value, 15);
+let value77006 = compute(value, 85);
+let value86798 = compute(value, 80);
+// note 92242: keep this in sync with the handler
+let value38497 = compute(value, 85);
+let value98188 = compute(value, 24);
+const v = env::var("BENCH_KEY_00115");
+let value61076 = compute(value, 63);
+let value93592 = compute(value, 84);
+let value24015 = compute(value, 56);
+let value83961 = compute(value, 56);
+// note 41465: keep this in sync with the handler
+// note 12825: keep this in sync with the handler
+let value3805 = compute(value, 22);
+let value52331 = compute(value, 48);
+let value54216 = compute(value, 90);
+const v = env::var_os("BENCH_KEY_00368");
+// note 85820: keep this in sync with the handler
+let value76056 = compute(value, 8);
+let value85484 = compute(value, 27);
+// note 94885: keep this in sync with the handler
+let value52309 = compute(value, 26);
+// note 72458: keep this in sync with the handler
+let value34712 = compute(value, 83);
+const v = env::var("BENCH_KEY_00560");
+let value72040 = compute(value, 66);
+let value60167 = compute(value, 27);
+let value8865 = compute(value, 38);
+let value13692 = compute(value, 15);
+let value44596 = compute(value, 73);
+let value74454 = compute(value, 55);
+let value25170 = compute(value, 47);
@@ -0,0 +1,206 @@
+const value11754 = compute(value, 17);
+const value90378 = compute(value, 71);
+const value92949 = compute(value, 23);
+const value61857 = compute(value, 68);
+const value39586 = compute(value, 10);
+const value82344 = compute(value, 88);
+const value36790 = compute(value, 27);
+const value50890 = compute(value, 62);
+const value57658 = compute(value, 40);
+const value82333 = compute(value, 77);
+const value71539 = compute(value, 50);
+// note 31860: keep this in sync with the handler
+const v = import.meta.env.BENCH_KEY_01575;
+const value2731 = compute(value, 15);
+const value78661 = compute(value, 91);
+const value86200 = compute(value, 64);
+// note 50305: keep this in sync with the handler
+const value8309 = compute(value, 64);
+const value51965 = compute(value, 70);
+const value92164 = compute(value, 14);
+const value85055 = compute(value, 83);
+const value18757 = compute(value, 36);
+const value75752 = compute(value, 92);
+const value33699 = compute(value, 40);
+const value46386 = compute(value, 20);
+const value38174 = compute(value, 53);
+const value41342 = compute(value, 20);
+const value78212 = compute(value, 30);
+const value85607 = compute(value, 53);
+const v = process.env.BENCH_KEY_01336;
+const value69987 = compute(value, 50);
+const value5805 = compute(value, 82);
+const value5740 = compute(value, 17);
+const value42045 = compute(value, 44);
+const value16527 = compute(value, 37);
+const value88146 = compute(value, 70);
+const value74512 = compute(value, 16);
+const value72376 = compute(value, 14);
+const value54914 = compute(value, 12);
+const value18260 = compute(value, 24);
+const value52731 = compute(value, 60);
+const value73069 = compute(value, 28);
+const value896 = compute(value, 23);
+const value37304 = compute(value, 56);
+const value51024 = compute(value, 2);
+const value16073 = compute(value, 68);
+// note 93444: keep this in sync with the handler
+const value13165 = compute(value, 70);
+const value13572 = compute(value, 89);
+const v = process.env.BENCH_KEY_01168;
+// note 85673: keep this in sync with the handler
+const value66666 = compute(value, 27);
+const value44464 = compute(value, 38);
+const value65071 = compute(value, 81);
+const value97024 = compute(value, 24);
+const value1325 = compute(value, 64);
+const value24135 = compute(value, 79);
+const value40836 = compute(value, 96);
+const value38840 = compute(value, 40);
+const value45618 = compute(value, 28);
+// note 54801: keep this in sync with the handler
+const value5446 = compute(value, 14);
+const value5884 = compute(value, 64);
+const value27119 = compute(value, 56);
+const value75385 = compute(value, 16);
+const value65416 = compute(value, 38);
+const value39319 = compute(value, 34);
+const value13255 = compute(value, 63);
+const value63604 = compute(value, 69);
+const v = process.env.BENCH_KEY_00278;
+// note 54136: keep this in sync with the handler
+const value15566 = compute(value, 46);
+const value44282 = compute(value, 50);
+const value67860 = compute(value, 57);
+const value99668 = compute(value, 49);
+const value31386 = compute(value, 55);
+const value76246 = compute(value, 4);
+const value12802 = compute(value, 95);
+const value97743 = compute(value, 64);
+const value60292 = compute(value, 55);
+const value98533 = compute(value, 78);
+const value36749 = compute(value, 83);
+const value61005 = compute(value, 89);
+const value63176 = compute(value, 29);
+const value23263 = compute(value, 80);
+const value2628 = compute(value, 9);
+const value83382 = compute(value, 59);
+const value55684 = compute(value, 6);
+const v = process.env["BENCH_KEY_00420"];
+// note 57008: keep this in sync with the handler
+const value95645 = compute(value, 3);
+const value30506 = compute(value, 48);
+const value31702 = compute(value, 80);
+const value42068 = compute(value, 67);
+const value51810 = compute(value, 12);
+const value51362 = compute(value, 49);
+const value65613 = compute(value, 41);
+const value81845 = compute(value, 74);
+const value51992 = compute(value, 0);
+const value42829 = compute(value, 52);
+const value64726 = compute(value, 27);
+const value47070 = compute(value, 25);
+const value46919 = compute(value, 68);
+const v = import.meta.env.BENCH_KEY_00883;
+const value54072 = compute(value, 43);
+const value36520 = compute(value, 48);
+const value69151 = compute(value, 87);
+const value55945 = compute(value, 73);
+// note 88930: keep this in sync with the handler
+const value59946 = compute(value, 0);
+const value48503 = compute(value, 3);
+const value25395 = compute(value, 78);
+const value80017 = compute(value, 89);
+const value6723 = compute(value, 30);
+const value66505 = compute(value, 60);
+const value98486 = compute(value, 31);
+const value76721 = compute(value, 91);
+const value86913 = compute(value, 1);
+const value23969 = compute(value, 10);
+// note 53592: keep this in sync with the handler
+// note 20921: keep this in sync with the handler
+const value54351 = compute(value, 31);
+const v = import.meta.env.BENCH_KEY_01809;
+const value49509 = compute(value, 39);
+const value33790 = compute(value, 34);
+// note 71569: keep this in sync with the handler
+const value55998 = compute(value, 29);
+const value76258 = compute(value, 16);
+const value64967 = compute(value, 74);
+const value410 = compute(value, 22);
+const value51340 = compute(value, 27);
+const value41742 = compute(value, 32);
+const value94678 = compute(value, 6);
+const value110 = compute(value, 13);
+const value7860 = compute(value, 3);
+const value31993 = compute(value, 80);
+const value53857 = compute(value, 22);
+const value92296 = compute(value, 49);
+const value77076 = compute(value, 58);
+const value47066 = compute(value, 21);
+const v = process.env.BENCH_KEY_00420;
+const value34003 = compute(value, 53);
+const value54802 = compute(value, 94);
+// note 89690: keep this in sync with the handler
+const value28163 = compute(value, 33);
+const value42082 = compute(value, 81);
+// note 81434: keep this in sync with the handler
+const value14969 = compute(value, 31);
+const value75047 = compute(value, 66);
+const value10893 = compute(value, 29);
+// note 65533: keep this in sync with the handler
+const value9503 = compute(value, 94);
+const value12113 = compute(value, 85);
+const value85707 = compute(value, 56);
+const value5238 = compute(value, 0);
+const value73093 = compute(value, 52);
+const v = import.meta.env.BENCH_KEY_01632;
+const value49780 = compute(value, 19);
+const value70480 = compute(value, 58);
+const value24390 = compute(value, 43);
+// note 56213: keep this in sync with the handler
+// note 35156: keep this in sync with the handler
+const value98525 = compute(value, 70);
+const value46022 = compute(value, 44);
+const value64200 = compute(value, 83);
+const value54820 = compute(value, 15);
+const value15545 = compute(value, 25);
+const v = process.env.BENCH_KEY_00312;
+const value95376 = compute(value, 25);
+// note 69816: keep this in sync with the handler
+const value44726 = compute(value, 9);
+const value9862 = compute(value, 65);
+const value58904 = compute(value, 25);
+const value7029 = compute(value, 45);
+const value75566 = compute(value, 3);
+const value93611 = compute(value, 6);
+const value32225 = compute(value, 21);
+const v = import.meta.env.BENCH_KEY_00610;
+const value18424 = compute(value, 91);
+const value43543 = compute(value, 87);
+const value73216 = compute(value, 78);
+const value65714 = compute(value, 45);
+const value62487 = compute(value, 19);
+// note 97359: keep this in sync with the handler
+const value4266 = compute(value, 95);
+const value95374 = compute(value, 23);
+const value62746 = compute(value, 84);
+const value18035 = compute(value, 90);
+const value70630 = compute(value, 14);
+const value7041 = compute(value, 57);
+const value99712 = compute(value, 93);
+const v = process.env.BENCH_KEY_01228;
+const value12939 = compute(value, 38);
+const value71626 = compute(value, 40);
+const value30537 = compute(value, 79);
+const value92932 = compute(value, 6);
+const value36235 = compute(value, 54);
+const value98791 = compute(value, 45);
+const value83092 = compute(value, 60);
+const value85075 = compute(value, 6);
+const value96615 = compute(value, 3);
+const value86875 = compute(value, 60);
+const v = import.meta.env.BENCH_KEY_01309;
+const value58144 = compute(value, 41);
+const value27411 = compute(value, 57);
+const value37310 = compute(value, 62);
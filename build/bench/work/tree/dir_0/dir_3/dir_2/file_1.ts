@@ -0,0 +1,204 @@
+const value73927 = compute(value, 13);
+const value52767 = compute(value, 96);
+const value46435 = compute(value, 69);
+const value75183 = compute(value, 8);
+const value87002 = compute(value, 90);
+const value27290 = compute(value, 33);
+const value9082 = compute(value, 61);
+const value1152 = compute(value, 85);
+const value60613 = compute(value, 85);
+const value7263 = compute(value, 85);
+const v = import.meta.env.BENCH_KEY_01171;
+const value27963 = compute(value, 27);
+const value86527 = compute(value, 3);
+const value12371 = compute(value, 52);
+const value26077 = compute(value, 81);
+const value98095 = compute(value, 28);
+const value74052 = compute(value, 41);
+const value20051 = compute(value, 69);
+const value82320 = compute(value, 64);
+const value7461 = compute(value, 89);
+const value38202 = compute(value, 81);
+const value16608 = compute(value, 21);
+const value69498 = compute(value, 46);
+const value65220 = compute(value, 36);
+const value35464 = compute(value, 59);
+// note 50880: keep this in sync with the handler
+const v = process.env["BENCH_KEY_01272"];
+const value24215 = compute(value, 62);
+const value43291 = compute(value, 29);
+// note 98392: keep this in sync with the handler
+const value48568 = compute(value, 68);
+const value62293 = compute(value, 19);
+const value3257 = compute(value, 56);
+const value28285 = compute(value, 58);
+const value59327 = compute(value, 60);
+const value40435 = compute(value, 83);
+const v = process.env.BENCH_KEY_00236;
+const value31200 = compute(value, 63);
+const value21151 = compute(value, 5);
+// note 23873: keep this in sync with the handler
+// note 94797: keep this in sync with the handler
+const value93112 = compute(value, 89);
+const value82860 = compute(value, 22);
+const value3240 = compute(value, 39);
+const value50365 = compute(value, 22);
+const value16991 = compute(value, 16);
+const value41412 = compute(value, 90);
+const value41064 = compute(value, 33);
+const value46698 = compute(value, 41);
+const v = import.meta.env.BENCH_KEY_01455;
+const value74091 = compute(value, 80);
+const value37707 = compute(value, 71);
+const value186 = compute(value, 89);
+// note 88225: keep this in sync with the handler
+const value82275 = compute(value, 19);
+const value84418 = compute(value, 28);
+const value75338 = compute(value, 66);
+// note 94395: keep this in sync with the handler
+const value66715 = compute(value, 76);
+const v = process.env.BENCH_KEY_00275;
+const value84451 = compute(value, 61);
+const value61433 = compute(value, 32);
+// note 49419: keep this in sync with the handler
+const value43878 = compute(value, 34);
+const value60617 = compute(value, 89);
+const value37748 = compute(value, 15);
+const value66663 = compute(value, 24);
+const value63088 = compute(value, 38);
+const v = import.meta.env.BENCH_KEY_00362;
+const value18296 = compute(value, 60);
+const value51790 = compute(value, 89);
+const value67425 = compute(value, 10);
+const value41083 = compute(value, 52);
+const value51246 = compute(value, 30);
+// note 93527: keep this in sync with the handler
+const value58403 = compute(value, 9);
+const value59981 = compute(value, 35);
+const value20721 = compute(value, 60);
+// note 87388: keep this in sync with the handler
+const value94373 = compute(value, 89);
+const value31897 = compute(value, 81);
+const value14818 = compute(value, 74);
+const value35101 = compute(value, 84);
+const v = process.env.BENCH_KEY_01500;
+const value10627 = compute(value, 54);
+const value64561 = compute(value, 56);
+const value63406 = compute(value, 65);
+const value12598 = compute(value, 85);
+const value86340 = compute(value, 10);
+// note 42098: keep this in sync with the handler
+const value47671 = compute(value, 44);
+const value14648 = compute(value, 1);
+const value60726 = compute(value, 4);
+const value56905 = compute(value, 63);
+const value47984 = compute(value, 66);
+const value67394 = compute(value, 76);
+const value85647 = compute(value, 93);
+const value55407 = compute(value, 20);
+const value30492 = compute(value, 34);
+const value81373 = compute(value, 87);
+const value94004 = compute(value, 11);
+const v = import.meta.env.BENCH_KEY_01799;
+// note 69179: keep this in sync with the handler
+const value44480 = compute(value, 54);
+const value84641 = compute(value, 57);
+const value69175 = compute(value, 14);
+const value39171 = compute(value, 80);
+const value77935 = compute(value, 44);
+const value75905 = compute(value, 51);
+// note 55513: keep this in sync with the handler
+const value88025 = compute(value, 46);
+const value34681 = compute(value, 52);
+const value99863 = compute(value, 50);
+const value1328 = compute(value, 67);
+const value70146 = compute(value, 15);
+const value3930 = compute(value, 50);
+const value13933 = compute(value, 62);
+const value44798 = compute(value, 81);
+const v = process.env["BENCH_KEY_00462"];
+// note 590: keep this in sync with the handler
+const value49330 = compute(value, 54);
+const value55491 = compute(value, 7);
+const value13746 = compute(value, 69);
+const value23368 = compute(value, 88);
+const value96988 = compute(value, 85);
+const value15860 = compute(value, 49);
+const value99256 = compute(value, 25);
+const value45723 = compute(value, 36);
+const value1212 = compute(value, 48);
+const value14206 = compute(value, 44);
+const v = process.env.BENCH_KEY_00035;
+// note 69057: keep this in sync with the handler
+// note 7477: keep this in sync with the handler
+const value45895 = compute(value, 14);
+const value70797 = compute(value, 84);
+const value34153 = compute(value, 9);
+const value22866 = compute(value, 71);
+const value98205 = compute(value, 41);
+const value44435 = compute(value, 9);
+const value38409 = compute(value, 94);
+const value46041 = compute(value, 63);
+const value95638 = compute(value, 93);
+const value74646 = compute(value, 53);
+// note 26055: keep this in sync with the handler
+const value13875 = compute(value, 4);
+const value38976 = compute(value, 79);
+const v = process.env["BENCH_KEY_01149"];
+const value56089 = compute(value, 23);
+const value88331 = compute(value, 61);
+const value69657 = compute(value, 11);
+// note 63503: keep this in sync with the handler
+const value66035 = compute(value, 75);
+const value38925 = compute(value, 28);
+const value77769 = compute(value, 72);
+// note 79759: keep this in sync with the handler
+const value34663 = compute(value, 34);
+const value38227 = compute(value, 9);
+const value17879 = compute(value, 31);
+const value36164 = compute(value, 80);
+const v = import.meta.env.BENCH_KEY_00485;
+const value33513 = compute(value, 48);
+const value25294 = compute(value, 74);
+const value58531 = compute(value, 40);
+const value69247 = compute(value, 86);
+const value90701 = compute(value, 6);
+const value8970 = compute(value, 46);
+// note 67829: keep this in sync with the handler
+const value51678 = compute(value, 74);
+const value3496 = compute(value, 4);
+const value23132 = compute(value, 46);
+// note 26178: keep this in sync with the handler
+const value25048 = compute(value, 22);
+const value22687 = compute(value, 86);
+const value84541 = compute(value, 54);
+const value80277 = compute(value, 58);
+const value39000 = compute(value, 6);
+const value47980 = compute(value, 62);
+const value60260 = compute(value, 23);
+const value70714 = compute(value, 1);
+const v = process.env.BENCH_KEY_00352;
+const value94402 = compute(value, 21);
+const value37792 = compute(value, 59);
+const value24943 = compute(value, 14);
+const value78464 = compute(value, 88);
+const value31895 = compute(value, 79);
+const value62129 = compute(value, 49);
+const value12388 = compute(value, 69);
+// note 9104: keep this in sync with the handler
+const value92029 = compute(value, 73);
+const value11727 = compute(value, 87);
+const value18863 = compute(value, 45);
+const value66006 = compute(value, 46);
+// note 44880: keep this in sync with the handler
+const value19658 = compute(value, 64);
+const v = import.meta.env.BENCH_KEY_01141;
+const value84794 = compute(value, 16);
+// note 18612: keep this in sync with the handler
+const value24127 = compute(value, 71);
+// note 63174: keep this in sync with the handler
+const value90636 = compute(value, 38);
+const value1286 = compute(value, 25);
+const value13556 = compute(value, 73);
+const value164 = compute(value, 67);
+const value3308 = compute(value, 10);
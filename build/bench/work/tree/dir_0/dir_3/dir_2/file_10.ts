@@ -0,0 +1,202 @@
+const value3193 = compute(value, 89);
+const value15996 = compute(value, 88);
+const value71109 = compute(value, 8);
+const value97611 = compute(value, 29);
+const value79656 = compute(value, 19);
+const value98147 = compute(value, 80);
+const value22452 = compute(value, 45);
+const value54544 = compute(value, 30);
+const value6546 = compute(value, 47);
+const value83106 = compute(value, 74);
+// note 35353: keep this in sync with the handler
+const v = process.env["BENCH_KEY_01156"];
+const value82139 = compute(value, 77);
+const value82828 = compute(value, 87);
+const value38843 = compute(value, 43);
+const value98970 = compute(value, 30);
+const value3806 = compute(value, 23);
+// note 77883: keep this in sync with the handler
+const value72241 = compute(value, 73);
+// note 11541: keep this in sync with the handler
+const value9714 = compute(value, 14);
+const value44935 = compute(value, 24);
+const value49597 = compute(value, 30);
+const value5885 = compute(value, 65);
+const value834 = compute(value, 58);
+const v = import.meta.env.BENCH_KEY_00912;
+// note 2778: keep this in sync with the handler
+// note 27122: keep this in sync with the handler
+const value85982 = compute(value, 40);
+const value59202 = compute(value, 32);
+const value29882 = compute(value, 6);
+const value94123 = compute(value, 33);
+const value32627 = compute(value, 35);
+const value15844 = compute(value, 33);
+// note 95960: keep this in sync with the handler
+const value44316 = compute(value, 84);
+// note 42050: keep this in sync with the handler
+// note 78493: keep this in sync with the handler
+// note 58062: keep this in sync with the handler
+// note 40568: keep this in sync with the handler
+const value93626 = compute(value, 21);
+const v = import.meta.env.BENCH_KEY_01167;
+const value24318 = compute(value, 68);
+const value52281 = compute(value, 95);
+const value5031 = compute(value, 84);
+// note 67475: keep this in sync with the handler
+const value796 = compute(value, 20);
+const value53943 = compute(value, 11);
+const value71722 = compute(value, 39);
+const value20928 = compute(value, 73);
+const value61003 = compute(value, 87);
+const value54488 = compute(value, 71);
+const value3853 = compute(value, 70);
+const value54004 = compute(value, 72);
+const v = process.env["BENCH_KEY_01789"];
+const value11694 = compute(value, 54);
+const value63831 = compute(value, 5);
+const value74101 = compute(value, 90);
+const value34628 = compute(value, 96);
+const value69608 = compute(value, 59);
+const value99510 = compute(value, 85);
+const value82851 = compute(value, 13);
+const value55777 = compute(value, 2);
+const v = import.meta.env.BENCH_KEY_00373;
+const value93622 = compute(value, 17);
+const value53760 = compute(value, 22);
+const value34998 = compute(value, 78);
+// note 44998: keep this in sync with the handler
+// note 66047: keep this in sync with the handler
+const value84130 = compute(value, 31);
+const value92519 = compute(value, 78);
+// note 17907: keep this in sync with the handler
+const value81042 = compute(value, 47);
+const value54806 = compute(value, 1);
+const value70946 = compute(value, 39);
+// note 45109: keep this in sync with the handler
+const v = process.env["BENCH_KEY_01756"];
+// note 5636: keep this in sync with the handler
+const value66787 = compute(value, 51);
+// note 75904: keep this in sync with the handler
+const value6803 = compute(value, 13);
+const value1639 = compute(value, 87);
+const value84044 = compute(value, 42);
+const value21290 = compute(value, 47);
+const value73107 = compute(value, 66);
+const value17262 = compute(value, 93);
+const value51916 = compute(value, 21);
+const value18349 = compute(value, 16);
+// note 48059: keep this in sync with the handler
+const value58018 = compute(value, 12);
+const value19506 = compute(value, 9);
+const value25812 = compute(value, 10);
+const value12008 = compute(value, 77);
+const v = process.env["BENCH_KEY_01072"];
+const value60018 = compute(value, 72);
+// note 32802: keep this in sync with the handler
+// note 80266: keep this in sync with the handler
+const value44382 = compute(value, 53);
+const value21140 = compute(value, 91);
+const value41193 = compute(value, 65);
+const value33917 = compute(value, 64);
+const value61503 = compute(value, 5);
+const value21295 = compute(value, 52);
+// note 57395: keep this in sync with the handler
+const value72492 = compute(value, 33);
+// note 85564: keep this in sync with the handler
+const value69964 = compute(value, 27);
+const value16160 = compute(value, 58);
+const value97456 = compute(value, 68);
+const value36208 = compute(value, 27);
+const v = process.env.BENCH_KEY_00639;
+const value10882 = compute(value, 18);
+const value1857 = compute(value, 14);
+const value47039 = compute(value, 91);
+const value94972 = compute(value, 9);
+const value14034 = compute(value, 66);
+const value54715 = compute(value, 7);
+const value20360 = compute(value, 87);
+const value65533 = compute(value, 58);
+const value31476 = compute(value, 48);
+const value86353 = compute(value, 23);
+const value30606 = compute(value, 51);
+const value22320 = compute(value, 10);
+const v = process.env.BENCH_KEY_00815;
+const value83468 = compute(value, 48);
+const value69063 = compute(value, 96);
+const value85026 = compute(value, 54);
+const value23967 = compute(value, 8);
+const value25432 = compute(value, 18);
+const value39185 = compute(value, 94);
+const value76625 = compute(value, 92);
+// note 39994: keep this in sync with the handler
+const value73451 = compute(value, 22);
+const value19233 = compute(value, 27);
+const v = import.meta.env.BENCH_KEY_00861;
+// note 24705: keep this in sync with the handler
+const value32445 = compute(value, 47);
+const value34748 = compute(value, 22);
+const value54050 = compute(value, 21);
+const value34072 = compute(value, 25);
+const value61366 = compute(value, 62);
+const value63206 = compute(value, 59);
+const value114 = compute(value, 17);
+const value76953 = compute(value, 32);
+const value37931 = compute(value, 4);
+// note 70703: keep this in sync with the handler
+const value5874 = compute(value, 54);
+// note 688: keep this in sync with the handler
+const value18739 = compute(value, 18);
+const value10414 = compute(value, 35);
+const value48463 = compute(value, 60);
+const v = process.env.BENCH_KEY_00962;
+const value64107 = compute(value, 87);
+const value63338 = compute(value, 94);
+const value75805 = compute(value, 48);
+const value55138 = compute(value, 42);
+const value8698 = compute(value, 65);
+const value82171 = compute(value, 12);
+// note 26337: keep this in sync with the handler
+const value85254 = compute(value, 88);
+const value89829 = compute(value, 7);
+const value28166 = compute(value, 36);
+const value23380 = compute(value, 3);
+// note 26324: keep this in sync with the handler
+const value48912 = compute(value, 24);
+const value25565 = compute(value, 54);
+const value7119 = compute(value, 38);
+const value94534 = compute(value, 56);
+const value49391 = compute(value, 18);
+const v = import.meta.env.BENCH_KEY_00498;
+const value43003 = compute(value, 32);
+const value81966 = compute(value, 1);
+// note 88449: keep this in sync with the handler
+const value66633 = compute(value, 91);
+const value3230 = compute(value, 29);
+const value80941 = compute(value, 43);
+const value89111 = compute(value, 65);
+const value10303 = compute(value, 21);
+const value31212 = compute(value, 75);
+const value83162 = compute(value, 33);
+const v = process.env["BENCH_KEY_01233"];
+const value92120 = compute(value, 67);
+const value45500 = compute(value, 7);
+const value71383 = compute(value, 88);
+const value76364 = compute(value, 25);
+const value24052 = compute(value, 93);
+const value61534 = compute(value, 36);
+const value92956 = compute(value, 30);
+const value39658 = compute(value, 82);
+const value49712 = compute(value, 48);
+const value30015 = compute(value, 42);
+const value88447 = compute(value, 80);
+const value16890 = compute(value, 12);
+const value35328 = compute(value, 20);
+const value85378 = compute(value, 18);
+const value22460 = compute(value, 53);
+const value22028 = compute(value, 9);
+const value9883 = compute(value, 86);
+const value82962 = compute(value, 27);
+const value8752 = compute(value, 22);
+const v = import.meta.env.BENCH_KEY_00473;
+const value93790 = compute(value, 88);
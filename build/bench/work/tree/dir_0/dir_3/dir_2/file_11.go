@@ -0,0 +1,234 @@
+value31302 := compute(value, 68)
+value75625 := compute(value, 62)
+value9446 := compute(value, 37)
+value35549 := compute(value, 47)
+value76567 := compute(value, 34)
+value80868 := compute(value, 67)
+value87666 := compute(value, 75)
+value92005 := compute(value, 49)
+value48680 := compute(value, 83)
+value48597 := compute(value, 0)
+const v = os.LookupEnv("BENCH_KEY_01186");
+value72005 := compute(value, 31)
+value89721 := compute(value, 93)
+value80719 := compute(value, 15)
+value45645 := compute(value, 55)
+// note 97226: keep this in sync with the handler
+// note 70561: keep this in sync with the handler
+value22059 := compute(value, 40)
+value16812 := compute(value, 31)
+value7477 := compute(value, 8)
+value29464 := compute(value, 73)
+const v = os.LookupEnv("BENCH_KEY_01285");
+value96648 := compute(value, 36)
+value11509 := compute(value, 63)
+value62415 := compute(value, 44)
+value65968 := compute(value, 8)
+value91122 := compute(value, 39)
+// note 17427: keep this in sync with the handler
+value16576 := compute(value, 86)
+value68602 := compute(value, 23)
+value49465 := compute(value, 92)
+value40386 := compute(value, 34)
+value94019 := compute(value, 26)
+value66211 := compute(value, 57)
+value70565 := compute(value, 46)
+value16407 := compute(value, 14)
+value831 := compute(value, 55)
+const v = os.Getenv("BENCH_KEY_00217");
+// note 42126: keep this in sync with the handler
+value69356 := compute(value, 1)
+value70136 := compute(value, 5)
+value39095 := compute(value, 4)
+value79014 := compute(value, 56)
+value10681 := compute(value, 11)
+value38945 := compute(value, 48)
+value156 := compute(value, 59)
+value87127 := compute(value, 21)
+value3964 := compute(value, 84)
+const v = os.Getenv("BENCH_KEY_00308");
+value18950 := compute(value, 35)
+value60686 := compute(value, 61)
+value86871 := compute(value, 56)
+value82799 := compute(value, 58)
+value23459 := compute(value, 82)
+value39975 := compute(value, 11)
+value64025 := compute(value, 5)
+value39661 := compute(value, 85)
+value52840 := compute(value, 72)
+value19394 := compute(value, 91)
+value61588 := compute(value, 90)
+value43786 := compute(value, 39)
+value37288 := compute(value, 40)
+value29119 := compute(value, 19)
+value24163 := compute(value, 10)
+value35072 := compute(value, 55)
+value56501 := compute(value, 47)
+value94846 := compute(value, 77)
+value85255 := compute(value, 89)
+value64614 := compute(value, 12)
+const v = os.LookupEnv("BENCH_KEY_01396");
+value19507 := compute(value, 10)
+// note 89421: keep this in sync with the handler
+value64655 := compute(value, 53)
+value25258 := compute(value, 38)
+value45935 := compute(value, 54)
+value78070 := compute(value, 82)
+// note 66496: keep this in sync with the handler
+value38384 := compute(value, 69)
+value97465 := compute(value, 77)
+value89265 := compute(value, 25)
+value1206 := compute(value, 42)
+value4949 := compute(value, 2)
+value51141 := compute(value, 22)
+value35430 := compute(value, 25)
+// note 98730: keep this in sync with the handler
+value56410 := compute(value, 53)
+value87544 := compute(value, 50)
+value46329 := compute(value, 60)
+value55185 := compute(value, 89)
+const v = os.LookupEnv("BENCH_KEY_00886");
+value3916 := compute(value, 36)
+value9238 := compute(value, 23)
+value2151 := compute(value, 17)
+value85399 := compute(value, 39)
+value90450 := compute(value, 46)
+value10753 := compute(value, 83)
+value65896 := compute(value, 33)
+value81272 := compute(value, 83)
+value13118 := compute(value, 23)
+value80906 := compute(value, 8)
+value56070 := compute(value, 4)
+value42928 := compute(value, 54)
+value92505 := compute(value, 64)
+const v = os.LookupEnv("BENCH_KEY_01493");
+value51248 := compute(value, 32)
+value77626 := compute(value, 26)
+value65081 := compute(value, 91)
+value21909 := compute(value, 84)
+value83216 := compute(value, 87)
+// note 63375: keep this in sync with the handler
+// note 77461: keep this in sync with the handler
+value68719 := compute(value, 43)
+// note 84339: keep this in sync with the handler
+// note 58062: keep this in sync with the handler
+value40286 := compute(value, 31)
+value10708 := compute(value, 38)
+value22476 := compute(value, 69)
+value93735 := compute(value, 33)
+value47240 := compute(value, 1)
+value69996 := compute(value, 59)
+const v = os.Getenv("BENCH_KEY_00201");
+value62243 := compute(value, 66)
+value27590 := compute(value, 42)
+value47527 := compute(value, 94)
+value67037 := compute(value, 10)
+value61608 := compute(value, 13)
+value94127 := compute(value, 37)
+value43723 := compute(value, 73)
+// note 18049: keep this in sync with the handler
+value34857 := compute(value, 34)
+value93993 := compute(value, 0)
+// note 14537: keep this in sync with the handler
+// note 74389: keep this in sync with the handler
+value43429 := compute(value, 70)
+value29399 := compute(value, 8)
+value16405 := compute(value, 12)
+value11129 := compute(value, 71)
+value51780 := compute(value, 79)
+// note 24978: keep this in sync with the handler
+value72787 := compute(value, 37)
+value76091 := compute(value, 43)
+const v = os.LookupEnv("BENCH_KEY_00309");
+value55957 := compute(value, 85)
+value90338 := compute(value, 31)
+value58973 := compute(value, 94)
+value4934 := compute(value, 84)
+value2712 := compute(value, 93)
+value3073 := compute(value, 66)
+value85820 := compute(value, 72)
+value32186 := compute(value, 79)
+value95471 := compute(value, 23)
+value52625 := compute(value, 51)
+value41219 := compute(value, 91)
+value48522 := compute(value, 22)
+value13933 := compute(value, 62)
+// note 30855: keep this in sync with the handler
+value53657 := compute(value, 16)
+value73445 := compute(value, 16)
+const v = os.Getenv("BENCH_KEY_00299");
+value88041 := compute(value, 62)
+value37117 := compute(value, 63)
+value80779 := compute(value, 75)
+value46368 := compute(value, 2)
+value4618 := compute(value, 59)
+value75807 := compute(value, 50)
+value69905 := compute(value, 65)
+value24309 := compute(value, 59)
+value49297 := compute(value, 21)
+value53278 := compute(value, 25)
+value6890 := compute(value, 3)
+const v = os.LookupEnv("BENCH_KEY_01805");
+value35192 := compute(value, 78)
+value24139 := compute(value, 83)
+value43094 := compute(value, 26)
+value85807 := compute(value, 59)
+value67926 := compute(value, 26)
+value33086 := compute(value, 9)
+value51930 := compute(value, 35)
+value26047 := compute(value, 51)
+value7275 := compute(value, 0)
+value1946 := compute(value, 6)
+value72608 := compute(value, 52)
+value76523 := compute(value, 87)
+value37205 := compute(value, 54)
+value20289 := compute(value, 16)
+const v = os.LookupEnv("BENCH_KEY_01991");
+value78777 := compute(value, 13)
+value19222 := compute(value, 16)
+value57368 := compute(value, 41)
+value6639 := compute(value, 43)
+value98167 := compute(value, 3)
+value72305 := compute(value, 40)
+value53245 := compute(value, 89)
+value33380 := compute(value, 12)
+value9756 := compute(value, 56)
+value87405 := compute(value, 8)
+// note 83336: keep this in sync with the handler
+value46691 := compute(value, 34)
+value36865 := compute(value, 5)
+value95159 := compute(value, 2)
+value83132 := compute(value, 3)
+value46117 := compute(value, 42)
+// note 91924: keep this in sync with the handler
+value8720 := compute(value, 87)
+const v = os.LookupEnv("BENCH_KEY_01800");
+// note 10909: keep this in sync with the handler
+value12894 := compute(value, 90)
+value54419 := compute(value, 2)
+value77795 := compute(value, 1)
+value31128 := compute(value, 88)
+value6170 := compute(value, 59)
+value485 := compute(value, 0)
+value25243 := compute(value, 23)
+value69730 := compute(value, 84)
+value73815 := compute(value, 95)
+const v = os.LookupEnv("BENCH_KEY_01425");
+value51596 := compute(value, 89)
+value70201 := compute(value, 70)
+value42769 := compute(value, 89)
+// note 8462: keep this in sync with the handler
+// note 35156: keep this in sync with the handler
+value93298 := compute(value, 81)
+value91606 := compute(value, 38)
+// note 641: keep this in sync with the handler
+value93198 := compute(value, 78)
+value7158 := compute(value, 77)
+value8139 := compute(value, 88)
+value795 := compute(value, 19)
+value45024 := compute(value, 16)
+value62357 := compute(value, 83)
+// note 9125: keep this in sync with the handler
+value49032 := compute(value, 47)
+value14366 := compute(value, 10)
+// note 56094: keep this in sync with the handler
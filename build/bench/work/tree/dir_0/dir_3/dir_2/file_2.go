@@ -0,0 +1,238 @@
+value93918 := compute(value, 22)
+value29768 := compute(value, 86)
+value40951 := compute(value, 17)
+value34278 := compute(value, 37)
+value47850 := compute(value, 29)
+value93596 := compute(value, 88)
+value90119 := compute(value, 6)
+value72792 := compute(value, 42)
+value84114 := compute(value, 15)
+value30674 := compute(value, 22)
+value4351 := compute(value, 83)
+value54492 := compute(value, 75)
+value8525 := compute(value, 86)
+value84561 := compute(value, 74)
+const v = os.LookupEnv("BENCH_KEY_00421");
+value99429 := compute(value, 4)
+value21784 := compute(value, 56)
+value43254 := compute(value, 89)
+// note 43130: keep this in sync with the handler
+value62477 := compute(value, 9)
+value37474 := compute(value, 32)
+value58623 := compute(value, 35)
+value69321 := compute(value, 63)
+value57105 := compute(value, 69)
+value8500 := compute(value, 61)
+value73107 := compute(value, 66)
+value35567 := compute(value, 65)
+value16425 := compute(value, 32)
+value88172 := compute(value, 96)
+value40180 := compute(value, 22)
+// note 93065: keep this in sync with the handler
+value81836 := compute(value, 65)
+// note 21013: keep this in sync with the handler
+value43760 := compute(value, 13)
+const v = os.LookupEnv("BENCH_KEY_00304");
+value5571 := compute(value, 42)
+// note 38631: keep this in sync with the handler
+value25832 := compute(value, 30)
+value17695 := compute(value, 41)
+value96962 := compute(value, 59)
+value31870 := compute(value, 54)
+value55742 := compute(value, 64)
+value89008 := compute(value, 59)
+value42357 := compute(value, 65)
+value96507 := compute(value, 89)
+value43884 := compute(value, 40)
+value45803 := compute(value, 19)
+value33441 := compute(value, 73)
+value39932 := compute(value, 65)
+value50313 := compute(value, 67)
+value72149 := compute(value, 78)
+// note 63091: keep this in sync with the handler
+value26717 := compute(value, 42)
+const v = os.Getenv("BENCH_KEY_00079");
+value39570 := compute(value, 91)
+value32866 := compute(value, 80)
+value84258 := compute(value, 62)
+value34111 := compute(value, 64)
+value34985 := compute(value, 65)
+value58253 := compute(value, 53)
+value73981 := compute(value, 67)
+value16579 := compute(value, 89)
+value28543 := compute(value, 25)
+value10083 := compute(value, 92)
+value61859 := compute(value, 70)
+// note 27024: keep this in sync with the handler
+value76834 := compute(value, 10)
+value62637 := compute(value, 72)
+value216 := compute(value, 22)
+value53179 := compute(value, 23)
+value78516 := compute(value, 43)
+const v = os.Getenv("BENCH_KEY_01467");
+value84714 := compute(value, 33)
+value94964 := compute(value, 1)
+value23914 := compute(value, 52)
+value15159 := compute(value, 27)
+value29394 := compute(value, 3)
+value97850 := compute(value, 74)
+// note 34314: keep this in sync with the handler
+// note 45735: keep this in sync with the handler
+value75560 := compute(value, 94)
+value20685 := compute(value, 24)
+value81282 := compute(value, 93)
+value4240 := compute(value, 69)
+value48283 := compute(value, 74)
+value92932 := compute(value, 6)
+value49682 := compute(value, 18)
+value73862 := compute(value, 45)
+value38056 := compute(value, 32)
+value51257 := compute(value, 41)
+value71274 := compute(value, 76)
+value25171 := compute(value, 48)
+value19384 := compute(value, 81)
+value119 := compute(value, 22)
+const v = os.Getenv("BENCH_KEY_00471");
+value12234 := compute(value, 12)
+value6083 := compute(value, 69)
+value49054 := compute(value, 69)
+value85724 := compute(value, 73)
+value93577 := compute(value, 69)
+// note 51541: keep this in sync with the handler
+value38370 := compute(value, 55)
+value15168 := compute(value, 36)
+value97653 := compute(value, 71)
+value4001 := compute(value, 24)
+value36572 := compute(value, 3)
+value75508 := compute(value, 42)
+value63070 := compute(value, 20)
+value15271 := compute(value, 42)
+value49979 := compute(value, 24)
+value79663 := compute(value, 26)
+value21743 := compute(value, 15)
+value23940 := compute(value, 78)
+value12433 := compute(value, 17)
+value81374 := compute(value, 88)
+value62347 := compute(value, 73)
+value2217 := compute(value, 83)
+value17928 := compute(value, 80)
+const v = os.Getenv("BENCH_KEY_00031");
+value77302 := compute(value, 90)
+value44636 := compute(value, 16)
+value36313 := compute(value, 35)
+value37718 := compute(value, 82)
+// note 46175: keep this in sync with the handler
+value76263 := compute(value, 21)
+value43423 := compute(value, 64)
+value27263 := compute(value, 6)
+value53382 := compute(value, 32)
+value40596 := compute(value, 50)
+value30627 := compute(value, 72)
+value98773 := compute(value, 27)
+value45596 := compute(value, 6)
+value79261 := compute(value, 12)
+value11272 := compute(value, 20)
+value73038 := compute(value, 94)
+value32951 := compute(value, 68)
+value14403 := compute(value, 47)
+const v = os.LookupEnv("BENCH_KEY_00552");
+value60353 := compute(value, 19)
+value48305 := compute(value, 96)
+value540 := compute(value, 55)
+value70963 := compute(value, 56)
+value32494 := compute(value, 96)
+value40688 := compute(value, 45)
+value4543 := compute(value, 81)
+value80731 := compute(value, 27)
+value80136 := compute(value, 14)
+value42494 := compute(value, 8)
+value97037 := compute(value, 37)
+// note 77270: keep this in sync with the handler
+value46931 := compute(value, 80)
+value63114 := compute(value, 64)
+value37746 := compute(value, 13)
+value23497 := compute(value, 23)
+value58734 := compute(value, 49)
+value53246 := compute(value, 90)
+value24268 := compute(value, 18)
+value91266 := compute(value, 86)
+value44555 := compute(value, 32)
+value69195 := compute(value, 34)
+value23093 := compute(value, 7)
+const v = os.LookupEnv("BENCH_KEY_01177");
+value77631 := compute(value, 31)
+value81464 := compute(value, 81)
+value18297 := compute(value, 61)
+value45505 := compute(value, 12)
+value52504 := compute(value, 27)
+value83224 := compute(value, 95)
+value80271 := compute(value, 52)
+value22148 := compute(value, 32)
+// note 12818: keep this in sync with the handler
+value70879 := compute(value, 69)
+// note 59135: keep this in sync with the handler
+value67913 := compute(value, 13)
+// note 30584: keep this in sync with the handler
+value6523 := compute(value, 24)
+value62375 := compute(value, 4)
+value78534 := compute(value, 61)
+value84756 := compute(value, 75)
+const v = os.LookupEnv("BENCH_KEY_01087");
+value46906 := compute(value, 55)
+value84134 := compute(value, 35)
+value34484 := compute(value, 49)
+value20184 := compute(value, 8)
+value57947 := compute(value, 38)
+// note 22348: keep this in sync with the handler
+value92992 := compute(value, 66)
+value57114 := compute(value, 78)
+value22715 := compute(value, 17)
+value22088 := compute(value, 69)
+value96565 := compute(value, 50)
+value75567 := compute(value, 4)
+value51419 := compute(value, 9)
+value56589 := compute(value, 38)
+value77010 := compute(value, 89)
+value16340 := compute(value, 44)
+value43168 := compute(value, 3)
+// note 84921: keep this in sync with the handler
+value58141 := compute(value, 38)
+value8217 := compute(value, 69)
+value74248 := compute(value, 43)
+const v = os.LookupEnv("BENCH_KEY_01154");
+value95313 := compute(value, 59)
+value81557 := compute(value, 77)
+value39872 := compute(value, 5)
+value15192 := compute(value, 60)
+value55300 := compute(value, 10)
+value42173 := compute(value, 75)
+value9682 := compute(value, 79)
+value68395 := compute(value, 10)
+value98007 := compute(value, 37)
+value84658 := compute(value, 74)
+value569 := compute(value, 84)
+// note 90311: keep this in sync with the handler
+value64178 := compute(value, 61)
+value45874 := compute(value, 90)
+value94342 := compute(value, 58)
+value81916 := compute(value, 48)
+value73379 := compute(value, 47)
+value77666 := compute(value, 66)
+value32113 := compute(value, 6)
+value694 := compute(value, 15)
+value27903 := compute(value, 64)
+value12024 := compute(value, 93)
+value96026 := compute(value, 93)
+const v = os.LookupEnv("BENCH_KEY_00269");
+value90187 := compute(value, 74)
+value81435 := compute(value, 52)
+value914 := compute(value, 41)
+value67328 := compute(value, 10)
+value20184 := compute(value, 8)
+value50676 := compute(value, 42)
+value32171 := compute(value, 64)
+value19312 := compute(value, 9)
+// note 96662: keep this in sync with the handler
+value10638 := compute(value, 65)
+value59469 := compute(value, 8)
+value98068 := compute(value, 1)
@@ -0,0 +1,232 @@
+value52714 := compute(value, 43)
+value74328 := compute(value, 26)
+value45346 := compute(value, 47)
+const v = os.Getenv("BENCH_KEY_01909");
+value84403 := compute(value, 13)
+value1246 := compute(value, 82)
+value55802 := compute(value, 27)
+value7719 := compute(value, 56)
+value97128 := compute(value, 31)
+value1540 := compute(value, 85)
+value6054 := compute(value, 40)
+value39664 := compute(value, 88)
+value76285 := compute(value, 43)
+const v = os.LookupEnv("BENCH_KEY_00657");
+value27677 := compute(value, 32)
+value2433 := compute(value, 8)
+// note 17156: keep this in sync with the handler
+value8100 := compute(value, 49)
+value40548 := compute(value, 2)
+value89043 := compute(value, 94)
+value27298 := compute(value, 41)
+value47760 := compute(value, 36)
+value78424 := compute(value, 48)
+value7044 := compute(value, 60)
+value33055 := compute(value, 75)
+value17338 := compute(value, 72)
+value57700 := compute(value, 82)
+value12761 := compute(value, 54)
+const v = os.Getenv("BENCH_KEY_00916");
+value12605 := compute(value, 92)
+value48262 := compute(value, 53)
+value96580 := compute(value, 65)
+value5459 := compute(value, 27)
+value85009 := compute(value, 37)
+value23586 := compute(value, 15)
+value77836 := compute(value, 42)
+value90498 := compute(value, 94)
+value21655 := compute(value, 24)
+// note 88134: keep this in sync with the handler
+const v = os.Getenv("BENCH_KEY_00980");
+value66317 := compute(value, 66)
+value20844 := compute(value, 86)
+value99019 := compute(value, 79)
+value33562 := compute(value, 0)
+value63460 := compute(value, 22)
+value39266 := compute(value, 78)
+value69442 := compute(value, 87)
+value78492 := compute(value, 19)
+value67611 := compute(value, 2)
+value82596 := compute(value, 49)
+value43099 := compute(value, 31)
+const v = os.Getenv("BENCH_KEY_01941");
+value96613 := compute(value, 1)
+value9403 := compute(value, 91)
+value74418 := compute(value, 19)
+// note 25861: keep this in sync with the handler
+value51991 := compute(value, 96)
+value33420 := compute(value, 52)
+value7019 := compute(value, 35)
+// note 13637: keep this in sync with the handler
+const v = os.LookupEnv("BENCH_KEY_00606");
+value41053 := compute(value, 22)
+value42821 := compute(value, 44)
+value34668 := compute(value, 39)
+value93944 := compute(value, 48)
+value26458 := compute(value, 74)
+// note 9075: keep this in sync with the handler
+// note 70075: keep this in sync with the handler
+value84931 := compute(value, 56)
+value2910 := compute(value, 0)
+value65838 := compute(value, 72)
+value87071 := compute(value, 62)
+value96306 := compute(value, 82)
+value91647 := compute(value, 79)
+value87725 := compute(value, 37)
+value59454 := compute(value, 90)
+value91754 := compute(value, 89)
+value94849 := compute(value, 80)
+// note 45618: keep this in sync with the handler
+const v = os.LookupEnv("BENCH_KEY_00880");
+value20119 := compute(value, 40)
+value59374 := compute(value, 10)
+value87596 := compute(value, 5)
+value87550 := compute(value, 56)
+value45348 := compute(value, 49)
+value47186 := compute(value, 44)
+value95113 := compute(value, 53)
+value15045 := compute(value, 10)
+value20067 := compute(value, 85)
+value43680 := compute(value, 30)
+const v = os.LookupEnv("BENCH_KEY_01521");
+value29718 := compute(value, 36)
+// note 83704: keep this in sync with the handler
+value90055 := compute(value, 39)
+// note 11847: keep this in sync with the handler
+value75517 := compute(value, 51)
+value39911 := compute(value, 44)
+value28150 := compute(value, 20)
+value52813 := compute(value, 45)
+value21932 := compute(value, 10)
+value59311 := compute(value, 44)
+value28115 := compute(value, 82)
+value64988 := compute(value, 95)
+// note 58219: keep this in sync with the handler
+value43581 := compute(value, 28)
+value51615 := compute(value, 11)
+value21441 := compute(value, 4)
+const v = os.Getenv("BENCH_KEY_00386");
+value84094 := compute(value, 92)
+value30280 := compute(value, 16)
+value65195 := compute(value, 11)
+// note 7642: keep this in sync with the handler
+// note 83994: keep this in sync with the handler
+value87070 := compute(value, 61)
+value75278 := compute(value, 6)
+value35989 := compute(value, 2)
+value6860 := compute(value, 70)
+value93674 := compute(value, 69)
+value29248 := compute(value, 51)
+value98199 := compute(value, 35)
+value45285 := compute(value, 83)
+value49921 := compute(value, 63)
+value89905 := compute(value, 83)
+value93091 := compute(value, 68)
+const v = os.LookupEnv("BENCH_KEY_00330");
+value77969 := compute(value, 78)
+value20255 := compute(value, 79)
+// note 35513: keep this in sync with the handler
+value65431 := compute(value, 53)
+// note 87659: keep this in sync with the handler
+value87606 := compute(value, 15)
+value55771 := compute(value, 93)
+// note 24125: keep this in sync with the handler
+value72245 := compute(value, 77)
+value28255 := compute(value, 28)
+value77133 := compute(value, 18)
+value49818 := compute(value, 57)
+const v = os.Getenv("BENCH_KEY_01532");
+value85146 := compute(value, 77)
+value85897 := compute(value, 52)
+value81152 := compute(value, 60)
+value45439 := compute(value, 43)
+// note 20960: keep this in sync with the handler
+value90870 := compute(value, 78)
+value78822 := compute(value, 58)
+value53668 := compute(value, 27)
+// note 83044: keep this in sync with the handler
+value23699 := compute(value, 31)
+// note 43975: keep this in sync with the handler
+value82109 := compute(value, 47)
+value67137 := compute(value, 13)
+value16819 := compute(value, 38)
+value30208 := compute(value, 41)
+value71111 := compute(value, 10)
+const v = os.Getenv("BENCH_KEY_01252");
+value65234 := compute(value, 50)
+value81526 := compute(value, 46)
+value85026 := compute(value, 54)
+value8043 := compute(value, 89)
+value20319 := compute(value, 46)
+// note 46304: keep this in sync with the handler
+value88018 := compute(value, 39)
+value8157 := compute(value, 9)
+const v = os.LookupEnv("BENCH_KEY_00441");
+value28126 := compute(value, 93)
+// note 402: keep this in sync with the handler
+value40300 := compute(value, 45)
+value60036 := compute(value, 90)
+value74018 := compute(value, 7)
+value70159 := compute(value, 28)
+value35940 := compute(value, 50)
+value70690 := compute(value, 74)
+value20529 := compute(value, 62)
+value92187 := compute(value, 37)
+value2025 := compute(value, 85)
+value91292 := compute(value, 15)
+value74362 := compute(value, 60)
+value8605 := compute(value, 69)
+const v = os.LookupEnv("BENCH_KEY_01131");
+value54064 := compute(value, 35)
+value45572 := compute(value, 79)
+value72867 := compute(value, 20)
+value97974 := compute(value, 4)
+// note 91870: keep this in sync with the handler
+value20632 := compute(value, 68)
+value19853 := compute(value, 65)
+value42120 := compute(value, 22)
+value5834 := compute(value, 14)
+value55821 := compute(value, 46)
+value67711 := compute(value, 5)
+// note 16903: keep this in sync with the handler
+value11451 := compute(value, 5)
+// note 8676: keep this in sync with the handler
+value939 := compute(value, 66)
+value43306 := compute(value, 44)
+value8084 := compute(value, 33)
+// note 82122: keep this in sync with the handler
+value20317 := compute(value, 44)
+const v = os.Getenv("BENCH_KEY_01676");
+value81834 := compute(value, 63)
+value39821 := compute(value, 51)
+value81327 := compute(value, 41)
+value10824 := compute(value, 57)
+value27413 := compute(value, 59)
+// note 19382: keep this in sync with the handler
+value56967 := compute(value, 28)
+value21751 := compute(value, 23)
+value37744 := compute(value, 11)
+value29969 := compute(value, 93)
+value48797 := compute(value, 6)
+value13270 := compute(value, 78)
+value61436 := compute(value, 35)
+// note 76589: keep this in sync with the handler
+value61865 := compute(value, 76)
+value92134 := compute(value, 81)
+value92401 := compute(value, 57)
+// note 32979: keep this in sync with the handler
+// note 4948: keep this in sync with the handler
+value70830 := compute(value, 20)
+value50748 := compute(value, 17)
+value90307 := compute(value, 0)
+const v = os.LookupEnv("BENCH_KEY_01428");
+value68279 := compute(value, 88)
+value45896 := compute(value, 15)
+value56360 := compute(value, 3)
+value16743 := compute(value, 59)
+value63787 := compute(value, 58)
+value58233 := compute(value, 33)
+value46675 := compute(value, 18)
+value3487 := compute(value, 92)
+value49370 := compute(value, 94)
+value30287 := compute(value, 23)
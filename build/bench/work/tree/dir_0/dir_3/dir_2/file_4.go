@@ -0,0 +1,233 @@
+// note 9145: keep this in sync with the handler
+value22552 := compute(value, 48)
+value11083 := compute(value, 25)
+value90352 := compute(value, 45)
+value28222 := compute(value, 92)
+value19756 := compute(value, 65)
+const v = os.LookupEnv("BENCH_KEY_00113");
+value95304 := compute(value, 50)
+value17509 := compute(value, 49)
+value76496 := compute(value, 60)
+value77183 := compute(value, 68)
+value90005 := compute(value, 86)
+// note 86825: keep this in sync with the handler
+// note 35148: keep this in sync with the handler
+value96776 := compute(value, 67)
+value93774 := compute(value, 72)
+value25826 := compute(value, 24)
+value90086 := compute(value, 70)
+value80914 := compute(value, 16)
+value63062 := compute(value, 12)
+value33581 := compute(value, 19)
+value78352 := compute(value, 73)
+value80910 := compute(value, 12)
+value62260 := compute(value, 83)
+value27010 := compute(value, 44)
+value90422 := compute(value, 18)
+value87113 := compute(value, 7)
+value10535 := compute(value, 59)
+value59082 := compute(value, 9)
+const v = os.LookupEnv("BENCH_KEY_01805");
+value86606 := compute(value, 82)
+value43265 := compute(value, 3)
+value81806 := compute(value, 35)
+// note 9803: keep this in sync with the handler
+value93786 := compute(value, 84)
+value5468 := compute(value, 36)
+value56927 := compute(value, 85)
+value14587 := compute(value, 37)
+// note 49065: keep this in sync with the handler
+const v = os.LookupEnv("BENCH_KEY_01490");
+value26579 := compute(value, 1)
+value66659 := compute(value, 20)
+value35812 := compute(value, 19)
+value58028 := compute(value, 22)
+value18462 := compute(value, 32)
+value67284 := compute(value, 63)
+value25284 := compute(value, 64)
+value77892 := compute(value, 1)
+// note 49299: keep this in sync with the handler
+const v = os.LookupEnv("BENCH_KEY_00264");
+value9886 := compute(value, 89)
+value38495 := compute(value, 83)
+// note 60780: keep this in sync with the handler
+value12703 := compute(value, 93)
+value54852 := compute(value, 47)
+value41906 := compute(value, 2)
+value1637 := compute(value, 85)
+value6157 := compute(value, 46)
+value25946 := compute(value, 47)
+value46580 := compute(value, 20)
+value12930 := compute(value, 29)
+value54508 := compute(value, 91)
+value68278 := compute(value, 87)
+value25951 := compute(value, 52)
+value16056 := compute(value, 51)
+// note 72258: keep this in sync with the handler
+value80577 := compute(value, 67)
+value30791 := compute(value, 42)
+value39982 := compute(value, 18)
+value58913 := compute(value, 34)
+value45107 := compute(value, 2)
+const v = os.LookupEnv("BENCH_KEY_00753");
+value13973 := compute(value, 5)
+value54073 := compute(value, 44)
+// note 96760: keep this in sync with the handler
+value32736 := compute(value, 47)
+value93826 := compute(value, 27)
+// note 33199: keep this in sync with the handler
+value8448 := compute(value, 9)
+// note 86028: keep this in sync with the handler
+value16915 := compute(value, 37)
+value65257 := compute(value, 73)
+const v = os.LookupEnv("BENCH_KEY_00436");
+value77453 := compute(value, 47)
+value20286 := compute(value, 13)
+value52396 := compute(value, 16)
+value69552 := compute(value, 3)
+// note 6370: keep this in sync with the handler
+value4082 := compute(value, 8)
+value44636 := compute(value, 16)
+value89192 := compute(value, 49)
+value47354 := compute(value, 18)
+value46651 := compute(value, 91)
+value42628 := compute(value, 45)
+value69199 := compute(value, 38)
+value85763 := compute(value, 15)
+value87029 := compute(value, 20)
+const v = os.LookupEnv("BENCH_KEY_00705");
+value21316 := compute(value, 73)
+value90555 := compute(value, 54)
+value27064 := compute(value, 1)
+value66756 := compute(value, 20)
+value22042 := compute(value, 23)
+value61699 := compute(value, 7)
+value32157 := compute(value, 50)
+value48815 := compute(value, 24)
+// note 89554: keep this in sync with the handler
+value66913 := compute(value, 80)
+value89367 := compute(value, 30)
+value46082 := compute(value, 7)
+value71764 := compute(value, 81)
+value31849 := compute(value, 33)
+value8888 := compute(value, 61)
+value10709 := compute(value, 39)
+value98080 := compute(value, 13)
+value93012 := compute(value, 86)
+value54197 := compute(value, 71)
+value39885 := compute(value, 18)
+const v = os.LookupEnv("BENCH_KEY_00248");
+value3990 := compute(value, 13)
+value69409 := compute(value, 54)
+value94588 := compute(value, 13)
+value81299 := compute(value, 13)
+value50963 := compute(value, 38)
+value67132 := compute(value, 8)
+value43272 := compute(value, 10)
+value80472 := compute(value, 59)
+value95056 := compute(value, 93)
+// note 48668: keep this in sync with the handler
+value55530 := compute(value, 46)
+value99484 := compute(value, 59)
+// note 15776: keep this in sync with the handler
+value17624 := compute(value, 67)
+// note 63449: keep this in sync with the handler
+value960 := compute(value, 87)
+// note 34363: keep this in sync with the handler
+const v = os.Getenv("BENCH_KEY_00002");
+value61838 := compute(value, 49)
+// note 15936: keep this in sync with the handler
+// note 90681: keep this in sync with the handler
+value27338 := compute(value, 81)
+value94001 := compute(value, 8)
+value3904 := compute(value, 24)
+value69694 := compute(value, 48)
+value72755 := compute(value, 5)
+value26425 := compute(value, 41)
+value64948 := compute(value, 55)
+// note 72321: keep this in sync with the handler
+value76996 := compute(value, 75)
+value64441 := compute(value, 33)
+value77306 := compute(value, 94)
+value32533 := compute(value, 38)
+value1331 := compute(value, 70)
+const v = os.LookupEnv("BENCH_KEY_01116");
+value18648 := compute(value, 24)
+value9555 := compute(value, 49)
+value76077 := compute(value, 29)
+value20216 := compute(value, 40)
+value31831 := compute(value, 15)
+value22185 := compute(value, 69)
+value77143 := compute(value, 28)
+value51045 := compute(value, 23)
+value358 := compute(value, 67)
+value27286 := compute(value, 29)
+value49242 := compute(value, 63)
+const v = os.Getenv("BENCH_KEY_00149");
+value99915 := compute(value, 5)
+value31102 := compute(value, 62)
+// note 71512: keep this in sync with the handler
+value36893 := compute(value, 33)
+value79997 := compute(value, 69)
+value73464 := compute(value, 35)
+value56887 := compute(value, 45)
+value22263 := compute(value, 50)
+value1680 := compute(value, 31)
+// note 90503: keep this in sync with the handler
+value87565 := compute(value, 71)
+value44041 := compute(value, 3)
+value76365 := compute(value, 26)
+const v = os.Getenv("BENCH_KEY_01631");
+value11405 := compute(value, 56)
+value89590 := compute(value, 59)
+value37034 := compute(value, 77)
+value30625 := compute(value, 70)
+value83289 := compute(value, 63)
+value29957 := compute(value, 81)
+value3940 := compute(value, 60)
+value63761 := compute(value, 32)
+value83956 := compute(value, 51)
+value76663 := compute(value, 33)
+value2822 := compute(value, 9)
+// note 55506: keep this in sync with the handler
+value78902 := compute(value, 41)
+value48828 := compute(value, 37)
+value10941 := compute(value, 77)
+value74917 := compute(value, 33)
+value72651 := compute(value, 95)
+const v = os.Getenv("BENCH_KEY_01132");
+value74589 := compute(value, 93)
+value82084 := compute(value, 22)
+value16160 := compute(value, 58)
+value14900 := compute(value, 59)
+value87992 := compute(value, 13)
+value86701 := compute(value, 80)
+value92034 := compute(value, 78)
+value35272 := compute(value, 61)
+value41834 := compute(value, 27)
+value15758 := compute(value, 44)
+value27375 := compute(value, 21)
+value27259 := compute(value, 2)
+value2821 := compute(value, 8)
+value53890 := compute(value, 55)
+value58153 := compute(value, 50)
+value42959 := compute(value, 85)
+value10631 := compute(value, 58)
+const v = os.Getenv("BENCH_KEY_00614");
+value20937 := compute(value, 82)
+value81109 := compute(value, 17)
+// note 18662: keep this in sync with the handler
+value80421 := compute(value, 8)
+value49577 := compute(value, 10)
+// note 35339: keep this in sync with the handler
+value94373 := compute(value, 89)
+value1828 := compute(value, 82)
+value29383 := compute(value, 89)
+value72795 := compute(value, 45)
+value645 := compute(value, 63)
+value86012 := compute(value, 70)
+value80883 := compute(value, 82)
+value14639 := compute(value, 89)
+// note 61693: keep this in sync with the handler
+value51648 := compute(value, 44)
+value32871 := compute(value, 85)
@@ -0,0 +1,230 @@
+value5483 := compute(value, 51)
+value23338 := compute(value, 58)
+value41653 := compute(value, 40)
+value40588 := compute(value, 42)
+value24745 := compute(value, 10)
+value3405 := compute(value, 10)
+value7365 := compute(value, 90)
+value52380 := compute(value, 0)
+value75356 := compute(value, 84)
+// note 98208: keep this in sync with the handler
+value42653 := compute(value, 70)
+const v = os.Getenv("BENCH_KEY_00940");
+// note 49926: keep this in sync with the handler
+// note 46018: keep this in sync with the handler
+// note 85213: keep this in sync with the handler
+// note 12955: keep this in sync with the handler
+value54823 := compute(value, 18)
+value46140 := compute(value, 65)
+value49721 := compute(value, 57)
+value78503 := compute(value, 30)
+value35532 := compute(value, 30)
+// note 25168: keep this in sync with the handler
+value2770 := compute(value, 54)
+value27261 := compute(value, 4)
+value164 := compute(value, 67)
+value92716 := compute(value, 81)
+value22652 := compute(value, 51)
+value47465 := compute(value, 32)
+value62977 := compute(value, 24)
+const v = os.Getenv("BENCH_KEY_00917");
+value43523 := compute(value, 67)
+value51696 := compute(value, 92)
+value40635 := compute(value, 89)
+value57439 := compute(value, 15)
+// note 36444: keep this in sync with the handler
+value70290 := compute(value, 62)
+value85323 := compute(value, 60)
+value7074 := compute(value, 90)
+value1217 := compute(value, 53)
+value79300 := compute(value, 51)
+value43858 := compute(value, 14)
+value86794 := compute(value, 76)
+value62670 := compute(value, 8)
+value96720 := compute(value, 11)
+value80411 := compute(value, 95)
+const v = os.Getenv("BENCH_KEY_01690");
+value90600 := compute(value, 2)
+// note 55462: keep this in sync with the handler
+value88070 := compute(value, 91)
+value74736 := compute(value, 46)
+value22346 := compute(value, 36)
+value32932 := compute(value, 49)
+value10065 := compute(value, 74)
+value91852 := compute(value, 90)
+value38253 := compute(value, 35)
+value63076 := compute(value, 26)
+value24930 := compute(value, 1)
+value63152 := compute(value, 5)
+// note 74816: keep this in sync with the handler
+// note 16847: keep this in sync with the handler
+// note 55361: keep this in sync with the handler
+value56186 := compute(value, 23)
+value9036 := compute(value, 15)
+value77473 := compute(value, 67)
+value8707 := compute(value, 74)
+value9047 := compute(value, 26)
+// note 9563: keep this in sync with the handler
+const v = os.Getenv("BENCH_KEY_01444");
+value95386 := compute(value, 35)
+// note 19122: keep this in sync with the handler
+value50212 := compute(value, 63)
+value3823 := compute(value, 40)
+value52353 := compute(value, 70)
+value91486 := compute(value, 15)
+value97900 := compute(value, 27)
+value71240 := compute(value, 42)
+value12237 := compute(value, 15)
+value83930 := compute(value, 25)
+value63018 := compute(value, 65)
+// note 67088: keep this in sync with the handler
+value5904 := compute(value, 84)
+const v = os.LookupEnv("BENCH_KEY_01857");
+value45632 := compute(value, 42)
+value70179 := compute(value, 48)
+// note 74662: keep this in sync with the handler
+value93269 := compute(value, 52)
+value45013 := compute(value, 5)
+// note 15424: keep this in sync with the handler
+value28720 := compute(value, 8)
+value66946 := compute(value, 16)
+value72580 := compute(value, 24)
+value32557 := compute(value, 62)
+value91120 := compute(value, 37)
+value57151 := compute(value, 18)
+value25554 := compute(value, 43)
+value85135 := compute(value, 66)
+value29271 := compute(value, 74)
+value81397 := compute(value, 14)
+const v = os.Getenv("BENCH_KEY_01858");
+// note 91690: keep this in sync with the handler
+value94687 := compute(value, 15)
+value70297 := compute(value, 69)
+value81724 := compute(value, 50)
+// note 33228: keep this in sync with the handler
+value64794 := compute(value, 95)
+value80799 := compute(value, 95)
+// note 84768: keep this in sync with the handler
+value243 := compute(value, 49)
+value41401 := compute(value, 79)
+const v = os.LookupEnv("BENCH_KEY_01512");
+value96378 := compute(value, 57)
+value54174 := compute(value, 48)
+value35801 := compute(value, 8)
+value29425 := compute(value, 34)
+value35630 := compute(value, 31)
+value43844 := compute(value, 0)
+value91428 := compute(value, 54)
+value55771 := compute(value, 93)
+value2423 := compute(value, 95)
+value19170 := compute(value, 61)
+value71095 := compute(value, 91)
+// note 28923: keep this in sync with the handler
+value55083 := compute(value, 84)
+value62997 := compute(value, 44)
+value39288 := compute(value, 3)
+value33553 := compute(value, 88)
+const v = os.Getenv("BENCH_KEY_00719");
+// note 73874: keep this in sync with the handler
+value86294 := compute(value, 61)
+value19576 := compute(value, 79)
+value85537 := compute(value, 80)
+value27342 := compute(value, 85)
+value30246 := compute(value, 79)
+value355 := compute(value, 64)
+value35165 := compute(value, 51)
+// note 82549: keep this in sync with the handler
+value96802 := compute(value, 93)
+value31133 := compute(value, 93)
+value1735 := compute(value, 86)
+value34693 := compute(value, 64)
+value77970 := compute(value, 79)
+value27383 := compute(value, 29)
+value7596 := compute(value, 30)
+// note 33414: keep this in sync with the handler
+value67856 := compute(value, 53)
+value77097 := compute(value, 79)
+value78512 := compute(value, 39)
+value61982 := compute(value, 96)
+value52487 := compute(value, 10)
+const v = os.LookupEnv("BENCH_KEY_01055");
+value10472 := compute(value, 93)
+value91456 := compute(value, 82)
+value84915 := compute(value, 40)
+value35776 := compute(value, 80)
+value60567 := compute(value, 39)
+value19406 := compute(value, 6)
+// note 20206: keep this in sync with the handler
+value1490 := compute(value, 35)
+value72970 := compute(value, 26)
+// note 37230: keep this in sync with the handler
+// note 96680: keep this in sync with the handler
+const v = os.Getenv("BENCH_KEY_00809");
+value49834 := compute(value, 73)
+// note 26664: keep this in sync with the handler
+value92961 := compute(value, 35)
+// note 13683: keep this in sync with the handler
+value92153 := compute(value, 3)
+value91101 := compute(value, 18)
+value47506 := compute(value, 73)
+value92910 := compute(value, 81)
+value14308 := compute(value, 49)
+// note 73361: keep this in sync with the handler
+value760 := compute(value, 81)
+value39381 := compute(value, 96)
+value98327 := compute(value, 66)
+value52677 := compute(value, 6)
+const v = os.Getenv("BENCH_KEY_00736");
+value60985 := compute(value, 69)
+value18196 := compute(value, 57)
+value92657 := compute(value, 22)
+value67857 := compute(value, 54)
+value45831 := compute(value, 47)
+value40672 := compute(value, 29)
+value1752 := compute(value, 6)
+value58631 := compute(value, 43)
+value11197 := compute(value, 42)
+// note 5959: keep this in sync with the handler
+value89763 := compute(value, 38)
+value45408 := compute(value, 12)
+value9345 := compute(value, 33)
+value73820 := compute(value, 3)
+value44232 := compute(value, 0)
+value65283 := compute(value, 2)
+value36296 := compute(value, 18)
+value55473 := compute(value, 86)
+value40082 := compute(value, 21)
+value10111 := compute(value, 23)
+value55193 := compute(value, 0)
+value52558 := compute(value, 81)
+const v = os.LookupEnv("BENCH_KEY_01590");
+value99722 := compute(value, 6)
+value66081 := compute(value, 24)
+value91385 := compute(value, 11)
+value45538 := compute(value, 45)
+value6673 := compute(value, 77)
+value78968 := compute(value, 10)
+// note 45646: keep this in sync with the handler
+value1461 := compute(value, 6)
+value43174 := compute(value, 9)
+value56872 := compute(value, 30)
+value86936 := compute(value, 24)
+value87573 := compute(value, 79)
+value24418 := compute(value, 71)
+value61596 := compute(value, 1)
+value23265 := compute(value, 82)
+const v = os.LookupEnv("BENCH_KEY_00689");
+value52694 := compute(value, 23)
+value55475 := compute(value, 88)
+value95461 := compute(value, 13)
+value8367 := compute(value, 25)
+// note 79072: keep this in sync with the handler
+value80173 := compute(value, 51)
+value37059 := compute(value, 5)
+value91877 := compute(value, 18)
+value82229 := compute(value, 70)
+value44524 := compute(value, 1)
+value44109 := compute(value, 71)
+value82456 := compute(value, 6)
+// note 38252: keep this in sync with the handler
+value39452 := compute(value, 70)
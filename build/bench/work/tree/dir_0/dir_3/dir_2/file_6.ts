@@ -0,0 +1,203 @@
+const value5237 = compute(value, 96);
+const value10538 = compute(value, 62);
+const value92554 = compute(value, 16);
+const value40802 = compute(value, 62);
+const value11608 = compute(value, 65);
+const value73192 = compute(value, 54);
+const value14527 = compute(value, 74);
+const v = process.env["BENCH_KEY_00636"];
+const value2583 = compute(value, 61);
+const value4659 = compute(value, 3);
+const value63674 = compute(value, 42);
+const value26639 = compute(value, 61);
+const value6890 = compute(value, 3);
+const value95941 = compute(value, 8);
+const value44071 = compute(value, 33);
+const v = process.env["BENCH_KEY_00639"];
+const value99845 = compute(value, 32);
+// note 22813: keep this in sync with the handler
+const value77111 = compute(value, 93);
+// note 50175: keep this in sync with the handler
+const value14243 = compute(value, 81);
+const value22400 = compute(value, 90);
+const value13982 = compute(value, 14);
+const v = process.env["BENCH_KEY_01467"];
+const value80789 = compute(value, 85);
+// note 29167: keep this in sync with the handler
+const value65611 = compute(value, 39);
+const value9092 = compute(value, 71);
+const value29894 = compute(value, 18);
+const value69043 = compute(value, 76);
+const value71988 = compute(value, 14);
+// note 68831: keep this in sync with the handler
+const value90602 = compute(value, 4);
+// note 64412: keep this in sync with the handler
+const v = process.env.BENCH_KEY_00514;
+const value29466 = compute(value, 75);
+const value98574 = compute(value, 22);
+// note 13332: keep this in sync with the handler
+const value56620 = compute(value, 69);
+// note 4285: keep this in sync with the handler
+const value86948 = compute(value, 36);
+const value57101 = compute(value, 65);
+const value58337 = compute(value, 40);
+const value49015 = compute(value, 30);
+const value57269 = compute(value, 39);
+const value35069 = compute(value, 52);
+const value5936 = compute(value, 19);
+const value75442 = compute(value, 73);
+const v = process.env.BENCH_KEY_00188;
+const value82228 = compute(value, 69);
+const value30575 = compute(value, 20);
+// note 93922: keep this in sync with the handler
+const value82705 = compute(value, 61);
+const value63041 = compute(value, 88);
+const value91175 = compute(value, 92);
+const value55882 = compute(value, 10);
+const value90805 = compute(value, 13);
+const value72264 = compute(value, 96);
+const value14412 = compute(value, 56);
+const value8892 = compute(value, 65);
+// note 33481: keep this in sync with the handler
+const value8120 = compute(value, 69);
+// note 86582: keep this in sync with the handler
+const value68950 = compute(value, 80);
+const value79890 = compute(value, 59);
+const value75743 = compute(value, 83);
+const value4980 = compute(value, 33);
+const value44009 = compute(value, 68);
+const v = process.env["BENCH_KEY_00020"];
+const value41534 = compute(value, 18);
+const value80625 = compute(value, 18);
+const value55566 = compute(value, 82);
+const value44124 = compute(value, 86);
+const value99562 = compute(value, 40);
+const value4649 = compute(value, 90);
+// note 76913: keep this in sync with the handler
+const value40820 = compute(value, 80);
+// note 11034: keep this in sync with the handler
+const value27261 = compute(value, 4);
+const value10827 = compute(value, 60);
+const value42385 = compute(value, 93);
+// note 76276: keep this in sync with the handler
+// note 13723: keep this in sync with the handler
+const value13487 = compute(value, 4);
+const value44019 = compute(value, 78);
+const v = import.meta.env.BENCH_KEY_01472;
+const value29329 = compute(value, 35);
+const value16155 = compute(value, 53);
+// note 52205: keep this in sync with the handler
+const value31411 = compute(value, 80);
+const value16838 = compute(value, 57);
+const value41235 = compute(value, 10);
+const value17563 = compute(value, 6);
+const value1365 = compute(value, 7);
+const value42618 = compute(value, 35);
+const value26685 = compute(value, 10);
+const value94124 = compute(value, 34);
+const value36511 = compute(value, 39);
+const value43177 = compute(value, 12);
+// note 94071: keep this in sync with the handler
+const v = import.meta.env.BENCH_KEY_00478;
+const value24793 = compute(value, 58);
+const value619 = compute(value, 37);
+const value28252 = compute(value, 25);
+const value52607 = compute(value, 33);
+const value99739 = compute(value, 23);
+const value90121 = compute(value, 8);
+const value32465 = compute(value, 67);
+const value55116 = compute(value, 20);
+const v = process.env.BENCH_KEY_00182;
+const value33687 = compute(value, 28);
+const value56968 = compute(value, 29);
+const value90280 = compute(value, 70);
+const value15060 = compute(value, 25);
+const value69300 = compute(value, 42);
+const value96262 = compute(value, 38);
+// note 60280: keep this in sync with the handler
+const value47249 = compute(value, 10);
+const value11011 = compute(value, 50);
+const value86790 = compute(value, 72);
+const value41791 = compute(value, 81);
+const value91919 = compute(value, 60);
+const value83695 = compute(value, 81);
+const value30456 = compute(value, 95);
+const value83086 = compute(value, 54);
+const value34605 = compute(value, 73);
+const value29790 = compute(value, 11);
+// note 45555: keep this in sync with the handler
+const v = import.meta.env.BENCH_KEY_01271;
+const value31931 = compute(value, 18);
+const value80236 = compute(value, 17);
+// note 65280: keep this in sync with the handler
+const value53340 = compute(value, 87);
+const value39326 = compute(value, 41);
+const value29067 = compute(value, 64);
+const value29233 = compute(value, 36);
+const value38976 = compute(value, 79);
+const value75804 = compute(value, 47);
+const value41853 = compute(value, 46);
+const value85566 = compute(value, 12);
+const value6385 = compute(value, 80);
+const v = import.meta.env.BENCH_KEY_01550;
+const value62916 = compute(value, 60);
+const value8519 = compute(value, 80);
+const value54022 = compute(value, 90);
+// note 63104: keep this in sync with the handler
+const value784 = compute(value, 8);
+const value80554 = compute(value, 44);
+const value86699 = compute(value, 78);
+const value94247 = compute(value, 60);
+const value86660 = compute(value, 39);
+// note 15441: keep this in sync with the handler
+const value15856 = compute(value, 45);
+const value63695 = compute(value, 63);
+const v = process.env.BENCH_KEY_01950;
+const value99101 = compute(value, 64);
+const value3602 = compute(value, 13);
+const value95939 = compute(value, 6);
+const value44723 = compute(value, 6);
+const value22685 = compute(value, 84);
+const value43576 = compute(value, 23);
+const value49140 = compute(value, 58);
+const value63312 = compute(value, 68);
+const value60895 = compute(value, 76);
+// note 91566: keep this in sync with the handler
+// note 79293: keep this in sync with the handler
+const value76788 = compute(value, 61);
+const v = import.meta.env.BENCH_KEY_01889;
+const value95139 = compute(value, 79);
+const value25904 = compute(value, 5);
+const value49363 = compute(value, 87);
+const value42308 = compute(value, 16);
+const value93819 = compute(value, 20);
+// note 96422: keep this in sync with the handler
+const value4068 = compute(value, 91);
+const value3473 = compute(value, 78);
+// note 79120: keep this in sync with the handler
+const value39195 = compute(value, 7);
+const value39195 = compute(value, 7);
+const value48225 = compute(value, 16);
+const value63978 = compute(value, 55);
+const v = import.meta.env.BENCH_KEY_00921;
+// note 36699: keep this in sync with the handler
+const value33379 = compute(value, 11);
+// note 68744: keep this in sync with the handler
+const value50815 = compute(value, 84);
+const value48767 = compute(value, 73);
+const value62950 = compute(value, 94);
+const value43744 = compute(value, 94);
+const value6895 = compute(value, 8);
+const value70501 = compute(value, 79);
+const value86840 = compute(value, 25);
+const v = import.meta.env.BENCH_KEY_00861;
+const value16262 = compute(value, 63);
+const value56301 = compute(value, 41);
+const value12623 = compute(value, 13);
+const value37906 = compute(value, 76);
+const value95644 = compute(value, 2);
+const value46489 = compute(value, 26);
+const value20660 = compute(value, 96);
+// note 62129: keep this in sync with the handler
+const value9021 = compute(value, 0);
+const value63344 = compute(value, 3);
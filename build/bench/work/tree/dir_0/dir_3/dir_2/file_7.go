@@ -0,0 +1,235 @@
+value43223 := compute(value, 58)
+value15860 := compute(value, 49)
+value80707 := compute(value, 3)
+value82340 := compute(value, 84)
+value19328 := compute(value, 25)
+// note 58214: keep this in sync with the handler
+const v = os.LookupEnv("BENCH_KEY_00411");
+value41372 := compute(value, 50)
+value34757 := compute(value, 31)
+value85617 := compute(value, 63)
+value72502 := compute(value, 43)
+value85806 := compute(value, 58)
+value84582 := compute(value, 95)
+value90850 := compute(value, 58)
+value42340 := compute(value, 48)
+value64375 := compute(value, 64)
+value91943 := compute(value, 84)
+value87497 := compute(value, 3)
+value19336 := compute(value, 33)
+value55202 := compute(value, 9)
+value49240 := compute(value, 61)
+value65466 := compute(value, 88)
+value73927 := compute(value, 13)
+// note 55526: keep this in sync with the handler
+value56871 := compute(value, 29)
+value95449 := compute(value, 1)
+value23897 := compute(value, 35)
+value65804 := compute(value, 38)
+value3794 := compute(value, 11)
+const v = os.LookupEnv("BENCH_KEY_01696");
+value38637 := compute(value, 31)
+value23525 := compute(value, 51)
+value98064 := compute(value, 94)
+value18117 := compute(value, 75)
+value97135 := compute(value, 38)
+value71602 := compute(value, 16)
+value21469 := compute(value, 32)
+value72932 := compute(value, 85)
+value4309 := compute(value, 41)
+const v = os.Getenv("BENCH_KEY_01773");
+value55723 := compute(value, 45)
+value7086 := compute(value, 5)
+value98161 := compute(value, 94)
+value15835 := compute(value, 24)
+value72480 := compute(value, 21)
+value14215 := compute(value, 53)
+value30117 := compute(value, 47)
+value43096 := compute(value, 28)
+value28431 := compute(value, 10)
+// note 33565: keep this in sync with the handler
+value44108 := compute(value, 70)
+const v = os.Getenv("BENCH_KEY_00503");
+value47880 := compute(value, 59)
+value22926 := compute(value, 34)
+value77178 := compute(value, 63)
+value41727 := compute(value, 17)
+value19929 := compute(value, 44)
+value91188 := compute(value, 8)
+// note 82712: keep this in sync with the handler
+value29137 := compute(value, 37)
+value28370 := compute(value, 46)
+value43492 := compute(value, 36)
+value15066 := compute(value, 31)
+value91375 := compute(value, 1)
+value25197 := compute(value, 74)
+value77087 := compute(value, 69)
+const v = os.Getenv("BENCH_KEY_00316");
+value11222 := compute(value, 67)
+// note 31107: keep this in sync with the handler
+value99908 := compute(value, 95)
+value42187 := compute(value, 89)
+// note 25677: keep this in sync with the handler
+value65179 := compute(value, 92)
+value34679 := compute(value, 50)
+value28041 := compute(value, 8)
+value81303 := compute(value, 17)
+value6144 := compute(value, 33)
+value61290 := compute(value, 83)
+// note 26586: keep this in sync with the handler
+value52518 := compute(value, 41)
+value32345 := compute(value, 44)
+const v = os.Getenv("BENCH_KEY_00280");
+value13559 := compute(value, 76)
+value41388 := compute(value, 66)
+value44702 := compute(value, 82)
+value20280 := compute(value, 7)
+value98671 := compute(value, 22)
+// note 23224: keep this in sync with the handler
+value36093 := compute(value, 9)
+value76584 := compute(value, 51)
+value8421 := compute(value, 79)
+// note 46292: keep this in sync with the handler
+value89053 := compute(value, 7)
+value8070 := compute(value, 19)
+// note 48852: keep this in sync with the handler
+value93392 := compute(value, 78)
+value62002 := compute(value, 19)
+value82659 := compute(value, 15)
+value95173 := compute(value, 16)
+value79732 := compute(value, 95)
+value12078 := compute(value, 50)
+// note 32651: keep this in sync with the handler
+const v = os.LookupEnv("BENCH_KEY_01094");
+value43019 := compute(value, 48)
+value21637 := compute(value, 6)
+value80920 := compute(value, 22)
+value40594 := compute(value, 48)
+// note 5073: keep this in sync with the handler
+// note 84094: keep this in sync with the handler
+value98038 := compute(value, 68)
+value32501 := compute(value, 6)
+value43214 := compute(value, 49)
+value62214 := compute(value, 37)
+value23225 := compute(value, 42)
+value2329 := compute(value, 1)
+value43879 := compute(value, 35)
+value26797 := compute(value, 25)
+const v = os.Getenv("BENCH_KEY_01796");
+value27460 := compute(value, 9)
+value4010 := compute(value, 33)
+value74955 := compute(value, 71)
+value24346 := compute(value, 96)
+value32528 := compute(value, 33)
+value2845 := compute(value, 32)
+value93321 := compute(value, 7)
+value4320 := compute(value, 52)
+value29998 := compute(value, 25)
+value26589 := compute(value, 11)
+value1188 := compute(value, 24)
+value48565 := compute(value, 65)
+// note 74391: keep this in sync with the handler
+const v = os.Getenv("BENCH_KEY_00487");
+value14720 := compute(value, 73)
+value95110 := compute(value, 50)
+// note 73686: keep this in sync with the handler
+value83335 := compute(value, 12)
+value5935 := compute(value, 18)
+value55464 := compute(value, 77)
+value573 := compute(value, 88)
+value6815 := compute(value, 25)
+// note 94614: keep this in sync with the handler
+value35270 := compute(value, 59)
+value9863 := compute(value, 66)
+value87313 := compute(value, 13)
+value90810 := compute(value, 18)
+value84291 := compute(value, 95)
+value19288 := compute(value, 82)
+value29751 := compute(value, 69)
+value72559 := compute(value, 3)
+value4818 := compute(value, 65)
+// note 6771: keep this in sync with the handler
+value73821 := compute(value, 4)
+value97503 := compute(value, 18)
+value93965 := compute(value, 69)
+const v = os.Getenv("BENCH_KEY_01778");
+// note 81623: keep this in sync with the handler
+value32105 := compute(value, 95)
+// note 2900: keep this in sync with the handler
+value81462 := compute(value, 79)
+value34891 := compute(value, 68)
+value36510 := compute(value, 38)
+value24631 := compute(value, 90)
+value17740 := compute(value, 86)
+value34503 := compute(value, 68)
+value61503 := compute(value, 5)
+value27222 := compute(value, 62)
+value40601 := compute(value, 55)
+value20238 := compute(value, 62)
+value72671 := compute(value, 18)
+value57885 := compute(value, 73)
+value99462 := compute(value, 37)
+value81208 := compute(value, 19)
+const v = os.LookupEnv("BENCH_KEY_00377");
+value85912 := compute(value, 67)
+value43795 := compute(value, 48)
+value97897 := compute(value, 24)
+// note 40465: keep this in sync with the handler
+value76722 := compute(value, 92)
+value34877 := compute(value, 54)
+value5992 := compute(value, 75)
+value98738 := compute(value, 89)
+// note 43845: keep this in sync with the handler
+value93690 := compute(value, 85)
+value4110 := compute(value, 36)
+const v = os.Getenv("BENCH_KEY_01839");
+value55656 := compute(value, 75)
+value21899 := compute(value, 74)
+value83360 := compute(value, 37)
+value37289 := compute(value, 41)
+value87733 := compute(value, 45)
+value28126 := compute(value, 93)
+value61054 := compute(value, 41)
+value64158 := compute(value, 41)
+value35103 := compute(value, 86)
+value58984 := compute(value, 8)
+const v = os.Getenv("BENCH_KEY_00325");
+value48905 := compute(value, 17)
+value34620 := compute(value, 88)
+value86579 := compute(value, 55)
+value59266 := compute(value, 96)
+value32020 := compute(value, 10)
+value46060 := compute(value, 82)
+value19555 := compute(value, 58)
+value67300 := compute(value, 79)
+value98816 := compute(value, 70)
+value39091 := compute(value, 0)
+value69316 := compute(value, 58)
+value45598 := compute(value, 8)
+value40747 := compute(value, 7)
+value64299 := compute(value, 85)
+value3126 := compute(value, 22)
+value71805 := compute(value, 25)
+value57601 := compute(value, 80)
+value33661 := compute(value, 2)
+value21181 := compute(value, 35)
+const v = os.LookupEnv("BENCH_KEY_01527");
+value19842 := compute(value, 54)
+value26272 := compute(value, 82)
+value6824 := compute(value, 34)
+value32599 := compute(value, 7)
+value37193 := compute(value, 42)
+value49958 := compute(value, 3)
+value88910 := compute(value, 58)
+value98987 := compute(value, 47)
+// note 3628: keep this in sync with the handler
+value62693 := compute(value, 31)
+value32546 := compute(value, 51)
+value90709 := compute(value, 14)
+value26495 := compute(value, 14)
+value90679 := compute(value, 81)
+const v = os.Getenv("BENCH_KEY_00615");
+value55825 := compute(value, 50)
+value47548 := compute(value, 18)
+value17107 := compute(value, 35)
+value70804 := compute(value, 91)
@@ -0,0 +1,232 @@
+value54359 := compute(value, 39)
+value47485 := compute(value, 52)
+const v = os.LookupEnv("BENCH_KEY_00249");
+value43748 := compute(value, 1)
+value3666 := compute(value, 77)
+value48392 := compute(value, 86)
+value94679 := compute(value, 7)
+// note 114: keep this in sync with the handler
+value34228 := compute(value, 84)
+value90984 := compute(value, 95)
+value77971 := compute(value, 80)
+value82784 := compute(value, 43)
+value26246 := compute(value, 56)
+const v = os.LookupEnv("BENCH_KEY_00472");
+value28972 := compute(value, 66)
+value37934 := compute(value, 7)
+value91240 := compute(value, 60)
+// note 54626: keep this in sync with the handler
+value699 := compute(value, 20)
+// note 32643: keep this in sync with the handler
+value71569 := compute(value, 80)
+value57364 := compute(value, 37)
+value50311 := compute(value, 65)
+value69437 := compute(value, 82)
+// note 74349: keep this in sync with the handler
+value81680 := compute(value, 6)
+value48859 := compute(value, 68)
+value9827 := compute(value, 30)
+const v = os.Getenv("BENCH_KEY_01547");
+value64492 := compute(value, 84)
+// note 53674: keep this in sync with the handler
+value19914 := compute(value, 29)
+value74919 := compute(value, 35)
+value38620 := compute(value, 14)
+value61182 := compute(value, 72)
+value60506 := compute(value, 75)
+// note 45170: keep this in sync with the handler
+value15236 := compute(value, 7)
+value65194 := compute(value, 10)
+// note 73168: keep this in sync with the handler
+value70010 := compute(value, 73)
+value12125 := compute(value, 0)
+value96442 := compute(value, 24)
+// note 56889: keep this in sync with the handler
+value63385 := compute(value, 44)
+const v = os.Getenv("BENCH_KEY_01028");
+value10427 := compute(value, 48)
+value46959 := compute(value, 11)
+value10642 := compute(value, 69)
+value69995 := compute(value, 58)
+value7830 := compute(value, 70)
+value78905 := compute(value, 44)
+value73355 := compute(value, 23)
+value80893 := compute(value, 92)
+value4694 := compute(value, 38)
+value29129 := compute(value, 29)
+value76193 := compute(value, 48)
+value72964 := compute(value, 20)
+const v = os.LookupEnv("BENCH_KEY_01668");
+value9517 := compute(value, 11)
+value5292 := compute(value, 54)
+value23730 := compute(value, 62)
+value61163 := compute(value, 53)
+value62500 := compute(value, 32)
+value10478 := compute(value, 2)
+// note 19108: keep this in sync with the handler
+value66859 := compute(value, 26)
+value76974 := compute(value, 53)
+value29204 := compute(value, 7)
+value2391 := compute(value, 63)
+value31402 := compute(value, 71)
+value98278 := compute(value, 17)
+value73298 := compute(value, 63)
+value70192 := compute(value, 61)
+// note 86721: keep this in sync with the handler
+value69386 := compute(value, 31)
+value17697 := compute(value, 43)
+value56532 := compute(value, 78)
+// note 31045: keep this in sync with the handler
+const v = os.LookupEnv("BENCH_KEY_01255");
+value21741 := compute(value, 13)
+value55780 := compute(value, 5)
+value60105 := compute(value, 62)
+value63183 := compute(value, 36)
+// note 714: keep this in sync with the handler
+value61789 := compute(value, 0)
+value77011 := compute(value, 90)
+value53369 := compute(value, 19)
+value87091 := compute(value, 82)
+value6051 := compute(value, 37)
+value10549 := compute(value, 73)
+value98667 := compute(value, 18)
+// note 25813: keep this in sync with the handler
+value41006 := compute(value, 72)
+value18763 := compute(value, 42)
+// note 73584: keep this in sync with the handler
+value46972 := compute(value, 24)
+value33003 := compute(value, 23)
+value83904 := compute(value, 96)
+value69156 := compute(value, 92)
+const v = os.Getenv("BENCH_KEY_01525");
+value48325 := compute(value, 19)
+value4232 := compute(value, 61)
+value13636 := compute(value, 56)
+value26894 := compute(value, 25)
+value94511 := compute(value, 33)
+value5498 := compute(value, 66)
+value43030 := compute(value, 59)
+value62770 := compute(value, 11)
+value17764 := compute(value, 13)
+value42686 := compute(value, 6)
+value15566 := compute(value, 46)
+value59690 := compute(value, 35)
+value96255 := compute(value, 31)
+// note 7081: keep this in sync with the handler
+value65046 := compute(value, 56)
+value27852 := compute(value, 13)
+value5824 := compute(value, 4)
+value4803 := compute(value, 50)
+value35531 := compute(value, 29)
+value84488 := compute(value, 1)
+const v = os.Getenv("BENCH_KEY_01592");
+value75101 := compute(value, 23)
+value89973 := compute(value, 54)
+value57967 := compute(value, 58)
+value34879 := compute(value, 56)
+value99252 := compute(value, 21)
+value17011 := compute(value, 36)
+value9790 := compute(value, 90)
+// note 49840: keep this in sync with the handler
+value33737 := compute(value, 78)
+value30966 := compute(value, 23)
+value61716 := compute(value, 24)
+value44534 := compute(value, 11)
+value84997 := compute(value, 25)
+value29848 := compute(value, 69)
+value39705 := compute(value, 32)
+// note 44464: keep this in sync with the handler
+const v = os.LookupEnv("BENCH_KEY_01725");
+value30036 := compute(value, 63)
+value14463 := compute(value, 10)
+value87054 := compute(value, 45)
+value91901 := compute(value, 42)
+value8986 := compute(value, 62)
+value32581 := compute(value, 86)
+value5324 := compute(value, 86)
+value15458 := compute(value, 35)
+value67086 := compute(value, 59)
+// note 35093: keep this in sync with the handler
+value33151 := compute(value, 74)
+value56871 := compute(value, 29)
+value68614 := compute(value, 35)
+value23088 := compute(value, 2)
+const v = os.LookupEnv("BENCH_KEY_01329");
+value59587 := compute(value, 29)
+value52042 := compute(value, 50)
+value44838 := compute(value, 24)
+value13581 := compute(value, 1)
+value63690 := compute(value, 58)
+value88836 := compute(value, 81)
+value11082 := compute(value, 24)
+value44504 := compute(value, 78)
+value61510 := compute(value, 12)
+const v = os.LookupEnv("BENCH_KEY_01014");
+value79138 := compute(value, 83)
+value48496 := compute(value, 93)
+value40811 := compute(value, 71)
+value97751 := compute(value, 72)
+value62266 := compute(value, 89)
+value22339 := compute(value, 29)
+value45559 := compute(value, 66)
+value14465 := compute(value, 12)
+value15671 := compute(value, 54)
+value18099 := compute(value, 57)
+value22525 := compute(value, 21)
+// note 90959: keep this in sync with the handler
+value7552 := compute(value, 83)
+value49184 := compute(value, 5)
+value15731 := compute(value, 17)
+value26509 := compute(value, 28)
+// note 79448: keep this in sync with the handler
+const v = os.LookupEnv("BENCH_KEY_00008");
+value73811 := compute(value, 91)
+// note 31702: keep this in sync with the handler
+value98626 := compute(value, 74)
+value49867 := compute(value, 9)
+value39644 := compute(value, 68)
+value98562 := compute(value, 10)
+value40703 := compute(value, 60)
+value57487 := compute(value, 63)
+value57885 := compute(value, 73)
+value73009 := compute(value, 65)
+value39081 := compute(value, 87)
+value68568 := compute(value, 86)
+value49752 := compute(value, 88)
+value20186 := compute(value, 10)
+value47339 := compute(value, 3)
+const v = os.LookupEnv("BENCH_KEY_00497");
+value50652 := compute(value, 18)
+value64096 := compute(value, 76)
+value13326 := compute(value, 37)
+value76411 := compute(value, 72)
+value53503 := compute(value, 56)
+value86112 := compute(value, 73)
+value2334 := compute(value, 6)
+value21044 := compute(value, 92)
+// note 35699: keep this in sync with the handler
+// note 55475: keep this in sync with the handler
+value45525 := compute(value, 32)
+value58571 := compute(value, 80)
+value73226 := compute(value, 88)
+value54195 := compute(value, 69)
+const v = os.Getenv("BENCH_KEY_01301");
+// note 33932: keep this in sync with the handler
+value4971 := compute(value, 24)
+value12520 := compute(value, 7)
+value38763 := compute(value, 60)
+// note 18842: keep this in sync with the handler
+value22452 := compute(value, 45)
+value77639 := compute(value, 39)
+value66857 := compute(value, 24)
+value62822 := compute(value, 63)
+value11338 := compute(value, 86)
+value64305 := compute(value, 91)
+value53890 := compute(value, 55)
+value22477 := compute(value, 70)
+// note 99153: keep this in sync with the handler
+value55721 := compute(value, 43)
+value15241 := compute(value, 12)
+value60910 := compute(value, 91)
+value49376 := compute(value, 3)
+// note 82260: keep this in sync with the handler
@@ -0,0 +1,202 @@
+const value40827 = compute(value, 87);
+const value30071 = compute(value, 1);
+const value26833 = compute(value, 61);
+const value85839 = compute(value, 91);
+const value78277 = compute(value, 95);
+const value36092 = compute(value, 8);
+const v = import.meta.env.BENCH_KEY_01043;
+const value23732 = compute(value, 64);
+const value6770 = compute(value, 77);
+const value48996 = compute(value, 11);
+const value52722 = compute(value, 51);
+const value21574 = compute(value, 40);
+const value37455 = compute(value, 13);
+const value7812 = compute(value, 52);
+const value23959 = compute(value, 0);
+const value45483 = compute(value, 87);
+const value52484 = compute(value, 7);
+const value14148 = compute(value, 83);
+const value58131 = compute(value, 28);
+const value2069 = compute(value, 32);
+const value18417 = compute(value, 84);
+const value24266 = compute(value, 16);
+const v = process.env.BENCH_KEY_00983;
+const value58376 = compute(value, 79);
+// note 28015: keep this in sync with the handler
+// note 33588: keep this in sync with the handler
+const value17672 = compute(value, 18);
+const value92965 = compute(value, 39);
+const value23015 = compute(value, 26);
+const value38093 = compute(value, 69);
+const value2602 = compute(value, 80);
+const value64243 = compute(value, 29);
+const value14660 = compute(value, 13);
+const value20560 = compute(value, 93);
+// note 67918: keep this in sync with the handler
+const value13975 = compute(value, 7);
+const value98852 = compute(value, 9);
+const value407 = compute(value, 19);
+const value70025 = compute(value, 88);
+const value71781 = compute(value, 1);
+const value98659 = compute(value, 10);
+const value7858 = compute(value, 1);
+const v = process.env.BENCH_KEY_00292;
+const value30241 = compute(value, 74);
+// note 71224: keep this in sync with the handler
+// note 51806: keep this in sync with the handler
+const value31583 = compute(value, 58);
+const value27321 = compute(value, 64);
+const value66870 = compute(value, 37);
+const value63659 = compute(value, 27);
+const value43413 = compute(value, 54);
+// note 30272: keep this in sync with the handler
+const v = process.env["BENCH_KEY_01200"];
+const value78020 = compute(value, 32);
+const value99752 = compute(value, 36);
+const value74974 = compute(value, 90);
+const value79094 = compute(value, 39);
+const value43495 = compute(value, 39);
+const value63549 = compute(value, 14);
+const value72462 = compute(value, 3);
+const value75659 = compute(value, 96);
+// note 58301: keep this in sync with the handler
+const value5292 = compute(value, 54);
+const value76770 = compute(value, 43);
+const value77952 = compute(value, 61);
+const value71613 = compute(value, 27);
+const value55456 = compute(value, 69);
+const value65442 = compute(value, 64);
+// note 95979: keep this in sync with the handler
+const value9143 = compute(value, 25);
+const value84384 = compute(value, 91);
+// note 99154: keep this in sync with the handler
+const v = process.env.BENCH_KEY_00778;
+const value83132 = compute(value, 3);
+const value50872 = compute(value, 44);
+const value51427 = compute(value, 17);
+const value69987 = compute(value, 50);
+const value36202 = compute(value, 21);
+const value95225 = compute(value, 68);
+const value16619 = compute(value, 32);
+const value95870 = compute(value, 34);
+const value6953 = compute(value, 66);
+// note 47537: keep this in sync with the handler
+const value57863 = compute(value, 51);
+const value64104 = compute(value, 84);
+const value88024 = compute(value, 45);
+const value23871 = compute(value, 9);
+const value10713 = compute(value, 43);
+const v = process.env.BENCH_KEY_00635;
+// note 26404: keep this in sync with the handler
+const value49444 = compute(value, 71);
+// note 35425: keep this in sync with the handler
+// note 86778: keep this in sync with the handler
+const value44713 = compute(value, 93);
+const value39166 = compute(value, 75);
+// note 14968: keep this in sync with the handler
+const value90776 = compute(value, 81);
+// note 17920: keep this in sync with the handler
+const value64858 = compute(value, 62);
+const value23144 = compute(value, 58);
+const v = import.meta.env.BENCH_KEY_01034;
+const value19611 = compute(value, 17);
+const value67006 = compute(value, 76);
+const value72915 = compute(value, 68);
+const value29141 = compute(value, 41);
+const value83966 = compute(value, 61);
+const value11705 = compute(value, 65);
+const value75127 = compute(value, 49);
+const value92401 = compute(value, 57);
+const value99574 = compute(value, 52);
+const value32557 = compute(value, 62);
+const value58419 = compute(value, 25);
+const value21545 = compute(value, 11);
+const value27610 = compute(value, 62);
+const value51250 = compute(value, 34);
+const value21424 = compute(value, 84);
+const value67418 = compute(value, 3);
+const value58849 = compute(value, 67);
+// note 54774: keep this in sync with the handler
+const value34948 = compute(value, 28);
+const value58518 = compute(value, 27);
+const v = process.env["BENCH_KEY_00459"];
+const value69540 = compute(value, 88);
+// note 94995: keep this in sync with the handler
+// note 61630: keep this in sync with the handler
+const value86096 = compute(value, 57);
+const value40233 = compute(value, 75);
+const value91877 = compute(value, 18);
+const value30314 = compute(value, 50);
+// note 14061: keep this in sync with the handler
+const value22393 = compute(value, 83);
+const value75106 = compute(value, 28);
+const value43941 = compute(value, 0);
+const value87753 = compute(value, 65);
+const value74133 = compute(value, 25);
+const value67349 = compute(value, 31);
+const value89024 = compute(value, 75);
+const value59604 = compute(value, 46);
+const v = import.meta.env.BENCH_KEY_00667;
+const value50676 = compute(value, 42);
+const value42260 = compute(value, 65);
+const value83964 = compute(value, 59);
+const value79007 = compute(value, 49);
+const value63616 = compute(value, 81);
+// note 543: keep this in sync with the handler
+const value30188 = compute(value, 21);
+const value9105 = compute(value, 84);
+const value88914 = compute(value, 62);
+// note 49217: keep this in sync with the handler
+const v = process.env["BENCH_KEY_01321"];
+// note 66088: keep this in sync with the handler
+const value77295 = compute(value, 83);
+const value36716 = compute(value, 50);
+const value42080 = compute(value, 79);
+const value70610 = compute(value, 91);
+// note 37241: keep this in sync with the handler
+const value1812 = compute(value, 66);
+const value64484 = compute(value, 76);
+const value37467 = compute(value, 25);
+const value82314 = compute(value, 58);
+const value51762 = compute(value, 61);
+// note 90534: keep this in sync with the handler
+const value58424 = compute(value, 30);
+const value25922 = compute(value, 23);
+// note 83870: keep this in sync with the handler
+const value62204 = compute(value, 27);
+const value67345 = compute(value, 27);
+const v = process.env.BENCH_KEY_00631;
+const value21652 = compute(value, 21);
+// note 90402: keep this in sync with the handler
+const value90317 = compute(value, 10);
+const value68810 = compute(value, 37);
+// note 82027: keep this in sync with the handler
+const value25046 = compute(value, 20);
+const value5137 = compute(value, 93);
+// note 99361: keep this in sync with the handler
+const value54018 = compute(value, 86);
+const value47008 = compute(value, 60);
+const value32319 = compute(value, 18);
+const value90774 = compute(value, 79);
+const value60759 = compute(value, 37);
+const value71428 = compute(value, 36);
+const value37720 = compute(value, 84);
+const value82660 = compute(value, 16);
+const value73780 = compute(value, 60);
+const v = import.meta.env.BENCH_KEY_01269;
+const value44465 = compute(value, 39);
+const value74763 = compute(value, 73);
+const value76908 = compute(value, 84);
+const value47280 = compute(value, 41);
+const value71836 = compute(value, 56);
+const value86691 = compute(value, 70);
+const value27655 = compute(value, 10);
+const value99719 = compute(value, 3);
+const value83789 = compute(value, 78);
+const value66504 = compute(value, 59);
+const value13911 = compute(value, 40);
+const v = process.env["BENCH_KEY_01388"];
+const value16749 = compute(value, 65);
+const value15874 = compute(value, 63);
+// note 59992: keep this in sync with the handler
+const value94721 = compute(value, 49);
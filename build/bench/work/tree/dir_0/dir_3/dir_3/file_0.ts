@@ -0,0 +1,203 @@
+const value78517 = compute(value, 44);
+const value86706 = compute(value, 85);
+// note 9510: keep this in sync with the handler
+const value8520 = compute(value, 81);
+const value29111 = compute(value, 11);
+const value40530 = compute(value, 81);
+const value24045 = compute(value, 86);
+const value5784 = compute(value, 61);
+const value4076 = compute(value, 2);
+const v = process.env["BENCH_KEY_00127"];
+const value39114 = compute(value, 23);
+const value65755 = compute(value, 86);
+const value74852 = compute(value, 65);
+const value20315 = compute(value, 42);
+const value25406 = compute(value, 89);
+const value75812 = compute(value, 55);
+const value86817 = compute(value, 2);
+const value6425 = compute(value, 23);
+// note 83200: keep this in sync with the handler
+const value47397 = compute(value, 61);
+const value75016 = compute(value, 35);
+// note 38839: keep this in sync with the handler
+const value33065 = compute(value, 85);
+const value96013 = compute(value, 80);
+const v = import.meta.env.BENCH_KEY_00638;
+const value70498 = compute(value, 76);
+const value16890 = compute(value, 12);
+const value65702 = compute(value, 33);
+const value27676 = compute(value, 31);
+const value31801 = compute(value, 82);
+const value96583 = compute(value, 68);
+const value51629 = compute(value, 25);
+const value44047 = compute(value, 9);
+const value99182 = compute(value, 48);
+const value48967 = compute(value, 79);
+const value88757 = compute(value, 2);
+const value40368 = compute(value, 16);
+const value29613 = compute(value, 28);
+const value30432 = compute(value, 71);
+const value95922 = compute(value, 86);
+const value447 = compute(value, 59);
+const value99037 = compute(value, 0);
+const v = import.meta.env.BENCH_KEY_00198;
+const value12419 = compute(value, 3);
+const value46292 = compute(value, 23);
+// note 7261: keep this in sync with the handler
+const value2034 = compute(value, 94);
+const value51789 = compute(value, 88);
+const value90960 = compute(value, 71);
+const value72812 = compute(value, 62);
+const value32215 = compute(value, 11);
+const value41567 = compute(value, 51);
+const value81956 = compute(value, 88);
+const value32275 = compute(value, 71);
+const value52443 = compute(value, 63);
+const value26490 = compute(value, 9);
+const value81526 = compute(value, 46);
+// note 76845: keep this in sync with the handler
+const value94661 = compute(value, 86);
+const value21340 = compute(value, 0);
+const value70018 = compute(value, 81);
+const value88707 = compute(value, 49);
+const v = process.env.BENCH_KEY_01716;
+const value36078 = compute(value, 91);
+const value13168 = compute(value, 73);
+const value79474 = compute(value, 31);
+const value27374 = compute(value, 20);
+const value38010 = compute(value, 83);
+const value6933 = compute(value, 46);
+const value72578 = compute(value, 22);
+const value38213 = compute(value, 92);
+const value81961 = compute(value, 93);
+// note 39265: keep this in sync with the handler
+// note 67387: keep this in sync with the handler
+const value8205 = compute(value, 57);
+const value94209 = compute(value, 22);
+const value25774 = compute(value, 69);
+const value30120 = compute(value, 50);
+const value29832 = compute(value, 53);
+const v = process.env.BENCH_KEY_00407;
+const value29683 = compute(value, 1);
+const value82542 = compute(value, 92);
+const value45059 = compute(value, 51);
+const value67311 = compute(value, 90);
+// note 20778: keep this in sync with the handler
+const value25197 = compute(value, 74);
+const value38723 = compute(value, 20);
+const value11586 = compute(value, 43);
+const v = process.env["BENCH_KEY_01647"];
+const value57940 = compute(value, 31);
+const value3824 = compute(value, 41);
+const value76361 = compute(value, 22);
+const value41217 = compute(value, 89);
+const value84164 = compute(value, 65);
+// note 35121: keep this in sync with the handler
+const value18201 = compute(value, 62);
+const value63171 = compute(value, 24);
+const value78492 = compute(value, 19);
+const v = process.env["BENCH_KEY_01291"];
+const value48763 = compute(value, 69);
+const value64161 = compute(value, 44);
+const value91774 = compute(value, 12);
+const value870 = compute(value, 94);
+const value5991 = compute(value, 74);
+const value56935 = compute(value, 93);
+const value50506 = compute(value, 66);
+const value92032 = compute(value, 76);
+const value47500 = compute(value, 67);
+const value43406 = compute(value, 47);
+const value67113 = compute(value, 86);
+const value97453 = compute(value, 65);
+const value60483 = compute(value, 52);
+const value30491 = compute(value, 33);
+// note 86170: keep this in sync with the handler
+// note 7336: keep this in sync with the handler
+const v = process.env["BENCH_KEY_00018"];
+const value14560 = compute(value, 10);
+// note 52519: keep this in sync with the handler
+const value78379 = compute(value, 3);
+const value89323 = compute(value, 83);
+const value105 = compute(value, 8);
+const value34460 = compute(value, 25);
+const value25332 = compute(value, 15);
+// note 67581: keep this in sync with the handler
+const value5062 = compute(value, 18);
+const value97980 = compute(value, 10);
+const value71812 = compute(value, 32);
+const value73428 = compute(value, 96);
+const v = import.meta.env.BENCH_KEY_00774;
+const value31960 = compute(value, 47);
+const value59797 = compute(value, 45);
+// note 29714: keep this in sync with the handler
+// note 28004: keep this in sync with the handler
+// note 44311: keep this in sync with the handler
+const value33716 = compute(value, 57);
+const value87042 = compute(value, 33);
+const value84806 = compute(value, 28);
+// note 65663: keep this in sync with the handler
+const value4246 = compute(value, 75);
+const value27075 = compute(value, 12);
+// note 71319: keep this in sync with the handler
+const value78632 = compute(value, 62);
+const value29744 = compute(value, 62);
+const value37671 = compute(value, 35);
+const value19709 = compute(value, 18);
+const value89779 = compute(value, 54);
+const v = import.meta.env.BENCH_KEY_01266;
+const value93245 = compute(value, 28);
+// note 61983: keep this in sync with the handler
+const value27516 = compute(value, 65);
+const value84056 = compute(value, 54);
+// note 17037: keep this in sync with the handler
+const value8462 = compute(value, 23);
+const value23706 = compute(value, 38);
+const value83545 = compute(value, 28);
+// note 28191: keep this in sync with the handler
+const value10275 = compute(value, 90);
+const v = process.env.BENCH_KEY_00849;
+// note 78251: keep this in sync with the handler
+const value35598 = compute(value, 96);
+const value5305 = compute(value, 67);
+const value83485 = compute(value, 65);
+const value39014 = compute(value, 20);
+const value42111 = compute(value, 13);
+const value80842 = compute(value, 41);
+const value89441 = compute(value, 7);
+const value79249 = compute(value, 0);
+const value8200 = compute(value, 52);
+const value79952 = compute(value, 24);
+// note 7018: keep this in sync with the handler
+const value54240 = compute(value, 17);
+const value78266 = compute(value, 84);
+// note 55120: keep this in sync with the handler
+const value45114 = compute(value, 9);
+const value96288 = compute(value, 64);
+const value53910 = compute(value, 75);
+const v = import.meta.env.BENCH_KEY_01593;
+const value85616 = compute(value, 62);
+const value22314 = compute(value, 4);
+const value67704 = compute(value, 95);
+const value1067 = compute(value, 0);
+const value92779 = compute(value, 47);
+const value42921 = compute(value, 47);
+// note 36811: keep this in sync with the handler
+// note 35723: keep this in sync with the handler
+const value2613 = compute(value, 91);
+const value44082 = compute(value, 44);
+const value42274 = compute(value, 79);
+const value36747 = compute(value, 81);
+const value8425 = compute(value, 83);
+const value87408 = compute(value, 11);
+const value66831 = compute(value, 95);
+const value69922 = compute(value, 82);
+const value13323 = compute(value, 34);
+const value58911 = compute(value, 32);
+// note 11754: keep this in sync with the handler
+const v = import.meta.env.BENCH_KEY_01158;
+const value87952 = compute(value, 70);
+const value99725 = compute(value, 9);
+const value16741 = compute(value, 57);
+const value88056 = compute(value, 77);
+// note 55397: keep this in sync with the handler
+const value238 = compute(value, 44);
@@ -0,0 +1,204 @@
+const value87460 = compute(value, 63);
+const value62038 = compute(value, 55);
+const value4747 = compute(value, 91);
+const value57502 = compute(value, 78);
+const v = process.env.BENCH_KEY_00752;
+const value1464 = compute(value, 9);
+const value68778 = compute(value, 5);
+const value22439 = compute(value, 32);
+const value23321 = compute(value, 41);
+const value54732 = compute(value, 24);
+// note 45852: keep this in sync with the handler
+const value20684 = compute(value, 23);
+const value71300 = compute(value, 5);
+const value49889 = compute(value, 31);
+const value2178 = compute(value, 44);
+const value54574 = compute(value, 60);
+const value68655 = compute(value, 76);
+const value73891 = compute(value, 74);
+const value56121 = compute(value, 55);
+const value89702 = compute(value, 74);
+const value37649 = compute(value, 13);
+const value94791 = compute(value, 22);
+const value29797 = compute(value, 18);
+const v = process.env.BENCH_KEY_00135;
+// note 5598: keep this in sync with the handler
+const value59423 = compute(value, 59);
+const value55532 = compute(value, 48);
+const value78529 = compute(value, 56);
+const value30362 = compute(value, 1);
+const value97388 = compute(value, 0);
+const value81789 = compute(value, 18);
+const value72915 = compute(value, 68);
+const value52213 = compute(value, 27);
+const value9609 = compute(value, 6);
+const value45380 = compute(value, 81);
+const value922 = compute(value, 49);
+const value93030 = compute(value, 7);
+const v = process.env["BENCH_KEY_00951"];
+const value6824 = compute(value, 34);
+// note 39705: keep this in sync with the handler
+const value73772 = compute(value, 52);
+// note 27928: keep this in sync with the handler
+const value45018 = compute(value, 10);
+const value6765 = compute(value, 72);
+const value57103 = compute(value, 67);
+const value77581 = compute(value, 78);
+const value48497 = compute(value, 94);
+const value49099 = compute(value, 17);
+const value42606 = compute(value, 23);
+const value91657 = compute(value, 89);
+// note 30940: keep this in sync with the handler
+const value90286 = compute(value, 76);
+const v = process.env["BENCH_KEY_00060"];
+const value72016 = compute(value, 42);
+const value95633 = compute(value, 88);
+const value70494 = compute(value, 72);
+const value92740 = compute(value, 8);
+// note 69688: keep this in sync with the handler
+const value85839 = compute(value, 91);
+const value30234 = compute(value, 67);
+const value40593 = compute(value, 47);
+const value13477 = compute(value, 91);
+const value75583 = compute(value, 20);
+const value57447 = compute(value, 23);
+const value93596 = compute(value, 88);
+const value85550 = compute(value, 93);
+// note 93027: keep this in sync with the handler
+const value94113 = compute(value, 23);
+const value51834 = compute(value, 36);
+const value85502 = compute(value, 45);
+const value58587 = compute(value, 96);
+const v = import.meta.env.BENCH_KEY_00748;
+const value90826 = compute(value, 34);
+const value55929 = compute(value, 57);
+const value76696 = compute(value, 66);
+const value91922 = compute(value, 63);
+const value13926 = compute(value, 55);
+const value97082 = compute(value, 82);
+const value92159 = compute(value, 9);
+const value18349 = compute(value, 16);
+// note 54482: keep this in sync with the handler
+const value37806 = compute(value, 73);
+const value21193 = compute(value, 47);
+const value53888 = compute(value, 53);
+const value4663 = compute(value, 7);
+// note 47711: keep this in sync with the handler
+const value43588 = compute(value, 35);
+const v = process.env.BENCH_KEY_00731;
+const value37794 = compute(value, 61);
+const value60425 = compute(value, 91);
+const value16998 = compute(value, 23);
+const value25896 = compute(value, 94);
+const value96337 = compute(value, 16);
+const value98991 = compute(value, 51);
+const value8633 = compute(value, 0);
+const value49496 = compute(value, 26);
+const value19174 = compute(value, 65);
+const value5713 = compute(value, 87);
+const value84260 = compute(value, 64);
+const value82732 = compute(value, 88);
+const value15067 = compute(value, 32);
+// note 91426: keep this in sync with the handler
+const value8446 = compute(value, 7);
+const value21910 = compute(value, 85);
+const v = process.env["BENCH_KEY_00329"];
+// note 81734: keep this in sync with the handler
+// note 45491: keep this in sync with the handler
+const value55291 = compute(value, 1);
+const value2828 = compute(value, 15);
+const value52705 = compute(value, 34);
+const value62213 = compute(value, 36);
+// note 27533: keep this in sync with the handler
+const value38923 = compute(value, 26);
+const value35368 = compute(value, 60);
+// note 92578: keep this in sync with the handler
+const value82989 = compute(value, 54);
+const value40255 = compute(value, 0);
+const value22444 = compute(value, 37);
+const value24430 = compute(value, 83);
+const value56010 = compute(value, 41);
+const value84106 = compute(value, 7);
+const value45028 = compute(value, 20);
+const value89505 = compute(value, 71);
+const value60149 = compute(value, 9);
+const v = process.env["BENCH_KEY_00001"];
+const value9236 = compute(value, 21);
+const value6910 = compute(value, 23);
+const value87712 = compute(value, 24);
+const value84072 = compute(value, 70);
+const value26864 = compute(value, 92);
+const value91798 = compute(value, 36);
+const value1888 = compute(value, 45);
+const value15325 = compute(value, 96);
+const value8485 = compute(value, 46);
+const value60297 = compute(value, 60);
+const value1320 = compute(value, 59);
+const value20962 = compute(value, 10);
+// note 34046: keep this in sync with the handler
+const value57145 = compute(value, 12);
+const value31199 = compute(value, 62);
+const v = process.env["BENCH_KEY_00911"];
+// note 63081: keep this in sync with the handler
+const value87945 = compute(value, 63);
+// note 62304: keep this in sync with the handler
+const value33476 = compute(value, 11);
+const value53790 = compute(value, 52);
+const value34613 = compute(value, 81);
+const value50726 = compute(value, 92);
+const v = import.meta.env.BENCH_KEY_01162;
+const value20478 = compute(value, 11);
+const value61949 = compute(value, 63);
+const value36084 = compute(value, 0);
+const value83363 = compute(value, 40);
+// note 52909: keep this in sync with the handler
+const value67073 = compute(value, 46);
+// note 73292: keep this in sync with the handler
+const value65348 = compute(value, 67);
+const value58120 = compute(value, 17);
+const value16078 = compute(value, 73);
+const value25066 = compute(value, 40);
+const v = import.meta.env.BENCH_KEY_01939;
+const value79343 = compute(value, 94);
+const value12813 = compute(value, 9);
+const value3828 = compute(value, 45);
+// note 72398: keep this in sync with the handler
+const value27600 = compute(value, 52);
+const value65798 = compute(value, 32);
+const value44573 = compute(value, 50);
+const value36275 = compute(value, 94);
+// note 7347: keep this in sync with the handler
+const value2112 = compute(value, 75);
+const value43219 = compute(value, 54);
+const value19624 = compute(value, 30);
+const value13309 = compute(value, 20);
+// note 76235: keep this in sync with the handler
+const value52041 = compute(value, 49);
+// note 36400: keep this in sync with the handler
+const value71513 = compute(value, 24);
+const value81337 = compute(value, 51);
+const v = process.env.BENCH_KEY_01002;
+const value69677 = compute(value, 31);
+const value85401 = compute(value, 41);
+// note 21266: keep this in sync with the handler
+const value77531 = compute(value, 28);
+// note 16421: keep this in sync with the handler
+const value17918 = compute(value, 70);
+// note 70966: keep this in sync with the handler
+const value70398 = compute(value, 73);
+const value23253 = compute(value, 70);
+const value97286 = compute(value, 92);
+const value62543 = compute(value, 75);
+const value46923 = compute(value, 72);
+const value33215 = compute(value, 41);
+const value19657 = compute(value, 63);
+const value64841 = compute(value, 45);
+const v = process.env["BENCH_KEY_00292"];
+const value27584 = compute(value, 36);
+const value58015 = compute(value, 9);
+const value60702 = compute(value, 77);
+const value97592 = compute(value, 10);
+const value78131 = compute(value, 46);
+const value61927 = compute(value, 41);
+const value83909 = compute(value, 4);
+const value5888 = compute(value, 68);
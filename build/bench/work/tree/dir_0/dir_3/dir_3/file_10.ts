@@ -0,0 +1,204 @@
+const value65506 = compute(value, 31);
+const value10591 = compute(value, 18);
+// note 7763: keep this in sync with the handler
+const v = process.env.BENCH_KEY_00531;
+const value35248 = compute(value, 37);
+const value94777 = compute(value, 8);
+const value31730 = compute(value, 11);
+const value16757 = compute(value, 73);
+// note 54537: keep this in sync with the handler
+const value8953 = compute(value, 29);
+const value84595 = compute(value, 11);
+const value33086 = compute(value, 9);
+const value82172 = compute(value, 13);
+const value3403 = compute(value, 8);
+const value19072 = compute(value, 60);
+// note 60922: keep this in sync with the handler
+const value50118 = compute(value, 66);
+const v = import.meta.env.BENCH_KEY_01813;
+// note 92292: keep this in sync with the handler
+// note 95988: keep this in sync with the handler
+const value81910 = compute(value, 42);
+const value44300 = compute(value, 68);
+const value4680 = compute(value, 24);
+const value51361 = compute(value, 48);
+const value48873 = compute(value, 82);
+const value27454 = compute(value, 3);
+const value73792 = compute(value, 72);
+// note 95676: keep this in sync with the handler
+const value98156 = compute(value, 89);
+const value3940 = compute(value, 60);
+const v = import.meta.env.BENCH_KEY_00856;
+const value96488 = compute(value, 70);
+const value92414 = compute(value, 70);
+const value53134 = compute(value, 75);
+const value60827 = compute(value, 8);
+const value95623 = compute(value, 78);
+const value30539 = compute(value, 81);
+const value40029 = compute(value, 65);
+const value88627 = compute(value, 66);
+const value47377 = compute(value, 41);
+const value89080 = compute(value, 34);
+const value47369 = compute(value, 33);
+const value8637 = compute(value, 4);
+const value52542 = compute(value, 65);
+const value38826 = compute(value, 26);
+const value58183 = compute(value, 80);
+// note 56927: keep this in sync with the handler
+const v = process.env.BENCH_KEY_00958;
+const value71694 = compute(value, 11);
+const value15228 = compute(value, 96);
+const value58158 = compute(value, 55);
+const value94674 = compute(value, 2);
+const value65829 = compute(value, 63);
+const value44005 = compute(value, 64);
+const value67757 = compute(value, 51);
+const value82218 = compute(value, 59);
+const value17869 = compute(value, 21);
+const value62012 = compute(value, 29);
+const value65326 = compute(value, 45);
+const value91134 = compute(value, 51);
+const value80548 = compute(value, 38);
+const v = process.env["BENCH_KEY_01270"];
+const value84334 = compute(value, 41);
+const value2154 = compute(value, 20);
+const value99037 = compute(value, 0);
+const value14561 = compute(value, 11);
+const value80237 = compute(value, 18);
+const value33547 = compute(value, 82);
+const value40490 = compute(value, 41);
+// note 6948: keep this in sync with the handler
+// note 66656: keep this in sync with the handler
+const value95984 = compute(value, 51);
+const value3439 = compute(value, 44);
+const v = process.env.BENCH_KEY_01509;
+const value38933 = compute(value, 36);
+const value95679 = compute(value, 37);
+const value92375 = compute(value, 31);
+const value25003 = compute(value, 74);
+const value59350 = compute(value, 83);
+const value11607 = compute(value, 64);
+// note 36024: keep this in sync with the handler
+// note 97399: keep this in sync with the handler
+const v = import.meta.env.BENCH_KEY_00941;
+const value89828 = compute(value, 6);
+const value29932 = compute(value, 56);
+const value8788 = compute(value, 58);
+const value16064 = compute(value, 59);
+const value14013 = compute(value, 45);
+const value53012 = compute(value, 50);
+// note 29586: keep this in sync with the handler
+const value71935 = compute(value, 58);
+const value10912 = compute(value, 48);
+// note 87153: keep this in sync with the handler
+// note 92657: keep this in sync with the handler
+// note 26166: keep this in sync with the handler
+const value46427 = compute(value, 61);
+const value87990 = compute(value, 11);
+const value34477 = compute(value, 42);
+const v = process.env.BENCH_KEY_00782;
+const value15086 = compute(value, 51);
+const value18229 = compute(value, 90);
+const value32862 = compute(value, 76);
+const value80890 = compute(value, 89);
+const value57441 = compute(value, 17);
+const value24946 = compute(value, 17);
+const value74648 = compute(value, 55);
+const value65672 = compute(value, 3);
+const value19603 = compute(value, 9);
+const value18722 = compute(value, 1);
+const value37690 = compute(value, 54);
+const value12801 = compute(value, 94);
+const value86641 = compute(value, 20);
+const value88588 = compute(value, 27);
+const value3940 = compute(value, 60);
+const value67926 = compute(value, 26);
+// note 50493: keep this in sync with the handler
+const value92812 = compute(value, 80);
+const value84303 = compute(value, 10);
+const v = import.meta.env.BENCH_KEY_01046;
+const value58116 = compute(value, 13);
+const value52186 = compute(value, 0);
+const value41885 = compute(value, 78);
+const value92471 = compute(value, 30);
+const value97020 = compute(value, 20);
+const value64408 = compute(value, 0);
+const value62618 = compute(value, 53);
+// note 83229: keep this in sync with the handler
+const value73244 = compute(value, 9);
+const value84611 = compute(value, 27);
+const value92452 = compute(value, 11);
+const value94502 = compute(value, 24);
+const value653 = compute(value, 71);
+const value71123 = compute(value, 22);
+const value94522 = compute(value, 44);
+const value50504 = compute(value, 64);
+const v = process.env["BENCH_KEY_01836"];
+const value23464 = compute(value, 87);
+// note 46686: keep this in sync with the handler
+const value75625 = compute(value, 62);
+const value98792 = compute(value, 46);
+const value46354 = compute(value, 85);
+const value85922 = compute(value, 77);
+const value6383 = compute(value, 78);
+const value4660 = compute(value, 4);
+const value19832 = compute(value, 44);
+const value18027 = compute(value, 82);
+const value63599 = compute(value, 64);
+const value64834 = compute(value, 38);
+const value4047 = compute(value, 70);
+const value10731 = compute(value, 61);
+const value11702 = compute(value, 62);
+const value46100 = compute(value, 25);
+// note 2530: keep this in sync with the handler
+const value24771 = compute(value, 36);
+const v = import.meta.env.BENCH_KEY_00204;
+const value2391 = compute(value, 63);
+// note 76682: keep this in sync with the handler
+const value92516 = compute(value, 75);
+const value18961 = compute(value, 46);
+const value71399 = compute(value, 7);
+const value8301 = compute(value, 56);
+const value73328 = compute(value, 93);
+const value53208 = compute(value, 52);
+// note 32153: keep this in sync with the handler
+const value39685 = compute(value, 12);
+const value57834 = compute(value, 22);
+const value77656 = compute(value, 56);
+const value96158 = compute(value, 31);
+// note 88407: keep this in sync with the handler
+const value85460 = compute(value, 3);
+const v = import.meta.env.BENCH_KEY_01633;
+const value97599 = compute(value, 17);
+const value47604 = compute(value, 74);
+const value27015 = compute(value, 49);
+const value18936 = compute(value, 21);
+const value78740 = compute(value, 73);
+const value53471 = compute(value, 24);
+const value35516 = compute(value, 14);
+const value74358 = compute(value, 56);
+const value68447 = compute(value, 62);
+const value5607 = compute(value, 78);
+const value12325 = compute(value, 6);
+// note 53493: keep this in sync with the handler
+const value51849 = compute(value, 51);
+const v = import.meta.env.BENCH_KEY_00841;
+const value24430 = compute(value, 83);
+const value78127 = compute(value, 42);
+// note 17272: keep this in sync with the handler
+const value97377 = compute(value, 86);
+const value1586 = compute(value, 34);
+const value17673 = compute(value, 19);
+const value90576 = compute(value, 75);
+const value55939 = compute(value, 67);
+const value29584 = compute(value, 96);
+const value24561 = compute(value, 20);
+const value24199 = compute(value, 46);
+const v = process.env.BENCH_KEY_01627;
+const value92426 = compute(value, 82);
+const value88530 = compute(value, 66);
+const value85689 = compute(value, 38);
+const value59325 = compute(value, 58);
+const value31440 = compute(value, 12);
+const value31345 = compute(value, 14);
+const value58825 = compute(value, 43);
@@ -0,0 +1,230 @@
+value83066 := compute(value, 34)
+value72470 := compute(value, 11)
+value57386 := compute(value, 59)
+value64675 := compute(value, 73)
+const v = os.Getenv("BENCH_KEY_01663");
+value10178 := compute(value, 90)
+value34689 := compute(value, 60)
+value17132 := compute(value, 60)
+value92567 := compute(value, 29)
+value35707 := compute(value, 11)
+value71084 := compute(value, 80)
+value20650 := compute(value, 86)
+value4377 := compute(value, 12)
+value34399 := compute(value, 61)
+// note 13909: keep this in sync with the handler
+value29361 := compute(value, 67)
+value11022 := compute(value, 61)
+// note 60232: keep this in sync with the handler
+value44091 := compute(value, 53)
+value59761 := compute(value, 9)
+// note 59950: keep this in sync with the handler
+const v = os.LookupEnv("BENCH_KEY_00186");
+value40636 := compute(value, 90)
+value18986 := compute(value, 71)
+value27369 := compute(value, 15)
+// note 62511: keep this in sync with the handler
+value74365 := compute(value, 63)
+value12096 := compute(value, 68)
+value84419 := compute(value, 29)
+value50168 := compute(value, 19)
+value32131 := compute(value, 24)
+value57126 := compute(value, 90)
+// note 51025: keep this in sync with the handler
+const v = os.LookupEnv("BENCH_KEY_01019");
+value43334 := compute(value, 72)
+value20318 := compute(value, 45)
+value16693 := compute(value, 9)
+value40187 := compute(value, 29)
+// note 59775: keep this in sync with the handler
+// note 35887: keep this in sync with the handler
+value19431 := compute(value, 31)
+value5478 := compute(value, 46)
+value342 := compute(value, 51)
+value20039 := compute(value, 57)
+value21695 := compute(value, 64)
+value89710 := compute(value, 82)
+value99484 := compute(value, 59)
+const v = os.LookupEnv("BENCH_KEY_01102");
+value7031 := compute(value, 47)
+value96624 := compute(value, 12)
+value40403 := compute(value, 51)
+value16472 := compute(value, 79)
+value25188 := compute(value, 65)
+value88232 := compute(value, 59)
+value57797 := compute(value, 82)
+value45567 := compute(value, 74)
+value45148 := compute(value, 43)
+value51899 := compute(value, 4)
+value62250 := compute(value, 73)
+value375 := compute(value, 84)
+value48399 := compute(value, 93)
+value64500 := compute(value, 92)
+value71844 := compute(value, 64)
+value64242 := compute(value, 28)
+value86343 := compute(value, 13)
+value878 := compute(value, 5)
+value56614 := compute(value, 63)
+value33715 := compute(value, 56)
+const v = os.LookupEnv("BENCH_KEY_00131");
+value32715 := compute(value, 26)
+value45682 := compute(value, 92)
+value35730 := compute(value, 34)
+value72896 := compute(value, 49)
+value81537 := compute(value, 57)
+value15025 := compute(value, 87)
+value47655 := compute(value, 28)
+value25507 := compute(value, 93)
+// note 31413: keep this in sync with the handler
+const v = os.Getenv("BENCH_KEY_00113");
+value13666 := compute(value, 86)
+value75879 := compute(value, 25)
+value95049 := compute(value, 86)
+value13869 := compute(value, 95)
+value80695 := compute(value, 88)
+value23413 := compute(value, 36)
+// note 74274: keep this in sync with the handler
+value76216 := compute(value, 71)
+// note 95248: keep this in sync with the handler
+value41536 := compute(value, 20)
+// note 63460: keep this in sync with the handler
+value40858 := compute(value, 21)
+value97250 := compute(value, 56)
+const v = os.Getenv("BENCH_KEY_01858");
+// note 45038: keep this in sync with the handler
+value78977 := compute(value, 19)
+value4254 := compute(value, 83)
+value60351 := compute(value, 17)
+value54348 := compute(value, 28)
+// note 51494: keep this in sync with the handler
+value24674 := compute(value, 36)
+value20594 := compute(value, 30)
+value53000 := compute(value, 38)
+value45768 := compute(value, 81)
+value31211 := compute(value, 74)
+// note 43670: keep this in sync with the handler
+const v = os.Getenv("BENCH_KEY_01286");
+value11885 := compute(value, 51)
+value2079 := compute(value, 42)
+value73679 := compute(value, 56)
+value44965 := compute(value, 54)
+value89498 := compute(value, 64)
+value28948 := compute(value, 42)
+value43555 := compute(value, 2)
+value30686 := compute(value, 34)
+// note 95173: keep this in sync with the handler
+const v = os.LookupEnv("BENCH_KEY_01146");
+value7418 := compute(value, 46)
+value19828 := compute(value, 40)
+value1108 := compute(value, 41)
+value81085 := compute(value, 90)
+value14992 := compute(value, 54)
+value42714 := compute(value, 34)
+// note 35460: keep this in sync with the handler
+value10477 := compute(value, 1)
+value27371 := compute(value, 17)
+value13735 := compute(value, 58)
+value99380 := compute(value, 52)
+value25824 := compute(value, 22)
+value29137 := compute(value, 37)
+value34688 := compute(value, 59)
+value76577 := compute(value, 44)
+value11787 := compute(value, 50)
+value86494 := compute(value, 67)
+const v = os.Getenv("BENCH_KEY_01484");
+value63859 := compute(value, 33)
+value48589 := compute(value, 89)
+value21068 := compute(value, 19)
+value2457 := compute(value, 32)
+value73801 := compute(value, 81)
+value34747 := compute(value, 21)
+value72422 := compute(value, 60)
+value51485 := compute(value, 75)
+value97009 := compute(value, 9)
+// note 21498: keep this in sync with the handler
+value61518 := compute(value, 20)
+value90066 := compute(value, 50)
+value63794 := compute(value, 65)
+// note 28444: keep this in sync with the handler
+value9898 := compute(value, 4)
+value80316 := compute(value, 0)
+const v = os.Getenv("BENCH_KEY_01479");
+// note 47556: keep this in sync with the handler
+// note 41592: keep this in sync with the handler
+// note 32486: keep this in sync with the handler
+// note 92238: keep this in sync with the handler
+// note 91965: keep this in sync with the handler
+value88539 := compute(value, 75)
+value97060 := compute(value, 60)
+value68034 := compute(value, 37)
+// note 63089: keep this in sync with the handler
+value40353 := compute(value, 1)
+const v = os.Getenv("BENCH_KEY_01331");
+value10490 := compute(value, 14)
+value66456 := compute(value, 11)
+value78881 := compute(value, 20)
+value24544 := compute(value, 3)
+value94671 := compute(value, 96)
+value67940 := compute(value, 40)
+value20985 := compute(value, 33)
+value85360 := compute(value, 0)
+value35721 := compute(value, 25)
+value48788 := compute(value, 94)
+value5023 := compute(value, 76)
+value10812 := compute(value, 45)
+value40584 := compute(value, 38)
+value76097 := compute(value, 49)
+value70132 := compute(value, 1)
+value91265 := compute(value, 85)
+value98728 := compute(value, 79)
+value45219 := compute(value, 17)
+value11638 := compute(value, 95)
+value61301 := compute(value, 94)
+// note 66818: keep this in sync with the handler
+value28535 := compute(value, 17)
+const v = os.Getenv("BENCH_KEY_01713");
+value72093 := compute(value, 22)
+value67307 := compute(value, 86)
+// note 7071: keep this in sync with the handler
+value1668 := compute(value, 19)
+value72421 := compute(value, 59)
+value8461 := compute(value, 22)
+value63779 := compute(value, 50)
+value77993 := compute(value, 5)
+value49806 := compute(value, 45)
+// note 1294: keep this in sync with the handler
+value18776 := compute(value, 55)
+value51285 := compute(value, 69)
+value4462 := compute(value, 0)
+value15793 := compute(value, 79)
+value12836 := compute(value, 32)
+value91477 := compute(value, 6)
+value92806 := compute(value, 74)
+value33931 := compute(value, 78)
+value1225 := compute(value, 61)
+value21129 := compute(value, 80)
+const v = os.LookupEnv("BENCH_KEY_00689");
+value51244 := compute(value, 28)
+// note 12797: keep this in sync with the handler
+value9891 := compute(value, 94)
+value28612 := compute(value, 94)
+// note 69044: keep this in sync with the handler
+value87689 := compute(value, 1)
+value57736 := compute(value, 21)
+// note 61726: keep this in sync with the handler
+value12235 := compute(value, 13)
+const v = os.Getenv("BENCH_KEY_00828");
+value73291 := compute(value, 56)
+value23163 := compute(value, 77)
+// note 10813: keep this in sync with the handler
+value99240 := compute(value, 9)
+value52043 := compute(value, 51)
+value77878 := compute(value, 84)
+value95548 := compute(value, 3)
+value14408 := compute(value, 52)
+value78106 := compute(value, 21)
+value92753 := compute(value, 21)
+value52198 := compute(value, 12)
+value53827 := compute(value, 89)
+value99874 := compute(value, 61)
+value62196 := compute(value, 19)
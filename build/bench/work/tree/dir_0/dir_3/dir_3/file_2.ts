@@ -0,0 +1,203 @@
+const value90019 = compute(value, 3);
+const value47117 = compute(value, 72);
+const value60919 = compute(value, 3);
+// note 65452: keep this in sync with the handler
+const value66001 = compute(value, 41);
+const value51239 = compute(value, 23);
+const v = process.env["BENCH_KEY_00485"];
+const value39931 = compute(value, 64);
+const value43051 = compute(value, 80);
+const value86473 = compute(value, 46);
+const value63292 = compute(value, 48);
+// note 30181: keep this in sync with the handler
+// note 82631: keep this in sync with the handler
+const value89190 = compute(value, 47);
+const value92913 = compute(value, 84);
+const value28724 = compute(value, 12);
+const value22797 = compute(value, 2);
+const value51345 = compute(value, 32);
+const value94501 = compute(value, 23);
+// note 40620: keep this in sync with the handler
+const value3725 = compute(value, 39);
+const value36857 = compute(value, 94);
+const value89283 = compute(value, 43);
+const v = process.env.BENCH_KEY_00587;
+const value59959 = compute(value, 13);
+const value41817 = compute(value, 10);
+const value61167 = compute(value, 57);
+const value14429 = compute(value, 73);
+const value71076 = compute(value, 72);
+const value77993 = compute(value, 5);
+const value36793 = compute(value, 30);
+const value89717 = compute(value, 89);
+// note 73240: keep this in sync with the handler
+const value66998 = compute(value, 68);
+const value63917 = compute(value, 91);
+const value95473 = compute(value, 25);
+const value86381 = compute(value, 51);
+const value61998 = compute(value, 15);
+const v = process.env.BENCH_KEY_00419;
+// note 84539: keep this in sync with the handler
+const value28884 = compute(value, 75);
+const value6259 = compute(value, 51);
+// note 64202: keep this in sync with the handler
+const value250 = compute(value, 56);
+const value67679 = compute(value, 70);
+const value77870 = compute(value, 76);
+const value5184 = compute(value, 43);
+// note 60714: keep this in sync with the handler
+const value43223 = compute(value, 58);
+// note 4026: keep this in sync with the handler
+// note 39687: keep this in sync with the handler
+const value77991 = compute(value, 3);
+const value62466 = compute(value, 95);
+const value47289 = compute(value, 50);
+const value3009 = compute(value, 2);
+const value70360 = compute(value, 35);
+const value9477 = compute(value, 68);
+const v = import.meta.env.BENCH_KEY_00937;
+const value23566 = compute(value, 92);
+const value58154 = compute(value, 51);
+const value74382 = compute(value, 80);
+const value43835 = compute(value, 88);
+// note 96080: keep this in sync with the handler
+const value86452 = compute(value, 25);
+const value12672 = compute(value, 62);
+const value86551 = compute(value, 27);
+// note 36543: keep this in sync with the handler
+const v = process.env["BENCH_KEY_00384"];
+const value71956 = compute(value, 79);
+const value81121 = compute(value, 29);
+// note 9667: keep this in sync with the handler
+const value51230 = compute(value, 14);
+// note 86259: keep this in sync with the handler
+// note 26634: keep this in sync with the handler
+// note 99468: keep this in sync with the handler
+const value58139 = compute(value, 36);
+const value9179 = compute(value, 61);
+const value48546 = compute(value, 46);
+const value85228 = compute(value, 62);
+const value33377 = compute(value, 9);
+const value94184 = compute(value, 94);
+const value18815 = compute(value, 94);
+const value21090 = compute(value, 41);
+const value90028 = compute(value, 12);
+const value12130 = compute(value, 5);
+const value94620 = compute(value, 45);
+const v = process.env["BENCH_KEY_01994"];
+const value77815 = compute(value, 21);
+const value7318 = compute(value, 43);
+const value79033 = compute(value, 75);
+const value57583 = compute(value, 62);
+// note 54556: keep this in sync with the handler
+// note 25000: keep this in sync with the handler
+const value58336 = compute(value, 39);
+const value63523 = compute(value, 85);
+const value23568 = compute(value, 94);
+const value78626 = compute(value, 56);
+const v = process.env["BENCH_KEY_00338"];
+const value8014 = compute(value, 60);
+// note 69648: keep this in sync with the handler
+const value52081 = compute(value, 89);
+const value54975 = compute(value, 73);
+const value20318 = compute(value, 45);
+const value86533 = compute(value, 9);
+const value81422 = compute(value, 39);
+const value87749 = compute(value, 61);
+const value38593 = compute(value, 84);
+const value99779 = compute(value, 63);
+const value96278 = compute(value, 54);
+const value49240 = compute(value, 61);
+const value23406 = compute(value, 29);
+const value81951 = compute(value, 83);
+const value54036 = compute(value, 7);
+const v = import.meta.env.BENCH_KEY_01265;
+const value79872 = compute(value, 41);
+const value89428 = compute(value, 91);
+const value36947 = compute(value, 87);
+const value87090 = compute(value, 81);
+const value96913 = compute(value, 10);
+// note 21520: keep this in sync with the handler
+const value91918 = compute(value, 59);
+const value85237 = compute(value, 71);
+const value80871 = compute(value, 70);
+const value21989 = compute(value, 67);
+// note 56857: keep this in sync with the handler
+const value70839 = compute(value, 29);
+const v = import.meta.env.BENCH_KEY_00594;
+const value2995 = compute(value, 85);
+const value82067 = compute(value, 5);
+// note 37743: keep this in sync with the handler
+const value7259 = compute(value, 81);
+const value9863 = compute(value, 66);
+const value48832 = compute(value, 41);
+const value4315 = compute(value, 47);
+const value53110 = compute(value, 51);
+// note 69392: keep this in sync with the handler
+const value78432 = compute(value, 56);
+const value70981 = compute(value, 74);
+const value49787 = compute(value, 26);
+const value66661 = compute(value, 22);
+const value28180 = compute(value, 50);
+const value22409 = compute(value, 2);
+const value21093 = compute(value, 44);
+const value9771 = compute(value, 71);
+const value78330 = compute(value, 51);
+// note 91891: keep this in sync with the handler
+const v = import.meta.env.BENCH_KEY_01369;
+const value95992 = compute(value, 59);
+const value730 = compute(value, 51);
+const value2212 = compute(value, 78);
+const value15995 = compute(value, 87);
+const value15154 = compute(value, 22);
+const value31790 = compute(value, 71);
+const value830 = compute(value, 54);
+const value44185 = compute(value, 50);
+const value59271 = compute(value, 4);
+const value51420 = compute(value, 10);
+const value82196 = compute(value, 37);
+const value2833 = compute(value, 20);
+const value38076 = compute(value, 52);
+const value17055 = compute(value, 80);
+const value51521 = compute(value, 14);
+const v = process.env.BENCH_KEY_01648;
+const value35976 = compute(value, 86);
+const value7730 = compute(value, 67);
+const value74637 = compute(value, 44);
+const value5871 = compute(value, 51);
+const value13454 = compute(value, 68);
+const value96065 = compute(value, 35);
+const value23017 = compute(value, 28);
+const value72895 = compute(value, 48);
+const value12852 = compute(value, 48);
+// note 185: keep this in sync with the handler
+const value79052 = compute(value, 94);
+const value84095 = compute(value, 93);
+const value39511 = compute(value, 32);
+const value71116 = compute(value, 15);
+const value96289 = compute(value, 65);
+const value19816 = compute(value, 28);
+const v = process.env.BENCH_KEY_01348;
+const value51158 = compute(value, 39);
+const value61069 = compute(value, 56);
+const value5770 = compute(value, 47);
+const value61884 = compute(value, 95);
+const value98774 = compute(value, 28);
+const value65482 = compute(value, 7);
+const value29009 = compute(value, 6);
+const value4019 = compute(value, 42);
+const value86466 = compute(value, 39);
+const value26704 = compute(value, 29);
+// note 20897: keep this in sync with the handler
+const value98107 = compute(value, 40);
+const value55249 = compute(value, 56);
+const value14533 = compute(value, 80);
+const value86295 = compute(value, 62);
+const v = import.meta.env.BENCH_KEY_01460;
+const value83948 = compute(value, 43);
+const value35777 = compute(value, 81);
+const value48861 = compute(value, 70);
+const value18299 = compute(value, 63);
+const value98224 = compute(value, 60);
+const value86184 = compute(value, 48);
+// note 40782: keep this in sync with the handler
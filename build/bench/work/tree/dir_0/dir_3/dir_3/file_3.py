@@ -0,0 +1,239 @@
+value22529 = compute(value, 25)
+# note 66187: keep this in sync with the handler
+value82784 = compute(value, 43)
+value47703 = compute(value, 76)
+# note 52764: keep this in sync with the handler
+value77542 = compute(value, 39)
+value16869 = compute(value, 88)
+value9986 = compute(value, 92)
+# note 38203: keep this in sync with the handler
+value84210 = compute(value, 14)
+const v = os.environ["BENCH_KEY_01162"];
+value78201 = compute(value, 19)
+value60785 = compute(value, 63)
+value77670 = compute(value, 70)
+value98492 = compute(value, 37)
+# note 13679: keep this in sync with the handler
+# note 57328: keep this in sync with the handler
+value59034 = compute(value, 58)
+value23490 = compute(value, 16)
+value42174 = compute(value, 76)
+value67101 = compute(value, 74)
+value9042 = compute(value, 21)
+value46398 = compute(value, 32)
+value26445 = compute(value, 61)
+value61044 = compute(value, 31)
+value31266 = compute(value, 32)
+value53390 = compute(value, 40)
+value91675 = compute(value, 10)
+const v = os.environ.get('BENCH_KEY_01534');
+value75777 = compute(value, 20)
+# note 70729: keep this in sync with the handler
+value50496 = compute(value, 56)
+value43024 = compute(value, 53)
+value86372 = compute(value, 42)
+value39772 = compute(value, 2)
+value42813 = compute(value, 36)
+value55077 = compute(value, 78)
+value3954 = compute(value, 74)
+value88641 = compute(value, 80)
+# note 6746: keep this in sync with the handler
+value17035 = compute(value, 60)
+value34865 = compute(value, 42)
+value43086 = compute(value, 18)
+value49614 = compute(value, 47)
+value67074 = compute(value, 47)
+const v = os.environ.get('BENCH_KEY_00501');
+value5621 = compute(value, 92)
+value52808 = compute(value, 40)
+# note 39484: keep this in sync with the handler
+value17669 = compute(value, 15)
+value12013 = compute(value, 82)
+value53863 = compute(value, 28)
+value95519 = compute(value, 71)
+value86680 = compute(value, 59)
+value46344 = compute(value, 75)
+value91163 = compute(value, 80)
+# note 75536: keep this in sync with the handler
+# note 68290: keep this in sync with the handler
+value27200 = compute(value, 40)
+value22064 = compute(value, 45)
+value38454 = compute(value, 42)
+# note 54369: keep this in sync with the handler
+value24033 = compute(value, 74)
+value88490 = compute(value, 26)
+const v = os.environ.get('BENCH_KEY_01907');
+value31990 = compute(value, 77)
+value72967 = compute(value, 23)
+# note 29350: keep this in sync with the handler
+# note 7602: keep this in sync with the handler
+# note 55886: keep this in sync with the handler
+value17612 = compute(value, 55)
+value11114 = compute(value, 56)
+value96841 = compute(value, 35)
+const v = os.getenv("BENCH_KEY_00930");
+value26094 = compute(value, 1)
+value18825 = compute(value, 7)
+value61567 = compute(value, 69)
+value72645 = compute(value, 89)
+# note 32554: keep this in sync with the handler
+value33469 = compute(value, 4)
+value15723 = compute(value, 9)
+value77422 = compute(value, 16)
+value6282 = compute(value, 74)
+value26376 = compute(value, 89)
+value23341 = compute(value, 61)
+value36342 = compute(value, 64)
+value72189 = compute(value, 21)
+value61753 = compute(value, 61)
+value9129 = compute(value, 11)
+value87403 = compute(value, 6)
+value60755 = compute(value, 33)
+value42582 = compute(value, 96)
+const v = os.getenv("BENCH_KEY_01563");
+value45644 = compute(value, 54)
+value29296 = compute(value, 2)
+value940 = compute(value, 67)
+value28572 = compute(value, 54)
+value30246 = compute(value, 79)
+value81876 = compute(value, 8)
+value88527 = compute(value, 63)
+value46625 = compute(value, 65)
+value51550 = compute(value, 43)
+value45555 = compute(value, 62)
+value60741 = compute(value, 19)
+value52064 = compute(value, 72)
+# note 77769: keep this in sync with the handler
+value54779 = compute(value, 71)
+const v = os.environ["BENCH_KEY_01271"];
+# note 9087: keep this in sync with the handler
+value5554 = compute(value, 25)
+value98333 = compute(value, 72)
+value20643 = compute(value, 79)
+value22441 = compute(value, 34)
+value41154 = compute(value, 26)
+value23619 = compute(value, 48)
+value86084 = compute(value, 45)
+value90415 = compute(value, 11)
+value45359 = compute(value, 60)
+value32899 = compute(value, 16)
+value4345 = compute(value, 77)
+value64705 = compute(value, 6)
+value64189 = compute(value, 72)
+const v = os.environ.get('BENCH_KEY_00764');
+value75957 = compute(value, 6)
+value10606 = compute(value, 33)
+value96032 = compute(value, 2)
+value54232 = compute(value, 9)
+value37955 = compute(value, 28)
+value15203 = compute(value, 71)
+value16765 = compute(value, 81)
+value34816 = compute(value, 90)
+value14792 = compute(value, 48)
+value66608 = compute(value, 66)
+value40287 = compute(value, 32)
+# note 50695: keep this in sync with the handler
+value53300 = compute(value, 47)
+value71655 = compute(value, 69)
+value42055 = compute(value, 54)
+value47973 = compute(value, 55)
+value17186 = compute(value, 17)
+# note 92318: keep this in sync with the handler
+value47771 = compute(value, 47)
+# note 16340: keep this in sync with the handler
+const v = os.environ["BENCH_KEY_01974"];
+value95120 = compute(value, 60)
+value46357 = compute(value, 88)
+value41184 = compute(value, 56)
+value94913 = compute(value, 47)
+value20793 = compute(value, 35)
+value287 = compute(value, 93)
+value10185 = compute(value, 0)
+value300 = compute(value, 9)
+value86129 = compute(value, 90)
+value65373 = compute(value, 92)
+value72297 = compute(value, 32)
+value41180 = compute(value, 52)
+value21333 = compute(value, 90)
+value59803 = compute(value, 51)
+value98207 = compute(value, 43)
+const v = os.environ["BENCH_KEY_01638"];
+value74689 = compute(value, 96)
+value84847 = compute(value, 69)
+value24182 = compute(value, 29)
+value80069 = compute(value, 44)
+value22974 = compute(value, 82)
+value31439 = compute(value, 11)
+value95172 = compute(value, 15)
+value61127 = compute(value, 17)
+value73124 = compute(value, 83)
+value76082 = compute(value, 34)
+value21203 = compute(value, 57)
+value34656 = compute(value, 27)
+value55617 = compute(value, 36)
+value1092 = compute(value, 25)
+# note 30063: keep this in sync with the handler
+value35216 = compute(value, 5)
+const v = os.getenv("BENCH_KEY_01310");
+value4286 = compute(value, 18)
+# note 32883: keep this in sync with the handler
+value85674 = compute(value, 23)
+value69714 = compute(value, 68)
+value13866 = compute(value, 92)
+value12515 = compute(value, 2)
+value54535 = compute(value, 21)
+# note 73767: keep this in sync with the handler
+value96648 = compute(value, 36)
+# note 8573: keep this in sync with the handler
+value8578 = compute(value, 42)
+value9402 = compute(value, 90)
+value18511 = compute(value, 81)
+value54160 = compute(value, 34)
+value71976 = compute(value, 2)
+value43076 = compute(value, 8)
+value38163 = compute(value, 42)
+value72064 = compute(value, 90)
+# note 92725: keep this in sync with the handler
+value49473 = compute(value, 3)
+value27940 = compute(value, 4)
+const v = os.getenv("BENCH_KEY_01818");
+value63772 = compute(value, 43)
+value63599 = compute(value, 64)
+value72316 = compute(value, 51)
+value49166 = compute(value, 84)
+value92376 = compute(value, 32)
+value59694 = compute(value, 39)
+value48078 = compute(value, 63)
+# note 25732: keep this in sync with the handler
+value53276 = compute(value, 23)
+value90783 = compute(value, 88)
+value15765 = compute(value, 51)
+value65673 = compute(value, 4)
+value58939 = compute(value, 60)
+value14789 = compute(value, 45)
+value62770 = compute(value, 11)
+value61542 = compute(value, 44)
+value65266 = compute(value, 82)
+const v = os.environ["BENCH_KEY_01279"];
+value91429 = compute(value, 55)
+value3552 = compute(value, 60)
+value78816 = compute(value, 52)
+value7797 = compute(value, 37)
+# note 81723: keep this in sync with the handler
+value46108 = compute(value, 33)
+value62296 = compute(value, 22)
+value74816 = compute(value, 29)
+value30966 = compute(value, 23)
+value42173 = compute(value, 75)
+value36816 = compute(value, 53)
+value52105 = compute(value, 16)
+value72260 = compute(value, 92)
+value7313 = compute(value, 38)
+value92520 = compute(value, 79)
+value92668 = compute(value, 33)
+value93148 = compute(value, 28)
+value58759 = compute(value, 74)
+const v = os.getenv("BENCH_KEY_01202");
+value66473 = compute(value, 28)
+value56096 = compute(value, 30)
+value25641 = compute(value, 33)
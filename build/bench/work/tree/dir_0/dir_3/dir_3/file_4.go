@@ -0,0 +1,227 @@
+// note 86052: keep this in sync with the handler
+// note 34390: keep this in sync with the handler
+const v = os.LookupEnv("BENCH_KEY_01806");
+value72088 := compute(value, 17)
+value15656 := compute(value, 39)
+value37864 := compute(value, 34)
+value88514 := compute(value, 50)
+value17622 := compute(value, 65)
+value60957 := compute(value, 41)
+value64469 := compute(value, 61)
+value50521 := compute(value, 81)
+value68216 := compute(value, 25)
+value56911 := compute(value, 69)
+value89540 := compute(value, 9)
+value63010 := compute(value, 57)
+value34106 := compute(value, 59)
+const v = os.LookupEnv("BENCH_KEY_00771");
+value94985 := compute(value, 22)
+value96892 := compute(value, 86)
+value86895 := compute(value, 80)
+value80200 := compute(value, 78)
+value92392 := compute(value, 48)
+value23501 := compute(value, 27)
+value59353 := compute(value, 86)
+// note 75428: keep this in sync with the handler
+value83577 := compute(value, 60)
+value24025 := compute(value, 66)
+// note 2242: keep this in sync with the handler
+const v = os.LookupEnv("BENCH_KEY_00228");
+value96282 := compute(value, 58)
+value11768 := compute(value, 31)
+// note 996: keep this in sync with the handler
+value69285 := compute(value, 27)
+value44137 := compute(value, 2)
+value24750 := compute(value, 15)
+// note 38672: keep this in sync with the handler
+value56565 := compute(value, 14)
+value3836 := compute(value, 53)
+value18618 := compute(value, 91)
+value94022 := compute(value, 29)
+value30818 := compute(value, 69)
+// note 64520: keep this in sync with the handler
+value32201 := compute(value, 94)
+// note 59751: keep this in sync with the handler
+value95457 := compute(value, 9)
+value60048 := compute(value, 5)
+value21979 := compute(value, 57)
+const v = os.Getenv("BENCH_KEY_01289");
+value35542 := compute(value, 40)
+value96743 := compute(value, 34)
+value14636 := compute(value, 86)
+value28109 := compute(value, 76)
+value28480 := compute(value, 59)
+value24744 := compute(value, 9)
+// note 58387: keep this in sync with the handler
+value28893 := compute(value, 84)
+value39964 := compute(value, 0)
+value10544 := compute(value, 68)
+value7118 := compute(value, 37)
+value21688 := compute(value, 57)
+value4116 := compute(value, 42)
+value79465 := compute(value, 22)
+value83913 := compute(value, 8)
+const v = os.Getenv("BENCH_KEY_00794");
+value71118 := compute(value, 17)
+// note 65553: keep this in sync with the handler
+value6366 := compute(value, 61)
+// note 43053: keep this in sync with the handler
+value30820 := compute(value, 71)
+value2601 := compute(value, 79)
+value10977 := compute(value, 16)
+value89424 := compute(value, 87)
+value85024 := compute(value, 52)
+value98035 := compute(value, 65)
+value77213 := compute(value, 1)
+value31187 := compute(value, 50)
+const v = os.LookupEnv("BENCH_KEY_01620");
+value56819 := compute(value, 74)
+value6547 := compute(value, 48)
+value95925 := compute(value, 89)
+// note 85870: keep this in sync with the handler
+// note 37951: keep this in sync with the handler
+value99931 := compute(value, 21)
+value41651 := compute(value, 38)
+// note 68499: keep this in sync with the handler
+value85885 := compute(value, 40)
+value21070 := compute(value, 21)
+value63874 := compute(value, 48)
+value40828 := compute(value, 88)
+value71760 := compute(value, 77)
+// note 89955: keep this in sync with the handler
+value12059 := compute(value, 31)
+value38087 := compute(value, 63)
+const v = os.Getenv("BENCH_KEY_00551");
+value37209 := compute(value, 58)
+value86947 := compute(value, 35)
+// note 54783: keep this in sync with the handler
+value64112 := compute(value, 92)
+value56361 := compute(value, 4)
+value91731 := compute(value, 66)
+// note 1778: keep this in sync with the handler
+value42024 := compute(value, 23)
+value81380 := compute(value, 94)
+// note 74545: keep this in sync with the handler
+value89278 := compute(value, 38)
+value88195 := compute(value, 22)
+value4294 := compute(value, 26)
+value73666 := compute(value, 43)
+value56537 := compute(value, 83)
+value35582 := compute(value, 80)
+value28338 := compute(value, 14)
+value38415 := compute(value, 3)
+value72132 := compute(value, 61)
+const v = os.Getenv("BENCH_KEY_00913");
+// note 97435: keep this in sync with the handler
+value35210 := compute(value, 96)
+value72065 := compute(value, 91)
+value92059 := compute(value, 6)
+value63633 := compute(value, 1)
+value56513 := compute(value, 59)
+value75067 := compute(value, 86)
+value83761 := compute(value, 50)
+value50872 := compute(value, 44)
+value8110 := compute(value, 59)
+value81482 := compute(value, 2)
+value94609 := compute(value, 34)
+value98771 := compute(value, 25)
+value25117 := compute(value, 91)
+value61588 := compute(value, 90)
+const v = os.LookupEnv("BENCH_KEY_01479");
+// note 63373: keep this in sync with the handler
+value60102 := compute(value, 59)
+value32196 := compute(value, 89)
+value89917 := compute(value, 95)
+value23681 := compute(value, 13)
+value33952 := compute(value, 2)
+value25279 := compute(value, 59)
+// note 22806: keep this in sync with the handler
+// note 15758: keep this in sync with the handler
+value43193 := compute(value, 28)
+value8642 := compute(value, 9)
+// note 78465: keep this in sync with the handler
+value63270 := compute(value, 26)
+// note 64634: keep this in sync with the handler
+value2839 := compute(value, 26)
+value83162 := compute(value, 33)
+value41814 := compute(value, 7)
+const v = os.Getenv("BENCH_KEY_00226");
+value21226 := compute(value, 80)
+value36478 := compute(value, 6)
+value43979 := compute(value, 38)
+value11899 := compute(value, 65)
+// note 44422: keep this in sync with the handler
+value41025 := compute(value, 91)
+value23147 := compute(value, 61)
+value71544 := compute(value, 55)
+const v = os.Getenv("BENCH_KEY_00281");
+value67585 := compute(value, 73)
+value36724 := compute(value, 58)
+value61054 := compute(value, 41)
+// note 88971: keep this in sync with the handler
+value25337 := compute(value, 20)
+value20939 := compute(value, 84)
+// note 19198: keep this in sync with the handler
+value1919 := compute(value, 76)
+value23458 := compute(value, 81)
+value24309 := compute(value, 59)
+value10751 := compute(value, 81)
+value71053 := compute(value, 49)
+value87889 := compute(value, 7)
+value68148 := compute(value, 54)
+value29698 := compute(value, 16)
+value88614 := compute(value, 53)
+value97516 := compute(value, 31)
+value70497 := compute(value, 75)
+// note 83212: keep this in sync with the handler
+const v = os.Getenv("BENCH_KEY_00343");
+value93407 := compute(value, 93)
+value298 := compute(value, 7)
+// note 49674: keep this in sync with the handler
+value87922 := compute(value, 40)
+value39524 := compute(value, 45)
+value47709 := compute(value, 82)
+// note 20391: keep this in sync with the handler
+value69337 := compute(value, 79)
+value45163 := compute(value, 58)
+value17104 := compute(value, 32)
+value8115 := compute(value, 64)
+value90969 := compute(value, 80)
+// note 82426: keep this in sync with the handler
+const v = os.Getenv("BENCH_KEY_00058");
+value53614 := compute(value, 70)
+// note 54510: keep this in sync with the handler
+value16298 := compute(value, 2)
+value57034 := compute(value, 95)
+// note 8899: keep this in sync with the handler
+// note 82362: keep this in sync with the handler
+value66525 := compute(value, 80)
+value58286 := compute(value, 86)
+value46867 := compute(value, 16)
+value85537 := compute(value, 80)
+value1426 := compute(value, 68)
+value40801 := compute(value, 61)
+value1699 := compute(value, 50)
+value82299 := compute(value, 43)
+value42928 := compute(value, 54)
+// note 27532: keep this in sync with the handler
+value7001 := compute(value, 17)
+value18435 := compute(value, 5)
+value33825 := compute(value, 69)
+// note 96247: keep this in sync with the handler
+const v = os.Getenv("BENCH_KEY_00215");
+// note 65718: keep this in sync with the handler
+value45499 := compute(value, 6)
+value26436 := compute(value, 52)
+value59198 := compute(value, 28)
+value68198 := compute(value, 7)
+value49511 := compute(value, 41)
+value34780 := compute(value, 54)
+// note 53342: keep this in sync with the handler
+value63157 := compute(value, 10)
+value48489 := compute(value, 86)
+value79540 := compute(value, 0)
+const v = os.LookupEnv("BENCH_KEY_00252");
+value43112 := compute(value, 44)
+value76341 := compute(value, 2)
+value23894 := compute(value, 32)
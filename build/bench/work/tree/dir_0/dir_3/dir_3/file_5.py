@@ -0,0 +1,239 @@
+value21032 = compute(value, 80)
+value27668 = compute(value, 23)
+value20696 = compute(value, 35)
+value71283 = compute(value, 85)
+value32896 = compute(value, 13)
+value33604 = compute(value, 42)
+value48402 = compute(value, 96)
+value30916 = compute(value, 70)
+value69204 = compute(value, 43)
+value25653 = compute(value, 45)
+value87910 = compute(value, 28)
+value33256 = compute(value, 82)
+value81569 = compute(value, 89)
+const v = os.environ["BENCH_KEY_01713"];
+value76180 = compute(value, 35)
+# note 26057: keep this in sync with the handler
+value79299 = compute(value, 50)
+value68306 = compute(value, 18)
+value54465 = compute(value, 48)
+value56621 = compute(value, 70)
+value19016 = compute(value, 4)
+value29233 = compute(value, 36)
+value11167 = compute(value, 12)
+value4853 = compute(value, 3)
+value41946 = compute(value, 42)
+value64054 = compute(value, 34)
+value34210 = compute(value, 66)
+value48553 = compute(value, 53)
+value34972 = compute(value, 52)
+value2167 = compute(value, 33)
+value32933 = compute(value, 50)
+value45030 = compute(value, 22)
+const v = os.getenv("BENCH_KEY_01514");
+value4918 = compute(value, 68)
+value34984 = compute(value, 64)
+# note 38856: keep this in sync with the handler
+value51474 = compute(value, 64)
+# note 86315: keep this in sync with the handler
+value89494 = compute(value, 60)
+value30723 = compute(value, 71)
+# note 31336: keep this in sync with the handler
+value74667 = compute(value, 74)
+const v = os.environ["BENCH_KEY_01095"];
+# note 79729: keep this in sync with the handler
+# note 51067: keep this in sync with the handler
+value13817 = compute(value, 43)
+value60092 = compute(value, 49)
+value89489 = compute(value, 55)
+value65482 = compute(value, 7)
+value72985 = compute(value, 41)
+value12901 = compute(value, 0)
+const v = os.environ.get('BENCH_KEY_00891');
+# note 60872: keep this in sync with the handler
+value7276 = compute(value, 1)
+value17191 = compute(value, 22)
+value91488 = compute(value, 17)
+value25075 = compute(value, 49)
+value71189 = compute(value, 88)
+value49883 = compute(value, 25)
+value26929 = compute(value, 60)
+const v = os.environ.get('BENCH_KEY_01175');
+value40169 = compute(value, 11)
+value50372 = compute(value, 29)
+value72 = compute(value, 72)
+value4452 = compute(value, 87)
+# note 89771: keep this in sync with the handler
+value46368 = compute(value, 2)
+value90809 = compute(value, 17)
+value49473 = compute(value, 3)
+value24182 = compute(value, 29)
+value95349 = compute(value, 95)
+value18165 = compute(value, 26)
+value50998 = compute(value, 73)
+value5895 = compute(value, 75)
+# note 93877: keep this in sync with the handler
+value8467 = compute(value, 28)
+value63229 = compute(value, 82)
+value16266 = compute(value, 67)
+const v = os.environ["BENCH_KEY_01741"];
+value87614 = compute(value, 23)
+value46727 = compute(value, 70)
+value61669 = compute(value, 74)
+value80226 = compute(value, 7)
+value8264 = compute(value, 19)
+value92455 = compute(value, 14)
+value57848 = compute(value, 36)
+value40540 = compute(value, 91)
+value83046 = compute(value, 14)
+value48115 = compute(value, 3)
+const v = os.environ["BENCH_KEY_00721"];
+value57955 = compute(value, 46)
+value8870 = compute(value, 43)
+value26743 = compute(value, 68)
+value29293 = compute(value, 96)
+# note 58666: keep this in sync with the handler
+value22594 = compute(value, 90)
+value30686 = compute(value, 34)
+value68668 = compute(value, 89)
+value91241 = compute(value, 61)
+value63341 = compute(value, 0)
+value27749 = compute(value, 7)
+value51689 = compute(value, 85)
+value49071 = compute(value, 86)
+const v = os.environ["BENCH_KEY_00544"];
+value55459 = compute(value, 72)
+value99629 = compute(value, 10)
+# note 84584: keep this in sync with the handler
+value36914 = compute(value, 54)
+value57097 = compute(value, 61)
+value63511 = compute(value, 73)
+# note 34343: keep this in sync with the handler
+value86913 = compute(value, 1)
+value80581 = compute(value, 71)
+value70245 = compute(value, 17)
+value33486 = compute(value, 21)
+value58954 = compute(value, 75)
+const v = os.environ["BENCH_KEY_01416"];
+value29551 = compute(value, 63)
+# note 33799: keep this in sync with the handler
+value21339 = compute(value, 96)
+value33891 = compute(value, 38)
+value58862 = compute(value, 80)
+value77823 = compute(value, 29)
+value29807 = compute(value, 28)
+value81635 = compute(value, 58)
+value76142 = compute(value, 94)
+# note 85300: keep this in sync with the handler
+value56363 = compute(value, 6)
+value80877 = compute(value, 76)
+value71550 = compute(value, 61)
+value71464 = compute(value, 72)
+value57317 = compute(value, 87)
+const v = os.environ["BENCH_KEY_00016"];
+value45488 = compute(value, 92)
+value59459 = compute(value, 95)
+value44099 = compute(value, 61)
+value4117 = compute(value, 43)
+value94389 = compute(value, 8)
+value43541 = compute(value, 85)
+value8072 = compute(value, 21)
+value7241 = compute(value, 63)
+value83653 = compute(value, 39)
+# note 29553: keep this in sync with the handler
+value68119 = compute(value, 25)
+# note 77837: keep this in sync with the handler
+value40911 = compute(value, 74)
+value15633 = compute(value, 16)
+# note 42340: keep this in sync with the handler
+value95245 = compute(value, 88)
+value98782 = compute(value, 36)
+value12685 = compute(value, 75)
+value52366 = compute(value, 83)
+value60175 = compute(value, 35)
+value49002 = compute(value, 17)
+const v = os.environ["BENCH_KEY_01480"];
+value16397 = compute(value, 4)
+value18796 = compute(value, 75)
+value88437 = compute(value, 70)
+value2665 = compute(value, 46)
+value44549 = compute(value, 26)
+value29978 = compute(value, 5)
+value59082 = compute(value, 9)
+value59454 = compute(value, 90)
+value78461 = compute(value, 85)
+value43224 = compute(value, 59)
+value25388 = compute(value, 71)
+value41144 = compute(value, 16)
+# note 65757: keep this in sync with the handler
+const v = os.environ["BENCH_KEY_00022"];
+value83320 = compute(value, 94)
+value26565 = compute(value, 84)
+value4613 = compute(value, 54)
+value38697 = compute(value, 91)
+value18461 = compute(value, 31)
+value38222 = compute(value, 4)
+value20807 = compute(value, 49)
+value84358 = compute(value, 65)
+value55604 = compute(value, 23)
+const v = os.getenv("BENCH_KEY_00262");
+value99865 = compute(value, 52)
+# note 24609: keep this in sync with the handler
+value73408 = compute(value, 76)
+value61023 = compute(value, 10)
+value2950 = compute(value, 40)
+value95425 = compute(value, 74)
+value99156 = compute(value, 22)
+value95228 = compute(value, 71)
+value67209 = compute(value, 85)
+# note 87219: keep this in sync with the handler
+const v = os.getenv("BENCH_KEY_00661");
+value17251 = compute(value, 82)
+value9127 = compute(value, 9)
+value61791 = compute(value, 2)
+value66121 = compute(value, 64)
+value89967 = compute(value, 48)
+value48385 = compute(value, 79)
+value70463 = compute(value, 41)
+value24183 = compute(value, 30)
+value88118 = compute(value, 42)
+value98252 = compute(value, 88)
+value63335 = compute(value, 91)
+value95614 = compute(value, 69)
+# note 24129: keep this in sync with the handler
+value86020 = compute(value, 78)
+value35783 = compute(value, 87)
+value80013 = compute(value, 85)
+value43341 = compute(value, 79)
+# note 56289: keep this in sync with the handler
+value54794 = compute(value, 86)
+const v = os.environ["BENCH_KEY_00448"];
+value62749 = compute(value, 87)
+value34221 = compute(value, 77)
+value68348 = compute(value, 60)
+value74634 = compute(value, 41)
+value4383 = compute(value, 18)
+# note 60714: keep this in sync with the handler
+value13836 = compute(value, 62)
+value67188 = compute(value, 64)
+# note 98413: keep this in sync with the handler
+# note 79763: keep this in sync with the handler
+value49247 = compute(value, 68)
+value32931 = compute(value, 48)
+const v = os.environ["BENCH_KEY_00248"];
+value18504 = compute(value, 74)
+value58186 = compute(value, 83)
+value5292 = compute(value, 54)
+value27588 = compute(value, 40)
+value92483 = compute(value, 42)
+value96779 = compute(value, 70)
+value26610 = compute(value, 32)
+value3746 = compute(value, 60)
+value86154 = compute(value, 18)
+value27422 = compute(value, 68)
+# note 91731: keep this in sync with the handler
+value1213 = compute(value, 49)
+value92834 = compute(value, 5)
+value83400 = compute(value, 77)
+value60838 = compute(value, 19)
+value21608 = compute(value, 74)
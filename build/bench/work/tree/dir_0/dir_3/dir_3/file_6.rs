@@ -0,0 +1,213 @@
+let value15640 = compute(value, 23);
+let value59846 = compute(value, 94);
+let value84103 = compute(value, 4);
+let value91375 = compute(value, 1);
+// note 93492: keep this in sync with the handler
+let value32591 = compute(value, 96);
+let value35196 = compute(value, 82);
+let value66830 = compute(value, 94);
+let value72708 = compute(value, 55);
+const v = env::var("BENCH_KEY_01761");
+let value31594 = compute(value, 69);
+let value22058 = compute(value, 39);
+let value77050 = compute(value, 32);
+// note 14734: keep this in sync with the handler
+let value65433 = compute(value, 55);
+let value31649 = compute(value, 27);
+let value85835 = compute(value, 87);
+let value53752 = compute(value, 14);
+const v = env::var_os("BENCH_KEY_01959");
+let value25231 = compute(value, 11);
+let value8189 = compute(value, 41);
+let value52416 = compute(value, 36);
+let value86347 = compute(value, 17);
+let value20575 = compute(value, 11);
+let value60871 = compute(value, 52);
+let value99723 = compute(value, 7);
+let value84070 = compute(value, 68);
+let value16605 = compute(value, 18);
+let value76906 = compute(value, 82);
+let value80752 = compute(value, 48);
+let value68734 = compute(value, 58);
+const v = env::var_os("BENCH_KEY_00566");
+let value1082 = compute(value, 15);
+let value98147 = compute(value, 80);
+let value84949 = compute(value, 74);
+let value53386 = compute(value, 36);
+// note 41833: keep this in sync with the handler
+let value8837 = compute(value, 10);
+let value5571 = compute(value, 42);
+let value5678 = compute(value, 52);
+let value83769 = compute(value, 58);
+// note 97408: keep this in sync with the handler
+let value26573 = compute(value, 92);
+let value70252 = compute(value, 24);
+let value82050 = compute(value, 85);
+let value29280 = compute(value, 83);
+let value24035 = compute(value, 76);
+let value85713 = compute(value, 62);
+const v = env::var_os("BENCH_KEY_01996");
+let value36028 = compute(value, 41);
+// note 61430: keep this in sync with the handler
+let value79731 = compute(value, 94);
+let value44316 = compute(value, 84);
+let value437 = compute(value, 49);
+let value47500 = compute(value, 67);
+let value99754 = compute(value, 38);
+let value1071 = compute(value, 4);
+let value17236 = compute(value, 67);
+// note 19395: keep this in sync with the handler
+let value9283 = compute(value, 68);
+let value92205 = compute(value, 55);
+let value68669 = compute(value, 90);
+let value8902 = compute(value, 75);
+let value63711 = compute(value, 79);
+let value48901 = compute(value, 13);
+let value636 = compute(value, 54);
+const v = env::var_os("BENCH_KEY_00082");
+let value94607 = compute(value, 32);
+let value36495 = compute(value, 23);
+let value61110 = compute(value, 0);
+let value7474 = compute(value, 5);
+let value2865 = compute(value, 52);
+// note 27857: keep this in sync with the handler
+let value81271 = compute(value, 82);
+let value88982 = compute(value, 33);
+// note 79056: keep this in sync with the handler
+let value83677 = compute(value, 63);
+let value61037 = compute(value, 24);
+let value32978 = compute(value, 95);
+let value20443 = compute(value, 73);
+const v = env::var("BENCH_KEY_01470");
+let value57527 = compute(value, 6);
+let value20098 = compute(value, 19);
+let value23416 = compute(value, 39);
+let value60641 = compute(value, 16);
+let value70352 = compute(value, 27);
+// note 72824: keep this in sync with the handler
+let value88636 = compute(value, 75);
+let value19691 = compute(value, 0);
+let value83923 = compute(value, 18);
+let value98324 = compute(value, 63);
+let value33040 = compute(value, 60);
+let value53123 = compute(value, 64);
+let value23436 = compute(value, 59);
+let value7182 = compute(value, 4);
+let value39944 = compute(value, 77);
+let value91753 = compute(value, 88);
+let value76374 = compute(value, 35);
+let value5774 = compute(value, 51);
+const v = env::var("BENCH_KEY_00630");
+let value57606 = compute(value, 85);
+let value31167 = compute(value, 30);
+let value44709 = compute(value, 89);
+let value7006 = compute(value, 22);
+let value47177 = compute(value, 35);
+let value55237 = compute(value, 44);
+let value36077 = compute(value, 90);
+let value69878 = compute(value, 38);
+let value12653 = compute(value, 43);
+let value94908 = compute(value, 42);
+let value53854 = compute(value, 19);
+let value29507 = compute(value, 19);
+let value33933 = compute(value, 80);
+let value66968 = compute(value, 38);
+let value90472 = compute(value, 68);
+// note 47287: keep this in sync with the handler
+// note 54667: keep this in sync with the handler
+let value21223 = compute(value, 77);
+let value7917 = compute(value, 60);
+const v = env::var("BENCH_KEY_01659");
+let value435 = compute(value, 47);
+let value14301 = compute(value, 42);
+let value51100 = compute(value, 78);
+// note 39647: keep this in sync with the handler
+let value72960 = compute(value, 16);
+let value3056 = compute(value, 49);
+let value45043 = compute(value, 35);
+let value97520 = compute(value, 35);
+let value88342 = compute(value, 72);
+let value32853 = compute(value, 67);
+let value23999 = compute(value, 40);
+let value88293 = compute(value, 23);
+const v = env::var("BENCH_KEY_00246");
+let value56697 = compute(value, 49);
+let value94137 = compute(value, 47);
+let value79627 = compute(value, 87);
+let value57559 = compute(value, 38);
+let value94061 = compute(value, 68);
+let value37076 = compute(value, 22);
+let value96621 = compute(value, 9);
+let value59264 = compute(value, 94);
+let value61703 = compute(value, 11);
+// note 58701: keep this in sync with the handler
+let value64982 = compute(value, 89);
+const v = env::var_os("BENCH_KEY_01292");
+let value98259 = compute(value, 95);
+let value87311 = compute(value, 11);
+// note 90014: keep this in sync with the handler
+let value23449 = compute(value, 72);
+let value26974 = compute(value, 8);
+let value21829 = compute(value, 4);
+let value79157 = compute(value, 5);
+let value3947 = compute(value, 67);
+let value78792 = compute(value, 28);
+// note 48597: keep this in sync with the handler
+let value14282 = compute(value, 23);
+let value68006 = compute(value, 9);
+let value67995 = compute(value, 95);
+let value41655 = compute(value, 42);
+let value31429 = compute(value, 1);
+let value65354 = compute(value, 73);
+// note 38768: keep this in sync with the handler
+let value5795 = compute(value, 72);
+const v = env::var_os("BENCH_KEY_01236");
+let value90518 = compute(value, 17);
+let value52412 = compute(value, 32);
+let value63177 = compute(value, 30);
+// note 92321: keep this in sync with the handler
+let value42586 = compute(value, 3);
+let value2032 = compute(value, 92);
+let value66400 = compute(value, 52);
+let value69659 = compute(value, 13);
+// note 15251: keep this in sync with the handler
+let value29911 = compute(value, 35);
+// note 69666: keep this in sync with the handler
+let value14265 = compute(value, 6);
+let value25036 = compute(value, 10);
+let value51331 = compute(value, 18);
+let value61303 = compute(value, 96);
+let value54781 = compute(value, 73);
+// note 88712: keep this in sync with the handler
+let value42287 = compute(value, 92);
+let value67703 = compute(value, 94);
+const v = env::var_os("BENCH_KEY_01455");
+let value76103 = compute(value, 55);
+let value40770 = compute(value, 30);
+let value64787 = compute(value, 88);
+let value61227 = compute(value, 20);
+let value2953 = compute(value, 43);
+// note 39229: keep this in sync with the handler
+// note 2051: keep this in sync with the handler
+let value94864 = compute(value, 95);
+let value44399 = compute(value, 70);
+const v = env::var("BENCH_KEY_00669");
+// note 8875: keep this in sync with the handler
+// note 76787: keep this in sync with the handler
+let value98868 = compute(value, 25);
+let value99256 = compute(value, 25);
+let value95884 = compute(value, 48);
+let value39325 = compute(value, 40);
+let value53081 = compute(value, 22);
+let value94261 = compute(value, 74);
+// note 19209: keep this in sync with the handler
+let value41800 = compute(value, 90);
+const v = env::var("BENCH_KEY_00143");
+let value33315 = compute(value, 44);
+let value74616 = compute(value, 23);
+let value68651 = compute(value, 72);
+let value21141 = compute(value, 92);
+// note 77439: keep this in sync with the handler
+let value74713 = compute(value, 23);
+let value47824 = compute(value, 3);
+let value14440 = compute(value, 84);
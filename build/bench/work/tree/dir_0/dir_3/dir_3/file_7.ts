@@ -0,0 +1,206 @@
+const value52805 = compute(value, 37);
+const value91576 = compute(value, 8);
+const value41697 = compute(value, 84);
+const value43802 = compute(value, 55);
+const value92445 = compute(value, 4);
+const value77656 = compute(value, 56);
+const value2393 = compute(value, 65);
+const v = process.env["BENCH_KEY_01788"];
+const value64796 = compute(value, 0);
+// note 78486: keep this in sync with the handler
+// note 16910: keep this in sync with the handler
+const value29728 = compute(value, 46);
+const value67972 = compute(value, 72);
+const value30 = compute(value, 30);
+const value44690 = compute(value, 70);
+// note 67027: keep this in sync with the handler
+const value74947 = compute(value, 63);
+const v = process.env.BENCH_KEY_01942;
+const value37306 = compute(value, 58);
+const value82053 = compute(value, 88);
+const value32156 = compute(value, 49);
+const value79908 = compute(value, 77);
+const value22487 = compute(value, 80);
+const value14363 = compute(value, 7);
+const value7270 = compute(value, 92);
+const value75060 = compute(value, 79);
+const value9438 = compute(value, 29);
+const value29569 = compute(value, 81);
+// note 76158: keep this in sync with the handler
+const value31681 = compute(value, 59);
+const value89116 = compute(value, 70);
+const value95323 = compute(value, 69);
+const value71050 = compute(value, 46);
+const v = process.env["BENCH_KEY_01916"];
+const value93220 = compute(value, 3);
+const value72945 = compute(value, 1);
+const value37834 = compute(value, 4);
+const value11504 = compute(value, 58);
+const value60942 = compute(value, 26);
+const value69042 = compute(value, 75);
+const value18269 = compute(value, 33);
+const value15467 = compute(value, 44);
+// note 44506: keep this in sync with the handler
+const value12341 = compute(value, 22);
+const value5970 = compute(value, 53);
+const v = process.env["BENCH_KEY_00561"];
+const value84709 = compute(value, 28);
+const value99938 = compute(value, 28);
+const value14668 = compute(value, 21);
+const value83919 = compute(value, 14);
+const value65559 = compute(value, 84);
+const value62527 = compute(value, 59);
+const value6542 = compute(value, 43);
+const value9740 = compute(value, 40);
+const value4071 = compute(value, 94);
+const value10897 = compute(value, 33);
+const v = process.env.BENCH_KEY_00679;
+const value33726 = compute(value, 67);
+const value76512 = compute(value, 76);
+const value99277 = compute(value, 46);
+const value86255 = compute(value, 22);
+const value69814 = compute(value, 71);
+const value5459 = compute(value, 27);
+const value55119 = compute(value, 23);
+const value49643 = compute(value, 76);
+const value66541 = compute(value, 96);
+const v = process.env["BENCH_KEY_01582"];
+const value24630 = compute(value, 89);
+const value84691 = compute(value, 10);
+const value62511 = compute(value, 43);
+const value8301 = compute(value, 56);
+const value67873 = compute(value, 70);
+const value50762 = compute(value, 31);
+const value78329 = compute(value, 50);
+const value53691 = compute(value, 50);
+const value93141 = compute(value, 21);
+const value910 = compute(value, 37);
+// note 81994: keep this in sync with the handler
+const value86304 = compute(value, 71);
+const value80244 = compute(value, 25);
+const value56487 = compute(value, 33);
+const value22531 = compute(value, 27);
+const v = process.env.BENCH_KEY_00106;
+const value13319 = compute(value, 30);
+// note 76070: keep this in sync with the handler
+const value14051 = compute(value, 83);
+const value81312 = compute(value, 26);
+const value47911 = compute(value, 90);
+const value67409 = compute(value, 91);
+const value53233 = compute(value, 77);
+const value75786 = compute(value, 29);
+const value80630 = compute(value, 23);
+const value94498 = compute(value, 20);
+const value83661 = compute(value, 47);
+const value48745 = compute(value, 51);
+const value57859 = compute(value, 47);
+const value39599 = compute(value, 23);
+const value55208 = compute(value, 15);
+const v = import.meta.env.BENCH_KEY_00280;
+const value29331 = compute(value, 37);
+const value66149 = compute(value, 92);
+// note 29848: keep this in sync with the handler
+const value38676 = compute(value, 70);
+const value44787 = compute(value, 70);
+const value48887 = compute(value, 96);
+const value88075 = compute(value, 96);
+const value3867 = compute(value, 84);
+// note 37823: keep this in sync with the handler
+const value25689 = compute(value, 81);
+const value56493 = compute(value, 39);
+const value70776 = compute(value, 63);
+// note 66931: keep this in sync with the handler
+const value41041 = compute(value, 10);
+const value47690 = compute(value, 63);
+const value9005 = compute(value, 81);
+const v = process.env["BENCH_KEY_01643"];
+// note 38589: keep this in sync with the handler
+const value55549 = compute(value, 65);
+const value65397 = compute(value, 19);
+const value84270 = compute(value, 74);
+const value4259 = compute(value, 88);
+const value39170 = compute(value, 79);
+const value96469 = compute(value, 51);
+// note 75149: keep this in sync with the handler
+const value60664 = compute(value, 39);
+const value36964 = compute(value, 7);
+const value43931 = compute(value, 87);
+const value47134 = compute(value, 89);
+const value71069 = compute(value, 65);
+const v = process.env.BENCH_KEY_00427;
+const value67406 = compute(value, 88);
+const value55751 = compute(value, 73);
+const value9979 = compute(value, 85);
+const value32867 = compute(value, 81);
+const value20628 = compute(value, 64);
+const value10299 = compute(value, 17);
+// note 95441: keep this in sync with the handler
+const value4061 = compute(value, 84);
+const value35840 = compute(value, 47);
+const value59827 = compute(value, 75);
+const v = process.env.BENCH_KEY_01034;
+const value11066 = compute(value, 8);
+const value64770 = compute(value, 71);
+const value65651 = compute(value, 79);
+// note 68164: keep this in sync with the handler
+const value97515 = compute(value, 30);
+const value61785 = compute(value, 93);
+// note 73285: keep this in sync with the handler
+const value96009 = compute(value, 76);
+const value34926 = compute(value, 6);
+const value90368 = compute(value, 61);
+const value75489 = compute(value, 23);
+const value36197 = compute(value, 16);
+const value18247 = compute(value, 11);
+const v = process.env.BENCH_KEY_01229;
+const value12787 = compute(value, 80);
+const value39119 = compute(value, 28);
+const value23605 = compute(value, 34);
+const value70031 = compute(value, 94);
+const value95925 = compute(value, 89);
+const value54329 = compute(value, 9);
+const value603 = compute(value, 21);
+const value98985 = compute(value, 45);
+const value6504 = compute(value, 5);
+const v = import.meta.env.BENCH_KEY_01787;
+const value30390 = compute(value, 29);
+const value32272 = compute(value, 68);
+const value5623 = compute(value, 94);
+const value36412 = compute(value, 37);
+const value24151 = compute(value, 95);
+const value18405 = compute(value, 72);
+const value9094 = compute(value, 73);
+const value75784 = compute(value, 27);
+const value83383 = compute(value, 60);
+const value40663 = compute(value, 20);
+const v = process.env.BENCH_KEY_01911;
+const value81257 = compute(value, 68);
+const value37206 = compute(value, 55);
+const value47822 = compute(value, 1);
+const value80567 = compute(value, 57);
+const value38805 = compute(value, 5);
+const value58197 = compute(value, 94);
+const value75034 = compute(value, 53);
+const value76400 = compute(value, 61);
+const value64957 = compute(value, 64);
+const value40178 = compute(value, 20);
+const value12803 = compute(value, 96);
+const value54316 = compute(value, 93);
+const v = process.env["BENCH_KEY_00531"];
+const value79555 = compute(value, 15);
+const value7406 = compute(value, 34);
+const value77601 = compute(value, 1);
+const value26096 = compute(value, 3);
+const value49393 = compute(value, 20);
+const value35271 = compute(value, 60);
+const value46317 = compute(value, 48);
+const value46725 = compute(value, 68);
+const value48827 = compute(value, 36);
+const value16394 = compute(value, 1);
+const value77593 = compute(value, 90);
+const value74264 = compute(value, 59);
+// note 65802: keep this in sync with the handler
+const value24987 = compute(value, 58);
+const value23472 = compute(value, 95);
+const v = process.env.BENCH_KEY_01988;
+const value86295 = compute(value, 62);
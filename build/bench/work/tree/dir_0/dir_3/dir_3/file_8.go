@@ -0,0 +1,234 @@
+value19632 := compute(value, 38)
+const v = os.LookupEnv("BENCH_KEY_00211");
+value62810 := compute(value, 51)
+value63225 := compute(value, 78)
+value14088 := compute(value, 23)
+value30827 := compute(value, 78)
+value29798 := compute(value, 19)
+value32073 := compute(value, 63)
+value38904 := compute(value, 7)
+value27475 := compute(value, 24)
+value50358 := compute(value, 15)
+value36139 := compute(value, 55)
+value74152 := compute(value, 44)
+value98646 := compute(value, 94)
+value389 := compute(value, 1)
+value83248 := compute(value, 22)
+// note 44604: keep this in sync with the handler
+value41776 := compute(value, 66)
+value98282 := compute(value, 21)
+// note 51985: keep this in sync with the handler
+value70026 := compute(value, 89)
+value18921 := compute(value, 6)
+const v = os.Getenv("BENCH_KEY_00367");
+value67756 := compute(value, 50)
+value9551 := compute(value, 45)
+// note 28078: keep this in sync with the handler
+value65703 := compute(value, 34)
+value49030 := compute(value, 45)
+value92592 := compute(value, 54)
+value80485 := compute(value, 72)
+value31398 := compute(value, 67)
+// note 14889: keep this in sync with the handler
+value86336 := compute(value, 6)
+value64628 := compute(value, 26)
+value25391 := compute(value, 74)
+// note 89441: keep this in sync with the handler
+value61628 := compute(value, 33)
+value3486 := compute(value, 91)
+value76623 := compute(value, 90)
+const v = os.LookupEnv("BENCH_KEY_01631");
+value59410 := compute(value, 46)
+value30723 := compute(value, 71)
+value8927 := compute(value, 3)
+// note 51306: keep this in sync with the handler
+value53781 := compute(value, 43)
+value16823 := compute(value, 42)
+// note 21394: keep this in sync with the handler
+value88554 := compute(value, 90)
+value10940 := compute(value, 76)
+value70930 := compute(value, 23)
+value13193 := compute(value, 1)
+value47142 := compute(value, 0)
+value76103 := compute(value, 55)
+value34994 := compute(value, 74)
+value64291 := compute(value, 77)
+value34100 := compute(value, 53)
+value65573 := compute(value, 1)
+// note 20013: keep this in sync with the handler
+const v = os.Getenv("BENCH_KEY_01569");
+value59865 := compute(value, 16)
+value64983 := compute(value, 90)
+// note 63401: keep this in sync with the handler
+value23711 := compute(value, 43)
+value37290 := compute(value, 42)
+value69952 := compute(value, 15)
+value54769 := compute(value, 61)
+value25410 := compute(value, 93)
+value69392 := compute(value, 37)
+value77833 := compute(value, 39)
+value33208 := compute(value, 34)
+// note 49281: keep this in sync with the handler
+value21007 := compute(value, 55)
+value97398 := compute(value, 10)
+value23 := compute(value, 23)
+const v = os.LookupEnv("BENCH_KEY_00503");
+value45580 := compute(value, 87)
+value97503 := compute(value, 18)
+value20009 := compute(value, 27)
+value67609 := compute(value, 0)
+// note 81480: keep this in sync with the handler
+value74001 := compute(value, 87)
+value68778 := compute(value, 5)
+value83755 := compute(value, 44)
+value60402 := compute(value, 68)
+value12249 := compute(value, 27)
+// note 70847: keep this in sync with the handler
+value66961 := compute(value, 31)
+value35213 := compute(value, 2)
+value40835 := compute(value, 95)
+const v = os.Getenv("BENCH_KEY_01483");
+value16727 := compute(value, 43)
+value80535 := compute(value, 25)
+value61658 := compute(value, 63)
+value20906 := compute(value, 51)
+value29519 := compute(value, 31)
+value91948 := compute(value, 89)
+value69877 := compute(value, 37)
+value55802 := compute(value, 27)
+value85326 := compute(value, 63)
+value3091 := compute(value, 84)
+value52387 := compute(value, 7)
+value14653 := compute(value, 6)
+value92738 := compute(value, 6)
+value26746 := compute(value, 71)
+value21531 := compute(value, 94)
+value98191 := compute(value, 27)
+value20446 := compute(value, 76)
+const v = os.Getenv("BENCH_KEY_01923");
+value5241 := compute(value, 3)
+value4113 := compute(value, 39)
+value96769 := compute(value, 60)
+value49656 := compute(value, 89)
+value22555 := compute(value, 51)
+value44768 := compute(value, 51)
+value37627 := compute(value, 88)
+value8870 := compute(value, 43)
+value7591 := compute(value, 25)
+value944 := compute(value, 71)
+value71046 := compute(value, 42)
+value60924 := compute(value, 8)
+const v = os.LookupEnv("BENCH_KEY_01509");
+value86803 := compute(value, 85)
+value36976 := compute(value, 19)
+value45033 := compute(value, 25)
+value84209 := compute(value, 13)
+value40138 := compute(value, 77)
+value26875 := compute(value, 6)
+value80885 := compute(value, 84)
+// note 48767: keep this in sync with the handler
+value65882 := compute(value, 19)
+value14131 := compute(value, 66)
+value39660 := compute(value, 84)
+value6711 := compute(value, 18)
+value8467 := compute(value, 28)
+value11339 := compute(value, 87)
+const v = os.Getenv("BENCH_KEY_01186");
+value64996 := compute(value, 6)
+value68939 := compute(value, 69)
+value49792 := compute(value, 31)
+value44885 := compute(value, 71)
+value65585 := compute(value, 13)
+value2965 := compute(value, 55)
+value31187 := compute(value, 50)
+value76850 := compute(value, 26)
+value89574 := compute(value, 43)
+value9073 := compute(value, 52)
+value20398 := compute(value, 28)
+value85953 := compute(value, 11)
+value22049 := compute(value, 30)
+value98666 := compute(value, 17)
+value15680 := compute(value, 63)
+value1261 := compute(value, 0)
+value53985 := compute(value, 53)
+const v = os.Getenv("BENCH_KEY_01180");
+value40302 := compute(value, 47)
+value81146 := compute(value, 54)
+value69283 := compute(value, 25)
+value96766 := compute(value, 57)
+value56383 := compute(value, 26)
+value48801 := compute(value, 10)
+value82441 := compute(value, 88)
+value9697 := compute(value, 94)
+value55575 := compute(value, 91)
+value57084 := compute(value, 48)
+// note 72583: keep this in sync with the handler
+// note 39349: keep this in sync with the handler
+value59881 := compute(value, 32)
+value65483 := compute(value, 8)
+// note 63039: keep this in sync with the handler
+value54669 := compute(value, 58)
+value84770 := compute(value, 89)
+value4456 := compute(value, 91)
+value91296 := compute(value, 19)
+// note 2096: keep this in sync with the handler
+value8615 := compute(value, 79)
+const v = os.Getenv("BENCH_KEY_01344");
+value65156 := compute(value, 69)
+value24012 := compute(value, 53)
+// note 85235: keep this in sync with the handler
+value15084 := compute(value, 49)
+value48247 := compute(value, 38)
+value37646 := compute(value, 10)
+// note 96956: keep this in sync with the handler
+value277 := compute(value, 83)
+value75579 := compute(value, 16)
+value78296 := compute(value, 17)
+value21543 := compute(value, 9)
+const v = os.Getenv("BENCH_KEY_00570");
+value9305 := compute(value, 90)
+// note 51781: keep this in sync with the handler
+// note 86293: keep this in sync with the handler
+value50567 := compute(value, 30)
+value24385 := compute(value, 38)
+value66391 := compute(value, 43)
+value73585 := compute(value, 59)
+value25760 := compute(value, 55)
+// note 18651: keep this in sync with the handler
+value14348 := compute(value, 89)
+value91582 := compute(value, 14)
+value96088 := compute(value, 58)
+value45111 := compute(value, 6)
+// note 34543: keep this in sync with the handler
+value68869 := compute(value, 96)
+const v = os.LookupEnv("BENCH_KEY_00568");
+value29133 := compute(value, 33)
+value98446 := compute(value, 88)
+value12645 := compute(value, 35)
+value27997 := compute(value, 61)
+value86296 := compute(value, 63)
+value98359 := compute(value, 1)
+value54066 := compute(value, 37)
+value10561 := compute(value, 85)
+// note 5630: keep this in sync with the handler
+value32294 := compute(value, 90)
+value92886 := compute(value, 57)
+value43913 := compute(value, 69)
+value83426 := compute(value, 6)
+value64866 := compute(value, 70)
+value8161 := compute(value, 13)
+value39526 := compute(value, 47)
+value29327 := compute(value, 33)
+value96971 := compute(value, 68)
+value57110 := compute(value, 74)
+value88234 := compute(value, 61)
+value95903 := compute(value, 67)
+value12631 := compute(value, 21)
+value3467 := compute(value, 72)
+const v = os.LookupEnv("BENCH_KEY_00462");
+value1559 := compute(value, 7)
+value83131 := compute(value, 2)
+value10838 := compute(value, 71)
+value15723 := compute(value, 9)
+// note 89519: keep this in sync with the handler
+value36927 := compute(value, 67)
@@ -0,0 +1,240 @@
+value37164 = compute(value, 13)
+value45878 = compute(value, 94)
+value33740 = compute(value, 81)
+value73753 = compute(value, 33)
+# note 7781: keep this in sync with the handler
+const v = os.environ["BENCH_KEY_01935"];
+value11191 = compute(value, 36)
+value72853 = compute(value, 6)
+value55193 = compute(value, 0)
+value61417 = compute(value, 16)
+# note 96315: keep this in sync with the handler
+# note 69212: keep this in sync with the handler
+value91175 = compute(value, 92)
+value31461 = compute(value, 33)
+value73102 = compute(value, 61)
+# note 58421: keep this in sync with the handler
+value82962 = compute(value, 27)
+value26192 = compute(value, 2)
+value9448 = compute(value, 39)
+value97796 = compute(value, 20)
+value31594 = compute(value, 69)
+# note 65236: keep this in sync with the handler
+value58499 = compute(value, 8)
+value63314 = compute(value, 70)
+value48521 = compute(value, 21)
+value15914 = compute(value, 6)
+value10485 = compute(value, 9)
+const v = os.environ.get('BENCH_KEY_00559');
+value56463 = compute(value, 9)
+value73694 = compute(value, 71)
+value57568 = compute(value, 47)
+value58386 = compute(value, 89)
+value25130 = compute(value, 7)
+# note 2898: keep this in sync with the handler
+value74818 = compute(value, 31)
+value42344 = compute(value, 52)
+value147 = compute(value, 50)
+value32821 = compute(value, 35)
+value20524 = compute(value, 57)
+value28475 = compute(value, 54)
+value64022 = compute(value, 2)
+value8505 = compute(value, 66)
+const v = os.environ.get('BENCH_KEY_01851');
+# note 67013: keep this in sync with the handler
+value59271 = compute(value, 4)
+value36021 = compute(value, 34)
+value760 = compute(value, 81)
+value35243 = compute(value, 32)
+value48411 = compute(value, 8)
+value26758 = compute(value, 83)
+value17596 = compute(value, 39)
+value97753 = compute(value, 74)
+value98217 = compute(value, 53)
+value79060 = compute(value, 5)
+# note 87428: keep this in sync with the handler
+value36178 = compute(value, 94)
+value74526 = compute(value, 30)
+value85821 = compute(value, 73)
+value4129 = compute(value, 55)
+value88367 = compute(value, 0)
+value99190 = compute(value, 56)
+value61996 = compute(value, 13)
+value88756 = compute(value, 1)
+value6294 = compute(value, 86)
+value20781 = compute(value, 23)
+value15280 = compute(value, 51)
+const v = os.environ.get('BENCH_KEY_00522');
+value29732 = compute(value, 50)
+value26291 = compute(value, 4)
+value17742 = compute(value, 88)
+value39436 = compute(value, 54)
+value99677 = compute(value, 58)
+value39445 = compute(value, 63)
+value87100 = compute(value, 91)
+value14482 = compute(value, 29)
+value388 = compute(value, 0)
+value99168 = compute(value, 34)
+value80544 = compute(value, 34)
+value15493 = compute(value, 70)
+value57449 = compute(value, 25)
+value82350 = compute(value, 94)
+value72673 = compute(value, 20)
+value44865 = compute(value, 51)
+value8360 = compute(value, 18)
+value17345 = compute(value, 79)
+const v = os.environ["BENCH_KEY_01152"];
+value5562 = compute(value, 33)
+value32224 = compute(value, 20)
+value32809 = compute(value, 23)
+value37287 = compute(value, 39)
+# note 13117: keep this in sync with the handler
+value64082 = compute(value, 62)
+value14392 = compute(value, 36)
+value76956 = compute(value, 35)
+value40603 = compute(value, 57)
+value43159 = compute(value, 91)
+value65710 = compute(value, 41)
+value84077 = compute(value, 75)
+value61995 = compute(value, 12)
+const v = os.environ.get('BENCH_KEY_01831');
+value4304 = compute(value, 36)
+value65218 = compute(value, 34)
+value395 = compute(value, 7)
+value60027 = compute(value, 81)
+value87437 = compute(value, 40)
+value90466 = compute(value, 62)
+# note 79324: keep this in sync with the handler
+value44376 = compute(value, 47)
+value45278 = compute(value, 76)
+value14013 = compute(value, 45)
+value90958 = compute(value, 69)
+value72678 = compute(value, 25)
+const v = os.getenv("BENCH_KEY_00720");
+value15652 = compute(value, 35)
+value5492 = compute(value, 60)
+value14925 = compute(value, 84)
+value23561 = compute(value, 87)
+value95432 = compute(value, 81)
+value71437 = compute(value, 45)
+value752 = compute(value, 73)
+value23283 = compute(value, 3)
+# note 10888: keep this in sync with the handler
+value52249 = compute(value, 63)
+value4127 = compute(value, 53)
+value13902 = compute(value, 31)
+value49405 = compute(value, 32)
+value62208 = compute(value, 31)
+value98512 = compute(value, 57)
+value77093 = compute(value, 75)
+value16314 = compute(value, 18)
+# note 73748: keep this in sync with the handler
+value73025 = compute(value, 81)
+value76094 = compute(value, 46)
+const v = os.getenv("BENCH_KEY_01543");
+value23422 = compute(value, 45)
+value89691 = compute(value, 63)
+value85050 = compute(value, 78)
+# note 38660: keep this in sync with the handler
+value14150 = compute(value, 85)
+value64059 = compute(value, 39)
+value73208 = compute(value, 70)
+value31784 = compute(value, 65)
+value75099 = compute(value, 21)
+const v = os.environ.get('BENCH_KEY_00487');
+value77272 = compute(value, 60)
+value90588 = compute(value, 87)
+value23046 = compute(value, 57)
+value57416 = compute(value, 89)
+value67050 = compute(value, 23)
+value21998 = compute(value, 76)
+value44871 = compute(value, 57)
+# note 59065: keep this in sync with the handler
+value1509 = compute(value, 54)
+value23420 = compute(value, 43)
+value86099 = compute(value, 60)
+value67840 = compute(value, 37)
+value67572 = compute(value, 60)
+value82582 = compute(value, 35)
+value8945 = compute(value, 21)
+value56839 = compute(value, 94)
+# note 42560: keep this in sync with the handler
+# note 15232: keep this in sync with the handler
+value97715 = compute(value, 36)
+value75027 = compute(value, 46)
+value86320 = compute(value, 87)
+value18406 = compute(value, 73)
+const v = os.environ["BENCH_KEY_00629"];
+value64911 = compute(value, 18)
+value27709 = compute(value, 64)
+value40288 = compute(value, 33)
+value58378 = compute(value, 81)
+# note 13542: keep this in sync with the handler
+value68804 = compute(value, 31)
+# note 53355: keep this in sync with the handler
+value82132 = compute(value, 70)
+value7240 = compute(value, 62)
+value73568 = compute(value, 42)
+value31279 = compute(value, 45)
+value16093 = compute(value, 88)
+value14691 = compute(value, 44)
+value24479 = compute(value, 35)
+# note 8553: keep this in sync with the handler
+value23307 = compute(value, 27)
+value43482 = compute(value, 26)
+value59250 = compute(value, 80)
+value80400 = compute(value, 84)
+value26516 = compute(value, 35)
+value38721 = compute(value, 18)
+# note 58386: keep this in sync with the handler
+const v = os.environ["BENCH_KEY_01258"];
+value94076 = compute(value, 83)
+value60032 = compute(value, 86)
+value83142 = compute(value, 13)
+value74904 = compute(value, 20)
+value74013 = compute(value, 2)
+value19250 = compute(value, 44)
+value19362 = compute(value, 59)
+value9431 = compute(value, 22)
+value14299 = compute(value, 40)
+value77171 = compute(value, 56)
+value71134 = compute(value, 33)
+value5602 = compute(value, 73)
+value70945 = compute(value, 38)
+value34785 = compute(value, 59)
+value6406 = compute(value, 4)
+value46843 = compute(value, 89)
+value10307 = compute(value, 25)
+value99111 = compute(value, 74)
+# note 8154: keep this in sync with the handler
+value82887 = compute(value, 49)
+value52042 = compute(value, 50)
+value65147 = compute(value, 60)
+# note 25397: keep this in sync with the handler
+const v = os.environ["BENCH_KEY_01971"];
+value16990 = compute(value, 15)
+value24761 = compute(value, 26)
+value8590 = compute(value, 54)
+value76644 = compute(value, 14)
+# note 83358: keep this in sync with the handler
+value58777 = compute(value, 92)
+value91425 = compute(value, 51)
+value21115 = compute(value, 66)
+value19847 = compute(value, 59)
+# note 92844: keep this in sync with the handler
+value70265 = compute(value, 37)
+value61546 = compute(value, 48)
+value82408 = compute(value, 55)
+# note 25660: keep this in sync with the handler
+value87928 = compute(value, 46)
+value54004 = compute(value, 72)
+const v = os.environ.get('BENCH_KEY_01213');
+value59703 = compute(value, 48)
+value59820 = compute(value, 68)
+value40173 = compute(value, 15)
+value58280 = compute(value, 80)
+value90502 = compute(value, 1)
+value80995 = compute(value, 0)
+value31676 = compute(value, 54)
+value41242 = compute(value, 17)
+value19050 = compute(value, 38)
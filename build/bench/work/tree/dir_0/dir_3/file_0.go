@@ -0,0 +1,234 @@
+value78412 := compute(value, 36)
+value66549 := compute(value, 7)
+// note 72998: keep this in sync with the handler
+value26486 := compute(value, 5)
+value69648 := compute(value, 2)
+value45624 := compute(value, 34)
+value86139 := compute(value, 3)
+value47634 := compute(value, 7)
+const v = os.Getenv("BENCH_KEY_00931");
+value95054 := compute(value, 91)
+value40769 := compute(value, 29)
+value30435 := compute(value, 74)
+value95440 := compute(value, 89)
+value71401 := compute(value, 9)
+value61615 := compute(value, 20)
+value34606 := compute(value, 74)
+value19490 := compute(value, 90)
+value70224 := compute(value, 93)
+value17354 := compute(value, 88)
+value61792 := compute(value, 3)
+value77477 := compute(value, 71)
+value68937 := compute(value, 67)
+value10405 := compute(value, 26)
+value50398 := compute(value, 55)
+value55920 := compute(value, 48)
+value23268 := compute(value, 85)
+value52461 := compute(value, 81)
+const v = os.LookupEnv("BENCH_KEY_00821");
+value72532 := compute(value, 73)
+// note 91157: keep this in sync with the handler
+value60850 := compute(value, 31)
+value72476 := compute(value, 17)
+value18972 := compute(value, 57)
+value64065 := compute(value, 45)
+// note 22896: keep this in sync with the handler
+value95056 := compute(value, 93)
+value53788 := compute(value, 50)
+// note 92586: keep this in sync with the handler
+value20096 := compute(value, 17)
+value50736 := compute(value, 5)
+value28572 := compute(value, 54)
+value14978 := compute(value, 40)
+value35575 := compute(value, 73)
+value61876 := compute(value, 87)
+value99118 := compute(value, 81)
+const v = os.Getenv("BENCH_KEY_00942");
+value54294 := compute(value, 71)
+value50490 := compute(value, 50)
+value85311 := compute(value, 48)
+// note 51534: keep this in sync with the handler
+// note 72108: keep this in sync with the handler
+value7113 := compute(value, 32)
+value11366 := compute(value, 17)
+value10459 := compute(value, 80)
+value2108 := compute(value, 71)
+value75355 := compute(value, 83)
+value65397 := compute(value, 19)
+value9496 := compute(value, 87)
+const v = os.Getenv("BENCH_KEY_01451");
+value97804 := compute(value, 28)
+value63484 := compute(value, 46)
+value40628 := compute(value, 82)
+// note 2144: keep this in sync with the handler
+value79705 := compute(value, 68)
+value49498 := compute(value, 28)
+value94259 := compute(value, 72)
+// note 16497: keep this in sync with the handler
+value28464 := compute(value, 43)
+value43083 := compute(value, 15)
+// note 96619: keep this in sync with the handler
+value56886 := compute(value, 44)
+value34134 := compute(value, 87)
+value95712 := compute(value, 70)
+// note 72777: keep this in sync with the handler
+value18502 := compute(value, 72)
+// note 70436: keep this in sync with the handler
+value55167 := compute(value, 71)
+value8048 := compute(value, 94)
+const v = os.Getenv("BENCH_KEY_01403");
+value66586 := compute(value, 44)
+value80341 := compute(value, 25)
+value822 := compute(value, 46)
+// note 15943: keep this in sync with the handler
+value78281 := compute(value, 2)
+value83927 := compute(value, 22)
+value68505 := compute(value, 23)
+value41063 := compute(value, 32)
+value65502 := compute(value, 27)
+value46460 := compute(value, 94)
+value79249 := compute(value, 0)
+value47507 := compute(value, 74)
+// note 83092: keep this in sync with the handler
+value63423 := compute(value, 82)
+value83846 := compute(value, 38)
+value22472 := compute(value, 65)
+value40693 := compute(value, 50)
+// note 57893: keep this in sync with the handler
+const v = os.LookupEnv("BENCH_KEY_01940");
+value98369 := compute(value, 11)
+value20641 := compute(value, 77)
+value77973 := compute(value, 82)
+value37151 := compute(value, 0)
+// note 46723: keep this in sync with the handler
+value44739 := compute(value, 22)
+value53987 := compute(value, 55)
+value62101 := compute(value, 21)
+value62474 := compute(value, 6)
+value95378 := compute(value, 27)
+value65779 := compute(value, 13)
+value47044 := compute(value, 96)
+// note 47994: keep this in sync with the handler
+// note 23354: keep this in sync with the handler
+value13217 := compute(value, 25)
+value52071 := compute(value, 79)
+value29332 := compute(value, 38)
+value46456 := compute(value, 90)
+value17835 := compute(value, 84)
+value68941 := compute(value, 71)
+const v = os.LookupEnv("BENCH_KEY_00173");
+value39792 := compute(value, 22)
+// note 14829: keep this in sync with the handler
+value13805 := compute(value, 31)
+value7550 := compute(value, 81)
+value32339 := compute(value, 38)
+value16495 := compute(value, 5)
+value29257 := compute(value, 60)
+value82391 := compute(value, 38)
+value60417 := compute(value, 83)
+value9254 := compute(value, 39)
+value2556 := compute(value, 34)
+value84097 := compute(value, 95)
+value42649 := compute(value, 66)
+value7358 := compute(value, 83)
+value96682 := compute(value, 70)
+value40059 := compute(value, 95)
+value89172 := compute(value, 29)
+value80977 := compute(value, 79)
+// note 67087: keep this in sync with the handler
+value60360 := compute(value, 26)
+value26581 := compute(value, 3)
+const v = os.LookupEnv("BENCH_KEY_01540");
+value46167 := compute(value, 92)
+// note 47249: keep this in sync with the handler
+value94496 := compute(value, 18)
+value82332 := compute(value, 76)
+value87809 := compute(value, 24)
+value38181 := compute(value, 60)
+value6024 := compute(value, 10)
+value91767 := compute(value, 5)
+value86902 := compute(value, 87)
+// note 56914: keep this in sync with the handler
+value12967 := compute(value, 66)
+value94007 := compute(value, 14)
+value88102 := compute(value, 26)
+value34494 := compute(value, 59)
+value25709 := compute(value, 4)
+value64524 := compute(value, 19)
+value2744 := compute(value, 28)
+value88855 := compute(value, 3)
+value59504 := compute(value, 43)
+value78816 := compute(value, 52)
+const v = os.LookupEnv("BENCH_KEY_00841");
+value18553 := compute(value, 26)
+value15005 := compute(value, 67)
+value90637 := compute(value, 39)
+value73364 := compute(value, 32)
+value46 := compute(value, 46)
+value4613 := compute(value, 54)
+value26805 := compute(value, 33)
+value26427 := compute(value, 43)
+value209 := compute(value, 15)
+value90851 := compute(value, 59)
+const v = os.LookupEnv("BENCH_KEY_00893");
+value77561 := compute(value, 58)
+value29463 := compute(value, 72)
+value31109 := compute(value, 69)
+value86150 := compute(value, 14)
+value64705 := compute(value, 6)
+value32868 := compute(value, 82)
+value37238 := compute(value, 87)
+value5814 := compute(value, 91)
+value73268 := compute(value, 33)
+value19199 := compute(value, 90)
+value73618 := compute(value, 92)
+value45508 := compute(value, 15)
+value12710 := compute(value, 3)
+value10090 := compute(value, 2)
+value52624 := compute(value, 50)
+value86407 := compute(value, 77)
+value65013 := compute(value, 23)
+value53907 := compute(value, 72)
+// note 97389: keep this in sync with the handler
+value52344 := compute(value, 61)
+value20678 := compute(value, 17)
+value57423 := compute(value, 96)
+value82906 := compute(value, 68)
+const v = os.LookupEnv("BENCH_KEY_00249");
+value79173 := compute(value, 21)
+value24179 := compute(value, 26)
+value85183 := compute(value, 17)
+value17219 := compute(value, 50)
+value68516 := compute(value, 34)
+value29688 := compute(value, 6)
+value11728 := compute(value, 88)
+value52780 := compute(value, 12)
+value91389 := compute(value, 15)
+value40318 := compute(value, 63)
+value4246 := compute(value, 75)
+value78840 := compute(value, 76)
+value20741 := compute(value, 80)
+value47851 := compute(value, 30)
+value63683 := compute(value, 51)
+// note 9115: keep this in sync with the handler
+value15615 := compute(value, 95)
+// note 18819: keep this in sync with the handler
+const v = os.LookupEnv("BENCH_KEY_00334");
+value36700 := compute(value, 34)
+value43230 := compute(value, 65)
+value49121 := compute(value, 39)
+value65748 := compute(value, 79)
+value23638 := compute(value, 67)
+value22005 := compute(value, 83)
+value27030 := compute(value, 64)
+value71612 := compute(value, 26)
+value30391 := compute(value, 30)
+value28546 := compute(value, 28)
+value83612 := compute(value, 95)
+value67215 := compute(value, 91)
+value11045 := compute(value, 84)
+value53763 := compute(value, 25)
+value98775 := compute(value, 29)
+value52201 := compute(value, 15)
+value28910 := compute(value, 4)
+// note 65359: keep this in sync with the handler
@@ -0,0 +1,242 @@
+value98446 = compute(value, 88)
+const v = os.environ.get('BENCH_KEY_00880');
+value42548 = compute(value, 62)
+value48481 = compute(value, 78)
+value91599 = compute(value, 31)
+value39393 = compute(value, 11)
+value54159 = compute(value, 33)
+value51180 = compute(value, 61)
+value73976 = compute(value, 62)
+value75169 = compute(value, 91)
+value22005 = compute(value, 83)
+value28735 = compute(value, 23)
+value29906 = compute(value, 30)
+value20350 = compute(value, 77)
+value25311 = compute(value, 91)
+value97805 = compute(value, 29)
+value38683 = compute(value, 77)
+value77054 = compute(value, 36)
+const v = os.getenv("BENCH_KEY_01682");
+value72176 = compute(value, 8)
+value55275 = compute(value, 82)
+value86604 = compute(value, 80)
+value13065 = compute(value, 67)
+# note 60340: keep this in sync with the handler
+# note 37885: keep this in sync with the handler
+value64190 = compute(value, 73)
+value73939 = compute(value, 25)
+value36540 = compute(value, 68)
+value69993 = compute(value, 56)
+value41685 = compute(value, 72)
+# note 85860: keep this in sync with the handler
+value26129 = compute(value, 36)
+value52412 = compute(value, 32)
+value98483 = compute(value, 28)
+value42775 = compute(value, 95)
+const v = os.environ["BENCH_KEY_00168"];
+value29622 = compute(value, 37)
+value41607 = compute(value, 91)
+value35796 = compute(value, 3)
+value41932 = compute(value, 28)
+value41338 = compute(value, 16)
+value20366 = compute(value, 93)
+value62875 = compute(value, 19)
+value75619 = compute(value, 56)
+value64169 = compute(value, 52)
+value92140 = compute(value, 87)
+value41389 = compute(value, 67)
+# note 23278: keep this in sync with the handler
+value23724 = compute(value, 56)
+const v = os.environ.get('BENCH_KEY_01890');
+value12162 = compute(value, 37)
+value52652 = compute(value, 78)
+# note 90326: keep this in sync with the handler
+value73554 = compute(value, 28)
+value35077 = compute(value, 60)
+value64984 = compute(value, 91)
+# note 49446: keep this in sync with the handler
+value23768 = compute(value, 3)
+value5570 = compute(value, 41)
+value96037 = compute(value, 7)
+value56762 = compute(value, 17)
+value69665 = compute(value, 19)
+value81121 = compute(value, 29)
+value12560 = compute(value, 47)
+# note 91195: keep this in sync with the handler
+value97483 = compute(value, 95)
+const v = os.environ["BENCH_KEY_01500"];
+value67304 = compute(value, 83)
+value29882 = compute(value, 6)
+value28926 = compute(value, 20)
+value92936 = compute(value, 10)
+value54223 = compute(value, 0)
+value15727 = compute(value, 13)
+value79680 = compute(value, 43)
+value67422 = compute(value, 7)
+# note 4685: keep this in sync with the handler
+value33636 = compute(value, 74)
+# note 87966: keep this in sync with the handler
+const v = os.getenv("BENCH_KEY_01494");
+value28564 = compute(value, 46)
+# note 76083: keep this in sync with the handler
+value74135 = compute(value, 27)
+value60393 = compute(value, 59)
+value23243 = compute(value, 60)
+value84053 = compute(value, 51)
+value33629 = compute(value, 67)
+# note 28590: keep this in sync with the handler
+# note 60367: keep this in sync with the handler
+value43890 = compute(value, 46)
+value51922 = compute(value, 27)
+value7896 = compute(value, 39)
+# note 96423: keep this in sync with the handler
+value71194 = compute(value, 93)
+# note 65931: keep this in sync with the handler
+const v = os.getenv("BENCH_KEY_00001");
+value34092 = compute(value, 45)
+value28777 = compute(value, 65)
+value8902 = compute(value, 75)
+value11332 = compute(value, 80)
+value83123 = compute(value, 91)
+value81707 = compute(value, 33)
+value45724 = compute(value, 37)
+# note 4380: keep this in sync with the handler
+# note 12631: keep this in sync with the handler
+const v = os.environ.get('BENCH_KEY_00840');
+value84654 = compute(value, 70)
+value92970 = compute(value, 44)
+value5198 = compute(value, 57)
+value46231 = compute(value, 59)
+value23744 = compute(value, 76)
+value19374 = compute(value, 71)
+value60714 = compute(value, 89)
+value44008 = compute(value, 67)
+value13252 = compute(value, 60)
+value9456 = compute(value, 47)
+value84353 = compute(value, 60)
+value7708 = compute(value, 45)
+value42654 = compute(value, 71)
+# note 49762: keep this in sync with the handler
+value79307 = compute(value, 58)
+value33398 = compute(value, 30)
+value9354 = compute(value, 42)
+value15578 = compute(value, 58)
+value69552 = compute(value, 3)
+value47848 = compute(value, 27)
+value22870 = compute(value, 75)
+const v = os.environ.get('BENCH_KEY_00216');
+value46183 = compute(value, 11)
+value65039 = compute(value, 49)
+value85177 = compute(value, 11)
+value40553 = compute(value, 7)
+value13156 = compute(value, 61)
+value96057 = compute(value, 27)
+value28526 = compute(value, 8)
+value44761 = compute(value, 44)
+value65173 = compute(value, 86)
+value98173 = compute(value, 9)
+value95235 = compute(value, 78)
+value79635 = compute(value, 95)
+value3261 = compute(value, 60)
+# note 47592: keep this in sync with the handler
+value26662 = compute(value, 84)
+value82279 = compute(value, 23)
+value20361 = compute(value, 88)
+value39976 = compute(value, 12)
+value55814 = compute(value, 39)
+const v = os.getenv("BENCH_KEY_01040");
+value44600 = compute(value, 77)
+value72138 = compute(value, 67)
+value84930 = compute(value, 55)
+value1345 = compute(value, 84)
+value6471 = compute(value, 69)
+value76294 = compute(value, 52)
+value12476 = compute(value, 60)
+value79983 = compute(value, 55)
+value78516 = compute(value, 43)
+const v = os.environ["BENCH_KEY_00738"];
+value10300 = compute(value, 18)
+value62162 = compute(value, 82)
+value70116 = compute(value, 82)
+value25650 = compute(value, 42)
+value69789 = compute(value, 46)
+value15408 = compute(value, 82)
+value84999 = compute(value, 27)
+value15987 = compute(value, 79)
+value32629 = compute(value, 37)
+value22416 = compute(value, 9)
+value19112 = compute(value, 3)
+const v = os.getenv("BENCH_KEY_00833");
+value11994 = compute(value, 63)
+value36966 = compute(value, 9)
+value98548 = compute(value, 93)
+value45958 = compute(value, 77)
+value67598 = compute(value, 86)
+value16489 = compute(value, 96)
+value77318 = compute(value, 9)
+value85174 = compute(value, 8)
+value6532 = compute(value, 33)
+value70096 = compute(value, 62)
+value98796 = compute(value, 50)
+value16010 = compute(value, 5)
+const v = os.getenv("BENCH_KEY_00592");
+value7259 = compute(value, 81)
+value31152 = compute(value, 15)
+value52459 = compute(value, 79)
+value91502 = compute(value, 31)
+value73435 = compute(value, 6)
+value35751 = compute(value, 55)
+value14085 = compute(value, 20)
+value45506 = compute(value, 13)
+value95117 = compute(value, 57)
+value82542 = compute(value, 92)
+value92671 = compute(value, 36)
+value25667 = compute(value, 59)
+const v = os.environ["BENCH_KEY_00300"];
+value97812 = compute(value, 36)
+value25954 = compute(value, 55)
+value9612 = compute(value, 9)
+value55459 = compute(value, 72)
+value27294 = compute(value, 37)
+value33534 = compute(value, 69)
+value87230 = compute(value, 27)
+value69310 = compute(value, 52)
+value61720 = compute(value, 28)
+value46719 = compute(value, 62)
+value678 = compute(value, 96)
+value92862 = compute(value, 33)
+value16289 = compute(value, 90)
+value98859 = compute(value, 16)
+value55171 = compute(value, 75)
+value71615 = compute(value, 29)
+const v = os.environ.get('BENCH_KEY_00853');
+value14720 = compute(value, 73)
+value68901 = compute(value, 31)
+# note 31406: keep this in sync with the handler
+value6403 = compute(value, 1)
+value95357 = compute(value, 6)
+value78646 = compute(value, 76)
+value66326 = compute(value, 75)
+value41033 = compute(value, 2)
+value53476 = compute(value, 29)
+value35510 = compute(value, 8)
+value47901 = compute(value, 80)
+value4422 = compute(value, 57)
+value28681 = compute(value, 66)
+value63454 = compute(value, 16)
+const v = os.environ["BENCH_KEY_00448"];
+value83960 = compute(value, 55)
+value47542 = compute(value, 12)
+value93588 = compute(value, 80)
+value74474 = compute(value, 75)
+value10496 = compute(value, 20)
+value40828 = compute(value, 88)
+# note 7442: keep this in sync with the handler
+value83068 = compute(value, 36)
+value23176 = compute(value, 90)
+value48529 = compute(value, 29)
+value40081 = compute(value, 20)
+value8407 = compute(value, 65)
+value28789 = compute(value, 77)
+value17327 = compute(value, 61)
+const v = os.getenv("BENCH_KEY_00428");
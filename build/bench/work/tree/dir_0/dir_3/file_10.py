@@ -0,0 +1,236 @@
+value38519 = compute(value, 10)
+value17308 = compute(value, 42)
+const v = os.environ.get('BENCH_KEY_00363');
+# note 5417: keep this in sync with the handler
+value33427 = compute(value, 59)
+value9528 = compute(value, 22)
+value32916 = compute(value, 33)
+value11757 = compute(value, 20)
+# note 27740: keep this in sync with the handler
+value55997 = compute(value, 28)
+value46260 = compute(value, 88)
+value29890 = compute(value, 14)
+value77252 = compute(value, 40)
+value65874 = compute(value, 11)
+const v = os.environ["BENCH_KEY_01741"];
+value9583 = compute(value, 77)
+value98070 = compute(value, 3)
+value71759 = compute(value, 76)
+value29556 = compute(value, 68)
+value76688 = compute(value, 58)
+value32397 = compute(value, 96)
+value67233 = compute(value, 12)
+value44612 = compute(value, 89)
+value31735 = compute(value, 16)
+value36369 = compute(value, 91)
+# note 67694: keep this in sync with the handler
+value57809 = compute(value, 94)
+# note 11568: keep this in sync with the handler
+value61419 = compute(value, 18)
+const v = os.environ["BENCH_KEY_00239"];
+value91763 = compute(value, 1)
+value10420 = compute(value, 41)
+value76662 = compute(value, 32)
+# note 17768: keep this in sync with the handler
+value88583 = compute(value, 22)
+value86892 = compute(value, 77)
+value78929 = compute(value, 68)
+value24547 = compute(value, 6)
+# note 2097: keep this in sync with the handler
+const v = os.environ.get('BENCH_KEY_01900');
+value18233 = compute(value, 94)
+value89140 = compute(value, 94)
+value70425 = compute(value, 3)
+value16922 = compute(value, 44)
+value97638 = compute(value, 56)
+value88914 = compute(value, 62)
+value97344 = compute(value, 53)
+value41717 = compute(value, 7)
+value62425 = compute(value, 54)
+value27315 = compute(value, 58)
+value79489 = compute(value, 46)
+value54574 = compute(value, 60)
+# note 86149: keep this in sync with the handler
+# note 10913: keep this in sync with the handler
+value35152 = compute(value, 38)
+value69095 = compute(value, 31)
+const v = os.getenv("BENCH_KEY_00200");
+value83790 = compute(value, 79)
+value78854 = compute(value, 90)
+value65421 = compute(value, 43)
+value92204 = compute(value, 54)
+value77108 = compute(value, 90)
+value68214 = compute(value, 23)
+# note 47647: keep this in sync with the handler
+value20751 = compute(value, 90)
+value58074 = compute(value, 68)
+# note 28090: keep this in sync with the handler
+# note 1364: keep this in sync with the handler
+value36124 = compute(value, 40)
+value9418 = compute(value, 9)
+value43887 = compute(value, 43)
+value2200 = compute(value, 66)
+# note 51478: keep this in sync with the handler
+value52586 = compute(value, 12)
+value33106 = compute(value, 29)
+const v = os.environ["BENCH_KEY_00572"];
+# note 57: keep this in sync with the handler
+value63996 = compute(value, 73)
+# note 51113: keep this in sync with the handler
+# note 37340: keep this in sync with the handler
+value11378 = compute(value, 29)
+value13361 = compute(value, 72)
+value91673 = compute(value, 8)
+# note 8306: keep this in sync with the handler
+value55348 = compute(value, 58)
+value35097 = compute(value, 80)
+value58137 = compute(value, 34)
+value47414 = compute(value, 78)
+value83210 = compute(value, 81)
+value18586 = compute(value, 59)
+const v = os.environ["BENCH_KEY_00853"];
+value9328 = compute(value, 16)
+value17935 = compute(value, 87)
+value75986 = compute(value, 35)
+value88297 = compute(value, 27)
+value64632 = compute(value, 30)
+value30970 = compute(value, 27)
+value75353 = compute(value, 81)
+value54780 = compute(value, 72)
+value39442 = compute(value, 60)
+const v = os.environ["BENCH_KEY_01293"];
+value17541 = compute(value, 81)
+value31864 = compute(value, 48)
+value79742 = compute(value, 8)
+value32790 = compute(value, 4)
+value87947 = compute(value, 65)
+value313 = compute(value, 22)
+value61401 = compute(value, 0)
+# note 40211: keep this in sync with the handler
+value86414 = compute(value, 84)
+# note 57081: keep this in sync with the handler
+value22164 = compute(value, 48)
+value17965 = compute(value, 20)
+value54556 = compute(value, 42)
+value5036 = compute(value, 89)
+value40951 = compute(value, 17)
+value45901 = compute(value, 20)
+value79528 = compute(value, 85)
+value72039 = compute(value, 65)
+value34558 = compute(value, 26)
+value95910 = compute(value, 74)
+value16862 = compute(value, 81)
+const v = os.environ["BENCH_KEY_00490"];
+value80895 = compute(value, 94)
+value850 = compute(value, 74)
+value13505 = compute(value, 22)
+value3413 = compute(value, 18)
+value41381 = compute(value, 59)
+value59218 = compute(value, 48)
+value34239 = compute(value, 95)
+value59691 = compute(value, 36)
+value54421 = compute(value, 4)
+# note 58913: keep this in sync with the handler
+value32580 = compute(value, 85)
+const v = os.getenv("BENCH_KEY_00783");
+# note 21404: keep this in sync with the handler
+value35438 = compute(value, 33)
+# note 32237: keep this in sync with the handler
+# note 90211: keep this in sync with the handler
+value45972 = compute(value, 91)
+value37940 = compute(value, 13)
+value82698 = compute(value, 54)
+value51102 = compute(value, 80)
+value72989 = compute(value, 45)
+value71232 = compute(value, 34)
+value47123 = compute(value, 78)
+value88617 = compute(value, 56)
+value88325 = compute(value, 55)
+value36149 = compute(value, 65)
+value99148 = compute(value, 14)
+value33614 = compute(value, 52)
+value19711 = compute(value, 20)
+value70124 = compute(value, 90)
+const v = os.environ.get('BENCH_KEY_00377');
+value57281 = compute(value, 51)
+value21661 = compute(value, 30)
+# note 89499: keep this in sync with the handler
+value44352 = compute(value, 23)
+value89195 = compute(value, 52)
+value7582 = compute(value, 16)
+value46865 = compute(value, 14)
+value88347 = compute(value, 77)
+value41357 = compute(value, 35)
+value28648 = compute(value, 33)
+# note 22270: keep this in sync with the handler
+# note 18263: keep this in sync with the handler
+value72329 = compute(value, 64)
+value62867 = compute(value, 11)
+value59968 = compute(value, 22)
+value38781 = compute(value, 78)
+value1821 = compute(value, 75)
+value50430 = compute(value, 87)
+value69271 = compute(value, 13)
+value26385 = compute(value, 1)
+# note 67853: keep this in sync with the handler
+value17782 = compute(value, 31)
+const v = os.environ["BENCH_KEY_00119"];
+value43118 = compute(value, 50)
+value23292 = compute(value, 12)
+value32773 = compute(value, 84)
+value108 = compute(value, 11)
+value26125 = compute(value, 32)
+value95800 = compute(value, 61)
+# note 31482: keep this in sync with the handler
+value94159 = compute(value, 69)
+value34406 = compute(value, 68)
+const v = os.getenv("BENCH_KEY_00248");
+value97633 = compute(value, 51)
+value17330 = compute(value, 64)
+value7676 = compute(value, 13)
+value47575 = compute(value, 45)
+value54248 = compute(value, 25)
+value1675 = compute(value, 26)
+value28874 = compute(value, 65)
+value77257 = compute(value, 45)
+value39515 = compute(value, 36)
+# note 7913: keep this in sync with the handler
+value94435 = compute(value, 54)
+value97053 = compute(value, 53)
+value31246 = compute(value, 12)
+value49822 = compute(value, 61)
+# note 51687: keep this in sync with the handler
+value99106 = compute(value, 69)
+value79903 = compute(value, 72)
+value10171 = compute(value, 83)
+value23297 = compute(value, 17)
+const v = os.getenv("BENCH_KEY_00588");
+value75820 = compute(value, 63)
+value94425 = compute(value, 44)
+value83491 = compute(value, 71)
+value34804 = compute(value, 78)
+value12245 = compute(value, 23)
+value39890 = compute(value, 23)
+value17150 = compute(value, 78)
+value99295 = compute(value, 64)
+value16858 = compute(value, 77)
+value87130 = compute(value, 24)
+value81597 = compute(value, 20)
+value10442 = compute(value, 63)
+value91858 = compute(value, 96)
+value42764 = compute(value, 84)
+value73284 = compute(value, 49)
+# note 82110: keep this in sync with the handler
+value93993 = compute(value, 0)
+value15747 = compute(value, 33)
+const v = os.environ["BENCH_KEY_01727"];
+value76519 = compute(value, 83)
+value67070 = compute(value, 43)
+# note 59079: keep this in sync with the handler
+value64387 = compute(value, 76)
+# note 12287: keep this in sync with the handler
+value62502 = compute(value, 34)
+value85086 = compute(value, 17)
+value20744 = compute(value, 83)
+value73466 = compute(value, 37)
+# note 132: keep this in sync with the handler
@@ -0,0 +1,211 @@
+// note 82225: keep this in sync with the handler
+let value42901 = compute(value, 27);
+let value26183 = compute(value, 90);
+// note 99285: keep this in sync with the handler
+// note 72363: keep this in sync with the handler
+let value17148 = compute(value, 76);
+let value43466 = compute(value, 10);
+let value48237 = compute(value, 28);
+let value54102 = compute(value, 73);
+let value70381 = compute(value, 56);
+let value69943 = compute(value, 6);
+const v = env::var("BENCH_KEY_00402");
+// note 12861: keep this in sync with the handler
+let value59030 = compute(value, 54);
+let value80974 = compute(value, 76);
+let value28462 = compute(value, 41);
+let value79683 = compute(value, 46);
+let value54822 = compute(value, 17);
+let value19912 = compute(value, 27);
+let value83199 = compute(value, 70);
+let value45011 = compute(value, 3);
+let value23659 = compute(value, 88);
+let value61839 = compute(value, 50);
+// note 35154: keep this in sync with the handler
+let value61654 = compute(value, 59);
+let value1586 = compute(value, 34);
+let value40543 = compute(value, 94);
+let value37833 = compute(value, 3);
+let value10440 = compute(value, 61);
+let value14313 = compute(value, 54);
+// note 83924: keep this in sync with the handler
+const v = env::var("BENCH_KEY_00121");
+let value64776 = compute(value, 77);
+// note 44989: keep this in sync with the handler
+let value42680 = compute(value, 0);
+let value84374 = compute(value, 81);
+let value61201 = compute(value, 91);
+let value51704 = compute(value, 3);
+let value70827 = compute(value, 17);
+// note 45749: keep this in sync with the handler
+const v = env::var_os("BENCH_KEY_01311");
+let value53174 = compute(value, 18);
+let value21830 = compute(value, 5);
+let value54962 = compute(value, 60);
+let value42392 = compute(value, 3);
+let value91060 = compute(value, 74);
+let value39076 = compute(value, 82);
+let value80692 = compute(value, 85);
+// note 95776: keep this in sync with the handler
+let value14838 = compute(value, 94);
+let value37443 = compute(value, 1);
+// note 36479: keep this in sync with the handler
+let value73195 = compute(value, 57);
+let value13848 = compute(value, 74);
+let value96157 = compute(value, 30);
+let value13382 = compute(value, 93);
+let value86484 = compute(value, 57);
+// note 47823: keep this in sync with the handler
+let value36332 = compute(value, 54);
+let value81055 = compute(value, 60);
+let value63479 = compute(value, 41);
+const v = env::var("BENCH_KEY_01966");
+// note 50788: keep this in sync with the handler
+let value69470 = compute(value, 18);
+let value18049 = compute(value, 7);
+let value59605 = compute(value, 47);
+// note 40772: keep this in sync with the handler
+// note 44120: keep this in sync with the handler
+let value31115 = compute(value, 75);
+let value99057 = compute(value, 20);
+let value78221 = compute(value, 39);
+let value7874 = compute(value, 17);
+// note 43398: keep this in sync with the handler
+let value15788 = compute(value, 74);
+let value67386 = compute(value, 68);
+let value86276 = compute(value, 43);
+let value74281 = compute(value, 76);
+let value17146 = compute(value, 74);
+let value15099 = compute(value, 64);
+let value91323 = compute(value, 46);
+const v = env::var("BENCH_KEY_00279");
+// note 22328: keep this in sync with the handler
+let value85745 = compute(value, 94);
+let value4869 = compute(value, 19);
+let value49987 = compute(value, 32);
+let value30876 = compute(value, 30);
+// note 93985: keep this in sync with the handler
+let value34633 = compute(value, 4);
+let value52441 = compute(value, 61);
+let value4921 = compute(value, 71);
+let value20042 = compute(value, 60);
+let value40462 = compute(value, 13);
+let value21643 = compute(value, 12);
+let value79485 = compute(value, 42);
+let value47682 = compute(value, 55);
+let value6632 = compute(value, 36);
+let value44225 = compute(value, 90);
+let value43909 = compute(value, 65);
+// note 91502: keep this in sync with the handler
+const v = env::var_os("BENCH_KEY_01793");
+let value98198 = compute(value, 34);
+let value86785 = compute(value, 67);
+let value34039 = compute(value, 89);
+// note 1379: keep this in sync with the handler
+let value41175 = compute(value, 47);
+let value99085 = compute(value, 48);
+let value9471 = compute(value, 62);
+let value20408 = compute(value, 38);
+let value75306 = compute(value, 34);
+let value40283 = compute(value, 28);
+let value24774 = compute(value, 39);
+const v = env::var("BENCH_KEY_01412");
+let value98960 = compute(value, 20);
+let value95647 = compute(value, 5);
+let value36939 = compute(value, 79);
+let value74508 = compute(value, 12);
+let value18791 = compute(value, 70);
+let value87325 = compute(value, 25);
+let value95005 = compute(value, 42);
+let value16430 = compute(value, 37);
+let value73176 = compute(value, 38);
+let value35993 = compute(value, 6);
+let value72789 = compute(value, 39);
+let value83139 = compute(value, 10);
+let value8117 = compute(value, 66);
+// note 600: keep this in sync with the handler
+let value38869 = compute(value, 69);
+let value58130 = compute(value, 27);
+let value24902 = compute(value, 70);
+const v = env::var_os("BENCH_KEY_00689");
+let value25947 = compute(value, 48);
+let value52236 = compute(value, 50);
+let value25849 = compute(value, 47);
+let value75981 = compute(value, 30);
+let value32297 = compute(value, 93);
+let value31638 = compute(value, 16);
+let value3829 = compute(value, 46);
+let value4830 = compute(value, 77);
+let value41691 = compute(value, 78);
+let value36473 = compute(value, 1);
+let value54915 = compute(value, 13);
+let value52655 = compute(value, 81);
+// note 16910: keep this in sync with the handler
+// note 97782: keep this in sync with the handler
+let value23433 = compute(value, 56);
+let value3514 = compute(value, 22);
+let value52078 = compute(value, 86);
+// note 37167: keep this in sync with the handler
+let value75765 = compute(value, 8);
+let value49492 = compute(value, 22);
+const v = env::var("BENCH_KEY_00959");
+// note 39502: keep this in sync with the handler
+let value39028 = compute(value, 34);
+let value39519 = compute(value, 40);
+let value61463 = compute(value, 62);
+let value27753 = compute(value, 11);
+let value73856 = compute(value, 39);
+let value51357 = compute(value, 44);
+let value81567 = compute(value, 87);
+let value87072 = compute(value, 63);
+let value51001 = compute(value, 76);
+let value27223 = compute(value, 63);
+let value56293 = compute(value, 33);
+let value70933 = compute(value, 26);
+let value1025 = compute(value, 55);
+// note 45806: keep this in sync with the handler
+let value17474 = compute(value, 14);
+const v = env::var("BENCH_KEY_00004");
+let value51967 = compute(value, 72);
+let value28089 = compute(value, 56);
+let value13048 = compute(value, 50);
+let value33497 = compute(value, 32);
+let value29945 = compute(value, 69);
+let value30568 = compute(value, 13);
+let value38389 = compute(value, 74);
+// note 89592: keep this in sync with the handler
+let value37355 = compute(value, 10);
+let value55758 = compute(value, 80);
+let value82292 = compute(value, 36);
+let value75702 = compute(value, 42);
+let value98864 = compute(value, 21);
+// note 74506: keep this in sync with the handler
+let value10600 = compute(value, 27);
+const v = env::var_os("BENCH_KEY_00330");
+let value12926 = compute(value, 25);
+let value97596 = compute(value, 14);
+// note 82616: keep this in sync with the handler
+let value26734 = compute(value, 59);
+let value56940 = compute(value, 1);
+let value14149 = compute(value, 84);
+let value14801 = compute(value, 57);
+let value4339 = compute(value, 71);
+const v = env::var("BENCH_KEY_01902");
+let value55898 = compute(value, 26);
+let value84385 = compute(value, 92);
+let value54634 = compute(value, 23);
+let value27148 = compute(value, 85);
+let value53067 = compute(value, 8);
+let value91147 = compute(value, 64);
+let value92581 = compute(value, 43);
+let value88118 = compute(value, 42);
+let value10996 = compute(value, 35);
+// note 8250: keep this in sync with the handler
+// note 4176: keep this in sync with the handler
+let value28171 = compute(value, 41);
+let value53905 = compute(value, 70);
+let value8979 = compute(value, 55);
+let value53174 = compute(value, 18);
+let value45325 = compute(value, 26);
+let value39972 = compute(value, 8);
+let value46043 = compute(value, 65);
@@ -0,0 +1,237 @@
+# note 21693: keep this in sync with the handler
+value93455 = compute(value, 44)
+value64269 = compute(value, 55)
+value56945 = compute(value, 6)
+# note 81564: keep this in sync with the handler
+const v = os.getenv("BENCH_KEY_01783");
+value44157 = compute(value, 22)
+value44576 = compute(value, 53)
+value71214 = compute(value, 16)
+value62216 = compute(value, 39)
+value30274 = compute(value, 10)
+value74597 = compute(value, 4)
+# note 39577: keep this in sync with the handler
+value4782 = compute(value, 29)
+value96477 = compute(value, 59)
+const v = os.getenv("BENCH_KEY_01265");
+value85151 = compute(value, 82)
+value35957 = compute(value, 67)
+value62617 = compute(value, 52)
+value91424 = compute(value, 50)
+value84916 = compute(value, 41)
+value29954 = compute(value, 78)
+# note 77523: keep this in sync with the handler
+value35801 = compute(value, 8)
+value90614 = compute(value, 16)
+# note 86380: keep this in sync with the handler
+value11452 = compute(value, 6)
+value14552 = compute(value, 2)
+value16340 = compute(value, 44)
+value48208 = compute(value, 96)
+value88845 = compute(value, 90)
+value27625 = compute(value, 77)
+# note 77053: keep this in sync with the handler
+# note 67221: keep this in sync with the handler
+const v = os.environ.get('BENCH_KEY_01292');
+value61488 = compute(value, 87)
+value48895 = compute(value, 7)
+value14632 = compute(value, 82)
+# note 41852: keep this in sync with the handler
+value64129 = compute(value, 12)
+value1764 = compute(value, 18)
+value1293 = compute(value, 32)
+value86636 = compute(value, 15)
+value59525 = compute(value, 64)
+value78885 = compute(value, 24)
+value83487 = compute(value, 67)
+# note 16145: keep this in sync with the handler
+value1948 = compute(value, 8)
+const v = os.environ.get('BENCH_KEY_00885');
+value95121 = compute(value, 61)
+value8127 = compute(value, 76)
+value56483 = compute(value, 29)
+value66598 = compute(value, 56)
+value20227 = compute(value, 51)
+value65083 = compute(value, 93)
+value49409 = compute(value, 36)
+value2220 = compute(value, 86)
+value51178 = compute(value, 59)
+value65708 = compute(value, 39)
+value1390 = compute(value, 32)
+value17723 = compute(value, 69)
+value201 = compute(value, 7)
+# note 7464: keep this in sync with the handler
+value40932 = compute(value, 95)
+value23758 = compute(value, 90)
+value80960 = compute(value, 62)
+value23721 = compute(value, 53)
+const v = os.getenv("BENCH_KEY_00742");
+value8525 = compute(value, 86)
+value3117 = compute(value, 13)
+value11430 = compute(value, 81)
+value78908 = compute(value, 47)
+value47925 = compute(value, 7)
+value6320 = compute(value, 15)
+value69751 = compute(value, 8)
+# note 97944: keep this in sync with the handler
+const v = os.environ["BENCH_KEY_00489"];
+# note 28868: keep this in sync with the handler
+value22451 = compute(value, 44)
+value66369 = compute(value, 21)
+value2151 = compute(value, 17)
+value58464 = compute(value, 70)
+value22885 = compute(value, 90)
+# note 86170: keep this in sync with the handler
+# note 14470: keep this in sync with the handler
+value24146 = compute(value, 90)
+const v = os.environ.get('BENCH_KEY_00590');
+value55434 = compute(value, 47)
+value20305 = compute(value, 32)
+value93052 = compute(value, 29)
+value87943 = compute(value, 61)
+value3416 = compute(value, 21)
+value17912 = compute(value, 64)
+value14972 = compute(value, 34)
+value99489 = compute(value, 64)
+value63764 = compute(value, 35)
+value14351 = compute(value, 92)
+value24340 = compute(value, 90)
+value92687 = compute(value, 52)
+value71556 = compute(value, 67)
+const v = os.environ["BENCH_KEY_01301"];
+value31748 = compute(value, 29)
+value12334 = compute(value, 15)
+value89106 = compute(value, 60)
+value75861 = compute(value, 7)
+value86509 = compute(value, 82)
+value90701 = compute(value, 6)
+value30405 = compute(value, 44)
+value6053 = compute(value, 39)
+value93381 = compute(value, 67)
+value69357 = compute(value, 2)
+value72810 = compute(value, 60)
+value64510 = compute(value, 5)
+value56280 = compute(value, 20)
+# note 22053: keep this in sync with the handler
+value5204 = compute(value, 63)
+value67864 = compute(value, 61)
+value415 = compute(value, 27)
+value24180 = compute(value, 27)
+value50761 = compute(value, 30)
+const v = os.environ.get('BENCH_KEY_01812');
+value17336 = compute(value, 70)
+# note 86980: keep this in sync with the handler
+value13814 = compute(value, 40)
+value87248 = compute(value, 45)
+value61978 = compute(value, 92)
+value78744 = compute(value, 77)
+# note 86012: keep this in sync with the handler
+value84552 = compute(value, 65)
+value31845 = compute(value, 29)
+const v = os.environ["BENCH_KEY_01890"];
+value26619 = compute(value, 41)
+value49485 = compute(value, 15)
+# note 39429: keep this in sync with the handler
+value90508 = compute(value, 7)
+value47344 = compute(value, 8)
+value23713 = compute(value, 45)
+value41840 = compute(value, 33)
+value17447 = compute(value, 84)
+value50945 = compute(value, 20)
+value70845 = compute(value, 35)
+value67760 = compute(value, 54)
+value680 = compute(value, 1)
+# note 57112: keep this in sync with the handler
+value61006 = compute(value, 90)
+value45401 = compute(value, 5)
+value56101 = compute(value, 35)
+value33685 = compute(value, 26)
+value58384 = compute(value, 87)
+value5629 = compute(value, 3)
+value33673 = compute(value, 14)
+value28270 = compute(value, 43)
+value59441 = compute(value, 77)
+value57639 = compute(value, 21)
+const v = os.environ["BENCH_KEY_01752"];
+value12108 = compute(value, 80)
+value28203 = compute(value, 73)
+# note 46443: keep this in sync with the handler
+value1425 = compute(value, 67)
+value88380 = compute(value, 13)
+value54960 = compute(value, 58)
+value5609 = compute(value, 80)
+# note 18329: keep this in sync with the handler
+value70117 = compute(value, 83)
+value37193 = compute(value, 42)
+value40704 = compute(value, 61)
+value13713 = compute(value, 36)
+# note 73974: keep this in sync with the handler
+value89587 = compute(value, 56)
+value41995 = compute(value, 91)
+value42229 = compute(value, 34)
+value38279 = compute(value, 61)
+value8623 = compute(value, 87)
+# note 37198: keep this in sync with the handler
+const v = os.environ["BENCH_KEY_01866"];
+value32088 = compute(value, 78)
+value44637 = compute(value, 17)
+value29923 = compute(value, 47)
+value57333 = compute(value, 6)
+value24599 = compute(value, 58)
+value16863 = compute(value, 82)
+value2986 = compute(value, 76)
+value85895 = compute(value, 50)
+value21198 = compute(value, 52)
+value57982 = compute(value, 73)
+# note 8465: keep this in sync with the handler
+value47836 = compute(value, 15)
+# note 50990: keep this in sync with the handler
+# note 30573: keep this in sync with the handler
+value84256 = compute(value, 60)
+value48537 = compute(value, 37)
+value76527 = compute(value, 91)
+value96730 = compute(value, 21)
+value15513 = compute(value, 90)
+value26764 = compute(value, 89)
+const v = os.environ.get('BENCH_KEY_01979');
+value3276 = compute(value, 75)
+# note 73402: keep this in sync with the handler
+value47903 = compute(value, 82)
+value61923 = compute(value, 37)
+value99409 = compute(value, 81)
+value80152 = compute(value, 30)
+value82402 = compute(value, 49)
+value43086 = compute(value, 18)
+value10620 = compute(value, 47)
+value22937 = compute(value, 45)
+value63856 = compute(value, 30)
+# note 93235: keep this in sync with the handler
+value91103 = compute(value, 20)
+value93598 = compute(value, 90)
+value47754 = compute(value, 30)
+value57011 = compute(value, 72)
+const v = os.environ.get('BENCH_KEY_00698');
+value42736 = compute(value, 56)
+value63940 = compute(value, 17)
+value27737 = compute(value, 92)
+value64125 = compute(value, 8)
+value35735 = compute(value, 39)
+value18019 = compute(value, 74)
+value88769 = compute(value, 14)
+value91347 = compute(value, 70)
+value66202 = compute(value, 48)
+value88073 = compute(value, 94)
+# note 67939: keep this in sync with the handler
+value70106 = compute(value, 72)
+const v = os.getenv("BENCH_KEY_01372");
+value60319 = compute(value, 82)
+value71452 = compute(value, 60)
+value293 = compute(value, 2)
+value53697 = compute(value, 56)
+value2264 = compute(value, 33)
+value87218 = compute(value, 15)
+value98897 = compute(value, 54)
+value52639 = compute(value, 65)
+# note 68800: keep this in sync with the handler
+const v = os.environ["BENCH_KEY_00026"];
+value42867 = compute(value, 90)
@@ -0,0 +1,240 @@
+value51087 = compute(value, 65)
+value92687 = compute(value, 52)
+value89172 = compute(value, 29)
+value33255 = compute(value, 81)
+value23202 = compute(value, 19)
+const v = os.getenv("BENCH_KEY_00312");
+value91565 = compute(value, 94)
+value22760 = compute(value, 62)
+value83243 = compute(value, 17)
+value67177 = compute(value, 53)
+value28595 = compute(value, 77)
+value38744 = compute(value, 41)
+value43722 = compute(value, 72)
+value11244 = compute(value, 89)
+value1689 = compute(value, 40)
+value96725 = compute(value, 16)
+value82100 = compute(value, 38)
+value55450 = compute(value, 63)
+value24406 = compute(value, 59)
+value89922 = compute(value, 3)
+const v = os.environ.get('BENCH_KEY_01350');
+# note 16748: keep this in sync with the handler
+# note 44719: keep this in sync with the handler
+value35176 = compute(value, 62)
+value65499 = compute(value, 24)
+# note 48742: keep this in sync with the handler
+value61496 = compute(value, 95)
+value55531 = compute(value, 47)
+value4038 = compute(value, 61)
+value92947 = compute(value, 21)
+value61164 = compute(value, 54)
+value18017 = compute(value, 72)
+value56274 = compute(value, 14)
+const v = os.environ["BENCH_KEY_01621"];
+value22461 = compute(value, 54)
+value41545 = compute(value, 29)
+value74244 = compute(value, 39)
+value55906 = compute(value, 34)
+value9323 = compute(value, 11)
+value47736 = compute(value, 12)
+value21574 = compute(value, 40)
+value93062 = compute(value, 39)
+# note 48948: keep this in sync with the handler
+# note 82274: keep this in sync with the handler
+value6430 = compute(value, 28)
+const v = os.environ.get('BENCH_KEY_01612');
+value10671 = compute(value, 1)
+value5119 = compute(value, 75)
+value58765 = compute(value, 80)
+value13408 = compute(value, 22)
+# note 90139: keep this in sync with the handler
+value7094 = compute(value, 13)
+value53500 = compute(value, 53)
+value73297 = compute(value, 62)
+value59483 = compute(value, 22)
+value73598 = compute(value, 72)
+value16687 = compute(value, 3)
+value32001 = compute(value, 88)
+const v = os.getenv("BENCH_KEY_00641");
+value65894 = compute(value, 31)
+value15309 = compute(value, 80)
+value86723 = compute(value, 5)
+value98180 = compute(value, 16)
+value9874 = compute(value, 77)
+value58996 = compute(value, 20)
+# note 48998: keep this in sync with the handler
+value72577 = compute(value, 21)
+value91521 = compute(value, 50)
+value61505 = compute(value, 7)
+value63713 = compute(value, 81)
+value82711 = compute(value, 67)
+const v = os.getenv("BENCH_KEY_00903");
+value16156 = compute(value, 54)
+value57604 = compute(value, 83)
+value48535 = compute(value, 35)
+# note 44305: keep this in sync with the handler
+value46623 = compute(value, 63)
+# note 27452: keep this in sync with the handler
+value10136 = compute(value, 48)
+value33668 = compute(value, 9)
+value76908 = compute(value, 84)
+const v = os.getenv("BENCH_KEY_00890");
+value86304 = compute(value, 71)
+value26870 = compute(value, 1)
+value11902 = compute(value, 68)
+value60571 = compute(value, 43)
+value9778 = compute(value, 78)
+value70544 = compute(value, 25)
+value87930 = compute(value, 48)
+value43976 = compute(value, 35)
+value82793 = compute(value, 52)
+value98196 = compute(value, 32)
+value52518 = compute(value, 41)
+const v = os.environ["BENCH_KEY_01856"];
+value19546 = compute(value, 49)
+value1113 = compute(value, 46)
+value54363 = compute(value, 43)
+value44940 = compute(value, 29)
+value6846 = compute(value, 56)
+value47741 = compute(value, 17)
+# note 72434: keep this in sync with the handler
+value42616 = compute(value, 33)
+value54679 = compute(value, 68)
+value71011 = compute(value, 7)
+value61939 = compute(value, 53)
+# note 49207: keep this in sync with the handler
+value63429 = compute(value, 88)
+# note 22518: keep this in sync with the handler
+value54773 = compute(value, 65)
+const v = os.environ["BENCH_KEY_00351"];
+value65511 = compute(value, 36)
+value1411 = compute(value, 53)
+# note 54962: keep this in sync with the handler
+value16460 = compute(value, 67)
+value32138 = compute(value, 31)
+value95573 = compute(value, 28)
+# note 63639: keep this in sync with the handler
+value79906 = compute(value, 75)
+value66980 = compute(value, 50)
+value15310 = compute(value, 81)
+value62757 = compute(value, 95)
+value45068 = compute(value, 60)
+value23519 = compute(value, 45)
+value43190 = compute(value, 25)
+value60483 = compute(value, 52)
+value91308 = compute(value, 31)
+value71386 = compute(value, 91)
+value26217 = compute(value, 27)
+value84546 = compute(value, 59)
+value85927 = compute(value, 82)
+value15000 = compute(value, 62)
+const v = os.getenv("BENCH_KEY_00306");
+value32857 = compute(value, 71)
+value57146 = compute(value, 13)
+value2983 = compute(value, 73)
+value14949 = compute(value, 11)
+value94131 = compute(value, 41)
+value35382 = compute(value, 74)
+value3929 = compute(value, 49)
+value93711 = compute(value, 9)
+value66948 = compute(value, 18)
+value60639 = compute(value, 14)
+value79958 = compute(value, 30)
+# note 75624: keep this in sync with the handler
+const v = os.getenv("BENCH_KEY_01626");
+value34039 = compute(value, 89)
+value53820 = compute(value, 82)
+value13922 = compute(value, 51)
+value1244 = compute(value, 80)
+value69597 = compute(value, 48)
+value92310 = compute(value, 63)
+# note 70548: keep this in sync with the handler
+value53503 = compute(value, 56)
+value20823 = compute(value, 65)
+value49674 = compute(value, 10)
+value38385 = compute(value, 70)
+value80710 = compute(value, 6)
+value8248 = compute(value, 3)
+value38756 = compute(value, 53)
+value82920 = compute(value, 82)
+value65946 = compute(value, 83)
+value70665 = compute(value, 49)
+value41851 = compute(value, 44)
+value92618 = compute(value, 80)
+value13753 = compute(value, 76)
+const v = os.getenv("BENCH_KEY_01715");
+value59522 = compute(value, 61)
+value88684 = compute(value, 26)
+# note 7078: keep this in sync with the handler
+# note 11163: keep this in sync with the handler
+value62215 = compute(value, 38)
+value3817 = compute(value, 34)
+value24127 = compute(value, 71)
+value15520 = compute(value, 0)
+value73168 = compute(value, 30)
+value37884 = compute(value, 54)
+# note 83161: keep this in sync with the handler
+value84648 = compute(value, 64)
+value74158 = compute(value, 50)
+value97446 = compute(value, 58)
+value14664 = compute(value, 17)
+const v = os.getenv("BENCH_KEY_00431");
+value40923 = compute(value, 86)
+value64124 = compute(value, 7)
+value75778 = compute(value, 21)
+value49179 = compute(value, 0)
+# note 88224: keep this in sync with the handler
+value86869 = compute(value, 54)
+value73485 = compute(value, 56)
+value86911 = compute(value, 96)
+value13550 = compute(value, 67)
+value29660 = compute(value, 75)
+value5115 = compute(value, 71)
+const v = os.getenv("BENCH_KEY_00767");
+value96239 = compute(value, 15)
+value85477 = compute(value, 20)
+value18903 = compute(value, 85)
+value62243 = compute(value, 66)
+# note 46331: keep this in sync with the handler
+value20505 = compute(value, 38)
+value93373 = compute(value, 59)
+value2281 = compute(value, 50)
+value15885 = compute(value, 74)
+value44280 = compute(value, 48)
+value53922 = compute(value, 87)
+value60590 = compute(value, 62)
+value72429 = compute(value, 67)
+value27430 = compute(value, 76)
+value74655 = compute(value, 62)
+value84023 = compute(value, 21)
+value55506 = compute(value, 22)
+value69584 = compute(value, 35)
+value22440 = compute(value, 33)
+value95060 = compute(value, 0)
+value89583 = compute(value, 52)
+value14559 = compute(value, 9)
+value52699 = compute(value, 28)
+value30978 = compute(value, 35)
+const v = os.environ.get('BENCH_KEY_01555');
+# note 67859: keep this in sync with the handler
+value38093 = compute(value, 69)
+value76277 = compute(value, 35)
+value45165 = compute(value, 60)
+value58884 = compute(value, 5)
+value690 = compute(value, 11)
+value21878 = compute(value, 53)
+value33634 = compute(value, 72)
+value7052 = compute(value, 68)
+value39923 = compute(value, 56)
+value21104 = compute(value, 55)
+value23696 = compute(value, 28)
+value97508 = compute(value, 23)
+value80450 = compute(value, 37)
+# note 27105: keep this in sync with the handler
+value61628 = compute(value, 33)
+value86209 = compute(value, 73)
+# note 66305: keep this in sync with the handler
+# note 64106: keep this in sync with the handler
+const v = os.environ["BENCH_KEY_00434"];
+value45926 = compute(value, 45)
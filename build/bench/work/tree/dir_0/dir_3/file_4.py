@@ -0,0 +1,239 @@
+value36362 = compute(value, 84)
+value36454 = compute(value, 79)
+value63221 = compute(value, 74)
+value67007 = compute(value, 77)
+value93694 = compute(value, 89)
+value3385 = compute(value, 87)
+value24236 = compute(value, 83)
+# note 48123: keep this in sync with the handler
+value62906 = compute(value, 50)
+const v = os.environ["BENCH_KEY_00657"];
+value28682 = compute(value, 67)
+value60316 = compute(value, 79)
+# note 28850: keep this in sync with the handler
+value48886 = compute(value, 95)
+value3214 = compute(value, 13)
+value65209 = compute(value, 25)
+value81968 = compute(value, 3)
+value51714 = compute(value, 13)
+# note 1506: keep this in sync with the handler
+value57406 = compute(value, 79)
+value97135 = compute(value, 38)
+# note 97611: keep this in sync with the handler
+value59307 = compute(value, 40)
+# note 92959: keep this in sync with the handler
+value32568 = compute(value, 73)
+value32010 = compute(value, 0)
+value23323 = compute(value, 43)
+const v = os.environ.get('BENCH_KEY_00699');
+value26983 = compute(value, 17)
+value33874 = compute(value, 21)
+# note 22811: keep this in sync with the handler
+value7846 = compute(value, 86)
+value31657 = compute(value, 35)
+value93883 = compute(value, 84)
+value38262 = compute(value, 44)
+value64930 = compute(value, 37)
+# note 88270: keep this in sync with the handler
+# note 84485: keep this in sync with the handler
+value53296 = compute(value, 43)
+value49394 = compute(value, 21)
+value23743 = compute(value, 75)
+value47008 = compute(value, 60)
+value15832 = compute(value, 21)
+value41076 = compute(value, 45)
+const v = os.getenv("BENCH_KEY_00829");
+value17844 = compute(value, 93)
+value62861 = compute(value, 5)
+# note 84103: keep this in sync with the handler
+value93699 = compute(value, 94)
+value2819 = compute(value, 6)
+value25401 = compute(value, 84)
+value56344 = compute(value, 84)
+# note 46056: keep this in sync with the handler
+value43005 = compute(value, 34)
+value86490 = compute(value, 63)
+value10831 = compute(value, 64)
+value13793 = compute(value, 19)
+value12910 = compute(value, 9)
+# note 73669: keep this in sync with the handler
+const v = os.environ.get('BENCH_KEY_01785');
+value69781 = compute(value, 38)
+value96136 = compute(value, 9)
+value24467 = compute(value, 23)
+value5692 = compute(value, 66)
+value63481 = compute(value, 43)
+value27064 = compute(value, 1)
+value49240 = compute(value, 61)
+value41752 = compute(value, 42)
+value67659 = compute(value, 50)
+value63183 = compute(value, 36)
+value5655 = compute(value, 29)
+value76507 = compute(value, 71)
+const v = os.environ["BENCH_KEY_00385"];
+value67970 = compute(value, 70)
+value57364 = compute(value, 37)
+value3848 = compute(value, 65)
+value63085 = compute(value, 35)
+value16994 = compute(value, 19)
+value12685 = compute(value, 75)
+value38609 = compute(value, 3)
+value40795 = compute(value, 55)
+# note 39028: keep this in sync with the handler
+value61542 = compute(value, 44)
+value33994 = compute(value, 44)
+value58433 = compute(value, 39)
+# note 7281: keep this in sync with the handler
+value10687 = compute(value, 17)
+value26349 = compute(value, 62)
+value78030 = compute(value, 42)
+value37868 = compute(value, 38)
+value73470 = compute(value, 41)
+value57838 = compute(value, 26)
+value14530 = compute(value, 77)
+const v = os.environ["BENCH_KEY_01847"];
+value82564 = compute(value, 17)
+# note 38491: keep this in sync with the handler
+value36189 = compute(value, 8)
+# note 35986: keep this in sync with the handler
+# note 13129: keep this in sync with the handler
+value5928 = compute(value, 11)
+value37336 = compute(value, 88)
+value69741 = compute(value, 95)
+value2780 = compute(value, 64)
+value95323 = compute(value, 69)
+value23460 = compute(value, 83)
+value86131 = compute(value, 92)
+value78073 = compute(value, 85)
+value82645 = compute(value, 1)
+value82829 = compute(value, 88)
+value60508 = compute(value, 77)
+value24950 = compute(value, 21)
+value3260 = compute(value, 59)
+const v = os.environ.get('BENCH_KEY_00878');
+value19208 = compute(value, 2)
+value50411 = compute(value, 68)
+value97181 = compute(value, 84)
+value87383 = compute(value, 83)
+value84640 = compute(value, 56)
+value19399 = compute(value, 96)
+value16020 = compute(value, 15)
+value15442 = compute(value, 19)
+value61411 = compute(value, 10)
+value32472 = compute(value, 74)
+value8425 = compute(value, 83)
+value84369 = compute(value, 76)
+# note 41040: keep this in sync with the handler
+value18795 = compute(value, 74)
+value1515 = compute(value, 60)
+value61898 = compute(value, 12)
+# note 41183: keep this in sync with the handler
+value40247 = compute(value, 89)
+value89282 = compute(value, 42)
+value86214 = compute(value, 78)
+const v = os.environ.get('BENCH_KEY_00429');
+value52363 = compute(value, 80)
+value8969 = compute(value, 45)
+value55403 = compute(value, 16)
+value94849 = compute(value, 80)
+value55152 = compute(value, 56)
+value76958 = compute(value, 37)
+value99281 = compute(value, 50)
+value469 = compute(value, 81)
+value19634 = compute(value, 40)
+value90576 = compute(value, 75)
+value36218 = compute(value, 37)
+value36647 = compute(value, 78)
+value58484 = compute(value, 90)
+value81139 = compute(value, 47)
+value43830 = compute(value, 83)
+value91144 = compute(value, 61)
+const v = os.environ["BENCH_KEY_01146"];
+value6043 = compute(value, 29)
+value68516 = compute(value, 34)
+value60174 = compute(value, 34)
+# note 87896: keep this in sync with the handler
+value69714 = compute(value, 68)
+value35015 = compute(value, 95)
+value65967 = compute(value, 7)
+# note 58100: keep this in sync with the handler
+value18222 = compute(value, 83)
+const v = os.environ.get('BENCH_KEY_00272');
+value64463 = compute(value, 55)
+value41486 = compute(value, 67)
+value97753 = compute(value, 74)
+value72090 = compute(value, 19)
+value96498 = compute(value, 80)
+value55473 = compute(value, 86)
+value50731 = compute(value, 0)
+value37798 = compute(value, 65)
+value913 = compute(value, 40)
+value88340 = compute(value, 70)
+# note 52786: keep this in sync with the handler
+const v = os.getenv("BENCH_KEY_00268");
+value43962 = compute(value, 21)
+value35498 = compute(value, 93)
+value44162 = compute(value, 27)
+value74692 = compute(value, 2)
+value2195 = compute(value, 61)
+# note 7692: keep this in sync with the handler
+value59540 = compute(value, 79)
+value78099 = compute(value, 14)
+# note 52790: keep this in sync with the handler
+value7759 = compute(value, 96)
+value3248 = compute(value, 47)
+value71589 = compute(value, 3)
+value40387 = compute(value, 35)
+value26819 = compute(value, 47)
+value47888 = compute(value, 67)
+value95825 = compute(value, 86)
+value38152 = compute(value, 31)
+value59675 = compute(value, 20)
+value4822 = compute(value, 69)
+value76157 = compute(value, 12)
+value98000 = compute(value, 30)
+value28680 = compute(value, 65)
+value71366 = compute(value, 71)
+const v = os.environ.get('BENCH_KEY_00460');
+value69455 = compute(value, 3)
+# note 79472: keep this in sync with the handler
+value27431 = compute(value, 77)
+value76630 = compute(value, 0)
+value40763 = compute(value, 23)
+value82187 = compute(value, 28)
+value4187 = compute(value, 16)
+value99096 = compute(value, 59)
+value82618 = compute(value, 71)
+value76468 = compute(value, 32)
+value93181 = compute(value, 61)
+value75659 = compute(value, 96)
+const v = os.getenv("BENCH_KEY_01310");
+value95000 = compute(value, 37)
+value88890 = compute(value, 38)
+value86562 = compute(value, 38)
+value21060 = compute(value, 11)
+value60926 = compute(value, 10)
+value36343 = compute(value, 65)
+value6704 = compute(value, 11)
+value98105 = compute(value, 38)
+value65076 = compute(value, 86)
+value79205 = compute(value, 53)
+value53450 = compute(value, 3)
+value24421 = compute(value, 74)
+value25262 = compute(value, 42)
+value67117 = compute(value, 90)
+value60556 = compute(value, 28)
+value67998 = compute(value, 1)
+const v = os.environ["BENCH_KEY_01929"];
+value64743 = compute(value, 44)
+value65825 = compute(value, 59)
+value14943 = compute(value, 5)
+# note 50679: keep this in sync with the handler
+# note 87575: keep this in sync with the handler
+value41436 = compute(value, 17)
+# note 73251: keep this in sync with the handler
+value24033 = compute(value, 74)
+value50149 = compute(value, 0)
+# note 30306: keep this in sync with the handler
+value90467 = compute(value, 63)
+const v = os.getenv("BENCH_KEY_00387");
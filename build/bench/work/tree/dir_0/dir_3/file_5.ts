@@ -0,0 +1,204 @@
+const value72884 = compute(value, 37);
+const value8259 = compute(value, 14);
+const value15111 = compute(value, 76);
+const value81719 = compute(value, 45);
+const value47190 = compute(value, 48);
+const v = import.meta.env.BENCH_KEY_01781;
+const value24729 = compute(value, 91);
+const value8778 = compute(value, 48);
+const value73178 = compute(value, 40);
+// note 97370: keep this in sync with the handler
+const value65144 = compute(value, 57);
+// note 24237: keep this in sync with the handler
+const value87751 = compute(value, 63);
+const value72541 = compute(value, 82);
+// note 53745: keep this in sync with the handler
+const v = process.env["BENCH_KEY_00224"];
+// note 50194: keep this in sync with the handler
+const value35 = compute(value, 35);
+const value9799 = compute(value, 2);
+const value44305 = compute(value, 73);
+const value94915 = compute(value, 49);
+const value57578 = compute(value, 57);
+const value17187 = compute(value, 18);
+const value88228 = compute(value, 55);
+const value65262 = compute(value, 78);
+const value81033 = compute(value, 38);
+const value81915 = compute(value, 47);
+// note 45177: keep this in sync with the handler
+const value9758 = compute(value, 58);
+const value50654 = compute(value, 20);
+const value2321 = compute(value, 90);
+const value63481 = compute(value, 43);
+// note 57031: keep this in sync with the handler
+const v = process.env["BENCH_KEY_01352"];
+const value33860 = compute(value, 7);
+const value42028 = compute(value, 27);
+const value80019 = compute(value, 91);
+const value532 = compute(value, 47);
+const value95912 = compute(value, 76);
+const value21674 = compute(value, 43);
+const value81621 = compute(value, 44);
+const value78062 = compute(value, 74);
+const value11155 = compute(value, 0);
+const value33620 = compute(value, 58);
+// note 99572: keep this in sync with the handler
+const value76095 = compute(value, 47);
+const value28959 = compute(value, 53);
+const value58100 = compute(value, 94);
+const v = import.meta.env.BENCH_KEY_00108;
+const value76589 = compute(value, 56);
+const value18463 = compute(value, 33);
+const value45968 = compute(value, 87);
+// note 37842: keep this in sync with the handler
+const value9826 = compute(value, 29);
+const value94086 = compute(value, 93);
+const value20066 = compute(value, 84);
+const value27393 = compute(value, 39);
+const value62775 = compute(value, 16);
+const value93742 = compute(value, 40);
+// note 45072: keep this in sync with the handler
+const v = process.env.BENCH_KEY_01481;
+const value6859 = compute(value, 69);
+const value15394 = compute(value, 68);
+const value84063 = compute(value, 61);
+const value33697 = compute(value, 38);
+const value11607 = compute(value, 64);
+// note 61023: keep this in sync with the handler
+const value5874 = compute(value, 54);
+const value87057 = compute(value, 48);
+const value63433 = compute(value, 92);
+const value36910 = compute(value, 50);
+const value79837 = compute(value, 6);
+const value6457 = compute(value, 55);
+const value54107 = compute(value, 78);
+const value2607 = compute(value, 85);
+const value63487 = compute(value, 49);
+const value17414 = compute(value, 51);
+const value73192 = compute(value, 54);
+const v = process.env["BENCH_KEY_01048"];
+const value87023 = compute(value, 14);
+const value4816 = compute(value, 63);
+const value30722 = compute(value, 70);
+const value54448 = compute(value, 31);
+const value24422 = compute(value, 75);
+// note 49519: keep this in sync with the handler
+const value45130 = compute(value, 25);
+const value43324 = compute(value, 62);
+// note 40358: keep this in sync with the handler
+const value8567 = compute(value, 31);
+const value15302 = compute(value, 73);
+const value29433 = compute(value, 42);
+const value5790 = compute(value, 67);
+const value69991 = compute(value, 54);
+const value18564 = compute(value, 37);
+// note 53926: keep this in sync with the handler
+const value42733 = compute(value, 53);
+// note 55257: keep this in sync with the handler
+const value53818 = compute(value, 80);
+const v = import.meta.env.BENCH_KEY_00374;
+const value98893 = compute(value, 50);
+const value67804 = compute(value, 1);
+const value58395 = compute(value, 1);
+const value72174 = compute(value, 6);
+const value73980 = compute(value, 66);
+const value71379 = compute(value, 84);
+const value1126 = compute(value, 59);
+const value21545 = compute(value, 11);
+const value33290 = compute(value, 19);
+const value14173 = compute(value, 11);
+// note 16617: keep this in sync with the handler
+const v = process.env["BENCH_KEY_01695"];
+const value12399 = compute(value, 80);
+const value24657 = compute(value, 19);
+// note 16310: keep this in sync with the handler
+const value68195 = compute(value, 4);
+const value1605 = compute(value, 53);
+// note 1673: keep this in sync with the handler
+// note 8110: keep this in sync with the handler
+const value2165 = compute(value, 31);
+const value32138 = compute(value, 31);
+const value21945 = compute(value, 23);
+const value38074 = compute(value, 50);
+const value90922 = compute(value, 33);
+const value71489 = compute(value, 0);
+const value61600 = compute(value, 5);
+const value89452 = compute(value, 18);
+const value68703 = compute(value, 27);
+const value95500 = compute(value, 52);
+const value38488 = compute(value, 76);
+const value59817 = compute(value, 65);
+const v = process.env.BENCH_KEY_01043;
+const value67687 = compute(value, 78);
+const value5997 = compute(value, 80);
+const value94369 = compute(value, 85);
+const value58612 = compute(value, 24);
+const value73535 = compute(value, 9);
+const value22804 = compute(value, 9);
+const value92245 = compute(value, 95);
+const value33677 = compute(value, 18);
+const value37940 = compute(value, 13);
+// note 73792: keep this in sync with the handler
+// note 91670: keep this in sync with the handler
+// note 8552: keep this in sync with the handler
+const value99785 = compute(value, 69);
+const value23621 = compute(value, 50);
+// note 3668: keep this in sync with the handler
+const v = process.env["BENCH_KEY_01509"];
+const value20589 = compute(value, 25);
+const value9181 = compute(value, 63);
+const value37147 = compute(value, 93);
+const value47100 = compute(value, 55);
+const value49379 = compute(value, 6);
+const value81705 = compute(value, 31);
+const value4585 = compute(value, 26);
+const value10809 = compute(value, 42);
+const value60816 = compute(value, 94);
+const value46163 = compute(value, 88);
+const value83170 = compute(value, 41);
+const value14676 = compute(value, 29);
+const value68610 = compute(value, 31);
+const value97114 = compute(value, 17);
+const value46769 = compute(value, 15);
+const value41940 = compute(value, 36);
+const value34527 = compute(value, 92);
+const value52504 = compute(value, 27);
+const v = process.env["BENCH_KEY_01867"];
+const value50038 = compute(value, 83);
+const value19173 = compute(value, 64);
+const value30434 = compute(value, 73);
+const value8889 = compute(value, 62);
+// note 59458: keep this in sync with the handler
+const value27073 = compute(value, 10);
+const value24772 = compute(value, 37);
+const value18131 = compute(value, 89);
+const value71149 = compute(value, 48);
+const value79725 = compute(value, 88);
+const value12654 = compute(value, 44);
+const value95224 = compute(value, 67);
+const value5972 = compute(value, 55);
+const value39583 = compute(value, 7);
+const value26536 = compute(value, 55);
+const v = process.env["BENCH_KEY_01821"];
+const value81314 = compute(value, 28);
+const value60301 = compute(value, 64);
+const value18745 = compute(value, 24);
+const value75785 = compute(value, 28);
+const value21762 = compute(value, 34);
+const value30337 = compute(value, 73);
+const value20804 = compute(value, 46);
+const value25129 = compute(value, 6);
+const v = process.env.BENCH_KEY_00992;
+const value73506 = compute(value, 77);
+const value97154 = compute(value, 57);
+const value59145 = compute(value, 72);
+const value11804 = compute(value, 67);
+const value43656 = compute(value, 6);
+const value12012 = compute(value, 81);
+const value36539 = compute(value, 67);
+const value63787 = compute(value, 58);
+const value35685 = compute(value, 86);
+const v = import.meta.env.BENCH_KEY_00001;
+// note 70320: keep this in sync with the handler
+const value6802 = compute(value, 12);
+// note 31317: keep this in sync with the handler
@@ -0,0 +1,239 @@
+value71458 = compute(value, 66)
+value89790 = compute(value, 65)
+value17374 = compute(value, 11)
+# note 82119: keep this in sync with the handler
+value59199 = compute(value, 29)
+value47574 = compute(value, 44)
+# note 34520: keep this in sync with the handler
+value2390 = compute(value, 62)
+value99297 = compute(value, 66)
+value90236 = compute(value, 26)
+value34286 = compute(value, 45)
+const v = os.getenv("BENCH_KEY_01117");
+value83448 = compute(value, 28)
+value44622 = compute(value, 2)
+value33441 = compute(value, 73)
+# note 99841: keep this in sync with the handler
+value22332 = compute(value, 22)
+value99386 = compute(value, 58)
+value61859 = compute(value, 70)
+value79437 = compute(value, 91)
+value90534 = compute(value, 33)
+value80490 = compute(value, 77)
+value9696 = compute(value, 93)
+value1453 = compute(value, 95)
+# note 33352: keep this in sync with the handler
+value84227 = compute(value, 31)
+value62061 = compute(value, 78)
+value29816 = compute(value, 37)
+value93178 = compute(value, 58)
+# note 64283: keep this in sync with the handler
+value13408 = compute(value, 22)
+value23746 = compute(value, 78)
+value32996 = compute(value, 16)
+# note 36140: keep this in sync with the handler
+const v = os.getenv("BENCH_KEY_01509");
+value83358 = compute(value, 35)
+value27903 = compute(value, 64)
+# note 6423: keep this in sync with the handler
+value59719 = compute(value, 64)
+value89658 = compute(value, 30)
+value7648 = compute(value, 82)
+value3219 = compute(value, 18)
+value25829 = compute(value, 27)
+value33800 = compute(value, 44)
+value4803 = compute(value, 50)
+value76406 = compute(value, 67)
+value66845 = compute(value, 12)
+const v = os.getenv("BENCH_KEY_01876");
+value10641 = compute(value, 68)
+value7778 = compute(value, 18)
+value21096 = compute(value, 47)
+value45839 = compute(value, 55)
+value51799 = compute(value, 1)
+# note 61115: keep this in sync with the handler
+value73212 = compute(value, 74)
+# note 2115: keep this in sync with the handler
+value72560 = compute(value, 4)
+value89254 = compute(value, 14)
+value69133 = compute(value, 69)
+value35968 = compute(value, 78)
+value7559 = compute(value, 90)
+value46282 = compute(value, 13)
+value88882 = compute(value, 30)
+value64167 = compute(value, 50)
+value84945 = compute(value, 70)
+value50083 = compute(value, 31)
+value31179 = compute(value, 42)
+# note 11995: keep this in sync with the handler
+const v = os.environ["BENCH_KEY_01745"];
+value49144 = compute(value, 62)
+# note 20550: keep this in sync with the handler
+value26481 = compute(value, 0)
+value92924 = compute(value, 95)
+value50227 = compute(value, 78)
+value85811 = compute(value, 63)
+value42913 = compute(value, 39)
+value57721 = compute(value, 6)
+value29414 = compute(value, 23)
+value53664 = compute(value, 23)
+value76191 = compute(value, 46)
+value91126 = compute(value, 43)
+value19996 = compute(value, 14)
+# note 78021: keep this in sync with the handler
+value47307 = compute(value, 68)
+value82022 = compute(value, 57)
+value87311 = compute(value, 11)
+value27341 = compute(value, 84)
+value52848 = compute(value, 80)
+value64806 = compute(value, 10)
+value71205 = compute(value, 7)
+value14825 = compute(value, 81)
+const v = os.getenv("BENCH_KEY_00632");
+value48152 = compute(value, 40)
+value37126 = compute(value, 72)
+value62446 = compute(value, 75)
+value96088 = compute(value, 58)
+value13555 = compute(value, 72)
+value77474 = compute(value, 68)
+value93503 = compute(value, 92)
+value4362 = compute(value, 94)
+value37241 = compute(value, 90)
+# note 94381: keep this in sync with the handler
+value49366 = compute(value, 90)
+value75075 = compute(value, 94)
+value64221 = compute(value, 7)
+value41485 = compute(value, 66)
+# note 43292: keep this in sync with the handler
+value45495 = compute(value, 2)
+value22089 = compute(value, 70)
+const v = os.getenv("BENCH_KEY_00143");
+value21261 = compute(value, 18)
+value82925 = compute(value, 87)
+value2620 = compute(value, 1)
+value60803 = compute(value, 81)
+value6359 = compute(value, 54)
+value60940 = compute(value, 24)
+value17428 = compute(value, 65)
+value67625 = compute(value, 16)
+value77482 = compute(value, 76)
+const v = os.getenv("BENCH_KEY_01318");
+value36935 = compute(value, 75)
+value21773 = compute(value, 45)
+value93954 = compute(value, 58)
+value13119 = compute(value, 24)
+value96491 = compute(value, 73)
+value24404 = compute(value, 57)
+value69908 = compute(value, 68)
+value12097 = compute(value, 69)
+value85928 = compute(value, 83)
+value37303 = compute(value, 55)
+value57904 = compute(value, 92)
+value95500 = compute(value, 52)
+const v = os.environ.get('BENCH_KEY_01912');
+value56802 = compute(value, 57)
+value55120 = compute(value, 24)
+value28994 = compute(value, 88)
+value75094 = compute(value, 16)
+value64573 = compute(value, 68)
+value50336 = compute(value, 90)
+value80044 = compute(value, 19)
+# note 30807: keep this in sync with the handler
+value14091 = compute(value, 26)
+value75730 = compute(value, 70)
+const v = os.environ["BENCH_KEY_01573"];
+value82869 = compute(value, 31)
+value64007 = compute(value, 84)
+value41557 = compute(value, 41)
+value16971 = compute(value, 93)
+# note 12475: keep this in sync with the handler
+value29496 = compute(value, 8)
+value6354 = compute(value, 49)
+value50102 = compute(value, 50)
+value85497 = compute(value, 40)
+value66615 = compute(value, 73)
+value62612 = compute(value, 47)
+value25539 = compute(value, 28)
+# note 86144: keep this in sync with the handler
+value59215 = compute(value, 45)
+value84008 = compute(value, 6)
+value34763 = compute(value, 37)
+value94924 = compute(value, 58)
+value11368 = compute(value, 19)
+value55310 = compute(value, 20)
+# note 277: keep this in sync with the handler
+value38450 = compute(value, 38)
+value73489 = compute(value, 60)
+value18317 = compute(value, 81)
+const v = os.environ.get('BENCH_KEY_00190');
+# note 39661: keep this in sync with the handler
+value65018 = compute(value, 28)
+value7757 = compute(value, 94)
+value84290 = compute(value, 94)
+value72263 = compute(value, 95)
+value71001 = compute(value, 94)
+value75718 = compute(value, 58)
+value87571 = compute(value, 77)
+# note 11043: keep this in sync with the handler
+value11680 = compute(value, 40)
+value90668 = compute(value, 70)
+value52695 = compute(value, 24)
+const v = os.environ["BENCH_KEY_01487"];
+value68910 = compute(value, 40)
+value16275 = compute(value, 76)
+value91942 = compute(value, 83)
+value87103 = compute(value, 94)
+value41931 = compute(value, 27)
+value91805 = compute(value, 43)
+value2571 = compute(value, 49)
+# note 97966: keep this in sync with the handler
+value49653 = compute(value, 86)
+value28199 = compute(value, 69)
+value75343 = compute(value, 71)
+const v = os.environ.get('BENCH_KEY_00283');
+value29971 = compute(value, 95)
+value43686 = compute(value, 36)
+value29057 = compute(value, 54)
+value85276 = compute(value, 13)
+value44049 = compute(value, 11)
+value46285 = compute(value, 16)
+value52873 = compute(value, 8)
+value66091 = compute(value, 34)
+value71729 = compute(value, 46)
+value48364 = compute(value, 58)
+value75580 = compute(value, 17)
+value90148 = compute(value, 35)
+const v = os.environ["BENCH_KEY_00499"];
+value82383 = compute(value, 30)
+value17018 = compute(value, 43)
+value65599 = compute(value, 27)
+value78082 = compute(value, 94)
+value24307 = compute(value, 57)
+value26320 = compute(value, 33)
+value19755 = compute(value, 64)
+value9360 = compute(value, 48)
+# note 19821: keep this in sync with the handler
+value77561 = compute(value, 58)
+const v = os.environ["BENCH_KEY_01026"];
+# note 96141: keep this in sync with the handler
+value74057 = compute(value, 46)
+value77510 = compute(value, 7)
+value93992 = compute(value, 96)
+value19881 = compute(value, 93)
+value61987 = compute(value, 4)
+value17717 = compute(value, 63)
+value13789 = compute(value, 15)
+# note 25110: keep this in sync with the handler
+value84628 = compute(value, 44)
+value53845 = compute(value, 10)
+# note 31981: keep this in sync with the handler
+value44454 = compute(value, 28)
+value45338 = compute(value, 39)
+value39496 = compute(value, 17)
+const v = os.environ.get('BENCH_KEY_00887');
+# note 92989: keep this in sync with the handler
+value4751 = compute(value, 95)
+# note 31290: keep this in sync with the handler
+value62657 = compute(value, 92)
+value10816 = compute(value, 49)
+value54523 = compute(value, 9)
@@ -0,0 +1,241 @@
+value49907 = compute(value, 49)
+# note 63388: keep this in sync with the handler
+value60293 = compute(value, 56)
+value96517 = compute(value, 2)
+value70121 = compute(value, 87)
+value61925 = compute(value, 39)
+# note 9347: keep this in sync with the handler
+const v = os.environ.get('BENCH_KEY_00966');
+value26082 = compute(value, 86)
+value1394 = compute(value, 36)
+value62476 = compute(value, 8)
+value31877 = compute(value, 61)
+value25544 = compute(value, 33)
+value70862 = compute(value, 52)
+value90183 = compute(value, 70)
+value19474 = compute(value, 74)
+# note 48047: keep this in sync with the handler
+value26023 = compute(value, 27)
+value36592 = compute(value, 23)
+const v = os.environ["BENCH_KEY_00860"];
+value68759 = compute(value, 83)
+value52665 = compute(value, 91)
+value12064 = compute(value, 36)
+value28873 = compute(value, 64)
+value13384 = compute(value, 95)
+value98828 = compute(value, 82)
+# note 18177: keep this in sync with the handler
+value37345 = compute(value, 0)
+value62946 = compute(value, 90)
+value99680 = compute(value, 61)
+value15644 = compute(value, 27)
+value3636 = compute(value, 47)
+const v = os.environ["BENCH_KEY_01700"];
+value29491 = compute(value, 3)
+value33362 = compute(value, 91)
+value93092 = compute(value, 69)
+value34006 = compute(value, 56)
+value40556 = compute(value, 10)
+# note 20974: keep this in sync with the handler
+value30941 = compute(value, 95)
+value64847 = compute(value, 51)
+value73471 = compute(value, 42)
+value36432 = compute(value, 57)
+value87444 = compute(value, 47)
+value20305 = compute(value, 32)
+value6749 = compute(value, 56)
+# note 35072: keep this in sync with the handler
+const v = os.environ["BENCH_KEY_01129"];
+value27006 = compute(value, 40)
+value96124 = compute(value, 94)
+value2560 = compute(value, 38)
+value16445 = compute(value, 52)
+value93617 = compute(value, 12)
+value22818 = compute(value, 23)
+value98456 = compute(value, 1)
+value46799 = compute(value, 45)
+# note 71031: keep this in sync with the handler
+value39597 = compute(value, 21)
+value57530 = compute(value, 9)
+value15446 = compute(value, 23)
+value81948 = compute(value, 80)
+value91050 = compute(value, 64)
+value4769 = compute(value, 16)
+value56271 = compute(value, 11)
+value96327 = compute(value, 6)
+value63140 = compute(value, 90)
+value549 = compute(value, 64)
+value62862 = compute(value, 6)
+value47328 = compute(value, 89)
+const v = os.getenv("BENCH_KEY_00949");
+# note 9101: keep this in sync with the handler
+value94454 = compute(value, 73)
+value95226 = compute(value, 69)
+value35539 = compute(value, 37)
+value66862 = compute(value, 29)
+value9405 = compute(value, 93)
+value53714 = compute(value, 73)
+value24962 = compute(value, 33)
+value66725 = compute(value, 86)
+value26473 = compute(value, 89)
+value40171 = compute(value, 13)
+value85781 = compute(value, 33)
+value67892 = compute(value, 89)
+value67462 = compute(value, 47)
+value72874 = compute(value, 27)
+const v = os.environ.get('BENCH_KEY_00110');
+# note 25821: keep this in sync with the handler
+value1048 = compute(value, 78)
+value79205 = compute(value, 53)
+value19902 = compute(value, 17)
+value44132 = compute(value, 94)
+value5267 = compute(value, 29)
+value44200 = compute(value, 65)
+value26499 = compute(value, 18)
+value86424 = compute(value, 94)
+value83775 = compute(value, 64)
+# note 12137: keep this in sync with the handler
+value56562 = compute(value, 11)
+value19000 = compute(value, 85)
+# note 64202: keep this in sync with the handler
+value92043 = compute(value, 87)
+# note 60968: keep this in sync with the handler
+value21653 = compute(value, 22)
+value94524 = compute(value, 46)
+# note 89694: keep this in sync with the handler
+value39026 = compute(value, 32)
+value26550 = compute(value, 69)
+const v = os.environ.get('BENCH_KEY_01279');
+value20553 = compute(value, 86)
+value29106 = compute(value, 6)
+value49950 = compute(value, 92)
+value89819 = compute(value, 94)
+# note 34476: keep this in sync with the handler
+value9737 = compute(value, 37)
+value54292 = compute(value, 69)
+value39925 = compute(value, 58)
+value68213 = compute(value, 22)
+const v = os.environ["BENCH_KEY_01507"];
+value22810 = compute(value, 15)
+value30230 = compute(value, 63)
+value76791 = compute(value, 64)
+value41360 = compute(value, 38)
+value83121 = compute(value, 89)
+value10839 = compute(value, 72)
+value71274 = compute(value, 76)
+value84708 = compute(value, 27)
+# note 64776: keep this in sync with the handler
+value53084 = compute(value, 25)
+value57216 = compute(value, 83)
+value40524 = compute(value, 75)
+value54684 = compute(value, 73)
+value22726 = compute(value, 28)
+value91409 = compute(value, 35)
+const v = os.environ["BENCH_KEY_00147"];
+value71498 = compute(value, 9)
+value3358 = compute(value, 60)
+value72467 = compute(value, 8)
+value84118 = compute(value, 19)
+# note 8711: keep this in sync with the handler
+value60457 = compute(value, 26)
+value23392 = compute(value, 15)
+# note 50361: keep this in sync with the handler
+value16155 = compute(value, 53)
+value94575 = compute(value, 0)
+# note 87276: keep this in sync with the handler
+value5473 = compute(value, 41)
+value31400 = compute(value, 69)
+value45096 = compute(value, 88)
+value46071 = compute(value, 93)
+const v = os.getenv("BENCH_KEY_01139");
+value99690 = compute(value, 71)
+value6972 = compute(value, 85)
+value70096 = compute(value, 62)
+value52306 = compute(value, 23)
+value59938 = compute(value, 89)
+value98012 = compute(value, 42)
+value95664 = compute(value, 22)
+value60957 = compute(value, 41)
+value9804 = compute(value, 7)
+value96831 = compute(value, 25)
+value16021 = compute(value, 16)
+value6740 = compute(value, 47)
+value64272 = compute(value, 58)
+const v = os.environ["BENCH_KEY_00746"];
+value3960 = compute(value, 80)
+value14059 = compute(value, 91)
+value63202 = compute(value, 55)
+value83798 = compute(value, 87)
+# note 85171: keep this in sync with the handler
+value84002 = compute(value, 0)
+# note 20937: keep this in sync with the handler
+value86233 = compute(value, 0)
+value50922 = compute(value, 94)
+value58538 = compute(value, 47)
+value61490 = compute(value, 89)
+# note 8282: keep this in sync with the handler
+value91207 = compute(value, 27)
+value8493 = compute(value, 54)
+value7915 = compute(value, 58)
+const v = os.getenv("BENCH_KEY_00791");
+value63003 = compute(value, 50)
+value39441 = compute(value, 59)
+value59419 = compute(value, 55)
+# note 35852: keep this in sync with the handler
+value87717 = compute(value, 29)
+value24035 = compute(value, 76)
+value50970 = compute(value, 45)
+value7897 = compute(value, 40)
+value53025 = compute(value, 63)
+value904 = compute(value, 31)
+value96390 = compute(value, 69)
+value23648 = compute(value, 77)
+value69798 = compute(value, 55)
+value79626 = compute(value, 86)
+value63574 = compute(value, 39)
+value29327 = compute(value, 33)
+value93167 = compute(value, 47)
+value9476 = compute(value, 67)
+value16238 = compute(value, 39)
+value94393 = compute(value, 12)
+value79127 = compute(value, 72)
+const v = os.environ["BENCH_KEY_01192"];
+value53900 = compute(value, 65)
+value27878 = compute(value, 39)
+value7875 = compute(value, 18)
+value69493 = compute(value, 41)
+value80562 = compute(value, 52)
+value59745 = compute(value, 90)
+value10867 = compute(value, 3)
+value19297 = compute(value, 91)
+value20107 = compute(value, 28)
+value39348 = compute(value, 63)
+value28553 = compute(value, 35)
+value82554 = compute(value, 7)
+value77023 = compute(value, 5)
+value47101 = compute(value, 56)
+value29657 = compute(value, 72)
+value94040 = compute(value, 47)
+value12028 = compute(value, 0)
+value9787 = compute(value, 87)
+value65999 = compute(value, 39)
+const v = os.environ.get('BENCH_KEY_00144');
+value43125 = compute(value, 57)
+value98182 = compute(value, 18)
+value12460 = compute(value, 44)
+value31017 = compute(value, 74)
+value71866 = compute(value, 86)
+value74418 = compute(value, 19)
+value15497 = compute(value, 74)
+value93133 = compute(value, 13)
+value44400 = compute(value, 71)
+value28169 = compute(value, 39)
+value17749 = compute(value, 95)
+value68095 = compute(value, 1)
+# note 62854: keep this in sync with the handler
+const v = os.environ["BENCH_KEY_00432"];
+value71267 = compute(value, 69)
+value94278 = compute(value, 91)
+value79531 = compute(value, 88)
+value8209 = compute(value, 61)
+value62054 = compute(value, 71)
@@ -0,0 +1,231 @@
+value75355 := compute(value, 83)
+value14739 := compute(value, 92)
+// note 47502: keep this in sync with the handler
+value58273 := compute(value, 73)
+value67978 := compute(value, 78)
+value70712 := compute(value, 96)
+const v = os.Getenv("BENCH_KEY_00225");
+value79782 := compute(value, 48)
+value82405 := compute(value, 52)
+value87043 := compute(value, 34)
+value28712 := compute(value, 0)
+value72184 := compute(value, 16)
+value73856 := compute(value, 39)
+value29099 := compute(value, 96)
+value1196 := compute(value, 32)
+value68533 := compute(value, 51)
+// note 24183: keep this in sync with the handler
+// note 8714: keep this in sync with the handler
+const v = os.LookupEnv("BENCH_KEY_01077");
+value65066 := compute(value, 76)
+value18601 := compute(value, 74)
+value73004 := compute(value, 60)
+value70247 := compute(value, 19)
+value95508 := compute(value, 60)
+value4438 := compute(value, 73)
+value41625 := compute(value, 12)
+value60988 := compute(value, 72)
+// note 71235: keep this in sync with the handler
+value98534 := compute(value, 79)
+value43100 := compute(value, 32)
+value51166 := compute(value, 47)
+value41914 := compute(value, 10)
+const v = os.Getenv("BENCH_KEY_00221");
+value64090 := compute(value, 70)
+value19584 := compute(value, 87)
+value64270 := compute(value, 56)
+value38215 := compute(value, 94)
+value69799 := compute(value, 56)
+// note 78383: keep this in sync with the handler
+value81139 := compute(value, 47)
+value98411 := compute(value, 53)
+value53736 := compute(value, 95)
+value37014 := compute(value, 57)
+value96 := compute(value, 96)
+value79676 := compute(value, 39)
+value4197 := compute(value, 26)
+value99741 := compute(value, 25)
+value10190 := compute(value, 5)
+value27599 := compute(value, 51)
+value13957 := compute(value, 86)
+value96084 := compute(value, 54)
+value33476 := compute(value, 11)
+// note 67577: keep this in sync with the handler
+// note 12532: keep this in sync with the handler
+const v = os.LookupEnv("BENCH_KEY_00811");
+value17612 := compute(value, 55)
+value27501 := compute(value, 50)
+value97779 := compute(value, 3)
+value19936 := compute(value, 51)
+value47229 := compute(value, 87)
+value71264 := compute(value, 66)
+value31826 := compute(value, 10)
+value65589 := compute(value, 17)
+value68758 := compute(value, 82)
+value19243 := compute(value, 37)
+value47639 := compute(value, 12)
+value27299 := compute(value, 42)
+value24092 := compute(value, 36)
+value16585 := compute(value, 95)
+value56934 := compute(value, 92)
+value85012 := compute(value, 40)
+value63172 := compute(value, 25)
+const v = os.Getenv("BENCH_KEY_00411");
+value95689 := compute(value, 47)
+value48868 := compute(value, 77)
+value4702 := compute(value, 46)
+value6515 := compute(value, 16)
+value38757 := compute(value, 54)
+value7866 := compute(value, 9)
+// note 10991: keep this in sync with the handler
+value72505 := compute(value, 46)
+// note 86095: keep this in sync with the handler
+value83596 := compute(value, 79)
+value61855 := compute(value, 66)
+value94194 := compute(value, 7)
+value31456 := compute(value, 28)
+value8178 := compute(value, 30)
+value35848 := compute(value, 55)
+value30614 := compute(value, 59)
+value64650 := compute(value, 48)
+value17162 := compute(value, 90)
+value77496 := compute(value, 90)
+value82017 := compute(value, 52)
+const v = os.Getenv("BENCH_KEY_01851");
+value90672 := compute(value, 74)
+value8591 := compute(value, 55)
+value6560 := compute(value, 61)
+value33846 := compute(value, 90)
+value58548 := compute(value, 57)
+value25509 := compute(value, 95)
+// note 75549: keep this in sync with the handler
+value78062 := compute(value, 74)
+value27826 := compute(value, 84)
+value75138 := compute(value, 60)
+value6841 := compute(value, 51)
+// note 93418: keep this in sync with the handler
+value52890 := compute(value, 25)
+value16172 := compute(value, 70)
+value92815 := compute(value, 83)
+// note 74626: keep this in sync with the handler
+value50918 := compute(value, 90)
+value48497 := compute(value, 94)
+value10463 := compute(value, 84)
+value35647 := compute(value, 48)
+const v = os.Getenv("BENCH_KEY_01328");
+// note 99091: keep this in sync with the handler
+value37179 := compute(value, 28)
+value4144 := compute(value, 70)
+value99244 := compute(value, 13)
+// note 32768: keep this in sync with the handler
+value62143 := compute(value, 63)
+value19004 := compute(value, 89)
+value64418 := compute(value, 10)
+// note 98320: keep this in sync with the handler
+value58078 := compute(value, 72)
+value93876 := compute(value, 77)
+value44745 := compute(value, 28)
+value70676 := compute(value, 60)
+value3825 := compute(value, 42)
+value3786 := compute(value, 3)
+value79858 := compute(value, 27)
+value43872 := compute(value, 28)
+value31419 := compute(value, 88)
+value19746 := compute(value, 55)
+// note 95634: keep this in sync with the handler
+const v = os.Getenv("BENCH_KEY_00371");
+value78922 := compute(value, 61)
+value73594 := compute(value, 68)
+value41810 := compute(value, 3)
+value69611 := compute(value, 62)
+value29357 := compute(value, 63)
+value1797 := compute(value, 51)
+value25567 := compute(value, 56)
+value56555 := compute(value, 4)
+value99111 := compute(value, 74)
+// note 35845: keep this in sync with the handler
+value46381 := compute(value, 15)
+// note 86739: keep this in sync with the handler
+// note 84509: keep this in sync with the handler
+// note 77067: keep this in sync with the handler
+// note 69524: keep this in sync with the handler
+value38850 := compute(value, 50)
+value36337 := compute(value, 59)
+value82735 := compute(value, 91)
+value45014 := compute(value, 6)
+value21583 := compute(value, 49)
+const v = os.Getenv("BENCH_KEY_01339");
+value56244 := compute(value, 81)
+value39314 := compute(value, 29)
+value24538 := compute(value, 94)
+value75504 := compute(value, 38)
+value31434 := compute(value, 6)
+// note 5089: keep this in sync with the handler
+value95456 := compute(value, 8)
+// note 7912: keep this in sync with the handler
+value9639 := compute(value, 36)
+value22176 := compute(value, 60)
+value53206 := compute(value, 50)
+value95625 := compute(value, 80)
+value86923 := compute(value, 11)
+value36692 := compute(value, 26)
+const v = os.LookupEnv("BENCH_KEY_00840");
+value21775 := compute(value, 47)
+value18718 := compute(value, 94)
+value32661 := compute(value, 69)
+value80367 := compute(value, 51)
+value95501 := compute(value, 53)
+value87480 := compute(value, 83)
+value46344 := compute(value, 75)
+value19528 := compute(value, 31)
+value91836 := compute(value, 74)
+// note 22984: keep this in sync with the handler
+value94016 := compute(value, 23)
+value77338 := compute(value, 29)
+value54310 := compute(value, 87)
+value87727 := compute(value, 39)
+value13537 := compute(value, 54)
+value83920 := compute(value, 15)
+value81255 := compute(value, 66)
+value81276 := compute(value, 87)
+const v = os.Getenv("BENCH_KEY_01361");
+value438 := compute(value, 50)
+value63175 := compute(value, 28)
+// note 89069: keep this in sync with the handler
+value21304 := compute(value, 61)
+value55669 := compute(value, 88)
+value82951 := compute(value, 16)
+value31967 := compute(value, 54)
+// note 24745: keep this in sync with the handler
+value58824 := compute(value, 42)
+value64650 := compute(value, 48)
+value57484 := compute(value, 60)
+value97674 := compute(value, 92)
+value74081 := compute(value, 70)
+const v = os.Getenv("BENCH_KEY_01962");
+value11308 := compute(value, 56)
+value1318 := compute(value, 57)
+value73350 := compute(value, 18)
+value99290 := compute(value, 59)
+value42340 := compute(value, 48)
+value15138 := compute(value, 6)
+value27974 := compute(value, 38)
+value41077 := compute(value, 46)
+// note 68706: keep this in sync with the handler
+value4049 := compute(value, 72)
+value53161 := compute(value, 5)
+const v = os.Getenv("BENCH_KEY_00908");
+// note 56060: keep this in sync with the handler
+value35214 := compute(value, 3)
+value53363 := compute(value, 13)
+value97451 := compute(value, 63)
+value42812 := compute(value, 35)
+// note 88306: keep this in sync with the handler
+value1921 := compute(value, 78)
+value45717 := compute(value, 30)
+value20620 := compute(value, 56)
+value17477 := compute(value, 17)
+// note 26290: keep this in sync with the handler
+value63904 := compute(value, 78)
+value88911 := compute(value, 59)
+value95542 := compute(value, 94)
@@ -0,0 +1,231 @@
+value22776 := compute(value, 78)
+value48846 := compute(value, 55)
+value61140 := compute(value, 30)
+value52039 := compute(value, 47)
+// note 33638: keep this in sync with the handler
+value54085 := compute(value, 56)
+const v = os.LookupEnv("BENCH_KEY_00634");
+value78724 := compute(value, 57)
+value15066 := compute(value, 31)
+value65334 := compute(value, 53)
+value51497 := compute(value, 87)
+value82260 := compute(value, 4)
+value67287 := compute(value, 66)
+value95341 := compute(value, 87)
+// note 25223: keep this in sync with the handler
+value65947 := compute(value, 84)
+value76784 := compute(value, 57)
+// note 68420: keep this in sync with the handler
+value5386 := compute(value, 51)
+value54684 := compute(value, 73)
+value65534 := compute(value, 59)
+value62373 := compute(value, 2)
+value61609 := compute(value, 14)
+value58905 := compute(value, 26)
+value67965 := compute(value, 65)
+value36026 := compute(value, 39)
+value34399 := compute(value, 61)
+value21381 := compute(value, 41)
+// note 21977: keep this in sync with the handler
+const v = os.Getenv("BENCH_KEY_01807");
+value95429 := compute(value, 78)
+value38037 := compute(value, 13)
+value75575 := compute(value, 12)
+value60294 := compute(value, 57)
+value85937 := compute(value, 92)
+value94433 := compute(value, 52)
+value21393 := compute(value, 53)
+value40268 := compute(value, 13)
+value79028 := compute(value, 70)
+value23590 := compute(value, 19)
+value17291 := compute(value, 25)
+value64889 := compute(value, 93)
+value42866 := compute(value, 89)
+const v = os.LookupEnv("BENCH_KEY_00448");
+value83768 := compute(value, 57)
+value33202 := compute(value, 28)
+value7834 := compute(value, 74)
+value59811 := compute(value, 59)
+value76563 := compute(value, 30)
+value10106 := compute(value, 18)
+value98271 := compute(value, 10)
+value85775 := compute(value, 27)
+// note 84989: keep this in sync with the handler
+value41527 := compute(value, 11)
+value43672 := compute(value, 22)
+value62629 := compute(value, 64)
+value74162 := compute(value, 54)
+// note 80780: keep this in sync with the handler
+value49991 := compute(value, 36)
+const v = os.Getenv("BENCH_KEY_00309");
+value95006 := compute(value, 43)
+value63777 := compute(value, 48)
+value30007 := compute(value, 34)
+value12484 := compute(value, 68)
+value6031 := compute(value, 17)
+value76509 := compute(value, 73)
+value29153 := compute(value, 53)
+value66209 := compute(value, 55)
+// note 96442: keep this in sync with the handler
+value32096 := compute(value, 86)
+// note 52363: keep this in sync with the handler
+const v = os.Getenv("BENCH_KEY_01183");
+value53202 := compute(value, 46)
+value27776 := compute(value, 34)
+// note 26377: keep this in sync with the handler
+value73176 := compute(value, 38)
+value46467 := compute(value, 4)
+// note 7591: keep this in sync with the handler
+value41001 := compute(value, 67)
+value90256 := compute(value, 46)
+value27855 := compute(value, 16)
+value1628 := compute(value, 76)
+// note 6775: keep this in sync with the handler
+value95776 := compute(value, 37)
+value4198 := compute(value, 27)
+value36769 := compute(value, 6)
+value46342 := compute(value, 73)
+value84016 := compute(value, 14)
+value70189 := compute(value, 58)
+value48370 := compute(value, 64)
+value95246 := compute(value, 89)
+value3622 := compute(value, 33)
+value24110 := compute(value, 54)
+// note 89794: keep this in sync with the handler
+const v = os.LookupEnv("BENCH_KEY_01576");
+value43750 := compute(value, 3)
+value87978 := compute(value, 96)
+value53627 := compute(value, 83)
+value14984 := compute(value, 46)
+// note 60188: keep this in sync with the handler
+value84902 := compute(value, 27)
+value77329 := compute(value, 20)
+value57495 := compute(value, 71)
+// note 48447: keep this in sync with the handler
+value32566 := compute(value, 71)
+value85157 := compute(value, 88)
+value97362 := compute(value, 71)
+value38026 := compute(value, 2)
+value60945 := compute(value, 29)
+value58092 := compute(value, 86)
+value63185 := compute(value, 38)
+// note 83766: keep this in sync with the handler
+// note 8170: keep this in sync with the handler
+value13756 := compute(value, 79)
+value85644 := compute(value, 90)
+value92580 := compute(value, 42)
+const v = os.Getenv("BENCH_KEY_00252");
+value91409 := compute(value, 35)
+// note 85483: keep this in sync with the handler
+value30876 := compute(value, 30)
+value75482 := compute(value, 16)
+value46551 := compute(value, 88)
+value64770 := compute(value, 71)
+// note 62183: keep this in sync with the handler
+value96882 := compute(value, 76)
+value9788 := compute(value, 88)
+value85759 := compute(value, 11)
+value41737 := compute(value, 27)
+value93202 := compute(value, 82)
+const v = os.Getenv("BENCH_KEY_00180");
+value91846 := compute(value, 84)
+value79959 := compute(value, 31)
+// note 21724: keep this in sync with the handler
+// note 31260: keep this in sync with the handler
+// note 95260: keep this in sync with the handler
+value11260 := compute(value, 8)
+value36549 := compute(value, 77)
+value37993 := compute(value, 66)
+// note 26603: keep this in sync with the handler
+value28755 := compute(value, 43)
+value35273 := compute(value, 62)
+value38040 := compute(value, 16)
+value84123 := compute(value, 24)
+value34903 := compute(value, 80)
+const v = os.LookupEnv("BENCH_KEY_01638");
+value46721 := compute(value, 64)
+value62229 := compute(value, 52)
+value36063 := compute(value, 76)
+value87746 := compute(value, 58)
+value83560 := compute(value, 43)
+value81359 := compute(value, 73)
+value59556 := compute(value, 95)
+value93061 := compute(value, 38)
+value23784 := compute(value, 19)
+const v = os.Getenv("BENCH_KEY_01413");
+value28281 := compute(value, 54)
+value87594 := compute(value, 3)
+value74131 := compute(value, 23)
+value69588 := compute(value, 39)
+value74771 := compute(value, 81)
+value78739 := compute(value, 72)
+value55060 := compute(value, 61)
+value33235 := compute(value, 61)
+value15319 := compute(value, 90)
+value54903 := compute(value, 1)
+value24418 := compute(value, 71)
+value97951 := compute(value, 78)
+value35118 := compute(value, 4)
+value54346 := compute(value, 26)
+value23597 := compute(value, 26)
+const v = os.LookupEnv("BENCH_KEY_01773");
+value52322 := compute(value, 39)
+value74276 := compute(value, 71)
+value15940 := compute(value, 32)
+// note 16801: keep this in sync with the handler
+value34224 := compute(value, 80)
+value67434 := compute(value, 19)
+value62842 := compute(value, 83)
+value29194 := compute(value, 94)
+// note 68926: keep this in sync with the handler
+value50661 := compute(value, 27)
+value25763 := compute(value, 58)
+value62769 := compute(value, 10)
+value64997 := compute(value, 7)
+value16590 := compute(value, 3)
+value46540 := compute(value, 77)
+value97548 := compute(value, 63)
+value90622 := compute(value, 24)
+value89216 := compute(value, 73)
+value95778 := compute(value, 39)
+value79278 := compute(value, 29)
+value31271 := compute(value, 37)
+value66375 := compute(value, 27)
+const v = os.LookupEnv("BENCH_KEY_00416");
+value6234 := compute(value, 26)
+// note 59441: keep this in sync with the handler
+value350 := compute(value, 59)
+value75890 := compute(value, 36)
+value91212 := compute(value, 32)
+value43676 := compute(value, 26)
+value29744 := compute(value, 62)
+value37326 := compute(value, 78)
+value10223 := compute(value, 38)
+value5079 := compute(value, 35)
+value13590 := compute(value, 10)
+value77329 := compute(value, 20)
+value45256 := compute(value, 54)
+value4324 := compute(value, 56)
+// note 26003: keep this in sync with the handler
+// note 78687: keep this in sync with the handler
+value56684 := compute(value, 36)
+const v = os.Getenv("BENCH_KEY_01234");
+value36825 := compute(value, 62)
+value74919 := compute(value, 35)
+value20011 := compute(value, 29)
+// note 17359: keep this in sync with the handler
+value85526 := compute(value, 69)
+value31640 := compute(value, 18)
+value34662 := compute(value, 33)
+// note 15133: keep this in sync with the handler
+value66085 := compute(value, 28)
+// note 68645: keep this in sync with the handler
+value80028 := compute(value, 3)
+value42517 := compute(value, 31)
+value92660 := compute(value, 25)
+value74079 := compute(value, 68)
+value27872 := compute(value, 33)
+value98566 := compute(value, 14)
+value35051 := compute(value, 34)
+const v = os.LookupEnv("BENCH_KEY_00329");
+value49357 := compute(value, 81)
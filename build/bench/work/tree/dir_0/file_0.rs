@@ -0,0 +1,211 @@
+let value20891 = compute(value, 36);
+let value68983 = compute(value, 16);
+let value32587 = compute(value, 92);
+let value420 = compute(value, 32);
+let value15827 = compute(value, 16);
+// note 55420: keep this in sync with the handler
+// note 22235: keep this in sync with the handler
+// note 66485: keep this in sync with the handler
+let value79556 = compute(value, 16);
+let value24185 = compute(value, 32);
+const v = env::var_os("BENCH_KEY_01408");
+let value42483 = compute(value, 94);
+let value62313 = compute(value, 39);
+let value5164 = compute(value, 23);
+let value4862 = compute(value, 12);
+let value88267 = compute(value, 94);
+let value35458 = compute(value, 53);
+let value22632 = compute(value, 31);
+let value94840 = compute(value, 71);
+const v = env::var("BENCH_KEY_00527");
+let value69799 = compute(value, 56);
+let value20083 = compute(value, 4);
+let value42710 = compute(value, 30);
+let value37142 = compute(value, 88);
+let value84075 = compute(value, 73);
+let value18854 = compute(value, 36);
+// note 42221: keep this in sync with the handler
+let value29081 = compute(value, 78);
+let value53374 = compute(value, 24);
+let value38374 = compute(value, 59);
+// note 71548: keep this in sync with the handler
+let value18090 = compute(value, 48);
+let value77388 = compute(value, 79);
+let value97845 = compute(value, 69);
+let value99977 = compute(value, 67);
+let value2044 = compute(value, 7);
+let value71206 = compute(value, 8);
+let value81226 = compute(value, 37);
+let value23989 = compute(value, 30);
+let value94834 = compute(value, 65);
+const v = env::var("BENCH_KEY_01212");
+let value34334 = compute(value, 93);
+let value13243 = compute(value, 51);
+let value64168 = compute(value, 51);
+let value99810 = compute(value, 94);
+let value47694 = compute(value, 67);
+let value55940 = compute(value, 68);
+let value41874 = compute(value, 67);
+// note 33859: keep this in sync with the handler
+let value41672 = compute(value, 59);
+let value92831 = compute(value, 2);
+// note 2751: keep this in sync with the handler
+let value79726 = compute(value, 89);
+let value78429 = compute(value, 53);
+const v = env::var_os("BENCH_KEY_00179");
+let value56519 = compute(value, 65);
+let value71758 = compute(value, 75);
+let value61099 = compute(value, 86);
+let value56527 = compute(value, 73);
+let value51924 = compute(value, 29);
+let value6754 = compute(value, 61);
+let value94997 = compute(value, 34);
+let value59341 = compute(value, 74);
+const v = env::var_os("BENCH_KEY_01607");
+let value99331 = compute(value, 3);
+let value30602 = compute(value, 47);
+let value39112 = compute(value, 21);
+let value29394 = compute(value, 3);
+// note 77080: keep this in sync with the handler
+let value18321 = compute(value, 85);
+// note 34524: keep this in sync with the handler
+// note 49639: keep this in sync with the handler
+let value21720 = compute(value, 89);
+let value47447 = compute(value, 14);
+const v = env::var("BENCH_KEY_01976");
+// note 29020: keep this in sync with the handler
+let value76332 = compute(value, 90);
+// note 5296: keep this in sync with the handler
+let value14057 = compute(value, 89);
+let value72875 = compute(value, 28);
+let value14953 = compute(value, 15);
+let value85389 = compute(value, 29);
+// note 88251: keep this in sync with the handler
+// note 87012: keep this in sync with the handler
+let value59314 = compute(value, 47);
+const v = env::var_os("BENCH_KEY_01997");
+let value63233 = compute(value, 86);
+let value69394 = compute(value, 39);
+let value59348 = compute(value, 81);
+let value70492 = compute(value, 70);
+let value43386 = compute(value, 27);
+let value3067 = compute(value, 60);
+// note 43899: keep this in sync with the handler
+let value71011 = compute(value, 7);
+// note 54833: keep this in sync with the handler
+let value82790 = compute(value, 49);
+let value26168 = compute(value, 75);
+let value55509 = compute(value, 25);
+const v = env::var("BENCH_KEY_00503");
+let value97594 = compute(value, 12);
+let value83895 = compute(value, 87);
+let value37930 = compute(value, 3);
+let value27869 = compute(value, 30);
+// note 7390: keep this in sync with the handler
+let value7022 = compute(value, 38);
+let value61853 = compute(value, 64);
+let value51711 = compute(value, 10);
+let value56933 = compute(value, 91);
+// note 87543: keep this in sync with the handler
+const v = env::var_os("BENCH_KEY_01278");
+let value10161 = compute(value, 73);
+let value21428 = compute(value, 88);
+let value8723 = compute(value, 90);
+let value40400 = compute(value, 48);
+let value9678 = compute(value, 75);
+let value37483 = compute(value, 41);
+let value7062 = compute(value, 78);
+let value46530 = compute(value, 67);
+const v = env::var("BENCH_KEY_00220");
+let value52304 = compute(value, 21);
+// note 58145: keep this in sync with the handler
+let value16681 = compute(value, 94);
+let value70932 = compute(value, 25);
+// note 32782: keep this in sync with the handler
+let value47804 = compute(value, 80);
+// note 26616: keep this in sync with the handler
+let value27010 = compute(value, 44);
+// note 32866: keep this in sync with the handler
+let value69524 = compute(value, 72);
+let value98091 = compute(value, 24);
+let value84434 = compute(value, 44);
+let value96726 = compute(value, 17);
+let value62723 = compute(value, 61);
+let value29116 = compute(value, 16);
+let value20837 = compute(value, 79);
+let value97915 = compute(value, 42);
+let value23213 = compute(value, 30);
+let value75251 = compute(value, 76);
+const v = env::var("BENCH_KEY_01457");
+let value78185 = compute(value, 3);
+let value67475 = compute(value, 60);
+let value62906 = compute(value, 50);
+let value12762 = compute(value, 55);
+// note 6599: keep this in sync with the handler
+let value53814 = compute(value, 76);
+let value77786 = compute(value, 89);
+// note 36407: keep this in sync with the handler
+let value80505 = compute(value, 92);
+let value69607 = compute(value, 58);
+let value20385 = compute(value, 15);
+// note 45801: keep this in sync with the handler
+let value29871 = compute(value, 92);
+let value26799 = compute(value, 27);
+let value31942 = compute(value, 29);
+let value29294 = compute(value, 0);
+// note 43935: keep this in sync with the handler
+const v = env::var("BENCH_KEY_01748");
+let value7203 = compute(value, 25);
+let value17846 = compute(value, 95);
+let value97972 = compute(value, 2);
+let value50088 = compute(value, 36);
+let value66159 = compute(value, 5);
+let value75117 = compute(value, 39);
+let value26053 = compute(value, 57);
+let value19096 = compute(value, 84);
+let value6287 = compute(value, 79);
+let value78933 = compute(value, 72);
+let value97600 = compute(value, 18);
+let value49968 = compute(value, 13);
+const v = env::var_os("BENCH_KEY_00194");
+let value49378 = compute(value, 5);
+let value88391 = compute(value, 24);
+let value19573 = compute(value, 76);
+let value94548 = compute(value, 70);
+let value63768 = compute(value, 39);
+let value63718 = compute(value, 86);
+let value5828 = compute(value, 8);
+// note 61488: keep this in sync with the handler
+const v = env::var_os("BENCH_KEY_01529");
+let value88024 = compute(value, 45);
+let value14747 = compute(value, 3);
+let value41162 = compute(value, 34);
+let value27550 = compute(value, 2);
+let value79914 = compute(value, 83);
+let value53441 = compute(value, 91);
+let value43106 = compute(value, 38);
+let value19700 = compute(value, 9);
+let value28354 = compute(value, 30);
+let value48837 = compute(value, 46);
+let value24923 = compute(value, 91);
+let value12660 = compute(value, 50);
+let value16091 = compute(value, 86);
+let value47786 = compute(value, 62);
+let value69493 = compute(value, 41);
+let value68999 = compute(value, 32);
+let value29533 = compute(value, 45);
+let value93872 = compute(value, 73);
+let value73082 = compute(value, 41);
+// note 81515: keep this in sync with the handler
+const v = env::var_os("BENCH_KEY_01121");
+let value19001 = compute(value, 86);
+let value65544 = compute(value, 69);
+// note 97298: keep this in sync with the handler
+let value82003 = compute(value, 38);
+let value99728 = compute(value, 12);
+// note 21705: keep this in sync with the handler
+let value25074 = compute(value, 48);
+const v = env::var("BENCH_KEY_00747");
+let value6011 = compute(value, 94);
+let value82981 = compute(value, 46);
+let value49725 = compute(value, 61);
@@ -0,0 +1,204 @@
+const value74007 = compute(value, 93);
+const value77343 = compute(value, 34);
+const value82884 = compute(value, 46);
+const v = import.meta.env.BENCH_KEY_01388;
+const value54544 = compute(value, 30);
+const value77313 = compute(value, 4);
+const value52229 = compute(value, 43);
+const value42853 = compute(value, 76);
+const value99671 = compute(value, 52);
+const value89261 = compute(value, 21);
+const value76473 = compute(value, 37);
+const value13681 = compute(value, 4);
+const value32829 = compute(value, 43);
+const value12173 = compute(value, 48);
+const value16954 = compute(value, 76);
+const value42335 = compute(value, 43);
+const value95298 = compute(value, 44);
+const value47942 = compute(value, 24);
+const value60402 = compute(value, 68);
+const v = process.env["BENCH_KEY_00160"];
+// note 92818: keep this in sync with the handler
+// note 22149: keep this in sync with the handler
+const value52677 = compute(value, 6);
+const value26332 = compute(value, 45);
+const value25001 = compute(value, 72);
+const value18307 = compute(value, 71);
+const value32390 = compute(value, 89);
+const value78162 = compute(value, 77);
+// note 19240: keep this in sync with the handler
+// note 37501: keep this in sync with the handler
+const value95155 = compute(value, 95);
+const value80752 = compute(value, 48);
+const value69662 = compute(value, 16);
+const value44400 = compute(value, 71);
+const value25758 = compute(value, 53);
+const value25165 = compute(value, 42);
+const value44349 = compute(value, 20);
+const value45991 = compute(value, 13);
+const v = process.env.BENCH_KEY_01601;
+const value29351 = compute(value, 57);
+// note 74460: keep this in sync with the handler
+const value45709 = compute(value, 22);
+// note 97884: keep this in sync with the handler
+// note 40917: keep this in sync with the handler
+const value85368 = compute(value, 8);
+const value94488 = compute(value, 10);
+const value67283 = compute(value, 62);
+// note 72157: keep this in sync with the handler
+const value1585 = compute(value, 33);
+// note 20437: keep this in sync with the handler
+const value21112 = compute(value, 63);
+const value97113 = compute(value, 16);
+const value72680 = compute(value, 27);
+const value15883 = compute(value, 72);
+const v = process.env["BENCH_KEY_01715"];
+const value64032 = compute(value, 12);
+// note 41933: keep this in sync with the handler
+const value65328 = compute(value, 47);
+const value58049 = compute(value, 43);
+const value87664 = compute(value, 73);
+const value82089 = compute(value, 27);
+const value43818 = compute(value, 71);
+const value11769 = compute(value, 32);
+const value77662 = compute(value, 62);
+const value36174 = compute(value, 90);
+const value96195 = compute(value, 68);
+// note 18415: keep this in sync with the handler
+const value52555 = compute(value, 78);
+const value88203 = compute(value, 30);
+const value67912 = compute(value, 12);
+// note 36206: keep this in sync with the handler
+const value17687 = compute(value, 33);
+const value30878 = compute(value, 32);
+const v = process.env["BENCH_KEY_01155"];
+const value52218 = compute(value, 32);
+const value10916 = compute(value, 52);
+const value93950 = compute(value, 54);
+const value53566 = compute(value, 22);
+const value40766 = compute(value, 26);
+const value45212 = compute(value, 10);
+const value5428 = compute(value, 93);
+const value23739 = compute(value, 71);
+const value53487 = compute(value, 40);
+const v = process.env["BENCH_KEY_01770"];
+const value50352 = compute(value, 9);
+const value19414 = compute(value, 14);
+const value88870 = compute(value, 18);
+const value81228 = compute(value, 39);
+const value39755 = compute(value, 82);
+const value97804 = compute(value, 28);
+const value16886 = compute(value, 8);
+// note 95702: keep this in sync with the handler
+const value8468 = compute(value, 29);
+const value28766 = compute(value, 54);
+const value84074 = compute(value, 72);
+// note 77881: keep this in sync with the handler
+const v = process.env.BENCH_KEY_01469;
+const value11646 = compute(value, 6);
+const value11426 = compute(value, 77);
+const value23202 = compute(value, 19);
+const value16986 = compute(value, 11);
+const value21443 = compute(value, 6);
+const value47151 = compute(value, 9);
+const value48649 = compute(value, 52);
+const v = process.env["BENCH_KEY_00721"];
+const value29653 = compute(value, 68);
+const value58249 = compute(value, 49);
+const value24931 = compute(value, 2);
+const value20065 = compute(value, 83);
+const value42357 = compute(value, 65);
+const value18873 = compute(value, 55);
+const value18554 = compute(value, 27);
+const value62715 = compute(value, 53);
+const value78396 = compute(value, 20);
+const value99846 = compute(value, 33);
+const value7932 = compute(value, 75);
+const value12225 = compute(value, 3);
+const value88084 = compute(value, 8);
+const value73608 = compute(value, 82);
+// note 84239: keep this in sync with the handler
+// note 21346: keep this in sync with the handler
+const value68491 = compute(value, 9);
+const v = process.env.BENCH_KEY_00034;
+const value25310 = compute(value, 90);
+const value71896 = compute(value, 19);
+const value84927 = compute(value, 52);
+const value95903 = compute(value, 67);
+const value50950 = compute(value, 25);
+const value71975 = compute(value, 1);
+const value78094 = compute(value, 9);
+const value43628 = compute(value, 75);
+// note 47333: keep this in sync with the handler
+const value73245 = compute(value, 10);
+const value47260 = compute(value, 21);
+const v = import.meta.env.BENCH_KEY_01232;
+const value6336 = compute(value, 31);
+const value86255 = compute(value, 22);
+const value54947 = compute(value, 45);
+const value34699 = compute(value, 70);
+const value76802 = compute(value, 75);
+const value50708 = compute(value, 74);
+const value29557 = compute(value, 69);
+const value91387 = compute(value, 13);
+const value39259 = compute(value, 71);
+const value26615 = compute(value, 37);
+const value87228 = compute(value, 25);
+const value37961 = compute(value, 34);
+// note 59841: keep this in sync with the handler
+const v = process.env.BENCH_KEY_00908;
+const value14632 = compute(value, 82);
+const value25897 = compute(value, 95);
+const value24146 = compute(value, 90);
+const value19498 = compute(value, 1);
+const value94485 = compute(value, 7);
+const value83476 = compute(value, 56);
+const value90775 = compute(value, 80);
+const value4 = compute(value, 4);
+const value527 = compute(value, 42);
+const value22731 = compute(value, 33);
+// note 97532: keep this in sync with the handler
+const value20947 = compute(value, 92);
+const value86521 = compute(value, 94);
+const value32579 = compute(value, 84);
+const v = process.env["BENCH_KEY_00899"];
+const value78362 = compute(value, 83);
+const value62746 = compute(value, 84);
+const value64058 = compute(value, 38);
+const value72457 = compute(value, 95);
+const value92077 = compute(value, 24);
+const value27816 = compute(value, 74);
+// note 42343: keep this in sync with the handler
+const value84328 = compute(value, 35);
+const value87828 = compute(value, 43);
+const value18506 = compute(value, 76);
+const value18800 = compute(value, 79);
+const value40175 = compute(value, 17);
+const value15040 = compute(value, 5);
+const value23403 = compute(value, 26);
+const v = import.meta.env.BENCH_KEY_01377;
+const value3079 = compute(value, 72);
+const value83390 = compute(value, 67);
+const value78818 = compute(value, 54);
+const value11561 = compute(value, 18);
+const value77949 = compute(value, 58);
+// note 29096: keep this in sync with the handler
+const value75652 = compute(value, 89);
+const value17300 = compute(value, 34);
+// note 9035: keep this in sync with the handler
+const value46162 = compute(value, 87);
+const value9809 = compute(value, 12);
+const v = process.env["BENCH_KEY_01079"];
+const value65406 = compute(value, 28);
+const value13900 = compute(value, 29);
+const value5534 = compute(value, 5);
+// note 51679: keep this in sync with the handler
+const value52255 = compute(value, 69);
+const value13229 = compute(value, 37);
+const value80791 = compute(value, 87);
+const value436 = compute(value, 48);
+const value12527 = compute(value, 14);
+const value77907 = compute(value, 16);
+const value88019 = compute(value, 40);
+const v = import.meta.env.BENCH_KEY_01380;
+const value34816 = compute(value, 90);
@@ -0,0 +1,238 @@
+# note 64334: keep this in sync with the handler
+value47148 = compute(value, 6)
+value92450 = compute(value, 9)
+value88433 = compute(value, 66)
+value56241 = compute(value, 78)
+value94728 = compute(value, 56)
+value22701 = compute(value, 3)
+value70222 = compute(value, 91)
+value76271 = compute(value, 29)
+# note 2963: keep this in sync with the handler
+value85226 = compute(value, 60)
+value12440 = compute(value, 24)
+const v = os.getenv("BENCH_KEY_00576");
+# note 98728: keep this in sync with the handler
+value83698 = compute(value, 84)
+value95942 = compute(value, 9)
+value94514 = compute(value, 36)
+value94344 = compute(value, 60)
+value95904 = compute(value, 68)
+value35799 = compute(value, 6)
+value7025 = compute(value, 41)
+value1683 = compute(value, 34)
+value20320 = compute(value, 47)
+value93110 = compute(value, 87)
+value37697 = compute(value, 61)
+value56725 = compute(value, 77)
+value16677 = compute(value, 90)
+value14540 = compute(value, 87)
+value12436 = compute(value, 20)
+value87071 = compute(value, 62)
+value23608 = compute(value, 37)
+value10180 = compute(value, 92)
+value36154 = compute(value, 70)
+value7975 = compute(value, 21)
+value929 = compute(value, 56)
+value36241 = compute(value, 60)
+const v = os.environ.get('BENCH_KEY_01919');
+# note 53197: keep this in sync with the handler
+value76589 = compute(value, 56)
+value55210 = compute(value, 17)
+value87797 = compute(value, 12)
+value87606 = compute(value, 15)
+value50635 = compute(value, 1)
+value4402 = compute(value, 37)
+value93557 = compute(value, 49)
+# note 78219: keep this in sync with the handler
+# note 72245: keep this in sync with the handler
+const v = os.getenv("BENCH_KEY_00941");
+value68082 = compute(value, 85)
+value8216 = compute(value, 68)
+# note 881: keep this in sync with the handler
+value66368 = compute(value, 20)
+value66131 = compute(value, 74)
+value10652 = compute(value, 79)
+value40804 = compute(value, 64)
+value78882 = compute(value, 21)
+value40900 = compute(value, 63)
+value28105 = compute(value, 72)
+const v = os.environ["BENCH_KEY_01701"];
+# note 38426: keep this in sync with the handler
+value77947 = compute(value, 56)
+value10743 = compute(value, 73)
+value92311 = compute(value, 64)
+value9695 = compute(value, 92)
+value91515 = compute(value, 44)
+value10575 = compute(value, 2)
+value75753 = compute(value, 93)
+value28909 = compute(value, 3)
+value21838 = compute(value, 13)
+value68478 = compute(value, 93)
+const v = os.getenv("BENCH_KEY_01845");
+value53347 = compute(value, 94)
+value33606 = compute(value, 44)
+value8401 = compute(value, 59)
+# note 30444: keep this in sync with the handler
+# note 42779: keep this in sync with the handler
+# note 8100: keep this in sync with the handler
+# note 63398: keep this in sync with the handler
+value44404 = compute(value, 75)
+value7595 = compute(value, 29)
+value18649 = compute(value, 25)
+value22715 = compute(value, 17)
+value63658 = compute(value, 26)
+value61975 = compute(value, 89)
+value20663 = compute(value, 2)
+value14078 = compute(value, 13)
+# note 49370: keep this in sync with the handler
+value68516 = compute(value, 34)
+const v = os.environ["BENCH_KEY_01765"];
+value73225 = compute(value, 87)
+value5222 = compute(value, 81)
+value20744 = compute(value, 83)
+value63181 = compute(value, 34)
+value24913 = compute(value, 81)
+value57257 = compute(value, 27)
+# note 70055: keep this in sync with the handler
+value35597 = compute(value, 95)
+value31676 = compute(value, 54)
+value96919 = compute(value, 16)
+value76338 = compute(value, 96)
+value28804 = compute(value, 92)
+value86222 = compute(value, 86)
+const v = os.environ.get('BENCH_KEY_00465');
+# note 1827: keep this in sync with the handler
+# note 25881: keep this in sync with the handler
+value21791 = compute(value, 63)
+value41023 = compute(value, 89)
+# note 25163: keep this in sync with the handler
+value61041 = compute(value, 28)
+value58750 = compute(value, 65)
+value20490 = compute(value, 23)
+value28058 = compute(value, 25)
+value9063 = compute(value, 42)
+# note 84437: keep this in sync with the handler
+value40958 = compute(value, 24)
+const v = os.getenv("BENCH_KEY_00120");
+value53492 = compute(value, 45)
+value86876 = compute(value, 61)
+value55163 = compute(value, 67)
+value36179 = compute(value, 95)
+value30286 = compute(value, 22)
+value62591 = compute(value, 26)
+value53554 = compute(value, 10)
+# note 46659: keep this in sync with the handler
+value56488 = compute(value, 34)
+value53347 = compute(value, 94)
+value58287 = compute(value, 87)
+# note 30693: keep this in sync with the handler
+value1692 = compute(value, 43)
+value31047 = compute(value, 7)
+value94422 = compute(value, 41)
+value21545 = compute(value, 11)
+value10250 = compute(value, 65)
+value23050 = compute(value, 61)
+value14473 = compute(value, 20)
+const v = os.getenv("BENCH_KEY_01726");
+value16472 = compute(value, 79)
+value72706 = compute(value, 53)
+value83559 = compute(value, 42)
+value96563 = compute(value, 48)
+value30978 = compute(value, 35)
+# note 99350: keep this in sync with the handler
+value63918 = compute(value, 92)
+value21296 = compute(value, 53)
+const v = os.environ["BENCH_KEY_01554"];
+value82719 = compute(value, 75)
+value48714 = compute(value, 20)
+value29836 = compute(value, 57)
+value60468 = compute(value, 37)
+value47250 = compute(value, 11)
+value83045 = compute(value, 13)
+# note 83589: keep this in sync with the handler
+value88631 = compute(value, 70)
+value65403 = compute(value, 25)
+value69440 = compute(value, 85)
+value26178 = compute(value, 85)
+value63473 = compute(value, 35)
+value78562 = compute(value, 89)
+value15559 = compute(value, 39)
+value61839 = compute(value, 50)
+value3152 = compute(value, 48)
+value10881 = compute(value, 17)
+# note 92880: keep this in sync with the handler
+value66536 = compute(value, 91)
+value35443 = compute(value, 38)
+value18443 = compute(value, 13)
+value62745 = compute(value, 83)
+const v = os.getenv("BENCH_KEY_01570");
+value1514 = compute(value, 59)
+value2115 = compute(value, 78)
+value26435 = compute(value, 51)
+value65928 = compute(value, 65)
+value75748 = compute(value, 88)
+# note 65002: keep this in sync with the handler
+value41668 = compute(value, 55)
+value65169 = compute(value, 82)
+value35718 = compute(value, 22)
+const v = os.environ.get('BENCH_KEY_00201');
+value78817 = compute(value, 53)
+value45330 = compute(value, 31)
+value67105 = compute(value, 78)
+value98794 = compute(value, 48)
+value47885 = compute(value, 64)
+value94071 = compute(value, 78)
+value40148 = compute(value, 87)
+value75085 = compute(value, 7)
+value70093 = compute(value, 59)
+value94806 = compute(value, 37)
+value76255 = compute(value, 13)
+const v = os.getenv("BENCH_KEY_01542");
+value55562 = compute(value, 78)
+value84093 = compute(value, 91)
+value13480 = compute(value, 94)
+value61355 = compute(value, 51)
+value50889 = compute(value, 61)
+value15625 = compute(value, 8)
+value80240 = compute(value, 21)
+# note 98791: keep this in sync with the handler
+value18792 = compute(value, 71)
+value80017 = compute(value, 89)
+value81548 = compute(value, 68)
+value18670 = compute(value, 46)
+value84146 = compute(value, 47)
+value70143 = compute(value, 12)
+# note 48675: keep this in sync with the handler
+# note 16252: keep this in sync with the handler
+value61690 = compute(value, 95)
+value89143 = compute(value, 0)
+value67373 = compute(value, 55)
+value97693 = compute(value, 14)
+# note 4328: keep this in sync with the handler
+const v = os.environ.get('BENCH_KEY_00958');
+value31131 = compute(value, 91)
+value62125 = compute(value, 45)
+value36743 = compute(value, 77)
+value70935 = compute(value, 28)
+value4327 = compute(value, 59)
+value43634 = compute(value, 81)
+value98084 = compute(value, 17)
+value4230 = compute(value, 59)
+value87113 = compute(value, 7)
+value86146 = compute(value, 10)
+value91917 = compute(value, 58)
+value75413 = compute(value, 44)
+value88593 = compute(value, 32)
+value97820 = compute(value, 44)
+value89405 = compute(value, 68)
+value83770 = compute(value, 59)
+value15635 = compute(value, 18)
+# note 68869: keep this in sync with the handler
+value80697 = compute(value, 90)
+value50247 = compute(value, 1)
+value33075 = compute(value, 95)
+const v = os.getenv("BENCH_KEY_01369");
+value90765 = compute(value, 70)
+value8697 = compute(value, 64)
+value27106 = compute(value, 43)
+value74274 = compute(value, 69)
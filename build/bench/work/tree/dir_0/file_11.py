@@ -0,0 +1,237 @@
+value44347 = compute(value, 18)
+value78483 = compute(value, 10)
+value71486 = compute(value, 94)
+value53376 = compute(value, 26)
+value32399 = compute(value, 1)
+value15346 = compute(value, 20)
+const v = os.environ.get('BENCH_KEY_00115');
+value37779 = compute(value, 46)
+value51765 = compute(value, 64)
+# note 34386: keep this in sync with the handler
+value79741 = compute(value, 7)
+value81958 = compute(value, 90)
+value53907 = compute(value, 72)
+value44304 = compute(value, 72)
+value72818 = compute(value, 68)
+value43560 = compute(value, 7)
+value18584 = compute(value, 57)
+value32749 = compute(value, 60)
+value79219 = compute(value, 67)
+value91228 = compute(value, 48)
+value79708 = compute(value, 71)
+value6309 = compute(value, 4)
+value98430 = compute(value, 72)
+value29906 = compute(value, 30)
+value38658 = compute(value, 52)
+# note 11849: keep this in sync with the handler
+const v = os.environ["BENCH_KEY_01922"];
+value35850 = compute(value, 57)
+value26429 = compute(value, 45)
+value51925 = compute(value, 30)
+# note 30874: keep this in sync with the handler
+value29085 = compute(value, 82)
+value7944 = compute(value, 87)
+value31549 = compute(value, 24)
+value27714 = compute(value, 69)
+value2525 = compute(value, 3)
+# note 5460: keep this in sync with the handler
+value19877 = compute(value, 89)
+value4890 = compute(value, 40)
+value391 = compute(value, 3)
+# note 73788: keep this in sync with the handler
+value52896 = compute(value, 31)
+value29644 = compute(value, 59)
+const v = os.environ["BENCH_KEY_00935"];
+# note 16431: keep this in sync with the handler
+value95791 = compute(value, 52)
+# note 19538: keep this in sync with the handler
+value70759 = compute(value, 46)
+value65960 = compute(value, 0)
+value54063 = compute(value, 34)
+# note 1597: keep this in sync with the handler
+value42483 = compute(value, 94)
+value63203 = compute(value, 56)
+value43677 = compute(value, 27)
+const v = os.environ.get('BENCH_KEY_01291');
+value40269 = compute(value, 14)
+value71707 = compute(value, 24)
+# note 98283: keep this in sync with the handler
+value94325 = compute(value, 41)
+value42726 = compute(value, 46)
+value7283 = compute(value, 8)
+value83896 = compute(value, 88)
+value51988 = compute(value, 93)
+value11315 = compute(value, 63)
+value16253 = compute(value, 54)
+# note 11515: keep this in sync with the handler
+# note 9312: keep this in sync with the handler
+value99798 = compute(value, 82)
+value32254 = compute(value, 50)
+# note 42174: keep this in sync with the handler
+const v = os.environ["BENCH_KEY_01669"];
+value96642 = compute(value, 30)
+value33160 = compute(value, 83)
+value85491 = compute(value, 34)
+value49721 = compute(value, 57)
+value92231 = compute(value, 81)
+value69119 = compute(value, 55)
+# note 25230: keep this in sync with the handler
+value63447 = compute(value, 9)
+value38994 = compute(value, 0)
+value20932 = compute(value, 77)
+value25534 = compute(value, 23)
+value10031 = compute(value, 40)
+value16348 = compute(value, 52)
+const v = os.getenv("BENCH_KEY_00784");
+value56926 = compute(value, 84)
+value73547 = compute(value, 21)
+value46228 = compute(value, 56)
+value31261 = compute(value, 27)
+# note 7750: keep this in sync with the handler
+# note 82814: keep this in sync with the handler
+value58304 = compute(value, 7)
+value57370 = compute(value, 43)
+value92257 = compute(value, 10)
+value57482 = compute(value, 58)
+value35881 = compute(value, 88)
+# note 33647: keep this in sync with the handler
+value20986 = compute(value, 34)
+const v = os.getenv("BENCH_KEY_00580");
+# note 6775: keep this in sync with the handler
+value4077 = compute(value, 3)
+value29671 = compute(value, 86)
+value51683 = compute(value, 79)
+# note 90788: keep this in sync with the handler
+value94416 = compute(value, 35)
+value25753 = compute(value, 48)
+value44671 = compute(value, 51)
+value40440 = compute(value, 88)
+value7792 = compute(value, 32)
+value8264 = compute(value, 19)
+value3846 = compute(value, 63)
+value98092 = compute(value, 25)
+# note 95967: keep this in sync with the handler
+value52241 = compute(value, 55)
+value93714 = compute(value, 12)
+value20332 = compute(value, 59)
+value1858 = compute(value, 15)
+value58354 = compute(value, 57)
+value56857 = compute(value, 15)
+# note 79238: keep this in sync with the handler
+const v = os.environ.get('BENCH_KEY_01289');
+value63263 = compute(value, 19)
+value51538 = compute(value, 31)
+value35077 = compute(value, 60)
+# note 51454: keep this in sync with the handler
+value55350 = compute(value, 60)
+value46540 = compute(value, 77)
+value68691 = compute(value, 15)
+value71509 = compute(value, 20)
+value94040 = compute(value, 47)
+value66305 = compute(value, 54)
+value57840 = compute(value, 28)
+value57612 = compute(value, 91)
+value77569 = compute(value, 66)
+value13138 = compute(value, 43)
+value86123 = compute(value, 84)
+value47162 = compute(value, 20)
+# note 69251: keep this in sync with the handler
+value46759 = compute(value, 5)
+# note 35416: keep this in sync with the handler
+value2776 = compute(value, 60)
+value98600 = compute(value, 48)
+value4370 = compute(value, 5)
+const v = os.environ.get('BENCH_KEY_00283');
+value67839 = compute(value, 36)
+value63162 = compute(value, 15)
+value22344 = compute(value, 34)
+# note 51177: keep this in sync with the handler
+value35632 = compute(value, 33)
+value88675 = compute(value, 17)
+value47560 = compute(value, 30)
+value98358 = compute(value, 0)
+value49066 = compute(value, 81)
+value60378 = compute(value, 44)
+value72087 = compute(value, 16)
+value77666 = compute(value, 66)
+value75209 = compute(value, 34)
+value26008 = compute(value, 12)
+value9816 = compute(value, 19)
+# note 81492: keep this in sync with the handler
+value39967 = compute(value, 3)
+value88062 = compute(value, 83)
+value2068 = compute(value, 31)
+const v = os.environ.get('BENCH_KEY_01726');
+value3818 = compute(value, 35)
+value34355 = compute(value, 17)
+value85475 = compute(value, 18)
+value23931 = compute(value, 69)
+value19974 = compute(value, 89)
+# note 66875: keep this in sync with the handler
+value46057 = compute(value, 79)
+value5833 = compute(value, 13)
+value18856 = compute(value, 38)
+value26800 = compute(value, 28)
+value11930 = compute(value, 96)
+value13361 = compute(value, 72)
+const v = os.environ["BENCH_KEY_00811"];
+value90628 = compute(value, 30)
+value11134 = compute(value, 76)
+value84824 = compute(value, 46)
+value64884 = compute(value, 88)
+value21940 = compute(value, 18)
+value33867 = compute(value, 14)
+value80990 = compute(value, 92)
+value99275 = compute(value, 44)
+value33287 = compute(value, 16)
+value38117 = compute(value, 93)
+value36005 = compute(value, 18)
+value4941 = compute(value, 91)
+# note 59917: keep this in sync with the handler
+value67629 = compute(value, 20)
+value12210 = compute(value, 85)
+value3726 = compute(value, 40)
+value81372 = compute(value, 86)
+value59371 = compute(value, 7)
+value47626 = compute(value, 96)
+value31169 = compute(value, 32)
+const v = os.getenv("BENCH_KEY_01402");
+value25935 = compute(value, 36)
+value65941 = compute(value, 78)
+value1377 = compute(value, 19)
+value69545 = compute(value, 93)
+value62333 = compute(value, 59)
+value11888 = compute(value, 54)
+value50303 = compute(value, 57)
+value26626 = compute(value, 48)
+value85325 = compute(value, 62)
+value89983 = compute(value, 64)
+# note 25338: keep this in sync with the handler
+value37638 = compute(value, 2)
+value86126 = compute(value, 87)
+value71803 = compute(value, 23)
+# note 64673: keep this in sync with the handler
+value33835 = compute(value, 79)
+const v = os.getenv("BENCH_KEY_00945");
+value43882 = compute(value, 38)
+value28095 = compute(value, 62)
+value805 = compute(value, 29)
+value6236 = compute(value, 28)
+value48948 = compute(value, 60)
+# note 75115: keep this in sync with the handler
+value90047 = compute(value, 31)
+value86957 = compute(value, 45)
+value83742 = compute(value, 31)
+value87044 = compute(value, 35)
+value85067 = compute(value, 95)
+value60810 = compute(value, 88)
+const v = os.getenv("BENCH_KEY_01948");
+value69555 = compute(value, 6)
+value22159 = compute(value, 43)
+# note 9403: keep this in sync with the handler
+value3441 = compute(value, 46)
+value7528 = compute(value, 59)
+value14536 = compute(value, 83)
+value97543 = compute(value, 58)
+# note 22940: keep this in sync with the handler
+value56798 = compute(value, 53)
@@ -0,0 +1,245 @@
+value80035 = compute(value, 10)
+value61368 = compute(value, 64)
+value18401 = compute(value, 68)
+# note 22549: keep this in sync with the handler
+value8288 = compute(value, 43)
+# note 43238: keep this in sync with the handler
+# note 66488: keep this in sync with the handler
+value49668 = compute(value, 4)
+value46324 = compute(value, 55)
+value74528 = compute(value, 32)
+value46434 = compute(value, 68)
+value46059 = compute(value, 81)
+value42384 = compute(value, 92)
+value79595 = compute(value, 55)
+const v = os.getenv("BENCH_KEY_01542");
+value49968 = compute(value, 13)
+# note 29146: keep this in sync with the handler
+value55015 = compute(value, 16)
+value81014 = compute(value, 19)
+value72991 = compute(value, 47)
+value75747 = compute(value, 87)
+value7908 = compute(value, 51)
+value7869 = compute(value, 12)
+value44572 = compute(value, 49)
+value10424 = compute(value, 45)
+value52135 = compute(value, 46)
+value36658 = compute(value, 89)
+value70220 = compute(value, 89)
+value8218 = compute(value, 70)
+value96588 = compute(value, 73)
+value29390 = compute(value, 96)
+value10870 = compute(value, 6)
+value58596 = compute(value, 8)
+value38989 = compute(value, 92)
+value74479 = compute(value, 80)
+# note 36323: keep this in sync with the handler
+value51020 = compute(value, 95)
+value31161 = compute(value, 24)
+const v = os.environ["BENCH_KEY_01184"];
+value4263 = compute(value, 92)
+value13482 = compute(value, 96)
+value47293 = compute(value, 54)
+value57563 = compute(value, 42)
+value99232 = compute(value, 1)
+value12152 = compute(value, 27)
+value20081 = compute(value, 2)
+value30121 = compute(value, 51)
+value57134 = compute(value, 1)
+value22908 = compute(value, 16)
+value79328 = compute(value, 79)
+value10420 = compute(value, 41)
+value31680 = compute(value, 58)
+value34127 = compute(value, 80)
+value63589 = compute(value, 54)
+value47334 = compute(value, 95)
+value10909 = compute(value, 45)
+value90946 = compute(value, 57)
+# note 58742: keep this in sync with the handler
+const v = os.environ["BENCH_KEY_01034"];
+value84787 = compute(value, 9)
+value41115 = compute(value, 84)
+value63211 = compute(value, 64)
+value65048 = compute(value, 58)
+value32416 = compute(value, 18)
+value23796 = compute(value, 31)
+value9723 = compute(value, 23)
+value3037 = compute(value, 30)
+value12244 = compute(value, 22)
+value73572 = compute(value, 46)
+value7214 = compute(value, 36)
+value42765 = compute(value, 85)
+value66286 = compute(value, 35)
+value71653 = compute(value, 67)
+value2465 = compute(value, 40)
+const v = os.environ["BENCH_KEY_00744"];
+value41928 = compute(value, 24)
+value82238 = compute(value, 79)
+value14982 = compute(value, 44)
+value5685 = compute(value, 59)
+value13379 = compute(value, 90)
+value70801 = compute(value, 88)
+value44105 = compute(value, 67)
+value23582 = compute(value, 11)
+value6341 = compute(value, 36)
+value35481 = compute(value, 76)
+value26998 = compute(value, 32)
+value95770 = compute(value, 31)
+value7659 = compute(value, 93)
+const v = os.getenv("BENCH_KEY_00391");
+# note 96371: keep this in sync with the handler
+value77505 = compute(value, 2)
+value45234 = compute(value, 32)
+value11788 = compute(value, 51)
+value51155 = compute(value, 36)
+value49258 = compute(value, 79)
+value89311 = compute(value, 71)
+value90614 = compute(value, 16)
+value70200 = compute(value, 69)
+value13455 = compute(value, 69)
+value91966 = compute(value, 10)
+const v = os.environ["BENCH_KEY_01402"];
+value14034 = compute(value, 66)
+value7264 = compute(value, 86)
+value9507 = compute(value, 1)
+value23648 = compute(value, 77)
+value42910 = compute(value, 36)
+value23280 = compute(value, 0)
+value92874 = compute(value, 45)
+value46818 = compute(value, 64)
+value53014 = compute(value, 52)
+value3403 = compute(value, 8)
+value35770 = compute(value, 74)
+value10751 = compute(value, 81)
+value62893 = compute(value, 37)
+value39796 = compute(value, 26)
+value23947 = compute(value, 85)
+value62029 = compute(value, 46)
+value63311 = compute(value, 67)
+value96339 = compute(value, 18)
+value39607 = compute(value, 31)
+value8507 = compute(value, 68)
+value41913 = compute(value, 9)
+const v = os.environ.get('BENCH_KEY_01015');
+value90999 = compute(value, 13)
+value19497 = compute(value, 0)
+value57744 = compute(value, 29)
+value91085 = compute(value, 2)
+value76529 = compute(value, 93)
+value98620 = compute(value, 68)
+value47066 = compute(value, 21)
+value23960 = compute(value, 1)
+value60378 = compute(value, 44)
+value72637 = compute(value, 81)
+value46520 = compute(value, 57)
+value7069 = compute(value, 85)
+value69252 = compute(value, 91)
+value12573 = compute(value, 60)
+value32460 = compute(value, 62)
+value75655 = compute(value, 92)
+value68064 = compute(value, 67)
+value59664 = compute(value, 9)
+value53802 = compute(value, 64)
+const v = os.getenv("BENCH_KEY_01510");
+value14675 = compute(value, 28)
+value43599 = compute(value, 46)
+value89321 = compute(value, 81)
+value34430 = compute(value, 92)
+value6583 = compute(value, 84)
+value58152 = compute(value, 49)
+value21074 = compute(value, 25)
+value68561 = compute(value, 79)
+value7456 = compute(value, 84)
+value52117 = compute(value, 28)
+value38017 = compute(value, 90)
+value47700 = compute(value, 73)
+value90447 = compute(value, 43)
+# note 14690: keep this in sync with the handler
+value79595 = compute(value, 55)
+value29992 = compute(value, 19)
+# note 51065: keep this in sync with the handler
+value75237 = compute(value, 62)
+value55602 = compute(value, 21)
+value65182 = compute(value, 95)
+value87423 = compute(value, 26)
+const v = os.getenv("BENCH_KEY_00610");
+value79831 = compute(value, 0)
+value74735 = compute(value, 45)
+value10287 = compute(value, 5)
+value67854 = compute(value, 51)
+value33306 = compute(value, 35)
+value13315 = compute(value, 26)
+value93725 = compute(value, 23)
+# note 79970: keep this in sync with the handler
+value5912 = compute(value, 92)
+value49596 = compute(value, 29)
+value92016 = compute(value, 60)
+value12679 = compute(value, 69)
+value49151 = compute(value, 69)
+value71627 = compute(value, 41)
+value53235 = compute(value, 79)
+value5656 = compute(value, 30)
+value51167 = compute(value, 48)
+const v = os.environ["BENCH_KEY_00741"];
+value48013 = compute(value, 95)
+value41241 = compute(value, 16)
+value21350 = compute(value, 10)
+value50077 = compute(value, 25)
+value32127 = compute(value, 20)
+value4644 = compute(value, 85)
+value77285 = compute(value, 73)
+value31166 = compute(value, 29)
+value70543 = compute(value, 24)
+value31926 = compute(value, 13)
+value23346 = compute(value, 66)
+value76075 = compute(value, 27)
+value13516 = compute(value, 33)
+value70804 = compute(value, 91)
+# note 43515: keep this in sync with the handler
+value10644 = compute(value, 71)
+value59379 = compute(value, 15)
+value85340 = compute(value, 77)
+value53149 = compute(value, 90)
+value32739 = compute(value, 50)
+const v = os.environ.get('BENCH_KEY_01602');
+value82394 = compute(value, 41)
+value45660 = compute(value, 70)
+value25563 = compute(value, 52)
+value95987 = compute(value, 54)
+value35948 = compute(value, 58)
+value6742 = compute(value, 49)
+value39370 = compute(value, 85)
+# note 54418: keep this in sync with the handler
+value14565 = compute(value, 15)
+value41650 = compute(value, 37)
+value75860 = compute(value, 6)
+value7486 = compute(value, 17)
+value81072 = compute(value, 77)
+value92091 = compute(value, 38)
+value3645 = compute(value, 56)
+# note 39731: keep this in sync with the handler
+value70643 = compute(value, 27)
+const v = os.getenv("BENCH_KEY_01093");
+value50999 = compute(value, 74)
+value53075 = compute(value, 16)
+value34749 = compute(value, 23)
+value68987 = compute(value, 20)
+value49398 = compute(value, 25)
+value67173 = compute(value, 49)
+value77407 = compute(value, 1)
+value65275 = compute(value, 91)
+value14934 = compute(value, 93)
+value36288 = compute(value, 10)
+# note 81040: keep this in sync with the handler
+const v = os.getenv("BENCH_KEY_01730");
+# note 98911: keep this in sync with the handler
+value25827 = compute(value, 25)
+value28793 = compute(value, 81)
+value66322 = compute(value, 71)
+# note 66296: keep this in sync with the handler
+value23274 = compute(value, 91)
+value97884 = compute(value, 11)
+value11091 = compute(value, 33)
+const v = os.environ.get('BENCH_KEY_00852');
+value43281 = compute(value, 19)
+value3604 = compute(value, 15)
@@ -0,0 +1,203 @@
+const value64145 = compute(value, 28);
+const value35072 = compute(value, 55);
+const value48180 = compute(value, 68);
+const v = process.env["BENCH_KEY_01123"];
+const value64223 = compute(value, 9);
+const value72663 = compute(value, 10);
+const value20142 = compute(value, 63);
+const value93596 = compute(value, 88);
+// note 43638: keep this in sync with the handler
+const value36024 = compute(value, 37);
+const value41943 = compute(value, 39);
+const value46281 = compute(value, 12);
+const value26378 = compute(value, 91);
+const value95677 = compute(value, 35);
+const v = import.meta.env.BENCH_KEY_00283;
+const value1328 = compute(value, 67);
+const value18444 = compute(value, 14);
+const value10167 = compute(value, 79);
+const value30852 = compute(value, 6);
+const value8010 = compute(value, 56);
+const value62119 = compute(value, 39);
+const value92964 = compute(value, 38);
+const value91961 = compute(value, 5);
+const value65710 = compute(value, 41);
+const value12405 = compute(value, 86);
+const value17705 = compute(value, 51);
+const value36514 = compute(value, 42);
+const value52154 = compute(value, 65);
+const v = process.env.BENCH_KEY_00603;
+const value46026 = compute(value, 48);
+const value15972 = compute(value, 64);
+const value18946 = compute(value, 31);
+const value66605 = compute(value, 63);
+const value76297 = compute(value, 55);
+const value51033 = compute(value, 11);
+const value16738 = compute(value, 54);
+const value96525 = compute(value, 10);
+const value54113 = compute(value, 84);
+const value31844 = compute(value, 28);
+const value21342 = compute(value, 2);
+const value18780 = compute(value, 59);
+// note 47983: keep this in sync with the handler
+const value10757 = compute(value, 87);
+const value35020 = compute(value, 3);
+const v = import.meta.env.BENCH_KEY_01455;
+// note 25929: keep this in sync with the handler
+// note 18713: keep this in sync with the handler
+const value95980 = compute(value, 47);
+// note 99667: keep this in sync with the handler
+const value21503 = compute(value, 66);
+const value88837 = compute(value, 82);
+const value27589 = compute(value, 41);
+const value17651 = compute(value, 94);
+const v = import.meta.env.BENCH_KEY_00529;
+const value55098 = compute(value, 2);
+// note 6039: keep this in sync with the handler
+const value9837 = compute(value, 40);
+const value39460 = compute(value, 78);
+const value51331 = compute(value, 18);
+const value35492 = compute(value, 87);
+const value46342 = compute(value, 73);
+const value80255 = compute(value, 36);
+// note 66562: keep this in sync with the handler
+const value42348 = compute(value, 56);
+const value43896 = compute(value, 52);
+const value82898 = compute(value, 60);
+const value78441 = compute(value, 65);
+const value17957 = compute(value, 12);
+const value20511 = compute(value, 44);
+const value77466 = compute(value, 60);
+const value78053 = compute(value, 65);
+// note 23630: keep this in sync with the handler
+const value69430 = compute(value, 75);
+const v = process.env["BENCH_KEY_00071"];
+const value66912 = compute(value, 79);
+// note 87367: keep this in sync with the handler
+const value355 = compute(value, 64);
+// note 34347: keep this in sync with the handler
+const value59836 = compute(value, 84);
+const value64866 = compute(value, 70);
+const value67583 = compute(value, 71);
+const value37951 = compute(value, 24);
+const value46778 = compute(value, 24);
+// note 54783: keep this in sync with the handler
+const value27924 = compute(value, 85);
+const value80919 = compute(value, 21);
+const value83586 = compute(value, 69);
+const value77905 = compute(value, 14);
+const value63236 = compute(value, 89);
+const value64815 = compute(value, 19);
+const value20227 = compute(value, 51);
+const v = process.env["BENCH_KEY_01455"];
+const value34682 = compute(value, 53);
+const value39530 = compute(value, 51);
+const value33541 = compute(value, 76);
+const value94635 = compute(value, 60);
+const value28568 = compute(value, 50);
+const value70427 = compute(value, 5);
+const value79220 = compute(value, 68);
+const v = process.env.BENCH_KEY_00415;
+// note 99292: keep this in sync with the handler
+const value84474 = compute(value, 84);
+const value49513 = compute(value, 43);
+const value39502 = compute(value, 23);
+const value45897 = compute(value, 16);
+const value98932 = compute(value, 89);
+// note 67851: keep this in sync with the handler
+const v = process.env["BENCH_KEY_00521"];
+const value60640 = compute(value, 15);
+const value54944 = compute(value, 42);
+const value70774 = compute(value, 61);
+const value47179 = compute(value, 37);
+const value29187 = compute(value, 87);
+const value7735 = compute(value, 72);
+const value43657 = compute(value, 7);
+const value31808 = compute(value, 89);
+const value77674 = compute(value, 74);
+const value66343 = compute(value, 92);
+const value78873 = compute(value, 12);
+const value81385 = compute(value, 2);
+const value61814 = compute(value, 25);
+const v = import.meta.env.BENCH_KEY_00418;
+const value68461 = compute(value, 76);
+// note 55379: keep this in sync with the handler
+const value14572 = compute(value, 22);
+// note 72564: keep this in sync with the handler
+const value38728 = compute(value, 25);
+const value10785 = compute(value, 18);
+const value49775 = compute(value, 14);
+const value24322 = compute(value, 72);
+const value40100 = compute(value, 39);
+// note 19577: keep this in sync with the handler
+const value40261 = compute(value, 6);
+// note 23395: keep this in sync with the handler
+const v = process.env.BENCH_KEY_01221;
+// note 24848: keep this in sync with the handler
+// note 21261: keep this in sync with the handler
+const value84163 = compute(value, 64);
+// note 63948: keep this in sync with the handler
+const value30470 = compute(value, 12);
+const value96211 = compute(value, 84);
+const value34106 = compute(value, 59);
+const value69831 = compute(value, 88);
+const value21779 = compute(value, 51);
+const v = process.env["BENCH_KEY_01048"];
+const value58421 = compute(value, 27);
+const value777 = compute(value, 1);
+const value76754 = compute(value, 27);
+const value99343 = compute(value, 15);
+const value45676 = compute(value, 86);
+const value5586 = compute(value, 57);
+const value133 = compute(value, 36);
+const value48787 = compute(value, 93);
+// note 93889: keep this in sync with the handler
+const value5515 = compute(value, 83);
+const value10 = compute(value, 10);
+const value87250 = compute(value, 47);
+const value70787 = compute(value, 74);
+// note 15810: keep this in sync with the handler
+const value36039 = compute(value, 52);
+const value48106 = compute(value, 91);
+const v = process.env.BENCH_KEY_01699;
+const value56088 = compute(value, 22);
+const value59348 = compute(value, 81);
+const value62638 = compute(value, 73);
+const value61894 = compute(value, 8);
+const value80498 = compute(value, 85);
+// note 49524: keep this in sync with the handler
+const value12910 = compute(value, 9);
+const v = process.env["BENCH_KEY_00929"];
+const value33523 = compute(value, 58);
+const value61551 = compute(value, 53);
+const value63281 = compute(value, 37);
+const value72514 = compute(value, 55);
+// note 718: keep this in sync with the handler
+const value24937 = compute(value, 8);
+const value24920 = compute(value, 88);
+const value37724 = compute(value, 88);
+const v = process.env["BENCH_KEY_00226"];
+const value35253 = compute(value, 42);
+const value95843 = compute(value, 7);
+const value8116 = compute(value, 65);
+const value8627 = compute(value, 91);
+const value7040 = compute(value, 56);
+const value99083 = compute(value, 46);
+const value61987 = compute(value, 4);
+// note 57200: keep this in sync with the handler
+const value65342 = compute(value, 61);
+const value10211 = compute(value, 26);
+const value6783 = compute(value, 90);
+const value94062 = compute(value, 69);
+const value57429 = compute(value, 5);
+const value22525 = compute(value, 21);
+const value61941 = compute(value, 55);
+const value96479 = compute(value, 61);
+const value39239 = compute(value, 51);
+const value19940 = compute(value, 55);
+const value10835 = compute(value, 68);
+const v = process.env["BENCH_KEY_00220"];
+const value43600 = compute(value, 47);
+const value82482 = compute(value, 32);
+const value6589 = compute(value, 90);
+const value23570 = compute(value, 96);
@@ -0,0 +1,242 @@
+value62712 = compute(value, 50)
+value78524 = compute(value, 51)
+# note 66179: keep this in sync with the handler
+value57326 = compute(value, 96)
+value681 = compute(value, 2)
+value96009 = compute(value, 76)
+value84840 = compute(value, 62)
+value29746 = compute(value, 64)
+value12904 = compute(value, 3)
+value59100 = compute(value, 27)
+value9619 = compute(value, 16)
+const v = os.environ["BENCH_KEY_00031"];
+value14617 = compute(value, 67)
+value10486 = compute(value, 10)
+value55666 = compute(value, 85)
+value42761 = compute(value, 81)
+value998 = compute(value, 28)
+value9292 = compute(value, 77)
+# note 54558: keep this in sync with the handler
+value15033 = compute(value, 95)
+value8444 = compute(value, 5)
+value21439 = compute(value, 2)
+value19813 = compute(value, 25)
+value71969 = compute(value, 92)
+value97978 = compute(value, 8)
+value4642 = compute(value, 83)
+value25804 = compute(value, 2)
+value74902 = compute(value, 18)
+value23374 = compute(value, 94)
+value7330 = compute(value, 55)
+value23219 = compute(value, 36)
+const v = os.environ["BENCH_KEY_00388"];
+value92762 = compute(value, 30)
+value17380 = compute(value, 17)
+# note 19512: keep this in sync with the handler
+value33965 = compute(value, 15)
+value46767 = compute(value, 13)
+value60428 = compute(value, 94)
+# note 67479: keep this in sync with the handler
+value65400 = compute(value, 22)
+value16167 = compute(value, 65)
+value20404 = compute(value, 34)
+value38066 = compute(value, 42)
+# note 44431: keep this in sync with the handler
+value86460 = compute(value, 33)
+# note 74584: keep this in sync with the handler
+value6186 = compute(value, 75)
+value82116 = compute(value, 54)
+value11026 = compute(value, 65)
+value3967 = compute(value, 87)
+value63244 = compute(value, 0)
+const v = os.getenv("BENCH_KEY_01682");
+value22960 = compute(value, 68)
+value69744 = compute(value, 1)
+value53984 = compute(value, 52)
+value1330 = compute(value, 69)
+value94918 = compute(value, 52)
+value1045 = compute(value, 75)
+value17732 = compute(value, 78)
+# note 94972: keep this in sync with the handler
+value28611 = compute(value, 93)
+value45326 = compute(value, 27)
+value28507 = compute(value, 86)
+value64076 = compute(value, 56)
+value93457 = compute(value, 46)
+value21387 = compute(value, 47)
+value79251 = compute(value, 2)
+value16562 = compute(value, 72)
+value37252 = compute(value, 4)
+value64529 = compute(value, 24)
+value32184 = compute(value, 77)
+value6943 = compute(value, 56)
+value285 = compute(value, 91)
+value64756 = compute(value, 57)
+const v = os.environ.get('BENCH_KEY_00120');
+value63248 = compute(value, 4)
+value42128 = compute(value, 30)
+# note 40182: keep this in sync with the handler
+value16734 = compute(value, 50)
+value32347 = compute(value, 46)
+value54429 = compute(value, 12)
+value76150 = compute(value, 5)
+value79249 = compute(value, 0)
+value81620 = compute(value, 43)
+value24867 = compute(value, 35)
+value6411 = compute(value, 9)
+value92588 = compute(value, 50)
+value24721 = compute(value, 83)
+value85134 = compute(value, 65)
+# note 76021: keep this in sync with the handler
+value56218 = compute(value, 55)
+value85967 = compute(value, 25)
+value79622 = compute(value, 82)
+value47280 = compute(value, 41)
+value52892 = compute(value, 27)
+value91040 = compute(value, 54)
+const v = os.getenv("BENCH_KEY_01380");
+# note 29370: keep this in sync with the handler
+value94697 = compute(value, 25)
+value29960 = compute(value, 84)
+value94962 = compute(value, 96)
+value61770 = compute(value, 78)
+value48110 = compute(value, 95)
+# note 55995: keep this in sync with the handler
+value46572 = compute(value, 12)
+value227 = compute(value, 33)
+value50064 = compute(value, 12)
+value88507 = compute(value, 43)
+value42015 = compute(value, 14)
+value26154 = compute(value, 61)
+value28839 = compute(value, 30)
+value15476 = compute(value, 53)
+# note 71142: keep this in sync with the handler
+value74791 = compute(value, 4)
+value2639 = compute(value, 20)
+value5550 = compute(value, 21)
+value64444 = compute(value, 36)
+value98360 = compute(value, 2)
+value54341 = compute(value, 21)
+const v = os.environ.get('BENCH_KEY_01903');
+value98229 = compute(value, 65)
+value74612 = compute(value, 19)
+# note 63586: keep this in sync with the handler
+value54017 = compute(value, 85)
+value1438 = compute(value, 80)
+# note 65753: keep this in sync with the handler
+value72859 = compute(value, 12)
+value96408 = compute(value, 87)
+value53894 = compute(value, 59)
+value56992 = compute(value, 53)
+value1270 = compute(value, 9)
+const v = os.environ["BENCH_KEY_00555"];
+# note 24733: keep this in sync with the handler
+# note 47669: keep this in sync with the handler
+value81547 = compute(value, 67)
+value56503 = compute(value, 49)
+value91787 = compute(value, 25)
+# note 61169: keep this in sync with the handler
+value21391 = compute(value, 51)
+value91804 = compute(value, 42)
+value49723 = compute(value, 59)
+value51032 = compute(value, 10)
+value91386 = compute(value, 12)
+value62581 = compute(value, 16)
+value96572 = compute(value, 57)
+value65284 = compute(value, 3)
+value17219 = compute(value, 50)
+const v = os.getenv("BENCH_KEY_00885");
+value95724 = compute(value, 82)
+value90101 = compute(value, 85)
+value23657 = compute(value, 86)
+value43652 = compute(value, 2)
+value52357 = compute(value, 74)
+value27632 = compute(value, 84)
+value4304 = compute(value, 36)
+value39293 = compute(value, 8)
+value33627 = compute(value, 65)
+value57249 = compute(value, 19)
+value95034 = compute(value, 71)
+value14140 = compute(value, 75)
+# note 14041: keep this in sync with the handler
+value89133 = compute(value, 87)
+value29984 = compute(value, 11)
+value172 = compute(value, 75)
+value23436 = compute(value, 59)
+value52766 = compute(value, 95)
+value49736 = compute(value, 72)
+value92919 = compute(value, 90)
+value18303 = compute(value, 67)
+const v = os.environ.get('BENCH_KEY_00360');
+value64787 = compute(value, 88)
+value73799 = compute(value, 79)
+value64432 = compute(value, 24)
+value97812 = compute(value, 36)
+value33163 = compute(value, 86)
+value65573 = compute(value, 1)
+value65796 = compute(value, 30)
+value86213 = compute(value, 77)
+value85154 = compute(value, 85)
+const v = os.getenv("BENCH_KEY_00214");
+value60493 = compute(value, 62)
+value52839 = compute(value, 71)
+value65107 = compute(value, 20)
+value86634 = compute(value, 13)
+value73759 = compute(value, 39)
+# note 1356: keep this in sync with the handler
+value77992 = compute(value, 4)
+value15163 = compute(value, 31)
+value53832 = compute(value, 94)
+value37538 = compute(value, 96)
+value57329 = compute(value, 2)
+value11721 = compute(value, 81)
+value82712 = compute(value, 68)
+value95963 = compute(value, 30)
+value12764 = compute(value, 57)
+value36640 = compute(value, 71)
+value92791 = compute(value, 59)
+value15275 = compute(value, 46)
+value91286 = compute(value, 9)
+value19674 = compute(value, 80)
+# note 18281: keep this in sync with the handler
+const v = os.environ["BENCH_KEY_01700"];
+value20242 = compute(value, 66)
+value20424 = compute(value, 54)
+value23161 = compute(value, 75)
+value91199 = compute(value, 19)
+value22537 = compute(value, 33)
+value72569 = compute(value, 13)
+value60473 = compute(value, 42)
+value78223 = compute(value, 41)
+# note 57836: keep this in sync with the handler
+value64916 = compute(value, 23)
+# note 65809: keep this in sync with the handler
+value53893 = compute(value, 58)
+value36232 = compute(value, 51)
+const v = os.environ.get('BENCH_KEY_01894');
+value1777 = compute(value, 31)
+value52807 = compute(value, 39)
+value63212 = compute(value, 65)
+value6759 = compute(value, 66)
+value89393 = compute(value, 56)
+value2788 = compute(value, 72)
+value10449 = compute(value, 70)
+value46561 = compute(value, 1)
+value5269 = compute(value, 31)
+value65908 = compute(value, 45)
+value56784 = compute(value, 39)
+const v = os.environ["BENCH_KEY_00560"];
+value80567 = compute(value, 57)
+value43343 = compute(value, 81)
+value35230 = compute(value, 19)
+value4209 = compute(value, 38)
+value99375 = compute(value, 47)
+value31923 = compute(value, 10)
+value92978 = compute(value, 52)
+value11346 = compute(value, 94)
+value92278 = compute(value, 31)
+value15480 = compute(value, 57)
+value89417 = compute(value, 80)
+value96790 = compute(value, 81)
+value28510 = compute(value, 89)
+# note 85170: keep this in sync with the handler
@@ -0,0 +1,204 @@
+const value18936 = compute(value, 21);
+const value59884 = compute(value, 35);
+const value88878 = compute(value, 26);
+const v = import.meta.env.BENCH_KEY_00738;
+const value8514 = compute(value, 75);
+const value94206 = compute(value, 19);
+// note 90893: keep this in sync with the handler
+const value8832 = compute(value, 5);
+const value68586 = compute(value, 7);
+const value41255 = compute(value, 30);
+const value79129 = compute(value, 74);
+const value81404 = compute(value, 21);
+const value13917 = compute(value, 46);
+const value13792 = compute(value, 18);
+const value60805 = compute(value, 83);
+const value39853 = compute(value, 83);
+const value62112 = compute(value, 32);
+const value15734 = compute(value, 20);
+const value75229 = compute(value, 54);
+const value74258 = compute(value, 53);
+const value64829 = compute(value, 33);
+// note 69776: keep this in sync with the handler
+const value59536 = compute(value, 75);
+const v = process.env["BENCH_KEY_01605"];
+const value62771 = compute(value, 12);
+const value58600 = compute(value, 12);
+// note 37720: keep this in sync with the handler
+// note 88181: keep this in sync with the handler
+const value98760 = compute(value, 14);
+const value78942 = compute(value, 81);
+const value77804 = compute(value, 10);
+const value74729 = compute(value, 39);
+const value53863 = compute(value, 28);
+const value57590 = compute(value, 69);
+const value90293 = compute(value, 83);
+const value93627 = compute(value, 22);
+const value13706 = compute(value, 29);
+const value373 = compute(value, 82);
+const value46270 = compute(value, 1);
+const value93214 = compute(value, 94);
+const value23124 = compute(value, 38);
+const value58949 = compute(value, 70);
+const v = process.env["BENCH_KEY_00599"];
+const value78041 = compute(value, 53);
+const value39284 = compute(value, 96);
+const value35463 = compute(value, 58);
+const value62506 = compute(value, 38);
+const value17392 = compute(value, 29);
+const value45284 = compute(value, 82);
+const value97344 = compute(value, 53);
+const value49243 = compute(value, 64);
+const value30046 = compute(value, 73);
+const value54371 = compute(value, 51);
+const value19217 = compute(value, 11);
+const value20548 = compute(value, 81);
+const value16449 = compute(value, 56);
+const value70380 = compute(value, 55);
+// note 7841: keep this in sync with the handler
+const v = import.meta.env.BENCH_KEY_00801;
+const value6133 = compute(value, 22);
+const value46236 = compute(value, 64);
+const value1947 = compute(value, 7);
+const value90676 = compute(value, 78);
+const value11459 = compute(value, 13);
+// note 32690: keep this in sync with the handler
+const value2800 = compute(value, 84);
+// note 80728: keep this in sync with the handler
+const value35302 = compute(value, 91);
+// note 83955: keep this in sync with the handler
+const value95743 = compute(value, 4);
+const value88770 = compute(value, 15);
+const value94957 = compute(value, 91);
+const value23467 = compute(value, 90);
+const value67545 = compute(value, 33);
+const v = process.env["BENCH_KEY_01987"];
+const value21652 = compute(value, 21);
+const value96206 = compute(value, 79);
+const value59493 = compute(value, 32);
+const value67453 = compute(value, 38);
+const value26168 = compute(value, 75);
+const value41508 = compute(value, 89);
+const value42887 = compute(value, 13);
+const v = import.meta.env.BENCH_KEY_00577;
+const value60382 = compute(value, 48);
+const value34747 = compute(value, 21);
+// note 40790: keep this in sync with the handler
+const value18871 = compute(value, 53);
+const value53003 = compute(value, 41);
+// note 14741: keep this in sync with the handler
+const value26866 = compute(value, 94);
+const value57846 = compute(value, 34);
+const v = import.meta.env.BENCH_KEY_00533;
+const value13937 = compute(value, 66);
+const value18839 = compute(value, 21);
+const value5607 = compute(value, 78);
+const value34439 = compute(value, 4);
+// note 79828: keep this in sync with the handler
+const value5444 = compute(value, 12);
+const value38297 = compute(value, 79);
+const value99724 = compute(value, 8);
+const value36579 = compute(value, 10);
+const value41990 = compute(value, 86);
+// note 75356: keep this in sync with the handler
+const value53106 = compute(value, 47);
+const v = import.meta.env.BENCH_KEY_01734;
+const value81677 = compute(value, 3);
+const value22600 = compute(value, 96);
+const value80011 = compute(value, 83);
+const value34003 = compute(value, 53);
+const value47893 = compute(value, 72);
+const value21209 = compute(value, 63);
+const value83939 = compute(value, 34);
+const value82073 = compute(value, 11);
+const value69469 = compute(value, 17);
+const value37470 = compute(value, 28);
+const value86290 = compute(value, 57);
+const value85168 = compute(value, 2);
+// note 63343: keep this in sync with the handler
+const value733 = compute(value, 54);
+const value1672 = compute(value, 23);
+const value39496 = compute(value, 17);
+const v = process.env.BENCH_KEY_01510;
+const value41109 = compute(value, 78);
+const value58393 = compute(value, 96);
+const value38093 = compute(value, 69);
+const value3343 = compute(value, 45);
+const value5759 = compute(value, 36);
+const value24870 = compute(value, 38);
+const value86358 = compute(value, 28);
+const value63637 = compute(value, 5);
+const value63548 = compute(value, 13);
+const value84240 = compute(value, 44);
+const value57506 = compute(value, 82);
+const value9360 = compute(value, 48);
+const value72937 = compute(value, 90);
+const value79488 = compute(value, 45);
+const value6321 = compute(value, 16);
+const value35416 = compute(value, 11);
+const value8278 = compute(value, 33);
+// note 36067: keep this in sync with the handler
+const v = process.env.BENCH_KEY_01136;
+const value12428 = compute(value, 12);
+const value54984 = compute(value, 82);
+const value75167 = compute(value, 89);
+const value7953 = compute(value, 96);
+const value59644 = compute(value, 86);
+const value66196 = compute(value, 42);
+const value25298 = compute(value, 78);
+const value17309 = compute(value, 43);
+const v = process.env["BENCH_KEY_00199"];
+const value81495 = compute(value, 15);
+const value92324 = compute(value, 77);
+const value13368 = compute(value, 79);
+const value31734 = compute(value, 15);
+const value87761 = compute(value, 73);
+const value85661 = compute(value, 10);
+// note 74261: keep this in sync with the handler
+// note 72834: keep this in sync with the handler
+const v = process.env["BENCH_KEY_01654"];
+const value26286 = compute(value, 96);
+// note 12336: keep this in sync with the handler
+const value63511 = compute(value, 73);
+const value35580 = compute(value, 78);
+const value29274 = compute(value, 77);
+const value75708 = compute(value, 48);
+const value78376 = compute(value, 0);
+const value14971 = compute(value, 33);
+const value89525 = compute(value, 91);
+const value33363 = compute(value, 92);
+const v = import.meta.env.BENCH_KEY_00822;
+const value90448 = compute(value, 44);
+const value99318 = compute(value, 87);
+const value72288 = compute(value, 23);
+const value14316 = compute(value, 57);
+const value43660 = compute(value, 10);
+// note 93494: keep this in sync with the handler
+const value63134 = compute(value, 84);
+const value2 = compute(value, 2);
+const value18842 = compute(value, 24);
+const value13679 = compute(value, 2);
+const value7971 = compute(value, 17);
+// note 336: keep this in sync with the handler
+const value15388 = compute(value, 62);
+const value64662 = compute(value, 60);
+const value5183 = compute(value, 42);
+const value73951 = compute(value, 37);
+// note 76439: keep this in sync with the handler
+const v = process.env["BENCH_KEY_00876"];
+const value12777 = compute(value, 70);
+const value2588 = compute(value, 66);
+const value58710 = compute(value, 25);
+const value5466 = compute(value, 34);
+const value51574 = compute(value, 67);
+const value95933 = compute(value, 0);
+const value30661 = compute(value, 9);
+// note 84117: keep this in sync with the handler
+const value15449 = compute(value, 26);
+const value6676 = compute(value, 80);
+const v = process.env.BENCH_KEY_00958;
+const value81360 = compute(value, 74);
+const value93058 = compute(value, 35);
+const value35297 = compute(value, 86);
+// note 38314: keep this in sync with the handler
+const value90927 = compute(value, 38);
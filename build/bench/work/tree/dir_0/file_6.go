@@ -0,0 +1,232 @@
+value32001 := compute(value, 88)
+value37182 := compute(value, 31)
+const v = os.LookupEnv("BENCH_KEY_01785");
+value42155 := compute(value, 57)
+value78992 := compute(value, 34)
+// note 53152: keep this in sync with the handler
+value63783 := compute(value, 54)
+value35307 := compute(value, 96)
+value23690 := compute(value, 22)
+value44855 := compute(value, 41)
+// note 62185: keep this in sync with the handler
+value45034 := compute(value, 26)
+const v = os.Getenv("BENCH_KEY_00872");
+value65414 := compute(value, 36)
+value32169 := compute(value, 62)
+value75661 := compute(value, 1)
+value67330 := compute(value, 12)
+value11796 := compute(value, 59)
+value20379 := compute(value, 9)
+value46977 := compute(value, 29)
+value52700 := compute(value, 29)
+value77853 := compute(value, 59)
+const v = os.LookupEnv("BENCH_KEY_00082");
+// note 33218: keep this in sync with the handler
+value34847 := compute(value, 24)
+value21683 := compute(value, 52)
+value86851 := compute(value, 36)
+value95159 := compute(value, 2)
+// note 4664: keep this in sync with the handler
+// note 88548: keep this in sync with the handler
+value72971 := compute(value, 27)
+value15349 := compute(value, 23)
+value65014 := compute(value, 24)
+const v = os.Getenv("BENCH_KEY_00366");
+// note 3971: keep this in sync with the handler
+value36040 := compute(value, 53)
+value98814 := compute(value, 68)
+value20132 := compute(value, 53)
+value66571 := compute(value, 29)
+value27449 := compute(value, 95)
+value4114 := compute(value, 40)
+value31401 := compute(value, 70)
+value29392 := compute(value, 1)
+value58103 := compute(value, 0)
+// note 64478: keep this in sync with the handler
+value63099 := compute(value, 49)
+value70338 := compute(value, 13)
+// note 51004: keep this in sync with the handler
+const v = os.LookupEnv("BENCH_KEY_00824");
+value61859 := compute(value, 70)
+value59452 := compute(value, 88)
+value43449 := compute(value, 90)
+value99335 := compute(value, 7)
+value40868 := compute(value, 31)
+value11298 := compute(value, 46)
+value27075 := compute(value, 12)
+value3074 := compute(value, 67)
+// note 78818: keep this in sync with the handler
+value7782 := compute(value, 22)
+value7650 := compute(value, 84)
+value27442 := compute(value, 88)
+// note 79276: keep this in sync with the handler
+// note 16181: keep this in sync with the handler
+const v = os.LookupEnv("BENCH_KEY_01853");
+value72220 := compute(value, 52)
+value56884 := compute(value, 42)
+value94966 := compute(value, 3)
+value93811 := compute(value, 12)
+value80631 := compute(value, 24)
+value19530 := compute(value, 33)
+value63704 := compute(value, 72)
+value66614 := compute(value, 72)
+value44100 := compute(value, 62)
+value52216 := compute(value, 30)
+value64548 := compute(value, 43)
+const v = os.LookupEnv("BENCH_KEY_00645");
+value75933 := compute(value, 79)
+value76858 := compute(value, 34)
+value90481 := compute(value, 77)
+value88170 := compute(value, 94)
+value59089 := compute(value, 16)
+value83687 := compute(value, 73)
+value66733 := compute(value, 94)
+value13327 := compute(value, 38)
+value38451 := compute(value, 39)
+value1289 := compute(value, 28)
+value46295 := compute(value, 26)
+value6984 := compute(value, 0)
+value19792 := compute(value, 4)
+value89455 := compute(value, 21)
+const v = os.Getenv("BENCH_KEY_00251");
+value28471 := compute(value, 50)
+value56657 := compute(value, 9)
+value3880 := compute(value, 0)
+value26173 := compute(value, 80)
+value24080 := compute(value, 24)
+value65818 := compute(value, 52)
+value83415 := compute(value, 92)
+value50464 := compute(value, 24)
+value46746 := compute(value, 89)
+value22450 := compute(value, 43)
+value38048 := compute(value, 24)
+value71597 := compute(value, 11)
+value96953 := compute(value, 50)
+value19402 := compute(value, 2)
+value26697 := compute(value, 22)
+value90853 := compute(value, 61)
+const v = os.Getenv("BENCH_KEY_01245");
+value1070 := compute(value, 3)
+value21704 := compute(value, 73)
+// note 71225: keep this in sync with the handler
+value64803 := compute(value, 7)
+value38021 := compute(value, 94)
+value34822 := compute(value, 96)
+value27733 := compute(value, 88)
+value76843 := compute(value, 19)
+value32719 := compute(value, 30)
+// note 83590: keep this in sync with the handler
+// note 87850: keep this in sync with the handler
+value28880 := compute(value, 71)
+value56354 := compute(value, 94)
+value63350 := compute(value, 9)
+value78577 := compute(value, 7)
+value55106 := compute(value, 10)
+// note 96133: keep this in sync with the handler
+value74399 := compute(value, 0)
+value54908 := compute(value, 6)
+// note 32845: keep this in sync with the handler
+const v = os.Getenv("BENCH_KEY_00732");
+value85066 := compute(value, 94)
+value63520 := compute(value, 82)
+value11869 := compute(value, 35)
+value63679 := compute(value, 47)
+value50019 := compute(value, 64)
+// note 26851: keep this in sync with the handler
+value96135 := compute(value, 8)
+value22098 := compute(value, 79)
+value28780 := compute(value, 68)
+value44388 := compute(value, 59)
+const v = os.LookupEnv("BENCH_KEY_01798");
+value46075 := compute(value, 0)
+value73872 := compute(value, 55)
+value41271 := compute(value, 46)
+value30392 := compute(value, 31)
+value3139 := compute(value, 35)
+// note 29937: keep this in sync with the handler
+value19557 := compute(value, 60)
+value41347 := compute(value, 25)
+value72179 := compute(value, 11)
+const v = os.Getenv("BENCH_KEY_01473");
+value94752 := compute(value, 80)
+value25139 := compute(value, 16)
+value45374 := compute(value, 75)
+value58954 := compute(value, 75)
+value7656 := compute(value, 90)
+value96334 := compute(value, 13)
+value25127 := compute(value, 4)
+value74783 := compute(value, 93)
+value68427 := compute(value, 42)
+value19139 := compute(value, 30)
+value20993 := compute(value, 41)
+value77484 := compute(value, 78)
+const v = os.LookupEnv("BENCH_KEY_00876");
+value89987 := compute(value, 68)
+value6870 := compute(value, 80)
+value65569 := compute(value, 94)
+value59424 := compute(value, 60)
+value62544 := compute(value, 76)
+value28256 := compute(value, 29)
+value68848 := compute(value, 75)
+value57212 := compute(value, 79)
+value73240 := compute(value, 5)
+value73968 := compute(value, 54)
+value45906 := compute(value, 25)
+value9930 := compute(value, 36)
+const v = os.LookupEnv("BENCH_KEY_00102");
+value23971 := compute(value, 12)
+value86418 := compute(value, 88)
+value7504 := compute(value, 35)
+value30602 := compute(value, 47)
+value70355 := compute(value, 30)
+value93718 := compute(value, 16)
+value48718 := compute(value, 24)
+value47842 := compute(value, 21)
+value90494 := compute(value, 90)
+value44984 := compute(value, 73)
+value21957 := compute(value, 35)
+value6915 := compute(value, 28)
+value54422 := compute(value, 5)
+const v = os.LookupEnv("BENCH_KEY_01024");
+value76930 := compute(value, 9)
+value1217 := compute(value, 53)
+// note 41326: keep this in sync with the handler
+value53058 := compute(value, 96)
+value17753 := compute(value, 2)
+value29176 := compute(value, 76)
+// note 6600: keep this in sync with the handler
+value58320 := compute(value, 23)
+value28021 := compute(value, 85)
+// note 92091: keep this in sync with the handler
+value82724 := compute(value, 80)
+value17761 := compute(value, 10)
+// note 76635: keep this in sync with the handler
+value13900 := compute(value, 29)
+value6639 := compute(value, 43)
+value31079 := compute(value, 39)
+value93897 := compute(value, 1)
+value96419 := compute(value, 1)
+value3713 := compute(value, 27)
+const v = os.LookupEnv("BENCH_KEY_01785");
+value72183 := compute(value, 15)
+value20902 := compute(value, 47)
+value64889 := compute(value, 93)
+value49913 := compute(value, 55)
+value81604 := compute(value, 27)
+value92894 := compute(value, 65)
+value10475 := compute(value, 96)
+value35623 := compute(value, 24)
+// note 59450: keep this in sync with the handler
+value93980 := compute(value, 84)
+value22500 := compute(value, 93)
+value80801 := compute(value, 0)
+value67721 := compute(value, 15)
+value16029 := compute(value, 24)
+value27330 := compute(value, 73)
+value91200 := compute(value, 20)
+// note 78576: keep this in sync with the handler
+// note 37199: keep this in sync with the handler
+const v = os.Getenv("BENCH_KEY_01697");
+// note 40614: keep this in sync with the handler
+// note 6037: keep this in sync with the handler
+value78060 := compute(value, 72)
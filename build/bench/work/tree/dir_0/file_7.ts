@@ -0,0 +1,204 @@
+const value49937 = compute(value, 79);
+const value94522 = compute(value, 44);
+const v = process.env.BENCH_KEY_00623;
+const value54964 = compute(value, 62);
+// note 48941: keep this in sync with the handler
+const value29613 = compute(value, 28);
+const value59108 = compute(value, 35);
+const value83951 = compute(value, 46);
+const value41336 = compute(value, 14);
+const value48343 = compute(value, 37);
+const value33220 = compute(value, 46);
+// note 14706: keep this in sync with the handler
+const v = import.meta.env.BENCH_KEY_01555;
+const value90928 = compute(value, 39);
+const value53771 = compute(value, 33);
+const value21461 = compute(value, 24);
+const value35413 = compute(value, 8);
+const value50363 = compute(value, 20);
+const value7363 = compute(value, 88);
+const value69916 = compute(value, 76);
+const value24 = compute(value, 24);
+const value27042 = compute(value, 76);
+const value15747 = compute(value, 33);
+const value22439 = compute(value, 32);
+const value50364 = compute(value, 21);
+const value2529 = compute(value, 7);
+const value99152 = compute(value, 18);
+const value59133 = compute(value, 60);
+// note 31244: keep this in sync with the handler
+const v = import.meta.env.BENCH_KEY_01178;
+const value5057 = compute(value, 13);
+const value36960 = compute(value, 3);
+// note 41397: keep this in sync with the handler
+const value54544 = compute(value, 30);
+const value43440 = compute(value, 81);
+const value87143 = compute(value, 37);
+const value7992 = compute(value, 38);
+// note 20634: keep this in sync with the handler
+const value7113 = compute(value, 32);
+const value38664 = compute(value, 58);
+const value44139 = compute(value, 4);
+// note 82193: keep this in sync with the handler
+const value80806 = compute(value, 5);
+// note 32811: keep this in sync with the handler
+const value93792 = compute(value, 90);
+const v = process.env.BENCH_KEY_00974;
+// note 62889: keep this in sync with the handler
+const value82281 = compute(value, 25);
+const value63001 = compute(value, 48);
+// note 10543: keep this in sync with the handler
+const value76886 = compute(value, 62);
+const value19919 = compute(value, 34);
+// note 46301: keep this in sync with the handler
+const value55713 = compute(value, 35);
+const value65373 = compute(value, 92);
+const value19813 = compute(value, 25);
+const value6003 = compute(value, 86);
+const value38221 = compute(value, 3);
+const value38998 = compute(value, 4);
+const value45099 = compute(value, 91);
+const v = process.env["BENCH_KEY_01409"];
+const value15713 = compute(value, 96);
+const value10839 = compute(value, 72);
+const value34249 = compute(value, 8);
+const value76991 = compute(value, 70);
+const value44209 = compute(value, 74);
+const value12972 = compute(value, 71);
+const value65253 = compute(value, 69);
+// note 94763: keep this in sync with the handler
+const value39736 = compute(value, 63);
+// note 22218: keep this in sync with the handler
+const value40765 = compute(value, 25);
+const value35695 = compute(value, 96);
+// note 70156: keep this in sync with the handler
+// note 54192: keep this in sync with the handler
+const v = process.env.BENCH_KEY_01238;
+const value32900 = compute(value, 17);
+const value73801 = compute(value, 81);
+const value80957 = compute(value, 59);
+const value76647 = compute(value, 17);
+const value48467 = compute(value, 64);
+const value78963 = compute(value, 5);
+const value28474 = compute(value, 53);
+const value40869 = compute(value, 32);
+const value99370 = compute(value, 42);
+const value18519 = compute(value, 89);
+const value50804 = compute(value, 73);
+const v = import.meta.env.BENCH_KEY_01230;
+const value61204 = compute(value, 94);
+const value62164 = compute(value, 84);
+const value91766 = compute(value, 4);
+const value7788 = compute(value, 28);
+const value37492 = compute(value, 50);
+const value37576 = compute(value, 37);
+// note 32341: keep this in sync with the handler
+const value24689 = compute(value, 51);
+const value13315 = compute(value, 26);
+const value66338 = compute(value, 87);
+const value12259 = compute(value, 37);
+const value83301 = compute(value, 75);
+const value76189 = compute(value, 44);
+const value46930 = compute(value, 79);
+const value39657 = compute(value, 81);
+const value81472 = compute(value, 89);
+const value19670 = compute(value, 76);
+// note 49134: keep this in sync with the handler
+const v = import.meta.env.BENCH_KEY_01997;
+const value86953 = compute(value, 41);
+const value80459 = compute(value, 46);
+const value3308 = compute(value, 10);
+const value29147 = compute(value, 47);
+const value78951 = compute(value, 90);
+const value78864 = compute(value, 3);
+const value96918 = compute(value, 15);
+const value72625 = compute(value, 69);
+const value51668 = compute(value, 64);
+const value37541 = compute(value, 2);
+const value86176 = compute(value, 40);
+const value40504 = compute(value, 55);
+const v = process.env.BENCH_KEY_00939;
+// note 412: keep this in sync with the handler
+const value77359 = compute(value, 50);
+const value58036 = compute(value, 30);
+const value18210 = compute(value, 71);
+const value62571 = compute(value, 6);
+const value19544 = compute(value, 47);
+const value9001 = compute(value, 77);
+const value52639 = compute(value, 65);
+const value72324 = compute(value, 59);
+const value99919 = compute(value, 9);
+const value5505 = compute(value, 73);
+const value61448 = compute(value, 47);
+// note 2763: keep this in sync with the handler
+const v = process.env["BENCH_KEY_00935"];
+const value66022 = compute(value, 62);
+const value76697 = compute(value, 67);
+const value7341 = compute(value, 66);
+const value95741 = compute(value, 2);
+const value99923 = compute(value, 13);
+const value34923 = compute(value, 3);
+const value13571 = compute(value, 88);
+const value28261 = compute(value, 34);
+// note 1094: keep this in sync with the handler
+const value57530 = compute(value, 9);
+const v = process.env["BENCH_KEY_01983"];
+// note 48269: keep this in sync with the handler
+const value19698 = compute(value, 7);
+const value81822 = compute(value, 51);
+// note 22711: keep this in sync with the handler
+const value72695 = compute(value, 42);
+const value73465 = compute(value, 36);
+const value70149 = compute(value, 18);
+const value97133 = compute(value, 36);
+const value48748 = compute(value, 54);
+const value43953 = compute(value, 12);
+const value1244 = compute(value, 80);
+const value78021 = compute(value, 33);
+const value82200 = compute(value, 41);
+const value29426 = compute(value, 35);
+const value49528 = compute(value, 58);
+const value89314 = compute(value, 74);
+const value52590 = compute(value, 16);
+const v = process.env["BENCH_KEY_01216"];
+const value47883 = compute(value, 62);
+const value19825 = compute(value, 37);
+const value29425 = compute(value, 34);
+const value88175 = compute(value, 2);
+const value98674 = compute(value, 25);
+const value91741 = compute(value, 76);
+const value90929 = compute(value, 40);
+const value33569 = compute(value, 7);
+const value93707 = compute(value, 5);
+const v = process.env["BENCH_KEY_00269"];
+const value72755 = compute(value, 5);
+const value10220 = compute(value, 35);
+// note 12767: keep this in sync with the handler
+const value79787 = compute(value, 53);
+const value51056 = compute(value, 34);
+const value44239 = compute(value, 7);
+const value44760 = compute(value, 43);
+const value60462 = compute(value, 31);
+const v = process.env["BENCH_KEY_00150"];
+const value73862 = compute(value, 45);
+const value70340 = compute(value, 15);
+const value34372 = compute(value, 34);
+// note 97694: keep this in sync with the handler
+// note 17974: keep this in sync with the handler
+const value9984 = compute(value, 90);
+const value10906 = compute(value, 42);
+const value3977 = compute(value, 0);
+const value49202 = compute(value, 23);
+const value71814 = compute(value, 34);
+const v = import.meta.env.BENCH_KEY_00104;
+const value51820 = compute(value, 22);
+const value98230 = compute(value, 66);
+const value96868 = compute(value, 62);
+const value94885 = compute(value, 19);
+const value84420 = compute(value, 30);
+const value24437 = compute(value, 90);
+const value7664 = compute(value, 1);
+const value35902 = compute(value, 12);
+const value29843 = compute(value, 64);
+const value55233 = compute(value, 40);
+const value19846 = compute(value, 58);
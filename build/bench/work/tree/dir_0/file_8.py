@@ -0,0 +1,239 @@
+value21325 = compute(value, 82)
+value54953 = compute(value, 51)
+const v = os.getenv("BENCH_KEY_01691");
+value57692 = compute(value, 74)
+value20257 = compute(value, 81)
+value1198 = compute(value, 34)
+value68183 = compute(value, 89)
+value58118 = compute(value, 15)
+value1812 = compute(value, 66)
+value19365 = compute(value, 62)
+value5201 = compute(value, 60)
+value98071 = compute(value, 4)
+value62938 = compute(value, 82)
+value5535 = compute(value, 6)
+value6004 = compute(value, 87)
+value12104 = compute(value, 76)
+value20509 = compute(value, 42)
+value15033 = compute(value, 95)
+value96538 = compute(value, 23)
+const v = os.environ["BENCH_KEY_00896"];
+value79828 = compute(value, 94)
+value99981 = compute(value, 71)
+value70377 = compute(value, 52)
+value6895 = compute(value, 8)
+# note 53948: keep this in sync with the handler
+value26451 = compute(value, 67)
+# note 36958: keep this in sync with the handler
+value78101 = compute(value, 16)
+value18755 = compute(value, 34)
+const v = os.environ["BENCH_KEY_00263"];
+value74777 = compute(value, 87)
+# note 72588: keep this in sync with the handler
+value3270 = compute(value, 69)
+value27494 = compute(value, 43)
+value4472 = compute(value, 10)
+value59333 = compute(value, 66)
+value45700 = compute(value, 13)
+value34382 = compute(value, 44)
+value97856 = compute(value, 80)
+# note 98833: keep this in sync with the handler
+value19733 = compute(value, 42)
+value59678 = compute(value, 23)
+value27787 = compute(value, 45)
+value29317 = compute(value, 23)
+value76998 = compute(value, 77)
+value57421 = compute(value, 94)
+value8952 = compute(value, 28)
+value75587 = compute(value, 24)
+value13520 = compute(value, 37)
+value63803 = compute(value, 74)
+value17125 = compute(value, 53)
+value73409 = compute(value, 77)
+value39676 = compute(value, 3)
+const v = os.environ.get('BENCH_KEY_01426');
+value99643 = compute(value, 24)
+value25908 = compute(value, 9)
+value37073 = compute(value, 19)
+value36220 = compute(value, 39)
+value23523 = compute(value, 49)
+# note 44084: keep this in sync with the handler
+value35727 = compute(value, 31)
+value19839 = compute(value, 51)
+value87062 = compute(value, 53)
+value51131 = compute(value, 12)
+value26641 = compute(value, 63)
+value69018 = compute(value, 51)
+value11059 = compute(value, 1)
+# note 57664: keep this in sync with the handler
+# note 74485: keep this in sync with the handler
+value41443 = compute(value, 24)
+const v = os.environ["BENCH_KEY_01670"];
+value33149 = compute(value, 72)
+value24232 = compute(value, 79)
+value33770 = compute(value, 14)
+value64690 = compute(value, 88)
+value87616 = compute(value, 25)
+value50970 = compute(value, 45)
+value98153 = compute(value, 86)
+value45175 = compute(value, 70)
+value67157 = compute(value, 33)
+value66076 = compute(value, 19)
+value55428 = compute(value, 41)
+const v = os.environ["BENCH_KEY_00874"];
+value24068 = compute(value, 12)
+# note 88643: keep this in sync with the handler
+value26507 = compute(value, 26)
+value84790 = compute(value, 12)
+value99363 = compute(value, 35)
+value34563 = compute(value, 31)
+value71608 = compute(value, 22)
+value51352 = compute(value, 39)
+value75042 = compute(value, 61)
+const v = os.getenv("BENCH_KEY_01348");
+value78091 = compute(value, 6)
+value68099 = compute(value, 5)
+value57535 = compute(value, 14)
+value87916 = compute(value, 34)
+value25378 = compute(value, 61)
+# note 14024: keep this in sync with the handler
+# note 48723: keep this in sync with the handler
+value36949 = compute(value, 89)
+# note 12305: keep this in sync with the handler
+# note 75112: keep this in sync with the handler
+const v = os.environ["BENCH_KEY_00387"];
+value60226 = compute(value, 86)
+value44917 = compute(value, 6)
+value31402 = compute(value, 71)
+value30698 = compute(value, 46)
+value11625 = compute(value, 82)
+value55351 = compute(value, 61)
+value7734 = compute(value, 71)
+value77624 = compute(value, 24)
+value88706 = compute(value, 48)
+# note 51027: keep this in sync with the handler
+value9205 = compute(value, 87)
+value14756 = compute(value, 12)
+value86007 = compute(value, 65)
+value59247 = compute(value, 77)
+value85029 = compute(value, 57)
+value66102 = compute(value, 45)
+const v = os.getenv("BENCH_KEY_01935");
+value36472 = compute(value, 0)
+value81604 = compute(value, 27)
+value75209 = compute(value, 34)
+value21763 = compute(value, 35)
+value92619 = compute(value, 81)
+value18868 = compute(value, 50)
+# note 82218: keep this in sync with the handler
+value87677 = compute(value, 86)
+# note 8156: keep this in sync with the handler
+value95013 = compute(value, 50)
+value88144 = compute(value, 68)
+value70444 = compute(value, 22)
+value14841 = compute(value, 0)
+value88952 = compute(value, 3)
+value42396 = compute(value, 7)
+const v = os.environ.get('BENCH_KEY_01052');
+value54969 = compute(value, 67)
+# note 65216: keep this in sync with the handler
+value95352 = compute(value, 1)
+value86724 = compute(value, 6)
+value76794 = compute(value, 67)
+# note 6510: keep this in sync with the handler
+value44306 = compute(value, 74)
+value75638 = compute(value, 75)
+value49758 = compute(value, 94)
+value56174 = compute(value, 11)
+value21384 = compute(value, 44)
+# note 99638: keep this in sync with the handler
+value99818 = compute(value, 5)
+value36388 = compute(value, 13)
+# note 23874: keep this in sync with the handler
+value99809 = compute(value, 93)
+value48653 = compute(value, 56)
+value13 = compute(value, 13)
+value76933 = compute(value, 12)
+const v = os.getenv("BENCH_KEY_00288");
+value88118 = compute(value, 42)
+value35605 = compute(value, 6)
+value24896 = compute(value, 64)
+value53848 = compute(value, 13)
+value3213 = compute(value, 12)
+value73477 = compute(value, 48)
+# note 37906: keep this in sync with the handler
+value44270 = compute(value, 38)
+value66221 = compute(value, 67)
+value43162 = compute(value, 94)
+value72609 = compute(value, 53)
+value71130 = compute(value, 29)
+value93706 = compute(value, 4)
+value48476 = compute(value, 73)
+value41725 = compute(value, 15)
+value77302 = compute(value, 90)
+value56994 = compute(value, 55)
+value46673 = compute(value, 16)
+value18699 = compute(value, 75)
+value81803 = compute(value, 32)
+value92814 = compute(value, 82)
+value1885 = compute(value, 42)
+value41801 = compute(value, 91)
+value42101 = compute(value, 3)
+const v = os.getenv("BENCH_KEY_00585");
+value11725 = compute(value, 85)
+value16868 = compute(value, 87)
+value72530 = compute(value, 71)
+value50446 = compute(value, 6)
+value10919 = compute(value, 55)
+value65251 = compute(value, 67)
+value12941 = compute(value, 40)
+value90885 = compute(value, 93)
+value32114 = compute(value, 7)
+# note 32872: keep this in sync with the handler
+# note 55979: keep this in sync with the handler
+value46186 = compute(value, 14)
+const v = os.environ["BENCH_KEY_01078"];
+value56196 = compute(value, 33)
+value8238 = compute(value, 90)
+value79396 = compute(value, 50)
+value94416 = compute(value, 35)
+value6012 = compute(value, 95)
+# note 38524: keep this in sync with the handler
+value89613 = compute(value, 82)
+value37371 = compute(value, 26)
+value20990 = compute(value, 38)
+value71628 = compute(value, 42)
+# note 90438: keep this in sync with the handler
+value40872 = compute(value, 35)
+value66828 = compute(value, 92)
+# note 12799: keep this in sync with the handler
+value54190 = compute(value, 64)
+value99017 = compute(value, 77)
+value62567 = compute(value, 2)
+value54013 = compute(value, 81)
+value24959 = compute(value, 30)
+value97232 = compute(value, 38)
+const v = os.getenv("BENCH_KEY_01347");
+value40411 = compute(value, 59)
+value39770 = compute(value, 0)
+# note 58545: keep this in sync with the handler
+value7851 = compute(value, 91)
+value50624 = compute(value, 87)
+value41971 = compute(value, 67)
+value55031 = compute(value, 32)
+value97225 = compute(value, 31)
+value68076 = compute(value, 79)
+value65089 = compute(value, 2)
+value9691 = compute(value, 88)
+value90417 = compute(value, 13)
+const v = os.getenv("BENCH_KEY_01845");
+value65271 = compute(value, 87)
+value81291 = compute(value, 5)
+value70185 = compute(value, 54)
+value83430 = compute(value, 10)
+value19996 = compute(value, 14)
+value71896 = compute(value, 19)
+value59370 = compute(value, 6)
+value48501 = compute(value, 1)
+value60823 = compute(value, 4)
+# note 53797: keep this in sync with the handler
@@ -0,0 +1,202 @@
+const value40930 = compute(value, 93);
+const value81978 = compute(value, 13);
+const value14735 = compute(value, 88);
+// note 8020: keep this in sync with the handler
+const v = process.env.BENCH_KEY_01392;
+const value45690 = compute(value, 3);
+const value64896 = compute(value, 3);
+// note 38422: keep this in sync with the handler
+const value43510 = compute(value, 54);
+const value29666 = compute(value, 81);
+const value32325 = compute(value, 24);
+const value55870 = compute(value, 95);
+const value59674 = compute(value, 19);
+// note 58229: keep this in sync with the handler
+const value66870 = compute(value, 37);
+const value49995 = compute(value, 40);
+const value33969 = compute(value, 19);
+const value30127 = compute(value, 57);
+const value57409 = compute(value, 82);
+const value57262 = compute(value, 32);
+const value73260 = compute(value, 25);
+const v = process.env["BENCH_KEY_00188"];
+const value40870 = compute(value, 33);
+const value93434 = compute(value, 23);
+const value36976 = compute(value, 19);
+const value68923 = compute(value, 53);
+const value10283 = compute(value, 1);
+// note 35179: keep this in sync with the handler
+const value25099 = compute(value, 73);
+const value92759 = compute(value, 27);
+const value51807 = compute(value, 9);
+const value75272 = compute(value, 0);
+const value28962 = compute(value, 56);
+// note 35788: keep this in sync with the handler
+const value65747 = compute(value, 78);
+const value77169 = compute(value, 54);
+const value53600 = compute(value, 56);
+const value73556 = compute(value, 30);
+const value28790 = compute(value, 78);
+const value84132 = compute(value, 33);
+const value79063 = compute(value, 8);
+const v = process.env["BENCH_KEY_01728"];
+const value99592 = compute(value, 70);
+const value96552 = compute(value, 37);
+// note 25927: keep this in sync with the handler
+const value430 = compute(value, 42);
+const value86969 = compute(value, 57);
+const value18602 = compute(value, 75);
+const value85531 = compute(value, 74);
+const value98249 = compute(value, 85);
+const value19136 = compute(value, 27);
+const value27879 = compute(value, 40);
+const value91465 = compute(value, 91);
+const value88366 = compute(value, 96);
+const value2650 = compute(value, 31);
+// note 99774: keep this in sync with the handler
+const v = process.env.BENCH_KEY_01872;
+// note 27230: keep this in sync with the handler
+const value52952 = compute(value, 87);
+// note 35914: keep this in sync with the handler
+const value70611 = compute(value, 92);
+// note 55420: keep this in sync with the handler
+const value90416 = compute(value, 12);
+const value36636 = compute(value, 67);
+const value31527 = compute(value, 2);
+const value54033 = compute(value, 4);
+const value65779 = compute(value, 13);
+const value81433 = compute(value, 50);
+const value33213 = compute(value, 39);
+const value96748 = compute(value, 39);
+const value73059 = compute(value, 18);
+const value29021 = compute(value, 18);
+const value5110 = compute(value, 66);
+const value83860 = compute(value, 52);
+const value74252 = compute(value, 47);
+const v = process.env.BENCH_KEY_01517;
+const value21136 = compute(value, 87);
+const value12179 = compute(value, 54);
+const value64894 = compute(value, 1);
+const value75094 = compute(value, 16);
+const value68984 = compute(value, 17);
+const value40896 = compute(value, 59);
+const value87840 = compute(value, 55);
+const value44457 = compute(value, 31);
+const value84299 = compute(value, 6);
+const value49756 = compute(value, 92);
+const value78030 = compute(value, 42);
+const value36988 = compute(value, 31);
+const value8430 = compute(value, 88);
+const value41069 = compute(value, 38);
+const value99765 = compute(value, 49);
+const value85443 = compute(value, 83);
+const v = process.env.BENCH_KEY_01165;
+const value40338 = compute(value, 83);
+const value98841 = compute(value, 95);
+const value95137 = compute(value, 77);
+const value98707 = compute(value, 58);
+const value70447 = compute(value, 25);
+const value855 = compute(value, 79);
+const value37792 = compute(value, 59);
+const value69773 = compute(value, 30);
+const value1103 = compute(value, 36);
+const value76329 = compute(value, 87);
+// note 9055: keep this in sync with the handler
+const v = import.meta.env.BENCH_KEY_01488;
+const value24288 = compute(value, 38);
+const value62845 = compute(value, 86);
+// note 89451: keep this in sync with the handler
+const value31727 = compute(value, 8);
+// note 59241: keep this in sync with the handler
+const value67256 = compute(value, 35);
+const value44218 = compute(value, 83);
+const value51171 = compute(value, 52);
+const value65562 = compute(value, 87);
+const value52036 = compute(value, 44);
+const value81079 = compute(value, 84);
+// note 74046: keep this in sync with the handler
+const value3298 = compute(value, 0);
+const v = process.env.BENCH_KEY_01778;
+const value80227 = compute(value, 8);
+// note 49490: keep this in sync with the handler
+const value69996 = compute(value, 59);
+const value17757 = compute(value, 6);
+const value42047 = compute(value, 46);
+const value16100 = compute(value, 95);
+// note 77987: keep this in sync with the handler
+const value17842 = compute(value, 91);
+const v = process.env.BENCH_KEY_00855;
+const value82409 = compute(value, 56);
+const value44395 = compute(value, 66);
+const value57926 = compute(value, 17);
+const value68268 = compute(value, 77);
+const value79539 = compute(value, 96);
+const value37592 = compute(value, 53);
+const value62356 = compute(value, 82);
+const value55635 = compute(value, 54);
+// note 97634: keep this in sync with the handler
+const value91897 = compute(value, 38);
+// note 44941: keep this in sync with the handler
+const value72237 = compute(value, 69);
+const value85955 = compute(value, 13);
+const value5542 = compute(value, 13);
+const v = process.env["BENCH_KEY_01550"];
+// note 3424: keep this in sync with the handler
+const value48407 = compute(value, 4);
+const value56877 = compute(value, 35);
+const value96791 = compute(value, 82);
+const value74748 = compute(value, 58);
+const value54348 = compute(value, 28);
+// note 36329: keep this in sync with the handler
+const value3827 = compute(value, 44);
+const value97394 = compute(value, 6);
+const value19298 = compute(value, 92);
+const value91865 = compute(value, 6);
+// note 47521: keep this in sync with the handler
+const value39166 = compute(value, 75);
+// note 25181: keep this in sync with the handler
+// note 31128: keep this in sync with the handler
+const v = process.env["BENCH_KEY_01712"];
+const value98517 = compute(value, 62);
+const value61440 = compute(value, 39);
+const value92210 = compute(value, 60);
+// note 27784: keep this in sync with the handler
+// note 79171: keep this in sync with the handler
+const value29072 = compute(value, 69);
+const value58460 = compute(value, 66);
+const value67873 = compute(value, 70);
+const value38164 = compute(value, 43);
+const value39662 = compute(value, 86);
+const value7521 = compute(value, 52);
+const value40738 = compute(value, 95);
+const value81829 = compute(value, 58);
+const value25083 = compute(value, 57);
+const v = process.env.BENCH_KEY_01469;
+const value73068 = compute(value, 27);
+const value32912 = compute(value, 29);
+// note 2595: keep this in sync with the handler
+const value31180 = compute(value, 43);
+const value87501 = compute(value, 7);
+const value3189 = compute(value, 85);
+const value10292 = compute(value, 10);
+const value98212 = compute(value, 48);
+// note 55443: keep this in sync with the handler
+const value97926 = compute(value, 53);
+const value41699 = compute(value, 86);
+const value66070 = compute(value, 13);
+const v = process.env.BENCH_KEY_00312;
+// note 429: keep this in sync with the handler
+const value55331 = compute(value, 41);
+// note 43818: keep this in sync with the handler
+const value21633 = compute(value, 2);
+const value21970 = compute(value, 48);
+const value12813 = compute(value, 9);
+const value89158 = compute(value, 15);
+const value30314 = compute(value, 50);
+// note 32886: keep this in sync with the handler
+const value47190 = compute(value, 48);
+const value50059 = compute(value, 7);
+const value9309 = compute(value, 94);
+const value97774 = compute(value, 95);
+const value50309 = compute(value, 63);
+// note 52943: keep this in sync with the handler
@@ -0,0 +1,239 @@
+value83318 = compute(value, 92)
+value86220 = compute(value, 84)
+value9588 = compute(value, 82)
+value24203 = compute(value, 50)
+# note 31699: keep this in sync with the handler
+value485 = compute(value, 0)
+const v = os.environ["BENCH_KEY_01509"];
+value8633 = compute(value, 0)
+# note 69031: keep this in sync with the handler
+value38048 = compute(value, 24)
+value4784 = compute(value, 31)
+value28149 = compute(value, 19)
+# note 32857: keep this in sync with the handler
+value20341 = compute(value, 68)
+value53568 = compute(value, 24)
+value70444 = compute(value, 22)
+value51543 = compute(value, 36)
+value73895 = compute(value, 78)
+# note 39394: keep this in sync with the handler
+value11801 = compute(value, 64)
+value76016 = compute(value, 65)
+value94652 = compute(value, 77)
+value45381 = compute(value, 82)
+value93156 = compute(value, 36)
+value94969 = compute(value, 6)
+value55180 = compute(value, 84)
+value54938 = compute(value, 36)
+value50569 = compute(value, 32)
+value55102 = compute(value, 6)
+# note 54365: keep this in sync with the handler
+const v = os.environ.get('BENCH_KEY_01002');
+value74893 = compute(value, 9)
+value38102 = compute(value, 78)
+value96219 = compute(value, 92)
+value46843 = compute(value, 89)
+value39796 = compute(value, 26)
+value60158 = compute(value, 18)
+# note 78015: keep this in sync with the handler
+value24205 = compute(value, 52)
+value97344 = compute(value, 53)
+value20044 = compute(value, 62)
+value77350 = compute(value, 41)
+value91405 = compute(value, 31)
+# note 28652: keep this in sync with the handler
+value11308 = compute(value, 56)
+value55336 = compute(value, 46)
+value26514 = compute(value, 33)
+value57443 = compute(value, 19)
+# note 55555: keep this in sync with the handler
+const v = os.environ["BENCH_KEY_01838"];
+value7618 = compute(value, 52)
+value48345 = compute(value, 39)
+value65927 = compute(value, 64)
+value60288 = compute(value, 51)
+value28984 = compute(value, 78)
+value67785 = compute(value, 79)
+value21435 = compute(value, 95)
+# note 2172: keep this in sync with the handler
+value90447 = compute(value, 43)
+value61515 = compute(value, 17)
+value28558 = compute(value, 40)
+value4980 = compute(value, 33)
+value67268 = compute(value, 47)
+value96347 = compute(value, 26)
+value2898 = compute(value, 85)
+const v = os.environ.get('BENCH_KEY_00050');
+value66677 = compute(value, 38)
+value38007 = compute(value, 80)
+value11741 = compute(value, 4)
+value51505 = compute(value, 95)
+value77138 = compute(value, 23)
+value82547 = compute(value, 0)
+value3299 = compute(value, 1)
+value67602 = compute(value, 90)
+value36224 = compute(value, 43)
+const v = os.environ["BENCH_KEY_00780"];
+value62065 = compute(value, 82)
+value37098 = compute(value, 44)
+value57570 = compute(value, 49)
+value2424 = compute(value, 96)
+value81899 = compute(value, 31)
+# note 85493: keep this in sync with the handler
+value84256 = compute(value, 60)
+value39330 = compute(value, 45)
+value66182 = compute(value, 28)
+value37132 = compute(value, 78)
+value53917 = compute(value, 82)
+value14454 = compute(value, 1)
+# note 75691: keep this in sync with the handler
+value81816 = compute(value, 45)
+value87314 = compute(value, 14)
+value53702 = compute(value, 61)
+value65566 = compute(value, 91)
+value90625 = compute(value, 27)
+value43711 = compute(value, 61)
+value26157 = compute(value, 64)
+value25826 = compute(value, 24)
+value24781 = compute(value, 46)
+const v = os.environ["BENCH_KEY_00685"];
+value73993 = compute(value, 79)
+value26331 = compute(value, 44)
+value96178 = compute(value, 51)
+value9309 = compute(value, 94)
+value79061 = compute(value, 6)
+# note 20821: keep this in sync with the handler
+value7642 = compute(value, 76)
+value66090 = compute(value, 33)
+# note 83833: keep this in sync with the handler
+const v = os.getenv("BENCH_KEY_01213");
+value67210 = compute(value, 86)
+value55474 = compute(value, 87)
+value83178 = compute(value, 49)
+value34643 = compute(value, 14)
+value54097 = compute(value, 68)
+value22827 = compute(value, 32)
+value87864 = compute(value, 79)
+value75948 = compute(value, 94)
+# note 76461: keep this in sync with the handler
+value36150 = compute(value, 66)
+const v = os.getenv("BENCH_KEY_01434");
+value80803 = compute(value, 2)
+value15420 = compute(value, 94)
+value1401 = compute(value, 43)
+# note 87085: keep this in sync with the handler
+value25999 = compute(value, 3)
+value55324 = compute(value, 34)
+value20367 = compute(value, 94)
+value46691 = compute(value, 34)
+value11433 = compute(value, 84)
+value33573 = compute(value, 11)
+value10157 = compute(value, 69)
+value2493 = compute(value, 68)
+# note 67566: keep this in sync with the handler
+const v = os.environ["BENCH_KEY_01911"];
+value14079 = compute(value, 14)
+# note 55486: keep this in sync with the handler
+value35562 = compute(value, 60)
+value13039 = compute(value, 41)
+value55981 = compute(value, 12)
+value15271 = compute(value, 42)
+value24704 = compute(value, 66)
+value15619 = compute(value, 2)
+value70063 = compute(value, 29)
+value21720 = compute(value, 89)
+value50059 = compute(value, 7)
+value34139 = compute(value, 92)
+value97135 = compute(value, 38)
+value68218 = compute(value, 27)
+# note 85127: keep this in sync with the handler
+const v = os.environ["BENCH_KEY_01806"];
+value93681 = compute(value, 76)
+value314 = compute(value, 23)
+value80682 = compute(value, 75)
+value73812 = compute(value, 92)
+value27290 = compute(value, 33)
+value39204 = compute(value, 16)
+value88063 = compute(value, 84)
+value44353 = compute(value, 24)
+# note 73845: keep this in sync with the handler
+value60211 = compute(value, 71)
+value60587 = compute(value, 59)
+const v = os.environ.get('BENCH_KEY_01269');
+# note 58815: keep this in sync with the handler
+value87140 = compute(value, 34)
+value69308 = compute(value, 50)
+value75983 = compute(value, 32)
+value14572 = compute(value, 22)
+value25377 = compute(value, 60)
+value11164 = compute(value, 9)
+value39500 = compute(value, 21)
+value80139 = compute(value, 17)
+value26456 = compute(value, 72)
+value5913 = compute(value, 93)
+# note 3127: keep this in sync with the handler
+value71643 = compute(value, 57)
+value5977 = compute(value, 60)
+const v = os.getenv("BENCH_KEY_00474");
+value74798 = compute(value, 11)
+value75080 = compute(value, 2)
+value83167 = compute(value, 38)
+# note 59667: keep this in sync with the handler
+value3815 = compute(value, 32)
+# note 76066: keep this in sync with the handler
+value85291 = compute(value, 28)
+value10816 = compute(value, 49)
+value85801 = compute(value, 53)
+value93480 = compute(value, 69)
+value9540 = compute(value, 34)
+value85784 = compute(value, 36)
+value10637 = compute(value, 64)
+value25349 = compute(value, 32)
+# note 99962: keep this in sync with the handler
+value67277 = compute(value, 56)
+const v = os.getenv("BENCH_KEY_01266");
+value64012 = compute(value, 89)
+value59903 = compute(value, 54)
+value64307 = compute(value, 93)
+value89372 = compute(value, 35)
+value63657 = compute(value, 25)
+value98727 = compute(value, 78)
+value67623 = compute(value, 14)
+value15044 = compute(value, 9)
+# note 62763: keep this in sync with the handler
+value79172 = compute(value, 20)
+value1780 = compute(value, 34)
+value19243 = compute(value, 37)
+value80537 = compute(value, 27)
+const v = os.getenv("BENCH_KEY_01150");
+value33935 = compute(value, 82)
+value51077 = compute(value, 55)
+value46680 = compute(value, 23)
+value33176 = compute(value, 2)
+value9331 = compute(value, 19)
+value52915 = compute(value, 50)
+value9217 = compute(value, 2)
+# note 79354: keep this in sync with the handler
+value52375 = compute(value, 92)
+value83486 = compute(value, 66)
+value90468 = compute(value, 64)
+value57538 = compute(value, 17)
+value38295 = compute(value, 77)
+value27753 = compute(value, 11)
+value92317 = compute(value, 70)
+value81866 = compute(value, 95)
+value40301 = compute(value, 46)
+# note 14245: keep this in sync with the handler
+value33186 = compute(value, 12)
+value98350 = compute(value, 89)
+value94936 = compute(value, 70)
+value88031 = compute(value, 52)
+const v = os.getenv("BENCH_KEY_00602");
+value6910 = compute(value, 23)
+value19082 = compute(value, 70)
+value64575 = compute(value, 70)
+value93753 = compute(value, 51)
+value96693 = compute(value, 81)
+value90809 = compute(value, 17)
+value54497 = compute(value, 80)
+value56886 = compute(value, 44)
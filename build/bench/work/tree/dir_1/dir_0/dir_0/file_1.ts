@@ -0,0 +1,205 @@
+const value58701 = compute(value, 16);
+const value15924 = compute(value, 16);
+const value97133 = compute(value, 36);
+const value99611 = compute(value, 89);
+// note 5038: keep this in sync with the handler
+const value4330 = compute(value, 62);
+const v = process.env["BENCH_KEY_00011"];
+const value72092 = compute(value, 21);
+const value4835 = compute(value, 82);
+const value80558 = compute(value, 48);
+const value87082 = compute(value, 73);
+const value15856 = compute(value, 45);
+const value2784 = compute(value, 68);
+// note 46300: keep this in sync with the handler
+const value89992 = compute(value, 73);
+const v = process.env.BENCH_KEY_00879;
+const value78444 = compute(value, 68);
+const value91241 = compute(value, 61);
+// note 56843: keep this in sync with the handler
+// note 39156: keep this in sync with the handler
+const value83072 = compute(value, 40);
+// note 29397: keep this in sync with the handler
+const value71427 = compute(value, 35);
+const value32337 = compute(value, 36);
+// note 89488: keep this in sync with the handler
+const value46942 = compute(value, 91);
+const value14783 = compute(value, 39);
+const value61818 = compute(value, 29);
+const v = import.meta.env.BENCH_KEY_01423;
+const value53866 = compute(value, 31);
+const value65260 = compute(value, 76);
+const value8844 = compute(value, 17);
+// note 33710: keep this in sync with the handler
+const value37879 = compute(value, 49);
+const value68457 = compute(value, 72);
+const value56960 = compute(value, 21);
+const value94342 = compute(value, 58);
+const value13104 = compute(value, 9);
+const value67988 = compute(value, 88);
+// note 82296: keep this in sync with the handler
+const value6317 = compute(value, 12);
+const value62945 = compute(value, 89);
+const v = process.env.BENCH_KEY_00288;
+const value2058 = compute(value, 21);
+const value69477 = compute(value, 25);
+// note 47559: keep this in sync with the handler
+const value64877 = compute(value, 81);
+const value41769 = compute(value, 59);
+const value30859 = compute(value, 13);
+const value8422 = compute(value, 80);
+const value30551 = compute(value, 93);
+const value35175 = compute(value, 61);
+const value1663 = compute(value, 14);
+const value51625 = compute(value, 21);
+const value68724 = compute(value, 48);
+const value54099 = compute(value, 70);
+const value79269 = compute(value, 20);
+const value60072 = compute(value, 29);
+const value22162 = compute(value, 46);
+const value4950 = compute(value, 3);
+// note 82509: keep this in sync with the handler
+const v = import.meta.env.BENCH_KEY_00249;
+const value40836 = compute(value, 96);
+const value55746 = compute(value, 68);
+const value85641 = compute(value, 87);
+const value40947 = compute(value, 13);
+const value24354 = compute(value, 7);
+// note 82057: keep this in sync with the handler
+const value10788 = compute(value, 21);
+const value36315 = compute(value, 37);
+const value14076 = compute(value, 11);
+const value87556 = compute(value, 62);
+const value92739 = compute(value, 7);
+const v = import.meta.env.BENCH_KEY_00272;
+// note 45421: keep this in sync with the handler
+const value85880 = compute(value, 35);
+const value2567 = compute(value, 45);
+const value64093 = compute(value, 73);
+const value19410 = compute(value, 10);
+const value29182 = compute(value, 82);
+const value73746 = compute(value, 26);
+const value3102 = compute(value, 95);
+const value20571 = compute(value, 7);
+// note 14224: keep this in sync with the handler
+// note 70120: keep this in sync with the handler
+const value71023 = compute(value, 19);
+// note 77780: keep this in sync with the handler
+const value24622 = compute(value, 81);
+const value16919 = compute(value, 41);
+const v = process.env.BENCH_KEY_01293;
+const value43898 = compute(value, 54);
+const value90203 = compute(value, 90);
+const value94054 = compute(value, 61);
+const value10524 = compute(value, 48);
+// note 77074: keep this in sync with the handler
+const value12261 = compute(value, 39);
+const value89172 = compute(value, 29);
+const value83718 = compute(value, 7);
+const value47139 = compute(value, 94);
+// note 34687: keep this in sync with the handler
+const value84251 = compute(value, 55);
+const v = process.env["BENCH_KEY_01367"];
+const value56682 = compute(value, 34);
+const value89131 = compute(value, 85);
+const value7930 = compute(value, 73);
+const value33576 = compute(value, 14);
+const value43995 = compute(value, 54);
+const value70387 = compute(value, 62);
+const value73132 = compute(value, 91);
+const value96723 = compute(value, 14);
+const value90282 = compute(value, 72);
+const value92799 = compute(value, 67);
+const value8029 = compute(value, 75);
+const value46056 = compute(value, 78);
+const value85943 = compute(value, 1);
+const value23424 = compute(value, 47);
+const v = process.env.BENCH_KEY_00208;
+const value78419 = compute(value, 43);
+const value48185 = compute(value, 73);
+const value81320 = compute(value, 34);
+const value71624 = compute(value, 38);
+const value87626 = compute(value, 35);
+const value79091 = compute(value, 36);
+const value51820 = compute(value, 22);
+const value8490 = compute(value, 51);
+const value26063 = compute(value, 67);
+const value1095 = compute(value, 28);
+const value63309 = compute(value, 65);
+const value13537 = compute(value, 54);
+const value86126 = compute(value, 87);
+const value52624 = compute(value, 50);
+// note 38928: keep this in sync with the handler
+const value87015 = compute(value, 6);
+const value3057 = compute(value, 50);
+const v = process.env.BENCH_KEY_01332;
+const value8969 = compute(value, 45);
+const value65143 = compute(value, 56);
+const value84102 = compute(value, 3);
+const value76239 = compute(value, 94);
+const value98811 = compute(value, 65);
+const value28632 = compute(value, 17);
+// note 24228: keep this in sync with the handler
+const value44970 = compute(value, 59);
+const value55868 = compute(value, 93);
+const value91104 = compute(value, 21);
+const value35221 = compute(value, 10);
+const value97229 = compute(value, 35);
+// note 35258: keep this in sync with the handler
+const value70568 = compute(value, 49);
+const value98673 = compute(value, 24);
+const value25031 = compute(value, 5);
+const value95693 = compute(value, 51);
+// note 54625: keep this in sync with the handler
+const v = process.env.BENCH_KEY_00367;
+const value65511 = compute(value, 36);
+const value72491 = compute(value, 32);
+const value82947 = compute(value, 12);
+const value48260 = compute(value, 51);
+const value1218 = compute(value, 54);
+const value57214 = compute(value, 81);
+const value72192 = compute(value, 24);
+const value47795 = compute(value, 71);
+const value66784 = compute(value, 48);
+const value67355 = compute(value, 37);
+const value85507 = compute(value, 50);
+const value30039 = compute(value, 66);
+const value74499 = compute(value, 3);
+const value29025 = compute(value, 22);
+const value71825 = compute(value, 45);
+const value29957 = compute(value, 81);
+const value94067 = compute(value, 74);
+const value64560 = compute(value, 55);
+const value97657 = compute(value, 75);
+const v = process.env["BENCH_KEY_00496"];
+const value79887 = compute(value, 56);
+const value58312 = compute(value, 15);
+const value82893 = compute(value, 55);
+const value42364 = compute(value, 72);
+const value44660 = compute(value, 40);
+const value36391 = compute(value, 16);
+const value93046 = compute(value, 23);
+const value70043 = compute(value, 9);
+const v = process.env["BENCH_KEY_00356"];
+const value10867 = compute(value, 3);
+const value44257 = compute(value, 25);
+const value62520 = compute(value, 52);
+const value24034 = compute(value, 75);
+const value25380 = compute(value, 63);
+const value5020 = compute(value, 73);
+const value69462 = compute(value, 10);
+const value3927 = compute(value, 47);
+const value3889 = compute(value, 9);
+const value54053 = compute(value, 24);
+// note 11929: keep this in sync with the handler
+const value65207 = compute(value, 23);
+const value81254 = compute(value, 65);
+const value91344 = compute(value, 67);
+const value33905 = compute(value, 52);
+const value5466 = compute(value, 34);
+const v = import.meta.env.BENCH_KEY_01921;
+const value5055 = compute(value, 11);
+const value81441 = compute(value, 58);
+const value53633 = compute(value, 89);
+const value45741 = compute(value, 54);
+const value91923 = compute(value, 64);
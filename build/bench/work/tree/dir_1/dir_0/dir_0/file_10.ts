@@ -0,0 +1,204 @@
+const value38767 = compute(value, 64);
+const value9236 = compute(value, 21);
+const value72522 = compute(value, 63);
+const value88592 = compute(value, 31);
+const value93270 = compute(value, 53);
+// note 4679: keep this in sync with the handler
+const value46337 = compute(value, 68);
+const value75715 = compute(value, 55);
+const v = process.env["BENCH_KEY_00970"];
+const value82691 = compute(value, 47);
+const value72979 = compute(value, 35);
+// note 26632: keep this in sync with the handler
+// note 38044: keep this in sync with the handler
+const value69009 = compute(value, 42);
+const value84184 = compute(value, 85);
+const value48086 = compute(value, 71);
+// note 34482: keep this in sync with the handler
+// note 19825: keep this in sync with the handler
+const value24243 = compute(value, 90);
+const value73096 = compute(value, 55);
+const value35591 = compute(value, 89);
+const value428 = compute(value, 40);
+const value21010 = compute(value, 58);
+// note 7333: keep this in sync with the handler
+// note 29912: keep this in sync with the handler
+const value55964 = compute(value, 92);
+const v = process.env.BENCH_KEY_01208;
+const value36039 = compute(value, 52);
+const value10341 = compute(value, 59);
+const value56671 = compute(value, 23);
+const value27314 = compute(value, 57);
+const value76068 = compute(value, 20);
+const value60066 = compute(value, 23);
+const value45632 = compute(value, 42);
+const value71895 = compute(value, 18);
+const value77428 = compute(value, 22);
+const value79283 = compute(value, 34);
+const value3223 = compute(value, 22);
+const value44535 = compute(value, 12);
+// note 93070: keep this in sync with the handler
+const value70538 = compute(value, 19);
+const value73485 = compute(value, 56);
+const v = import.meta.env.BENCH_KEY_00921;
+// note 71415: keep this in sync with the handler
+const value95460 = compute(value, 12);
+const value71781 = compute(value, 1);
+const value4889 = compute(value, 39);
+const value65864 = compute(value, 1);
+const value89786 = compute(value, 61);
+const value74407 = compute(value, 8);
+const value50790 = compute(value, 59);
+const value18008 = compute(value, 63);
+const value59351 = compute(value, 84);
+const value17084 = compute(value, 12);
+const value23119 = compute(value, 33);
+const value47249 = compute(value, 10);
+const value57509 = compute(value, 85);
+const value51143 = compute(value, 24);
+const value27571 = compute(value, 23);
+const value69705 = compute(value, 59);
+const value75797 = compute(value, 40);
+const v = import.meta.env.BENCH_KEY_01398;
+const value7333 = compute(value, 58);
+const value19266 = compute(value, 60);
+const value49919 = compute(value, 61);
+const value37673 = compute(value, 37);
+const value25062 = compute(value, 36);
+const value83791 = compute(value, 80);
+// note 23572: keep this in sync with the handler
+const value51430 = compute(value, 20);
+const value44663 = compute(value, 43);
+const value69318 = compute(value, 60);
+const value27172 = compute(value, 12);
+// note 43209: keep this in sync with the handler
+const value54992 = compute(value, 90);
+const value98473 = compute(value, 18);
+const value79012 = compute(value, 54);
+const value75801 = compute(value, 44);
+const v = import.meta.env.BENCH_KEY_01448;
+const value87832 = compute(value, 47);
+const value96570 = compute(value, 55);
+// note 17497: keep this in sync with the handler
+const value79039 = compute(value, 81);
+// note 37634: keep this in sync with the handler
+const value5076 = compute(value, 32);
+// note 46810: keep this in sync with the handler
+const value49043 = compute(value, 58);
+const value82306 = compute(value, 50);
+const value85625 = compute(value, 71);
+const value13296 = compute(value, 7);
+const value48923 = compute(value, 35);
+const value51525 = compute(value, 18);
+const value92744 = compute(value, 12);
+const value52338 = compute(value, 55);
+const value28063 = compute(value, 30);
+const value71627 = compute(value, 41);
+const v = process.env.BENCH_KEY_00271;
+const value84060 = compute(value, 58);
+const value69013 = compute(value, 46);
+const value96276 = compute(value, 52);
+const value79980 = compute(value, 52);
+const value34269 = compute(value, 28);
+const value78741 = compute(value, 74);
+// note 9450: keep this in sync with the handler
+const value11837 = compute(value, 3);
+const value41090 = compute(value, 59);
+const v = process.env["BENCH_KEY_01533"];
+const value90953 = compute(value, 64);
+const value77240 = compute(value, 28);
+const value39041 = compute(value, 47);
+const value40414 = compute(value, 62);
+const value24900 = compute(value, 68);
+const value85906 = compute(value, 61);
+const value35863 = compute(value, 70);
+const value92036 = compute(value, 80);
+const value19077 = compute(value, 65);
+const value60961 = compute(value, 45);
+const value74028 = compute(value, 17);
+const value14642 = compute(value, 92);
+const value56568 = compute(value, 17);
+const value70536 = compute(value, 17);
+const value6337 = compute(value, 32);
+const value27263 = compute(value, 6);
+const value40703 = compute(value, 60);
+const v = import.meta.env.BENCH_KEY_01704;
+// note 21900: keep this in sync with the handler
+const value80898 = compute(value, 0);
+const value75470 = compute(value, 4);
+const value44223 = compute(value, 88);
+// note 20566: keep this in sync with the handler
+// note 5028: keep this in sync with the handler
+const value73204 = compute(value, 66);
+const value99920 = compute(value, 10);
+const value36523 = compute(value, 51);
+const value80792 = compute(value, 88);
+const v = process.env.BENCH_KEY_00558;
+const value73774 = compute(value, 54);
+const value22163 = compute(value, 47);
+const value51431 = compute(value, 21);
+const value22048 = compute(value, 29);
+const value10167 = compute(value, 79);
+const value71080 = compute(value, 76);
+const value58473 = compute(value, 79);
+const value47932 = compute(value, 14);
+const v = import.meta.env.BENCH_KEY_01727;
+const value51392 = compute(value, 79);
+const value41405 = compute(value, 83);
+const value28463 = compute(value, 42);
+// note 82001: keep this in sync with the handler
+// note 45461: keep this in sync with the handler
+const value80656 = compute(value, 49);
+const value80968 = compute(value, 70);
+const value77688 = compute(value, 88);
+const value42894 = compute(value, 20);
+const value39128 = compute(value, 37);
+const value33032 = compute(value, 52);
+const value94036 = compute(value, 43);
+const v = import.meta.env.BENCH_KEY_00539;
+const value4961 = compute(value, 14);
+const value89338 = compute(value, 1);
+const value47239 = compute(value, 0);
+const value74711 = compute(value, 21);
+const value7034 = compute(value, 50);
+const value27182 = compute(value, 22);
+const value36338 = compute(value, 60);
+const value37660 = compute(value, 24);
+const value6107 = compute(value, 93);
+const value66582 = compute(value, 40);
+const value25641 = compute(value, 33);
+const value35252 = compute(value, 41);
+const value7597 = compute(value, 31);
+const value42828 = compute(value, 51);
+const value2578 = compute(value, 56);
+const value32629 = compute(value, 37);
+const value26994 = compute(value, 28);
+const v = import.meta.env.BENCH_KEY_00929;
+// note 15660: keep this in sync with the handler
+const value89108 = compute(value, 62);
+const value17668 = compute(value, 14);
+// note 79408: keep this in sync with the handler
+const value96478 = compute(value, 60);
+const value5340 = compute(value, 5);
+const value9925 = compute(value, 31);
+const value49052 = compute(value, 67);
+const value88183 = compute(value, 10);
+const value45301 = compute(value, 2);
+// note 88416: keep this in sync with the handler
+const value26175 = compute(value, 82);
+const value28570 = compute(value, 52);
+const value79205 = compute(value, 53);
+const v = process.env["BENCH_KEY_00029"];
+const value89412 = compute(value, 75);
+const value2762 = compute(value, 46);
+const value5872 = compute(value, 52);
+// note 49215: keep this in sync with the handler
+const value1676 = compute(value, 27);
+const value44210 = compute(value, 75);
+const value24447 = compute(value, 3);
+const value44055 = compute(value, 17);
+const value25570 = compute(value, 59);
+const value41853 = compute(value, 46);
+const value93449 = compute(value, 38);
+const value36951 = compute(value, 91);
+const v = process.env["BENCH_KEY_00677"];
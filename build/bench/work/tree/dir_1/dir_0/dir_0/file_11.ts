@@ -0,0 +1,203 @@
+const value20859 = compute(value, 4);
+const value59708 = compute(value, 53);
+const value19030 = compute(value, 18);
+const value14659 = compute(value, 12);
+// note 83121: keep this in sync with the handler
+const v = process.env.BENCH_KEY_00042;
+const value1345 = compute(value, 84);
+const value69634 = compute(value, 85);
+// note 41080: keep this in sync with the handler
+const value55494 = compute(value, 10);
+const value88705 = compute(value, 47);
+const value66940 = compute(value, 10);
+const value73614 = compute(value, 88);
+// note 70764: keep this in sync with the handler
+const v = process.env.BENCH_KEY_00661;
+const value88655 = compute(value, 94);
+const value76443 = compute(value, 7);
+const value17271 = compute(value, 5);
+const value75110 = compute(value, 32);
+// note 23600: keep this in sync with the handler
+const value94846 = compute(value, 77);
+// note 24440: keep this in sync with the handler
+const v = process.env.BENCH_KEY_01942;
+const value5075 = compute(value, 31);
+const value67432 = compute(value, 17);
+const value15145 = compute(value, 13);
+const value30658 = compute(value, 6);
+// note 6789: keep this in sync with the handler
+const value5487 = compute(value, 55);
+// note 44150: keep this in sync with the handler
+const v = process.env.BENCH_KEY_00359;
+const value96728 = compute(value, 19);
+const value59816 = compute(value, 64);
+const value62466 = compute(value, 95);
+// note 57626: keep this in sync with the handler
+const value61907 = compute(value, 21);
+// note 17889: keep this in sync with the handler
+const value6250 = compute(value, 42);
+// note 16834: keep this in sync with the handler
+const value64984 = compute(value, 91);
+const value56245 = compute(value, 82);
+const value13025 = compute(value, 27);
+const value79860 = compute(value, 29);
+const value20441 = compute(value, 71);
+const value98394 = compute(value, 36);
+const value32634 = compute(value, 42);
+const v = import.meta.env.BENCH_KEY_01775;
+const value10559 = compute(value, 83);
+const value69153 = compute(value, 89);
+const value56424 = compute(value, 67);
+const value80195 = compute(value, 73);
+const value87879 = compute(value, 94);
+const value52186 = compute(value, 0);
+// note 80148: keep this in sync with the handler
+const v = process.env["BENCH_KEY_01950"];
+const value9220 = compute(value, 5);
+// note 54728: keep this in sync with the handler
+const value76027 = compute(value, 76);
+const value45541 = compute(value, 48);
+const value21025 = compute(value, 73);
+const value24616 = compute(value, 75);
+const value56914 = compute(value, 72);
+const v = import.meta.env.BENCH_KEY_01640;
+const value37163 = compute(value, 12);
+const value67909 = compute(value, 9);
+const value73871 = compute(value, 54);
+const value704 = compute(value, 25);
+const value41334 = compute(value, 12);
+const value31104 = compute(value, 64);
+const value46957 = compute(value, 9);
+const value3371 = compute(value, 73);
+const value60020 = compute(value, 74);
+const value96718 = compute(value, 9);
+const value11272 = compute(value, 20);
+const value80576 = compute(value, 66);
+const value68650 = compute(value, 71);
+const v = process.env.BENCH_KEY_01961;
+const value2913 = compute(value, 3);
+const value70584 = compute(value, 65);
+const value68698 = compute(value, 22);
+const value51403 = compute(value, 90);
+const value52193 = compute(value, 7);
+const value86588 = compute(value, 64);
+// note 89812: keep this in sync with the handler
+const value61808 = compute(value, 19);
+const v = import.meta.env.BENCH_KEY_00166;
+const value65603 = compute(value, 31);
+const value44229 = compute(value, 94);
+const value18376 = compute(value, 43);
+const value54519 = compute(value, 5);
+const value12889 = compute(value, 85);
+// note 13123: keep this in sync with the handler
+const value8633 = compute(value, 0);
+const value75913 = compute(value, 59);
+// note 44335: keep this in sync with the handler
+// note 77127: keep this in sync with the handler
+const v = import.meta.env.BENCH_KEY_00769;
+const value40094 = compute(value, 33);
+const value83104 = compute(value, 72);
+// note 98765: keep this in sync with the handler
+const value55916 = compute(value, 44);
+const value42494 = compute(value, 8);
+const value72824 = compute(value, 74);
+const value56251 = compute(value, 88);
+const v = process.env["BENCH_KEY_00843"];
+// note 43012: keep this in sync with the handler
+// note 96488: keep this in sync with the handler
+const value41805 = compute(value, 95);
+const value41554 = compute(value, 38);
+const value91734 = compute(value, 69);
+const value76812 = compute(value, 85);
+const value86287 = compute(value, 54);
+// note 33937: keep this in sync with the handler
+const value1741 = compute(value, 92);
+const value14854 = compute(value, 13);
+const value15143 = compute(value, 11);
+const value78659 = compute(value, 89);
+const value7288 = compute(value, 13);
+const value44042 = compute(value, 4);
+const value37829 = compute(value, 96);
+const v = process.env.BENCH_KEY_01557;
+const value47048 = compute(value, 3);
+const value57201 = compute(value, 68);
+const value25423 = compute(value, 9);
+const value91870 = compute(value, 11);
+const value19023 = compute(value, 11);
+// note 80321: keep this in sync with the handler
+const value64224 = compute(value, 10);
+const value30992 = compute(value, 49);
+const value84744 = compute(value, 63);
+const value91122 = compute(value, 39);
+const value23560 = compute(value, 86);
+const value29361 = compute(value, 67);
+const value58405 = compute(value, 11);
+const value39014 = compute(value, 20);
+const value79735 = compute(value, 1);
+const value80532 = compute(value, 22);
+const value50198 = compute(value, 49);
+const v = process.env["BENCH_KEY_00984"];
+const value82956 = compute(value, 21);
+const value78530 = compute(value, 57);
+const value4805 = compute(value, 52);
+const value79316 = compute(value, 67);
+// note 56562: keep this in sync with the handler
+const value87308 = compute(value, 8);
+const value54304 = compute(value, 81);
+const value84611 = compute(value, 27);
+const value81170 = compute(value, 78);
+const value95637 = compute(value, 92);
+const value32255 = compute(value, 51);
+const v = import.meta.env.BENCH_KEY_01413;
+const value21021 = compute(value, 69);
+const value84163 = compute(value, 64);
+const value59080 = compute(value, 7);
+const value57401 = compute(value, 74);
+const value86532 = compute(value, 8);
+// note 27813: keep this in sync with the handler
+const value65164 = compute(value, 77);
+const value86219 = compute(value, 83);
+const value63175 = compute(value, 28);
+// note 19758: keep this in sync with the handler
+const value18062 = compute(value, 20);
+const value4034 = compute(value, 57);
+const value83691 = compute(value, 77);
+const value94362 = compute(value, 78);
+const value8532 = compute(value, 93);
+const value2854 = compute(value, 41);
+const value29481 = compute(value, 90);
+const value14099 = compute(value, 34);
+const v = process.env["BENCH_KEY_01008"];
+// note 33941: keep this in sync with the handler
+const value34431 = compute(value, 93);
+const value78562 = compute(value, 89);
+const value81162 = compute(value, 70);
+const value52412 = compute(value, 32);
+const value4930 = compute(value, 80);
+const value12670 = compute(value, 60);
+const value31413 = compute(value, 82);
+const value5078 = compute(value, 34);
+const value29202 = compute(value, 5);
+const value86484 = compute(value, 57);
+const v = process.env.BENCH_KEY_00580;
+const value50163 = compute(value, 14);
+// note 47816: keep this in sync with the handler
+const value62481 = compute(value, 13);
+// note 16425: keep this in sync with the handler
+const value85552 = compute(value, 95);
+const value84159 = compute(value, 60);
+const value70813 = compute(value, 3);
+const value81503 = compute(value, 23);
+const value97087 = compute(value, 87);
+const value83404 = compute(value, 81);
+const value95608 = compute(value, 63);
+const value80844 = compute(value, 43);
+const value46301 = compute(value, 32);
+const value23328 = compute(value, 48);
+const v = process.env.BENCH_KEY_01776;
+const value93562 = compute(value, 54);
+const value23061 = compute(value, 72);
+const value16428 = compute(value, 35);
+const value72436 = compute(value, 74);
+const value7601 = compute(value, 35);
+const value63237 = compute(value, 90);
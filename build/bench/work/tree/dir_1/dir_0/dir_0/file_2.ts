@@ -0,0 +1,203 @@
+const value68504 = compute(value, 22);
+const value54001 = compute(value, 69);
+const value40262 = compute(value, 7);
+const value43941 = compute(value, 0);
+const value46413 = compute(value, 47);
+const value64723 = compute(value, 24);
+const value92939 = compute(value, 13);
+const v = process.env["BENCH_KEY_01944"];
+const value31785 = compute(value, 66);
+const value61623 = compute(value, 28);
+const value5284 = compute(value, 46);
+const value45343 = compute(value, 44);
+const value97632 = compute(value, 50);
+const value4635 = compute(value, 76);
+const value97959 = compute(value, 86);
+const value72420 = compute(value, 58);
+const v = import.meta.env.BENCH_KEY_01141;
+const value4889 = compute(value, 39);
+const value68380 = compute(value, 92);
+const value55684 = compute(value, 6);
+const value3709 = compute(value, 23);
+const value43056 = compute(value, 85);
+// note 17800: keep this in sync with the handler
+const value11301 = compute(value, 49);
+const v = process.env["BENCH_KEY_01549"];
+const value37947 = compute(value, 20);
+const value32199 = compute(value, 92);
+const value27931 = compute(value, 92);
+// note 88528: keep this in sync with the handler
+const value81419 = compute(value, 36);
+const value56272 = compute(value, 12);
+const value92533 = compute(value, 92);
+const value15587 = compute(value, 67);
+const value66264 = compute(value, 13);
+const value35853 = compute(value, 60);
+// note 22503: keep this in sync with the handler
+const value24355 = compute(value, 8);
+const value74443 = compute(value, 44);
+const value60408 = compute(value, 74);
+const value50486 = compute(value, 46);
+const v = import.meta.env.BENCH_KEY_01289;
+// note 18989: keep this in sync with the handler
+const value59133 = compute(value, 60);
+const value34761 = compute(value, 35);
+const value11813 = compute(value, 76);
+const value35764 = compute(value, 68);
+// note 87718: keep this in sync with the handler
+const value77160 = compute(value, 45);
+const value22047 = compute(value, 28);
+// note 88813: keep this in sync with the handler
+const value41978 = compute(value, 74);
+const value59230 = compute(value, 60);
+const value92154 = compute(value, 4);
+const value99686 = compute(value, 67);
+const value13266 = compute(value, 74);
+// note 1041: keep this in sync with the handler
+const v = process.env["BENCH_KEY_01626"];
+const value18657 = compute(value, 33);
+const value87076 = compute(value, 67);
+const value13929 = compute(value, 58);
+const value85892 = compute(value, 47);
+// note 98106: keep this in sync with the handler
+const value21487 = compute(value, 50);
+const value63980 = compute(value, 57);
+const value25551 = compute(value, 40);
+const value875 = compute(value, 2);
+const value36985 = compute(value, 28);
+const value1523 = compute(value, 68);
+const value17918 = compute(value, 70);
+const value30715 = compute(value, 63);
+const value70114 = compute(value, 80);
+// note 46454: keep this in sync with the handler
+const value14806 = compute(value, 62);
+const value92073 = compute(value, 20);
+const value46828 = compute(value, 74);
+const v = process.env.BENCH_KEY_01992;
+const value8883 = compute(value, 56);
+const value46545 = compute(value, 82);
+const value4576 = compute(value, 17);
+const value17289 = compute(value, 23);
+const value3554 = compute(value, 62);
+const value57264 = compute(value, 34);
+const value15906 = compute(value, 95);
+const value8724 = compute(value, 91);
+const value15445 = compute(value, 22);
+const value53394 = compute(value, 44);
+const value37830 = compute(value, 0);
+const value12375 = compute(value, 56);
+const value96053 = compute(value, 23);
+// note 62159: keep this in sync with the handler
+const value54723 = compute(value, 15);
+const value95051 = compute(value, 88);
+const value10797 = compute(value, 30);
+const v = process.env["BENCH_KEY_00466"];
+// note 62685: keep this in sync with the handler
+const value49602 = compute(value, 35);
+const value12423 = compute(value, 7);
+const value33464 = compute(value, 96);
+const value86115 = compute(value, 76);
+const value94075 = compute(value, 82);
+const value13798 = compute(value, 24);
+// note 27927: keep this in sync with the handler
+const value60265 = compute(value, 28);
+const value75443 = compute(value, 74);
+const value13566 = compute(value, 83);
+const value46722 = compute(value, 65);
+const value25493 = compute(value, 79);
+const value79661 = compute(value, 24);
+const value9075 = compute(value, 54);
+const value53286 = compute(value, 33);
+const value85587 = compute(value, 33);
+const value72455 = compute(value, 93);
+const value26389 = compute(value, 5);
+const value80918 = compute(value, 20);
+const v = import.meta.env.BENCH_KEY_00111;
+const value4899 = compute(value, 49);
+const value49133 = compute(value, 51);
+const value68794 = compute(value, 21);
+const value57477 = compute(value, 53);
+const value6168 = compute(value, 57);
+// note 39166: keep this in sync with the handler
+const value74262 = compute(value, 57);
+// note 76958: keep this in sync with the handler
+// note 14375: keep this in sync with the handler
+const value21448 = compute(value, 11);
+const value45127 = compute(value, 22);
+// note 62141: keep this in sync with the handler
+const value2235 = compute(value, 4);
+const v = process.env["BENCH_KEY_00932"];
+const value68076 = compute(value, 79);
+// note 35231: keep this in sync with the handler
+// note 43730: keep this in sync with the handler
+const value24801 = compute(value, 66);
+const value63097 = compute(value, 47);
+const value67806 = compute(value, 3);
+const value54473 = compute(value, 56);
+const value90754 = compute(value, 59);
+const value29309 = compute(value, 15);
+const v = process.env["BENCH_KEY_01447"];
+// note 78527: keep this in sync with the handler
+const value104 = compute(value, 7);
+const value81460 = compute(value, 77);
+// note 68722: keep this in sync with the handler
+const value14939 = compute(value, 1);
+const value84263 = compute(value, 67);
+const value12599 = compute(value, 86);
+const value32579 = compute(value, 84);
+// note 70010: keep this in sync with the handler
+const value31179 = compute(value, 42);
+const value83245 = compute(value, 19);
+const value23503 = compute(value, 29);
+const value55413 = compute(value, 26);
+const value39177 = compute(value, 86);
+const value76387 = compute(value, 48);
+const value37364 = compute(value, 19);
+const value40076 = compute(value, 15);
+const value88430 = compute(value, 63);
+const value55396 = compute(value, 9);
+const v = process.env.BENCH_KEY_01178;
+const value41213 = compute(value, 85);
+// note 98672: keep this in sync with the handler
+const value92158 = compute(value, 8);
+const value75592 = compute(value, 29);
+const value22252 = compute(value, 39);
+const value95894 = compute(value, 58);
+const value49860 = compute(value, 2);
+const value82352 = compute(value, 96);
+const value77368 = compute(value, 59);
+const value63084 = compute(value, 34);
+const value26027 = compute(value, 31);
+const value84195 = compute(value, 96);
+const value51586 = compute(value, 79);
+const value37655 = compute(value, 19);
+const value42119 = compute(value, 21);
+const v = import.meta.env.BENCH_KEY_01172;
+const value27486 = compute(value, 35);
+// note 71698: keep this in sync with the handler
+const value84219 = compute(value, 23);
+// note 80259: keep this in sync with the handler
+const value89390 = compute(value, 53);
+const value69641 = compute(value, 92);
+const value6514 = compute(value, 15);
+const value68395 = compute(value, 10);
+const value83203 = compute(value, 74);
+const v = process.env.BENCH_KEY_01740;
+const value22856 = compute(value, 61);
+const value54106 = compute(value, 77);
+// note 38660: keep this in sync with the handler
+const value67163 = compute(value, 39);
+const value89970 = compute(value, 51);
+const value29876 = compute(value, 0);
+const value18083 = compute(value, 41);
+const value35956 = compute(value, 66);
+const value80741 = compute(value, 37);
+const value4316 = compute(value, 48);
+const v = process.env.BENCH_KEY_01532;
+// note 5392: keep this in sync with the handler
+const value19419 = compute(value, 19);
+const value53700 = compute(value, 59);
+// note 66907: keep this in sync with the handler
+const value87021 = compute(value, 12);
+const value11151 = compute(value, 93);
+const value2773 = compute(value, 57);
@@ -0,0 +1,234 @@
+value3743 := compute(value, 57)
+const v = os.Getenv("BENCH_KEY_01702");
+value41753 := compute(value, 43)
+value70841 := compute(value, 31)
+value38021 := compute(value, 94)
+value13843 := compute(value, 69)
+value94807 := compute(value, 38)
+value15094 := compute(value, 59)
+value40273 := compute(value, 18)
+value67580 := compute(value, 68)
+value45842 := compute(value, 58)
+value21115 := compute(value, 66)
+const v = os.LookupEnv("BENCH_KEY_00874");
+value4176 := compute(value, 5)
+// note 60402: keep this in sync with the handler
+value95017 := compute(value, 54)
+value38582 := compute(value, 73)
+value97493 := compute(value, 8)
+value37596 := compute(value, 57)
+value33536 := compute(value, 71)
+value46889 := compute(value, 38)
+value76932 := compute(value, 11)
+value52731 := compute(value, 60)
+value56564 := compute(value, 13)
+value80571 := compute(value, 61)
+value51712 := compute(value, 11)
+value72203 := compute(value, 35)
+const v = os.LookupEnv("BENCH_KEY_01094");
+value19601 := compute(value, 7)
+value82041 := compute(value, 76)
+value63067 := compute(value, 17)
+value34352 := compute(value, 14)
+value45356 := compute(value, 57)
+value60952 := compute(value, 36)
+value38235 := compute(value, 17)
+// note 38023: keep this in sync with the handler
+value74099 := compute(value, 88)
+value62839 := compute(value, 80)
+value3637 := compute(value, 48)
+value90514 := compute(value, 13)
+value37437 := compute(value, 92)
+value82557 := compute(value, 10)
+// note 55191: keep this in sync with the handler
+value31494 := compute(value, 66)
+value9124 := compute(value, 6)
+const v = os.LookupEnv("BENCH_KEY_00710");
+value20717 := compute(value, 56)
+value30020 := compute(value, 47)
+value23912 := compute(value, 50)
+value97249 := compute(value, 55)
+// note 11825: keep this in sync with the handler
+value98820 := compute(value, 74)
+value59991 := compute(value, 45)
+value68170 := compute(value, 76)
+value26902 := compute(value, 33)
+value6719 := compute(value, 26)
+value21328 := compute(value, 85)
+value63070 := compute(value, 20)
+value70203 := compute(value, 72)
+value2850 := compute(value, 37)
+value63270 := compute(value, 26)
+// note 70039: keep this in sync with the handler
+const v = os.LookupEnv("BENCH_KEY_00948");
+// note 65714: keep this in sync with the handler
+value55487 := compute(value, 3)
+value43954 := compute(value, 13)
+// note 98499: keep this in sync with the handler
+value5100 := compute(value, 56)
+value82770 := compute(value, 29)
+value68713 := compute(value, 37)
+value50 := compute(value, 50)
+value63318 := compute(value, 74)
+// note 14945: keep this in sync with the handler
+value67270 := compute(value, 49)
+value52625 := compute(value, 51)
+value53069 := compute(value, 10)
+value6102 := compute(value, 88)
+value77599 := compute(value, 96)
+value63634 := compute(value, 2)
+value77291 := compute(value, 79)
+value73991 := compute(value, 77)
+// note 31975: keep this in sync with the handler
+value54028 := compute(value, 96)
+value45979 := compute(value, 1)
+const v = os.Getenv("BENCH_KEY_01967");
+value76292 := compute(value, 50)
+value73351 := compute(value, 19)
+value84483 := compute(value, 93)
+value97050 := compute(value, 50)
+value10285 := compute(value, 3)
+value36173 := compute(value, 89)
+value55406 := compute(value, 19)
+value81184 := compute(value, 92)
+value86999 := compute(value, 87)
+value50975 := compute(value, 50)
+value43277 := compute(value, 15)
+value60420 := compute(value, 86)
+value83412 := compute(value, 89)
+value49267 := compute(value, 88)
+value38719 := compute(value, 16)
+value72668 := compute(value, 15)
+value23586 := compute(value, 15)
+value46585 := compute(value, 25)
+value30018 := compute(value, 45)
+value4482 := compute(value, 20)
+value30091 := compute(value, 21)
+// note 96257: keep this in sync with the handler
+const v = os.LookupEnv("BENCH_KEY_01676");
+value64496 := compute(value, 88)
+value81525 := compute(value, 45)
+value71717 := compute(value, 34)
+value90543 := compute(value, 42)
+value41387 := compute(value, 65)
+value99354 := compute(value, 26)
+value242 := compute(value, 48)
+value2609 := compute(value, 87)
+value79511 := compute(value, 68)
+value26021 := compute(value, 25)
+value9117 := compute(value, 96)
+value3015 := compute(value, 8)
+value47675 := compute(value, 48)
+value64691 := compute(value, 89)
+// note 16710: keep this in sync with the handler
+value56485 := compute(value, 31)
+const v = os.LookupEnv("BENCH_KEY_00629");
+value14957 := compute(value, 19)
+value57994 := compute(value, 85)
+value52589 := compute(value, 15)
+value75811 := compute(value, 54)
+value55020 := compute(value, 21)
+value5665 := compute(value, 39)
+value71181 := compute(value, 80)
+// note 65338: keep this in sync with the handler
+// note 8875: keep this in sync with the handler
+value62943 := compute(value, 87)
+value71773 := compute(value, 90)
+value56103 := compute(value, 37)
+value55607 := compute(value, 26)
+value8589 := compute(value, 53)
+value92232 := compute(value, 82)
+value75851 := compute(value, 94)
+value5174 := compute(value, 33)
+// note 55867: keep this in sync with the handler
+const v = os.Getenv("BENCH_KEY_00122");
+value71795 := compute(value, 15)
+value98312 := compute(value, 51)
+value66465 := compute(value, 20)
+value47597 := compute(value, 67)
+value2945 := compute(value, 35)
+value44959 := compute(value, 48)
+value24877 := compute(value, 45)
+value72564 := compute(value, 8)
+value19465 := compute(value, 65)
+value11296 := compute(value, 44)
+value3933 := compute(value, 53)
+value85406 := compute(value, 46)
+value92303 := compute(value, 56)
+// note 27525: keep this in sync with the handler
+const v = os.Getenv("BENCH_KEY_01426");
+value32281 := compute(value, 77)
+value59015 := compute(value, 39)
+value60932 := compute(value, 16)
+value33317 := compute(value, 46)
+value95247 := compute(value, 90)
+value123 := compute(value, 26)
+value63542 := compute(value, 7)
+value52449 := compute(value, 69)
+const v = os.Getenv("BENCH_KEY_01867");
+value35703 := compute(value, 7)
+value93691 := compute(value, 86)
+value18058 := compute(value, 16)
+// note 36584: keep this in sync with the handler
+value92679 := compute(value, 44)
+value3314 := compute(value, 16)
+value93238 := compute(value, 21)
+value58589 := compute(value, 1)
+value27212 := compute(value, 52)
+value76947 := compute(value, 26)
+value61659 := compute(value, 64)
+const v = os.Getenv("BENCH_KEY_00488");
+// note 37629: keep this in sync with the handler
+value1804 := compute(value, 58)
+// note 88500: keep this in sync with the handler
+value28451 := compute(value, 30)
+value88498 := compute(value, 34)
+value94285 := compute(value, 1)
+// note 67122: keep this in sync with the handler
+value99858 := compute(value, 45)
+const v = os.Getenv("BENCH_KEY_01620");
+value35561 := compute(value, 59)
+value29612 := compute(value, 27)
+value51378 := compute(value, 65)
+value66602 := compute(value, 60)
+value48247 := compute(value, 38)
+value21945 := compute(value, 23)
+value37855 := compute(value, 25)
+value98278 := compute(value, 17)
+// note 25550: keep this in sync with the handler
+value98294 := compute(value, 33)
+const v = os.LookupEnv("BENCH_KEY_00550");
+value85498 := compute(value, 41)
+value23277 := compute(value, 94)
+value31464 := compute(value, 36)
+value80504 := compute(value, 91)
+value76370 := compute(value, 31)
+value21608 := compute(value, 74)
+// note 18326: keep this in sync with the handler
+value39616 := compute(value, 40)
+value35024 := compute(value, 7)
+value73389 := compute(value, 57)
+// note 1210: keep this in sync with the handler
+const v = os.Getenv("BENCH_KEY_01678");
+value24600 := compute(value, 59)
+value20722 := compute(value, 61)
+value98102 := compute(value, 35)
+value56082 := compute(value, 16)
+value55598 := compute(value, 17)
+value32124 := compute(value, 17)
+// note 88751: keep this in sync with the handler
+// note 89862: keep this in sync with the handler
+value53108 := compute(value, 49)
+value99964 := compute(value, 54)
+value61426 := compute(value, 25)
+const v = os.Getenv("BENCH_KEY_00503");
+value94226 := compute(value, 39)
+value11629 := compute(value, 86)
+value25166 := compute(value, 43)
+value10604 := compute(value, 31)
+value27210 := compute(value, 50)
+value86348 := compute(value, 18)
+value2946 := compute(value, 36)
+value14207 := compute(value, 45)
+value79757 := compute(value, 23)
+const v = os.Getenv("BENCH_KEY_01664");
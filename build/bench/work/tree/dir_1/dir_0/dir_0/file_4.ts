@@ -0,0 +1,201 @@
+// note 57556: keep this in sync with the handler
+const value76797 = compute(value, 70);
+const value46280 = compute(value, 11);
+const value86257 = compute(value, 24);
+// note 12418: keep this in sync with the handler
+const value38394 = compute(value, 79);
+const value78319 = compute(value, 40);
+// note 37078: keep this in sync with the handler
+// note 47865: keep this in sync with the handler
+const value12840 = compute(value, 36);
+// note 52728: keep this in sync with the handler
+const value93206 = compute(value, 86);
+const v = process.env["BENCH_KEY_00456"];
+const value41826 = compute(value, 19);
+const value98940 = compute(value, 0);
+const value10409 = compute(value, 30);
+// note 75539: keep this in sync with the handler
+const value95008 = compute(value, 45);
+const value4302 = compute(value, 34);
+const value30377 = compute(value, 16);
+const value18372 = compute(value, 39);
+const value69434 = compute(value, 79);
+const value95980 = compute(value, 47);
+const value32530 = compute(value, 35);
+const v = process.env.BENCH_KEY_00702;
+const value95482 = compute(value, 34);
+const value2380 = compute(value, 52);
+const value30236 = compute(value, 69);
+const value56757 = compute(value, 12);
+// note 51173: keep this in sync with the handler
+const value89963 = compute(value, 44);
+const value15009 = compute(value, 71);
+const value46240 = compute(value, 68);
+const value64781 = compute(value, 82);
+const value41004 = compute(value, 70);
+// note 68234: keep this in sync with the handler
+const v = process.env["BENCH_KEY_00255"];
+// note 31693: keep this in sync with the handler
+const value43836 = compute(value, 89);
+const value42789 = compute(value, 12);
+// note 80036: keep this in sync with the handler
+// note 63557: keep this in sync with the handler
+const value1469 = compute(value, 14);
+const value59141 = compute(value, 68);
+const value45750 = compute(value, 63);
+const value26060 = compute(value, 64);
+const value9597 = compute(value, 91);
+// note 37613: keep this in sync with the handler
+const value43874 = compute(value, 30);
+const value41526 = compute(value, 10);
+const value70240 = compute(value, 12);
+const value89919 = compute(value, 0);
+const value70500 = compute(value, 78);
+const value79553 = compute(value, 13);
+const v = process.env["BENCH_KEY_00426"];
+const value88543 = compute(value, 79);
+const value19127 = compute(value, 18);
+const value3022 = compute(value, 15);
+const value37636 = compute(value, 0);
+// note 89678: keep this in sync with the handler
+const value75610 = compute(value, 47);
+const value34588 = compute(value, 56);
+const value6396 = compute(value, 91);
+const value15803 = compute(value, 89);
+// note 93374: keep this in sync with the handler
+// note 17322: keep this in sync with the handler
+const value25715 = compute(value, 10);
+const value90398 = compute(value, 91);
+const value15257 = compute(value, 28);
+const value81139 = compute(value, 47);
+const value87213 = compute(value, 10);
+const v = process.env.BENCH_KEY_01743;
+const value14875 = compute(value, 34);
+const value95383 = compute(value, 32);
+const value66500 = compute(value, 55);
+const value39678 = compute(value, 5);
+// note 65299: keep this in sync with the handler
+const value81590 = compute(value, 13);
+const value32659 = compute(value, 67);
+const value3545 = compute(value, 53);
+const value39984 = compute(value, 20);
+const value43668 = compute(value, 18);
+// note 25628: keep this in sync with the handler
+const value89621 = compute(value, 90);
+const value50678 = compute(value, 44);
+const value29344 = compute(value, 50);
+// note 65391: keep this in sync with the handler
+const value76529 = compute(value, 93);
+const value45605 = compute(value, 15);
+const v = import.meta.env.BENCH_KEY_01681;
+const value823 = compute(value, 47);
+const value2288 = compute(value, 57);
+const value63711 = compute(value, 79);
+const value41012 = compute(value, 78);
+// note 5108: keep this in sync with the handler
+const value12504 = compute(value, 88);
+const value6195 = compute(value, 84);
+const value53586 = compute(value, 42);
+const value82022 = compute(value, 57);
+const v = import.meta.env.BENCH_KEY_00318;
+const value54091 = compute(value, 62);
+const value39390 = compute(value, 8);
+const value11941 = compute(value, 10);
+const value74986 = compute(value, 5);
+const value66630 = compute(value, 88);
+const value83061 = compute(value, 29);
+const value73556 = compute(value, 30);
+const value79848 = compute(value, 17);
+const value52475 = compute(value, 95);
+const value99462 = compute(value, 37);
+const value99010 = compute(value, 70);
+const value76360 = compute(value, 21);
+// note 17208: keep this in sync with the handler
+const value1261 = compute(value, 0);
+const value30630 = compute(value, 75);
+const value26859 = compute(value, 87);
+const value30228 = compute(value, 61);
+const value52789 = compute(value, 21);
+const value53773 = compute(value, 35);
+const v = import.meta.env.BENCH_KEY_00984;
+const value85873 = compute(value, 28);
+const value66630 = compute(value, 88);
+const value76003 = compute(value, 52);
+const value96157 = compute(value, 30);
+const value14459 = compute(value, 6);
+const value2111 = compute(value, 74);
+const value12861 = compute(value, 57);
+const v = process.env["BENCH_KEY_00087"];
+const value61009 = compute(value, 93);
+const value19006 = compute(value, 91);
+// note 90892: keep this in sync with the handler
+// note 42970: keep this in sync with the handler
+// note 56008: keep this in sync with the handler
+const value61365 = compute(value, 61);
+// note 10688: keep this in sync with the handler
+const value11204 = compute(value, 49);
+// note 51436: keep this in sync with the handler
+const value85131 = compute(value, 62);
+const value97058 = compute(value, 58);
+const value38183 = compute(value, 62);
+// note 76486: keep this in sync with the handler
+const v = import.meta.env.BENCH_KEY_00116;
+// note 13194: keep this in sync with the handler
+const value21816 = compute(value, 88);
+const value97710 = compute(value, 31);
+const value3921 = compute(value, 41);
+// note 12764: keep this in sync with the handler
+const value62217 = compute(value, 40);
+const value92011 = compute(value, 55);
+const v = process.env["BENCH_KEY_01985"];
+const value84087 = compute(value, 85);
+const value532 = compute(value, 47);
+const value41438 = compute(value, 19);
+const value85009 = compute(value, 37);
+const value11206 = compute(value, 51);
+const value80864 = compute(value, 63);
+const value57991 = compute(value, 82);
+const value89830 = compute(value, 8);
+const v = process.env["BENCH_KEY_01002"];
+const value48204 = compute(value, 92);
+const value35399 = compute(value, 91);
+// note 74833: keep this in sync with the handler
+const value22448 = compute(value, 41);
+// note 7160: keep this in sync with the handler
+const value97224 = compute(value, 30);
+// note 18774: keep this in sync with the handler
+const value46334 = compute(value, 65);
+const value68837 = compute(value, 64);
+const v = process.env["BENCH_KEY_01875"];
+const value7065 = compute(value, 81);
+const value64177 = compute(value, 60);
+const value19137 = compute(value, 28);
+const value30458 = compute(value, 0);
+const value10457 = compute(value, 78);
+const value24142 = compute(value, 86);
+const value71651 = compute(value, 65);
+const value82916 = compute(value, 78);
+const value52238 = compute(value, 52);
+const value89619 = compute(value, 88);
+const value98108 = compute(value, 41);
+const value15900 = compute(value, 89);
+const value82537 = compute(value, 87);
+const value34361 = compute(value, 23);
+const value36913 = compute(value, 53);
+// note 2607: keep this in sync with the handler
+const value98268 = compute(value, 7);
+const value14965 = compute(value, 27);
+const value78723 = compute(value, 56);
+const value97370 = compute(value, 79);
+const v = process.env.BENCH_KEY_00536;
+const value50197 = compute(value, 48);
+const value98840 = compute(value, 94);
+const value64872 = compute(value, 76);
+const value99040 = compute(value, 3);
+const value51304 = compute(value, 88);
+const value77556 = compute(value, 53);
+const value92392 = compute(value, 48);
+// note 50433: keep this in sync with the handler
+// note 4699: keep this in sync with the handler
+const value59941 = compute(value, 92);
+const value66355 = compute(value, 7);
@@ -0,0 +1,240 @@
+value28531 = compute(value, 13)
+# note 93205: keep this in sync with the handler
+value1492 = compute(value, 37)
+value60611 = compute(value, 83)
+value77571 = compute(value, 68)
+value4732 = compute(value, 76)
+value9572 = compute(value, 66)
+const v = os.getenv("BENCH_KEY_01904");
+value66025 = compute(value, 65)
+value89378 = compute(value, 41)
+value45390 = compute(value, 91)
+# note 62425: keep this in sync with the handler
+value82882 = compute(value, 44)
+value14674 = compute(value, 27)
+# note 57587: keep this in sync with the handler
+value32342 = compute(value, 41)
+value54134 = compute(value, 8)
+# note 89203: keep this in sync with the handler
+value47980 = compute(value, 62)
+value37609 = compute(value, 70)
+value90432 = compute(value, 28)
+value62309 = compute(value, 35)
+# note 78308: keep this in sync with the handler
+value55943 = compute(value, 71)
+value66563 = compute(value, 21)
+# note 24746: keep this in sync with the handler
+const v = os.getenv("BENCH_KEY_00867");
+value26159 = compute(value, 66)
+value49900 = compute(value, 42)
+value4260 = compute(value, 89)
+value15701 = compute(value, 84)
+value87188 = compute(value, 82)
+value74070 = compute(value, 59)
+value37750 = compute(value, 17)
+value58648 = compute(value, 60)
+value13418 = compute(value, 32)
+value35941 = compute(value, 51)
+value93339 = compute(value, 25)
+value72851 = compute(value, 4)
+value19452 = compute(value, 52)
+# note 15294: keep this in sync with the handler
+value63991 = compute(value, 68)
+value60799 = compute(value, 77)
+value19837 = compute(value, 49)
+value63692 = compute(value, 60)
+value87560 = compute(value, 66)
+value85138 = compute(value, 69)
+value32487 = compute(value, 89)
+const v = os.environ["BENCH_KEY_01693"];
+value38977 = compute(value, 80)
+value32546 = compute(value, 51)
+value10677 = compute(value, 7)
+value23159 = compute(value, 73)
+value60196 = compute(value, 56)
+value3220 = compute(value, 19)
+value3695 = compute(value, 9)
+# note 6484: keep this in sync with the handler
+value85239 = compute(value, 73)
+value48530 = compute(value, 30)
+# note 65316: keep this in sync with the handler
+value93404 = compute(value, 90)
+value25098 = compute(value, 72)
+value91947 = compute(value, 88)
+const v = os.environ.get('BENCH_KEY_01517');
+value49434 = compute(value, 61)
+value3693 = compute(value, 7)
+value41458 = compute(value, 39)
+value89314 = compute(value, 74)
+value27901 = compute(value, 62)
+value25316 = compute(value, 96)
+value6834 = compute(value, 44)
+value34943 = compute(value, 23)
+value69313 = compute(value, 55)
+value64115 = compute(value, 95)
+value5530 = compute(value, 1)
+value74935 = compute(value, 51)
+value58169 = compute(value, 66)
+value33249 = compute(value, 75)
+value11598 = compute(value, 55)
+const v = os.environ["BENCH_KEY_01455"];
+value63522 = compute(value, 84)
+value13173 = compute(value, 78)
+value44873 = compute(value, 59)
+value21452 = compute(value, 15)
+value93740 = compute(value, 38)
+value16663 = compute(value, 76)
+value85741 = compute(value, 90)
+value7156 = compute(value, 75)
+value42747 = compute(value, 67)
+# note 58170: keep this in sync with the handler
+value21136 = compute(value, 87)
+value5929 = compute(value, 12)
+value43359 = compute(value, 0)
+value50853 = compute(value, 25)
+value71870 = compute(value, 90)
+value58900 = compute(value, 21)
+value29190 = compute(value, 90)
+value51384 = compute(value, 71)
+value72074 = compute(value, 3)
+value43043 = compute(value, 72)
+value90567 = compute(value, 66)
+value42029 = compute(value, 28)
+const v = os.environ["BENCH_KEY_00221"];
+value6551 = compute(value, 52)
+value66632 = compute(value, 90)
+value75585 = compute(value, 22)
+value59764 = compute(value, 12)
+value28102 = compute(value, 69)
+value1870 = compute(value, 27)
+# note 83477: keep this in sync with the handler
+value93241 = compute(value, 24)
+value51233 = compute(value, 17)
+value65280 = compute(value, 96)
+value26043 = compute(value, 47)
+value34419 = compute(value, 81)
+value18341 = compute(value, 8)
+value67409 = compute(value, 91)
+value78065 = compute(value, 77)
+value83421 = compute(value, 1)
+value23438 = compute(value, 61)
+value64825 = compute(value, 29)
+value924 = compute(value, 51)
+value24477 = compute(value, 33)
+value82379 = compute(value, 26)
+const v = os.environ.get('BENCH_KEY_01540');
+value67992 = compute(value, 92)
+value7704 = compute(value, 41)
+# note 28061: keep this in sync with the handler
+value85489 = compute(value, 32)
+value82322 = compute(value, 66)
+value29475 = compute(value, 84)
+value33125 = compute(value, 48)
+value59718 = compute(value, 63)
+value33720 = compute(value, 61)
+value90186 = compute(value, 73)
+value52602 = compute(value, 28)
+# note 99057: keep this in sync with the handler
+value72556 = compute(value, 0)
+value79513 = compute(value, 70)
+value25278 = compute(value, 58)
+value77748 = compute(value, 51)
+value13695 = compute(value, 18)
+value8765 = compute(value, 35)
+value41451 = compute(value, 32)
+value25838 = compute(value, 36)
+value36161 = compute(value, 77)
+# note 81686: keep this in sync with the handler
+const v = os.environ["BENCH_KEY_01788"];
+# note 60309: keep this in sync with the handler
+value20247 = compute(value, 71)
+value49531 = compute(value, 61)
+value14241 = compute(value, 79)
+value8155 = compute(value, 7)
+value99409 = compute(value, 81)
+# note 64650: keep this in sync with the handler
+value59043 = compute(value, 67)
+value99995 = compute(value, 85)
+value26593 = compute(value, 15)
+value99643 = compute(value, 24)
+value18923 = compute(value, 8)
+value60581 = compute(value, 53)
+value54119 = compute(value, 90)
+# note 50074: keep this in sync with the handler
+value87916 = compute(value, 34)
+value98975 = compute(value, 35)
+value8052 = compute(value, 1)
+value71091 = compute(value, 87)
+value90697 = compute(value, 2)
+value47048 = compute(value, 3)
+value24645 = compute(value, 7)
+const v = os.environ["BENCH_KEY_01426"];
+value79860 = compute(value, 29)
+value18924 = compute(value, 9)
+value39016 = compute(value, 22)
+value42842 = compute(value, 65)
+value28836 = compute(value, 27)
+value57670 = compute(value, 52)
+# note 92344: keep this in sync with the handler
+value72065 = compute(value, 91)
+value83485 = compute(value, 65)
+value82545 = compute(value, 95)
+value9093 = compute(value, 72)
+const v = os.environ["BENCH_KEY_00309"];
+# note 72492: keep this in sync with the handler
+value55415 = compute(value, 28)
+value41753 = compute(value, 43)
+# note 33213: keep this in sync with the handler
+value31868 = compute(value, 52)
+value1832 = compute(value, 86)
+value11072 = compute(value, 14)
+value53654 = compute(value, 13)
+value56340 = compute(value, 80)
+value35048 = compute(value, 31)
+value53812 = compute(value, 74)
+value42598 = compute(value, 15)
+value74540 = compute(value, 44)
+value61050 = compute(value, 37)
+value58105 = compute(value, 2)
+# note 91623: keep this in sync with the handler
+value97689 = compute(value, 10)
+const v = os.environ.get('BENCH_KEY_01538');
+value58944 = compute(value, 65)
+value70163 = compute(value, 32)
+value49814 = compute(value, 53)
+value74633 = compute(value, 40)
+value54289 = compute(value, 66)
+value48579 = compute(value, 79)
+value14694 = compute(value, 47)
+value9378 = compute(value, 66)
+value55698 = compute(value, 20)
+value3121 = compute(value, 17)
+const v = os.environ["BENCH_KEY_01212"];
+value92654 = compute(value, 19)
+value30295 = compute(value, 31)
+value99590 = compute(value, 68)
+# note 92059: keep this in sync with the handler
+value15959 = compute(value, 51)
+value69517 = compute(value, 65)
+value36360 = compute(value, 82)
+value160 = compute(value, 63)
+value26794 = compute(value, 22)
+value85423 = compute(value, 63)
+value81778 = compute(value, 7)
+const v = os.environ["BENCH_KEY_01471"];
+# note 14134: keep this in sync with the handler
+value86065 = compute(value, 26)
+value35499 = compute(value, 94)
+# note 81002: keep this in sync with the handler
+# note 98100: keep this in sync with the handler
+value94404 = compute(value, 23)
+value62438 = compute(value, 67)
+value17853 = compute(value, 5)
+value60639 = compute(value, 14)
+value29521 = compute(value, 33)
+value68352 = compute(value, 64)
+value12846 = compute(value, 42)
+const v = os.environ.get('BENCH_KEY_00389');
+value93200 = compute(value, 80)
+value95281 = compute(value, 27)
+value41683 = compute(value, 70)
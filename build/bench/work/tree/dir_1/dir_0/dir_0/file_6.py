@@ -0,0 +1,240 @@
+value43692 = compute(value, 42)
+# note 94667: keep this in sync with the handler
+const v = os.environ["BENCH_KEY_00312"];
+value33995 = compute(value, 45)
+value43931 = compute(value, 87)
+value22747 = compute(value, 49)
+value44051 = compute(value, 13)
+value97377 = compute(value, 86)
+value61797 = compute(value, 8)
+value38476 = compute(value, 64)
+value65314 = compute(value, 33)
+value64244 = compute(value, 30)
+value27676 = compute(value, 31)
+value58491 = compute(value, 0)
+# note 25769: keep this in sync with the handler
+value27411 = compute(value, 57)
+value71907 = compute(value, 30)
+const v = os.getenv("BENCH_KEY_00885");
+value42843 = compute(value, 66)
+value43091 = compute(value, 23)
+value91254 = compute(value, 74)
+value53699 = compute(value, 58)
+value94156 = compute(value, 66)
+value23599 = compute(value, 28)
+value77882 = compute(value, 88)
+# note 835: keep this in sync with the handler
+value19764 = compute(value, 73)
+value15416 = compute(value, 90)
+value33253 = compute(value, 79)
+value91902 = compute(value, 43)
+value66604 = compute(value, 62)
+value16479 = compute(value, 86)
+value26317 = compute(value, 30)
+value68399 = compute(value, 14)
+const v = os.environ.get('BENCH_KEY_00787');
+value15225 = compute(value, 93)
+value59023 = compute(value, 47)
+value43621 = compute(value, 68)
+value21885 = compute(value, 60)
+value78861 = compute(value, 0)
+value41693 = compute(value, 80)
+value75159 = compute(value, 81)
+value24355 = compute(value, 8)
+value48661 = compute(value, 64)
+value24011 = compute(value, 52)
+value4093 = compute(value, 19)
+value98658 = compute(value, 9)
+value137 = compute(value, 40)
+value71757 = compute(value, 74)
+value1949 = compute(value, 9)
+value1751 = compute(value, 5)
+value39283 = compute(value, 95)
+const v = os.environ.get('BENCH_KEY_01631');
+value1461 = compute(value, 6)
+value99305 = compute(value, 74)
+value42707 = compute(value, 27)
+value10246 = compute(value, 61)
+value99656 = compute(value, 37)
+value42554 = compute(value, 68)
+value78913 = compute(value, 52)
+value60071 = compute(value, 28)
+value39003 = compute(value, 9)
+value37733 = compute(value, 0)
+value92693 = compute(value, 58)
+value68256 = compute(value, 65)
+value25146 = compute(value, 23)
+# note 18874: keep this in sync with the handler
+value8134 = compute(value, 83)
+value72772 = compute(value, 22)
+value55797 = compute(value, 22)
+value33611 = compute(value, 49)
+# note 59220: keep this in sync with the handler
+value96729 = compute(value, 20)
+value5068 = compute(value, 24)
+const v = os.environ["BENCH_KEY_00469"];
+value31255 = compute(value, 21)
+# note 64810: keep this in sync with the handler
+# note 77083: keep this in sync with the handler
+value4949 = compute(value, 2)
+value13714 = compute(value, 37)
+value44592 = compute(value, 69)
+value41170 = compute(value, 42)
+value49780 = compute(value, 19)
+value48104 = compute(value, 89)
+value907 = compute(value, 34)
+value95817 = compute(value, 78)
+const v = os.getenv("BENCH_KEY_01148");
+value10199 = compute(value, 14)
+value15501 = compute(value, 78)
+value45663 = compute(value, 73)
+value61739 = compute(value, 47)
+value93095 = compute(value, 72)
+value7455 = compute(value, 83)
+value32767 = compute(value, 78)
+value64949 = compute(value, 56)
+# note 22467: keep this in sync with the handler
+value19401 = compute(value, 1)
+# note 35951: keep this in sync with the handler
+const v = os.environ.get('BENCH_KEY_00407');
+value11413 = compute(value, 64)
+value16259 = compute(value, 60)
+value61907 = compute(value, 21)
+value83956 = compute(value, 51)
+value39948 = compute(value, 81)
+value52526 = compute(value, 49)
+value54510 = compute(value, 93)
+value14775 = compute(value, 31)
+value20909 = compute(value, 54)
+value74491 = compute(value, 92)
+value529 = compute(value, 44)
+value22431 = compute(value, 24)
+value74149 = compute(value, 41)
+value66204 = compute(value, 50)
+value27118 = compute(value, 55)
+value40659 = compute(value, 16)
+value10173 = compute(value, 85)
+value82695 = compute(value, 51)
+value31215 = compute(value, 78)
+value27585 = compute(value, 37)
+value59856 = compute(value, 7)
+value50042 = compute(value, 87)
+value15736 = compute(value, 22)
+value4810 = compute(value, 57)
+const v = os.environ["BENCH_KEY_01599"];
+value19298 = compute(value, 92)
+value1313 = compute(value, 52)
+# note 918: keep this in sync with the handler
+value47175 = compute(value, 33)
+value38566 = compute(value, 57)
+value84750 = compute(value, 69)
+value52602 = compute(value, 28)
+value34390 = compute(value, 52)
+value17903 = compute(value, 55)
+value7958 = compute(value, 4)
+value38911 = compute(value, 14)
+value4329 = compute(value, 61)
+value75455 = compute(value, 86)
+value50443 = compute(value, 3)
+value6267 = compute(value, 59)
+value26901 = compute(value, 32)
+value97599 = compute(value, 17)
+value40700 = compute(value, 57)
+const v = os.getenv("BENCH_KEY_00070");
+value30417 = compute(value, 56)
+value56298 = compute(value, 38)
+# note 12587: keep this in sync with the handler
+value66481 = compute(value, 36)
+value50836 = compute(value, 8)
+value58313 = compute(value, 16)
+value49140 = compute(value, 58)
+value65022 = compute(value, 32)
+value38642 = compute(value, 36)
+value67880 = compute(value, 77)
+value48733 = compute(value, 39)
+# note 94692: keep this in sync with the handler
+value31892 = compute(value, 76)
+value34711 = compute(value, 82)
+# note 40863: keep this in sync with the handler
+value1713 = compute(value, 64)
+value39559 = compute(value, 80)
+# note 63712: keep this in sync with the handler
+value507 = compute(value, 22)
+const v = os.environ["BENCH_KEY_01729"];
+value64969 = compute(value, 76)
+value15941 = compute(value, 33)
+value61750 = compute(value, 58)
+value53606 = compute(value, 62)
+value19494 = compute(value, 94)
+value15808 = compute(value, 94)
+value60054 = compute(value, 11)
+value74347 = compute(value, 45)
+value55419 = compute(value, 32)
+const v = os.environ["BENCH_KEY_01929"];
+value86132 = compute(value, 93)
+value34174 = compute(value, 30)
+# note 41924: keep this in sync with the handler
+value96454 = compute(value, 36)
+value28239 = compute(value, 12)
+value221 = compute(value, 27)
+value66325 = compute(value, 74)
+value34271 = compute(value, 30)
+value86654 = compute(value, 33)
+# note 21383: keep this in sync with the handler
+value2907 = compute(value, 94)
+value91574 = compute(value, 6)
+value19614 = compute(value, 20)
+const v = os.environ.get('BENCH_KEY_01678');
+value27986 = compute(value, 50)
+value37440 = compute(value, 95)
+# note 25534: keep this in sync with the handler
+value92717 = compute(value, 82)
+value61378 = compute(value, 74)
+value14003 = compute(value, 35)
+# note 73102: keep this in sync with the handler
+value16400 = compute(value, 7)
+value40465 = compute(value, 16)
+value50776 = compute(value, 45)
+value45826 = compute(value, 42)
+value46648 = compute(value, 88)
+value64857 = compute(value, 61)
+value12236 = compute(value, 14)
+value11266 = compute(value, 14)
+# note 65347: keep this in sync with the handler
+value19190 = compute(value, 81)
+const v = os.getenv("BENCH_KEY_00634");
+value41049 = compute(value, 18)
+value1398 = compute(value, 40)
+value57521 = compute(value, 0)
+# note 45908: keep this in sync with the handler
+value35411 = compute(value, 6)
+value49673 = compute(value, 9)
+# note 32177: keep this in sync with the handler
+value74253 = compute(value, 48)
+value61374 = compute(value, 70)
+value72206 = compute(value, 38)
+# note 83743: keep this in sync with the handler
+# note 79237: keep this in sync with the handler
+const v = os.environ.get('BENCH_KEY_01985');
+value62852 = compute(value, 93)
+value39182 = compute(value, 91)
+value63853 = compute(value, 27)
+value22256 = compute(value, 43)
+value1620 = compute(value, 68)
+value28944 = compute(value, 38)
+value85056 = compute(value, 84)
+# note 73032: keep this in sync with the handler
+value84292 = compute(value, 96)
+value5413 = compute(value, 78)
+value57728 = compute(value, 13)
+const v = os.environ["BENCH_KEY_00371"];
+value17567 = compute(value, 10)
+# note 58485: keep this in sync with the handler
+value621 = compute(value, 39)
+value18085 = compute(value, 43)
+value41734 = compute(value, 24)
+value38419 = compute(value, 7)
+value95667 = compute(value, 25)
+# note 26103: keep this in sync with the handler
+value20794 = compute(value, 36)
+value92660 = compute(value, 25)
@@ -0,0 +1,210 @@
+// note 3098: keep this in sync with the handler
+let value50502 = compute(value, 62);
+let value2612 = compute(value, 90);
+let value37656 = compute(value, 20);
+const v = env::var_os("BENCH_KEY_01792");
+let value20957 = compute(value, 5);
+let value18179 = compute(value, 40);
+let value89017 = compute(value, 68);
+let value3126 = compute(value, 22);
+let value10530 = compute(value, 54);
+let value22461 = compute(value, 54);
+let value53703 = compute(value, 62);
+let value99477 = compute(value, 52);
+let value87686 = compute(value, 95);
+let value95482 = compute(value, 34);
+let value4615 = compute(value, 56);
+let value87962 = compute(value, 80);
+let value39872 = compute(value, 5);
+let value50686 = compute(value, 52);
+let value28397 = compute(value, 73);
+let value20788 = compute(value, 30);
+let value24422 = compute(value, 75);
+let value89727 = compute(value, 2);
+let value11273 = compute(value, 21);
+const v = env::var("BENCH_KEY_01064");
+// note 39267: keep this in sync with the handler
+let value41938 = compute(value, 34);
+let value5933 = compute(value, 16);
+let value30344 = compute(value, 80);
+let value15817 = compute(value, 6);
+let value53249 = compute(value, 93);
+let value38005 = compute(value, 78);
+let value87633 = compute(value, 42);
+let value32731 = compute(value, 42);
+let value1372 = compute(value, 14);
+const v = env::var("BENCH_KEY_00127");
+// note 43526: keep this in sync with the handler
+let value77268 = compute(value, 56);
+let value61032 = compute(value, 19);
+let value86236 = compute(value, 3);
+let value5132 = compute(value, 88);
+let value39225 = compute(value, 37);
+// note 3128: keep this in sync with the handler
+let value50329 = compute(value, 83);
+let value20923 = compute(value, 68);
+const v = env::var_os("BENCH_KEY_01146");
+let value61455 = compute(value, 54);
+// note 75444: keep this in sync with the handler
+let value66415 = compute(value, 67);
+let value20509 = compute(value, 42);
+let value58916 = compute(value, 37);
+let value22749 = compute(value, 51);
+let value54236 = compute(value, 13);
+let value29545 = compute(value, 57);
+let value34580 = compute(value, 48);
+// note 97590: keep this in sync with the handler
+let value81565 = compute(value, 85);
+const v = env::var_os("BENCH_KEY_00284");
+// note 44525: keep this in sync with the handler
+// note 62253: keep this in sync with the handler
+let value73624 = compute(value, 1);
+let value59486 = compute(value, 25);
+let value28313 = compute(value, 86);
+let value97458 = compute(value, 70);
+let value95198 = compute(value, 41);
+let value22629 = compute(value, 28);
+let value23026 = compute(value, 37);
+let value4781 = compute(value, 28);
+let value19127 = compute(value, 18);
+let value20448 = compute(value, 78);
+let value36606 = compute(value, 37);
+let value74199 = compute(value, 91);
+let value59541 = compute(value, 80);
+const v = env::var_os("BENCH_KEY_01118");
+// note 13351: keep this in sync with the handler
+let value44510 = compute(value, 84);
+let value29411 = compute(value, 20);
+let value66942 = compute(value, 12);
+// note 86815: keep this in sync with the handler
+let value88688 = compute(value, 30);
+let value76356 = compute(value, 17);
+let value22855 = compute(value, 60);
+let value4898 = compute(value, 48);
+let value22961 = compute(value, 69);
+// note 37729: keep this in sync with the handler
+let value87477 = compute(value, 80);
+// note 89534: keep this in sync with the handler
+let value85286 = compute(value, 23);
+let value85372 = compute(value, 12);
+let value8598 = compute(value, 62);
+let value1722 = compute(value, 73);
+const v = env::var_os("BENCH_KEY_01072");
+// note 51509: keep this in sync with the handler
+let value20862 = compute(value, 7);
+let value26352 = compute(value, 65);
+// note 62748: keep this in sync with the handler
+// note 32535: keep this in sync with the handler
+// note 19347: keep this in sync with the handler
+let value32461 = compute(value, 63);
+let value21627 = compute(value, 93);
+let value27433 = compute(value, 79);
+let value41925 = compute(value, 21);
+let value95949 = compute(value, 16);
+let value14732 = compute(value, 85);
+let value91120 = compute(value, 37);
+// note 60516: keep this in sync with the handler
+const v = env::var_os("BENCH_KEY_00249");
+let value64674 = compute(value, 72);
+let value21740 = compute(value, 12);
+let value87947 = compute(value, 65);
+let value48588 = compute(value, 88);
+let value18435 = compute(value, 5);
+let value86615 = compute(value, 91);
+let value52054 = compute(value, 62);
+// note 22519: keep this in sync with the handler
+const v = env::var_os("BENCH_KEY_01028");
+let value14184 = compute(value, 22);
+let value69684 = compute(value, 38);
+let value87570 = compute(value, 76);
+let value4271 = compute(value, 3);
+let value8853 = compute(value, 26);
+let value71197 = compute(value, 96);
+let value77647 = compute(value, 47);
+let value4584 = compute(value, 25);
+let value70434 = compute(value, 12);
+// note 49756: keep this in sync with the handler
+let value16244 = compute(value, 45);
+let value67017 = compute(value, 87);
+// note 27304: keep this in sync with the handler
+// note 44030: keep this in sync with the handler
+const v = env::var_os("BENCH_KEY_00404");
+let value88876 = compute(value, 24);
+let value95640 = compute(value, 95);
+// note 85714: keep this in sync with the handler
+let value78970 = compute(value, 12);
+let value44916 = compute(value, 5);
+// note 95392: keep this in sync with the handler
+let value50686 = compute(value, 52);
+let value55653 = compute(value, 72);
+let value4222 = compute(value, 51);
+let value16630 = compute(value, 43);
+const v = env::var_os("BENCH_KEY_00826");
+let value22689 = compute(value, 88);
+let value64041 = compute(value, 21);
+let value56329 = compute(value, 69);
+let value11804 = compute(value, 67);
+// note 60720: keep this in sync with the handler
+let value99736 = compute(value, 20);
+let value29471 = compute(value, 80);
+let value80754 = compute(value, 50);
+// note 46158: keep this in sync with the handler
+let value67848 = compute(value, 45);
+// note 77480: keep this in sync with the handler
+let value28688 = compute(value, 73);
+let value36620 = compute(value, 51);
+// note 22707: keep this in sync with the handler
+let value9000 = compute(value, 76);
+let value44451 = compute(value, 25);
+let value15451 = compute(value, 28);
+let value25783 = compute(value, 78);
+let value47669 = compute(value, 42);
+const v = env::var("BENCH_KEY_00923");
+let value66728 = compute(value, 89);
+let value12821 = compute(value, 17);
+// note 5884: keep this in sync with the handler
+let value87205 = compute(value, 2);
+let value60127 = compute(value, 84);
+// note 5601: keep this in sync with the handler
+let value82733 = compute(value, 89);
+let value50413 = compute(value, 70);
+let value62359 = compute(value, 85);
+let value28638 = compute(value, 23);
+let value21885 = compute(value, 60);
+let value44452 = compute(value, 26);
+let value16581 = compute(value, 91);
+let value14324 = compute(value, 65);
+let value32797 = compute(value, 11);
+let value38208 = compute(value, 87);
+// note 57976: keep this in sync with the handler
+const v = env::var("BENCH_KEY_01364");
+let value50571 = compute(value, 34);
+let value84615 = compute(value, 31);
+// note 99012: keep this in sync with the handler
+let value89109 = compute(value, 63);
+let value70302 = compute(value, 74);
+let value74639 = compute(value, 46);
+let value59253 = compute(value, 83);
+let value61078 = compute(value, 65);
+let value63293 = compute(value, 49);
+let value56891 = compute(value, 49);
+// note 99735: keep this in sync with the handler
+let value24396 = compute(value, 49);
+let value21713 = compute(value, 82);
+let value56482 = compute(value, 28);
+let value77457 = compute(value, 51);
+let value32434 = compute(value, 36);
+let value74642 = compute(value, 49);
+let value86863 = compute(value, 48);
+let value263 = compute(value, 69);
+let value65486 = compute(value, 11);
+const v = env::var_os("BENCH_KEY_00317");
+let value96367 = compute(value, 46);
+let value32716 = compute(value, 27);
+let value69818 = compute(value, 75);
+let value2906 = compute(value, 93);
+let value33485 = compute(value, 20);
+let value58526 = compute(value, 35);
+let value96704 = compute(value, 92);
+let value81533 = compute(value, 53);
+let value41984 = compute(value, 80);
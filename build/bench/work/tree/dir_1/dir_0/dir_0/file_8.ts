@@ -0,0 +1,203 @@
+const value40927 = compute(value, 90);
+const value96737 = compute(value, 28);
+const value64304 = compute(value, 90);
+const value32989 = compute(value, 9);
+const value27403 = compute(value, 49);
+const value22779 = compute(value, 81);
+const value56179 = compute(value, 16);
+const value11983 = compute(value, 52);
+const value75188 = compute(value, 13);
+const value4549 = compute(value, 87);
+const v = import.meta.env.BENCH_KEY_01993;
+const value75994 = compute(value, 43);
+const value49953 = compute(value, 95);
+const value96114 = compute(value, 84);
+// note 42145: keep this in sync with the handler
+const value88962 = compute(value, 13);
+const value21478 = compute(value, 41);
+const value5026 = compute(value, 79);
+const value81655 = compute(value, 78);
+const value92750 = compute(value, 18);
+const value37633 = compute(value, 94);
+const value649 = compute(value, 67);
+const value69139 = compute(value, 75);
+const value1590 = compute(value, 38);
+const value95580 = compute(value, 35);
+const value55200 = compute(value, 7);
+const value50835 = compute(value, 7);
+const value20773 = compute(value, 15);
+const v = process.env["BENCH_KEY_00564"];
+const value86217 = compute(value, 81);
+const value68407 = compute(value, 22);
+const value92067 = compute(value, 14);
+const value42812 = compute(value, 35);
+const value46510 = compute(value, 47);
+const value4071 = compute(value, 94);
+const value42113 = compute(value, 15);
+const value20688 = compute(value, 27);
+const value25491 = compute(value, 77);
+const value72462 = compute(value, 3);
+const value5247 = compute(value, 9);
+const v = process.env["BENCH_KEY_01372"];
+const value41577 = compute(value, 61);
+// note 98201: keep this in sync with the handler
+// note 71300: keep this in sync with the handler
+// note 20319: keep this in sync with the handler
+const value69908 = compute(value, 68);
+const value9527 = compute(value, 21);
+const value73933 = compute(value, 19);
+const value72565 = compute(value, 9);
+const value86269 = compute(value, 36);
+// note 68115: keep this in sync with the handler
+// note 94206: keep this in sync with the handler
+const value60468 = compute(value, 37);
+const value40634 = compute(value, 88);
+const value78704 = compute(value, 37);
+const value43906 = compute(value, 62);
+const value13677 = compute(value, 0);
+const value82203 = compute(value, 44);
+const value23762 = compute(value, 94);
+const v = import.meta.env.BENCH_KEY_01163;
+const value33126 = compute(value, 49);
+const value96567 = compute(value, 52);
+// note 16184: keep this in sync with the handler
+const value8711 = compute(value, 78);
+// note 47345: keep this in sync with the handler
+const value88409 = compute(value, 42);
+const value76657 = compute(value, 27);
+// note 31077: keep this in sync with the handler
+const value76328 = compute(value, 86);
+const value60967 = compute(value, 51);
+const value95518 = compute(value, 70);
+const value48658 = compute(value, 61);
+const value97942 = compute(value, 69);
+const v = import.meta.env.BENCH_KEY_01595;
+const value90959 = compute(value, 70);
+const value46556 = compute(value, 93);
+const value91104 = compute(value, 21);
+const value42923 = compute(value, 49);
+const value8100 = compute(value, 49);
+const value86167 = compute(value, 31);
+const value11021 = compute(value, 60);
+const value630 = compute(value, 48);
+const value9828 = compute(value, 31);
+// note 13142: keep this in sync with the handler
+const value61056 = compute(value, 43);
+const value20259 = compute(value, 83);
+const v = process.env.BENCH_KEY_00389;
+// note 56868: keep this in sync with the handler
+const value6426 = compute(value, 24);
+const value51738 = compute(value, 37);
+const value59188 = compute(value, 18);
+const value27408 = compute(value, 54);
+const value88270 = compute(value, 0);
+const value69093 = compute(value, 29);
+const v = process.env["BENCH_KEY_01816"];
+const value75809 = compute(value, 52);
+const value14405 = compute(value, 49);
+// note 46702: keep this in sync with the handler
+const value55985 = compute(value, 16);
+const value72654 = compute(value, 1);
+const value85713 = compute(value, 62);
+const value11796 = compute(value, 59);
+const value43269 = compute(value, 7);
+const value88989 = compute(value, 40);
+const value46289 = compute(value, 20);
+const value22210 = compute(value, 94);
+const value86587 = compute(value, 63);
+const value87004 = compute(value, 92);
+const v = process.env.BENCH_KEY_01146;
+const value34396 = compute(value, 58);
+const value34858 = compute(value, 35);
+// note 3231: keep this in sync with the handler
+const value27627 = compute(value, 79);
+const value50098 = compute(value, 46);
+const value61386 = compute(value, 82);
+const value64986 = compute(value, 93);
+// note 41470: keep this in sync with the handler
+// note 22358: keep this in sync with the handler
+const value52216 = compute(value, 30);
+// note 43604: keep this in sync with the handler
+const v = import.meta.env.BENCH_KEY_00075;
+const value95088 = compute(value, 28);
+const value18917 = compute(value, 2);
+const value75294 = compute(value, 22);
+const value80253 = compute(value, 34);
+const value51188 = compute(value, 69);
+const value14832 = compute(value, 88);
+const value58751 = compute(value, 66);
+// note 61004: keep this in sync with the handler
+const v = process.env["BENCH_KEY_00965"];
+const value65580 = compute(value, 8);
+const value99054 = compute(value, 17);
+const value41679 = compute(value, 66);
+const value55308 = compute(value, 18);
+const value68336 = compute(value, 48);
+const value7738 = compute(value, 75);
+const value7638 = compute(value, 72);
+const value76510 = compute(value, 74);
+const value60153 = compute(value, 13);
+const value38296 = compute(value, 78);
+const value29862 = compute(value, 83);
+const value37082 = compute(value, 28);
+const value17946 = compute(value, 1);
+const value63602 = compute(value, 67);
+const value90511 = compute(value, 10);
+const value48949 = compute(value, 61);
+// note 93459: keep this in sync with the handler
+// note 70752: keep this in sync with the handler
+const value68930 = compute(value, 60);
+const v = process.env["BENCH_KEY_01708"];
+const value5200 = compute(value, 59);
+const value36866 = compute(value, 6);
+const value85709 = compute(value, 58);
+const value71001 = compute(value, 94);
+const value30744 = compute(value, 92);
+const value15817 = compute(value, 6);
+const value51408 = compute(value, 95);
+const value27320 = compute(value, 63);
+// note 75684: keep this in sync with the handler
+const value31935 = compute(value, 22);
+const value37876 = compute(value, 46);
+// note 85803: keep this in sync with the handler
+const value35500 = compute(value, 95);
+const value80631 = compute(value, 24);
+const value85365 = compute(value, 5);
+const value2878 = compute(value, 65);
+const value7366 = compute(value, 91);
+const value83106 = compute(value, 74);
+const v = process.env.BENCH_KEY_01737;
+const value60105 = compute(value, 62);
+const value6042 = compute(value, 28);
+const value49428 = compute(value, 55);
+// note 23805: keep this in sync with the handler
+const value17664 = compute(value, 10);
+const value62075 = compute(value, 92);
+const value74676 = compute(value, 83);
+const value37905 = compute(value, 75);
+const value30866 = compute(value, 20);
+const v = import.meta.env.BENCH_KEY_01040;
+const value99055 = compute(value, 18);
+const value89638 = compute(value, 10);
+const value16283 = compute(value, 84);
+const value67904 = compute(value, 4);
+const value7498 = compute(value, 29);
+const value38448 = compute(value, 36);
+const value24458 = compute(value, 14);
+const value78822 = compute(value, 58);
+const value98891 = compute(value, 48);
+const value75925 = compute(value, 71);
+const value1045 = compute(value, 75);
+const value53478 = compute(value, 31);
+const value72388 = compute(value, 26);
+const value46059 = compute(value, 81);
+// note 59770: keep this in sync with the handler
+// note 52848: keep this in sync with the handler
+const value88648 = compute(value, 87);
+const v = process.env["BENCH_KEY_00059"];
+const value67744 = compute(value, 38);
+// note 17686: keep this in sync with the handler
+// note 68580: keep this in sync with the handler
+const value69026 = compute(value, 59);
+const value54941 = compute(value, 39);
+const value58402 = compute(value, 8);
@@ -0,0 +1,237 @@
+value15513 = compute(value, 90)
+value3467 = compute(value, 72)
+value73310 = compute(value, 75)
+value8942 = compute(value, 18)
+value70187 = compute(value, 56)
+# note 88633: keep this in sync with the handler
+value78985 = compute(value, 27)
+value62332 = compute(value, 58)
+value46111 = compute(value, 36)
+value93083 = compute(value, 60)
+# note 27467: keep this in sync with the handler
+const v = os.environ["BENCH_KEY_01086"];
+# note 94172: keep this in sync with the handler
+value36170 = compute(value, 86)
+value68034 = compute(value, 37)
+value42021 = compute(value, 20)
+value79104 = compute(value, 49)
+# note 6718: keep this in sync with the handler
+value73084 = compute(value, 43)
+value39529 = compute(value, 50)
+value58391 = compute(value, 94)
+value12565 = compute(value, 52)
+value57579 = compute(value, 58)
+value1153 = compute(value, 86)
+value55121 = compute(value, 25)
+value42710 = compute(value, 30)
+value98555 = compute(value, 3)
+const v = os.getenv("BENCH_KEY_01980");
+value92864 = compute(value, 35)
+value51895 = compute(value, 0)
+value96767 = compute(value, 58)
+value40101 = compute(value, 40)
+value66797 = compute(value, 61)
+value58749 = compute(value, 64)
+value6701 = compute(value, 8)
+value48579 = compute(value, 79)
+value7696 = compute(value, 33)
+value40211 = compute(value, 53)
+# note 49607: keep this in sync with the handler
+value67181 = compute(value, 57)
+# note 1924: keep this in sync with the handler
+# note 28038: keep this in sync with the handler
+value65452 = compute(value, 74)
+# note 83296: keep this in sync with the handler
+const v = os.environ["BENCH_KEY_00685"];
+value11658 = compute(value, 18)
+value93110 = compute(value, 87)
+value25172 = compute(value, 49)
+value72191 = compute(value, 23)
+value5233 = compute(value, 92)
+value57008 = compute(value, 69)
+value68770 = compute(value, 94)
+# note 73873: keep this in sync with the handler
+value84433 = compute(value, 43)
+value77518 = compute(value, 15)
+const v = os.environ["BENCH_KEY_00784"];
+value40198 = compute(value, 40)
+value48720 = compute(value, 26)
+value1856 = compute(value, 13)
+value64619 = compute(value, 17)
+# note 21506: keep this in sync with the handler
+value59778 = compute(value, 26)
+value919 = compute(value, 46)
+value88409 = compute(value, 42)
+value33381 = compute(value, 13)
+value78897 = compute(value, 36)
+value45127 = compute(value, 22)
+value4854 = compute(value, 4)
+value31114 = compute(value, 74)
+value74532 = compute(value, 36)
+value74684 = compute(value, 91)
+# note 88038: keep this in sync with the handler
+# note 38970: keep this in sync with the handler
+value46478 = compute(value, 15)
+value99219 = compute(value, 85)
+const v = os.environ.get('BENCH_KEY_00420');
+# note 28796: keep this in sync with the handler
+value58237 = compute(value, 37)
+value55298 = compute(value, 8)
+value22883 = compute(value, 88)
+value52090 = compute(value, 1)
+value9182 = compute(value, 64)
+value45217 = compute(value, 15)
+value13783 = compute(value, 9)
+value59302 = compute(value, 35)
+value33214 = compute(value, 40)
+value2046 = compute(value, 9)
+value1482 = compute(value, 27)
+value24176 = compute(value, 23)
+value70152 = compute(value, 21)
+value38429 = compute(value, 17)
+value18792 = compute(value, 71)
+value27720 = compute(value, 75)
+value75535 = compute(value, 69)
+value85923 = compute(value, 78)
+value80559 = compute(value, 49)
+value67765 = compute(value, 59)
+value1651 = compute(value, 2)
+const v = os.environ.get('BENCH_KEY_00910');
+value63343 = compute(value, 2)
+value92119 = compute(value, 66)
+value72580 = compute(value, 24)
+# note 19705: keep this in sync with the handler
+value34925 = compute(value, 5)
+value56976 = compute(value, 37)
+value73899 = compute(value, 82)
+# note 78122: keep this in sync with the handler
+value41343 = compute(value, 21)
+value19744 = compute(value, 53)
+value15256 = compute(value, 27)
+value8292 = compute(value, 47)
+const v = os.environ.get('BENCH_KEY_01441');
+value27025 = compute(value, 59)
+value18465 = compute(value, 35)
+value4527 = compute(value, 65)
+value43826 = compute(value, 79)
+value74133 = compute(value, 25)
+value30510 = compute(value, 52)
+value44470 = compute(value, 44)
+value50639 = compute(value, 5)
+# note 32102: keep this in sync with the handler
+value38204 = compute(value, 83)
+value77579 = compute(value, 76)
+value79808 = compute(value, 74)
+value91493 = compute(value, 22)
+value69125 = compute(value, 61)
+value25641 = compute(value, 33)
+# note 74049: keep this in sync with the handler
+value11740 = compute(value, 3)
+value46768 = compute(value, 14)
+# note 13909: keep this in sync with the handler
+value41160 = compute(value, 32)
+value2902 = compute(value, 89)
+value54087 = compute(value, 58)
+const v = os.environ["BENCH_KEY_00630"];
+value67913 = compute(value, 13)
+# note 50001: keep this in sync with the handler
+value33547 = compute(value, 82)
+# note 75653: keep this in sync with the handler
+value55222 = compute(value, 29)
+value60744 = compute(value, 22)
+# note 91493: keep this in sync with the handler
+value50988 = compute(value, 63)
+value58855 = compute(value, 73)
+value61184 = compute(value, 74)
+value45568 = compute(value, 75)
+value16982 = compute(value, 7)
+value12327 = compute(value, 8)
+value17220 = compute(value, 51)
+value66607 = compute(value, 65)
+const v = os.environ["BENCH_KEY_00294"];
+value46889 = compute(value, 38)
+value99710 = compute(value, 91)
+value9196 = compute(value, 78)
+value69080 = compute(value, 16)
+value52153 = compute(value, 64)
+value71741 = compute(value, 58)
+value12414 = compute(value, 95)
+# note 69418: keep this in sync with the handler
+value78367 = compute(value, 88)
+value69651 = compute(value, 5)
+value33082 = compute(value, 5)
+value82056 = compute(value, 91)
+value29565 = compute(value, 77)
+value55281 = compute(value, 88)
+const v = os.getenv("BENCH_KEY_00798");
+value75692 = compute(value, 32)
+value17592 = compute(value, 35)
+value66437 = compute(value, 89)
+# note 72928: keep this in sync with the handler
+value18209 = compute(value, 70)
+value2555 = compute(value, 33)
+value72155 = compute(value, 84)
+value848 = compute(value, 72)
+value50345 = compute(value, 2)
+value63464 = compute(value, 26)
+value53892 = compute(value, 57)
+value4104 = compute(value, 30)
+value36394 = compute(value, 19)
+value92092 = compute(value, 39)
+value94092 = compute(value, 2)
+value30996 = compute(value, 53)
+value86875 = compute(value, 60)
+value70452 = compute(value, 30)
+value50022 = compute(value, 67)
+value80636 = compute(value, 29)
+value93209 = compute(value, 89)
+const v = os.getenv("BENCH_KEY_00256");
+value8329 = compute(value, 84)
+value64477 = compute(value, 69)
+value79571 = compute(value, 31)
+value50222 = compute(value, 73)
+value44298 = compute(value, 66)
+value14124 = compute(value, 59)
+value38932 = compute(value, 35)
+value95598 = compute(value, 53)
+value14314 = compute(value, 55)
+const v = os.environ.get('BENCH_KEY_01299');
+value1097 = compute(value, 30)
+value30393 = compute(value, 32)
+value24059 = compute(value, 3)
+value16290 = compute(value, 91)
+value95461 = compute(value, 13)
+value98335 = compute(value, 74)
+value68935 = compute(value, 65)
+value24048 = compute(value, 89)
+# note 35286: keep this in sync with the handler
+value6873 = compute(value, 83)
+value73989 = compute(value, 75)
+value36888 = compute(value, 28)
+value29887 = compute(value, 11)
+value96071 = compute(value, 41)
+value28905 = compute(value, 96)
+value38620 = compute(value, 14)
+value24191 = compute(value, 38)
+# note 78119: keep this in sync with the handler
+# note 95811: keep this in sync with the handler
+value57540 = compute(value, 19)
+value40461 = compute(value, 12)
+value50655 = compute(value, 21)
+const v = os.getenv("BENCH_KEY_00465");
+# note 60161: keep this in sync with the handler
+value62955 = compute(value, 2)
+# note 30500: keep this in sync with the handler
+value26162 = compute(value, 69)
+value58227 = compute(value, 27)
+value96107 = compute(value, 77)
+# note 91899: keep this in sync with the handler
+value9772 = compute(value, 72)
+# note 47948: keep this in sync with the handler
+value70379 = compute(value, 54)
+const v = os.getenv("BENCH_KEY_01654");
+value13581 = compute(value, 1)
+# note 96926: keep this in sync with the handler
+value24917 = compute(value, 85)
+value99986 = compute(value, 76)
+value39995 = compute(value, 31)
@@ -0,0 +1,242 @@
+value30905 = compute(value, 59)
+value50081 = compute(value, 29)
+value51946 = compute(value, 51)
+value39522 = compute(value, 43)
+value9830 = compute(value, 33)
+value2304 = compute(value, 73)
+value26757 = compute(value, 82)
+value96134 = compute(value, 7)
+value96996 = compute(value, 93)
+value49203 = compute(value, 24)
+value39348 = compute(value, 63)
+value65353 = compute(value, 72)
+value7290 = compute(value, 15)
+const v = os.environ["BENCH_KEY_01200"];
+value31850 = compute(value, 34)
+value187 = compute(value, 90)
+# note 97714: keep this in sync with the handler
+value8134 = compute(value, 83)
+# note 15475: keep this in sync with the handler
+# note 43549: keep this in sync with the handler
+value83066 = compute(value, 34)
+value96280 = compute(value, 56)
+value73879 = compute(value, 62)
+value10903 = compute(value, 39)
+value89684 = compute(value, 56)
+# note 5625: keep this in sync with the handler
+const v = os.environ.get('BENCH_KEY_01833');
+value92808 = compute(value, 76)
+value58556 = compute(value, 65)
+value33787 = compute(value, 31)
+value55397 = compute(value, 10)
+value38520 = compute(value, 11)
+value2020 = compute(value, 80)
+value94262 = compute(value, 75)
+value62412 = compute(value, 41)
+value54845 = compute(value, 40)
+value12147 = compute(value, 22)
+# note 49812: keep this in sync with the handler
+value6382 = compute(value, 77)
+value26134 = compute(value, 41)
+value76222 = compute(value, 77)
+value83738 = compute(value, 27)
+value84712 = compute(value, 31)
+value29944 = compute(value, 68)
+value60816 = compute(value, 94)
+const v = os.environ["BENCH_KEY_00103"];
+value91213 = compute(value, 33)
+value97766 = compute(value, 87)
+value29936 = compute(value, 60)
+value61943 = compute(value, 57)
+# note 64344: keep this in sync with the handler
+value53419 = compute(value, 69)
+value6524 = compute(value, 25)
+value54449 = compute(value, 32)
+value39200 = compute(value, 12)
+const v = os.getenv("BENCH_KEY_01503");
+value33545 = compute(value, 80)
+value15006 = compute(value, 68)
+value13586 = compute(value, 6)
+value31487 = compute(value, 59)
+value61307 = compute(value, 3)
+value68015 = compute(value, 18)
+# note 58466: keep this in sync with the handler
+value77598 = compute(value, 95)
+value92132 = compute(value, 79)
+# note 21677: keep this in sync with the handler
+value20860 = compute(value, 5)
+value89198 = compute(value, 55)
+value41163 = compute(value, 35)
+value31184 = compute(value, 47)
+value202 = compute(value, 8)
+# note 33353: keep this in sync with the handler
+value37499 = compute(value, 57)
+const v = os.environ["BENCH_KEY_00238"];
+value7890 = compute(value, 33)
+# note 98203: keep this in sync with the handler
+value18031 = compute(value, 86)
+value64994 = compute(value, 4)
+value71769 = compute(value, 86)
+# note 79858: keep this in sync with the handler
+value43018 = compute(value, 47)
+value86507 = compute(value, 80)
+value99282 = compute(value, 51)
+value9530 = compute(value, 24)
+value44445 = compute(value, 19)
+value45656 = compute(value, 66)
+value50338 = compute(value, 92)
+value52161 = compute(value, 72)
+value72472 = compute(value, 13)
+value98822 = compute(value, 76)
+value13162 = compute(value, 67)
+value7575 = compute(value, 9)
+value49209 = compute(value, 30)
+value496 = compute(value, 11)
+value7189 = compute(value, 11)
+value93885 = compute(value, 86)
+value76099 = compute(value, 51)
+const v = os.environ["BENCH_KEY_00123"];
+value40290 = compute(value, 35)
+value86535 = compute(value, 11)
+value43728 = compute(value, 78)
+value22109 = compute(value, 90)
+value49520 = compute(value, 50)
+value45913 = compute(value, 32)
+value5084 = compute(value, 40)
+value84771 = compute(value, 90)
+# note 4167: keep this in sync with the handler
+value80031 = compute(value, 6)
+value20519 = compute(value, 52)
+const v = os.environ["BENCH_KEY_01505"];
+value56178 = compute(value, 15)
+# note 19003: keep this in sync with the handler
+value95586 = compute(value, 41)
+value2957 = compute(value, 47)
+value1676 = compute(value, 27)
+value27634 = compute(value, 86)
+value43541 = compute(value, 85)
+value66047 = compute(value, 87)
+# note 5818: keep this in sync with the handler
+value48145 = compute(value, 33)
+value25372 = compute(value, 55)
+value95172 = compute(value, 15)
+value83435 = compute(value, 15)
+const v = os.getenv("BENCH_KEY_00950");
+value25851 = compute(value, 49)
+value43719 = compute(value, 69)
+# note 98733: keep this in sync with the handler
+value52876 = compute(value, 11)
+# note 45782: keep this in sync with the handler
+value87798 = compute(value, 13)
+# note 12968: keep this in sync with the handler
+const v = os.environ["BENCH_KEY_01696"];
+value5814 = compute(value, 91)
+value12005 = compute(value, 74)
+value7958 = compute(value, 4)
+value70420 = compute(value, 95)
+value36232 = compute(value, 51)
+value89445 = compute(value, 11)
+value47079 = compute(value, 34)
+value9134 = compute(value, 16)
+value52440 = compute(value, 60)
+value11690 = compute(value, 50)
+value67237 = compute(value, 16)
+value40680 = compute(value, 37)
+value62511 = compute(value, 43)
+# note 6154: keep this in sync with the handler
+value41831 = compute(value, 24)
+value18014 = compute(value, 69)
+value32092 = compute(value, 82)
+value24782 = compute(value, 47)
+value9215 = compute(value, 0)
+value26865 = compute(value, 93)
+const v = os.environ["BENCH_KEY_01182"];
+value50848 = compute(value, 20)
+value8218 = compute(value, 70)
+value3255 = compute(value, 54)
+value89384 = compute(value, 47)
+value16504 = compute(value, 14)
+value45177 = compute(value, 72)
+value22293 = compute(value, 80)
+value27166 = compute(value, 6)
+value52203 = compute(value, 17)
+value76847 = compute(value, 23)
+value7758 = compute(value, 95)
+value14869 = compute(value, 28)
+value45429 = compute(value, 33)
+value1081 = compute(value, 14)
+value18992 = compute(value, 77)
+# note 44386: keep this in sync with the handler
+value56313 = compute(value, 53)
+value41452 = compute(value, 33)
+value71974 = compute(value, 0)
+value99177 = compute(value, 43)
+value33134 = compute(value, 57)
+value32509 = compute(value, 14)
+value79828 = compute(value, 94)
+const v = os.environ.get('BENCH_KEY_01530');
+value64109 = compute(value, 89)
+value47518 = compute(value, 85)
+value15298 = compute(value, 69)
+value18776 = compute(value, 55)
+value81726 = compute(value, 52)
+value29746 = compute(value, 64)
+value99581 = compute(value, 59)
+value80869 = compute(value, 68)
+value14197 = compute(value, 35)
+value69666 = compute(value, 20)
+value23843 = compute(value, 78)
+value31629 = compute(value, 7)
+value93498 = compute(value, 87)
+value34441 = compute(value, 6)
+value2757 = compute(value, 41)
+value81116 = compute(value, 24)
+const v = os.environ["BENCH_KEY_01965"];
+value38603 = compute(value, 94)
+value98238 = compute(value, 74)
+value57360 = compute(value, 33)
+value96649 = compute(value, 37)
+value15695 = compute(value, 78)
+# note 62637: keep this in sync with the handler
+value24414 = compute(value, 67)
+value62240 = compute(value, 63)
+value39653 = compute(value, 77)
+value8479 = compute(value, 40)
+value4351 = compute(value, 83)
+value91947 = compute(value, 88)
+value16722 = compute(value, 38)
+value66986 = compute(value, 56)
+const v = os.environ["BENCH_KEY_00855"];
+value27240 = compute(value, 80)
+value94342 = compute(value, 58)
+# note 4059: keep this in sync with the handler
+value11175 = compute(value, 20)
+value63841 = compute(value, 15)
+value6971 = compute(value, 84)
+value22453 = compute(value, 46)
+value4166 = compute(value, 92)
+value63855 = compute(value, 29)
+value44155 = compute(value, 20)
+# note 52955: keep this in sync with the handler
+value50479 = compute(value, 39)
+value88668 = compute(value, 10)
+value76760 = compute(value, 33)
+value35687 = compute(value, 88)
+const v = os.environ["BENCH_KEY_01760"];
+value45935 = compute(value, 54)
+value26498 = compute(value, 17)
+value84496 = compute(value, 9)
+value16246 = compute(value, 47)
+value4518 = compute(value, 56)
+value176 = compute(value, 79)
+value58439 = compute(value, 45)
+value33512 = compute(value, 47)
+value27159 = compute(value, 96)
+value89947 = compute(value, 28)
+value81363 = compute(value, 77)
+value18950 = compute(value, 35)
+const v = os.environ.get('BENCH_KEY_00689');
+value87952 = compute(value, 70)
+value50455 = compute(value, 15)
+value8415 = compute(value, 73)
+value89443 = compute(value, 9)
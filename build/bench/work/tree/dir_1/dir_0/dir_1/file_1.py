@@ -0,0 +1,241 @@
+value51968 = compute(value, 73)
+value27565 = compute(value, 17)
+# note 88242: keep this in sync with the handler
+value9170 = compute(value, 52)
+value7140 = compute(value, 59)
+value35664 = compute(value, 65)
+const v = os.environ["BENCH_KEY_01623"];
+value9656 = compute(value, 53)
+# note 42525: keep this in sync with the handler
+value21474 = compute(value, 37)
+value35058 = compute(value, 41)
+value95012 = compute(value, 49)
+value59936 = compute(value, 87)
+value23009 = compute(value, 20)
+value40770 = compute(value, 30)
+value5497 = compute(value, 65)
+value55987 = compute(value, 18)
+value3774 = compute(value, 88)
+value72467 = compute(value, 8)
+value93461 = compute(value, 50)
+# note 762: keep this in sync with the handler
+value59082 = compute(value, 9)
+value30167 = compute(value, 0)
+value74472 = compute(value, 73)
+const v = os.getenv("BENCH_KEY_01052");
+value57569 = compute(value, 48)
+value12590 = compute(value, 77)
+value85930 = compute(value, 85)
+value90133 = compute(value, 20)
+value34731 = compute(value, 5)
+value33823 = compute(value, 67)
+value19404 = compute(value, 4)
+value27660 = compute(value, 15)
+value71580 = compute(value, 91)
+value39158 = compute(value, 67)
+value99248 = compute(value, 17)
+value91825 = compute(value, 63)
+value55659 = compute(value, 78)
+# note 17634: keep this in sync with the handler
+value33448 = compute(value, 80)
+value16165 = compute(value, 63)
+value86329 = compute(value, 96)
+value74585 = compute(value, 89)
+value66302 = compute(value, 51)
+value8804 = compute(value, 74)
+const v = os.getenv("BENCH_KEY_00101");
+value18555 = compute(value, 28)
+value75854 = compute(value, 0)
+value43070 = compute(value, 2)
+value95442 = compute(value, 91)
+value46976 = compute(value, 28)
+# note 2237: keep this in sync with the handler
+value68257 = compute(value, 66)
+value33348 = compute(value, 77)
+value76281 = compute(value, 39)
+value23364 = compute(value, 84)
+value69710 = compute(value, 64)
+value81844 = compute(value, 73)
+value62415 = compute(value, 44)
+value46950 = compute(value, 2)
+# note 46459: keep this in sync with the handler
+# note 80105: keep this in sync with the handler
+const v = os.getenv("BENCH_KEY_00643");
+value72431 = compute(value, 69)
+value13554 = compute(value, 71)
+value23671 = compute(value, 3)
+# note 17848: keep this in sync with the handler
+value36109 = compute(value, 25)
+value85498 = compute(value, 41)
+value62247 = compute(value, 70)
+value17176 = compute(value, 7)
+value68230 = compute(value, 39)
+value98289 = compute(value, 28)
+value30106 = compute(value, 36)
+value59732 = compute(value, 77)
+const v = os.environ.get('BENCH_KEY_01469');
+value46712 = compute(value, 55)
+value27982 = compute(value, 46)
+value82277 = compute(value, 21)
+value99775 = compute(value, 59)
+value37623 = compute(value, 84)
+value92538 = compute(value, 0)
+value42650 = compute(value, 67)
+value9567 = compute(value, 61)
+value48969 = compute(value, 81)
+value116 = compute(value, 19)
+value57977 = compute(value, 68)
+value32418 = compute(value, 20)
+value58994 = compute(value, 18)
+value36737 = compute(value, 71)
+value89145 = compute(value, 2)
+value79314 = compute(value, 65)
+value91309 = compute(value, 32)
+value62364 = compute(value, 90)
+value25256 = compute(value, 36)
+const v = os.environ["BENCH_KEY_01677"];
+value55477 = compute(value, 90)
+value33101 = compute(value, 24)
+value30099 = compute(value, 29)
+value94345 = compute(value, 61)
+value77543 = compute(value, 40)
+# note 88551: keep this in sync with the handler
+value95912 = compute(value, 76)
+value65763 = compute(value, 94)
+value28547 = compute(value, 29)
+value12710 = compute(value, 3)
+const v = os.environ["BENCH_KEY_00869"];
+value95945 = compute(value, 12)
+# note 67800: keep this in sync with the handler
+value99214 = compute(value, 80)
+value96128 = compute(value, 1)
+value78690 = compute(value, 23)
+value3244 = compute(value, 43)
+# note 74943: keep this in sync with the handler
+value27262 = compute(value, 5)
+const v = os.environ["BENCH_KEY_00596"];
+value2913 = compute(value, 3)
+value13670 = compute(value, 90)
+value72266 = compute(value, 1)
+value22851 = compute(value, 56)
+value10895 = compute(value, 31)
+value92255 = compute(value, 8)
+value59595 = compute(value, 37)
+value30805 = compute(value, 56)
+value34275 = compute(value, 34)
+value92246 = compute(value, 96)
+value40517 = compute(value, 68)
+# note 51723: keep this in sync with the handler
+value87594 = compute(value, 3)
+value67284 = compute(value, 63)
+value16555 = compute(value, 65)
+value52676 = compute(value, 5)
+# note 68397: keep this in sync with the handler
+value80320 = compute(value, 4)
+value221 = compute(value, 27)
+# note 25467: keep this in sync with the handler
+const v = os.environ.get('BENCH_KEY_01019');
+value70623 = compute(value, 7)
+value64301 = compute(value, 87)
+value45378 = compute(value, 79)
+value32130 = compute(value, 23)
+value77598 = compute(value, 95)
+value86089 = compute(value, 50)
+value61769 = compute(value, 77)
+value58827 = compute(value, 45)
+value90650 = compute(value, 52)
+value20634 = compute(value, 70)
+value6455 = compute(value, 53)
+value49026 = compute(value, 41)
+value85483 = compute(value, 26)
+# note 68840: keep this in sync with the handler
+value61902 = compute(value, 16)
+const v = os.environ.get('BENCH_KEY_00339');
+value75966 = compute(value, 15)
+value4648 = compute(value, 89)
+value20181 = compute(value, 5)
+value63327 = compute(value, 83)
+value96774 = compute(value, 65)
+value34943 = compute(value, 23)
+value14836 = compute(value, 92)
+value64554 = compute(value, 49)
+value26221 = compute(value, 31)
+value35872 = compute(value, 79)
+# note 71583: keep this in sync with the handler
+const v = os.environ.get('BENCH_KEY_01722');
+value48471 = compute(value, 68)
+value42242 = compute(value, 47)
+value40297 = compute(value, 42)
+value45194 = compute(value, 89)
+# note 3461: keep this in sync with the handler
+value62925 = compute(value, 69)
+value45753 = compute(value, 66)
+value76600 = compute(value, 67)
+value83917 = compute(value, 12)
+value77878 = compute(value, 84)
+# note 81317: keep this in sync with the handler
+value23616 = compute(value, 45)
+value47344 = compute(value, 8)
+value80679 = compute(value, 72)
+# note 41467: keep this in sync with the handler
+value13586 = compute(value, 6)
+value88897 = compute(value, 45)
+value99935 = compute(value, 25)
+value59675 = compute(value, 20)
+value20968 = compute(value, 16)
+# note 92840: keep this in sync with the handler
+value97192 = compute(value, 95)
+const v = os.environ["BENCH_KEY_00497"];
+value3347 = compute(value, 49)
+value38770 = compute(value, 67)
+value97817 = compute(value, 41)
+value57715 = compute(value, 0)
+value69722 = compute(value, 76)
+value4994 = compute(value, 47)
+value5278 = compute(value, 40)
+value7170 = compute(value, 89)
+value8373 = compute(value, 31)
+value57134 = compute(value, 1)
+# note 16632: keep this in sync with the handler
+value93628 = compute(value, 23)
+value55914 = compute(value, 42)
+value95901 = compute(value, 65)
+value247 = compute(value, 53)
+# note 94210: keep this in sync with the handler
+value65142 = compute(value, 55)
+value34972 = compute(value, 52)
+value65631 = compute(value, 59)
+const v = os.environ["BENCH_KEY_00717"];
+value31729 = compute(value, 10)
+value91888 = compute(value, 29)
+value46377 = compute(value, 11)
+value39816 = compute(value, 46)
+value80851 = compute(value, 50)
+value70358 = compute(value, 33)
+value31185 = compute(value, 48)
+value83577 = compute(value, 60)
+value91276 = compute(value, 96)
+value3396 = compute(value, 1)
+value68260 = compute(value, 69)
+value92061 = compute(value, 8)
+value875 = compute(value, 2)
+value94879 = compute(value, 13)
+# note 27619: keep this in sync with the handler
+const v = os.getenv("BENCH_KEY_00717");
+value6062 = compute(value, 48)
+value61224 = compute(value, 17)
+value803 = compute(value, 27)
+value36236 = compute(value, 55)
+value89554 = compute(value, 23)
+value21903 = compute(value, 78)
+value7873 = compute(value, 16)
+# note 35411: keep this in sync with the handler
+value7510 = compute(value, 41)
+value97540 = compute(value, 55)
+value46329 = compute(value, 60)
+value56588 = compute(value, 37)
+value96589 = compute(value, 74)
+value9275 = compute(value, 60)
+value18112 = compute(value, 70)
+value48067 = compute(value, 52)
+value99612 = compute(value, 90)
@@ -0,0 +1,205 @@
+const value45862 = compute(value, 78);
+const value19385 = compute(value, 82);
+const value99477 = compute(value, 52);
+const value38985 = compute(value, 88);
+// note 34980: keep this in sync with the handler
+const v = process.env["BENCH_KEY_00028"];
+const value68224 = compute(value, 33);
+const value29958 = compute(value, 82);
+const value90845 = compute(value, 53);
+const value84578 = compute(value, 91);
+const value62480 = compute(value, 12);
+// note 20969: keep this in sync with the handler
+const value88581 = compute(value, 20);
+const value91904 = compute(value, 45);
+const value70881 = compute(value, 71);
+const value15987 = compute(value, 79);
+const value15629 = compute(value, 12);
+const value89505 = compute(value, 71);
+const value61502 = compute(value, 4);
+const value2777 = compute(value, 61);
+const value61160 = compute(value, 50);
+const value47257 = compute(value, 18);
+const v = process.env["BENCH_KEY_00484"];
+const value59588 = compute(value, 30);
+const value9168 = compute(value, 50);
+const value92869 = compute(value, 40);
+const value99468 = compute(value, 43);
+const value66211 = compute(value, 57);
+const value11634 = compute(value, 91);
+const value13330 = compute(value, 41);
+const value96880 = compute(value, 74);
+const value60963 = compute(value, 47);
+const v = import.meta.env.BENCH_KEY_01448;
+const value55569 = compute(value, 85);
+const value40099 = compute(value, 38);
+// note 55500: keep this in sync with the handler
+const value10740 = compute(value, 70);
+const value20293 = compute(value, 20);
+// note 43044: keep this in sync with the handler
+// note 33597: keep this in sync with the handler
+const value35007 = compute(value, 87);
+// note 17515: keep this in sync with the handler
+const value39541 = compute(value, 62);
+const value53414 = compute(value, 64);
+const v = process.env.BENCH_KEY_00776;
+const value58447 = compute(value, 53);
+const value51499 = compute(value, 89);
+const value8114 = compute(value, 63);
+const value43555 = compute(value, 2);
+const value66060 = compute(value, 3);
+const value10436 = compute(value, 57);
+const value96344 = compute(value, 23);
+const value81306 = compute(value, 20);
+const v = import.meta.env.BENCH_KEY_00558;
+const value95211 = compute(value, 54);
+const value76915 = compute(value, 91);
+const value96014 = compute(value, 81);
+const value2592 = compute(value, 70);
+const value72404 = compute(value, 42);
+const value9693 = compute(value, 90);
+const value96187 = compute(value, 60);
+const v = process.env.BENCH_KEY_00581;
+const value77408 = compute(value, 2);
+const value96837 = compute(value, 31);
+const value68299 = compute(value, 11);
+// note 16625: keep this in sync with the handler
+const value74172 = compute(value, 64);
+// note 74090: keep this in sync with the handler
+const value76740 = compute(value, 13);
+const value48021 = compute(value, 6);
+// note 87817: keep this in sync with the handler
+const value24953 = compute(value, 24);
+const value39160 = compute(value, 69);
+// note 66098: keep this in sync with the handler
+const value89834 = compute(value, 12);
+const value30991 = compute(value, 48);
+const value93064 = compute(value, 41);
+const value96111 = compute(value, 81);
+const value32466 = compute(value, 68);
+const v = process.env.BENCH_KEY_00167;
+const value61686 = compute(value, 91);
+const value79422 = compute(value, 76);
+const value43113 = compute(value, 45);
+const value76428 = compute(value, 89);
+const value4073 = compute(value, 96);
+const value63047 = compute(value, 94);
+const value66035 = compute(value, 75);
+const value54095 = compute(value, 66);
+const value92976 = compute(value, 50);
+const value5221 = compute(value, 80);
+// note 20493: keep this in sync with the handler
+const value33454 = compute(value, 86);
+const value78419 = compute(value, 43);
+// note 41665: keep this in sync with the handler
+const value52165 = compute(value, 76);
+const value13738 = compute(value, 61);
+const value92371 = compute(value, 27);
+const value30393 = compute(value, 32);
+// note 86876: keep this in sync with the handler
+const v = process.env.BENCH_KEY_01410;
+const value24522 = compute(value, 78);
+const value10981 = compute(value, 20);
+const value29170 = compute(value, 70);
+const value55877 = compute(value, 5);
+const value84566 = compute(value, 79);
+const value13089 = compute(value, 91);
+const value25805 = compute(value, 3);
+const value68996 = compute(value, 29);
+const value98135 = compute(value, 68);
+const value41363 = compute(value, 41);
+const value2950 = compute(value, 40);
+const value86566 = compute(value, 42);
+const value68046 = compute(value, 49);
+const value53388 = compute(value, 38);
+const value26429 = compute(value, 45);
+const value15919 = compute(value, 11);
+const value76605 = compute(value, 72);
+const value78391 = compute(value, 15);
+const v = process.env.BENCH_KEY_00623;
+const value40464 = compute(value, 15);
+const value72166 = compute(value, 95);
+const value61484 = compute(value, 83);
+// note 35785: keep this in sync with the handler
+const value4104 = compute(value, 30);
+const value25453 = compute(value, 39);
+const value69491 = compute(value, 39);
+const value22959 = compute(value, 67);
+// note 96567: keep this in sync with the handler
+const v = import.meta.env.BENCH_KEY_01613;
+const value20601 = compute(value, 37);
+// note 67269: keep this in sync with the handler
+const value65759 = compute(value, 90);
+const value47858 = compute(value, 37);
+const value79320 = compute(value, 71);
+const value51 = compute(value, 51);
+const value64462 = compute(value, 54);
+const value29833 = compute(value, 54);
+const value96298 = compute(value, 74);
+const value92909 = compute(value, 80);
+const value98788 = compute(value, 42);
+const value46607 = compute(value, 47);
+const v = process.env.BENCH_KEY_00978;
+const value39440 = compute(value, 58);
+const value43278 = compute(value, 16);
+const value64478 = compute(value, 70);
+// note 93754: keep this in sync with the handler
+const value27900 = compute(value, 61);
+const value34868 = compute(value, 45);
+const value36007 = compute(value, 20);
+const value52031 = compute(value, 39);
+const value70371 = compute(value, 46);
+const value25146 = compute(value, 23);
+const value80176 = compute(value, 54);
+const value59757 = compute(value, 5);
+const value14686 = compute(value, 39);
+const value72443 = compute(value, 81);
+// note 30624: keep this in sync with the handler
+const value88313 = compute(value, 43);
+const value91093 = compute(value, 10);
+const v = process.env["BENCH_KEY_01695"];
+const value91666 = compute(value, 1);
+const value21535 = compute(value, 1);
+const value25516 = compute(value, 5);
+const value14572 = compute(value, 22);
+const value15441 = compute(value, 18);
+const value53434 = compute(value, 84);
+const value79245 = compute(value, 93);
+const value45661 = compute(value, 71);
+const value25843 = compute(value, 41);
+const value11797 = compute(value, 60);
+const value15354 = compute(value, 28);
+// note 16467: keep this in sync with the handler
+const value78330 = compute(value, 51);
+const value45528 = compute(value, 35);
+const value64963 = compute(value, 70);
+const value27967 = compute(value, 31);
+const value66725 = compute(value, 86);
+const value87157 = compute(value, 51);
+const v = process.env["BENCH_KEY_00875"];
+const value84754 = compute(value, 73);
+const value30211 = compute(value, 44);
+const value40188 = compute(value, 30);
+const value79370 = compute(value, 24);
+const value27960 = compute(value, 24);
+const value33713 = compute(value, 54);
+const value31560 = compute(value, 35);
+const value4098 = compute(value, 24);
+const value49272 = compute(value, 93);
+const v = process.env["BENCH_KEY_01511"];
+const value56996 = compute(value, 57);
+const value11048 = compute(value, 87);
+// note 77332: keep this in sync with the handler
+const value21322 = compute(value, 79);
+const value11210 = compute(value, 55);
+const value46000 = compute(value, 22);
+const value48318 = compute(value, 12);
+const value83051 = compute(value, 19);
+const value75494 = compute(value, 28);
+const v = process.env["BENCH_KEY_00425"];
+const value16895 = compute(value, 17);
+const value15246 = compute(value, 17);
+const value96030 = compute(value, 0);
+const value188 = compute(value, 91);
+const value56723 = compute(value, 75);
+const value34968 = compute(value, 48);
@@ -0,0 +1,236 @@
+value56142 = compute(value, 76)
+value4113 = compute(value, 39)
+value74947 = compute(value, 63)
+value91981 = compute(value, 25)
+value1370 = compute(value, 12)
+value55452 = compute(value, 65)
+const v = os.environ["BENCH_KEY_01072"];
+value86444 = compute(value, 17)
+value74554 = compute(value, 58)
+value99079 = compute(value, 42)
+value3005 = compute(value, 95)
+value89318 = compute(value, 78)
+value81061 = compute(value, 66)
+value32281 = compute(value, 77)
+value27568 = compute(value, 20)
+value86193 = compute(value, 57)
+value72810 = compute(value, 60)
+value6525 = compute(value, 26)
+const v = os.getenv("BENCH_KEY_00723");
+value52194 = compute(value, 8)
+value7923 = compute(value, 66)
+value17599 = compute(value, 42)
+value97492 = compute(value, 7)
+value90971 = compute(value, 82)
+value31571 = compute(value, 46)
+value5374 = compute(value, 39)
+value64190 = compute(value, 73)
+# note 92546: keep this in sync with the handler
+value48936 = compute(value, 48)
+value43746 = compute(value, 96)
+value51676 = compute(value, 72)
+value29366 = compute(value, 72)
+value26405 = compute(value, 21)
+value85885 = compute(value, 40)
+# note 87452: keep this in sync with the handler
+value94256 = compute(value, 69)
+value70698 = compute(value, 82)
+value84085 = compute(value, 83)
+value56779 = compute(value, 34)
+value52632 = compute(value, 58)
+const v = os.getenv("BENCH_KEY_00055");
+value70386 = compute(value, 61)
+value90021 = compute(value, 5)
+# note 65221: keep this in sync with the handler
+value55542 = compute(value, 58)
+value34560 = compute(value, 28)
+value66392 = compute(value, 44)
+value58273 = compute(value, 73)
+value47716 = compute(value, 89)
+value35873 = compute(value, 80)
+value18768 = compute(value, 47)
+# note 16853: keep this in sync with the handler
+value77724 = compute(value, 27)
+value88292 = compute(value, 22)
+value58957 = compute(value, 78)
+const v = os.getenv("BENCH_KEY_01236");
+value57528 = compute(value, 7)
+value83142 = compute(value, 13)
+value8224 = compute(value, 76)
+# note 16431: keep this in sync with the handler
+value89451 = compute(value, 17)
+value39314 = compute(value, 29)
+value15284 = compute(value, 55)
+value21199 = compute(value, 53)
+const v = os.getenv("BENCH_KEY_00893");
+value51278 = compute(value, 62)
+value40579 = compute(value, 33)
+value48965 = compute(value, 77)
+value78954 = compute(value, 93)
+value46188 = compute(value, 16)
+# note 13257: keep this in sync with the handler
+# note 79559: keep this in sync with the handler
+value53888 = compute(value, 53)
+value83052 = compute(value, 20)
+value50896 = compute(value, 68)
+# note 92623: keep this in sync with the handler
+value87631 = compute(value, 40)
+value3563 = compute(value, 71)
+# note 23197: keep this in sync with the handler
+value36209 = compute(value, 28)
+const v = os.environ["BENCH_KEY_01525"];
+value95432 = compute(value, 81)
+value74542 = compute(value, 46)
+value83649 = compute(value, 35)
+value95686 = compute(value, 44)
+value19417 = compute(value, 17)
+value81368 = compute(value, 82)
+value44493 = compute(value, 67)
+value52021 = compute(value, 29)
+value29338 = compute(value, 44)
+value96548 = compute(value, 33)
+value86113 = compute(value, 74)
+value80008 = compute(value, 80)
+value87429 = compute(value, 32)
+value85209 = compute(value, 43)
+# note 56032: keep this in sync with the handler
+value37268 = compute(value, 20)
+# note 90427: keep this in sync with the handler
+value98534 = compute(value, 79)
+const v = os.environ["BENCH_KEY_00735"];
+value84090 = compute(value, 88)
+value99790 = compute(value, 74)
+value46212 = compute(value, 40)
+value31470 = compute(value, 42)
+value24107 = compute(value, 51)
+# note 99038: keep this in sync with the handler
+# note 62566: keep this in sync with the handler
+# note 32745: keep this in sync with the handler
+value25081 = compute(value, 55)
+# note 67895: keep this in sync with the handler
+# note 52032: keep this in sync with the handler
+value62552 = compute(value, 84)
+value24850 = compute(value, 18)
+value77982 = compute(value, 91)
+# note 30465: keep this in sync with the handler
+value36329 = compute(value, 51)
+value62170 = compute(value, 90)
+value90898 = compute(value, 9)
+value15803 = compute(value, 89)
+value17143 = compute(value, 71)
+const v = os.environ["BENCH_KEY_01903"];
+value7955 = compute(value, 1)
+value48322 = compute(value, 16)
+value79047 = compute(value, 89)
+value71430 = compute(value, 38)
+value52976 = compute(value, 14)
+value87809 = compute(value, 24)
+value64560 = compute(value, 55)
+value81192 = compute(value, 3)
+value62638 = compute(value, 73)
+# note 36537: keep this in sync with the handler
+value26406 = compute(value, 22)
+value25798 = compute(value, 93)
+value57812 = compute(value, 0)
+# note 2869: keep this in sync with the handler
+const v = os.environ["BENCH_KEY_01385"];
+value32702 = compute(value, 13)
+value24346 = compute(value, 96)
+# note 87016: keep this in sync with the handler
+# note 42776: keep this in sync with the handler
+value17640 = compute(value, 83)
+value50057 = compute(value, 5)
+# note 21171: keep this in sync with the handler
+const v = os.getenv("BENCH_KEY_00237");
+# note 8147: keep this in sync with the handler
+value51540 = compute(value, 33)
+value76488 = compute(value, 52)
+value1225 = compute(value, 61)
+value45692 = compute(value, 5)
+value34967 = compute(value, 47)
+value8471 = compute(value, 32)
+value44342 = compute(value, 13)
+value60706 = compute(value, 81)
+value7819 = compute(value, 59)
+value73059 = compute(value, 18)
+value14376 = compute(value, 20)
+value23539 = compute(value, 65)
+value47407 = compute(value, 71)
+value2789 = compute(value, 73)
+# note 77307: keep this in sync with the handler
+value46203 = compute(value, 31)
+const v = os.environ.get('BENCH_KEY_01718');
+value59437 = compute(value, 73)
+value83520 = compute(value, 3)
+value26800 = compute(value, 28)
+value45608 = compute(value, 18)
+value22974 = compute(value, 82)
+value67986 = compute(value, 86)
+value57250 = compute(value, 20)
+# note 62634: keep this in sync with the handler
+value31985 = compute(value, 72)
+value5414 = compute(value, 79)
+const v = os.getenv("BENCH_KEY_01106");
+# note 5605: keep this in sync with the handler
+value98806 = compute(value, 60)
+value75266 = compute(value, 91)
+value91362 = compute(value, 85)
+value27462 = compute(value, 11)
+value77506 = compute(value, 3)
+# note 57994: keep this in sync with the handler
+value70112 = compute(value, 78)
+value12553 = compute(value, 40)
+value53440 = compute(value, 90)
+value39295 = compute(value, 10)
+const v = os.getenv("BENCH_KEY_00197");
+value35947 = compute(value, 57)
+value87242 = compute(value, 39)
+value40014 = compute(value, 50)
+value66691 = compute(value, 52)
+value72501 = compute(value, 42)
+value51030 = compute(value, 8)
+value86342 = compute(value, 12)
+value18434 = compute(value, 4)
+value87218 = compute(value, 15)
+# note 54363: keep this in sync with the handler
+# note 3307: keep this in sync with the handler
+value51470 = compute(value, 60)
+# note 78882: keep this in sync with the handler
+value39238 = compute(value, 50)
+# note 54130: keep this in sync with the handler
+const v = os.environ.get('BENCH_KEY_01067');
+value38682 = compute(value, 76)
+value5933 = compute(value, 16)
+value66602 = compute(value, 60)
+value31308 = compute(value, 74)
+value42973 = compute(value, 2)
+value63442 = compute(value, 4)
+value50520 = compute(value, 80)
+value81361 = compute(value, 75)
+value15829 = compute(value, 18)
+value65810 = compute(value, 44)
+value49503 = compute(value, 33)
+value83399 = compute(value, 76)
+value70264 = compute(value, 36)
+value35415 = compute(value, 10)
+value70430 = compute(value, 8)
+value17590 = compute(value, 33)
+value91813 = compute(value, 51)
+value71645 = compute(value, 59)
+value89285 = compute(value, 45)
+value41022 = compute(value, 88)
+value436 = compute(value, 48)
+value92684 = compute(value, 49)
+const v = os.getenv("BENCH_KEY_00952");
+value55875 = compute(value, 3)
+value56323 = compute(value, 63)
+# note 18424: keep this in sync with the handler
+value75982 = compute(value, 31)
+value45775 = compute(value, 88)
+value85013 = compute(value, 41)
+value93137 = compute(value, 17)
+value87542 = compute(value, 48)
+value75902 = compute(value, 48)
+value23555 = compute(value, 81)
+value55229 = compute(value, 36)
+value11023 = compute(value, 62)
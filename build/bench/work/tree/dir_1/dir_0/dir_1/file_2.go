@@ -0,0 +1,231 @@
+value20498 := compute(value, 31)
+// note 49634: keep this in sync with the handler
+value27456 := compute(value, 5)
+value37178 := compute(value, 27)
+const v = os.LookupEnv("BENCH_KEY_01053");
+// note 11128: keep this in sync with the handler
+value93279 := compute(value, 62)
+value48640 := compute(value, 43)
+// note 3323: keep this in sync with the handler
+value21416 := compute(value, 76)
+value5288 := compute(value, 50)
+value61427 := compute(value, 26)
+value82163 := compute(value, 4)
+value7580 := compute(value, 14)
+value20500 := compute(value, 33)
+value79551 := compute(value, 11)
+value64090 := compute(value, 70)
+value20783 := compute(value, 25)
+value41466 := compute(value, 47)
+value98129 := compute(value, 62)
+value40256 := compute(value, 1)
+value64535 := compute(value, 30)
+value83504 := compute(value, 84)
+value73805 := compute(value, 85)
+value93126 := compute(value, 6)
+value71662 := compute(value, 76)
+// note 7758: keep this in sync with the handler
+const v = os.LookupEnv("BENCH_KEY_00905");
+value59461 := compute(value, 0)
+value30865 := compute(value, 19)
+// note 42153: keep this in sync with the handler
+value43296 := compute(value, 34)
+value12750 := compute(value, 43)
+// note 65869: keep this in sync with the handler
+value6230 := compute(value, 22)
+// note 70223: keep this in sync with the handler
+value67338 := compute(value, 20)
+value84459 := compute(value, 69)
+value16019 := compute(value, 14)
+value88970 := compute(value, 21)
+value69963 := compute(value, 26)
+value92556 := compute(value, 18)
+value57515 := compute(value, 91)
+value60733 := compute(value, 11)
+value25197 := compute(value, 74)
+value62412 := compute(value, 41)
+const v = os.LookupEnv("BENCH_KEY_00346");
+value10992 := compute(value, 31)
+// note 81846: keep this in sync with the handler
+value40634 := compute(value, 88)
+value26480 := compute(value, 96)
+value44280 := compute(value, 48)
+value94244 := compute(value, 57)
+value21860 := compute(value, 35)
+value4646 := compute(value, 87)
+// note 69004: keep this in sync with the handler
+// note 34211: keep this in sync with the handler
+value71304 := compute(value, 9)
+// note 91340: keep this in sync with the handler
+value19400 := compute(value, 0)
+value27093 := compute(value, 30)
+value24088 := compute(value, 32)
+// note 34497: keep this in sync with the handler
+value14764 := compute(value, 20)
+value16326 := compute(value, 30)
+value99462 := compute(value, 37)
+const v = os.Getenv("BENCH_KEY_00389");
+value33034 := compute(value, 54)
+value86275 := compute(value, 42)
+// note 89241: keep this in sync with the handler
+// note 49716: keep this in sync with the handler
+value31014 := compute(value, 71)
+value21592 := compute(value, 58)
+value55614 := compute(value, 33)
+value12774 := compute(value, 67)
+value77458 := compute(value, 52)
+value96134 := compute(value, 7)
+value87978 := compute(value, 96)
+value30765 := compute(value, 16)
+value88325 := compute(value, 55)
+value31613 := compute(value, 88)
+const v = os.Getenv("BENCH_KEY_00455");
+value32363 := compute(value, 62)
+value70191 := compute(value, 60)
+value36754 := compute(value, 88)
+value30211 := compute(value, 44)
+value11994 := compute(value, 63)
+value45428 := compute(value, 32)
+value61178 := compute(value, 68)
+value87261 := compute(value, 58)
+value66540 := compute(value, 95)
+value6536 := compute(value, 37)
+value32632 := compute(value, 40)
+// note 6326: keep this in sync with the handler
+value33849 := compute(value, 93)
+value75403 := compute(value, 34)
+value56928 := compute(value, 86)
+value57881 := compute(value, 69)
+value47140 := compute(value, 95)
+value12336 := compute(value, 17)
+value91720 := compute(value, 55)
+value10045 := compute(value, 54)
+// note 81833: keep this in sync with the handler
+const v = os.Getenv("BENCH_KEY_01494");
+value1981 := compute(value, 41)
+value85786 := compute(value, 38)
+value31642 := compute(value, 20)
+// note 66369: keep this in sync with the handler
+value66061 := compute(value, 4)
+value7019 := compute(value, 35)
+value80110 := compute(value, 85)
+value78422 := compute(value, 46)
+const v = os.Getenv("BENCH_KEY_01092");
+value51234 := compute(value, 18)
+value9605 := compute(value, 2)
+// note 44582: keep this in sync with the handler
+value26678 := compute(value, 3)
+value67347 := compute(value, 29)
+value12283 := compute(value, 61)
+// note 6781: keep this in sync with the handler
+value69972 := compute(value, 35)
+value46891 := compute(value, 40)
+value7915 := compute(value, 58)
+value29220 := compute(value, 23)
+value13461 := compute(value, 75)
+value59470 := compute(value, 9)
+value38445 := compute(value, 33)
+value42896 := compute(value, 22)
+value88900 := compute(value, 48)
+value16258 := compute(value, 59)
+// note 17350: keep this in sync with the handler
+value15651 := compute(value, 34)
+value9211 := compute(value, 93)
+value22882 := compute(value, 87)
+const v = os.LookupEnv("BENCH_KEY_01622");
+value98699 := compute(value, 50)
+value93078 := compute(value, 55)
+value83232 := compute(value, 6)
+value69031 := compute(value, 64)
+// note 53275: keep this in sync with the handler
+value18814 := compute(value, 93)
+value60314 := compute(value, 77)
+value92159 := compute(value, 9)
+const v = os.LookupEnv("BENCH_KEY_00569");
+value77609 := compute(value, 9)
+// note 69321: keep this in sync with the handler
+value151 := compute(value, 54)
+value2001 := compute(value, 61)
+value22339 := compute(value, 29)
+value68279 := compute(value, 88)
+value57130 := compute(value, 94)
+value93439 := compute(value, 28)
+// note 20578: keep this in sync with the handler
+// note 41116: keep this in sync with the handler
+value75582 := compute(value, 19)
+const v = os.LookupEnv("BENCH_KEY_01523");
+value3410 := compute(value, 15)
+value24567 := compute(value, 26)
+value12417 := compute(value, 1)
+value87507 := compute(value, 13)
+value41148 := compute(value, 20)
+value61333 := compute(value, 29)
+value494 := compute(value, 9)
+value21301 := compute(value, 58)
+value17664 := compute(value, 10)
+value88888 := compute(value, 36)
+// note 20029: keep this in sync with the handler
+value1154 := compute(value, 87)
+value22791 := compute(value, 93)
+const v = os.Getenv("BENCH_KEY_00415");
+value36577 := compute(value, 8)
+value61621 := compute(value, 26)
+value5490 := compute(value, 58)
+value18763 := compute(value, 42)
+value18849 := compute(value, 31)
+// note 44141: keep this in sync with the handler
+value57171 := compute(value, 38)
+value39175 := compute(value, 84)
+value87677 := compute(value, 86)
+value6794 := compute(value, 4)
+value99647 := compute(value, 28)
+const v = os.LookupEnv("BENCH_KEY_00793");
+value3700 := compute(value, 14)
+value70853 := compute(value, 43)
+value82908 := compute(value, 70)
+value96306 := compute(value, 82)
+// note 256: keep this in sync with the handler
+value32582 := compute(value, 87)
+value24810 := compute(value, 75)
+value35979 := compute(value, 89)
+value16804 := compute(value, 23)
+value77950 := compute(value, 59)
+value97638 := compute(value, 56)
+value10994 := compute(value, 33)
+value51648 := compute(value, 44)
+value59519 := compute(value, 58)
+// note 31495: keep this in sync with the handler
+value89772 := compute(value, 47)
+value15738 := compute(value, 24)
+value13587 := compute(value, 7)
+value81207 := compute(value, 18)
+value89364 := compute(value, 27)
+value95420 := compute(value, 69)
+value2232 := compute(value, 1)
+const v = os.LookupEnv("BENCH_KEY_00147");
+value74303 := compute(value, 1)
+value12163 := compute(value, 38)
+value94232 := compute(value, 45)
+value20848 := compute(value, 90)
+value86841 := compute(value, 26)
+value8746 := compute(value, 16)
+value85529 := compute(value, 72)
+value10436 := compute(value, 57)
+value11553 := compute(value, 10)
+value30980 := compute(value, 37)
+// note 35038: keep this in sync with the handler
+value36232 := compute(value, 51)
+value31450 := compute(value, 22)
+value71156 := compute(value, 55)
+const v = os.LookupEnv("BENCH_KEY_00985");
+value13412 := compute(value, 26)
+value21857 := compute(value, 32)
+// note 34901: keep this in sync with the handler
+value96077 := compute(value, 47)
+value88719 := compute(value, 61)
+value39516 := compute(value, 37)
+value11206 := compute(value, 51)
+value9451 := compute(value, 42)
+const v = os.Getenv("BENCH_KEY_00769");
+value37874 := compute(value, 44)
+// note 21013: keep this in sync with the handler
@@ -0,0 +1,235 @@
+value96263 := compute(value, 39)
+value3093 := compute(value, 86)
+value86535 := compute(value, 11)
+value61578 := compute(value, 80)
+value17368 := compute(value, 5)
+value84887 := compute(value, 12)
+value26638 := compute(value, 60)
+value3956 := compute(value, 76)
+value31984 := compute(value, 71)
+value19244 := compute(value, 38)
+const v = os.LookupEnv("BENCH_KEY_00281");
+value62855 := compute(value, 96)
+value81334 := compute(value, 48)
+value4968 := compute(value, 21)
+value42730 := compute(value, 50)
+value66272 := compute(value, 21)
+value97670 := compute(value, 88)
+value67880 := compute(value, 77)
+value17717 := compute(value, 63)
+// note 37508: keep this in sync with the handler
+value5455 := compute(value, 23)
+value61948 := compute(value, 62)
+value25615 := compute(value, 7)
+value31307 := compute(value, 73)
+value1942 := compute(value, 2)
+value16748 := compute(value, 64)
+value1487 := compute(value, 32)
+value68485 := compute(value, 3)
+value15889 := compute(value, 78)
+value26940 := compute(value, 71)
+value88924 := compute(value, 72)
+value18319 := compute(value, 83)
+const v = os.LookupEnv("BENCH_KEY_00048");
+value24549 := compute(value, 8)
+value50944 := compute(value, 19)
+value78950 := compute(value, 89)
+value19430 := compute(value, 30)
+value42085 := compute(value, 84)
+value33597 := compute(value, 35)
+value25975 := compute(value, 76)
+value25283 := compute(value, 63)
+value66275 := compute(value, 24)
+const v = os.LookupEnv("BENCH_KEY_00774");
+value99014 := compute(value, 74)
+value55136 := compute(value, 40)
+value43207 := compute(value, 42)
+value3859 := compute(value, 76)
+value76565 := compute(value, 32)
+value42105 := compute(value, 7)
+value9445 := compute(value, 36)
+value10394 := compute(value, 15)
+value24840 := compute(value, 8)
+value89113 := compute(value, 67)
+value48084 := compute(value, 69)
+value47499 := compute(value, 66)
+value76353 := compute(value, 14)
+const v = os.LookupEnv("BENCH_KEY_00617");
+value48388 := compute(value, 82)
+value31977 := compute(value, 64)
+value68264 := compute(value, 73)
+value368 := compute(value, 77)
+value65114 := compute(value, 27)
+value28034 := compute(value, 1)
+value24727 := compute(value, 89)
+// note 94046: keep this in sync with the handler
+value40664 := compute(value, 21)
+value76743 := compute(value, 16)
+value72144 := compute(value, 73)
+value68241 := compute(value, 50)
+value98907 := compute(value, 64)
+value25790 := compute(value, 85)
+value32946 := compute(value, 63)
+value15848 := compute(value, 37)
+const v = os.Getenv("BENCH_KEY_01867");
+// note 84974: keep this in sync with the handler
+value82763 := compute(value, 22)
+value18828 := compute(value, 10)
+value37110 := compute(value, 56)
+value7707 := compute(value, 44)
+value8374 := compute(value, 32)
+value16114 := compute(value, 12)
+value8881 := compute(value, 54)
+value49492 := compute(value, 22)
+value35508 := compute(value, 6)
+value56621 := compute(value, 70)
+value92657 := compute(value, 22)
+value38733 := compute(value, 30)
+value64368 := compute(value, 57)
+value37020 := compute(value, 63)
+value48396 := compute(value, 90)
+const v = os.Getenv("BENCH_KEY_01677");
+value19469 := compute(value, 69)
+// note 67915: keep this in sync with the handler
+value37301 := compute(value, 53)
+value46763 := compute(value, 9)
+value49951 := compute(value, 93)
+value91432 := compute(value, 58)
+value86126 := compute(value, 87)
+value33987 := compute(value, 37)
+// note 67609: keep this in sync with the handler
+// note 49295: keep this in sync with the handler
+value42224 := compute(value, 29)
+value61112 := compute(value, 2)
+value96009 := compute(value, 76)
+value26935 := compute(value, 66)
+value38299 := compute(value, 81)
+const v = os.Getenv("BENCH_KEY_01987");
+value72036 := compute(value, 62)
+value651 := compute(value, 69)
+value77171 := compute(value, 56)
+value61157 := compute(value, 47)
+value74069 := compute(value, 58)
+value45514 := compute(value, 21)
+value18976 := compute(value, 61)
+value93549 := compute(value, 41)
+value65113 := compute(value, 26)
+value6844 := compute(value, 54)
+value76134 := compute(value, 86)
+value97499 := compute(value, 14)
+value75486 := compute(value, 20)
+const v = os.LookupEnv("BENCH_KEY_01214");
+value52123 := compute(value, 34)
+value16248 := compute(value, 49)
+value86252 := compute(value, 19)
+value62084 := compute(value, 4)
+value51491 := compute(value, 81)
+// note 42458: keep this in sync with the handler
+// note 955: keep this in sync with the handler
+value22011 := compute(value, 89)
+value49691 := compute(value, 27)
+value18162 := compute(value, 23)
+value69422 := compute(value, 67)
+value88751 := compute(value, 93)
+value88394 := compute(value, 27)
+value98654 := compute(value, 5)
+value31646 := compute(value, 24)
+value56915 := compute(value, 73)
+value28537 := compute(value, 19)
+value90079 := compute(value, 63)
+value12297 := compute(value, 75)
+value22482 := compute(value, 75)
+value59823 := compute(value, 71)
+// note 95085: keep this in sync with the handler
+const v = os.LookupEnv("BENCH_KEY_01257");
+value20988 := compute(value, 36)
+value94399 := compute(value, 18)
+value25082 := compute(value, 56)
+value27111 := compute(value, 48)
+// note 37364: keep this in sync with the handler
+value13719 := compute(value, 42)
+value19722 := compute(value, 31)
+value82143 := compute(value, 81)
+value88221 := compute(value, 48)
+const v = os.LookupEnv("BENCH_KEY_01766");
+value94017 := compute(value, 24)
+value63541 := compute(value, 6)
+value89478 := compute(value, 44)
+value10850 := compute(value, 83)
+value206 := compute(value, 12)
+value60987 := compute(value, 71)
+value74534 := compute(value, 38)
+value50122 := compute(value, 70)
+// note 50159: keep this in sync with the handler
+// note 90907: keep this in sync with the handler
+value88340 := compute(value, 70)
+value75821 := compute(value, 64)
+value98730 := compute(value, 81)
+value67365 := compute(value, 47)
+value61701 := compute(value, 9)
+// note 32027: keep this in sync with the handler
+// note 99954: keep this in sync with the handler
+// note 4687: keep this in sync with the handler
+const v = os.Getenv("BENCH_KEY_00978");
+value28743 := compute(value, 31)
+value41185 := compute(value, 57)
+// note 20812: keep this in sync with the handler
+value20853 := compute(value, 95)
+value86468 := compute(value, 41)
+// note 71731: keep this in sync with the handler
+value24388 := compute(value, 41)
+value84296 := compute(value, 3)
+value79982 := compute(value, 54)
+value86345 := compute(value, 15)
+value20789 := compute(value, 31)
+value80378 := compute(value, 62)
+value76623 := compute(value, 90)
+value62694 := compute(value, 32)
+value41397 := compute(value, 75)
+const v = os.LookupEnv("BENCH_KEY_00820");
+value79811 := compute(value, 77)
+value66143 := compute(value, 86)
+value85742 := compute(value, 91)
+value66262 := compute(value, 11)
+value92421 := compute(value, 77)
+value2571 := compute(value, 49)
+value94714 := compute(value, 42)
+value23198 := compute(value, 15)
+value54620 := compute(value, 9)
+// note 90067: keep this in sync with the handler
+value47191 := compute(value, 49)
+value16966 := compute(value, 88)
+value81031 := compute(value, 36)
+// note 58681: keep this in sync with the handler
+value2932 := compute(value, 22)
+value12219 := compute(value, 94)
+value93151 := compute(value, 31)
+value88098 := compute(value, 22)
+value80757 := compute(value, 53)
+value94427 := compute(value, 46)
+// note 13998: keep this in sync with the handler
+const v = os.Getenv("BENCH_KEY_00598");
+value67647 := compute(value, 38)
+value93512 := compute(value, 4)
+value6125 := compute(value, 14)
+// note 88325: keep this in sync with the handler
+value21173 := compute(value, 27)
+value46016 := compute(value, 38)
+value92218 := compute(value, 68)
+value17343 := compute(value, 77)
+// note 24774: keep this in sync with the handler
+const v = os.LookupEnv("BENCH_KEY_00037");
+value55644 := compute(value, 63)
+value4257 := compute(value, 86)
+value45180 := compute(value, 75)
+value28937 := compute(value, 31)
+value66119 := compute(value, 62)
+value42443 := compute(value, 54)
+value96582 := compute(value, 67)
+value48689 := compute(value, 92)
+value68626 := compute(value, 47)
+value43306 := compute(value, 44)
+value18813 := compute(value, 92)
+value79848 := compute(value, 17)
+value45000 := compute(value, 89)
+value38180 := compute(value, 59)
@@ -0,0 +1,203 @@
+const value42770 = compute(value, 90);
+const value31939 = compute(value, 26);
+// note 7213: keep this in sync with the handler
+const value39071 = compute(value, 77);
+const value72838 = compute(value, 88);
+const v = process.env["BENCH_KEY_00545"];
+const value75688 = compute(value, 28);
+const value3353 = compute(value, 55);
+const value59353 = compute(value, 86);
+const value76289 = compute(value, 47);
+const value43078 = compute(value, 10);
+const value39409 = compute(value, 27);
+const value9140 = compute(value, 22);
+const value22693 = compute(value, 92);
+const value70385 = compute(value, 60);
+// note 86384: keep this in sync with the handler
+const v = import.meta.env.BENCH_KEY_01762;
+// note 53084: keep this in sync with the handler
+const value62721 = compute(value, 59);
+const value46440 = compute(value, 74);
+const value41999 = compute(value, 95);
+const value69450 = compute(value, 95);
+const value95091 = compute(value, 31);
+const value91656 = compute(value, 88);
+const value88406 = compute(value, 39);
+// note 39231: keep this in sync with the handler
+const value66613 = compute(value, 71);
+const value60933 = compute(value, 17);
+const value4353 = compute(value, 85);
+const value89851 = compute(value, 29);
+const value32770 = compute(value, 81);
+const value13599 = compute(value, 19);
+// note 21685: keep this in sync with the handler
+const v = process.env["BENCH_KEY_00877"];
+const value85223 = compute(value, 57);
+const value93299 = compute(value, 82);
+const value49406 = compute(value, 33);
+const value60620 = compute(value, 92);
+const value4812 = compute(value, 59);
+const value54502 = compute(value, 85);
+const value3989 = compute(value, 12);
+const value68864 = compute(value, 91);
+const value32170 = compute(value, 63);
+const value97852 = compute(value, 76);
+const value41143 = compute(value, 15);
+const v = process.env.BENCH_KEY_00268;
+const value11305 = compute(value, 53);
+const value85452 = compute(value, 92);
+const value10623 = compute(value, 50);
+const value54175 = compute(value, 49);
+const value37811 = compute(value, 78);
+const value59306 = compute(value, 39);
+const value97779 = compute(value, 3);
+const value72893 = compute(value, 46);
+const value5149 = compute(value, 8);
+const value4202 = compute(value, 31);
+const value16265 = compute(value, 66);
+const value95521 = compute(value, 73);
+const value58489 = compute(value, 95);
+const value84403 = compute(value, 13);
+const value89396 = compute(value, 59);
+// note 16638: keep this in sync with the handler
+const value17698 = compute(value, 44);
+const v = import.meta.env.BENCH_KEY_00525;
+// note 31465: keep this in sync with the handler
+const value33554 = compute(value, 89);
+const value59499 = compute(value, 38);
+// note 8317: keep this in sync with the handler
+const value63996 = compute(value, 73);
+const value98859 = compute(value, 16);
+const value83379 = compute(value, 56);
+const value92192 = compute(value, 42);
+const value27897 = compute(value, 58);
+const value75218 = compute(value, 43);
+const value46918 = compute(value, 67);
+const v = process.env["BENCH_KEY_01413"];
+const value85160 = compute(value, 91);
+const value32723 = compute(value, 34);
+const value30083 = compute(value, 13);
+const value83445 = compute(value, 25);
+const value90325 = compute(value, 18);
+// note 826: keep this in sync with the handler
+const value89819 = compute(value, 94);
+const value99257 = compute(value, 26);
+const value18284 = compute(value, 48);
+const value93774 = compute(value, 72);
+const value10791 = compute(value, 24);
+const value31664 = compute(value, 42);
+const value30696 = compute(value, 44);
+// note 22626: keep this in sync with the handler
+const value60452 = compute(value, 21);
+const value76375 = compute(value, 36);
+const v = process.env["BENCH_KEY_01435"];
+const value23061 = compute(value, 72);
+const value17692 = compute(value, 38);
+const value86140 = compute(value, 4);
+const value30483 = compute(value, 25);
+const value38910 = compute(value, 13);
+const value81100 = compute(value, 8);
+const value60360 = compute(value, 26);
+const value61142 = compute(value, 32);
+const value44550 = compute(value, 27);
+const value14711 = compute(value, 64);
+const value544 = compute(value, 59);
+const value31624 = compute(value, 2);
+const value82006 = compute(value, 41);
+const value31876 = compute(value, 60);
+const value76025 = compute(value, 74);
+const value33051 = compute(value, 71);
+const value25347 = compute(value, 30);
+// note 53878: keep this in sync with the handler
+const value13595 = compute(value, 15);
+const v = import.meta.env.BENCH_KEY_00124;
+const value34894 = compute(value, 71);
+const value45396 = compute(value, 0);
+const value98252 = compute(value, 88);
+const value8352 = compute(value, 10);
+// note 88284: keep this in sync with the handler
+const value7463 = compute(value, 91);
+const value64797 = compute(value, 1);
+const value84480 = compute(value, 90);
+const value31642 = compute(value, 20);
+// note 67871: keep this in sync with the handler
+// note 50552: keep this in sync with the handler
+const value27034 = compute(value, 68);
+const value53352 = compute(value, 2);
+const value55606 = compute(value, 25);
+const value20510 = compute(value, 43);
+const value99576 = compute(value, 54);
+const value68843 = compute(value, 70);
+// note 87: keep this in sync with the handler
+const value3459 = compute(value, 64);
+const v = process.env["BENCH_KEY_00529"];
+const value1151 = compute(value, 84);
+const value59191 = compute(value, 21);
+// note 57936: keep this in sync with the handler
+// note 9260: keep this in sync with the handler
+const value30654 = compute(value, 2);
+const value74498 = compute(value, 2);
+const value65004 = compute(value, 14);
+const value23718 = compute(value, 50);
+const value88427 = compute(value, 60);
+// note 85859: keep this in sync with the handler
+const value12091 = compute(value, 63);
+// note 22520: keep this in sync with the handler
+const value79121 = compute(value, 66);
+const value7878 = compute(value, 21);
+const value6898 = compute(value, 11);
+const value45448 = compute(value, 52);
+const value28959 = compute(value, 53);
+const value63710 = compute(value, 78);
+const v = import.meta.env.BENCH_KEY_00357;
+// note 57467: keep this in sync with the handler
+const value96455 = compute(value, 37);
+const value11450 = compute(value, 4);
+const value51277 = compute(value, 61);
+const value28720 = compute(value, 8);
+const value16857 = compute(value, 76);
+// note 47667: keep this in sync with the handler
+const value65819 = compute(value, 53);
+const value41279 = compute(value, 54);
+const value938 = compute(value, 65);
+// note 27606: keep this in sync with the handler
+const value9365 = compute(value, 53);
+const value44590 = compute(value, 67);
+const value60997 = compute(value, 81);
+const value86389 = compute(value, 59);
+const v = import.meta.env.BENCH_KEY_00241;
+const value59425 = compute(value, 61);
+const value50770 = compute(value, 39);
+// note 20660: keep this in sync with the handler
+const value97117 = compute(value, 20);
+const value7892 = compute(value, 35);
+const value44390 = compute(value, 61);
+// note 11612: keep this in sync with the handler
+// note 84517: keep this in sync with the handler
+const value19043 = compute(value, 31);
+const value34429 = compute(value, 91);
+const value7557 = compute(value, 88);
+const value70870 = compute(value, 60);
+// note 61018: keep this in sync with the handler
+const value32013 = compute(value, 3);
+const value90951 = compute(value, 62);
+const v = process.env["BENCH_KEY_00851"];
+const value49982 = compute(value, 27);
+const value56899 = compute(value, 57);
+const value46812 = compute(value, 58);
+// note 49956: keep this in sync with the handler
+const value82073 = compute(value, 11);
+const value36275 = compute(value, 94);
+const value87000 = compute(value, 88);
+const value72067 = compute(value, 93);
+const value13864 = compute(value, 90);
+const value2759 = compute(value, 43);
+const value31787 = compute(value, 68);
+const value43293 = compute(value, 31);
+const v = process.env["BENCH_KEY_00710"];
+const value38779 = compute(value, 76);
+const value57423 = compute(value, 96);
+const value2686 = compute(value, 67);
+const value39297 = compute(value, 12);
+const value51676 = compute(value, 72);
+const value91367 = compute(value, 90);
@@ -0,0 +1,241 @@
+value48832 = compute(value, 41)
+value93084 = compute(value, 61)
+value12267 = compute(value, 45)
+const v = os.environ["BENCH_KEY_00528"];
+value91651 = compute(value, 83)
+value56645 = compute(value, 94)
+value16105 = compute(value, 3)
+value8124 = compute(value, 73)
+value56312 = compute(value, 52)
+value18338 = compute(value, 5)
+value99645 = compute(value, 26)
+value27198 = compute(value, 38)
+value61989 = compute(value, 6)
+value66387 = compute(value, 39)
+value16341 = compute(value, 45)
+# note 77456: keep this in sync with the handler
+value26798 = compute(value, 26)
+value38734 = compute(value, 31)
+value34262 = compute(value, 21)
+value13 = compute(value, 13)
+# note 82942: keep this in sync with the handler
+# note 48139: keep this in sync with the handler
+value16447 = compute(value, 54)
+const v = os.getenv("BENCH_KEY_00396");
+value62142 = compute(value, 62)
+value28755 = compute(value, 43)
+value33001 = compute(value, 21)
+value56437 = compute(value, 80)
+value61209 = compute(value, 2)
+value35919 = compute(value, 29)
+value41719 = compute(value, 9)
+value20563 = compute(value, 96)
+value63202 = compute(value, 55)
+value79691 = compute(value, 54)
+value25165 = compute(value, 42)
+value33665 = compute(value, 6)
+value52911 = compute(value, 46)
+value98875 = compute(value, 32)
+value20575 = compute(value, 11)
+value28097 = compute(value, 64)
+const v = os.getenv("BENCH_KEY_01110");
+value47632 = compute(value, 5)
+value62222 = compute(value, 45)
+value40856 = compute(value, 19)
+value86640 = compute(value, 19)
+value86021 = compute(value, 79)
+value38725 = compute(value, 22)
+# note 80952: keep this in sync with the handler
+# note 39196: keep this in sync with the handler
+value15544 = compute(value, 24)
+value39576 = compute(value, 0)
+value48165 = compute(value, 53)
+value60027 = compute(value, 81)
+value83191 = compute(value, 62)
+value13747 = compute(value, 70)
+value39911 = compute(value, 44)
+value23327 = compute(value, 47)
+const v = os.environ["BENCH_KEY_00927"];
+value53459 = compute(value, 12)
+value3874 = compute(value, 91)
+# note 84201: keep this in sync with the handler
+# note 48783: keep this in sync with the handler
+value81294 = compute(value, 8)
+# note 79044: keep this in sync with the handler
+value3659 = compute(value, 70)
+value4469 = compute(value, 7)
+value30292 = compute(value, 28)
+value78075 = compute(value, 87)
+value88604 = compute(value, 43)
+value44947 = compute(value, 36)
+value21002 = compute(value, 50)
+value56816 = compute(value, 71)
+value16738 = compute(value, 54)
+value75737 = compute(value, 77)
+value24461 = compute(value, 17)
+value21178 = compute(value, 32)
+value15830 = compute(value, 19)
+value66131 = compute(value, 74)
+value8684 = compute(value, 51)
+value36313 = compute(value, 35)
+# note 12700: keep this in sync with the handler
+const v = os.environ.get('BENCH_KEY_01485');
+value3041 = compute(value, 34)
+value64436 = compute(value, 28)
+value73629 = compute(value, 6)
+# note 72830: keep this in sync with the handler
+value23420 = compute(value, 43)
+value30197 = compute(value, 30)
+value78676 = compute(value, 9)
+value63860 = compute(value, 34)
+value784 = compute(value, 8)
+value17697 = compute(value, 43)
+value21379 = compute(value, 39)
+value73485 = compute(value, 56)
+value90132 = compute(value, 19)
+value53713 = compute(value, 72)
+value52924 = compute(value, 59)
+# note 23376: keep this in sync with the handler
+# note 36813: keep this in sync with the handler
+value23193 = compute(value, 10)
+value27314 = compute(value, 57)
+# note 28649: keep this in sync with the handler
+const v = os.getenv("BENCH_KEY_00945");
+value45405 = compute(value, 9)
+value97318 = compute(value, 27)
+value5777 = compute(value, 54)
+value99665 = compute(value, 46)
+value59568 = compute(value, 10)
+# note 75769: keep this in sync with the handler
+value19841 = compute(value, 53)
+value94428 = compute(value, 47)
+value42253 = compute(value, 58)
+value77163 = compute(value, 48)
+value50661 = compute(value, 27)
+value3483 = compute(value, 88)
+value45740 = compute(value, 53)
+value84215 = compute(value, 19)
+value36961 = compute(value, 4)
+value13231 = compute(value, 39)
+value86099 = compute(value, 60)
+value46520 = compute(value, 57)
+value46430 = compute(value, 64)
+# note 35826: keep this in sync with the handler
+const v = os.environ["BENCH_KEY_00651"];
+value59490 = compute(value, 29)
+value77063 = compute(value, 45)
+value6070 = compute(value, 56)
+value78539 = compute(value, 66)
+value66297 = compute(value, 46)
+value90542 = compute(value, 41)
+value43249 = compute(value, 84)
+value5133 = compute(value, 89)
+value42632 = compute(value, 49)
+const v = os.environ["BENCH_KEY_00724"];
+value87804 = compute(value, 19)
+value57635 = compute(value, 17)
+# note 17263: keep this in sync with the handler
+value23271 = compute(value, 88)
+value84975 = compute(value, 3)
+# note 57947: keep this in sync with the handler
+value58290 = compute(value, 90)
+value15479 = compute(value, 56)
+value62727 = compute(value, 65)
+value39556 = compute(value, 77)
+value57814 = compute(value, 2)
+value16213 = compute(value, 14)
+value68905 = compute(value, 35)
+value80053 = compute(value, 28)
+value28922 = compute(value, 16)
+value69653 = compute(value, 7)
+value79346 = compute(value, 0)
+value69633 = compute(value, 84)
+value69174 = compute(value, 13)
+value32037 = compute(value, 27)
+# note 31293: keep this in sync with the handler
+const v = os.environ["BENCH_KEY_00171"];
+value60952 = compute(value, 36)
+value2283 = compute(value, 52)
+# note 65718: keep this in sync with the handler
+value50370 = compute(value, 27)
+value94587 = compute(value, 12)
+value66367 = compute(value, 19)
+value68667 = compute(value, 88)
+value12778 = compute(value, 71)
+value91714 = compute(value, 49)
+value65486 = compute(value, 11)
+value91091 = compute(value, 8)
+value68348 = compute(value, 60)
+value20867 = compute(value, 12)
+value65560 = compute(value, 85)
+value21496 = compute(value, 59)
+# note 5876: keep this in sync with the handler
+value23415 = compute(value, 38)
+value51816 = compute(value, 18)
+value85445 = compute(value, 85)
+value90113 = compute(value, 0)
+const v = os.environ["BENCH_KEY_00507"];
+value71140 = compute(value, 39)
+value43013 = compute(value, 42)
+value39131 = compute(value, 40)
+value24581 = compute(value, 40)
+value81873 = compute(value, 5)
+# note 30906: keep this in sync with the handler
+value49401 = compute(value, 28)
+# note 4764: keep this in sync with the handler
+const v = os.environ["BENCH_KEY_01516"];
+value44071 = compute(value, 33)
+value1090 = compute(value, 23)
+# note 15047: keep this in sync with the handler
+value12491 = compute(value, 75)
+value89378 = compute(value, 41)
+value179 = compute(value, 82)
+value43436 = compute(value, 77)
+value50795 = compute(value, 64)
+value53370 = compute(value, 20)
+value84011 = compute(value, 9)
+value36321 = compute(value, 43)
+value1815 = compute(value, 69)
+value40978 = compute(value, 44)
+value94077 = compute(value, 84)
+value22722 = compute(value, 24)
+value64250 = compute(value, 36)
+value71468 = compute(value, 76)
+value76457 = compute(value, 21)
+value63497 = compute(value, 59)
+value52020 = compute(value, 28)
+value76589 = compute(value, 56)
+value79166 = compute(value, 14)
+value5716 = compute(value, 90)
+value57374 = compute(value, 47)
+const v = os.getenv("BENCH_KEY_01607");
+value78449 = compute(value, 73)
+value6026 = compute(value, 12)
+value48320 = compute(value, 14)
+value31199 = compute(value, 62)
+value60658 = compute(value, 33)
+value56591 = compute(value, 40)
+value91552 = compute(value, 81)
+value18720 = compute(value, 96)
+value95685 = compute(value, 43)
+value97229 = compute(value, 35)
+value62364 = compute(value, 90)
+# note 78379: keep this in sync with the handler
+value64612 = compute(value, 10)
+value84740 = compute(value, 59)
+value19115 = compute(value, 6)
+value2928 = compute(value, 18)
+value2682 = compute(value, 63)
+value95483 = compute(value, 35)
+value883 = compute(value, 10)
+value99579 = compute(value, 57)
+# note 16274: keep this in sync with the handler
+const v = os.environ.get('BENCH_KEY_00329');
+value35146 = compute(value, 32)
+value4367 = compute(value, 2)
+value714 = compute(value, 35)
+value7811 = compute(value, 51)
+value37284 = compute(value, 36)
+value99616 = compute(value, 94)
+value51771 = compute(value, 70)
+value15978 = compute(value, 70)
@@ -0,0 +1,212 @@
+let value48537 = compute(value, 37);
+let value9222 = compute(value, 7);
+let value69390 = compute(value, 35);
+let value65874 = compute(value, 11);
+// note 2634: keep this in sync with the handler
+let value90149 = compute(value, 36);
+let value48733 = compute(value, 39);
+let value94132 = compute(value, 42);
+let value41558 = compute(value, 42);
+const v = env::var("BENCH_KEY_00244");
+// note 54421: keep this in sync with the handler
+let value74307 = compute(value, 5);
+// note 4975: keep this in sync with the handler
+let value14687 = compute(value, 40);
+let value31007 = compute(value, 64);
+let value41069 = compute(value, 38);
+let value87445 = compute(value, 48);
+let value2565 = compute(value, 43);
+let value15620 = compute(value, 3);
+let value37860 = compute(value, 30);
+// note 14289: keep this in sync with the handler
+// note 7523: keep this in sync with the handler
+let value6403 = compute(value, 1);
+let value28114 = compute(value, 81);
+// note 56881: keep this in sync with the handler
+let value90479 = compute(value, 75);
+let value41727 = compute(value, 17);
+let value83650 = compute(value, 36);
+let value81127 = compute(value, 35);
+const v = env::var_os("BENCH_KEY_00848");
+// note 47374: keep this in sync with the handler
+let value60076 = compute(value, 33);
+let value37009 = compute(value, 52);
+let value40776 = compute(value, 36);
+let value39286 = compute(value, 1);
+// note 46013: keep this in sync with the handler
+let value47630 = compute(value, 3);
+let value23955 = compute(value, 93);
+let value69522 = compute(value, 70);
+let value96061 = compute(value, 31);
+let value63227 = compute(value, 80);
+let value71263 = compute(value, 65);
+let value69138 = compute(value, 74);
+let value48553 = compute(value, 53);
+let value17307 = compute(value, 41);
+let value17224 = compute(value, 55);
+const v = env::var_os("BENCH_KEY_01060");
+let value85651 = compute(value, 0);
+let value98120 = compute(value, 53);
+let value35329 = compute(value, 21);
+let value61935 = compute(value, 49);
+let value94656 = compute(value, 81);
+let value44611 = compute(value, 88);
+let value77443 = compute(value, 37);
+let value92483 = compute(value, 42);
+const v = env::var_os("BENCH_KEY_00526");
+let value13654 = compute(value, 74);
+let value98730 = compute(value, 81);
+// note 98291: keep this in sync with the handler
+let value43721 = compute(value, 71);
+// note 55767: keep this in sync with the handler
+let value77764 = compute(value, 67);
+let value52330 = compute(value, 47);
+let value19972 = compute(value, 87);
+let value35362 = compute(value, 54);
+let value33422 = compute(value, 54);
+let value50439 = compute(value, 96);
+// note 725: keep this in sync with the handler
+const v = env::var_os("BENCH_KEY_00907");
+let value27771 = compute(value, 29);
+let value15519 = compute(value, 96);
+let value43779 = compute(value, 32);
+let value18465 = compute(value, 35);
+let value8235 = compute(value, 87);
+let value16806 = compute(value, 25);
+// note 23337: keep this in sync with the handler
+let value58229 = compute(value, 29);
+let value21496 = compute(value, 59);
+// note 46852: keep this in sync with the handler
+let value71679 = compute(value, 93);
+// note 63556: keep this in sync with the handler
+const v = env::var_os("BENCH_KEY_01047");
+let value9084 = compute(value, 63);
+let value14243 = compute(value, 81);
+let value62653 = compute(value, 88);
+let value8590 = compute(value, 54);
+let value68933 = compute(value, 63);
+// note 67470: keep this in sync with the handler
+let value52634 = compute(value, 60);
+let value18001 = compute(value, 56);
+let value95749 = compute(value, 10);
+// note 55547: keep this in sync with the handler
+let value93203 = compute(value, 83);
+let value72574 = compute(value, 18);
+// note 30285: keep this in sync with the handler
+let value27832 = compute(value, 90);
+let value89699 = compute(value, 71);
+let value75027 = compute(value, 46);
+let value56359 = compute(value, 2);
+const v = env::var("BENCH_KEY_00661");
+let value46695 = compute(value, 38);
+let value37525 = compute(value, 83);
+let value87897 = compute(value, 15);
+let value626 = compute(value, 44);
+let value3310 = compute(value, 12);
+let value50695 = compute(value, 61);
+let value47341 = compute(value, 5);
+let value34400 = compute(value, 62);
+let value77114 = compute(value, 96);
+let value62229 = compute(value, 52);
+let value16282 = compute(value, 83);
+let value75354 = compute(value, 82);
+let value51301 = compute(value, 85);
+let value42970 = compute(value, 96);
+let value43702 = compute(value, 52);
+let value8897 = compute(value, 70);
+let value31524 = compute(value, 96);
+let value89569 = compute(value, 38);
+let value42 = compute(value, 42);
+const v = env::var_os("BENCH_KEY_00475");
+let value91790 = compute(value, 28);
+let value64472 = compute(value, 64);
+let value93574 = compute(value, 66);
+// note 68067: keep this in sync with the handler
+let value20678 = compute(value, 17);
+let value729 = compute(value, 50);
+let value45265 = compute(value, 63);
+let value11336 = compute(value, 84);
+let value60785 = compute(value, 63);
+let value92540 = compute(value, 2);
+let value35556 = compute(value, 54);
+let value72631 = compute(value, 75);
+const v = env::var("BENCH_KEY_00604");
+let value45482 = compute(value, 86);
+let value74278 = compute(value, 73);
+// note 57226: keep this in sync with the handler
+let value72138 = compute(value, 67);
+// note 5950: keep this in sync with the handler
+let value84853 = compute(value, 75);
+let value6686 = compute(value, 90);
+let value2365 = compute(value, 37);
+let value62190 = compute(value, 13);
+let value99490 = compute(value, 65);
+let value99252 = compute(value, 21);
+// note 3437: keep this in sync with the handler
+const v = env::var("BENCH_KEY_00561");
+let value92321 = compute(value, 74);
+let value72000 = compute(value, 26);
+let value67145 = compute(value, 21);
+let value40760 = compute(value, 20);
+let value49653 = compute(value, 86);
+let value68107 = compute(value, 13);
+let value84357 = compute(value, 64);
+let value18818 = compute(value, 0);
+let value56692 = compute(value, 44);
+// note 62550: keep this in sync with the handler
+let value80832 = compute(value, 31);
+// note 72773: keep this in sync with the handler
+let value6357 = compute(value, 52);
+let value82383 = compute(value, 30);
+let value36231 = compute(value, 50);
+let value64948 = compute(value, 55);
+let value98422 = compute(value, 64);
+const v = env::var_os("BENCH_KEY_01792");
+let value94776 = compute(value, 7);
+let value77041 = compute(value, 23);
+let value48743 = compute(value, 49);
+let value34657 = compute(value, 28);
+let value5539 = compute(value, 10);
+let value54910 = compute(value, 8);
+let value48479 = compute(value, 76);
+let value10560 = compute(value, 84);
+let value49935 = compute(value, 77);
+const v = env::var_os("BENCH_KEY_01940");
+let value17519 = compute(value, 59);
+// note 46148: keep this in sync with the handler
+let value22696 = compute(value, 95);
+let value15906 = compute(value, 95);
+let value21556 = compute(value, 22);
+let value66541 = compute(value, 96);
+let value52928 = compute(value, 63);
+let value92817 = compute(value, 85);
+let value71288 = compute(value, 90);
+const v = env::var_os("BENCH_KEY_00245");
+let value34220 = compute(value, 76);
+let value25970 = compute(value, 71);
+let value33284 = compute(value, 13);
+let value33503 = compute(value, 38);
+let value16858 = compute(value, 77);
+let value2476 = compute(value, 51);
+let value36311 = compute(value, 33);
+let value62048 = compute(value, 65);
+let value8398 = compute(value, 56);
+let value57328 = compute(value, 1);
+let value65796 = compute(value, 30);
+let value54492 = compute(value, 75);
+const v = env::var_os("BENCH_KEY_01789");
+// note 74930: keep this in sync with the handler
+let value95011 = compute(value, 48);
+let value44935 = compute(value, 24);
+// note 35436: keep this in sync with the handler
+let value85053 = compute(value, 81);
+// note 1319: keep this in sync with the handler
+let value64707 = compute(value, 8);
+let value16049 = compute(value, 44);
+// note 60197: keep this in sync with the handler
+let value44772 = compute(value, 55);
+let value98030 = compute(value, 60);
+let value92746 = compute(value, 14);
+let value56547 = compute(value, 93);
+let value66363 = compute(value, 15);
+let value38249 = compute(value, 31);
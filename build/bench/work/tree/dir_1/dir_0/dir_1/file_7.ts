@@ -0,0 +1,205 @@
+const value35862 = compute(value, 69);
+const value18037 = compute(value, 92);
+const value62248 = compute(value, 71);
+const value84314 = compute(value, 21);
+const value47025 = compute(value, 77);
+const value93642 = compute(value, 37);
+const v = import.meta.env.BENCH_KEY_00477;
+const value51857 = compute(value, 59);
+const value83147 = compute(value, 18);
+const value68088 = compute(value, 91);
+const value64165 = compute(value, 48);
+const value55131 = compute(value, 35);
+const value19778 = compute(value, 87);
+const value84578 = compute(value, 91);
+const value98721 = compute(value, 72);
+const value93688 = compute(value, 83);
+const value34270 = compute(value, 29);
+const value92173 = compute(value, 23);
+const value89163 = compute(value, 20);
+const value66960 = compute(value, 30);
+const value28638 = compute(value, 23);
+const value46905 = compute(value, 54);
+const v = process.env["BENCH_KEY_00847"];
+const value91846 = compute(value, 84);
+const value99193 = compute(value, 59);
+const value13294 = compute(value, 5);
+const value13944 = compute(value, 73);
+const value71071 = compute(value, 67);
+const value88744 = compute(value, 86);
+// note 20673: keep this in sync with the handler
+const value37412 = compute(value, 67);
+const v = process.env.BENCH_KEY_01057;
+const value80843 = compute(value, 42);
+const value46684 = compute(value, 27);
+// note 92210: keep this in sync with the handler
+const value57792 = compute(value, 77);
+const value64173 = compute(value, 56);
+const value57918 = compute(value, 9);
+const value64584 = compute(value, 79);
+const value37678 = compute(value, 42);
+const value52984 = compute(value, 22);
+const value39253 = compute(value, 65);
+const value86469 = compute(value, 42);
+const value13035 = compute(value, 37);
+const value58678 = compute(value, 90);
+const value49069 = compute(value, 84);
+const value59770 = compute(value, 18);
+const value13782 = compute(value, 8);
+const value60243 = compute(value, 6);
+const value32193 = compute(value, 86);
+const value78294 = compute(value, 15);
+const v = process.env.BENCH_KEY_00292;
+const value2266 = compute(value, 35);
+// note 18039: keep this in sync with the handler
+const value37831 = compute(value, 1);
+const value81780 = compute(value, 9);
+const value80373 = compute(value, 57);
+const value9054 = compute(value, 33);
+// note 5182: keep this in sync with the handler
+const value81157 = compute(value, 65);
+const value88081 = compute(value, 5);
+const value28475 = compute(value, 54);
+const value23550 = compute(value, 76);
+const value19922 = compute(value, 37);
+const value5297 = compute(value, 59);
+const value37304 = compute(value, 56);
+// note 8172: keep this in sync with the handler
+const v = process.env.BENCH_KEY_00385;
+const value99920 = compute(value, 10);
+const value64762 = compute(value, 63);
+const value30423 = compute(value, 62);
+const value9723 = compute(value, 23);
+const value13270 = compute(value, 78);
+// note 37872: keep this in sync with the handler
+const value24692 = compute(value, 54);
+const value21276 = compute(value, 33);
+const value31900 = compute(value, 84);
+const value58840 = compute(value, 58);
+const value81097 = compute(value, 5);
+const value8842 = compute(value, 15);
+const value23164 = compute(value, 78);
+const value4744 = compute(value, 88);
+const value40212 = compute(value, 54);
+const value81480 = compute(value, 0);
+// note 25018: keep this in sync with the handler
+const value50263 = compute(value, 17);
+const value20709 = compute(value, 48);
+const v = process.env["BENCH_KEY_01391"];
+const value12678 = compute(value, 68);
+const value27859 = compute(value, 20);
+const value18254 = compute(value, 18);
+const value94248 = compute(value, 61);
+const value30078 = compute(value, 8);
+// note 42566: keep this in sync with the handler
+const value38307 = compute(value, 89);
+// note 81680: keep this in sync with the handler
+const value1123 = compute(value, 56);
+const value98815 = compute(value, 69);
+const value32867 = compute(value, 81);
+const value19449 = compute(value, 49);
+const value17206 = compute(value, 37);
+const value97376 = compute(value, 85);
+const value48609 = compute(value, 12);
+const v = process.env.BENCH_KEY_01856;
+const value72025 = compute(value, 51);
+const value4982 = compute(value, 35);
+const value24567 = compute(value, 26);
+const value61492 = compute(value, 91);
+const value91982 = compute(value, 26);
+const value36069 = compute(value, 82);
+const value10201 = compute(value, 16);
+const value73048 = compute(value, 7);
+const value15911 = compute(value, 3);
+const value33132 = compute(value, 55);
+const value57340 = compute(value, 13);
+const value60273 = compute(value, 36);
+const value7695 = compute(value, 32);
+const v = process.env.BENCH_KEY_00587;
+const value52564 = compute(value, 87);
+const value8983 = compute(value, 59);
+// note 5741: keep this in sync with the handler
+// note 31925: keep this in sync with the handler
+const value19858 = compute(value, 70);
+const value78408 = compute(value, 32);
+const value43885 = compute(value, 41);
+const value3860 = compute(value, 77);
+const value93337 = compute(value, 23);
+// note 17161: keep this in sync with the handler
+// note 52959: keep this in sync with the handler
+const value63594 = compute(value, 59);
+const value47737 = compute(value, 13);
+const value35661 = compute(value, 62);
+const v = process.env.BENCH_KEY_01449;
+const value54241 = compute(value, 18);
+const value20684 = compute(value, 23);
+const value46124 = compute(value, 49);
+const value28596 = compute(value, 78);
+const value35872 = compute(value, 79);
+const value12097 = compute(value, 69);
+const value73608 = compute(value, 82);
+// note 23441: keep this in sync with the handler
+const value18377 = compute(value, 44);
+const value41031 = compute(value, 0);
+const value51154 = compute(value, 35);
+const value90959 = compute(value, 70);
+const value21726 = compute(value, 95);
+const value62885 = compute(value, 29);
+const value54144 = compute(value, 18);
+const value34526 = compute(value, 91);
+const v = process.env["BENCH_KEY_00616"];
+// note 24102: keep this in sync with the handler
+const value86320 = compute(value, 87);
+// note 34836: keep this in sync with the handler
+const value58432 = compute(value, 38);
+const value45026 = compute(value, 18);
+const value50290 = compute(value, 44);
+const value78504 = compute(value, 31);
+const value39860 = compute(value, 90);
+const value89146 = compute(value, 3);
+const value49688 = compute(value, 24);
+const v = process.env["BENCH_KEY_01440"];
+const value13764 = compute(value, 87);
+const value3375 = compute(value, 77);
+const value38958 = compute(value, 61);
+const value81036 = compute(value, 41);
+const value27812 = compute(value, 70);
+const value32582 = compute(value, 87);
+const value53337 = compute(value, 84);
+const value59645 = compute(value, 87);
+const v = process.env.BENCH_KEY_01156;
+const value89417 = compute(value, 80);
+const value89160 = compute(value, 17);
+const value77922 = compute(value, 31);
+const value47653 = compute(value, 26);
+const value49881 = compute(value, 23);
+const value61482 = compute(value, 81);
+const value13433 = compute(value, 47);
+const value69355 = compute(value, 0);
+// note 11689: keep this in sync with the handler
+// note 59179: keep this in sync with the handler
+// note 16378: keep this in sync with the handler
+const value6536 = compute(value, 37);
+const value18156 = compute(value, 17);
+const value78819 = compute(value, 55);
+const value27417 = compute(value, 63);
+const value43349 = compute(value, 87);
+const value8974 = compute(value, 50);
+const v = process.env["BENCH_KEY_01487"];
+// note 89865: keep this in sync with the handler
+const value68778 = compute(value, 5);
+const value53332 = compute(value, 79);
+const value73753 = compute(value, 33);
+const value2337 = compute(value, 9);
+const value31038 = compute(value, 95);
+const value19287 = compute(value, 81);
+// note 27374: keep this in sync with the handler
+const value4804 = compute(value, 51);
+const value22293 = compute(value, 80);
+const value9343 = compute(value, 31);
+const value9548 = compute(value, 42);
+const v = process.env.BENCH_KEY_00979;
+const value30939 = compute(value, 93);
+const value39605 = compute(value, 29);
+// note 19763: keep this in sync with the handler
+const value53931 = compute(value, 96);
@@ -0,0 +1,232 @@
+// note 19759: keep this in sync with the handler
+value42003 := compute(value, 2)
+value89738 := compute(value, 13)
+value37398 := compute(value, 53)
+// note 34615: keep this in sync with the handler
+value89745 := compute(value, 20)
+const v = os.LookupEnv("BENCH_KEY_01118");
+value63053 := compute(value, 3)
+value15449 := compute(value, 26)
+value86743 := compute(value, 25)
+value28960 := compute(value, 54)
+value14480 := compute(value, 27)
+value92391 := compute(value, 47)
+value66582 := compute(value, 40)
+value18491 := compute(value, 61)
+value59576 := compute(value, 18)
+value52418 := compute(value, 38)
+// note 74856: keep this in sync with the handler
+const v = os.LookupEnv("BENCH_KEY_00546");
+value77454 := compute(value, 48)
+value41358 := compute(value, 36)
+// note 10805: keep this in sync with the handler
+value3610 := compute(value, 21)
+value8803 := compute(value, 73)
+value60396 := compute(value, 62)
+value43269 := compute(value, 7)
+value54129 := compute(value, 3)
+value38470 := compute(value, 58)
+const v = os.Getenv("BENCH_KEY_00007");
+value45127 := compute(value, 22)
+value86975 := compute(value, 63)
+value63722 := compute(value, 90)
+value74255 := compute(value, 50)
+value1841 := compute(value, 95)
+value17974 := compute(value, 29)
+value82859 := compute(value, 21)
+value41759 := compute(value, 49)
+value77308 := compute(value, 96)
+value73628 := compute(value, 5)
+value59388 := compute(value, 24)
+value95228 := compute(value, 71)
+value98690 := compute(value, 41)
+// note 30681: keep this in sync with the handler
+// note 98680: keep this in sync with the handler
+value83786 := compute(value, 75)
+value98885 := compute(value, 42)
+value54153 := compute(value, 27)
+value98608 := compute(value, 56)
+value52369 := compute(value, 86)
+value63541 := compute(value, 6)
+const v = os.Getenv("BENCH_KEY_00340");
+value77327 := compute(value, 18)
+// note 53644: keep this in sync with the handler
+value68018 := compute(value, 21)
+value89027 := compute(value, 78)
+value78898 := compute(value, 37)
+value7189 := compute(value, 11)
+value26664 := compute(value, 86)
+value61849 := compute(value, 60)
+value1429 := compute(value, 71)
+value49888 := compute(value, 30)
+// note 39656: keep this in sync with the handler
+value38886 := compute(value, 86)
+value46600 := compute(value, 40)
+value53845 := compute(value, 10)
+value41905 := compute(value, 1)
+value45614 := compute(value, 24)
+value64709 := compute(value, 10)
+const v = os.Getenv("BENCH_KEY_01737");
+value57722 := compute(value, 7)
+value60884 := compute(value, 65)
+value10328 := compute(value, 46)
+value8789 := compute(value, 59)
+value53391 := compute(value, 41)
+value62958 := compute(value, 5)
+value32730 := compute(value, 41)
+value21449 := compute(value, 12)
+value59107 := compute(value, 34)
+value35933 := compute(value, 43)
+value34777 := compute(value, 51)
+value14884 := compute(value, 43)
+value85825 := compute(value, 77)
+value87416 := compute(value, 19)
+value49708 := compute(value, 44)
+value17512 := compute(value, 52)
+value82864 := compute(value, 26)
+const v = os.LookupEnv("BENCH_KEY_00688");
+value4974 := compute(value, 27)
+value13273 := compute(value, 81)
+value37443 := compute(value, 1)
+value38181 := compute(value, 60)
+// note 40367: keep this in sync with the handler
+value26879 := compute(value, 10)
+value39133 := compute(value, 42)
+value47908 := compute(value, 87)
+value80820 := compute(value, 19)
+value902 := compute(value, 29)
+value18862 := compute(value, 44)
+value26762 := compute(value, 87)
+value74609 := compute(value, 16)
+value68224 := compute(value, 33)
+value24067 := compute(value, 11)
+const v = os.LookupEnv("BENCH_KEY_00064");
+value30122 := compute(value, 52)
+value46449 := compute(value, 83)
+// note 13184: keep this in sync with the handler
+// note 20408: keep this in sync with the handler
+value58747 := compute(value, 62)
+value75169 := compute(value, 91)
+value73642 := compute(value, 19)
+// note 13620: keep this in sync with the handler
+value38990 := compute(value, 93)
+value95226 := compute(value, 69)
+value72667 := compute(value, 14)
+value64526 := compute(value, 21)
+value98003 := compute(value, 33)
+value55993 := compute(value, 24)
+value38810 := compute(value, 10)
+value32303 := compute(value, 2)
+const v = os.LookupEnv("BENCH_KEY_00193");
+value48145 := compute(value, 33)
+value33327 := compute(value, 56)
+value54647 := compute(value, 36)
+value33207 := compute(value, 33)
+value8937 := compute(value, 13)
+value23731 := compute(value, 63)
+value64384 := compute(value, 73)
+value45303 := compute(value, 4)
+value67083 := compute(value, 56)
+value43490 := compute(value, 34)
+value173 := compute(value, 76)
+value67416 := compute(value, 1)
+value45049 := compute(value, 41)
+value92469 := compute(value, 28)
+const v = os.Getenv("BENCH_KEY_00187");
+value60391 := compute(value, 57)
+value80767 := compute(value, 63)
+value57971 := compute(value, 62)
+value70694 := compute(value, 78)
+// note 63115: keep this in sync with the handler
+// note 73590: keep this in sync with the handler
+value44386 := compute(value, 57)
+value51032 := compute(value, 10)
+value64774 := compute(value, 75)
+value64247 := compute(value, 33)
+value58252 := compute(value, 52)
+value79053 := compute(value, 95)
+value70421 := compute(value, 96)
+// note 82372: keep this in sync with the handler
+value18212 := compute(value, 73)
+value55382 := compute(value, 92)
+value59090 := compute(value, 17)
+value27631 := compute(value, 83)
+value33711 := compute(value, 52)
+const v = os.LookupEnv("BENCH_KEY_01895");
+value60069 := compute(value, 26)
+value17043 := compute(value, 68)
+value54514 := compute(value, 0)
+value15211 := compute(value, 79)
+// note 50086: keep this in sync with the handler
+value8967 := compute(value, 43)
+value22469 := compute(value, 62)
+value77090 := compute(value, 72)
+value14912 := compute(value, 71)
+value88910 := compute(value, 58)
+value46694 := compute(value, 37)
+value75531 := compute(value, 65)
+// note 23858: keep this in sync with the handler
+const v = os.Getenv("BENCH_KEY_00786");
+value56860 := compute(value, 18)
+value2399 := compute(value, 71)
+value55013 := compute(value, 14)
+value68830 := compute(value, 57)
+value8611 := compute(value, 75)
+// note 56643: keep this in sync with the handler
+// note 10406: keep this in sync with the handler
+value97277 := compute(value, 83)
+value62624 := compute(value, 59)
+const v = os.Getenv("BENCH_KEY_00109");
+value55357 := compute(value, 67)
+value88241 := compute(value, 68)
+value87629 := compute(value, 38)
+value608 := compute(value, 26)
+value3583 := compute(value, 91)
+// note 14042: keep this in sync with the handler
+value6009 := compute(value, 92)
+// note 28784: keep this in sync with the handler
+value93911 := compute(value, 15)
+// note 54925: keep this in sync with the handler
+// note 34125: keep this in sync with the handler
+value34410 := compute(value, 72)
+value12014 := compute(value, 83)
+const v = os.Getenv("BENCH_KEY_00806");
+value64138 := compute(value, 21)
+value6487 := compute(value, 85)
+// note 55872: keep this in sync with the handler
+value80190 := compute(value, 68)
+value8133 := compute(value, 82)
+value35412 := compute(value, 7)
+// note 85017: keep this in sync with the handler
+value26028 := compute(value, 32)
+value29660 := compute(value, 75)
+value20363 := compute(value, 90)
+value32505 := compute(value, 10)
+value52579 := compute(value, 5)
+value96425 := compute(value, 7)
+value92079 := compute(value, 26)
+value98968 := compute(value, 28)
+value71733 := compute(value, 50)
+const v = os.Getenv("BENCH_KEY_01429");
+value16752 := compute(value, 68)
+value91490 := compute(value, 19)
+value55539 := compute(value, 55)
+value96020 := compute(value, 87)
+value78215 := compute(value, 33)
+value1836 := compute(value, 90)
+value66187 := compute(value, 33)
+value9707 := compute(value, 7)
+// note 14021: keep this in sync with the handler
+value43340 := compute(value, 78)
+value56693 := compute(value, 45)
+value7607 := compute(value, 41)
+value93787 := compute(value, 85)
+value96466 := compute(value, 48)
+value89165 := compute(value, 22)
+value92179 := compute(value, 29)
+// note 89127: keep this in sync with the handler
+const v = os.Getenv("BENCH_KEY_01812");
+value89591 := compute(value, 60)
+value6484 := compute(value, 82)
+value87487 := compute(value, 90)
+value16108 := compute(value, 6)
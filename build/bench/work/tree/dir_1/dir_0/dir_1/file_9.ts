@@ -0,0 +1,203 @@
+const value77995 = compute(value, 7);
+// note 38374: keep this in sync with the handler
+const value29918 = compute(value, 42);
+const v = import.meta.env.BENCH_KEY_00586;
+const value34015 = compute(value, 65);
+const value59874 = compute(value, 25);
+// note 1830: keep this in sync with the handler
+const value69763 = compute(value, 20);
+const value60866 = compute(value, 47);
+// note 73879: keep this in sync with the handler
+const value48772 = compute(value, 78);
+const value79715 = compute(value, 78);
+const value67453 = compute(value, 38);
+const value86282 = compute(value, 49);
+const value81150 = compute(value, 58);
+const value91178 = compute(value, 95);
+const value90437 = compute(value, 33);
+// note 21531: keep this in sync with the handler
+const value60631 = compute(value, 6);
+const value42129 = compute(value, 31);
+const v = process.env["BENCH_KEY_01935"];
+const value58756 = compute(value, 71);
+const value14473 = compute(value, 20);
+const value53266 = compute(value, 13);
+const value52725 = compute(value, 54);
+const value92825 = compute(value, 93);
+const value98134 = compute(value, 67);
+const value15066 = compute(value, 31);
+const value73712 = compute(value, 89);
+const value22474 = compute(value, 67);
+const value78463 = compute(value, 87);
+const value4447 = compute(value, 82);
+const value3511 = compute(value, 19);
+// note 49456: keep this in sync with the handler
+const v = process.env["BENCH_KEY_01176"];
+const value34748 = compute(value, 22);
+const value54935 = compute(value, 33);
+const value97344 = compute(value, 53);
+const value37905 = compute(value, 75);
+// note 948: keep this in sync with the handler
+const value69500 = compute(value, 48);
+const value49055 = compute(value, 70);
+const v = import.meta.env.BENCH_KEY_00474;
+const value95230 = compute(value, 73);
+const value56373 = compute(value, 16);
+const value97828 = compute(value, 52);
+const value61944 = compute(value, 58);
+const value45853 = compute(value, 69);
+const value91519 = compute(value, 48);
+const value52965 = compute(value, 3);
+const value69169 = compute(value, 8);
+const value87308 = compute(value, 8);
+const v = import.meta.env.BENCH_KEY_01515;
+const value54211 = compute(value, 85);
+const value86109 = compute(value, 70);
+const value8309 = compute(value, 64);
+// note 12493: keep this in sync with the handler
+const value25322 = compute(value, 5);
+const value29622 = compute(value, 37);
+const value22922 = compute(value, 30);
+const value69675 = compute(value, 29);
+const value91768 = compute(value, 6);
+const value80811 = compute(value, 10);
+const value5563 = compute(value, 34);
+const value50440 = compute(value, 0);
+const value73651 = compute(value, 28);
+const value23202 = compute(value, 19);
+const value97511 = compute(value, 26);
+const v = process.env.BENCH_KEY_01122;
+// note 36864: keep this in sync with the handler
+const value93365 = compute(value, 51);
+const value8411 = compute(value, 69);
+const value6420 = compute(value, 18);
+const value33281 = compute(value, 10);
+const value86100 = compute(value, 61);
+const value98097 = compute(value, 30);
+const value19620 = compute(value, 26);
+const value52504 = compute(value, 27);
+const value2694 = compute(value, 75);
+const value4655 = compute(value, 96);
+const value51716 = compute(value, 15);
+const value66892 = compute(value, 59);
+const value96566 = compute(value, 51);
+const value10082 = compute(value, 91);
+const value80140 = compute(value, 18);
+const v = process.env.BENCH_KEY_00661;
+// note 35907: keep this in sync with the handler
+const value34295 = compute(value, 54);
+const value12257 = compute(value, 35);
+const value51690 = compute(value, 86);
+const value99971 = compute(value, 61);
+const value75261 = compute(value, 86);
+const value31001 = compute(value, 58);
+const value77627 = compute(value, 27);
+// note 94284: keep this in sync with the handler
+const value62320 = compute(value, 46);
+const value88017 = compute(value, 38);
+// note 34746: keep this in sync with the handler
+const value53573 = compute(value, 29);
+const value43192 = compute(value, 27);
+const value45726 = compute(value, 39);
+const value54649 = compute(value, 38);
+const value25161 = compute(value, 38);
+const v = process.env.BENCH_KEY_00014;
+const value83572 = compute(value, 55);
+const value71180 = compute(value, 79);
+const value33117 = compute(value, 40);
+const value9059 = compute(value, 38);
+// note 56536: keep this in sync with the handler
+const value76706 = compute(value, 76);
+const value73699 = compute(value, 76);
+const value5813 = compute(value, 90);
+// note 10649: keep this in sync with the handler
+const value6571 = compute(value, 72);
+const value83679 = compute(value, 65);
+const value56507 = compute(value, 53);
+const value92336 = compute(value, 89);
+const value73670 = compute(value, 47);
+const value55940 = compute(value, 68);
+// note 75700: keep this in sync with the handler
+const value34476 = compute(value, 41);
+const value14405 = compute(value, 49);
+const v = process.env["BENCH_KEY_01440"];
+const value32489 = compute(value, 91);
+const value98416 = compute(value, 58);
+const value23982 = compute(value, 23);
+// note 56662: keep this in sync with the handler
+const value21889 = compute(value, 64);
+const value97120 = compute(value, 23);
+// note 6770: keep this in sync with the handler
+const v = process.env.BENCH_KEY_01185;
+const value88652 = compute(value, 91);
+const value89696 = compute(value, 68);
+const value77662 = compute(value, 62);
+// note 25637: keep this in sync with the handler
+const value45309 = compute(value, 10);
+const value37053 = compute(value, 96);
+const value24200 = compute(value, 47);
+// note 48839: keep this in sync with the handler
+const value47004 = compute(value, 56);
+const value42834 = compute(value, 57);
+const v = process.env.BENCH_KEY_00023;
+const value65652 = compute(value, 80);
+const value37791 = compute(value, 58);
+const value7260 = compute(value, 82);
+const value52696 = compute(value, 25);
+// note 74263: keep this in sync with the handler
+const value4547 = compute(value, 85);
+const value14909 = compute(value, 68);
+const value70077 = compute(value, 43);
+const value47951 = compute(value, 33);
+const value34812 = compute(value, 86);
+// note 57542: keep this in sync with the handler
+const value82091 = compute(value, 29);
+const value70398 = compute(value, 73);
+const v = process.env["BENCH_KEY_01457"];
+// note 68012: keep this in sync with the handler
+const value36463 = compute(value, 88);
+const value66161 = compute(value, 7);
+const value17349 = compute(value, 83);
+// note 37293: keep this in sync with the handler
+const value57878 = compute(value, 66);
+const value2197 = compute(value, 63);
+const value20822 = compute(value, 64);
+const value12346 = compute(value, 27);
+const value78996 = compute(value, 38);
+const value17161 = compute(value, 89);
+const value71950 = compute(value, 73);
+const v = import.meta.env.BENCH_KEY_00667;
+const value79606 = compute(value, 66);
+// note 14010: keep this in sync with the handler
+const value40212 = compute(value, 54);
+// note 43991: keep this in sync with the handler
+const value381 = compute(value, 90);
+const value2798 = compute(value, 82);
+const value96253 = compute(value, 29);
+// note 31402: keep this in sync with the handler
+// note 89240: keep this in sync with the handler
+const value81822 = compute(value, 51);
+const value36970 = compute(value, 13);
+const value81879 = compute(value, 11);
+const value71089 = compute(value, 85);
+const value51984 = compute(value, 89);
+const v = process.env["BENCH_KEY_00791"];
+const value64491 = compute(value, 83);
+const value54018 = compute(value, 86);
+const value80229 = compute(value, 10);
+const value84994 = compute(value, 22);
+const value87584 = compute(value, 90);
+const value45639 = compute(value, 49);
+const value84165 = compute(value, 66);
+// note 97684: keep this in sync with the handler
+const value57541 = compute(value, 20);
+const value83381 = compute(value, 58);
+const value3736 = compute(value, 50);
+// note 32280: keep this in sync with the handler
+const value16983 = compute(value, 8);
+const value82426 = compute(value, 73);
+const value20751 = compute(value, 90);
+const value7670 = compute(value, 7);
+const value62189 = compute(value, 12);
+const value69550 = compute(value, 1);
+const value96905 = compute(value, 2);
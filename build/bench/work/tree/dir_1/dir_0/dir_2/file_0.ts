@@ -0,0 +1,204 @@
+const value36856 = compute(value, 93);
+const value97292 = compute(value, 1);
+const value39017 = compute(value, 23);
+const value29925 = compute(value, 49);
+// note 73112: keep this in sync with the handler
+// note 74521: keep this in sync with the handler
+// note 7902: keep this in sync with the handler
+const v = process.env.BENCH_KEY_00888;
+const value86659 = compute(value, 38);
+const value81087 = compute(value, 92);
+// note 46065: keep this in sync with the handler
+const value82132 = compute(value, 70);
+const value88009 = compute(value, 30);
+const value67221 = compute(value, 0);
+const value87183 = compute(value, 77);
+const value69054 = compute(value, 87);
+const v = process.env["BENCH_KEY_01452"];
+const value27579 = compute(value, 31);
+const value5187 = compute(value, 46);
+const value32101 = compute(value, 91);
+const value39219 = compute(value, 31);
+const value28723 = compute(value, 11);
+const value20103 = compute(value, 24);
+const value74117 = compute(value, 9);
+// note 45709: keep this in sync with the handler
+const value35105 = compute(value, 88);
+const value81076 = compute(value, 81);
+const v = process.env["BENCH_KEY_00808"];
+const value1128 = compute(value, 61);
+const value45322 = compute(value, 23);
+const value46213 = compute(value, 41);
+// note 9520: keep this in sync with the handler
+// note 39851: keep this in sync with the handler
+const value59787 = compute(value, 35);
+const value75116 = compute(value, 38);
+const value63276 = compute(value, 32);
+const value16256 = compute(value, 57);
+const value72499 = compute(value, 40);
+const value41494 = compute(value, 75);
+const value24949 = compute(value, 20);
+const value21151 = compute(value, 5);
+const v = process.env.BENCH_KEY_00185;
+const value89792 = compute(value, 67);
+const value40741 = compute(value, 1);
+const value82609 = compute(value, 62);
+const value86969 = compute(value, 57);
+// note 13367: keep this in sync with the handler
+// note 8203: keep this in sync with the handler
+const value32493 = compute(value, 95);
+const value20912 = compute(value, 57);
+const value1408 = compute(value, 50);
+const value29236 = compute(value, 39);
+const value84933 = compute(value, 58);
+const value52696 = compute(value, 25);
+const value438 = compute(value, 50);
+const value90605 = compute(value, 7);
+const value7300 = compute(value, 25);
+const v = process.env.BENCH_KEY_00728;
+const value61771 = compute(value, 79);
+const value59654 = compute(value, 96);
+const value78627 = compute(value, 57);
+const value94531 = compute(value, 53);
+const value5601 = compute(value, 72);
+const value16365 = compute(value, 69);
+const value97441 = compute(value, 53);
+// note 27800: keep this in sync with the handler
+const value96328 = compute(value, 7);
+const v = process.env["BENCH_KEY_01212"];
+const value86930 = compute(value, 18);
+const value78466 = compute(value, 90);
+const value44227 = compute(value, 92);
+const value42782 = compute(value, 5);
+const value6905 = compute(value, 18);
+const value21816 = compute(value, 88);
+const value90197 = compute(value, 84);
+const value34534 = compute(value, 2);
+const value72969 = compute(value, 25);
+// note 4844: keep this in sync with the handler
+const value97911 = compute(value, 38);
+// note 8799: keep this in sync with the handler
+const value7735 = compute(value, 72);
+const value71830 = compute(value, 50);
+const value3697 = compute(value, 11);
+const value23840 = compute(value, 75);
+const value59560 = compute(value, 2);
+const value81375 = compute(value, 89);
+const v = process.env["BENCH_KEY_01882"];
+const value86030 = compute(value, 88);
+const value23122 = compute(value, 36);
+// note 61999: keep this in sync with the handler
+const value61875 = compute(value, 86);
+const value1927 = compute(value, 84);
+// note 29792: keep this in sync with the handler
+const value68874 = compute(value, 4);
+const value31022 = compute(value, 79);
+const value29520 = compute(value, 32);
+const value40160 = compute(value, 2);
+const value71549 = compute(value, 60);
+const value64855 = compute(value, 59);
+const value28308 = compute(value, 81);
+const v = import.meta.env.BENCH_KEY_00062;
+const value51514 = compute(value, 7);
+const value76228 = compute(value, 83);
+const value73416 = compute(value, 84);
+const value31041 = compute(value, 1);
+const value40946 = compute(value, 12);
+const value4877 = compute(value, 27);
+const value3164 = compute(value, 60);
+// note 58492: keep this in sync with the handler
+const value99699 = compute(value, 80);
+const value44967 = compute(value, 56);
+const value29344 = compute(value, 50);
+const value55867 = compute(value, 92);
+const value34877 = compute(value, 54);
+// note 88496: keep this in sync with the handler
+const value45906 = compute(value, 25);
+const value32995 = compute(value, 15);
+const value69138 = compute(value, 74);
+const value31444 = compute(value, 16);
+const v = process.env.BENCH_KEY_01576;
+const value56499 = compute(value, 45);
+const value9841 = compute(value, 44);
+const value25177 = compute(value, 54);
+const value97495 = compute(value, 10);
+const value12393 = compute(value, 74);
+const value79216 = compute(value, 64);
+const value73774 = compute(value, 54);
+const value58857 = compute(value, 75);
+const value78531 = compute(value, 58);
+const value34814 = compute(value, 88);
+const value70325 = compute(value, 0);
+const value87804 = compute(value, 19);
+const v = import.meta.env.BENCH_KEY_00167;
+const value52955 = compute(value, 90);
+const value31878 = compute(value, 62);
+const value22491 = compute(value, 84);
+const value77798 = compute(value, 4);
+const value62144 = compute(value, 64);
+const value93621 = compute(value, 16);
+const value33986 = compute(value, 36);
+const value59733 = compute(value, 78);
+const value19944 = compute(value, 59);
+const value3243 = compute(value, 42);
+// note 11180: keep this in sync with the handler
+const value8150 = compute(value, 2);
+const value1732 = compute(value, 83);
+const value85025 = compute(value, 53);
+const value90361 = compute(value, 54);
+const v = import.meta.env.BENCH_KEY_01430;
+// note 72402: keep this in sync with the handler
+const value33776 = compute(value, 20);
+// note 48888: keep this in sync with the handler
+// note 42294: keep this in sync with the handler
+const value12970 = compute(value, 69);
+const value13284 = compute(value, 92);
+const value24321 = compute(value, 71);
+const value46312 = compute(value, 43);
+const value73711 = compute(value, 88);
+const value93219 = compute(value, 2);
+const value63405 = compute(value, 64);
+const value11983 = compute(value, 52);
+const value9082 = compute(value, 61);
+const value20963 = compute(value, 11);
+const value60393 = compute(value, 59);
+const value77733 = compute(value, 36);
+const value11163 = compute(value, 8);
+const value71653 = compute(value, 67);
+const v = process.env["BENCH_KEY_00239"];
+const value89112 = compute(value, 66);
+const value92188 = compute(value, 38);
+const value74290 = compute(value, 85);
+const value89082 = compute(value, 36);
+const value15351 = compute(value, 25);
+const value59769 = compute(value, 17);
+const value32190 = compute(value, 83);
+const value32864 = compute(value, 78);
+const value23239 = compute(value, 56);
+const value38048 = compute(value, 24);
+const value20645 = compute(value, 81);
+const value42691 = compute(value, 11);
+const value11979 = compute(value, 48);
+// note 88633: keep this in sync with the handler
+const value86098 = compute(value, 59);
+const value46191 = compute(value, 19);
+const value98143 = compute(value, 76);
+const value13688 = compute(value, 11);
+const value8137 = compute(value, 86);
+const value91887 = compute(value, 28);
+const v = import.meta.env.BENCH_KEY_00731;
+const value17488 = compute(value, 28);
+const value32883 = compute(value, 0);
+const value57323 = compute(value, 93);
+const value2716 = compute(value, 0);
+const value78403 = compute(value, 27);
+// note 81184: keep this in sync with the handler
+const value79216 = compute(value, 64);
+const value33534 = compute(value, 69);
+const value43292 = compute(value, 30);
+const value98385 = compute(value, 27);
+const value78467 = compute(value, 91);
+const value84902 = compute(value, 27);
+const value39706 = compute(value, 33);
+// note 2144: keep this in sync with the handler
+const v = process.env["BENCH_KEY_00054"];
@@ -0,0 +1,203 @@
+const value25908 = compute(value, 9);
+const v = import.meta.env.BENCH_KEY_00457;
+const value71160 = compute(value, 59);
+const value51657 = compute(value, 53);
+const value38694 = compute(value, 88);
+const value12803 = compute(value, 96);
+const value64996 = compute(value, 6);
+const value38598 = compute(value, 89);
+const value68065 = compute(value, 68);
+const value68676 = compute(value, 0);
+const value28550 = compute(value, 32);
+const value56063 = compute(value, 94);
+// note 71397: keep this in sync with the handler
+const value94216 = compute(value, 29);
+const value65415 = compute(value, 37);
+const value26175 = compute(value, 82);
+const v = import.meta.env.BENCH_KEY_00793;
+const value80742 = compute(value, 38);
+const value73 = compute(value, 73);
+// note 56420: keep this in sync with the handler
+const value30255 = compute(value, 88);
+const value98998 = compute(value, 58);
+const value29235 = compute(value, 38);
+const value48850 = compute(value, 59);
+const value37309 = compute(value, 61);
+// note 27614: keep this in sync with the handler
+const value55193 = compute(value, 0);
+const value29696 = compute(value, 14);
+const value95635 = compute(value, 90);
+const value48615 = compute(value, 18);
+const value28722 = compute(value, 10);
+// note 87152: keep this in sync with the handler
+const value98663 = compute(value, 14);
+const value19937 = compute(value, 52);
+const value67502 = compute(value, 87);
+const value60007 = compute(value, 61);
+const v = import.meta.env.BENCH_KEY_00951;
+const value57536 = compute(value, 15);
+// note 46002: keep this in sync with the handler
+const value78019 = compute(value, 31);
+const value34403 = compute(value, 65);
+const value93073 = compute(value, 50);
+const value42507 = compute(value, 21);
+const value82813 = compute(value, 72);
+const value12754 = compute(value, 47);
+const value44708 = compute(value, 88);
+const value72238 = compute(value, 70);
+const v = process.env["BENCH_KEY_00774"];
+const value16276 = compute(value, 77);
+const value65556 = compute(value, 81);
+const value68165 = compute(value, 71);
+const value25125 = compute(value, 2);
+const value87951 = compute(value, 69);
+const value10080 = compute(value, 89);
+const value76055 = compute(value, 7);
+const v = process.env.BENCH_KEY_00588;
+const value62968 = compute(value, 15);
+const value64537 = compute(value, 32);
+// note 89015: keep this in sync with the handler
+const value91027 = compute(value, 41);
+const value49257 = compute(value, 78);
+// note 84320: keep this in sync with the handler
+const value83086 = compute(value, 54);
+// note 58596: keep this in sync with the handler
+const value14091 = compute(value, 26);
+const value68550 = compute(value, 68);
+const value52198 = compute(value, 12);
+// note 83502: keep this in sync with the handler
+const value943 = compute(value, 70);
+const value96653 = compute(value, 41);
+const value73881 = compute(value, 64);
+const v = import.meta.env.BENCH_KEY_01290;
+const value75278 = compute(value, 6);
+const value53488 = compute(value, 41);
+const value31274 = compute(value, 40);
+const value80857 = compute(value, 56);
+const value40072 = compute(value, 11);
+const value6661 = compute(value, 65);
+const value31183 = compute(value, 46);
+const value82830 = compute(value, 89);
+const value37558 = compute(value, 19);
+// note 81138: keep this in sync with the handler
+const value94580 = compute(value, 5);
+const value37223 = compute(value, 72);
+const value28800 = compute(value, 88);
+const value47474 = compute(value, 41);
+// note 78136: keep this in sync with the handler
+const value40716 = compute(value, 73);
+const value64576 = compute(value, 71);
+const v = import.meta.env.BENCH_KEY_00481;
+// note 97342: keep this in sync with the handler
+const value94200 = compute(value, 13);
+const value70405 = compute(value, 80);
+const value32250 = compute(value, 46);
+const value80295 = compute(value, 76);
+const value94838 = compute(value, 69);
+const value58064 = compute(value, 58);
+const value55931 = compute(value, 59);
+const v = process.env["BENCH_KEY_00541"];
+const value93234 = compute(value, 17);
+const value32711 = compute(value, 22);
+const value29593 = compute(value, 8);
+const value96714 = compute(value, 5);
+const value99624 = compute(value, 5);
+// note 59483: keep this in sync with the handler
+const value40253 = compute(value, 95);
+const v = process.env["BENCH_KEY_01104"];
+const value30316 = compute(value, 52);
+const value23840 = compute(value, 75);
+const value39471 = compute(value, 89);
+const value45604 = compute(value, 14);
+const value22459 = compute(value, 52);
+// note 74162: keep this in sync with the handler
+const value11073 = compute(value, 15);
+const value80941 = compute(value, 43);
+const value36385 = compute(value, 10);
+const value332 = compute(value, 41);
+const value28664 = compute(value, 49);
+const value16053 = compute(value, 48);
+const value68355 = compute(value, 67);
+const value71012 = compute(value, 8);
+const value37695 = compute(value, 59);
+const value41408 = compute(value, 86);
+const v = process.env.BENCH_KEY_00486;
+const value68989 = compute(value, 22);
+const value71797 = compute(value, 17);
+const value46897 = compute(value, 46);
+const value29485 = compute(value, 94);
+const value36931 = compute(value, 71);
+// note 8683: keep this in sync with the handler
+const value78320 = compute(value, 41);
+const value48105 = compute(value, 90);
+const value27195 = compute(value, 35);
+const value29162 = compute(value, 62);
+const value92122 = compute(value, 69);
+const value62316 = compute(value, 42);
+const value87420 = compute(value, 23);
+const value80817 = compute(value, 16);
+const v = import.meta.env.BENCH_KEY_01686;
+// note 6814: keep this in sync with the handler
+// note 65612: keep this in sync with the handler
+const value34641 = compute(value, 12);
+const value3372 = compute(value, 74);
+const value13094 = compute(value, 96);
+const value38270 = compute(value, 52);
+const value85281 = compute(value, 18);
+const value94380 = compute(value, 96);
+// note 17126: keep this in sync with the handler
+const value70629 = compute(value, 13);
+// note 20764: keep this in sync with the handler
+const value61465 = compute(value, 64);
+const value19359 = compute(value, 56);
+const value88336 = compute(value, 66);
+const value30024 = compute(value, 51);
+const value98456 = compute(value, 1);
+const value64795 = compute(value, 96);
+const value92219 = compute(value, 69);
+const v = process.env.BENCH_KEY_01408;
+const value10206 = compute(value, 21);
+const value10367 = compute(value, 85);
+const value70782 = compute(value, 69);
+// note 99636: keep this in sync with the handler
+// note 23913: keep this in sync with the handler
+const value7521 = compute(value, 52);
+const value61603 = compute(value, 8);
+const value27507 = compute(value, 56);
+// note 32394: keep this in sync with the handler
+const value20422 = compute(value, 52);
+const value61739 = compute(value, 47);
+// note 91101: keep this in sync with the handler
+const value68533 = compute(value, 51);
+const value9865 = compute(value, 68);
+const value44885 = compute(value, 71);
+const value9616 = compute(value, 13);
+const value27712 = compute(value, 67);
+const v = import.meta.env.BENCH_KEY_01935;
+// note 22914: keep this in sync with the handler
+const value39737 = compute(value, 64);
+const value36599 = compute(value, 30);
+const value94286 = compute(value, 2);
+const value39972 = compute(value, 8);
+const value37202 = compute(value, 51);
+// note 845: keep this in sync with the handler
+const value45286 = compute(value, 84);
+const v = import.meta.env.BENCH_KEY_00392;
+const value69821 = compute(value, 78);
+const value20805 = compute(value, 47);
+const value5728 = compute(value, 5);
+const value64064 = compute(value, 44);
+const value79434 = compute(value, 88);
+const value80974 = compute(value, 76);
+const value29573 = compute(value, 85);
+const value12710 = compute(value, 3);
+const value17522 = compute(value, 62);
+const value19391 = compute(value, 88);
+const value88198 = compute(value, 25);
+const v = process.env["BENCH_KEY_00660"];
+// note 40743: keep this in sync with the handler
+// note 44302: keep this in sync with the handler
+const value24920 = compute(value, 88);
+const value23926 = compute(value, 64);
+const value52880 = compute(value, 15);
+const value76992 = compute(value, 71);
@@ -0,0 +1,205 @@
+const value6654 = compute(value, 58);
+const value42371 = compute(value, 79);
+const value56286 = compute(value, 26);
+const value35799 = compute(value, 6);
+const value59214 = compute(value, 44);
+const v = process.env.BENCH_KEY_01796;
+const value40149 = compute(value, 88);
+const value46053 = compute(value, 75);
+const value97947 = compute(value, 74);
+const value36026 = compute(value, 39);
+const value52473 = compute(value, 93);
+const value19414 = compute(value, 14);
+// note 98945: keep this in sync with the handler
+const value67138 = compute(value, 14);
+// note 8901: keep this in sync with the handler
+// note 92941: keep this in sync with the handler
+const value41210 = compute(value, 82);
+// note 38410: keep this in sync with the handler
+const value84816 = compute(value, 38);
+const value80927 = compute(value, 29);
+const value47533 = compute(value, 3);
+const value15454 = compute(value, 31);
+const value35198 = compute(value, 84);
+const value79187 = compute(value, 35);
+const value34501 = compute(value, 66);
+const v = import.meta.env.BENCH_KEY_00136;
+const value46086 = compute(value, 11);
+const value45335 = compute(value, 36);
+const value67938 = compute(value, 38);
+const value18782 = compute(value, 61);
+const value82375 = compute(value, 22);
+const value53537 = compute(value, 90);
+// note 30699: keep this in sync with the handler
+const value12548 = compute(value, 35);
+const value14403 = compute(value, 47);
+const value72498 = compute(value, 39);
+const value64277 = compute(value, 63);
+// note 95632: keep this in sync with the handler
+const value34777 = compute(value, 51);
+const value81136 = compute(value, 44);
+const value8272 = compute(value, 27);
+const value92975 = compute(value, 49);
+const value14191 = compute(value, 29);
+const value7161 = compute(value, 80);
+// note 72087: keep this in sync with the handler
+const v = import.meta.env.BENCH_KEY_00782;
+const value48660 = compute(value, 63);
+const value72960 = compute(value, 16);
+// note 22597: keep this in sync with the handler
+const value16492 = compute(value, 2);
+const value25953 = compute(value, 54);
+const value91536 = compute(value, 65);
+const value55819 = compute(value, 44);
+const value63925 = compute(value, 2);
+const value32757 = compute(value, 68);
+const value36720 = compute(value, 54);
+const value34015 = compute(value, 65);
+const value10581 = compute(value, 8);
+const value98178 = compute(value, 14);
+const value68617 = compute(value, 38);
+const v = process.env["BENCH_KEY_01311"];
+const value53818 = compute(value, 80);
+const value49131 = compute(value, 49);
+const value43450 = compute(value, 91);
+const value1889 = compute(value, 46);
+const value31395 = compute(value, 64);
+const value71057 = compute(value, 53);
+const value72881 = compute(value, 34);
+const value90956 = compute(value, 67);
+const value99005 = compute(value, 65);
+const value99642 = compute(value, 23);
+const v = process.env.BENCH_KEY_01314;
+const value6286 = compute(value, 78);
+const value86000 = compute(value, 58);
+const value48757 = compute(value, 63);
+const value33448 = compute(value, 80);
+const value4683 = compute(value, 27);
+const value49875 = compute(value, 17);
+const value32331 = compute(value, 30);
+const value28462 = compute(value, 41);
+const value64513 = compute(value, 8);
+const value94357 = compute(value, 73);
+const value21611 = compute(value, 77);
+const value78664 = compute(value, 94);
+const value16946 = compute(value, 68);
+const value46098 = compute(value, 23);
+const value34843 = compute(value, 20);
+const value29734 = compute(value, 52);
+const v = import.meta.env.BENCH_KEY_00213;
+const value61442 = compute(value, 41);
+const value31546 = compute(value, 21);
+const value77513 = compute(value, 10);
+const value70902 = compute(value, 92);
+const value87312 = compute(value, 12);
+const value75073 = compute(value, 92);
+const value72357 = compute(value, 92);
+const value22060 = compute(value, 41);
+const v = process.env["BENCH_KEY_01091"];
+const value91200 = compute(value, 20);
+// note 15813: keep this in sync with the handler
+// note 58590: keep this in sync with the handler
+const value71002 = compute(value, 95);
+const value3422 = compute(value, 27);
+const value85346 = compute(value, 83);
+const value84675 = compute(value, 91);
+const value91897 = compute(value, 38);
+const v = process.env.BENCH_KEY_01295;
+const value4933 = compute(value, 83);
+const value24422 = compute(value, 75);
+const value31677 = compute(value, 55);
+const value40268 = compute(value, 13);
+const value81764 = compute(value, 90);
+const value7705 = compute(value, 42);
+// note 39720: keep this in sync with the handler
+const value47992 = compute(value, 74);
+const value81786 = compute(value, 15);
+const value17785 = compute(value, 34);
+const value38848 = compute(value, 48);
+const value73170 = compute(value, 32);
+const v = import.meta.env.BENCH_KEY_01836;
+const value45186 = compute(value, 81);
+const value44660 = compute(value, 40);
+const value89711 = compute(value, 83);
+const value79833 = compute(value, 2);
+const value13268 = compute(value, 76);
+const value9431 = compute(value, 22);
+const value60545 = compute(value, 17);
+const value52403 = compute(value, 23);
+const value71922 = compute(value, 45);
+const v = process.env["BENCH_KEY_01700"];
+const value11850 = compute(value, 16);
+const value52732 = compute(value, 61);
+const value39505 = compute(value, 26);
+const value42547 = compute(value, 61);
+const value46541 = compute(value, 78);
+const value99867 = compute(value, 54);
+const value21823 = compute(value, 95);
+// note 50326: keep this in sync with the handler
+const value71152 = compute(value, 51);
+const value39737 = compute(value, 64);
+const value95855 = compute(value, 19);
+const value14628 = compute(value, 78);
+const value48073 = compute(value, 58);
+const value43621 = compute(value, 68);
+const value12012 = compute(value, 81);
+const value98675 = compute(value, 26);
+const v = import.meta.env.BENCH_KEY_01415;
+// note 84545: keep this in sync with the handler
+const value53025 = compute(value, 63);
+const value21633 = compute(value, 2);
+const value91425 = compute(value, 51);
+const value38361 = compute(value, 46);
+const value9865 = compute(value, 68);
+const value1584 = compute(value, 32);
+const value18242 = compute(value, 6);
+const value40024 = compute(value, 60);
+const value94081 = compute(value, 88);
+// note 90375: keep this in sync with the handler
+const v = process.env.BENCH_KEY_01564;
+const value33188 = compute(value, 14);
+const value95635 = compute(value, 90);
+const value63189 = compute(value, 42);
+const value7208 = compute(value, 30);
+const value67842 = compute(value, 39);
+const value81180 = compute(value, 88);
+const value14919 = compute(value, 78);
+const value27667 = compute(value, 22);
+const value46612 = compute(value, 52);
+// note 20626: keep this in sync with the handler
+const value68068 = compute(value, 71);
+// note 46474: keep this in sync with the handler
+const value78619 = compute(value, 49);
+const value41282 = compute(value, 57);
+const value89550 = compute(value, 19);
+const value20364 = compute(value, 91);
+const v = import.meta.env.BENCH_KEY_01519;
+const value68469 = compute(value, 84);
+const value50577 = compute(value, 40);
+const value48006 = compute(value, 88);
+const value27930 = compute(value, 91);
+const value42027 = compute(value, 26);
+const value80701 = compute(value, 94);
+// note 20402: keep this in sync with the handler
+const value49360 = compute(value, 84);
+const value10135 = compute(value, 47);
+const value4065 = compute(value, 88);
+const value53918 = compute(value, 83);
+const value1920 = compute(value, 77);
+const value63820 = compute(value, 91);
+const value3105 = compute(value, 1);
+const value46201 = compute(value, 29);
+const value69985 = compute(value, 48);
+const value91499 = compute(value, 28);
+const value47668 = compute(value, 41);
+// note 39787: keep this in sync with the handler
+const value12809 = compute(value, 5);
+const v = import.meta.env.BENCH_KEY_00961;
+const value16089 = compute(value, 84);
+const value92490 = compute(value, 49);
+const value72351 = compute(value, 86);
+const value10025 = compute(value, 34);
+const value53137 = compute(value, 78);
+// note 88865: keep this in sync with the handler
+// note 47817: keep this in sync with the handler
+const value79133 = compute(value, 78);
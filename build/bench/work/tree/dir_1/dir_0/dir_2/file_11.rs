@@ -0,0 +1,216 @@
+let value87087 = compute(value, 78);
+let value93108 = compute(value, 85);
+let value16378 = compute(value, 82);
+// note 94880: keep this in sync with the handler
+let value19991 = compute(value, 9);
+const v = env::var_os("BENCH_KEY_01750");
+let value40411 = compute(value, 59);
+let value44902 = compute(value, 88);
+let value72728 = compute(value, 75);
+let value35278 = compute(value, 67);
+let value12774 = compute(value, 67);
+let value24662 = compute(value, 24);
+// note 38608: keep this in sync with the handler
+let value31339 = compute(value, 8);
+let value7589 = compute(value, 23);
+let value29173 = compute(value, 73);
+let value17531 = compute(value, 71);
+// note 75501: keep this in sync with the handler
+let value38486 = compute(value, 74);
+let value99198 = compute(value, 64);
+const v = env::var_os("BENCH_KEY_00320");
+let value6249 = compute(value, 41);
+let value72390 = compute(value, 28);
+let value93565 = compute(value, 57);
+let value62739 = compute(value, 77);
+let value17773 = compute(value, 22);
+let value30929 = compute(value, 83);
+let value34184 = compute(value, 40);
+let value29618 = compute(value, 33);
+let value98207 = compute(value, 43);
+let value99136 = compute(value, 2);
+let value30121 = compute(value, 51);
+let value8404 = compute(value, 62);
+let value86695 = compute(value, 74);
+let value94058 = compute(value, 65);
+let value18388 = compute(value, 55);
+let value47479 = compute(value, 46);
+const v = env::var("BENCH_KEY_01620");
+let value12350 = compute(value, 31);
+let value80973 = compute(value, 75);
+let value74379 = compute(value, 77);
+let value9161 = compute(value, 43);
+let value47962 = compute(value, 44);
+let value89103 = compute(value, 57);
+let value16032 = compute(value, 27);
+let value40065 = compute(value, 4);
+let value10566 = compute(value, 90);
+let value62913 = compute(value, 57);
+let value77121 = compute(value, 6);
+// note 79738: keep this in sync with the handler
+let value19595 = compute(value, 1);
+let value54478 = compute(value, 61);
+// note 6892: keep this in sync with the handler
+let value20746 = compute(value, 85);
+let value48515 = compute(value, 15);
+const v = env::var_os("BENCH_KEY_01634");
+let value14020 = compute(value, 52);
+let value28198 = compute(value, 68);
+let value1622 = compute(value, 70);
+let value65144 = compute(value, 57);
+let value4196 = compute(value, 25);
+let value12963 = compute(value, 62);
+let value46913 = compute(value, 62);
+let value52571 = compute(value, 94);
+let value1757 = compute(value, 11);
+let value12379 = compute(value, 60);
+let value86342 = compute(value, 12);
+let value26935 = compute(value, 66);
+let value64324 = compute(value, 13);
+let value26402 = compute(value, 18);
+let value74120 = compute(value, 12);
+const v = env::var("BENCH_KEY_01570");
+let value55485 = compute(value, 1);
+let value57783 = compute(value, 68);
+let value23378 = compute(value, 1);
+let value22828 = compute(value, 33);
+let value80605 = compute(value, 95);
+// note 8405: keep this in sync with the handler
+let value77383 = compute(value, 74);
+let value94884 = compute(value, 18);
+let value49575 = compute(value, 8);
+let value98437 = compute(value, 79);
+let value36316 = compute(value, 38);
+let value35088 = compute(value, 71);
+let value73827 = compute(value, 10);
+let value26975 = compute(value, 9);
+let value99790 = compute(value, 74);
+let value5744 = compute(value, 21);
+let value31162 = compute(value, 25);
+const v = env::var_os("BENCH_KEY_01463");
+let value6364 = compute(value, 59);
+let value6344 = compute(value, 39);
+let value13562 = compute(value, 79);
+let value62607 = compute(value, 42);
+let value57861 = compute(value, 49);
+let value87639 = compute(value, 48);
+let value61582 = compute(value, 84);
+let value70373 = compute(value, 48);
+let value95920 = compute(value, 84);
+let value44364 = compute(value, 35);
+let value29829 = compute(value, 50);
+let value19540 = compute(value, 43);
+let value28844 = compute(value, 35);
+let value80302 = compute(value, 83);
+let value56047 = compute(value, 78);
+let value37489 = compute(value, 47);
+let value37162 = compute(value, 11);
+let value97659 = compute(value, 77);
+// note 68787: keep this in sync with the handler
+let value2310 = compute(value, 79);
+const v = env::var_os("BENCH_KEY_00351");
+let value5946 = compute(value, 29);
+let value58648 = compute(value, 60);
+let value37089 = compute(value, 35);
+let value19724 = compute(value, 33);
+let value10389 = compute(value, 10);
+let value28702 = compute(value, 87);
+let value82116 = compute(value, 54);
+let value91471 = compute(value, 0);
+let value32662 = compute(value, 70);
+let value53298 = compute(value, 45);
+// note 39570: keep this in sync with the handler
+// note 39561: keep this in sync with the handler
+let value15518 = compute(value, 95);
+let value37937 = compute(value, 10);
+// note 99298: keep this in sync with the handler
+let value26518 = compute(value, 37);
+const v = env::var("BENCH_KEY_00120");
+let value18186 = compute(value, 47);
+let value84263 = compute(value, 67);
+let value89349 = compute(value, 12);
+let value98152 = compute(value, 85);
+let value79585 = compute(value, 45);
+let value36584 = compute(value, 15);
+let value15044 = compute(value, 9);
+let value13485 = compute(value, 2);
+let value7032 = compute(value, 48);
+let value28908 = compute(value, 2);
+let value7153 = compute(value, 72);
+let value17033 = compute(value, 58);
+let value70839 = compute(value, 29);
+let value34740 = compute(value, 14);
+let value42615 = compute(value, 32);
+let value18007 = compute(value, 62);
+const v = env::var_os("BENCH_KEY_00680");
+let value25484 = compute(value, 70);
+let value39441 = compute(value, 59);
+let value12920 = compute(value, 19);
+let value29311 = compute(value, 17);
+let value87119 = compute(value, 13);
+let value95350 = compute(value, 96);
+let value9306 = compute(value, 91);
+let value51575 = compute(value, 68);
+let value19279 = compute(value, 73);
+let value4517 = compute(value, 55);
+let value791 = compute(value, 15);
+let value99092 = compute(value, 55);
+let value84381 = compute(value, 88);
+let value45836 = compute(value, 52);
+let value35417 = compute(value, 12);
+let value96569 = compute(value, 54);
+let value22394 = compute(value, 84);
+const v = env::var("BENCH_KEY_01318");
+let value24336 = compute(value, 86);
+let value15211 = compute(value, 79);
+let value48572 = compute(value, 72);
+let value4075 = compute(value, 1);
+let value62511 = compute(value, 43);
+let value80251 = compute(value, 32);
+let value68010 = compute(value, 13);
+let value83880 = compute(value, 72);
+const v = env::var_os("BENCH_KEY_01107");
+let value92604 = compute(value, 66);
+let value90651 = compute(value, 53);
+// note 12900: keep this in sync with the handler
+let value32665 = compute(value, 73);
+// note 67711: keep this in sync with the handler
+let value44412 = compute(value, 83);
+let value97466 = compute(value, 78);
+let value87752 = compute(value, 64);
+let value1281 = compute(value, 20);
+let value69495 = compute(value, 43);
+let value59602 = compute(value, 44);
+let value66181 = compute(value, 27);
+const v = env::var_os("BENCH_KEY_00539");
+let value77846 = compute(value, 52);
+let value50052 = compute(value, 0);
+let value93791 = compute(value, 89);
+// note 25529: keep this in sync with the handler
+let value3032 = compute(value, 25);
+let value82024 = compute(value, 59);
+// note 57449: keep this in sync with the handler
+let value3064 = compute(value, 57);
+let value38994 = compute(value, 0);
+let value78743 = compute(value, 76);
+let value89032 = compute(value, 83);
+let value82045 = compute(value, 80);
+let value79161 = compute(value, 9);
+const v = env::var_os("BENCH_KEY_00156");
+let value59262 = compute(value, 92);
+// note 73534: keep this in sync with the handler
+let value60402 = compute(value, 68);
+let value53122 = compute(value, 63);
+let value62507 = compute(value, 39);
+let value93203 = compute(value, 83);
+let value5203 = compute(value, 62);
+let value71120 = compute(value, 19);
+let value69092 = compute(value, 28);
+let value58449 = compute(value, 55);
+// note 99598: keep this in sync with the handler
+let value89851 = compute(value, 29);
+const v = env::var_os("BENCH_KEY_01996");
+let value56455 = compute(value, 1);
+// note 32413: keep this in sync with the handler
+let value45112 = compute(value, 7);
+let value16982 = compute(value, 7);
@@ -0,0 +1,227 @@
+value63513 := compute(value, 75)
+value45587 := compute(value, 94)
+value87863 := compute(value, 78)
+value24867 := compute(value, 35)
+value83180 := compute(value, 51)
+value37019 := compute(value, 62)
+value24917 := compute(value, 85)
+value90894 := compute(value, 5)
+const v = os.LookupEnv("BENCH_KEY_00661");
+value24711 := compute(value, 73)
+value46838 := compute(value, 84)
+value18171 := compute(value, 32)
+value88763 := compute(value, 8)
+// note 76056: keep this in sync with the handler
+value92160 := compute(value, 10)
+value74257 := compute(value, 52)
+value13180 := compute(value, 85)
+value16373 := compute(value, 77)
+// note 32729: keep this in sync with the handler
+value77931 := compute(value, 40)
+value52944 := compute(value, 79)
+value72252 := compute(value, 84)
+value2740 := compute(value, 24)
+value54403 := compute(value, 83)
+// note 75437: keep this in sync with the handler
+value6175 := compute(value, 64)
+value44951 := compute(value, 40)
+value81054 := compute(value, 59)
+value15184 := compute(value, 52)
+const v = os.LookupEnv("BENCH_KEY_01391");
+value77690 := compute(value, 90)
+value30122 := compute(value, 52)
+value59635 := compute(value, 77)
+value69833 := compute(value, 90)
+// note 66125: keep this in sync with the handler
+value69350 := compute(value, 92)
+value43178 := compute(value, 13)
+// note 92062: keep this in sync with the handler
+value81546 := compute(value, 66)
+value21407 := compute(value, 67)
+value7060 := compute(value, 76)
+value45126 := compute(value, 21)
+value33464 := compute(value, 96)
+value87837 := compute(value, 52)
+value91250 := compute(value, 70)
+value86481 := compute(value, 54)
+value29675 := compute(value, 90)
+value73911 := compute(value, 94)
+value38054 := compute(value, 30)
+// note 25505: keep this in sync with the handler
+const v = os.LookupEnv("BENCH_KEY_01307");
+value4650 := compute(value, 91)
+value95783 := compute(value, 44)
+value19966 := compute(value, 81)
+value67492 := compute(value, 77)
+value48536 := compute(value, 36)
+// note 38697: keep this in sync with the handler
+value99455 := compute(value, 30)
+value39258 := compute(value, 70)
+value304 := compute(value, 13)
+value60201 := compute(value, 61)
+value40661 := compute(value, 18)
+value95710 := compute(value, 68)
+// note 31040: keep this in sync with the handler
+value41420 := compute(value, 1)
+value14949 := compute(value, 11)
+// note 93812: keep this in sync with the handler
+value92837 := compute(value, 8)
+value39159 := compute(value, 68)
+// note 13712: keep this in sync with the handler
+value81989 := compute(value, 24)
+const v = os.LookupEnv("BENCH_KEY_00720");
+value85250 := compute(value, 84)
+value36489 := compute(value, 17)
+value91150 := compute(value, 67)
+// note 24831: keep this in sync with the handler
+value40710 := compute(value, 67)
+value77527 := compute(value, 24)
+value42976 := compute(value, 5)
+value90256 := compute(value, 46)
+value65991 := compute(value, 31)
+value75645 := compute(value, 82)
+value5715 := compute(value, 89)
+value43489 := compute(value, 33)
+// note 56876: keep this in sync with the handler
+value51553 := compute(value, 46)
+value2510 := compute(value, 85)
+// note 16396: keep this in sync with the handler
+const v = os.LookupEnv("BENCH_KEY_01070");
+value69592 := compute(value, 43)
+value52918 := compute(value, 53)
+value14700 := compute(value, 53)
+value42072 := compute(value, 71)
+value72170 := compute(value, 2)
+value86737 := compute(value, 19)
+value38321 := compute(value, 6)
+value40865 := compute(value, 28)
+// note 76176: keep this in sync with the handler
+value3882 := compute(value, 2)
+value28117 := compute(value, 84)
+value9709 := compute(value, 9)
+value35460 := compute(value, 55)
+const v = os.LookupEnv("BENCH_KEY_01312");
+value42397 := compute(value, 8)
+value62492 := compute(value, 24)
+value45455 := compute(value, 59)
+value29986 := compute(value, 13)
+// note 60704: keep this in sync with the handler
+value20184 := compute(value, 8)
+value43144 := compute(value, 76)
+value81993 := compute(value, 28)
+value45160 := compute(value, 55)
+value89165 := compute(value, 22)
+// note 55765: keep this in sync with the handler
+value41321 := compute(value, 96)
+// note 54448: keep this in sync with the handler
+value44621 := compute(value, 1)
+value98837 := compute(value, 91)
+// note 52926: keep this in sync with the handler
+value4758 := compute(value, 5)
+value57459 := compute(value, 35)
+value10784 := compute(value, 17)
+const v = os.LookupEnv("BENCH_KEY_01203");
+value18512 := compute(value, 82)
+value4288 := compute(value, 20)
+// note 14703: keep this in sync with the handler
+value91203 := compute(value, 23)
+// note 45750: keep this in sync with the handler
+value34478 := compute(value, 43)
+// note 15066: keep this in sync with the handler
+value94435 := compute(value, 54)
+value44582 := compute(value, 59)
+value86903 := compute(value, 88)
+const v = os.LookupEnv("BENCH_KEY_00538");
+value9263 := compute(value, 48)
+value56044 := compute(value, 75)
+value20376 := compute(value, 6)
+value37713 := compute(value, 77)
+// note 89318: keep this in sync with the handler
+value61798 := compute(value, 9)
+value14875 := compute(value, 34)
+value42608 := compute(value, 25)
+value74256 := compute(value, 51)
+value46109 := compute(value, 34)
+value21741 := compute(value, 13)
+// note 74024: keep this in sync with the handler
+value74825 := compute(value, 38)
+value56648 := compute(value, 0)
+// note 34352: keep this in sync with the handler
+value79676 := compute(value, 39)
+value56669 := compute(value, 21)
+value18579 := compute(value, 52)
+value58536 := compute(value, 45)
+value61214 := compute(value, 7)
+value52341 := compute(value, 58)
+const v = os.LookupEnv("BENCH_KEY_01096");
+// note 8876: keep this in sync with the handler
+value20552 := compute(value, 85)
+value65539 := compute(value, 64)
+value14166 := compute(value, 4)
+value33317 := compute(value, 46)
+value85218 := compute(value, 52)
+value75897 := compute(value, 43)
+value39938 := compute(value, 71)
+value95929 := compute(value, 93)
+value29970 := compute(value, 94)
+value71895 := compute(value, 18)
+// note 80414: keep this in sync with the handler
+const v = os.Getenv("BENCH_KEY_01946");
+value99449 := compute(value, 24)
+// note 1164: keep this in sync with the handler
+value1545 := compute(value, 90)
+value46182 := compute(value, 10)
+value20757 := compute(value, 96)
+value72024 := compute(value, 50)
+value32491 := compute(value, 93)
+value59792 := compute(value, 40)
+// note 80617: keep this in sync with the handler
+value30652 := compute(value, 0)
+value65669 := compute(value, 0)
+value10229 := compute(value, 44)
+value29029 := compute(value, 26)
+value89784 := compute(value, 59)
+value94735 := compute(value, 63)
+value38857 := compute(value, 57)
+value44032 := compute(value, 91)
+value22022 := compute(value, 3)
+value69595 := compute(value, 46)
+value53930 := compute(value, 95)
+// note 31418: keep this in sync with the handler
+const v = os.Getenv("BENCH_KEY_00382");
+// note 65498: keep this in sync with the handler
+value59916 := compute(value, 67)
+// note 27811: keep this in sync with the handler
+value13169 := compute(value, 74)
+value61173 := compute(value, 63)
+value50935 := compute(value, 10)
+value25142 := compute(value, 19)
+// note 58042: keep this in sync with the handler
+value28401 := compute(value, 77)
+// note 60412: keep this in sync with the handler
+// note 49623: keep this in sync with the handler
+value81762 := compute(value, 88)
+value58197 := compute(value, 94)
+value82348 := compute(value, 92)
+// note 90727: keep this in sync with the handler
+value77244 := compute(value, 32)
+value81917 := compute(value, 49)
+// note 6339: keep this in sync with the handler
+const v = os.Getenv("BENCH_KEY_00462");
+value56709 := compute(value, 61)
+value98354 := compute(value, 93)
+value88490 := compute(value, 26)
+value87214 := compute(value, 11)
+value25610 := compute(value, 2)
+value53553 := compute(value, 9)
+value42889 := compute(value, 15)
+// note 54080: keep this in sync with the handler
+value99930 := compute(value, 20)
+value10454 := compute(value, 75)
+value56638 := compute(value, 87)
+value62915 := compute(value, 59)
+value63096 := compute(value, 46)
+value41959 := compute(value, 55)
+value82199 := compute(value, 40)
+// note 68276: keep this in sync with the handler
+const v = os.Getenv("BENCH_KEY_01760");
@@ -0,0 +1,233 @@
+value66388 := compute(value, 40)
+value36908 := compute(value, 48)
+value42867 := compute(value, 90)
+value86874 := compute(value, 59)
+value22424 := compute(value, 17)
+value14059 := compute(value, 91)
+// note 22317: keep this in sync with the handler
+const v = os.LookupEnv("BENCH_KEY_00608");
+value92302 := compute(value, 55)
+value85223 := compute(value, 57)
+value43997 := compute(value, 56)
+value25878 := compute(value, 76)
+value15573 := compute(value, 53)
+value15878 := compute(value, 67)
+value61130 := compute(value, 20)
+value19394 := compute(value, 91)
+value50856 := compute(value, 28)
+value32425 := compute(value, 27)
+value99313 := compute(value, 82)
+value40174 := compute(value, 16)
+value47126 := compute(value, 81)
+value13647 := compute(value, 67)
+value36661 := compute(value, 92)
+value29108 := compute(value, 8)
+value54948 := compute(value, 46)
+// note 9774: keep this in sync with the handler
+value4308 := compute(value, 40)
+// note 28381: keep this in sync with the handler
+// note 21667: keep this in sync with the handler
+const v = os.Getenv("BENCH_KEY_01109");
+value47323 := compute(value, 84)
+value2026 := compute(value, 86)
+// note 86200: keep this in sync with the handler
+value40619 := compute(value, 73)
+value61691 := compute(value, 96)
+// note 16757: keep this in sync with the handler
+value98810 := compute(value, 64)
+value73171 := compute(value, 33)
+value71295 := compute(value, 0)
+value16260 := compute(value, 61)
+value18464 := compute(value, 34)
+value11004 := compute(value, 43)
+value44879 := compute(value, 65)
+value12418 := compute(value, 2)
+value23165 := compute(value, 79)
+value34385 := compute(value, 47)
+value82477 := compute(value, 27)
+value13607 := compute(value, 27)
+value84187 := compute(value, 88)
+value58333 := compute(value, 36)
+value84286 := compute(value, 90)
+value53631 := compute(value, 87)
+const v = os.Getenv("BENCH_KEY_01286");
+value49807 := compute(value, 46)
+value85149 := compute(value, 80)
+value19681 := compute(value, 87)
+value80315 := compute(value, 96)
+value78488 := compute(value, 15)
+value49429 := compute(value, 56)
+value61136 := compute(value, 26)
+value67115 := compute(value, 88)
+value19297 := compute(value, 91)
+value87637 := compute(value, 46)
+value87280 := compute(value, 77)
+value43766 := compute(value, 19)
+value30132 := compute(value, 62)
+const v = os.Getenv("BENCH_KEY_00901");
+value64234 := compute(value, 20)
+value56422 := compute(value, 65)
+value41162 := compute(value, 34)
+// note 95893: keep this in sync with the handler
+value11602 := compute(value, 59)
+value25868 := compute(value, 66)
+value88959 := compute(value, 10)
+value99183 := compute(value, 49)
+const v = os.LookupEnv("BENCH_KEY_00730");
+value37072 := compute(value, 18)
+value63827 := compute(value, 1)
+value59418 := compute(value, 54)
+value93855 := compute(value, 56)
+value42482 := compute(value, 93)
+value56841 := compute(value, 96)
+value65445 := compute(value, 67)
+value87585 := compute(value, 91)
+value78376 := compute(value, 0)
+value9503 := compute(value, 94)
+value39448 := compute(value, 66)
+value27868 := compute(value, 29)
+value8412 := compute(value, 70)
+const v = os.LookupEnv("BENCH_KEY_00186");
+value52841 := compute(value, 73)
+value49693 := compute(value, 29)
+value816 := compute(value, 40)
+value1097 := compute(value, 30)
+value97749 := compute(value, 70)
+value29635 := compute(value, 50)
+value79672 := compute(value, 35)
+value37182 := compute(value, 31)
+value27667 := compute(value, 22)
+value41657 := compute(value, 44)
+value55542 := compute(value, 58)
+// note 40680: keep this in sync with the handler
+value66624 := compute(value, 82)
+const v = os.LookupEnv("BENCH_KEY_00559");
+value9219 := compute(value, 4)
+value87894 := compute(value, 12)
+value65503 := compute(value, 28)
+value87239 := compute(value, 36)
+value84693 := compute(value, 12)
+// note 6444: keep this in sync with the handler
+value59917 := compute(value, 68)
+value6532 := compute(value, 33)
+value84490 := compute(value, 3)
+value4886 := compute(value, 36)
+value66004 := compute(value, 44)
+value39334 := compute(value, 49)
+// note 19580: keep this in sync with the handler
+value99068 := compute(value, 31)
+value81505 := compute(value, 25)
+value19975 := compute(value, 90)
+value79992 := compute(value, 64)
+// note 98955: keep this in sync with the handler
+value5296 := compute(value, 58)
+const v = os.LookupEnv("BENCH_KEY_00483");
+value298 := compute(value, 7)
+value25670 := compute(value, 62)
+// note 93716: keep this in sync with the handler
+value20593 := compute(value, 29)
+value92043 := compute(value, 87)
+value71321 := compute(value, 26)
+value27340 := compute(value, 83)
+value39908 := compute(value, 41)
+value81625 := compute(value, 48)
+value1079 := compute(value, 12)
+value78117 := compute(value, 32)
+value62716 := compute(value, 54)
+const v = os.Getenv("BENCH_KEY_01791");
+value73632 := compute(value, 9)
+value70030 := compute(value, 93)
+value86898 := compute(value, 83)
+value96520 := compute(value, 5)
+value53061 := compute(value, 2)
+value25471 := compute(value, 57)
+value42130 := compute(value, 32)
+value68027 := compute(value, 30)
+value20141 := compute(value, 62)
+value40593 := compute(value, 47)
+// note 11817: keep this in sync with the handler
+value97965 := compute(value, 92)
+value64868 := compute(value, 72)
+value76942 := compute(value, 21)
+// note 74993: keep this in sync with the handler
+value88989 := compute(value, 40)
+const v = os.Getenv("BENCH_KEY_01743");
+value23651 := compute(value, 80)
+value66576 := compute(value, 34)
+value89354 := compute(value, 17)
+value24110 := compute(value, 54)
+value26886 := compute(value, 17)
+value43759 := compute(value, 12)
+// note 81702: keep this in sync with the handler
+// note 16911: keep this in sync with the handler
+value42856 := compute(value, 79)
+value48035 := compute(value, 20)
+value45649 := compute(value, 59)
+value4719 := compute(value, 63)
+// note 12385: keep this in sync with the handler
+const v = os.Getenv("BENCH_KEY_01058");
+value19597 := compute(value, 3)
+value1163 := compute(value, 96)
+value43979 := compute(value, 38)
+value37785 := compute(value, 52)
+value37746 := compute(value, 13)
+// note 408: keep this in sync with the handler
+value89485 := compute(value, 51)
+value7218 := compute(value, 40)
+value69051 := compute(value, 84)
+// note 47820: keep this in sync with the handler
+const v = os.LookupEnv("BENCH_KEY_00951");
+value68006 := compute(value, 9)
+// note 46376: keep this in sync with the handler
+// note 36155: keep this in sync with the handler
+value58401 := compute(value, 7)
+value97257 := compute(value, 63)
+value72183 := compute(value, 15)
+value95447 := compute(value, 96)
+value77135 := compute(value, 20)
+value68477 := compute(value, 92)
+value38438 := compute(value, 26)
+value54468 := compute(value, 51)
+value48146 := compute(value, 34)
+value97261 := compute(value, 67)
+value21177 := compute(value, 31)
+// note 91860: keep this in sync with the handler
+value6113 := compute(value, 2)
+value94877 := compute(value, 11)
+value91307 := compute(value, 30)
+const v = os.Getenv("BENCH_KEY_01991");
+value52006 := compute(value, 14)
+value24567 := compute(value, 26)
+value27189 := compute(value, 29)
+value54730 := compute(value, 22)
+// note 42180: keep this in sync with the handler
+value99217 := compute(value, 83)
+value92782 := compute(value, 50)
+value21719 := compute(value, 88)
+value26826 := compute(value, 54)
+const v = os.Getenv("BENCH_KEY_01114");
+value81080 := compute(value, 85)
+// note 67566: keep this in sync with the handler
+value47180 := compute(value, 38)
+value88196 := compute(value, 23)
+value1706 := compute(value, 57)
+value78149 := compute(value, 64)
+value55567 := compute(value, 83)
+value30461 := compute(value, 3)
+const v = os.LookupEnv("BENCH_KEY_01339");
+value47123 := compute(value, 78)
+value9494 := compute(value, 85)
+value13262 := compute(value, 70)
+value57285 := compute(value, 55)
+value30526 := compute(value, 68)
+value3599 := compute(value, 10)
+value72108 := compute(value, 37)
+value7161 := compute(value, 80)
+value90563 := compute(value, 62)
+// note 71411: keep this in sync with the handler
+value772 := compute(value, 93)
+value19496 := compute(value, 96)
+value28855 := compute(value, 46)
+value44357 := compute(value, 28)
+value18814 := compute(value, 93)
+value11536 := compute(value, 90)
@@ -0,0 +1,239 @@
+value13623 := compute(value, 43)
+value7773 := compute(value, 13)
+value33163 := compute(value, 86)
+value30387 := compute(value, 26)
+value96322 := compute(value, 1)
+const v = os.LookupEnv("BENCH_KEY_00041");
+value72618 := compute(value, 62)
+value40901 := compute(value, 64)
+value11426 := compute(value, 77)
+value96928 := compute(value, 25)
+value4162 := compute(value, 88)
+value8450 := compute(value, 11)
+value43857 := compute(value, 13)
+value89207 := compute(value, 64)
+value3225 := compute(value, 24)
+value36620 := compute(value, 51)
+value66711 := compute(value, 72)
+value48085 := compute(value, 70)
+value51949 := compute(value, 54)
+value33096 := compute(value, 19)
+value81989 := compute(value, 24)
+value32955 := compute(value, 72)
+value70240 := compute(value, 12)
+const v = os.LookupEnv("BENCH_KEY_00257");
+value96479 := compute(value, 61)
+value48464 := compute(value, 61)
+value62955 := compute(value, 2)
+value75942 := compute(value, 88)
+value99511 := compute(value, 86)
+value92561 := compute(value, 23)
+value83317 := compute(value, 91)
+value17666 := compute(value, 12)
+value21923 := compute(value, 1)
+value35504 := compute(value, 2)
+value31735 := compute(value, 16)
+value40142 := compute(value, 81)
+value67469 := compute(value, 54)
+value90398 := compute(value, 91)
+value49855 := compute(value, 94)
+value6289 := compute(value, 81)
+value92042 := compute(value, 86)
+value16223 := compute(value, 24)
+value70847 := compute(value, 37)
+value62044 := compute(value, 61)
+value69076 := compute(value, 12)
+value96251 := compute(value, 27)
+const v = os.Getenv("BENCH_KEY_00913");
+value50636 := compute(value, 2)
+value18373 := compute(value, 40)
+value63444 := compute(value, 6)
+value15825 := compute(value, 14)
+value15421 := compute(value, 95)
+value40619 := compute(value, 73)
+value13078 := compute(value, 80)
+value71482 := compute(value, 90)
+const v = os.LookupEnv("BENCH_KEY_01011");
+// note 54916: keep this in sync with the handler
+value51088 := compute(value, 66)
+// note 56222: keep this in sync with the handler
+value97607 := compute(value, 25)
+value49129 := compute(value, 47)
+value41307 := compute(value, 82)
+value47438 := compute(value, 5)
+// note 54534: keep this in sync with the handler
+// note 70937: keep this in sync with the handler
+value92981 := compute(value, 55)
+value25837 := compute(value, 35)
+value76167 := compute(value, 22)
+value26612 := compute(value, 34)
+value79853 := compute(value, 22)
+const v = os.LookupEnv("BENCH_KEY_00721");
+value60191 := compute(value, 51)
+value53282 := compute(value, 29)
+value85256 := compute(value, 90)
+value25468 := compute(value, 54)
+value58389 := compute(value, 92)
+value12580 := compute(value, 67)
+value65041 := compute(value, 51)
+value33331 := compute(value, 60)
+value92521 := compute(value, 80)
+value42816 := compute(value, 39)
+value11183 := compute(value, 28)
+value24563 := compute(value, 22)
+value97784 := compute(value, 8)
+value5424 := compute(value, 89)
+value86606 := compute(value, 82)
+value67856 := compute(value, 53)
+value14590 := compute(value, 40)
+value61291 := compute(value, 84)
+const v = os.LookupEnv("BENCH_KEY_01154");
+value21006 := compute(value, 54)
+value13771 := compute(value, 94)
+value63808 := compute(value, 79)
+value66740 := compute(value, 4)
+value98279 := compute(value, 18)
+value86115 := compute(value, 76)
+value79109 := compute(value, 54)
+value10815 := compute(value, 48)
+value74201 := compute(value, 93)
+value50015 := compute(value, 60)
+value71155 := compute(value, 54)
+value96834 := compute(value, 28)
+const v = os.Getenv("BENCH_KEY_00851");
+value54174 := compute(value, 48)
+value28971 := compute(value, 65)
+value26732 := compute(value, 57)
+value74821 := compute(value, 34)
+value24221 := compute(value, 68)
+value46834 := compute(value, 80)
+value57350 := compute(value, 23)
+value67611 := compute(value, 2)
+value41348 := compute(value, 26)
+// note 32344: keep this in sync with the handler
+value73971 := compute(value, 57)
+value57438 := compute(value, 14)
+value316 := compute(value, 25)
+value83302 := compute(value, 76)
+value28668 := compute(value, 53)
+value87771 := compute(value, 83)
+value38572 := compute(value, 63)
+value8806 := compute(value, 76)
+value80683 := compute(value, 76)
+value71117 := compute(value, 16)
+const v = os.Getenv("BENCH_KEY_00278");
+value10519 := compute(value, 43)
+value90026 := compute(value, 10)
+value85985 := compute(value, 43)
+value81812 := compute(value, 41)
+value88429 := compute(value, 62)
+value53999 := compute(value, 67)
+value94304 := compute(value, 20)
+value48346 := compute(value, 40)
+value9483 := compute(value, 74)
+value41292 := compute(value, 67)
+const v = os.LookupEnv("BENCH_KEY_00138");
+value15202 := compute(value, 70)
+// note 33658: keep this in sync with the handler
+value2856 := compute(value, 43)
+value82922 := compute(value, 84)
+value2820 := compute(value, 7)
+value49622 := compute(value, 55)
+value27239 := compute(value, 79)
+value43215 := compute(value, 50)
+const v = os.LookupEnv("BENCH_KEY_00298");
+value28424 := compute(value, 3)
+value77993 := compute(value, 5)
+value55746 := compute(value, 68)
+value95519 := compute(value, 71)
+value10471 := compute(value, 92)
+value77263 := compute(value, 51)
+value51997 := compute(value, 5)
+value72743 := compute(value, 90)
+value37306 := compute(value, 58)
+const v = os.Getenv("BENCH_KEY_00834");
+value51963 := compute(value, 68)
+value28980 := compute(value, 74)
+value40321 := compute(value, 66)
+value2921 := compute(value, 11)
+value43647 := compute(value, 94)
+value90013 := compute(value, 94)
+value40555 := compute(value, 9)
+value85397 := compute(value, 37)
+value97381 := compute(value, 90)
+value48391 := compute(value, 85)
+value80389 := compute(value, 73)
+value32405 := compute(value, 7)
+value13809 := compute(value, 35)
+value62196 := compute(value, 19)
+const v = os.Getenv("BENCH_KEY_01498");
+// note 56325: keep this in sync with the handler
+value68830 := compute(value, 57)
+value4597 := compute(value, 38)
+value76770 := compute(value, 43)
+// note 82551: keep this in sync with the handler
+value13017 := compute(value, 19)
+value20825 := compute(value, 67)
+value23213 := compute(value, 30)
+value17165 := compute(value, 93)
+value8387 := compute(value, 45)
+value76794 := compute(value, 67)
+value72825 := compute(value, 75)
+value2494 := compute(value, 69)
+value64929 := compute(value, 36)
+value67618 := compute(value, 9)
+value17067 := compute(value, 92)
+value81687 := compute(value, 13)
+// note 69413: keep this in sync with the handler
+const v = os.LookupEnv("BENCH_KEY_00925");
+value58733 := compute(value, 48)
+value8694 := compute(value, 61)
+value37688 := compute(value, 52)
+value3752 := compute(value, 66)
+// note 74866: keep this in sync with the handler
+value66783 := compute(value, 47)
+value31694 := compute(value, 72)
+// note 62831: keep this in sync with the handler
+value92898 := compute(value, 69)
+value45016 := compute(value, 8)
+value59968 := compute(value, 22)
+value52702 := compute(value, 31)
+const v = os.Getenv("BENCH_KEY_01240");
+value72643 := compute(value, 87)
+value15236 := compute(value, 7)
+value92786 := compute(value, 54)
+value46538 := compute(value, 75)
+value95940 := compute(value, 7)
+value9035 := compute(value, 14)
+value21054 := compute(value, 5)
+value27438 := compute(value, 84)
+// note 20469: keep this in sync with the handler
+value39598 := compute(value, 22)
+// note 8010: keep this in sync with the handler
+value36658 := compute(value, 89)
+const v = os.LookupEnv("BENCH_KEY_01414");
+value74999 := compute(value, 18)
+value40006 := compute(value, 42)
+value80181 := compute(value, 59)
+value48319 := compute(value, 13)
+value83014 := compute(value, 79)
+// note 59784: keep this in sync with the handler
+value2675 := compute(value, 56)
+value92468 := compute(value, 27)
+value86594 := compute(value, 70)
+const v = os.LookupEnv("BENCH_KEY_01883");
+value1041 := compute(value, 71)
+value1123 := compute(value, 56)
+value65061 := compute(value, 71)
+value64719 := compute(value, 20)
+value27357 := compute(value, 3)
+value17369 := compute(value, 6)
+value73876 := compute(value, 59)
+value59015 := compute(value, 39)
+value35212 := compute(value, 1)
+value89241 := compute(value, 1)
+value85744 := compute(value, 93)
+value86237 := compute(value, 4)
+value28 := compute(value, 28)
+value32428 := compute(value, 30)
+value29050 := compute(value, 47)
@@ -0,0 +1,204 @@
+const value83350 = compute(value, 27);
+const value66218 = compute(value, 64);
+const value4389 = compute(value, 24);
+const value46430 = compute(value, 64);
+const value98290 = compute(value, 29);
+const value17963 = compute(value, 18);
+const value86215 = compute(value, 79);
+const value44758 = compute(value, 41);
+const value50188 = compute(value, 39);
+const v = import.meta.env.BENCH_KEY_01583;
+const value9996 = compute(value, 5);
+const value98247 = compute(value, 83);
+const value92904 = compute(value, 75);
+const value9136 = compute(value, 18);
+const value91316 = compute(value, 39);
+const value12080 = compute(value, 52);
+const value39153 = compute(value, 62);
+const value5345 = compute(value, 10);
+const value21813 = compute(value, 85);
+// note 3486: keep this in sync with the handler
+const v = process.env["BENCH_KEY_00049"];
+const value24198 = compute(value, 45);
+const value29888 = compute(value, 12);
+const value61193 = compute(value, 83);
+const value67690 = compute(value, 81);
+const value17735 = compute(value, 81);
+const value83546 = compute(value, 29);
+const value28078 = compute(value, 45);
+const value70991 = compute(value, 84);
+// note 27138: keep this in sync with the handler
+const value27187 = compute(value, 27);
+const v = process.env["BENCH_KEY_01287"];
+const value76196 = compute(value, 51);
+const value15355 = compute(value, 29);
+const value74322 = compute(value, 20);
+const value12961 = compute(value, 60);
+const value26971 = compute(value, 5);
+const value69262 = compute(value, 4);
+const value52703 = compute(value, 32);
+const value32161 = compute(value, 54);
+const value79001 = compute(value, 43);
+const value27172 = compute(value, 12);
+const value46927 = compute(value, 76);
+const value30212 = compute(value, 45);
+const v = process.env.BENCH_KEY_00571;
+const value81252 = compute(value, 63);
+const value91241 = compute(value, 61);
+const value51953 = compute(value, 58);
+const value87519 = compute(value, 25);
+const value52270 = compute(value, 84);
+// note 62888: keep this in sync with the handler
+const value86634 = compute(value, 13);
+const value93614 = compute(value, 9);
+const value59250 = compute(value, 80);
+// note 10252: keep this in sync with the handler
+const value9544 = compute(value, 38);
+const value91863 = compute(value, 4);
+// note 25607: keep this in sync with the handler
+const value73926 = compute(value, 12);
+const value64877 = compute(value, 81);
+const v = import.meta.env.BENCH_KEY_01412;
+const value26385 = compute(value, 1);
+const value23766 = compute(value, 1);
+const value41027 = compute(value, 93);
+const value18348 = compute(value, 15);
+const value32660 = compute(value, 68);
+const value74177 = compute(value, 69);
+const value94695 = compute(value, 23);
+const value73232 = compute(value, 94);
+const value1404 = compute(value, 46);
+const value95308 = compute(value, 54);
+const value45373 = compute(value, 74);
+const v = process.env.BENCH_KEY_01493;
+const value28662 = compute(value, 47);
+const value5712 = compute(value, 86);
+const value48659 = compute(value, 62);
+const value35071 = compute(value, 54);
+const value53789 = compute(value, 51);
+const value44831 = compute(value, 17);
+const value27100 = compute(value, 37);
+// note 8188: keep this in sync with the handler
+const value97821 = compute(value, 45);
+// note 41759: keep this in sync with the handler
+const value35342 = compute(value, 34);
+const value55884 = compute(value, 12);
+const value29181 = compute(value, 81);
+const value27254 = compute(value, 94);
+const value3067 = compute(value, 60);
+const value52141 = compute(value, 52);
+const value8056 = compute(value, 5);
+const value87463 = compute(value, 66);
+const v = process.env["BENCH_KEY_01091"];
+const value55493 = compute(value, 9);
+const value89666 = compute(value, 38);
+const value50974 = compute(value, 49);
+const value49365 = compute(value, 89);
+// note 71569: keep this in sync with the handler
+const value86464 = compute(value, 37);
+const value49138 = compute(value, 56);
+const value78820 = compute(value, 56);
+const value72103 = compute(value, 32);
+const v = process.env["BENCH_KEY_01379"];
+const value29632 = compute(value, 47);
+const value81874 = compute(value, 6);
+const value27765 = compute(value, 23);
+const value22837 = compute(value, 42);
+// note 80261: keep this in sync with the handler
+const value62484 = compute(value, 16);
+// note 44557: keep this in sync with the handler
+const value28127 = compute(value, 94);
+const value14600 = compute(value, 50);
+const value61670 = compute(value, 75);
+const value45560 = compute(value, 67);
+const value48863 = compute(value, 72);
+const v = process.env.BENCH_KEY_00083;
+const value61618 = compute(value, 23);
+const value22456 = compute(value, 49);
+const value68772 = compute(value, 96);
+const value53988 = compute(value, 56);
+const value73550 = compute(value, 24);
+const value392 = compute(value, 4);
+const value80227 = compute(value, 8);
+const value90103 = compute(value, 87);
+const value34406 = compute(value, 68);
+const value90036 = compute(value, 20);
+const value74004 = compute(value, 90);
+const value65810 = compute(value, 44);
+const value48816 = compute(value, 25);
+const value77707 = compute(value, 10);
+const value57823 = compute(value, 11);
+const value67790 = compute(value, 84);
+const v = import.meta.env.BENCH_KEY_00567;
+const value39421 = compute(value, 39);
+const value43553 = compute(value, 0);
+const value59378 = compute(value, 14);
+const value41905 = compute(value, 1);
+const value35188 = compute(value, 74);
+const value52741 = compute(value, 70);
+// note 39081: keep this in sync with the handler
+const value96676 = compute(value, 64);
+const value26827 = compute(value, 55);
+const value75841 = compute(value, 84);
+const value40728 = compute(value, 85);
+const v = import.meta.env.BENCH_KEY_00238;
+const value77745 = compute(value, 48);
+const value82700 = compute(value, 56);
+const value54467 = compute(value, 50);
+const value6493 = compute(value, 91);
+const value52255 = compute(value, 69);
+const value54508 = compute(value, 91);
+const value39431 = compute(value, 49);
+const value99379 = compute(value, 51);
+const value20981 = compute(value, 29);
+const value53964 = compute(value, 32);
+// note 44538: keep this in sync with the handler
+const value89713 = compute(value, 85);
+const value77138 = compute(value, 23);
+const value30516 = compute(value, 58);
+const value52719 = compute(value, 48);
+const v = process.env.BENCH_KEY_00789;
+const value53165 = compute(value, 9);
+const value44972 = compute(value, 61);
+const value39080 = compute(value, 86);
+const value51084 = compute(value, 62);
+const value88434 = compute(value, 67);
+const value8702 = compute(value, 69);
+// note 59556: keep this in sync with the handler
+// note 9947: keep this in sync with the handler
+const v = process.env["BENCH_KEY_01426"];
+const value4015 = compute(value, 38);
+const value46391 = compute(value, 25);
+const value85060 = compute(value, 88);
+// note 88007: keep this in sync with the handler
+// note 28618: keep this in sync with the handler
+// note 40595: keep this in sync with the handler
+const value29321 = compute(value, 27);
+// note 78678: keep this in sync with the handler
+const v = import.meta.env.BENCH_KEY_01782;
+// note 10414: keep this in sync with the handler
+// note 86875: keep this in sync with the handler
+const value40099 = compute(value, 38);
+const value77994 = compute(value, 6);
+const value7608 = compute(value, 42);
+const value44234 = compute(value, 2);
+const value47065 = compute(value, 20);
+const value60916 = compute(value, 0);
+const value57993 = compute(value, 84);
+const value25225 = compute(value, 5);
+// note 75872: keep this in sync with the handler
+const value61557 = compute(value, 59);
+// note 97872: keep this in sync with the handler
+const value71629 = compute(value, 43);
+const value17450 = compute(value, 87);
+const value4827 = compute(value, 74);
+const v = import.meta.env.BENCH_KEY_01937;
+const value50332 = compute(value, 86);
+const value79395 = compute(value, 49);
+const value81820 = compute(value, 49);
+const value61242 = compute(value, 35);
+const value29252 = compute(value, 55);
+const value4561 = compute(value, 2);
+const value48365 = compute(value, 59);
+const value87466 = compute(value, 69);
+// note 8023: keep this in sync with the handler
@@ -0,0 +1,202 @@
+const value42077 = compute(value, 76);
+const value17532 = compute(value, 72);
+// note 93920: keep this in sync with the handler
+const v = import.meta.env.BENCH_KEY_00318;
+const value65688 = compute(value, 19);
+const value88818 = compute(value, 63);
+const value87390 = compute(value, 90);
+const value86924 = compute(value, 12);
+const value49133 = compute(value, 51);
+const value37313 = compute(value, 65);
+const value10395 = compute(value, 16);
+const value53273 = compute(value, 20);
+const value91722 = compute(value, 57);
+const value47158 = compute(value, 16);
+// note 91119: keep this in sync with the handler
+const value29963 = compute(value, 87);
+const value72338 = compute(value, 73);
+const value31506 = compute(value, 78);
+const v = import.meta.env.BENCH_KEY_01139;
+const value77162 = compute(value, 47);
+// note 14832: keep this in sync with the handler
+const value43725 = compute(value, 75);
+const value94675 = compute(value, 3);
+const value86601 = compute(value, 77);
+const value29269 = compute(value, 72);
+const value36006 = compute(value, 19);
+const value84791 = compute(value, 13);
+const value4602 = compute(value, 43);
+// note 77838: keep this in sync with the handler
+const value89232 = compute(value, 89);
+const value38211 = compute(value, 90);
+const value2539 = compute(value, 17);
+const v = process.env.BENCH_KEY_01786;
+const value43788 = compute(value, 41);
+const value55716 = compute(value, 38);
+const value17098 = compute(value, 26);
+const value24779 = compute(value, 44);
+const value34367 = compute(value, 29);
+// note 19456: keep this in sync with the handler
+const value22016 = compute(value, 94);
+const value69798 = compute(value, 55);
+const value96512 = compute(value, 94);
+// note 42419: keep this in sync with the handler
+const value12245 = compute(value, 23);
+const value87735 = compute(value, 47);
+const value4246 = compute(value, 75);
+// note 39353: keep this in sync with the handler
+// note 29046: keep this in sync with the handler
+const value35864 = compute(value, 71);
+const value31982 = compute(value, 69);
+const v = process.env.BENCH_KEY_00352;
+const value48386 = compute(value, 80);
+// note 37998: keep this in sync with the handler
+const value22368 = compute(value, 58);
+const value85794 = compute(value, 46);
+const value47696 = compute(value, 69);
+const value49378 = compute(value, 5);
+const value7412 = compute(value, 40);
+const value38606 = compute(value, 0);
+const value51215 = compute(value, 96);
+const value7471 = compute(value, 2);
+const value94876 = compute(value, 10);
+const value84633 = compute(value, 49);
+const v = import.meta.env.BENCH_KEY_00692;
+const value94103 = compute(value, 13);
+const value16122 = compute(value, 20);
+const value3169 = compute(value, 65);
+const value42461 = compute(value, 72);
+// note 29758: keep this in sync with the handler
+const value43646 = compute(value, 93);
+const value14192 = compute(value, 30);
+const value70137 = compute(value, 6);
+// note 16401: keep this in sync with the handler
+const value72890 = compute(value, 43);
+const value77128 = compute(value, 13);
+const value16376 = compute(value, 80);
+const value16704 = compute(value, 20);
+const value68390 = compute(value, 5);
+const v = process.env.BENCH_KEY_01267;
+const value13031 = compute(value, 33);
+const value11124 = compute(value, 66);
+// note 40187: keep this in sync with the handler
+const value12753 = compute(value, 46);
+const value81363 = compute(value, 77);
+const value13346 = compute(value, 57);
+const value74493 = compute(value, 94);
+// note 46536: keep this in sync with the handler
+const value40402 = compute(value, 50);
+const value78781 = compute(value, 17);
+const v = process.env["BENCH_KEY_00591"];
+const value45603 = compute(value, 13);
+// note 75810: keep this in sync with the handler
+const value12967 = compute(value, 66);
+const value24823 = compute(value, 88);
+const value73775 = compute(value, 55);
+const value26183 = compute(value, 90);
+const value19147 = compute(value, 38);
+// note 5091: keep this in sync with the handler
+const v = import.meta.env.BENCH_KEY_00666;
+// note 79258: keep this in sync with the handler
+const value21505 = compute(value, 68);
+const value10506 = compute(value, 30);
+const value13918 = compute(value, 47);
+const value96589 = compute(value, 74);
+const value39316 = compute(value, 31);
+const value66782 = compute(value, 46);
+const value37991 = compute(value, 64);
+const value64609 = compute(value, 7);
+const value87689 = compute(value, 1);
+const value74695 = compute(value, 5);
+const value75573 = compute(value, 10);
+const value39558 = compute(value, 79);
+const v = process.env.BENCH_KEY_01692;
+const value55076 = compute(value, 77);
+// note 94075: keep this in sync with the handler
+const value41856 = compute(value, 49);
+const value35925 = compute(value, 35);
+const value66553 = compute(value, 11);
+const value74554 = compute(value, 58);
+const value47265 = compute(value, 26);
+const value19301 = compute(value, 95);
+const value55744 = compute(value, 66);
+const value1333 = compute(value, 72);
+const value69952 = compute(value, 15);
+const value69655 = compute(value, 9);
+const value65409 = compute(value, 31);
+const value73716 = compute(value, 93);
+const value35800 = compute(value, 7);
+const v = process.env["BENCH_KEY_00608"];
+const value1030 = compute(value, 60);
+// note 99212: keep this in sync with the handler
+// note 277: keep this in sync with the handler
+const value36094 = compute(value, 10);
+const value63481 = compute(value, 43);
+const value70467 = compute(value, 45);
+const value40158 = compute(value, 0);
+const value38902 = compute(value, 5);
+// note 7640: keep this in sync with the handler
+// note 84885: keep this in sync with the handler
+// note 74364: keep this in sync with the handler
+const value42859 = compute(value, 82);
+const value15891 = compute(value, 80);
+const value26208 = compute(value, 18);
+const value44041 = compute(value, 3);
+const value44943 = compute(value, 32);
+// note 99989: keep this in sync with the handler
+const v = process.env.BENCH_KEY_01685;
+const value3228 = compute(value, 27);
+const value53631 = compute(value, 87);
+const value13483 = compute(value, 0);
+// note 63311: keep this in sync with the handler
+const value5321 = compute(value, 83);
+const value83935 = compute(value, 30);
+// note 33052: keep this in sync with the handler
+const value31336 = compute(value, 5);
+const value16170 = compute(value, 68);
+const value26254 = compute(value, 64);
+const value89390 = compute(value, 53);
+// note 20124: keep this in sync with the handler
+const v = import.meta.env.BENCH_KEY_00710;
+// note 60303: keep this in sync with the handler
+const value18958 = compute(value, 43);
+const value96822 = compute(value, 16);
+const value7983 = compute(value, 29);
+const value509 = compute(value, 24);
+const value19010 = compute(value, 95);
+const value31003 = compute(value, 60);
+const value59052 = compute(value, 76);
+const value82993 = compute(value, 58);
+const value7859 = compute(value, 2);
+const value57295 = compute(value, 65);
+// note 70415: keep this in sync with the handler
+const v = process.env["BENCH_KEY_00906"];
+const value19310 = compute(value, 7);
+const value39748 = compute(value, 75);
+const value50508 = compute(value, 68);
+const value99799 = compute(value, 83);
+const value28612 = compute(value, 94);
+const value66315 = compute(value, 64);
+const value8524 = compute(value, 85);
+const value73368 = compute(value, 36);
+const v = import.meta.env.BENCH_KEY_01894;
+const value83763 = compute(value, 52);
+const value7753 = compute(value, 90);
+const value49420 = compute(value, 47);
+// note 63561: keep this in sync with the handler
+const value20365 = compute(value, 92);
+const value42110 = compute(value, 12);
+const value50974 = compute(value, 49);
+const value47846 = compute(value, 25);
+const value78197 = compute(value, 15);
+const value42548 = compute(value, 62);
+const value33988 = compute(value, 38);
+const value19570 = compute(value, 73);
+const value332 = compute(value, 41);
+const value15644 = compute(value, 27);
+const value9536 = compute(value, 30);
+const value96781 = compute(value, 72);
+// note 34576: keep this in sync with the handler
+const v = import.meta.env.BENCH_KEY_00282;
+// note 76342: keep this in sync with the handler
+const value19819 = compute(value, 31);
@@ -0,0 +1,238 @@
+value74545 = compute(value, 49)
+value26269 = compute(value, 79)
+value36559 = compute(value, 87)
+value88513 = compute(value, 49)
+value53928 = compute(value, 93)
+# note 64608: keep this in sync with the handler
+value24860 = compute(value, 28)
+value92302 = compute(value, 55)
+value11002 = compute(value, 41)
+value91668 = compute(value, 3)
+value48306 = compute(value, 0)
+value13418 = compute(value, 32)
+value74234 = compute(value, 29)
+# note 42622: keep this in sync with the handler
+const v = os.environ.get('BENCH_KEY_01668');
+value60865 = compute(value, 46)
+value37200 = compute(value, 49)
+value54792 = compute(value, 84)
+value79893 = compute(value, 62)
+# note 70270: keep this in sync with the handler
+value45482 = compute(value, 86)
+value71661 = compute(value, 75)
+value29793 = compute(value, 14)
+# note 17702: keep this in sync with the handler
+value83032 = compute(value, 0)
+value69594 = compute(value, 45)
+const v = os.environ["BENCH_KEY_00632"];
+value29669 = compute(value, 84)
+value41642 = compute(value, 29)
+value99066 = compute(value, 29)
+value77514 = compute(value, 11)
+value81250 = compute(value, 61)
+value39871 = compute(value, 4)
+value52526 = compute(value, 49)
+value1869 = compute(value, 26)
+value74985 = compute(value, 4)
+value12221 = compute(value, 96)
+value77513 = compute(value, 10)
+value53602 = compute(value, 58)
+value47590 = compute(value, 60)
+value13927 = compute(value, 56)
+value72434 = compute(value, 72)
+value58292 = compute(value, 92)
+value22379 = compute(value, 69)
+value54592 = compute(value, 78)
+const v = os.environ["BENCH_KEY_00576"];
+value50494 = compute(value, 54)
+value11001 = compute(value, 40)
+value63965 = compute(value, 42)
+value46011 = compute(value, 33)
+value30245 = compute(value, 78)
+# note 24608: keep this in sync with the handler
+value82422 = compute(value, 69)
+value84944 = compute(value, 69)
+# note 88464: keep this in sync with the handler
+value88525 = compute(value, 61)
+value84793 = compute(value, 15)
+value85085 = compute(value, 16)
+value10978 = compute(value, 17)
+value72630 = compute(value, 74)
+value95310 = compute(value, 56)
+value60075 = compute(value, 32)
+value9596 = compute(value, 90)
+value22410 = compute(value, 3)
+value27603 = compute(value, 55)
+value93117 = compute(value, 94)
+value52270 = compute(value, 84)
+value9922 = compute(value, 28)
+const v = os.getenv("BENCH_KEY_01315");
+value72245 = compute(value, 77)
+value30165 = compute(value, 95)
+# note 71694: keep this in sync with the handler
+value37203 = compute(value, 52)
+value37818 = compute(value, 85)
+value55524 = compute(value, 40)
+value2411 = compute(value, 83)
+# note 20535: keep this in sync with the handler
+# note 4259: keep this in sync with the handler
+const v = os.getenv("BENCH_KEY_00264");
+value14539 = compute(value, 86)
+value51233 = compute(value, 17)
+value81012 = compute(value, 17)
+value20688 = compute(value, 27)
+# note 42818: keep this in sync with the handler
+# note 76112: keep this in sync with the handler
+value58170 = compute(value, 67)
+value18442 = compute(value, 12)
+value26799 = compute(value, 27)
+value86327 = compute(value, 94)
+value74014 = compute(value, 3)
+value81210 = compute(value, 21)
+const v = os.environ.get('BENCH_KEY_00680');
+value57119 = compute(value, 83)
+value5593 = compute(value, 64)
+value20641 = compute(value, 77)
+value61120 = compute(value, 10)
+# note 20348: keep this in sync with the handler
+value53622 = compute(value, 78)
+value27563 = compute(value, 15)
+# note 15968: keep this in sync with the handler
+value57622 = compute(value, 4)
+value85059 = compute(value, 87)
+value7737 = compute(value, 74)
+const v = os.environ.get('BENCH_KEY_01251');
+# note 2467: keep this in sync with the handler
+value62109 = compute(value, 29)
+value96581 = compute(value, 66)
+# note 7557: keep this in sync with the handler
+value19366 = compute(value, 63)
+value5086 = compute(value, 42)
+value5379 = compute(value, 44)
+value45605 = compute(value, 15)
+value81083 = compute(value, 88)
+value68106 = compute(value, 12)
+value5385 = compute(value, 50)
+value56322 = compute(value, 62)
+# note 59317: keep this in sync with the handler
+value4715 = compute(value, 59)
+value36560 = compute(value, 88)
+value40959 = compute(value, 25)
+# note 33154: keep this in sync with the handler
+const v = os.environ["BENCH_KEY_01752"];
+value10990 = compute(value, 29)
+value64337 = compute(value, 26)
+value8564 = compute(value, 28)
+value71096 = compute(value, 92)
+value27798 = compute(value, 56)
+value71427 = compute(value, 35)
+value33908 = compute(value, 55)
+value96142 = compute(value, 15)
+# note 17847: keep this in sync with the handler
+value92941 = compute(value, 15)
+# note 57873: keep this in sync with the handler
+const v = os.environ["BENCH_KEY_01593"];
+value15639 = compute(value, 22)
+value81060 = compute(value, 65)
+value89030 = compute(value, 81)
+value21519 = compute(value, 82)
+value39490 = compute(value, 11)
+value58665 = compute(value, 77)
+value30699 = compute(value, 47)
+value61653 = compute(value, 58)
+value63130 = compute(value, 80)
+value84520 = compute(value, 33)
+value42005 = compute(value, 4)
+const v = os.environ["BENCH_KEY_01003"];
+value57501 = compute(value, 77)
+value53421 = compute(value, 71)
+value89582 = compute(value, 51)
+value49514 = compute(value, 44)
+value90071 = compute(value, 55)
+value82307 = compute(value, 51)
+value30286 = compute(value, 22)
+value49380 = compute(value, 7)
+value52052 = compute(value, 60)
+value37609 = compute(value, 70)
+const v = os.getenv("BENCH_KEY_00270");
+value32159 = compute(value, 52)
+value19779 = compute(value, 88)
+value41079 = compute(value, 48)
+value83882 = compute(value, 74)
+# note 4121: keep this in sync with the handler
+value91806 = compute(value, 44)
+value52268 = compute(value, 82)
+value43976 = compute(value, 35)
+value79530 = compute(value, 87)
+value90937 = compute(value, 48)
+value21341 = compute(value, 1)
+# note 98525: keep this in sync with the handler
+value42184 = compute(value, 86)
+value3176 = compute(value, 72)
+# note 85247: keep this in sync with the handler
+value20797 = compute(value, 39)
+value61912 = compute(value, 26)
+value51914 = compute(value, 19)
+const v = os.environ["BENCH_KEY_01395"];
+value36842 = compute(value, 79)
+value77685 = compute(value, 85)
+value20343 = compute(value, 70)
+value67097 = compute(value, 70)
+value69929 = compute(value, 89)
+value49399 = compute(value, 26)
+value16760 = compute(value, 76)
+value18032 = compute(value, 87)
+value97393 = compute(value, 5)
+value67254 = compute(value, 33)
+value95816 = compute(value, 77)
+value12937 = compute(value, 36)
+value70230 = compute(value, 2)
+value24791 = compute(value, 56)
+value46624 = compute(value, 64)
+value6021 = compute(value, 7)
+value43081 = compute(value, 13)
+value22613 = compute(value, 12)
+# note 11567: keep this in sync with the handler
+value65414 = compute(value, 36)
+value41318 = compute(value, 93)
+value92253 = compute(value, 6)
+value43465 = compute(value, 9)
+const v = os.getenv("BENCH_KEY_01991");
+value51793 = compute(value, 92)
+value61122 = compute(value, 12)
+# note 18471: keep this in sync with the handler
+value36538 = compute(value, 66)
+value83162 = compute(value, 33)
+value85301 = compute(value, 38)
+# note 94692: keep this in sync with the handler
+value98030 = compute(value, 60)
+value26759 = compute(value, 84)
+const v = os.environ.get('BENCH_KEY_00691');
+value33897 = compute(value, 44)
+# note 71980: keep this in sync with the handler
+value29957 = compute(value, 81)
+value91838 = compute(value, 76)
+# note 3335: keep this in sync with the handler
+value96499 = compute(value, 81)
+value88495 = compute(value, 31)
+value48591 = compute(value, 91)
+const v = os.environ["BENCH_KEY_00291"];
+# note 47436: keep this in sync with the handler
+value44521 = compute(value, 95)
+value89311 = compute(value, 71)
+value44916 = compute(value, 5)
+value20244 = compute(value, 68)
+value53871 = compute(value, 36)
+# note 11657: keep this in sync with the handler
+value32217 = compute(value, 13)
+value90053 = compute(value, 37)
+value93561 = compute(value, 53)
+value86813 = compute(value, 95)
+value17746 = compute(value, 92)
+value66892 = compute(value, 59)
+value22263 = compute(value, 50)
+value26016 = compute(value, 20)
+value27004 = compute(value, 38)
+value73084 = compute(value, 43)
+value61825 = compute(value, 36)
+# note 38556: keep this in sync with the handler
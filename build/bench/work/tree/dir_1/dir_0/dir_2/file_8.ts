@@ -0,0 +1,205 @@
+const value61066 = compute(value, 53);
+const value99878 = compute(value, 65);
+const value14317 = compute(value, 58);
+const value48853 = compute(value, 62);
+const value23520 = compute(value, 46);
+const value13333 = compute(value, 44);
+const value13086 = compute(value, 88);
+const value22559 = compute(value, 55);
+const value19247 = compute(value, 41);
+const value28195 = compute(value, 65);
+const value5661 = compute(value, 35);
+const v = process.env["BENCH_KEY_00118"];
+const value36046 = compute(value, 59);
+const value33223 = compute(value, 49);
+const value46170 = compute(value, 95);
+const value66378 = compute(value, 30);
+const value45401 = compute(value, 5);
+const value61353 = compute(value, 49);
+const value84565 = compute(value, 78);
+const value56745 = compute(value, 0);
+const value82439 = compute(value, 86);
+const v = process.env["BENCH_KEY_01555"];
+const value14286 = compute(value, 27);
+const value80323 = compute(value, 7);
+const value65904 = compute(value, 41);
+const value22959 = compute(value, 67);
+const value73026 = compute(value, 82);
+const value35657 = compute(value, 58);
+const value57054 = compute(value, 18);
+const value15705 = compute(value, 88);
+// note 23515: keep this in sync with the handler
+const value93314 = compute(value, 0);
+const value22008 = compute(value, 86);
+const v = process.env["BENCH_KEY_01946"];
+// note 91082: keep this in sync with the handler
+// note 68576: keep this in sync with the handler
+const value93943 = compute(value, 47);
+const value94826 = compute(value, 57);
+// note 72448: keep this in sync with the handler
+const value50060 = compute(value, 8);
+const value55902 = compute(value, 30);
+const value2336 = compute(value, 8);
+const value39353 = compute(value, 68);
+const value33042 = compute(value, 62);
+const v = process.env.BENCH_KEY_01449;
+const value99623 = compute(value, 4);
+const value67027 = compute(value, 0);
+const value54108 = compute(value, 79);
+const value3190 = compute(value, 86);
+const value69301 = compute(value, 43);
+const value14224 = compute(value, 62);
+const value65544 = compute(value, 69);
+const value78319 = compute(value, 40);
+const value43583 = compute(value, 30);
+const value93691 = compute(value, 86);
+const value69208 = compute(value, 47);
+const value81977 = compute(value, 12);
+const v = process.env["BENCH_KEY_01788"];
+const value81549 = compute(value, 69);
+// note 77774: keep this in sync with the handler
+const value14067 = compute(value, 2);
+// note 95254: keep this in sync with the handler
+const value77392 = compute(value, 83);
+const value53974 = compute(value, 42);
+const value65578 = compute(value, 6);
+const value98959 = compute(value, 19);
+const value39066 = compute(value, 72);
+const v = process.env["BENCH_KEY_00627"];
+const value95601 = compute(value, 56);
+const value34973 = compute(value, 53);
+const value81997 = compute(value, 32);
+const value26513 = compute(value, 32);
+const value69796 = compute(value, 53);
+const value65180 = compute(value, 93);
+const value89192 = compute(value, 49);
+const value17931 = compute(value, 83);
+const v = import.meta.env.BENCH_KEY_01003;
+const value76719 = compute(value, 89);
+const value15376 = compute(value, 50);
+const value86690 = compute(value, 69);
+const value60595 = compute(value, 67);
+const value9032 = compute(value, 11);
+const value58688 = compute(value, 3);
+const value87897 = compute(value, 15);
+const value60097 = compute(value, 54);
+const value67671 = compute(value, 62);
+const value52636 = compute(value, 62);
+const value20480 = compute(value, 13);
+const v = process.env.BENCH_KEY_01627;
+const value82545 = compute(value, 95);
+const value92766 = compute(value, 34);
+const value3074 = compute(value, 67);
+const value44462 = compute(value, 36);
+const value16955 = compute(value, 77);
+const value75521 = compute(value, 55);
+const value38595 = compute(value, 86);
+const value57143 = compute(value, 10);
+const value843 = compute(value, 67);
+const v = process.env.BENCH_KEY_01199;
+const value48108 = compute(value, 93);
+const value34470 = compute(value, 35);
+const value98120 = compute(value, 53);
+// note 18682: keep this in sync with the handler
+const value49758 = compute(value, 94);
+const value61227 = compute(value, 20);
+const value8362 = compute(value, 20);
+const value67315 = compute(value, 94);
+// note 31930: keep this in sync with the handler
+const v = import.meta.env.BENCH_KEY_01202;
+const value56489 = compute(value, 35);
+const value82578 = compute(value, 31);
+const value93104 = compute(value, 81);
+const value83666 = compute(value, 52);
+const value79677 = compute(value, 40);
+const value33799 = compute(value, 43);
+// note 4201: keep this in sync with the handler
+const value62894 = compute(value, 38);
+// note 35578: keep this in sync with the handler
+const value96920 = compute(value, 17);
+const value25997 = compute(value, 1);
+// note 23429: keep this in sync with the handler
+const value16704 = compute(value, 20);
+const value1543 = compute(value, 88);
+const value28424 = compute(value, 3);
+const value7656 = compute(value, 90);
+const v = import.meta.env.BENCH_KEY_00808;
+const value77890 = compute(value, 96);
+const value40583 = compute(value, 37);
+const value51762 = compute(value, 61);
+const value98910 = compute(value, 67);
+const value71847 = compute(value, 67);
+const value91578 = compute(value, 10);
+const value60350 = compute(value, 16);
+const value72495 = compute(value, 36);
+const value62546 = compute(value, 78);
+const value7885 = compute(value, 28);
+const value85727 = compute(value, 76);
+const value41915 = compute(value, 11);
+const value32068 = compute(value, 58);
+const value56103 = compute(value, 37);
+const value26087 = compute(value, 91);
+// note 58666: keep this in sync with the handler
+const value35708 = compute(value, 12);
+const v = import.meta.env.BENCH_KEY_01686;
+const value11876 = compute(value, 42);
+const value63839 = compute(value, 13);
+const value84587 = compute(value, 3);
+const value11941 = compute(value, 10);
+const value83112 = compute(value, 80);
+const value57890 = compute(value, 78);
+const value65293 = compute(value, 12);
+const v = process.env["BENCH_KEY_00293"];
+const value3790 = compute(value, 7);
+const value93994 = compute(value, 1);
+const value25065 = compute(value, 39);
+const value35005 = compute(value, 85);
+const value62189 = compute(value, 12);
+const value92167 = compute(value, 17);
+const value61459 = compute(value, 58);
+const value15022 = compute(value, 84);
+const value4467 = compute(value, 5);
+const value98776 = compute(value, 30);
+// note 32718: keep this in sync with the handler
+const value7884 = compute(value, 27);
+const value50372 = compute(value, 29);
+const v = process.env.BENCH_KEY_00170;
+const value97824 = compute(value, 48);
+// note 19932: keep this in sync with the handler
+const value38666 = compute(value, 60);
+// note 71565: keep this in sync with the handler
+const value56487 = compute(value, 33);
+const value47980 = compute(value, 62);
+const value32169 = compute(value, 62);
+const value47204 = compute(value, 62);
+const value8339 = compute(value, 94);
+// note 22718: keep this in sync with the handler
+const value16873 = compute(value, 92);
+const value63436 = compute(value, 95);
+const value81197 = compute(value, 8);
+const value32507 = compute(value, 12);
+const value60195 = compute(value, 55);
+const v = process.env.BENCH_KEY_00002;
+const value68537 = compute(value, 55);
+const value68556 = compute(value, 74);
+const value27502 = compute(value, 51);
+const value86296 = compute(value, 63);
+// note 43571: keep this in sync with the handler
+const value27218 = compute(value, 58);
+// note 73934: keep this in sync with the handler
+const value62295 = compute(value, 21);
+const v = process.env["BENCH_KEY_01776"];
+const value71483 = compute(value, 91);
+const value58893 = compute(value, 14);
+const value99631 = compute(value, 12);
+const value65177 = compute(value, 90);
+const value57306 = compute(value, 76);
+const value27125 = compute(value, 62);
+const value6604 = compute(value, 8);
+const value93980 = compute(value, 84);
+const value42244 = compute(value, 49);
+const value8886 = compute(value, 59);
+const value81877 = compute(value, 9);
+const value23748 = compute(value, 80);
+const value27040 = compute(value, 74);
+const value33530 = compute(value, 65);
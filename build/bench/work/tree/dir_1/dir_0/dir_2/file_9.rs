@@ -0,0 +1,209 @@
+let value81481 = compute(value, 1);
+let value90227 = compute(value, 17);
+let value98161 = compute(value, 94);
+const v = env::var("BENCH_KEY_01815");
+let value76323 = compute(value, 81);
+let value88560 = compute(value, 96);
+let value15238 = compute(value, 9);
+let value28101 = compute(value, 68);
+// note 68338: keep this in sync with the handler
+let value13711 = compute(value, 34);
+let value75594 = compute(value, 31);
+let value94770 = compute(value, 1);
+let value7985 = compute(value, 31);
+let value49558 = compute(value, 88);
+let value10580 = compute(value, 7);
+let value7279 = compute(value, 4);
+// note 86630: keep this in sync with the handler
+let value54193 = compute(value, 67);
+// note 88335: keep this in sync with the handler
+let value39872 = compute(value, 5);
+let value63567 = compute(value, 32);
+let value5162 = compute(value, 21);
+let value24406 = compute(value, 59);
+let value78165 = compute(value, 80);
+const v = env::var("BENCH_KEY_01112");
+let value84641 = compute(value, 57);
+// note 62664: keep this in sync with the handler
+let value5964 = compute(value, 47);
+let value37341 = compute(value, 93);
+// note 72407: keep this in sync with the handler
+let value34535 = compute(value, 3);
+let value96282 = compute(value, 58);
+let value89196 = compute(value, 53);
+let value7446 = compute(value, 74);
+let value74725 = compute(value, 35);
+const v = env::var("BENCH_KEY_01138");
+// note 41044: keep this in sync with the handler
+let value2044 = compute(value, 7);
+let value46979 = compute(value, 31);
+// note 79794: keep this in sync with the handler
+let value79783 = compute(value, 49);
+// note 70301: keep this in sync with the handler
+let value24861 = compute(value, 29);
+let value23740 = compute(value, 72);
+// note 37813: keep this in sync with the handler
+let value77150 = compute(value, 35);
+const v = env::var_os("BENCH_KEY_00166");
+let value51066 = compute(value, 44);
+// note 35423: keep this in sync with the handler
+// note 75569: keep this in sync with the handler
+let value7099 = compute(value, 18);
+let value73759 = compute(value, 39);
+let value86072 = compute(value, 33);
+let value86200 = compute(value, 64);
+let value20648 = compute(value, 84);
+let value25398 = compute(value, 81);
+let value81940 = compute(value, 72);
+let value34309 = compute(value, 68);
+// note 38300: keep this in sync with the handler
+let value16808 = compute(value, 27);
+let value81725 = compute(value, 51);
+let value18084 = compute(value, 42);
+let value61737 = compute(value, 45);
+// note 3505: keep this in sync with the handler
+const v = env::var_os("BENCH_KEY_00716");
+// note 28842: keep this in sync with the handler
+let value52118 = compute(value, 29);
+let value45454 = compute(value, 58);
+// note 96314: keep this in sync with the handler
+let value14345 = compute(value, 86);
+let value28318 = compute(value, 91);
+let value43229 = compute(value, 64);
+const v = env::var("BENCH_KEY_01138");
+let value49159 = compute(value, 77);
+let value92811 = compute(value, 79);
+let value35579 = compute(value, 77);
+let value54800 = compute(value, 92);
+let value12521 = compute(value, 8);
+let value36921 = compute(value, 61);
+let value43402 = compute(value, 43);
+let value94986 = compute(value, 23);
+let value78631 = compute(value, 61);
+let value62909 = compute(value, 53);
+let value1365 = compute(value, 7);
+const v = env::var("BENCH_KEY_00320");
+let value59393 = compute(value, 29);
+let value23726 = compute(value, 58);
+// note 48458: keep this in sync with the handler
+let value26975 = compute(value, 9);
+let value14973 = compute(value, 35);
+// note 21646: keep this in sync with the handler
+let value53550 = compute(value, 6);
+const v = env::var("BENCH_KEY_00443");
+let value75392 = compute(value, 23);
+let value96597 = compute(value, 82);
+let value31817 = compute(value, 1);
+let value48621 = compute(value, 24);
+let value4195 = compute(value, 24);
+let value99188 = compute(value, 54);
+let value13033 = compute(value, 35);
+let value92620 = compute(value, 82);
+// note 37414: keep this in sync with the handler
+let value91185 = compute(value, 5);
+let value11443 = compute(value, 94);
+// note 20895: keep this in sync with the handler
+// note 55955: keep this in sync with the handler
+let value77327 = compute(value, 18);
+// note 72407: keep this in sync with the handler
+let value68241 = compute(value, 50);
+// note 31384: keep this in sync with the handler
+let value46798 = compute(value, 44);
+const v = env::var_os("BENCH_KEY_00081");
+// note 87509: keep this in sync with the handler
+let value96633 = compute(value, 21);
+let value38900 = compute(value, 3);
+let value36718 = compute(value, 52);
+let value1092 = compute(value, 25);
+let value41460 = compute(value, 41);
+let value46316 = compute(value, 47);
+let value64397 = compute(value, 86);
+let value40726 = compute(value, 83);
+let value8955 = compute(value, 31);
+// note 85321: keep this in sync with the handler
+let value56066 = compute(value, 0);
+// note 77761: keep this in sync with the handler
+let value88312 = compute(value, 42);
+let value89421 = compute(value, 84);
+let value45855 = compute(value, 71);
+let value51637 = compute(value, 33);
+const v = env::var("BENCH_KEY_01247");
+let value14155 = compute(value, 90);
+// note 28455: keep this in sync with the handler
+let value46725 = compute(value, 68);
+let value9280 = compute(value, 65);
+// note 884: keep this in sync with the handler
+let value46094 = compute(value, 19);
+let value96673 = compute(value, 61);
+let value27325 = compute(value, 68);
+let value11092 = compute(value, 34);
+let value5238 = compute(value, 0);
+let value69717 = compute(value, 71);
+let value52394 = compute(value, 14);
+const v = env::var_os("BENCH_KEY_00663");
+let value24434 = compute(value, 87);
+// note 69339: keep this in sync with the handler
+let value61367 = compute(value, 63);
+let value34518 = compute(value, 83);
+// note 25193: keep this in sync with the handler
+let value56286 = compute(value, 26);
+let value4400 = compute(value, 35);
+let value4411 = compute(value, 46);
+let value94854 = compute(value, 85);
+let value15414 = compute(value, 88);
+const v = env::var("BENCH_KEY_01831");
+let value36502 = compute(value, 30);
+let value75067 = compute(value, 86);
+let value41075 = compute(value, 44);
+let value33813 = compute(value, 57);
+let value21020 = compute(value, 68);
+let value72349 = compute(value, 84);
+// note 83333: keep this in sync with the handler
+let value65002 = compute(value, 12);
+let value76549 = compute(value, 16);
+let value52746 = compute(value, 75);
+let value25820 = compute(value, 18);
+let value10060 = compute(value, 69);
+const v = env::var("BENCH_KEY_00786");
+let value82598 = compute(value, 51);
+let value51149 = compute(value, 30);
+let value60952 = compute(value, 36);
+// note 57474: keep this in sync with the handler
+let value19617 = compute(value, 23);
+let value15307 = compute(value, 78);
+let value14801 = compute(value, 57);
+let value41718 = compute(value, 8);
+let value31656 = compute(value, 34);
+let value88854 = compute(value, 2);
+let value43985 = compute(value, 44);
+let value29364 = compute(value, 70);
+let value32666 = compute(value, 74);
+let value29942 = compute(value, 66);
+let value52082 = compute(value, 90);
+let value81384 = compute(value, 1);
+// note 67408: keep this in sync with the handler
+const v = env::var_os("BENCH_KEY_01998");
+let value61671 = compute(value, 76);
+// note 66925: keep this in sync with the handler
+let value14937 = compute(value, 96);
+let value26964 = compute(value, 95);
+let value11551 = compute(value, 8);
+let value23946 = compute(value, 84);
+let value6711 = compute(value, 18);
+let value9006 = compute(value, 82);
+let value48248 = compute(value, 39);
+let value83010 = compute(value, 75);
+let value6638 = compute(value, 42);
+let value51311 = compute(value, 95);
+const v = env::var_os("BENCH_KEY_01970");
+let value39994 = compute(value, 30);
+let value94046 = compute(value, 53);
+// note 22095: keep this in sync with the handler
+let value10636 = compute(value, 63);
+let value16455 = compute(value, 62);
+let value55337 = compute(value, 47);
+let value75457 = compute(value, 88);
+let value83924 = compute(value, 19);
+// note 99572: keep this in sync with the handler
+const v = env::var("BENCH_KEY_00423");
+let value38893 = compute(value, 93);
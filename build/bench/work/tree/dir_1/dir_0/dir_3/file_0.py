@@ -0,0 +1,237 @@
+# note 47303: keep this in sync with the handler
+value60667 = compute(value, 42)
+value16984 = compute(value, 9)
+value50356 = compute(value, 13)
+value49215 = compute(value, 36)
+value72997 = compute(value, 53)
+value94918 = compute(value, 52)
+value11505 = compute(value, 59)
+value35825 = compute(value, 32)
+value14674 = compute(value, 27)
+value60876 = compute(value, 57)
+value42286 = compute(value, 91)
+const v = os.getenv("BENCH_KEY_01878");
+# note 85603: keep this in sync with the handler
+value91260 = compute(value, 80)
+value26317 = compute(value, 30)
+value96294 = compute(value, 70)
+value52528 = compute(value, 51)
+value15282 = compute(value, 53)
+value12248 = compute(value, 26)
+value35514 = compute(value, 12)
+value57830 = compute(value, 18)
+value61718 = compute(value, 26)
+value75023 = compute(value, 42)
+value44564 = compute(value, 41)
+value26736 = compute(value, 61)
+value25132 = compute(value, 9)
+value78200 = compute(value, 18)
+value57475 = compute(value, 51)
+value82658 = compute(value, 14)
+value91184 = compute(value, 4)
+const v = os.environ.get('BENCH_KEY_01771');
+value62574 = compute(value, 9)
+# note 3873: keep this in sync with the handler
+value73630 = compute(value, 7)
+# note 5197: keep this in sync with the handler
+value99060 = compute(value, 23)
+# note 96206: keep this in sync with the handler
+# note 10064: keep this in sync with the handler
+value119 = compute(value, 22)
+value59082 = compute(value, 9)
+value10999 = compute(value, 38)
+# note 45189: keep this in sync with the handler
+const v = os.environ.get('BENCH_KEY_01891');
+value85821 = compute(value, 73)
+value92468 = compute(value, 27)
+value12818 = compute(value, 14)
+value25060 = compute(value, 34)
+# note 22130: keep this in sync with the handler
+value95242 = compute(value, 85)
+value34290 = compute(value, 49)
+value98785 = compute(value, 39)
+value19566 = compute(value, 69)
+value83222 = compute(value, 93)
+value23898 = compute(value, 36)
+value83075 = compute(value, 43)
+const v = os.environ["BENCH_KEY_01385"];
+value39708 = compute(value, 35)
+value94085 = compute(value, 92)
+value36023 = compute(value, 36)
+value26847 = compute(value, 75)
+value51688 = compute(value, 84)
+value79204 = compute(value, 52)
+value74537 = compute(value, 41)
+value15315 = compute(value, 86)
+# note 81144: keep this in sync with the handler
+value76704 = compute(value, 74)
+value99271 = compute(value, 40)
+value51007 = compute(value, 82)
+value76663 = compute(value, 33)
+value41871 = compute(value, 64)
+value32092 = compute(value, 82)
+value76978 = compute(value, 57)
+value36605 = compute(value, 36)
+value18992 = compute(value, 77)
+value4200 = compute(value, 29)
+value11358 = compute(value, 9)
+const v = os.environ.get('BENCH_KEY_00045');
+value96455 = compute(value, 37)
+value42368 = compute(value, 76)
+value36714 = compute(value, 48)
+value71344 = compute(value, 49)
+value28138 = compute(value, 8)
+value14245 = compute(value, 83)
+value30801 = compute(value, 52)
+value80561 = compute(value, 51)
+# note 43315: keep this in sync with the handler
+value7374 = compute(value, 2)
+value32323 = compute(value, 22)
+value72487 = compute(value, 28)
+value18781 = compute(value, 60)
+value68290 = compute(value, 2)
+value65162 = compute(value, 75)
+value48779 = compute(value, 85)
+# note 28927: keep this in sync with the handler
+value9592 = compute(value, 86)
+value72262 = compute(value, 94)
+const v = os.environ["BENCH_KEY_01113"];
+value94280 = compute(value, 93)
+value92076 = compute(value, 23)
+value66801 = compute(value, 65)
+value64215 = compute(value, 1)
+value15457 = compute(value, 34)
+value86473 = compute(value, 46)
+value15038 = compute(value, 3)
+value9962 = compute(value, 68)
+value3933 = compute(value, 53)
+value77807 = compute(value, 13)
+value48548 = compute(value, 48)
+const v = os.environ["BENCH_KEY_01201"];
+value71067 = compute(value, 63)
+value79198 = compute(value, 46)
+value30378 = compute(value, 17)
+# note 20473: keep this in sync with the handler
+# note 15207: keep this in sync with the handler
+value35924 = compute(value, 34)
+# note 75989: keep this in sync with the handler
+value809 = compute(value, 33)
+value45872 = compute(value, 88)
+value2280 = compute(value, 49)
+value25591 = compute(value, 80)
+value52064 = compute(value, 72)
+const v = os.environ.get('BENCH_KEY_01103');
+# note 76762: keep this in sync with the handler
+value12532 = compute(value, 19)
+value6084 = compute(value, 70)
+value61 = compute(value, 61)
+value50066 = compute(value, 14)
+# note 21972: keep this in sync with the handler
+value44125 = compute(value, 87)
+# note 14882: keep this in sync with the handler
+# note 67302: keep this in sync with the handler
+const v = os.environ["BENCH_KEY_01211"];
+value739 = compute(value, 60)
+value28686 = compute(value, 71)
+value37413 = compute(value, 68)
+value6561 = compute(value, 62)
+value87427 = compute(value, 30)
+value63710 = compute(value, 78)
+value59246 = compute(value, 76)
+value17622 = compute(value, 65)
+value24931 = compute(value, 2)
+value79149 = compute(value, 94)
+# note 8010: keep this in sync with the handler
+const v = os.environ.get('BENCH_KEY_01946');
+value70324 = compute(value, 96)
+value72055 = compute(value, 81)
+value50927 = compute(value, 2)
+value40347 = compute(value, 92)
+value11383 = compute(value, 34)
+value70244 = compute(value, 16)
+value14580 = compute(value, 30)
+value76177 = compute(value, 32)
+value40468 = compute(value, 19)
+value63870 = compute(value, 44)
+value15041 = compute(value, 6)
+value55174 = compute(value, 78)
+value52603 = compute(value, 29)
+value68620 = compute(value, 41)
+value5457 = compute(value, 25)
+# note 43699: keep this in sync with the handler
+# note 74341: keep this in sync with the handler
+value16681 = compute(value, 94)
+value36506 = compute(value, 34)
+value92753 = compute(value, 21)
+value80752 = compute(value, 48)
+value30815 = compute(value, 66)
+value5648 = compute(value, 22)
+const v = os.getenv("BENCH_KEY_01049");
+# note 83450: keep this in sync with the handler
+value13781 = compute(value, 7)
+value46353 = compute(value, 84)
+value53361 = compute(value, 11)
+value94625 = compute(value, 50)
+value241 = compute(value, 47)
+value99149 = compute(value, 15)
+value61142 = compute(value, 32)
+value46843 = compute(value, 89)
+value40931 = compute(value, 94)
+value72100 = compute(value, 29)
+const v = os.environ.get('BENCH_KEY_00344');
+value27293 = compute(value, 36)
+value85729 = compute(value, 78)
+value65630 = compute(value, 58)
+value52218 = compute(value, 32)
+value96081 = compute(value, 51)
+value63620 = compute(value, 85)
+value37668 = compute(value, 32)
+# note 67048: keep this in sync with the handler
+value22925 = compute(value, 33)
+value11801 = compute(value, 64)
+value40105 = compute(value, 44)
+const v = os.environ.get('BENCH_KEY_00422');
+value282 = compute(value, 88)
+value5142 = compute(value, 1)
+# note 36700: keep this in sync with the handler
+value22352 = compute(value, 42)
+value69674 = compute(value, 28)
+# note 64550: keep this in sync with the handler
+value29274 = compute(value, 77)
+value52113 = compute(value, 24)
+value89700 = compute(value, 72)
+value19759 = compute(value, 68)
+# note 52354: keep this in sync with the handler
+value25751 = compute(value, 46)
+value69468 = compute(value, 16)
+value98980 = compute(value, 40)
+# note 71780: keep this in sync with the handler
+value10294 = compute(value, 12)
+# note 58281: keep this in sync with the handler
+value66343 = compute(value, 92)
+value76723 = compute(value, 93)
+value40395 = compute(value, 43)
+const v = os.environ.get('BENCH_KEY_01818');
+value43308 = compute(value, 46)
+value62428 = compute(value, 57)
+value20797 = compute(value, 39)
+value90984 = compute(value, 95)
+value82585 = compute(value, 38)
+value53383 = compute(value, 33)
+value37732 = compute(value, 96)
+# note 52395: keep this in sync with the handler
+value10667 = compute(value, 94)
+value43008 = compute(value, 37)
+value62298 = compute(value, 24)
+# note 53931: keep this in sync with the handler
+value74742 = compute(value, 52)
+value36724 = compute(value, 58)
+value17891 = compute(value, 43)
+value14688 = compute(value, 41)
+value64551 = compute(value, 46)
+value41120 = compute(value, 89)
+value5249 = compute(value, 11)
+value1516 = compute(value, 61)
+value33943 = compute(value, 90)
+value16850 = compute(value, 69)
+value23682 = compute(value, 14)
@@ -0,0 +1,205 @@
+const value22959 = compute(value, 67);
+const value74281 = compute(value, 76);
+const value16096 = compute(value, 91);
+const value45936 = compute(value, 55);
+const value34553 = compute(value, 21);
+const value60825 = compute(value, 6);
+const v = process.env.BENCH_KEY_01911;
+const value54261 = compute(value, 38);
+const value67353 = compute(value, 35);
+// note 47835: keep this in sync with the handler
+const value37934 = compute(value, 7);
+const value17436 = compute(value, 73);
+const value71125 = compute(value, 24);
+const value66059 = compute(value, 2);
+const value95238 = compute(value, 81);
+const v = process.env["BENCH_KEY_01492"];
+const value38413 = compute(value, 1);
+const value11272 = compute(value, 20);
+const value13010 = compute(value, 12);
+const value45155 = compute(value, 50);
+// note 82984: keep this in sync with the handler
+const value82014 = compute(value, 49);
+const value38440 = compute(value, 28);
+const value9568 = compute(value, 62);
+const v = import.meta.env.BENCH_KEY_00038;
+const value91586 = compute(value, 18);
+// note 88230: keep this in sync with the handler
+const value36255 = compute(value, 74);
+const value35014 = compute(value, 94);
+const value81627 = compute(value, 50);
+const value2012 = compute(value, 72);
+const value31438 = compute(value, 10);
+const value70556 = compute(value, 37);
+const value4549 = compute(value, 87);
+const value35098 = compute(value, 81);
+const value4631 = compute(value, 72);
+const value19470 = compute(value, 70);
+const value45021 = compute(value, 13);
+const value6663 = compute(value, 67);
+const v = process.env["BENCH_KEY_01700"];
+const value69664 = compute(value, 18);
+const value25093 = compute(value, 67);
+const value19860 = compute(value, 72);
+// note 83697: keep this in sync with the handler
+const value79612 = compute(value, 72);
+const value27503 = compute(value, 52);
+const value95159 = compute(value, 2);
+// note 27222: keep this in sync with the handler
+const value36092 = compute(value, 8);
+const value29203 = compute(value, 6);
+const value60494 = compute(value, 63);
+const value61705 = compute(value, 13);
+// note 97971: keep this in sync with the handler
+const v = process.env["BENCH_KEY_01970"];
+// note 15107: keep this in sync with the handler
+const value17973 = compute(value, 28);
+const value80110 = compute(value, 85);
+const value57458 = compute(value, 34);
+const value32169 = compute(value, 62);
+const value90921 = compute(value, 32);
+const value45135 = compute(value, 30);
+const v = import.meta.env.BENCH_KEY_00433;
+const value94203 = compute(value, 16);
+const value41105 = compute(value, 74);
+const value68860 = compute(value, 87);
+const value76709 = compute(value, 79);
+const value40975 = compute(value, 41);
+const value95087 = compute(value, 27);
+const value25701 = compute(value, 93);
+const value12642 = compute(value, 32);
+const v = import.meta.env.BENCH_KEY_01372;
+const value83934 = compute(value, 29);
+const value15950 = compute(value, 42);
+const value19569 = compute(value, 72);
+const value51650 = compute(value, 46);
+const value7444 = compute(value, 72);
+const value19674 = compute(value, 80);
+const value64734 = compute(value, 35);
+const value6569 = compute(value, 70);
+const v = process.env.BENCH_KEY_00354;
+// note 4631: keep this in sync with the handler
+const value51221 = compute(value, 5);
+const value44626 = compute(value, 6);
+const value44195 = compute(value, 60);
+const value97903 = compute(value, 30);
+const value83329 = compute(value, 6);
+const value89761 = compute(value, 36);
+const value54416 = compute(value, 96);
+const value22028 = compute(value, 9);
+const v = import.meta.env.BENCH_KEY_00667;
+const value57264 = compute(value, 34);
+const value47160 = compute(value, 18);
+const value26127 = compute(value, 34);
+const value6591 = compute(value, 92);
+const value46137 = compute(value, 62);
+const value47893 = compute(value, 72);
+const value33263 = compute(value, 89);
+const value16209 = compute(value, 10);
+const value99466 = compute(value, 41);
+const value88244 = compute(value, 71);
+const value49794 = compute(value, 33);
+const value33529 = compute(value, 64);
+const value47669 = compute(value, 42);
+const value29164 = compute(value, 64);
+const v = import.meta.env.BENCH_KEY_01331;
+const value51166 = compute(value, 47);
+const value79841 = compute(value, 10);
+const value48928 = compute(value, 40);
+const value62653 = compute(value, 88);
+const value83266 = compute(value, 40);
+const value81034 = compute(value, 39);
+// note 7556: keep this in sync with the handler
+const value57381 = compute(value, 54);
+const value26343 = compute(value, 56);
+const value47936 = compute(value, 18);
+const value57910 = compute(value, 1);
+const v = process.env.BENCH_KEY_01508;
+const value75853 = compute(value, 96);
+const value33741 = compute(value, 82);
+const value92975 = compute(value, 49);
+const value18080 = compute(value, 38);
+// note 61319: keep this in sync with the handler
+const value93993 = compute(value, 0);
+const value90718 = compute(value, 23);
+// note 82046: keep this in sync with the handler
+const value9173 = compute(value, 55);
+const value49949 = compute(value, 91);
+const value4730 = compute(value, 74);
+const value35104 = compute(value, 87);
+const value92029 = compute(value, 73);
+const value2477 = compute(value, 52);
+const v = import.meta.env.BENCH_KEY_00827;
+const value15376 = compute(value, 50);
+const value61563 = compute(value, 65);
+const value71421 = compute(value, 29);
+const value21133 = compute(value, 84);
+// note 16981: keep this in sync with the handler
+const value77792 = compute(value, 95);
+const value62969 = compute(value, 16);
+// note 64917: keep this in sync with the handler
+const value24774 = compute(value, 39);
+const value97907 = compute(value, 34);
+const value90288 = compute(value, 78);
+const value54633 = compute(value, 22);
+const value21568 = compute(value, 34);
+const value44616 = compute(value, 93);
+const value82897 = compute(value, 59);
+const value51239 = compute(value, 23);
+const value91682 = compute(value, 17);
+const value44961 = compute(value, 50);
+const v = import.meta.env.BENCH_KEY_01708;
+const value61105 = compute(value, 92);
+const value63668 = compute(value, 36);
+const value97616 = compute(value, 34);
+// note 20876: keep this in sync with the handler
+const value63781 = compute(value, 52);
+const value68450 = compute(value, 65);
+const value72510 = compute(value, 51);
+const v = process.env.BENCH_KEY_01254;
+// note 78395: keep this in sync with the handler
+const value66933 = compute(value, 3);
+const value7262 = compute(value, 84);
+const value36861 = compute(value, 1);
+const value77006 = compute(value, 85);
+const value33632 = compute(value, 70);
+const value9062 = compute(value, 41);
+const value45128 = compute(value, 23);
+const value65205 = compute(value, 21);
+const value25861 = compute(value, 59);
+const v = process.env["BENCH_KEY_00307"];
+const value89562 = compute(value, 31);
+const value47756 = compute(value, 32);
+const value48178 = compute(value, 66);
+const value77756 = compute(value, 59);
+// note 488: keep this in sync with the handler
+const value9715 = compute(value, 15);
+const value27132 = compute(value, 69);
+const value47120 = compute(value, 75);
+const value80518 = compute(value, 8);
+const value71279 = compute(value, 81);
+const v = import.meta.env.BENCH_KEY_01312;
+const value17648 = compute(value, 91);
+const value55207 = compute(value, 14);
+const value97300 = compute(value, 9);
+const value41847 = compute(value, 40);
+const value97798 = compute(value, 22);
+const value7724 = compute(value, 61);
+const value44002 = compute(value, 61);
+const value201 = compute(value, 7);
+const value98006 = compute(value, 36);
+const value20302 = compute(value, 29);
+const value65561 = compute(value, 86);
+const v = import.meta.env.BENCH_KEY_00019;
+const value97159 = compute(value, 62);
+const value56277 = compute(value, 17);
+const value18669 = compute(value, 45);
+const value25943 = compute(value, 44);
+// note 93513: keep this in sync with the handler
+// note 57887: keep this in sync with the handler
+// note 93769: keep this in sync with the handler
+const value33350 = compute(value, 79);
+const value26502 = compute(value, 21);
+const value12055 = compute(value, 27);
+const value518 = compute(value, 33);
+const value50162 = compute(value, 13);
@@ -0,0 +1,241 @@
+value56229 = compute(value, 66)
+value70246 = compute(value, 18)
+value34704 = compute(value, 75)
+value47602 = compute(value, 72)
+# note 15509: keep this in sync with the handler
+const v = os.environ["BENCH_KEY_01032"];
+value10572 = compute(value, 96)
+value97464 = compute(value, 76)
+value63928 = compute(value, 5)
+value71471 = compute(value, 79)
+# note 60322: keep this in sync with the handler
+value66360 = compute(value, 12)
+value92649 = compute(value, 14)
+value28725 = compute(value, 13)
+value29392 = compute(value, 1)
+value65476 = compute(value, 1)
+value20459 = compute(value, 89)
+value89965 = compute(value, 46)
+value89312 = compute(value, 72)
+value39914 = compute(value, 47)
+value84860 = compute(value, 82)
+value2642 = compute(value, 23)
+const v = os.getenv("BENCH_KEY_01274");
+# note 82004: keep this in sync with the handler
+value1187 = compute(value, 23)
+# note 16512: keep this in sync with the handler
+# note 75157: keep this in sync with the handler
+# note 89399: keep this in sync with the handler
+value54991 = compute(value, 89)
+value80566 = compute(value, 56)
+value36528 = compute(value, 56)
+value32072 = compute(value, 62)
+value38461 = compute(value, 49)
+value26706 = compute(value, 31)
+value93567 = compute(value, 59)
+value40657 = compute(value, 14)
+# note 81332: keep this in sync with the handler
+value52078 = compute(value, 86)
+value389 = compute(value, 1)
+value15856 = compute(value, 45)
+value62561 = compute(value, 93)
+# note 72925: keep this in sync with the handler
+const v = os.getenv("BENCH_KEY_00983");
+value56404 = compute(value, 47)
+value11485 = compute(value, 39)
+# note 95950: keep this in sync with the handler
+value74792 = compute(value, 5)
+value8889 = compute(value, 62)
+value6140 = compute(value, 29)
+value25857 = compute(value, 55)
+value75115 = compute(value, 37)
+value642 = compute(value, 60)
+value31856 = compute(value, 40)
+const v = os.environ.get('BENCH_KEY_00806');
+value33625 = compute(value, 63)
+value95096 = compute(value, 36)
+value12436 = compute(value, 20)
+value84748 = compute(value, 67)
+value48472 = compute(value, 69)
+value74639 = compute(value, 46)
+value66618 = compute(value, 76)
+value93205 = compute(value, 85)
+# note 97979: keep this in sync with the handler
+value91789 = compute(value, 27)
+value86496 = compute(value, 69)
+# note 20409: keep this in sync with the handler
+# note 6975: keep this in sync with the handler
+value90140 = compute(value, 27)
+value82370 = compute(value, 17)
+value99108 = compute(value, 71)
+value30599 = compute(value, 44)
+value84752 = compute(value, 71)
+value90645 = compute(value, 47)
+const v = os.getenv("BENCH_KEY_00007");
+value22736 = compute(value, 38)
+value19927 = compute(value, 42)
+value8108 = compute(value, 57)
+value52780 = compute(value, 12)
+value59693 = compute(value, 38)
+value68789 = compute(value, 16)
+value71409 = compute(value, 17)
+value30495 = compute(value, 37)
+# note 41133: keep this in sync with the handler
+value22332 = compute(value, 22)
+value56441 = compute(value, 84)
+value45219 = compute(value, 17)
+value65043 = compute(value, 53)
+value38060 = compute(value, 36)
+const v = os.getenv("BENCH_KEY_01787");
+value45841 = compute(value, 57)
+value99066 = compute(value, 29)
+value37832 = compute(value, 2)
+value74134 = compute(value, 26)
+value54594 = compute(value, 80)
+value91648 = compute(value, 80)
+value18693 = compute(value, 69)
+value27791 = compute(value, 49)
+value34796 = compute(value, 70)
+value79692 = compute(value, 55)
+value8978 = compute(value, 54)
+# note 60174: keep this in sync with the handler
+value10225 = compute(value, 40)
+value51493 = compute(value, 83)
+value38848 = compute(value, 48)
+value58485 = compute(value, 91)
+value16329 = compute(value, 33)
+value95489 = compute(value, 41)
+value82258 = compute(value, 2)
+value27845 = compute(value, 6)
+value22181 = compute(value, 65)
+value78724 = compute(value, 57)
+const v = os.getenv("BENCH_KEY_01168");
+value84694 = compute(value, 13)
+value88358 = compute(value, 88)
+value25700 = compute(value, 92)
+value87105 = compute(value, 96)
+value28947 = compute(value, 41)
+value32436 = compute(value, 38)
+value64267 = compute(value, 53)
+# note 14649: keep this in sync with the handler
+value63873 = compute(value, 47)
+value38553 = compute(value, 44)
+# note 33934: keep this in sync with the handler
+value20079 = compute(value, 0)
+value30340 = compute(value, 76)
+value80793 = compute(value, 89)
+value92876 = compute(value, 47)
+value44937 = compute(value, 26)
+const v = os.environ["BENCH_KEY_00979"];
+# note 40539: keep this in sync with the handler
+value60062 = compute(value, 19)
+value28943 = compute(value, 37)
+value84668 = compute(value, 84)
+value79538 = compute(value, 95)
+value33132 = compute(value, 55)
+value37195 = compute(value, 44)
+value32390 = compute(value, 89)
+value73606 = compute(value, 80)
+value63113 = compute(value, 63)
+value32634 = compute(value, 42)
+value84841 = compute(value, 63)
+value55894 = compute(value, 22)
+value90661 = compute(value, 63)
+value66723 = compute(value, 84)
+value48154 = compute(value, 42)
+value25021 = compute(value, 92)
+value62005 = compute(value, 22)
+# note 93602: keep this in sync with the handler
+value92762 = compute(value, 30)
+value60541 = compute(value, 13)
+const v = os.getenv("BENCH_KEY_00199");
+value31988 = compute(value, 75)
+value74328 = compute(value, 26)
+value84236 = compute(value, 40)
+value50770 = compute(value, 39)
+value31793 = compute(value, 74)
+value1396 = compute(value, 38)
+value49506 = compute(value, 36)
+value93931 = compute(value, 35)
+value83863 = compute(value, 55)
+value17870 = compute(value, 22)
+value12194 = compute(value, 69)
+value68416 = compute(value, 31)
+value6874 = compute(value, 84)
+value53031 = compute(value, 69)
+value1908 = compute(value, 65)
+value40297 = compute(value, 42)
+value49528 = compute(value, 58)
+const v = os.getenv("BENCH_KEY_00915");
+value87828 = compute(value, 43)
+value40948 = compute(value, 14)
+value21051 = compute(value, 2)
+value94247 = compute(value, 60)
+value92303 = compute(value, 56)
+value98291 = compute(value, 30)
+value77055 = compute(value, 37)
+value87705 = compute(value, 17)
+value56121 = compute(value, 55)
+# note 58240: keep this in sync with the handler
+value74307 = compute(value, 5)
+value15694 = compute(value, 77)
+value93071 = compute(value, 48)
+value691 = compute(value, 12)
+value88474 = compute(value, 10)
+# note 6446: keep this in sync with the handler
+const v = os.environ["BENCH_KEY_00622"];
+value1382 = compute(value, 24)
+# note 60988: keep this in sync with the handler
+value53822 = compute(value, 84)
+value47805 = compute(value, 81)
+# note 3765: keep this in sync with the handler
+value23375 = compute(value, 95)
+value53482 = compute(value, 35)
+value68730 = compute(value, 54)
+value32921 = compute(value, 38)
+const v = os.environ.get('BENCH_KEY_00954');
+value55522 = compute(value, 38)
+value3612 = compute(value, 23)
+value27724 = compute(value, 79)
+# note 83780: keep this in sync with the handler
+value68876 = compute(value, 6)
+value65269 = compute(value, 85)
+value18522 = compute(value, 92)
+value18519 = compute(value, 89)
+value79767 = compute(value, 33)
+value56436 = compute(value, 79)
+value60732 = compute(value, 10)
+# note 46868: keep this in sync with the handler
+value45975 = compute(value, 94)
+value16064 = compute(value, 59)
+value62293 = compute(value, 19)
+value85020 = compute(value, 48)
+value96182 = compute(value, 55)
+value5387 = compute(value, 52)
+value5574 = compute(value, 45)
+value21649 = compute(value, 18)
+value63460 = compute(value, 22)
+value97820 = compute(value, 44)
+const v = os.environ["BENCH_KEY_00868"];
+value15845 = compute(value, 34)
+value12910 = compute(value, 9)
+value69104 = compute(value, 40)
+value94088 = compute(value, 95)
+value26823 = compute(value, 51)
+value66394 = compute(value, 46)
+value45837 = compute(value, 53)
+# note 59411: keep this in sync with the handler
+value69357 = compute(value, 2)
+value43192 = compute(value, 27)
+value73788 = compute(value, 68)
+value66743 = compute(value, 7)
+value59493 = compute(value, 32)
+value58790 = compute(value, 8)
+value75143 = compute(value, 65)
+value9791 = compute(value, 91)
+value95065 = compute(value, 5)
+value90955 = compute(value, 66)
+value55249 = compute(value, 56)
+value86292 = compute(value, 59)
+value1632 = compute(value, 80)
+const v = os.environ.get('BENCH_KEY_01831');
@@ -0,0 +1,241 @@
+value39652 = compute(value, 76)
+value86072 = compute(value, 33)
+value64568 = compute(value, 63)
+value15892 = compute(value, 81)
+value23660 = compute(value, 89)
+value77812 = compute(value, 18)
+value63879 = compute(value, 53)
+value95371 = compute(value, 20)
+value4978 = compute(value, 31)
+value82288 = compute(value, 32)
+value17329 = compute(value, 63)
+const v = os.environ.get('BENCH_KEY_00750');
+value31213 = compute(value, 76)
+value88844 = compute(value, 89)
+# note 28413: keep this in sync with the handler
+value15203 = compute(value, 71)
+value31073 = compute(value, 33)
+value84710 = compute(value, 29)
+value49596 = compute(value, 29)
+value35929 = compute(value, 39)
+value81918 = compute(value, 50)
+const v = os.environ["BENCH_KEY_00753"];
+value89451 = compute(value, 17)
+value54394 = compute(value, 74)
+value40666 = compute(value, 23)
+value63124 = compute(value, 74)
+value696 = compute(value, 17)
+value41512 = compute(value, 93)
+# note 96720: keep this in sync with the handler
+# note 2169: keep this in sync with the handler
+value65238 = compute(value, 54)
+value36620 = compute(value, 51)
+value40186 = compute(value, 28)
+value74788 = compute(value, 1)
+const v = os.environ.get('BENCH_KEY_01763');
+value74088 = compute(value, 77)
+value12908 = compute(value, 7)
+# note 61916: keep this in sync with the handler
+value3444 = compute(value, 49)
+value75141 = compute(value, 63)
+value12747 = compute(value, 40)
+value36810 = compute(value, 47)
+value26260 = compute(value, 70)
+# note 42694: keep this in sync with the handler
+value93342 = compute(value, 28)
+value4829 = compute(value, 76)
+value39137 = compute(value, 46)
+value95814 = compute(value, 75)
+value91600 = compute(value, 32)
+value79454 = compute(value, 11)
+value73590 = compute(value, 64)
+value53074 = compute(value, 15)
+value58274 = compute(value, 74)
+const v = os.environ.get('BENCH_KEY_00749');
+value97346 = compute(value, 55)
+value50791 = compute(value, 60)
+value39277 = compute(value, 89)
+value66682 = compute(value, 43)
+value29459 = compute(value, 68)
+value82271 = compute(value, 15)
+value64507 = compute(value, 2)
+value65105 = compute(value, 18)
+value81379 = compute(value, 93)
+value18535 = compute(value, 8)
+value4008 = compute(value, 31)
+value19812 = compute(value, 24)
+value28326 = compute(value, 2)
+value60665 = compute(value, 40)
+value45672 = compute(value, 82)
+value73017 = compute(value, 73)
+value13670 = compute(value, 90)
+value32436 = compute(value, 38)
+const v = os.getenv("BENCH_KEY_00398");
+value34859 = compute(value, 36)
+value93100 = compute(value, 77)
+value21292 = compute(value, 49)
+value23699 = compute(value, 31)
+value17775 = compute(value, 24)
+value13409 = compute(value, 23)
+value9724 = compute(value, 24)
+value62470 = compute(value, 2)
+value28080 = compute(value, 47)
+value98605 = compute(value, 53)
+value94644 = compute(value, 69)
+value57463 = compute(value, 39)
+value77040 = compute(value, 22)
+const v = os.environ["BENCH_KEY_00844"];
+value89019 = compute(value, 70)
+value22557 = compute(value, 53)
+value74747 = compute(value, 57)
+value68545 = compute(value, 63)
+value38260 = compute(value, 42)
+value8722 = compute(value, 89)
+value68150 = compute(value, 56)
+value33981 = compute(value, 31)
+value63907 = compute(value, 81)
+value91630 = compute(value, 62)
+value50670 = compute(value, 36)
+value71974 = compute(value, 0)
+# note 16551: keep this in sync with the handler
+value95172 = compute(value, 15)
+value49770 = compute(value, 9)
+value70933 = compute(value, 26)
+value13336 = compute(value, 47)
+# note 57892: keep this in sync with the handler
+const v = os.getenv("BENCH_KEY_00941");
+value79170 = compute(value, 18)
+value36091 = compute(value, 7)
+value53908 = compute(value, 73)
+value70621 = compute(value, 5)
+value20771 = compute(value, 13)
+value11190 = compute(value, 35)
+value79894 = compute(value, 63)
+value35894 = compute(value, 4)
+value99659 = compute(value, 40)
+# note 96568: keep this in sync with the handler
+value15785 = compute(value, 71)
+value1175 = compute(value, 11)
+value26143 = compute(value, 50)
+value84275 = compute(value, 79)
+value39111 = compute(value, 20)
+value82489 = compute(value, 39)
+value5057 = compute(value, 13)
+value84135 = compute(value, 36)
+value85717 = compute(value, 66)
+value76541 = compute(value, 8)
+# note 36648: keep this in sync with the handler
+const v = os.environ["BENCH_KEY_00864"];
+value24242 = compute(value, 89)
+value3819 = compute(value, 36)
+value77532 = compute(value, 29)
+value35285 = compute(value, 74)
+value96589 = compute(value, 74)
+value92896 = compute(value, 67)
+value8924 = compute(value, 0)
+value31428 = compute(value, 0)
+value16148 = compute(value, 46)
+value19164 = compute(value, 55)
+value30423 = compute(value, 62)
+value59601 = compute(value, 43)
+value66629 = compute(value, 87)
+value91740 = compute(value, 75)
+value808 = compute(value, 32)
+value54460 = compute(value, 43)
+value94275 = compute(value, 88)
+value45564 = compute(value, 71)
+value1109 = compute(value, 42)
+value55441 = compute(value, 54)
+value29412 = compute(value, 21)
+value83700 = compute(value, 86)
+value47596 = compute(value, 66)
+const v = os.environ.get('BENCH_KEY_01774');
+value47066 = compute(value, 21)
+value63314 = compute(value, 70)
+value72067 = compute(value, 93)
+# note 32651: keep this in sync with the handler
+value52934 = compute(value, 69)
+value18976 = compute(value, 61)
+value51 = compute(value, 51)
+value91351 = compute(value, 74)
+value94434 = compute(value, 53)
+value82530 = compute(value, 80)
+# note 61432: keep this in sync with the handler
+value46394 = compute(value, 28)
+value67166 = compute(value, 42)
+value66823 = compute(value, 87)
+value83047 = compute(value, 15)
+value55643 = compute(value, 62)
+# note 18614: keep this in sync with the handler
+value19805 = compute(value, 17)
+const v = os.getenv("BENCH_KEY_01787");
+# note 66996: keep this in sync with the handler
+value76199 = compute(value, 54)
+value91614 = compute(value, 46)
+value18169 = compute(value, 30)
+value19334 = compute(value, 31)
+# note 39600: keep this in sync with the handler
+# note 70409: keep this in sync with the handler
+value9296 = compute(value, 81)
+value95782 = compute(value, 43)
+value60692 = compute(value, 67)
+const v = os.environ.get('BENCH_KEY_00147');
+value54796 = compute(value, 88)
+value17290 = compute(value, 24)
+value78912 = compute(value, 51)
+# note 4670: keep this in sync with the handler
+# note 45085: keep this in sync with the handler
+value13618 = compute(value, 38)
+value14476 = compute(value, 23)
+value78731 = compute(value, 64)
+value73218 = compute(value, 80)
+# note 57618: keep this in sync with the handler
+value30769 = compute(value, 20)
+value9676 = compute(value, 73)
+value21818 = compute(value, 90)
+# note 43689: keep this in sync with the handler
+value25683 = compute(value, 75)
+value4843 = compute(value, 90)
+value39591 = compute(value, 15)
+value25615 = compute(value, 7)
+# note 14507: keep this in sync with the handler
+const v = os.getenv("BENCH_KEY_00333");
+# note 38141: keep this in sync with the handler
+value81983 = compute(value, 18)
+value86941 = compute(value, 29)
+value32733 = compute(value, 44)
+value65086 = compute(value, 96)
+value10710 = compute(value, 40)
+value92094 = compute(value, 41)
+value73270 = compute(value, 35)
+value80968 = compute(value, 70)
+# note 8656: keep this in sync with the handler
+value70950 = compute(value, 43)
+value32321 = compute(value, 20)
+value31043 = compute(value, 3)
+value49839 = compute(value, 78)
+# note 72377: keep this in sync with the handler
+value89486 = compute(value, 52)
+const v = os.environ["BENCH_KEY_01159"];
+value61042 = compute(value, 29)
+value15859 = compute(value, 48)
+value50329 = compute(value, 83)
+# note 62226: keep this in sync with the handler
+value22781 = compute(value, 83)
+value32956 = compute(value, 73)
+value51062 = compute(value, 40)
+value97604 = compute(value, 22)
+value65913 = compute(value, 50)
+value74564 = compute(value, 68)
+value60204 = compute(value, 64)
+value1431 = compute(value, 73)
+value1878 = compute(value, 35)
+value74835 = compute(value, 48)
+value10532 = compute(value, 56)
+value55656 = compute(value, 75)
+value80291 = compute(value, 72)
+const v = os.getenv("BENCH_KEY_01394");
+value55276 = compute(value, 83)
+value71301 = compute(value, 6)
+value48340 = compute(value, 34)
+value91996 = compute(value, 40)
@@ -0,0 +1,205 @@
+const value20703 = compute(value, 42);
+// note 90710: keep this in sync with the handler
+const value54744 = compute(value, 36);
+const value73067 = compute(value, 26);
+const value56644 = compute(value, 93);
+const value32226 = compute(value, 22);
+const v = process.env["BENCH_KEY_01189"];
+// note 31822: keep this in sync with the handler
+const value17750 = compute(value, 96);
+const value4062 = compute(value, 85);
+const value33683 = compute(value, 24);
+const value77648 = compute(value, 48);
+const value61514 = compute(value, 16);
+const value35100 = compute(value, 83);
+const value82454 = compute(value, 4);
+const value59813 = compute(value, 61);
+const value83984 = compute(value, 79);
+const value70862 = compute(value, 52);
+const value10702 = compute(value, 32);
+const value75807 = compute(value, 50);
+const v = process.env.BENCH_KEY_01546;
+const value48873 = compute(value, 82);
+const value85383 = compute(value, 23);
+const value63736 = compute(value, 7);
+const value57924 = compute(value, 15);
+const value63000 = compute(value, 47);
+const value15544 = compute(value, 24);
+// note 26854: keep this in sync with the handler
+// note 96852: keep this in sync with the handler
+const value45028 = compute(value, 20);
+// note 94111: keep this in sync with the handler
+const value93881 = compute(value, 82);
+const value18595 = compute(value, 68);
+const value6868 = compute(value, 78);
+const value82013 = compute(value, 48);
+const value45049 = compute(value, 41);
+const value8732 = compute(value, 2);
+const value44287 = compute(value, 55);
+const value18221 = compute(value, 82);
+const value95588 = compute(value, 43);
+const v = process.env.BENCH_KEY_00275;
+// note 79186: keep this in sync with the handler
+const value2991 = compute(value, 81);
+const value3935 = compute(value, 55);
+const value33605 = compute(value, 43);
+const value54853 = compute(value, 48);
+const value67559 = compute(value, 47);
+const value92513 = compute(value, 72);
+const value96480 = compute(value, 62);
+const value94077 = compute(value, 84);
+const value69978 = compute(value, 41);
+const value44214 = compute(value, 79);
+// note 5125: keep this in sync with the handler
+const value85028 = compute(value, 56);
+const v = import.meta.env.BENCH_KEY_00341;
+const value74268 = compute(value, 63);
+const value11565 = compute(value, 22);
+const value33000 = compute(value, 20);
+const value19095 = compute(value, 83);
+const value44250 = compute(value, 18);
+const value67383 = compute(value, 65);
+const value36408 = compute(value, 33);
+const value79238 = compute(value, 86);
+const value22560 = compute(value, 56);
+const value41404 = compute(value, 82);
+const value74462 = compute(value, 63);
+const value90605 = compute(value, 7);
+const v = import.meta.env.BENCH_KEY_01096;
+const value85941 = compute(value, 96);
+const value28294 = compute(value, 67);
+// note 1671: keep this in sync with the handler
+const value36695 = compute(value, 29);
+// note 88939: keep this in sync with the handler
+const value34771 = compute(value, 45);
+const value53628 = compute(value, 84);
+const value53212 = compute(value, 56);
+const value50983 = compute(value, 58);
+const value80951 = compute(value, 53);
+const value52096 = compute(value, 7);
+const value25113 = compute(value, 87);
+const value89336 = compute(value, 96);
+const v = import.meta.env.BENCH_KEY_01332;
+// note 1542: keep this in sync with the handler
+// note 55472: keep this in sync with the handler
+const value18157 = compute(value, 18);
+const value84227 = compute(value, 31);
+const value31306 = compute(value, 72);
+const value16539 = compute(value, 49);
+const value59179 = compute(value, 9);
+const value11559 = compute(value, 16);
+const value75379 = compute(value, 10);
+const value50011 = compute(value, 56);
+const value77683 = compute(value, 83);
+const value47253 = compute(value, 14);
+const value95414 = compute(value, 63);
+const value46566 = compute(value, 6);
+const value89999 = compute(value, 80);
+const value47707 = compute(value, 80);
+const value96407 = compute(value, 86);
+const value81016 = compute(value, 21);
+const value29802 = compute(value, 23);
+const v = import.meta.env.BENCH_KEY_01143;
+const value11587 = compute(value, 44);
+const value19144 = compute(value, 35);
+const value41810 = compute(value, 3);
+// note 11605: keep this in sync with the handler
+const value99977 = compute(value, 67);
+const value40880 = compute(value, 43);
+const value73744 = compute(value, 24);
+// note 31071: keep this in sync with the handler
+const value94681 = compute(value, 9);
+const value97144 = compute(value, 47);
+const value11922 = compute(value, 88);
+const value39736 = compute(value, 63);
+const value5311 = compute(value, 73);
+// note 91119: keep this in sync with the handler
+const value5046 = compute(value, 2);
+const value89632 = compute(value, 4);
+// note 33398: keep this in sync with the handler
+// note 37754: keep this in sync with the handler
+const value20480 = compute(value, 13);
+const v = import.meta.env.BENCH_KEY_00071;
+const value30360 = compute(value, 96);
+const value12118 = compute(value, 90);
+const value38699 = compute(value, 93);
+const value58003 = compute(value, 94);
+const value53670 = compute(value, 29);
+const value81089 = compute(value, 94);
+const value86464 = compute(value, 37);
+const value76553 = compute(value, 20);
+const value50337 = compute(value, 91);
+const v = import.meta.env.BENCH_KEY_01230;
+const value97517 = compute(value, 32);
+const value30936 = compute(value, 90);
+const value12895 = compute(value, 91);
+const value57298 = compute(value, 68);
+const value45885 = compute(value, 4);
+const value48453 = compute(value, 50);
+const value80344 = compute(value, 28);
+const value6309 = compute(value, 4);
+const value19517 = compute(value, 20);
+const value63282 = compute(value, 38);
+const value11852 = compute(value, 18);
+const value1364 = compute(value, 6);
+const value21980 = compute(value, 58);
+const value45834 = compute(value, 50);
+const value75540 = compute(value, 74);
+const value35468 = compute(value, 63);
+const value10942 = compute(value, 78);
+const v = import.meta.env.BENCH_KEY_01071;
+const value26409 = compute(value, 25);
+const value53842 = compute(value, 7);
+const value97616 = compute(value, 34);
+const value47973 = compute(value, 55);
+const value25031 = compute(value, 5);
+const value24400 = compute(value, 53);
+const value3680 = compute(value, 91);
+const value58671 = compute(value, 83);
+const value33392 = compute(value, 24);
+const value18780 = compute(value, 59);
+const value86916 = compute(value, 4);
+const value38213 = compute(value, 92);
+// note 88091: keep this in sync with the handler
+const value63594 = compute(value, 59);
+const value12762 = compute(value, 55);
+const value3098 = compute(value, 91);
+const v = process.env["BENCH_KEY_01294"];
+const value24097 = compute(value, 41);
+const value59413 = compute(value, 49);
+const value6890 = compute(value, 3);
+// note 99456: keep this in sync with the handler
+const value26712 = compute(value, 37);
+const value94440 = compute(value, 59);
+const value72905 = compute(value, 58);
+const value77004 = compute(value, 83);
+const value5693 = compute(value, 67);
+const value93224 = compute(value, 7);
+// note 2770: keep this in sync with the handler
+const value80200 = compute(value, 78);
+const value65208 = compute(value, 24);
+const value80461 = compute(value, 48);
+const value81099 = compute(value, 7);
+const v = process.env["BENCH_KEY_00956"];
+const value23231 = compute(value, 48);
+const value46754 = compute(value, 0);
+const value9389 = compute(value, 77);
+const value66792 = compute(value, 56);
+const value24419 = compute(value, 72);
+// note 7920: keep this in sync with the handler
+const value86379 = compute(value, 49);
+const value15500 = compute(value, 77);
+const value55393 = compute(value, 6);
+const value77139 = compute(value, 24);
+const value71766 = compute(value, 83);
+const v = process.env["BENCH_KEY_00026"];
+const value2862 = compute(value, 49);
+const value36687 = compute(value, 21);
+const value21598 = compute(value, 64);
+const value57155 = compute(value, 22);
+const value68741 = compute(value, 65);
+const value82668 = compute(value, 24);
+const value22753 = compute(value, 55);
+const value60378 = compute(value, 44);
+const value55717 = compute(value, 39);
+const value73302 = compute(value, 67);
@@ -0,0 +1,203 @@
+const value18789 = compute(value, 68);
+const value65818 = compute(value, 52);
+// note 45081: keep this in sync with the handler
+const value79341 = compute(value, 92);
+const value15701 = compute(value, 84);
+const value42688 = compute(value, 8);
+const value42189 = compute(value, 91);
+const value12626 = compute(value, 16);
+// note 49189: keep this in sync with the handler
+const value33781 = compute(value, 25);
+const value55098 = compute(value, 2);
+const value16802 = compute(value, 21);
+const v = process.env.BENCH_KEY_01233;
+const value88464 = compute(value, 0);
+// note 64989: keep this in sync with the handler
+const value52087 = compute(value, 95);
+const value54127 = compute(value, 1);
+const value99767 = compute(value, 51);
+const value86003 = compute(value, 61);
+const value2946 = compute(value, 36);
+const value86808 = compute(value, 90);
+const value21504 = compute(value, 67);
+// note 23905: keep this in sync with the handler
+const value34118 = compute(value, 71);
+const value59283 = compute(value, 16);
+const value46044 = compute(value, 66);
+const value57915 = compute(value, 6);
+const v = import.meta.env.BENCH_KEY_00938;
+const value60708 = compute(value, 83);
+const value57687 = compute(value, 69);
+// note 89550: keep this in sync with the handler
+const value5168 = compute(value, 27);
+const value77584 = compute(value, 81);
+const value65489 = compute(value, 14);
+const value24953 = compute(value, 24);
+const value94671 = compute(value, 96);
+// note 48551: keep this in sync with the handler
+const value94293 = compute(value, 9);
+const value90047 = compute(value, 31);
+// note 7666: keep this in sync with the handler
+const value37047 = compute(value, 90);
+const value2976 = compute(value, 66);
+const v = import.meta.env.BENCH_KEY_01112;
+const value4391 = compute(value, 26);
+const value59585 = compute(value, 27);
+const value54621 = compute(value, 10);
+// note 99253: keep this in sync with the handler
+// note 21489: keep this in sync with the handler
+// note 58677: keep this in sync with the handler
+const value16164 = compute(value, 62);
+const value45804 = compute(value, 20);
+const value29339 = compute(value, 45);
+const value54289 = compute(value, 66);
+const v = import.meta.env.BENCH_KEY_01131;
+// note 33608: keep this in sync with the handler
+const value14662 = compute(value, 15);
+const value4279 = compute(value, 11);
+const value10634 = compute(value, 61);
+// note 26435: keep this in sync with the handler
+const value57332 = compute(value, 5);
+const value33260 = compute(value, 86);
+const value87805 = compute(value, 20);
+const value86701 = compute(value, 80);
+const value38653 = compute(value, 47);
+const value727 = compute(value, 48);
+// note 46625: keep this in sync with the handler
+const value43935 = compute(value, 91);
+const value77208 = compute(value, 93);
+const value22207 = compute(value, 91);
+const v = import.meta.env.BENCH_KEY_00042;
+const value52462 = compute(value, 82);
+// note 6141: keep this in sync with the handler
+const value74164 = compute(value, 56);
+const value79309 = compute(value, 60);
+const value22195 = compute(value, 79);
+const value5022 = compute(value, 75);
+const value27238 = compute(value, 78);
+const v = process.env["BENCH_KEY_00372"];
+const value98430 = compute(value, 72);
+const value95614 = compute(value, 69);
+const value64327 = compute(value, 16);
+const value94812 = compute(value, 43);
+const value56454 = compute(value, 0);
+const value73563 = compute(value, 37);
+const value86761 = compute(value, 43);
+const value76190 = compute(value, 45);
+// note 51890: keep this in sync with the handler
+const value34678 = compute(value, 49);
+// note 52032: keep this in sync with the handler
+const value64334 = compute(value, 23);
+const value32281 = compute(value, 77);
+const value59202 = compute(value, 32);
+const value23030 = compute(value, 41);
+const value92754 = compute(value, 22);
+const value68918 = compute(value, 48);
+const value92938 = compute(value, 12);
+const v = process.env["BENCH_KEY_00976"];
+const value68273 = compute(value, 82);
+const value29240 = compute(value, 43);
+const value76459 = compute(value, 23);
+// note 574: keep this in sync with the handler
+const value33240 = compute(value, 66);
+const value49513 = compute(value, 43);
+const value10270 = compute(value, 85);
+const value38471 = compute(value, 59);
+const value53086 = compute(value, 27);
+const value98213 = compute(value, 49);
+const value15405 = compute(value, 79);
+const value15890 = compute(value, 79);
+// note 46033: keep this in sync with the handler
+const value72018 = compute(value, 44);
+const value76250 = compute(value, 8);
+const value47518 = compute(value, 85);
+// note 71918: keep this in sync with the handler
+const value13728 = compute(value, 51);
+const value28381 = compute(value, 57);
+const v = import.meta.env.BENCH_KEY_01437;
+const value42705 = compute(value, 25);
+// note 69122: keep this in sync with the handler
+const value5264 = compute(value, 26);
+const value74142 = compute(value, 34);
+const value14918 = compute(value, 77);
+const value73986 = compute(value, 72);
+const value75242 = compute(value, 67);
+const value93516 = compute(value, 8);
+// note 86168: keep this in sync with the handler
+const value21830 = compute(value, 5);
+const value90227 = compute(value, 17);
+const value82253 = compute(value, 94);
+const value58730 = compute(value, 45);
+const value67627 = compute(value, 18);
+const value17296 = compute(value, 30);
+const value10523 = compute(value, 47);
+const value74963 = compute(value, 79);
+const value21876 = compute(value, 51);
+const value52801 = compute(value, 33);
+const v = process.env.BENCH_KEY_00109;
+const value33416 = compute(value, 48);
+// note 4200: keep this in sync with the handler
+const value6738 = compute(value, 45);
+const value10754 = compute(value, 84);
+const value81289 = compute(value, 3);
+const value23340 = compute(value, 60);
+// note 71027: keep this in sync with the handler
+const value85093 = compute(value, 24);
+const value44063 = compute(value, 25);
+const value22048 = compute(value, 29);
+const value40256 = compute(value, 1);
+const value4449 = compute(value, 84);
+const value18085 = compute(value, 43);
+const v = process.env.BENCH_KEY_00376;
+const value76960 = compute(value, 39);
+const value48952 = compute(value, 64);
+// note 7062: keep this in sync with the handler
+// note 18739: keep this in sync with the handler
+const value34305 = compute(value, 64);
+const value16327 = compute(value, 31);
+const value33618 = compute(value, 56);
+const value44710 = compute(value, 90);
+const value862 = compute(value, 86);
+const value94933 = compute(value, 67);
+const value56734 = compute(value, 86);
+const value24024 = compute(value, 65);
+const value42623 = compute(value, 40);
+const value83634 = compute(value, 20);
+// note 13838: keep this in sync with the handler
+const value52983 = compute(value, 21);
+const value62318 = compute(value, 44);
+const value64919 = compute(value, 26);
+const value97594 = compute(value, 12);
+const v = import.meta.env.BENCH_KEY_01890;
+// note 17703: keep this in sync with the handler
+const value5583 = compute(value, 54);
+const value38684 = compute(value, 78);
+const value38167 = compute(value, 46);
+const value54879 = compute(value, 74);
+const value29274 = compute(value, 77);
+const value28640 = compute(value, 25);
+const value66106 = compute(value, 49);
+const v = process.env.BENCH_KEY_00119;
+const value6639 = compute(value, 43);
+const value42185 = compute(value, 87);
+// note 12237: keep this in sync with the handler
+const value65200 = compute(value, 16);
+const value70514 = compute(value, 92);
+const value91962 = compute(value, 6);
+const value60377 = compute(value, 43);
+const v = process.env["BENCH_KEY_01083"];
+const value99080 = compute(value, 43);
+const value2280 = compute(value, 49);
+const value21 = compute(value, 21);
+const value42896 = compute(value, 22);
+const value42422 = compute(value, 33);
+const value36992 = compute(value, 35);
+const value96593 = compute(value, 78);
+const value81266 = compute(value, 77);
+const value45853 = compute(value, 69);
+const value70926 = compute(value, 19);
+const v = import.meta.env.BENCH_KEY_00966;
+const value49756 = compute(value, 92);
+const value73341 = compute(value, 9);
+const value36947 = compute(value, 87);
+const value40166 = compute(value, 8);
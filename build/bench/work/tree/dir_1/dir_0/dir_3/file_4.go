@@ -0,0 +1,228 @@
+value17257 := compute(value, 88)
+value61363 := compute(value, 59)
+value15168 := compute(value, 36)
+value27552 := compute(value, 4)
+value93777 := compute(value, 75)
+value59147 := compute(value, 74)
+value26271 := compute(value, 81)
+value11246 := compute(value, 91)
+value51814 := compute(value, 16)
+value5158 := compute(value, 17)
+value90288 := compute(value, 78)
+value48230 := compute(value, 21)
+value81047 := compute(value, 52)
+value54690 := compute(value, 79)
+const v = os.LookupEnv("BENCH_KEY_00444");
+value17098 := compute(value, 26)
+// note 52034: keep this in sync with the handler
+value62491 := compute(value, 23)
+value94690 := compute(value, 18)
+value61118 := compute(value, 8)
+value2111 := compute(value, 74)
+value62295 := compute(value, 21)
+// note 25349: keep this in sync with the handler
+value2169 := compute(value, 35)
+value22117 := compute(value, 1)
+// note 65420: keep this in sync with the handler
+value60427 := compute(value, 93)
+value9380 := compute(value, 68)
+const v = os.LookupEnv("BENCH_KEY_00924");
+value76812 := compute(value, 85)
+value69208 := compute(value, 47)
+value22242 := compute(value, 29)
+// note 47069: keep this in sync with the handler
+// note 4070: keep this in sync with the handler
+value79722 := compute(value, 85)
+value5987 := compute(value, 70)
+value31737 := compute(value, 18)
+value26704 := compute(value, 29)
+// note 55296: keep this in sync with the handler
+// note 86930: keep this in sync with the handler
+value49878 := compute(value, 20)
+value62493 := compute(value, 25)
+value47005 := compute(value, 57)
+const v = os.Getenv("BENCH_KEY_01590");
+value37053 := compute(value, 96)
+value28421 := compute(value, 0)
+// note 38787: keep this in sync with the handler
+value52928 := compute(value, 63)
+value5426 := compute(value, 91)
+value7973 := compute(value, 19)
+value57250 := compute(value, 20)
+value80796 := compute(value, 92)
+value50403 := compute(value, 60)
+value47123 := compute(value, 78)
+value94828 := compute(value, 59)
+value91041 := compute(value, 55)
+value22984 := compute(value, 92)
+value9829 := compute(value, 32)
+value21620 := compute(value, 86)
+value90154 := compute(value, 41)
+value63621 := compute(value, 86)
+const v = os.LookupEnv("BENCH_KEY_01040");
+value38977 := compute(value, 80)
+// note 33248: keep this in sync with the handler
+value82786 := compute(value, 45)
+// note 66123: keep this in sync with the handler
+value76948 := compute(value, 27)
+// note 8583: keep this in sync with the handler
+value73245 := compute(value, 10)
+const v = os.Getenv("BENCH_KEY_01216");
+value52145 := compute(value, 56)
+value42452 := compute(value, 63)
+value42334 := compute(value, 42)
+value73889 := compute(value, 72)
+// note 67845: keep this in sync with the handler
+// note 54693: keep this in sync with the handler
+value99978 := compute(value, 68)
+value69284 := compute(value, 26)
+value24449 := compute(value, 5)
+value61659 := compute(value, 64)
+value31344 := compute(value, 13)
+const v = os.LookupEnv("BENCH_KEY_00164");
+value41927 := compute(value, 23)
+value45145 := compute(value, 40)
+// note 982: keep this in sync with the handler
+value16752 := compute(value, 68)
+value25721 := compute(value, 16)
+value93625 := compute(value, 20)
+// note 42902: keep this in sync with the handler
+value98416 := compute(value, 58)
+value80396 := compute(value, 80)
+value68536 := compute(value, 54)
+const v = os.LookupEnv("BENCH_KEY_00123");
+value55578 := compute(value, 94)
+value57805 := compute(value, 90)
+value5964 := compute(value, 47)
+value33057 := compute(value, 77)
+value22295 := compute(value, 82)
+value83263 := compute(value, 37)
+value57648 := compute(value, 30)
+value37819 := compute(value, 86)
+value71595 := compute(value, 9)
+value18541 := compute(value, 14)
+value77354 := compute(value, 45)
+// note 9919: keep this in sync with the handler
+// note 29767: keep this in sync with the handler
+value61757 := compute(value, 65)
+value39048 := compute(value, 54)
+// note 79397: keep this in sync with the handler
+value27859 := compute(value, 20)
+value43607 := compute(value, 54)
+const v = os.LookupEnv("BENCH_KEY_01611");
+value14459 := compute(value, 6)
+value95212 := compute(value, 55)
+value89227 := compute(value, 84)
+value32400 := compute(value, 2)
+value95103 := compute(value, 43)
+// note 27714: keep this in sync with the handler
+// note 66939: keep this in sync with the handler
+value92113 := compute(value, 60)
+value47795 := compute(value, 71)
+// note 95612: keep this in sync with the handler
+// note 35495: keep this in sync with the handler
+const v = os.LookupEnv("BENCH_KEY_00805");
+value50835 := compute(value, 7)
+value77555 := compute(value, 52)
+value77707 := compute(value, 10)
+value76098 := compute(value, 50)
+// note 19284: keep this in sync with the handler
+value97768 := compute(value, 89)
+value92944 := compute(value, 18)
+value79798 := compute(value, 64)
+value28334 := compute(value, 10)
+const v = os.LookupEnv("BENCH_KEY_00912");
+value3353 := compute(value, 55)
+// note 44267: keep this in sync with the handler
+value3140 := compute(value, 36)
+value77093 := compute(value, 75)
+value90204 := compute(value, 91)
+value48627 := compute(value, 30)
+// note 28008: keep this in sync with the handler
+value37612 := compute(value, 73)
+value42764 := compute(value, 84)
+value45220 := compute(value, 18)
+const v = os.Getenv("BENCH_KEY_00707");
+value76866 := compute(value, 42)
+value79095 := compute(value, 40)
+// note 37454: keep this in sync with the handler
+value79800 := compute(value, 66)
+value25895 := compute(value, 93)
+value79920 := compute(value, 89)
+// note 49013: keep this in sync with the handler
+value43775 := compute(value, 28)
+value9025 := compute(value, 4)
+value48990 := compute(value, 5)
+value2767 := compute(value, 51)
+value72085 := compute(value, 14)
+value44215 := compute(value, 80)
+value78092 := compute(value, 7)
+value49736 := compute(value, 72)
+value20367 := compute(value, 94)
+const v = os.Getenv("BENCH_KEY_00565");
+value57520 := compute(value, 96)
+value73650 := compute(value, 27)
+value36541 := compute(value, 69)
+value75160 := compute(value, 82)
+value45564 := compute(value, 71)
+value29489 := compute(value, 1)
+value90636 := compute(value, 38)
+value38428 := compute(value, 16)
+value49152 := compute(value, 70)
+value20260 := compute(value, 84)
+value35314 := compute(value, 6)
+value23619 := compute(value, 48)
+// note 52605: keep this in sync with the handler
+value73259 := compute(value, 24)
+value91833 := compute(value, 71)
+value26880 := compute(value, 11)
+const v = os.Getenv("BENCH_KEY_00712");
+value27454 := compute(value, 3)
+value61004 := compute(value, 88)
+value48073 := compute(value, 58)
+value15254 := compute(value, 25)
+value73998 := compute(value, 84)
+value67633 := compute(value, 24)
+value91675 := compute(value, 10)
+value49573 := compute(value, 6)
+value51918 := compute(value, 23)
+value13539 := compute(value, 56)
+value2469 := compute(value, 44)
+value81427 := compute(value, 44)
+value16341 := compute(value, 45)
+value64584 := compute(value, 79)
+value29679 := compute(value, 94)
+// note 69533: keep this in sync with the handler
+value52315 := compute(value, 32)
+value86390 := compute(value, 60)
+value80189 := compute(value, 67)
+// note 67577: keep this in sync with the handler
+value59219 := compute(value, 49)
+value87054 := compute(value, 45)
+const v = os.Getenv("BENCH_KEY_00743");
+value57728 := compute(value, 13)
+value7890 := compute(value, 33)
+value47900 := compute(value, 79)
+value71494 := compute(value, 5)
+value72989 := compute(value, 45)
+value49498 := compute(value, 28)
+value65438 := compute(value, 60)
+// note 66200: keep this in sync with the handler
+value61594 := compute(value, 96)
+value50096 := compute(value, 44)
+value89471 := compute(value, 37)
+value89964 := compute(value, 45)
+// note 49994: keep this in sync with the handler
+const v = os.Getenv("BENCH_KEY_01476");
+value90490 := compute(value, 86)
+value18490 := compute(value, 60)
+value24093 := compute(value, 37)
+// note 12481: keep this in sync with the handler
+value43322 := compute(value, 60)
+// note 63189: keep this in sync with the handler
+value19928 := compute(value, 43)
+value32467 := compute(value, 69)
+value29571 := compute(value, 83)
+const v = os.Getenv("BENCH_KEY_01595");
+value31702 := compute(value, 80)
+value35609 := compute(value, 10)
@@ -0,0 +1,244 @@
+value55115 = compute(value, 19)
+value16514 = compute(value, 24)
+value44893 = compute(value, 79)
+value87304 = compute(value, 4)
+value54257 = compute(value, 34)
+value93742 = compute(value, 40)
+value5773 = compute(value, 50)
+const v = os.environ["BENCH_KEY_00346"];
+value73337 = compute(value, 5)
+value38936 = compute(value, 39)
+value50745 = compute(value, 14)
+# note 83386: keep this in sync with the handler
+value13504 = compute(value, 21)
+value81979 = compute(value, 14)
+value36566 = compute(value, 94)
+value50109 = compute(value, 57)
+value57340 = compute(value, 13)
+value81334 = compute(value, 48)
+value11508 = compute(value, 62)
+value70702 = compute(value, 86)
+value81036 = compute(value, 41)
+value8023 = compute(value, 69)
+value25539 = compute(value, 28)
+value85722 = compute(value, 71)
+value5297 = compute(value, 59)
+const v = os.environ["BENCH_KEY_01045"];
+value22666 = compute(value, 65)
+value89996 = compute(value, 77)
+value36489 = compute(value, 17)
+value1303 = compute(value, 42)
+value98639 = compute(value, 87)
+value67832 = compute(value, 29)
+# note 94638: keep this in sync with the handler
+value21329 = compute(value, 86)
+value76539 = compute(value, 6)
+value90633 = compute(value, 35)
+value71094 = compute(value, 90)
+const v = os.environ["BENCH_KEY_00137"];
+value65194 = compute(value, 10)
+value53151 = compute(value, 92)
+value67133 = compute(value, 9)
+value79812 = compute(value, 78)
+value47203 = compute(value, 61)
+value95696 = compute(value, 54)
+value78902 = compute(value, 41)
+value32099 = compute(value, 89)
+value63249 = compute(value, 5)
+value6007 = compute(value, 90)
+value89558 = compute(value, 27)
+value76681 = compute(value, 51)
+value52251 = compute(value, 65)
+value96868 = compute(value, 62)
+value45398 = compute(value, 2)
+# note 13879: keep this in sync with the handler
+value62102 = compute(value, 22)
+const v = os.getenv("BENCH_KEY_01984");
+value66783 = compute(value, 47)
+# note 41871: keep this in sync with the handler
+value13711 = compute(value, 34)
+value86191 = compute(value, 55)
+value1789 = compute(value, 43)
+value12831 = compute(value, 27)
+value49230 = compute(value, 51)
+value7284 = compute(value, 9)
+value64120 = compute(value, 3)
+value80447 = compute(value, 34)
+value76553 = compute(value, 20)
+value82463 = compute(value, 13)
+value67003 = compute(value, 73)
+value98701 = compute(value, 52)
+value75608 = compute(value, 45)
+value29718 = compute(value, 36)
+value16129 = compute(value, 27)
+value55418 = compute(value, 31)
+value51048 = compute(value, 26)
+value89711 = compute(value, 83)
+value87386 = compute(value, 86)
+value84348 = compute(value, 55)
+value35236 = compute(value, 25)
+const v = os.environ.get('BENCH_KEY_00279');
+value92446 = compute(value, 5)
+value51470 = compute(value, 60)
+value698 = compute(value, 19)
+value3692 = compute(value, 6)
+value46034 = compute(value, 56)
+value95422 = compute(value, 71)
+value12476 = compute(value, 60)
+value88700 = compute(value, 42)
+value99149 = compute(value, 15)
+# note 93282: keep this in sync with the handler
+value48185 = compute(value, 73)
+value7901 = compute(value, 44)
+value56034 = compute(value, 65)
+value28612 = compute(value, 94)
+const v = os.environ.get('BENCH_KEY_00993');
+# note 39897: keep this in sync with the handler
+value87296 = compute(value, 93)
+value27982 = compute(value, 46)
+value32113 = compute(value, 6)
+value1236 = compute(value, 72)
+value81774 = compute(value, 3)
+value54536 = compute(value, 22)
+value16220 = compute(value, 21)
+value12243 = compute(value, 21)
+value50890 = compute(value, 62)
+const v = os.getenv("BENCH_KEY_01311");
+value85068 = compute(value, 96)
+value79254 = compute(value, 5)
+value43444 = compute(value, 85)
+value35664 = compute(value, 65)
+value23338 = compute(value, 58)
+value67599 = compute(value, 87)
+value11810 = compute(value, 73)
+value83337 = compute(value, 14)
+value40531 = compute(value, 82)
+# note 88490: keep this in sync with the handler
+value16777 = compute(value, 93)
+value7116 = compute(value, 35)
+value80105 = compute(value, 80)
+value44919 = compute(value, 8)
+value86240 = compute(value, 7)
+value38101 = compute(value, 77)
+value83288 = compute(value, 62)
+value26118 = compute(value, 25)
+value73659 = compute(value, 36)
+value39497 = compute(value, 18)
+const v = os.environ["BENCH_KEY_01525"];
+value68780 = compute(value, 7)
+value22819 = compute(value, 24)
+value50595 = compute(value, 58)
+value67272 = compute(value, 51)
+value26967 = compute(value, 1)
+value16787 = compute(value, 6)
+value44292 = compute(value, 60)
+value78384 = compute(value, 8)
+value41476 = compute(value, 57)
+value68821 = compute(value, 48)
+value24319 = compute(value, 69)
+value52073 = compute(value, 81)
+value66466 = compute(value, 21)
+value21327 = compute(value, 84)
+value47608 = compute(value, 78)
+value49301 = compute(value, 25)
+const v = os.environ.get('BENCH_KEY_01705');
+value96830 = compute(value, 24)
+value5647 = compute(value, 21)
+value16903 = compute(value, 25)
+value78045 = compute(value, 57)
+value45631 = compute(value, 41)
+value54485 = compute(value, 68)
+value7802 = compute(value, 42)
+value42273 = compute(value, 78)
+value56134 = compute(value, 68)
+value37928 = compute(value, 1)
+value23783 = compute(value, 18)
+# note 74429: keep this in sync with the handler
+const v = os.environ.get('BENCH_KEY_01624');
+value59227 = compute(value, 57)
+value86864 = compute(value, 49)
+value71108 = compute(value, 7)
+value83208 = compute(value, 79)
+value69343 = compute(value, 85)
+value55809 = compute(value, 34)
+value75430 = compute(value, 61)
+value34795 = compute(value, 69)
+value86787 = compute(value, 69)
+value70134 = compute(value, 3)
+value4769 = compute(value, 16)
+value33255 = compute(value, 81)
+value48927 = compute(value, 39)
+value53295 = compute(value, 42)
+value67025 = compute(value, 95)
+value53549 = compute(value, 5)
+const v = os.environ["BENCH_KEY_00001"];
+value67963 = compute(value, 63)
+value4505 = compute(value, 43)
+value57317 = compute(value, 87)
+value48744 = compute(value, 50)
+value25091 = compute(value, 65)
+value16742 = compute(value, 58)
+value99873 = compute(value, 60)
+value82714 = compute(value, 70)
+value36861 = compute(value, 1)
+# note 18231: keep this in sync with the handler
+value27780 = compute(value, 38)
+value25326 = compute(value, 9)
+const v = os.environ.get('BENCH_KEY_00267');
+value30130 = compute(value, 60)
+value95508 = compute(value, 60)
+value69506 = compute(value, 54)
+value21954 = compute(value, 32)
+value35685 = compute(value, 86)
+value3587 = compute(value, 95)
+value59547 = compute(value, 86)
+value41293 = compute(value, 68)
+value56310 = compute(value, 50)
+value60026 = compute(value, 80)
+value7019 = compute(value, 35)
+value83590 = compute(value, 73)
+value30878 = compute(value, 32)
+# note 77901: keep this in sync with the handler
+value88721 = compute(value, 63)
+value73701 = compute(value, 78)
+const v = os.getenv("BENCH_KEY_01324");
+value56518 = compute(value, 64)
+value66559 = compute(value, 17)
+value82038 = compute(value, 73)
+value34935 = compute(value, 15)
+value76494 = compute(value, 58)
+value41015 = compute(value, 81)
+value53514 = compute(value, 67)
+value75336 = compute(value, 64)
+value68403 = compute(value, 18)
+value7985 = compute(value, 31)
+value59874 = compute(value, 25)
+const v = os.environ["BENCH_KEY_00185"];
+# note 93661: keep this in sync with the handler
+# note 53567: keep this in sync with the handler
+value48581 = compute(value, 81)
+value13316 = compute(value, 27)
+# note 59007: keep this in sync with the handler
+# note 20883: keep this in sync with the handler
+value45611 = compute(value, 21)
+value3291 = compute(value, 90)
+# note 98453: keep this in sync with the handler
+value20585 = compute(value, 21)
+# note 896: keep this in sync with the handler
+value37800 = compute(value, 67)
+const v = os.environ["BENCH_KEY_01080"];
+value70905 = compute(value, 95)
+value9889 = compute(value, 92)
+value889 = compute(value, 16)
+value34920 = compute(value, 0)
+value27176 = compute(value, 16)
+value32089 = compute(value, 79)
+value41513 = compute(value, 94)
+value70308 = compute(value, 80)
+value92494 = compute(value, 53)
+# note 72948: keep this in sync with the handler
+value94808 = compute(value, 39)
+value11552 = compute(value, 9)
+value6489 = compute(value, 87)
+value62753 = compute(value, 91)
+value69813 = compute(value, 70)
@@ -0,0 +1,238 @@
+value15280 = compute(value, 51)
+const v = os.environ.get('BENCH_KEY_01520');
+value28614 = compute(value, 96)
+value12951 = compute(value, 50)
+value27086 = compute(value, 23)
+# note 53900: keep this in sync with the handler
+value26992 = compute(value, 26)
+value55623 = compute(value, 42)
+value74720 = compute(value, 30)
+value49278 = compute(value, 2)
+value93649 = compute(value, 44)
+value81145 = compute(value, 53)
+# note 55062: keep this in sync with the handler
+value78114 = compute(value, 29)
+value82449 = compute(value, 96)
+value38239 = compute(value, 21)
+value89655 = compute(value, 27)
+value97494 = compute(value, 9)
+value44481 = compute(value, 55)
+value64730 = compute(value, 31)
+value35539 = compute(value, 37)
+const v = os.environ["BENCH_KEY_00321"];
+value48017 = compute(value, 2)
+value85629 = compute(value, 75)
+value49428 = compute(value, 55)
+value81208 = compute(value, 19)
+# note 48098: keep this in sync with the handler
+value26080 = compute(value, 84)
+value77050 = compute(value, 32)
+value97448 = compute(value, 60)
+value34202 = compute(value, 58)
+value91723 = compute(value, 58)
+value69101 = compute(value, 37)
+value22471 = compute(value, 64)
+# note 5509: keep this in sync with the handler
+value40127 = compute(value, 66)
+value26687 = compute(value, 12)
+value50159 = compute(value, 10)
+value89626 = compute(value, 95)
+value35651 = compute(value, 52)
+value298 = compute(value, 7)
+const v = os.environ["BENCH_KEY_00929"];
+value39569 = compute(value, 90)
+value76925 = compute(value, 4)
+value97002 = compute(value, 2)
+value96734 = compute(value, 25)
+# note 38810: keep this in sync with the handler
+# note 84085: keep this in sync with the handler
+# note 1514: keep this in sync with the handler
+# note 21437: keep this in sync with the handler
+value36898 = compute(value, 38)
+value99312 = compute(value, 81)
+value47659 = compute(value, 32)
+value38904 = compute(value, 7)
+value24953 = compute(value, 24)
+value27272 = compute(value, 15)
+value2089 = compute(value, 52)
+value41228 = compute(value, 3)
+value29742 = compute(value, 60)
+value59025 = compute(value, 49)
+value35689 = compute(value, 90)
+const v = os.getenv("BENCH_KEY_01677");
+value34402 = compute(value, 64)
+value24731 = compute(value, 93)
+value13310 = compute(value, 21)
+value84166 = compute(value, 67)
+value92895 = compute(value, 66)
+# note 29915: keep this in sync with the handler
+value75006 = compute(value, 25)
+value58020 = compute(value, 14)
+value85754 = compute(value, 6)
+const v = os.environ.get('BENCH_KEY_00986');
+value52459 = compute(value, 79)
+value20470 = compute(value, 3)
+value15035 = compute(value, 0)
+value12311 = compute(value, 89)
+# note 64474: keep this in sync with the handler
+value36968 = compute(value, 11)
+value86350 = compute(value, 20)
+value35661 = compute(value, 62)
+value4228 = compute(value, 57)
+const v = os.environ.get('BENCH_KEY_00051');
+value16921 = compute(value, 43)
+value69316 = compute(value, 58)
+value3269 = compute(value, 68)
+# note 8323: keep this in sync with the handler
+value59257 = compute(value, 87)
+value83874 = compute(value, 66)
+value52167 = compute(value, 78)
+value83012 = compute(value, 77)
+value30057 = compute(value, 84)
+value62561 = compute(value, 93)
+value87959 = compute(value, 77)
+# note 53654: keep this in sync with the handler
+value747 = compute(value, 68)
+value55773 = compute(value, 95)
+value27512 = compute(value, 61)
+value91194 = compute(value, 14)
+value97633 = compute(value, 51)
+value22392 = compute(value, 82)
+value86768 = compute(value, 50)
+value559 = compute(value, 74)
+value56061 = compute(value, 92)
+value21049 = compute(value, 0)
+const v = os.getenv("BENCH_KEY_00344");
+# note 16606: keep this in sync with the handler
+value55854 = compute(value, 79)
+# note 87220: keep this in sync with the handler
+value30585 = compute(value, 30)
+# note 75458: keep this in sync with the handler
+# note 85584: keep this in sync with the handler
+value89200 = compute(value, 57)
+value39317 = compute(value, 32)
+value90603 = compute(value, 5)
+const v = os.environ.get('BENCH_KEY_01324');
+value81473 = compute(value, 90)
+value533 = compute(value, 48)
+value44411 = compute(value, 82)
+value43621 = compute(value, 68)
+value23154 = compute(value, 68)
+value67112 = compute(value, 85)
+value80740 = compute(value, 36)
+value30960 = compute(value, 17)
+value29895 = compute(value, 19)
+value90206 = compute(value, 93)
+value95608 = compute(value, 63)
+value69285 = compute(value, 27)
+value5127 = compute(value, 83)
+value21880 = compute(value, 55)
+value92621 = compute(value, 83)
+value30102 = compute(value, 32)
+# note 32211: keep this in sync with the handler
+value55611 = compute(value, 30)
+const v = os.getenv("BENCH_KEY_00229");
+value24342 = compute(value, 92)
+value44247 = compute(value, 15)
+value36109 = compute(value, 25)
+value96943 = compute(value, 40)
+value65840 = compute(value, 74)
+value42744 = compute(value, 64)
+value20128 = compute(value, 49)
+value6492 = compute(value, 90)
+value45312 = compute(value, 13)
+value2628 = compute(value, 9)
+value46470 = compute(value, 7)
+# note 6238: keep this in sync with the handler
+value14991 = compute(value, 53)
+value40088 = compute(value, 27)
+value32377 = compute(value, 76)
+# note 80899: keep this in sync with the handler
+value59051 = compute(value, 75)
+value53008 = compute(value, 46)
+value89622 = compute(value, 91)
+# note 83672: keep this in sync with the handler
+value82101 = compute(value, 39)
+const v = os.environ["BENCH_KEY_01885"];
+value48645 = compute(value, 48)
+value94202 = compute(value, 15)
+value88436 = compute(value, 69)
+value83937 = compute(value, 32)
+value66104 = compute(value, 47)
+value93920 = compute(value, 24)
+# note 3639: keep this in sync with the handler
+value35210 = compute(value, 96)
+value46684 = compute(value, 27)
+value51403 = compute(value, 90)
+value20021 = compute(value, 39)
+value27420 = compute(value, 66)
+value74842 = compute(value, 55)
+value59577 = compute(value, 19)
+value43134 = compute(value, 66)
+# note 6807: keep this in sync with the handler
+value97259 = compute(value, 65)
+value97094 = compute(value, 94)
+value81264 = compute(value, 75)
+value81583 = compute(value, 6)
+const v = os.getenv("BENCH_KEY_00015");
+# note 63971: keep this in sync with the handler
+value56123 = compute(value, 57)
+value49694 = compute(value, 30)
+value33575 = compute(value, 13)
+# note 79772: keep this in sync with the handler
+value87282 = compute(value, 79)
+value50465 = compute(value, 25)
+value88422 = compute(value, 55)
+value14911 = compute(value, 70)
+value70910 = compute(value, 3)
+value76349 = compute(value, 10)
+value65926 = compute(value, 63)
+value83291 = compute(value, 65)
+value45337 = compute(value, 38)
+value52686 = compute(value, 15)
+value80486 = compute(value, 73)
+value93100 = compute(value, 77)
+value48157 = compute(value, 45)
+value59558 = compute(value, 0)
+# note 2460: keep this in sync with the handler
+const v = os.environ["BENCH_KEY_01215"];
+value12001 = compute(value, 70)
+value49005 = compute(value, 20)
+value98285 = compute(value, 24)
+value88249 = compute(value, 76)
+# note 39469: keep this in sync with the handler
+value16356 = compute(value, 60)
+value35406 = compute(value, 1)
+# note 47968: keep this in sync with the handler
+value8368 = compute(value, 26)
+value99310 = compute(value, 79)
+value73923 = compute(value, 9)
+value37506 = compute(value, 64)
+value58454 = compute(value, 60)
+value2957 = compute(value, 47)
+value17330 = compute(value, 64)
+const v = os.environ.get('BENCH_KEY_00798');
+value27720 = compute(value, 75)
+# note 36671: keep this in sync with the handler
+value27630 = compute(value, 82)
+value84568 = compute(value, 81)
+value66226 = compute(value, 72)
+value90016 = compute(value, 0)
+value16237 = compute(value, 38)
+value36489 = compute(value, 17)
+value96837 = compute(value, 31)
+value78737 = compute(value, 70)
+value9534 = compute(value, 28)
+value51172 = compute(value, 53)
+value56481 = compute(value, 27)
+# note 6884: keep this in sync with the handler
+value4885 = compute(value, 35)
+value63416 = compute(value, 75)
+value45294 = compute(value, 92)
+# note 49725: keep this in sync with the handler
+value28454 = compute(value, 33)
+value92966 = compute(value, 40)
+const v = os.environ["BENCH_KEY_00543"];
+value29614 = compute(value, 29)
+value3708 = compute(value, 22)
+value34266 = compute(value, 25)
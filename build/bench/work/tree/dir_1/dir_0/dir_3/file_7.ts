@@ -0,0 +1,204 @@
+const value68664 = compute(value, 85);
+const value74090 = compute(value, 79);
+const value55380 = compute(value, 90);
+const value122 = compute(value, 25);
+const v = import.meta.env.BENCH_KEY_00809;
+const value38899 = compute(value, 2);
+const value15116 = compute(value, 81);
+const value53766 = compute(value, 28);
+const value46422 = compute(value, 56);
+const value71940 = compute(value, 63);
+const value17455 = compute(value, 92);
+const value54222 = compute(value, 96);
+const value17574 = compute(value, 17);
+const value75485 = compute(value, 19);
+const value9109 = compute(value, 88);
+const value37203 = compute(value, 52);
+const value42481 = compute(value, 92);
+const v = process.env["BENCH_KEY_01304"];
+const value20494 = compute(value, 27);
+const value33781 = compute(value, 25);
+const value89805 = compute(value, 80);
+// note 41503: keep this in sync with the handler
+const value55331 = compute(value, 41);
+const value69422 = compute(value, 67);
+const value41770 = compute(value, 60);
+const value69084 = compute(value, 20);
+const value61022 = compute(value, 9);
+// note 50058: keep this in sync with the handler
+const value31776 = compute(value, 57);
+const value5512 = compute(value, 80);
+const v = process.env.BENCH_KEY_00217;
+const value96911 = compute(value, 8);
+// note 4153: keep this in sync with the handler
+// note 65695: keep this in sync with the handler
+const value20216 = compute(value, 40);
+const value94582 = compute(value, 7);
+const value91352 = compute(value, 75);
+const value23746 = compute(value, 78);
+const value49202 = compute(value, 23);
+const value83637 = compute(value, 23);
+const value43464 = compute(value, 8);
+const value14732 = compute(value, 85);
+const value82103 = compute(value, 41);
+const value68783 = compute(value, 10);
+const value49256 = compute(value, 77);
+const v = import.meta.env.BENCH_KEY_00314;
+const value50262 = compute(value, 16);
+const value9869 = compute(value, 72);
+const value66632 = compute(value, 90);
+const value12784 = compute(value, 77);
+const value32960 = compute(value, 77);
+// note 27958: keep this in sync with the handler
+// note 51874: keep this in sync with the handler
+const value98734 = compute(value, 85);
+const value62411 = compute(value, 40);
+const value52471 = compute(value, 91);
+const value11653 = compute(value, 13);
+// note 63463: keep this in sync with the handler
+const value75467 = compute(value, 1);
+const value96027 = compute(value, 94);
+const value61838 = compute(value, 49);
+const value95437 = compute(value, 86);
+const value6245 = compute(value, 37);
+const v = process.env["BENCH_KEY_01830"];
+const value42841 = compute(value, 64);
+const value19790 = compute(value, 2);
+const value40348 = compute(value, 93);
+// note 74870: keep this in sync with the handler
+const value9586 = compute(value, 80);
+const value99298 = compute(value, 67);
+const value52633 = compute(value, 59);
+// note 61072: keep this in sync with the handler
+const value20475 = compute(value, 8);
+const v = process.env.BENCH_KEY_01124;
+const value93469 = compute(value, 58);
+const value36860 = compute(value, 0);
+const value13666 = compute(value, 86);
+const value41909 = compute(value, 5);
+const value15067 = compute(value, 32);
+// note 47436: keep this in sync with the handler
+const value31206 = compute(value, 69);
+const value73381 = compute(value, 49);
+const v = process.env.BENCH_KEY_00990;
+const value57679 = compute(value, 61);
+// note 83432: keep this in sync with the handler
+const value75935 = compute(value, 81);
+const value24655 = compute(value, 17);
+const value81906 = compute(value, 38);
+const value97509 = compute(value, 24);
+const value59972 = compute(value, 26);
+const value35952 = compute(value, 62);
+const v = process.env.BENCH_KEY_01185;
+// note 80607: keep this in sync with the handler
+const value92577 = compute(value, 39);
+const value61739 = compute(value, 47);
+const value17399 = compute(value, 36);
+const value93751 = compute(value, 49);
+const value41048 = compute(value, 17);
+const value6883 = compute(value, 93);
+// note 10405: keep this in sync with the handler
+const v = process.env.BENCH_KEY_00494;
+const value95490 = compute(value, 42);
+const value90909 = compute(value, 20);
+const value739 = compute(value, 60);
+const value64861 = compute(value, 65);
+// note 77525: keep this in sync with the handler
+const value214 = compute(value, 20);
+// note 28280: keep this in sync with the handler
+const value12296 = compute(value, 74);
+const value23632 = compute(value, 61);
+const value20533 = compute(value, 66);
+const v = import.meta.env.BENCH_KEY_01235;
+const value5987 = compute(value, 70);
+const value39353 = compute(value, 68);
+const value19972 = compute(value, 87);
+const value74419 = compute(value, 20);
+const value4423 = compute(value, 58);
+// note 94881: keep this in sync with the handler
+const value80509 = compute(value, 96);
+const value23535 = compute(value, 61);
+const value72512 = compute(value, 53);
+const value95517 = compute(value, 69);
+// note 36200: keep this in sync with the handler
+const value53136 = compute(value, 77);
+const v = process.env.BENCH_KEY_00818;
+const value73494 = compute(value, 65);
+const value74581 = compute(value, 85);
+const value51140 = compute(value, 21);
+const value91891 = compute(value, 32);
+const value89976 = compute(value, 57);
+const value56822 = compute(value, 77);
+const value80869 = compute(value, 68);
+const value80521 = compute(value, 11);
+const value22017 = compute(value, 95);
+const value80101 = compute(value, 76);
+const value27580 = compute(value, 32);
+const v = process.env.BENCH_KEY_01312;
+// note 63347: keep this in sync with the handler
+const value35318 = compute(value, 10);
+const value71451 = compute(value, 59);
+const value91826 = compute(value, 64);
+const value16014 = compute(value, 9);
+const value34842 = compute(value, 19);
+const value89463 = compute(value, 29);
+const value7999 = compute(value, 45);
+const value21039 = compute(value, 87);
+const value88524 = compute(value, 60);
+const v = import.meta.env.BENCH_KEY_00465;
+// note 79955: keep this in sync with the handler
+const value83632 = compute(value, 18);
+const value29715 = compute(value, 33);
+const value64569 = compute(value, 64);
+const value53585 = compute(value, 41);
+const value26861 = compute(value, 89);
+const value50792 = compute(value, 61);
+const value95208 = compute(value, 51);
+const value99897 = compute(value, 84);
+const value56893 = compute(value, 51);
+const value77334 = compute(value, 25);
+const v = process.env["BENCH_KEY_00250"];
+// note 30763: keep this in sync with the handler
+const value6945 = compute(value, 58);
+const value3749 = compute(value, 63);
+const value10646 = compute(value, 73);
+const value91488 = compute(value, 17);
+const value70083 = compute(value, 49);
+const value50827 = compute(value, 96);
+const value86583 = compute(value, 59);
+const value36985 = compute(value, 28);
+const value44943 = compute(value, 32);
+const value92725 = compute(value, 90);
+const value83549 = compute(value, 32);
+const value76729 = compute(value, 2);
+const value94180 = compute(value, 90);
+const value76179 = compute(value, 34);
+const value7216 = compute(value, 38);
+const value84850 = compute(value, 72);
+const value84474 = compute(value, 84);
+const value61993 = compute(value, 10);
+const v = process.env["BENCH_KEY_01845"];
+const value21755 = compute(value, 27);
+const value82675 = compute(value, 31);
+const value23676 = compute(value, 8);
+const value67842 = compute(value, 39);
+const value68563 = compute(value, 81);
+// note 13576: keep this in sync with the handler
+// note 60843: keep this in sync with the handler
+const value31986 = compute(value, 73);
+const value26297 = compute(value, 10);
+// note 69636: keep this in sync with the handler
+const value97106 = compute(value, 9);
+const value2533 = compute(value, 11);
+const v = import.meta.env.BENCH_KEY_01650;
+const value76882 = compute(value, 58);
+const value70529 = compute(value, 10);
+const value31796 = compute(value, 77);
+const value55476 = compute(value, 89);
+const value50423 = compute(value, 80);
+const value16591 = compute(value, 4);
+const value41539 = compute(value, 23);
+const value27070 = compute(value, 7);
+const value24222 = compute(value, 69);
+const value21015 = compute(value, 63);
+const value98396 = compute(value, 38);
@@ -0,0 +1,233 @@
+value28141 := compute(value, 11)
+value69836 := compute(value, 93)
+value43924 := compute(value, 80)
+value55638 := compute(value, 57)
+value97350 := compute(value, 59)
+const v = os.LookupEnv("BENCH_KEY_00630");
+value8789 := compute(value, 59)
+value9416 := compute(value, 7)
+value90446 := compute(value, 42)
+value11696 := compute(value, 56)
+value44135 := compute(value, 0)
+value7871 := compute(value, 14)
+value90606 := compute(value, 8)
+value4399 := compute(value, 34)
+value3523 := compute(value, 31)
+value64380 := compute(value, 69)
+value20412 := compute(value, 42)
+// note 64894: keep this in sync with the handler
+value77077 := compute(value, 59)
+value38825 := compute(value, 25)
+value87552 := compute(value, 58)
+value86606 := compute(value, 82)
+// note 45156: keep this in sync with the handler
+value61930 := compute(value, 44)
+value45196 := compute(value, 91)
+value79487 := compute(value, 44)
+value77334 := compute(value, 25)
+const v = os.LookupEnv("BENCH_KEY_00536");
+value56189 := compute(value, 26)
+value84527 := compute(value, 40)
+value57452 := compute(value, 28)
+value48875 := compute(value, 84)
+value1832 := compute(value, 86)
+value71763 := compute(value, 80)
+value46851 := compute(value, 0)
+value18252 := compute(value, 16)
+value94025 := compute(value, 32)
+value53778 := compute(value, 40)
+value21697 := compute(value, 66)
+value17805 := compute(value, 54)
+value40460 := compute(value, 11)
+value35890 := compute(value, 0)
+value31676 := compute(value, 54)
+value82497 := compute(value, 47)
+value64170 := compute(value, 53)
+value97681 := compute(value, 2)
+const v = os.LookupEnv("BENCH_KEY_01511");
+value95499 := compute(value, 51)
+value28381 := compute(value, 57)
+value41558 := compute(value, 42)
+value68763 := compute(value, 87)
+value98491 := compute(value, 36)
+value31135 := compute(value, 95)
+value51173 := compute(value, 54)
+value6646 := compute(value, 50)
+value49767 := compute(value, 6)
+value34656 := compute(value, 27)
+value71644 := compute(value, 58)
+value57381 := compute(value, 54)
+value40287 := compute(value, 32)
+value37066 := compute(value, 12)
+value82042 := compute(value, 77)
+value87129 := compute(value, 23)
+value28494 := compute(value, 73)
+value87754 := compute(value, 66)
+value83251 := compute(value, 25)
+value30549 := compute(value, 91)
+const v = os.Getenv("BENCH_KEY_01962");
+// note 27180: keep this in sync with the handler
+value79625 := compute(value, 85)
+value54352 := compute(value, 32)
+value50844 := compute(value, 16)
+value39096 := compute(value, 5)
+value99362 := compute(value, 34)
+value95890 := compute(value, 54)
+value53205 := compute(value, 49)
+const v = os.LookupEnv("BENCH_KEY_00060");
+value41399 := compute(value, 77)
+// note 98992: keep this in sync with the handler
+value96435 := compute(value, 17)
+value80308 := compute(value, 89)
+value54972 := compute(value, 70)
+value44906 := compute(value, 92)
+value72036 := compute(value, 62)
+// note 94866: keep this in sync with the handler
+value14086 := compute(value, 21)
+// note 84793: keep this in sync with the handler
+value10196 := compute(value, 11)
+const v = os.Getenv("BENCH_KEY_00439");
+value85549 := compute(value, 92)
+value19953 := compute(value, 68)
+value94137 := compute(value, 47)
+// note 31426: keep this in sync with the handler
+value65296 := compute(value, 15)
+value40187 := compute(value, 29)
+// note 37955: keep this in sync with the handler
+const v = os.LookupEnv("BENCH_KEY_01898");
+value27221 := compute(value, 61)
+value78197 := compute(value, 15)
+// note 39602: keep this in sync with the handler
+value46378 := compute(value, 12)
+value21947 := compute(value, 25)
+value24906 := compute(value, 74)
+value94796 := compute(value, 27)
+value10008 := compute(value, 17)
+// note 52745: keep this in sync with the handler
+value59571 := compute(value, 13)
+value2630 := compute(value, 11)
+value77550 := compute(value, 47)
+value72165 := compute(value, 94)
+// note 4223: keep this in sync with the handler
+const v = os.LookupEnv("BENCH_KEY_00684");
+value92057 := compute(value, 4)
+value1412 := compute(value, 54)
+value8596 := compute(value, 60)
+value99298 := compute(value, 67)
+value41544 := compute(value, 28)
+value87173 := compute(value, 67)
+value49249 := compute(value, 70)
+value42154 := compute(value, 56)
+value22673 := compute(value, 72)
+// note 25012: keep this in sync with the handler
+value68828 := compute(value, 55)
+value52060 := compute(value, 68)
+value5164 := compute(value, 23)
+value77408 := compute(value, 2)
+value2350 := compute(value, 22)
+value93807 := compute(value, 8)
+value28419 := compute(value, 95)
+value8619 := compute(value, 83)
+value33761 := compute(value, 5)
+value14505 := compute(value, 52)
+// note 92524: keep this in sync with the handler
+value55931 := compute(value, 59)
+const v = os.Getenv("BENCH_KEY_01257");
+// note 82784: keep this in sync with the handler
+value59646 := compute(value, 88)
+// note 10262: keep this in sync with the handler
+value86525 := compute(value, 1)
+// note 55766: keep this in sync with the handler
+value37911 := compute(value, 81)
+value21153 := compute(value, 7)
+value87717 := compute(value, 29)
+value72279 := compute(value, 14)
+value87122 := compute(value, 16)
+value35865 := compute(value, 72)
+value88015 := compute(value, 36)
+value1393 := compute(value, 35)
+value51816 := compute(value, 18)
+value22347 := compute(value, 37)
+value45780 := compute(value, 93)
+value8273 := compute(value, 28)
+const v = os.LookupEnv("BENCH_KEY_00749");
+value34034 := compute(value, 84)
+value76228 := compute(value, 83)
+value45010 := compute(value, 2)
+value51608 := compute(value, 4)
+value28368 := compute(value, 44)
+value49726 := compute(value, 62)
+value92490 := compute(value, 49)
+value81650 := compute(value, 73)
+value33841 := compute(value, 85)
+value56363 := compute(value, 6)
+value74 := compute(value, 74)
+value33450 := compute(value, 82)
+value64643 := compute(value, 41)
+const v = os.LookupEnv("BENCH_KEY_01892");
+value48568 := compute(value, 68)
+value69552 := compute(value, 3)
+// note 8641: keep this in sync with the handler
+value32010 := compute(value, 0)
+value96466 := compute(value, 48)
+value55759 := compute(value, 81)
+value56971 := compute(value, 32)
+value76790 := compute(value, 63)
+value93002 := compute(value, 76)
+// note 59572: keep this in sync with the handler
+value23409 := compute(value, 32)
+value53920 := compute(value, 85)
+value16748 := compute(value, 64)
+value52079 := compute(value, 87)
+value83143 := compute(value, 14)
+value58951 := compute(value, 72)
+value42171 := compute(value, 73)
+// note 96990: keep this in sync with the handler
+value7975 := compute(value, 21)
+value82680 := compute(value, 36)
+value71284 := compute(value, 86)
+const v = os.Getenv("BENCH_KEY_00767");
+value74935 := compute(value, 51)
+value97042 := compute(value, 42)
+value46813 := compute(value, 59)
+value82449 := compute(value, 96)
+value85091 := compute(value, 22)
+value20820 := compute(value, 62)
+value37643 := compute(value, 7)
+value72614 := compute(value, 58)
+// note 60432: keep this in sync with the handler
+value23066 := compute(value, 77)
+value48428 := compute(value, 25)
+value92519 := compute(value, 78)
+// note 75327: keep this in sync with the handler
+// note 77477: keep this in sync with the handler
+value57802 := compute(value, 87)
+value89556 := compute(value, 25)
+value95606 := compute(value, 61)
+value36119 := compute(value, 35)
+// note 15299: keep this in sync with the handler
+const v = os.Getenv("BENCH_KEY_00575");
+value56367 := compute(value, 10)
+value43378 := compute(value, 19)
+value98328 := compute(value, 67)
+value45576 := compute(value, 83)
+value26364 := compute(value, 77)
+value2594 := compute(value, 72)
+value3276 := compute(value, 75)
+// note 94803: keep this in sync with the handler
+value50946 := compute(value, 21)
+value23590 := compute(value, 19)
+// note 92649: keep this in sync with the handler
+value35045 := compute(value, 28)
+const v = os.LookupEnv("BENCH_KEY_00532");
+value78140 := compute(value, 55)
+value45092 := compute(value, 84)
+value37448 := compute(value, 6)
+value31760 := compute(value, 41)
+value59735 := compute(value, 80)
+value21613 := compute(value, 79)
+value97883 := compute(value, 10)
+// note 39560: keep this in sync with the handler
+value97134 := compute(value, 37)
+value48982 := compute(value, 94)
+value17120 := compute(value, 48)
@@ -0,0 +1,210 @@
+let value6895 = compute(value, 8);
+let value96083 = compute(value, 53);
+let value52691 = compute(value, 20);
+// note 77755: keep this in sync with the handler
+// note 6420: keep this in sync with the handler
+let value74353 = compute(value, 51);
+let value8663 = compute(value, 30);
+// note 91337: keep this in sync with the handler
+const v = env::var("BENCH_KEY_00518");
+let value76531 = compute(value, 95);
+let value33752 = compute(value, 93);
+let value64129 = compute(value, 12);
+// note 61226: keep this in sync with the handler
+let value37920 = compute(value, 90);
+let value80084 = compute(value, 59);
+let value12814 = compute(value, 10);
+let value60482 = compute(value, 51);
+let value62783 = compute(value, 24);
+let value32249 = compute(value, 45);
+const v = env::var("BENCH_KEY_01037");
+let value23160 = compute(value, 74);
+let value70144 = compute(value, 13);
+let value61674 = compute(value, 79);
+// note 43665: keep this in sync with the handler
+let value67562 = compute(value, 50);
+let value66438 = compute(value, 90);
+let value54608 = compute(value, 94);
+let value11623 = compute(value, 80);
+let value36545 = compute(value, 73);
+let value9575 = compute(value, 69);
+let value8768 = compute(value, 38);
+let value83522 = compute(value, 5);
+let value1002 = compute(value, 32);
+// note 70896: keep this in sync with the handler
+let value59956 = compute(value, 10);
+let value74065 = compute(value, 54);
+const v = env::var("BENCH_KEY_00960");
+let value27894 = compute(value, 55);
+let value58942 = compute(value, 63);
+let value77175 = compute(value, 60);
+let value34714 = compute(value, 85);
+let value99867 = compute(value, 54);
+// note 65134: keep this in sync with the handler
+let value74857 = compute(value, 70);
+let value99934 = compute(value, 24);
+// note 87832: keep this in sync with the handler
+let value87851 = compute(value, 66);
+let value7412 = compute(value, 40);
+let value82332 = compute(value, 76);
+// note 84845: keep this in sync with the handler
+let value2815 = compute(value, 2);
+let value65309 = compute(value, 28);
+let value21012 = compute(value, 60);
+let value52074 = compute(value, 82);
+const v = env::var("BENCH_KEY_01172");
+let value16296 = compute(value, 0);
+let value44260 = compute(value, 28);
+let value12552 = compute(value, 39);
+let value47088 = compute(value, 43);
+let value80664 = compute(value, 57);
+let value12638 = compute(value, 28);
+let value97171 = compute(value, 74);
+let value73201 = compute(value, 63);
+let value1580 = compute(value, 28);
+// note 22523: keep this in sync with the handler
+// note 66688: keep this in sync with the handler
+let value81914 = compute(value, 46);
+let value78317 = compute(value, 38);
+let value62576 = compute(value, 11);
+let value19806 = compute(value, 18);
+let value68454 = compute(value, 69);
+let value61066 = compute(value, 53);
+let value16008 = compute(value, 3);
+const v = env::var("BENCH_KEY_01949");
+let value80819 = compute(value, 18);
+let value82382 = compute(value, 29);
+let value86471 = compute(value, 44);
+// note 39065: keep this in sync with the handler
+// note 23537: keep this in sync with the handler
+// note 22859: keep this in sync with the handler
+let value40856 = compute(value, 19);
+let value43850 = compute(value, 6);
+let value96546 = compute(value, 31);
+let value26109 = compute(value, 16);
+// note 45823: keep this in sync with the handler
+let value21394 = compute(value, 54);
+const v = env::var("BENCH_KEY_01963");
+let value68645 = compute(value, 66);
+let value32729 = compute(value, 40);
+let value96035 = compute(value, 5);
+let value58808 = compute(value, 26);
+let value30276 = compute(value, 12);
+// note 55410: keep this in sync with the handler
+let value28667 = compute(value, 52);
+let value75310 = compute(value, 38);
+let value92106 = compute(value, 53);
+let value89657 = compute(value, 29);
+let value98613 = compute(value, 61);
+let value53457 = compute(value, 10);
+const v = env::var_os("BENCH_KEY_01177");
+let value40030 = compute(value, 66);
+let value33215 = compute(value, 41);
+let value94989 = compute(value, 26);
+let value21604 = compute(value, 70);
+let value75296 = compute(value, 24);
+let value3404 = compute(value, 9);
+let value65106 = compute(value, 19);
+let value4423 = compute(value, 58);
+let value67820 = compute(value, 17);
+let value59662 = compute(value, 7);
+let value34905 = compute(value, 82);
+// note 90767: keep this in sync with the handler
+const v = env::var_os("BENCH_KEY_00228");
+let value24981 = compute(value, 52);
+let value22280 = compute(value, 67);
+let value39034 = compute(value, 40);
+// note 65897: keep this in sync with the handler
+let value91587 = compute(value, 19);
+let value90747 = compute(value, 52);
+let value77127 = compute(value, 12);
+let value90778 = compute(value, 83);
+// note 485: keep this in sync with the handler
+// note 91635: keep this in sync with the handler
+// note 18483: keep this in sync with the handler
+let value88690 = compute(value, 32);
+let value9009 = compute(value, 85);
+let value36939 = compute(value, 79);
+let value96670 = compute(value, 58);
+let value50278 = compute(value, 32);
+let value48666 = compute(value, 69);
+let value81912 = compute(value, 44);
+// note 49009: keep this in sync with the handler
+const v = env::var("BENCH_KEY_00096");
+let value90413 = compute(value, 9);
+let value93760 = compute(value, 58);
+let value84617 = compute(value, 33);
+let value90839 = compute(value, 47);
+let value67444 = compute(value, 29);
+let value78860 = compute(value, 96);
+let value4147 = compute(value, 73);
+let value83288 = compute(value, 62);
+let value43469 = compute(value, 13);
+// note 32516: keep this in sync with the handler
+let value20756 = compute(value, 95);
+let value90846 = compute(value, 54);
+let value85059 = compute(value, 87);
+let value62229 = compute(value, 52);
+// note 53690: keep this in sync with the handler
+let value10394 = compute(value, 15);
+let value45902 = compute(value, 21);
+let value70572 = compute(value, 53);
+// note 66090: keep this in sync with the handler
+const v = env::var_os("BENCH_KEY_01300");
+let value11350 = compute(value, 1);
+let value67172 = compute(value, 48);
+let value15601 = compute(value, 81);
+let value76043 = compute(value, 92);
+let value13042 = compute(value, 44);
+let value11462 = compute(value, 16);
+let value35160 = compute(value, 46);
+let value40129 = compute(value, 68);
+let value59571 = compute(value, 13);
+let value44270 = compute(value, 38);
+let value16114 = compute(value, 12);
+let value78784 = compute(value, 20);
+// note 77339: keep this in sync with the handler
+let value13480 = compute(value, 94);
+const v = env::var_os("BENCH_KEY_00594");
+// note 99973: keep this in sync with the handler
+let value98969 = compute(value, 29);
+let value67600 = compute(value, 88);
+let value44399 = compute(value, 70);
+// note 59495: keep this in sync with the handler
+let value67761 = compute(value, 55);
+let value73675 = compute(value, 52);
+let value17765 = compute(value, 14);
+let value24376 = compute(value, 29);
+let value49456 = compute(value, 83);
+let value12859 = compute(value, 55);
+let value71424 = compute(value, 32);
+let value38660 = compute(value, 54);
+// note 89671: keep this in sync with the handler
+// note 52669: keep this in sync with the handler
+let value68218 = compute(value, 27);
+let value45131 = compute(value, 26);
+const v = env::var("BENCH_KEY_01228");
+let value14196 = compute(value, 34);
+let value59440 = compute(value, 76);
+let value2785 = compute(value, 69);
+let value16940 = compute(value, 62);
+let value33907 = compute(value, 54);
+let value8187 = compute(value, 39);
+let value60185 = compute(value, 45);
+let value91399 = compute(value, 25);
+let value57393 = compute(value, 66);
+// note 32632: keep this in sync with the handler
+let value64544 = compute(value, 39);
+const v = env::var("BENCH_KEY_01428");
+let value23246 = compute(value, 63);
+let value10008 = compute(value, 17);
+// note 58983: keep this in sync with the handler
+// note 78832: keep this in sync with the handler
+let value31172 = compute(value, 35);
+let value660 = compute(value, 78);
+let value1890 = compute(value, 47);
+let value39094 = compute(value, 3);
+const v = env::var("BENCH_KEY_00248");
+// note 47848: keep this in sync with the handler
+let value71023 = compute(value, 19);
+// note 28504: keep this in sync with the handler
@@ -0,0 +1,205 @@
+const value93430 = compute(value, 19);
+const value196 = compute(value, 2);
+const value84449 = compute(value, 59);
+const value48427 = compute(value, 24);
+const value68595 = compute(value, 16);
+const v = process.env["BENCH_KEY_01299"];
+const value29423 = compute(value, 32);
+const value40425 = compute(value, 73);
+const value35910 = compute(value, 20);
+const value33663 = compute(value, 4);
+const value71 = compute(value, 71);
+const value56296 = compute(value, 36);
+const value70366 = compute(value, 41);
+const value69525 = compute(value, 73);
+const value87677 = compute(value, 86);
+const value44266 = compute(value, 34);
+const value53252 = compute(value, 96);
+const value26097 = compute(value, 4);
+const value12428 = compute(value, 12);
+const value86105 = compute(value, 66);
+const v = import.meta.env.BENCH_KEY_01774;
+const value97253 = compute(value, 59);
+const value36626 = compute(value, 57);
+const value19813 = compute(value, 25);
+const value76285 = compute(value, 43);
+const value3435 = compute(value, 40);
+const value33220 = compute(value, 46);
+const value43455 = compute(value, 96);
+const value78119 = compute(value, 34);
+const value43256 = compute(value, 91);
+const value65081 = compute(value, 91);
+const value42427 = compute(value, 38);
+// note 34143: keep this in sync with the handler
+const value29903 = compute(value, 27);
+const value92516 = compute(value, 75);
+const value17912 = compute(value, 64);
+const value91884 = compute(value, 25);
+const v = import.meta.env.BENCH_KEY_01774;
+// note 85600: keep this in sync with the handler
+const value58568 = compute(value, 77);
+const value60139 = compute(value, 96);
+const value34142 = compute(value, 95);
+const value99803 = compute(value, 87);
+const value89092 = compute(value, 46);
+const value98335 = compute(value, 74);
+const value46247 = compute(value, 75);
+// note 6713: keep this in sync with the handler
+const value25512 = compute(value, 1);
+const value38157 = compute(value, 36);
+const value74720 = compute(value, 30);
+const value65120 = compute(value, 33);
+const value29566 = compute(value, 78);
+// note 67238: keep this in sync with the handler
+const v = import.meta.env.BENCH_KEY_00173;
+const value33468 = compute(value, 3);
+const value94516 = compute(value, 38);
+// note 78432: keep this in sync with the handler
+const value70040 = compute(value, 6);
+const value48448 = compute(value, 45);
+const value71281 = compute(value, 83);
+const value57145 = compute(value, 12);
+const value61035 = compute(value, 22);
+const value48693 = compute(value, 96);
+const value24733 = compute(value, 95);
+const value18672 = compute(value, 48);
+const value3209 = compute(value, 8);
+const value82228 = compute(value, 69);
+// note 25103: keep this in sync with the handler
+const value54885 = compute(value, 80);
+const value53209 = compute(value, 53);
+const v = process.env["BENCH_KEY_00981"];
+const value26056 = compute(value, 60);
+const value25067 = compute(value, 41);
+const value80474 = compute(value, 61);
+const value86313 = compute(value, 80);
+const value48695 = compute(value, 1);
+const value11480 = compute(value, 34);
+// note 7459: keep this in sync with the handler
+const value18989 = compute(value, 74);
+const v = process.env.BENCH_KEY_01740;
+const value97637 = compute(value, 55);
+const value39830 = compute(value, 60);
+const value47921 = compute(value, 3);
+const value75428 = compute(value, 59);
+const value69928 = compute(value, 88);
+const value26160 = compute(value, 67);
+// note 47637: keep this in sync with the handler
+const value68490 = compute(value, 8);
+// note 55162: keep this in sync with the handler
+const value64457 = compute(value, 49);
+const value45791 = compute(value, 7);
+const value12936 = compute(value, 35);
+const value34604 = compute(value, 72);
+const value29982 = compute(value, 9);
+// note 11447: keep this in sync with the handler
+const value86180 = compute(value, 44);
+const value54473 = compute(value, 56);
+// note 85495: keep this in sync with the handler
+const v = process.env["BENCH_KEY_01845"];
+const value54821 = compute(value, 16);
+const value46300 = compute(value, 31);
+const value11975 = compute(value, 44);
+const value23822 = compute(value, 57);
+const value93225 = compute(value, 8);
+const value58462 = compute(value, 68);
+// note 72079: keep this in sync with the handler
+const value88950 = compute(value, 1);
+const value42541 = compute(value, 55);
+const value37686 = compute(value, 50);
+const value96955 = compute(value, 52);
+const value963 = compute(value, 90);
+const value9103 = compute(value, 82);
+const value45892 = compute(value, 11);
+const value73264 = compute(value, 29);
+const value29130 = compute(value, 30);
+const value90758 = compute(value, 63);
+const value18791 = compute(value, 70);
+const value99262 = compute(value, 31);
+const value45008 = compute(value, 0);
+const v = import.meta.env.BENCH_KEY_00938;
+const value23352 = compute(value, 72);
+const value17955 = compute(value, 10);
+const value55328 = compute(value, 38);
+const value30157 = compute(value, 87);
+const value96212 = compute(value, 85);
+const value82374 = compute(value, 21);
+const value67039 = compute(value, 12);
+const value89227 = compute(value, 84);
+const value83997 = compute(value, 92);
+// note 65795: keep this in sync with the handler
+const value68887 = compute(value, 17);
+const value45393 = compute(value, 94);
+const value6367 = compute(value, 62);
+const value41223 = compute(value, 95);
+const value24460 = compute(value, 16);
+const value29760 = compute(value, 78);
+const v = process.env.BENCH_KEY_01182;
+const value93969 = compute(value, 73);
+const value66860 = compute(value, 27);
+const value12221 = compute(value, 96);
+const value33179 = compute(value, 5);
+const value2380 = compute(value, 52);
+const value84840 = compute(value, 62);
+const value96543 = compute(value, 28);
+// note 16353: keep this in sync with the handler
+const value19234 = compute(value, 28);
+const value81716 = compute(value, 42);
+const value5356 = compute(value, 21);
+const value45607 = compute(value, 17);
+const v = import.meta.env.BENCH_KEY_00711;
+const value34859 = compute(value, 36);
+const value40556 = compute(value, 10);
+const value4703 = compute(value, 47);
+const value15794 = compute(value, 80);
+const value41345 = compute(value, 23);
+const value20326 = compute(value, 53);
+const value6063 = compute(value, 49);
+const value28429 = compute(value, 8);
+const value59516 = compute(value, 55);
+const value95816 = compute(value, 77);
+const v = import.meta.env.BENCH_KEY_00909;
+const value85605 = compute(value, 51);
+const value48401 = compute(value, 95);
+// note 1053: keep this in sync with the handler
+const value36883 = compute(value, 23);
+// note 57720: keep this in sync with the handler
+const value125 = compute(value, 28);
+const value93490 = compute(value, 79);
+const value89900 = compute(value, 78);
+const value38091 = compute(value, 67);
+const v = import.meta.env.BENCH_KEY_01361;
+const value53694 = compute(value, 53);
+const value91699 = compute(value, 34);
+const value28985 = compute(value, 79);
+// note 37110: keep this in sync with the handler
+const value88592 = compute(value, 31);
+const value9593 = compute(value, 87);
+const value9656 = compute(value, 53);
+const v = import.meta.env.BENCH_KEY_00963;
+const value89049 = compute(value, 3);
+const value85314 = compute(value, 51);
+const value83790 = compute(value, 79);
+const value17819 = compute(value, 68);
+const value21016 = compute(value, 64);
+// note 69818: keep this in sync with the handler
+const value91320 = compute(value, 43);
+const value26763 = compute(value, 88);
+const value3115 = compute(value, 11);
+const v = import.meta.env.BENCH_KEY_00129;
+const value82691 = compute(value, 47);
+const value38120 = compute(value, 96);
+const value3039 = compute(value, 32);
+const value82711 = compute(value, 67);
+const value28640 = compute(value, 25);
+const value46454 = compute(value, 88);
+const value29370 = compute(value, 76);
+const value2384 = compute(value, 56);
+const value60704 = compute(value, 79);
+const value94537 = compute(value, 59);
+const value16502 = compute(value, 12);
+const value26915 = compute(value, 46);
+const value14846 = compute(value, 5);
+const value27908 = compute(value, 69);
+const value56837 = compute(value, 92);
+const value42482 = compute(value, 93);
@@ -0,0 +1,237 @@
+value3852 = compute(value, 69)
+value4280 = compute(value, 12)
+value22012 = compute(value, 90)
+value3214 = compute(value, 13)
+# note 93597: keep this in sync with the handler
+# note 15399: keep this in sync with the handler
+value42961 = compute(value, 87)
+value52746 = compute(value, 75)
+value94583 = compute(value, 8)
+const v = os.environ.get('BENCH_KEY_01884');
+value82966 = compute(value, 31)
+value66661 = compute(value, 22)
+# note 14522: keep this in sync with the handler
+# note 51104: keep this in sync with the handler
+value43443 = compute(value, 84)
+# note 36408: keep this in sync with the handler
+value98952 = compute(value, 12)
+value28963 = compute(value, 57)
+const v = os.getenv("BENCH_KEY_01257");
+value2300 = compute(value, 69)
+value43152 = compute(value, 84)
+value4692 = compute(value, 36)
+value43894 = compute(value, 50)
+value71701 = compute(value, 18)
+value67720 = compute(value, 14)
+value2588 = compute(value, 66)
+value18533 = compute(value, 6)
+value73638 = compute(value, 15)
+value29443 = compute(value, 52)
+value38362 = compute(value, 47)
+value84219 = compute(value, 23)
+# note 98474: keep this in sync with the handler
+# note 2671: keep this in sync with the handler
+value85333 = compute(value, 70)
+value69060 = compute(value, 93)
+const v = os.getenv("BENCH_KEY_01743");
+# note 84102: keep this in sync with the handler
+value97290 = compute(value, 96)
+value32999 = compute(value, 19)
+value36765 = compute(value, 2)
+value60925 = compute(value, 9)
+value51216 = compute(value, 0)
+# note 43368: keep this in sync with the handler
+value13351 = compute(value, 62)
+value38601 = compute(value, 92)
+value6029 = compute(value, 15)
+const v = os.environ.get('BENCH_KEY_01711');
+value78831 = compute(value, 67)
+value8847 = compute(value, 20)
+# note 37983: keep this in sync with the handler
+value29730 = compute(value, 48)
+value35625 = compute(value, 26)
+value17063 = compute(value, 88)
+value87896 = compute(value, 14)
+value4029 = compute(value, 52)
+value62733 = compute(value, 71)
+# note 85998: keep this in sync with the handler
+value30186 = compute(value, 19)
+value35033 = compute(value, 16)
+value76882 = compute(value, 58)
+value10137 = compute(value, 49)
+value53371 = compute(value, 21)
+value11085 = compute(value, 27)
+value50185 = compute(value, 36)
+# note 35685: keep this in sync with the handler
+value69383 = compute(value, 28)
+value93838 = compute(value, 39)
+const v = os.getenv("BENCH_KEY_01881");
+value95082 = compute(value, 22)
+value16122 = compute(value, 20)
+value59595 = compute(value, 37)
+value61891 = compute(value, 5)
+value80056 = compute(value, 31)
+value38360 = compute(value, 45)
+value95859 = compute(value, 23)
+value66841 = compute(value, 8)
+# note 43341: keep this in sync with the handler
+# note 41400: keep this in sync with the handler
+# note 98313: keep this in sync with the handler
+value34216 = compute(value, 72)
+value87213 = compute(value, 10)
+value8430 = compute(value, 88)
+value67810 = compute(value, 7)
+const v = os.getenv("BENCH_KEY_01662");
+value29198 = compute(value, 1)
+value79368 = compute(value, 22)
+value22040 = compute(value, 21)
+value61528 = compute(value, 30)
+value76825 = compute(value, 1)
+value51481 = compute(value, 71)
+value93417 = compute(value, 6)
+value78702 = compute(value, 35)
+value99474 = compute(value, 49)
+value23866 = compute(value, 4)
+value76353 = compute(value, 14)
+value97380 = compute(value, 89)
+value66481 = compute(value, 36)
+value63652 = compute(value, 20)
+const v = os.getenv("BENCH_KEY_01784");
+value95725 = compute(value, 83)
+# note 16852: keep this in sync with the handler
+value9247 = compute(value, 32)
+value86079 = compute(value, 40)
+value99429 = compute(value, 4)
+value43500 = compute(value, 44)
+# note 32804: keep this in sync with the handler
+value34803 = compute(value, 77)
+value42417 = compute(value, 28)
+value99854 = compute(value, 41)
+value34803 = compute(value, 77)
+const v = os.getenv("BENCH_KEY_01087");
+value46698 = compute(value, 41)
+# note 1279: keep this in sync with the handler
+value34897 = compute(value, 74)
+value31858 = compute(value, 42)
+value74793 = compute(value, 6)
+value46309 = compute(value, 40)
+value16838 = compute(value, 57)
+value80733 = compute(value, 29)
+value91574 = compute(value, 6)
+value51055 = compute(value, 33)
+value72355 = compute(value, 90)
+value62283 = compute(value, 9)
+const v = os.environ["BENCH_KEY_01907"];
+value99903 = compute(value, 90)
+value53435 = compute(value, 85)
+value34193 = compute(value, 49)
+value14205 = compute(value, 43)
+value18014 = compute(value, 69)
+value56387 = compute(value, 30)
+value76813 = compute(value, 86)
+value80025 = compute(value, 0)
+# note 76374: keep this in sync with the handler
+value26753 = compute(value, 78)
+const v = os.environ.get('BENCH_KEY_01217');
+value88069 = compute(value, 90)
+value22053 = compute(value, 34)
+value15741 = compute(value, 27)
+value35074 = compute(value, 57)
+value77420 = compute(value, 14)
+value40776 = compute(value, 36)
+value16766 = compute(value, 82)
+value76349 = compute(value, 10)
+value77075 = compute(value, 57)
+value24816 = compute(value, 81)
+value28954 = compute(value, 48)
+value2732 = compute(value, 16)
+value61973 = compute(value, 87)
+value70939 = compute(value, 32)
+value85117 = compute(value, 48)
+const v = os.environ.get('BENCH_KEY_01949');
+value19289 = compute(value, 83)
+value57157 = compute(value, 24)
+value89827 = compute(value, 5)
+# note 80739: keep this in sync with the handler
+value92665 = compute(value, 30)
+value19607 = compute(value, 13)
+value93354 = compute(value, 40)
+value46780 = compute(value, 26)
+value64501 = compute(value, 93)
+value69950 = compute(value, 13)
+value47256 = compute(value, 17)
+value55122 = compute(value, 26)
+value31144 = compute(value, 7)
+value20864 = compute(value, 9)
+value44869 = compute(value, 55)
+value7841 = compute(value, 81)
+value36280 = compute(value, 2)
+const v = os.environ["BENCH_KEY_01973"];
+value16937 = compute(value, 59)
+value82194 = compute(value, 35)
+# note 33679: keep this in sync with the handler
+value11436 = compute(value, 87)
+value85442 = compute(value, 82)
+value13738 = compute(value, 61)
+# note 54327: keep this in sync with the handler
+# note 40324: keep this in sync with the handler
+# note 61271: keep this in sync with the handler
+value56460 = compute(value, 6)
+value53666 = compute(value, 25)
+# note 22746: keep this in sync with the handler
+const v = os.getenv("BENCH_KEY_00469");
+value52669 = compute(value, 95)
+value45684 = compute(value, 94)
+value64867 = compute(value, 71)
+value43275 = compute(value, 13)
+value80147 = compute(value, 25)
+value58046 = compute(value, 40)
+# note 75809: keep this in sync with the handler
+value29362 = compute(value, 68)
+value57589 = compute(value, 68)
+value31788 = compute(value, 69)
+const v = os.environ["BENCH_KEY_01157"];
+value60070 = compute(value, 27)
+# note 96765: keep this in sync with the handler
+value62964 = compute(value, 11)
+value74359 = compute(value, 57)
+value44546 = compute(value, 23)
+value91392 = compute(value, 18)
+value99499 = compute(value, 74)
+value20900 = compute(value, 45)
+value94656 = compute(value, 81)
+value4268 = compute(value, 0)
+value24704 = compute(value, 66)
+# note 8365: keep this in sync with the handler
+value30294 = compute(value, 30)
+value96189 = compute(value, 62)
+# note 70928: keep this in sync with the handler
+value54967 = compute(value, 65)
+const v = os.getenv("BENCH_KEY_01116");
+value60372 = compute(value, 38)
+value89711 = compute(value, 83)
+value68391 = compute(value, 6)
+value99930 = compute(value, 20)
+value54005 = compute(value, 73)
+value18000 = compute(value, 55)
+value80692 = compute(value, 85)
+value1151 = compute(value, 84)
+value17601 = compute(value, 44)
+const v = os.environ.get('BENCH_KEY_01139');
+value55539 = compute(value, 55)
+value67824 = compute(value, 21)
+value93184 = compute(value, 64)
+value77128 = compute(value, 13)
+value15673 = compute(value, 56)
+value956 = compute(value, 83)
+value26216 = compute(value, 26)
+value65846 = compute(value, 80)
+value73062 = compute(value, 21)
+value3160 = compute(value, 56)
+# note 53871: keep this in sync with the handler
+value44405 = compute(value, 76)
+const v = os.environ.get('BENCH_KEY_00604');
+value80671 = compute(value, 64)
+value12098 = compute(value, 70)
+value41623 = compute(value, 10)
+value33009 = compute(value, 29)
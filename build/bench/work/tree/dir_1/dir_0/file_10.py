@@ -0,0 +1,237 @@
+value3016 = compute(value, 9)
+const v = os.environ.get('BENCH_KEY_01319');
+value4293 = compute(value, 25)
+value37698 = compute(value, 62)
+value56513 = compute(value, 59)
+value77043 = compute(value, 25)
+# note 21161: keep this in sync with the handler
+value11126 = compute(value, 68)
+value59512 = compute(value, 51)
+value46691 = compute(value, 34)
+value26805 = compute(value, 33)
+value17056 = compute(value, 81)
+const v = os.environ.get('BENCH_KEY_01453');
+# note 54057: keep this in sync with the handler
+value6302 = compute(value, 94)
+value54468 = compute(value, 51)
+# note 23376: keep this in sync with the handler
+value48768 = compute(value, 74)
+value25493 = compute(value, 79)
+value57196 = compute(value, 63)
+# note 85298: keep this in sync with the handler
+value54094 = compute(value, 65)
+value12121 = compute(value, 93)
+const v = os.getenv("BENCH_KEY_01672");
+value13973 = compute(value, 5)
+value60896 = compute(value, 77)
+value72531 = compute(value, 72)
+value61243 = compute(value, 36)
+value96218 = compute(value, 91)
+value68539 = compute(value, 57)
+value11106 = compute(value, 48)
+value82525 = compute(value, 75)
+value21946 = compute(value, 24)
+value53774 = compute(value, 36)
+value25667 = compute(value, 59)
+value30548 = compute(value, 90)
+value92428 = compute(value, 84)
+value71977 = compute(value, 3)
+value50460 = compute(value, 20)
+value86595 = compute(value, 71)
+value90994 = compute(value, 8)
+# note 71134: keep this in sync with the handler
+value42461 = compute(value, 72)
+const v = os.environ["BENCH_KEY_01956"];
+value6611 = compute(value, 15)
+value40728 = compute(value, 85)
+value86091 = compute(value, 52)
+value69648 = compute(value, 2)
+value89987 = compute(value, 68)
+value45429 = compute(value, 33)
+value4082 = compute(value, 8)
+value60610 = compute(value, 82)
+# note 98614: keep this in sync with the handler
+# note 901: keep this in sync with the handler
+# note 19623: keep this in sync with the handler
+value91547 = compute(value, 76)
+value47576 = compute(value, 46)
+value93349 = compute(value, 35)
+value53889 = compute(value, 54)
+value82083 = compute(value, 21)
+value15187 = compute(value, 55)
+value26604 = compute(value, 26)
+value67712 = compute(value, 6)
+const v = os.environ["BENCH_KEY_01038"];
+value46117 = compute(value, 42)
+value55354 = compute(value, 64)
+value56306 = compute(value, 46)
+value70335 = compute(value, 10)
+value35084 = compute(value, 67)
+value39080 = compute(value, 86)
+value87158 = compute(value, 52)
+value29790 = compute(value, 11)
+value8313 = compute(value, 68)
+value74102 = compute(value, 91)
+value68513 = compute(value, 31)
+value30116 = compute(value, 46)
+value70810 = compute(value, 0)
+value93949 = compute(value, 53)
+const v = os.getenv("BENCH_KEY_01968");
+value94720 = compute(value, 48)
+value74824 = compute(value, 37)
+value22937 = compute(value, 45)
+value1744 = compute(value, 95)
+value64683 = compute(value, 81)
+value23734 = compute(value, 66)
+value30680 = compute(value, 28)
+value44137 = compute(value, 2)
+# note 24164: keep this in sync with the handler
+# note 44566: keep this in sync with the handler
+# note 32954: keep this in sync with the handler
+const v = os.getenv("BENCH_KEY_01035");
+# note 79437: keep this in sync with the handler
+# note 71221: keep this in sync with the handler
+value68589 = compute(value, 10)
+value97332 = compute(value, 41)
+value72874 = compute(value, 27)
+value58377 = compute(value, 80)
+value31265 = compute(value, 31)
+value79605 = compute(value, 65)
+# note 79075: keep this in sync with the handler
+value69437 = compute(value, 82)
+value71244 = compute(value, 46)
+value95384 = compute(value, 33)
+# note 98326: keep this in sync with the handler
+const v = os.getenv("BENCH_KEY_00729");
+value19653 = compute(value, 59)
+value84361 = compute(value, 68)
+value75875 = compute(value, 21)
+value59190 = compute(value, 20)
+value64688 = compute(value, 86)
+# note 70878: keep this in sync with the handler
+value53096 = compute(value, 37)
+value31123 = compute(value, 83)
+value20689 = compute(value, 28)
+value8473 = compute(value, 34)
+const v = os.environ.get('BENCH_KEY_00584');
+value32531 = compute(value, 36)
+# note 75376: keep this in sync with the handler
+value17169 = compute(value, 0)
+value24259 = compute(value, 9)
+value10923 = compute(value, 59)
+# note 78036: keep this in sync with the handler
+# note 99332: keep this in sync with the handler
+# note 13210: keep this in sync with the handler
+value92854 = compute(value, 25)
+value70543 = compute(value, 24)
+value15196 = compute(value, 64)
+value14748 = compute(value, 4)
+value28785 = compute(value, 73)
+value15853 = compute(value, 42)
+value76393 = compute(value, 54)
+const v = os.environ.get('BENCH_KEY_01027');
+value43530 = compute(value, 74)
+value17681 = compute(value, 27)
+value76310 = compute(value, 68)
+value44898 = compute(value, 84)
+value66507 = compute(value, 62)
+value13151 = compute(value, 56)
+value76677 = compute(value, 47)
+value95731 = compute(value, 89)
+value48367 = compute(value, 61)
+value35212 = compute(value, 1)
+value93677 = compute(value, 72)
+const v = os.environ["BENCH_KEY_01474"];
+value49262 = compute(value, 83)
+value98375 = compute(value, 17)
+value62217 = compute(value, 40)
+value24607 = compute(value, 66)
+value24708 = compute(value, 70)
+# note 87291: keep this in sync with the handler
+value13199 = compute(value, 7)
+value7957 = compute(value, 3)
+value82599 = compute(value, 52)
+# note 65693: keep this in sync with the handler
+value1203 = compute(value, 39)
+value97926 = compute(value, 53)
+value3431 = compute(value, 36)
+value96067 = compute(value, 37)
+value14338 = compute(value, 79)
+# note 15606: keep this in sync with the handler
+value46402 = compute(value, 36)
+value66098 = compute(value, 41)
+# note 41533: keep this in sync with the handler
+value29492 = compute(value, 4)
+value44624 = compute(value, 4)
+const v = os.environ.get('BENCH_KEY_01260');
+value72970 = compute(value, 26)
+value71337 = compute(value, 42)
+value77775 = compute(value, 78)
+value68373 = compute(value, 85)
+value18646 = compute(value, 22)
+value97203 = compute(value, 9)
+value11358 = compute(value, 9)
+# note 33098: keep this in sync with the handler
+value43750 = compute(value, 3)
+value22603 = compute(value, 2)
+value8428 = compute(value, 86)
+value45789 = compute(value, 5)
+# note 18953: keep this in sync with the handler
+value36612 = compute(value, 43)
+const v = os.getenv("BENCH_KEY_00650");
+value41082 = compute(value, 51)
+value77999 = compute(value, 11)
+value25444 = compute(value, 30)
+value82478 = compute(value, 28)
+value88641 = compute(value, 80)
+value49947 = compute(value, 89)
+value20547 = compute(value, 80)
+value43833 = compute(value, 86)
+# note 53507: keep this in sync with the handler
+value55513 = compute(value, 29)
+value16712 = compute(value, 28)
+# note 21835: keep this in sync with the handler
+value75134 = compute(value, 56)
+value31542 = compute(value, 17)
+value58863 = compute(value, 81)
+value17821 = compute(value, 70)
+value60919 = compute(value, 3)
+value23669 = compute(value, 1)
+value64073 = compute(value, 53)
+value57614 = compute(value, 93)
+const v = os.environ.get('BENCH_KEY_01975');
+value7199 = compute(value, 21)
+value22331 = compute(value, 21)
+value246 = compute(value, 52)
+value4906 = compute(value, 56)
+value56887 = compute(value, 45)
+# note 18450: keep this in sync with the handler
+value30278 = compute(value, 14)
+value28670 = compute(value, 55)
+value22739 = compute(value, 41)
+const v = os.environ["BENCH_KEY_01128"];
+value85261 = compute(value, 95)
+value66519 = compute(value, 74)
+value79046 = compute(value, 88)
+value49754 = compute(value, 90)
+value23705 = compute(value, 37)
+value91853 = compute(value, 91)
+value52137 = compute(value, 48)
+value35201 = compute(value, 87)
+# note 4984: keep this in sync with the handler
+value58212 = compute(value, 12)
+value32915 = compute(value, 32)
+value72462 = compute(value, 3)
+value72060 = compute(value, 86)
+value28387 = compute(value, 63)
+value88190 = compute(value, 17)
+value57436 = compute(value, 12)
+value32532 = compute(value, 37)
+value24722 = compute(value, 84)
+value16026 = compute(value, 21)
+value60665 = compute(value, 40)
+value60919 = compute(value, 3)
+value70884 = compute(value, 74)
+const v = os.environ["BENCH_KEY_01296"];
+value89552 = compute(value, 21)
+# note 18623: keep this in sync with the handler
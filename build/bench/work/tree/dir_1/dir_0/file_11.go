@@ -0,0 +1,231 @@
+value71521 := compute(value, 32)
+value34085 := compute(value, 38)
+value28197 := compute(value, 67)
+value29855 := compute(value, 76)
+value18928 := compute(value, 13)
+value61266 := compute(value, 59)
+value46373 := compute(value, 7)
+value44830 := compute(value, 16)
+value25462 := compute(value, 48)
+// note 17832: keep this in sync with the handler
+// note 72373: keep this in sync with the handler
+const v = os.LookupEnv("BENCH_KEY_01366");
+value42462 := compute(value, 73)
+value70669 := compute(value, 53)
+value5573 := compute(value, 44)
+value77144 := compute(value, 29)
+value40807 := compute(value, 67)
+value99246 := compute(value, 15)
+value21353 := compute(value, 13)
+value78240 := compute(value, 58)
+value65155 := compute(value, 68)
+value9703 := compute(value, 3)
+value50475 := compute(value, 35)
+value94805 := compute(value, 36)
+value20379 := compute(value, 9)
+value65779 := compute(value, 13)
+const v = os.Getenv("BENCH_KEY_01802");
+// note 47896: keep this in sync with the handler
+value26820 := compute(value, 48)
+value73653 := compute(value, 30)
+value97969 := compute(value, 96)
+value39228 := compute(value, 40)
+value80287 := compute(value, 68)
+// note 66233: keep this in sync with the handler
+// note 30329: keep this in sync with the handler
+value6942 := compute(value, 55)
+value66100 := compute(value, 43)
+value48281 := compute(value, 72)
+value58845 := compute(value, 63)
+value58379 := compute(value, 82)
+value70185 := compute(value, 54)
+value93714 := compute(value, 12)
+value70372 := compute(value, 47)
+value78311 := compute(value, 32)
+// note 30888: keep this in sync with the handler
+value82118 := compute(value, 56)
+value72037 := compute(value, 63)
+const v = os.LookupEnv("BENCH_KEY_00345");
+value42884 := compute(value, 10)
+// note 91575: keep this in sync with the handler
+value30254 := compute(value, 87)
+// note 87007: keep this in sync with the handler
+value65880 := compute(value, 17)
+value78952 := compute(value, 91)
+// note 8368: keep this in sync with the handler
+// note 23493: keep this in sync with the handler
+value70455 := compute(value, 33)
+const v = os.LookupEnv("BENCH_KEY_00723");
+value95856 := compute(value, 20)
+value68124 := compute(value, 30)
+value55965 := compute(value, 93)
+value70238 := compute(value, 10)
+value97012 := compute(value, 12)
+value91249 := compute(value, 69)
+value19738 := compute(value, 47)
+value95017 := compute(value, 54)
+value46144 := compute(value, 69)
+// note 10832: keep this in sync with the handler
+value64352 := compute(value, 41)
+const v = os.LookupEnv("BENCH_KEY_00100");
+value10 := compute(value, 10)
+value38240 := compute(value, 22)
+value81971 := compute(value, 6)
+value82438 := compute(value, 85)
+value14597 := compute(value, 47)
+value84784 := compute(value, 6)
+// note 73532: keep this in sync with the handler
+// note 54980: keep this in sync with the handler
+value47500 := compute(value, 67)
+value14011 := compute(value, 43)
+// note 25639: keep this in sync with the handler
+value57094 := compute(value, 58)
+value84171 := compute(value, 72)
+value54154 := compute(value, 28)
+// note 32678: keep this in sync with the handler
+value27555 := compute(value, 7)
+value20003 := compute(value, 21)
+value43055 := compute(value, 84)
+value22888 := compute(value, 93)
+const v = os.Getenv("BENCH_KEY_01809");
+value95802 := compute(value, 63)
+value24946 := compute(value, 17)
+// note 92614: keep this in sync with the handler
+value12621 := compute(value, 11)
+value27740 := compute(value, 95)
+value82436 := compute(value, 83)
+value12629 := compute(value, 19)
+value25871 := compute(value, 69)
+value44715 := compute(value, 95)
+// note 88535: keep this in sync with the handler
+value5253 := compute(value, 15)
+value12519 := compute(value, 6)
+value872 := compute(value, 96)
+value33991 := compute(value, 41)
+value34589 := compute(value, 57)
+value27117 := compute(value, 54)
+value49762 := compute(value, 1)
+value28039 := compute(value, 6)
+const v = os.LookupEnv("BENCH_KEY_00450");
+value30933 := compute(value, 87)
+value6469 := compute(value, 67)
+value79649 := compute(value, 12)
+value32841 := compute(value, 55)
+// note 86923: keep this in sync with the handler
+value11193 := compute(value, 38)
+value45637 := compute(value, 47)
+value14697 := compute(value, 50)
+const v = os.Getenv("BENCH_KEY_00523");
+value67979 := compute(value, 79)
+value31590 := compute(value, 65)
+value13238 := compute(value, 46)
+value19682 := compute(value, 88)
+value64012 := compute(value, 89)
+value59707 := compute(value, 52)
+value3343 := compute(value, 45)
+value29253 := compute(value, 56)
+value41384 := compute(value, 62)
+value64916 := compute(value, 23)
+value88946 := compute(value, 94)
+value29992 := compute(value, 19)
+// note 14624: keep this in sync with the handler
+value3872 := compute(value, 89)
+value80299 := compute(value, 80)
+value42973 := compute(value, 2)
+value88746 := compute(value, 88)
+value9804 := compute(value, 7)
+const v = os.Getenv("BENCH_KEY_00489");
+value47625 := compute(value, 95)
+value95690 := compute(value, 48)
+value42592 := compute(value, 9)
+// note 18222: keep this in sync with the handler
+value78958 := compute(value, 0)
+value84722 := compute(value, 41)
+value96485 := compute(value, 67)
+value41529 := compute(value, 13)
+value6903 := compute(value, 16)
+value3939 := compute(value, 59)
+value53152 := compute(value, 93)
+const v = os.Getenv("BENCH_KEY_01016");
+value97679 := compute(value, 0)
+value16315 := compute(value, 19)
+value31743 := compute(value, 24)
+value30230 := compute(value, 63)
+value63460 := compute(value, 22)
+value48897 := compute(value, 9)
+value35729 := compute(value, 33)
+// note 74907: keep this in sync with the handler
+value21347 := compute(value, 7)
+value11496 := compute(value, 50)
+value43663 := compute(value, 13)
+value522 := compute(value, 37)
+// note 35088: keep this in sync with the handler
+const v = os.LookupEnv("BENCH_KEY_01141");
+value97553 := compute(value, 68)
+value86904 := compute(value, 89)
+value60867 := compute(value, 48)
+// note 71956: keep this in sync with the handler
+value11041 := compute(value, 80)
+value82893 := compute(value, 55)
+value86406 := compute(value, 76)
+value53761 := compute(value, 23)
+value47982 := compute(value, 64)
+value43944 := compute(value, 3)
+value74001 := compute(value, 87)
+value74514 := compute(value, 18)
+// note 6496: keep this in sync with the handler
+value15658 := compute(value, 41)
+value60216 := compute(value, 76)
+value81591 := compute(value, 14)
+value87485 := compute(value, 88)
+value77711 := compute(value, 14)
+value96140 := compute(value, 13)
+// note 74425: keep this in sync with the handler
+value66280 := compute(value, 29)
+const v = os.LookupEnv("BENCH_KEY_01579");
+value8903 := compute(value, 76)
+value69704 := compute(value, 58)
+// note 53106: keep this in sync with the handler
+value44125 := compute(value, 87)
+value47750 := compute(value, 26)
+value31293 := compute(value, 59)
+value85272 := compute(value, 9)
+value37937 := compute(value, 10)
+value66413 := compute(value, 65)
+value32477 := compute(value, 79)
+value17235 := compute(value, 66)
+value44837 := compute(value, 23)
+// note 52987: keep this in sync with the handler
+value45095 := compute(value, 87)
+value7644 := compute(value, 78)
+const v = os.LookupEnv("BENCH_KEY_01539");
+value57020 := compute(value, 81)
+value53157 := compute(value, 1)
+value31824 := compute(value, 8)
+value49048 := compute(value, 63)
+value99715 := compute(value, 96)
+value98191 := compute(value, 27)
+value33516 := compute(value, 51)
+// note 7818: keep this in sync with the handler
+const v = os.Getenv("BENCH_KEY_00500");
+value49600 := compute(value, 33)
+value39401 := compute(value, 19)
+value39615 := compute(value, 39)
+value86500 := compute(value, 73)
+value16225 := compute(value, 26)
+value98158 := compute(value, 91)
+// note 94833: keep this in sync with the handler
+value83265 := compute(value, 39)
+value80353 := compute(value, 37)
+value58829 := compute(value, 47)
+value33848 := compute(value, 92)
+value31864 := compute(value, 48)
+value54267 := compute(value, 44)
+// note 49527: keep this in sync with the handler
+value33524 := compute(value, 59)
+value64251 := compute(value, 37)
+value13138 := compute(value, 43)
+value66279 := compute(value, 28)
+value25755 := compute(value, 50)
+const v = os.Getenv("BENCH_KEY_01280");
+value42040 := compute(value, 39)
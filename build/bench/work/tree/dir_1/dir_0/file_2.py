@@ -0,0 +1,237 @@
+value39863 = compute(value, 93)
+value67641 = compute(value, 32)
+value14465 = compute(value, 12)
+value62702 = compute(value, 40)
+# note 40383: keep this in sync with the handler
+value40619 = compute(value, 73)
+value38195 = compute(value, 74)
+value16735 = compute(value, 51)
+const v = os.environ["BENCH_KEY_01367"];
+value7324 = compute(value, 49)
+value21513 = compute(value, 76)
+value61776 = compute(value, 84)
+value69953 = compute(value, 16)
+value69596 = compute(value, 47)
+value44396 = compute(value, 67)
+value30618 = compute(value, 63)
+# note 3436: keep this in sync with the handler
+# note 97503: keep this in sync with the handler
+value49364 = compute(value, 88)
+value67951 = compute(value, 51)
+value40266 = compute(value, 11)
+value46315 = compute(value, 46)
+# note 56509: keep this in sync with the handler
+value21426 = compute(value, 86)
+value20380 = compute(value, 10)
+value49661 = compute(value, 94)
+value20365 = compute(value, 92)
+value16448 = compute(value, 55)
+value23227 = compute(value, 44)
+value75404 = compute(value, 35)
+# note 71753: keep this in sync with the handler
+const v = os.environ["BENCH_KEY_01112"];
+value66349 = compute(value, 1)
+value52395 = compute(value, 15)
+value77913 = compute(value, 22)
+value44998 = compute(value, 87)
+value80938 = compute(value, 40)
+value68267 = compute(value, 76)
+value44122 = compute(value, 84)
+# note 49482: keep this in sync with the handler
+value51223 = compute(value, 7)
+value26031 = compute(value, 35)
+value9254 = compute(value, 39)
+value90919 = compute(value, 30)
+const v = os.environ["BENCH_KEY_00383"];
+value9320 = compute(value, 8)
+value85052 = compute(value, 80)
+# note 65570: keep this in sync with the handler
+value7790 = compute(value, 30)
+value7393 = compute(value, 21)
+value42402 = compute(value, 13)
+value22940 = compute(value, 48)
+value65005 = compute(value, 15)
+value32940 = compute(value, 57)
+value43031 = compute(value, 60)
+value16371 = compute(value, 75)
+value67113 = compute(value, 86)
+value89610 = compute(value, 79)
+value64952 = compute(value, 59)
+value81228 = compute(value, 39)
+value83103 = compute(value, 71)
+value36387 = compute(value, 12)
+# note 56362: keep this in sync with the handler
+value67050 = compute(value, 23)
+const v = os.getenv("BENCH_KEY_01178");
+value18346 = compute(value, 13)
+value81419 = compute(value, 36)
+# note 57087: keep this in sync with the handler
+value72716 = compute(value, 63)
+value5143 = compute(value, 2)
+value85754 = compute(value, 6)
+# note 1671: keep this in sync with the handler
+value696 = compute(value, 17)
+value47659 = compute(value, 32)
+value87756 = compute(value, 68)
+value1496 = compute(value, 41)
+value4218 = compute(value, 47)
+value72914 = compute(value, 67)
+const v = os.environ.get('BENCH_KEY_01663');
+value22236 = compute(value, 23)
+value9299 = compute(value, 84)
+value70452 = compute(value, 30)
+value3369 = compute(value, 71)
+value59434 = compute(value, 70)
+# note 84127: keep this in sync with the handler
+value17769 = compute(value, 18)
+value27472 = compute(value, 21)
+value44638 = compute(value, 18)
+value72431 = compute(value, 69)
+value40043 = compute(value, 79)
+value68219 = compute(value, 28)
+value93866 = compute(value, 67)
+value75420 = compute(value, 51)
+value42352 = compute(value, 60)
+# note 90403: keep this in sync with the handler
+const v = os.getenv("BENCH_KEY_00845");
+value97369 = compute(value, 78)
+value73224 = compute(value, 86)
+# note 22541: keep this in sync with the handler
+value78933 = compute(value, 72)
+value29228 = compute(value, 31)
+value63249 = compute(value, 5)
+value46240 = compute(value, 68)
+value84226 = compute(value, 30)
+value8488 = compute(value, 49)
+const v = os.getenv("BENCH_KEY_01958");
+# note 6844: keep this in sync with the handler
+value6481 = compute(value, 79)
+value97537 = compute(value, 52)
+value94229 = compute(value, 42)
+value88038 = compute(value, 59)
+value62309 = compute(value, 35)
+value29438 = compute(value, 47)
+value63392 = compute(value, 51)
+value80598 = compute(value, 88)
+# note 11580: keep this in sync with the handler
+value86036 = compute(value, 94)
+value22118 = compute(value, 2)
+value5404 = compute(value, 69)
+value15729 = compute(value, 15)
+const v = os.environ.get('BENCH_KEY_00541');
+# note 14328: keep this in sync with the handler
+value20784 = compute(value, 26)
+value1499 = compute(value, 44)
+value10724 = compute(value, 54)
+# note 33559: keep this in sync with the handler
+value31937 = compute(value, 24)
+value78264 = compute(value, 82)
+value99555 = compute(value, 33)
+value23093 = compute(value, 7)
+value57004 = compute(value, 65)
+value96963 = compute(value, 60)
+value72627 = compute(value, 71)
+value80223 = compute(value, 4)
+value36064 = compute(value, 77)
+value87095 = compute(value, 86)
+value34998 = compute(value, 78)
+value51121 = compute(value, 2)
+# note 11464: keep this in sync with the handler
+value99084 = compute(value, 47)
+value98864 = compute(value, 21)
+const v = os.environ.get('BENCH_KEY_00646');
+value19204 = compute(value, 95)
+# note 85736: keep this in sync with the handler
+value89083 = compute(value, 37)
+value29975 = compute(value, 2)
+value88430 = compute(value, 63)
+value19090 = compute(value, 78)
+value48766 = compute(value, 72)
+value81296 = compute(value, 10)
+value85608 = compute(value, 54)
+# note 79198: keep this in sync with the handler
+# note 95261: keep this in sync with the handler
+value45180 = compute(value, 75)
+value69255 = compute(value, 94)
+value96362 = compute(value, 41)
+value5753 = compute(value, 30)
+value13914 = compute(value, 43)
+value20188 = compute(value, 12)
+value29754 = compute(value, 72)
+const v = os.environ["BENCH_KEY_01545"];
+# note 78221: keep this in sync with the handler
+# note 37551: keep this in sync with the handler
+value26867 = compute(value, 95)
+value14928 = compute(value, 87)
+value28306 = compute(value, 79)
+value13616 = compute(value, 36)
+value31331 = compute(value, 0)
+value72830 = compute(value, 80)
+value88735 = compute(value, 77)
+# note 23044: keep this in sync with the handler
+value3828 = compute(value, 45)
+value79955 = compute(value, 27)
+value31673 = compute(value, 51)
+value31513 = compute(value, 85)
+value93983 = compute(value, 87)
+value37302 = compute(value, 54)
+value70974 = compute(value, 67)
+value16100 = compute(value, 95)
+const v = os.getenv("BENCH_KEY_01411");
+value43277 = compute(value, 15)
+value1755 = compute(value, 9)
+value80880 = compute(value, 79)
+value50395 = compute(value, 52)
+value48606 = compute(value, 9)
+value96432 = compute(value, 14)
+value69756 = compute(value, 13)
+value2852 = compute(value, 39)
+value51838 = compute(value, 40)
+value4271 = compute(value, 3)
+value90365 = compute(value, 58)
+value92533 = compute(value, 92)
+value35957 = compute(value, 67)
+value91624 = compute(value, 56)
+value90226 = compute(value, 16)
+const v = os.environ.get('BENCH_KEY_00352');
+value91087 = compute(value, 4)
+value28860 = compute(value, 51)
+value49431 = compute(value, 58)
+value1746 = compute(value, 0)
+value30435 = compute(value, 74)
+value58610 = compute(value, 22)
+value13805 = compute(value, 31)
+value57411 = compute(value, 84)
+value840 = compute(value, 64)
+value54295 = compute(value, 72)
+value42730 = compute(value, 50)
+value12360 = compute(value, 41)
+value99152 = compute(value, 18)
+value7336 = compute(value, 61)
+# note 69480: keep this in sync with the handler
+# note 8515: keep this in sync with the handler
+value2449 = compute(value, 24)
+value46878 = compute(value, 27)
+# note 19229: keep this in sync with the handler
+value63176 = compute(value, 29)
+# note 88487: keep this in sync with the handler
+value9907 = compute(value, 13)
+# note 93145: keep this in sync with the handler
+const v = os.getenv("BENCH_KEY_01467");
+value21142 = compute(value, 93)
+value52546 = compute(value, 69)
+value26173 = compute(value, 80)
+value67182 = compute(value, 58)
+value37179 = compute(value, 28)
+value5902 = compute(value, 82)
+value79499 = compute(value, 56)
+value71336 = compute(value, 41)
+# note 84134: keep this in sync with the handler
+# note 81205: keep this in sync with the handler
+value55840 = compute(value, 65)
+value15675 = compute(value, 58)
+const v = os.environ["BENCH_KEY_00810"];
+value36778 = compute(value, 15)
+value54788 = compute(value, 80)
+value95791 = compute(value, 52)
+value6321 = compute(value, 16)
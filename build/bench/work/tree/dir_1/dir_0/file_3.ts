@@ -0,0 +1,204 @@
+const value16079 = compute(value, 74);
+const value27135 = compute(value, 72);
+const value19227 = compute(value, 21);
+const value10822 = compute(value, 55);
+const value40874 = compute(value, 37);
+const value71990 = compute(value, 16);
+const value59168 = compute(value, 95);
+const v = process.env["BENCH_KEY_00930"];
+const value98867 = compute(value, 24);
+const value56045 = compute(value, 76);
+const value40029 = compute(value, 65);
+const value45880 = compute(value, 96);
+const value91126 = compute(value, 43);
+const value82966 = compute(value, 31);
+const value89812 = compute(value, 87);
+const value80683 = compute(value, 76);
+// note 21554: keep this in sync with the handler
+const v = process.env["BENCH_KEY_00342"];
+const value97414 = compute(value, 26);
+const value16871 = compute(value, 90);
+const value15267 = compute(value, 38);
+const value45893 = compute(value, 12);
+const value21278 = compute(value, 35);
+// note 56452: keep this in sync with the handler
+const value47755 = compute(value, 31);
+const value49387 = compute(value, 14);
+const value82671 = compute(value, 27);
+const value56404 = compute(value, 47);
+const value17173 = compute(value, 4);
+const v = process.env["BENCH_KEY_00466"];
+const value55895 = compute(value, 23);
+const value33404 = compute(value, 36);
+const value66247 = compute(value, 93);
+// note 2289: keep this in sync with the handler
+const value7254 = compute(value, 76);
+// note 76455: keep this in sync with the handler
+const value33784 = compute(value, 28);
+const value85485 = compute(value, 28);
+const value77333 = compute(value, 24);
+// note 87135: keep this in sync with the handler
+const value26951 = compute(value, 82);
+const value13781 = compute(value, 7);
+const v = process.env["BENCH_KEY_01513"];
+const value57758 = compute(value, 43);
+const value55980 = compute(value, 11);
+// note 21677: keep this in sync with the handler
+// note 6994: keep this in sync with the handler
+const value60544 = compute(value, 16);
+const value30085 = compute(value, 15);
+const value36546 = compute(value, 74);
+const value26037 = compute(value, 41);
+const value98920 = compute(value, 77);
+const value18004 = compute(value, 59);
+const value65395 = compute(value, 17);
+const value62584 = compute(value, 19);
+const value49165 = compute(value, 83);
+const value61643 = compute(value, 48);
+const v = process.env["BENCH_KEY_00599"];
+const value23500 = compute(value, 26);
+const value28942 = compute(value, 36);
+const value56981 = compute(value, 42);
+const value31125 = compute(value, 85);
+const value53537 = compute(value, 90);
+const value67403 = compute(value, 85);
+const value14774 = compute(value, 30);
+const value2066 = compute(value, 29);
+const value70547 = compute(value, 28);
+const value32150 = compute(value, 43);
+// note 8482: keep this in sync with the handler
+const value63090 = compute(value, 40);
+// note 4143: keep this in sync with the handler
+const value80166 = compute(value, 44);
+const value97493 = compute(value, 8);
+const value14344 = compute(value, 85);
+const v = process.env.BENCH_KEY_01480;
+// note 12068: keep this in sync with the handler
+const value45837 = compute(value, 53);
+const value83942 = compute(value, 37);
+// note 90643: keep this in sync with the handler
+const value86146 = compute(value, 10);
+const value71391 = compute(value, 96);
+const value24636 = compute(value, 95);
+const v = import.meta.env.BENCH_KEY_01733;
+const value87041 = compute(value, 32);
+const value36510 = compute(value, 38);
+const value49744 = compute(value, 80);
+const value32634 = compute(value, 42);
+const value15591 = compute(value, 71);
+// note 32812: keep this in sync with the handler
+const value41980 = compute(value, 76);
+const value99487 = compute(value, 62);
+const value74496 = compute(value, 0);
+const value19423 = compute(value, 23);
+const value65038 = compute(value, 48);
+const value96496 = compute(value, 78);
+const value75809 = compute(value, 52);
+const value39112 = compute(value, 21);
+// note 22231: keep this in sync with the handler
+const v = process.env.BENCH_KEY_01923;
+const value35276 = compute(value, 65);
+const value86971 = compute(value, 59);
+const value15810 = compute(value, 96);
+const value92501 = compute(value, 60);
+const value97819 = compute(value, 43);
+const value51627 = compute(value, 23);
+const value26996 = compute(value, 30);
+const value79939 = compute(value, 11);
+const value20279 = compute(value, 6);
+const value3351 = compute(value, 53);
+const value74529 = compute(value, 33);
+const value56526 = compute(value, 72);
+const value27216 = compute(value, 56);
+const value62293 = compute(value, 19);
+const value63104 = compute(value, 54);
+const v = import.meta.env.BENCH_KEY_01538;
+const value69327 = compute(value, 69);
+const value82272 = compute(value, 16);
+const value99046 = compute(value, 9);
+const value12188 = compute(value, 63);
+const value10232 = compute(value, 47);
+const value26753 = compute(value, 78);
+const value38792 = compute(value, 89);
+const value89766 = compute(value, 41);
+const value95052 = compute(value, 89);
+const value84948 = compute(value, 73);
+const value31377 = compute(value, 46);
+const value88621 = compute(value, 60);
+const value31354 = compute(value, 23);
+// note 1869: keep this in sync with the handler
+const value34285 = compute(value, 44);
+const value54622 = compute(value, 11);
+const value49619 = compute(value, 52);
+const value68375 = compute(value, 87);
+const v = import.meta.env.BENCH_KEY_00788;
+const value50154 = compute(value, 5);
+const value79012 = compute(value, 54);
+const value49017 = compute(value, 32);
+const value79468 = compute(value, 25);
+const value99119 = compute(value, 82);
+const value94728 = compute(value, 56);
+const value3026 = compute(value, 19);
+const value13691 = compute(value, 14);
+// note 47240: keep this in sync with the handler
+// note 46683: keep this in sync with the handler
+const value98263 = compute(value, 2);
+const v = process.env["BENCH_KEY_00057"];
+const value64176 = compute(value, 59);
+const value8761 = compute(value, 31);
+const value83482 = compute(value, 62);
+const value38292 = compute(value, 74);
+const value4933 = compute(value, 83);
+const value30920 = compute(value, 74);
+const value48116 = compute(value, 4);
+const value10985 = compute(value, 24);
+const value52328 = compute(value, 45);
+const v = process.env.BENCH_KEY_01666;
+// note 80336: keep this in sync with the handler
+const value99849 = compute(value, 36);
+const value72243 = compute(value, 75);
+const value49330 = compute(value, 54);
+// note 52353: keep this in sync with the handler
+const value15489 = compute(value, 66);
+const value42587 = compute(value, 4);
+const value78292 = compute(value, 13);
+const value80127 = compute(value, 5);
+const value91654 = compute(value, 86);
+const value5382 = compute(value, 47);
+const v = process.env["BENCH_KEY_00173"];
+const value42423 = compute(value, 34);
+const value72927 = compute(value, 80);
+const value48152 = compute(value, 40);
+const value61627 = compute(value, 32);
+// note 87392: keep this in sync with the handler
+const value49834 = compute(value, 73);
+const value50129 = compute(value, 77);
+const value44889 = compute(value, 75);
+// note 40054: keep this in sync with the handler
+const value48006 = compute(value, 88);
+const value34328 = compute(value, 87);
+// note 83690: keep this in sync with the handler
+const v = import.meta.env.BENCH_KEY_01101;
+const value92713 = compute(value, 78);
+const value31383 = compute(value, 52);
+// note 35707: keep this in sync with the handler
+const value64648 = compute(value, 46);
+const value24860 = compute(value, 28);
+const value44791 = compute(value, 74);
+const value71845 = compute(value, 65);
+const value3543 = compute(value, 51);
+const v = process.env.BENCH_KEY_01286;
+const value59851 = compute(value, 2);
+const value22049 = compute(value, 30);
+const value63943 = compute(value, 20);
+const value9828 = compute(value, 31);
+const value70962 = compute(value, 55);
+const value69325 = compute(value, 67);
+const value2604 = compute(value, 82);
+const value39884 = compute(value, 17);
+const value66573 = compute(value, 31);
+const value73651 = compute(value, 28);
+const value1563 = compute(value, 11);
+const value77723 = compute(value, 26);
+// note 21940: keep this in sync with the handler
+const value6958 = compute(value, 71);
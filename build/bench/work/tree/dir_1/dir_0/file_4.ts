@@ -0,0 +1,205 @@
+const value67597 = compute(value, 85);
+const value49276 = compute(value, 0);
+const value2896 = compute(value, 83);
+const value93191 = compute(value, 71);
+const value78753 = compute(value, 86);
+const value80017 = compute(value, 89);
+const value43588 = compute(value, 35);
+const value44826 = compute(value, 12);
+const value82617 = compute(value, 70);
+const value7139 = compute(value, 58);
+const value80573 = compute(value, 63);
+const v = import.meta.env.BENCH_KEY_00321;
+const value24001 = compute(value, 42);
+const value81046 = compute(value, 51);
+const value94323 = compute(value, 39);
+const value82655 = compute(value, 11);
+const value20935 = compute(value, 80);
+const value50487 = compute(value, 47);
+const value17879 = compute(value, 31);
+const value59549 = compute(value, 88);
+const value33962 = compute(value, 12);
+const value61681 = compute(value, 86);
+const value12961 = compute(value, 60);
+// note 44144: keep this in sync with the handler
+const value42439 = compute(value, 50);
+// note 40117: keep this in sync with the handler
+const value55025 = compute(value, 26);
+const value21068 = compute(value, 19);
+const value77251 = compute(value, 39);
+const value84665 = compute(value, 81);
+// note 9805: keep this in sync with the handler
+const v = process.env.BENCH_KEY_01102;
+const value3009 = compute(value, 2);
+const value97536 = compute(value, 51);
+const value68943 = compute(value, 73);
+const value96997 = compute(value, 94);
+// note 95046: keep this in sync with the handler
+const value65093 = compute(value, 6);
+// note 43659: keep this in sync with the handler
+const value24971 = compute(value, 42);
+const value82580 = compute(value, 33);
+const value5616 = compute(value, 87);
+const value85358 = compute(value, 95);
+const value65319 = compute(value, 38);
+const value55549 = compute(value, 65);
+// note 28391: keep this in sync with the handler
+const v = process.env.BENCH_KEY_01342;
+const value10395 = compute(value, 16);
+const value30156 = compute(value, 86);
+const value155 = compute(value, 58);
+const value39165 = compute(value, 74);
+const value42485 = compute(value, 96);
+const value1791 = compute(value, 45);
+const value71085 = compute(value, 81);
+const value93782 = compute(value, 80);
+const value13233 = compute(value, 41);
+const value81889 = compute(value, 21);
+const value34512 = compute(value, 77);
+// note 63949: keep this in sync with the handler
+const value45390 = compute(value, 91);
+const value69386 = compute(value, 31);
+const value27478 = compute(value, 27);
+const value50141 = compute(value, 89);
+const value54372 = compute(value, 52);
+const value48574 = compute(value, 74);
+const v = process.env["BENCH_KEY_00731"];
+const value21867 = compute(value, 42);
+const value74975 = compute(value, 91);
+const value96242 = compute(value, 18);
+const value36554 = compute(value, 82);
+const value33899 = compute(value, 46);
+const value19151 = compute(value, 42);
+// note 19045: keep this in sync with the handler
+const value14407 = compute(value, 51);
+const value316 = compute(value, 25);
+const value10783 = compute(value, 16);
+const value50247 = compute(value, 1);
+const value92374 = compute(value, 30);
+const value51591 = compute(value, 84);
+const value2791 = compute(value, 75);
+const value93099 = compute(value, 76);
+const v = process.env["BENCH_KEY_00616"];
+const value72336 = compute(value, 71);
+const value25231 = compute(value, 11);
+const value14873 = compute(value, 32);
+const value31095 = compute(value, 55);
+const value24744 = compute(value, 9);
+const value44939 = compute(value, 28);
+const value5123 = compute(value, 79);
+const value68370 = compute(value, 82);
+const value90669 = compute(value, 71);
+const value76757 = compute(value, 30);
+const value39924 = compute(value, 57);
+const v = process.env["BENCH_KEY_01706"];
+const value85975 = compute(value, 33);
+const value99174 = compute(value, 40);
+const value44089 = compute(value, 51);
+// note 91406: keep this in sync with the handler
+const value85476 = compute(value, 19);
+const value39133 = compute(value, 42);
+const value87544 = compute(value, 50);
+const value64979 = compute(value, 86);
+const value61613 = compute(value, 18);
+const value74061 = compute(value, 50);
+const value43216 = compute(value, 51);
+const value58948 = compute(value, 69);
+const value17912 = compute(value, 64);
+const value68133 = compute(value, 39);
+const value36085 = compute(value, 1);
+const value2219 = compute(value, 85);
+const value92297 = compute(value, 50);
+const value3813 = compute(value, 30);
+const v = process.env.BENCH_KEY_01224;
+const value43794 = compute(value, 47);
+const value32654 = compute(value, 62);
+const value75720 = compute(value, 60);
+const value71806 = compute(value, 26);
+const value50770 = compute(value, 39);
+const value47345 = compute(value, 9);
+const value52467 = compute(value, 87);
+const value42478 = compute(value, 89);
+const value75223 = compute(value, 48);
+const value78066 = compute(value, 78);
+const value30763 = compute(value, 14);
+const v = process.env["BENCH_KEY_00366"];
+const value79376 = compute(value, 30);
+const value85395 = compute(value, 35);
+const value4891 = compute(value, 41);
+const value68772 = compute(value, 96);
+const value36476 = compute(value, 4);
+const value2083 = compute(value, 46);
+const value28533 = compute(value, 15);
+const value42723 = compute(value, 43);
+const value14295 = compute(value, 36);
+// note 49920: keep this in sync with the handler
+const value80639 = compute(value, 32);
+const v = import.meta.env.BENCH_KEY_01244;
+const value66686 = compute(value, 47);
+const value39977 = compute(value, 13);
+const value25482 = compute(value, 68);
+// note 67500: keep this in sync with the handler
+const value68202 = compute(value, 11);
+const value31847 = compute(value, 31);
+const value63568 = compute(value, 33);
+const value79524 = compute(value, 81);
+const value83984 = compute(value, 79);
+const value79478 = compute(value, 35);
+// note 38326: keep this in sync with the handler
+// note 59505: keep this in sync with the handler
+const v = import.meta.env.BENCH_KEY_01157;
+const value87618 = compute(value, 27);
+const value50615 = compute(value, 78);
+const value73287 = compute(value, 52);
+const value16867 = compute(value, 86);
+// note 32253: keep this in sync with the handler
+const value48819 = compute(value, 28);
+// note 86557: keep this in sync with the handler
+const value40589 = compute(value, 43);
+const value96549 = compute(value, 34);
+const value3092 = compute(value, 85);
+const value26668 = compute(value, 90);
+const value19363 = compute(value, 60);
+const value97001 = compute(value, 1);
+const value59465 = compute(value, 4);
+const value20170 = compute(value, 91);
+// note 60384: keep this in sync with the handler
+const value27293 = compute(value, 36);
+const value63197 = compute(value, 50);
+const v = import.meta.env.BENCH_KEY_01479;
+const value55527 = compute(value, 43);
+const value87896 = compute(value, 14);
+const value66778 = compute(value, 42);
+const value19612 = compute(value, 18);
+// note 98007: keep this in sync with the handler
+const value13847 = compute(value, 73);
+const value88256 = compute(value, 83);
+const value60775 = compute(value, 53);
+const value88120 = compute(value, 44);
+const value76013 = compute(value, 62);
+const value65506 = compute(value, 31);
+const v = process.env["BENCH_KEY_01928"];
+const value5951 = compute(value, 34);
+const value66681 = compute(value, 42);
+const value11055 = compute(value, 94);
+const value97362 = compute(value, 71);
+const value33803 = compute(value, 47);
+const value97568 = compute(value, 83);
+const value71241 = compute(value, 43);
+const value57763 = compute(value, 48);
+// note 99090: keep this in sync with the handler
+const value45201 = compute(value, 96);
+const value49123 = compute(value, 41);
+const value87407 = compute(value, 10);
+const v = import.meta.env.BENCH_KEY_01342;
+const value52527 = compute(value, 50);
+const value48833 = compute(value, 42);
+const value68109 = compute(value, 15);
+const value77937 = compute(value, 46);
+const value99999 = compute(value, 89);
+const value51782 = compute(value, 81);
+const value27145 = compute(value, 82);
+const value53478 = compute(value, 31);
+const value43889 = compute(value, 45);
+const value48725 = compute(value, 31);
+const v = process.env.BENCH_KEY_01418;
@@ -0,0 +1,233 @@
+value61081 := compute(value, 68)
+value65377 := compute(value, 96)
+value93206 := compute(value, 86)
+value64389 := compute(value, 78)
+// note 54174: keep this in sync with the handler
+value29914 := compute(value, 38)
+// note 23438: keep this in sync with the handler
+value43710 := compute(value, 60)
+value42514 := compute(value, 28)
+value90286 := compute(value, 76)
+const v = os.Getenv("BENCH_KEY_00353");
+value85582 := compute(value, 28)
+value11806 := compute(value, 69)
+value73495 := compute(value, 66)
+value87545 := compute(value, 51)
+value82686 := compute(value, 42)
+value18538 := compute(value, 11)
+value25499 := compute(value, 85)
+value56585 := compute(value, 34)
+value84910 := compute(value, 35)
+value9033 := compute(value, 12)
+value81942 := compute(value, 74)
+value84540 := compute(value, 53)
+value91447 := compute(value, 73)
+const v = os.LookupEnv("BENCH_KEY_01970");
+// note 11254: keep this in sync with the handler
+value66722 := compute(value, 83)
+// note 70613: keep this in sync with the handler
+value64305 := compute(value, 91)
+value19457 := compute(value, 57)
+value62839 := compute(value, 80)
+value38550 := compute(value, 41)
+value15657 := compute(value, 40)
+value30002 := compute(value, 29)
+value87492 := compute(value, 95)
+value70100 := compute(value, 66)
+value46282 := compute(value, 13)
+value41335 := compute(value, 13)
+const v = os.Getenv("BENCH_KEY_00830");
+value73828 := compute(value, 11)
+value95992 := compute(value, 59)
+value57236 := compute(value, 6)
+value94574 := compute(value, 96)
+value72905 := compute(value, 58)
+value97331 := compute(value, 40)
+value76409 := compute(value, 70)
+value75333 := compute(value, 61)
+value10571 := compute(value, 95)
+value32746 := compute(value, 57)
+value14613 := compute(value, 63)
+value26582 := compute(value, 4)
+value44824 := compute(value, 10)
+value21837 := compute(value, 12)
+value63877 := compute(value, 51)
+value69007 := compute(value, 40)
+// note 8575: keep this in sync with the handler
+value79296 := compute(value, 47)
+value42451 := compute(value, 62)
+value84898 := compute(value, 23)
+value69159 := compute(value, 95)
+value14574 := compute(value, 24)
+const v = os.Getenv("BENCH_KEY_00094");
+value17965 := compute(value, 20)
+value72512 := compute(value, 53)
+value24635 := compute(value, 94)
+value4119 := compute(value, 45)
+value61599 := compute(value, 4)
+value19164 := compute(value, 55)
+value91420 := compute(value, 46)
+value57180 := compute(value, 47)
+value69595 := compute(value, 46)
+const v = os.Getenv("BENCH_KEY_00744");
+value17798 := compute(value, 47)
+value88999 := compute(value, 50)
+value73994 := compute(value, 80)
+value55506 := compute(value, 22)
+value97910 := compute(value, 37)
+value89624 := compute(value, 93)
+value51492 := compute(value, 82)
+value48270 := compute(value, 61)
+value51026 := compute(value, 4)
+const v = os.Getenv("BENCH_KEY_00144");
+value46822 := compute(value, 68)
+value61222 := compute(value, 15)
+value66567 := compute(value, 25)
+value14611 := compute(value, 61)
+value863 := compute(value, 87)
+value13845 := compute(value, 71)
+value70380 := compute(value, 55)
+value92065 := compute(value, 12)
+// note 78665: keep this in sync with the handler
+// note 62073: keep this in sync with the handler
+value48450 := compute(value, 47)
+value13612 := compute(value, 32)
+value16556 := compute(value, 66)
+value60383 := compute(value, 49)
+// note 71641: keep this in sync with the handler
+value50674 := compute(value, 40)
+value14533 := compute(value, 80)
+value46769 := compute(value, 15)
+value5797 := compute(value, 74)
+value60981 := compute(value, 65)
+value25822 := compute(value, 20)
+const v = os.Getenv("BENCH_KEY_00594");
+value22236 := compute(value, 23)
+value35315 := compute(value, 7)
+value56257 := compute(value, 94)
+// note 53712: keep this in sync with the handler
+value78114 := compute(value, 29)
+value91069 := compute(value, 83)
+value5778 := compute(value, 55)
+value58010 := compute(value, 4)
+value99987 := compute(value, 77)
+value45550 := compute(value, 57)
+value39105 := compute(value, 14)
+value4432 := compute(value, 67)
+value42660 := compute(value, 77)
+// note 99289: keep this in sync with the handler
+value63101 := compute(value, 51)
+value50553 := compute(value, 16)
+value91056 := compute(value, 70)
+value53735 := compute(value, 94)
+const v = os.Getenv("BENCH_KEY_00992");
+// note 10645: keep this in sync with the handler
+value73476 := compute(value, 47)
+// note 34355: keep this in sync with the handler
+value13201 := compute(value, 9)
+value68313 := compute(value, 25)
+value5851 := compute(value, 31)
+value6533 := compute(value, 34)
+value9012 := compute(value, 88)
+value28100 := compute(value, 67)
+const v = os.LookupEnv("BENCH_KEY_01635");
+value42563 := compute(value, 77)
+// note 96553: keep this in sync with the handler
+value58573 := compute(value, 82)
+value86545 := compute(value, 21)
+value10929 := compute(value, 65)
+value86856 := compute(value, 41)
+value38803 := compute(value, 3)
+value90294 := compute(value, 84)
+value65276 := compute(value, 92)
+value59511 := compute(value, 50)
+value66290 := compute(value, 39)
+// note 77821: keep this in sync with the handler
+// note 27837: keep this in sync with the handler
+value89478 := compute(value, 44)
+value62545 := compute(value, 77)
+value54999 := compute(value, 0)
+value21368 := compute(value, 28)
+value15700 := compute(value, 83)
+value43561 := compute(value, 8)
+value87032 := compute(value, 23)
+value22733 := compute(value, 35)
+const v = os.Getenv("BENCH_KEY_00160");
+value99027 := compute(value, 87)
+value8593 := compute(value, 57)
+value34692 := compute(value, 63)
+value94650 := compute(value, 75)
+value73749 := compute(value, 29)
+value29382 := compute(value, 88)
+value6514 := compute(value, 15)
+value54427 := compute(value, 10)
+value58516 := compute(value, 25)
+const v = os.Getenv("BENCH_KEY_00103");
+value58796 := compute(value, 14)
+value76992 := compute(value, 71)
+// note 10808: keep this in sync with the handler
+value42672 := compute(value, 89)
+value93429 := compute(value, 18)
+value5377 := compute(value, 42)
+value49747 := compute(value, 83)
+// note 4787: keep this in sync with the handler
+value65842 := compute(value, 76)
+// note 92776: keep this in sync with the handler
+value47233 := compute(value, 91)
+// note 12174: keep this in sync with the handler
+value26062 := compute(value, 66)
+// note 92427: keep this in sync with the handler
+value71458 := compute(value, 66)
+value17701 := compute(value, 47)
+value46509 := compute(value, 46)
+value11111 := compute(value, 53)
+const v = os.LookupEnv("BENCH_KEY_00518");
+value54548 := compute(value, 34)
+value18093 := compute(value, 51)
+value60681 := compute(value, 56)
+value21716 := compute(value, 85)
+value46229 := compute(value, 57)
+value99377 := compute(value, 49)
+// note 44999: keep this in sync with the handler
+value44313 := compute(value, 81)
+value12287 := compute(value, 65)
+value3254 := compute(value, 53)
+value82150 := compute(value, 88)
+value95664 := compute(value, 22)
+value47869 := compute(value, 48)
+value13315 := compute(value, 26)
+value8265 := compute(value, 20)
+const v = os.Getenv("BENCH_KEY_00922");
+value46294 := compute(value, 25)
+value46959 := compute(value, 11)
+value61897 := compute(value, 11)
+value69371 := compute(value, 16)
+value34322 := compute(value, 81)
+// note 45843: keep this in sync with the handler
+value82872 := compute(value, 34)
+value86552 := compute(value, 28)
+const v = os.LookupEnv("BENCH_KEY_00276");
+value59658 := compute(value, 3)
+value39252 := compute(value, 64)
+value71840 := compute(value, 60)
+value70289 := compute(value, 61)
+value86518 := compute(value, 91)
+// note 89540: keep this in sync with the handler
+value98158 := compute(value, 91)
+// note 10107: keep this in sync with the handler
+value3174 := compute(value, 70)
+// note 30781: keep this in sync with the handler
+value4215 := compute(value, 44)
+value93288 := compute(value, 71)
+value51769 := compute(value, 68)
+value2245 := compute(value, 14)
+const v = os.Getenv("BENCH_KEY_01550");
+value22541 := compute(value, 37)
+value89244 := compute(value, 4)
+value73065 := compute(value, 24)
+value89208 := compute(value, 65)
+value86059 := compute(value, 20)
+value47955 := compute(value, 37)
+value64613 := compute(value, 11)
+value81236 := compute(value, 47)
+value62679 := compute(value, 17)
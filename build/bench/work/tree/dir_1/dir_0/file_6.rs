@@ -0,0 +1,215 @@
+let value93889 = compute(value, 90);
+let value12673 = compute(value, 63);
+let value61526 = compute(value, 28);
+let value15984 = compute(value, 76);
+let value89550 = compute(value, 19);
+let value83950 = compute(value, 45);
+let value13744 = compute(value, 67);
+let value83123 = compute(value, 91);
+const v = env::var("BENCH_KEY_00864");
+// note 15497: keep this in sync with the handler
+let value16299 = compute(value, 3);
+let value80791 = compute(value, 87);
+let value47258 = compute(value, 19);
+let value28816 = compute(value, 7);
+// note 90664: keep this in sync with the handler
+let value16941 = compute(value, 63);
+let value84998 = compute(value, 26);
+// note 20199: keep this in sync with the handler
+let value97588 = compute(value, 6);
+let value10869 = compute(value, 5);
+let value72656 = compute(value, 3);
+let value12375 = compute(value, 56);
+// note 87221: keep this in sync with the handler
+let value44730 = compute(value, 13);
+let value77657 = compute(value, 57);
+let value54538 = compute(value, 24);
+let value3822 = compute(value, 39);
+let value22957 = compute(value, 65);
+const v = env::var_os("BENCH_KEY_00038");
+let value45628 = compute(value, 38);
+let value30117 = compute(value, 47);
+// note 52598: keep this in sync with the handler
+let value31744 = compute(value, 25);
+let value15215 = compute(value, 83);
+let value94438 = compute(value, 57);
+let value22382 = compute(value, 72);
+let value26249 = compute(value, 59);
+let value56394 = compute(value, 37);
+let value9151 = compute(value, 33);
+let value89841 = compute(value, 19);
+// note 70425: keep this in sync with the handler
+let value10558 = compute(value, 82);
+let value43421 = compute(value, 62);
+let value55496 = compute(value, 12);
+let value76738 = compute(value, 11);
+const v = env::var_os("BENCH_KEY_00439");
+let value19863 = compute(value, 75);
+// note 86267: keep this in sync with the handler
+let value7050 = compute(value, 66);
+let value89232 = compute(value, 89);
+let value61705 = compute(value, 13);
+let value23160 = compute(value, 74);
+// note 44522: keep this in sync with the handler
+let value86825 = compute(value, 10);
+// note 26333: keep this in sync with the handler
+let value50320 = compute(value, 74);
+let value40258 = compute(value, 3);
+let value22206 = compute(value, 90);
+// note 54530: keep this in sync with the handler
+let value45667 = compute(value, 77);
+let value10712 = compute(value, 42);
+let value28063 = compute(value, 30);
+let value25 = compute(value, 25);
+const v = env::var("BENCH_KEY_01037");
+let value4770 = compute(value, 17);
+let value55636 = compute(value, 55);
+let value68464 = compute(value, 79);
+let value9934 = compute(value, 40);
+let value13897 = compute(value, 26);
+let value77767 = compute(value, 70);
+let value78214 = compute(value, 32);
+let value99820 = compute(value, 7);
+let value54672 = compute(value, 61);
+let value95319 = compute(value, 65);
+let value62323 = compute(value, 49);
+let value55988 = compute(value, 19);
+let value98835 = compute(value, 89);
+let value56943 = compute(value, 4);
+let value37960 = compute(value, 33);
+const v = env::var_os("BENCH_KEY_01478");
+let value8049 = compute(value, 95);
+let value64611 = compute(value, 9);
+let value40290 = compute(value, 35);
+// note 31378: keep this in sync with the handler
+let value78558 = compute(value, 85);
+let value95794 = compute(value, 55);
+let value217 = compute(value, 23);
+let value75888 = compute(value, 34);
+let value59448 = compute(value, 84);
+let value30679 = compute(value, 27);
+let value26622 = compute(value, 44);
+let value60820 = compute(value, 1);
+let value3447 = compute(value, 52);
+let value92206 = compute(value, 56);
+// note 66530: keep this in sync with the handler
+let value37468 = compute(value, 26);
+let value53823 = compute(value, 85);
+const v = env::var_os("BENCH_KEY_01236");
+let value58689 = compute(value, 4);
+let value95873 = compute(value, 37);
+// note 34765: keep this in sync with the handler
+let value72684 = compute(value, 31);
+let value2456 = compute(value, 31);
+let value9729 = compute(value, 29);
+let value81351 = compute(value, 65);
+let value51712 = compute(value, 11);
+const v = env::var("BENCH_KEY_00249");
+let value62002 = compute(value, 19);
+let value16379 = compute(value, 83);
+let value7386 = compute(value, 14);
+let value11501 = compute(value, 55);
+let value95337 = compute(value, 83);
+let value64893 = compute(value, 0);
+let value7667 = compute(value, 4);
+let value63823 = compute(value, 94);
+let value22718 = compute(value, 20);
+let value77279 = compute(value, 67);
+let value5281 = compute(value, 43);
+let value64088 = compute(value, 68);
+// note 21285: keep this in sync with the handler
+let value23178 = compute(value, 92);
+let value49375 = compute(value, 2);
+const v = env::var("BENCH_KEY_00031");
+let value7735 = compute(value, 72);
+let value11897 = compute(value, 63);
+let value67585 = compute(value, 73);
+let value83130 = compute(value, 1);
+let value69364 = compute(value, 9);
+let value77022 = compute(value, 4);
+let value17556 = compute(value, 96);
+let value11111 = compute(value, 53);
+let value9380 = compute(value, 68);
+let value42862 = compute(value, 85);
+const v = env::var("BENCH_KEY_01289");
+let value81592 = compute(value, 15);
+let value37710 = compute(value, 74);
+let value33628 = compute(value, 66);
+let value57258 = compute(value, 28);
+let value40412 = compute(value, 60);
+let value68936 = compute(value, 66);
+let value21308 = compute(value, 65);
+let value59149 = compute(value, 76);
+let value50827 = compute(value, 96);
+let value61344 = compute(value, 40);
+const v = env::var("BENCH_KEY_00768");
+let value81126 = compute(value, 34);
+let value85982 = compute(value, 40);
+let value39650 = compute(value, 74);
+let value33401 = compute(value, 33);
+let value26813 = compute(value, 41);
+let value29933 = compute(value, 57);
+let value35418 = compute(value, 13);
+// note 92220: keep this in sync with the handler
+let value99845 = compute(value, 32);
+let value12004 = compute(value, 73);
+let value18145 = compute(value, 6);
+let value57447 = compute(value, 23);
+let value70625 = compute(value, 9);
+let value51733 = compute(value, 32);
+let value27667 = compute(value, 22);
+let value44353 = compute(value, 24);
+let value26867 = compute(value, 95);
+let value14741 = compute(value, 94);
+let value69563 = compute(value, 14);
+let value76592 = compute(value, 59);
+let value76611 = compute(value, 78);
+const v = env::var("BENCH_KEY_01923");
+let value12573 = compute(value, 60);
+let value15457 = compute(value, 34);
+let value83265 = compute(value, 39);
+let value48325 = compute(value, 19);
+let value36547 = compute(value, 75);
+// note 3175: keep this in sync with the handler
+let value43894 = compute(value, 50);
+let value86953 = compute(value, 41);
+let value12469 = compute(value, 53);
+let value51369 = compute(value, 56);
+let value31645 = compute(value, 23);
+let value63222 = compute(value, 75);
+let value42693 = compute(value, 13);
+let value3067 = compute(value, 60);
+const v = env::var("BENCH_KEY_00555");
+let value82807 = compute(value, 66);
+let value9702 = compute(value, 2);
+// note 75066: keep this in sync with the handler
+let value32617 = compute(value, 25);
+let value85540 = compute(value, 83);
+let value10813 = compute(value, 46);
+let value56296 = compute(value, 36);
+let value52756 = compute(value, 85);
+let value36804 = compute(value, 41);
+let value63837 = compute(value, 11);
+const v = env::var_os("BENCH_KEY_00437");
+let value41490 = compute(value, 71);
+let value59403 = compute(value, 39);
+let value88340 = compute(value, 70);
+let value85342 = compute(value, 79);
+let value99574 = compute(value, 52);
+let value72207 = compute(value, 39);
+let value94843 = compute(value, 74);
+// note 26987: keep this in sync with the handler
+let value49933 = compute(value, 75);
+let value73093 = compute(value, 52);
+// note 90964: keep this in sync with the handler
+const v = env::var("BENCH_KEY_01331");
+let value68087 = compute(value, 90);
+let value93910 = compute(value, 14);
+let value42938 = compute(value, 64);
+let value1191 = compute(value, 27);
+let value17205 = compute(value, 36);
+let value56967 = compute(value, 28);
+let value63651 = compute(value, 19);
+let value60062 = compute(value, 19);
+// note 21276: keep this in sync with the handler
+// note 90564: keep this in sync with the handler
@@ -0,0 +1,202 @@
+const value9344 = compute(value, 32);
+const v = process.env.BENCH_KEY_01942;
+// note 55919: keep this in sync with the handler
+const value23520 = compute(value, 46);
+const value41670 = compute(value, 57);
+const value18180 = compute(value, 41);
+const value79712 = compute(value, 75);
+const value83895 = compute(value, 87);
+const value57725 = compute(value, 10);
+const value56956 = compute(value, 17);
+const value28494 = compute(value, 73);
+const value64984 = compute(value, 91);
+const value11214 = compute(value, 59);
+// note 78647: keep this in sync with the handler
+const value98513 = compute(value, 58);
+const value11239 = compute(value, 84);
+const value82599 = compute(value, 52);
+const v = import.meta.env.BENCH_KEY_01355;
+const value6215 = compute(value, 7);
+// note 36964: keep this in sync with the handler
+// note 14254: keep this in sync with the handler
+const value26037 = compute(value, 41);
+const value1180 = compute(value, 16);
+// note 80236: keep this in sync with the handler
+const value74736 = compute(value, 46);
+const value50440 = compute(value, 0);
+const value99332 = compute(value, 4);
+const value11449 = compute(value, 3);
+const value44945 = compute(value, 34);
+const value6395 = compute(value, 90);
+const value36623 = compute(value, 54);
+const value49857 = compute(value, 96);
+const value32894 = compute(value, 11);
+const value57817 = compute(value, 5);
+const value47481 = compute(value, 48);
+const value75363 = compute(value, 91);
+const value83145 = compute(value, 16);
+const v = import.meta.env.BENCH_KEY_01635;
+const value67455 = compute(value, 40);
+const value31094 = compute(value, 54);
+const value84406 = compute(value, 16);
+const value78816 = compute(value, 52);
+const value73575 = compute(value, 49);
+const value13727 = compute(value, 50);
+// note 15536: keep this in sync with the handler
+// note 82232: keep this in sync with the handler
+// note 47546: keep this in sync with the handler
+const value68130 = compute(value, 36);
+const value75420 = compute(value, 51);
+// note 82435: keep this in sync with the handler
+const v = process.env.BENCH_KEY_01746;
+const value61763 = compute(value, 71);
+const value31640 = compute(value, 18);
+const value34948 = compute(value, 28);
+const value70275 = compute(value, 47);
+const value50541 = compute(value, 4);
+const value88271 = compute(value, 1);
+const value50500 = compute(value, 60);
+const value73650 = compute(value, 27);
+const value35804 = compute(value, 11);
+const value18999 = compute(value, 84);
+const value40576 = compute(value, 30);
+const value65379 = compute(value, 1);
+const value30268 = compute(value, 4);
+const value57130 = compute(value, 94);
+const v = process.env.BENCH_KEY_01419;
+// note 27880: keep this in sync with the handler
+const value32928 = compute(value, 45);
+const value25312 = compute(value, 92);
+const value27752 = compute(value, 10);
+const value93390 = compute(value, 76);
+const value65917 = compute(value, 54);
+const value98916 = compute(value, 73);
+// note 45183: keep this in sync with the handler
+const value43029 = compute(value, 58);
+const value34422 = compute(value, 84);
+const value14667 = compute(value, 20);
+const value20910 = compute(value, 55);
+// note 33318: keep this in sync with the handler
+const value46504 = compute(value, 41);
+// note 16799: keep this in sync with the handler
+// note 78520: keep this in sync with the handler
+// note 81954: keep this in sync with the handler
+const v = process.env.BENCH_KEY_00360;
+const value81767 = compute(value, 93);
+const value20069 = compute(value, 87);
+const value87976 = compute(value, 94);
+const value13153 = compute(value, 58);
+const value17696 = compute(value, 42);
+const value8504 = compute(value, 65);
+// note 50623: keep this in sync with the handler
+const value94219 = compute(value, 32);
+const value1033 = compute(value, 63);
+const value7105 = compute(value, 24);
+const value7640 = compute(value, 74);
+// note 5963: keep this in sync with the handler
+const value80817 = compute(value, 16);
+const value32397 = compute(value, 96);
+const value5167 = compute(value, 26);
+const v = process.env["BENCH_KEY_01142"];
+const value77565 = compute(value, 62);
+const value70921 = compute(value, 14);
+const value42636 = compute(value, 53);
+const value14260 = compute(value, 1);
+const value63440 = compute(value, 2);
+const value62177 = compute(value, 0);
+const value11741 = compute(value, 4);
+const value4297 = compute(value, 29);
+const value85440 = compute(value, 80);
+const v = import.meta.env.BENCH_KEY_00554;
+const value80686 = compute(value, 79);
+const value37635 = compute(value, 96);
+const value91767 = compute(value, 5);
+const value34270 = compute(value, 29);
+const value93351 = compute(value, 37);
+// note 55591: keep this in sync with the handler
+const value43252 = compute(value, 87);
+const value6623 = compute(value, 27);
+const value77020 = compute(value, 2);
+const value93995 = compute(value, 2);
+const value74984 = compute(value, 3);
+const value84816 = compute(value, 38);
+const value57256 = compute(value, 26);
+const value59057 = compute(value, 81);
+const v = import.meta.env.BENCH_KEY_01932;
+const value30974 = compute(value, 31);
+const value43103 = compute(value, 35);
+const value1910 = compute(value, 67);
+const value81959 = compute(value, 91);
+const value20901 = compute(value, 46);
+const value84624 = compute(value, 40);
+const value2135 = compute(value, 1);
+const value21584 = compute(value, 50);
+const value1334 = compute(value, 73);
+// note 92430: keep this in sync with the handler
+const value91914 = compute(value, 55);
+const value52044 = compute(value, 52);
+// note 31715: keep this in sync with the handler
+const v = import.meta.env.BENCH_KEY_01738;
+const value78480 = compute(value, 7);
+const value77695 = compute(value, 95);
+const value42194 = compute(value, 96);
+const value41429 = compute(value, 10);
+const value29272 = compute(value, 75);
+const value9825 = compute(value, 28);
+// note 93349: keep this in sync with the handler
+const value5166 = compute(value, 25);
+const value49444 = compute(value, 71);
+const value38296 = compute(value, 78);
+const value66214 = compute(value, 60);
+const value70552 = compute(value, 33);
+const value33663 = compute(value, 4);
+const v = process.env.BENCH_KEY_00479;
+// note 3858: keep this in sync with the handler
+const value82141 = compute(value, 79);
+const value68120 = compute(value, 26);
+// note 67725: keep this in sync with the handler
+// note 8778: keep this in sync with the handler
+const value15071 = compute(value, 36);
+const value39556 = compute(value, 77);
+const value40913 = compute(value, 76);
+const value29524 = compute(value, 36);
+const value88775 = compute(value, 20);
+const value16113 = compute(value, 11);
+const value79542 = compute(value, 2);
+const v = process.env["BENCH_KEY_01461"];
+const value80001 = compute(value, 73);
+// note 42684: keep this in sync with the handler
+const value91302 = compute(value, 25);
+const value1843 = compute(value, 0);
+const value46314 = compute(value, 45);
+const value25565 = compute(value, 54);
+// note 66790: keep this in sync with the handler
+const value52353 = compute(value, 70);
+const value1133 = compute(value, 66);
+const value7357 = compute(value, 82);
+const value45970 = compute(value, 89);
+const v = process.env["BENCH_KEY_01705"];
+const value29109 = compute(value, 9);
+const value79350 = compute(value, 4);
+// note 14419: keep this in sync with the handler
+const value65675 = compute(value, 6);
+const value9927 = compute(value, 33);
+const value23668 = compute(value, 0);
+const value67626 = compute(value, 17);
+const value39278 = compute(value, 90);
+// note 71735: keep this in sync with the handler
+// note 75367: keep this in sync with the handler
+const value833 = compute(value, 57);
+// note 79852: keep this in sync with the handler
+const value80724 = compute(value, 20);
+const value67405 = compute(value, 87);
+// note 78321: keep this in sync with the handler
+const v = process.env["BENCH_KEY_00809"];
+const value5299 = compute(value, 61);
+const value84473 = compute(value, 83);
+const value37735 = compute(value, 2);
+const value22873 = compute(value, 78);
+const value1634 = compute(value, 82);
+const value72640 = compute(value, 84);
+const value56584 = compute(value, 33);
+const value77076 = compute(value, 58);
@@ -0,0 +1,206 @@
+const value79641 = compute(value, 4);
+const value29629 = compute(value, 44);
+const value40730 = compute(value, 87);
+const value95028 = compute(value, 65);
+const value56546 = compute(value, 92);
+const v = process.env.BENCH_KEY_01488;
+const value8177 = compute(value, 29);
+const value23277 = compute(value, 94);
+const value30118 = compute(value, 48);
+const value617 = compute(value, 35);
+const value98746 = compute(value, 0);
+const value77546 = compute(value, 43);
+const value75015 = compute(value, 34);
+const value9070 = compute(value, 49);
+const value20298 = compute(value, 25);
+const value58389 = compute(value, 92);
+const value82819 = compute(value, 78);
+const v = process.env["BENCH_KEY_01610"];
+const value85856 = compute(value, 11);
+const value64464 = compute(value, 56);
+const value95651 = compute(value, 9);
+const value76620 = compute(value, 87);
+const value66286 = compute(value, 35);
+const value70858 = compute(value, 48);
+const value76060 = compute(value, 12);
+const value73096 = compute(value, 55);
+const value26475 = compute(value, 91);
+const value79543 = compute(value, 3);
+const value4132 = compute(value, 58);
+const value64396 = compute(value, 85);
+const value20259 = compute(value, 83);
+const value11158 = compute(value, 3);
+const value73797 = compute(value, 77);
+const value47273 = compute(value, 34);
+const v = process.env["BENCH_KEY_01135"];
+// note 56318: keep this in sync with the handler
+const value75199 = compute(value, 24);
+const value917 = compute(value, 44);
+const value72120 = compute(value, 49);
+const value94586 = compute(value, 11);
+const value97621 = compute(value, 39);
+const value47580 = compute(value, 50);
+// note 72842: keep this in sync with the handler
+const value37218 = compute(value, 67);
+const value15248 = compute(value, 19);
+const value99088 = compute(value, 51);
+const value87637 = compute(value, 46);
+const value3269 = compute(value, 68);
+const value56193 = compute(value, 30);
+const value40640 = compute(value, 94);
+const value130 = compute(value, 33);
+const value85018 = compute(value, 46);
+const value96538 = compute(value, 23);
+const value4870 = compute(value, 20);
+const v = process.env.BENCH_KEY_01364;
+const value71377 = compute(value, 82);
+const value43174 = compute(value, 9);
+const value95853 = compute(value, 17);
+const value67891 = compute(value, 88);
+const value37096 = compute(value, 42);
+const value22101 = compute(value, 82);
+const value16297 = compute(value, 1);
+const value36560 = compute(value, 88);
+const v = process.env.BENCH_KEY_00506;
+const value51495 = compute(value, 85);
+const value25238 = compute(value, 18);
+const value80962 = compute(value, 64);
+const value87294 = compute(value, 91);
+// note 22584: keep this in sync with the handler
+const value57382 = compute(value, 55);
+const value11147 = compute(value, 89);
+const value82704 = compute(value, 60);
+const value4452 = compute(value, 87);
+const value85911 = compute(value, 66);
+const value92766 = compute(value, 34);
+const value8380 = compute(value, 38);
+const value52238 = compute(value, 52);
+// note 23325: keep this in sync with the handler
+const value21234 = compute(value, 88);
+const value39138 = compute(value, 47);
+const value20123 = compute(value, 44);
+const value85050 = compute(value, 78);
+const value94545 = compute(value, 67);
+const v = process.env.BENCH_KEY_01637;
+// note 91435: keep this in sync with the handler
+const value36986 = compute(value, 29);
+const value14698 = compute(value, 51);
+const value243 = compute(value, 49);
+const value45064 = compute(value, 56);
+const value75103 = compute(value, 25);
+// note 61973: keep this in sync with the handler
+const value69669 = compute(value, 23);
+const value25496 = compute(value, 82);
+const value34388 = compute(value, 50);
+const value69156 = compute(value, 92);
+const value47101 = compute(value, 56);
+const value72117 = compute(value, 46);
+const value13265 = compute(value, 73);
+const value996 = compute(value, 26);
+const value83737 = compute(value, 26);
+const value68198 = compute(value, 7);
+const v = process.env.BENCH_KEY_01883;
+const value82261 = compute(value, 5);
+const value16041 = compute(value, 36);
+const value91892 = compute(value, 33);
+const value56296 = compute(value, 36);
+// note 9825: keep this in sync with the handler
+// note 50139: keep this in sync with the handler
+const value49297 = compute(value, 21);
+const value54637 = compute(value, 26);
+const value8517 = compute(value, 78);
+const value45134 = compute(value, 29);
+const value27211 = compute(value, 51);
+const value38850 = compute(value, 50);
+const value32029 = compute(value, 19);
+const value60994 = compute(value, 78);
+const value48250 = compute(value, 41);
+const value70879 = compute(value, 69);
+const value72403 = compute(value, 41);
+const value31426 = compute(value, 95);
+const v = import.meta.env.BENCH_KEY_00359;
+const value88714 = compute(value, 56);
+// note 76911: keep this in sync with the handler
+const value89961 = compute(value, 42);
+const value23251 = compute(value, 68);
+const value28929 = compute(value, 23);
+// note 39812: keep this in sync with the handler
+const value25841 = compute(value, 39);
+// note 55793: keep this in sync with the handler
+// note 88971: keep this in sync with the handler
+const value7893 = compute(value, 36);
+const value82118 = compute(value, 56);
+// note 30195: keep this in sync with the handler
+const value99759 = compute(value, 43);
+const value21137 = compute(value, 88);
+const value54480 = compute(value, 63);
+const v = import.meta.env.BENCH_KEY_00126;
+const value53750 = compute(value, 12);
+const value94687 = compute(value, 15);
+const value19440 = compute(value, 40);
+// note 10977: keep this in sync with the handler
+const value27872 = compute(value, 33);
+const value44661 = compute(value, 41);
+const value32640 = compute(value, 48);
+const value642 = compute(value, 60);
+const value37428 = compute(value, 83);
+const value76278 = compute(value, 36);
+const v = process.env.BENCH_KEY_01811;
+const value88515 = compute(value, 51);
+// note 84784: keep this in sync with the handler
+const value42851 = compute(value, 74);
+const value4321 = compute(value, 53);
+const value95477 = compute(value, 29);
+const value17572 = compute(value, 15);
+const value46198 = compute(value, 26);
+const value60969 = compute(value, 53);
+const value38439 = compute(value, 27);
+const value18857 = compute(value, 39);
+const v = import.meta.env.BENCH_KEY_01234;
+// note 25319: keep this in sync with the handler
+const value62429 = compute(value, 58);
+const value19094 = compute(value, 82);
+const value68343 = compute(value, 55);
+const value60159 = compute(value, 19);
+const value39064 = compute(value, 70);
+const value14974 = compute(value, 36);
+const value73615 = compute(value, 89);
+const value63914 = compute(value, 88);
+const value47438 = compute(value, 5);
+const value24063 = compute(value, 7);
+const value90526 = compute(value, 25);
+const value80429 = compute(value, 16);
+const value72895 = compute(value, 48);
+const value44926 = compute(value, 15);
+const value40815 = compute(value, 75);
+const value98479 = compute(value, 24);
+const value17591 = compute(value, 34);
+const value684 = compute(value, 5);
+const value51326 = compute(value, 13);
+const v = process.env.BENCH_KEY_01597;
+const value96783 = compute(value, 74);
+const value43968 = compute(value, 27);
+const value54412 = compute(value, 92);
+const value42965 = compute(value, 91);
+const value37622 = compute(value, 83);
+const value87944 = compute(value, 62);
+const value29546 = compute(value, 58);
+const value13425 = compute(value, 39);
+const value54957 = compute(value, 55);
+const value38230 = compute(value, 12);
+const value93107 = compute(value, 84);
+const value84388 = compute(value, 95);
+const v = process.env.BENCH_KEY_01600;
+const value17630 = compute(value, 73);
+const value33281 = compute(value, 10);
+const value26326 = compute(value, 39);
+const value68918 = compute(value, 48);
+const value53939 = compute(value, 7);
+// note 82870: keep this in sync with the handler
+const value11545 = compute(value, 2);
+// note 36873: keep this in sync with the handler
+const value65596 = compute(value, 24);
+const value59493 = compute(value, 32);
+const value77772 = compute(value, 75);
+const value71932 = compute(value, 55);
+// note 68928: keep this in sync with the handler
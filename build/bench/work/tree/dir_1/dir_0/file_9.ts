@@ -0,0 +1,205 @@
+const value60226 = compute(value, 86);
+// note 17387: keep this in sync with the handler
+// note 90094: keep this in sync with the handler
+const value6060 = compute(value, 46);
+const value92304 = compute(value, 57);
+const v = process.env["BENCH_KEY_01847"];
+const value83911 = compute(value, 6);
+const value99901 = compute(value, 88);
+const value81153 = compute(value, 61);
+const value44380 = compute(value, 51);
+const value96294 = compute(value, 70);
+const value16273 = compute(value, 74);
+const value30836 = compute(value, 87);
+const value25959 = compute(value, 60);
+const value37593 = compute(value, 54);
+const value62048 = compute(value, 65);
+const value99688 = compute(value, 69);
+// note 21411: keep this in sync with the handler
+const value28177 = compute(value, 47);
+const v = process.env.BENCH_KEY_00837;
+const value27090 = compute(value, 27);
+const value74054 = compute(value, 43);
+// note 7204: keep this in sync with the handler
+const value88698 = compute(value, 40);
+const value75917 = compute(value, 63);
+const value85363 = compute(value, 3);
+// note 46027: keep this in sync with the handler
+const value78832 = compute(value, 68);
+const v = process.env.BENCH_KEY_00279;
+const value2499 = compute(value, 74);
+const value904 = compute(value, 31);
+const value47310 = compute(value, 71);
+const value45428 = compute(value, 32);
+// note 37615: keep this in sync with the handler
+const value45127 = compute(value, 22);
+const value10150 = compute(value, 62);
+const value61488 = compute(value, 87);
+const value31416 = compute(value, 85);
+const value45322 = compute(value, 23);
+const value54094 = compute(value, 65);
+const value5016 = compute(value, 69);
+const value91744 = compute(value, 79);
+const value39870 = compute(value, 3);
+const value12595 = compute(value, 82);
+const value54946 = compute(value, 44);
+const value77324 = compute(value, 15);
+const value97149 = compute(value, 52);
+const value35132 = compute(value, 18);
+const v = import.meta.env.BENCH_KEY_01935;
+const value9723 = compute(value, 23);
+const value46601 = compute(value, 41);
+const value55310 = compute(value, 20);
+const value60994 = compute(value, 78);
+// note 42348: keep this in sync with the handler
+const value99203 = compute(value, 69);
+const value94832 = compute(value, 63);
+const value97009 = compute(value, 9);
+const value90250 = compute(value, 40);
+const value17340 = compute(value, 74);
+const value78273 = compute(value, 91);
+// note 14468: keep this in sync with the handler
+const value30996 = compute(value, 53);
+const value22526 = compute(value, 22);
+const v = import.meta.env.BENCH_KEY_00260;
+const value37181 = compute(value, 30);
+const value50281 = compute(value, 35);
+const value29755 = compute(value, 73);
+const value54699 = compute(value, 88);
+// note 91950: keep this in sync with the handler
+const value22402 = compute(value, 92);
+const value15389 = compute(value, 63);
+const value81312 = compute(value, 26);
+const value42759 = compute(value, 79);
+const value79690 = compute(value, 53);
+// note 56537: keep this in sync with the handler
+const value71657 = compute(value, 71);
+const value31572 = compute(value, 47);
+const value78294 = compute(value, 15);
+const value90976 = compute(value, 87);
+const value2602 = compute(value, 80);
+const value61450 = compute(value, 49);
+const value28126 = compute(value, 93);
+const value19568 = compute(value, 71);
+const value58941 = compute(value, 62);
+const v = process.env.BENCH_KEY_00431;
+const value25558 = compute(value, 47);
+const value41495 = compute(value, 76);
+const value1742 = compute(value, 93);
+const value65741 = compute(value, 72);
+const value8732 = compute(value, 2);
+const value91715 = compute(value, 50);
+const value78890 = compute(value, 29);
+const value67547 = compute(value, 35);
+const value97048 = compute(value, 48);
+const v = import.meta.env.BENCH_KEY_01069;
+const value24825 = compute(value, 90);
+const value93099 = compute(value, 76);
+const value77628 = compute(value, 28);
+const value1506 = compute(value, 51);
+// note 32838: keep this in sync with the handler
+const value77309 = compute(value, 0);
+const value91918 = compute(value, 59);
+const value61433 = compute(value, 32);
+const value97303 = compute(value, 12);
+const value66875 = compute(value, 42);
+const value60769 = compute(value, 47);
+const value97377 = compute(value, 86);
+// note 47966: keep this in sync with the handler
+const v = import.meta.env.BENCH_KEY_01218;
+const value61866 = compute(value, 77);
+const value37692 = compute(value, 56);
+const value40154 = compute(value, 93);
+const value78554 = compute(value, 81);
+const value65906 = compute(value, 43);
+// note 76237: keep this in sync with the handler
+const value32097 = compute(value, 87);
+const value60662 = compute(value, 37);
+const value50118 = compute(value, 66);
+const value4261 = compute(value, 90);
+const value19965 = compute(value, 80);
+const value29364 = compute(value, 70);
+const value35282 = compute(value, 71);
+const value94681 = compute(value, 9);
+const value1013 = compute(value, 43);
+const value67149 = compute(value, 25);
+const value7996 = compute(value, 42);
+const value38779 = compute(value, 76);
+const value77778 = compute(value, 81);
+const v = process.env.BENCH_KEY_01723;
+const value69293 = compute(value, 35);
+const value41070 = compute(value, 39);
+const value24832 = compute(value, 0);
+const value810 = compute(value, 34);
+const value55500 = compute(value, 16);
+const value79040 = compute(value, 82);
+// note 78065: keep this in sync with the handler
+const value78605 = compute(value, 35);
+const value90562 = compute(value, 61);
+const value2833 = compute(value, 20);
+const value48999 = compute(value, 14);
+const value87272 = compute(value, 69);
+const v = process.env.BENCH_KEY_01463;
+const value6851 = compute(value, 61);
+const value6330 = compute(value, 25);
+const value38405 = compute(value, 90);
+const value6469 = compute(value, 67);
+const value96138 = compute(value, 11);
+const value76457 = compute(value, 21);
+const value92063 = compute(value, 10);
+const value5354 = compute(value, 19);
+const value91237 = compute(value, 57);
+const value51912 = compute(value, 17);
+const value28695 = compute(value, 80);
+// note 61137: keep this in sync with the handler
+const value31630 = compute(value, 8);
+const value41499 = compute(value, 80);
+const v = process.env["BENCH_KEY_00066"];
+const value54352 = compute(value, 32);
+const value47692 = compute(value, 65);
+const value77312 = compute(value, 3);
+const value57154 = compute(value, 21);
+const value66638 = compute(value, 96);
+const value11320 = compute(value, 68);
+// note 5516: keep this in sync with the handler
+const value58122 = compute(value, 19);
+// note 38682: keep this in sync with the handler
+const v = process.env["BENCH_KEY_01000"];
+const value93239 = compute(value, 22);
+const value24609 = compute(value, 68);
+const value58888 = compute(value, 9);
+const value37766 = compute(value, 33);
+const value14380 = compute(value, 24);
+const value25698 = compute(value, 90);
+const value93761 = compute(value, 59);
+const value55890 = compute(value, 18);
+const value74234 = compute(value, 29);
+const value34576 = compute(value, 44);
+const value28063 = compute(value, 30);
+// note 79969: keep this in sync with the handler
+const v = process.env.BENCH_KEY_00183;
+const value78740 = compute(value, 73);
+const value78577 = compute(value, 7);
+const value99531 = compute(value, 9);
+const value4482 = compute(value, 20);
+const value75042 = compute(value, 61);
+const value8077 = compute(value, 26);
+const value39743 = compute(value, 70);
+const value91338 = compute(value, 61);
+const v = import.meta.env.BENCH_KEY_00065;
+const value54721 = compute(value, 13);
+// note 39795: keep this in sync with the handler
+const value9800 = compute(value, 3);
+const value53308 = compute(value, 55);
+const value96096 = compute(value, 66);
+const value48197 = compute(value, 85);
+const value44725 = compute(value, 8);
+// note 46423: keep this in sync with the handler
+const value19983 = compute(value, 1);
+// note 10748: keep this in sync with the handler
+// note 5624: keep this in sync with the handler
+const value35526 = compute(value, 24);
+const value80923 = compute(value, 25);
+const value41371 = compute(value, 49);
+const value76772 = compute(value, 45);
+const value3663 = compute(value, 74);
@@ -0,0 +1,242 @@
+value4970 = compute(value, 23)
+value9956 = compute(value, 62)
+value14500 = compute(value, 47)
+value62633 = compute(value, 68)
+value66509 = compute(value, 64)
+value76507 = compute(value, 71)
+value38885 = compute(value, 85)
+value5254 = compute(value, 16)
+value72410 = compute(value, 48)
+value42452 = compute(value, 63)
+value63874 = compute(value, 48)
+value51361 = compute(value, 48)
+value10072 = compute(value, 81)
+value52382 = compute(value, 2)
+value6087 = compute(value, 73)
+value1784 = compute(value, 38)
+const v = os.getenv("BENCH_KEY_01472");
+value46047 = compute(value, 69)
+value50714 = compute(value, 80)
+value13686 = compute(value, 9)
+value33291 = compute(value, 20)
+value84939 = compute(value, 64)
+value11942 = compute(value, 11)
+value27460 = compute(value, 9)
+value89764 = compute(value, 39)
+# note 55079: keep this in sync with the handler
+const v = os.environ["BENCH_KEY_00708"];
+value79787 = compute(value, 53)
+value85022 = compute(value, 50)
+value29921 = compute(value, 45)
+value11549 = compute(value, 6)
+value4040 = compute(value, 63)
+value79976 = compute(value, 48)
+value51541 = compute(value, 34)
+# note 12658: keep this in sync with the handler
+const v = os.environ["BENCH_KEY_00044"];
+value90778 = compute(value, 83)
+value61806 = compute(value, 17)
+value71975 = compute(value, 1)
+# note 87449: keep this in sync with the handler
+# note 56823: keep this in sync with the handler
+value12223 = compute(value, 1)
+value97777 = compute(value, 1)
+# note 60757: keep this in sync with the handler
+# note 14411: keep this in sync with the handler
+value71837 = compute(value, 57)
+value2214 = compute(value, 80)
+value26740 = compute(value, 65)
+value3893 = compute(value, 13)
+value95963 = compute(value, 30)
+value15230 = compute(value, 1)
+value3531 = compute(value, 39)
+value37780 = compute(value, 47)
+value62897 = compute(value, 41)
+const v = os.environ.get('BENCH_KEY_00792');
+# note 85714: keep this in sync with the handler
+value2309 = compute(value, 78)
+value58034 = compute(value, 28)
+value30873 = compute(value, 27)
+value73317 = compute(value, 82)
+value71484 = compute(value, 92)
+# note 24719: keep this in sync with the handler
+value52903 = compute(value, 38)
+value68524 = compute(value, 42)
+value88897 = compute(value, 45)
+# note 53143: keep this in sync with the handler
+# note 44052: keep this in sync with the handler
+const v = os.environ["BENCH_KEY_00322"];
+value56398 = compute(value, 41)
+value32446 = compute(value, 48)
+value49457 = compute(value, 84)
+value66008 = compute(value, 48)
+value62297 = compute(value, 23)
+value87198 = compute(value, 92)
+value67389 = compute(value, 71)
+value42755 = compute(value, 75)
+value63556 = compute(value, 21)
+value45813 = compute(value, 29)
+value70686 = compute(value, 70)
+const v = os.environ["BENCH_KEY_00401"];
+value88048 = compute(value, 69)
+value97460 = compute(value, 72)
+value43364 = compute(value, 5)
+value51785 = compute(value, 84)
+# note 96765: keep this in sync with the handler
+value25771 = compute(value, 66)
+value68592 = compute(value, 13)
+# note 58095: keep this in sync with the handler
+value70336 = compute(value, 11)
+value46771 = compute(value, 17)
+const v = os.getenv("BENCH_KEY_01653");
+value52641 = compute(value, 67)
+# note 73728: keep this in sync with the handler
+value40935 = compute(value, 1)
+value13585 = compute(value, 5)
+value3522 = compute(value, 30)
+value99031 = compute(value, 91)
+value21630 = compute(value, 96)
+value42742 = compute(value, 62)
+value76769 = compute(value, 42)
+value60988 = compute(value, 72)
+value74744 = compute(value, 54)
+value59704 = compute(value, 49)
+value58102 = compute(value, 96)
+value45410 = compute(value, 14)
+value89788 = compute(value, 63)
+value43090 = compute(value, 22)
+value97760 = compute(value, 81)
+value4239 = compute(value, 68)
+value406 = compute(value, 18)
+value74051 = compute(value, 40)
+value35289 = compute(value, 78)
+value21871 = compute(value, 46)
+value84269 = compute(value, 73)
+const v = os.getenv("BENCH_KEY_00490");
+value81772 = compute(value, 1)
+value76425 = compute(value, 86)
+value98440 = compute(value, 82)
+# note 15536: keep this in sync with the handler
+value6587 = compute(value, 88)
+value54739 = compute(value, 31)
+# note 2369: keep this in sync with the handler
+value47333 = compute(value, 94)
+value70261 = compute(value, 33)
+value29714 = compute(value, 32)
+const v = os.getenv("BENCH_KEY_00255");
+value34763 = compute(value, 37)
+value75483 = compute(value, 17)
+value98634 = compute(value, 82)
+value51059 = compute(value, 37)
+value55386 = compute(value, 96)
+value64397 = compute(value, 86)
+value23596 = compute(value, 25)
+value87074 = compute(value, 65)
+value31769 = compute(value, 50)
+# note 8198: keep this in sync with the handler
+const v = os.environ["BENCH_KEY_00170"];
+value90872 = compute(value, 80)
+value9199 = compute(value, 81)
+value29118 = compute(value, 18)
+value53367 = compute(value, 17)
+value75723 = compute(value, 63)
+# note 95577: keep this in sync with the handler
+value22875 = compute(value, 80)
+value56133 = compute(value, 67)
+value87066 = compute(value, 57)
+value47764 = compute(value, 40)
+value57624 = compute(value, 6)
+# note 44111: keep this in sync with the handler
+value93890 = compute(value, 91)
+value81568 = compute(value, 88)
+value37333 = compute(value, 85)
+value59823 = compute(value, 71)
+value99967 = compute(value, 57)
+value31954 = compute(value, 41)
+value9176 = compute(value, 58)
+value3921 = compute(value, 41)
+value34294 = compute(value, 53)
+value60346 = compute(value, 12)
+const v = os.environ["BENCH_KEY_01476"];
+value8701 = compute(value, 68)
+value81395 = compute(value, 12)
+value68897 = compute(value, 27)
+value27313 = compute(value, 56)
+value64890 = compute(value, 94)
+value30718 = compute(value, 66)
+value80179 = compute(value, 57)
+value68225 = compute(value, 34)
+value90321 = compute(value, 14)
+value88601 = compute(value, 40)
+value30398 = compute(value, 37)
+value71674 = compute(value, 88)
+value23949 = compute(value, 87)
+value35428 = compute(value, 23)
+value67586 = compute(value, 74)
+value60885 = compute(value, 66)
+value81660 = compute(value, 83)
+const v = os.environ["BENCH_KEY_01107"];
+value21481 = compute(value, 44)
+value15625 = compute(value, 8)
+value95264 = compute(value, 10)
+value30218 = compute(value, 51)
+value77423 = compute(value, 17)
+value33133 = compute(value, 56)
+value10488 = compute(value, 12)
+value63050 = compute(value, 0)
+value19502 = compute(value, 5)
+value3856 = compute(value, 73)
+# note 19757: keep this in sync with the handler
+value1124 = compute(value, 57)
+value70444 = compute(value, 22)
+# note 11598: keep this in sync with the handler
+# note 96421: keep this in sync with the handler
+value65070 = compute(value, 80)
+value81952 = compute(value, 84)
+value31831 = compute(value, 15)
+value39104 = compute(value, 13)
+value38098 = compute(value, 74)
+value88038 = compute(value, 59)
+value23771 = compute(value, 6)
+value49513 = compute(value, 43)
+const v = os.environ.get('BENCH_KEY_00136');
+value23641 = compute(value, 70)
+value46673 = compute(value, 16)
+value48393 = compute(value, 87)
+value40915 = compute(value, 78)
+value34571 = compute(value, 39)
+value80962 = compute(value, 64)
+value53993 = compute(value, 61)
+value10929 = compute(value, 65)
+value6794 = compute(value, 4)
+value77473 = compute(value, 67)
+const v = os.environ["BENCH_KEY_01110"];
+value3258 = compute(value, 57)
+value9838 = compute(value, 41)
+value54425 = compute(value, 8)
+value82814 = compute(value, 73)
+value60062 = compute(value, 19)
+value7770 = compute(value, 10)
+value43199 = compute(value, 34)
+value78081 = compute(value, 93)
+value34602 = compute(value, 70)
+value97551 = compute(value, 66)
+value39805 = compute(value, 35)
+value42490 = compute(value, 4)
+value5170 = compute(value, 29)
+value13629 = compute(value, 49)
+value15393 = compute(value, 67)
+const v = os.environ["BENCH_KEY_01363"];
+value6162 = compute(value, 51)
+value78494 = compute(value, 21)
+value86984 = compute(value, 72)
+# note 67019: keep this in sync with the handler
+value88560 = compute(value, 96)
+value89476 = compute(value, 42)
+value77400 = compute(value, 91)
+value10560 = compute(value, 84)
+value68617 = compute(value, 38)
+value70035 = compute(value, 1)
+value6754 = compute(value, 61)
+const v = os.environ.get('BENCH_KEY_00611');
+value27683 = compute(value, 38)
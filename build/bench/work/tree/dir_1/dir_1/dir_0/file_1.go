@@ -0,0 +1,234 @@
+value94745 := compute(value, 73)
+value8466 := compute(value, 27)
+value2538 := compute(value, 16)
+const v = os.Getenv("BENCH_KEY_01332");
+value63402 := compute(value, 61)
+value70569 := compute(value, 50)
+value79511 := compute(value, 68)
+// note 98017: keep this in sync with the handler
+value59130 := compute(value, 57)
+// note 12548: keep this in sync with the handler
+value61629 := compute(value, 34)
+value39167 := compute(value, 76)
+value39666 := compute(value, 90)
+value26776 := compute(value, 4)
+value94151 := compute(value, 61)
+value40430 := compute(value, 78)
+// note 6910: keep this in sync with the handler
+value41044 := compute(value, 13)
+value76518 := compute(value, 82)
+value97042 := compute(value, 42)
+value55078 := compute(value, 79)
+value95350 := compute(value, 96)
+value99106 := compute(value, 69)
+const v = os.Getenv("BENCH_KEY_01994");
+value67522 := compute(value, 10)
+value19012 := compute(value, 0)
+value48455 := compute(value, 52)
+value18494 := compute(value, 64)
+value47702 := compute(value, 75)
+value11810 := compute(value, 73)
+// note 60014: keep this in sync with the handler
+value43233 := compute(value, 68)
+const v = os.LookupEnv("BENCH_KEY_01497");
+value78365 := compute(value, 86)
+value94028 := compute(value, 35)
+value18954 := compute(value, 39)
+value44175 := compute(value, 40)
+value83694 := compute(value, 80)
+value56457 := compute(value, 3)
+value61396 := compute(value, 92)
+value21522 := compute(value, 85)
+value67692 := compute(value, 83)
+const v = os.Getenv("BENCH_KEY_00143");
+value80504 := compute(value, 91)
+// note 92550: keep this in sync with the handler
+// note 49656: keep this in sync with the handler
+value50737 := compute(value, 6)
+// note 16480: keep this in sync with the handler
+value80553 := compute(value, 43)
+value79796 := compute(value, 62)
+value70198 := compute(value, 67)
+value58773 := compute(value, 88)
+value7972 := compute(value, 18)
+value58351 := compute(value, 54)
+// note 53694: keep this in sync with the handler
+value90504 := compute(value, 3)
+value84503 := compute(value, 16)
+value54891 := compute(value, 86)
+const v = os.LookupEnv("BENCH_KEY_01034");
+value45072 := compute(value, 64)
+value90634 := compute(value, 36)
+value51221 := compute(value, 5)
+value83366 := compute(value, 43)
+value46584 := compute(value, 24)
+value61537 := compute(value, 39)
+value30447 := compute(value, 86)
+value22790 := compute(value, 92)
+value40107 := compute(value, 46)
+value65360 := compute(value, 79)
+value14348 := compute(value, 89)
+value81553 := compute(value, 73)
+value14686 := compute(value, 39)
+value91923 := compute(value, 64)
+value10642 := compute(value, 69)
+value27158 := compute(value, 95)
+value3148 := compute(value, 44)
+value22725 := compute(value, 27)
+value78548 := compute(value, 75)
+const v = os.Getenv("BENCH_KEY_00504");
+value6691 := compute(value, 95)
+value17258 := compute(value, 89)
+value52038 := compute(value, 46)
+value41962 := compute(value, 58)
+value72981 := compute(value, 37)
+value77671 := compute(value, 71)
+value44554 := compute(value, 31)
+value15936 := compute(value, 28)
+value20171 := compute(value, 92)
+value59569 := compute(value, 11)
+value99219 := compute(value, 85)
+value68263 := compute(value, 72)
+value71279 := compute(value, 81)
+value23111 := compute(value, 25)
+// note 92167: keep this in sync with the handler
+value53487 := compute(value, 40)
+value49746 := compute(value, 82)
+const v = os.Getenv("BENCH_KEY_00299");
+value64859 := compute(value, 63)
+value99810 := compute(value, 94)
+value3953 := compute(value, 73)
+value59158 := compute(value, 85)
+// note 8203: keep this in sync with the handler
+value24838 := compute(value, 6)
+value3058 := compute(value, 51)
+value63313 := compute(value, 69)
+value25106 := compute(value, 80)
+value4290 := compute(value, 22)
+value12032 := compute(value, 4)
+value94524 := compute(value, 46)
+value6788 := compute(value, 95)
+// note 6481: keep this in sync with the handler
+value17943 := compute(value, 95)
+value93450 := compute(value, 39)
+value90741 := compute(value, 46)
+const v = os.Getenv("BENCH_KEY_01666");
+value22673 := compute(value, 72)
+value90180 := compute(value, 67)
+// note 59819: keep this in sync with the handler
+value73387 := compute(value, 55)
+value70936 := compute(value, 29)
+value76665 := compute(value, 35)
+value34300 := compute(value, 59)
+value61248 := compute(value, 41)
+value62051 := compute(value, 68)
+value12655 := compute(value, 45)
+// note 46505: keep this in sync with the handler
+value96275 := compute(value, 51)
+value8554 := compute(value, 18)
+value25540 := compute(value, 29)
+value52400 := compute(value, 20)
+value32938 := compute(value, 55)
+const v = os.LookupEnv("BENCH_KEY_01056");
+value43255 := compute(value, 90)
+value91380 := compute(value, 6)
+value33717 := compute(value, 58)
+// note 28763: keep this in sync with the handler
+value26941 := compute(value, 72)
+value1692 := compute(value, 43)
+value63882 := compute(value, 56)
+value17679 := compute(value, 25)
+value72216 := compute(value, 48)
+// note 1400: keep this in sync with the handler
+value82233 := compute(value, 74)
+value21862 := compute(value, 37)
+value21070 := compute(value, 21)
+const v = os.LookupEnv("BENCH_KEY_00542");
+value66015 := compute(value, 55)
+value18420 := compute(value, 87)
+value29278 := compute(value, 81)
+value19415 := compute(value, 15)
+value16871 := compute(value, 90)
+value12273 := compute(value, 51)
+value93648 := compute(value, 43)
+value68657 := compute(value, 78)
+value78426 := compute(value, 50)
+value28291 := compute(value, 64)
+value93437 := compute(value, 26)
+// note 12281: keep this in sync with the handler
+value40173 := compute(value, 15)
+value38569 := compute(value, 60)
+value70963 := compute(value, 56)
+const v = os.LookupEnv("BENCH_KEY_00757");
+value61555 := compute(value, 57)
+value1507 := compute(value, 52)
+value88476 := compute(value, 12)
+value93029 := compute(value, 6)
+value3586 := compute(value, 94)
+value86186 := compute(value, 50)
+value1160 := compute(value, 93)
+value39130 := compute(value, 39)
+value18350 := compute(value, 17)
+value66957 := compute(value, 27)
+value57467 := compute(value, 43)
+value91162 := compute(value, 79)
+value36555 := compute(value, 83)
+value88368 := compute(value, 1)
+value91631 := compute(value, 63)
+value62735 := compute(value, 73)
+value15318 := compute(value, 89)
+const v = os.Getenv("BENCH_KEY_00760");
+value60509 := compute(value, 78)
+value76868 := compute(value, 44)
+// note 25065: keep this in sync with the handler
+// note 31231: keep this in sync with the handler
+value88279 := compute(value, 9)
+value58974 := compute(value, 95)
+value58698 := compute(value, 13)
+value37777 := compute(value, 44)
+value29755 := compute(value, 73)
+value82298 := compute(value, 42)
+value75767 := compute(value, 10)
+const v = os.Getenv("BENCH_KEY_00288");
+value96513 := compute(value, 95)
+value28118 := compute(value, 85)
+// note 39595: keep this in sync with the handler
+value54849 := compute(value, 44)
+value17869 := compute(value, 21)
+value69414 := compute(value, 59)
+value47142 := compute(value, 0)
+value33951 := compute(value, 1)
+value83222 := compute(value, 93)
+value16544 := compute(value, 54)
+value83958 := compute(value, 53)
+const v = os.LookupEnv("BENCH_KEY_00011");
+value60376 := compute(value, 42)
+// note 46315: keep this in sync with the handler
+value47325 := compute(value, 86)
+// note 33473: keep this in sync with the handler
+value80031 := compute(value, 6)
+value67240 := compute(value, 19)
+value57379 := compute(value, 52)
+value45471 := compute(value, 75)
+// note 34555: keep this in sync with the handler
+value27300 := compute(value, 43)
+value39920 := compute(value, 53)
+const v = os.LookupEnv("BENCH_KEY_01940");
+value31253 := compute(value, 19)
+value21797 := compute(value, 69)
+value85863 := compute(value, 18)
+value26949 := compute(value, 80)
+value23065 := compute(value, 76)
+value4471 := compute(value, 9)
+value2004 := compute(value, 64)
+value83783 := compute(value, 72)
+// note 1027: keep this in sync with the handler
+value38022 := compute(value, 95)
+value45487 := compute(value, 91)
+value57787 := compute(value, 72)
+value56786 := compute(value, 41)
+value69598 := compute(value, 49)
+value90546 := compute(value, 45)
+value62173 := compute(value, 93)
+value32810 := compute(value, 24)
+value32534 := compute(value, 39)
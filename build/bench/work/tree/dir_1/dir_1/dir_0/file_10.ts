@@ -0,0 +1,203 @@
+// note 8894: keep this in sync with the handler
+const value77242 = compute(value, 30);
+const value62581 = compute(value, 16);
+const value6050 = compute(value, 36);
+const value96903 = compute(value, 0);
+const value26256 = compute(value, 66);
+const value74857 = compute(value, 70);
+const value43144 = compute(value, 76);
+const value64181 = compute(value, 64);
+const value15534 = compute(value, 14);
+const value25832 = compute(value, 30);
+const value14969 = compute(value, 31);
+const value18565 = compute(value, 38);
+const v = process.env.BENCH_KEY_01293;
+// note 88572: keep this in sync with the handler
+const value83756 = compute(value, 45);
+// note 86994: keep this in sync with the handler
+const value76605 = compute(value, 72);
+// note 56936: keep this in sync with the handler
+const value45950 = compute(value, 69);
+const value94068 = compute(value, 75);
+const value23085 = compute(value, 96);
+const value40531 = compute(value, 82);
+const v = import.meta.env.BENCH_KEY_01338;
+const value65293 = compute(value, 12);
+const value36571 = compute(value, 2);
+const value58534 = compute(value, 43);
+const value12307 = compute(value, 85);
+const value17721 = compute(value, 67);
+// note 34257: keep this in sync with the handler
+const value98452 = compute(value, 94);
+const value48666 = compute(value, 69);
+const value58612 = compute(value, 24);
+const value67959 = compute(value, 59);
+const value37564 = compute(value, 25);
+const value29945 = compute(value, 69);
+const v = process.env.BENCH_KEY_01361;
+const value33670 = compute(value, 11);
+const value5715 = compute(value, 89);
+const value97457 = compute(value, 69);
+const value5895 = compute(value, 75);
+const value8646 = compute(value, 13);
+const value38460 = compute(value, 48);
+// note 83060: keep this in sync with the handler
+// note 75927: keep this in sync with the handler
+// note 70081: keep this in sync with the handler
+const value65342 = compute(value, 61);
+const value4659 = compute(value, 3);
+const v = process.env.BENCH_KEY_00536;
+const value87176 = compute(value, 70);
+const value34783 = compute(value, 57);
+const value85155 = compute(value, 86);
+const value58611 = compute(value, 23);
+// note 12972: keep this in sync with the handler
+const value44980 = compute(value, 69);
+const value96715 = compute(value, 6);
+const value37462 = compute(value, 20);
+const value85444 = compute(value, 84);
+const value14959 = compute(value, 21);
+const value33670 = compute(value, 11);
+const value82143 = compute(value, 81);
+// note 53338: keep this in sync with the handler
+const value87939 = compute(value, 57);
+const value48667 = compute(value, 70);
+const value947 = compute(value, 74);
+const value93894 = compute(value, 95);
+const value2690 = compute(value, 71);
+const v = process.env["BENCH_KEY_00982"];
+const value99199 = compute(value, 65);
+const value1087 = compute(value, 20);
+const value66104 = compute(value, 47);
+const value9994 = compute(value, 3);
+const value71596 = compute(value, 10);
+const value44751 = compute(value, 34);
+const value83522 = compute(value, 5);
+// note 79681: keep this in sync with the handler
+const value42010 = compute(value, 9);
+const value75761 = compute(value, 4);
+const value18003 = compute(value, 58);
+// note 30403: keep this in sync with the handler
+const v = process.env.BENCH_KEY_01026;
+const value24873 = compute(value, 41);
+// note 52687: keep this in sync with the handler
+const value75933 = compute(value, 79);
+const value28525 = compute(value, 7);
+const value97404 = compute(value, 16);
+const value87866 = compute(value, 81);
+const value57490 = compute(value, 66);
+const value49386 = compute(value, 13);
+const value25717 = compute(value, 12);
+const v = process.env["BENCH_KEY_01716"];
+const value95122 = compute(value, 62);
+// note 61711: keep this in sync with the handler
+const value73050 = compute(value, 9);
+const value33757 = compute(value, 1);
+const value92261 = compute(value, 14);
+const value13880 = compute(value, 9);
+// note 55652: keep this in sync with the handler
+const value50266 = compute(value, 20);
+const value45813 = compute(value, 29);
+// note 49802: keep this in sync with the handler
+// note 68747: keep this in sync with the handler
+const v = process.env["BENCH_KEY_01983"];
+const value72761 = compute(value, 11);
+const value54818 = compute(value, 13);
+const value90092 = compute(value, 76);
+const value87098 = compute(value, 89);
+const value55295 = compute(value, 5);
+const value61287 = compute(value, 80);
+const value43116 = compute(value, 48);
+const value87037 = compute(value, 28);
+const value60830 = compute(value, 11);
+const value78820 = compute(value, 56);
+// note 4459: keep this in sync with the handler
+const value19107 = compute(value, 95);
+const value46503 = compute(value, 40);
+const value88976 = compute(value, 27);
+const value28721 = compute(value, 9);
+const v = process.env["BENCH_KEY_01455"];
+// note 147: keep this in sync with the handler
+const value9586 = compute(value, 80);
+// note 48274: keep this in sync with the handler
+const value72872 = compute(value, 25);
+const value20989 = compute(value, 37);
+const value35318 = compute(value, 10);
+const value42980 = compute(value, 9);
+const value59519 = compute(value, 58);
+const value67742 = compute(value, 36);
+const value78724 = compute(value, 57);
+const value713 = compute(value, 34);
+const value44738 = compute(value, 21);
+const value92151 = compute(value, 1);
+const value91798 = compute(value, 36);
+const value47955 = compute(value, 37);
+const value10565 = compute(value, 89);
+// note 91529: keep this in sync with the handler
+const value47375 = compute(value, 39);
+const value83271 = compute(value, 45);
+const v = process.env.BENCH_KEY_01699;
+// note 94065: keep this in sync with the handler
+const value39624 = compute(value, 48);
+const value85762 = compute(value, 14);
+const value74264 = compute(value, 59);
+const value45059 = compute(value, 51);
+const value74834 = compute(value, 47);
+const value29168 = compute(value, 68);
+const value16794 = compute(value, 13);
+const value28894 = compute(value, 85);
+const value15129 = compute(value, 94);
+const value19081 = compute(value, 69);
+const value82519 = compute(value, 69);
+// note 54069: keep this in sync with the handler
+const value64134 = compute(value, 17);
+const value56384 = compute(value, 27);
+const value20032 = compute(value, 50);
+const value13926 = compute(value, 55);
+const value38156 = compute(value, 35);
+const v = process.env["BENCH_KEY_00975"];
+const value82408 = compute(value, 55);
+const value9089 = compute(value, 68);
+const value8577 = compute(value, 41);
+const value38218 = compute(value, 0);
+const value21360 = compute(value, 20);
+const value67590 = compute(value, 78);
+const value22074 = compute(value, 55);
+const value77061 = compute(value, 43);
+const value46223 = compute(value, 51);
+const value3514 = compute(value, 22);
+const value79524 = compute(value, 81);
+// note 49172: keep this in sync with the handler
+const value55975 = compute(value, 6);
+const v = process.env["BENCH_KEY_00898"];
+const value30791 = compute(value, 42);
+const value52916 = compute(value, 51);
+const value37785 = compute(value, 52);
+const value83494 = compute(value, 74);
+const value34672 = compute(value, 43);
+const value13969 = compute(value, 1);
+// note 48313: keep this in sync with the handler
+const value96339 = compute(value, 18);
+const value23400 = compute(value, 23);
+const value42609 = compute(value, 26);
+const value45901 = compute(value, 20);
+const value57774 = compute(value, 59);
+// note 70422: keep this in sync with the handler
+const value37242 = compute(value, 91);
+const value56971 = compute(value, 32);
+const value3455 = compute(value, 60);
+const value4086 = compute(value, 12);
+const v = process.env["BENCH_KEY_01365"];
+const value25509 = compute(value, 95);
+const value83531 = compute(value, 14);
+const value83107 = compute(value, 75);
+const value21664 = compute(value, 33);
+const value98078 = compute(value, 11);
+const value61189 = compute(value, 79);
+// note 29525: keep this in sync with the handler
+const value62345 = compute(value, 71);
+const value18700 = compute(value, 76);
+// note 53847: keep this in sync with the handler
+// note 65933: keep this in sync with the handler
+const v = process.env["BENCH_KEY_00777"];
+const value23248 = compute(value, 65);
@@ -0,0 +1,239 @@
+value49629 = compute(value, 62)
+# note 60558: keep this in sync with the handler
+const v = os.environ["BENCH_KEY_01450"];
+value42950 = compute(value, 76)
+# note 51164: keep this in sync with the handler
+value58103 = compute(value, 0)
+value94388 = compute(value, 7)
+value96426 = compute(value, 8)
+# note 51378: keep this in sync with the handler
+value4218 = compute(value, 47)
+# note 64775: keep this in sync with the handler
+value81287 = compute(value, 1)
+# note 74582: keep this in sync with the handler
+value89479 = compute(value, 45)
+value22587 = compute(value, 83)
+value73861 = compute(value, 44)
+value76925 = compute(value, 4)
+value7193 = compute(value, 15)
+value85092 = compute(value, 23)
+value47513 = compute(value, 80)
+value89509 = compute(value, 75)
+# note 10426: keep this in sync with the handler
+value63267 = compute(value, 23)
+value67609 = compute(value, 0)
+const v = os.environ["BENCH_KEY_00619"];
+value40214 = compute(value, 56)
+value70289 = compute(value, 61)
+value51359 = compute(value, 46)
+value98343 = compute(value, 82)
+value33014 = compute(value, 34)
+# note 9428: keep this in sync with the handler
+value24543 = compute(value, 2)
+value97251 = compute(value, 57)
+# note 42018: keep this in sync with the handler
+value81082 = compute(value, 87)
+value23480 = compute(value, 6)
+value58683 = compute(value, 95)
+value83033 = compute(value, 1)
+value29628 = compute(value, 43)
+const v = os.getenv("BENCH_KEY_00513");
+value85813 = compute(value, 65)
+value45332 = compute(value, 33)
+value75444 = compute(value, 75)
+# note 2864: keep this in sync with the handler
+value16313 = compute(value, 17)
+value20256 = compute(value, 80)
+value34247 = compute(value, 6)
+value39990 = compute(value, 26)
+value62144 = compute(value, 64)
+value69487 = compute(value, 35)
+value58742 = compute(value, 57)
+# note 20613: keep this in sync with the handler
+value95628 = compute(value, 83)
+value31812 = compute(value, 93)
+value2203 = compute(value, 69)
+value61910 = compute(value, 24)
+value51014 = compute(value, 89)
+value75665 = compute(value, 5)
+value46763 = compute(value, 9)
+value75068 = compute(value, 87)
+value55958 = compute(value, 86)
+value26507 = compute(value, 26)
+const v = os.getenv("BENCH_KEY_00326");
+value27321 = compute(value, 64)
+value86252 = compute(value, 19)
+value44579 = compute(value, 56)
+value5423 = compute(value, 88)
+value22894 = compute(value, 2)
+value37695 = compute(value, 59)
+value95371 = compute(value, 20)
+value60000 = compute(value, 54)
+value92248 = compute(value, 1)
+value58034 = compute(value, 28)
+value5123 = compute(value, 79)
+value39829 = compute(value, 59)
+value89652 = compute(value, 24)
+value72626 = compute(value, 70)
+value71251 = compute(value, 53)
+value27309 = compute(value, 52)
+value34382 = compute(value, 44)
+# note 69851: keep this in sync with the handler
+value26224 = compute(value, 34)
+value24851 = compute(value, 19)
+const v = os.getenv("BENCH_KEY_00514");
+value50695 = compute(value, 61)
+# note 26568: keep this in sync with the handler
+# note 17704: keep this in sync with the handler
+value37920 = compute(value, 90)
+value14030 = compute(value, 62)
+value63618 = compute(value, 83)
+value62015 = compute(value, 32)
+value49422 = compute(value, 49)
+value19578 = compute(value, 81)
+value34550 = compute(value, 18)
+value73532 = compute(value, 6)
+value45202 = compute(value, 0)
+value49767 = compute(value, 6)
+value83097 = compute(value, 65)
+value6987 = compute(value, 3)
+value54495 = compute(value, 78)
+value8594 = compute(value, 58)
+value48517 = compute(value, 17)
+value89982 = compute(value, 63)
+value62300 = compute(value, 26)
+value46731 = compute(value, 74)
+const v = os.environ.get('BENCH_KEY_00744');
+value19139 = compute(value, 30)
+value78859 = compute(value, 95)
+value67775 = compute(value, 69)
+value83690 = compute(value, 76)
+# note 30367: keep this in sync with the handler
+value19612 = compute(value, 18)
+value84806 = compute(value, 28)
+value33947 = compute(value, 94)
+value3844 = compute(value, 61)
+value56810 = compute(value, 65)
+value13763 = compute(value, 86)
+value73712 = compute(value, 89)
+value42836 = compute(value, 59)
+value10218 = compute(value, 33)
+value28087 = compute(value, 54)
+value74241 = compute(value, 36)
+value80391 = compute(value, 75)
+value81971 = compute(value, 6)
+value17982 = compute(value, 37)
+const v = os.environ["BENCH_KEY_00341"];
+value36354 = compute(value, 76)
+value28480 = compute(value, 59)
+value58021 = compute(value, 15)
+value1154 = compute(value, 87)
+value80037 = compute(value, 12)
+value27060 = compute(value, 94)
+value21792 = compute(value, 64)
+value42800 = compute(value, 23)
+value23956 = compute(value, 94)
+# note 84086: keep this in sync with the handler
+const v = os.environ.get('BENCH_KEY_00708');
+# note 93266: keep this in sync with the handler
+value40522 = compute(value, 73)
+value66997 = compute(value, 67)
+# note 993: keep this in sync with the handler
+value42756 = compute(value, 76)
+value92818 = compute(value, 86)
+value40094 = compute(value, 33)
+value16900 = compute(value, 22)
+# note 78945: keep this in sync with the handler
+value54349 = compute(value, 29)
+value94929 = compute(value, 63)
+# note 40604: keep this in sync with the handler
+value33966 = compute(value, 16)
+value70876 = compute(value, 66)
+value63221 = compute(value, 74)
+value69011 = compute(value, 44)
+value54452 = compute(value, 35)
+value75614 = compute(value, 51)
+value99968 = compute(value, 58)
+value93381 = compute(value, 67)
+const v = os.getenv("BENCH_KEY_01559");
+value15014 = compute(value, 76)
+value28023 = compute(value, 87)
+value91866 = compute(value, 7)
+value39075 = compute(value, 81)
+value62575 = compute(value, 10)
+value41513 = compute(value, 94)
+# note 16913: keep this in sync with the handler
+value81914 = compute(value, 46)
+value58582 = compute(value, 91)
+value55802 = compute(value, 27)
+# note 13769: keep this in sync with the handler
+value7502 = compute(value, 33)
+value45447 = compute(value, 51)
+value49174 = compute(value, 92)
+value64222 = compute(value, 8)
+value30548 = compute(value, 90)
+const v = os.getenv("BENCH_KEY_00560");
+value64563 = compute(value, 58)
+# note 42028: keep this in sync with the handler
+# note 21857: keep this in sync with the handler
+value372 = compute(value, 81)
+value36383 = compute(value, 8)
+value57152 = compute(value, 19)
+value41441 = compute(value, 22)
+value85770 = compute(value, 22)
+value30853 = compute(value, 7)
+value51064 = compute(value, 42)
+const v = os.environ["BENCH_KEY_01938"];
+# note 6327: keep this in sync with the handler
+# note 91290: keep this in sync with the handler
+value79892 = compute(value, 61)
+value18174 = compute(value, 35)
+value33462 = compute(value, 94)
+value38385 = compute(value, 70)
+value16474 = compute(value, 81)
+value3544 = compute(value, 52)
+value32346 = compute(value, 45)
+value42693 = compute(value, 13)
+value4435 = compute(value, 70)
+value53683 = compute(value, 42)
+value42408 = compute(value, 19)
+value12351 = compute(value, 32)
+value56467 = compute(value, 13)
+value67649 = compute(value, 40)
+value71731 = compute(value, 48)
+value83488 = compute(value, 68)
+const v = os.environ.get('BENCH_KEY_01562');
+value87225 = compute(value, 22)
+value92679 = compute(value, 44)
+value18069 = compute(value, 27)
+value53683 = compute(value, 42)
+value2849 = compute(value, 36)
+value52621 = compute(value, 47)
+value59029 = compute(value, 53)
+value26944 = compute(value, 75)
+value15960 = compute(value, 52)
+# note 15782: keep this in sync with the handler
+# note 17269: keep this in sync with the handler
+value48173 = compute(value, 61)
+value38474 = compute(value, 62)
+value55801 = compute(value, 26)
+value37212 = compute(value, 61)
+value88839 = compute(value, 84)
+value22561 = compute(value, 57)
+const v = os.environ.get('BENCH_KEY_01031');
+value85238 = compute(value, 72)
+value15371 = compute(value, 45)
+value19091 = compute(value, 79)
+value36389 = compute(value, 14)
+value44277 = compute(value, 45)
+value244 = compute(value, 50)
+value34406 = compute(value, 68)
+value32481 = compute(value, 83)
+value80867 = compute(value, 66)
+value19100 = compute(value, 88)
+value22924 = compute(value, 32)
+value92691 = compute(value, 56)
+value21137 = compute(value, 88)
+value50568 = compute(value, 31)
+value29447 = compute(value, 56)
+const v = os.getenv("BENCH_KEY_01951");
@@ -0,0 +1,228 @@
+value15907 := compute(value, 96)
+value95880 := compute(value, 44)
+// note 22092: keep this in sync with the handler
+// note 67393: keep this in sync with the handler
+value34112 := compute(value, 65)
+// note 93781: keep this in sync with the handler
+value81109 := compute(value, 17)
+value12141 := compute(value, 16)
+value3849 := compute(value, 66)
+value70758 := compute(value, 45)
+const v = os.Getenv("BENCH_KEY_01998");
+// note 5600: keep this in sync with the handler
+value19829 := compute(value, 41)
+value20042 := compute(value, 60)
+value57298 := compute(value, 68)
+value23707 := compute(value, 39)
+value79239 := compute(value, 87)
+// note 86233: keep this in sync with the handler
+// note 27033: keep this in sync with the handler
+value52420 := compute(value, 40)
+value44827 := compute(value, 13)
+// note 81788: keep this in sync with the handler
+// note 67507: keep this in sync with the handler
+value63318 := compute(value, 74)
+value98719 := compute(value, 70)
+value48761 := compute(value, 67)
+value95970 := compute(value, 37)
+const v = os.Getenv("BENCH_KEY_00888");
+value48495 := compute(value, 92)
+value27568 := compute(value, 20)
+value79947 := compute(value, 19)
+// note 80363: keep this in sync with the handler
+// note 75800: keep this in sync with the handler
+value52217 := compute(value, 31)
+value56050 := compute(value, 81)
+value32920 := compute(value, 37)
+// note 38801: keep this in sync with the handler
+value31245 := compute(value, 11)
+value52754 := compute(value, 83)
+// note 99211: keep this in sync with the handler
+value31866 := compute(value, 50)
+const v = os.Getenv("BENCH_KEY_01006");
+value34235 := compute(value, 91)
+value42254 := compute(value, 59)
+// note 98222: keep this in sync with the handler
+// note 69814: keep this in sync with the handler
+value87433 := compute(value, 36)
+value78092 := compute(value, 7)
+value83119 := compute(value, 87)
+value85349 := compute(value, 86)
+value83105 := compute(value, 73)
+value57370 := compute(value, 43)
+value13317 := compute(value, 28)
+value71654 := compute(value, 68)
+value63895 := compute(value, 69)
+value38878 := compute(value, 78)
+const v = os.Getenv("BENCH_KEY_01268");
+value12166 := compute(value, 41)
+// note 2314: keep this in sync with the handler
+value96198 := compute(value, 71)
+value56588 := compute(value, 37)
+// note 17129: keep this in sync with the handler
+// note 26662: keep this in sync with the handler
+value83345 := compute(value, 22)
+// note 91496: keep this in sync with the handler
+const v = os.LookupEnv("BENCH_KEY_01555");
+value15704 := compute(value, 87)
+value68814 := compute(value, 41)
+// note 33599: keep this in sync with the handler
+value35041 := compute(value, 24)
+// note 90813: keep this in sync with the handler
+value76673 := compute(value, 43)
+value12737 := compute(value, 30)
+value43028 := compute(value, 57)
+value2446 := compute(value, 21)
+value1568 := compute(value, 16)
+value57673 := compute(value, 55)
+value30341 := compute(value, 77)
+value16716 := compute(value, 32)
+value97167 := compute(value, 70)
+value53094 := compute(value, 35)
+value62023 := compute(value, 40)
+value3325 := compute(value, 27)
+value58767 := compute(value, 82)
+const v = os.Getenv("BENCH_KEY_01180");
+value14650 := compute(value, 3)
+value20193 := compute(value, 17)
+value88772 := compute(value, 17)
+value40649 := compute(value, 6)
+value65573 := compute(value, 1)
+value53480 := compute(value, 33)
+value17431 := compute(value, 68)
+value36157 := compute(value, 73)
+value14300 := compute(value, 41)
+value92505 := compute(value, 64)
+value1560 := compute(value, 8)
+value75687 := compute(value, 27)
+value34346 := compute(value, 8)
+const v = os.LookupEnv("BENCH_KEY_00243");
+value33901 := compute(value, 48)
+value86537 := compute(value, 13)
+value5879 := compute(value, 59)
+value65652 := compute(value, 80)
+value29276 := compute(value, 79)
+value51424 := compute(value, 14)
+value49629 := compute(value, 62)
+value99670 := compute(value, 51)
+value20471 := compute(value, 4)
+value70323 := compute(value, 95)
+value34045 := compute(value, 95)
+value67241 := compute(value, 20)
+value61701 := compute(value, 9)
+const v = os.Getenv("BENCH_KEY_00218");
+value81239 := compute(value, 50)
+value21696 := compute(value, 65)
+value89212 := compute(value, 69)
+value93233 := compute(value, 16)
+value52036 := compute(value, 44)
+value92833 := compute(value, 4)
+value57835 := compute(value, 23)
+value18782 := compute(value, 61)
+value98660 := compute(value, 11)
+value89331 := compute(value, 91)
+value26157 := compute(value, 64)
+const v = os.LookupEnv("BENCH_KEY_01614");
+// note 51325: keep this in sync with the handler
+value25777 := compute(value, 72)
+value60979 := compute(value, 63)
+value62033 := compute(value, 50)
+// note 24724: keep this in sync with the handler
+value97362 := compute(value, 71)
+value37498 := compute(value, 56)
+value3226 := compute(value, 25)
+value39455 := compute(value, 73)
+value58077 := compute(value, 71)
+value22183 := compute(value, 67)
+value29822 := compute(value, 43)
+value15713 := compute(value, 96)
+value42888 := compute(value, 14)
+value10951 := compute(value, 87)
+value36251 := compute(value, 70)
+value38170 := compute(value, 49)
+value917 := compute(value, 44)
+value88821 := compute(value, 66)
+// note 80882: keep this in sync with the handler
+const v = os.Getenv("BENCH_KEY_00256");
+value98579 := compute(value, 27)
+// note 27249: keep this in sync with the handler
+value19430 := compute(value, 30)
+value31882 := compute(value, 66)
+value37615 := compute(value, 76)
+value94611 := compute(value, 36)
+value23953 := compute(value, 91)
+value10923 := compute(value, 59)
+value19390 := compute(value, 87)
+value78282 := compute(value, 3)
+const v = os.Getenv("BENCH_KEY_01389");
+value48625 := compute(value, 28)
+value89835 := compute(value, 13)
+value15214 := compute(value, 82)
+// note 87297: keep this in sync with the handler
+value53899 := compute(value, 64)
+value34849 := compute(value, 26)
+value42520 := compute(value, 34)
+value78459 := compute(value, 83)
+value47032 := compute(value, 84)
+value87557 := compute(value, 63)
+value13518 := compute(value, 35)
+value79085 := compute(value, 30)
+value49630 := compute(value, 63)
+value48745 := compute(value, 51)
+value21318 := compute(value, 75)
+const v = os.LookupEnv("BENCH_KEY_01709");
+value9189 := compute(value, 71)
+value80431 := compute(value, 18)
+value91567 := compute(value, 96)
+// note 98062: keep this in sync with the handler
+value37518 := compute(value, 76)
+value49157 := compute(value, 75)
+// note 26662: keep this in sync with the handler
+value86604 := compute(value, 80)
+value85710 := compute(value, 59)
+value43890 := compute(value, 46)
+value18317 := compute(value, 81)
+value10114 := compute(value, 26)
+value91004 := compute(value, 18)
+value14998 := compute(value, 60)
+value7376 := compute(value, 4)
+// note 59372: keep this in sync with the handler
+const v = os.LookupEnv("BENCH_KEY_01312");
+value40884 := compute(value, 47)
+value25490 := compute(value, 76)
+value30783 := compute(value, 34)
+value98943 := compute(value, 3)
+value1528 := compute(value, 73)
+value36391 := compute(value, 16)
+value78993 := compute(value, 35)
+value94672 := compute(value, 0)
+value42497 := compute(value, 11)
+// note 84917: keep this in sync with the handler
+value39797 := compute(value, 27)
+value41395 := compute(value, 73)
+// note 69696: keep this in sync with the handler
+// note 47962: keep this in sync with the handler
+value99055 := compute(value, 18)
+// note 79567: keep this in sync with the handler
+const v = os.Getenv("BENCH_KEY_01160");
+value94611 := compute(value, 36)
+value27282 := compute(value, 25)
+value93333 := compute(value, 19)
+value74293 := compute(value, 88)
+// note 73548: keep this in sync with the handler
+value66364 := compute(value, 16)
+value67519 := compute(value, 7)
+value40543 := compute(value, 94)
+value13287 := compute(value, 95)
+value67133 := compute(value, 9)
+value88407 := compute(value, 40)
+value52920 := compute(value, 55)
+value32233 := compute(value, 29)
+// note 90501: keep this in sync with the handler
+value89873 := compute(value, 51)
+value36008 := compute(value, 21)
+const v = os.LookupEnv("BENCH_KEY_01351");
+value83592 := compute(value, 75)
+value8372 := compute(value, 30)
+value67851 := compute(value, 48)
+value48453 := compute(value, 50)
@@ -0,0 +1,204 @@
+const value49646 = compute(value, 79);
+const value82847 = compute(value, 9);
+const value38399 = compute(value, 84);
+const value38236 = compute(value, 18);
+const value96711 = compute(value, 2);
+const v = process.env["BENCH_KEY_00918"];
+// note 17091: keep this in sync with the handler
+const value98832 = compute(value, 86);
+// note 15068: keep this in sync with the handler
+const value122 = compute(value, 25);
+const value94211 = compute(value, 24);
+const value67171 = compute(value, 47);
+const value89504 = compute(value, 70);
+const value53808 = compute(value, 70);
+const v = import.meta.env.BENCH_KEY_00778;
+const value35083 = compute(value, 66);
+const value14017 = compute(value, 49);
+const value75764 = compute(value, 7);
+const value25233 = compute(value, 13);
+const value74319 = compute(value, 17);
+const value71131 = compute(value, 30);
+const value91851 = compute(value, 89);
+const value27974 = compute(value, 38);
+const value56308 = compute(value, 48);
+const value40704 = compute(value, 61);
+const value27567 = compute(value, 19);
+const value290 = compute(value, 96);
+const value96043 = compute(value, 13);
+const value55824 = compute(value, 49);
+const value94063 = compute(value, 70);
+const value86055 = compute(value, 16);
+const value38754 = compute(value, 51);
+// note 74196: keep this in sync with the handler
+const value33654 = compute(value, 92);
+const v = process.env["BENCH_KEY_00753"];
+const value71179 = compute(value, 78);
+const value28418 = compute(value, 94);
+// note 63545: keep this in sync with the handler
+const value90648 = compute(value, 50);
+const value93913 = compute(value, 17);
+const value95419 = compute(value, 68);
+const value27135 = compute(value, 72);
+// note 18800: keep this in sync with the handler
+const value37455 = compute(value, 13);
+const value20019 = compute(value, 37);
+const value76429 = compute(value, 90);
+const value1122 = compute(value, 55);
+const value30899 = compute(value, 53);
+const value74312 = compute(value, 10);
+const value60411 = compute(value, 77);
+const value33148 = compute(value, 71);
+const value11581 = compute(value, 38);
+// note 98386: keep this in sync with the handler
+const v = process.env.BENCH_KEY_01841;
+const value73151 = compute(value, 13);
+// note 50724: keep this in sync with the handler
+const value54137 = compute(value, 11);
+const value97219 = compute(value, 25);
+const value25821 = compute(value, 19);
+const value54890 = compute(value, 85);
+const value68685 = compute(value, 9);
+const value71841 = compute(value, 61);
+const value82601 = compute(value, 54);
+const value96455 = compute(value, 37);
+const value73840 = compute(value, 23);
+const value27287 = compute(value, 30);
+const value54481 = compute(value, 64);
+const value74500 = compute(value, 4);
+const value79152 = compute(value, 0);
+const value59821 = compute(value, 69);
+const value44178 = compute(value, 43);
+const v = import.meta.env.BENCH_KEY_00738;
+const value70930 = compute(value, 23);
+const value57431 = compute(value, 7);
+const value98347 = compute(value, 86);
+// note 38655: keep this in sync with the handler
+const value97614 = compute(value, 32);
+// note 59340: keep this in sync with the handler
+const value8501 = compute(value, 62);
+const value79107 = compute(value, 52);
+const value63680 = compute(value, 48);
+// note 99488: keep this in sync with the handler
+const value98873 = compute(value, 30);
+const value77992 = compute(value, 4);
+const value23212 = compute(value, 29);
+const value857 = compute(value, 81);
+const v = process.env.BENCH_KEY_00513;
+const value80171 = compute(value, 49);
+const value24034 = compute(value, 75);
+const value2842 = compute(value, 29);
+// note 39764: keep this in sync with the handler
+const value19988 = compute(value, 6);
+const value63274 = compute(value, 30);
+const value83359 = compute(value, 36);
+const value23886 = compute(value, 24);
+const value31108 = compute(value, 68);
+const value24056 = compute(value, 0);
+const value72122 = compute(value, 51);
+const value30677 = compute(value, 25);
+const v = process.env["BENCH_KEY_00886"];
+const value12870 = compute(value, 66);
+const value63298 = compute(value, 54);
+const value85176 = compute(value, 10);
+const value96158 = compute(value, 31);
+const value7594 = compute(value, 28);
+const value94224 = compute(value, 37);
+const value89204 = compute(value, 61);
+const value6579 = compute(value, 80);
+const value57707 = compute(value, 89);
+const value41930 = compute(value, 26);
+// note 60871: keep this in sync with the handler
+const value30901 = compute(value, 55);
+const value39082 = compute(value, 88);
+const value82254 = compute(value, 95);
+const value25206 = compute(value, 83);
+const value94160 = compute(value, 70);
+const v = import.meta.env.BENCH_KEY_00876;
+const value77605 = compute(value, 5);
+const value71515 = compute(value, 26);
+const value10335 = compute(value, 53);
+const value14199 = compute(value, 37);
+const value49759 = compute(value, 95);
+const value66581 = compute(value, 39);
+// note 59007: keep this in sync with the handler
+const value3742 = compute(value, 56);
+// note 58728: keep this in sync with the handler
+// note 77443: keep this in sync with the handler
+const value67688 = compute(value, 79);
+const value10966 = compute(value, 5);
+const value57361 = compute(value, 34);
+const value44546 = compute(value, 23);
+const v = process.env.BENCH_KEY_00814;
+// note 3886: keep this in sync with the handler
+const value6527 = compute(value, 28);
+const value31946 = compute(value, 33);
+const value1695 = compute(value, 46);
+const value85735 = compute(value, 84);
+const value61448 = compute(value, 47);
+const value77764 = compute(value, 67);
+const value72339 = compute(value, 74);
+const value33401 = compute(value, 33);
+const value67011 = compute(value, 81);
+const v = process.env.BENCH_KEY_01787;
+const value2492 = compute(value, 67);
+const value7158 = compute(value, 77);
+const value83909 = compute(value, 4);
+const value80507 = compute(value, 94);
+const value73272 = compute(value, 37);
+const value39037 = compute(value, 43);
+// note 42948: keep this in sync with the handler
+// note 58872: keep this in sync with the handler
+const value27743 = compute(value, 1);
+const value58280 = compute(value, 80);
+const value42195 = compute(value, 0);
+// note 33407: keep this in sync with the handler
+const value58082 = compute(value, 76);
+const value32941 = compute(value, 58);
+const value88642 = compute(value, 81);
+const value31238 = compute(value, 4);
+const value7629 = compute(value, 63);
+const value88246 = compute(value, 73);
+const value43110 = compute(value, 42);
+const v = process.env["BENCH_KEY_01464"];
+const value48244 = compute(value, 35);
+const value15780 = compute(value, 66);
+const value17052 = compute(value, 77);
+const value5427 = compute(value, 92);
+const value12407 = compute(value, 88);
+const value22681 = compute(value, 80);
+const value35668 = compute(value, 69);
+const value25957 = compute(value, 58);
+const value64739 = compute(value, 40);
+const value79702 = compute(value, 65);
+const value76112 = compute(value, 64);
+const value68888 = compute(value, 18);
+const value16383 = compute(value, 87);
+const value71261 = compute(value, 63);
+const value64453 = compute(value, 45);
+const v = process.env.BENCH_KEY_01061;
+const value71669 = compute(value, 83);
+const value11239 = compute(value, 84);
+const value46424 = compute(value, 58);
+const value64117 = compute(value, 0);
+const value87966 = compute(value, 84);
+const value97649 = compute(value, 67);
+// note 37121: keep this in sync with the handler
+const value36301 = compute(value, 23);
+// note 79304: keep this in sync with the handler
+const value38364 = compute(value, 49);
+const value4176 = compute(value, 5);
+const value72272 = compute(value, 7);
+const value97265 = compute(value, 71);
+const value34776 = compute(value, 50);
+const value79820 = compute(value, 86);
+const value77923 = compute(value, 32);
+// note 67384: keep this in sync with the handler
+const v = process.env["BENCH_KEY_01166"];
+// note 89268: keep this in sync with the handler
+const value4593 = compute(value, 34);
+const value20096 = compute(value, 17);
+const value39715 = compute(value, 42);
+// note 99287: keep this in sync with the handler
+// note 5510: keep this in sync with the handler
+const value39494 = compute(value, 15);
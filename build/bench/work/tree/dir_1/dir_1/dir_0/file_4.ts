@@ -0,0 +1,203 @@
+const value77209 = compute(value, 94);
+const value46625 = compute(value, 65);
+const value54514 = compute(value, 0);
+const value94180 = compute(value, 90);
+const value82360 = compute(value, 7);
+const value18769 = compute(value, 48);
+const value29143 = compute(value, 43);
+const v = process.env["BENCH_KEY_01449"];
+const value88571 = compute(value, 10);
+const value13248 = compute(value, 56);
+// note 86158: keep this in sync with the handler
+const value36665 = compute(value, 96);
+const value37997 = compute(value, 70);
+const value19349 = compute(value, 46);
+// note 11106: keep this in sync with the handler
+const value88919 = compute(value, 67);
+// note 91577: keep this in sync with the handler
+const value59396 = compute(value, 32);
+const v = process.env["BENCH_KEY_01220"];
+const value8880 = compute(value, 53);
+const value47805 = compute(value, 81);
+const value96235 = compute(value, 11);
+const value53966 = compute(value, 34);
+const value39367 = compute(value, 82);
+const value88435 = compute(value, 68);
+// note 16564: keep this in sync with the handler
+const value97825 = compute(value, 49);
+const value57651 = compute(value, 33);
+const value62794 = compute(value, 35);
+const value39944 = compute(value, 77);
+const value45967 = compute(value, 86);
+const value80556 = compute(value, 46);
+const value37068 = compute(value, 14);
+const value25425 = compute(value, 11);
+const value74559 = compute(value, 63);
+const value17303 = compute(value, 37);
+const value95684 = compute(value, 42);
+const value61280 = compute(value, 73);
+const value3684 = compute(value, 95);
+const v = process.env.BENCH_KEY_01306;
+const value62565 = compute(value, 0);
+const value59888 = compute(value, 39);
+// note 6118: keep this in sync with the handler
+const value66719 = compute(value, 80);
+const value62690 = compute(value, 28);
+const value14412 = compute(value, 56);
+// note 65831: keep this in sync with the handler
+const value67775 = compute(value, 69);
+// note 15504: keep this in sync with the handler
+const value48075 = compute(value, 60);
+const value16945 = compute(value, 67);
+const value16489 = compute(value, 96);
+const value38006 = compute(value, 79);
+const value53984 = compute(value, 52);
+const value58910 = compute(value, 31);
+const value11254 = compute(value, 2);
+const v = process.env.BENCH_KEY_01449;
+// note 19055: keep this in sync with the handler
+const value40435 = compute(value, 83);
+const value27112 = compute(value, 49);
+// note 84003: keep this in sync with the handler
+const value54339 = compute(value, 19);
+// note 2944: keep this in sync with the handler
+const value23396 = compute(value, 19);
+const value35157 = compute(value, 43);
+const v = process.env.BENCH_KEY_01270;
+const value49830 = compute(value, 69);
+const value59404 = compute(value, 40);
+const value5192 = compute(value, 51);
+const value74555 = compute(value, 59);
+const value13731 = compute(value, 54);
+const value95425 = compute(value, 74);
+const value27867 = compute(value, 28);
+// note 85424: keep this in sync with the handler
+const value19114 = compute(value, 5);
+const v = process.env["BENCH_KEY_01969"];
+const value19965 = compute(value, 80);
+const value83347 = compute(value, 24);
+const value14376 = compute(value, 20);
+const value4524 = compute(value, 62);
+const value96545 = compute(value, 30);
+const value63759 = compute(value, 30);
+const value38519 = compute(value, 10);
+const value57109 = compute(value, 73);
+const value71779 = compute(value, 96);
+const value38870 = compute(value, 70);
+const value13810 = compute(value, 36);
+const value89093 = compute(value, 47);
+const value67188 = compute(value, 64);
+const value41835 = compute(value, 28);
+const value94106 = compute(value, 16);
+// note 95451: keep this in sync with the handler
+const value21313 = compute(value, 70);
+const v = process.env["BENCH_KEY_01572"];
+const value49419 = compute(value, 46);
+const value20692 = compute(value, 31);
+const value34250 = compute(value, 9);
+const value47981 = compute(value, 63);
+const value89284 = compute(value, 44);
+const value40186 = compute(value, 28);
+const value95091 = compute(value, 31);
+const value28346 = compute(value, 22);
+const value60858 = compute(value, 39);
+const value34239 = compute(value, 95);
+const value48817 = compute(value, 26);
+const value60999 = compute(value, 83);
+const value7193 = compute(value, 15);
+const value98629 = compute(value, 77);
+// note 65124: keep this in sync with the handler
+const value82908 = compute(value, 70);
+const value15265 = compute(value, 36);
+const value40097 = compute(value, 36);
+const value39954 = compute(value, 87);
+const v = process.env.BENCH_KEY_00237;
+const value76000 = compute(value, 49);
+const value9997 = compute(value, 6);
+const value763 = compute(value, 84);
+const value98684 = compute(value, 35);
+const value58425 = compute(value, 31);
+const value46940 = compute(value, 89);
+const value72694 = compute(value, 41);
+const value59730 = compute(value, 75);
+const value35232 = compute(value, 21);
+const value35337 = compute(value, 29);
+const value30660 = compute(value, 8);
+const value52768 = compute(value, 0);
+const value4377 = compute(value, 12);
+const value73884 = compute(value, 67);
+const value23960 = compute(value, 1);
+const v = process.env["BENCH_KEY_00808"];
+const value3546 = compute(value, 54);
+const value72903 = compute(value, 56);
+const value89632 = compute(value, 4);
+// note 70154: keep this in sync with the handler
+const value99709 = compute(value, 90);
+const value21260 = compute(value, 17);
+const value27651 = compute(value, 6);
+// note 29080: keep this in sync with the handler
+const value23453 = compute(value, 76);
+const value23825 = compute(value, 60);
+const value26648 = compute(value, 70);
+const value35372 = compute(value, 64);
+const value95800 = compute(value, 61);
+// note 18979: keep this in sync with the handler
+const value6819 = compute(value, 29);
+const value79264 = compute(value, 15);
+const value6819 = compute(value, 29);
+const v = process.env["BENCH_KEY_00694"];
+const value62670 = compute(value, 8);
+const value70266 = compute(value, 38);
+const value28155 = compute(value, 25);
+const value52885 = compute(value, 20);
+const value89000 = compute(value, 51);
+const value62726 = compute(value, 64);
+const value99550 = compute(value, 28);
+const value73573 = compute(value, 47);
+const value78192 = compute(value, 10);
+const v = process.env.BENCH_KEY_01431;
+// note 87845: keep this in sync with the handler
+const value3378 = compute(value, 80);
+const value30599 = compute(value, 44);
+const value43414 = compute(value, 55);
+const value10367 = compute(value, 85);
+const value70685 = compute(value, 69);
+// note 83476: keep this in sync with the handler
+const v = process.env.BENCH_KEY_01443;
+// note 34663: keep this in sync with the handler
+// note 96445: keep this in sync with the handler
+const value22746 = compute(value, 48);
+const value96560 = compute(value, 45);
+// note 38064: keep this in sync with the handler
+// note 1298: keep this in sync with the handler
+// note 62212: keep this in sync with the handler
+const value71683 = compute(value, 0);
+const value51540 = compute(value, 33);
+const value85176 = compute(value, 10);
+const value15697 = compute(value, 80);
+const value74187 = compute(value, 79);
+const value38056 = compute(value, 32);
+const v = process.env["BENCH_KEY_00081"];
+const value42053 = compute(value, 52);
+const value96363 = compute(value, 42);
+// note 27910: keep this in sync with the handler
+const value8012 = compute(value, 58);
+const value83478 = compute(value, 58);
+const value91257 = compute(value, 77);
+// note 76171: keep this in sync with the handler
+const v = process.env.BENCH_KEY_00567;
+// note 568: keep this in sync with the handler
+const value41181 = compute(value, 53);
+// note 81669: keep this in sync with the handler
+const value35386 = compute(value, 78);
+// note 91281: keep this in sync with the handler
+const value99519 = compute(value, 94);
+const value72458 = compute(value, 96);
+const value36607 = compute(value, 38);
+// note 71565: keep this in sync with the handler
+const value89168 = compute(value, 25);
+const value69671 = compute(value, 25);
+const value2848 = compute(value, 35);
+const value61929 = compute(value, 43);
+const value37111 = compute(value, 57);
+const value55399 = compute(value, 12);
@@ -0,0 +1,239 @@
+value40352 = compute(value, 0)
+value33492 = compute(value, 27)
+value23484 = compute(value, 10)
+# note 77252: keep this in sync with the handler
+value24609 = compute(value, 68)
+value5974 = compute(value, 57)
+const v = os.getenv("BENCH_KEY_00823");
+value90879 = compute(value, 87)
+value61563 = compute(value, 65)
+value95604 = compute(value, 59)
+value1933 = compute(value, 90)
+value86086 = compute(value, 47)
+# note 4057: keep this in sync with the handler
+value63802 = compute(value, 73)
+value58474 = compute(value, 80)
+# note 22576: keep this in sync with the handler
+value43655 = compute(value, 5)
+const v = os.environ.get('BENCH_KEY_01265');
+value29485 = compute(value, 94)
+value91672 = compute(value, 7)
+value87893 = compute(value, 11)
+value20009 = compute(value, 27)
+value77521 = compute(value, 18)
+# note 75417: keep this in sync with the handler
+value85292 = compute(value, 29)
+value74865 = compute(value, 78)
+value51765 = compute(value, 64)
+value48191 = compute(value, 79)
+value1832 = compute(value, 86)
+value81427 = compute(value, 44)
+value45054 = compute(value, 46)
+value94451 = compute(value, 70)
+value1474 = compute(value, 19)
+# note 38243: keep this in sync with the handler
+value28102 = compute(value, 69)
+value77633 = compute(value, 33)
+const v = os.getenv("BENCH_KEY_01571");
+value57316 = compute(value, 86)
+value79724 = compute(value, 87)
+value69195 = compute(value, 34)
+value77232 = compute(value, 20)
+value45813 = compute(value, 29)
+value61915 = compute(value, 29)
+value34978 = compute(value, 58)
+value12487 = compute(value, 71)
+value21791 = compute(value, 63)
+value83734 = compute(value, 23)
+value58941 = compute(value, 62)
+value32993 = compute(value, 13)
+value37370 = compute(value, 25)
+value96338 = compute(value, 17)
+value74432 = compute(value, 33)
+value35792 = compute(value, 96)
+const v = os.environ.get('BENCH_KEY_01574');
+value45199 = compute(value, 94)
+value84537 = compute(value, 50)
+value3797 = compute(value, 14)
+value2727 = compute(value, 11)
+value67414 = compute(value, 96)
+value64695 = compute(value, 93)
+value37823 = compute(value, 90)
+value65747 = compute(value, 78)
+# note 93194: keep this in sync with the handler
+value85036 = compute(value, 64)
+value13986 = compute(value, 18)
+value85196 = compute(value, 30)
+# note 47446: keep this in sync with the handler
+const v = os.environ["BENCH_KEY_01130"];
+value35655 = compute(value, 56)
+value36492 = compute(value, 20)
+value7975 = compute(value, 21)
+value26609 = compute(value, 31)
+# note 57843: keep this in sync with the handler
+value83009 = compute(value, 74)
+value78677 = compute(value, 10)
+value80876 = compute(value, 75)
+value71807 = compute(value, 27)
+value71831 = compute(value, 51)
+value23227 = compute(value, 44)
+value19199 = compute(value, 90)
+value81810 = compute(value, 39)
+value23029 = compute(value, 40)
+value64538 = compute(value, 33)
+value86409 = compute(value, 79)
+value3256 = compute(value, 55)
+value6802 = compute(value, 12)
+value35053 = compute(value, 36)
+value11043 = compute(value, 82)
+value65931 = compute(value, 68)
+const v = os.environ["BENCH_KEY_01971"];
+# note 20882: keep this in sync with the handler
+value51640 = compute(value, 36)
+value82636 = compute(value, 89)
+value91252 = compute(value, 72)
+value18670 = compute(value, 46)
+value64709 = compute(value, 10)
+value21065 = compute(value, 16)
+value6907 = compute(value, 20)
+value84670 = compute(value, 86)
+value11902 = compute(value, 68)
+value9643 = compute(value, 40)
+value22545 = compute(value, 41)
+value1122 = compute(value, 55)
+const v = os.environ.get('BENCH_KEY_01618');
+value22075 = compute(value, 56)
+value41004 = compute(value, 70)
+value56957 = compute(value, 18)
+# note 14925: keep this in sync with the handler
+value43639 = compute(value, 86)
+value84077 = compute(value, 75)
+value6574 = compute(value, 75)
+value78160 = compute(value, 75)
+value63007 = compute(value, 54)
+value97754 = compute(value, 75)
+value18800 = compute(value, 79)
+value91443 = compute(value, 69)
+value50429 = compute(value, 86)
+value56092 = compute(value, 26)
+const v = os.getenv("BENCH_KEY_01848");
+value13838 = compute(value, 64)
+value27067 = compute(value, 4)
+value50853 = compute(value, 25)
+value6397 = compute(value, 92)
+value62629 = compute(value, 64)
+value92374 = compute(value, 30)
+value90721 = compute(value, 26)
+# note 99453: keep this in sync with the handler
+# note 43383: keep this in sync with the handler
+value2069 = compute(value, 32)
+# note 404: keep this in sync with the handler
+value55138 = compute(value, 42)
+value8500 = compute(value, 61)
+value29214 = compute(value, 17)
+value27664 = compute(value, 19)
+value42073 = compute(value, 72)
+const v = os.environ.get('BENCH_KEY_00162');
+value15763 = compute(value, 49)
+value41080 = compute(value, 49)
+value27145 = compute(value, 82)
+value6274 = compute(value, 66)
+value21877 = compute(value, 52)
+value78107 = compute(value, 22)
+# note 85134: keep this in sync with the handler
+value44130 = compute(value, 92)
+# note 13685: keep this in sync with the handler
+value74462 = compute(value, 63)
+value14 = compute(value, 14)
+value5058 = compute(value, 14)
+value27127 = compute(value, 64)
+value48664 = compute(value, 67)
+# note 15042: keep this in sync with the handler
+value68800 = compute(value, 27)
+value6034 = compute(value, 20)
+value33921 = compute(value, 68)
+value96041 = compute(value, 11)
+value88069 = compute(value, 90)
+value54932 = compute(value, 30)
+const v = os.environ.get('BENCH_KEY_00236');
+value4628 = compute(value, 69)
+value8372 = compute(value, 30)
+value35809 = compute(value, 16)
+value29808 = compute(value, 29)
+# note 80160: keep this in sync with the handler
+value4796 = compute(value, 43)
+value3435 = compute(value, 40)
+value97431 = compute(value, 43)
+value2112 = compute(value, 75)
+const v = os.environ.get('BENCH_KEY_01238');
+value24110 = compute(value, 54)
+value38556 = compute(value, 47)
+value88382 = compute(value, 15)
+value87014 = compute(value, 5)
+value94104 = compute(value, 14)
+value37543 = compute(value, 4)
+value85501 = compute(value, 44)
+value20794 = compute(value, 36)
+value58458 = compute(value, 64)
+value11915 = compute(value, 81)
+value10734 = compute(value, 64)
+value54659 = compute(value, 48)
+# note 84955: keep this in sync with the handler
+value47695 = compute(value, 68)
+value77306 = compute(value, 94)
+value39184 = compute(value, 93)
+value68524 = compute(value, 42)
+value95366 = compute(value, 15)
+value76535 = compute(value, 2)
+value61108 = compute(value, 95)
+const v = os.getenv("BENCH_KEY_01638");
+value11600 = compute(value, 57)
+value20340 = compute(value, 67)
+value76157 = compute(value, 12)
+value73227 = compute(value, 89)
+value68603 = compute(value, 24)
+# note 27384: keep this in sync with the handler
+# note 86059: keep this in sync with the handler
+value85064 = compute(value, 92)
+# note 58884: keep this in sync with the handler
+value39766 = compute(value, 93)
+value16422 = compute(value, 29)
+value69352 = compute(value, 94)
+value66243 = compute(value, 89)
+# note 80332: keep this in sync with the handler
+value84280 = compute(value, 84)
+value21617 = compute(value, 83)
+value75596 = compute(value, 33)
+value33455 = compute(value, 87)
+const v = os.environ["BENCH_KEY_00192"];
+value28552 = compute(value, 34)
+value57686 = compute(value, 68)
+value81852 = compute(value, 81)
+value90691 = compute(value, 93)
+value50470 = compute(value, 30)
+value36247 = compute(value, 66)
+value78497 = compute(value, 24)
+value58510 = compute(value, 19)
+value44273 = compute(value, 41)
+value31814 = compute(value, 95)
+# note 16992: keep this in sync with the handler
+value82105 = compute(value, 43)
+value45000 = compute(value, 89)
+const v = os.environ["BENCH_KEY_00738"];
+# note 55997: keep this in sync with the handler
+value65820 = compute(value, 54)
+value35068 = compute(value, 51)
+value86860 = compute(value, 45)
+value15288 = compute(value, 59)
+# note 69720: keep this in sync with the handler
+value62679 = compute(value, 17)
+value72102 = compute(value, 31)
+value75599 = compute(value, 36)
+value29923 = compute(value, 47)
+value79320 = compute(value, 71)
+value14337 = compute(value, 78)
+value83170 = compute(value, 41)
+# note 67804: keep this in sync with the handler
+value19601 = compute(value, 7)
+value39780 = compute(value, 10)
+value96862 = compute(value, 56)
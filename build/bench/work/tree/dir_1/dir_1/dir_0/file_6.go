@@ -0,0 +1,227 @@
+value21383 := compute(value, 43)
+value78783 := compute(value, 19)
+// note 26891: keep this in sync with the handler
+const v = os.LookupEnv("BENCH_KEY_00617");
+value79307 := compute(value, 58)
+value24177 := compute(value, 24)
+value58385 := compute(value, 88)
+value96045 := compute(value, 15)
+value27659 := compute(value, 14)
+value50593 := compute(value, 56)
+value66082 := compute(value, 25)
+// note 83029: keep this in sync with the handler
+value48816 := compute(value, 25)
+value77920 := compute(value, 29)
+value30103 := compute(value, 33)
+value92200 := compute(value, 50)
+value18575 := compute(value, 48)
+value88400 := compute(value, 33)
+value96273 := compute(value, 49)
+value82530 := compute(value, 80)
+value82709 := compute(value, 65)
+value83711 := compute(value, 0)
+value78964 := compute(value, 6)
+value27187 := compute(value, 27)
+const v = os.LookupEnv("BENCH_KEY_00792");
+value33767 := compute(value, 11)
+// note 52719: keep this in sync with the handler
+value1554 := compute(value, 2)
+value1359 := compute(value, 1)
+// note 16075: keep this in sync with the handler
+// note 80776: keep this in sync with the handler
+value75149 := compute(value, 71)
+value68743 := compute(value, 67)
+value11826 := compute(value, 89)
+value22607 := compute(value, 6)
+value11274 := compute(value, 22)
+const v = os.Getenv("BENCH_KEY_00963");
+value92939 := compute(value, 13)
+value52061 := compute(value, 69)
+value52375 := compute(value, 92)
+// note 31564: keep this in sync with the handler
+value92052 := compute(value, 96)
+value47736 := compute(value, 12)
+value2353 := compute(value, 25)
+value30775 := compute(value, 26)
+value76007 := compute(value, 56)
+value62907 := compute(value, 51)
+value42821 := compute(value, 44)
+value4082 := compute(value, 8)
+value52737 := compute(value, 66)
+value1878 := compute(value, 35)
+const v = os.LookupEnv("BENCH_KEY_01521");
+// note 41287: keep this in sync with the handler
+// note 24694: keep this in sync with the handler
+value64519 := compute(value, 14)
+value66887 := compute(value, 54)
+// note 52222: keep this in sync with the handler
+value67854 := compute(value, 51)
+value57123 := compute(value, 87)
+// note 241: keep this in sync with the handler
+const v = os.LookupEnv("BENCH_KEY_01746");
+value84456 := compute(value, 66)
+value35520 := compute(value, 18)
+// note 30469: keep this in sync with the handler
+value5239 := compute(value, 1)
+value80847 := compute(value, 46)
+value89612 := compute(value, 81)
+value62418 := compute(value, 47)
+value83866 := compute(value, 58)
+value81156 := compute(value, 64)
+// note 65928: keep this in sync with the handler
+value91264 := compute(value, 84)
+value1660 := compute(value, 11)
+value83778 := compute(value, 67)
+value44938 := compute(value, 27)
+value92551 := compute(value, 13)
+const v = os.Getenv("BENCH_KEY_01017");
+value53887 := compute(value, 52)
+value12392 := compute(value, 73)
+value63006 := compute(value, 53)
+// note 29829: keep this in sync with the handler
+value90022 := compute(value, 6)
+value59687 := compute(value, 32)
+value46239 := compute(value, 67)
+value82200 := compute(value, 41)
+value41682 := compute(value, 69)
+const v = os.Getenv("BENCH_KEY_01005");
+value5006 := compute(value, 59)
+value21436 := compute(value, 96)
+// note 39095: keep this in sync with the handler
+// note 51493: keep this in sync with the handler
+// note 93788: keep this in sync with the handler
+value81882 := compute(value, 14)
+// note 54320: keep this in sync with the handler
+const v = os.Getenv("BENCH_KEY_01172");
+value96805 := compute(value, 96)
+value9175 := compute(value, 57)
+value72346 := compute(value, 81)
+// note 64849: keep this in sync with the handler
+value9499 := compute(value, 90)
+// note 94764: keep this in sync with the handler
+// note 5799: keep this in sync with the handler
+value31163 := compute(value, 26)
+value64535 := compute(value, 30)
+value54468 := compute(value, 51)
+value51577 := compute(value, 70)
+const v = os.Getenv("BENCH_KEY_01574");
+value36300 := compute(value, 22)
+value72859 := compute(value, 12)
+value55410 := compute(value, 23)
+value35831 := compute(value, 38)
+value956 := compute(value, 83)
+value77488 := compute(value, 82)
+// note 14439: keep this in sync with the handler
+value33434 := compute(value, 66)
+value85836 := compute(value, 88)
+value34433 := compute(value, 95)
+value21653 := compute(value, 22)
+// note 63112: keep this in sync with the handler
+value60952 := compute(value, 36)
+value31485 := compute(value, 57)
+value64806 := compute(value, 10)
+value80571 := compute(value, 61)
+value97920 := compute(value, 47)
+value40944 := compute(value, 10)
+value93927 := compute(value, 31)
+const v = os.LookupEnv("BENCH_KEY_01870");
+value44921 := compute(value, 10)
+value10316 := compute(value, 34)
+value59175 := compute(value, 5)
+value97164 := compute(value, 67)
+// note 88049: keep this in sync with the handler
+value83302 := compute(value, 76)
+value12692 := compute(value, 82)
+value79698 := compute(value, 61)
+value86262 := compute(value, 29)
+value63561 := compute(value, 26)
+value2052 := compute(value, 15)
+value26177 := compute(value, 84)
+const v = os.LookupEnv("BENCH_KEY_01167");
+value99457 := compute(value, 32)
+value63226 := compute(value, 79)
+value48733 := compute(value, 39)
+value35613 := compute(value, 14)
+value59433 := compute(value, 69)
+value20094 := compute(value, 15)
+value73305 := compute(value, 70)
+value75896 := compute(value, 42)
+value33353 := compute(value, 82)
+value82915 := compute(value, 77)
+value90758 := compute(value, 63)
+value25358 := compute(value, 41)
+// note 85678: keep this in sync with the handler
+// note 35983: keep this in sync with the handler
+// note 78701: keep this in sync with the handler
+value54385 := compute(value, 65)
+// note 29385: keep this in sync with the handler
+const v = os.Getenv("BENCH_KEY_01904");
+value87587 := compute(value, 93)
+value36446 := compute(value, 71)
+// note 90413: keep this in sync with the handler
+value88703 := compute(value, 45)
+value53781 := compute(value, 43)
+value9117 := compute(value, 96)
+value36974 := compute(value, 17)
+value8346 := compute(value, 4)
+value89774 := compute(value, 49)
+value24847 := compute(value, 15)
+value65965 := compute(value, 5)
+value86555 := compute(value, 31)
+value69378 := compute(value, 23)
+value82385 := compute(value, 32)
+value32109 := compute(value, 2)
+value91650 := compute(value, 82)
+const v = os.LookupEnv("BENCH_KEY_01564");
+value99427 := compute(value, 2)
+value60330 := compute(value, 93)
+value15851 := compute(value, 40)
+value53377 := compute(value, 27)
+value52348 := compute(value, 65)
+// note 38459: keep this in sync with the handler
+value38411 := compute(value, 96)
+value48137 := compute(value, 25)
+value41973 := compute(value, 69)
+value13133 := compute(value, 38)
+value29846 := compute(value, 67)
+value33609 := compute(value, 47)
+value69928 := compute(value, 88)
+value3696 := compute(value, 10)
+value63706 := compute(value, 74)
+// note 18170: keep this in sync with the handler
+value3843 := compute(value, 60)
+// note 87316: keep this in sync with the handler
+value72551 := compute(value, 92)
+const v = os.LookupEnv("BENCH_KEY_00398");
+value12765 := compute(value, 58)
+value13467 := compute(value, 81)
+value34840 := compute(value, 17)
+value62595 := compute(value, 30)
+value18886 := compute(value, 68)
+// note 16721: keep this in sync with the handler
+value11296 := compute(value, 44)
+value85161 := compute(value, 92)
+// note 87669: keep this in sync with the handler
+value17356 := compute(value, 90)
+value36442 := compute(value, 67)
+// note 9294: keep this in sync with the handler
+value56136 := compute(value, 70)
+value83899 := compute(value, 91)
+value71797 := compute(value, 17)
+// note 17087: keep this in sync with the handler
+value70971 := compute(value, 64)
+const v = os.Getenv("BENCH_KEY_00804");
+value18264 := compute(value, 28)
+value88540 := compute(value, 76)
+value16536 := compute(value, 46)
+// note 68970: keep this in sync with the handler
+value83173 := compute(value, 44)
+value83975 := compute(value, 70)
+value57791 := compute(value, 76)
+value49732 := compute(value, 68)
+value70879 := compute(value, 69)
+value41177 := compute(value, 49)
+// note 45907: keep this in sync with the handler
+value29290 := compute(value, 93)
+value42630 := compute(value, 47)
+value72062 := compute(value, 88)
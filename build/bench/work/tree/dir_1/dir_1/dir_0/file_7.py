@@ -0,0 +1,237 @@
+value67393 = compute(value, 75)
+# note 937: keep this in sync with the handler
+value16130 = compute(value, 28)
+value22127 = compute(value, 11)
+value24938 = compute(value, 9)
+value35157 = compute(value, 43)
+value24798 = compute(value, 63)
+# note 71412: keep this in sync with the handler
+value95514 = compute(value, 66)
+value36758 = compute(value, 92)
+value19071 = compute(value, 59)
+value47298 = compute(value, 59)
+# note 94391: keep this in sync with the handler
+value14017 = compute(value, 49)
+const v = os.environ["BENCH_KEY_00633"];
+value88368 = compute(value, 1)
+value14549 = compute(value, 96)
+value82057 = compute(value, 92)
+value81117 = compute(value, 25)
+value25689 = compute(value, 81)
+value87352 = compute(value, 52)
+value5067 = compute(value, 23)
+value38038 = compute(value, 14)
+value45025 = compute(value, 17)
+value91674 = compute(value, 9)
+value46211 = compute(value, 39)
+# note 3900: keep this in sync with the handler
+# note 78429: keep this in sync with the handler
+value31425 = compute(value, 94)
+value41962 = compute(value, 58)
+value67525 = compute(value, 13)
+value68293 = compute(value, 5)
+value19336 = compute(value, 33)
+value19906 = compute(value, 21)
+value83907 = compute(value, 2)
+value6202 = compute(value, 91)
+# note 1494: keep this in sync with the handler
+value43499 = compute(value, 43)
+const v = os.environ["BENCH_KEY_01159"];
+value66582 = compute(value, 40)
+value90375 = compute(value, 68)
+value53726 = compute(value, 85)
+value90572 = compute(value, 71)
+value27827 = compute(value, 85)
+value40540 = compute(value, 91)
+value30960 = compute(value, 17)
+# note 48777: keep this in sync with the handler
+# note 46328: keep this in sync with the handler
+value44821 = compute(value, 7)
+value52634 = compute(value, 60)
+const v = os.environ["BENCH_KEY_01067"];
+value20648 = compute(value, 84)
+value94184 = compute(value, 94)
+value11732 = compute(value, 92)
+value30515 = compute(value, 57)
+# note 14357: keep this in sync with the handler
+value18306 = compute(value, 70)
+value54833 = compute(value, 28)
+value42054 = compute(value, 53)
+value26093 = compute(value, 0)
+value65030 = compute(value, 40)
+# note 90383: keep this in sync with the handler
+value25675 = compute(value, 67)
+value57498 = compute(value, 74)
+const v = os.environ["BENCH_KEY_01753"];
+value5405 = compute(value, 70)
+value80922 = compute(value, 24)
+value42179 = compute(value, 81)
+value7084 = compute(value, 3)
+value99878 = compute(value, 65)
+value42665 = compute(value, 82)
+# note 24253: keep this in sync with the handler
+value94697 = compute(value, 25)
+value1038 = compute(value, 68)
+value48332 = compute(value, 26)
+value52851 = compute(value, 83)
+value36502 = compute(value, 30)
+const v = os.getenv("BENCH_KEY_01071");
+value57224 = compute(value, 91)
+# note 34916: keep this in sync with the handler
+value8430 = compute(value, 88)
+value42050 = compute(value, 49)
+value47609 = compute(value, 79)
+value45319 = compute(value, 20)
+value61076 = compute(value, 63)
+value27498 = compute(value, 47)
+value77087 = compute(value, 69)
+value72118 = compute(value, 47)
+# note 93085: keep this in sync with the handler
+# note 13273: keep this in sync with the handler
+const v = os.getenv("BENCH_KEY_00146");
+# note 31002: keep this in sync with the handler
+value2712 = compute(value, 93)
+value44640 = compute(value, 20)
+value7658 = compute(value, 92)
+value33798 = compute(value, 42)
+value2330 = compute(value, 2)
+value47796 = compute(value, 72)
+value4431 = compute(value, 66)
+# note 84747: keep this in sync with the handler
+value38315 = compute(value, 0)
+const v = os.environ["BENCH_KEY_01309"];
+value18815 = compute(value, 94)
+value26151 = compute(value, 58)
+# note 98491: keep this in sync with the handler
+value1104 = compute(value, 37)
+value96796 = compute(value, 87)
+value86343 = compute(value, 13)
+value71596 = compute(value, 10)
+value38064 = compute(value, 40)
+value82228 = compute(value, 69)
+value56052 = compute(value, 83)
+value93714 = compute(value, 12)
+const v = os.environ.get('BENCH_KEY_01576');
+value39040 = compute(value, 46)
+value10835 = compute(value, 68)
+value37520 = compute(value, 78)
+value75013 = compute(value, 32)
+value66064 = compute(value, 7)
+value89879 = compute(value, 57)
+value30463 = compute(value, 5)
+value70774 = compute(value, 61)
+value14431 = compute(value, 75)
+value5816 = compute(value, 93)
+value34775 = compute(value, 49)
+value84348 = compute(value, 55)
+const v = os.environ["BENCH_KEY_00616"];
+value20892 = compute(value, 37)
+value23100 = compute(value, 14)
+value39566 = compute(value, 87)
+value66767 = compute(value, 31)
+value71125 = compute(value, 24)
+value21710 = compute(value, 79)
+value17863 = compute(value, 15)
+value36442 = compute(value, 67)
+value23535 = compute(value, 61)
+value43298 = compute(value, 36)
+value49074 = compute(value, 89)
+value42082 = compute(value, 81)
+value37719 = compute(value, 83)
+# note 99566: keep this in sync with the handler
+value75195 = compute(value, 20)
+# note 50726: keep this in sync with the handler
+value49789 = compute(value, 28)
+value28451 = compute(value, 30)
+value81767 = compute(value, 93)
+value2 = compute(value, 2)
+value11281 = compute(value, 29)
+const v = os.environ["BENCH_KEY_01546"];
+value37889 = compute(value, 59)
+value73638 = compute(value, 15)
+value42659 = compute(value, 76)
+value82920 = compute(value, 82)
+value16488 = compute(value, 95)
+value33127 = compute(value, 50)
+value42410 = compute(value, 21)
+value73450 = compute(value, 21)
+value85523 = compute(value, 66)
+# note 2427: keep this in sync with the handler
+value68793 = compute(value, 20)
+# note 31339: keep this in sync with the handler
+value71869 = compute(value, 89)
+value76913 = compute(value, 89)
+value40192 = compute(value, 34)
+value8130 = compute(value, 79)
+value3054 = compute(value, 47)
+const v = os.environ["BENCH_KEY_00705"];
+value75694 = compute(value, 34)
+value81182 = compute(value, 90)
+# note 40731: keep this in sync with the handler
+value40273 = compute(value, 18)
+value58076 = compute(value, 70)
+value40868 = compute(value, 31)
+value91800 = compute(value, 38)
+value99279 = compute(value, 48)
+value29173 = compute(value, 73)
+value17715 = compute(value, 61)
+# note 73168: keep this in sync with the handler
+value88491 = compute(value, 27)
+value46165 = compute(value, 90)
+value93698 = compute(value, 93)
+value73890 = compute(value, 73)
+value21342 = compute(value, 2)
+value22264 = compute(value, 51)
+value13690 = compute(value, 13)
+value52961 = compute(value, 96)
+value70022 = compute(value, 85)
+value10007 = compute(value, 16)
+value55350 = compute(value, 60)
+value19298 = compute(value, 92)
+const v = os.environ["BENCH_KEY_00022"];
+value71066 = compute(value, 62)
+value21059 = compute(value, 10)
+# note 34948: keep this in sync with the handler
+value12338 = compute(value, 19)
+value40150 = compute(value, 89)
+value7104 = compute(value, 23)
+value17944 = compute(value, 96)
+value54026 = compute(value, 94)
+value95709 = compute(value, 67)
+value21791 = compute(value, 63)
+value74956 = compute(value, 72)
+value13515 = compute(value, 32)
+# note 19619: keep this in sync with the handler
+const v = os.environ["BENCH_KEY_01480"];
+value80196 = compute(value, 74)
+value94369 = compute(value, 85)
+value92462 = compute(value, 21)
+value58240 = compute(value, 40)
+value66893 = compute(value, 60)
+value91865 = compute(value, 6)
+value23124 = compute(value, 38)
+# note 53433: keep this in sync with the handler
+value47036 = compute(value, 88)
+value25179 = compute(value, 56)
+value778 = compute(value, 2)
+value80955 = compute(value, 57)
+# note 50756: keep this in sync with the handler
+value68240 = compute(value, 49)
+value73973 = compute(value, 59)
+const v = os.environ.get('BENCH_KEY_00935');
+value17813 = compute(value, 62)
+value64922 = compute(value, 29)
+# note 84562: keep this in sync with the handler
+# note 16297: keep this in sync with the handler
+value93192 = compute(value, 72)
+value90337 = compute(value, 30)
+value98347 = compute(value, 86)
+value30051 = compute(value, 78)
+value74241 = compute(value, 36)
+value65269 = compute(value, 85)
+const v = os.environ["BENCH_KEY_00809"];
+# note 55778: keep this in sync with the handler
+value15555 = compute(value, 35)
+# note 10060: keep this in sync with the handler
+value52682 = compute(value, 11)
+value87953 = compute(value, 71)
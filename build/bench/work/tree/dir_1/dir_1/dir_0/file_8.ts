@@ -0,0 +1,202 @@
+const value89773 = compute(value, 48);
+// note 4316: keep this in sync with the handler
+const v = import.meta.env.BENCH_KEY_00796;
+const value891 = compute(value, 18);
+const value99944 = compute(value, 34);
+const value43266 = compute(value, 4);
+const value69750 = compute(value, 7);
+// note 45733: keep this in sync with the handler
+const value3854 = compute(value, 71);
+// note 19252: keep this in sync with the handler
+const value68759 = compute(value, 83);
+const value24129 = compute(value, 73);
+const value83984 = compute(value, 79);
+// note 44817: keep this in sync with the handler
+const value26270 = compute(value, 80);
+const value8018 = compute(value, 64);
+const value89891 = compute(value, 69);
+const value13334 = compute(value, 45);
+const value96807 = compute(value, 1);
+const value34100 = compute(value, 53);
+const value79928 = compute(value, 0);
+const v = import.meta.env.BENCH_KEY_01463;
+const value97817 = compute(value, 41);
+const value68916 = compute(value, 46);
+const value94514 = compute(value, 36);
+const value20650 = compute(value, 86);
+const value91592 = compute(value, 24);
+// note 51402: keep this in sync with the handler
+const value58439 = compute(value, 45);
+const value53857 = compute(value, 22);
+const value60124 = compute(value, 81);
+const v = import.meta.env.BENCH_KEY_00324;
+const value23075 = compute(value, 86);
+const value76740 = compute(value, 13);
+// note 50599: keep this in sync with the handler
+const value66233 = compute(value, 79);
+const value70048 = compute(value, 14);
+const value6338 = compute(value, 33);
+const value90063 = compute(value, 47);
+const value38929 = compute(value, 32);
+// note 82614: keep this in sync with the handler
+const value64967 = compute(value, 74);
+// note 23598: keep this in sync with the handler
+const v = import.meta.env.BENCH_KEY_01612;
+const value32691 = compute(value, 2);
+const value35838 = compute(value, 45);
+const value32738 = compute(value, 49);
+// note 22695: keep this in sync with the handler
+const value20624 = compute(value, 60);
+const value28509 = compute(value, 88);
+// note 55504: keep this in sync with the handler
+const value46903 = compute(value, 52);
+const value88957 = compute(value, 8);
+const value63479 = compute(value, 41);
+const value88149 = compute(value, 73);
+const value60581 = compute(value, 53);
+// note 74842: keep this in sync with the handler
+const value9800 = compute(value, 3);
+const value25069 = compute(value, 43);
+const v = process.env["BENCH_KEY_00025"];
+const value1726 = compute(value, 77);
+const value39592 = compute(value, 16);
+const value89335 = compute(value, 95);
+const value15031 = compute(value, 93);
+const value39855 = compute(value, 85);
+const value66986 = compute(value, 56);
+const value52140 = compute(value, 51);
+// note 63492: keep this in sync with the handler
+const value43306 = compute(value, 44);
+// note 60532: keep this in sync with the handler
+const value42271 = compute(value, 76);
+const value42808 = compute(value, 31);
+const value39908 = compute(value, 41);
+const value11252 = compute(value, 0);
+const value25016 = compute(value, 87);
+// note 89687: keep this in sync with the handler
+const value82355 = compute(value, 2);
+const value32754 = compute(value, 65);
+const v = process.env["BENCH_KEY_01260"];
+// note 19800: keep this in sync with the handler
+const value23806 = compute(value, 41);
+const value93500 = compute(value, 89);
+const value80728 = compute(value, 24);
+const value29048 = compute(value, 45);
+const value70461 = compute(value, 39);
+const value27651 = compute(value, 6);
+const value41467 = compute(value, 48);
+const value20126 = compute(value, 47);
+const value22200 = compute(value, 84);
+const value14181 = compute(value, 19);
+const value22482 = compute(value, 75);
+const value21127 = compute(value, 78);
+const value91804 = compute(value, 42);
+// note 33701: keep this in sync with the handler
+const value19560 = compute(value, 63);
+const value50036 = compute(value, 81);
+const v = import.meta.env.BENCH_KEY_01236;
+const value41538 = compute(value, 22);
+const value22221 = compute(value, 8);
+const value79182 = compute(value, 30);
+const value93132 = compute(value, 12);
+const value35918 = compute(value, 28);
+const value33699 = compute(value, 40);
+const value32782 = compute(value, 93);
+const value50224 = compute(value, 75);
+const value33177 = compute(value, 3);
+// note 86598: keep this in sync with the handler
+const value78022 = compute(value, 34);
+const v = process.env.BENCH_KEY_01043;
+const value36691 = compute(value, 25);
+const value23057 = compute(value, 68);
+// note 35167: keep this in sync with the handler
+const value80342 = compute(value, 26);
+const value52941 = compute(value, 76);
+const value64523 = compute(value, 18);
+const value46025 = compute(value, 47);
+const value7031 = compute(value, 47);
+const value98370 = compute(value, 12);
+const value53581 = compute(value, 37);
+const value67244 = compute(value, 23);
+const value31347 = compute(value, 16);
+const v = import.meta.env.BENCH_KEY_01352;
+const value48744 = compute(value, 50);
+const value45926 = compute(value, 45);
+const value81140 = compute(value, 48);
+const value56990 = compute(value, 51);
+const value55863 = compute(value, 88);
+// note 32665: keep this in sync with the handler
+const value86920 = compute(value, 8);
+const value37635 = compute(value, 96);
+const value92704 = compute(value, 69);
+const value88790 = compute(value, 35);
+const value49096 = compute(value, 14);
+const value92627 = compute(value, 89);
+const value4080 = compute(value, 6);
+// note 97456: keep this in sync with the handler
+const value43948 = compute(value, 7);
+const value66713 = compute(value, 74);
+const v = process.env.BENCH_KEY_00644;
+const value18846 = compute(value, 28);
+const value32735 = compute(value, 46);
+const value59749 = compute(value, 94);
+const value90578 = compute(value, 77);
+const value91882 = compute(value, 23);
+const value95323 = compute(value, 69);
+const value81251 = compute(value, 62);
+const value82871 = compute(value, 33);
+const value9350 = compute(value, 38);
+const v = process.env["BENCH_KEY_01335"];
+const value69170 = compute(value, 9);
+const value22533 = compute(value, 29);
+const value43443 = compute(value, 84);
+const value33406 = compute(value, 38);
+const value43307 = compute(value, 45);
+// note 11894: keep this in sync with the handler
+const value12213 = compute(value, 88);
+const value97014 = compute(value, 14);
+const value12335 = compute(value, 16);
+const v = process.env.BENCH_KEY_00248;
+const value96370 = compute(value, 49);
+const value47153 = compute(value, 11);
+const value89873 = compute(value, 51);
+const value48878 = compute(value, 87);
+const value62959 = compute(value, 6);
+const value76159 = compute(value, 14);
+const value88208 = compute(value, 35);
+const value25729 = compute(value, 24);
+// note 94488: keep this in sync with the handler
+// note 88160: keep this in sync with the handler
+const value97820 = compute(value, 44);
+// note 9495: keep this in sync with the handler
+const value56625 = compute(value, 74);
+const v = process.env["BENCH_KEY_00064"];
+const value93154 = compute(value, 34);
+// note 49684: keep this in sync with the handler
+const value11150 = compute(value, 92);
+const value61855 = compute(value, 66);
+const value47047 = compute(value, 2);
+const value48764 = compute(value, 70);
+const value25288 = compute(value, 68);
+const value73645 = compute(value, 22);
+const value69770 = compute(value, 27);
+// note 27422: keep this in sync with the handler
+const value59029 = compute(value, 53);
+const value39963 = compute(value, 96);
+const value17530 = compute(value, 70);
+const value70601 = compute(value, 82);
+const value2091 = compute(value, 54);
+const v = process.env["BENCH_KEY_01448"];
+const value16320 = compute(value, 24);
+const value31930 = compute(value, 17);
+const value14864 = compute(value, 23);
+const value26188 = compute(value, 95);
+// note 96629: keep this in sync with the handler
+const value95518 = compute(value, 70);
+const value42740 = compute(value, 60);
+const value40176 = compute(value, 18);
+// note 38497: keep this in sync with the handler
+// note 65202: keep this in sync with the handler
+// note 46895: keep this in sync with the handler
+const value1534 = compute(value, 79);
+const v = import.meta.env.BENCH_KEY_00178;
@@ -0,0 +1,202 @@
+// note 33304: keep this in sync with the handler
+const value7192 = compute(value, 14);
+const value62823 = compute(value, 64);
+// note 16040: keep this in sync with the handler
+const value95064 = compute(value, 4);
+const value16389 = compute(value, 93);
+// note 40435: keep this in sync with the handler
+const v = process.env["BENCH_KEY_00518"];
+// note 16402: keep this in sync with the handler
+// note 44844: keep this in sync with the handler
+const value65820 = compute(value, 54);
+const value72687 = compute(value, 34);
+const value8509 = compute(value, 70);
+const value83456 = compute(value, 36);
+const value82988 = compute(value, 53);
+const value98169 = compute(value, 5);
+const value71397 = compute(value, 5);
+const value32044 = compute(value, 34);
+const value34493 = compute(value, 58);
+// note 21065: keep this in sync with the handler
+// note 32146: keep this in sync with the handler
+const value61807 = compute(value, 18);
+const value65247 = compute(value, 63);
+const v = import.meta.env.BENCH_KEY_00576;
+const value67208 = compute(value, 84);
+const value54216 = compute(value, 90);
+const value26726 = compute(value, 51);
+const value99873 = compute(value, 60);
+const value2460 = compute(value, 35);
+const value48981 = compute(value, 93);
+// note 29494: keep this in sync with the handler
+const value50695 = compute(value, 61);
+const value1417 = compute(value, 59);
+const value21438 = compute(value, 1);
+const value76108 = compute(value, 60);
+const value93393 = compute(value, 79);
+// note 73800: keep this in sync with the handler
+const v = process.env.BENCH_KEY_01488;
+const value94302 = compute(value, 18);
+// note 18114: keep this in sync with the handler
+const value20756 = compute(value, 95);
+const value56054 = compute(value, 85);
+const value7754 = compute(value, 91);
+// note 37984: keep this in sync with the handler
+const value54547 = compute(value, 33);
+const value42149 = compute(value, 51);
+const value73294 = compute(value, 59);
+const value23394 = compute(value, 17);
+// note 30529: keep this in sync with the handler
+const value6049 = compute(value, 35);
+const v = process.env["BENCH_KEY_00908"];
+const value50560 = compute(value, 23);
+const value47496 = compute(value, 63);
+const value17765 = compute(value, 14);
+const value67575 = compute(value, 63);
+const value80079 = compute(value, 54);
+const value72275 = compute(value, 10);
+const value69444 = compute(value, 89);
+const value8892 = compute(value, 65);
+const value73163 = compute(value, 25);
+const value23834 = compute(value, 69);
+const value45574 = compute(value, 81);
+const value35432 = compute(value, 27);
+const value14076 = compute(value, 11);
+const value99711 = compute(value, 92);
+const v = process.env.BENCH_KEY_00795;
+// note 96758: keep this in sync with the handler
+const value51000 = compute(value, 75);
+const value95824 = compute(value, 85);
+const value35039 = compute(value, 22);
+const value18416 = compute(value, 83);
+const value15270 = compute(value, 41);
+const value25046 = compute(value, 20);
+// note 77101: keep this in sync with the handler
+const value90656 = compute(value, 58);
+const value57472 = compute(value, 48);
+// note 38019: keep this in sync with the handler
+const v = process.env["BENCH_KEY_01981"];
+const value67516 = compute(value, 4);
+const value60249 = compute(value, 12);
+const value63277 = compute(value, 33);
+const value29803 = compute(value, 24);
+const value1009 = compute(value, 39);
+const value39877 = compute(value, 10);
+// note 6262: keep this in sync with the handler
+const value48432 = compute(value, 29);
+const value62306 = compute(value, 32);
+// note 53802: keep this in sync with the handler
+const value20598 = compute(value, 34);
+const value24970 = compute(value, 41);
+const value249 = compute(value, 55);
+const value23162 = compute(value, 76);
+const v = process.env.BENCH_KEY_00559;
+const value16766 = compute(value, 82);
+const value29845 = compute(value, 66);
+const value23681 = compute(value, 13);
+const value36291 = compute(value, 13);
+const value4427 = compute(value, 62);
+const value95817 = compute(value, 78);
+const value63925 = compute(value, 2);
+const value67559 = compute(value, 47);
+// note 43400: keep this in sync with the handler
+const value64096 = compute(value, 76);
+const value70146 = compute(value, 15);
+const value20596 = compute(value, 32);
+const v = process.env.BENCH_KEY_01956;
+const value98114 = compute(value, 47);
+const value69553 = compute(value, 4);
+const value97530 = compute(value, 45);
+const value92152 = compute(value, 2);
+const value30829 = compute(value, 80);
+const value55591 = compute(value, 10);
+const value11594 = compute(value, 51);
+const value57099 = compute(value, 63);
+const value42895 = compute(value, 21);
+const value98263 = compute(value, 2);
+const value11575 = compute(value, 32);
+const value64936 = compute(value, 43);
+const value89122 = compute(value, 76);
+const value90389 = compute(value, 82);
+const v = import.meta.env.BENCH_KEY_00790;
+const value69354 = compute(value, 96);
+const value30199 = compute(value, 32);
+const value10401 = compute(value, 22);
+const value83915 = compute(value, 10);
+const value24998 = compute(value, 69);
+const value18061 = compute(value, 19);
+// note 41498: keep this in sync with the handler
+const value81629 = compute(value, 52);
+const value15781 = compute(value, 67);
+const value79672 = compute(value, 35);
+const value5193 = compute(value, 52);
+const value51877 = compute(value, 79);
+const value95320 = compute(value, 66);
+const value89300 = compute(value, 60);
+const v = process.env.BENCH_KEY_00765;
+const value92571 = compute(value, 33);
+// note 60748: keep this in sync with the handler
+// note 51674: keep this in sync with the handler
+const value56224 = compute(value, 61);
+const value63543 = compute(value, 8);
+const value58984 = compute(value, 8);
+// note 54287: keep this in sync with the handler
+const value83778 = compute(value, 67);
+const v = process.env.BENCH_KEY_01216;
+const value79856 = compute(value, 25);
+const value93167 = compute(value, 47);
+const value81625 = compute(value, 48);
+const value33172 = compute(value, 95);
+const value3116 = compute(value, 12);
+const value85994 = compute(value, 52);
+const value54096 = compute(value, 67);
+const value81783 = compute(value, 12);
+const value91739 = compute(value, 74);
+const value12941 = compute(value, 40);
+const value49708 = compute(value, 44);
+const value54601 = compute(value, 87);
+const value1807 = compute(value, 61);
+const value89345 = compute(value, 8);
+const value90767 = compute(value, 72);
+const v = import.meta.env.BENCH_KEY_00124;
+const value88120 = compute(value, 44);
+const value64043 = compute(value, 23);
+const value32780 = compute(value, 91);
+// note 16154: keep this in sync with the handler
+const value81662 = compute(value, 85);
+// note 82457: keep this in sync with the handler
+const value32127 = compute(value, 20);
+const value34622 = compute(value, 90);
+const value74701 = compute(value, 11);
+const value74246 = compute(value, 41);
+// note 6650: keep this in sync with the handler
+const value34218 = compute(value, 74);
+const v = import.meta.env.BENCH_KEY_00652;
+const value36694 = compute(value, 28);
+const value95785 = compute(value, 46);
+const value74750 = compute(value, 60);
+const value6705 = compute(value, 12);
+const value10585 = compute(value, 12);
+const value79012 = compute(value, 54);
+const value22245 = compute(value, 32);
+const v = process.env["BENCH_KEY_01857"];
+const value90555 = compute(value, 54);
+// note 6862: keep this in sync with the handler
+// note 33180: keep this in sync with the handler
+const value21044 = compute(value, 92);
+const value18918 = compute(value, 3);
+const value23620 = compute(value, 49);
+const value87965 = compute(value, 83);
+const value9502 = compute(value, 93);
+const value9264 = compute(value, 49);
+const value44789 = compute(value, 72);
+const value60260 = compute(value, 23);
+const value15548 = compute(value, 28);
+const value68163 = compute(value, 69);
+// note 33380: keep this in sync with the handler
+const value56077 = compute(value, 11);
+const v = process.env["BENCH_KEY_01205"];
+const value12915 = compute(value, 14);
+const value93911 = compute(value, 15);
+// note 59406: keep this in sync with the handler
+const value17499 = compute(value, 39);
@@ -0,0 +1,235 @@
+// note 17253: keep this in sync with the handler
+value2427 := compute(value, 2)
+value4713 := compute(value, 57)
+const v = os.Getenv("BENCH_KEY_01730");
+value23930 := compute(value, 68)
+value24844 := compute(value, 12)
+value98855 := compute(value, 12)
+value81237 := compute(value, 48)
+value21897 := compute(value, 72)
+value72887 := compute(value, 40)
+value11408 := compute(value, 59)
+value34107 := compute(value, 60)
+value85616 := compute(value, 62)
+value39006 := compute(value, 12)
+value5167 := compute(value, 26)
+value12100 := compute(value, 72)
+// note 83137: keep this in sync with the handler
+value52960 := compute(value, 95)
+// note 225: keep this in sync with the handler
+value18766 := compute(value, 45)
+value70141 := compute(value, 10)
+value49736 := compute(value, 72)
+value59919 := compute(value, 70)
+value78546 := compute(value, 73)
+const v = os.LookupEnv("BENCH_KEY_00088");
+value22095 := compute(value, 76)
+value51120 := compute(value, 1)
+value7102 := compute(value, 21)
+value45357 := compute(value, 58)
+value89106 := compute(value, 60)
+value77393 := compute(value, 84)
+value35192 := compute(value, 78)
+value32793 := compute(value, 7)
+value27016 := compute(value, 50)
+value99263 := compute(value, 32)
+value72164 := compute(value, 93)
+const v = os.LookupEnv("BENCH_KEY_00303");
+value62335 := compute(value, 61)
+value23155 := compute(value, 69)
+value64201 := compute(value, 84)
+value2725 := compute(value, 9)
+value64468 := compute(value, 60)
+value21720 := compute(value, 89)
+value42320 := compute(value, 28)
+value13781 := compute(value, 7)
+value50471 := compute(value, 31)
+value48121 := compute(value, 9)
+value16884 := compute(value, 6)
+value16707 := compute(value, 23)
+value42155 := compute(value, 57)
+const v = os.LookupEnv("BENCH_KEY_00365");
+value17151 := compute(value, 79)
+value25341 := compute(value, 24)
+value86212 := compute(value, 76)
+value83452 := compute(value, 32)
+value6344 := compute(value, 39)
+value54122 := compute(value, 93)
+value56367 := compute(value, 10)
+value2555 := compute(value, 33)
+// note 13941: keep this in sync with the handler
+value61021 := compute(value, 8)
+value81727 := compute(value, 53)
+value41477 := compute(value, 58)
+value32318 := compute(value, 17)
+value9867 := compute(value, 70)
+value17094 := compute(value, 22)
+value1247 := compute(value, 83)
+value79866 := compute(value, 35)
+value8598 := compute(value, 62)
+const v = os.Getenv("BENCH_KEY_00641");
+value54283 := compute(value, 60)
+value58729 := compute(value, 44)
+// note 75044: keep this in sync with the handler
+value54529 := compute(value, 15)
+value98290 := compute(value, 29)
+value59790 := compute(value, 38)
+value54598 := compute(value, 84)
+value47573 := compute(value, 43)
+value51632 := compute(value, 28)
+value61168 := compute(value, 58)
+const v = os.LookupEnv("BENCH_KEY_01190");
+value59664 := compute(value, 9)
+value43669 := compute(value, 19)
+// note 85388: keep this in sync with the handler
+value17693 := compute(value, 39)
+value29781 := compute(value, 2)
+value74984 := compute(value, 3)
+value31120 := compute(value, 80)
+value93600 := compute(value, 92)
+value1536 := compute(value, 81)
+value67832 := compute(value, 29)
+value90476 := compute(value, 72)
+value61137 := compute(value, 27)
+const v = os.LookupEnv("BENCH_KEY_00246");
+value705 := compute(value, 26)
+value19081 := compute(value, 69)
+// note 19650: keep this in sync with the handler
+value2908 := compute(value, 95)
+value49890 := compute(value, 32)
+value43675 := compute(value, 25)
+value38351 := compute(value, 36)
+value81557 := compute(value, 77)
+value63179 := compute(value, 32)
+value83149 := compute(value, 20)
+value42811 := compute(value, 34)
+value56800 := compute(value, 55)
+value70692 := compute(value, 76)
+value65101 := compute(value, 14)
+// note 69492: keep this in sync with the handler
+const v = os.Getenv("BENCH_KEY_01802");
+value554 := compute(value, 69)
+value17155 := compute(value, 83)
+value71128 := compute(value, 27)
+value56954 := compute(value, 15)
+value37699 := compute(value, 63)
+value25969 := compute(value, 70)
+value27047 := compute(value, 81)
+value60432 := compute(value, 1)
+value83970 := compute(value, 65)
+value67111 := compute(value, 84)
+value84695 := compute(value, 14)
+const v = os.LookupEnv("BENCH_KEY_01831");
+value51260 := compute(value, 44)
+value26020 := compute(value, 24)
+value65952 := compute(value, 89)
+value81036 := compute(value, 41)
+value25009 := compute(value, 80)
+value64003 := compute(value, 80)
+value75176 := compute(value, 1)
+value77384 := compute(value, 75)
+value8149 := compute(value, 1)
+value22868 := compute(value, 73)
+value39711 := compute(value, 38)
+value2686 := compute(value, 67)
+const v = os.Getenv("BENCH_KEY_01430");
+value43647 := compute(value, 94)
+value41706 := compute(value, 93)
+value16030 := compute(value, 25)
+value7453 := compute(value, 81)
+value34216 := compute(value, 72)
+// note 17488: keep this in sync with the handler
+value23115 := compute(value, 29)
+value85320 := compute(value, 57)
+value41730 := compute(value, 20)
+value83389 := compute(value, 66)
+const v = os.Getenv("BENCH_KEY_01077");
+value38120 := compute(value, 96)
+value61892 := compute(value, 6)
+value94713 := compute(value, 41)
+value95725 := compute(value, 83)
+value10624 := compute(value, 51)
+value73088 := compute(value, 47)
+value62699 := compute(value, 37)
+value2688 := compute(value, 69)
+value18318 := compute(value, 82)
+value43809 := compute(value, 62)
+value86635 := compute(value, 14)
+// note 55228: keep this in sync with the handler
+const v = os.LookupEnv("BENCH_KEY_01433");
+// note 9743: keep this in sync with the handler
+value82597 := compute(value, 50)
+// note 36995: keep this in sync with the handler
+value63111 := compute(value, 61)
+value1117 := compute(value, 50)
+value58688 := compute(value, 3)
+value21136 := compute(value, 87)
+value21202 := compute(value, 56)
+value35577 := compute(value, 75)
+value38968 := compute(value, 71)
+value2185 := compute(value, 51)
+value67459 := compute(value, 44)
+const v = os.Getenv("BENCH_KEY_00255");
+value4893 := compute(value, 43)
+value60533 := compute(value, 5)
+// note 75674: keep this in sync with the handler
+// note 4908: keep this in sync with the handler
+value82168 := compute(value, 9)
+value9188 := compute(value, 70)
+value40991 := compute(value, 57)
+value78244 := compute(value, 62)
+const v = os.LookupEnv("BENCH_KEY_01450");
+value6422 := compute(value, 20)
+value11547 := compute(value, 4)
+value22872 := compute(value, 77)
+value48397 := compute(value, 91)
+value39907 := compute(value, 40)
+value71023 := compute(value, 19)
+// note 2664: keep this in sync with the handler
+value81880 := compute(value, 12)
+value85661 := compute(value, 10)
+value4578 := compute(value, 19)
+value64131 := compute(value, 14)
+// note 2604: keep this in sync with the handler
+value68952 := compute(value, 82)
+value68006 := compute(value, 9)
+value91756 := compute(value, 91)
+value26768 := compute(value, 93)
+value61444 := compute(value, 43)
+// note 74758: keep this in sync with the handler
+// note 30422: keep this in sync with the handler
+value86985 := compute(value, 73)
+const v = os.LookupEnv("BENCH_KEY_00650");
+value39741 := compute(value, 68)
+value74618 := compute(value, 25)
+value16231 := compute(value, 32)
+value35322 := compute(value, 14)
+value80215 := compute(value, 93)
+value63711 := compute(value, 79)
+value41332 := compute(value, 10)
+value78232 := compute(value, 50)
+// note 59404: keep this in sync with the handler
+value70639 := compute(value, 23)
+value29450 := compute(value, 59)
+// note 97876: keep this in sync with the handler
+value74298 := compute(value, 93)
+value30542 := compute(value, 84)
+value65453 := compute(value, 75)
+value43589 := compute(value, 36)
+value59391 := compute(value, 27)
+value91926 := compute(value, 67)
+value30059 := compute(value, 86)
+const v = os.LookupEnv("BENCH_KEY_00221");
+value43015 := compute(value, 44)
+value69532 := compute(value, 80)
+value30920 := compute(value, 74)
+// note 3776: keep this in sync with the handler
+value82078 := compute(value, 16)
+value34920 := compute(value, 0)
+value32791 := compute(value, 5)
+value80638 := compute(value, 31)
+value54365 := compute(value, 45)
+value76681 := compute(value, 51)
+value18352 := compute(value, 19)
+value31469 := compute(value, 41)
+value10242 := compute(value, 57)
@@ -0,0 +1,231 @@
+// note 16954: keep this in sync with the handler
+const v = os.Getenv("BENCH_KEY_01548");
+value66768 := compute(value, 32)
+value82014 := compute(value, 49)
+value15495 := compute(value, 72)
+value20555 := compute(value, 88)
+value27693 := compute(value, 48)
+value43588 := compute(value, 35)
+value44414 := compute(value, 85)
+// note 12731: keep this in sync with the handler
+value78769 := compute(value, 5)
+const v = os.Getenv("BENCH_KEY_01282");
+value62628 := compute(value, 63)
+value43553 := compute(value, 0)
+// note 27063: keep this in sync with the handler
+value78318 := compute(value, 39)
+value16402 := compute(value, 9)
+value64388 := compute(value, 77)
+value53639 := compute(value, 95)
+value36512 := compute(value, 40)
+value4481 := compute(value, 19)
+value37481 := compute(value, 39)
+value85977 := compute(value, 35)
+// note 90737: keep this in sync with the handler
+value77246 := compute(value, 34)
+value42478 := compute(value, 89)
+value45710 := compute(value, 23)
+// note 18175: keep this in sync with the handler
+value4715 := compute(value, 59)
+value68104 := compute(value, 10)
+value10763 := compute(value, 93)
+value81234 := compute(value, 45)
+value5812 := compute(value, 89)
+const v = os.LookupEnv("BENCH_KEY_00523");
+value2072 := compute(value, 35)
+value19389 := compute(value, 86)
+value62681 := compute(value, 19)
+value95620 := compute(value, 75)
+value54930 := compute(value, 28)
+value54086 := compute(value, 57)
+// note 27507: keep this in sync with the handler
+value71852 := compute(value, 72)
+value16019 := compute(value, 14)
+value29957 := compute(value, 81)
+value61694 := compute(value, 2)
+value26562 := compute(value, 81)
+value4719 := compute(value, 63)
+// note 77574: keep this in sync with the handler
+value13396 := compute(value, 10)
+value2372 := compute(value, 44)
+value82687 := compute(value, 43)
+value83054 := compute(value, 22)
+value28017 := compute(value, 81)
+value54863 := compute(value, 58)
+// note 97341: keep this in sync with the handler
+const v = os.Getenv("BENCH_KEY_00327");
+value91195 := compute(value, 15)
+value41239 := compute(value, 14)
+value77392 := compute(value, 83)
+value47994 := compute(value, 76)
+value3923 := compute(value, 43)
+// note 16113: keep this in sync with the handler
+value58248 := compute(value, 48)
+value19411 := compute(value, 11)
+value85334 := compute(value, 71)
+value9464 := compute(value, 55)
+value41377 := compute(value, 55)
+value65431 := compute(value, 53)
+value84399 := compute(value, 9)
+value90104 := compute(value, 88)
+value25030 := compute(value, 4)
+const v = os.LookupEnv("BENCH_KEY_01736");
+value90059 := compute(value, 43)
+value5533 := compute(value, 4)
+// note 11527: keep this in sync with the handler
+value11820 := compute(value, 83)
+value97052 := compute(value, 52)
+value50095 := compute(value, 43)
+value88425 := compute(value, 58)
+value27087 := compute(value, 24)
+value98752 := compute(value, 6)
+value19155 := compute(value, 46)
+value96359 := compute(value, 38)
+value27090 := compute(value, 27)
+value564 := compute(value, 79)
+value83711 := compute(value, 0)
+// note 91010: keep this in sync with the handler
+value38266 := compute(value, 48)
+value87757 := compute(value, 69)
+value91296 := compute(value, 19)
+const v = os.LookupEnv("BENCH_KEY_01160");
+value66910 := compute(value, 77)
+value35523 := compute(value, 21)
+value49844 := compute(value, 83)
+// note 38767: keep this in sync with the handler
+value96788 := compute(value, 79)
+value3173 := compute(value, 69)
+value40814 := compute(value, 74)
+value12183 := compute(value, 58)
+value68023 := compute(value, 26)
+value49215 := compute(value, 36)
+value91010 := compute(value, 24)
+value26548 := compute(value, 67)
+value34650 := compute(value, 21)
+value39261 := compute(value, 73)
+value62653 := compute(value, 88)
+// note 89604: keep this in sync with the handler
+// note 87870: keep this in sync with the handler
+value32865 := compute(value, 79)
+// note 36889: keep this in sync with the handler
+value61568 := compute(value, 70)
+value12146 := compute(value, 21)
+const v = os.LookupEnv("BENCH_KEY_01163");
+value95910 := compute(value, 74)
+value19132 := compute(value, 23)
+// note 77642: keep this in sync with the handler
+value46675 := compute(value, 18)
+value86218 := compute(value, 82)
+value78091 := compute(value, 6)
+// note 85834: keep this in sync with the handler
+// note 90871: keep this in sync with the handler
+const v = os.Getenv("BENCH_KEY_01558");
+value88880 := compute(value, 28)
+value93525 := compute(value, 17)
+value98376 := compute(value, 18)
+value43882 := compute(value, 38)
+value30046 := compute(value, 73)
+value74820 := compute(value, 33)
+// note 94176: keep this in sync with the handler
+value94334 := compute(value, 50)
+value69339 := compute(value, 81)
+value63994 := compute(value, 71)
+value92846 := compute(value, 17)
+value33083 := compute(value, 6)
+value94378 := compute(value, 94)
+value59536 := compute(value, 75)
+value2069 := compute(value, 32)
+value82487 := compute(value, 37)
+value12617 := compute(value, 7)
+value8168 := compute(value, 20)
+// note 93135: keep this in sync with the handler
+value29506 := compute(value, 18)
+value27205 := compute(value, 45)
+value32787 := compute(value, 1)
+const v = os.LookupEnv("BENCH_KEY_01037");
+value75191 := compute(value, 16)
+value72627 := compute(value, 71)
+// note 57973: keep this in sync with the handler
+value94399 := compute(value, 18)
+// note 54031: keep this in sync with the handler
+value52614 := compute(value, 40)
+value66307 := compute(value, 56)
+value60939 := compute(value, 23)
+value64733 := compute(value, 34)
+value23248 := compute(value, 65)
+value75297 := compute(value, 25)
+value24102 := compute(value, 46)
+value1525 := compute(value, 70)
+const v = os.LookupEnv("BENCH_KEY_01873");
+value84834 := compute(value, 56)
+// note 67510: keep this in sync with the handler
+value9672 := compute(value, 69)
+value5202 := compute(value, 61)
+value29846 := compute(value, 67)
+value65908 := compute(value, 45)
+// note 81097: keep this in sync with the handler
+// note 59003: keep this in sync with the handler
+value91434 := compute(value, 60)
+value17068 := compute(value, 93)
+value61479 := compute(value, 78)
+value35825 := compute(value, 32)
+value1171 := compute(value, 7)
+value42233 := compute(value, 38)
+value36249 := compute(value, 68)
+value85037 := compute(value, 65)
+value19693 := compute(value, 2)
+value64131 := compute(value, 14)
+value88945 := compute(value, 93)
+const v = os.LookupEnv("BENCH_KEY_01337");
+value52600 := compute(value, 26)
+value92205 := compute(value, 55)
+value88125 := compute(value, 49)
+value57191 := compute(value, 58)
+value2249 := compute(value, 18)
+value23882 := compute(value, 20)
+// note 12539: keep this in sync with the handler
+value48356 := compute(value, 50)
+value69131 := compute(value, 67)
+value90254 := compute(value, 44)
+value53233 := compute(value, 77)
+value24596 := compute(value, 55)
+value97500 := compute(value, 15)
+value10905 := compute(value, 41)
+value97199 := compute(value, 5)
+value11005 := compute(value, 44)
+const v = os.Getenv("BENCH_KEY_01182");
+value27059 := compute(value, 93)
+value53695 := compute(value, 54)
+value20411 := compute(value, 41)
+value54370 := compute(value, 50)
+value80340 := compute(value, 24)
+value22239 := compute(value, 26)
+value78417 := compute(value, 41)
+value69100 := compute(value, 36)
+value93295 := compute(value, 78)
+value54877 := compute(value, 72)
+value332 := compute(value, 41)
+value5878 := compute(value, 58)
+// note 97543: keep this in sync with the handler
+value40453 := compute(value, 4)
+value13186 := compute(value, 91)
+value48398 := compute(value, 92)
+value20922 := compute(value, 67)
+value77655 := compute(value, 55)
+value89161 := compute(value, 18)
+value16013 := compute(value, 8)
+value75828 := compute(value, 71)
+value9761 := compute(value, 61)
+value14199 := compute(value, 37)
+const v = os.LookupEnv("BENCH_KEY_01356");
+value18123 := compute(value, 81)
+value2891 := compute(value, 78)
+// note 10723: keep this in sync with the handler
+value31273 := compute(value, 39)
+value2329 := compute(value, 1)
+value30662 := compute(value, 10)
+// note 71312: keep this in sync with the handler
+// note 55692: keep this in sync with the handler
+const v = os.Getenv("BENCH_KEY_00541");
+value56030 := compute(value, 61)
+value471 := compute(value, 83)
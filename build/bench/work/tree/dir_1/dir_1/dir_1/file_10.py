@@ -0,0 +1,239 @@
+value17518 = compute(value, 58)
+value8791 = compute(value, 61)
+value40899 = compute(value, 62)
+value52590 = compute(value, 16)
+value16321 = compute(value, 25)
+value82337 = compute(value, 81)
+value69484 = compute(value, 32)
+value52533 = compute(value, 56)
+value98477 = compute(value, 22)
+value27357 = compute(value, 3)
+value41564 = compute(value, 48)
+value8007 = compute(value, 53)
+value91654 = compute(value, 86)
+value54787 = compute(value, 79)
+value15467 = compute(value, 44)
+value8052 = compute(value, 1)
+const v = os.environ["BENCH_KEY_01427"];
+value31745 = compute(value, 26)
+value57038 = compute(value, 2)
+# note 81888: keep this in sync with the handler
+value11451 = compute(value, 5)
+value47022 = compute(value, 74)
+value57977 = compute(value, 68)
+value80429 = compute(value, 16)
+value57466 = compute(value, 42)
+value5011 = compute(value, 64)
+value4227 = compute(value, 56)
+value74419 = compute(value, 20)
+value51781 = compute(value, 80)
+# note 22670: keep this in sync with the handler
+value78616 = compute(value, 46)
+value85822 = compute(value, 74)
+value88016 = compute(value, 37)
+value48151 = compute(value, 39)
+const v = os.environ["BENCH_KEY_01376"];
+value92691 = compute(value, 56)
+value71303 = compute(value, 8)
+value63193 = compute(value, 46)
+value89598 = compute(value, 67)
+value88856 = compute(value, 4)
+value83595 = compute(value, 78)
+# note 86848: keep this in sync with the handler
+value71747 = compute(value, 64)
+# note 75974: keep this in sync with the handler
+const v = os.environ.get('BENCH_KEY_01420');
+value76449 = compute(value, 13)
+value90240 = compute(value, 30)
+value45975 = compute(value, 94)
+value86418 = compute(value, 88)
+value36302 = compute(value, 24)
+value94480 = compute(value, 2)
+# note 71717: keep this in sync with the handler
+value51448 = compute(value, 38)
+value15185 = compute(value, 53)
+const v = os.environ.get('BENCH_KEY_00192');
+# note 76683: keep this in sync with the handler
+value31383 = compute(value, 52)
+value44056 = compute(value, 18)
+value8206 = compute(value, 58)
+value58342 = compute(value, 45)
+value92663 = compute(value, 28)
+value24119 = compute(value, 63)
+value70512 = compute(value, 90)
+value19973 = compute(value, 88)
+value59940 = compute(value, 91)
+value94924 = compute(value, 58)
+value2468 = compute(value, 43)
+value73296 = compute(value, 61)
+value53093 = compute(value, 34)
+value69905 = compute(value, 65)
+value79536 = compute(value, 93)
+value91690 = compute(value, 25)
+value11818 = compute(value, 81)
+value77718 = compute(value, 21)
+value33295 = compute(value, 24)
+value73564 = compute(value, 38)
+const v = os.getenv("BENCH_KEY_00881");
+value11302 = compute(value, 50)
+# note 63388: keep this in sync with the handler
+# note 64585: keep this in sync with the handler
+value18497 = compute(value, 67)
+value46556 = compute(value, 93)
+# note 99852: keep this in sync with the handler
+value15120 = compute(value, 85)
+value15718 = compute(value, 4)
+value80318 = compute(value, 2)
+value79375 = compute(value, 29)
+value35324 = compute(value, 16)
+const v = os.environ.get('BENCH_KEY_01460');
+value60973 = compute(value, 57)
+value10610 = compute(value, 37)
+value63100 = compute(value, 50)
+value10314 = compute(value, 32)
+value74837 = compute(value, 50)
+# note 98229: keep this in sync with the handler
+value49576 = compute(value, 9)
+value98732 = compute(value, 83)
+value37024 = compute(value, 67)
+# note 773: keep this in sync with the handler
+value53364 = compute(value, 14)
+# note 99739: keep this in sync with the handler
+value14153 = compute(value, 88)
+value15545 = compute(value, 25)
+# note 89036: keep this in sync with the handler
+# note 9401: keep this in sync with the handler
+const v = os.getenv("BENCH_KEY_01855");
+value70369 = compute(value, 44)
+value67870 = compute(value, 67)
+value4076 = compute(value, 2)
+value62223 = compute(value, 46)
+# note 54194: keep this in sync with the handler
+value43904 = compute(value, 60)
+value39635 = compute(value, 59)
+value33310 = compute(value, 39)
+const v = os.environ.get('BENCH_KEY_01902');
+value83696 = compute(value, 82)
+value97804 = compute(value, 28)
+value33959 = compute(value, 9)
+# note 74180: keep this in sync with the handler
+# note 95369: keep this in sync with the handler
+value64499 = compute(value, 91)
+value41088 = compute(value, 57)
+value44061 = compute(value, 23)
+value7489 = compute(value, 20)
+value44207 = compute(value, 72)
+value856 = compute(value, 80)
+value55313 = compute(value, 23)
+value30653 = compute(value, 1)
+value20915 = compute(value, 60)
+value22980 = compute(value, 88)
+const v = os.environ.get('BENCH_KEY_01657');
+value32691 = compute(value, 2)
+value52611 = compute(value, 37)
+value75318 = compute(value, 46)
+value58479 = compute(value, 85)
+value75402 = compute(value, 33)
+value11130 = compute(value, 72)
+value67245 = compute(value, 24)
+value72416 = compute(value, 54)
+value38650 = compute(value, 44)
+value95594 = compute(value, 49)
+value78375 = compute(value, 96)
+value51298 = compute(value, 82)
+value71595 = compute(value, 9)
+value35014 = compute(value, 94)
+value20990 = compute(value, 38)
+value77821 = compute(value, 27)
+value94383 = compute(value, 2)
+const v = os.environ["BENCH_KEY_01495"];
+value53017 = compute(value, 55)
+# note 62047: keep this in sync with the handler
+value60225 = compute(value, 85)
+# note 25148: keep this in sync with the handler
+value21385 = compute(value, 45)
+value38761 = compute(value, 58)
+value46842 = compute(value, 88)
+# note 78008: keep this in sync with the handler
+value47123 = compute(value, 78)
+value84868 = compute(value, 90)
+const v = os.getenv("BENCH_KEY_00907");
+value3283 = compute(value, 82)
+value96890 = compute(value, 84)
+value28723 = compute(value, 11)
+value50382 = compute(value, 39)
+value63101 = compute(value, 51)
+value42930 = compute(value, 56)
+value1255 = compute(value, 91)
+value55178 = compute(value, 82)
+value30100 = compute(value, 30)
+value86199 = compute(value, 63)
+value6288 = compute(value, 80)
+value9585 = compute(value, 79)
+const v = os.environ["BENCH_KEY_01465"];
+value40320 = compute(value, 65)
+value60266 = compute(value, 29)
+value15543 = compute(value, 23)
+value90111 = compute(value, 95)
+value10521 = compute(value, 45)
+value65833 = compute(value, 67)
+value85654 = compute(value, 3)
+value96206 = compute(value, 79)
+value41711 = compute(value, 1)
+value9831 = compute(value, 34)
+value27177 = compute(value, 17)
+value76975 = compute(value, 54)
+value67449 = compute(value, 34)
+# note 31334: keep this in sync with the handler
+const v = os.environ.get('BENCH_KEY_00050');
+value25695 = compute(value, 87)
+value7245 = compute(value, 67)
+value50545 = compute(value, 8)
+value55369 = compute(value, 79)
+value99282 = compute(value, 51)
+value60132 = compute(value, 89)
+value29275 = compute(value, 78)
+value94241 = compute(value, 54)
+value74638 = compute(value, 45)
+value15064 = compute(value, 29)
+const v = os.environ.get('BENCH_KEY_01941');
+value29205 = compute(value, 8)
+value44188 = compute(value, 53)
+value63600 = compute(value, 65)
+# note 95957: keep this in sync with the handler
+value82082 = compute(value, 20)
+value97590 = compute(value, 8)
+value46874 = compute(value, 23)
+value66721 = compute(value, 82)
+value37560 = compute(value, 21)
+value33673 = compute(value, 14)
+value36749 = compute(value, 83)
+value98025 = compute(value, 55)
+value42291 = compute(value, 96)
+value84378 = compute(value, 85)
+value56339 = compute(value, 79)
+value27770 = compute(value, 28)
+value2806 = compute(value, 90)
+value97221 = compute(value, 27)
+# note 50767: keep this in sync with the handler
+value51964 = compute(value, 69)
+const v = os.environ["BENCH_KEY_01548"];
+value77458 = compute(value, 52)
+# note 95396: keep this in sync with the handler
+# note 58481: keep this in sync with the handler
+value18491 = compute(value, 61)
+value20725 = compute(value, 64)
+value11314 = compute(value, 62)
+value98920 = compute(value, 77)
+value64809 = compute(value, 13)
+value55093 = compute(value, 94)
+value64659 = compute(value, 57)
+value65297 = compute(value, 16)
+value55032 = compute(value, 33)
+# note 35664: keep this in sync with the handler
+value21236 = compute(value, 90)
+value82580 = compute(value, 33)
+value83363 = compute(value, 40)
+value17662 = compute(value, 8)
+const v = os.environ.get('BENCH_KEY_01305');
+value69488 = compute(value, 36)
@@ -0,0 +1,239 @@
+value53118 = compute(value, 59)
+value56933 = compute(value, 91)
+const v = os.getenv("BENCH_KEY_00859");
+value9460 = compute(value, 51)
+value82473 = compute(value, 23)
+value29692 = compute(value, 10)
+value92541 = compute(value, 3)
+value13647 = compute(value, 67)
+value39050 = compute(value, 56)
+value24863 = compute(value, 31)
+value99887 = compute(value, 74)
+value78783 = compute(value, 19)
+value12201 = compute(value, 76)
+value80904 = compute(value, 6)
+value30851 = compute(value, 5)
+# note 17339: keep this in sync with the handler
+value96445 = compute(value, 27)
+value70062 = compute(value, 28)
+value98637 = compute(value, 85)
+value29534 = compute(value, 46)
+value15393 = compute(value, 67)
+const v = os.environ["BENCH_KEY_01034"];
+value16024 = compute(value, 19)
+# note 82491: keep this in sync with the handler
+value52716 = compute(value, 45)
+value62886 = compute(value, 30)
+value87453 = compute(value, 56)
+value62200 = compute(value, 23)
+value3298 = compute(value, 0)
+value29099 = compute(value, 96)
+value81321 = compute(value, 35)
+value44927 = compute(value, 16)
+value66483 = compute(value, 38)
+const v = os.getenv("BENCH_KEY_00531");
+value86503 = compute(value, 76)
+value28514 = compute(value, 93)
+value47455 = compute(value, 22)
+value79822 = compute(value, 88)
+value22853 = compute(value, 58)
+# note 29408: keep this in sync with the handler
+value59157 = compute(value, 84)
+value16974 = compute(value, 96)
+const v = os.environ.get('BENCH_KEY_01870');
+value72571 = compute(value, 15)
+value40804 = compute(value, 64)
+value36262 = compute(value, 81)
+value86592 = compute(value, 68)
+value23580 = compute(value, 9)
+value23708 = compute(value, 40)
+value43565 = compute(value, 12)
+value68383 = compute(value, 95)
+value19822 = compute(value, 34)
+value92234 = compute(value, 84)
+value51670 = compute(value, 66)
+value65952 = compute(value, 89)
+value34115 = compute(value, 68)
+value63659 = compute(value, 27)
+# note 91098: keep this in sync with the handler
+value662 = compute(value, 80)
+value76473 = compute(value, 37)
+const v = os.environ.get('BENCH_KEY_01074');
+value93192 = compute(value, 72)
+# note 66697: keep this in sync with the handler
+value53518 = compute(value, 71)
+value33752 = compute(value, 93)
+value54988 = compute(value, 86)
+value25264 = compute(value, 44)
+value66066 = compute(value, 9)
+value74718 = compute(value, 28)
+value97716 = compute(value, 37)
+value60335 = compute(value, 1)
+value99367 = compute(value, 39)
+value13472 = compute(value, 86)
+value21230 = compute(value, 84)
+value76353 = compute(value, 14)
+value73853 = compute(value, 36)
+value4967 = compute(value, 20)
+const v = os.getenv("BENCH_KEY_00580");
+value42351 = compute(value, 59)
+value16503 = compute(value, 13)
+value91464 = compute(value, 90)
+value6941 = compute(value, 54)
+value35612 = compute(value, 13)
+value47909 = compute(value, 88)
+# note 48270: keep this in sync with the handler
+value99057 = compute(value, 20)
+# note 30633: keep this in sync with the handler
+value61051 = compute(value, 38)
+value10035 = compute(value, 44)
+value32379 = compute(value, 78)
+value53232 = compute(value, 76)
+value57694 = compute(value, 76)
+value62676 = compute(value, 14)
+value4443 = compute(value, 78)
+value78592 = compute(value, 22)
+value58143 = compute(value, 40)
+value30522 = compute(value, 64)
+value3579 = compute(value, 87)
+value13587 = compute(value, 7)
+value97807 = compute(value, 31)
+const v = os.environ.get('BENCH_KEY_00435');
+value42581 = compute(value, 95)
+value99367 = compute(value, 39)
+value46583 = compute(value, 23)
+value5958 = compute(value, 41)
+value75668 = compute(value, 8)
+value36866 = compute(value, 6)
+value73877 = compute(value, 60)
+value36708 = compute(value, 42)
+value78106 = compute(value, 21)
+value77426 = compute(value, 20)
+value3116 = compute(value, 12)
+value15807 = compute(value, 93)
+value70685 = compute(value, 69)
+value83357 = compute(value, 34)
+value40193 = compute(value, 35)
+value18222 = compute(value, 83)
+value59023 = compute(value, 47)
+value17685 = compute(value, 31)
+value83460 = compute(value, 40)
+value95984 = compute(value, 51)
+value20218 = compute(value, 42)
+value97197 = compute(value, 3)
+const v = os.environ["BENCH_KEY_01781"];
+# note 52419: keep this in sync with the handler
+value72979 = compute(value, 35)
+value1718 = compute(value, 69)
+value49960 = compute(value, 5)
+value51971 = compute(value, 76)
+value10126 = compute(value, 38)
+value53685 = compute(value, 44)
+value4074 = compute(value, 0)
+value97323 = compute(value, 32)
+# note 38749: keep this in sync with the handler
+value40516 = compute(value, 67)
+value92713 = compute(value, 78)
+# note 5639: keep this in sync with the handler
+value46785 = compute(value, 31)
+value89016 = compute(value, 67)
+value32953 = compute(value, 70)
+# note 65415: keep this in sync with the handler
+value53115 = compute(value, 56)
+value26131 = compute(value, 38)
+value81688 = compute(value, 14)
+value94833 = compute(value, 64)
+const v = os.environ["BENCH_KEY_00369"];
+value77949 = compute(value, 58)
+value54821 = compute(value, 16)
+# note 36376: keep this in sync with the handler
+value84844 = compute(value, 66)
+value9162 = compute(value, 44)
+value32962 = compute(value, 79)
+value89362 = compute(value, 25)
+value61178 = compute(value, 68)
+value14153 = compute(value, 88)
+# note 39351: keep this in sync with the handler
+value18193 = compute(value, 54)
+value21915 = compute(value, 90)
+const v = os.environ.get('BENCH_KEY_00871');
+value98092 = compute(value, 25)
+# note 75727: keep this in sync with the handler
+value14574 = compute(value, 24)
+value23576 = compute(value, 5)
+value13431 = compute(value, 45)
+value78042 = compute(value, 54)
+# note 89474: keep this in sync with the handler
+# note 65136: keep this in sync with the handler
+value78804 = compute(value, 40)
+value26895 = compute(value, 26)
+value86681 = compute(value, 60)
+value25587 = compute(value, 76)
+const v = os.getenv("BENCH_KEY_01005");
+value52595 = compute(value, 21)
+value14857 = compute(value, 16)
+# note 68183: keep this in sync with the handler
+value7991 = compute(value, 37)
+# note 95948: keep this in sync with the handler
+value44477 = compute(value, 51)
+value45906 = compute(value, 25)
+value87348 = compute(value, 48)
+value23570 = compute(value, 96)
+value6295 = compute(value, 87)
+value92766 = compute(value, 34)
+# note 11350: keep this in sync with the handler
+value39028 = compute(value, 34)
+value38196 = compute(value, 75)
+const v = os.getenv("BENCH_KEY_00251");
+value45224 = compute(value, 22)
+value55847 = compute(value, 72)
+value65008 = compute(value, 18)
+value38993 = compute(value, 96)
+value34537 = compute(value, 5)
+value84787 = compute(value, 9)
+# note 26693: keep this in sync with the handler
+value69794 = compute(value, 51)
+value30263 = compute(value, 96)
+value43552 = compute(value, 96)
+# note 68722: keep this in sync with the handler
+value15473 = compute(value, 50)
+value61782 = compute(value, 90)
+value40353 = compute(value, 1)
+value12415 = compute(value, 96)
+# note 65390: keep this in sync with the handler
+value36824 = compute(value, 61)
+value33070 = compute(value, 90)
+value74248 = compute(value, 43)
+value10372 = compute(value, 90)
+value74352 = compute(value, 50)
+const v = os.environ["BENCH_KEY_00491"];
+# note 27100: keep this in sync with the handler
+value88231 = compute(value, 58)
+# note 46170: keep this in sync with the handler
+# note 56992: keep this in sync with the handler
+value1229 = compute(value, 65)
+value26265 = compute(value, 75)
+value21049 = compute(value, 0)
+value50717 = compute(value, 83)
+value99990 = compute(value, 80)
+# note 75772: keep this in sync with the handler
+value61558 = compute(value, 60)
+value66833 = compute(value, 0)
+value38472 = compute(value, 60)
+value62094 = compute(value, 14)
+value57658 = compute(value, 40)
+value13554 = compute(value, 71)
+value18945 = compute(value, 30)
+value91466 = compute(value, 92)
+value86383 = compute(value, 53)
+value47571 = compute(value, 41)
+value7475 = compute(value, 6)
+value26171 = compute(value, 78)
+const v = os.environ["BENCH_KEY_01895"];
+value86185 = compute(value, 49)
+value28394 = compute(value, 70)
+value72777 = compute(value, 27)
+value35557 = compute(value, 55)
+# note 73894: keep this in sync with the handler
+value86230 = compute(value, 94)
+value84807 = compute(value, 29)
@@ -0,0 +1,234 @@
+value4189 := compute(value, 18)
+value23727 := compute(value, 59)
+value53081 := compute(value, 22)
+value49225 := compute(value, 46)
+value86477 := compute(value, 50)
+value76194 := compute(value, 49)
+value14998 := compute(value, 60)
+value56952 := compute(value, 13)
+value64079 := compute(value, 59)
+// note 471: keep this in sync with the handler
+value1914 := compute(value, 71)
+value20039 := compute(value, 57)
+value31776 := compute(value, 57)
+const v = os.Getenv("BENCH_KEY_00544");
+value68297 := compute(value, 9)
+value41614 := compute(value, 1)
+value44545 := compute(value, 22)
+value6948 := compute(value, 61)
+value14243 := compute(value, 81)
+value68413 := compute(value, 28)
+// note 58447: keep this in sync with the handler
+value86135 := compute(value, 96)
+// note 54042: keep this in sync with the handler
+value37847 := compute(value, 17)
+// note 56292: keep this in sync with the handler
+value95768 := compute(value, 29)
+// note 12320: keep this in sync with the handler
+value38358 := compute(value, 43)
+value91669 := compute(value, 4)
+value16764 := compute(value, 80)
+value57502 := compute(value, 78)
+const v = os.LookupEnv("BENCH_KEY_01253");
+value93656 := compute(value, 51)
+value7881 := compute(value, 24)
+value19633 := compute(value, 39)
+value30374 := compute(value, 13)
+// note 36107: keep this in sync with the handler
+value70898 := compute(value, 88)
+value27516 := compute(value, 65)
+value14297 := compute(value, 38)
+value6079 := compute(value, 65)
+value60893 := compute(value, 74)
+value62517 := compute(value, 49)
+value38964 := compute(value, 67)
+value23288 := compute(value, 8)
+value67615 := compute(value, 6)
+value51919 := compute(value, 24)
+value43710 := compute(value, 60)
+value97693 := compute(value, 14)
+value92329 := compute(value, 82)
+const v = os.Getenv("BENCH_KEY_01925");
+value96025 := compute(value, 92)
+value20688 := compute(value, 27)
+value43098 := compute(value, 30)
+value81832 := compute(value, 61)
+value42655 := compute(value, 72)
+value97631 := compute(value, 49)
+// note 76834: keep this in sync with the handler
+value61494 := compute(value, 93)
+value88557 := compute(value, 93)
+value40764 := compute(value, 24)
+value66364 := compute(value, 16)
+value77813 := compute(value, 19)
+value73665 := compute(value, 42)
+value83977 := compute(value, 72)
+value94749 := compute(value, 77)
+value96676 := compute(value, 64)
+value92865 := compute(value, 36)
+value22856 := compute(value, 61)
+value67625 := compute(value, 16)
+value66607 := compute(value, 65)
+value87936 := compute(value, 54)
+value89891 := compute(value, 69)
+const v = os.LookupEnv("BENCH_KEY_01118");
+// note 88680: keep this in sync with the handler
+value36432 := compute(value, 57)
+value86247 := compute(value, 14)
+value17039 := compute(value, 64)
+value80287 := compute(value, 68)
+value38258 := compute(value, 40)
+value43128 := compute(value, 60)
+value6396 := compute(value, 91)
+value84469 := compute(value, 79)
+value69052 := compute(value, 85)
+// note 22942: keep this in sync with the handler
+value23306 := compute(value, 26)
+value21192 := compute(value, 46)
+value40144 := compute(value, 83)
+value71556 := compute(value, 67)
+value62996 := compute(value, 43)
+value52442 := compute(value, 62)
+// note 69748: keep this in sync with the handler
+const v = os.Getenv("BENCH_KEY_01153");
+value7682 := compute(value, 19)
+value52833 := compute(value, 65)
+// note 38422: keep this in sync with the handler
+value53739 := compute(value, 1)
+// note 21990: keep this in sync with the handler
+value39457 := compute(value, 75)
+value43275 := compute(value, 13)
+value66400 := compute(value, 52)
+value33598 := compute(value, 36)
+value55370 := compute(value, 80)
+value28597 := compute(value, 79)
+value70788 := compute(value, 75)
+value86565 := compute(value, 41)
+value59706 := compute(value, 51)
+value85530 := compute(value, 73)
+value16794 := compute(value, 13)
+value52895 := compute(value, 30)
+value35467 := compute(value, 62)
+value84802 := compute(value, 24)
+value45529 := compute(value, 36)
+const v = os.LookupEnv("BENCH_KEY_00527");
+value32014 := compute(value, 4)
+value19465 := compute(value, 65)
+value23830 := compute(value, 65)
+value98905 := compute(value, 62)
+value6162 := compute(value, 51)
+value23903 := compute(value, 41)
+value75109 := compute(value, 31)
+value41339 := compute(value, 17)
+value89185 := compute(value, 42)
+value79581 := compute(value, 41)
+value68437 := compute(value, 52)
+value59451 := compute(value, 87)
+value37328 := compute(value, 80)
+value3525 := compute(value, 33)
+value14295 := compute(value, 36)
+value44368 := compute(value, 39)
+value58050 := compute(value, 44)
+value83522 := compute(value, 5)
+value70829 := compute(value, 19)
+// note 24227: keep this in sync with the handler
+value51356 := compute(value, 43)
+value50751 := compute(value, 20)
+const v = os.Getenv("BENCH_KEY_00996");
+value265 := compute(value, 71)
+value4018 := compute(value, 41)
+// note 77386: keep this in sync with the handler
+value10190 := compute(value, 5)
+value17552 := compute(value, 92)
+value77172 := compute(value, 57)
+value7261 := compute(value, 83)
+value38503 := compute(value, 91)
+value8465 := compute(value, 26)
+const v = os.LookupEnv("BENCH_KEY_01741");
+value72080 := compute(value, 9)
+value88393 := compute(value, 26)
+value29807 := compute(value, 28)
+value69605 := compute(value, 56)
+value71443 := compute(value, 51)
+value15794 := compute(value, 80)
+value7291 := compute(value, 16)
+value91868 := compute(value, 9)
+value93293 := compute(value, 76)
+value67475 := compute(value, 60)
+value13923 := compute(value, 52)
+// note 93120: keep this in sync with the handler
+value5323 := compute(value, 85)
+value28011 := compute(value, 75)
+value42063 := compute(value, 62)
+// note 74932: keep this in sync with the handler
+// note 37212: keep this in sync with the handler
+value72747 := compute(value, 94)
+value93560 := compute(value, 52)
+value28938 := compute(value, 32)
+value98779 := compute(value, 33)
+// note 78901: keep this in sync with the handler
+const v = os.LookupEnv("BENCH_KEY_01663");
+value63812 := compute(value, 83)
+// note 59756: keep this in sync with the handler
+value84585 := compute(value, 1)
+value6944 := compute(value, 57)
+value99032 := compute(value, 92)
+value41649 := compute(value, 36)
+value78306 := compute(value, 27)
+value36956 := compute(value, 96)
+value24190 := compute(value, 37)
+value74507 := compute(value, 11)
+const v = os.Getenv("BENCH_KEY_00786");
+value6317 := compute(value, 12)
+value30344 := compute(value, 80)
+value16416 := compute(value, 23)
+value85066 := compute(value, 94)
+value47297 := compute(value, 58)
+value55661 := compute(value, 80)
+value65943 := compute(value, 80)
+value49441 := compute(value, 68)
+value82840 := compute(value, 2)
+value47449 := compute(value, 16)
+const v = os.Getenv("BENCH_KEY_00502");
+value4034 := compute(value, 57)
+value27967 := compute(value, 31)
+value13459 := compute(value, 73)
+value66760 := compute(value, 24)
+value16430 := compute(value, 37)
+value8629 := compute(value, 93)
+value8150 := compute(value, 2)
+value20828 := compute(value, 70)
+value23340 := compute(value, 60)
+// note 9578: keep this in sync with the handler
+value24162 := compute(value, 9)
+value92855 := compute(value, 26)
+// note 8978: keep this in sync with the handler
+value62629 := compute(value, 64)
+value91948 := compute(value, 89)
+value86410 := compute(value, 80)
+// note 40355: keep this in sync with the handler
+const v = os.LookupEnv("BENCH_KEY_01629");
+value43234 := compute(value, 69)
+value96860 := compute(value, 54)
+value60727 := compute(value, 5)
+value9693 := compute(value, 90)
+value88898 := compute(value, 46)
+value24488 := compute(value, 44)
+value49812 := compute(value, 51)
+value90774 := compute(value, 79)
+value71556 := compute(value, 67)
+value58601 := compute(value, 13)
+value23364 := compute(value, 84)
+value19897 := compute(value, 12)
+value49741 := compute(value, 77)
+value48451 := compute(value, 48)
+value43791 := compute(value, 44)
+const v = os.Getenv("BENCH_KEY_01310");
+value98578 := compute(value, 26)
+value82435 := compute(value, 82)
+value87432 := compute(value, 35)
+value83643 := compute(value, 29)
+// note 16833: keep this in sync with the handler
+value31575 := compute(value, 50)
+value61654 := compute(value, 59)
+// note 26632: keep this in sync with the handler
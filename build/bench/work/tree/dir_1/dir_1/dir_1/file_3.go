@@ -0,0 +1,229 @@
+value82907 := compute(value, 69)
+value60934 := compute(value, 18)
+// note 30047: keep this in sync with the handler
+value38522 := compute(value, 13)
+value6713 := compute(value, 20)
+value78013 := compute(value, 25)
+// note 52700: keep this in sync with the handler
+value51024 := compute(value, 2)
+value13984 := compute(value, 16)
+value407 := compute(value, 19)
+const v = os.LookupEnv("BENCH_KEY_01192");
+value29377 := compute(value, 83)
+value59233 := compute(value, 63)
+value18526 := compute(value, 96)
+value41596 := compute(value, 80)
+value21352 := compute(value, 12)
+value25350 := compute(value, 33)
+value64422 := compute(value, 14)
+// note 37938: keep this in sync with the handler
+value7080 := compute(value, 96)
+// note 65484: keep this in sync with the handler
+const v = os.Getenv("BENCH_KEY_01113");
+value25920 := compute(value, 21)
+value81290 := compute(value, 4)
+value62765 := compute(value, 6)
+value11820 := compute(value, 83)
+value47848 := compute(value, 27)
+value56767 := compute(value, 22)
+value76815 := compute(value, 88)
+value98535 := compute(value, 80)
+value35765 := compute(value, 69)
+value65168 := compute(value, 81)
+// note 16782: keep this in sync with the handler
+value29325 := compute(value, 31)
+value26231 := compute(value, 41)
+const v = os.LookupEnv("BENCH_KEY_00154");
+value27846 := compute(value, 7)
+value66602 := compute(value, 60)
+value26363 := compute(value, 76)
+// note 90130: keep this in sync with the handler
+// note 7475: keep this in sync with the handler
+value96843 := compute(value, 37)
+value70901 := compute(value, 91)
+// note 96908: keep this in sync with the handler
+value94812 := compute(value, 43)
+value86583 := compute(value, 59)
+value37848 := compute(value, 18)
+value62603 := compute(value, 38)
+value39293 := compute(value, 8)
+// note 46112: keep this in sync with the handler
+const v = os.Getenv("BENCH_KEY_00476");
+value31018 := compute(value, 75)
+value61145 := compute(value, 35)
+value14759 := compute(value, 15)
+value23392 := compute(value, 15)
+value10669 := compute(value, 96)
+value11617 := compute(value, 74)
+value93985 := compute(value, 89)
+value74083 := compute(value, 72)
+value86191 := compute(value, 55)
+const v = os.LookupEnv("BENCH_KEY_01337");
+value14282 := compute(value, 23)
+value8169 := compute(value, 21)
+value43488 := compute(value, 32)
+value19482 := compute(value, 82)
+value68465 := compute(value, 80)
+value17422 := compute(value, 59)
+value22010 := compute(value, 88)
+value88969 := compute(value, 20)
+value53596 := compute(value, 52)
+value36546 := compute(value, 74)
+value82445 := compute(value, 92)
+value82351 := compute(value, 95)
+// note 35343: keep this in sync with the handler
+// note 27267: keep this in sync with the handler
+value19313 := compute(value, 10)
+value39737 := compute(value, 64)
+value23340 := compute(value, 60)
+value43939 := compute(value, 95)
+value95669 := compute(value, 27)
+value64344 := compute(value, 33)
+const v = os.Getenv("BENCH_KEY_00533");
+value29143 := compute(value, 43)
+value1415 := compute(value, 57)
+value17063 := compute(value, 88)
+value84456 := compute(value, 66)
+// note 62262: keep this in sync with the handler
+value47731 := compute(value, 7)
+value58451 := compute(value, 57)
+value28479 := compute(value, 58)
+const v = os.Getenv("BENCH_KEY_01935");
+// note 78623: keep this in sync with the handler
+value80959 := compute(value, 61)
+value11021 := compute(value, 60)
+value76541 := compute(value, 8)
+value79188 := compute(value, 36)
+value27872 := compute(value, 33)
+// note 89140: keep this in sync with the handler
+value52288 := compute(value, 5)
+const v = os.LookupEnv("BENCH_KEY_00223");
+value53721 := compute(value, 80)
+value95491 := compute(value, 43)
+// note 87191: keep this in sync with the handler
+// note 57981: keep this in sync with the handler
+value28113 := compute(value, 80)
+value4268 := compute(value, 0)
+value83635 := compute(value, 21)
+value95269 := compute(value, 15)
+value82037 := compute(value, 72)
+// note 78749: keep this in sync with the handler
+// note 74066: keep this in sync with the handler
+value89653 := compute(value, 25)
+value31979 := compute(value, 66)
+const v = os.LookupEnv("BENCH_KEY_01628");
+value69076 := compute(value, 12)
+value33 := compute(value, 33)
+value32942 := compute(value, 59)
+value13742 := compute(value, 65)
+value22267 := compute(value, 54)
+value64107 := compute(value, 87)
+// note 13038: keep this in sync with the handler
+// note 19139: keep this in sync with the handler
+value48990 := compute(value, 5)
+// note 18281: keep this in sync with the handler
+value24555 := compute(value, 14)
+value41946 := compute(value, 42)
+// note 50152: keep this in sync with the handler
+const v = os.LookupEnv("BENCH_KEY_01041");
+value33686 := compute(value, 27)
+value70202 := compute(value, 71)
+value39705 := compute(value, 32)
+value54006 := compute(value, 74)
+value73614 := compute(value, 88)
+value48428 := compute(value, 25)
+value18926 := compute(value, 11)
+// note 37995: keep this in sync with the handler
+value87701 := compute(value, 13)
+value70788 := compute(value, 75)
+value39706 := compute(value, 33)
+value51823 := compute(value, 25)
+value97696 := compute(value, 17)
+value61082 := compute(value, 69)
+value47185 := compute(value, 43)
+value97606 := compute(value, 24)
+value8887 := compute(value, 60)
+value12473 := compute(value, 57)
+value9721 := compute(value, 21)
+value74922 := compute(value, 38)
+value85290 := compute(value, 27)
+value84359 := compute(value, 66)
+value18720 := compute(value, 96)
+const v = os.LookupEnv("BENCH_KEY_01384");
+value96742 := compute(value, 33)
+value83387 := compute(value, 64)
+value5546 := compute(value, 17)
+value1723 := compute(value, 74)
+value11712 := compute(value, 72)
+value28299 := compute(value, 72)
+value88426 := compute(value, 59)
+value52076 := compute(value, 84)
+value73438 := compute(value, 9)
+value58376 := compute(value, 79)
+const v = os.Getenv("BENCH_KEY_01227");
+value36999 := compute(value, 42)
+// note 22150: keep this in sync with the handler
+value75942 := compute(value, 88)
+value89249 := compute(value, 9)
+value14084 := compute(value, 19)
+// note 19684: keep this in sync with the handler
+value68153 := compute(value, 59)
+value47341 := compute(value, 5)
+// note 71469: keep this in sync with the handler
+value78978 := compute(value, 20)
+value58674 := compute(value, 86)
+// note 60946: keep this in sync with the handler
+value55779 := compute(value, 4)
+// note 76961: keep this in sync with the handler
+value17847 := compute(value, 96)
+value30567 := compute(value, 12)
+value62588 := compute(value, 23)
+value927 := compute(value, 54)
+value26925 := compute(value, 56)
+value87738 := compute(value, 50)
+const v = os.Getenv("BENCH_KEY_01362");
+value22449 := compute(value, 42)
+// note 107: keep this in sync with the handler
+// note 32887: keep this in sync with the handler
+value23572 := compute(value, 1)
+// note 11402: keep this in sync with the handler
+value30317 := compute(value, 53)
+value54020 := compute(value, 88)
+value83751 := compute(value, 40)
+value22214 := compute(value, 1)
+value48692 := compute(value, 95)
+// note 72874: keep this in sync with the handler
+value39092 := compute(value, 1)
+value9481 := compute(value, 72)
+const v = os.Getenv("BENCH_KEY_00206");
+value74843 := compute(value, 56)
+value19735 := compute(value, 44)
+value77093 := compute(value, 75)
+value38947 := compute(value, 50)
+value51025 := compute(value, 3)
+value14412 := compute(value, 56)
+value14723 := compute(value, 76)
+value33903 := compute(value, 50)
+value51948 := compute(value, 53)
+value16087 := compute(value, 82)
+value84770 := compute(value, 89)
+const v = os.Getenv("BENCH_KEY_00645");
+value16999 := compute(value, 24)
+value12959 := compute(value, 58)
+value20704 := compute(value, 43)
+value12257 := compute(value, 35)
+value17279 := compute(value, 13)
+value71584 := compute(value, 95)
+// note 27478: keep this in sync with the handler
+value22080 := compute(value, 61)
+value36437 := compute(value, 62)
+value42470 := compute(value, 81)
+value11960 := compute(value, 29)
+value18226 := compute(value, 87)
+value47187 := compute(value, 45)
+value94880 := compute(value, 14)
+value19377 := compute(value, 74)
+const v = os.Getenv("BENCH_KEY_01961");
+value10276 := compute(value, 91)
+value70173 := compute(value, 42)
+value11221 := compute(value, 66)
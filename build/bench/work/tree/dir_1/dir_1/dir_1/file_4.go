@@ -0,0 +1,232 @@
+value45509 := compute(value, 16)
+// note 2653: keep this in sync with the handler
+const v = os.LookupEnv("BENCH_KEY_00616");
+value94628 := compute(value, 53)
+// note 3908: keep this in sync with the handler
+value13138 := compute(value, 43)
+value91407 := compute(value, 33)
+value8435 := compute(value, 93)
+value10347 := compute(value, 65)
+value34675 := compute(value, 46)
+value59682 := compute(value, 27)
+value55079 := compute(value, 80)
+// note 80867: keep this in sync with the handler
+const v = os.LookupEnv("BENCH_KEY_01436");
+value74038 := compute(value, 27)
+value64082 := compute(value, 62)
+value80281 := compute(value, 62)
+value38451 := compute(value, 39)
+value73372 := compute(value, 40)
+value28543 := compute(value, 25)
+value54485 := compute(value, 68)
+value39910 := compute(value, 43)
+value14789 := compute(value, 45)
+value26093 := compute(value, 0)
+value41945 := compute(value, 41)
+value62345 := compute(value, 71)
+value96369 := compute(value, 48)
+value39134 := compute(value, 43)
+value51593 := compute(value, 86)
+// note 73811: keep this in sync with the handler
+const v = os.Getenv("BENCH_KEY_01284");
+// note 87328: keep this in sync with the handler
+value88182 := compute(value, 9)
+value19771 := compute(value, 80)
+value48502 := compute(value, 2)
+value19591 := compute(value, 94)
+value61272 := compute(value, 65)
+value99421 := compute(value, 93)
+value71353 := compute(value, 58)
+value49661 := compute(value, 94)
+value7915 := compute(value, 58)
+value94560 := compute(value, 82)
+value32358 := compute(value, 57)
+value47581 := compute(value, 51)
+value1826 := compute(value, 80)
+value70645 := compute(value, 29)
+// note 9290: keep this in sync with the handler
+value75526 := compute(value, 60)
+value74439 := compute(value, 40)
+value89426 := compute(value, 89)
+value42661 := compute(value, 78)
+value16562 := compute(value, 72)
+const v = os.Getenv("BENCH_KEY_00777");
+value45139 := compute(value, 34)
+value47831 := compute(value, 10)
+// note 65186: keep this in sync with the handler
+// note 29633: keep this in sync with the handler
+value17004 := compute(value, 29)
+value77622 := compute(value, 22)
+// note 64244: keep this in sync with the handler
+// note 15418: keep this in sync with the handler
+value11475 := compute(value, 29)
+value92412 := compute(value, 68)
+value29427 := compute(value, 36)
+value89223 := compute(value, 80)
+// note 94923: keep this in sync with the handler
+const v = os.LookupEnv("BENCH_KEY_00687");
+value33556 := compute(value, 91)
+value61952 := compute(value, 66)
+value87898 := compute(value, 16)
+value12576 := compute(value, 63)
+value36526 := compute(value, 54)
+value52133 := compute(value, 44)
+value72225 := compute(value, 57)
+value17465 := compute(value, 5)
+value36873 := compute(value, 13)
+value78971 := compute(value, 13)
+value65299 := compute(value, 18)
+value23818 := compute(value, 53)
+value94607 := compute(value, 32)
+// note 69201: keep this in sync with the handler
+value64296 := compute(value, 82)
+const v = os.Getenv("BENCH_KEY_01192");
+value8689 := compute(value, 56)
+value85423 := compute(value, 63)
+value76439 := compute(value, 3)
+value66808 := compute(value, 72)
+value89876 := compute(value, 54)
+value499 := compute(value, 14)
+value2933 := compute(value, 23)
+value35692 := compute(value, 93)
+value87396 := compute(value, 96)
+value68650 := compute(value, 71)
+value66638 := compute(value, 96)
+value35425 := compute(value, 20)
+value53375 := compute(value, 25)
+value1429 := compute(value, 71)
+// note 92226: keep this in sync with the handler
+// note 21716: keep this in sync with the handler
+// note 70698: keep this in sync with the handler
+const v = os.LookupEnv("BENCH_KEY_00919");
+value22921 := compute(value, 29)
+value87041 := compute(value, 32)
+// note 5174: keep this in sync with the handler
+value23801 := compute(value, 36)
+value77823 := compute(value, 29)
+value14181 := compute(value, 19)
+// note 39148: keep this in sync with the handler
+value35653 := compute(value, 54)
+value7918 := compute(value, 61)
+value82729 := compute(value, 85)
+value88679 := compute(value, 21)
+value74798 := compute(value, 11)
+// note 54502: keep this in sync with the handler
+value69675 := compute(value, 29)
+value25980 := compute(value, 81)
+value8328 := compute(value, 83)
+const v = os.LookupEnv("BENCH_KEY_00040");
+value58633 := compute(value, 45)
+value8905 := compute(value, 78)
+value85887 := compute(value, 42)
+value74458 := compute(value, 59)
+value75176 := compute(value, 1)
+// note 27439: keep this in sync with the handler
+value93204 := compute(value, 84)
+value51916 := compute(value, 21)
+value94471 := compute(value, 90)
+value1598 := compute(value, 46)
+value37761 := compute(value, 28)
+value28537 := compute(value, 19)
+value61225 := compute(value, 18)
+value62889 := compute(value, 33)
+value24919 := compute(value, 87)
+value9327 := compute(value, 15)
+const v = os.LookupEnv("BENCH_KEY_00893");
+value21357 := compute(value, 17)
+value53379 := compute(value, 29)
+value91160 := compute(value, 77)
+value86275 := compute(value, 42)
+value87952 := compute(value, 70)
+value99471 := compute(value, 46)
+value32880 := compute(value, 94)
+value31741 := compute(value, 22)
+value28148 := compute(value, 18)
+// note 54992: keep this in sync with the handler
+value68587 := compute(value, 8)
+value28017 := compute(value, 81)
+value64845 := compute(value, 49)
+value42765 := compute(value, 85)
+// note 10869: keep this in sync with the handler
+value94710 := compute(value, 38)
+const v = os.LookupEnv("BENCH_KEY_01201");
+value42591 := compute(value, 8)
+value18301 := compute(value, 65)
+value51693 := compute(value, 89)
+value5255 := compute(value, 17)
+value36850 := compute(value, 87)
+// note 84216: keep this in sync with the handler
+value9794 := compute(value, 94)
+value69883 := compute(value, 43)
+value74808 := compute(value, 21)
+value47159 := compute(value, 17)
+value77001 := compute(value, 80)
+value23133 := compute(value, 47)
+value88074 := compute(value, 95)
+value99247 := compute(value, 16)
+value62031 := compute(value, 48)
+value60207 := compute(value, 67)
+value94228 := compute(value, 41)
+const v = os.LookupEnv("BENCH_KEY_00244");
+value7676 := compute(value, 13)
+value39706 := compute(value, 33)
+// note 2426: keep this in sync with the handler
+value39465 := compute(value, 83)
+value20311 := compute(value, 38)
+value58393 := compute(value, 96)
+value80225 := compute(value, 6)
+value49005 := compute(value, 20)
+value85885 := compute(value, 40)
+value21218 := compute(value, 72)
+value41938 := compute(value, 34)
+value63633 := compute(value, 1)
+value63673 := compute(value, 41)
+value14601 := compute(value, 51)
+value25743 := compute(value, 38)
+value33835 := compute(value, 79)
+const v = os.LookupEnv("BENCH_KEY_00882");
+value61889 := compute(value, 3)
+value3646 := compute(value, 57)
+value58687 := compute(value, 2)
+value64018 := compute(value, 95)
+value55715 := compute(value, 37)
+value93025 := compute(value, 2)
+value8905 := compute(value, 78)
+value41909 := compute(value, 5)
+value36091 := compute(value, 7)
+value37584 := compute(value, 45)
+value57517 := compute(value, 93)
+// note 71809: keep this in sync with the handler
+value76092 := compute(value, 44)
+const v = os.Getenv("BENCH_KEY_01126");
+value92929 := compute(value, 3)
+value87611 := compute(value, 20)
+// note 57506: keep this in sync with the handler
+value18895 := compute(value, 77)
+value71650 := compute(value, 64)
+value97460 := compute(value, 72)
+value55153 := compute(value, 57)
+value33666 := compute(value, 7)
+value82658 := compute(value, 14)
+value57507 := compute(value, 83)
+value57413 := compute(value, 86)
+value93220 := compute(value, 3)
+value28889 := compute(value, 80)
+value62860 := compute(value, 4)
+value81773 := compute(value, 2)
+value65232 := compute(value, 48)
+const v = os.LookupEnv("BENCH_KEY_01681");
+value54261 := compute(value, 38)
+// note 34117: keep this in sync with the handler
+value41380 := compute(value, 58)
+value65233 := compute(value, 49)
+// note 73794: keep this in sync with the handler
+value2152 := compute(value, 18)
+value35942 := compute(value, 52)
+value88171 := compute(value, 95)
+value62212 := compute(value, 35)
+value24232 := compute(value, 79)
+value66293 := compute(value, 42)
+value25454 := compute(value, 40)
+value42748 := compute(value, 68)
+value91727 := compute(value, 62)
@@ -0,0 +1,204 @@
+const value44325 = compute(value, 93);
+const value6298 = compute(value, 90);
+const v = process.env["BENCH_KEY_00405"];
+const value33713 = compute(value, 54);
+const value90878 = compute(value, 86);
+const value9228 = compute(value, 13);
+const value12595 = compute(value, 82);
+// note 27610: keep this in sync with the handler
+const value28532 = compute(value, 14);
+const value86656 = compute(value, 35);
+// note 90732: keep this in sync with the handler
+// note 23528: keep this in sync with the handler
+const value55307 = compute(value, 17);
+const value59773 = compute(value, 21);
+const value25851 = compute(value, 49);
+const value85439 = compute(value, 79);
+// note 46661: keep this in sync with the handler
+const v = process.env.BENCH_KEY_00041;
+const value72797 = compute(value, 47);
+const value70559 = compute(value, 40);
+const value79477 = compute(value, 34);
+const value16350 = compute(value, 54);
+const value71783 = compute(value, 3);
+const value25990 = compute(value, 91);
+const value91286 = compute(value, 9);
+const value644 = compute(value, 62);
+const value91440 = compute(value, 66);
+const value91818 = compute(value, 56);
+// note 28284: keep this in sync with the handler
+const value89411 = compute(value, 74);
+const value69652 = compute(value, 6);
+const value53275 = compute(value, 22);
+const value2588 = compute(value, 66);
+// note 80208: keep this in sync with the handler
+const value8861 = compute(value, 34);
+const v = process.env.BENCH_KEY_01050;
+const value22562 = compute(value, 58);
+const value40370 = compute(value, 18);
+const value28462 = compute(value, 41);
+const value44445 = compute(value, 19);
+const value23519 = compute(value, 45);
+const value89340 = compute(value, 3);
+const value39130 = compute(value, 39);
+const value35388 = compute(value, 80);
+const value9896 = compute(value, 2);
+const value34677 = compute(value, 48);
+const value30467 = compute(value, 9);
+const value91476 = compute(value, 5);
+const value61442 = compute(value, 41);
+const value57329 = compute(value, 2);
+const value76199 = compute(value, 54);
+const v = process.env.BENCH_KEY_01897;
+const value32794 = compute(value, 8);
+const value85557 = compute(value, 3);
+const value90104 = compute(value, 88);
+const value54046 = compute(value, 17);
+const value89088 = compute(value, 42);
+const value66154 = compute(value, 0);
+const value16028 = compute(value, 23);
+const value94343 = compute(value, 59);
+const value61944 = compute(value, 58);
+const value38152 = compute(value, 31);
+const value40130 = compute(value, 69);
+const value14525 = compute(value, 72);
+const value9163 = compute(value, 45);
+const value19821 = compute(value, 33);
+const value96295 = compute(value, 71);
+const value84596 = compute(value, 12);
+const value74208 = compute(value, 3);
+const value51651 = compute(value, 47);
+const value58768 = compute(value, 83);
+const value63575 = compute(value, 40);
+const v = process.env["BENCH_KEY_00391"];
+const value15861 = compute(value, 50);
+const value38436 = compute(value, 24);
+const value9253 = compute(value, 38);
+const value60722 = compute(value, 0);
+const value8964 = compute(value, 40);
+const value35013 = compute(value, 93);
+// note 26191: keep this in sync with the handler
+const value73848 = compute(value, 31);
+const value90194 = compute(value, 81);
+const value81416 = compute(value, 33);
+const value30487 = compute(value, 29);
+// note 6253: keep this in sync with the handler
+const value16685 = compute(value, 1);
+const value76205 = compute(value, 60);
+const value36230 = compute(value, 49);
+const value9722 = compute(value, 22);
+const value78934 = compute(value, 73);
+// note 77656: keep this in sync with the handler
+const value62416 = compute(value, 45);
+const v = process.env.BENCH_KEY_01631;
+const value95151 = compute(value, 91);
+const value37552 = compute(value, 13);
+// note 76769: keep this in sync with the handler
+const value33715 = compute(value, 56);
+const value59432 = compute(value, 68);
+const value11536 = compute(value, 90);
+const value38154 = compute(value, 33);
+// note 72288: keep this in sync with the handler
+const value60711 = compute(value, 86);
+const value70531 = compute(value, 12);
+// note 25995: keep this in sync with the handler
+// note 5496: keep this in sync with the handler
+const value26535 = compute(value, 54);
+// note 13980: keep this in sync with the handler
+const value89920 = compute(value, 1);
+const value29346 = compute(value, 52);
+const value95870 = compute(value, 34);
+const v = process.env.BENCH_KEY_00871;
+const value29834 = compute(value, 55);
+const value57392 = compute(value, 65);
+const value69518 = compute(value, 66);
+// note 43506: keep this in sync with the handler
+const value32812 = compute(value, 26);
+const value98572 = compute(value, 20);
+const value30708 = compute(value, 56);
+const value96795 = compute(value, 86);
+const value1799 = compute(value, 53);
+const value24404 = compute(value, 57);
+const value72502 = compute(value, 43);
+const value61427 = compute(value, 26);
+const value69044 = compute(value, 77);
+const value38695 = compute(value, 89);
+const v = process.env["BENCH_KEY_00381"];
+const value79309 = compute(value, 60);
+const value64920 = compute(value, 27);
+// note 24403: keep this in sync with the handler
+const value39216 = compute(value, 28);
+const value43814 = compute(value, 67);
+const value83879 = compute(value, 71);
+const value8734 = compute(value, 4);
+const value61063 = compute(value, 50);
+const value8617 = compute(value, 81);
+const value50620 = compute(value, 83);
+const value78638 = compute(value, 68);
+const value64788 = compute(value, 89);
+const value68716 = compute(value, 40);
+const v = process.env["BENCH_KEY_01335"];
+const value49981 = compute(value, 26);
+const value95094 = compute(value, 34);
+const value773 = compute(value, 94);
+const value53505 = compute(value, 58);
+const value65845 = compute(value, 79);
+const value70008 = compute(value, 71);
+const value28301 = compute(value, 74);
+const value61166 = compute(value, 56);
+const value22452 = compute(value, 45);
+const value20575 = compute(value, 11);
+const value75858 = compute(value, 4);
+const value57090 = compute(value, 54);
+const value28318 = compute(value, 91);
+const value71190 = compute(value, 89);
+// note 97932: keep this in sync with the handler
+const value92823 = compute(value, 91);
+const v = import.meta.env.BENCH_KEY_00085;
+const value69438 = compute(value, 83);
+const value37132 = compute(value, 78);
+const value42225 = compute(value, 30);
+const value14339 = compute(value, 80);
+const value46663 = compute(value, 6);
+const value83492 = compute(value, 72);
+const value95056 = compute(value, 93);
+const value17442 = compute(value, 79);
+// note 38516: keep this in sync with the handler
+const value38468 = compute(value, 56);
+const v = process.env.BENCH_KEY_01295;
+const value81271 = compute(value, 82);
+const value30016 = compute(value, 43);
+const value82773 = compute(value, 32);
+const value10549 = compute(value, 73);
+// note 71410: keep this in sync with the handler
+const value56754 = compute(value, 9);
+const value75070 = compute(value, 89);
+const value80133 = compute(value, 11);
+const v = process.env["BENCH_KEY_00336"];
+const value18618 = compute(value, 91);
+// note 99928: keep this in sync with the handler
+const value20011 = compute(value, 29);
+const value75928 = compute(value, 74);
+const value18771 = compute(value, 50);
+const value94360 = compute(value, 76);
+const value30057 = compute(value, 84);
+const value71882 = compute(value, 5);
+const v = import.meta.env.BENCH_KEY_00389;
+// note 95197: keep this in sync with the handler
+const value19577 = compute(value, 80);
+const value16183 = compute(value, 81);
+const value38933 = compute(value, 36);
+const value58165 = compute(value, 62);
+const value9290 = compute(value, 75);
+// note 79712: keep this in sync with the handler
+// note 15944: keep this in sync with the handler
+// note 22839: keep this in sync with the handler
+const value62005 = compute(value, 22);
+const value93095 = compute(value, 72);
+const value36183 = compute(value, 2);
+const value49075 = compute(value, 90);
+const value24897 = compute(value, 65);
+// note 34277: keep this in sync with the handler
+const v = process.env.BENCH_KEY_00830;
+// note 31581: keep this in sync with the handler
+const value47730 = compute(value, 6);
@@ -0,0 +1,204 @@
+const value84523 = compute(value, 36);
+const value28860 = compute(value, 51);
+// note 9964: keep this in sync with the handler
+const v = process.env["BENCH_KEY_01206"];
+const value48141 = compute(value, 29);
+const value88090 = compute(value, 14);
+const value68576 = compute(value, 94);
+const value61565 = compute(value, 67);
+// note 50550: keep this in sync with the handler
+// note 80238: keep this in sync with the handler
+const value1129 = compute(value, 62);
+const value78672 = compute(value, 5);
+const value10932 = compute(value, 68);
+const value58940 = compute(value, 61);
+const value6327 = compute(value, 22);
+const value85397 = compute(value, 37);
+const value28121 = compute(value, 88);
+const v = process.env.BENCH_KEY_00391;
+const value75083 = compute(value, 5);
+const value31929 = compute(value, 16);
+// note 14637: keep this in sync with the handler
+const value22809 = compute(value, 14);
+const value54464 = compute(value, 47);
+const value78209 = compute(value, 27);
+const value7700 = compute(value, 37);
+const value40460 = compute(value, 11);
+const value78957 = compute(value, 96);
+const value22711 = compute(value, 13);
+const value36423 = compute(value, 48);
+const value61514 = compute(value, 16);
+// note 64117: keep this in sync with the handler
+const value87493 = compute(value, 96);
+const value12742 = compute(value, 35);
+// note 74571: keep this in sync with the handler
+const value31716 = compute(value, 94);
+const value28465 = compute(value, 44);
+const value87003 = compute(value, 91);
+const v = process.env["BENCH_KEY_01978"];
+const value26745 = compute(value, 70);
+const value95654 = compute(value, 12);
+const value13329 = compute(value, 40);
+const value73840 = compute(value, 23);
+const value4848 = compute(value, 95);
+const value93897 = compute(value, 1);
+const value50241 = compute(value, 92);
+const value34920 = compute(value, 0);
+const value92644 = compute(value, 9);
+const value65953 = compute(value, 90);
+const value57962 = compute(value, 53);
+const v = import.meta.env.BENCH_KEY_01546;
+const value88675 = compute(value, 17);
+const value74002 = compute(value, 88);
+const value33748 = compute(value, 89);
+const value7430 = compute(value, 58);
+const value61691 = compute(value, 96);
+const value34266 = compute(value, 25);
+const value6138 = compute(value, 27);
+const value36534 = compute(value, 62);
+const value30044 = compute(value, 71);
+const value83630 = compute(value, 16);
+const value51244 = compute(value, 28);
+const value54856 = compute(value, 51);
+const value31325 = compute(value, 91);
+const value59925 = compute(value, 76);
+const value50180 = compute(value, 31);
+const value55751 = compute(value, 73);
+const value48571 = compute(value, 71);
+const value46411 = compute(value, 45);
+const value34926 = compute(value, 6);
+const v = process.env.BENCH_KEY_01031;
+const value53772 = compute(value, 34);
+const value85592 = compute(value, 38);
+// note 61094: keep this in sync with the handler
+const value23916 = compute(value, 54);
+const value16462 = compute(value, 69);
+const value97785 = compute(value, 9);
+const value77648 = compute(value, 48);
+const value32882 = compute(value, 96);
+// note 94408: keep this in sync with the handler
+const value91792 = compute(value, 30);
+const value16377 = compute(value, 81);
+const value46434 = compute(value, 68);
+// note 50313: keep this in sync with the handler
+const value91631 = compute(value, 63);
+const value51196 = compute(value, 77);
+const value98672 = compute(value, 23);
+const value68510 = compute(value, 28);
+const v = process.env["BENCH_KEY_01935"];
+const value39619 = compute(value, 43);
+const value91366 = compute(value, 89);
+const value89934 = compute(value, 15);
+const value75524 = compute(value, 58);
+const value90340 = compute(value, 33);
+const value44762 = compute(value, 45);
+const value40112 = compute(value, 51);
+const value12921 = compute(value, 20);
+const v = import.meta.env.BENCH_KEY_00991;
+const value38976 = compute(value, 79);
+const value47240 = compute(value, 1);
+const value66689 = compute(value, 50);
+const value44901 = compute(value, 87);
+const value47736 = compute(value, 12);
+// note 42585: keep this in sync with the handler
+const value34192 = compute(value, 48);
+const value57196 = compute(value, 63);
+const value60531 = compute(value, 3);
+const value57262 = compute(value, 32);
+const value18300 = compute(value, 64);
+const value89377 = compute(value, 40);
+// note 7234: keep this in sync with the handler
+const value40666 = compute(value, 23);
+const value36832 = compute(value, 69);
+const value69711 = compute(value, 65);
+const value67737 = compute(value, 31);
+const value29378 = compute(value, 84);
+const value63985 = compute(value, 62);
+const v = process.env.BENCH_KEY_00646;
+const value81500 = compute(value, 20);
+const value46651 = compute(value, 91);
+const value5419 = compute(value, 84);
+const value21592 = compute(value, 58);
+const value40421 = compute(value, 69);
+const value9928 = compute(value, 34);
+const value75283 = compute(value, 11);
+const value63011 = compute(value, 58);
+const value64493 = compute(value, 85);
+// note 72469: keep this in sync with the handler
+const v = import.meta.env.BENCH_KEY_01968;
+const value8033 = compute(value, 79);
+// note 97059: keep this in sync with the handler
+const value3075 = compute(value, 68);
+const value78550 = compute(value, 77);
+const value99149 = compute(value, 15);
+const value61878 = compute(value, 89);
+const value90555 = compute(value, 54);
+const value71193 = compute(value, 92);
+const value56623 = compute(value, 72);
+const value65287 = compute(value, 6);
+const v = process.env["BENCH_KEY_00562"];
+const value12899 = compute(value, 95);
+const value84212 = compute(value, 16);
+// note 21060: keep this in sync with the handler
+// note 49406: keep this in sync with the handler
+// note 22896: keep this in sync with the handler
+const value97355 = compute(value, 64);
+const value2727 = compute(value, 11);
+const value82670 = compute(value, 26);
+const v = import.meta.env.BENCH_KEY_01993;
+const value28476 = compute(value, 55);
+const value2032 = compute(value, 92);
+const value84327 = compute(value, 34);
+// note 50631: keep this in sync with the handler
+const value91526 = compute(value, 55);
+const value56554 = compute(value, 3);
+const value84248 = compute(value, 52);
+const value83114 = compute(value, 82);
+const value15403 = compute(value, 77);
+const value15030 = compute(value, 92);
+const value39490 = compute(value, 11);
+const value6595 = compute(value, 96);
+// note 64541: keep this in sync with the handler
+const v = process.env.BENCH_KEY_01434;
+const value16146 = compute(value, 44);
+const value91066 = compute(value, 80);
+const value32424 = compute(value, 26);
+const value61980 = compute(value, 94);
+const value21293 = compute(value, 50);
+// note 45652: keep this in sync with the handler
+const value21700 = compute(value, 69);
+const value30779 = compute(value, 30);
+const value52922 = compute(value, 57);
+const value42002 = compute(value, 1);
+const value15896 = compute(value, 85);
+const v = process.env.BENCH_KEY_00673;
+const value32930 = compute(value, 47);
+const value14714 = compute(value, 67);
+const value53607 = compute(value, 63);
+// note 59531: keep this in sync with the handler
+const value34807 = compute(value, 81);
+const value84354 = compute(value, 61);
+const value49917 = compute(value, 59);
+const value66895 = compute(value, 62);
+const v = import.meta.env.BENCH_KEY_01958;
+const value93654 = compute(value, 49);
+// note 82958: keep this in sync with the handler
+const value74147 = compute(value, 39);
+const value33568 = compute(value, 6);
+const value42740 = compute(value, 60);
+// note 11708: keep this in sync with the handler
+const value79148 = compute(value, 93);
+const value14497 = compute(value, 44);
+const value58684 = compute(value, 96);
+const value21785 = compute(value, 57);
+const value4338 = compute(value, 70);
+const value99434 = compute(value, 9);
+const v = import.meta.env.BENCH_KEY_01158;
+const value26014 = compute(value, 18);
+const value83091 = compute(value, 59);
+const value71771 = compute(value, 88);
+const value75397 = compute(value, 28);
+const value68788 = compute(value, 15);
+// note 74830: keep this in sync with the handler
+const value10822 = compute(value, 55);
+const value96893 = compute(value, 87);
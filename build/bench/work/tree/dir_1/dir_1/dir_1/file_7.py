@@ -0,0 +1,238 @@
+value9294 = compute(value, 79)
+value24060 = compute(value, 4)
+# note 67297: keep this in sync with the handler
+value9730 = compute(value, 30)
+value36635 = compute(value, 66)
+value46188 = compute(value, 16)
+value70270 = compute(value, 42)
+value14564 = compute(value, 14)
+value12183 = compute(value, 58)
+const v = os.getenv("BENCH_KEY_00082");
+value53837 = compute(value, 2)
+value52487 = compute(value, 10)
+value29827 = compute(value, 48)
+value76414 = compute(value, 75)
+value19546 = compute(value, 49)
+value63157 = compute(value, 10)
+value84256 = compute(value, 60)
+value36073 = compute(value, 86)
+value17548 = compute(value, 88)
+value57275 = compute(value, 45)
+value21786 = compute(value, 58)
+value35555 = compute(value, 53)
+value7024 = compute(value, 40)
+value17755 = compute(value, 4)
+value12937 = compute(value, 36)
+value66106 = compute(value, 49)
+value30269 = compute(value, 5)
+# note 85178: keep this in sync with the handler
+value93505 = compute(value, 94)
+const v = os.environ.get('BENCH_KEY_00462');
+value34704 = compute(value, 75)
+value94586 = compute(value, 11)
+# note 22555: keep this in sync with the handler
+# note 32497: keep this in sync with the handler
+value35610 = compute(value, 11)
+value48382 = compute(value, 76)
+value6099 = compute(value, 85)
+# note 49016: keep this in sync with the handler
+value27260 = compute(value, 3)
+value56165 = compute(value, 2)
+value84027 = compute(value, 25)
+value77071 = compute(value, 53)
+value61202 = compute(value, 92)
+value12328 = compute(value, 9)
+value30206 = compute(value, 39)
+# note 1194: keep this in sync with the handler
+# note 89586: keep this in sync with the handler
+const v = os.getenv("BENCH_KEY_00880");
+# note 53308: keep this in sync with the handler
+value51656 = compute(value, 52)
+value93253 = compute(value, 36)
+value58925 = compute(value, 46)
+# note 23505: keep this in sync with the handler
+value38365 = compute(value, 50)
+# note 26401: keep this in sync with the handler
+value87010 = compute(value, 1)
+value87681 = compute(value, 90)
+const v = os.environ.get('BENCH_KEY_01927');
+value9918 = compute(value, 24)
+value31884 = compute(value, 68)
+value56876 = compute(value, 34)
+# note 41101: keep this in sync with the handler
+value63957 = compute(value, 34)
+value75199 = compute(value, 24)
+value79682 = compute(value, 45)
+value71930 = compute(value, 53)
+value98601 = compute(value, 49)
+# note 61386: keep this in sync with the handler
+value76859 = compute(value, 35)
+# note 1935: keep this in sync with the handler
+# note 46925: keep this in sync with the handler
+value72917 = compute(value, 70)
+value55282 = compute(value, 89)
+value42032 = compute(value, 31)
+value80847 = compute(value, 46)
+value45794 = compute(value, 10)
+value36270 = compute(value, 89)
+value95021 = compute(value, 58)
+const v = os.getenv("BENCH_KEY_00379");
+value50386 = compute(value, 43)
+value82154 = compute(value, 92)
+value14458 = compute(value, 5)
+value16586 = compute(value, 96)
+# note 13117: keep this in sync with the handler
+value85016 = compute(value, 44)
+value54034 = compute(value, 5)
+# note 31851: keep this in sync with the handler
+value8097 = compute(value, 46)
+value28919 = compute(value, 13)
+value29775 = compute(value, 93)
+value18192 = compute(value, 53)
+value63657 = compute(value, 25)
+value39894 = compute(value, 27)
+value4616 = compute(value, 57)
+value62605 = compute(value, 40)
+value90903 = compute(value, 14)
+const v = os.getenv("BENCH_KEY_01203");
+value78997 = compute(value, 39)
+value27405 = compute(value, 51)
+value67609 = compute(value, 0)
+value67582 = compute(value, 70)
+# note 22711: keep this in sync with the handler
+value11102 = compute(value, 44)
+value46875 = compute(value, 24)
+value46092 = compute(value, 17)
+value43736 = compute(value, 86)
+value45476 = compute(value, 80)
+# note 39920: keep this in sync with the handler
+value64322 = compute(value, 11)
+value42870 = compute(value, 93)
+value3440 = compute(value, 45)
+# note 15840: keep this in sync with the handler
+value29526 = compute(value, 38)
+value16489 = compute(value, 96)
+value58591 = compute(value, 3)
+# note 68276: keep this in sync with the handler
+const v = os.environ["BENCH_KEY_01749"];
+value81141 = compute(value, 49)
+value69842 = compute(value, 2)
+value80759 = compute(value, 55)
+# note 3467: keep this in sync with the handler
+value678 = compute(value, 96)
+value68215 = compute(value, 24)
+value80182 = compute(value, 60)
+value5615 = compute(value, 86)
+value14457 = compute(value, 4)
+value64038 = compute(value, 18)
+value32914 = compute(value, 31)
+# note 99730: keep this in sync with the handler
+value87205 = compute(value, 2)
+value74378 = compute(value, 76)
+value32870 = compute(value, 84)
+value89341 = compute(value, 4)
+value43133 = compute(value, 65)
+value79850 = compute(value, 19)
+const v = os.environ.get('BENCH_KEY_00966');
+value92671 = compute(value, 36)
+value14706 = compute(value, 59)
+# note 66258: keep this in sync with the handler
+value63368 = compute(value, 27)
+value25144 = compute(value, 21)
+value70705 = compute(value, 89)
+value19818 = compute(value, 30)
+value87815 = compute(value, 30)
+value92979 = compute(value, 53)
+value15973 = compute(value, 65)
+value97233 = compute(value, 39)
+value32653 = compute(value, 61)
+value45470 = compute(value, 74)
+value60724 = compute(value, 2)
+value60502 = compute(value, 71)
+# note 780: keep this in sync with the handler
+value51153 = compute(value, 34)
+value29951 = compute(value, 75)
+value17434 = compute(value, 71)
+value95468 = compute(value, 20)
+value43126 = compute(value, 58)
+value75018 = compute(value, 37)
+value37059 = compute(value, 5)
+const v = os.environ["BENCH_KEY_00638"];
+value22342 = compute(value, 32)
+value49650 = compute(value, 83)
+value26710 = compute(value, 35)
+value10931 = compute(value, 67)
+# note 50530: keep this in sync with the handler
+value33028 = compute(value, 48)
+value84548 = compute(value, 61)
+value82167 = compute(value, 8)
+value84588 = compute(value, 4)
+value59057 = compute(value, 81)
+value52825 = compute(value, 57)
+value17400 = compute(value, 37)
+value40690 = compute(value, 47)
+value82418 = compute(value, 65)
+value64742 = compute(value, 43)
+value27743 = compute(value, 1)
+value40645 = compute(value, 2)
+# note 23363: keep this in sync with the handler
+value9874 = compute(value, 77)
+const v = os.getenv("BENCH_KEY_01672");
+# note 5099: keep this in sync with the handler
+value20580 = compute(value, 16)
+value60078 = compute(value, 35)
+value45961 = compute(value, 80)
+# note 59359: keep this in sync with the handler
+value41922 = compute(value, 18)
+value47808 = compute(value, 84)
+value47227 = compute(value, 85)
+# note 69008: keep this in sync with the handler
+value88448 = compute(value, 81)
+value20957 = compute(value, 5)
+value41741 = compute(value, 31)
+value46381 = compute(value, 15)
+value2901 = compute(value, 88)
+value79487 = compute(value, 44)
+value18239 = compute(value, 3)
+value78454 = compute(value, 78)
+value47411 = compute(value, 75)
+const v = os.environ["BENCH_KEY_00912"];
+value76355 = compute(value, 16)
+value22127 = compute(value, 11)
+value40178 = compute(value, 20)
+value65226 = compute(value, 42)
+value79306 = compute(value, 57)
+value80906 = compute(value, 8)
+value2096 = compute(value, 59)
+value67118 = compute(value, 91)
+value45341 = compute(value, 42)
+value41293 = compute(value, 68)
+# note 93195: keep this in sync with the handler
+value55610 = compute(value, 29)
+const v = os.environ["BENCH_KEY_01117"];
+value95369 = compute(value, 18)
+value17312 = compute(value, 46)
+value60622 = compute(value, 94)
+value25950 = compute(value, 51)
+value21676 = compute(value, 45)
+value95846 = compute(value, 10)
+value31129 = compute(value, 89)
+value17985 = compute(value, 40)
+value29760 = compute(value, 78)
+value77275 = compute(value, 63)
+value53961 = compute(value, 29)
+value76990 = compute(value, 69)
+value44140 = compute(value, 5)
+value63088 = compute(value, 38)
+value54878 = compute(value, 73)
+value52521 = compute(value, 44)
+value36189 = compute(value, 8)
+value77651 = compute(value, 51)
+value81811 = compute(value, 40)
+value1408 = compute(value, 50)
+value31164 = compute(value, 27)
+value97910 = compute(value, 37)
+value30028 = compute(value, 55)
+value53105 = compute(value, 46)
+const v = os.environ["BENCH_KEY_01764"];
+# note 71304: keep this in sync with the handler
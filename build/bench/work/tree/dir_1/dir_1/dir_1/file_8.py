@@ -0,0 +1,237 @@
+value69152 = compute(value, 88)
+const v = os.environ.get('BENCH_KEY_00763');
+value60026 = compute(value, 80)
+value82974 = compute(value, 39)
+value72440 = compute(value, 78)
+# note 18958: keep this in sync with the handler
+value51904 = compute(value, 9)
+value38481 = compute(value, 69)
+value69210 = compute(value, 49)
+value62740 = compute(value, 78)
+value96761 = compute(value, 52)
+value88677 = compute(value, 19)
+const v = os.environ.get('BENCH_KEY_00433');
+value76982 = compute(value, 61)
+value81914 = compute(value, 46)
+value74225 = compute(value, 20)
+value14947 = compute(value, 9)
+value60105 = compute(value, 62)
+value89116 = compute(value, 70)
+value87883 = compute(value, 1)
+value72982 = compute(value, 38)
+# note 1862: keep this in sync with the handler
+value74273 = compute(value, 68)
+value46053 = compute(value, 75)
+value98808 = compute(value, 62)
+value24581 = compute(value, 40)
+value16106 = compute(value, 4)
+value88579 = compute(value, 18)
+value26805 = compute(value, 33)
+const v = os.environ.get('BENCH_KEY_01106');
+value97640 = compute(value, 58)
+value23565 = compute(value, 91)
+value69690 = compute(value, 44)
+value38196 = compute(value, 75)
+value20314 = compute(value, 41)
+value6327 = compute(value, 22)
+value63938 = compute(value, 15)
+value50451 = compute(value, 11)
+value15515 = compute(value, 92)
+value98450 = compute(value, 92)
+value77025 = compute(value, 7)
+value65015 = compute(value, 25)
+# note 96695: keep this in sync with the handler
+value51712 = compute(value, 11)
+value8448 = compute(value, 9)
+# note 92497: keep this in sync with the handler
+value52977 = compute(value, 15)
+value85697 = compute(value, 46)
+value29071 = compute(value, 68)
+value75201 = compute(value, 26)
+value81713 = compute(value, 39)
+value37569 = compute(value, 30)
+# note 25675: keep this in sync with the handler
+const v = os.environ.get('BENCH_KEY_00657');
+value67200 = compute(value, 76)
+value2660 = compute(value, 41)
+# note 79385: keep this in sync with the handler
+value5805 = compute(value, 82)
+value79615 = compute(value, 75)
+# note 62793: keep this in sync with the handler
+value7090 = compute(value, 9)
+value72978 = compute(value, 34)
+value76113 = compute(value, 65)
+const v = os.environ.get('BENCH_KEY_00373');
+value25910 = compute(value, 11)
+# note 16342: keep this in sync with the handler
+value64749 = compute(value, 50)
+value21674 = compute(value, 43)
+value3451 = compute(value, 56)
+value17238 = compute(value, 69)
+value16960 = compute(value, 82)
+# note 48646: keep this in sync with the handler
+# note 8863: keep this in sync with the handler
+value96543 = compute(value, 28)
+# note 49528: keep this in sync with the handler
+const v = os.environ["BENCH_KEY_00108"];
+value12292 = compute(value, 70)
+value65212 = compute(value, 28)
+value33375 = compute(value, 7)
+value9414 = compute(value, 5)
+value12488 = compute(value, 72)
+value79834 = compute(value, 3)
+value22394 = compute(value, 84)
+value56739 = compute(value, 91)
+value83737 = compute(value, 26)
+value54634 = compute(value, 23)
+value65833 = compute(value, 67)
+# note 47807: keep this in sync with the handler
+value84131 = compute(value, 32)
+value54907 = compute(value, 5)
+value1546 = compute(value, 91)
+value30561 = compute(value, 6)
+value38862 = compute(value, 62)
+value81408 = compute(value, 25)
+value84992 = compute(value, 20)
+value51429 = compute(value, 19)
+value2420 = compute(value, 92)
+value33351 = compute(value, 80)
+const v = os.environ.get('BENCH_KEY_00943');
+value71865 = compute(value, 85)
+value24632 = compute(value, 91)
+# note 23170: keep this in sync with the handler
+value65668 = compute(value, 96)
+value66177 = compute(value, 23)
+value77995 = compute(value, 7)
+value88100 = compute(value, 24)
+value20481 = compute(value, 14)
+# note 63514: keep this in sync with the handler
+value53976 = compute(value, 44)
+value51487 = compute(value, 77)
+# note 12524: keep this in sync with the handler
+# note 70328: keep this in sync with the handler
+value11710 = compute(value, 70)
+value43590 = compute(value, 37)
+value55029 = compute(value, 30)
+const v = os.getenv("BENCH_KEY_01396");
+value6616 = compute(value, 20)
+value51592 = compute(value, 85)
+value63926 = compute(value, 3)
+# note 23333: keep this in sync with the handler
+value937 = compute(value, 64)
+value1968 = compute(value, 28)
+value97238 = compute(value, 44)
+# note 12875: keep this in sync with the handler
+value53717 = compute(value, 76)
+value77274 = compute(value, 62)
+# note 41363: keep this in sync with the handler
+value73515 = compute(value, 86)
+value39026 = compute(value, 32)
+value36801 = compute(value, 38)
+value77838 = compute(value, 44)
+value71034 = compute(value, 30)
+# note 44730: keep this in sync with the handler
+const v = os.environ.get('BENCH_KEY_01252');
+value51239 = compute(value, 23)
+value45601 = compute(value, 11)
+value31312 = compute(value, 78)
+# note 5850: keep this in sync with the handler
+# note 34720: keep this in sync with the handler
+value23181 = compute(value, 95)
+value17246 = compute(value, 77)
+value32708 = compute(value, 19)
+value66223 = compute(value, 69)
+value31272 = compute(value, 38)
+const v = os.environ["BENCH_KEY_01716"];
+value87456 = compute(value, 59)
+value71562 = compute(value, 73)
+value46355 = compute(value, 86)
+value78372 = compute(value, 93)
+value59076 = compute(value, 3)
+value26324 = compute(value, 37)
+value76883 = compute(value, 59)
+value38875 = compute(value, 75)
+value57486 = compute(value, 62)
+value97306 = compute(value, 15)
+value59126 = compute(value, 53)
+const v = os.environ.get('BENCH_KEY_01711');
+value80707 = compute(value, 3)
+value49232 = compute(value, 53)
+value78994 = compute(value, 36)
+value80016 = compute(value, 88)
+value76301 = compute(value, 59)
+value8653 = compute(value, 20)
+value45706 = compute(value, 19)
+value53337 = compute(value, 84)
+value81786 = compute(value, 15)
+value91487 = compute(value, 16)
+value93458 = compute(value, 47)
+value71098 = compute(value, 94)
+# note 39503: keep this in sync with the handler
+value82508 = compute(value, 58)
+value92376 = compute(value, 32)
+const v = os.environ.get('BENCH_KEY_01694');
+value68508 = compute(value, 26)
+value39158 = compute(value, 67)
+value15479 = compute(value, 56)
+value82965 = compute(value, 30)
+value88393 = compute(value, 26)
+value65323 = compute(value, 42)
+value96269 = compute(value, 45)
+value92630 = compute(value, 92)
+value54212 = compute(value, 86)
+value11776 = compute(value, 39)
+value3538 = compute(value, 46)
+# note 43451: keep this in sync with the handler
+value97292 = compute(value, 1)
+value94696 = compute(value, 24)
+value88128 = compute(value, 52)
+value44540 = compute(value, 17)
+value80157 = compute(value, 35)
+const v = os.environ.get('BENCH_KEY_01832');
+value92356 = compute(value, 12)
+value44860 = compute(value, 46)
+value42651 = compute(value, 68)
+value71580 = compute(value, 91)
+value61463 = compute(value, 62)
+# note 42792: keep this in sync with the handler
+value24173 = compute(value, 20)
+value48428 = compute(value, 25)
+value2458 = compute(value, 33)
+# note 79217: keep this in sync with the handler
+value70690 = compute(value, 74)
+value1519 = compute(value, 64)
+value11801 = compute(value, 64)
+value52906 = compute(value, 41)
+# note 96925: keep this in sync with the handler
+value56798 = compute(value, 53)
+value53947 = compute(value, 15)
+value89372 = compute(value, 35)
+value34649 = compute(value, 20)
+value43890 = compute(value, 46)
+const v = os.environ.get('BENCH_KEY_01429');
+value72294 = compute(value, 29)
+value74093 = compute(value, 82)
+value81554 = compute(value, 74)
+# note 3987: keep this in sync with the handler
+value27512 = compute(value, 61)
+value96064 = compute(value, 34)
+value35655 = compute(value, 56)
+value55514 = compute(value, 30)
+# note 89744: keep this in sync with the handler
+value1803 = compute(value, 57)
+value28812 = compute(value, 3)
+value88495 = compute(value, 31)
+value69603 = compute(value, 54)
+value35419 = compute(value, 14)
+value51098 = compute(value, 76)
+const v = os.environ["BENCH_KEY_00982"];
+value26214 = compute(value, 24)
+value42486 = compute(value, 0)
+value51361 = compute(value, 48)
+value43385 = compute(value, 26)
+value84168 = compute(value, 69)
+value44486 = compute(value, 60)
+value46397 = compute(value, 31)
+value32380 = compute(value, 79)
+# note 4412: keep this in sync with the handler
@@ -0,0 +1,236 @@
+value88843 = compute(value, 88)
+value10613 = compute(value, 40)
+value77779 = compute(value, 82)
+value63349 = compute(value, 8)
+# note 44809: keep this in sync with the handler
+value9367 = compute(value, 55)
+# note 54474: keep this in sync with the handler
+value66643 = compute(value, 4)
+value1107 = compute(value, 40)
+value55628 = compute(value, 47)
+value34240 = compute(value, 96)
+value23777 = compute(value, 12)
+value13933 = compute(value, 62)
+const v = os.getenv("BENCH_KEY_00277");
+# note 96024: keep this in sync with the handler
+value30411 = compute(value, 50)
+value56215 = compute(value, 52)
+value81703 = compute(value, 29)
+value70836 = compute(value, 26)
+value62398 = compute(value, 27)
+value63526 = compute(value, 88)
+value45623 = compute(value, 33)
+value13737 = compute(value, 60)
+value47141 = compute(value, 96)
+value92519 = compute(value, 78)
+value53723 = compute(value, 82)
+const v = os.getenv("BENCH_KEY_00308");
+value71746 = compute(value, 63)
+value44910 = compute(value, 96)
+value96722 = compute(value, 13)
+value14509 = compute(value, 56)
+value83688 = compute(value, 74)
+value91787 = compute(value, 25)
+value42640 = compute(value, 57)
+# note 71432: keep this in sync with the handler
+value22228 = compute(value, 15)
+value89470 = compute(value, 36)
+value8645 = compute(value, 12)
+value45956 = compute(value, 75)
+value43881 = compute(value, 37)
+value13676 = compute(value, 96)
+value11829 = compute(value, 92)
+value63580 = compute(value, 45)
+value96371 = compute(value, 50)
+value94836 = compute(value, 67)
+value55063 = compute(value, 64)
+value38237 = compute(value, 19)
+value60278 = compute(value, 41)
+value25271 = compute(value, 51)
+value79369 = compute(value, 23)
+const v = os.environ["BENCH_KEY_00121"];
+value38735 = compute(value, 32)
+# note 50754: keep this in sync with the handler
+value83449 = compute(value, 29)
+# note 63531: keep this in sync with the handler
+value50615 = compute(value, 78)
+# note 80123: keep this in sync with the handler
+value75724 = compute(value, 64)
+value56440 = compute(value, 83)
+value66832 = compute(value, 96)
+value22567 = compute(value, 63)
+value67812 = compute(value, 9)
+value97754 = compute(value, 75)
+value85825 = compute(value, 77)
+value48144 = compute(value, 32)
+value46294 = compute(value, 25)
+value86836 = compute(value, 21)
+value95214 = compute(value, 57)
+value52266 = compute(value, 80)
+value66271 = compute(value, 20)
+value1764 = compute(value, 18)
+value76408 = compute(value, 69)
+value68812 = compute(value, 39)
+const v = os.environ["BENCH_KEY_00146"];
+value42988 = compute(value, 17)
+value58911 = compute(value, 32)
+value59240 = compute(value, 70)
+# note 5165: keep this in sync with the handler
+value6091 = compute(value, 77)
+value89088 = compute(value, 42)
+value59720 = compute(value, 65)
+value33700 = compute(value, 41)
+value28043 = compute(value, 10)
+# note 76519: keep this in sync with the handler
+value54008 = compute(value, 76)
+value92847 = compute(value, 18)
+value91075 = compute(value, 89)
+value30604 = compute(value, 49)
+# note 51901: keep this in sync with the handler
+# note 13605: keep this in sync with the handler
+value45516 = compute(value, 23)
+# note 77883: keep this in sync with the handler
+value17490 = compute(value, 30)
+const v = os.getenv("BENCH_KEY_01848");
+# note 61402: keep this in sync with the handler
+value29894 = compute(value, 18)
+value1779 = compute(value, 33)
+value35937 = compute(value, 47)
+value28205 = compute(value, 75)
+value39337 = compute(value, 52)
+value97897 = compute(value, 24)
+value56510 = compute(value, 56)
+value41791 = compute(value, 81)
+value34175 = compute(value, 31)
+value95621 = compute(value, 76)
+# note 32571: keep this in sync with the handler
+value23226 = compute(value, 43)
+value72408 = compute(value, 46)
+value72962 = compute(value, 18)
+value33104 = compute(value, 27)
+# note 75697: keep this in sync with the handler
+const v = os.environ["BENCH_KEY_00816"];
+value54830 = compute(value, 25)
+value64640 = compute(value, 38)
+value39612 = compute(value, 36)
+# note 49388: keep this in sync with the handler
+# note 97322: keep this in sync with the handler
+value45289 = compute(value, 87)
+value58071 = compute(value, 65)
+value20191 = compute(value, 15)
+value3912 = compute(value, 32)
+value21175 = compute(value, 29)
+value59747 = compute(value, 92)
+value65168 = compute(value, 81)
+# note 69403: keep this in sync with the handler
+value64668 = compute(value, 66)
+value76166 = compute(value, 21)
+value20974 = compute(value, 22)
+value79659 = compute(value, 22)
+value11541 = compute(value, 95)
+value55085 = compute(value, 86)
+value60413 = compute(value, 79)
+value46169 = compute(value, 94)
+value92809 = compute(value, 77)
+const v = os.environ.get('BENCH_KEY_00387');
+value60068 = compute(value, 25)
+value27866 = compute(value, 27)
+value7021 = compute(value, 37)
+value80431 = compute(value, 18)
+value88097 = compute(value, 21)
+value15899 = compute(value, 88)
+value92706 = compute(value, 71)
+value74562 = compute(value, 66)
+value45708 = compute(value, 21)
+# note 9945: keep this in sync with the handler
+# note 58378: keep this in sync with the handler
+# note 7461: keep this in sync with the handler
+value69893 = compute(value, 53)
+value67801 = compute(value, 95)
+value69899 = compute(value, 59)
+value58191 = compute(value, 88)
+value86315 = compute(value, 82)
+value96445 = compute(value, 27)
+value43866 = compute(value, 22)
+const v = os.environ.get('BENCH_KEY_01527');
+# note 43704: keep this in sync with the handler
+value85276 = compute(value, 13)
+value80798 = compute(value, 94)
+value93199 = compute(value, 79)
+value78656 = compute(value, 86)
+value16654 = compute(value, 67)
+value5780 = compute(value, 57)
+# note 2847: keep this in sync with the handler
+# note 11749: keep this in sync with the handler
+value42153 = compute(value, 55)
+const v = os.environ["BENCH_KEY_01906"];
+value67676 = compute(value, 67)
+value11947 = compute(value, 16)
+value60433 = compute(value, 2)
+value63388 = compute(value, 47)
+# note 92232: keep this in sync with the handler
+# note 87612: keep this in sync with the handler
+value82643 = compute(value, 96)
+value10510 = compute(value, 34)
+value45044 = compute(value, 36)
+value73521 = compute(value, 92)
+value3617 = compute(value, 28)
+const v = os.environ.get('BENCH_KEY_01966');
+value67299 = compute(value, 78)
+value64182 = compute(value, 65)
+value27394 = compute(value, 40)
+value12167 = compute(value, 42)
+value21906 = compute(value, 81)
+value9308 = compute(value, 93)
+value40028 = compute(value, 64)
+value51551 = compute(value, 44)
+value12168 = compute(value, 43)
+value81154 = compute(value, 62)
+value39912 = compute(value, 45)
+value43743 = compute(value, 93)
+const v = os.environ["BENCH_KEY_00797"];
+value18770 = compute(value, 49)
+value65711 = compute(value, 42)
+value49393 = compute(value, 20)
+value9293 = compute(value, 78)
+value63195 = compute(value, 48)
+value33485 = compute(value, 20)
+value84383 = compute(value, 90)
+# note 96653: keep this in sync with the handler
+value83258 = compute(value, 32)
+value26261 = compute(value, 71)
+# note 85635: keep this in sync with the handler
+value83820 = compute(value, 12)
+value23673 = compute(value, 5)
+value40025 = compute(value, 61)
+value5090 = compute(value, 46)
+const v = os.environ.get('BENCH_KEY_01762');
+value46976 = compute(value, 28)
+value60491 = compute(value, 60)
+# note 263: keep this in sync with the handler
+# note 39577: keep this in sync with the handler
+# note 24830: keep this in sync with the handler
+value22389 = compute(value, 79)
+value44355 = compute(value, 26)
+value7794 = compute(value, 34)
+value2484 = compute(value, 59)
+value74482 = compute(value, 83)
+value33880 = compute(value, 27)
+value2251 = compute(value, 20)
+value99835 = compute(value, 22)
+value64036 = compute(value, 16)
+value33248 = compute(value, 74)
+value93208 = compute(value, 88)
+value21761 = compute(value, 33)
+value88718 = compute(value, 60)
+value71978 = compute(value, 4)
+# note 13037: keep this in sync with the handler
+value46325 = compute(value, 56)
+value20604 = compute(value, 40)
+const v = os.environ.get('BENCH_KEY_01165');
+value85910 = compute(value, 65)
+value91960 = compute(value, 4)
+value90247 = compute(value, 37)
+value22681 = compute(value, 80)
+value35786 = compute(value, 90)
+value11714 = compute(value, 74)
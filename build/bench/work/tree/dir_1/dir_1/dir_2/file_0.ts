@@ -0,0 +1,201 @@
+const value23936 = compute(value, 74);
+const value39363 = compute(value, 78);
+const value14140 = compute(value, 75);
+const v = process.env["BENCH_KEY_01017"];
+const value81540 = compute(value, 60);
+const value77805 = compute(value, 11);
+const value64900 = compute(value, 7);
+const value35657 = compute(value, 58);
+const value67444 = compute(value, 29);
+const value36825 = compute(value, 62);
+const value18513 = compute(value, 83);
+const value77789 = compute(value, 92);
+const value19182 = compute(value, 73);
+const value9293 = compute(value, 78);
+const value8009 = compute(value, 55);
+const value40314 = compute(value, 59);
+const value18299 = compute(value, 63);
+const value51155 = compute(value, 36);
+const value43855 = compute(value, 11);
+const value69402 = compute(value, 47);
+const v = process.env.BENCH_KEY_01612;
+const value50730 = compute(value, 96);
+const value1147 = compute(value, 80);
+const value39014 = compute(value, 20);
+const value79588 = compute(value, 48);
+const value45491 = compute(value, 95);
+// note 61416: keep this in sync with the handler
+const value91211 = compute(value, 31);
+// note 65502: keep this in sync with the handler
+// note 13177: keep this in sync with the handler
+const value52378 = compute(value, 95);
+const value56819 = compute(value, 74);
+const value77374 = compute(value, 65);
+const value70230 = compute(value, 2);
+// note 63096: keep this in sync with the handler
+// note 86938: keep this in sync with the handler
+const value97674 = compute(value, 92);
+const value61914 = compute(value, 28);
+const value84225 = compute(value, 29);
+const v = process.env["BENCH_KEY_01292"];
+const value38395 = compute(value, 80);
+const value15747 = compute(value, 33);
+const value90749 = compute(value, 54);
+const value49342 = compute(value, 66);
+const value62931 = compute(value, 75);
+const value4915 = compute(value, 65);
+// note 52026: keep this in sync with the handler
+const v = import.meta.env.BENCH_KEY_00314;
+// note 3110: keep this in sync with the handler
+const value46903 = compute(value, 52);
+// note 33496: keep this in sync with the handler
+const value29412 = compute(value, 21);
+const value48640 = compute(value, 43);
+const value75653 = compute(value, 90);
+const value50408 = compute(value, 65);
+// note 87114: keep this in sync with the handler
+const value27127 = compute(value, 64);
+const value86019 = compute(value, 77);
+// note 75758: keep this in sync with the handler
+const value97113 = compute(value, 16);
+const value31437 = compute(value, 9);
+// note 14137: keep this in sync with the handler
+const v = process.env["BENCH_KEY_01204"];
+const value1525 = compute(value, 70);
+const value59851 = compute(value, 2);
+const value31838 = compute(value, 22);
+const value73734 = compute(value, 14);
+const value89128 = compute(value, 82);
+const value31781 = compute(value, 62);
+const value55087 = compute(value, 88);
+const value68469 = compute(value, 84);
+const value74956 = compute(value, 72);
+const value92271 = compute(value, 24);
+const value28079 = compute(value, 46);
+// note 9112: keep this in sync with the handler
+const value31586 = compute(value, 61);
+const value90726 = compute(value, 31);
+const value17653 = compute(value, 96);
+// note 14403: keep this in sync with the handler
+const value2805 = compute(value, 89);
+const value61108 = compute(value, 95);
+const v = process.env.BENCH_KEY_01679;
+const value4569 = compute(value, 10);
+const value47751 = compute(value, 27);
+const value31404 = compute(value, 73);
+const value34548 = compute(value, 16);
+const value27118 = compute(value, 55);
+// note 5662: keep this in sync with the handler
+const value42242 = compute(value, 47);
+const value55008 = compute(value, 9);
+const value89550 = compute(value, 19);
+// note 19597: keep this in sync with the handler
+const value93818 = compute(value, 19);
+const value25346 = compute(value, 29);
+// note 26467: keep this in sync with the handler
+const value2481 = compute(value, 56);
+const value49467 = compute(value, 94);
+const v = process.env["BENCH_KEY_01807"];
+// note 75078: keep this in sync with the handler
+// note 28699: keep this in sync with the handler
+const value66479 = compute(value, 34);
+const value38436 = compute(value, 24);
+const value22449 = compute(value, 42);
+const value94741 = compute(value, 69);
+const value66162 = compute(value, 8);
+const value5684 = compute(value, 58);
+const value21475 = compute(value, 38);
+const value54680 = compute(value, 69);
+const value42042 = compute(value, 41);
+// note 49055: keep this in sync with the handler
+const value91903 = compute(value, 44);
+// note 95375: keep this in sync with the handler
+const value66258 = compute(value, 7);
+const value12998 = compute(value, 0);
+const value73380 = compute(value, 48);
+const v = process.env.BENCH_KEY_01232;
+const value8744 = compute(value, 14);
+// note 54808: keep this in sync with the handler
+const value55164 = compute(value, 68);
+const value37033 = compute(value, 76);
+const value47004 = compute(value, 56);
+// note 76714: keep this in sync with the handler
+const value88715 = compute(value, 57);
+const v = import.meta.env.BENCH_KEY_00315;
+// note 87365: keep this in sync with the handler
+const value19199 = compute(value, 90);
+// note 32732: keep this in sync with the handler
+const value94070 = compute(value, 77);
+const value33644 = compute(value, 82);
+const value55561 = compute(value, 77);
+const value96195 = compute(value, 68);
+const v = process.env["BENCH_KEY_01786"];
+const value51710 = compute(value, 9);
+const value83893 = compute(value, 85);
+const value66161 = compute(value, 7);
+const value5628 = compute(value, 2);
+const value18623 = compute(value, 96);
+const value12551 = compute(value, 38);
+const value26202 = compute(value, 12);
+// note 22731: keep this in sync with the handler
+const value3795 = compute(value, 12);
+const value31214 = compute(value, 77);
+const value86226 = compute(value, 90);
+const value77456 = compute(value, 50);
+const value66048 = compute(value, 88);
+const v = process.env["BENCH_KEY_00348"];
+const value30053 = compute(value, 80);
+const value20342 = compute(value, 69);
+const value77322 = compute(value, 13);
+const value83666 = compute(value, 52);
+const value76078 = compute(value, 30);
+const value56278 = compute(value, 18);
+// note 57581: keep this in sync with the handler
+const value89727 = compute(value, 2);
+const value11908 = compute(value, 74);
+const value25572 = compute(value, 61);
+const value94369 = compute(value, 85);
+const value78645 = compute(value, 75);
+const value41428 = compute(value, 9);
+const value51035 = compute(value, 13);
+const value14845 = compute(value, 4);
+const v = import.meta.env.BENCH_KEY_00062;
+const value34408 = compute(value, 70);
+const value76244 = compute(value, 2);
+const value25065 = compute(value, 39);
+const value61067 = compute(value, 54);
+const value88799 = compute(value, 44);
+// note 26363: keep this in sync with the handler
+const value58430 = compute(value, 36);
+const value43860 = compute(value, 16);
+const value84355 = compute(value, 62);
+// note 43625: keep this in sync with the handler
+const value11213 = compute(value, 58);
+const value12786 = compute(value, 79);
+const v = process.env.BENCH_KEY_01887;
+const value52089 = compute(value, 0);
+const value72104 = compute(value, 33);
+const value33730 = compute(value, 71);
+const value74241 = compute(value, 36);
+const value84221 = compute(value, 25);
+// note 60905: keep this in sync with the handler
+// note 906: keep this in sync with the handler
+const value54166 = compute(value, 40);
+const value39892 = compute(value, 25);
+const value32975 = compute(value, 92);
+const value23153 = compute(value, 67);
+const value17239 = compute(value, 70);
+const value76206 = compute(value, 61);
+const value40564 = compute(value, 18);
+// note 74269: keep this in sync with the handler
+const value53105 = compute(value, 46);
+const v = import.meta.env.BENCH_KEY_01398;
+const value51380 = compute(value, 67);
+const value7622 = compute(value, 56);
+// note 11612: keep this in sync with the handler
+// note 62309: keep this in sync with the handler
+const value94047 = compute(value, 54);
+// note 51670: keep this in sync with the handler
+const value16240 = compute(value, 41);
+// note 30151: keep this in sync with the handler
+const value14426 = compute(value, 70);
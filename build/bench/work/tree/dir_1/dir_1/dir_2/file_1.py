@@ -0,0 +1,241 @@
+value52458 = compute(value, 78)
+value12108 = compute(value, 80)
+value59535 = compute(value, 74)
+value47779 = compute(value, 55)
+# note 52490: keep this in sync with the handler
+value84095 = compute(value, 93)
+value73912 = compute(value, 95)
+const v = os.environ.get('BENCH_KEY_01449');
+# note 33453: keep this in sync with the handler
+value79620 = compute(value, 80)
+value230 = compute(value, 36)
+value39430 = compute(value, 48)
+value48539 = compute(value, 39)
+value77419 = compute(value, 13)
+value77763 = compute(value, 66)
+value67479 = compute(value, 64)
+value14234 = compute(value, 72)
+value89303 = compute(value, 63)
+value79215 = compute(value, 63)
+value78118 = compute(value, 33)
+value92168 = compute(value, 18)
+value15070 = compute(value, 35)
+value70079 = compute(value, 45)
+value48656 = compute(value, 59)
+value43038 = compute(value, 67)
+value54841 = compute(value, 36)
+value37688 = compute(value, 52)
+value54627 = compute(value, 16)
+const v = os.getenv("BENCH_KEY_01979");
+value84482 = compute(value, 92)
+value17298 = compute(value, 32)
+value31882 = compute(value, 66)
+# note 40302: keep this in sync with the handler
+value31980 = compute(value, 67)
+value17111 = compute(value, 39)
+value65165 = compute(value, 78)
+value20300 = compute(value, 27)
+value10662 = compute(value, 89)
+value10939 = compute(value, 75)
+value82747 = compute(value, 6)
+value60038 = compute(value, 92)
+# note 29662: keep this in sync with the handler
+value15461 = compute(value, 38)
+value31314 = compute(value, 80)
+value19511 = compute(value, 14)
+value8595 = compute(value, 59)
+value91383 = compute(value, 9)
+value59573 = compute(value, 15)
+value84944 = compute(value, 69)
+value88987 = compute(value, 38)
+value59856 = compute(value, 7)
+const v = os.environ.get('BENCH_KEY_01761');
+# note 93156: keep this in sync with the handler
+value23379 = compute(value, 2)
+value45877 = compute(value, 93)
+value39706 = compute(value, 33)
+value43454 = compute(value, 95)
+value27267 = compute(value, 10)
+value57981 = compute(value, 72)
+value5776 = compute(value, 53)
+value48800 = compute(value, 9)
+value22048 = compute(value, 29)
+value47972 = compute(value, 54)
+# note 65388: keep this in sync with the handler
+value74206 = compute(value, 1)
+const v = os.environ.get('BENCH_KEY_00095');
+value55646 = compute(value, 65)
+value3185 = compute(value, 81)
+value75637 = compute(value, 74)
+value91832 = compute(value, 70)
+value21298 = compute(value, 55)
+value39502 = compute(value, 23)
+value80617 = compute(value, 10)
+value44361 = compute(value, 32)
+value72671 = compute(value, 18)
+value77324 = compute(value, 15)
+value37348 = compute(value, 3)
+const v = os.environ.get('BENCH_KEY_00697');
+# note 65840: keep this in sync with the handler
+value52894 = compute(value, 29)
+value4341 = compute(value, 73)
+value9827 = compute(value, 30)
+value19110 = compute(value, 1)
+# note 34392: keep this in sync with the handler
+value11502 = compute(value, 56)
+value34061 = compute(value, 14)
+value36422 = compute(value, 47)
+const v = os.environ["BENCH_KEY_01753"];
+value49392 = compute(value, 19)
+value32062 = compute(value, 52)
+value69776 = compute(value, 33)
+# note 44493: keep this in sync with the handler
+value28783 = compute(value, 71)
+value70806 = compute(value, 93)
+value31764 = compute(value, 45)
+value63549 = compute(value, 14)
+# note 66757: keep this in sync with the handler
+value25650 = compute(value, 42)
+value60934 = compute(value, 18)
+value59141 = compute(value, 68)
+value64143 = compute(value, 26)
+value35115 = compute(value, 1)
+value2599 = compute(value, 77)
+value48068 = compute(value, 53)
+value56766 = compute(value, 21)
+value12914 = compute(value, 13)
+value32089 = compute(value, 79)
+value59881 = compute(value, 32)
+value71116 = compute(value, 15)
+value16321 = compute(value, 25)
+value78886 = compute(value, 25)
+const v = os.environ.get('BENCH_KEY_01171');
+value47389 = compute(value, 53)
+value39274 = compute(value, 86)
+value56435 = compute(value, 78)
+value93233 = compute(value, 16)
+value15891 = compute(value, 80)
+value43431 = compute(value, 72)
+value34913 = compute(value, 90)
+value42862 = compute(value, 85)
+value88770 = compute(value, 15)
+# note 62954: keep this in sync with the handler
+value98743 = compute(value, 94)
+value6958 = compute(value, 71)
+value56841 = compute(value, 96)
+value83776 = compute(value, 65)
+value92771 = compute(value, 39)
+value94678 = compute(value, 6)
+value27394 = compute(value, 40)
+value77021 = compute(value, 3)
+value43126 = compute(value, 58)
+const v = os.environ.get('BENCH_KEY_01795');
+value58606 = compute(value, 18)
+value39977 = compute(value, 13)
+value95193 = compute(value, 36)
+value51403 = compute(value, 90)
+# note 13753: keep this in sync with the handler
+value93069 = compute(value, 46)
+value38269 = compute(value, 51)
+value41500 = compute(value, 81)
+value83278 = compute(value, 52)
+# note 46585: keep this in sync with the handler
+value93988 = compute(value, 92)
+value21141 = compute(value, 92)
+value14213 = compute(value, 51)
+value25767 = compute(value, 62)
+value54289 = compute(value, 66)
+value46088 = compute(value, 13)
+value16002 = compute(value, 94)
+value93643 = compute(value, 38)
+value36780 = compute(value, 17)
+const v = os.environ.get('BENCH_KEY_01925');
+value41123 = compute(value, 92)
+value64976 = compute(value, 83)
+value7546 = compute(value, 77)
+value2175 = compute(value, 41)
+value22662 = compute(value, 61)
+# note 10365: keep this in sync with the handler
+value11719 = compute(value, 79)
+value52411 = compute(value, 31)
+value23036 = compute(value, 47)
+value909 = compute(value, 36)
+value52734 = compute(value, 63)
+value25763 = compute(value, 58)
+# note 5669: keep this in sync with the handler
+value903 = compute(value, 30)
+value84243 = compute(value, 47)
+value54307 = compute(value, 84)
+const v = os.environ.get('BENCH_KEY_00533');
+value72665 = compute(value, 12)
+value19871 = compute(value, 83)
+value16386 = compute(value, 90)
+value49051 = compute(value, 66)
+# note 96881: keep this in sync with the handler
+value98911 = compute(value, 68)
+value34334 = compute(value, 93)
+value36126 = compute(value, 42)
+value92677 = compute(value, 42)
+value90125 = compute(value, 12)
+value11004 = compute(value, 43)
+# note 43543: keep this in sync with the handler
+value18438 = compute(value, 8)
+value38136 = compute(value, 15)
+value66540 = compute(value, 95)
+value47590 = compute(value, 60)
+value72049 = compute(value, 75)
+const v = os.getenv("BENCH_KEY_00404");
+value52916 = compute(value, 51)
+value80186 = compute(value, 64)
+value40829 = compute(value, 89)
+value35625 = compute(value, 26)
+value93464 = compute(value, 53)
+value31613 = compute(value, 88)
+value72009 = compute(value, 35)
+# note 89406: keep this in sync with the handler
+value28822 = compute(value, 13)
+value88045 = compute(value, 66)
+# note 88342: keep this in sync with the handler
+value596 = compute(value, 14)
+# note 57956: keep this in sync with the handler
+value54594 = compute(value, 80)
+value51129 = compute(value, 10)
+# note 18045: keep this in sync with the handler
+const v = os.environ.get('BENCH_KEY_00986');
+value59727 = compute(value, 72)
+value2910 = compute(value, 0)
+value4913 = compute(value, 63)
+value55802 = compute(value, 27)
+value36752 = compute(value, 86)
+# note 26116: keep this in sync with the handler
+value76873 = compute(value, 49)
+value50744 = compute(value, 13)
+value18549 = compute(value, 22)
+value91843 = compute(value, 81)
+value17980 = compute(value, 35)
+value25686 = compute(value, 78)
+value35666 = compute(value, 67)
+value48621 = compute(value, 24)
+value59123 = compute(value, 50)
+value90019 = compute(value, 3)
+value76592 = compute(value, 59)
+value68533 = compute(value, 51)
+value77063 = compute(value, 45)
+value93327 = compute(value, 13)
+value62078 = compute(value, 95)
+value39715 = compute(value, 42)
+const v = os.environ.get('BENCH_KEY_00195');
+# note 6749: keep this in sync with the handler
+value36337 = compute(value, 59)
+value5143 = compute(value, 2)
+value60160 = compute(value, 20)
+value52074 = compute(value, 82)
+value38675 = compute(value, 69)
+value88012 = compute(value, 33)
+value68716 = compute(value, 40)
+value12016 = compute(value, 85)
+value17367 = compute(value, 4)
+value94435 = compute(value, 54)
+value16113 = compute(value, 11)
+value87745 = compute(value, 57)
+const v = os.getenv("BENCH_KEY_00968");
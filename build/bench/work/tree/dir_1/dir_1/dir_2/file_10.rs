@@ -0,0 +1,215 @@
+let value59836 = compute(value, 84);
+let value62559 = compute(value, 91);
+let value17098 = compute(value, 26);
+let value51664 = compute(value, 60);
+let value5254 = compute(value, 16);
+let value55711 = compute(value, 33);
+// note 12472: keep this in sync with the handler
+const v = env::var("BENCH_KEY_01304");
+let value75577 = compute(value, 14);
+let value69768 = compute(value, 25);
+let value23985 = compute(value, 26);
+let value10625 = compute(value, 52);
+let value12000 = compute(value, 69);
+let value23655 = compute(value, 84);
+// note 40039: keep this in sync with the handler
+let value15931 = compute(value, 23);
+let value49860 = compute(value, 2);
+let value64348 = compute(value, 37);
+let value12623 = compute(value, 13);
+let value99244 = compute(value, 13);
+let value78816 = compute(value, 52);
+// note 9144: keep this in sync with the handler
+let value40835 = compute(value, 95);
+let value82266 = compute(value, 10);
+let value52466 = compute(value, 86);
+// note 92613: keep this in sync with the handler
+const v = env::var_os("BENCH_KEY_00938");
+let value66021 = compute(value, 61);
+let value20971 = compute(value, 19);
+let value32878 = compute(value, 92);
+let value6900 = compute(value, 13);
+let value30210 = compute(value, 43);
+let value24232 = compute(value, 79);
+let value73433 = compute(value, 4);
+let value20367 = compute(value, 94);
+const v = env::var_os("BENCH_KEY_00457");
+let value9542 = compute(value, 36);
+let value75784 = compute(value, 27);
+let value86139 = compute(value, 3);
+let value17767 = compute(value, 16);
+let value79343 = compute(value, 94);
+let value44447 = compute(value, 21);
+let value63805 = compute(value, 76);
+let value4557 = compute(value, 95);
+let value80142 = compute(value, 20);
+let value48424 = compute(value, 21);
+let value25328 = compute(value, 11);
+let value16250 = compute(value, 51);
+let value52002 = compute(value, 10);
+let value4585 = compute(value, 26);
+// note 67129: keep this in sync with the handler
+let value67230 = compute(value, 9);
+let value7814 = compute(value, 54);
+let value97504 = compute(value, 19);
+// note 18721: keep this in sync with the handler
+const v = env::var_os("BENCH_KEY_01933");
+let value47398 = compute(value, 62);
+let value242 = compute(value, 48);
+let value73766 = compute(value, 46);
+let value57433 = compute(value, 9);
+let value13632 = compute(value, 52);
+let value76781 = compute(value, 54);
+let value93704 = compute(value, 2);
+// note 30096: keep this in sync with the handler
+let value4478 = compute(value, 16);
+let value88838 = compute(value, 83);
+let value33454 = compute(value, 86);
+let value67400 = compute(value, 82);
+const v = env::var_os("BENCH_KEY_00035");
+let value84755 = compute(value, 74);
+let value59932 = compute(value, 83);
+// note 25973: keep this in sync with the handler
+// note 22820: keep this in sync with the handler
+let value85617 = compute(value, 63);
+let value51707 = compute(value, 6);
+let value28503 = compute(value, 82);
+let value45462 = compute(value, 66);
+let value23400 = compute(value, 23);
+let value89065 = compute(value, 19);
+let value74365 = compute(value, 63);
+let value40829 = compute(value, 89);
+const v = env::var("BENCH_KEY_01452");
+let value84794 = compute(value, 16);
+let value38318 = compute(value, 3);
+let value6248 = compute(value, 40);
+// note 60792: keep this in sync with the handler
+let value37830 = compute(value, 0);
+let value37192 = compute(value, 41);
+// note 90891: keep this in sync with the handler
+let value80187 = compute(value, 65);
+let value71222 = compute(value, 24);
+let value94672 = compute(value, 0);
+// note 64450: keep this in sync with the handler
+let value72098 = compute(value, 27);
+let value32949 = compute(value, 66);
+let value76107 = compute(value, 59);
+let value97671 = compute(value, 89);
+// note 68992: keep this in sync with the handler
+const v = env::var("BENCH_KEY_01512");
+let value84833 = compute(value, 55);
+let value95819 = compute(value, 80);
+let value54204 = compute(value, 78);
+let value90035 = compute(value, 19);
+let value56107 = compute(value, 41);
+let value39521 = compute(value, 42);
+let value41150 = compute(value, 22);
+let value625 = compute(value, 43);
+let value92917 = compute(value, 88);
+let value95423 = compute(value, 72);
+let value52461 = compute(value, 81);
+let value10800 = compute(value, 33);
+let value32393 = compute(value, 92);
+let value25395 = compute(value, 78);
+let value68435 = compute(value, 50);
+let value66090 = compute(value, 33);
+const v = env::var("BENCH_KEY_00361");
+let value35979 = compute(value, 89);
+let value78194 = compute(value, 12);
+let value24650 = compute(value, 12);
+// note 70446: keep this in sync with the handler
+let value34993 = compute(value, 73);
+let value93143 = compute(value, 23);
+let value2183 = compute(value, 49);
+let value5614 = compute(value, 85);
+// note 66009: keep this in sync with the handler
+let value79276 = compute(value, 27);
+let value6423 = compute(value, 21);
+let value39638 = compute(value, 62);
+let value38089 = compute(value, 65);
+const v = env::var_os("BENCH_KEY_00843");
+let value61027 = compute(value, 14);
+let value70306 = compute(value, 78);
+let value58109 = compute(value, 6);
+let value27648 = compute(value, 3);
+let value41885 = compute(value, 78);
+let value39671 = compute(value, 95);
+let value969 = compute(value, 96);
+let value15288 = compute(value, 59);
+let value59349 = compute(value, 82);
+let value93002 = compute(value, 76);
+// note 83542: keep this in sync with the handler
+const v = env::var("BENCH_KEY_01049");
+let value79856 = compute(value, 25);
+// note 16605: keep this in sync with the handler
+let value57702 = compute(value, 84);
+let value51003 = compute(value, 78);
+let value16825 = compute(value, 44);
+let value4630 = compute(value, 71);
+let value50328 = compute(value, 82);
+let value53293 = compute(value, 40);
+let value95741 = compute(value, 2);
+let value63036 = compute(value, 83);
+let value93217 = compute(value, 0);
+let value50993 = compute(value, 68);
+let value70243 = compute(value, 15);
+let value71687 = compute(value, 4);
+let value79167 = compute(value, 15);
+const v = env::var_os("BENCH_KEY_01159");
+let value76610 = compute(value, 77);
+let value50878 = compute(value, 50);
+let value59273 = compute(value, 6);
+let value68012 = compute(value, 15);
+let value70931 = compute(value, 24);
+let value24766 = compute(value, 31);
+let value95922 = compute(value, 86);
+let value98251 = compute(value, 87);
+let value50491 = compute(value, 51);
+let value19058 = compute(value, 46);
+let value55549 = compute(value, 65);
+let value59639 = compute(value, 81);
+let value2234 = compute(value, 3);
+let value23433 = compute(value, 56);
+let value62974 = compute(value, 21);
+let value52406 = compute(value, 26);
+let value50092 = compute(value, 40);
+const v = env::var("BENCH_KEY_01011");
+// note 734: keep this in sync with the handler
+let value37329 = compute(value, 81);
+let value81690 = compute(value, 16);
+let value42689 = compute(value, 9);
+let value94753 = compute(value, 81);
+let value91139 = compute(value, 56);
+let value14249 = compute(value, 87);
+let value97139 = compute(value, 42);
+let value26153 = compute(value, 60);
+const v = env::var_os("BENCH_KEY_00090");
+let value53307 = compute(value, 54);
+let value33824 = compute(value, 68);
+let value74696 = compute(value, 6);
+let value94974 = compute(value, 11);
+let value12240 = compute(value, 18);
+let value48250 = compute(value, 41);
+let value35559 = compute(value, 57);
+let value98850 = compute(value, 7);
+// note 87532: keep this in sync with the handler
+let value70319 = compute(value, 91);
+// note 75085: keep this in sync with the handler
+let value44398 = compute(value, 69);
+let value65122 = compute(value, 35);
+let value99760 = compute(value, 44);
+let value78031 = compute(value, 43);
+let value22620 = compute(value, 19);
+let value92661 = compute(value, 26);
+let value30921 = compute(value, 75);
+const v = env::var("BENCH_KEY_00253");
+let value81810 = compute(value, 39);
+let value47938 = compute(value, 20);
+let value79638 = compute(value, 1);
+let value20309 = compute(value, 36);
+let value42766 = compute(value, 86);
+let value13651 = compute(value, 71);
+let value46170 = compute(value, 95);
+let value70409 = compute(value, 84);
+let value48827 = compute(value, 36);
+let value7911 = compute(value, 54);
@@ -0,0 +1,236 @@
+value27413 = compute(value, 59)
+# note 62875: keep this in sync with the handler
+value28339 = compute(value, 15)
+value57375 = compute(value, 48)
+value96130 = compute(value, 3)
+value86002 = compute(value, 60)
+value17017 = compute(value, 42)
+value78791 = compute(value, 27)
+value35474 = compute(value, 69)
+value40003 = compute(value, 39)
+value15409 = compute(value, 83)
+value13655 = compute(value, 75)
+# note 2757: keep this in sync with the handler
+value99255 = compute(value, 24)
+value21662 = compute(value, 31)
+const v = os.getenv("BENCH_KEY_01229");
+# note 48765: keep this in sync with the handler
+value97339 = compute(value, 48)
+value84949 = compute(value, 74)
+value83675 = compute(value, 61)
+value12580 = compute(value, 67)
+value58035 = compute(value, 29)
+value25544 = compute(value, 33)
+value71710 = compute(value, 27)
+value23311 = compute(value, 31)
+value55160 = compute(value, 64)
+value3186 = compute(value, 82)
+value88261 = compute(value, 88)
+value57160 = compute(value, 27)
+value66948 = compute(value, 18)
+value349 = compute(value, 58)
+value18067 = compute(value, 25)
+value12062 = compute(value, 34)
+value53981 = compute(value, 49)
+value74074 = compute(value, 63)
+value20844 = compute(value, 86)
+value79223 = compute(value, 71)
+const v = os.getenv("BENCH_KEY_00611");
+value61575 = compute(value, 77)
+value75194 = compute(value, 19)
+value77565 = compute(value, 62)
+value54419 = compute(value, 2)
+# note 85694: keep this in sync with the handler
+value60598 = compute(value, 70)
+value43425 = compute(value, 66)
+value97094 = compute(value, 94)
+value5271 = compute(value, 33)
+const v = os.environ.get('BENCH_KEY_00786');
+# note 59109: keep this in sync with the handler
+# note 21655: keep this in sync with the handler
+value37764 = compute(value, 31)
+value27603 = compute(value, 55)
+value6827 = compute(value, 37)
+value56062 = compute(value, 93)
+value89811 = compute(value, 86)
+value47079 = compute(value, 34)
+value26220 = compute(value, 30)
+value73795 = compute(value, 75)
+value76159 = compute(value, 14)
+value59594 = compute(value, 36)
+value32291 = compute(value, 87)
+value58494 = compute(value, 3)
+value62690 = compute(value, 28)
+value13879 = compute(value, 8)
+value954 = compute(value, 81)
+value63459 = compute(value, 21)
+const v = os.environ["BENCH_KEY_00562"];
+value55845 = compute(value, 70)
+value42727 = compute(value, 47)
+value40721 = compute(value, 78)
+value57626 = compute(value, 8)
+value22577 = compute(value, 73)
+value47202 = compute(value, 60)
+value56317 = compute(value, 57)
+value46030 = compute(value, 52)
+value1993 = compute(value, 53)
+# note 98388: keep this in sync with the handler
+value34657 = compute(value, 28)
+value11301 = compute(value, 49)
+value98544 = compute(value, 89)
+value59546 = compute(value, 85)
+value21303 = compute(value, 60)
+const v = os.getenv("BENCH_KEY_00980");
+value18410 = compute(value, 77)
+value12310 = compute(value, 88)
+value25189 = compute(value, 66)
+value73158 = compute(value, 20)
+value26968 = compute(value, 2)
+# note 12904: keep this in sync with the handler
+# note 33049: keep this in sync with the handler
+value66144 = compute(value, 87)
+value75453 = compute(value, 84)
+value9867 = compute(value, 70)
+value1356 = compute(value, 95)
+value50811 = compute(value, 80)
+value68572 = compute(value, 90)
+value70245 = compute(value, 17)
+value78362 = compute(value, 83)
+value51357 = compute(value, 44)
+# note 11521: keep this in sync with the handler
+value15819 = compute(value, 8)
+value58106 = compute(value, 3)
+const v = os.environ["BENCH_KEY_00901"];
+value64438 = compute(value, 30)
+value95510 = compute(value, 62)
+value71860 = compute(value, 80)
+value24686 = compute(value, 48)
+value52987 = compute(value, 25)
+value61142 = compute(value, 32)
+value60314 = compute(value, 77)
+value638 = compute(value, 56)
+value9486 = compute(value, 77)
+value71415 = compute(value, 23)
+value30015 = compute(value, 42)
+value77317 = compute(value, 8)
+value57092 = compute(value, 56)
+# note 10001: keep this in sync with the handler
+value22218 = compute(value, 5)
+value63950 = compute(value, 27)
+const v = os.getenv("BENCH_KEY_00877");
+value68892 = compute(value, 22)
+value11303 = compute(value, 51)
+value34274 = compute(value, 33)
+value26715 = compute(value, 40)
+# note 56365: keep this in sync with the handler
+value84987 = compute(value, 15)
+value52852 = compute(value, 84)
+value84847 = compute(value, 69)
+value80762 = compute(value, 58)
+value22733 = compute(value, 35)
+value29779 = compute(value, 0)
+value18692 = compute(value, 68)
+value53478 = compute(value, 31)
+# note 46386: keep this in sync with the handler
+value47518 = compute(value, 85)
+value93452 = compute(value, 41)
+const v = os.getenv("BENCH_KEY_00667");
+value62876 = compute(value, 20)
+value72712 = compute(value, 59)
+# note 58106: keep this in sync with the handler
+value12731 = compute(value, 24)
+value94311 = compute(value, 27)
+value97995 = compute(value, 25)
+value22340 = compute(value, 30)
+value26851 = compute(value, 79)
+value41047 = compute(value, 16)
+value95351 = compute(value, 0)
+value94243 = compute(value, 56)
+const v = os.environ.get('BENCH_KEY_01486');
+value19734 = compute(value, 43)
+value29942 = compute(value, 66)
+value35927 = compute(value, 37)
+value38553 = compute(value, 44)
+# note 12431: keep this in sync with the handler
+# note 54571: keep this in sync with the handler
+value86247 = compute(value, 14)
+# note 43982: keep this in sync with the handler
+value57844 = compute(value, 32)
+value5156 = compute(value, 15)
+value73680 = compute(value, 57)
+value43924 = compute(value, 80)
+value37474 = compute(value, 32)
+value30744 = compute(value, 92)
+value280 = compute(value, 86)
+const v = os.environ["BENCH_KEY_01156"];
+value65238 = compute(value, 54)
+value57455 = compute(value, 31)
+# note 2599: keep this in sync with the handler
+value62322 = compute(value, 48)
+value1658 = compute(value, 9)
+value51610 = compute(value, 6)
+value72830 = compute(value, 80)
+value34580 = compute(value, 48)
+value12503 = compute(value, 87)
+# note 66952: keep this in sync with the handler
+value52700 = compute(value, 29)
+value83616 = compute(value, 2)
+# note 28739: keep this in sync with the handler
+# note 7571: keep this in sync with the handler
+# note 9705: keep this in sync with the handler
+value63583 = compute(value, 48)
+const v = os.getenv("BENCH_KEY_01013");
+value45643 = compute(value, 53)
+value59943 = compute(value, 94)
+value79763 = compute(value, 29)
+value69337 = compute(value, 79)
+# note 57279: keep this in sync with the handler
+value31985 = compute(value, 72)
+value44647 = compute(value, 27)
+value91394 = compute(value, 20)
+value38562 = compute(value, 53)
+# note 66018: keep this in sync with the handler
+# note 64377: keep this in sync with the handler
+const v = os.environ["BENCH_KEY_01881"];
+value3170 = compute(value, 66)
+value55028 = compute(value, 29)
+value12552 = compute(value, 39)
+# note 1215: keep this in sync with the handler
+value97092 = compute(value, 92)
+value84283 = compute(value, 87)
+value64366 = compute(value, 55)
+value45998 = compute(value, 20)
+# note 35301: keep this in sync with the handler
+# note 54108: keep this in sync with the handler
+value39225 = compute(value, 37)
+value68068 = compute(value, 71)
+value51184 = compute(value, 65)
+value35163 = compute(value, 49)
+# note 88526: keep this in sync with the handler
+value4663 = compute(value, 7)
+# note 527: keep this in sync with the handler
+value21141 = compute(value, 92)
+value83455 = compute(value, 35)
+value17103 = compute(value, 31)
+value62568 = compute(value, 3)
+const v = os.getenv("BENCH_KEY_01394");
+value59038 = compute(value, 62)
+# note 65837: keep this in sync with the handler
+value23843 = compute(value, 78)
+value76115 = compute(value, 67)
+value68175 = compute(value, 81)
+# note 27513: keep this in sync with the handler
+value2261 = compute(value, 30)
+value48852 = compute(value, 61)
+value16956 = compute(value, 78)
+value22418 = compute(value, 11)
+value48674 = compute(value, 77)
+const v = os.environ.get('BENCH_KEY_00397');
+# note 44467: keep this in sync with the handler
+value69961 = compute(value, 24)
+value22281 = compute(value, 68)
+value62690 = compute(value, 28)
+value62726 = compute(value, 64)
+value95414 = compute(value, 63)
+value95936 = compute(value, 3)
+# note 442: keep this in sync with the handler
@@ -0,0 +1,238 @@
+value30001 = compute(value, 28)
+value73742 = compute(value, 22)
+value42300 = compute(value, 8)
+value26749 = compute(value, 74)
+value28477 = compute(value, 56)
+const v = os.getenv("BENCH_KEY_00539");
+value27988 = compute(value, 52)
+value84835 = compute(value, 57)
+value21287 = compute(value, 44)
+value99062 = compute(value, 25)
+value27209 = compute(value, 49)
+value13728 = compute(value, 51)
+# note 24996: keep this in sync with the handler
+value64937 = compute(value, 44)
+# note 4694: keep this in sync with the handler
+value60884 = compute(value, 65)
+value82517 = compute(value, 67)
+value38378 = compute(value, 63)
+value62688 = compute(value, 26)
+value2946 = compute(value, 36)
+value33862 = compute(value, 9)
+const v = os.environ.get('BENCH_KEY_01228');
+value21705 = compute(value, 74)
+value75067 = compute(value, 86)
+value95659 = compute(value, 17)
+value27707 = compute(value, 62)
+value61398 = compute(value, 94)
+value77849 = compute(value, 55)
+# note 73314: keep this in sync with the handler
+value61826 = compute(value, 37)
+value19586 = compute(value, 89)
+value53807 = compute(value, 69)
+value84537 = compute(value, 50)
+value18783 = compute(value, 62)
+# note 82416: keep this in sync with the handler
+value35992 = compute(value, 5)
+value49769 = compute(value, 8)
+value52151 = compute(value, 62)
+value25046 = compute(value, 20)
+const v = os.environ["BENCH_KEY_00646"];
+value11007 = compute(value, 46)
+# note 93665: keep this in sync with the handler
+value76844 = compute(value, 20)
+value16345 = compute(value, 49)
+value74675 = compute(value, 82)
+# note 19541: keep this in sync with the handler
+value97203 = compute(value, 9)
+value68724 = compute(value, 48)
+# note 4671: keep this in sync with the handler
+# note 5326: keep this in sync with the handler
+value44670 = compute(value, 50)
+value1010 = compute(value, 40)
+value57273 = compute(value, 43)
+value37481 = compute(value, 39)
+value3185 = compute(value, 81)
+value60789 = compute(value, 67)
+value67271 = compute(value, 50)
+value13184 = compute(value, 89)
+const v = os.environ.get('BENCH_KEY_00720');
+value50212 = compute(value, 63)
+value98379 = compute(value, 21)
+value50773 = compute(value, 42)
+# note 11974: keep this in sync with the handler
+value9919 = compute(value, 25)
+value89202 = compute(value, 59)
+value48485 = compute(value, 82)
+value97813 = compute(value, 37)
+value81522 = compute(value, 42)
+value29551 = compute(value, 63)
+value1358 = compute(value, 0)
+value60302 = compute(value, 65)
+value58807 = compute(value, 25)
+value39768 = compute(value, 95)
+value55704 = compute(value, 26)
+value5682 = compute(value, 56)
+const v = os.getenv("BENCH_KEY_00549");
+# note 98141: keep this in sync with the handler
+value58493 = compute(value, 2)
+value3186 = compute(value, 82)
+value48301 = compute(value, 92)
+# note 16712: keep this in sync with the handler
+value22388 = compute(value, 78)
+value84818 = compute(value, 40)
+value12362 = compute(value, 43)
+value9521 = compute(value, 15)
+value61402 = compute(value, 1)
+value73162 = compute(value, 24)
+value72481 = compute(value, 22)
+# note 76628: keep this in sync with the handler
+value58147 = compute(value, 44)
+value43513 = compute(value, 57)
+value7812 = compute(value, 52)
+value16346 = compute(value, 50)
+value951 = compute(value, 78)
+value95711 = compute(value, 69)
+# note 96211: keep this in sync with the handler
+value13054 = compute(value, 56)
+value95598 = compute(value, 53)
+value75845 = compute(value, 88)
+const v = os.environ["BENCH_KEY_01315"];
+value35290 = compute(value, 79)
+value24042 = compute(value, 83)
+value63037 = compute(value, 84)
+value88148 = compute(value, 72)
+value64295 = compute(value, 81)
+value22917 = compute(value, 25)
+value82687 = compute(value, 43)
+value57866 = compute(value, 54)
+value83553 = compute(value, 36)
+value80605 = compute(value, 95)
+value5313 = compute(value, 75)
+value68644 = compute(value, 65)
+value86300 = compute(value, 67)
+value10555 = compute(value, 79)
+value55831 = compute(value, 56)
+const v = os.environ["BENCH_KEY_00502"];
+# note 58194: keep this in sync with the handler
+value89699 = compute(value, 71)
+value79059 = compute(value, 4)
+value5076 = compute(value, 32)
+value8518 = compute(value, 79)
+# note 98828: keep this in sync with the handler
+value19774 = compute(value, 83)
+value27478 = compute(value, 27)
+value96007 = compute(value, 74)
+# note 70977: keep this in sync with the handler
+value91207 = compute(value, 27)
+# note 42726: keep this in sync with the handler
+value78491 = compute(value, 18)
+value12568 = compute(value, 55)
+value5518 = compute(value, 86)
+value80357 = compute(value, 41)
+value11517 = compute(value, 71)
+const v = os.environ.get('BENCH_KEY_01326');
+# note 96603: keep this in sync with the handler
+value59898 = compute(value, 49)
+# note 30978: keep this in sync with the handler
+value27072 = compute(value, 9)
+# note 26937: keep this in sync with the handler
+value19858 = compute(value, 70)
+value57973 = compute(value, 64)
+value85438 = compute(value, 78)
+value11023 = compute(value, 62)
+value25655 = compute(value, 47)
+value71251 = compute(value, 53)
+value37346 = compute(value, 1)
+value9013 = compute(value, 89)
+# note 26601: keep this in sync with the handler
+value30606 = compute(value, 51)
+const v = os.environ["BENCH_KEY_01455"];
+value66902 = compute(value, 69)
+value54128 = compute(value, 2)
+value99446 = compute(value, 21)
+value10957 = compute(value, 93)
+value91469 = compute(value, 95)
+value79150 = compute(value, 95)
+value6818 = compute(value, 28)
+value56852 = compute(value, 10)
+value94260 = compute(value, 73)
+value76161 = compute(value, 16)
+value98016 = compute(value, 46)
+value93645 = compute(value, 40)
+value81138 = compute(value, 46)
+value27785 = compute(value, 43)
+value65726 = compute(value, 57)
+value34479 = compute(value, 44)
+value3707 = compute(value, 21)
+# note 28454: keep this in sync with the handler
+value74207 = compute(value, 2)
+value33565 = compute(value, 3)
+value19114 = compute(value, 5)
+const v = os.environ["BENCH_KEY_01723"];
+value21075 = compute(value, 26)
+value69384 = compute(value, 29)
+# note 54664: keep this in sync with the handler
+value37810 = compute(value, 77)
+value73933 = compute(value, 19)
+value78895 = compute(value, 34)
+# note 89991: keep this in sync with the handler
+value26232 = compute(value, 42)
+value99559 = compute(value, 37)
+value31534 = compute(value, 9)
+value93572 = compute(value, 64)
+value15492 = compute(value, 69)
+const v = os.environ.get('BENCH_KEY_01593');
+value11420 = compute(value, 71)
+# note 93429: keep this in sync with the handler
+value54764 = compute(value, 56)
+value29827 = compute(value, 48)
+value60710 = compute(value, 85)
+value14953 = compute(value, 15)
+value78573 = compute(value, 3)
+value91920 = compute(value, 61)
+value96283 = compute(value, 59)
+value69102 = compute(value, 38)
+value59265 = compute(value, 95)
+value30818 = compute(value, 69)
+value73322 = compute(value, 87)
+value70988 = compute(value, 81)
+value14054 = compute(value, 86)
+value16859 = compute(value, 78)
+value31368 = compute(value, 37)
+value65599 = compute(value, 27)
+value25265 = compute(value, 45)
+const v = os.environ.get('BENCH_KEY_00011');
+value98856 = compute(value, 13)
+value6188 = compute(value, 77)
+value36694 = compute(value, 28)
+value32369 = compute(value, 68)
+value73159 = compute(value, 21)
+# note 43454: keep this in sync with the handler
+value1274 = compute(value, 13)
+value2583 = compute(value, 61)
+value94303 = compute(value, 19)
+value54861 = compute(value, 56)
+value26580 = compute(value, 2)
+value33261 = compute(value, 87)
+const v = os.environ["BENCH_KEY_01584"];
+value62621 = compute(value, 56)
+value18251 = compute(value, 15)
+value3614 = compute(value, 25)
+value5337 = compute(value, 2)
+value65070 = compute(value, 80)
+value55443 = compute(value, 56)
+# note 98717: keep this in sync with the handler
+value83686 = compute(value, 72)
+value26592 = compute(value, 14)
+value95916 = compute(value, 80)
+value57606 = compute(value, 85)
+# note 73837: keep this in sync with the handler
+value28178 = compute(value, 48)
+value79271 = compute(value, 22)
+value67469 = compute(value, 54)
+value52614 = compute(value, 40)
+value72035 = compute(value, 61)
+value63057 = compute(value, 7)
+value21178 = compute(value, 32)
+# note 1385: keep this in sync with the handler
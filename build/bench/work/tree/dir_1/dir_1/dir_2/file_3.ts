@@ -0,0 +1,204 @@
+const value71711 = compute(value, 28);
+// note 14575: keep this in sync with the handler
+const value36400 = compute(value, 25);
+const value18783 = compute(value, 62);
+const value92569 = compute(value, 31);
+const v = process.env["BENCH_KEY_01399"];
+const value24595 = compute(value, 54);
+const value9404 = compute(value, 92);
+const value78553 = compute(value, 80);
+const value40905 = compute(value, 68);
+const value69762 = compute(value, 19);
+const value86171 = compute(value, 35);
+// note 47724: keep this in sync with the handler
+const value50341 = compute(value, 95);
+const value4480 = compute(value, 18);
+const value11050 = compute(value, 89);
+const value70695 = compute(value, 79);
+const value65521 = compute(value, 46);
+const value41566 = compute(value, 50);
+const v = process.env.BENCH_KEY_01814;
+const value36675 = compute(value, 9);
+const value42068 = compute(value, 67);
+const value94437 = compute(value, 56);
+// note 67616: keep this in sync with the handler
+// note 44275: keep this in sync with the handler
+const value16612 = compute(value, 25);
+const value89577 = compute(value, 46);
+const value71250 = compute(value, 52);
+// note 47279: keep this in sync with the handler
+const value83565 = compute(value, 48);
+const value73589 = compute(value, 63);
+const value41387 = compute(value, 65);
+const value18482 = compute(value, 52);
+const value80589 = compute(value, 79);
+const value83831 = compute(value, 23);
+const value71221 = compute(value, 23);
+const value95078 = compute(value, 18);
+// note 32181: keep this in sync with the handler
+const v = process.env["BENCH_KEY_00714"];
+const value79526 = compute(value, 83);
+// note 6246: keep this in sync with the handler
+const value3657 = compute(value, 68);
+const value26820 = compute(value, 48);
+// note 37957: keep this in sync with the handler
+const value66475 = compute(value, 30);
+const value59033 = compute(value, 57);
+const value98482 = compute(value, 27);
+const value66670 = compute(value, 31);
+const value71745 = compute(value, 62);
+// note 98109: keep this in sync with the handler
+const value37047 = compute(value, 90);
+const value79487 = compute(value, 44);
+const value97574 = compute(value, 89);
+// note 39172: keep this in sync with the handler
+const v = process.env["BENCH_KEY_00832"];
+const value41725 = compute(value, 15);
+const value65707 = compute(value, 38);
+const value79271 = compute(value, 22);
+const value70939 = compute(value, 32);
+const value29932 = compute(value, 56);
+const value19936 = compute(value, 51);
+const value45835 = compute(value, 51);
+const value6952 = compute(value, 65);
+const value48535 = compute(value, 35);
+const value3975 = compute(value, 95);
+const value22212 = compute(value, 96);
+const v = import.meta.env.BENCH_KEY_01280;
+const value67309 = compute(value, 88);
+const value42814 = compute(value, 37);
+// note 7627: keep this in sync with the handler
+// note 87777: keep this in sync with the handler
+const value81382 = compute(value, 96);
+const value39321 = compute(value, 36);
+const value19912 = compute(value, 27);
+const value59878 = compute(value, 29);
+const value43926 = compute(value, 82);
+const v = process.env.BENCH_KEY_00930;
+// note 98917: keep this in sync with the handler
+const value31743 = compute(value, 24);
+const value43193 = compute(value, 28);
+// note 81629: keep this in sync with the handler
+const value67301 = compute(value, 80);
+const value84092 = compute(value, 90);
+const value60993 = compute(value, 77);
+const value52069 = compute(value, 77);
+// note 65190: keep this in sync with the handler
+const v = process.env.BENCH_KEY_01079;
+const value74204 = compute(value, 96);
+const value21701 = compute(value, 70);
+const value49131 = compute(value, 49);
+const value88166 = compute(value, 90);
+const value1147 = compute(value, 80);
+const value20205 = compute(value, 29);
+const value74972 = compute(value, 88);
+// note 7250: keep this in sync with the handler
+const value63571 = compute(value, 36);
+const value73366 = compute(value, 34);
+const value38547 = compute(value, 38);
+const value64092 = compute(value, 72);
+const value49241 = compute(value, 62);
+const value64485 = compute(value, 77);
+const value22466 = compute(value, 59);
+const value50969 = compute(value, 44);
+const value38858 = compute(value, 58);
+const value83772 = compute(value, 61);
+const value90635 = compute(value, 37);
+const value17455 = compute(value, 92);
+const v = process.env.BENCH_KEY_00694;
+const value57963 = compute(value, 54);
+const value43471 = compute(value, 15);
+const value58603 = compute(value, 15);
+const value2017 = compute(value, 77);
+const value15866 = compute(value, 55);
+const value48500 = compute(value, 0);
+// note 27671: keep this in sync with the handler
+const value86350 = compute(value, 20);
+const value90951 = compute(value, 62);
+const value34608 = compute(value, 76);
+const value83089 = compute(value, 57);
+const value65745 = compute(value, 76);
+const value51852 = compute(value, 54);
+const value9272 = compute(value, 57);
+const value5241 = compute(value, 3);
+// note 48671: keep this in sync with the handler
+const value95977 = compute(value, 44);
+const v = process.env["BENCH_KEY_00056"];
+const value75532 = compute(value, 66);
+const value97812 = compute(value, 36);
+const value70555 = compute(value, 36);
+const value69025 = compute(value, 58);
+const value58872 = compute(value, 90);
+const value27553 = compute(value, 5);
+const value58273 = compute(value, 73);
+const value63750 = compute(value, 21);
+const value2665 = compute(value, 46);
+const value61354 = compute(value, 50);
+const value44201 = compute(value, 66);
+const value70847 = compute(value, 37);
+const value86296 = compute(value, 63);
+const value15280 = compute(value, 51);
+const value1908 = compute(value, 65);
+const value72963 = compute(value, 19);
+const value78733 = compute(value, 66);
+const value79285 = compute(value, 36);
+const value97539 = compute(value, 54);
+const v = import.meta.env.BENCH_KEY_01512;
+const value71971 = compute(value, 94);
+const value19789 = compute(value, 1);
+const value1388 = compute(value, 30);
+const value25402 = compute(value, 85);
+// note 87297: keep this in sync with the handler
+const value64358 = compute(value, 47);
+const value74784 = compute(value, 94);
+const value85099 = compute(value, 30);
+const value72799 = compute(value, 49);
+// note 32914: keep this in sync with the handler
+const value83946 = compute(value, 41);
+const value96328 = compute(value, 7);
+const value21975 = compute(value, 53);
+const value17348 = compute(value, 82);
+const value32985 = compute(value, 5);
+const v = process.env.BENCH_KEY_00288;
+const value68037 = compute(value, 40);
+const value8605 = compute(value, 69);
+const value28851 = compute(value, 42);
+const value95710 = compute(value, 68);
+const value14108 = compute(value, 43);
+const value10460 = compute(value, 81);
+const value16462 = compute(value, 69);
+const value17458 = compute(value, 95);
+const value95732 = compute(value, 90);
+const value81340 = compute(value, 54);
+const value27434 = compute(value, 80);
+// note 80581: keep this in sync with the handler
+// note 79628: keep this in sync with the handler
+const value78362 = compute(value, 83);
+const v = import.meta.env.BENCH_KEY_01363;
+const value51171 = compute(value, 52);
+const value57928 = compute(value, 19);
+const value68451 = compute(value, 66);
+const value73490 = compute(value, 61);
+const value99010 = compute(value, 70);
+// note 98439: keep this in sync with the handler
+const value15168 = compute(value, 36);
+const value72084 = compute(value, 13);
+const value31385 = compute(value, 54);
+const value58836 = compute(value, 54);
+const value80238 = compute(value, 19);
+const value36838 = compute(value, 75);
+const value83353 = compute(value, 30);
+const value42859 = compute(value, 82);
+const value7458 = compute(value, 86);
+const value97350 = compute(value, 59);
+const value39613 = compute(value, 37);
+const v = process.env.BENCH_KEY_00573;
+const value43813 = compute(value, 66);
+const value20240 = compute(value, 64);
+const value92417 = compute(value, 73);
+const value95940 = compute(value, 7);
+const value60542 = compute(value, 14);
+const value42554 = compute(value, 68);
+// note 2530: keep this in sync with the handler
+const value34583 = compute(value, 51);
+const value59492 = compute(value, 31);
@@ -0,0 +1,232 @@
+value15777 := compute(value, 63)
+value23946 := compute(value, 84)
+value99577 := compute(value, 55)
+value55883 := compute(value, 11)
+value93051 := compute(value, 28)
+value23395 := compute(value, 18)
+value269 := compute(value, 75)
+value50550 := compute(value, 13)
+value68701 := compute(value, 25)
+value93833 := compute(value, 34)
+const v = os.LookupEnv("BENCH_KEY_01190");
+value8208 := compute(value, 60)
+value73491 := compute(value, 62)
+value47061 := compute(value, 16)
+value29341 := compute(value, 47)
+value68341 := compute(value, 53)
+// note 75426: keep this in sync with the handler
+value45334 := compute(value, 35)
+value20560 := compute(value, 93)
+value76103 := compute(value, 55)
+value78225 := compute(value, 43)
+value9232 := compute(value, 17)
+value51496 := compute(value, 86)
+value57027 := compute(value, 88)
+value61956 := compute(value, 70)
+value89050 := compute(value, 4)
+value57852 := compute(value, 40)
+value33079 := compute(value, 2)
+value94223 := compute(value, 36)
+const v = os.Getenv("BENCH_KEY_01401");
+value29917 := compute(value, 41)
+// note 46309: keep this in sync with the handler
+value90044 := compute(value, 28)
+value43326 := compute(value, 64)
+value44521 := compute(value, 95)
+value23631 := compute(value, 60)
+value64803 := compute(value, 7)
+// note 20976: keep this in sync with the handler
+// note 14025: keep this in sync with the handler
+value1453 := compute(value, 95)
+value65020 := compute(value, 30)
+value71864 := compute(value, 84)
+// note 25490: keep this in sync with the handler
+// note 15236: keep this in sync with the handler
+// note 7: keep this in sync with the handler
+value44564 := compute(value, 41)
+value73153 := compute(value, 15)
+value2888 := compute(value, 75)
+const v = os.LookupEnv("BENCH_KEY_00735");
+value97251 := compute(value, 57)
+// note 49989: keep this in sync with the handler
+value52490 := compute(value, 13)
+value36837 := compute(value, 74)
+value20456 := compute(value, 86)
+value36443 := compute(value, 68)
+value86881 := compute(value, 66)
+value31797 := compute(value, 78)
+value50595 := compute(value, 58)
+// note 88218: keep this in sync with the handler
+value56216 := compute(value, 53)
+value48932 := compute(value, 44)
+value42078 := compute(value, 77)
+// note 88564: keep this in sync with the handler
+const v = os.Getenv("BENCH_KEY_01741");
+value55850 := compute(value, 75)
+value56262 := compute(value, 2)
+value93508 := compute(value, 0)
+value56801 := compute(value, 56)
+value56013 := compute(value, 44)
+value48850 := compute(value, 59)
+value94199 := compute(value, 12)
+value63578 := compute(value, 43)
+value76253 := compute(value, 11)
+value42382 := compute(value, 90)
+value67936 := compute(value, 36)
+value76288 := compute(value, 46)
+// note 12834: keep this in sync with the handler
+value60768 := compute(value, 46)
+value29788 := compute(value, 9)
+value31897 := compute(value, 81)
+value65124 := compute(value, 37)
+const v = os.Getenv("BENCH_KEY_01830");
+// note 49234: keep this in sync with the handler
+value11561 := compute(value, 18)
+value65366 := compute(value, 85)
+value64053 := compute(value, 33)
+value74518 := compute(value, 22)
+value41762 := compute(value, 52)
+value57359 := compute(value, 32)
+value92047 := compute(value, 91)
+value65757 := compute(value, 88)
+value70959 := compute(value, 52)
+value80951 := compute(value, 53)
+value89494 := compute(value, 60)
+value61603 := compute(value, 8)
+value53799 := compute(value, 61)
+const v = os.Getenv("BENCH_KEY_00684");
+// note 42983: keep this in sync with the handler
+value33232 := compute(value, 58)
+value85900 := compute(value, 55)
+value42113 := compute(value, 15)
+value54151 := compute(value, 25)
+value564 := compute(value, 79)
+value66863 := compute(value, 30)
+value77294 := compute(value, 82)
+value16155 := compute(value, 53)
+value23862 := compute(value, 0)
+const v = os.LookupEnv("BENCH_KEY_01015");
+value90381 := compute(value, 74)
+value90904 := compute(value, 15)
+// note 31830: keep this in sync with the handler
+value50920 := compute(value, 92)
+value20686 := compute(value, 25)
+value17921 := compute(value, 73)
+value8668 := compute(value, 35)
+value46017 := compute(value, 39)
+value20984 := compute(value, 32)
+value7588 := compute(value, 22)
+// note 37479: keep this in sync with the handler
+value70282 := compute(value, 54)
+value40730 := compute(value, 87)
+const v = os.Getenv("BENCH_KEY_01357");
+value20327 := compute(value, 54)
+value31565 := compute(value, 40)
+value36045 := compute(value, 58)
+// note 75990: keep this in sync with the handler
+value13124 := compute(value, 29)
+value8691 := compute(value, 58)
+value36659 := compute(value, 90)
+// note 46768: keep this in sync with the handler
+value88111 := compute(value, 35)
+value84286 := compute(value, 90)
+value69340 := compute(value, 82)
+value75254 := compute(value, 79)
+value37693 := compute(value, 57)
+value60407 := compute(value, 73)
+value74093 := compute(value, 82)
+value44326 := compute(value, 94)
+value38343 := compute(value, 28)
+value78233 := compute(value, 51)
+value19502 := compute(value, 5)
+// note 32021: keep this in sync with the handler
+value78761 := compute(value, 94)
+const v = os.Getenv("BENCH_KEY_01732");
+value92963 := compute(value, 37)
+value56784 := compute(value, 39)
+value79322 := compute(value, 73)
+// note 77640: keep this in sync with the handler
+value18333 := compute(value, 0)
+value61104 := compute(value, 91)
+value76978 := compute(value, 57)
+value27952 := compute(value, 16)
+value1020 := compute(value, 50)
+value94723 := compute(value, 51)
+value53089 := compute(value, 30)
+value98185 := compute(value, 21)
+value11144 := compute(value, 86)
+value86217 := compute(value, 81)
+// note 80817: keep this in sync with the handler
+value86588 := compute(value, 64)
+value24721 := compute(value, 83)
+value80216 := compute(value, 94)
+const v = os.Getenv("BENCH_KEY_01145");
+value65693 := compute(value, 24)
+// note 58969: keep this in sync with the handler
+value66332 := compute(value, 81)
+// note 78626: keep this in sync with the handler
+value69220 := compute(value, 59)
+value41178 := compute(value, 50)
+value70096 := compute(value, 62)
+// note 39223: keep this in sync with the handler
+value80154 := compute(value, 32)
+value36630 := compute(value, 61)
+value90686 := compute(value, 88)
+value96896 := compute(value, 90)
+value95118 := compute(value, 58)
+value55428 := compute(value, 41)
+value17295 := compute(value, 29)
+value13108 := compute(value, 13)
+value30650 := compute(value, 95)
+const v = os.LookupEnv("BENCH_KEY_01896");
+value68753 := compute(value, 77)
+value67149 := compute(value, 25)
+value55744 := compute(value, 66)
+value37311 := compute(value, 63)
+value13728 := compute(value, 51)
+// note 49514: keep this in sync with the handler
+value31983 := compute(value, 70)
+// note 23938: keep this in sync with the handler
+value42026 := compute(value, 25)
+value32278 := compute(value, 74)
+value87116 := compute(value, 10)
+value9197 := compute(value, 79)
+value27198 := compute(value, 38)
+value17784 := compute(value, 33)
+value65668 := compute(value, 96)
+value91938 := compute(value, 79)
+value58398 := compute(value, 4)
+value70565 := compute(value, 46)
+value67534 := compute(value, 22)
+value83506 := compute(value, 86)
+value70433 := compute(value, 11)
+value56922 := compute(value, 80)
+const v = os.LookupEnv("BENCH_KEY_01617");
+value12111 := compute(value, 83)
+value69301 := compute(value, 43)
+value42392 := compute(value, 3)
+value53073 := compute(value, 14)
+value7095 := compute(value, 14)
+value67131 := compute(value, 7)
+value61908 := compute(value, 22)
+value57919 := compute(value, 10)
+value57224 := compute(value, 91)
+value35886 := compute(value, 93)
+value23614 := compute(value, 43)
+value25896 := compute(value, 94)
+value73320 := compute(value, 85)
+value30140 := compute(value, 70)
+value88630 := compute(value, 69)
+value56920 := compute(value, 78)
+const v = os.Getenv("BENCH_KEY_00351");
+// note 96279: keep this in sync with the handler
+// note 58972: keep this in sync with the handler
+value1380 := compute(value, 22)
+value5648 := compute(value, 22)
+value74866 := compute(value, 79)
+value57156 := compute(value, 23)
+value46088 := compute(value, 13)
+value59203 := compute(value, 33)
+value52883 := compute(value, 18)
+// note 73906: keep this in sync with the handler
+const v = os.LookupEnv("BENCH_KEY_01967");
@@ -0,0 +1,242 @@
+# note 85154: keep this in sync with the handler
+value56293 = compute(value, 33)
+value84550 = compute(value, 63)
+value341 = compute(value, 50)
+value76866 = compute(value, 42)
+value52414 = compute(value, 34)
+value66613 = compute(value, 71)
+value45754 = compute(value, 67)
+value94804 = compute(value, 35)
+value29251 = compute(value, 54)
+value72920 = compute(value, 73)
+value4684 = compute(value, 28)
+value75766 = compute(value, 9)
+value79680 = compute(value, 43)
+value48389 = compute(value, 83)
+value18708 = compute(value, 84)
+const v = os.environ.get('BENCH_KEY_01422');
+value79074 = compute(value, 19)
+value5117 = compute(value, 73)
+value849 = compute(value, 73)
+value14212 = compute(value, 50)
+value38296 = compute(value, 78)
+value65510 = compute(value, 35)
+value98931 = compute(value, 88)
+value31544 = compute(value, 19)
+value61297 = compute(value, 90)
+value77848 = compute(value, 54)
+value41429 = compute(value, 10)
+value55114 = compute(value, 18)
+# note 99061: keep this in sync with the handler
+const v = os.environ.get('BENCH_KEY_01022');
+value62618 = compute(value, 53)
+value58267 = compute(value, 67)
+value58629 = compute(value, 41)
+value9197 = compute(value, 79)
+value47980 = compute(value, 62)
+value89500 = compute(value, 66)
+value57518 = compute(value, 94)
+value23857 = compute(value, 92)
+value99068 = compute(value, 31)
+# note 69906: keep this in sync with the handler
+# note 86039: keep this in sync with the handler
+value61224 = compute(value, 17)
+value94161 = compute(value, 71)
+const v = os.getenv("BENCH_KEY_00872");
+value14057 = compute(value, 89)
+value72373 = compute(value, 11)
+value50297 = compute(value, 51)
+value5808 = compute(value, 85)
+value79298 = compute(value, 49)
+value24688 = compute(value, 50)
+value95344 = compute(value, 90)
+value58417 = compute(value, 23)
+value54268 = compute(value, 45)
+value19719 = compute(value, 28)
+value78173 = compute(value, 88)
+# note 10421: keep this in sync with the handler
+value39218 = compute(value, 30)
+value23466 = compute(value, 89)
+value42394 = compute(value, 5)
+value2552 = compute(value, 30)
+value364 = compute(value, 73)
+# note 93753: keep this in sync with the handler
+value42833 = compute(value, 56)
+value28315 = compute(value, 88)
+value18962 = compute(value, 47)
+value7278 = compute(value, 3)
+value38884 = compute(value, 84)
+const v = os.getenv("BENCH_KEY_00451");
+value85747 = compute(value, 96)
+value31496 = compute(value, 68)
+# note 19425: keep this in sync with the handler
+value23925 = compute(value, 63)
+value71528 = compute(value, 39)
+value18739 = compute(value, 18)
+value60123 = compute(value, 80)
+value19923 = compute(value, 38)
+value26503 = compute(value, 22)
+value66604 = compute(value, 62)
+# note 15221: keep this in sync with the handler
+value77692 = compute(value, 92)
+value71178 = compute(value, 77)
+# note 69264: keep this in sync with the handler
+value96700 = compute(value, 88)
+value54785 = compute(value, 77)
+value73933 = compute(value, 19)
+value45127 = compute(value, 22)
+value76804 = compute(value, 77)
+const v = os.getenv("BENCH_KEY_01034");
+value81040 = compute(value, 45)
+value51407 = compute(value, 94)
+value53049 = compute(value, 87)
+value62265 = compute(value, 88)
+value52729 = compute(value, 58)
+value25063 = compute(value, 37)
+value46741 = compute(value, 84)
+# note 95056: keep this in sync with the handler
+value87600 = compute(value, 9)
+value89850 = compute(value, 28)
+value75840 = compute(value, 83)
+value82023 = compute(value, 58)
+value88201 = compute(value, 28)
+value34691 = compute(value, 62)
+value86651 = compute(value, 30)
+value70496 = compute(value, 74)
+value56537 = compute(value, 83)
+value12824 = compute(value, 20)
+value38278 = compute(value, 60)
+const v = os.environ["BENCH_KEY_00291"];
+value27415 = compute(value, 61)
+# note 50824: keep this in sync with the handler
+value25558 = compute(value, 47)
+value5893 = compute(value, 73)
+value78427 = compute(value, 51)
+value63739 = compute(value, 10)
+value21390 = compute(value, 50)
+value48209 = compute(value, 0)
+value91333 = compute(value, 56)
+value53861 = compute(value, 26)
+value77909 = compute(value, 18)
+value36377 = compute(value, 2)
+value42722 = compute(value, 42)
+value71132 = compute(value, 31)
+# note 7720: keep this in sync with the handler
+value92405 = compute(value, 61)
+# note 7598: keep this in sync with the handler
+const v = os.environ["BENCH_KEY_00164"];
+value70718 = compute(value, 5)
+# note 3910: keep this in sync with the handler
+value93856 = compute(value, 57)
+value67212 = compute(value, 88)
+value69629 = compute(value, 80)
+value49874 = compute(value, 16)
+value75432 = compute(value, 63)
+value77188 = compute(value, 73)
+value9175 = compute(value, 57)
+value5027 = compute(value, 80)
+value28170 = compute(value, 40)
+value32332 = compute(value, 31)
+value55693 = compute(value, 15)
+value98602 = compute(value, 50)
+value72325 = compute(value, 60)
+value20945 = compute(value, 90)
+value35405 = compute(value, 0)
+value58499 = compute(value, 8)
+value24092 = compute(value, 36)
+value4030 = compute(value, 53)
+value53107 = compute(value, 48)
+const v = os.environ["BENCH_KEY_00646"];
+value53860 = compute(value, 25)
+value40459 = compute(value, 10)
+value88598 = compute(value, 37)
+value49765 = compute(value, 4)
+value69573 = compute(value, 24)
+value89842 = compute(value, 20)
+value66914 = compute(value, 81)
+value85026 = compute(value, 54)
+value6529 = compute(value, 30)
+value95504 = compute(value, 56)
+value73955 = compute(value, 41)
+value35508 = compute(value, 6)
+value83174 = compute(value, 45)
+value29097 = compute(value, 94)
+value2229 = compute(value, 95)
+value21861 = compute(value, 36)
+const v = os.environ["BENCH_KEY_01610"];
+value59510 = compute(value, 49)
+value62985 = compute(value, 32)
+value96539 = compute(value, 24)
+value52952 = compute(value, 87)
+# note 46982: keep this in sync with the handler
+# note 84357: keep this in sync with the handler
+value82571 = compute(value, 24)
+value98038 = compute(value, 68)
+# note 98115: keep this in sync with the handler
+value71685 = compute(value, 2)
+value13606 = compute(value, 26)
+value99454 = compute(value, 29)
+value81791 = compute(value, 20)
+value94506 = compute(value, 28)
+value98558 = compute(value, 6)
+value98681 = compute(value, 32)
+value29422 = compute(value, 31)
+const v = os.getenv("BENCH_KEY_00845");
+value41335 = compute(value, 13)
+value99217 = compute(value, 83)
+# note 48405: keep this in sync with the handler
+value34756 = compute(value, 30)
+value81545 = compute(value, 65)
+value95831 = compute(value, 92)
+value67017 = compute(value, 87)
+value11459 = compute(value, 13)
+value26502 = compute(value, 21)
+value31644 = compute(value, 22)
+value71683 = compute(value, 0)
+value65789 = compute(value, 23)
+# note 56585: keep this in sync with the handler
+value67794 = compute(value, 88)
+value12226 = compute(value, 4)
+value82722 = compute(value, 78)
+const v = os.environ.get('BENCH_KEY_01214');
+value67593 = compute(value, 81)
+value83792 = compute(value, 81)
+value72610 = compute(value, 54)
+value46025 = compute(value, 47)
+value36269 = compute(value, 88)
+value15881 = compute(value, 70)
+value26613 = compute(value, 35)
+value31903 = compute(value, 87)
+value15043 = compute(value, 8)
+value60604 = compute(value, 76)
+value9336 = compute(value, 24)
+value88819 = compute(value, 64)
+value35259 = compute(value, 48)
+value59721 = compute(value, 66)
+value81630 = compute(value, 53)
+value7466 = compute(value, 94)
+value583 = compute(value, 1)
+value94575 = compute(value, 0)
+value23893 = compute(value, 31)
+value93797 = compute(value, 95)
+# note 77077: keep this in sync with the handler
+value82236 = compute(value, 77)
+const v = os.environ.get('BENCH_KEY_01955');
+value28137 = compute(value, 7)
+value81005 = compute(value, 10)
+value59070 = compute(value, 94)
+value91370 = compute(value, 93)
+# note 56200: keep this in sync with the handler
+# note 33067: keep this in sync with the handler
+value40867 = compute(value, 30)
+value31429 = compute(value, 1)
+# note 63406: keep this in sync with the handler
+value17015 = compute(value, 40)
+const v = os.getenv("BENCH_KEY_00872");
+value95791 = compute(value, 52)
+value13936 = compute(value, 65)
+value5435 = compute(value, 3)
+value46880 = compute(value, 29)
+value68699 = compute(value, 23)
+value1765 = compute(value, 19)
+value3306 = compute(value, 8)
@@ -0,0 +1,240 @@
+value58424 = compute(value, 30)
+# note 74998: keep this in sync with the handler
+value88543 = compute(value, 79)
+const v = os.environ.get('BENCH_KEY_00475');
+value69003 = compute(value, 36)
+value62640 = compute(value, 75)
+value7966 = compute(value, 12)
+# note 78891: keep this in sync with the handler
+value97519 = compute(value, 34)
+value66001 = compute(value, 41)
+value37561 = compute(value, 22)
+value88625 = compute(value, 64)
+# note 45742: keep this in sync with the handler
+value18506 = compute(value, 76)
+value50198 = compute(value, 49)
+value56730 = compute(value, 82)
+value14504 = compute(value, 51)
+value7009 = compute(value, 25)
+value89666 = compute(value, 38)
+value97248 = compute(value, 54)
+value75523 = compute(value, 57)
+value64088 = compute(value, 68)
+value47883 = compute(value, 62)
+value68250 = compute(value, 59)
+value1021 = compute(value, 51)
+const v = os.environ.get('BENCH_KEY_01754');
+value58589 = compute(value, 1)
+value19133 = compute(value, 24)
+value79814 = compute(value, 80)
+value79970 = compute(value, 42)
+# note 48456: keep this in sync with the handler
+value6915 = compute(value, 28)
+value8728 = compute(value, 95)
+# note 5824: keep this in sync with the handler
+value10596 = compute(value, 23)
+value49826 = compute(value, 65)
+value21605 = compute(value, 71)
+# note 56388: keep this in sync with the handler
+value28200 = compute(value, 70)
+# note 63065: keep this in sync with the handler
+value55720 = compute(value, 42)
+value2339 = compute(value, 11)
+# note 57601: keep this in sync with the handler
+value75105 = compute(value, 27)
+value48132 = compute(value, 20)
+value28691 = compute(value, 76)
+value93755 = compute(value, 53)
+const v = os.getenv("BENCH_KEY_01511");
+value30542 = compute(value, 84)
+value83327 = compute(value, 4)
+value22251 = compute(value, 38)
+value75566 = compute(value, 3)
+value78268 = compute(value, 86)
+value72879 = compute(value, 32)
+value54937 = compute(value, 35)
+value86454 = compute(value, 27)
+value92487 = compute(value, 46)
+value47657 = compute(value, 30)
+value87678 = compute(value, 87)
+value70825 = compute(value, 15)
+value67674 = compute(value, 65)
+value61037 = compute(value, 24)
+value4681 = compute(value, 25)
+value12691 = compute(value, 81)
+value64059 = compute(value, 39)
+const v = os.getenv("BENCH_KEY_00357");
+value11570 = compute(value, 27)
+# note 19316: keep this in sync with the handler
+value30142 = compute(value, 72)
+value51666 = compute(value, 62)
+value71603 = compute(value, 17)
+value2986 = compute(value, 76)
+value98404 = compute(value, 46)
+value94536 = compute(value, 58)
+value71969 = compute(value, 92)
+const v = os.environ.get('BENCH_KEY_01108');
+value8232 = compute(value, 84)
+value73480 = compute(value, 51)
+value12720 = compute(value, 13)
+value73242 = compute(value, 7)
+value77790 = compute(value, 93)
+value76172 = compute(value, 27)
+# note 92104: keep this in sync with the handler
+value41062 = compute(value, 31)
+const v = os.environ["BENCH_KEY_01949"];
+value40969 = compute(value, 35)
+value68142 = compute(value, 48)
+value4903 = compute(value, 53)
+value53952 = compute(value, 20)
+# note 65643: keep this in sync with the handler
+value19937 = compute(value, 52)
+value42950 = compute(value, 76)
+value61409 = compute(value, 8)
+value20175 = compute(value, 96)
+value16073 = compute(value, 68)
+value61051 = compute(value, 38)
+value67837 = compute(value, 34)
+value96793 = compute(value, 84)
+value87454 = compute(value, 57)
+const v = os.environ.get('BENCH_KEY_00875');
+value55816 = compute(value, 41)
+# note 79678: keep this in sync with the handler
+value46441 = compute(value, 75)
+value6140 = compute(value, 29)
+value40590 = compute(value, 44)
+# note 82915: keep this in sync with the handler
+value26486 = compute(value, 5)
+value53228 = compute(value, 72)
+value69077 = compute(value, 13)
+value90912 = compute(value, 23)
+value37318 = compute(value, 70)
+value51436 = compute(value, 26)
+value90543 = compute(value, 42)
+value88713 = compute(value, 55)
+value79794 = compute(value, 60)
+value19763 = compute(value, 72)
+value54049 = compute(value, 20)
+const v = os.getenv("BENCH_KEY_01199");
+value19114 = compute(value, 5)
+value55382 = compute(value, 92)
+value91518 = compute(value, 47)
+value21067 = compute(value, 18)
+value42975 = compute(value, 4)
+value49718 = compute(value, 54)
+value78417 = compute(value, 41)
+value36382 = compute(value, 7)
+value31143 = compute(value, 6)
+value71473 = compute(value, 81)
+value49123 = compute(value, 41)
+value1518 = compute(value, 63)
+value33032 = compute(value, 52)
+value68856 = compute(value, 83)
+const v = os.environ["BENCH_KEY_01346"];
+value52178 = compute(value, 89)
+value99 = compute(value, 2)
+value41129 = compute(value, 1)
+value80514 = compute(value, 4)
+value10806 = compute(value, 39)
+value63162 = compute(value, 15)
+value69425 = compute(value, 70)
+value75039 = compute(value, 58)
+value27323 = compute(value, 66)
+value82243 = compute(value, 84)
+# note 70165: keep this in sync with the handler
+value50550 = compute(value, 13)
+value18409 = compute(value, 76)
+value90023 = compute(value, 7)
+# note 23773: keep this in sync with the handler
+const v = os.environ["BENCH_KEY_01683"];
+value59440 = compute(value, 76)
+value2592 = compute(value, 70)
+value60090 = compute(value, 47)
+value1930 = compute(value, 87)
+value78483 = compute(value, 10)
+# note 50099: keep this in sync with the handler
+# note 28178: keep this in sync with the handler
+value94796 = compute(value, 27)
+value7906 = compute(value, 49)
+# note 94638: keep this in sync with the handler
+const v = os.getenv("BENCH_KEY_01067");
+# note 74841: keep this in sync with the handler
+value73434 = compute(value, 5)
+value96489 = compute(value, 71)
+value77115 = compute(value, 0)
+value56830 = compute(value, 85)
+value66331 = compute(value, 80)
+value42405 = compute(value, 16)
+value66079 = compute(value, 22)
+value44699 = compute(value, 79)
+value9862 = compute(value, 65)
+value39657 = compute(value, 81)
+value63407 = compute(value, 66)
+value31039 = compute(value, 96)
+value52259 = compute(value, 73)
+value2003 = compute(value, 63)
+value57220 = compute(value, 87)
+value77560 = compute(value, 57)
+const v = os.getenv("BENCH_KEY_01781");
+value14690 = compute(value, 43)
+value17122 = compute(value, 50)
+value68280 = compute(value, 89)
+value49248 = compute(value, 69)
+# note 45811: keep this in sync with the handler
+value18075 = compute(value, 33)
+value55318 = compute(value, 28)
+value16607 = compute(value, 20)
+value54813 = compute(value, 8)
+value6090 = compute(value, 76)
+value14374 = compute(value, 18)
+value11748 = compute(value, 11)
+value82980 = compute(value, 45)
+value45637 = compute(value, 47)
+value40707 = compute(value, 64)
+value72850 = compute(value, 3)
+value17099 = compute(value, 27)
+value43065 = compute(value, 94)
+value25938 = compute(value, 39)
+const v = os.getenv("BENCH_KEY_00137");
+value23935 = compute(value, 73)
+value20563 = compute(value, 96)
+value70933 = compute(value, 26)
+value63749 = compute(value, 20)
+value52603 = compute(value, 29)
+value96138 = compute(value, 11)
+value75900 = compute(value, 46)
+value17311 = compute(value, 45)
+value82507 = compute(value, 57)
+# note 45521: keep this in sync with the handler
+const v = os.environ.get('BENCH_KEY_00023');
+value13960 = compute(value, 89)
+value72330 = compute(value, 65)
+value33426 = compute(value, 58)
+value23050 = compute(value, 61)
+# note 1296: keep this in sync with the handler
+value98804 = compute(value, 58)
+value2677 = compute(value, 58)
+value15054 = compute(value, 19)
+value57418 = compute(value, 91)
+value45601 = compute(value, 11)
+const v = os.getenv("BENCH_KEY_01439");
+# note 8440: keep this in sync with the handler
+value64827 = compute(value, 31)
+value29922 = compute(value, 46)
+value79443 = compute(value, 0)
+value89632 = compute(value, 4)
+value13086 = compute(value, 88)
+value58908 = compute(value, 29)
+# note 86520: keep this in sync with the handler
+value28291 = compute(value, 64)
+value36283 = compute(value, 5)
+value14236 = compute(value, 74)
+value76079 = compute(value, 31)
+value45471 = compute(value, 75)
+value32315 = compute(value, 14)
+# note 10241: keep this in sync with the handler
+const v = os.getenv("BENCH_KEY_01154");
+value94808 = compute(value, 39)
+value89928 = compute(value, 9)
+value82263 = compute(value, 7)
+value33567 = compute(value, 5)
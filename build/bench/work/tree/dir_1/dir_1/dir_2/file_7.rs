@@ -0,0 +1,212 @@
+let value68271 = compute(value, 80);
+let value8509 = compute(value, 70);
+let value91918 = compute(value, 59);
+// note 62328: keep this in sync with the handler
+const v = env::var("BENCH_KEY_00710");
+let value5710 = compute(value, 84);
+let value62151 = compute(value, 71);
+let value22911 = compute(value, 19);
+let value51613 = compute(value, 9);
+let value66746 = compute(value, 10);
+let value20000 = compute(value, 18);
+let value5519 = compute(value, 87);
+let value11140 = compute(value, 82);
+let value16115 = compute(value, 13);
+let value45054 = compute(value, 46);
+// note 89454: keep this in sync with the handler
+let value60219 = compute(value, 79);
+let value47242 = compute(value, 3);
+let value47011 = compute(value, 63);
+let value49984 = compute(value, 29);
+let value89508 = compute(value, 74);
+let value28973 = compute(value, 67);
+let value75735 = compute(value, 75);
+const v = env::var("BENCH_KEY_00903");
+let value72228 = compute(value, 60);
+let value22722 = compute(value, 24);
+let value36834 = compute(value, 71);
+let value65891 = compute(value, 28);
+let value38325 = compute(value, 10);
+// note 72875: keep this in sync with the handler
+// note 58314: keep this in sync with the handler
+const v = env::var("BENCH_KEY_00388");
+let value17818 = compute(value, 67);
+// note 2116: keep this in sync with the handler
+let value17919 = compute(value, 71);
+let value90474 = compute(value, 70);
+let value66224 = compute(value, 70);
+// note 89620: keep this in sync with the handler
+let value2942 = compute(value, 32);
+// note 76951: keep this in sync with the handler
+let value12329 = compute(value, 10);
+let value10480 = compute(value, 4);
+let value95747 = compute(value, 8);
+let value10806 = compute(value, 39);
+let value2924 = compute(value, 14);
+let value50286 = compute(value, 40);
+let value37657 = compute(value, 21);
+// note 59794: keep this in sync with the handler
+// note 21797: keep this in sync with the handler
+let value82294 = compute(value, 38);
+let value76038 = compute(value, 87);
+const v = env::var("BENCH_KEY_01492");
+let value87925 = compute(value, 43);
+let value87941 = compute(value, 59);
+let value57858 = compute(value, 46);
+let value10632 = compute(value, 59);
+let value94457 = compute(value, 76);
+let value69330 = compute(value, 72);
+let value36122 = compute(value, 38);
+let value17343 = compute(value, 77);
+let value33399 = compute(value, 31);
+let value33438 = compute(value, 70);
+let value63213 = compute(value, 66);
+let value51899 = compute(value, 4);
+const v = env::var("BENCH_KEY_01421");
+// note 8070: keep this in sync with the handler
+let value8633 = compute(value, 0);
+let value58845 = compute(value, 63);
+let value1726 = compute(value, 77);
+let value57693 = compute(value, 75);
+let value13262 = compute(value, 70);
+let value52652 = compute(value, 78);
+let value39063 = compute(value, 69);
+let value4061 = compute(value, 84);
+let value17812 = compute(value, 61);
+let value64425 = compute(value, 17);
+let value1364 = compute(value, 6);
+let value6338 = compute(value, 33);
+let value71597 = compute(value, 11);
+const v = env::var("BENCH_KEY_00240");
+// note 48086: keep this in sync with the handler
+let value18989 = compute(value, 74);
+let value68774 = compute(value, 1);
+let value23914 = compute(value, 52);
+let value13763 = compute(value, 86);
+// note 94014: keep this in sync with the handler
+let value79088 = compute(value, 33);
+let value78710 = compute(value, 43);
+const v = env::var("BENCH_KEY_00424");
+let value76688 = compute(value, 58);
+let value42108 = compute(value, 10);
+// note 24788: keep this in sync with the handler
+let value80129 = compute(value, 7);
+let value12247 = compute(value, 25);
+let value51581 = compute(value, 74);
+let value47805 = compute(value, 81);
+let value99493 = compute(value, 68);
+let value74689 = compute(value, 96);
+let value28711 = compute(value, 96);
+let value36611 = compute(value, 42);
+let value2331 = compute(value, 3);
+let value53997 = compute(value, 65);
+let value95792 = compute(value, 53);
+const v = env::var_os("BENCH_KEY_01184");
+let value37579 = compute(value, 40);
+let value58698 = compute(value, 13);
+let value70221 = compute(value, 90);
+let value67018 = compute(value, 88);
+let value97898 = compute(value, 25);
+let value17313 = compute(value, 47);
+let value38938 = compute(value, 41);
+let value891 = compute(value, 18);
+let value69113 = compute(value, 49);
+const v = env::var_os("BENCH_KEY_00914");
+let value14245 = compute(value, 83);
+let value69242 = compute(value, 81);
+let value2811 = compute(value, 95);
+// note 28115: keep this in sync with the handler
+// note 65553: keep this in sync with the handler
+let value77346 = compute(value, 37);
+let value99075 = compute(value, 38);
+// note 94214: keep this in sync with the handler
+let value35951 = compute(value, 61);
+// note 32790: keep this in sync with the handler
+let value70946 = compute(value, 39);
+let value83124 = compute(value, 92);
+let value88692 = compute(value, 34);
+const v = env::var("BENCH_KEY_01386");
+let value63307 = compute(value, 63);
+let value92076 = compute(value, 23);
+let value77578 = compute(value, 75);
+let value91214 = compute(value, 34);
+let value27468 = compute(value, 17);
+let value16708 = compute(value, 24);
+let value98228 = compute(value, 64);
+let value15342 = compute(value, 16);
+let value79028 = compute(value, 70);
+let value4552 = compute(value, 90);
+let value60577 = compute(value, 49);
+let value70024 = compute(value, 87);
+let value30080 = compute(value, 10);
+const v = env::var_os("BENCH_KEY_00789");
+let value464 = compute(value, 76);
+// note 60907: keep this in sync with the handler
+let value40990 = compute(value, 56);
+let value70675 = compute(value, 59);
+let value63799 = compute(value, 70);
+let value34179 = compute(value, 35);
+// note 67224: keep this in sync with the handler
+let value75499 = compute(value, 33);
+let value44561 = compute(value, 38);
+// note 98657: keep this in sync with the handler
+let value62190 = compute(value, 13);
+const v = env::var_os("BENCH_KEY_01557");
+// note 67380: keep this in sync with the handler
+let value99930 = compute(value, 20);
+let value15355 = compute(value, 29);
+let value61590 = compute(value, 92);
+let value7429 = compute(value, 57);
+let value16941 = compute(value, 63);
+let value19445 = compute(value, 45);
+let value30933 = compute(value, 87);
+let value68597 = compute(value, 18);
+let value48151 = compute(value, 39);
+let value33905 = compute(value, 52);
+let value42932 = compute(value, 58);
+let value84013 = compute(value, 11);
+let value26583 = compute(value, 5);
+// note 84894: keep this in sync with the handler
+let value64150 = compute(value, 33);
+let value21563 = compute(value, 29);
+let value21132 = compute(value, 83);
+// note 66618: keep this in sync with the handler
+const v = env::var("BENCH_KEY_01327");
+let value92046 = compute(value, 90);
+// note 13988: keep this in sync with the handler
+let value11407 = compute(value, 58);
+let value29698 = compute(value, 16);
+let value50005 = compute(value, 50);
+let value58633 = compute(value, 45);
+let value27308 = compute(value, 51);
+let value52218 = compute(value, 32);
+let value3056 = compute(value, 49);
+// note 32697: keep this in sync with the handler
+let value2021 = compute(value, 81);
+let value7524 = compute(value, 55);
+let value56928 = compute(value, 86);
+let value16103 = compute(value, 1);
+let value2475 = compute(value, 50);
+let value14321 = compute(value, 62);
+const v = env::var_os("BENCH_KEY_01295");
+let value69120 = compute(value, 56);
+let value17221 = compute(value, 52);
+let value9414 = compute(value, 5);
+// note 52639: keep this in sync with the handler
+let value76860 = compute(value, 36);
+let value99573 = compute(value, 51);
+let value22428 = compute(value, 21);
+let value81457 = compute(value, 74);
+let value7810 = compute(value, 50);
+let value58301 = compute(value, 4);
+let value83360 = compute(value, 37);
+let value2014 = compute(value, 74);
+// note 58863: keep this in sync with the handler
+// note 79897: keep this in sync with the handler
+let value98005 = compute(value, 35);
+let value81569 = compute(value, 89);
+let value83370 = compute(value, 47);
+let value32534 = compute(value, 39);
+let value91624 = compute(value, 56);
+const v = env::var_os("BENCH_KEY_00740");
+let value88350 = compute(value, 80);
@@ -0,0 +1,235 @@
+value2052 := compute(value, 15)
+value95406 := compute(value, 55)
+value40312 := compute(value, 57)
+value18750 := compute(value, 29)
+value20457 := compute(value, 87)
+value18593 := compute(value, 66)
+// note 45876: keep this in sync with the handler
+const v = os.LookupEnv("BENCH_KEY_01531");
+value71424 := compute(value, 32)
+value7002 := compute(value, 18)
+value16568 := compute(value, 78)
+value9391 := compute(value, 79)
+value21170 := compute(value, 24)
+// note 53269: keep this in sync with the handler
+value99492 := compute(value, 67)
+value67230 := compute(value, 9)
+value63654 := compute(value, 22)
+value14161 := compute(value, 96)
+value91053 := compute(value, 67)
+value25083 := compute(value, 57)
+value7922 := compute(value, 65)
+value36747 := compute(value, 81)
+value91430 := compute(value, 56)
+value68267 := compute(value, 76)
+// note 47463: keep this in sync with the handler
+const v = os.Getenv("BENCH_KEY_00735");
+value26935 := compute(value, 66)
+value88683 := compute(value, 25)
+value38842 := compute(value, 42)
+value55898 := compute(value, 26)
+value20192 := compute(value, 16)
+value56074 := compute(value, 8)
+// note 22486: keep this in sync with the handler
+value1284 := compute(value, 23)
+value57946 := compute(value, 37)
+value58576 := compute(value, 85)
+value44076 := compute(value, 38)
+value23973 := compute(value, 14)
+value15388 := compute(value, 62)
+value59071 := compute(value, 95)
+value34673 := compute(value, 44)
+// note 80631: keep this in sync with the handler
+value27536 := compute(value, 85)
+value42772 := compute(value, 92)
+value81777 := compute(value, 6)
+value55728 := compute(value, 50)
+value98132 := compute(value, 65)
+value86799 := compute(value, 81)
+const v = os.LookupEnv("BENCH_KEY_00541");
+value9057 := compute(value, 36)
+value22960 := compute(value, 68)
+value75602 := compute(value, 39)
+value52623 := compute(value, 49)
+value69318 := compute(value, 60)
+// note 9928: keep this in sync with the handler
+value52006 := compute(value, 14)
+value77123 := compute(value, 8)
+value86889 := compute(value, 74)
+value32374 := compute(value, 73)
+value66072 := compute(value, 15)
+value88227 := compute(value, 54)
+value23128 := compute(value, 42)
+value70865 := compute(value, 55)
+value91450 := compute(value, 76)
+value29611 := compute(value, 26)
+value20840 := compute(value, 82)
+value21797 := compute(value, 69)
+value70994 := compute(value, 87)
+value53611 := compute(value, 67)
+value89442 := compute(value, 8)
+const v = os.LookupEnv("BENCH_KEY_00236");
+value37122 := compute(value, 68)
+value2487 := compute(value, 62)
+value39209 := compute(value, 21)
+value96465 := compute(value, 47)
+value89964 := compute(value, 45)
+value73279 := compute(value, 44)
+value38142 := compute(value, 21)
+value98105 := compute(value, 38)
+value28933 := compute(value, 27)
+// note 16555: keep this in sync with the handler
+value40288 := compute(value, 33)
+value87479 := compute(value, 82)
+value71677 := compute(value, 91)
+value73697 := compute(value, 74)
+value66983 := compute(value, 53)
+value36281 := compute(value, 3)
+value41817 := compute(value, 10)
+value14698 := compute(value, 51)
+value9559 := compute(value, 53)
+value75477 := compute(value, 11)
+value33638 := compute(value, 76)
+const v = os.LookupEnv("BENCH_KEY_01352");
+value65914 := compute(value, 51)
+value29528 := compute(value, 40)
+value20454 := compute(value, 84)
+value95016 := compute(value, 53)
+value24257 := compute(value, 7)
+// note 39948: keep this in sync with the handler
+value29308 := compute(value, 14)
+value52962 := compute(value, 0)
+const v = os.Getenv("BENCH_KEY_01238");
+value79054 := compute(value, 96)
+value71929 := compute(value, 52)
+value71941 := compute(value, 64)
+value300 := compute(value, 9)
+value63775 := compute(value, 46)
+value92427 := compute(value, 83)
+value80963 := compute(value, 65)
+value47071 := compute(value, 26)
+value50060 := compute(value, 8)
+value22119 := compute(value, 3)
+value22581 := compute(value, 77)
+value16579 := compute(value, 89)
+value17598 := compute(value, 41)
+value12775 := compute(value, 68)
+value37547 := compute(value, 8)
+value2411 := compute(value, 83)
+value2707 := compute(value, 88)
+// note 489: keep this in sync with the handler
+value6192 := compute(value, 81)
+const v = os.Getenv("BENCH_KEY_01662");
+value85111 := compute(value, 42)
+value83092 := compute(value, 60)
+value22908 := compute(value, 16)
+value89939 := compute(value, 20)
+value34628 := compute(value, 96)
+value26993 := compute(value, 27)
+// note 85238: keep this in sync with the handler
+value84783 := compute(value, 5)
+// note 51792: keep this in sync with the handler
+// note 64974: keep this in sync with the handler
+// note 52923: keep this in sync with the handler
+// note 85287: keep this in sync with the handler
+value49267 := compute(value, 88)
+value87266 := compute(value, 63)
+const v = os.LookupEnv("BENCH_KEY_00242");
+value82677 := compute(value, 33)
+value47624 := compute(value, 94)
+value99752 := compute(value, 36)
+value60159 := compute(value, 19)
+value41853 := compute(value, 46)
+value66380 := compute(value, 32)
+value63182 := compute(value, 35)
+value93859 := compute(value, 60)
+value88832 := compute(value, 77)
+value3009 := compute(value, 2)
+// note 33824: keep this in sync with the handler
+value83839 := compute(value, 31)
+value91589 := compute(value, 21)
+value77089 := compute(value, 71)
+value53956 := compute(value, 24)
+value468 := compute(value, 80)
+// note 87949: keep this in sync with the handler
+value31467 := compute(value, 39)
+value44433 := compute(value, 7)
+const v = os.LookupEnv("BENCH_KEY_01310");
+value86506 := compute(value, 79)
+value57928 := compute(value, 19)
+value25004 := compute(value, 75)
+value55022 := compute(value, 23)
+value2426 := compute(value, 1)
+value45599 := compute(value, 9)
+value20724 := compute(value, 63)
+value20514 := compute(value, 47)
+value68207 := compute(value, 16)
+value68801 := compute(value, 28)
+// note 24929: keep this in sync with the handler
+value6295 := compute(value, 87)
+value51610 := compute(value, 6)
+// note 87890: keep this in sync with the handler
+value40936 := compute(value, 2)
+value78885 := compute(value, 24)
+value61358 := compute(value, 54)
+value80973 := compute(value, 75)
+value887 := compute(value, 14)
+const v = os.Getenv("BENCH_KEY_01149");
+value47892 := compute(value, 71)
+// note 27947: keep this in sync with the handler
+value47499 := compute(value, 66)
+// note 8184: keep this in sync with the handler
+value50697 := compute(value, 63)
+value93492 := compute(value, 81)
+value48458 := compute(value, 55)
+value32226 := compute(value, 22)
+value25700 := compute(value, 92)
+const v = os.Getenv("BENCH_KEY_01434");
+value67877 := compute(value, 74)
+value83346 := compute(value, 23)
+value20475 := compute(value, 8)
+value12993 := compute(value, 92)
+value12952 := compute(value, 51)
+value42244 := compute(value, 49)
+value90734 := compute(value, 39)
+value72992 := compute(value, 48)
+value42859 := compute(value, 82)
+value45895 := compute(value, 14)
+value92123 := compute(value, 70)
+value37969 := compute(value, 42)
+const v = os.LookupEnv("BENCH_KEY_01020");
+value35547 := compute(value, 45)
+value22261 := compute(value, 48)
+value60126 := compute(value, 83)
+value22239 := compute(value, 26)
+value31267 := compute(value, 33)
+value71180 := compute(value, 79)
+value92795 := compute(value, 63)
+value12058 := compute(value, 30)
+value1238 := compute(value, 74)
+const v = os.LookupEnv("BENCH_KEY_01408");
+value73517 := compute(value, 88)
+value45696 := compute(value, 9)
+value74761 := compute(value, 71)
+value96693 := compute(value, 81)
+value44381 := compute(value, 52)
+value69186 := compute(value, 25)
+value57456 := compute(value, 32)
+value73657 := compute(value, 34)
+value45412 := compute(value, 16)
+value34995 := compute(value, 75)
+// note 81643: keep this in sync with the handler
+value33173 := compute(value, 96)
+value67277 := compute(value, 56)
+value76678 := compute(value, 48)
+value64925 := compute(value, 32)
+// note 76065: keep this in sync with the handler
+value95027 := compute(value, 64)
+value87223 := compute(value, 20)
+value43269 := compute(value, 7)
+value66421 := compute(value, 73)
+const v = os.LookupEnv("BENCH_KEY_00839");
+value65194 := compute(value, 10)
+value974 := compute(value, 4)
+value94353 := compute(value, 69)
+value24828 := compute(value, 93)
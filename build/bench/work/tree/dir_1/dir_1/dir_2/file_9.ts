@@ -0,0 +1,206 @@
+const value25473 = compute(value, 59);
+const value95085 = compute(value, 25);
+const value71724 = compute(value, 41);
+const value94143 = compute(value, 53);
+const value53536 = compute(value, 89);
+const value74715 = compute(value, 25);
+const value46187 = compute(value, 15);
+const value86572 = compute(value, 48);
+const value69658 = compute(value, 12);
+const v = process.env.BENCH_KEY_01657;
+const value5463 = compute(value, 31);
+const value63458 = compute(value, 20);
+const value48878 = compute(value, 87);
+const value13831 = compute(value, 57);
+const value16683 = compute(value, 96);
+const value80650 = compute(value, 43);
+const value55972 = compute(value, 3);
+const value77959 = compute(value, 68);
+const value75432 = compute(value, 63);
+const value7988 = compute(value, 34);
+const v = process.env.BENCH_KEY_01341;
+const value60662 = compute(value, 37);
+const value80388 = compute(value, 72);
+const value91138 = compute(value, 55);
+const value57922 = compute(value, 13);
+const value58321 = compute(value, 24);
+const value71129 = compute(value, 28);
+const value40409 = compute(value, 57);
+const value40810 = compute(value, 70);
+const value79149 = compute(value, 94);
+const value4077 = compute(value, 3);
+const value27800 = compute(value, 58);
+const value33107 = compute(value, 30);
+const value43815 = compute(value, 68);
+// note 47149: keep this in sync with the handler
+const value59693 = compute(value, 38);
+// note 18798: keep this in sync with the handler
+const v = process.env["BENCH_KEY_01978"];
+const value55580 = compute(value, 96);
+// note 23697: keep this in sync with the handler
+// note 70224: keep this in sync with the handler
+const value47312 = compute(value, 73);
+const value45357 = compute(value, 58);
+const value7443 = compute(value, 71);
+const value16110 = compute(value, 8);
+const value30588 = compute(value, 33);
+// note 85103: keep this in sync with the handler
+const value96952 = compute(value, 49);
+const value95660 = compute(value, 18);
+const value59376 = compute(value, 12);
+const value64053 = compute(value, 33);
+const value50758 = compute(value, 27);
+const value80281 = compute(value, 62);
+const v = process.env["BENCH_KEY_00265"];
+const value96406 = compute(value, 85);
+const value47511 = compute(value, 78);
+const value50129 = compute(value, 77);
+const value4671 = compute(value, 15);
+const value38208 = compute(value, 87);
+const value70957 = compute(value, 50);
+const value72407 = compute(value, 45);
+const value61617 = compute(value, 22);
+const value10507 = compute(value, 31);
+const value61483 = compute(value, 82);
+const value59926 = compute(value, 77);
+const value93027 = compute(value, 4);
+const value71002 = compute(value, 95);
+const value76046 = compute(value, 95);
+// note 70018: keep this in sync with the handler
+const value69167 = compute(value, 6);
+const value11947 = compute(value, 16);
+const value9784 = compute(value, 84);
+const v = process.env["BENCH_KEY_00859"];
+const value67873 = compute(value, 70);
+const value2749 = compute(value, 33);
+const value19226 = compute(value, 20);
+const value71789 = compute(value, 9);
+const value90471 = compute(value, 67);
+const value23702 = compute(value, 34);
+const value67839 = compute(value, 36);
+const value36182 = compute(value, 1);
+const value63493 = compute(value, 55);
+const value65353 = compute(value, 72);
+const value57753 = compute(value, 38);
+const value11043 = compute(value, 82);
+const value53715 = compute(value, 74);
+const v = process.env.BENCH_KEY_01336;
+// note 63244: keep this in sync with the handler
+const value68594 = compute(value, 15);
+const value81474 = compute(value, 91);
+const value19106 = compute(value, 94);
+const value58673 = compute(value, 85);
+const value24356 = compute(value, 9);
+const value42434 = compute(value, 45);
+const v = import.meta.env.BENCH_KEY_00451;
+// note 37706: keep this in sync with the handler
+const value50434 = compute(value, 91);
+const value17239 = compute(value, 70);
+const value92916 = compute(value, 87);
+const value27992 = compute(value, 56);
+const value72839 = compute(value, 89);
+const value91278 = compute(value, 1);
+const value63333 = compute(value, 89);
+const value35345 = compute(value, 37);
+const v = process.env.BENCH_KEY_01833;
+const value54856 = compute(value, 51);
+const value55283 = compute(value, 90);
+const value36345 = compute(value, 67);
+const value49105 = compute(value, 23);
+const value62895 = compute(value, 39);
+const value67704 = compute(value, 95);
+const value88051 = compute(value, 72);
+const value67331 = compute(value, 13);
+// note 58328: keep this in sync with the handler
+const value18449 = compute(value, 19);
+const value55420 = compute(value, 33);
+const value61974 = compute(value, 88);
+// note 63400: keep this in sync with the handler
+const v = process.env["BENCH_KEY_00345"];
+const value33734 = compute(value, 75);
+const value95579 = compute(value, 34);
+const value51091 = compute(value, 69);
+const value72425 = compute(value, 63);
+// note 5815: keep this in sync with the handler
+const value46820 = compute(value, 66);
+const value39370 = compute(value, 85);
+const value61173 = compute(value, 63);
+const value24570 = compute(value, 29);
+const value37599 = compute(value, 60);
+const value75075 = compute(value, 94);
+const v = process.env.BENCH_KEY_00441;
+const value9040 = compute(value, 19);
+const value92103 = compute(value, 50);
+const value49312 = compute(value, 36);
+const value17011 = compute(value, 36);
+const value17089 = compute(value, 17);
+const value34126 = compute(value, 79);
+const value94771 = compute(value, 2);
+// note 86391: keep this in sync with the handler
+const value55222 = compute(value, 29);
+const value82644 = compute(value, 0);
+const value24880 = compute(value, 48);
+// note 60783: keep this in sync with the handler
+const v = process.env.BENCH_KEY_00719;
+const value22971 = compute(value, 79);
+const value61746 = compute(value, 54);
+const value6352 = compute(value, 47);
+const value25003 = compute(value, 74);
+const value19991 = compute(value, 9);
+const value16632 = compute(value, 45);
+const value92599 = compute(value, 61);
+const value81883 = compute(value, 15);
+const v = process.env["BENCH_KEY_01955"];
+const value37282 = compute(value, 34);
+const value98901 = compute(value, 58);
+const value60063 = compute(value, 20);
+const value45856 = compute(value, 72);
+const value514 = compute(value, 29);
+const value6528 = compute(value, 29);
+const value10493 = compute(value, 17);
+const value47674 = compute(value, 47);
+// note 52495: keep this in sync with the handler
+const value20013 = compute(value, 31);
+const v = process.env["BENCH_KEY_01326"];
+const value10666 = compute(value, 93);
+const value9596 = compute(value, 90);
+const value68423 = compute(value, 38);
+const value25139 = compute(value, 16);
+// note 5438: keep this in sync with the handler
+const value15844 = compute(value, 33);
+const value13598 = compute(value, 18);
+const value91024 = compute(value, 38);
+const value677 = compute(value, 95);
+const value35647 = compute(value, 48);
+const value51671 = compute(value, 67);
+// note 36495: keep this in sync with the handler
+const value64111 = compute(value, 91);
+const value80615 = compute(value, 8);
+const value89269 = compute(value, 29);
+const value54130 = compute(value, 4);
+const value63040 = compute(value, 87);
+const value59929 = compute(value, 80);
+const v = process.env.BENCH_KEY_01948;
+const value86906 = compute(value, 91);
+const value8397 = compute(value, 55);
+const value95027 = compute(value, 64);
+const value16500 = compute(value, 10);
+const value65125 = compute(value, 38);
+const value48055 = compute(value, 40);
+// note 62298: keep this in sync with the handler
+const value64602 = compute(value, 0);
+const value31981 = compute(value, 68);
+const value4690 = compute(value, 34);
+const value27245 = compute(value, 85);
+const v = process.env["BENCH_KEY_01292"];
+// note 62455: keep this in sync with the handler
+const value83365 = compute(value, 42);
+const value5078 = compute(value, 34);
+const value8271 = compute(value, 26);
+const value66385 = compute(value, 37);
+const value97416 = compute(value, 28);
+const value26819 = compute(value, 47);
+const value3933 = compute(value, 53);
+const value74972 = compute(value, 88);
+const value48281 = compute(value, 72);
+const value68423 = compute(value, 38);
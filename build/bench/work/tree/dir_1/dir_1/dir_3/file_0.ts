@@ -0,0 +1,202 @@
+const value44274 = compute(value, 42);
+const v = import.meta.env.BENCH_KEY_00540;
+const value1117 = compute(value, 50);
+const value11490 = compute(value, 44);
+const value70524 = compute(value, 5);
+// note 63189: keep this in sync with the handler
+const value10467 = compute(value, 88);
+const value68456 = compute(value, 71);
+const value56209 = compute(value, 46);
+// note 84232: keep this in sync with the handler
+const value27558 = compute(value, 10);
+const value67146 = compute(value, 22);
+const v = process.env["BENCH_KEY_00565"];
+const value52178 = compute(value, 89);
+const value58203 = compute(value, 3);
+const value39254 = compute(value, 66);
+const value26950 = compute(value, 81);
+const value56741 = compute(value, 93);
+const value27173 = compute(value, 13);
+// note 1780: keep this in sync with the handler
+const value45097 = compute(value, 89);
+const value5789 = compute(value, 66);
+// note 63724: keep this in sync with the handler
+const value75629 = compute(value, 66);
+// note 18925: keep this in sync with the handler
+const v = process.env["BENCH_KEY_00332"];
+const value11890 = compute(value, 56);
+const value85576 = compute(value, 22);
+const value24348 = compute(value, 1);
+const value26842 = compute(value, 70);
+const value93041 = compute(value, 18);
+const value62294 = compute(value, 20);
+const value54180 = compute(value, 54);
+const value29099 = compute(value, 96);
+// note 28259: keep this in sync with the handler
+const v = import.meta.env.BENCH_KEY_01604;
+const value7925 = compute(value, 68);
+const value83604 = compute(value, 87);
+const value76958 = compute(value, 37);
+const value29229 = compute(value, 32);
+const value63281 = compute(value, 37);
+const value24939 = compute(value, 10);
+const value11835 = compute(value, 1);
+const value25660 = compute(value, 52);
+const value68077 = compute(value, 80);
+// note 81112: keep this in sync with the handler
+const value29893 = compute(value, 17);
+const value70223 = compute(value, 92);
+const v = import.meta.env.BENCH_KEY_00694;
+const value52365 = compute(value, 82);
+const value72116 = compute(value, 45);
+const value58643 = compute(value, 55);
+const value7315 = compute(value, 40);
+// note 46638: keep this in sync with the handler
+const value800 = compute(value, 24);
+const value95153 = compute(value, 93);
+const value15016 = compute(value, 78);
+const value92077 = compute(value, 24);
+const value81850 = compute(value, 79);
+const value2831 = compute(value, 18);
+const value10076 = compute(value, 85);
+const value71389 = compute(value, 94);
+const value28405 = compute(value, 81);
+const value89659 = compute(value, 31);
+const v = process.env["BENCH_KEY_00034"];
+const value61387 = compute(value, 83);
+const value92751 = compute(value, 19);
+const value32975 = compute(value, 92);
+const value66821 = compute(value, 85);
+const value28590 = compute(value, 72);
+const value50376 = compute(value, 33);
+const value97635 = compute(value, 53);
+const value5018 = compute(value, 71);
+const value83764 = compute(value, 53);
+const v = process.env.BENCH_KEY_00857;
+const value60979 = compute(value, 63);
+const value89155 = compute(value, 12);
+// note 19726: keep this in sync with the handler
+// note 55706: keep this in sync with the handler
+const value75824 = compute(value, 67);
+const value33173 = compute(value, 96);
+const value65086 = compute(value, 96);
+const v = process.env["BENCH_KEY_00155"];
+const value4582 = compute(value, 23);
+const value89016 = compute(value, 67);
+const value43459 = compute(value, 3);
+const value94302 = compute(value, 18);
+const value10392 = compute(value, 13);
+const value25050 = compute(value, 24);
+// note 19595: keep this in sync with the handler
+const value8122 = compute(value, 71);
+// note 46257: keep this in sync with the handler
+const v = process.env.BENCH_KEY_01574;
+const value87242 = compute(value, 39);
+const value7497 = compute(value, 28);
+// note 84866: keep this in sync with the handler
+const value20095 = compute(value, 16);
+const value27983 = compute(value, 47);
+const value80638 = compute(value, 31);
+const value44053 = compute(value, 15);
+const value34501 = compute(value, 66);
+const v = process.env.BENCH_KEY_01934;
+// note 70868: keep this in sync with the handler
+const value75703 = compute(value, 43);
+// note 13755: keep this in sync with the handler
+// note 87317: keep this in sync with the handler
+const value96285 = compute(value, 61);
+const value69863 = compute(value, 23);
+const value61944 = compute(value, 58);
+const v = process.env.BENCH_KEY_00353;
+// note 23491: keep this in sync with the handler
+const value22181 = compute(value, 65);
+const value46959 = compute(value, 11);
+const value77359 = compute(value, 50);
+// note 19535: keep this in sync with the handler
+const value87470 = compute(value, 73);
+const value35168 = compute(value, 54);
+// note 1591: keep this in sync with the handler
+const value12696 = compute(value, 86);
+const value7424 = compute(value, 52);
+const value20465 = compute(value, 95);
+// note 85403: keep this in sync with the handler
+const value34201 = compute(value, 57);
+// note 33670: keep this in sync with the handler
+const value36700 = compute(value, 34);
+const v = process.env.BENCH_KEY_00240;
+const value403 = compute(value, 15);
+const value39681 = compute(value, 8);
+const value64535 = compute(value, 30);
+const value73007 = compute(value, 63);
+const value27511 = compute(value, 60);
+const value56205 = compute(value, 42);
+// note 16568: keep this in sync with the handler
+// note 93188: keep this in sync with the handler
+// note 55289: keep this in sync with the handler
+// note 1821: keep this in sync with the handler
+const value92108 = compute(value, 55);
+const value50565 = compute(value, 28);
+const value22210 = compute(value, 94);
+// note 98650: keep this in sync with the handler
+const value22323 = compute(value, 13);
+// note 75043: keep this in sync with the handler
+const v = process.env.BENCH_KEY_00917;
+const value33933 = compute(value, 80);
+const value70336 = compute(value, 11);
+const value17071 = compute(value, 96);
+const value46135 = compute(value, 60);
+const value9985 = compute(value, 91);
+const value6302 = compute(value, 94);
+const value92447 = compute(value, 6);
+const value23938 = compute(value, 76);
+// note 17334: keep this in sync with the handler
+const value11420 = compute(value, 71);
+const value9198 = compute(value, 80);
+const value89662 = compute(value, 34);
+const value87129 = compute(value, 23);
+const value95273 = compute(value, 19);
+const value89043 = compute(value, 94);
+const v = process.env["BENCH_KEY_01241"];
+const value87277 = compute(value, 74);
+const value396 = compute(value, 8);
+// note 38525: keep this in sync with the handler
+const value1075 = compute(value, 8);
+// note 84543: keep this in sync with the handler
+const value16300 = compute(value, 4);
+const value96811 = compute(value, 5);
+const value69417 = compute(value, 62);
+const value62716 = compute(value, 54);
+const value55038 = compute(value, 39);
+const v = process.env.BENCH_KEY_00673;
+// note 56738: keep this in sync with the handler
+const value19813 = compute(value, 25);
+const value29300 = compute(value, 6);
+const value73736 = compute(value, 16);
+const value66982 = compute(value, 52);
+const value3265 = compute(value, 64);
+const value16998 = compute(value, 23);
+const value36938 = compute(value, 78);
+const value50544 = compute(value, 7);
+const value37779 = compute(value, 46);
+const value47388 = compute(value, 52);
+const value57056 = compute(value, 20);
+const v = process.env["BENCH_KEY_00741"];
+const value7281 = compute(value, 6);
+const value92102 = compute(value, 49);
+const value9497 = compute(value, 88);
+const value78504 = compute(value, 31);
+const value64055 = compute(value, 35);
+const value14241 = compute(value, 79);
+// note 55694: keep this in sync with the handler
+const value91103 = compute(value, 20);
+const value5389 = compute(value, 54);
+const value71922 = compute(value, 45);
+const value40574 = compute(value, 28);
+const value13252 = compute(value, 60);
+const value79860 = compute(value, 29);
+const value5952 = compute(value, 35);
+const value19528 = compute(value, 31);
+const value9139 = compute(value, 21);
+const value86584 = compute(value, 60);
+const value82791 = compute(value, 50);
+const value59070 = compute(value, 94);
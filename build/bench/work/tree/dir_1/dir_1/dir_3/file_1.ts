@@ -0,0 +1,203 @@
+// note 62614: keep this in sync with the handler
+// note 71031: keep this in sync with the handler
+const value39298 = compute(value, 13);
+const value61284 = compute(value, 77);
+const value7231 = compute(value, 53);
+const value73565 = compute(value, 39);
+const value54398 = compute(value, 78);
+const value96801 = compute(value, 92);
+const value96940 = compute(value, 37);
+const value15268 = compute(value, 39);
+const value84399 = compute(value, 9);
+const value73361 = compute(value, 29);
+const v = import.meta.env.BENCH_KEY_00481;
+// note 69405: keep this in sync with the handler
+const value55831 = compute(value, 56);
+const value25595 = compute(value, 84);
+const value59410 = compute(value, 46);
+const value26659 = compute(value, 81);
+const value98778 = compute(value, 32);
+const value96679 = compute(value, 67);
+const value42535 = compute(value, 49);
+const value97581 = compute(value, 96);
+const value74377 = compute(value, 75);
+// note 12892: keep this in sync with the handler
+const value52165 = compute(value, 76);
+const v = import.meta.env.BENCH_KEY_01980;
+const value20589 = compute(value, 25);
+const value85753 = compute(value, 5);
+const value32669 = compute(value, 77);
+const value27650 = compute(value, 5);
+const value15680 = compute(value, 63);
+const value9256 = compute(value, 41);
+// note 25723: keep this in sync with the handler
+const value6769 = compute(value, 76);
+const value19085 = compute(value, 73);
+const v = process.env["BENCH_KEY_00753"];
+const value35939 = compute(value, 49);
+const value12950 = compute(value, 49);
+// note 88354: keep this in sync with the handler
+const value69518 = compute(value, 66);
+const value37021 = compute(value, 64);
+const value52665 = compute(value, 91);
+const value65109 = compute(value, 22);
+const value42262 = compute(value, 67);
+const value54036 = compute(value, 7);
+const value58891 = compute(value, 12);
+const value69051 = compute(value, 84);
+const value35980 = compute(value, 90);
+const v = process.env["BENCH_KEY_00773"];
+const value82261 = compute(value, 5);
+const value29483 = compute(value, 92);
+const value36655 = compute(value, 86);
+const value87180 = compute(value, 74);
+const value55330 = compute(value, 40);
+const value19950 = compute(value, 65);
+const value93059 = compute(value, 36);
+const value1268 = compute(value, 7);
+const value72324 = compute(value, 59);
+const value47096 = compute(value, 51);
+const value86003 = compute(value, 61);
+const value94845 = compute(value, 76);
+const v = import.meta.env.BENCH_KEY_01845;
+const value34132 = compute(value, 85);
+const value64501 = compute(value, 93);
+const value40868 = compute(value, 31);
+const value8557 = compute(value, 21);
+// note 35643: keep this in sync with the handler
+const value76649 = compute(value, 19);
+const value53507 = compute(value, 60);
+const value69268 = compute(value, 10);
+const v = import.meta.env.BENCH_KEY_01876;
+const value51979 = compute(value, 84);
+const value40296 = compute(value, 41);
+// note 48073: keep this in sync with the handler
+const value59157 = compute(value, 84);
+// note 90497: keep this in sync with the handler
+const value3556 = compute(value, 64);
+const value7675 = compute(value, 12);
+const value57216 = compute(value, 83);
+const value59057 = compute(value, 81);
+const value81863 = compute(value, 92);
+const value98473 = compute(value, 18);
+const value67713 = compute(value, 7);
+const v = process.env.BENCH_KEY_00156;
+const value34970 = compute(value, 50);
+const value62082 = compute(value, 2);
+const value40390 = compute(value, 38);
+const value20585 = compute(value, 21);
+const value79986 = compute(value, 58);
+const value82231 = compute(value, 72);
+const value17333 = compute(value, 67);
+const value85829 = compute(value, 81);
+const value27999 = compute(value, 63);
+const value66638 = compute(value, 96);
+const value87865 = compute(value, 80);
+const value13781 = compute(value, 7);
+const value13395 = compute(value, 9);
+const value12940 = compute(value, 39);
+const value14252 = compute(value, 90);
+const v = import.meta.env.BENCH_KEY_00120;
+const value32973 = compute(value, 90);
+const value11826 = compute(value, 89);
+const value47284 = compute(value, 45);
+const value76232 = compute(value, 87);
+const value83608 = compute(value, 91);
+const value10981 = compute(value, 20);
+const value25688 = compute(value, 80);
+// note 29619: keep this in sync with the handler
+const value52099 = compute(value, 10);
+const value62593 = compute(value, 28);
+const value55635 = compute(value, 54);
+const value57073 = compute(value, 37);
+const value72452 = compute(value, 90);
+const value91674 = compute(value, 9);
+const value64465 = compute(value, 57);
+const value857 = compute(value, 81);
+// note 92255: keep this in sync with the handler
+// note 94113: keep this in sync with the handler
+const v = import.meta.env.BENCH_KEY_00408;
+// note 21965: keep this in sync with the handler
+const value4678 = compute(value, 22);
+const value50876 = compute(value, 48);
+const value76577 = compute(value, 44);
+const value14895 = compute(value, 54);
+const value96413 = compute(value, 92);
+const value88221 = compute(value, 48);
+const value49498 = compute(value, 28);
+const value60081 = compute(value, 38);
+const value86670 = compute(value, 49);
+const value20916 = compute(value, 61);
+const value13781 = compute(value, 7);
+const value79804 = compute(value, 70);
+const value94344 = compute(value, 60);
+const v = process.env.BENCH_KEY_00916;
+const value15339 = compute(value, 13);
+const value55577 = compute(value, 93);
+const value76766 = compute(value, 39);
+const value41932 = compute(value, 28);
+const value51345 = compute(value, 32);
+const value33912 = compute(value, 59);
+// note 62612: keep this in sync with the handler
+const v = process.env["BENCH_KEY_01451"];
+const value47214 = compute(value, 72);
+const value44070 = compute(value, 32);
+const value71409 = compute(value, 17);
+const value50578 = compute(value, 41);
+const value10682 = compute(value, 12);
+// note 7114: keep this in sync with the handler
+// note 13553: keep this in sync with the handler
+const value93305 = compute(value, 88);
+const value45377 = compute(value, 78);
+const value11212 = compute(value, 57);
+// note 49565: keep this in sync with the handler
+const value95065 = compute(value, 5);
+const v = process.env["BENCH_KEY_00883"];
+const value69800 = compute(value, 57);
+// note 86158: keep this in sync with the handler
+const value19925 = compute(value, 40);
+const value32234 = compute(value, 30);
+// note 36238: keep this in sync with the handler
+const value79697 = compute(value, 60);
+const value65650 = compute(value, 78);
+const value8279 = compute(value, 34);
+const value94242 = compute(value, 55);
+const v = process.env.BENCH_KEY_01939;
+const value7892 = compute(value, 35);
+const value19233 = compute(value, 27);
+const value41681 = compute(value, 68);
+const value73203 = compute(value, 65);
+const value42294 = compute(value, 2);
+const value24403 = compute(value, 56);
+const value43231 = compute(value, 66);
+const value29331 = compute(value, 37);
+const value46112 = compute(value, 37);
+const v = process.env["BENCH_KEY_00749"];
+const value79939 = compute(value, 11);
+// note 61466: keep this in sync with the handler
+// note 18796: keep this in sync with the handler
+const value18815 = compute(value, 94);
+const value36702 = compute(value, 36);
+const value16866 = compute(value, 85);
+const value50018 = compute(value, 63);
+const value53205 = compute(value, 49);
+const value93665 = compute(value, 60);
+const value39316 = compute(value, 31);
+const value446 = compute(value, 58);
+const v = import.meta.env.BENCH_KEY_01983;
+// note 88234: keep this in sync with the handler
+const value5029 = compute(value, 82);
+const value48928 = compute(value, 40);
+const value78207 = compute(value, 25);
+const value70597 = compute(value, 78);
+const value75641 = compute(value, 78);
+const value21318 = compute(value, 75);
+const value41937 = compute(value, 33);
+const v = import.meta.env.BENCH_KEY_01463;
+// note 26778: keep this in sync with the handler
+const value63455 = compute(value, 17);
+const value68784 = compute(value, 11);
+const value8031 = compute(value, 77);
+const value7769 = compute(value, 9);
+const value3331 = compute(value, 33);
+// note 33714: keep this in sync with the handler
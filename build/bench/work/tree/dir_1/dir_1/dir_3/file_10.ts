@@ -0,0 +1,204 @@
+const value31631 = compute(value, 9);
+const value70223 = compute(value, 92);
+const value6898 = compute(value, 11);
+const value86538 = compute(value, 14);
+const value4251 = compute(value, 80);
+const value14877 = compute(value, 36);
+const v = process.env["BENCH_KEY_01569"];
+const value16748 = compute(value, 64);
+const value82537 = compute(value, 87);
+const value72664 = compute(value, 11);
+// note 71370: keep this in sync with the handler
+const value78935 = compute(value, 74);
+// note 81427: keep this in sync with the handler
+const value60158 = compute(value, 18);
+// note 38552: keep this in sync with the handler
+const value86664 = compute(value, 43);
+const value23553 = compute(value, 79);
+const value65246 = compute(value, 62);
+const value41366 = compute(value, 44);
+const value88323 = compute(value, 53);
+// note 80176: keep this in sync with the handler
+const value96611 = compute(value, 96);
+const value22788 = compute(value, 90);
+const v = import.meta.env.BENCH_KEY_01513;
+const value31492 = compute(value, 64);
+const value92026 = compute(value, 70);
+const value76374 = compute(value, 35);
+const value89356 = compute(value, 19);
+const value29879 = compute(value, 3);
+const value37089 = compute(value, 35);
+// note 81477: keep this in sync with the handler
+const value35057 = compute(value, 40);
+const value70799 = compute(value, 86);
+const value35019 = compute(value, 2);
+const value80109 = compute(value, 84);
+const value30140 = compute(value, 70);
+const value94606 = compute(value, 31);
+const value33236 = compute(value, 62);
+// note 57457: keep this in sync with the handler
+const v = import.meta.env.BENCH_KEY_01006;
+const value20602 = compute(value, 38);
+const value31439 = compute(value, 11);
+const value65807 = compute(value, 41);
+const value59702 = compute(value, 47);
+const value90316 = compute(value, 9);
+const value11895 = compute(value, 61);
+const value23306 = compute(value, 26);
+// note 73064: keep this in sync with the handler
+const value1021 = compute(value, 51);
+const value81425 = compute(value, 42);
+const value73587 = compute(value, 61);
+const value67703 = compute(value, 94);
+const v = process.env["BENCH_KEY_00545"];
+const value94727 = compute(value, 55);
+const value73222 = compute(value, 84);
+const value34511 = compute(value, 76);
+// note 23519: keep this in sync with the handler
+const value94686 = compute(value, 14);
+const value40531 = compute(value, 82);
+const value43519 = compute(value, 63);
+// note 16605: keep this in sync with the handler
+const value24185 = compute(value, 32);
+const value4086 = compute(value, 12);
+const value12619 = compute(value, 9);
+const value24115 = compute(value, 59);
+const v = import.meta.env.BENCH_KEY_01229;
+const value62194 = compute(value, 17);
+const value72805 = compute(value, 55);
+const value11136 = compute(value, 78);
+const value99207 = compute(value, 73);
+const value21556 = compute(value, 22);
+const value80540 = compute(value, 30);
+const value10438 = compute(value, 59);
+const value16039 = compute(value, 34);
+const value32684 = compute(value, 92);
+const value9415 = compute(value, 6);
+const value36740 = compute(value, 74);
+const value70616 = compute(value, 0);
+const value56429 = compute(value, 72);
+const value9979 = compute(value, 85);
+const value63472 = compute(value, 34);
+const value14406 = compute(value, 50);
+// note 9626: keep this in sync with the handler
+const v = process.env["BENCH_KEY_00707"];
+const value31624 = compute(value, 2);
+const value25053 = compute(value, 27);
+const value66651 = compute(value, 12);
+const value10198 = compute(value, 13);
+const value45133 = compute(value, 28);
+const value59368 = compute(value, 4);
+const value94055 = compute(value, 62);
+// note 33096: keep this in sync with the handler
+const value40486 = compute(value, 37);
+const value60366 = compute(value, 32);
+const value10308 = compute(value, 26);
+const value42967 = compute(value, 93);
+const value98168 = compute(value, 4);
+const value43364 = compute(value, 5);
+// note 56998: keep this in sync with the handler
+const value76 = compute(value, 76);
+const v = process.env["BENCH_KEY_01429"];
+const value49856 = compute(value, 95);
+const value78218 = compute(value, 36);
+const value78103 = compute(value, 18);
+const value37529 = compute(value, 87);
+const value47735 = compute(value, 11);
+const value50791 = compute(value, 60);
+const value37762 = compute(value, 29);
+const value64203 = compute(value, 86);
+// note 61016: keep this in sync with the handler
+const v = process.env.BENCH_KEY_01367;
+// note 17351: keep this in sync with the handler
+const value46558 = compute(value, 95);
+const value26202 = compute(value, 12);
+const value31285 = compute(value, 51);
+const value91218 = compute(value, 38);
+const value66318 = compute(value, 67);
+const value83396 = compute(value, 73);
+const value20008 = compute(value, 26);
+const value29504 = compute(value, 16);
+const value96603 = compute(value, 88);
+const value28682 = compute(value, 67);
+const value72354 = compute(value, 89);
+const value60289 = compute(value, 52);
+const value49557 = compute(value, 87);
+const value65099 = compute(value, 12);
+const value62726 = compute(value, 64);
+const value80805 = compute(value, 4);
+const v = process.env.BENCH_KEY_01272;
+const value67897 = compute(value, 94);
+const value30451 = compute(value, 90);
+const value37851 = compute(value, 21);
+// note 51095: keep this in sync with the handler
+const value49900 = compute(value, 42);
+const value9595 = compute(value, 89);
+// note 47051: keep this in sync with the handler
+const value84082 = compute(value, 80);
+const value51055 = compute(value, 33);
+const value18695 = compute(value, 71);
+const value27032 = compute(value, 66);
+const value20578 = compute(value, 14);
+const v = process.env.BENCH_KEY_00881;
+// note 84322: keep this in sync with the handler
+// note 79717: keep this in sync with the handler
+// note 19262: keep this in sync with the handler
+const value79408 = compute(value, 62);
+const value90940 = compute(value, 51);
+const value38180 = compute(value, 59);
+const value83994 = compute(value, 89);
+// note 17848: keep this in sync with the handler
+const value69043 = compute(value, 76);
+const value96247 = compute(value, 23);
+const value16152 = compute(value, 50);
+const value74447 = compute(value, 48);
+const value38550 = compute(value, 41);
+const v = process.env["BENCH_KEY_01993"];
+const value76997 = compute(value, 76);
+const value93085 = compute(value, 62);
+const value47214 = compute(value, 72);
+const value58542 = compute(value, 51);
+const value47797 = compute(value, 73);
+const value68652 = compute(value, 73);
+const value3364 = compute(value, 66);
+// note 17070: keep this in sync with the handler
+const value4422 = compute(value, 57);
+// note 89485: keep this in sync with the handler
+const value91332 = compute(value, 55);
+const value99358 = compute(value, 30);
+const value50946 = compute(value, 21);
+const value86001 = compute(value, 59);
+const value81785 = compute(value, 14);
+const value183 = compute(value, 86);
+const value73110 = compute(value, 69);
+const v = process.env.BENCH_KEY_00342;
+const value39651 = compute(value, 75);
+const value99107 = compute(value, 70);
+const value14822 = compute(value, 78);
+const value49669 = compute(value, 5);
+const value44505 = compute(value, 79);
+const value57249 = compute(value, 19);
+const value9966 = compute(value, 72);
+const value7328 = compute(value, 53);
+const value5510 = compute(value, 78);
+const value20433 = compute(value, 63);
+const value44909 = compute(value, 95);
+const value31931 = compute(value, 18);
+const value79125 = compute(value, 70);
+const value71036 = compute(value, 32);
+const value1821 = compute(value, 75);
+const value69238 = compute(value, 77);
+const v = process.env["BENCH_KEY_00530"];
+const value29762 = compute(value, 80);
+const value33669 = compute(value, 10);
+// note 99062: keep this in sync with the handler
+const value88748 = compute(value, 90);
+const value3514 = compute(value, 22);
+const value1953 = compute(value, 13);
+const value57821 = compute(value, 9);
+const value52917 = compute(value, 52);
+const v = process.env.BENCH_KEY_00041;
+const value83063 = compute(value, 31);
+const value53776 = compute(value, 38);
+const value7788 = compute(value, 28);
+// note 36076: keep this in sync with the handler
@@ -0,0 +1,213 @@
+// note 63746: keep this in sync with the handler
+let value42069 = compute(value, 68);
+let value68837 = compute(value, 64);
+let value8364 = compute(value, 22);
+let value83698 = compute(value, 84);
+let value99969 = compute(value, 59);
+const v = env::var_os("BENCH_KEY_01376");
+let value59799 = compute(value, 47);
+// note 9368: keep this in sync with the handler
+let value23350 = compute(value, 70);
+let value28101 = compute(value, 68);
+let value80369 = compute(value, 53);
+let value78384 = compute(value, 8);
+let value2235 = compute(value, 4);
+let value98185 = compute(value, 21);
+let value70485 = compute(value, 63);
+let value45544 = compute(value, 51);
+let value21791 = compute(value, 63);
+let value77663 = compute(value, 63);
+let value88430 = compute(value, 63);
+const v = env::var("BENCH_KEY_00485");
+let value24736 = compute(value, 1);
+let value45872 = compute(value, 88);
+let value73118 = compute(value, 77);
+let value10582 = compute(value, 9);
+let value48383 = compute(value, 77);
+let value99675 = compute(value, 56);
+let value36577 = compute(value, 8);
+// note 50363: keep this in sync with the handler
+let value90723 = compute(value, 28);
+// note 22643: keep this in sync with the handler
+let value28609 = compute(value, 91);
+let value65477 = compute(value, 2);
+let value74853 = compute(value, 66);
+let value50026 = compute(value, 71);
+const v = env::var("BENCH_KEY_01250");
+let value49021 = compute(value, 36);
+let value55212 = compute(value, 19);
+let value522 = compute(value, 37);
+let value79295 = compute(value, 46);
+let value38881 = compute(value, 81);
+// note 95616: keep this in sync with the handler
+// note 968: keep this in sync with the handler
+let value56498 = compute(value, 44);
+let value32566 = compute(value, 71);
+let value8518 = compute(value, 79);
+// note 66923: keep this in sync with the handler
+let value44188 = compute(value, 53);
+let value6335 = compute(value, 30);
+let value52074 = compute(value, 82);
+// note 82848: keep this in sync with the handler
+const v = env::var("BENCH_KEY_01452");
+let value9181 = compute(value, 63);
+let value89548 = compute(value, 17);
+let value35937 = compute(value, 47);
+let value3551 = compute(value, 59);
+let value45937 = compute(value, 56);
+let value92841 = compute(value, 12);
+let value65363 = compute(value, 82);
+let value39425 = compute(value, 43);
+// note 63087: keep this in sync with the handler
+const v = env::var_os("BENCH_KEY_01792");
+let value97468 = compute(value, 80);
+let value63326 = compute(value, 82);
+let value15023 = compute(value, 85);
+// note 78346: keep this in sync with the handler
+let value72354 = compute(value, 89);
+let value34643 = compute(value, 14);
+let value9088 = compute(value, 67);
+let value34207 = compute(value, 63);
+let value23626 = compute(value, 55);
+let value18476 = compute(value, 46);
+let value24574 = compute(value, 33);
+let value92608 = compute(value, 70);
+let value21048 = compute(value, 96);
+let value44809 = compute(value, 92);
+let value63424 = compute(value, 83);
+let value71686 = compute(value, 3);
+const v = env::var_os("BENCH_KEY_01420");
+let value93901 = compute(value, 5);
+let value20023 = compute(value, 41);
+let value56894 = compute(value, 52);
+let value72021 = compute(value, 47);
+// note 42570: keep this in sync with the handler
+let value55644 = compute(value, 63);
+// note 99530: keep this in sync with the handler
+let value40733 = compute(value, 90);
+let value29736 = compute(value, 54);
+let value93366 = compute(value, 52);
+let value30067 = compute(value, 94);
+let value9608 = compute(value, 5);
+let value52342 = compute(value, 59);
+let value4524 = compute(value, 62);
+let value69449 = compute(value, 94);
+const v = env::var_os("BENCH_KEY_01587");
+let value89131 = compute(value, 85);
+let value26939 = compute(value, 70);
+// note 12754: keep this in sync with the handler
+let value7864 = compute(value, 7);
+let value50725 = compute(value, 91);
+// note 60003: keep this in sync with the handler
+// note 70678: keep this in sync with the handler
+let value80782 = compute(value, 78);
+let value71074 = compute(value, 70);
+let value87141 = compute(value, 35);
+let value56213 = compute(value, 50);
+let value36550 = compute(value, 78);
+let value65321 = compute(value, 40);
+let value26343 = compute(value, 56);
+const v = env::var("BENCH_KEY_01049");
+let value86189 = compute(value, 53);
+let value70820 = compute(value, 10);
+// note 74193: keep this in sync with the handler
+let value95302 = compute(value, 48);
+let value66990 = compute(value, 60);
+let value17611 = compute(value, 54);
+let value51003 = compute(value, 78);
+// note 75794: keep this in sync with the handler
+// note 2794: keep this in sync with the handler
+let value5362 = compute(value, 27);
+let value74249 = compute(value, 44);
+let value92987 = compute(value, 61);
+let value19649 = compute(value, 55);
+let value45881 = compute(value, 0);
+let value43391 = compute(value, 32);
+let value65510 = compute(value, 35);
+// note 525: keep this in sync with the handler
+const v = env::var("BENCH_KEY_00882");
+let value68405 = compute(value, 20);
+// note 37852: keep this in sync with the handler
+let value47617 = compute(value, 87);
+let value44948 = compute(value, 37);
+let value7447 = compute(value, 75);
+let value48976 = compute(value, 88);
+let value15461 = compute(value, 38);
+let value52789 = compute(value, 21);
+const v = env::var("BENCH_KEY_00024");
+let value18259 = compute(value, 23);
+let value94198 = compute(value, 11);
+let value68094 = compute(value, 0);
+let value48613 = compute(value, 16);
+let value1504 = compute(value, 49);
+let value89581 = compute(value, 50);
+let value45157 = compute(value, 52);
+let value17602 = compute(value, 45);
+let value36254 = compute(value, 73);
+let value23576 = compute(value, 5);
+let value45151 = compute(value, 46);
+let value64683 = compute(value, 81);
+let value26030 = compute(value, 34);
+let value93856 = compute(value, 57);
+let value98771 = compute(value, 25);
+let value94741 = compute(value, 69);
+let value84158 = compute(value, 59);
+let value5762 = compute(value, 39);
+let value24262 = compute(value, 12);
+let value71093 = compute(value, 89);
+const v = env::var("BENCH_KEY_01849");
+let value63163 = compute(value, 16);
+let value94738 = compute(value, 66);
+let value63443 = compute(value, 5);
+let value4648 = compute(value, 89);
+let value71702 = compute(value, 19);
+let value90234 = compute(value, 24);
+let value18416 = compute(value, 83);
+let value31883 = compute(value, 67);
+let value17439 = compute(value, 76);
+let value68163 = compute(value, 69);
+let value5886 = compute(value, 66);
+// note 49841: keep this in sync with the handler
+let value45143 = compute(value, 38);
+let value23055 = compute(value, 66);
+let value18315 = compute(value, 79);
+let value79482 = compute(value, 39);
+const v = env::var("BENCH_KEY_01752");
+let value31842 = compute(value, 26);
+let value30105 = compute(value, 35);
+let value98217 = compute(value, 53);
+let value20982 = compute(value, 30);
+let value1161 = compute(value, 94);
+let value94054 = compute(value, 61);
+let value41383 = compute(value, 61);
+let value41541 = compute(value, 25);
+let value41909 = compute(value, 5);
+let value62942 = compute(value, 86);
+let value86911 = compute(value, 96);
+let value31988 = compute(value, 75);
+let value35881 = compute(value, 88);
+let value59894 = compute(value, 45);
+let value97107 = compute(value, 10);
+let value55769 = compute(value, 91);
+let value7244 = compute(value, 66);
+let value94577 = compute(value, 2);
+const v = env::var_os("BENCH_KEY_01062");
+let value2164 = compute(value, 30);
+let value60388 = compute(value, 54);
+// note 87455: keep this in sync with the handler
+// note 52536: keep this in sync with the handler
+// note 92461: keep this in sync with the handler
+let value17859 = compute(value, 11);
+let value16748 = compute(value, 64);
+let value6292 = compute(value, 84);
+let value79841 = compute(value, 10);
+let value50495 = compute(value, 55);
+let value51200 = compute(value, 81);
+let value59518 = compute(value, 57);
+let value58163 = compute(value, 60);
+let value8696 = compute(value, 63);
+let value54979 = compute(value, 77);
+let value32903 = compute(value, 20);
+let value9011 = compute(value, 87);
+const v = env::var_os("BENCH_KEY_00867");
+// note 74209: keep this in sync with the handler
@@ -0,0 +1,237 @@
+value84254 = compute(value, 58)
+value79914 = compute(value, 83)
+value36434 = compute(value, 59)
+value33001 = compute(value, 21)
+value19797 = compute(value, 9)
+value86841 = compute(value, 26)
+value39138 = compute(value, 47)
+const v = os.getenv("BENCH_KEY_00346");
+# note 22200: keep this in sync with the handler
+value76697 = compute(value, 67)
+value37312 = compute(value, 64)
+value48975 = compute(value, 87)
+value4315 = compute(value, 47)
+value30030 = compute(value, 57)
+value90580 = compute(value, 79)
+value75195 = compute(value, 20)
+# note 59593: keep this in sync with the handler
+value67724 = compute(value, 18)
+value94956 = compute(value, 90)
+value35235 = compute(value, 24)
+value30497 = compute(value, 39)
+# note 69950: keep this in sync with the handler
+value45264 = compute(value, 62)
+value32131 = compute(value, 24)
+value98919 = compute(value, 76)
+value59132 = compute(value, 59)
+value6465 = compute(value, 63)
+const v = os.environ["BENCH_KEY_00606"];
+value89144 = compute(value, 1)
+value78238 = compute(value, 56)
+value45540 = compute(value, 47)
+value99302 = compute(value, 71)
+value62698 = compute(value, 36)
+value18585 = compute(value, 58)
+value9936 = compute(value, 42)
+# note 13289: keep this in sync with the handler
+value90535 = compute(value, 34)
+value91063 = compute(value, 77)
+value229 = compute(value, 35)
+# note 68427: keep this in sync with the handler
+value88795 = compute(value, 40)
+value41335 = compute(value, 13)
+value732 = compute(value, 53)
+value32487 = compute(value, 89)
+value51596 = compute(value, 89)
+value8421 = compute(value, 79)
+value88664 = compute(value, 6)
+value35385 = compute(value, 77)
+value95709 = compute(value, 67)
+value73043 = compute(value, 2)
+value94766 = compute(value, 94)
+const v = os.getenv("BENCH_KEY_00464");
+value48024 = compute(value, 9)
+value64969 = compute(value, 76)
+# note 81805: keep this in sync with the handler
+value93865 = compute(value, 66)
+value54561 = compute(value, 47)
+value5137 = compute(value, 93)
+# note 52732: keep this in sync with the handler
+value40856 = compute(value, 19)
+value72151 = compute(value, 80)
+value89713 = compute(value, 85)
+value85335 = compute(value, 72)
+value47124 = compute(value, 79)
+value91513 = compute(value, 42)
+value7943 = compute(value, 86)
+value7000 = compute(value, 16)
+value9313 = compute(value, 1)
+value72209 = compute(value, 41)
+value65505 = compute(value, 30)
+value73415 = compute(value, 83)
+value82574 = compute(value, 27)
+value76540 = compute(value, 7)
+value4373 = compute(value, 8)
+value18722 = compute(value, 1)
+const v = os.environ["BENCH_KEY_01053"];
+value63574 = compute(value, 39)
+value89115 = compute(value, 69)
+value771 = compute(value, 92)
+value67886 = compute(value, 83)
+value65329 = compute(value, 48)
+value335 = compute(value, 44)
+value81876 = compute(value, 8)
+# note 27683: keep this in sync with the handler
+value63712 = compute(value, 80)
+value59383 = compute(value, 19)
+value42931 = compute(value, 57)
+const v = os.environ["BENCH_KEY_01726"];
+value95297 = compute(value, 43)
+value61953 = compute(value, 67)
+# note 24283: keep this in sync with the handler
+# note 96012: keep this in sync with the handler
+value33982 = compute(value, 32)
+value93844 = compute(value, 45)
+value71795 = compute(value, 15)
+# note 46570: keep this in sync with the handler
+# note 29710: keep this in sync with the handler
+value97752 = compute(value, 73)
+value56132 = compute(value, 66)
+value38046 = compute(value, 22)
+const v = os.environ.get('BENCH_KEY_01326');
+value31264 = compute(value, 30)
+value31836 = compute(value, 20)
+value35313 = compute(value, 5)
+value88335 = compute(value, 65)
+value24231 = compute(value, 78)
+value51769 = compute(value, 68)
+value89744 = compute(value, 19)
+value97174 = compute(value, 77)
+value77551 = compute(value, 48)
+value44982 = compute(value, 71)
+value92627 = compute(value, 89)
+value32171 = compute(value, 64)
+value44720 = compute(value, 3)
+# note 19056: keep this in sync with the handler
+const v = os.getenv("BENCH_KEY_00365");
+value81984 = compute(value, 19)
+value47892 = compute(value, 71)
+value44728 = compute(value, 11)
+value72565 = compute(value, 9)
+value51445 = compute(value, 35)
+value96864 = compute(value, 58)
+# note 55869: keep this in sync with the handler
+value37508 = compute(value, 66)
+# note 73174: keep this in sync with the handler
+value87462 = compute(value, 65)
+# note 27951: keep this in sync with the handler
+value64062 = compute(value, 42)
+value32145 = compute(value, 38)
+value81008 = compute(value, 13)
+value12578 = compute(value, 65)
+# note 9862: keep this in sync with the handler
+const v = os.environ["BENCH_KEY_00413"];
+# note 19237: keep this in sync with the handler
+value64888 = compute(value, 92)
+value17129 = compute(value, 57)
+value83463 = compute(value, 43)
+# note 47559: keep this in sync with the handler
+value91851 = compute(value, 89)
+value78327 = compute(value, 48)
+value21983 = compute(value, 61)
+value67041 = compute(value, 14)
+value91236 = compute(value, 56)
+value45927 = compute(value, 46)
+value45910 = compute(value, 29)
+value17465 = compute(value, 5)
+value59396 = compute(value, 32)
+value91786 = compute(value, 24)
+# note 38997: keep this in sync with the handler
+const v = os.environ["BENCH_KEY_00469"];
+value89722 = compute(value, 94)
+value93011 = compute(value, 85)
+value30296 = compute(value, 32)
+value42336 = compute(value, 44)
+value51614 = compute(value, 10)
+value66480 = compute(value, 35)
+value70613 = compute(value, 94)
+value65309 = compute(value, 28)
+value55324 = compute(value, 34)
+value82755 = compute(value, 14)
+value36104 = compute(value, 20)
+value36071 = compute(value, 84)
+value34736 = compute(value, 10)
+value26977 = compute(value, 11)
+# note 60982: keep this in sync with the handler
+value56131 = compute(value, 65)
+value25392 = compute(value, 75)
+value26617 = compute(value, 39)
+value25961 = compute(value, 62)
+value34865 = compute(value, 42)
+const v = os.getenv("BENCH_KEY_00623");
+# note 90624: keep this in sync with the handler
+value11157 = compute(value, 2)
+# note 12274: keep this in sync with the handler
+value19384 = compute(value, 81)
+value50509 = compute(value, 69)
+# note 61844: keep this in sync with the handler
+value87749 = compute(value, 61)
+value141 = compute(value, 44)
+value75788 = compute(value, 31)
+value96865 = compute(value, 59)
+value64535 = compute(value, 30)
+value57965 = compute(value, 56)
+value40997 = compute(value, 63)
+const v = os.environ["BENCH_KEY_01633"];
+value58580 = compute(value, 89)
+value44960 = compute(value, 49)
+value75499 = compute(value, 33)
+value35037 = compute(value, 20)
+value37371 = compute(value, 26)
+value31341 = compute(value, 10)
+# note 46575: keep this in sync with the handler
+# note 18243: keep this in sync with the handler
+value32041 = compute(value, 31)
+value50437 = compute(value, 94)
+value33218 = compute(value, 44)
+value71577 = compute(value, 88)
+value32677 = compute(value, 85)
+value71446 = compute(value, 54)
+value42088 = compute(value, 87)
+value2015 = compute(value, 75)
+# note 70198: keep this in sync with the handler
+value70469 = compute(value, 47)
+const v = os.environ["BENCH_KEY_00760"];
+value54375 = compute(value, 55)
+value80835 = compute(value, 34)
+value17116 = compute(value, 44)
+value26374 = compute(value, 87)
+value59402 = compute(value, 38)
+# note 16909: keep this in sync with the handler
+value4386 = compute(value, 21)
+value91647 = compute(value, 79)
+# note 59375: keep this in sync with the handler
+value429 = compute(value, 41)
+const v = os.environ.get('BENCH_KEY_01176');
+value42483 = compute(value, 94)
+# note 13689: keep this in sync with the handler
+value27941 = compute(value, 5)
+value88846 = compute(value, 91)
+value54049 = compute(value, 20)
+value96210 = compute(value, 83)
+value1813 = compute(value, 67)
+value59507 = compute(value, 46)
+value5682 = compute(value, 56)
+const v = os.environ.get('BENCH_KEY_01244');
+value67046 = compute(value, 19)
+value72873 = compute(value, 26)
+# note 60730: keep this in sync with the handler
+value31519 = compute(value, 91)
+value6422 = compute(value, 20)
+value11089 = compute(value, 31)
+value41524 = compute(value, 8)
+value77712 = compute(value, 15)
+value59432 = compute(value, 68)
+# note 10425: keep this in sync with the handler
+value55358 = compute(value, 68)
+value12648 = compute(value, 38)
@@ -0,0 +1,204 @@
+// note 96784: keep this in sync with the handler
+const value77778 = compute(value, 81);
+const value69403 = compute(value, 48);
+const value92876 = compute(value, 47);
+const value55059 = compute(value, 60);
+const value25873 = compute(value, 71);
+const value4675 = compute(value, 19);
+const value67038 = compute(value, 11);
+const v = import.meta.env.BENCH_KEY_00851;
+const value94628 = compute(value, 53);
+const value13703 = compute(value, 26);
+const value95714 = compute(value, 72);
+// note 22917: keep this in sync with the handler
+const value93836 = compute(value, 37);
+const value54321 = compute(value, 1);
+const value46554 = compute(value, 91);
+const value87738 = compute(value, 50);
+const v = process.env["BENCH_KEY_00199"];
+const value24279 = compute(value, 29);
+const value64912 = compute(value, 19);
+const value40485 = compute(value, 36);
+const value87730 = compute(value, 42);
+// note 99967: keep this in sync with the handler
+// note 5783: keep this in sync with the handler
+const value55283 = compute(value, 90);
+const value28942 = compute(value, 36);
+const value87261 = compute(value, 58);
+const value99948 = compute(value, 38);
+// note 4074: keep this in sync with the handler
+const value54170 = compute(value, 44);
+const value83385 = compute(value, 62);
+const value91483 = compute(value, 12);
+const value20161 = compute(value, 82);
+// note 68959: keep this in sync with the handler
+const v = process.env.BENCH_KEY_00648;
+const value42531 = compute(value, 45);
+const value52747 = compute(value, 76);
+const value79933 = compute(value, 5);
+const value91650 = compute(value, 82);
+const value7736 = compute(value, 73);
+const value3068 = compute(value, 61);
+const value40937 = compute(value, 3);
+const value22195 = compute(value, 79);
+const value80035 = compute(value, 10);
+// note 80739: keep this in sync with the handler
+const value80042 = compute(value, 17);
+const value80282 = compute(value, 63);
+const value60758 = compute(value, 36);
+const value20086 = compute(value, 7);
+const value31599 = compute(value, 74);
+const value96575 = compute(value, 60);
+// note 73015: keep this in sync with the handler
+const value3849 = compute(value, 66);
+const v = process.env["BENCH_KEY_01042"];
+const value66493 = compute(value, 48);
+const value89874 = compute(value, 52);
+const value96794 = compute(value, 85);
+const value98648 = compute(value, 96);
+const value91793 = compute(value, 31);
+// note 13641: keep this in sync with the handler
+const value57034 = compute(value, 95);
+const value47768 = compute(value, 44);
+const value32522 = compute(value, 27);
+const v = process.env["BENCH_KEY_00133"];
+const value86866 = compute(value, 51);
+const value31047 = compute(value, 7);
+const value63275 = compute(value, 31);
+const value15148 = compute(value, 16);
+const value73179 = compute(value, 41);
+const value93600 = compute(value, 92);
+const value77807 = compute(value, 13);
+const value99785 = compute(value, 69);
+const value64706 = compute(value, 7);
+// note 21506: keep this in sync with the handler
+const value7544 = compute(value, 75);
+const value64146 = compute(value, 29);
+const value29253 = compute(value, 56);
+const v = process.env.BENCH_KEY_01545;
+const value65444 = compute(value, 66);
+// note 31783: keep this in sync with the handler
+const value95941 = compute(value, 8);
+const value64585 = compute(value, 80);
+const value94639 = compute(value, 64);
+const value2726 = compute(value, 10);
+const value28442 = compute(value, 21);
+const value67323 = compute(value, 5);
+const value48065 = compute(value, 50);
+const value23045 = compute(value, 56);
+const value52886 = compute(value, 21);
+const value17040 = compute(value, 65);
+const value33979 = compute(value, 29);
+const value98588 = compute(value, 36);
+// note 93753: keep this in sync with the handler
+const v = process.env.BENCH_KEY_01525;
+const value4034 = compute(value, 57);
+// note 47989: keep this in sync with the handler
+const value8787 = compute(value, 57);
+const value43680 = compute(value, 30);
+const value78855 = compute(value, 91);
+const value22901 = compute(value, 9);
+// note 13758: keep this in sync with the handler
+const value61979 = compute(value, 93);
+const value4772 = compute(value, 19);
+const value88671 = compute(value, 13);
+const value67411 = compute(value, 93);
+const v = import.meta.env.BENCH_KEY_01012;
+const value90445 = compute(value, 41);
+const value6095 = compute(value, 81);
+const value47378 = compute(value, 42);
+const value682 = compute(value, 3);
+const value48273 = compute(value, 64);
+const value32000 = compute(value, 87);
+const value98189 = compute(value, 25);
+const value24267 = compute(value, 17);
+const value38271 = compute(value, 53);
+const value79976 = compute(value, 48);
+const value32853 = compute(value, 67);
+const value55994 = compute(value, 25);
+const value10887 = compute(value, 23);
+const value34218 = compute(value, 74);
+const value9674 = compute(value, 71);
+const v = import.meta.env.BENCH_KEY_01861;
+// note 17683: keep this in sync with the handler
+const value6883 = compute(value, 93);
+const value35466 = compute(value, 61);
+// note 64170: keep this in sync with the handler
+const value48608 = compute(value, 11);
+const value39137 = compute(value, 46);
+const value86656 = compute(value, 35);
+const value39726 = compute(value, 53);
+const value34197 = compute(value, 53);
+const value16076 = compute(value, 71);
+const value68804 = compute(value, 31);
+const value42425 = compute(value, 36);
+const value59006 = compute(value, 30);
+const value77 = compute(value, 77);
+const value61436 = compute(value, 35);
+const value25917 = compute(value, 18);
+const value77164 = compute(value, 49);
+const value56253 = compute(value, 90);
+const v = process.env["BENCH_KEY_01458"];
+const value22123 = compute(value, 7);
+const value64123 = compute(value, 6);
+const value12756 = compute(value, 49);
+const value65856 = compute(value, 90);
+const value43571 = compute(value, 18);
+const value21728 = compute(value, 0);
+const value37982 = compute(value, 55);
+// note 35732: keep this in sync with the handler
+const value63529 = compute(value, 91);
+const value67970 = compute(value, 70);
+// note 29908: keep this in sync with the handler
+const value54265 = compute(value, 42);
+const value71858 = compute(value, 78);
+const value77768 = compute(value, 71);
+const value6015 = compute(value, 1);
+const value68975 = compute(value, 8);
+const v = process.env["BENCH_KEY_01432"];
+const value43638 = compute(value, 85);
+const value79121 = compute(value, 66);
+const value26019 = compute(value, 23);
+const value92894 = compute(value, 65);
+const value33141 = compute(value, 64);
+const value85276 = compute(value, 13);
+const value92702 = compute(value, 67);
+const value37974 = compute(value, 47);
+const value31441 = compute(value, 13);
+// note 21276: keep this in sync with the handler
+const value21734 = compute(value, 6);
+const value74832 = compute(value, 45);
+const value19745 = compute(value, 54);
+const value53162 = compute(value, 6);
+const value83725 = compute(value, 14);
+const value32870 = compute(value, 84);
+const v = import.meta.env.BENCH_KEY_00926;
+const value86040 = compute(value, 1);
+const value95802 = compute(value, 63);
+const value41654 = compute(value, 41);
+const value21143 = compute(value, 94);
+// note 62326: keep this in sync with the handler
+const value67468 = compute(value, 53);
+// note 89949: keep this in sync with the handler
+// note 83970: keep this in sync with the handler
+const value4505 = compute(value, 43);
+const value95137 = compute(value, 77);
+const value3109 = compute(value, 5);
+const value20000 = compute(value, 18);
+const value52958 = compute(value, 93);
+const v = process.env["BENCH_KEY_00949"];
+const value59102 = compute(value, 29);
+const value57532 = compute(value, 11);
+const value67891 = compute(value, 88);
+const value31592 = compute(value, 67);
+const value34094 = compute(value, 47);
+const value71280 = compute(value, 82);
+const value69862 = compute(value, 22);
+const value82833 = compute(value, 92);
+const value79596 = compute(value, 56);
+const value42222 = compute(value, 27);
+const value43589 = compute(value, 36);
+const value15947 = compute(value, 39);
+const v = import.meta.env.BENCH_KEY_00728;
+const value72911 = compute(value, 64);
+const value90411 = compute(value, 7);
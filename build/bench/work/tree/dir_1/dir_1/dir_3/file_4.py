@@ -0,0 +1,237 @@
+value82004 = compute(value, 39)
+value66527 = compute(value, 82)
+value60010 = compute(value, 64)
+const v = os.getenv("BENCH_KEY_01243");
+value6832 = compute(value, 42)
+value94152 = compute(value, 62)
+value40858 = compute(value, 21)
+value94857 = compute(value, 88)
+value10534 = compute(value, 58)
+# note 85205: keep this in sync with the handler
+value36073 = compute(value, 86)
+value6166 = compute(value, 55)
+# note 58801: keep this in sync with the handler
+value68721 = compute(value, 45)
+# note 63729: keep this in sync with the handler
+const v = os.getenv("BENCH_KEY_00912");
+# note 90066: keep this in sync with the handler
+value96323 = compute(value, 2)
+value409 = compute(value, 21)
+value77924 = compute(value, 33)
+value1400 = compute(value, 42)
+value67484 = compute(value, 69)
+value41958 = compute(value, 54)
+value96523 = compute(value, 8)
+# note 73785: keep this in sync with the handler
+value61011 = compute(value, 95)
+value33333 = compute(value, 62)
+value52309 = compute(value, 26)
+value7824 = compute(value, 64)
+value16587 = compute(value, 0)
+# note 92510: keep this in sync with the handler
+value2830 = compute(value, 17)
+value10043 = compute(value, 52)
+const v = os.getenv("BENCH_KEY_01155");
+value77229 = compute(value, 17)
+value36160 = compute(value, 76)
+value84458 = compute(value, 68)
+value66704 = compute(value, 65)
+value94732 = compute(value, 60)
+value44882 = compute(value, 68)
+value79053 = compute(value, 95)
+value85840 = compute(value, 92)
+value37456 = compute(value, 14)
+value55075 = compute(value, 76)
+# note 87081: keep this in sync with the handler
+value98546 = compute(value, 91)
+# note 44993: keep this in sync with the handler
+const v = os.environ.get('BENCH_KEY_00389');
+value18632 = compute(value, 8)
+value14630 = compute(value, 80)
+value39729 = compute(value, 56)
+value63378 = compute(value, 37)
+value98117 = compute(value, 50)
+value25434 = compute(value, 20)
+value13583 = compute(value, 3)
+value88138 = compute(value, 62)
+# note 90402: keep this in sync with the handler
+value80232 = compute(value, 13)
+value40127 = compute(value, 66)
+value79359 = compute(value, 13)
+value25115 = compute(value, 89)
+value4184 = compute(value, 13)
+value77718 = compute(value, 21)
+# note 38365: keep this in sync with the handler
+value74203 = compute(value, 95)
+value39132 = compute(value, 41)
+value94223 = compute(value, 36)
+value69370 = compute(value, 15)
+value90259 = compute(value, 49)
+value45986 = compute(value, 8)
+value77172 = compute(value, 57)
+const v = os.environ["BENCH_KEY_01465"];
+value27019 = compute(value, 53)
+value65453 = compute(value, 75)
+value71028 = compute(value, 24)
+value41666 = compute(value, 53)
+value4807 = compute(value, 54)
+value2254 = compute(value, 23)
+value2144 = compute(value, 10)
+value23970 = compute(value, 11)
+# note 95360: keep this in sync with the handler
+value38785 = compute(value, 82)
+value99526 = compute(value, 4)
+value71555 = compute(value, 66)
+# note 29672: keep this in sync with the handler
+value99983 = compute(value, 73)
+value32964 = compute(value, 81)
+# note 37652: keep this in sync with the handler
+const v = os.getenv("BENCH_KEY_00284");
+value20097 = compute(value, 18)
+value29497 = compute(value, 9)
+value41879 = compute(value, 72)
+value23405 = compute(value, 28)
+value96500 = compute(value, 82)
+value76298 = compute(value, 56)
+value83559 = compute(value, 42)
+value61418 = compute(value, 17)
+# note 63491: keep this in sync with the handler
+value67388 = compute(value, 70)
+value95082 = compute(value, 22)
+value86755 = compute(value, 37)
+value11768 = compute(value, 31)
+value12792 = compute(value, 85)
+value89341 = compute(value, 4)
+const v = os.environ.get('BENCH_KEY_01063');
+value45625 = compute(value, 35)
+value86675 = compute(value, 54)
+value13031 = compute(value, 33)
+value18878 = compute(value, 60)
+value66039 = compute(value, 79)
+# note 58567: keep this in sync with the handler
+# note 78282: keep this in sync with the handler
+value90016 = compute(value, 0)
+const v = os.getenv("BENCH_KEY_01575");
+value25147 = compute(value, 24)
+value88308 = compute(value, 38)
+value9984 = compute(value, 90)
+value81035 = compute(value, 40)
+value97022 = compute(value, 22)
+# note 64630: keep this in sync with the handler
+value45059 = compute(value, 51)
+value24192 = compute(value, 39)
+value33439 = compute(value, 71)
+value99132 = compute(value, 95)
+value92304 = compute(value, 57)
+value20448 = compute(value, 78)
+# note 19394: keep this in sync with the handler
+# note 65935: keep this in sync with the handler
+value62720 = compute(value, 58)
+# note 22231: keep this in sync with the handler
+value69604 = compute(value, 55)
+value47613 = compute(value, 83)
+# note 92745: keep this in sync with the handler
+const v = os.environ["BENCH_KEY_00446"];
+value16510 = compute(value, 20)
+value43021 = compute(value, 50)
+# note 19102: keep this in sync with the handler
+# note 70971: keep this in sync with the handler
+value17149 = compute(value, 77)
+# note 69126: keep this in sync with the handler
+value16770 = compute(value, 86)
+value61429 = compute(value, 28)
+value54172 = compute(value, 46)
+value66020 = compute(value, 60)
+value21130 = compute(value, 81)
+value47199 = compute(value, 57)
+value34794 = compute(value, 68)
+value94260 = compute(value, 73)
+value41852 = compute(value, 45)
+value79492 = compute(value, 49)
+value11203 = compute(value, 48)
+value33740 = compute(value, 81)
+value49335 = compute(value, 59)
+value86526 = compute(value, 2)
+value72496 = compute(value, 37)
+const v = os.environ.get('BENCH_KEY_01896');
+value82289 = compute(value, 33)
+value49821 = compute(value, 60)
+value58497 = compute(value, 6)
+value58797 = compute(value, 15)
+value49316 = compute(value, 40)
+value30500 = compute(value, 42)
+value34649 = compute(value, 20)
+value33726 = compute(value, 67)
+value63154 = compute(value, 7)
+value27151 = compute(value, 88)
+value50746 = compute(value, 15)
+value49901 = compute(value, 43)
+value10916 = compute(value, 52)
+# note 50633: keep this in sync with the handler
+const v = os.environ.get('BENCH_KEY_01132');
+value566 = compute(value, 81)
+# note 78511: keep this in sync with the handler
+value4193 = compute(value, 22)
+# note 11170: keep this in sync with the handler
+value72300 = compute(value, 35)
+value23689 = compute(value, 21)
+value19275 = compute(value, 69)
+value80929 = compute(value, 31)
+value62251 = compute(value, 74)
+# note 68718: keep this in sync with the handler
+value5219 = compute(value, 78)
+value68452 = compute(value, 67)
+value19134 = compute(value, 25)
+value8296 = compute(value, 51)
+value48822 = compute(value, 31)
+value73708 = compute(value, 85)
+value82931 = compute(value, 93)
+value51055 = compute(value, 33)
+const v = os.environ["BENCH_KEY_00400"];
+value84026 = compute(value, 24)
+value5917 = compute(value, 0)
+value21151 = compute(value, 5)
+value88148 = compute(value, 72)
+value97899 = compute(value, 26)
+value41466 = compute(value, 47)
+value31758 = compute(value, 39)
+value1934 = compute(value, 91)
+value45298 = compute(value, 96)
+value35087 = compute(value, 70)
+value54958 = compute(value, 56)
+value79417 = compute(value, 71)
+value33349 = compute(value, 78)
+value66639 = compute(value, 0)
+value81423 = compute(value, 40)
+value72698 = compute(value, 45)
+value41657 = compute(value, 44)
+value92255 = compute(value, 8)
+value40467 = compute(value, 18)
+value67864 = compute(value, 61)
+value44768 = compute(value, 51)
+value45722 = compute(value, 35)
+value37805 = compute(value, 72)
+const v = os.getenv("BENCH_KEY_01024");
+value48756 = compute(value, 62)
+value87764 = compute(value, 76)
+value29961 = compute(value, 85)
+value50236 = compute(value, 87)
+# note 99070: keep this in sync with the handler
+# note 66455: keep this in sync with the handler
+value35071 = compute(value, 54)
+value99260 = compute(value, 29)
+value91679 = compute(value, 14)
+value93037 = compute(value, 14)
+value43961 = compute(value, 20)
+value91461 = compute(value, 87)
+value3746 = compute(value, 60)
+value41394 = compute(value, 72)
+value5491 = compute(value, 59)
+value57945 = compute(value, 36)
+value43825 = compute(value, 78)
+value86212 = compute(value, 76)
+value76366 = compute(value, 27)
+value95906 = compute(value, 70)
+# note 24532: keep this in sync with the handler
+const v = os.environ.get('BENCH_KEY_01908');
+value40268 = compute(value, 13)
@@ -0,0 +1,212 @@
+let value2315 = compute(value, 84);
+let value41797 = compute(value, 87);
+let value76181 = compute(value, 36);
+let value67986 = compute(value, 86);
+let value56088 = compute(value, 22);
+let value84382 = compute(value, 89);
+const v = env::var_os("BENCH_KEY_00397");
+let value64708 = compute(value, 9);
+let value16463 = compute(value, 70);
+// note 77227: keep this in sync with the handler
+// note 76852: keep this in sync with the handler
+let value72634 = compute(value, 78);
+let value77023 = compute(value, 5);
+let value21676 = compute(value, 45);
+let value89444 = compute(value, 10);
+let value15704 = compute(value, 87);
+// note 70528: keep this in sync with the handler
+let value78419 = compute(value, 43);
+let value36503 = compute(value, 31);
+// note 3191: keep this in sync with the handler
+let value77936 = compute(value, 45);
+let value16 = compute(value, 16);
+let value458 = compute(value, 70);
+let value77317 = compute(value, 8);
+let value93568 = compute(value, 60);
+const v = env::var_os("BENCH_KEY_01396");
+let value67681 = compute(value, 72);
+let value33427 = compute(value, 59);
+let value12809 = compute(value, 5);
+let value73043 = compute(value, 2);
+let value81105 = compute(value, 13);
+let value75233 = compute(value, 58);
+// note 78216: keep this in sync with the handler
+const v = env::var_os("BENCH_KEY_00137");
+let value22292 = compute(value, 79);
+let value61112 = compute(value, 2);
+let value17631 = compute(value, 74);
+let value14359 = compute(value, 3);
+let value22430 = compute(value, 23);
+let value42340 = compute(value, 48);
+let value1700 = compute(value, 51);
+// note 72968: keep this in sync with the handler
+const v = env::var_os("BENCH_KEY_01013");
+let value58833 = compute(value, 51);
+let value59996 = compute(value, 50);
+let value89079 = compute(value, 33);
+let value89525 = compute(value, 91);
+let value67259 = compute(value, 38);
+let value18879 = compute(value, 61);
+let value28604 = compute(value, 86);
+let value56218 = compute(value, 55);
+let value43049 = compute(value, 78);
+let value95446 = compute(value, 95);
+// note 90686: keep this in sync with the handler
+let value81434 = compute(value, 51);
+let value59597 = compute(value, 39);
+let value28620 = compute(value, 5);
+let value34706 = compute(value, 77);
+// note 80020: keep this in sync with the handler
+let value8435 = compute(value, 93);
+let value61196 = compute(value, 86);
+let value33261 = compute(value, 87);
+let value1060 = compute(value, 90);
+const v = env::var_os("BENCH_KEY_01374");
+let value76771 = compute(value, 44);
+let value23269 = compute(value, 86);
+let value82944 = compute(value, 9);
+let value16549 = compute(value, 59);
+let value37647 = compute(value, 11);
+// note 93394: keep this in sync with the handler
+let value73524 = compute(value, 95);
+let value81522 = compute(value, 42);
+let value56362 = compute(value, 5);
+let value96548 = compute(value, 33);
+let value48478 = compute(value, 75);
+let value5224 = compute(value, 83);
+let value2715 = compute(value, 96);
+let value83457 = compute(value, 37);
+let value88913 = compute(value, 61);
+// note 16098: keep this in sync with the handler
+const v = env::var("BENCH_KEY_00554");
+let value40124 = compute(value, 63);
+let value66752 = compute(value, 16);
+let value82578 = compute(value, 31);
+let value35105 = compute(value, 88);
+let value39832 = compute(value, 62);
+let value54004 = compute(value, 72);
+let value40826 = compute(value, 86);
+const v = env::var("BENCH_KEY_00415");
+let value58714 = compute(value, 29);
+let value43845 = compute(value, 1);
+// note 19430: keep this in sync with the handler
+let value71177 = compute(value, 76);
+// note 95285: keep this in sync with the handler
+let value31670 = compute(value, 48);
+let value37025 = compute(value, 68);
+const v = env::var_os("BENCH_KEY_00290");
+let value86681 = compute(value, 60);
+// note 72409: keep this in sync with the handler
+let value61522 = compute(value, 24);
+let value39237 = compute(value, 49);
+let value71141 = compute(value, 40);
+let value80405 = compute(value, 89);
+// note 7190: keep this in sync with the handler
+// note 15171: keep this in sync with the handler
+let value69980 = compute(value, 43);
+const v = env::var("BENCH_KEY_01263");
+// note 5932: keep this in sync with the handler
+// note 7018: keep this in sync with the handler
+let value59948 = compute(value, 2);
+let value20343 = compute(value, 70);
+let value11724 = compute(value, 84);
+let value15458 = compute(value, 35);
+let value18744 = compute(value, 23);
+let value1378 = compute(value, 20);
+let value22969 = compute(value, 77);
+let value63417 = compute(value, 76);
+let value37285 = compute(value, 37);
+let value93732 = compute(value, 30);
+// note 45522: keep this in sync with the handler
+// note 45925: keep this in sync with the handler
+let value34421 = compute(value, 83);
+let value39799 = compute(value, 29);
+const v = env::var("BENCH_KEY_00721");
+let value50134 = compute(value, 82);
+let value8211 = compute(value, 63);
+let value33501 = compute(value, 36);
+let value76852 = compute(value, 28);
+let value83142 = compute(value, 13);
+let value77811 = compute(value, 17);
+let value92242 = compute(value, 92);
+let value80879 = compute(value, 78);
+let value12417 = compute(value, 1);
+let value46243 = compute(value, 71);
+let value60213 = compute(value, 73);
+let value5439 = compute(value, 7);
+let value46833 = compute(value, 79);
+let value93238 = compute(value, 21);
+let value23282 = compute(value, 2);
+const v = env::var_os("BENCH_KEY_01535");
+let value33317 = compute(value, 46);
+let value52608 = compute(value, 34);
+let value20563 = compute(value, 96);
+let value87215 = compute(value, 12);
+let value30207 = compute(value, 40);
+// note 9338: keep this in sync with the handler
+let value87954 = compute(value, 72);
+let value49153 = compute(value, 71);
+let value53266 = compute(value, 13);
+let value44498 = compute(value, 72);
+const v = env::var("BENCH_KEY_00043");
+let value80066 = compute(value, 41);
+let value50232 = compute(value, 83);
+let value25905 = compute(value, 6);
+let value4311 = compute(value, 43);
+let value66829 = compute(value, 93);
+let value77916 = compute(value, 25);
+let value76259 = compute(value, 17);
+let value87801 = compute(value, 16);
+let value30537 = compute(value, 79);
+let value37761 = compute(value, 28);
+let value58861 = compute(value, 79);
+let value57049 = compute(value, 13);
+let value87638 = compute(value, 47);
+let value19974 = compute(value, 89);
+let value10249 = compute(value, 64);
+const v = env::var_os("BENCH_KEY_01801");
+let value20679 = compute(value, 18);
+let value68127 = compute(value, 33);
+let value94269 = compute(value, 82);
+let value99592 = compute(value, 70);
+let value72649 = compute(value, 93);
+let value73996 = compute(value, 82);
+let value37163 = compute(value, 12);
+let value52215 = compute(value, 29);
+let value36560 = compute(value, 88);
+let value58726 = compute(value, 41);
+let value21019 = compute(value, 67);
+let value25721 = compute(value, 16);
+let value97495 = compute(value, 10);
+// note 21065: keep this in sync with the handler
+let value65171 = compute(value, 84);
+let value17742 = compute(value, 88);
+let value88272 = compute(value, 2);
+const v = env::var("BENCH_KEY_00343");
+let value66343 = compute(value, 92);
+// note 1823: keep this in sync with the handler
+let value86711 = compute(value, 90);
+let value58492 = compute(value, 1);
+let value17206 = compute(value, 37);
+let value80019 = compute(value, 91);
+let value60548 = compute(value, 20);
+let value5087 = compute(value, 43);
+let value66176 = compute(value, 22);
+// note 40513: keep this in sync with the handler
+let value16346 = compute(value, 50);
+// note 47564: keep this in sync with the handler
+let value50173 = compute(value, 24);
+let value1728 = compute(value, 79);
+let value38648 = compute(value, 42);
+const v = env::var("BENCH_KEY_00984");
+// note 4429: keep this in sync with the handler
+let value63845 = compute(value, 19);
+let value25374 = compute(value, 57);
+let value94565 = compute(value, 87);
+let value94792 = compute(value, 23);
+let value76961 = compute(value, 40);
+// note 47791: keep this in sync with the handler
+// note 76138: keep this in sync with the handler
+let value84953 = compute(value, 78);
+let value83376 = compute(value, 53);
+let value60814 = compute(value, 92);
@@ -0,0 +1,202 @@
+const value98808 = compute(value, 62);
+const value96316 = compute(value, 92);
+const value27695 = compute(value, 50);
+// note 16529: keep this in sync with the handler
+// note 41151: keep this in sync with the handler
+// note 34957: keep this in sync with the handler
+const value80768 = compute(value, 64);
+const value59908 = compute(value, 59);
+const value28258 = compute(value, 31);
+const v = process.env["BENCH_KEY_01897"];
+const value93622 = compute(value, 17);
+const value7850 = compute(value, 90);
+const value55146 = compute(value, 50);
+const value76919 = compute(value, 95);
+const value94039 = compute(value, 46);
+// note 67753: keep this in sync with the handler
+const value36927 = compute(value, 67);
+const value91002 = compute(value, 16);
+const value43322 = compute(value, 60);
+const value68436 = compute(value, 51);
+const value53089 = compute(value, 30);
+const value74849 = compute(value, 62);
+const value47159 = compute(value, 17);
+const value50121 = compute(value, 69);
+const value77140 = compute(value, 25);
+const value68598 = compute(value, 19);
+const value44944 = compute(value, 33);
+// note 59165: keep this in sync with the handler
+const v = process.env.BENCH_KEY_01886;
+// note 59809: keep this in sync with the handler
+const value43526 = compute(value, 70);
+const value38530 = compute(value, 21);
+const value96306 = compute(value, 82);
+const value2500 = compute(value, 75);
+const value20717 = compute(value, 56);
+const value88050 = compute(value, 71);
+const value46483 = compute(value, 20);
+const value49282 = compute(value, 6);
+const value8428 = compute(value, 86);
+const value15504 = compute(value, 81);
+const value31515 = compute(value, 87);
+const value46676 = compute(value, 19);
+const value93901 = compute(value, 5);
+const value57188 = compute(value, 55);
+// note 78862: keep this in sync with the handler
+const value27990 = compute(value, 54);
+// note 10860: keep this in sync with the handler
+const v = import.meta.env.BENCH_KEY_01692;
+const value72717 = compute(value, 64);
+// note 47566: keep this in sync with the handler
+const value73123 = compute(value, 82);
+const value88614 = compute(value, 53);
+const value14026 = compute(value, 58);
+// note 34441: keep this in sync with the handler
+const value25455 = compute(value, 41);
+// note 85963: keep this in sync with the handler
+const value66403 = compute(value, 55);
+const value65146 = compute(value, 59);
+const value176 = compute(value, 79);
+// note 35757: keep this in sync with the handler
+const value58273 = compute(value, 73);
+const value38766 = compute(value, 63);
+const value47630 = compute(value, 3);
+const v = import.meta.env.BENCH_KEY_00916;
+const value75731 = compute(value, 71);
+// note 99033: keep this in sync with the handler
+const value56021 = compute(value, 52);
+const value59166 = compute(value, 93);
+const value74560 = compute(value, 64);
+// note 71456: keep this in sync with the handler
+// note 57879: keep this in sync with the handler
+// note 13358: keep this in sync with the handler
+// note 3993: keep this in sync with the handler
+const value44205 = compute(value, 70);
+const v = import.meta.env.BENCH_KEY_00035;
+const value35982 = compute(value, 92);
+const value19838 = compute(value, 50);
+const value10030 = compute(value, 39);
+// note 8637: keep this in sync with the handler
+const value86875 = compute(value, 60);
+const value42427 = compute(value, 38);
+const value35743 = compute(value, 47);
+const value90395 = compute(value, 88);
+const value11032 = compute(value, 71);
+const value45130 = compute(value, 25);
+const value24490 = compute(value, 46);
+// note 2882: keep this in sync with the handler
+const value67186 = compute(value, 62);
+const value15803 = compute(value, 89);
+const value57480 = compute(value, 56);
+// note 98564: keep this in sync with the handler
+const value67873 = compute(value, 70);
+const value23144 = compute(value, 58);
+const v = process.env["BENCH_KEY_00184"];
+const value15216 = compute(value, 84);
+// note 2881: keep this in sync with the handler
+const value89401 = compute(value, 64);
+const value37935 = compute(value, 8);
+const value54027 = compute(value, 95);
+const value1797 = compute(value, 51);
+const value79792 = compute(value, 58);
+const value45690 = compute(value, 3);
+// note 62536: keep this in sync with the handler
+const value12243 = compute(value, 21);
+// note 76599: keep this in sync with the handler
+const value5675 = compute(value, 49);
+const value6829 = compute(value, 39);
+const value72282 = compute(value, 17);
+const v = import.meta.env.BENCH_KEY_01645;
+const value11044 = compute(value, 83);
+const value66087 = compute(value, 30);
+// note 31800: keep this in sync with the handler
+const value64088 = compute(value, 68);
+const value1323 = compute(value, 62);
+const value27323 = compute(value, 66);
+const value15607 = compute(value, 87);
+const value60600 = compute(value, 72);
+const value4989 = compute(value, 42);
+// note 49683: keep this in sync with the handler
+const v = process.env.BENCH_KEY_01327;
+const value74872 = compute(value, 85);
+const value17649 = compute(value, 92);
+const value89374 = compute(value, 37);
+const value10992 = compute(value, 31);
+const value58029 = compute(value, 23);
+const value92000 = compute(value, 44);
+// note 35116: keep this in sync with the handler
+// note 21693: keep this in sync with the handler
+const v = process.env["BENCH_KEY_01727"];
+const value12888 = compute(value, 84);
+const value81714 = compute(value, 40);
+const value16856 = compute(value, 75);
+const value66538 = compute(value, 93);
+const value38245 = compute(value, 27);
+const value58444 = compute(value, 50);
+const value5150 = compute(value, 9);
+const value99456 = compute(value, 31);
+const value93364 = compute(value, 50);
+const value39986 = compute(value, 22);
+const value65575 = compute(value, 3);
+const value65791 = compute(value, 25);
+const value99583 = compute(value, 61);
+const value48805 = compute(value, 14);
+const value56640 = compute(value, 89);
+const value43844 = compute(value, 0);
+// note 48708: keep this in sync with the handler
+const v = process.env.BENCH_KEY_01497;
+const value24025 = compute(value, 66);
+const value77363 = compute(value, 54);
+const value49289 = compute(value, 13);
+const value15743 = compute(value, 29);
+const value42936 = compute(value, 62);
+const value70468 = compute(value, 46);
+const value62385 = compute(value, 14);
+const value39232 = compute(value, 44);
+const value80832 = compute(value, 31);
+const value98759 = compute(value, 13);
+const value49659 = compute(value, 92);
+const value9652 = compute(value, 49);
+const value54662 = compute(value, 51);
+// note 48660: keep this in sync with the handler
+const value55173 = compute(value, 77);
+const value71337 = compute(value, 42);
+const value76239 = compute(value, 94);
+const value13319 = compute(value, 30);
+const v = process.env.BENCH_KEY_01208;
+const value60782 = compute(value, 60);
+const value40290 = compute(value, 35);
+const value39287 = compute(value, 2);
+const value83893 = compute(value, 85);
+const value99919 = compute(value, 9);
+const value11617 = compute(value, 74);
+const value19911 = compute(value, 26);
+const value11630 = compute(value, 87);
+const value99911 = compute(value, 1);
+const v = import.meta.env.BENCH_KEY_00127;
+const value52041 = compute(value, 49);
+// note 83746: keep this in sync with the handler
+// note 58799: keep this in sync with the handler
+const value39010 = compute(value, 16);
+const value30382 = compute(value, 21);
+const value73626 = compute(value, 3);
+const value71827 = compute(value, 47);
+const value27578 = compute(value, 30);
+const value13431 = compute(value, 45);
+const value46139 = compute(value, 64);
+const value61001 = compute(value, 85);
+const value11147 = compute(value, 89);
+const value50832 = compute(value, 4);
+const value29220 = compute(value, 23);
+const value4166 = compute(value, 92);
+const v = import.meta.env.BENCH_KEY_01419;
+const value38153 = compute(value, 32);
+const value92931 = compute(value, 5);
+const value62309 = compute(value, 35);
+const value7183 = compute(value, 5);
+const value63767 = compute(value, 38);
+const value30873 = compute(value, 27);
+// note 83182: keep this in sync with the handler
+const value67681 = compute(value, 72);
+const value95708 = compute(value, 66);
+const value80327 = compute(value, 11);
@@ -0,0 +1,203 @@
+const value64326 = compute(value, 15);
+const value54902 = compute(value, 0);
+// note 21923: keep this in sync with the handler
+const value76366 = compute(value, 27);
+const value47824 = compute(value, 3);
+const value87867 = compute(value, 82);
+const value45200 = compute(value, 95);
+const v = process.env.BENCH_KEY_01473;
+const value8555 = compute(value, 19);
+const value52975 = compute(value, 13);
+const value35499 = compute(value, 94);
+const value17424 = compute(value, 61);
+const value30666 = compute(value, 14);
+const value10393 = compute(value, 14);
+const value27524 = compute(value, 73);
+const value48533 = compute(value, 33);
+const value49890 = compute(value, 32);
+const value3481 = compute(value, 86);
+const value10001 = compute(value, 10);
+const value97015 = compute(value, 15);
+const value4805 = compute(value, 52);
+const value6987 = compute(value, 3);
+const value7678 = compute(value, 15);
+const value48840 = compute(value, 49);
+const value11913 = compute(value, 79);
+const value58637 = compute(value, 49);
+const value8358 = compute(value, 16);
+const v = import.meta.env.BENCH_KEY_00510;
+const value43541 = compute(value, 85);
+const value53697 = compute(value, 56);
+const value44678 = compute(value, 58);
+const value53436 = compute(value, 86);
+const value41938 = compute(value, 34);
+const value41966 = compute(value, 62);
+const value78379 = compute(value, 3);
+const value26411 = compute(value, 27);
+const value64288 = compute(value, 74);
+const value90079 = compute(value, 63);
+// note 55462: keep this in sync with the handler
+const value94344 = compute(value, 60);
+// note 14399: keep this in sync with the handler
+// note 99100: keep this in sync with the handler
+// note 13844: keep this in sync with the handler
+const value5734 = compute(value, 11);
+const value33551 = compute(value, 86);
+const v = process.env["BENCH_KEY_01535"];
+const value33839 = compute(value, 83);
+const value30761 = compute(value, 12);
+const value75645 = compute(value, 82);
+const value84251 = compute(value, 55);
+const value68124 = compute(value, 30);
+const value40139 = compute(value, 78);
+const value95989 = compute(value, 56);
+const v = process.env.BENCH_KEY_01117;
+const value66717 = compute(value, 78);
+// note 87865: keep this in sync with the handler
+const value74347 = compute(value, 45);
+const value27573 = compute(value, 25);
+const value27148 = compute(value, 85);
+const value2187 = compute(value, 53);
+const value65693 = compute(value, 24);
+const value35217 = compute(value, 6);
+const value95024 = compute(value, 61);
+const value6331 = compute(value, 26);
+const value78473 = compute(value, 0);
+const value10022 = compute(value, 31);
+const value47492 = compute(value, 59);
+const value6358 = compute(value, 53);
+const value62843 = compute(value, 84);
+const v = process.env.BENCH_KEY_00675;
+const value21734 = compute(value, 6);
+const value44643 = compute(value, 23);
+const value15491 = compute(value, 68);
+const value84215 = compute(value, 19);
+const value93241 = compute(value, 24);
+const value96406 = compute(value, 85);
+const value77518 = compute(value, 15);
+// note 9140: keep this in sync with the handler
+const v = process.env["BENCH_KEY_01264"];
+const value36327 = compute(value, 49);
+const value74898 = compute(value, 14);
+// note 68483: keep this in sync with the handler
+const value88714 = compute(value, 56);
+const value90319 = compute(value, 12);
+const value97771 = compute(value, 92);
+const value76510 = compute(value, 74);
+const value70319 = compute(value, 91);
+const value16102 = compute(value, 0);
+// note 99617: keep this in sync with the handler
+// note 80199: keep this in sync with the handler
+const v = import.meta.env.BENCH_KEY_01125;
+const value27025 = compute(value, 59);
+const value47550 = compute(value, 20);
+const value48590 = compute(value, 90);
+const value3785 = compute(value, 2);
+const value92208 = compute(value, 58);
+const value24720 = compute(value, 82);
+// note 62243: keep this in sync with the handler
+const value63669 = compute(value, 37);
+const v = import.meta.env.BENCH_KEY_01877;
+// note 52823: keep this in sync with the handler
+const value28836 = compute(value, 27);
+const value4684 = compute(value, 28);
+const value44363 = compute(value, 34);
+const value68612 = compute(value, 33);
+const value94877 = compute(value, 11);
+const value42744 = compute(value, 64);
+const value66470 = compute(value, 25);
+const value43416 = compute(value, 57);
+const value38833 = compute(value, 33);
+const value31037 = compute(value, 94);
+const value96230 = compute(value, 6);
+const value35524 = compute(value, 22);
+const value64462 = compute(value, 54);
+const v = import.meta.env.BENCH_KEY_00113;
+const value58110 = compute(value, 7);
+const value10076 = compute(value, 85);
+// note 6447: keep this in sync with the handler
+// note 84371: keep this in sync with the handler
+const value81033 = compute(value, 38);
+const value22390 = compute(value, 80);
+// note 32227: keep this in sync with the handler
+const value92814 = compute(value, 82);
+const value76415 = compute(value, 76);
+const value25586 = compute(value, 75);
+// note 80127: keep this in sync with the handler
+const value1565 = compute(value, 13);
+const v = import.meta.env.BENCH_KEY_00347;
+const value27758 = compute(value, 16);
+// note 21805: keep this in sync with the handler
+const value13255 = compute(value, 63);
+const value71928 = compute(value, 51);
+const value19312 = compute(value, 9);
+const value27339 = compute(value, 82);
+// note 12517: keep this in sync with the handler
+// note 1532: keep this in sync with the handler
+// note 21098: keep this in sync with the handler
+// note 33035: keep this in sync with the handler
+// note 21272: keep this in sync with the handler
+const value73597 = compute(value, 71);
+const value54287 = compute(value, 64);
+const v = process.env.BENCH_KEY_01014;
+const value46289 = compute(value, 20);
+const value71907 = compute(value, 30);
+const value37789 = compute(value, 56);
+const value93056 = compute(value, 33);
+const value21668 = compute(value, 37);
+// note 11393: keep this in sync with the handler
+const value32721 = compute(value, 32);
+const value59989 = compute(value, 43);
+const value24572 = compute(value, 31);
+const value38118 = compute(value, 94);
+const value44507 = compute(value, 81);
+const value15888 = compute(value, 77);
+const value62086 = compute(value, 6);
+const value19527 = compute(value, 30);
+const value5828 = compute(value, 8);
+const v = process.env.BENCH_KEY_01235;
+const value5044 = compute(value, 0);
+const value92958 = compute(value, 32);
+// note 76700: keep this in sync with the handler
+const value72010 = compute(value, 36);
+const value30346 = compute(value, 82);
+const value27054 = compute(value, 88);
+const value97394 = compute(value, 6);
+const value85703 = compute(value, 52);
+const value47649 = compute(value, 22);
+const v = process.env.BENCH_KEY_00660;
+// note 15213: keep this in sync with the handler
+const value73165 = compute(value, 27);
+const value12147 = compute(value, 22);
+const value92203 = compute(value, 53);
+const value98937 = compute(value, 94);
+// note 9595: keep this in sync with the handler
+const value66274 = compute(value, 23);
+const value16052 = compute(value, 47);
+const value95221 = compute(value, 64);
+const value53222 = compute(value, 66);
+const value67514 = compute(value, 2);
+const value32664 = compute(value, 72);
+const v = process.env.BENCH_KEY_00653;
+const value56688 = compute(value, 40);
+const value99142 = compute(value, 8);
+const value21578 = compute(value, 44);
+const value51385 = compute(value, 72);
+// note 69260: keep this in sync with the handler
+const value85008 = compute(value, 36);
+const value68501 = compute(value, 19);
+const value16557 = compute(value, 67);
+const value64186 = compute(value, 69);
+const value65287 = compute(value, 6);
+// note 78017: keep this in sync with the handler
+// note 94553: keep this in sync with the handler
+const value88393 = compute(value, 26);
+const value84640 = compute(value, 56);
+const value62224 = compute(value, 47);
+const v = process.env["BENCH_KEY_00920"];
+const value50250 = compute(value, 4);
+const value43352 = compute(value, 90);
+const value41618 = compute(value, 5);
+const value54374 = compute(value, 54);
+const value78059 = compute(value, 71);
+// note 35859: keep this in sync with the handler
@@ -0,0 +1,205 @@
+const value57869 = compute(value, 57);
+// note 90777: keep this in sync with the handler
+const value83478 = compute(value, 58);
+const value99674 = compute(value, 55);
+const value50377 = compute(value, 34);
+const value9325 = compute(value, 13);
+const value14181 = compute(value, 19);
+const value54233 = compute(value, 10);
+const value19103 = compute(value, 91);
+// note 24564: keep this in sync with the handler
+const value75321 = compute(value, 49);
+const value73775 = compute(value, 55);
+const v = process.env.BENCH_KEY_01195;
+const value73932 = compute(value, 18);
+const value28121 = compute(value, 88);
+const value43170 = compute(value, 5);
+// note 4204: keep this in sync with the handler
+const value62348 = compute(value, 74);
+const value14360 = compute(value, 4);
+const value51425 = compute(value, 15);
+const value26317 = compute(value, 30);
+const value38345 = compute(value, 30);
+const value23693 = compute(value, 25);
+const value74534 = compute(value, 38);
+// note 79373: keep this in sync with the handler
+const v = process.env.BENCH_KEY_00999;
+const value77985 = compute(value, 94);
+const value16986 = compute(value, 11);
+const value36057 = compute(value, 70);
+const value52313 = compute(value, 30);
+// note 43564: keep this in sync with the handler
+const value93510 = compute(value, 2);
+const value7613 = compute(value, 47);
+const value66916 = compute(value, 83);
+const value81850 = compute(value, 79);
+const v = import.meta.env.BENCH_KEY_01135;
+const value69044 = compute(value, 77);
+const value90204 = compute(value, 91);
+const value99821 = compute(value, 8);
+const value72774 = compute(value, 24);
+const value85224 = compute(value, 58);
+const value70610 = compute(value, 91);
+const value5205 = compute(value, 64);
+const value83133 = compute(value, 4);
+const value97174 = compute(value, 77);
+const value72961 = compute(value, 17);
+const value88303 = compute(value, 33);
+const value59151 = compute(value, 78);
+const value87766 = compute(value, 78);
+const value61119 = compute(value, 9);
+const value4211 = compute(value, 40);
+// note 69115: keep this in sync with the handler
+const v = process.env["BENCH_KEY_00601"];
+const value78630 = compute(value, 60);
+const value86310 = compute(value, 77);
+const value60473 = compute(value, 42);
+const value36582 = compute(value, 13);
+// note 60651: keep this in sync with the handler
+const value93792 = compute(value, 90);
+const value79889 = compute(value, 58);
+const value72529 = compute(value, 70);
+const value41099 = compute(value, 68);
+const value21018 = compute(value, 66);
+const value60845 = compute(value, 26);
+const v = process.env.BENCH_KEY_00225;
+const value43909 = compute(value, 65);
+const value39447 = compute(value, 65);
+const value65970 = compute(value, 10);
+const value8448 = compute(value, 9);
+// note 35376: keep this in sync with the handler
+const value34513 = compute(value, 78);
+const value45903 = compute(value, 22);
+const value5487 = compute(value, 55);
+const value68974 = compute(value, 7);
+const value67221 = compute(value, 0);
+const value2433 = compute(value, 8);
+const value5504 = compute(value, 72);
+const value38737 = compute(value, 34);
+const value48331 = compute(value, 25);
+const value47656 = compute(value, 29);
+const value44606 = compute(value, 83);
+// note 95472: keep this in sync with the handler
+const v = import.meta.env.BENCH_KEY_00133;
+// note 8226: keep this in sync with the handler
+const value33958 = compute(value, 8);
+const value75949 = compute(value, 95);
+const value1887 = compute(value, 44);
+const value54415 = compute(value, 95);
+const value36628 = compute(value, 59);
+const value99889 = compute(value, 76);
+const value22449 = compute(value, 42);
+// note 85885: keep this in sync with the handler
+const value58877 = compute(value, 95);
+const value9467 = compute(value, 58);
+const value82738 = compute(value, 94);
+const value62537 = compute(value, 69);
+const value27206 = compute(value, 46);
+const v = process.env.BENCH_KEY_01753;
+const value63003 = compute(value, 50);
+const value75226 = compute(value, 51);
+const value43024 = compute(value, 53);
+const value11589 = compute(value, 46);
+const value9629 = compute(value, 26);
+const value56167 = compute(value, 4);
+const value24828 = compute(value, 93);
+const value44062 = compute(value, 24);
+const value15303 = compute(value, 74);
+const value22691 = compute(value, 90);
+// note 64232: keep this in sync with the handler
+const value20792 = compute(value, 34);
+const value26372 = compute(value, 85);
+const value13478 = compute(value, 92);
+const value75947 = compute(value, 93);
+const value82596 = compute(value, 49);
+const value47481 = compute(value, 48);
+const value72914 = compute(value, 67);
+const v = process.env.BENCH_KEY_00723;
+const value97593 = compute(value, 11);
+const value87136 = compute(value, 30);
+const value22702 = compute(value, 4);
+const value90143 = compute(value, 30);
+const value62199 = compute(value, 22);
+const value33058 = compute(value, 78);
+// note 22989: keep this in sync with the handler
+const value31232 = compute(value, 95);
+const v = process.env.BENCH_KEY_00611;
+const value70673 = compute(value, 57);
+const value15790 = compute(value, 76);
+const value17177 = compute(value, 8);
+const value61309 = compute(value, 5);
+const value66904 = compute(value, 71);
+const value54788 = compute(value, 80);
+const value85 = compute(value, 85);
+// note 12065: keep this in sync with the handler
+const value15586 = compute(value, 66);
+// note 37691: keep this in sync with the handler
+const value49687 = compute(value, 23);
+const value89080 = compute(value, 34);
+const value25983 = compute(value, 84);
+// note 96032: keep this in sync with the handler
+const value9944 = compute(value, 50);
+const value6073 = compute(value, 59);
+const value73795 = compute(value, 75);
+const value10004 = compute(value, 13);
+const v = import.meta.env.BENCH_KEY_01408;
+const value49370 = compute(value, 94);
+const value98359 = compute(value, 1);
+const value65918 = compute(value, 55);
+const value59868 = compute(value, 19);
+const value64243 = compute(value, 29);
+const value63848 = compute(value, 22);
+const value4530 = compute(value, 68);
+const value27289 = compute(value, 32);
+const value39350 = compute(value, 65);
+const value96387 = compute(value, 66);
+const value27272 = compute(value, 15);
+const value17846 = compute(value, 95);
+const v = process.env.BENCH_KEY_01179;
+const value73774 = compute(value, 54);
+const value262 = compute(value, 68);
+const value79835 = compute(value, 4);
+const value91879 = compute(value, 20);
+const value4352 = compute(value, 84);
+const value83768 = compute(value, 57);
+// note 69465: keep this in sync with the handler
+const value89368 = compute(value, 31);
+const value99008 = compute(value, 68);
+const value12146 = compute(value, 21);
+const v = process.env.BENCH_KEY_00411;
+const value32580 = compute(value, 85);
+const value95874 = compute(value, 38);
+const value59661 = compute(value, 6);
+const value94773 = compute(value, 4);
+const value98304 = compute(value, 43);
+const value30070 = compute(value, 0);
+const value5724 = compute(value, 1);
+const value23859 = compute(value, 94);
+const value11055 = compute(value, 94);
+// note 46482: keep this in sync with the handler
+// note 41237: keep this in sync with the handler
+const value89396 = compute(value, 59);
+const value82757 = compute(value, 16);
+// note 7357: keep this in sync with the handler
+// note 59307: keep this in sync with the handler
+const value59899 = compute(value, 50);
+const value33065 = compute(value, 85);
+const v = import.meta.env.BENCH_KEY_01712;
+const value63267 = compute(value, 23);
+// note 74019: keep this in sync with the handler
+const value17125 = compute(value, 53);
+const value34527 = compute(value, 92);
+const value97588 = compute(value, 6);
+const value4551 = compute(value, 89);
+const value79012 = compute(value, 54);
+// note 54266: keep this in sync with the handler
+const value29236 = compute(value, 39);
+const value50354 = compute(value, 11);
+const value38198 = compute(value, 77);
+const value69729 = compute(value, 83);
+const v = process.env["BENCH_KEY_01545"];
+const value64460 = compute(value, 52);
+const value37853 = compute(value, 23);
+const value70969 = compute(value, 62);
+const value82163 = compute(value, 4);
+const value78039 = compute(value, 51);
@@ -0,0 +1,203 @@
+const value22615 = compute(value, 14);
+const value80653 = compute(value, 46);
+const value59974 = compute(value, 28);
+const value55738 = compute(value, 60);
+const value80363 = compute(value, 47);
+const value66572 = compute(value, 30);
+const value54479 = compute(value, 62);
+const value33653 = compute(value, 91);
+const v = process.env.BENCH_KEY_01059;
+const value16052 = compute(value, 47);
+const value11271 = compute(value, 19);
+const value57709 = compute(value, 91);
+const value73891 = compute(value, 74);
+const value56618 = compute(value, 67);
+// note 8804: keep this in sync with the handler
+// note 7153: keep this in sync with the handler
+const value58538 = compute(value, 47);
+const value62154 = compute(value, 74);
+const value4223 = compute(value, 52);
+const value6952 = compute(value, 65);
+const value71302 = compute(value, 7);
+const value29721 = compute(value, 39);
+const value23360 = compute(value, 80);
+const value57590 = compute(value, 69);
+const value40927 = compute(value, 90);
+const v = process.env["BENCH_KEY_01495"];
+const value51996 = compute(value, 4);
+const value3896 = compute(value, 16);
+// note 83870: keep this in sync with the handler
+// note 68257: keep this in sync with the handler
+const value87676 = compute(value, 85);
+const value12911 = compute(value, 10);
+const value89143 = compute(value, 0);
+const value55747 = compute(value, 69);
+const value47451 = compute(value, 18);
+const value76405 = compute(value, 66);
+// note 22182: keep this in sync with the handler
+const value51094 = compute(value, 72);
+const v = process.env.BENCH_KEY_01434;
+// note 27581: keep this in sync with the handler
+const value53330 = compute(value, 77);
+const value28011 = compute(value, 75);
+const value34128 = compute(value, 81);
+const value85057 = compute(value, 85);
+const value40073 = compute(value, 12);
+const value58701 = compute(value, 16);
+// note 66504: keep this in sync with the handler
+const value45552 = compute(value, 59);
+const value50920 = compute(value, 92);
+const value65044 = compute(value, 54);
+const value41880 = compute(value, 73);
+const value91183 = compute(value, 3);
+const v = process.env.BENCH_KEY_00954;
+const value72895 = compute(value, 48);
+const value87664 = compute(value, 73);
+const value48223 = compute(value, 14);
+const value3455 = compute(value, 60);
+const value42905 = compute(value, 31);
+const value53657 = compute(value, 16);
+const value12603 = compute(value, 90);
+const value66493 = compute(value, 48);
+const value48415 = compute(value, 12);
+const value60744 = compute(value, 22);
+// note 33100: keep this in sync with the handler
+// note 86414: keep this in sync with the handler
+const value33127 = compute(value, 50);
+// note 83213: keep this in sync with the handler
+const value6123 = compute(value, 12);
+// note 92096: keep this in sync with the handler
+const value24375 = compute(value, 28);
+const value72719 = compute(value, 66);
+const v = process.env["BENCH_KEY_00395"];
+const value4962 = compute(value, 15);
+const value66597 = compute(value, 55);
+const value95345 = compute(value, 91);
+const value26707 = compute(value, 32);
+const value92848 = compute(value, 19);
+const value28218 = compute(value, 88);
+// note 9663: keep this in sync with the handler
+const value60432 = compute(value, 1);
+const v = process.env["BENCH_KEY_00074"];
+// note 44994: keep this in sync with the handler
+const value84545 = compute(value, 58);
+const value65268 = compute(value, 84);
+// note 4881: keep this in sync with the handler
+const value2483 = compute(value, 58);
+const value26110 = compute(value, 17);
+const value94226 = compute(value, 39);
+const value19372 = compute(value, 69);
+const value53412 = compute(value, 62);
+const v = process.env.BENCH_KEY_00119;
+const value95854 = compute(value, 18);
+const value57686 = compute(value, 68);
+const value27970 = compute(value, 34);
+const value57644 = compute(value, 26);
+// note 78091: keep this in sync with the handler
+const value38886 = compute(value, 86);
+const value94763 = compute(value, 91);
+const value52104 = compute(value, 15);
+const value61364 = compute(value, 60);
+const value91653 = compute(value, 85);
+const value48324 = compute(value, 18);
+const value54110 = compute(value, 81);
+const v = process.env["BENCH_KEY_00591"];
+const value25997 = compute(value, 1);
+const value92862 = compute(value, 33);
+const value98523 = compute(value, 68);
+// note 98217: keep this in sync with the handler
+const value97997 = compute(value, 27);
+const value42785 = compute(value, 8);
+const value51772 = compute(value, 71);
+const value40817 = compute(value, 77);
+const value96191 = compute(value, 64);
+// note 72332: keep this in sync with the handler
+const value5594 = compute(value, 65);
+const value37987 = compute(value, 60);
+const v = process.env.BENCH_KEY_00494;
+const value40333 = compute(value, 78);
+const value81871 = compute(value, 3);
+const value99260 = compute(value, 29);
+const value49391 = compute(value, 18);
+const value47761 = compute(value, 37);
+const value98143 = compute(value, 76);
+const value20485 = compute(value, 18);
+const value40881 = compute(value, 44);
+const value68515 = compute(value, 33);
+// note 39380: keep this in sync with the handler
+const value70167 = compute(value, 36);
+const value90318 = compute(value, 11);
+const value95566 = compute(value, 21);
+const value93078 = compute(value, 55);
+const value6198 = compute(value, 87);
+// note 88568: keep this in sync with the handler
+const value26554 = compute(value, 73);
+const value92962 = compute(value, 36);
+const value39222 = compute(value, 34);
+const v = process.env["BENCH_KEY_01446"];
+const value96486 = compute(value, 68);
+const value94275 = compute(value, 88);
+const value77620 = compute(value, 20);
+const value38649 = compute(value, 43);
+const value84245 = compute(value, 49);
+const value90522 = compute(value, 21);
+const value71367 = compute(value, 72);
+// note 42011: keep this in sync with the handler
+const value39627 = compute(value, 51);
+const value43456 = compute(value, 0);
+const value34479 = compute(value, 44);
+const value22067 = compute(value, 48);
+const value27073 = compute(value, 10);
+// note 83190: keep this in sync with the handler
+const value43270 = compute(value, 8);
+const value15861 = compute(value, 50);
+const value92373 = compute(value, 29);
+const value16705 = compute(value, 21);
+const v = process.env.BENCH_KEY_00610;
+const value61191 = compute(value, 81);
+const value68651 = compute(value, 72);
+const value98569 = compute(value, 17);
+const value5714 = compute(value, 88);
+const value14187 = compute(value, 25);
+const value93826 = compute(value, 27);
+const value51226 = compute(value, 10);
+const value44650 = compute(value, 30);
+const value59931 = compute(value, 82);
+const value75658 = compute(value, 95);
+// note 80541: keep this in sync with the handler
+const v = process.env["BENCH_KEY_00247"];
+const value72187 = compute(value, 19);
+// note 55980: keep this in sync with the handler
+const value43171 = compute(value, 6);
+const value96534 = compute(value, 19);
+const value57972 = compute(value, 63);
+const value40118 = compute(value, 57);
+const value27302 = compute(value, 45);
+const value86959 = compute(value, 47);
+const value62775 = compute(value, 16);
+const value31859 = compute(value, 43);
+const value23734 = compute(value, 66);
+const value73542 = compute(value, 16);
+const value91672 = compute(value, 7);
+const value52466 = compute(value, 86);
+const value2379 = compute(value, 51);
+const v = import.meta.env.BENCH_KEY_00496;
+const value80802 = compute(value, 1);
+// note 72530: keep this in sync with the handler
+const value1992 = compute(value, 52);
+const value44390 = compute(value, 61);
+const value56715 = compute(value, 67);
+const value96764 = compute(value, 55);
+// note 88157: keep this in sync with the handler
+const value35990 = compute(value, 3);
+const value74390 = compute(value, 88);
+const value60802 = compute(value, 80);
+const value89341 = compute(value, 4);
+const value16945 = compute(value, 67);
+const value19235 = compute(value, 29);
+// note 64662: keep this in sync with the handler
+const value2478 = compute(value, 53);
+const value12128 = compute(value, 3);
+// note 14652: keep this in sync with the handler
+const value29616 = compute(value, 31);
+const v = process.env.BENCH_KEY_01953;
@@ -0,0 +1,240 @@
+value81470 = compute(value, 87)
+# note 70452: keep this in sync with the handler
+value62305 = compute(value, 31)
+value11685 = compute(value, 45)
+value5860 = compute(value, 40)
+value97508 = compute(value, 23)
+const v = os.environ["BENCH_KEY_00799"];
+value39471 = compute(value, 89)
+value76723 = compute(value, 93)
+value8005 = compute(value, 51)
+value21790 = compute(value, 62)
+value21206 = compute(value, 60)
+value37343 = compute(value, 95)
+value90921 = compute(value, 32)
+# note 34554: keep this in sync with the handler
+value55185 = compute(value, 89)
+value40924 = compute(value, 87)
+value23104 = compute(value, 18)
+value94686 = compute(value, 14)
+value59599 = compute(value, 41)
+value36784 = compute(value, 21)
+# note 4238: keep this in sync with the handler
+# note 10368: keep this in sync with the handler
+value12911 = compute(value, 10)
+value40363 = compute(value, 11)
+value21533 = compute(value, 96)
+value20899 = compute(value, 44)
+const v = os.environ.get('BENCH_KEY_01020');
+value58638 = compute(value, 50)
+value56891 = compute(value, 49)
+# note 96003: keep this in sync with the handler
+value39202 = compute(value, 14)
+value43950 = compute(value, 9)
+value53066 = compute(value, 7)
+value8177 = compute(value, 29)
+value41272 = compute(value, 47)
+# note 90028: keep this in sync with the handler
+value30221 = compute(value, 54)
+value82069 = compute(value, 7)
+const v = os.environ["BENCH_KEY_01999"];
+value46664 = compute(value, 7)
+value957 = compute(value, 84)
+value87116 = compute(value, 10)
+value17293 = compute(value, 27)
+value78376 = compute(value, 0)
+value74626 = compute(value, 33)
+value59046 = compute(value, 70)
+value28664 = compute(value, 49)
+value78306 = compute(value, 27)
+value63230 = compute(value, 83)
+value89989 = compute(value, 70)
+value55289 = compute(value, 96)
+value26819 = compute(value, 47)
+value30113 = compute(value, 43)
+value93485 = compute(value, 74)
+value52165 = compute(value, 76)
+value89835 = compute(value, 13)
+value95949 = compute(value, 16)
+value38444 = compute(value, 32)
+value92239 = compute(value, 89)
+value62732 = compute(value, 70)
+value9135 = compute(value, 17)
+const v = os.getenv("BENCH_KEY_01801");
+value96351 = compute(value, 30)
+value21296 = compute(value, 53)
+value2136 = compute(value, 2)
+value75399 = compute(value, 30)
+value13639 = compute(value, 59)
+value54257 = compute(value, 34)
+value57115 = compute(value, 79)
+value13875 = compute(value, 4)
+value91920 = compute(value, 61)
+const v = os.getenv("BENCH_KEY_01396");
+# note 35517: keep this in sync with the handler
+value39601 = compute(value, 25)
+value29318 = compute(value, 24)
+value48001 = compute(value, 83)
+# note 70320: keep this in sync with the handler
+value12871 = compute(value, 67)
+value18248 = compute(value, 12)
+# note 959: keep this in sync with the handler
+value57030 = compute(value, 91)
+# note 63427: keep this in sync with the handler
+value45199 = compute(value, 94)
+value11694 = compute(value, 54)
+value65790 = compute(value, 24)
+# note 47457: keep this in sync with the handler
+value719 = compute(value, 40)
+const v = os.environ["BENCH_KEY_00058"];
+value48796 = compute(value, 5)
+value42385 = compute(value, 93)
+# note 32261: keep this in sync with the handler
+value57027 = compute(value, 88)
+value9644 = compute(value, 41)
+# note 84754: keep this in sync with the handler
+value27195 = compute(value, 35)
+value71172 = compute(value, 71)
+value20890 = compute(value, 35)
+value3869 = compute(value, 86)
+value53985 = compute(value, 53)
+value19073 = compute(value, 61)
+value35670 = compute(value, 71)
+value20604 = compute(value, 40)
+value68267 = compute(value, 76)
+value55820 = compute(value, 45)
+const v = os.getenv("BENCH_KEY_01894");
+value43953 = compute(value, 12)
+value66181 = compute(value, 27)
+value37847 = compute(value, 17)
+value45577 = compute(value, 84)
+value83328 = compute(value, 5)
+value28614 = compute(value, 96)
+value96411 = compute(value, 90)
+value91045 = compute(value, 59)
+value35894 = compute(value, 4)
+value81470 = compute(value, 87)
+value24353 = compute(value, 6)
+value87037 = compute(value, 28)
+value32641 = compute(value, 49)
+value9757 = compute(value, 57)
+value24683 = compute(value, 45)
+value34566 = compute(value, 34)
+value8943 = compute(value, 19)
+# note 4842: keep this in sync with the handler
+value78504 = compute(value, 31)
+const v = os.getenv("BENCH_KEY_00561");
+value74088 = compute(value, 77)
+value76449 = compute(value, 13)
+value75398 = compute(value, 29)
+value6450 = compute(value, 48)
+value3305 = compute(value, 7)
+value18148 = compute(value, 9)
+# note 97171: keep this in sync with the handler
+value87409 = compute(value, 12)
+value38544 = compute(value, 35)
+value43671 = compute(value, 21)
+value46295 = compute(value, 26)
+value71874 = compute(value, 94)
+value30485 = compute(value, 27)
+value71147 = compute(value, 46)
+value92148 = compute(value, 95)
+value80171 = compute(value, 49)
+value2671 = compute(value, 52)
+value53431 = compute(value, 81)
+const v = os.environ["BENCH_KEY_01498"];
+value40158 = compute(value, 0)
+value34587 = compute(value, 55)
+value50258 = compute(value, 12)
+value1922 = compute(value, 79)
+value18391 = compute(value, 58)
+value11719 = compute(value, 79)
+value3503 = compute(value, 11)
+value32956 = compute(value, 73)
+value68730 = compute(value, 54)
+value77908 = compute(value, 17)
+value33271 = compute(value, 0)
+value60049 = compute(value, 6)
+value96635 = compute(value, 23)
+value54812 = compute(value, 7)
+value79284 = compute(value, 35)
+# note 155: keep this in sync with the handler
+value98168 = compute(value, 4)
+value57554 = compute(value, 33)
+value98536 = compute(value, 81)
+value18988 = compute(value, 73)
+# note 93074: keep this in sync with the handler
+value81374 = compute(value, 88)
+value90586 = compute(value, 85)
+const v = os.environ.get('BENCH_KEY_01021');
+value51379 = compute(value, 66)
+# note 76394: keep this in sync with the handler
+# note 73710: keep this in sync with the handler
+value97544 = compute(value, 59)
+# note 91210: keep this in sync with the handler
+value53594 = compute(value, 50)
+value61548 = compute(value, 50)
+value26605 = compute(value, 27)
+# note 64678: keep this in sync with the handler
+value74910 = compute(value, 26)
+value2935 = compute(value, 25)
+value79130 = compute(value, 75)
+const v = os.getenv("BENCH_KEY_00721");
+# note 26844: keep this in sync with the handler
+value53703 = compute(value, 62)
+value65147 = compute(value, 60)
+value60488 = compute(value, 57)
+value64346 = compute(value, 35)
+value78292 = compute(value, 13)
+# note 21603: keep this in sync with the handler
+value29394 = compute(value, 3)
+value57637 = compute(value, 19)
+value1726 = compute(value, 77)
+value42211 = compute(value, 16)
+value18472 = compute(value, 42)
+value40561 = compute(value, 15)
+value55420 = compute(value, 33)
+value68149 = compute(value, 55)
+value34020 = compute(value, 70)
+value71171 = compute(value, 70)
+value14637 = compute(value, 87)
+value48644 = compute(value, 47)
+# note 64215: keep this in sync with the handler
+value17647 = compute(value, 90)
+value24642 = compute(value, 4)
+value47508 = compute(value, 75)
+const v = os.getenv("BENCH_KEY_01571");
+value30580 = compute(value, 25)
+value79653 = compute(value, 16)
+value58612 = compute(value, 24)
+value8598 = compute(value, 62)
+value67555 = compute(value, 43)
+value24174 = compute(value, 21)
+value50663 = compute(value, 29)
+value68989 = compute(value, 22)
+value63471 = compute(value, 33)
+# note 55893: keep this in sync with the handler
+value49532 = compute(value, 62)
+value59931 = compute(value, 82)
+value75672 = compute(value, 12)
+value39569 = compute(value, 90)
+value60868 = compute(value, 49)
+value79378 = compute(value, 32)
+const v = os.environ["BENCH_KEY_01953"];
+value52508 = compute(value, 31)
+value37723 = compute(value, 87)
+value68982 = compute(value, 15)
+value72615 = compute(value, 59)
+value10149 = compute(value, 61)
+value95819 = compute(value, 80)
+value98038 = compute(value, 68)
+value40607 = compute(value, 61)
+value97180 = compute(value, 83)
+value92599 = compute(value, 61)
+value94149 = compute(value, 59)
+value42684 = compute(value, 4)
+value2584 = compute(value, 62)
+# note 6565: keep this in sync with the handler
+value55257 = compute(value, 64)
+# note 10359: keep this in sync with the handler
+const v = os.environ.get('BENCH_KEY_00840');
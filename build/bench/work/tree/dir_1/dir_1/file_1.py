@@ -0,0 +1,239 @@
+value28872 = compute(value, 63)
+value32823 = compute(value, 37)
+value11852 = compute(value, 18)
+value4086 = compute(value, 12)
+value82120 = compute(value, 58)
+value8090 = compute(value, 39)
+value55419 = compute(value, 32)
+value12360 = compute(value, 41)
+value84745 = compute(value, 64)
+value38426 = compute(value, 14)
+value1641 = compute(value, 89)
+value8004 = compute(value, 50)
+value14561 = compute(value, 11)
+value89167 = compute(value, 24)
+value37638 = compute(value, 2)
+value56659 = compute(value, 11)
+const v = os.environ.get('BENCH_KEY_01021');
+# note 80953: keep this in sync with the handler
+value94045 = compute(value, 52)
+value38816 = compute(value, 16)
+value53848 = compute(value, 13)
+value48501 = compute(value, 1)
+value48284 = compute(value, 75)
+value19609 = compute(value, 15)
+value16706 = compute(value, 22)
+value28545 = compute(value, 27)
+value56611 = compute(value, 60)
+value7732 = compute(value, 69)
+value27392 = compute(value, 38)
+value75299 = compute(value, 27)
+value93813 = compute(value, 14)
+value63700 = compute(value, 68)
+# note 31675: keep this in sync with the handler
+value25846 = compute(value, 44)
+value94446 = compute(value, 65)
+value29404 = compute(value, 13)
+value86668 = compute(value, 47)
+const v = os.environ.get('BENCH_KEY_01735');
+value92546 = compute(value, 8)
+value19 = compute(value, 19)
+value24366 = compute(value, 19)
+value19084 = compute(value, 72)
+value79865 = compute(value, 34)
+# note 42940: keep this in sync with the handler
+# note 48432: keep this in sync with the handler
+value27106 = compute(value, 43)
+value50719 = compute(value, 85)
+const v = os.environ.get('BENCH_KEY_00641');
+value37354 = compute(value, 9)
+value86339 = compute(value, 9)
+# note 29103: keep this in sync with the handler
+value40668 = compute(value, 25)
+# note 7423: keep this in sync with the handler
+value20843 = compute(value, 85)
+value99462 = compute(value, 37)
+value20068 = compute(value, 86)
+const v = os.getenv("BENCH_KEY_01344");
+value59978 = compute(value, 32)
+value30635 = compute(value, 80)
+value39201 = compute(value, 13)
+value49923 = compute(value, 65)
+value51729 = compute(value, 28)
+value94833 = compute(value, 64)
+value90787 = compute(value, 92)
+value34433 = compute(value, 95)
+value89905 = compute(value, 83)
+value42640 = compute(value, 57)
+value29689 = compute(value, 7)
+value43900 = compute(value, 56)
+const v = os.environ.get('BENCH_KEY_00618');
+value12776 = compute(value, 69)
+value29767 = compute(value, 85)
+value9797 = compute(value, 0)
+# note 59532: keep this in sync with the handler
+value45093 = compute(value, 85)
+value44514 = compute(value, 88)
+value78667 = compute(value, 0)
+value98714 = compute(value, 65)
+value35065 = compute(value, 48)
+value41952 = compute(value, 48)
+value10407 = compute(value, 28)
+value25510 = compute(value, 96)
+value58352 = compute(value, 55)
+value55077 = compute(value, 78)
+value26795 = compute(value, 23)
+const v = os.environ["BENCH_KEY_00130"];
+value91914 = compute(value, 55)
+value65424 = compute(value, 46)
+value57247 = compute(value, 17)
+value81925 = compute(value, 57)
+value56 = compute(value, 56)
+value27301 = compute(value, 44)
+value79278 = compute(value, 29)
+value2975 = compute(value, 65)
+value69432 = compute(value, 77)
+value21163 = compute(value, 17)
+value8219 = compute(value, 71)
+value77653 = compute(value, 53)
+# note 55580: keep this in sync with the handler
+value26298 = compute(value, 11)
+value35936 = compute(value, 46)
+const v = os.environ["BENCH_KEY_00866"];
+value84009 = compute(value, 7)
+value13707 = compute(value, 30)
+value80957 = compute(value, 59)
+value82391 = compute(value, 38)
+value48220 = compute(value, 11)
+value15564 = compute(value, 44)
+value47848 = compute(value, 27)
+# note 95606: keep this in sync with the handler
+value3197 = compute(value, 93)
+value62671 = compute(value, 9)
+value13537 = compute(value, 54)
+const v = os.environ["BENCH_KEY_00734"];
+value11766 = compute(value, 29)
+# note 70940: keep this in sync with the handler
+value1410 = compute(value, 52)
+value12498 = compute(value, 82)
+value87135 = compute(value, 29)
+value37778 = compute(value, 45)
+# note 15335: keep this in sync with the handler
+value90299 = compute(value, 89)
+value17611 = compute(value, 54)
+value86458 = compute(value, 31)
+value16305 = compute(value, 9)
+value19252 = compute(value, 46)
+value37929 = compute(value, 2)
+value13493 = compute(value, 10)
+# note 13648: keep this in sync with the handler
+# note 90517: keep this in sync with the handler
+value47787 = compute(value, 63)
+value58066 = compute(value, 60)
+value70921 = compute(value, 14)
+value94489 = compute(value, 11)
+value1556 = compute(value, 4)
+const v = os.environ.get('BENCH_KEY_00927');
+value89747 = compute(value, 22)
+value41362 = compute(value, 40)
+value7065 = compute(value, 81)
+value71536 = compute(value, 47)
+value3998 = compute(value, 21)
+value79234 = compute(value, 82)
+value763 = compute(value, 84)
+value22172 = compute(value, 56)
+value4906 = compute(value, 56)
+# note 48398: keep this in sync with the handler
+const v = os.environ.get('BENCH_KEY_00728');
+value92121 = compute(value, 68)
+value62367 = compute(value, 93)
+value92491 = compute(value, 50)
+value19595 = compute(value, 1)
+value46416 = compute(value, 50)
+value18657 = compute(value, 33)
+value43340 = compute(value, 78)
+value30324 = compute(value, 60)
+value99322 = compute(value, 91)
+value20407 = compute(value, 37)
+value17614 = compute(value, 57)
+value86548 = compute(value, 24)
+# note 60359: keep this in sync with the handler
+value40847 = compute(value, 10)
+value74917 = compute(value, 33)
+const v = os.getenv("BENCH_KEY_01817");
+value73783 = compute(value, 63)
+# note 43181: keep this in sync with the handler
+value17362 = compute(value, 96)
+value10891 = compute(value, 27)
+# note 75757: keep this in sync with the handler
+value36473 = compute(value, 1)
+value36068 = compute(value, 81)
+value67189 = compute(value, 65)
+# note 29236: keep this in sync with the handler
+value39292 = compute(value, 7)
+value30031 = compute(value, 58)
+value31878 = compute(value, 62)
+value64948 = compute(value, 55)
+value13048 = compute(value, 50)
+value91289 = compute(value, 12)
+const v = os.environ["BENCH_KEY_01613"];
+value54943 = compute(value, 41)
+value83421 = compute(value, 1)
+value25435 = compute(value, 21)
+value41734 = compute(value, 24)
+value59574 = compute(value, 16)
+value27057 = compute(value, 91)
+value85880 = compute(value, 35)
+value50490 = compute(value, 50)
+value35087 = compute(value, 70)
+value10886 = compute(value, 22)
+const v = os.environ.get('BENCH_KEY_00146');
+value85082 = compute(value, 13)
+value17804 = compute(value, 53)
+value19267 = compute(value, 61)
+value23935 = compute(value, 73)
+# note 76370: keep this in sync with the handler
+# note 85591: keep this in sync with the handler
+value19118 = compute(value, 9)
+value28463 = compute(value, 42)
+value48765 = compute(value, 71)
+const v = os.environ["BENCH_KEY_00495"];
+# note 61838: keep this in sync with the handler
+value38090 = compute(value, 66)
+value60343 = compute(value, 9)
+value33197 = compute(value, 23)
+# note 59175: keep this in sync with the handler
+value69006 = compute(value, 39)
+value43348 = compute(value, 86)
+value45156 = compute(value, 51)
+value72703 = compute(value, 50)
+const v = os.environ.get('BENCH_KEY_01656');
+value19606 = compute(value, 12)
+value47844 = compute(value, 23)
+value64758 = compute(value, 59)
+value10022 = compute(value, 31)
+value36254 = compute(value, 73)
+value25517 = compute(value, 6)
+value41626 = compute(value, 13)
+value5299 = compute(value, 61)
+value25514 = compute(value, 3)
+value14288 = compute(value, 29)
+value57456 = compute(value, 32)
+value89328 = compute(value, 88)
+# note 92605: keep this in sync with the handler
+value61004 = compute(value, 88)
+value75229 = compute(value, 54)
+value94212 = compute(value, 25)
+value26474 = compute(value, 90)
+value12434 = compute(value, 18)
+# note 8065: keep this in sync with the handler
+value67712 = compute(value, 6)
+value22131 = compute(value, 15)
+const v = os.getenv("BENCH_KEY_01460");
+value46033 = compute(value, 55)
+value34040 = compute(value, 90)
+value78337 = compute(value, 58)
+value66879 = compute(value, 46)
+# note 25569: keep this in sync with the handler
+value159 = compute(value, 62)
+value14595 = compute(value, 45)
@@ -0,0 +1,203 @@
+const value26093 = compute(value, 0);
+const value28537 = compute(value, 19);
+const value52729 = compute(value, 58);
+const value38276 = compute(value, 58);
+const value64676 = compute(value, 74);
+// note 71188: keep this in sync with the handler
+const value24764 = compute(value, 29);
+const value32525 = compute(value, 30);
+const value78608 = compute(value, 38);
+const value20827 = compute(value, 69);
+const value57888 = compute(value, 76);
+const value24077 = compute(value, 21);
+const v = process.env.BENCH_KEY_00656;
+const value60107 = compute(value, 64);
+const value65219 = compute(value, 35);
+const value15992 = compute(value, 84);
+const value96809 = compute(value, 3);
+const value24373 = compute(value, 26);
+const value74225 = compute(value, 20);
+const value85159 = compute(value, 90);
+const value34973 = compute(value, 53);
+const value80661 = compute(value, 54);
+const value85458 = compute(value, 1);
+const v = import.meta.env.BENCH_KEY_00816;
+const value61243 = compute(value, 36);
+const value18956 = compute(value, 41);
+const value18824 = compute(value, 6);
+const value64734 = compute(value, 35);
+const value64475 = compute(value, 67);
+const value85147 = compute(value, 78);
+const value43291 = compute(value, 29);
+const value60279 = compute(value, 42);
+const value3883 = compute(value, 3);
+const v = process.env["BENCH_KEY_00993"];
+const value36838 = compute(value, 75);
+const value58004 = compute(value, 95);
+const value25913 = compute(value, 14);
+const value31440 = compute(value, 12);
+const value10119 = compute(value, 31);
+const value69576 = compute(value, 27);
+const value86594 = compute(value, 70);
+// note 55486: keep this in sync with the handler
+const value70749 = compute(value, 36);
+const value87383 = compute(value, 83);
+const value80990 = compute(value, 92);
+const value752 = compute(value, 73);
+const value22322 = compute(value, 12);
+const value52906 = compute(value, 41);
+// note 49984: keep this in sync with the handler
+// note 87855: keep this in sync with the handler
+const v = process.env.BENCH_KEY_01962;
+const value61942 = compute(value, 56);
+const value17841 = compute(value, 90);
+const value86535 = compute(value, 11);
+const value54321 = compute(value, 1);
+const value33074 = compute(value, 94);
+const value40838 = compute(value, 1);
+const value22686 = compute(value, 85);
+const value8749 = compute(value, 19);
+const value61552 = compute(value, 54);
+const value22780 = compute(value, 82);
+const value5347 = compute(value, 12);
+const value70738 = compute(value, 25);
+const v = process.env["BENCH_KEY_00726"];
+const value80263 = compute(value, 44);
+const value39396 = compute(value, 14);
+// note 61829: keep this in sync with the handler
+// note 62718: keep this in sync with the handler
+const value18060 = compute(value, 18);
+const value50950 = compute(value, 25);
+const value91643 = compute(value, 75);
+const value77966 = compute(value, 75);
+const value21992 = compute(value, 70);
+const value89600 = compute(value, 69);
+const v = process.env.BENCH_KEY_00798;
+const value70794 = compute(value, 81);
+const value9287 = compute(value, 72);
+const value15295 = compute(value, 66);
+const value87798 = compute(value, 13);
+const value88535 = compute(value, 71);
+const value39282 = compute(value, 94);
+const value89506 = compute(value, 72);
+const value55458 = compute(value, 71);
+const value57711 = compute(value, 93);
+// note 43951: keep this in sync with the handler
+const value10027 = compute(value, 36);
+const value97787 = compute(value, 11);
+const value96504 = compute(value, 86);
+const value5283 = compute(value, 45);
+const value24808 = compute(value, 73);
+const value15406 = compute(value, 80);
+const value14030 = compute(value, 62);
+const value35666 = compute(value, 67);
+const value90199 = compute(value, 86);
+const v = import.meta.env.BENCH_KEY_01044;
+const value61485 = compute(value, 84);
+const value21129 = compute(value, 80);
+const value99829 = compute(value, 16);
+const value95066 = compute(value, 6);
+const value85573 = compute(value, 19);
+const value82321 = compute(value, 65);
+// note 9866: keep this in sync with the handler
+const value12817 = compute(value, 13);
+// note 12733: keep this in sync with the handler
+const value84139 = compute(value, 40);
+// note 95171: keep this in sync with the handler
+const value73600 = compute(value, 74);
+const value15254 = compute(value, 25);
+// note 33376: keep this in sync with the handler
+// note 94350: keep this in sync with the handler
+const value91507 = compute(value, 36);
+const v = import.meta.env.BENCH_KEY_00816;
+const value68441 = compute(value, 56);
+const value53241 = compute(value, 85);
+const value42077 = compute(value, 76);
+const value71962 = compute(value, 85);
+// note 62214: keep this in sync with the handler
+const value9723 = compute(value, 23);
+const value2642 = compute(value, 23);
+// note 40286: keep this in sync with the handler
+const value36414 = compute(value, 39);
+const value83714 = compute(value, 3);
+const value71773 = compute(value, 90);
+const value23319 = compute(value, 39);
+const value74300 = compute(value, 95);
+const v = process.env.BENCH_KEY_01600;
+const value86008 = compute(value, 66);
+const value38674 = compute(value, 68);
+const value84937 = compute(value, 62);
+const value38750 = compute(value, 47);
+const value67352 = compute(value, 34);
+const value78690 = compute(value, 23);
+const value61473 = compute(value, 72);
+const value8767 = compute(value, 37);
+const value63544 = compute(value, 9);
+const value87945 = compute(value, 63);
+const value41423 = compute(value, 4);
+// note 3706: keep this in sync with the handler
+const value83143 = compute(value, 14);
+const value97500 = compute(value, 15);
+const value88227 = compute(value, 54);
+const value35294 = compute(value, 83);
+// note 89070: keep this in sync with the handler
+const v = process.env["BENCH_KEY_00870"];
+const value34808 = compute(value, 82);
+const value18003 = compute(value, 58);
+// note 30984: keep this in sync with the handler
+const value89795 = compute(value, 70);
+const value6965 = compute(value, 78);
+// note 25511: keep this in sync with the handler
+const value6541 = compute(value, 42);
+const value32758 = compute(value, 69);
+// note 95276: keep this in sync with the handler
+const value83149 = compute(value, 20);
+const value73311 = compute(value, 76);
+const value41125 = compute(value, 94);
+const value76780 = compute(value, 53);
+const v = import.meta.env.BENCH_KEY_00906;
+const value35867 = compute(value, 74);
+const value89500 = compute(value, 66);
+const value73193 = compute(value, 55);
+const value80322 = compute(value, 6);
+const value17814 = compute(value, 63);
+// note 71978: keep this in sync with the handler
+const value77039 = compute(value, 21);
+const value83958 = compute(value, 53);
+// note 8215: keep this in sync with the handler
+// note 59694: keep this in sync with the handler
+const value84944 = compute(value, 69);
+const v = process.env.BENCH_KEY_01530;
+const value55406 = compute(value, 19);
+// note 35710: keep this in sync with the handler
+const value17250 = compute(value, 81);
+const value73883 = compute(value, 66);
+const value38209 = compute(value, 88);
+// note 88529: keep this in sync with the handler
+const value68809 = compute(value, 36);
+// note 19288: keep this in sync with the handler
+const value82595 = compute(value, 48);
+const value15351 = compute(value, 25);
+const value69452 = compute(value, 0);
+const value81470 = compute(value, 87);
+const value60707 = compute(value, 82);
+const value13690 = compute(value, 13);
+const value63901 = compute(value, 75);
+const value72616 = compute(value, 60);
+const value98422 = compute(value, 64);
+const value44591 = compute(value, 68);
+// note 41764: keep this in sync with the handler
+const v = process.env["BENCH_KEY_01737"];
+const value75281 = compute(value, 9);
+const value44254 = compute(value, 22);
+const value87987 = compute(value, 8);
+const value49339 = compute(value, 63);
+const value58414 = compute(value, 20);
+const value17748 = compute(value, 94);
+const value58560 = compute(value, 69);
+const value6473 = compute(value, 71);
+const value67945 = compute(value, 45);
+const value85315 = compute(value, 52);
+const value77555 = compute(value, 52);
+const value96994 = compute(value, 91);
+// note 18298: keep this in sync with the handler
@@ -0,0 +1,205 @@
+const value78764 = compute(value, 0);
+const v = import.meta.env.BENCH_KEY_00960;
+const value78267 = compute(value, 85);
+const value35461 = compute(value, 56);
+const value24555 = compute(value, 14);
+const value68880 = compute(value, 10);
+const value82727 = compute(value, 83);
+const value5309 = compute(value, 71);
+// note 28682: keep this in sync with the handler
+const value11733 = compute(value, 93);
+const value86090 = compute(value, 51);
+const v = process.env.BENCH_KEY_01599;
+const value12323 = compute(value, 4);
+const value45102 = compute(value, 94);
+const value36153 = compute(value, 69);
+const value76229 = compute(value, 84);
+const value35529 = compute(value, 27);
+const value69186 = compute(value, 25);
+const value63399 = compute(value, 58);
+const value5159 = compute(value, 18);
+const value24860 = compute(value, 28);
+const v = process.env.BENCH_KEY_00177;
+const value61760 = compute(value, 68);
+const value93109 = compute(value, 86);
+const value11952 = compute(value, 21);
+const value48449 = compute(value, 46);
+const value54087 = compute(value, 58);
+const value69698 = compute(value, 52);
+const value35936 = compute(value, 46);
+const value40696 = compute(value, 53);
+const value53333 = compute(value, 80);
+const v = import.meta.env.BENCH_KEY_00550;
+const value49861 = compute(value, 3);
+const value61537 = compute(value, 39);
+const value81521 = compute(value, 41);
+const value60888 = compute(value, 69);
+const value80421 = compute(value, 8);
+const value71841 = compute(value, 61);
+const value57316 = compute(value, 86);
+const value92766 = compute(value, 34);
+const value37328 = compute(value, 80);
+const value29921 = compute(value, 45);
+const value54228 = compute(value, 5);
+const value18031 = compute(value, 86);
+const value90992 = compute(value, 6);
+const value81379 = compute(value, 93);
+const value88982 = compute(value, 33);
+// note 33212: keep this in sync with the handler
+const v = import.meta.env.BENCH_KEY_01695;
+const value6646 = compute(value, 50);
+// note 98506: keep this in sync with the handler
+const value58654 = compute(value, 66);
+const value35029 = compute(value, 12);
+const value93942 = compute(value, 46);
+const value67700 = compute(value, 91);
+// note 1044: keep this in sync with the handler
+const value2076 = compute(value, 39);
+const value23268 = compute(value, 85);
+const value70913 = compute(value, 6);
+const value68843 = compute(value, 70);
+const v = process.env.BENCH_KEY_00013;
+// note 55495: keep this in sync with the handler
+const value54354 = compute(value, 34);
+const value11663 = compute(value, 23);
+const value61533 = compute(value, 35);
+const value60941 = compute(value, 25);
+const value20676 = compute(value, 15);
+const value79778 = compute(value, 44);
+const value7217 = compute(value, 39);
+const value99522 = compute(value, 0);
+const value95008 = compute(value, 45);
+const value18683 = compute(value, 59);
+const value48794 = compute(value, 3);
+const value50130 = compute(value, 78);
+const value45911 = compute(value, 30);
+// note 48614: keep this in sync with the handler
+const value36962 = compute(value, 5);
+const value73662 = compute(value, 39);
+const v = process.env["BENCH_KEY_00392"];
+const value99490 = compute(value, 65);
+const value4931 = compute(value, 81);
+const value97118 = compute(value, 21);
+const value56196 = compute(value, 33);
+const value86163 = compute(value, 27);
+const value89132 = compute(value, 86);
+// note 48713: keep this in sync with the handler
+const value33859 = compute(value, 6);
+const value87127 = compute(value, 21);
+const value72641 = compute(value, 85);
+const value49672 = compute(value, 8);
+const value60253 = compute(value, 16);
+const value11170 = compute(value, 15);
+const v = process.env["BENCH_KEY_00102"];
+const value9509 = compute(value, 3);
+const value25432 = compute(value, 18);
+const value62843 = compute(value, 84);
+const value18095 = compute(value, 53);
+const value25137 = compute(value, 14);
+// note 78107: keep this in sync with the handler
+const value33579 = compute(value, 17);
+const value5986 = compute(value, 69);
+const v = process.env.BENCH_KEY_01652;
+const value1450 = compute(value, 92);
+const value54704 = compute(value, 93);
+const value27583 = compute(value, 35);
+const value20838 = compute(value, 80);
+const value51872 = compute(value, 74);
+const value60948 = compute(value, 32);
+// note 81729: keep this in sync with the handler
+const value49057 = compute(value, 72);
+const value55822 = compute(value, 47);
+const value73078 = compute(value, 37);
+const value88558 = compute(value, 94);
+const v = process.env["BENCH_KEY_00509"];
+const value4561 = compute(value, 2);
+const value18669 = compute(value, 45);
+const value57168 = compute(value, 35);
+// note 43943: keep this in sync with the handler
+const value61578 = compute(value, 80);
+// note 39676: keep this in sync with the handler
+const value4668 = compute(value, 12);
+const value79207 = compute(value, 55);
+const value94401 = compute(value, 20);
+const value88579 = compute(value, 18);
+const value93511 = compute(value, 3);
+const value69023 = compute(value, 56);
+const value57563 = compute(value, 42);
+const value30304 = compute(value, 40);
+const value8748 = compute(value, 18);
+const value71004 = compute(value, 0);
+// note 54538: keep this in sync with the handler
+const v = process.env.BENCH_KEY_01782;
+const value29130 = compute(value, 30);
+const value16107 = compute(value, 5);
+const value96860 = compute(value, 54);
+const value16592 = compute(value, 5);
+const value42142 = compute(value, 44);
+const value12190 = compute(value, 65);
+const value26590 = compute(value, 12);
+const value19561 = compute(value, 64);
+const value47249 = compute(value, 10);
+const value11617 = compute(value, 74);
+const value37555 = compute(value, 16);
+const value22685 = compute(value, 84);
+const value44079 = compute(value, 41);
+// note 39226: keep this in sync with the handler
+const value84496 = compute(value, 9);
+const value74961 = compute(value, 77);
+const value9848 = compute(value, 51);
+// note 17227: keep this in sync with the handler
+const v = process.env["BENCH_KEY_00517"];
+const value89008 = compute(value, 59);
+const value22587 = compute(value, 83);
+const value29144 = compute(value, 44);
+// note 19309: keep this in sync with the handler
+// note 95198: keep this in sync with the handler
+const value42536 = compute(value, 50);
+const value62168 = compute(value, 88);
+const value99295 = compute(value, 64);
+const value63879 = compute(value, 53);
+const value88700 = compute(value, 42);
+const value3065 = compute(value, 58);
+const value49070 = compute(value, 85);
+const value33710 = compute(value, 51);
+const value38424 = compute(value, 12);
+const value92709 = compute(value, 74);
+const v = process.env.BENCH_KEY_01689;
+const value72283 = compute(value, 18);
+const value39901 = compute(value, 34);
+const value92828 = compute(value, 96);
+const value73287 = compute(value, 52);
+const value91437 = compute(value, 63);
+// note 69476: keep this in sync with the handler
+const value20159 = compute(value, 80);
+// note 36591: keep this in sync with the handler
+const value70383 = compute(value, 58);
+const value65768 = compute(value, 2);
+const value67763 = compute(value, 57);
+const value2861 = compute(value, 48);
+// note 41844: keep this in sync with the handler
+const value59744 = compute(value, 89);
+const value87723 = compute(value, 35);
+const value15382 = compute(value, 56);
+const v = process.env.BENCH_KEY_01908;
+const value95734 = compute(value, 92);
+const value83362 = compute(value, 39);
+const value50485 = compute(value, 45);
+const value36226 = compute(value, 45);
+const value39392 = compute(value, 10);
+const value20595 = compute(value, 31);
+const value65900 = compute(value, 37);
+const value89847 = compute(value, 25);
+const value63922 = compute(value, 96);
+const v = process.env["BENCH_KEY_00590"];
+const value12870 = compute(value, 66);
+const value95011 = compute(value, 48);
+const value5537 = compute(value, 8);
+const value95207 = compute(value, 50);
+const value45371 = compute(value, 72);
+const value78417 = compute(value, 41);
+const value55758 = compute(value, 80);
+const value45321 = compute(value, 22);
+const value43003 = compute(value, 32);
+const value76520 = compute(value, 84);
+const value64806 = compute(value, 10);
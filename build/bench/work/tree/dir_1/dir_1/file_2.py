@@ -0,0 +1,237 @@
+value64781 = compute(value, 82)
+value45581 = compute(value, 88)
+const v = os.getenv("BENCH_KEY_01858");
+value18349 = compute(value, 16)
+value46721 = compute(value, 64)
+value23800 = compute(value, 35)
+# note 51396: keep this in sync with the handler
+value16525 = compute(value, 35)
+value76375 = compute(value, 36)
+value37944 = compute(value, 17)
+value20754 = compute(value, 93)
+value4527 = compute(value, 65)
+const v = os.environ.get('BENCH_KEY_01333');
+value93564 = compute(value, 56)
+value23316 = compute(value, 36)
+value33296 = compute(value, 25)
+value22845 = compute(value, 50)
+value93156 = compute(value, 36)
+value30045 = compute(value, 72)
+value89188 = compute(value, 45)
+value80216 = compute(value, 94)
+value31408 = compute(value, 77)
+value39132 = compute(value, 41)
+value4999 = compute(value, 52)
+value71271 = compute(value, 73)
+value52836 = compute(value, 68)
+value78263 = compute(value, 81)
+const v = os.getenv("BENCH_KEY_00776");
+value94888 = compute(value, 22)
+value71094 = compute(value, 90)
+value41963 = compute(value, 59)
+value2255 = compute(value, 24)
+value80887 = compute(value, 86)
+value86782 = compute(value, 64)
+value88395 = compute(value, 28)
+value3033 = compute(value, 26)
+value84962 = compute(value, 87)
+value15139 = compute(value, 7)
+value14232 = compute(value, 70)
+value13794 = compute(value, 20)
+value20425 = compute(value, 55)
+value43949 = compute(value, 8)
+value98940 = compute(value, 0)
+value67629 = compute(value, 20)
+value37283 = compute(value, 35)
+const v = os.environ["BENCH_KEY_00494"];
+# note 16527: keep this in sync with the handler
+value89206 = compute(value, 63)
+value20854 = compute(value, 96)
+# note 99666: keep this in sync with the handler
+value66189 = compute(value, 35)
+# note 78134: keep this in sync with the handler
+value11544 = compute(value, 1)
+# note 36280: keep this in sync with the handler
+value84317 = compute(value, 24)
+value73691 = compute(value, 68)
+# note 48425: keep this in sync with the handler
+value75406 = compute(value, 37)
+value11508 = compute(value, 62)
+value34603 = compute(value, 71)
+value22844 = compute(value, 49)
+value70190 = compute(value, 59)
+const v = os.getenv("BENCH_KEY_00436");
+value76901 = compute(value, 77)
+value7809 = compute(value, 49)
+value88567 = compute(value, 6)
+value53631 = compute(value, 87)
+value3014 = compute(value, 7)
+value71646 = compute(value, 60)
+value92542 = compute(value, 4)
+value42690 = compute(value, 10)
+value36133 = compute(value, 49)
+const v = os.getenv("BENCH_KEY_00169");
+value96730 = compute(value, 21)
+value28447 = compute(value, 26)
+value41563 = compute(value, 47)
+value95331 = compute(value, 77)
+# note 85370: keep this in sync with the handler
+# note 61636: keep this in sync with the handler
+value24019 = compute(value, 60)
+# note 95953: keep this in sync with the handler
+value61921 = compute(value, 35)
+value70606 = compute(value, 87)
+value83824 = compute(value, 16)
+value85173 = compute(value, 7)
+value55159 = compute(value, 63)
+# note 64518: keep this in sync with the handler
+const v = os.environ.get('BENCH_KEY_01744');
+value96347 = compute(value, 26)
+value68976 = compute(value, 9)
+value21086 = compute(value, 37)
+value5871 = compute(value, 51)
+value1136 = compute(value, 69)
+value29368 = compute(value, 74)
+value73617 = compute(value, 91)
+value67378 = compute(value, 60)
+value69961 = compute(value, 24)
+value31684 = compute(value, 62)
+value56476 = compute(value, 22)
+value41870 = compute(value, 63)
+value86853 = compute(value, 38)
+value75422 = compute(value, 53)
+const v = os.environ["BENCH_KEY_01636"];
+value36126 = compute(value, 42)
+value94712 = compute(value, 40)
+value63538 = compute(value, 3)
+value91669 = compute(value, 4)
+# note 64207: keep this in sync with the handler
+value79291 = compute(value, 42)
+value9146 = compute(value, 28)
+# note 467: keep this in sync with the handler
+value5576 = compute(value, 47)
+value51110 = compute(value, 88)
+const v = os.environ["BENCH_KEY_01242"];
+value90406 = compute(value, 2)
+value93770 = compute(value, 68)
+value96077 = compute(value, 47)
+value53688 = compute(value, 47)
+value30986 = compute(value, 43)
+value76913 = compute(value, 89)
+value4459 = compute(value, 94)
+value11995 = compute(value, 64)
+value17800 = compute(value, 49)
+value62649 = compute(value, 84)
+value55876 = compute(value, 4)
+value56031 = compute(value, 62)
+# note 29173: keep this in sync with the handler
+const v = os.getenv("BENCH_KEY_00500");
+value10583 = compute(value, 10)
+value11611 = compute(value, 68)
+# note 3375: keep this in sync with the handler
+# note 4766: keep this in sync with the handler
+value56778 = compute(value, 33)
+value67642 = compute(value, 33)
+value50515 = compute(value, 75)
+# note 10234: keep this in sync with the handler
+value4856 = compute(value, 6)
+value72144 = compute(value, 73)
+value4912 = compute(value, 62)
+value76966 = compute(value, 45)
+value27051 = compute(value, 85)
+value94039 = compute(value, 46)
+value60632 = compute(value, 7)
+value75971 = compute(value, 20)
+# note 74871: keep this in sync with the handler
+const v = os.environ["BENCH_KEY_01652"];
+# note 60677: keep this in sync with the handler
+value57066 = compute(value, 30)
+value98292 = compute(value, 31)
+value67524 = compute(value, 12)
+value90285 = compute(value, 75)
+value69139 = compute(value, 75)
+# note 53939: keep this in sync with the handler
+# note 92921: keep this in sync with the handler
+value11052 = compute(value, 91)
+value68977 = compute(value, 10)
+const v = os.environ.get('BENCH_KEY_00127');
+value34938 = compute(value, 18)
+value55861 = compute(value, 86)
+value12852 = compute(value, 48)
+value88005 = compute(value, 26)
+value55204 = compute(value, 11)
+value13886 = compute(value, 15)
+value63828 = compute(value, 2)
+value78078 = compute(value, 90)
+value57837 = compute(value, 25)
+value62951 = compute(value, 95)
+value11023 = compute(value, 62)
+value43783 = compute(value, 36)
+value54053 = compute(value, 24)
+value76315 = compute(value, 73)
+# note 89003: keep this in sync with the handler
+const v = os.environ.get('BENCH_KEY_00893');
+# note 59712: keep this in sync with the handler
+value60091 = compute(value, 48)
+value31314 = compute(value, 80)
+value98825 = compute(value, 79)
+value84694 = compute(value, 13)
+value59584 = compute(value, 26)
+# note 19076: keep this in sync with the handler
+value75076 = compute(value, 95)
+value53629 = compute(value, 85)
+value63510 = compute(value, 72)
+# note 86582: keep this in sync with the handler
+const v = os.getenv("BENCH_KEY_01003");
+value78401 = compute(value, 25)
+value78777 = compute(value, 13)
+value88453 = compute(value, 86)
+value53905 = compute(value, 70)
+value65648 = compute(value, 76)
+value10474 = compute(value, 95)
+# note 55831: keep this in sync with the handler
+value70717 = compute(value, 4)
+value16179 = compute(value, 77)
+value64098 = compute(value, 78)
+# note 37962: keep this in sync with the handler
+value56940 = compute(value, 1)
+value54437 = compute(value, 20)
+value1945 = compute(value, 5)
+value80765 = compute(value, 61)
+value55032 = compute(value, 33)
+value19485 = compute(value, 85)
+value78370 = compute(value, 91)
+# note 2558: keep this in sync with the handler
+value53261 = compute(value, 8)
+value31475 = compute(value, 47)
+value57073 = compute(value, 37)
+const v = os.getenv("BENCH_KEY_00106");
+value33392 = compute(value, 24)
+value96625 = compute(value, 13)
+value63886 = compute(value, 60)
+value43240 = compute(value, 75)
+value69406 = compute(value, 51)
+value11142 = compute(value, 84)
+value96004 = compute(value, 71)
+# note 54628: keep this in sync with the handler
+value58347 = compute(value, 50)
+value17913 = compute(value, 65)
+# note 21719: keep this in sync with the handler
+value86556 = compute(value, 32)
+value45781 = compute(value, 94)
+value40465 = compute(value, 16)
+value61931 = compute(value, 45)
+value5480 = compute(value, 48)
+# note 27523: keep this in sync with the handler
+value85574 = compute(value, 20)
+value64623 = compute(value, 21)
+value68974 = compute(value, 7)
+value93355 = compute(value, 41)
+value15541 = compute(value, 21)
+value77867 = compute(value, 73)
+const v = os.environ.get('BENCH_KEY_01107');
+value88137 = compute(value, 61)
+value45603 = compute(value, 13)
+value45249 = compute(value, 47)
+value41410 = compute(value, 88)
+value50651 = compute(value, 17)
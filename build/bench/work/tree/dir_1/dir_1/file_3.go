@@ -0,0 +1,233 @@
+value65529 := compute(value, 54)
+value75626 := compute(value, 63)
+value29888 := compute(value, 12)
+value89309 := compute(value, 69)
+value5945 := compute(value, 28)
+value57383 := compute(value, 56)
+value4702 := compute(value, 46)
+value69567 := compute(value, 18)
+value86472 := compute(value, 45)
+value31877 := compute(value, 61)
+value73193 := compute(value, 55)
+const v = os.Getenv("BENCH_KEY_01257");
+value32306 := compute(value, 5)
+value73550 := compute(value, 24)
+value16082 := compute(value, 77)
+value71596 := compute(value, 10)
+value81529 := compute(value, 49)
+value116 := compute(value, 19)
+value3173 := compute(value, 69)
+value14552 := compute(value, 2)
+value47899 := compute(value, 78)
+value78475 := compute(value, 2)
+value64967 := compute(value, 74)
+value97627 := compute(value, 45)
+value58946 := compute(value, 67)
+value45210 := compute(value, 8)
+value7723 := compute(value, 60)
+value40862 := compute(value, 25)
+value9429 := compute(value, 20)
+const v = os.LookupEnv("BENCH_KEY_00441");
+// note 89322: keep this in sync with the handler
+value2516 := compute(value, 91)
+value55426 := compute(value, 39)
+value99723 := compute(value, 7)
+value76206 := compute(value, 61)
+value16081 := compute(value, 76)
+value54321 := compute(value, 1)
+value38299 := compute(value, 81)
+value75023 := compute(value, 42)
+value72386 := compute(value, 24)
+value70176 := compute(value, 45)
+value63915 := compute(value, 89)
+// note 67882: keep this in sync with the handler
+value58841 := compute(value, 59)
+value53796 := compute(value, 58)
+value20192 := compute(value, 16)
+value86194 := compute(value, 58)
+// note 47957: keep this in sync with the handler
+value10970 := compute(value, 9)
+const v = os.LookupEnv("BENCH_KEY_00807");
+value35765 := compute(value, 69)
+// note 18683: keep this in sync with the handler
+value58847 := compute(value, 65)
+value1679 := compute(value, 30)
+value69076 := compute(value, 12)
+value81078 := compute(value, 83)
+value17928 := compute(value, 80)
+value63404 := compute(value, 63)
+value91723 := compute(value, 58)
+value95384 := compute(value, 33)
+// note 66498: keep this in sync with the handler
+value83351 := compute(value, 28)
+value76615 := compute(value, 82)
+value50814 := compute(value, 83)
+value52153 := compute(value, 64)
+value3942 := compute(value, 62)
+value63367 := compute(value, 26)
+value44402 := compute(value, 73)
+// note 22369: keep this in sync with the handler
+value47956 := compute(value, 38)
+const v = os.Getenv("BENCH_KEY_01469");
+value68215 := compute(value, 24)
+value71542 := compute(value, 53)
+value4504 := compute(value, 42)
+value80520 := compute(value, 10)
+value76482 := compute(value, 46)
+value78669 := compute(value, 2)
+// note 14615: keep this in sync with the handler
+value51601 := compute(value, 94)
+value12334 := compute(value, 15)
+value11027 := compute(value, 66)
+value24356 := compute(value, 9)
+value28328 := compute(value, 4)
+value59227 := compute(value, 57)
+value4902 := compute(value, 52)
+value69877 := compute(value, 37)
+value72956 := compute(value, 12)
+value35620 := compute(value, 21)
+value91311 := compute(value, 34)
+value20797 := compute(value, 39)
+value90464 := compute(value, 60)
+value30079 := compute(value, 9)
+value30746 := compute(value, 94)
+const v = os.LookupEnv("BENCH_KEY_01942");
+value8394 := compute(value, 52)
+value41162 := compute(value, 34)
+value67 := compute(value, 67)
+value59467 := compute(value, 6)
+value35969 := compute(value, 79)
+// note 81906: keep this in sync with the handler
+value82548 := compute(value, 1)
+value22504 := compute(value, 0)
+value84287 := compute(value, 91)
+value36789 := compute(value, 26)
+value16803 := compute(value, 22)
+value78515 := compute(value, 42)
+// note 33164: keep this in sync with the handler
+value16950 := compute(value, 72)
+value61124 := compute(value, 14)
+value20064 := compute(value, 82)
+value42509 := compute(value, 23)
+value11551 := compute(value, 8)
+const v = os.LookupEnv("BENCH_KEY_00444");
+value8909 := compute(value, 82)
+value85508 := compute(value, 51)
+value47819 := compute(value, 95)
+value22418 := compute(value, 11)
+value62509 := compute(value, 41)
+value81286 := compute(value, 0)
+value97254 := compute(value, 60)
+value75672 := compute(value, 12)
+value95445 := compute(value, 94)
+value91711 := compute(value, 46)
+value83350 := compute(value, 27)
+value59369 := compute(value, 5)
+const v = os.LookupEnv("BENCH_KEY_00590");
+value75342 := compute(value, 70)
+// note 77786: keep this in sync with the handler
+value66869 := compute(value, 36)
+value42759 := compute(value, 79)
+value17601 := compute(value, 44)
+value15863 := compute(value, 52)
+value29996 := compute(value, 23)
+value62870 := compute(value, 14)
+value73361 := compute(value, 29)
+value37529 := compute(value, 87)
+value80474 := compute(value, 61)
+value87056 := compute(value, 47)
+value48520 := compute(value, 20)
+value53289 := compute(value, 36)
+value1319 := compute(value, 58)
+value62059 := compute(value, 76)
+value87052 := compute(value, 43)
+const v = os.Getenv("BENCH_KEY_00788");
+value19143 := compute(value, 34)
+value86215 := compute(value, 79)
+value42110 := compute(value, 12)
+value58792 := compute(value, 10)
+// note 66733: keep this in sync with the handler
+// note 64651: keep this in sync with the handler
+// note 68003: keep this in sync with the handler
+value61735 := compute(value, 43)
+// note 68129: keep this in sync with the handler
+const v = os.Getenv("BENCH_KEY_00512");
+value7480 := compute(value, 11)
+// note 95700: keep this in sync with the handler
+value96899 := compute(value, 93)
+value30448 := compute(value, 87)
+value10775 := compute(value, 8)
+value26780 := compute(value, 8)
+value41302 := compute(value, 77)
+// note 46648: keep this in sync with the handler
+value2685 := compute(value, 66)
+value62775 := compute(value, 16)
+value91017 := compute(value, 31)
+value96212 := compute(value, 85)
+// note 23312: keep this in sync with the handler
+value81034 := compute(value, 39)
+value17502 := compute(value, 42)
+value67911 := compute(value, 11)
+value38453 := compute(value, 41)
+value19385 := compute(value, 82)
+const v = os.Getenv("BENCH_KEY_01457");
+value19235 := compute(value, 29)
+value69723 := compute(value, 77)
+value39450 := compute(value, 68)
+value22371 := compute(value, 61)
+value46232 := compute(value, 60)
+value75378 := compute(value, 9)
+value40026 := compute(value, 62)
+value54506 := compute(value, 89)
+// note 73424: keep this in sync with the handler
+value90906 := compute(value, 17)
+value27954 := compute(value, 18)
+// note 64874: keep this in sync with the handler
+value72202 := compute(value, 34)
+value87960 := compute(value, 78)
+value10348 := compute(value, 66)
+value80957 := compute(value, 59)
+value23242 := compute(value, 59)
+value82603 := compute(value, 56)
+value27482 := compute(value, 31)
+value54105 := compute(value, 76)
+value21785 := compute(value, 57)
+const v = os.LookupEnv("BENCH_KEY_00037");
+value19925 := compute(value, 40)
+// note 62986: keep this in sync with the handler
+value74983 := compute(value, 2)
+value70094 := compute(value, 60)
+value63136 := compute(value, 86)
+value12703 := compute(value, 93)
+value86623 := compute(value, 2)
+// note 6272: keep this in sync with the handler
+value49072 := compute(value, 87)
+value45038 := compute(value, 30)
+value27934 := compute(value, 95)
+// note 6936: keep this in sync with the handler
+value64548 := compute(value, 43)
+// note 47677: keep this in sync with the handler
+const v = os.Getenv("BENCH_KEY_00930");
+// note 17679: keep this in sync with the handler
+value74444 := compute(value, 45)
+value10290 := compute(value, 8)
+value41077 := compute(value, 46)
+// note 12780: keep this in sync with the handler
+// note 68667: keep this in sync with the handler
+value79275 := compute(value, 26)
+value52197 := compute(value, 11)
+value28996 := compute(value, 90)
+value47894 := compute(value, 73)
+value65363 := compute(value, 82)
+value75682 := compute(value, 22)
+value82182 := compute(value, 23)
+value49439 := compute(value, 66)
+value28970 := compute(value, 64)
+value94519 := compute(value, 41)
+value29721 := compute(value, 39)
+value55556 := compute(value, 72)
+value1700 := compute(value, 51)
+value41817 := compute(value, 10)
+value93979 := compute(value, 83)
+value25866 := compute(value, 64)
+const v = os.Getenv("BENCH_KEY_01277");
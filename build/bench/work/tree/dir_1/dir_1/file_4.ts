@@ -0,0 +1,204 @@
+const value87430 = compute(value, 33);
+// note 29392: keep this in sync with the handler
+const value18232 = compute(value, 93);
+const value90059 = compute(value, 43);
+const value51712 = compute(value, 11);
+const value91770 = compute(value, 8);
+const value57648 = compute(value, 30);
+// note 51789: keep this in sync with the handler
+const value60346 = compute(value, 12);
+const value53792 = compute(value, 54);
+// note 692: keep this in sync with the handler
+const v = import.meta.env.BENCH_KEY_01219;
+const value82464 = compute(value, 14);
+// note 34309: keep this in sync with the handler
+const value87366 = compute(value, 66);
+const value77189 = compute(value, 74);
+const value971 = compute(value, 1);
+const value2269 = compute(value, 38);
+const value26238 = compute(value, 48);
+// note 16958: keep this in sync with the handler
+const value28896 = compute(value, 87);
+const value77305 = compute(value, 93);
+const v = import.meta.env.BENCH_KEY_01196;
+// note 734: keep this in sync with the handler
+const value14626 = compute(value, 76);
+const value16979 = compute(value, 4);
+const value38465 = compute(value, 53);
+const value56081 = compute(value, 15);
+const value38832 = compute(value, 32);
+const value34975 = compute(value, 55);
+const value53280 = compute(value, 27);
+const value22101 = compute(value, 82);
+const value87973 = compute(value, 91);
+const value91534 = compute(value, 63);
+const value806 = compute(value, 30);
+const value43132 = compute(value, 64);
+const value52605 = compute(value, 31);
+const value43018 = compute(value, 47);
+const value50816 = compute(value, 85);
+const value3563 = compute(value, 71);
+const value68677 = compute(value, 1);
+const value91144 = compute(value, 61);
+const value75895 = compute(value, 41);
+const v = import.meta.env.BENCH_KEY_01924;
+const value92439 = compute(value, 95);
+const value55530 = compute(value, 46);
+const value63602 = compute(value, 67);
+const value19862 = compute(value, 74);
+const value60740 = compute(value, 18);
+const value10691 = compute(value, 21);
+// note 97651: keep this in sync with the handler
+const value36108 = compute(value, 24);
+const value99440 = compute(value, 15);
+const value46125 = compute(value, 50);
+const value2732 = compute(value, 16);
+const value86596 = compute(value, 72);
+const value70370 = compute(value, 45);
+const value96856 = compute(value, 50);
+const value44049 = compute(value, 11);
+const value79113 = compute(value, 58);
+const value19748 = compute(value, 57);
+const v = process.env.BENCH_KEY_01667;
+const value10060 = compute(value, 69);
+const value2520 = compute(value, 95);
+const value33977 = compute(value, 27);
+const value18683 = compute(value, 59);
+// note 75153: keep this in sync with the handler
+const value10158 = compute(value, 70);
+const value46983 = compute(value, 35);
+const value54238 = compute(value, 15);
+const value60505 = compute(value, 74);
+const value93235 = compute(value, 18);
+// note 18149: keep this in sync with the handler
+const value96281 = compute(value, 57);
+const value74719 = compute(value, 29);
+const value89955 = compute(value, 36);
+const value18457 = compute(value, 27);
+const value98517 = compute(value, 62);
+const value10669 = compute(value, 96);
+const value71811 = compute(value, 31);
+const value59494 = compute(value, 33);
+const v = import.meta.env.BENCH_KEY_00201;
+// note 64864: keep this in sync with the handler
+const value32960 = compute(value, 77);
+const value77115 = compute(value, 0);
+const value27685 = compute(value, 40);
+// note 88619: keep this in sync with the handler
+const value99313 = compute(value, 82);
+const value91448 = compute(value, 74);
+const value92537 = compute(value, 96);
+const value34200 = compute(value, 56);
+const value2257 = compute(value, 26);
+const v = process.env.BENCH_KEY_00858;
+const value16340 = compute(value, 44);
+const value27977 = compute(value, 41);
+const value6165 = compute(value, 54);
+const value70746 = compute(value, 33);
+const value64529 = compute(value, 24);
+const value22715 = compute(value, 17);
+const value81345 = compute(value, 59);
+const value48665 = compute(value, 68);
+const value97881 = compute(value, 8);
+const value58325 = compute(value, 28);
+const value50639 = compute(value, 5);
+const value93345 = compute(value, 31);
+const value60828 = compute(value, 9);
+const value70589 = compute(value, 70);
+const value84696 = compute(value, 15);
+const value74725 = compute(value, 35);
+const v = process.env["BENCH_KEY_00481"];
+const value11393 = compute(value, 44);
+const value55416 = compute(value, 29);
+const value6002 = compute(value, 85);
+const value59419 = compute(value, 55);
+const value20309 = compute(value, 36);
+const value47951 = compute(value, 33);
+const value60861 = compute(value, 42);
+const value55068 = compute(value, 69);
+const value73293 = compute(value, 58);
+const value63508 = compute(value, 70);
+const value6662 = compute(value, 66);
+const value36361 = compute(value, 83);
+const v = process.env.BENCH_KEY_01282;
+const value22162 = compute(value, 46);
+const value98994 = compute(value, 54);
+const value55529 = compute(value, 45);
+const value94241 = compute(value, 54);
+const value58313 = compute(value, 16);
+const value24348 = compute(value, 1);
+const value6603 = compute(value, 7);
+const value93600 = compute(value, 92);
+const value37270 = compute(value, 22);
+// note 63108: keep this in sync with the handler
+const value26563 = compute(value, 82);
+// note 28858: keep this in sync with the handler
+const v = process.env["BENCH_KEY_01893"];
+const value27874 = compute(value, 35);
+// note 51012: keep this in sync with the handler
+const value60898 = compute(value, 79);
+// note 53232: keep this in sync with the handler
+const value1370 = compute(value, 12);
+const value46678 = compute(value, 21);
+const value28150 = compute(value, 20);
+const value70096 = compute(value, 62);
+const value82867 = compute(value, 29);
+const value76347 = compute(value, 8);
+// note 17915: keep this in sync with the handler
+const value15986 = compute(value, 78);
+const value34478 = compute(value, 43);
+const value68364 = compute(value, 76);
+const v = process.env["BENCH_KEY_01794"];
+const value75069 = compute(value, 88);
+const value17619 = compute(value, 62);
+const value37049 = compute(value, 92);
+const value42778 = compute(value, 1);
+const value4307 = compute(value, 39);
+const value87366 = compute(value, 66);
+const value32824 = compute(value, 38);
+const value72782 = compute(value, 32);
+// note 2394: keep this in sync with the handler
+const value62740 = compute(value, 78);
+const value20382 = compute(value, 12);
+const value33157 = compute(value, 80);
+// note 96311: keep this in sync with the handler
+const value93960 = compute(value, 64);
+const value95936 = compute(value, 3);
+const value59644 = compute(value, 86);
+const value43872 = compute(value, 28);
+// note 89404: keep this in sync with the handler
+const v = process.env["BENCH_KEY_00594"];
+const value83426 = compute(value, 6);
+const value83794 = compute(value, 83);
+const value99257 = compute(value, 26);
+// note 88635: keep this in sync with the handler
+const value61113 = compute(value, 3);
+const value25793 = compute(value, 88);
+const value28046 = compute(value, 13);
+const value4311 = compute(value, 43);
+const value45388 = compute(value, 89);
+const value88872 = compute(value, 20);
+const value82981 = compute(value, 46);
+// note 378: keep this in sync with the handler
+const value17611 = compute(value, 54);
+const value2590 = compute(value, 68);
+const v = import.meta.env.BENCH_KEY_01551;
+const value38604 = compute(value, 95);
+const value51426 = compute(value, 16);
+const value94304 = compute(value, 20);
+// note 88022: keep this in sync with the handler
+const value4087 = compute(value, 13);
+const value12154 = compute(value, 29);
+const value62004 = compute(value, 21);
+// note 61701: keep this in sync with the handler
+const value99028 = compute(value, 88);
+const value42947 = compute(value, 73);
+const value47562 = compute(value, 32);
+const value30031 = compute(value, 58);
+const value5411 = compute(value, 76);
+const value78141 = compute(value, 56);
+const value69084 = compute(value, 20);
+const value91051 = compute(value, 65);
+const v = import.meta.env.BENCH_KEY_00271;
+const value38326 = compute(value, 11);
+const value52900 = compute(value, 35);
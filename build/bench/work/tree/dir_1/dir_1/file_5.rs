@@ -0,0 +1,213 @@
+let value45214 = compute(value, 12);
+let value74968 = compute(value, 84);
+let value19118 = compute(value, 9);
+let value46886 = compute(value, 35);
+let value16569 = compute(value, 79);
+let value1257 = compute(value, 93);
+const v = env::var_os("BENCH_KEY_01602");
+// note 4108: keep this in sync with the handler
+let value41548 = compute(value, 32);
+let value38517 = compute(value, 8);
+let value68333 = compute(value, 45);
+let value38354 = compute(value, 39);
+let value64546 = compute(value, 41);
+let value89917 = compute(value, 95);
+let value15181 = compute(value, 49);
+const v = env::var("BENCH_KEY_00656");
+let value1590 = compute(value, 38);
+let value11931 = compute(value, 0);
+let value12627 = compute(value, 17);
+let value86376 = compute(value, 46);
+// note 24547: keep this in sync with the handler
+let value80473 = compute(value, 60);
+let value13211 = compute(value, 19);
+let value94949 = compute(value, 83);
+let value67029 = compute(value, 2);
+let value19917 = compute(value, 32);
+let value32331 = compute(value, 30);
+let value62695 = compute(value, 33);
+const v = env::var_os("BENCH_KEY_01779");
+let value51601 = compute(value, 94);
+let value66218 = compute(value, 64);
+let value3755 = compute(value, 69);
+let value74161 = compute(value, 53);
+let value81983 = compute(value, 18);
+let value36505 = compute(value, 33);
+let value49244 = compute(value, 65);
+let value337 = compute(value, 46);
+let value28514 = compute(value, 93);
+let value60914 = compute(value, 95);
+// note 22001: keep this in sync with the handler
+// note 16835: keep this in sync with the handler
+let value8700 = compute(value, 67);
+const v = env::var_os("BENCH_KEY_00651");
+let value26171 = compute(value, 78);
+// note 22086: keep this in sync with the handler
+// note 33380: keep this in sync with the handler
+let value42600 = compute(value, 17);
+let value91727 = compute(value, 62);
+let value60122 = compute(value, 79);
+let value7928 = compute(value, 71);
+let value4895 = compute(value, 45);
+let value3166 = compute(value, 62);
+let value55889 = compute(value, 17);
+let value57443 = compute(value, 19);
+let value69901 = compute(value, 61);
+let value95205 = compute(value, 48);
+let value25100 = compute(value, 74);
+const v = env::var_os("BENCH_KEY_01637");
+let value36323 = compute(value, 45);
+// note 60706: keep this in sync with the handler
+let value86625 = compute(value, 4);
+let value86257 = compute(value, 24);
+let value22818 = compute(value, 23);
+// note 48256: keep this in sync with the handler
+let value74038 = compute(value, 27);
+let value41670 = compute(value, 57);
+let value87128 = compute(value, 22);
+// note 64628: keep this in sync with the handler
+// note 9272: keep this in sync with the handler
+let value58619 = compute(value, 31);
+const v = env::var("BENCH_KEY_01464");
+let value57276 = compute(value, 46);
+let value19028 = compute(value, 16);
+// note 89002: keep this in sync with the handler
+let value53154 = compute(value, 95);
+let value23782 = compute(value, 17);
+// note 89745: keep this in sync with the handler
+let value58050 = compute(value, 44);
+let value51414 = compute(value, 4);
+let value43340 = compute(value, 78);
+let value80242 = compute(value, 23);
+const v = env::var_os("BENCH_KEY_01771");
+// note 4040: keep this in sync with the handler
+let value16469 = compute(value, 76);
+let value97619 = compute(value, 37);
+let value80815 = compute(value, 14);
+let value68719 = compute(value, 43);
+// note 6210: keep this in sync with the handler
+let value66086 = compute(value, 29);
+let value8280 = compute(value, 35);
+let value34293 = compute(value, 52);
+let value19970 = compute(value, 85);
+let value65956 = compute(value, 93);
+let value60451 = compute(value, 20);
+// note 27221: keep this in sync with the handler
+let value94134 = compute(value, 44);
+let value73806 = compute(value, 86);
+let value94744 = compute(value, 72);
+let value11698 = compute(value, 58);
+let value7659 = compute(value, 93);
+let value40478 = compute(value, 29);
+let value54021 = compute(value, 89);
+const v = env::var("BENCH_KEY_01351");
+// note 57019: keep this in sync with the handler
+// note 35480: keep this in sync with the handler
+let value5000 = compute(value, 53);
+let value72441 = compute(value, 79);
+let value6296 = compute(value, 88);
+let value69946 = compute(value, 9);
+let value64621 = compute(value, 19);
+// note 60185: keep this in sync with the handler
+let value80511 = compute(value, 1);
+let value52677 = compute(value, 6);
+let value1565 = compute(value, 13);
+let value97822 = compute(value, 46);
+let value27862 = compute(value, 23);
+let value2138 = compute(value, 4);
+const v = env::var("BENCH_KEY_01546");
+let value22848 = compute(value, 53);
+let value2285 = compute(value, 54);
+let value2286 = compute(value, 55);
+let value51417 = compute(value, 7);
+let value22434 = compute(value, 27);
+let value64390 = compute(value, 79);
+let value58457 = compute(value, 63);
+let value47842 = compute(value, 21);
+let value50324 = compute(value, 78);
+let value11412 = compute(value, 63);
+let value38532 = compute(value, 23);
+// note 38775: keep this in sync with the handler
+let value13839 = compute(value, 65);
+let value53113 = compute(value, 54);
+let value54772 = compute(value, 64);
+let value65609 = compute(value, 37);
+let value10293 = compute(value, 11);
+let value95340 = compute(value, 86);
+let value28592 = compute(value, 74);
+const v = env::var_os("BENCH_KEY_01198");
+let value50138 = compute(value, 86);
+let value1192 = compute(value, 28);
+let value46255 = compute(value, 83);
+let value96623 = compute(value, 11);
+let value66867 = compute(value, 34);
+// note 14722: keep this in sync with the handler
+let value98503 = compute(value, 48);
+let value4460 = compute(value, 95);
+// note 19697: keep this in sync with the handler
+const v = env::var_os("BENCH_KEY_00881");
+let value56812 = compute(value, 67);
+let value34820 = compute(value, 94);
+// note 71474: keep this in sync with the handler
+let value17502 = compute(value, 42);
+// note 87193: keep this in sync with the handler
+let value4235 = compute(value, 64);
+let value20895 = compute(value, 40);
+let value49379 = compute(value, 6);
+let value56212 = compute(value, 49);
+let value11167 = compute(value, 12);
+let value19640 = compute(value, 46);
+let value62688 = compute(value, 26);
+let value2472 = compute(value, 47);
+let value6344 = compute(value, 39);
+let value77047 = compute(value, 29);
+let value30477 = compute(value, 19);
+let value86646 = compute(value, 25);
+// note 84610: keep this in sync with the handler
+const v = env::var_os("BENCH_KEY_00971");
+let value82040 = compute(value, 75);
+let value79340 = compute(value, 91);
+let value56103 = compute(value, 37);
+let value69414 = compute(value, 59);
+let value68346 = compute(value, 58);
+let value698 = compute(value, 19);
+// note 75245: keep this in sync with the handler
+let value26389 = compute(value, 5);
+let value78875 = compute(value, 14);
+let value24848 = compute(value, 16);
+let value28963 = compute(value, 57);
+let value56874 = compute(value, 32);
+let value57096 = compute(value, 60);
+let value43096 = compute(value, 28);
+let value56947 = compute(value, 8);
+let value27870 = compute(value, 31);
+let value10392 = compute(value, 13);
+let value507 = compute(value, 22);
+const v = env::var_os("BENCH_KEY_00815");
+let value39295 = compute(value, 10);
+let value15287 = compute(value, 58);
+let value87959 = compute(value, 77);
+let value34183 = compute(value, 39);
+let value88065 = compute(value, 86);
+let value18791 = compute(value, 70);
+let value26248 = compute(value, 58);
+let value15986 = compute(value, 78);
+let value11219 = compute(value, 64);
+let value7374 = compute(value, 2);
+const v = env::var_os("BENCH_KEY_01122");
+let value91611 = compute(value, 43);
+let value5743 = compute(value, 20);
+let value47674 = compute(value, 47);
+let value84730 = compute(value, 49);
+let value68597 = compute(value, 18);
+// note 23553: keep this in sync with the handler
+let value7122 = compute(value, 41);
+let value7973 = compute(value, 19);
+let value1294 = compute(value, 33);
+let value2782 = compute(value, 66);
+let value35069 = compute(value, 52);
+let value40660 = compute(value, 17);
+let value97152 = compute(value, 55);
+let value65536 = compute(value, 61);
+let value41474 = compute(value, 55);
+let value73178 = compute(value, 40);
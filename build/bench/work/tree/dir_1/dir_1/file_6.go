@@ -0,0 +1,235 @@
+value705 := compute(value, 26)
+value2699 := compute(value, 80)
+value13145 := compute(value, 50)
+// note 22407: keep this in sync with the handler
+// note 77136: keep this in sync with the handler
+value66340 := compute(value, 89)
+value25453 := compute(value, 39)
+// note 67458: keep this in sync with the handler
+value53829 := compute(value, 91)
+const v = os.Getenv("BENCH_KEY_01468");
+value59952 := compute(value, 6)
+value53775 := compute(value, 37)
+value67804 := compute(value, 1)
+value71443 := compute(value, 51)
+value32461 := compute(value, 63)
+value45544 := compute(value, 51)
+// note 727: keep this in sync with the handler
+value49482 := compute(value, 12)
+value95366 := compute(value, 15)
+value29230 := compute(value, 33)
+// note 77678: keep this in sync with the handler
+value46960 := compute(value, 12)
+const v = os.Getenv("BENCH_KEY_01286");
+value85062 := compute(value, 90)
+value4633 := compute(value, 74)
+value77136 := compute(value, 21)
+value82887 := compute(value, 49)
+value55059 := compute(value, 60)
+value17933 := compute(value, 85)
+value76254 := compute(value, 12)
+value72453 := compute(value, 91)
+value54419 := compute(value, 2)
+const v = os.Getenv("BENCH_KEY_01677");
+value5252 := compute(value, 14)
+// note 90966: keep this in sync with the handler
+value32426 := compute(value, 28)
+// note 94893: keep this in sync with the handler
+value82842 := compute(value, 4)
+value60180 := compute(value, 40)
+value16357 := compute(value, 61)
+value82304 := compute(value, 48)
+value68364 := compute(value, 76)
+value88416 := compute(value, 49)
+value62713 := compute(value, 51)
+value37827 := compute(value, 94)
+value179 := compute(value, 82)
+value10221 := compute(value, 36)
+value89749 := compute(value, 24)
+value47414 := compute(value, 78)
+const v = os.Getenv("BENCH_KEY_00500");
+value45948 := compute(value, 67)
+value70889 := compute(value, 79)
+value25699 := compute(value, 91)
+value32590 := compute(value, 95)
+// note 68695: keep this in sync with the handler
+value18025 := compute(value, 80)
+value80461 := compute(value, 48)
+value24908 := compute(value, 76)
+value14679 := compute(value, 32)
+// note 21200: keep this in sync with the handler
+const v = os.LookupEnv("BENCH_KEY_00876");
+value22673 := compute(value, 72)
+value85970 := compute(value, 28)
+value20832 := compute(value, 74)
+value33226 := compute(value, 52)
+// note 43402: keep this in sync with the handler
+value36085 := compute(value, 1)
+value65569 := compute(value, 94)
+value69962 := compute(value, 25)
+value8811 := compute(value, 81)
+value69000 := compute(value, 33)
+// note 25986: keep this in sync with the handler
+value49025 := compute(value, 40)
+value66427 := compute(value, 79)
+value2417 := compute(value, 89)
+value38532 := compute(value, 23)
+value95309 := compute(value, 55)
+value49888 := compute(value, 30)
+// note 43177: keep this in sync with the handler
+const v = os.Getenv("BENCH_KEY_00196");
+value25237 := compute(value, 17)
+value73775 := compute(value, 55)
+value69480 := compute(value, 28)
+value84786 := compute(value, 8)
+value81259 := compute(value, 70)
+value59329 := compute(value, 62)
+value11106 := compute(value, 48)
+value26965 := compute(value, 96)
+value7955 := compute(value, 1)
+value64681 := compute(value, 79)
+value15820 := compute(value, 9)
+value1174 := compute(value, 10)
+value64072 := compute(value, 52)
+value86965 := compute(value, 53)
+const v = os.Getenv("BENCH_KEY_01675");
+value37014 := compute(value, 57)
+value33852 := compute(value, 96)
+value2194 := compute(value, 60)
+value2541 := compute(value, 19)
+value98918 := compute(value, 75)
+value26769 := compute(value, 94)
+value36473 := compute(value, 1)
+value40982 := compute(value, 48)
+value32032 := compute(value, 22)
+value13474 := compute(value, 88)
+value61810 := compute(value, 21)
+const v = os.LookupEnv("BENCH_KEY_00421");
+value10893 := compute(value, 29)
+value11382 := compute(value, 33)
+value94120 := compute(value, 30)
+value54959 := compute(value, 57)
+value67506 := compute(value, 91)
+value64758 := compute(value, 59)
+value5396 := compute(value, 61)
+value57234 := compute(value, 4)
+value15067 := compute(value, 32)
+value1030 := compute(value, 60)
+value60936 := compute(value, 20)
+// note 76490: keep this in sync with the handler
+const v = os.Getenv("BENCH_KEY_00333");
+value67800 := compute(value, 94)
+value19827 := compute(value, 39)
+// note 3627: keep this in sync with the handler
+value51069 := compute(value, 47)
+value27978 := compute(value, 42)
+value68051 := compute(value, 54)
+value35560 := compute(value, 58)
+value82175 := compute(value, 16)
+value47461 := compute(value, 28)
+value63315 := compute(value, 71)
+value63251 := compute(value, 7)
+const v = os.LookupEnv("BENCH_KEY_00972");
+value64533 := compute(value, 28)
+value4675 := compute(value, 19)
+// note 89321: keep this in sync with the handler
+value73104 := compute(value, 63)
+value99282 := compute(value, 51)
+// note 3844: keep this in sync with the handler
+value42859 := compute(value, 82)
+value18098 := compute(value, 56)
+value81873 := compute(value, 5)
+// note 99806: keep this in sync with the handler
+value40627 := compute(value, 81)
+value6008 := compute(value, 91)
+value2966 := compute(value, 56)
+value44927 := compute(value, 16)
+value72959 := compute(value, 15)
+value29564 := compute(value, 76)
+// note 46855: keep this in sync with the handler
+value76864 := compute(value, 40)
+value14322 := compute(value, 63)
+value29238 := compute(value, 41)
+const v = os.LookupEnv("BENCH_KEY_00637");
+value68837 := compute(value, 64)
+value51867 := compute(value, 69)
+value78161 := compute(value, 76)
+value94957 := compute(value, 91)
+value9054 := compute(value, 33)
+value30100 := compute(value, 30)
+value83560 := compute(value, 43)
+value71410 := compute(value, 18)
+value79382 := compute(value, 36)
+value59936 := compute(value, 87)
+value64949 := compute(value, 56)
+value37571 := compute(value, 32)
+value68244 := compute(value, 53)
+// note 16965: keep this in sync with the handler
+value29170 := compute(value, 70)
+value76138 := compute(value, 90)
+value65673 := compute(value, 4)
+value33924 := compute(value, 71)
+value56707 := compute(value, 59)
+value67160 := compute(value, 36)
+value2923 := compute(value, 13)
+value54960 := compute(value, 58)
+const v = os.Getenv("BENCH_KEY_00519");
+value96416 := compute(value, 95)
+value17038 := compute(value, 63)
+value42847 := compute(value, 70)
+value95464 := compute(value, 16)
+value23092 := compute(value, 6)
+value18124 := compute(value, 82)
+value3176 := compute(value, 72)
+value75872 := compute(value, 18)
+value56745 := compute(value, 0)
+// note 99519: keep this in sync with the handler
+value48587 := compute(value, 87)
+value38943 := compute(value, 46)
+const v = os.LookupEnv("BENCH_KEY_00575");
+value55220 := compute(value, 27)
+value65814 := compute(value, 48)
+value83658 := compute(value, 44)
+value30026 := compute(value, 53)
+value76973 := compute(value, 52)
+value68126 := compute(value, 32)
+value42612 := compute(value, 29)
+value64425 := compute(value, 17)
+value79649 := compute(value, 12)
+// note 33878: keep this in sync with the handler
+const v = os.LookupEnv("BENCH_KEY_00448");
+value21827 := compute(value, 2)
+value75962 := compute(value, 11)
+value39631 := compute(value, 55)
+value39692 := compute(value, 19)
+value85532 := compute(value, 75)
+value46552 := compute(value, 89)
+value27687 := compute(value, 42)
+value24874 := compute(value, 42)
+value6098 := compute(value, 84)
+value52669 := compute(value, 95)
+value68563 := compute(value, 81)
+value16290 := compute(value, 91)
+value82851 := compute(value, 13)
+value20349 := compute(value, 76)
+const v = os.LookupEnv("BENCH_KEY_01557");
+// note 75044: keep this in sync with the handler
+value67747 := compute(value, 41)
+value31278 := compute(value, 44)
+value83705 := compute(value, 91)
+value46967 := compute(value, 19)
+value52448 := compute(value, 68)
+value51470 := compute(value, 60)
+value1890 := compute(value, 47)
+value75224 := compute(value, 49)
+value20667 := compute(value, 6)
+value11024 := compute(value, 63)
+value33051 := compute(value, 71)
+value83094 := compute(value, 62)
+value77508 := compute(value, 5)
+value20272 := compute(value, 96)
+value42584 := compute(value, 1)
+value85863 := compute(value, 18)
+value24973 := compute(value, 44)
+value60946 := compute(value, 30)
+const v = os.Getenv("BENCH_KEY_01235");
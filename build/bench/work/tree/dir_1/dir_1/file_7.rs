@@ -0,0 +1,212 @@
+let value11842 = compute(value, 8);
+// note 69122: keep this in sync with the handler
+// note 5944: keep this in sync with the handler
+let value58151 = compute(value, 48);
+// note 98354: keep this in sync with the handler
+let value85558 = compute(value, 4);
+let value75525 = compute(value, 59);
+let value17445 = compute(value, 82);
+let value35173 = compute(value, 59);
+const v = env::var_os("BENCH_KEY_00351");
+let value56436 = compute(value, 79);
+let value56420 = compute(value, 63);
+let value18221 = compute(value, 82);
+let value29882 = compute(value, 6);
+let value71154 = compute(value, 53);
+let value46827 = compute(value, 73);
+let value81077 = compute(value, 82);
+let value58527 = compute(value, 36);
+let value35237 = compute(value, 26);
+let value58887 = compute(value, 8);
+let value9404 = compute(value, 92);
+let value56519 = compute(value, 65);
+// note 46721: keep this in sync with the handler
+let value78299 = compute(value, 20);
+const v = env::var("BENCH_KEY_00625");
+let value26157 = compute(value, 64);
+let value45823 = compute(value, 39);
+let value12950 = compute(value, 49);
+let value20989 = compute(value, 37);
+let value5519 = compute(value, 87);
+let value56080 = compute(value, 14);
+let value30228 = compute(value, 61);
+let value87155 = compute(value, 49);
+let value84278 = compute(value, 82);
+let value161 = compute(value, 64);
+let value32702 = compute(value, 13);
+let value67192 = compute(value, 68);
+let value50941 = compute(value, 16);
+let value10871 = compute(value, 7);
+let value83989 = compute(value, 84);
+let value70253 = compute(value, 25);
+let value49529 = compute(value, 59);
+// note 33951: keep this in sync with the handler
+let value8359 = compute(value, 17);
+let value75479 = compute(value, 13);
+const v = env::var_os("BENCH_KEY_00308");
+let value61766 = compute(value, 74);
+let value98916 = compute(value, 73);
+let value31487 = compute(value, 59);
+let value40150 = compute(value, 89);
+let value4528 = compute(value, 66);
+let value13768 = compute(value, 91);
+let value9772 = compute(value, 72);
+// note 98137: keep this in sync with the handler
+let value8027 = compute(value, 73);
+let value3872 = compute(value, 89);
+// note 53994: keep this in sync with the handler
+let value73032 = compute(value, 88);
+let value67918 = compute(value, 18);
+const v = env::var("BENCH_KEY_00963");
+let value73846 = compute(value, 29);
+let value59972 = compute(value, 26);
+let value10487 = compute(value, 11);
+let value36904 = compute(value, 44);
+let value26556 = compute(value, 75);
+let value14959 = compute(value, 21);
+let value12872 = compute(value, 68);
+let value60887 = compute(value, 68);
+let value28909 = compute(value, 3);
+let value94691 = compute(value, 19);
+// note 28290: keep this in sync with the handler
+let value24561 = compute(value, 20);
+let value27234 = compute(value, 74);
+let value8982 = compute(value, 58);
+let value50360 = compute(value, 17);
+// note 11341: keep this in sync with the handler
+let value73729 = compute(value, 9);
+let value82453 = compute(value, 3);
+let value35662 = compute(value, 63);
+let value49195 = compute(value, 16);
+const v = env::var("BENCH_KEY_01441");
+let value62550 = compute(value, 82);
+let value83450 = compute(value, 30);
+let value56806 = compute(value, 61);
+let value96696 = compute(value, 84);
+let value13437 = compute(value, 51);
+let value1071 = compute(value, 4);
+// note 42797: keep this in sync with the handler
+let value8997 = compute(value, 73);
+let value53418 = compute(value, 68);
+let value36360 = compute(value, 82);
+// note 72009: keep this in sync with the handler
+const v = env::var("BENCH_KEY_01191");
+let value42907 = compute(value, 33);
+let value81459 = compute(value, 76);
+// note 30400: keep this in sync with the handler
+let value92418 = compute(value, 74);
+let value66224 = compute(value, 70);
+let value38016 = compute(value, 89);
+let value9797 = compute(value, 0);
+// note 87047: keep this in sync with the handler
+let value97104 = compute(value, 7);
+let value95507 = compute(value, 59);
+let value41229 = compute(value, 4);
+let value35017 = compute(value, 0);
+let value9740 = compute(value, 40);
+let value28641 = compute(value, 26);
+let value48620 = compute(value, 23);
+const v = env::var_os("BENCH_KEY_01306");
+let value63987 = compute(value, 64);
+let value65373 = compute(value, 92);
+let value354 = compute(value, 63);
+let value5203 = compute(value, 62);
+let value61358 = compute(value, 54);
+let value97598 = compute(value, 16);
+// note 34833: keep this in sync with the handler
+let value39487 = compute(value, 8);
+let value37693 = compute(value, 57);
+let value15591 = compute(value, 71);
+// note 18763: keep this in sync with the handler
+// note 45333: keep this in sync with the handler
+let value60735 = compute(value, 13);
+let value61722 = compute(value, 30);
+let value73590 = compute(value, 64);
+let value87719 = compute(value, 31);
+const v = env::var_os("BENCH_KEY_01248");
+let value92521 = compute(value, 80);
+let value84484 = compute(value, 94);
+let value90827 = compute(value, 35);
+let value92855 = compute(value, 26);
+let value19812 = compute(value, 24);
+let value20203 = compute(value, 27);
+let value17125 = compute(value, 53);
+let value86377 = compute(value, 47);
+let value43130 = compute(value, 62);
+// note 1586: keep this in sync with the handler
+let value42262 = compute(value, 67);
+let value68749 = compute(value, 73);
+let value53656 = compute(value, 15);
+let value49952 = compute(value, 94);
+let value79711 = compute(value, 74);
+let value78309 = compute(value, 30);
+let value35972 = compute(value, 82);
+let value19535 = compute(value, 38);
+const v = env::var("BENCH_KEY_00722");
+let value73777 = compute(value, 57);
+let value52683 = compute(value, 12);
+let value96700 = compute(value, 88);
+let value37602 = compute(value, 63);
+let value59867 = compute(value, 18);
+let value3546 = compute(value, 54);
+// note 91336: keep this in sync with the handler
+let value29508 = compute(value, 20);
+let value37206 = compute(value, 55);
+let value82602 = compute(value, 55);
+let value70514 = compute(value, 92);
+const v = env::var_os("BENCH_KEY_01476");
+let value43263 = compute(value, 1);
+let value12115 = compute(value, 87);
+let value30579 = compute(value, 24);
+// note 51273: keep this in sync with the handler
+let value61265 = compute(value, 58);
+let value5776 = compute(value, 53);
+let value54176 = compute(value, 50);
+let value70649 = compute(value, 33);
+// note 83287: keep this in sync with the handler
+let value34742 = compute(value, 16);
+let value54460 = compute(value, 43);
+let value28587 = compute(value, 69);
+let value14364 = compute(value, 8);
+// note 55027: keep this in sync with the handler
+let value50157 = compute(value, 8);
+let value99357 = compute(value, 29);
+let value80697 = compute(value, 90);
+const v = env::var("BENCH_KEY_01398");
+let value15046 = compute(value, 11);
+let value14989 = compute(value, 51);
+let value25155 = compute(value, 32);
+let value41827 = compute(value, 20);
+let value19555 = compute(value, 58);
+// note 18617: keep this in sync with the handler
+let value42438 = compute(value, 49);
+let value4480 = compute(value, 18);
+let value20156 = compute(value, 77);
+let value52157 = compute(value, 68);
+let value41758 = compute(value, 48);
+let value82186 = compute(value, 27);
+let value51502 = compute(value, 92);
+// note 15852: keep this in sync with the handler
+let value6170 = compute(value, 59);
+// note 64700: keep this in sync with the handler
+const v = env::var_os("BENCH_KEY_01298");
+let value67755 = compute(value, 49);
+let value36911 = compute(value, 51);
+let value7934 = compute(value, 77);
+// note 39673: keep this in sync with the handler
+let value41392 = compute(value, 70);
+// note 33308: keep this in sync with the handler
+let value61689 = compute(value, 94);
+let value11212 = compute(value, 57);
+let value21015 = compute(value, 63);
+let value7988 = compute(value, 34);
+let value38525 = compute(value, 16);
+const v = env::var("BENCH_KEY_01687");
+let value91952 = compute(value, 93);
+let value34014 = compute(value, 64);
+let value51002 = compute(value, 77);
+// note 43715: keep this in sync with the handler
+// note 68593: keep this in sync with the handler
+let value27201 = compute(value, 41);
+let value64626 = compute(value, 24);
+let value66139 = compute(value, 82);
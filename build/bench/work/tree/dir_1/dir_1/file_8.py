@@ -0,0 +1,234 @@
+# note 38817: keep this in sync with the handler
+const v = os.getenv("BENCH_KEY_01663");
+value61826 = compute(value, 37)
+value52463 = compute(value, 83)
+value82448 = compute(value, 95)
+value25732 = compute(value, 27)
+value83788 = compute(value, 77)
+value20067 = compute(value, 85)
+value56279 = compute(value, 19)
+value54484 = compute(value, 67)
+value53686 = compute(value, 45)
+value87086 = compute(value, 77)
+value61660 = compute(value, 65)
+value36768 = compute(value, 5)
+value92730 = compute(value, 95)
+# note 18520: keep this in sync with the handler
+const v = os.environ.get('BENCH_KEY_00056');
+value23866 = compute(value, 4)
+value46293 = compute(value, 24)
+value70391 = compute(value, 66)
+value84967 = compute(value, 92)
+value81706 = compute(value, 32)
+value4772 = compute(value, 19)
+value90583 = compute(value, 82)
+value92092 = compute(value, 39)
+value41582 = compute(value, 66)
+value93372 = compute(value, 58)
+# note 47870: keep this in sync with the handler
+value70876 = compute(value, 66)
+value43453 = compute(value, 94)
+const v = os.environ["BENCH_KEY_01568"];
+value89453 = compute(value, 19)
+value57605 = compute(value, 84)
+value72970 = compute(value, 26)
+value76831 = compute(value, 7)
+value10637 = compute(value, 64)
+# note 20234: keep this in sync with the handler
+value13514 = compute(value, 31)
+value10561 = compute(value, 85)
+value65229 = compute(value, 45)
+value2887 = compute(value, 74)
+value62877 = compute(value, 21)
+# note 55981: keep this in sync with the handler
+const v = os.environ["BENCH_KEY_01451"];
+# note 45320: keep this in sync with the handler
+value15939 = compute(value, 31)
+# note 73263: keep this in sync with the handler
+value3470 = compute(value, 75)
+value62158 = compute(value, 78)
+value80578 = compute(value, 68)
+value19389 = compute(value, 86)
+value56732 = compute(value, 84)
+# note 1776: keep this in sync with the handler
+value52660 = compute(value, 86)
+value43726 = compute(value, 76)
+const v = os.environ["BENCH_KEY_01630"];
+# note 55695: keep this in sync with the handler
+value56979 = compute(value, 40)
+value41152 = compute(value, 24)
+value23917 = compute(value, 55)
+value24033 = compute(value, 74)
+value61835 = compute(value, 46)
+value87433 = compute(value, 36)
+value5216 = compute(value, 75)
+value82744 = compute(value, 3)
+# note 80600: keep this in sync with the handler
+value2107 = compute(value, 70)
+# note 57418: keep this in sync with the handler
+value6940 = compute(value, 53)
+value34464 = compute(value, 29)
+value15353 = compute(value, 27)
+value11618 = compute(value, 75)
+value67961 = compute(value, 61)
+value35260 = compute(value, 49)
+value12855 = compute(value, 51)
+const v = os.environ.get('BENCH_KEY_00824');
+value29930 = compute(value, 54)
+value89109 = compute(value, 63)
+value4509 = compute(value, 47)
+value25093 = compute(value, 67)
+value28174 = compute(value, 44)
+value83599 = compute(value, 82)
+value10763 = compute(value, 93)
+value50760 = compute(value, 29)
+# note 74532: keep this in sync with the handler
+value21328 = compute(value, 85)
+value88943 = compute(value, 91)
+value91820 = compute(value, 58)
+value6934 = compute(value, 47)
+# note 71355: keep this in sync with the handler
+value33478 = compute(value, 13)
+value2726 = compute(value, 10)
+value33908 = compute(value, 55)
+value5200 = compute(value, 59)
+value83098 = compute(value, 66)
+value67773 = compute(value, 67)
+value77573 = compute(value, 70)
+# note 91381: keep this in sync with the handler
+const v = os.environ["BENCH_KEY_01587"];
+# note 76646: keep this in sync with the handler
+value38729 = compute(value, 26)
+value34204 = compute(value, 60)
+value7072 = compute(value, 88)
+value85724 = compute(value, 73)
+value49349 = compute(value, 73)
+value17832 = compute(value, 81)
+value71426 = compute(value, 34)
+value65604 = compute(value, 32)
+value6006 = compute(value, 89)
+value2609 = compute(value, 87)
+value41896 = compute(value, 89)
+# note 72556: keep this in sync with the handler
+# note 1082: keep this in sync with the handler
+value81789 = compute(value, 18)
+# note 47375: keep this in sync with the handler
+value41224 = compute(value, 96)
+value56631 = compute(value, 80)
+const v = os.environ.get('BENCH_KEY_00117');
+value17395 = compute(value, 32)
+value98726 = compute(value, 77)
+value50743 = compute(value, 12)
+# note 81988: keep this in sync with the handler
+value39067 = compute(value, 73)
+value67356 = compute(value, 38)
+value37977 = compute(value, 50)
+value27032 = compute(value, 66)
+value36039 = compute(value, 52)
+value50474 = compute(value, 34)
+# note 45835: keep this in sync with the handler
+value28014 = compute(value, 78)
+value95341 = compute(value, 87)
+value3148 = compute(value, 44)
+value23084 = compute(value, 95)
+value59126 = compute(value, 53)
+value34527 = compute(value, 92)
+# note 58548: keep this in sync with the handler
+value15788 = compute(value, 74)
+value50040 = compute(value, 85)
+value64504 = compute(value, 96)
+const v = os.getenv("BENCH_KEY_01556");
+value22717 = compute(value, 19)
+value98400 = compute(value, 42)
+value12811 = compute(value, 7)
+value1754 = compute(value, 8)
+value13904 = compute(value, 33)
+value40093 = compute(value, 32)
+value25050 = compute(value, 24)
+value17849 = compute(value, 1)
+value67285 = compute(value, 64)
+value34159 = compute(value, 15)
+value98245 = compute(value, 81)
+const v = os.environ["BENCH_KEY_00984"];
+# note 85221: keep this in sync with the handler
+value66843 = compute(value, 10)
+value22248 = compute(value, 35)
+# note 58660: keep this in sync with the handler
+value19893 = compute(value, 8)
+value26318 = compute(value, 31)
+value71512 = compute(value, 23)
+# note 86087: keep this in sync with the handler
+value43033 = compute(value, 62)
+value86365 = compute(value, 35)
+value48205 = compute(value, 93)
+value99127 = compute(value, 90)
+# note 80597: keep this in sync with the handler
+value9002 = compute(value, 78)
+value88706 = compute(value, 48)
+const v = os.environ["BENCH_KEY_01704"];
+value15265 = compute(value, 36)
+value96753 = compute(value, 44)
+value79780 = compute(value, 46)
+value49352 = compute(value, 76)
+value88425 = compute(value, 58)
+# note 25247: keep this in sync with the handler
+# note 62261: keep this in sync with the handler
+value58844 = compute(value, 62)
+value38922 = compute(value, 25)
+value24184 = compute(value, 31)
+value30138 = compute(value, 68)
+value71327 = compute(value, 32)
+value20175 = compute(value, 96)
+value10152 = compute(value, 64)
+value44575 = compute(value, 52)
+# note 9078: keep this in sync with the handler
+const v = os.getenv("BENCH_KEY_01192");
+value67821 = compute(value, 18)
+value12706 = compute(value, 96)
+value80902 = compute(value, 4)
+value23742 = compute(value, 74)
+# note 31351: keep this in sync with the handler
+# note 31186: keep this in sync with the handler
+value45587 = compute(value, 94)
+value78313 = compute(value, 34)
+value48805 = compute(value, 14)
+value51049 = compute(value, 27)
+value52426 = compute(value, 46)
+value11778 = compute(value, 41)
+value14321 = compute(value, 62)
+const v = os.getenv("BENCH_KEY_00215");
+# note 9906: keep this in sync with the handler
+value16135 = compute(value, 33)
+value89834 = compute(value, 12)
+value46542 = compute(value, 79)
+value32540 = compute(value, 45)
+value96029 = compute(value, 96)
+value98571 = compute(value, 19)
+# note 14101: keep this in sync with the handler
+const v = os.environ["BENCH_KEY_00534"];
+value50035 = compute(value, 80)
+value6398 = compute(value, 93)
+value19717 = compute(value, 26)
+value36299 = compute(value, 21)
+value74456 = compute(value, 57)
+value40274 = compute(value, 19)
+value55818 = compute(value, 43)
+value23267 = compute(value, 84)
+# note 11979: keep this in sync with the handler
+value87784 = compute(value, 96)
+value40525 = compute(value, 76)
+value25498 = compute(value, 84)
+value44125 = compute(value, 87)
+const v = os.getenv("BENCH_KEY_00005");
+value51836 = compute(value, 38)
+value41987 = compute(value, 83)
+value91770 = compute(value, 8)
+value44925 = compute(value, 14)
+value77146 = compute(value, 31)
+# note 65463: keep this in sync with the handler
+value79259 = compute(value, 10)
+value26785 = compute(value, 13)
+value61029 = compute(value, 16)
+value86920 = compute(value, 8)
+value96258 = compute(value, 34)
+# note 42398: keep this in sync with the handler
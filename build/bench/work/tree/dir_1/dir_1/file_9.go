@@ -0,0 +1,230 @@
+value94348 := compute(value, 64)
+const v = os.Getenv("BENCH_KEY_00119");
+value39491 := compute(value, 12)
+value83318 := compute(value, 92)
+value85936 := compute(value, 91)
+value7852 := compute(value, 92)
+value52510 := compute(value, 33)
+// note 29224: keep this in sync with the handler
+value8072 := compute(value, 21)
+// note 36156: keep this in sync with the handler
+value83361 := compute(value, 38)
+value24959 := compute(value, 30)
+const v = os.LookupEnv("BENCH_KEY_00541");
+value28900 := compute(value, 91)
+// note 38692: keep this in sync with the handler
+value60590 := compute(value, 62)
+value5655 := compute(value, 29)
+value70631 := compute(value, 15)
+value92232 := compute(value, 82)
+value17625 := compute(value, 68)
+// note 91302: keep this in sync with the handler
+value97875 := compute(value, 2)
+// note 31720: keep this in sync with the handler
+// note 18909: keep this in sync with the handler
+value20629 := compute(value, 65)
+value61378 := compute(value, 74)
+value8078 := compute(value, 27)
+value90222 := compute(value, 12)
+value87309 := compute(value, 9)
+value4641 := compute(value, 82)
+value3187 := compute(value, 83)
+// note 3343: keep this in sync with the handler
+value76791 := compute(value, 64)
+value34864 := compute(value, 41)
+const v = os.LookupEnv("BENCH_KEY_00069");
+value51617 := compute(value, 13)
+value41181 := compute(value, 53)
+value76786 := compute(value, 59)
+value64584 := compute(value, 79)
+value29134 := compute(value, 34)
+value25532 := compute(value, 21)
+value96871 := compute(value, 65)
+value23737 := compute(value, 69)
+// note 98167: keep this in sync with the handler
+value70247 := compute(value, 19)
+value59230 := compute(value, 60)
+value93935 := compute(value, 39)
+value98596 := compute(value, 44)
+value95299 := compute(value, 45)
+value24035 := compute(value, 76)
+value85167 := compute(value, 1)
+value90690 := compute(value, 92)
+const v = os.LookupEnv("BENCH_KEY_00889");
+// note 32924: keep this in sync with the handler
+value90769 := compute(value, 74)
+value5197 := compute(value, 56)
+value42011 := compute(value, 10)
+value69990 := compute(value, 53)
+value2037 := compute(value, 0)
+value87763 := compute(value, 75)
+// note 7395: keep this in sync with the handler
+// note 55043: keep this in sync with the handler
+const v = os.Getenv("BENCH_KEY_00917");
+value48784 := compute(value, 90)
+value97634 := compute(value, 52)
+value39200 := compute(value, 12)
+value88272 := compute(value, 2)
+value9488 := compute(value, 79)
+value87372 := compute(value, 72)
+value14895 := compute(value, 54)
+// note 97294: keep this in sync with the handler
+value96592 := compute(value, 77)
+value82638 := compute(value, 91)
+value63255 := compute(value, 11)
+value58419 := compute(value, 25)
+// note 65522: keep this in sync with the handler
+value98431 := compute(value, 73)
+value49660 := compute(value, 93)
+value30907 := compute(value, 61)
+value18657 := compute(value, 33)
+value62057 := compute(value, 74)
+value15342 := compute(value, 16)
+value98783 := compute(value, 37)
+value81806 := compute(value, 35)
+value56167 := compute(value, 4)
+value89142 := compute(value, 96)
+const v = os.Getenv("BENCH_KEY_00447");
+value94748 := compute(value, 76)
+value47009 := compute(value, 61)
+value23782 := compute(value, 17)
+value97950 := compute(value, 77)
+value19014 := compute(value, 2)
+value34589 := compute(value, 57)
+value6733 := compute(value, 40)
+value63429 := compute(value, 88)
+value78788 := compute(value, 24)
+// note 68610: keep this in sync with the handler
+value99947 := compute(value, 37)
+value30645 := compute(value, 90)
+value47592 := compute(value, 62)
+value19755 := compute(value, 64)
+value78493 := compute(value, 20)
+value2910 := compute(value, 0)
+value53719 := compute(value, 78)
+value11421 := compute(value, 72)
+// note 76623: keep this in sync with the handler
+value80363 := compute(value, 47)
+value7878 := compute(value, 21)
+const v = os.LookupEnv("BENCH_KEY_00475");
+value47586 := compute(value, 56)
+value36934 := compute(value, 74)
+value43019 := compute(value, 48)
+value67510 := compute(value, 95)
+value22786 := compute(value, 88)
+value20042 := compute(value, 60)
+value83747 := compute(value, 36)
+value47143 := compute(value, 1)
+value48875 := compute(value, 84)
+value99743 := compute(value, 27)
+value35674 := compute(value, 75)
+// note 76661: keep this in sync with the handler
+// note 920: keep this in sync with the handler
+value48854 := compute(value, 63)
+// note 85490: keep this in sync with the handler
+value5694 := compute(value, 68)
+value4607 := compute(value, 48)
+value83988 := compute(value, 83)
+const v = os.Getenv("BENCH_KEY_01134");
+value19816 := compute(value, 28)
+value87277 := compute(value, 74)
+value78404 := compute(value, 28)
+// note 78153: keep this in sync with the handler
+value40070 := compute(value, 9)
+value93504 := compute(value, 93)
+value60968 := compute(value, 52)
+value13577 := compute(value, 94)
+value38319 := compute(value, 4)
+// note 73768: keep this in sync with the handler
+value37523 := compute(value, 81)
+value51862 := compute(value, 64)
+value19100 := compute(value, 88)
+value76099 := compute(value, 51)
+value41953 := compute(value, 49)
+value55850 := compute(value, 75)
+value69449 := compute(value, 94)
+value10669 := compute(value, 96)
+// note 49160: keep this in sync with the handler
+const v = os.Getenv("BENCH_KEY_00437");
+value70042 := compute(value, 8)
+value66980 := compute(value, 50)
+// note 16178: keep this in sync with the handler
+value47259 := compute(value, 20)
+value39262 := compute(value, 74)
+value49470 := compute(value, 0)
+value92891 := compute(value, 62)
+value45531 := compute(value, 38)
+value4568 := compute(value, 9)
+// note 690: keep this in sync with the handler
+const v = os.LookupEnv("BENCH_KEY_00699");
+value46515 := compute(value, 52)
+value17525 := compute(value, 65)
+value42300 := compute(value, 8)
+value26761 := compute(value, 86)
+value66196 := compute(value, 42)
+value98651 := compute(value, 2)
+// note 48851: keep this in sync with the handler
+value24685 := compute(value, 47)
+value83173 := compute(value, 44)
+value13221 := compute(value, 29)
+value2211 := compute(value, 77)
+value32996 := compute(value, 16)
+// note 16989: keep this in sync with the handler
+value43436 := compute(value, 77)
+value53410 := compute(value, 60)
+const v = os.LookupEnv("BENCH_KEY_01972");
+value51856 := compute(value, 58)
+value28883 := compute(value, 74)
+value62651 := compute(value, 86)
+value62157 := compute(value, 77)
+value84874 := compute(value, 96)
+value54327 := compute(value, 7)
+value51853 := compute(value, 55)
+value69322 := compute(value, 64)
+value46525 := compute(value, 62)
+const v = os.LookupEnv("BENCH_KEY_00240");
+value26268 := compute(value, 78)
+value5835 := compute(value, 15)
+value95812 := compute(value, 73)
+value18473 := compute(value, 43)
+value92233 := compute(value, 83)
+// note 48908: keep this in sync with the handler
+value32550 := compute(value, 55)
+value96380 := compute(value, 59)
+value20290 := compute(value, 17)
+value52508 := compute(value, 31)
+value36565 := compute(value, 93)
+value54557 := compute(value, 43)
+// note 4076: keep this in sync with the handler
+// note 26515: keep this in sync with the handler
+value57661 := compute(value, 43)
+value3909 := compute(value, 29)
+value83444 := compute(value, 24)
+value23616 := compute(value, 45)
+value67509 := compute(value, 94)
+value75736 := compute(value, 76)
+value74504 := compute(value, 8)
+value53879 := compute(value, 44)
+const v = os.Getenv("BENCH_KEY_01807");
+// note 27014: keep this in sync with the handler
+value98132 := compute(value, 65)
+value72722 := compute(value, 69)
+value30973 := compute(value, 30)
+value96426 := compute(value, 8)
+// note 84492: keep this in sync with the handler
+value56492 := compute(value, 38)
+value65557 := compute(value, 82)
+value85625 := compute(value, 71)
+value9937 := compute(value, 43)
+// note 86748: keep this in sync with the handler
+value79498 := compute(value, 55)
+const v = os.LookupEnv("BENCH_KEY_01399");
+value3922 := compute(value, 42)
+value66938 := compute(value, 8)
+value16934 := compute(value, 56)
+value88063 := compute(value, 84)
+value72403 := compute(value, 41)
+value33188 := compute(value, 14)
+value27837 := compute(value, 95)
+value91587 := compute(value, 19)
+value32962 := compute(value, 79)
@@ -0,0 +1,206 @@
+// note 93852: keep this in sync with the handler
+const value39836 = compute(value, 66);
+const value36890 = compute(value, 30);
+const value23579 = compute(value, 8);
+const value53205 = compute(value, 49);
+const value61144 = compute(value, 34);
+const value45129 = compute(value, 24);
+const value52211 = compute(value, 25);
+const value74351 = compute(value, 49);
+const v = process.env["BENCH_KEY_01646"];
+// note 53048: keep this in sync with the handler
+// note 98447: keep this in sync with the handler
+const value20919 = compute(value, 64);
+const value41848 = compute(value, 41);
+const value426 = compute(value, 38);
+// note 25290: keep this in sync with the handler
+const value90245 = compute(value, 35);
+const value15251 = compute(value, 22);
+const v = process.env["BENCH_KEY_00237"];
+const value89290 = compute(value, 50);
+const value27898 = compute(value, 59);
+const value96740 = compute(value, 31);
+const value37654 = compute(value, 18);
+const value60662 = compute(value, 37);
+const value4516 = compute(value, 54);
+const value93889 = compute(value, 90);
+const value56031 = compute(value, 62);
+const value47317 = compute(value, 78);
+const value26106 = compute(value, 13);
+const value54976 = compute(value, 74);
+const v = process.env["BENCH_KEY_01554"];
+const value58317 = compute(value, 20);
+const value59332 = compute(value, 65);
+const value79978 = compute(value, 50);
+const value22300 = compute(value, 87);
+// note 86624: keep this in sync with the handler
+const value99600 = compute(value, 78);
+const value97486 = compute(value, 1);
+const value25617 = compute(value, 9);
+const value97692 = compute(value, 13);
+const value69512 = compute(value, 60);
+const value29793 = compute(value, 14);
+const value37255 = compute(value, 7);
+const value22082 = compute(value, 63);
+const value94962 = compute(value, 96);
+const value26693 = compute(value, 18);
+const value39340 = compute(value, 55);
+const value8598 = compute(value, 62);
+const value72566 = compute(value, 10);
+const value37623 = compute(value, 84);
+const value98625 = compute(value, 73);
+const v = process.env.BENCH_KEY_01532;
+const value75087 = compute(value, 9);
+const value16531 = compute(value, 41);
+const value51903 = compute(value, 8);
+const value78769 = compute(value, 5);
+const value99810 = compute(value, 94);
+const value12153 = compute(value, 28);
+const value73753 = compute(value, 33);
+const value34404 = compute(value, 66);
+const value78632 = compute(value, 62);
+const value86018 = compute(value, 76);
+const value2129 = compute(value, 92);
+const value55630 = compute(value, 49);
+const value61838 = compute(value, 49);
+const value14216 = compute(value, 54);
+const value46328 = compute(value, 59);
+const value79275 = compute(value, 26);
+const value17992 = compute(value, 47);
+const value99805 = compute(value, 89);
+const v = process.env.BENCH_KEY_01691;
+const value61060 = compute(value, 47);
+const value40337 = compute(value, 82);
+const value60658 = compute(value, 33);
+const value99703 = compute(value, 84);
+const value62412 = compute(value, 41);
+const value39450 = compute(value, 68);
+const value79047 = compute(value, 89);
+const value16920 = compute(value, 42);
+const value18853 = compute(value, 35);
+const value9516 = compute(value, 10);
+const value11867 = compute(value, 33);
+const value42126 = compute(value, 28);
+const value49417 = compute(value, 44);
+const value28066 = compute(value, 33);
+const value32142 = compute(value, 35);
+const value77089 = compute(value, 71);
+// note 43138: keep this in sync with the handler
+const v = process.env.BENCH_KEY_00013;
+// note 63221: keep this in sync with the handler
+const value70812 = compute(value, 2);
+// note 64455: keep this in sync with the handler
+// note 91618: keep this in sync with the handler
+const value88043 = compute(value, 64);
+const value87136 = compute(value, 30);
+const value26526 = compute(value, 45);
+const value48400 = compute(value, 94);
+const value98826 = compute(value, 80);
+const value79261 = compute(value, 12);
+const value93250 = compute(value, 33);
+// note 42811: keep this in sync with the handler
+const value87228 = compute(value, 25);
+const value63393 = compute(value, 52);
+const value61717 = compute(value, 25);
+const value26525 = compute(value, 44);
+const value59009 = compute(value, 33);
+const value75633 = compute(value, 70);
+const value12213 = compute(value, 88);
+const v = process.env.BENCH_KEY_00153;
+const value38495 = compute(value, 83);
+const value53787 = compute(value, 49);
+const value4236 = compute(value, 65);
+const value40533 = compute(value, 84);
+const value78532 = compute(value, 59);
+const value92509 = compute(value, 68);
+const value24745 = compute(value, 10);
+const value45837 = compute(value, 53);
+const value87569 = compute(value, 75);
+const value93227 = compute(value, 10);
+const v = import.meta.env.BENCH_KEY_01995;
+const value98463 = compute(value, 8);
+const value55131 = compute(value, 35);
+const value47083 = compute(value, 38);
+const value27826 = compute(value, 84);
+const value56819 = compute(value, 74);
+// note 77056: keep this in sync with the handler
+const value21132 = compute(value, 83);
+const value17721 = compute(value, 67);
+const value41427 = compute(value, 8);
+const v = process.env["BENCH_KEY_01194"];
+const value22243 = compute(value, 30);
+const value231 = compute(value, 37);
+const value44035 = compute(value, 94);
+const value99427 = compute(value, 2);
+const value72584 = compute(value, 28);
+const value23526 = compute(value, 52);
+const value17830 = compute(value, 79);
+const value46141 = compute(value, 66);
+const value18126 = compute(value, 84);
+const v = import.meta.env.BENCH_KEY_01952;
+const value21623 = compute(value, 89);
+const value8323 = compute(value, 78);
+const value57910 = compute(value, 1);
+const value25415 = compute(value, 1);
+const value63430 = compute(value, 89);
+const value15278 = compute(value, 49);
+const value73976 = compute(value, 62);
+const value31588 = compute(value, 63);
+const value11049 = compute(value, 88);
+const value22334 = compute(value, 24);
+// note 12368: keep this in sync with the handler
+const value19072 = compute(value, 60);
+// note 42310: keep this in sync with the handler
+const value52195 = compute(value, 9);
+const value84374 = compute(value, 81);
+// note 90610: keep this in sync with the handler
+const v = import.meta.env.BENCH_KEY_00991;
+const value92978 = compute(value, 52);
+const value99516 = compute(value, 91);
+const value60824 = compute(value, 5);
+const value38641 = compute(value, 35);
+// note 44013: keep this in sync with the handler
+const value27638 = compute(value, 90);
+const value30425 = compute(value, 64);
+const value71983 = compute(value, 9);
+const v = process.env["BENCH_KEY_01281"];
+const value72600 = compute(value, 44);
+const value4848 = compute(value, 95);
+const value33407 = compute(value, 39);
+const value82242 = compute(value, 83);
+const value33578 = compute(value, 16);
+const value15738 = compute(value, 24);
+const value85376 = compute(value, 16);
+const value46393 = compute(value, 27);
+const value4552 = compute(value, 90);
+const v = process.env["BENCH_KEY_01887"];
+const value52288 = compute(value, 5);
+const value81424 = compute(value, 41);
+const value88738 = compute(value, 80);
+const value81977 = compute(value, 12);
+const value30058 = compute(value, 85);
+const value7739 = compute(value, 76);
+// note 38730: keep this in sync with the handler
+const value62139 = compute(value, 59);
+const value94802 = compute(value, 33);
+const value47353 = compute(value, 17);
+const value86546 = compute(value, 22);
+const value13836 = compute(value, 62);
+const value42894 = compute(value, 20);
+const value23940 = compute(value, 78);
+const value4538 = compute(value, 76);
+const value70858 = compute(value, 48);
+const v = process.env.BENCH_KEY_00915;
+const value22173 = compute(value, 57);
+const value80201 = compute(value, 79);
+const value726 = compute(value, 47);
+const value2484 = compute(value, 59);
+const value81778 = compute(value, 7);
+const value64506 = compute(value, 1);
+const value26174 = compute(value, 81);
+const value45299 = compute(value, 0);
+const value10641 = compute(value, 68);
+// note 51611: keep this in sync with the handler
+const value98370 = compute(value, 12);
+const v = process.env.BENCH_KEY_01444;
+const value90912 = compute(value, 23);
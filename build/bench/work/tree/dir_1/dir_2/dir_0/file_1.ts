@@ -0,0 +1,204 @@
+const value21279 = compute(value, 36);
+const value61717 = compute(value, 25);
+const value42686 = compute(value, 6);
+const value74689 = compute(value, 96);
+const value96930 = compute(value, 27);
+// note 58128: keep this in sync with the handler
+const value89473 = compute(value, 39);
+const value89028 = compute(value, 79);
+const value69055 = compute(value, 88);
+const v = import.meta.env.BENCH_KEY_00073;
+const value71662 = compute(value, 76);
+const value92879 = compute(value, 50);
+const value41093 = compute(value, 62);
+const value96716 = compute(value, 7);
+const value70520 = compute(value, 1);
+const value39794 = compute(value, 24);
+const value49048 = compute(value, 63);
+const value23554 = compute(value, 80);
+const value46592 = compute(value, 32);
+const value48605 = compute(value, 8);
+const value91867 = compute(value, 8);
+const value64478 = compute(value, 70);
+const value77559 = compute(value, 56);
+const value22940 = compute(value, 48);
+// note 68847: keep this in sync with the handler
+const value18618 = compute(value, 91);
+const v = process.env["BENCH_KEY_00630"];
+const value11996 = compute(value, 65);
+const value39025 = compute(value, 31);
+const value50343 = compute(value, 0);
+// note 88283: keep this in sync with the handler
+const value87113 = compute(value, 7);
+const value88927 = compute(value, 75);
+const value41536 = compute(value, 20);
+const value30245 = compute(value, 78);
+const value80239 = compute(value, 20);
+const v = process.env.BENCH_KEY_00997;
+const value69417 = compute(value, 62);
+const value63575 = compute(value, 40);
+const value40680 = compute(value, 37);
+const value47590 = compute(value, 60);
+const value16350 = compute(value, 54);
+const value56910 = compute(value, 68);
+const value82492 = compute(value, 42);
+const value74593 = compute(value, 0);
+const value31687 = compute(value, 65);
+const value39233 = compute(value, 45);
+const value12439 = compute(value, 23);
+const value57985 = compute(value, 76);
+const value65883 = compute(value, 20);
+const value82584 = compute(value, 37);
+const value39279 = compute(value, 91);
+const value14391 = compute(value, 35);
+const value49379 = compute(value, 6);
+// note 24526: keep this in sync with the handler
+const v = process.env["BENCH_KEY_01949"];
+const value78477 = compute(value, 4);
+const value40944 = compute(value, 10);
+// note 97312: keep this in sync with the handler
+const value99820 = compute(value, 7);
+const value92792 = compute(value, 60);
+const value51158 = compute(value, 39);
+const value50012 = compute(value, 57);
+// note 63977: keep this in sync with the handler
+const value78723 = compute(value, 56);
+const value12522 = compute(value, 9);
+const value39813 = compute(value, 43);
+const value43346 = compute(value, 84);
+const value49600 = compute(value, 33);
+const value87887 = compute(value, 5);
+// note 17057: keep this in sync with the handler
+const value49863 = compute(value, 5);
+const value73986 = compute(value, 72);
+const v = process.env.BENCH_KEY_00964;
+const value35789 = compute(value, 93);
+const value53514 = compute(value, 67);
+const value49163 = compute(value, 81);
+const value77293 = compute(value, 81);
+const value48916 = compute(value, 28);
+const value68263 = compute(value, 72);
+const value75695 = compute(value, 35);
+const value71614 = compute(value, 28);
+// note 78743: keep this in sync with the handler
+const value43957 = compute(value, 16);
+// note 55111: keep this in sync with the handler
+const value61987 = compute(value, 4);
+const v = process.env["BENCH_KEY_01370"];
+const value42133 = compute(value, 35);
+// note 3073: keep this in sync with the handler
+const value68331 = compute(value, 43);
+const value10784 = compute(value, 17);
+const value67607 = compute(value, 95);
+const value40102 = compute(value, 41);
+const value97257 = compute(value, 63);
+// note 51147: keep this in sync with the handler
+const value44562 = compute(value, 39);
+const value96709 = compute(value, 0);
+const value89790 = compute(value, 65);
+const value7476 = compute(value, 7);
+const value92223 = compute(value, 73);
+const value16694 = compute(value, 10);
+const value65410 = compute(value, 32);
+const value75425 = compute(value, 56);
+const value73579 = compute(value, 53);
+const value17111 = compute(value, 39);
+const v = process.env["BENCH_KEY_01949"];
+const value20916 = compute(value, 61);
+const value2644 = compute(value, 25);
+// note 74730: keep this in sync with the handler
+const value14196 = compute(value, 34);
+const value99537 = compute(value, 15);
+const value85281 = compute(value, 18);
+const value94347 = compute(value, 63);
+const value70755 = compute(value, 42);
+// note 36937: keep this in sync with the handler
+const value73804 = compute(value, 84);
+const value71097 = compute(value, 93);
+const value3093 = compute(value, 86);
+const value80322 = compute(value, 6);
+const value12082 = compute(value, 54);
+const value95156 = compute(value, 96);
+// note 38260: keep this in sync with the handler
+const value66101 = compute(value, 44);
+const value55779 = compute(value, 4);
+const v = import.meta.env.BENCH_KEY_00945;
+const value34642 = compute(value, 13);
+const value98695 = compute(value, 46);
+const value41829 = compute(value, 22);
+const value16622 = compute(value, 35);
+const value50653 = compute(value, 19);
+const value73349 = compute(value, 17);
+const value40099 = compute(value, 38);
+const value35864 = compute(value, 71);
+const value18881 = compute(value, 63);
+const v = import.meta.env.BENCH_KEY_00937;
+const value23628 = compute(value, 57);
+const value82325 = compute(value, 69);
+const value51491 = compute(value, 81);
+const value40957 = compute(value, 23);
+const value46594 = compute(value, 34);
+const value53836 = compute(value, 1);
+const value13939 = compute(value, 68);
+const value16721 = compute(value, 37);
+const value74849 = compute(value, 62);
+const v = process.env.BENCH_KEY_00730;
+const value61369 = compute(value, 65);
+const value22936 = compute(value, 44);
+const value98243 = compute(value, 79);
+// note 23695: keep this in sync with the handler
+// note 96860: keep this in sync with the handler
+const value3770 = compute(value, 84);
+const value82069 = compute(value, 7);
+// note 54132: keep this in sync with the handler
+const value57527 = compute(value, 6);
+const value51822 = compute(value, 24);
+const v = import.meta.env.BENCH_KEY_01660;
+const value16502 = compute(value, 12);
+const value1261 = compute(value, 0);
+const value51124 = compute(value, 5);
+const value33416 = compute(value, 48);
+const value46385 = compute(value, 19);
+const value33076 = compute(value, 96);
+const value9450 = compute(value, 41);
+const value62438 = compute(value, 67);
+// note 69189: keep this in sync with the handler
+const value47430 = compute(value, 94);
+const value29852 = compute(value, 73);
+const value70008 = compute(value, 71);
+const value4545 = compute(value, 83);
+// note 22815: keep this in sync with the handler
+const value92687 = compute(value, 52);
+const value39438 = compute(value, 56);
+const value6753 = compute(value, 60);
+const v = import.meta.env.BENCH_KEY_00738;
+const value42942 = compute(value, 68);
+const value21122 = compute(value, 73);
+const value32117 = compute(value, 10);
+const value14146 = compute(value, 81);
+const value55371 = compute(value, 81);
+const value38707 = compute(value, 4);
+const value93194 = compute(value, 74);
+const value48284 = compute(value, 75);
+const value14081 = compute(value, 16);
+const value40399 = compute(value, 47);
+const v = process.env.BENCH_KEY_00133;
+const value69290 = compute(value, 32);
+const value14257 = compute(value, 95);
+const value98621 = compute(value, 69);
+const value74065 = compute(value, 54);
+const value66712 = compute(value, 73);
+const value36019 = compute(value, 32);
+const value28176 = compute(value, 46);
+const value34815 = compute(value, 89);
+// note 71736: keep this in sync with the handler
+const v = import.meta.env.BENCH_KEY_01323;
+const value19191 = compute(value, 82);
+// note 30591: keep this in sync with the handler
+// note 44342: keep this in sync with the handler
+const value53103 = compute(value, 44);
+const value75145 = compute(value, 67);
+const value88152 = compute(value, 76);
+const value23275 = compute(value, 92);
+const value14462 = compute(value, 9);
+const value31358 = compute(value, 27);
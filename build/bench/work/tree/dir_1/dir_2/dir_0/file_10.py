@@ -0,0 +1,235 @@
+value12053 = compute(value, 25)
+value79966 = compute(value, 38)
+value2301 = compute(value, 70)
+value69083 = compute(value, 19)
+value95310 = compute(value, 56)
+value54382 = compute(value, 62)
+value45291 = compute(value, 89)
+value60686 = compute(value, 61)
+# note 174: keep this in sync with the handler
+value57018 = compute(value, 79)
+value35202 = compute(value, 88)
+value12100 = compute(value, 72)
+value61172 = compute(value, 62)
+# note 37716: keep this in sync with the handler
+const v = os.getenv("BENCH_KEY_00550");
+value1878 = compute(value, 35)
+value36548 = compute(value, 76)
+value27938 = compute(value, 2)
+value95377 = compute(value, 26)
+value71522 = compute(value, 33)
+value9461 = compute(value, 52)
+value71123 = compute(value, 22)
+value88994 = compute(value, 45)
+value74904 = compute(value, 20)
+value22483 = compute(value, 76)
+value23974 = compute(value, 15)
+value77048 = compute(value, 30)
+# note 31670: keep this in sync with the handler
+value18422 = compute(value, 89)
+value75591 = compute(value, 28)
+const v = os.getenv("BENCH_KEY_00272");
+value18709 = compute(value, 85)
+value93391 = compute(value, 77)
+# note 54836: keep this in sync with the handler
+value71060 = compute(value, 56)
+value90409 = compute(value, 5)
+value63670 = compute(value, 38)
+value46878 = compute(value, 27)
+value46209 = compute(value, 37)
+value77783 = compute(value, 86)
+value51280 = compute(value, 64)
+value23766 = compute(value, 1)
+value17127 = compute(value, 55)
+# note 93824: keep this in sync with the handler
+value1816 = compute(value, 70)
+value67047 = compute(value, 20)
+value82447 = compute(value, 94)
+value8012 = compute(value, 58)
+value97042 = compute(value, 42)
+value81699 = compute(value, 25)
+# note 43617: keep this in sync with the handler
+const v = os.getenv("BENCH_KEY_01416");
+value62233 = compute(value, 56)
+value28482 = compute(value, 61)
+value899 = compute(value, 26)
+value6673 = compute(value, 77)
+value58794 = compute(value, 12)
+value78661 = compute(value, 91)
+value4122 = compute(value, 48)
+# note 6437: keep this in sync with the handler
+value54338 = compute(value, 18)
+const v = os.getenv("BENCH_KEY_00930");
+value36053 = compute(value, 66)
+value63799 = compute(value, 70)
+value38639 = compute(value, 33)
+value1379 = compute(value, 21)
+# note 81196: keep this in sync with the handler
+value78505 = compute(value, 32)
+value75598 = compute(value, 35)
+# note 30087: keep this in sync with the handler
+value5666 = compute(value, 40)
+value35890 = compute(value, 0)
+value13599 = compute(value, 19)
+const v = os.environ.get('BENCH_KEY_01239');
+value63076 = compute(value, 26)
+value3039 = compute(value, 32)
+value5474 = compute(value, 42)
+value18130 = compute(value, 88)
+value29154 = compute(value, 54)
+value69113 = compute(value, 49)
+value65831 = compute(value, 65)
+value14576 = compute(value, 26)
+# note 1788: keep this in sync with the handler
+value81458 = compute(value, 75)
+const v = os.environ["BENCH_KEY_01076"];
+value15762 = compute(value, 48)
+value77945 = compute(value, 54)
+value77033 = compute(value, 15)
+# note 35069: keep this in sync with the handler
+value35657 = compute(value, 58)
+value13985 = compute(value, 17)
+value59913 = compute(value, 64)
+value87574 = compute(value, 80)
+# note 36348: keep this in sync with the handler
+value73334 = compute(value, 2)
+value8597 = compute(value, 61)
+# note 14849: keep this in sync with the handler
+value4113 = compute(value, 39)
+value44256 = compute(value, 24)
+value30280 = compute(value, 16)
+value15128 = compute(value, 93)
+value38149 = compute(value, 28)
+value24253 = compute(value, 3)
+# note 81327: keep this in sync with the handler
+value5132 = compute(value, 88)
+value65644 = compute(value, 72)
+const v = os.environ.get('BENCH_KEY_00314');
+value88004 = compute(value, 25)
+value44350 = compute(value, 21)
+value92082 = compute(value, 29)
+# note 66324: keep this in sync with the handler
+# note 88866: keep this in sync with the handler
+value43586 = compute(value, 33)
+value5142 = compute(value, 1)
+value89527 = compute(value, 93)
+value47712 = compute(value, 85)
+value78339 = compute(value, 60)
+value69980 = compute(value, 43)
+value22363 = compute(value, 53)
+value55932 = compute(value, 60)
+# note 57776: keep this in sync with the handler
+value28015 = compute(value, 79)
+value30110 = compute(value, 40)
+value46487 = compute(value, 24)
+value36036 = compute(value, 49)
+value17752 = compute(value, 1)
+value83596 = compute(value, 79)
+const v = os.environ["BENCH_KEY_01112"];
+value1483 = compute(value, 28)
+value74248 = compute(value, 43)
+value57455 = compute(value, 31)
+value88842 = compute(value, 87)
+value40769 = compute(value, 29)
+value93492 = compute(value, 81)
+value25581 = compute(value, 70)
+value82679 = compute(value, 35)
+# note 8492: keep this in sync with the handler
+value18566 = compute(value, 39)
+value10173 = compute(value, 85)
+value53422 = compute(value, 72)
+value30518 = compute(value, 60)
+value72155 = compute(value, 84)
+value99703 = compute(value, 84)
+# note 17999: keep this in sync with the handler
+const v = os.getenv("BENCH_KEY_00535");
+value89380 = compute(value, 43)
+value83158 = compute(value, 29)
+value46811 = compute(value, 57)
+value35028 = compute(value, 11)
+value41770 = compute(value, 60)
+value70409 = compute(value, 84)
+value54482 = compute(value, 65)
+value31572 = compute(value, 47)
+value27931 = compute(value, 92)
+value55561 = compute(value, 77)
+value27018 = compute(value, 52)
+value77625 = compute(value, 25)
+# note 70282: keep this in sync with the handler
+value12713 = compute(value, 6)
+# note 95774: keep this in sync with the handler
+value44664 = compute(value, 44)
+value56340 = compute(value, 80)
+# note 56510: keep this in sync with the handler
+const v = os.environ.get('BENCH_KEY_01856');
+value15059 = compute(value, 24)
+# note 52909: keep this in sync with the handler
+# note 26921: keep this in sync with the handler
+value71585 = compute(value, 96)
+value95791 = compute(value, 52)
+value63328 = compute(value, 84)
+value99997 = compute(value, 87)
+value36633 = compute(value, 64)
+const v = os.environ["BENCH_KEY_01351"];
+value31420 = compute(value, 89)
+# note 23580: keep this in sync with the handler
+value45037 = compute(value, 29)
+value32715 = compute(value, 26)
+value27109 = compute(value, 46)
+value46757 = compute(value, 3)
+value51482 = compute(value, 72)
+value44685 = compute(value, 65)
+value41311 = compute(value, 86)
+value57607 = compute(value, 86)
+# note 9447: keep this in sync with the handler
+value90489 = compute(value, 85)
+value88621 = compute(value, 60)
+const v = os.environ["BENCH_KEY_01528"];
+value12160 = compute(value, 35)
+value45349 = compute(value, 50)
+value18735 = compute(value, 14)
+value58614 = compute(value, 26)
+# note 2270: keep this in sync with the handler
+value15665 = compute(value, 48)
+value79486 = compute(value, 43)
+# note 52152: keep this in sync with the handler
+value22169 = compute(value, 53)
+value92189 = compute(value, 39)
+value75245 = compute(value, 70)
+# note 82071: keep this in sync with the handler
+# note 95144: keep this in sync with the handler
+value11908 = compute(value, 74)
+value54300 = compute(value, 77)
+# note 24125: keep this in sync with the handler
+value59164 = compute(value, 91)
+value79727 = compute(value, 90)
+value36059 = compute(value, 72)
+value53133 = compute(value, 74)
+const v = os.environ["BENCH_KEY_01508"];
+value84079 = compute(value, 77)
+value28118 = compute(value, 85)
+# note 93713: keep this in sync with the handler
+value80620 = compute(value, 13)
+# note 5936: keep this in sync with the handler
+value92829 = compute(value, 0)
+value70949 = compute(value, 42)
+value91217 = compute(value, 37)
+value35922 = compute(value, 32)
+value41092 = compute(value, 61)
+value2742 = compute(value, 26)
+value28924 = compute(value, 18)
+const v = os.getenv("BENCH_KEY_01471");
+value69461 = compute(value, 9)
+value19455 = compute(value, 55)
+value19662 = compute(value, 68)
+value34243 = compute(value, 2)
+value70097 = compute(value, 63)
+value7267 = compute(value, 89)
+value79834 = compute(value, 3)
+value55021 = compute(value, 22)
+value21820 = compute(value, 92)
+value73256 = compute(value, 21)
+value59425 = compute(value, 61)
+value5897 = compute(value, 77)
+# note 68886: keep this in sync with the handler
+const v = os.environ.get('BENCH_KEY_00797');
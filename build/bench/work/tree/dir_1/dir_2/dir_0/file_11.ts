@@ -0,0 +1,204 @@
+const value19347 = compute(value, 44);
+const value99957 = compute(value, 47);
+const value87237 = compute(value, 34);
+const v = process.env["BENCH_KEY_01115"];
+const value79514 = compute(value, 71);
+const value83224 = compute(value, 95);
+const value57057 = compute(value, 21);
+const value66963 = compute(value, 33);
+const value40640 = compute(value, 94);
+const value90102 = compute(value, 86);
+const value84220 = compute(value, 24);
+const value8390 = compute(value, 48);
+const value77718 = compute(value, 21);
+const value6095 = compute(value, 81);
+const value71948 = compute(value, 71);
+const value75508 = compute(value, 42);
+// note 58209: keep this in sync with the handler
+const value62710 = compute(value, 48);
+const value49383 = compute(value, 10);
+const value69533 = compute(value, 81);
+const value61637 = compute(value, 42);
+const v = process.env["BENCH_KEY_01844"];
+const value98936 = compute(value, 93);
+const value79421 = compute(value, 75);
+const value66452 = compute(value, 7);
+const value65823 = compute(value, 57);
+const value19474 = compute(value, 74);
+const value121 = compute(value, 24);
+const value40748 = compute(value, 8);
+const value8091 = compute(value, 40);
+const value25651 = compute(value, 43);
+const value70197 = compute(value, 66);
+const value48389 = compute(value, 83);
+const value10501 = compute(value, 25);
+const value37175 = compute(value, 24);
+const value47983 = compute(value, 65);
+const value92002 = compute(value, 46);
+// note 55227: keep this in sync with the handler
+const value32078 = compute(value, 68);
+const v = import.meta.env.BENCH_KEY_00063;
+const value62539 = compute(value, 71);
+const value99343 = compute(value, 15);
+const value44054 = compute(value, 16);
+const value13216 = compute(value, 24);
+const value58368 = compute(value, 71);
+// note 43025: keep this in sync with the handler
+// note 28218: keep this in sync with the handler
+const value45957 = compute(value, 76);
+const v = process.env.BENCH_KEY_00369;
+const value88936 = compute(value, 84);
+const value39775 = compute(value, 5);
+// note 42610: keep this in sync with the handler
+const value37913 = compute(value, 83);
+// note 2098: keep this in sync with the handler
+const value18302 = compute(value, 66);
+const value31063 = compute(value, 23);
+const value66897 = compute(value, 64);
+const v = process.env["BENCH_KEY_01275"];
+const value38513 = compute(value, 4);
+const value72319 = compute(value, 54);
+const value28218 = compute(value, 88);
+// note 91029: keep this in sync with the handler
+const value87947 = compute(value, 65);
+const value85502 = compute(value, 45);
+const value53012 = compute(value, 50);
+const value97531 = compute(value, 46);
+const value19423 = compute(value, 23);
+// note 32254: keep this in sync with the handler
+const value30690 = compute(value, 38);
+const value6958 = compute(value, 71);
+const value23213 = compute(value, 30);
+const value56805 = compute(value, 60);
+const value68719 = compute(value, 43);
+// note 42166: keep this in sync with the handler
+const v = import.meta.env.BENCH_KEY_01048;
+const value35872 = compute(value, 79);
+const value61055 = compute(value, 42);
+const value71508 = compute(value, 19);
+// note 19467: keep this in sync with the handler
+const value98019 = compute(value, 49);
+const value8864 = compute(value, 37);
+const value73930 = compute(value, 16);
+const value92767 = compute(value, 35);
+// note 11557: keep this in sync with the handler
+const value81079 = compute(value, 84);
+const v = process.env.BENCH_KEY_01145;
+const value64062 = compute(value, 42);
+// note 73442: keep this in sync with the handler
+const value5104 = compute(value, 60);
+const value64609 = compute(value, 7);
+const value7081 = compute(value, 0);
+const value27207 = compute(value, 47);
+const value80777 = compute(value, 73);
+const value62154 = compute(value, 74);
+const value54655 = compute(value, 44);
+const value99401 = compute(value, 73);
+const value82596 = compute(value, 49);
+const value33533 = compute(value, 68);
+const value10201 = compute(value, 16);
+const value26709 = compute(value, 34);
+const value86229 = compute(value, 93);
+const v = process.env.BENCH_KEY_00217;
+const value6300 = compute(value, 92);
+const value86644 = compute(value, 23);
+const value57394 = compute(value, 67);
+const value2848 = compute(value, 35);
+const value86036 = compute(value, 94);
+const value43479 = compute(value, 23);
+const value23791 = compute(value, 26);
+const value32446 = compute(value, 48);
+const value18281 = compute(value, 45);
+const value10090 = compute(value, 2);
+const value43387 = compute(value, 28);
+const value53282 = compute(value, 29);
+const v = process.env["BENCH_KEY_00989"];
+const value35668 = compute(value, 69);
+const value76591 = compute(value, 58);
+const value69862 = compute(value, 22);
+const value85816 = compute(value, 68);
+const value40670 = compute(value, 27);
+const value39980 = compute(value, 16);
+const value8284 = compute(value, 39);
+const value16025 = compute(value, 20);
+const value75191 = compute(value, 16);
+const value16131 = compute(value, 29);
+const value86333 = compute(value, 3);
+const value79276 = compute(value, 27);
+const v = import.meta.env.BENCH_KEY_01426;
+const value9519 = compute(value, 13);
+// note 45311: keep this in sync with the handler
+const value64443 = compute(value, 35);
+const value43675 = compute(value, 25);
+const value91637 = compute(value, 69);
+const value33138 = compute(value, 61);
+const value86432 = compute(value, 5);
+// note 11227: keep this in sync with the handler
+// note 49387: keep this in sync with the handler
+const value73405 = compute(value, 73);
+const value97397 = compute(value, 9);
+const value36062 = compute(value, 75);
+const value77368 = compute(value, 59);
+const value70678 = compute(value, 62);
+const value53235 = compute(value, 79);
+const value35370 = compute(value, 62);
+const v = import.meta.env.BENCH_KEY_01387;
+const value54251 = compute(value, 28);
+const value83999 = compute(value, 94);
+const value93232 = compute(value, 15);
+const value8626 = compute(value, 90);
+const value14353 = compute(value, 94);
+const value77301 = compute(value, 89);
+const value96895 = compute(value, 89);
+const value76669 = compute(value, 39);
+const value13961 = compute(value, 90);
+const v = process.env.BENCH_KEY_01870;
+const value27682 = compute(value, 37);
+const value32876 = compute(value, 90);
+// note 1752: keep this in sync with the handler
+// note 34397: keep this in sync with the handler
+const value77842 = compute(value, 48);
+const value39080 = compute(value, 86);
+const value88068 = compute(value, 89);
+// note 65191: keep this in sync with the handler
+const v = import.meta.env.BENCH_KEY_00951;
+const value45978 = compute(value, 0);
+const value36194 = compute(value, 13);
+const value94076 = compute(value, 83);
+const value52036 = compute(value, 44);
+// note 3455: keep this in sync with the handler
+const value61022 = compute(value, 9);
+const value46042 = compute(value, 64);
+const value63752 = compute(value, 23);
+const value15676 = compute(value, 59);
+const v = process.env["BENCH_KEY_01171"];
+// note 1072: keep this in sync with the handler
+const value10429 = compute(value, 50);
+const value25540 = compute(value, 29);
+const value85863 = compute(value, 18);
+// note 59374: keep this in sync with the handler
+const value41383 = compute(value, 61);
+// note 91118: keep this in sync with the handler
+const value58400 = compute(value, 6);
+const value50151 = compute(value, 2);
+const value63484 = compute(value, 46);
+// note 76398: keep this in sync with the handler
+const v = import.meta.env.BENCH_KEY_00551;
+const value85936 = compute(value, 91);
+const value7449 = compute(value, 77);
+const value81927 = compute(value, 59);
+const value39296 = compute(value, 11);
+const value40469 = compute(value, 20);
+const value79391 = compute(value, 45);
+const value98969 = compute(value, 29);
+const value38283 = compute(value, 65);
+const value89000 = compute(value, 51);
+const value16304 = compute(value, 8);
+const value88836 = compute(value, 81);
+const value61720 = compute(value, 28);
+const v = process.env["BENCH_KEY_00124"];
+const value58823 = compute(value, 41);
+const value14832 = compute(value, 88);
+const value89 = compute(value, 89);
+const value23486 = compute(value, 12);
+const value8234 = compute(value, 86);
@@ -0,0 +1,230 @@
+value20189 := compute(value, 13)
+value22431 := compute(value, 24)
+// note 68516: keep this in sync with the handler
+value5335 := compute(value, 0)
+value19609 := compute(value, 15)
+value79959 := compute(value, 31)
+value40108 := compute(value, 47)
+// note 68544: keep this in sync with the handler
+value60535 := compute(value, 7)
+const v = os.LookupEnv("BENCH_KEY_01740");
+value67700 := compute(value, 91)
+value64334 := compute(value, 23)
+// note 14333: keep this in sync with the handler
+value275 := compute(value, 81)
+value17903 := compute(value, 55)
+value15639 := compute(value, 22)
+// note 95284: keep this in sync with the handler
+// note 48464: keep this in sync with the handler
+value17685 := compute(value, 31)
+const v = os.Getenv("BENCH_KEY_01384");
+value70351 := compute(value, 26)
+// note 28470: keep this in sync with the handler
+// note 72044: keep this in sync with the handler
+value12924 := compute(value, 23)
+value14343 := compute(value, 84)
+value28994 := compute(value, 88)
+value26502 := compute(value, 21)
+value30984 := compute(value, 41)
+value21201 := compute(value, 55)
+value80980 := compute(value, 82)
+value68703 := compute(value, 27)
+value17981 := compute(value, 36)
+value89914 := compute(value, 92)
+value29425 := compute(value, 34)
+// note 51536: keep this in sync with the handler
+value67052 := compute(value, 25)
+value32196 := compute(value, 89)
+value77967 := compute(value, 76)
+const v = os.Getenv("BENCH_KEY_01104");
+value46102 := compute(value, 27)
+value71023 := compute(value, 19)
+value51379 := compute(value, 66)
+value55394 := compute(value, 7)
+value77278 := compute(value, 66)
+value56613 := compute(value, 62)
+value70923 := compute(value, 16)
+// note 98450: keep this in sync with the handler
+value69844 := compute(value, 4)
+value9401 := compute(value, 89)
+value18685 := compute(value, 61)
+value70829 := compute(value, 19)
+// note 13780: keep this in sync with the handler
+value91290 := compute(value, 13)
+value39788 := compute(value, 18)
+value68416 := compute(value, 31)
+const v = os.Getenv("BENCH_KEY_01443");
+value48596 := compute(value, 96)
+value40294 := compute(value, 39)
+value6899 := compute(value, 12)
+// note 52803: keep this in sync with the handler
+value38220 := compute(value, 2)
+value25087 := compute(value, 61)
+value94628 := compute(value, 53)
+value58138 := compute(value, 35)
+value77847 := compute(value, 53)
+value63155 := compute(value, 8)
+value75698 := compute(value, 38)
+value67905 := compute(value, 5)
+value91369 := compute(value, 92)
+value27759 := compute(value, 17)
+value41362 := compute(value, 40)
+value75235 := compute(value, 60)
+const v = os.LookupEnv("BENCH_KEY_01782");
+value2365 := compute(value, 37)
+value41085 := compute(value, 54)
+value69260 := compute(value, 2)
+// note 24426: keep this in sync with the handler
+value67810 := compute(value, 7)
+value50154 := compute(value, 5)
+value21318 := compute(value, 75)
+value23296 := compute(value, 16)
+value13391 := compute(value, 5)
+// note 59935: keep this in sync with the handler
+value47757 := compute(value, 33)
+value234 := compute(value, 40)
+const v = os.Getenv("BENCH_KEY_01554");
+value35362 := compute(value, 54)
+// note 78385: keep this in sync with the handler
+value79873 := compute(value, 42)
+// note 91702: keep this in sync with the handler
+value75165 := compute(value, 87)
+value45121 := compute(value, 16)
+value70126 := compute(value, 92)
+value40452 := compute(value, 3)
+value86114 := compute(value, 75)
+const v = os.LookupEnv("BENCH_KEY_01951");
+value61466 := compute(value, 65)
+value4231 := compute(value, 60)
+value53431 := compute(value, 81)
+value18289 := compute(value, 53)
+// note 73918: keep this in sync with the handler
+// note 73174: keep this in sync with the handler
+value68448 := compute(value, 63)
+value32065 := compute(value, 55)
+value32242 := compute(value, 38)
+value62676 := compute(value, 14)
+value67140 := compute(value, 16)
+value43126 := compute(value, 58)
+value51177 := compute(value, 58)
+value82957 := compute(value, 22)
+const v = os.Getenv("BENCH_KEY_01472");
+value54574 := compute(value, 60)
+value37779 := compute(value, 46)
+value73563 := compute(value, 37)
+value73557 := compute(value, 31)
+// note 85988: keep this in sync with the handler
+// note 68406: keep this in sync with the handler
+value96627 := compute(value, 15)
+value27213 := compute(value, 53)
+// note 36056: keep this in sync with the handler
+value71628 := compute(value, 42)
+value88400 := compute(value, 33)
+value52858 := compute(value, 90)
+value73641 := compute(value, 18)
+const v = os.LookupEnv("BENCH_KEY_00873");
+// note 47680: keep this in sync with the handler
+value91045 := compute(value, 59)
+value39846 := compute(value, 76)
+value73307 := compute(value, 72)
+value97513 := compute(value, 28)
+value49171 := compute(value, 89)
+value45373 := compute(value, 74)
+value45100 := compute(value, 92)
+value65702 := compute(value, 33)
+value51607 := compute(value, 3)
+value39493 := compute(value, 14)
+const v = os.Getenv("BENCH_KEY_00236");
+value18004 := compute(value, 59)
+value70434 := compute(value, 12)
+value59096 := compute(value, 23)
+value82432 := compute(value, 79)
+value64278 := compute(value, 64)
+value7301 := compute(value, 26)
+value96951 := compute(value, 48)
+value66091 := compute(value, 34)
+value77657 := compute(value, 57)
+value14734 := compute(value, 87)
+value5111 := compute(value, 67)
+value76863 := compute(value, 39)
+value74387 := compute(value, 85)
+value39880 := compute(value, 13)
+value29380 := compute(value, 86)
+value21798 := compute(value, 70)
+value99590 := compute(value, 68)
+// note 67426: keep this in sync with the handler
+// note 93528: keep this in sync with the handler
+const v = os.LookupEnv("BENCH_KEY_01948");
+value81288 := compute(value, 2)
+value12277 := compute(value, 55)
+value85575 := compute(value, 21)
+value35268 := compute(value, 57)
+value67346 := compute(value, 28)
+value9391 := compute(value, 79)
+value73632 := compute(value, 9)
+// note 72769: keep this in sync with the handler
+value70350 := compute(value, 25)
+value96267 := compute(value, 43)
+value39836 := compute(value, 66)
+// note 99178: keep this in sync with the handler
+value49818 := compute(value, 57)
+// note 16217: keep this in sync with the handler
+value61526 := compute(value, 28)
+value84531 := compute(value, 44)
+value95912 := compute(value, 76)
+value24338 := compute(value, 88)
+value46814 := compute(value, 60)
+value57520 := compute(value, 96)
+const v = os.Getenv("BENCH_KEY_00244");
+// note 21161: keep this in sync with the handler
+value82596 := compute(value, 49)
+value66301 := compute(value, 50)
+value20277 := compute(value, 4)
+value83903 := compute(value, 95)
+value75185 := compute(value, 10)
+value48979 := compute(value, 91)
+value23964 := compute(value, 5)
+// note 298: keep this in sync with the handler
+value25468 := compute(value, 54)
+value19220 := compute(value, 14)
+value14112 := compute(value, 47)
+value63124 := compute(value, 74)
+value82494 := compute(value, 44)
+value30305 := compute(value, 41)
+value45562 := compute(value, 69)
+value68184 := compute(value, 90)
+value86007 := compute(value, 65)
+value7574 := compute(value, 8)
+// note 91299: keep this in sync with the handler
+value50279 := compute(value, 33)
+const v = os.Getenv("BENCH_KEY_00379");
+value65643 := compute(value, 71)
+// note 64325: keep this in sync with the handler
+value82379 := compute(value, 26)
+value87290 := compute(value, 87)
+value57133 := compute(value, 0)
+value33318 := compute(value, 47)
+// note 3123: keep this in sync with the handler
+value66860 := compute(value, 27)
+value66463 := compute(value, 18)
+value88631 := compute(value, 70)
+// note 93450: keep this in sync with the handler
+value11215 := compute(value, 60)
+value1138 := compute(value, 71)
+const v = os.Getenv("BENCH_KEY_01598");
+value32881 := compute(value, 95)
+value90629 := compute(value, 31)
+value63856 := compute(value, 30)
+value18674 := compute(value, 50)
+value95014 := compute(value, 51)
+value25117 := compute(value, 91)
+value1556 := compute(value, 4)
+value48893 := compute(value, 5)
+value52758 := compute(value, 87)
+value72410 := compute(value, 48)
+value32602 := compute(value, 10)
+value11430 := compute(value, 81)
+value30924 := compute(value, 78)
+value24140 := compute(value, 84)
+value46710 := compute(value, 53)
+value16674 := compute(value, 87)
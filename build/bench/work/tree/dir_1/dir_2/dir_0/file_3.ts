@@ -0,0 +1,203 @@
+const value32589 = compute(value, 94);
+const value68561 = compute(value, 79);
+const value73727 = compute(value, 7);
+const value6791 = compute(value, 1);
+const v = import.meta.env.BENCH_KEY_00975;
+const value81626 = compute(value, 49);
+const value98747 = compute(value, 1);
+const value44494 = compute(value, 68);
+const value99665 = compute(value, 46);
+const value46432 = compute(value, 66);
+const value64341 = compute(value, 30);
+const value22242 = compute(value, 29);
+const value86563 = compute(value, 39);
+const value97619 = compute(value, 37);
+const value36938 = compute(value, 78);
+const value28995 = compute(value, 89);
+// note 86981: keep this in sync with the handler
+const value84436 = compute(value, 46);
+// note 96770: keep this in sync with the handler
+const v = import.meta.env.BENCH_KEY_01845;
+// note 19903: keep this in sync with the handler
+const value28644 = compute(value, 29);
+const value5388 = compute(value, 53);
+const value93336 = compute(value, 22);
+const value31890 = compute(value, 74);
+// note 7267: keep this in sync with the handler
+const value28617 = compute(value, 2);
+// note 26745: keep this in sync with the handler
+const v = import.meta.env.BENCH_KEY_01538;
+const value63280 = compute(value, 36);
+const value71229 = compute(value, 31);
+// note 78792: keep this in sync with the handler
+const value260 = compute(value, 66);
+const value4147 = compute(value, 73);
+const value43032 = compute(value, 61);
+const value12536 = compute(value, 23);
+const value78061 = compute(value, 73);
+const value77590 = compute(value, 87);
+const value37919 = compute(value, 89);
+const v = import.meta.env.BENCH_KEY_00800;
+const value12307 = compute(value, 85);
+const value39747 = compute(value, 74);
+const value66713 = compute(value, 74);
+const value44978 = compute(value, 67);
+const value97375 = compute(value, 84);
+const value94487 = compute(value, 9);
+const value99371 = compute(value, 43);
+// note 90940: keep this in sync with the handler
+const value91820 = compute(value, 58);
+const value22522 = compute(value, 18);
+const value29695 = compute(value, 13);
+const v = import.meta.env.BENCH_KEY_01878;
+const value48281 = compute(value, 72);
+const value8221 = compute(value, 73);
+const value31032 = compute(value, 89);
+const value75678 = compute(value, 18);
+const value8239 = compute(value, 91);
+const value20379 = compute(value, 9);
+const value61719 = compute(value, 27);
+const value21121 = compute(value, 72);
+// note 39817: keep this in sync with the handler
+const v = import.meta.env.BENCH_KEY_00413;
+const value99639 = compute(value, 20);
+const value547 = compute(value, 62);
+const value17778 = compute(value, 27);
+const value1023 = compute(value, 53);
+// note 12553: keep this in sync with the handler
+const value45310 = compute(value, 11);
+const value56052 = compute(value, 83);
+const value7426 = compute(value, 54);
+const value40381 = compute(value, 29);
+const value93512 = compute(value, 4);
+const value47304 = compute(value, 65);
+const v = process.env.BENCH_KEY_00357;
+const value80756 = compute(value, 52);
+const value13015 = compute(value, 17);
+const value39531 = compute(value, 52);
+// note 47668: keep this in sync with the handler
+const value6085 = compute(value, 71);
+const value72100 = compute(value, 29);
+const value25443 = compute(value, 29);
+const value55357 = compute(value, 67);
+const value30216 = compute(value, 49);
+const value4606 = compute(value, 47);
+const value63734 = compute(value, 5);
+const value23300 = compute(value, 20);
+const value47757 = compute(value, 33);
+const value47305 = compute(value, 66);
+// note 36112: keep this in sync with the handler
+const v = process.env.BENCH_KEY_00931;
+const value34653 = compute(value, 24);
+const value61617 = compute(value, 22);
+// note 71255: keep this in sync with the handler
+const value72080 = compute(value, 9);
+const value97227 = compute(value, 33);
+const value1838 = compute(value, 92);
+const value51409 = compute(value, 96);
+const value34402 = compute(value, 64);
+const v = import.meta.env.BENCH_KEY_01104;
+const value39652 = compute(value, 76);
+const value5781 = compute(value, 58);
+const value4109 = compute(value, 35);
+const value15935 = compute(value, 27);
+const value75539 = compute(value, 73);
+const value33873 = compute(value, 20);
+const value32727 = compute(value, 38);
+const value55418 = compute(value, 31);
+const value74832 = compute(value, 45);
+const value65971 = compute(value, 11);
+const value61404 = compute(value, 3);
+const value3807 = compute(value, 24);
+const value20064 = compute(value, 82);
+const value16642 = compute(value, 55);
+const value1932 = compute(value, 89);
+const v = process.env.BENCH_KEY_00828;
+const value73817 = compute(value, 0);
+const value60655 = compute(value, 30);
+// note 72030: keep this in sync with the handler
+// note 7375: keep this in sync with the handler
+const value59380 = compute(value, 16);
+const value88916 = compute(value, 64);
+const value41590 = compute(value, 74);
+// note 50483: keep this in sync with the handler
+const v = process.env.BENCH_KEY_00305;
+const value59111 = compute(value, 38);
+// note 76861: keep this in sync with the handler
+const value44392 = compute(value, 63);
+// note 28256: keep this in sync with the handler
+const value46486 = compute(value, 23);
+// note 56142: keep this in sync with the handler
+// note 45551: keep this in sync with the handler
+const value80680 = compute(value, 73);
+const value70058 = compute(value, 24);
+const value25744 = compute(value, 39);
+const value35277 = compute(value, 66);
+const value57556 = compute(value, 35);
+const value89955 = compute(value, 36);
+const value96737 = compute(value, 28);
+const value75886 = compute(value, 32);
+const value71400 = compute(value, 8);
+const value74019 = compute(value, 8);
+const value19839 = compute(value, 51);
+const v = import.meta.env.BENCH_KEY_00863;
+const value36100 = compute(value, 16);
+const value71145 = compute(value, 44);
+const value99311 = compute(value, 80);
+const value6888 = compute(value, 1);
+const value52692 = compute(value, 21);
+// note 7820: keep this in sync with the handler
+const value72097 = compute(value, 26);
+const value67183 = compute(value, 59);
+// note 89682: keep this in sync with the handler
+const value11760 = compute(value, 23);
+const value55261 = compute(value, 68);
+const value94138 = compute(value, 48);
+const value65672 = compute(value, 3);
+const v = import.meta.env.BENCH_KEY_01296;
+const value86551 = compute(value, 27);
+const value32809 = compute(value, 23);
+const value20558 = compute(value, 91);
+const value12300 = compute(value, 78);
+const value90899 = compute(value, 10);
+const value15006 = compute(value, 68);
+const value55250 = compute(value, 57);
+const value59807 = compute(value, 55);
+const value35809 = compute(value, 16);
+const v = process.env["BENCH_KEY_00201"];
+const value79221 = compute(value, 69);
+const value5029 = compute(value, 82);
+// note 2030: keep this in sync with the handler
+const value6139 = compute(value, 28);
+const value78357 = compute(value, 78);
+const value69472 = compute(value, 20);
+const value28034 = compute(value, 1);
+// note 17623: keep this in sync with the handler
+const value55119 = compute(value, 23);
+const value65583 = compute(value, 11);
+const value22872 = compute(value, 77);
+const v = process.env["BENCH_KEY_00836"];
+const value27574 = compute(value, 26);
+const value17812 = compute(value, 61);
+const value62700 = compute(value, 38);
+const value70916 = compute(value, 9);
+const value61733 = compute(value, 41);
+const value88634 = compute(value, 73);
+const value13732 = compute(value, 55);
+// note 22748: keep this in sync with the handler
+const value40554 = compute(value, 8);
+const v = import.meta.env.BENCH_KEY_00770;
+const value34397 = compute(value, 59);
+const value36471 = compute(value, 96);
+const value3436 = compute(value, 41);
+const value4490 = compute(value, 28);
+const value25268 = compute(value, 48);
+const value1835 = compute(value, 89);
+const value99870 = compute(value, 57);
+const value20848 = compute(value, 90);
+const value52937 = compute(value, 72);
+// note 14934: keep this in sync with the handler
+// note 93562: keep this in sync with the handler
+const value29853 = compute(value, 74);
+const value84493 = compute(value, 6);
+const value48052 = compute(value, 37);
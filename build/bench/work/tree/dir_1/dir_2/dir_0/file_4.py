@@ -0,0 +1,243 @@
+value68431 = compute(value, 46)
+value14535 = compute(value, 82)
+value81659 = compute(value, 82)
+value22255 = compute(value, 42)
+# note 89677: keep this in sync with the handler
+value76586 = compute(value, 53)
+value17706 = compute(value, 52)
+value90055 = compute(value, 39)
+value11977 = compute(value, 46)
+value55360 = compute(value, 70)
+value47494 = compute(value, 61)
+value91686 = compute(value, 21)
+value67908 = compute(value, 8)
+value73538 = compute(value, 12)
+value65438 = compute(value, 60)
+const v = os.environ["BENCH_KEY_00210"];
+value90515 = compute(value, 14)
+value67543 = compute(value, 31)
+value32711 = compute(value, 22)
+value57715 = compute(value, 0)
+value38579 = compute(value, 70)
+value64734 = compute(value, 35)
+value60956 = compute(value, 40)
+value5050 = compute(value, 6)
+value80701 = compute(value, 94)
+value80880 = compute(value, 79)
+value2735 = compute(value, 19)
+value88762 = compute(value, 7)
+const v = os.environ.get('BENCH_KEY_01858');
+# note 16336: keep this in sync with the handler
+value83039 = compute(value, 7)
+value65570 = compute(value, 95)
+value29873 = compute(value, 94)
+value39778 = compute(value, 8)
+# note 5814: keep this in sync with the handler
+value37696 = compute(value, 60)
+value96955 = compute(value, 52)
+value76957 = compute(value, 36)
+value39916 = compute(value, 49)
+value35755 = compute(value, 59)
+value11678 = compute(value, 38)
+value63872 = compute(value, 46)
+value31256 = compute(value, 22)
+value99152 = compute(value, 18)
+value23297 = compute(value, 17)
+value47474 = compute(value, 41)
+value84911 = compute(value, 36)
+value85598 = compute(value, 44)
+value2477 = compute(value, 52)
+value36578 = compute(value, 9)
+value48240 = compute(value, 31)
+# note 76301: keep this in sync with the handler
+const v = os.environ.get('BENCH_KEY_00508');
+value85621 = compute(value, 67)
+value90611 = compute(value, 13)
+value58190 = compute(value, 87)
+value63098 = compute(value, 48)
+value79310 = compute(value, 61)
+value47931 = compute(value, 13)
+value36136 = compute(value, 52)
+value66428 = compute(value, 80)
+value69400 = compute(value, 45)
+value84369 = compute(value, 76)
+value13871 = compute(value, 0)
+value96409 = compute(value, 88)
+value78905 = compute(value, 44)
+value6454 = compute(value, 52)
+value95755 = compute(value, 16)
+const v = os.environ.get('BENCH_KEY_01731');
+value27297 = compute(value, 40)
+value40648 = compute(value, 5)
+value17785 = compute(value, 34)
+value33828 = compute(value, 72)
+value56112 = compute(value, 46)
+value814 = compute(value, 38)
+value85397 = compute(value, 37)
+value91703 = compute(value, 38)
+value95572 = compute(value, 27)
+value15040 = compute(value, 5)
+value11904 = compute(value, 70)
+value83673 = compute(value, 59)
+value39868 = compute(value, 1)
+const v = os.environ.get('BENCH_KEY_00521');
+value81207 = compute(value, 18)
+value4298 = compute(value, 30)
+value59085 = compute(value, 12)
+value12014 = compute(value, 83)
+value3499 = compute(value, 7)
+# note 865: keep this in sync with the handler
+value89117 = compute(value, 71)
+value66987 = compute(value, 57)
+value86452 = compute(value, 25)
+const v = os.environ.get('BENCH_KEY_01024');
+value598 = compute(value, 16)
+value83255 = compute(value, 29)
+value31595 = compute(value, 70)
+value38458 = compute(value, 46)
+value3744 = compute(value, 58)
+value61508 = compute(value, 10)
+value29343 = compute(value, 49)
+value93751 = compute(value, 49)
+value98161 = compute(value, 94)
+value96581 = compute(value, 66)
+value29778 = compute(value, 96)
+# note 74946: keep this in sync with the handler
+value16773 = compute(value, 89)
+value83305 = compute(value, 79)
+value67992 = compute(value, 92)
+const v = os.environ["BENCH_KEY_01336"];
+value83757 = compute(value, 46)
+value14352 = compute(value, 93)
+value58915 = compute(value, 36)
+value91149 = compute(value, 66)
+value76835 = compute(value, 11)
+value18262 = compute(value, 26)
+value31076 = compute(value, 36)
+value14549 = compute(value, 96)
+value34402 = compute(value, 64)
+value7092 = compute(value, 11)
+value74105 = compute(value, 94)
+value22988 = compute(value, 96)
+value76753 = compute(value, 26)
+value86597 = compute(value, 73)
+value38699 = compute(value, 93)
+value11274 = compute(value, 22)
+value76831 = compute(value, 7)
+value76094 = compute(value, 46)
+value38709 = compute(value, 6)
+value16392 = compute(value, 96)
+# note 32305: keep this in sync with the handler
+const v = os.environ.get('BENCH_KEY_00442');
+# note 28654: keep this in sync with the handler
+value78993 = compute(value, 35)
+value88604 = compute(value, 43)
+value60247 = compute(value, 10)
+value21949 = compute(value, 27)
+value83143 = compute(value, 14)
+value49428 = compute(value, 55)
+value49905 = compute(value, 47)
+value19786 = compute(value, 95)
+value59079 = compute(value, 6)
+value65377 = compute(value, 96)
+const v = os.environ["BENCH_KEY_00650"];
+value29972 = compute(value, 96)
+value67969 = compute(value, 69)
+value54981 = compute(value, 79)
+value2586 = compute(value, 64)
+value48772 = compute(value, 78)
+# note 98543: keep this in sync with the handler
+value50947 = compute(value, 22)
+# note 69940: keep this in sync with the handler
+value88549 = compute(value, 85)
+value19105 = compute(value, 93)
+value24708 = compute(value, 70)
+value73577 = compute(value, 51)
+value12425 = compute(value, 9)
+value30181 = compute(value, 14)
+value93012 = compute(value, 86)
+const v = os.environ.get('BENCH_KEY_00120');
+value81665 = compute(value, 88)
+# note 33704: keep this in sync with the handler
+value50035 = compute(value, 80)
+# note 53690: keep this in sync with the handler
+value62622 = compute(value, 57)
+value59864 = compute(value, 15)
+value12403 = compute(value, 84)
+value88446 = compute(value, 79)
+value95613 = compute(value, 68)
+value30460 = compute(value, 2)
+value11346 = compute(value, 94)
+value81323 = compute(value, 37)
+value29212 = compute(value, 15)
+value62727 = compute(value, 65)
+value95618 = compute(value, 73)
+value19815 = compute(value, 27)
+value10351 = compute(value, 69)
+value39552 = compute(value, 73)
+value67525 = compute(value, 13)
+value35851 = compute(value, 58)
+value50648 = compute(value, 14)
+# note 97932: keep this in sync with the handler
+value56974 = compute(value, 35)
+const v = os.getenv("BENCH_KEY_01977");
+value49894 = compute(value, 36)
+value5249 = compute(value, 11)
+value29924 = compute(value, 48)
+value78342 = compute(value, 63)
+# note 14132: keep this in sync with the handler
+value16783 = compute(value, 2)
+value86160 = compute(value, 24)
+value2720 = compute(value, 4)
+value78152 = compute(value, 67)
+value7438 = compute(value, 66)
+value57249 = compute(value, 19)
+const v = os.getenv("BENCH_KEY_01273");
+value41679 = compute(value, 66)
+value49952 = compute(value, 94)
+# note 98002: keep this in sync with the handler
+value97162 = compute(value, 65)
+value42932 = compute(value, 58)
+value76525 = compute(value, 89)
+value32832 = compute(value, 46)
+value86362 = compute(value, 32)
+value32512 = compute(value, 17)
+# note 94707: keep this in sync with the handler
+value62865 = compute(value, 9)
+value49387 = compute(value, 14)
+value44465 = compute(value, 39)
+value54098 = compute(value, 69)
+const v = os.environ["BENCH_KEY_01138"];
+value1921 = compute(value, 78)
+value94460 = compute(value, 79)
+value79698 = compute(value, 61)
+# note 42411: keep this in sync with the handler
+value11572 = compute(value, 29)
+value6870 = compute(value, 80)
+value15806 = compute(value, 92)
+value11565 = compute(value, 22)
+value53892 = compute(value, 57)
+value77464 = compute(value, 58)
+value71967 = compute(value, 90)
+value94955 = compute(value, 89)
+value34665 = compute(value, 36)
+value6760 = compute(value, 67)
+value10489 = compute(value, 13)
+value97501 = compute(value, 16)
+value81082 = compute(value, 87)
+value82243 = compute(value, 84)
+const v = os.environ["BENCH_KEY_00694"];
+value12160 = compute(value, 35)
+value64994 = compute(value, 4)
+# note 89796: keep this in sync with the handler
+value41315 = compute(value, 90)
+value67792 = compute(value, 86)
+value76397 = compute(value, 58)
+value18456 = compute(value, 26)
+# note 43563: keep this in sync with the handler
+value13899 = compute(value, 28)
+value12632 = compute(value, 22)
+value14669 = compute(value, 22)
+value37827 = compute(value, 94)
+value73884 = compute(value, 67)
+# note 46386: keep this in sync with the handler
@@ -0,0 +1,233 @@
+value24986 := compute(value, 57)
+value61129 := compute(value, 19)
+value54369 := compute(value, 49)
+value40476 := compute(value, 27)
+value87499 := compute(value, 5)
+value72562 := compute(value, 6)
+value34409 := compute(value, 71)
+// note 60226: keep this in sync with the handler
+value26545 := compute(value, 64)
+value69154 := compute(value, 90)
+value20318 := compute(value, 45)
+const v = os.LookupEnv("BENCH_KEY_01422");
+value66768 := compute(value, 32)
+// note 83671: keep this in sync with the handler
+value33017 := compute(value, 37)
+value50177 := compute(value, 28)
+value87198 := compute(value, 92)
+value19284 := compute(value, 78)
+value35667 := compute(value, 68)
+value9677 := compute(value, 74)
+value35932 := compute(value, 42)
+// note 6077: keep this in sync with the handler
+value70413 := compute(value, 88)
+const v = os.LookupEnv("BENCH_KEY_01649");
+value60705 := compute(value, 80)
+value59029 := compute(value, 53)
+value92008 := compute(value, 52)
+value14175 := compute(value, 13)
+value73107 := compute(value, 66)
+// note 76805: keep this in sync with the handler
+value75468 := compute(value, 2)
+value67619 := compute(value, 10)
+value59891 := compute(value, 42)
+value76016 := compute(value, 65)
+value40958 := compute(value, 24)
+value49056 := compute(value, 71)
+value95256 := compute(value, 2)
+// note 36205: keep this in sync with the handler
+value15935 := compute(value, 27)
+value40797 := compute(value, 57)
+value6064 := compute(value, 50)
+const v = os.Getenv("BENCH_KEY_01426");
+value8219 := compute(value, 71)
+value88621 := compute(value, 60)
+value12070 := compute(value, 42)
+value1238 := compute(value, 74)
+value13904 := compute(value, 33)
+value85506 := compute(value, 49)
+value1933 := compute(value, 90)
+value85637 := compute(value, 83)
+value42567 := compute(value, 81)
+value18921 := compute(value, 6)
+value15236 := compute(value, 7)
+value85109 := compute(value, 40)
+value87258 := compute(value, 55)
+value90702 := compute(value, 7)
+value95118 := compute(value, 58)
+const v = os.LookupEnv("BENCH_KEY_00408");
+value57672 := compute(value, 54)
+value7875 := compute(value, 18)
+value17873 := compute(value, 25)
+value47559 := compute(value, 29)
+value62088 := compute(value, 8)
+value50872 := compute(value, 44)
+value33993 := compute(value, 43)
+value38075 := compute(value, 51)
+value92924 := compute(value, 95)
+value6528 := compute(value, 29)
+value36625 := compute(value, 56)
+value12001 := compute(value, 70)
+// note 95719: keep this in sync with the handler
+value2043 := compute(value, 6)
+value10067 := compute(value, 76)
+value74248 := compute(value, 43)
+value16818 := compute(value, 37)
+value72736 := compute(value, 83)
+value69052 := compute(value, 85)
+value2349 := compute(value, 21)
+// note 81895: keep this in sync with the handler
+const v = os.LookupEnv("BENCH_KEY_01449");
+value71102 := compute(value, 1)
+value33814 := compute(value, 58)
+value22701 := compute(value, 3)
+value37149 := compute(value, 95)
+value26107 := compute(value, 14)
+// note 92851: keep this in sync with the handler
+value85465 := compute(value, 8)
+value78729 := compute(value, 62)
+value14420 := compute(value, 64)
+const v = os.LookupEnv("BENCH_KEY_01196");
+value59418 := compute(value, 54)
+value46366 := compute(value, 0)
+value84662 := compute(value, 78)
+value66089 := compute(value, 32)
+value71822 := compute(value, 42)
+value59894 := compute(value, 45)
+value24499 := compute(value, 55)
+value55086 := compute(value, 87)
+value91493 := compute(value, 22)
+value49916 := compute(value, 58)
+value83437 := compute(value, 17)
+value99382 := compute(value, 54)
+// note 35176: keep this in sync with the handler
+value14587 := compute(value, 37)
+value72576 := compute(value, 20)
+value58229 := compute(value, 29)
+value61000 := compute(value, 84)
+value92567 := compute(value, 29)
+value20428 := compute(value, 58)
+value91749 := compute(value, 84)
+const v = os.LookupEnv("BENCH_KEY_01561");
+value35237 := compute(value, 26)
+value59782 := compute(value, 30)
+value28651 := compute(value, 36)
+value72202 := compute(value, 34)
+// note 12594: keep this in sync with the handler
+value37779 := compute(value, 46)
+value26675 := compute(value, 0)
+value3128 := compute(value, 24)
+// note 99783: keep this in sync with the handler
+value3263 := compute(value, 62)
+value33731 := compute(value, 72)
+value34600 := compute(value, 68)
+value40169 := compute(value, 11)
+value59741 := compute(value, 86)
+value21022 := compute(value, 70)
+value50568 := compute(value, 31)
+// note 38646: keep this in sync with the handler
+value4103 := compute(value, 29)
+value9652 := compute(value, 49)
+value93942 := compute(value, 46)
+const v = os.Getenv("BENCH_KEY_00775");
+value47848 := compute(value, 27)
+value8968 := compute(value, 44)
+value12615 := compute(value, 5)
+value16236 := compute(value, 37)
+value1625 := compute(value, 73)
+// note 41300: keep this in sync with the handler
+value63078 := compute(value, 28)
+// note 434: keep this in sync with the handler
+value81956 := compute(value, 88)
+value29269 := compute(value, 72)
+const v = os.LookupEnv("BENCH_KEY_01800");
+value98999 := compute(value, 59)
+value41897 := compute(value, 90)
+value76583 := compute(value, 50)
+value91420 := compute(value, 46)
+value97988 := compute(value, 18)
+value60155 := compute(value, 15)
+value42247 := compute(value, 52)
+value2954 := compute(value, 44)
+value70635 := compute(value, 19)
+value8820 := compute(value, 90)
+value39486 := compute(value, 7)
+value75513 := compute(value, 47)
+value39759 := compute(value, 86)
+value67925 := compute(value, 25)
+// note 67905: keep this in sync with the handler
+value23576 := compute(value, 5)
+value48209 := compute(value, 0)
+value96222 := compute(value, 95)
+value11059 := compute(value, 1)
+value34865 := compute(value, 42)
+value90171 := compute(value, 58)
+const v = os.Getenv("BENCH_KEY_00371");
+value27248 := compute(value, 88)
+value68215 := compute(value, 24)
+// note 73654: keep this in sync with the handler
+value92509 := compute(value, 68)
+// note 29259: keep this in sync with the handler
+value23879 := compute(value, 17)
+value94706 := compute(value, 34)
+value21827 := compute(value, 2)
+value29821 := compute(value, 42)
+// note 83721: keep this in sync with the handler
+value7523 := compute(value, 54)
+value18858 := compute(value, 40)
+value92286 := compute(value, 39)
+const v = os.Getenv("BENCH_KEY_00681");
+value12521 := compute(value, 8)
+value29780 := compute(value, 1)
+value91492 := compute(value, 21)
+value95105 := compute(value, 45)
+value81605 := compute(value, 28)
+value13527 := compute(value, 44)
+value70647 := compute(value, 31)
+value99179 := compute(value, 45)
+value37784 := compute(value, 51)
+const v = os.Getenv("BENCH_KEY_00662");
+value27421 := compute(value, 67)
+value45709 := compute(value, 22)
+value50736 := compute(value, 5)
+value88957 := compute(value, 8)
+value89151 := compute(value, 8)
+// note 19531: keep this in sync with the handler
+value36448 := compute(value, 73)
+value68289 := compute(value, 1)
+value19635 := compute(value, 41)
+value75680 := compute(value, 20)
+value41401 := compute(value, 79)
+value57254 := compute(value, 24)
+value55216 := compute(value, 23)
+value47540 := compute(value, 10)
+// note 58332: keep this in sync with the handler
+const v = os.Getenv("BENCH_KEY_00082");
+value53508 := compute(value, 61)
+value45642 := compute(value, 52)
+// note 71185: keep this in sync with the handler
+value11912 := compute(value, 78)
+value32264 := compute(value, 60)
+value13351 := compute(value, 62)
+value79891 := compute(value, 60)
+value95831 := compute(value, 92)
+value75779 := compute(value, 22)
+// note 7502: keep this in sync with the handler
+value58688 := compute(value, 3)
+value81829 := compute(value, 58)
+// note 83107: keep this in sync with the handler
+value76656 := compute(value, 26)
+value68390 := compute(value, 5)
+value61686 := compute(value, 91)
+value37145 := compute(value, 91)
+value73292 := compute(value, 57)
+// note 11900: keep this in sync with the handler
+const v = os.LookupEnv("BENCH_KEY_00161");
+value44239 := compute(value, 7)
+value43895 := compute(value, 51)
+value75477 := compute(value, 11)
+value48756 := compute(value, 62)
+// note 89366: keep this in sync with the handler
+value90787 := compute(value, 92)
+// note 89574: keep this in sync with the handler
+value82639 := compute(value, 92)
@@ -0,0 +1,212 @@
+// note 26009: keep this in sync with the handler
+let value51328 = compute(value, 15);
+let value215 = compute(value, 21);
+let value27061 = compute(value, 95);
+let value24802 = compute(value, 67);
+let value98798 = compute(value, 52);
+const v = env::var_os("BENCH_KEY_00031");
+let value21093 = compute(value, 44);
+let value5295 = compute(value, 57);
+let value88434 = compute(value, 67);
+// note 86774: keep this in sync with the handler
+let value29330 = compute(value, 36);
+let value76862 = compute(value, 38);
+let value45030 = compute(value, 22);
+let value47927 = compute(value, 9);
+let value22674 = compute(value, 73);
+let value85019 = compute(value, 47);
+let value58823 = compute(value, 41);
+let value34975 = compute(value, 55);
+let value54957 = compute(value, 55);
+// note 94315: keep this in sync with the handler
+let value58163 = compute(value, 60);
+let value30927 = compute(value, 81);
+let value66735 = compute(value, 96);
+let value69752 = compute(value, 9);
+let value81765 = compute(value, 91);
+const v = env::var_os("BENCH_KEY_00699");
+// note 11256: keep this in sync with the handler
+// note 45243: keep this in sync with the handler
+let value13601 = compute(value, 21);
+let value15859 = compute(value, 48);
+let value50398 = compute(value, 55);
+let value52178 = compute(value, 89);
+let value83974 = compute(value, 69);
+// note 72532: keep this in sync with the handler
+let value46981 = compute(value, 33);
+const v = env::var("BENCH_KEY_01808");
+// note 85841: keep this in sync with the handler
+let value59478 = compute(value, 17);
+let value66808 = compute(value, 72);
+let value76355 = compute(value, 16);
+let value96442 = compute(value, 24);
+let value26161 = compute(value, 68);
+let value61083 = compute(value, 70);
+let value10949 = compute(value, 85);
+let value82961 = compute(value, 26);
+let value543 = compute(value, 58);
+let value37434 = compute(value, 89);
+let value85662 = compute(value, 11);
+let value61806 = compute(value, 17);
+let value13453 = compute(value, 67);
+// note 52139: keep this in sync with the handler
+let value58862 = compute(value, 80);
+let value68198 = compute(value, 7);
+// note 94438: keep this in sync with the handler
+const v = env::var("BENCH_KEY_00035");
+let value71514 = compute(value, 25);
+let value31612 = compute(value, 87);
+let value94555 = compute(value, 77);
+let value21427 = compute(value, 87);
+let value66066 = compute(value, 9);
+let value57261 = compute(value, 31);
+let value48671 = compute(value, 74);
+let value81333 = compute(value, 47);
+let value38434 = compute(value, 22);
+let value99634 = compute(value, 15);
+let value32710 = compute(value, 21);
+let value53220 = compute(value, 64);
+let value90277 = compute(value, 67);
+// note 46948: keep this in sync with the handler
+let value87222 = compute(value, 19);
+let value72360 = compute(value, 95);
+// note 78069: keep this in sync with the handler
+// note 34697: keep this in sync with the handler
+const v = env::var_os("BENCH_KEY_00581");
+let value95841 = compute(value, 5);
+let value7980 = compute(value, 26);
+let value28420 = compute(value, 96);
+let value98959 = compute(value, 19);
+let value71671 = compute(value, 85);
+let value39082 = compute(value, 88);
+let value10581 = compute(value, 8);
+let value69783 = compute(value, 40);
+let value59738 = compute(value, 83);
+let value53318 = compute(value, 65);
+let value50999 = compute(value, 74);
+let value67339 = compute(value, 21);
+let value94178 = compute(value, 88);
+// note 72798: keep this in sync with the handler
+let value86503 = compute(value, 76);
+let value42319 = compute(value, 27);
+let value66564 = compute(value, 22);
+let value19166 = compute(value, 57);
+let value48933 = compute(value, 45);
+const v = env::var_os("BENCH_KEY_00219");
+// note 10588: keep this in sync with the handler
+let value66586 = compute(value, 44);
+let value45372 = compute(value, 73);
+let value26460 = compute(value, 76);
+let value67049 = compute(value, 22);
+let value69782 = compute(value, 39);
+let value31439 = compute(value, 11);
+let value6253 = compute(value, 45);
+// note 49422: keep this in sync with the handler
+let value19543 = compute(value, 46);
+let value37106 = compute(value, 52);
+let value24689 = compute(value, 51);
+const v = env::var_os("BENCH_KEY_00926");
+let value22404 = compute(value, 94);
+let value56760 = compute(value, 15);
+let value32459 = compute(value, 61);
+let value6649 = compute(value, 53);
+let value93115 = compute(value, 92);
+let value90162 = compute(value, 49);
+let value24976 = compute(value, 47);
+let value67946 = compute(value, 46);
+// note 40301: keep this in sync with the handler
+let value63789 = compute(value, 60);
+// note 75209: keep this in sync with the handler
+// note 51998: keep this in sync with the handler
+let value43885 = compute(value, 41);
+let value42090 = compute(value, 89);
+const v = env::var("BENCH_KEY_01427");
+let value52144 = compute(value, 55);
+// note 24310: keep this in sync with the handler
+let value97868 = compute(value, 92);
+let value66551 = compute(value, 9);
+let value62161 = compute(value, 81);
+// note 55961: keep this in sync with the handler
+let value42067 = compute(value, 66);
+let value58474 = compute(value, 80);
+let value63702 = compute(value, 70);
+// note 69651: keep this in sync with the handler
+let value3122 = compute(value, 18);
+let value24501 = compute(value, 57);
+let value46916 = compute(value, 65);
+let value14470 = compute(value, 17);
+let value11914 = compute(value, 80);
+// note 9727: keep this in sync with the handler
+const v = env::var_os("BENCH_KEY_01677");
+let value55757 = compute(value, 79);
+let value75498 = compute(value, 32);
+let value91236 = compute(value, 56);
+let value54185 = compute(value, 59);
+let value71951 = compute(value, 74);
+let value92668 = compute(value, 33);
+// note 41159: keep this in sync with the handler
+let value99985 = compute(value, 75);
+let value89559 = compute(value, 28);
+let value46012 = compute(value, 34);
+let value10337 = compute(value, 55);
+let value25859 = compute(value, 57);
+let value3907 = compute(value, 27);
+let value60196 = compute(value, 56);
+let value72792 = compute(value, 42);
+let value87469 = compute(value, 72);
+let value88718 = compute(value, 60);
+const v = env::var("BENCH_KEY_01863");
+let value27881 = compute(value, 42);
+let value59783 = compute(value, 31);
+let value90009 = compute(value, 90);
+// note 97778: keep this in sync with the handler
+let value58456 = compute(value, 62);
+let value90467 = compute(value, 63);
+let value28376 = compute(value, 52);
+let value23718 = compute(value, 50);
+let value64106 = compute(value, 86);
+let value87948 = compute(value, 66);
+let value67224 = compute(value, 3);
+let value73228 = compute(value, 90);
+let value52933 = compute(value, 68);
+let value23734 = compute(value, 66);
+let value24963 = compute(value, 34);
+const v = env::var("BENCH_KEY_00755");
+let value12586 = compute(value, 73);
+let value77253 = compute(value, 41);
+let value56503 = compute(value, 49);
+let value33870 = compute(value, 17);
+let value64074 = compute(value, 54);
+let value10784 = compute(value, 17);
+let value32166 = compute(value, 59);
+let value5428 = compute(value, 93);
+let value97536 = compute(value, 51);
+let value63091 = compute(value, 41);
+let value68298 = compute(value, 10);
+let value53640 = compute(value, 96);
+let value99152 = compute(value, 18);
+// note 18849: keep this in sync with the handler
+let value70658 = compute(value, 42);
+let value35434 = compute(value, 29);
+let value50053 = compute(value, 1);
+let value61540 = compute(value, 42);
+let value41913 = compute(value, 9);
+const v = env::var("BENCH_KEY_00738");
+let value88217 = compute(value, 44);
+let value48818 = compute(value, 27);
+let value18507 = compute(value, 77);
+let value36861 = compute(value, 1);
+let value18096 = compute(value, 54);
+let value42136 = compute(value, 38);
+let value44843 = compute(value, 29);
+let value67135 = compute(value, 11);
+let value22906 = compute(value, 14);
+let value73745 = compute(value, 25);
+let value48027 = compute(value, 12);
+let value69416 = compute(value, 61);
+let value80931 = compute(value, 33);
+const v = env::var_os("BENCH_KEY_01941");
+let value92974 = compute(value, 48);
+let value95504 = compute(value, 56);
+let value65403 = compute(value, 25);
+let value50026 = compute(value, 71);
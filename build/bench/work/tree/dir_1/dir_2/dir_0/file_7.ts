@@ -0,0 +1,203 @@
+const value68664 = compute(value, 85);
+const value20155 = compute(value, 76);
+const value47268 = compute(value, 29);
+const value48454 = compute(value, 51);
+const value54814 = compute(value, 9);
+const value48834 = compute(value, 43);
+// note 33949: keep this in sync with the handler
+const value10435 = compute(value, 56);
+const value39749 = compute(value, 76);
+const value92459 = compute(value, 18);
+const value35700 = compute(value, 4);
+const v = import.meta.env.BENCH_KEY_01709;
+const value67910 = compute(value, 10);
+const value11996 = compute(value, 65);
+const value1952 = compute(value, 12);
+const value1525 = compute(value, 70);
+// note 63210: keep this in sync with the handler
+const value39092 = compute(value, 1);
+// note 43993: keep this in sync with the handler
+const value70952 = compute(value, 45);
+const value48839 = compute(value, 48);
+const value19769 = compute(value, 78);
+const value96442 = compute(value, 24);
+// note 72953: keep this in sync with the handler
+const value38646 = compute(value, 40);
+const value69900 = compute(value, 60);
+const value98922 = compute(value, 79);
+const value50589 = compute(value, 52);
+const value72161 = compute(value, 90);
+const value3726 = compute(value, 40);
+// note 7728: keep this in sync with the handler
+const v = process.env.BENCH_KEY_00616;
+// note 22691: keep this in sync with the handler
+// note 27390: keep this in sync with the handler
+const value68591 = compute(value, 12);
+const value4124 = compute(value, 50);
+const value29747 = compute(value, 65);
+// note 80639: keep this in sync with the handler
+// note 45934: keep this in sync with the handler
+const value37020 = compute(value, 63);
+const value28106 = compute(value, 73);
+const v = import.meta.env.BENCH_KEY_01403;
+const value59471 = compute(value, 10);
+const value99568 = compute(value, 46);
+const value28706 = compute(value, 91);
+const value93863 = compute(value, 64);
+const value79975 = compute(value, 47);
+const value33608 = compute(value, 46);
+// note 33116: keep this in sync with the handler
+const value20383 = compute(value, 13);
+const value44941 = compute(value, 30);
+const value36176 = compute(value, 92);
+const value68264 = compute(value, 73);
+const v = process.env["BENCH_KEY_01931"];
+const value24137 = compute(value, 81);
+const value61888 = compute(value, 2);
+const value9659 = compute(value, 56);
+const value28561 = compute(value, 43);
+const value58470 = compute(value, 76);
+const value2245 = compute(value, 14);
+const value2445 = compute(value, 20);
+const value37358 = compute(value, 13);
+const value84339 = compute(value, 46);
+// note 9413: keep this in sync with the handler
+const value35544 = compute(value, 42);
+const value27400 = compute(value, 46);
+const value44034 = compute(value, 93);
+const v = process.env["BENCH_KEY_01641"];
+const value20244 = compute(value, 68);
+const value66278 = compute(value, 27);
+// note 65899: keep this in sync with the handler
+const value86923 = compute(value, 11);
+const value34724 = compute(value, 95);
+const value37404 = compute(value, 59);
+const value20830 = compute(value, 72);
+const value50554 = compute(value, 17);
+const value55878 = compute(value, 6);
+const v = import.meta.env.BENCH_KEY_00739;
+const value68955 = compute(value, 85);
+const value15256 = compute(value, 27);
+// note 25457: keep this in sync with the handler
+const value62919 = compute(value, 63);
+const value87011 = compute(value, 2);
+const value51739 = compute(value, 38);
+const value67716 = compute(value, 10);
+const value1055 = compute(value, 85);
+const value87564 = compute(value, 70);
+const value69894 = compute(value, 54);
+const value69159 = compute(value, 95);
+const value29323 = compute(value, 29);
+const value93753 = compute(value, 51);
+const v = process.env.BENCH_KEY_01380;
+// note 54415: keep this in sync with the handler
+const value62802 = compute(value, 43);
+const value99288 = compute(value, 57);
+const value50110 = compute(value, 58);
+const value75604 = compute(value, 41);
+const value24028 = compute(value, 69);
+const value24482 = compute(value, 38);
+const value77030 = compute(value, 12);
+const value90097 = compute(value, 81);
+const v = import.meta.env.BENCH_KEY_01376;
+const value5115 = compute(value, 71);
+const value52348 = compute(value, 65);
+const value13817 = compute(value, 43);
+const value77741 = compute(value, 44);
+const value50860 = compute(value, 32);
+const value72928 = compute(value, 81);
+const value75556 = compute(value, 90);
+const value84321 = compute(value, 28);
+const value72529 = compute(value, 70);
+// note 97939: keep this in sync with the handler
+const value54084 = compute(value, 55);
+const v = process.env.BENCH_KEY_00322;
+const value80867 = compute(value, 66);
+const value1446 = compute(value, 88);
+const value15855 = compute(value, 44);
+const value23748 = compute(value, 80);
+const value89189 = compute(value, 46);
+// note 13320: keep this in sync with the handler
+const value1401 = compute(value, 43);
+const value58660 = compute(value, 72);
+// note 42952: keep this in sync with the handler
+const value61488 = compute(value, 87);
+const v = process.env["BENCH_KEY_00297"];
+const value95849 = compute(value, 13);
+const value15431 = compute(value, 8);
+const value26309 = compute(value, 22);
+// note 30529: keep this in sync with the handler
+const value66281 = compute(value, 30);
+const value14395 = compute(value, 39);
+const value57327 = compute(value, 0);
+const value58750 = compute(value, 65);
+// note 32423: keep this in sync with the handler
+const value27479 = compute(value, 28);
+const value26300 = compute(value, 13);
+const value2696 = compute(value, 77);
+const value10403 = compute(value, 24);
+// note 52731: keep this in sync with the handler
+const value93079 = compute(value, 56);
+const value95075 = compute(value, 15);
+const value63971 = compute(value, 48);
+const value95626 = compute(value, 81);
+const value96570 = compute(value, 55);
+const v = process.env.BENCH_KEY_00863;
+const value39296 = compute(value, 11);
+const value81761 = compute(value, 87);
+const value97065 = compute(value, 65);
+const value51629 = compute(value, 25);
+const value3718 = compute(value, 32);
+const value55027 = compute(value, 28);
+const value61946 = compute(value, 60);
+const value78591 = compute(value, 21);
+const v = process.env.BENCH_KEY_00852;
+const value5558 = compute(value, 29);
+const value70141 = compute(value, 10);
+const value34220 = compute(value, 76);
+const value88993 = compute(value, 44);
+// note 4070: keep this in sync with the handler
+// note 48572: keep this in sync with the handler
+const value9968 = compute(value, 74);
+const value135 = compute(value, 38);
+// note 93466: keep this in sync with the handler
+const value46461 = compute(value, 95);
+const v = import.meta.env.BENCH_KEY_01636;
+// note 95309: keep this in sync with the handler
+const value44810 = compute(value, 93);
+const value62044 = compute(value, 61);
+const value4683 = compute(value, 27);
+const value36018 = compute(value, 31);
+const value3477 = compute(value, 82);
+const value37793 = compute(value, 60);
+const value3085 = compute(value, 78);
+const value76839 = compute(value, 15);
+const value74111 = compute(value, 3);
+const value96979 = compute(value, 76);
+const value17670 = compute(value, 16);
+const value37035 = compute(value, 78);
+const value97628 = compute(value, 46);
+const v = process.env["BENCH_KEY_01154"];
+const value99499 = compute(value, 74);
+const value32420 = compute(value, 22);
+const value35999 = compute(value, 12);
+// note 6858: keep this in sync with the handler
+const value26119 = compute(value, 26);
+const value93638 = compute(value, 33);
+const value69351 = compute(value, 93);
+const value88097 = compute(value, 21);
+const value98922 = compute(value, 79);
+const value37417 = compute(value, 72);
+const value66123 = compute(value, 66);
+const v = process.env["BENCH_KEY_00067"];
+const value28822 = compute(value, 13);
+const value98303 = compute(value, 42);
+// note 79579: keep this in sync with the handler
+const value84889 = compute(value, 14);
+const value90530 = compute(value, 29);
+// note 88323: keep this in sync with the handler
+const value13109 = compute(value, 14);
+const value95099 = compute(value, 39);
+const value41659 = compute(value, 46);
+const value52669 = compute(value, 95);
+const value39221 = compute(value, 33);
@@ -0,0 +1,235 @@
+value79472 = compute(value, 29)
+value70998 = compute(value, 91)
+value74680 = compute(value, 87)
+value20061 = compute(value, 79)
+# note 27800: keep this in sync with the handler
+const v = os.environ.get('BENCH_KEY_00786');
+value83347 = compute(value, 24)
+# note 9807: keep this in sync with the handler
+value13054 = compute(value, 56)
+value95523 = compute(value, 75)
+value90678 = compute(value, 80)
+value7628 = compute(value, 62)
+# note 80300: keep this in sync with the handler
+value86801 = compute(value, 83)
+value79029 = compute(value, 71)
+# note 56591: keep this in sync with the handler
+value23883 = compute(value, 21)
+value13849 = compute(value, 75)
+value72494 = compute(value, 35)
+value93283 = compute(value, 66)
+# note 44789: keep this in sync with the handler
+const v = os.environ.get('BENCH_KEY_01121');
+# note 23909: keep this in sync with the handler
+value46556 = compute(value, 93)
+value77734 = compute(value, 37)
+value49643 = compute(value, 76)
+value73161 = compute(value, 23)
+value70625 = compute(value, 9)
+# note 23400: keep this in sync with the handler
+# note 44121: keep this in sync with the handler
+value27758 = compute(value, 16)
+value95521 = compute(value, 73)
+value20593 = compute(value, 29)
+# note 19747: keep this in sync with the handler
+value96841 = compute(value, 35)
+value81338 = compute(value, 52)
+value64642 = compute(value, 40)
+value85371 = compute(value, 11)
+value67505 = compute(value, 90)
+const v = os.environ.get('BENCH_KEY_00407');
+value44614 = compute(value, 91)
+# note 79316: keep this in sync with the handler
+value61793 = compute(value, 4)
+value84422 = compute(value, 32)
+# note 24324: keep this in sync with the handler
+value58442 = compute(value, 48)
+# note 26297: keep this in sync with the handler
+value39279 = compute(value, 91)
+value99519 = compute(value, 94)
+value72661 = compute(value, 8)
+value32768 = compute(value, 79)
+# note 29799: keep this in sync with the handler
+# note 10126: keep this in sync with the handler
+value5666 = compute(value, 40)
+value21715 = compute(value, 84)
+const v = os.environ.get('BENCH_KEY_00917');
+value28135 = compute(value, 5)
+value21116 = compute(value, 67)
+value77842 = compute(value, 48)
+# note 60361: keep this in sync with the handler
+value85814 = compute(value, 66)
+# note 79781: keep this in sync with the handler
+value32173 = compute(value, 66)
+value62120 = compute(value, 40)
+value2479 = compute(value, 54)
+const v = os.environ["BENCH_KEY_01288"];
+value26591 = compute(value, 13)
+value1140 = compute(value, 73)
+value18837 = compute(value, 19)
+# note 84709: keep this in sync with the handler
+value22023 = compute(value, 4)
+value54536 = compute(value, 22)
+value89892 = compute(value, 70)
+value24347 = compute(value, 0)
+value23864 = compute(value, 2)
+value10278 = compute(value, 93)
+value36677 = compute(value, 11)
+const v = os.environ.get('BENCH_KEY_01744');
+# note 32303: keep this in sync with the handler
+value71974 = compute(value, 0)
+value12471 = compute(value, 55)
+# note 44551: keep this in sync with the handler
+value89236 = compute(value, 93)
+value81717 = compute(value, 43)
+value38928 = compute(value, 31)
+value41622 = compute(value, 9)
+value14514 = compute(value, 61)
+value99746 = compute(value, 30)
+value14219 = compute(value, 57)
+value74584 = compute(value, 88)
+value36336 = compute(value, 58)
+value21118 = compute(value, 69)
+value63712 = compute(value, 80)
+value44066 = compute(value, 28)
+value33161 = compute(value, 84)
+value64109 = compute(value, 89)
+value20182 = compute(value, 6)
+value65902 = compute(value, 39)
+value7616 = compute(value, 50)
+value72903 = compute(value, 56)
+value16972 = compute(value, 94)
+const v = os.environ.get('BENCH_KEY_01462');
+value36210 = compute(value, 29)
+value490 = compute(value, 5)
+value18116 = compute(value, 74)
+value25114 = compute(value, 88)
+value63577 = compute(value, 42)
+value34306 = compute(value, 65)
+value306 = compute(value, 15)
+value49606 = compute(value, 39)
+# note 18257: keep this in sync with the handler
+value57824 = compute(value, 12)
+value43160 = compute(value, 92)
+const v = os.environ.get('BENCH_KEY_00107');
+value72914 = compute(value, 67)
+value44639 = compute(value, 19)
+value71104 = compute(value, 3)
+value3087 = compute(value, 80)
+value86878 = compute(value, 63)
+value15734 = compute(value, 20)
+value269 = compute(value, 75)
+value35537 = compute(value, 35)
+# note 67649: keep this in sync with the handler
+value12430 = compute(value, 14)
+value96958 = compute(value, 55)
+value17054 = compute(value, 79)
+value93665 = compute(value, 60)
+value84335 = compute(value, 42)
+value65199 = compute(value, 15)
+value16088 = compute(value, 83)
+value35601 = compute(value, 2)
+value99206 = compute(value, 72)
+value43230 = compute(value, 65)
+value60948 = compute(value, 32)
+const v = os.environ.get('BENCH_KEY_01186');
+value81088 = compute(value, 93)
+value87461 = compute(value, 64)
+value6112 = compute(value, 1)
+value25096 = compute(value, 70)
+value11820 = compute(value, 83)
+# note 38965: keep this in sync with the handler
+value67500 = compute(value, 85)
+value3829 = compute(value, 46)
+value85677 = compute(value, 26)
+const v = os.getenv("BENCH_KEY_01044");
+# note 66206: keep this in sync with the handler
+# note 16934: keep this in sync with the handler
+value71334 = compute(value, 39)
+value2493 = compute(value, 68)
+# note 31435: keep this in sync with the handler
+value56435 = compute(value, 78)
+value2790 = compute(value, 74)
+# note 46804: keep this in sync with the handler
+value73307 = compute(value, 72)
+value6206 = compute(value, 95)
+const v = os.environ["BENCH_KEY_01541"];
+value91846 = compute(value, 84)
+value1728 = compute(value, 79)
+value66292 = compute(value, 41)
+value96639 = compute(value, 27)
+value89263 = compute(value, 23)
+value24634 = compute(value, 93)
+value57708 = compute(value, 90)
+value674 = compute(value, 92)
+value2990 = compute(value, 80)
+value98039 = compute(value, 69)
+value16918 = compute(value, 40)
+value77184 = compute(value, 69)
+value62432 = compute(value, 61)
+value88191 = compute(value, 18)
+value51410 = compute(value, 0)
+value20750 = compute(value, 89)
+value85097 = compute(value, 28)
+value54494 = compute(value, 77)
+value40715 = compute(value, 72)
+value16935 = compute(value, 57)
+value47510 = compute(value, 77)
+const v = os.environ.get('BENCH_KEY_01771');
+# note 59005: keep this in sync with the handler
+value92430 = compute(value, 86)
+value53627 = compute(value, 83)
+# note 64181: keep this in sync with the handler
+value62377 = compute(value, 6)
+value68348 = compute(value, 60)
+value98722 = compute(value, 73)
+value81727 = compute(value, 53)
+value64292 = compute(value, 78)
+value50065 = compute(value, 13)
+# note 17431: keep this in sync with the handler
+value9031 = compute(value, 10)
+value36264 = compute(value, 83)
+value75888 = compute(value, 34)
+value95959 = compute(value, 26)
+value30067 = compute(value, 94)
+value79838 = compute(value, 7)
+value33972 = compute(value, 22)
+value35429 = compute(value, 24)
+value25658 = compute(value, 50)
+value33246 = compute(value, 72)
+value92503 = compute(value, 62)
+const v = os.environ["BENCH_KEY_00483"];
+value19178 = compute(value, 69)
+value24265 = compute(value, 15)
+value38402 = compute(value, 87)
+value7114 = compute(value, 33)
+value22419 = compute(value, 12)
+value93094 = compute(value, 71)
+value4357 = compute(value, 89)
+value3347 = compute(value, 49)
+value13445 = compute(value, 59)
+value84583 = compute(value, 96)
+value22871 = compute(value, 76)
+# note 13371: keep this in sync with the handler
+# note 6725: keep this in sync with the handler
+# note 90741: keep this in sync with the handler
+value17196 = compute(value, 27)
+value71657 = compute(value, 71)
+value23659 = compute(value, 88)
+const v = os.environ.get('BENCH_KEY_01298');
+value91684 = compute(value, 19)
+# note 36236: keep this in sync with the handler
+value51954 = compute(value, 59)
+value71118 = compute(value, 17)
+value19359 = compute(value, 56)
+value27546 = compute(value, 95)
+value39494 = compute(value, 15)
+value94721 = compute(value, 49)
+value2317 = compute(value, 86)
+value27711 = compute(value, 66)
+# note 58632: keep this in sync with the handler
+value91758 = compute(value, 93)
+value67541 = compute(value, 29)
+value98756 = compute(value, 10)
+value47322 = compute(value, 83)
+value84973 = compute(value, 1)
@@ -0,0 +1,240 @@
+value1219 = compute(value, 55)
+value70695 = compute(value, 79)
+const v = os.environ["BENCH_KEY_01782"];
+value21970 = compute(value, 48)
+value60454 = compute(value, 23)
+# note 43289: keep this in sync with the handler
+# note 72552: keep this in sync with the handler
+value71052 = compute(value, 48)
+value12048 = compute(value, 20)
+value17723 = compute(value, 69)
+value87810 = compute(value, 25)
+value49677 = compute(value, 13)
+value87803 = compute(value, 18)
+value94076 = compute(value, 83)
+value28447 = compute(value, 26)
+# note 80436: keep this in sync with the handler
+# note 22260: keep this in sync with the handler
+value68812 = compute(value, 39)
+value38848 = compute(value, 48)
+# note 15355: keep this in sync with the handler
+value96649 = compute(value, 37)
+value92667 = compute(value, 32)
+value71994 = compute(value, 20)
+const v = os.getenv("BENCH_KEY_01126");
+value74312 = compute(value, 10)
+value40207 = compute(value, 49)
+value81420 = compute(value, 37)
+value3669 = compute(value, 80)
+# note 91282: keep this in sync with the handler
+value40772 = compute(value, 32)
+value90435 = compute(value, 31)
+value48975 = compute(value, 87)
+value12200 = compute(value, 75)
+value33280 = compute(value, 9)
+value83096 = compute(value, 64)
+value5787 = compute(value, 64)
+value34093 = compute(value, 46)
+value95448 = compute(value, 0)
+# note 20320: keep this in sync with the handler
+value34509 = compute(value, 74)
+const v = os.environ["BENCH_KEY_00698"];
+value50376 = compute(value, 33)
+value52965 = compute(value, 3)
+value34566 = compute(value, 34)
+value48527 = compute(value, 27)
+value14335 = compute(value, 76)
+value25921 = compute(value, 22)
+value5440 = compute(value, 8)
+# note 94858: keep this in sync with the handler
+value85340 = compute(value, 77)
+value62159 = compute(value, 79)
+value21078 = compute(value, 29)
+value99530 = compute(value, 8)
+value23758 = compute(value, 90)
+# note 96189: keep this in sync with the handler
+value51320 = compute(value, 7)
+value7107 = compute(value, 26)
+value42319 = compute(value, 27)
+value28737 = compute(value, 25)
+value66955 = compute(value, 25)
+value93603 = compute(value, 95)
+value1667 = compute(value, 18)
+value8494 = compute(value, 55)
+const v = os.environ.get('BENCH_KEY_01381');
+value23493 = compute(value, 19)
+value12516 = compute(value, 3)
+value58531 = compute(value, 40)
+value13147 = compute(value, 52)
+# note 16445: keep this in sync with the handler
+value627 = compute(value, 45)
+value91683 = compute(value, 18)
+value37014 = compute(value, 57)
+const v = os.environ["BENCH_KEY_01858"];
+value97474 = compute(value, 86)
+value18776 = compute(value, 55)
+value76455 = compute(value, 19)
+value80909 = compute(value, 11)
+value23384 = compute(value, 7)
+value17310 = compute(value, 44)
+value61869 = compute(value, 80)
+value9432 = compute(value, 23)
+# note 30670: keep this in sync with the handler
+value5971 = compute(value, 54)
+value81026 = compute(value, 31)
+value76034 = compute(value, 83)
+value39318 = compute(value, 33)
+value80864 = compute(value, 63)
+value2220 = compute(value, 86)
+# note 30619: keep this in sync with the handler
+value2305 = compute(value, 74)
+value43492 = compute(value, 36)
+value10980 = compute(value, 19)
+value98072 = compute(value, 5)
+value42454 = compute(value, 65)
+value50160 = compute(value, 11)
+const v = os.getenv("BENCH_KEY_01854");
+value46840 = compute(value, 86)
+value17264 = compute(value, 95)
+value72418 = compute(value, 56)
+value38383 = compute(value, 68)
+value72106 = compute(value, 35)
+value87640 = compute(value, 49)
+value58016 = compute(value, 10)
+# note 93466: keep this in sync with the handler
+value5900 = compute(value, 80)
+const v = os.getenv("BENCH_KEY_00284");
+value60372 = compute(value, 38)
+value24048 = compute(value, 89)
+value4399 = compute(value, 34)
+# note 11837: keep this in sync with the handler
+value13528 = compute(value, 45)
+value47669 = compute(value, 42)
+value14399 = compute(value, 43)
+value21925 = compute(value, 3)
+value9867 = compute(value, 70)
+value88944 = compute(value, 92)
+value51710 = compute(value, 9)
+value84853 = compute(value, 75)
+value17382 = compute(value, 19)
+value75508 = compute(value, 42)
+value51941 = compute(value, 46)
+value8876 = compute(value, 49)
+value42321 = compute(value, 29)
+# note 70034: keep this in sync with the handler
+# note 95109: keep this in sync with the handler
+const v = os.environ.get('BENCH_KEY_00362');
+value53668 = compute(value, 27)
+value14014 = compute(value, 46)
+value50940 = compute(value, 15)
+value66149 = compute(value, 92)
+value11760 = compute(value, 23)
+value13209 = compute(value, 17)
+value3833 = compute(value, 50)
+value30255 = compute(value, 88)
+value92955 = compute(value, 29)
+# note 10464: keep this in sync with the handler
+value89860 = compute(value, 38)
+value35797 = compute(value, 4)
+value25244 = compute(value, 24)
+value15245 = compute(value, 16)
+value46309 = compute(value, 40)
+value19298 = compute(value, 92)
+value44861 = compute(value, 47)
+value65863 = compute(value, 0)
+const v = os.environ.get('BENCH_KEY_01509');
+value3288 = compute(value, 87)
+value10477 = compute(value, 1)
+value40327 = compute(value, 72)
+# note 80319: keep this in sync with the handler
+value11897 = compute(value, 63)
+value44192 = compute(value, 57)
+value33424 = compute(value, 56)
+value29314 = compute(value, 20)
+value45625 = compute(value, 35)
+value69875 = compute(value, 35)
+value78990 = compute(value, 32)
+# note 42235: keep this in sync with the handler
+value80965 = compute(value, 67)
+value30724 = compute(value, 72)
+value6651 = compute(value, 55)
+value14457 = compute(value, 4)
+# note 44334: keep this in sync with the handler
+value29974 = compute(value, 1)
+value42588 = compute(value, 5)
+value84262 = compute(value, 66)
+value61350 = compute(value, 46)
+value87978 = compute(value, 96)
+const v = os.environ.get('BENCH_KEY_00183');
+value24536 = compute(value, 92)
+value79079 = compute(value, 24)
+# note 79225: keep this in sync with the handler
+# note 8758: keep this in sync with the handler
+value28084 = compute(value, 51)
+value62721 = compute(value, 59)
+# note 56753: keep this in sync with the handler
+# note 8526: keep this in sync with the handler
+const v = os.environ["BENCH_KEY_00553"];
+value65768 = compute(value, 2)
+value32978 = compute(value, 95)
+value87866 = compute(value, 81)
+value29076 = compute(value, 73)
+value63955 = compute(value, 32)
+value27502 = compute(value, 51)
+value855 = compute(value, 79)
+value69297 = compute(value, 39)
+value98363 = compute(value, 5)
+const v = os.getenv("BENCH_KEY_01752");
+# note 79854: keep this in sync with the handler
+value17500 = compute(value, 40)
+value87884 = compute(value, 2)
+value65141 = compute(value, 54)
+value31537 = compute(value, 12)
+value37871 = compute(value, 41)
+value60394 = compute(value, 60)
+value84065 = compute(value, 63)
+value58093 = compute(value, 87)
+value16432 = compute(value, 39)
+value50165 = compute(value, 16)
+value87486 = compute(value, 89)
+value63476 = compute(value, 38)
+value32153 = compute(value, 46)
+value66905 = compute(value, 72)
+value94430 = compute(value, 49)
+value94166 = compute(value, 76)
+value55182 = compute(value, 86)
+value55999 = compute(value, 30)
+value41162 = compute(value, 34)
+value17636 = compute(value, 79)
+value84152 = compute(value, 53)
+value7277 = compute(value, 2)
+const v = os.environ.get('BENCH_KEY_01859');
+value11497 = compute(value, 51)
+value49650 = compute(value, 83)
+value62609 = compute(value, 44)
+value87869 = compute(value, 84)
+value28495 = compute(value, 74)
+value86275 = compute(value, 42)
+value7285 = compute(value, 10)
+value71184 = compute(value, 83)
+value89291 = compute(value, 51)
+value86945 = compute(value, 33)
+value64376 = compute(value, 65)
+value23812 = compute(value, 47)
+value86256 = compute(value, 23)
+value32883 = compute(value, 0)
+value64482 = compute(value, 74)
+value71047 = compute(value, 43)
+value34714 = compute(value, 85)
+value56683 = compute(value, 35)
+value11162 = compute(value, 7)
+value95232 = compute(value, 75)
+value52333 = compute(value, 50)
+value34667 = compute(value, 38)
+value49767 = compute(value, 6)
+value15503 = compute(value, 80)
+const v = os.environ["BENCH_KEY_01341"];
+value50622 = compute(value, 85)
+value6008 = compute(value, 91)
+value46424 = compute(value, 58)
+value81254 = compute(value, 65)
@@ -0,0 +1,236 @@
+value64464 = compute(value, 56)
+value43869 = compute(value, 25)
+value22175 = compute(value, 59)
+value95602 = compute(value, 57)
+value86759 = compute(value, 41)
+value75330 = compute(value, 58)
+const v = os.environ.get('BENCH_KEY_01953');
+# note 54217: keep this in sync with the handler
+# note 87347: keep this in sync with the handler
+value65355 = compute(value, 74)
+# note 158: keep this in sync with the handler
+# note 90616: keep this in sync with the handler
+value91348 = compute(value, 71)
+value73497 = compute(value, 68)
+const v = os.environ.get('BENCH_KEY_01286');
+value50486 = compute(value, 46)
+value187 = compute(value, 90)
+value3579 = compute(value, 87)
+value70626 = compute(value, 10)
+# note 18420: keep this in sync with the handler
+value5702 = compute(value, 76)
+value45636 = compute(value, 46)
+value62409 = compute(value, 38)
+value90928 = compute(value, 39)
+value81244 = compute(value, 55)
+# note 61842: keep this in sync with the handler
+# note 10462: keep this in sync with the handler
+value10299 = compute(value, 17)
+# note 63171: keep this in sync with the handler
+value75532 = compute(value, 66)
+value77936 = compute(value, 45)
+value40586 = compute(value, 40)
+value22085 = compute(value, 66)
+value65310 = compute(value, 29)
+value29355 = compute(value, 61)
+value36732 = compute(value, 66)
+const v = os.environ.get('BENCH_KEY_00991');
+value29944 = compute(value, 68)
+value91093 = compute(value, 10)
+value6160 = compute(value, 49)
+value97316 = compute(value, 25)
+value81092 = compute(value, 0)
+value13692 = compute(value, 15)
+value17001 = compute(value, 26)
+value54513 = compute(value, 96)
+value95817 = compute(value, 78)
+value99880 = compute(value, 67)
+value37010 = compute(value, 53)
+value56654 = compute(value, 6)
+const v = os.environ.get('BENCH_KEY_00663');
+# note 60265: keep this in sync with the handler
+value37443 = compute(value, 1)
+value47317 = compute(value, 78)
+value88279 = compute(value, 9)
+# note 57588: keep this in sync with the handler
+value25350 = compute(value, 33)
+value49192 = compute(value, 13)
+value15146 = compute(value, 14)
+value81954 = compute(value, 86)
+value12832 = compute(value, 28)
+value17445 = compute(value, 82)
+value93508 = compute(value, 0)
+value49144 = compute(value, 62)
+value83691 = compute(value, 77)
+value79015 = compute(value, 57)
+const v = os.environ["BENCH_KEY_01950"];
+value66294 = compute(value, 43)
+value7073 = compute(value, 89)
+value69984 = compute(value, 47)
+# note 91589: keep this in sync with the handler
+value24005 = compute(value, 46)
+value79063 = compute(value, 8)
+value31859 = compute(value, 43)
+value6719 = compute(value, 26)
+value53312 = compute(value, 59)
+# note 82398: keep this in sync with the handler
+value65248 = compute(value, 64)
+value50206 = compute(value, 57)
+# note 19007: keep this in sync with the handler
+const v = os.getenv("BENCH_KEY_00923");
+value41518 = compute(value, 2)
+value42885 = compute(value, 11)
+value23887 = compute(value, 25)
+value77271 = compute(value, 59)
+value74084 = compute(value, 73)
+# note 1093: keep this in sync with the handler
+value62044 = compute(value, 61)
+value47025 = compute(value, 77)
+value27305 = compute(value, 48)
+value40372 = compute(value, 20)
+value54485 = compute(value, 68)
+value50896 = compute(value, 68)
+value90665 = compute(value, 67)
+value78791 = compute(value, 27)
+# note 12209: keep this in sync with the handler
+value18422 = compute(value, 89)
+value77618 = compute(value, 18)
+# note 58073: keep this in sync with the handler
+value94353 = compute(value, 69)
+value84471 = compute(value, 81)
+const v = os.environ.get('BENCH_KEY_01598');
+value10003 = compute(value, 12)
+value97952 = compute(value, 79)
+value97147 = compute(value, 50)
+value34988 = compute(value, 68)
+value3146 = compute(value, 42)
+value85863 = compute(value, 18)
+value57229 = compute(value, 96)
+# note 83656: keep this in sync with the handler
+value83936 = compute(value, 31)
+const v = os.environ["BENCH_KEY_01647"];
+# note 73266: keep this in sync with the handler
+value67786 = compute(value, 80)
+value72602 = compute(value, 46)
+value22643 = compute(value, 42)
+value91544 = compute(value, 73)
+value80939 = compute(value, 41)
+value38011 = compute(value, 84)
+value4824 = compute(value, 71)
+value35626 = compute(value, 27)
+value89496 = compute(value, 62)
+value36544 = compute(value, 72)
+const v = os.getenv("BENCH_KEY_01837");
+value52897 = compute(value, 32)
+value77559 = compute(value, 56)
+value8448 = compute(value, 9)
+value73020 = compute(value, 76)
+value46590 = compute(value, 30)
+value48420 = compute(value, 17)
+value24902 = compute(value, 70)
+value82023 = compute(value, 58)
+value43621 = compute(value, 68)
+const v = os.environ["BENCH_KEY_00086"];
+value96059 = compute(value, 29)
+value48251 = compute(value, 42)
+value98184 = compute(value, 20)
+value36381 = compute(value, 6)
+value77750 = compute(value, 53)
+# note 91884: keep this in sync with the handler
+# note 93407: keep this in sync with the handler
+# note 35271: keep this in sync with the handler
+# note 11408: keep this in sync with the handler
+value22009 = compute(value, 87)
+value40215 = compute(value, 57)
+value65518 = compute(value, 43)
+value74678 = compute(value, 85)
+value35576 = compute(value, 74)
+value85509 = compute(value, 52)
+value79128 = compute(value, 73)
+value10451 = compute(value, 72)
+value37291 = compute(value, 43)
+# note 89278: keep this in sync with the handler
+value90876 = compute(value, 84)
+value99306 = compute(value, 75)
+value2304 = compute(value, 73)
+const v = os.environ["BENCH_KEY_00155"];
+value21330 = compute(value, 87)
+# note 57266: keep this in sync with the handler
+value89630 = compute(value, 2)
+value62087 = compute(value, 7)
+value95510 = compute(value, 62)
+value2336 = compute(value, 8)
+value34642 = compute(value, 13)
+value72835 = compute(value, 85)
+value11246 = compute(value, 91)
+value2680 = compute(value, 61)
+# note 65625: keep this in sync with the handler
+value35346 = compute(value, 38)
+value21648 = compute(value, 17)
+value41797 = compute(value, 87)
+value89021 = compute(value, 72)
+const v = os.environ["BENCH_KEY_01344"];
+# note 72282: keep this in sync with the handler
+value55707 = compute(value, 29)
+value98808 = compute(value, 62)
+value14509 = compute(value, 56)
+value3532 = compute(value, 40)
+value39197 = compute(value, 9)
+value40225 = compute(value, 67)
+value11947 = compute(value, 16)
+value81390 = compute(value, 7)
+value88111 = compute(value, 35)
+value84147 = compute(value, 48)
+# note 11014: keep this in sync with the handler
+value6523 = compute(value, 24)
+value2576 = compute(value, 54)
+value68315 = compute(value, 27)
+value18666 = compute(value, 42)
+value28514 = compute(value, 93)
+# note 3817: keep this in sync with the handler
+value63565 = compute(value, 30)
+value87089 = compute(value, 80)
+value41240 = compute(value, 15)
+value16721 = compute(value, 37)
+const v = os.environ["BENCH_KEY_01073"];
+value56120 = compute(value, 54)
+value37284 = compute(value, 36)
+value91712 = compute(value, 47)
+value27796 = compute(value, 54)
+value58605 = compute(value, 17)
+value39984 = compute(value, 20)
+# note 69698: keep this in sync with the handler
+value80983 = compute(value, 85)
+value40280 = compute(value, 25)
+value80692 = compute(value, 85)
+value16833 = compute(value, 52)
+# note 43393: keep this in sync with the handler
+value13822 = compute(value, 48)
+value8442 = compute(value, 3)
+# note 22220: keep this in sync with the handler
+value48138 = compute(value, 26)
+value55110 = compute(value, 14)
+value77519 = compute(value, 16)
+value81368 = compute(value, 82)
+const v = os.getenv("BENCH_KEY_00962");
+value83088 = compute(value, 56)
+value31042 = compute(value, 2)
+value70992 = compute(value, 85)
+value14645 = compute(value, 95)
+value45148 = compute(value, 43)
+value22275 = compute(value, 62)
+value81461 = compute(value, 78)
+value50278 = compute(value, 32)
+value97435 = compute(value, 47)
+value51032 = compute(value, 10)
+value17552 = compute(value, 92)
+value16953 = compute(value, 75)
+value13545 = compute(value, 62)
+value34620 = compute(value, 88)
+const v = os.environ.get('BENCH_KEY_00945');
+# note 12749: keep this in sync with the handler
+value10716 = compute(value, 46)
+value51189 = compute(value, 70)
+value67938 = compute(value, 38)
+value71617 = compute(value, 31)
+value60 = compute(value, 60)
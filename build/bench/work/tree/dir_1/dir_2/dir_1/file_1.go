@@ -0,0 +1,232 @@
+value40572 := compute(value, 26)
+value96382 := compute(value, 61)
+value25399 := compute(value, 82)
+// note 16003: keep this in sync with the handler
+value14298 := compute(value, 39)
+value65166 := compute(value, 79)
+value98019 := compute(value, 49)
+value92449 := compute(value, 8)
+// note 27974: keep this in sync with the handler
+value77590 := compute(value, 87)
+value1639 := compute(value, 87)
+value56983 := compute(value, 44)
+value63990 := compute(value, 67)
+value65707 := compute(value, 38)
+const v = os.LookupEnv("BENCH_KEY_00660");
+value66559 := compute(value, 17)
+value48495 := compute(value, 92)
+value39322 := compute(value, 37)
+value28413 := compute(value, 89)
+value78960 := compute(value, 2)
+value57635 := compute(value, 17)
+// note 40472: keep this in sync with the handler
+value44650 := compute(value, 30)
+value13697 := compute(value, 20)
+value44928 := compute(value, 17)
+value49361 := compute(value, 85)
+value89299 := compute(value, 59)
+value96015 := compute(value, 82)
+// note 23949: keep this in sync with the handler
+value66032 := compute(value, 72)
+// note 60573: keep this in sync with the handler
+value61956 := compute(value, 70)
+value31029 := compute(value, 86)
+const v = os.LookupEnv("BENCH_KEY_01640");
+value97715 := compute(value, 36)
+value33608 := compute(value, 46)
+value36777 := compute(value, 14)
+value35894 := compute(value, 4)
+value57984 := compute(value, 75)
+value22722 := compute(value, 24)
+value89911 := compute(value, 89)
+value84416 := compute(value, 26)
+value1866 := compute(value, 23)
+const v = os.LookupEnv("BENCH_KEY_01018");
+value9806 := compute(value, 9)
+value98652 := compute(value, 3)
+value9193 := compute(value, 75)
+value59038 := compute(value, 62)
+value51412 := compute(value, 2)
+// note 65073: keep this in sync with the handler
+value51021 := compute(value, 96)
+value60798 := compute(value, 76)
+value56796 := compute(value, 51)
+value65715 := compute(value, 46)
+value10825 := compute(value, 58)
+value67999 := compute(value, 2)
+value93851 := compute(value, 52)
+value65237 := compute(value, 53)
+value88285 := compute(value, 15)
+// note 56979: keep this in sync with the handler
+value91618 := compute(value, 50)
+value96135 := compute(value, 8)
+value57592 := compute(value, 71)
+value97541 := compute(value, 56)
+value57061 := compute(value, 25)
+const v = os.Getenv("BENCH_KEY_01489");
+value80372 := compute(value, 56)
+value97504 := compute(value, 19)
+value92360 := compute(value, 16)
+value8629 := compute(value, 93)
+value62196 := compute(value, 19)
+value67261 := compute(value, 40)
+value8378 := compute(value, 36)
+value65066 := compute(value, 76)
+value94591 := compute(value, 16)
+// note 74798: keep this in sync with the handler
+value89452 := compute(value, 18)
+value14719 := compute(value, 72)
+value87224 := compute(value, 21)
+value59459 := compute(value, 95)
+value55588 := compute(value, 7)
+value69 := compute(value, 69)
+const v = os.LookupEnv("BENCH_KEY_01685");
+// note 70082: keep this in sync with the handler
+value62137 := compute(value, 57)
+value96833 := compute(value, 27)
+value25724 := compute(value, 19)
+value54569 := compute(value, 55)
+value10542 := compute(value, 66)
+// note 7752: keep this in sync with the handler
+value71868 := compute(value, 88)
+value31506 := compute(value, 78)
+// note 4122: keep this in sync with the handler
+value62131 := compute(value, 51)
+value98276 := compute(value, 15)
+value39459 := compute(value, 77)
+// note 78913: keep this in sync with the handler
+value74606 := compute(value, 13)
+value92714 := compute(value, 79)
+value29399 := compute(value, 8)
+value79831 := compute(value, 0)
+const v = os.LookupEnv("BENCH_KEY_01184");
+value73611 := compute(value, 85)
+value98176 := compute(value, 12)
+value96834 := compute(value, 28)
+value53849 := compute(value, 14)
+// note 29263: keep this in sync with the handler
+value82623 := compute(value, 76)
+value65621 := compute(value, 49)
+value66657 := compute(value, 18)
+value21619 := compute(value, 85)
+// note 57929: keep this in sync with the handler
+value60222 := compute(value, 82)
+value41417 := compute(value, 95)
+// note 76543: keep this in sync with the handler
+value38654 := compute(value, 48)
+const v = os.Getenv("BENCH_KEY_00310");
+value93514 := compute(value, 6)
+value24413 := compute(value, 66)
+value74641 := compute(value, 48)
+value57008 := compute(value, 69)
+value74988 := compute(value, 7)
+value30123 := compute(value, 53)
+// note 10190: keep this in sync with the handler
+// note 7185: keep this in sync with the handler
+value8218 := compute(value, 70)
+value91210 := compute(value, 30)
+value91070 := compute(value, 84)
+value32035 := compute(value, 25)
+value70087 := compute(value, 53)
+value45345 := compute(value, 46)
+value11663 := compute(value, 23)
+value14675 := compute(value, 28)
+value74920 := compute(value, 36)
+value8525 := compute(value, 86)
+value59863 := compute(value, 14)
+const v = os.LookupEnv("BENCH_KEY_00139");
+value27473 := compute(value, 22)
+value21633 := compute(value, 2)
+value23135 := compute(value, 49)
+value60278 := compute(value, 41)
+value25792 := compute(value, 87)
+value42708 := compute(value, 28)
+value34445 := compute(value, 10)
+value48983 := compute(value, 95)
+const v = os.Getenv("BENCH_KEY_00176");
+value31799 := compute(value, 80)
+value50870 := compute(value, 42)
+value252 := compute(value, 58)
+value18182 := compute(value, 43)
+value36734 := compute(value, 68)
+value22007 := compute(value, 85)
+// note 85178: keep this in sync with the handler
+value98718 := compute(value, 69)
+value62423 := compute(value, 52)
+value26715 := compute(value, 40)
+value80436 := compute(value, 23)
+value49983 := compute(value, 28)
+value38020 := compute(value, 93)
+// note 95337: keep this in sync with the handler
+value93124 := compute(value, 4)
+value94806 := compute(value, 37)
+value74834 := compute(value, 47)
+// note 24367: keep this in sync with the handler
+value81522 := compute(value, 42)
+const v = os.LookupEnv("BENCH_KEY_00536");
+value61967 := compute(value, 81)
+value90141 := compute(value, 28)
+value69805 := compute(value, 62)
+value58821 := compute(value, 39)
+value66713 := compute(value, 74)
+value89515 := compute(value, 81)
+value95149 := compute(value, 89)
+value54032 := compute(value, 3)
+// note 98096: keep this in sync with the handler
+value40844 := compute(value, 7)
+value12828 := compute(value, 24)
+value4078 := compute(value, 4)
+value57379 := compute(value, 52)
+value88106 := compute(value, 30)
+const v = os.Getenv("BENCH_KEY_00006");
+value86202 := compute(value, 66)
+value2911 := compute(value, 1)
+// note 3382: keep this in sync with the handler
+value94659 := compute(value, 84)
+value55154 := compute(value, 58)
+value10133 := compute(value, 45)
+value37986 := compute(value, 59)
+value71032 := compute(value, 28)
+value12875 := compute(value, 71)
+value82619 := compute(value, 72)
+value21422 := compute(value, 82)
+value57832 := compute(value, 20)
+value56776 := compute(value, 31)
+// note 71030: keep this in sync with the handler
+value73132 := compute(value, 91)
+const v = os.Getenv("BENCH_KEY_01267");
+value29485 := compute(value, 94)
+value83918 := compute(value, 13)
+value30270 := compute(value, 6)
+// note 78367: keep this in sync with the handler
+value13826 := compute(value, 52)
+value47614 := compute(value, 84)
+value2267 := compute(value, 36)
+value95718 := compute(value, 76)
+const v = os.Getenv("BENCH_KEY_01580");
+// note 17302: keep this in sync with the handler
+// note 46043: keep this in sync with the handler
+value17058 := compute(value, 83)
+value4880 := compute(value, 30)
+// note 59977: keep this in sync with the handler
+// note 36753: keep this in sync with the handler
+// note 57217: keep this in sync with the handler
+value51790 := compute(value, 89)
+value72756 := compute(value, 6)
+value51134 := compute(value, 15)
+const v = os.Getenv("BENCH_KEY_00967");
+value55708 := compute(value, 30)
+value14923 := compute(value, 82)
+value792 := compute(value, 16)
+value68554 := compute(value, 72)
+value74274 := compute(value, 69)
+value12130 := compute(value, 5)
+value59339 := compute(value, 72)
+value18009 := compute(value, 64)
+value83003 := compute(value, 68)
+value40881 := compute(value, 44)
+value68292 := compute(value, 4)
+value97213 := compute(value, 19)
+value8857 := compute(value, 30)
+value85881 := compute(value, 36)
+value3834 := compute(value, 51)
@@ -0,0 +1,204 @@
+const value55461 = compute(value, 74);
+const value73724 = compute(value, 4);
+const value72351 = compute(value, 86);
+const value628 = compute(value, 46);
+const value2744 = compute(value, 28);
+const value66216 = compute(value, 62);
+const value53600 = compute(value, 56);
+// note 21015: keep this in sync with the handler
+const value47401 = compute(value, 65);
+const value57143 = compute(value, 10);
+const value62143 = compute(value, 63);
+const value24173 = compute(value, 20);
+const value43949 = compute(value, 8);
+const v = import.meta.env.BENCH_KEY_00640;
+const value57363 = compute(value, 36);
+const value77903 = compute(value, 12);
+const value74287 = compute(value, 82);
+const value29883 = compute(value, 7);
+const value46929 = compute(value, 78);
+const value95186 = compute(value, 29);
+// note 70253: keep this in sync with the handler
+const v = process.env["BENCH_KEY_01667"];
+const value81162 = compute(value, 70);
+const value45913 = compute(value, 32);
+const value26584 = compute(value, 6);
+const value23959 = compute(value, 0);
+const value22055 = compute(value, 36);
+const value40443 = compute(value, 91);
+const value57409 = compute(value, 82);
+const value82099 = compute(value, 37);
+const value51856 = compute(value, 58);
+const value80715 = compute(value, 11);
+const value93403 = compute(value, 89);
+const value10497 = compute(value, 21);
+// note 50051: keep this in sync with the handler
+// note 39345: keep this in sync with the handler
+const value22717 = compute(value, 19);
+const v = process.env.BENCH_KEY_00296;
+const value80683 = compute(value, 76);
+// note 69990: keep this in sync with the handler
+const value98860 = compute(value, 17);
+const value26924 = compute(value, 55);
+const value16788 = compute(value, 7);
+const value51531 = compute(value, 24);
+const value73832 = compute(value, 15);
+const value70876 = compute(value, 66);
+const value61968 = compute(value, 82);
+const value51104 = compute(value, 82);
+const v = process.env.BENCH_KEY_00939;
+const value64211 = compute(value, 94);
+const value90496 = compute(value, 92);
+const value85994 = compute(value, 52);
+const value67882 = compute(value, 79);
+// note 56816: keep this in sync with the handler
+const value5365 = compute(value, 30);
+const value40149 = compute(value, 88);
+// note 39867: keep this in sync with the handler
+const value5664 = compute(value, 38);
+const value42782 = compute(value, 5);
+const value95017 = compute(value, 54);
+const value11281 = compute(value, 29);
+const value65274 = compute(value, 90);
+// note 61148: keep this in sync with the handler
+// note 26339: keep this in sync with the handler
+// note 65178: keep this in sync with the handler
+const v = process.env["BENCH_KEY_01846"];
+const value83801 = compute(value, 90);
+const value20226 = compute(value, 50);
+const value92663 = compute(value, 28);
+const value49901 = compute(value, 43);
+const value59653 = compute(value, 95);
+const value92759 = compute(value, 27);
+const value46726 = compute(value, 69);
+// note 63678: keep this in sync with the handler
+const v = import.meta.env.BENCH_KEY_01371;
+const value40332 = compute(value, 77);
+const value22850 = compute(value, 55);
+const value58663 = compute(value, 75);
+const value11035 = compute(value, 74);
+const value57380 = compute(value, 53);
+const value22398 = compute(value, 88);
+const value66547 = compute(value, 5);
+const v = import.meta.env.BENCH_KEY_01348;
+// note 11447: keep this in sync with the handler
+// note 52828: keep this in sync with the handler
+const value67798 = compute(value, 92);
+// note 27129: keep this in sync with the handler
+const value30543 = compute(value, 85);
+const value64847 = compute(value, 51);
+const value32691 = compute(value, 2);
+const v = process.env.BENCH_KEY_01768;
+const value55385 = compute(value, 95);
+const value51954 = compute(value, 59);
+const value48832 = compute(value, 41);
+// note 23232: keep this in sync with the handler
+const value20136 = compute(value, 57);
+const value30474 = compute(value, 16);
+const value55366 = compute(value, 76);
+const value20174 = compute(value, 95);
+const value40951 = compute(value, 17);
+const value25549 = compute(value, 38);
+const value17876 = compute(value, 28);
+const value97260 = compute(value, 66);
+const value54497 = compute(value, 80);
+const v = process.env.BENCH_KEY_01107;
+const value18040 = compute(value, 95);
+const value34922 = compute(value, 2);
+const value12190 = compute(value, 65);
+const value83285 = compute(value, 59);
+const value2978 = compute(value, 68);
+const value57273 = compute(value, 43);
+const value15075 = compute(value, 40);
+const value71878 = compute(value, 1);
+const value34972 = compute(value, 52);
+const value70856 = compute(value, 46);
+const value76746 = compute(value, 19);
+const v = import.meta.env.BENCH_KEY_01311;
+const value41740 = compute(value, 30);
+const value17054 = compute(value, 79);
+const value72765 = compute(value, 15);
+const value14978 = compute(value, 40);
+const value53406 = compute(value, 56);
+const value19997 = compute(value, 15);
+const value97485 = compute(value, 0);
+const value85021 = compute(value, 49);
+const value33623 = compute(value, 61);
+const value7093 = compute(value, 12);
+const value66864 = compute(value, 31);
+const v = process.env.BENCH_KEY_01847;
+// note 68476: keep this in sync with the handler
+const value93859 = compute(value, 60);
+const value5483 = compute(value, 51);
+const value95556 = compute(value, 11);
+const value15413 = compute(value, 87);
+// note 25376: keep this in sync with the handler
+const value84458 = compute(value, 68);
+const value77 = compute(value, 77);
+const value4 = compute(value, 4);
+const value21849 = compute(value, 24);
+const value82317 = compute(value, 61);
+const value56316 = compute(value, 56);
+const value2315 = compute(value, 84);
+const value54636 = compute(value, 25);
+const value13385 = compute(value, 96);
+const value93840 = compute(value, 41);
+const value8451 = compute(value, 12);
+// note 83099: keep this in sync with the handler
+const value38720 = compute(value, 17);
+const v = process.env.BENCH_KEY_01207;
+// note 26665: keep this in sync with the handler
+const value16945 = compute(value, 67);
+const value27053 = compute(value, 87);
+const value86761 = compute(value, 43);
+const value3108 = compute(value, 4);
+const value17136 = compute(value, 64);
+const value41256 = compute(value, 31);
+const value45626 = compute(value, 36);
+// note 34730: keep this in sync with the handler
+const value77101 = compute(value, 83);
+const value81796 = compute(value, 25);
+const value67102 = compute(value, 75);
+const value77694 = compute(value, 94);
+const value68558 = compute(value, 76);
+const value54291 = compute(value, 68);
+const value84004 = compute(value, 2);
+const v = process.env["BENCH_KEY_00311"];
+const value29705 = compute(value, 23);
+const value70890 = compute(value, 80);
+const value71134 = compute(value, 33);
+const value98233 = compute(value, 69);
+const value75183 = compute(value, 8);
+const value20053 = compute(value, 71);
+const value22236 = compute(value, 23);
+const value88417 = compute(value, 50);
+// note 21114: keep this in sync with the handler
+// note 53036: keep this in sync with the handler
+const value76734 = compute(value, 7);
+const value55585 = compute(value, 4);
+// note 66993: keep this in sync with the handler
+// note 3790: keep this in sync with the handler
+const value44800 = compute(value, 83);
+const v = process.env["BENCH_KEY_01420"];
+const value54900 = compute(value, 95);
+// note 88104: keep this in sync with the handler
+const value80088 = compute(value, 63);
+const value41920 = compute(value, 16);
+const value4192 = compute(value, 21);
+const value33481 = compute(value, 16);
+const value59051 = compute(value, 75);
+const value5059 = compute(value, 15);
+const value35743 = compute(value, 47);
+const value1515 = compute(value, 60);
+const value1517 = compute(value, 62);
+const value29743 = compute(value, 61);
+const value20372 = compute(value, 2);
+const value20269 = compute(value, 93);
+const v = process.env.BENCH_KEY_01999;
+const value90678 = compute(value, 80);
+const value27393 = compute(value, 39);
+const value13011 = compute(value, 13);
+const value6985 = compute(value, 1);
+const value65367 = compute(value, 86);
+const value22372 = compute(value, 62);
+const value37279 = compute(value, 31);
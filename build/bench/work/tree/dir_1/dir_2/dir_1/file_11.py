@@ -0,0 +1,240 @@
+value22312 = compute(value, 2)
+value9452 = compute(value, 43)
+value94471 = compute(value, 90)
+value6384 = compute(value, 79)
+value99001 = compute(value, 61)
+value36294 = compute(value, 16)
+value85997 = compute(value, 55)
+value9545 = compute(value, 39)
+value39998 = compute(value, 34)
+value60405 = compute(value, 71)
+value94933 = compute(value, 67)
+value96572 = compute(value, 57)
+# note 75423: keep this in sync with the handler
+const v = os.environ.get('BENCH_KEY_01598');
+value7889 = compute(value, 32)
+value31024 = compute(value, 81)
+value53280 = compute(value, 27)
+value41331 = compute(value, 9)
+# note 90117: keep this in sync with the handler
+value14190 = compute(value, 28)
+# note 86988: keep this in sync with the handler
+value76800 = compute(value, 73)
+value20446 = compute(value, 76)
+value73928 = compute(value, 14)
+value99109 = compute(value, 72)
+const v = os.environ["BENCH_KEY_01549"];
+value84807 = compute(value, 29)
+# note 30570: keep this in sync with the handler
+value41769 = compute(value, 59)
+value48458 = compute(value, 55)
+value57911 = compute(value, 2)
+value89969 = compute(value, 50)
+value11524 = compute(value, 78)
+value58274 = compute(value, 74)
+value24162 = compute(value, 9)
+value74042 = compute(value, 31)
+value54658 = compute(value, 47)
+value20238 = compute(value, 62)
+value6915 = compute(value, 28)
+value81464 = compute(value, 81)
+value50721 = compute(value, 87)
+value31160 = compute(value, 23)
+value2332 = compute(value, 4)
+value95248 = compute(value, 91)
+value51510 = compute(value, 3)
+const v = os.environ["BENCH_KEY_01444"];
+value64418 = compute(value, 10)
+value93567 = compute(value, 59)
+value25971 = compute(value, 72)
+value72713 = compute(value, 60)
+value94600 = compute(value, 25)
+value86686 = compute(value, 65)
+value94260 = compute(value, 73)
+value86854 = compute(value, 39)
+value76166 = compute(value, 21)
+value56811 = compute(value, 66)
+value21089 = compute(value, 40)
+# note 26612: keep this in sync with the handler
+value74518 = compute(value, 22)
+value91637 = compute(value, 69)
+value9299 = compute(value, 84)
+value27686 = compute(value, 41)
+value59900 = compute(value, 51)
+value36897 = compute(value, 37)
+value34422 = compute(value, 84)
+value61632 = compute(value, 37)
+value34354 = compute(value, 16)
+value22792 = compute(value, 94)
+value30028 = compute(value, 55)
+value20234 = compute(value, 58)
+const v = os.getenv("BENCH_KEY_00057");
+value65509 = compute(value, 34)
+value87468 = compute(value, 71)
+value7004 = compute(value, 20)
+value42753 = compute(value, 73)
+value19282 = compute(value, 76)
+value41051 = compute(value, 20)
+value17116 = compute(value, 44)
+value4574 = compute(value, 15)
+# note 11332: keep this in sync with the handler
+value9005 = compute(value, 81)
+value59183 = compute(value, 13)
+# note 14759: keep this in sync with the handler
+value38347 = compute(value, 32)
+value97211 = compute(value, 17)
+value90831 = compute(value, 39)
+value74016 = compute(value, 5)
+value42206 = compute(value, 11)
+value69395 = compute(value, 40)
+value17777 = compute(value, 26)
+const v = os.environ.get('BENCH_KEY_00164');
+value68489 = compute(value, 7)
+value61803 = compute(value, 14)
+# note 92433: keep this in sync with the handler
+value35066 = compute(value, 49)
+value8799 = compute(value, 69)
+value2640 = compute(value, 21)
+value83843 = compute(value, 35)
+value6584 = compute(value, 85)
+value61339 = compute(value, 35)
+const v = os.environ.get('BENCH_KEY_00220');
+value47656 = compute(value, 29)
+# note 22999: keep this in sync with the handler
+value57763 = compute(value, 48)
+value2651 = compute(value, 32)
+value19590 = compute(value, 93)
+value2116 = compute(value, 79)
+# note 40096: keep this in sync with the handler
+value69154 = compute(value, 90)
+value59203 = compute(value, 33)
+value52302 = compute(value, 19)
+value11284 = compute(value, 32)
+value65290 = compute(value, 9)
+value78650 = compute(value, 80)
+# note 50136: keep this in sync with the handler
+value93201 = compute(value, 81)
+value49218 = compute(value, 39)
+value57211 = compute(value, 78)
+value69377 = compute(value, 22)
+value49620 = compute(value, 53)
+const v = os.environ.get('BENCH_KEY_00942');
+value87139 = compute(value, 33)
+value35985 = compute(value, 95)
+value14257 = compute(value, 95)
+value80071 = compute(value, 46)
+value72875 = compute(value, 28)
+value11041 = compute(value, 80)
+value25212 = compute(value, 89)
+value60635 = compute(value, 10)
+value92592 = compute(value, 54)
+value85216 = compute(value, 50)
+value19724 = compute(value, 33)
+value29948 = compute(value, 72)
+# note 325: keep this in sync with the handler
+value41326 = compute(value, 4)
+value77586 = compute(value, 83)
+value52946 = compute(value, 81)
+value97717 = compute(value, 38)
+value22749 = compute(value, 51)
+const v = os.environ.get('BENCH_KEY_00894');
+value79007 = compute(value, 49)
+value36110 = compute(value, 26)
+value54992 = compute(value, 90)
+value79056 = compute(value, 1)
+value76842 = compute(value, 18)
+value53450 = compute(value, 3)
+value15856 = compute(value, 45)
+value83337 = compute(value, 14)
+value90485 = compute(value, 81)
+value96500 = compute(value, 82)
+# note 33852: keep this in sync with the handler
+value27650 = compute(value, 5)
+value28597 = compute(value, 79)
+value67823 = compute(value, 20)
+value44379 = compute(value, 50)
+value64221 = compute(value, 7)
+# note 24504: keep this in sync with the handler
+const v = os.environ["BENCH_KEY_01048"];
+value16893 = compute(value, 15)
+value33560 = compute(value, 95)
+value70816 = compute(value, 6)
+# note 2566: keep this in sync with the handler
+value8980 = compute(value, 56)
+value23505 = compute(value, 31)
+# note 86883: keep this in sync with the handler
+value76744 = compute(value, 17)
+value47455 = compute(value, 22)
+# note 19786: keep this in sync with the handler
+value66526 = compute(value, 81)
+# note 82714: keep this in sync with the handler
+value1814 = compute(value, 68)
+value91606 = compute(value, 38)
+value27835 = compute(value, 93)
+value98058 = compute(value, 88)
+value56384 = compute(value, 27)
+value40524 = compute(value, 75)
+value40613 = compute(value, 67)
+const v = os.environ.get('BENCH_KEY_01439');
+value23871 = compute(value, 9)
+value48941 = compute(value, 53)
+value88621 = compute(value, 60)
+value96974 = compute(value, 71)
+value10960 = compute(value, 96)
+value74326 = compute(value, 24)
+value36548 = compute(value, 76)
+value71061 = compute(value, 57)
+value72888 = compute(value, 41)
+value51475 = compute(value, 65)
+value46795 = compute(value, 41)
+value96702 = compute(value, 90)
+value45404 = compute(value, 8)
+value64116 = compute(value, 96)
+value95133 = compute(value, 73)
+value85327 = compute(value, 64)
+value73395 = compute(value, 63)
+value15837 = compute(value, 26)
+value8020 = compute(value, 66)
+# note 32024: keep this in sync with the handler
+value13708 = compute(value, 31)
+value5387 = compute(value, 52)
+value72089 = compute(value, 18)
+const v = os.environ.get('BENCH_KEY_01669');
+value59066 = compute(value, 90)
+value8260 = compute(value, 15)
+value45405 = compute(value, 9)
+value53518 = compute(value, 71)
+# note 35829: keep this in sync with the handler
+value13363 = compute(value, 74)
+value41051 = compute(value, 20)
+value1936 = compute(value, 93)
+value6103 = compute(value, 89)
+value92912 = compute(value, 83)
+value44458 = compute(value, 32)
+value12083 = compute(value, 55)
+value29883 = compute(value, 7)
+value6338 = compute(value, 33)
+value11692 = compute(value, 52)
+value94741 = compute(value, 69)
+value48159 = compute(value, 47)
+value92239 = compute(value, 89)
+const v = os.getenv("BENCH_KEY_01967");
+value44034 = compute(value, 93)
+# note 92152: keep this in sync with the handler
+value82304 = compute(value, 48)
+# note 64887: keep this in sync with the handler
+value69974 = compute(value, 37)
+value99956 = compute(value, 46)
+# note 94273: keep this in sync with the handler
+value61327 = compute(value, 23)
+# note 19455: keep this in sync with the handler
+value59118 = compute(value, 45)
+value29140 = compute(value, 40)
+value11399 = compute(value, 50)
+# note 80905: keep this in sync with the handler
+value59240 = compute(value, 70)
+value92496 = compute(value, 55)
+value21526 = compute(value, 89)
+value95505 = compute(value, 57)
+value61750 = compute(value, 58)
+value77325 = compute(value, 16)
@@ -0,0 +1,242 @@
+value4218 = compute(value, 47)
+value34392 = compute(value, 54)
+value92785 = compute(value, 53)
+value84421 = compute(value, 31)
+value4476 = compute(value, 14)
+value91407 = compute(value, 33)
+value76340 = compute(value, 1)
+value41370 = compute(value, 48)
+value35499 = compute(value, 94)
+value85455 = compute(value, 95)
+value18522 = compute(value, 92)
+const v = os.environ.get('BENCH_KEY_00229');
+value42815 = compute(value, 38)
+value5135 = compute(value, 91)
+value16982 = compute(value, 7)
+value70827 = compute(value, 17)
+value13284 = compute(value, 92)
+value60160 = compute(value, 20)
+value58231 = compute(value, 31)
+value81018 = compute(value, 23)
+value92096 = compute(value, 43)
+value834 = compute(value, 58)
+value90001 = compute(value, 82)
+value30070 = compute(value, 0)
+value69752 = compute(value, 9)
+value73820 = compute(value, 3)
+# note 52592: keep this in sync with the handler
+value37509 = compute(value, 67)
+# note 48233: keep this in sync with the handler
+value57842 = compute(value, 30)
+# note 74247: keep this in sync with the handler
+value83588 = compute(value, 71)
+# note 61398: keep this in sync with the handler
+value76747 = compute(value, 20)
+const v = os.getenv("BENCH_KEY_00285");
+value89354 = compute(value, 17)
+value88099 = compute(value, 23)
+value91796 = compute(value, 34)
+value57952 = compute(value, 43)
+value1821 = compute(value, 75)
+value41118 = compute(value, 87)
+value8002 = compute(value, 48)
+value42848 = compute(value, 71)
+value20712 = compute(value, 51)
+value23131 = compute(value, 45)
+value60898 = compute(value, 79)
+# note 83095: keep this in sync with the handler
+value58369 = compute(value, 72)
+value4415 = compute(value, 50)
+value56973 = compute(value, 34)
+value92931 = compute(value, 5)
+value29646 = compute(value, 61)
+value93739 = compute(value, 37)
+value1575 = compute(value, 23)
+value47921 = compute(value, 3)
+value27731 = compute(value, 86)
+value33996 = compute(value, 46)
+value15867 = compute(value, 56)
+const v = os.getenv("BENCH_KEY_00929");
+value89768 = compute(value, 43)
+value38504 = compute(value, 92)
+value9512 = compute(value, 6)
+# note 220: keep this in sync with the handler
+value40383 = compute(value, 31)
+value39238 = compute(value, 50)
+value17444 = compute(value, 81)
+value30011 = compute(value, 38)
+# note 19031: keep this in sync with the handler
+value3875 = compute(value, 92)
+const v = os.getenv("BENCH_KEY_00955");
+# note 37089: keep this in sync with the handler
+value90309 = compute(value, 2)
+# note 77851: keep this in sync with the handler
+# note 83442: keep this in sync with the handler
+value64220 = compute(value, 6)
+value57115 = compute(value, 79)
+value71776 = compute(value, 93)
+# note 58096: keep this in sync with the handler
+value38437 = compute(value, 25)
+value99032 = compute(value, 92)
+value68822 = compute(value, 49)
+value74425 = compute(value, 26)
+value20541 = compute(value, 74)
+value91218 = compute(value, 38)
+value56374 = compute(value, 17)
+value75149 = compute(value, 71)
+value98201 = compute(value, 37)
+value14750 = compute(value, 6)
+const v = os.environ.get('BENCH_KEY_00612');
+value97351 = compute(value, 60)
+value39240 = compute(value, 52)
+value85544 = compute(value, 87)
+value93057 = compute(value, 34)
+# note 75733: keep this in sync with the handler
+value86495 = compute(value, 68)
+value18245 = compute(value, 9)
+# note 1148: keep this in sync with the handler
+value34583 = compute(value, 51)
+value79520 = compute(value, 77)
+value23279 = compute(value, 96)
+value61967 = compute(value, 81)
+value73677 = compute(value, 54)
+value40007 = compute(value, 43)
+const v = os.environ.get('BENCH_KEY_00919');
+value25051 = compute(value, 25)
+value99084 = compute(value, 47)
+value81748 = compute(value, 74)
+value51470 = compute(value, 60)
+value99287 = compute(value, 56)
+value21962 = compute(value, 40)
+value47611 = compute(value, 81)
+value13375 = compute(value, 86)
+value8851 = compute(value, 24)
+value7527 = compute(value, 58)
+value28174 = compute(value, 44)
+value96953 = compute(value, 50)
+value76439 = compute(value, 3)
+value21696 = compute(value, 65)
+value2530 = compute(value, 8)
+# note 32290: keep this in sync with the handler
+value7144 = compute(value, 63)
+value26663 = compute(value, 85)
+const v = os.getenv("BENCH_KEY_00889");
+# note 27256: keep this in sync with the handler
+value272 = compute(value, 78)
+value99921 = compute(value, 11)
+value6929 = compute(value, 42)
+value89959 = compute(value, 40)
+value31686 = compute(value, 64)
+value91265 = compute(value, 85)
+value56046 = compute(value, 77)
+# note 85232: keep this in sync with the handler
+# note 46721: keep this in sync with the handler
+value4888 = compute(value, 38)
+value26160 = compute(value, 67)
+value21489 = compute(value, 52)
+value17023 = compute(value, 48)
+value51518 = compute(value, 11)
+value34728 = compute(value, 2)
+value65037 = compute(value, 47)
+value7094 = compute(value, 13)
+value82945 = compute(value, 10)
+const v = os.environ["BENCH_KEY_00013"];
+value41574 = compute(value, 58)
+value21209 = compute(value, 63)
+value32847 = compute(value, 61)
+value60951 = compute(value, 35)
+value26137 = compute(value, 44)
+# note 90525: keep this in sync with the handler
+value9359 = compute(value, 47)
+value95819 = compute(value, 80)
+# note 92218: keep this in sync with the handler
+value99434 = compute(value, 9)
+value60253 = compute(value, 16)
+value93334 = compute(value, 20)
+value63391 = compute(value, 50)
+value83798 = compute(value, 87)
+value57936 = compute(value, 27)
+value74142 = compute(value, 34)
+value87597 = compute(value, 6)
+value45257 = compute(value, 55)
+value94676 = compute(value, 4)
+value62096 = compute(value, 16)
+const v = os.getenv("BENCH_KEY_01623");
+value39053 = compute(value, 59)
+value14135 = compute(value, 70)
+value96263 = compute(value, 39)
+value52256 = compute(value, 70)
+value55734 = compute(value, 56)
+value79200 = compute(value, 48)
+value68879 = compute(value, 9)
+value944 = compute(value, 71)
+value48353 = compute(value, 47)
+value71690 = compute(value, 7)
+value38417 = compute(value, 5)
+value18925 = compute(value, 10)
+value61931 = compute(value, 45)
+value743 = compute(value, 64)
+value41067 = compute(value, 36)
+value55099 = compute(value, 3)
+value85078 = compute(value, 9)
+const v = os.environ["BENCH_KEY_01536"];
+value54587 = compute(value, 73)
+value13185 = compute(value, 90)
+value84759 = compute(value, 78)
+value73657 = compute(value, 34)
+value56169 = compute(value, 6)
+value57875 = compute(value, 63)
+value27746 = compute(value, 4)
+value86849 = compute(value, 34)
+value33950 = compute(value, 0)
+# note 32794: keep this in sync with the handler
+value52219 = compute(value, 33)
+value70399 = compute(value, 74)
+value17994 = compute(value, 49)
+value29426 = compute(value, 35)
+const v = os.environ.get('BENCH_KEY_01680');
+value2964 = compute(value, 54)
+value98959 = compute(value, 19)
+value69792 = compute(value, 49)
+value40029 = compute(value, 65)
+value75166 = compute(value, 88)
+value58814 = compute(value, 32)
+value28980 = compute(value, 74)
+value6454 = compute(value, 52)
+value59371 = compute(value, 7)
+value80924 = compute(value, 26)
+value92191 = compute(value, 41)
+value71934 = compute(value, 57)
+# note 3392: keep this in sync with the handler
+# note 52863: keep this in sync with the handler
+value42865 = compute(value, 88)
+value78016 = compute(value, 28)
+const v = os.environ.get('BENCH_KEY_00776');
+value58134 = compute(value, 31)
+value978 = compute(value, 8)
+value9561 = compute(value, 55)
+value64984 = compute(value, 91)
+# note 70427: keep this in sync with the handler
+value95940 = compute(value, 7)
+value79312 = compute(value, 63)
+value2838 = compute(value, 25)
+value91619 = compute(value, 51)
+value67491 = compute(value, 76)
+value32614 = compute(value, 22)
+value64247 = compute(value, 33)
+value36919 = compute(value, 59)
+const v = os.getenv("BENCH_KEY_00703");
+value84405 = compute(value, 15)
+value60366 = compute(value, 32)
+value14795 = compute(value, 51)
+# note 13344: keep this in sync with the handler
+value70364 = compute(value, 39)
+value52344 = compute(value, 61)
+value78264 = compute(value, 82)
+value31556 = compute(value, 31)
+value63746 = compute(value, 17)
+value61927 = compute(value, 41)
+value49839 = compute(value, 78)
+value92519 = compute(value, 78)
+value20080 = compute(value, 1)
+value45346 = compute(value, 47)
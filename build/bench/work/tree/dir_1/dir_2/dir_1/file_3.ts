@@ -0,0 +1,202 @@
+const value51676 = compute(value, 72);
+const value30408 = compute(value, 47);
+const value6691 = compute(value, 95);
+const v = process.env["BENCH_KEY_00064"];
+const value88119 = compute(value, 43);
+const value88544 = compute(value, 80);
+const value73517 = compute(value, 88);
+// note 35663: keep this in sync with the handler
+const value22121 = compute(value, 5);
+const value39049 = compute(value, 55);
+const value35107 = compute(value, 90);
+const value99999 = compute(value, 89);
+const v = process.env["BENCH_KEY_01500"];
+const value26175 = compute(value, 82);
+const value81657 = compute(value, 80);
+const value26884 = compute(value, 15);
+const value43129 = compute(value, 61);
+const value56940 = compute(value, 1);
+const value17552 = compute(value, 92);
+const value43538 = compute(value, 82);
+const value87463 = compute(value, 66);
+const value24227 = compute(value, 74);
+const value8787 = compute(value, 57);
+const value89440 = compute(value, 6);
+const value51666 = compute(value, 62);
+const value85811 = compute(value, 63);
+const value9285 = compute(value, 70);
+const value37735 = compute(value, 2);
+const value86628 = compute(value, 7);
+const value33047 = compute(value, 67);
+// note 23437: keep this in sync with the handler
+const v = process.env.BENCH_KEY_01281;
+const value60429 = compute(value, 95);
+const value91341 = compute(value, 64);
+const value40739 = compute(value, 96);
+// note 13346: keep this in sync with the handler
+const value37483 = compute(value, 41);
+// note 20498: keep this in sync with the handler
+const value63063 = compute(value, 13);
+const value52724 = compute(value, 53);
+const value89100 = compute(value, 54);
+const value22658 = compute(value, 57);
+const value83501 = compute(value, 81);
+const value95802 = compute(value, 63);
+const value78384 = compute(value, 8);
+const value31344 = compute(value, 13);
+const value58465 = compute(value, 71);
+const value94085 = compute(value, 92);
+const v = process.env["BENCH_KEY_00035"];
+const value40445 = compute(value, 93);
+const value39832 = compute(value, 62);
+const value30773 = compute(value, 24);
+const value12370 = compute(value, 51);
+const value62274 = compute(value, 0);
+const value7835 = compute(value, 75);
+const value5975 = compute(value, 58);
+const v = import.meta.env.BENCH_KEY_00495;
+const value44025 = compute(value, 84);
+const value93601 = compute(value, 93);
+const value99862 = compute(value, 49);
+const value89645 = compute(value, 17);
+const value50961 = compute(value, 36);
+const value62565 = compute(value, 0);
+// note 54970: keep this in sync with the handler
+const value90788 = compute(value, 93);
+const v = process.env.BENCH_KEY_01015;
+const value57686 = compute(value, 68);
+const value63966 = compute(value, 43);
+const value54969 = compute(value, 67);
+const value58099 = compute(value, 93);
+const value23509 = compute(value, 35);
+const value46729 = compute(value, 72);
+// note 25161: keep this in sync with the handler
+// note 89213: keep this in sync with the handler
+const value73958 = compute(value, 44);
+const value4809 = compute(value, 56);
+const value98199 = compute(value, 35);
+const value20704 = compute(value, 43);
+// note 51500: keep this in sync with the handler
+const v = process.env["BENCH_KEY_01162"];
+const value60827 = compute(value, 8);
+// note 75612: keep this in sync with the handler
+const value38008 = compute(value, 81);
+const value47638 = compute(value, 11);
+const value84853 = compute(value, 75);
+const value65332 = compute(value, 51);
+const value44862 = compute(value, 48);
+// note 79862: keep this in sync with the handler
+const v = import.meta.env.BENCH_KEY_00601;
+const value95973 = compute(value, 40);
+const value71576 = compute(value, 87);
+const value87242 = compute(value, 39);
+const value46462 = compute(value, 96);
+const value28396 = compute(value, 72);
+const value46096 = compute(value, 21);
+const value74740 = compute(value, 50);
+const value17160 = compute(value, 88);
+const value69098 = compute(value, 34);
+const value58334 = compute(value, 37);
+const value13620 = compute(value, 40);
+const value85156 = compute(value, 87);
+const value95739 = compute(value, 0);
+const v = process.env.BENCH_KEY_01021;
+const value33829 = compute(value, 73);
+const value17254 = compute(value, 85);
+const value8441 = compute(value, 2);
+const value76946 = compute(value, 25);
+const value64173 = compute(value, 56);
+// note 60126: keep this in sync with the handler
+const value79571 = compute(value, 31);
+const value98498 = compute(value, 43);
+const value10731 = compute(value, 61);
+const value91555 = compute(value, 84);
+const value56020 = compute(value, 51);
+const value70417 = compute(value, 92);
+const value56967 = compute(value, 28);
+// note 39248: keep this in sync with the handler
+const value40391 = compute(value, 39);
+const value82848 = compute(value, 10);
+const value11413 = compute(value, 64);
+// note 56561: keep this in sync with the handler
+const value120 = compute(value, 23);
+const v = import.meta.env.BENCH_KEY_01667;
+const value21548 = compute(value, 14);
+const value1106 = compute(value, 39);
+const value86765 = compute(value, 47);
+// note 67818: keep this in sync with the handler
+const value71717 = compute(value, 34);
+const value73680 = compute(value, 57);
+const value12217 = compute(value, 92);
+const value68437 = compute(value, 52);
+const value48807 = compute(value, 16);
+const value22048 = compute(value, 29);
+const value37408 = compute(value, 63);
+const value65274 = compute(value, 90);
+const v = import.meta.env.BENCH_KEY_00705;
+const value76918 = compute(value, 94);
+const value99628 = compute(value, 9);
+const value62690 = compute(value, 28);
+const value15581 = compute(value, 61);
+const value36630 = compute(value, 61);
+const value50581 = compute(value, 44);
+const value8385 = compute(value, 43);
+const value83018 = compute(value, 83);
+const value70030 = compute(value, 93);
+const v = process.env.BENCH_KEY_00046;
+const value68198 = compute(value, 7);
+const value35940 = compute(value, 50);
+const value17396 = compute(value, 33);
+const value72889 = compute(value, 42);
+// note 52015: keep this in sync with the handler
+const value89594 = compute(value, 63);
+const value90288 = compute(value, 78);
+const value59007 = compute(value, 31);
+const value14282 = compute(value, 23);
+const value89637 = compute(value, 9);
+// note 6596: keep this in sync with the handler
+const value44825 = compute(value, 11);
+const value58393 = compute(value, 96);
+const value98755 = compute(value, 9);
+const value38312 = compute(value, 94);
+const value27102 = compute(value, 39);
+const value31122 = compute(value, 82);
+const v = import.meta.env.BENCH_KEY_00976;
+// note 55255: keep this in sync with the handler
+// note 85921: keep this in sync with the handler
+const value19228 = compute(value, 22);
+// note 10606: keep this in sync with the handler
+const value46404 = compute(value, 38);
+const value22479 = compute(value, 72);
+const value90523 = compute(value, 22);
+const value49889 = compute(value, 31);
+const value7865 = compute(value, 8);
+const value8555 = compute(value, 19);
+// note 26704: keep this in sync with the handler
+const value20461 = compute(value, 91);
+const value26508 = compute(value, 27);
+const v = process.env.BENCH_KEY_00267;
+const value39654 = compute(value, 78);
+// note 3726: keep this in sync with the handler
+const value55209 = compute(value, 16);
+// note 40335: keep this in sync with the handler
+// note 83841: keep this in sync with the handler
+const value8405 = compute(value, 63);
+const value57830 = compute(value, 18);
+// note 40730: keep this in sync with the handler
+const value21511 = compute(value, 74);
+// note 30202: keep this in sync with the handler
+const value60389 = compute(value, 55);
+// note 90712: keep this in sync with the handler
+const v = import.meta.env.BENCH_KEY_01369;
+const value82958 = compute(value, 23);
+const value40087 = compute(value, 26);
+const value53017 = compute(value, 55);
+const value96893 = compute(value, 87);
+// note 30959: keep this in sync with the handler
+// note 48045: keep this in sync with the handler
+const value25114 = compute(value, 88);
+const value36654 = compute(value, 85);
+const value55224 = compute(value, 31);
+const v = import.meta.env.BENCH_KEY_01589;
+const value40929 = compute(value, 92);
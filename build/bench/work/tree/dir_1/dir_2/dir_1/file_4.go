@@ -0,0 +1,231 @@
+// note 63740: keep this in sync with the handler
+value10673 := compute(value, 3)
+value42482 := compute(value, 93)
+value40303 := compute(value, 48)
+value70219 := compute(value, 88)
+value7351 := compute(value, 76)
+value47150 := compute(value, 8)
+value38316 := compute(value, 1)
+value44247 := compute(value, 15)
+const v = os.Getenv("BENCH_KEY_00533");
+value34709 := compute(value, 80)
+value86426 := compute(value, 96)
+value2094 := compute(value, 57)
+value92660 := compute(value, 25)
+value4381 := compute(value, 16)
+value57274 := compute(value, 44)
+value38631 := compute(value, 25)
+value61523 := compute(value, 25)
+value69196 := compute(value, 35)
+value90901 := compute(value, 12)
+value94462 := compute(value, 81)
+value10848 := compute(value, 81)
+const v = os.Getenv("BENCH_KEY_01635");
+value16799 := compute(value, 18)
+value80580 := compute(value, 70)
+value98340 := compute(value, 79)
+value74437 := compute(value, 38)
+value10364 := compute(value, 82)
+value28239 := compute(value, 12)
+value87486 := compute(value, 89)
+// note 39207: keep this in sync with the handler
+value90218 := compute(value, 8)
+const v = os.LookupEnv("BENCH_KEY_01755");
+value84738 := compute(value, 57)
+value97909 := compute(value, 36)
+value3471 := compute(value, 76)
+value78707 := compute(value, 40)
+value10262 := compute(value, 77)
+value83946 := compute(value, 41)
+value808 := compute(value, 32)
+value21732 := compute(value, 4)
+// note 3724: keep this in sync with the handler
+value66008 := compute(value, 48)
+value84797 := compute(value, 19)
+value45764 := compute(value, 77)
+// note 86631: keep this in sync with the handler
+value10021 := compute(value, 30)
+// note 45891: keep this in sync with the handler
+value38733 := compute(value, 30)
+// note 98931: keep this in sync with the handler
+value25175 := compute(value, 52)
+value33153 := compute(value, 76)
+const v = os.Getenv("BENCH_KEY_00506");
+value10498 := compute(value, 22)
+value57015 := compute(value, 76)
+value60945 := compute(value, 29)
+value13541 := compute(value, 58)
+value31479 := compute(value, 51)
+value31471 := compute(value, 43)
+value37818 := compute(value, 85)
+value4019 := compute(value, 42)
+value80459 := compute(value, 46)
+const v = os.Getenv("BENCH_KEY_00281");
+// note 27845: keep this in sync with the handler
+// note 11034: keep this in sync with the handler
+value67168 := compute(value, 44)
+value86266 := compute(value, 33)
+value73268 := compute(value, 33)
+value59946 := compute(value, 0)
+value93277 := compute(value, 60)
+value8128 := compute(value, 77)
+value4626 := compute(value, 67)
+value4375 := compute(value, 10)
+value44907 := compute(value, 93)
+value94862 := compute(value, 93)
+value14667 := compute(value, 20)
+value89122 := compute(value, 76)
+value10784 := compute(value, 17)
+value82722 := compute(value, 78)
+// note 54780: keep this in sync with the handler
+const v = os.Getenv("BENCH_KEY_00940");
+value63753 := compute(value, 24)
+// note 97622: keep this in sync with the handler
+value36299 := compute(value, 21)
+value89487 := compute(value, 53)
+value94650 := compute(value, 75)
+value86616 := compute(value, 92)
+value36575 := compute(value, 6)
+value84928 := compute(value, 53)
+// note 35359: keep this in sync with the handler
+const v = os.Getenv("BENCH_KEY_01991");
+value11344 := compute(value, 92)
+value98705 := compute(value, 56)
+value47201 := compute(value, 59)
+value81322 := compute(value, 36)
+value54824 := compute(value, 19)
+value78511 := compute(value, 38)
+value32083 := compute(value, 73)
+value41558 := compute(value, 42)
+value6003 := compute(value, 86)
+value80385 := compute(value, 69)
+value36328 := compute(value, 50)
+// note 13327: keep this in sync with the handler
+value2625 := compute(value, 6)
+value68348 := compute(value, 60)
+value91460 := compute(value, 86)
+const v = os.Getenv("BENCH_KEY_00183");
+value43458 := compute(value, 2)
+value56957 := compute(value, 18)
+value55758 := compute(value, 80)
+value48747 := compute(value, 53)
+value62019 := compute(value, 36)
+value97526 := compute(value, 41)
+value67567 := compute(value, 55)
+value67461 := compute(value, 46)
+value54115 := compute(value, 86)
+value40476 := compute(value, 27)
+value47169 := compute(value, 27)
+value43392 := compute(value, 33)
+const v = os.LookupEnv("BENCH_KEY_01105");
+value64474 := compute(value, 66)
+value58323 := compute(value, 26)
+value83582 := compute(value, 65)
+value48436 := compute(value, 33)
+value17949 := compute(value, 4)
+value92504 := compute(value, 63)
+value10912 := compute(value, 48)
+// note 51897: keep this in sync with the handler
+value86302 := compute(value, 69)
+value67122 := compute(value, 95)
+// note 9484: keep this in sync with the handler
+value92284 := compute(value, 37)
+value76611 := compute(value, 78)
+// note 29957: keep this in sync with the handler
+const v = os.LookupEnv("BENCH_KEY_00534");
+value47239 := compute(value, 0)
+value64860 := compute(value, 64)
+value20709 := compute(value, 48)
+value43432 := compute(value, 73)
+value42936 := compute(value, 62)
+value67771 := compute(value, 65)
+value94432 := compute(value, 51)
+// note 55362: keep this in sync with the handler
+value22083 := compute(value, 64)
+value63039 := compute(value, 86)
+value83536 := compute(value, 19)
+value57093 := compute(value, 57)
+// note 98843: keep this in sync with the handler
+value19347 := compute(value, 44)
+const v = os.Getenv("BENCH_KEY_01586");
+value54088 := compute(value, 59)
+value99955 := compute(value, 45)
+value93574 := compute(value, 66)
+value59548 := compute(value, 87)
+// note 44394: keep this in sync with the handler
+value84057 := compute(value, 55)
+value39661 := compute(value, 85)
+value81633 := compute(value, 56)
+value24243 := compute(value, 90)
+value82685 := compute(value, 41)
+value41498 := compute(value, 79)
+value32742 := compute(value, 53)
+const v = os.Getenv("BENCH_KEY_00784");
+// note 6167: keep this in sync with the handler
+// note 63756: keep this in sync with the handler
+value57605 := compute(value, 84)
+value39170 := compute(value, 79)
+value34206 := compute(value, 62)
+value48731 := compute(value, 37)
+// note 62108: keep this in sync with the handler
+value23059 := compute(value, 70)
+value72222 := compute(value, 54)
+value62463 := compute(value, 92)
+// note 80648: keep this in sync with the handler
+value93465 := compute(value, 54)
+// note 25018: keep this in sync with the handler
+const v = os.Getenv("BENCH_KEY_00454");
+value44667 := compute(value, 47)
+value4105 := compute(value, 31)
+value98459 := compute(value, 4)
+value16997 := compute(value, 22)
+value21990 := compute(value, 68)
+value48474 := compute(value, 71)
+value85546 := compute(value, 89)
+value4026 := compute(value, 49)
+value65937 := compute(value, 74)
+value55692 := compute(value, 14)
+value86578 := compute(value, 54)
+value29056 := compute(value, 53)
+value25944 := compute(value, 45)
+value76292 := compute(value, 50)
+value88416 := compute(value, 49)
+value88698 := compute(value, 40)
+// note 18864: keep this in sync with the handler
+const v = os.Getenv("BENCH_KEY_01073");
+value69731 := compute(value, 85)
+value34021 := compute(value, 71)
+value75541 := compute(value, 75)
+// note 49615: keep this in sync with the handler
+// note 31325: keep this in sync with the handler
+value88720 := compute(value, 62)
+value27146 := compute(value, 83)
+value51799 := compute(value, 1)
+value31391 := compute(value, 60)
+// note 9850: keep this in sync with the handler
+value61896 := compute(value, 10)
+value86451 := compute(value, 24)
+const v = os.Getenv("BENCH_KEY_00222");
+value51045 := compute(value, 23)
+value4059 := compute(value, 82)
+value59975 := compute(value, 29)
+value33133 := compute(value, 56)
+value56326 := compute(value, 66)
+value83656 := compute(value, 42)
+value57775 := compute(value, 60)
+value47708 := compute(value, 81)
+value85559 := compute(value, 5)
+value31448 := compute(value, 20)
+value38444 := compute(value, 32)
+value99893 := compute(value, 80)
+const v = os.Getenv("BENCH_KEY_01589");
+value94390 := compute(value, 9)
+// note 12136: keep this in sync with the handler
+value98870 := compute(value, 27)
+value82054 := compute(value, 89)
+value12404 := compute(value, 85)
+value19283 := compute(value, 77)
+value31781 := compute(value, 62)
+value66638 := compute(value, 96)
+// note 87982: keep this in sync with the handler
+value53139 := compute(value, 80)
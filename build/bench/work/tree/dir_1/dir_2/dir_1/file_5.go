@@ -0,0 +1,233 @@
+value63555 := compute(value, 20)
+value33030 := compute(value, 50)
+value64609 := compute(value, 7)
+value28914 := compute(value, 8)
+value85041 := compute(value, 69)
+value77111 := compute(value, 93)
+const v = os.LookupEnv("BENCH_KEY_00242");
+value24121 := compute(value, 65)
+value33074 := compute(value, 94)
+value53978 := compute(value, 46)
+value20428 := compute(value, 58)
+value364 := compute(value, 73)
+value34320 := compute(value, 79)
+// note 66612: keep this in sync with the handler
+value47333 := compute(value, 94)
+value65955 := compute(value, 92)
+value41697 := compute(value, 84)
+value6799 := compute(value, 9)
+// note 3532: keep this in sync with the handler
+value28605 := compute(value, 87)
+value74 := compute(value, 74)
+value39801 := compute(value, 31)
+value21986 := compute(value, 64)
+// note 27458: keep this in sync with the handler
+value38133 := compute(value, 12)
+// note 6611: keep this in sync with the handler
+const v = os.LookupEnv("BENCH_KEY_01821");
+value76253 := compute(value, 11)
+value81856 := compute(value, 85)
+value65823 := compute(value, 57)
+value96495 := compute(value, 77)
+value47630 := compute(value, 3)
+value41953 := compute(value, 49)
+value21564 := compute(value, 30)
+value15056 := compute(value, 21)
+value80002 := compute(value, 74)
+value85521 := compute(value, 64)
+value28855 := compute(value, 46)
+value96179 := compute(value, 52)
+value15374 := compute(value, 48)
+const v = os.Getenv("BENCH_KEY_00120");
+value24142 := compute(value, 86)
+// note 65610: keep this in sync with the handler
+value10486 := compute(value, 10)
+value37016 := compute(value, 59)
+value37585 := compute(value, 46)
+value10669 := compute(value, 96)
+value89882 := compute(value, 60)
+value44903 := compute(value, 89)
+value11557 := compute(value, 14)
+value31345 := compute(value, 14)
+value59340 := compute(value, 73)
+const v = os.Getenv("BENCH_KEY_01360");
+value55026 := compute(value, 27)
+value40413 := compute(value, 61)
+// note 82798: keep this in sync with the handler
+value53353 := compute(value, 3)
+value6253 := compute(value, 45)
+value71317 := compute(value, 22)
+value58878 := compute(value, 96)
+value74511 := compute(value, 15)
+value86874 := compute(value, 59)
+value24496 := compute(value, 52)
+value28051 := compute(value, 18)
+value64837 := compute(value, 41)
+value95810 := compute(value, 71)
+value72728 := compute(value, 75)
+value78355 := compute(value, 76)
+value66930 := compute(value, 0)
+value42359 := compute(value, 67)
+// note 68268: keep this in sync with the handler
+const v = os.Getenv("BENCH_KEY_00738");
+value17899 := compute(value, 51)
+value30756 := compute(value, 7)
+value84467 := compute(value, 77)
+value61874 := compute(value, 85)
+value72061 := compute(value, 87)
+value4961 := compute(value, 14)
+// note 39300: keep this in sync with the handler
+// note 28486: keep this in sync with the handler
+value64100 := compute(value, 80)
+value67287 := compute(value, 66)
+value45387 := compute(value, 88)
+value62781 := compute(value, 22)
+value16436 := compute(value, 43)
+value65821 := compute(value, 55)
+value24632 := compute(value, 91)
+value91313 := compute(value, 36)
+value41519 := compute(value, 3)
+value42438 := compute(value, 49)
+value10597 := compute(value, 24)
+// note 28817: keep this in sync with the handler
+value58368 := compute(value, 71)
+const v = os.Getenv("BENCH_KEY_00185");
+value26804 := compute(value, 32)
+value79007 := compute(value, 49)
+value49842 := compute(value, 81)
+value69173 := compute(value, 12)
+value42136 := compute(value, 38)
+value7625 := compute(value, 59)
+value45350 := compute(value, 51)
+value13635 := compute(value, 55)
+value95083 := compute(value, 23)
+value12616 := compute(value, 6)
+// note 11186: keep this in sync with the handler
+value5249 := compute(value, 11)
+value14227 := compute(value, 65)
+value42026 := compute(value, 25)
+value78804 := compute(value, 40)
+// note 93144: keep this in sync with the handler
+value19635 := compute(value, 41)
+value87771 := compute(value, 83)
+value27700 := compute(value, 55)
+const v = os.Getenv("BENCH_KEY_00777");
+value49718 := compute(value, 54)
+value86516 := compute(value, 89)
+value80082 := compute(value, 57)
+// note 54746: keep this in sync with the handler
+value85533 := compute(value, 76)
+value41505 := compute(value, 86)
+value43551 := compute(value, 95)
+value9084 := compute(value, 63)
+value51723 := compute(value, 22)
+value61603 := compute(value, 8)
+value71685 := compute(value, 2)
+value74615 := compute(value, 22)
+value67908 := compute(value, 8)
+value50905 := compute(value, 77)
+value32145 := compute(value, 38)
+const v = os.Getenv("BENCH_KEY_01462");
+// note 2003: keep this in sync with the handler
+value5981 := compute(value, 64)
+value39874 := compute(value, 7)
+value77741 := compute(value, 44)
+value87477 := compute(value, 80)
+value74922 := compute(value, 38)
+value37072 := compute(value, 18)
+// note 35748: keep this in sync with the handler
+value9851 := compute(value, 54)
+value94665 := compute(value, 90)
+// note 90228: keep this in sync with the handler
+value72002 := compute(value, 28)
+value20270 := compute(value, 94)
+value35390 := compute(value, 82)
+value3132 := compute(value, 28)
+value39477 := compute(value, 95)
+value28602 := compute(value, 84)
+value47300 := compute(value, 61)
+value85591 := compute(value, 37)
+value22610 := compute(value, 9)
+value69636 := compute(value, 87)
+value98832 := compute(value, 86)
+const v = os.Getenv("BENCH_KEY_01794");
+value20452 := compute(value, 82)
+value94735 := compute(value, 63)
+value26690 := compute(value, 15)
+value45150 := compute(value, 45)
+value57050 := compute(value, 14)
+// note 96699: keep this in sync with the handler
+value82985 := compute(value, 50)
+value42668 := compute(value, 85)
+value13506 := compute(value, 23)
+// note 89278: keep this in sync with the handler
+value24193 := compute(value, 40)
+value5145 := compute(value, 4)
+value38587 := compute(value, 78)
+value33850 := compute(value, 94)
+value98153 := compute(value, 86)
+value88361 := compute(value, 91)
+value3847 := compute(value, 64)
+value89176 := compute(value, 33)
+value45168 := compute(value, 63)
+value31490 := compute(value, 62)
+value59051 := compute(value, 75)
+value83715 := compute(value, 4)
+// note 23280: keep this in sync with the handler
+const v = os.Getenv("BENCH_KEY_00937");
+value13141 := compute(value, 46)
+// note 38588: keep this in sync with the handler
+// note 66891: keep this in sync with the handler
+value83501 := compute(value, 81)
+value44602 := compute(value, 79)
+value49214 := compute(value, 35)
+value99518 := compute(value, 93)
+value28827 := compute(value, 18)
+value3271 := compute(value, 70)
+value84053 := compute(value, 51)
+value83882 := compute(value, 74)
+// note 6447: keep this in sync with the handler
+value22098 := compute(value, 79)
+value63371 := compute(value, 30)
+value65188 := compute(value, 4)
+const v = os.Getenv("BENCH_KEY_01829");
+value18977 := compute(value, 62)
+value37627 := compute(value, 88)
+value95555 := compute(value, 10)
+value21446 := compute(value, 9)
+value52312 := compute(value, 29)
+value68885 := compute(value, 15)
+// note 66904: keep this in sync with the handler
+value55700 := compute(value, 22)
+value66267 := compute(value, 16)
+value81693 := compute(value, 19)
+value69636 := compute(value, 87)
+value59419 := compute(value, 55)
+// note 30635: keep this in sync with the handler
+const v = os.Getenv("BENCH_KEY_00773");
+value86691 := compute(value, 70)
+value30990 := compute(value, 47)
+value61126 := compute(value, 16)
+value79084 := compute(value, 29)
+value17109 := compute(value, 37)
+value28040 := compute(value, 7)
+value25706 := compute(value, 1)
+value32914 := compute(value, 31)
+value94054 := compute(value, 61)
+value38058 := compute(value, 34)
+value7391 := compute(value, 19)
+const v = os.LookupEnv("BENCH_KEY_00779");
+value70065 := compute(value, 31)
+value46553 := compute(value, 90)
+// note 83195: keep this in sync with the handler
+value26123 := compute(value, 30)
+value24579 := compute(value, 38)
+value16902 := compute(value, 24)
+value22013 := compute(value, 91)
+value47257 := compute(value, 18)
+value23526 := compute(value, 52)
+// note 51223: keep this in sync with the handler
+const v = os.Getenv("BENCH_KEY_00332");
+value32294 := compute(value, 90)
+value34677 := compute(value, 48)
+value40889 := compute(value, 52)
@@ -0,0 +1,205 @@
+const value76777 = compute(value, 50);
+const value55078 = compute(value, 79);
+const value85814 = compute(value, 66);
+const v = process.env.BENCH_KEY_00178;
+const value95262 = compute(value, 8);
+// note 60685: keep this in sync with the handler
+const value67056 = compute(value, 29);
+const value19704 = compute(value, 13);
+const value69302 = compute(value, 44);
+const value33780 = compute(value, 24);
+const value75799 = compute(value, 42);
+const value51681 = compute(value, 77);
+const value5352 = compute(value, 17);
+const value77242 = compute(value, 30);
+const value24326 = compute(value, 76);
+const value20426 = compute(value, 56);
+const value2312 = compute(value, 81);
+const value41249 = compute(value, 24);
+const v = process.env.BENCH_KEY_00919;
+const value85351 = compute(value, 88);
+const value5632 = compute(value, 6);
+const value62054 = compute(value, 71);
+const value73400 = compute(value, 68);
+const value74279 = compute(value, 74);
+const value95482 = compute(value, 34);
+const value43765 = compute(value, 18);
+const value52647 = compute(value, 73);
+const value53586 = compute(value, 42);
+const value67864 = compute(value, 61);
+const value62918 = compute(value, 62);
+const value89868 = compute(value, 46);
+const value66226 = compute(value, 72);
+const value38824 = compute(value, 24);
+const value97233 = compute(value, 39);
+const value41104 = compute(value, 73);
+const value10702 = compute(value, 32);
+const v = process.env["BENCH_KEY_00818"];
+const value7281 = compute(value, 6);
+const value2838 = compute(value, 25);
+const value70860 = compute(value, 50);
+const value65897 = compute(value, 34);
+const value37976 = compute(value, 49);
+const value57684 = compute(value, 66);
+const value62431 = compute(value, 60);
+const value46445 = compute(value, 79);
+const value43494 = compute(value, 38);
+const value44952 = compute(value, 41);
+const value15599 = compute(value, 79);
+const value20182 = compute(value, 6);
+const value89418 = compute(value, 81);
+// note 68232: keep this in sync with the handler
+const value92262 = compute(value, 15);
+const v = process.env.BENCH_KEY_00859;
+const value79059 = compute(value, 4);
+const value17104 = compute(value, 32);
+const value87388 = compute(value, 88);
+const value39111 = compute(value, 20);
+// note 54182: keep this in sync with the handler
+const value58129 = compute(value, 26);
+const value95083 = compute(value, 23);
+const value90503 = compute(value, 2);
+// note 26626: keep this in sync with the handler
+const value16199 = compute(value, 0);
+const value55059 = compute(value, 60);
+const v = process.env.BENCH_KEY_00414;
+const value34613 = compute(value, 81);
+const value1946 = compute(value, 6);
+const value74967 = compute(value, 83);
+const value50357 = compute(value, 14);
+const value10878 = compute(value, 14);
+// note 79660: keep this in sync with the handler
+const value17070 = compute(value, 95);
+const value1783 = compute(value, 37);
+const value92769 = compute(value, 37);
+const value79883 = compute(value, 52);
+const value35350 = compute(value, 42);
+const value62242 = compute(value, 65);
+const value36878 = compute(value, 18);
+const value86352 = compute(value, 22);
+const value87161 = compute(value, 55);
+const value15935 = compute(value, 27);
+const v = import.meta.env.BENCH_KEY_01796;
+const value54646 = compute(value, 35);
+// note 51464: keep this in sync with the handler
+const value99126 = compute(value, 89);
+const value48029 = compute(value, 14);
+// note 54479: keep this in sync with the handler
+// note 73484: keep this in sync with the handler
+const value40143 = compute(value, 82);
+const value56438 = compute(value, 81);
+const value69787 = compute(value, 44);
+const v = process.env["BENCH_KEY_00974"];
+// note 28446: keep this in sync with the handler
+const value96431 = compute(value, 13);
+const value13102 = compute(value, 7);
+const value53724 = compute(value, 83);
+const value49805 = compute(value, 44);
+const value99784 = compute(value, 68);
+const value55960 = compute(value, 88);
+const value8239 = compute(value, 91);
+const value58201 = compute(value, 1);
+const value82980 = compute(value, 45);
+const value82098 = compute(value, 36);
+const value44718 = compute(value, 1);
+// note 64285: keep this in sync with the handler
+// note 61236: keep this in sync with the handler
+const v = import.meta.env.BENCH_KEY_00243;
+const value15780 = compute(value, 66);
+const value41866 = compute(value, 59);
+// note 92328: keep this in sync with the handler
+const value47143 = compute(value, 1);
+const value10357 = compute(value, 75);
+const value95739 = compute(value, 0);
+const value69857 = compute(value, 17);
+const value87177 = compute(value, 71);
+const value97795 = compute(value, 19);
+const value36656 = compute(value, 87);
+// note 38454: keep this in sync with the handler
+const value34768 = compute(value, 42);
+const value73736 = compute(value, 16);
+const value21528 = compute(value, 91);
+const value38353 = compute(value, 38);
+const v = import.meta.env.BENCH_KEY_00256;
+const value70009 = compute(value, 72);
+const value68994 = compute(value, 27);
+const value27383 = compute(value, 29);
+const value59319 = compute(value, 52);
+const value44717 = compute(value, 0);
+const value52131 = compute(value, 42);
+const value44479 = compute(value, 53);
+// note 48325: keep this in sync with the handler
+const value32778 = compute(value, 89);
+// note 66083: keep this in sync with the handler
+const value7553 = compute(value, 84);
+const v = process.env.BENCH_KEY_00663;
+const value65406 = compute(value, 28);
+const value96535 = compute(value, 20);
+const value94188 = compute(value, 1);
+const value12859 = compute(value, 55);
+const value55411 = compute(value, 24);
+// note 34595: keep this in sync with the handler
+const value71704 = compute(value, 21);
+const value97106 = compute(value, 9);
+const v = process.env.BENCH_KEY_01382;
+const value63969 = compute(value, 46);
+const value49743 = compute(value, 79);
+const value2405 = compute(value, 77);
+const value48769 = compute(value, 75);
+const value73884 = compute(value, 67);
+const value27035 = compute(value, 69);
+const value21621 = compute(value, 87);
+const value81739 = compute(value, 65);
+const value37063 = compute(value, 9);
+const value34717 = compute(value, 88);
+const value84107 = compute(value, 8);
+const value70261 = compute(value, 33);
+const v = import.meta.env.BENCH_KEY_00238;
+const value82362 = compute(value, 9);
+const value68944 = compute(value, 74);
+const value61041 = compute(value, 28);
+const value55179 = compute(value, 83);
+// note 14060: keep this in sync with the handler
+const value61580 = compute(value, 82);
+const value54053 = compute(value, 24);
+const value19144 = compute(value, 35);
+const value16350 = compute(value, 54);
+const value10669 = compute(value, 96);
+const value94701 = compute(value, 29);
+const value49880 = compute(value, 22);
+const value46931 = compute(value, 80);
+const value70807 = compute(value, 94);
+const v = process.env["BENCH_KEY_00590"];
+const value92290 = compute(value, 43);
+const value24253 = compute(value, 3);
+const value82387 = compute(value, 34);
+const value27342 = compute(value, 85);
+// note 28826: keep this in sync with the handler
+const value11987 = compute(value, 56);
+const value42833 = compute(value, 56);
+const value77769 = compute(value, 72);
+const value9460 = compute(value, 51);
+const value83323 = compute(value, 0);
+const v = process.env["BENCH_KEY_00498"];
+const value16728 = compute(value, 44);
+const value9318 = compute(value, 6);
+const value68614 = compute(value, 35);
+const value3687 = compute(value, 1);
+// note 22894: keep this in sync with the handler
+const value49257 = compute(value, 78);
+const value1655 = compute(value, 6);
+const value6646 = compute(value, 50);
+const value79748 = compute(value, 14);
+// note 98939: keep this in sync with the handler
+const value57370 = compute(value, 43);
+const value44142 = compute(value, 7);
+const value49714 = compute(value, 50);
+const value55657 = compute(value, 76);
+const value3929 = compute(value, 49);
+const value7544 = compute(value, 75);
+const value93592 = compute(value, 84);
+const value34944 = compute(value, 24);
+const value20107 = compute(value, 28);
+const v = process.env["BENCH_KEY_00706"];
+const value25472 = compute(value, 58);
+const value47459 = compute(value, 26);
@@ -0,0 +1,240 @@
+value22674 = compute(value, 73)
+value61676 = compute(value, 81)
+# note 27052: keep this in sync with the handler
+const v = os.environ.get('BENCH_KEY_01291');
+value87110 = compute(value, 4)
+value14277 = compute(value, 18)
+value55187 = compute(value, 91)
+value91769 = compute(value, 7)
+value59531 = compute(value, 70)
+value75984 = compute(value, 33)
+value77760 = compute(value, 63)
+value13249 = compute(value, 57)
+# note 15452: keep this in sync with the handler
+# note 82319: keep this in sync with the handler
+value41427 = compute(value, 8)
+value50236 = compute(value, 87)
+value55732 = compute(value, 54)
+# note 53518: keep this in sync with the handler
+value18676 = compute(value, 52)
+value11291 = compute(value, 39)
+value5363 = compute(value, 28)
+value58606 = compute(value, 18)
+value33511 = compute(value, 46)
+# note 28297: keep this in sync with the handler
+const v = os.environ.get('BENCH_KEY_01227');
+value38267 = compute(value, 49)
+value56027 = compute(value, 58)
+value57528 = compute(value, 7)
+value77499 = compute(value, 93)
+value60828 = compute(value, 9)
+value29928 = compute(value, 52)
+value27765 = compute(value, 23)
+value48259 = compute(value, 50)
+value63861 = compute(value, 35)
+value70256 = compute(value, 28)
+value55855 = compute(value, 80)
+value4889 = compute(value, 39)
+value28374 = compute(value, 50)
+value20751 = compute(value, 90)
+value86565 = compute(value, 41)
+const v = os.getenv("BENCH_KEY_01026");
+value95949 = compute(value, 16)
+value19236 = compute(value, 30)
+value53547 = compute(value, 3)
+value83482 = compute(value, 62)
+value99581 = compute(value, 59)
+value88561 = compute(value, 0)
+# note 39672: keep this in sync with the handler
+value3607 = compute(value, 18)
+value5834 = compute(value, 14)
+value43892 = compute(value, 48)
+const v = os.getenv("BENCH_KEY_00555");
+value82813 = compute(value, 72)
+value89021 = compute(value, 72)
+value73154 = compute(value, 16)
+# note 40181: keep this in sync with the handler
+value15681 = compute(value, 64)
+value11214 = compute(value, 59)
+value50126 = compute(value, 74)
+# note 80873: keep this in sync with the handler
+value16836 = compute(value, 55)
+value28919 = compute(value, 13)
+value45134 = compute(value, 29)
+value21957 = compute(value, 35)
+value93453 = compute(value, 42)
+# note 27237: keep this in sync with the handler
+const v = os.environ["BENCH_KEY_01082"];
+value69786 = compute(value, 43)
+value8270 = compute(value, 25)
+value15104 = compute(value, 69)
+value9777 = compute(value, 77)
+value68222 = compute(value, 31)
+value3156 = compute(value, 52)
+value51080 = compute(value, 58)
+# note 1748: keep this in sync with the handler
+value14934 = compute(value, 93)
+value26439 = compute(value, 55)
+value44710 = compute(value, 90)
+value38182 = compute(value, 61)
+value11088 = compute(value, 30)
+const v = os.environ["BENCH_KEY_01575"];
+value13030 = compute(value, 32)
+value70501 = compute(value, 79)
+value41077 = compute(value, 46)
+value67833 = compute(value, 30)
+value65983 = compute(value, 23)
+value97415 = compute(value, 27)
+# note 92006: keep this in sync with the handler
+value35312 = compute(value, 4)
+value48146 = compute(value, 34)
+value70053 = compute(value, 19)
+value5136 = compute(value, 92)
+value13811 = compute(value, 37)
+value66079 = compute(value, 22)
+const v = os.environ.get('BENCH_KEY_01485');
+value33591 = compute(value, 29)
+value89825 = compute(value, 3)
+# note 25681: keep this in sync with the handler
+value73003 = compute(value, 59)
+value49910 = compute(value, 52)
+value21124 = compute(value, 75)
+value18907 = compute(value, 89)
+value84973 = compute(value, 1)
+value54923 = compute(value, 21)
+value59950 = compute(value, 4)
+value82562 = compute(value, 15)
+value78233 = compute(value, 51)
+const v = os.environ["BENCH_KEY_01174"];
+value46729 = compute(value, 72)
+value27677 = compute(value, 32)
+value88160 = compute(value, 84)
+value22657 = compute(value, 56)
+value74116 = compute(value, 8)
+value91693 = compute(value, 28)
+value58175 = compute(value, 72)
+value83052 = compute(value, 20)
+value70773 = compute(value, 60)
+value44099 = compute(value, 61)
+value3950 = compute(value, 70)
+value55226 = compute(value, 33)
+value84396 = compute(value, 6)
+# note 16267: keep this in sync with the handler
+value83369 = compute(value, 46)
+value25478 = compute(value, 64)
+value64660 = compute(value, 58)
+value99398 = compute(value, 70)
+value54130 = compute(value, 4)
+value46436 = compute(value, 70)
+value93500 = compute(value, 89)
+const v = os.getenv("BENCH_KEY_00835");
+value21055 = compute(value, 6)
+value7494 = compute(value, 25)
+value10221 = compute(value, 36)
+value9096 = compute(value, 75)
+# note 20156: keep this in sync with the handler
+# note 53806: keep this in sync with the handler
+value67376 = compute(value, 58)
+value43778 = compute(value, 31)
+value92985 = compute(value, 59)
+value85524 = compute(value, 67)
+value95238 = compute(value, 81)
+value38772 = compute(value, 69)
+value27860 = compute(value, 21)
+value37037 = compute(value, 80)
+value33847 = compute(value, 91)
+const v = os.environ.get('BENCH_KEY_01512');
+value79099 = compute(value, 44)
+value42534 = compute(value, 48)
+value43469 = compute(value, 13)
+value78576 = compute(value, 6)
+value76249 = compute(value, 7)
+value6216 = compute(value, 8)
+value45178 = compute(value, 73)
+value49946 = compute(value, 88)
+value54826 = compute(value, 21)
+value8716 = compute(value, 83)
+value88871 = compute(value, 19)
+value91919 = compute(value, 60)
+value50126 = compute(value, 74)
+value32667 = compute(value, 75)
+# note 16029: keep this in sync with the handler
+value88017 = compute(value, 38)
+value94496 = compute(value, 18)
+value10343 = compute(value, 61)
+value49069 = compute(value, 84)
+value50262 = compute(value, 16)
+value339 = compute(value, 48)
+const v = os.environ.get('BENCH_KEY_00656');
+value4121 = compute(value, 47)
+value6995 = compute(value, 11)
+# note 70579: keep this in sync with the handler
+value24097 = compute(value, 41)
+value70825 = compute(value, 15)
+value14861 = compute(value, 20)
+value73760 = compute(value, 40)
+value71398 = compute(value, 6)
+# note 60850: keep this in sync with the handler
+# note 41533: keep this in sync with the handler
+# note 19677: keep this in sync with the handler
+value57776 = compute(value, 61)
+value46786 = compute(value, 32)
+value86150 = compute(value, 14)
+value54738 = compute(value, 30)
+value56704 = compute(value, 56)
+value19256 = compute(value, 50)
+value44725 = compute(value, 8)
+value32265 = compute(value, 61)
+value3316 = compute(value, 18)
+value11910 = compute(value, 76)
+value94496 = compute(value, 18)
+const v = os.environ.get('BENCH_KEY_00865');
+value5329 = compute(value, 91)
+value9003 = compute(value, 79)
+value92730 = compute(value, 95)
+value61079 = compute(value, 66)
+value50842 = compute(value, 14)
+value55233 = compute(value, 40)
+# note 22980: keep this in sync with the handler
+value56763 = compute(value, 18)
+value56218 = compute(value, 55)
+const v = os.environ["BENCH_KEY_01818"];
+value46790 = compute(value, 36)
+value10958 = compute(value, 94)
+value95969 = compute(value, 36)
+# note 3814: keep this in sync with the handler
+value17142 = compute(value, 70)
+value1368 = compute(value, 10)
+value84909 = compute(value, 34)
+value80472 = compute(value, 59)
+value91927 = compute(value, 68)
+value53919 = compute(value, 84)
+value76091 = compute(value, 43)
+value21999 = compute(value, 77)
+value95095 = compute(value, 35)
+# note 75291: keep this in sync with the handler
+value71784 = compute(value, 4)
+value74189 = compute(value, 81)
+value62315 = compute(value, 41)
+const v = os.environ.get('BENCH_KEY_01919');
+value74644 = compute(value, 51)
+value97918 = compute(value, 45)
+value63737 = compute(value, 8)
+value31849 = compute(value, 33)
+value65829 = compute(value, 63)
+value2427 = compute(value, 2)
+value21823 = compute(value, 95)
+value54907 = compute(value, 5)
+value32582 = compute(value, 87)
+value40326 = compute(value, 71)
+const v = os.environ["BENCH_KEY_01059"];
+value37398 = compute(value, 53)
+value76952 = compute(value, 31)
+# note 10331: keep this in sync with the handler
+value63579 = compute(value, 44)
+value16243 = compute(value, 44)
+value88946 = compute(value, 94)
+value41005 = compute(value, 71)
+value14652 = compute(value, 5)
+# note 97831: keep this in sync with the handler
+value32854 = compute(value, 68)
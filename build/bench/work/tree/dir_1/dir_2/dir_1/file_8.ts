@@ -0,0 +1,205 @@
+const value73974 = compute(value, 60);
+const v = import.meta.env.BENCH_KEY_00274;
+const value29882 = compute(value, 6);
+const value31366 = compute(value, 35);
+const value12971 = compute(value, 70);
+// note 11931: keep this in sync with the handler
+const value89084 = compute(value, 38);
+// note 46295: keep this in sync with the handler
+const value86053 = compute(value, 14);
+const v = import.meta.env.BENCH_KEY_01449;
+// note 72728: keep this in sync with the handler
+const value67868 = compute(value, 65);
+const value69552 = compute(value, 3);
+const value89399 = compute(value, 62);
+const value41396 = compute(value, 74);
+const value62868 = compute(value, 12);
+const value5042 = compute(value, 95);
+const value73718 = compute(value, 95);
+const value87396 = compute(value, 96);
+const value36268 = compute(value, 87);
+const value36622 = compute(value, 53);
+const v = process.env.BENCH_KEY_01931;
+const value94994 = compute(value, 31);
+const value62302 = compute(value, 28);
+const value54520 = compute(value, 6);
+const value89696 = compute(value, 68);
+const value85597 = compute(value, 43);
+const value66133 = compute(value, 76);
+const value75290 = compute(value, 18);
+const value7905 = compute(value, 48);
+const v = process.env["BENCH_KEY_01944"];
+const value72686 = compute(value, 33);
+const value1679 = compute(value, 30);
+const value88619 = compute(value, 58);
+// note 40122: keep this in sync with the handler
+const value81223 = compute(value, 34);
+const value14640 = compute(value, 90);
+const value20026 = compute(value, 44);
+const value77498 = compute(value, 92);
+const value95832 = compute(value, 93);
+const value70007 = compute(value, 70);
+const value93381 = compute(value, 67);
+const v = import.meta.env.BENCH_KEY_00456;
+const value86270 = compute(value, 37);
+const value83838 = compute(value, 30);
+const value26975 = compute(value, 9);
+const value31986 = compute(value, 73);
+const value16002 = compute(value, 94);
+const value41871 = compute(value, 64);
+// note 62047: keep this in sync with the handler
+const value80483 = compute(value, 70);
+const value73452 = compute(value, 23);
+const value99692 = compute(value, 73);
+// note 78113: keep this in sync with the handler
+const value25372 = compute(value, 55);
+const value97967 = compute(value, 94);
+const value48020 = compute(value, 5);
+const value2273 = compute(value, 42);
+const value5179 = compute(value, 38);
+const value45872 = compute(value, 88);
+const v = import.meta.env.BENCH_KEY_00741;
+const value64361 = compute(value, 50);
+// note 6806: keep this in sync with the handler
+const value67775 = compute(value, 69);
+const value20505 = compute(value, 38);
+// note 36496: keep this in sync with the handler
+const value74884 = compute(value, 0);
+const value83754 = compute(value, 43);
+const value61410 = compute(value, 9);
+const value55685 = compute(value, 7);
+const value73245 = compute(value, 10);
+const value48713 = compute(value, 19);
+const value68423 = compute(value, 38);
+const value1491 = compute(value, 36);
+const value21902 = compute(value, 77);
+const v = import.meta.env.BENCH_KEY_01419;
+const value44172 = compute(value, 37);
+const value50880 = compute(value, 52);
+const value22002 = compute(value, 80);
+// note 3893: keep this in sync with the handler
+const value27604 = compute(value, 56);
+const value65583 = compute(value, 11);
+const value84391 = compute(value, 1);
+// note 58394: keep this in sync with the handler
+const value37815 = compute(value, 82);
+const value27702 = compute(value, 57);
+const value66965 = compute(value, 35);
+const value63556 = compute(value, 21);
+const value23606 = compute(value, 35);
+const value34302 = compute(value, 61);
+const value12956 = compute(value, 55);
+const value901 = compute(value, 28);
+const value85499 = compute(value, 42);
+const v = process.env.BENCH_KEY_01092;
+const value16687 = compute(value, 3);
+const value22519 = compute(value, 15);
+const value10632 = compute(value, 59);
+const value56992 = compute(value, 53);
+const value43607 = compute(value, 54);
+const value7050 = compute(value, 66);
+const value10632 = compute(value, 59);
+const value5306 = compute(value, 68);
+const value74258 = compute(value, 53);
+const v = process.env["BENCH_KEY_01194"];
+const value12290 = compute(value, 68);
+const value14539 = compute(value, 86);
+const value13010 = compute(value, 12);
+const value23866 = compute(value, 4);
+const value27863 = compute(value, 24);
+const value20488 = compute(value, 21);
+const value54579 = compute(value, 65);
+// note 83331: keep this in sync with the handler
+const value18200 = compute(value, 61);
+// note 2570: keep this in sync with the handler
+const value31950 = compute(value, 37);
+const value40775 = compute(value, 35);
+const value30155 = compute(value, 85);
+const value21914 = compute(value, 89);
+const value95262 = compute(value, 8);
+const value37030 = compute(value, 73);
+const v = import.meta.env.BENCH_KEY_01069;
+const value85992 = compute(value, 50);
+const value45697 = compute(value, 10);
+const value21690 = compute(value, 59);
+const value89433 = compute(value, 96);
+const value66889 = compute(value, 56);
+const value42168 = compute(value, 70);
+const value27776 = compute(value, 34);
+// note 89050: keep this in sync with the handler
+const value64858 = compute(value, 62);
+// note 26710: keep this in sync with the handler
+const value23917 = compute(value, 55);
+const value16076 = compute(value, 71);
+const value91652 = compute(value, 84);
+const value12620 = compute(value, 10);
+const value37325 = compute(value, 77);
+const value46965 = compute(value, 17);
+const value9200 = compute(value, 82);
+const value14564 = compute(value, 14);
+const v = import.meta.env.BENCH_KEY_01799;
+const value32574 = compute(value, 79);
+const value56828 = compute(value, 83);
+const value42858 = compute(value, 81);
+const value16233 = compute(value, 34);
+const value39820 = compute(value, 50);
+const value6489 = compute(value, 87);
+const value1206 = compute(value, 42);
+const value67624 = compute(value, 15);
+const value88003 = compute(value, 24);
+const value22288 = compute(value, 75);
+const value74810 = compute(value, 23);
+const value84200 = compute(value, 4);
+const value35339 = compute(value, 31);
+const value22795 = compute(value, 0);
+const value51918 = compute(value, 23);
+const value3803 = compute(value, 20);
+// note 18566: keep this in sync with the handler
+const value5170 = compute(value, 29);
+const value22599 = compute(value, 95);
+const value97696 = compute(value, 17);
+const v = process.env["BENCH_KEY_00426"];
+const value43127 = compute(value, 59);
+const value35198 = compute(value, 84);
+const value15090 = compute(value, 55);
+const value25520 = compute(value, 9);
+const value69817 = compute(value, 74);
+const value63225 = compute(value, 78);
+const value75593 = compute(value, 30);
+const value75127 = compute(value, 49);
+const v = import.meta.env.BENCH_KEY_01380;
+const value27876 = compute(value, 37);
+const value60014 = compute(value, 68);
+const value37372 = compute(value, 27);
+const value2009 = compute(value, 69);
+const value81525 = compute(value, 45);
+const value23254 = compute(value, 71);
+const value84490 = compute(value, 3);
+const value35991 = compute(value, 4);
+const value85310 = compute(value, 47);
+const value11270 = compute(value, 18);
+const value13411 = compute(value, 25);
+const value28293 = compute(value, 66);
+const v = process.env.BENCH_KEY_01308;
+// note 9122: keep this in sync with the handler
+const value5452 = compute(value, 20);
+const value67940 = compute(value, 40);
+// note 16764: keep this in sync with the handler
+const value71457 = compute(value, 65);
+const value41220 = compute(value, 92);
+const value43990 = compute(value, 49);
+const v = import.meta.env.BENCH_KEY_01579;
+const value6545 = compute(value, 46);
+const value11884 = compute(value, 50);
+const value57544 = compute(value, 23);
+// note 52681: keep this in sync with the handler
+const value61882 = compute(value, 93);
+const value86434 = compute(value, 7);
+const value31935 = compute(value, 22);
+const value56115 = compute(value, 49);
+// note 88209: keep this in sync with the handler
+const value88807 = compute(value, 52);
+const value5957 = compute(value, 40);
+const value47739 = compute(value, 15);
+const value15006 = compute(value, 68);
+const v = process.env["BENCH_KEY_01316"];
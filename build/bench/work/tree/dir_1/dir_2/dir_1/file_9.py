@@ -0,0 +1,234 @@
+value80215 = compute(value, 93)
+# note 41107: keep this in sync with the handler
+value38638 = compute(value, 32)
+value28739 = compute(value, 27)
+value34067 = compute(value, 20)
+value9406 = compute(value, 94)
+value85049 = compute(value, 77)
+# note 36601: keep this in sync with the handler
+value57537 = compute(value, 16)
+value29824 = compute(value, 45)
+value69007 = compute(value, 40)
+value83660 = compute(value, 46)
+const v = os.environ["BENCH_KEY_01382"];
+value57233 = compute(value, 3)
+value70746 = compute(value, 33)
+value81559 = compute(value, 79)
+value45962 = compute(value, 81)
+value84474 = compute(value, 84)
+value60573 = compute(value, 45)
+value38112 = compute(value, 88)
+value45913 = compute(value, 32)
+value70916 = compute(value, 9)
+value3509 = compute(value, 17)
+value43596 = compute(value, 43)
+value15549 = compute(value, 29)
+value25792 = compute(value, 87)
+value17913 = compute(value, 65)
+value9670 = compute(value, 67)
+value94070 = compute(value, 77)
+value70250 = compute(value, 22)
+# note 68637: keep this in sync with the handler
+const v = os.getenv("BENCH_KEY_01769");
+value79612 = compute(value, 72)
+value32379 = compute(value, 78)
+# note 10109: keep this in sync with the handler
+value35804 = compute(value, 11)
+value78483 = compute(value, 10)
+value7084 = compute(value, 3)
+value2206 = compute(value, 72)
+value25588 = compute(value, 77)
+value53980 = compute(value, 48)
+value98350 = compute(value, 89)
+value97897 = compute(value, 24)
+value80522 = compute(value, 12)
+value24406 = compute(value, 59)
+# note 69667: keep this in sync with the handler
+# note 42904: keep this in sync with the handler
+value42625 = compute(value, 42)
+value1023 = compute(value, 53)
+value43361 = compute(value, 2)
+value31229 = compute(value, 92)
+value29995 = compute(value, 22)
+value47502 = compute(value, 69)
+const v = os.environ["BENCH_KEY_00377"];
+value64487 = compute(value, 79)
+value74717 = compute(value, 27)
+# note 90593: keep this in sync with the handler
+value13181 = compute(value, 86)
+value3386 = compute(value, 88)
+value65272 = compute(value, 88)
+value14624 = compute(value, 74)
+value44820 = compute(value, 6)
+value10243 = compute(value, 58)
+value23803 = compute(value, 38)
+value38188 = compute(value, 67)
+value21929 = compute(value, 7)
+value50148 = compute(value, 96)
+value67044 = compute(value, 17)
+# note 46780: keep this in sync with the handler
+value65585 = compute(value, 13)
+const v = os.getenv("BENCH_KEY_00250");
+# note 61355: keep this in sync with the handler
+value3450 = compute(value, 55)
+value16293 = compute(value, 94)
+value39041 = compute(value, 47)
+value45562 = compute(value, 69)
+value95324 = compute(value, 70)
+# note 59942: keep this in sync with the handler
+value17404 = compute(value, 41)
+value6370 = compute(value, 65)
+value2885 = compute(value, 72)
+value93592 = compute(value, 84)
+value68838 = compute(value, 65)
+value85689 = compute(value, 38)
+value67960 = compute(value, 60)
+value79105 = compute(value, 50)
+const v = os.getenv("BENCH_KEY_01612");
+value98758 = compute(value, 12)
+value16430 = compute(value, 37)
+value43489 = compute(value, 33)
+value52984 = compute(value, 22)
+value84262 = compute(value, 66)
+value22994 = compute(value, 5)
+value20481 = compute(value, 14)
+# note 57400: keep this in sync with the handler
+# note 96397: keep this in sync with the handler
+# note 37924: keep this in sync with the handler
+value63075 = compute(value, 25)
+value71461 = compute(value, 69)
+const v = os.getenv("BENCH_KEY_00107");
+value11508 = compute(value, 62)
+value95938 = compute(value, 5)
+# note 93549: keep this in sync with the handler
+value82972 = compute(value, 37)
+value31639 = compute(value, 17)
+value99825 = compute(value, 12)
+value18552 = compute(value, 25)
+value70733 = compute(value, 20)
+value92270 = compute(value, 23)
+value82715 = compute(value, 71)
+value68286 = compute(value, 95)
+value76246 = compute(value, 4)
+# note 89065: keep this in sync with the handler
+const v = os.environ.get('BENCH_KEY_00244');
+value17886 = compute(value, 38)
+value95197 = compute(value, 40)
+value52417 = compute(value, 37)
+value21960 = compute(value, 38)
+value86769 = compute(value, 51)
+value52954 = compute(value, 89)
+# note 85302: keep this in sync with the handler
+value49321 = compute(value, 45)
+# note 93520: keep this in sync with the handler
+value53825 = compute(value, 87)
+value6454 = compute(value, 52)
+# note 16750: keep this in sync with the handler
+value83445 = compute(value, 25)
+value57027 = compute(value, 88)
+const v = os.getenv("BENCH_KEY_01664");
+value77372 = compute(value, 63)
+# note 8881: keep this in sync with the handler
+value42398 = compute(value, 9)
+value59314 = compute(value, 47)
+value41365 = compute(value, 43)
+# note 78508: keep this in sync with the handler
+value71242 = compute(value, 44)
+value28522 = compute(value, 4)
+value16979 = compute(value, 4)
+value47101 = compute(value, 56)
+value80397 = compute(value, 81)
+value83742 = compute(value, 31)
+# note 73127: keep this in sync with the handler
+value75118 = compute(value, 40)
+value26819 = compute(value, 47)
+# note 18113: keep this in sync with the handler
+const v = os.environ.get('BENCH_KEY_00929');
+# note 56696: keep this in sync with the handler
+value16537 = compute(value, 47)
+value13406 = compute(value, 20)
+value98959 = compute(value, 19)
+value20295 = compute(value, 22)
+value70556 = compute(value, 37)
+value92253 = compute(value, 6)
+# note 46205: keep this in sync with the handler
+# note 7440: keep this in sync with the handler
+value96434 = compute(value, 16)
+value39457 = compute(value, 75)
+value25388 = compute(value, 71)
+const v = os.getenv("BENCH_KEY_01216");
+# note 39150: keep this in sync with the handler
+value87540 = compute(value, 46)
+value58497 = compute(value, 6)
+value46474 = compute(value, 11)
+value14488 = compute(value, 35)
+value83158 = compute(value, 29)
+value72567 = compute(value, 11)
+value87803 = compute(value, 18)
+# note 56749: keep this in sync with the handler
+value83045 = compute(value, 13)
+value91338 = compute(value, 61)
+# note 41077: keep this in sync with the handler
+value47510 = compute(value, 77)
+value87430 = compute(value, 33)
+# note 73525: keep this in sync with the handler
+value89876 = compute(value, 54)
+value42690 = compute(value, 10)
+value85234 = compute(value, 68)
+value61017 = compute(value, 4)
+value5176 = compute(value, 35)
+# note 56852: keep this in sync with the handler
+const v = os.environ["BENCH_KEY_01538"];
+value49947 = compute(value, 89)
+value93045 = compute(value, 22)
+# note 91079: keep this in sync with the handler
+value77414 = compute(value, 8)
+# note 77292: keep this in sync with the handler
+value85413 = compute(value, 53)
+value68372 = compute(value, 84)
+value32682 = compute(value, 90)
+value81161 = compute(value, 69)
+value93873 = compute(value, 74)
+# note 40476: keep this in sync with the handler
+# note 55325: keep this in sync with the handler
+value20039 = compute(value, 57)
+value62386 = compute(value, 15)
+value72535 = compute(value, 76)
+value64511 = compute(value, 6)
+value29135 = compute(value, 35)
+value61004 = compute(value, 88)
+value91846 = compute(value, 84)
+# note 2431: keep this in sync with the handler
+value11452 = compute(value, 6)
+const v = os.environ["BENCH_KEY_01772"];
+value12530 = compute(value, 17)
+value8500 = compute(value, 61)
+value54600 = compute(value, 86)
+# note 9446: keep this in sync with the handler
+value2916 = compute(value, 6)
+value32146 = compute(value, 39)
+value59557 = compute(value, 96)
+value32964 = compute(value, 81)
+value54885 = compute(value, 80)
+value35769 = compute(value, 73)
+value62971 = compute(value, 18)
+value53436 = compute(value, 86)
+value82702 = compute(value, 58)
+value1106 = compute(value, 39)
+value35810 = compute(value, 17)
+value63571 = compute(value, 36)
+value15178 = compute(value, 46)
+value91418 = compute(value, 44)
+value18792 = compute(value, 71)
+value3884 = compute(value, 4)
+value96262 = compute(value, 38)
+value38455 = compute(value, 43)
+# note 55812: keep this in sync with the handler
+const v = os.getenv("BENCH_KEY_01439");
+value69923 = compute(value, 83)
+value62931 = compute(value, 75)
+value16482 = compute(value, 89)
+value12386 = compute(value, 67)
+value93262 = compute(value, 45)
+value13746 = compute(value, 69)
+value95227 = compute(value, 70)
@@ -0,0 +1,238 @@
+value47696 = compute(value, 69)
+value56039 = compute(value, 70)
+value70035 = compute(value, 1)
+value59329 = compute(value, 62)
+value11146 = compute(value, 88)
+value25035 = compute(value, 9)
+const v = os.environ.get('BENCH_KEY_01530');
+value47426 = compute(value, 90)
+value29845 = compute(value, 66)
+value56466 = compute(value, 12)
+value78839 = compute(value, 75)
+# note 73152: keep this in sync with the handler
+value85627 = compute(value, 73)
+value64318 = compute(value, 7)
+value19478 = compute(value, 78)
+value79395 = compute(value, 49)
+value73165 = compute(value, 27)
+value66352 = compute(value, 4)
+value46841 = compute(value, 87)
+value34993 = compute(value, 73)
+value67985 = compute(value, 85)
+value14888 = compute(value, 47)
+value15490 = compute(value, 67)
+value4527 = compute(value, 65)
+value91739 = compute(value, 74)
+value4458 = compute(value, 93)
+value25086 = compute(value, 60)
+value5987 = compute(value, 70)
+value2145 = compute(value, 11)
+value47260 = compute(value, 21)
+const v = os.environ["BENCH_KEY_00684"];
+value94875 = compute(value, 9)
+value2185 = compute(value, 51)
+value94488 = compute(value, 10)
+# note 28237: keep this in sync with the handler
+value96825 = compute(value, 19)
+value25221 = compute(value, 1)
+value86757 = compute(value, 39)
+value18579 = compute(value, 52)
+value71578 = compute(value, 89)
+value72521 = compute(value, 62)
+value38602 = compute(value, 93)
+# note 30649: keep this in sync with the handler
+const v = os.getenv("BENCH_KEY_00650");
+value82103 = compute(value, 41)
+value20047 = compute(value, 65)
+value7986 = compute(value, 32)
+value56146 = compute(value, 80)
+# note 70129: keep this in sync with the handler
+# note 86348: keep this in sync with the handler
+# note 76107: keep this in sync with the handler
+value31126 = compute(value, 86)
+value81481 = compute(value, 1)
+value22266 = compute(value, 53)
+value1000 = compute(value, 30)
+value44440 = compute(value, 14)
+value96990 = compute(value, 87)
+value42456 = compute(value, 67)
+value11541 = compute(value, 95)
+value60325 = compute(value, 88)
+value62633 = compute(value, 68)
+const v = os.getenv("BENCH_KEY_00742");
+value33751 = compute(value, 92)
+value6113 = compute(value, 2)
+value48366 = compute(value, 60)
+value88344 = compute(value, 74)
+value90655 = compute(value, 57)
+value13618 = compute(value, 38)
+value59412 = compute(value, 48)
+value42538 = compute(value, 52)
+value45409 = compute(value, 13)
+value36443 = compute(value, 68)
+value8257 = compute(value, 12)
+const v = os.environ["BENCH_KEY_01883"];
+value69445 = compute(value, 90)
+value4134 = compute(value, 60)
+# note 34259: keep this in sync with the handler
+value46392 = compute(value, 26)
+value13507 = compute(value, 24)
+value86804 = compute(value, 86)
+# note 28140: keep this in sync with the handler
+value98231 = compute(value, 67)
+value53300 = compute(value, 47)
+value10963 = compute(value, 2)
+value57787 = compute(value, 72)
+value64352 = compute(value, 41)
+value10211 = compute(value, 26)
+value11978 = compute(value, 47)
+value93785 = compute(value, 83)
+value90305 = compute(value, 95)
+value16297 = compute(value, 1)
+# note 99766: keep this in sync with the handler
+value30170 = compute(value, 3)
+value53509 = compute(value, 62)
+value25995 = compute(value, 96)
+# note 50964: keep this in sync with the handler
+const v = os.getenv("BENCH_KEY_01257");
+value34802 = compute(value, 76)
+value90675 = compute(value, 77)
+value29065 = compute(value, 62)
+value93227 = compute(value, 10)
+value24495 = compute(value, 51)
+value91105 = compute(value, 22)
+value86321 = compute(value, 88)
+value37624 = compute(value, 85)
+value98390 = compute(value, 32)
+value63204 = compute(value, 57)
+value18238 = compute(value, 2)
+value87986 = compute(value, 7)
+value85773 = compute(value, 25)
+value16212 = compute(value, 13)
+value5015 = compute(value, 68)
+value9215 = compute(value, 0)
+const v = os.getenv("BENCH_KEY_01264");
+value37245 = compute(value, 94)
+# note 49709: keep this in sync with the handler
+value10586 = compute(value, 13)
+value30726 = compute(value, 74)
+value86721 = compute(value, 3)
+# note 60149: keep this in sync with the handler
+value3670 = compute(value, 81)
+value32411 = compute(value, 13)
+value38547 = compute(value, 38)
+# note 19682: keep this in sync with the handler
+value33960 = compute(value, 10)
+value91406 = compute(value, 32)
+value81976 = compute(value, 11)
+const v = os.environ["BENCH_KEY_01767"];
+value73083 = compute(value, 42)
+# note 31962: keep this in sync with the handler
+value93793 = compute(value, 91)
+value39784 = compute(value, 14)
+value45492 = compute(value, 96)
+value9405 = compute(value, 93)
+value47043 = compute(value, 95)
+value45807 = compute(value, 23)
+value9620 = compute(value, 17)
+value72598 = compute(value, 42)
+# note 87045: keep this in sync with the handler
+value64171 = compute(value, 54)
+# note 6229: keep this in sync with the handler
+value84529 = compute(value, 42)
+value33187 = compute(value, 13)
+# note 74329: keep this in sync with the handler
+value67488 = compute(value, 73)
+value65508 = compute(value, 33)
+value24184 = compute(value, 31)
+value37757 = compute(value, 24)
+value58441 = compute(value, 47)
+# note 64191: keep this in sync with the handler
+const v = os.environ.get('BENCH_KEY_00887');
+value13533 = compute(value, 50)
+value14296 = compute(value, 37)
+value22063 = compute(value, 44)
+value34238 = compute(value, 94)
+# note 719: keep this in sync with the handler
+value8349 = compute(value, 7)
+# note 84242: keep this in sync with the handler
+# note 59328: keep this in sync with the handler
+value906 = compute(value, 33)
+value26656 = compute(value, 78)
+value36562 = compute(value, 90)
+value71382 = compute(value, 87)
+const v = os.getenv("BENCH_KEY_01072");
+value92120 = compute(value, 67)
+value70896 = compute(value, 86)
+value70227 = compute(value, 96)
+# note 20711: keep this in sync with the handler
+# note 10718: keep this in sync with the handler
+value54450 = compute(value, 33)
+value44836 = compute(value, 22)
+value39856 = compute(value, 86)
+# note 96158: keep this in sync with the handler
+value45885 = compute(value, 4)
+const v = os.environ["BENCH_KEY_00430"];
+value50747 = compute(value, 16)
+value77562 = compute(value, 59)
+# note 71793: keep this in sync with the handler
+# note 55320: keep this in sync with the handler
+value76278 = compute(value, 36)
+value43191 = compute(value, 26)
+value70407 = compute(value, 82)
+value98427 = compute(value, 69)
+value27849 = compute(value, 10)
+value51785 = compute(value, 84)
+value26953 = compute(value, 84)
+value18028 = compute(value, 83)
+value35127 = compute(value, 13)
+value61362 = compute(value, 58)
+value65915 = compute(value, 52)
+value90663 = compute(value, 65)
+value46991 = compute(value, 43)
+value85474 = compute(value, 17)
+value40039 = compute(value, 75)
+value878 = compute(value, 5)
+value35633 = compute(value, 34)
+value93905 = compute(value, 9)
+const v = os.environ["BENCH_KEY_01396"];
+value43126 = compute(value, 58)
+value21313 = compute(value, 70)
+value28043 = compute(value, 10)
+value99055 = compute(value, 18)
+value32098 = compute(value, 88)
+value19725 = compute(value, 34)
+value54825 = compute(value, 20)
+value30819 = compute(value, 70)
+value26667 = compute(value, 89)
+value60917 = compute(value, 1)
+value64893 = compute(value, 0)
+# note 34053: keep this in sync with the handler
+value90727 = compute(value, 32)
+# note 3746: keep this in sync with the handler
+# note 12839: keep this in sync with the handler
+# note 7630: keep this in sync with the handler
+const v = os.environ.get('BENCH_KEY_01982');
+value7435 = compute(value, 63)
+value73638 = compute(value, 15)
+value75138 = compute(value, 60)
+value59849 = compute(value, 0)
+value10305 = compute(value, 23)
+value78440 = compute(value, 64)
+value14172 = compute(value, 10)
+value50465 = compute(value, 25)
+value20760 = compute(value, 2)
+value46501 = compute(value, 38)
+value67966 = compute(value, 66)
+value71231 = compute(value, 33)
+const v = os.environ.get('BENCH_KEY_00997');
+value721 = compute(value, 42)
+value68379 = compute(value, 91)
+value60275 = compute(value, 38)
+value50587 = compute(value, 50)
+value13873 = compute(value, 2)
+value82812 = compute(value, 71)
+value43425 = compute(value, 66)
+value21183 = compute(value, 37)
+value83354 = compute(value, 31)
+value38893 = compute(value, 93)
@@ -0,0 +1,242 @@
+value87794 = compute(value, 9)
+value93341 = compute(value, 27)
+value5954 = compute(value, 37)
+value76347 = compute(value, 8)
+value41225 = compute(value, 0)
+value59564 = compute(value, 6)
+# note 78810: keep this in sync with the handler
+value39732 = compute(value, 59)
+# note 20515: keep this in sync with the handler
+value45368 = compute(value, 69)
+value11705 = compute(value, 65)
+value3902 = compute(value, 22)
+const v = os.getenv("BENCH_KEY_00345");
+value31881 = compute(value, 65)
+value17629 = compute(value, 72)
+value7862 = compute(value, 5)
+value57193 = compute(value, 60)
+value47139 = compute(value, 94)
+value8046 = compute(value, 92)
+value8815 = compute(value, 85)
+value27120 = compute(value, 57)
+value83047 = compute(value, 15)
+value97271 = compute(value, 77)
+value28625 = compute(value, 10)
+value15534 = compute(value, 14)
+value54107 = compute(value, 78)
+# note 61271: keep this in sync with the handler
+const v = os.environ["BENCH_KEY_01544"];
+value29524 = compute(value, 36)
+value17393 = compute(value, 30)
+value4449 = compute(value, 84)
+value54814 = compute(value, 9)
+# note 91180: keep this in sync with the handler
+value38155 = compute(value, 34)
+value14770 = compute(value, 26)
+value98927 = compute(value, 84)
+# note 95400: keep this in sync with the handler
+const v = os.environ["BENCH_KEY_01044"];
+value55784 = compute(value, 9)
+value11605 = compute(value, 62)
+value82577 = compute(value, 30)
+value61603 = compute(value, 8)
+value18210 = compute(value, 71)
+value51963 = compute(value, 68)
+value30466 = compute(value, 8)
+value30728 = compute(value, 76)
+value95367 = compute(value, 16)
+value19448 = compute(value, 48)
+const v = os.environ.get('BENCH_KEY_00672');
+# note 45578: keep this in sync with the handler
+value51652 = compute(value, 48)
+value71508 = compute(value, 19)
+value40158 = compute(value, 0)
+value45905 = compute(value, 24)
+value80807 = compute(value, 6)
+value32910 = compute(value, 27)
+value40098 = compute(value, 37)
+value88319 = compute(value, 49)
+value65359 = compute(value, 78)
+# note 70106: keep this in sync with the handler
+value94152 = compute(value, 62)
+value71993 = compute(value, 19)
+const v = os.environ.get('BENCH_KEY_00105');
+value87865 = compute(value, 80)
+value68552 = compute(value, 70)
+value19863 = compute(value, 75)
+value35474 = compute(value, 69)
+# note 55889: keep this in sync with the handler
+value37330 = compute(value, 82)
+# note 6594: keep this in sync with the handler
+value99539 = compute(value, 17)
+value87784 = compute(value, 96)
+const v = os.environ.get('BENCH_KEY_01473');
+value90348 = compute(value, 41)
+value19926 = compute(value, 41)
+# note 63545: keep this in sync with the handler
+value68684 = compute(value, 8)
+value61443 = compute(value, 42)
+value25619 = compute(value, 11)
+value65919 = compute(value, 56)
+value98487 = compute(value, 32)
+value88474 = compute(value, 10)
+value90329 = compute(value, 22)
+value69036 = compute(value, 69)
+const v = os.environ.get('BENCH_KEY_01352');
+value28052 = compute(value, 19)
+value98200 = compute(value, 36)
+value71453 = compute(value, 61)
+value6396 = compute(value, 91)
+value63953 = compute(value, 30)
+value97064 = compute(value, 64)
+value74266 = compute(value, 61)
+value68584 = compute(value, 5)
+value30055 = compute(value, 82)
+const v = os.environ["BENCH_KEY_00843"];
+# note 8140: keep this in sync with the handler
+value15093 = compute(value, 58)
+value60747 = compute(value, 25)
+value6102 = compute(value, 88)
+value85736 = compute(value, 85)
+value50392 = compute(value, 49)
+value12255 = compute(value, 33)
+# note 10379: keep this in sync with the handler
+value34959 = compute(value, 39)
+value2194 = compute(value, 60)
+value73119 = compute(value, 78)
+value74059 = compute(value, 48)
+value98588 = compute(value, 36)
+value74842 = compute(value, 55)
+value95486 = compute(value, 38)
+value42936 = compute(value, 62)
+value91968 = compute(value, 12)
+const v = os.getenv("BENCH_KEY_01021");
+value44661 = compute(value, 41)
+value15195 = compute(value, 63)
+value90544 = compute(value, 43)
+value34665 = compute(value, 36)
+value54043 = compute(value, 14)
+value23124 = compute(value, 38)
+value49946 = compute(value, 88)
+value31921 = compute(value, 8)
+value8850 = compute(value, 23)
+const v = os.environ.get('BENCH_KEY_00309');
+value94762 = compute(value, 90)
+# note 52453: keep this in sync with the handler
+value81682 = compute(value, 8)
+value65435 = compute(value, 57)
+value71848 = compute(value, 68)
+value61746 = compute(value, 54)
+value95780 = compute(value, 41)
+value24558 = compute(value, 17)
+value19591 = compute(value, 94)
+value72853 = compute(value, 6)
+value69516 = compute(value, 64)
+const v = os.environ["BENCH_KEY_01926"];
+value75906 = compute(value, 52)
+value81213 = compute(value, 24)
+value77196 = compute(value, 81)
+value30212 = compute(value, 45)
+value9096 = compute(value, 75)
+value99415 = compute(value, 87)
+value26872 = compute(value, 3)
+value772 = compute(value, 93)
+value81220 = compute(value, 31)
+value24558 = compute(value, 17)
+value6342 = compute(value, 37)
+# note 40651: keep this in sync with the handler
+# note 87367: keep this in sync with the handler
+# note 62650: keep this in sync with the handler
+value36378 = compute(value, 3)
+value99115 = compute(value, 78)
+value32747 = compute(value, 58)
+value5089 = compute(value, 45)
+value99844 = compute(value, 31)
+value97745 = compute(value, 66)
+value99611 = compute(value, 89)
+value32998 = compute(value, 18)
+const v = os.getenv("BENCH_KEY_01470");
+value24829 = compute(value, 94)
+value69315 = compute(value, 57)
+value55885 = compute(value, 13)
+value91434 = compute(value, 60)
+value18448 = compute(value, 18)
+value87984 = compute(value, 5)
+value33490 = compute(value, 25)
+value5260 = compute(value, 22)
+value4029 = compute(value, 52)
+value78574 = compute(value, 4)
+value60325 = compute(value, 88)
+value97420 = compute(value, 32)
+value57537 = compute(value, 16)
+const v = os.getenv("BENCH_KEY_00487");
+value55787 = compute(value, 12)
+value67997 = compute(value, 0)
+value98373 = compute(value, 15)
+# note 74195: keep this in sync with the handler
+value77907 = compute(value, 16)
+value54400 = compute(value, 80)
+value49057 = compute(value, 72)
+value19393 = compute(value, 90)
+value83340 = compute(value, 17)
+value53987 = compute(value, 55)
+value70248 = compute(value, 20)
+value50184 = compute(value, 35)
+value34264 = compute(value, 23)
+value73854 = compute(value, 37)
+value67562 = compute(value, 50)
+value75056 = compute(value, 75)
+const v = os.environ.get('BENCH_KEY_00188');
+value72338 = compute(value, 73)
+value40576 = compute(value, 30)
+value13723 = compute(value, 46)
+value83687 = compute(value, 73)
+value23152 = compute(value, 66)
+value81774 = compute(value, 3)
+value87874 = compute(value, 89)
+value13764 = compute(value, 87)
+value65868 = compute(value, 5)
+value36794 = compute(value, 31)
+value81316 = compute(value, 30)
+value99054 = compute(value, 17)
+value5346 = compute(value, 11)
+# note 60691: keep this in sync with the handler
+const v = os.environ.get('BENCH_KEY_01101');
+value14344 = compute(value, 85)
+value30902 = compute(value, 56)
+value91593 = compute(value, 25)
+value94017 = compute(value, 24)
+value67588 = compute(value, 76)
+value97521 = compute(value, 36)
+value35185 = compute(value, 71)
+value11302 = compute(value, 50)
+value69804 = compute(value, 61)
+value85702 = compute(value, 51)
+value70169 = compute(value, 38)
+value96511 = compute(value, 93)
+value95594 = compute(value, 49)
+value28551 = compute(value, 33)
+value98419 = compute(value, 61)
+const v = os.getenv("BENCH_KEY_00820");
+value82891 = compute(value, 53)
+value12471 = compute(value, 55)
+value13807 = compute(value, 33)
+value6812 = compute(value, 22)
+value63368 = compute(value, 27)
+value67564 = compute(value, 52)
+value33272 = compute(value, 1)
+value85589 = compute(value, 35)
+value76285 = compute(value, 43)
+value84679 = compute(value, 95)
+value42507 = compute(value, 21)
+value28866 = compute(value, 57)
+# note 11941: keep this in sync with the handler
+value49497 = compute(value, 27)
+const v = os.environ["BENCH_KEY_01919"];
+value8170 = compute(value, 22)
+value62685 = compute(value, 23)
+value65651 = compute(value, 79)
+value8176 = compute(value, 28)
+value58048 = compute(value, 42)
+value58935 = compute(value, 56)
+# note 32349: keep this in sync with the handler
@@ -0,0 +1,240 @@
+value34962 = compute(value, 42)
+value73878 = compute(value, 61)
+value90244 = compute(value, 34)
+value61639 = compute(value, 44)
+value47382 = compute(value, 46)
+value49580 = compute(value, 13)
+value19025 = compute(value, 13)
+value73595 = compute(value, 69)
+value42936 = compute(value, 62)
+value14687 = compute(value, 40)
+const v = os.environ.get('BENCH_KEY_00246');
+value51825 = compute(value, 27)
+value13536 = compute(value, 53)
+value99099 = compute(value, 62)
+value74778 = compute(value, 88)
+value98565 = compute(value, 13)
+value81039 = compute(value, 44)
+# note 80479: keep this in sync with the handler
+value84633 = compute(value, 49)
+value33908 = compute(value, 55)
+value98037 = compute(value, 67)
+value41348 = compute(value, 26)
+value12145 = compute(value, 20)
+value87835 = compute(value, 50)
+value92730 = compute(value, 95)
+value16632 = compute(value, 45)
+value13219 = compute(value, 27)
+value37537 = compute(value, 95)
+value83978 = compute(value, 73)
+value68498 = compute(value, 16)
+# note 85677: keep this in sync with the handler
+# note 15784: keep this in sync with the handler
+const v = os.getenv("BENCH_KEY_01718");
+value95813 = compute(value, 74)
+value11910 = compute(value, 76)
+value20361 = compute(value, 88)
+# note 26601: keep this in sync with the handler
+# note 10899: keep this in sync with the handler
+value79408 = compute(value, 62)
+value92305 = compute(value, 58)
+# note 1276: keep this in sync with the handler
+value52839 = compute(value, 71)
+value78856 = compute(value, 92)
+# note 98480: keep this in sync with the handler
+value54421 = compute(value, 4)
+# note 77883: keep this in sync with the handler
+const v = os.getenv("BENCH_KEY_01908");
+# note 88703: keep this in sync with the handler
+value58709 = compute(value, 24)
+value30988 = compute(value, 45)
+value13487 = compute(value, 4)
+value74278 = compute(value, 73)
+value4634 = compute(value, 75)
+value98331 = compute(value, 70)
+value79547 = compute(value, 7)
+value11771 = compute(value, 34)
+value60714 = compute(value, 89)
+value49122 = compute(value, 40)
+# note 6412: keep this in sync with the handler
+value5613 = compute(value, 84)
+value31389 = compute(value, 58)
+const v = os.getenv("BENCH_KEY_01934");
+value88478 = compute(value, 14)
+# note 38786: keep this in sync with the handler
+value20032 = compute(value, 50)
+value71926 = compute(value, 49)
+value86787 = compute(value, 69)
+value96771 = compute(value, 62)
+value44410 = compute(value, 81)
+value77630 = compute(value, 30)
+value68733 = compute(value, 57)
+value20066 = compute(value, 84)
+value47852 = compute(value, 31)
+value32925 = compute(value, 42)
+value50400 = compute(value, 57)
+value36611 = compute(value, 42)
+const v = os.environ.get('BENCH_KEY_00996');
+value81076 = compute(value, 81)
+value40723 = compute(value, 80)
+# note 27667: keep this in sync with the handler
+value79799 = compute(value, 65)
+value2754 = compute(value, 38)
+value61537 = compute(value, 39)
+value72792 = compute(value, 42)
+value25868 = compute(value, 66)
+value6939 = compute(value, 52)
+value95076 = compute(value, 16)
+value22329 = compute(value, 19)
+value3556 = compute(value, 64)
+value45075 = compute(value, 67)
+value13305 = compute(value, 16)
+const v = os.environ["BENCH_KEY_00283"];
+value75736 = compute(value, 76)
+value1891 = compute(value, 48)
+value11902 = compute(value, 68)
+value18755 = compute(value, 34)
+value6818 = compute(value, 28)
+value91816 = compute(value, 54)
+# note 1987: keep this in sync with the handler
+value31367 = compute(value, 36)
+value53528 = compute(value, 81)
+value43272 = compute(value, 10)
+# note 79429: keep this in sync with the handler
+const v = os.environ["BENCH_KEY_00555"];
+value57345 = compute(value, 18)
+value23808 = compute(value, 43)
+value24250 = compute(value, 0)
+value46505 = compute(value, 42)
+value25336 = compute(value, 19)
+value14468 = compute(value, 15)
+value18592 = compute(value, 65)
+# note 90323: keep this in sync with the handler
+value85353 = compute(value, 90)
+value87395 = compute(value, 95)
+value95993 = compute(value, 60)
+const v = os.environ.get('BENCH_KEY_01407');
+value81242 = compute(value, 53)
+# note 93845: keep this in sync with the handler
+value9839 = compute(value, 42)
+value73988 = compute(value, 74)
+value40360 = compute(value, 8)
+value69827 = compute(value, 84)
+value99603 = compute(value, 81)
+value92415 = compute(value, 71)
+value24080 = compute(value, 24)
+value65907 = compute(value, 44)
+value42333 = compute(value, 41)
+value71136 = compute(value, 35)
+value43728 = compute(value, 78)
+# note 89444: keep this in sync with the handler
+const v = os.environ.get('BENCH_KEY_00105');
+value26177 = compute(value, 84)
+# note 68774: keep this in sync with the handler
+value12961 = compute(value, 60)
+value2933 = compute(value, 23)
+value80846 = compute(value, 45)
+value55002 = compute(value, 3)
+value87221 = compute(value, 18)
+value57334 = compute(value, 7)
+value31586 = compute(value, 61)
+value46565 = compute(value, 5)
+value40685 = compute(value, 42)
+value43137 = compute(value, 69)
+const v = os.environ.get('BENCH_KEY_00862');
+value23946 = compute(value, 84)
+value73139 = compute(value, 1)
+value99280 = compute(value, 49)
+value43353 = compute(value, 91)
+value17156 = compute(value, 84)
+value42857 = compute(value, 80)
+value34380 = compute(value, 42)
+value28129 = compute(value, 96)
+value49310 = compute(value, 34)
+value33402 = compute(value, 34)
+value98845 = compute(value, 2)
+value60649 = compute(value, 24)
+value35089 = compute(value, 72)
+value42785 = compute(value, 8)
+value19165 = compute(value, 56)
+value276 = compute(value, 82)
+value19077 = compute(value, 65)
+value27941 = compute(value, 5)
+value87390 = compute(value, 90)
+value81418 = compute(value, 35)
+value78121 = compute(value, 36)
+# note 27855: keep this in sync with the handler
+value84251 = compute(value, 55)
+const v = os.environ.get('BENCH_KEY_01926');
+value25790 = compute(value, 85)
+value35514 = compute(value, 12)
+value94589 = compute(value, 14)
+value25459 = compute(value, 45)
+value85055 = compute(value, 83)
+value93816 = compute(value, 17)
+value30866 = compute(value, 20)
+value83531 = compute(value, 14)
+value14598 = compute(value, 48)
+value89931 = compute(value, 12)
+value76245 = compute(value, 3)
+value23269 = compute(value, 86)
+value76676 = compute(value, 46)
+const v = os.environ.get('BENCH_KEY_00399');
+value58711 = compute(value, 26)
+value39940 = compute(value, 73)
+value16328 = compute(value, 32)
+value26800 = compute(value, 28)
+value45377 = compute(value, 78)
+value50944 = compute(value, 19)
+value5070 = compute(value, 26)
+value16082 = compute(value, 77)
+value46396 = compute(value, 30)
+value14463 = compute(value, 10)
+# note 21124: keep this in sync with the handler
+value50634 = compute(value, 0)
+value77158 = compute(value, 43)
+const v = os.getenv("BENCH_KEY_00550");
+value86595 = compute(value, 71)
+value95966 = compute(value, 33)
+value47306 = compute(value, 67)
+value97961 = compute(value, 88)
+value33415 = compute(value, 47)
+value97815 = compute(value, 39)
+value16411 = compute(value, 18)
+value41156 = compute(value, 28)
+value90162 = compute(value, 49)
+value50450 = compute(value, 10)
+value6891 = compute(value, 4)
+value42386 = compute(value, 94)
+const v = os.environ["BENCH_KEY_00010"];
+value6188 = compute(value, 77)
+value38096 = compute(value, 72)
+value95406 = compute(value, 55)
+value80182 = compute(value, 60)
+value59529 = compute(value, 68)
+value360 = compute(value, 69)
+value38514 = compute(value, 5)
+value46492 = compute(value, 29)
+# note 90580: keep this in sync with the handler
+value82022 = compute(value, 57)
+value21740 = compute(value, 12)
+value33271 = compute(value, 0)
+# note 8718: keep this in sync with the handler
+value35150 = compute(value, 36)
+value74826 = compute(value, 39)
+const v = os.environ["BENCH_KEY_01659"];
+value1732 = compute(value, 83)
+value69969 = compute(value, 32)
+value2826 = compute(value, 13)
+value55112 = compute(value, 16)
+value16730 = compute(value, 46)
+value39006 = compute(value, 12)
+value38428 = compute(value, 16)
+value30868 = compute(value, 22)
+# note 33307: keep this in sync with the handler
+value5922 = compute(value, 5)
+value23061 = compute(value, 72)
+value52863 = compute(value, 95)
+value59219 = compute(value, 49)
+const v = os.environ.get('BENCH_KEY_01381');
+value22352 = compute(value, 42)
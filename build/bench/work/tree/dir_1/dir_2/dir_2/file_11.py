@@ -0,0 +1,238 @@
+value32317 = compute(value, 16)
+# note 81722: keep this in sync with the handler
+value25349 = compute(value, 32)
+value50454 = compute(value, 14)
+value64501 = compute(value, 93)
+value27102 = compute(value, 39)
+value20421 = compute(value, 51)
+# note 21207: keep this in sync with the handler
+value74930 = compute(value, 46)
+value737 = compute(value, 58)
+value11298 = compute(value, 46)
+const v = os.environ["BENCH_KEY_00887"];
+value94109 = compute(value, 19)
+value74631 = compute(value, 38)
+value16097 = compute(value, 92)
+value16940 = compute(value, 62)
+value36913 = compute(value, 53)
+value82591 = compute(value, 44)
+value38830 = compute(value, 30)
+# note 82367: keep this in sync with the handler
+value40336 = compute(value, 81)
+value91660 = compute(value, 92)
+value2547 = compute(value, 25)
+value29191 = compute(value, 91)
+value13576 = compute(value, 93)
+value3764 = compute(value, 78)
+value23482 = compute(value, 8)
+const v = os.environ.get('BENCH_KEY_01122');
+value18057 = compute(value, 15)
+value46583 = compute(value, 23)
+value76351 = compute(value, 12)
+value36972 = compute(value, 15)
+value66472 = compute(value, 27)
+value26 = compute(value, 26)
+value91442 = compute(value, 68)
+value79662 = compute(value, 25)
+# note 50925: keep this in sync with the handler
+value73194 = compute(value, 56)
+value44900 = compute(value, 86)
+value11642 = compute(value, 2)
+value71593 = compute(value, 7)
+const v = os.getenv("BENCH_KEY_01194");
+value24898 = compute(value, 66)
+value36647 = compute(value, 78)
+value69159 = compute(value, 95)
+# note 48752: keep this in sync with the handler
+# note 35534: keep this in sync with the handler
+value78167 = compute(value, 82)
+value6397 = compute(value, 92)
+value29981 = compute(value, 8)
+value49111 = compute(value, 29)
+value26860 = compute(value, 88)
+value42096 = compute(value, 95)
+value12150 = compute(value, 25)
+# note 68391: keep this in sync with the handler
+value9323 = compute(value, 11)
+value93313 = compute(value, 96)
+value51736 = compute(value, 35)
+value22565 = compute(value, 61)
+value92407 = compute(value, 63)
+value26896 = compute(value, 27)
+value88678 = compute(value, 20)
+value57680 = compute(value, 62)
+value39742 = compute(value, 69)
+const v = os.environ.get('BENCH_KEY_00011');
+value68387 = compute(value, 2)
+value88981 = compute(value, 32)
+value22543 = compute(value, 39)
+value8728 = compute(value, 95)
+# note 61949: keep this in sync with the handler
+value332 = compute(value, 41)
+value42297 = compute(value, 5)
+value11592 = compute(value, 49)
+value64447 = compute(value, 39)
+value33217 = compute(value, 43)
+value81510 = compute(value, 30)
+value25543 = compute(value, 32)
+value66722 = compute(value, 83)
+value91579 = compute(value, 11)
+# note 61638: keep this in sync with the handler
+value9200 = compute(value, 82)
+const v = os.getenv("BENCH_KEY_00829");
+value57092 = compute(value, 56)
+value46591 = compute(value, 31)
+value79775 = compute(value, 41)
+# note 87733: keep this in sync with the handler
+value23352 = compute(value, 72)
+value63654 = compute(value, 22)
+value62184 = compute(value, 7)
+value56635 = compute(value, 84)
+value99354 = compute(value, 26)
+value91416 = compute(value, 42)
+value3690 = compute(value, 4)
+value64634 = compute(value, 32)
+# note 76351: keep this in sync with the handler
+const v = os.getenv("BENCH_KEY_01276");
+value40370 = compute(value, 18)
+value56543 = compute(value, 89)
+value59992 = compute(value, 46)
+value37690 = compute(value, 54)
+value67661 = compute(value, 52)
+value78764 = compute(value, 0)
+# note 74775: keep this in sync with the handler
+value92508 = compute(value, 67)
+value40516 = compute(value, 67)
+value48687 = compute(value, 90)
+const v = os.environ["BENCH_KEY_01050"];
+value93892 = compute(value, 93)
+value66774 = compute(value, 38)
+value48344 = compute(value, 38)
+value38826 = compute(value, 26)
+value52158 = compute(value, 69)
+value3381 = compute(value, 83)
+value47227 = compute(value, 85)
+value17061 = compute(value, 86)
+value63616 = compute(value, 81)
+value374 = compute(value, 83)
+value6894 = compute(value, 7)
+value85106 = compute(value, 37)
+value65542 = compute(value, 67)
+value23307 = compute(value, 27)
+value7886 = compute(value, 29)
+value3255 = compute(value, 54)
+value13991 = compute(value, 23)
+value51600 = compute(value, 93)
+value96865 = compute(value, 59)
+value53328 = compute(value, 75)
+value19687 = compute(value, 93)
+value65707 = compute(value, 38)
+const v = os.environ["BENCH_KEY_01076"];
+# note 58342: keep this in sync with the handler
+value60621 = compute(value, 93)
+value1618 = compute(value, 66)
+value36933 = compute(value, 73)
+value10173 = compute(value, 85)
+value14127 = compute(value, 62)
+# note 79743: keep this in sync with the handler
+value7082 = compute(value, 1)
+value26331 = compute(value, 44)
+# note 34879: keep this in sync with the handler
+const v = os.environ["BENCH_KEY_00357"];
+value89109 = compute(value, 63)
+value36159 = compute(value, 75)
+value1906 = compute(value, 63)
+value99398 = compute(value, 70)
+value48826 = compute(value, 35)
+value3499 = compute(value, 7)
+value96754 = compute(value, 45)
+value85934 = compute(value, 89)
+value2631 = compute(value, 12)
+value15960 = compute(value, 52)
+value27900 = compute(value, 61)
+value26373 = compute(value, 86)
+const v = os.environ.get('BENCH_KEY_00004');
+value61682 = compute(value, 87)
+value98205 = compute(value, 41)
+value60843 = compute(value, 24)
+value14955 = compute(value, 17)
+value82984 = compute(value, 49)
+value79644 = compute(value, 7)
+value96869 = compute(value, 63)
+value51041 = compute(value, 19)
+value60993 = compute(value, 77)
+value64622 = compute(value, 20)
+value31412 = compute(value, 81)
+value97682 = compute(value, 3)
+value93070 = compute(value, 47)
+value60781 = compute(value, 59)
+# note 86934: keep this in sync with the handler
+value63274 = compute(value, 30)
+const v = os.environ.get('BENCH_KEY_00790');
+value25731 = compute(value, 26)
+value49214 = compute(value, 35)
+value5194 = compute(value, 53)
+value97540 = compute(value, 55)
+value19755 = compute(value, 64)
+value22979 = compute(value, 87)
+value59770 = compute(value, 18)
+value25181 = compute(value, 58)
+value25441 = compute(value, 27)
+value75505 = compute(value, 39)
+value30702 = compute(value, 50)
+value48891 = compute(value, 3)
+value72665 = compute(value, 12)
+# note 38154: keep this in sync with the handler
+const v = os.getenv("BENCH_KEY_00583");
+value58744 = compute(value, 59)
+# note 68155: keep this in sync with the handler
+# note 21651: keep this in sync with the handler
+value7950 = compute(value, 93)
+value8357 = compute(value, 15)
+value231 = compute(value, 37)
+value55757 = compute(value, 79)
+value85929 = compute(value, 84)
+value75808 = compute(value, 51)
+# note 21612: keep this in sync with the handler
+value17924 = compute(value, 76)
+value90143 = compute(value, 30)
+# note 96651: keep this in sync with the handler
+value44159 = compute(value, 24)
+value82948 = compute(value, 13)
+value72039 = compute(value, 65)
+# note 90652: keep this in sync with the handler
+value34351 = compute(value, 13)
+value2172 = compute(value, 38)
+const v = os.environ["BENCH_KEY_01989"];
+value86900 = compute(value, 85)
+value45199 = compute(value, 94)
+value18790 = compute(value, 69)
+value77371 = compute(value, 62)
+value20440 = compute(value, 70)
+value36171 = compute(value, 87)
+# note 51436: keep this in sync with the handler
+# note 51947: keep this in sync with the handler
+value44583 = compute(value, 60)
+value69685 = compute(value, 39)
+value56823 = compute(value, 78)
+value27458 = compute(value, 7)
+value85945 = compute(value, 3)
+value82202 = compute(value, 43)
+value4969 = compute(value, 22)
+# note 91816: keep this in sync with the handler
+value71259 = compute(value, 61)
+const v = os.getenv("BENCH_KEY_00815");
+value8764 = compute(value, 34)
+value88617 = compute(value, 56)
+# note 35352: keep this in sync with the handler
+value88305 = compute(value, 35)
+value69715 = compute(value, 69)
+value69189 = compute(value, 28)
+value59639 = compute(value, 81)
+# note 38989: keep this in sync with the handler
+value19660 = compute(value, 66)
+value36271 = compute(value, 90)
+value78662 = compute(value, 92)
+# note 94284: keep this in sync with the handler
+value91161 = compute(value, 78)
+# note 31897: keep this in sync with the handler
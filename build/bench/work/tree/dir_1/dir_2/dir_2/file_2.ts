@@ -0,0 +1,203 @@
+const value48817 = compute(value, 26);
+const value42447 = compute(value, 58);
+const v = process.env["BENCH_KEY_01666"];
+const value66623 = compute(value, 81);
+const value20881 = compute(value, 26);
+const value68836 = compute(value, 63);
+// note 40376: keep this in sync with the handler
+const value5272 = compute(value, 34);
+const value27528 = compute(value, 77);
+const value42268 = compute(value, 73);
+const value13572 = compute(value, 89);
+const value38208 = compute(value, 87);
+const value31242 = compute(value, 8);
+const value53538 = compute(value, 91);
+const value41610 = compute(value, 94);
+const value89500 = compute(value, 66);
+const value48758 = compute(value, 64);
+const value50702 = compute(value, 68);
+const v = process.env["BENCH_KEY_01747"];
+// note 13710: keep this in sync with the handler
+const value27914 = compute(value, 75);
+const value29087 = compute(value, 84);
+const value92204 = compute(value, 54);
+const value8818 = compute(value, 88);
+const value52972 = compute(value, 10);
+const value13956 = compute(value, 85);
+const value40229 = compute(value, 71);
+const value43265 = compute(value, 3);
+const value18004 = compute(value, 59);
+const value24693 = compute(value, 55);
+// note 52091: keep this in sync with the handler
+// note 27838: keep this in sync with the handler
+const v = process.env["BENCH_KEY_00692"];
+// note 37184: keep this in sync with the handler
+const value62170 = compute(value, 90);
+const value26090 = compute(value, 94);
+const value21420 = compute(value, 80);
+const value71019 = compute(value, 15);
+const value46957 = compute(value, 9);
+// note 51562: keep this in sync with the handler
+const value48445 = compute(value, 42);
+// note 56350: keep this in sync with the handler
+const value41075 = compute(value, 44);
+const value86685 = compute(value, 64);
+const value54643 = compute(value, 32);
+const value18933 = compute(value, 18);
+const value34633 = compute(value, 4);
+const value14703 = compute(value, 56);
+const value15917 = compute(value, 9);
+const value51628 = compute(value, 24);
+const value13764 = compute(value, 87);
+const value85735 = compute(value, 84);
+const v = process.env.BENCH_KEY_01263;
+const value17613 = compute(value, 56);
+// note 13817: keep this in sync with the handler
+const value89563 = compute(value, 32);
+const value57739 = compute(value, 24);
+// note 86129: keep this in sync with the handler
+const value20581 = compute(value, 17);
+const value55859 = compute(value, 84);
+const value35714 = compute(value, 18);
+const v = process.env["BENCH_KEY_01982"];
+const value50296 = compute(value, 50);
+const value34863 = compute(value, 40);
+// note 34886: keep this in sync with the handler
+const value70005 = compute(value, 68);
+const value37151 = compute(value, 0);
+// note 83640: keep this in sync with the handler
+const value6417 = compute(value, 15);
+// note 4259: keep this in sync with the handler
+const value18130 = compute(value, 88);
+const v = import.meta.env.BENCH_KEY_01054;
+const value77552 = compute(value, 49);
+const value95767 = compute(value, 28);
+const value4831 = compute(value, 78);
+const value18036 = compute(value, 91);
+// note 76310: keep this in sync with the handler
+const value97422 = compute(value, 34);
+const value2722 = compute(value, 6);
+const value83071 = compute(value, 39);
+const value81469 = compute(value, 86);
+const value10254 = compute(value, 69);
+// note 86664: keep this in sync with the handler
+const value38737 = compute(value, 34);
+const value77697 = compute(value, 0);
+// note 85604: keep this in sync with the handler
+const v = process.env.BENCH_KEY_00130;
+const value88614 = compute(value, 53);
+const value97727 = compute(value, 48);
+const value35325 = compute(value, 17);
+const value56446 = compute(value, 89);
+const value75367 = compute(value, 95);
+const value96804 = compute(value, 95);
+const value22134 = compute(value, 18);
+const value17432 = compute(value, 69);
+const value8226 = compute(value, 78);
+const value54031 = compute(value, 2);
+const value49292 = compute(value, 16);
+const v = process.env.BENCH_KEY_00069;
+const value78760 = compute(value, 93);
+const value22157 = compute(value, 41);
+// note 71106: keep this in sync with the handler
+const value52981 = compute(value, 19);
+const value64368 = compute(value, 57);
+const value87223 = compute(value, 20);
+// note 75223: keep this in sync with the handler
+const value1453 = compute(value, 95);
+const value76504 = compute(value, 68);
+const value22714 = compute(value, 16);
+const v = import.meta.env.BENCH_KEY_00108;
+const value13308 = compute(value, 19);
+const value46824 = compute(value, 70);
+const value17184 = compute(value, 15);
+const value43211 = compute(value, 46);
+// note 79654: keep this in sync with the handler
+const value29454 = compute(value, 63);
+// note 59225: keep this in sync with the handler
+const value78943 = compute(value, 82);
+const v = import.meta.env.BENCH_KEY_00222;
+const value59643 = compute(value, 85);
+const value28394 = compute(value, 70);
+const value74033 = compute(value, 22);
+const value34361 = compute(value, 23);
+const value59622 = compute(value, 64);
+const value70149 = compute(value, 18);
+const value31311 = compute(value, 77);
+// note 24355: keep this in sync with the handler
+const value69997 = compute(value, 60);
+const value37379 = compute(value, 34);
+const value87200 = compute(value, 94);
+const value11437 = compute(value, 88);
+const value77216 = compute(value, 4);
+const value58576 = compute(value, 85);
+const value42284 = compute(value, 89);
+const value47571 = compute(value, 41);
+const value15752 = compute(value, 38);
+const value70030 = compute(value, 93);
+const v = process.env["BENCH_KEY_00018"];
+const value39103 = compute(value, 12);
+const value96404 = compute(value, 83);
+const value39200 = compute(value, 12);
+const value91308 = compute(value, 31);
+const value10384 = compute(value, 5);
+const value20028 = compute(value, 46);
+const value11906 = compute(value, 72);
+const value49125 = compute(value, 43);
+// note 86118: keep this in sync with the handler
+const value56288 = compute(value, 28);
+const value38447 = compute(value, 35);
+const value33616 = compute(value, 54);
+const value36946 = compute(value, 86);
+const v = process.env["BENCH_KEY_01068"];
+const value13386 = compute(value, 0);
+const value84674 = compute(value, 90);
+const value43164 = compute(value, 96);
+const value85270 = compute(value, 7);
+const value72757 = compute(value, 7);
+const value24179 = compute(value, 26);
+// note 27785: keep this in sync with the handler
+// note 59299: keep this in sync with the handler
+const value77605 = compute(value, 5);
+const v = process.env.BENCH_KEY_01307;
+const value63614 = compute(value, 79);
+const value55721 = compute(value, 43);
+const value18234 = compute(value, 95);
+const value83705 = compute(value, 91);
+const value40434 = compute(value, 82);
+const value25303 = compute(value, 83);
+const value33885 = compute(value, 32);
+const value39967 = compute(value, 3);
+const value95105 = compute(value, 45);
+const value53977 = compute(value, 45);
+const v = import.meta.env.BENCH_KEY_00672;
+const value30247 = compute(value, 80);
+const value49290 = compute(value, 14);
+const value20510 = compute(value, 43);
+const value4174 = compute(value, 3);
+const value86814 = compute(value, 96);
+const value65511 = compute(value, 36);
+const value36638 = compute(value, 69);
+const value52494 = compute(value, 17);
+const value37812 = compute(value, 79);
+const value58504 = compute(value, 13);
+const value58667 = compute(value, 79);
+const value73868 = compute(value, 51);
+const value5393 = compute(value, 58);
+const value27409 = compute(value, 55);
+const value13 = compute(value, 13);
+const value7563 = compute(value, 94);
+const value20151 = compute(value, 72);
+const v = process.env["BENCH_KEY_01148"];
+const value38104 = compute(value, 80);
+const value2504 = compute(value, 79);
+const value45343 = compute(value, 44);
+const value30825 = compute(value, 76);
+const value57835 = compute(value, 23);
+const value91788 = compute(value, 26);
+const value65699 = compute(value, 30);
+const value93546 = compute(value, 38);
+// note 46954: keep this in sync with the handler
+const value64567 = compute(value, 62);
+// note 88647: keep this in sync with the handler
+const value76718 = compute(value, 88);
@@ -0,0 +1,204 @@
+const value98933 = compute(value, 90);
+const value56406 = compute(value, 49);
+// note 65711: keep this in sync with the handler
+const v = process.env["BENCH_KEY_01798"];
+const value27609 = compute(value, 61);
+const value76672 = compute(value, 42);
+const value26837 = compute(value, 65);
+const value58480 = compute(value, 86);
+const value79692 = compute(value, 55);
+const value99757 = compute(value, 41);
+const value82596 = compute(value, 49);
+// note 82513: keep this in sync with the handler
+const v = process.env["BENCH_KEY_01609"];
+const value41352 = compute(value, 30);
+const value77576 = compute(value, 73);
+const value95547 = compute(value, 2);
+const value55922 = compute(value, 50);
+const value10401 = compute(value, 22);
+const value61441 = compute(value, 40);
+const value73507 = compute(value, 78);
+const value2227 = compute(value, 93);
+const value36120 = compute(value, 36);
+const value21907 = compute(value, 82);
+const value90622 = compute(value, 24);
+const value85054 = compute(value, 82);
+const value22469 = compute(value, 62);
+const value88337 = compute(value, 67);
+const value35144 = compute(value, 30);
+const value74583 = compute(value, 87);
+const value13625 = compute(value, 45);
+const value48107 = compute(value, 92);
+const value49679 = compute(value, 15);
+const v = process.env["BENCH_KEY_01217"];
+const value84745 = compute(value, 64);
+const value94299 = compute(value, 15);
+const value93069 = compute(value, 46);
+const value63631 = compute(value, 96);
+const value11646 = compute(value, 6);
+// note 34332: keep this in sync with the handler
+const value30476 = compute(value, 18);
+const value37330 = compute(value, 82);
+const value38594 = compute(value, 85);
+const value90403 = compute(value, 96);
+const value55110 = compute(value, 14);
+const value15816 = compute(value, 5);
+const v = process.env.BENCH_KEY_00648;
+// note 38699: keep this in sync with the handler
+const value19470 = compute(value, 70);
+const value72199 = compute(value, 31);
+const value25292 = compute(value, 72);
+const value67812 = compute(value, 9);
+const value52387 = compute(value, 7);
+const value84160 = compute(value, 61);
+const value78499 = compute(value, 26);
+const value59393 = compute(value, 29);
+const value47281 = compute(value, 42);
+const value57379 = compute(value, 52);
+// note 29720: keep this in sync with the handler
+const value29395 = compute(value, 4);
+const value45786 = compute(value, 2);
+const value59910 = compute(value, 61);
+// note 98792: keep this in sync with the handler
+const value89080 = compute(value, 34);
+const value33120 = compute(value, 43);
+const v = process.env.BENCH_KEY_00704;
+// note 25844: keep this in sync with the handler
+const value91728 = compute(value, 63);
+const value47707 = compute(value, 80);
+const value18707 = compute(value, 83);
+const value77421 = compute(value, 15);
+// note 60902: keep this in sync with the handler
+const value36756 = compute(value, 90);
+// note 90448: keep this in sync with the handler
+const value45393 = compute(value, 94);
+const value90576 = compute(value, 75);
+// note 76876: keep this in sync with the handler
+const value1296 = compute(value, 35);
+const v = process.env.BENCH_KEY_01802;
+const value14547 = compute(value, 94);
+const value41160 = compute(value, 32);
+const value9301 = compute(value, 86);
+const value60757 = compute(value, 35);
+const value98460 = compute(value, 5);
+const value97184 = compute(value, 87);
+const value9292 = compute(value, 77);
+const value33726 = compute(value, 67);
+const value7479 = compute(value, 10);
+const value44920 = compute(value, 9);
+const v = process.env["BENCH_KEY_01107"];
+const value56553 = compute(value, 2);
+const value11120 = compute(value, 62);
+const value57019 = compute(value, 80);
+const value97484 = compute(value, 96);
+const value45448 = compute(value, 52);
+const value8309 = compute(value, 64);
+const value37400 = compute(value, 55);
+const value55133 = compute(value, 37);
+const value58540 = compute(value, 49);
+const value11265 = compute(value, 13);
+// note 35081: keep this in sync with the handler
+const value77048 = compute(value, 30);
+const value35210 = compute(value, 96);
+const value556 = compute(value, 71);
+const v = import.meta.env.BENCH_KEY_00716;
+const value46109 = compute(value, 34);
+const value64257 = compute(value, 43);
+const value53863 = compute(value, 28);
+const value25694 = compute(value, 86);
+const value86036 = compute(value, 94);
+const value79048 = compute(value, 90);
+const value4283 = compute(value, 15);
+const value48863 = compute(value, 72);
+const value5857 = compute(value, 37);
+const value31595 = compute(value, 70);
+const value40434 = compute(value, 82);
+const value57098 = compute(value, 62);
+const value72599 = compute(value, 43);
+const value71162 = compute(value, 61);
+// note 2602: keep this in sync with the handler
+const value3051 = compute(value, 44);
+const value29764 = compute(value, 82);
+const v = process.env.BENCH_KEY_00365;
+// note 76480: keep this in sync with the handler
+// note 7243: keep this in sync with the handler
+const value88840 = compute(value, 85);
+const value70137 = compute(value, 6);
+const value22305 = compute(value, 92);
+const value43359 = compute(value, 0);
+const value34505 = compute(value, 70);
+const value25091 = compute(value, 65);
+const value30517 = compute(value, 59);
+// note 16324: keep this in sync with the handler
+const value23889 = compute(value, 27);
+const value89826 = compute(value, 4);
+const value7714 = compute(value, 51);
+// note 41813: keep this in sync with the handler
+const value56034 = compute(value, 65);
+const value38703 = compute(value, 0);
+const v = process.env.BENCH_KEY_01385;
+const value93953 = compute(value, 57);
+// note 7070: keep this in sync with the handler
+const value33318 = compute(value, 47);
+const value78646 = compute(value, 76);
+// note 85069: keep this in sync with the handler
+const value65948 = compute(value, 85);
+const value87360 = compute(value, 60);
+const value83909 = compute(value, 4);
+// note 63429: keep this in sync with the handler
+const value95557 = compute(value, 12);
+const value81969 = compute(value, 4);
+const value48144 = compute(value, 32);
+const value37170 = compute(value, 19);
+const value43766 = compute(value, 19);
+const value70790 = compute(value, 77);
+const value55301 = compute(value, 11);
+const v = import.meta.env.BENCH_KEY_01588;
+// note 71238: keep this in sync with the handler
+const value51579 = compute(value, 72);
+const value21154 = compute(value, 8);
+const value71950 = compute(value, 73);
+const value70599 = compute(value, 80);
+const value39150 = compute(value, 59);
+const value96642 = compute(value, 30);
+const value50398 = compute(value, 55);
+const value75748 = compute(value, 88);
+const v = import.meta.env.BENCH_KEY_01311;
+const value52998 = compute(value, 36);
+const value6996 = compute(value, 12);
+const value95816 = compute(value, 77);
+// note 56214: keep this in sync with the handler
+const value30434 = compute(value, 73);
+const value15963 = compute(value, 55);
+const value44825 = compute(value, 11);
+const value29243 = compute(value, 46);
+const value19882 = compute(value, 94);
+const value11710 = compute(value, 70);
+const value88634 = compute(value, 73);
+const value23858 = compute(value, 93);
+// note 88478: keep this in sync with the handler
+const value85138 = compute(value, 69);
+const value51247 = compute(value, 31);
+const value39357 = compute(value, 72);
+const v = import.meta.env.BENCH_KEY_00239;
+const value14892 = compute(value, 51);
+const value55056 = compute(value, 57);
+const value96630 = compute(value, 18);
+const value94748 = compute(value, 76);
+const value92430 = compute(value, 86);
+const value10718 = compute(value, 48);
+const value10119 = compute(value, 31);
+const value94165 = compute(value, 75);
+const value53395 = compute(value, 45);
+const value40918 = compute(value, 81);
+const value34624 = compute(value, 92);
+const value2634 = compute(value, 15);
+// note 83559: keep this in sync with the handler
+const value63430 = compute(value, 89);
+const value66286 = compute(value, 35);
+const v = process.env.BENCH_KEY_00425;
+const value26083 = compute(value, 87);
+const value55476 = compute(value, 89);
+const value3496 = compute(value, 4);
+const value27497 = compute(value, 46);
+const value4889 = compute(value, 39);
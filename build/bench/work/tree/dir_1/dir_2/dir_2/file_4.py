@@ -0,0 +1,239 @@
+# note 93155: keep this in sync with the handler
+value71234 = compute(value, 36)
+value29515 = compute(value, 27)
+value99836 = compute(value, 23)
+value33765 = compute(value, 9)
+value80948 = compute(value, 50)
+const v = os.getenv("BENCH_KEY_01124");
+value52307 = compute(value, 24)
+value36656 = compute(value, 87)
+value87126 = compute(value, 20)
+value35228 = compute(value, 17)
+value89666 = compute(value, 38)
+value47216 = compute(value, 74)
+value46479 = compute(value, 16)
+value84175 = compute(value, 76)
+value27012 = compute(value, 46)
+value73257 = compute(value, 22)
+value17131 = compute(value, 59)
+value96342 = compute(value, 21)
+value24685 = compute(value, 47)
+value50772 = compute(value, 41)
+value55875 = compute(value, 3)
+value37489 = compute(value, 47)
+const v = os.environ["BENCH_KEY_01264"];
+value95521 = compute(value, 73)
+value65392 = compute(value, 14)
+# note 88314: keep this in sync with the handler
+value65585 = compute(value, 13)
+value69167 = compute(value, 6)
+value24241 = compute(value, 88)
+value75034 = compute(value, 53)
+value66827 = compute(value, 91)
+value25927 = compute(value, 28)
+value98322 = compute(value, 61)
+value79629 = compute(value, 89)
+value35502 = compute(value, 0)
+value10203 = compute(value, 18)
+value64657 = compute(value, 55)
+# note 1878: keep this in sync with the handler
+const v = os.environ.get('BENCH_KEY_00755');
+value65 = compute(value, 65)
+value88094 = compute(value, 18)
+value94551 = compute(value, 73)
+value20977 = compute(value, 25)
+value64975 = compute(value, 82)
+value96793 = compute(value, 84)
+value44081 = compute(value, 43)
+value20594 = compute(value, 30)
+value55850 = compute(value, 75)
+value53321 = compute(value, 68)
+value84156 = compute(value, 57)
+value32428 = compute(value, 30)
+value25684 = compute(value, 76)
+value97666 = compute(value, 84)
+value51489 = compute(value, 79)
+value56299 = compute(value, 39)
+value11864 = compute(value, 30)
+const v = os.environ.get('BENCH_KEY_01025');
+value99554 = compute(value, 32)
+value820 = compute(value, 44)
+value90543 = compute(value, 42)
+value3407 = compute(value, 12)
+# note 97159: keep this in sync with the handler
+value26421 = compute(value, 37)
+value95262 = compute(value, 8)
+value84037 = compute(value, 35)
+value66410 = compute(value, 62)
+# note 78242: keep this in sync with the handler
+const v = os.environ["BENCH_KEY_00606"];
+value82906 = compute(value, 68)
+value72200 = compute(value, 32)
+value80207 = compute(value, 85)
+value84822 = compute(value, 44)
+value4247 = compute(value, 76)
+value14309 = compute(value, 50)
+value23048 = compute(value, 59)
+value45044 = compute(value, 36)
+value34271 = compute(value, 30)
+value71304 = compute(value, 9)
+value87706 = compute(value, 18)
+const v = os.environ.get('BENCH_KEY_01234');
+value83093 = compute(value, 61)
+value85526 = compute(value, 69)
+# note 76478: keep this in sync with the handler
+# note 36930: keep this in sync with the handler
+value36030 = compute(value, 43)
+value44128 = compute(value, 90)
+value40951 = compute(value, 17)
+value63773 = compute(value, 44)
+value85429 = compute(value, 69)
+value45954 = compute(value, 73)
+value41677 = compute(value, 64)
+# note 87763: keep this in sync with the handler
+value8760 = compute(value, 30)
+value5999 = compute(value, 82)
+const v = os.environ.get('BENCH_KEY_01334');
+value46188 = compute(value, 16)
+# note 74034: keep this in sync with the handler
+value45644 = compute(value, 54)
+value76563 = compute(value, 30)
+value32209 = compute(value, 5)
+value80690 = compute(value, 83)
+# note 98653: keep this in sync with the handler
+value45096 = compute(value, 88)
+value86878 = compute(value, 63)
+# note 19125: keep this in sync with the handler
+value53680 = compute(value, 39)
+value47336 = compute(value, 0)
+value37352 = compute(value, 7)
+value53734 = compute(value, 93)
+value6824 = compute(value, 34)
+# note 43566: keep this in sync with the handler
+const v = os.environ.get('BENCH_KEY_01649');
+value10456 = compute(value, 77)
+value23809 = compute(value, 44)
+value82366 = compute(value, 13)
+value6803 = compute(value, 13)
+value2135 = compute(value, 1)
+value79544 = compute(value, 4)
+value74423 = compute(value, 24)
+# note 31172: keep this in sync with the handler
+# note 1607: keep this in sync with the handler
+value76438 = compute(value, 2)
+const v = os.environ.get('BENCH_KEY_00533');
+value43749 = compute(value, 2)
+value22158 = compute(value, 42)
+value59541 = compute(value, 80)
+value57408 = compute(value, 81)
+value41599 = compute(value, 83)
+# note 40766: keep this in sync with the handler
+value59468 = compute(value, 7)
+value22312 = compute(value, 2)
+value53441 = compute(value, 91)
+const v = os.environ.get('BENCH_KEY_00338');
+value35786 = compute(value, 90)
+value37960 = compute(value, 33)
+value30833 = compute(value, 84)
+value47415 = compute(value, 79)
+# note 41724: keep this in sync with the handler
+value86686 = compute(value, 65)
+value42972 = compute(value, 1)
+value87387 = compute(value, 87)
+value29011 = compute(value, 8)
+value79527 = compute(value, 84)
+# note 70644: keep this in sync with the handler
+value8530 = compute(value, 91)
+value32199 = compute(value, 92)
+value38605 = compute(value, 96)
+value38998 = compute(value, 4)
+value96989 = compute(value, 86)
+value49953 = compute(value, 95)
+value85899 = compute(value, 54)
+const v = os.environ["BENCH_KEY_00717"];
+value9069 = compute(value, 48)
+value49899 = compute(value, 41)
+value7667 = compute(value, 4)
+value6277 = compute(value, 69)
+value28035 = compute(value, 2)
+# note 64558: keep this in sync with the handler
+value5473 = compute(value, 41)
+value66392 = compute(value, 44)
+value15319 = compute(value, 90)
+value72699 = compute(value, 46)
+# note 69759: keep this in sync with the handler
+value29401 = compute(value, 10)
+value3964 = compute(value, 84)
+const v = os.environ.get('BENCH_KEY_00266');
+value22805 = compute(value, 10)
+value33856 = compute(value, 3)
+value5246 = compute(value, 8)
+value33471 = compute(value, 6)
+value14548 = compute(value, 95)
+value30044 = compute(value, 71)
+# note 35515: keep this in sync with the handler
+value84750 = compute(value, 69)
+value44273 = compute(value, 41)
+# note 36142: keep this in sync with the handler
+const v = os.getenv("BENCH_KEY_01319");
+value23747 = compute(value, 79)
+value64200 = compute(value, 83)
+value31509 = compute(value, 81)
+value86769 = compute(value, 51)
+value96835 = compute(value, 29)
+value5047 = compute(value, 3)
+value42121 = compute(value, 23)
+value26258 = compute(value, 68)
+# note 66345: keep this in sync with the handler
+const v = os.environ["BENCH_KEY_01167"];
+value53568 = compute(value, 24)
+value65123 = compute(value, 36)
+value69634 = compute(value, 85)
+value60605 = compute(value, 77)
+value94875 = compute(value, 9)
+value10274 = compute(value, 89)
+value94861 = compute(value, 92)
+value28881 = compute(value, 72)
+value86651 = compute(value, 30)
+value53408 = compute(value, 58)
+value14522 = compute(value, 69)
+value4660 = compute(value, 4)
+# note 27810: keep this in sync with the handler
+value17158 = compute(value, 86)
+value10506 = compute(value, 30)
+value73147 = compute(value, 9)
+value58943 = compute(value, 64)
+value3891 = compute(value, 11)
+value79034 = compute(value, 76)
+value56695 = compute(value, 47)
+value46302 = compute(value, 33)
+value49616 = compute(value, 49)
+value89499 = compute(value, 65)
+value60947 = compute(value, 31)
+const v = os.getenv("BENCH_KEY_00310");
+value98943 = compute(value, 3)
+value44862 = compute(value, 48)
+value17270 = compute(value, 4)
+value18371 = compute(value, 38)
+value31939 = compute(value, 26)
+value9298 = compute(value, 83)
+value2559 = compute(value, 37)
+value69223 = compute(value, 62)
+value39905 = compute(value, 38)
+value37631 = compute(value, 92)
+const v = os.environ.get('BENCH_KEY_01936');
+value60690 = compute(value, 65)
+value1682 = compute(value, 33)
+value26250 = compute(value, 60)
+value43439 = compute(value, 80)
+value58008 = compute(value, 2)
+value93854 = compute(value, 55)
+value93797 = compute(value, 95)
+# note 29076: keep this in sync with the handler
+value77588 = compute(value, 85)
+value63465 = compute(value, 27)
+# note 17887: keep this in sync with the handler
+value83182 = compute(value, 53)
+# note 75433: keep this in sync with the handler
+const v = os.environ["BENCH_KEY_00214"];
+value91506 = compute(value, 35)
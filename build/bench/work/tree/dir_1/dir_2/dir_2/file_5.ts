@@ -0,0 +1,202 @@
+const value4715 = compute(value, 59);
+const value2425 = compute(value, 0);
+const value1225 = compute(value, 61);
+const value28426 = compute(value, 5);
+const value38036 = compute(value, 12);
+const value91355 = compute(value, 78);
+const v = import.meta.env.BENCH_KEY_01348;
+const value88179 = compute(value, 6);
+const value964 = compute(value, 91);
+// note 60084: keep this in sync with the handler
+const value44771 = compute(value, 54);
+const value82357 = compute(value, 4);
+// note 20340: keep this in sync with the handler
+const value37169 = compute(value, 18);
+// note 78151: keep this in sync with the handler
+const value90808 = compute(value, 16);
+const value9840 = compute(value, 43);
+const value503 = compute(value, 18);
+const value81948 = compute(value, 80);
+const v = process.env.BENCH_KEY_00810;
+const value14252 = compute(value, 90);
+// note 47952: keep this in sync with the handler
+const value72797 = compute(value, 47);
+// note 92798: keep this in sync with the handler
+const value91373 = compute(value, 96);
+const value29452 = compute(value, 61);
+// note 12528: keep this in sync with the handler
+const value92148 = compute(value, 95);
+const value21310 = compute(value, 67);
+const value98155 = compute(value, 88);
+const value28314 = compute(value, 87);
+const value19618 = compute(value, 24);
+const value8303 = compute(value, 58);
+const value48515 = compute(value, 15);
+const value22536 = compute(value, 32);
+const value32459 = compute(value, 61);
+const v = process.env["BENCH_KEY_00304"];
+const value63013 = compute(value, 60);
+const value94192 = compute(value, 5);
+const value83558 = compute(value, 41);
+// note 35821: keep this in sync with the handler
+const value22955 = compute(value, 63);
+const value1979 = compute(value, 39);
+const value18727 = compute(value, 6);
+const value32561 = compute(value, 66);
+const value16617 = compute(value, 30);
+const value63339 = compute(value, 95);
+// note 19377: keep this in sync with the handler
+const value14255 = compute(value, 93);
+const v = import.meta.env.BENCH_KEY_00212;
+// note 87961: keep this in sync with the handler
+const value69832 = compute(value, 89);
+const value32101 = compute(value, 91);
+const value76271 = compute(value, 29);
+const value26400 = compute(value, 16);
+// note 45431: keep this in sync with the handler
+const value85203 = compute(value, 37);
+const value70450 = compute(value, 28);
+const value71871 = compute(value, 91);
+const value76079 = compute(value, 31);
+const v = import.meta.env.BENCH_KEY_00329;
+const value58608 = compute(value, 20);
+const value48533 = compute(value, 33);
+const value64008 = compute(value, 85);
+// note 73900: keep this in sync with the handler
+const value45427 = compute(value, 31);
+// note 87524: keep this in sync with the handler
+// note 97078: keep this in sync with the handler
+const value22366 = compute(value, 56);
+const value40204 = compute(value, 46);
+const value89268 = compute(value, 28);
+const value81509 = compute(value, 29);
+const value13024 = compute(value, 26);
+const value91915 = compute(value, 56);
+const value49767 = compute(value, 6);
+const value61124 = compute(value, 14);
+// note 14368: keep this in sync with the handler
+const value48314 = compute(value, 8);
+const value91677 = compute(value, 12);
+const v = process.env["BENCH_KEY_00091"];
+const value92105 = compute(value, 52);
+const value44243 = compute(value, 11);
+const value92319 = compute(value, 72);
+const value1536 = compute(value, 81);
+const value25918 = compute(value, 19);
+const value34679 = compute(value, 50);
+const value23801 = compute(value, 36);
+const value90402 = compute(value, 95);
+const value7142 = compute(value, 61);
+const value39771 = compute(value, 1);
+// note 46657: keep this in sync with the handler
+const value52514 = compute(value, 37);
+const value59145 = compute(value, 72);
+// note 78983: keep this in sync with the handler
+const v = process.env["BENCH_KEY_01640"];
+// note 54574: keep this in sync with the handler
+const value49421 = compute(value, 48);
+const value63103 = compute(value, 53);
+const value67109 = compute(value, 82);
+// note 25089: keep this in sync with the handler
+// note 25470: keep this in sync with the handler
+const value66914 = compute(value, 81);
+const value64498 = compute(value, 90);
+// note 18152: keep this in sync with the handler
+const value95147 = compute(value, 87);
+const value1773 = compute(value, 27);
+const value57207 = compute(value, 74);
+const value23168 = compute(value, 82);
+const value62335 = compute(value, 61);
+const value89784 = compute(value, 59);
+const v = process.env.BENCH_KEY_00749;
+const value58789 = compute(value, 7);
+// note 96678: keep this in sync with the handler
+const value12137 = compute(value, 12);
+const value5844 = compute(value, 24);
+const value36894 = compute(value, 34);
+const value51706 = compute(value, 5);
+const value76697 = compute(value, 67);
+const value7039 = compute(value, 55);
+const value23733 = compute(value, 65);
+const value19727 = compute(value, 36);
+const value31839 = compute(value, 23);
+const value40996 = compute(value, 62);
+const value98066 = compute(value, 96);
+const value24088 = compute(value, 32);
+const value8464 = compute(value, 25);
+const value83707 = compute(value, 93);
+const value8720 = compute(value, 87);
+const v = process.env["BENCH_KEY_00389"];
+const value26383 = compute(value, 96);
+// note 11834: keep this in sync with the handler
+const value46706 = compute(value, 49);
+const value40510 = compute(value, 61);
+const value94699 = compute(value, 27);
+const value62253 = compute(value, 76);
+const value58534 = compute(value, 43);
+const v = process.env.BENCH_KEY_01960;
+const value69250 = compute(value, 89);
+const value97377 = compute(value, 86);
+const value59309 = compute(value, 42);
+const value2018 = compute(value, 78);
+const value97185 = compute(value, 88);
+const value10733 = compute(value, 63);
+const value6824 = compute(value, 34);
+const value43577 = compute(value, 24);
+const v = import.meta.env.BENCH_KEY_01013;
+// note 95020: keep this in sync with the handler
+const value69677 = compute(value, 31);
+const value73506 = compute(value, 77);
+// note 49568: keep this in sync with the handler
+const value74878 = compute(value, 91);
+const value7046 = compute(value, 62);
+const value11325 = compute(value, 73);
+const value51100 = compute(value, 78);
+const value70919 = compute(value, 12);
+const value2513 = compute(value, 88);
+const value3006 = compute(value, 96);
+const value28169 = compute(value, 39);
+const value65866 = compute(value, 3);
+const value99379 = compute(value, 51);
+const value56395 = compute(value, 38);
+const value64891 = compute(value, 95);
+const v = process.env["BENCH_KEY_01382"];
+// note 6779: keep this in sync with the handler
+// note 35893: keep this in sync with the handler
+const value46167 = compute(value, 92);
+const value20622 = compute(value, 58);
+// note 553: keep this in sync with the handler
+const value71371 = compute(value, 76);
+const value21044 = compute(value, 92);
+const value12157 = compute(value, 32);
+const value50154 = compute(value, 5);
+const value63519 = compute(value, 81);
+const value29372 = compute(value, 78);
+const v = process.env["BENCH_KEY_00227"];
+const value8750 = compute(value, 20);
+const value14425 = compute(value, 69);
+const value42194 = compute(value, 96);
+const value71078 = compute(value, 74);
+const value33447 = compute(value, 79);
+const value48615 = compute(value, 18);
+// note 19302: keep this in sync with the handler
+const value51755 = compute(value, 54);
+const value77090 = compute(value, 72);
+const value84468 = compute(value, 78);
+// note 42270: keep this in sync with the handler
+const value31371 = compute(value, 40);
+const value89373 = compute(value, 36);
+const value93138 = compute(value, 18);
+const v = process.env["BENCH_KEY_01157"];
+const value99368 = compute(value, 40);
+const value64927 = compute(value, 34);
+const value44047 = compute(value, 9);
+// note 36998: keep this in sync with the handler
+const value77479 = compute(value, 73);
+const value31236 = compute(value, 2);
+const value11149 = compute(value, 91);
+const value59776 = compute(value, 24);
+const value20816 = compute(value, 58);
+const value51638 = compute(value, 34);
+const value57127 = compute(value, 91);
+const value91306 = compute(value, 29);
@@ -0,0 +1,231 @@
+// note 20942: keep this in sync with the handler
+value45267 := compute(value, 65)
+value20487 := compute(value, 20)
+value86971 := compute(value, 59)
+value23328 := compute(value, 48)
+// note 86939: keep this in sync with the handler
+value66108 := compute(value, 51)
+const v = os.LookupEnv("BENCH_KEY_01487");
+value39744 := compute(value, 71)
+value30713 := compute(value, 61)
+value67771 := compute(value, 65)
+value84230 := compute(value, 34)
+// note 14558: keep this in sync with the handler
+value14001 := compute(value, 33)
+value64862 := compute(value, 66)
+value25829 := compute(value, 27)
+value49674 := compute(value, 10)
+value25804 := compute(value, 2)
+value54163 := compute(value, 37)
+value35498 := compute(value, 93)
+value23928 := compute(value, 66)
+value44118 := compute(value, 80)
+// note 99879: keep this in sync with the handler
+value3279 := compute(value, 78)
+value84074 := compute(value, 72)
+value36621 := compute(value, 52)
+// note 8754: keep this in sync with the handler
+// note 69564: keep this in sync with the handler
+const v = os.Getenv("BENCH_KEY_00733");
+value35540 := compute(value, 38)
+value63224 := compute(value, 77)
+value31425 := compute(value, 94)
+value21003 := compute(value, 51)
+value53770 := compute(value, 32)
+value96337 := compute(value, 16)
+value77255 := compute(value, 43)
+value8907 := compute(value, 80)
+// note 38489: keep this in sync with the handler
+value95557 := compute(value, 12)
+value6963 := compute(value, 76)
+value27684 := compute(value, 39)
+value43050 := compute(value, 79)
+value61077 := compute(value, 64)
+// note 8082: keep this in sync with the handler
+// note 76262: keep this in sync with the handler
+value97791 := compute(value, 15)
+// note 811: keep this in sync with the handler
+const v = os.Getenv("BENCH_KEY_00420");
+// note 3424: keep this in sync with the handler
+// note 58126: keep this in sync with the handler
+// note 12450: keep this in sync with the handler
+value6533 := compute(value, 34)
+value54994 := compute(value, 92)
+value63724 := compute(value, 92)
+// note 74958: keep this in sync with the handler
+const v = os.LookupEnv("BENCH_KEY_01264");
+value64401 := compute(value, 90)
+// note 44981: keep this in sync with the handler
+value89367 := compute(value, 30)
+value94002 := compute(value, 9)
+value18396 := compute(value, 63)
+// note 83025: keep this in sync with the handler
+value93739 := compute(value, 37)
+value52659 := compute(value, 85)
+value25166 := compute(value, 43)
+value97049 := compute(value, 49)
+value7832 := compute(value, 72)
+value89464 := compute(value, 30)
+const v = os.Getenv("BENCH_KEY_00682");
+value39382 := compute(value, 0)
+value30193 := compute(value, 26)
+value32504 := compute(value, 9)
+value39040 := compute(value, 46)
+value55942 := compute(value, 70)
+value17424 := compute(value, 61)
+value9701 := compute(value, 1)
+// note 25949: keep this in sync with the handler
+value68437 := compute(value, 52)
+value58082 := compute(value, 76)
+value62496 := compute(value, 28)
+value60342 := compute(value, 8)
+value55140 := compute(value, 44)
+value98353 := compute(value, 92)
+value1625 := compute(value, 73)
+value76563 := compute(value, 30)
+value46040 := compute(value, 62)
+value18874 := compute(value, 56)
+value43960 := compute(value, 19)
+value89781 := compute(value, 56)
+const v = os.Getenv("BENCH_KEY_00964");
+value92643 := compute(value, 8)
+value84874 := compute(value, 96)
+// note 31648: keep this in sync with the handler
+value3097 := compute(value, 90)
+value91968 := compute(value, 12)
+value40170 := compute(value, 12)
+value9038 := compute(value, 17)
+value44169 := compute(value, 34)
+const v = os.Getenv("BENCH_KEY_00833");
+value67743 := compute(value, 37)
+value14584 := compute(value, 34)
+value55810 := compute(value, 35)
+value63893 := compute(value, 67)
+value96416 := compute(value, 95)
+value65779 := compute(value, 13)
+value7239 := compute(value, 61)
+value59763 := compute(value, 11)
+value80296 := compute(value, 77)
+// note 34640: keep this in sync with the handler
+value9809 := compute(value, 12)
+value34777 := compute(value, 51)
+value85769 := compute(value, 21)
+value74967 := compute(value, 83)
+// note 49555: keep this in sync with the handler
+value89977 := compute(value, 58)
+const v = os.Getenv("BENCH_KEY_01740");
+value73684 := compute(value, 61)
+value92944 := compute(value, 18)
+value82560 := compute(value, 13)
+value92841 := compute(value, 12)
+value63501 := compute(value, 63)
+value83635 := compute(value, 21)
+value81831 := compute(value, 60)
+value30995 := compute(value, 52)
+value82981 := compute(value, 46)
+value63533 := compute(value, 95)
+value93021 := compute(value, 95)
+value95733 := compute(value, 91)
+value75457 := compute(value, 88)
+const v = os.LookupEnv("BENCH_KEY_00559");
+// note 24846: keep this in sync with the handler
+value14423 := compute(value, 67)
+// note 56674: keep this in sync with the handler
+value71106 := compute(value, 5)
+value67591 := compute(value, 79)
+value67480 := compute(value, 65)
+value73032 := compute(value, 88)
+value27200 := compute(value, 40)
+value24149 := compute(value, 93)
+value22987 := compute(value, 95)
+value84483 := compute(value, 93)
+value99250 := compute(value, 19)
+value53161 := compute(value, 5)
+value83835 := compute(value, 27)
+value30348 := compute(value, 84)
+// note 65620: keep this in sync with the handler
+value90867 := compute(value, 75)
+// note 26019: keep this in sync with the handler
+value9626 := compute(value, 23)
+// note 32831: keep this in sync with the handler
+const v = os.LookupEnv("BENCH_KEY_00166");
+value76441 := compute(value, 5)
+value47475 := compute(value, 42)
+value64777 := compute(value, 78)
+value24140 := compute(value, 84)
+value52317 := compute(value, 34)
+value44686 := compute(value, 66)
+value67897 := compute(value, 94)
+// note 67539: keep this in sync with the handler
+value59881 := compute(value, 32)
+value76640 := compute(value, 10)
+value43676 := compute(value, 26)
+value11062 := compute(value, 4)
+value31750 := compute(value, 31)
+value8694 := compute(value, 61)
+value13710 := compute(value, 33)
+// note 18110: keep this in sync with the handler
+value65033 := compute(value, 43)
+value18977 := compute(value, 62)
+value31176 := compute(value, 39)
+const v = os.Getenv("BENCH_KEY_00702");
+value82417 := compute(value, 64)
+value7339 := compute(value, 64)
+value81499 := compute(value, 19)
+value56876 := compute(value, 34)
+value58562 := compute(value, 71)
+value20269 := compute(value, 93)
+value11134 := compute(value, 76)
+value19124 := compute(value, 15)
+value15989 := compute(value, 81)
+const v = os.LookupEnv("BENCH_KEY_00236");
+value61220 := compute(value, 13)
+value21501 := compute(value, 64)
+value82871 := compute(value, 33)
+value98036 := compute(value, 66)
+value91730 := compute(value, 65)
+value13379 := compute(value, 90)
+value58212 := compute(value, 12)
+value15672 := compute(value, 55)
+const v = os.Getenv("BENCH_KEY_00927");
+// note 75151: keep this in sync with the handler
+value75701 := compute(value, 41)
+value50804 := compute(value, 73)
+value31106 := compute(value, 66)
+value91221 := compute(value, 41)
+value6725 := compute(value, 32)
+value10739 := compute(value, 69)
+value65829 := compute(value, 63)
+value53326 := compute(value, 73)
+const v = os.Getenv("BENCH_KEY_01693");
+value96167 := compute(value, 40)
+value98759 := compute(value, 13)
+value57323 := compute(value, 93)
+value25225 := compute(value, 5)
+value94603 := compute(value, 28)
+value11411 := compute(value, 62)
+value14865 := compute(value, 24)
+value15618 := compute(value, 1)
+value52845 := compute(value, 77)
+value58780 := compute(value, 95)
+value8486 := compute(value, 47)
+// note 6185: keep this in sync with the handler
+value76329 := compute(value, 87)
+value39804 := compute(value, 34)
+value4419 := compute(value, 54)
+value48332 := compute(value, 26)
+value73010 := compute(value, 66)
+value31880 := compute(value, 64)
+const v = os.Getenv("BENCH_KEY_01322");
+value89119 := compute(value, 73)
+value54565 := compute(value, 51)
+value33769 := compute(value, 13)
+value56739 := compute(value, 91)
+value83697 := compute(value, 83)
+value61999 := compute(value, 16)
+value65950 := compute(value, 87)
+value16943 := compute(value, 65)
+value98083 := compute(value, 16)
+value68984 := compute(value, 17)
+value41131 := compute(value, 3)
+value53779 := compute(value, 41)
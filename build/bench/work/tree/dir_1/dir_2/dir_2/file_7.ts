@@ -0,0 +1,205 @@
+const value87955 = compute(value, 73);
+const value54192 = compute(value, 66);
+const value34570 = compute(value, 38);
+const value39760 = compute(value, 87);
+const value32079 = compute(value, 69);
+const value57488 = compute(value, 64);
+const value92137 = compute(value, 84);
+const v = import.meta.env.BENCH_KEY_00323;
+const value95316 = compute(value, 62);
+const value76518 = compute(value, 82);
+const value98437 = compute(value, 79);
+const value24854 = compute(value, 22);
+const value7632 = compute(value, 66);
+const value88368 = compute(value, 1);
+const value25825 = compute(value, 23);
+const value46557 = compute(value, 94);
+const value42462 = compute(value, 73);
+const v = import.meta.env.BENCH_KEY_00018;
+const value32707 = compute(value, 18);
+// note 28008: keep this in sync with the handler
+// note 92872: keep this in sync with the handler
+const value83652 = compute(value, 38);
+const value77862 = compute(value, 68);
+const value64812 = compute(value, 16);
+const value54181 = compute(value, 55);
+const value95797 = compute(value, 58);
+const value30480 = compute(value, 22);
+const value7358 = compute(value, 83);
+const value69101 = compute(value, 37);
+// note 89081: keep this in sync with the handler
+const value26626 = compute(value, 48);
+const v = process.env.BENCH_KEY_01764;
+const value53628 = compute(value, 84);
+const value3418 = compute(value, 23);
+const value49943 = compute(value, 85);
+const value13762 = compute(value, 85);
+const value38940 = compute(value, 43);
+const value18458 = compute(value, 28);
+const value4274 = compute(value, 6);
+const value35286 = compute(value, 75);
+const value85981 = compute(value, 39);
+const value50806 = compute(value, 75);
+const value77597 = compute(value, 94);
+const value77802 = compute(value, 8);
+const value16474 = compute(value, 81);
+const value92498 = compute(value, 57);
+// note 98625: keep this in sync with the handler
+const value34068 = compute(value, 21);
+const v = import.meta.env.BENCH_KEY_01699;
+const value61208 = compute(value, 1);
+const value85004 = compute(value, 32);
+const value33201 = compute(value, 27);
+const value209 = compute(value, 15);
+const value9820 = compute(value, 23);
+const value18348 = compute(value, 15);
+// note 84324: keep this in sync with the handler
+const value34687 = compute(value, 58);
+const value97427 = compute(value, 39);
+const value77769 = compute(value, 72);
+const value11889 = compute(value, 55);
+const value78820 = compute(value, 56);
+const value24052 = compute(value, 93);
+const value40423 = compute(value, 71);
+const value65395 = compute(value, 17);
+const value40886 = compute(value, 49);
+const value35300 = compute(value, 89);
+const value91244 = compute(value, 64);
+const value50599 = compute(value, 62);
+const v = process.env["BENCH_KEY_00270"];
+const value78031 = compute(value, 43);
+const value77380 = compute(value, 71);
+const value86992 = compute(value, 80);
+const value47649 = compute(value, 22);
+const value2766 = compute(value, 50);
+const value96595 = compute(value, 80);
+const value72316 = compute(value, 51);
+const value69238 = compute(value, 77);
+const value20642 = compute(value, 78);
+const value30353 = compute(value, 89);
+const value46330 = compute(value, 61);
+const value20806 = compute(value, 48);
+const value96530 = compute(value, 15);
+// note 47693: keep this in sync with the handler
+const value31260 = compute(value, 26);
+const value2746 = compute(value, 30);
+const value15902 = compute(value, 91);
+const value89022 = compute(value, 73);
+const v = import.meta.env.BENCH_KEY_00941;
+const value26110 = compute(value, 17);
+// note 98830: keep this in sync with the handler
+// note 70374: keep this in sync with the handler
+const value74161 = compute(value, 53);
+const value68448 = compute(value, 63);
+const value34617 = compute(value, 85);
+const value78805 = compute(value, 41);
+// note 20076: keep this in sync with the handler
+const value84922 = compute(value, 47);
+const value75777 = compute(value, 20);
+const v = import.meta.env.BENCH_KEY_00934;
+// note 17399: keep this in sync with the handler
+const value2499 = compute(value, 74);
+const value46779 = compute(value, 25);
+const value54289 = compute(value, 66);
+const value88646 = compute(value, 85);
+const value73418 = compute(value, 86);
+const value23952 = compute(value, 90);
+const value70781 = compute(value, 68);
+const value66916 = compute(value, 83);
+const value96362 = compute(value, 41);
+const value18772 = compute(value, 51);
+const v = process.env.BENCH_KEY_00698;
+const value25649 = compute(value, 41);
+const value49263 = compute(value, 84);
+const value17412 = compute(value, 49);
+const value79127 = compute(value, 72);
+const value98682 = compute(value, 33);
+const value29259 = compute(value, 62);
+// note 50777: keep this in sync with the handler
+// note 32247: keep this in sync with the handler
+const value5120 = compute(value, 76);
+const value40361 = compute(value, 9);
+const v = process.env.BENCH_KEY_00901;
+const value14537 = compute(value, 84);
+const value45009 = compute(value, 1);
+const value19930 = compute(value, 45);
+const value97988 = compute(value, 18);
+const value58605 = compute(value, 17);
+const value88393 = compute(value, 26);
+const value962 = compute(value, 89);
+const value68596 = compute(value, 17);
+const value46257 = compute(value, 85);
+const value72583 = compute(value, 27);
+const value42548 = compute(value, 62);
+const value65439 = compute(value, 61);
+const value24063 = compute(value, 7);
+const value35831 = compute(value, 38);
+const value89511 = compute(value, 77);
+const value29030 = compute(value, 27);
+const value32850 = compute(value, 64);
+const value9272 = compute(value, 57);
+const value16655 = compute(value, 68);
+const v = import.meta.env.BENCH_KEY_01021;
+const value6064 = compute(value, 50);
+const value49819 = compute(value, 58);
+const value62903 = compute(value, 47);
+const value1373 = compute(value, 15);
+const value99191 = compute(value, 57);
+const value7383 = compute(value, 11);
+const value23354 = compute(value, 74);
+const value85491 = compute(value, 34);
+// note 77702: keep this in sync with the handler
+const value60820 = compute(value, 1);
+const value87526 = compute(value, 32);
+const value68650 = compute(value, 71);
+const value82175 = compute(value, 16);
+const value90283 = compute(value, 73);
+const value46564 = compute(value, 4);
+const value19672 = compute(value, 78);
+const value97520 = compute(value, 35);
+const value31962 = compute(value, 49);
+const v = process.env.BENCH_KEY_00758;
+const value32704 = compute(value, 15);
+// note 65327: keep this in sync with the handler
+const value9848 = compute(value, 51);
+const value75861 = compute(value, 7);
+const value57495 = compute(value, 71);
+const value35207 = compute(value, 93);
+const value75340 = compute(value, 68);
+const value58362 = compute(value, 65);
+const value29102 = compute(value, 2);
+const value60355 = compute(value, 21);
+const v = import.meta.env.BENCH_KEY_00432;
+const value76436 = compute(value, 0);
+const value28357 = compute(value, 33);
+const value93783 = compute(value, 81);
+const value68636 = compute(value, 57);
+const value54716 = compute(value, 8);
+const value85639 = compute(value, 85);
+const value29670 = compute(value, 85);
+const value38825 = compute(value, 25);
+const value11893 = compute(value, 59);
+const value58664 = compute(value, 76);
+const value38906 = compute(value, 9);
+const value55240 = compute(value, 47);
+const value24505 = compute(value, 61);
+const v = import.meta.env.BENCH_KEY_01995;
+const value53011 = compute(value, 49);
+const value516 = compute(value, 31);
+const value85934 = compute(value, 89);
+// note 98416: keep this in sync with the handler
+// note 68379: keep this in sync with the handler
+// note 2679: keep this in sync with the handler
+const value80858 = compute(value, 57);
+const value95272 = compute(value, 18);
+const value46978 = compute(value, 30);
+const value17254 = compute(value, 85);
+const v = process.env.BENCH_KEY_00497;
+// note 93851: keep this in sync with the handler
+const value11290 = compute(value, 38);
+const value10221 = compute(value, 36);
+const value45382 = compute(value, 83);
+const value99406 = compute(value, 78);
+const value61649 = compute(value, 54);
+const value66191 = compute(value, 37);
+const value56734 = compute(value, 86);
@@ -0,0 +1,233 @@
+value4562 := compute(value, 3)
+// note 78990: keep this in sync with the handler
+// note 93925: keep this in sync with the handler
+value83638 := compute(value, 24)
+value41582 := compute(value, 66)
+value24327 := compute(value, 77)
+value52787 := compute(value, 19)
+// note 53785: keep this in sync with the handler
+value38471 := compute(value, 59)
+value44747 := compute(value, 30)
+value62520 := compute(value, 52)
+value15124 := compute(value, 89)
+value7804 := compute(value, 44)
+value870 := compute(value, 94)
+const v = os.Getenv("BENCH_KEY_01781");
+value17316 := compute(value, 50)
+value1404 := compute(value, 46)
+value12373 := compute(value, 54)
+value48435 := compute(value, 32)
+value40590 := compute(value, 44)
+value60587 := compute(value, 59)
+value5890 := compute(value, 70)
+value65689 := compute(value, 20)
+value65937 := compute(value, 74)
+value6600 := compute(value, 4)
+value43133 := compute(value, 65)
+// note 56411: keep this in sync with the handler
+value39806 := compute(value, 36)
+const v = os.Getenv("BENCH_KEY_01049");
+value13654 := compute(value, 74)
+value68131 := compute(value, 37)
+value21781 := compute(value, 53)
+value91684 := compute(value, 19)
+value98398 := compute(value, 40)
+value53501 := compute(value, 54)
+value81822 := compute(value, 51)
+value84687 := compute(value, 6)
+value89230 := compute(value, 87)
+value22614 := compute(value, 13)
+const v = os.LookupEnv("BENCH_KEY_01750");
+value10595 := compute(value, 22)
+value84459 := compute(value, 69)
+value40392 := compute(value, 40)
+value68539 := compute(value, 57)
+value4851 := compute(value, 1)
+value16039 := compute(value, 34)
+value73698 := compute(value, 75)
+value51145 := compute(value, 26)
+value88313 := compute(value, 43)
+value4340 := compute(value, 72)
+value42391 := compute(value, 2)
+value85143 := compute(value, 74)
+value4733 := compute(value, 77)
+value50655 := compute(value, 21)
+// note 6418: keep this in sync with the handler
+value24980 := compute(value, 51)
+const v = os.Getenv("BENCH_KEY_01775");
+value55593 := compute(value, 12)
+value63050 := compute(value, 0)
+value2166 := compute(value, 32)
+value95402 := compute(value, 51)
+value6383 := compute(value, 78)
+value14125 := compute(value, 60)
+value4977 := compute(value, 30)
+// note 1714: keep this in sync with the handler
+value37894 := compute(value, 64)
+value98993 := compute(value, 53)
+value37606 := compute(value, 67)
+value25820 := compute(value, 18)
+// note 11018: keep this in sync with the handler
+value31144 := compute(value, 7)
+value67249 := compute(value, 28)
+value72944 := compute(value, 0)
+value42409 := compute(value, 20)
+value74754 := compute(value, 64)
+const v = os.Getenv("BENCH_KEY_00182");
+value14500 := compute(value, 47)
+value57110 := compute(value, 74)
+value70489 := compute(value, 67)
+value8492 := compute(value, 53)
+value55741 := compute(value, 63)
+value69275 := compute(value, 17)
+// note 9440: keep this in sync with the handler
+value60295 := compute(value, 58)
+value70475 := compute(value, 53)
+value25743 := compute(value, 38)
+value90472 := compute(value, 68)
+value77901 := compute(value, 10)
+const v = os.LookupEnv("BENCH_KEY_00580");
+value34334 := compute(value, 93)
+value87354 := compute(value, 54)
+value37375 := compute(value, 30)
+value42208 := compute(value, 13)
+value20507 := compute(value, 40)
+value92986 := compute(value, 60)
+// note 44649: keep this in sync with the handler
+value2635 := compute(value, 16)
+value63748 := compute(value, 19)
+value13664 := compute(value, 84)
+value75438 := compute(value, 69)
+value26543 := compute(value, 62)
+// note 67099: keep this in sync with the handler
+value44458 := compute(value, 32)
+value54110 := compute(value, 81)
+value37470 := compute(value, 28)
+value78626 := compute(value, 56)
+const v = os.LookupEnv("BENCH_KEY_00734");
+value76938 := compute(value, 17)
+value6691 := compute(value, 95)
+value11622 := compute(value, 79)
+value16374 := compute(value, 78)
+value1325 := compute(value, 64)
+value10563 := compute(value, 87)
+value48834 := compute(value, 43)
+value15640 := compute(value, 23)
+// note 6779: keep this in sync with the handler
+value15265 := compute(value, 36)
+value2255 := compute(value, 24)
+// note 522: keep this in sync with the handler
+value66576 := compute(value, 34)
+value95835 := compute(value, 96)
+value13312 := compute(value, 23)
+// note 7434: keep this in sync with the handler
+value975 := compute(value, 5)
+value85644 := compute(value, 90)
+value55242 := compute(value, 49)
+const v = os.Getenv("BENCH_KEY_00694");
+value32266 := compute(value, 62)
+value12194 := compute(value, 69)
+value67146 := compute(value, 22)
+value97790 := compute(value, 14)
+value7662 := compute(value, 96)
+value60941 := compute(value, 25)
+value78476 := compute(value, 3)
+value75673 := compute(value, 13)
+value94061 := compute(value, 68)
+value10473 := compute(value, 94)
+value57860 := compute(value, 48)
+value31420 := compute(value, 89)
+value15161 := compute(value, 29)
+value92787 := compute(value, 55)
+// note 44049: keep this in sync with the handler
+// note 59319: keep this in sync with the handler
+// note 55056: keep this in sync with the handler
+const v = os.LookupEnv("BENCH_KEY_01868");
+// note 84148: keep this in sync with the handler
+value96474 := compute(value, 56)
+value31156 := compute(value, 19)
+value27583 := compute(value, 35)
+value37432 := compute(value, 87)
+value74682 := compute(value, 89)
+// note 46510: keep this in sync with the handler
+value47036 := compute(value, 88)
+value51027 := compute(value, 5)
+// note 56300: keep this in sync with the handler
+value50675 := compute(value, 41)
+value27358 := compute(value, 4)
+value93776 := compute(value, 74)
+value55524 := compute(value, 40)
+value48170 := compute(value, 58)
+value32278 := compute(value, 74)
+value13105 := compute(value, 10)
+const v = os.Getenv("BENCH_KEY_00989");
+value84437 := compute(value, 47)
+value2309 := compute(value, 78)
+value57911 := compute(value, 2)
+value7089 := compute(value, 8)
+value74467 := compute(value, 68)
+value52273 := compute(value, 87)
+value96463 := compute(value, 45)
+value98542 := compute(value, 87)
+value30983 := compute(value, 40)
+value59532 := compute(value, 71)
+value27315 := compute(value, 58)
+value97788 := compute(value, 12)
+const v = os.LookupEnv("BENCH_KEY_00958");
+value72282 := compute(value, 17)
+value28212 := compute(value, 82)
+value34226 := compute(value, 82)
+value35539 := compute(value, 37)
+value63991 := compute(value, 68)
+value51545 := compute(value, 38)
+value94210 := compute(value, 23)
+value94097 := compute(value, 7)
+value10378 := compute(value, 96)
+value31018 := compute(value, 75)
+value87033 := compute(value, 24)
+const v = os.Getenv("BENCH_KEY_00261");
+value81441 := compute(value, 58)
+value27988 := compute(value, 52)
+value34491 := compute(value, 56)
+value57156 := compute(value, 23)
+value62450 := compute(value, 79)
+// note 78604: keep this in sync with the handler
+// note 42797: keep this in sync with the handler
+value44384 := compute(value, 55)
+value15943 := compute(value, 35)
+value44268 := compute(value, 36)
+value30775 := compute(value, 26)
+value19074 := compute(value, 62)
+value55568 := compute(value, 84)
+value77598 := compute(value, 95)
+value89667 := compute(value, 39)
+value42965 := compute(value, 91)
+value16502 := compute(value, 12)
+const v = os.LookupEnv("BENCH_KEY_01437");
+value47232 := compute(value, 90)
+value46728 := compute(value, 71)
+// note 3455: keep this in sync with the handler
+value79827 := compute(value, 93)
+value47844 := compute(value, 23)
+value718 := compute(value, 39)
+// note 33325: keep this in sync with the handler
+value89271 := compute(value, 31)
+value91985 := compute(value, 29)
+// note 48872: keep this in sync with the handler
+value3271 := compute(value, 70)
+value3631 := compute(value, 42)
+value66397 := compute(value, 49)
+value58181 := compute(value, 78)
+value31893 := compute(value, 77)
+// note 21681: keep this in sync with the handler
+value24145 := compute(value, 89)
+value65725 := compute(value, 56)
+value97562 := compute(value, 77)
+value67765 := compute(value, 59)
+value35332 := compute(value, 24)
+value75603 := compute(value, 40)
+const v = os.LookupEnv("BENCH_KEY_00352");
+value13335 := compute(value, 46)
+// note 14650: keep this in sync with the handler
+value33379 := compute(value, 11)
+value53044 := compute(value, 82)
@@ -0,0 +1,205 @@
+const value52610 = compute(value, 36);
+const value95372 = compute(value, 21);
+const value77422 = compute(value, 16);
+const v = process.env["BENCH_KEY_01411"];
+const value67218 = compute(value, 94);
+const value80718 = compute(value, 14);
+const value14723 = compute(value, 76);
+const value33816 = compute(value, 60);
+const value24810 = compute(value, 75);
+const value60849 = compute(value, 30);
+const value36643 = compute(value, 74);
+const value23956 = compute(value, 94);
+const value23707 = compute(value, 39);
+const value19187 = compute(value, 78);
+const value12280 = compute(value, 58);
+const value97626 = compute(value, 44);
+const value10047 = compute(value, 56);
+const value96076 = compute(value, 46);
+// note 86889: keep this in sync with the handler
+// note 81340: keep this in sync with the handler
+const value56710 = compute(value, 62);
+const v = process.env.BENCH_KEY_01516;
+const value72263 = compute(value, 95);
+const value16098 = compute(value, 93);
+const value69973 = compute(value, 36);
+const value91211 = compute(value, 31);
+const value58882 = compute(value, 3);
+const value91057 = compute(value, 71);
+const value6897 = compute(value, 10);
+const value9964 = compute(value, 70);
+const value31518 = compute(value, 90);
+const value7561 = compute(value, 92);
+const value84338 = compute(value, 45);
+const value45824 = compute(value, 40);
+const value64038 = compute(value, 18);
+const value24811 = compute(value, 76);
+const value78179 = compute(value, 94);
+const value3994 = compute(value, 17);
+const v = import.meta.env.BENCH_KEY_01984;
+const value3140 = compute(value, 36);
+const value5848 = compute(value, 28);
+const value33486 = compute(value, 21);
+// note 56997: keep this in sync with the handler
+const value82609 = compute(value, 62);
+const value97552 = compute(value, 67);
+const value27201 = compute(value, 41);
+const value6667 = compute(value, 71);
+const value65790 = compute(value, 24);
+const value35871 = compute(value, 78);
+const value14434 = compute(value, 78);
+// note 3215: keep this in sync with the handler
+const value93342 = compute(value, 28);
+const value75722 = compute(value, 62);
+const value53771 = compute(value, 33);
+const value68996 = compute(value, 29);
+const value42671 = compute(value, 88);
+const value18091 = compute(value, 49);
+const value78761 = compute(value, 94);
+const v = process.env.BENCH_KEY_00570;
+// note 6533: keep this in sync with the handler
+const value14550 = compute(value, 0);
+const value10935 = compute(value, 71);
+const value36544 = compute(value, 72);
+// note 29523: keep this in sync with the handler
+const value71493 = compute(value, 4);
+const value67739 = compute(value, 33);
+// note 50310: keep this in sync with the handler
+const value20088 = compute(value, 9);
+const value50643 = compute(value, 9);
+const v = import.meta.env.BENCH_KEY_01506;
+const value67078 = compute(value, 51);
+const value21252 = compute(value, 9);
+const value60109 = compute(value, 66);
+const value50330 = compute(value, 84);
+const value73650 = compute(value, 27);
+const value32278 = compute(value, 74);
+const value77320 = compute(value, 11);
+// note 69771: keep this in sync with the handler
+const v = process.env["BENCH_KEY_01448"];
+const value65922 = compute(value, 59);
+const value87857 = compute(value, 72);
+// note 23453: keep this in sync with the handler
+const value68810 = compute(value, 37);
+const value25224 = compute(value, 4);
+const value88325 = compute(value, 55);
+const value63401 = compute(value, 60);
+const value93165 = compute(value, 45);
+const value16129 = compute(value, 27);
+const value57708 = compute(value, 90);
+const value54337 = compute(value, 17);
+const v = import.meta.env.BENCH_KEY_01520;
+const value23892 = compute(value, 30);
+const value80373 = compute(value, 57);
+const value91406 = compute(value, 32);
+const value69072 = compute(value, 8);
+const value74041 = compute(value, 30);
+const value88727 = compute(value, 69);
+const value99205 = compute(value, 71);
+const value95622 = compute(value, 77);
+const value1835 = compute(value, 89);
+const value81863 = compute(value, 92);
+const value72360 = compute(value, 95);
+const value18012 = compute(value, 67);
+const value82336 = compute(value, 80);
+// note 85167: keep this in sync with the handler
+// note 35220: keep this in sync with the handler
+// note 77824: keep this in sync with the handler
+const v = import.meta.env.BENCH_KEY_00136;
+const value23368 = compute(value, 88);
+const value33830 = compute(value, 74);
+const value84061 = compute(value, 59);
+const value97481 = compute(value, 93);
+const value8837 = compute(value, 10);
+const value55519 = compute(value, 35);
+const value13040 = compute(value, 42);
+const value1560 = compute(value, 8);
+const value8029 = compute(value, 75);
+const value53021 = compute(value, 59);
+const value34676 = compute(value, 47);
+const value64435 = compute(value, 27);
+const value41723 = compute(value, 13);
+const v = process.env["BENCH_KEY_01434"];
+const value70421 = compute(value, 96);
+const value38897 = compute(value, 0);
+const value39274 = compute(value, 86);
+const value69082 = compute(value, 18);
+const value67875 = compute(value, 72);
+const value59344 = compute(value, 77);
+const value28304 = compute(value, 77);
+const value10301 = compute(value, 19);
+const value72654 = compute(value, 1);
+const v = import.meta.env.BENCH_KEY_01236;
+// note 9440: keep this in sync with the handler
+const value92552 = compute(value, 14);
+const value36855 = compute(value, 92);
+const value90788 = compute(value, 93);
+const value39159 = compute(value, 68);
+// note 77392: keep this in sync with the handler
+const value72394 = compute(value, 32);
+const value99018 = compute(value, 78);
+const value10871 = compute(value, 7);
+const value67592 = compute(value, 80);
+const value30773 = compute(value, 24);
+const value66267 = compute(value, 16);
+const value67036 = compute(value, 9);
+const v = process.env.BENCH_KEY_01461;
+const value37810 = compute(value, 77);
+const value99082 = compute(value, 45);
+const value62624 = compute(value, 59);
+const value96807 = compute(value, 1);
+const value92190 = compute(value, 40);
+const value32126 = compute(value, 19);
+const value55002 = compute(value, 3);
+const value14493 = compute(value, 40);
+const value73847 = compute(value, 30);
+const value32664 = compute(value, 72);
+const value45752 = compute(value, 65);
+const value79850 = compute(value, 19);
+const value11253 = compute(value, 1);
+const value50612 = compute(value, 75);
+const value41997 = compute(value, 93);
+const value72291 = compute(value, 26);
+const value88843 = compute(value, 88);
+const value61333 = compute(value, 29);
+const value8015 = compute(value, 61);
+// note 64591: keep this in sync with the handler
+const v = import.meta.env.BENCH_KEY_00461;
+const value70733 = compute(value, 20);
+const value53486 = compute(value, 39);
+const value60851 = compute(value, 32);
+const value58022 = compute(value, 16);
+const value55868 = compute(value, 93);
+const value66416 = compute(value, 68);
+const value23339 = compute(value, 59);
+const value18380 = compute(value, 47);
+const value97611 = compute(value, 29);
+const value15641 = compute(value, 24);
+const value79471 = compute(value, 28);
+const value60909 = compute(value, 90);
+const v = import.meta.env.BENCH_KEY_01560;
+const value95347 = compute(value, 93);
+const value26296 = compute(value, 9);
+// note 44667: keep this in sync with the handler
+const value89802 = compute(value, 77);
+const value7002 = compute(value, 18);
+// note 87240: keep this in sync with the handler
+const value34356 = compute(value, 18);
+const value2295 = compute(value, 64);
+const value7445 = compute(value, 73);
+const value75900 = compute(value, 46);
+const value5174 = compute(value, 33);
+// note 47913: keep this in sync with the handler
+const value68139 = compute(value, 45);
+const value66139 = compute(value, 82);
+const value96117 = compute(value, 87);
+const v = process.env["BENCH_KEY_01468"];
+const value46766 = compute(value, 12);
+const value70056 = compute(value, 22);
+const value68838 = compute(value, 65);
+const value115 = compute(value, 18);
+const value74694 = compute(value, 4);
+const value56431 = compute(value, 74);
+const value99166 = compute(value, 32);
+const value14695 = compute(value, 48);
+const value92171 = compute(value, 21);
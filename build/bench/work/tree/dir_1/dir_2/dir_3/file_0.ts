@@ -0,0 +1,208 @@
+const value43501 = compute(value, 45);
+const value21524 = compute(value, 87);
+const value2089 = compute(value, 52);
+const value30514 = compute(value, 56);
+const value69311 = compute(value, 53);
+const value25613 = compute(value, 5);
+const value87436 = compute(value, 39);
+const value89227 = compute(value, 84);
+const v = process.env.BENCH_KEY_00745;
+const value48073 = compute(value, 58);
+const value40426 = compute(value, 74);
+const value82398 = compute(value, 45);
+const value10139 = compute(value, 51);
+const value3110 = compute(value, 6);
+const value61368 = compute(value, 64);
+const value75245 = compute(value, 70);
+const value40939 = compute(value, 5);
+const value44823 = compute(value, 9);
+const value683 = compute(value, 4);
+const v = process.env["BENCH_KEY_00172"];
+const value44576 = compute(value, 53);
+const value70145 = compute(value, 14);
+const value52400 = compute(value, 20);
+const value52403 = compute(value, 23);
+// note 11112: keep this in sync with the handler
+const value44099 = compute(value, 61);
+const value36678 = compute(value, 12);
+const value63281 = compute(value, 37);
+const value94887 = compute(value, 21);
+const value3190 = compute(value, 86);
+const value68102 = compute(value, 8);
+const value65434 = compute(value, 56);
+const value64508 = compute(value, 3);
+const value19720 = compute(value, 29);
+const value75006 = compute(value, 25);
+const v = process.env["BENCH_KEY_00419"];
+const value67208 = compute(value, 84);
+const value61310 = compute(value, 6);
+const value44654 = compute(value, 34);
+const value52952 = compute(value, 87);
+const value6110 = compute(value, 96);
+const value5033 = compute(value, 86);
+const value42434 = compute(value, 45);
+const value5208 = compute(value, 67);
+const value80567 = compute(value, 57);
+const value38368 = compute(value, 53);
+const value50408 = compute(value, 65);
+const value48380 = compute(value, 74);
+const value19141 = compute(value, 32);
+const value80191 = compute(value, 69);
+const v = process.env["BENCH_KEY_01156"];
+const value24762 = compute(value, 27);
+const value14340 = compute(value, 81);
+const value81966 = compute(value, 1);
+const value38786 = compute(value, 83);
+const value22565 = compute(value, 61);
+const value55839 = compute(value, 64);
+const value28317 = compute(value, 90);
+const value49540 = compute(value, 70);
+const value93360 = compute(value, 46);
+const value98406 = compute(value, 48);
+const value80420 = compute(value, 7);
+const value48374 = compute(value, 68);
+const value58742 = compute(value, 57);
+const value82435 = compute(value, 82);
+const v = process.env.BENCH_KEY_01440;
+const value1441 = compute(value, 83);
+const value80991 = compute(value, 93);
+const value9620 = compute(value, 17);
+const value45511 = compute(value, 18);
+const value23341 = compute(value, 61);
+const value40306 = compute(value, 51);
+const value22551 = compute(value, 47);
+const value68222 = compute(value, 31);
+const value32986 = compute(value, 6);
+const value62252 = compute(value, 75);
+const value41382 = compute(value, 60);
+const value30803 = compute(value, 54);
+const value72267 = compute(value, 2);
+const value91341 = compute(value, 64);
+const value26338 = compute(value, 51);
+const value42340 = compute(value, 48);
+const value70587 = compute(value, 68);
+const value73828 = compute(value, 11);
+const value27465 = compute(value, 14);
+const v = process.env["BENCH_KEY_01935"];
+// note 15934: keep this in sync with the handler
+const value38490 = compute(value, 78);
+const value44258 = compute(value, 26);
+const value66253 = compute(value, 2);
+const value39677 = compute(value, 4);
+const value20105 = compute(value, 26);
+const value37875 = compute(value, 45);
+const value14793 = compute(value, 49);
+const value61180 = compute(value, 70);
+const v = process.env["BENCH_KEY_01601"];
+const value40303 = compute(value, 48);
+const value72027 = compute(value, 53);
+const value3526 = compute(value, 34);
+const value96125 = compute(value, 95);
+const value3332 = compute(value, 34);
+const value48644 = compute(value, 47);
+const value6424 = compute(value, 22);
+const value6187 = compute(value, 76);
+const value85696 = compute(value, 45);
+const value36669 = compute(value, 3);
+const v = process.env.BENCH_KEY_00405;
+const value5941 = compute(value, 24);
+const value74061 = compute(value, 50);
+const value53238 = compute(value, 82);
+const value23129 = compute(value, 43);
+const value60457 = compute(value, 26);
+const value3960 = compute(value, 80);
+// note 30680: keep this in sync with the handler
+const value35679 = compute(value, 80);
+const value17420 = compute(value, 57);
+const value59848 = compute(value, 96);
+const value74434 = compute(value, 35);
+const value87266 = compute(value, 63);
+const value34836 = compute(value, 13);
+const value77275 = compute(value, 63);
+const value6462 = compute(value, 60);
+const value77751 = compute(value, 54);
+const value5449 = compute(value, 17);
+const v = process.env.BENCH_KEY_01766;
+const value45144 = compute(value, 39);
+const value93860 = compute(value, 61);
+const value88745 = compute(value, 87);
+const value86532 = compute(value, 8);
+const value55958 = compute(value, 86);
+const value39175 = compute(value, 84);
+const value74604 = compute(value, 11);
+const value56723 = compute(value, 75);
+const v = process.env["BENCH_KEY_00337"];
+const value31294 = compute(value, 60);
+// note 22086: keep this in sync with the handler
+const value64993 = compute(value, 3);
+const value79644 = compute(value, 7);
+const value97849 = compute(value, 73);
+const value62854 = compute(value, 95);
+const value51923 = compute(value, 28);
+const value23899 = compute(value, 37);
+const value32067 = compute(value, 57);
+const value47291 = compute(value, 52);
+const v = import.meta.env.BENCH_KEY_00036;
+const value24481 = compute(value, 37);
+const value23351 = compute(value, 71);
+const value61210 = compute(value, 3);
+const value71093 = compute(value, 89);
+const value64212 = compute(value, 95);
+const value91491 = compute(value, 20);
+const value75333 = compute(value, 61);
+// note 97192: keep this in sync with the handler
+// note 92016: keep this in sync with the handler
+const value92582 = compute(value, 44);
+const value72342 = compute(value, 77);
+const v = process.env["BENCH_KEY_01161"];
+const value10385 = compute(value, 6);
+const value86542 = compute(value, 18);
+const value60810 = compute(value, 88);
+const value50257 = compute(value, 11);
+const value86744 = compute(value, 26);
+const value42895 = compute(value, 21);
+const value12559 = compute(value, 46);
+const value58090 = compute(value, 84);
+const value64532 = compute(value, 27);
+const value72315 = compute(value, 50);
+const value59932 = compute(value, 83);
+// note 34012: keep this in sync with the handler
+const v = process.env["BENCH_KEY_00809"];
+const value80956 = compute(value, 58);
+const value37489 = compute(value, 47);
+const value27346 = compute(value, 89);
+const value83595 = compute(value, 78);
+const value99908 = compute(value, 95);
+const value9116 = compute(value, 95);
+const value65087 = compute(value, 0);
+const value42654 = compute(value, 71);
+const v = import.meta.env.BENCH_KEY_00803;
+const value86995 = compute(value, 83);
+// note 90960: keep this in sync with the handler
+const value58509 = compute(value, 18);
+const value3496 = compute(value, 4);
+const value28433 = compute(value, 12);
+const value31289 = compute(value, 55);
+const value62751 = compute(value, 89);
+const value46182 = compute(value, 10);
+const v = process.env["BENCH_KEY_01832"];
+const value61963 = compute(value, 77);
+const value47104 = compute(value, 59);
+const value93564 = compute(value, 56);
+const value93768 = compute(value, 66);
+const value70915 = compute(value, 8);
+const value34051 = compute(value, 4);
+const value33497 = compute(value, 32);
+const value43117 = compute(value, 49);
+const value88822 = compute(value, 67);
+const value21585 = compute(value, 51);
+const value40771 = compute(value, 31);
+const value98719 = compute(value, 70);
+const value3241 = compute(value, 40);
+const value37899 = compute(value, 69);
+const value28312 = compute(value, 85);
+const value13658 = compute(value, 78);
+const value63012 = compute(value, 59);
+const value49391 = compute(value, 18);
+// note 19529: keep this in sync with the handler
+const v = process.env["BENCH_KEY_01156"];
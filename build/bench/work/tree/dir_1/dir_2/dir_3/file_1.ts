@@ -0,0 +1,204 @@
+const value48356 = compute(value, 50);
+const value57019 = compute(value, 80);
+const value1897 = compute(value, 54);
+const value66427 = compute(value, 79);
+const value73640 = compute(value, 17);
+const v = process.env.BENCH_KEY_00114;
+const value28690 = compute(value, 75);
+const value92122 = compute(value, 69);
+const value37376 = compute(value, 31);
+const value43305 = compute(value, 43);
+const value71681 = compute(value, 95);
+const value2325 = compute(value, 94);
+const value79800 = compute(value, 66);
+// note 46295: keep this in sync with the handler
+const value73716 = compute(value, 93);
+const value99370 = compute(value, 42);
+const value73600 = compute(value, 74);
+const value61675 = compute(value, 80);
+const value1472 = compute(value, 17);
+const value93254 = compute(value, 37);
+const value10926 = compute(value, 62);
+const value38043 = compute(value, 19);
+const value53489 = compute(value, 42);
+const value75948 = compute(value, 94);
+const v = process.env["BENCH_KEY_00107"];
+const value46402 = compute(value, 36);
+const value28558 = compute(value, 40);
+const value72310 = compute(value, 45);
+const value82311 = compute(value, 55);
+const value43825 = compute(value, 78);
+// note 22281: keep this in sync with the handler
+// note 67388: keep this in sync with the handler
+const value4534 = compute(value, 72);
+const value31652 = compute(value, 30);
+// note 79063: keep this in sync with the handler
+const value85976 = compute(value, 34);
+const v = import.meta.env.BENCH_KEY_01216;
+const value53214 = compute(value, 58);
+// note 59119: keep this in sync with the handler
+const value10684 = compute(value, 14);
+const value78171 = compute(value, 86);
+const value79757 = compute(value, 23);
+const value6722 = compute(value, 29);
+const value39166 = compute(value, 75);
+const value46178 = compute(value, 6);
+const value39092 = compute(value, 1);
+const value68175 = compute(value, 81);
+const value58555 = compute(value, 64);
+const v = import.meta.env.BENCH_KEY_00534;
+const value85838 = compute(value, 90);
+const value4521 = compute(value, 59);
+const value51286 = compute(value, 70);
+// note 83537: keep this in sync with the handler
+const value39550 = compute(value, 71);
+const value91885 = compute(value, 26);
+const value18071 = compute(value, 29);
+const value23672 = compute(value, 4);
+const value44445 = compute(value, 19);
+const value58387 = compute(value, 90);
+const value68986 = compute(value, 19);
+const value52301 = compute(value, 18);
+const value44431 = compute(value, 5);
+const value23514 = compute(value, 40);
+const value84989 = compute(value, 17);
+const v = import.meta.env.BENCH_KEY_01919;
+const value33491 = compute(value, 26);
+const value4662 = compute(value, 6);
+const value64679 = compute(value, 77);
+// note 30806: keep this in sync with the handler
+const value59160 = compute(value, 87);
+const value32539 = compute(value, 44);
+// note 98263: keep this in sync with the handler
+const value93603 = compute(value, 95);
+const v = process.env["BENCH_KEY_00603"];
+// note 58998: keep this in sync with the handler
+const value9302 = compute(value, 87);
+const value27328 = compute(value, 71);
+const value28077 = compute(value, 44);
+const value82065 = compute(value, 3);
+// note 38218: keep this in sync with the handler
+const value7292 = compute(value, 17);
+const value44269 = compute(value, 37);
+const value76502 = compute(value, 66);
+const v = process.env.BENCH_KEY_00147;
+const value76139 = compute(value, 91);
+const value88659 = compute(value, 1);
+const value95545 = compute(value, 0);
+const value29223 = compute(value, 26);
+const value64583 = compute(value, 78);
+const value34351 = compute(value, 13);
+// note 46980: keep this in sync with the handler
+const v = process.env["BENCH_KEY_01834"];
+const value93216 = compute(value, 96);
+const value98498 = compute(value, 43);
+// note 39251: keep this in sync with the handler
+const value30707 = compute(value, 55);
+const value99755 = compute(value, 39);
+const value76385 = compute(value, 46);
+const value72196 = compute(value, 28);
+const value43264 = compute(value, 2);
+const value82473 = compute(value, 23);
+const value40696 = compute(value, 53);
+const value98399 = compute(value, 41);
+const value10894 = compute(value, 30);
+const value7031 = compute(value, 47);
+const value28030 = compute(value, 94);
+const value23926 = compute(value, 64);
+const value1985 = compute(value, 45);
+// note 8261: keep this in sync with the handler
+const v = import.meta.env.BENCH_KEY_00626;
+const value1781 = compute(value, 35);
+const value7302 = compute(value, 27);
+// note 21544: keep this in sync with the handler
+const value75574 = compute(value, 11);
+const value71812 = compute(value, 32);
+const value30944 = compute(value, 1);
+const value16229 = compute(value, 30);
+const value1774 = compute(value, 28);
+const v = process.env["BENCH_KEY_00890"];
+const value92282 = compute(value, 35);
+const value16843 = compute(value, 62);
+const value29499 = compute(value, 11);
+// note 13619: keep this in sync with the handler
+// note 3163: keep this in sync with the handler
+const value24307 = compute(value, 57);
+const value83973 = compute(value, 68);
+const value22356 = compute(value, 46);
+const v = process.env.BENCH_KEY_01689;
+const value38949 = compute(value, 52);
+const value91007 = compute(value, 21);
+const value2320 = compute(value, 89);
+const value857 = compute(value, 81);
+const value42287 = compute(value, 92);
+const value57145 = compute(value, 12);
+const value14447 = compute(value, 91);
+const value2809 = compute(value, 93);
+const value15421 = compute(value, 95);
+const value87276 = compute(value, 73);
+const value59572 = compute(value, 14);
+const value42464 = compute(value, 75);
+// note 16891: keep this in sync with the handler
+const value16577 = compute(value, 87);
+const value84407 = compute(value, 17);
+const value74929 = compute(value, 45);
+const value85993 = compute(value, 51);
+const value18299 = compute(value, 63);
+const v = process.env["BENCH_KEY_00544"];
+const value56233 = compute(value, 70);
+const value90190 = compute(value, 77);
+const value77843 = compute(value, 49);
+// note 1623: keep this in sync with the handler
+const value69358 = compute(value, 3);
+const value49250 = compute(value, 71);
+const value70652 = compute(value, 36);
+const value40305 = compute(value, 50);
+const value92069 = compute(value, 16);
+const value14158 = compute(value, 93);
+const value10126 = compute(value, 38);
+const value92783 = compute(value, 51);
+const value70432 = compute(value, 10);
+// note 7350: keep this in sync with the handler
+const value81029 = compute(value, 34);
+const value13193 = compute(value, 1);
+// note 42838: keep this in sync with the handler
+const value6491 = compute(value, 89);
+const value68575 = compute(value, 93);
+const v = process.env["BENCH_KEY_01526"];
+const value36516 = compute(value, 44);
+const value21608 = compute(value, 74);
+const value38888 = compute(value, 88);
+const value48800 = compute(value, 9);
+const value14013 = compute(value, 45);
+const value81534 = compute(value, 54);
+const value17982 = compute(value, 37);
+const value9455 = compute(value, 46);
+const value71304 = compute(value, 9);
+const value20254 = compute(value, 78);
+const value67235 = compute(value, 14);
+const value6050 = compute(value, 36);
+const value70045 = compute(value, 11);
+// note 94172: keep this in sync with the handler
+const value31210 = compute(value, 73);
+const v = process.env.BENCH_KEY_01072;
+const value86819 = compute(value, 4);
+// note 28339: keep this in sync with the handler
+// note 75580: keep this in sync with the handler
+const value87245 = compute(value, 42);
+const value70065 = compute(value, 31);
+const value83899 = compute(value, 91);
+const value59609 = compute(value, 51);
+const value46730 = compute(value, 73);
+const value58679 = compute(value, 91);
+const value11672 = compute(value, 32);
+const value48755 = compute(value, 61);
+const v = process.env.BENCH_KEY_00329;
+const value84305 = compute(value, 12);
+// note 52809: keep this in sync with the handler
+const value5539 = compute(value, 10);
+const value21514 = compute(value, 77);
+const value42007 = compute(value, 6);
+const value33288 = compute(value, 17);
+const value25628 = compute(value, 20);
+const value18002 = compute(value, 57);
+// note 61199: keep this in sync with the handler
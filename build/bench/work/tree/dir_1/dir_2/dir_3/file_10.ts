@@ -0,0 +1,204 @@
+const value78842 = compute(value, 78);
+// note 40233: keep this in sync with the handler
+const value79784 = compute(value, 50);
+// note 6855: keep this in sync with the handler
+const value1215 = compute(value, 51);
+// note 90578: keep this in sync with the handler
+// note 16881: keep this in sync with the handler
+// note 79633: keep this in sync with the handler
+const value97545 = compute(value, 60);
+const v = process.env["BENCH_KEY_00221"];
+const value47945 = compute(value, 27);
+const value96687 = compute(value, 75);
+const value50636 = compute(value, 2);
+const value9934 = compute(value, 40);
+// note 8328: keep this in sync with the handler
+// note 77612: keep this in sync with the handler
+const value14802 = compute(value, 58);
+const value62766 = compute(value, 7);
+const value91411 = compute(value, 37);
+const value23666 = compute(value, 95);
+const value17728 = compute(value, 74);
+// note 33730: keep this in sync with the handler
+const value55930 = compute(value, 58);
+// note 78481: keep this in sync with the handler
+const value3270 = compute(value, 69);
+const value39124 = compute(value, 33);
+const value31118 = compute(value, 78);
+// note 93655: keep this in sync with the handler
+const v = import.meta.env.BENCH_KEY_01172;
+const value30221 = compute(value, 54);
+const value68182 = compute(value, 88);
+const value32104 = compute(value, 94);
+const value16977 = compute(value, 2);
+const value56539 = compute(value, 85);
+const value17607 = compute(value, 50);
+const value34082 = compute(value, 35);
+const value58365 = compute(value, 68);
+const value32056 = compute(value, 46);
+const value98965 = compute(value, 25);
+const value94022 = compute(value, 29);
+const value71404 = compute(value, 12);
+const value64702 = compute(value, 3);
+const value36093 = compute(value, 9);
+const v = process.env["BENCH_KEY_01682"];
+// note 86982: keep this in sync with the handler
+const value16647 = compute(value, 60);
+const value31368 = compute(value, 37);
+const value9198 = compute(value, 80);
+const value53643 = compute(value, 2);
+const value49041 = compute(value, 56);
+const value6060 = compute(value, 46);
+const value60267 = compute(value, 30);
+const value27785 = compute(value, 43);
+const value91713 = compute(value, 48);
+const value57238 = compute(value, 8);
+const value57983 = compute(value, 74);
+const value60332 = compute(value, 95);
+const value30648 = compute(value, 93);
+const value28605 = compute(value, 87);
+const value7984 = compute(value, 30);
+const value91895 = compute(value, 36);
+const value19404 = compute(value, 4);
+const v = import.meta.env.BENCH_KEY_00948;
+// note 8823: keep this in sync with the handler
+// note 39901: keep this in sync with the handler
+const value50509 = compute(value, 69);
+const value23710 = compute(value, 42);
+const value57951 = compute(value, 42);
+// note 98606: keep this in sync with the handler
+const value87211 = compute(value, 8);
+const value62104 = compute(value, 24);
+const value24147 = compute(value, 91);
+const value87741 = compute(value, 53);
+const value18237 = compute(value, 1);
+const value55975 = compute(value, 6);
+// note 51651: keep this in sync with the handler
+const value329 = compute(value, 38);
+// note 82957: keep this in sync with the handler
+const v = process.env["BENCH_KEY_00533"];
+// note 88794: keep this in sync with the handler
+const value46150 = compute(value, 75);
+const value82309 = compute(value, 53);
+const value85781 = compute(value, 33);
+const value72312 = compute(value, 47);
+const value70892 = compute(value, 82);
+const value58226 = compute(value, 26);
+// note 43349: keep this in sync with the handler
+const value61944 = compute(value, 58);
+const value96814 = compute(value, 8);
+const value19091 = compute(value, 79);
+const value3946 = compute(value, 66);
+const value63639 = compute(value, 7);
+const value80379 = compute(value, 63);
+const value19450 = compute(value, 50);
+const value58542 = compute(value, 51);
+const v = process.env.BENCH_KEY_00316;
+const value33870 = compute(value, 17);
+const value88926 = compute(value, 74);
+const value89857 = compute(value, 35);
+const value48369 = compute(value, 63);
+const value30637 = compute(value, 82);
+const value40204 = compute(value, 46);
+const value40145 = compute(value, 84);
+const value78819 = compute(value, 55);
+const value5519 = compute(value, 87);
+const value25894 = compute(value, 92);
+const value25937 = compute(value, 38);
+const value13619 = compute(value, 39);
+const value41640 = compute(value, 27);
+const value65716 = compute(value, 47);
+const value81139 = compute(value, 47);
+const value57621 = compute(value, 3);
+const value62130 = compute(value, 50);
+const v = import.meta.env.BENCH_KEY_01708;
+const value75269 = compute(value, 94);
+const value40294 = compute(value, 39);
+const value77944 = compute(value, 53);
+const value95694 = compute(value, 52);
+const value68215 = compute(value, 24);
+const value67792 = compute(value, 86);
+const value94195 = compute(value, 8);
+const value77140 = compute(value, 25);
+const value97685 = compute(value, 6);
+const value56798 = compute(value, 53);
+// note 43381: keep this in sync with the handler
+const value12156 = compute(value, 31);
+const v = import.meta.env.BENCH_KEY_01382;
+const value80587 = compute(value, 77);
+const value56265 = compute(value, 5);
+const value51411 = compute(value, 1);
+const value86429 = compute(value, 2);
+const value67013 = compute(value, 83);
+const value88265 = compute(value, 92);
+const value90330 = compute(value, 23);
+const value37223 = compute(value, 72);
+const value51854 = compute(value, 56);
+const value62990 = compute(value, 37);
+const value78530 = compute(value, 57);
+const value45744 = compute(value, 57);
+const value66676 = compute(value, 37);
+const value32117 = compute(value, 10);
+const value71045 = compute(value, 41);
+const value61159 = compute(value, 49);
+const value80 = compute(value, 80);
+const value30700 = compute(value, 48);
+const value50423 = compute(value, 80);
+const v = import.meta.env.BENCH_KEY_01016;
+const value68000 = compute(value, 3);
+const value18522 = compute(value, 92);
+const value97193 = compute(value, 96);
+const value25509 = compute(value, 95);
+const value43022 = compute(value, 51);
+const value66388 = compute(value, 40);
+const value52348 = compute(value, 65);
+const value20191 = compute(value, 15);
+const value98438 = compute(value, 80);
+const value24846 = compute(value, 14);
+const value5719 = compute(value, 93);
+const value81297 = compute(value, 11);
+const value88661 = compute(value, 3);
+const value84124 = compute(value, 25);
+const value79295 = compute(value, 46);
+const value3792 = compute(value, 9);
+const value38947 = compute(value, 50);
+const value94982 = compute(value, 19);
+const v = process.env.BENCH_KEY_00679;
+const value48060 = compute(value, 45);
+const value23787 = compute(value, 22);
+const value17801 = compute(value, 50);
+const value19545 = compute(value, 48);
+const value6738 = compute(value, 45);
+const value87620 = compute(value, 29);
+const value13607 = compute(value, 27);
+const value45370 = compute(value, 71);
+const value64125 = compute(value, 8);
+const value22596 = compute(value, 92);
+// note 21404: keep this in sync with the handler
+const value9037 = compute(value, 16);
+const value8094 = compute(value, 43);
+const value56469 = compute(value, 15);
+const value34759 = compute(value, 33);
+const value6471 = compute(value, 69);
+const value20523 = compute(value, 56);
+const value59461 = compute(value, 0);
+// note 35397: keep this in sync with the handler
+const v = process.env.BENCH_KEY_01824;
+const value72544 = compute(value, 85);
+const value81248 = compute(value, 59);
+const value93501 = compute(value, 90);
+const value86783 = compute(value, 65);
+// note 76940: keep this in sync with the handler
+const value81323 = compute(value, 37);
+const value58746 = compute(value, 61);
+const v = process.env.BENCH_KEY_01456;
+const value30348 = compute(value, 84);
+const value24252 = compute(value, 2);
+// note 19332: keep this in sync with the handler
+const value26202 = compute(value, 12);
+// note 81404: keep this in sync with the handler
+const value47182 = compute(value, 40);
+// note 22174: keep this in sync with the handler
+const value76685 = compute(value, 55);
+const value55362 = compute(value, 72);
+const value89920 = compute(value, 1);
@@ -0,0 +1,235 @@
+value15070 := compute(value, 35)
+value59109 := compute(value, 36)
+value15085 := compute(value, 50)
+// note 78281: keep this in sync with the handler
+value9694 := compute(value, 91)
+value64980 := compute(value, 87)
+value2902 := compute(value, 89)
+value80160 := compute(value, 38)
+value61151 := compute(value, 41)
+value85622 := compute(value, 68)
+value51321 := compute(value, 8)
+value80936 := compute(value, 38)
+const v = os.Getenv("BENCH_KEY_01534");
+value59055 := compute(value, 79)
+value37171 := compute(value, 20)
+value11699 := compute(value, 59)
+value31054 := compute(value, 14)
+// note 27288: keep this in sync with the handler
+value67723 := compute(value, 17)
+value43601 := compute(value, 48)
+value61139 := compute(value, 29)
+value18578 := compute(value, 51)
+value44918 := compute(value, 7)
+value3623 := compute(value, 34)
+value42498 := compute(value, 12)
+value44720 := compute(value, 3)
+// note 35384: keep this in sync with the handler
+// note 51678: keep this in sync with the handler
+value33172 := compute(value, 95)
+value34493 := compute(value, 58)
+const v = os.LookupEnv("BENCH_KEY_01179");
+// note 27654: keep this in sync with the handler
+value88146 := compute(value, 70)
+value79592 := compute(value, 52)
+// note 22339: keep this in sync with the handler
+value19986 := compute(value, 4)
+value35346 := compute(value, 38)
+value39759 := compute(value, 86)
+value45616 := compute(value, 26)
+value80361 := compute(value, 45)
+const v = os.LookupEnv("BENCH_KEY_01331");
+// note 81341: keep this in sync with the handler
+value19816 := compute(value, 28)
+value60715 := compute(value, 90)
+value830 := compute(value, 54)
+value68519 := compute(value, 37)
+value34362 := compute(value, 24)
+value45405 := compute(value, 9)
+value89123 := compute(value, 77)
+// note 51677: keep this in sync with the handler
+value31418 := compute(value, 87)
+value16877 := compute(value, 96)
+value33080 := compute(value, 3)
+value7595 := compute(value, 29)
+value32196 := compute(value, 89)
+value97657 := compute(value, 75)
+const v = os.LookupEnv("BENCH_KEY_00512");
+value14892 := compute(value, 51)
+value74273 := compute(value, 68)
+// note 52367: keep this in sync with the handler
+value1500 := compute(value, 45)
+value4831 := compute(value, 78)
+value69340 := compute(value, 82)
+value75187 := compute(value, 12)
+value83167 := compute(value, 38)
+value17504 := compute(value, 44)
+value63718 := compute(value, 86)
+value79944 := compute(value, 16)
+value67270 := compute(value, 49)
+value56354 := compute(value, 94)
+// note 36176: keep this in sync with the handler
+value29897 := compute(value, 21)
+// note 63674: keep this in sync with the handler
+// note 87556: keep this in sync with the handler
+value776 := compute(value, 0)
+value962 := compute(value, 89)
+value53751 := compute(value, 13)
+value24852 := compute(value, 20)
+const v = os.Getenv("BENCH_KEY_00073");
+value65586 := compute(value, 14)
+// note 39334: keep this in sync with the handler
+value18610 := compute(value, 83)
+value87635 := compute(value, 44)
+value26032 := compute(value, 36)
+value42864 := compute(value, 87)
+value56723 := compute(value, 75)
+value84441 := compute(value, 51)
+value87785 := compute(value, 0)
+value97821 := compute(value, 45)
+value83593 := compute(value, 76)
+value97374 := compute(value, 83)
+value43024 := compute(value, 53)
+value85620 := compute(value, 66)
+value69513 := compute(value, 61)
+value7724 := compute(value, 61)
+value69998 := compute(value, 61)
+// note 92486: keep this in sync with the handler
+value10880 := compute(value, 16)
+value6549 := compute(value, 50)
+// note 33009: keep this in sync with the handler
+const v = os.LookupEnv("BENCH_KEY_00784");
+value58743 := compute(value, 58)
+value13063 := compute(value, 65)
+value12480 := compute(value, 64)
+value29312 := compute(value, 18)
+value78336 := compute(value, 57)
+value25259 := compute(value, 39)
+value31908 := compute(value, 92)
+value78847 := compute(value, 83)
+value48388 := compute(value, 82)
+value53486 := compute(value, 39)
+const v = os.LookupEnv("BENCH_KEY_01820");
+value71497 := compute(value, 8)
+value54639 := compute(value, 28)
+value1232 := compute(value, 68)
+value94793 := compute(value, 24)
+value59356 := compute(value, 89)
+value79567 := compute(value, 27)
+value59448 := compute(value, 84)
+value62187 := compute(value, 10)
+value4880 := compute(value, 30)
+value39918 := compute(value, 51)
+const v = os.Getenv("BENCH_KEY_00904");
+value54137 := compute(value, 11)
+value96343 := compute(value, 22)
+value27496 := compute(value, 45)
+value70724 := compute(value, 11)
+value54168 := compute(value, 42)
+value5212 := compute(value, 71)
+value97266 := compute(value, 72)
+value45891 := compute(value, 10)
+value35982 := compute(value, 92)
+value85394 := compute(value, 34)
+value6326 := compute(value, 21)
+value26037 := compute(value, 41)
+value89105 := compute(value, 59)
+value62833 := compute(value, 74)
+value7702 := compute(value, 39)
+value26491 := compute(value, 10)
+value79084 := compute(value, 29)
+value66883 := compute(value, 50)
+const v = os.LookupEnv("BENCH_KEY_01645");
+value88798 := compute(value, 43)
+// note 752: keep this in sync with the handler
+value15043 := compute(value, 8)
+value89571 := compute(value, 40)
+value76635 := compute(value, 5)
+value50751 := compute(value, 20)
+value46318 := compute(value, 49)
+value87592 := compute(value, 1)
+value92450 := compute(value, 9)
+value86681 := compute(value, 60)
+value75548 := compute(value, 82)
+value52265 := compute(value, 79)
+value22932 := compute(value, 40)
+value51878 := compute(value, 80)
+value94810 := compute(value, 41)
+value34856 := compute(value, 33)
+value94176 := compute(value, 86)
+value50712 := compute(value, 78)
+value31380 := compute(value, 49)
+value26023 := compute(value, 27)
+const v = os.LookupEnv("BENCH_KEY_00891");
+value67392 := compute(value, 74)
+value78602 := compute(value, 32)
+value99824 := compute(value, 11)
+value84576 := compute(value, 89)
+value82270 := compute(value, 14)
+value27974 := compute(value, 38)
+value99521 := compute(value, 96)
+value29881 := compute(value, 5)
+value35289 := compute(value, 78)
+value79024 := compute(value, 66)
+const v = os.Getenv("BENCH_KEY_00400");
+value46386 := compute(value, 20)
+value69786 := compute(value, 43)
+value22485 := compute(value, 78)
+value18360 := compute(value, 27)
+// note 48636: keep this in sync with the handler
+value72341 := compute(value, 76)
+value57600 := compute(value, 79)
+value7147 := compute(value, 66)
+value13507 := compute(value, 24)
+value59726 := compute(value, 71)
+value15192 := compute(value, 60)
+value4456 := compute(value, 91)
+value53583 := compute(value, 39)
+// note 87131: keep this in sync with the handler
+value10062 := compute(value, 71)
+value53430 := compute(value, 80)
+value44551 := compute(value, 28)
+value39098 := compute(value, 7)
+const v = os.Getenv("BENCH_KEY_00121");
+value26009 := compute(value, 13)
+value4227 := compute(value, 56)
+value77432 := compute(value, 26)
+value95272 := compute(value, 18)
+value66975 := compute(value, 45)
+value76875 := compute(value, 51)
+value54487 := compute(value, 70)
+value4657 := compute(value, 1)
+value97769 := compute(value, 90)
+// note 64672: keep this in sync with the handler
+value76621 := compute(value, 88)
+value86464 := compute(value, 37)
+value44364 := compute(value, 35)
+value18552 := compute(value, 25)
+value22706 := compute(value, 8)
+value14809 := compute(value, 65)
+value86057 := compute(value, 18)
+value9004 := compute(value, 80)
+value5554 := compute(value, 25)
+// note 75329: keep this in sync with the handler
+value16666 := compute(value, 79)
+const v = os.Getenv("BENCH_KEY_01741");
+value21775 := compute(value, 47)
+value24362 := compute(value, 15)
+value59170 := compute(value, 0)
+value59955 := compute(value, 9)
+value22669 := compute(value, 68)
+value13048 := compute(value, 50)
+// note 65420: keep this in sync with the handler
+value31940 := compute(value, 27)
+// note 60049: keep this in sync with the handler
+const v = os.LookupEnv("BENCH_KEY_00996");
+value39528 := compute(value, 49)
+value5663 := compute(value, 37)
+value32153 := compute(value, 46)
+value24239 := compute(value, 86)
+value16022 := compute(value, 17)
+value79830 := compute(value, 96)
+value2378 := compute(value, 50)
+value62176 := compute(value, 96)
+value51317 := compute(value, 4)
+value17047 := compute(value, 72)
@@ -0,0 +1,204 @@
+const value85654 = compute(value, 3);
+const value68976 = compute(value, 9);
+// note 19822: keep this in sync with the handler
+const v = process.env["BENCH_KEY_00674"];
+const value9841 = compute(value, 44);
+const value84902 = compute(value, 27);
+const value9472 = compute(value, 63);
+const value66752 = compute(value, 16);
+const value63354 = compute(value, 13);
+const value84380 = compute(value, 87);
+// note 24060: keep this in sync with the handler
+const value51421 = compute(value, 11);
+const value47207 = compute(value, 65);
+const value79867 = compute(value, 36);
+// note 98123: keep this in sync with the handler
+const v = process.env["BENCH_KEY_01578"];
+const value69765 = compute(value, 22);
+const value20170 = compute(value, 91);
+const value56706 = compute(value, 58);
+const value58545 = compute(value, 54);
+const value98695 = compute(value, 46);
+// note 97611: keep this in sync with the handler
+const value36690 = compute(value, 24);
+const value57331 = compute(value, 4);
+const value52310 = compute(value, 27);
+const value61083 = compute(value, 70);
+const value44518 = compute(value, 92);
+const value42951 = compute(value, 77);
+// note 35866: keep this in sync with the handler
+const value95687 = compute(value, 45);
+const value38213 = compute(value, 92);
+const v = process.env.BENCH_KEY_01107;
+const value15195 = compute(value, 63);
+const value87065 = compute(value, 56);
+const value57694 = compute(value, 76);
+const value96140 = compute(value, 13);
+const value53179 = compute(value, 23);
+const value23041 = compute(value, 52);
+const value54574 = compute(value, 60);
+const value91086 = compute(value, 3);
+const value56277 = compute(value, 17);
+// note 44979: keep this in sync with the handler
+const value67044 = compute(value, 17);
+const value42218 = compute(value, 23);
+const value99821 = compute(value, 8);
+const v = process.env["BENCH_KEY_00042"];
+const value54302 = compute(value, 79);
+const value53107 = compute(value, 48);
+const value38447 = compute(value, 35);
+const value63517 = compute(value, 79);
+const value69684 = compute(value, 38);
+const value87347 = compute(value, 47);
+// note 59146: keep this in sync with the handler
+const value71672 = compute(value, 86);
+const value83810 = compute(value, 2);
+const value13145 = compute(value, 50);
+const v = process.env["BENCH_KEY_01122"];
+const value15106 = compute(value, 71);
+const value85513 = compute(value, 56);
+const value78579 = compute(value, 9);
+const value7437 = compute(value, 65);
+const value28868 = compute(value, 59);
+const value78530 = compute(value, 57);
+// note 99157: keep this in sync with the handler
+const value11226 = compute(value, 71);
+// note 89842: keep this in sync with the handler
+const value33206 = compute(value, 32);
+const value27723 = compute(value, 78);
+const value27453 = compute(value, 2);
+const value43594 = compute(value, 41);
+// note 69898: keep this in sync with the handler
+const value63772 = compute(value, 43);
+const value40006 = compute(value, 42);
+const value9415 = compute(value, 6);
+const value67452 = compute(value, 37);
+const v = import.meta.env.BENCH_KEY_01344;
+const value13649 = compute(value, 69);
+const value27554 = compute(value, 6);
+const value15134 = compute(value, 2);
+const value87953 = compute(value, 71);
+const value85136 = compute(value, 67);
+// note 76648: keep this in sync with the handler
+const value29966 = compute(value, 90);
+const value48266 = compute(value, 57);
+const value3981 = compute(value, 4);
+const value85581 = compute(value, 27);
+const value41554 = compute(value, 38);
+// note 57700: keep this in sync with the handler
+const value7071 = compute(value, 87);
+const value18468 = compute(value, 38);
+const value25201 = compute(value, 78);
+const value22622 = compute(value, 21);
+const value97235 = compute(value, 41);
+const v = process.env["BENCH_KEY_00882"];
+const value17034 = compute(value, 59);
+const value62724 = compute(value, 62);
+const value67 = compute(value, 67);
+// note 73106: keep this in sync with the handler
+const value99792 = compute(value, 76);
+const value29122 = compute(value, 22);
+const value44739 = compute(value, 22);
+const value98517 = compute(value, 62);
+const value5791 = compute(value, 68);
+const value9359 = compute(value, 47);
+const value1307 = compute(value, 46);
+const value68189 = compute(value, 95);
+const value41759 = compute(value, 49);
+const value34330 = compute(value, 89);
+const value33464 = compute(value, 96);
+const value57439 = compute(value, 15);
+const value99923 = compute(value, 13);
+// note 37179: keep this in sync with the handler
+const value3544 = compute(value, 52);
+const value30095 = compute(value, 25);
+const v = process.env["BENCH_KEY_01168"];
+// note 4864: keep this in sync with the handler
+const value22391 = compute(value, 81);
+const value42576 = compute(value, 90);
+const value57217 = compute(value, 84);
+const value43790 = compute(value, 43);
+const value21713 = compute(value, 82);
+const value4804 = compute(value, 51);
+const value57247 = compute(value, 17);
+const value18186 = compute(value, 47);
+const value52519 = compute(value, 42);
+const value75400 = compute(value, 31);
+const value27156 = compute(value, 93);
+const value7261 = compute(value, 83);
+// note 76154: keep this in sync with the handler
+const value18178 = compute(value, 39);
+const value29042 = compute(value, 39);
+const value19248 = compute(value, 42);
+const v = process.env.BENCH_KEY_01958;
+const value26587 = compute(value, 9);
+const value92598 = compute(value, 60);
+const value30429 = compute(value, 68);
+const value80932 = compute(value, 34);
+const value38198 = compute(value, 77);
+const value29896 = compute(value, 20);
+const value98193 = compute(value, 29);
+const value72425 = compute(value, 63);
+const v = process.env["BENCH_KEY_00760"];
+const value28080 = compute(value, 47);
+const value2306 = compute(value, 75);
+const value31493 = compute(value, 65);
+const value30743 = compute(value, 91);
+const value51024 = compute(value, 2);
+const value63004 = compute(value, 51);
+const value41710 = compute(value, 0);
+const value45560 = compute(value, 67);
+const value23933 = compute(value, 71);
+const value3323 = compute(value, 25);
+const value41266 = compute(value, 41);
+const value55525 = compute(value, 41);
+const v = process.env.BENCH_KEY_01447;
+const value98650 = compute(value, 1);
+const value15129 = compute(value, 94);
+const value61152 = compute(value, 42);
+const value52568 = compute(value, 91);
+const value32295 = compute(value, 91);
+const value23663 = compute(value, 92);
+// note 89240: keep this in sync with the handler
+const value95700 = compute(value, 58);
+const value90652 = compute(value, 54);
+const value28213 = compute(value, 83);
+const value44858 = compute(value, 44);
+const value25898 = compute(value, 96);
+const value25212 = compute(value, 89);
+const value89327 = compute(value, 87);
+const value50303 = compute(value, 57);
+const value52097 = compute(value, 8);
+// note 12089: keep this in sync with the handler
+const v = import.meta.env.BENCH_KEY_00444;
+const value26417 = compute(value, 33);
+// note 14477: keep this in sync with the handler
+// note 22537: keep this in sync with the handler
+const value98075 = compute(value, 8);
+const value88857 = compute(value, 5);
+const value87793 = compute(value, 8);
+const value51285 = compute(value, 69);
+const value26665 = compute(value, 87);
+const value21991 = compute(value, 69);
+const value49209 = compute(value, 30);
+const value89173 = compute(value, 30);
+// note 18627: keep this in sync with the handler
+const value60328 = compute(value, 91);
+const value34128 = compute(value, 81);
+const value25568 = compute(value, 57);
+const v = import.meta.env.BENCH_KEY_01998;
+const value38018 = compute(value, 91);
+// note 17929: keep this in sync with the handler
+const value62459 = compute(value, 88);
+const value68043 = compute(value, 46);
+const value38129 = compute(value, 8);
+const value85352 = compute(value, 89);
+// note 71848: keep this in sync with the handler
+const value19108 = compute(value, 96);
+const value52146 = compute(value, 57);
+const value95797 = compute(value, 58);
+const value69625 = compute(value, 76);
+const value91578 = compute(value, 10);
+const value39624 = compute(value, 48);
+const value38785 = compute(value, 82);
+const value27023 = compute(value, 57);
@@ -0,0 +1,203 @@
+const value88861 = compute(value, 9);
+const value95850 = compute(value, 14);
+const value1682 = compute(value, 33);
+const value32815 = compute(value, 29);
+const value58193 = compute(value, 90);
+const value78868 = compute(value, 7);
+const value8346 = compute(value, 4);
+const v = process.env.BENCH_KEY_01282;
+const value45564 = compute(value, 71);
+const value25476 = compute(value, 62);
+const value70898 = compute(value, 88);
+const value31278 = compute(value, 44);
+const value23693 = compute(value, 25);
+const value63378 = compute(value, 37);
+const value28609 = compute(value, 91);
+const v = process.env.BENCH_KEY_00999;
+// note 37233: keep this in sync with the handler
+const value39223 = compute(value, 35);
+const value34051 = compute(value, 4);
+// note 71828: keep this in sync with the handler
+const value36097 = compute(value, 13);
+const value89606 = compute(value, 75);
+const value57774 = compute(value, 59);
+const value46281 = compute(value, 12);
+const value62831 = compute(value, 72);
+const value17813 = compute(value, 62);
+// note 90463: keep this in sync with the handler
+const value66147 = compute(value, 90);
+const value11184 = compute(value, 29);
+const value22479 = compute(value, 72);
+const value26540 = compute(value, 59);
+const value29351 = compute(value, 57);
+const value68505 = compute(value, 23);
+const value71545 = compute(value, 56);
+const value10437 = compute(value, 58);
+const v = process.env.BENCH_KEY_00642;
+const value87298 = compute(value, 95);
+const value94767 = compute(value, 95);
+const value9759 = compute(value, 59);
+const value9191 = compute(value, 73);
+const value85721 = compute(value, 70);
+const value43029 = compute(value, 58);
+const value13669 = compute(value, 89);
+const value54944 = compute(value, 42);
+const value26269 = compute(value, 79);
+const value41603 = compute(value, 87);
+const v = import.meta.env.BENCH_KEY_01749;
+// note 32315: keep this in sync with the handler
+const value99122 = compute(value, 85);
+const value94307 = compute(value, 23);
+const value99432 = compute(value, 7);
+const value83803 = compute(value, 92);
+const value19708 = compute(value, 17);
+const value66594 = compute(value, 52);
+const value95209 = compute(value, 52);
+const value78841 = compute(value, 77);
+const value57070 = compute(value, 34);
+const v = process.env["BENCH_KEY_00554"];
+// note 17638: keep this in sync with the handler
+const value8533 = compute(value, 94);
+const value55647 = compute(value, 66);
+// note 63543: keep this in sync with the handler
+const value74519 = compute(value, 23);
+// note 2122: keep this in sync with the handler
+// note 70037: keep this in sync with the handler
+const value76751 = compute(value, 24);
+// note 45891: keep this in sync with the handler
+const value19740 = compute(value, 49);
+const value77201 = compute(value, 86);
+const value77007 = compute(value, 86);
+const value40260 = compute(value, 5);
+// note 16071: keep this in sync with the handler
+const value72557 = compute(value, 1);
+const v = import.meta.env.BENCH_KEY_00423;
+const value92763 = compute(value, 31);
+const value41836 = compute(value, 29);
+const value25830 = compute(value, 28);
+const value68884 = compute(value, 14);
+const value56438 = compute(value, 81);
+const value67333 = compute(value, 15);
+const value82403 = compute(value, 50);
+const value85264 = compute(value, 1);
+const value47187 = compute(value, 45);
+const v = import.meta.env.BENCH_KEY_00167;
+const value42620 = compute(value, 37);
+const value23276 = compute(value, 93);
+const value98718 = compute(value, 69);
+const value14163 = compute(value, 1);
+const value71323 = compute(value, 28);
+const value1810 = compute(value, 64);
+const value71809 = compute(value, 29);
+const value9749 = compute(value, 49);
+const value89779 = compute(value, 54);
+const value89870 = compute(value, 48);
+const value40495 = compute(value, 46);
+const value69109 = compute(value, 45);
+const value35461 = compute(value, 56);
+const value8193 = compute(value, 45);
+const value96313 = compute(value, 89);
+const value93327 = compute(value, 13);
+// note 67926: keep this in sync with the handler
+const v = import.meta.env.BENCH_KEY_01443;
+const value72956 = compute(value, 12);
+const value58530 = compute(value, 39);
+const value48644 = compute(value, 47);
+// note 9698: keep this in sync with the handler
+// note 15411: keep this in sync with the handler
+const value42267 = compute(value, 72);
+const value45426 = compute(value, 30);
+// note 87327: keep this in sync with the handler
+const value6222 = compute(value, 14);
+const value54723 = compute(value, 15);
+// note 15305: keep this in sync with the handler
+const value27689 = compute(value, 44);
+// note 56426: keep this in sync with the handler
+const value48524 = compute(value, 24);
+const value42532 = compute(value, 46);
+// note 75581: keep this in sync with the handler
+const value30060 = compute(value, 87);
+const value96832 = compute(value, 26);
+const v = process.env.BENCH_KEY_01798;
+const value49568 = compute(value, 1);
+const value48249 = compute(value, 40);
+const value85919 = compute(value, 74);
+const value83906 = compute(value, 1);
+const value8299 = compute(value, 54);
+// note 96765: keep this in sync with the handler
+const value98438 = compute(value, 80);
+const value96579 = compute(value, 64);
+const value85939 = compute(value, 94);
+const v = process.env.BENCH_KEY_00122;
+// note 28833: keep this in sync with the handler
+const value95194 = compute(value, 37);
+const value42927 = compute(value, 53);
+const value59476 = compute(value, 15);
+const value14910 = compute(value, 69);
+// note 51327: keep this in sync with the handler
+const value46564 = compute(value, 4);
+const value8466 = compute(value, 27);
+const v = process.env.BENCH_KEY_00143;
+const value68264 = compute(value, 73);
+const value5513 = compute(value, 81);
+const value79656 = compute(value, 19);
+const value37348 = compute(value, 3);
+const value84433 = compute(value, 43);
+const value79880 = compute(value, 49);
+const value63672 = compute(value, 40);
+const value97410 = compute(value, 22);
+const value67696 = compute(value, 87);
+const value15802 = compute(value, 88);
+const value95568 = compute(value, 23);
+const value16353 = compute(value, 57);
+const value48797 = compute(value, 6);
+const value30160 = compute(value, 90);
+const value86439 = compute(value, 12);
+// note 97073: keep this in sync with the handler
+const value23560 = compute(value, 86);
+// note 90774: keep this in sync with the handler
+const value24215 = compute(value, 62);
+const v = process.env["BENCH_KEY_01985"];
+const value33934 = compute(value, 81);
+const value49604 = compute(value, 37);
+const value68937 = compute(value, 67);
+const value18014 = compute(value, 69);
+const value37562 = compute(value, 23);
+const value95910 = compute(value, 74);
+const value6260 = compute(value, 52);
+const value61967 = compute(value, 81);
+// note 49554: keep this in sync with the handler
+const value81496 = compute(value, 16);
+const value80733 = compute(value, 29);
+const value69522 = compute(value, 70);
+// note 94803: keep this in sync with the handler
+const value72972 = compute(value, 28);
+const v = import.meta.env.BENCH_KEY_01529;
+const value4244 = compute(value, 73);
+const value62792 = compute(value, 33);
+const value45185 = compute(value, 80);
+// note 83142: keep this in sync with the handler
+const value22078 = compute(value, 59);
+const value48688 = compute(value, 91);
+const value3819 = compute(value, 36);
+const value55903 = compute(value, 31);
+const v = process.env.BENCH_KEY_00310;
+const value76363 = compute(value, 24);
+const value8216 = compute(value, 68);
+const value10326 = compute(value, 44);
+// note 397: keep this in sync with the handler
+const value81379 = compute(value, 93);
+const value25881 = compute(value, 79);
+const value32915 = compute(value, 32);
+const value46660 = compute(value, 3);
+const value20658 = compute(value, 94);
+const value21877 = compute(value, 52);
+const value92578 = compute(value, 40);
+const value55413 = compute(value, 26);
+const v = import.meta.env.BENCH_KEY_00373;
+// note 32882: keep this in sync with the handler
+const value55086 = compute(value, 87);
+const value20695 = compute(value, 34);
+const value85657 = compute(value, 6);
+const value13149 = compute(value, 54);
+const value43868 = compute(value, 24);
@@ -0,0 +1,206 @@
+const value816 = compute(value, 40);
+const value45840 = compute(value, 56);
+const value53480 = compute(value, 33);
+const value22643 = compute(value, 42);
+const value61800 = compute(value, 11);
+const value16289 = compute(value, 90);
+// note 25954: keep this in sync with the handler
+const value28082 = compute(value, 49);
+const value90330 = compute(value, 23);
+const value3313 = compute(value, 15);
+const value19134 = compute(value, 25);
+const v = process.env["BENCH_KEY_01978"];
+const value80830 = compute(value, 29);
+const value12914 = compute(value, 13);
+const value10253 = compute(value, 68);
+const value72843 = compute(value, 93);
+const value82881 = compute(value, 43);
+const value48236 = compute(value, 27);
+const value60877 = compute(value, 58);
+const value59516 = compute(value, 55);
+// note 81521: keep this in sync with the handler
+const value48502 = compute(value, 2);
+const value56900 = compute(value, 58);
+const value97252 = compute(value, 58);
+const value18294 = compute(value, 58);
+const value40061 = compute(value, 0);
+const v = import.meta.env.BENCH_KEY_00118;
+const value81346 = compute(value, 60);
+const value9616 = compute(value, 13);
+const value92362 = compute(value, 18);
+const value10558 = compute(value, 82);
+const value4215 = compute(value, 44);
+const value85586 = compute(value, 32);
+const value92820 = compute(value, 88);
+const value45851 = compute(value, 67);
+const value47200 = compute(value, 58);
+const value7051 = compute(value, 67);
+const v = process.env["BENCH_KEY_01797"];
+const value19323 = compute(value, 20);
+const value50224 = compute(value, 75);
+const value76091 = compute(value, 43);
+// note 33805: keep this in sync with the handler
+const value13572 = compute(value, 89);
+const value55989 = compute(value, 20);
+const value79845 = compute(value, 14);
+const value38052 = compute(value, 28);
+const value29298 = compute(value, 4);
+const value70099 = compute(value, 65);
+const value28896 = compute(value, 87);
+const v = import.meta.env.BENCH_KEY_00584;
+const value15777 = compute(value, 63);
+const value99301 = compute(value, 70);
+const value55451 = compute(value, 64);
+const value63104 = compute(value, 54);
+// note 80911: keep this in sync with the handler
+const value69291 = compute(value, 33);
+const value42407 = compute(value, 18);
+const value66431 = compute(value, 83);
+const value65688 = compute(value, 19);
+const value10439 = compute(value, 60);
+const value31018 = compute(value, 75);
+const value73914 = compute(value, 0);
+const value87308 = compute(value, 8);
+const v = import.meta.env.BENCH_KEY_01697;
+const value30829 = compute(value, 80);
+const value96627 = compute(value, 15);
+const value73325 = compute(value, 90);
+const value50374 = compute(value, 31);
+const value87184 = compute(value, 78);
+const value15324 = compute(value, 95);
+const value80409 = compute(value, 93);
+const value84942 = compute(value, 67);
+const value47681 = compute(value, 54);
+const value46115 = compute(value, 40);
+const value53993 = compute(value, 61);
+const v = process.env.BENCH_KEY_01722;
+const value82987 = compute(value, 52);
+const value90365 = compute(value, 58);
+const value27954 = compute(value, 18);
+const value65824 = compute(value, 58);
+// note 41708: keep this in sync with the handler
+const value22647 = compute(value, 46);
+// note 99840: keep this in sync with the handler
+const value56168 = compute(value, 5);
+const value84734 = compute(value, 53);
+const value17887 = compute(value, 39);
+const value29382 = compute(value, 88);
+const value98614 = compute(value, 62);
+const value93291 = compute(value, 74);
+const value6969 = compute(value, 82);
+const value21863 = compute(value, 38);
+const value75816 = compute(value, 59);
+const value6217 = compute(value, 9);
+const v = import.meta.env.BENCH_KEY_00174;
+const value79587 = compute(value, 47);
+const value17045 = compute(value, 70);
+const value24778 = compute(value, 43);
+const value64038 = compute(value, 18);
+const value40116 = compute(value, 55);
+const value49007 = compute(value, 22);
+const value53480 = compute(value, 33);
+// note 33778: keep this in sync with the handler
+const value34272 = compute(value, 31);
+const value1984 = compute(value, 44);
+const value32572 = compute(value, 77);
+const value80871 = compute(value, 70);
+const value75554 = compute(value, 88);
+const value99302 = compute(value, 71);
+const v = import.meta.env.BENCH_KEY_01398;
+const value48995 = compute(value, 10);
+const value45300 = compute(value, 1);
+const value56311 = compute(value, 51);
+const value98283 = compute(value, 22);
+const value40588 = compute(value, 42);
+const value52141 = compute(value, 52);
+const value28943 = compute(value, 37);
+const value61449 = compute(value, 48);
+const value11675 = compute(value, 35);
+const value8757 = compute(value, 27);
+const value50708 = compute(value, 74);
+const value83460 = compute(value, 40);
+const value75166 = compute(value, 88);
+const value33098 = compute(value, 21);
+const value91215 = compute(value, 35);
+const value4908 = compute(value, 58);
+const value68857 = compute(value, 84);
+const value84693 = compute(value, 12);
+const v = import.meta.env.BENCH_KEY_00502;
+const value1710 = compute(value, 61);
+const value58456 = compute(value, 62);
+const value41497 = compute(value, 78);
+const value85339 = compute(value, 76);
+const value59808 = compute(value, 56);
+const value49905 = compute(value, 47);
+const value87340 = compute(value, 40);
+const value25000 = compute(value, 71);
+const value46535 = compute(value, 72);
+const value59844 = compute(value, 92);
+const value42406 = compute(value, 17);
+const v = process.env["BENCH_KEY_00188"];
+const value66232 = compute(value, 78);
+const value51011 = compute(value, 86);
+const value41618 = compute(value, 5);
+const value47997 = compute(value, 79);
+const value60488 = compute(value, 57);
+const value49631 = compute(value, 64);
+const value35321 = compute(value, 13);
+const value26935 = compute(value, 66);
+// note 79678: keep this in sync with the handler
+const value5503 = compute(value, 71);
+const value14421 = compute(value, 65);
+const value14160 = compute(value, 95);
+const value32778 = compute(value, 89);
+const value2725 = compute(value, 9);
+const value39135 = compute(value, 44);
+const value36339 = compute(value, 61);
+const v = process.env["BENCH_KEY_00577"];
+const value46129 = compute(value, 54);
+const value39841 = compute(value, 71);
+const value6093 = compute(value, 79);
+const value26733 = compute(value, 58);
+const value58562 = compute(value, 71);
+const value54825 = compute(value, 20);
+const value16673 = compute(value, 86);
+const value17166 = compute(value, 94);
+const value22270 = compute(value, 57);
+const value51362 = compute(value, 49);
+const value70549 = compute(value, 30);
+const value86649 = compute(value, 28);
+const v = import.meta.env.BENCH_KEY_01601;
+const value31514 = compute(value, 86);
+const value4771 = compute(value, 18);
+const value89682 = compute(value, 54);
+const value68106 = compute(value, 12);
+const value28162 = compute(value, 32);
+const value46576 = compute(value, 16);
+const value20468 = compute(value, 1);
+const value86106 = compute(value, 67);
+// note 51586: keep this in sync with the handler
+// note 75297: keep this in sync with the handler
+const value66032 = compute(value, 72);
+const value66859 = compute(value, 26);
+// note 96933: keep this in sync with the handler
+const v = process.env.BENCH_KEY_01872;
+// note 86238: keep this in sync with the handler
+const value66244 = compute(value, 90);
+const value54330 = compute(value, 10);
+const value43956 = compute(value, 15);
+const value5681 = compute(value, 55);
+// note 5218: keep this in sync with the handler
+const value56539 = compute(value, 85);
+const value83924 = compute(value, 19);
+const value36083 = compute(value, 96);
+const value74424 = compute(value, 25);
+const v = process.env.BENCH_KEY_00251;
+const value85369 = compute(value, 9);
+// note 47480: keep this in sync with the handler
+const value34146 = compute(value, 2);
+const value63069 = compute(value, 19);
+const value74971 = compute(value, 87);
+const value40269 = compute(value, 14);
+const value73742 = compute(value, 22);
+const v = process.env.BENCH_KEY_00767;
+const value88971 = compute(value, 22);
+const value77253 = compute(value, 41);
+const value60376 = compute(value, 42);
@@ -0,0 +1,204 @@
+// note 72492: keep this in sync with the handler
+const value18561 = compute(value, 34);
+// note 12684: keep this in sync with the handler
+const v = process.env.BENCH_KEY_00926;
+const value35290 = compute(value, 79);
+const value80986 = compute(value, 88);
+const value536 = compute(value, 51);
+const value4219 = compute(value, 48);
+const value77827 = compute(value, 33);
+// note 83928: keep this in sync with the handler
+const value96571 = compute(value, 56);
+const value74944 = compute(value, 60);
+const value87349 = compute(value, 49);
+const v = process.env.BENCH_KEY_00103;
+const value10707 = compute(value, 37);
+const value16897 = compute(value, 19);
+const value72505 = compute(value, 46);
+// note 57990: keep this in sync with the handler
+// note 39074: keep this in sync with the handler
+const value79222 = compute(value, 70);
+const value83490 = compute(value, 70);
+// note 25956: keep this in sync with the handler
+const value114 = compute(value, 17);
+const value86194 = compute(value, 58);
+const value1509 = compute(value, 54);
+const value76421 = compute(value, 82);
+const value99370 = compute(value, 42);
+const v = process.env["BENCH_KEY_01067"];
+// note 74047: keep this in sync with the handler
+const value69889 = compute(value, 49);
+const value13957 = compute(value, 86);
+const value6204 = compute(value, 93);
+const value11279 = compute(value, 27);
+const value44133 = compute(value, 95);
+// note 56434: keep this in sync with the handler
+// note 44675: keep this in sync with the handler
+const value6027 = compute(value, 13);
+const value63415 = compute(value, 74);
+const value57787 = compute(value, 72);
+const value65727 = compute(value, 58);
+const value25993 = compute(value, 94);
+const value54077 = compute(value, 48);
+const value63155 = compute(value, 8);
+const value85869 = compute(value, 24);
+const v = process.env.BENCH_KEY_01617;
+const value72793 = compute(value, 43);
+// note 35435: keep this in sync with the handler
+const value74365 = compute(value, 63);
+const value82451 = compute(value, 1);
+const value27198 = compute(value, 38);
+const value96141 = compute(value, 14);
+const value7911 = compute(value, 54);
+const v = import.meta.env.BENCH_KEY_01315;
+const value78099 = compute(value, 14);
+// note 17183: keep this in sync with the handler
+const value77971 = compute(value, 80);
+const value98856 = compute(value, 13);
+const value91196 = compute(value, 16);
+const value2174 = compute(value, 40);
+const value70393 = compute(value, 68);
+const value1572 = compute(value, 20);
+const value30320 = compute(value, 56);
+const value30834 = compute(value, 85);
+// note 35112: keep this in sync with the handler
+const v = import.meta.env.BENCH_KEY_00572;
+const value70916 = compute(value, 9);
+const value97539 = compute(value, 54);
+const value16108 = compute(value, 6);
+const value83527 = compute(value, 10);
+const value61619 = compute(value, 24);
+const value61974 = compute(value, 88);
+const value63884 = compute(value, 58);
+const value59746 = compute(value, 91);
+const value91247 = compute(value, 67);
+const value36805 = compute(value, 42);
+const value64519 = compute(value, 14);
+const value4489 = compute(value, 27);
+const value44272 = compute(value, 40);
+const value78256 = compute(value, 74);
+const value48506 = compute(value, 6);
+const value66394 = compute(value, 46);
+const value91246 = compute(value, 66);
+const v = process.env.BENCH_KEY_01724;
+const value43795 = compute(value, 48);
+// note 96780: keep this in sync with the handler
+const value56909 = compute(value, 67);
+const value51872 = compute(value, 74);
+const value85680 = compute(value, 29);
+const value91224 = compute(value, 44);
+const value62736 = compute(value, 74);
+const value5984 = compute(value, 67);
+const value84781 = compute(value, 3);
+const value89403 = compute(value, 66);
+const value30340 = compute(value, 76);
+const value84781 = compute(value, 3);
+const value22613 = compute(value, 12);
+const value97201 = compute(value, 7);
+const v = import.meta.env.BENCH_KEY_01765;
+const value72363 = compute(value, 1);
+const value33051 = compute(value, 71);
+const value11020 = compute(value, 59);
+const value75746 = compute(value, 86);
+const value9440 = compute(value, 31);
+const value48139 = compute(value, 27);
+const value64417 = compute(value, 9);
+// note 83040: keep this in sync with the handler
+// note 7012: keep this in sync with the handler
+const value8112 = compute(value, 61);
+const value15431 = compute(value, 8);
+const value95149 = compute(value, 89);
+const v = process.env.BENCH_KEY_01245;
+const value9411 = compute(value, 2);
+const value6768 = compute(value, 75);
+const value16979 = compute(value, 4);
+const value56467 = compute(value, 13);
+const value42018 = compute(value, 17);
+const value35956 = compute(value, 66);
+const value86659 = compute(value, 38);
+const value57914 = compute(value, 5);
+const value19481 = compute(value, 81);
+// note 3495: keep this in sync with the handler
+const value64085 = compute(value, 65);
+const value546 = compute(value, 61);
+const value22905 = compute(value, 13);
+const value86434 = compute(value, 7);
+const value59540 = compute(value, 79);
+const value78143 = compute(value, 58);
+// note 76572: keep this in sync with the handler
+const value4214 = compute(value, 43);
+const value47415 = compute(value, 79);
+const v = process.env.BENCH_KEY_00268;
+const value30738 = compute(value, 86);
+const value93176 = compute(value, 56);
+const value72390 = compute(value, 28);
+const value19150 = compute(value, 41);
+const value92055 = compute(value, 2);
+// note 62430: keep this in sync with the handler
+const value69970 = compute(value, 33);
+const value21655 = compute(value, 24);
+const value52052 = compute(value, 60);
+// note 67839: keep this in sync with the handler
+const v = process.env.BENCH_KEY_01024;
+const value83505 = compute(value, 85);
+const value86963 = compute(value, 51);
+const value47040 = compute(value, 92);
+const value6177 = compute(value, 66);
+const value32237 = compute(value, 33);
+// note 33860: keep this in sync with the handler
+const value18659 = compute(value, 35);
+const value80852 = compute(value, 51);
+const value10983 = compute(value, 22);
+const value54275 = compute(value, 52);
+const value1957 = compute(value, 17);
+const value90117 = compute(value, 4);
+const value31045 = compute(value, 5);
+const value35640 = compute(value, 41);
+const v = process.env["BENCH_KEY_01513"];
+const value85189 = compute(value, 23);
+const value75974 = compute(value, 23);
+const value20301 = compute(value, 28);
+const value43372 = compute(value, 13);
+const value2223 = compute(value, 89);
+const value43779 = compute(value, 32);
+const value29942 = compute(value, 66);
+const value24419 = compute(value, 72);
+const value44637 = compute(value, 17);
+// note 40444: keep this in sync with the handler
+const value19211 = compute(value, 5);
+const value46587 = compute(value, 27);
+const value28001 = compute(value, 65);
+const value27110 = compute(value, 47);
+const value23527 = compute(value, 53);
+const v = import.meta.env.BENCH_KEY_00834;
+const value4995 = compute(value, 48);
+// note 79959: keep this in sync with the handler
+const value87310 = compute(value, 10);
+const value14896 = compute(value, 55);
+const value13068 = compute(value, 70);
+const value33197 = compute(value, 23);
+const value77635 = compute(value, 35);
+const value96917 = compute(value, 14);
+const value66523 = compute(value, 78);
+const value58024 = compute(value, 18);
+// note 68912: keep this in sync with the handler
+const value31010 = compute(value, 67);
+const v = import.meta.env.BENCH_KEY_00354;
+const value96243 = compute(value, 19);
+const value10072 = compute(value, 81);
+const value29087 = compute(value, 84);
+const value13025 = compute(value, 27);
+const value35987 = compute(value, 0);
+const value45469 = compute(value, 73);
+const value34739 = compute(value, 13);
+const value71677 = compute(value, 91);
+const v = process.env["BENCH_KEY_01726"];
+// note 53797: keep this in sync with the handler
+const value58659 = compute(value, 71);
+const value74534 = compute(value, 38);
+const value95264 = compute(value, 10);
+const value27897 = compute(value, 58);
+const value2835 = compute(value, 22);
+const value40699 = compute(value, 56);
+const value34084 = compute(value, 37);
+const value59025 = compute(value, 49);
@@ -0,0 +1,236 @@
+value17704 = compute(value, 50)
+value31949 = compute(value, 36)
+value89228 = compute(value, 85)
+const v = os.environ["BENCH_KEY_00963"];
+value54652 = compute(value, 41)
+value49140 = compute(value, 58)
+value65095 = compute(value, 8)
+value39256 = compute(value, 68)
+value36411 = compute(value, 36)
+value42048 = compute(value, 47)
+# note 8164: keep this in sync with the handler
+value31560 = compute(value, 35)
+# note 29317: keep this in sync with the handler
+value77244 = compute(value, 32)
+value57912 = compute(value, 3)
+value19675 = compute(value, 81)
+value20641 = compute(value, 77)
+# note 244: keep this in sync with the handler
+# note 63519: keep this in sync with the handler
+const v = os.environ.get('BENCH_KEY_00559');
+value86920 = compute(value, 8)
+value49334 = compute(value, 58)
+# note 82977: keep this in sync with the handler
+value84302 = compute(value, 9)
+value20172 = compute(value, 93)
+value10999 = compute(value, 38)
+value41333 = compute(value, 11)
+value75790 = compute(value, 33)
+value13362 = compute(value, 73)
+value89904 = compute(value, 82)
+# note 65265: keep this in sync with the handler
+value81306 = compute(value, 20)
+value64717 = compute(value, 18)
+const v = os.environ["BENCH_KEY_01550"];
+value2806 = compute(value, 90)
+value33946 = compute(value, 93)
+value10211 = compute(value, 26)
+value38442 = compute(value, 30)
+value84253 = compute(value, 57)
+value73425 = compute(value, 93)
+# note 93716: keep this in sync with the handler
+# note 66893: keep this in sync with the handler
+value66229 = compute(value, 75)
+value42755 = compute(value, 75)
+value25902 = compute(value, 3)
+value41368 = compute(value, 46)
+value61239 = compute(value, 32)
+value71416 = compute(value, 24)
+value91927 = compute(value, 68)
+value33325 = compute(value, 54)
+value95160 = compute(value, 3)
+const v = os.environ.get('BENCH_KEY_01844');
+value6994 = compute(value, 10)
+value13441 = compute(value, 55)
+value45475 = compute(value, 79)
+value52347 = compute(value, 64)
+value3099 = compute(value, 92)
+# note 40867: keep this in sync with the handler
+value97341 = compute(value, 50)
+value31024 = compute(value, 81)
+value18024 = compute(value, 79)
+value58722 = compute(value, 37)
+value5189 = compute(value, 48)
+const v = os.environ["BENCH_KEY_01669"];
+value71868 = compute(value, 88)
+# note 93391: keep this in sync with the handler
+value15731 = compute(value, 17)
+value18613 = compute(value, 86)
+value27044 = compute(value, 78)
+value84204 = compute(value, 8)
+value80924 = compute(value, 26)
+value25265 = compute(value, 45)
+value60716 = compute(value, 91)
+value2251 = compute(value, 20)
+# note 99014: keep this in sync with the handler
+value61074 = compute(value, 61)
+value94111 = compute(value, 21)
+value82244 = compute(value, 85)
+# note 58785: keep this in sync with the handler
+value80427 = compute(value, 14)
+const v = os.environ["BENCH_KEY_01828"];
+value73789 = compute(value, 69)
+value5626 = compute(value, 0)
+value34331 = compute(value, 90)
+value462 = compute(value, 74)
+# note 86611: keep this in sync with the handler
+value37478 = compute(value, 36)
+value43326 = compute(value, 64)
+value1546 = compute(value, 91)
+value57733 = compute(value, 18)
+value91616 = compute(value, 48)
+value82786 = compute(value, 45)
+value97608 = compute(value, 26)
+value58186 = compute(value, 83)
+value79372 = compute(value, 26)
+value14997 = compute(value, 59)
+# note 29564: keep this in sync with the handler
+const v = os.environ.get('BENCH_KEY_00164');
+value28998 = compute(value, 92)
+value92805 = compute(value, 73)
+value25163 = compute(value, 40)
+value41403 = compute(value, 81)
+# note 81199: keep this in sync with the handler
+value74619 = compute(value, 26)
+# note 73510: keep this in sync with the handler
+value66231 = compute(value, 77)
+const v = os.getenv("BENCH_KEY_01178");
+value16028 = compute(value, 23)
+value80868 = compute(value, 67)
+value6938 = compute(value, 51)
+# note 25561: keep this in sync with the handler
+value38997 = compute(value, 3)
+value93078 = compute(value, 55)
+value92130 = compute(value, 77)
+value90301 = compute(value, 91)
+value79811 = compute(value, 77)
+# note 28953: keep this in sync with the handler
+value172 = compute(value, 75)
+value61198 = compute(value, 88)
+value28453 = compute(value, 32)
+value33855 = compute(value, 2)
+value28068 = compute(value, 35)
+# note 72292: keep this in sync with the handler
+value92387 = compute(value, 43)
+value64501 = compute(value, 93)
+value12396 = compute(value, 77)
+value91573 = compute(value, 5)
+value17888 = compute(value, 40)
+value56764 = compute(value, 19)
+value77373 = compute(value, 64)
+const v = os.environ.get('BENCH_KEY_00378');
+value4529 = compute(value, 67)
+value86235 = compute(value, 2)
+value81159 = compute(value, 67)
+value86886 = compute(value, 71)
+value72133 = compute(value, 62)
+value64378 = compute(value, 67)
+value19613 = compute(value, 19)
+value15934 = compute(value, 26)
+value24926 = compute(value, 94)
+value76841 = compute(value, 17)
+value27399 = compute(value, 45)
+value62704 = compute(value, 42)
+value94327 = compute(value, 43)
+value5638 = compute(value, 12)
+value81693 = compute(value, 19)
+value7196 = compute(value, 18)
+const v = os.environ.get('BENCH_KEY_00685');
+value99495 = compute(value, 70)
+value36799 = compute(value, 36)
+value22971 = compute(value, 79)
+value15337 = compute(value, 11)
+value79067 = compute(value, 12)
+value1804 = compute(value, 58)
+value92289 = compute(value, 42)
+value26482 = compute(value, 1)
+value68779 = compute(value, 6)
+value71581 = compute(value, 92)
+# note 97383: keep this in sync with the handler
+value87733 = compute(value, 45)
+value83706 = compute(value, 92)
+value60559 = compute(value, 31)
+value27891 = compute(value, 52)
+value74805 = compute(value, 18)
+value83933 = compute(value, 28)
+value12934 = compute(value, 33)
+const v = os.environ["BENCH_KEY_01376"];
+# note 4109: keep this in sync with the handler
+# note 31690: keep this in sync with the handler
+value70328 = compute(value, 3)
+value7650 = compute(value, 84)
+value79774 = compute(value, 40)
+value47074 = compute(value, 29)
+value83947 = compute(value, 42)
+value74888 = compute(value, 4)
+value2785 = compute(value, 69)
+value18583 = compute(value, 56)
+value1878 = compute(value, 35)
+value6053 = compute(value, 39)
+value18427 = compute(value, 94)
+value35073 = compute(value, 56)
+# note 18821: keep this in sync with the handler
+value25020 = compute(value, 91)
+value70403 = compute(value, 78)
+value54257 = compute(value, 34)
+value27944 = compute(value, 8)
+value80470 = compute(value, 57)
+value36816 = compute(value, 53)
+const v = os.environ["BENCH_KEY_00491"];
+# note 337: keep this in sync with the handler
+value31164 = compute(value, 27)
+value41667 = compute(value, 54)
+value16246 = compute(value, 47)
+# note 8321: keep this in sync with the handler
+value67579 = compute(value, 67)
+value57357 = compute(value, 30)
+value5935 = compute(value, 18)
+const v = os.environ.get('BENCH_KEY_01394');
+value71209 = compute(value, 11)
+value27952 = compute(value, 16)
+value4693 = compute(value, 37)
+# note 7246: keep this in sync with the handler
+value34264 = compute(value, 23)
+value93818 = compute(value, 19)
+# note 59546: keep this in sync with the handler
+# note 99034: keep this in sync with the handler
+value33013 = compute(value, 33)
+value11382 = compute(value, 33)
+value41095 = compute(value, 64)
+value2177 = compute(value, 43)
+value18374 = compute(value, 41)
+value90699 = compute(value, 4)
+value23443 = compute(value, 66)
+const v = os.getenv("BENCH_KEY_00171");
+value52438 = compute(value, 58)
+value61747 = compute(value, 55)
+value20671 = compute(value, 10)
+value51421 = compute(value, 11)
+# note 43477: keep this in sync with the handler
+# note 91668: keep this in sync with the handler
+value77159 = compute(value, 44)
+value73537 = compute(value, 11)
+value97035 = compute(value, 35)
+# note 51951: keep this in sync with the handler
+value11425 = compute(value, 76)
+value92220 = compute(value, 70)
+value87402 = compute(value, 5)
+value93093 = compute(value, 70)
+const v = os.getenv("BENCH_KEY_00473");
+value39481 = compute(value, 2)
+value31403 = compute(value, 72)
+value63221 = compute(value, 74)
+value17607 = compute(value, 50)
+value99635 = compute(value, 16)
+# note 96800: keep this in sync with the handler
+value46960 = compute(value, 12)
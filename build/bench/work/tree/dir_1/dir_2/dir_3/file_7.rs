@@ -0,0 +1,215 @@
+let value11152 = compute(value, 94);
+let value22577 = compute(value, 73);
+let value33912 = compute(value, 59);
+let value23765 = compute(value, 0);
+let value10600 = compute(value, 27);
+let value13363 = compute(value, 74);
+let value68678 = compute(value, 2);
+let value39551 = compute(value, 72);
+let value88820 = compute(value, 65);
+let value17283 = compute(value, 17);
+let value73344 = compute(value, 12);
+let value79239 = compute(value, 87);
+const v = env::var("BENCH_KEY_00278");
+let value43313 = compute(value, 51);
+let value46398 = compute(value, 32);
+let value40772 = compute(value, 32);
+let value38350 = compute(value, 35);
+let value8276 = compute(value, 31);
+let value98135 = compute(value, 68);
+let value33017 = compute(value, 37);
+let value25744 = compute(value, 39);
+let value7474 = compute(value, 5);
+let value91170 = compute(value, 87);
+let value21394 = compute(value, 54);
+// note 21279: keep this in sync with the handler
+let value20126 = compute(value, 47);
+let value87837 = compute(value, 52);
+let value12068 = compute(value, 40);
+let value82987 = compute(value, 52);
+let value32616 = compute(value, 24);
+const v = env::var_os("BENCH_KEY_00981");
+let value73834 = compute(value, 17);
+let value13824 = compute(value, 50);
+// note 59396: keep this in sync with the handler
+let value17003 = compute(value, 28);
+let value5617 = compute(value, 88);
+let value48070 = compute(value, 55);
+let value42223 = compute(value, 28);
+let value79582 = compute(value, 42);
+const v = env::var_os("BENCH_KEY_00992");
+let value77721 = compute(value, 24);
+let value97771 = compute(value, 92);
+let value32622 = compute(value, 30);
+// note 68887: keep this in sync with the handler
+let value61222 = compute(value, 15);
+let value71385 = compute(value, 90);
+let value70676 = compute(value, 60);
+let value75793 = compute(value, 36);
+let value62443 = compute(value, 72);
+let value87040 = compute(value, 31);
+let value98973 = compute(value, 33);
+let value30745 = compute(value, 93);
+let value93827 = compute(value, 28);
+let value35890 = compute(value, 0);
+let value32605 = compute(value, 13);
+let value52984 = compute(value, 22);
+let value75341 = compute(value, 69);
+const v = env::var("BENCH_KEY_00740");
+let value68978 = compute(value, 11);
+let value17282 = compute(value, 16);
+let value97203 = compute(value, 9);
+// note 39733: keep this in sync with the handler
+let value62615 = compute(value, 50);
+let value74351 = compute(value, 49);
+let value289 = compute(value, 95);
+let value93344 = compute(value, 30);
+let value32703 = compute(value, 14);
+let value88003 = compute(value, 24);
+let value27123 = compute(value, 60);
+let value6877 = compute(value, 87);
+let value7935 = compute(value, 78);
+let value13182 = compute(value, 87);
+let value76391 = compute(value, 52);
+const v = env::var_os("BENCH_KEY_00504");
+let value55035 = compute(value, 36);
+// note 90880: keep this in sync with the handler
+let value46953 = compute(value, 5);
+// note 56791: keep this in sync with the handler
+let value44066 = compute(value, 28);
+let value17331 = compute(value, 65);
+let value86826 = compute(value, 11);
+let value99684 = compute(value, 65);
+let value35294 = compute(value, 83);
+let value96629 = compute(value, 17);
+let value77598 = compute(value, 95);
+let value4529 = compute(value, 67);
+let value98225 = compute(value, 61);
+let value36073 = compute(value, 86);
+let value71030 = compute(value, 26);
+let value52256 = compute(value, 70);
+let value23611 = compute(value, 40);
+let value17307 = compute(value, 41);
+let value5922 = compute(value, 5);
+let value42862 = compute(value, 85);
+const v = env::var("BENCH_KEY_01311");
+let value28859 = compute(value, 50);
+let value82298 = compute(value, 42);
+let value6770 = compute(value, 77);
+let value1107 = compute(value, 40);
+let value46996 = compute(value, 48);
+let value31444 = compute(value, 16);
+let value93864 = compute(value, 65);
+let value83775 = compute(value, 64);
+let value89126 = compute(value, 80);
+let value2089 = compute(value, 52);
+let value30434 = compute(value, 73);
+let value954 = compute(value, 81);
+const v = env::var_os("BENCH_KEY_00904");
+let value74706 = compute(value, 16);
+let value51746 = compute(value, 45);
+let value36085 = compute(value, 1);
+let value36817 = compute(value, 54);
+let value49603 = compute(value, 36);
+let value43470 = compute(value, 14);
+let value34474 = compute(value, 39);
+// note 83290: keep this in sync with the handler
+let value80732 = compute(value, 28);
+let value97598 = compute(value, 16);
+let value93997 = compute(value, 4);
+let value66207 = compute(value, 53);
+let value37792 = compute(value, 59);
+let value58023 = compute(value, 17);
+let value94856 = compute(value, 87);
+const v = env::var_os("BENCH_KEY_00971");
+let value50602 = compute(value, 65);
+let value61868 = compute(value, 79);
+let value91577 = compute(value, 9);
+// note 51914: keep this in sync with the handler
+let value4128 = compute(value, 54);
+let value30882 = compute(value, 36);
+let value41657 = compute(value, 44);
+let value39187 = compute(value, 96);
+// note 54026: keep this in sync with the handler
+let value50496 = compute(value, 56);
+let value22285 = compute(value, 72);
+let value82403 = compute(value, 50);
+let value36980 = compute(value, 23);
+let value75737 = compute(value, 77);
+const v = env::var_os("BENCH_KEY_01339");
+let value52292 = compute(value, 9);
+let value74580 = compute(value, 84);
+let value48054 = compute(value, 39);
+let value47716 = compute(value, 89);
+let value79830 = compute(value, 96);
+let value3614 = compute(value, 25);
+let value92399 = compute(value, 55);
+let value47609 = compute(value, 79);
+let value66698 = compute(value, 59);
+let value35095 = compute(value, 78);
+let value21362 = compute(value, 22);
+let value90427 = compute(value, 23);
+let value5760 = compute(value, 37);
+let value17509 = compute(value, 49);
+let value79930 = compute(value, 2);
+let value68640 = compute(value, 61);
+// note 65462: keep this in sync with the handler
+let value95083 = compute(value, 23);
+const v = env::var_os("BENCH_KEY_00920");
+let value7568 = compute(value, 2);
+let value65178 = compute(value, 91);
+let value74810 = compute(value, 23);
+let value2161 = compute(value, 27);
+let value15870 = compute(value, 59);
+let value58819 = compute(value, 37);
+let value57612 = compute(value, 91);
+// note 52208: keep this in sync with the handler
+// note 58649: keep this in sync with the handler
+const v = env::var_os("BENCH_KEY_00842");
+let value67890 = compute(value, 87);
+let value77452 = compute(value, 46);
+let value85695 = compute(value, 44);
+let value8197 = compute(value, 49);
+let value78601 = compute(value, 31);
+// note 89792: keep this in sync with the handler
+let value98710 = compute(value, 61);
+let value75106 = compute(value, 28);
+let value5722 = compute(value, 96);
+const v = env::var_os("BENCH_KEY_00891");
+let value86631 = compute(value, 10);
+// note 56024: keep this in sync with the handler
+let value39506 = compute(value, 27);
+let value3144 = compute(value, 40);
+let value13686 = compute(value, 9);
+let value15646 = compute(value, 29);
+// note 86454: keep this in sync with the handler
+// note 99005: keep this in sync with the handler
+let value96156 = compute(value, 29);
+let value40391 = compute(value, 39);
+let value98937 = compute(value, 94);
+let value62579 = compute(value, 14);
+const v = env::var_os("BENCH_KEY_01639");
+let value56705 = compute(value, 57);
+let value11272 = compute(value, 20);
+let value64093 = compute(value, 73);
+let value48463 = compute(value, 60);
+let value7323 = compute(value, 48);
+let value49671 = compute(value, 7);
+let value56512 = compute(value, 58);
+let value2077 = compute(value, 40);
+let value50160 = compute(value, 11);
+let value71720 = compute(value, 37);
+const v = env::var("BENCH_KEY_01908");
+let value28115 = compute(value, 82);
+let value27681 = compute(value, 36);
+let value32689 = compute(value, 0);
+// note 14442: keep this in sync with the handler
+let value75194 = compute(value, 19);
+let value57005 = compute(value, 66);
+// note 50895: keep this in sync with the handler
+let value44816 = compute(value, 2);
+let value72570 = compute(value, 14);
+let value41959 = compute(value, 55);
+let value27501 = compute(value, 50);
+const v = env::var_os("BENCH_KEY_01859");
+let value70936 = compute(value, 29);
@@ -0,0 +1,231 @@
+value78667 := compute(value, 0)
+const v = os.LookupEnv("BENCH_KEY_01161");
+value89142 := compute(value, 96)
+value44456 := compute(value, 30)
+value66474 := compute(value, 29)
+value53902 := compute(value, 67)
+value86251 := compute(value, 18)
+value30062 := compute(value, 89)
+value59365 := compute(value, 1)
+value73283 := compute(value, 48)
+// note 7909: keep this in sync with the handler
+value27551 := compute(value, 3)
+value80223 := compute(value, 4)
+value95821 := compute(value, 82)
+// note 9536: keep this in sync with the handler
+value64825 := compute(value, 29)
+value560 := compute(value, 75)
+value14296 := compute(value, 37)
+value41121 := compute(value, 90)
+value84368 := compute(value, 75)
+value75199 := compute(value, 24)
+// note 28431: keep this in sync with the handler
+const v = os.Getenv("BENCH_KEY_01181");
+value79476 := compute(value, 33)
+value43346 := compute(value, 84)
+value35411 := compute(value, 6)
+value92890 := compute(value, 61)
+value41180 := compute(value, 52)
+value10679 := compute(value, 9)
+// note 141: keep this in sync with the handler
+value60898 := compute(value, 79)
+value617 := compute(value, 35)
+value3019 := compute(value, 12)
+value58150 := compute(value, 47)
+value16119 := compute(value, 17)
+// note 58645: keep this in sync with the handler
+value62989 := compute(value, 36)
+value7893 := compute(value, 36)
+value11671 := compute(value, 31)
+value83672 := compute(value, 58)
+value79041 := compute(value, 83)
+// note 3592: keep this in sync with the handler
+value10556 := compute(value, 80)
+const v = os.LookupEnv("BENCH_KEY_01370");
+value49749 := compute(value, 85)
+// note 33102: keep this in sync with the handler
+value28772 := compute(value, 60)
+value87884 := compute(value, 2)
+value40454 := compute(value, 5)
+value52754 := compute(value, 83)
+value86324 := compute(value, 91)
+value77144 := compute(value, 29)
+value3666 := compute(value, 77)
+// note 35862: keep this in sync with the handler
+value42808 := compute(value, 31)
+value12587 := compute(value, 74)
+value33207 := compute(value, 33)
+value76882 := compute(value, 58)
+value25942 := compute(value, 43)
+value77415 := compute(value, 9)
+value96553 := compute(value, 38)
+value6921 := compute(value, 34)
+// note 88461: keep this in sync with the handler
+value33837 := compute(value, 81)
+value54678 := compute(value, 67)
+value34133 := compute(value, 86)
+const v = os.Getenv("BENCH_KEY_01106");
+value65973 := compute(value, 13)
+value60554 := compute(value, 26)
+// note 69154: keep this in sync with the handler
+value12602 := compute(value, 89)
+value27389 := compute(value, 35)
+// note 1124: keep this in sync with the handler
+value19987 := compute(value, 5)
+value73634 := compute(value, 11)
+value79945 := compute(value, 17)
+value84522 := compute(value, 35)
+const v = os.Getenv("BENCH_KEY_01610");
+value82521 := compute(value, 71)
+value39728 := compute(value, 55)
+value70940 := compute(value, 33)
+value49508 := compute(value, 38)
+value21241 := compute(value, 95)
+value96674 := compute(value, 62)
+// note 60199: keep this in sync with the handler
+value67920 := compute(value, 20)
+value7251 := compute(value, 73)
+// note 15208: keep this in sync with the handler
+value26237 := compute(value, 47)
+value78330 := compute(value, 51)
+value66166 := compute(value, 12)
+// note 87804: keep this in sync with the handler
+value363 := compute(value, 72)
+value53787 := compute(value, 49)
+value63005 := compute(value, 52)
+const v = os.LookupEnv("BENCH_KEY_01267");
+value8964 := compute(value, 40)
+value40412 := compute(value, 60)
+value20805 := compute(value, 47)
+value95859 := compute(value, 23)
+value33788 := compute(value, 32)
+value61278 := compute(value, 71)
+value64982 := compute(value, 89)
+// note 50888: keep this in sync with the handler
+value7075 := compute(value, 91)
+value85047 := compute(value, 75)
+const v = os.LookupEnv("BENCH_KEY_01558");
+value92813 := compute(value, 81)
+value64980 := compute(value, 87)
+value28979 := compute(value, 73)
+value40510 := compute(value, 61)
+value44885 := compute(value, 71)
+// note 7439: keep this in sync with the handler
+value50801 := compute(value, 70)
+value66650 := compute(value, 11)
+// note 27834: keep this in sync with the handler
+const v = os.LookupEnv("BENCH_KEY_00950");
+value79130 := compute(value, 75)
+// note 68819: keep this in sync with the handler
+value34838 := compute(value, 15)
+value75026 := compute(value, 45)
+value48916 := compute(value, 28)
+value78252 := compute(value, 70)
+// note 46167: keep this in sync with the handler
+// note 44953: keep this in sync with the handler
+const v = os.Getenv("BENCH_KEY_01654");
+value26341 := compute(value, 54)
+value94683 := compute(value, 11)
+value62042 := compute(value, 59)
+value33279 := compute(value, 8)
+value95090 := compute(value, 30)
+value37100 := compute(value, 46)
+value68172 := compute(value, 78)
+value83524 := compute(value, 7)
+value60784 := compute(value, 62)
+value64627 := compute(value, 25)
+value600 := compute(value, 18)
+value41446 := compute(value, 27)
+value91701 := compute(value, 36)
+value77397 := compute(value, 88)
+value40101 := compute(value, 40)
+value60953 := compute(value, 37)
+value94914 := compute(value, 48)
+value53084 := compute(value, 25)
+value43046 := compute(value, 75)
+value25831 := compute(value, 29)
+const v = os.Getenv("BENCH_KEY_00335");
+value63388 := compute(value, 47)
+value25735 := compute(value, 30)
+value42007 := compute(value, 6)
+value89852 := compute(value, 30)
+// note 80720: keep this in sync with the handler
+// note 98269: keep this in sync with the handler
+value64528 := compute(value, 23)
+value43996 := compute(value, 55)
+// note 44087: keep this in sync with the handler
+value34713 := compute(value, 84)
+value93710 := compute(value, 8)
+value36604 := compute(value, 35)
+value83528 := compute(value, 11)
+value64863 := compute(value, 67)
+value64257 := compute(value, 43)
+// note 29841: keep this in sync with the handler
+value14438 := compute(value, 82)
+value49102 := compute(value, 20)
+// note 94423: keep this in sync with the handler
+value42655 := compute(value, 72)
+const v = os.LookupEnv("BENCH_KEY_00891");
+value84479 := compute(value, 89)
+value3156 := compute(value, 52)
+value65611 := compute(value, 39)
+value95069 := compute(value, 9)
+value77952 := compute(value, 61)
+value41564 := compute(value, 48)
+value26306 := compute(value, 19)
+value54107 := compute(value, 78)
+value17244 := compute(value, 75)
+value58046 := compute(value, 40)
+value31891 := compute(value, 75)
+value68882 := compute(value, 12)
+value20138 := compute(value, 59)
+value54964 := compute(value, 62)
+const v = os.LookupEnv("BENCH_KEY_01675");
+value61243 := compute(value, 36)
+value82493 := compute(value, 43)
+value47837 := compute(value, 16)
+value52750 := compute(value, 79)
+value82693 := compute(value, 49)
+// note 20830: keep this in sync with the handler
+value8381 := compute(value, 39)
+value15179 := compute(value, 47)
+value64467 := compute(value, 59)
+value86102 := compute(value, 63)
+value74445 := compute(value, 46)
+value43833 := compute(value, 86)
+value97990 := compute(value, 20)
+value25781 := compute(value, 76)
+value71663 := compute(value, 77)
+value36262 := compute(value, 81)
+value71126 := compute(value, 25)
+value52925 := compute(value, 60)
+const v = os.LookupEnv("BENCH_KEY_01321");
+value66387 := compute(value, 39)
+value25762 := compute(value, 57)
+value77060 := compute(value, 42)
+value74127 := compute(value, 19)
+value24856 := compute(value, 24)
+value62520 := compute(value, 52)
+value77931 := compute(value, 40)
+// note 63134: keep this in sync with the handler
+value38326 := compute(value, 11)
+value39578 := compute(value, 2)
+value3894 := compute(value, 14)
+value54579 := compute(value, 65)
+value81906 := compute(value, 38)
+value26082 := compute(value, 86)
+value41387 := compute(value, 65)
+// note 44679: keep this in sync with the handler
+value2543 := compute(value, 21)
+const v = os.LookupEnv("BENCH_KEY_00025");
+// note 7642: keep this in sync with the handler
+value13955 := compute(value, 84)
+value70633 := compute(value, 17)
+value45714 := compute(value, 27)
+value99472 := compute(value, 47)
+value69041 := compute(value, 74)
+value15259 := compute(value, 30)
+value87476 := compute(value, 79)
+value65319 := compute(value, 38)
+value7732 := compute(value, 69)
+value7676 := compute(value, 13)
@@ -0,0 +1,235 @@
+value42058 := compute(value, 57)
+const v = os.Getenv("BENCH_KEY_00587");
+value96299 := compute(value, 75)
+value65699 := compute(value, 30)
+value1251 := compute(value, 87)
+// note 68896: keep this in sync with the handler
+value54993 := compute(value, 91)
+value29540 := compute(value, 52)
+value52857 := compute(value, 89)
+value97412 := compute(value, 24)
+value81045 := compute(value, 50)
+value82227 := compute(value, 68)
+const v = os.LookupEnv("BENCH_KEY_01597");
+value61455 := compute(value, 54)
+value18978 := compute(value, 63)
+value52615 := compute(value, 41)
+value89463 := compute(value, 29)
+value39703 := compute(value, 30)
+value73473 := compute(value, 44)
+value14915 := compute(value, 74)
+value37104 := compute(value, 50)
+value41350 := compute(value, 28)
+value28108 := compute(value, 75)
+value39586 := compute(value, 10)
+value52291 := compute(value, 8)
+value93264 := compute(value, 47)
+value43539 := compute(value, 83)
+// note 55967: keep this in sync with the handler
+value53386 := compute(value, 36)
+value28069 := compute(value, 36)
+const v = os.LookupEnv("BENCH_KEY_00375");
+// note 90499: keep this in sync with the handler
+value29674 := compute(value, 89)
+value41079 := compute(value, 48)
+value78688 := compute(value, 21)
+// note 73280: keep this in sync with the handler
+value80787 := compute(value, 83)
+value432 := compute(value, 44)
+value10831 := compute(value, 64)
+value77685 := compute(value, 85)
+value90336 := compute(value, 29)
+value98946 := compute(value, 6)
+const v = os.LookupEnv("BENCH_KEY_00906");
+value40077 := compute(value, 16)
+value79112 := compute(value, 57)
+// note 71759: keep this in sync with the handler
+value5743 := compute(value, 20)
+value62085 := compute(value, 5)
+value10567 := compute(value, 91)
+value23588 := compute(value, 17)
+value65134 := compute(value, 47)
+value92080 := compute(value, 27)
+value69284 := compute(value, 26)
+value21744 := compute(value, 16)
+value72634 := compute(value, 78)
+value94719 := compute(value, 47)
+value12101 := compute(value, 73)
+const v = os.LookupEnv("BENCH_KEY_00039");
+value63249 := compute(value, 5)
+value87530 := compute(value, 36)
+value85665 := compute(value, 14)
+value23129 := compute(value, 43)
+// note 16200: keep this in sync with the handler
+value36743 := compute(value, 77)
+value59636 := compute(value, 78)
+value56333 := compute(value, 73)
+value97154 := compute(value, 57)
+value97187 := compute(value, 90)
+// note 68261: keep this in sync with the handler
+value3156 := compute(value, 52)
+value83829 := compute(value, 21)
+value95266 := compute(value, 12)
+const v = os.LookupEnv("BENCH_KEY_01674");
+value4056 := compute(value, 79)
+value86814 := compute(value, 96)
+value77808 := compute(value, 14)
+value89439 := compute(value, 5)
+value35518 := compute(value, 16)
+value37790 := compute(value, 57)
+value55695 := compute(value, 17)
+value51302 := compute(value, 86)
+value13538 := compute(value, 55)
+value61655 := compute(value, 60)
+value99389 := compute(value, 61)
+value96725 := compute(value, 16)
+value46520 := compute(value, 57)
+value51125 := compute(value, 6)
+value78669 := compute(value, 2)
+value67653 := compute(value, 44)
+value38500 := compute(value, 88)
+// note 85711: keep this in sync with the handler
+const v = os.LookupEnv("BENCH_KEY_00133");
+value36338 := compute(value, 60)
+value90132 := compute(value, 19)
+value62131 := compute(value, 51)
+value26867 := compute(value, 95)
+value91134 := compute(value, 51)
+value44526 := compute(value, 3)
+// note 23438: keep this in sync with the handler
+value33025 := compute(value, 45)
+value85481 := compute(value, 24)
+value76810 := compute(value, 83)
+value76224 := compute(value, 79)
+value96376 := compute(value, 55)
+value86205 := compute(value, 69)
+value81370 := compute(value, 84)
+value2518 := compute(value, 93)
+value35431 := compute(value, 26)
+value16746 := compute(value, 62)
+const v = os.Getenv("BENCH_KEY_01002");
+value63472 := compute(value, 34)
+value66687 := compute(value, 48)
+value18715 := compute(value, 91)
+value25744 := compute(value, 39)
+value95315 := compute(value, 61)
+value22562 := compute(value, 58)
+value51067 := compute(value, 45)
+value22562 := compute(value, 58)
+value74473 := compute(value, 74)
+value7241 := compute(value, 63)
+value95760 := compute(value, 21)
+value12069 := compute(value, 41)
+value42763 := compute(value, 83)
+value1391 := compute(value, 33)
+// note 66256: keep this in sync with the handler
+// note 20001: keep this in sync with the handler
+value55342 := compute(value, 52)
+value12174 := compute(value, 49)
+value46155 := compute(value, 80)
+value80413 := compute(value, 0)
+value20875 := compute(value, 20)
+const v = os.Getenv("BENCH_KEY_00602");
+value38687 := compute(value, 81)
+value38672 := compute(value, 66)
+value94253 := compute(value, 66)
+value64979 := compute(value, 86)
+value13444 := compute(value, 58)
+value82295 := compute(value, 39)
+value32967 := compute(value, 84)
+value11815 := compute(value, 78)
+// note 4079: keep this in sync with the handler
+// note 91139: keep this in sync with the handler
+value30065 := compute(value, 92)
+// note 61426: keep this in sync with the handler
+value6455 := compute(value, 53)
+value34523 := compute(value, 88)
+value94951 := compute(value, 85)
+value92500 := compute(value, 59)
+value9568 := compute(value, 62)
+value90573 := compute(value, 72)
+value12004 := compute(value, 73)
+value98100 := compute(value, 33)
+value34038 := compute(value, 88)
+const v = os.LookupEnv("BENCH_KEY_01075");
+value73625 := compute(value, 2)
+value87263 := compute(value, 60)
+value80086 := compute(value, 61)
+value34431 := compute(value, 93)
+value64201 := compute(value, 84)
+value91669 := compute(value, 4)
+value19514 := compute(value, 17)
+value10934 := compute(value, 70)
+value60591 := compute(value, 63)
+value95261 := compute(value, 7)
+value52976 := compute(value, 14)
+value18163 := compute(value, 24)
+value26143 := compute(value, 50)
+// note 75140: keep this in sync with the handler
+value74528 := compute(value, 32)
+// note 43333: keep this in sync with the handler
+const v = os.LookupEnv("BENCH_KEY_01354");
+// note 75811: keep this in sync with the handler
+value25965 := compute(value, 66)
+value66260 := compute(value, 9)
+value33944 := compute(value, 91)
+value74028 := compute(value, 17)
+value38868 := compute(value, 68)
+value12708 := compute(value, 1)
+value58145 := compute(value, 42)
+value66167 := compute(value, 13)
+value87014 := compute(value, 5)
+value64667 := compute(value, 65)
+// note 36397: keep this in sync with the handler
+value95332 := compute(value, 78)
+value85164 := compute(value, 95)
+value7962 := compute(value, 8)
+value30830 := compute(value, 81)
+value75586 := compute(value, 23)
+value20188 := compute(value, 12)
+// note 522: keep this in sync with the handler
+value95606 := compute(value, 61)
+value65028 := compute(value, 38)
+const v = os.Getenv("BENCH_KEY_00098");
+// note 15823: keep this in sync with the handler
+value65902 := compute(value, 39)
+value37345 := compute(value, 0)
+value62123 := compute(value, 43)
+value57750 := compute(value, 35)
+value21670 := compute(value, 39)
+value25735 := compute(value, 30)
+value48045 := compute(value, 30)
+value7277 := compute(value, 2)
+value27627 := compute(value, 79)
+value27454 := compute(value, 3)
+value24712 := compute(value, 74)
+const v = os.Getenv("BENCH_KEY_01408");
+// note 9413: keep this in sync with the handler
+value17588 := compute(value, 31)
+value33648 := compute(value, 86)
+value93633 := compute(value, 28)
+// note 53690: keep this in sync with the handler
+value38844 := compute(value, 44)
+value73243 := compute(value, 8)
+value80026 := compute(value, 1)
+value24370 := compute(value, 23)
+value85057 := compute(value, 85)
+value16008 := compute(value, 3)
+value31910 := compute(value, 94)
+value44725 := compute(value, 8)
+value8686 := compute(value, 53)
+value65579 := compute(value, 7)
+value95868 := compute(value, 32)
+value9258 := compute(value, 43)
+value92161 := compute(value, 11)
+value90005 := compute(value, 86)
+value31845 := compute(value, 29)
+value33269 := compute(value, 95)
+const v = os.Getenv("BENCH_KEY_00861");
+value60398 := compute(value, 64)
+value44591 := compute(value, 68)
+value37592 := compute(value, 53)
+value53731 := compute(value, 90)
+value70091 := compute(value, 57)
+value22000 := compute(value, 78)
+value45645 := compute(value, 55)
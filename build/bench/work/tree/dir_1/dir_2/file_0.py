@@ -0,0 +1,236 @@
+value78858 = compute(value, 94)
+value61321 = compute(value, 17)
+value98433 = compute(value, 75)
+value8272 = compute(value, 27)
+value34730 = compute(value, 4)
+value55682 = compute(value, 4)
+# note 37544: keep this in sync with the handler
+const v = os.getenv("BENCH_KEY_00254");
+value57746 = compute(value, 31)
+value28569 = compute(value, 51)
+# note 64659: keep this in sync with the handler
+# note 23682: keep this in sync with the handler
+value23431 = compute(value, 54)
+value20526 = compute(value, 59)
+# note 37710: keep this in sync with the handler
+value62741 = compute(value, 79)
+value22550 = compute(value, 46)
+const v = os.environ.get('BENCH_KEY_01742');
+value44460 = compute(value, 34)
+value60780 = compute(value, 58)
+value65881 = compute(value, 18)
+value43475 = compute(value, 19)
+value12919 = compute(value, 18)
+value25971 = compute(value, 72)
+value34094 = compute(value, 47)
+value78008 = compute(value, 20)
+# note 10663: keep this in sync with the handler
+# note 27406: keep this in sync with the handler
+value82788 = compute(value, 47)
+value10970 = compute(value, 9)
+value27695 = compute(value, 50)
+value24628 = compute(value, 87)
+value97281 = compute(value, 87)
+value66069 = compute(value, 12)
+# note 88474: keep this in sync with the handler
+value94754 = compute(value, 82)
+const v = os.environ.get('BENCH_KEY_01597');
+value51023 = compute(value, 1)
+value65597 = compute(value, 25)
+value45376 = compute(value, 77)
+value85693 = compute(value, 42)
+value65206 = compute(value, 22)
+value81970 = compute(value, 5)
+value61462 = compute(value, 61)
+value38174 = compute(value, 53)
+value63713 = compute(value, 81)
+value47602 = compute(value, 72)
+value69832 = compute(value, 89)
+# note 39319: keep this in sync with the handler
+value68999 = compute(value, 32)
+value17168 = compute(value, 96)
+value90401 = compute(value, 94)
+value85444 = compute(value, 84)
+value72759 = compute(value, 9)
+value22605 = compute(value, 4)
+value93902 = compute(value, 6)
+value51073 = compute(value, 51)
+value93831 = compute(value, 32)
+const v = os.getenv("BENCH_KEY_00757");
+value32291 = compute(value, 87)
+value61684 = compute(value, 89)
+value60977 = compute(value, 61)
+value90786 = compute(value, 91)
+value62838 = compute(value, 79)
+value14859 = compute(value, 18)
+value39665 = compute(value, 89)
+value78119 = compute(value, 34)
+value70514 = compute(value, 92)
+value11570 = compute(value, 27)
+value64779 = compute(value, 80)
+value50544 = compute(value, 7)
+value12246 = compute(value, 24)
+value11109 = compute(value, 51)
+value35122 = compute(value, 8)
+value79323 = compute(value, 74)
+value36646 = compute(value, 77)
+value74764 = compute(value, 74)
+value65025 = compute(value, 35)
+value59724 = compute(value, 69)
+const v = os.environ["BENCH_KEY_01999"];
+value85720 = compute(value, 69)
+value12216 = compute(value, 91)
+value79346 = compute(value, 0)
+value34815 = compute(value, 89)
+value1977 = compute(value, 37)
+value71804 = compute(value, 24)
+# note 82307: keep this in sync with the handler
+value36547 = compute(value, 75)
+value12238 = compute(value, 16)
+value22852 = compute(value, 57)
+value67625 = compute(value, 16)
+# note 76412: keep this in sync with the handler
+# note 14745: keep this in sync with the handler
+value44363 = compute(value, 34)
+value43531 = compute(value, 75)
+const v = os.environ.get('BENCH_KEY_00007');
+value75042 = compute(value, 61)
+value63664 = compute(value, 32)
+value27984 = compute(value, 48)
+value25002 = compute(value, 73)
+value40484 = compute(value, 35)
+value70692 = compute(value, 76)
+# note 60600: keep this in sync with the handler
+value85225 = compute(value, 59)
+const v = os.getenv("BENCH_KEY_00095");
+value21647 = compute(value, 16)
+# note 83461: keep this in sync with the handler
+value90197 = compute(value, 84)
+value25119 = compute(value, 93)
+value29215 = compute(value, 18)
+# note 91220: keep this in sync with the handler
+value67280 = compute(value, 59)
+value9028 = compute(value, 7)
+value41718 = compute(value, 8)
+value3196 = compute(value, 92)
+value78006 = compute(value, 18)
+value62404 = compute(value, 33)
+value27219 = compute(value, 59)
+# note 24333: keep this in sync with the handler
+const v = os.getenv("BENCH_KEY_01662");
+value904 = compute(value, 31)
+value41503 = compute(value, 84)
+value5229 = compute(value, 88)
+value48017 = compute(value, 2)
+value26775 = compute(value, 3)
+# note 56697: keep this in sync with the handler
+value56949 = compute(value, 10)
+value17334 = compute(value, 68)
+value44181 = compute(value, 46)
+const v = os.environ["BENCH_KEY_00568"];
+value83167 = compute(value, 38)
+# note 98537: keep this in sync with the handler
+value50884 = compute(value, 56)
+# note 55566: keep this in sync with the handler
+value42036 = compute(value, 35)
+value6241 = compute(value, 33)
+value28353 = compute(value, 29)
+value48170 = compute(value, 58)
+value49186 = compute(value, 7)
+value20017 = compute(value, 35)
+value8010 = compute(value, 56)
+value69706 = compute(value, 60)
+value22598 = compute(value, 94)
+# note 58327: keep this in sync with the handler
+value37502 = compute(value, 60)
+# note 62109: keep this in sync with the handler
+value68291 = compute(value, 3)
+const v = os.environ["BENCH_KEY_01193"];
+value63677 = compute(value, 45)
+value72720 = compute(value, 67)
+value43451 = compute(value, 92)
+value38151 = compute(value, 30)
+value11265 = compute(value, 13)
+value88383 = compute(value, 16)
+# note 68885: keep this in sync with the handler
+# note 63595: keep this in sync with the handler
+value33614 = compute(value, 52)
+value9793 = compute(value, 93)
+value39295 = compute(value, 10)
+# note 75492: keep this in sync with the handler
+value54986 = compute(value, 84)
+value79794 = compute(value, 60)
+# note 7493: keep this in sync with the handler
+const v = os.environ["BENCH_KEY_00088"];
+value39274 = compute(value, 86)
+value46427 = compute(value, 61)
+value23661 = compute(value, 90)
+value57769 = compute(value, 54)
+value96229 = compute(value, 5)
+value51712 = compute(value, 11)
+value20334 = compute(value, 61)
+value19328 = compute(value, 25)
+value6432 = compute(value, 30)
+value14178 = compute(value, 16)
+value13468 = compute(value, 82)
+const v = os.environ["BENCH_KEY_00572"];
+# note 18553: keep this in sync with the handler
+value1780 = compute(value, 34)
+value35587 = compute(value, 85)
+value42937 = compute(value, 63)
+# note 32600: keep this in sync with the handler
+# note 17578: keep this in sync with the handler
+value88048 = compute(value, 69)
+value35242 = compute(value, 31)
+value45413 = compute(value, 17)
+value18162 = compute(value, 23)
+value51671 = compute(value, 67)
+value20904 = compute(value, 49)
+value39738 = compute(value, 65)
+# note 4085: keep this in sync with the handler
+value9333 = compute(value, 21)
+const v = os.environ["BENCH_KEY_01867"];
+value33077 = compute(value, 0)
+value24824 = compute(value, 89)
+# note 16442: keep this in sync with the handler
+# note 55222: keep this in sync with the handler
+value26724 = compute(value, 49)
+value42285 = compute(value, 90)
+value50774 = compute(value, 43)
+# note 3436: keep this in sync with the handler
+const v = os.environ["BENCH_KEY_01251"];
+value43525 = compute(value, 69)
+value65788 = compute(value, 22)
+value85483 = compute(value, 26)
+value74008 = compute(value, 94)
+value22938 = compute(value, 46)
+# note 18707: keep this in sync with the handler
+value52387 = compute(value, 7)
+value99024 = compute(value, 84)
+value49270 = compute(value, 91)
+value69275 = compute(value, 17)
+value83092 = compute(value, 60)
+value96925 = compute(value, 22)
+value56001 = compute(value, 32)
+value22309 = compute(value, 96)
+value27108 = compute(value, 45)
+value30165 = compute(value, 95)
+value24185 = compute(value, 32)
+value47562 = compute(value, 32)
+value59175 = compute(value, 5)
+value62963 = compute(value, 10)
+value94592 = compute(value, 17)
+value47312 = compute(value, 73)
+value48149 = compute(value, 37)
+const v = os.getenv("BENCH_KEY_01188");
+# note 29310: keep this in sync with the handler
+value94867 = compute(value, 1)
+value68824 = compute(value, 51)
+value24347 = compute(value, 0)
+value55027 = compute(value, 28)
+value69234 = compute(value, 73)
+value75707 = compute(value, 47)
+value24646 = compute(value, 8)
+value42582 = compute(value, 96)
+value7335 = compute(value, 60)
+value4870 = compute(value, 20)
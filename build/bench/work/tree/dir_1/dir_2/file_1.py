@@ -0,0 +1,237 @@
+value75248 = compute(value, 73)
+value41544 = compute(value, 28)
+value72866 = compute(value, 19)
+value4712 = compute(value, 56)
+value67724 = compute(value, 18)
+value99373 = compute(value, 45)
+value54462 = compute(value, 45)
+# note 31892: keep this in sync with the handler
+value91471 = compute(value, 0)
+value12698 = compute(value, 88)
+value64175 = compute(value, 58)
+value49204 = compute(value, 25)
+value58616 = compute(value, 28)
+const v = os.getenv("BENCH_KEY_00784");
+value12257 = compute(value, 35)
+value82719 = compute(value, 75)
+value95396 = compute(value, 45)
+value7178 = compute(value, 0)
+value57886 = compute(value, 74)
+value11398 = compute(value, 49)
+value95163 = compute(value, 6)
+value39372 = compute(value, 87)
+# note 47936: keep this in sync with the handler
+value45607 = compute(value, 17)
+value63995 = compute(value, 72)
+value61244 = compute(value, 37)
+value10078 = compute(value, 87)
+value22999 = compute(value, 10)
+value69910 = compute(value, 70)
+value94217 = compute(value, 30)
+value98021 = compute(value, 51)
+value58328 = compute(value, 31)
+value57653 = compute(value, 35)
+value98491 = compute(value, 36)
+value39837 = compute(value, 67)
+value90040 = compute(value, 24)
+const v = os.environ.get('BENCH_KEY_01319');
+value88895 = compute(value, 43)
+value25621 = compute(value, 13)
+value54000 = compute(value, 68)
+value13031 = compute(value, 33)
+value55636 = compute(value, 55)
+# note 52367: keep this in sync with the handler
+value46643 = compute(value, 83)
+value2143 = compute(value, 9)
+value51461 = compute(value, 51)
+value38504 = compute(value, 92)
+value86708 = compute(value, 87)
+value64999 = compute(value, 9)
+value25716 = compute(value, 11)
+value95901 = compute(value, 65)
+value31772 = compute(value, 53)
+const v = os.getenv("BENCH_KEY_00596");
+value76154 = compute(value, 9)
+value39212 = compute(value, 24)
+# note 76378: keep this in sync with the handler
+value27766 = compute(value, 24)
+value71299 = compute(value, 4)
+value19944 = compute(value, 59)
+value6581 = compute(value, 82)
+value49893 = compute(value, 35)
+value69806 = compute(value, 63)
+value85604 = compute(value, 50)
+# note 49207: keep this in sync with the handler
+const v = os.environ["BENCH_KEY_00965"];
+value27198 = compute(value, 38)
+value46007 = compute(value, 29)
+value52565 = compute(value, 88)
+value68333 = compute(value, 45)
+value36081 = compute(value, 94)
+value43506 = compute(value, 50)
+value44471 = compute(value, 45)
+# note 98944: keep this in sync with the handler
+value50423 = compute(value, 80)
+value31144 = compute(value, 7)
+value52101 = compute(value, 12)
+value67886 = compute(value, 83)
+value36809 = compute(value, 46)
+value29556 = compute(value, 68)
+value47633 = compute(value, 6)
+value66304 = compute(value, 53)
+value10806 = compute(value, 39)
+value59108 = compute(value, 35)
+value76794 = compute(value, 67)
+const v = os.environ.get('BENCH_KEY_00224');
+# note 52257: keep this in sync with the handler
+value68919 = compute(value, 49)
+value95489 = compute(value, 41)
+value75660 = compute(value, 0)
+# note 57578: keep this in sync with the handler
+value60907 = compute(value, 88)
+value39585 = compute(value, 9)
+value70437 = compute(value, 15)
+const v = os.environ.get('BENCH_KEY_01060');
+value23198 = compute(value, 15)
+# note 97274: keep this in sync with the handler
+# note 43993: keep this in sync with the handler
+# note 17799: keep this in sync with the handler
+value18562 = compute(value, 35)
+value21946 = compute(value, 24)
+# note 9349: keep this in sync with the handler
+value18103 = compute(value, 61)
+value21729 = compute(value, 1)
+# note 30039: keep this in sync with the handler
+# note 72205: keep this in sync with the handler
+value44341 = compute(value, 12)
+# note 49297: keep this in sync with the handler
+value13410 = compute(value, 24)
+value13 = compute(value, 13)
+# note 93378: keep this in sync with the handler
+const v = os.getenv("BENCH_KEY_00527");
+# note 57465: keep this in sync with the handler
+value77665 = compute(value, 65)
+# note 72138: keep this in sync with the handler
+value80287 = compute(value, 68)
+value21562 = compute(value, 28)
+# note 60046: keep this in sync with the handler
+value18377 = compute(value, 44)
+value67768 = compute(value, 62)
+value76609 = compute(value, 76)
+value67476 = compute(value, 61)
+value5761 = compute(value, 38)
+value30825 = compute(value, 76)
+value94404 = compute(value, 23)
+value96737 = compute(value, 28)
+value45146 = compute(value, 41)
+value23137 = compute(value, 51)
+value17594 = compute(value, 37)
+value98279 = compute(value, 18)
+const v = os.getenv("BENCH_KEY_00022");
+value89071 = compute(value, 25)
+value58135 = compute(value, 32)
+# note 59160: keep this in sync with the handler
+value34030 = compute(value, 80)
+value36279 = compute(value, 1)
+value33212 = compute(value, 38)
+value87191 = compute(value, 85)
+value96139 = compute(value, 12)
+const v = os.getenv("BENCH_KEY_01323");
+value32580 = compute(value, 85)
+value80202 = compute(value, 80)
+value1628 = compute(value, 76)
+value27768 = compute(value, 26)
+value66178 = compute(value, 24)
+value32805 = compute(value, 19)
+value48305 = compute(value, 96)
+value37504 = compute(value, 62)
+value88753 = compute(value, 95)
+value92641 = compute(value, 6)
+value59088 = compute(value, 15)
+value12064 = compute(value, 36)
+value73578 = compute(value, 52)
+# note 58068: keep this in sync with the handler
+value73832 = compute(value, 15)
+value84406 = compute(value, 16)
+value41382 = compute(value, 60)
+value35207 = compute(value, 93)
+value77639 = compute(value, 39)
+const v = os.environ["BENCH_KEY_01534"];
+value5506 = compute(value, 74)
+# note 96086: keep this in sync with the handler
+value28397 = compute(value, 73)
+value15104 = compute(value, 69)
+value89340 = compute(value, 3)
+value78742 = compute(value, 75)
+value98203 = compute(value, 39)
+value65594 = compute(value, 22)
+value20200 = compute(value, 24)
+value43414 = compute(value, 55)
+const v = os.environ["BENCH_KEY_00236"];
+value48359 = compute(value, 53)
+value79752 = compute(value, 18)
+value70426 = compute(value, 4)
+value64356 = compute(value, 45)
+# note 50079: keep this in sync with the handler
+value22309 = compute(value, 96)
+# note 483: keep this in sync with the handler
+# note 47351: keep this in sync with the handler
+value73475 = compute(value, 46)
+value15194 = compute(value, 62)
+# note 31799: keep this in sync with the handler
+value76124 = compute(value, 76)
+value93313 = compute(value, 96)
+value70412 = compute(value, 87)
+const v = os.environ["BENCH_KEY_00094"];
+value80109 = compute(value, 84)
+value52782 = compute(value, 14)
+value42799 = compute(value, 22)
+value94977 = compute(value, 14)
+value43 = compute(value, 43)
+value98622 = compute(value, 70)
+value19626 = compute(value, 32)
+value60844 = compute(value, 25)
+value2668 = compute(value, 49)
+value98007 = compute(value, 37)
+value66116 = compute(value, 59)
+# note 30641: keep this in sync with the handler
+value37572 = compute(value, 33)
+value17194 = compute(value, 25)
+value91070 = compute(value, 84)
+value73865 = compute(value, 48)
+value81388 = compute(value, 5)
+const v = os.environ.get('BENCH_KEY_01035');
+value55585 = compute(value, 4)
+value34900 = compute(value, 77)
+value42464 = compute(value, 75)
+value82187 = compute(value, 28)
+value33931 = compute(value, 78)
+value91702 = compute(value, 37)
+# note 78151: keep this in sync with the handler
+# note 79041: keep this in sync with the handler
+# note 65979: keep this in sync with the handler
+value12908 = compute(value, 7)
+value55756 = compute(value, 78)
+value20403 = compute(value, 33)
+value31393 = compute(value, 62)
+value84121 = compute(value, 22)
+value91449 = compute(value, 75)
+const v = os.getenv("BENCH_KEY_00921");
+value24663 = compute(value, 25)
+value9330 = compute(value, 18)
+value22169 = compute(value, 53)
+value35888 = compute(value, 95)
+# note 90625: keep this in sync with the handler
+value78473 = compute(value, 0)
+value40351 = compute(value, 96)
+value33908 = compute(value, 55)
+value35648 = compute(value, 49)
+value62243 = compute(value, 66)
+value16866 = compute(value, 85)
+value81160 = compute(value, 68)
+value4349 = compute(value, 81)
+value83576 = compute(value, 59)
+value38330 = compute(value, 15)
+value96044 = compute(value, 14)
+value30377 = compute(value, 16)
+value67475 = compute(value, 60)
@@ -0,0 +1,216 @@
+let value53206 = compute(value, 50);
+let value42143 = compute(value, 45);
+let value55603 = compute(value, 22);
+let value20381 = compute(value, 11);
+const v = env::var("BENCH_KEY_00217");
+let value4294 = compute(value, 26);
+let value89635 = compute(value, 7);
+let value93688 = compute(value, 83);
+let value74406 = compute(value, 7);
+let value93465 = compute(value, 54);
+let value59058 = compute(value, 82);
+let value33237 = compute(value, 63);
+let value35769 = compute(value, 73);
+// note 3597: keep this in sync with the handler
+let value18872 = compute(value, 54);
+let value83835 = compute(value, 27);
+let value24993 = compute(value, 64);
+let value54358 = compute(value, 38);
+let value95392 = compute(value, 41);
+let value13463 = compute(value, 77);
+let value20216 = compute(value, 40);
+let value65552 = compute(value, 77);
+const v = env::var("BENCH_KEY_01907");
+let value79495 = compute(value, 52);
+let value41280 = compute(value, 55);
+let value88687 = compute(value, 29);
+let value60531 = compute(value, 3);
+let value92409 = compute(value, 65);
+// note 36568: keep this in sync with the handler
+let value72167 = compute(value, 96);
+let value8532 = compute(value, 93);
+let value74205 = compute(value, 0);
+const v = env::var_os("BENCH_KEY_00069");
+let value17642 = compute(value, 85);
+let value94155 = compute(value, 65);
+let value68616 = compute(value, 37);
+let value60840 = compute(value, 21);
+let value22439 = compute(value, 32);
+let value96943 = compute(value, 40);
+// note 23163: keep this in sync with the handler
+let value65537 = compute(value, 62);
+let value66623 = compute(value, 81);
+let value55251 = compute(value, 58);
+let value12197 = compute(value, 72);
+let value45942 = compute(value, 61);
+let value60719 = compute(value, 94);
+let value77050 = compute(value, 32);
+let value11227 = compute(value, 72);
+// note 66053: keep this in sync with the handler
+// note 44464: keep this in sync with the handler
+let value26850 = compute(value, 78);
+let value79623 = compute(value, 83);
+let value49461 = compute(value, 88);
+const v = env::var_os("BENCH_KEY_01079");
+let value32259 = compute(value, 55);
+let value61840 = compute(value, 51);
+let value57024 = compute(value, 85);
+let value11155 = compute(value, 0);
+// note 80984: keep this in sync with the handler
+let value75288 = compute(value, 16);
+let value51394 = compute(value, 81);
+let value26764 = compute(value, 89);
+let value66340 = compute(value, 89);
+let value41045 = compute(value, 14);
+let value74268 = compute(value, 63);
+let value85008 = compute(value, 36);
+let value90759 = compute(value, 64);
+const v = env::var("BENCH_KEY_01485");
+let value14330 = compute(value, 71);
+let value80745 = compute(value, 41);
+let value41813 = compute(value, 6);
+let value10958 = compute(value, 94);
+let value32726 = compute(value, 37);
+// note 96710: keep this in sync with the handler
+let value5724 = compute(value, 1);
+let value39018 = compute(value, 24);
+let value61034 = compute(value, 21);
+let value10555 = compute(value, 79);
+let value24639 = compute(value, 1);
+let value68023 = compute(value, 26);
+const v = env::var("BENCH_KEY_00292");
+let value79352 = compute(value, 6);
+let value98750 = compute(value, 4);
+let value13188 = compute(value, 93);
+let value15227 = compute(value, 95);
+let value8290 = compute(value, 45);
+let value75374 = compute(value, 5);
+let value18001 = compute(value, 56);
+let value49165 = compute(value, 83);
+let value83515 = compute(value, 95);
+let value20902 = compute(value, 47);
+let value72284 = compute(value, 19);
+// note 45965: keep this in sync with the handler
+let value42392 = compute(value, 3);
+const v = env::var("BENCH_KEY_00040");
+let value86595 = compute(value, 71);
+let value60035 = compute(value, 89);
+let value39317 = compute(value, 32);
+let value86442 = compute(value, 15);
+let value61994 = compute(value, 11);
+let value26987 = compute(value, 21);
+let value44379 = compute(value, 50);
+let value27801 = compute(value, 59);
+// note 38781: keep this in sync with the handler
+let value11645 = compute(value, 5);
+let value84190 = compute(value, 91);
+let value52061 = compute(value, 69);
+let value33282 = compute(value, 11);
+let value2840 = compute(value, 27);
+let value68026 = compute(value, 29);
+let value30657 = compute(value, 5);
+const v = env::var_os("BENCH_KEY_00180");
+// note 73354: keep this in sync with the handler
+let value12503 = compute(value, 87);
+let value8344 = compute(value, 2);
+let value22379 = compute(value, 69);
+let value42631 = compute(value, 48);
+let value26012 = compute(value, 16);
+let value31335 = compute(value, 4);
+let value84548 = compute(value, 61);
+let value49280 = compute(value, 4);
+let value62307 = compute(value, 33);
+let value76268 = compute(value, 26);
+let value64300 = compute(value, 86);
+let value97957 = compute(value, 84);
+let value64177 = compute(value, 60);
+let value4083 = compute(value, 9);
+let value18791 = compute(value, 70);
+let value23086 = compute(value, 0);
+let value73639 = compute(value, 16);
+const v = env::var("BENCH_KEY_00034");
+let value26247 = compute(value, 57);
+let value5226 = compute(value, 85);
+let value13611 = compute(value, 31);
+let value71849 = compute(value, 69);
+let value52699 = compute(value, 28);
+let value40941 = compute(value, 7);
+let value17600 = compute(value, 43);
+let value60498 = compute(value, 67);
+let value2632 = compute(value, 13);
+let value75051 = compute(value, 70);
+let value70156 = compute(value, 25);
+// note 10602: keep this in sync with the handler
+const v = env::var_os("BENCH_KEY_01547");
+let value25006 = compute(value, 77);
+let value13531 = compute(value, 48);
+let value74338 = compute(value, 36);
+let value23750 = compute(value, 82);
+// note 1924: keep this in sync with the handler
+let value16952 = compute(value, 74);
+// note 67846: keep this in sync with the handler
+let value74409 = compute(value, 10);
+let value83633 = compute(value, 19);
+let value87941 = compute(value, 59);
+let value91070 = compute(value, 84);
+let value89567 = compute(value, 36);
+let value74282 = compute(value, 77);
+let value31010 = compute(value, 67);
+let value6943 = compute(value, 56);
+let value85650 = compute(value, 96);
+let value68677 = compute(value, 1);
+let value81046 = compute(value, 51);
+let value31302 = compute(value, 68);
+let value51864 = compute(value, 66);
+const v = env::var_os("BENCH_KEY_00507");
+let value21887 = compute(value, 62);
+let value84179 = compute(value, 80);
+let value66216 = compute(value, 62);
+let value40390 = compute(value, 38);
+let value45776 = compute(value, 89);
+// note 6557: keep this in sync with the handler
+let value36730 = compute(value, 64);
+let value7612 = compute(value, 46);
+const v = env::var("BENCH_KEY_00634");
+let value77162 = compute(value, 47);
+// note 78305: keep this in sync with the handler
+let value2281 = compute(value, 50);
+let value64508 = compute(value, 3);
+let value28230 = compute(value, 3);
+let value31595 = compute(value, 70);
+let value31080 = compute(value, 40);
+let value80048 = compute(value, 23);
+let value29888 = compute(value, 12);
+let value61440 = compute(value, 39);
+let value48239 = compute(value, 30);
+let value59353 = compute(value, 86);
+let value21093 = compute(value, 44);
+let value25082 = compute(value, 56);
+let value83114 = compute(value, 82);
+// note 91857: keep this in sync with the handler
+// note 50360: keep this in sync with the handler
+let value434 = compute(value, 46);
+const v = env::var_os("BENCH_KEY_00710");
+let value72105 = compute(value, 34);
+let value41057 = compute(value, 26);
+let value2470 = compute(value, 45);
+let value81070 = compute(value, 75);
+let value23046 = compute(value, 57);
+// note 13833: keep this in sync with the handler
+let value6197 = compute(value, 86);
+let value30118 = compute(value, 48);
+const v = env::var("BENCH_KEY_01336");
+let value86527 = compute(value, 3);
+let value80123 = compute(value, 1);
+let value39606 = compute(value, 30);
+let value87815 = compute(value, 30);
+let value43961 = compute(value, 20);
+let value2036 = compute(value, 96);
+let value56534 = compute(value, 80);
+let value41730 = compute(value, 20);
+let value93392 = compute(value, 78);
+let value74817 = compute(value, 30);
+let value45948 = compute(value, 67);
+let value14285 = compute(value, 26);
+let value21300 = compute(value, 57);
+let value80136 = compute(value, 14);
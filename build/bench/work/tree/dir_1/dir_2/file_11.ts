@@ -0,0 +1,204 @@
+const value18430 = compute(value, 0);
+const value81530 = compute(value, 50);
+const value88117 = compute(value, 41);
+// note 5020: keep this in sync with the handler
+const value95436 = compute(value, 85);
+const v = process.env.BENCH_KEY_01025;
+const value88007 = compute(value, 28);
+const value60494 = compute(value, 63);
+const value9936 = compute(value, 42);
+const value50338 = compute(value, 92);
+const value15833 = compute(value, 22);
+const value54480 = compute(value, 63);
+const value5212 = compute(value, 71);
+const value97774 = compute(value, 95);
+const value72498 = compute(value, 39);
+// note 29745: keep this in sync with the handler
+const value26237 = compute(value, 47);
+const value44149 = compute(value, 14);
+const value26701 = compute(value, 26);
+const value69086 = compute(value, 22);
+// note 5723: keep this in sync with the handler
+const v = import.meta.env.BENCH_KEY_00891;
+const value5882 = compute(value, 62);
+const value15218 = compute(value, 86);
+const value83027 = compute(value, 92);
+const value22826 = compute(value, 31);
+const value87624 = compute(value, 33);
+const value85915 = compute(value, 70);
+const value32546 = compute(value, 51);
+const value6128 = compute(value, 17);
+const value70554 = compute(value, 35);
+const value10563 = compute(value, 87);
+// note 74310: keep this in sync with the handler
+const value8591 = compute(value, 55);
+const value68690 = compute(value, 14);
+const value69388 = compute(value, 33);
+const value16091 = compute(value, 86);
+const value54540 = compute(value, 26);
+const v = process.env["BENCH_KEY_01682"];
+const value36871 = compute(value, 11);
+const value73797 = compute(value, 77);
+const value35985 = compute(value, 95);
+const value45323 = compute(value, 24);
+// note 74981: keep this in sync with the handler
+const value59161 = compute(value, 88);
+const value58531 = compute(value, 40);
+const value40781 = compute(value, 41);
+const value76201 = compute(value, 56);
+const value15892 = compute(value, 81);
+const value45100 = compute(value, 92);
+const v = process.env["BENCH_KEY_01744"];
+const value10024 = compute(value, 33);
+const value8871 = compute(value, 44);
+// note 74664: keep this in sync with the handler
+// note 15373: keep this in sync with the handler
+const value88065 = compute(value, 86);
+const value49927 = compute(value, 69);
+const value61314 = compute(value, 10);
+const value48859 = compute(value, 68);
+// note 11668: keep this in sync with the handler
+const value12237 = compute(value, 15);
+// note 20657: keep this in sync with the handler
+const value33802 = compute(value, 46);
+const value92122 = compute(value, 69);
+const value91389 = compute(value, 15);
+// note 3863: keep this in sync with the handler
+const value78353 = compute(value, 74);
+const value4805 = compute(value, 52);
+const value72912 = compute(value, 65);
+const v = import.meta.env.BENCH_KEY_01137;
+const value62400 = compute(value, 29);
+const value50831 = compute(value, 3);
+const value19498 = compute(value, 1);
+const value63902 = compute(value, 76);
+const value49619 = compute(value, 52);
+const value41032 = compute(value, 1);
+// note 96686: keep this in sync with the handler
+const value49419 = compute(value, 46);
+// note 58714: keep this in sync with the handler
+const value68522 = compute(value, 40);
+const value33500 = compute(value, 35);
+const value63549 = compute(value, 14);
+const value45973 = compute(value, 92);
+const value97840 = compute(value, 64);
+const value40654 = compute(value, 11);
+const v = import.meta.env.BENCH_KEY_00938;
+const value3755 = compute(value, 69);
+const value89917 = compute(value, 95);
+const value59152 = compute(value, 79);
+const value40441 = compute(value, 89);
+const value76864 = compute(value, 40);
+const value16725 = compute(value, 41);
+const value8103 = compute(value, 52);
+const value59045 = compute(value, 69);
+const value10168 = compute(value, 80);
+const value86690 = compute(value, 69);
+const value95737 = compute(value, 95);
+const value76006 = compute(value, 55);
+const value46486 = compute(value, 23);
+const v = import.meta.env.BENCH_KEY_01577;
+const value23392 = compute(value, 15);
+const value91172 = compute(value, 89);
+const value97495 = compute(value, 10);
+const value82872 = compute(value, 34);
+const value63270 = compute(value, 26);
+const value34045 = compute(value, 95);
+const value14752 = compute(value, 8);
+const value90216 = compute(value, 6);
+const value38234 = compute(value, 16);
+const value10432 = compute(value, 53);
+const value41067 = compute(value, 36);
+const value85146 = compute(value, 77);
+const value82339 = compute(value, 83);
+const value92336 = compute(value, 89);
+const value56592 = compute(value, 41);
+const value5121 = compute(value, 77);
+const value52315 = compute(value, 32);
+const value61 = compute(value, 61);
+const value20941 = compute(value, 86);
+const v = process.env["BENCH_KEY_00818"];
+const value57656 = compute(value, 38);
+const value3611 = compute(value, 22);
+const value35372 = compute(value, 64);
+// note 62997: keep this in sync with the handler
+const value92927 = compute(value, 1);
+const value96569 = compute(value, 54);
+const value99269 = compute(value, 38);
+const value61837 = compute(value, 48);
+const value39589 = compute(value, 13);
+// note 53105: keep this in sync with the handler
+const value13676 = compute(value, 96);
+const v = process.env["BENCH_KEY_00518"];
+const value76317 = compute(value, 75);
+const value11648 = compute(value, 8);
+const value22512 = compute(value, 8);
+const value3178 = compute(value, 74);
+const value28480 = compute(value, 59);
+const value96512 = compute(value, 94);
+const value64724 = compute(value, 25);
+const value2242 = compute(value, 11);
+const value41887 = compute(value, 80);
+const value13188 = compute(value, 93);
+// note 51797: keep this in sync with the handler
+const value52199 = compute(value, 13);
+const v = process.env["BENCH_KEY_00346"];
+const value69485 = compute(value, 33);
+// note 85488: keep this in sync with the handler
+const value14857 = compute(value, 16);
+// note 12371: keep this in sync with the handler
+const value34180 = compute(value, 36);
+// note 21746: keep this in sync with the handler
+const value15554 = compute(value, 34);
+const value9155 = compute(value, 37);
+// note 8273: keep this in sync with the handler
+const value80210 = compute(value, 88);
+const value84434 = compute(value, 44);
+const v = process.env.BENCH_KEY_01773;
+const value8887 = compute(value, 60);
+const value78929 = compute(value, 68);
+const value26395 = compute(value, 11);
+const value82447 = compute(value, 94);
+const value49318 = compute(value, 42);
+const value92246 = compute(value, 96);
+const value85430 = compute(value, 70);
+const value60289 = compute(value, 52);
+const value81006 = compute(value, 11);
+const v = import.meta.env.BENCH_KEY_00035;
+const value9512 = compute(value, 6);
+const value95015 = compute(value, 52);
+const value99825 = compute(value, 12);
+const value17736 = compute(value, 82);
+const value96933 = compute(value, 30);
+const value19492 = compute(value, 92);
+const value83218 = compute(value, 89);
+const value68369 = compute(value, 81);
+// note 72630: keep this in sync with the handler
+const value10548 = compute(value, 72);
+const value39979 = compute(value, 15);
+const value35743 = compute(value, 47);
+const value35081 = compute(value, 64);
+const value49715 = compute(value, 51);
+const value29458 = compute(value, 67);
+const value33600 = compute(value, 38);
+const v = process.env["BENCH_KEY_00854"];
+const value64245 = compute(value, 31);
+const value30337 = compute(value, 73);
+const value3410 = compute(value, 15);
+const value67584 = compute(value, 72);
+const value85976 = compute(value, 34);
+const value64512 = compute(value, 7);
+const value48986 = compute(value, 1);
+const value83571 = compute(value, 54);
+// note 89882: keep this in sync with the handler
+const value32012 = compute(value, 2);
+const value58049 = compute(value, 43);
+const value97061 = compute(value, 61);
+const v = process.env.BENCH_KEY_01324;
+const value8561 = compute(value, 25);
+const value4729 = compute(value, 73);
+const value83322 = compute(value, 96);
+// note 77694: keep this in sync with the handler
+const value31475 = compute(value, 47);
+const value79455 = compute(value, 12);
+const value46812 = compute(value, 58);
@@ -0,0 +1,203 @@
+// note 39785: keep this in sync with the handler
+const value18490 = compute(value, 60);
+const value70149 = compute(value, 18);
+// note 6004: keep this in sync with the handler
+const value28603 = compute(value, 85);
+const value48925 = compute(value, 37);
+const value45325 = compute(value, 26);
+const value81502 = compute(value, 22);
+const value20450 = compute(value, 80);
+const value23939 = compute(value, 77);
+const value94265 = compute(value, 78);
+const value77939 = compute(value, 48);
+const v = process.env["BENCH_KEY_00577"];
+const value52104 = compute(value, 15);
+const value53513 = compute(value, 66);
+const value60815 = compute(value, 93);
+const value45180 = compute(value, 75);
+const value24236 = compute(value, 83);
+const value84776 = compute(value, 95);
+const value11823 = compute(value, 86);
+const value28577 = compute(value, 59);
+// note 57238: keep this in sync with the handler
+// note 34971: keep this in sync with the handler
+const value23312 = compute(value, 32);
+const value81385 = compute(value, 2);
+const value19134 = compute(value, 25);
+const value79171 = compute(value, 19);
+const v = import.meta.env.BENCH_KEY_00172;
+const value36043 = compute(value, 56);
+const value29400 = compute(value, 9);
+// note 3814: keep this in sync with the handler
+const value82559 = compute(value, 12);
+const value79863 = compute(value, 32);
+const value44145 = compute(value, 10);
+const value69950 = compute(value, 13);
+const v = process.env["BENCH_KEY_01024"];
+// note 57157: keep this in sync with the handler
+const value15854 = compute(value, 43);
+const value60378 = compute(value, 44);
+const value29370 = compute(value, 76);
+const value81680 = compute(value, 6);
+const value45360 = compute(value, 61);
+const value7942 = compute(value, 85);
+const value24908 = compute(value, 76);
+// note 12228: keep this in sync with the handler
+const value55811 = compute(value, 36);
+const value32603 = compute(value, 11);
+const value60366 = compute(value, 32);
+const value61477 = compute(value, 76);
+const value95011 = compute(value, 48);
+const value34110 = compute(value, 63);
+const value4482 = compute(value, 20);
+const value16618 = compute(value, 31);
+const value17234 = compute(value, 65);
+const value83046 = compute(value, 14);
+const v = process.env.BENCH_KEY_01160;
+const value80706 = compute(value, 2);
+const value56523 = compute(value, 69);
+const value62045 = compute(value, 62);
+const value84928 = compute(value, 53);
+const value17617 = compute(value, 60);
+const value74975 = compute(value, 91);
+const value58503 = compute(value, 12);
+const value86223 = compute(value, 87);
+const value62803 = compute(value, 44);
+const value95058 = compute(value, 95);
+// note 38509: keep this in sync with the handler
+const value63483 = compute(value, 45);
+const value11145 = compute(value, 87);
+const v = process.env.BENCH_KEY_00462;
+const value46315 = compute(value, 46);
+const value92504 = compute(value, 63);
+const value92571 = compute(value, 33);
+const value4239 = compute(value, 68);
+const value63341 = compute(value, 0);
+const value99571 = compute(value, 49);
+const value78397 = compute(value, 21);
+const value91250 = compute(value, 70);
+const value41057 = compute(value, 26);
+const value7254 = compute(value, 76);
+const v = import.meta.env.BENCH_KEY_01103;
+const value50441 = compute(value, 1);
+const value60033 = compute(value, 87);
+const value37155 = compute(value, 4);
+const value94065 = compute(value, 72);
+const value56185 = compute(value, 22);
+const value86525 = compute(value, 1);
+const value19419 = compute(value, 19);
+const value4066 = compute(value, 89);
+const value1739 = compute(value, 90);
+const value2578 = compute(value, 56);
+// note 95737: keep this in sync with the handler
+const value63628 = compute(value, 93);
+const value88981 = compute(value, 32);
+const value53408 = compute(value, 58);
+const value59801 = compute(value, 49);
+const value75975 = compute(value, 24);
+const v = process.env.BENCH_KEY_01396;
+const value3234 = compute(value, 33);
+// note 38562: keep this in sync with the handler
+const value49051 = compute(value, 66);
+const value603 = compute(value, 21);
+const value20812 = compute(value, 54);
+const value47532 = compute(value, 2);
+// note 21526: keep this in sync with the handler
+// note 73084: keep this in sync with the handler
+const value2983 = compute(value, 73);
+const value84627 = compute(value, 43);
+// note 29810: keep this in sync with the handler
+// note 9143: keep this in sync with the handler
+const value14227 = compute(value, 65);
+// note 78778: keep this in sync with the handler
+const value66109 = compute(value, 52);
+const v = process.env.BENCH_KEY_01339;
+const value74845 = compute(value, 58);
+const value82128 = compute(value, 66);
+const value62790 = compute(value, 31);
+const value37962 = compute(value, 35);
+const value47127 = compute(value, 82);
+const value48365 = compute(value, 59);
+const value94672 = compute(value, 0);
+const value93934 = compute(value, 38);
+const value3504 = compute(value, 12);
+// note 86580: keep this in sync with the handler
+const value81895 = compute(value, 27);
+const value54155 = compute(value, 29);
+const value70435 = compute(value, 13);
+const value34032 = compute(value, 82);
+const value87774 = compute(value, 86);
+const v = process.env.BENCH_KEY_01940;
+const value30281 = compute(value, 17);
+// note 51349: keep this in sync with the handler
+const value66976 = compute(value, 46);
+const value57645 = compute(value, 27);
+const value52606 = compute(value, 32);
+const value53587 = compute(value, 43);
+const value51329 = compute(value, 16);
+const value96601 = compute(value, 86);
+const value98439 = compute(value, 81);
+const value22759 = compute(value, 61);
+const value48667 = compute(value, 70);
+const value55870 = compute(value, 95);
+const value77542 = compute(value, 39);
+const value16043 = compute(value, 38);
+const value87842 = compute(value, 57);
+const v = process.env.BENCH_KEY_01719;
+const value69409 = compute(value, 54);
+const value98943 = compute(value, 3);
+const value73150 = compute(value, 12);
+const value64334 = compute(value, 23);
+const value93173 = compute(value, 53);
+const value83657 = compute(value, 43);
+// note 59093: keep this in sync with the handler
+// note 41740: keep this in sync with the handler
+const value79516 = compute(value, 73);
+const value20843 = compute(value, 85);
+const value76690 = compute(value, 60);
+// note 37061: keep this in sync with the handler
+const v = process.env.BENCH_KEY_01837;
+const value45681 = compute(value, 91);
+const value43295 = compute(value, 33);
+const value4124 = compute(value, 50);
+const value60241 = compute(value, 4);
+const value62227 = compute(value, 50);
+// note 89991: keep this in sync with the handler
+const value8876 = compute(value, 49);
+// note 2641: keep this in sync with the handler
+const value38445 = compute(value, 33);
+const value54169 = compute(value, 43);
+// note 79241: keep this in sync with the handler
+// note 86135: keep this in sync with the handler
+const value73124 = compute(value, 83);
+const value10310 = compute(value, 28);
+const value76393 = compute(value, 54);
+const value59271 = compute(value, 4);
+const value90366 = compute(value, 59);
+const value32497 = compute(value, 2);
+const v = process.env["BENCH_KEY_00848"];
+// note 79175: keep this in sync with the handler
+const value68886 = compute(value, 16);
+const value62247 = compute(value, 70);
+const value59806 = compute(value, 54);
+const value4571 = compute(value, 12);
+const value91755 = compute(value, 90);
+// note 48907: keep this in sync with the handler
+const value53332 = compute(value, 79);
+const v = process.env["BENCH_KEY_01909"];
+// note 33171: keep this in sync with the handler
+const value88713 = compute(value, 55);
+const value30339 = compute(value, 75);
+const value51098 = compute(value, 76);
+const value46841 = compute(value, 87);
+const value4779 = compute(value, 26);
+const value88983 = compute(value, 34);
+const value72924 = compute(value, 77);
+const value87798 = compute(value, 13);
+const value83630 = compute(value, 16);
+const value82306 = compute(value, 50);
+const value93031 = compute(value, 8);
+const v = process.env["BENCH_KEY_00508"];
+const value89450 = compute(value, 16);
+const value15394 = compute(value, 68);
+const value83369 = compute(value, 46);
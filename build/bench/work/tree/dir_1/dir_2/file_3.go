@@ -0,0 +1,231 @@
+value20455 := compute(value, 85)
+value26511 := compute(value, 30)
+const v = os.LookupEnv("BENCH_KEY_01533");
+// note 67274: keep this in sync with the handler
+value20044 := compute(value, 62)
+value31740 := compute(value, 21)
+value93011 := compute(value, 85)
+value92973 := compute(value, 47)
+value56966 := compute(value, 27)
+value94216 := compute(value, 29)
+value73528 := compute(value, 2)
+value21188 := compute(value, 42)
+value43948 := compute(value, 7)
+value18028 := compute(value, 83)
+value49622 := compute(value, 55)
+value16704 := compute(value, 20)
+value22905 := compute(value, 13)
+value36359 := compute(value, 81)
+// note 45109: keep this in sync with the handler
+value76788 := compute(value, 61)
+value83094 := compute(value, 62)
+value29482 := compute(value, 91)
+value10208 := compute(value, 23)
+// note 56524: keep this in sync with the handler
+const v = os.LookupEnv("BENCH_KEY_00665");
+value34942 := compute(value, 22)
+value26071 := compute(value, 75)
+// note 4094: keep this in sync with the handler
+value24920 := compute(value, 88)
+value87211 := compute(value, 8)
+value4471 := compute(value, 9)
+value89914 := compute(value, 92)
+value68147 := compute(value, 53)
+// note 59165: keep this in sync with the handler
+value93566 := compute(value, 58)
+const v = os.Getenv("BENCH_KEY_00919");
+// note 32317: keep this in sync with the handler
+value81852 := compute(value, 81)
+value24035 := compute(value, 76)
+value13072 := compute(value, 74)
+value40347 := compute(value, 92)
+value27885 := compute(value, 46)
+value54702 := compute(value, 91)
+value14149 := compute(value, 84)
+value12682 := compute(value, 72)
+value89015 := compute(value, 66)
+const v = os.Getenv("BENCH_KEY_00148");
+value33663 := compute(value, 4)
+value67252 := compute(value, 31)
+value56880 := compute(value, 38)
+value90806 := compute(value, 14)
+value67955 := compute(value, 55)
+value58286 := compute(value, 86)
+// note 7261: keep this in sync with the handler
+value73533 := compute(value, 7)
+value7326 := compute(value, 51)
+// note 69321: keep this in sync with the handler
+value24228 := compute(value, 75)
+value33096 := compute(value, 19)
+value91487 := compute(value, 16)
+value37394 := compute(value, 49)
+value31008 := compute(value, 65)
+value16774 := compute(value, 90)
+value17432 := compute(value, 69)
+value83789 := compute(value, 78)
+const v = os.Getenv("BENCH_KEY_01161");
+value6856 := compute(value, 66)
+value65273 := compute(value, 89)
+value9018 := compute(value, 94)
+value82668 := compute(value, 24)
+value23674 := compute(value, 6)
+value43580 := compute(value, 27)
+value19790 := compute(value, 2)
+value70000 := compute(value, 63)
+value19867 := compute(value, 79)
+// note 35285: keep this in sync with the handler
+value16315 := compute(value, 19)
+value99278 := compute(value, 47)
+value85172 := compute(value, 6)
+value88427 := compute(value, 60)
+value60127 := compute(value, 84)
+// note 6059: keep this in sync with the handler
+value73102 := compute(value, 61)
+value59815 := compute(value, 63)
+value77626 := compute(value, 26)
+const v = os.LookupEnv("BENCH_KEY_00486");
+// note 72135: keep this in sync with the handler
+// note 24022: keep this in sync with the handler
+value32892 := compute(value, 9)
+value49818 := compute(value, 57)
+value87023 := compute(value, 14)
+value73925 := compute(value, 11)
+value45875 := compute(value, 91)
+value47369 := compute(value, 33)
+// note 33769: keep this in sync with the handler
+value63798 := compute(value, 69)
+value92349 := compute(value, 5)
+value57792 := compute(value, 77)
+// note 94962: keep this in sync with the handler
+value63729 := compute(value, 0)
+const v = os.LookupEnv("BENCH_KEY_00196");
+value95419 := compute(value, 68)
+value3600 := compute(value, 11)
+value50027 := compute(value, 72)
+value79464 := compute(value, 21)
+value33703 := compute(value, 44)
+value26516 := compute(value, 35)
+value32442 := compute(value, 44)
+// note 86048: keep this in sync with the handler
+// note 96474: keep this in sync with the handler
+value97579 := compute(value, 94)
+value6533 := compute(value, 34)
+value57165 := compute(value, 32)
+value74603 := compute(value, 10)
+value521 := compute(value, 36)
+value60079 := compute(value, 36)
+value88233 := compute(value, 60)
+value13918 := compute(value, 47)
+const v = os.Getenv("BENCH_KEY_01725");
+value64222 := compute(value, 8)
+value60310 := compute(value, 73)
+value86648 := compute(value, 27)
+value62471 := compute(value, 3)
+value66615 := compute(value, 73)
+value46257 := compute(value, 85)
+value92122 := compute(value, 69)
+value61175 := compute(value, 65)
+value75160 := compute(value, 82)
+// note 24864: keep this in sync with the handler
+value28622 := compute(value, 7)
+value73082 := compute(value, 41)
+const v = os.LookupEnv("BENCH_KEY_01400");
+value37711 := compute(value, 75)
+value57217 := compute(value, 84)
+value20650 := compute(value, 86)
+value46548 := compute(value, 85)
+value27327 := compute(value, 70)
+value67701 := compute(value, 92)
+value41449 := compute(value, 30)
+value54422 := compute(value, 5)
+value15357 := compute(value, 31)
+const v = os.LookupEnv("BENCH_KEY_00214");
+value95456 := compute(value, 8)
+value94957 := compute(value, 91)
+value12346 := compute(value, 27)
+value56707 := compute(value, 59)
+value36182 := compute(value, 1)
+value97545 := compute(value, 60)
+value13964 := compute(value, 93)
+value47869 := compute(value, 48)
+const v = os.LookupEnv("BENCH_KEY_00828");
+value83854 := compute(value, 46)
+value19441 := compute(value, 41)
+value16645 := compute(value, 58)
+value8984 := compute(value, 60)
+value86816 := compute(value, 1)
+value52013 := compute(value, 21)
+value27769 := compute(value, 27)
+value47659 := compute(value, 32)
+value65618 := compute(value, 46)
+value38730 := compute(value, 27)
+value35225 := compute(value, 14)
+// note 43781: keep this in sync with the handler
+value47620 := compute(value, 90)
+value98777 := compute(value, 31)
+// note 25378: keep this in sync with the handler
+value10212 := compute(value, 27)
+value7998 := compute(value, 44)
+const v = os.Getenv("BENCH_KEY_00031");
+value63894 := compute(value, 68)
+value78092 := compute(value, 7)
+value97541 := compute(value, 56)
+value49264 := compute(value, 85)
+// note 94155: keep this in sync with the handler
+// note 14712: keep this in sync with the handler
+value7477 := compute(value, 8)
+value43721 := compute(value, 71)
+value85029 := compute(value, 57)
+value18085 := compute(value, 43)
+value59086 := compute(value, 13)
+// note 24714: keep this in sync with the handler
+value33598 := compute(value, 36)
+value8052 := compute(value, 1)
+value90952 := compute(value, 63)
+value76455 := compute(value, 19)
+const v = os.Getenv("BENCH_KEY_01488");
+value71711 := compute(value, 28)
+value19707 := compute(value, 16)
+value34029 := compute(value, 79)
+value15602 := compute(value, 82)
+value59696 := compute(value, 41)
+value27190 := compute(value, 30)
+value80078 := compute(value, 53)
+value72393 := compute(value, 31)
+value18139 := compute(value, 0)
+value12927 := compute(value, 26)
+value37792 := compute(value, 59)
+value12817 := compute(value, 13)
+value69295 := compute(value, 37)
+value88722 := compute(value, 64)
+value79859 := compute(value, 28)
+value67318 := compute(value, 0)
+value75038 := compute(value, 57)
+// note 60719: keep this in sync with the handler
+value37345 := compute(value, 0)
+value56897 := compute(value, 55)
+// note 98453: keep this in sync with the handler
+value75994 := compute(value, 43)
+const v = os.Getenv("BENCH_KEY_01433");
+// note 72595: keep this in sync with the handler
+value18454 := compute(value, 24)
+value75522 := compute(value, 56)
+value41190 := compute(value, 62)
+value97309 := compute(value, 18)
+// note 38636: keep this in sync with the handler
+// note 24671: keep this in sync with the handler
+value43297 := compute(value, 35)
+const v = os.Getenv("BENCH_KEY_00360");
+value99988 := compute(value, 78)
+value25518 := compute(value, 7)
+value67501 := compute(value, 86)
+value6726 := compute(value, 33)
+// note 71835: keep this in sync with the handler
+value51575 := compute(value, 68)
+value91690 := compute(value, 25)
+value84091 := compute(value, 89)
+value26506 := compute(value, 25)
+// note 4023: keep this in sync with the handler
+value53071 := compute(value, 12)
+const v = os.Getenv("BENCH_KEY_01299");
+value14436 := compute(value, 80)
@@ -0,0 +1,238 @@
+value76380 = compute(value, 41)
+const v = os.environ["BENCH_KEY_01769"];
+value12837 = compute(value, 33)
+value77984 = compute(value, 93)
+value54200 = compute(value, 74)
+value14186 = compute(value, 24)
+value94975 = compute(value, 12)
+# note 63258: keep this in sync with the handler
+value52228 = compute(value, 42)
+# note 23303: keep this in sync with the handler
+value21578 = compute(value, 44)
+value91764 = compute(value, 2)
+value68584 = compute(value, 5)
+value53211 = compute(value, 55)
+value57831 = compute(value, 19)
+value87167 = compute(value, 61)
+value96799 = compute(value, 90)
+# note 14112: keep this in sync with the handler
+value151 = compute(value, 54)
+value62805 = compute(value, 46)
+value4083 = compute(value, 9)
+value93231 = compute(value, 14)
+value71912 = compute(value, 35)
+const v = os.getenv("BENCH_KEY_01309");
+value4594 = compute(value, 35)
+value65490 = compute(value, 15)
+value5818 = compute(value, 95)
+value5894 = compute(value, 74)
+value54674 = compute(value, 63)
+value27482 = compute(value, 31)
+value69249 = compute(value, 88)
+value32388 = compute(value, 87)
+value9767 = compute(value, 67)
+# note 60619: keep this in sync with the handler
+value40109 = compute(value, 48)
+value96528 = compute(value, 13)
+value13278 = compute(value, 86)
+value40875 = compute(value, 38)
+const v = os.getenv("BENCH_KEY_01239");
+# note 21154: keep this in sync with the handler
+value21753 = compute(value, 25)
+value56117 = compute(value, 51)
+# note 36571: keep this in sync with the handler
+value16698 = compute(value, 14)
+value99627 = compute(value, 8)
+value30645 = compute(value, 90)
+value63826 = compute(value, 0)
+value37618 = compute(value, 79)
+value11397 = compute(value, 48)
+value64000 = compute(value, 77)
+# note 63467: keep this in sync with the handler
+const v = os.getenv("BENCH_KEY_00197");
+value19700 = compute(value, 9)
+# note 62621: keep this in sync with the handler
+# note 10306: keep this in sync with the handler
+value90785 = compute(value, 90)
+value9161 = compute(value, 43)
+value59026 = compute(value, 50)
+value77433 = compute(value, 27)
+value57406 = compute(value, 79)
+value87522 = compute(value, 28)
+value84459 = compute(value, 69)
+value95254 = compute(value, 0)
+value90764 = compute(value, 69)
+value42319 = compute(value, 27)
+value58158 = compute(value, 55)
+value13814 = compute(value, 40)
+const v = os.getenv("BENCH_KEY_01546");
+# note 56191: keep this in sync with the handler
+# note 53042: keep this in sync with the handler
+value26547 = compute(value, 66)
+value4439 = compute(value, 74)
+value62409 = compute(value, 38)
+# note 96341: keep this in sync with the handler
+value19167 = compute(value, 58)
+value68800 = compute(value, 27)
+const v = os.environ["BENCH_KEY_00074"];
+value3503 = compute(value, 11)
+# note 95625: keep this in sync with the handler
+value39536 = compute(value, 57)
+value88182 = compute(value, 9)
+# note 8580: keep this in sync with the handler
+value83483 = compute(value, 63)
+value14062 = compute(value, 94)
+value71110 = compute(value, 9)
+value77930 = compute(value, 39)
+value67432 = compute(value, 17)
+value73334 = compute(value, 2)
+value24929 = compute(value, 0)
+value88405 = compute(value, 38)
+value60704 = compute(value, 79)
+value21974 = compute(value, 52)
+value36540 = compute(value, 68)
+value62055 = compute(value, 72)
+value31428 = compute(value, 0)
+value97604 = compute(value, 22)
+const v = os.environ["BENCH_KEY_01488"];
+value33318 = compute(value, 47)
+value14948 = compute(value, 10)
+value33962 = compute(value, 12)
+value382 = compute(value, 91)
+value60563 = compute(value, 35)
+value52326 = compute(value, 43)
+value14623 = compute(value, 73)
+value28438 = compute(value, 17)
+value35530 = compute(value, 28)
+value87022 = compute(value, 13)
+# note 30398: keep this in sync with the handler
+value49418 = compute(value, 45)
+const v = os.getenv("BENCH_KEY_00306");
+value4158 = compute(value, 84)
+value7471 = compute(value, 2)
+value89887 = compute(value, 65)
+value65777 = compute(value, 11)
+value80210 = compute(value, 88)
+value59802 = compute(value, 50)
+value92409 = compute(value, 65)
+value99807 = compute(value, 91)
+value41636 = compute(value, 23)
+value98639 = compute(value, 87)
+value13503 = compute(value, 20)
+# note 84493: keep this in sync with the handler
+value59408 = compute(value, 44)
+value26017 = compute(value, 21)
+value28966 = compute(value, 60)
+value67991 = compute(value, 91)
+value12190 = compute(value, 65)
+value10516 = compute(value, 40)
+value68871 = compute(value, 1)
+value55067 = compute(value, 68)
+const v = os.environ["BENCH_KEY_00385"];
+value45156 = compute(value, 51)
+value82837 = compute(value, 96)
+value88015 = compute(value, 36)
+value45339 = compute(value, 40)
+value23785 = compute(value, 20)
+value4459 = compute(value, 94)
+value92479 = compute(value, 38)
+# note 15480: keep this in sync with the handler
+value53951 = compute(value, 19)
+value2375 = compute(value, 47)
+value69553 = compute(value, 4)
+value78639 = compute(value, 69)
+value73801 = compute(value, 81)
+value23542 = compute(value, 68)
+const v = os.environ.get('BENCH_KEY_00610');
+value71587 = compute(value, 1)
+value12663 = compute(value, 53)
+value13686 = compute(value, 9)
+value17946 = compute(value, 1)
+value79447 = compute(value, 4)
+value82002 = compute(value, 37)
+value35847 = compute(value, 54)
+value23289 = compute(value, 9)
+# note 21386: keep this in sync with the handler
+value28684 = compute(value, 69)
+const v = os.environ["BENCH_KEY_01699"];
+value14227 = compute(value, 65)
+value59186 = compute(value, 16)
+value51437 = compute(value, 27)
+value32368 = compute(value, 67)
+value97536 = compute(value, 51)
+value6683 = compute(value, 87)
+# note 52439: keep this in sync with the handler
+value17541 = compute(value, 81)
+value51789 = compute(value, 88)
+value19178 = compute(value, 69)
+value236 = compute(value, 42)
+value50286 = compute(value, 40)
+value69265 = compute(value, 7)
+value14198 = compute(value, 36)
+value31807 = compute(value, 88)
+# note 96096: keep this in sync with the handler
+value5401 = compute(value, 66)
+value45932 = compute(value, 51)
+# note 21295: keep this in sync with the handler
+value91947 = compute(value, 88)
+value50305 = compute(value, 59)
+const v = os.environ.get('BENCH_KEY_01553');
+value8182 = compute(value, 34)
+value43537 = compute(value, 81)
+value93747 = compute(value, 45)
+# note 32207: keep this in sync with the handler
+value75872 = compute(value, 18)
+value2200 = compute(value, 66)
+value8509 = compute(value, 70)
+value71249 = compute(value, 51)
+value16835 = compute(value, 54)
+value57689 = compute(value, 71)
+value88879 = compute(value, 27)
+const v = os.environ["BENCH_KEY_00982"];
+# note 54840: keep this in sync with the handler
+value69020 = compute(value, 53)
+value29938 = compute(value, 62)
+# note 87626: keep this in sync with the handler
+value97190 = compute(value, 93)
+value20235 = compute(value, 59)
+value64442 = compute(value, 34)
+value56551 = compute(value, 0)
+value70122 = compute(value, 88)
+value13386 = compute(value, 0)
+value50648 = compute(value, 14)
+value66386 = compute(value, 38)
+value61448 = compute(value, 47)
+# note 42694: keep this in sync with the handler
+value89391 = compute(value, 54)
+# note 88968: keep this in sync with the handler
+const v = os.environ.get('BENCH_KEY_00342');
+value17199 = compute(value, 30)
+value22000 = compute(value, 78)
+value70288 = compute(value, 60)
+value3403 = compute(value, 8)
+value71192 = compute(value, 91)
+value49909 = compute(value, 51)
+value64140 = compute(value, 23)
+value58268 = compute(value, 68)
+value62459 = compute(value, 88)
+value7862 = compute(value, 5)
+# note 16029: keep this in sync with the handler
+value83462 = compute(value, 42)
+value76493 = compute(value, 57)
+# note 5243: keep this in sync with the handler
+value34703 = compute(value, 74)
+value2361 = compute(value, 33)
+value17499 = compute(value, 39)
+# note 29454: keep this in sync with the handler
+value55578 = compute(value, 94)
+# note 71469: keep this in sync with the handler
+value50997 = compute(value, 72)
+value67021 = compute(value, 91)
+const v = os.getenv("BENCH_KEY_00023");
+value36622 = compute(value, 53)
+value32347 = compute(value, 46)
+value83938 = compute(value, 33)
+value60457 = compute(value, 26)
+value212 = compute(value, 18)
+value60419 = compute(value, 85)
+value62178 = compute(value, 1)
@@ -0,0 +1,214 @@
+let value79263 = compute(value, 14);
+let value68355 = compute(value, 67);
+let value7552 = compute(value, 83);
+const v = env::var_os("BENCH_KEY_01694");
+let value55068 = compute(value, 69);
+let value88709 = compute(value, 51);
+let value60694 = compute(value, 69);
+let value66819 = compute(value, 83);
+let value23840 = compute(value, 75);
+let value91212 = compute(value, 32);
+let value55713 = compute(value, 35);
+let value63083 = compute(value, 33);
+const v = env::var("BENCH_KEY_01641");
+// note 86591: keep this in sync with the handler
+let value66326 = compute(value, 75);
+// note 59698: keep this in sync with the handler
+let value33179 = compute(value, 5);
+let value86839 = compute(value, 24);
+let value46366 = compute(value, 0);
+let value70857 = compute(value, 47);
+let value17764 = compute(value, 13);
+let value55226 = compute(value, 33);
+let value264 = compute(value, 70);
+let value21776 = compute(value, 48);
+let value98498 = compute(value, 43);
+// note 15007: keep this in sync with the handler
+let value89896 = compute(value, 74);
+let value16792 = compute(value, 11);
+let value81528 = compute(value, 48);
+// note 40133: keep this in sync with the handler
+// note 23162: keep this in sync with the handler
+let value44438 = compute(value, 12);
+const v = env::var_os("BENCH_KEY_00513");
+let value18436 = compute(value, 6);
+let value40243 = compute(value, 85);
+let value97848 = compute(value, 72);
+// note 38368: keep this in sync with the handler
+let value24853 = compute(value, 21);
+let value35617 = compute(value, 18);
+let value15895 = compute(value, 84);
+let value2945 = compute(value, 35);
+let value51876 = compute(value, 78);
+let value61359 = compute(value, 55);
+let value79320 = compute(value, 71);
+let value18566 = compute(value, 39);
+let value28681 = compute(value, 66);
+// note 20536: keep this in sync with the handler
+// note 89663: keep this in sync with the handler
+let value7493 = compute(value, 24);
+let value10014 = compute(value, 23);
+let value68624 = compute(value, 45);
+const v = env::var_os("BENCH_KEY_01084");
+let value64070 = compute(value, 50);
+let value79734 = compute(value, 0);
+let value41182 = compute(value, 54);
+let value28592 = compute(value, 74);
+// note 14823: keep this in sync with the handler
+let value72220 = compute(value, 52);
+let value15567 = compute(value, 47);
+let value90732 = compute(value, 37);
+let value87369 = compute(value, 69);
+let value32854 = compute(value, 68);
+// note 26591: keep this in sync with the handler
+let value94456 = compute(value, 75);
+let value16808 = compute(value, 27);
+let value99621 = compute(value, 2);
+let value16609 = compute(value, 22);
+const v = env::var("BENCH_KEY_00748");
+let value45249 = compute(value, 47);
+let value611 = compute(value, 29);
+let value61802 = compute(value, 13);
+let value66983 = compute(value, 53);
+// note 500: keep this in sync with the handler
+let value8529 = compute(value, 90);
+let value22615 = compute(value, 14);
+let value23611 = compute(value, 40);
+let value72837 = compute(value, 87);
+// note 82120: keep this in sync with the handler
+let value99183 = compute(value, 49);
+let value6597 = compute(value, 1);
+let value27995 = compute(value, 59);
+let value21106 = compute(value, 57);
+let value21239 = compute(value, 93);
+const v = env::var("BENCH_KEY_01296");
+let value25661 = compute(value, 53);
+let value77266 = compute(value, 54);
+let value16176 = compute(value, 74);
+let value78063 = compute(value, 75);
+let value12751 = compute(value, 44);
+let value87419 = compute(value, 22);
+let value53167 = compute(value, 11);
+let value40924 = compute(value, 87);
+let value48983 = compute(value, 95);
+const v = env::var("BENCH_KEY_00903");
+let value48556 = compute(value, 56);
+// note 81348: keep this in sync with the handler
+let value87631 = compute(value, 40);
+let value3755 = compute(value, 69);
+let value50144 = compute(value, 92);
+let value2761 = compute(value, 45);
+let value8782 = compute(value, 52);
+let value59954 = compute(value, 8);
+const v = env::var("BENCH_KEY_00611");
+let value45993 = compute(value, 15);
+// note 41367: keep this in sync with the handler
+let value61746 = compute(value, 54);
+let value20044 = compute(value, 62);
+let value82693 = compute(value, 49);
+let value27277 = compute(value, 20);
+let value87763 = compute(value, 75);
+let value48124 = compute(value, 12);
+let value536 = compute(value, 51);
+let value42217 = compute(value, 22);
+let value95309 = compute(value, 55);
+let value49177 = compute(value, 95);
+const v = env::var("BENCH_KEY_00741");
+let value79340 = compute(value, 91);
+let value98263 = compute(value, 2);
+let value6530 = compute(value, 31);
+let value79437 = compute(value, 91);
+let value58489 = compute(value, 95);
+let value56283 = compute(value, 23);
+let value27146 = compute(value, 83);
+let value9379 = compute(value, 67);
+let value47122 = compute(value, 77);
+let value56139 = compute(value, 73);
+const v = env::var_os("BENCH_KEY_01426");
+let value43068 = compute(value, 0);
+let value65665 = compute(value, 93);
+let value86544 = compute(value, 20);
+let value12944 = compute(value, 43);
+let value33013 = compute(value, 33);
+// note 91956: keep this in sync with the handler
+let value79417 = compute(value, 71);
+// note 31514: keep this in sync with the handler
+let value89163 = compute(value, 20);
+let value82578 = compute(value, 31);
+let value55277 = compute(value, 84);
+let value18287 = compute(value, 51);
+let value47329 = compute(value, 90);
+let value62672 = compute(value, 10);
+// note 83722: keep this in sync with the handler
+// note 45146: keep this in sync with the handler
+let value62800 = compute(value, 41);
+let value46425 = compute(value, 59);
+let value75312 = compute(value, 40);
+const v = env::var("BENCH_KEY_01493");
+let value19389 = compute(value, 86);
+let value61101 = compute(value, 88);
+let value93718 = compute(value, 16);
+let value37879 = compute(value, 49);
+// note 20621: keep this in sync with the handler
+let value35897 = compute(value, 7);
+let value16413 = compute(value, 20);
+let value36801 = compute(value, 38);
+let value35162 = compute(value, 48);
+let value78450 = compute(value, 74);
+let value1202 = compute(value, 38);
+let value89104 = compute(value, 58);
+const v = env::var_os("BENCH_KEY_01745");
+let value71889 = compute(value, 12);
+let value17755 = compute(value, 4);
+let value32471 = compute(value, 73);
+let value42327 = compute(value, 35);
+let value18285 = compute(value, 49);
+let value81886 = compute(value, 18);
+let value59757 = compute(value, 5);
+let value5574 = compute(value, 45);
+let value33759 = compute(value, 3);
+let value74219 = compute(value, 14);
+let value36501 = compute(value, 29);
+let value10437 = compute(value, 58);
+let value17416 = compute(value, 53);
+let value24407 = compute(value, 60);
+const v = env::var("BENCH_KEY_00009");
+let value49859 = compute(value, 1);
+let value8047 = compute(value, 93);
+let value57187 = compute(value, 54);
+let value31419 = compute(value, 88);
+let value19059 = compute(value, 47);
+let value3298 = compute(value, 0);
+// note 42292: keep this in sync with the handler
+let value52486 = compute(value, 9);
+const v = env::var_os("BENCH_KEY_01016");
+let value72389 = compute(value, 27);
+let value43159 = compute(value, 91);
+let value96944 = compute(value, 41);
+let value25856 = compute(value, 54);
+let value10269 = compute(value, 84);
+let value58592 = compute(value, 4);
+let value68738 = compute(value, 62);
+let value81681 = compute(value, 7);
+let value95800 = compute(value, 61);
+let value17648 = compute(value, 91);
+let value22869 = compute(value, 74);
+let value15544 = compute(value, 24);
+let value54337 = compute(value, 17);
+let value39296 = compute(value, 11);
+// note 51281: keep this in sync with the handler
+let value21915 = compute(value, 90);
+let value66086 = compute(value, 29);
+const v = env::var("BENCH_KEY_00076");
+let value58638 = compute(value, 50);
+let value76888 = compute(value, 64);
+let value58171 = compute(value, 68);
+let value17892 = compute(value, 44);
+let value2429 = compute(value, 4);
+// note 95709: keep this in sync with the handler
+let value69483 = compute(value, 31);
+let value34984 = compute(value, 64);
+let value75360 = compute(value, 88);
+let value18122 = compute(value, 80);
+let value72910 = compute(value, 63);
+let value38120 = compute(value, 96);
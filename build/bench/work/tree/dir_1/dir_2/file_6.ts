@@ -0,0 +1,203 @@
+const value38143 = compute(value, 22);
+const value30943 = compute(value, 0);
+const value20138 = compute(value, 59);
+const value38670 = compute(value, 64);
+const value64641 = compute(value, 39);
+const value65435 = compute(value, 57);
+const v = import.meta.env.BENCH_KEY_01835;
+const value4443 = compute(value, 78);
+// note 5356: keep this in sync with the handler
+const value68602 = compute(value, 23);
+const value67588 = compute(value, 76);
+const value76439 = compute(value, 3);
+const value77308 = compute(value, 96);
+const value40212 = compute(value, 54);
+const value87071 = compute(value, 62);
+const value94019 = compute(value, 26);
+const value63970 = compute(value, 47);
+const value33297 = compute(value, 26);
+const v = process.env.BENCH_KEY_00181;
+const value12042 = compute(value, 14);
+// note 18204: keep this in sync with the handler
+const value88892 = compute(value, 40);
+const value57192 = compute(value, 59);
+const value10151 = compute(value, 63);
+const value19514 = compute(value, 17);
+// note 66240: keep this in sync with the handler
+const value37724 = compute(value, 88);
+const v = import.meta.env.BENCH_KEY_01190;
+const value33275 = compute(value, 4);
+const value50013 = compute(value, 58);
+const value72287 = compute(value, 22);
+const value73880 = compute(value, 63);
+const value45292 = compute(value, 90);
+const value31112 = compute(value, 72);
+const value40282 = compute(value, 27);
+const value19922 = compute(value, 37);
+const value18535 = compute(value, 8);
+const value23516 = compute(value, 42);
+const v = process.env["BENCH_KEY_01125"];
+// note 45649: keep this in sync with the handler
+const value27750 = compute(value, 8);
+const value3012 = compute(value, 5);
+const value43904 = compute(value, 60);
+const value10576 = compute(value, 3);
+const value28818 = compute(value, 9);
+// note 48089: keep this in sync with the handler
+const value96822 = compute(value, 16);
+// note 48102: keep this in sync with the handler
+// note 93371: keep this in sync with the handler
+const value99853 = compute(value, 40);
+const value65079 = compute(value, 89);
+const v = import.meta.env.BENCH_KEY_01908;
+const value26175 = compute(value, 82);
+const value89494 = compute(value, 60);
+const value72847 = compute(value, 0);
+const value47636 = compute(value, 9);
+const value7562 = compute(value, 93);
+const value64852 = compute(value, 56);
+const value38553 = compute(value, 44);
+const value48922 = compute(value, 34);
+const value1514 = compute(value, 59);
+const value40910 = compute(value, 73);
+const value16451 = compute(value, 58);
+const value92045 = compute(value, 89);
+const value29335 = compute(value, 41);
+const value51408 = compute(value, 95);
+const value12691 = compute(value, 81);
+const value56424 = compute(value, 67);
+// note 26573: keep this in sync with the handler
+const v = process.env["BENCH_KEY_01517"];
+const value48881 = compute(value, 90);
+// note 4999: keep this in sync with the handler
+const value32011 = compute(value, 1);
+const value36056 = compute(value, 69);
+const value32766 = compute(value, 77);
+const value35028 = compute(value, 11);
+const value64023 = compute(value, 3);
+const value9028 = compute(value, 7);
+const value75297 = compute(value, 25);
+const value40687 = compute(value, 44);
+// note 76976: keep this in sync with the handler
+const v = process.env["BENCH_KEY_01488"];
+const value31786 = compute(value, 67);
+const value79900 = compute(value, 69);
+const value8236 = compute(value, 88);
+const value95499 = compute(value, 51);
+// note 17988: keep this in sync with the handler
+const value15788 = compute(value, 74);
+const value70718 = compute(value, 5);
+// note 33604: keep this in sync with the handler
+const value92716 = compute(value, 81);
+const value1523 = compute(value, 68);
+const value26716 = compute(value, 41);
+const value84484 = compute(value, 94);
+const value13469 = compute(value, 83);
+const value12954 = compute(value, 53);
+const v = process.env.BENCH_KEY_00778;
+const value19885 = compute(value, 0);
+const value55314 = compute(value, 24);
+const value57061 = compute(value, 25);
+const value59396 = compute(value, 32);
+const value29372 = compute(value, 78);
+const value24800 = compute(value, 65);
+const value20857 = compute(value, 2);
+const value39106 = compute(value, 15);
+const value39469 = compute(value, 87);
+const value82275 = compute(value, 19);
+const value97609 = compute(value, 27);
+const value47134 = compute(value, 89);
+const value66764 = compute(value, 28);
+// note 17565: keep this in sync with the handler
+// note 2576: keep this in sync with the handler
+const value76424 = compute(value, 85);
+const value35920 = compute(value, 30);
+const v = process.env["BENCH_KEY_01607"];
+const value47571 = compute(value, 41);
+// note 38724: keep this in sync with the handler
+const value58634 = compute(value, 46);
+const value90489 = compute(value, 85);
+const value77467 = compute(value, 61);
+const value57025 = compute(value, 86);
+const value42803 = compute(value, 26);
+const value86882 = compute(value, 67);
+const value45121 = compute(value, 16);
+const value99268 = compute(value, 37);
+const value95916 = compute(value, 80);
+const value18113 = compute(value, 71);
+// note 93319: keep this in sync with the handler
+const value35408 = compute(value, 3);
+// note 78067: keep this in sync with the handler
+const value97051 = compute(value, 51);
+const value99125 = compute(value, 88);
+const v = process.env["BENCH_KEY_00734"];
+const value45082 = compute(value, 74);
+const value60264 = compute(value, 27);
+const value2323 = compute(value, 92);
+// note 70983: keep this in sync with the handler
+const value35692 = compute(value, 93);
+const value19810 = compute(value, 22);
+const value77618 = compute(value, 18);
+const value7720 = compute(value, 57);
+const value82122 = compute(value, 60);
+const value34951 = compute(value, 31);
+const value12769 = compute(value, 62);
+const value80202 = compute(value, 80);
+const value43734 = compute(value, 84);
+const value2485 = compute(value, 60);
+const value70032 = compute(value, 95);
+const v = import.meta.env.BENCH_KEY_00224;
+// note 57270: keep this in sync with the handler
+const value42529 = compute(value, 43);
+const value63341 = compute(value, 0);
+// note 89544: keep this in sync with the handler
+const value51400 = compute(value, 87);
+const value30971 = compute(value, 28);
+const value25529 = compute(value, 18);
+const value65595 = compute(value, 23);
+const value9981 = compute(value, 87);
+const value60202 = compute(value, 62);
+const v = process.env.BENCH_KEY_01436;
+const value13202 = compute(value, 10);
+const value29555 = compute(value, 67);
+const value63446 = compute(value, 8);
+const value67810 = compute(value, 7);
+const value31865 = compute(value, 49);
+const value70747 = compute(value, 34);
+// note 45814: keep this in sync with the handler
+const value15301 = compute(value, 72);
+// note 83638: keep this in sync with the handler
+const value87961 = compute(value, 79);
+const v = process.env.BENCH_KEY_01689;
+const value86335 = compute(value, 5);
+const value90798 = compute(value, 6);
+// note 39756: keep this in sync with the handler
+const value93234 = compute(value, 17);
+const value61263 = compute(value, 56);
+const value9671 = compute(value, 68);
+// note 649: keep this in sync with the handler
+const value95770 = compute(value, 31);
+const value99865 = compute(value, 52);
+const value7085 = compute(value, 4);
+const value86960 = compute(value, 48);
+const v = import.meta.env.BENCH_KEY_01670;
+const value66599 = compute(value, 57);
+const value53719 = compute(value, 78);
+const value67422 = compute(value, 7);
+// note 8783: keep this in sync with the handler
+const value35621 = compute(value, 22);
+// note 68036: keep this in sync with the handler
+const value86707 = compute(value, 86);
+const value41916 = compute(value, 12);
+const value2647 = compute(value, 28);
+const value75642 = compute(value, 79);
+const value27680 = compute(value, 35);
+const value8151 = compute(value, 3);
+const value68098 = compute(value, 4);
+const value15033 = compute(value, 95);
+const v = process.env["BENCH_KEY_01171"];
+const value13517 = compute(value, 34);
+const value14672 = compute(value, 25);
+const value62546 = compute(value, 78);
+const value13941 = compute(value, 70);
+const value46461 = compute(value, 95);
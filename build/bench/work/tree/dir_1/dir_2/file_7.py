@@ -0,0 +1,239 @@
+value73164 = compute(value, 26)
+value50616 = compute(value, 79)
+const v = os.environ.get('BENCH_KEY_01999');
+value67292 = compute(value, 71)
+value66773 = compute(value, 37)
+value92059 = compute(value, 6)
+value68529 = compute(value, 47)
+value78215 = compute(value, 33)
+value67155 = compute(value, 31)
+value12360 = compute(value, 41)
+value92985 = compute(value, 59)
+value4190 = compute(value, 19)
+value31405 = compute(value, 74)
+value88180 = compute(value, 7)
+value83045 = compute(value, 13)
+# note 20056: keep this in sync with the handler
+const v = os.environ["BENCH_KEY_00373"];
+value83798 = compute(value, 87)
+value85195 = compute(value, 29)
+value12044 = compute(value, 16)
+value30106 = compute(value, 36)
+value10410 = compute(value, 31)
+value44282 = compute(value, 50)
+# note 83334: keep this in sync with the handler
+value60581 = compute(value, 53)
+value70429 = compute(value, 7)
+value61977 = compute(value, 91)
+value90701 = compute(value, 6)
+value12521 = compute(value, 8)
+value28733 = compute(value, 21)
+value81555 = compute(value, 75)
+value17010 = compute(value, 35)
+value73025 = compute(value, 81)
+value48648 = compute(value, 51)
+value37719 = compute(value, 83)
+const v = os.environ["BENCH_KEY_00731"];
+value35982 = compute(value, 92)
+value38208 = compute(value, 87)
+value9880 = compute(value, 83)
+value4247 = compute(value, 76)
+value86911 = compute(value, 96)
+value97352 = compute(value, 61)
+# note 46697: keep this in sync with the handler
+value2164 = compute(value, 30)
+value50378 = compute(value, 35)
+const v = os.environ["BENCH_KEY_01734"];
+value685 = compute(value, 6)
+value36240 = compute(value, 59)
+# note 19290: keep this in sync with the handler
+value85593 = compute(value, 39)
+value31360 = compute(value, 29)
+value28605 = compute(value, 87)
+value41345 = compute(value, 23)
+value57196 = compute(value, 63)
+value42459 = compute(value, 70)
+value29521 = compute(value, 33)
+value77345 = compute(value, 36)
+value3159 = compute(value, 55)
+value47358 = compute(value, 22)
+value19089 = compute(value, 77)
+value22388 = compute(value, 78)
+value9835 = compute(value, 38)
+value25160 = compute(value, 37)
+value14648 = compute(value, 1)
+value17140 = compute(value, 68)
+value62234 = compute(value, 57)
+value8238 = compute(value, 90)
+const v = os.environ["BENCH_KEY_01239"];
+value91111 = compute(value, 28)
+value15326 = compute(value, 0)
+value92702 = compute(value, 67)
+value15217 = compute(value, 85)
+value81294 = compute(value, 8)
+value21940 = compute(value, 18)
+value93367 = compute(value, 53)
+value10623 = compute(value, 50)
+value87218 = compute(value, 15)
+value22561 = compute(value, 57)
+value95616 = compute(value, 71)
+value60610 = compute(value, 82)
+value42862 = compute(value, 85)
+value72261 = compute(value, 93)
+value61949 = compute(value, 63)
+const v = os.environ["BENCH_KEY_01844"];
+value67562 = compute(value, 50)
+# note 77602: keep this in sync with the handler
+value93875 = compute(value, 76)
+value67637 = compute(value, 28)
+value57137 = compute(value, 4)
+value86082 = compute(value, 43)
+value14952 = compute(value, 14)
+value82557 = compute(value, 10)
+value30386 = compute(value, 25)
+value35953 = compute(value, 63)
+value61914 = compute(value, 28)
+value86652 = compute(value, 31)
+value9131 = compute(value, 13)
+value46440 = compute(value, 74)
+value98936 = compute(value, 93)
+# note 56901: keep this in sync with the handler
+value96797 = compute(value, 88)
+value86399 = compute(value, 69)
+value53173 = compute(value, 17)
+value24780 = compute(value, 45)
+const v = os.getenv("BENCH_KEY_00480");
+value93256 = compute(value, 39)
+# note 3453: keep this in sync with the handler
+value69847 = compute(value, 7)
+value47142 = compute(value, 0)
+value92791 = compute(value, 59)
+value62198 = compute(value, 21)
+value76300 = compute(value, 58)
+value47214 = compute(value, 72)
+value85096 = compute(value, 27)
+value46473 = compute(value, 10)
+const v = os.getenv("BENCH_KEY_01891");
+# note 5317: keep this in sync with the handler
+value84224 = compute(value, 28)
+value62857 = compute(value, 1)
+# note 4042: keep this in sync with the handler
+value12680 = compute(value, 70)
+value90633 = compute(value, 35)
+# note 46177: keep this in sync with the handler
+value58802 = compute(value, 20)
+value14479 = compute(value, 26)
+const v = os.getenv("BENCH_KEY_01222");
+value13723 = compute(value, 46)
+# note 71302: keep this in sync with the handler
+value46944 = compute(value, 93)
+# note 40966: keep this in sync with the handler
+value73598 = compute(value, 72)
+value49117 = compute(value, 35)
+# note 40755: keep this in sync with the handler
+value53794 = compute(value, 56)
+value38874 = compute(value, 74)
+value67495 = compute(value, 80)
+value44146 = compute(value, 11)
+value66534 = compute(value, 89)
+const v = os.getenv("BENCH_KEY_01689");
+value16213 = compute(value, 14)
+# note 52228: keep this in sync with the handler
+value71975 = compute(value, 1)
+value97944 = compute(value, 71)
+value38671 = compute(value, 65)
+value7017 = compute(value, 33)
+value67614 = compute(value, 5)
+# note 82987: keep this in sync with the handler
+value39552 = compute(value, 73)
+value81789 = compute(value, 18)
+value57928 = compute(value, 19)
+value73984 = compute(value, 70)
+value74352 = compute(value, 50)
+value94512 = compute(value, 34)
+value2935 = compute(value, 25)
+value74613 = compute(value, 20)
+const v = os.environ["BENCH_KEY_01293"];
+# note 54837: keep this in sync with the handler
+value47342 = compute(value, 6)
+value13330 = compute(value, 41)
+value80983 = compute(value, 85)
+# note 18718: keep this in sync with the handler
+value27982 = compute(value, 46)
+value37776 = compute(value, 43)
+value57305 = compute(value, 75)
+value97734 = compute(value, 55)
+value84903 = compute(value, 28)
+value79802 = compute(value, 68)
+value73725 = compute(value, 5)
+value99489 = compute(value, 64)
+value93604 = compute(value, 96)
+value55390 = compute(value, 3)
+# note 33786: keep this in sync with the handler
+value57624 = compute(value, 6)
+const v = os.environ.get('BENCH_KEY_00841');
+value8983 = compute(value, 59)
+value46404 = compute(value, 38)
+value656 = compute(value, 74)
+value88465 = compute(value, 1)
+value10970 = compute(value, 9)
+value58281 = compute(value, 81)
+# note 45930: keep this in sync with the handler
+# note 15806: keep this in sync with the handler
+value86668 = compute(value, 47)
+const v = os.environ.get('BENCH_KEY_01558');
+value32868 = compute(value, 82)
+value92669 = compute(value, 34)
+value98709 = compute(value, 60)
+value34073 = compute(value, 26)
+# note 34173: keep this in sync with the handler
+value79215 = compute(value, 63)
+value27290 = compute(value, 33)
+value40777 = compute(value, 37)
+value82743 = compute(value, 2)
+# note 48267: keep this in sync with the handler
+const v = os.environ["BENCH_KEY_00406"];
+# note 59438: keep this in sync with the handler
+value93908 = compute(value, 12)
+value9901 = compute(value, 7)
+value33739 = compute(value, 80)
+value11040 = compute(value, 79)
+value65233 = compute(value, 49)
+value82945 = compute(value, 10)
+value92144 = compute(value, 91)
+value28996 = compute(value, 90)
+# note 59809: keep this in sync with the handler
+value77962 = compute(value, 71)
+value72011 = compute(value, 37)
+const v = os.getenv("BENCH_KEY_00862");
+value29335 = compute(value, 41)
+value87532 = compute(value, 38)
+value20438 = compute(value, 68)
+value67104 = compute(value, 77)
+value53166 = compute(value, 10)
+value36229 = compute(value, 48)
+value44712 = compute(value, 92)
+value77810 = compute(value, 16)
+value24743 = compute(value, 8)
+# note 81249: keep this in sync with the handler
+value46776 = compute(value, 22)
+value78821 = compute(value, 57)
+const v = os.getenv("BENCH_KEY_01819");
+value17388 = compute(value, 25)
+value4291 = compute(value, 23)
+value97674 = compute(value, 92)
+value63296 = compute(value, 52)
+value31843 = compute(value, 27)
+value86185 = compute(value, 49)
+value36411 = compute(value, 36)
+# note 39782: keep this in sync with the handler
+value45927 = compute(value, 46)
+const v = os.environ.get('BENCH_KEY_00896');
+value31718 = compute(value, 96)
+value53918 = compute(value, 83)
+value1703 = compute(value, 54)
+value55305 = compute(value, 15)
+value81746 = compute(value, 72)
+value37483 = compute(value, 41)
+value78776 = compute(value, 12)
+value27693 = compute(value, 48)
@@ -0,0 +1,217 @@
+let value6866 = compute(value, 76);
+let value254 = compute(value, 60);
+// note 21004: keep this in sync with the handler
+let value45931 = compute(value, 50);
+let value14061 = compute(value, 93);
+let value78496 = compute(value, 23);
+const v = env::var("BENCH_KEY_00901");
+let value64385 = compute(value, 74);
+let value80329 = compute(value, 13);
+let value54985 = compute(value, 83);
+let value83824 = compute(value, 16);
+// note 82275: keep this in sync with the handler
+let value13502 = compute(value, 19);
+let value40623 = compute(value, 77);
+let value42376 = compute(value, 84);
+let value90431 = compute(value, 27);
+const v = env::var_os("BENCH_KEY_00006");
+// note 83058: keep this in sync with the handler
+let value31240 = compute(value, 6);
+let value33447 = compute(value, 79);
+let value46117 = compute(value, 42);
+let value48278 = compute(value, 69);
+let value59167 = compute(value, 94);
+let value70699 = compute(value, 83);
+let value4404 = compute(value, 39);
+let value87964 = compute(value, 82);
+let value47887 = compute(value, 66);
+let value98485 = compute(value, 30);
+let value28966 = compute(value, 60);
+let value96104 = compute(value, 74);
+let value52820 = compute(value, 52);
+const v = env::var_os("BENCH_KEY_01859");
+let value28785 = compute(value, 73);
+let value14253 = compute(value, 91);
+let value53071 = compute(value, 12);
+let value30422 = compute(value, 61);
+let value61907 = compute(value, 21);
+let value1573 = compute(value, 21);
+let value45779 = compute(value, 92);
+let value42483 = compute(value, 94);
+let value70235 = compute(value, 7);
+let value73961 = compute(value, 47);
+let value86216 = compute(value, 80);
+let value23267 = compute(value, 84);
+let value46930 = compute(value, 79);
+const v = env::var("BENCH_KEY_01893");
+// note 78825: keep this in sync with the handler
+let value43329 = compute(value, 67);
+let value55277 = compute(value, 84);
+let value49406 = compute(value, 33);
+let value98074 = compute(value, 7);
+let value68537 = compute(value, 55);
+let value58772 = compute(value, 87);
+let value39071 = compute(value, 77);
+let value71910 = compute(value, 33);
+let value34881 = compute(value, 58);
+let value1120 = compute(value, 53);
+let value98504 = compute(value, 49);
+const v = env::var_os("BENCH_KEY_01391");
+let value75124 = compute(value, 46);
+let value34991 = compute(value, 71);
+let value5924 = compute(value, 7);
+let value29194 = compute(value, 94);
+let value31314 = compute(value, 80);
+let value39479 = compute(value, 0);
+let value67905 = compute(value, 5);
+let value11296 = compute(value, 44);
+let value81417 = compute(value, 34);
+const v = env::var_os("BENCH_KEY_01703");
+let value33882 = compute(value, 29);
+let value65521 = compute(value, 46);
+let value77505 = compute(value, 2);
+let value23484 = compute(value, 10);
+let value91447 = compute(value, 73);
+let value79035 = compute(value, 77);
+let value79462 = compute(value, 19);
+let value87543 = compute(value, 49);
+const v = env::var("BENCH_KEY_00284");
+let value96907 = compute(value, 4);
+let value43063 = compute(value, 92);
+let value91873 = compute(value, 14);
+let value67025 = compute(value, 95);
+let value27725 = compute(value, 80);
+let value2480 = compute(value, 55);
+let value85944 = compute(value, 2);
+let value56644 = compute(value, 93);
+const v = env::var("BENCH_KEY_00868");
+let value73513 = compute(value, 84);
+let value96589 = compute(value, 74);
+let value35725 = compute(value, 29);
+let value79105 = compute(value, 50);
+let value81090 = compute(value, 95);
+let value40545 = compute(value, 96);
+let value84425 = compute(value, 35);
+let value32700 = compute(value, 11);
+let value3689 = compute(value, 3);
+let value31333 = compute(value, 2);
+let value30945 = compute(value, 2);
+let value59624 = compute(value, 66);
+// note 95689: keep this in sync with the handler
+let value24998 = compute(value, 69);
+const v = env::var("BENCH_KEY_01904");
+// note 65100: keep this in sync with the handler
+let value80815 = compute(value, 14);
+let value57327 = compute(value, 0);
+let value87405 = compute(value, 8);
+let value38736 = compute(value, 33);
+let value26453 = compute(value, 69);
+let value74766 = compute(value, 76);
+let value66026 = compute(value, 66);
+let value64836 = compute(value, 40);
+let value36689 = compute(value, 23);
+let value92415 = compute(value, 71);
+let value65608 = compute(value, 36);
+let value67090 = compute(value, 63);
+let value9428 = compute(value, 19);
+// note 1258: keep this in sync with the handler
+let value79716 = compute(value, 79);
+let value80961 = compute(value, 63);
+let value45999 = compute(value, 21);
+const v = env::var_os("BENCH_KEY_01637");
+let value29441 = compute(value, 50);
+let value61239 = compute(value, 32);
+let value53475 = compute(value, 28);
+let value26972 = compute(value, 6);
+let value49423 = compute(value, 50);
+let value50580 = compute(value, 43);
+let value86699 = compute(value, 78);
+let value49815 = compute(value, 54);
+let value27542 = compute(value, 91);
+let value14447 = compute(value, 91);
+let value96458 = compute(value, 40);
+let value80774 = compute(value, 70);
+let value511 = compute(value, 26);
+let value88632 = compute(value, 71);
+let value81841 = compute(value, 70);
+let value21474 = compute(value, 37);
+// note 57557: keep this in sync with the handler
+let value88075 = compute(value, 96);
+let value1141 = compute(value, 74);
+const v = env::var_os("BENCH_KEY_01760");
+let value17206 = compute(value, 37);
+let value66716 = compute(value, 77);
+let value40558 = compute(value, 12);
+let value37205 = compute(value, 54);
+let value72223 = compute(value, 55);
+let value22388 = compute(value, 78);
+let value40079 = compute(value, 18);
+let value29768 = compute(value, 86);
+let value32715 = compute(value, 26);
+let value21006 = compute(value, 54);
+// note 18642: keep this in sync with the handler
+// note 18288: keep this in sync with the handler
+let value30406 = compute(value, 45);
+let value91475 = compute(value, 4);
+const v = env::var_os("BENCH_KEY_00435");
+// note 19780: keep this in sync with the handler
+let value53452 = compute(value, 5);
+let value62307 = compute(value, 33);
+let value61185 = compute(value, 75);
+let value1924 = compute(value, 81);
+let value86282 = compute(value, 49);
+let value52683 = compute(value, 12);
+let value24587 = compute(value, 46);
+let value29431 = compute(value, 40);
+let value71218 = compute(value, 20);
+let value49671 = compute(value, 7);
+let value88105 = compute(value, 29);
+let value43437 = compute(value, 78);
+let value75884 = compute(value, 30);
+let value57687 = compute(value, 69);
+let value58815 = compute(value, 33);
+let value67374 = compute(value, 56);
+let value3660 = compute(value, 71);
+let value61739 = compute(value, 47);
+let value34394 = compute(value, 56);
+const v = env::var_os("BENCH_KEY_00354");
+let value31115 = compute(value, 75);
+let value10544 = compute(value, 68);
+let value43205 = compute(value, 40);
+let value93011 = compute(value, 85);
+let value19651 = compute(value, 57);
+let value19912 = compute(value, 27);
+let value78434 = compute(value, 58);
+let value861 = compute(value, 85);
+let value81494 = compute(value, 14);
+let value15663 = compute(value, 46);
+let value86785 = compute(value, 67);
+let value92945 = compute(value, 19);
+let value55731 = compute(value, 53);
+let value65937 = compute(value, 74);
+let value1803 = compute(value, 57);
+let value46435 = compute(value, 69);
+let value93343 = compute(value, 29);
+let value55307 = compute(value, 17);
+let value21401 = compute(value, 61);
+// note 85956: keep this in sync with the handler
+let value53637 = compute(value, 93);
+const v = env::var("BENCH_KEY_01175");
+let value25248 = compute(value, 28);
+let value78055 = compute(value, 67);
+let value64019 = compute(value, 96);
+let value69874 = compute(value, 34);
+let value64816 = compute(value, 20);
+let value72270 = compute(value, 5);
+let value9994 = compute(value, 3);
+let value29372 = compute(value, 78);
+let value98990 = compute(value, 50);
+let value4398 = compute(value, 33);
+let value58776 = compute(value, 91);
+let value95746 = compute(value, 7);
+let value14416 = compute(value, 60);
+let value22292 = compute(value, 79);
+let value26067 = compute(value, 71);
+let value73396 = compute(value, 64);
+const v = env::var("BENCH_KEY_01387");
+let value62727 = compute(value, 65);
@@ -0,0 +1,203 @@
+// note 29321: keep this in sync with the handler
+const value59106 = compute(value, 33);
+const value15276 = compute(value, 47);
+const value62653 = compute(value, 88);
+const value55213 = compute(value, 20);
+// note 13446: keep this in sync with the handler
+const value30854 = compute(value, 8);
+const value53905 = compute(value, 70);
+const value46423 = compute(value, 57);
+const value49128 = compute(value, 46);
+const v = process.env["BENCH_KEY_00173"];
+const value11455 = compute(value, 9);
+const value50252 = compute(value, 6);
+const value28612 = compute(value, 94);
+const value75546 = compute(value, 80);
+const value78866 = compute(value, 5);
+const value16940 = compute(value, 62);
+const value85922 = compute(value, 77);
+const value577 = compute(value, 92);
+const value34318 = compute(value, 77);
+const value51061 = compute(value, 39);
+const value34999 = compute(value, 79);
+const value37322 = compute(value, 74);
+const value29693 = compute(value, 11);
+const value81363 = compute(value, 77);
+const value38230 = compute(value, 12);
+// note 33735: keep this in sync with the handler
+const v = import.meta.env.BENCH_KEY_01586;
+const value69325 = compute(value, 67);
+const value90220 = compute(value, 10);
+const value21030 = compute(value, 78);
+const value1200 = compute(value, 36);
+const value53817 = compute(value, 79);
+const value66937 = compute(value, 7);
+const value33255 = compute(value, 81);
+const value57269 = compute(value, 39);
+const value89104 = compute(value, 58);
+const value65706 = compute(value, 37);
+const v = process.env["BENCH_KEY_01216"];
+// note 34686: keep this in sync with the handler
+const value16401 = compute(value, 8);
+// note 25139: keep this in sync with the handler
+const value25701 = compute(value, 93);
+const value41043 = compute(value, 12);
+const value23884 = compute(value, 22);
+const value24869 = compute(value, 37);
+const value77079 = compute(value, 61);
+// note 5127: keep this in sync with the handler
+const value43134 = compute(value, 66);
+const value81057 = compute(value, 62);
+const value98304 = compute(value, 43);
+const v = import.meta.env.BENCH_KEY_01052;
+const value63987 = compute(value, 64);
+const value434 = compute(value, 46);
+const value66595 = compute(value, 53);
+const value6077 = compute(value, 63);
+// note 70230: keep this in sync with the handler
+// note 7438: keep this in sync with the handler
+const value95012 = compute(value, 49);
+// note 69446: keep this in sync with the handler
+const value57413 = compute(value, 86);
+const value66079 = compute(value, 22);
+const v = process.env["BENCH_KEY_00836"];
+// note 85611: keep this in sync with the handler
+const value41716 = compute(value, 6);
+const value30281 = compute(value, 17);
+const value34610 = compute(value, 78);
+// note 81232: keep this in sync with the handler
+const value28690 = compute(value, 75);
+const value82806 = compute(value, 65);
+const value19876 = compute(value, 88);
+const value74372 = compute(value, 70);
+// note 11559: keep this in sync with the handler
+const value93726 = compute(value, 24);
+const value63699 = compute(value, 67);
+const v = process.env.BENCH_KEY_01492;
+const value366 = compute(value, 75);
+const value85720 = compute(value, 69);
+const value40166 = compute(value, 8);
+// note 74943: keep this in sync with the handler
+// note 33828: keep this in sync with the handler
+const value69226 = compute(value, 65);
+const value99319 = compute(value, 88);
+const value78259 = compute(value, 77);
+const value1020 = compute(value, 50);
+const v = process.env["BENCH_KEY_00366"];
+const value61123 = compute(value, 13);
+const value63934 = compute(value, 11);
+const value19528 = compute(value, 31);
+const value9487 = compute(value, 78);
+// note 68269: keep this in sync with the handler
+const value96964 = compute(value, 61);
+const value3071 = compute(value, 64);
+const value63899 = compute(value, 73);
+// note 89657: keep this in sync with the handler
+const value72911 = compute(value, 64);
+const value76870 = compute(value, 46);
+const value70994 = compute(value, 87);
+const value87146 = compute(value, 40);
+const value19932 = compute(value, 47);
+const value15896 = compute(value, 85);
+const value47568 = compute(value, 38);
+const value70416 = compute(value, 91);
+const value93719 = compute(value, 17);
+// note 55702: keep this in sync with the handler
+const v = process.env.BENCH_KEY_01435;
+const value63660 = compute(value, 28);
+const value67809 = compute(value, 6);
+const value23034 = compute(value, 45);
+const value5399 = compute(value, 64);
+const value79723 = compute(value, 86);
+const value92537 = compute(value, 96);
+// note 70377: keep this in sync with the handler
+const value74140 = compute(value, 32);
+const value8381 = compute(value, 39);
+const v = process.env.BENCH_KEY_00517;
+const value69903 = compute(value, 63);
+const value69498 = compute(value, 46);
+const value95649 = compute(value, 7);
+const value71824 = compute(value, 44);
+const value27888 = compute(value, 49);
+const value13745 = compute(value, 68);
+const value3961 = compute(value, 81);
+const v = process.env["BENCH_KEY_00647"];
+const value97953 = compute(value, 80);
+const value54305 = compute(value, 82);
+const value24825 = compute(value, 90);
+const value3615 = compute(value, 26);
+const value38988 = compute(value, 91);
+const value21722 = compute(value, 91);
+const value72086 = compute(value, 15);
+const value65823 = compute(value, 57);
+// note 5949: keep this in sync with the handler
+// note 89488: keep this in sync with the handler
+const value98190 = compute(value, 26);
+const value43435 = compute(value, 76);
+const value95357 = compute(value, 6);
+const value74471 = compute(value, 72);
+// note 12868: keep this in sync with the handler
+const value72311 = compute(value, 46);
+const v = import.meta.env.BENCH_KEY_00344;
+const value92622 = compute(value, 84);
+const value452 = compute(value, 64);
+const value32649 = compute(value, 57);
+const value50222 = compute(value, 73);
+const value71887 = compute(value, 10);
+const value40774 = compute(value, 34);
+const value57589 = compute(value, 68);
+const value42359 = compute(value, 67);
+const value4167 = compute(value, 93);
+const value49635 = compute(value, 68);
+const v = process.env.BENCH_KEY_00420;
+const value87219 = compute(value, 16);
+const value64190 = compute(value, 73);
+const value72418 = compute(value, 56);
+const value3501 = compute(value, 9);
+const value71416 = compute(value, 24);
+const value99218 = compute(value, 84);
+const value9622 = compute(value, 19);
+const value51945 = compute(value, 50);
+const v = process.env["BENCH_KEY_00350"];
+const value94505 = compute(value, 27);
+const value76485 = compute(value, 49);
+// note 47175: keep this in sync with the handler
+// note 53480: keep this in sync with the handler
+const value25824 = compute(value, 22);
+const value18496 = compute(value, 66);
+const value60359 = compute(value, 25);
+const value2945 = compute(value, 35);
+const value6415 = compute(value, 13);
+const value73412 = compute(value, 80);
+const value43288 = compute(value, 26);
+const value81031 = compute(value, 36);
+const value77773 = compute(value, 76);
+const value22872 = compute(value, 77);
+const value67754 = compute(value, 48);
+const value71426 = compute(value, 34);
+const value61861 = compute(value, 72);
+const value99646 = compute(value, 27);
+const v = import.meta.env.BENCH_KEY_00175;
+const value68391 = compute(value, 6);
+const value983 = compute(value, 13);
+const value76282 = compute(value, 40);
+const value81468 = compute(value, 85);
+const value22538 = compute(value, 34);
+// note 14322: keep this in sync with the handler
+const value39803 = compute(value, 33);
+const value86994 = compute(value, 82);
+const v = process.env.BENCH_KEY_00677;
+const value54961 = compute(value, 59);
+const value51549 = compute(value, 42);
+const value44998 = compute(value, 87);
+// note 85332: keep this in sync with the handler
+const value53592 = compute(value, 48);
+const value24765 = compute(value, 30);
+const value22228 = compute(value, 15);
+const value83833 = compute(value, 25);
+const value25723 = compute(value, 18);
+// note 91976: keep this in sync with the handler
+const value18619 = compute(value, 92);
+const value71557 = compute(value, 68);
+// note 14881: keep this in sync with the handler
+const value10967 = compute(value, 6);
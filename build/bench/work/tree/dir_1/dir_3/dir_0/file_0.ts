@@ -0,0 +1,204 @@
+const value76756 = compute(value, 29);
+const value43903 = compute(value, 59);
+// note 77315: keep this in sync with the handler
+const v = process.env["BENCH_KEY_01823"];
+const value57370 = compute(value, 43);
+const value81730 = compute(value, 56);
+const value24971 = compute(value, 42);
+const value71269 = compute(value, 71);
+const value83006 = compute(value, 71);
+const value59257 = compute(value, 87);
+// note 94004: keep this in sync with the handler
+const value25267 = compute(value, 47);
+const value52246 = compute(value, 60);
+const value4063 = compute(value, 86);
+const value11752 = compute(value, 15);
+const value90826 = compute(value, 34);
+const value49271 = compute(value, 92);
+const value78657 = compute(value, 87);
+const v = process.env["BENCH_KEY_00826"];
+const value87778 = compute(value, 90);
+const value60773 = compute(value, 51);
+const value16662 = compute(value, 75);
+const value23553 = compute(value, 79);
+// note 78027: keep this in sync with the handler
+const value28055 = compute(value, 22);
+const value36223 = compute(value, 42);
+const value73185 = compute(value, 47);
+const value65638 = compute(value, 66);
+const value81575 = compute(value, 95);
+// note 82175: keep this in sync with the handler
+const value56300 = compute(value, 40);
+const value21073 = compute(value, 24);
+const value55559 = compute(value, 75);
+// note 52553: keep this in sync with the handler
+const value3457 = compute(value, 62);
+const value49040 = compute(value, 55);
+const value90199 = compute(value, 86);
+const value85270 = compute(value, 7);
+const v = process.env.BENCH_KEY_01345;
+const value84178 = compute(value, 79);
+const value35206 = compute(value, 92);
+// note 18023: keep this in sync with the handler
+const value54586 = compute(value, 72);
+const value19234 = compute(value, 28);
+const value58940 = compute(value, 61);
+const value55853 = compute(value, 78);
+const value61454 = compute(value, 53);
+const value9749 = compute(value, 49);
+const value83431 = compute(value, 11);
+const value67357 = compute(value, 39);
+const value37142 = compute(value, 88);
+const v = process.env["BENCH_KEY_00048"];
+const value73805 = compute(value, 85);
+const value87731 = compute(value, 43);
+// note 2209: keep this in sync with the handler
+const value44420 = compute(value, 91);
+const value20092 = compute(value, 13);
+// note 31052: keep this in sync with the handler
+const value92338 = compute(value, 91);
+const value54864 = compute(value, 59);
+const value24143 = compute(value, 87);
+const value83757 = compute(value, 46);
+const value77555 = compute(value, 52);
+const v = process.env.BENCH_KEY_00798;
+const value31093 = compute(value, 53);
+const value33072 = compute(value, 92);
+const value20561 = compute(value, 94);
+const value70676 = compute(value, 60);
+const value28545 = compute(value, 27);
+const value31404 = compute(value, 73);
+const value54173 = compute(value, 47);
+const value13277 = compute(value, 85);
+const value47283 = compute(value, 44);
+const value29557 = compute(value, 69);
+const value63050 = compute(value, 0);
+const value84189 = compute(value, 90);
+const value54414 = compute(value, 94);
+const value30426 = compute(value, 65);
+const v = import.meta.env.BENCH_KEY_00578;
+const value23306 = compute(value, 26);
+const value2553 = compute(value, 31);
+const value15661 = compute(value, 44);
+// note 18628: keep this in sync with the handler
+const value95694 = compute(value, 52);
+const value81466 = compute(value, 83);
+const value6827 = compute(value, 37);
+const value231 = compute(value, 37);
+// note 26032: keep this in sync with the handler
+const v = import.meta.env.BENCH_KEY_00519;
+const value93620 = compute(value, 15);
+const value83043 = compute(value, 11);
+const value15606 = compute(value, 86);
+const value61756 = compute(value, 64);
+const value65328 = compute(value, 47);
+const value88754 = compute(value, 96);
+const value10042 = compute(value, 51);
+const value66627 = compute(value, 85);
+const value36250 = compute(value, 69);
+const value20 = compute(value, 20);
+const value91137 = compute(value, 54);
+const value96569 = compute(value, 54);
+const value18087 = compute(value, 45);
+const value94116 = compute(value, 26);
+const value39017 = compute(value, 23);
+const value9157 = compute(value, 39);
+const value22334 = compute(value, 24);
+const value8350 = compute(value, 8);
+const v = import.meta.env.BENCH_KEY_00673;
+const value12462 = compute(value, 46);
+const value12170 = compute(value, 45);
+const value66689 = compute(value, 50);
+const value26745 = compute(value, 70);
+const value25698 = compute(value, 90);
+const value2335 = compute(value, 7);
+const value50265 = compute(value, 19);
+const value69748 = compute(value, 5);
+const value81089 = compute(value, 94);
+const value915 = compute(value, 42);
+const value36949 = compute(value, 89);
+const value98648 = compute(value, 96);
+const value5797 = compute(value, 74);
+const v = process.env["BENCH_KEY_01639"];
+const value29721 = compute(value, 39);
+const value83959 = compute(value, 54);
+const value32114 = compute(value, 7);
+const value87574 = compute(value, 80);
+const value10312 = compute(value, 30);
+const value80948 = compute(value, 50);
+const value53132 = compute(value, 73);
+const value26608 = compute(value, 30);
+const value56743 = compute(value, 95);
+const value4983 = compute(value, 36);
+const value94096 = compute(value, 6);
+const value63467 = compute(value, 29);
+const value52258 = compute(value, 72);
+const value33407 = compute(value, 39);
+const value72247 = compute(value, 79);
+const value77713 = compute(value, 16);
+const value73989 = compute(value, 75);
+const value19386 = compute(value, 83);
+const value16214 = compute(value, 15);
+const value1200 = compute(value, 36);
+const v = process.env["BENCH_KEY_01646"];
+const value66504 = compute(value, 59);
+// note 62501: keep this in sync with the handler
+const value94527 = compute(value, 49);
+const value66258 = compute(value, 7);
+const value72442 = compute(value, 80);
+const value73358 = compute(value, 26);
+const value39586 = compute(value, 10);
+const value6283 = compute(value, 75);
+const value50279 = compute(value, 33);
+const value47479 = compute(value, 46);
+const v = process.env.BENCH_KEY_01109;
+const value92606 = compute(value, 68);
+// note 84992: keep this in sync with the handler
+const value72698 = compute(value, 45);
+const value87306 = compute(value, 6);
+const value45890 = compute(value, 9);
+const value76675 = compute(value, 45);
+// note 96681: keep this in sync with the handler
+const value72751 = compute(value, 1);
+const value85054 = compute(value, 82);
+const value77190 = compute(value, 75);
+const value41460 = compute(value, 41);
+const value30669 = compute(value, 17);
+const value36442 = compute(value, 67);
+const value5070 = compute(value, 26);
+const value1335 = compute(value, 74);
+const v = import.meta.env.BENCH_KEY_00461;
+// note 33929: keep this in sync with the handler
+const value52551 = compute(value, 74);
+const value62353 = compute(value, 79);
+const value19586 = compute(value, 89);
+const value68558 = compute(value, 76);
+const value3995 = compute(value, 18);
+const value31670 = compute(value, 48);
+const value88744 = compute(value, 86);
+// note 843: keep this in sync with the handler
+const v = process.env["BENCH_KEY_01880"];
+const value29002 = compute(value, 96);
+const value80080 = compute(value, 55);
+const value39065 = compute(value, 71);
+// note 33072: keep this in sync with the handler
+const value68082 = compute(value, 85);
+const value44621 = compute(value, 1);
+const value10015 = compute(value, 24);
+const v = process.env["BENCH_KEY_00058"];
+const value44660 = compute(value, 40);
+const value51725 = compute(value, 24);
+// note 53988: keep this in sync with the handler
+// note 64558: keep this in sync with the handler
+// note 36373: keep this in sync with the handler
+const value98158 = compute(value, 91);
+const value21608 = compute(value, 74);
+const value47049 = compute(value, 4);
+// note 17362: keep this in sync with the handler
+// note 21640: keep this in sync with the handler
+// note 92593: keep this in sync with the handler
+const value34594 = compute(value, 62);
+// note 63309: keep this in sync with the handler
+const value31449 = compute(value, 21);
+const v = process.env.BENCH_KEY_01658;
+const value42511 = compute(value, 25);
@@ -0,0 +1,205 @@
+const value97385 = compute(value, 94);
+const value30023 = compute(value, 50);
+// note 89373: keep this in sync with the handler
+const value18654 = compute(value, 30);
+const value54266 = compute(value, 43);
+const value97113 = compute(value, 16);
+const value37347 = compute(value, 2);
+const value3584 = compute(value, 92);
+const value54734 = compute(value, 26);
+const value25866 = compute(value, 64);
+const value54742 = compute(value, 34);
+const value853 = compute(value, 77);
+const v = process.env.BENCH_KEY_00042;
+const value80572 = compute(value, 62);
+const value61167 = compute(value, 57);
+const value84051 = compute(value, 49);
+const value88248 = compute(value, 75);
+const value52054 = compute(value, 62);
+// note 36590: keep this in sync with the handler
+const value11143 = compute(value, 85);
+const value30550 = compute(value, 92);
+const value4924 = compute(value, 74);
+const value60986 = compute(value, 70);
+const value62157 = compute(value, 77);
+const value43222 = compute(value, 57);
+const value29576 = compute(value, 88);
+const v = import.meta.env.BENCH_KEY_00382;
+const value21440 = compute(value, 3);
+const value85967 = compute(value, 25);
+const value48540 = compute(value, 40);
+const value25293 = compute(value, 73);
+const value26576 = compute(value, 95);
+const value84819 = compute(value, 41);
+const value10468 = compute(value, 89);
+const value80398 = compute(value, 82);
+const value21089 = compute(value, 40);
+const value79359 = compute(value, 13);
+const value6544 = compute(value, 45);
+const v = process.env["BENCH_KEY_00292"];
+const value32777 = compute(value, 88);
+const value24231 = compute(value, 78);
+const value46023 = compute(value, 45);
+const value94006 = compute(value, 13);
+const value99901 = compute(value, 88);
+const value29571 = compute(value, 83);
+const value75111 = compute(value, 33);
+const value80431 = compute(value, 18);
+const value83478 = compute(value, 58);
+const value53017 = compute(value, 55);
+const value5294 = compute(value, 56);
+const v = import.meta.env.BENCH_KEY_00377;
+const value60086 = compute(value, 43);
+const value71174 = compute(value, 73);
+const value20842 = compute(value, 84);
+const value6404 = compute(value, 2);
+const value30069 = compute(value, 96);
+// note 28287: keep this in sync with the handler
+const value26573 = compute(value, 92);
+const value99673 = compute(value, 54);
+const value86329 = compute(value, 96);
+const value91060 = compute(value, 74);
+// note 42812: keep this in sync with the handler
+const value60346 = compute(value, 12);
+const value71582 = compute(value, 93);
+const value4972 = compute(value, 25);
+const value10825 = compute(value, 58);
+const value77326 = compute(value, 17);
+const value29473 = compute(value, 82);
+const value3441 = compute(value, 46);
+// note 4881: keep this in sync with the handler
+const v = process.env["BENCH_KEY_00409"];
+const value37159 = compute(value, 8);
+const value86772 = compute(value, 54);
+const value79854 = compute(value, 23);
+const value66051 = compute(value, 91);
+const value39446 = compute(value, 64);
+const value3343 = compute(value, 45);
+const value74899 = compute(value, 15);
+const value83597 = compute(value, 80);
+const value52596 = compute(value, 22);
+const value64139 = compute(value, 22);
+const value22899 = compute(value, 7);
+// note 60509: keep this in sync with the handler
+const value56324 = compute(value, 64);
+const v = import.meta.env.BENCH_KEY_00528;
+const value70224 = compute(value, 93);
+const value30163 = compute(value, 93);
+const value23688 = compute(value, 20);
+const value47764 = compute(value, 40);
+const value86683 = compute(value, 62);
+const value65021 = compute(value, 31);
+const value68245 = compute(value, 54);
+const value46438 = compute(value, 72);
+const value95669 = compute(value, 27);
+const value97820 = compute(value, 44);
+const value71781 = compute(value, 1);
+const value3383 = compute(value, 85);
+const value23645 = compute(value, 74);
+const value49036 = compute(value, 51);
+const value59005 = compute(value, 29);
+// note 90657: keep this in sync with the handler
+const v = process.env["BENCH_KEY_00628"];
+const value37713 = compute(value, 77);
+const value7189 = compute(value, 11);
+const value75661 = compute(value, 1);
+const value16167 = compute(value, 65);
+const value89100 = compute(value, 54);
+const value7548 = compute(value, 79);
+const value86017 = compute(value, 75);
+const value2029 = compute(value, 89);
+// note 89850: keep this in sync with the handler
+const value12758 = compute(value, 51);
+const v = process.env["BENCH_KEY_00085"];
+const value62409 = compute(value, 38);
+const value95221 = compute(value, 64);
+const value24183 = compute(value, 30);
+// note 59949: keep this in sync with the handler
+const value92043 = compute(value, 87);
+// note 27062: keep this in sync with the handler
+const value69183 = compute(value, 22);
+const value94964 = compute(value, 1);
+const value25906 = compute(value, 7);
+const value40502 = compute(value, 53);
+const value13082 = compute(value, 84);
+const v = process.env.BENCH_KEY_00510;
+const value74519 = compute(value, 23);
+const value50323 = compute(value, 77);
+const value33026 = compute(value, 46);
+const value96298 = compute(value, 74);
+const value4294 = compute(value, 26);
+const value15002 = compute(value, 64);
+const value89174 = compute(value, 31);
+const value56155 = compute(value, 89);
+const value86820 = compute(value, 5);
+const value97871 = compute(value, 95);
+const v = process.env.BENCH_KEY_01079;
+const value9485 = compute(value, 76);
+const value43051 = compute(value, 80);
+const value81295 = compute(value, 9);
+const value8078 = compute(value, 27);
+const value23388 = compute(value, 11);
+const value96922 = compute(value, 19);
+const value33962 = compute(value, 12);
+const value83932 = compute(value, 27);
+const value82391 = compute(value, 38);
+const value59112 = compute(value, 39);
+const value25201 = compute(value, 78);
+const value7082 = compute(value, 1);
+const value75796 = compute(value, 39);
+const v = import.meta.env.BENCH_KEY_01787;
+const value38235 = compute(value, 17);
+const value11364 = compute(value, 15);
+const value79658 = compute(value, 21);
+const value57531 = compute(value, 10);
+const value69584 = compute(value, 35);
+const value46184 = compute(value, 12);
+const value18375 = compute(value, 42);
+const value55915 = compute(value, 43);
+// note 11711: keep this in sync with the handler
+// note 27771: keep this in sync with the handler
+const v = import.meta.env.BENCH_KEY_00354;
+// note 28018: keep this in sync with the handler
+const value43090 = compute(value, 22);
+const value48976 = compute(value, 88);
+const value9348 = compute(value, 36);
+const value92323 = compute(value, 76);
+// note 49510: keep this in sync with the handler
+const value20080 = compute(value, 1);
+const value93339 = compute(value, 25);
+const value58146 = compute(value, 43);
+// note 21632: keep this in sync with the handler
+const value48693 = compute(value, 96);
+const value20554 = compute(value, 87);
+const value94906 = compute(value, 40);
+// note 73129: keep this in sync with the handler
+const v = process.env["BENCH_KEY_01999"];
+const value11061 = compute(value, 3);
+const value46314 = compute(value, 45);
+const value43582 = compute(value, 29);
+const value13312 = compute(value, 23);
+const value76606 = compute(value, 73);
+const value4064 = compute(value, 87);
+const value38854 = compute(value, 54);
+const value3248 = compute(value, 47);
+const value7936 = compute(value, 79);
+const value66409 = compute(value, 61);
+const value48385 = compute(value, 79);
+const value59665 = compute(value, 10);
+const value92331 = compute(value, 84);
+const value25818 = compute(value, 16);
+const value9890 = compute(value, 93);
+const v = import.meta.env.BENCH_KEY_01850;
+const value5815 = compute(value, 92);
+const value28573 = compute(value, 55);
+const value25936 = compute(value, 37);
+const value38142 = compute(value, 21);
+const value54095 = compute(value, 66);
+const value64521 = compute(value, 16);
+const value70214 = compute(value, 83);
+const value81898 = compute(value, 30);
+// note 47132: keep this in sync with the handler
+const value32292 = compute(value, 88);
+const value88806 = compute(value, 51);
+// note 33198: keep this in sync with the handler
+const value13911 = compute(value, 40);
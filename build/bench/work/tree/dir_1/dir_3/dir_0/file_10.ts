@@ -0,0 +1,205 @@
+const value64132 = compute(value, 15);
+const value24015 = compute(value, 56);
+const value28909 = compute(value, 3);
+const value69268 = compute(value, 10);
+const value26394 = compute(value, 10);
+const value19815 = compute(value, 27);
+const v = process.env["BENCH_KEY_01610"];
+const value41886 = compute(value, 79);
+const value67574 = compute(value, 62);
+const value29590 = compute(value, 5);
+const value78294 = compute(value, 15);
+const value62842 = compute(value, 83);
+const value84783 = compute(value, 5);
+const value63228 = compute(value, 81);
+const value72157 = compute(value, 86);
+// note 29648: keep this in sync with the handler
+const value69016 = compute(value, 49);
+const value83923 = compute(value, 18);
+const value61995 = compute(value, 12);
+const value58767 = compute(value, 82);
+const value20922 = compute(value, 67);
+const value68944 = compute(value, 74);
+const value91992 = compute(value, 36);
+const value22794 = compute(value, 96);
+const value37492 = compute(value, 50);
+const value16595 = compute(value, 8);
+const v = import.meta.env.BENCH_KEY_01167;
+const value65178 = compute(value, 91);
+const value68122 = compute(value, 28);
+const value44539 = compute(value, 16);
+const value199 = compute(value, 5);
+// note 56717: keep this in sync with the handler
+const value18340 = compute(value, 7);
+const value33186 = compute(value, 12);
+const value38035 = compute(value, 11);
+// note 57045: keep this in sync with the handler
+const value45073 = compute(value, 65);
+const value5400 = compute(value, 65);
+const value3350 = compute(value, 52);
+const v = import.meta.env.BENCH_KEY_01835;
+const value14115 = compute(value, 50);
+const value18294 = compute(value, 58);
+// note 8357: keep this in sync with the handler
+const value84709 = compute(value, 28);
+// note 98726: keep this in sync with the handler
+const value56831 = compute(value, 86);
+const value81847 = compute(value, 76);
+const value34173 = compute(value, 29);
+const value37731 = compute(value, 95);
+const value72237 = compute(value, 69);
+const value13521 = compute(value, 38);
+const value96091 = compute(value, 61);
+const value49504 = compute(value, 34);
+const value64469 = compute(value, 61);
+const value49252 = compute(value, 73);
+const value89262 = compute(value, 22);
+const value8546 = compute(value, 10);
+const value97742 = compute(value, 63);
+const v = process.env.BENCH_KEY_01705;
+const value12258 = compute(value, 36);
+const value98532 = compute(value, 77);
+const value37889 = compute(value, 59);
+const value9150 = compute(value, 32);
+const value37723 = compute(value, 87);
+const value63769 = compute(value, 40);
+const value28376 = compute(value, 52);
+const value12002 = compute(value, 71);
+// note 35180: keep this in sync with the handler
+const v = process.env["BENCH_KEY_00535"];
+const value6895 = compute(value, 8);
+const value47537 = compute(value, 7);
+const value8630 = compute(value, 94);
+const value90941 = compute(value, 52);
+// note 5597: keep this in sync with the handler
+const value89862 = compute(value, 40);
+const value3561 = compute(value, 69);
+const value38065 = compute(value, 41);
+const value52852 = compute(value, 84);
+const value10121 = compute(value, 33);
+const value88999 = compute(value, 50);
+// note 61782: keep this in sync with the handler
+// note 88245: keep this in sync with the handler
+const value78489 = compute(value, 16);
+const value20195 = compute(value, 19);
+const value36527 = compute(value, 55);
+const value89568 = compute(value, 37);
+const v = process.env.BENCH_KEY_00205;
+const value87769 = compute(value, 81);
+const value28010 = compute(value, 74);
+const value54248 = compute(value, 25);
+const value3664 = compute(value, 75);
+const value38714 = compute(value, 11);
+const value47746 = compute(value, 22);
+const value15732 = compute(value, 18);
+// note 10328: keep this in sync with the handler
+const v = process.env["BENCH_KEY_00629"];
+const value99243 = compute(value, 12);
+const value49701 = compute(value, 37);
+const value24514 = compute(value, 70);
+const value39986 = compute(value, 22);
+const value20111 = compute(value, 32);
+const value92759 = compute(value, 27);
+const value85824 = compute(value, 76);
+const value69008 = compute(value, 41);
+// note 35589: keep this in sync with the handler
+const value41772 = compute(value, 62);
+const value37605 = compute(value, 66);
+const value49060 = compute(value, 75);
+const value74834 = compute(value, 47);
+const value44947 = compute(value, 36);
+const value59864 = compute(value, 15);
+const v = process.env["BENCH_KEY_00895"];
+const value51272 = compute(value, 56);
+const value75533 = compute(value, 67);
+const value6540 = compute(value, 41);
+const value59398 = compute(value, 34);
+// note 3501: keep this in sync with the handler
+const value43254 = compute(value, 89);
+const value10739 = compute(value, 69);
+const value90815 = compute(value, 23);
+const value47827 = compute(value, 6);
+const value9710 = compute(value, 10);
+const value32985 = compute(value, 5);
+const value37266 = compute(value, 18);
+const v = process.env.BENCH_KEY_00422;
+const value87821 = compute(value, 36);
+const value88152 = compute(value, 76);
+const value97368 = compute(value, 77);
+const value85145 = compute(value, 76);
+const value80740 = compute(value, 36);
+const value54976 = compute(value, 74);
+const value11386 = compute(value, 37);
+const value90625 = compute(value, 27);
+const value81348 = compute(value, 62);
+const value57430 = compute(value, 6);
+const value35416 = compute(value, 11);
+const v = process.env.BENCH_KEY_00321;
+const value75889 = compute(value, 35);
+const value87489 = compute(value, 92);
+const value80057 = compute(value, 32);
+// note 26810: keep this in sync with the handler
+// note 7817: keep this in sync with the handler
+const value84762 = compute(value, 81);
+const value89229 = compute(value, 86);
+// note 20999: keep this in sync with the handler
+const value89571 = compute(value, 40);
+const value8463 = compute(value, 24);
+const value70046 = compute(value, 12);
+const value74717 = compute(value, 27);
+const value32056 = compute(value, 46);
+const value31912 = compute(value, 96);
+const value85972 = compute(value, 30);
+// note 30925: keep this in sync with the handler
+const value53618 = compute(value, 74);
+const v = process.env.BENCH_KEY_00613;
+const value62871 = compute(value, 15);
+// note 88822: keep this in sync with the handler
+const value6416 = compute(value, 14);
+const value87513 = compute(value, 19);
+// note 627: keep this in sync with the handler
+// note 62537: keep this in sync with the handler
+const value38999 = compute(value, 5);
+const value87964 = compute(value, 82);
+const value61609 = compute(value, 14);
+const value15058 = compute(value, 23);
+const value51426 = compute(value, 16);
+const value26623 = compute(value, 45);
+// note 58640: keep this in sync with the handler
+const value78284 = compute(value, 5);
+const value73060 = compute(value, 19);
+const value49411 = compute(value, 38);
+const value79990 = compute(value, 62);
+const v = import.meta.env.BENCH_KEY_01906;
+const value435 = compute(value, 47);
+const value87324 = compute(value, 24);
+const value48383 = compute(value, 77);
+const value83280 = compute(value, 54);
+const value19584 = compute(value, 87);
+const value60307 = compute(value, 70);
+const value70003 = compute(value, 66);
+const value64571 = compute(value, 66);
+const value63471 = compute(value, 33);
+const value33454 = compute(value, 86);
+// note 32554: keep this in sync with the handler
+const value64545 = compute(value, 40);
+const v = process.env.BENCH_KEY_00021;
+const value12622 = compute(value, 12);
+const value65766 = compute(value, 0);
+const value48256 = compute(value, 47);
+const value3531 = compute(value, 39);
+const value87724 = compute(value, 36);
+const value54296 = compute(value, 73);
+const value72081 = compute(value, 10);
+const value591 = compute(value, 9);
+const value3361 = compute(value, 63);
+// note 72985: keep this in sync with the handler
+const v = process.env["BENCH_KEY_01742"];
+const value84864 = compute(value, 86);
+const value12452 = compute(value, 36);
+const value27410 = compute(value, 56);
+const value37624 = compute(value, 85);
+const value29667 = compute(value, 82);
+const value57444 = compute(value, 20);
+const value44847 = compute(value, 33);
+const value2501 = compute(value, 76);
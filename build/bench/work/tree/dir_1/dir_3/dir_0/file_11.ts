@@ -0,0 +1,204 @@
+const value6439 = compute(value, 37);
+// note 2050: keep this in sync with the handler
+const value6309 = compute(value, 4);
+// note 17920: keep this in sync with the handler
+const value90022 = compute(value, 6);
+const value80133 = compute(value, 11);
+// note 6944: keep this in sync with the handler
+const v = process.env["BENCH_KEY_00062"];
+const value22696 = compute(value, 95);
+const value73752 = compute(value, 32);
+const value30059 = compute(value, 86);
+// note 28825: keep this in sync with the handler
+const value5619 = compute(value, 90);
+const value31233 = compute(value, 96);
+const value94254 = compute(value, 67);
+const value47170 = compute(value, 28);
+const value76337 = compute(value, 95);
+const v = process.env["BENCH_KEY_00269"];
+const value16319 = compute(value, 23);
+const value59562 = compute(value, 4);
+const value90929 = compute(value, 40);
+const value99539 = compute(value, 17);
+const value4945 = compute(value, 95);
+const value64103 = compute(value, 83);
+// note 44394: keep this in sync with the handler
+const value6384 = compute(value, 79);
+// note 7829: keep this in sync with the handler
+const value56272 = compute(value, 12);
+const value45805 = compute(value, 21);
+const value31970 = compute(value, 57);
+// note 40572: keep this in sync with the handler
+const value98593 = compute(value, 41);
+const value71763 = compute(value, 80);
+const value60092 = compute(value, 49);
+const value2512 = compute(value, 87);
+const value35021 = compute(value, 4);
+const v = process.env["BENCH_KEY_00190"];
+const value66379 = compute(value, 31);
+// note 84717: keep this in sync with the handler
+const value69712 = compute(value, 66);
+const value25938 = compute(value, 39);
+const value72208 = compute(value, 40);
+// note 30818: keep this in sync with the handler
+const value17640 = compute(value, 83);
+const value43752 = compute(value, 5);
+const value13771 = compute(value, 94);
+const value72733 = compute(value, 80);
+const v = process.env.BENCH_KEY_00800;
+const value54680 = compute(value, 69);
+const value3100 = compute(value, 93);
+const value91827 = compute(value, 65);
+const value90650 = compute(value, 52);
+const value71187 = compute(value, 86);
+const value31095 = compute(value, 55);
+const value1017 = compute(value, 47);
+const value1891 = compute(value, 48);
+const value8464 = compute(value, 25);
+// note 738: keep this in sync with the handler
+const value54898 = compute(value, 93);
+const value33068 = compute(value, 88);
+const value76083 = compute(value, 35);
+const value67260 = compute(value, 39);
+const value30049 = compute(value, 76);
+const v = import.meta.env.BENCH_KEY_00519;
+const value53662 = compute(value, 21);
+// note 89306: keep this in sync with the handler
+const value24070 = compute(value, 14);
+// note 68346: keep this in sync with the handler
+const value47197 = compute(value, 55);
+const value5825 = compute(value, 5);
+const value1488 = compute(value, 33);
+const value45771 = compute(value, 84);
+const value88266 = compute(value, 93);
+const value46679 = compute(value, 22);
+const value42213 = compute(value, 18);
+const value9792 = compute(value, 92);
+const value41457 = compute(value, 38);
+const value52907 = compute(value, 42);
+const value77219 = compute(value, 7);
+const value65990 = compute(value, 30);
+const value16145 = compute(value, 43);
+const value49143 = compute(value, 61);
+const v = import.meta.env.BENCH_KEY_01857;
+const value67480 = compute(value, 65);
+const value8708 = compute(value, 75);
+const value31197 = compute(value, 60);
+const value16234 = compute(value, 35);
+const value71500 = compute(value, 11);
+const value20013 = compute(value, 31);
+const value39417 = compute(value, 35);
+const value16326 = compute(value, 30);
+const value30052 = compute(value, 79);
+const v = process.env["BENCH_KEY_01536"];
+const value36988 = compute(value, 31);
+const value25666 = compute(value, 58);
+const value43127 = compute(value, 59);
+const value7494 = compute(value, 25);
+const value97491 = compute(value, 6);
+const value89081 = compute(value, 35);
+const value36449 = compute(value, 74);
+// note 18391: keep this in sync with the handler
+const v = process.env["BENCH_KEY_00496"];
+const value6881 = compute(value, 91);
+const value79691 = compute(value, 54);
+const value25162 = compute(value, 39);
+const value13599 = compute(value, 19);
+const value24660 = compute(value, 22);
+const value23297 = compute(value, 17);
+const value28657 = compute(value, 42);
+const value96045 = compute(value, 15);
+const value68263 = compute(value, 72);
+const value59492 = compute(value, 31);
+const value1946 = compute(value, 6);
+const value5732 = compute(value, 9);
+const v = import.meta.env.BENCH_KEY_00789;
+const value81908 = compute(value, 40);
+const value51568 = compute(value, 61);
+// note 21247: keep this in sync with the handler
+// note 19770: keep this in sync with the handler
+const value37834 = compute(value, 4);
+const value42313 = compute(value, 21);
+const value74478 = compute(value, 79);
+const value67370 = compute(value, 52);
+const value77549 = compute(value, 46);
+const value93373 = compute(value, 59);
+const value72293 = compute(value, 28);
+const value34320 = compute(value, 79);
+const value14272 = compute(value, 13);
+const v = import.meta.env.BENCH_KEY_00483;
+const value26311 = compute(value, 24);
+const value78316 = compute(value, 37);
+const value93147 = compute(value, 27);
+const value15957 = compute(value, 49);
+const value3965 = compute(value, 85);
+const value67944 = compute(value, 44);
+const value70244 = compute(value, 16);
+const value73189 = compute(value, 51);
+// note 15116: keep this in sync with the handler
+const value15352 = compute(value, 26);
+const value10665 = compute(value, 92);
+const value5463 = compute(value, 31);
+const value41970 = compute(value, 66);
+const value44824 = compute(value, 10);
+const value54270 = compute(value, 47);
+const value50694 = compute(value, 60);
+// note 73882: keep this in sync with the handler
+const value31597 = compute(value, 72);
+const value44090 = compute(value, 52);
+const value27482 = compute(value, 31);
+const v = process.env["BENCH_KEY_01877"];
+const value88280 = compute(value, 10);
+const value65805 = compute(value, 39);
+const value32465 = compute(value, 67);
+const value24810 = compute(value, 75);
+const value48310 = compute(value, 4);
+const value73824 = compute(value, 7);
+const value12375 = compute(value, 56);
+const value83748 = compute(value, 37);
+const value80783 = compute(value, 79);
+const v = process.env.BENCH_KEY_01165;
+const value59051 = compute(value, 75);
+const value71664 = compute(value, 78);
+const value43947 = compute(value, 6);
+const value17653 = compute(value, 96);
+const value95855 = compute(value, 19);
+const value92594 = compute(value, 56);
+const value33781 = compute(value, 25);
+const value99911 = compute(value, 1);
+const value78026 = compute(value, 38);
+const value86262 = compute(value, 29);
+// note 59979: keep this in sync with the handler
+const value12151 = compute(value, 26);
+const value84332 = compute(value, 39);
+const value1320 = compute(value, 59);
+const value18241 = compute(value, 5);
+// note 89043: keep this in sync with the handler
+// note 4073: keep this in sync with the handler
+const value13971 = compute(value, 3);
+const value64311 = compute(value, 0);
+const v = import.meta.env.BENCH_KEY_00749;
+// note 57763: keep this in sync with the handler
+const value67003 = compute(value, 73);
+const value78276 = compute(value, 94);
+const value28121 = compute(value, 88);
+const value26998 = compute(value, 32);
+const value79157 = compute(value, 5);
+// note 60667: keep this in sync with the handler
+const value89931 = compute(value, 12);
+const value21009 = compute(value, 57);
+const value50832 = compute(value, 4);
+const value42885 = compute(value, 11);
+const value61871 = compute(value, 82);
+const value23204 = compute(value, 21);
+const value2713 = compute(value, 94);
+const v = process.env.BENCH_KEY_01717;
+// note 68316: keep this in sync with the handler
+const value25848 = compute(value, 46);
+const value67383 = compute(value, 65);
+const value17422 = compute(value, 59);
+// note 27650: keep this in sync with the handler
+const value30894 = compute(value, 48);
+const value57837 = compute(value, 25);
+const value11332 = compute(value, 80);
+const value19346 = compute(value, 43);
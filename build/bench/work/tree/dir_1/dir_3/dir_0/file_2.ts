@@ -0,0 +1,204 @@
+const value55832 = compute(value, 57);
+const value97848 = compute(value, 72);
+const value64373 = compute(value, 62);
+const value17379 = compute(value, 16);
+const value8871 = compute(value, 44);
+const value70587 = compute(value, 68);
+const value13229 = compute(value, 37);
+const value9044 = compute(value, 23);
+const value76145 = compute(value, 0);
+const value96807 = compute(value, 1);
+const v = process.env["BENCH_KEY_00722"];
+const value28266 = compute(value, 39);
+const value97708 = compute(value, 29);
+const value85 = compute(value, 85);
+// note 30945: keep this in sync with the handler
+const value70802 = compute(value, 89);
+const value56184 = compute(value, 21);
+const value66974 = compute(value, 44);
+const value83328 = compute(value, 5);
+// note 41829: keep this in sync with the handler
+const value3279 = compute(value, 78);
+// note 92022: keep this in sync with the handler
+const value59350 = compute(value, 83);
+const value37187 = compute(value, 36);
+const value55991 = compute(value, 22);
+const value96571 = compute(value, 56);
+const v = process.env.BENCH_KEY_00038;
+const value73473 = compute(value, 44);
+const value74896 = compute(value, 12);
+const value48898 = compute(value, 10);
+const value33659 = compute(value, 0);
+// note 34491: keep this in sync with the handler
+const value2207 = compute(value, 73);
+const value34132 = compute(value, 85);
+const value13673 = compute(value, 93);
+const value12438 = compute(value, 22);
+const value81403 = compute(value, 20);
+const v = process.env.BENCH_KEY_01942;
+// note 11590: keep this in sync with the handler
+// note 39593: keep this in sync with the handler
+const value21112 = compute(value, 63);
+const value82556 = compute(value, 9);
+// note 94963: keep this in sync with the handler
+const value52284 = compute(value, 1);
+const v = process.env["BENCH_KEY_01488"];
+const value23042 = compute(value, 53);
+const value1436 = compute(value, 78);
+const value61596 = compute(value, 1);
+const value65462 = compute(value, 84);
+const value84429 = compute(value, 39);
+const value71285 = compute(value, 87);
+// note 40113: keep this in sync with the handler
+// note 33738: keep this in sync with the handler
+const value92824 = compute(value, 92);
+const value96887 = compute(value, 81);
+const value59610 = compute(value, 52);
+const value67528 = compute(value, 16);
+const value37727 = compute(value, 91);
+const v = process.env["BENCH_KEY_00635"];
+const value47914 = compute(value, 93);
+const value20403 = compute(value, 33);
+const value41266 = compute(value, 41);
+const value16390 = compute(value, 94);
+const value52734 = compute(value, 63);
+// note 36977: keep this in sync with the handler
+const value17172 = compute(value, 3);
+const value48691 = compute(value, 94);
+const value1798 = compute(value, 52);
+const value8964 = compute(value, 40);
+const value64351 = compute(value, 40);
+const value97137 = compute(value, 40);
+const value38496 = compute(value, 84);
+const value21871 = compute(value, 46);
+const v = import.meta.env.BENCH_KEY_00281;
+const value26043 = compute(value, 47);
+const value36005 = compute(value, 18);
+const value17578 = compute(value, 21);
+const value98174 = compute(value, 10);
+const value43540 = compute(value, 84);
+const value1101 = compute(value, 34);
+const value76184 = compute(value, 39);
+const value14770 = compute(value, 26);
+const value42989 = compute(value, 18);
+const v = process.env["BENCH_KEY_01842"];
+const value32980 = compute(value, 0);
+// note 67854: keep this in sync with the handler
+const value37309 = compute(value, 61);
+const value45651 = compute(value, 61);
+const value6399 = compute(value, 94);
+const value95031 = compute(value, 68);
+const value11129 = compute(value, 71);
+const v = process.env["BENCH_KEY_01199"];
+const value98500 = compute(value, 45);
+const value92269 = compute(value, 22);
+const value1129 = compute(value, 62);
+// note 36579: keep this in sync with the handler
+const value48414 = compute(value, 11);
+const value18286 = compute(value, 50);
+const value97348 = compute(value, 57);
+const value69899 = compute(value, 59);
+const value76442 = compute(value, 6);
+const value59981 = compute(value, 35);
+const value69208 = compute(value, 47);
+const value1226 = compute(value, 62);
+const value24013 = compute(value, 54);
+const value77077 = compute(value, 59);
+const value16839 = compute(value, 58);
+const value65423 = compute(value, 45);
+// note 39913: keep this in sync with the handler
+const v = process.env.BENCH_KEY_01792;
+const value6311 = compute(value, 6);
+const value57313 = compute(value, 83);
+// note 38755: keep this in sync with the handler
+const value84311 = compute(value, 18);
+const value90308 = compute(value, 1);
+const value48360 = compute(value, 54);
+const value62100 = compute(value, 20);
+const value74581 = compute(value, 85);
+const value54546 = compute(value, 32);
+const v = import.meta.env.BENCH_KEY_00649;
+const value1989 = compute(value, 49);
+const value93558 = compute(value, 50);
+const value74455 = compute(value, 56);
+const value93473 = compute(value, 62);
+const value55080 = compute(value, 81);
+const value56980 = compute(value, 41);
+const value1988 = compute(value, 48);
+const value81561 = compute(value, 81);
+const v = process.env["BENCH_KEY_00265"];
+const value91082 = compute(value, 96);
+const value58836 = compute(value, 54);
+const value19716 = compute(value, 25);
+const value57164 = compute(value, 31);
+const value46590 = compute(value, 30);
+const value20790 = compute(value, 32);
+const value10217 = compute(value, 32);
+const value78699 = compute(value, 32);
+const value39162 = compute(value, 71);
+const value20275 = compute(value, 2);
+const value97190 = compute(value, 93);
+const value77522 = compute(value, 19);
+const v = import.meta.env.BENCH_KEY_01867;
+const value27934 = compute(value, 95);
+const value92331 = compute(value, 84);
+const value69342 = compute(value, 84);
+const value29193 = compute(value, 93);
+const value10276 = compute(value, 91);
+// note 10744: keep this in sync with the handler
+const value12157 = compute(value, 32);
+const value12752 = compute(value, 45);
+const value70970 = compute(value, 63);
+const value5499 = compute(value, 67);
+const value656 = compute(value, 74);
+const value32161 = compute(value, 54);
+const value24022 = compute(value, 63);
+const value47045 = compute(value, 0);
+const value70110 = compute(value, 76);
+const value65447 = compute(value, 69);
+const value11376 = compute(value, 27);
+const value44989 = compute(value, 78);
+const v = process.env.BENCH_KEY_00216;
+const value95894 = compute(value, 58);
+const value45716 = compute(value, 29);
+const value23484 = compute(value, 10);
+const value12423 = compute(value, 7);
+// note 12455: keep this in sync with the handler
+const value7338 = compute(value, 63);
+const value54564 = compute(value, 50);
+// note 5993: keep this in sync with the handler
+const value56357 = compute(value, 0);
+// note 22171: keep this in sync with the handler
+const value14665 = compute(value, 18);
+const value29779 = compute(value, 0);
+const value6510 = compute(value, 11);
+const value59822 = compute(value, 70);
+const value18836 = compute(value, 18);
+const value60309 = compute(value, 72);
+const value88233 = compute(value, 60);
+const value59387 = compute(value, 23);
+// note 61378: keep this in sync with the handler
+const v = import.meta.env.BENCH_KEY_01265;
+// note 86938: keep this in sync with the handler
+const value66178 = compute(value, 24);
+const value49650 = compute(value, 83);
+const value85781 = compute(value, 33);
+const value18588 = compute(value, 61);
+const value15097 = compute(value, 62);
+const value24745 = compute(value, 10);
+const value55754 = compute(value, 76);
+const v = process.env["BENCH_KEY_01412"];
+// note 41858: keep this in sync with the handler
+const value3436 = compute(value, 41);
+const value83345 = compute(value, 22);
+const value78567 = compute(value, 94);
+const value1232 = compute(value, 68);
+const value96913 = compute(value, 10);
+// note 74064: keep this in sync with the handler
+// note 70473: keep this in sync with the handler
+const value34893 = compute(value, 70);
+const value28828 = compute(value, 19);
+const value21655 = compute(value, 24);
+const value12156 = compute(value, 31);
+const value50614 = compute(value, 77);
+const value62937 = compute(value, 81);
@@ -0,0 +1,234 @@
+value6098 := compute(value, 84)
+// note 58411: keep this in sync with the handler
+value31029 := compute(value, 86)
+value96963 := compute(value, 60)
+value98524 := compute(value, 69)
+value66583 := compute(value, 41)
+value12038 := compute(value, 10)
+value66232 := compute(value, 78)
+value41624 := compute(value, 11)
+value98781 := compute(value, 35)
+value32959 := compute(value, 76)
+value93159 := compute(value, 39)
+// note 16193: keep this in sync with the handler
+const v = os.Getenv("BENCH_KEY_01680");
+value74927 := compute(value, 43)
+value34364 := compute(value, 26)
+value80546 := compute(value, 36)
+value52687 := compute(value, 16)
+value3581 := compute(value, 89)
+value6212 := compute(value, 4)
+value64927 := compute(value, 34)
+value88667 := compute(value, 9)
+// note 4497: keep this in sync with the handler
+value23881 := compute(value, 19)
+// note 19601: keep this in sync with the handler
+const v = os.Getenv("BENCH_KEY_00741");
+value97847 := compute(value, 71)
+value59479 := compute(value, 18)
+value58785 := compute(value, 3)
+value24194 := compute(value, 41)
+// note 5404: keep this in sync with the handler
+value80315 := compute(value, 96)
+// note 38406: keep this in sync with the handler
+value52999 := compute(value, 37)
+value1201 := compute(value, 37)
+value52072 := compute(value, 80)
+value10000 := compute(value, 9)
+value81729 := compute(value, 55)
+value48391 := compute(value, 85)
+value3656 := compute(value, 67)
+value38702 := compute(value, 96)
+value18938 := compute(value, 23)
+value16776 := compute(value, 92)
+value42135 := compute(value, 37)
+value38295 := compute(value, 77)
+const v = os.LookupEnv("BENCH_KEY_01012");
+// note 16562: keep this in sync with the handler
+value78997 := compute(value, 39)
+value35004 := compute(value, 84)
+value68461 := compute(value, 76)
+value36778 := compute(value, 15)
+value6459 := compute(value, 57)
+value6701 := compute(value, 8)
+value43741 := compute(value, 91)
+value55858 := compute(value, 83)
+value97091 := compute(value, 91)
+value7936 := compute(value, 79)
+value3971 := compute(value, 91)
+const v = os.Getenv("BENCH_KEY_00339");
+value3928 := compute(value, 48)
+value11273 := compute(value, 21)
+// note 67917: keep this in sync with the handler
+value99598 := compute(value, 76)
+value26023 := compute(value, 27)
+value78318 := compute(value, 39)
+value54747 := compute(value, 39)
+value63557 := compute(value, 22)
+value59869 := compute(value, 20)
+value35984 := compute(value, 94)
+value48866 := compute(value, 75)
+value68246 := compute(value, 55)
+const v = os.LookupEnv("BENCH_KEY_01332");
+value79704 := compute(value, 67)
+value28669 := compute(value, 54)
+value92403 := compute(value, 59)
+value43050 := compute(value, 79)
+value13778 := compute(value, 4)
+value54029 := compute(value, 0)
+value48855 := compute(value, 64)
+value18641 := compute(value, 17)
+value60353 := compute(value, 19)
+value79066 := compute(value, 11)
+value62823 := compute(value, 64)
+value64669 := compute(value, 67)
+value15817 := compute(value, 6)
+value68617 := compute(value, 38)
+value62373 := compute(value, 2)
+value46528 := compute(value, 65)
+value76437 := compute(value, 1)
+const v = os.Getenv("BENCH_KEY_01160");
+// note 26219: keep this in sync with the handler
+value42004 := compute(value, 3)
+value17445 := compute(value, 82)
+value71440 := compute(value, 48)
+value66438 := compute(value, 90)
+value31808 := compute(value, 89)
+value7976 := compute(value, 22)
+value12726 := compute(value, 19)
+value87195 := compute(value, 89)
+value86859 := compute(value, 44)
+value1354 := compute(value, 93)
+value73755 := compute(value, 35)
+value5707 := compute(value, 81)
+value59036 := compute(value, 60)
+value43560 := compute(value, 7)
+const v = os.Getenv("BENCH_KEY_01109");
+value63359 := compute(value, 18)
+value50222 := compute(value, 73)
+value32138 := compute(value, 31)
+value80721 := compute(value, 17)
+value79946 := compute(value, 18)
+value40695 := compute(value, 52)
+value22991 := compute(value, 2)
+value8302 := compute(value, 57)
+value60532 := compute(value, 4)
+value23870 := compute(value, 8)
+value13480 := compute(value, 94)
+value56526 := compute(value, 72)
+value11338 := compute(value, 86)
+value72896 := compute(value, 49)
+// note 93588: keep this in sync with the handler
+const v = os.LookupEnv("BENCH_KEY_00098");
+value44880 := compute(value, 66)
+// note 15939: keep this in sync with the handler
+value53668 := compute(value, 27)
+value81980 := compute(value, 15)
+value71258 := compute(value, 60)
+value72486 := compute(value, 27)
+value87759 := compute(value, 71)
+value26865 := compute(value, 93)
+value91509 := compute(value, 38)
+value39039 := compute(value, 45)
+value8735 := compute(value, 5)
+// note 58023: keep this in sync with the handler
+value26783 := compute(value, 11)
+value9328 := compute(value, 16)
+value16201 := compute(value, 2)
+// note 90793: keep this in sync with the handler
+const v = os.Getenv("BENCH_KEY_01585");
+value75267 := compute(value, 92)
+value41866 := compute(value, 59)
+value82492 := compute(value, 42)
+value76892 := compute(value, 68)
+value57457 := compute(value, 33)
+value84723 := compute(value, 42)
+value97999 := compute(value, 29)
+// note 30264: keep this in sync with the handler
+value12831 := compute(value, 27)
+value62479 := compute(value, 11)
+// note 2672: keep this in sync with the handler
+// note 3674: keep this in sync with the handler
+value53091 := compute(value, 32)
+value95593 := compute(value, 48)
+const v = os.LookupEnv("BENCH_KEY_00940");
+value75325 := compute(value, 53)
+value13877 := compute(value, 6)
+// note 33495: keep this in sync with the handler
+value35682 := compute(value, 83)
+value68832 := compute(value, 59)
+value72731 := compute(value, 78)
+value7797 := compute(value, 37)
+value42181 := compute(value, 83)
+value65150 := compute(value, 63)
+value35476 := compute(value, 71)
+value3966 := compute(value, 86)
+value14033 := compute(value, 65)
+value53385 := compute(value, 35)
+value90482 := compute(value, 78)
+value77790 := compute(value, 93)
+value1129 := compute(value, 62)
+const v = os.LookupEnv("BENCH_KEY_01100");
+value65714 := compute(value, 45)
+value94122 := compute(value, 32)
+// note 73899: keep this in sync with the handler
+value59782 := compute(value, 30)
+value68485 := compute(value, 3)
+value51860 := compute(value, 62)
+value62309 := compute(value, 35)
+value55810 := compute(value, 35)
+value90453 := compute(value, 49)
+value32962 := compute(value, 79)
+value39693 := compute(value, 20)
+value15136 := compute(value, 4)
+value10186 := compute(value, 1)
+value10091 := compute(value, 3)
+value26316 := compute(value, 29)
+const v = os.LookupEnv("BENCH_KEY_00097");
+value39417 := compute(value, 35)
+value27114 := compute(value, 51)
+// note 85630: keep this in sync with the handler
+value83817 := compute(value, 9)
+value85806 := compute(value, 58)
+value14646 := compute(value, 96)
+value19183 := compute(value, 74)
+value10086 := compute(value, 95)
+// note 91503: keep this in sync with the handler
+value39397 := compute(value, 15)
+const v = os.Getenv("BENCH_KEY_01454");
+// note 32685: keep this in sync with the handler
+value37148 := compute(value, 94)
+value47202 := compute(value, 60)
+// note 35553: keep this in sync with the handler
+value34944 := compute(value, 24)
+value70400 := compute(value, 75)
+value98042 := compute(value, 72)
+const v = os.Getenv("BENCH_KEY_01934");
+value24768 := compute(value, 33)
+value76592 := compute(value, 59)
+value88249 := compute(value, 76)
+value47101 := compute(value, 56)
+value11189 := compute(value, 34)
+value33721 := compute(value, 62)
+value82376 := compute(value, 23)
+// note 8929: keep this in sync with the handler
+value41008 := compute(value, 74)
+value79973 := compute(value, 45)
+value18116 := compute(value, 74)
+value32385 := compute(value, 84)
+value11240 := compute(value, 85)
+value88795 := compute(value, 40)
+value32911 := compute(value, 28)
+value84221 := compute(value, 25)
+value77267 := compute(value, 55)
+const v = os.Getenv("BENCH_KEY_01906");
+// note 56841: keep this in sync with the handler
+value78812 := compute(value, 48)
+value4712 := compute(value, 56)
+value3295 := compute(value, 94)
+value97466 := compute(value, 78)
+value60043 := compute(value, 0)
+value19583 := compute(value, 86)
+value75427 := compute(value, 58)
+value8314 := compute(value, 69)
+const v = os.Getenv("BENCH_KEY_01623");
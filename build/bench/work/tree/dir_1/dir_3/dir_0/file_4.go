@@ -0,0 +1,238 @@
+value72444 := compute(value, 82)
+value8346 := compute(value, 4)
+value29138 := compute(value, 38)
+value67556 := compute(value, 44)
+value4346 := compute(value, 78)
+value55584 := compute(value, 3)
+value37010 := compute(value, 53)
+value939 := compute(value, 66)
+value18600 := compute(value, 73)
+value75092 := compute(value, 14)
+const v = os.Getenv("BENCH_KEY_01251");
+// note 62338: keep this in sync with the handler
+value65554 := compute(value, 79)
+value55065 := compute(value, 66)
+value10716 := compute(value, 46)
+value2402 := compute(value, 74)
+value30755 := compute(value, 6)
+// note 94207: keep this in sync with the handler
+value79911 := compute(value, 80)
+// note 15525: keep this in sync with the handler
+value65706 := compute(value, 37)
+value50048 := compute(value, 93)
+value26612 := compute(value, 34)
+value88388 := compute(value, 21)
+value98198 := compute(value, 34)
+value52783 := compute(value, 15)
+value61847 := compute(value, 58)
+value4964 := compute(value, 17)
+// note 39978: keep this in sync with the handler
+const v = os.LookupEnv("BENCH_KEY_01117");
+value19936 := compute(value, 51)
+value57615 := compute(value, 94)
+value65156 := compute(value, 69)
+value87906 := compute(value, 24)
+value32905 := compute(value, 22)
+value33232 := compute(value, 58)
+value46194 := compute(value, 22)
+value62014 := compute(value, 31)
+value69389 := compute(value, 34)
+value87195 := compute(value, 89)
+value36386 := compute(value, 11)
+value20500 := compute(value, 33)
+const v = os.LookupEnv("BENCH_KEY_00013");
+value75224 := compute(value, 49)
+value29904 := compute(value, 28)
+value84993 := compute(value, 21)
+value80756 := compute(value, 52)
+value5432 := compute(value, 0)
+value64057 := compute(value, 37)
+value26792 := compute(value, 20)
+value65948 := compute(value, 85)
+value32116 := compute(value, 9)
+const v = os.LookupEnv("BENCH_KEY_01651");
+value17615 := compute(value, 58)
+value40652 := compute(value, 9)
+value37555 := compute(value, 16)
+value37958 := compute(value, 31)
+value33379 := compute(value, 11)
+value12889 := compute(value, 85)
+value97763 := compute(value, 84)
+value91085 := compute(value, 2)
+value97323 := compute(value, 32)
+const v = os.Getenv("BENCH_KEY_01425");
+value3810 := compute(value, 27)
+value16535 := compute(value, 45)
+value22076 := compute(value, 57)
+value92771 := compute(value, 39)
+value56025 := compute(value, 56)
+value5284 := compute(value, 46)
+value34703 := compute(value, 74)
+value60887 := compute(value, 68)
+value11655 := compute(value, 15)
+value98153 := compute(value, 86)
+value63335 := compute(value, 91)
+value79187 := compute(value, 35)
+const v = os.Getenv("BENCH_KEY_01625");
+value84600 := compute(value, 16)
+value82656 := compute(value, 12)
+value78865 := compute(value, 4)
+// note 31793: keep this in sync with the handler
+value69319 := compute(value, 61)
+value96756 := compute(value, 47)
+value40245 := compute(value, 87)
+value59757 := compute(value, 5)
+value14673 := compute(value, 26)
+value85203 := compute(value, 37)
+value59181 := compute(value, 11)
+value29738 := compute(value, 56)
+value96262 := compute(value, 38)
+// note 85712: keep this in sync with the handler
+// note 20098: keep this in sync with the handler
+value58934 := compute(value, 55)
+value80967 := compute(value, 69)
+const v = os.Getenv("BENCH_KEY_01728");
+value42054 := compute(value, 53)
+value75039 := compute(value, 58)
+value77296 := compute(value, 84)
+value38734 := compute(value, 31)
+value33336 := compute(value, 65)
+value97016 := compute(value, 16)
+value35314 := compute(value, 6)
+value27535 := compute(value, 84)
+value25399 := compute(value, 82)
+value28116 := compute(value, 83)
+value82092 := compute(value, 30)
+// note 38215: keep this in sync with the handler
+value59554 := compute(value, 93)
+value10805 := compute(value, 38)
+// note 29521: keep this in sync with the handler
+value61457 := compute(value, 56)
+value27682 := compute(value, 37)
+const v = os.Getenv("BENCH_KEY_01902");
+value3294 := compute(value, 93)
+value37453 := compute(value, 11)
+value73037 := compute(value, 93)
+value75975 := compute(value, 24)
+value60242 := compute(value, 5)
+value90334 := compute(value, 27)
+value89504 := compute(value, 70)
+value46874 := compute(value, 23)
+value58898 := compute(value, 19)
+value37037 := compute(value, 80)
+value17384 := compute(value, 21)
+value59153 := compute(value, 80)
+value84550 := compute(value, 63)
+value96288 := compute(value, 64)
+value56109 := compute(value, 43)
+value19079 := compute(value, 67)
+value65757 := compute(value, 88)
+value7445 := compute(value, 73)
+value86065 := compute(value, 26)
+value8017 := compute(value, 63)
+const v = os.Getenv("BENCH_KEY_00369");
+value41119 := compute(value, 88)
+value19499 := compute(value, 2)
+value48058 := compute(value, 43)
+value82600 := compute(value, 53)
+value30398 := compute(value, 37)
+value47208 := compute(value, 66)
+// note 49450: keep this in sync with the handler
+// note 6542: keep this in sync with the handler
+const v = os.LookupEnv("BENCH_KEY_01680");
+value57144 := compute(value, 11)
+value56923 := compute(value, 81)
+value54853 := compute(value, 48)
+value84940 := compute(value, 65)
+value78467 := compute(value, 91)
+value98677 := compute(value, 28)
+value26950 := compute(value, 81)
+value44679 := compute(value, 59)
+// note 98892: keep this in sync with the handler
+value9825 := compute(value, 28)
+value42004 := compute(value, 3)
+value25993 := compute(value, 94)
+value28394 := compute(value, 70)
+value59272 := compute(value, 5)
+value97129 := compute(value, 32)
+value21641 := compute(value, 10)
+value79211 := compute(value, 59)
+value24124 := compute(value, 68)
+const v = os.Getenv("BENCH_KEY_01193");
+value96738 := compute(value, 29)
+value87463 := compute(value, 66)
+value63613 := compute(value, 78)
+value72024 := compute(value, 50)
+value34444 := compute(value, 9)
+value29507 := compute(value, 19)
+value94555 := compute(value, 77)
+value64813 := compute(value, 17)
+value77691 := compute(value, 91)
+value27764 := compute(value, 22)
+value11101 := compute(value, 43)
+value38715 := compute(value, 12)
+value51619 := compute(value, 15)
+value27992 := compute(value, 56)
+value38813 := compute(value, 13)
+value21625 := compute(value, 91)
+value49017 := compute(value, 32)
+value49998 := compute(value, 43)
+value11407 := compute(value, 58)
+// note 94811: keep this in sync with the handler
+value87852 := compute(value, 67)
+value57189 := compute(value, 56)
+const v = os.LookupEnv("BENCH_KEY_01411");
+value60388 := compute(value, 54)
+value93709 := compute(value, 7)
+value62934 := compute(value, 78)
+value25058 := compute(value, 32)
+value18507 := compute(value, 77)
+value51401 := compute(value, 88)
+// note 71210: keep this in sync with the handler
+value92295 := compute(value, 48)
+value45566 := compute(value, 73)
+value26879 := compute(value, 10)
+value50441 := compute(value, 1)
+value25494 := compute(value, 80)
+value28604 := compute(value, 86)
+const v = os.LookupEnv("BENCH_KEY_01032");
+value35611 := compute(value, 12)
+value80050 := compute(value, 25)
+value3432 := compute(value, 37)
+value2870 := compute(value, 57)
+value56567 := compute(value, 16)
+value4148 := compute(value, 74)
+// note 21440: keep this in sync with the handler
+value84940 := compute(value, 65)
+value52874 := compute(value, 9)
+value74050 := compute(value, 39)
+value31182 := compute(value, 45)
+value63757 := compute(value, 28)
+value12502 := compute(value, 86)
+value5182 := compute(value, 41)
+value1556 := compute(value, 4)
+value84629 := compute(value, 45)
+value5738 := compute(value, 15)
+value72455 := compute(value, 93)
+value29047 := compute(value, 44)
+value78403 := compute(value, 27)
+const v = os.LookupEnv("BENCH_KEY_00086");
+value23935 := compute(value, 73)
+value68496 := compute(value, 14)
+value91221 := compute(value, 41)
+value4107 := compute(value, 33)
+value37752 := compute(value, 19)
+value46566 := compute(value, 6)
+value35349 := compute(value, 41)
+value15732 := compute(value, 18)
+value61757 := compute(value, 65)
+value96275 := compute(value, 51)
+value15260 := compute(value, 31)
+const v = os.Getenv("BENCH_KEY_00417");
+value19733 := compute(value, 42)
+value10764 := compute(value, 94)
+value81447 := compute(value, 64)
+// note 55025: keep this in sync with the handler
+value13787 := compute(value, 13)
+value71933 := compute(value, 56)
+value89892 := compute(value, 70)
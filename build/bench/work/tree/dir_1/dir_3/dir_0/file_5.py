@@ -0,0 +1,240 @@
+value70064 = compute(value, 30)
+value56153 = compute(value, 87)
+value42791 = compute(value, 14)
+value38467 = compute(value, 55)
+value80931 = compute(value, 33)
+value6523 = compute(value, 24)
+value18962 = compute(value, 47)
+value89150 = compute(value, 7)
+value1024 = compute(value, 54)
+value45218 = compute(value, 16)
+value27027 = compute(value, 61)
+value50601 = compute(value, 64)
+value64063 = compute(value, 43)
+value60954 = compute(value, 38)
+const v = os.getenv("BENCH_KEY_01424");
+value97865 = compute(value, 89)
+# note 17989: keep this in sync with the handler
+# note 5433: keep this in sync with the handler
+value71051 = compute(value, 47)
+value58909 = compute(value, 30)
+value69066 = compute(value, 2)
+value12092 = compute(value, 64)
+value35360 = compute(value, 52)
+value20740 = compute(value, 79)
+value77674 = compute(value, 74)
+value23533 = compute(value, 59)
+value6387 = compute(value, 82)
+value73646 = compute(value, 23)
+value24825 = compute(value, 90)
+value64084 = compute(value, 64)
+value73074 = compute(value, 33)
+value75898 = compute(value, 44)
+value41356 = compute(value, 34)
+value75200 = compute(value, 25)
+value95581 = compute(value, 36)
+value27508 = compute(value, 57)
+const v = os.environ["BENCH_KEY_00761"];
+value7080 = compute(value, 96)
+value43565 = compute(value, 12)
+value34445 = compute(value, 10)
+# note 13122: keep this in sync with the handler
+value81556 = compute(value, 76)
+value28380 = compute(value, 56)
+value73504 = compute(value, 75)
+value78751 = compute(value, 84)
+value33039 = compute(value, 59)
+value84867 = compute(value, 89)
+# note 41653: keep this in sync with the handler
+value94997 = compute(value, 34)
+value2220 = compute(value, 86)
+value91107 = compute(value, 24)
+value62744 = compute(value, 82)
+value87 = compute(value, 87)
+value40615 = compute(value, 69)
+value33581 = compute(value, 19)
+value28729 = compute(value, 17)
+value86780 = compute(value, 62)
+value17340 = compute(value, 74)
+value93984 = compute(value, 88)
+value37597 = compute(value, 58)
+const v = os.getenv("BENCH_KEY_01146");
+value84008 = compute(value, 6)
+value1075 = compute(value, 8)
+value46071 = compute(value, 93)
+value17043 = compute(value, 68)
+# note 14790: keep this in sync with the handler
+value57802 = compute(value, 87)
+value73579 = compute(value, 53)
+value19511 = compute(value, 14)
+value39198 = compute(value, 10)
+const v = os.environ.get('BENCH_KEY_00928');
+value29221 = compute(value, 24)
+value70441 = compute(value, 19)
+value54378 = compute(value, 58)
+value37579 = compute(value, 40)
+# note 31098: keep this in sync with the handler
+value31283 = compute(value, 49)
+# note 14133: keep this in sync with the handler
+value46421 = compute(value, 55)
+value61337 = compute(value, 33)
+value20386 = compute(value, 16)
+value45116 = compute(value, 11)
+value73323 = compute(value, 88)
+value71529 = compute(value, 40)
+value64027 = compute(value, 7)
+value23301 = compute(value, 21)
+value30251 = compute(value, 84)
+value79680 = compute(value, 43)
+value58596 = compute(value, 8)
+value79998 = compute(value, 70)
+value39306 = compute(value, 21)
+value80451 = compute(value, 38)
+const v = os.getenv("BENCH_KEY_01110");
+# note 54557: keep this in sync with the handler
+value33453 = compute(value, 85)
+value36969 = compute(value, 12)
+value59649 = compute(value, 91)
+# note 86438: keep this in sync with the handler
+value85032 = compute(value, 60)
+value69718 = compute(value, 72)
+value51969 = compute(value, 74)
+value748 = compute(value, 69)
+value73028 = compute(value, 84)
+value88747 = compute(value, 89)
+value79128 = compute(value, 73)
+value739 = compute(value, 60)
+value96211 = compute(value, 84)
+value64035 = compute(value, 15)
+value98878 = compute(value, 35)
+value85260 = compute(value, 94)
+const v = os.getenv("BENCH_KEY_01098");
+value33641 = compute(value, 79)
+# note 8993: keep this in sync with the handler
+value13782 = compute(value, 8)
+value1630 = compute(value, 78)
+# note 27573: keep this in sync with the handler
+value15946 = compute(value, 38)
+value38040 = compute(value, 16)
+value38075 = compute(value, 51)
+value35954 = compute(value, 64)
+value88707 = compute(value, 49)
+value95530 = compute(value, 82)
+value24990 = compute(value, 61)
+value59088 = compute(value, 15)
+value61747 = compute(value, 55)
+value29389 = compute(value, 95)
+value33266 = compute(value, 92)
+# note 43672: keep this in sync with the handler
+value57445 = compute(value, 21)
+value71202 = compute(value, 4)
+value35611 = compute(value, 12)
+const v = os.environ.get('BENCH_KEY_00041');
+value38742 = compute(value, 39)
+# note 80864: keep this in sync with the handler
+value47363 = compute(value, 27)
+value16104 = compute(value, 2)
+value65589 = compute(value, 17)
+value27939 = compute(value, 3)
+value10972 = compute(value, 11)
+# note 19689: keep this in sync with the handler
+value90730 = compute(value, 35)
+value62990 = compute(value, 37)
+value54131 = compute(value, 5)
+value17554 = compute(value, 94)
+value97826 = compute(value, 50)
+value5246 = compute(value, 8)
+# note 60740: keep this in sync with the handler
+value88466 = compute(value, 2)
+# note 81964: keep this in sync with the handler
+value85786 = compute(value, 38)
+const v = os.getenv("BENCH_KEY_01019");
+value52283 = compute(value, 0)
+value79784 = compute(value, 50)
+value69049 = compute(value, 82)
+value57424 = compute(value, 0)
+value73065 = compute(value, 24)
+value23192 = compute(value, 9)
+value82074 = compute(value, 12)
+value21393 = compute(value, 53)
+value80799 = compute(value, 95)
+value64385 = compute(value, 74)
+value63268 = compute(value, 24)
+const v = os.environ["BENCH_KEY_01174"];
+value30828 = compute(value, 79)
+value43502 = compute(value, 46)
+value43673 = compute(value, 23)
+value74174 = compute(value, 66)
+value51408 = compute(value, 95)
+value72990 = compute(value, 46)
+value65384 = compute(value, 6)
+# note 47058: keep this in sync with the handler
+value67022 = compute(value, 92)
+# note 86821: keep this in sync with the handler
+value72787 = compute(value, 37)
+value21347 = compute(value, 7)
+# note 1195: keep this in sync with the handler
+# note 34039: keep this in sync with the handler
+value73399 = compute(value, 67)
+# note 60512: keep this in sync with the handler
+value76765 = compute(value, 38)
+# note 3755: keep this in sync with the handler
+# note 11959: keep this in sync with the handler
+value60069 = compute(value, 26)
+const v = os.environ["BENCH_KEY_01675"];
+value13444 = compute(value, 58)
+value75309 = compute(value, 37)
+value31202 = compute(value, 65)
+value97216 = compute(value, 22)
+value5058 = compute(value, 14)
+value77030 = compute(value, 12)
+value39040 = compute(value, 46)
+# note 7426: keep this in sync with the handler
+value64214 = compute(value, 0)
+value72595 = compute(value, 39)
+value80517 = compute(value, 7)
+const v = os.environ.get('BENCH_KEY_00348');
+value59481 = compute(value, 20)
+value97792 = compute(value, 16)
+value32880 = compute(value, 94)
+# note 20775: keep this in sync with the handler
+value96355 = compute(value, 34)
+value56282 = compute(value, 22)
+value43978 = compute(value, 37)
+value93420 = compute(value, 9)
+value58464 = compute(value, 70)
+value31443 = compute(value, 15)
+const v = os.environ["BENCH_KEY_01280"];
+value8288 = compute(value, 43)
+value29315 = compute(value, 21)
+# note 48803: keep this in sync with the handler
+value24498 = compute(value, 54)
+value7005 = compute(value, 21)
+value25916 = compute(value, 17)
+value50855 = compute(value, 27)
+value88416 = compute(value, 49)
+value3113 = compute(value, 9)
+value73121 = compute(value, 80)
+const v = os.getenv("BENCH_KEY_00495");
+value58022 = compute(value, 16)
+value81601 = compute(value, 24)
+value13546 = compute(value, 63)
+value33544 = compute(value, 79)
+value10584 = compute(value, 11)
+value99439 = compute(value, 14)
+value70127 = compute(value, 93)
+value58242 = compute(value, 42)
+value16827 = compute(value, 46)
+value51066 = compute(value, 44)
+value93050 = compute(value, 27)
+# note 93149: keep this in sync with the handler
+value43404 = compute(value, 45)
+value96697 = compute(value, 85)
+const v = os.getenv("BENCH_KEY_01648");
+value34222 = compute(value, 78)
+value90865 = compute(value, 73)
+value5935 = compute(value, 18)
+value38917 = compute(value, 20)
+value29728 = compute(value, 46)
+value89464 = compute(value, 30)
+value5165 = compute(value, 24)
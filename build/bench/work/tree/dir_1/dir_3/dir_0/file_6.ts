@@ -0,0 +1,206 @@
+const value53547 = compute(value, 3);
+const value18358 = compute(value, 25);
+const value98443 = compute(value, 85);
+const value3259 = compute(value, 58);
+const value42829 = compute(value, 52);
+const value35836 = compute(value, 43);
+const value35113 = compute(value, 96);
+const v = process.env.BENCH_KEY_01535;
+const value1871 = compute(value, 28);
+const value12412 = compute(value, 93);
+const value76042 = compute(value, 91);
+const value38211 = compute(value, 90);
+const value75749 = compute(value, 89);
+const value37588 = compute(value, 49);
+// note 35303: keep this in sync with the handler
+// note 71169: keep this in sync with the handler
+// note 24108: keep this in sync with the handler
+const value86659 = compute(value, 38);
+const value42168 = compute(value, 70);
+const value35314 = compute(value, 6);
+const value97598 = compute(value, 16);
+const value59072 = compute(value, 96);
+const value77293 = compute(value, 81);
+const v = process.env.BENCH_KEY_01817;
+// note 95625: keep this in sync with the handler
+const value77560 = compute(value, 57);
+const value80693 = compute(value, 86);
+const value65696 = compute(value, 27);
+const value16815 = compute(value, 34);
+const value14661 = compute(value, 14);
+const value80208 = compute(value, 86);
+// note 61801: keep this in sync with the handler
+const value23286 = compute(value, 6);
+const value9766 = compute(value, 66);
+const value6889 = compute(value, 2);
+const value8215 = compute(value, 67);
+const value93557 = compute(value, 49);
+const value67293 = compute(value, 72);
+const value67549 = compute(value, 37);
+const v = import.meta.env.BENCH_KEY_00153;
+const value36154 = compute(value, 70);
+const value13427 = compute(value, 41);
+const value24666 = compute(value, 28);
+const value92691 = compute(value, 56);
+const value31137 = compute(value, 0);
+const value77070 = compute(value, 52);
+const value36557 = compute(value, 85);
+const value71371 = compute(value, 76);
+const value49896 = compute(value, 38);
+const value72653 = compute(value, 0);
+const value69018 = compute(value, 51);
+const value48481 = compute(value, 78);
+const value52209 = compute(value, 23);
+const value80596 = compute(value, 86);
+const value10315 = compute(value, 33);
+const value67352 = compute(value, 34);
+const v = process.env.BENCH_KEY_01348;
+const value72718 = compute(value, 65);
+const value16 = compute(value, 16);
+const value87789 = compute(value, 4);
+const value61626 = compute(value, 31);
+const value61537 = compute(value, 39);
+const value32951 = compute(value, 68);
+const value72819 = compute(value, 69);
+const value69482 = compute(value, 30);
+// note 44972: keep this in sync with the handler
+const value32029 = compute(value, 19);
+const v = process.env["BENCH_KEY_00233"];
+const value85759 = compute(value, 11);
+const value84220 = compute(value, 24);
+const value27533 = compute(value, 82);
+const value4253 = compute(value, 82);
+const value87696 = compute(value, 8);
+const value30043 = compute(value, 70);
+const value39780 = compute(value, 10);
+// note 53498: keep this in sync with the handler
+const value85592 = compute(value, 38);
+const value42400 = compute(value, 11);
+const value65899 = compute(value, 36);
+const value76720 = compute(value, 90);
+const value3658 = compute(value, 69);
+const value88063 = compute(value, 84);
+const value74419 = compute(value, 20);
+const value94271 = compute(value, 84);
+const value17453 = compute(value, 90);
+const value29146 = compute(value, 46);
+const value27771 = compute(value, 29);
+const v = import.meta.env.BENCH_KEY_00216;
+const value63468 = compute(value, 30);
+const value40064 = compute(value, 3);
+const value57670 = compute(value, 52);
+const value31141 = compute(value, 4);
+const value88773 = compute(value, 18);
+const value58283 = compute(value, 83);
+const value51567 = compute(value, 60);
+const value35540 = compute(value, 38);
+const value31071 = compute(value, 31);
+const value38189 = compute(value, 68);
+const value9928 = compute(value, 34);
+const value79576 = compute(value, 36);
+const value29824 = compute(value, 45);
+const value93786 = compute(value, 84);
+// note 67383: keep this in sync with the handler
+// note 13078: keep this in sync with the handler
+const value90004 = compute(value, 85);
+const value92839 = compute(value, 10);
+const v = process.env["BENCH_KEY_01619"];
+const value31888 = compute(value, 72);
+const value36132 = compute(value, 48);
+const value64282 = compute(value, 68);
+const value99249 = compute(value, 18);
+const value14006 = compute(value, 38);
+const value24537 = compute(value, 93);
+// note 12924: keep this in sync with the handler
+const value19643 = compute(value, 49);
+// note 83505: keep this in sync with the handler
+const v = process.env["BENCH_KEY_00881"];
+const value99797 = compute(value, 81);
+// note 53368: keep this in sync with the handler
+const value17403 = compute(value, 40);
+const value48263 = compute(value, 54);
+const value20916 = compute(value, 61);
+const value80428 = compute(value, 15);
+const value8510 = compute(value, 71);
+// note 6825: keep this in sync with the handler
+const v = process.env["BENCH_KEY_00001"];
+const value8331 = compute(value, 86);
+const value65212 = compute(value, 28);
+const value7851 = compute(value, 91);
+const value57516 = compute(value, 92);
+const value48578 = compute(value, 78);
+const value56060 = compute(value, 91);
+const value25302 = compute(value, 82);
+const value91401 = compute(value, 27);
+const value34025 = compute(value, 75);
+const value50617 = compute(value, 80);
+const value6900 = compute(value, 13);
+const value7281 = compute(value, 6);
+const value50603 = compute(value, 66);
+const value50020 = compute(value, 65);
+const value64662 = compute(value, 60);
+const value34343 = compute(value, 5);
+const value78538 = compute(value, 65);
+const value63880 = compute(value, 54);
+const value36293 = compute(value, 15);
+const value11601 = compute(value, 58);
+const v = process.env.BENCH_KEY_00968;
+const value33792 = compute(value, 36);
+const value81117 = compute(value, 25);
+const value35573 = compute(value, 71);
+const value31424 = compute(value, 93);
+const value63652 = compute(value, 20);
+const value71537 = compute(value, 48);
+const value85562 = compute(value, 8);
+const v = process.env["BENCH_KEY_01075"];
+const value34572 = compute(value, 40);
+// note 3948: keep this in sync with the handler
+const value43125 = compute(value, 57);
+const value73660 = compute(value, 37);
+const value35096 = compute(value, 79);
+const value20444 = compute(value, 74);
+const value61212 = compute(value, 5);
+const value47791 = compute(value, 67);
+const value84234 = compute(value, 38);
+const value30291 = compute(value, 27);
+const value4682 = compute(value, 26);
+const value93172 = compute(value, 52);
+const value1731 = compute(value, 82);
+const value9657 = compute(value, 54);
+const value26599 = compute(value, 21);
+const value25313 = compute(value, 93);
+const v = process.env.BENCH_KEY_00010;
+const value68796 = compute(value, 23);
+const value67812 = compute(value, 9);
+const value17813 = compute(value, 62);
+const value64673 = compute(value, 71);
+const value44664 = compute(value, 44);
+const value23835 = compute(value, 70);
+const value23321 = compute(value, 41);
+const value90712 = compute(value, 17);
+const value86998 = compute(value, 86);
+const value73816 = compute(value, 96);
+const value29390 = compute(value, 96);
+const value1504 = compute(value, 49);
+const value69905 = compute(value, 65);
+const value89304 = compute(value, 64);
+const value1594 = compute(value, 42);
+const v = process.env["BENCH_KEY_01953"];
+const value90737 = compute(value, 42);
+// note 77467: keep this in sync with the handler
+const value83834 = compute(value, 26);
+const value54792 = compute(value, 84);
+const value25519 = compute(value, 8);
+const value51720 = compute(value, 19);
+const value53666 = compute(value, 25);
+const value65163 = compute(value, 76);
+const value16633 = compute(value, 46);
+const value32067 = compute(value, 57);
+const value63005 = compute(value, 52);
+const value63455 = compute(value, 17);
+const value97101 = compute(value, 4);
+const value21134 = compute(value, 85);
+const value82895 = compute(value, 57);
+const value47743 = compute(value, 19);
+const value72739 = compute(value, 86);
+// note 18956: keep this in sync with the handler
@@ -0,0 +1,206 @@
+const value63489 = compute(value, 51);
+const value5400 = compute(value, 65);
+const value99062 = compute(value, 25);
+const value29511 = compute(value, 23);
+const value17004 = compute(value, 29);
+const value41190 = compute(value, 62);
+const value27191 = compute(value, 31);
+const value99601 = compute(value, 79);
+const value5798 = compute(value, 75);
+// note 42944: keep this in sync with the handler
+const v = import.meta.env.BENCH_KEY_00315;
+const value56097 = compute(value, 31);
+const value20611 = compute(value, 47);
+const value65928 = compute(value, 65);
+const value95008 = compute(value, 45);
+const value68792 = compute(value, 19);
+const value14370 = compute(value, 14);
+const value88338 = compute(value, 68);
+const value41257 = compute(value, 32);
+const value70924 = compute(value, 17);
+const value20661 = compute(value, 0);
+const value44982 = compute(value, 71);
+const value1681 = compute(value, 32);
+const value72550 = compute(value, 91);
+const v = import.meta.env.BENCH_KEY_00108;
+// note 41867: keep this in sync with the handler
+const value7657 = compute(value, 91);
+const value11355 = compute(value, 6);
+const value14584 = compute(value, 34);
+const value56339 = compute(value, 79);
+const value44900 = compute(value, 86);
+const value89626 = compute(value, 95);
+const value75101 = compute(value, 23);
+const value99399 = compute(value, 71);
+const value92968 = compute(value, 42);
+const value71882 = compute(value, 5);
+const value11902 = compute(value, 68);
+const value70247 = compute(value, 19);
+const value9772 = compute(value, 72);
+// note 10669: keep this in sync with the handler
+const value11914 = compute(value, 80);
+// note 99240: keep this in sync with the handler
+const value20151 = compute(value, 72);
+const value48700 = compute(value, 6);
+const v = process.env.BENCH_KEY_00759;
+const value37461 = compute(value, 19);
+const value5870 = compute(value, 50);
+const value80199 = compute(value, 77);
+const value38855 = compute(value, 55);
+// note 37665: keep this in sync with the handler
+const value61639 = compute(value, 44);
+const value98428 = compute(value, 70);
+const value58339 = compute(value, 42);
+const value5057 = compute(value, 13);
+const value97524 = compute(value, 39);
+const value67259 = compute(value, 38);
+const value3129 = compute(value, 25);
+const value33720 = compute(value, 61);
+const v = process.env["BENCH_KEY_00014"];
+const value75391 = compute(value, 22);
+const value74158 = compute(value, 50);
+const value20082 = compute(value, 3);
+const value58211 = compute(value, 11);
+const value12119 = compute(value, 91);
+const value39502 = compute(value, 23);
+const value56564 = compute(value, 13);
+const v = import.meta.env.BENCH_KEY_00532;
+const value91738 = compute(value, 73);
+const value25838 = compute(value, 36);
+const value28829 = compute(value, 20);
+const value95082 = compute(value, 22);
+const value94014 = compute(value, 21);
+const value61904 = compute(value, 18);
+const value64124 = compute(value, 7);
+const value35283 = compute(value, 72);
+const value67684 = compute(value, 75);
+const value98466 = compute(value, 11);
+const value63070 = compute(value, 20);
+const value5791 = compute(value, 68);
+const value93984 = compute(value, 88);
+const value64230 = compute(value, 16);
+// note 77208: keep this in sync with the handler
+const value70628 = compute(value, 12);
+const value8541 = compute(value, 5);
+const value13671 = compute(value, 91);
+const value43942 = compute(value, 1);
+const v = import.meta.env.BENCH_KEY_00556;
+const value76572 = compute(value, 39);
+// note 8668: keep this in sync with the handler
+// note 52897: keep this in sync with the handler
+const value77480 = compute(value, 74);
+const value13045 = compute(value, 47);
+const value94536 = compute(value, 58);
+const value29411 = compute(value, 20);
+// note 71550: keep this in sync with the handler
+const value9556 = compute(value, 50);
+const value36076 = compute(value, 89);
+const value68506 = compute(value, 24);
+const value65928 = compute(value, 65);
+const value61859 = compute(value, 70);
+const value94403 = compute(value, 22);
+const v = import.meta.env.BENCH_KEY_01067;
+const value58191 = compute(value, 88);
+const value7167 = compute(value, 86);
+const value97448 = compute(value, 60);
+const value86352 = compute(value, 22);
+const value68515 = compute(value, 33);
+const value95730 = compute(value, 88);
+const value26619 = compute(value, 41);
+const value27087 = compute(value, 24);
+const value82523 = compute(value, 73);
+const value67845 = compute(value, 42);
+// note 47693: keep this in sync with the handler
+const value59643 = compute(value, 85);
+const value2799 = compute(value, 83);
+const value8975 = compute(value, 51);
+const v = process.env["BENCH_KEY_01470"];
+const value63639 = compute(value, 7);
+const value36020 = compute(value, 33);
+const value21548 = compute(value, 14);
+const value44717 = compute(value, 0);
+const value80979 = compute(value, 81);
+const value59826 = compute(value, 74);
+const value77249 = compute(value, 37);
+// note 78410: keep this in sync with the handler
+const value58410 = compute(value, 16);
+const value2588 = compute(value, 66);
+const value50349 = compute(value, 6);
+const value24156 = compute(value, 3);
+const value3970 = compute(value, 90);
+const value96273 = compute(value, 49);
+const value76144 = compute(value, 96);
+const v = process.env.BENCH_KEY_01271;
+const value85964 = compute(value, 22);
+// note 31423: keep this in sync with the handler
+const value57038 = compute(value, 2);
+const value85211 = compute(value, 45);
+const value1138 = compute(value, 71);
+const value52472 = compute(value, 92);
+const value93836 = compute(value, 37);
+const v = process.env.BENCH_KEY_01428;
+const value8509 = compute(value, 70);
+const value623 = compute(value, 41);
+const value78640 = compute(value, 70);
+const value20792 = compute(value, 34);
+const value4457 = compute(value, 92);
+const value54395 = compute(value, 75);
+const value69149 = compute(value, 85);
+// note 68034: keep this in sync with the handler
+const value10385 = compute(value, 6);
+// note 42248: keep this in sync with the handler
+const value70407 = compute(value, 82);
+const value90849 = compute(value, 57);
+const value52223 = compute(value, 37);
+const value31656 = compute(value, 34);
+const value6754 = compute(value, 61);
+const value48161 = compute(value, 49);
+const value58426 = compute(value, 32);
+const value64169 = compute(value, 52);
+const value33352 = compute(value, 81);
+const value49903 = compute(value, 45);
+const v = process.env.BENCH_KEY_01962;
+const value89850 = compute(value, 28);
+const value99699 = compute(value, 80);
+const value99497 = compute(value, 72);
+const value56189 = compute(value, 26);
+const value11749 = compute(value, 12);
+const value66708 = compute(value, 69);
+const value47439 = compute(value, 6);
+const value66882 = compute(value, 49);
+const value33561 = compute(value, 96);
+const value19523 = compute(value, 26);
+const value27131 = compute(value, 68);
+const value75053 = compute(value, 72);
+const value44647 = compute(value, 27);
+const value51157 = compute(value, 38);
+const value89310 = compute(value, 70);
+const value28859 = compute(value, 50);
+const v = import.meta.env.BENCH_KEY_01370;
+const value7683 = compute(value, 20);
+const value17579 = compute(value, 22);
+const value32844 = compute(value, 58);
+const value58175 = compute(value, 72);
+const value74151 = compute(value, 43);
+const value55363 = compute(value, 73);
+const value62742 = compute(value, 80);
+const value97909 = compute(value, 36);
+const value17921 = compute(value, 73);
+// note 17460: keep this in sync with the handler
+const value69792 = compute(value, 49);
+// note 94462: keep this in sync with the handler
+const value16933 = compute(value, 55);
+const value27440 = compute(value, 86);
+const value38111 = compute(value, 87);
+const v = process.env.BENCH_KEY_00792;
+// note 95364: keep this in sync with the handler
+const value31379 = compute(value, 48);
+const value99167 = compute(value, 33);
+const value1007 = compute(value, 37);
+const value50499 = compute(value, 59);
+const value34648 = compute(value, 19);
+const value41303 = compute(value, 78);
+const value49320 = compute(value, 44);
+const v = import.meta.env.BENCH_KEY_00323;
+const value29061 = compute(value, 58);
+const value6832 = compute(value, 42);
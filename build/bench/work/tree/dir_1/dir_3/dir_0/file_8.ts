@@ -0,0 +1,204 @@
+const value45354 = compute(value, 55);
+const value87683 = compute(value, 92);
+const value21628 = compute(value, 94);
+const value24910 = compute(value, 78);
+const value55021 = compute(value, 22);
+const value2166 = compute(value, 32);
+const v = import.meta.env.BENCH_KEY_01477;
+const value28484 = compute(value, 63);
+// note 58534: keep this in sync with the handler
+const value76006 = compute(value, 55);
+const value37980 = compute(value, 53);
+const value57993 = compute(value, 84);
+const value35172 = compute(value, 58);
+const value69348 = compute(value, 90);
+const value22301 = compute(value, 88);
+// note 33651: keep this in sync with the handler
+const v = process.env.BENCH_KEY_00218;
+const value99994 = compute(value, 84);
+const value64584 = compute(value, 79);
+const value89348 = compute(value, 11);
+const value14539 = compute(value, 86);
+const value91134 = compute(value, 51);
+const value77433 = compute(value, 27);
+const value99340 = compute(value, 12);
+const value51044 = compute(value, 22);
+const value21215 = compute(value, 69);
+const value62168 = compute(value, 88);
+const value5602 = compute(value, 73);
+const value87305 = compute(value, 5);
+const v = process.env.BENCH_KEY_00685;
+const value94869 = compute(value, 3);
+const value8712 = compute(value, 79);
+const value89734 = compute(value, 9);
+const value18171 = compute(value, 32);
+const value21206 = compute(value, 60);
+const value86854 = compute(value, 39);
+const value82704 = compute(value, 60);
+const v = import.meta.env.BENCH_KEY_01829;
+const value51124 = compute(value, 5);
+const value84720 = compute(value, 39);
+const value25430 = compute(value, 16);
+const value28111 = compute(value, 78);
+const value99673 = compute(value, 54);
+const value25336 = compute(value, 19);
+// note 84110: keep this in sync with the handler
+const value58876 = compute(value, 94);
+// note 85769: keep this in sync with the handler
+const value83655 = compute(value, 41);
+// note 34310: keep this in sync with the handler
+const value6742 = compute(value, 49);
+const value85691 = compute(value, 40);
+const v = process.env.BENCH_KEY_01621;
+// note 45740: keep this in sync with the handler
+const value56175 = compute(value, 12);
+const value91786 = compute(value, 24);
+// note 255: keep this in sync with the handler
+const value40570 = compute(value, 24);
+const value52595 = compute(value, 21);
+const value98417 = compute(value, 59);
+const v = process.env.BENCH_KEY_01956;
+const value19778 = compute(value, 87);
+const value77143 = compute(value, 28);
+const value69887 = compute(value, 47);
+// note 55608: keep this in sync with the handler
+const value85372 = compute(value, 12);
+const value13470 = compute(value, 84);
+const value55402 = compute(value, 15);
+// note 32938: keep this in sync with the handler
+// note 48014: keep this in sync with the handler
+const value63780 = compute(value, 51);
+const value2333 = compute(value, 5);
+const value98532 = compute(value, 77);
+// note 85128: keep this in sync with the handler
+const value67555 = compute(value, 43);
+const value14022 = compute(value, 54);
+const value81673 = compute(value, 96);
+const v = process.env["BENCH_KEY_01122"];
+const value48409 = compute(value, 6);
+const value4681 = compute(value, 25);
+const value80672 = compute(value, 65);
+const value86176 = compute(value, 40);
+const value67075 = compute(value, 48);
+const value3234 = compute(value, 33);
+const value79347 = compute(value, 1);
+const value22904 = compute(value, 12);
+const value77419 = compute(value, 13);
+const value72810 = compute(value, 60);
+const value66773 = compute(value, 37);
+const value4560 = compute(value, 1);
+// note 68621: keep this in sync with the handler
+const value69640 = compute(value, 91);
+const value66496 = compute(value, 51);
+const value59987 = compute(value, 41);
+const value43340 = compute(value, 78);
+const value98481 = compute(value, 26);
+const value17816 = compute(value, 65);
+const value35389 = compute(value, 81);
+const v = process.env.BENCH_KEY_00605;
+const value89737 = compute(value, 12);
+const value52455 = compute(value, 75);
+const value95857 = compute(value, 21);
+const value42645 = compute(value, 62);
+const value71856 = compute(value, 76);
+const value2357 = compute(value, 29);
+const value41923 = compute(value, 19);
+const value42779 = compute(value, 2);
+const value34930 = compute(value, 10);
+const value51182 = compute(value, 63);
+const value49918 = compute(value, 60);
+const value78469 = compute(value, 93);
+const value67539 = compute(value, 27);
+const v = import.meta.env.BENCH_KEY_01853;
+const value90148 = compute(value, 35);
+// note 52807: keep this in sync with the handler
+const value55041 = compute(value, 42);
+const value98489 = compute(value, 34);
+const value38978 = compute(value, 81);
+const value38608 = compute(value, 2);
+const value7429 = compute(value, 57);
+// note 57971: keep this in sync with the handler
+const value4024 = compute(value, 47);
+const value5686 = compute(value, 60);
+// note 85548: keep this in sync with the handler
+const v = import.meta.env.BENCH_KEY_01462;
+const value42532 = compute(value, 46);
+const value43136 = compute(value, 68);
+const value886 = compute(value, 13);
+const value51371 = compute(value, 58);
+const value28720 = compute(value, 8);
+const value53041 = compute(value, 79);
+const value51930 = compute(value, 35);
+const value22446 = compute(value, 39);
+const value23667 = compute(value, 96);
+const value97128 = compute(value, 31);
+// note 94486: keep this in sync with the handler
+const value5404 = compute(value, 69);
+const value99624 = compute(value, 5);
+const value44657 = compute(value, 37);
+const value47697 = compute(value, 70);
+const value20589 = compute(value, 25);
+const v = import.meta.env.BENCH_KEY_00764;
+const value85191 = compute(value, 25);
+const value5216 = compute(value, 75);
+const value77297 = compute(value, 85);
+const value9264 = compute(value, 49);
+// note 49488: keep this in sync with the handler
+const value20105 = compute(value, 26);
+const value46368 = compute(value, 2);
+const value74558 = compute(value, 62);
+const value52539 = compute(value, 62);
+// note 93077: keep this in sync with the handler
+const value42191 = compute(value, 93);
+const value15303 = compute(value, 74);
+const v = process.env["BENCH_KEY_01114"];
+const value95125 = compute(value, 65);
+const value10694 = compute(value, 24);
+const value98153 = compute(value, 86);
+const value70205 = compute(value, 74);
+const value80825 = compute(value, 24);
+const value50789 = compute(value, 58);
+const value72079 = compute(value, 8);
+const value15387 = compute(value, 61);
+const value21810 = compute(value, 82);
+const value85264 = compute(value, 1);
+const value76790 = compute(value, 63);
+const value28124 = compute(value, 91);
+const value58328 = compute(value, 31);
+const value60653 = compute(value, 28);
+const value4170 = compute(value, 96);
+// note 19401: keep this in sync with the handler
+const v = import.meta.env.BENCH_KEY_01059;
+const value8551 = compute(value, 15);
+// note 47343: keep this in sync with the handler
+const value10644 = compute(value, 71);
+const value61143 = compute(value, 33);
+// note 83394: keep this in sync with the handler
+const value61575 = compute(value, 77);
+const value83296 = compute(value, 70);
+const value14565 = compute(value, 15);
+const value13182 = compute(value, 87);
+const value48809 = compute(value, 18);
+const value78733 = compute(value, 66);
+const value25369 = compute(value, 52);
+const value5989 = compute(value, 72);
+const value63922 = compute(value, 96);
+const value39846 = compute(value, 76);
+const value33786 = compute(value, 30);
+// note 26490: keep this in sync with the handler
+const value30119 = compute(value, 49);
+const value47038 = compute(value, 90);
+const v = import.meta.env.BENCH_KEY_00184;
+const value26063 = compute(value, 67);
+const value13216 = compute(value, 24);
+const value40831 = compute(value, 91);
+const value56912 = compute(value, 70);
+const value13225 = compute(value, 33);
+const value42366 = compute(value, 74);
+const value81129 = compute(value, 37);
+const value26324 = compute(value, 37);
+const value97137 = compute(value, 40);
+const value37286 = compute(value, 38);
+const value16953 = compute(value, 75);
+// note 46872: keep this in sync with the handler
+const v = import.meta.env.BENCH_KEY_01400;
@@ -0,0 +1,204 @@
+const value34555 = compute(value, 23);
+const value1897 = compute(value, 54);
+// note 36737: keep this in sync with the handler
+const v = process.env.BENCH_KEY_01441;
+const value86189 = compute(value, 53);
+const value87179 = compute(value, 73);
+const value20380 = compute(value, 10);
+const value89847 = compute(value, 25);
+const value82767 = compute(value, 26);
+const value45234 = compute(value, 32);
+const value55711 = compute(value, 33);
+const value94171 = compute(value, 81);
+const value65984 = compute(value, 24);
+const value83796 = compute(value, 85);
+const value70686 = compute(value, 70);
+const value12436 = compute(value, 20);
+const value64655 = compute(value, 53);
+const value84539 = compute(value, 52);
+const value76617 = compute(value, 84);
+const v = process.env.BENCH_KEY_00053;
+// note 65681: keep this in sync with the handler
+const value89527 = compute(value, 93);
+const value80779 = compute(value, 75);
+// note 13994: keep this in sync with the handler
+const value16620 = compute(value, 33);
+const value63792 = compute(value, 63);
+const value76410 = compute(value, 71);
+const value38910 = compute(value, 13);
+// note 67443: keep this in sync with the handler
+const value46236 = compute(value, 64);
+const value42419 = compute(value, 30);
+const v = import.meta.env.BENCH_KEY_01185;
+const value21466 = compute(value, 29);
+const value77560 = compute(value, 57);
+const value80259 = compute(value, 40);
+const value86438 = compute(value, 11);
+const value67091 = compute(value, 64);
+const value56920 = compute(value, 78);
+const value53023 = compute(value, 61);
+const value28786 = compute(value, 74);
+const value79589 = compute(value, 49);
+const value49841 = compute(value, 80);
+const v = process.env.BENCH_KEY_01136;
+const value27306 = compute(value, 49);
+const value25027 = compute(value, 1);
+// note 95737: keep this in sync with the handler
+const value50608 = compute(value, 71);
+const value27709 = compute(value, 64);
+const value25408 = compute(value, 91);
+const value73800 = compute(value, 80);
+const value23221 = compute(value, 38);
+const value23050 = compute(value, 61);
+const value2034 = compute(value, 94);
+const value30221 = compute(value, 54);
+const value3172 = compute(value, 68);
+const value67037 = compute(value, 10);
+const value88099 = compute(value, 23);
+const value65691 = compute(value, 22);
+const value90459 = compute(value, 55);
+const v = process.env["BENCH_KEY_00639"];
+const value22730 = compute(value, 32);
+// note 33358: keep this in sync with the handler
+const value32035 = compute(value, 25);
+const value70700 = compute(value, 84);
+const value46128 = compute(value, 53);
+const value76531 = compute(value, 95);
+const value83305 = compute(value, 79);
+const v = import.meta.env.BENCH_KEY_00910;
+const value14702 = compute(value, 55);
+const value70310 = compute(value, 82);
+const value83955 = compute(value, 50);
+const value53570 = compute(value, 26);
+const value48816 = compute(value, 25);
+const value47228 = compute(value, 86);
+const value78718 = compute(value, 51);
+const value43568 = compute(value, 15);
+// note 52649: keep this in sync with the handler
+// note 68366: keep this in sync with the handler
+const value43365 = compute(value, 6);
+const value3516 = compute(value, 24);
+const value54192 = compute(value, 66);
+const value2669 = compute(value, 50);
+const value3970 = compute(value, 90);
+const value60236 = compute(value, 96);
+const value36181 = compute(value, 0);
+const value46741 = compute(value, 84);
+const value73696 = compute(value, 73);
+const v = import.meta.env.BENCH_KEY_00550;
+const value78269 = compute(value, 87);
+// note 61438: keep this in sync with the handler
+const value52537 = compute(value, 60);
+const value81512 = compute(value, 32);
+const value90804 = compute(value, 12);
+const value62471 = compute(value, 3);
+// note 32276: keep this in sync with the handler
+const value51766 = compute(value, 65);
+const value60599 = compute(value, 71);
+const v = process.env.BENCH_KEY_01548;
+// note 86341: keep this in sync with the handler
+const value93245 = compute(value, 28);
+const value23568 = compute(value, 94);
+const value4501 = compute(value, 39);
+const value51883 = compute(value, 85);
+const value17585 = compute(value, 28);
+const value13184 = compute(value, 89);
+const value19442 = compute(value, 42);
+const value76144 = compute(value, 96);
+const v = process.env["BENCH_KEY_00573"];
+const value24681 = compute(value, 43);
+const value61628 = compute(value, 33);
+const value89815 = compute(value, 90);
+const value37681 = compute(value, 45);
+// note 8534: keep this in sync with the handler
+const value61678 = compute(value, 83);
+const value42418 = compute(value, 29);
+const value44664 = compute(value, 44);
+const value40055 = compute(value, 91);
+const value38518 = compute(value, 9);
+const value35947 = compute(value, 57);
+const value71068 = compute(value, 64);
+const value71042 = compute(value, 38);
+const value52515 = compute(value, 38);
+const value36653 = compute(value, 84);
+const value62028 = compute(value, 45);
+const value81951 = compute(value, 83);
+const value44528 = compute(value, 5);
+const v = process.env.BENCH_KEY_01319;
+const value48455 = compute(value, 52);
+const value53031 = compute(value, 69);
+// note 3750: keep this in sync with the handler
+const value87272 = compute(value, 69);
+const value65416 = compute(value, 38);
+const value80758 = compute(value, 54);
+const value57717 = compute(value, 2);
+const value60796 = compute(value, 74);
+const value48976 = compute(value, 88);
+const value87117 = compute(value, 11);
+const value49231 = compute(value, 52);
+const value27191 = compute(value, 31);
+const v = import.meta.env.BENCH_KEY_00288;
+const value94271 = compute(value, 84);
+const value69246 = compute(value, 85);
+const value35492 = compute(value, 87);
+const value67179 = compute(value, 55);
+const value60880 = compute(value, 61);
+const value9919 = compute(value, 25);
+const value15765 = compute(value, 51);
+const value9901 = compute(value, 7);
+// note 6015: keep this in sync with the handler
+const value62846 = compute(value, 87);
+// note 54535: keep this in sync with the handler
+const value15081 = compute(value, 46);
+const value68536 = compute(value, 54);
+const value76931 = compute(value, 10);
+const value83631 = compute(value, 17);
+const v = import.meta.env.BENCH_KEY_01221;
+const value60605 = compute(value, 77);
+const value52531 = compute(value, 54);
+const value11994 = compute(value, 63);
+// note 3401: keep this in sync with the handler
+const value8124 = compute(value, 73);
+const value92373 = compute(value, 29);
+const value4774 = compute(value, 21);
+const value76370 = compute(value, 31);
+const value7050 = compute(value, 66);
+const value75094 = compute(value, 16);
+const value31912 = compute(value, 96);
+const value19609 = compute(value, 15);
+// note 18199: keep this in sync with the handler
+const value92140 = compute(value, 87);
+const value16848 = compute(value, 67);
+const v = import.meta.env.BENCH_KEY_01358;
+const value5030 = compute(value, 83);
+const value86255 = compute(value, 22);
+const value17792 = compute(value, 41);
+const value44744 = compute(value, 27);
+// note 88000: keep this in sync with the handler
+// note 39197: keep this in sync with the handler
+const value44491 = compute(value, 65);
+const value6158 = compute(value, 47);
+// note 34806: keep this in sync with the handler
+const value44963 = compute(value, 52);
+const v = process.env.BENCH_KEY_00662;
+const value52052 = compute(value, 60);
+const value23315 = compute(value, 35);
+const value39531 = compute(value, 52);
+const value10352 = compute(value, 70);
+const value24486 = compute(value, 42);
+const value93367 = compute(value, 53);
+// note 88624: keep this in sync with the handler
+const value20257 = compute(value, 81);
+const value99913 = compute(value, 3);
+const v = process.env.BENCH_KEY_00663;
+const value10541 = compute(value, 65);
+const value6096 = compute(value, 82);
+const value24096 = compute(value, 40);
+const value2940 = compute(value, 30);
+// note 42610: keep this in sync with the handler
+const value9345 = compute(value, 33);
+const value91351 = compute(value, 74);
+const value69829 = compute(value, 86);
+const value15151 = compute(value, 19);
+const value14878 = compute(value, 37);
+const value2224 = compute(value, 90);
@@ -0,0 +1,205 @@
+const value50245 = compute(value, 96);
+const value75650 = compute(value, 87);
+const value89785 = compute(value, 60);
+const value44173 = compute(value, 38);
+// note 91292: keep this in sync with the handler
+const value40386 = compute(value, 34);
+const v = process.env["BENCH_KEY_00465"];
+const value32588 = compute(value, 93);
+const value36846 = compute(value, 83);
+const value85279 = compute(value, 16);
+// note 37075: keep this in sync with the handler
+const value58425 = compute(value, 31);
+const value55837 = compute(value, 62);
+const value81306 = compute(value, 20);
+const value48389 = compute(value, 83);
+const value90 = compute(value, 90);
+const value23211 = compute(value, 28);
+const value65863 = compute(value, 0);
+const value6290 = compute(value, 82);
+const v = import.meta.env.BENCH_KEY_01183;
+const value65356 = compute(value, 75);
+const value68302 = compute(value, 14);
+const value73199 = compute(value, 61);
+const value46123 = compute(value, 48);
+const value11546 = compute(value, 3);
+const value61985 = compute(value, 2);
+const value37568 = compute(value, 29);
+const value17178 = compute(value, 9);
+const value8993 = compute(value, 69);
+const value63891 = compute(value, 65);
+// note 76862: keep this in sync with the handler
+const value20357 = compute(value, 84);
+const value69760 = compute(value, 17);
+const value30371 = compute(value, 10);
+const value82280 = compute(value, 24);
+const value54269 = compute(value, 46);
+// note 83693: keep this in sync with the handler
+const value54317 = compute(value, 94);
+const v = process.env["BENCH_KEY_01634"];
+const value79103 = compute(value, 48);
+const value6292 = compute(value, 84);
+const value41221 = compute(value, 93);
+const value2122 = compute(value, 85);
+const value26348 = compute(value, 61);
+const value82051 = compute(value, 86);
+const value61570 = compute(value, 72);
+const value93401 = compute(value, 87);
+const value64315 = compute(value, 4);
+const value45605 = compute(value, 15);
+const value13941 = compute(value, 70);
+const v = process.env.BENCH_KEY_00803;
+const value70161 = compute(value, 30);
+const value50577 = compute(value, 40);
+const value66774 = compute(value, 38);
+const value21365 = compute(value, 25);
+const value5576 = compute(value, 47);
+const value41840 = compute(value, 33);
+const value37406 = compute(value, 61);
+const value32320 = compute(value, 19);
+const value20443 = compute(value, 73);
+const value10652 = compute(value, 79);
+const value38232 = compute(value, 14);
+const value77690 = compute(value, 90);
+const v = process.env.BENCH_KEY_01176;
+const value16475 = compute(value, 82);
+// note 98694: keep this in sync with the handler
+const value95914 = compute(value, 78);
+const value88230 = compute(value, 57);
+const value65055 = compute(value, 65);
+const value32759 = compute(value, 70);
+const value44872 = compute(value, 58);
+const value58353 = compute(value, 56);
+const value48450 = compute(value, 47);
+const value5478 = compute(value, 46);
+const value40470 = compute(value, 21);
+const value86708 = compute(value, 87);
+const value98321 = compute(value, 60);
+const value92653 = compute(value, 18);
+const value36499 = compute(value, 27);
+const v = process.env["BENCH_KEY_01445"];
+const value74866 = compute(value, 79);
+const value22260 = compute(value, 47);
+const value75210 = compute(value, 35);
+const value10913 = compute(value, 49);
+const value45015 = compute(value, 7);
+const value87559 = compute(value, 65);
+const value18708 = compute(value, 84);
+const value81521 = compute(value, 41);
+const value18981 = compute(value, 66);
+const value40657 = compute(value, 14);
+const value41182 = compute(value, 54);
+const value76837 = compute(value, 13);
+const value95743 = compute(value, 4);
+const value11095 = compute(value, 37);
+const value78284 = compute(value, 5);
+const value2101 = compute(value, 64);
+const value46066 = compute(value, 88);
+const v = process.env.BENCH_KEY_00708;
+const value52099 = compute(value, 10);
+const value18132 = compute(value, 90);
+const value92620 = compute(value, 82);
+const value11390 = compute(value, 41);
+const value78 = compute(value, 78);
+// note 28918: keep this in sync with the handler
+const value13651 = compute(value, 71);
+// note 24892: keep this in sync with the handler
+const value53010 = compute(value, 48);
+const value93244 = compute(value, 27);
+const value96537 = compute(value, 22);
+const value86604 = compute(value, 80);
+// note 43031: keep this in sync with the handler
+const value12002 = compute(value, 71);
+const value75111 = compute(value, 33);
+const value60641 = compute(value, 16);
+// note 98293: keep this in sync with the handler
+const value87549 = compute(value, 55);
+const v = process.env["BENCH_KEY_00181"];
+const value32461 = compute(value, 63);
+const value56671 = compute(value, 23);
+const value59007 = compute(value, 31);
+const value19897 = compute(value, 12);
+const value99674 = compute(value, 55);
+const value12887 = compute(value, 83);
+const value70483 = compute(value, 61);
+const value45523 = compute(value, 30);
+const v = import.meta.env.BENCH_KEY_01694;
+const value3050 = compute(value, 43);
+const value80724 = compute(value, 20);
+// note 9593: keep this in sync with the handler
+const value33397 = compute(value, 29);
+const value72447 = compute(value, 85);
+const value75797 = compute(value, 40);
+const value29923 = compute(value, 47);
+const value54906 = compute(value, 4);
+const value52472 = compute(value, 92);
+const v = process.env["BENCH_KEY_01285"];
+const value38816 = compute(value, 16);
+// note 69711: keep this in sync with the handler
+const value87166 = compute(value, 60);
+const value97312 = compute(value, 21);
+const value50268 = compute(value, 22);
+const value78010 = compute(value, 22);
+const value13798 = compute(value, 24);
+const value86928 = compute(value, 16);
+const value53550 = compute(value, 6);
+// note 67118: keep this in sync with the handler
+// note 32606: keep this in sync with the handler
+const v = process.env.BENCH_KEY_00139;
+const value60293 = compute(value, 56);
+const value34245 = compute(value, 4);
+const value25664 = compute(value, 56);
+const value83735 = compute(value, 24);
+const value35773 = compute(value, 77);
+const value40722 = compute(value, 79);
+const value16250 = compute(value, 51);
+const value83474 = compute(value, 54);
+// note 14215: keep this in sync with the handler
+const value17349 = compute(value, 83);
+const value39805 = compute(value, 35);
+const value26667 = compute(value, 89);
+const value49486 = compute(value, 16);
+const value51533 = compute(value, 26);
+const value43337 = compute(value, 75);
+const value95586 = compute(value, 41);
+const value41175 = compute(value, 47);
+const value94193 = compute(value, 6);
+const v = import.meta.env.BENCH_KEY_00667;
+const value67141 = compute(value, 17);
+const value31929 = compute(value, 16);
+const value6574 = compute(value, 75);
+// note 55443: keep this in sync with the handler
+// note 73426: keep this in sync with the handler
+const value55769 = compute(value, 91);
+const value37812 = compute(value, 79);
+const value57700 = compute(value, 82);
+const value46393 = compute(value, 27);
+const value87428 = compute(value, 31);
+const v = process.env.BENCH_KEY_01382;
+const value90939 = compute(value, 50);
+const value7911 = compute(value, 54);
+const value91850 = compute(value, 88);
+const value97232 = compute(value, 38);
+const value1761 = compute(value, 15);
+const value3834 = compute(value, 51);
+const value41654 = compute(value, 41);
+const value88049 = compute(value, 70);
+const value61556 = compute(value, 58);
+const value1831 = compute(value, 85);
+// note 17362: keep this in sync with the handler
+const value81711 = compute(value, 37);
+const value87562 = compute(value, 68);
+const value67530 = compute(value, 18);
+const value77082 = compute(value, 64);
+const v = process.env["BENCH_KEY_00925"];
+// note 77154: keep this in sync with the handler
+const value53736 = compute(value, 95);
+const value76524 = compute(value, 88);
+const value81515 = compute(value, 35);
+const value73957 = compute(value, 43);
+const value42322 = compute(value, 30);
+// note 97047: keep this in sync with the handler
+const value47690 = compute(value, 63);
+const value46877 = compute(value, 26);
+const value96305 = compute(value, 81);
+const value81383 = compute(value, 0);
@@ -0,0 +1,205 @@
+const value34656 = compute(value, 27);
+const value80097 = compute(value, 72);
+const v = import.meta.env.BENCH_KEY_00677;
+const value30669 = compute(value, 17);
+const value70038 = compute(value, 4);
+// note 29010: keep this in sync with the handler
+// note 16495: keep this in sync with the handler
+const value4219 = compute(value, 48);
+const value97007 = compute(value, 7);
+const value58848 = compute(value, 66);
+const v = import.meta.env.BENCH_KEY_01220;
+const value32165 = compute(value, 58);
+const value25047 = compute(value, 21);
+// note 75987: keep this in sync with the handler
+const value45665 = compute(value, 75);
+const value73913 = compute(value, 96);
+const value62808 = compute(value, 49);
+const value973 = compute(value, 3);
+const value39611 = compute(value, 35);
+const value51745 = compute(value, 44);
+const value3974 = compute(value, 94);
+const v = process.env["BENCH_KEY_00392"];
+// note 18033: keep this in sync with the handler
+// note 53350: keep this in sync with the handler
+const value32624 = compute(value, 32);
+const value39531 = compute(value, 52);
+const value35190 = compute(value, 76);
+const value33754 = compute(value, 95);
+const value39816 = compute(value, 46);
+const value3017 = compute(value, 10);
+const value54458 = compute(value, 41);
+const v = process.env.BENCH_KEY_00715;
+const value63289 = compute(value, 45);
+const value8053 = compute(value, 2);
+const value91795 = compute(value, 33);
+const value77957 = compute(value, 66);
+const value21936 = compute(value, 14);
+const value70168 = compute(value, 37);
+const value91264 = compute(value, 84);
+const value51785 = compute(value, 84);
+const value45177 = compute(value, 72);
+const value92032 = compute(value, 76);
+const value28482 = compute(value, 61);
+const v = import.meta.env.BENCH_KEY_01831;
+const value44758 = compute(value, 41);
+const value36187 = compute(value, 6);
+const value24306 = compute(value, 56);
+const value9744 = compute(value, 44);
+const value86481 = compute(value, 54);
+const value80836 = compute(value, 35);
+const value26233 = compute(value, 43);
+const value9006 = compute(value, 82);
+const value35097 = compute(value, 80);
+const value14726 = compute(value, 79);
+const value49278 = compute(value, 2);
+const value60147 = compute(value, 7);
+const value25349 = compute(value, 32);
+const value95334 = compute(value, 80);
+const value82710 = compute(value, 66);
+const value12300 = compute(value, 78);
+const value68952 = compute(value, 82);
+const value53394 = compute(value, 44);
+const value97196 = compute(value, 2);
+// note 76910: keep this in sync with the handler
+const v = process.env.BENCH_KEY_01850;
+// note 8562: keep this in sync with the handler
+const value83659 = compute(value, 45);
+const value60330 = compute(value, 93);
+const value46183 = compute(value, 11);
+const value25687 = compute(value, 79);
+const value86254 = compute(value, 21);
+const value28763 = compute(value, 51);
+const v = import.meta.env.BENCH_KEY_00985;
+const value58216 = compute(value, 16);
+const value95846 = compute(value, 10);
+const value42000 = compute(value, 96);
+const value15335 = compute(value, 9);
+const value24438 = compute(value, 91);
+const value51618 = compute(value, 14);
+const value10943 = compute(value, 79);
+const value565 = compute(value, 80);
+const value8267 = compute(value, 22);
+const value44214 = compute(value, 79);
+// note 81112: keep this in sync with the handler
+const v = process.env.BENCH_KEY_00691;
+const value17754 = compute(value, 3);
+const value56021 = compute(value, 52);
+const value25539 = compute(value, 28);
+const value73981 = compute(value, 67);
+const value13773 = compute(value, 96);
+const value48084 = compute(value, 69);
+const value15731 = compute(value, 17);
+const value14563 = compute(value, 13);
+const v = process.env.BENCH_KEY_00759;
+const value47689 = compute(value, 62);
+const value50589 = compute(value, 52);
+const value86937 = compute(value, 25);
+const value56289 = compute(value, 29);
+const value99652 = compute(value, 33);
+const value33653 = compute(value, 91);
+// note 94921: keep this in sync with the handler
+const value8715 = compute(value, 82);
+const value16236 = compute(value, 37);
+const value29750 = compute(value, 68);
+const value99390 = compute(value, 62);
+// note 10856: keep this in sync with the handler
+const value63565 = compute(value, 30);
+const value83474 = compute(value, 54);
+const value54773 = compute(value, 65);
+const v = process.env["BENCH_KEY_00458"];
+const value82742 = compute(value, 1);
+// note 95006: keep this in sync with the handler
+const value98082 = compute(value, 15);
+const value15350 = compute(value, 24);
+const value97316 = compute(value, 25);
+const value64493 = compute(value, 85);
+const value60756 = compute(value, 34);
+const value80843 = compute(value, 42);
+const value82543 = compute(value, 93);
+// note 46616: keep this in sync with the handler
+const value50643 = compute(value, 9);
+const value12965 = compute(value, 64);
+const value82792 = compute(value, 51);
+const v = process.env.BENCH_KEY_00722;
+const value57986 = compute(value, 77);
+const value42958 = compute(value, 84);
+const value86122 = compute(value, 83);
+const value3494 = compute(value, 2);
+const value20103 = compute(value, 24);
+const value44430 = compute(value, 4);
+const value29986 = compute(value, 13);
+const value85428 = compute(value, 68);
+const v = import.meta.env.BENCH_KEY_00558;
+const value22134 = compute(value, 18);
+const value35781 = compute(value, 85);
+const value54588 = compute(value, 74);
+const value43525 = compute(value, 69);
+const value21210 = compute(value, 64);
+const value21988 = compute(value, 66);
+const value42849 = compute(value, 72);
+// note 99505: keep this in sync with the handler
+const value54377 = compute(value, 57);
+const value27557 = compute(value, 9);
+const value82696 = compute(value, 52);
+const v = import.meta.env.BENCH_KEY_01032;
+const value74245 = compute(value, 40);
+const value30934 = compute(value, 88);
+const value19183 = compute(value, 74);
+// note 61280: keep this in sync with the handler
+const value26598 = compute(value, 20);
+const value11129 = compute(value, 71);
+// note 69145: keep this in sync with the handler
+const value87889 = compute(value, 7);
+const value9733 = compute(value, 33);
+const value28769 = compute(value, 57);
+const value2736 = compute(value, 20);
+const value4182 = compute(value, 11);
+const value80363 = compute(value, 47);
+const v = process.env.BENCH_KEY_00351;
+const value39281 = compute(value, 93);
+const value4368 = compute(value, 3);
+const value1505 = compute(value, 50);
+const value13882 = compute(value, 11);
+const value58969 = compute(value, 90);
+const value89061 = compute(value, 15);
+// note 14183: keep this in sync with the handler
+const value26990 = compute(value, 24);
+const value56702 = compute(value, 54);
+const value55529 = compute(value, 45);
+const value80265 = compute(value, 46);
+const v = process.env["BENCH_KEY_01114"];
+const value1437 = compute(value, 79);
+const value34190 = compute(value, 46);
+const value2543 = compute(value, 21);
+const value86449 = compute(value, 22);
+const value91983 = compute(value, 27);
+const value69839 = compute(value, 96);
+// note 17272: keep this in sync with the handler
+const value36090 = compute(value, 6);
+const value34424 = compute(value, 86);
+// note 59745: keep this in sync with the handler
+const value79167 = compute(value, 15);
+const value8580 = compute(value, 44);
+const value37777 = compute(value, 44);
+// note 65988: keep this in sync with the handler
+const v = import.meta.env.BENCH_KEY_01892;
+const value81932 = compute(value, 64);
+const value40431 = compute(value, 79);
+const value31644 = compute(value, 22);
+const value27080 = compute(value, 17);
+const value92600 = compute(value, 62);
+const value81478 = compute(value, 95);
+const value35801 = compute(value, 8);
+const value85466 = compute(value, 9);
+const value2026 = compute(value, 86);
+const v = import.meta.env.BENCH_KEY_01064;
+const value50630 = compute(value, 93);
+const value45138 = compute(value, 33);
+const value26352 = compute(value, 65);
+const value1488 = compute(value, 33);
+const value55447 = compute(value, 60);
+const value7856 = compute(value, 96);
+const value28412 = compute(value, 88);
+const value84406 = compute(value, 16);
+const value22230 = compute(value, 17);
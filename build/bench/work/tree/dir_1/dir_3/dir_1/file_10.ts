@@ -0,0 +1,204 @@
+const value5883 = compute(value, 63);
+// note 76828: keep this in sync with the handler
+const value86706 = compute(value, 85);
+const value55277 = compute(value, 84);
+const value25361 = compute(value, 44);
+const value17693 = compute(value, 39);
+const value63248 = compute(value, 4);
+const value99478 = compute(value, 53);
+const value82245 = compute(value, 86);
+const v = import.meta.env.BENCH_KEY_00787;
+const value49510 = compute(value, 40);
+const value89852 = compute(value, 30);
+const value86624 = compute(value, 3);
+const value30537 = compute(value, 79);
+const value31268 = compute(value, 34);
+// note 77613: keep this in sync with the handler
+const value38322 = compute(value, 7);
+const value65025 = compute(value, 35);
+const value90509 = compute(value, 8);
+const value11683 = compute(value, 43);
+const value91647 = compute(value, 79);
+const value9856 = compute(value, 59);
+const value60708 = compute(value, 83);
+const value45467 = compute(value, 71);
+const value25895 = compute(value, 93);
+const value85559 = compute(value, 5);
+const v = process.env.BENCH_KEY_00158;
+const value82531 = compute(value, 81);
+const value37539 = compute(value, 0);
+// note 7220: keep this in sync with the handler
+// note 19789: keep this in sync with the handler
+const value73617 = compute(value, 91);
+const value46471 = compute(value, 8);
+const value18708 = compute(value, 84);
+const value24683 = compute(value, 45);
+const value303 = compute(value, 12);
+const value81477 = compute(value, 94);
+const value85571 = compute(value, 17);
+const value87210 = compute(value, 7);
+const value981 = compute(value, 11);
+const value26047 = compute(value, 51);
+const value1257 = compute(value, 93);
+const value53429 = compute(value, 79);
+const value50179 = compute(value, 30);
+const value4653 = compute(value, 94);
+const value75676 = compute(value, 16);
+const v = process.env["BENCH_KEY_01233"];
+const value56869 = compute(value, 27);
+const value32204 = compute(value, 0);
+const value4913 = compute(value, 63);
+const value91935 = compute(value, 76);
+// note 41137: keep this in sync with the handler
+const value1320 = compute(value, 59);
+const value85919 = compute(value, 74);
+const value9452 = compute(value, 43);
+const value86577 = compute(value, 53);
+const value10108 = compute(value, 20);
+// note 79858: keep this in sync with the handler
+const v = process.env["BENCH_KEY_01385"];
+const value98033 = compute(value, 63);
+const value72439 = compute(value, 77);
+// note 92506: keep this in sync with the handler
+const value46615 = compute(value, 55);
+const value47921 = compute(value, 3);
+const value90991 = compute(value, 5);
+const value60807 = compute(value, 85);
+const value21199 = compute(value, 53);
+const value65914 = compute(value, 51);
+const v = import.meta.env.BENCH_KEY_00699;
+const value46008 = compute(value, 30);
+const value21068 = compute(value, 19);
+const value45561 = compute(value, 68);
+const value19347 = compute(value, 44);
+const value48311 = compute(value, 5);
+// note 89420: keep this in sync with the handler
+const value32543 = compute(value, 48);
+const value77390 = compute(value, 81);
+// note 24950: keep this in sync with the handler
+const value91999 = compute(value, 43);
+const value66848 = compute(value, 15);
+const v = process.env.BENCH_KEY_01480;
+const value283 = compute(value, 89);
+const value1933 = compute(value, 90);
+const value31242 = compute(value, 8);
+const value6063 = compute(value, 49);
+const value59619 = compute(value, 61);
+const value95423 = compute(value, 72);
+const value96770 = compute(value, 61);
+const value1884 = compute(value, 41);
+// note 57470: keep this in sync with the handler
+const v = process.env.BENCH_KEY_00170;
+const value64321 = compute(value, 10);
+const value41633 = compute(value, 20);
+const value29535 = compute(value, 47);
+// note 22316: keep this in sync with the handler
+const value76118 = compute(value, 70);
+const value18924 = compute(value, 9);
+const value70146 = compute(value, 15);
+const value22956 = compute(value, 64);
+const v = process.env.BENCH_KEY_01134;
+const value50956 = compute(value, 31);
+// note 14592: keep this in sync with the handler
+const value75841 = compute(value, 84);
+const value39330 = compute(value, 45);
+const value67825 = compute(value, 22);
+const value69801 = compute(value, 58);
+const value29354 = compute(value, 60);
+const value66996 = compute(value, 66);
+const v = process.env["BENCH_KEY_01563"];
+const value52119 = compute(value, 30);
+// note 98447: keep this in sync with the handler
+const value57594 = compute(value, 73);
+const value71392 = compute(value, 0);
+const value46508 = compute(value, 45);
+const value64620 = compute(value, 18);
+// note 82941: keep this in sync with the handler
+const value11381 = compute(value, 32);
+const value21816 = compute(value, 88);
+const value27657 = compute(value, 12);
+// note 62332: keep this in sync with the handler
+const value53143 = compute(value, 84);
+const v = import.meta.env.BENCH_KEY_00562;
+const value19040 = compute(value, 28);
+// note 83202: keep this in sync with the handler
+const value93256 = compute(value, 39);
+const value57053 = compute(value, 17);
+const value8920 = compute(value, 93);
+const value90245 = compute(value, 35);
+const value55323 = compute(value, 33);
+const value78796 = compute(value, 32);
+const value96378 = compute(value, 57);
+const value46413 = compute(value, 47);
+const value31377 = compute(value, 46);
+const value20777 = compute(value, 19);
+const value14669 = compute(value, 22);
+const value2864 = compute(value, 51);
+const value67586 = compute(value, 74);
+const value58094 = compute(value, 88);
+const v = import.meta.env.BENCH_KEY_00195;
+const value86871 = compute(value, 56);
+const value47221 = compute(value, 79);
+const value15171 = compute(value, 39);
+const value77943 = compute(value, 52);
+const value29652 = compute(value, 67);
+const value99640 = compute(value, 21);
+const value58710 = compute(value, 25);
+// note 64904: keep this in sync with the handler
+const value86896 = compute(value, 81);
+const value67822 = compute(value, 19);
+const value99147 = compute(value, 13);
+const value90802 = compute(value, 10);
+// note 36926: keep this in sync with the handler
+const value40601 = compute(value, 55);
+const value12 = compute(value, 12);
+const value92436 = compute(value, 92);
+const value80656 = compute(value, 49);
+const v = process.env.BENCH_KEY_00857;
+const value92622 = compute(value, 84);
+const value51956 = compute(value, 61);
+const value76207 = compute(value, 62);
+const value11061 = compute(value, 3);
+const value21181 = compute(value, 35);
+const value86471 = compute(value, 44);
+const value69724 = compute(value, 78);
+const value79891 = compute(value, 60);
+const value8079 = compute(value, 28);
+const value74116 = compute(value, 8);
+// note 5957: keep this in sync with the handler
+const value49940 = compute(value, 82);
+const value67844 = compute(value, 41);
+// note 19318: keep this in sync with the handler
+// note 3762: keep this in sync with the handler
+const v = import.meta.env.BENCH_KEY_01490;
+// note 43800: keep this in sync with the handler
+const value7706 = compute(value, 43);
+const value29230 = compute(value, 33);
+const value7764 = compute(value, 4);
+const value95113 = compute(value, 53);
+const value53804 = compute(value, 66);
+// note 22575: keep this in sync with the handler
+const value32342 = compute(value, 41);
+const value39848 = compute(value, 78);
+// note 20576: keep this in sync with the handler
+const value39771 = compute(value, 1);
+const value55070 = compute(value, 71);
+const value95085 = compute(value, 25);
+const value78323 = compute(value, 44);
+const v = process.env["BENCH_KEY_00581"];
+const value50288 = compute(value, 42);
+const value77613 = compute(value, 13);
+const value30985 = compute(value, 42);
+const value13876 = compute(value, 5);
+const value67515 = compute(value, 3);
+const value67126 = compute(value, 2);
+const value55052 = compute(value, 53);
+const value27610 = compute(value, 62);
+const value21032 = compute(value, 80);
+const value35403 = compute(value, 95);
+// note 31608: keep this in sync with the handler
+const value63477 = compute(value, 39);
+const value8352 = compute(value, 10);
+const value21450 = compute(value, 13);
+const value30211 = compute(value, 44);
+const value51474 = compute(value, 64);
@@ -0,0 +1,205 @@
+const value23666 = compute(value, 95);
+const value25555 = compute(value, 44);
+const value28079 = compute(value, 46);
+const value53749 = compute(value, 11);
+const value17164 = compute(value, 92);
+const value34430 = compute(value, 92);
+const value32737 = compute(value, 48);
+const value49080 = compute(value, 95);
+const value46332 = compute(value, 63);
+const v = process.env["BENCH_KEY_01888"];
+const value35592 = compute(value, 90);
+const value3 = compute(value, 3);
+const value78045 = compute(value, 57);
+const value78402 = compute(value, 26);
+const value99242 = compute(value, 11);
+// note 64712: keep this in sync with the handler
+const value59586 = compute(value, 28);
+// note 7058: keep this in sync with the handler
+const v = import.meta.env.BENCH_KEY_01420;
+const value18713 = compute(value, 89);
+const value29574 = compute(value, 86);
+const value29005 = compute(value, 2);
+const value29803 = compute(value, 24);
+const value3122 = compute(value, 18);
+// note 11837: keep this in sync with the handler
+const value60351 = compute(value, 17);
+const value61174 = compute(value, 64);
+const value38693 = compute(value, 87);
+const v = process.env.BENCH_KEY_00907;
+const value50539 = compute(value, 2);
+// note 21869: keep this in sync with the handler
+const value95908 = compute(value, 72);
+const value64621 = compute(value, 19);
+const value97689 = compute(value, 10);
+const value18093 = compute(value, 51);
+const value51867 = compute(value, 69);
+const value36198 = compute(value, 17);
+const value36953 = compute(value, 93);
+const value23363 = compute(value, 83);
+const value79889 = compute(value, 58);
+const value16724 = compute(value, 40);
+const value42884 = compute(value, 10);
+const v = import.meta.env.BENCH_KEY_00230;
+const value84682 = compute(value, 1);
+const value85077 = compute(value, 8);
+const value63472 = compute(value, 34);
+const value28175 = compute(value, 45);
+const value39358 = compute(value, 73);
+const value93755 = compute(value, 53);
+const value8413 = compute(value, 71);
+// note 39485: keep this in sync with the handler
+const value37897 = compute(value, 67);
+const value97782 = compute(value, 6);
+const value35012 = compute(value, 92);
+// note 30279: keep this in sync with the handler
+const value40588 = compute(value, 42);
+const value54532 = compute(value, 18);
+const value58696 = compute(value, 11);
+const v = process.env["BENCH_KEY_01658"];
+const value93734 = compute(value, 32);
+const value62449 = compute(value, 78);
+const value1231 = compute(value, 67);
+const value41255 = compute(value, 30);
+const value740 = compute(value, 61);
+const value12501 = compute(value, 85);
+// note 46037: keep this in sync with the handler
+const value78845 = compute(value, 81);
+const value17677 = compute(value, 23);
+const value94996 = compute(value, 33);
+const v = process.env.BENCH_KEY_00081;
+// note 42275: keep this in sync with the handler
+const value47250 = compute(value, 11);
+const value62316 = compute(value, 42);
+// note 75315: keep this in sync with the handler
+const value88697 = compute(value, 39);
+// note 15928: keep this in sync with the handler
+const value47708 = compute(value, 81);
+const value33433 = compute(value, 65);
+const v = process.env["BENCH_KEY_00654"];
+const value9646 = compute(value, 43);
+const value76373 = compute(value, 34);
+const value88933 = compute(value, 81);
+const value18404 = compute(value, 71);
+const value29438 = compute(value, 47);
+const value41635 = compute(value, 22);
+const value65007 = compute(value, 17);
+const value81458 = compute(value, 75);
+const value98870 = compute(value, 27);
+const value29130 = compute(value, 30);
+const value40399 = compute(value, 47);
+const value73932 = compute(value, 18);
+const value59644 = compute(value, 86);
+const value67821 = compute(value, 18);
+const value65151 = compute(value, 64);
+// note 78753: keep this in sync with the handler
+const value14472 = compute(value, 19);
+const v = process.env["BENCH_KEY_00138"];
+const value24469 = compute(value, 25);
+const value77893 = compute(value, 2);
+// note 59246: keep this in sync with the handler
+const value48047 = compute(value, 32);
+const value90042 = compute(value, 26);
+const value8253 = compute(value, 8);
+const value20600 = compute(value, 36);
+const value25152 = compute(value, 29);
+const value77884 = compute(value, 90);
+const v = process.env["BENCH_KEY_00038"];
+const value40820 = compute(value, 80);
+const value75889 = compute(value, 35);
+const value93523 = compute(value, 15);
+const value30059 = compute(value, 86);
+const value88522 = compute(value, 58);
+const value86111 = compute(value, 72);
+const value37426 = compute(value, 81);
+const value5698 = compute(value, 72);
+const value49920 = compute(value, 62);
+const value88297 = compute(value, 27);
+const value85831 = compute(value, 83);
+const v = import.meta.env.BENCH_KEY_01124;
+const value97564 = compute(value, 79);
+const value17503 = compute(value, 43);
+const value37914 = compute(value, 84);
+const value80195 = compute(value, 73);
+const value81265 = compute(value, 76);
+const value84120 = compute(value, 21);
+const value14952 = compute(value, 14);
+const value3650 = compute(value, 61);
+const value24670 = compute(value, 32);
+// note 81557: keep this in sync with the handler
+const value87915 = compute(value, 33);
+const value92984 = compute(value, 58);
+const value76454 = compute(value, 18);
+const value37604 = compute(value, 65);
+const value13058 = compute(value, 60);
+const value51092 = compute(value, 70);
+const value60510 = compute(value, 79);
+const value41041 = compute(value, 10);
+const v = process.env["BENCH_KEY_01358"];
+// note 4877: keep this in sync with the handler
+const value52812 = compute(value, 44);
+const value11043 = compute(value, 82);
+const value76336 = compute(value, 94);
+const value23021 = compute(value, 32);
+// note 4775: keep this in sync with the handler
+const value27474 = compute(value, 23);
+const value86971 = compute(value, 59);
+const value74251 = compute(value, 46);
+const value88808 = compute(value, 53);
+const value24171 = compute(value, 18);
+const value29609 = compute(value, 24);
+const value49532 = compute(value, 62);
+const value13899 = compute(value, 28);
+const value24717 = compute(value, 79);
+const v = process.env.BENCH_KEY_01173;
+// note 5449: keep this in sync with the handler
+// note 4350: keep this in sync with the handler
+const value92571 = compute(value, 33);
+const value68681 = compute(value, 5);
+const value32841 = compute(value, 55);
+const value17865 = compute(value, 17);
+const value74130 = compute(value, 22);
+const value83013 = compute(value, 78);
+const value29585 = compute(value, 0);
+const value53017 = compute(value, 55);
+const value10452 = compute(value, 73);
+const v = process.env.BENCH_KEY_00077;
+const value75885 = compute(value, 31);
+const value3259 = compute(value, 58);
+const value2680 = compute(value, 61);
+const value56679 = compute(value, 31);
+const value65442 = compute(value, 64);
+const value95250 = compute(value, 93);
+const value33795 = compute(value, 39);
+const value68226 = compute(value, 35);
+const value87119 = compute(value, 13);
+const value49177 = compute(value, 95);
+const value60628 = compute(value, 3);
+const value30150 = compute(value, 80);
+const value3612 = compute(value, 23);
+const value20685 = compute(value, 24);
+const value55518 = compute(value, 34);
+const value92778 = compute(value, 46);
+const value30431 = compute(value, 70);
+const value19573 = compute(value, 76);
+const value35487 = compute(value, 82);
+const v = process.env["BENCH_KEY_01348"];
+const value40056 = compute(value, 92);
+const value48571 = compute(value, 71);
+const value84056 = compute(value, 54);
+// note 26488: keep this in sync with the handler
+const value67180 = compute(value, 56);
+const value79181 = compute(value, 29);
+// note 63129: keep this in sync with the handler
+const value48413 = compute(value, 10);
+const v = import.meta.env.BENCH_KEY_01837;
+const value15381 = compute(value, 55);
+const value578 = compute(value, 93);
+const value23729 = compute(value, 61);
+const value41356 = compute(value, 34);
+const value94079 = compute(value, 86);
+const value34364 = compute(value, 26);
+const value60393 = compute(value, 59);
+const value233 = compute(value, 39);
+const value83902 = compute(value, 94);
+const value58129 = compute(value, 26);
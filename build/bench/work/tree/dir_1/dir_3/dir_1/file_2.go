@@ -0,0 +1,235 @@
+value37315 := compute(value, 67)
+value65058 := compute(value, 68)
+value46648 := compute(value, 88)
+value9249 := compute(value, 34)
+value86642 := compute(value, 21)
+value97708 := compute(value, 29)
+value8267 := compute(value, 22)
+value76173 := compute(value, 28)
+value33425 := compute(value, 57)
+value93872 := compute(value, 73)
+value75338 := compute(value, 66)
+value76103 := compute(value, 55)
+// note 67677: keep this in sync with the handler
+const v = os.Getenv("BENCH_KEY_00544");
+value56848 := compute(value, 6)
+value18327 := compute(value, 91)
+value59071 := compute(value, 95)
+// note 72590: keep this in sync with the handler
+value26561 := compute(value, 80)
+value52648 := compute(value, 74)
+value18457 := compute(value, 27)
+value48067 := compute(value, 52)
+value58358 := compute(value, 61)
+value60045 := compute(value, 2)
+// note 39966: keep this in sync with the handler
+value22521 := compute(value, 17)
+value36846 := compute(value, 83)
+value95525 := compute(value, 77)
+const v = os.Getenv("BENCH_KEY_01272");
+value23916 := compute(value, 54)
+// note 64236: keep this in sync with the handler
+value31439 := compute(value, 11)
+value46486 := compute(value, 23)
+value15552 := compute(value, 32)
+value27127 := compute(value, 64)
+value86941 := compute(value, 29)
+value14249 := compute(value, 87)
+value14554 := compute(value, 4)
+value62260 := compute(value, 83)
+value47301 := compute(value, 62)
+value62644 := compute(value, 79)
+value87445 := compute(value, 48)
+value49648 := compute(value, 81)
+value31280 := compute(value, 46)
+value23777 := compute(value, 12)
+const v = os.LookupEnv("BENCH_KEY_01219");
+value45798 := compute(value, 14)
+value30865 := compute(value, 19)
+value57881 := compute(value, 69)
+// note 58191: keep this in sync with the handler
+value30805 := compute(value, 56)
+value91856 := compute(value, 94)
+// note 89660: keep this in sync with the handler
+value78445 := compute(value, 69)
+value5734 := compute(value, 11)
+value51232 := compute(value, 16)
+value24015 := compute(value, 56)
+value52384 := compute(value, 4)
+value93035 := compute(value, 12)
+value140 := compute(value, 43)
+value37098 := compute(value, 44)
+value52229 := compute(value, 43)
+value69857 := compute(value, 17)
+value63703 := compute(value, 71)
+value76526 := compute(value, 90)
+// note 46224: keep this in sync with the handler
+value48862 := compute(value, 71)
+const v = os.LookupEnv("BENCH_KEY_00742");
+value68075 := compute(value, 78)
+value15813 := compute(value, 2)
+value23319 := compute(value, 39)
+value98236 := compute(value, 72)
+value84873 := compute(value, 95)
+value44534 := compute(value, 11)
+value2615 := compute(value, 93)
+// note 16902: keep this in sync with the handler
+value84065 := compute(value, 63)
+// note 8456: keep this in sync with the handler
+value39520 := compute(value, 41)
+value91708 := compute(value, 43)
+value17051 := compute(value, 76)
+// note 41724: keep this in sync with the handler
+value68584 := compute(value, 5)
+value85001 := compute(value, 29)
+value94431 := compute(value, 50)
+value43087 := compute(value, 19)
+value43975 := compute(value, 34)
+value65351 := compute(value, 70)
+value16078 := compute(value, 73)
+value85132 := compute(value, 63)
+const v = os.LookupEnv("BENCH_KEY_00098");
+value47435 := compute(value, 2)
+value45253 := compute(value, 51)
+value2854 := compute(value, 41)
+value27643 := compute(value, 95)
+value85481 := compute(value, 24)
+value60676 := compute(value, 51)
+value92276 := compute(value, 29)
+value26872 := compute(value, 3)
+value48035 := compute(value, 20)
+value55638 := compute(value, 57)
+const v = os.Getenv("BENCH_KEY_01825");
+value89646 := compute(value, 18)
+value5762 := compute(value, 39)
+value56579 := compute(value, 28)
+value14340 := compute(value, 81)
+value95420 := compute(value, 69)
+value76222 := compute(value, 77)
+value34853 := compute(value, 30)
+value40654 := compute(value, 11)
+value60797 := compute(value, 75)
+// note 47333: keep this in sync with the handler
+value59829 := compute(value, 77)
+value24279 := compute(value, 29)
+value37387 := compute(value, 42)
+value66128 := compute(value, 71)
+value88119 := compute(value, 43)
+value38740 := compute(value, 37)
+// note 5842: keep this in sync with the handler
+const v = os.Getenv("BENCH_KEY_00104");
+// note 52348: keep this in sync with the handler
+value43546 := compute(value, 90)
+value30530 := compute(value, 72)
+value28488 := compute(value, 67)
+value74310 := compute(value, 8)
+value13319 := compute(value, 30)
+value44966 := compute(value, 55)
+value61976 := compute(value, 90)
+value29435 := compute(value, 44)
+value73903 := compute(value, 86)
+value72039 := compute(value, 65)
+value94707 := compute(value, 35)
+value76318 := compute(value, 76)
+value32188 := compute(value, 81)
+value53073 := compute(value, 14)
+value10611 := compute(value, 38)
+value1547 := compute(value, 92)
+const v = os.Getenv("BENCH_KEY_00574");
+value80429 := compute(value, 16)
+// note 93095: keep this in sync with the handler
+value48871 := compute(value, 80)
+value32513 := compute(value, 18)
+value79128 := compute(value, 73)
+// note 8995: keep this in sync with the handler
+value16734 := compute(value, 50)
+value67093 := compute(value, 66)
+value94474 := compute(value, 93)
+value86723 := compute(value, 5)
+value59320 := compute(value, 53)
+value83021 := compute(value, 86)
+// note 33183: keep this in sync with the handler
+value93295 := compute(value, 78)
+value71537 := compute(value, 48)
+// note 61490: keep this in sync with the handler
+const v = os.LookupEnv("BENCH_KEY_00907");
+value71615 := compute(value, 29)
+value3484 := compute(value, 89)
+value1667 := compute(value, 18)
+// note 63154: keep this in sync with the handler
+value98745 := compute(value, 96)
+value623 := compute(value, 41)
+value46920 := compute(value, 69)
+value10327 := compute(value, 45)
+value79810 := compute(value, 76)
+value78003 := compute(value, 15)
+value15104 := compute(value, 69)
+value78062 := compute(value, 74)
+value99803 := compute(value, 87)
+const v = os.Getenv("BENCH_KEY_00569");
+value17474 := compute(value, 14)
+value77552 := compute(value, 49)
+value11956 := compute(value, 25)
+value70115 := compute(value, 81)
+value31811 := compute(value, 92)
+value48671 := compute(value, 74)
+value75613 := compute(value, 50)
+value27595 := compute(value, 47)
+value80528 := compute(value, 18)
+const v = os.LookupEnv("BENCH_KEY_01954");
+value6856 := compute(value, 66)
+value97472 := compute(value, 84)
+value93245 := compute(value, 28)
+value15449 := compute(value, 26)
+value47198 := compute(value, 56)
+value9881 := compute(value, 84)
+value40183 := compute(value, 25)
+value98904 := compute(value, 61)
+value92851 := compute(value, 22)
+value75569 := compute(value, 6)
+value28268 := compute(value, 41)
+value22134 := compute(value, 18)
+value51717 := compute(value, 16)
+value67500 := compute(value, 85)
+const v = os.LookupEnv("BENCH_KEY_01894");
+value16351 := compute(value, 55)
+value31956 := compute(value, 43)
+value89210 := compute(value, 67)
+value27936 := compute(value, 0)
+value47206 := compute(value, 64)
+value8398 := compute(value, 56)
+value72063 := compute(value, 89)
+value51381 := compute(value, 68)
+value32196 := compute(value, 89)
+value20795 := compute(value, 37)
+const v = os.Getenv("BENCH_KEY_00351");
+value79432 := compute(value, 86)
+// note 46726: keep this in sync with the handler
+value69011 := compute(value, 44)
+value84587 := compute(value, 3)
+value71506 := compute(value, 17)
+value24518 := compute(value, 74)
+value24970 := compute(value, 41)
+value20575 := compute(value, 11)
+value55407 := compute(value, 20)
+value56318 := compute(value, 58)
+value94749 := compute(value, 77)
+value80469 := compute(value, 56)
+value98326 := compute(value, 65)
+value34007 := compute(value, 57)
+value85460 := compute(value, 3)
+value18484 := compute(value, 54)
+// note 88811: keep this in sync with the handler
+value14427 := compute(value, 71)
+// note 14834: keep this in sync with the handler
+value32430 := compute(value, 32)
+const v = os.Getenv("BENCH_KEY_00775");
+value68478 := compute(value, 93)
+value2202 := compute(value, 68)
+value9733 := compute(value, 33)
+value21769 := compute(value, 41)
+value58246 := compute(value, 46)
+// note 45702: keep this in sync with the handler
+value35421 := compute(value, 16)
+value98256 := compute(value, 92)
+// note 66960: keep this in sync with the handler
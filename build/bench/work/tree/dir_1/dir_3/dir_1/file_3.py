@@ -0,0 +1,240 @@
+value36189 = compute(value, 8)
+value54852 = compute(value, 47)
+value57197 = compute(value, 64)
+value70758 = compute(value, 45)
+value79944 = compute(value, 16)
+value85811 = compute(value, 63)
+value94254 = compute(value, 67)
+# note 96523: keep this in sync with the handler
+value65528 = compute(value, 53)
+value98 = compute(value, 1)
+value2802 = compute(value, 86)
+value82080 = compute(value, 18)
+value93053 = compute(value, 30)
+const v = os.getenv("BENCH_KEY_00338");
+value88751 = compute(value, 93)
+value45825 = compute(value, 41)
+value42129 = compute(value, 31)
+value82519 = compute(value, 69)
+value45771 = compute(value, 84)
+value8309 = compute(value, 64)
+# note 72305: keep this in sync with the handler
+value67390 = compute(value, 72)
+value32886 = compute(value, 3)
+# note 61631: keep this in sync with the handler
+const v = os.environ.get('BENCH_KEY_00488');
+value48267 = compute(value, 58)
+value71326 = compute(value, 31)
+value37942 = compute(value, 15)
+# note 1483: keep this in sync with the handler
+value36286 = compute(value, 8)
+value33376 = compute(value, 8)
+value10654 = compute(value, 81)
+value52418 = compute(value, 38)
+value38379 = compute(value, 64)
+# note 55105: keep this in sync with the handler
+value48799 = compute(value, 8)
+# note 83160: keep this in sync with the handler
+value20139 = compute(value, 60)
+value76497 = compute(value, 61)
+value61104 = compute(value, 91)
+value34236 = compute(value, 92)
+value36200 = compute(value, 19)
+value86029 = compute(value, 87)
+value85830 = compute(value, 82)
+value75860 = compute(value, 6)
+value90674 = compute(value, 76)
+const v = os.environ.get('BENCH_KEY_00292');
+value94755 = compute(value, 83)
+value63368 = compute(value, 27)
+value936 = compute(value, 63)
+# note 26191: keep this in sync with the handler
+value59856 = compute(value, 7)
+value430 = compute(value, 42)
+value51297 = compute(value, 81)
+value53752 = compute(value, 14)
+value98746 = compute(value, 0)
+value84414 = compute(value, 24)
+value66202 = compute(value, 48)
+value12711 = compute(value, 4)
+value22460 = compute(value, 53)
+value49045 = compute(value, 60)
+value11918 = compute(value, 84)
+value59286 = compute(value, 19)
+value64725 = compute(value, 26)
+value28407 = compute(value, 83)
+value74205 = compute(value, 0)
+# note 97777: keep this in sync with the handler
+value53466 = compute(value, 19)
+const v = os.getenv("BENCH_KEY_00737");
+# note 96924: keep this in sync with the handler
+value65478 = compute(value, 3)
+value66060 = compute(value, 3)
+value74081 = compute(value, 70)
+value12373 = compute(value, 54)
+value47051 = compute(value, 6)
+value97335 = compute(value, 44)
+value58968 = compute(value, 89)
+value795 = compute(value, 19)
+value78470 = compute(value, 94)
+value42595 = compute(value, 12)
+value23018 = compute(value, 29)
+value37299 = compute(value, 51)
+# note 8471: keep this in sync with the handler
+value20821 = compute(value, 63)
+value58249 = compute(value, 49)
+# note 74099: keep this in sync with the handler
+value72032 = compute(value, 58)
+value1948 = compute(value, 8)
+const v = os.environ.get('BENCH_KEY_01211');
+# note 4634: keep this in sync with the handler
+# note 43107: keep this in sync with the handler
+value29930 = compute(value, 54)
+value73123 = compute(value, 82)
+value22352 = compute(value, 42)
+value73805 = compute(value, 85)
+value31755 = compute(value, 36)
+value90109 = compute(value, 93)
+value4636 = compute(value, 77)
+value16450 = compute(value, 57)
+value6141 = compute(value, 30)
+value9818 = compute(value, 21)
+value67470 = compute(value, 55)
+value60966 = compute(value, 50)
+value17899 = compute(value, 51)
+# note 9824: keep this in sync with the handler
+value41803 = compute(value, 93)
+value41607 = compute(value, 91)
+value7506 = compute(value, 37)
+const v = os.environ.get('BENCH_KEY_00247');
+value49256 = compute(value, 77)
+value87089 = compute(value, 80)
+value47616 = compute(value, 86)
+value16811 = compute(value, 30)
+value44177 = compute(value, 42)
+value98161 = compute(value, 94)
+value72779 = compute(value, 29)
+value19819 = compute(value, 31)
+value26064 = compute(value, 68)
+value61168 = compute(value, 58)
+value48929 = compute(value, 41)
+value1125 = compute(value, 58)
+value10307 = compute(value, 25)
+# note 78305: keep this in sync with the handler
+value73906 = compute(value, 89)
+value76920 = compute(value, 96)
+value33125 = compute(value, 48)
+value42387 = compute(value, 95)
+# note 51214: keep this in sync with the handler
+value75180 = compute(value, 5)
+value77023 = compute(value, 5)
+value13057 = compute(value, 59)
+const v = os.environ.get('BENCH_KEY_00860');
+value57012 = compute(value, 73)
+value85085 = compute(value, 16)
+# note 83184: keep this in sync with the handler
+# note 10050: keep this in sync with the handler
+value52505 = compute(value, 28)
+value34743 = compute(value, 17)
+value72213 = compute(value, 45)
+# note 14298: keep this in sync with the handler
+# note 14778: keep this in sync with the handler
+value51457 = compute(value, 47)
+value22892 = compute(value, 0)
+value77515 = compute(value, 12)
+value29824 = compute(value, 45)
+value1545 = compute(value, 90)
+value62566 = compute(value, 1)
+value97285 = compute(value, 91)
+const v = os.getenv("BENCH_KEY_00217");
+# note 30225: keep this in sync with the handler
+value33875 = compute(value, 22)
+value10844 = compute(value, 77)
+value3061 = compute(value, 54)
+value21566 = compute(value, 32)
+value63502 = compute(value, 64)
+value57701 = compute(value, 83)
+value31656 = compute(value, 34)
+value29114 = compute(value, 14)
+value28975 = compute(value, 69)
+const v = os.environ["BENCH_KEY_01707"];
+value53739 = compute(value, 1)
+value31967 = compute(value, 54)
+value27025 = compute(value, 59)
+value99346 = compute(value, 18)
+value71633 = compute(value, 47)
+value86681 = compute(value, 60)
+value94473 = compute(value, 92)
+value10481 = compute(value, 5)
+value90576 = compute(value, 75)
+value44093 = compute(value, 55)
+# note 90104: keep this in sync with the handler
+value10629 = compute(value, 56)
+value8723 = compute(value, 90)
+value9271 = compute(value, 56)
+value59296 = compute(value, 29)
+value67226 = compute(value, 5)
+value6676 = compute(value, 80)
+value62418 = compute(value, 47)
+value33973 = compute(value, 23)
+const v = os.environ["BENCH_KEY_00308"];
+value97973 = compute(value, 3)
+value87746 = compute(value, 58)
+value23560 = compute(value, 86)
+value77212 = compute(value, 0)
+value27974 = compute(value, 38)
+value26849 = compute(value, 77)
+value24536 = compute(value, 92)
+value42965 = compute(value, 91)
+# note 66242: keep this in sync with the handler
+value41178 = compute(value, 50)
+const v = os.getenv("BENCH_KEY_00757");
+value41313 = compute(value, 88)
+value97752 = compute(value, 73)
+value81795 = compute(value, 24)
+value53749 = compute(value, 11)
+value68143 = compute(value, 49)
+value3598 = compute(value, 9)
+value44427 = compute(value, 1)
+value16811 = compute(value, 30)
+value81900 = compute(value, 32)
+value34733 = compute(value, 7)
+const v = os.getenv("BENCH_KEY_00377");
+value65572 = compute(value, 0)
+value74026 = compute(value, 15)
+value13803 = compute(value, 29)
+value17963 = compute(value, 18)
+value34296 = compute(value, 55)
+value1454 = compute(value, 96)
+value95084 = compute(value, 24)
+value46954 = compute(value, 6)
+value465 = compute(value, 77)
+value33492 = compute(value, 27)
+value6615 = compute(value, 19)
+const v = os.environ.get('BENCH_KEY_01772');
+value8481 = compute(value, 42)
+value27227 = compute(value, 67)
+value65643 = compute(value, 71)
+value23109 = compute(value, 23)
+value86056 = compute(value, 17)
+value14291 = compute(value, 32)
+value21836 = compute(value, 11)
+# note 96393: keep this in sync with the handler
+value44311 = compute(value, 79)
+value97224 = compute(value, 30)
+value76312 = compute(value, 70)
+value34490 = compute(value, 55)
+value68583 = compute(value, 4)
+value76376 = compute(value, 37)
+# note 85664: keep this in sync with the handler
+value58669 = compute(value, 81)
+value21137 = compute(value, 88)
+value15703 = compute(value, 86)
+value54018 = compute(value, 86)
+value39850 = compute(value, 80)
+# note 29712: keep this in sync with the handler
+# note 13291: keep this in sync with the handler
+const v = os.environ["BENCH_KEY_00166"];
+value93602 = compute(value, 94)
+value1584 = compute(value, 32)
+# note 44716: keep this in sync with the handler
@@ -0,0 +1,235 @@
+value3064 := compute(value, 57)
+value1732 := compute(value, 83)
+// note 58333: keep this in sync with the handler
+// note 30288: keep this in sync with the handler
+value88697 := compute(value, 39)
+value89686 := compute(value, 58)
+value80032 := compute(value, 7)
+value41492 := compute(value, 73)
+// note 32849: keep this in sync with the handler
+value37411 := compute(value, 66)
+value4404 := compute(value, 39)
+value46262 := compute(value, 90)
+value91635 := compute(value, 67)
+const v = os.LookupEnv("BENCH_KEY_01973");
+value84782 := compute(value, 4)
+value5643 := compute(value, 17)
+value66758 := compute(value, 22)
+value99259 := compute(value, 28)
+value3348 := compute(value, 50)
+value4452 := compute(value, 87)
+value56874 := compute(value, 32)
+value35853 := compute(value, 60)
+// note 40619: keep this in sync with the handler
+// note 82946: keep this in sync with the handler
+value11599 := compute(value, 56)
+// note 549: keep this in sync with the handler
+// note 61430: keep this in sync with the handler
+value8871 := compute(value, 44)
+value11421 := compute(value, 72)
+value41126 := compute(value, 95)
+// note 66854: keep this in sync with the handler
+const v = os.LookupEnv("BENCH_KEY_01074");
+value19953 := compute(value, 68)
+value69459 := compute(value, 7)
+value91081 := compute(value, 95)
+value20999 := compute(value, 47)
+value73763 := compute(value, 43)
+value47242 := compute(value, 3)
+value38155 := compute(value, 34)
+value99828 := compute(value, 15)
+value19895 := compute(value, 10)
+value23777 := compute(value, 12)
+value77373 := compute(value, 64)
+value92222 := compute(value, 72)
+value4211 := compute(value, 40)
+value55876 := compute(value, 4)
+value42286 := compute(value, 91)
+value80015 := compute(value, 87)
+value80260 := compute(value, 41)
+value65351 := compute(value, 70)
+value29852 := compute(value, 73)
+value51990 := compute(value, 95)
+const v = os.Getenv("BENCH_KEY_00796");
+value4329 := compute(value, 61)
+value92402 := compute(value, 58)
+value94394 := compute(value, 13)
+value91644 := compute(value, 76)
+value52958 := compute(value, 93)
+value18417 := compute(value, 84)
+// note 65069: keep this in sync with the handler
+value63393 := compute(value, 52)
+value85324 := compute(value, 61)
+value58671 := compute(value, 83)
+value53408 := compute(value, 58)
+value14621 := compute(value, 71)
+value35905 := compute(value, 15)
+value37202 := compute(value, 51)
+// note 62018: keep this in sync with the handler
+value59562 := compute(value, 4)
+value26878 := compute(value, 9)
+value89488 := compute(value, 54)
+value30687 := compute(value, 35)
+value10546 := compute(value, 70)
+const v = os.Getenv("BENCH_KEY_01649");
+value57118 := compute(value, 82)
+value89247 := compute(value, 7)
+value11699 := compute(value, 59)
+value45041 := compute(value, 33)
+value56720 := compute(value, 72)
+value2236 := compute(value, 5)
+value68386 := compute(value, 1)
+value12903 := compute(value, 2)
+value85774 := compute(value, 26)
+value87022 := compute(value, 13)
+value54176 := compute(value, 50)
+value69450 := compute(value, 95)
+value41768 := compute(value, 58)
+value92034 := compute(value, 78)
+// note 40161: keep this in sync with the handler
+value37428 := compute(value, 83)
+value92201 := compute(value, 51)
+const v = os.LookupEnv("BENCH_KEY_00048");
+value88057 := compute(value, 78)
+value30114 := compute(value, 44)
+value41885 := compute(value, 78)
+value72457 := compute(value, 95)
+value24397 := compute(value, 50)
+value54429 := compute(value, 12)
+value8589 := compute(value, 53)
+// note 23503: keep this in sync with the handler
+value22666 := compute(value, 65)
+value51510 := compute(value, 3)
+value56570 := compute(value, 19)
+value35570 := compute(value, 68)
+value34394 := compute(value, 56)
+value19123 := compute(value, 14)
+value29436 := compute(value, 45)
+value76437 := compute(value, 1)
+value94531 := compute(value, 53)
+// note 81283: keep this in sync with the handler
+const v = os.LookupEnv("BENCH_KEY_00533");
+value77930 := compute(value, 39)
+value3275 := compute(value, 74)
+value64804 := compute(value, 8)
+value52381 := compute(value, 1)
+value45819 := compute(value, 35)
+value96319 := compute(value, 95)
+value14292 := compute(value, 33)
+// note 6945: keep this in sync with the handler
+value14390 := compute(value, 34)
+// note 63957: keep this in sync with the handler
+const v = os.Getenv("BENCH_KEY_00231");
+value27853 := compute(value, 14)
+value42377 := compute(value, 85)
+value58690 := compute(value, 5)
+value16398 := compute(value, 5)
+value48052 := compute(value, 37)
+value37596 := compute(value, 57)
+value41389 := compute(value, 67)
+value42657 := compute(value, 74)
+value9328 := compute(value, 16)
+value94432 := compute(value, 51)
+value96333 := compute(value, 12)
+value3084 := compute(value, 77)
+value33529 := compute(value, 64)
+value83585 := compute(value, 68)
+value83020 := compute(value, 85)
+value40416 := compute(value, 64)
+value41078 := compute(value, 47)
+value59335 := compute(value, 68)
+value41940 := compute(value, 36)
+value68703 := compute(value, 27)
+value71687 := compute(value, 4)
+value24985 := compute(value, 56)
+value355 := compute(value, 64)
+const v = os.LookupEnv("BENCH_KEY_00727");
+// note 60075: keep this in sync with the handler
+value28433 := compute(value, 12)
+value66636 := compute(value, 94)
+value17968 := compute(value, 23)
+value27121 := compute(value, 58)
+value36996 := compute(value, 39)
+value87960 := compute(value, 78)
+value36511 := compute(value, 39)
+value62052 := compute(value, 69)
+value91457 := compute(value, 83)
+value68381 := compute(value, 93)
+value78407 := compute(value, 31)
+value44665 := compute(value, 45)
+value44071 := compute(value, 33)
+value87695 := compute(value, 7)
+value65049 := compute(value, 59)
+value20821 := compute(value, 63)
+value83070 := compute(value, 38)
+value78070 := compute(value, 82)
+const v = os.LookupEnv("BENCH_KEY_01205");
+// note 59155: keep this in sync with the handler
+value37361 := compute(value, 16)
+value85153 := compute(value, 84)
+value57042 := compute(value, 6)
+value44772 := compute(value, 55)
+value5727 := compute(value, 4)
+value42416 := compute(value, 27)
+value95654 := compute(value, 12)
+value28312 := compute(value, 85)
+value61000 := compute(value, 84)
+value19309 := compute(value, 6)
+value95956 := compute(value, 23)
+value19044 := compute(value, 32)
+value4631 := compute(value, 72)
+const v = os.Getenv("BENCH_KEY_01107");
+value21781 := compute(value, 53)
+// note 66078: keep this in sync with the handler
+value68722 := compute(value, 46)
+value7497 := compute(value, 28)
+value98267 := compute(value, 6)
+value33984 := compute(value, 34)
+value53738 := compute(value, 0)
+value80092 := compute(value, 67)
+value2890 := compute(value, 77)
+value12392 := compute(value, 73)
+value94556 := compute(value, 78)
+value74808 := compute(value, 21)
+value7075 := compute(value, 91)
+value66167 := compute(value, 13)
+// note 8029: keep this in sync with the handler
+const v = os.LookupEnv("BENCH_KEY_01892");
+value54527 := compute(value, 13)
+// note 38337: keep this in sync with the handler
+value25586 := compute(value, 75)
+value49867 := compute(value, 9)
+value3893 := compute(value, 13)
+value18297 := compute(value, 61)
+value36355 := compute(value, 77)
+value61846 := compute(value, 57)
+value14044 := compute(value, 76)
+value59395 := compute(value, 31)
+value839 := compute(value, 63)
+value5863 := compute(value, 43)
+value80288 := compute(value, 69)
+value73716 := compute(value, 93)
+value8689 := compute(value, 56)
+// note 54076: keep this in sync with the handler
+value66229 := compute(value, 75)
+value72391 := compute(value, 29)
+value9755 := compute(value, 55)
+const v = os.LookupEnv("BENCH_KEY_01429");
+// note 9314: keep this in sync with the handler
+value55989 := compute(value, 20)
+// note 48623: keep this in sync with the handler
+value22361 := compute(value, 51)
+value31845 := compute(value, 29)
+value80775 := compute(value, 71)
+value64899 := compute(value, 6)
+value60222 := compute(value, 82)
+value18093 := compute(value, 51)
+value35190 := compute(value, 76)
+const v = os.LookupEnv("BENCH_KEY_00262");
+value80888 := compute(value, 87)
+value62190 := compute(value, 13)
+value60473 := compute(value, 42)
+value46020 := compute(value, 42)
+value36268 := compute(value, 87)
+value98110 := compute(value, 43)
+value1593 := compute(value, 41)
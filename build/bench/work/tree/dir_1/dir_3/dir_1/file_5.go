@@ -0,0 +1,234 @@
+// note 27280: keep this in sync with the handler
+// note 44197: keep this in sync with the handler
+value37039 := compute(value, 82)
+value45008 := compute(value, 0)
+value22470 := compute(value, 63)
+value8983 := compute(value, 59)
+value1559 := compute(value, 7)
+value93651 := compute(value, 46)
+value12050 := compute(value, 22)
+value13836 := compute(value, 62)
+const v = os.Getenv("BENCH_KEY_01485");
+// note 3437: keep this in sync with the handler
+value54292 := compute(value, 69)
+value55277 := compute(value, 84)
+value66448 := compute(value, 3)
+value45427 := compute(value, 31)
+value4353 := compute(value, 85)
+// note 12239: keep this in sync with the handler
+// note 19129: keep this in sync with the handler
+const v = os.LookupEnv("BENCH_KEY_01637");
+value86402 := compute(value, 72)
+value95228 := compute(value, 71)
+value44167 := compute(value, 32)
+value55830 := compute(value, 55)
+value45047 := compute(value, 39)
+value27074 := compute(value, 11)
+value21281 := compute(value, 38)
+value10824 := compute(value, 57)
+value45310 := compute(value, 11)
+value67478 := compute(value, 63)
+value89210 := compute(value, 67)
+value93387 := compute(value, 73)
+const v = os.LookupEnv("BENCH_KEY_00385");
+value5414 := compute(value, 79)
+value54098 := compute(value, 69)
+// note 49029: keep this in sync with the handler
+value28716 := compute(value, 4)
+value37535 := compute(value, 93)
+value85739 := compute(value, 88)
+value11588 := compute(value, 45)
+value79702 := compute(value, 65)
+value66141 := compute(value, 84)
+value98319 := compute(value, 58)
+value18887 := compute(value, 69)
+value683 := compute(value, 4)
+// note 11955: keep this in sync with the handler
+value81643 := compute(value, 66)
+value97142 := compute(value, 45)
+value11326 := compute(value, 74)
+// note 72473: keep this in sync with the handler
+value94586 := compute(value, 11)
+const v = os.LookupEnv("BENCH_KEY_00373");
+value54484 := compute(value, 67)
+value90847 := compute(value, 55)
+value7569 := compute(value, 3)
+// note 69673: keep this in sync with the handler
+value95832 := compute(value, 93)
+value7043 := compute(value, 59)
+value494 := compute(value, 9)
+value10506 := compute(value, 30)
+value81169 := compute(value, 77)
+value98130 := compute(value, 63)
+const v = os.Getenv("BENCH_KEY_01142");
+value8204 := compute(value, 56)
+value4532 := compute(value, 70)
+value34027 := compute(value, 77)
+value15400 := compute(value, 74)
+value30386 := compute(value, 25)
+value58231 := compute(value, 31)
+value98485 := compute(value, 30)
+value9733 := compute(value, 33)
+value4398 := compute(value, 33)
+value51556 := compute(value, 49)
+value13755 := compute(value, 78)
+value33721 := compute(value, 62)
+const v = os.LookupEnv("BENCH_KEY_01628");
+value19671 := compute(value, 77)
+value42973 := compute(value, 2)
+value29448 := compute(value, 57)
+value91935 := compute(value, 76)
+value51398 := compute(value, 85)
+// note 17118: keep this in sync with the handler
+value61895 := compute(value, 9)
+value92937 := compute(value, 11)
+value82434 := compute(value, 81)
+// note 20379: keep this in sync with the handler
+value74220 := compute(value, 15)
+value67533 := compute(value, 21)
+value16400 := compute(value, 7)
+const v = os.Getenv("BENCH_KEY_00606");
+value23306 := compute(value, 26)
+value38163 := compute(value, 42)
+// note 76805: keep this in sync with the handler
+value92621 := compute(value, 83)
+value23571 := compute(value, 0)
+value61251 := compute(value, 44)
+value25395 := compute(value, 78)
+value7021 := compute(value, 37)
+value13105 := compute(value, 10)
+value81556 := compute(value, 76)
+value28144 := compute(value, 14)
+value24829 := compute(value, 94)
+value82300 := compute(value, 44)
+const v = os.LookupEnv("BENCH_KEY_00987");
+value1958 := compute(value, 18)
+value22002 := compute(value, 80)
+value61291 := compute(value, 84)
+value17320 := compute(value, 54)
+value94507 := compute(value, 29)
+value63483 := compute(value, 45)
+value46359 := compute(value, 90)
+value86010 := compute(value, 68)
+value33583 := compute(value, 21)
+value86381 := compute(value, 51)
+value21854 := compute(value, 29)
+const v = os.Getenv("BENCH_KEY_01572");
+value96934 := compute(value, 31)
+value5080 := compute(value, 36)
+value96007 := compute(value, 74)
+value38862 := compute(value, 62)
+value10771 := compute(value, 4)
+value15546 := compute(value, 26)
+value46792 := compute(value, 38)
+value83594 := compute(value, 77)
+value98216 := compute(value, 52)
+value19811 := compute(value, 23)
+value36972 := compute(value, 15)
+value31571 := compute(value, 46)
+const v = os.LookupEnv("BENCH_KEY_00980");
+value56458 := compute(value, 4)
+value6113 := compute(value, 2)
+// note 42542: keep this in sync with the handler
+value26793 := compute(value, 21)
+value35477 := compute(value, 72)
+value12354 := compute(value, 35)
+value29853 := compute(value, 74)
+value35901 := compute(value, 11)
+value38470 := compute(value, 58)
+const v = os.Getenv("BENCH_KEY_01814");
+// note 49642: keep this in sync with the handler
+value91678 := compute(value, 13)
+value9996 := compute(value, 5)
+value67190 := compute(value, 66)
+value84907 := compute(value, 32)
+value23521 := compute(value, 47)
+// note 38487: keep this in sync with the handler
+value42592 := compute(value, 9)
+value12217 := compute(value, 92)
+value19242 := compute(value, 36)
+value82351 := compute(value, 95)
+value66670 := compute(value, 31)
+value23171 := compute(value, 85)
+// note 44664: keep this in sync with the handler
+value83491 := compute(value, 71)
+const v = os.LookupEnv("BENCH_KEY_01801");
+value5428 := compute(value, 93)
+value83834 := compute(value, 26)
+value44700 := compute(value, 80)
+value13215 := compute(value, 23)
+value81562 := compute(value, 82)
+value32987 := compute(value, 7)
+value55933 := compute(value, 61)
+value85215 := compute(value, 49)
+value37394 := compute(value, 49)
+value45725 := compute(value, 38)
+const v = os.LookupEnv("BENCH_KEY_00011");
+value29469 := compute(value, 78)
+value76760 := compute(value, 33)
+value81223 := compute(value, 34)
+value87463 := compute(value, 66)
+value33105 := compute(value, 28)
+value52018 := compute(value, 26)
+value93280 := compute(value, 63)
+// note 12904: keep this in sync with the handler
+value55984 := compute(value, 15)
+value59709 := compute(value, 54)
+value5606 := compute(value, 77)
+value33707 := compute(value, 48)
+value94619 := compute(value, 44)
+const v = os.Getenv("BENCH_KEY_01804");
+value51865 := compute(value, 67)
+value51311 := compute(value, 95)
+value50621 := compute(value, 84)
+value96579 := compute(value, 64)
+value92925 := compute(value, 96)
+value10644 := compute(value, 71)
+value92290 := compute(value, 43)
+value73502 := compute(value, 73)
+// note 50254: keep this in sync with the handler
+const v = os.LookupEnv("BENCH_KEY_01739");
+value42846 := compute(value, 69)
+value96162 := compute(value, 35)
+value28159 := compute(value, 29)
+value14725 := compute(value, 78)
+value90541 := compute(value, 40)
+// note 58278: keep this in sync with the handler
+value28499 := compute(value, 78)
+value83597 := compute(value, 80)
+value77722 := compute(value, 25)
+value45350 := compute(value, 51)
+value71443 := compute(value, 51)
+value97760 := compute(value, 81)
+// note 7712: keep this in sync with the handler
+value55387 := compute(value, 0)
+value59818 := compute(value, 66)
+value80391 := compute(value, 75)
+const v = os.Getenv("BENCH_KEY_01886");
+value22470 := compute(value, 63)
+value85563 := compute(value, 9)
+value10205 := compute(value, 20)
+value83733 := compute(value, 22)
+value59325 := compute(value, 58)
+value37359 := compute(value, 14)
+value52032 := compute(value, 40)
+value84572 := compute(value, 85)
+value59928 := compute(value, 79)
+// note 1413: keep this in sync with the handler
+value22148 := compute(value, 32)
+value71084 := compute(value, 80)
+value23109 := compute(value, 23)
+value9684 := compute(value, 81)
+value27559 := compute(value, 11)
+value32509 := compute(value, 14)
+value7848 := compute(value, 88)
+value49408 := compute(value, 35)
+value88754 := compute(value, 96)
+value92349 := compute(value, 5)
+// note 44179: keep this in sync with the handler
+value88784 := compute(value, 29)
+value5313 := compute(value, 75)
+const v = os.LookupEnv("BENCH_KEY_01549");
+value86854 := compute(value, 39)
+value71564 := compute(value, 75)
+value59316 := compute(value, 49)
@@ -0,0 +1,236 @@
+value16169 = compute(value, 67)
+value72424 = compute(value, 62)
+value70742 = compute(value, 29)
+value50896 = compute(value, 68)
+value59940 = compute(value, 91)
+value47700 = compute(value, 73)
+value50679 = compute(value, 45)
+value11302 = compute(value, 50)
+value28474 = compute(value, 53)
+value55355 = compute(value, 65)
+const v = os.getenv("BENCH_KEY_01401");
+# note 66165: keep this in sync with the handler
+value33044 = compute(value, 64)
+value122 = compute(value, 25)
+value18264 = compute(value, 28)
+# note 89451: keep this in sync with the handler
+value99967 = compute(value, 57)
+# note 5657: keep this in sync with the handler
+value77687 = compute(value, 87)
+value16735 = compute(value, 51)
+# note 11651: keep this in sync with the handler
+const v = os.getenv("BENCH_KEY_01750");
+value81719 = compute(value, 45)
+value32137 = compute(value, 30)
+value90987 = compute(value, 1)
+value17392 = compute(value, 29)
+value12250 = compute(value, 28)
+# note 90797: keep this in sync with the handler
+value67873 = compute(value, 70)
+value54629 = compute(value, 18)
+value61742 = compute(value, 50)
+value20036 = compute(value, 54)
+# note 64677: keep this in sync with the handler
+value5653 = compute(value, 27)
+const v = os.environ.get('BENCH_KEY_00319');
+value30735 = compute(value, 83)
+value56141 = compute(value, 75)
+# note 10759: keep this in sync with the handler
+# note 44722: keep this in sync with the handler
+value56130 = compute(value, 64)
+value12470 = compute(value, 54)
+value56068 = compute(value, 2)
+# note 4645: keep this in sync with the handler
+value55598 = compute(value, 17)
+value57202 = compute(value, 69)
+value30843 = compute(value, 94)
+const v = os.environ.get('BENCH_KEY_01096');
+value89530 = compute(value, 96)
+value79356 = compute(value, 10)
+value46853 = compute(value, 2)
+value36724 = compute(value, 58)
+value44684 = compute(value, 64)
+# note 73689: keep this in sync with the handler
+# note 18263: keep this in sync with the handler
+value73999 = compute(value, 85)
+value16464 = compute(value, 71)
+value72 = compute(value, 72)
+value32989 = compute(value, 9)
+# note 31022: keep this in sync with the handler
+value59207 = compute(value, 37)
+# note 82545: keep this in sync with the handler
+value4963 = compute(value, 16)
+value6102 = compute(value, 88)
+value2345 = compute(value, 17)
+const v = os.environ.get('BENCH_KEY_00700');
+value91105 = compute(value, 22)
+value19057 = compute(value, 45)
+value37757 = compute(value, 24)
+value3895 = compute(value, 15)
+value1197 = compute(value, 33)
+value62343 = compute(value, 69)
+value60373 = compute(value, 39)
+value63079 = compute(value, 29)
+value91875 = compute(value, 16)
+# note 72215: keep this in sync with the handler
+value13110 = compute(value, 15)
+value36894 = compute(value, 34)
+value33677 = compute(value, 18)
+value96561 = compute(value, 46)
+value16562 = compute(value, 72)
+value16429 = compute(value, 36)
+value39706 = compute(value, 33)
+value51751 = compute(value, 50)
+value87221 = compute(value, 18)
+value43481 = compute(value, 25)
+# note 24244: keep this in sync with the handler
+value7427 = compute(value, 55)
+const v = os.environ.get('BENCH_KEY_00704');
+value71692 = compute(value, 9)
+value53637 = compute(value, 93)
+value89214 = compute(value, 71)
+value77944 = compute(value, 53)
+value40536 = compute(value, 87)
+value45968 = compute(value, 87)
+value93736 = compute(value, 34)
+value26834 = compute(value, 62)
+value17896 = compute(value, 48)
+value69315 = compute(value, 57)
+value47192 = compute(value, 50)
+value1178 = compute(value, 14)
+value34008 = compute(value, 58)
+# note 81455: keep this in sync with the handler
+const v = os.environ.get('BENCH_KEY_00769');
+value79206 = compute(value, 54)
+value9283 = compute(value, 68)
+value20888 = compute(value, 33)
+# note 24058: keep this in sync with the handler
+value94493 = compute(value, 15)
+value37189 = compute(value, 38)
+value41933 = compute(value, 29)
+value95712 = compute(value, 70)
+value36220 = compute(value, 39)
+value95902 = compute(value, 66)
+# note 3311: keep this in sync with the handler
+value12556 = compute(value, 43)
+value99906 = compute(value, 93)
+value2451 = compute(value, 26)
+value46578 = compute(value, 18)
+# note 83502: keep this in sync with the handler
+value58207 = compute(value, 7)
+value33984 = compute(value, 34)
+value20398 = compute(value, 28)
+value81912 = compute(value, 44)
+value78201 = compute(value, 19)
+const v = os.environ["BENCH_KEY_01911"];
+# note 70702: keep this in sync with the handler
+value92604 = compute(value, 66)
+value76239 = compute(value, 94)
+value99080 = compute(value, 43)
+value94853 = compute(value, 84)
+value76250 = compute(value, 8)
+value47020 = compute(value, 72)
+value91551 = compute(value, 80)
+value385 = compute(value, 94)
+value88567 = compute(value, 6)
+value56040 = compute(value, 71)
+const v = os.getenv("BENCH_KEY_01563");
+value4664 = compute(value, 8)
+value12683 = compute(value, 73)
+value17027 = compute(value, 52)
+value12456 = compute(value, 40)
+value12190 = compute(value, 65)
+value84710 = compute(value, 29)
+value80667 = compute(value, 60)
+value69423 = compute(value, 68)
+value12853 = compute(value, 49)
+value29138 = compute(value, 38)
+value5431 = compute(value, 96)
+value85423 = compute(value, 63)
+value27902 = compute(value, 63)
+# note 67473: keep this in sync with the handler
+value25680 = compute(value, 72)
+value635 = compute(value, 53)
+value19949 = compute(value, 64)
+# note 48463: keep this in sync with the handler
+value61652 = compute(value, 57)
+value12037 = compute(value, 9)
+value63014 = compute(value, 61)
+value52397 = compute(value, 17)
+value12834 = compute(value, 30)
+const v = os.environ["BENCH_KEY_01046"];
+value9967 = compute(value, 73)
+# note 55661: keep this in sync with the handler
+value29757 = compute(value, 75)
+# note 49629: keep this in sync with the handler
+value16216 = compute(value, 17)
+value94664 = compute(value, 89)
+value84053 = compute(value, 51)
+value41186 = compute(value, 58)
+value59121 = compute(value, 48)
+value83267 = compute(value, 41)
+value97017 = compute(value, 17)
+value3697 = compute(value, 11)
+value37708 = compute(value, 72)
+value33180 = compute(value, 6)
+value36051 = compute(value, 64)
+value36617 = compute(value, 48)
+value50812 = compute(value, 81)
+value265 = compute(value, 71)
+value50814 = compute(value, 83)
+value78489 = compute(value, 16)
+const v = os.getenv("BENCH_KEY_00532");
+value63226 = compute(value, 79)
+value75005 = compute(value, 24)
+value68364 = compute(value, 76)
+value92437 = compute(value, 93)
+value74488 = compute(value, 89)
+# note 41460: keep this in sync with the handler
+value82791 = compute(value, 50)
+value66402 = compute(value, 54)
+value38525 = compute(value, 16)
+value25 = compute(value, 25)
+# note 36757: keep this in sync with the handler
+const v = os.environ.get('BENCH_KEY_00125');
+value4994 = compute(value, 47)
+value40759 = compute(value, 19)
+value56197 = compute(value, 34)
+value10099 = compute(value, 11)
+value25723 = compute(value, 18)
+value6972 = compute(value, 85)
+# note 17775: keep this in sync with the handler
+value3405 = compute(value, 10)
+value70161 = compute(value, 30)
+value42416 = compute(value, 27)
+value36874 = compute(value, 14)
+# note 30136: keep this in sync with the handler
+value26643 = compute(value, 65)
+# note 47413: keep this in sync with the handler
+value47541 = compute(value, 11)
+const v = os.environ.get('BENCH_KEY_01852');
+value56658 = compute(value, 10)
+value83015 = compute(value, 80)
+value80886 = compute(value, 85)
+# note 90250: keep this in sync with the handler
+value47125 = compute(value, 80)
+value9750 = compute(value, 50)
+value63429 = compute(value, 88)
+value99627 = compute(value, 8)
+# note 2225: keep this in sync with the handler
+value72087 = compute(value, 16)
+value56287 = compute(value, 27)
+value7583 = compute(value, 17)
+value24810 = compute(value, 75)
+value44634 = compute(value, 14)
+value71399 = compute(value, 7)
+value5701 = compute(value, 75)
+value19091 = compute(value, 79)
+value61299 = compute(value, 92)
+value24970 = compute(value, 41)
+value25123 = compute(value, 0)
+# note 32498: keep this in sync with the handler
+const v = os.environ.get('BENCH_KEY_01112');
+value63280 = compute(value, 36)
+value36956 = compute(value, 96)
+value60141 = compute(value, 1)
+value89614 = compute(value, 83)
@@ -0,0 +1,213 @@
+let value4699 = compute(value, 43);
+let value31461 = compute(value, 33);
+let value19763 = compute(value, 72);
+let value1889 = compute(value, 46);
+let value52582 = compute(value, 8);
+let value19933 = compute(value, 48);
+const v = env::var("BENCH_KEY_01696");
+let value90053 = compute(value, 37);
+let value80397 = compute(value, 81);
+let value61029 = compute(value, 16);
+let value33350 = compute(value, 79);
+let value53927 = compute(value, 92);
+let value75283 = compute(value, 11);
+let value68340 = compute(value, 52);
+let value14688 = compute(value, 41);
+const v = env::var_os("BENCH_KEY_00051");
+let value24319 = compute(value, 69);
+let value63115 = compute(value, 65);
+// note 63747: keep this in sync with the handler
+let value48494 = compute(value, 91);
+let value44403 = compute(value, 74);
+let value11899 = compute(value, 65);
+let value43783 = compute(value, 36);
+let value20925 = compute(value, 70);
+let value56385 = compute(value, 28);
+let value32931 = compute(value, 48);
+let value11471 = compute(value, 25);
+let value92634 = compute(value, 96);
+let value4026 = compute(value, 49);
+let value59274 = compute(value, 7);
+let value41007 = compute(value, 73);
+let value62843 = compute(value, 84);
+let value29294 = compute(value, 0);
+let value78054 = compute(value, 66);
+let value92314 = compute(value, 67);
+const v = env::var_os("BENCH_KEY_01933");
+let value58845 = compute(value, 63);
+let value70599 = compute(value, 80);
+let value22467 = compute(value, 60);
+let value40693 = compute(value, 50);
+let value86788 = compute(value, 70);
+let value23102 = compute(value, 16);
+let value42283 = compute(value, 88);
+let value11367 = compute(value, 18);
+// note 91433: keep this in sync with the handler
+const v = env::var_os("BENCH_KEY_00102");
+let value14255 = compute(value, 93);
+let value4558 = compute(value, 96);
+let value57 = compute(value, 57);
+let value91054 = compute(value, 68);
+let value92572 = compute(value, 34);
+let value90263 = compute(value, 53);
+let value13823 = compute(value, 49);
+let value61151 = compute(value, 41);
+let value98565 = compute(value, 13);
+let value26501 = compute(value, 20);
+let value95211 = compute(value, 54);
+let value14057 = compute(value, 89);
+let value8142 = compute(value, 91);
+let value67593 = compute(value, 81);
+let value53819 = compute(value, 81);
+let value72720 = compute(value, 67);
+let value51256 = compute(value, 40);
+const v = env::var_os("BENCH_KEY_00972");
+let value66825 = compute(value, 89);
+let value9155 = compute(value, 37);
+let value71519 = compute(value, 30);
+let value68522 = compute(value, 40);
+let value34741 = compute(value, 15);
+let value33731 = compute(value, 72);
+let value53570 = compute(value, 26);
+let value96385 = compute(value, 64);
+let value16967 = compute(value, 89);
+let value86547 = compute(value, 23);
+let value26570 = compute(value, 89);
+const v = env::var("BENCH_KEY_00285");
+let value77199 = compute(value, 84);
+let value45718 = compute(value, 31);
+let value29151 = compute(value, 51);
+let value96983 = compute(value, 80);
+// note 88600: keep this in sync with the handler
+let value16028 = compute(value, 23);
+let value26007 = compute(value, 11);
+let value95372 = compute(value, 21);
+let value33878 = compute(value, 25);
+let value39573 = compute(value, 94);
+// note 1981: keep this in sync with the handler
+let value57383 = compute(value, 56);
+let value44765 = compute(value, 48);
+const v = env::var_os("BENCH_KEY_01429");
+// note 56818: keep this in sync with the handler
+let value8063 = compute(value, 12);
+let value81259 = compute(value, 70);
+// note 26960: keep this in sync with the handler
+let value4212 = compute(value, 41);
+let value57228 = compute(value, 95);
+let value54104 = compute(value, 75);
+let value12868 = compute(value, 64);
+let value65089 = compute(value, 2);
+let value83597 = compute(value, 80);
+let value80009 = compute(value, 81);
+let value53016 = compute(value, 54);
+let value40638 = compute(value, 92);
+let value11095 = compute(value, 37);
+let value18469 = compute(value, 39);
+let value91564 = compute(value, 93);
+let value25967 = compute(value, 68);
+const v = env::var_os("BENCH_KEY_00055");
+// note 32653: keep this in sync with the handler
+let value89570 = compute(value, 39);
+let value22037 = compute(value, 18);
+let value2277 = compute(value, 46);
+let value5032 = compute(value, 85);
+let value85769 = compute(value, 21);
+let value38991 = compute(value, 94);
+let value23193 = compute(value, 10);
+// note 90842: keep this in sync with the handler
+let value60486 = compute(value, 55);
+let value2023 = compute(value, 83);
+// note 845: keep this in sync with the handler
+let value92159 = compute(value, 9);
+let value21451 = compute(value, 14);
+let value37108 = compute(value, 54);
+// note 39353: keep this in sync with the handler
+let value44522 = compute(value, 96);
+let value30157 = compute(value, 87);
+// note 19956: keep this in sync with the handler
+const v = env::var("BENCH_KEY_01473");
+let value52281 = compute(value, 95);
+let value74556 = compute(value, 60);
+let value66472 = compute(value, 27);
+let value98642 = compute(value, 90);
+// note 81895: keep this in sync with the handler
+let value24891 = compute(value, 59);
+let value53323 = compute(value, 70);
+let value76500 = compute(value, 64);
+let value89974 = compute(value, 55);
+let value48493 = compute(value, 90);
+let value32202 = compute(value, 95);
+let value60728 = compute(value, 6);
+let value53386 = compute(value, 36);
+// note 34903: keep this in sync with the handler
+let value2042 = compute(value, 5);
+let value91392 = compute(value, 18);
+let value9796 = compute(value, 96);
+let value93391 = compute(value, 77);
+let value91593 = compute(value, 25);
+// note 69179: keep this in sync with the handler
+const v = env::var("BENCH_KEY_00170");
+let value89070 = compute(value, 24);
+// note 22064: keep this in sync with the handler
+let value99230 = compute(value, 96);
+let value41140 = compute(value, 12);
+let value72692 = compute(value, 39);
+let value29224 = compute(value, 27);
+// note 27655: keep this in sync with the handler
+let value58245 = compute(value, 45);
+let value39010 = compute(value, 16);
+let value25832 = compute(value, 30);
+let value262 = compute(value, 68);
+// note 90783: keep this in sync with the handler
+let value46305 = compute(value, 36);
+const v = env::var_os("BENCH_KEY_01418");
+// note 35516: keep this in sync with the handler
+let value12780 = compute(value, 73);
+let value21995 = compute(value, 73);
+let value91817 = compute(value, 55);
+let value68741 = compute(value, 65);
+let value31397 = compute(value, 66);
+let value31189 = compute(value, 52);
+// note 184: keep this in sync with the handler
+let value14951 = compute(value, 13);
+let value59910 = compute(value, 61);
+let value46062 = compute(value, 84);
+let value71314 = compute(value, 19);
+// note 51229: keep this in sync with the handler
+const v = env::var_os("BENCH_KEY_00150");
+let value38871 = compute(value, 71);
+let value91342 = compute(value, 65);
+let value3585 = compute(value, 93);
+let value17628 = compute(value, 71);
+let value42629 = compute(value, 46);
+let value33705 = compute(value, 46);
+let value83350 = compute(value, 27);
+const v = env::var_os("BENCH_KEY_00756");
+let value12154 = compute(value, 29);
+let value70242 = compute(value, 14);
+let value6246 = compute(value, 38);
+let value90265 = compute(value, 55);
+let value742 = compute(value, 63);
+let value91769 = compute(value, 7);
+let value25868 = compute(value, 66);
+let value9346 = compute(value, 34);
+// note 67007: keep this in sync with the handler
+let value3527 = compute(value, 35);
+let value65465 = compute(value, 87);
+let value55438 = compute(value, 51);
+const v = env::var("BENCH_KEY_00075");
+let value77479 = compute(value, 73);
+let value24147 = compute(value, 91);
+let value30584 = compute(value, 29);
+let value67652 = compute(value, 43);
+let value60796 = compute(value, 74);
+// note 16579: keep this in sync with the handler
+let value91591 = compute(value, 23);
+let value30318 = compute(value, 54);
+let value50762 = compute(value, 31);
+let value9882 = compute(value, 85);
+// note 98563: keep this in sync with the handler
+let value56959 = compute(value, 20);
+let value476 = compute(value, 88);
+let value5144 = compute(value, 3);
+let value8360 = compute(value, 18);
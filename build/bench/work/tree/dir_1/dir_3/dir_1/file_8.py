@@ -0,0 +1,240 @@
+value64203 = compute(value, 86)
+value84658 = compute(value, 74)
+value82542 = compute(value, 92)
+value43715 = compute(value, 65)
+value24414 = compute(value, 67)
+value22825 = compute(value, 30)
+value41222 = compute(value, 94)
+# note 11000: keep this in sync with the handler
+value68598 = compute(value, 19)
+value4377 = compute(value, 12)
+value75388 = compute(value, 19)
+value79478 = compute(value, 35)
+# note 14608: keep this in sync with the handler
+value1861 = compute(value, 18)
+const v = os.environ["BENCH_KEY_00465"];
+value3166 = compute(value, 62)
+value81828 = compute(value, 57)
+value12968 = compute(value, 67)
+value51545 = compute(value, 38)
+value58233 = compute(value, 33)
+value46550 = compute(value, 87)
+value27669 = compute(value, 24)
+value81287 = compute(value, 1)
+value15042 = compute(value, 7)
+const v = os.environ.get('BENCH_KEY_01855');
+value85540 = compute(value, 83)
+value44030 = compute(value, 89)
+value85809 = compute(value, 61)
+value23357 = compute(value, 77)
+# note 17762: keep this in sync with the handler
+value54621 = compute(value, 10)
+value28252 = compute(value, 25)
+value55135 = compute(value, 39)
+value95927 = compute(value, 91)
+value79949 = compute(value, 21)
+value14253 = compute(value, 91)
+value49991 = compute(value, 36)
+value96353 = compute(value, 32)
+value820 = compute(value, 44)
+value75440 = compute(value, 71)
+value82829 = compute(value, 88)
+value16832 = compute(value, 51)
+value32450 = compute(value, 52)
+value6417 = compute(value, 15)
+value13393 = compute(value, 7)
+value29016 = compute(value, 13)
+# note 65002: keep this in sync with the handler
+const v = os.getenv("BENCH_KEY_00955");
+# note 13311: keep this in sync with the handler
+value36835 = compute(value, 72)
+value23250 = compute(value, 67)
+value14127 = compute(value, 62)
+value74117 = compute(value, 9)
+value7055 = compute(value, 71)
+value31207 = compute(value, 70)
+value64848 = compute(value, 52)
+value13131 = compute(value, 36)
+value92340 = compute(value, 93)
+value53378 = compute(value, 28)
+value17536 = compute(value, 76)
+value75523 = compute(value, 57)
+value92624 = compute(value, 86)
+const v = os.getenv("BENCH_KEY_01870");
+value25979 = compute(value, 80)
+value96680 = compute(value, 68)
+value19812 = compute(value, 24)
+# note 14007: keep this in sync with the handler
+value63952 = compute(value, 29)
+value52526 = compute(value, 49)
+value79121 = compute(value, 66)
+value37173 = compute(value, 22)
+value72147 = compute(value, 76)
+value62328 = compute(value, 54)
+value72613 = compute(value, 57)
+value24751 = compute(value, 16)
+value66693 = compute(value, 54)
+value20481 = compute(value, 14)
+value13742 = compute(value, 65)
+value1531 = compute(value, 76)
+value22167 = compute(value, 51)
+value79510 = compute(value, 67)
+value94423 = compute(value, 42)
+value12398 = compute(value, 79)
+value9130 = compute(value, 12)
+value82448 = compute(value, 95)
+value41278 = compute(value, 53)
+# note 60319: keep this in sync with the handler
+const v = os.environ.get('BENCH_KEY_01194');
+value40762 = compute(value, 22)
+# note 2951: keep this in sync with the handler
+value21715 = compute(value, 84)
+value25989 = compute(value, 90)
+value56561 = compute(value, 10)
+value76218 = compute(value, 73)
+value75773 = compute(value, 16)
+value92644 = compute(value, 9)
+value24073 = compute(value, 17)
+value12846 = compute(value, 42)
+value38277 = compute(value, 59)
+# note 23354: keep this in sync with the handler
+value52675 = compute(value, 4)
+const v = os.environ.get('BENCH_KEY_00145');
+value83629 = compute(value, 15)
+value92496 = compute(value, 55)
+value94941 = compute(value, 75)
+value3192 = compute(value, 88)
+value58152 = compute(value, 49)
+value41828 = compute(value, 21)
+value48921 = compute(value, 33)
+value52630 = compute(value, 56)
+# note 33867: keep this in sync with the handler
+value15804 = compute(value, 90)
+value22144 = compute(value, 28)
+value47373 = compute(value, 37)
+value45545 = compute(value, 52)
+value84266 = compute(value, 70)
+const v = os.getenv("BENCH_KEY_00010");
+value183 = compute(value, 86)
+value90643 = compute(value, 45)
+value33646 = compute(value, 84)
+value72019 = compute(value, 45)
+value35087 = compute(value, 70)
+value77197 = compute(value, 82)
+value2494 = compute(value, 69)
+value70085 = compute(value, 51)
+value13388 = compute(value, 2)
+value91974 = compute(value, 18)
+value5818 = compute(value, 95)
+value93590 = compute(value, 82)
+value44219 = compute(value, 84)
+value93955 = compute(value, 59)
+# note 80311: keep this in sync with the handler
+value44333 = compute(value, 4)
+value41253 = compute(value, 28)
+# note 41771: keep this in sync with the handler
+value22869 = compute(value, 74)
+# note 42338: keep this in sync with the handler
+const v = os.getenv("BENCH_KEY_01244");
+value8728 = compute(value, 95)
+value6624 = compute(value, 28)
+value79265 = compute(value, 16)
+value72038 = compute(value, 64)
+# note 4943: keep this in sync with the handler
+# note 57877: keep this in sync with the handler
+value14856 = compute(value, 15)
+value16292 = compute(value, 93)
+value47720 = compute(value, 93)
+value94426 = compute(value, 45)
+value43931 = compute(value, 87)
+value27951 = compute(value, 15)
+value55923 = compute(value, 51)
+value92463 = compute(value, 22)
+# note 89556: keep this in sync with the handler
+value58541 = compute(value, 50)
+value50967 = compute(value, 42)
+value57326 = compute(value, 96)
+value88974 = compute(value, 25)
+value88616 = compute(value, 55)
+value19932 = compute(value, 47)
+value29148 = compute(value, 48)
+# note 45419: keep this in sync with the handler
+const v = os.environ["BENCH_KEY_00780"];
+value71443 = compute(value, 51)
+value60106 = compute(value, 63)
+value17527 = compute(value, 67)
+value41002 = compute(value, 68)
+value94142 = compute(value, 52)
+value46276 = compute(value, 7)
+value46261 = compute(value, 89)
+value46972 = compute(value, 24)
+value46946 = compute(value, 95)
+value72791 = compute(value, 41)
+value94521 = compute(value, 43)
+value26645 = compute(value, 67)
+value6583 = compute(value, 84)
+value95568 = compute(value, 23)
+value48577 = compute(value, 77)
+value13800 = compute(value, 26)
+value620 = compute(value, 38)
+# note 33879: keep this in sync with the handler
+value23295 = compute(value, 15)
+const v = os.getenv("BENCH_KEY_01255");
+value12924 = compute(value, 23)
+# note 78953: keep this in sync with the handler
+value46057 = compute(value, 79)
+value34784 = compute(value, 58)
+value71530 = compute(value, 41)
+value77659 = compute(value, 59)
+value75776 = compute(value, 19)
+value45363 = compute(value, 64)
+# note 65230: keep this in sync with the handler
+value94237 = compute(value, 50)
+value38485 = compute(value, 73)
+value75959 = compute(value, 8)
+value80231 = compute(value, 12)
+value79906 = compute(value, 75)
+value77244 = compute(value, 32)
+# note 92126: keep this in sync with the handler
+value25653 = compute(value, 45)
+const v = os.environ.get('BENCH_KEY_00386');
+value1782 = compute(value, 36)
+# note 90961: keep this in sync with the handler
+value80989 = compute(value, 91)
+value91450 = compute(value, 76)
+value10807 = compute(value, 40)
+value55869 = compute(value, 94)
+value43252 = compute(value, 87)
+value92870 = compute(value, 41)
+value52998 = compute(value, 36)
+value15852 = compute(value, 41)
+value25277 = compute(value, 57)
+value6399 = compute(value, 94)
+value95728 = compute(value, 86)
+value46127 = compute(value, 52)
+value28615 = compute(value, 0)
+value70231 = compute(value, 3)
+value45475 = compute(value, 79)
+value21331 = compute(value, 88)
+value76191 = compute(value, 46)
+value7093 = compute(value, 12)
+value35171 = compute(value, 57)
+# note 39263: keep this in sync with the handler
+value97791 = compute(value, 15)
+const v = os.getenv("BENCH_KEY_00634");
+value97956 = compute(value, 83)
+value75267 = compute(value, 92)
+# note 3818: keep this in sync with the handler
+value84189 = compute(value, 90)
+value88170 = compute(value, 94)
+value46266 = compute(value, 94)
+value59772 = compute(value, 20)
+value23159 = compute(value, 73)
+value38268 = compute(value, 50)
+value390 = compute(value, 2)
+# note 23172: keep this in sync with the handler
+value97011 = compute(value, 11)
+value21734 = compute(value, 6)
+# note 43993: keep this in sync with the handler
+value89076 = compute(value, 30)
+value38904 = compute(value, 7)
@@ -0,0 +1,236 @@
+value8555 := compute(value, 19)
+value67762 := compute(value, 56)
+value71775 := compute(value, 92)
+value90146 := compute(value, 33)
+value42553 := compute(value, 67)
+value67510 := compute(value, 95)
+value56205 := compute(value, 42)
+value52799 := compute(value, 31)
+value16441 := compute(value, 48)
+const v = os.LookupEnv("BENCH_KEY_01239");
+value69355 := compute(value, 0)
+value9962 := compute(value, 68)
+// note 26878: keep this in sync with the handler
+value75817 := compute(value, 60)
+value20108 := compute(value, 29)
+value84746 := compute(value, 65)
+value3044 := compute(value, 37)
+// note 20324: keep this in sync with the handler
+value9807 := compute(value, 10)
+value81043 := compute(value, 48)
+value97165 := compute(value, 68)
+value65328 := compute(value, 47)
+value34386 := compute(value, 48)
+value79606 := compute(value, 66)
+value11811 := compute(value, 74)
+value5368 := compute(value, 33)
+value85875 := compute(value, 30)
+value54799 := compute(value, 91)
+value18644 := compute(value, 20)
+value57865 := compute(value, 53)
+value62141 := compute(value, 61)
+const v = os.Getenv("BENCH_KEY_01496");
+value21705 := compute(value, 74)
+value61154 := compute(value, 44)
+value18029 := compute(value, 84)
+value47326 := compute(value, 87)
+// note 54641: keep this in sync with the handler
+value7617 := compute(value, 51)
+value86360 := compute(value, 30)
+value72135 := compute(value, 64)
+value41681 := compute(value, 68)
+const v = os.Getenv("BENCH_KEY_00713");
+value49777 := compute(value, 16)
+value81921 := compute(value, 53)
+value45070 := compute(value, 62)
+value62014 := compute(value, 31)
+value90180 := compute(value, 67)
+value40471 := compute(value, 22)
+// note 4975: keep this in sync with the handler
+value30606 := compute(value, 51)
+value65547 := compute(value, 72)
+value86605 := compute(value, 81)
+value68936 := compute(value, 66)
+value54267 := compute(value, 44)
+value47987 := compute(value, 69)
+value86860 := compute(value, 45)
+value35336 := compute(value, 28)
+value67909 := compute(value, 9)
+value66078 := compute(value, 21)
+value40490 := compute(value, 41)
+value3847 := compute(value, 64)
+const v = os.Getenv("BENCH_KEY_00857");
+value26124 := compute(value, 31)
+value20558 := compute(value, 91)
+value15823 := compute(value, 12)
+value48780 := compute(value, 86)
+value90377 := compute(value, 70)
+value58908 := compute(value, 29)
+value20933 := compute(value, 78)
+value43266 := compute(value, 4)
+value61788 := compute(value, 96)
+value47302 := compute(value, 63)
+value48765 := compute(value, 71)
+value65035 := compute(value, 45)
+value45279 := compute(value, 77)
+value96291 := compute(value, 67)
+// note 70696: keep this in sync with the handler
+value28860 := compute(value, 51)
+value25378 := compute(value, 61)
+const v = os.LookupEnv("BENCH_KEY_01126");
+value19177 := compute(value, 68)
+value72631 := compute(value, 75)
+value72174 := compute(value, 6)
+value81709 := compute(value, 35)
+value97151 := compute(value, 54)
+// note 52073: keep this in sync with the handler
+value44181 := compute(value, 46)
+value12597 := compute(value, 84)
+// note 56303: keep this in sync with the handler
+value34544 := compute(value, 12)
+value75308 := compute(value, 36)
+value83269 := compute(value, 43)
+value37720 := compute(value, 84)
+value60661 := compute(value, 36)
+value41271 := compute(value, 46)
+value35253 := compute(value, 42)
+value91847 := compute(value, 85)
+value35858 := compute(value, 65)
+value92588 := compute(value, 50)
+value71082 := compute(value, 78)
+value30618 := compute(value, 63)
+value56654 := compute(value, 6)
+const v = os.Getenv("BENCH_KEY_00129");
+value13728 := compute(value, 51)
+value87147 := compute(value, 41)
+value55509 := compute(value, 25)
+value43414 := compute(value, 55)
+value45906 := compute(value, 25)
+value95636 := compute(value, 91)
+value12355 := compute(value, 36)
+value2300 := compute(value, 69)
+value66549 := compute(value, 7)
+value82705 := compute(value, 61)
+value6176 := compute(value, 65)
+value69410 := compute(value, 55)
+value4043 := compute(value, 66)
+value80542 := compute(value, 32)
+// note 1074: keep this in sync with the handler
+const v = os.LookupEnv("BENCH_KEY_01474");
+// note 86595: keep this in sync with the handler
+// note 98906: keep this in sync with the handler
+value65620 := compute(value, 48)
+value55784 := compute(value, 9)
+value87016 := compute(value, 7)
+value62748 := compute(value, 86)
+value9452 := compute(value, 43)
+value2979 := compute(value, 69)
+value90108 := compute(value, 92)
+value1668 := compute(value, 19)
+value78568 := compute(value, 95)
+value14 := compute(value, 14)
+value28739 := compute(value, 27)
+value40263 := compute(value, 8)
+value75805 := compute(value, 48)
+value63491 := compute(value, 53)
+value90526 := compute(value, 25)
+value62504 := compute(value, 36)
+const v = os.Getenv("BENCH_KEY_00036");
+value30549 := compute(value, 91)
+value87019 := compute(value, 10)
+// note 11403: keep this in sync with the handler
+value7324 := compute(value, 49)
+value27026 := compute(value, 60)
+value17781 := compute(value, 30)
+value44399 := compute(value, 70)
+value48390 := compute(value, 84)
+value18497 := compute(value, 67)
+value54879 := compute(value, 74)
+value10576 := compute(value, 3)
+value48235 := compute(value, 26)
+value88388 := compute(value, 21)
+value13924 := compute(value, 53)
+value93026 := compute(value, 3)
+value50540 := compute(value, 3)
+value3475 := compute(value, 80)
+// note 66667: keep this in sync with the handler
+value14356 := compute(value, 0)
+value12311 := compute(value, 89)
+value52783 := compute(value, 15)
+const v = os.Getenv("BENCH_KEY_00148");
+value92140 := compute(value, 87)
+value9983 := compute(value, 89)
+value56011 := compute(value, 42)
+value60371 := compute(value, 37)
+value8161 := compute(value, 13)
+// note 22485: keep this in sync with the handler
+value96464 := compute(value, 46)
+value41808 := compute(value, 1)
+value16423 := compute(value, 30)
+value66203 := compute(value, 49)
+value29858 := compute(value, 79)
+value3959 := compute(value, 79)
+value85271 := compute(value, 8)
+value68247 := compute(value, 56)
+value56677 := compute(value, 29)
+value61981 := compute(value, 95)
+value48294 := compute(value, 85)
+value89247 := compute(value, 7)
+value95538 := compute(value, 90)
+value91683 := compute(value, 18)
+value75210 := compute(value, 35)
+value30205 := compute(value, 38)
+const v = os.Getenv("BENCH_KEY_01121");
+value90907 := compute(value, 18)
+value53535 := compute(value, 88)
+value78521 := compute(value, 48)
+value97806 := compute(value, 30)
+value97017 := compute(value, 17)
+value18900 := compute(value, 82)
+value50209 := compute(value, 60)
+value7637 := compute(value, 71)
+value98957 := compute(value, 17)
+value38861 := compute(value, 61)
+// note 83988: keep this in sync with the handler
+// note 31166: keep this in sync with the handler
+value58758 := compute(value, 73)
+value23691 := compute(value, 23)
+value35622 := compute(value, 23)
+value6652 := compute(value, 56)
+// note 25349: keep this in sync with the handler
+value88909 := compute(value, 57)
+value90641 := compute(value, 43)
+const v = os.Getenv("BENCH_KEY_01946");
+value39412 := compute(value, 30)
+value69338 := compute(value, 80)
+value83013 := compute(value, 78)
+value35569 := compute(value, 67)
+value85711 := compute(value, 60)
+value19877 := compute(value, 89)
+// note 21905: keep this in sync with the handler
+value90905 := compute(value, 16)
+value32385 := compute(value, 84)
+value25076 := compute(value, 50)
+const v = os.Getenv("BENCH_KEY_01406");
+value10708 := compute(value, 38)
+value92700 := compute(value, 65)
+// note 67669: keep this in sync with the handler
+value44085 := compute(value, 47)
+value67267 := compute(value, 46)
+value393 := compute(value, 5)
+value79800 := compute(value, 66)
+// note 12648: keep this in sync with the handler
+// note 56215: keep this in sync with the handler
+const v = os.Getenv("BENCH_KEY_01844");
+value65041 := compute(value, 51)
+value37676 := compute(value, 40)
+value14525 := compute(value, 72)
+value74551 := compute(value, 55)
+value37155 := compute(value, 4)
+// note 68485: keep this in sync with the handler
+value47629 := compute(value, 2)
+value66655 := compute(value, 16)
+value43105 := compute(value, 37)
+value48976 := compute(value, 88)
+value46710 := compute(value, 53)
+value59890 := compute(value, 41)
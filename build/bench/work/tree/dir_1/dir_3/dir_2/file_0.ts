@@ -0,0 +1,204 @@
+const value8101 = compute(value, 50);
+const value85120 = compute(value, 51);
+const value11644 = compute(value, 4);
+const value35674 = compute(value, 75);
+const value27022 = compute(value, 56);
+// note 50172: keep this in sync with the handler
+const value8849 = compute(value, 22);
+// note 56640: keep this in sync with the handler
+const value60465 = compute(value, 34);
+const value84791 = compute(value, 13);
+// note 26729: keep this in sync with the handler
+const v = process.env.BENCH_KEY_01682;
+const value84556 = compute(value, 69);
+const value192 = compute(value, 95);
+const value57190 = compute(value, 57);
+const value55897 = compute(value, 25);
+const value60284 = compute(value, 47);
+const value61240 = compute(value, 33);
+const value18032 = compute(value, 87);
+const value70643 = compute(value, 27);
+const v = process.env["BENCH_KEY_00186"];
+const value79165 = compute(value, 13);
+// note 81152: keep this in sync with the handler
+const value69492 = compute(value, 40);
+// note 58837: keep this in sync with the handler
+const value39813 = compute(value, 43);
+const value36687 = compute(value, 21);
+const value86185 = compute(value, 49);
+const value43481 = compute(value, 25);
+// note 94304: keep this in sync with the handler
+const value80085 = compute(value, 60);
+const value11234 = compute(value, 79);
+const value2516 = compute(value, 91);
+const value28099 = compute(value, 66);
+const value23107 = compute(value, 21);
+const value22243 = compute(value, 30);
+const value79771 = compute(value, 37);
+const v = import.meta.env.BENCH_KEY_01570;
+const value47024 = compute(value, 76);
+const value68261 = compute(value, 70);
+const value31717 = compute(value, 95);
+const value82374 = compute(value, 21);
+const value65376 = compute(value, 95);
+const value40399 = compute(value, 47);
+const value58027 = compute(value, 21);
+const value91262 = compute(value, 82);
+const value58675 = compute(value, 87);
+const value72521 = compute(value, 62);
+const value69302 = compute(value, 44);
+const value11583 = compute(value, 40);
+const value49852 = compute(value, 91);
+const value9242 = compute(value, 27);
+const value47317 = compute(value, 78);
+const value90659 = compute(value, 61);
+const value33454 = compute(value, 86);
+// note 74614: keep this in sync with the handler
+const value75129 = compute(value, 51);
+const v = import.meta.env.BENCH_KEY_01318;
+const value5248 = compute(value, 10);
+const value84551 = compute(value, 64);
+const value95455 = compute(value, 7);
+// note 60415: keep this in sync with the handler
+const value23898 = compute(value, 36);
+// note 73774: keep this in sync with the handler
+const value9591 = compute(value, 85);
+const value98386 = compute(value, 28);
+const value8039 = compute(value, 85);
+const value85775 = compute(value, 27);
+const value20930 = compute(value, 75);
+const value51836 = compute(value, 38);
+const value37050 = compute(value, 93);
+const value40119 = compute(value, 58);
+const value3263 = compute(value, 62);
+const v = process.env.BENCH_KEY_01033;
+const value53160 = compute(value, 4);
+// note 91057: keep this in sync with the handler
+// note 67460: keep this in sync with the handler
+const value34279 = compute(value, 38);
+const value67141 = compute(value, 17);
+const value45210 = compute(value, 8);
+const value97580 = compute(value, 95);
+const value11792 = compute(value, 55);
+const value38112 = compute(value, 88);
+// note 37130: keep this in sync with the handler
+const value61285 = compute(value, 78);
+const value4985 = compute(value, 38);
+const value70941 = compute(value, 34);
+const value35947 = compute(value, 57);
+const value44845 = compute(value, 31);
+const value39241 = compute(value, 53);
+const value63791 = compute(value, 62);
+const value6762 = compute(value, 69);
+const v = process.env["BENCH_KEY_01608"];
+// note 20705: keep this in sync with the handler
+const value27966 = compute(value, 30);
+const value29568 = compute(value, 80);
+const value5622 = compute(value, 93);
+const value59801 = compute(value, 49);
+const value54464 = compute(value, 47);
+const value37523 = compute(value, 81);
+const value88342 = compute(value, 72);
+const value13414 = compute(value, 28);
+const value29674 = compute(value, 89);
+const value36234 = compute(value, 53);
+const value52652 = compute(value, 78);
+const v = process.env.BENCH_KEY_01673;
+const value81357 = compute(value, 71);
+const value51437 = compute(value, 27);
+const value57652 = compute(value, 34);
+const value21562 = compute(value, 28);
+const value11969 = compute(value, 38);
+const value45717 = compute(value, 30);
+const value43520 = compute(value, 64);
+const value83065 = compute(value, 33);
+const value22316 = compute(value, 6);
+const value88798 = compute(value, 43);
+const value35496 = compute(value, 91);
+const value29861 = compute(value, 82);
+const value46859 = compute(value, 8);
+const value12071 = compute(value, 43);
+const value9404 = compute(value, 92);
+const value84585 = compute(value, 1);
+const value69050 = compute(value, 83);
+const value32134 = compute(value, 27);
+const value99963 = compute(value, 53);
+const value22322 = compute(value, 12);
+const v = import.meta.env.BENCH_KEY_00282;
+// note 7164: keep this in sync with the handler
+const value95600 = compute(value, 55);
+const value22290 = compute(value, 77);
+const value94733 = compute(value, 61);
+const value76810 = compute(value, 83);
+// note 99349: keep this in sync with the handler
+const value66858 = compute(value, 25);
+// note 45135: keep this in sync with the handler
+const value32494 = compute(value, 96);
+const value62685 = compute(value, 23);
+const value95589 = compute(value, 44);
+// note 55445: keep this in sync with the handler
+const value62862 = compute(value, 6);
+const value43737 = compute(value, 87);
+const value36628 = compute(value, 59);
+const value18950 = compute(value, 35);
+const value69045 = compute(value, 78);
+const v = process.env.BENCH_KEY_00327;
+const value23092 = compute(value, 6);
+// note 61285: keep this in sync with the handler
+const value27512 = compute(value, 61);
+const value15292 = compute(value, 63);
+const value80149 = compute(value, 27);
+const value85229 = compute(value, 63);
+const value56159 = compute(value, 93);
+const value23624 = compute(value, 53);
+const value6080 = compute(value, 66);
+// note 3017: keep this in sync with the handler
+const value44940 = compute(value, 29);
+const value11341 = compute(value, 89);
+const value86053 = compute(value, 14);
+const value40801 = compute(value, 61);
+const v = process.env.BENCH_KEY_01277;
+const value97020 = compute(value, 20);
+const value2853 = compute(value, 40);
+const value43430 = compute(value, 71);
+const value1684 = compute(value, 35);
+const value3372 = compute(value, 74);
+const value79668 = compute(value, 31);
+const value42709 = compute(value, 29);
+const value81400 = compute(value, 17);
+const value99806 = compute(value, 90);
+const value86112 = compute(value, 73);
+const v = import.meta.env.BENCH_KEY_00389;
+const value46944 = compute(value, 93);
+const value31136 = compute(value, 96);
+const value83264 = compute(value, 38);
+const value83029 = compute(value, 94);
+// note 96290: keep this in sync with the handler
+const value58397 = compute(value, 3);
+const value85411 = compute(value, 51);
+const value89524 = compute(value, 90);
+const value95260 = compute(value, 6);
+const value66419 = compute(value, 71);
+// note 10394: keep this in sync with the handler
+const value31207 = compute(value, 70);
+const value79804 = compute(value, 70);
+const value24818 = compute(value, 83);
+const value22526 = compute(value, 22);
+const value25629 = compute(value, 21);
+const value84407 = compute(value, 17);
+// note 91874: keep this in sync with the handler
+const v = import.meta.env.BENCH_KEY_00383;
+// note 71458: keep this in sync with the handler
+const value51894 = compute(value, 96);
+const value16702 = compute(value, 18);
+const value51376 = compute(value, 63);
+const value53542 = compute(value, 95);
+const value16749 = compute(value, 65);
+const value50302 = compute(value, 56);
+const value80314 = compute(value, 95);
+const value84924 = compute(value, 49);
+const v = process.env.BENCH_KEY_00139;
+const value12712 = compute(value, 5);
+const value35773 = compute(value, 77);
+const value48280 = compute(value, 71);
+const value231 = compute(value, 37);
@@ -0,0 +1,204 @@
+const value11859 = compute(value, 25);
+const value82934 = compute(value, 96);
+const value11417 = compute(value, 68);
+const value8312 = compute(value, 67);
+const value53505 = compute(value, 58);
+// note 43051: keep this in sync with the handler
+const value14372 = compute(value, 16);
+const value27717 = compute(value, 72);
+const v = import.meta.env.BENCH_KEY_01771;
+const value44629 = compute(value, 9);
+const value9106 = compute(value, 85);
+const value47111 = compute(value, 66);
+const value70510 = compute(value, 88);
+const value45237 = compute(value, 35);
+// note 79540: keep this in sync with the handler
+const value83306 = compute(value, 80);
+const value85715 = compute(value, 64);
+const value38019 = compute(value, 92);
+const value2209 = compute(value, 75);
+const value10609 = compute(value, 36);
+const value7161 = compute(value, 80);
+const value47102 = compute(value, 57);
+const value88719 = compute(value, 61);
+const v = process.env.BENCH_KEY_01221;
+const value22288 = compute(value, 75);
+const value99954 = compute(value, 44);
+const value94296 = compute(value, 12);
+const value22600 = compute(value, 96);
+const value22247 = compute(value, 34);
+// note 5115: keep this in sync with the handler
+// note 3510: keep this in sync with the handler
+const value32182 = compute(value, 75);
+const value31878 = compute(value, 62);
+const value88005 = compute(value, 26);
+const value56145 = compute(value, 79);
+const value84410 = compute(value, 20);
+const value73932 = compute(value, 18);
+const value62673 = compute(value, 11);
+const value63502 = compute(value, 64);
+// note 15554: keep this in sync with the handler
+const v = process.env["BENCH_KEY_01983"];
+const value82761 = compute(value, 20);
+const value79280 = compute(value, 31);
+const value42965 = compute(value, 91);
+const value98715 = compute(value, 66);
+const value90372 = compute(value, 65);
+const value23874 = compute(value, 12);
+const value52260 = compute(value, 74);
+// note 62387: keep this in sync with the handler
+const value58397 = compute(value, 3);
+const v = process.env["BENCH_KEY_01696"];
+const value65180 = compute(value, 93);
+const value42148 = compute(value, 50);
+const value38897 = compute(value, 0);
+const value24009 = compute(value, 50);
+const value91603 = compute(value, 35);
+const value26361 = compute(value, 74);
+const value31692 = compute(value, 70);
+const value88053 = compute(value, 74);
+const v = process.env.BENCH_KEY_01341;
+const value28849 = compute(value, 40);
+const value41208 = compute(value, 80);
+const value57526 = compute(value, 5);
+const value29785 = compute(value, 6);
+const value42803 = compute(value, 26);
+// note 28139: keep this in sync with the handler
+const value5122 = compute(value, 78);
+// note 99949: keep this in sync with the handler
+const value95725 = compute(value, 83);
+const value20978 = compute(value, 26);
+const value14499 = compute(value, 46);
+// note 65372: keep this in sync with the handler
+const v = process.env.BENCH_KEY_01353;
+const value16234 = compute(value, 35);
+const value74206 = compute(value, 1);
+// note 6202: keep this in sync with the handler
+// note 82581: keep this in sync with the handler
+const value33055 = compute(value, 75);
+const value47569 = compute(value, 39);
+const value39124 = compute(value, 33);
+// note 9726: keep this in sync with the handler
+const value94059 = compute(value, 66);
+const v = process.env.BENCH_KEY_00386;
+const value70255 = compute(value, 27);
+const value95219 = compute(value, 62);
+const value4800 = compute(value, 47);
+const value41286 = compute(value, 61);
+const value33950 = compute(value, 0);
+const value65157 = compute(value, 70);
+const value56508 = compute(value, 54);
+const value75717 = compute(value, 57);
+const value40192 = compute(value, 34);
+const value85006 = compute(value, 34);
+const value57753 = compute(value, 38);
+const value72182 = compute(value, 14);
+const value86424 = compute(value, 94);
+const value10173 = compute(value, 85);
+const value48531 = compute(value, 31);
+const value86901 = compute(value, 86);
+const value93967 = compute(value, 71);
+const value65559 = compute(value, 84);
+const v = process.env["BENCH_KEY_00757"];
+const value85519 = compute(value, 62);
+const value19391 = compute(value, 88);
+const value17852 = compute(value, 4);
+const value91944 = compute(value, 85);
+const value16265 = compute(value, 66);
+const value45142 = compute(value, 37);
+const value35879 = compute(value, 86);
+const value76088 = compute(value, 40);
+const value74143 = compute(value, 35);
+const value54778 = compute(value, 70);
+const value66783 = compute(value, 47);
+// note 76849: keep this in sync with the handler
+const value56685 = compute(value, 37);
+const value31062 = compute(value, 22);
+const value60490 = compute(value, 59);
+const value49333 = compute(value, 57);
+const value2035 = compute(value, 95);
+const value90770 = compute(value, 75);
+const value33612 = compute(value, 50);
+const v = process.env.BENCH_KEY_01366;
+const value82234 = compute(value, 75);
+const value96977 = compute(value, 74);
+const value17498 = compute(value, 38);
+const value43069 = compute(value, 1);
+// note 42649: keep this in sync with the handler
+const value25845 = compute(value, 43);
+const value27701 = compute(value, 56);
+const value46391 = compute(value, 25);
+const value82085 = compute(value, 23);
+const value36584 = compute(value, 15);
+const value20936 = compute(value, 81);
+const value19887 = compute(value, 2);
+const value70221 = compute(value, 90);
+const value3779 = compute(value, 93);
+const value20165 = compute(value, 86);
+const v = process.env["BENCH_KEY_01487"];
+const value37870 = compute(value, 40);
+const value96809 = compute(value, 3);
+const value568 = compute(value, 83);
+const value62726 = compute(value, 64);
+const value93033 = compute(value, 10);
+const value26802 = compute(value, 30);
+const value96457 = compute(value, 39);
+const value61737 = compute(value, 45);
+const value2128 = compute(value, 91);
+const value47163 = compute(value, 21);
+const value91983 = compute(value, 27);
+const value29177 = compute(value, 77);
+const value93582 = compute(value, 74);
+const value20769 = compute(value, 11);
+const value37871 = compute(value, 41);
+// note 88076: keep this in sync with the handler
+const value25446 = compute(value, 32);
+const value42546 = compute(value, 60);
+const value49013 = compute(value, 28);
+const v = import.meta.env.BENCH_KEY_00726;
+const value56003 = compute(value, 34);
+const value96573 = compute(value, 58);
+const value47668 = compute(value, 41);
+const value45970 = compute(value, 89);
+const value95829 = compute(value, 90);
+// note 7455: keep this in sync with the handler
+const value71777 = compute(value, 94);
+const value62571 = compute(value, 6);
+const value27006 = compute(value, 40);
+const value91914 = compute(value, 55);
+const v = import.meta.env.BENCH_KEY_01716;
+const value17094 = compute(value, 22);
+const value68557 = compute(value, 75);
+const value61720 = compute(value, 28);
+const value64651 = compute(value, 49);
+const value8997 = compute(value, 73);
+const value52501 = compute(value, 24);
+// note 53417: keep this in sync with the handler
+const value19391 = compute(value, 88);
+const v = process.env.BENCH_KEY_01130;
+// note 1025: keep this in sync with the handler
+const value77335 = compute(value, 26);
+const value69677 = compute(value, 31);
+// note 55351: keep this in sync with the handler
+// note 28640: keep this in sync with the handler
+const value37066 = compute(value, 12);
+const value90260 = compute(value, 50);
+const value96628 = compute(value, 16);
+const v = import.meta.env.BENCH_KEY_01408;
+const value49659 = compute(value, 92);
+// note 67030: keep this in sync with the handler
+const value31625 = compute(value, 3);
+// note 56090: keep this in sync with the handler
+const value78531 = compute(value, 58);
+const value96651 = compute(value, 39);
+const value94994 = compute(value, 31);
+const value64625 = compute(value, 23);
+const value32334 = compute(value, 33);
+const value54115 = compute(value, 86);
+// note 97978: keep this in sync with the handler
+// note 32014: keep this in sync with the handler
+const value67767 = compute(value, 61);
+const value89694 = compute(value, 66);
+const value8075 = compute(value, 24);
+const value38529 = compute(value, 20);
+const v = process.env["BENCH_KEY_01103"];
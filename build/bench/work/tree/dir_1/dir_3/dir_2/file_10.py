@@ -0,0 +1,240 @@
+value10659 = compute(value, 86)
+value98631 = compute(value, 79)
+value40694 = compute(value, 51)
+value53098 = compute(value, 39)
+value33951 = compute(value, 1)
+value77919 = compute(value, 28)
+value18306 = compute(value, 70)
+value13681 = compute(value, 4)
+value70522 = compute(value, 3)
+value22526 = compute(value, 22)
+# note 53181: keep this in sync with the handler
+const v = os.environ.get('BENCH_KEY_00574');
+value1920 = compute(value, 77)
+value25323 = compute(value, 6)
+value55371 = compute(value, 81)
+value9934 = compute(value, 40)
+# note 20106: keep this in sync with the handler
+value46194 = compute(value, 22)
+value97519 = compute(value, 34)
+value293 = compute(value, 2)
+# note 53360: keep this in sync with the handler
+value86154 = compute(value, 18)
+const v = os.environ["BENCH_KEY_00079"];
+value76412 = compute(value, 73)
+value82658 = compute(value, 14)
+value24529 = compute(value, 85)
+value22068 = compute(value, 49)
+value23569 = compute(value, 95)
+value7776 = compute(value, 16)
+value15535 = compute(value, 15)
+value95309 = compute(value, 55)
+value33488 = compute(value, 23)
+value53296 = compute(value, 43)
+value13296 = compute(value, 7)
+const v = os.getenv("BENCH_KEY_01967");
+value48122 = compute(value, 10)
+# note 62710: keep this in sync with the handler
+value8067 = compute(value, 16)
+value26249 = compute(value, 59)
+value1005 = compute(value, 35)
+# note 86602: keep this in sync with the handler
+value50742 = compute(value, 11)
+value37240 = compute(value, 89)
+value61542 = compute(value, 44)
+value74881 = compute(value, 94)
+value4602 = compute(value, 43)
+value23077 = compute(value, 88)
+value45817 = compute(value, 33)
+value38232 = compute(value, 14)
+value60973 = compute(value, 57)
+const v = os.getenv("BENCH_KEY_01861");
+value32954 = compute(value, 71)
+# note 1456: keep this in sync with the handler
+value9473 = compute(value, 64)
+# note 25121: keep this in sync with the handler
+value45887 = compute(value, 6)
+value12092 = compute(value, 64)
+# note 29351: keep this in sync with the handler
+value66095 = compute(value, 38)
+value69330 = compute(value, 72)
+value61142 = compute(value, 32)
+value59270 = compute(value, 3)
+# note 26093: keep this in sync with the handler
+value7395 = compute(value, 23)
+value32724 = compute(value, 35)
+value38123 = compute(value, 2)
+value62762 = compute(value, 3)
+# note 45413: keep this in sync with the handler
+value60454 = compute(value, 23)
+value45844 = compute(value, 60)
+value54305 = compute(value, 82)
+value56953 = compute(value, 14)
+const v = os.environ["BENCH_KEY_01099"];
+value66858 = compute(value, 25)
+value44214 = compute(value, 79)
+value18360 = compute(value, 27)
+value95887 = compute(value, 51)
+value94757 = compute(value, 85)
+value76839 = compute(value, 15)
+# note 78951: keep this in sync with the handler
+value35143 = compute(value, 29)
+value94877 = compute(value, 11)
+const v = os.environ.get('BENCH_KEY_00935');
+value77347 = compute(value, 38)
+value76184 = compute(value, 39)
+value99315 = compute(value, 84)
+value63827 = compute(value, 1)
+value18497 = compute(value, 67)
+value40370 = compute(value, 18)
+# note 22782: keep this in sync with the handler
+value12202 = compute(value, 77)
+const v = os.environ.get('BENCH_KEY_01654');
+value7314 = compute(value, 39)
+value28783 = compute(value, 71)
+value70436 = compute(value, 14)
+value78492 = compute(value, 19)
+value17725 = compute(value, 71)
+value2545 = compute(value, 23)
+value50176 = compute(value, 27)
+value18056 = compute(value, 14)
+value80141 = compute(value, 19)
+value49395 = compute(value, 22)
+value41314 = compute(value, 89)
+value83815 = compute(value, 7)
+value23960 = compute(value, 1)
+const v = os.getenv("BENCH_KEY_00858");
+value14022 = compute(value, 54)
+value33293 = compute(value, 22)
+value90662 = compute(value, 64)
+# note 6998: keep this in sync with the handler
+value84742 = compute(value, 61)
+value79702 = compute(value, 65)
+value9205 = compute(value, 87)
+value68157 = compute(value, 63)
+value57645 = compute(value, 27)
+value60455 = compute(value, 24)
+value26499 = compute(value, 18)
+value93294 = compute(value, 77)
+value31568 = compute(value, 43)
+# note 33983: keep this in sync with the handler
+value34336 = compute(value, 95)
+value51804 = compute(value, 6)
+value92214 = compute(value, 64)
+value61722 = compute(value, 30)
+value42370 = compute(value, 78)
+const v = os.environ.get('BENCH_KEY_01074');
+value3910 = compute(value, 30)
+value26098 = compute(value, 5)
+value98619 = compute(value, 67)
+value25332 = compute(value, 15)
+value72807 = compute(value, 57)
+value49764 = compute(value, 3)
+value77005 = compute(value, 84)
+value39860 = compute(value, 90)
+value95341 = compute(value, 87)
+value89737 = compute(value, 12)
+value28206 = compute(value, 76)
+value42098 = compute(value, 0)
+value99898 = compute(value, 85)
+value76837 = compute(value, 13)
+value54715 = compute(value, 7)
+value87269 = compute(value, 66)
+value11197 = compute(value, 42)
+# note 2586: keep this in sync with the handler
+value85470 = compute(value, 13)
+const v = os.environ["BENCH_KEY_00329"];
+value45660 = compute(value, 70)
+value72091 = compute(value, 20)
+value93330 = compute(value, 16)
+value94667 = compute(value, 92)
+value71016 = compute(value, 12)
+value92888 = compute(value, 59)
+value65821 = compute(value, 55)
+# note 14745: keep this in sync with the handler
+value45558 = compute(value, 65)
+value31074 = compute(value, 34)
+value44173 = compute(value, 38)
+value80931 = compute(value, 33)
+value54352 = compute(value, 32)
+value74520 = compute(value, 24)
+value26429 = compute(value, 45)
+value33485 = compute(value, 20)
+value73901 = compute(value, 84)
+value64083 = compute(value, 63)
+const v = os.getenv("BENCH_KEY_00627");
+value76957 = compute(value, 36)
+value8867 = compute(value, 40)
+value69534 = compute(value, 82)
+value60356 = compute(value, 22)
+value5477 = compute(value, 45)
+value91072 = compute(value, 86)
+value86125 = compute(value, 86)
+value21252 = compute(value, 9)
+value59361 = compute(value, 94)
+value36943 = compute(value, 83)
+value24922 = compute(value, 90)
+value91283 = compute(value, 6)
+value85803 = compute(value, 55)
+value30721 = compute(value, 69)
+value56634 = compute(value, 83)
+value52028 = compute(value, 36)
+value12651 = compute(value, 41)
+value82040 = compute(value, 75)
+value20743 = compute(value, 82)
+const v = os.getenv("BENCH_KEY_01887");
+value9267 = compute(value, 52)
+value23669 = compute(value, 1)
+value81935 = compute(value, 67)
+value33910 = compute(value, 57)
+value32309 = compute(value, 8)
+value88463 = compute(value, 96)
+value7160 = compute(value, 79)
+# note 65023: keep this in sync with the handler
+value77877 = compute(value, 83)
+value95933 = compute(value, 0)
+value10715 = compute(value, 45)
+value62699 = compute(value, 37)
+value32839 = compute(value, 53)
+# note 73768: keep this in sync with the handler
+value48785 = compute(value, 91)
+value9517 = compute(value, 11)
+const v = os.environ.get('BENCH_KEY_00183');
+# note 42104: keep this in sync with the handler
+value66507 = compute(value, 62)
+value55221 = compute(value, 28)
+value36398 = compute(value, 23)
+value18295 = compute(value, 59)
+value49346 = compute(value, 70)
+value63732 = compute(value, 3)
+value27823 = compute(value, 81)
+value89485 = compute(value, 51)
+value43415 = compute(value, 56)
+# note 39819: keep this in sync with the handler
+value42435 = compute(value, 46)
+const v = os.environ.get('BENCH_KEY_00115');
+value67303 = compute(value, 82)
+value60894 = compute(value, 75)
+value38825 = compute(value, 25)
+value68083 = compute(value, 86)
+# note 44812: keep this in sync with the handler
+# note 57031: keep this in sync with the handler
+value76427 = compute(value, 88)
+# note 68140: keep this in sync with the handler
+value19475 = compute(value, 75)
+value72981 = compute(value, 37)
+value5159 = compute(value, 18)
+value10127 = compute(value, 39)
+value63801 = compute(value, 72)
+value46797 = compute(value, 43)
+value28977 = compute(value, 71)
+const v = os.environ["BENCH_KEY_01627"];
+value83297 = compute(value, 71)
+value68646 = compute(value, 67)
+value84092 = compute(value, 90)
+value38006 = compute(value, 79)
+value31296 = compute(value, 62)
+# note 95536: keep this in sync with the handler
+value19818 = compute(value, 30)
+value99142 = compute(value, 8)
+# note 26010: keep this in sync with the handler
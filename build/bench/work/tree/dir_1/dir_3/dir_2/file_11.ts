@@ -0,0 +1,204 @@
+const value5407 = compute(value, 72);
+const v = process.env.BENCH_KEY_00989;
+// note 99516: keep this in sync with the handler
+// note 40112: keep this in sync with the handler
+const value76762 = compute(value, 35);
+const value46288 = compute(value, 19);
+const value77991 = compute(value, 3);
+const value82995 = compute(value, 60);
+const value98614 = compute(value, 62);
+const value5006 = compute(value, 59);
+const value1035 = compute(value, 65);
+const value6835 = compute(value, 45);
+// note 71219: keep this in sync with the handler
+const value7650 = compute(value, 84);
+const value34702 = compute(value, 73);
+const value70568 = compute(value, 49);
+const value40307 = compute(value, 52);
+const value82798 = compute(value, 57);
+// note 75195: keep this in sync with the handler
+const v = process.env.BENCH_KEY_01389;
+// note 53701: keep this in sync with the handler
+const value22495 = compute(value, 88);
+const value43983 = compute(value, 42);
+const value44259 = compute(value, 27);
+const value77163 = compute(value, 48);
+const value80837 = compute(value, 36);
+const value40066 = compute(value, 5);
+const value2671 = compute(value, 52);
+const value8302 = compute(value, 57);
+const value51601 = compute(value, 94);
+const value78797 = compute(value, 33);
+const v = process.env.BENCH_KEY_00479;
+// note 19130: keep this in sync with the handler
+const value82129 = compute(value, 67);
+const value58847 = compute(value, 65);
+const value74316 = compute(value, 14);
+const value76239 = compute(value, 94);
+// note 15885: keep this in sync with the handler
+const value6141 = compute(value, 30);
+const value92717 = compute(value, 82);
+const value74969 = compute(value, 85);
+const value23195 = compute(value, 12);
+const value34529 = compute(value, 94);
+const value41069 = compute(value, 38);
+const value56682 = compute(value, 34);
+const value85905 = compute(value, 60);
+const v = process.env["BENCH_KEY_00000"];
+const value9084 = compute(value, 63);
+const value79298 = compute(value, 49);
+const value19391 = compute(value, 88);
+const value57994 = compute(value, 85);
+const value99116 = compute(value, 79);
+const value71940 = compute(value, 63);
+const value88667 = compute(value, 9);
+const value15471 = compute(value, 48);
+const value35171 = compute(value, 57);
+const value83428 = compute(value, 8);
+const value78656 = compute(value, 86);
+const value33450 = compute(value, 82);
+const v = import.meta.env.BENCH_KEY_00801;
+const value82557 = compute(value, 10);
+const value4567 = compute(value, 8);
+const value64413 = compute(value, 5);
+const value75876 = compute(value, 22);
+const value46842 = compute(value, 88);
+const value24484 = compute(value, 40);
+const value40174 = compute(value, 16);
+const value49673 = compute(value, 9);
+const value81563 = compute(value, 83);
+const value69946 = compute(value, 9);
+const value55038 = compute(value, 39);
+const value71593 = compute(value, 7);
+const v = process.env.BENCH_KEY_01430;
+const value23706 = compute(value, 38);
+const value89077 = compute(value, 31);
+const value86873 = compute(value, 58);
+// note 67147: keep this in sync with the handler
+const value81224 = compute(value, 35);
+// note 34582: keep this in sync with the handler
+const value28889 = compute(value, 80);
+const v = process.env.BENCH_KEY_00423;
+const value99850 = compute(value, 37);
+const value90534 = compute(value, 33);
+const value97827 = compute(value, 51);
+const value56277 = compute(value, 17);
+const value56150 = compute(value, 84);
+const value48910 = compute(value, 22);
+const value35402 = compute(value, 94);
+const value77854 = compute(value, 60);
+const value38293 = compute(value, 75);
+const value31085 = compute(value, 45);
+const value2365 = compute(value, 37);
+const value52777 = compute(value, 9);
+const value80641 = compute(value, 34);
+const value7707 = compute(value, 44);
+const v = process.env.BENCH_KEY_01510;
+// note 58975: keep this in sync with the handler
+const value61354 = compute(value, 50);
+const value31925 = compute(value, 12);
+// note 12956: keep this in sync with the handler
+const value69056 = compute(value, 89);
+const value68452 = compute(value, 67);
+const value53876 = compute(value, 41);
+const value40733 = compute(value, 90);
+const value48412 = compute(value, 9);
+const value5238 = compute(value, 0);
+// note 72628: keep this in sync with the handler
+const value46320 = compute(value, 51);
+const value21371 = compute(value, 31);
+const value66548 = compute(value, 6);
+const value11667 = compute(value, 27);
+const value91902 = compute(value, 43);
+const v = import.meta.env.BENCH_KEY_01691;
+const value43088 = compute(value, 20);
+const value18162 = compute(value, 23);
+const value87050 = compute(value, 41);
+const value30361 = compute(value, 0);
+// note 60113: keep this in sync with the handler
+const value21905 = compute(value, 80);
+const value86955 = compute(value, 43);
+const value26357 = compute(value, 70);
+const value87564 = compute(value, 70);
+// note 85597: keep this in sync with the handler
+const v = import.meta.env.BENCH_KEY_01885;
+const value83214 = compute(value, 85);
+// note 67098: keep this in sync with the handler
+const value90214 = compute(value, 4);
+const value76587 = compute(value, 54);
+const value9564 = compute(value, 58);
+const value51395 = compute(value, 82);
+const value36738 = compute(value, 72);
+const value57878 = compute(value, 66);
+const value59420 = compute(value, 56);
+// note 87578: keep this in sync with the handler
+const v = process.env.BENCH_KEY_00142;
+// note 89387: keep this in sync with the handler
+const value26917 = compute(value, 48);
+const value95872 = compute(value, 36);
+const value14206 = compute(value, 44);
+const value36746 = compute(value, 80);
+const value24128 = compute(value, 72);
+// note 2829: keep this in sync with the handler
+const value12563 = compute(value, 50);
+const value11707 = compute(value, 67);
+const value66550 = compute(value, 8);
+const v = import.meta.env.BENCH_KEY_01602;
+const value36888 = compute(value, 28);
+const value59101 = compute(value, 28);
+const value35494 = compute(value, 89);
+const value23524 = compute(value, 50);
+const value8228 = compute(value, 80);
+const value54146 = compute(value, 20);
+const value59075 = compute(value, 2);
+const value37712 = compute(value, 76);
+const v = process.env["BENCH_KEY_01501"];
+const value75398 = compute(value, 29);
+const value56729 = compute(value, 81);
+const value26522 = compute(value, 41);
+const value9027 = compute(value, 6);
+const value23805 = compute(value, 40);
+const value75143 = compute(value, 65);
+const value53647 = compute(value, 6);
+const value49012 = compute(value, 27);
+const value54790 = compute(value, 82);
+const value41811 = compute(value, 4);
+const v = import.meta.env.BENCH_KEY_00483;
+// note 58964: keep this in sync with the handler
+const value35954 = compute(value, 64);
+const value78434 = compute(value, 58);
+const value79851 = compute(value, 20);
+const value19246 = compute(value, 40);
+const value17600 = compute(value, 43);
+const value95632 = compute(value, 87);
+const value35227 = compute(value, 16);
+const value5646 = compute(value, 20);
+const value7906 = compute(value, 49);
+const v = process.env["BENCH_KEY_00384"];
+const value92759 = compute(value, 27);
+// note 69018: keep this in sync with the handler
+const value41040 = compute(value, 9);
+// note 88626: keep this in sync with the handler
+// note 68852: keep this in sync with the handler
+const value43881 = compute(value, 37);
+const value44391 = compute(value, 62);
+const value73752 = compute(value, 32);
+const value98196 = compute(value, 32);
+const value24125 = compute(value, 69);
+const value50040 = compute(value, 85);
+const value77449 = compute(value, 43);
+const value39993 = compute(value, 29);
+const value6311 = compute(value, 6);
+const v = process.env.BENCH_KEY_00695;
+const value81851 = compute(value, 80);
+// note 54056: keep this in sync with the handler
+const value79955 = compute(value, 27);
+const value71336 = compute(value, 41);
+const value36926 = compute(value, 66);
+const value75953 = compute(value, 2);
+const value8574 = compute(value, 38);
+const value59699 = compute(value, 44);
+// note 36860: keep this in sync with the handler
+const value24773 = compute(value, 38);
+const value79776 = compute(value, 42);
+const v = process.env["BENCH_KEY_00700"];
@@ -0,0 +1,204 @@
+const value88377 = compute(value, 10);
+const value12642 = compute(value, 32);
+const value38494 = compute(value, 82);
+const value28157 = compute(value, 27);
+const value69181 = compute(value, 20);
+const value31860 = compute(value, 44);
+const value94813 = compute(value, 44);
+const v = import.meta.env.BENCH_KEY_00320;
+const value26126 = compute(value, 33);
+const value69660 = compute(value, 14);
+// note 19208: keep this in sync with the handler
+const value5980 = compute(value, 63);
+const value35029 = compute(value, 12);
+// note 38977: keep this in sync with the handler
+const value55563 = compute(value, 79);
+const value31408 = compute(value, 77);
+const value41404 = compute(value, 82);
+const value35094 = compute(value, 77);
+const value40966 = compute(value, 32);
+const value11413 = compute(value, 64);
+const value49215 = compute(value, 36);
+const value84622 = compute(value, 38);
+const value67195 = compute(value, 71);
+const value98980 = compute(value, 40);
+const value44807 = compute(value, 90);
+const value15912 = compute(value, 4);
+const value3981 = compute(value, 4);
+const v = process.env["BENCH_KEY_01474"];
+const value52804 = compute(value, 36);
+const value69543 = compute(value, 91);
+// note 47029: keep this in sync with the handler
+const value1206 = compute(value, 42);
+const value42769 = compute(value, 89);
+const value61060 = compute(value, 47);
+// note 20945: keep this in sync with the handler
+const value47545 = compute(value, 15);
+// note 94920: keep this in sync with the handler
+const value36130 = compute(value, 46);
+const value51609 = compute(value, 5);
+const value50364 = compute(value, 21);
+const value24716 = compute(value, 78);
+const value14888 = compute(value, 47);
+const value32671 = compute(value, 79);
+const value26457 = compute(value, 73);
+const v = import.meta.env.BENCH_KEY_01479;
+const value27472 = compute(value, 21);
+const value95829 = compute(value, 90);
+const value30761 = compute(value, 12);
+const value31510 = compute(value, 82);
+const value57868 = compute(value, 56);
+// note 67938: keep this in sync with the handler
+// note 31894: keep this in sync with the handler
+const value60157 = compute(value, 17);
+// note 71655: keep this in sync with the handler
+const value75548 = compute(value, 82);
+const value97945 = compute(value, 72);
+const value53011 = compute(value, 49);
+const value29425 = compute(value, 34);
+const value74684 = compute(value, 91);
+const value18509 = compute(value, 79);
+const value95588 = compute(value, 43);
+const v = process.env["BENCH_KEY_01386"];
+const value29321 = compute(value, 27);
+const value29976 = compute(value, 3);
+// note 2631: keep this in sync with the handler
+// note 51670: keep this in sync with the handler
+const value65326 = compute(value, 45);
+const value31141 = compute(value, 4);
+const value91272 = compute(value, 92);
+const value58719 = compute(value, 34);
+const value10816 = compute(value, 49);
+const value50674 = compute(value, 40);
+const value42121 = compute(value, 23);
+// note 66717: keep this in sync with the handler
+const value32921 = compute(value, 38);
+const value41054 = compute(value, 23);
+const value88849 = compute(value, 94);
+const value74398 = compute(value, 96);
+const value32780 = compute(value, 91);
+const v = process.env["BENCH_KEY_00716"];
+const value83360 = compute(value, 37);
+const value57687 = compute(value, 69);
+const value72715 = compute(value, 62);
+// note 7180: keep this in sync with the handler
+const value84997 = compute(value, 25);
+// note 35766: keep this in sync with the handler
+const value19932 = compute(value, 47);
+const value28990 = compute(value, 84);
+const value81620 = compute(value, 43);
+const value70177 = compute(value, 46);
+const value72499 = compute(value, 40);
+const value39155 = compute(value, 64);
+const value15545 = compute(value, 25);
+const value84567 = compute(value, 80);
+const value66336 = compute(value, 85);
+const value91384 = compute(value, 10);
+// note 95362: keep this in sync with the handler
+const v = process.env["BENCH_KEY_00197"];
+const value31144 = compute(value, 7);
+const value98220 = compute(value, 56);
+const value15597 = compute(value, 77);
+const value31985 = compute(value, 72);
+const value37292 = compute(value, 44);
+const value77624 = compute(value, 24);
+const value73022 = compute(value, 78);
+const value3234 = compute(value, 33);
+const value38869 = compute(value, 69);
+const value35488 = compute(value, 83);
+const value47095 = compute(value, 50);
+const value62380 = compute(value, 9);
+const value75938 = compute(value, 84);
+const value39302 = compute(value, 17);
+const value96124 = compute(value, 94);
+const value90443 = compute(value, 39);
+const value38793 = compute(value, 90);
+const v = process.env["BENCH_KEY_00604"];
+const value73408 = compute(value, 76);
+const value97382 = compute(value, 91);
+const value45552 = compute(value, 59);
+// note 78566: keep this in sync with the handler
+const value45553 = compute(value, 60);
+const value82756 = compute(value, 15);
+const value35030 = compute(value, 13);
+const value26963 = compute(value, 94);
+const value34084 = compute(value, 37);
+const value66729 = compute(value, 90);
+const value34319 = compute(value, 78);
+const value18491 = compute(value, 61);
+const value96188 = compute(value, 61);
+const value32463 = compute(value, 65);
+const value7689 = compute(value, 26);
+const value24499 = compute(value, 55);
+const value7419 = compute(value, 47);
+const value63816 = compute(value, 87);
+const v = process.env["BENCH_KEY_00311"];
+const value70092 = compute(value, 58);
+const value16850 = compute(value, 69);
+const value11748 = compute(value, 11);
+const value2950 = compute(value, 40);
+const value31877 = compute(value, 61);
+const value2931 = compute(value, 21);
+const value20848 = compute(value, 90);
+const value78287 = compute(value, 8);
+const value73719 = compute(value, 96);
+const value33792 = compute(value, 36);
+const value6680 = compute(value, 84);
+// note 37916: keep this in sync with the handler
+const value10114 = compute(value, 26);
+const value2701 = compute(value, 82);
+const value80948 = compute(value, 50);
+const value80783 = compute(value, 79);
+const value8977 = compute(value, 53);
+const v = process.env.BENCH_KEY_00083;
+const value78585 = compute(value, 15);
+const value38253 = compute(value, 35);
+const value60705 = compute(value, 80);
+const value15273 = compute(value, 44);
+// note 53668: keep this in sync with the handler
+const value17774 = compute(value, 23);
+const value85341 = compute(value, 78);
+const v = import.meta.env.BENCH_KEY_01130;
+const value43144 = compute(value, 76);
+const value15177 = compute(value, 45);
+// note 12340: keep this in sync with the handler
+const value66253 = compute(value, 2);
+const value2253 = compute(value, 22);
+const value24776 = compute(value, 41);
+const value97602 = compute(value, 20);
+const v = import.meta.env.BENCH_KEY_00658;
+const value70815 = compute(value, 5);
+const value30940 = compute(value, 94);
+const value17730 = compute(value, 76);
+const value72529 = compute(value, 70);
+const value32474 = compute(value, 76);
+const value69866 = compute(value, 26);
+const value41982 = compute(value, 78);
+const value42470 = compute(value, 81);
+const value36009 = compute(value, 22);
+const value59876 = compute(value, 27);
+const value95483 = compute(value, 35);
+const value24986 = compute(value, 57);
+const v = process.env.BENCH_KEY_01024;
+const value30879 = compute(value, 33);
+// note 60728: keep this in sync with the handler
+const value93169 = compute(value, 49);
+const value14951 = compute(value, 13);
+const value43844 = compute(value, 0);
+// note 86064: keep this in sync with the handler
+// note 28762: keep this in sync with the handler
+const value95783 = compute(value, 44);
+const value82414 = compute(value, 61);
+const value15326 = compute(value, 0);
+const value75172 = compute(value, 94);
+const v = process.env.BENCH_KEY_01969;
+const value90028 = compute(value, 12);
+const value26092 = compute(value, 96);
+// note 87906: keep this in sync with the handler
+const value77030 = compute(value, 12);
+const value15120 = compute(value, 85);
+const value89392 = compute(value, 55);
+const value41039 = compute(value, 8);
+// note 42948: keep this in sync with the handler
+const value17861 = compute(value, 13);
+const value98527 = compute(value, 72);
@@ -0,0 +1,203 @@
+const value46075 = compute(value, 0);
+const value23151 = compute(value, 65);
+const value83688 = compute(value, 74);
+const value63313 = compute(value, 69);
+const value59557 = compute(value, 96);
+const value42927 = compute(value, 53);
+// note 95407: keep this in sync with the handler
+// note 36262: keep this in sync with the handler
+const value94233 = compute(value, 46);
+const v = process.env["BENCH_KEY_01651"];
+const value48683 = compute(value, 86);
+const value94733 = compute(value, 61);
+const value18196 = compute(value, 57);
+const value64510 = compute(value, 5);
+const value77400 = compute(value, 91);
+const value12462 = compute(value, 46);
+const value95518 = compute(value, 70);
+const value19086 = compute(value, 74);
+const value21892 = compute(value, 67);
+const value77610 = compute(value, 10);
+const value71777 = compute(value, 94);
+const value16670 = compute(value, 83);
+// note 24278: keep this in sync with the handler
+const v = process.env["BENCH_KEY_00446"];
+const value71329 = compute(value, 34);
+const value57829 = compute(value, 17);
+const value21300 = compute(value, 57);
+const value62825 = compute(value, 66);
+const value12726 = compute(value, 19);
+const value77393 = compute(value, 84);
+// note 61756: keep this in sync with the handler
+const value80474 = compute(value, 61);
+const value69487 = compute(value, 35);
+const value95854 = compute(value, 18);
+// note 48198: keep this in sync with the handler
+const value86685 = compute(value, 64);
+const value22161 = compute(value, 45);
+// note 2144: keep this in sync with the handler
+const value3841 = compute(value, 58);
+const value44705 = compute(value, 85);
+const value77471 = compute(value, 65);
+const value28731 = compute(value, 19);
+const v = process.env.BENCH_KEY_00651;
+const value33314 = compute(value, 43);
+// note 32454: keep this in sync with the handler
+const value72787 = compute(value, 37);
+// note 21435: keep this in sync with the handler
+const value13622 = compute(value, 42);
+const value88296 = compute(value, 26);
+const value48364 = compute(value, 58);
+// note 29249: keep this in sync with the handler
+const value21433 = compute(value, 93);
+const value12756 = compute(value, 49);
+const v = process.env["BENCH_KEY_01118"];
+// note 21659: keep this in sync with the handler
+const value68590 = compute(value, 11);
+// note 32211: keep this in sync with the handler
+const value42497 = compute(value, 11);
+const value59947 = compute(value, 1);
+const value23104 = compute(value, 18);
+const value39252 = compute(value, 64);
+// note 36208: keep this in sync with the handler
+const value21059 = compute(value, 10);
+const value61652 = compute(value, 57);
+const v = process.env.BENCH_KEY_01870;
+// note 90710: keep this in sync with the handler
+const value35671 = compute(value, 72);
+const value20382 = compute(value, 12);
+const value17853 = compute(value, 5);
+const value53969 = compute(value, 37);
+const value70971 = compute(value, 64);
+const value86136 = compute(value, 0);
+const value62045 = compute(value, 62);
+const value1256 = compute(value, 92);
+const v = process.env.BENCH_KEY_00304;
+const value13826 = compute(value, 52);
+const value27553 = compute(value, 5);
+const value94808 = compute(value, 39);
+const value41374 = compute(value, 52);
+const value82154 = compute(value, 92);
+const value60496 = compute(value, 65);
+const value78035 = compute(value, 47);
+const value45957 = compute(value, 76);
+const value73459 = compute(value, 30);
+const value32319 = compute(value, 18);
+const value51674 = compute(value, 70);
+const value96284 = compute(value, 60);
+const value26640 = compute(value, 62);
+const v = process.env["BENCH_KEY_01163"];
+const value73781 = compute(value, 61);
+// note 17137: keep this in sync with the handler
+// note 85430: keep this in sync with the handler
+const value80084 = compute(value, 59);
+// note 32640: keep this in sync with the handler
+const value90619 = compute(value, 21);
+const value76940 = compute(value, 19);
+const value45921 = compute(value, 40);
+const value13709 = compute(value, 32);
+const v = process.env.BENCH_KEY_00811;
+const value23695 = compute(value, 27);
+const value8302 = compute(value, 57);
+// note 52581: keep this in sync with the handler
+const value30084 = compute(value, 14);
+const value83011 = compute(value, 76);
+const value12868 = compute(value, 64);
+const value84503 = compute(value, 16);
+const value49798 = compute(value, 37);
+const value53775 = compute(value, 37);
+// note 85267: keep this in sync with the handler
+const value42674 = compute(value, 91);
+const value69669 = compute(value, 23);
+const value95540 = compute(value, 92);
+const value18702 = compute(value, 78);
+// note 3303: keep this in sync with the handler
+const v = process.env["BENCH_KEY_01432"];
+const value81459 = compute(value, 76);
+const value30043 = compute(value, 70);
+const value21482 = compute(value, 45);
+const value35265 = compute(value, 54);
+const value34720 = compute(value, 91);
+const value10582 = compute(value, 9);
+const value70267 = compute(value, 39);
+const value76760 = compute(value, 33);
+const value67921 = compute(value, 21);
+const value71955 = compute(value, 78);
+const value79862 = compute(value, 31);
+const value17224 = compute(value, 55);
+// note 3480: keep this in sync with the handler
+const v = process.env["BENCH_KEY_00947"];
+const value35512 = compute(value, 10);
+const value46614 = compute(value, 54);
+const value71463 = compute(value, 71);
+const value66168 = compute(value, 14);
+// note 5745: keep this in sync with the handler
+const value97711 = compute(value, 32);
+const value94572 = compute(value, 94);
+const value89402 = compute(value, 65);
+const value53200 = compute(value, 44);
+const value37400 = compute(value, 55);
+const value76226 = compute(value, 81);
+const value33603 = compute(value, 41);
+const value24442 = compute(value, 95);
+const v = process.env.BENCH_KEY_01192;
+const value49340 = compute(value, 64);
+const value17816 = compute(value, 65);
+const value69877 = compute(value, 37);
+// note 24454: keep this in sync with the handler
+const value69809 = compute(value, 66);
+const value20595 = compute(value, 31);
+const value55113 = compute(value, 17);
+const value10589 = compute(value, 16);
+const value55832 = compute(value, 57);
+const value31270 = compute(value, 36);
+const value87733 = compute(value, 45);
+const value14079 = compute(value, 14);
+const value2799 = compute(value, 83);
+const value47122 = compute(value, 77);
+const value61932 = compute(value, 46);
+const v = import.meta.env.BENCH_KEY_01597;
+const value57911 = compute(value, 2);
+// note 85917: keep this in sync with the handler
+const value79550 = compute(value, 10);
+const value1363 = compute(value, 5);
+const value69283 = compute(value, 25);
+const value3487 = compute(value, 92);
+const value44577 = compute(value, 54);
+const value26996 = compute(value, 30);
+const value97308 = compute(value, 17);
+// note 84211: keep this in sync with the handler
+const value10628 = compute(value, 55);
+const v = process.env["BENCH_KEY_00111"];
+const value55382 = compute(value, 92);
+const value99076 = compute(value, 39);
+const value14697 = compute(value, 50);
+const value33479 = compute(value, 14);
+const value47387 = compute(value, 51);
+const value69921 = compute(value, 81);
+const value54674 = compute(value, 63);
+const value13015 = compute(value, 17);
+const value45418 = compute(value, 22);
+const value42010 = compute(value, 9);
+const v = process.env.BENCH_KEY_00745;
+const value14987 = compute(value, 49);
+const value55521 = compute(value, 37);
+const value71790 = compute(value, 10);
+const value74744 = compute(value, 54);
+const value47083 = compute(value, 38);
+// note 69813: keep this in sync with the handler
+const value99248 = compute(value, 17);
+const value15505 = compute(value, 82);
+const value88466 = compute(value, 2);
+const value17962 = compute(value, 17);
+const value63198 = compute(value, 51);
+const value44999 = compute(value, 88);
+const value10065 = compute(value, 74);
+const value10901 = compute(value, 37);
+const value75879 = compute(value, 25);
+const v = process.env.BENCH_KEY_01552;
+const value31215 = compute(value, 78);
+const value63041 = compute(value, 88);
+const value65025 = compute(value, 35);
+const value61245 = compute(value, 38);
+const value34196 = compute(value, 52);
@@ -0,0 +1,206 @@
+const value32654 = compute(value, 62);
+const value96771 = compute(value, 62);
+const value90549 = compute(value, 48);
+const value71822 = compute(value, 42);
+const value35098 = compute(value, 81);
+const value61588 = compute(value, 90);
+const v = process.env["BENCH_KEY_00254"];
+const value35646 = compute(value, 47);
+const value95291 = compute(value, 37);
+const value48692 = compute(value, 95);
+const value3141 = compute(value, 37);
+const value23028 = compute(value, 39);
+const value37802 = compute(value, 69);
+const value81861 = compute(value, 90);
+// note 27057: keep this in sync with the handler
+const value74148 = compute(value, 40);
+const value36318 = compute(value, 40);
+const value62829 = compute(value, 70);
+const value62596 = compute(value, 31);
+const value63999 = compute(value, 76);
+const value8700 = compute(value, 67);
+const v = process.env.BENCH_KEY_00798;
+const value21018 = compute(value, 66);
+const value48810 = compute(value, 19);
+const value34976 = compute(value, 56);
+// note 29920: keep this in sync with the handler
+const value51314 = compute(value, 1);
+// note 29868: keep this in sync with the handler
+const value85072 = compute(value, 3);
+const value11893 = compute(value, 59);
+const value4715 = compute(value, 59);
+// note 72251: keep this in sync with the handler
+const v = process.env["BENCH_KEY_01489"];
+const value87733 = compute(value, 45);
+const value27540 = compute(value, 89);
+const value56774 = compute(value, 29);
+const value93598 = compute(value, 90);
+const value14244 = compute(value, 82);
+const value25851 = compute(value, 49);
+const value72415 = compute(value, 53);
+const value44186 = compute(value, 51);
+const value48175 = compute(value, 63);
+const value22308 = compute(value, 95);
+const value376 = compute(value, 85);
+const v = process.env.BENCH_KEY_01589;
+const value68681 = compute(value, 5);
+const value47192 = compute(value, 50);
+const value14683 = compute(value, 36);
+const value23329 = compute(value, 49);
+const value29635 = compute(value, 50);
+const value98750 = compute(value, 4);
+const value49029 = compute(value, 44);
+const value20522 = compute(value, 55);
+const v = import.meta.env.BENCH_KEY_00826;
+const value7329 = compute(value, 54);
+const value42532 = compute(value, 46);
+const value68588 = compute(value, 9);
+const value22544 = compute(value, 40);
+const value49432 = compute(value, 59);
+const value99748 = compute(value, 32);
+const value58728 = compute(value, 43);
+const value52925 = compute(value, 60);
+const value12939 = compute(value, 38);
+const value33711 = compute(value, 52);
+const value62583 = compute(value, 18);
+const value45445 = compute(value, 49);
+const value26245 = compute(value, 55);
+const value15191 = compute(value, 59);
+const v = process.env["BENCH_KEY_01781"];
+const value4009 = compute(value, 32);
+const value53431 = compute(value, 81);
+const value69544 = compute(value, 92);
+const value72026 = compute(value, 52);
+const value75186 = compute(value, 11);
+const value42628 = compute(value, 45);
+const value54710 = compute(value, 2);
+const value54955 = compute(value, 53);
+const value20691 = compute(value, 30);
+const v = process.env.BENCH_KEY_01759;
+const value53380 = compute(value, 30);
+const value55434 = compute(value, 47);
+const value69674 = compute(value, 28);
+const value36457 = compute(value, 82);
+const value65116 = compute(value, 29);
+const value40914 = compute(value, 77);
+const value44546 = compute(value, 23);
+const value66353 = compute(value, 5);
+const value99119 = compute(value, 82);
+const value42116 = compute(value, 18);
+const value49252 = compute(value, 73);
+const value21048 = compute(value, 96);
+// note 64528: keep this in sync with the handler
+const value13185 = compute(value, 90);
+const value32717 = compute(value, 28);
+const value31407 = compute(value, 76);
+const value78713 = compute(value, 46);
+const value50989 = compute(value, 64);
+const value39094 = compute(value, 3);
+const v = import.meta.env.BENCH_KEY_01625;
+const value12463 = compute(value, 47);
+const value81470 = compute(value, 87);
+// note 12420: keep this in sync with the handler
+// note 41848: keep this in sync with the handler
+const value47161 = compute(value, 19);
+const value20247 = compute(value, 71);
+const value64527 = compute(value, 22);
+const value23529 = compute(value, 55);
+const value9501 = compute(value, 92);
+const value88747 = compute(value, 89);
+const value94601 = compute(value, 26);
+const value4694 = compute(value, 38);
+const value32651 = compute(value, 59);
+const value2278 = compute(value, 47);
+const value11245 = compute(value, 90);
+const value56445 = compute(value, 88);
+const value72905 = compute(value, 58);
+const v = import.meta.env.BENCH_KEY_00592;
+const value14445 = compute(value, 89);
+const value49585 = compute(value, 18);
+// note 47762: keep this in sync with the handler
+const value22064 = compute(value, 45);
+const value78872 = compute(value, 11);
+const value55420 = compute(value, 33);
+const value94570 = compute(value, 92);
+const value35525 = compute(value, 23);
+const value614 = compute(value, 32);
+const value90529 = compute(value, 28);
+const value67231 = compute(value, 10);
+const value28208 = compute(value, 78);
+const v = import.meta.env.BENCH_KEY_01178;
+const value16205 = compute(value, 6);
+const value59690 = compute(value, 35);
+const value43974 = compute(value, 33);
+const value30557 = compute(value, 2);
+const value97479 = compute(value, 91);
+const value49992 = compute(value, 37);
+// note 79771: keep this in sync with the handler
+// note 36850: keep this in sync with the handler
+const value1069 = compute(value, 2);
+const value5418 = compute(value, 83);
+const value47578 = compute(value, 48);
+const v = process.env.BENCH_KEY_01482;
+const value3752 = compute(value, 66);
+const value45319 = compute(value, 20);
+const value58319 = compute(value, 22);
+const value58592 = compute(value, 4);
+// note 22952: keep this in sync with the handler
+const value28648 = compute(value, 33);
+const value35992 = compute(value, 5);
+const value6385 = compute(value, 80);
+const v = import.meta.env.BENCH_KEY_00905;
+const value48703 = compute(value, 9);
+const value32404 = compute(value, 6);
+const value65221 = compute(value, 37);
+const value30474 = compute(value, 16);
+const value90696 = compute(value, 1);
+// note 98385: keep this in sync with the handler
+// note 43953: keep this in sync with the handler
+const value67038 = compute(value, 11);
+const value66028 = compute(value, 68);
+const value9757 = compute(value, 57);
+const v = import.meta.env.BENCH_KEY_01852;
+const value93891 = compute(value, 92);
+const value10075 = compute(value, 84);
+const value70320 = compute(value, 92);
+const value67036 = compute(value, 9);
+const value36350 = compute(value, 72);
+const value85048 = compute(value, 76);
+const value87903 = compute(value, 21);
+const value78894 = compute(value, 33);
+const value56474 = compute(value, 20);
+const value15971 = compute(value, 63);
+const value31066 = compute(value, 26);
+const value89772 = compute(value, 47);
+const value27665 = compute(value, 20);
+const value74792 = compute(value, 5);
+const value64203 = compute(value, 86);
+// note 23891: keep this in sync with the handler
+const value51238 = compute(value, 22);
+const v = process.env["BENCH_KEY_01935"];
+// note 55033: keep this in sync with the handler
+const value21605 = compute(value, 71);
+const value6889 = compute(value, 2);
+// note 30168: keep this in sync with the handler
+const value19228 = compute(value, 22);
+const value76601 = compute(value, 68);
+const value99216 = compute(value, 82);
+// note 21315: keep this in sync with the handler
+const value53259 = compute(value, 6);
+const value97398 = compute(value, 10);
+const value24479 = compute(value, 35);
+const value22123 = compute(value, 7);
+const value11942 = compute(value, 11);
+const value22600 = compute(value, 96);
+const value65121 = compute(value, 34);
+const value30210 = compute(value, 43);
+const value15737 = compute(value, 23);
+const v = process.env["BENCH_KEY_01869"];
+const value74640 = compute(value, 47);
+const value27543 = compute(value, 92);
+const value28046 = compute(value, 13);
+const value21409 = compute(value, 69);
+const value93733 = compute(value, 31);
+const value7987 = compute(value, 33);
+const value79488 = compute(value, 45);
+const value27258 = compute(value, 1);
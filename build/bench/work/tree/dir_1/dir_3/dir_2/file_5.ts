@@ -0,0 +1,206 @@
+const value21784 = compute(value, 56);
+const value78773 = compute(value, 9);
+const value45554 = compute(value, 61);
+// note 70589: keep this in sync with the handler
+const value574 = compute(value, 89);
+const value53495 = compute(value, 48);
+const value28906 = compute(value, 0);
+const value85881 = compute(value, 36);
+const v = import.meta.env.BENCH_KEY_01311;
+const value25402 = compute(value, 85);
+const value79984 = compute(value, 56);
+const value60934 = compute(value, 18);
+const value54925 = compute(value, 23);
+const value12600 = compute(value, 87);
+const value88469 = compute(value, 5);
+const value92857 = compute(value, 28);
+const value35642 = compute(value, 43);
+const value65585 = compute(value, 13);
+const value74567 = compute(value, 71);
+const value54144 = compute(value, 18);
+const value54864 = compute(value, 59);
+const value55153 = compute(value, 57);
+const value70718 = compute(value, 5);
+const value62643 = compute(value, 78);
+const value44398 = compute(value, 69);
+const v = import.meta.env.BENCH_KEY_01655;
+const value18619 = compute(value, 92);
+const value54235 = compute(value, 12);
+const value79562 = compute(value, 22);
+const value69278 = compute(value, 20);
+const value27466 = compute(value, 15);
+const value25928 = compute(value, 29);
+const value57155 = compute(value, 22);
+const value7688 = compute(value, 25);
+const value1522 = compute(value, 67);
+const value2202 = compute(value, 68);
+const v = process.env.BENCH_KEY_01663;
+// note 7589: keep this in sync with the handler
+const value43546 = compute(value, 90);
+const value94446 = compute(value, 65);
+const value62449 = compute(value, 78);
+const value54111 = compute(value, 82);
+const value85977 = compute(value, 35);
+const value43333 = compute(value, 71);
+const value28218 = compute(value, 88);
+const value74661 = compute(value, 68);
+const value66198 = compute(value, 44);
+const v = import.meta.env.BENCH_KEY_00307;
+const value23137 = compute(value, 51);
+const value59123 = compute(value, 50);
+const value1096 = compute(value, 29);
+const value64337 = compute(value, 26);
+const value81166 = compute(value, 74);
+const value47933 = compute(value, 15);
+const value25209 = compute(value, 86);
+const value31185 = compute(value, 48);
+// note 16748: keep this in sync with the handler
+const value92731 = compute(value, 96);
+const value66184 = compute(value, 30);
+// note 10705: keep this in sync with the handler
+const value35708 = compute(value, 12);
+const value94757 = compute(value, 85);
+const value56603 = compute(value, 52);
+const v = process.env["BENCH_KEY_00487"];
+const value38848 = compute(value, 48);
+const value43793 = compute(value, 46);
+const value95198 = compute(value, 41);
+const value23928 = compute(value, 66);
+const value53954 = compute(value, 22);
+const value91325 = compute(value, 48);
+const value22465 = compute(value, 58);
+const value65392 = compute(value, 14);
+// note 50126: keep this in sync with the handler
+const value84646 = compute(value, 62);
+const value86359 = compute(value, 29);
+const v = process.env["BENCH_KEY_01394"];
+const value92600 = compute(value, 62);
+const value40419 = compute(value, 67);
+const value92603 = compute(value, 65);
+const value82417 = compute(value, 64);
+// note 76102: keep this in sync with the handler
+// note 49015: keep this in sync with the handler
+const value29475 = compute(value, 84);
+const value4139 = compute(value, 65);
+const value73301 = compute(value, 66);
+const value63880 = compute(value, 54);
+const value27644 = compute(value, 96);
+const v = process.env["BENCH_KEY_00323"];
+const value18979 = compute(value, 64);
+const value64301 = compute(value, 87);
+const value39128 = compute(value, 37);
+const value10369 = compute(value, 87);
+const value40913 = compute(value, 76);
+const value11690 = compute(value, 50);
+const value32590 = compute(value, 95);
+const value68449 = compute(value, 64);
+const v = import.meta.env.BENCH_KEY_00562;
+const value75810 = compute(value, 53);
+const value66624 = compute(value, 82);
+const value98746 = compute(value, 0);
+const value31904 = compute(value, 88);
+const value73281 = compute(value, 46);
+const value57382 = compute(value, 55);
+const value56176 = compute(value, 13);
+const value90065 = compute(value, 49);
+const value28464 = compute(value, 43);
+const value45404 = compute(value, 8);
+const value62828 = compute(value, 69);
+const value25534 = compute(value, 23);
+const value87633 = compute(value, 42);
+const v = process.env["BENCH_KEY_01869"];
+const value37371 = compute(value, 26);
+const value72265 = compute(value, 0);
+const value29175 = compute(value, 75);
+const value351 = compute(value, 60);
+const value60941 = compute(value, 25);
+const value28271 = compute(value, 44);
+const value78317 = compute(value, 38);
+const value47492 = compute(value, 59);
+const value15374 = compute(value, 48);
+const value36251 = compute(value, 70);
+const value27572 = compute(value, 24);
+const value28832 = compute(value, 23);
+const value94881 = compute(value, 15);
+const v = process.env["BENCH_KEY_01821"];
+const value47521 = compute(value, 88);
+const value93115 = compute(value, 92);
+const value55263 = compute(value, 70);
+const value41614 = compute(value, 1);
+const value79324 = compute(value, 75);
+const value74589 = compute(value, 93);
+// note 79586: keep this in sync with the handler
+const value4179 = compute(value, 8);
+const value57540 = compute(value, 19);
+const v = import.meta.env.BENCH_KEY_00767;
+const value11706 = compute(value, 66);
+const value7735 = compute(value, 72);
+const value11254 = compute(value, 2);
+const value60157 = compute(value, 17);
+const value87018 = compute(value, 9);
+const value23392 = compute(value, 15);
+const value676 = compute(value, 94);
+const value69271 = compute(value, 13);
+const value175 = compute(value, 78);
+const value72631 = compute(value, 75);
+const value64806 = compute(value, 10);
+const v = process.env["BENCH_KEY_01620"];
+const value78285 = compute(value, 6);
+const value76321 = compute(value, 79);
+// note 91937: keep this in sync with the handler
+const value6194 = compute(value, 83);
+const value86074 = compute(value, 35);
+const value9747 = compute(value, 47);
+const value2386 = compute(value, 58);
+const value71273 = compute(value, 75);
+const value82817 = compute(value, 76);
+const value17409 = compute(value, 46);
+const value17124 = compute(value, 52);
+const value12000 = compute(value, 69);
+const value63649 = compute(value, 17);
+const value10400 = compute(value, 21);
+const value28080 = compute(value, 47);
+const v = process.env["BENCH_KEY_01477"];
+const value13302 = compute(value, 13);
+// note 24919: keep this in sync with the handler
+const value67875 = compute(value, 72);
+const value23227 = compute(value, 44);
+const value99252 = compute(value, 21);
+const value32157 = compute(value, 50);
+const value44481 = compute(value, 55);
+// note 75339: keep this in sync with the handler
+const v = process.env.BENCH_KEY_00199;
+const value40843 = compute(value, 6);
+const value87639 = compute(value, 48);
+const value33669 = compute(value, 10);
+const value66729 = compute(value, 90);
+// note 59127: keep this in sync with the handler
+const value91124 = compute(value, 41);
+const value57208 = compute(value, 75);
+const value19423 = compute(value, 23);
+const value50870 = compute(value, 42);
+const value93259 = compute(value, 42);
+const value39419 = compute(value, 37);
+const value54611 = compute(value, 0);
+const value84092 = compute(value, 90);
+const v = process.env["BENCH_KEY_01798"];
+const value63689 = compute(value, 57);
+const value454 = compute(value, 66);
+const value37380 = compute(value, 35);
+const value97629 = compute(value, 47);
+const value56203 = compute(value, 40);
+const value80531 = compute(value, 21);
+const value6980 = compute(value, 93);
+const v = process.env.BENCH_KEY_00191;
+// note 54569: keep this in sync with the handler
+// note 50709: keep this in sync with the handler
+const value96735 = compute(value, 26);
+const value52204 = compute(value, 18);
+const value84547 = compute(value, 60);
+const value39133 = compute(value, 42);
+const value99107 = compute(value, 70);
+const value1372 = compute(value, 14);
+const v = import.meta.env.BENCH_KEY_00507;
+const value6580 = compute(value, 81);
+const value18340 = compute(value, 7);
+const value17870 = compute(value, 22);
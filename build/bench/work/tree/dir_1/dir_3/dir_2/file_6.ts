@@ -0,0 +1,204 @@
+const value37080 = compute(value, 26);
+const value5222 = compute(value, 81);
+const value43400 = compute(value, 41);
+const value36350 = compute(value, 72);
+const v = process.env["BENCH_KEY_01517"];
+// note 40159: keep this in sync with the handler
+// note 76754: keep this in sync with the handler
+const value42292 = compute(value, 0);
+const value98996 = compute(value, 56);
+const value9840 = compute(value, 43);
+const value53729 = compute(value, 88);
+const value52410 = compute(value, 30);
+const value85795 = compute(value, 47);
+const value69587 = compute(value, 38);
+const value81968 = compute(value, 3);
+const value91149 = compute(value, 66);
+const value69289 = compute(value, 31);
+const value64973 = compute(value, 80);
+const value16793 = compute(value, 12);
+const value25232 = compute(value, 12);
+const value7979 = compute(value, 25);
+// note 79145: keep this in sync with the handler
+const v = import.meta.env.BENCH_KEY_00349;
+const value54938 = compute(value, 36);
+// note 60136: keep this in sync with the handler
+const value86043 = compute(value, 4);
+const value95426 = compute(value, 75);
+const value65039 = compute(value, 49);
+const value95402 = compute(value, 51);
+const value85073 = compute(value, 4);
+const value89433 = compute(value, 96);
+const value81787 = compute(value, 16);
+const value4737 = compute(value, 81);
+const value83413 = compute(value, 90);
+const value66992 = compute(value, 62);
+const value61764 = compute(value, 72);
+const value13784 = compute(value, 10);
+const v = import.meta.env.BENCH_KEY_00267;
+const value7263 = compute(value, 85);
+const value6943 = compute(value, 56);
+const value40214 = compute(value, 56);
+const value24550 = compute(value, 9);
+const value38796 = compute(value, 93);
+const value88839 = compute(value, 84);
+const value74001 = compute(value, 87);
+const value107 = compute(value, 10);
+const value43190 = compute(value, 25);
+const v = process.env["BENCH_KEY_00607"];
+// note 75555: keep this in sync with the handler
+const value95235 = compute(value, 78);
+const value4314 = compute(value, 46);
+const value71771 = compute(value, 88);
+const value52565 = compute(value, 88);
+const value93010 = compute(value, 84);
+const value61755 = compute(value, 63);
+const value37071 = compute(value, 17);
+const value79480 = compute(value, 37);
+const value39307 = compute(value, 22);
+// note 12829: keep this in sync with the handler
+// note 94192: keep this in sync with the handler
+const value1228 = compute(value, 64);
+const value46624 = compute(value, 64);
+const value35307 = compute(value, 96);
+const value89695 = compute(value, 67);
+const value8665 = compute(value, 32);
+const value11659 = compute(value, 19);
+const v = process.env["BENCH_KEY_01596"];
+const value37546 = compute(value, 7);
+const value97715 = compute(value, 36);
+// note 85669: keep this in sync with the handler
+// note 90342: keep this in sync with the handler
+const value14569 = compute(value, 19);
+// note 26067: keep this in sync with the handler
+const v = import.meta.env.BENCH_KEY_00830;
+const value63233 = compute(value, 86);
+const value59271 = compute(value, 4);
+const value20851 = compute(value, 93);
+const value14678 = compute(value, 31);
+const value84399 = compute(value, 9);
+const value35702 = compute(value, 6);
+// note 47413: keep this in sync with the handler
+const value89427 = compute(value, 90);
+const value34769 = compute(value, 43);
+// note 13669: keep this in sync with the handler
+const value6095 = compute(value, 81);
+const value58235 = compute(value, 35);
+const value68022 = compute(value, 25);
+const value47441 = compute(value, 8);
+const value24373 = compute(value, 26);
+// note 24128: keep this in sync with the handler
+// note 25864: keep this in sync with the handler
+// note 35575: keep this in sync with the handler
+const v = process.env.BENCH_KEY_01652;
+const value81184 = compute(value, 92);
+const value13622 = compute(value, 42);
+const value19689 = compute(value, 95);
+// note 18082: keep this in sync with the handler
+// note 31253: keep this in sync with the handler
+const value82476 = compute(value, 26);
+const value88549 = compute(value, 85);
+const value55194 = compute(value, 1);
+// note 91794: keep this in sync with the handler
+const value68267 = compute(value, 76);
+const value59988 = compute(value, 42);
+const value86971 = compute(value, 59);
+// note 6665: keep this in sync with the handler
+const value30037 = compute(value, 64);
+const value38907 = compute(value, 10);
+const v = process.env.BENCH_KEY_00342;
+const value88652 = compute(value, 91);
+const value51425 = compute(value, 15);
+const value97988 = compute(value, 18);
+const value96866 = compute(value, 60);
+const value37389 = compute(value, 44);
+const value30135 = compute(value, 65);
+const value48447 = compute(value, 44);
+// note 74260: keep this in sync with the handler
+const value2307 = compute(value, 76);
+const value15213 = compute(value, 81);
+const value8306 = compute(value, 61);
+const value42771 = compute(value, 91);
+const value85461 = compute(value, 4);
+const value55375 = compute(value, 85);
+const value67177 = compute(value, 53);
+const value41228 = compute(value, 3);
+const value64919 = compute(value, 26);
+const value77304 = compute(value, 92);
+const v = process.env["BENCH_KEY_00700"];
+const value96156 = compute(value, 29);
+const value98963 = compute(value, 23);
+const value48149 = compute(value, 37);
+const value64731 = compute(value, 32);
+const value38321 = compute(value, 6);
+// note 9542: keep this in sync with the handler
+const value30329 = compute(value, 65);
+const v = process.env.BENCH_KEY_00795;
+const value86981 = compute(value, 69);
+const value84747 = compute(value, 66);
+const value51093 = compute(value, 71);
+const value11199 = compute(value, 44);
+const value28771 = compute(value, 59);
+const value48574 = compute(value, 74);
+const value93830 = compute(value, 31);
+const value14994 = compute(value, 56);
+const value81406 = compute(value, 23);
+const value48606 = compute(value, 9);
+const value80288 = compute(value, 69);
+const value91186 = compute(value, 6);
+const value26233 = compute(value, 43);
+const value20796 = compute(value, 38);
+const value15635 = compute(value, 18);
+const value80386 = compute(value, 70);
+const value75196 = compute(value, 21);
+const value14796 = compute(value, 52);
+const v = process.env.BENCH_KEY_00256;
+const value17113 = compute(value, 41);
+const value49608 = compute(value, 41);
+const value35597 = compute(value, 95);
+const value93486 = compute(value, 75);
+// note 48037: keep this in sync with the handler
+const value69484 = compute(value, 32);
+const value66643 = compute(value, 4);
+const value67296 = compute(value, 75);
+const value95649 = compute(value, 7);
+const value54979 = compute(value, 77);
+const value26622 = compute(value, 44);
+const value67008 = compute(value, 78);
+const value69268 = compute(value, 10);
+const value86095 = compute(value, 56);
+const value23047 = compute(value, 58);
+const value89238 = compute(value, 95);
+const value41809 = compute(value, 2);
+const value40917 = compute(value, 80);
+const v = import.meta.env.BENCH_KEY_00036;
+const value3162 = compute(value, 58);
+const value74137 = compute(value, 29);
+// note 76323: keep this in sync with the handler
+const value28192 = compute(value, 62);
+const value62080 = compute(value, 0);
+const value88835 = compute(value, 80);
+const value42783 = compute(value, 6);
+const value99098 = compute(value, 61);
+const v = import.meta.env.BENCH_KEY_00618;
+const value70076 = compute(value, 42);
+const value33888 = compute(value, 35);
+const value74078 = compute(value, 67);
+const value16951 = compute(value, 73);
+const value97550 = compute(value, 65);
+const value55513 = compute(value, 29);
+const value86990 = compute(value, 78);
+const value57686 = compute(value, 68);
+const value25345 = compute(value, 28);
+const value97977 = compute(value, 7);
+const value23647 = compute(value, 76);
+const value44015 = compute(value, 74);
+const value83951 = compute(value, 46);
+const v = import.meta.env.BENCH_KEY_00401;
+const value44833 = compute(value, 19);
+const value70182 = compute(value, 51);
+// note 98666: keep this in sync with the handler
+const value67660 = compute(value, 51);
+const value15437 = compute(value, 14);
+const value20395 = compute(value, 25);
+const value92512 = compute(value, 71);
@@ -0,0 +1,240 @@
+value59221 = compute(value, 51)
+value73517 = compute(value, 88)
+value95172 = compute(value, 15)
+value81026 = compute(value, 31)
+value44237 = compute(value, 5)
+value63159 = compute(value, 12)
+const v = os.getenv("BENCH_KEY_01463");
+value29349 = compute(value, 55)
+value30402 = compute(value, 41)
+value43053 = compute(value, 82)
+# note 2897: keep this in sync with the handler
+value644 = compute(value, 62)
+value10733 = compute(value, 63)
+value90904 = compute(value, 15)
+value38127 = compute(value, 6)
+value17972 = compute(value, 27)
+value5251 = compute(value, 13)
+value51087 = compute(value, 65)
+value98457 = compute(value, 2)
+value51134 = compute(value, 15)
+value20992 = compute(value, 40)
+value10832 = compute(value, 65)
+value8196 = compute(value, 48)
+value58984 = compute(value, 8)
+value75955 = compute(value, 4)
+value50463 = compute(value, 23)
+value33828 = compute(value, 72)
+# note 55713: keep this in sync with the handler
+value78024 = compute(value, 36)
+const v = os.getenv("BENCH_KEY_01281");
+value21830 = compute(value, 5)
+value60965 = compute(value, 49)
+value9380 = compute(value, 68)
+value24674 = compute(value, 36)
+# note 63429: keep this in sync with the handler
+value47889 = compute(value, 68)
+# note 90076: keep this in sync with the handler
+value67782 = compute(value, 76)
+value6750 = compute(value, 57)
+# note 34380: keep this in sync with the handler
+value46878 = compute(value, 27)
+value9273 = compute(value, 58)
+value67970 = compute(value, 70)
+value52611 = compute(value, 37)
+const v = os.environ.get('BENCH_KEY_00511');
+value47634 = compute(value, 7)
+value88760 = compute(value, 5)
+value14002 = compute(value, 34)
+value74642 = compute(value, 49)
+value94947 = compute(value, 81)
+value36839 = compute(value, 76)
+value77442 = compute(value, 36)
+value98866 = compute(value, 23)
+value81933 = compute(value, 65)
+value40521 = compute(value, 72)
+value34276 = compute(value, 35)
+value66192 = compute(value, 38)
+const v = os.environ.get('BENCH_KEY_01509');
+# note 6713: keep this in sync with the handler
+value16254 = compute(value, 55)
+value209 = compute(value, 15)
+value74186 = compute(value, 78)
+value67367 = compute(value, 49)
+value36575 = compute(value, 6)
+value62001 = compute(value, 18)
+value20702 = compute(value, 41)
+value56412 = compute(value, 55)
+value80994 = compute(value, 96)
+value29943 = compute(value, 67)
+value83080 = compute(value, 48)
+value2991 = compute(value, 81)
+# note 56725: keep this in sync with the handler
+const v = os.environ.get('BENCH_KEY_00482');
+value34930 = compute(value, 10)
+value98150 = compute(value, 83)
+# note 46131: keep this in sync with the handler
+value71174 = compute(value, 73)
+value65773 = compute(value, 7)
+value97977 = compute(value, 7)
+# note 9048: keep this in sync with the handler
+value95925 = compute(value, 89)
+value74856 = compute(value, 69)
+value31941 = compute(value, 28)
+value96951 = compute(value, 48)
+value89756 = compute(value, 31)
+value57524 = compute(value, 3)
+value62189 = compute(value, 12)
+value41938 = compute(value, 34)
+value43802 = compute(value, 55)
+const v = os.getenv("BENCH_KEY_01699");
+value25640 = compute(value, 32)
+# note 22181: keep this in sync with the handler
+value20101 = compute(value, 22)
+value55072 = compute(value, 73)
+value36494 = compute(value, 22)
+value23510 = compute(value, 36)
+# note 99090: keep this in sync with the handler
+value40511 = compute(value, 62)
+value88621 = compute(value, 60)
+value69255 = compute(value, 94)
+value33275 = compute(value, 4)
+value59489 = compute(value, 28)
+# note 1536: keep this in sync with the handler
+const v = os.getenv("BENCH_KEY_01359");
+value23450 = compute(value, 73)
+value17788 = compute(value, 37)
+value5421 = compute(value, 86)
+value19525 = compute(value, 28)
+value92575 = compute(value, 37)
+value21914 = compute(value, 89)
+value21112 = compute(value, 63)
+value80725 = compute(value, 21)
+value90979 = compute(value, 90)
+value96059 = compute(value, 29)
+value90361 = compute(value, 54)
+value26313 = compute(value, 26)
+value26848 = compute(value, 76)
+value55215 = compute(value, 22)
+# note 60172: keep this in sync with the handler
+value3496 = compute(value, 4)
+value77675 = compute(value, 75)
+value51741 = compute(value, 40)
+value76663 = compute(value, 33)
+value65846 = compute(value, 80)
+value74302 = compute(value, 0)
+value27367 = compute(value, 13)
+value30970 = compute(value, 27)
+const v = os.environ.get('BENCH_KEY_01870');
+value45581 = compute(value, 88)
+# note 88228: keep this in sync with the handler
+value73595 = compute(value, 69)
+value75204 = compute(value, 29)
+value76291 = compute(value, 49)
+value39194 = compute(value, 6)
+value72753 = compute(value, 3)
+# note 8513: keep this in sync with the handler
+value85920 = compute(value, 75)
+value60554 = compute(value, 26)
+value64416 = compute(value, 8)
+value30502 = compute(value, 44)
+value41796 = compute(value, 86)
+value62355 = compute(value, 81)
+value8402 = compute(value, 60)
+# note 83632: keep this in sync with the handler
+value61175 = compute(value, 65)
+value65488 = compute(value, 13)
+const v = os.environ.get('BENCH_KEY_00980');
+value58738 = compute(value, 53)
+value95556 = compute(value, 11)
+value2446 = compute(value, 21)
+value88291 = compute(value, 21)
+value68482 = compute(value, 0)
+value26740 = compute(value, 65)
+value75981 = compute(value, 30)
+value11576 = compute(value, 33)
+value20871 = compute(value, 16)
+value15941 = compute(value, 33)
+# note 94749: keep this in sync with the handler
+value46128 = compute(value, 53)
+value54372 = compute(value, 52)
+value30366 = compute(value, 5)
+value2433 = compute(value, 8)
+# note 37299: keep this in sync with the handler
+value94892 = compute(value, 26)
+value27862 = compute(value, 23)
+value93186 = compute(value, 66)
+value52483 = compute(value, 6)
+value33883 = compute(value, 30)
+const v = os.environ["BENCH_KEY_00563"];
+# note 73631: keep this in sync with the handler
+value95946 = compute(value, 13)
+# note 95092: keep this in sync with the handler
+value81472 = compute(value, 89)
+value5112 = compute(value, 68)
+# note 88993: keep this in sync with the handler
+value91487 = compute(value, 16)
+value22120 = compute(value, 4)
+value28189 = compute(value, 59)
+value31361 = compute(value, 30)
+# note 2636: keep this in sync with the handler
+value85104 = compute(value, 35)
+value79849 = compute(value, 18)
+# note 55099: keep this in sync with the handler
+value2482 = compute(value, 57)
+value72173 = compute(value, 5)
+value39339 = compute(value, 54)
+value59112 = compute(value, 39)
+value24468 = compute(value, 24)
+value57383 = compute(value, 56)
+const v = os.environ.get('BENCH_KEY_00756');
+value18836 = compute(value, 18)
+value21034 = compute(value, 82)
+value37876 = compute(value, 46)
+value3393 = compute(value, 95)
+value57718 = compute(value, 3)
+value42302 = compute(value, 10)
+value40396 = compute(value, 44)
+value90760 = compute(value, 65)
+value77799 = compute(value, 5)
+value76288 = compute(value, 46)
+value61500 = compute(value, 2)
+value55927 = compute(value, 55)
+value31755 = compute(value, 36)
+value64123 = compute(value, 6)
+value87738 = compute(value, 50)
+value20770 = compute(value, 12)
+value40559 = compute(value, 13)
+value48904 = compute(value, 16)
+value53615 = compute(value, 71)
+# note 66805: keep this in sync with the handler
+value69700 = compute(value, 54)
+value67703 = compute(value, 94)
+value36259 = compute(value, 78)
+const v = os.getenv("BENCH_KEY_01967");
+# note 17737: keep this in sync with the handler
+value22797 = compute(value, 2)
+value39090 = compute(value, 96)
+value3846 = compute(value, 63)
+value27687 = compute(value, 42)
+value96849 = compute(value, 43)
+# note 52504: keep this in sync with the handler
+value70074 = compute(value, 40)
+value92583 = compute(value, 45)
+const v = os.environ.get('BENCH_KEY_01784');
+value36936 = compute(value, 76)
+value89250 = compute(value, 10)
+value81549 = compute(value, 69)
+value23815 = compute(value, 50)
+value14420 = compute(value, 64)
+value60467 = compute(value, 36)
+value93110 = compute(value, 87)
+value31029 = compute(value, 86)
+value4084 = compute(value, 10)
+value41301 = compute(value, 76)
+value49641 = compute(value, 74)
+value43379 = compute(value, 20)
+value99211 = compute(value, 77)
+value58564 = compute(value, 73)
+const v = os.getenv("BENCH_KEY_00069");
+value48018 = compute(value, 3)
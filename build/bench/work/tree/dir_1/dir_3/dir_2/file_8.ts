@@ -0,0 +1,205 @@
+// note 8429: keep this in sync with the handler
+const value93780 = compute(value, 78);
+const v = process.env.BENCH_KEY_00824;
+const value71716 = compute(value, 33);
+// note 37618: keep this in sync with the handler
+const value42146 = compute(value, 48);
+const value74644 = compute(value, 51);
+const value35674 = compute(value, 75);
+const value36771 = compute(value, 8);
+const value27117 = compute(value, 54);
+const value1992 = compute(value, 52);
+const v = import.meta.env.BENCH_KEY_01679;
+// note 43674: keep this in sync with the handler
+const value57512 = compute(value, 88);
+const value15602 = compute(value, 82);
+const value24790 = compute(value, 55);
+// note 96706: keep this in sync with the handler
+const value47622 = compute(value, 92);
+const value1224 = compute(value, 60);
+const value20748 = compute(value, 87);
+const value44920 = compute(value, 9);
+const value2628 = compute(value, 9);
+const value20363 = compute(value, 90);
+const value60773 = compute(value, 51);
+const value35684 = compute(value, 85);
+const v = process.env.BENCH_KEY_00783;
+const value78261 = compute(value, 79);
+const value72315 = compute(value, 50);
+const value11295 = compute(value, 43);
+const value20222 = compute(value, 46);
+const value63360 = compute(value, 19);
+// note 13338: keep this in sync with the handler
+const value37161 = compute(value, 10);
+const value32523 = compute(value, 28);
+const value65386 = compute(value, 8);
+const value88432 = compute(value, 65);
+const value51721 = compute(value, 20);
+// note 59538: keep this in sync with the handler
+const value66834 = compute(value, 1);
+const v = process.env["BENCH_KEY_00472"];
+const value38082 = compute(value, 58);
+const value84132 = compute(value, 33);
+const value32360 = compute(value, 59);
+const value36732 = compute(value, 66);
+const value49686 = compute(value, 22);
+const value19517 = compute(value, 20);
+const value88440 = compute(value, 73);
+const value84199 = compute(value, 3);
+const value44324 = compute(value, 92);
+// note 58682: keep this in sync with the handler
+const v = process.env.BENCH_KEY_01187;
+const value49538 = compute(value, 68);
+const value60669 = compute(value, 44);
+const value37566 = compute(value, 27);
+const value72251 = compute(value, 83);
+const value38213 = compute(value, 92);
+const value93871 = compute(value, 72);
+const value47110 = compute(value, 65);
+const value41185 = compute(value, 57);
+const value1449 = compute(value, 91);
+// note 88174: keep this in sync with the handler
+const value81231 = compute(value, 42);
+const value12985 = compute(value, 84);
+const value17240 = compute(value, 71);
+const value30193 = compute(value, 26);
+const v = import.meta.env.BENCH_KEY_01067;
+const value99818 = compute(value, 5);
+const value76790 = compute(value, 63);
+const value51655 = compute(value, 51);
+const value46777 = compute(value, 23);
+const value33187 = compute(value, 13);
+const value57487 = compute(value, 63);
+const value34098 = compute(value, 51);
+const value912 = compute(value, 39);
+const value31667 = compute(value, 45);
+// note 71148: keep this in sync with the handler
+const value76372 = compute(value, 33);
+const value11638 = compute(value, 95);
+const value25708 = compute(value, 3);
+const v = process.env["BENCH_KEY_00586"];
+const value78128 = compute(value, 43);
+const value49252 = compute(value, 73);
+const value46081 = compute(value, 6);
+// note 77218: keep this in sync with the handler
+const value24103 = compute(value, 47);
+const value59826 = compute(value, 74);
+const value75623 = compute(value, 60);
+const value6733 = compute(value, 40);
+const value88149 = compute(value, 73);
+const value24719 = compute(value, 81);
+const value49703 = compute(value, 39);
+const v = process.env["BENCH_KEY_01305"];
+const value2996 = compute(value, 86);
+const value36242 = compute(value, 61);
+const value23981 = compute(value, 22);
+const value70098 = compute(value, 64);
+const value2305 = compute(value, 74);
+const value20518 = compute(value, 51);
+const value39051 = compute(value, 57);
+const value11876 = compute(value, 42);
+const value16109 = compute(value, 7);
+const value47875 = compute(value, 54);
+const value33270 = compute(value, 96);
+const value57453 = compute(value, 29);
+const v = process.env.BENCH_KEY_01134;
+// note 28057: keep this in sync with the handler
+const value55395 = compute(value, 8);
+const value46701 = compute(value, 44);
+const value69639 = compute(value, 90);
+const value86844 = compute(value, 29);
+const value78599 = compute(value, 29);
+const value9837 = compute(value, 40);
+const value58301 = compute(value, 4);
+const value38039 = compute(value, 15);
+const value35100 = compute(value, 83);
+const v = process.env.BENCH_KEY_00516;
+const value68364 = compute(value, 76);
+const value58687 = compute(value, 2);
+const value39654 = compute(value, 78);
+const value21163 = compute(value, 17);
+const value57532 = compute(value, 11);
+const value85649 = compute(value, 95);
+const value7083 = compute(value, 2);
+const value85083 = compute(value, 14);
+const value52669 = compute(value, 95);
+const value83562 = compute(value, 45);
+const v = process.env["BENCH_KEY_00819"];
+// note 52472: keep this in sync with the handler
+const value97202 = compute(value, 8);
+const value17382 = compute(value, 19);
+const value93406 = compute(value, 92);
+const value44050 = compute(value, 12);
+const value56739 = compute(value, 91);
+const value81605 = compute(value, 28);
+const value19603 = compute(value, 9);
+const value82405 = compute(value, 52);
+const value27157 = compute(value, 94);
+const value21600 = compute(value, 66);
+const value29831 = compute(value, 52);
+// note 64266: keep this in sync with the handler
+const value43174 = compute(value, 9);
+const value77148 = compute(value, 33);
+const value43175 = compute(value, 10);
+const v = process.env["BENCH_KEY_00584"];
+const value7030 = compute(value, 46);
+const value97148 = compute(value, 51);
+const value43791 = compute(value, 44);
+const value11666 = compute(value, 26);
+const value92053 = compute(value, 0);
+const value21455 = compute(value, 18);
+const value92544 = compute(value, 6);
+const value87454 = compute(value, 57);
+const value21479 = compute(value, 42);
+const value86840 = compute(value, 25);
+const value93091 = compute(value, 68);
+const value62191 = compute(value, 14);
+const value60158 = compute(value, 18);
+const value93053 = compute(value, 30);
+const value24178 = compute(value, 25);
+const value1323 = compute(value, 62);
+const value18215 = compute(value, 76);
+const value40326 = compute(value, 71);
+const value534 = compute(value, 49);
+const value43735 = compute(value, 85);
+const v = import.meta.env.BENCH_KEY_00016;
+// note 41236: keep this in sync with the handler
+const value93548 = compute(value, 40);
+const value50198 = compute(value, 49);
+const value32706 = compute(value, 17);
+const value49573 = compute(value, 6);
+const value53745 = compute(value, 7);
+const value99965 = compute(value, 55);
+const value43419 = compute(value, 60);
+const value30883 = compute(value, 37);
+const v = process.env.BENCH_KEY_00315;
+const value30736 = compute(value, 84);
+// note 1515: keep this in sync with the handler
+const value11612 = compute(value, 69);
+const value71086 = compute(value, 82);
+// note 53650: keep this in sync with the handler
+// note 64828: keep this in sync with the handler
+const value18518 = compute(value, 88);
+const value62437 = compute(value, 66);
+const value45246 = compute(value, 44);
+const value2208 = compute(value, 74);
+const value67220 = compute(value, 96);
+const value94778 = compute(value, 9);
+const value59783 = compute(value, 31);
+const value63762 = compute(value, 33);
+// note 52102: keep this in sync with the handler
+const value10823 = compute(value, 56);
+const v = import.meta.env.BENCH_KEY_01367;
+const value68505 = compute(value, 23);
+const value25610 = compute(value, 2);
+const value86968 = compute(value, 56);
+const value87320 = compute(value, 20);
+const value92981 = compute(value, 55);
+// note 2327: keep this in sync with the handler
+const value5500 = compute(value, 68);
+const value44325 = compute(value, 93);
+const value81876 = compute(value, 8);
+const value65553 = compute(value, 78);
+const v = process.env["BENCH_KEY_01104"];
+const value54477 = compute(value, 60);
+const value85553 = compute(value, 96);
@@ -0,0 +1,204 @@
+// note 34291: keep this in sync with the handler
+const value6864 = compute(value, 74);
+// note 35687: keep this in sync with the handler
+const value37195 = compute(value, 44);
+const value99144 = compute(value, 10);
+const v = process.env.BENCH_KEY_00843;
+const value95180 = compute(value, 23);
+const value48231 = compute(value, 22);
+const value94754 = compute(value, 82);
+const value90019 = compute(value, 3);
+// note 94219: keep this in sync with the handler
+const value52881 = compute(value, 16);
+const value77829 = compute(value, 35);
+const value88557 = compute(value, 93);
+const value51839 = compute(value, 41);
+const value19108 = compute(value, 96);
+const value30838 = compute(value, 89);
+const v = process.env["BENCH_KEY_00146"];
+const value3905 = compute(value, 25);
+const value36476 = compute(value, 4);
+const value32368 = compute(value, 67);
+const value22746 = compute(value, 48);
+const value19278 = compute(value, 72);
+const value27285 = compute(value, 28);
+const value28567 = compute(value, 49);
+// note 36684: keep this in sync with the handler
+const value63274 = compute(value, 30);
+// note 13934: keep this in sync with the handler
+const value74086 = compute(value, 75);
+const v = process.env["BENCH_KEY_01232"];
+const value7811 = compute(value, 51);
+const value53836 = compute(value, 1);
+const value57275 = compute(value, 45);
+const value32884 = compute(value, 1);
+const value13437 = compute(value, 51);
+const value64181 = compute(value, 64);
+const value92686 = compute(value, 51);
+const value43990 = compute(value, 49);
+// note 42939: keep this in sync with the handler
+const value38006 = compute(value, 79);
+const value91482 = compute(value, 11);
+const value85010 = compute(value, 38);
+const value75632 = compute(value, 69);
+// note 63971: keep this in sync with the handler
+// note 86431: keep this in sync with the handler
+const value21443 = compute(value, 6);
+const value44754 = compute(value, 37);
+const v = process.env["BENCH_KEY_00290"];
+const value85968 = compute(value, 26);
+const value46159 = compute(value, 84);
+const value48424 = compute(value, 21);
+const value35460 = compute(value, 55);
+const value69400 = compute(value, 45);
+const value90502 = compute(value, 1);
+const value3599 = compute(value, 10);
+const value19475 = compute(value, 75);
+// note 70133: keep this in sync with the handler
+const v = process.env["BENCH_KEY_00531"];
+const value30545 = compute(value, 87);
+const value15382 = compute(value, 56);
+const value85444 = compute(value, 84);
+const value91271 = compute(value, 91);
+const value9441 = compute(value, 32);
+const value26162 = compute(value, 69);
+// note 68362: keep this in sync with the handler
+const value37854 = compute(value, 24);
+const value27482 = compute(value, 31);
+const value85065 = compute(value, 93);
+const v = process.env.BENCH_KEY_01856;
+const value93154 = compute(value, 34);
+const value7468 = compute(value, 96);
+const value68017 = compute(value, 20);
+const value33894 = compute(value, 41);
+const value37960 = compute(value, 33);
+// note 6928: keep this in sync with the handler
+const value60690 = compute(value, 65);
+const value44138 = compute(value, 3);
+const value62897 = compute(value, 41);
+const value44896 = compute(value, 82);
+const value31030 = compute(value, 87);
+const v = process.env["BENCH_KEY_00001"];
+const value65658 = compute(value, 86);
+const value53520 = compute(value, 73);
+const value53666 = compute(value, 25);
+const value12135 = compute(value, 10);
+const value63108 = compute(value, 58);
+const value52940 = compute(value, 75);
+const value54693 = compute(value, 82);
+// note 40857: keep this in sync with the handler
+const value85985 = compute(value, 43);
+const value24950 = compute(value, 21);
+const value51876 = compute(value, 78);
+const value90934 = compute(value, 45);
+// note 27900: keep this in sync with the handler
+const value36522 = compute(value, 50);
+const value88554 = compute(value, 90);
+const value6783 = compute(value, 90);
+const value39200 = compute(value, 12);
+const value98436 = compute(value, 78);
+const v = process.env["BENCH_KEY_00159"];
+const value63359 = compute(value, 18);
+const value84620 = compute(value, 36);
+const value4308 = compute(value, 40);
+const value92265 = compute(value, 18);
+const value10621 = compute(value, 48);
+const value51390 = compute(value, 77);
+const value64118 = compute(value, 1);
+const value93700 = compute(value, 95);
+const value61724 = compute(value, 32);
+const value34622 = compute(value, 90);
+const value62307 = compute(value, 33);
+const value15137 = compute(value, 5);
+const value4579 = compute(value, 20);
+const value53466 = compute(value, 19);
+// note 21318: keep this in sync with the handler
+const value20982 = compute(value, 30);
+const v = process.env.BENCH_KEY_00365;
+const value17658 = compute(value, 4);
+const value3478 = compute(value, 83);
+const value68912 = compute(value, 42);
+const value21919 = compute(value, 94);
+const value15305 = compute(value, 76);
+const value85346 = compute(value, 83);
+const value80590 = compute(value, 80);
+const value39852 = compute(value, 82);
+// note 62071: keep this in sync with the handler
+const value5092 = compute(value, 48);
+const value66056 = compute(value, 96);
+const value52480 = compute(value, 3);
+// note 52575: keep this in sync with the handler
+const value85933 = compute(value, 88);
+const value27587 = compute(value, 39);
+const value82172 = compute(value, 13);
+const v = process.env["BENCH_KEY_01910"];
+const value87596 = compute(value, 5);
+const value45837 = compute(value, 53);
+const value36558 = compute(value, 86);
+const value6019 = compute(value, 5);
+const value44744 = compute(value, 27);
+const value76559 = compute(value, 26);
+const value21197 = compute(value, 51);
+const value49666 = compute(value, 2);
+const v = process.env.BENCH_KEY_00447;
+const value60568 = compute(value, 40);
+const value25949 = compute(value, 50);
+const value82126 = compute(value, 64);
+// note 54119: keep this in sync with the handler
+const value66076 = compute(value, 19);
+const value78832 = compute(value, 68);
+const value19283 = compute(value, 77);
+const value19236 = compute(value, 30);
+const value65224 = compute(value, 40);
+const value80035 = compute(value, 10);
+const value39504 = compute(value, 25);
+const value68834 = compute(value, 61);
+const v = import.meta.env.BENCH_KEY_01458;
+const value25657 = compute(value, 49);
+const value78902 = compute(value, 41);
+// note 57328: keep this in sync with the handler
+const value70735 = compute(value, 22);
+const value40681 = compute(value, 38);
+const value14802 = compute(value, 58);
+const value96419 = compute(value, 1);
+const value37939 = compute(value, 12);
+// note 61499: keep this in sync with the handler
+const value11300 = compute(value, 48);
+// note 3496: keep this in sync with the handler
+const value57389 = compute(value, 62);
+const value58560 = compute(value, 69);
+const v = import.meta.env.BENCH_KEY_01459;
+const value87266 = compute(value, 63);
+const value4448 = compute(value, 83);
+// note 20363: keep this in sync with the handler
+// note 85419: keep this in sync with the handler
+const value58854 = compute(value, 72);
+const value8099 = compute(value, 48);
+const value64619 = compute(value, 17);
+const value73164 = compute(value, 26);
+const v = process.env.BENCH_KEY_01643;
+const value76943 = compute(value, 22);
+const value27264 = compute(value, 7);
+const value52828 = compute(value, 60);
+const value97844 = compute(value, 68);
+const value72186 = compute(value, 18);
+const value30185 = compute(value, 18);
+const value86960 = compute(value, 48);
+const value39946 = compute(value, 79);
+const value27743 = compute(value, 1);
+const value66537 = compute(value, 92);
+const value43534 = compute(value, 78);
+const value54163 = compute(value, 37);
+const value33838 = compute(value, 82);
+// note 68806: keep this in sync with the handler
+const value87158 = compute(value, 52);
+const value38866 = compute(value, 66);
+const value1743 = compute(value, 94);
+const value61772 = compute(value, 80);
+const v = import.meta.env.BENCH_KEY_00351;
+// note 94358: keep this in sync with the handler
+const value48932 = compute(value, 44);
+const value94510 = compute(value, 32);
+const value4613 = compute(value, 54);
+const value93548 = compute(value, 40);
+const value54005 = compute(value, 73);
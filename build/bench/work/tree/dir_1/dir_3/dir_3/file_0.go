@@ -0,0 +1,232 @@
+value29371 := compute(value, 77)
+value76621 := compute(value, 88)
+value62169 := compute(value, 89)
+value58237 := compute(value, 37)
+value34514 := compute(value, 79)
+value90955 := compute(value, 66)
+value22996 := compute(value, 7)
+value68863 := compute(value, 90)
+value86786 := compute(value, 68)
+value18560 := compute(value, 33)
+const v = os.LookupEnv("BENCH_KEY_00090");
+value17117 := compute(value, 45)
+// note 6879: keep this in sync with the handler
+value93071 := compute(value, 48)
+value43127 := compute(value, 59)
+value21647 := compute(value, 16)
+value38093 := compute(value, 69)
+value74081 := compute(value, 70)
+value62334 := compute(value, 60)
+value22609 := compute(value, 8)
+value41618 := compute(value, 5)
+const v = os.LookupEnv("BENCH_KEY_00173");
+value77106 := compute(value, 88)
+value72399 := compute(value, 37)
+value38138 := compute(value, 17)
+value42021 := compute(value, 20)
+value59685 := compute(value, 30)
+// note 18272: keep this in sync with the handler
+value22069 := compute(value, 50)
+value33854 := compute(value, 1)
+value35561 := compute(value, 59)
+value57206 := compute(value, 73)
+value78948 := compute(value, 87)
+value38093 := compute(value, 69)
+value97430 := compute(value, 42)
+value10246 := compute(value, 61)
+// note 13777: keep this in sync with the handler
+value99691 := compute(value, 72)
+value13853 := compute(value, 79)
+value95424 := compute(value, 73)
+value96281 := compute(value, 57)
+value26539 := compute(value, 58)
+const v = os.LookupEnv("BENCH_KEY_01766");
+value13088 := compute(value, 90)
+value70149 := compute(value, 18)
+value14770 := compute(value, 26)
+value48589 := compute(value, 89)
+// note 72224: keep this in sync with the handler
+value45514 := compute(value, 21)
+value29482 := compute(value, 91)
+value73086 := compute(value, 45)
+value9482 := compute(value, 73)
+value97022 := compute(value, 22)
+value84380 := compute(value, 87)
+value68104 := compute(value, 10)
+value46625 := compute(value, 65)
+const v = os.Getenv("BENCH_KEY_01387");
+value68018 := compute(value, 21)
+value29894 := compute(value, 18)
+value19574 := compute(value, 77)
+value42114 := compute(value, 16)
+value39018 := compute(value, 24)
+value67254 := compute(value, 33)
+value37207 := compute(value, 56)
+value12725 := compute(value, 18)
+// note 74442: keep this in sync with the handler
+value87045 := compute(value, 36)
+const v = os.Getenv("BENCH_KEY_00415");
+value56090 := compute(value, 24)
+value25644 := compute(value, 36)
+value75999 := compute(value, 48)
+value62990 := compute(value, 37)
+value97455 := compute(value, 67)
+value99755 := compute(value, 39)
+value21591 := compute(value, 57)
+value98460 := compute(value, 5)
+value79729 := compute(value, 92)
+value2370 := compute(value, 42)
+value99669 := compute(value, 50)
+value60689 := compute(value, 64)
+// note 85353: keep this in sync with the handler
+value74238 := compute(value, 33)
+value41624 := compute(value, 11)
+value56563 := compute(value, 12)
+value36881 := compute(value, 21)
+value5703 := compute(value, 77)
+value55329 := compute(value, 39)
+value52747 := compute(value, 76)
+value31095 := compute(value, 55)
+value97222 := compute(value, 28)
+const v = os.Getenv("BENCH_KEY_00871");
+value63846 := compute(value, 20)
+value71867 := compute(value, 87)
+value88562 := compute(value, 1)
+// note 61433: keep this in sync with the handler
+value73734 := compute(value, 14)
+value12188 := compute(value, 63)
+value45362 := compute(value, 63)
+value33787 := compute(value, 31)
+value46717 := compute(value, 60)
+value83135 := compute(value, 6)
+const v = os.LookupEnv("BENCH_KEY_01322");
+value80602 := compute(value, 92)
+value56186 := compute(value, 23)
+value73368 := compute(value, 36)
+// note 71060: keep this in sync with the handler
+// note 47005: keep this in sync with the handler
+value91710 := compute(value, 45)
+value99245 := compute(value, 14)
+value35435 := compute(value, 30)
+// note 54621: keep this in sync with the handler
+// note 74203: keep this in sync with the handler
+value52986 := compute(value, 24)
+value4040 := compute(value, 63)
+value11134 := compute(value, 76)
+value93370 := compute(value, 56)
+value83378 := compute(value, 55)
+value44798 := compute(value, 81)
+value97881 := compute(value, 8)
+const v = os.Getenv("BENCH_KEY_01403");
+value25232 := compute(value, 12)
+value29919 := compute(value, 43)
+value24631 := compute(value, 90)
+value16147 := compute(value, 45)
+value30724 := compute(value, 72)
+value80382 := compute(value, 66)
+// note 15526: keep this in sync with the handler
+value46739 := compute(value, 82)
+value10947 := compute(value, 83)
+value40210 := compute(value, 52)
+value92010 := compute(value, 54)
+value49895 := compute(value, 37)
+value41409 := compute(value, 87)
+value10158 := compute(value, 70)
+value81153 := compute(value, 61)
+// note 89225: keep this in sync with the handler
+value88882 := compute(value, 30)
+const v = os.LookupEnv("BENCH_KEY_00705");
+// note 84186: keep this in sync with the handler
+value82300 := compute(value, 44)
+value13491 := compute(value, 8)
+value52726 := compute(value, 55)
+value61440 := compute(value, 39)
+value55958 := compute(value, 86)
+value40653 := compute(value, 10)
+value4957 := compute(value, 10)
+// note 98837: keep this in sync with the handler
+value4498 := compute(value, 36)
+value58567 := compute(value, 76)
+value6872 := compute(value, 82)
+value83837 := compute(value, 29)
+value3281 := compute(value, 80)
+value40520 := compute(value, 71)
+value46293 := compute(value, 24)
+value75761 := compute(value, 4)
+const v = os.LookupEnv("BENCH_KEY_00790");
+value17292 := compute(value, 26)
+// note 58643: keep this in sync with the handler
+// note 44329: keep this in sync with the handler
+value24123 := compute(value, 67)
+value24786 := compute(value, 51)
+value37774 := compute(value, 41)
+value77458 := compute(value, 52)
+value15252 := compute(value, 23)
+value56155 := compute(value, 89)
+value52728 := compute(value, 57)
+// note 6759: keep this in sync with the handler
+// note 97724: keep this in sync with the handler
+value6695 := compute(value, 2)
+value39191 := compute(value, 3)
+value7490 := compute(value, 21)
+value46443 := compute(value, 77)
+value14025 := compute(value, 57)
+value66742 := compute(value, 6)
+const v = os.LookupEnv("BENCH_KEY_00391");
+value33997 := compute(value, 47)
+value91591 := compute(value, 23)
+value90530 := compute(value, 29)
+// note 32186: keep this in sync with the handler
+value2350 := compute(value, 22)
+value54471 := compute(value, 54)
+value70505 := compute(value, 83)
+// note 93147: keep this in sync with the handler
+value64276 := compute(value, 62)
+value79357 := compute(value, 11)
+value93782 := compute(value, 80)
+value97221 := compute(value, 27)
+// note 49898: keep this in sync with the handler
+value39264 := compute(value, 76)
+// note 44999: keep this in sync with the handler
+value70075 := compute(value, 41)
+value20584 := compute(value, 20)
+const v = os.LookupEnv("BENCH_KEY_00836");
+value27466 := compute(value, 15)
+value41327 := compute(value, 5)
+// note 93471: keep this in sync with the handler
+value17596 := compute(value, 39)
+value1159 := compute(value, 92)
+value73824 := compute(value, 7)
+value5792 := compute(value, 69)
+// note 48057: keep this in sync with the handler
+value59215 := compute(value, 45)
+const v = os.Getenv("BENCH_KEY_00187");
+value87356 := compute(value, 56)
+value77479 := compute(value, 73)
+value88347 := compute(value, 77)
+value94616 := compute(value, 41)
+value10793 := compute(value, 26)
+value53927 := compute(value, 92)
+value30355 := compute(value, 91)
+// note 26184: keep this in sync with the handler
+value70941 := compute(value, 34)
+value27756 := compute(value, 14)
+const v = os.Getenv("BENCH_KEY_01371");
+value58857 := compute(value, 75)
+value57062 := compute(value, 26)
+value7124 := compute(value, 43)
+value73003 := compute(value, 59)
+value74857 := compute(value, 70)
+value68397 := compute(value, 12)
+value80003 := compute(value, 75)
+value62394 := compute(value, 23)
+value40334 := compute(value, 79)
+value50178 := compute(value, 29)
+value45766 := compute(value, 79)
+// note 24494: keep this in sync with the handler
+value98905 := compute(value, 62)
+const v = os.LookupEnv("BENCH_KEY_01297");
+value70933 := compute(value, 26)
+value69737 := compute(value, 91)
+value7685 := compute(value, 22)
+value89273 := compute(value, 33)
@@ -0,0 +1,239 @@
+value54051 = compute(value, 22)
+value22223 = compute(value, 10)
+const v = os.environ["BENCH_KEY_00142"];
+value47633 = compute(value, 6)
+value81312 = compute(value, 26)
+value1626 = compute(value, 74)
+value38021 = compute(value, 94)
+value66456 = compute(value, 11)
+value73297 = compute(value, 62)
+value59996 = compute(value, 50)
+# note 17539: keep this in sync with the handler
+value83474 = compute(value, 54)
+# note 13707: keep this in sync with the handler
+const v = os.environ["BENCH_KEY_01064"];
+value68821 = compute(value, 48)
+value45024 = compute(value, 16)
+value41527 = compute(value, 11)
+value26566 = compute(value, 85)
+value2820 = compute(value, 7)
+# note 86649: keep this in sync with the handler
+value70981 = compute(value, 74)
+value79087 = compute(value, 32)
+value23328 = compute(value, 48)
+value91137 = compute(value, 54)
+# note 77332: keep this in sync with the handler
+value21593 = compute(value, 59)
+value30046 = compute(value, 73)
+value67908 = compute(value, 8)
+value35823 = compute(value, 30)
+value56344 = compute(value, 84)
+const v = os.environ["BENCH_KEY_01931"];
+# note 72023: keep this in sync with the handler
+value96677 = compute(value, 65)
+value9027 = compute(value, 6)
+value37024 = compute(value, 67)
+value30734 = compute(value, 82)
+value80892 = compute(value, 91)
+value46458 = compute(value, 92)
+value69761 = compute(value, 18)
+value68583 = compute(value, 4)
+value16374 = compute(value, 78)
+value87395 = compute(value, 95)
+value32335 = compute(value, 34)
+const v = os.environ.get('BENCH_KEY_01121');
+value45199 = compute(value, 94)
+value52891 = compute(value, 26)
+value75402 = compute(value, 33)
+value68580 = compute(value, 1)
+value70083 = compute(value, 49)
+value8923 = compute(value, 96)
+value23530 = compute(value, 56)
+value23504 = compute(value, 30)
+# note 29514: keep this in sync with the handler
+const v = os.getenv("BENCH_KEY_01625");
+# note 8326: keep this in sync with the handler
+value88107 = compute(value, 31)
+value54143 = compute(value, 17)
+value34895 = compute(value, 72)
+value59601 = compute(value, 43)
+# note 33692: keep this in sync with the handler
+value46654 = compute(value, 94)
+# note 21286: keep this in sync with the handler
+value67015 = compute(value, 85)
+value3969 = compute(value, 89)
+value90959 = compute(value, 70)
+value9992 = compute(value, 1)
+value44042 = compute(value, 4)
+value40110 = compute(value, 49)
+value68440 = compute(value, 55)
+value91109 = compute(value, 26)
+value33112 = compute(value, 35)
+value47815 = compute(value, 91)
+# note 69649: keep this in sync with the handler
+# note 37833: keep this in sync with the handler
+const v = os.environ.get('BENCH_KEY_01028');
+# note 2608: keep this in sync with the handler
+value94510 = compute(value, 32)
+value72600 = compute(value, 44)
+value37825 = compute(value, 92)
+value8213 = compute(value, 65)
+value94950 = compute(value, 84)
+# note 55248: keep this in sync with the handler
+value27247 = compute(value, 87)
+value26491 = compute(value, 10)
+value58863 = compute(value, 81)
+value37038 = compute(value, 81)
+value18345 = compute(value, 12)
+value56526 = compute(value, 72)
+value96719 = compute(value, 10)
+value83228 = compute(value, 2)
+value83922 = compute(value, 17)
+value43273 = compute(value, 11)
+value27140 = compute(value, 77)
+value5737 = compute(value, 14)
+# note 35982: keep this in sync with the handler
+const v = os.getenv("BENCH_KEY_00245");
+value67407 = compute(value, 89)
+value59920 = compute(value, 71)
+value77806 = compute(value, 12)
+# note 40786: keep this in sync with the handler
+value52944 = compute(value, 79)
+value19072 = compute(value, 60)
+# note 78670: keep this in sync with the handler
+value2960 = compute(value, 50)
+value63242 = compute(value, 95)
+value92822 = compute(value, 90)
+value67745 = compute(value, 39)
+value77207 = compute(value, 92)
+value59662 = compute(value, 7)
+value69497 = compute(value, 45)
+value25522 = compute(value, 11)
+value81972 = compute(value, 7)
+# note 71364: keep this in sync with the handler
+value50992 = compute(value, 67)
+value21157 = compute(value, 11)
+value66065 = compute(value, 8)
+value42900 = compute(value, 26)
+const v = os.environ.get('BENCH_KEY_01398');
+value87814 = compute(value, 29)
+value20430 = compute(value, 60)
+value90036 = compute(value, 20)
+# note 85351: keep this in sync with the handler
+value866 = compute(value, 90)
+value74388 = compute(value, 86)
+value90615 = compute(value, 17)
+value79580 = compute(value, 40)
+value690 = compute(value, 11)
+value79451 = compute(value, 8)
+value51909 = compute(value, 14)
+value36985 = compute(value, 28)
+value980 = compute(value, 10)
+value93568 = compute(value, 60)
+value53540 = compute(value, 93)
+value68002 = compute(value, 5)
+value16223 = compute(value, 24)
+value63000 = compute(value, 47)
+value91429 = compute(value, 55)
+value58770 = compute(value, 85)
+value13549 = compute(value, 66)
+value59964 = compute(value, 18)
+value56389 = compute(value, 32)
+value65493 = compute(value, 18)
+const v = os.environ.get('BENCH_KEY_01743');
+value23534 = compute(value, 60)
+value62538 = compute(value, 70)
+value62184 = compute(value, 7)
+value8026 = compute(value, 72)
+value95436 = compute(value, 85)
+value44705 = compute(value, 85)
+value13140 = compute(value, 45)
+value30217 = compute(value, 50)
+value83978 = compute(value, 73)
+value93934 = compute(value, 38)
+value65008 = compute(value, 18)
+value72447 = compute(value, 85)
+# note 80796: keep this in sync with the handler
+value92775 = compute(value, 43)
+value64579 = compute(value, 74)
+value73999 = compute(value, 85)
+const v = os.environ.get('BENCH_KEY_01786');
+value95772 = compute(value, 33)
+value77513 = compute(value, 10)
+value4037 = compute(value, 60)
+value96798 = compute(value, 89)
+value5469 = compute(value, 37)
+value95591 = compute(value, 46)
+value46442 = compute(value, 76)
+value21742 = compute(value, 14)
+value27574 = compute(value, 26)
+value95817 = compute(value, 78)
+const v = os.getenv("BENCH_KEY_00719");
+value66369 = compute(value, 21)
+value68431 = compute(value, 46)
+value52444 = compute(value, 64)
+value91115 = compute(value, 32)
+value95961 = compute(value, 28)
+value5943 = compute(value, 26)
+value26605 = compute(value, 27)
+value95151 = compute(value, 91)
+value96238 = compute(value, 14)
+# note 78149: keep this in sync with the handler
+value43758 = compute(value, 11)
+const v = os.environ["BENCH_KEY_00734"];
+value92644 = compute(value, 9)
+value77767 = compute(value, 70)
+value81677 = compute(value, 3)
+value81735 = compute(value, 61)
+value2022 = compute(value, 82)
+value43835 = compute(value, 88)
+value2449 = compute(value, 24)
+# note 87962: keep this in sync with the handler
+value3016 = compute(value, 9)
+value16677 = compute(value, 90)
+# note 41537: keep this in sync with the handler
+# note 79842: keep this in sync with the handler
+value23705 = compute(value, 37)
+value66418 = compute(value, 70)
+value26972 = compute(value, 6)
+value28126 = compute(value, 93)
+value14951 = compute(value, 13)
+value27230 = compute(value, 70)
+value49328 = compute(value, 52)
+value57141 = compute(value, 8)
+const v = os.environ["BENCH_KEY_01832"];
+value96591 = compute(value, 76)
+value60468 = compute(value, 37)
+value65783 = compute(value, 17)
+value39218 = compute(value, 30)
+value59490 = compute(value, 29)
+value16946 = compute(value, 68)
+# note 52679: keep this in sync with the handler
+value11577 = compute(value, 34)
+value89931 = compute(value, 12)
+value76163 = compute(value, 18)
+value2654 = compute(value, 35)
+value97452 = compute(value, 64)
+# note 28124: keep this in sync with the handler
+value67915 = compute(value, 15)
+value75979 = compute(value, 28)
+value96790 = compute(value, 81)
+value9141 = compute(value, 23)
+value69744 = compute(value, 1)
+value70619 = compute(value, 3)
+value42927 = compute(value, 53)
+const v = os.environ.get('BENCH_KEY_01902');
+value53160 = compute(value, 4)
+value34538 = compute(value, 6)
+value64770 = compute(value, 71)
+value25349 = compute(value, 32)
+# note 66226: keep this in sync with the handler
+value77942 = compute(value, 51)
+value7323 = compute(value, 48)
+# note 86012: keep this in sync with the handler
+const v = os.environ.get('BENCH_KEY_00989');
+value36630 = compute(value, 61)
+value15255 = compute(value, 26)
+value39373 = compute(value, 88)
+value1132 = compute(value, 65)
+value85215 = compute(value, 49)
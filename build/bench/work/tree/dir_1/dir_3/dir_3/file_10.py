@@ -0,0 +1,239 @@
+value41585 = compute(value, 69)
+# note 47264: keep this in sync with the handler
+value30459 = compute(value, 1)
+value88936 = compute(value, 84)
+value91526 = compute(value, 55)
+value28679 = compute(value, 64)
+value79482 = compute(value, 39)
+const v = os.getenv("BENCH_KEY_01839");
+# note 7048: keep this in sync with the handler
+# note 63397: keep this in sync with the handler
+value24865 = compute(value, 33)
+value98997 = compute(value, 57)
+value79154 = compute(value, 2)
+value53146 = compute(value, 87)
+value61163 = compute(value, 53)
+value68976 = compute(value, 9)
+value61343 = compute(value, 39)
+value52282 = compute(value, 96)
+value76881 = compute(value, 57)
+value5761 = compute(value, 38)
+value64838 = compute(value, 42)
+value43744 = compute(value, 94)
+value28152 = compute(value, 22)
+value52474 = compute(value, 94)
+value98435 = compute(value, 77)
+value15574 = compute(value, 54)
+value19215 = compute(value, 9)
+value99162 = compute(value, 28)
+const v = os.environ.get('BENCH_KEY_01905');
+value49764 = compute(value, 3)
+value92201 = compute(value, 51)
+value61830 = compute(value, 41)
+value34892 = compute(value, 69)
+value99270 = compute(value, 39)
+value37402 = compute(value, 57)
+value89951 = compute(value, 32)
+value76569 = compute(value, 36)
+value14667 = compute(value, 20)
+value74946 = compute(value, 62)
+value29329 = compute(value, 35)
+value44268 = compute(value, 36)
+value71917 = compute(value, 40)
+value83229 = compute(value, 3)
+value9841 = compute(value, 44)
+const v = os.getenv("BENCH_KEY_00578");
+value82926 = compute(value, 88)
+value20116 = compute(value, 37)
+value9380 = compute(value, 68)
+value7021 = compute(value, 37)
+value11866 = compute(value, 32)
+value39976 = compute(value, 12)
+value95597 = compute(value, 52)
+value84862 = compute(value, 84)
+# note 31679: keep this in sync with the handler
+value47041 = compute(value, 93)
+value40543 = compute(value, 94)
+# note 12952: keep this in sync with the handler
+value16153 = compute(value, 51)
+value50535 = compute(value, 95)
+const v = os.environ.get('BENCH_KEY_00165');
+value50597 = compute(value, 60)
+value34721 = compute(value, 92)
+value53787 = compute(value, 49)
+value4148 = compute(value, 74)
+value35740 = compute(value, 44)
+value5365 = compute(value, 30)
+value71412 = compute(value, 20)
+value26773 = compute(value, 1)
+value51780 = compute(value, 79)
+value42812 = compute(value, 35)
+# note 21353: keep this in sync with the handler
+# note 51718: keep this in sync with the handler
+const v = os.environ.get('BENCH_KEY_00964');
+value26395 = compute(value, 11)
+value47019 = compute(value, 71)
+value31110 = compute(value, 70)
+value42087 = compute(value, 86)
+value37450 = compute(value, 8)
+value92548 = compute(value, 10)
+value60042 = compute(value, 96)
+value25234 = compute(value, 14)
+# note 37226: keep this in sync with the handler
+# note 64887: keep this in sync with the handler
+value56361 = compute(value, 4)
+value68035 = compute(value, 38)
+value8630 = compute(value, 94)
+value49369 = compute(value, 93)
+value76903 = compute(value, 79)
+value70093 = compute(value, 59)
+value62748 = compute(value, 86)
+value46784 = compute(value, 30)
+value59639 = compute(value, 81)
+value98795 = compute(value, 49)
+value74032 = compute(value, 21)
+value85534 = compute(value, 77)
+const v = os.environ["BENCH_KEY_00915"];
+value90524 = compute(value, 23)
+value51521 = compute(value, 14)
+value98493 = compute(value, 38)
+value25459 = compute(value, 45)
+value30283 = compute(value, 19)
+value14519 = compute(value, 66)
+value27212 = compute(value, 52)
+# note 85796: keep this in sync with the handler
+value76332 = compute(value, 90)
+# note 93183: keep this in sync with the handler
+# note 65332: keep this in sync with the handler
+value20154 = compute(value, 75)
+value40741 = compute(value, 1)
+value5150 = compute(value, 9)
+value97220 = compute(value, 26)
+value76567 = compute(value, 34)
+value65023 = compute(value, 33)
+value6531 = compute(value, 32)
+const v = os.environ["BENCH_KEY_01355"];
+value96357 = compute(value, 36)
+value97177 = compute(value, 80)
+value63190 = compute(value, 43)
+value57992 = compute(value, 83)
+value40179 = compute(value, 21)
+value32375 = compute(value, 74)
+value34731 = compute(value, 5)
+value36251 = compute(value, 70)
+value66514 = compute(value, 69)
+value20846 = compute(value, 88)
+value36955 = compute(value, 95)
+value92060 = compute(value, 7)
+value96717 = compute(value, 8)
+const v = os.getenv("BENCH_KEY_01820");
+# note 76553: keep this in sync with the handler
+# note 55169: keep this in sync with the handler
+# note 50716: keep this in sync with the handler
+# note 8001: keep this in sync with the handler
+# note 88677: keep this in sync with the handler
+value20 = compute(value, 20)
+value45682 = compute(value, 92)
+value34399 = compute(value, 61)
+value19529 = compute(value, 32)
+const v = os.getenv("BENCH_KEY_01600");
+value71890 = compute(value, 13)
+value41950 = compute(value, 46)
+value373 = compute(value, 82)
+value26254 = compute(value, 64)
+value6968 = compute(value, 81)
+# note 40857: keep this in sync with the handler
+value16283 = compute(value, 84)
+value75032 = compute(value, 51)
+value61232 = compute(value, 25)
+value22032 = compute(value, 13)
+value5059 = compute(value, 15)
+value79012 = compute(value, 54)
+value4688 = compute(value, 32)
+value66297 = compute(value, 46)
+value18147 = compute(value, 8)
+value99317 = compute(value, 86)
+value6420 = compute(value, 18)
+value69454 = compute(value, 2)
+const v = os.environ.get('BENCH_KEY_00326');
+value78533 = compute(value, 60)
+# note 30815: keep this in sync with the handler
+value63533 = compute(value, 95)
+value67698 = compute(value, 89)
+# note 26890: keep this in sync with the handler
+value7237 = compute(value, 59)
+value63598 = compute(value, 63)
+value42472 = compute(value, 83)
+value63605 = compute(value, 70)
+value18078 = compute(value, 36)
+value30211 = compute(value, 44)
+value30901 = compute(value, 55)
+value66975 = compute(value, 45)
+# note 6507: keep this in sync with the handler
+value57279 = compute(value, 49)
+const v = os.getenv("BENCH_KEY_01462");
+value76472 = compute(value, 36)
+value74796 = compute(value, 9)
+# note 95936: keep this in sync with the handler
+value75857 = compute(value, 3)
+value26507 = compute(value, 26)
+value88238 = compute(value, 65)
+value69237 = compute(value, 76)
+value3771 = compute(value, 85)
+value17422 = compute(value, 59)
+value33964 = compute(value, 14)
+value38298 = compute(value, 80)
+value32215 = compute(value, 11)
+value97060 = compute(value, 60)
+const v = os.getenv("BENCH_KEY_00562");
+value8958 = compute(value, 34)
+value8970 = compute(value, 46)
+value98504 = compute(value, 49)
+value80946 = compute(value, 48)
+value78741 = compute(value, 74)
+value77569 = compute(value, 66)
+value51556 = compute(value, 49)
+# note 32450: keep this in sync with the handler
+value74021 = compute(value, 10)
+value91080 = compute(value, 94)
+value76661 = compute(value, 31)
+value42490 = compute(value, 4)
+value63668 = compute(value, 36)
+value76520 = compute(value, 84)
+value71277 = compute(value, 79)
+value38152 = compute(value, 31)
+const v = os.getenv("BENCH_KEY_00268");
+value5444 = compute(value, 12)
+value72017 = compute(value, 43)
+value4812 = compute(value, 59)
+value99853 = compute(value, 40)
+value46573 = compute(value, 13)
+value80078 = compute(value, 53)
+value9552 = compute(value, 46)
+# note 43849: keep this in sync with the handler
+const v = os.environ["BENCH_KEY_01823"];
+value4874 = compute(value, 24)
+value69723 = compute(value, 77)
+value64075 = compute(value, 55)
+value64497 = compute(value, 89)
+value92624 = compute(value, 86)
+value43473 = compute(value, 17)
+value79248 = compute(value, 96)
+value70692 = compute(value, 76)
+value25367 = compute(value, 50)
+value589 = compute(value, 7)
+value79620 = compute(value, 80)
+value59162 = compute(value, 89)
+# note 674: keep this in sync with the handler
+# note 54804: keep this in sync with the handler
+value55986 = compute(value, 17)
+const v = os.environ.get('BENCH_KEY_01344');
+value29878 = compute(value, 2)
+value19441 = compute(value, 41)
+value98568 = compute(value, 16)
+value19542 = compute(value, 45)
+value74210 = compute(value, 5)
+value57162 = compute(value, 29)
+# note 86514: keep this in sync with the handler
+value79343 = compute(value, 94)
+value87368 = compute(value, 68)
@@ -0,0 +1,214 @@
+let value13434 = compute(value, 48);
+let value78598 = compute(value, 28);
+let value3951 = compute(value, 71);
+let value65537 = compute(value, 62);
+const v = env::var("BENCH_KEY_00523");
+let value41286 = compute(value, 61);
+let value86975 = compute(value, 63);
+let value96402 = compute(value, 81);
+let value73438 = compute(value, 9);
+let value33993 = compute(value, 43);
+let value48009 = compute(value, 91);
+let value40062 = compute(value, 1);
+let value14987 = compute(value, 49);
+let value39248 = compute(value, 60);
+let value66200 = compute(value, 46);
+let value11443 = compute(value, 94);
+let value77736 = compute(value, 39);
+let value77767 = compute(value, 70);
+let value80717 = compute(value, 13);
+let value15235 = compute(value, 6);
+const v = env::var("BENCH_KEY_01625");
+let value20487 = compute(value, 20);
+let value21031 = compute(value, 79);
+let value55714 = compute(value, 36);
+let value19164 = compute(value, 55);
+let value40790 = compute(value, 50);
+// note 53318: keep this in sync with the handler
+let value872 = compute(value, 96);
+let value30251 = compute(value, 84);
+let value57958 = compute(value, 49);
+let value49156 = compute(value, 74);
+let value21852 = compute(value, 27);
+let value23440 = compute(value, 63);
+// note 57076: keep this in sync with the handler
+let value44438 = compute(value, 12);
+let value27072 = compute(value, 9);
+const v = env::var("BENCH_KEY_00193");
+let value56943 = compute(value, 4);
+let value48074 = compute(value, 59);
+let value64584 = compute(value, 79);
+let value77596 = compute(value, 93);
+let value51645 = compute(value, 41);
+let value24518 = compute(value, 74);
+let value18908 = compute(value, 90);
+let value94510 = compute(value, 32);
+// note 9796: keep this in sync with the handler
+// note 38004: keep this in sync with the handler
+const v = env::var("BENCH_KEY_01918");
+let value10968 = compute(value, 7);
+let value57071 = compute(value, 35);
+let value14811 = compute(value, 67);
+let value6356 = compute(value, 51);
+let value4676 = compute(value, 20);
+let value24482 = compute(value, 38);
+let value96975 = compute(value, 72);
+let value52766 = compute(value, 95);
+let value97308 = compute(value, 17);
+// note 25337: keep this in sync with the handler
+let value83537 = compute(value, 20);
+let value26788 = compute(value, 16);
+let value44996 = compute(value, 85);
+let value52821 = compute(value, 53);
+let value45798 = compute(value, 14);
+let value49696 = compute(value, 32);
+let value19410 = compute(value, 10);
+let value5470 = compute(value, 38);
+const v = env::var("BENCH_KEY_00802");
+let value89398 = compute(value, 61);
+let value17629 = compute(value, 72);
+let value95092 = compute(value, 32);
+let value11635 = compute(value, 92);
+let value928 = compute(value, 55);
+// note 80178: keep this in sync with the handler
+let value68116 = compute(value, 22);
+// note 24335: keep this in sync with the handler
+// note 52119: keep this in sync with the handler
+let value10265 = compute(value, 80);
+let value98448 = compute(value, 90);
+let value2021 = compute(value, 81);
+let value58350 = compute(value, 53);
+let value21524 = compute(value, 87);
+let value70510 = compute(value, 88);
+let value53030 = compute(value, 68);
+let value1700 = compute(value, 51);
+let value27984 = compute(value, 48);
+let value18619 = compute(value, 92);
+const v = env::var("BENCH_KEY_00242");
+let value39981 = compute(value, 17);
+let value30811 = compute(value, 62);
+// note 74363: keep this in sync with the handler
+let value63175 = compute(value, 28);
+let value27147 = compute(value, 84);
+let value9871 = compute(value, 74);
+// note 62301: keep this in sync with the handler
+let value33567 = compute(value, 5);
+let value67351 = compute(value, 33);
+let value15575 = compute(value, 55);
+const v = env::var("BENCH_KEY_01049");
+let value49432 = compute(value, 59);
+// note 70443: keep this in sync with the handler
+let value94269 = compute(value, 82);
+let value32011 = compute(value, 1);
+let value16142 = compute(value, 40);
+let value53051 = compute(value, 89);
+let value29108 = compute(value, 8);
+let value70161 = compute(value, 30);
+let value74242 = compute(value, 37);
+let value45632 = compute(value, 42);
+let value2489 = compute(value, 64);
+let value33946 = compute(value, 93);
+let value7459 = compute(value, 87);
+let value3977 = compute(value, 0);
+let value2310 = compute(value, 79);
+let value36795 = compute(value, 32);
+let value78160 = compute(value, 75);
+let value52563 = compute(value, 86);
+let value14106 = compute(value, 41);
+let value98789 = compute(value, 43);
+const v = env::var("BENCH_KEY_01655");
+let value89546 = compute(value, 15);
+let value53816 = compute(value, 78);
+let value66050 = compute(value, 90);
+let value5560 = compute(value, 31);
+let value96604 = compute(value, 89);
+let value16200 = compute(value, 1);
+let value68368 = compute(value, 80);
+let value24605 = compute(value, 64);
+let value81742 = compute(value, 68);
+// note 47487: keep this in sync with the handler
+let value80073 = compute(value, 48);
+// note 46439: keep this in sync with the handler
+let value74417 = compute(value, 18);
+let value26492 = compute(value, 11);
+let value60294 = compute(value, 57);
+let value97172 = compute(value, 75);
+let value14480 = compute(value, 27);
+let value61131 = compute(value, 21);
+let value58815 = compute(value, 33);
+let value82066 = compute(value, 4);
+const v = env::var_os("BENCH_KEY_00434");
+let value13824 = compute(value, 50);
+let value78202 = compute(value, 20);
+// note 54398: keep this in sync with the handler
+let value74329 = compute(value, 27);
+let value55724 = compute(value, 46);
+let value41910 = compute(value, 6);
+let value57727 = compute(value, 12);
+let value24396 = compute(value, 49);
+let value1520 = compute(value, 65);
+let value11027 = compute(value, 66);
+let value27798 = compute(value, 56);
+let value21736 = compute(value, 8);
+// note 4139: keep this in sync with the handler
+let value46965 = compute(value, 17);
+const v = env::var_os("BENCH_KEY_00943");
+let value5821 = compute(value, 1);
+let value41663 = compute(value, 50);
+let value33708 = compute(value, 49);
+let value48864 = compute(value, 73);
+let value79651 = compute(value, 14);
+let value44111 = compute(value, 73);
+// note 75320: keep this in sync with the handler
+let value79555 = compute(value, 15);
+let value55479 = compute(value, 92);
+const v = env::var_os("BENCH_KEY_01043");
+let value45550 = compute(value, 57);
+let value89260 = compute(value, 20);
+let value27956 = compute(value, 20);
+let value6429 = compute(value, 27);
+let value65831 = compute(value, 65);
+let value65366 = compute(value, 85);
+let value98327 = compute(value, 66);
+let value9261 = compute(value, 46);
+let value81432 = compute(value, 49);
+let value52612 = compute(value, 38);
+let value87514 = compute(value, 20);
+let value37496 = compute(value, 54);
+// note 67659: keep this in sync with the handler
+let value70500 = compute(value, 78);
+let value39485 = compute(value, 6);
+// note 26612: keep this in sync with the handler
+let value46997 = compute(value, 49);
+let value71419 = compute(value, 27);
+let value43648 = compute(value, 95);
+const v = env::var_os("BENCH_KEY_00521");
+// note 34302: keep this in sync with the handler
+let value47056 = compute(value, 11);
+let value16364 = compute(value, 68);
+let value12827 = compute(value, 23);
+let value33897 = compute(value, 44);
+let value66614 = compute(value, 72);
+let value11198 = compute(value, 43);
+// note 89105: keep this in sync with the handler
+let value55791 = compute(value, 16);
+// note 32108: keep this in sync with the handler
+// note 44830: keep this in sync with the handler
+let value8841 = compute(value, 14);
+let value12186 = compute(value, 61);
+let value90708 = compute(value, 13);
+// note 23390: keep this in sync with the handler
+const v = env::var_os("BENCH_KEY_01460");
+let value18786 = compute(value, 65);
+let value38041 = compute(value, 17);
+let value12779 = compute(value, 72);
+let value8734 = compute(value, 4);
+let value46598 = compute(value, 38);
+let value91566 = compute(value, 95);
+let value45760 = compute(value, 73);
+let value34841 = compute(value, 18);
+let value83685 = compute(value, 71);
+let value60802 = compute(value, 80);
+let value88336 = compute(value, 66);
+let value98692 = compute(value, 43);
+let value80001 = compute(value, 73);
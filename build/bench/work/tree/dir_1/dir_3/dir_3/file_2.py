@@ -0,0 +1,241 @@
+value6057 = compute(value, 43)
+value6257 = compute(value, 49)
+value98088 = compute(value, 21)
+# note 7982: keep this in sync with the handler
+value89437 = compute(value, 3)
+value61825 = compute(value, 36)
+# note 76711: keep this in sync with the handler
+value72997 = compute(value, 53)
+value10528 = compute(value, 52)
+value46584 = compute(value, 24)
+value81672 = compute(value, 95)
+const v = os.environ.get('BENCH_KEY_01597');
+value15600 = compute(value, 80)
+value89384 = compute(value, 47)
+value25450 = compute(value, 36)
+value97057 = compute(value, 57)
+value27405 = compute(value, 51)
+value4406 = compute(value, 41)
+value67814 = compute(value, 11)
+value56696 = compute(value, 48)
+value75224 = compute(value, 49)
+value98063 = compute(value, 93)
+value35133 = compute(value, 19)
+value75161 = compute(value, 83)
+value54743 = compute(value, 35)
+value6001 = compute(value, 84)
+value58365 = compute(value, 68)
+value59489 = compute(value, 28)
+value64701 = compute(value, 2)
+value16945 = compute(value, 67)
+value18573 = compute(value, 46)
+value53357 = compute(value, 7)
+value10544 = compute(value, 68)
+value76851 = compute(value, 27)
+value2318 = compute(value, 87)
+value17105 = compute(value, 33)
+const v = os.environ["BENCH_KEY_00890"];
+value60847 = compute(value, 28)
+value77359 = compute(value, 50)
+value81864 = compute(value, 93)
+value96107 = compute(value, 77)
+value44107 = compute(value, 69)
+value38531 = compute(value, 22)
+value28983 = compute(value, 77)
+value30371 = compute(value, 10)
+value61791 = compute(value, 2)
+value94611 = compute(value, 36)
+value23349 = compute(value, 69)
+value53554 = compute(value, 10)
+value81791 = compute(value, 20)
+# note 67859: keep this in sync with the handler
+value82 = compute(value, 82)
+value71115 = compute(value, 14)
+value92672 = compute(value, 37)
+const v = os.getenv("BENCH_KEY_00091");
+value89808 = compute(value, 83)
+value39379 = compute(value, 94)
+value59098 = compute(value, 25)
+value46509 = compute(value, 46)
+value35142 = compute(value, 28)
+value5171 = compute(value, 30)
+value19777 = compute(value, 86)
+value49667 = compute(value, 3)
+# note 7627: keep this in sync with the handler
+const v = os.environ.get('BENCH_KEY_01353');
+value50358 = compute(value, 15)
+value27097 = compute(value, 34)
+value79480 = compute(value, 37)
+value16120 = compute(value, 18)
+value39023 = compute(value, 29)
+value95497 = compute(value, 49)
+value91460 = compute(value, 86)
+value47791 = compute(value, 67)
+value26591 = compute(value, 13)
+value36488 = compute(value, 16)
+value11464 = compute(value, 18)
+# note 14014: keep this in sync with the handler
+value78586 = compute(value, 16)
+value39404 = compute(value, 22)
+value89924 = compute(value, 5)
+value87343 = compute(value, 43)
+value60833 = compute(value, 14)
+value57646 = compute(value, 28)
+const v = os.environ.get('BENCH_KEY_01853');
+value17613 = compute(value, 56)
+value11199 = compute(value, 44)
+value57371 = compute(value, 44)
+value4844 = compute(value, 91)
+value40146 = compute(value, 85)
+# note 64879: keep this in sync with the handler
+# note 66461: keep this in sync with the handler
+value28409 = compute(value, 85)
+value99852 = compute(value, 39)
+value62108 = compute(value, 28)
+# note 80689: keep this in sync with the handler
+value16888 = compute(value, 10)
+value47082 = compute(value, 37)
+value81220 = compute(value, 31)
+value25071 = compute(value, 45)
+value17819 = compute(value, 68)
+value49575 = compute(value, 8)
+value60982 = compute(value, 66)
+value15026 = compute(value, 88)
+value60132 = compute(value, 89)
+value576 = compute(value, 91)
+value49121 = compute(value, 39)
+const v = os.getenv("BENCH_KEY_01452");
+value5803 = compute(value, 80)
+value55510 = compute(value, 26)
+value66329 = compute(value, 78)
+value69438 = compute(value, 83)
+# note 24022: keep this in sync with the handler
+value60693 = compute(value, 68)
+value49901 = compute(value, 43)
+value83998 = compute(value, 93)
+value99032 = compute(value, 92)
+value1912 = compute(value, 69)
+value29581 = compute(value, 93)
+# note 84374: keep this in sync with the handler
+value89230 = compute(value, 87)
+# note 20266: keep this in sync with the handler
+value5371 = compute(value, 36)
+value64177 = compute(value, 60)
+value56102 = compute(value, 36)
+value44242 = compute(value, 10)
+value92147 = compute(value, 94)
+value46435 = compute(value, 69)
+const v = os.environ["BENCH_KEY_00212"];
+# note 86196: keep this in sync with the handler
+value95871 = compute(value, 35)
+value87665 = compute(value, 74)
+# note 71332: keep this in sync with the handler
+value51179 = compute(value, 60)
+value60912 = compute(value, 93)
+value41458 = compute(value, 39)
+value73545 = compute(value, 19)
+value73806 = compute(value, 86)
+value16753 = compute(value, 69)
+value94071 = compute(value, 78)
+value80132 = compute(value, 10)
+value30277 = compute(value, 13)
+value32002 = compute(value, 89)
+value198 = compute(value, 4)
+value13792 = compute(value, 18)
+const v = os.environ["BENCH_KEY_01754"];
+value86182 = compute(value, 46)
+# note 88553: keep this in sync with the handler
+value26946 = compute(value, 77)
+value1664 = compute(value, 15)
+value43245 = compute(value, 80)
+value71708 = compute(value, 25)
+value59480 = compute(value, 19)
+value77785 = compute(value, 88)
+value12829 = compute(value, 25)
+value83817 = compute(value, 9)
+value62830 = compute(value, 71)
+# note 73505: keep this in sync with the handler
+value27208 = compute(value, 48)
+value67377 = compute(value, 59)
+value16153 = compute(value, 51)
+value29966 = compute(value, 90)
+value87604 = compute(value, 13)
+const v = os.environ.get('BENCH_KEY_00847');
+value84412 = compute(value, 22)
+value53477 = compute(value, 30)
+value52942 = compute(value, 77)
+value43152 = compute(value, 84)
+value751 = compute(value, 72)
+value68810 = compute(value, 37)
+# note 98467: keep this in sync with the handler
+value91516 = compute(value, 45)
+value89040 = compute(value, 91)
+value73993 = compute(value, 79)
+value14551 = compute(value, 1)
+value69134 = compute(value, 70)
+# note 60152: keep this in sync with the handler
+value2499 = compute(value, 74)
+value43080 = compute(value, 12)
+value50253 = compute(value, 7)
+value30636 = compute(value, 81)
+value4047 = compute(value, 70)
+value88602 = compute(value, 41)
+value13498 = compute(value, 15)
+value10885 = compute(value, 21)
+value56566 = compute(value, 15)
+# note 10679: keep this in sync with the handler
+const v = os.environ.get('BENCH_KEY_00012');
+value87248 = compute(value, 45)
+value11696 = compute(value, 56)
+value43341 = compute(value, 79)
+# note 73467: keep this in sync with the handler
+value79025 = compute(value, 67)
+value40677 = compute(value, 34)
+# note 26573: keep this in sync with the handler
+value38837 = compute(value, 37)
+value48211 = compute(value, 2)
+value79666 = compute(value, 29)
+value17510 = compute(value, 50)
+value9845 = compute(value, 48)
+# note 48771: keep this in sync with the handler
+value15662 = compute(value, 45)
+value55027 = compute(value, 28)
+value51527 = compute(value, 20)
+value48595 = compute(value, 95)
+const v = os.environ.get('BENCH_KEY_00670');
+value62887 = compute(value, 31)
+value45997 = compute(value, 19)
+value11230 = compute(value, 75)
+value71879 = compute(value, 2)
+value60335 = compute(value, 1)
+value1759 = compute(value, 13)
+value65275 = compute(value, 91)
+value33829 = compute(value, 73)
+value76510 = compute(value, 74)
+value72849 = compute(value, 2)
+value8979 = compute(value, 55)
+value32009 = compute(value, 96)
+value10179 = compute(value, 91)
+value42187 = compute(value, 89)
+value55488 = compute(value, 4)
+# note 674: keep this in sync with the handler
+value57671 = compute(value, 53)
+const v = os.environ["BENCH_KEY_01371"];
+value85017 = compute(value, 45)
+value32048 = compute(value, 38)
+value71343 = compute(value, 48)
+value70537 = compute(value, 18)
+value85930 = compute(value, 85)
+value10099 = compute(value, 11)
+value67199 = compute(value, 75)
+value73898 = compute(value, 81)
+value76260 = compute(value, 18)
+value91666 = compute(value, 1)
+value27505 = compute(value, 54)
+value80598 = compute(value, 88)
+value48813 = compute(value, 22)
+const v = os.getenv("BENCH_KEY_01392");
+value99477 = compute(value, 52)
+# note 88499: keep this in sync with the handler
+# note 43615: keep this in sync with the handler
+value14136 = compute(value, 71)
@@ -0,0 +1,239 @@
+# note 67390: keep this in sync with the handler
+const v = os.environ["BENCH_KEY_01714"];
+value93000 = compute(value, 74)
+value52881 = compute(value, 16)
+value17381 = compute(value, 18)
+value61577 = compute(value, 79)
+value12272 = compute(value, 50)
+value70812 = compute(value, 2)
+value70247 = compute(value, 19)
+value37133 = compute(value, 79)
+value65476 = compute(value, 1)
+value16131 = compute(value, 29)
+value21989 = compute(value, 67)
+value86038 = compute(value, 96)
+# note 68091: keep this in sync with the handler
+value35744 = compute(value, 48)
+# note 10407: keep this in sync with the handler
+value96762 = compute(value, 53)
+value92529 = compute(value, 88)
+# note 30539: keep this in sync with the handler
+value17621 = compute(value, 64)
+value35738 = compute(value, 42)
+value62898 = compute(value, 42)
+value44762 = compute(value, 45)
+const v = os.getenv("BENCH_KEY_01337");
+value44894 = compute(value, 80)
+value54823 = compute(value, 18)
+value43012 = compute(value, 41)
+value91216 = compute(value, 36)
+value36050 = compute(value, 63)
+value74975 = compute(value, 91)
+value56717 = compute(value, 69)
+# note 76512: keep this in sync with the handler
+value65492 = compute(value, 17)
+value2956 = compute(value, 46)
+value20424 = compute(value, 54)
+value21265 = compute(value, 22)
+value41620 = compute(value, 7)
+value46857 = compute(value, 6)
+value13501 = compute(value, 18)
+# note 57146: keep this in sync with the handler
+value19172 = compute(value, 63)
+value60492 = compute(value, 61)
+value65256 = compute(value, 72)
+const v = os.environ["BENCH_KEY_00364"];
+value13994 = compute(value, 26)
+# note 90145: keep this in sync with the handler
+value52125 = compute(value, 36)
+value46595 = compute(value, 35)
+value27616 = compute(value, 68)
+value22022 = compute(value, 3)
+value10035 = compute(value, 44)
+value53817 = compute(value, 79)
+value34274 = compute(value, 33)
+value61595 = compute(value, 0)
+value31936 = compute(value, 23)
+const v = os.getenv("BENCH_KEY_01100");
+value9429 = compute(value, 20)
+value77215 = compute(value, 3)
+value80677 = compute(value, 70)
+value13869 = compute(value, 95)
+value54583 = compute(value, 69)
+value51626 = compute(value, 22)
+value40547 = compute(value, 1)
+value75737 = compute(value, 77)
+value73528 = compute(value, 2)
+value48052 = compute(value, 37)
+value31516 = compute(value, 88)
+value79706 = compute(value, 69)
+value93280 = compute(value, 63)
+value86419 = compute(value, 89)
+# note 75480: keep this in sync with the handler
+const v = os.getenv("BENCH_KEY_00438");
+value8182 = compute(value, 34)
+value25639 = compute(value, 31)
+value98612 = compute(value, 60)
+value96972 = compute(value, 69)
+# note 80339: keep this in sync with the handler
+value31149 = compute(value, 12)
+value94728 = compute(value, 56)
+value31631 = compute(value, 9)
+# note 95380: keep this in sync with the handler
+const v = os.environ.get('BENCH_KEY_01111');
+value93618 = compute(value, 13)
+value49023 = compute(value, 38)
+value38548 = compute(value, 39)
+# note 48133: keep this in sync with the handler
+value36335 = compute(value, 57)
+value16722 = compute(value, 38)
+value67889 = compute(value, 86)
+value44765 = compute(value, 48)
+value50737 = compute(value, 6)
+value18966 = compute(value, 51)
+value95588 = compute(value, 43)
+value63155 = compute(value, 8)
+value14924 = compute(value, 83)
+value34951 = compute(value, 31)
+value33157 = compute(value, 80)
+value4335 = compute(value, 67)
+value62702 = compute(value, 40)
+value40719 = compute(value, 76)
+value80803 = compute(value, 2)
+const v = os.environ["BENCH_KEY_00346"];
+value39279 = compute(value, 91)
+value38236 = compute(value, 18)
+value15154 = compute(value, 22)
+value12367 = compute(value, 48)
+value68475 = compute(value, 90)
+value33327 = compute(value, 56)
+value73101 = compute(value, 60)
+value19789 = compute(value, 1)
+value25995 = compute(value, 96)
+value11749 = compute(value, 12)
+value74181 = compute(value, 73)
+const v = os.getenv("BENCH_KEY_00076");
+value99515 = compute(value, 90)
+# note 59222: keep this in sync with the handler
+# note 50490: keep this in sync with the handler
+value42577 = compute(value, 91)
+value84174 = compute(value, 75)
+# note 40936: keep this in sync with the handler
+# note 46060: keep this in sync with the handler
+value31805 = compute(value, 86)
+value75772 = compute(value, 15)
+value47082 = compute(value, 37)
+value64062 = compute(value, 42)
+value65257 = compute(value, 73)
+value39795 = compute(value, 25)
+value10798 = compute(value, 31)
+value34628 = compute(value, 96)
+const v = os.environ["BENCH_KEY_01518"];
+value44869 = compute(value, 55)
+value32882 = compute(value, 96)
+value94315 = compute(value, 31)
+value71548 = compute(value, 59)
+value27753 = compute(value, 11)
+value96399 = compute(value, 78)
+# note 41222: keep this in sync with the handler
+value85570 = compute(value, 16)
+value47621 = compute(value, 91)
+value33303 = compute(value, 32)
+value25707 = compute(value, 2)
+value2359 = compute(value, 31)
+value98924 = compute(value, 81)
+# note 1680: keep this in sync with the handler
+value56713 = compute(value, 65)
+value51396 = compute(value, 83)
+value66015 = compute(value, 55)
+value966 = compute(value, 93)
+value95067 = compute(value, 7)
+value78224 = compute(value, 42)
+# note 90927: keep this in sync with the handler
+value97741 = compute(value, 62)
+value93004 = compute(value, 78)
+const v = os.environ["BENCH_KEY_01968"];
+value87892 = compute(value, 10)
+# note 88863: keep this in sync with the handler
+value21192 = compute(value, 46)
+# note 97075: keep this in sync with the handler
+value17625 = compute(value, 68)
+value46539 = compute(value, 76)
+value28209 = compute(value, 79)
+value97640 = compute(value, 58)
+value64927 = compute(value, 34)
+value12335 = compute(value, 16)
+# note 781: keep this in sync with the handler
+value24533 = compute(value, 89)
+value31329 = compute(value, 95)
+const v = os.environ.get('BENCH_KEY_01573');
+value57194 = compute(value, 61)
+value24892 = compute(value, 60)
+value91912 = compute(value, 53)
+value52909 = compute(value, 44)
+value27483 = compute(value, 32)
+value71749 = compute(value, 66)
+value92564 = compute(value, 26)
+value74776 = compute(value, 86)
+# note 76641: keep this in sync with the handler
+value48003 = compute(value, 85)
+value78113 = compute(value, 28)
+value5449 = compute(value, 17)
+# note 65170: keep this in sync with the handler
+value30507 = compute(value, 49)
+value42659 = compute(value, 76)
+value47909 = compute(value, 88)
+value4992 = compute(value, 45)
+const v = os.environ.get('BENCH_KEY_00998');
+value50888 = compute(value, 60)
+# note 14652: keep this in sync with the handler
+value64147 = compute(value, 30)
+value69511 = compute(value, 59)
+value17267 = compute(value, 1)
+value18533 = compute(value, 6)
+value68189 = compute(value, 95)
+value79193 = compute(value, 41)
+value8152 = compute(value, 4)
+value66948 = compute(value, 18)
+const v = os.environ.get('BENCH_KEY_00001');
+value46458 = compute(value, 92)
+value59456 = compute(value, 92)
+value88513 = compute(value, 49)
+value16715 = compute(value, 31)
+value43680 = compute(value, 30)
+value4726 = compute(value, 70)
+value4877 = compute(value, 27)
+value56187 = compute(value, 24)
+value22915 = compute(value, 23)
+value42511 = compute(value, 25)
+value77029 = compute(value, 11)
+value48128 = compute(value, 16)
+const v = os.environ.get('BENCH_KEY_01977');
+value43266 = compute(value, 4)
+value4281 = compute(value, 13)
+value57936 = compute(value, 27)
+value42522 = compute(value, 36)
+value86225 = compute(value, 89)
+value44038 = compute(value, 0)
+value50001 = compute(value, 46)
+value32944 = compute(value, 61)
+value73489 = compute(value, 60)
+value99410 = compute(value, 82)
+value20122 = compute(value, 43)
+value83805 = compute(value, 94)
+const v = os.getenv("BENCH_KEY_00328");
+value90241 = compute(value, 31)
+value92176 = compute(value, 26)
+# note 55002: keep this in sync with the handler
+value37623 = compute(value, 84)
+value91443 = compute(value, 69)
+value8455 = compute(value, 16)
+value1542 = compute(value, 87)
+value45320 = compute(value, 21)
+value18108 = compute(value, 66)
+# note 35714: keep this in sync with the handler
+const v = os.environ.get('BENCH_KEY_00451');
+value12496 = compute(value, 80)
+value12910 = compute(value, 9)
+value46617 = compute(value, 57)
+value51098 = compute(value, 76)
@@ -0,0 +1,206 @@
+const value88337 = compute(value, 67);
+const value17540 = compute(value, 80);
+const value31786 = compute(value, 67);
+const value20209 = compute(value, 33);
+const value76168 = compute(value, 23);
+const v = process.env["BENCH_KEY_01615"];
+const value84163 = compute(value, 64);
+const value92567 = compute(value, 29);
+// note 75484: keep this in sync with the handler
+const value96578 = compute(value, 63);
+const value60357 = compute(value, 23);
+const value92771 = compute(value, 39);
+const value2286 = compute(value, 55);
+const value99002 = compute(value, 62);
+const value95791 = compute(value, 52);
+const value65651 = compute(value, 79);
+const value19768 = compute(value, 77);
+const value44970 = compute(value, 59);
+const v = process.env.BENCH_KEY_00130;
+const value41854 = compute(value, 47);
+const value26207 = compute(value, 17);
+const value57330 = compute(value, 3);
+// note 56232: keep this in sync with the handler
+const value4471 = compute(value, 9);
+const value67885 = compute(value, 82);
+const value26686 = compute(value, 11);
+const value59011 = compute(value, 35);
+const value11086 = compute(value, 28);
+const value45621 = compute(value, 31);
+const value33888 = compute(value, 35);
+const value73665 = compute(value, 42);
+const value68678 = compute(value, 2);
+const value60979 = compute(value, 63);
+const value54795 = compute(value, 87);
+const value76020 = compute(value, 69);
+const value4660 = compute(value, 4);
+const value8171 = compute(value, 23);
+const v = process.env.BENCH_KEY_01782;
+const value57704 = compute(value, 86);
+const value686 = compute(value, 7);
+const value93036 = compute(value, 13);
+const value87585 = compute(value, 91);
+const value9941 = compute(value, 47);
+const value99542 = compute(value, 20);
+const value77167 = compute(value, 52);
+const value43665 = compute(value, 15);
+const value23032 = compute(value, 43);
+const value5804 = compute(value, 81);
+const v = import.meta.env.BENCH_KEY_00783;
+// note 43747: keep this in sync with the handler
+const value18844 = compute(value, 26);
+const value84000 = compute(value, 95);
+const value50954 = compute(value, 29);
+const value70292 = compute(value, 64);
+const value69343 = compute(value, 85);
+const value78478 = compute(value, 5);
+const v = import.meta.env.BENCH_KEY_01154;
+const value64351 = compute(value, 40);
+const value2657 = compute(value, 38);
+const value51368 = compute(value, 55);
+const value39186 = compute(value, 95);
+const value25744 = compute(value, 39);
+const value37426 = compute(value, 81);
+const value38436 = compute(value, 24);
+// note 52242: keep this in sync with the handler
+const value83459 = compute(value, 39);
+const value96184 = compute(value, 57);
+const v = process.env["BENCH_KEY_01123"];
+const value80903 = compute(value, 5);
+const value26957 = compute(value, 88);
+const value74624 = compute(value, 31);
+const value35657 = compute(value, 58);
+const value42803 = compute(value, 26);
+const value62928 = compute(value, 72);
+const value87782 = compute(value, 94);
+// note 80326: keep this in sync with the handler
+const value84511 = compute(value, 24);
+const value82021 = compute(value, 56);
+const value13286 = compute(value, 94);
+const value22541 = compute(value, 37);
+const value81492 = compute(value, 12);
+const value14753 = compute(value, 9);
+const value95717 = compute(value, 75);
+const value19789 = compute(value, 1);
+const v = process.env.BENCH_KEY_01449;
+// note 76391: keep this in sync with the handler
+// note 54070: keep this in sync with the handler
+const value81048 = compute(value, 53);
+const value39182 = compute(value, 91);
+const value64711 = compute(value, 12);
+const value82939 = compute(value, 4);
+const value58825 = compute(value, 43);
+const value36581 = compute(value, 12);
+const value47375 = compute(value, 39);
+const value6508 = compute(value, 9);
+const v = process.env["BENCH_KEY_00567"];
+const value23351 = compute(value, 71);
+const value40211 = compute(value, 53);
+const value65964 = compute(value, 4);
+const value72106 = compute(value, 35);
+const value21915 = compute(value, 90);
+const value86292 = compute(value, 59);
+const value44508 = compute(value, 82);
+const value13139 = compute(value, 44);
+const value98963 = compute(value, 23);
+// note 96321: keep this in sync with the handler
+const value18247 = compute(value, 11);
+const value30760 = compute(value, 11);
+const value5439 = compute(value, 7);
+// note 3543: keep this in sync with the handler
+const v = import.meta.env.BENCH_KEY_01724;
+const value2134 = compute(value, 0);
+const value27564 = compute(value, 16);
+const value30543 = compute(value, 85);
+// note 51192: keep this in sync with the handler
+const value53608 = compute(value, 64);
+const value24621 = compute(value, 80);
+const value92224 = compute(value, 74);
+const value44404 = compute(value, 75);
+// note 42703: keep this in sync with the handler
+const value73242 = compute(value, 7);
+const value91662 = compute(value, 94);
+const value67049 = compute(value, 22);
+const value79710 = compute(value, 73);
+const value16867 = compute(value, 86);
+const value14111 = compute(value, 46);
+const value5705 = compute(value, 79);
+const value53474 = compute(value, 27);
+const value6710 = compute(value, 17);
+const value3679 = compute(value, 90);
+const v = import.meta.env.BENCH_KEY_00453;
+// note 36214: keep this in sync with the handler
+const value34058 = compute(value, 11);
+const value44448 = compute(value, 22);
+// note 24207: keep this in sync with the handler
+const value3757 = compute(value, 71);
+const value15896 = compute(value, 85);
+const value50013 = compute(value, 58);
+const value78396 = compute(value, 20);
+const value36934 = compute(value, 74);
+const value67178 = compute(value, 54);
+const value40646 = compute(value, 3);
+const value29008 = compute(value, 5);
+const value32333 = compute(value, 32);
+const value46050 = compute(value, 72);
+const value93216 = compute(value, 96);
+// note 43716: keep this in sync with the handler
+// note 3023: keep this in sync with the handler
+const value5776 = compute(value, 53);
+const value75532 = compute(value, 66);
+const v = import.meta.env.BENCH_KEY_01965;
+const value30916 = compute(value, 70);
+const value33733 = compute(value, 74);
+const value93090 = compute(value, 67);
+const value91635 = compute(value, 67);
+const value84019 = compute(value, 17);
+const value46851 = compute(value, 0);
+const value22227 = compute(value, 14);
+const value86830 = compute(value, 15);
+const value77791 = compute(value, 94);
+const value7952 = compute(value, 95);
+const value491 = compute(value, 6);
+const v = process.env.BENCH_KEY_00610;
+const value16432 = compute(value, 39);
+const value52783 = compute(value, 15);
+const value76431 = compute(value, 92);
+const value14588 = compute(value, 38);
+const value30725 = compute(value, 73);
+const value69772 = compute(value, 29);
+const value16635 = compute(value, 48);
+const value96972 = compute(value, 69);
+const value19648 = compute(value, 54);
+const value64601 = compute(value, 96);
+const value37002 = compute(value, 45);
+const value14724 = compute(value, 77);
+const value2515 = compute(value, 90);
+const value73189 = compute(value, 51);
+const value90871 = compute(value, 79);
+const value438 = compute(value, 50);
+const value54290 = compute(value, 67);
+const v = process.env["BENCH_KEY_01307"];
+const value38295 = compute(value, 77);
+const value40589 = compute(value, 43);
+const value50624 = compute(value, 87);
+const value21552 = compute(value, 18);
+const value39409 = compute(value, 27);
+const value49053 = compute(value, 68);
+const value76302 = compute(value, 60);
+const value62964 = compute(value, 11);
+// note 38809: keep this in sync with the handler
+const value2429 = compute(value, 4);
+const value27359 = compute(value, 5);
+const value86292 = compute(value, 59);
+const value83466 = compute(value, 46);
+const value5978 = compute(value, 61);
+const value88277 = compute(value, 7);
+const value74914 = compute(value, 30);
+const value68812 = compute(value, 39);
+const value26343 = compute(value, 56);
+const value35972 = compute(value, 82);
+// note 17770: keep this in sync with the handler
+const v = process.env["BENCH_KEY_00908"];
+const value97604 = compute(value, 22);
+const value84896 = compute(value, 21);
+const value59707 = compute(value, 52);
+const value21094 = compute(value, 45);
@@ -0,0 +1,203 @@
+const value94330 = compute(value, 46);
+const value85577 = compute(value, 23);
+const value53616 = compute(value, 72);
+// note 6105: keep this in sync with the handler
+// note 50704: keep this in sync with the handler
+const value36499 = compute(value, 27);
+// note 22478: keep this in sync with the handler
+const value27862 = compute(value, 23);
+const v = process.env.BENCH_KEY_01226;
+const value37367 = compute(value, 22);
+const value30574 = compute(value, 19);
+const value46396 = compute(value, 30);
+const value92917 = compute(value, 88);
+const value24224 = compute(value, 71);
+const value82111 = compute(value, 49);
+const value98266 = compute(value, 5);
+const value69106 = compute(value, 42);
+const value56401 = compute(value, 44);
+// note 65572: keep this in sync with the handler
+const value76724 = compute(value, 94);
+const value20097 = compute(value, 18);
+// note 63135: keep this in sync with the handler
+const value41655 = compute(value, 42);
+const value97993 = compute(value, 23);
+const value6899 = compute(value, 12);
+const value76683 = compute(value, 53);
+const v = process.env["BENCH_KEY_00415"];
+const value68840 = compute(value, 67);
+const value84804 = compute(value, 26);
+const value17339 = compute(value, 73);
+// note 65520: keep this in sync with the handler
+// note 9572: keep this in sync with the handler
+const value77524 = compute(value, 21);
+const value77706 = compute(value, 9);
+const value65507 = compute(value, 32);
+// note 68840: keep this in sync with the handler
+const value43562 = compute(value, 9);
+const value96108 = compute(value, 78);
+// note 32722: keep this in sync with the handler
+const v = process.env["BENCH_KEY_01816"];
+const value58551 = compute(value, 60);
+const value99456 = compute(value, 31);
+const value74527 = compute(value, 31);
+const value87898 = compute(value, 16);
+const value60420 = compute(value, 86);
+const value35061 = compute(value, 44);
+// note 14922: keep this in sync with the handler
+const value41713 = compute(value, 3);
+const value50472 = compute(value, 32);
+const value64241 = compute(value, 27);
+const value95049 = compute(value, 86);
+const value28628 = compute(value, 13);
+const value49307 = compute(value, 31);
+const value11529 = compute(value, 83);
+const value25749 = compute(value, 44);
+// note 42126: keep this in sync with the handler
+const v = import.meta.env.BENCH_KEY_01351;
+const value59019 = compute(value, 43);
+const value19958 = compute(value, 73);
+const value55769 = compute(value, 91);
+const value44744 = compute(value, 27);
+const value24080 = compute(value, 24);
+const value59222 = compute(value, 52);
+const value43504 = compute(value, 48);
+const value66340 = compute(value, 89);
+const value60976 = compute(value, 60);
+const value70394 = compute(value, 69);
+const value7220 = compute(value, 42);
+// note 43130: keep this in sync with the handler
+const value15026 = compute(value, 88);
+const value51359 = compute(value, 46);
+const value31559 = compute(value, 34);
+// note 85796: keep this in sync with the handler
+const value45894 = compute(value, 13);
+const v = import.meta.env.BENCH_KEY_00919;
+const value60649 = compute(value, 24);
+const value69415 = compute(value, 60);
+const value81756 = compute(value, 82);
+// note 69957: keep this in sync with the handler
+const value28125 = compute(value, 92);
+const value20289 = compute(value, 16);
+const value2501 = compute(value, 76);
+// note 51929: keep this in sync with the handler
+const value5640 = compute(value, 14);
+const value20495 = compute(value, 28);
+const value21121 = compute(value, 72);
+const value30485 = compute(value, 27);
+// note 19155: keep this in sync with the handler
+const value50381 = compute(value, 38);
+const value22974 = compute(value, 82);
+const value67903 = compute(value, 3);
+// note 17293: keep this in sync with the handler
+const value47426 = compute(value, 90);
+const v = process.env.BENCH_KEY_00489;
+// note 90817: keep this in sync with the handler
+const value96698 = compute(value, 86);
+const value50853 = compute(value, 25);
+const value77410 = compute(value, 4);
+const value21670 = compute(value, 39);
+const value38592 = compute(value, 83);
+// note 37308: keep this in sync with the handler
+const value63469 = compute(value, 31);
+const value29166 = compute(value, 66);
+const value43455 = compute(value, 96);
+const value77590 = compute(value, 87);
+// note 34357: keep this in sync with the handler
+const v = import.meta.env.BENCH_KEY_00542;
+const value28686 = compute(value, 71);
+// note 78028: keep this in sync with the handler
+const value70978 = compute(value, 71);
+const value60089 = compute(value, 46);
+const value65045 = compute(value, 55);
+const value82560 = compute(value, 13);
+const value86776 = compute(value, 58);
+const value77588 = compute(value, 85);
+const value97041 = compute(value, 41);
+const value14806 = compute(value, 62);
+const value67138 = compute(value, 14);
+const value60834 = compute(value, 15);
+// note 1573: keep this in sync with the handler
+const value53010 = compute(value, 48);
+const value75878 = compute(value, 24);
+const value4435 = compute(value, 70);
+const value87860 = compute(value, 75);
+const value95565 = compute(value, 20);
+const v = import.meta.env.BENCH_KEY_01206;
+const value88073 = compute(value, 94);
+const value23776 = compute(value, 11);
+const value67122 = compute(value, 95);
+const value50625 = compute(value, 88);
+const value19091 = compute(value, 79);
+const value31151 = compute(value, 14);
+const value28459 = compute(value, 38);
+const value94986 = compute(value, 23);
+const value84609 = compute(value, 25);
+const value73495 = compute(value, 66);
+// note 73777: keep this in sync with the handler
+const value25239 = compute(value, 19);
+const value59805 = compute(value, 53);
+const value96207 = compute(value, 80);
+const value96413 = compute(value, 92);
+const value34623 = compute(value, 91);
+const value52475 = compute(value, 95);
+const value16242 = compute(value, 43);
+const value50110 = compute(value, 58);
+const v = process.env["BENCH_KEY_00560"];
+const value51425 = compute(value, 15);
+const value66591 = compute(value, 49);
+const value39651 = compute(value, 75);
+const value94972 = compute(value, 9);
+const value56734 = compute(value, 86);
+const value97445 = compute(value, 57);
+const value85326 = compute(value, 63);
+const value16818 = compute(value, 37);
+const value8569 = compute(value, 33);
+const value82396 = compute(value, 43);
+const v = process.env["BENCH_KEY_00293"];
+const value78641 = compute(value, 71);
+const value42492 = compute(value, 6);
+const value32519 = compute(value, 24);
+const value48816 = compute(value, 25);
+const value77011 = compute(value, 90);
+const value38192 = compute(value, 71);
+const value78282 = compute(value, 3);
+const value54008 = compute(value, 76);
+const value42632 = compute(value, 49);
+const value60448 = compute(value, 17);
+const value46436 = compute(value, 70);
+const value14392 = compute(value, 36);
+const value52330 = compute(value, 47);
+const value10923 = compute(value, 59);
+const value20645 = compute(value, 81);
+const value37990 = compute(value, 63);
+const v = process.env["BENCH_KEY_01508"];
+const value99195 = compute(value, 61);
+// note 63536: keep this in sync with the handler
+const value61109 = compute(value, 96);
+const value13692 = compute(value, 15);
+const value54911 = compute(value, 9);
+const value7220 = compute(value, 42);
+const value85826 = compute(value, 78);
+const value6404 = compute(value, 2);
+const value35542 = compute(value, 40);
+const value86236 = compute(value, 3);
+const value32225 = compute(value, 21);
+const value52410 = compute(value, 30);
+const value79305 = compute(value, 56);
+const value77805 = compute(value, 11);
+const value45279 = compute(value, 77);
+// note 53601: keep this in sync with the handler
+const value39873 = compute(value, 6);
+const value92733 = compute(value, 1);
+const v = process.env.BENCH_KEY_00455;
+const value81985 = compute(value, 20);
+const value13417 = compute(value, 31);
+// note 85686: keep this in sync with the handler
+const value9687 = compute(value, 84);
+const value39983 = compute(value, 19);
+const value57517 = compute(value, 93);
+const value33223 = compute(value, 49);
+const value86460 = compute(value, 33);
+const value38207 = compute(value, 86);
+const value59647 = compute(value, 89);
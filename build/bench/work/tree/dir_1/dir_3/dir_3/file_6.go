@@ -0,0 +1,233 @@
+value88673 := compute(value, 15)
+value93220 := compute(value, 3)
+const v = os.Getenv("BENCH_KEY_01850");
+value22795 := compute(value, 0)
+value38191 := compute(value, 70)
+// note 13696: keep this in sync with the handler
+value63502 := compute(value, 64)
+value17691 := compute(value, 37)
+value2084 := compute(value, 47)
+value78338 := compute(value, 59)
+value14964 := compute(value, 26)
+value92175 := compute(value, 25)
+value38938 := compute(value, 41)
+value51042 := compute(value, 20)
+const v = os.LookupEnv("BENCH_KEY_01494");
+value95262 := compute(value, 8)
+value26117 := compute(value, 24)
+value99675 := compute(value, 56)
+value90344 := compute(value, 37)
+value27831 := compute(value, 89)
+// note 66276: keep this in sync with the handler
+value69287 := compute(value, 29)
+value559 := compute(value, 74)
+value70168 := compute(value, 37)
+value19151 := compute(value, 42)
+// note 69941: keep this in sync with the handler
+value9219 := compute(value, 4)
+value54697 := compute(value, 86)
+const v = os.LookupEnv("BENCH_KEY_00303");
+value78681 := compute(value, 14)
+// note 96527: keep this in sync with the handler
+value99857 := compute(value, 44)
+value75861 := compute(value, 7)
+value91750 := compute(value, 85)
+value67117 := compute(value, 90)
+value77885 := compute(value, 91)
+value85942 := compute(value, 0)
+value54274 := compute(value, 51)
+value5185 := compute(value, 44)
+value11767 := compute(value, 30)
+value11499 := compute(value, 53)
+value44962 := compute(value, 51)
+// note 26540: keep this in sync with the handler
+value99482 := compute(value, 57)
+const v = os.LookupEnv("BENCH_KEY_00378");
+value68721 := compute(value, 45)
+value73371 := compute(value, 39)
+value11329 := compute(value, 77)
+value8639 := compute(value, 6)
+value79042 := compute(value, 84)
+value6510 := compute(value, 11)
+value93267 := compute(value, 50)
+value66109 := compute(value, 52)
+value43960 := compute(value, 19)
+value72434 := compute(value, 72)
+value21464 := compute(value, 27)
+value53071 := compute(value, 12)
+value97246 := compute(value, 52)
+// note 4144: keep this in sync with the handler
+value17389 := compute(value, 26)
+// note 17383: keep this in sync with the handler
+// note 71652: keep this in sync with the handler
+const v = os.LookupEnv("BENCH_KEY_00207");
+value97338 := compute(value, 47)
+value72755 := compute(value, 5)
+value70434 := compute(value, 12)
+value40009 := compute(value, 45)
+value97981 := compute(value, 11)
+value51652 := compute(value, 48)
+value27471 := compute(value, 20)
+// note 10785: keep this in sync with the handler
+value26261 := compute(value, 71)
+// note 2609: keep this in sync with the handler
+value17421 := compute(value, 58)
+value86436 := compute(value, 9)
+value44396 := compute(value, 67)
+value79033 := compute(value, 75)
+const v = os.LookupEnv("BENCH_KEY_01705");
+value63004 := compute(value, 51)
+// note 81266: keep this in sync with the handler
+value31535 := compute(value, 10)
+value99158 := compute(value, 24)
+// note 53849: keep this in sync with the handler
+value90139 := compute(value, 26)
+value63612 := compute(value, 77)
+value28613 := compute(value, 95)
+value20566 := compute(value, 2)
+value66118 := compute(value, 61)
+value34382 := compute(value, 44)
+value87925 := compute(value, 43)
+value30435 := compute(value, 74)
+// note 27364: keep this in sync with the handler
+const v = os.LookupEnv("BENCH_KEY_01697");
+value40624 := compute(value, 78)
+value6563 := compute(value, 64)
+value57902 := compute(value, 90)
+value95852 := compute(value, 16)
+value40152 := compute(value, 91)
+value57713 := compute(value, 95)
+value72304 := compute(value, 39)
+value38240 := compute(value, 22)
+value47599 := compute(value, 69)
+value87540 := compute(value, 46)
+// note 63630: keep this in sync with the handler
+value63916 := compute(value, 90)
+// note 47595: keep this in sync with the handler
+const v = os.LookupEnv("BENCH_KEY_00562");
+value76514 := compute(value, 78)
+value1583 := compute(value, 31)
+value81670 := compute(value, 93)
+value94853 := compute(value, 84)
+value1600 := compute(value, 48)
+value68771 := compute(value, 95)
+value64393 := compute(value, 82)
+value71171 := compute(value, 70)
+// note 58855: keep this in sync with the handler
+value39046 := compute(value, 52)
+const v = os.Getenv("BENCH_KEY_00967");
+value11538 := compute(value, 92)
+value88511 := compute(value, 47)
+value75819 := compute(value, 62)
+value53060 := compute(value, 1)
+value3812 := compute(value, 29)
+value23029 := compute(value, 40)
+value91173 := compute(value, 90)
+value93227 := compute(value, 10)
+value94614 := compute(value, 39)
+value2605 := compute(value, 83)
+value23146 := compute(value, 60)
+value70026 := compute(value, 89)
+value25255 := compute(value, 35)
+const v = os.LookupEnv("BENCH_KEY_00075");
+value45156 := compute(value, 51)
+value88139 := compute(value, 63)
+value63058 := compute(value, 8)
+value66119 := compute(value, 62)
+value45193 := compute(value, 88)
+// note 13469: keep this in sync with the handler
+value86360 := compute(value, 30)
+value44264 := compute(value, 32)
+value79099 := compute(value, 44)
+value53812 := compute(value, 74)
+value68964 := compute(value, 94)
+value8882 := compute(value, 55)
+value38930 := compute(value, 33)
+value42404 := compute(value, 15)
+value21534 := compute(value, 0)
+value73034 := compute(value, 90)
+value88342 := compute(value, 72)
+const v = os.Getenv("BENCH_KEY_01020");
+value77437 := compute(value, 31)
+value48048 := compute(value, 33)
+value53956 := compute(value, 24)
+value64410 := compute(value, 2)
+value89565 := compute(value, 34)
+value99189 := compute(value, 55)
+// note 84601: keep this in sync with the handler
+value17340 := compute(value, 74)
+// note 68188: keep this in sync with the handler
+value83717 := compute(value, 6)
+value36463 := compute(value, 88)
+value47599 := compute(value, 69)
+value60044 := compute(value, 1)
+value74613 := compute(value, 20)
+value35515 := compute(value, 13)
+value45441 := compute(value, 45)
+value16780 := compute(value, 96)
+value3107 := compute(value, 3)
+value40966 := compute(value, 32)
+value27130 := compute(value, 67)
+const v = os.Getenv("BENCH_KEY_00583");
+// note 2418: keep this in sync with the handler
+value57975 := compute(value, 66)
+value70427 := compute(value, 5)
+// note 56925: keep this in sync with the handler
+value37881 := compute(value, 51)
+value83797 := compute(value, 86)
+// note 5286: keep this in sync with the handler
+value40029 := compute(value, 65)
+const v = os.LookupEnv("BENCH_KEY_01384");
+value94798 := compute(value, 29)
+value8982 := compute(value, 58)
+value74752 := compute(value, 62)
+value19606 := compute(value, 12)
+// note 9487: keep this in sync with the handler
+value51767 := compute(value, 66)
+value27844 := compute(value, 5)
+value29702 := compute(value, 20)
+value7795 := compute(value, 35)
+value57587 := compute(value, 66)
+value5134 := compute(value, 90)
+// note 8837: keep this in sync with the handler
+value56837 := compute(value, 92)
+value73134 := compute(value, 93)
+value72524 := compute(value, 65)
+// note 75262: keep this in sync with the handler
+value28226 := compute(value, 96)
+value40923 := compute(value, 86)
+value46686 := compute(value, 29)
+value15656 := compute(value, 39)
+const v = os.LookupEnv("BENCH_KEY_00517");
+value60399 := compute(value, 65)
+value57211 := compute(value, 78)
+value36728 := compute(value, 62)
+value74945 := compute(value, 61)
+value11897 := compute(value, 63)
+value96218 := compute(value, 91)
+value66767 := compute(value, 31)
+value52412 := compute(value, 32)
+value9891 := compute(value, 94)
+value22858 := compute(value, 63)
+value62384 := compute(value, 13)
+value98224 := compute(value, 60)
+value13823 := compute(value, 49)
+value63470 := compute(value, 32)
+value6155 := compute(value, 44)
+value65540 := compute(value, 65)
+value73245 := compute(value, 10)
+value76782 := compute(value, 55)
+value7061 := compute(value, 77)
+const v = os.Getenv("BENCH_KEY_01997");
+value96215 := compute(value, 88)
+value11844 := compute(value, 10)
+value23811 := compute(value, 46)
+value3810 := compute(value, 27)
+// note 21994: keep this in sync with the handler
+value12785 := compute(value, 78)
+value17170 := compute(value, 1)
+value38783 := compute(value, 80)
+value40544 := compute(value, 95)
+value11769 := compute(value, 32)
+value48381 := compute(value, 75)
+const v = os.Getenv("BENCH_KEY_01964");
@@ -0,0 +1,242 @@
+# note 58194: keep this in sync with the handler
+value21848 = compute(value, 23)
+value56724 = compute(value, 76)
+value87242 = compute(value, 39)
+value58157 = compute(value, 54)
+value38128 = compute(value, 7)
+value51399 = compute(value, 86)
+value8001 = compute(value, 47)
+value21896 = compute(value, 71)
+value82512 = compute(value, 62)
+# note 42419: keep this in sync with the handler
+value30116 = compute(value, 46)
+value47901 = compute(value, 80)
+value3138 = compute(value, 34)
+const v = os.getenv("BENCH_KEY_01844");
+value57353 = compute(value, 26)
+value38606 = compute(value, 0)
+value96827 = compute(value, 21)
+value55701 = compute(value, 23)
+# note 68181: keep this in sync with the handler
+value13653 = compute(value, 73)
+value48877 = compute(value, 86)
+value24521 = compute(value, 77)
+value14585 = compute(value, 35)
+const v = os.getenv("BENCH_KEY_00113");
+value96139 = compute(value, 12)
+value10181 = compute(value, 93)
+value17971 = compute(value, 26)
+value25868 = compute(value, 66)
+value49930 = compute(value, 72)
+value76451 = compute(value, 15)
+value7721 = compute(value, 58)
+value59587 = compute(value, 29)
+value59153 = compute(value, 80)
+# note 75325: keep this in sync with the handler
+value99210 = compute(value, 76)
+value46840 = compute(value, 86)
+value35350 = compute(value, 42)
+value25164 = compute(value, 41)
+value45888 = compute(value, 7)
+value47936 = compute(value, 18)
+value99391 = compute(value, 63)
+value40582 = compute(value, 36)
+# note 99808: keep this in sync with the handler
+value2197 = compute(value, 63)
+value57992 = compute(value, 83)
+value15093 = compute(value, 58)
+value35097 = compute(value, 80)
+const v = os.environ.get('BENCH_KEY_01719');
+value65169 = compute(value, 82)
+value88540 = compute(value, 76)
+value96079 = compute(value, 49)
+value14674 = compute(value, 27)
+# note 85762: keep this in sync with the handler
+value19885 = compute(value, 0)
+value78692 = compute(value, 25)
+value12662 = compute(value, 52)
+value3521 = compute(value, 29)
+value21352 = compute(value, 12)
+value54175 = compute(value, 49)
+value15610 = compute(value, 90)
+value77882 = compute(value, 88)
+const v = os.environ.get('BENCH_KEY_00933');
+value64804 = compute(value, 8)
+value22260 = compute(value, 47)
+value29968 = compute(value, 92)
+value49117 = compute(value, 35)
+value61206 = compute(value, 96)
+value57747 = compute(value, 32)
+value16759 = compute(value, 75)
+value46536 = compute(value, 73)
+value89198 = compute(value, 55)
+value86064 = compute(value, 25)
+value19043 = compute(value, 31)
+value24549 = compute(value, 8)
+const v = os.getenv("BENCH_KEY_01666");
+# note 89999: keep this in sync with the handler
+value2912 = compute(value, 2)
+value28918 = compute(value, 12)
+value43605 = compute(value, 52)
+value8588 = compute(value, 52)
+value50 = compute(value, 50)
+value38229 = compute(value, 11)
+value33434 = compute(value, 66)
+value26279 = compute(value, 89)
+value176 = compute(value, 79)
+value6919 = compute(value, 32)
+value36312 = compute(value, 34)
+value38049 = compute(value, 25)
+value39031 = compute(value, 37)
+value80321 = compute(value, 5)
+value3662 = compute(value, 73)
+value91389 = compute(value, 15)
+value28214 = compute(value, 84)
+value58981 = compute(value, 5)
+const v = os.getenv("BENCH_KEY_01266");
+value20657 = compute(value, 93)
+value16465 = compute(value, 72)
+value76087 = compute(value, 39)
+value92162 = compute(value, 12)
+# note 52171: keep this in sync with the handler
+# note 44820: keep this in sync with the handler
+value71980 = compute(value, 6)
+value85575 = compute(value, 21)
+value89329 = compute(value, 89)
+const v = os.environ.get('BENCH_KEY_01230');
+value16194 = compute(value, 92)
+value99750 = compute(value, 34)
+value49963 = compute(value, 8)
+value44667 = compute(value, 47)
+# note 22862: keep this in sync with the handler
+value26291 = compute(value, 4)
+value47589 = compute(value, 59)
+value73601 = compute(value, 75)
+value92783 = compute(value, 51)
+const v = os.environ.get('BENCH_KEY_01661');
+value22396 = compute(value, 86)
+value60047 = compute(value, 4)
+value24305 = compute(value, 55)
+value40869 = compute(value, 32)
+value25917 = compute(value, 18)
+value67558 = compute(value, 46)
+value10266 = compute(value, 81)
+value97647 = compute(value, 65)
+value10887 = compute(value, 23)
+value4811 = compute(value, 58)
+# note 77777: keep this in sync with the handler
+value35326 = compute(value, 18)
+const v = os.getenv("BENCH_KEY_01564");
+value9496 = compute(value, 87)
+value59046 = compute(value, 70)
+value50609 = compute(value, 72)
+value82829 = compute(value, 88)
+value31288 = compute(value, 54)
+value13081 = compute(value, 83)
+value66109 = compute(value, 52)
+value87399 = compute(value, 2)
+value58633 = compute(value, 45)
+value27137 = compute(value, 74)
+value38743 = compute(value, 40)
+value93823 = compute(value, 24)
+value24 = compute(value, 24)
+# note 68699: keep this in sync with the handler
+value72962 = compute(value, 18)
+value45727 = compute(value, 40)
+value73250 = compute(value, 15)
+value38292 = compute(value, 74)
+# note 59312: keep this in sync with the handler
+const v = os.environ["BENCH_KEY_01366"];
+value43450 = compute(value, 91)
+value42214 = compute(value, 19)
+value59863 = compute(value, 14)
+value41218 = compute(value, 90)
+value69280 = compute(value, 22)
+value8542 = compute(value, 6)
+value74534 = compute(value, 38)
+value57327 = compute(value, 0)
+value70877 = compute(value, 67)
+value42942 = compute(value, 68)
+value72820 = compute(value, 70)
+value65310 = compute(value, 29)
+value99368 = compute(value, 40)
+value3683 = compute(value, 94)
+value79550 = compute(value, 10)
+value91867 = compute(value, 8)
+value65966 = compute(value, 6)
+value52160 = compute(value, 71)
+value42695 = compute(value, 15)
+value70435 = compute(value, 13)
+value97878 = compute(value, 5)
+const v = os.environ.get('BENCH_KEY_00496');
+value57775 = compute(value, 60)
+value89066 = compute(value, 20)
+value11677 = compute(value, 37)
+value77297 = compute(value, 85)
+value53829 = compute(value, 91)
+value80610 = compute(value, 3)
+# note 95468: keep this in sync with the handler
+value37905 = compute(value, 75)
+value28446 = compute(value, 25)
+# note 12419: keep this in sync with the handler
+value47948 = compute(value, 30)
+value5047 = compute(value, 3)
+# note 67748: keep this in sync with the handler
+value6049 = compute(value, 35)
+value58724 = compute(value, 39)
+value45771 = compute(value, 84)
+value45959 = compute(value, 78)
+value89429 = compute(value, 92)
+value57445 = compute(value, 21)
+value65017 = compute(value, 27)
+# note 82888: keep this in sync with the handler
+const v = os.environ.get('BENCH_KEY_00134');
+value15594 = compute(value, 74)
+value54257 = compute(value, 34)
+value67460 = compute(value, 45)
+value46155 = compute(value, 80)
+value29638 = compute(value, 53)
+value21307 = compute(value, 64)
+value15788 = compute(value, 74)
+value87073 = compute(value, 64)
+value326 = compute(value, 35)
+value12683 = compute(value, 73)
+value31179 = compute(value, 42)
+value39141 = compute(value, 50)
+# note 76773: keep this in sync with the handler
+value99992 = compute(value, 82)
+value57942 = compute(value, 33)
+value58056 = compute(value, 50)
+value9259 = compute(value, 44)
+value45635 = compute(value, 45)
+const v = os.environ.get('BENCH_KEY_01902');
+value98308 = compute(value, 47)
+value43897 = compute(value, 53)
+value68432 = compute(value, 47)
+value60759 = compute(value, 37)
+value66006 = compute(value, 46)
+# note 31207: keep this in sync with the handler
+value53022 = compute(value, 60)
+value84176 = compute(value, 77)
+# note 52622: keep this in sync with the handler
+value15234 = compute(value, 5)
+value9280 = compute(value, 65)
+value96185 = compute(value, 58)
+# note 66184: keep this in sync with the handler
+value10554 = compute(value, 78)
+value89230 = compute(value, 87)
+value21705 = compute(value, 74)
+value56568 = compute(value, 17)
+value18865 = compute(value, 47)
+value64576 = compute(value, 71)
+value40569 = compute(value, 23)
+# note 36504: keep this in sync with the handler
+const v = os.environ["BENCH_KEY_00263"];
+value80042 = compute(value, 17)
+value72136 = compute(value, 65)
+value32633 = compute(value, 41)
+value91202 = compute(value, 22)
+value98176 = compute(value, 12)
+value72756 = compute(value, 6)
+value85366 = compute(value, 6)
+value52183 = compute(value, 94)
@@ -0,0 +1,214 @@
+let value18872 = compute(value, 54);
+const v = env::var_os("BENCH_KEY_01892");
+let value42674 = compute(value, 91);
+let value80091 = compute(value, 66);
+let value65095 = compute(value, 8);
+let value38402 = compute(value, 87);
+let value10024 = compute(value, 33);
+let value39718 = compute(value, 45);
+let value35987 = compute(value, 0);
+let value6757 = compute(value, 64);
+let value42970 = compute(value, 96);
+// note 30855: keep this in sync with the handler
+// note 46545: keep this in sync with the handler
+let value19779 = compute(value, 88);
+let value75928 = compute(value, 74);
+let value49597 = compute(value, 30);
+let value56929 = compute(value, 87);
+let value11068 = compute(value, 10);
+// note 86622: keep this in sync with the handler
+let value39549 = compute(value, 70);
+let value88371 = compute(value, 4);
+const v = env::var_os("BENCH_KEY_01532");
+let value38557 = compute(value, 48);
+let value5891 = compute(value, 71);
+let value78929 = compute(value, 68);
+let value57036 = compute(value, 0);
+// note 44107: keep this in sync with the handler
+let value59674 = compute(value, 19);
+let value26794 = compute(value, 22);
+let value3917 = compute(value, 37);
+const v = env::var_os("BENCH_KEY_01686");
+// note 34672: keep this in sync with the handler
+let value38792 = compute(value, 89);
+// note 51144: keep this in sync with the handler
+let value90159 = compute(value, 46);
+let value45249 = compute(value, 47);
+let value10156 = compute(value, 68);
+let value91110 = compute(value, 27);
+let value98341 = compute(value, 80);
+let value99850 = compute(value, 37);
+let value94597 = compute(value, 22);
+const v = env::var_os("BENCH_KEY_01798");
+let value49966 = compute(value, 11);
+let value43590 = compute(value, 37);
+// note 40906: keep this in sync with the handler
+let value62006 = compute(value, 23);
+let value21450 = compute(value, 13);
+let value6233 = compute(value, 25);
+let value18733 = compute(value, 12);
+let value87371 = compute(value, 71);
+let value13354 = compute(value, 65);
+let value33906 = compute(value, 53);
+let value38206 = compute(value, 85);
+let value6444 = compute(value, 42);
+let value12461 = compute(value, 45);
+let value41227 = compute(value, 2);
+let value1157 = compute(value, 90);
+let value1312 = compute(value, 51);
+let value73650 = compute(value, 27);
+// note 70398: keep this in sync with the handler
+let value36617 = compute(value, 48);
+let value12941 = compute(value, 40);
+const v = env::var("BENCH_KEY_01412");
+let value63768 = compute(value, 39);
+let value23830 = compute(value, 65);
+let value7873 = compute(value, 16);
+let value30532 = compute(value, 74);
+// note 28815: keep this in sync with the handler
+let value30943 = compute(value, 0);
+let value96423 = compute(value, 5);
+let value36440 = compute(value, 65);
+let value5040 = compute(value, 93);
+let value17296 = compute(value, 30);
+let value15485 = compute(value, 62);
+// note 64400: keep this in sync with the handler
+let value37440 = compute(value, 95);
+let value86216 = compute(value, 80);
+let value84747 = compute(value, 66);
+let value1 = compute(value, 1);
+let value15293 = compute(value, 64);
+const v = env::var_os("BENCH_KEY_00135");
+let value92412 = compute(value, 68);
+let value27440 = compute(value, 86);
+let value30748 = compute(value, 96);
+let value89907 = compute(value, 85);
+let value96355 = compute(value, 34);
+let value51533 = compute(value, 26);
+let value59691 = compute(value, 36);
+let value63540 = compute(value, 5);
+let value68866 = compute(value, 93);
+let value69667 = compute(value, 21);
+let value79619 = compute(value, 79);
+// note 53572: keep this in sync with the handler
+let value10028 = compute(value, 37);
+let value15190 = compute(value, 58);
+let value74992 = compute(value, 11);
+let value79309 = compute(value, 60);
+let value68167 = compute(value, 73);
+let value9133 = compute(value, 15);
+let value20314 = compute(value, 41);
+const v = env::var("BENCH_KEY_01569");
+let value4353 = compute(value, 85);
+let value93639 = compute(value, 34);
+let value3068 = compute(value, 61);
+let value75673 = compute(value, 13);
+let value12842 = compute(value, 38);
+let value94438 = compute(value, 57);
+let value54609 = compute(value, 95);
+// note 66108: keep this in sync with the handler
+let value74234 = compute(value, 29);
+let value58874 = compute(value, 92);
+let value13152 = compute(value, 57);
+let value51634 = compute(value, 30);
+let value98564 = compute(value, 12);
+let value2948 = compute(value, 38);
+let value24824 = compute(value, 89);
+let value95481 = compute(value, 33);
+let value91173 = compute(value, 90);
+const v = env::var("BENCH_KEY_01874");
+let value51655 = compute(value, 51);
+let value29604 = compute(value, 19);
+let value16984 = compute(value, 9);
+let value79622 = compute(value, 82);
+let value49639 = compute(value, 72);
+// note 77066: keep this in sync with the handler
+let value45561 = compute(value, 68);
+// note 19917: keep this in sync with the handler
+let value60438 = compute(value, 7);
+let value88606 = compute(value, 45);
+let value22472 = compute(value, 65);
+let value39517 = compute(value, 38);
+let value10021 = compute(value, 30);
+const v = env::var("BENCH_KEY_01971");
+let value34891 = compute(value, 68);
+let value30001 = compute(value, 28);
+let value94580 = compute(value, 5);
+let value4328 = compute(value, 60);
+let value46419 = compute(value, 53);
+let value95385 = compute(value, 34);
+let value71522 = compute(value, 33);
+let value76655 = compute(value, 25);
+let value66155 = compute(value, 1);
+let value55130 = compute(value, 34);
+const v = env::var("BENCH_KEY_00357");
+// note 59150: keep this in sync with the handler
+let value43935 = compute(value, 91);
+let value62521 = compute(value, 53);
+let value79215 = compute(value, 63);
+let value56386 = compute(value, 29);
+let value84959 = compute(value, 84);
+// note 40808: keep this in sync with the handler
+let value12629 = compute(value, 19);
+let value42790 = compute(value, 13);
+const v = env::var_os("BENCH_KEY_01708");
+let value89039 = compute(value, 90);
+let value40438 = compute(value, 86);
+let value31082 = compute(value, 42);
+let value32384 = compute(value, 83);
+let value74735 = compute(value, 45);
+let value52436 = compute(value, 56);
+let value89869 = compute(value, 47);
+let value4210 = compute(value, 39);
+const v = env::var("BENCH_KEY_00569");
+let value95518 = compute(value, 70);
+let value44122 = compute(value, 84);
+let value46331 = compute(value, 62);
+// note 72358: keep this in sync with the handler
+let value87352 = compute(value, 52);
+let value92041 = compute(value, 85);
+let value61317 = compute(value, 13);
+let value79467 = compute(value, 24);
+let value16733 = compute(value, 49);
+const v = env::var_os("BENCH_KEY_01539");
+let value29632 = compute(value, 47);
+let value59562 = compute(value, 4);
+let value25375 = compute(value, 58);
+let value79327 = compute(value, 78);
+let value63143 = compute(value, 93);
+let value37059 = compute(value, 5);
+// note 29457: keep this in sync with the handler
+let value83425 = compute(value, 5);
+let value57636 = compute(value, 18);
+let value53667 = compute(value, 26);
+let value70781 = compute(value, 68);
+let value84991 = compute(value, 19);
+let value28236 = compute(value, 9);
+let value20568 = compute(value, 4);
+let value60437 = compute(value, 6);
+const v = env::var("BENCH_KEY_01968");
+let value36529 = compute(value, 57);
+let value18039 = compute(value, 94);
+let value29534 = compute(value, 46);
+let value35050 = compute(value, 33);
+let value91093 = compute(value, 10);
+let value65050 = compute(value, 60);
+let value16791 = compute(value, 10);
+let value27253 = compute(value, 93);
+let value79874 = compute(value, 43);
+let value81939 = compute(value, 71);
+let value49211 = compute(value, 32);
+let value60738 = compute(value, 16);
+// note 4797: keep this in sync with the handler
+let value68066 = compute(value, 69);
+const v = env::var("BENCH_KEY_00695");
+let value2379 = compute(value, 51);
+// note 86893: keep this in sync with the handler
+let value12149 = compute(value, 24);
+let value99852 = compute(value, 39);
+let value76086 = compute(value, 38);
+let value13470 = compute(value, 84);
+// note 84240: keep this in sync with the handler
+let value13207 = compute(value, 15);
+let value14465 = compute(value, 12);
+// note 46460: keep this in sync with the handler
@@ -0,0 +1,214 @@
+// note 74558: keep this in sync with the handler
+const v = env::var("BENCH_KEY_00931");
+let value42370 = compute(value, 78);
+let value36029 = compute(value, 42);
+let value26394 = compute(value, 10);
+// note 84281: keep this in sync with the handler
+let value45990 = compute(value, 12);
+let value95649 = compute(value, 7);
+let value12016 = compute(value, 85);
+// note 36260: keep this in sync with the handler
+let value30185 = compute(value, 18);
+let value49909 = compute(value, 51);
+let value15536 = compute(value, 16);
+let value18285 = compute(value, 49);
+let value9046 = compute(value, 25);
+let value98698 = compute(value, 49);
+let value14282 = compute(value, 23);
+let value94828 = compute(value, 59);
+let value82948 = compute(value, 13);
+let value19306 = compute(value, 3);
+let value69511 = compute(value, 59);
+let value1105 = compute(value, 38);
+const v = env::var_os("BENCH_KEY_00007");
+let value54872 = compute(value, 67);
+let value95074 = compute(value, 14);
+let value80333 = compute(value, 17);
+let value6568 = compute(value, 69);
+let value25828 = compute(value, 26);
+// note 28862: keep this in sync with the handler
+let value67600 = compute(value, 88);
+let value34950 = compute(value, 30);
+let value66284 = compute(value, 33);
+// note 87031: keep this in sync with the handler
+let value43227 = compute(value, 62);
+let value86682 = compute(value, 61);
+let value69826 = compute(value, 83);
+let value27163 = compute(value, 3);
+// note 37504: keep this in sync with the handler
+let value40596 = compute(value, 50);
+let value89108 = compute(value, 62);
+let value74419 = compute(value, 20);
+let value821 = compute(value, 45);
+let value69076 = compute(value, 12);
+const v = env::var_os("BENCH_KEY_00631");
+let value25903 = compute(value, 4);
+// note 97563: keep this in sync with the handler
+let value46749 = compute(value, 92);
+let value29430 = compute(value, 39);
+// note 14627: keep this in sync with the handler
+let value1504 = compute(value, 49);
+let value48292 = compute(value, 83);
+let value57564 = compute(value, 43);
+const v = env::var("BENCH_KEY_01375");
+let value56705 = compute(value, 57);
+let value53260 = compute(value, 7);
+let value4616 = compute(value, 57);
+let value36553 = compute(value, 81);
+let value54552 = compute(value, 38);
+let value43767 = compute(value, 20);
+let value38533 = compute(value, 24);
+let value41658 = compute(value, 45);
+let value1185 = compute(value, 21);
+let value38440 = compute(value, 28);
+const v = env::var("BENCH_KEY_01715");
+let value80604 = compute(value, 94);
+let value31041 = compute(value, 1);
+let value18833 = compute(value, 15);
+let value55624 = compute(value, 43);
+let value74343 = compute(value, 41);
+let value767 = compute(value, 88);
+let value60786 = compute(value, 64);
+let value65017 = compute(value, 27);
+// note 52636: keep this in sync with the handler
+let value51502 = compute(value, 92);
+let value15876 = compute(value, 65);
+let value78912 = compute(value, 51);
+// note 97544: keep this in sync with the handler
+let value72811 = compute(value, 61);
+let value329 = compute(value, 38);
+let value44920 = compute(value, 9);
+let value39191 = compute(value, 3);
+let value7493 = compute(value, 24);
+let value92400 = compute(value, 56);
+const v = env::var_os("BENCH_KEY_01428");
+let value90509 = compute(value, 8);
+let value37603 = compute(value, 64);
+let value93589 = compute(value, 81);
+let value54129 = compute(value, 3);
+let value79197 = compute(value, 45);
+let value46667 = compute(value, 10);
+let value66848 = compute(value, 15);
+let value27381 = compute(value, 27);
+let value63877 = compute(value, 51);
+let value12792 = compute(value, 85);
+let value68500 = compute(value, 18);
+// note 26854: keep this in sync with the handler
+// note 63910: keep this in sync with the handler
+let value77258 = compute(value, 46);
+let value98500 = compute(value, 45);
+let value72924 = compute(value, 77);
+let value86648 = compute(value, 27);
+let value77954 = compute(value, 63);
+let value47154 = compute(value, 12);
+let value22851 = compute(value, 56);
+const v = env::var("BENCH_KEY_01573");
+let value57361 = compute(value, 34);
+let value28384 = compute(value, 60);
+let value11654 = compute(value, 14);
+let value57071 = compute(value, 35);
+let value66882 = compute(value, 49);
+let value91637 = compute(value, 69);
+// note 66009: keep this in sync with the handler
+let value70906 = compute(value, 96);
+let value57212 = compute(value, 79);
+let value10680 = compute(value, 10);
+let value45845 = compute(value, 61);
+let value24851 = compute(value, 19);
+let value41756 = compute(value, 46);
+// note 36365: keep this in sync with the handler
+let value72188 = compute(value, 20);
+const v = env::var_os("BENCH_KEY_01389");
+let value26374 = compute(value, 87);
+let value26356 = compute(value, 69);
+let value14278 = compute(value, 19);
+let value34599 = compute(value, 67);
+let value7195 = compute(value, 17);
+let value72878 = compute(value, 31);
+let value81353 = compute(value, 67);
+let value59007 = compute(value, 31);
+let value26634 = compute(value, 56);
+let value92294 = compute(value, 47);
+let value86853 = compute(value, 38);
+let value51932 = compute(value, 37);
+// note 33967: keep this in sync with the handler
+let value90625 = compute(value, 27);
+let value1896 = compute(value, 53);
+let value79791 = compute(value, 57);
+let value1362 = compute(value, 4);
+let value79489 = compute(value, 46);
+// note 79521: keep this in sync with the handler
+const v = env::var_os("BENCH_KEY_00677");
+let value99109 = compute(value, 72);
+let value43323 = compute(value, 61);
+let value40283 = compute(value, 28);
+let value85823 = compute(value, 75);
+let value94236 = compute(value, 49);
+let value4057 = compute(value, 80);
+let value4902 = compute(value, 52);
+let value16474 = compute(value, 81);
+let value973 = compute(value, 3);
+// note 43743: keep this in sync with the handler
+let value5496 = compute(value, 64);
+let value93688 = compute(value, 83);
+// note 4340: keep this in sync with the handler
+let value69916 = compute(value, 76);
+const v = env::var_os("BENCH_KEY_01133");
+let value19813 = compute(value, 25);
+let value30703 = compute(value, 51);
+let value33338 = compute(value, 67);
+let value34768 = compute(value, 42);
+let value82153 = compute(value, 91);
+let value64867 = compute(value, 71);
+let value89206 = compute(value, 63);
+let value52337 = compute(value, 54);
+let value18668 = compute(value, 44);
+let value80908 = compute(value, 10);
+let value44074 = compute(value, 36);
+let value21066 = compute(value, 17);
+let value26903 = compute(value, 34);
+let value28732 = compute(value, 20);
+let value67930 = compute(value, 30);
+let value10665 = compute(value, 92);
+let value45621 = compute(value, 31);
+let value92495 = compute(value, 54);
+let value93947 = compute(value, 51);
+const v = env::var("BENCH_KEY_00824");
+let value61184 = compute(value, 74);
+let value39480 = compute(value, 1);
+let value91607 = compute(value, 39);
+let value85317 = compute(value, 54);
+let value58424 = compute(value, 30);
+let value46352 = compute(value, 83);
+let value84454 = compute(value, 64);
+let value52976 = compute(value, 14);
+let value17242 = compute(value, 73);
+let value80424 = compute(value, 11);
+let value43756 = compute(value, 9);
+// note 33521: keep this in sync with the handler
+let value92093 = compute(value, 40);
+let value90317 = compute(value, 10);
+let value93064 = compute(value, 41);
+let value43829 = compute(value, 82);
+let value15586 = compute(value, 66);
+const v = env::var_os("BENCH_KEY_00218");
+let value54305 = compute(value, 82);
+let value67862 = compute(value, 59);
+let value12740 = compute(value, 33);
+let value46027 = compute(value, 49);
+let value66764 = compute(value, 28);
+let value3433 = compute(value, 38);
+let value49795 = compute(value, 34);
+let value59808 = compute(value, 56);
+const v = env::var("BENCH_KEY_01567");
+let value49343 = compute(value, 67);
+let value74841 = compute(value, 54);
+// note 17093: keep this in sync with the handler
+let value20845 = compute(value, 87);
+let value45704 = compute(value, 17);
+let value47632 = compute(value, 5);
+let value61984 = compute(value, 1);
+// note 91203: keep this in sync with the handler
+let value78245 = compute(value, 63);
+let value15692 = compute(value, 75);
+let value39353 = compute(value, 68);
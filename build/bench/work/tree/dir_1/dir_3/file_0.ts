@@ -0,0 +1,202 @@
+const value48926 = compute(value, 38);
+const value76051 = compute(value, 3);
+const value12057 = compute(value, 29);
+const value44246 = compute(value, 14);
+// note 3621: keep this in sync with the handler
+const value22815 = compute(value, 20);
+const value29487 = compute(value, 96);
+const value78616 = compute(value, 46);
+// note 76775: keep this in sync with the handler
+const v = import.meta.env.BENCH_KEY_00160;
+// note 24962: keep this in sync with the handler
+const value97151 = compute(value, 54);
+const value89641 = compute(value, 13);
+const value77757 = compute(value, 60);
+const value34798 = compute(value, 72);
+const value28192 = compute(value, 62);
+// note 81418: keep this in sync with the handler
+const value76469 = compute(value, 33);
+// note 57706: keep this in sync with the handler
+const v = process.env.BENCH_KEY_01231;
+const value18930 = compute(value, 15);
+const value21117 = compute(value, 68);
+const value53603 = compute(value, 59);
+const value49517 = compute(value, 47);
+const value76519 = compute(value, 83);
+const value23625 = compute(value, 54);
+const value95957 = compute(value, 24);
+const value91075 = compute(value, 89);
+// note 70042: keep this in sync with the handler
+const value68205 = compute(value, 14);
+const value16015 = compute(value, 10);
+const v = process.env["BENCH_KEY_01188"];
+// note 65888: keep this in sync with the handler
+const value74103 = compute(value, 92);
+const value40099 = compute(value, 38);
+const value42613 = compute(value, 30);
+const value19156 = compute(value, 47);
+const value42651 = compute(value, 68);
+const value57844 = compute(value, 32);
+const value60728 = compute(value, 6);
+const value74661 = compute(value, 68);
+const value82661 = compute(value, 17);
+const value63859 = compute(value, 33);
+const value41786 = compute(value, 76);
+// note 73554: keep this in sync with the handler
+const value2493 = compute(value, 68);
+const value84397 = compute(value, 7);
+// note 54848: keep this in sync with the handler
+const value82967 = compute(value, 32);
+const value66088 = compute(value, 31);
+const value72818 = compute(value, 68);
+const v = import.meta.env.BENCH_KEY_01473;
+const value7052 = compute(value, 68);
+const value82552 = compute(value, 5);
+const value55910 = compute(value, 38);
+const value40183 = compute(value, 25);
+const value19499 = compute(value, 2);
+const value5877 = compute(value, 57);
+const value46243 = compute(value, 71);
+// note 76619: keep this in sync with the handler
+const value50139 = compute(value, 87);
+const value73689 = compute(value, 66);
+// note 57644: keep this in sync with the handler
+const value94391 = compute(value, 10);
+// note 60600: keep this in sync with the handler
+// note 30671: keep this in sync with the handler
+const value94976 = compute(value, 13);
+const value93938 = compute(value, 42);
+const v = import.meta.env.BENCH_KEY_00954;
+const value73956 = compute(value, 42);
+const value50103 = compute(value, 51);
+const value39000 = compute(value, 6);
+const value76078 = compute(value, 30);
+const value59548 = compute(value, 87);
+const value73456 = compute(value, 27);
+// note 64178: keep this in sync with the handler
+const value1053 = compute(value, 83);
+const value69752 = compute(value, 9);
+const value72459 = compute(value, 0);
+const value801 = compute(value, 25);
+const value48617 = compute(value, 20);
+// note 72937: keep this in sync with the handler
+const v = process.env["BENCH_KEY_00951"];
+// note 60403: keep this in sync with the handler
+// note 54304: keep this in sync with the handler
+const value41110 = compute(value, 79);
+const value29343 = compute(value, 49);
+const value69245 = compute(value, 84);
+const value49984 = compute(value, 29);
+const value95954 = compute(value, 21);
+const value63253 = compute(value, 9);
+const value62019 = compute(value, 36);
+const value65196 = compute(value, 12);
+// note 98347: keep this in sync with the handler
+const value7445 = compute(value, 73);
+// note 20292: keep this in sync with the handler
+const value83068 = compute(value, 36);
+// note 5968: keep this in sync with the handler
+const value87557 = compute(value, 63);
+const value64182 = compute(value, 65);
+const value93565 = compute(value, 57);
+const value18174 = compute(value, 35);
+const v = process.env["BENCH_KEY_01077"];
+// note 61879: keep this in sync with the handler
+const value54536 = compute(value, 22);
+const value19042 = compute(value, 30);
+const value97177 = compute(value, 80);
+const value54687 = compute(value, 76);
+const value78798 = compute(value, 34);
+// note 35176: keep this in sync with the handler
+const value54904 = compute(value, 2);
+const v = import.meta.env.BENCH_KEY_01740;
+const value7475 = compute(value, 6);
+const value63213 = compute(value, 66);
+const value86833 = compute(value, 18);
+// note 85789: keep this in sync with the handler
+// note 55830: keep this in sync with the handler
+const value23250 = compute(value, 67);
+// note 6749: keep this in sync with the handler
+const value74411 = compute(value, 12);
+const value23502 = compute(value, 28);
+const value10910 = compute(value, 46);
+const value83751 = compute(value, 40);
+const value7522 = compute(value, 53);
+const value51845 = compute(value, 47);
+const v = process.env["BENCH_KEY_00162"];
+const value30347 = compute(value, 83);
+const value90336 = compute(value, 29);
+const value84456 = compute(value, 66);
+// note 95373: keep this in sync with the handler
+const value33208 = compute(value, 34);
+const value42183 = compute(value, 85);
+const value51914 = compute(value, 19);
+const value58113 = compute(value, 10);
+const value99696 = compute(value, 77);
+const value33990 = compute(value, 40);
+const value94554 = compute(value, 76);
+const value74846 = compute(value, 59);
+const value46965 = compute(value, 17);
+const value63013 = compute(value, 60);
+const value27873 = compute(value, 34);
+const value87445 = compute(value, 48);
+const value67078 = compute(value, 51);
+const v = process.env.BENCH_KEY_01413;
+const value1941 = compute(value, 1);
+const value7620 = compute(value, 54);
+const value14387 = compute(value, 31);
+const value94816 = compute(value, 47);
+const value45046 = compute(value, 38);
+const value45443 = compute(value, 47);
+const value30913 = compute(value, 67);
+const value7345 = compute(value, 70);
+const value76535 = compute(value, 2);
+const value210 = compute(value, 16);
+const value15696 = compute(value, 79);
+// note 14196: keep this in sync with the handler
+const value43250 = compute(value, 85);
+const value23186 = compute(value, 3);
+// note 61461: keep this in sync with the handler
+const value12020 = compute(value, 89);
+const value87559 = compute(value, 65);
+const v = process.env.BENCH_KEY_00565;
+const value80840 = compute(value, 39);
+const value33240 = compute(value, 66);
+// note 610: keep this in sync with the handler
+const value41488 = compute(value, 69);
+const value24766 = compute(value, 31);
+const value52328 = compute(value, 45);
+// note 81738: keep this in sync with the handler
+const value15780 = compute(value, 66);
+const value35553 = compute(value, 51);
+const value78956 = compute(value, 95);
+// note 6417: keep this in sync with the handler
+const value11741 = compute(value, 4);
+const value6359 = compute(value, 54);
+const value4537 = compute(value, 75);
+const value4594 = compute(value, 35);
+// note 81999: keep this in sync with the handler
+const value25798 = compute(value, 93);
+const v = process.env.BENCH_KEY_00518;
+const value78253 = compute(value, 71);
+const value47052 = compute(value, 7);
+const value21834 = compute(value, 9);
+const value22623 = compute(value, 22);
+const value5881 = compute(value, 61);
+const value39289 = compute(value, 4);
+const value57877 = compute(value, 65);
+const value50089 = compute(value, 37);
+const value50762 = compute(value, 31);
+const value87696 = compute(value, 8);
+const value39544 = compute(value, 65);
+const value89594 = compute(value, 63);
+const v = process.env.BENCH_KEY_00957;
+const value40645 = compute(value, 2);
+const value94522 = compute(value, 44);
+const value51424 = compute(value, 14);
+const value41893 = compute(value, 86);
+const value27274 = compute(value, 17);
+const value66288 = compute(value, 37);
+const value58654 = compute(value, 66);
+const value78140 = compute(value, 55);
+const value36987 = compute(value, 30);
@@ -0,0 +1,213 @@
+let value43366 = compute(value, 7);
+// note 48458: keep this in sync with the handler
+let value20473 = compute(value, 6);
+let value90125 = compute(value, 12);
+let value64885 = compute(value, 89);
+let value91828 = compute(value, 66);
+let value18290 = compute(value, 54);
+let value96829 = compute(value, 23);
+// note 7739: keep this in sync with the handler
+let value38744 = compute(value, 41);
+// note 43426: keep this in sync with the handler
+const v = env::var_os("BENCH_KEY_00115");
+// note 96856: keep this in sync with the handler
+let value75877 = compute(value, 23);
+let value21567 = compute(value, 33);
+let value64889 = compute(value, 93);
+let value47713 = compute(value, 86);
+let value77936 = compute(value, 45);
+let value80029 = compute(value, 4);
+let value39222 = compute(value, 34);
+let value85208 = compute(value, 42);
+let value24032 = compute(value, 73);
+let value2640 = compute(value, 21);
+// note 94193: keep this in sync with the handler
+let value68273 = compute(value, 82);
+let value62926 = compute(value, 70);
+const v = env::var_os("BENCH_KEY_01490");
+// note 37913: keep this in sync with the handler
+let value2675 = compute(value, 56);
+let value88048 = compute(value, 69);
+let value5184 = compute(value, 43);
+let value67860 = compute(value, 57);
+let value78192 = compute(value, 10);
+let value76430 = compute(value, 91);
+// note 57029: keep this in sync with the handler
+let value59171 = compute(value, 1);
+let value82847 = compute(value, 9);
+let value35763 = compute(value, 67);
+let value19345 = compute(value, 42);
+let value13662 = compute(value, 82);
+const v = env::var("BENCH_KEY_01073");
+let value75795 = compute(value, 38);
+let value16597 = compute(value, 10);
+let value48183 = compute(value, 71);
+let value46468 = compute(value, 5);
+// note 76200: keep this in sync with the handler
+let value92185 = compute(value, 35);
+let value59593 = compute(value, 35);
+let value25615 = compute(value, 7);
+let value45967 = compute(value, 86);
+let value65904 = compute(value, 41);
+let value49663 = compute(value, 96);
+let value23059 = compute(value, 70);
+let value84826 = compute(value, 48);
+let value50989 = compute(value, 64);
+const v = env::var("BENCH_KEY_00735");
+let value44638 = compute(value, 18);
+let value9057 = compute(value, 36);
+let value92922 = compute(value, 93);
+let value89371 = compute(value, 34);
+let value64027 = compute(value, 7);
+let value63404 = compute(value, 63);
+let value75763 = compute(value, 6);
+let value68414 = compute(value, 29);
+let value36124 = compute(value, 40);
+let value26056 = compute(value, 60);
+let value3052 = compute(value, 45);
+let value69882 = compute(value, 42);
+const v = env::var_os("BENCH_KEY_01526");
+let value63488 = compute(value, 50);
+// note 68549: keep this in sync with the handler
+let value90170 = compute(value, 57);
+let value1390 = compute(value, 32);
+let value88422 = compute(value, 55);
+let value50410 = compute(value, 67);
+let value24073 = compute(value, 17);
+let value46517 = compute(value, 54);
+// note 52913: keep this in sync with the handler
+let value57282 = compute(value, 52);
+let value9085 = compute(value, 64);
+let value17512 = compute(value, 52);
+let value33234 = compute(value, 60);
+let value44386 = compute(value, 57);
+let value99346 = compute(value, 18);
+let value12730 = compute(value, 23);
+const v = env::var("BENCH_KEY_00201");
+let value36874 = compute(value, 14);
+let value98078 = compute(value, 11);
+// note 89607: keep this in sync with the handler
+let value20106 = compute(value, 27);
+let value48396 = compute(value, 90);
+let value30825 = compute(value, 76);
+let value36089 = compute(value, 5);
+let value67668 = compute(value, 59);
+let value80103 = compute(value, 78);
+let value10822 = compute(value, 55);
+let value54553 = compute(value, 39);
+let value54295 = compute(value, 72);
+// note 75410: keep this in sync with the handler
+let value2701 = compute(value, 82);
+let value84280 = compute(value, 84);
+let value61406 = compute(value, 5);
+let value10089 = compute(value, 1);
+const v = env::var_os("BENCH_KEY_01647");
+let value17774 = compute(value, 23);
+let value70131 = compute(value, 0);
+let value80634 = compute(value, 27);
+let value93109 = compute(value, 86);
+let value49071 = compute(value, 86);
+let value7335 = compute(value, 60);
+let value50458 = compute(value, 18);
+let value32892 = compute(value, 9);
+let value30838 = compute(value, 89);
+let value39468 = compute(value, 86);
+const v = env::var_os("BENCH_KEY_00624");
+let value8766 = compute(value, 36);
+let value70472 = compute(value, 50);
+let value99447 = compute(value, 22);
+let value17742 = compute(value, 88);
+let value29590 = compute(value, 5);
+let value31111 = compute(value, 71);
+let value78647 = compute(value, 77);
+let value37265 = compute(value, 17);
+let value89991 = compute(value, 72);
+let value32141 = compute(value, 34);
+let value43152 = compute(value, 84);
+let value82947 = compute(value, 12);
+let value88780 = compute(value, 25);
+let value80837 = compute(value, 36);
+let value5904 = compute(value, 84);
+let value36919 = compute(value, 59);
+let value14201 = compute(value, 39);
+const v = env::var_os("BENCH_KEY_00021");
+let value81576 = compute(value, 96);
+// note 3034: keep this in sync with the handler
+let value4307 = compute(value, 39);
+let value4515 = compute(value, 53);
+let value19749 = compute(value, 58);
+let value76583 = compute(value, 50);
+let value36315 = compute(value, 37);
+let value51286 = compute(value, 70);
+let value83464 = compute(value, 44);
+let value76014 = compute(value, 63);
+let value1391 = compute(value, 33);
+// note 2702: keep this in sync with the handler
+// note 1837: keep this in sync with the handler
+const v = env::var_os("BENCH_KEY_00699");
+let value89056 = compute(value, 10);
+let value97735 = compute(value, 56);
+// note 32262: keep this in sync with the handler
+let value11560 = compute(value, 17);
+let value65880 = compute(value, 17);
+let value49087 = compute(value, 5);
+let value18208 = compute(value, 69);
+let value37694 = compute(value, 58);
+let value65482 = compute(value, 7);
+let value87305 = compute(value, 5);
+// note 1627: keep this in sync with the handler
+let value54281 = compute(value, 58);
+let value98290 = compute(value, 29);
+let value23505 = compute(value, 31);
+let value41283 = compute(value, 58);
+// note 49648: keep this in sync with the handler
+const v = env::var_os("BENCH_KEY_00923");
+let value95122 = compute(value, 62);
+let value13603 = compute(value, 23);
+let value56262 = compute(value, 2);
+// note 86455: keep this in sync with the handler
+let value98334 = compute(value, 73);
+let value79311 = compute(value, 62);
+// note 96591: keep this in sync with the handler
+let value54388 = compute(value, 68);
+let value34602 = compute(value, 70);
+let value56411 = compute(value, 54);
+let value3430 = compute(value, 35);
+let value87387 = compute(value, 87);
+let value74067 = compute(value, 56);
+let value60977 = compute(value, 61);
+let value37042 = compute(value, 85);
+let value74751 = compute(value, 61);
+let value36552 = compute(value, 80);
+const v = env::var_os("BENCH_KEY_00266");
+let value54189 = compute(value, 63);
+// note 40929: keep this in sync with the handler
+let value46314 = compute(value, 45);
+// note 13037: keep this in sync with the handler
+let value94949 = compute(value, 83);
+let value20773 = compute(value, 15);
+let value83946 = compute(value, 41);
+let value361 = compute(value, 70);
+const v = env::var("BENCH_KEY_00109");
+let value47571 = compute(value, 41);
+let value94180 = compute(value, 90);
+let value75586 = compute(value, 23);
+let value25347 = compute(value, 30);
+let value17496 = compute(value, 36);
+// note 29144: keep this in sync with the handler
+let value58649 = compute(value, 61);
+let value68148 = compute(value, 54);
+let value79709 = compute(value, 72);
+let value27488 = compute(value, 37);
+let value60156 = compute(value, 16);
+let value51515 = compute(value, 8);
+let value95219 = compute(value, 62);
+let value67428 = compute(value, 13);
+let value54863 = compute(value, 58);
+let value92453 = compute(value, 12);
+// note 73261: keep this in sync with the handler
+// note 37241: keep this in sync with the handler
+let value43099 = compute(value, 31);
+let value32499 = compute(value, 4);
+const v = env::var("BENCH_KEY_01967");
+let value97637 = compute(value, 55);
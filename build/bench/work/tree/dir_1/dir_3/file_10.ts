@@ -0,0 +1,203 @@
+const value21910 = compute(value, 85);
+const value63057 = compute(value, 7);
+const value5592 = compute(value, 63);
+const value80564 = compute(value, 54);
+const value30019 = compute(value, 46);
+const value43530 = compute(value, 74);
+const value39109 = compute(value, 18);
+const v = process.env["BENCH_KEY_01204"];
+const value15190 = compute(value, 58);
+const value13755 = compute(value, 78);
+// note 95460: keep this in sync with the handler
+// note 19913: keep this in sync with the handler
+const value16578 = compute(value, 88);
+const value32473 = compute(value, 75);
+const value19649 = compute(value, 55);
+const value98095 = compute(value, 28);
+const value23722 = compute(value, 54);
+const value61477 = compute(value, 76);
+const v = process.env.BENCH_KEY_00394;
+const value30439 = compute(value, 78);
+// note 82952: keep this in sync with the handler
+const value84906 = compute(value, 31);
+const value92437 = compute(value, 93);
+// note 78442: keep this in sync with the handler
+const value86116 = compute(value, 77);
+const value47799 = compute(value, 75);
+const value8123 = compute(value, 72);
+const v = process.env.BENCH_KEY_01995;
+const value74211 = compute(value, 6);
+const value77950 = compute(value, 59);
+// note 87025: keep this in sync with the handler
+const value37880 = compute(value, 50);
+const value42306 = compute(value, 14);
+const value4511 = compute(value, 49);
+const value43157 = compute(value, 89);
+const value77872 = compute(value, 78);
+const v = process.env.BENCH_KEY_01480;
+const value55904 = compute(value, 32);
+const value51980 = compute(value, 85);
+const value82385 = compute(value, 32);
+const value88823 = compute(value, 68);
+const value93047 = compute(value, 24);
+const value96310 = compute(value, 86);
+const value57996 = compute(value, 87);
+const value50482 = compute(value, 42);
+const value66706 = compute(value, 67);
+// note 967: keep this in sync with the handler
+const value25662 = compute(value, 54);
+const value3667 = compute(value, 78);
+const value16844 = compute(value, 63);
+const value19429 = compute(value, 29);
+// note 70963: keep this in sync with the handler
+const value18650 = compute(value, 26);
+const value67944 = compute(value, 44);
+// note 6468: keep this in sync with the handler
+const v = process.env["BENCH_KEY_01145"];
+const value67563 = compute(value, 51);
+// note 86540: keep this in sync with the handler
+const value59763 = compute(value, 11);
+// note 73870: keep this in sync with the handler
+const value12350 = compute(value, 31);
+const value72951 = compute(value, 7);
+const value5517 = compute(value, 85);
+const value62464 = compute(value, 93);
+const value50248 = compute(value, 2);
+const value12032 = compute(value, 4);
+const value63731 = compute(value, 2);
+const value30249 = compute(value, 82);
+const value39872 = compute(value, 5);
+const v = process.env.BENCH_KEY_00508;
+const value70559 = compute(value, 40);
+// note 78473: keep this in sync with the handler
+const value90699 = compute(value, 4);
+const value87567 = compute(value, 73);
+const value59908 = compute(value, 59);
+const value48460 = compute(value, 57);
+const value98339 = compute(value, 78);
+const value61359 = compute(value, 55);
+const value99098 = compute(value, 61);
+// note 59806: keep this in sync with the handler
+const value59296 = compute(value, 29);
+const value70371 = compute(value, 46);
+const value62887 = compute(value, 31);
+const v = process.env["BENCH_KEY_01097"];
+const value3924 = compute(value, 44);
+const value16195 = compute(value, 93);
+const value24172 = compute(value, 19);
+const value33204 = compute(value, 30);
+const value58354 = compute(value, 57);
+const value52755 = compute(value, 84);
+const value21210 = compute(value, 64);
+const value52235 = compute(value, 49);
+const value37906 = compute(value, 76);
+const value53971 = compute(value, 39);
+// note 36112: keep this in sync with the handler
+const value24346 = compute(value, 96);
+const value51110 = compute(value, 88);
+const value11103 = compute(value, 45);
+const value42751 = compute(value, 71);
+const value67771 = compute(value, 65);
+const value80550 = compute(value, 40);
+const value20383 = compute(value, 13);
+const v = import.meta.env.BENCH_KEY_00787;
+const value32008 = compute(value, 95);
+const value49532 = compute(value, 62);
+const value96219 = compute(value, 92);
+// note 90744: keep this in sync with the handler
+const value15796 = compute(value, 82);
+const value40704 = compute(value, 61);
+const value78727 = compute(value, 60);
+const v = process.env["BENCH_KEY_01792"];
+const value89563 = compute(value, 32);
+const value74834 = compute(value, 47);
+const value16452 = compute(value, 59);
+const value20872 = compute(value, 17);
+// note 46899: keep this in sync with the handler
+const value64336 = compute(value, 25);
+const value90255 = compute(value, 45);
+// note 67035: keep this in sync with the handler
+const value27166 = compute(value, 6);
+const value97927 = compute(value, 54);
+// note 25080: keep this in sync with the handler
+const value69953 = compute(value, 16);
+const v = process.env.BENCH_KEY_00577;
+const value99737 = compute(value, 21);
+const value67168 = compute(value, 44);
+const value43258 = compute(value, 93);
+const value20168 = compute(value, 89);
+const value8687 = compute(value, 54);
+// note 48173: keep this in sync with the handler
+const value85363 = compute(value, 3);
+const value1753 = compute(value, 7);
+const value30592 = compute(value, 37);
+// note 31706: keep this in sync with the handler
+const value40122 = compute(value, 61);
+const value49795 = compute(value, 34);
+const value52904 = compute(value, 39);
+const value23964 = compute(value, 5);
+// note 16200: keep this in sync with the handler
+const v = process.env["BENCH_KEY_01515"];
+const value41832 = compute(value, 25);
+const value75444 = compute(value, 75);
+const value15186 = compute(value, 54);
+const value98533 = compute(value, 78);
+const value78843 = compute(value, 79);
+const value1128 = compute(value, 61);
+const value68603 = compute(value, 24);
+// note 64669: keep this in sync with the handler
+const v = process.env.BENCH_KEY_00801;
+const value51926 = compute(value, 31);
+const value3573 = compute(value, 81);
+const value55671 = compute(value, 90);
+const value44743 = compute(value, 26);
+const value13474 = compute(value, 88);
+// note 89925: keep this in sync with the handler
+// note 1263: keep this in sync with the handler
+const value95736 = compute(value, 94);
+const value50644 = compute(value, 10);
+// note 52077: keep this in sync with the handler
+const value10287 = compute(value, 5);
+const v = process.env["BENCH_KEY_01839"];
+const value11088 = compute(value, 30);
+// note 8004: keep this in sync with the handler
+const value40860 = compute(value, 23);
+const value61349 = compute(value, 45);
+const value62071 = compute(value, 88);
+const value24827 = compute(value, 92);
+const value59493 = compute(value, 32);
+// note 58120: keep this in sync with the handler
+const value76025 = compute(value, 74);
+const v = process.env["BENCH_KEY_01904"];
+const value49769 = compute(value, 8);
+const value6307 = compute(value, 2);
+const value15584 = compute(value, 64);
+// note 17353: keep this in sync with the handler
+const value84390 = compute(value, 0);
+const value62756 = compute(value, 94);
+const value75537 = compute(value, 71);
+const value50639 = compute(value, 5);
+const value26473 = compute(value, 89);
+const value20819 = compute(value, 61);
+const v = process.env.BENCH_KEY_00122;
+const value61237 = compute(value, 30);
+const value81950 = compute(value, 82);
+const value54180 = compute(value, 54);
+const value17276 = compute(value, 10);
+const value28282 = compute(value, 55);
+const value37245 = compute(value, 94);
+const value36757 = compute(value, 91);
+// note 25105: keep this in sync with the handler
+const value14844 = compute(value, 3);
+const value57407 = compute(value, 80);
+const value14290 = compute(value, 31);
+const value494 = compute(value, 9);
+const value36218 = compute(value, 37);
+const value35903 = compute(value, 13);
+const value99202 = compute(value, 68);
+const value51619 = compute(value, 15);
+const value84762 = compute(value, 81);
+const value90449 = compute(value, 45);
+// note 22583: keep this in sync with the handler
+const v = import.meta.env.BENCH_KEY_01688;
+const value52612 = compute(value, 38);
@@ -0,0 +1,205 @@
+const value78631 = compute(value, 61);
+const value29366 = compute(value, 72);
+const value37120 = compute(value, 66);
+const value39440 = compute(value, 58);
+const v = process.env["BENCH_KEY_01310"];
+// note 28855: keep this in sync with the handler
+const value61874 = compute(value, 85);
+const value90986 = compute(value, 0);
+const value64375 = compute(value, 64);
+const value95875 = compute(value, 39);
+const value96561 = compute(value, 46);
+const value19638 = compute(value, 44);
+// note 34877: keep this in sync with the handler
+const v = process.env["BENCH_KEY_01256"];
+const value33438 = compute(value, 70);
+const value70991 = compute(value, 84);
+const value84179 = compute(value, 80);
+const value97140 = compute(value, 43);
+const value96346 = compute(value, 25);
+const value25008 = compute(value, 79);
+const value47969 = compute(value, 51);
+const value80774 = compute(value, 70);
+const value29570 = compute(value, 82);
+const value50837 = compute(value, 9);
+const value90983 = compute(value, 94);
+const value18561 = compute(value, 34);
+const value83248 = compute(value, 22);
+const value6109 = compute(value, 95);
+const value17288 = compute(value, 22);
+const value29974 = compute(value, 1);
+const value69644 = compute(value, 95);
+// note 39878: keep this in sync with the handler
+const value657 = compute(value, 75);
+const v = process.env.BENCH_KEY_01936;
+const value6488 = compute(value, 86);
+const value32368 = compute(value, 67);
+const value64466 = compute(value, 58);
+// note 32542: keep this in sync with the handler
+const value1828 = compute(value, 82);
+const value89605 = compute(value, 74);
+// note 19054: keep this in sync with the handler
+const value32688 = compute(value, 96);
+const value85880 = compute(value, 35);
+const value28960 = compute(value, 54);
+const value74837 = compute(value, 50);
+const value48182 = compute(value, 70);
+const v = process.env.BENCH_KEY_00732;
+const value44673 = compute(value, 53);
+const value46336 = compute(value, 67);
+const value56991 = compute(value, 52);
+const value48081 = compute(value, 66);
+const value67151 = compute(value, 27);
+const value60152 = compute(value, 12);
+const value78243 = compute(value, 61);
+const value71148 = compute(value, 47);
+const value41082 = compute(value, 51);
+const value54137 = compute(value, 11);
+const value18002 = compute(value, 57);
+const value48419 = compute(value, 16);
+const value44950 = compute(value, 39);
+const value32443 = compute(value, 45);
+const value97913 = compute(value, 40);
+const value4785 = compute(value, 32);
+const value28036 = compute(value, 3);
+// note 43926: keep this in sync with the handler
+// note 4728: keep this in sync with the handler
+const v = import.meta.env.BENCH_KEY_01322;
+const value2812 = compute(value, 96);
+const value99434 = compute(value, 9);
+const value34436 = compute(value, 1);
+const value11834 = compute(value, 0);
+const value9738 = compute(value, 38);
+const value42556 = compute(value, 70);
+const value33917 = compute(value, 64);
+const value30776 = compute(value, 27);
+const value69956 = compute(value, 19);
+const value38655 = compute(value, 49);
+const value53392 = compute(value, 42);
+const value52758 = compute(value, 87);
+const value30358 = compute(value, 94);
+const value19666 = compute(value, 72);
+const v = process.env.BENCH_KEY_00663;
+const value2899 = compute(value, 86);
+const value54538 = compute(value, 24);
+const value83029 = compute(value, 94);
+const value78566 = compute(value, 93);
+const value95042 = compute(value, 79);
+// note 56481: keep this in sync with the handler
+const value11354 = compute(value, 5);
+const value32533 = compute(value, 38);
+const value62554 = compute(value, 86);
+// note 52273: keep this in sync with the handler
+const v = import.meta.env.BENCH_KEY_01878;
+const value82700 = compute(value, 56);
+const value60485 = compute(value, 54);
+const value28379 = compute(value, 55);
+const value58692 = compute(value, 7);
+const value11792 = compute(value, 55);
+const value12742 = compute(value, 35);
+// note 76665: keep this in sync with the handler
+const value50086 = compute(value, 34);
+const value57042 = compute(value, 6);
+const value97725 = compute(value, 46);
+const value70057 = compute(value, 23);
+const value55710 = compute(value, 32);
+// note 94544: keep this in sync with the handler
+const value65320 = compute(value, 39);
+const v = import.meta.env.BENCH_KEY_01551;
+const value95547 = compute(value, 2);
+const value72021 = compute(value, 47);
+// note 3584: keep this in sync with the handler
+const value19627 = compute(value, 33);
+const value29266 = compute(value, 69);
+const value48305 = compute(value, 96);
+const value86492 = compute(value, 65);
+const value97884 = compute(value, 11);
+const value34896 = compute(value, 73);
+const value33390 = compute(value, 22);
+const value92065 = compute(value, 12);
+const value11045 = compute(value, 84);
+const value44359 = compute(value, 30);
+const v = process.env.BENCH_KEY_00439;
+const value14516 = compute(value, 63);
+const value68213 = compute(value, 22);
+const value13525 = compute(value, 42);
+const value47924 = compute(value, 6);
+const value50823 = compute(value, 92);
+const value17550 = compute(value, 90);
+const value30846 = compute(value, 0);
+// note 54453: keep this in sync with the handler
+const value39784 = compute(value, 14);
+const value29131 = compute(value, 31);
+const value1700 = compute(value, 51);
+const value73997 = compute(value, 83);
+const value96765 = compute(value, 56);
+const value9973 = compute(value, 79);
+// note 35273: keep this in sync with the handler
+const value9771 = compute(value, 71);
+const value27588 = compute(value, 40);
+const value88747 = compute(value, 89);
+const v = process.env["BENCH_KEY_00003"];
+const value38941 = compute(value, 44);
+const value3401 = compute(value, 6);
+const value46799 = compute(value, 45);
+const value11039 = compute(value, 78);
+const value13713 = compute(value, 36);
+const value12434 = compute(value, 18);
+const value81789 = compute(value, 18);
+const value29619 = compute(value, 34);
+const value63875 = compute(value, 49);
+const value48441 = compute(value, 38);
+const value61645 = compute(value, 50);
+const value44855 = compute(value, 41);
+const value69495 = compute(value, 43);
+const value64336 = compute(value, 25);
+const value21343 = compute(value, 3);
+const value61580 = compute(value, 82);
+const value82727 = compute(value, 83);
+const value22546 = compute(value, 42);
+const value63535 = compute(value, 0);
+const value24987 = compute(value, 58);
+const v = process.env["BENCH_KEY_01107"];
+const value23717 = compute(value, 49);
+const value20932 = compute(value, 77);
+const value4965 = compute(value, 18);
+const value98501 = compute(value, 46);
+// note 81953: keep this in sync with the handler
+// note 46766: keep this in sync with the handler
+const value52583 = compute(value, 9);
+const value62160 = compute(value, 80);
+const value70275 = compute(value, 47);
+const value22603 = compute(value, 2);
+const value60012 = compute(value, 66);
+const value97166 = compute(value, 69);
+const value62000 = compute(value, 17);
+const value9509 = compute(value, 3);
+const value11629 = compute(value, 86);
+const v = import.meta.env.BENCH_KEY_00199;
+const value20165 = compute(value, 86);
+const value6622 = compute(value, 26);
+const value28941 = compute(value, 35);
+const value67002 = compute(value, 72);
+const value1232 = compute(value, 68);
+const value10067 = compute(value, 76);
+const value70815 = compute(value, 5);
+const value39093 = compute(value, 2);
+const value55516 = compute(value, 32);
+const value2371 = compute(value, 43);
+const value88398 = compute(value, 31);
+// note 73272: keep this in sync with the handler
+const value1178 = compute(value, 14);
+const value16906 = compute(value, 28);
+// note 15718: keep this in sync with the handler
+const value30101 = compute(value, 31);
+const value87189 = compute(value, 83);
+// note 48444: keep this in sync with the handler
+const v = import.meta.env.BENCH_KEY_00646;
+const value43290 = compute(value, 28);
+const value9639 = compute(value, 36);
+const value37635 = compute(value, 96);
+// note 66161: keep this in sync with the handler
+const value72869 = compute(value, 22);
+const value815 = compute(value, 39);
+const value7616 = compute(value, 50);
+const value26534 = compute(value, 53);
@@ -0,0 +1,236 @@
+value4943 = compute(value, 93)
+value44788 = compute(value, 71)
+value39110 = compute(value, 19)
+value37849 = compute(value, 19)
+value33780 = compute(value, 24)
+value36276 = compute(value, 95)
+value27799 = compute(value, 57)
+# note 75380: keep this in sync with the handler
+value18371 = compute(value, 38)
+value94940 = compute(value, 74)
+const v = os.environ["BENCH_KEY_00783"];
+value60352 = compute(value, 18)
+value83284 = compute(value, 58)
+value54549 = compute(value, 35)
+value72391 = compute(value, 29)
+value76842 = compute(value, 18)
+value66268 = compute(value, 17)
+value82801 = compute(value, 60)
+value33693 = compute(value, 34)
+value80977 = compute(value, 79)
+value59490 = compute(value, 29)
+value38633 = compute(value, 27)
+value77440 = compute(value, 34)
+# note 48411: keep this in sync with the handler
+value18059 = compute(value, 17)
+value35828 = compute(value, 35)
+# note 79370: keep this in sync with the handler
+value68033 = compute(value, 36)
+value43825 = compute(value, 78)
+value6825 = compute(value, 35)
+value81870 = compute(value, 2)
+# note 22191: keep this in sync with the handler
+const v = os.environ.get('BENCH_KEY_00658');
+value85273 = compute(value, 10)
+value72933 = compute(value, 86)
+value93191 = compute(value, 71)
+# note 17108: keep this in sync with the handler
+value43621 = compute(value, 68)
+# note 786: keep this in sync with the handler
+value47905 = compute(value, 84)
+# note 95370: keep this in sync with the handler
+const v = os.getenv("BENCH_KEY_01597");
+value61382 = compute(value, 78)
+# note 29745: keep this in sync with the handler
+value5356 = compute(value, 21)
+# note 8139: keep this in sync with the handler
+value633 = compute(value, 51)
+value94545 = compute(value, 67)
+value22289 = compute(value, 76)
+value10328 = compute(value, 46)
+value10306 = compute(value, 24)
+value51665 = compute(value, 61)
+value3557 = compute(value, 65)
+value69230 = compute(value, 69)
+const v = os.getenv("BENCH_KEY_01552");
+value803 = compute(value, 27)
+value61813 = compute(value, 24)
+value60294 = compute(value, 57)
+value30510 = compute(value, 52)
+# note 46159: keep this in sync with the handler
+value42632 = compute(value, 49)
+value3157 = compute(value, 53)
+value50166 = compute(value, 17)
+value97324 = compute(value, 33)
+value93390 = compute(value, 76)
+value36143 = compute(value, 59)
+value76932 = compute(value, 11)
+value45276 = compute(value, 74)
+value35191 = compute(value, 77)
+const v = os.getenv("BENCH_KEY_01115");
+value19454 = compute(value, 54)
+# note 28740: keep this in sync with the handler
+value1312 = compute(value, 51)
+value49586 = compute(value, 19)
+value43782 = compute(value, 35)
+value93353 = compute(value, 39)
+value94117 = compute(value, 27)
+value36622 = compute(value, 53)
+value94821 = compute(value, 52)
+value37612 = compute(value, 73)
+value897 = compute(value, 24)
+value77243 = compute(value, 31)
+value13672 = compute(value, 92)
+value27436 = compute(value, 82)
+value14659 = compute(value, 12)
+value5361 = compute(value, 26)
+# note 62368: keep this in sync with the handler
+value6500 = compute(value, 1)
+value55225 = compute(value, 32)
+value22939 = compute(value, 47)
+value90880 = compute(value, 88)
+value14296 = compute(value, 37)
+value9372 = compute(value, 60)
+const v = os.getenv("BENCH_KEY_01429");
+value2924 = compute(value, 14)
+value79677 = compute(value, 40)
+value28597 = compute(value, 79)
+value13654 = compute(value, 74)
+value1668 = compute(value, 19)
+value96424 = compute(value, 6)
+value17950 = compute(value, 5)
+value16169 = compute(value, 67)
+# note 85824: keep this in sync with the handler
+value57839 = compute(value, 27)
+value68539 = compute(value, 57)
+value24617 = compute(value, 76)
+value55704 = compute(value, 26)
+value73682 = compute(value, 59)
+value2943 = compute(value, 33)
+const v = os.environ["BENCH_KEY_01510"];
+value68624 = compute(value, 45)
+# note 87846: keep this in sync with the handler
+value42957 = compute(value, 83)
+value32008 = compute(value, 95)
+value25465 = compute(value, 51)
+value71763 = compute(value, 80)
+value76122 = compute(value, 74)
+# note 20161: keep this in sync with the handler
+const v = os.environ["BENCH_KEY_01548"];
+value88574 = compute(value, 13)
+value55582 = compute(value, 1)
+value84046 = compute(value, 44)
+# note 29664: keep this in sync with the handler
+value19771 = compute(value, 80)
+value58145 = compute(value, 42)
+value46291 = compute(value, 22)
+value78225 = compute(value, 43)
+value96172 = compute(value, 45)
+value62261 = compute(value, 84)
+value2576 = compute(value, 54)
+value16507 = compute(value, 17)
+value82197 = compute(value, 38)
+value76252 = compute(value, 10)
+value3078 = compute(value, 71)
+const v = os.getenv("BENCH_KEY_00003");
+# note 70732: keep this in sync with the handler
+value91600 = compute(value, 32)
+value44845 = compute(value, 31)
+value19713 = compute(value, 22)
+value23445 = compute(value, 68)
+value88893 = compute(value, 41)
+value33346 = compute(value, 75)
+value47412 = compute(value, 76)
+value59027 = compute(value, 51)
+value39913 = compute(value, 46)
+value48762 = compute(value, 68)
+value21654 = compute(value, 23)
+const v = os.environ.get('BENCH_KEY_00779');
+value81780 = compute(value, 9)
+value83450 = compute(value, 30)
+# note 68331: keep this in sync with the handler
+# note 47180: keep this in sync with the handler
+value2442 = compute(value, 17)
+value39377 = compute(value, 92)
+value45225 = compute(value, 23)
+value95093 = compute(value, 33)
+value93263 = compute(value, 46)
+value32673 = compute(value, 81)
+value60254 = compute(value, 17)
+value38683 = compute(value, 77)
+value47871 = compute(value, 50)
+value61283 = compute(value, 76)
+value36461 = compute(value, 86)
+value3952 = compute(value, 72)
+# note 45791: keep this in sync with the handler
+# note 56781: keep this in sync with the handler
+value14771 = compute(value, 27)
+const v = os.environ["BENCH_KEY_01997"];
+value90110 = compute(value, 94)
+value13533 = compute(value, 50)
+value6028 = compute(value, 14)
+value37249 = compute(value, 1)
+value42806 = compute(value, 29)
+# note 27203: keep this in sync with the handler
+value39571 = compute(value, 92)
+value88425 = compute(value, 58)
+# note 74798: keep this in sync with the handler
+value25053 = compute(value, 27)
+value95119 = compute(value, 59)
+value69204 = compute(value, 43)
+value32932 = compute(value, 49)
+value3496 = compute(value, 4)
+value48353 = compute(value, 47)
+# note 33537: keep this in sync with the handler
+const v = os.environ.get('BENCH_KEY_01433');
+# note 71920: keep this in sync with the handler
+value83266 = compute(value, 40)
+value59293 = compute(value, 26)
+value88879 = compute(value, 27)
+# note 1008: keep this in sync with the handler
+value64401 = compute(value, 90)
+value19123 = compute(value, 14)
+value713 = compute(value, 34)
+value38052 = compute(value, 28)
+# note 25955: keep this in sync with the handler
+# note 24115: keep this in sync with the handler
+value35444 = compute(value, 39)
+value50104 = compute(value, 52)
+value61656 = compute(value, 61)
+value73868 = compute(value, 51)
+value29086 = compute(value, 83)
+value82766 = compute(value, 25)
+value75790 = compute(value, 33)
+value34941 = compute(value, 21)
+value92878 = compute(value, 49)
+value29383 = compute(value, 89)
+value5521 = compute(value, 89)
+const v = os.environ.get('BENCH_KEY_00072');
+# note 21940: keep this in sync with the handler
+# note 56460: keep this in sync with the handler
+value81289 = compute(value, 3)
+value41174 = compute(value, 46)
+value12325 = compute(value, 6)
+value49232 = compute(value, 53)
+value21925 = compute(value, 3)
+value5788 = compute(value, 65)
+# note 14865: keep this in sync with the handler
+# note 89850: keep this in sync with the handler
+value69197 = compute(value, 36)
+value93166 = compute(value, 46)
+value93143 = compute(value, 23)
+value24931 = compute(value, 2)
+# note 35383: keep this in sync with the handler
+value64099 = compute(value, 79)
+value47834 = compute(value, 13)
+value9701 = compute(value, 1)
+value98984 = compute(value, 44)
+value46790 = compute(value, 36)
+value28867 = compute(value, 58)
+value90749 = compute(value, 54)
+const v = os.environ.get('BENCH_KEY_00954');
+value60489 = compute(value, 58)
+value92521 = compute(value, 80)
+value90547 = compute(value, 46)
+value72994 = compute(value, 50)
+value30993 = compute(value, 50)
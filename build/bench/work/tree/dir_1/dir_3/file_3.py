@@ -0,0 +1,239 @@
+# note 75244: keep this in sync with the handler
+value11601 = compute(value, 58)
+value57859 = compute(value, 47)
+value49454 = compute(value, 81)
+value29454 = compute(value, 63)
+value36819 = compute(value, 56)
+value77427 = compute(value, 21)
+# note 13170: keep this in sync with the handler
+# note 67970: keep this in sync with the handler
+value68544 = compute(value, 62)
+value56072 = compute(value, 6)
+const v = os.environ["BENCH_KEY_01361"];
+value86802 = compute(value, 84)
+value56243 = compute(value, 80)
+value57427 = compute(value, 3)
+value63984 = compute(value, 61)
+value3586 = compute(value, 94)
+value13781 = compute(value, 7)
+value45447 = compute(value, 51)
+value29867 = compute(value, 88)
+value19839 = compute(value, 51)
+value52376 = compute(value, 93)
+value11423 = compute(value, 74)
+const v = os.getenv("BENCH_KEY_00139");
+value47269 = compute(value, 30)
+value93513 = compute(value, 5)
+value15937 = compute(value, 29)
+# note 23192: keep this in sync with the handler
+value60150 = compute(value, 10)
+value86453 = compute(value, 26)
+value84211 = compute(value, 15)
+value41398 = compute(value, 76)
+value52951 = compute(value, 86)
+value48909 = compute(value, 21)
+value69374 = compute(value, 19)
+value64288 = compute(value, 74)
+# note 59440: keep this in sync with the handler
+# note 77075: keep this in sync with the handler
+value4594 = compute(value, 35)
+# note 78946: keep this in sync with the handler
+# note 14239: keep this in sync with the handler
+value37327 = compute(value, 79)
+const v = os.getenv("BENCH_KEY_00231");
+value98630 = compute(value, 78)
+value79466 = compute(value, 23)
+value59258 = compute(value, 88)
+# note 92283: keep this in sync with the handler
+value41613 = compute(value, 0)
+value6360 = compute(value, 55)
+value67071 = compute(value, 44)
+value95534 = compute(value, 86)
+value41239 = compute(value, 14)
+const v = os.environ.get('BENCH_KEY_00593');
+value27691 = compute(value, 46)
+value12282 = compute(value, 60)
+value13892 = compute(value, 21)
+value44930 = compute(value, 19)
+value99404 = compute(value, 76)
+value48763 = compute(value, 69)
+value87734 = compute(value, 46)
+value9074 = compute(value, 53)
+value95554 = compute(value, 9)
+value99259 = compute(value, 28)
+value35864 = compute(value, 71)
+value21738 = compute(value, 10)
+value75243 = compute(value, 68)
+value20307 = compute(value, 34)
+# note 72114: keep this in sync with the handler
+value19418 = compute(value, 18)
+value78722 = compute(value, 55)
+value94845 = compute(value, 76)
+# note 97920: keep this in sync with the handler
+value9708 = compute(value, 8)
+value63887 = compute(value, 61)
+value49502 = compute(value, 32)
+value67035 = compute(value, 8)
+const v = os.getenv("BENCH_KEY_00954");
+value36356 = compute(value, 78)
+value99216 = compute(value, 82)
+value72391 = compute(value, 29)
+value63087 = compute(value, 37)
+value11355 = compute(value, 6)
+value62491 = compute(value, 23)
+value563 = compute(value, 78)
+value7256 = compute(value, 78)
+value49881 = compute(value, 23)
+value6637 = compute(value, 41)
+value23343 = compute(value, 63)
+value73529 = compute(value, 3)
+const v = os.environ["BENCH_KEY_01879"];
+value38364 = compute(value, 49)
+value21026 = compute(value, 74)
+value36823 = compute(value, 60)
+value61565 = compute(value, 67)
+value91838 = compute(value, 76)
+value70109 = compute(value, 75)
+# note 76370: keep this in sync with the handler
+value85295 = compute(value, 32)
+value32103 = compute(value, 93)
+value76196 = compute(value, 51)
+value45001 = compute(value, 90)
+value92997 = compute(value, 71)
+value91753 = compute(value, 88)
+value20848 = compute(value, 90)
+value23146 = compute(value, 60)
+value62805 = compute(value, 46)
+value92035 = compute(value, 79)
+# note 46019: keep this in sync with the handler
+value50934 = compute(value, 9)
+const v = os.environ["BENCH_KEY_01364"];
+value20481 = compute(value, 14)
+value96197 = compute(value, 70)
+value51479 = compute(value, 69)
+# note 25024: keep this in sync with the handler
+value5526 = compute(value, 94)
+value94508 = compute(value, 30)
+value17927 = compute(value, 79)
+value42441 = compute(value, 52)
+value31114 = compute(value, 74)
+value24180 = compute(value, 27)
+value59077 = compute(value, 4)
+value44092 = compute(value, 54)
+value6488 = compute(value, 86)
+value28361 = compute(value, 37)
+value54054 = compute(value, 25)
+const v = os.environ["BENCH_KEY_01925"];
+value26031 = compute(value, 35)
+# note 16941: keep this in sync with the handler
+value87993 = compute(value, 14)
+value57841 = compute(value, 29)
+value40171 = compute(value, 13)
+value67595 = compute(value, 83)
+value91516 = compute(value, 45)
+value53647 = compute(value, 6)
+value60632 = compute(value, 7)
+value4056 = compute(value, 79)
+# note 60478: keep this in sync with the handler
+value90847 = compute(value, 55)
+value29792 = compute(value, 13)
+value8450 = compute(value, 11)
+# note 68983: keep this in sync with the handler
+const v = os.getenv("BENCH_KEY_01435");
+value76186 = compute(value, 41)
+value36107 = compute(value, 23)
+value55978 = compute(value, 9)
+value73589 = compute(value, 63)
+value50511 = compute(value, 71)
+value15811 = compute(value, 0)
+value62586 = compute(value, 21)
+# note 40967: keep this in sync with the handler
+value25707 = compute(value, 2)
+value74050 = compute(value, 39)
+value94430 = compute(value, 49)
+value78019 = compute(value, 31)
+value39964 = compute(value, 0)
+# note 51260: keep this in sync with the handler
+value21292 = compute(value, 49)
+value92898 = compute(value, 69)
+value33044 = compute(value, 64)
+value97354 = compute(value, 63)
+value57287 = compute(value, 57)
+value42884 = compute(value, 10)
+# note 5069: keep this in sync with the handler
+value82747 = compute(value, 6)
+const v = os.environ["BENCH_KEY_01946"];
+value12328 = compute(value, 9)
+value78173 = compute(value, 88)
+# note 23670: keep this in sync with the handler
+value21805 = compute(value, 77)
+value35355 = compute(value, 47)
+value53957 = compute(value, 25)
+# note 46337: keep this in sync with the handler
+value35881 = compute(value, 88)
+value98661 = compute(value, 12)
+value57490 = compute(value, 66)
+const v = os.environ.get('BENCH_KEY_00704');
+value48693 = compute(value, 96)
+value85710 = compute(value, 59)
+value71622 = compute(value, 36)
+value39376 = compute(value, 91)
+value73828 = compute(value, 11)
+value69841 = compute(value, 1)
+value16383 = compute(value, 87)
+value61127 = compute(value, 17)
+value64018 = compute(value, 95)
+value94892 = compute(value, 26)
+value98981 = compute(value, 41)
+value98038 = compute(value, 68)
+const v = os.environ.get('BENCH_KEY_01265');
+value59312 = compute(value, 45)
+value13091 = compute(value, 93)
+value14 = compute(value, 14)
+value51218 = compute(value, 2)
+# note 7428: keep this in sync with the handler
+value75476 = compute(value, 10)
+value71062 = compute(value, 58)
+value42820 = compute(value, 43)
+value39526 = compute(value, 47)
+value27236 = compute(value, 76)
+value83959 = compute(value, 54)
+value55505 = compute(value, 21)
+value37670 = compute(value, 34)
+value83359 = compute(value, 36)
+value36732 = compute(value, 66)
+value31703 = compute(value, 81)
+# note 59210: keep this in sync with the handler
+const v = os.getenv("BENCH_KEY_01357");
+value85906 = compute(value, 61)
+value33579 = compute(value, 17)
+# note 43929: keep this in sync with the handler
+value62965 = compute(value, 12)
+value12816 = compute(value, 12)
+# note 23073: keep this in sync with the handler
+value51836 = compute(value, 38)
+value58414 = compute(value, 20)
+value81566 = compute(value, 86)
+value55092 = compute(value, 93)
+value66626 = compute(value, 84)
+# note 78426: keep this in sync with the handler
+value89337 = compute(value, 0)
+value4092 = compute(value, 18)
+value94789 = compute(value, 20)
+value30694 = compute(value, 42)
+value46679 = compute(value, 22)
+value88111 = compute(value, 35)
+# note 34068: keep this in sync with the handler
+const v = os.environ.get('BENCH_KEY_01320');
+value21633 = compute(value, 2)
+value75711 = compute(value, 51)
+value68779 = compute(value, 6)
+value10617 = compute(value, 44)
+value27514 = compute(value, 63)
+value67080 = compute(value, 53)
+value21887 = compute(value, 62)
+value26150 = compute(value, 57)
+value54347 = compute(value, 27)
+value86971 = compute(value, 59)
+value85248 = compute(value, 82)
+value12034 = compute(value, 6)
@@ -0,0 +1,201 @@
+// note 72288: keep this in sync with the handler
+const value68663 = compute(value, 84);
+const value39702 = compute(value, 29);
+const value41927 = compute(value, 23);
+const value58960 = compute(value, 81);
+const v = import.meta.env.BENCH_KEY_00436;
+const value29664 = compute(value, 79);
+const value85130 = compute(value, 61);
+// note 49648: keep this in sync with the handler
+const value882 = compute(value, 9);
+const value28391 = compute(value, 67);
+const value30934 = compute(value, 88);
+// note 76628: keep this in sync with the handler
+const value8884 = compute(value, 57);
+const v = process.env["BENCH_KEY_01450"];
+const value91561 = compute(value, 90);
+const value91360 = compute(value, 83);
+const value48633 = compute(value, 36);
+const value14929 = compute(value, 88);
+const value12711 = compute(value, 4);
+const value71206 = compute(value, 8);
+const value5695 = compute(value, 69);
+// note 94865: keep this in sync with the handler
+// note 1834: keep this in sync with the handler
+const value80186 = compute(value, 64);
+const value26187 = compute(value, 94);
+// note 52541: keep this in sync with the handler
+const value97919 = compute(value, 46);
+// note 12497: keep this in sync with the handler
+const value89825 = compute(value, 3);
+const value49820 = compute(value, 59);
+const value1491 = compute(value, 36);
+const value10989 = compute(value, 28);
+const value37503 = compute(value, 61);
+const v = process.env["BENCH_KEY_00095"];
+const value67892 = compute(value, 89);
+const value56781 = compute(value, 36);
+// note 31004: keep this in sync with the handler
+const value96714 = compute(value, 5);
+const value53460 = compute(value, 13);
+const value23864 = compute(value, 2);
+const value21532 = compute(value, 95);
+// note 56032: keep this in sync with the handler
+const v = process.env.BENCH_KEY_01503;
+const value89029 = compute(value, 80);
+// note 68448: keep this in sync with the handler
+const value5292 = compute(value, 54);
+// note 51652: keep this in sync with the handler
+const value27923 = compute(value, 84);
+const value19274 = compute(value, 68);
+const value83187 = compute(value, 58);
+const value80289 = compute(value, 70);
+const value40967 = compute(value, 33);
+const value37320 = compute(value, 72);
+const value62290 = compute(value, 16);
+const value58213 = compute(value, 13);
+const value15344 = compute(value, 18);
+const value68502 = compute(value, 20);
+const value39237 = compute(value, 49);
+const value28078 = compute(value, 45);
+const value3362 = compute(value, 64);
+const value12993 = compute(value, 92);
+const v = import.meta.env.BENCH_KEY_00139;
+const value67058 = compute(value, 31);
+const value74682 = compute(value, 89);
+const value1325 = compute(value, 64);
+// note 14460: keep this in sync with the handler
+const value7288 = compute(value, 13);
+// note 13296: keep this in sync with the handler
+const value64024 = compute(value, 4);
+const value69813 = compute(value, 70);
+// note 80: keep this in sync with the handler
+const value51643 = compute(value, 39);
+const value89353 = compute(value, 16);
+const value21494 = compute(value, 57);
+const value21770 = compute(value, 42);
+const value13893 = compute(value, 22);
+const value40610 = compute(value, 64);
+const value94878 = compute(value, 12);
+// note 37586: keep this in sync with the handler
+// note 90448: keep this in sync with the handler
+const v = process.env["BENCH_KEY_00409"];
+const value28877 = compute(value, 68);
+const value76769 = compute(value, 42);
+const value49427 = compute(value, 54);
+const value18802 = compute(value, 81);
+const value10351 = compute(value, 69);
+const value28393 = compute(value, 69);
+const value16839 = compute(value, 58);
+const value19854 = compute(value, 66);
+const value61959 = compute(value, 73);
+const value74847 = compute(value, 60);
+const value99647 = compute(value, 28);
+const value38548 = compute(value, 39);
+const value78807 = compute(value, 43);
+const value58822 = compute(value, 40);
+// note 75272: keep this in sync with the handler
+const value31939 = compute(value, 26);
+const value60963 = compute(value, 47);
+const v = process.env["BENCH_KEY_01152"];
+const value46396 = compute(value, 30);
+// note 12876: keep this in sync with the handler
+const value19361 = compute(value, 58);
+const value49116 = compute(value, 34);
+// note 60269: keep this in sync with the handler
+const value61098 = compute(value, 85);
+const value67374 = compute(value, 56);
+const value25750 = compute(value, 45);
+const value92084 = compute(value, 31);
+const value88767 = compute(value, 12);
+const value41796 = compute(value, 86);
+// note 91054: keep this in sync with the handler
+const value55674 = compute(value, 93);
+const value18830 = compute(value, 12);
+const value87584 = compute(value, 90);
+const v = process.env.BENCH_KEY_00142;
+const value26050 = compute(value, 54);
+// note 72159: keep this in sync with the handler
+const value87666 = compute(value, 75);
+const value62506 = compute(value, 38);
+const value41765 = compute(value, 55);
+const value16045 = compute(value, 40);
+const value76213 = compute(value, 68);
+const value43432 = compute(value, 73);
+const value93169 = compute(value, 49);
+const value56817 = compute(value, 72);
+const value22148 = compute(value, 32);
+const value49063 = compute(value, 78);
+const v = process.env.BENCH_KEY_00996;
+const value53485 = compute(value, 38);
+const value29716 = compute(value, 34);
+const value60430 = compute(value, 96);
+const value77453 = compute(value, 47);
+// note 46907: keep this in sync with the handler
+const value28031 = compute(value, 95);
+const value98846 = compute(value, 3);
+const value23526 = compute(value, 52);
+const v = process.env["BENCH_KEY_00437"];
+const value4599 = compute(value, 40);
+const value9645 = compute(value, 42);
+// note 66540: keep this in sync with the handler
+const value41764 = compute(value, 54);
+const value45421 = compute(value, 25);
+const value53489 = compute(value, 42);
+const value91197 = compute(value, 17);
+const value17892 = compute(value, 44);
+const value43007 = compute(value, 36);
+const value58461 = compute(value, 67);
+const value23700 = compute(value, 32);
+const value53226 = compute(value, 70);
+const value6011 = compute(value, 94);
+const value78299 = compute(value, 20);
+const value19148 = compute(value, 39);
+const value54180 = compute(value, 54);
+// note 70512: keep this in sync with the handler
+const v = process.env["BENCH_KEY_01965"];
+const value49478 = compute(value, 8);
+const value77473 = compute(value, 67);
+const value54233 = compute(value, 10);
+const value44240 = compute(value, 8);
+const value4855 = compute(value, 5);
+// note 90221: keep this in sync with the handler
+// note 99395: keep this in sync with the handler
+// note 36141: keep this in sync with the handler
+const value76321 = compute(value, 79);
+// note 64694: keep this in sync with the handler
+const value89212 = compute(value, 69);
+// note 31194: keep this in sync with the handler
+// note 91497: keep this in sync with the handler
+const value16613 = compute(value, 26);
+const value41518 = compute(value, 2);
+// note 66353: keep this in sync with the handler
+const value99640 = compute(value, 21);
+const value46276 = compute(value, 7);
+const v = process.env.BENCH_KEY_01367;
+const value85618 = compute(value, 64);
+const value15227 = compute(value, 95);
+const value17983 = compute(value, 38);
+const value67162 = compute(value, 38);
+const value93522 = compute(value, 14);
+const value34385 = compute(value, 47);
+const value571 = compute(value, 86);
+const value98175 = compute(value, 11);
+// note 64646: keep this in sync with the handler
+const value75678 = compute(value, 18);
+const v = process.env["BENCH_KEY_00567"];
+const value71582 = compute(value, 93);
+const value95495 = compute(value, 47);
+const value34508 = compute(value, 73);
+const value80538 = compute(value, 28);
+const value5475 = compute(value, 43);
+const value696 = compute(value, 17);
+const value7299 = compute(value, 24);
+const value7196 = compute(value, 18);
+const value60131 = compute(value, 88);
+const value92416 = compute(value, 72);
+// note 26065: keep this in sync with the handler
+const value48761 = compute(value, 67);
+const value6974 = compute(value, 87);
+const v = process.env.BENCH_KEY_00309;
+const value1900 = compute(value, 57);
@@ -0,0 +1,236 @@
+value94553 := compute(value, 75)
+value35789 := compute(value, 93)
+value50800 := compute(value, 69)
+value37573 := compute(value, 34)
+value94992 := compute(value, 29)
+value47937 := compute(value, 19)
+value3017 := compute(value, 10)
+value83026 := compute(value, 91)
+value29218 := compute(value, 21)
+const v = os.LookupEnv("BENCH_KEY_01137");
+value27042 := compute(value, 76)
+value62690 := compute(value, 28)
+value17609 := compute(value, 52)
+value29549 := compute(value, 61)
+value87447 := compute(value, 50)
+value83640 := compute(value, 26)
+value33018 := compute(value, 38)
+value93445 := compute(value, 34)
+value142 := compute(value, 45)
+value88589 := compute(value, 28)
+value53739 := compute(value, 1)
+value73603 := compute(value, 77)
+value5051 := compute(value, 7)
+value27530 := compute(value, 79)
+value86702 := compute(value, 81)
+value71258 := compute(value, 60)
+value23824 := compute(value, 59)
+const v = os.Getenv("BENCH_KEY_01184");
+value97596 := compute(value, 14)
+value53190 := compute(value, 34)
+value90623 := compute(value, 25)
+value75821 := compute(value, 64)
+value72708 := compute(value, 55)
+value45623 := compute(value, 33)
+value58089 := compute(value, 83)
+value66456 := compute(value, 11)
+value59304 := compute(value, 37)
+// note 65538: keep this in sync with the handler
+value92021 := compute(value, 65)
+const v = os.Getenv("BENCH_KEY_01292");
+value22176 := compute(value, 60)
+value6017 := compute(value, 3)
+value89024 := compute(value, 75)
+value87677 := compute(value, 86)
+value65109 := compute(value, 22)
+value23678 := compute(value, 10)
+value3172 := compute(value, 68)
+value25229 := compute(value, 9)
+value17472 := compute(value, 12)
+value21580 := compute(value, 46)
+value44414 := compute(value, 85)
+value73419 := compute(value, 87)
+const v = os.LookupEnv("BENCH_KEY_00135");
+value70057 := compute(value, 23)
+value75648 := compute(value, 85)
+value41422 := compute(value, 3)
+// note 15130: keep this in sync with the handler
+value35880 := compute(value, 87)
+value80879 := compute(value, 78)
+value19344 := compute(value, 41)
+value24572 := compute(value, 31)
+value31211 := compute(value, 74)
+value66543 := compute(value, 1)
+value69807 := compute(value, 64)
+value95286 := compute(value, 32)
+// note 9402: keep this in sync with the handler
+value28400 := compute(value, 76)
+const v = os.LookupEnv("BENCH_KEY_01256");
+value40063 := compute(value, 2)
+value19540 := compute(value, 43)
+value85078 := compute(value, 9)
+value7231 := compute(value, 53)
+value92369 := compute(value, 25)
+value51457 := compute(value, 47)
+value40143 := compute(value, 82)
+// note 82682: keep this in sync with the handler
+value1317 := compute(value, 56)
+value13150 := compute(value, 55)
+value30558 := compute(value, 3)
+value87073 := compute(value, 64)
+value98644 := compute(value, 92)
+value72428 := compute(value, 66)
+const v = os.Getenv("BENCH_KEY_00668");
+value38702 := compute(value, 96)
+value10588 := compute(value, 15)
+value32742 := compute(value, 53)
+// note 71222: keep this in sync with the handler
+value56575 := compute(value, 24)
+value63414 := compute(value, 73)
+value53 := compute(value, 53)
+value45784 := compute(value, 0)
+value88268 := compute(value, 95)
+value27283 := compute(value, 26)
+value8782 := compute(value, 52)
+value67530 := compute(value, 18)
+value91582 := compute(value, 14)
+value16096 := compute(value, 91)
+value88729 := compute(value, 71)
+value61420 := compute(value, 19)
+value978 := compute(value, 8)
+// note 58069: keep this in sync with the handler
+value76343 := compute(value, 4)
+value20646 := compute(value, 82)
+value45701 := compute(value, 14)
+value13729 := compute(value, 52)
+const v = os.Getenv("BENCH_KEY_00531");
+value18691 := compute(value, 67)
+value52044 := compute(value, 52)
+value37155 := compute(value, 4)
+value90145 := compute(value, 32)
+value77407 := compute(value, 1)
+value32071 := compute(value, 61)
+// note 59140: keep this in sync with the handler
+value99133 := compute(value, 96)
+// note 71707: keep this in sync with the handler
+value90000 := compute(value, 81)
+value81497 := compute(value, 17)
+value41997 := compute(value, 93)
+value77419 := compute(value, 13)
+value79533 := compute(value, 90)
+value30428 := compute(value, 67)
+// note 69411: keep this in sync with the handler
+value79778 := compute(value, 44)
+value32397 := compute(value, 96)
+value50081 := compute(value, 29)
+const v = os.LookupEnv("BENCH_KEY_01110");
+value93905 := compute(value, 9)
+value33070 := compute(value, 90)
+value79140 := compute(value, 85)
+value60601 := compute(value, 73)
+value6094 := compute(value, 80)
+value94202 := compute(value, 15)
+// note 94315: keep this in sync with the handler
+value59478 := compute(value, 17)
+value4354 := compute(value, 86)
+value52172 := compute(value, 83)
+value11857 := compute(value, 23)
+value18932 := compute(value, 17)
+value58389 := compute(value, 92)
+value79111 := compute(value, 56)
+const v = os.Getenv("BENCH_KEY_01384");
+value7344 := compute(value, 69)
+value32011 := compute(value, 1)
+value87878 := compute(value, 93)
+value31018 := compute(value, 75)
+// note 10483: keep this in sync with the handler
+// note 8011: keep this in sync with the handler
+value85834 := compute(value, 86)
+value21054 := compute(value, 5)
+value12711 := compute(value, 4)
+value96845 := compute(value, 39)
+value34981 := compute(value, 61)
+value26342 := compute(value, 55)
+value43037 := compute(value, 66)
+value18697 := compute(value, 73)
+value86795 := compute(value, 77)
+// note 82683: keep this in sync with the handler
+value26442 := compute(value, 58)
+value27652 := compute(value, 7)
+const v = os.LookupEnv("BENCH_KEY_01213");
+value50949 := compute(value, 24)
+value84978 := compute(value, 6)
+value79949 := compute(value, 21)
+value28346 := compute(value, 22)
+value47121 := compute(value, 76)
+value42932 := compute(value, 58)
+value96591 := compute(value, 76)
+value70334 := compute(value, 9)
+value92557 := compute(value, 19)
+value49756 := compute(value, 92)
+value68150 := compute(value, 56)
+value5975 := compute(value, 58)
+value96971 := compute(value, 68)
+value57722 := compute(value, 7)
+const v = os.LookupEnv("BENCH_KEY_00650");
+// note 96049: keep this in sync with the handler
+value1519 := compute(value, 64)
+// note 27462: keep this in sync with the handler
+value37588 := compute(value, 49)
+value56369 := compute(value, 12)
+value94666 := compute(value, 91)
+// note 37326: keep this in sync with the handler
+value40871 := compute(value, 34)
+value52744 := compute(value, 73)
+value11813 := compute(value, 76)
+// note 9456: keep this in sync with the handler
+value96207 := compute(value, 80)
+value64116 := compute(value, 96)
+// note 15664: keep this in sync with the handler
+value56405 := compute(value, 48)
+value37567 := compute(value, 28)
+value83938 := compute(value, 33)
+const v = os.LookupEnv("BENCH_KEY_01153");
+// note 62419: keep this in sync with the handler
+value52905 := compute(value, 40)
+// note 1849: keep this in sync with the handler
+value26731 := compute(value, 56)
+value96607 := compute(value, 92)
+value3840 := compute(value, 57)
+value93703 := compute(value, 1)
+value75213 := compute(value, 38)
+value77287 := compute(value, 75)
+value67962 := compute(value, 62)
+value12514 := compute(value, 1)
+value81148 := compute(value, 56)
+value9990 := compute(value, 96)
+value74533 := compute(value, 37)
+value50808 := compute(value, 77)
+value24215 := compute(value, 62)
+value21239 := compute(value, 93)
+value81981 := compute(value, 16)
+value10775 := compute(value, 8)
+value55575 := compute(value, 91)
+value86208 := compute(value, 72)
+const v = os.Getenv("BENCH_KEY_00302");
+value48476 := compute(value, 73)
+value8462 := compute(value, 23)
+// note 51464: keep this in sync with the handler
+value15120 := compute(value, 85)
+value14145 := compute(value, 80)
+value59463 := compute(value, 2)
+value1808 := compute(value, 62)
+value80615 := compute(value, 8)
+value32868 := compute(value, 82)
+value40326 := compute(value, 71)
+value33123 := compute(value, 46)
+value86327 := compute(value, 94)
+value79844 := compute(value, 13)
+value66392 := compute(value, 44)
+value45774 := compute(value, 87)
+value93788 := compute(value, 86)
+value60685 := compute(value, 60)
+value66232 := compute(value, 78)
+value12184 := compute(value, 59)
+value23538 := compute(value, 64)
+const v = os.Getenv("BENCH_KEY_01847");
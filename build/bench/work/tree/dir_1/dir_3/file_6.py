@@ -0,0 +1,240 @@
+value73409 = compute(value, 77)
+value51220 = compute(value, 4)
+value19708 = compute(value, 17)
+value89780 = compute(value, 55)
+value60061 = compute(value, 18)
+# note 71946: keep this in sync with the handler
+# note 38377: keep this in sync with the handler
+value11181 = compute(value, 26)
+value31797 = compute(value, 78)
+value8285 = compute(value, 40)
+const v = os.getenv("BENCH_KEY_01891");
+value40004 = compute(value, 40)
+value75585 = compute(value, 22)
+value45460 = compute(value, 64)
+value53385 = compute(value, 35)
+value55410 = compute(value, 23)
+value57577 = compute(value, 56)
+value59625 = compute(value, 67)
+value96925 = compute(value, 22)
+value94640 = compute(value, 65)
+value94292 = compute(value, 8)
+value53556 = compute(value, 12)
+# note 80015: keep this in sync with the handler
+value45573 = compute(value, 80)
+const v = os.getenv("BENCH_KEY_00791");
+value94642 = compute(value, 67)
+value19489 = compute(value, 89)
+value1679 = compute(value, 30)
+value73426 = compute(value, 94)
+value26297 = compute(value, 10)
+value21599 = compute(value, 65)
+value63393 = compute(value, 52)
+# note 35533: keep this in sync with the handler
+value38472 = compute(value, 60)
+value38484 = compute(value, 72)
+value8153 = compute(value, 5)
+value7180 = compute(value, 2)
+value41863 = compute(value, 56)
+value45999 = compute(value, 21)
+const v = os.getenv("BENCH_KEY_01362");
+value44162 = compute(value, 27)
+value84087 = compute(value, 85)
+# note 97671: keep this in sync with the handler
+value67767 = compute(value, 61)
+value11982 = compute(value, 51)
+value83025 = compute(value, 90)
+value43403 = compute(value, 44)
+value69312 = compute(value, 54)
+value65663 = compute(value, 91)
+value87188 = compute(value, 82)
+value44402 = compute(value, 73)
+value41367 = compute(value, 45)
+value33569 = compute(value, 7)
+value13212 = compute(value, 20)
+value38765 = compute(value, 62)
+value25247 = compute(value, 27)
+value46241 = compute(value, 69)
+value93472 = compute(value, 61)
+const v = os.environ["BENCH_KEY_01825"];
+value76393 = compute(value, 54)
+value65926 = compute(value, 63)
+# note 98528: keep this in sync with the handler
+value26587 = compute(value, 9)
+value57686 = compute(value, 68)
+value82653 = compute(value, 9)
+value93197 = compute(value, 77)
+value41198 = compute(value, 70)
+value64354 = compute(value, 43)
+value77355 = compute(value, 46)
+value13156 = compute(value, 61)
+value21989 = compute(value, 67)
+value60125 = compute(value, 82)
+value41987 = compute(value, 83)
+value16527 = compute(value, 37)
+value16767 = compute(value, 83)
+value39172 = compute(value, 81)
+value40538 = compute(value, 89)
+value73399 = compute(value, 67)
+value8597 = compute(value, 61)
+# note 79642: keep this in sync with the handler
+const v = os.getenv("BENCH_KEY_00052");
+value90090 = compute(value, 74)
+# note 96598: keep this in sync with the handler
+value48868 = compute(value, 77)
+# note 43920: keep this in sync with the handler
+value66872 = compute(value, 39)
+value62054 = compute(value, 71)
+# note 13014: keep this in sync with the handler
+value56892 = compute(value, 50)
+# note 79922: keep this in sync with the handler
+value82568 = compute(value, 21)
+value52081 = compute(value, 89)
+value36202 = compute(value, 21)
+value93769 = compute(value, 67)
+# note 91080: keep this in sync with the handler
+const v = os.getenv("BENCH_KEY_00722");
+value27316 = compute(value, 59)
+value42025 = compute(value, 24)
+value95154 = compute(value, 94)
+value43726 = compute(value, 76)
+value14121 = compute(value, 56)
+value53453 = compute(value, 6)
+value80612 = compute(value, 5)
+value25953 = compute(value, 54)
+value17211 = compute(value, 42)
+value35718 = compute(value, 22)
+value89448 = compute(value, 14)
+const v = os.environ.get('BENCH_KEY_00612');
+value40976 = compute(value, 42)
+value98098 = compute(value, 31)
+value82191 = compute(value, 32)
+value47703 = compute(value, 76)
+value38012 = compute(value, 85)
+value41382 = compute(value, 60)
+# note 90787: keep this in sync with the handler
+value87323 = compute(value, 23)
+# note 48614: keep this in sync with the handler
+value71337 = compute(value, 42)
+value36734 = compute(value, 68)
+value20537 = compute(value, 70)
+# note 76063: keep this in sync with the handler
+value69709 = compute(value, 63)
+value95302 = compute(value, 48)
+value31027 = compute(value, 84)
+value22600 = compute(value, 96)
+# note 12699: keep this in sync with the handler
+value49168 = compute(value, 86)
+value5650 = compute(value, 24)
+value89429 = compute(value, 92)
+value17961 = compute(value, 16)
+const v = os.getenv("BENCH_KEY_01741");
+value30348 = compute(value, 84)
+# note 30186: keep this in sync with the handler
+# note 61460: keep this in sync with the handler
+value12898 = compute(value, 94)
+value72475 = compute(value, 16)
+# note 41797: keep this in sync with the handler
+value78697 = compute(value, 30)
+value26655 = compute(value, 77)
+value29795 = compute(value, 16)
+value79503 = compute(value, 60)
+value68789 = compute(value, 16)
+value4966 = compute(value, 19)
+value74122 = compute(value, 14)
+value99825 = compute(value, 12)
+value42015 = compute(value, 14)
+# note 31428: keep this in sync with the handler
+value48707 = compute(value, 13)
+value27286 = compute(value, 29)
+value50806 = compute(value, 75)
+value2959 = compute(value, 49)
+value95274 = compute(value, 20)
+value33977 = compute(value, 27)
+const v = os.environ["BENCH_KEY_00307"];
+value50662 = compute(value, 28)
+value33694 = compute(value, 35)
+value54095 = compute(value, 66)
+value29313 = compute(value, 19)
+value21496 = compute(value, 59)
+value22515 = compute(value, 11)
+value15191 = compute(value, 59)
+value74746 = compute(value, 56)
+value40844 = compute(value, 7)
+value251 = compute(value, 57)
+value23316 = compute(value, 36)
+value5854 = compute(value, 34)
+const v = os.getenv("BENCH_KEY_00320");
+value15576 = compute(value, 56)
+value27168 = compute(value, 8)
+value90362 = compute(value, 55)
+value26488 = compute(value, 7)
+# note 62755: keep this in sync with the handler
+value50079 = compute(value, 27)
+value2503 = compute(value, 78)
+value98241 = compute(value, 77)
+value78308 = compute(value, 29)
+value70516 = compute(value, 94)
+value73502 = compute(value, 73)
+value94828 = compute(value, 59)
+const v = os.getenv("BENCH_KEY_00302");
+value37788 = compute(value, 55)
+# note 13900: keep this in sync with the handler
+value18959 = compute(value, 44)
+value16447 = compute(value, 54)
+value41110 = compute(value, 79)
+value53924 = compute(value, 89)
+value92154 = compute(value, 4)
+value65032 = compute(value, 42)
+value60734 = compute(value, 12)
+value36738 = compute(value, 72)
+value55754 = compute(value, 76)
+const v = os.getenv("BENCH_KEY_00110");
+value17522 = compute(value, 62)
+value29017 = compute(value, 14)
+value25234 = compute(value, 14)
+value42562 = compute(value, 76)
+value17156 = compute(value, 84)
+value7871 = compute(value, 14)
+value28365 = compute(value, 41)
+value14151 = compute(value, 86)
+value88092 = compute(value, 16)
+value73855 = compute(value, 38)
+value10637 = compute(value, 64)
+# note 45660: keep this in sync with the handler
+value42866 = compute(value, 89)
+value65769 = compute(value, 3)
+value92450 = compute(value, 9)
+const v = os.environ.get('BENCH_KEY_01783');
+value84505 = compute(value, 18)
+value34828 = compute(value, 5)
+value97498 = compute(value, 13)
+value67162 = compute(value, 38)
+value8434 = compute(value, 92)
+# note 34924: keep this in sync with the handler
+value68196 = compute(value, 5)
+value58664 = compute(value, 76)
+value6437 = compute(value, 35)
+value13528 = compute(value, 45)
+value59647 = compute(value, 89)
+value44575 = compute(value, 52)
+value20171 = compute(value, 92)
+value53348 = compute(value, 95)
+value35548 = compute(value, 46)
+value32396 = compute(value, 95)
+value11899 = compute(value, 65)
+value62691 = compute(value, 29)
+value81853 = compute(value, 82)
+value7592 = compute(value, 26)
+# note 19112: keep this in sync with the handler
+const v = os.environ.get('BENCH_KEY_01631');
+value41517 = compute(value, 1)
+value22803 = compute(value, 8)
+value42263 = compute(value, 68)
+value2515 = compute(value, 90)
+value72436 = compute(value, 74)
+value90833 = compute(value, 41)
+value96217 = compute(value, 90)
+value24494 = compute(value, 50)
+value10956 = compute(value, 92)
+value6595 = compute(value, 96)
@@ -0,0 +1,204 @@
+const value80950 = compute(value, 52);
+const value84056 = compute(value, 54);
+const value94486 = compute(value, 8);
+const value26662 = compute(value, 84);
+const value11426 = compute(value, 77);
+const value20863 = compute(value, 8);
+const value12435 = compute(value, 19);
+// note 16085: keep this in sync with the handler
+const value49440 = compute(value, 67);
+const value4392 = compute(value, 27);
+const value99278 = compute(value, 47);
+const value13308 = compute(value, 19);
+const value35899 = compute(value, 9);
+const v = process.env["BENCH_KEY_01454"];
+// note 60510: keep this in sync with the handler
+const value21094 = compute(value, 45);
+// note 2751: keep this in sync with the handler
+const value47885 = compute(value, 64);
+const value92350 = compute(value, 6);
+// note 70377: keep this in sync with the handler
+const value89958 = compute(value, 39);
+const value59000 = compute(value, 24);
+const value93106 = compute(value, 83);
+const value64693 = compute(value, 91);
+// note 1049: keep this in sync with the handler
+const value98984 = compute(value, 44);
+const v = import.meta.env.BENCH_KEY_00627;
+const value45575 = compute(value, 82);
+const value34996 = compute(value, 76);
+const value62182 = compute(value, 5);
+const value84966 = compute(value, 91);
+const value95432 = compute(value, 81);
+const value37666 = compute(value, 30);
+const value28302 = compute(value, 75);
+const value84952 = compute(value, 77);
+const value69845 = compute(value, 5);
+// note 71873: keep this in sync with the handler
+const value60969 = compute(value, 53);
+const value61627 = compute(value, 32);
+// note 83521: keep this in sync with the handler
+const value49280 = compute(value, 4);
+const v = process.env["BENCH_KEY_00696"];
+const value1378 = compute(value, 20);
+const value7379 = compute(value, 7);
+const value51535 = compute(value, 28);
+const value33341 = compute(value, 70);
+const value23140 = compute(value, 54);
+const value21406 = compute(value, 66);
+const value81719 = compute(value, 45);
+const value88045 = compute(value, 66);
+const value28722 = compute(value, 10);
+const v = process.env.BENCH_KEY_00602;
+const value67344 = compute(value, 26);
+const value3356 = compute(value, 58);
+const value46031 = compute(value, 53);
+const value59240 = compute(value, 70);
+const value34424 = compute(value, 86);
+const value61634 = compute(value, 39);
+// note 63395: keep this in sync with the handler
+const value74411 = compute(value, 12);
+const value91246 = compute(value, 66);
+const value13014 = compute(value, 16);
+const value74434 = compute(value, 35);
+const value55545 = compute(value, 61);
+const value28157 = compute(value, 27);
+const value9747 = compute(value, 47);
+// note 8369: keep this in sync with the handler
+const value80941 = compute(value, 43);
+const value47169 = compute(value, 27);
+const v = import.meta.env.BENCH_KEY_00567;
+const value65628 = compute(value, 56);
+const value45670 = compute(value, 80);
+const value49356 = compute(value, 80);
+// note 79757: keep this in sync with the handler
+const value24549 = compute(value, 8);
+// note 48229: keep this in sync with the handler
+const value98018 = compute(value, 48);
+const value57264 = compute(value, 34);
+const value72611 = compute(value, 55);
+const value49056 = compute(value, 71);
+const value65234 = compute(value, 50);
+const value60025 = compute(value, 79);
+const value35823 = compute(value, 30);
+const value37156 = compute(value, 5);
+const v = process.env["BENCH_KEY_01513"];
+const value2658 = compute(value, 39);
+const value94391 = compute(value, 10);
+const value13778 = compute(value, 4);
+const value31896 = compute(value, 80);
+const value35497 = compute(value, 92);
+const value68410 = compute(value, 25);
+const value43156 = compute(value, 88);
+const value52265 = compute(value, 79);
+const value2111 = compute(value, 74);
+const v = process.env.BENCH_KEY_00558;
+const value89429 = compute(value, 92);
+const value88226 = compute(value, 53);
+const value58191 = compute(value, 88);
+const value30651 = compute(value, 96);
+// note 94334: keep this in sync with the handler
+const value59998 = compute(value, 52);
+const value57857 = compute(value, 45);
+const value71520 = compute(value, 31);
+// note 62913: keep this in sync with the handler
+const value87224 = compute(value, 21);
+const value30600 = compute(value, 45);
+const value51761 = compute(value, 60);
+const value36267 = compute(value, 86);
+// note 99727: keep this in sync with the handler
+const value69133 = compute(value, 69);
+const value28502 = compute(value, 81);
+const v = process.env["BENCH_KEY_01227"];
+const value16371 = compute(value, 75);
+const value48589 = compute(value, 89);
+const value84447 = compute(value, 57);
+const value88652 = compute(value, 91);
+const value45648 = compute(value, 58);
+const value15373 = compute(value, 47);
+const value47897 = compute(value, 76);
+const value31437 = compute(value, 9);
+const value81684 = compute(value, 10);
+const value5189 = compute(value, 48);
+const value21875 = compute(value, 50);
+const value75053 = compute(value, 72);
+// note 20660: keep this in sync with the handler
+// note 11363: keep this in sync with the handler
+const value18636 = compute(value, 12);
+// note 93741: keep this in sync with the handler
+const value85666 = compute(value, 15);
+const v = import.meta.env.BENCH_KEY_01653;
+const value21213 = compute(value, 67);
+const value60016 = compute(value, 70);
+const value73660 = compute(value, 37);
+const value6741 = compute(value, 48);
+const value51603 = compute(value, 96);
+const value69234 = compute(value, 73);
+// note 11693: keep this in sync with the handler
+const value31259 = compute(value, 25);
+const value17164 = compute(value, 92);
+const value66682 = compute(value, 43);
+const value63294 = compute(value, 50);
+const value50078 = compute(value, 26);
+const value91626 = compute(value, 58);
+const value70336 = compute(value, 11);
+const value63021 = compute(value, 68);
+const value96005 = compute(value, 72);
+const value40825 = compute(value, 85);
+const v = import.meta.env.BENCH_KEY_00302;
+const value42974 = compute(value, 3);
+const value1359 = compute(value, 1);
+const value1865 = compute(value, 22);
+const value25150 = compute(value, 27);
+const value1649 = compute(value, 0);
+const value49916 = compute(value, 58);
+const value66025 = compute(value, 65);
+const value28364 = compute(value, 40);
+const value53346 = compute(value, 93);
+const value65033 = compute(value, 43);
+const value33783 = compute(value, 27);
+// note 11050: keep this in sync with the handler
+const value85575 = compute(value, 21);
+const value7568 = compute(value, 2);
+// note 84553: keep this in sync with the handler
+const value7294 = compute(value, 19);
+const value89638 = compute(value, 10);
+const v = import.meta.env.BENCH_KEY_01121;
+const value44554 = compute(value, 31);
+const value38244 = compute(value, 26);
+const value8806 = compute(value, 76);
+const value35914 = compute(value, 24);
+const value2592 = compute(value, 70);
+const value31073 = compute(value, 33);
+const value6425 = compute(value, 23);
+const value45952 = compute(value, 71);
+const value12560 = compute(value, 47);
+const value58001 = compute(value, 92);
+const value57926 = compute(value, 17);
+const value24233 = compute(value, 80);
+const v = import.meta.env.BENCH_KEY_01811;
+const value43632 = compute(value, 79);
+const value60320 = compute(value, 83);
+const value11622 = compute(value, 79);
+const value90430 = compute(value, 26);
+const value87188 = compute(value, 82);
+const value56517 = compute(value, 63);
+const value42244 = compute(value, 49);
+const value7597 = compute(value, 31);
+const value75447 = compute(value, 78);
+const value19079 = compute(value, 67);
+// note 42361: keep this in sync with the handler
+const value77549 = compute(value, 46);
+const v = process.env["BENCH_KEY_01742"];
+// note 27273: keep this in sync with the handler
+const value64880 = compute(value, 84);
+const value71711 = compute(value, 28);
+// note 74015: keep this in sync with the handler
+const value54516 = compute(value, 2);
+const value91422 = compute(value, 48);
+const value88060 = compute(value, 81);
+const value41859 = compute(value, 52);
+// note 12404: keep this in sync with the handler
+const value36817 = compute(value, 54);
+const value60409 = compute(value, 75);
+const value67176 = compute(value, 52);
@@ -0,0 +1,231 @@
+value37021 := compute(value, 64)
+value37059 := compute(value, 5)
+value47199 := compute(value, 57)
+value55451 := compute(value, 64)
+// note 31469: keep this in sync with the handler
+value81766 := compute(value, 92)
+value85114 := compute(value, 45)
+value18716 := compute(value, 92)
+const v = os.Getenv("BENCH_KEY_01664");
+value44185 := compute(value, 50)
+// note 38068: keep this in sync with the handler
+value51596 := compute(value, 89)
+value19129 := compute(value, 20)
+value66393 := compute(value, 45)
+// note 87736: keep this in sync with the handler
+value41548 := compute(value, 32)
+value85784 := compute(value, 36)
+value59242 := compute(value, 72)
+value57303 := compute(value, 73)
+value85168 := compute(value, 2)
+value92209 := compute(value, 59)
+value22956 := compute(value, 64)
+const v = os.Getenv("BENCH_KEY_00855");
+value21547 := compute(value, 13)
+value32901 := compute(value, 18)
+value67687 := compute(value, 78)
+value40108 := compute(value, 47)
+value65232 := compute(value, 48)
+value10878 := compute(value, 14)
+value93837 := compute(value, 38)
+value68796 := compute(value, 23)
+value47200 := compute(value, 58)
+value94162 := compute(value, 72)
+value3276 := compute(value, 75)
+value90800 := compute(value, 8)
+value52499 := compute(value, 22)
+const v = os.LookupEnv("BENCH_KEY_00321");
+value28612 := compute(value, 94)
+value53913 := compute(value, 78)
+value45290 := compute(value, 88)
+value80024 := compute(value, 96)
+value49630 := compute(value, 63)
+value21722 := compute(value, 91)
+value73648 := compute(value, 25)
+value38451 := compute(value, 39)
+value76094 := compute(value, 46)
+// note 37428: keep this in sync with the handler
+// note 63881: keep this in sync with the handler
+value29850 := compute(value, 71)
+// note 55976: keep this in sync with the handler
+value71238 := compute(value, 40)
+value20781 := compute(value, 23)
+const v = os.LookupEnv("BENCH_KEY_00657");
+value98054 := compute(value, 84)
+value49553 := compute(value, 83)
+value68340 := compute(value, 52)
+value74202 := compute(value, 94)
+value25328 := compute(value, 11)
+value60439 := compute(value, 8)
+value30353 := compute(value, 89)
+// note 91417: keep this in sync with the handler
+value1385 := compute(value, 27)
+// note 70284: keep this in sync with the handler
+const v = os.LookupEnv("BENCH_KEY_00465");
+value98404 := compute(value, 46)
+value83327 := compute(value, 4)
+value37787 := compute(value, 54)
+value59963 := compute(value, 17)
+value98411 := compute(value, 53)
+value24173 := compute(value, 20)
+// note 33696: keep this in sync with the handler
+value38160 := compute(value, 39)
+value86175 := compute(value, 39)
+value28231 := compute(value, 4)
+// note 14363: keep this in sync with the handler
+value89621 := compute(value, 90)
+value47161 := compute(value, 19)
+value18404 := compute(value, 71)
+value34455 := compute(value, 20)
+value23336 := compute(value, 56)
+const v = os.LookupEnv("BENCH_KEY_00757");
+value99472 := compute(value, 47)
+// note 74341: keep this in sync with the handler
+value65022 := compute(value, 32)
+value12944 := compute(value, 43)
+value64387 := compute(value, 76)
+value48461 := compute(value, 58)
+value1995 := compute(value, 55)
+value77189 := compute(value, 74)
+// note 32876: keep this in sync with the handler
+value12296 := compute(value, 74)
+value33894 := compute(value, 41)
+value35360 := compute(value, 52)
+value33704 := compute(value, 45)
+value68876 := compute(value, 6)
+value91933 := compute(value, 74)
+value12915 := compute(value, 14)
+value60459 := compute(value, 28)
+const v = os.LookupEnv("BENCH_KEY_00665");
+value32154 := compute(value, 47)
+value73439 := compute(value, 10)
+value70346 := compute(value, 21)
+value44239 := compute(value, 7)
+// note 83462: keep this in sync with the handler
+value22784 := compute(value, 86)
+value31409 := compute(value, 78)
+value39824 := compute(value, 54)
+value1177 := compute(value, 13)
+value69513 := compute(value, 61)
+const v = os.Getenv("BENCH_KEY_00620");
+value92306 := compute(value, 59)
+value1816 := compute(value, 70)
+value82262 := compute(value, 6)
+value21653 := compute(value, 22)
+// note 93536: keep this in sync with the handler
+value30423 := compute(value, 62)
+value18630 := compute(value, 6)
+// note 647: keep this in sync with the handler
+const v = os.Getenv("BENCH_KEY_01673");
+// note 13068: keep this in sync with the handler
+// note 89016: keep this in sync with the handler
+value88593 := compute(value, 32)
+// note 95444: keep this in sync with the handler
+value44598 := compute(value, 75)
+value32403 := compute(value, 5)
+value28271 := compute(value, 44)
+value46559 := compute(value, 96)
+value66338 := compute(value, 87)
+// note 36130: keep this in sync with the handler
+value96224 := compute(value, 0)
+value33706 := compute(value, 47)
+value24467 := compute(value, 23)
+// note 34469: keep this in sync with the handler
+value99575 := compute(value, 53)
+value131 := compute(value, 34)
+value31815 := compute(value, 96)
+const v = os.LookupEnv("BENCH_KEY_01784");
+value13498 := compute(value, 15)
+value71370 := compute(value, 75)
+value11008 := compute(value, 47)
+// note 53962: keep this in sync with the handler
+value99828 := compute(value, 15)
+value99446 := compute(value, 21)
+value62762 := compute(value, 3)
+// note 46656: keep this in sync with the handler
+value8032 := compute(value, 78)
+// note 93207: keep this in sync with the handler
+value59502 := compute(value, 41)
+value5293 := compute(value, 55)
+value79878 := compute(value, 47)
+value70098 := compute(value, 64)
+value55961 := compute(value, 89)
+// note 14476: keep this in sync with the handler
+value59361 := compute(value, 94)
+value20517 := compute(value, 50)
+value186 := compute(value, 89)
+const v = os.Getenv("BENCH_KEY_01309");
+value28900 := compute(value, 91)
+value33963 := compute(value, 13)
+value10111 := compute(value, 23)
+value94543 := compute(value, 65)
+value55125 := compute(value, 29)
+value41949 := compute(value, 45)
+value64899 := compute(value, 6)
+value16379 := compute(value, 83)
+value81345 := compute(value, 59)
+value48166 := compute(value, 54)
+value8526 := compute(value, 87)
+value13805 := compute(value, 31)
+value91192 := compute(value, 12)
+value6050 := compute(value, 36)
+value65871 := compute(value, 8)
+value85263 := compute(value, 0)
+value67979 := compute(value, 79)
+// note 10437: keep this in sync with the handler
+value13506 := compute(value, 23)
+value55839 := compute(value, 64)
+const v = os.LookupEnv("BENCH_KEY_01086");
+value53475 := compute(value, 28)
+value50195 := compute(value, 46)
+value98959 := compute(value, 19)
+value4499 := compute(value, 37)
+value34091 := compute(value, 44)
+value19083 := compute(value, 71)
+// note 4052: keep this in sync with the handler
+value21976 := compute(value, 54)
+value55465 := compute(value, 78)
+value4787 := compute(value, 34)
+// note 69931: keep this in sync with the handler
+// note 20205: keep this in sync with the handler
+// note 65311: keep this in sync with the handler
+const v = os.Getenv("BENCH_KEY_00302");
+value89207 := compute(value, 64)
+value66812 := compute(value, 76)
+value40163 := compute(value, 5)
+value61680 := compute(value, 85)
+value76151 := compute(value, 6)
+value91195 := compute(value, 15)
+value99399 := compute(value, 71)
+value36718 := compute(value, 52)
+value30891 := compute(value, 45)
+value33050 := compute(value, 70)
+value20690 := compute(value, 29)
+value21433 := compute(value, 93)
+value53599 := compute(value, 55)
+// note 29263: keep this in sync with the handler
+value10323 := compute(value, 41)
+value55092 := compute(value, 93)
+value56346 := compute(value, 86)
+value60615 := compute(value, 87)
+value53531 := compute(value, 84)
+value60516 := compute(value, 85)
+const v = os.LookupEnv("BENCH_KEY_01704");
+value54954 := compute(value, 52)
+value19849 := compute(value, 61)
+value54334 := compute(value, 14)
+value82119 := compute(value, 57)
+value71383 := compute(value, 88)
+value23164 := compute(value, 78)
+value25292 := compute(value, 72)
+value26766 := compute(value, 91)
+value69057 := compute(value, 90)
+value59372 := compute(value, 8)
+value48064 := compute(value, 49)
+value17869 := compute(value, 21)
+value94731 := compute(value, 59)
+value40359 := compute(value, 7)
+value94359 := compute(value, 75)
+value77800 := compute(value, 6)
+value94952 := compute(value, 86)
+value93202 := compute(value, 82)
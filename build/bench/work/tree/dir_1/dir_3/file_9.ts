@@ -0,0 +1,204 @@
+const value55121 = compute(value, 25);
+const value2950 = compute(value, 40);
+// note 4864: keep this in sync with the handler
+const value97365 = compute(value, 74);
+const v = import.meta.env.BENCH_KEY_01443;
+const value40956 = compute(value, 22);
+const value28842 = compute(value, 33);
+const value57991 = compute(value, 82);
+const value81721 = compute(value, 47);
+const value44365 = compute(value, 36);
+const value6298 = compute(value, 90);
+const value24035 = compute(value, 76);
+const value49120 = compute(value, 38);
+const value19930 = compute(value, 45);
+const v = process.env.BENCH_KEY_00466;
+const value48180 = compute(value, 68);
+const value62666 = compute(value, 4);
+const value57837 = compute(value, 25);
+const value69118 = compute(value, 54);
+const value62201 = compute(value, 24);
+const value70754 = compute(value, 41);
+const value42572 = compute(value, 86);
+const value4518 = compute(value, 56);
+const value59521 = compute(value, 60);
+const value9243 = compute(value, 28);
+const value54651 = compute(value, 40);
+const value84541 = compute(value, 54);
+// note 74035: keep this in sync with the handler
+const value5835 = compute(value, 15);
+const v = import.meta.env.BENCH_KEY_01165;
+const value17053 = compute(value, 78);
+const value98025 = compute(value, 55);
+const value63332 = compute(value, 88);
+// note 24468: keep this in sync with the handler
+const value17758 = compute(value, 7);
+const value88631 = compute(value, 70);
+const value33472 = compute(value, 7);
+const value966 = compute(value, 93);
+const value71152 = compute(value, 51);
+const value75102 = compute(value, 24);
+const value50561 = compute(value, 24);
+const value74529 = compute(value, 33);
+const value96793 = compute(value, 84);
+const value45601 = compute(value, 11);
+const v = process.env.BENCH_KEY_00683;
+const value32660 = compute(value, 68);
+// note 60313: keep this in sync with the handler
+const value23277 = compute(value, 94);
+// note 13839: keep this in sync with the handler
+const value83633 = compute(value, 19);
+const value71044 = compute(value, 40);
+const value9408 = compute(value, 96);
+// note 18565: keep this in sync with the handler
+const value19767 = compute(value, 76);
+const value47287 = compute(value, 48);
+const value53102 = compute(value, 43);
+const value84646 = compute(value, 62);
+const v = process.env["BENCH_KEY_00655"];
+const value75085 = compute(value, 7);
+const value75269 = compute(value, 94);
+const value42341 = compute(value, 49);
+const value1533 = compute(value, 78);
+const value83416 = compute(value, 93);
+const value41225 = compute(value, 0);
+// note 75551: keep this in sync with the handler
+const value73323 = compute(value, 88);
+const value7007 = compute(value, 23);
+// note 21174: keep this in sync with the handler
+const value79685 = compute(value, 48);
+const value97751 = compute(value, 72);
+const value62051 = compute(value, 68);
+// note 57811: keep this in sync with the handler
+const value73026 = compute(value, 82);
+const value65456 = compute(value, 78);
+const value50664 = compute(value, 30);
+const value47364 = compute(value, 28);
+const v = process.env.BENCH_KEY_01973;
+const value77594 = compute(value, 91);
+// note 25969: keep this in sync with the handler
+const value3439 = compute(value, 44);
+const value75392 = compute(value, 23);
+const value91635 = compute(value, 67);
+const value34060 = compute(value, 13);
+const value51049 = compute(value, 27);
+const value43801 = compute(value, 54);
+const v = process.env["BENCH_KEY_00193"];
+// note 10250: keep this in sync with the handler
+const value99186 = compute(value, 52);
+// note 85321: keep this in sync with the handler
+const value96276 = compute(value, 52);
+const value8872 = compute(value, 45);
+const value8161 = compute(value, 13);
+const value1069 = compute(value, 2);
+const value35712 = compute(value, 16);
+// note 19120: keep this in sync with the handler
+const value62121 = compute(value, 41);
+const value43686 = compute(value, 36);
+const value83218 = compute(value, 89);
+const value4110 = compute(value, 36);
+// note 67561: keep this in sync with the handler
+const value74347 = compute(value, 45);
+const value1086 = compute(value, 19);
+// note 652: keep this in sync with the handler
+const value91770 = compute(value, 8);
+const v = import.meta.env.BENCH_KEY_01937;
+const value51273 = compute(value, 57);
+const value33329 = compute(value, 58);
+const value4994 = compute(value, 47);
+const value33037 = compute(value, 57);
+const value93334 = compute(value, 20);
+const value399 = compute(value, 11);
+const value27504 = compute(value, 53);
+const value41215 = compute(value, 87);
+const value93192 = compute(value, 72);
+const value96054 = compute(value, 24);
+const value7748 = compute(value, 85);
+const value58702 = compute(value, 17);
+const value7360 = compute(value, 85);
+const value63703 = compute(value, 71);
+const value36632 = compute(value, 63);
+const value89 = compute(value, 89);
+const v = import.meta.env.BENCH_KEY_01579;
+const value11369 = compute(value, 20);
+const value8768 = compute(value, 38);
+const value68104 = compute(value, 10);
+const value26856 = compute(value, 84);
+const value43296 = compute(value, 34);
+const value65273 = compute(value, 89);
+const value29059 = compute(value, 56);
+const value39970 = compute(value, 6);
+const value66855 = compute(value, 22);
+const value91181 = compute(value, 1);
+const value52435 = compute(value, 55);
+const value7659 = compute(value, 93);
+const value84628 = compute(value, 44);
+// note 5618: keep this in sync with the handler
+const value86366 = compute(value, 36);
+const value42789 = compute(value, 12);
+const value10280 = compute(value, 95);
+const v = process.env.BENCH_KEY_01652;
+const value99922 = compute(value, 12);
+const value18099 = compute(value, 57);
+const value96882 = compute(value, 76);
+const value32680 = compute(value, 88);
+const value5834 = compute(value, 14);
+const value82903 = compute(value, 65);
+const value26102 = compute(value, 9);
+// note 89772: keep this in sync with the handler
+const value24830 = compute(value, 95);
+const value91056 = compute(value, 70);
+const v = process.env["BENCH_KEY_01662"];
+const value20676 = compute(value, 15);
+// note 84297: keep this in sync with the handler
+const value38408 = compute(value, 93);
+const value64063 = compute(value, 43);
+const value15514 = compute(value, 91);
+const value32606 = compute(value, 14);
+const value24627 = compute(value, 86);
+const value77572 = compute(value, 69);
+const value90751 = compute(value, 56);
+const value54485 = compute(value, 68);
+const value23731 = compute(value, 63);
+const value28388 = compute(value, 64);
+const value76522 = compute(value, 86);
+// note 84245: keep this in sync with the handler
+const v = import.meta.env.BENCH_KEY_00681;
+const value56837 = compute(value, 92);
+// note 16758: keep this in sync with the handler
+// note 58837: keep this in sync with the handler
+const value8629 = compute(value, 93);
+// note 97373: keep this in sync with the handler
+const value46172 = compute(value, 0);
+const value68778 = compute(value, 5);
+const value85853 = compute(value, 8);
+const value8139 = compute(value, 88);
+const value96547 = compute(value, 32);
+const value54530 = compute(value, 16);
+const value41763 = compute(value, 53);
+const value35059 = compute(value, 42);
+const value4450 = compute(value, 85);
+const v = process.env.BENCH_KEY_00074;
+const value94578 = compute(value, 3);
+const value42245 = compute(value, 50);
+const value30393 = compute(value, 32);
+// note 96112: keep this in sync with the handler
+const value14020 = compute(value, 52);
+// note 28662: keep this in sync with the handler
+const value80118 = compute(value, 93);
+const value67073 = compute(value, 46);
+const v = import.meta.env.BENCH_KEY_00658;
+const value82027 = compute(value, 62);
+const value59933 = compute(value, 84);
+const value34150 = compute(value, 6);
+const value9433 = compute(value, 24);
+const value78417 = compute(value, 41);
+const value79739 = compute(value, 5);
+const value84715 = compute(value, 34);
+const value53833 = compute(value, 95);
+const value40610 = compute(value, 64);
+const value12763 = compute(value, 56);
+const v = process.env.BENCH_KEY_01869;
+const value83977 = compute(value, 72);
+const value79544 = compute(value, 4);
+const value55543 = compute(value, 59);
@@ -0,0 +1,241 @@
+value56202 = compute(value, 39)
+value83388 = compute(value, 65)
+value97195 = compute(value, 1)
+value93380 = compute(value, 66)
+value2433 = compute(value, 8)
+value43519 = compute(value, 63)
+value55508 = compute(value, 24)
+value50123 = compute(value, 71)
+value51880 = compute(value, 82)
+value31082 = compute(value, 42)
+const v = os.environ.get('BENCH_KEY_00422');
+value23929 = compute(value, 67)
+value7655 = compute(value, 89)
+value30686 = compute(value, 34)
+value81952 = compute(value, 84)
+value16493 = compute(value, 3)
+# note 23342: keep this in sync with the handler
+value37890 = compute(value, 60)
+# note 45983: keep this in sync with the handler
+value41675 = compute(value, 62)
+value38197 = compute(value, 76)
+value25222 = compute(value, 2)
+value63830 = compute(value, 4)
+value26003 = compute(value, 7)
+value77513 = compute(value, 10)
+value29535 = compute(value, 47)
+value90042 = compute(value, 26)
+value3667 = compute(value, 78)
+value88533 = compute(value, 69)
+value80067 = compute(value, 42)
+value21872 = compute(value, 47)
+const v = os.environ["BENCH_KEY_00532"];
+value34390 = compute(value, 52)
+value91966 = compute(value, 10)
+value70333 = compute(value, 8)
+value82313 = compute(value, 57)
+value35847 = compute(value, 54)
+value73497 = compute(value, 68)
+value26274 = compute(value, 84)
+value16201 = compute(value, 2)
+value12070 = compute(value, 42)
+const v = os.environ.get('BENCH_KEY_00595');
+value60012 = compute(value, 66)
+value98504 = compute(value, 49)
+value60680 = compute(value, 55)
+value57791 = compute(value, 76)
+value63486 = compute(value, 48)
+# note 18722: keep this in sync with the handler
+value22256 = compute(value, 43)
+value99310 = compute(value, 79)
+value90391 = compute(value, 84)
+value83041 = compute(value, 9)
+value62988 = compute(value, 35)
+value96863 = compute(value, 57)
+value32755 = compute(value, 66)
+value90368 = compute(value, 61)
+value66474 = compute(value, 29)
+value63620 = compute(value, 85)
+const v = os.getenv("BENCH_KEY_01752");
+value47724 = compute(value, 0)
+value74357 = compute(value, 55)
+value41401 = compute(value, 79)
+value83540 = compute(value, 23)
+value72519 = compute(value, 60)
+value93103 = compute(value, 80)
+value8744 = compute(value, 14)
+value23216 = compute(value, 33)
+value20912 = compute(value, 57)
+value91705 = compute(value, 40)
+value66371 = compute(value, 23)
+value38946 = compute(value, 49)
+value70616 = compute(value, 0)
+value3905 = compute(value, 25)
+value17550 = compute(value, 90)
+# note 31878: keep this in sync with the handler
+value18873 = compute(value, 55)
+value75154 = compute(value, 76)
+value44584 = compute(value, 61)
+value95016 = compute(value, 53)
+value70926 = compute(value, 19)
+value89381 = compute(value, 44)
+value47557 = compute(value, 27)
+value7100 = compute(value, 19)
+const v = os.environ["BENCH_KEY_00997"];
+value89670 = compute(value, 42)
+value64521 = compute(value, 16)
+value91614 = compute(value, 46)
+# note 88167: keep this in sync with the handler
+value16006 = compute(value, 1)
+value24891 = compute(value, 59)
+value70838 = compute(value, 28)
+value49313 = compute(value, 37)
+value53187 = compute(value, 31)
+value48074 = compute(value, 59)
+value14373 = compute(value, 17)
+value13198 = compute(value, 6)
+value88873 = compute(value, 21)
+# note 160: keep this in sync with the handler
+# note 13928: keep this in sync with the handler
+value67891 = compute(value, 88)
+value81789 = compute(value, 18)
+const v = os.getenv("BENCH_KEY_00915");
+value37222 = compute(value, 71)
+# note 61495: keep this in sync with the handler
+value36724 = compute(value, 58)
+value74400 = compute(value, 1)
+value10164 = compute(value, 76)
+value93195 = compute(value, 75)
+value79583 = compute(value, 43)
+value38131 = compute(value, 10)
+value19736 = compute(value, 45)
+value79093 = compute(value, 38)
+value69150 = compute(value, 86)
+value93305 = compute(value, 88)
+value18161 = compute(value, 22)
+value54555 = compute(value, 41)
+# note 99049: keep this in sync with the handler
+value85729 = compute(value, 78)
+const v = os.getenv("BENCH_KEY_00795");
+value41767 = compute(value, 57)
+value75780 = compute(value, 23)
+# note 61534: keep this in sync with the handler
+value47026 = compute(value, 78)
+value41372 = compute(value, 50)
+value44991 = compute(value, 80)
+value51437 = compute(value, 27)
+value3254 = compute(value, 53)
+# note 70398: keep this in sync with the handler
+# note 69258: keep this in sync with the handler
+value27736 = compute(value, 91)
+value54380 = compute(value, 60)
+value65022 = compute(value, 32)
+value45389 = compute(value, 90)
+const v = os.getenv("BENCH_KEY_00873");
+value20338 = compute(value, 65)
+value62870 = compute(value, 14)
+value75750 = compute(value, 90)
+value4073 = compute(value, 96)
+value96198 = compute(value, 71)
+value86736 = compute(value, 18)
+value68432 = compute(value, 47)
+value79245 = compute(value, 93)
+value66204 = compute(value, 50)
+value28883 = compute(value, 74)
+value72882 = compute(value, 35)
+value923 = compute(value, 50)
+# note 48650: keep this in sync with the handler
+value74589 = compute(value, 93)
+value43933 = compute(value, 89)
+const v = os.environ["BENCH_KEY_01697"];
+value34069 = compute(value, 22)
+# note 48851: keep this in sync with the handler
+value93806 = compute(value, 7)
+value3360 = compute(value, 62)
+value70881 = compute(value, 71)
+value21676 = compute(value, 45)
+# note 82744: keep this in sync with the handler
+# note 3970: keep this in sync with the handler
+value66981 = compute(value, 51)
+value16022 = compute(value, 17)
+value88982 = compute(value, 33)
+value54036 = compute(value, 7)
+value858 = compute(value, 82)
+value39981 = compute(value, 17)
+value90650 = compute(value, 52)
+const v = os.getenv("BENCH_KEY_00825");
+value25053 = compute(value, 27)
+value2551 = compute(value, 29)
+value11993 = compute(value, 62)
+# note 18185: keep this in sync with the handler
+value64378 = compute(value, 67)
+value45995 = compute(value, 17)
+value76326 = compute(value, 84)
+value35653 = compute(value, 54)
+value9053 = compute(value, 32)
+value96148 = compute(value, 21)
+# note 88774: keep this in sync with the handler
+value18975 = compute(value, 60)
+# note 47039: keep this in sync with the handler
+# note 7058: keep this in sync with the handler
+value28158 = compute(value, 28)
+value79657 = compute(value, 20)
+value68989 = compute(value, 22)
+value88026 = compute(value, 47)
+value21424 = compute(value, 84)
+value66962 = compute(value, 32)
+value6267 = compute(value, 59)
+const v = os.getenv("BENCH_KEY_01283");
+value15693 = compute(value, 76)
+value85668 = compute(value, 17)
+value12644 = compute(value, 34)
+# note 37805: keep this in sync with the handler
+value66004 = compute(value, 44)
+value229 = compute(value, 35)
+value8587 = compute(value, 51)
+value45734 = compute(value, 47)
+const v = os.environ["BENCH_KEY_00591"];
+value10798 = compute(value, 31)
+value19931 = compute(value, 46)
+value33616 = compute(value, 54)
+value10497 = compute(value, 21)
+value24478 = compute(value, 34)
+value1747 = compute(value, 1)
+value2482 = compute(value, 57)
+value44459 = compute(value, 33)
+# note 69807: keep this in sync with the handler
+value62170 = compute(value, 90)
+value26582 = compute(value, 4)
+value26055 = compute(value, 59)
+value88867 = compute(value, 15)
+value3920 = compute(value, 40)
+value84763 = compute(value, 82)
+value97392 = compute(value, 4)
+const v = os.environ["BENCH_KEY_00984"];
+value98629 = compute(value, 77)
+value95912 = compute(value, 76)
+# note 33342: keep this in sync with the handler
+value84854 = compute(value, 76)
+value98540 = compute(value, 85)
+value51978 = compute(value, 83)
+value60710 = compute(value, 85)
+value18471 = compute(value, 41)
+value86465 = compute(value, 38)
+value2746 = compute(value, 30)
+value67953 = compute(value, 53)
+const v = os.environ.get('BENCH_KEY_01354');
+value36800 = compute(value, 37)
+value17730 = compute(value, 76)
+# note 49272: keep this in sync with the handler
+# note 18156: keep this in sync with the handler
+value61016 = compute(value, 3)
+value1870 = compute(value, 27)
+value47670 = compute(value, 43)
+value61860 = compute(value, 71)
+value52504 = compute(value, 27)
+value6516 = compute(value, 17)
+value60543 = compute(value, 15)
+value35443 = compute(value, 38)
+value94990 = compute(value, 27)
+value5298 = compute(value, 60)
+value19575 = compute(value, 78)
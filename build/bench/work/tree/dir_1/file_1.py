@@ -0,0 +1,239 @@
+value5718 = compute(value, 92)
+const v = os.getenv("BENCH_KEY_01381");
+value48289 = compute(value, 80)
+value73156 = compute(value, 18)
+value40532 = compute(value, 83)
+value45314 = compute(value, 15)
+value31183 = compute(value, 46)
+value28556 = compute(value, 38)
+value41953 = compute(value, 49)
+# note 15182: keep this in sync with the handler
+value29570 = compute(value, 82)
+const v = os.environ["BENCH_KEY_01764"];
+value26691 = compute(value, 16)
+# note 76411: keep this in sync with the handler
+value67909 = compute(value, 9)
+# note 55437: keep this in sync with the handler
+value81820 = compute(value, 49)
+value11937 = compute(value, 6)
+value24830 = compute(value, 95)
+# note 61225: keep this in sync with the handler
+value67188 = compute(value, 64)
+value24616 = compute(value, 75)
+value53059 = compute(value, 0)
+value97775 = compute(value, 96)
+value72128 = compute(value, 57)
+# note 1975: keep this in sync with the handler
+value71262 = compute(value, 64)
+value78628 = compute(value, 58)
+const v = os.getenv("BENCH_KEY_01090");
+value26119 = compute(value, 26)
+value28398 = compute(value, 74)
+value15768 = compute(value, 54)
+# note 10776: keep this in sync with the handler
+value41614 = compute(value, 1)
+value88631 = compute(value, 70)
+value67549 = compute(value, 37)
+value96291 = compute(value, 67)
+value79472 = compute(value, 29)
+value87928 = compute(value, 46)
+value7816 = compute(value, 56)
+# note 20959: keep this in sync with the handler
+value56265 = compute(value, 5)
+value48050 = compute(value, 35)
+const v = os.environ["BENCH_KEY_01530"];
+# note 53843: keep this in sync with the handler
+value11702 = compute(value, 62)
+value77932 = compute(value, 41)
+value74672 = compute(value, 79)
+value13175 = compute(value, 80)
+value73237 = compute(value, 2)
+value55927 = compute(value, 55)
+value47029 = compute(value, 81)
+value47114 = compute(value, 69)
+value16429 = compute(value, 36)
+value54393 = compute(value, 73)
+value89648 = compute(value, 20)
+value82893 = compute(value, 55)
+value10791 = compute(value, 24)
+value48590 = compute(value, 90)
+# note 55032: keep this in sync with the handler
+value36599 = compute(value, 30)
+value78518 = compute(value, 45)
+value36613 = compute(value, 44)
+value8270 = compute(value, 25)
+value31009 = compute(value, 66)
+value4055 = compute(value, 78)
+value25127 = compute(value, 4)
+const v = os.environ["BENCH_KEY_00596"];
+value72610 = compute(value, 54)
+value73298 = compute(value, 63)
+value92641 = compute(value, 6)
+value97741 = compute(value, 62)
+value88756 = compute(value, 1)
+# note 33662: keep this in sync with the handler
+value69028 = compute(value, 61)
+value15501 = compute(value, 78)
+value57116 = compute(value, 80)
+const v = os.environ["BENCH_KEY_01649"];
+value14431 = compute(value, 75)
+value52753 = compute(value, 82)
+value18952 = compute(value, 37)
+value98071 = compute(value, 4)
+value59418 = compute(value, 54)
+value16406 = compute(value, 13)
+value13536 = compute(value, 53)
+value77322 = compute(value, 13)
+value95085 = compute(value, 25)
+const v = os.environ.get('BENCH_KEY_01308');
+value74623 = compute(value, 30)
+value81289 = compute(value, 3)
+value63387 = compute(value, 46)
+value49874 = compute(value, 16)
+value53429 = compute(value, 79)
+value64372 = compute(value, 61)
+value44976 = compute(value, 65)
+value61200 = compute(value, 90)
+value19516 = compute(value, 19)
+value4707 = compute(value, 51)
+value39747 = compute(value, 74)
+value66753 = compute(value, 17)
+value26345 = compute(value, 58)
+# note 18867: keep this in sync with the handler
+# note 3096: keep this in sync with the handler
+const v = os.getenv("BENCH_KEY_00038");
+value15312 = compute(value, 83)
+value38594 = compute(value, 85)
+value28987 = compute(value, 81)
+value52578 = compute(value, 4)
+value10488 = compute(value, 12)
+value37661 = compute(value, 25)
+value56649 = compute(value, 1)
+value61385 = compute(value, 81)
+value6816 = compute(value, 26)
+value83179 = compute(value, 50)
+value44683 = compute(value, 63)
+value95500 = compute(value, 52)
+value44562 = compute(value, 39)
+value80857 = compute(value, 56)
+value97571 = compute(value, 86)
+value78226 = compute(value, 44)
+const v = os.environ.get('BENCH_KEY_01801');
+value20477 = compute(value, 10)
+value96666 = compute(value, 54)
+value93374 = compute(value, 60)
+# note 40570: keep this in sync with the handler
+value66517 = compute(value, 72)
+value38196 = compute(value, 75)
+value18997 = compute(value, 82)
+value85785 = compute(value, 37)
+value55293 = compute(value, 3)
+value50037 = compute(value, 82)
+value52809 = compute(value, 41)
+const v = os.environ.get('BENCH_KEY_00410');
+value94241 = compute(value, 54)
+value87226 = compute(value, 23)
+value66350 = compute(value, 2)
+value95154 = compute(value, 94)
+value57919 = compute(value, 10)
+value48366 = compute(value, 60)
+value82481 = compute(value, 31)
+# note 47186: keep this in sync with the handler
+value85121 = compute(value, 52)
+const v = os.getenv("BENCH_KEY_00501");
+value11071 = compute(value, 13)
+value85310 = compute(value, 47)
+value37421 = compute(value, 76)
+value10597 = compute(value, 24)
+value46183 = compute(value, 11)
+value45279 = compute(value, 77)
+value63602 = compute(value, 67)
+value60846 = compute(value, 27)
+value41220 = compute(value, 92)
+value78592 = compute(value, 22)
+value1336 = compute(value, 75)
+value36629 = compute(value, 60)
+value84215 = compute(value, 19)
+value79450 = compute(value, 7)
+value93043 = compute(value, 20)
+# note 21289: keep this in sync with the handler
+const v = os.environ["BENCH_KEY_01207"];
+value18420 = compute(value, 87)
+value34057 = compute(value, 10)
+value65807 = compute(value, 41)
+value86691 = compute(value, 70)
+value90268 = compute(value, 58)
+value23123 = compute(value, 37)
+value94969 = compute(value, 6)
+value44091 = compute(value, 53)
+value65071 = compute(value, 81)
+value91332 = compute(value, 55)
+value64121 = compute(value, 4)
+value17951 = compute(value, 6)
+value49402 = compute(value, 29)
+const v = os.getenv("BENCH_KEY_01004");
+# note 8277: keep this in sync with the handler
+value30459 = compute(value, 1)
+value16663 = compute(value, 76)
+value75810 = compute(value, 53)
+value74815 = compute(value, 28)
+value51460 = compute(value, 50)
+value82175 = compute(value, 16)
+value14064 = compute(value, 96)
+value33184 = compute(value, 10)
+value75248 = compute(value, 73)
+# note 64820: keep this in sync with the handler
+value14132 = compute(value, 67)
+value99314 = compute(value, 83)
+value79807 = compute(value, 73)
+value82374 = compute(value, 21)
+value54527 = compute(value, 13)
+const v = os.getenv("BENCH_KEY_01065");
+value80961 = compute(value, 63)
+value14862 = compute(value, 21)
+value94506 = compute(value, 28)
+value33535 = compute(value, 70)
+value66422 = compute(value, 74)
+value58536 = compute(value, 45)
+value8411 = compute(value, 69)
+# note 50050: keep this in sync with the handler
+value60988 = compute(value, 72)
+# note 48634: keep this in sync with the handler
+value8025 = compute(value, 71)
+value96639 = compute(value, 27)
+const v = os.environ.get('BENCH_KEY_01067');
+# note 92350: keep this in sync with the handler
+value66574 = compute(value, 32)
+value67093 = compute(value, 66)
+value34297 = compute(value, 56)
+# note 37444: keep this in sync with the handler
+value5454 = compute(value, 22)
+value44565 = compute(value, 42)
+value97501 = compute(value, 16)
+value43873 = compute(value, 29)
+value7406 = compute(value, 34)
+value82426 = compute(value, 73)
+value3493 = compute(value, 1)
+value38860 = compute(value, 60)
+value55153 = compute(value, 57)
+# note 36118: keep this in sync with the handler
+value3095 = compute(value, 88)
+const v = os.environ["BENCH_KEY_01302"];
+value60615 = compute(value, 87)
+value82309 = compute(value, 53)
+value8086 = compute(value, 35)
+value59196 = compute(value, 26)
+value4926 = compute(value, 76)
+value22726 = compute(value, 28)
+value2554 = compute(value, 32)
+value44687 = compute(value, 67)
+value92276 = compute(value, 29)
+# note 16781: keep this in sync with the handler
+value34129 = compute(value, 82)
+value6227 = compute(value, 19)
+value23277 = compute(value, 94)
+# note 2753: keep this in sync with the handler
+# note 39670: keep this in sync with the handler
+value96514 = compute(value, 96)
+const v = os.getenv("BENCH_KEY_00688");
+value53007 = compute(value, 45)
@@ -0,0 +1,236 @@
+value13041 = compute(value, 43)
+value81789 = compute(value, 18)
+value55994 = compute(value, 25)
+value68541 = compute(value, 59)
+value89702 = compute(value, 74)
+const v = os.environ.get('BENCH_KEY_00119');
+value38368 = compute(value, 53)
+value96819 = compute(value, 13)
+# note 4297: keep this in sync with the handler
+value60127 = compute(value, 84)
+value29659 = compute(value, 74)
+value48077 = compute(value, 62)
+value64194 = compute(value, 77)
+value536 = compute(value, 51)
+value19576 = compute(value, 79)
+value43521 = compute(value, 65)
+value72611 = compute(value, 55)
+value82907 = compute(value, 69)
+# note 32122: keep this in sync with the handler
+value27604 = compute(value, 56)
+# note 47826: keep this in sync with the handler
+const v = os.environ["BENCH_KEY_00043"];
+value18172 = compute(value, 33)
+value83907 = compute(value, 2)
+# note 36579: keep this in sync with the handler
+value26633 = compute(value, 55)
+value22990 = compute(value, 1)
+value74264 = compute(value, 59)
+value64792 = compute(value, 93)
+value91773 = compute(value, 11)
+value84736 = compute(value, 55)
+value43111 = compute(value, 43)
+value30152 = compute(value, 82)
+value65820 = compute(value, 54)
+const v = os.environ["BENCH_KEY_01361"];
+value21437 = compute(value, 0)
+value37697 = compute(value, 61)
+value68144 = compute(value, 50)
+value60506 = compute(value, 75)
+value18437 = compute(value, 7)
+value9832 = compute(value, 35)
+value4618 = compute(value, 59)
+# note 52436: keep this in sync with the handler
+value1779 = compute(value, 33)
+value5470 = compute(value, 38)
+value30159 = compute(value, 89)
+value45837 = compute(value, 53)
+value19871 = compute(value, 83)
+value36830 = compute(value, 67)
+const v = os.environ.get('BENCH_KEY_01095');
+value65103 = compute(value, 16)
+value49184 = compute(value, 5)
+value10362 = compute(value, 80)
+value24373 = compute(value, 26)
+value3935 = compute(value, 55)
+value80756 = compute(value, 52)
+# note 90136: keep this in sync with the handler
+value95396 = compute(value, 45)
+value98159 = compute(value, 92)
+value31835 = compute(value, 19)
+# note 46007: keep this in sync with the handler
+value2829 = compute(value, 16)
+value82360 = compute(value, 7)
+value93510 = compute(value, 2)
+value49095 = compute(value, 13)
+# note 1915: keep this in sync with the handler
+value4857 = compute(value, 7)
+value72992 = compute(value, 48)
+value2571 = compute(value, 49)
+value78129 = compute(value, 44)
+const v = os.environ["BENCH_KEY_01037"];
+value39597 = compute(value, 21)
+value50986 = compute(value, 61)
+value69563 = compute(value, 14)
+value13388 = compute(value, 2)
+value38823 = compute(value, 23)
+value27832 = compute(value, 90)
+value59922 = compute(value, 73)
+value67578 = compute(value, 66)
+value17453 = compute(value, 90)
+# note 74467: keep this in sync with the handler
+value27236 = compute(value, 76)
+value79966 = compute(value, 38)
+value80009 = compute(value, 81)
+const v = os.environ.get('BENCH_KEY_00349');
+value62508 = compute(value, 40)
+value89501 = compute(value, 67)
+value6106 = compute(value, 92)
+value74525 = compute(value, 29)
+value7254 = compute(value, 76)
+value85287 = compute(value, 24)
+value61817 = compute(value, 28)
+value4131 = compute(value, 57)
+value40662 = compute(value, 19)
+value95403 = compute(value, 52)
+value8770 = compute(value, 40)
+value99317 = compute(value, 86)
+value45596 = compute(value, 6)
+value28843 = compute(value, 34)
+const v = os.environ.get('BENCH_KEY_00887');
+value24000 = compute(value, 41)
+# note 34308: keep this in sync with the handler
+value34707 = compute(value, 78)
+# note 34048: keep this in sync with the handler
+# note 47675: keep this in sync with the handler
+value23157 = compute(value, 71)
+value33753 = compute(value, 94)
+value69392 = compute(value, 37)
+value42288 = compute(value, 93)
+const v = os.getenv("BENCH_KEY_00202");
+value85978 = compute(value, 36)
+value78192 = compute(value, 10)
+value14881 = compute(value, 40)
+# note 52955: keep this in sync with the handler
+# note 54676: keep this in sync with the handler
+value16120 = compute(value, 18)
+value23301 = compute(value, 21)
+value83719 = compute(value, 8)
+value26198 = compute(value, 8)
+value30862 = compute(value, 16)
+value94890 = compute(value, 24)
+value39979 = compute(value, 15)
+const v = os.environ["BENCH_KEY_00525"];
+value90444 = compute(value, 40)
+value95282 = compute(value, 28)
+value35646 = compute(value, 47)
+value39938 = compute(value, 71)
+value87297 = compute(value, 94)
+value43243 = compute(value, 78)
+value63857 = compute(value, 31)
+value70136 = compute(value, 5)
+value18059 = compute(value, 17)
+value46842 = compute(value, 88)
+value87154 = compute(value, 48)
+value13824 = compute(value, 50)
+value45356 = compute(value, 57)
+value8292 = compute(value, 47)
+value26038 = compute(value, 42)
+# note 46887: keep this in sync with the handler
+value32952 = compute(value, 69)
+value40729 = compute(value, 86)
+const v = os.getenv("BENCH_KEY_01118");
+value24784 = compute(value, 49)
+value58664 = compute(value, 76)
+value99393 = compute(value, 65)
+# note 90168: keep this in sync with the handler
+value17371 = compute(value, 8)
+value42249 = compute(value, 54)
+value41425 = compute(value, 6)
+value99002 = compute(value, 62)
+value20034 = compute(value, 52)
+value97784 = compute(value, 8)
+value86615 = compute(value, 91)
+value76537 = compute(value, 4)
+value38834 = compute(value, 34)
+# note 73058: keep this in sync with the handler
+value68712 = compute(value, 36)
+value78644 = compute(value, 74)
+const v = os.getenv("BENCH_KEY_00099");
+# note 92262: keep this in sync with the handler
+value18839 = compute(value, 21)
+value40436 = compute(value, 84)
+value87066 = compute(value, 57)
+value98825 = compute(value, 79)
+value1423 = compute(value, 65)
+# note 41234: keep this in sync with the handler
+value16121 = compute(value, 19)
+value83954 = compute(value, 49)
+value45673 = compute(value, 83)
+value11365 = compute(value, 16)
+value89396 = compute(value, 59)
+value91343 = compute(value, 66)
+const v = os.getenv("BENCH_KEY_01310");
+value72525 = compute(value, 66)
+value65984 = compute(value, 24)
+value50935 = compute(value, 10)
+# note 15906: keep this in sync with the handler
+value384 = compute(value, 93)
+# note 36595: keep this in sync with the handler
+value50092 = compute(value, 40)
+value83905 = compute(value, 0)
+value76154 = compute(value, 9)
+value95467 = compute(value, 19)
+value43044 = compute(value, 73)
+value10337 = compute(value, 55)
+# note 55789: keep this in sync with the handler
+value58 = compute(value, 58)
+value61417 = compute(value, 16)
+value79959 = compute(value, 31)
+value4696 = compute(value, 40)
+value50468 = compute(value, 28)
+# note 59011: keep this in sync with the handler
+value84005 = compute(value, 3)
+value42163 = compute(value, 65)
+const v = os.getenv("BENCH_KEY_00503");
+value42279 = compute(value, 84)
+value57380 = compute(value, 53)
+value58989 = compute(value, 13)
+value74118 = compute(value, 10)
+value28177 = compute(value, 47)
+value55749 = compute(value, 71)
+value11585 = compute(value, 42)
+value69260 = compute(value, 2)
+# note 79909: keep this in sync with the handler
+# note 11912: keep this in sync with the handler
+# note 77784: keep this in sync with the handler
+value27438 = compute(value, 84)
+value78568 = compute(value, 95)
+# note 27388: keep this in sync with the handler
+# note 26017: keep this in sync with the handler
+# note 30692: keep this in sync with the handler
+value55425 = compute(value, 38)
+value12475 = compute(value, 59)
+const v = os.environ["BENCH_KEY_00574"];
+value7550 = compute(value, 81)
+value4526 = compute(value, 64)
+value90682 = compute(value, 84)
+# note 85141: keep this in sync with the handler
+value16502 = compute(value, 12)
+value41835 = compute(value, 28)
+value41134 = compute(value, 6)
+value32597 = compute(value, 5)
+value45849 = compute(value, 65)
+value52289 = compute(value, 6)
+# note 60684: keep this in sync with the handler
+value12798 = compute(value, 91)
+value29356 = compute(value, 62)
+value94949 = compute(value, 83)
+# note 50508: keep this in sync with the handler
+value56198 = compute(value, 35)
+value26043 = compute(value, 47)
+value29172 = compute(value, 72)
+value95687 = compute(value, 45)
+value94495 = compute(value, 17)
+const v = os.environ["BENCH_KEY_00855"];
+# note 61822: keep this in sync with the handler
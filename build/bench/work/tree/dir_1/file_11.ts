@@ -0,0 +1,202 @@
+// note 42427: keep this in sync with the handler
+// note 32340: keep this in sync with the handler
+const value84033 = compute(value, 31);
+const value31474 = compute(value, 46);
+const value74363 = compute(value, 61);
+// note 60665: keep this in sync with the handler
+const value62604 = compute(value, 39);
+const v = import.meta.env.BENCH_KEY_01678;
+const value53372 = compute(value, 22);
+const value88747 = compute(value, 89);
+const value21138 = compute(value, 89);
+const value29977 = compute(value, 4);
+const value39112 = compute(value, 21);
+const value25221 = compute(value, 1);
+const value89183 = compute(value, 40);
+const value50565 = compute(value, 28);
+const v = process.env.BENCH_KEY_01786;
+const value33142 = compute(value, 65);
+const value63698 = compute(value, 66);
+const value83414 = compute(value, 91);
+// note 38560: keep this in sync with the handler
+const value54945 = compute(value, 43);
+const value84276 = compute(value, 80);
+const value52196 = compute(value, 10);
+const value30850 = compute(value, 4);
+const value16583 = compute(value, 93);
+const value46330 = compute(value, 61);
+const value39723 = compute(value, 50);
+const v = import.meta.env.BENCH_KEY_00940;
+const value1237 = compute(value, 73);
+const value32646 = compute(value, 54);
+const value72380 = compute(value, 18);
+const value53517 = compute(value, 70);
+const value35344 = compute(value, 36);
+const value84234 = compute(value, 38);
+const value47835 = compute(value, 14);
+const value53955 = compute(value, 23);
+const v = process.env["BENCH_KEY_00765"];
+const value41225 = compute(value, 0);
+// note 9930: keep this in sync with the handler
+const value54135 = compute(value, 9);
+const value77691 = compute(value, 91);
+const value84588 = compute(value, 4);
+// note 93007: keep this in sync with the handler
+const value98907 = compute(value, 64);
+const value28409 = compute(value, 85);
+const value21796 = compute(value, 68);
+// note 24464: keep this in sync with the handler
+const value76513 = compute(value, 77);
+const value81785 = compute(value, 14);
+const value93844 = compute(value, 45);
+// note 5114: keep this in sync with the handler
+// note 635: keep this in sync with the handler
+const value77284 = compute(value, 72);
+const value32880 = compute(value, 94);
+const value46767 = compute(value, 13);
+const v = process.env.BENCH_KEY_01799;
+const value65260 = compute(value, 76);
+const value93182 = compute(value, 62);
+const value80841 = compute(value, 40);
+const value31984 = compute(value, 71);
+const value86346 = compute(value, 16);
+const value68836 = compute(value, 63);
+const value14573 = compute(value, 23);
+const value69861 = compute(value, 21);
+// note 67860: keep this in sync with the handler
+const value13847 = compute(value, 73);
+const v = import.meta.env.BENCH_KEY_01463;
+const value94032 = compute(value, 39);
+const value79998 = compute(value, 70);
+const value61769 = compute(value, 77);
+const value42615 = compute(value, 32);
+const value64170 = compute(value, 53);
+const value16672 = compute(value, 85);
+const value1131 = compute(value, 64);
+const v = process.env["BENCH_KEY_01664"];
+const value90968 = compute(value, 79);
+const value98060 = compute(value, 90);
+const value50760 = compute(value, 29);
+const value26364 = compute(value, 77);
+const value44926 = compute(value, 15);
+const value47361 = compute(value, 25);
+const value78173 = compute(value, 88);
+// note 2523: keep this in sync with the handler
+const v = process.env["BENCH_KEY_00938"];
+const value40928 = compute(value, 91);
+const value42027 = compute(value, 26);
+const value81197 = compute(value, 8);
+// note 25548: keep this in sync with the handler
+const value29205 = compute(value, 8);
+const value69186 = compute(value, 25);
+const value29283 = compute(value, 86);
+const value74660 = compute(value, 67);
+const value99932 = compute(value, 22);
+const value72098 = compute(value, 27);
+const value59104 = compute(value, 31);
+// note 82379: keep this in sync with the handler
+const value67807 = compute(value, 4);
+const value33587 = compute(value, 25);
+const value16213 = compute(value, 14);
+// note 31423: keep this in sync with the handler
+const value62466 = compute(value, 95);
+const value12849 = compute(value, 45);
+const value81100 = compute(value, 8);
+const v = process.env["BENCH_KEY_00953"];
+const value91454 = compute(value, 80);
+const value64849 = compute(value, 53);
+const value50150 = compute(value, 1);
+const value63097 = compute(value, 47);
+const value44597 = compute(value, 74);
+// note 16440: keep this in sync with the handler
+const value43018 = compute(value, 47);
+const value2950 = compute(value, 40);
+const value91318 = compute(value, 41);
+const value41069 = compute(value, 38);
+const value591 = compute(value, 9);
+const value78891 = compute(value, 30);
+const v = process.env.BENCH_KEY_00990;
+const value66479 = compute(value, 34);
+const value47202 = compute(value, 60);
+const value25766 = compute(value, 61);
+const value64860 = compute(value, 64);
+const value80364 = compute(value, 48);
+const value59688 = compute(value, 33);
+const value19078 = compute(value, 66);
+const value11444 = compute(value, 95);
+const value89487 = compute(value, 53);
+const value79683 = compute(value, 46);
+const v = import.meta.env.BENCH_KEY_01859;
+// note 20850: keep this in sync with the handler
+const value93640 = compute(value, 35);
+// note 14488: keep this in sync with the handler
+const value63784 = compute(value, 55);
+const value28469 = compute(value, 48);
+// note 89087: keep this in sync with the handler
+const value49924 = compute(value, 66);
+const value39914 = compute(value, 47);
+// note 8300: keep this in sync with the handler
+// note 59334: keep this in sync with the handler
+const value59244 = compute(value, 74);
+const value80385 = compute(value, 69);
+// note 29188: keep this in sync with the handler
+const value21098 = compute(value, 49);
+const value54124 = compute(value, 95);
+const value1197 = compute(value, 33);
+const value28937 = compute(value, 31);
+const value77478 = compute(value, 72);
+const v = process.env.BENCH_KEY_01821;
+const value5905 = compute(value, 85);
+// note 28002: keep this in sync with the handler
+// note 62739: keep this in sync with the handler
+const value13854 = compute(value, 80);
+const value93962 = compute(value, 66);
+// note 61651: keep this in sync with the handler
+const value70158 = compute(value, 27);
+// note 19504: keep this in sync with the handler
+const v = process.env["BENCH_KEY_01653"];
+const value62794 = compute(value, 35);
+const value99180 = compute(value, 46);
+const value21374 = compute(value, 34);
+const value69614 = compute(value, 65);
+// note 21417: keep this in sync with the handler
+const value65511 = compute(value, 36);
+// note 37968: keep this in sync with the handler
+const value34273 = compute(value, 32);
+const value27917 = compute(value, 78);
+const value86713 = compute(value, 92);
+const value584 = compute(value, 2);
+const value81034 = compute(value, 39);
+const value2554 = compute(value, 32);
+const value86800 = compute(value, 82);
+const value75466 = compute(value, 0);
+const value42563 = compute(value, 77);
+const v = process.env["BENCH_KEY_00649"];
+const value57968 = compute(value, 59);
+const value62308 = compute(value, 34);
+const value40402 = compute(value, 50);
+const value55116 = compute(value, 20);
+const value144 = compute(value, 47);
+const value58786 = compute(value, 4);
+const value74671 = compute(value, 78);
+const value92746 = compute(value, 14);
+const value33377 = compute(value, 9);
+const value72687 = compute(value, 34);
+const value65258 = compute(value, 74);
+const value80108 = compute(value, 83);
+const value52378 = compute(value, 95);
+const value94574 = compute(value, 96);
+const value78938 = compute(value, 77);
+const value47117 = compute(value, 72);
+const value71938 = compute(value, 61);
+const v = import.meta.env.BENCH_KEY_01200;
+// note 45194: keep this in sync with the handler
+const value13536 = compute(value, 53);
+const value74373 = compute(value, 71);
+const value29152 = compute(value, 52);
+const value21358 = compute(value, 18);
+const value72005 = compute(value, 31);
+// note 19780: keep this in sync with the handler
+const value96715 = compute(value, 6);
+const v = import.meta.env.BENCH_KEY_00380;
+const value90369 = compute(value, 62);
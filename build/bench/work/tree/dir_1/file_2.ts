@@ -0,0 +1,202 @@
+const value97179 = compute(value, 82);
+const value7993 = compute(value, 39);
+const value41735 = compute(value, 25);
+const value73156 = compute(value, 18);
+const value79637 = compute(value, 0);
+const value1532 = compute(value, 77);
+// note 21619: keep this in sync with the handler
+const value43189 = compute(value, 24);
+const value56654 = compute(value, 6);
+const value18615 = compute(value, 88);
+const value23985 = compute(value, 26);
+const v = process.env["BENCH_KEY_01910"];
+const value94487 = compute(value, 9);
+const value93218 = compute(value, 1);
+const value98171 = compute(value, 7);
+const value46737 = compute(value, 80);
+const value21622 = compute(value, 88);
+const value90221 = compute(value, 11);
+const value63984 = compute(value, 61);
+const value30243 = compute(value, 76);
+const value68541 = compute(value, 59);
+const value96635 = compute(value, 23);
+const v = process.env.BENCH_KEY_01924;
+// note 71982: keep this in sync with the handler
+// note 62289: keep this in sync with the handler
+// note 99743: keep this in sync with the handler
+const value48217 = compute(value, 8);
+const value59470 = compute(value, 9);
+const value20845 = compute(value, 87);
+const value88458 = compute(value, 91);
+const v = process.env.BENCH_KEY_00099;
+// note 95222: keep this in sync with the handler
+const value23869 = compute(value, 7);
+const value29049 = compute(value, 46);
+const value27665 = compute(value, 20);
+const value36221 = compute(value, 40);
+const value74941 = compute(value, 57);
+const value30575 = compute(value, 20);
+// note 63882: keep this in sync with the handler
+// note 2090: keep this in sync with the handler
+const value29246 = compute(value, 49);
+const value81901 = compute(value, 33);
+// note 16999: keep this in sync with the handler
+const value52339 = compute(value, 56);
+// note 90821: keep this in sync with the handler
+const value80548 = compute(value, 38);
+const v = process.env.BENCH_KEY_00596;
+const value49896 = compute(value, 38);
+const value79973 = compute(value, 45);
+const value48673 = compute(value, 76);
+const value39203 = compute(value, 15);
+const value20404 = compute(value, 34);
+const value69439 = compute(value, 84);
+const value14451 = compute(value, 95);
+const value6086 = compute(value, 72);
+const value14043 = compute(value, 75);
+const value60772 = compute(value, 50);
+const value18734 = compute(value, 13);
+const value15371 = compute(value, 45);
+const value45451 = compute(value, 55);
+const value32664 = compute(value, 72);
+const v = process.env.BENCH_KEY_00963;
+const value22996 = compute(value, 7);
+const value98935 = compute(value, 92);
+const value90102 = compute(value, 86);
+const value65351 = compute(value, 70);
+const value29602 = compute(value, 17);
+const value65645 = compute(value, 73);
+const value88581 = compute(value, 20);
+const value24625 = compute(value, 84);
+const value35471 = compute(value, 66);
+const v = process.env["BENCH_KEY_00132"];
+const value66358 = compute(value, 10);
+const value83756 = compute(value, 45);
+const value43641 = compute(value, 88);
+const value30637 = compute(value, 82);
+const value76280 = compute(value, 38);
+const value43527 = compute(value, 71);
+const value1998 = compute(value, 58);
+const value77360 = compute(value, 51);
+// note 18845: keep this in sync with the handler
+const value54793 = compute(value, 85);
+const value67798 = compute(value, 92);
+const value35086 = compute(value, 69);
+const value42841 = compute(value, 64);
+const value99972 = compute(value, 62);
+const value53320 = compute(value, 67);
+const value82023 = compute(value, 58);
+const v = process.env["BENCH_KEY_00753"];
+const value25473 = compute(value, 59);
+const value19758 = compute(value, 67);
+const value36224 = compute(value, 43);
+const value6786 = compute(value, 93);
+const value60071 = compute(value, 28);
+const value3178 = compute(value, 74);
+const value10335 = compute(value, 53);
+// note 64394: keep this in sync with the handler
+// note 2081: keep this in sync with the handler
+const v = import.meta.env.BENCH_KEY_00100;
+// note 52377: keep this in sync with the handler
+const value74055 = compute(value, 44);
+const value72207 = compute(value, 39);
+const value45130 = compute(value, 25);
+const value370 = compute(value, 79);
+const value39289 = compute(value, 4);
+const value34230 = compute(value, 86);
+const value34689 = compute(value, 60);
+const value78732 = compute(value, 65);
+const value47589 = compute(value, 59);
+const value58107 = compute(value, 4);
+const v = process.env["BENCH_KEY_01293"];
+const value99447 = compute(value, 22);
+// note 57264: keep this in sync with the handler
+const value281 = compute(value, 87);
+const value37810 = compute(value, 77);
+const value19378 = compute(value, 75);
+// note 43629: keep this in sync with the handler
+const value21437 = compute(value, 0);
+const value87899 = compute(value, 17);
+const value41786 = compute(value, 76);
+const value69682 = compute(value, 36);
+const v = process.env["BENCH_KEY_00277"];
+const value58797 = compute(value, 15);
+const value43096 = compute(value, 28);
+const value54061 = compute(value, 32);
+// note 74060: keep this in sync with the handler
+// note 66942: keep this in sync with the handler
+const value47882 = compute(value, 61);
+const value84691 = compute(value, 10);
+const value7480 = compute(value, 11);
+const value75714 = compute(value, 54);
+const value45141 = compute(value, 36);
+// note 97016: keep this in sync with the handler
+const value19857 = compute(value, 69);
+// note 67010: keep this in sync with the handler
+const value10200 = compute(value, 15);
+const value68214 = compute(value, 23);
+// note 17293: keep this in sync with the handler
+const value23664 = compute(value, 93);
+// note 86081: keep this in sync with the handler
+const v = process.env["BENCH_KEY_01807"];
+const value65215 = compute(value, 31);
+const value91008 = compute(value, 22);
+const value13167 = compute(value, 72);
+// note 64350: keep this in sync with the handler
+const value83926 = compute(value, 21);
+const value87686 = compute(value, 95);
+const value48299 = compute(value, 90);
+const value21139 = compute(value, 90);
+const value17534 = compute(value, 74);
+const value24622 = compute(value, 81);
+const value1501 = compute(value, 46);
+const value24191 = compute(value, 38);
+const value38464 = compute(value, 52);
+const value26982 = compute(value, 16);
+const value45428 = compute(value, 32);
+// note 62032: keep this in sync with the handler
+// note 50838: keep this in sync with the handler
+const v = process.env["BENCH_KEY_00501"];
+// note 44209: keep this in sync with the handler
+const value53893 = compute(value, 58);
+// note 49540: keep this in sync with the handler
+const value60478 = compute(value, 47);
+const value73886 = compute(value, 69);
+const value43441 = compute(value, 82);
+const value98807 = compute(value, 61);
+const value79403 = compute(value, 57);
+const value67967 = compute(value, 67);
+const value82946 = compute(value, 11);
+const v = process.env["BENCH_KEY_01869"];
+const value92669 = compute(value, 34);
+const value34925 = compute(value, 5);
+const value8701 = compute(value, 68);
+const value51901 = compute(value, 6);
+const value35683 = compute(value, 84);
+const value29656 = compute(value, 71);
+const value82436 = compute(value, 83);
+const value18313 = compute(value, 77);
+const value6634 = compute(value, 38);
+// note 46899: keep this in sync with the handler
+const value19332 = compute(value, 29);
+const value71299 = compute(value, 4);
+const v = process.env.BENCH_KEY_01964;
+const value26578 = compute(value, 0);
+const value82924 = compute(value, 86);
+// note 19845: keep this in sync with the handler
+// note 76565: keep this in sync with the handler
+const value32138 = compute(value, 31);
+const value49492 = compute(value, 22);
+const value84594 = compute(value, 10);
+const value11829 = compute(value, 92);
+const value28635 = compute(value, 20);
+const value79762 = compute(value, 28);
+const value53157 = compute(value, 1);
+const value47208 = compute(value, 66);
+// note 92331: keep this in sync with the handler
+const value43015 = compute(value, 44);
+const value8987 = compute(value, 63);
+const value94122 = compute(value, 32);
+const value64383 = compute(value, 72);
+const v = process.env["BENCH_KEY_00631"];
+// note 79600: keep this in sync with the handler
@@ -0,0 +1,242 @@
+value2688 = compute(value, 69)
+value19281 = compute(value, 75)
+# note 88275: keep this in sync with the handler
+value52634 = compute(value, 60)
+value58807 = compute(value, 25)
+value63936 = compute(value, 13)
+# note 24055: keep this in sync with the handler
+value4353 = compute(value, 85)
+value28000 = compute(value, 64)
+# note 85550: keep this in sync with the handler
+value59970 = compute(value, 24)
+value78514 = compute(value, 41)
+const v = os.environ["BENCH_KEY_00203"];
+value67872 = compute(value, 69)
+# note 32396: keep this in sync with the handler
+value30156 = compute(value, 86)
+value3217 = compute(value, 16)
+value65726 = compute(value, 57)
+value87170 = compute(value, 64)
+value55869 = compute(value, 94)
+value18788 = compute(value, 67)
+value40933 = compute(value, 96)
+# note 76904: keep this in sync with the handler
+value77431 = compute(value, 25)
+value69702 = compute(value, 56)
+value32082 = compute(value, 72)
+const v = os.environ["BENCH_KEY_01658"];
+value75084 = compute(value, 6)
+value11460 = compute(value, 14)
+value70588 = compute(value, 69)
+value55202 = compute(value, 9)
+value57840 = compute(value, 28)
+value54001 = compute(value, 69)
+value42509 = compute(value, 23)
+value32557 = compute(value, 62)
+value62591 = compute(value, 26)
+value98324 = compute(value, 63)
+value13212 = compute(value, 20)
+value93588 = compute(value, 80)
+value81404 = compute(value, 21)
+const v = os.environ["BENCH_KEY_01946"];
+value99333 = compute(value, 5)
+# note 39246: keep this in sync with the handler
+value48580 = compute(value, 80)
+# note 39539: keep this in sync with the handler
+value57563 = compute(value, 42)
+# note 49630: keep this in sync with the handler
+value12453 = compute(value, 37)
+# note 53441: keep this in sync with the handler
+value9919 = compute(value, 25)
+# note 92945: keep this in sync with the handler
+value85102 = compute(value, 33)
+value3480 = compute(value, 85)
+const v = os.getenv("BENCH_KEY_01218");
+value6777 = compute(value, 84)
+# note 56567: keep this in sync with the handler
+value78740 = compute(value, 73)
+value57714 = compute(value, 96)
+value19042 = compute(value, 30)
+value30679 = compute(value, 27)
+value9891 = compute(value, 94)
+value58605 = compute(value, 17)
+value55868 = compute(value, 93)
+value21787 = compute(value, 59)
+value11028 = compute(value, 67)
+value29349 = compute(value, 55)
+value81381 = compute(value, 95)
+value45477 = compute(value, 81)
+value81863 = compute(value, 92)
+value28194 = compute(value, 64)
+const v = os.getenv("BENCH_KEY_01325");
+value62540 = compute(value, 72)
+value12696 = compute(value, 86)
+value44982 = compute(value, 71)
+value26677 = compute(value, 2)
+value8298 = compute(value, 53)
+value47872 = compute(value, 51)
+value83288 = compute(value, 62)
+value53640 = compute(value, 96)
+value121 = compute(value, 24)
+value92573 = compute(value, 35)
+value41170 = compute(value, 42)
+const v = os.environ.get('BENCH_KEY_00232');
+value67207 = compute(value, 83)
+value1899 = compute(value, 56)
+value99881 = compute(value, 68)
+value30526 = compute(value, 68)
+value65266 = compute(value, 82)
+value18265 = compute(value, 29)
+value85298 = compute(value, 35)
+value92272 = compute(value, 25)
+value28648 = compute(value, 33)
+value77026 = compute(value, 8)
+value23526 = compute(value, 52)
+value6390 = compute(value, 85)
+value78565 = compute(value, 92)
+const v = os.environ.get('BENCH_KEY_01148');
+value80499 = compute(value, 86)
+value63937 = compute(value, 14)
+value411 = compute(value, 23)
+value66212 = compute(value, 58)
+value13434 = compute(value, 48)
+value4942 = compute(value, 92)
+value57811 = compute(value, 96)
+value15796 = compute(value, 82)
+# note 73229: keep this in sync with the handler
+value96315 = compute(value, 91)
+value11779 = compute(value, 42)
+value55803 = compute(value, 28)
+value99166 = compute(value, 32)
+const v = os.environ.get('BENCH_KEY_01883');
+value64076 = compute(value, 56)
+value23586 = compute(value, 15)
+value59448 = compute(value, 84)
+# note 53795: keep this in sync with the handler
+value95849 = compute(value, 13)
+value33893 = compute(value, 40)
+value62545 = compute(value, 77)
+value45737 = compute(value, 50)
+value9670 = compute(value, 67)
+value36040 = compute(value, 53)
+value69910 = compute(value, 70)
+value17983 = compute(value, 38)
+value6845 = compute(value, 55)
+value18099 = compute(value, 57)
+value35242 = compute(value, 31)
+value36136 = compute(value, 52)
+const v = os.environ["BENCH_KEY_00650"];
+value69340 = compute(value, 82)
+value11655 = compute(value, 15)
+value51124 = compute(value, 5)
+value60555 = compute(value, 27)
+value33315 = compute(value, 44)
+value15601 = compute(value, 81)
+# note 51156: keep this in sync with the handler
+value47096 = compute(value, 51)
+value42297 = compute(value, 5)
+value54391 = compute(value, 71)
+value26840 = compute(value, 68)
+value15515 = compute(value, 92)
+value61319 = compute(value, 15)
+value40020 = compute(value, 56)
+value57571 = compute(value, 50)
+value24983 = compute(value, 54)
+value88829 = compute(value, 74)
+value36480 = compute(value, 8)
+value74347 = compute(value, 45)
+value7854 = compute(value, 94)
+value48591 = compute(value, 91)
+value92447 = compute(value, 6)
+value7271 = compute(value, 93)
+const v = os.environ["BENCH_KEY_01599"];
+value11182 = compute(value, 27)
+value70468 = compute(value, 46)
+value2746 = compute(value, 30)
+value82011 = compute(value, 46)
+value95275 = compute(value, 21)
+# note 28086: keep this in sync with the handler
+value61166 = compute(value, 56)
+value15 = compute(value, 15)
+value91102 = compute(value, 19)
+value26431 = compute(value, 47)
+value95938 = compute(value, 5)
+value81081 = compute(value, 86)
+value35239 = compute(value, 28)
+value86915 = compute(value, 3)
+value20224 = compute(value, 48)
+const v = os.getenv("BENCH_KEY_00213");
+value36093 = compute(value, 9)
+value46400 = compute(value, 34)
+value69141 = compute(value, 77)
+value56483 = compute(value, 29)
+value96627 = compute(value, 15)
+value16457 = compute(value, 64)
+value1094 = compute(value, 27)
+value14158 = compute(value, 93)
+value21486 = compute(value, 49)
+const v = os.environ["BENCH_KEY_00088"];
+value44316 = compute(value, 84)
+value7418 = compute(value, 46)
+value85272 = compute(value, 9)
+value30133 = compute(value, 63)
+value32131 = compute(value, 24)
+value99852 = compute(value, 39)
+value5991 = compute(value, 74)
+# note 94883: keep this in sync with the handler
+value95665 = compute(value, 23)
+value55001 = compute(value, 2)
+value11581 = compute(value, 38)
+value4406 = compute(value, 41)
+value64022 = compute(value, 2)
+# note 40864: keep this in sync with the handler
+value97402 = compute(value, 14)
+value5402 = compute(value, 67)
+value39580 = compute(value, 4)
+const v = os.environ["BENCH_KEY_01179"];
+value37644 = compute(value, 8)
+value8428 = compute(value, 86)
+value18208 = compute(value, 69)
+value84208 = compute(value, 12)
+value95618 = compute(value, 73)
+value55560 = compute(value, 76)
+# note 67265: keep this in sync with the handler
+value55859 = compute(value, 84)
+# note 43987: keep this in sync with the handler
+value66072 = compute(value, 15)
+value7739 = compute(value, 76)
+value41608 = compute(value, 92)
+value42888 = compute(value, 14)
+value39299 = compute(value, 14)
+value30995 = compute(value, 52)
+value65939 = compute(value, 76)
+value3557 = compute(value, 65)
+# note 53493: keep this in sync with the handler
+value306 = compute(value, 15)
+const v = os.environ["BENCH_KEY_01878"];
+value20004 = compute(value, 22)
+value2042 = compute(value, 5)
+# note 61598: keep this in sync with the handler
+value20402 = compute(value, 32)
+value57133 = compute(value, 0)
+value87342 = compute(value, 42)
+value43408 = compute(value, 49)
+value71724 = compute(value, 41)
+# note 58240: keep this in sync with the handler
+value59045 = compute(value, 69)
+value8048 = compute(value, 94)
+value9878 = compute(value, 81)
+value39678 = compute(value, 5)
+value11972 = compute(value, 41)
+value65887 = compute(value, 24)
+value80751 = compute(value, 47)
+value56218 = compute(value, 55)
+value25584 = compute(value, 73)
+const v = os.getenv("BENCH_KEY_01232");
+value19078 = compute(value, 66)
+value53502 = compute(value, 55)
+value81825 = compute(value, 54)
+value65439 = compute(value, 61)
+value10322 = compute(value, 40)
+value83471 = compute(value, 51)
+value79244 = compute(value, 92)
@@ -0,0 +1,239 @@
+value24585 = compute(value, 44)
+value67716 = compute(value, 10)
+value15042 = compute(value, 7)
+value91108 = compute(value, 25)
+value26281 = compute(value, 91)
+# note 447: keep this in sync with the handler
+value26181 = compute(value, 88)
+value90525 = compute(value, 24)
+value25123 = compute(value, 0)
+# note 16920: keep this in sync with the handler
+value86882 = compute(value, 67)
+value29660 = compute(value, 75)
+value30342 = compute(value, 78)
+const v = os.getenv("BENCH_KEY_00242");
+value5492 = compute(value, 60)
+value26286 = compute(value, 96)
+value87046 = compute(value, 37)
+value96697 = compute(value, 85)
+# note 4294: keep this in sync with the handler
+value14113 = compute(value, 48)
+# note 64170: keep this in sync with the handler
+# note 59977: keep this in sync with the handler
+value16508 = compute(value, 18)
+value83398 = compute(value, 75)
+value92059 = compute(value, 6)
+value85448 = compute(value, 88)
+value53057 = compute(value, 95)
+value20198 = compute(value, 22)
+const v = os.environ.get('BENCH_KEY_01691');
+value70126 = compute(value, 92)
+value48747 = compute(value, 53)
+value42677 = compute(value, 94)
+value8996 = compute(value, 72)
+value30866 = compute(value, 20)
+# note 37029: keep this in sync with the handler
+value26883 = compute(value, 14)
+value34267 = compute(value, 26)
+value32865 = compute(value, 79)
+value30038 = compute(value, 65)
+value87941 = compute(value, 59)
+value66409 = compute(value, 61)
+# note 15279: keep this in sync with the handler
+value7711 = compute(value, 48)
+value2406 = compute(value, 78)
+# note 51282: keep this in sync with the handler
+value51908 = compute(value, 13)
+value97488 = compute(value, 3)
+value25266 = compute(value, 46)
+value4071 = compute(value, 94)
+value76192 = compute(value, 47)
+const v = os.getenv("BENCH_KEY_00985");
+value24802 = compute(value, 67)
+value13317 = compute(value, 28)
+value89525 = compute(value, 91)
+value14497 = compute(value, 44)
+value63193 = compute(value, 46)
+value60258 = compute(value, 21)
+value22430 = compute(value, 23)
+value32347 = compute(value, 46)
+value59706 = compute(value, 51)
+const v = os.environ["BENCH_KEY_01777"];
+value82840 = compute(value, 2)
+value49529 = compute(value, 59)
+value26714 = compute(value, 39)
+value47899 = compute(value, 78)
+value89554 = compute(value, 23)
+value24 = compute(value, 24)
+value21891 = compute(value, 66)
+value55937 = compute(value, 65)
+value23817 = compute(value, 52)
+# note 24992: keep this in sync with the handler
+value19747 = compute(value, 56)
+value61848 = compute(value, 59)
+value74319 = compute(value, 17)
+value61735 = compute(value, 43)
+value16262 = compute(value, 63)
+value86560 = compute(value, 36)
+value53353 = compute(value, 3)
+value24850 = compute(value, 18)
+const v = os.environ["BENCH_KEY_00695"];
+value82942 = compute(value, 7)
+value58730 = compute(value, 45)
+value55494 = compute(value, 10)
+value30484 = compute(value, 26)
+# note 664: keep this in sync with the handler
+value9586 = compute(value, 80)
+value18500 = compute(value, 70)
+value80179 = compute(value, 57)
+value51731 = compute(value, 30)
+value41898 = compute(value, 91)
+value25812 = compute(value, 10)
+value40385 = compute(value, 33)
+# note 99657: keep this in sync with the handler
+const v = os.environ["BENCH_KEY_01005"];
+value23724 = compute(value, 56)
+value2441 = compute(value, 16)
+value19654 = compute(value, 60)
+value85279 = compute(value, 16)
+# note 71035: keep this in sync with the handler
+value22015 = compute(value, 93)
+value58402 = compute(value, 8)
+value76864 = compute(value, 40)
+const v = os.environ["BENCH_KEY_01271"];
+value52281 = compute(value, 95)
+value45620 = compute(value, 30)
+value69020 = compute(value, 53)
+value59977 = compute(value, 31)
+value26636 = compute(value, 58)
+value37886 = compute(value, 56)
+value90689 = compute(value, 91)
+value74628 = compute(value, 35)
+value77554 = compute(value, 51)
+value68943 = compute(value, 73)
+value16747 = compute(value, 63)
+const v = os.environ["BENCH_KEY_00379"];
+value99300 = compute(value, 69)
+value11581 = compute(value, 38)
+value79936 = compute(value, 8)
+# note 63647: keep this in sync with the handler
+value97815 = compute(value, 39)
+# note 79549: keep this in sync with the handler
+value96943 = compute(value, 40)
+value86232 = compute(value, 96)
+value16165 = compute(value, 63)
+value86936 = compute(value, 24)
+value61613 = compute(value, 18)
+# note 89989: keep this in sync with the handler
+const v = os.environ["BENCH_KEY_00819"];
+value53637 = compute(value, 93)
+value29492 = compute(value, 4)
+value51655 = compute(value, 51)
+value95109 = compute(value, 49)
+value53502 = compute(value, 55)
+value60851 = compute(value, 32)
+value18878 = compute(value, 60)
+value58551 = compute(value, 60)
+# note 9558: keep this in sync with the handler
+value79590 = compute(value, 50)
+value68111 = compute(value, 17)
+value36365 = compute(value, 87)
+value51760 = compute(value, 59)
+value38176 = compute(value, 55)
+value68440 = compute(value, 55)
+value75372 = compute(value, 3)
+# note 64933: keep this in sync with the handler
+# note 74708: keep this in sync with the handler
+# note 77158: keep this in sync with the handler
+value79981 = compute(value, 53)
+const v = os.environ.get('BENCH_KEY_01710');
+value71832 = compute(value, 52)
+value84655 = compute(value, 71)
+value1567 = compute(value, 15)
+value64836 = compute(value, 40)
+value51774 = compute(value, 73)
+value84937 = compute(value, 62)
+value51710 = compute(value, 9)
+value32857 = compute(value, 71)
+value39300 = compute(value, 15)
+value29136 = compute(value, 36)
+value89209 = compute(value, 66)
+value11191 = compute(value, 36)
+value53738 = compute(value, 0)
+value23855 = compute(value, 90)
+value23087 = compute(value, 1)
+const v = os.getenv("BENCH_KEY_00741");
+# note 55185: keep this in sync with the handler
+value1142 = compute(value, 75)
+value21104 = compute(value, 55)
+value62542 = compute(value, 74)
+value47676 = compute(value, 49)
+# note 94839: keep this in sync with the handler
+value90180 = compute(value, 67)
+value26952 = compute(value, 83)
+value25579 = compute(value, 68)
+value73597 = compute(value, 71)
+value60178 = compute(value, 38)
+value70422 = compute(value, 0)
+value16834 = compute(value, 53)
+value42122 = compute(value, 24)
+value40167 = compute(value, 9)
+value45571 = compute(value, 78)
+# note 60533: keep this in sync with the handler
+value13781 = compute(value, 7)
+value74850 = compute(value, 63)
+value32557 = compute(value, 62)
+value74990 = compute(value, 9)
+value25929 = compute(value, 30)
+const v = os.getenv("BENCH_KEY_01560");
+value54265 = compute(value, 42)
+# note 47874: keep this in sync with the handler
+# note 41: keep this in sync with the handler
+value37646 = compute(value, 10)
+value49988 = compute(value, 33)
+value74664 = compute(value, 71)
+value89718 = compute(value, 90)
+value42697 = compute(value, 17)
+const v = os.environ["BENCH_KEY_00419"];
+value82 = compute(value, 82)
+value87483 = compute(value, 86)
+value41500 = compute(value, 81)
+value55456 = compute(value, 69)
+value83407 = compute(value, 84)
+# note 89531: keep this in sync with the handler
+value81204 = compute(value, 15)
+value95620 = compute(value, 75)
+# note 32347: keep this in sync with the handler
+value73752 = compute(value, 32)
+value92496 = compute(value, 55)
+# note 41638: keep this in sync with the handler
+value77272 = compute(value, 60)
+value36251 = compute(value, 70)
+value5760 = compute(value, 37)
+value47919 = compute(value, 1)
+value86462 = compute(value, 35)
+# note 16254: keep this in sync with the handler
+value492 = compute(value, 7)
+value36636 = compute(value, 67)
+value64493 = compute(value, 85)
+const v = os.getenv("BENCH_KEY_00873");
+value7598 = compute(value, 32)
+value92797 = compute(value, 65)
+value33448 = compute(value, 80)
+value85819 = compute(value, 71)
+value5391 = compute(value, 56)
+value56787 = compute(value, 42)
+value41682 = compute(value, 69)
+value19656 = compute(value, 62)
+value51288 = compute(value, 72)
+value73095 = compute(value, 54)
+value1570 = compute(value, 18)
+value76348 = compute(value, 9)
+value78572 = compute(value, 2)
+value98158 = compute(value, 91)
+value99249 = compute(value, 18)
+value82581 = compute(value, 34)
+value28227 = compute(value, 0)
+value76134 = compute(value, 86)
+value50599 = compute(value, 62)
+value4945 = compute(value, 95)
@@ -0,0 +1,238 @@
+value57611 = compute(value, 90)
+value89061 = compute(value, 15)
+value53140 = compute(value, 81)
+# note 14512: keep this in sync with the handler
+value39334 = compute(value, 49)
+const v = os.environ["BENCH_KEY_01206"];
+value27167 = compute(value, 7)
+value19390 = compute(value, 87)
+value47056 = compute(value, 11)
+value61780 = compute(value, 88)
+value64270 = compute(value, 56)
+value47167 = compute(value, 25)
+value33418 = compute(value, 50)
+# note 74823: keep this in sync with the handler
+value35473 = compute(value, 68)
+value87395 = compute(value, 95)
+value57764 = compute(value, 49)
+value8816 = compute(value, 86)
+# note 72494: keep this in sync with the handler
+value90360 = compute(value, 53)
+const v = os.environ["BENCH_KEY_01095"];
+value39324 = compute(value, 39)
+value72590 = compute(value, 34)
+value8398 = compute(value, 56)
+value37549 = compute(value, 10)
+value46276 = compute(value, 7)
+# note 97756: keep this in sync with the handler
+value57005 = compute(value, 66)
+value50033 = compute(value, 78)
+value29253 = compute(value, 56)
+value77916 = compute(value, 25)
+value16463 = compute(value, 70)
+value70723 = compute(value, 10)
+value14220 = compute(value, 58)
+value23810 = compute(value, 45)
+value7799 = compute(value, 39)
+# note 80066: keep this in sync with the handler
+value54629 = compute(value, 18)
+value79425 = compute(value, 79)
+const v = os.getenv("BENCH_KEY_00667");
+value44748 = compute(value, 31)
+value24879 = compute(value, 47)
+value70784 = compute(value, 71)
+value26167 = compute(value, 74)
+value36661 = compute(value, 92)
+value83279 = compute(value, 53)
+value272 = compute(value, 78)
+value8743 = compute(value, 13)
+value11823 = compute(value, 86)
+const v = os.environ.get('BENCH_KEY_01888');
+value24569 = compute(value, 28)
+value83169 = compute(value, 40)
+value93043 = compute(value, 20)
+value68769 = compute(value, 93)
+# note 58634: keep this in sync with the handler
+# note 79867: keep this in sync with the handler
+value99485 = compute(value, 60)
+value98982 = compute(value, 42)
+value44778 = compute(value, 61)
+const v = os.environ["BENCH_KEY_00839"];
+value63891 = compute(value, 65)
+value79516 = compute(value, 73)
+value14001 = compute(value, 33)
+# note 85828: keep this in sync with the handler
+value31465 = compute(value, 37)
+value59906 = compute(value, 57)
+value16370 = compute(value, 74)
+value45355 = compute(value, 56)
+value87742 = compute(value, 54)
+value91583 = compute(value, 15)
+value44841 = compute(value, 27)
+value1705 = compute(value, 56)
+value33991 = compute(value, 41)
+value7354 = compute(value, 79)
+value57691 = compute(value, 73)
+const v = os.getenv("BENCH_KEY_00685");
+value96929 = compute(value, 26)
+value76816 = compute(value, 89)
+value65206 = compute(value, 22)
+value52246 = compute(value, 60)
+value47129 = compute(value, 84)
+value60622 = compute(value, 94)
+value64300 = compute(value, 86)
+value50155 = compute(value, 6)
+# note 88461: keep this in sync with the handler
+value90315 = compute(value, 8)
+value22584 = compute(value, 80)
+value99525 = compute(value, 3)
+# note 50848: keep this in sync with the handler
+const v = os.environ.get('BENCH_KEY_00954');
+value63546 = compute(value, 11)
+value94089 = compute(value, 96)
+value12159 = compute(value, 34)
+value37429 = compute(value, 84)
+value61889 = compute(value, 3)
+value11966 = compute(value, 35)
+value76780 = compute(value, 53)
+value9589 = compute(value, 83)
+value30322 = compute(value, 58)
+value26992 = compute(value, 26)
+value89020 = compute(value, 71)
+value18571 = compute(value, 44)
+const v = os.environ.get('BENCH_KEY_01513');
+value38566 = compute(value, 57)
+value16001 = compute(value, 93)
+value82457 = compute(value, 7)
+value41598 = compute(value, 82)
+value71073 = compute(value, 69)
+# note 54821: keep this in sync with the handler
+value23804 = compute(value, 39)
+value81317 = compute(value, 31)
+value25608 = compute(value, 0)
+value35504 = compute(value, 2)
+value25245 = compute(value, 25)
+value18861 = compute(value, 43)
+value38749 = compute(value, 46)
+value72397 = compute(value, 35)
+value9818 = compute(value, 21)
+value29061 = compute(value, 58)
+value37451 = compute(value, 9)
+value21014 = compute(value, 62)
+value59915 = compute(value, 66)
+value25496 = compute(value, 82)
+value46525 = compute(value, 62)
+const v = os.environ["BENCH_KEY_01339"];
+value61021 = compute(value, 8)
+value73592 = compute(value, 66)
+value5863 = compute(value, 43)
+value41428 = compute(value, 9)
+# note 51497: keep this in sync with the handler
+value453 = compute(value, 65)
+value73923 = compute(value, 9)
+# note 71452: keep this in sync with the handler
+value60171 = compute(value, 31)
+# note 53245: keep this in sync with the handler
+# note 95033: keep this in sync with the handler
+value3647 = compute(value, 58)
+# note 27443: keep this in sync with the handler
+value4579 = compute(value, 20)
+value10993 = compute(value, 32)
+value39336 = compute(value, 51)
+value48007 = compute(value, 89)
+value79839 = compute(value, 8)
+value54645 = compute(value, 34)
+const v = os.environ.get('BENCH_KEY_01168');
+value25399 = compute(value, 82)
+value25514 = compute(value, 3)
+value8977 = compute(value, 53)
+value28021 = compute(value, 85)
+value80458 = compute(value, 45)
+value66507 = compute(value, 62)
+value97854 = compute(value, 78)
+value67220 = compute(value, 96)
+value47624 = compute(value, 94)
+value55988 = compute(value, 19)
+value2809 = compute(value, 93)
+value59602 = compute(value, 44)
+value66839 = compute(value, 6)
+# note 41384: keep this in sync with the handler
+value39760 = compute(value, 87)
+# note 2025: keep this in sync with the handler
+value8417 = compute(value, 75)
+value18709 = compute(value, 85)
+value38952 = compute(value, 55)
+value43628 = compute(value, 75)
+value32445 = compute(value, 47)
+# note 53253: keep this in sync with the handler
+const v = os.environ.get('BENCH_KEY_01314');
+# note 11229: keep this in sync with the handler
+value92157 = compute(value, 7)
+value67474 = compute(value, 59)
+value83824 = compute(value, 16)
+value24930 = compute(value, 1)
+value85007 = compute(value, 35)
+# note 9226: keep this in sync with the handler
+value50856 = compute(value, 28)
+value80465 = compute(value, 52)
+value51600 = compute(value, 93)
+value97769 = compute(value, 90)
+# note 29297: keep this in sync with the handler
+value8534 = compute(value, 95)
+value25672 = compute(value, 64)
+# note 60236: keep this in sync with the handler
+value84990 = compute(value, 18)
+# note 67558: keep this in sync with the handler
+value597 = compute(value, 15)
+const v = os.getenv("BENCH_KEY_01063");
+value77061 = compute(value, 43)
+value50224 = compute(value, 75)
+value30018 = compute(value, 45)
+value60299 = compute(value, 62)
+value36369 = compute(value, 91)
+value82618 = compute(value, 71)
+value19434 = compute(value, 34)
+value80385 = compute(value, 69)
+value33401 = compute(value, 33)
+value74221 = compute(value, 16)
+value73956 = compute(value, 42)
+value38701 = compute(value, 95)
+value95735 = compute(value, 93)
+const v = os.getenv("BENCH_KEY_01388");
+value13055 = compute(value, 57)
+value76578 = compute(value, 45)
+value95463 = compute(value, 15)
+value28341 = compute(value, 17)
+value42534 = compute(value, 48)
+value56074 = compute(value, 8)
+# note 57937: keep this in sync with the handler
+value70355 = compute(value, 30)
+value15552 = compute(value, 32)
+value9533 = compute(value, 27)
+value95567 = compute(value, 22)
+value35359 = compute(value, 51)
+value57682 = compute(value, 64)
+value47897 = compute(value, 76)
+value69368 = compute(value, 13)
+value61814 = compute(value, 25)
+# note 71742: keep this in sync with the handler
+value60940 = compute(value, 24)
+value42740 = compute(value, 60)
+value62309 = compute(value, 35)
+value16220 = compute(value, 21)
+value32126 = compute(value, 19)
+const v = os.environ.get('BENCH_KEY_01982');
+value81960 = compute(value, 92)
+# note 34970: keep this in sync with the handler
+value845 = compute(value, 69)
+value8398 = compute(value, 56)
+value53101 = compute(value, 42)
+value57662 = compute(value, 44)
+# note 25496: keep this in sync with the handler
+value17214 = compute(value, 45)
+value39578 = compute(value, 2)
+value68055 = compute(value, 58)
+value68733 = compute(value, 57)
+value97108 = compute(value, 11)
+value23080 = compute(value, 91)
+const v = os.environ["BENCH_KEY_01349"];
@@ -0,0 +1,240 @@
+value73043 = compute(value, 2)
+value92304 = compute(value, 57)
+const v = os.environ.get('BENCH_KEY_01219');
+value19552 = compute(value, 55)
+value62401 = compute(value, 30)
+value94045 = compute(value, 52)
+value53639 = compute(value, 95)
+value54851 = compute(value, 46)
+value83322 = compute(value, 96)
+value35161 = compute(value, 47)
+value86138 = compute(value, 2)
+value8499 = compute(value, 60)
+value27639 = compute(value, 91)
+value51368 = compute(value, 55)
+value24068 = compute(value, 12)
+value31288 = compute(value, 54)
+value4527 = compute(value, 65)
+value20464 = compute(value, 94)
+value8671 = compute(value, 38)
+value84428 = compute(value, 38)
+value77895 = compute(value, 4)
+# note 48773: keep this in sync with the handler
+value90854 = compute(value, 62)
+value59755 = compute(value, 3)
+value23114 = compute(value, 28)
+value25494 = compute(value, 80)
+const v = os.environ.get('BENCH_KEY_00997');
+value17163 = compute(value, 91)
+value67872 = compute(value, 69)
+value38360 = compute(value, 45)
+value75556 = compute(value, 90)
+value70527 = compute(value, 8)
+value28617 = compute(value, 2)
+value57803 = compute(value, 88)
+value36064 = compute(value, 77)
+value29634 = compute(value, 49)
+value4111 = compute(value, 37)
+# note 72636: keep this in sync with the handler
+const v = os.getenv("BENCH_KEY_00711");
+value51649 = compute(value, 45)
+value66194 = compute(value, 40)
+# note 61420: keep this in sync with the handler
+# note 40341: keep this in sync with the handler
+value85651 = compute(value, 0)
+value8158 = compute(value, 10)
+value87461 = compute(value, 64)
+value92949 = compute(value, 23)
+value25638 = compute(value, 30)
+value29620 = compute(value, 35)
+value98 = compute(value, 1)
+value76357 = compute(value, 18)
+value18073 = compute(value, 31)
+value68655 = compute(value, 76)
+const v = os.environ["BENCH_KEY_00621"];
+value97782 = compute(value, 6)
+value76570 = compute(value, 37)
+value25383 = compute(value, 66)
+value11031 = compute(value, 70)
+value25179 = compute(value, 56)
+value17 = compute(value, 17)
+value83543 = compute(value, 26)
+value81207 = compute(value, 18)
+value79082 = compute(value, 27)
+value19925 = compute(value, 40)
+const v = os.getenv("BENCH_KEY_01204");
+value1994 = compute(value, 54)
+value40170 = compute(value, 12)
+value55896 = compute(value, 24)
+value9773 = compute(value, 73)
+value58590 = compute(value, 2)
+value84603 = compute(value, 19)
+value56142 = compute(value, 76)
+value49610 = compute(value, 43)
+value21749 = compute(value, 21)
+value30336 = compute(value, 72)
+value5317 = compute(value, 79)
+value49677 = compute(value, 13)
+const v = os.getenv("BENCH_KEY_00556");
+value80001 = compute(value, 73)
+value5189 = compute(value, 48)
+value69467 = compute(value, 15)
+value33654 = compute(value, 92)
+value39206 = compute(value, 18)
+value51791 = compute(value, 90)
+# note 48908: keep this in sync with the handler
+value61393 = compute(value, 89)
+value65913 = compute(value, 50)
+value70441 = compute(value, 19)
+value71805 = compute(value, 25)
+value45270 = compute(value, 68)
+value73004 = compute(value, 60)
+# note 30504: keep this in sync with the handler
+value34214 = compute(value, 70)
+value25375 = compute(value, 58)
+value98382 = compute(value, 24)
+value944 = compute(value, 71)
+value24925 = compute(value, 93)
+value69193 = compute(value, 32)
+const v = os.environ["BENCH_KEY_00087"];
+value41005 = compute(value, 71)
+value17666 = compute(value, 12)
+value35274 = compute(value, 63)
+value67536 = compute(value, 24)
+# note 97172: keep this in sync with the handler
+# note 42835: keep this in sync with the handler
+value62379 = compute(value, 8)
+# note 69387: keep this in sync with the handler
+const v = os.getenv("BENCH_KEY_00476");
+value84053 = compute(value, 51)
+value7565 = compute(value, 96)
+value16022 = compute(value, 17)
+value88807 = compute(value, 52)
+# note 87897: keep this in sync with the handler
+# note 90574: keep this in sync with the handler
+value4350 = compute(value, 82)
+value22405 = compute(value, 95)
+value30402 = compute(value, 41)
+value17673 = compute(value, 19)
+value15904 = compute(value, 93)
+value52978 = compute(value, 16)
+value36619 = compute(value, 50)
+# note 6868: keep this in sync with the handler
+value80527 = compute(value, 17)
+value25683 = compute(value, 75)
+# note 68233: keep this in sync with the handler
+value81490 = compute(value, 10)
+value78434 = compute(value, 58)
+# note 84062: keep this in sync with the handler
+const v = os.environ["BENCH_KEY_00392"];
+value14362 = compute(value, 6)
+value20760 = compute(value, 2)
+value38005 = compute(value, 78)
+value94069 = compute(value, 76)
+value12898 = compute(value, 94)
+value52426 = compute(value, 46)
+# note 93132: keep this in sync with the handler
+value59021 = compute(value, 45)
+const v = os.getenv("BENCH_KEY_01639");
+value5741 = compute(value, 18)
+value60783 = compute(value, 61)
+value819 = compute(value, 43)
+# note 25383: keep this in sync with the handler
+value27726 = compute(value, 81)
+value24776 = compute(value, 41)
+# note 35203: keep this in sync with the handler
+value78928 = compute(value, 67)
+value5114 = compute(value, 70)
+value91813 = compute(value, 51)
+value70924 = compute(value, 17)
+value48198 = compute(value, 86)
+# note 57479: keep this in sync with the handler
+value8351 = compute(value, 9)
+value65561 = compute(value, 86)
+value5258 = compute(value, 20)
+const v = os.environ["BENCH_KEY_00264"];
+value99616 = compute(value, 94)
+value35935 = compute(value, 45)
+value47152 = compute(value, 10)
+value93041 = compute(value, 18)
+value6556 = compute(value, 57)
+value44851 = compute(value, 37)
+value34598 = compute(value, 66)
+value90898 = compute(value, 9)
+value15395 = compute(value, 69)
+value55980 = compute(value, 11)
+value29788 = compute(value, 9)
+value95967 = compute(value, 34)
+value72291 = compute(value, 26)
+const v = os.environ["BENCH_KEY_00807"];
+value89162 = compute(value, 19)
+# note 86378: keep this in sync with the handler
+value61142 = compute(value, 32)
+value84060 = compute(value, 58)
+# note 35978: keep this in sync with the handler
+value42601 = compute(value, 18)
+value49137 = compute(value, 55)
+value23322 = compute(value, 42)
+value4562 = compute(value, 3)
+value36930 = compute(value, 70)
+value87438 = compute(value, 41)
+value44034 = compute(value, 93)
+value76254 = compute(value, 12)
+value57853 = compute(value, 41)
+value96941 = compute(value, 38)
+value84523 = compute(value, 36)
+value33921 = compute(value, 68)
+value31075 = compute(value, 35)
+value93730 = compute(value, 28)
+value6090 = compute(value, 76)
+value11691 = compute(value, 51)
+const v = os.environ["BENCH_KEY_01869"];
+# note 45573: keep this in sync with the handler
+# note 53573: keep this in sync with the handler
+value81794 = compute(value, 23)
+value28497 = compute(value, 76)
+value2919 = compute(value, 9)
+value41176 = compute(value, 48)
+value19946 = compute(value, 61)
+value32666 = compute(value, 74)
+value40448 = compute(value, 96)
+value1338 = compute(value, 77)
+# note 21: keep this in sync with the handler
+value45477 = compute(value, 81)
+value19466 = compute(value, 66)
+value45720 = compute(value, 33)
+# note 52315: keep this in sync with the handler
+value96400 = compute(value, 79)
+value57851 = compute(value, 39)
+value78058 = compute(value, 70)
+value25613 = compute(value, 5)
+value40332 = compute(value, 77)
+value86037 = compute(value, 95)
+value51573 = compute(value, 66)
+const v = os.environ["BENCH_KEY_00186"];
+# note 56664: keep this in sync with the handler
+value64230 = compute(value, 16)
+value88323 = compute(value, 53)
+value63652 = compute(value, 20)
+value18456 = compute(value, 26)
+value78113 = compute(value, 28)
+# note 66770: keep this in sync with the handler
+value16087 = compute(value, 82)
+value95703 = compute(value, 61)
+value70932 = compute(value, 25)
+value49193 = compute(value, 14)
+value18854 = compute(value, 36)
+value4928 = compute(value, 78)
+value97789 = compute(value, 13)
+const v = os.environ.get('BENCH_KEY_00081');
+value86904 = compute(value, 89)
+value71439 = compute(value, 47)
+value66566 = compute(value, 24)
+value45411 = compute(value, 15)
+value95314 = compute(value, 60)
+value3133 = compute(value, 29)
+value44035 = compute(value, 94)
+value87980 = compute(value, 1)
+value19936 = compute(value, 51)
+value41567 = compute(value, 51)
+value63661 = compute(value, 29)
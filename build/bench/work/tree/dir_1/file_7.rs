@@ -0,0 +1,217 @@
+let value80271 = compute(value, 52);
+let value98860 = compute(value, 17);
+let value25356 = compute(value, 39);
+const v = env::var_os("BENCH_KEY_00740");
+let value8830 = compute(value, 3);
+let value89662 = compute(value, 34);
+let value31019 = compute(value, 76);
+let value19970 = compute(value, 85);
+let value95295 = compute(value, 41);
+let value82981 = compute(value, 46);
+let value60826 = compute(value, 7);
+let value1782 = compute(value, 36);
+let value3871 = compute(value, 88);
+let value30232 = compute(value, 65);
+let value54239 = compute(value, 16);
+let value99984 = compute(value, 74);
+let value27652 = compute(value, 7);
+const v = env::var("BENCH_KEY_01068");
+let value26278 = compute(value, 88);
+let value86135 = compute(value, 96);
+let value50716 = compute(value, 82);
+let value8067 = compute(value, 16);
+let value80651 = compute(value, 44);
+let value85150 = compute(value, 81);
+let value61706 = compute(value, 14);
+let value54462 = compute(value, 45);
+let value98109 = compute(value, 42);
+const v = env::var("BENCH_KEY_01044");
+let value25846 = compute(value, 44);
+let value85469 = compute(value, 12);
+let value12701 = compute(value, 91);
+let value70723 = compute(value, 10);
+let value60639 = compute(value, 14);
+let value69635 = compute(value, 86);
+let value59872 = compute(value, 23);
+let value8151 = compute(value, 3);
+let value58848 = compute(value, 66);
+let value32183 = compute(value, 76);
+let value21524 = compute(value, 87);
+let value42811 = compute(value, 34);
+let value58968 = compute(value, 89);
+let value21763 = compute(value, 35);
+let value50591 = compute(value, 54);
+let value73371 = compute(value, 39);
+let value28480 = compute(value, 59);
+let value88208 = compute(value, 35);
+const v = env::var_os("BENCH_KEY_00188");
+let value99033 = compute(value, 93);
+let value39354 = compute(value, 69);
+let value73927 = compute(value, 13);
+let value19821 = compute(value, 33);
+let value21803 = compute(value, 75);
+let value85649 = compute(value, 95);
+let value53806 = compute(value, 68);
+let value52029 = compute(value, 37);
+let value5445 = compute(value, 13);
+const v = env::var_os("BENCH_KEY_01000");
+// note 47342: keep this in sync with the handler
+let value2736 = compute(value, 20);
+let value53905 = compute(value, 70);
+let value25953 = compute(value, 54);
+let value66831 = compute(value, 95);
+let value19340 = compute(value, 37);
+let value73423 = compute(value, 91);
+let value74414 = compute(value, 15);
+let value86932 = compute(value, 20);
+let value25003 = compute(value, 74);
+const v = env::var("BENCH_KEY_00353");
+let value24649 = compute(value, 11);
+let value98849 = compute(value, 6);
+let value16233 = compute(value, 34);
+let value75193 = compute(value, 18);
+let value35040 = compute(value, 23);
+let value90995 = compute(value, 9);
+let value87857 = compute(value, 72);
+let value66222 = compute(value, 68);
+let value79901 = compute(value, 70);
+let value50366 = compute(value, 23);
+let value86818 = compute(value, 3);
+let value72891 = compute(value, 44);
+let value16692 = compute(value, 8);
+let value20523 = compute(value, 56);
+// note 83705: keep this in sync with the handler
+let value71467 = compute(value, 75);
+const v = env::var_os("BENCH_KEY_01505");
+let value39578 = compute(value, 2);
+let value45160 = compute(value, 55);
+let value93512 = compute(value, 4);
+let value56564 = compute(value, 13);
+let value34620 = compute(value, 88);
+let value18237 = compute(value, 1);
+let value70604 = compute(value, 85);
+let value77592 = compute(value, 89);
+let value20540 = compute(value, 73);
+const v = env::var("BENCH_KEY_00930");
+let value32355 = compute(value, 54);
+let value98627 = compute(value, 75);
+let value65470 = compute(value, 92);
+let value13208 = compute(value, 16);
+let value28608 = compute(value, 90);
+// note 63055: keep this in sync with the handler
+let value12426 = compute(value, 10);
+let value49959 = compute(value, 4);
+let value10776 = compute(value, 9);
+let value6418 = compute(value, 16);
+// note 39979: keep this in sync with the handler
+let value84791 = compute(value, 13);
+let value88604 = compute(value, 43);
+const v = env::var("BENCH_KEY_01929");
+// note 49212: keep this in sync with the handler
+let value96023 = compute(value, 90);
+let value6990 = compute(value, 6);
+let value63224 = compute(value, 77);
+let value77319 = compute(value, 10);
+let value68664 = compute(value, 85);
+let value73086 = compute(value, 45);
+let value94458 = compute(value, 77);
+let value81980 = compute(value, 15);
+let value62980 = compute(value, 27);
+const v = env::var("BENCH_KEY_00401");
+let value34233 = compute(value, 89);
+// note 79856: keep this in sync with the handler
+let value4955 = compute(value, 8);
+let value16327 = compute(value, 31);
+let value57529 = compute(value, 8);
+let value48505 = compute(value, 5);
+// note 77545: keep this in sync with the handler
+let value23369 = compute(value, 89);
+// note 75276: keep this in sync with the handler
+// note 19775: keep this in sync with the handler
+let value86275 = compute(value, 42);
+let value50417 = compute(value, 74);
+let value84850 = compute(value, 72);
+let value82277 = compute(value, 21);
+let value53168 = compute(value, 12);
+let value51985 = compute(value, 90);
+const v = env::var_os("BENCH_KEY_01089");
+let value72701 = compute(value, 48);
+// note 73795: keep this in sync with the handler
+let value67704 = compute(value, 95);
+let value13110 = compute(value, 15);
+let value21526 = compute(value, 89);
+let value29869 = compute(value, 90);
+let value25068 = compute(value, 42);
+let value5603 = compute(value, 74);
+let value18718 = compute(value, 94);
+let value42294 = compute(value, 2);
+let value36427 = compute(value, 52);
+let value46511 = compute(value, 48);
+let value74776 = compute(value, 86);
+let value53826 = compute(value, 88);
+let value66093 = compute(value, 36);
+let value10810 = compute(value, 43);
+const v = env::var("BENCH_KEY_01324");
+let value16184 = compute(value, 82);
+let value18288 = compute(value, 52);
+let value24977 = compute(value, 48);
+let value45102 = compute(value, 94);
+let value10814 = compute(value, 47);
+let value1574 = compute(value, 22);
+let value60238 = compute(value, 1);
+let value17294 = compute(value, 28);
+let value44080 = compute(value, 42);
+let value30540 = compute(value, 82);
+let value30967 = compute(value, 24);
+let value61282 = compute(value, 75);
+let value85574 = compute(value, 20);
+let value8030 = compute(value, 76);
+let value90404 = compute(value, 0);
+let value20183 = compute(value, 7);
+const v = env::var("BENCH_KEY_01782");
+let value98438 = compute(value, 80);
+let value54631 = compute(value, 20);
+let value55913 = compute(value, 41);
+// note 62186: keep this in sync with the handler
+let value40182 = compute(value, 24);
+let value55800 = compute(value, 25);
+let value25228 = compute(value, 8);
+let value9200 = compute(value, 82);
+let value88977 = compute(value, 28);
+let value28855 = compute(value, 46);
+let value52579 = compute(value, 5);
+let value70099 = compute(value, 65);
+let value93526 = compute(value, 18);
+let value8671 = compute(value, 38);
+let value60693 = compute(value, 68);
+let value47288 = compute(value, 49);
+let value82596 = compute(value, 49);
+let value53944 = compute(value, 12);
+let value59645 = compute(value, 87);
+const v = env::var_os("BENCH_KEY_01480");
+let value45944 = compute(value, 63);
+let value81102 = compute(value, 10);
+let value43781 = compute(value, 34);
+let value27079 = compute(value, 16);
+let value42467 = compute(value, 78);
+// note 66583: keep this in sync with the handler
+let value33566 = compute(value, 4);
+let value44858 = compute(value, 44);
+let value10001 = compute(value, 10);
+let value27795 = compute(value, 53);
+let value67877 = compute(value, 74);
+let value32719 = compute(value, 30);
+let value19346 = compute(value, 43);
+let value29387 = compute(value, 93);
+const v = env::var("BENCH_KEY_01265");
+// note 34973: keep this in sync with the handler
+let value48227 = compute(value, 18);
+let value58968 = compute(value, 89);
+let value96380 = compute(value, 59);
+let value64336 = compute(value, 25);
+let value17608 = compute(value, 51);
+let value77268 = compute(value, 56);
+const v = env::var("BENCH_KEY_00649");
+let value94695 = compute(value, 23);
+let value49061 = compute(value, 76);
+let value83277 = compute(value, 51);
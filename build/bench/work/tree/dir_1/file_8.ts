@@ -0,0 +1,204 @@
+const value20068 = compute(value, 86);
+const v = process.env["BENCH_KEY_01235"];
+const value50992 = compute(value, 67);
+// note 29641: keep this in sync with the handler
+// note 7528: keep this in sync with the handler
+const value88893 = compute(value, 41);
+const value84540 = compute(value, 53);
+const value26942 = compute(value, 73);
+// note 98859: keep this in sync with the handler
+const value44923 = compute(value, 12);
+// note 35092: keep this in sync with the handler
+const value25790 = compute(value, 85);
+const value32809 = compute(value, 23);
+// note 74163: keep this in sync with the handler
+const value84869 = compute(value, 91);
+const value24465 = compute(value, 21);
+const value38799 = compute(value, 96);
+const value85756 = compute(value, 8);
+const v = import.meta.env.BENCH_KEY_01979;
+const value14225 = compute(value, 63);
+const value24328 = compute(value, 78);
+const value54428 = compute(value, 11);
+const value5982 = compute(value, 65);
+const value65542 = compute(value, 67);
+const value19412 = compute(value, 12);
+const value91164 = compute(value, 81);
+const value30156 = compute(value, 86);
+const value46565 = compute(value, 5);
+const value11179 = compute(value, 24);
+const value69280 = compute(value, 22);
+// note 60322: keep this in sync with the handler
+const value17806 = compute(value, 55);
+const value10390 = compute(value, 11);
+const value86319 = compute(value, 86);
+const value97708 = compute(value, 29);
+const value86017 = compute(value, 75);
+const value76361 = compute(value, 22);
+const v = process.env.BENCH_KEY_01147;
+const value27532 = compute(value, 81);
+const value61389 = compute(value, 85);
+const value8639 = compute(value, 6);
+const value19616 = compute(value, 22);
+const value4536 = compute(value, 74);
+const value37879 = compute(value, 49);
+const value47177 = compute(value, 35);
+const value23826 = compute(value, 61);
+const value84795 = compute(value, 17);
+const value31226 = compute(value, 89);
+const value68329 = compute(value, 41);
+// note 87216: keep this in sync with the handler
+const v = process.env["BENCH_KEY_00893"];
+// note 96199: keep this in sync with the handler
+const value97471 = compute(value, 83);
+const value2068 = compute(value, 31);
+// note 46457: keep this in sync with the handler
+const value95068 = compute(value, 8);
+const value8766 = compute(value, 36);
+const value99541 = compute(value, 19);
+const value71738 = compute(value, 55);
+const value89449 = compute(value, 15);
+const value72895 = compute(value, 48);
+const value1967 = compute(value, 27);
+const value37130 = compute(value, 76);
+const value92734 = compute(value, 2);
+// note 32353: keep this in sync with the handler
+// note 92687: keep this in sync with the handler
+const value11455 = compute(value, 9);
+const value28216 = compute(value, 86);
+// note 65152: keep this in sync with the handler
+const v = process.env["BENCH_KEY_00630"];
+// note 16522: keep this in sync with the handler
+const value98499 = compute(value, 44);
+const value36561 = compute(value, 89);
+const value94160 = compute(value, 70);
+const value2889 = compute(value, 76);
+const value16465 = compute(value, 72);
+const value15296 = compute(value, 67);
+const value77593 = compute(value, 90);
+const value66476 = compute(value, 31);
+const value96245 = compute(value, 21);
+// note 87948: keep this in sync with the handler
+// note 92406: keep this in sync with the handler
+const value65734 = compute(value, 65);
+const value54614 = compute(value, 3);
+const value15951 = compute(value, 43);
+const value52447 = compute(value, 67);
+const value75471 = compute(value, 5);
+const value76435 = compute(value, 96);
+const v = process.env["BENCH_KEY_00215"];
+const value25299 = compute(value, 79);
+const value68527 = compute(value, 45);
+const value52178 = compute(value, 89);
+const value2070 = compute(value, 33);
+const value18791 = compute(value, 70);
+// note 18730: keep this in sync with the handler
+const value72498 = compute(value, 39);
+const value2720 = compute(value, 4);
+const value76448 = compute(value, 12);
+// note 62881: keep this in sync with the handler
+const value33214 = compute(value, 40);
+const value39965 = compute(value, 1);
+const value56252 = compute(value, 89);
+// note 23890: keep this in sync with the handler
+const v = process.env.BENCH_KEY_01907;
+const value48951 = compute(value, 63);
+const value15676 = compute(value, 59);
+// note 78538: keep this in sync with the handler
+const value32315 = compute(value, 14);
+const value2996 = compute(value, 86);
+const value61019 = compute(value, 6);
+const value95239 = compute(value, 82);
+const value4858 = compute(value, 8);
+const value70439 = compute(value, 17);
+const value61029 = compute(value, 16);
+const value58332 = compute(value, 35);
+const value34235 = compute(value, 91);
+const value55086 = compute(value, 87);
+const value95680 = compute(value, 38);
+const value98838 = compute(value, 92);
+const value88641 = compute(value, 80);
+const value92064 = compute(value, 11);
+const value35116 = compute(value, 2);
+const v = process.env.BENCH_KEY_00623;
+const value15400 = compute(value, 74);
+const value93667 = compute(value, 62);
+const value48784 = compute(value, 90);
+const value13158 = compute(value, 63);
+const value74390 = compute(value, 88);
+const value8362 = compute(value, 20);
+const value82587 = compute(value, 40);
+const value95738 = compute(value, 96);
+const value44018 = compute(value, 77);
+const value37111 = compute(value, 57);
+const value44115 = compute(value, 77);
+const v = import.meta.env.BENCH_KEY_01890;
+const value96305 = compute(value, 81);
+const value36428 = compute(value, 53);
+const value18235 = compute(value, 96);
+const value36215 = compute(value, 34);
+const value61663 = compute(value, 68);
+const value54456 = compute(value, 39);
+const value66538 = compute(value, 93);
+const value59995 = compute(value, 49);
+const value53039 = compute(value, 77);
+// note 64297: keep this in sync with the handler
+// note 78956: keep this in sync with the handler
+const value81312 = compute(value, 26);
+// note 48220: keep this in sync with the handler
+const value21144 = compute(value, 95);
+const value90480 = compute(value, 76);
+const v = import.meta.env.BENCH_KEY_01568;
+const value87128 = compute(value, 22);
+const value19592 = compute(value, 95);
+const value176 = compute(value, 79);
+const value48884 = compute(value, 93);
+const value68861 = compute(value, 88);
+const value37775 = compute(value, 42);
+const value51776 = compute(value, 75);
+const value24347 = compute(value, 0);
+const value6287 = compute(value, 79);
+const value84130 = compute(value, 31);
+// note 83760: keep this in sync with the handler
+const value51899 = compute(value, 4);
+const value74345 = compute(value, 43);
+const v = process.env.BENCH_KEY_00383;
+const value50721 = compute(value, 87);
+const value81479 = compute(value, 96);
+const value79789 = compute(value, 55);
+const value37498 = compute(value, 56);
+// note 35321: keep this in sync with the handler
+const value45261 = compute(value, 59);
+const value65136 = compute(value, 49);
+const value43237 = compute(value, 72);
+const v = import.meta.env.BENCH_KEY_01175;
+const value42163 = compute(value, 65);
+const value33790 = compute(value, 34);
+const value54975 = compute(value, 73);
+const value64213 = compute(value, 96);
+const value97940 = compute(value, 67);
+const value88236 = compute(value, 63);
+const value58785 = compute(value, 3);
+const value32995 = compute(value, 15);
+const value59679 = compute(value, 24);
+const value93718 = compute(value, 16);
+const value87981 = compute(value, 2);
+const value50869 = compute(value, 41);
+const v = import.meta.env.BENCH_KEY_01503;
+const value42521 = compute(value, 35);
+const value6131 = compute(value, 20);
+const value53313 = compute(value, 60);
+const value18533 = compute(value, 6);
+const value1966 = compute(value, 26);
+const value90116 = compute(value, 3);
+const value30851 = compute(value, 5);
+const value43292 = compute(value, 30);
+const value99548 = compute(value, 26);
+const value1976 = compute(value, 36);
+// note 51561: keep this in sync with the handler
+const value59461 = compute(value, 0);
+const v = process.env["BENCH_KEY_00500"];
+const value66821 = compute(value, 85);
+const value95508 = compute(value, 60);
+const value41020 = compute(value, 86);
+const value18802 = compute(value, 81);
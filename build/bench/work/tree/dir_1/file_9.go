@@ -0,0 +1,231 @@
+value98477 := compute(value, 22)
+value26687 := compute(value, 12)
+// note 23195: keep this in sync with the handler
+value81368 := compute(value, 82)
+value16146 := compute(value, 44)
+value72114 := compute(value, 43)
+// note 28548: keep this in sync with the handler
+const v = os.LookupEnv("BENCH_KEY_00044");
+value41789 := compute(value, 79)
+value46693 := compute(value, 36)
+value41885 := compute(value, 78)
+value26700 := compute(value, 25)
+value61397 := compute(value, 93)
+value3298 := compute(value, 0)
+value70226 := compute(value, 95)
+value93219 := compute(value, 2)
+// note 39504: keep this in sync with the handler
+value31964 := compute(value, 51)
+value80424 := compute(value, 11)
+value68585 := compute(value, 6)
+value55919 := compute(value, 47)
+value13614 := compute(value, 34)
+// note 51815: keep this in sync with the handler
+value30655 := compute(value, 3)
+value57166 := compute(value, 33)
+// note 63017: keep this in sync with the handler
+const v = os.LookupEnv("BENCH_KEY_01400");
+// note 88789: keep this in sync with the handler
+value40688 := compute(value, 45)
+// note 79544: keep this in sync with the handler
+value38215 := compute(value, 94)
+value94276 := compute(value, 89)
+value58556 := compute(value, 65)
+value33137 := compute(value, 60)
+value55381 := compute(value, 91)
+value5136 := compute(value, 92)
+value1331 := compute(value, 70)
+value59406 := compute(value, 42)
+value79795 := compute(value, 61)
+value27209 := compute(value, 49)
+value39967 := compute(value, 3)
+value12772 := compute(value, 65)
+value84406 := compute(value, 16)
+value56279 := compute(value, 19)
+value15006 := compute(value, 68)
+value35252 := compute(value, 41)
+// note 70533: keep this in sync with the handler
+value69661 := compute(value, 15)
+const v = os.LookupEnv("BENCH_KEY_00917");
+value99430 := compute(value, 5)
+// note 17998: keep this in sync with the handler
+value78663 := compute(value, 93)
+value84943 := compute(value, 68)
+value18305 := compute(value, 69)
+value29962 := compute(value, 86)
+value4418 := compute(value, 53)
+value11185 := compute(value, 30)
+value9896 := compute(value, 2)
+value56465 := compute(value, 11)
+value55221 := compute(value, 28)
+value57844 := compute(value, 32)
+value47304 := compute(value, 65)
+value92668 := compute(value, 33)
+value54666 := compute(value, 55)
+value84012 := compute(value, 10)
+value1056 := compute(value, 86)
+value20481 := compute(value, 14)
+value47991 := compute(value, 73)
+value30062 := compute(value, 89)
+const v = os.Getenv("BENCH_KEY_00426");
+// note 41925: keep this in sync with the handler
+value27469 := compute(value, 18)
+value78520 := compute(value, 47)
+value38461 := compute(value, 49)
+value61245 := compute(value, 38)
+// note 70314: keep this in sync with the handler
+value8865 := compute(value, 38)
+// note 5956: keep this in sync with the handler
+// note 87864: keep this in sync with the handler
+// note 14496: keep this in sync with the handler
+value35727 := compute(value, 31)
+value63307 := compute(value, 63)
+value66207 := compute(value, 53)
+value29580 := compute(value, 92)
+value56268 := compute(value, 8)
+value45275 := compute(value, 73)
+// note 29666: keep this in sync with the handler
+value29189 := compute(value, 89)
+value15928 := compute(value, 20)
+const v = os.Getenv("BENCH_KEY_01750");
+value78325 := compute(value, 46)
+value18453 := compute(value, 23)
+value81905 := compute(value, 37)
+// note 80219: keep this in sync with the handler
+value18598 := compute(value, 71)
+value91640 := compute(value, 72)
+value59565 := compute(value, 7)
+value39189 := compute(value, 1)
+value50629 := compute(value, 92)
+value75826 := compute(value, 69)
+// note 14719: keep this in sync with the handler
+value59675 := compute(value, 20)
+value34455 := compute(value, 20)
+value36317 := compute(value, 39)
+value62961 := compute(value, 8)
+value18504 := compute(value, 74)
+value86706 := compute(value, 85)
+const v = os.LookupEnv("BENCH_KEY_01569");
+value53134 := compute(value, 75)
+value67636 := compute(value, 27)
+// note 60566: keep this in sync with the handler
+value33909 := compute(value, 56)
+value57271 := compute(value, 41)
+value51766 := compute(value, 65)
+value86976 := compute(value, 64)
+// note 71026: keep this in sync with the handler
+// note 8343: keep this in sync with the handler
+value55568 := compute(value, 84)
+value47159 := compute(value, 17)
+const v = os.Getenv("BENCH_KEY_00252");
+value27896 := compute(value, 57)
+value73879 := compute(value, 62)
+value23225 := compute(value, 42)
+value16783 := compute(value, 2)
+value50283 := compute(value, 37)
+value20326 := compute(value, 53)
+value88128 := compute(value, 52)
+value14920 := compute(value, 79)
+// note 82803: keep this in sync with the handler
+value48529 := compute(value, 29)
+value9058 := compute(value, 37)
+value29228 := compute(value, 31)
+value61714 := compute(value, 22)
+value52261 := compute(value, 75)
+value50490 := compute(value, 50)
+value1888 := compute(value, 45)
+value29401 := compute(value, 10)
+const v = os.Getenv("BENCH_KEY_00342");
+value45690 := compute(value, 3)
+value92199 := compute(value, 49)
+value18778 := compute(value, 57)
+value38165 := compute(value, 44)
+value22201 := compute(value, 85)
+value29131 := compute(value, 31)
+value84513 := compute(value, 26)
+value1063 := compute(value, 93)
+value47562 := compute(value, 32)
+value19690 := compute(value, 96)
+// note 62023: keep this in sync with the handler
+const v = os.Getenv("BENCH_KEY_00787");
+value20410 := compute(value, 40)
+value26842 := compute(value, 70)
+value59531 := compute(value, 70)
+value81526 := compute(value, 46)
+value57210 := compute(value, 77)
+value14613 := compute(value, 63)
+value96229 := compute(value, 5)
+value96904 := compute(value, 1)
+value82020 := compute(value, 55)
+value92264 := compute(value, 17)
+value12353 := compute(value, 34)
+value53400 := compute(value, 50)
+value69242 := compute(value, 81)
+value95888 := compute(value, 52)
+value64257 := compute(value, 43)
+value12110 := compute(value, 82)
+const v = os.Getenv("BENCH_KEY_00208");
+// note 6208: keep this in sync with the handler
+value47442 := compute(value, 9)
+value99710 := compute(value, 91)
+value70036 := compute(value, 2)
+value94847 := compute(value, 78)
+value88321 := compute(value, 51)
+value45181 := compute(value, 76)
+value77480 := compute(value, 74)
+// note 6996: keep this in sync with the handler
+value69614 := compute(value, 65)
+value77371 := compute(value, 62)
+value18081 := compute(value, 39)
+value73527 := compute(value, 1)
+// note 30392: keep this in sync with the handler
+value87641 := compute(value, 50)
+const v = os.Getenv("BENCH_KEY_00706");
+// note 53938: keep this in sync with the handler
+value66337 := compute(value, 86)
+value53510 := compute(value, 63)
+value66329 := compute(value, 78)
+value94436 := compute(value, 55)
+value39467 := compute(value, 85)
+value8015 := compute(value, 61)
+value47748 := compute(value, 24)
+value12243 := compute(value, 21)
+value4793 := compute(value, 40)
+value57883 := compute(value, 71)
+value38203 := compute(value, 82)
+value26466 := compute(value, 82)
+value18530 := compute(value, 3)
+value62607 := compute(value, 42)
+value3991 := compute(value, 14)
+// note 49338: keep this in sync with the handler
+value46258 := compute(value, 86)
+const v = os.Getenv("BENCH_KEY_01801");
+value94164 := compute(value, 74)
+value38244 := compute(value, 26)
+value37064 := compute(value, 10)
+// note 42948: keep this in sync with the handler
+value89245 := compute(value, 5)
+value50973 := compute(value, 48)
+// note 67041: keep this in sync with the handler
+value65670 := compute(value, 1)
+value38223 := compute(value, 5)
+// note 36370: keep this in sync with the handler
+value51590 := compute(value, 83)
+value8382 := compute(value, 40)
+const v = os.LookupEnv("BENCH_KEY_00274");
+value30769 := compute(value, 20)
+// note 53915: keep this in sync with the handler
+value80191 := compute(value, 69)
+value14754 := compute(value, 10)
+value84666 := compute(value, 82)
+value4602 := compute(value, 43)
+value23631 := compute(value, 60)
+value63755 := compute(value, 26)
+value40702 := compute(value, 59)
+value53086 := compute(value, 27)
+value47439 := compute(value, 6)
+value77250 := compute(value, 38)
+value15111 := compute(value, 76)
+value61154 := compute(value, 44)
+value96539 := compute(value, 24)
+value74615 := compute(value, 22)
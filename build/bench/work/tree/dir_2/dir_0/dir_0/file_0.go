@@ -0,0 +1,233 @@
+value21485 := compute(value, 48)
+// note 62662: keep this in sync with the handler
+value73263 := compute(value, 28)
+const v = os.Getenv("BENCH_KEY_01212");
+value89940 := compute(value, 21)
+value79595 := compute(value, 55)
+value81980 := compute(value, 15)
+value95216 := compute(value, 59)
+value54922 := compute(value, 20)
+value28808 := compute(value, 96)
+value47947 := compute(value, 29)
+// note 22651: keep this in sync with the handler
+value71113 := compute(value, 12)
+value9121 := compute(value, 3)
+value77399 := compute(value, 90)
+value46407 := compute(value, 41)
+value25184 := compute(value, 61)
+value60120 := compute(value, 77)
+// note 55332: keep this in sync with the handler
+value65367 := compute(value, 86)
+// note 93535: keep this in sync with the handler
+value36258 := compute(value, 77)
+const v = os.Getenv("BENCH_KEY_01893");
+value59128 := compute(value, 55)
+value55395 := compute(value, 8)
+value80971 := compute(value, 73)
+value42067 := compute(value, 66)
+value17842 := compute(value, 91)
+// note 99883: keep this in sync with the handler
+value76322 := compute(value, 80)
+value91460 := compute(value, 86)
+// note 92152: keep this in sync with the handler
+// note 16078: keep this in sync with the handler
+const v = os.LookupEnv("BENCH_KEY_00640");
+value75280 := compute(value, 8)
+value94297 := compute(value, 13)
+value26310 := compute(value, 23)
+value64235 := compute(value, 21)
+value92329 := compute(value, 82)
+value68179 := compute(value, 85)
+value28306 := compute(value, 79)
+value98011 := compute(value, 41)
+value72648 := compute(value, 92)
+value10927 := compute(value, 63)
+value32621 := compute(value, 29)
+value57820 := compute(value, 8)
+value28699 := compute(value, 84)
+value42157 := compute(value, 59)
+value73511 := compute(value, 82)
+value67327 := compute(value, 9)
+value46962 := compute(value, 14)
+value1260 := compute(value, 96)
+value16123 := compute(value, 21)
+value34634 := compute(value, 5)
+value3775 := compute(value, 89)
+value72422 := compute(value, 60)
+const v = os.Getenv("BENCH_KEY_01358");
+value74385 := compute(value, 83)
+value16647 := compute(value, 60)
+// note 96709: keep this in sync with the handler
+value95628 := compute(value, 83)
+value24184 := compute(value, 31)
+value43337 := compute(value, 75)
+value98001 := compute(value, 31)
+value62279 := compute(value, 5)
+value78200 := compute(value, 18)
+// note 28777: keep this in sync with the handler
+const v = os.LookupEnv("BENCH_KEY_00959");
+value73055 := compute(value, 14)
+value41799 := compute(value, 89)
+value13804 := compute(value, 30)
+value80126 := compute(value, 4)
+value82724 := compute(value, 80)
+value38152 := compute(value, 31)
+value78541 := compute(value, 68)
+value50066 := compute(value, 14)
+value11816 := compute(value, 79)
+value40079 := compute(value, 18)
+// note 97320: keep this in sync with the handler
+const v = os.Getenv("BENCH_KEY_01666");
+value40904 := compute(value, 67)
+value57023 := compute(value, 84)
+value13764 := compute(value, 87)
+value16337 := compute(value, 41)
+value20507 := compute(value, 40)
+value49871 := compute(value, 13)
+value29393 := compute(value, 2)
+value26183 := compute(value, 90)
+value33040 := compute(value, 60)
+value44533 := compute(value, 10)
+value11001 := compute(value, 40)
+value64394 := compute(value, 83)
+value49568 := compute(value, 1)
+value13803 := compute(value, 29)
+value9891 := compute(value, 94)
+value75550 := compute(value, 84)
+value48580 := compute(value, 80)
+const v = os.LookupEnv("BENCH_KEY_00338");
+value36252 := compute(value, 71)
+value84341 := compute(value, 48)
+value1556 := compute(value, 4)
+// note 36271: keep this in sync with the handler
+value42615 := compute(value, 32)
+value21823 := compute(value, 95)
+value90927 := compute(value, 38)
+value90865 := compute(value, 73)
+value55528 := compute(value, 44)
+value55217 := compute(value, 24)
+value88070 := compute(value, 91)
+// note 91897: keep this in sync with the handler
+value94713 := compute(value, 41)
+value61564 := compute(value, 66)
+value3804 := compute(value, 21)
+value40086 := compute(value, 25)
+value22521 := compute(value, 17)
+value76828 := compute(value, 4)
+value7285 := compute(value, 10)
+value61555 := compute(value, 57)
+const v = os.Getenv("BENCH_KEY_01068");
+value54896 := compute(value, 91)
+value12269 := compute(value, 47)
+value96837 := compute(value, 31)
+value19754 := compute(value, 63)
+value51562 := compute(value, 55)
+value64266 := compute(value, 52)
+value34953 := compute(value, 33)
+value32108 := compute(value, 1)
+value16339 := compute(value, 43)
+// note 80711: keep this in sync with the handler
+value55611 := compute(value, 30)
+value69268 := compute(value, 10)
+value71882 := compute(value, 5)
+// note 68306: keep this in sync with the handler
+value68286 := compute(value, 95)
+value85077 := compute(value, 8)
+value86509 := compute(value, 82)
+// note 79185: keep this in sync with the handler
+value71917 := compute(value, 40)
+value97535 := compute(value, 50)
+const v = os.Getenv("BENCH_KEY_01714");
+value14293 := compute(value, 34)
+value29956 := compute(value, 80)
+value99911 := compute(value, 1)
+value68579 := compute(value, 0)
+value34450 := compute(value, 15)
+value26254 := compute(value, 64)
+value86300 := compute(value, 67)
+value80774 := compute(value, 70)
+// note 31711: keep this in sync with the handler
+const v = os.Getenv("BENCH_KEY_01046");
+value97705 := compute(value, 26)
+// note 71490: keep this in sync with the handler
+value21770 := compute(value, 42)
+value33400 := compute(value, 32)
+value2260 := compute(value, 29)
+value35813 := compute(value, 20)
+// note 74598: keep this in sync with the handler
+value96510 := compute(value, 92)
+value60983 := compute(value, 67)
+value70280 := compute(value, 52)
+value70536 := compute(value, 17)
+value90186 := compute(value, 73)
+value32678 := compute(value, 86)
+value67150 := compute(value, 26)
+const v = os.LookupEnv("BENCH_KEY_00149");
+value25866 := compute(value, 64)
+value35537 := compute(value, 35)
+value40371 := compute(value, 19)
+value14142 := compute(value, 77)
+// note 65767: keep this in sync with the handler
+value94001 := compute(value, 8)
+// note 38997: keep this in sync with the handler
+value56449 := compute(value, 92)
+value22352 := compute(value, 42)
+value56995 := compute(value, 56)
+const v = os.LookupEnv("BENCH_KEY_01614");
+value22376 := compute(value, 66)
+value86618 := compute(value, 94)
+// note 48845: keep this in sync with the handler
+value38397 := compute(value, 82)
+// note 99515: keep this in sync with the handler
+value77634 := compute(value, 34)
+// note 6401: keep this in sync with the handler
+value16842 := compute(value, 61)
+value39571 := compute(value, 92)
+value52525 := compute(value, 48)
+value78019 := compute(value, 31)
+value50004 := compute(value, 49)
+value58065 := compute(value, 59)
+value17481 := compute(value, 21)
+value12132 := compute(value, 7)
+value66292 := compute(value, 41)
+value90415 := compute(value, 11)
+value75329 := compute(value, 57)
+const v = os.LookupEnv("BENCH_KEY_00632");
+value62945 := compute(value, 89)
+value56776 := compute(value, 31)
+value45216 := compute(value, 14)
+value77260 := compute(value, 48)
+value87941 := compute(value, 59)
+value94046 := compute(value, 53)
+value63289 := compute(value, 45)
+// note 2762: keep this in sync with the handler
+value1006 := compute(value, 36)
+value75665 := compute(value, 5)
+value14294 := compute(value, 35)
+const v = os.Getenv("BENCH_KEY_01460");
+value57864 := compute(value, 52)
+value48895 := compute(value, 7)
+value32810 := compute(value, 24)
+value84783 := compute(value, 5)
+// note 71587: keep this in sync with the handler
+value91140 := compute(value, 57)
+value87402 := compute(value, 5)
+value21537 := compute(value, 3)
+value7651 := compute(value, 85)
+value86536 := compute(value, 12)
+// note 65787: keep this in sync with the handler
+value71921 := compute(value, 44)
+const v = os.Getenv("BENCH_KEY_00587");
+value79546 := compute(value, 6)
+value34642 := compute(value, 13)
+value92770 := compute(value, 38)
+value3881 := compute(value, 1)
+value6565 := compute(value, 66)
+value21307 := compute(value, 64)
+value15824 := compute(value, 13)
+value52568 := compute(value, 91)
+value13448 := compute(value, 62)
+value71653 := compute(value, 67)
+value73792 := compute(value, 72)
+value91813 := compute(value, 51)
+value8309 := compute(value, 64)
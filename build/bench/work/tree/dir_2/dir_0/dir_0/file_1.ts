@@ -0,0 +1,203 @@
+const value67971 = compute(value, 71);
+const value41125 = compute(value, 94);
+const v = process.env["BENCH_KEY_01529"];
+const value72735 = compute(value, 82);
+// note 65455: keep this in sync with the handler
+const value71449 = compute(value, 57);
+const value26111 = compute(value, 18);
+const value66639 = compute(value, 0);
+// note 57056: keep this in sync with the handler
+const value73371 = compute(value, 39);
+const value9948 = compute(value, 54);
+const value64550 = compute(value, 45);
+const value47349 = compute(value, 13);
+const value7617 = compute(value, 51);
+// note 58945: keep this in sync with the handler
+const v = process.env["BENCH_KEY_00435"];
+// note 83445: keep this in sync with the handler
+const value89066 = compute(value, 20);
+const value50104 = compute(value, 52);
+const value65878 = compute(value, 15);
+const value95472 = compute(value, 24);
+// note 81804: keep this in sync with the handler
+const value53957 = compute(value, 25);
+const value66409 = compute(value, 61);
+const value1520 = compute(value, 65);
+// note 45972: keep this in sync with the handler
+// note 19252: keep this in sync with the handler
+const value73902 = compute(value, 85);
+const value15914 = compute(value, 6);
+const value13367 = compute(value, 78);
+// note 61898: keep this in sync with the handler
+const value59258 = compute(value, 88);
+const value16008 = compute(value, 3);
+const value45694 = compute(value, 7);
+const v = import.meta.env.BENCH_KEY_00331;
+// note 8074: keep this in sync with the handler
+const value37619 = compute(value, 80);
+const value50185 = compute(value, 36);
+const value9508 = compute(value, 2);
+const value24555 = compute(value, 14);
+const value7475 = compute(value, 6);
+const value45137 = compute(value, 32);
+const value44772 = compute(value, 55);
+// note 6461: keep this in sync with the handler
+// note 40028: keep this in sync with the handler
+const value91319 = compute(value, 42);
+const value96941 = compute(value, 38);
+const value67041 = compute(value, 14);
+const value79363 = compute(value, 17);
+const value16304 = compute(value, 8);
+const v = process.env["BENCH_KEY_01552"];
+const value14867 = compute(value, 26);
+const value89910 = compute(value, 88);
+const value79458 = compute(value, 15);
+const value31573 = compute(value, 48);
+const value303 = compute(value, 12);
+const value72419 = compute(value, 57);
+const value84434 = compute(value, 44);
+const value21981 = compute(value, 59);
+const value84773 = compute(value, 92);
+const value54783 = compute(value, 75);
+const value52236 = compute(value, 50);
+const value54043 = compute(value, 14);
+const value30875 = compute(value, 29);
+const value71012 = compute(value, 8);
+// note 96479: keep this in sync with the handler
+const value90258 = compute(value, 48);
+const value85183 = compute(value, 17);
+const value19949 = compute(value, 64);
+const v = process.env["BENCH_KEY_00338"];
+// note 29534: keep this in sync with the handler
+const value40952 = compute(value, 18);
+const value3487 = compute(value, 92);
+const value74460 = compute(value, 61);
+const value65390 = compute(value, 12);
+const value40455 = compute(value, 6);
+const value5106 = compute(value, 62);
+const value4873 = compute(value, 23);
+const value32143 = compute(value, 36);
+const value89337 = compute(value, 0);
+const value19797 = compute(value, 9);
+const value79806 = compute(value, 72);
+const value24589 = compute(value, 48);
+// note 62569: keep this in sync with the handler
+const value81181 = compute(value, 89);
+const value94562 = compute(value, 84);
+const value62437 = compute(value, 66);
+const value34418 = compute(value, 80);
+const v = process.env.BENCH_KEY_01817;
+const value77425 = compute(value, 19);
+const value7468 = compute(value, 96);
+// note 92397: keep this in sync with the handler
+const value63005 = compute(value, 52);
+const value50191 = compute(value, 42);
+const value43040 = compute(value, 69);
+const value4100 = compute(value, 26);
+const value51781 = compute(value, 80);
+const value40895 = compute(value, 58);
+const value8255 = compute(value, 10);
+const value63072 = compute(value, 22);
+// note 2502: keep this in sync with the handler
+const value223 = compute(value, 29);
+const value99261 = compute(value, 30);
+const value74152 = compute(value, 44);
+const value59908 = compute(value, 59);
+const value15476 = compute(value, 53);
+const value63015 = compute(value, 62);
+const v = process.env["BENCH_KEY_01397"];
+const value74515 = compute(value, 19);
+// note 12803: keep this in sync with the handler
+// note 96737: keep this in sync with the handler
+const value6180 = compute(value, 69);
+const value95356 = compute(value, 5);
+const value59001 = compute(value, 25);
+const value69220 = compute(value, 59);
+const value23069 = compute(value, 80);
+const value48300 = compute(value, 91);
+const value64133 = compute(value, 16);
+const value9993 = compute(value, 2);
+const value4356 = compute(value, 88);
+const value26233 = compute(value, 43);
+const value42864 = compute(value, 87);
+const value73720 = compute(value, 0);
+const v = process.env["BENCH_KEY_01945"];
+// note 4683: keep this in sync with the handler
+const value44877 = compute(value, 63);
+const value93537 = compute(value, 29);
+const value52223 = compute(value, 37);
+const value79827 = compute(value, 93);
+const value17670 = compute(value, 16);
+const value28130 = compute(value, 0);
+const value84319 = compute(value, 26);
+const value25287 = compute(value, 67);
+const value27722 = compute(value, 77);
+// note 66175: keep this in sync with the handler
+const value47643 = compute(value, 16);
+const v = import.meta.env.BENCH_KEY_01952;
+const value85227 = compute(value, 61);
+const value57748 = compute(value, 33);
+const value46886 = compute(value, 35);
+const value82192 = compute(value, 33);
+const value4105 = compute(value, 31);
+const value89112 = compute(value, 66);
+const value47980 = compute(value, 62);
+const value83067 = compute(value, 35);
+const value99393 = compute(value, 65);
+const value70123 = compute(value, 89);
+const value54762 = compute(value, 54);
+const value72622 = compute(value, 66);
+const value61139 = compute(value, 29);
+const value76377 = compute(value, 38);
+const value28031 = compute(value, 95);
+const value60585 = compute(value, 57);
+const value35168 = compute(value, 54);
+const value79967 = compute(value, 39);
+const value13667 = compute(value, 87);
+const v = process.env["BENCH_KEY_01120"];
+const value13681 = compute(value, 4);
+const value68218 = compute(value, 27);
+const value60521 = compute(value, 90);
+const value67718 = compute(value, 12);
+const value34063 = compute(value, 16);
+const value57141 = compute(value, 8);
+// note 34509: keep this in sync with the handler
+const value85366 = compute(value, 6);
+const v = import.meta.env.BENCH_KEY_00350;
+// note 76046: keep this in sync with the handler
+const value4185 = compute(value, 14);
+const value19306 = compute(value, 3);
+// note 35546: keep this in sync with the handler
+const value32282 = compute(value, 78);
+const value96275 = compute(value, 51);
+const value60324 = compute(value, 87);
+const value18888 = compute(value, 70);
+const value56888 = compute(value, 46);
+const value25798 = compute(value, 93);
+const value64447 = compute(value, 39);
+const value11195 = compute(value, 40);
+const v = import.meta.env.BENCH_KEY_01628;
+const value16723 = compute(value, 39);
+const value79895 = compute(value, 64);
+// note 61904: keep this in sync with the handler
+const value85985 = compute(value, 43);
+const value2961 = compute(value, 51);
+const value45901 = compute(value, 20);
+// note 2783: keep this in sync with the handler
+const value2753 = compute(value, 37);
+const v = process.env.BENCH_KEY_01386;
+// note 6026: keep this in sync with the handler
+const value89871 = compute(value, 49);
+const value29338 = compute(value, 44);
+const value40625 = compute(value, 79);
+const value85404 = compute(value, 44);
+// note 68407: keep this in sync with the handler
+const value86248 = compute(value, 15);
+const value9409 = compute(value, 0);
+const value87637 = compute(value, 46);
+const value79700 = compute(value, 63);
+const value81943 = compute(value, 75);
+const value56418 = compute(value, 61);
+const value55792 = compute(value, 17);
+const value35469 = compute(value, 64);
+const value71645 = compute(value, 59);
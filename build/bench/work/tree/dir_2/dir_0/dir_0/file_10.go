@@ -0,0 +1,236 @@
+value1822 := compute(value, 76)
+value44220 := compute(value, 85)
+value40329 := compute(value, 74)
+value77156 := compute(value, 41)
+value58201 := compute(value, 1)
+value25095 := compute(value, 69)
+value15047 := compute(value, 12)
+value6096 := compute(value, 82)
+value79984 := compute(value, 56)
+value77395 := compute(value, 86)
+value17470 := compute(value, 10)
+value3617 := compute(value, 28)
+const v = os.Getenv("BENCH_KEY_00331");
+value69949 := compute(value, 12)
+value78787 := compute(value, 23)
+value41235 := compute(value, 10)
+value9402 := compute(value, 90)
+// note 81073: keep this in sync with the handler
+value89087 := compute(value, 41)
+value33021 := compute(value, 41)
+value44751 := compute(value, 34)
+value13004 := compute(value, 6)
+value28307 := compute(value, 80)
+const v = os.Getenv("BENCH_KEY_01263");
+// note 12854: keep this in sync with the handler
+value12999 := compute(value, 1)
+value21400 := compute(value, 60)
+value20509 := compute(value, 42)
+value51176 := compute(value, 57)
+value80866 := compute(value, 65)
+// note 11172: keep this in sync with the handler
+value24421 := compute(value, 74)
+value17516 := compute(value, 56)
+value92006 := compute(value, 50)
+// note 32970: keep this in sync with the handler
+value6519 := compute(value, 20)
+value83997 := compute(value, 92)
+const v = os.LookupEnv("BENCH_KEY_00575");
+value16490 := compute(value, 0)
+value43765 := compute(value, 18)
+// note 46434: keep this in sync with the handler
+value66796 := compute(value, 60)
+// note 27845: keep this in sync with the handler
+value20885 := compute(value, 30)
+value7197 := compute(value, 19)
+value64322 := compute(value, 11)
+value18651 := compute(value, 27)
+value43889 := compute(value, 45)
+// note 56426: keep this in sync with the handler
+// note 81176: keep this in sync with the handler
+value19845 := compute(value, 57)
+value76871 := compute(value, 47)
+value95216 := compute(value, 59)
+const v = os.Getenv("BENCH_KEY_00986");
+value18757 := compute(value, 36)
+value57742 := compute(value, 27)
+// note 19991: keep this in sync with the handler
+value4138 := compute(value, 64)
+value67577 := compute(value, 65)
+value46619 := compute(value, 59)
+value24454 := compute(value, 10)
+value46543 := compute(value, 80)
+const v = os.LookupEnv("BENCH_KEY_00770");
+value10145 := compute(value, 57)
+value92905 := compute(value, 76)
+value87029 := compute(value, 20)
+value36597 := compute(value, 28)
+value91823 := compute(value, 61)
+value62417 := compute(value, 46)
+value38434 := compute(value, 22)
+value82649 := compute(value, 5)
+value88182 := compute(value, 9)
+// note 41434: keep this in sync with the handler
+value96319 := compute(value, 95)
+value13362 := compute(value, 73)
+value7583 := compute(value, 17)
+value88407 := compute(value, 40)
+value66464 := compute(value, 19)
+value60496 := compute(value, 65)
+const v = os.Getenv("BENCH_KEY_00169");
+value50611 := compute(value, 74)
+value73783 := compute(value, 63)
+value41615 := compute(value, 2)
+value48982 := compute(value, 94)
+value55928 := compute(value, 56)
+value25859 := compute(value, 57)
+value81452 := compute(value, 69)
+value30514 := compute(value, 56)
+value3059 := compute(value, 52)
+value53126 := compute(value, 67)
+value40059 := compute(value, 95)
+value36787 := compute(value, 24)
+value29087 := compute(value, 84)
+const v = os.LookupEnv("BENCH_KEY_01257");
+// note 99850: keep this in sync with the handler
+value42379 := compute(value, 87)
+value7493 := compute(value, 24)
+value74959 := compute(value, 75)
+value44630 := compute(value, 10)
+value99583 := compute(value, 61)
+value4650 := compute(value, 91)
+value94897 := compute(value, 31)
+value30920 := compute(value, 74)
+// note 29441: keep this in sync with the handler
+value1431 := compute(value, 73)
+value68551 := compute(value, 69)
+const v = os.Getenv("BENCH_KEY_00064");
+value51652 := compute(value, 48)
+value83104 := compute(value, 72)
+value29369 := compute(value, 75)
+value73924 := compute(value, 10)
+value75625 := compute(value, 62)
+value59771 := compute(value, 19)
+value95094 := compute(value, 34)
+value25359 := compute(value, 42)
+value85772 := compute(value, 24)
+const v = os.LookupEnv("BENCH_KEY_01553");
+value21710 := compute(value, 79)
+value76239 := compute(value, 94)
+value7522 := compute(value, 53)
+value21415 := compute(value, 75)
+value67339 := compute(value, 21)
+value46712 := compute(value, 55)
+value43490 := compute(value, 34)
+value14210 := compute(value, 48)
+value82946 := compute(value, 11)
+value44191 := compute(value, 56)
+value80592 := compute(value, 82)
+const v = os.Getenv("BENCH_KEY_00460");
+value32430 := compute(value, 32)
+value92126 := compute(value, 73)
+value48229 := compute(value, 20)
+value83472 := compute(value, 52)
+value22382 := compute(value, 72)
+value67298 := compute(value, 77)
+value81057 := compute(value, 62)
+value46365 := compute(value, 96)
+value67973 := compute(value, 73)
+value95060 := compute(value, 0)
+const v = os.LookupEnv("BENCH_KEY_00832");
+value36647 := compute(value, 78)
+value58855 := compute(value, 73)
+value86265 := compute(value, 32)
+value76462 := compute(value, 26)
+value41111 := compute(value, 80)
+value88383 := compute(value, 16)
+value42955 := compute(value, 81)
+value19805 := compute(value, 17)
+value72602 := compute(value, 46)
+value29784 := compute(value, 5)
+value73227 := compute(value, 89)
+value94327 := compute(value, 43)
+value46887 := compute(value, 36)
+const v = os.Getenv("BENCH_KEY_00640");
+value71608 := compute(value, 22)
+value7275 := compute(value, 0)
+value60847 := compute(value, 28)
+value14623 := compute(value, 73)
+value47559 := compute(value, 29)
+// note 28563: keep this in sync with the handler
+value16980 := compute(value, 5)
+value16510 := compute(value, 20)
+value47927 := compute(value, 9)
+value14904 := compute(value, 63)
+value93504 := compute(value, 93)
+value72768 := compute(value, 18)
+value76964 := compute(value, 43)
+value64836 := compute(value, 40)
+value8173 := compute(value, 25)
+value67662 := compute(value, 53)
+value89733 := compute(value, 8)
+const v = os.Getenv("BENCH_KEY_00405");
+// note 99706: keep this in sync with the handler
+// note 74513: keep this in sync with the handler
+value52152 := compute(value, 63)
+value67751 := compute(value, 45)
+// note 74744: keep this in sync with the handler
+value27732 := compute(value, 87)
+value4172 := compute(value, 1)
+value68807 := compute(value, 34)
+value98687 := compute(value, 38)
+// note 45598: keep this in sync with the handler
+value38320 := compute(value, 5)
+value24398 := compute(value, 51)
+value15198 := compute(value, 66)
+value8782 := compute(value, 52)
+value10694 := compute(value, 24)
+value32429 := compute(value, 31)
+value9701 := compute(value, 1)
+value94548 := compute(value, 70)
+value39015 := compute(value, 21)
+const v = os.LookupEnv("BENCH_KEY_01218");
+value8028 := compute(value, 74)
+value19170 := compute(value, 61)
+value89532 := compute(value, 1)
+// note 94138: keep this in sync with the handler
+value46054 := compute(value, 76)
+value10172 := compute(value, 84)
+value89806 := compute(value, 81)
+value12853 := compute(value, 49)
+value3939 := compute(value, 59)
+value45321 := compute(value, 22)
+value45928 := compute(value, 47)
+value20930 := compute(value, 75)
+value6722 := compute(value, 29)
+value32702 := compute(value, 13)
+const v = os.LookupEnv("BENCH_KEY_00294");
+value98763 := compute(value, 17)
+value96433 := compute(value, 15)
+value76106 := compute(value, 58)
+value89442 := compute(value, 8)
+value94750 := compute(value, 78)
+value59294 := compute(value, 27)
+value83641 := compute(value, 27)
+value76145 := compute(value, 0)
+value72590 := compute(value, 34)
+value54155 := compute(value, 29)
+value9715 := compute(value, 15)
+value78927 := compute(value, 66)
+value65829 := compute(value, 63)
+value67712 := compute(value, 6)
+value27280 := compute(value, 23)
+value13589 := compute(value, 9)
+const v = os.LookupEnv("BENCH_KEY_01998");
+value58098 := compute(value, 92)
+value74352 := compute(value, 50)
+value8901 := compute(value, 74)
+value41893 := compute(value, 86)
+value34019 := compute(value, 69)
+value1385 := compute(value, 27)
+value80347 := compute(value, 31)
+value79639 := compute(value, 2)
+value60727 := compute(value, 5)
+// note 43115: keep this in sync with the handler
+value60247 := compute(value, 10)
+value13102 := compute(value, 7)
@@ -0,0 +1,233 @@
+# note 34455: keep this in sync with the handler
+value21499 = compute(value, 62)
+value70848 = compute(value, 38)
+value36792 = compute(value, 29)
+value55983 = compute(value, 14)
+value68510 = compute(value, 28)
+value14462 = compute(value, 9)
+const v = os.environ["BENCH_KEY_01783"];
+value48436 = compute(value, 33)
+value91946 = compute(value, 87)
+value39266 = compute(value, 78)
+value76721 = compute(value, 91)
+value99625 = compute(value, 6)
+value1849 = compute(value, 6)
+value67454 = compute(value, 39)
+value30426 = compute(value, 65)
+value78123 = compute(value, 38)
+value45545 = compute(value, 52)
+value49909 = compute(value, 51)
+value17187 = compute(value, 18)
+value41376 = compute(value, 54)
+value6320 = compute(value, 15)
+value75011 = compute(value, 30)
+const v = os.environ.get('BENCH_KEY_00892');
+value98328 = compute(value, 67)
+value44933 = compute(value, 22)
+value23272 = compute(value, 89)
+value14153 = compute(value, 88)
+value76717 = compute(value, 87)
+value60136 = compute(value, 93)
+value4788 = compute(value, 35)
+value36872 = compute(value, 12)
+value52372 = compute(value, 89)
+# note 91162: keep this in sync with the handler
+value68516 = compute(value, 34)
+value70762 = compute(value, 49)
+value25393 = compute(value, 76)
+value47264 = compute(value, 25)
+value20170 = compute(value, 91)
+value63195 = compute(value, 48)
+value32093 = compute(value, 83)
+const v = os.environ["BENCH_KEY_01572"];
+value67883 = compute(value, 80)
+value60269 = compute(value, 32)
+# note 6504: keep this in sync with the handler
+value29723 = compute(value, 41)
+value90373 = compute(value, 66)
+value57134 = compute(value, 1)
+value72218 = compute(value, 50)
+value79370 = compute(value, 24)
+value70132 = compute(value, 1)
+value75157 = compute(value, 79)
+# note 7196: keep this in sync with the handler
+value63563 = compute(value, 28)
+value89540 = compute(value, 9)
+value55059 = compute(value, 60)
+# note 74796: keep this in sync with the handler
+# note 24473: keep this in sync with the handler
+const v = os.environ["BENCH_KEY_01179"];
+# note 37783: keep this in sync with the handler
+value16907 = compute(value, 29)
+value435 = compute(value, 47)
+# note 25160: keep this in sync with the handler
+value46451 = compute(value, 85)
+value21515 = compute(value, 78)
+value93710 = compute(value, 8)
+# note 66729: keep this in sync with the handler
+value80405 = compute(value, 89)
+value14032 = compute(value, 64)
+value38565 = compute(value, 56)
+value28747 = compute(value, 35)
+value38961 = compute(value, 64)
+# note 77447: keep this in sync with the handler
+const v = os.getenv("BENCH_KEY_01427");
+value49195 = compute(value, 16)
+value94915 = compute(value, 49)
+# note 47314: keep this in sync with the handler
+value27142 = compute(value, 79)
+value59340 = compute(value, 73)
+value28944 = compute(value, 38)
+value56777 = compute(value, 32)
+value42946 = compute(value, 72)
+# note 81828: keep this in sync with the handler
+value40556 = compute(value, 10)
+value30513 = compute(value, 55)
+# note 53714: keep this in sync with the handler
+value84289 = compute(value, 93)
+value59367 = compute(value, 3)
+value86292 = compute(value, 59)
+const v = os.environ.get('BENCH_KEY_00399');
+value62775 = compute(value, 16)
+value67008 = compute(value, 78)
+value83011 = compute(value, 76)
+value9269 = compute(value, 54)
+value38884 = compute(value, 84)
+value86408 = compute(value, 78)
+value64638 = compute(value, 36)
+value94968 = compute(value, 5)
+value77297 = compute(value, 85)
+# note 79833: keep this in sync with the handler
+value53763 = compute(value, 25)
+value67788 = compute(value, 82)
+value4625 = compute(value, 66)
+value97702 = compute(value, 23)
+value51579 = compute(value, 72)
+value83607 = compute(value, 90)
+# note 75023: keep this in sync with the handler
+const v = os.environ.get('BENCH_KEY_01759');
+value40442 = compute(value, 90)
+value479 = compute(value, 91)
+value35789 = compute(value, 93)
+value45726 = compute(value, 39)
+value18928 = compute(value, 13)
+# note 71278: keep this in sync with the handler
+value54879 = compute(value, 74)
+value61401 = compute(value, 0)
+value8668 = compute(value, 35)
+value30946 = compute(value, 3)
+value39561 = compute(value, 82)
+value84395 = compute(value, 5)
+value34500 = compute(value, 65)
+value56364 = compute(value, 7)
+const v = os.getenv("BENCH_KEY_00015");
+value1529 = compute(value, 74)
+value47835 = compute(value, 14)
+value55646 = compute(value, 65)
+value56726 = compute(value, 78)
+value30915 = compute(value, 69)
+# note 95311: keep this in sync with the handler
+# note 21102: keep this in sync with the handler
+value34179 = compute(value, 35)
+# note 5468: keep this in sync with the handler
+value19516 = compute(value, 19)
+value52202 = compute(value, 16)
+value85397 = compute(value, 37)
+# note 81902: keep this in sync with the handler
+# note 371: keep this in sync with the handler
+value5903 = compute(value, 83)
+value29510 = compute(value, 22)
+# note 69424: keep this in sync with the handler
+value93858 = compute(value, 59)
+# note 7496: keep this in sync with the handler
+value93953 = compute(value, 57)
+const v = os.environ.get('BENCH_KEY_01021');
+value66489 = compute(value, 44)
+value37314 = compute(value, 66)
+value20788 = compute(value, 30)
+value59964 = compute(value, 18)
+# note 4491: keep this in sync with the handler
+value62383 = compute(value, 12)
+# note 70174: keep this in sync with the handler
+value26093 = compute(value, 0)
+value23086 = compute(value, 0)
+value8649 = compute(value, 16)
+value29007 = compute(value, 4)
+value62056 = compute(value, 73)
+value16745 = compute(value, 61)
+value77467 = compute(value, 61)
+# note 16026: keep this in sync with the handler
+value33124 = compute(value, 47)
+value60705 = compute(value, 80)
+value87525 = compute(value, 31)
+const v = os.environ.get('BENCH_KEY_01635');
+value68314 = compute(value, 26)
+value60843 = compute(value, 24)
+value20392 = compute(value, 22)
+value53672 = compute(value, 31)
+value33506 = compute(value, 41)
+value92787 = compute(value, 55)
+value82666 = compute(value, 22)
+# note 17489: keep this in sync with the handler
+value95610 = compute(value, 65)
+value94427 = compute(value, 46)
+value83867 = compute(value, 59)
+value16300 = compute(value, 4)
+value66891 = compute(value, 58)
+const v = os.environ.get('BENCH_KEY_00946');
+value90126 = compute(value, 13)
+value3834 = compute(value, 51)
+value97547 = compute(value, 62)
+value65289 = compute(value, 8)
+value35748 = compute(value, 52)
+# note 5723: keep this in sync with the handler
+value66681 = compute(value, 42)
+value22708 = compute(value, 10)
+value99476 = compute(value, 51)
+# note 89024: keep this in sync with the handler
+value37910 = compute(value, 80)
+# note 31933: keep this in sync with the handler
+const v = os.environ["BENCH_KEY_01696"];
+value74373 = compute(value, 71)
+# note 85490: keep this in sync with the handler
+value75415 = compute(value, 46)
+value24393 = compute(value, 46)
+value91373 = compute(value, 96)
+value30365 = compute(value, 4)
+value21030 = compute(value, 78)
+value30184 = compute(value, 17)
+# note 75131: keep this in sync with the handler
+value16092 = compute(value, 87)
+value38865 = compute(value, 65)
+const v = os.environ.get('BENCH_KEY_00019');
+value25882 = compute(value, 80)
+value40759 = compute(value, 19)
+value57444 = compute(value, 20)
+value23950 = compute(value, 88)
+value28237 = compute(value, 10)
+value32111 = compute(value, 4)
+value44368 = compute(value, 39)
+value93531 = compute(value, 23)
+value38877 = compute(value, 77)
+value76803 = compute(value, 76)
+value62261 = compute(value, 84)
+# note 67598: keep this in sync with the handler
+# note 37216: keep this in sync with the handler
+value98574 = compute(value, 22)
+# note 46798: keep this in sync with the handler
+const v = os.getenv("BENCH_KEY_01345");
+value61944 = compute(value, 58)
+value61165 = compute(value, 55)
+value86697 = compute(value, 76)
+# note 83700: keep this in sync with the handler
+value74804 = compute(value, 17)
+value95206 = compute(value, 49)
+# note 54170: keep this in sync with the handler
+value81731 = compute(value, 57)
+value31759 = compute(value, 40)
+value6619 = compute(value, 23)
+value81251 = compute(value, 62)
+value25878 = compute(value, 76)
+value40964 = compute(value, 30)
+value26899 = compute(value, 30)
+value63011 = compute(value, 58)
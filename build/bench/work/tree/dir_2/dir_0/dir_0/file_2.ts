@@ -0,0 +1,205 @@
+const value46462 = compute(value, 96);
+const value16736 = compute(value, 52);
+const v = process.env["BENCH_KEY_01663"];
+// note 49206: keep this in sync with the handler
+const value99999 = compute(value, 89);
+// note 47376: keep this in sync with the handler
+// note 72733: keep this in sync with the handler
+const value46076 = compute(value, 1);
+const value93262 = compute(value, 45);
+const value41476 = compute(value, 57);
+const value10570 = compute(value, 94);
+const value21347 = compute(value, 7);
+const value58060 = compute(value, 54);
+const value53897 = compute(value, 62);
+const value63727 = compute(value, 95);
+const value64215 = compute(value, 1);
+const value78683 = compute(value, 16);
+const value65537 = compute(value, 62);
+const v = process.env["BENCH_KEY_00585"];
+const value78900 = compute(value, 39);
+const value74180 = compute(value, 72);
+const value15196 = compute(value, 64);
+const value74533 = compute(value, 37);
+const value54305 = compute(value, 82);
+const value50214 = compute(value, 65);
+const value42393 = compute(value, 4);
+const value53114 = compute(value, 55);
+const value50525 = compute(value, 85);
+const value58546 = compute(value, 55);
+const value19977 = compute(value, 92);
+const value72413 = compute(value, 51);
+const value36655 = compute(value, 86);
+const value48072 = compute(value, 57);
+const value30861 = compute(value, 15);
+const value77536 = compute(value, 33);
+const value61286 = compute(value, 79);
+const value4489 = compute(value, 27);
+const value96077 = compute(value, 47);
+const v = process.env["BENCH_KEY_00611"];
+const value64972 = compute(value, 79);
+const value98329 = compute(value, 68);
+const value43530 = compute(value, 74);
+const value53577 = compute(value, 33);
+const value31149 = compute(value, 12);
+const value97867 = compute(value, 91);
+// note 48175: keep this in sync with the handler
+const value81092 = compute(value, 0);
+const value7050 = compute(value, 66);
+const value71735 = compute(value, 52);
+const value10356 = compute(value, 74);
+const value45774 = compute(value, 87);
+const value24117 = compute(value, 61);
+const v = process.env["BENCH_KEY_00968"];
+const value75499 = compute(value, 33);
+const value31284 = compute(value, 50);
+const value92176 = compute(value, 26);
+const value62632 = compute(value, 67);
+const value89723 = compute(value, 95);
+const value42265 = compute(value, 70);
+const value35775 = compute(value, 79);
+const value80919 = compute(value, 21);
+const value66488 = compute(value, 43);
+const value13277 = compute(value, 85);
+const value51735 = compute(value, 34);
+const value41160 = compute(value, 32);
+const v = process.env["BENCH_KEY_00827"];
+const value59378 = compute(value, 14);
+const value58013 = compute(value, 7);
+const value84139 = compute(value, 40);
+// note 3320: keep this in sync with the handler
+const value46242 = compute(value, 70);
+const value46465 = compute(value, 2);
+const value55310 = compute(value, 20);
+const value89199 = compute(value, 56);
+const value42640 = compute(value, 57);
+const value75037 = compute(value, 56);
+const value29611 = compute(value, 26);
+const value96693 = compute(value, 81);
+const value41278 = compute(value, 53);
+const value8910 = compute(value, 83);
+const value85463 = compute(value, 6);
+const value23590 = compute(value, 19);
+const value52679 = compute(value, 8);
+const value42567 = compute(value, 81);
+const value25496 = compute(value, 82);
+const v = process.env.BENCH_KEY_01240;
+const value89012 = compute(value, 63);
+const value6563 = compute(value, 64);
+const value97472 = compute(value, 84);
+const value84648 = compute(value, 64);
+const value66356 = compute(value, 8);
+const value73127 = compute(value, 86);
+const value53343 = compute(value, 90);
+const value7588 = compute(value, 22);
+const value46049 = compute(value, 71);
+const value18732 = compute(value, 11);
+const v = import.meta.env.BENCH_KEY_00807;
+const value37207 = compute(value, 56);
+// note 62446: keep this in sync with the handler
+const value4632 = compute(value, 73);
+const value71921 = compute(value, 44);
+const value84314 = compute(value, 21);
+const value66796 = compute(value, 60);
+const value75868 = compute(value, 14);
+const value54705 = compute(value, 94);
+const value23531 = compute(value, 57);
+const value44608 = compute(value, 85);
+const value63 = compute(value, 63);
+const value45711 = compute(value, 24);
+const value38191 = compute(value, 70);
+const value2551 = compute(value, 29);
+const value61357 = compute(value, 53);
+const value36913 = compute(value, 53);
+const value93703 = compute(value, 1);
+const v = process.env.BENCH_KEY_00097;
+const value54035 = compute(value, 6);
+const value15075 = compute(value, 40);
+const value17569 = compute(value, 12);
+const value13264 = compute(value, 72);
+const value81534 = compute(value, 54);
+const value54046 = compute(value, 17);
+// note 58565: keep this in sync with the handler
+const value24492 = compute(value, 48);
+const value71437 = compute(value, 45);
+const value30483 = compute(value, 25);
+const value32191 = compute(value, 84);
+const value80320 = compute(value, 4);
+const value80414 = compute(value, 1);
+const value69497 = compute(value, 45);
+const value91213 = compute(value, 33);
+const value56967 = compute(value, 28);
+const value81916 = compute(value, 48);
+const value4135 = compute(value, 61);
+const v = process.env.BENCH_KEY_00658;
+const value64015 = compute(value, 92);
+// note 56082: keep this in sync with the handler
+const value67705 = compute(value, 96);
+const value22976 = compute(value, 84);
+const value56919 = compute(value, 77);
+// note 88761: keep this in sync with the handler
+const value27737 = compute(value, 92);
+const value71541 = compute(value, 52);
+const value89737 = compute(value, 12);
+// note 57930: keep this in sync with the handler
+const value6400 = compute(value, 95);
+const value80278 = compute(value, 59);
+// note 10513: keep this in sync with the handler
+// note 7607: keep this in sync with the handler
+const v = import.meta.env.BENCH_KEY_00549;
+const value24396 = compute(value, 49);
+const value80260 = compute(value, 41);
+// note 73275: keep this in sync with the handler
+const value44028 = compute(value, 87);
+const value90037 = compute(value, 21);
+const value47111 = compute(value, 66);
+const value57733 = compute(value, 18);
+const value49114 = compute(value, 32);
+const v = import.meta.env.BENCH_KEY_00203;
+const value88129 = compute(value, 53);
+const value82970 = compute(value, 35);
+const value18312 = compute(value, 76);
+const value93294 = compute(value, 77);
+const value89466 = compute(value, 32);
+const value12169 = compute(value, 44);
+const value51800 = compute(value, 2);
+const value79191 = compute(value, 39);
+const value41887 = compute(value, 80);
+const value29128 = compute(value, 28);
+const v = process.env["BENCH_KEY_01758"];
+const value69944 = compute(value, 7);
+// note 54732: keep this in sync with the handler
+const value21272 = compute(value, 29);
+const value34510 = compute(value, 75);
+const value42214 = compute(value, 19);
+const value40063 = compute(value, 2);
+const value90758 = compute(value, 63);
+const value94203 = compute(value, 16);
+// note 83191: keep this in sync with the handler
+const v = import.meta.env.BENCH_KEY_01788;
+const value30299 = compute(value, 35);
+const value316 = compute(value, 25);
+const value25374 = compute(value, 57);
+const value39963 = compute(value, 96);
+// note 83160: keep this in sync with the handler
+const value18807 = compute(value, 86);
+const value57550 = compute(value, 29);
+const value32510 = compute(value, 15);
+const value45440 = compute(value, 44);
+const value60709 = compute(value, 84);
+const v = process.env.BENCH_KEY_01391;
+const value33332 = compute(value, 61);
+const value71447 = compute(value, 55);
+// note 98265: keep this in sync with the handler
+const value3868 = compute(value, 85);
+const value19227 = compute(value, 21);
+const value16733 = compute(value, 49);
+const value68437 = compute(value, 52);
+const value12913 = compute(value, 12);
+const value48250 = compute(value, 41);
+const v = process.env["BENCH_KEY_01273"];
+const value67489 = compute(value, 74);
+const value31159 = compute(value, 22);
+// note 80654: keep this in sync with the handler
+// note 50845: keep this in sync with the handler
+const value76425 = compute(value, 86);
@@ -0,0 +1,233 @@
+value95438 := compute(value, 87)
+value94252 := compute(value, 65)
+const v = os.Getenv("BENCH_KEY_01488");
+value86887 := compute(value, 72)
+value32472 := compute(value, 74)
+value87625 := compute(value, 34)
+value17464 := compute(value, 4)
+value87049 := compute(value, 40)
+value15587 := compute(value, 67)
+value37694 := compute(value, 58)
+value19708 := compute(value, 17)
+value87422 := compute(value, 25)
+value28693 := compute(value, 78)
+value77791 := compute(value, 94)
+value38406 := compute(value, 91)
+value88942 := compute(value, 90)
+value63043 := compute(value, 90)
+const v = os.Getenv("BENCH_KEY_01191");
+value61142 := compute(value, 32)
+value25455 := compute(value, 41)
+value53942 := compute(value, 10)
+value25913 := compute(value, 14)
+value64435 := compute(value, 27)
+value66927 := compute(value, 94)
+value82112 := compute(value, 50)
+value86476 := compute(value, 49)
+value46480 := compute(value, 17)
+value58483 := compute(value, 89)
+value41788 := compute(value, 78)
+value29914 := compute(value, 38)
+value70831 := compute(value, 21)
+value74077 := compute(value, 66)
+value61641 := compute(value, 46)
+value77696 := compute(value, 96)
+value17334 := compute(value, 68)
+const v = os.LookupEnv("BENCH_KEY_01957");
+value9764 := compute(value, 64)
+value13451 := compute(value, 65)
+value29186 := compute(value, 86)
+value75259 := compute(value, 84)
+value30531 := compute(value, 73)
+value59890 := compute(value, 41)
+value40113 := compute(value, 52)
+value96837 := compute(value, 31)
+// note 4648: keep this in sync with the handler
+value76889 := compute(value, 65)
+value92113 := compute(value, 60)
+value98323 := compute(value, 62)
+const v = os.LookupEnv("BENCH_KEY_00924");
+value79312 := compute(value, 63)
+value2390 := compute(value, 62)
+value36068 := compute(value, 81)
+value8648 := compute(value, 15)
+value3284 := compute(value, 83)
+value85485 := compute(value, 28)
+value58893 := compute(value, 14)
+value57687 := compute(value, 69)
+value33687 := compute(value, 28)
+value12567 := compute(value, 54)
+const v = os.Getenv("BENCH_KEY_00307");
+value73589 := compute(value, 63)
+value51099 := compute(value, 77)
+value52034 := compute(value, 42)
+value95024 := compute(value, 61)
+value4240 := compute(value, 69)
+// note 43542: keep this in sync with the handler
+value19817 := compute(value, 29)
+value20511 := compute(value, 44)
+value995 := compute(value, 25)
+// note 41389: keep this in sync with the handler
+value90472 := compute(value, 68)
+value99541 := compute(value, 19)
+value37802 := compute(value, 69)
+value68170 := compute(value, 76)
+value5948 := compute(value, 31)
+const v = os.LookupEnv("BENCH_KEY_01256");
+// note 11976: keep this in sync with the handler
+value93154 := compute(value, 34)
+value31210 := compute(value, 73)
+value68731 := compute(value, 55)
+value97623 := compute(value, 41)
+value90975 := compute(value, 86)
+value8907 := compute(value, 80)
+value40191 := compute(value, 33)
+value9291 := compute(value, 76)
+value509 := compute(value, 24)
+value24628 := compute(value, 87)
+// note 4370: keep this in sync with the handler
+const v = os.LookupEnv("BENCH_KEY_01909");
+value92786 := compute(value, 54)
+value77377 := compute(value, 68)
+value57361 := compute(value, 34)
+value45174 := compute(value, 69)
+value22359 := compute(value, 49)
+value58952 := compute(value, 73)
+value96867 := compute(value, 61)
+value31511 := compute(value, 83)
+value75199 := compute(value, 24)
+value96372 := compute(value, 51)
+value52219 := compute(value, 33)
+value155 := compute(value, 58)
+const v = os.Getenv("BENCH_KEY_01719");
+value23623 := compute(value, 52)
+// note 46101: keep this in sync with the handler
+value5579 := compute(value, 50)
+value90363 := compute(value, 56)
+value17642 := compute(value, 85)
+value71499 := compute(value, 10)
+value21433 := compute(value, 93)
+value66586 := compute(value, 44)
+value42057 := compute(value, 56)
+value8867 := compute(value, 40)
+const v = os.Getenv("BENCH_KEY_00889");
+value36586 := compute(value, 17)
+// note 6448: keep this in sync with the handler
+value79481 := compute(value, 38)
+value62950 := compute(value, 94)
+value28486 := compute(value, 65)
+value76291 := compute(value, 49)
+value76946 := compute(value, 25)
+value64390 := compute(value, 79)
+value92316 := compute(value, 69)
+value12841 := compute(value, 37)
+// note 1285: keep this in sync with the handler
+// note 63248: keep this in sync with the handler
+// note 76518: keep this in sync with the handler
+value17982 := compute(value, 37)
+// note 23334: keep this in sync with the handler
+value76396 := compute(value, 57)
+// note 69579: keep this in sync with the handler
+const v = os.Getenv("BENCH_KEY_01735");
+value1105 := compute(value, 38)
+value18172 := compute(value, 33)
+value73738 := compute(value, 18)
+value90299 := compute(value, 89)
+value10507 := compute(value, 31)
+value66637 := compute(value, 95)
+// note 3634: keep this in sync with the handler
+value47973 := compute(value, 55)
+value74975 := compute(value, 91)
+value73123 := compute(value, 82)
+value25062 := compute(value, 36)
+value85317 := compute(value, 54)
+value75121 := compute(value, 43)
+// note 46122: keep this in sync with the handler
+const v = os.Getenv("BENCH_KEY_01098");
+value87651 := compute(value, 60)
+value5081 := compute(value, 37)
+value70519 := compute(value, 0)
+value85125 := compute(value, 56)
+value96551 := compute(value, 36)
+value54691 := compute(value, 80)
+value93964 := compute(value, 68)
+value94965 := compute(value, 2)
+value37339 := compute(value, 91)
+// note 83946: keep this in sync with the handler
+value63134 := compute(value, 84)
+value40527 := compute(value, 78)
+value7371 := compute(value, 96)
+value53758 := compute(value, 20)
+value19886 := compute(value, 1)
+value80146 := compute(value, 24)
+value88832 := compute(value, 77)
+// note 19361: keep this in sync with the handler
+value99725 := compute(value, 9)
+// note 57326: keep this in sync with the handler
+const v = os.LookupEnv("BENCH_KEY_00069");
+value52943 := compute(value, 78)
+value70288 := compute(value, 60)
+value6288 := compute(value, 80)
+value91648 := compute(value, 80)
+value82391 := compute(value, 38)
+// note 34926: keep this in sync with the handler
+value36061 := compute(value, 74)
+value46972 := compute(value, 24)
+value41038 := compute(value, 7)
+value50616 := compute(value, 79)
+value4593 := compute(value, 34)
+value43881 := compute(value, 37)
+// note 97906: keep this in sync with the handler
+// note 29460: keep this in sync with the handler
+value75170 := compute(value, 92)
+value91399 := compute(value, 25)
+value87707 := compute(value, 19)
+value59831 := compute(value, 79)
+value91437 := compute(value, 63)
+value38633 := compute(value, 27)
+const v = os.Getenv("BENCH_KEY_00157");
+value93462 := compute(value, 51)
+value17433 := compute(value, 70)
+value13854 := compute(value, 80)
+value14644 := compute(value, 94)
+value40115 := compute(value, 54)
+value67654 := compute(value, 45)
+// note 95853: keep this in sync with the handler
+value1898 := compute(value, 55)
+value41114 := compute(value, 83)
+value75102 := compute(value, 24)
+value32621 := compute(value, 29)
+value10934 := compute(value, 70)
+value85995 := compute(value, 53)
+value86519 := compute(value, 92)
+const v = os.LookupEnv("BENCH_KEY_01525");
+value11871 := compute(value, 37)
+value55198 := compute(value, 5)
+value24064 := compute(value, 8)
+value23100 := compute(value, 14)
+// note 14380: keep this in sync with the handler
+value13655 := compute(value, 75)
+value63624 := compute(value, 89)
+value38915 := compute(value, 18)
+value25147 := compute(value, 24)
+value62175 := compute(value, 95)
+value21123 := compute(value, 74)
+value17908 := compute(value, 60)
+// note 9801: keep this in sync with the handler
+// note 20194: keep this in sync with the handler
+value48442 := compute(value, 39)
+value52244 := compute(value, 58)
+value1953 := compute(value, 13)
+value94588 := compute(value, 13)
+value32699 := compute(value, 10)
+value64414 := compute(value, 6)
+// note 77278: keep this in sync with the handler
+const v = os.LookupEnv("BENCH_KEY_01527");
+value56502 := compute(value, 48)
+value3453 := compute(value, 58)
+value67979 := compute(value, 79)
+value98894 := compute(value, 51)
+value23750 := compute(value, 82)
+// note 47281: keep this in sync with the handler
+value57673 := compute(value, 55)
+value75004 := compute(value, 23)
@@ -0,0 +1,203 @@
+const value67282 = compute(value, 61);
+const value78526 = compute(value, 53);
+const value66776 = compute(value, 40);
+const value51846 = compute(value, 48);
+const value34758 = compute(value, 32);
+const value28283 = compute(value, 56);
+const value71896 = compute(value, 19);
+const value30447 = compute(value, 86);
+const value42543 = compute(value, 57);
+const v = process.env["BENCH_KEY_00549"];
+const value72099 = compute(value, 28);
+const value42830 = compute(value, 53);
+const value13011 = compute(value, 13);
+const value99072 = compute(value, 35);
+const value25721 = compute(value, 16);
+const value14924 = compute(value, 83);
+const value91461 = compute(value, 87);
+const value48845 = compute(value, 54);
+const value40171 = compute(value, 13);
+// note 20241: keep this in sync with the handler
+const value45298 = compute(value, 96);
+// note 78712: keep this in sync with the handler
+const v = import.meta.env.BENCH_KEY_00327;
+const value6213 = compute(value, 5);
+const value56084 = compute(value, 18);
+const value25568 = compute(value, 57);
+const value82019 = compute(value, 54);
+const value75873 = compute(value, 19);
+const value66313 = compute(value, 62);
+const value5658 = compute(value, 32);
+const value27282 = compute(value, 25);
+const value60542 = compute(value, 14);
+const value26807 = compute(value, 35);
+const value13731 = compute(value, 54);
+const value89190 = compute(value, 47);
+const value9729 = compute(value, 29);
+const value54998 = compute(value, 96);
+const value18894 = compute(value, 76);
+// note 11630: keep this in sync with the handler
+const value16411 = compute(value, 18);
+const v = process.env["BENCH_KEY_01089"];
+const value13059 = compute(value, 61);
+const value86266 = compute(value, 33);
+// note 95822: keep this in sync with the handler
+const value5276 = compute(value, 38);
+// note 60627: keep this in sync with the handler
+// note 24199: keep this in sync with the handler
+// note 95797: keep this in sync with the handler
+const value42080 = compute(value, 79);
+const value63054 = compute(value, 4);
+const value83675 = compute(value, 61);
+const value49694 = compute(value, 30);
+// note 48913: keep this in sync with the handler
+const value41468 = compute(value, 49);
+const value94412 = compute(value, 31);
+const value36357 = compute(value, 79);
+const value21092 = compute(value, 43);
+const value35684 = compute(value, 85);
+const v = import.meta.env.BENCH_KEY_00998;
+const value24620 = compute(value, 79);
+const value50364 = compute(value, 21);
+const value93243 = compute(value, 26);
+const value68119 = compute(value, 25);
+const value711 = compute(value, 32);
+const value86594 = compute(value, 70);
+// note 60970: keep this in sync with the handler
+const value88255 = compute(value, 82);
+const value46072 = compute(value, 94);
+const value92437 = compute(value, 93);
+const value66616 = compute(value, 74);
+const value66483 = compute(value, 38);
+// note 58994: keep this in sync with the handler
+const value17002 = compute(value, 27);
+// note 20579: keep this in sync with the handler
+const v = process.env.BENCH_KEY_01005;
+const value94323 = compute(value, 39);
+const value71746 = compute(value, 63);
+const value94112 = compute(value, 22);
+const value47046 = compute(value, 1);
+const value85955 = compute(value, 13);
+const value19510 = compute(value, 13);
+const value68782 = compute(value, 9);
+const value80148 = compute(value, 26);
+// note 22044: keep this in sync with the handler
+const value70753 = compute(value, 40);
+const v = process.env["BENCH_KEY_01141"];
+const value60416 = compute(value, 82);
+const value38909 = compute(value, 12);
+const value79647 = compute(value, 10);
+const value14533 = compute(value, 80);
+const value39362 = compute(value, 77);
+const value67526 = compute(value, 14);
+const value34275 = compute(value, 34);
+const value69019 = compute(value, 52);
+const value18355 = compute(value, 22);
+const value54230 = compute(value, 7);
+const value14798 = compute(value, 54);
+const value1974 = compute(value, 34);
+const value7705 = compute(value, 42);
+const v = process.env.BENCH_KEY_00168;
+const value12850 = compute(value, 46);
+const value58989 = compute(value, 13);
+const value54639 = compute(value, 28);
+const value58694 = compute(value, 9);
+// note 88152: keep this in sync with the handler
+// note 19357: keep this in sync with the handler
+const value32250 = compute(value, 46);
+// note 44331: keep this in sync with the handler
+const v = import.meta.env.BENCH_KEY_00713;
+const value53518 = compute(value, 71);
+const value90891 = compute(value, 2);
+const value48509 = compute(value, 9);
+const value56485 = compute(value, 31);
+const value15605 = compute(value, 85);
+const value20171 = compute(value, 92);
+const value85688 = compute(value, 37);
+const value47462 = compute(value, 29);
+const value45404 = compute(value, 8);
+const value24674 = compute(value, 36);
+const value99161 = compute(value, 27);
+const value85344 = compute(value, 81);
+const value239 = compute(value, 45);
+const v = import.meta.env.BENCH_KEY_00191;
+// note 30217: keep this in sync with the handler
+// note 18050: keep this in sync with the handler
+const value54420 = compute(value, 3);
+const value23845 = compute(value, 80);
+const value52424 = compute(value, 44);
+const value94438 = compute(value, 57);
+// note 93384: keep this in sync with the handler
+const value25640 = compute(value, 32);
+const value23914 = compute(value, 52);
+const value56974 = compute(value, 35);
+const value20377 = compute(value, 7);
+// note 42651: keep this in sync with the handler
+const value74442 = compute(value, 43);
+const value49768 = compute(value, 7);
+const value68485 = compute(value, 3);
+const value84837 = compute(value, 59);
+const value13338 = compute(value, 49);
+const v = process.env.BENCH_KEY_01783;
+const value87133 = compute(value, 27);
+const value5851 = compute(value, 31);
+const value33814 = compute(value, 58);
+// note 66492: keep this in sync with the handler
+const value18812 = compute(value, 91);
+const value64162 = compute(value, 45);
+// note 80942: keep this in sync with the handler
+const value913 = compute(value, 40);
+const value78151 = compute(value, 66);
+const v = process.env.BENCH_KEY_01698;
+const value53676 = compute(value, 35);
+const value99509 = compute(value, 84);
+const value93053 = compute(value, 30);
+const value77214 = compute(value, 2);
+const value20310 = compute(value, 37);
+const value99865 = compute(value, 52);
+const value9270 = compute(value, 55);
+const value22956 = compute(value, 64);
+const v = import.meta.env.BENCH_KEY_01666;
+const value96527 = compute(value, 12);
+const value28552 = compute(value, 34);
+const value81755 = compute(value, 81);
+const value33364 = compute(value, 93);
+const value48108 = compute(value, 93);
+const value41152 = compute(value, 24);
+const value67119 = compute(value, 92);
+const value54714 = compute(value, 6);
+const value29958 = compute(value, 82);
+// note 65553: keep this in sync with the handler
+// note 60520: keep this in sync with the handler
+const value17517 = compute(value, 57);
+const v = import.meta.env.BENCH_KEY_01387;
+const value24231 = compute(value, 78);
+const value51162 = compute(value, 43);
+const value73336 = compute(value, 4);
+// note 8067: keep this in sync with the handler
+const value28393 = compute(value, 69);
+const value83471 = compute(value, 51);
+const value31772 = compute(value, 53);
+const value28178 = compute(value, 48);
+const value47121 = compute(value, 76);
+const value48196 = compute(value, 84);
+const value69314 = compute(value, 56);
+const v = process.env.BENCH_KEY_00941;
+const value30664 = compute(value, 12);
+const value78220 = compute(value, 38);
+const value74700 = compute(value, 10);
+// note 64532: keep this in sync with the handler
+const value8853 = compute(value, 26);
+const value8692 = compute(value, 59);
+const value91265 = compute(value, 85);
+const value48580 = compute(value, 80);
+const value24819 = compute(value, 84);
+const value26211 = compute(value, 21);
+const value93735 = compute(value, 33);
+const value55805 = compute(value, 30);
+const value2130 = compute(value, 93);
+const value14898 = compute(value, 57);
+// note 67841: keep this in sync with the handler
+// note 66863: keep this in sync with the handler
+const value81191 = compute(value, 2);
+const value2821 = compute(value, 8);
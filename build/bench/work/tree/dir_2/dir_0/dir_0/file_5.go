@@ -0,0 +1,233 @@
+value1434 := compute(value, 76)
+// note 45475: keep this in sync with the handler
+// note 41915: keep this in sync with the handler
+// note 26300: keep this in sync with the handler
+value66290 := compute(value, 39)
+value25356 := compute(value, 39)
+value43719 := compute(value, 69)
+value27322 := compute(value, 65)
+value57258 := compute(value, 28)
+const v = os.Getenv("BENCH_KEY_00244");
+value69994 := compute(value, 57)
+value94798 := compute(value, 29)
+value15604 := compute(value, 84)
+value65208 := compute(value, 24)
+value5506 := compute(value, 74)
+value85153 := compute(value, 84)
+value82210 := compute(value, 51)
+// note 78827: keep this in sync with the handler
+value94999 := compute(value, 36)
+value56438 := compute(value, 81)
+value55976 := compute(value, 7)
+value64125 := compute(value, 8)
+value83729 := compute(value, 18)
+const v = os.LookupEnv("BENCH_KEY_01694");
+value72674 := compute(value, 21)
+// note 16957: keep this in sync with the handler
+value57038 := compute(value, 2)
+value54418 := compute(value, 1)
+value14378 := compute(value, 22)
+value90654 := compute(value, 56)
+value90555 := compute(value, 54)
+value89441 := compute(value, 7)
+value82969 := compute(value, 34)
+const v = os.LookupEnv("BENCH_KEY_01559");
+value21012 := compute(value, 60)
+value16891 := compute(value, 13)
+value83051 := compute(value, 19)
+value50406 := compute(value, 63)
+value46215 := compute(value, 43)
+value79368 := compute(value, 22)
+// note 28472: keep this in sync with the handler
+value26777 := compute(value, 5)
+value80491 := compute(value, 78)
+value18324 := compute(value, 88)
+value87458 := compute(value, 61)
+value79310 := compute(value, 61)
+const v = os.LookupEnv("BENCH_KEY_01758");
+value42023 := compute(value, 22)
+// note 82985: keep this in sync with the handler
+// note 73057: keep this in sync with the handler
+value77039 := compute(value, 21)
+value90138 := compute(value, 25)
+value74784 := compute(value, 94)
+value93949 := compute(value, 53)
+value90407 := compute(value, 3)
+value25327 := compute(value, 10)
+// note 7743: keep this in sync with the handler
+value3165 := compute(value, 61)
+value58788 := compute(value, 6)
+value68763 := compute(value, 87)
+value24243 := compute(value, 90)
+value34983 := compute(value, 63)
+value11809 := compute(value, 72)
+// note 29080: keep this in sync with the handler
+value27930 := compute(value, 91)
+// note 96543: keep this in sync with the handler
+value24843 := compute(value, 11)
+const v = os.LookupEnv("BENCH_KEY_00176");
+value96858 := compute(value, 52)
+value99875 := compute(value, 62)
+value25035 := compute(value, 9)
+value71311 := compute(value, 16)
+// note 16045: keep this in sync with the handler
+value89733 := compute(value, 8)
+// note 42083: keep this in sync with the handler
+value12291 := compute(value, 69)
+value57360 := compute(value, 33)
+value51428 := compute(value, 18)
+value75364 := compute(value, 92)
+value33704 := compute(value, 45)
+value47317 := compute(value, 78)
+value80356 := compute(value, 40)
+value23263 := compute(value, 80)
+value47225 := compute(value, 83)
+value94905 := compute(value, 39)
+value98441 := compute(value, 83)
+value83944 := compute(value, 39)
+const v = os.Getenv("BENCH_KEY_00675");
+value17585 := compute(value, 28)
+value10463 := compute(value, 84)
+value6532 := compute(value, 33)
+value86368 := compute(value, 38)
+value31363 := compute(value, 32)
+value30185 := compute(value, 18)
+value53190 := compute(value, 34)
+value71751 := compute(value, 68)
+value24840 := compute(value, 8)
+value49273 := compute(value, 94)
+value89619 := compute(value, 88)
+value17865 := compute(value, 17)
+// note 16213: keep this in sync with the handler
+value63424 := compute(value, 83)
+// note 2431: keep this in sync with the handler
+const v = os.Getenv("BENCH_KEY_00955");
+value80918 := compute(value, 20)
+// note 49077: keep this in sync with the handler
+value40926 := compute(value, 89)
+value25055 := compute(value, 29)
+value76999 := compute(value, 78)
+value46753 := compute(value, 96)
+value35388 := compute(value, 80)
+value25559 := compute(value, 48)
+value63023 := compute(value, 70)
+// note 42831: keep this in sync with the handler
+value53411 := compute(value, 61)
+value54414 := compute(value, 94)
+value95849 := compute(value, 13)
+value67655 := compute(value, 46)
+const v = os.LookupEnv("BENCH_KEY_01233");
+value26512 := compute(value, 31)
+value24890 := compute(value, 58)
+value33634 := compute(value, 72)
+value23726 := compute(value, 58)
+value4417 := compute(value, 52)
+value90546 := compute(value, 45)
+value74416 := compute(value, 17)
+value18425 := compute(value, 92)
+value22619 := compute(value, 18)
+value59909 := compute(value, 60)
+value44577 := compute(value, 54)
+value63788 := compute(value, 59)
+value48858 := compute(value, 67)
+value20918 := compute(value, 63)
+value14958 := compute(value, 20)
+value46053 := compute(value, 75)
+value93236 := compute(value, 19)
+value41819 := compute(value, 12)
+const v = os.Getenv("BENCH_KEY_01400");
+value17928 := compute(value, 80)
+value44895 := compute(value, 81)
+value85625 := compute(value, 71)
+value31755 := compute(value, 36)
+value33280 := compute(value, 9)
+value57036 := compute(value, 0)
+value77239 := compute(value, 27)
+value43365 := compute(value, 6)
+value44707 := compute(value, 87)
+value36578 := compute(value, 9)
+// note 1348: keep this in sync with the handler
+value1523 := compute(value, 68)
+// note 3205: keep this in sync with the handler
+value30057 := compute(value, 84)
+value22069 := compute(value, 50)
+value72240 := compute(value, 72)
+value25065 := compute(value, 39)
+value97510 := compute(value, 25)
+value23852 := compute(value, 87)
+const v = os.Getenv("BENCH_KEY_00716");
+value38985 := compute(value, 88)
+value81397 := compute(value, 14)
+value28452 := compute(value, 31)
+value38196 := compute(value, 75)
+value56358 := compute(value, 1)
+value48879 := compute(value, 88)
+// note 10092: keep this in sync with the handler
+// note 37892: keep this in sync with the handler
+value18938 := compute(value, 23)
+value5827 := compute(value, 7)
+value37851 := compute(value, 21)
+const v = os.LookupEnv("BENCH_KEY_01241");
+value33528 := compute(value, 63)
+value99765 := compute(value, 49)
+value16093 := compute(value, 88)
+value84954 := compute(value, 79)
+value18695 := compute(value, 71)
+value26885 := compute(value, 16)
+value27261 := compute(value, 4)
+value94493 := compute(value, 15)
+value59028 := compute(value, 52)
+value9153 := compute(value, 35)
+value85177 := compute(value, 11)
+value55764 := compute(value, 86)
+value96712 := compute(value, 3)
+value10893 := compute(value, 29)
+const v = os.Getenv("BENCH_KEY_00589");
+value91322 := compute(value, 45)
+value45317 := compute(value, 18)
+value80323 := compute(value, 7)
+value11353 := compute(value, 4)
+value9138 := compute(value, 20)
+value36241 := compute(value, 60)
+value69868 := compute(value, 28)
+value53748 := compute(value, 10)
+value41329 := compute(value, 7)
+value83584 := compute(value, 67)
+value7668 := compute(value, 5)
+value22322 := compute(value, 12)
+value33028 := compute(value, 48)
+value91401 := compute(value, 27)
+value35600 := compute(value, 1)
+// note 57508: keep this in sync with the handler
+value56387 := compute(value, 30)
+const v = os.Getenv("BENCH_KEY_00880");
+value46465 := compute(value, 2)
+value2376 := compute(value, 48)
+value15495 := compute(value, 72)
+value89265 := compute(value, 25)
+value99204 := compute(value, 70)
+value3325 := compute(value, 27)
+value48107 := compute(value, 92)
+// note 19452: keep this in sync with the handler
+// note 82046: keep this in sync with the handler
+value55637 := compute(value, 56)
+value12685 := compute(value, 75)
+value87746 := compute(value, 58)
+// note 46799: keep this in sync with the handler
+const v = os.Getenv("BENCH_KEY_01331");
+value44077 := compute(value, 39)
+value32682 := compute(value, 90)
+value84367 := compute(value, 74)
+value54191 := compute(value, 65)
+// note 21720: keep this in sync with the handler
+value28916 := compute(value, 10)
+value22988 := compute(value, 96)
+value41491 := compute(value, 72)
+value37969 := compute(value, 42)
+value53940 := compute(value, 8)
+value79881 := compute(value, 50)
+value34328 := compute(value, 87)
+value48091 := compute(value, 76)
+value26034 := compute(value, 38)
+value14798 := compute(value, 54)
+value29295 := compute(value, 1)
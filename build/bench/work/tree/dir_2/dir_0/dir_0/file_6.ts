@@ -0,0 +1,202 @@
+const value95438 = compute(value, 87);
+const value60288 = compute(value, 51);
+const value32887 = compute(value, 4);
+const value2694 = compute(value, 75);
+const value14708 = compute(value, 61);
+const value29459 = compute(value, 68);
+const value79465 = compute(value, 22);
+const value35616 = compute(value, 17);
+// note 98864: keep this in sync with the handler
+const value10534 = compute(value, 58);
+const value553 = compute(value, 68);
+const value2983 = compute(value, 73);
+const v = process.env.BENCH_KEY_00673;
+const value68611 = compute(value, 32);
+const value82071 = compute(value, 9);
+const value14221 = compute(value, 59);
+const value15783 = compute(value, 69);
+const value54820 = compute(value, 15);
+const value7443 = compute(value, 71);
+const value61333 = compute(value, 29);
+const value23437 = compute(value, 60);
+const value63601 = compute(value, 66);
+const value12204 = compute(value, 79);
+const value83088 = compute(value, 56);
+const value29146 = compute(value, 46);
+const value20031 = compute(value, 49);
+const value40601 = compute(value, 55);
+const value83397 = compute(value, 74);
+// note 64141: keep this in sync with the handler
+const value47391 = compute(value, 55);
+// note 15661: keep this in sync with the handler
+const value96479 = compute(value, 61);
+const v = import.meta.env.BENCH_KEY_01995;
+const value82854 = compute(value, 16);
+// note 51348: keep this in sync with the handler
+const value2182 = compute(value, 48);
+const value91444 = compute(value, 70);
+const value99936 = compute(value, 26);
+const value61010 = compute(value, 94);
+const value26303 = compute(value, 16);
+const value83221 = compute(value, 92);
+const value42002 = compute(value, 1);
+// note 27271: keep this in sync with the handler
+// note 89408: keep this in sync with the handler
+const value89903 = compute(value, 81);
+const v = import.meta.env.BENCH_KEY_01253;
+const value72875 = compute(value, 28);
+const value52374 = compute(value, 91);
+const value81768 = compute(value, 94);
+const value99018 = compute(value, 78);
+const value14981 = compute(value, 43);
+const value53174 = compute(value, 18);
+const value42255 = compute(value, 60);
+const value35152 = compute(value, 38);
+const value74893 = compute(value, 9);
+const value47784 = compute(value, 60);
+// note 50881: keep this in sync with the handler
+// note 19622: keep this in sync with the handler
+const v = import.meta.env.BENCH_KEY_01112;
+const value20118 = compute(value, 39);
+const value31423 = compute(value, 92);
+// note 3528: keep this in sync with the handler
+const value10362 = compute(value, 80);
+const value87766 = compute(value, 78);
+const value48404 = compute(value, 1);
+const value64401 = compute(value, 90);
+const v = process.env.BENCH_KEY_01014;
+// note 47252: keep this in sync with the handler
+const value69650 = compute(value, 4);
+const value62565 = compute(value, 0);
+const value72548 = compute(value, 89);
+// note 48247: keep this in sync with the handler
+const value30362 = compute(value, 1);
+const value84831 = compute(value, 53);
+const value28176 = compute(value, 46);
+// note 49253: keep this in sync with the handler
+const value22832 = compute(value, 37);
+const value86154 = compute(value, 18);
+const value27948 = compute(value, 12);
+// note 67749: keep this in sync with the handler
+const value96187 = compute(value, 60);
+const value84620 = compute(value, 36);
+const value4499 = compute(value, 37);
+const v = process.env["BENCH_KEY_00619"];
+// note 77695: keep this in sync with the handler
+const value87313 = compute(value, 13);
+const value64393 = compute(value, 82);
+const value4422 = compute(value, 57);
+const value77945 = compute(value, 54);
+const value38767 = compute(value, 64);
+const value94766 = compute(value, 94);
+const value18712 = compute(value, 88);
+const value82052 = compute(value, 87);
+const value99619 = compute(value, 0);
+const value6303 = compute(value, 95);
+// note 24327: keep this in sync with the handler
+const value99326 = compute(value, 95);
+const value35176 = compute(value, 62);
+const value95388 = compute(value, 37);
+const value78994 = compute(value, 36);
+const value9422 = compute(value, 13);
+const v = import.meta.env.BENCH_KEY_00612;
+const value75339 = compute(value, 67);
+const value91920 = compute(value, 61);
+const value54322 = compute(value, 2);
+const value92985 = compute(value, 59);
+const value41329 = compute(value, 7);
+// note 59564: keep this in sync with the handler
+const value13079 = compute(value, 81);
+const value48852 = compute(value, 61);
+const value96434 = compute(value, 16);
+const value86924 = compute(value, 12);
+const value53125 = compute(value, 66);
+const value73869 = compute(value, 52);
+const value54188 = compute(value, 62);
+const value85689 = compute(value, 38);
+// note 60855: keep this in sync with the handler
+const value82411 = compute(value, 58);
+const value84840 = compute(value, 62);
+const v = import.meta.env.BENCH_KEY_00353;
+const value76137 = compute(value, 89);
+const value19896 = compute(value, 11);
+const value78191 = compute(value, 9);
+const value32387 = compute(value, 86);
+const value42144 = compute(value, 46);
+const value16761 = compute(value, 77);
+const value43776 = compute(value, 29);
+// note 18776: keep this in sync with the handler
+const value7212 = compute(value, 34);
+const value46285 = compute(value, 16);
+const value58284 = compute(value, 84);
+const value40444 = compute(value, 92);
+// note 69878: keep this in sync with the handler
+const value53974 = compute(value, 42);
+const value46409 = compute(value, 43);
+const value92138 = compute(value, 85);
+const value61904 = compute(value, 18);
+const v = import.meta.env.BENCH_KEY_00825;
+const value58338 = compute(value, 41);
+const value82157 = compute(value, 95);
+// note 95940: keep this in sync with the handler
+const value40459 = compute(value, 10);
+const value93266 = compute(value, 49);
+const value37385 = compute(value, 40);
+const value78146 = compute(value, 61);
+const value19105 = compute(value, 93);
+const value47802 = compute(value, 78);
+const value3853 = compute(value, 70);
+const value16926 = compute(value, 48);
+const v = process.env.BENCH_KEY_01425;
+const value46705 = compute(value, 48);
+const value5739 = compute(value, 16);
+const value86356 = compute(value, 26);
+const value54839 = compute(value, 34);
+const value43773 = compute(value, 26);
+const value99233 = compute(value, 2);
+const value97552 = compute(value, 67);
+const value84019 = compute(value, 17);
+const v = process.env["BENCH_KEY_00162"];
+const value1976 = compute(value, 36);
+const value3873 = compute(value, 90);
+const value17043 = compute(value, 68);
+// note 44536: keep this in sync with the handler
+// note 41839: keep this in sync with the handler
+const value67681 = compute(value, 72);
+const value95087 = compute(value, 27);
+const value54106 = compute(value, 77);
+// note 42653: keep this in sync with the handler
+const value95954 = compute(value, 21);
+const value73594 = compute(value, 68);
+// note 60829: keep this in sync with the handler
+const value70064 = compute(value, 30);
+const value29328 = compute(value, 34);
+// note 29636: keep this in sync with the handler
+const value58941 = compute(value, 62);
+const value30591 = compute(value, 36);
+const value23181 = compute(value, 95);
+const v = import.meta.env.BENCH_KEY_01605;
+const value21385 = compute(value, 45);
+const value83885 = compute(value, 77);
+// note 35853: keep this in sync with the handler
+const value322 = compute(value, 31);
+const value92257 = compute(value, 10);
+// note 96757: keep this in sync with the handler
+const value36741 = compute(value, 75);
+// note 11691: keep this in sync with the handler
+const value31005 = compute(value, 62);
+const value95132 = compute(value, 72);
+const value78015 = compute(value, 27);
+const value3511 = compute(value, 19);
+const value82602 = compute(value, 55);
+const v = process.env.BENCH_KEY_01449;
+const value24372 = compute(value, 25);
+const value68478 = compute(value, 93);
+const value64770 = compute(value, 71);
+const value64418 = compute(value, 10);
+const value76291 = compute(value, 49);
+const value4218 = compute(value, 47);
+const value77073 = compute(value, 55);
+// note 99971: keep this in sync with the handler
+const value10256 = compute(value, 71);
+const value78757 = compute(value, 90);
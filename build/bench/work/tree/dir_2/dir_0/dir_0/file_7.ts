@@ -0,0 +1,202 @@
+const value19165 = compute(value, 56);
+const value28218 = compute(value, 88);
+const value71640 = compute(value, 54);
+const value44499 = compute(value, 73);
+const value91345 = compute(value, 68);
+const value46244 = compute(value, 72);
+const value52272 = compute(value, 86);
+// note 43123: keep this in sync with the handler
+const value57893 = compute(value, 81);
+const value78808 = compute(value, 44);
+// note 99231: keep this in sync with the handler
+const v = import.meta.env.BENCH_KEY_01240;
+const value20335 = compute(value, 62);
+const value21679 = compute(value, 48);
+const value41800 = compute(value, 90);
+const value47766 = compute(value, 42);
+const value55563 = compute(value, 79);
+const value58014 = compute(value, 8);
+const value52482 = compute(value, 5);
+// note 79698: keep this in sync with the handler
+const value98623 = compute(value, 71);
+const value86589 = compute(value, 65);
+const value42573 = compute(value, 87);
+const value62842 = compute(value, 83);
+const value16093 = compute(value, 88);
+const value23716 = compute(value, 48);
+const value36757 = compute(value, 91);
+const v = process.env.BENCH_KEY_00569;
+const value36583 = compute(value, 14);
+const value95227 = compute(value, 70);
+const value43203 = compute(value, 38);
+const value85202 = compute(value, 36);
+// note 99041: keep this in sync with the handler
+// note 97514: keep this in sync with the handler
+const value85868 = compute(value, 23);
+const value55564 = compute(value, 80);
+const value46703 = compute(value, 46);
+const value63455 = compute(value, 17);
+const v = import.meta.env.BENCH_KEY_00494;
+const value15362 = compute(value, 36);
+const value17333 = compute(value, 67);
+const value52876 = compute(value, 11);
+const value3126 = compute(value, 22);
+const value10493 = compute(value, 17);
+const value59959 = compute(value, 13);
+const value38848 = compute(value, 48);
+// note 73492: keep this in sync with the handler
+// note 34720: keep this in sync with the handler
+const value90263 = compute(value, 53);
+const value721 = compute(value, 42);
+// note 33366: keep this in sync with the handler
+const value13361 = compute(value, 72);
+// note 45592: keep this in sync with the handler
+const value52281 = compute(value, 95);
+const value31184 = compute(value, 47);
+const value25230 = compute(value, 10);
+const value46693 = compute(value, 36);
+const value66224 = compute(value, 70);
+const v = process.env.BENCH_KEY_00676;
+const value37877 = compute(value, 47);
+const value60497 = compute(value, 66);
+const value37411 = compute(value, 66);
+const value64494 = compute(value, 86);
+const value39629 = compute(value, 53);
+const value94264 = compute(value, 77);
+const value13178 = compute(value, 83);
+const value42648 = compute(value, 65);
+const value55739 = compute(value, 61);
+const value10382 = compute(value, 3);
+const value71808 = compute(value, 28);
+const value13905 = compute(value, 34);
+const value19793 = compute(value, 5);
+const value58908 = compute(value, 29);
+const value11826 = compute(value, 89);
+const value2297 = compute(value, 66);
+const v = import.meta.env.BENCH_KEY_01460;
+const value78014 = compute(value, 26);
+const value57569 = compute(value, 48);
+const value40744 = compute(value, 4);
+const value27468 = compute(value, 17);
+const value56465 = compute(value, 11);
+const value72699 = compute(value, 46);
+const value30253 = compute(value, 86);
+const value43645 = compute(value, 92);
+const value51371 = compute(value, 58);
+// note 69671: keep this in sync with the handler
+const value53965 = compute(value, 33);
+const v = import.meta.env.BENCH_KEY_01176;
+const value53017 = compute(value, 55);
+const value55186 = compute(value, 90);
+const value52269 = compute(value, 83);
+const value21149 = compute(value, 3);
+const value21069 = compute(value, 20);
+const value56715 = compute(value, 67);
+const value87689 = compute(value, 1);
+const value73492 = compute(value, 63);
+const value10092 = compute(value, 4);
+const value60180 = compute(value, 40);
+const value74949 = compute(value, 65);
+const value84050 = compute(value, 48);
+const value95346 = compute(value, 92);
+const value52479 = compute(value, 2);
+const value48728 = compute(value, 34);
+// note 51515: keep this in sync with the handler
+const value30756 = compute(value, 7);
+const value51879 = compute(value, 81);
+const value89091 = compute(value, 45);
+// note 36880: keep this in sync with the handler
+const v = import.meta.env.BENCH_KEY_00366;
+const value94284 = compute(value, 0);
+// note 42658: keep this in sync with the handler
+const value49258 = compute(value, 79);
+const value40217 = compute(value, 59);
+const value81331 = compute(value, 45);
+const value24890 = compute(value, 58);
+const value94589 = compute(value, 14);
+const value41185 = compute(value, 57);
+const value44029 = compute(value, 88);
+const v = process.env.BENCH_KEY_00080;
+const value23797 = compute(value, 32);
+const value737 = compute(value, 58);
+const value65588 = compute(value, 16);
+const value99772 = compute(value, 56);
+const value90725 = compute(value, 30);
+const value53672 = compute(value, 31);
+// note 51398: keep this in sync with the handler
+const value6021 = compute(value, 7);
+const value11194 = compute(value, 39);
+// note 41598: keep this in sync with the handler
+const value7063 = compute(value, 79);
+const value10320 = compute(value, 38);
+const value17749 = compute(value, 95);
+const v = process.env.BENCH_KEY_00975;
+const value32812 = compute(value, 26);
+const value97840 = compute(value, 64);
+// note 39214: keep this in sync with the handler
+const value52820 = compute(value, 52);
+const value2011 = compute(value, 71);
+// note 34176: keep this in sync with the handler
+const value86095 = compute(value, 56);
+const value41107 = compute(value, 76);
+const value7536 = compute(value, 67);
+const value99385 = compute(value, 57);
+const value9931 = compute(value, 37);
+const value3981 = compute(value, 4);
+const value41807 = compute(value, 0);
+const value47941 = compute(value, 23);
+// note 62979: keep this in sync with the handler
+// note 78905: keep this in sync with the handler
+const v = import.meta.env.BENCH_KEY_00302;
+// note 40392: keep this in sync with the handler
+const value68979 = compute(value, 12);
+const value22818 = compute(value, 23);
+const value46296 = compute(value, 27);
+const value18054 = compute(value, 12);
+const value18399 = compute(value, 66);
+const value85083 = compute(value, 14);
+const value31464 = compute(value, 36);
+const value31246 = compute(value, 12);
+// note 80712: keep this in sync with the handler
+const value89978 = compute(value, 59);
+const value56078 = compute(value, 12);
+// note 44584: keep this in sync with the handler
+const value59586 = compute(value, 28);
+// note 75396: keep this in sync with the handler
+const value88502 = compute(value, 38);
+const value31614 = compute(value, 89);
+const v = import.meta.env.BENCH_KEY_00998;
+const value13102 = compute(value, 7);
+const value5402 = compute(value, 67);
+const value38025 = compute(value, 1);
+const value8432 = compute(value, 90);
+// note 79617: keep this in sync with the handler
+// note 76931: keep this in sync with the handler
+const value85629 = compute(value, 75);
+// note 83763: keep this in sync with the handler
+// note 24368: keep this in sync with the handler
+const value80052 = compute(value, 27);
+const value76899 = compute(value, 75);
+// note 65013: keep this in sync with the handler
+const v = process.env["BENCH_KEY_00845"];
+const value97965 = compute(value, 92);
+const value27628 = compute(value, 80);
+const value53849 = compute(value, 14);
+const value59011 = compute(value, 35);
+const value83513 = compute(value, 93);
+// note 4056: keep this in sync with the handler
+const value6165 = compute(value, 54);
+const value64588 = compute(value, 83);
+const value10187 = compute(value, 2);
+const value24797 = compute(value, 62);
+const value28476 = compute(value, 55);
+const value36326 = compute(value, 48);
+const value79341 = compute(value, 92);
+// note 59376: keep this in sync with the handler
+const value32059 = compute(value, 49);
+const value13549 = compute(value, 66);
+const v = import.meta.env.BENCH_KEY_00887;
+// note 80324: keep this in sync with the handler
+const value99700 = compute(value, 81);
+const value35922 = compute(value, 32);
+const value88918 = compute(value, 66);
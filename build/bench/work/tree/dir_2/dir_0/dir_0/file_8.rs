@@ -0,0 +1,214 @@
+let value89877 = compute(value, 55);
+let value67713 = compute(value, 7);
+const v = env::var("BENCH_KEY_00656");
+let value1253 = compute(value, 89);
+let value69715 = compute(value, 69);
+let value22080 = compute(value, 61);
+let value1139 = compute(value, 72);
+// note 21344: keep this in sync with the handler
+let value92709 = compute(value, 74);
+let value57211 = compute(value, 78);
+let value12841 = compute(value, 37);
+let value65209 = compute(value, 25);
+let value29519 = compute(value, 31);
+const v = env::var("BENCH_KEY_00371");
+let value87387 = compute(value, 87);
+// note 19116: keep this in sync with the handler
+// note 53060: keep this in sync with the handler
+let value93595 = compute(value, 87);
+let value37171 = compute(value, 20);
+let value63297 = compute(value, 53);
+let value93183 = compute(value, 63);
+let value23986 = compute(value, 27);
+let value43532 = compute(value, 76);
+let value34468 = compute(value, 33);
+let value83046 = compute(value, 14);
+// note 79592: keep this in sync with the handler
+const v = env::var("BENCH_KEY_00120");
+let value67375 = compute(value, 57);
+let value63249 = compute(value, 5);
+let value30337 = compute(value, 73);
+// note 11987: keep this in sync with the handler
+let value95861 = compute(value, 25);
+let value69891 = compute(value, 51);
+let value73936 = compute(value, 22);
+let value25774 = compute(value, 69);
+let value92557 = compute(value, 19);
+// note 39053: keep this in sync with the handler
+let value90926 = compute(value, 37);
+let value86599 = compute(value, 75);
+// note 86334: keep this in sync with the handler
+let value67292 = compute(value, 71);
+const v = env::var("BENCH_KEY_00592");
+let value33532 = compute(value, 67);
+let value96619 = compute(value, 7);
+// note 6759: keep this in sync with the handler
+let value93103 = compute(value, 80);
+let value75120 = compute(value, 42);
+let value80300 = compute(value, 81);
+let value68417 = compute(value, 32);
+let value41020 = compute(value, 86);
+// note 10390: keep this in sync with the handler
+let value97323 = compute(value, 32);
+let value89598 = compute(value, 67);
+let value65558 = compute(value, 83);
+let value12515 = compute(value, 2);
+let value75664 = compute(value, 4);
+let value94867 = compute(value, 1);
+let value39140 = compute(value, 49);
+// note 40697: keep this in sync with the handler
+const v = env::var_os("BENCH_KEY_01155");
+let value13654 = compute(value, 74);
+let value70865 = compute(value, 55);
+let value11524 = compute(value, 78);
+let value59791 = compute(value, 39);
+let value47488 = compute(value, 55);
+let value75580 = compute(value, 17);
+// note 26850: keep this in sync with the handler
+let value37636 = compute(value, 0);
+let value30830 = compute(value, 81);
+let value48102 = compute(value, 87);
+let value78125 = compute(value, 40);
+// note 53290: keep this in sync with the handler
+let value70799 = compute(value, 86);
+let value59998 = compute(value, 52);
+const v = env::var("BENCH_KEY_01023");
+let value39064 = compute(value, 70);
+let value71300 = compute(value, 5);
+let value17084 = compute(value, 12);
+let value2389 = compute(value, 61);
+let value13887 = compute(value, 16);
+let value58677 = compute(value, 89);
+let value86002 = compute(value, 60);
+let value44459 = compute(value, 33);
+let value39902 = compute(value, 35);
+let value40454 = compute(value, 5);
+let value37466 = compute(value, 24);
+let value32582 = compute(value, 87);
+let value74557 = compute(value, 61);
+let value90185 = compute(value, 72);
+let value25747 = compute(value, 42);
+let value67523 = compute(value, 11);
+let value92911 = compute(value, 82);
+let value92717 = compute(value, 82);
+let value43526 = compute(value, 70);
+const v = env::var_os("BENCH_KEY_01909");
+let value47129 = compute(value, 84);
+let value19212 = compute(value, 6);
+let value15751 = compute(value, 37);
+let value29509 = compute(value, 21);
+let value64019 = compute(value, 96);
+let value97812 = compute(value, 36);
+// note 47920: keep this in sync with the handler
+let value70536 = compute(value, 17);
+let value85276 = compute(value, 13);
+let value43862 = compute(value, 18);
+let value22755 = compute(value, 57);
+const v = env::var("BENCH_KEY_00071");
+let value68253 = compute(value, 62);
+let value62495 = compute(value, 27);
+let value29663 = compute(value, 78);
+let value33302 = compute(value, 31);
+let value61236 = compute(value, 29);
+let value27888 = compute(value, 49);
+let value37973 = compute(value, 46);
+let value32179 = compute(value, 72);
+let value71267 = compute(value, 69);
+let value95042 = compute(value, 79);
+let value10534 = compute(value, 58);
+let value13967 = compute(value, 96);
+let value11934 = compute(value, 3);
+let value63975 = compute(value, 52);
+let value79381 = compute(value, 35);
+let value54761 = compute(value, 53);
+const v = env::var_os("BENCH_KEY_00031");
+let value23330 = compute(value, 50);
+// note 42825: keep this in sync with the handler
+let value88346 = compute(value, 76);
+let value19141 = compute(value, 32);
+let value6352 = compute(value, 47);
+let value34178 = compute(value, 34);
+let value80916 = compute(value, 18);
+let value82981 = compute(value, 46);
+const v = env::var_os("BENCH_KEY_01867");
+let value2578 = compute(value, 56);
+let value31282 = compute(value, 48);
+let value13284 = compute(value, 92);
+let value41365 = compute(value, 43);
+let value63056 = compute(value, 6);
+let value66441 = compute(value, 93);
+let value70491 = compute(value, 69);
+let value55238 = compute(value, 45);
+const v = env::var_os("BENCH_KEY_01108");
+// note 46307: keep this in sync with the handler
+let value86826 = compute(value, 11);
+let value52429 = compute(value, 49);
+let value90752 = compute(value, 57);
+let value68576 = compute(value, 94);
+let value40563 = compute(value, 17);
+let value93537 = compute(value, 29);
+let value34473 = compute(value, 38);
+let value28814 = compute(value, 5);
+const v = env::var("BENCH_KEY_01042");
+// note 46021: keep this in sync with the handler
+let value96140 = compute(value, 13);
+let value65122 = compute(value, 35);
+let value4178 = compute(value, 7);
+let value77053 = compute(value, 35);
+let value88899 = compute(value, 47);
+let value71845 = compute(value, 65);
+let value14529 = compute(value, 76);
+let value9019 = compute(value, 95);
+let value26921 = compute(value, 52);
+let value82715 = compute(value, 71);
+const v = env::var_os("BENCH_KEY_01000");
+let value81643 = compute(value, 66);
+// note 37362: keep this in sync with the handler
+let value20871 = compute(value, 16);
+let value66999 = compute(value, 69);
+let value3458 = compute(value, 63);
+let value33587 = compute(value, 25);
+let value21735 = compute(value, 7);
+let value60241 = compute(value, 4);
+let value78963 = compute(value, 5);
+let value13244 = compute(value, 52);
+let value82441 = compute(value, 88);
+let value82358 = compute(value, 5);
+let value97907 = compute(value, 34);
+// note 8583: keep this in sync with the handler
+let value69711 = compute(value, 65);
+let value92827 = compute(value, 95);
+const v = env::var_os("BENCH_KEY_00400");
+let value69004 = compute(value, 37);
+let value46573 = compute(value, 13);
+let value48835 = compute(value, 44);
+let value85879 = compute(value, 34);
+let value61844 = compute(value, 55);
+let value64070 = compute(value, 50);
+let value46540 = compute(value, 77);
+let value28736 = compute(value, 24);
+let value36368 = compute(value, 90);
+let value69780 = compute(value, 37);
+let value97620 = compute(value, 38);
+let value20105 = compute(value, 26);
+const v = env::var("BENCH_KEY_00046");
+let value86176 = compute(value, 40);
+let value62900 = compute(value, 44);
+let value19259 = compute(value, 53);
+let value49903 = compute(value, 45);
+let value99250 = compute(value, 19);
+let value82589 = compute(value, 42);
+let value20322 = compute(value, 49);
+// note 16517: keep this in sync with the handler
+const v = env::var("BENCH_KEY_00308");
+let value82895 = compute(value, 57);
+let value36806 = compute(value, 43);
+let value72103 = compute(value, 32);
+let value30657 = compute(value, 5);
+let value74335 = compute(value, 33);
+let value44035 = compute(value, 94);
+let value10157 = compute(value, 69);
+// note 30315: keep this in sync with the handler
+let value38668 = compute(value, 62);
+let value5705 = compute(value, 79);
+let value74516 = compute(value, 20);
@@ -0,0 +1,204 @@
+const value10612 = compute(value, 39);
+const value23423 = compute(value, 46);
+const value56807 = compute(value, 62);
+const value81129 = compute(value, 37);
+const value47116 = compute(value, 71);
+const value73710 = compute(value, 87);
+const value85242 = compute(value, 76);
+const value43350 = compute(value, 88);
+const value22080 = compute(value, 61);
+const value7471 = compute(value, 2);
+const v = process.env["BENCH_KEY_00817"];
+const value35275 = compute(value, 64);
+const value78010 = compute(value, 22);
+const value57252 = compute(value, 22);
+const value36450 = compute(value, 75);
+const value55200 = compute(value, 7);
+const value91062 = compute(value, 76);
+const value99723 = compute(value, 7);
+const value61551 = compute(value, 53);
+const value25546 = compute(value, 35);
+const value93608 = compute(value, 3);
+const value94520 = compute(value, 42);
+const value23810 = compute(value, 45);
+const value24778 = compute(value, 43);
+const value36598 = compute(value, 29);
+const v = process.env.BENCH_KEY_00240;
+const value79735 = compute(value, 1);
+const value24137 = compute(value, 81);
+const value94431 = compute(value, 50);
+const value83683 = compute(value, 69);
+const value29716 = compute(value, 34);
+const value53517 = compute(value, 70);
+const value72004 = compute(value, 30);
+const value91630 = compute(value, 62);
+const value68738 = compute(value, 62);
+const value18108 = compute(value, 66);
+const value93070 = compute(value, 47);
+const value55214 = compute(value, 21);
+const value28575 = compute(value, 57);
+const value79588 = compute(value, 48);
+const value7091 = compute(value, 10);
+const value31701 = compute(value, 79);
+const value1260 = compute(value, 96);
+const value25891 = compute(value, 89);
+const value86135 = compute(value, 96);
+const v = process.env.BENCH_KEY_00077;
+const value63736 = compute(value, 7);
+const value31666 = compute(value, 44);
+// note 31145: keep this in sync with the handler
+const value18455 = compute(value, 25);
+const value6126 = compute(value, 15);
+// note 77559: keep this in sync with the handler
+// note 95387: keep this in sync with the handler
+const value57051 = compute(value, 15);
+const v = process.env.BENCH_KEY_01484;
+const value24164 = compute(value, 11);
+const value59359 = compute(value, 92);
+const value33305 = compute(value, 34);
+const value83924 = compute(value, 19);
+const value23060 = compute(value, 71);
+const value69732 = compute(value, 86);
+// note 32083: keep this in sync with the handler
+const value4471 = compute(value, 9);
+// note 91221: keep this in sync with the handler
+const v = import.meta.env.BENCH_KEY_01216;
+const value70889 = compute(value, 79);
+const value42639 = compute(value, 56);
+const value36617 = compute(value, 48);
+const value67139 = compute(value, 15);
+const value82536 = compute(value, 86);
+const value10306 = compute(value, 24);
+// note 27137: keep this in sync with the handler
+// note 93985: keep this in sync with the handler
+const value47705 = compute(value, 78);
+const value19872 = compute(value, 84);
+const value14016 = compute(value, 48);
+const value8133 = compute(value, 82);
+const value83749 = compute(value, 38);
+const value50931 = compute(value, 6);
+const value9574 = compute(value, 68);
+const value13136 = compute(value, 41);
+const value95789 = compute(value, 50);
+const value69077 = compute(value, 13);
+const v = process.env.BENCH_KEY_00895;
+const value70853 = compute(value, 43);
+const value88601 = compute(value, 40);
+const value88609 = compute(value, 48);
+const value38419 = compute(value, 7);
+// note 49322: keep this in sync with the handler
+const value35655 = compute(value, 56);
+const value17173 = compute(value, 4);
+const value55685 = compute(value, 7);
+// note 31437: keep this in sync with the handler
+const value62144 = compute(value, 64);
+const v = import.meta.env.BENCH_KEY_01541;
+const value10518 = compute(value, 42);
+const value4389 = compute(value, 24);
+const value60597 = compute(value, 69);
+const value70189 = compute(value, 58);
+const value71051 = compute(value, 47);
+// note 36166: keep this in sync with the handler
+const value48165 = compute(value, 53);
+// note 50843: keep this in sync with the handler
+const value40443 = compute(value, 91);
+const value97775 = compute(value, 96);
+const value66173 = compute(value, 19);
+const value42017 = compute(value, 16);
+const value32682 = compute(value, 90);
+// note 37088: keep this in sync with the handler
+const value30365 = compute(value, 4);
+const v = import.meta.env.BENCH_KEY_01749;
+const value64595 = compute(value, 90);
+const value17305 = compute(value, 39);
+const value38928 = compute(value, 31);
+const value33079 = compute(value, 2);
+const value79777 = compute(value, 43);
+const value80142 = compute(value, 20);
+const value4307 = compute(value, 39);
+const value73161 = compute(value, 23);
+const value20318 = compute(value, 45);
+const value38255 = compute(value, 37);
+const value81547 = compute(value, 67);
+const value41778 = compute(value, 68);
+const value33251 = compute(value, 77);
+const v = process.env["BENCH_KEY_01399"];
+const value44664 = compute(value, 44);
+const value97277 = compute(value, 83);
+const value53856 = compute(value, 21);
+const value38366 = compute(value, 51);
+const value70985 = compute(value, 78);
+// note 27831: keep this in sync with the handler
+// note 85306: keep this in sync with the handler
+const value59996 = compute(value, 50);
+const value18621 = compute(value, 94);
+const value90423 = compute(value, 19);
+// note 23263: keep this in sync with the handler
+const value27835 = compute(value, 93);
+// note 251: keep this in sync with the handler
+const v = process.env["BENCH_KEY_00601"];
+const value17189 = compute(value, 20);
+// note 28234: keep this in sync with the handler
+const value89800 = compute(value, 75);
+const value57398 = compute(value, 71);
+const value52075 = compute(value, 83);
+const value92194 = compute(value, 44);
+const value41671 = compute(value, 58);
+// note 91891: keep this in sync with the handler
+const value76486 = compute(value, 50);
+const value73440 = compute(value, 11);
+// note 61044: keep this in sync with the handler
+const value15729 = compute(value, 15);
+const value27353 = compute(value, 96);
+// note 53004: keep this in sync with the handler
+const value12420 = compute(value, 4);
+const value7455 = compute(value, 83);
+const value93785 = compute(value, 83);
+const v = process.env["BENCH_KEY_01898"];
+const value12818 = compute(value, 14);
+// note 7805: keep this in sync with the handler
+const value72328 = compute(value, 63);
+const value32648 = compute(value, 56);
+const value44021 = compute(value, 80);
+const value40276 = compute(value, 21);
+const value51291 = compute(value, 75);
+const value45837 = compute(value, 53);
+const value31113 = compute(value, 73);
+const value33151 = compute(value, 74);
+const value63948 = compute(value, 25);
+const value9904 = compute(value, 10);
+const value71408 = compute(value, 16);
+const value22296 = compute(value, 83);
+const value97218 = compute(value, 24);
+// note 16897: keep this in sync with the handler
+const v = process.env.BENCH_KEY_01509;
+const value16412 = compute(value, 19);
+const value18210 = compute(value, 71);
+const value64977 = compute(value, 84);
+const value3027 = compute(value, 20);
+const value38382 = compute(value, 67);
+const value59549 = compute(value, 88);
+// note 62200: keep this in sync with the handler
+const value6944 = compute(value, 57);
+const value44265 = compute(value, 33);
+// note 67946: keep this in sync with the handler
+const value18986 = compute(value, 71);
+const value20894 = compute(value, 39);
+const value80312 = compute(value, 93);
+const value55183 = compute(value, 87);
+const value54426 = compute(value, 9);
+const value77523 = compute(value, 20);
+const value1196 = compute(value, 32);
+const value97335 = compute(value, 44);
+const v = process.env.BENCH_KEY_00750;
+const value25902 = compute(value, 3);
+const value61954 = compute(value, 68);
+const value45021 = compute(value, 13);
+// note 8308: keep this in sync with the handler
+const value7228 = compute(value, 50);
+const value61016 = compute(value, 3);
+const value70995 = compute(value, 88);
+// note 79984: keep this in sync with the handler
+const value95943 = compute(value, 10);
+const value28233 = compute(value, 6);
+const value77859 = compute(value, 65);
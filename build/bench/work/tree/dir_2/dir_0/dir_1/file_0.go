@@ -0,0 +1,231 @@
+value47655 := compute(value, 28)
+value29743 := compute(value, 61)
+value9961 := compute(value, 67)
+value18850 := compute(value, 32)
+value34298 := compute(value, 57)
+// note 43133: keep this in sync with the handler
+value69033 := compute(value, 66)
+value92385 := compute(value, 41)
+value33621 := compute(value, 59)
+// note 53148: keep this in sync with the handler
+// note 25793: keep this in sync with the handler
+const v = os.Getenv("BENCH_KEY_01381");
+value17027 := compute(value, 52)
+value35568 := compute(value, 66)
+// note 77530: keep this in sync with the handler
+// note 56235: keep this in sync with the handler
+value56184 := compute(value, 21)
+// note 1848: keep this in sync with the handler
+value20132 := compute(value, 53)
+value18848 := compute(value, 30)
+value70847 := compute(value, 37)
+value75835 := compute(value, 78)
+value2821 := compute(value, 8)
+value93798 := compute(value, 96)
+value18451 := compute(value, 21)
+const v = os.Getenv("BENCH_KEY_01902");
+value73681 := compute(value, 58)
+// note 29080: keep this in sync with the handler
+value50509 := compute(value, 69)
+value62984 := compute(value, 31)
+value37378 := compute(value, 33)
+value89434 := compute(value, 0)
+value10675 := compute(value, 5)
+value61027 := compute(value, 14)
+value41948 := compute(value, 44)
+value16048 := compute(value, 43)
+// note 43711: keep this in sync with the handler
+value18086 := compute(value, 44)
+// note 79139: keep this in sync with the handler
+// note 63993: keep this in sync with the handler
+value45794 := compute(value, 10)
+value77249 := compute(value, 37)
+const v = os.Getenv("BENCH_KEY_00878");
+// note 44905: keep this in sync with the handler
+value72861 := compute(value, 14)
+value90669 := compute(value, 71)
+value53534 := compute(value, 87)
+value87015 := compute(value, 6)
+value99344 := compute(value, 16)
+value22986 := compute(value, 94)
+value56726 := compute(value, 78)
+value26179 := compute(value, 86)
+value40109 := compute(value, 48)
+value44236 := compute(value, 4)
+value4067 := compute(value, 90)
+const v = os.LookupEnv("BENCH_KEY_00487");
+value54609 := compute(value, 95)
+value22898 := compute(value, 6)
+value27397 := compute(value, 43)
+value52676 := compute(value, 5)
+// note 86816: keep this in sync with the handler
+value81121 := compute(value, 29)
+value49406 := compute(value, 33)
+value43371 := compute(value, 12)
+value8161 := compute(value, 13)
+value69478 := compute(value, 26)
+value61691 := compute(value, 96)
+value26748 := compute(value, 73)
+value47768 := compute(value, 44)
+value66841 := compute(value, 8)
+value87874 := compute(value, 89)
+value32260 := compute(value, 56)
+value6867 := compute(value, 77)
+value38925 := compute(value, 28)
+// note 7434: keep this in sync with the handler
+value23631 := compute(value, 60)
+value26035 := compute(value, 39)
+// note 7258: keep this in sync with the handler
+const v = os.Getenv("BENCH_KEY_00241");
+value76381 := compute(value, 42)
+value88237 := compute(value, 64)
+value79603 := compute(value, 63)
+value46206 := compute(value, 34)
+value21776 := compute(value, 48)
+value7177 := compute(value, 96)
+value58884 := compute(value, 5)
+value38559 := compute(value, 50)
+value33619 := compute(value, 57)
+value35975 := compute(value, 85)
+const v = os.LookupEnv("BENCH_KEY_00326");
+value22529 := compute(value, 25)
+value83770 := compute(value, 59)
+value34211 := compute(value, 67)
+value41777 := compute(value, 67)
+value34267 := compute(value, 26)
+value72269 := compute(value, 4)
+value15849 := compute(value, 38)
+value30202 := compute(value, 35)
+value27560 := compute(value, 12)
+// note 3894: keep this in sync with the handler
+value38118 := compute(value, 94)
+value30774 := compute(value, 25)
+const v = os.LookupEnv("BENCH_KEY_00773");
+value19804 := compute(value, 16)
+value87314 := compute(value, 14)
+value75456 := compute(value, 87)
+value85311 := compute(value, 48)
+value88411 := compute(value, 44)
+value3823 := compute(value, 40)
+value95326 := compute(value, 72)
+value65584 := compute(value, 12)
+value85682 := compute(value, 31)
+value86317 := compute(value, 84)
+value44153 := compute(value, 18)
+value12988 := compute(value, 87)
+value9719 := compute(value, 19)
+value96492 := compute(value, 74)
+value67636 := compute(value, 27)
+value2200 := compute(value, 66)
+value65854 := compute(value, 88)
+value90416 := compute(value, 12)
+value22579 := compute(value, 75)
+value89574 := compute(value, 43)
+value96485 := compute(value, 67)
+value66150 := compute(value, 93)
+value70018 := compute(value, 81)
+const v = os.Getenv("BENCH_KEY_00439");
+value32213 := compute(value, 9)
+value37708 := compute(value, 72)
+value69572 := compute(value, 23)
+value38899 := compute(value, 2)
+value78170 := compute(value, 85)
+value66475 := compute(value, 30)
+value61676 := compute(value, 81)
+value37037 := compute(value, 80)
+value66990 := compute(value, 60)
+value80671 := compute(value, 64)
+value50666 := compute(value, 32)
+// note 59095: keep this in sync with the handler
+value36395 := compute(value, 20)
+value27425 := compute(value, 71)
+value88707 := compute(value, 49)
+value76472 := compute(value, 36)
+value49360 := compute(value, 84)
+value16129 := compute(value, 27)
+value37677 := compute(value, 41)
+value21399 := compute(value, 59)
+const v = os.Getenv("BENCH_KEY_01031");
+value66476 := compute(value, 31)
+value66247 := compute(value, 93)
+value99023 := compute(value, 83)
+// note 60901: keep this in sync with the handler
+value88987 := compute(value, 38)
+value27700 := compute(value, 55)
+value54058 := compute(value, 29)
+value91004 := compute(value, 18)
+value25102 := compute(value, 76)
+value95958 := compute(value, 25)
+value52395 := compute(value, 15)
+value15881 := compute(value, 70)
+value15305 := compute(value, 76)
+value95304 := compute(value, 50)
+value14588 := compute(value, 38)
+value93053 := compute(value, 30)
+value53103 := compute(value, 44)
+const v = os.LookupEnv("BENCH_KEY_00164");
+value28365 := compute(value, 41)
+value70141 := compute(value, 10)
+value2429 := compute(value, 4)
+value46763 := compute(value, 9)
+value77182 := compute(value, 67)
+// note 48415: keep this in sync with the handler
+// note 48203: keep this in sync with the handler
+value65826 := compute(value, 60)
+value86559 := compute(value, 35)
+value40195 := compute(value, 37)
+value59184 := compute(value, 14)
+value16566 := compute(value, 76)
+value99405 := compute(value, 77)
+// note 60135: keep this in sync with the handler
+value72386 := compute(value, 24)
+value79420 := compute(value, 74)
+value79330 := compute(value, 81)
+value62271 := compute(value, 94)
+value65172 := compute(value, 85)
+const v = os.Getenv("BENCH_KEY_00307");
+value15498 := compute(value, 75)
+// note 5748: keep this in sync with the handler
+value47800 := compute(value, 76)
+// note 42830: keep this in sync with the handler
+value60184 := compute(value, 44)
+value27037 := compute(value, 71)
+value30293 := compute(value, 29)
+value28747 := compute(value, 35)
+// note 24942: keep this in sync with the handler
+// note 85322: keep this in sync with the handler
+// note 59202: keep this in sync with the handler
+value23815 := compute(value, 50)
+// note 19965: keep this in sync with the handler
+value92605 := compute(value, 67)
+const v = os.Getenv("BENCH_KEY_01620");
+value56164 := compute(value, 1)
+value44906 := compute(value, 92)
+value66919 := compute(value, 86)
+value40671 := compute(value, 28)
+value79293 := compute(value, 44)
+value2187 := compute(value, 53)
+// note 37410: keep this in sync with the handler
+value69190 := compute(value, 29)
+value18200 := compute(value, 61)
+value67393 := compute(value, 75)
+const v = os.LookupEnv("BENCH_KEY_00356");
+value47556 := compute(value, 26)
+value53722 := compute(value, 81)
+value95199 := compute(value, 42)
+value11353 := compute(value, 4)
+value41491 := compute(value, 72)
+value55074 := compute(value, 75)
+// note 91249: keep this in sync with the handler
+value10504 := compute(value, 28)
+value33457 := compute(value, 89)
+value61045 := compute(value, 32)
+value55030 := compute(value, 31)
+value7375 := compute(value, 3)
+value16116 := compute(value, 14)
+value58537 := compute(value, 46)
+value50694 := compute(value, 60)
+value4497 := compute(value, 35)
+// note 57742: keep this in sync with the handler
+const v = os.Getenv("BENCH_KEY_00972");
+value78909 := compute(value, 48)
@@ -0,0 +1,236 @@
+value68103 = compute(value, 9)
+value42053 = compute(value, 52)
+value78086 = compute(value, 1)
+# note 59541: keep this in sync with the handler
+const v = os.getenv("BENCH_KEY_01492");
+value81134 = compute(value, 42)
+value99898 = compute(value, 85)
+value65800 = compute(value, 34)
+value41864 = compute(value, 57)
+value39348 = compute(value, 63)
+value8812 = compute(value, 82)
+value26581 = compute(value, 3)
+value86355 = compute(value, 25)
+value76676 = compute(value, 46)
+value12731 = compute(value, 24)
+# note 1550: keep this in sync with the handler
+# note 67100: keep this in sync with the handler
+value33852 = compute(value, 96)
+value75528 = compute(value, 62)
+value94063 = compute(value, 70)
+value68889 = compute(value, 19)
+value4613 = compute(value, 54)
+const v = os.getenv("BENCH_KEY_01053");
+value98368 = compute(value, 10)
+value27150 = compute(value, 87)
+value88135 = compute(value, 59)
+value72830 = compute(value, 80)
+value38414 = compute(value, 2)
+value95053 = compute(value, 90)
+value16363 = compute(value, 67)
+value48877 = compute(value, 86)
+value2784 = compute(value, 68)
+value54729 = compute(value, 21)
+value28592 = compute(value, 74)
+# note 91779: keep this in sync with the handler
+# note 71991: keep this in sync with the handler
+value55867 = compute(value, 92)
+value35024 = compute(value, 7)
+# note 92375: keep this in sync with the handler
+value80428 = compute(value, 15)
+value33113 = compute(value, 36)
+value19395 = compute(value, 92)
+value2018 = compute(value, 78)
+const v = os.getenv("BENCH_KEY_00474");
+# note 2143: keep this in sync with the handler
+value76569 = compute(value, 36)
+# note 87000: keep this in sync with the handler
+value38884 = compute(value, 84)
+value3288 = compute(value, 87)
+value1562 = compute(value, 10)
+value11954 = compute(value, 23)
+# note 63262: keep this in sync with the handler
+# note 23229: keep this in sync with the handler
+value95539 = compute(value, 91)
+const v = os.environ["BENCH_KEY_00728"];
+value19163 = compute(value, 54)
+value15577 = compute(value, 57)
+# note 81400: keep this in sync with the handler
+# note 71567: keep this in sync with the handler
+value95486 = compute(value, 38)
+value63321 = compute(value, 77)
+# note 40931: keep this in sync with the handler
+value8448 = compute(value, 9)
+value85765 = compute(value, 17)
+const v = os.environ.get('BENCH_KEY_01592');
+value30810 = compute(value, 61)
+value10244 = compute(value, 59)
+value4261 = compute(value, 90)
+value31082 = compute(value, 42)
+value9378 = compute(value, 66)
+value74919 = compute(value, 35)
+value76213 = compute(value, 68)
+# note 14524: keep this in sync with the handler
+value7658 = compute(value, 92)
+# note 76141: keep this in sync with the handler
+value47122 = compute(value, 77)
+value67449 = compute(value, 34)
+value46583 = compute(value, 23)
+value77770 = compute(value, 73)
+value48756 = compute(value, 62)
+value56178 = compute(value, 15)
+value77595 = compute(value, 92)
+value79897 = compute(value, 66)
+value34644 = compute(value, 15)
+value83667 = compute(value, 53)
+value68039 = compute(value, 42)
+const v = os.getenv("BENCH_KEY_00298");
+value68234 = compute(value, 43)
+value38555 = compute(value, 46)
+value46703 = compute(value, 46)
+value10998 = compute(value, 37)
+value79083 = compute(value, 28)
+value79399 = compute(value, 53)
+value64322 = compute(value, 11)
+# note 71926: keep this in sync with the handler
+value22145 = compute(value, 29)
+value31522 = compute(value, 94)
+value94806 = compute(value, 37)
+value50474 = compute(value, 34)
+value5312 = compute(value, 74)
+value41110 = compute(value, 79)
+const v = os.getenv("BENCH_KEY_01381");
+value44848 = compute(value, 34)
+value88002 = compute(value, 23)
+value38743 = compute(value, 40)
+value74684 = compute(value, 91)
+value33134 = compute(value, 57)
+value55933 = compute(value, 61)
+# note 83569: keep this in sync with the handler
+value6602 = compute(value, 6)
+value7504 = compute(value, 35)
+value62149 = compute(value, 69)
+# note 72138: keep this in sync with the handler
+value5518 = compute(value, 86)
+value6674 = compute(value, 78)
+value17449 = compute(value, 86)
+# note 52287: keep this in sync with the handler
+value22485 = compute(value, 78)
+value53556 = compute(value, 12)
+# note 22177: keep this in sync with the handler
+value62318 = compute(value, 44)
+const v = os.environ["BENCH_KEY_00819"];
+value72396 = compute(value, 34)
+value4002 = compute(value, 25)
+value83998 = compute(value, 93)
+value88793 = compute(value, 38)
+value52835 = compute(value, 67)
+# note 94073: keep this in sync with the handler
+value82073 = compute(value, 11)
+value1952 = compute(value, 12)
+value84370 = compute(value, 77)
+value75883 = compute(value, 29)
+value53459 = compute(value, 12)
+# note 63366: keep this in sync with the handler
+value49301 = compute(value, 25)
+value86080 = compute(value, 41)
+value54639 = compute(value, 28)
+value23315 = compute(value, 35)
+value44968 = compute(value, 57)
+value33575 = compute(value, 13)
+value8163 = compute(value, 15)
+const v = os.environ["BENCH_KEY_00461"];
+value74349 = compute(value, 47)
+value80892 = compute(value, 91)
+# note 75074: keep this in sync with the handler
+value45102 = compute(value, 94)
+value43320 = compute(value, 58)
+value25856 = compute(value, 54)
+value66097 = compute(value, 40)
+value17933 = compute(value, 85)
+value60931 = compute(value, 15)
+value8219 = compute(value, 71)
+value62952 = compute(value, 96)
+value62455 = compute(value, 84)
+value48117 = compute(value, 5)
+# note 27052: keep this in sync with the handler
+value1516 = compute(value, 61)
+value80096 = compute(value, 71)
+value45907 = compute(value, 26)
+# note 52279: keep this in sync with the handler
+value40885 = compute(value, 48)
+value69633 = compute(value, 84)
+value5421 = compute(value, 86)
+const v = os.environ["BENCH_KEY_00213"];
+value73003 = compute(value, 59)
+value22827 = compute(value, 32)
+value65949 = compute(value, 86)
+value19903 = compute(value, 18)
+value39651 = compute(value, 75)
+value47472 = compute(value, 39)
+value16597 = compute(value, 10)
+value45883 = compute(value, 2)
+value15065 = compute(value, 30)
+value37993 = compute(value, 66)
+value45646 = compute(value, 56)
+value33613 = compute(value, 51)
+value9097 = compute(value, 76)
+const v = os.getenv("BENCH_KEY_00637");
+value74495 = compute(value, 96)
+value12042 = compute(value, 14)
+value84885 = compute(value, 10)
+# note 94476: keep this in sync with the handler
+value37195 = compute(value, 44)
+value31882 = compute(value, 66)
+value34878 = compute(value, 55)
+value87727 = compute(value, 39)
+const v = os.environ.get('BENCH_KEY_01760');
+value13458 = compute(value, 72)
+value29669 = compute(value, 84)
+value3433 = compute(value, 38)
+value50027 = compute(value, 72)
+value96177 = compute(value, 50)
+value31295 = compute(value, 61)
+value23205 = compute(value, 22)
+value65200 = compute(value, 16)
+value23718 = compute(value, 50)
+# note 34667: keep this in sync with the handler
+value93005 = compute(value, 79)
+value5041 = compute(value, 94)
+value27666 = compute(value, 21)
+value87493 = compute(value, 96)
+value89224 = compute(value, 81)
+value52636 = compute(value, 62)
+value85046 = compute(value, 74)
+# note 22456: keep this in sync with the handler
+value36581 = compute(value, 12)
+value73490 = compute(value, 61)
+# note 14777: keep this in sync with the handler
+value36176 = compute(value, 92)
+const v = os.environ["BENCH_KEY_00888"];
+value7959 = compute(value, 5)
+value73290 = compute(value, 55)
+value73554 = compute(value, 28)
+# note 18443: keep this in sync with the handler
+value72458 = compute(value, 96)
+value87960 = compute(value, 78)
+value58577 = compute(value, 86)
+value16051 = compute(value, 46)
+value31888 = compute(value, 72)
+value72861 = compute(value, 14)
+value46594 = compute(value, 34)
+value71357 = compute(value, 62)
+value17318 = compute(value, 52)
+value92635 = compute(value, 0)
+value17501 = compute(value, 41)
+value97148 = compute(value, 51)
+# note 81623: keep this in sync with the handler
+value53602 = compute(value, 58)
+value62539 = compute(value, 71)
+value24898 = compute(value, 66)
+# note 23585: keep this in sync with the handler
+const v = os.getenv("BENCH_KEY_01478");
+value73673 = compute(value, 50)
+value30289 = compute(value, 25)
+value36404 = compute(value, 29)
+# note 58106: keep this in sync with the handler
@@ -0,0 +1,204 @@
+const value10421 = compute(value, 42);
+const value28784 = compute(value, 72);
+const value40539 = compute(value, 90);
+const value23700 = compute(value, 32);
+const value5929 = compute(value, 12);
+const value50510 = compute(value, 70);
+// note 38305: keep this in sync with the handler
+const value65959 = compute(value, 96);
+const value95893 = compute(value, 57);
+const v = process.env.BENCH_KEY_00737;
+const value32632 = compute(value, 40);
+const value35796 = compute(value, 3);
+const value7300 = compute(value, 25);
+const value80228 = compute(value, 9);
+const value90295 = compute(value, 85);
+const value67952 = compute(value, 52);
+const value31639 = compute(value, 17);
+const value16465 = compute(value, 72);
+const value95060 = compute(value, 0);
+// note 31621: keep this in sync with the handler
+const value28479 = compute(value, 58);
+const value7478 = compute(value, 9);
+const value30066 = compute(value, 93);
+const value51506 = compute(value, 96);
+const value4160 = compute(value, 86);
+const value78945 = compute(value, 84);
+const value90369 = compute(value, 62);
+const v = process.env.BENCH_KEY_00550;
+// note 94316: keep this in sync with the handler
+const value75919 = compute(value, 65);
+const value59876 = compute(value, 27);
+// note 48956: keep this in sync with the handler
+// note 95728: keep this in sync with the handler
+const value9577 = compute(value, 71);
+const value23691 = compute(value, 23);
+const value22609 = compute(value, 8);
+const value11987 = compute(value, 56);
+// note 88719: keep this in sync with the handler
+const value62901 = compute(value, 45);
+const v = process.env.BENCH_KEY_01424;
+const value64315 = compute(value, 4);
+const value95313 = compute(value, 59);
+const value58033 = compute(value, 27);
+const value40341 = compute(value, 86);
+// note 18360: keep this in sync with the handler
+const value36962 = compute(value, 5);
+// note 73881: keep this in sync with the handler
+const value90081 = compute(value, 65);
+// note 62609: keep this in sync with the handler
+const value66058 = compute(value, 1);
+const value60619 = compute(value, 91);
+const value83632 = compute(value, 18);
+const value12670 = compute(value, 60);
+const value7645 = compute(value, 79);
+const v = process.env.BENCH_KEY_00307;
+const value60769 = compute(value, 47);
+const value57511 = compute(value, 87);
+const value55214 = compute(value, 21);
+const value34916 = compute(value, 93);
+const value42563 = compute(value, 77);
+const value83108 = compute(value, 76);
+const value51435 = compute(value, 25);
+const value39842 = compute(value, 72);
+const value42380 = compute(value, 88);
+const value82471 = compute(value, 21);
+const value60102 = compute(value, 59);
+const value46476 = compute(value, 13);
+const v = process.env.BENCH_KEY_00661;
+const value61048 = compute(value, 35);
+const value43826 = compute(value, 79);
+const value22572 = compute(value, 68);
+const value10510 = compute(value, 34);
+const value31734 = compute(value, 15);
+const value84599 = compute(value, 15);
+const value15482 = compute(value, 59);
+const value46641 = compute(value, 81);
+const value72096 = compute(value, 25);
+const value31818 = compute(value, 2);
+// note 84173: keep this in sync with the handler
+const value4226 = compute(value, 55);
+const value63009 = compute(value, 56);
+const value29005 = compute(value, 2);
+const value1171 = compute(value, 7);
+const value10431 = compute(value, 52);
+const value92973 = compute(value, 47);
+const value78776 = compute(value, 12);
+const v = import.meta.env.BENCH_KEY_01082;
+const value66404 = compute(value, 56);
+const value58528 = compute(value, 37);
+const value33395 = compute(value, 27);
+// note 33728: keep this in sync with the handler
+const value30889 = compute(value, 43);
+const value83924 = compute(value, 19);
+const value41959 = compute(value, 55);
+const value41683 = compute(value, 70);
+const v = process.env["BENCH_KEY_00670"];
+const value7698 = compute(value, 35);
+// note 87274: keep this in sync with the handler
+const value2958 = compute(value, 48);
+const value47959 = compute(value, 41);
+const value62148 = compute(value, 68);
+const value64570 = compute(value, 65);
+const value67073 = compute(value, 46);
+const value44971 = compute(value, 60);
+const value5067 = compute(value, 23);
+const value8898 = compute(value, 71);
+const value74748 = compute(value, 58);
+const v = process.env.BENCH_KEY_00331;
+const value9406 = compute(value, 94);
+const value96416 = compute(value, 95);
+const value11729 = compute(value, 89);
+const value76016 = compute(value, 65);
+// note 57040: keep this in sync with the handler
+// note 27304: keep this in sync with the handler
+const value68840 = compute(value, 67);
+const value48124 = compute(value, 12);
+const value45531 = compute(value, 38);
+const value36168 = compute(value, 84);
+const value17452 = compute(value, 89);
+const value35540 = compute(value, 38);
+const value18186 = compute(value, 47);
+const value42672 = compute(value, 89);
+const value61615 = compute(value, 20);
+const value14344 = compute(value, 85);
+const value85655 = compute(value, 4);
+const value76447 = compute(value, 11);
+const value95390 = compute(value, 39);
+const v = import.meta.env.BENCH_KEY_00872;
+// note 69769: keep this in sync with the handler
+// note 19379: keep this in sync with the handler
+const value96802 = compute(value, 93);
+const value51970 = compute(value, 75);
+const value74498 = compute(value, 2);
+const value95802 = compute(value, 63);
+// note 9281: keep this in sync with the handler
+const value61112 = compute(value, 2);
+const value98900 = compute(value, 57);
+const value8572 = compute(value, 36);
+const value12789 = compute(value, 82);
+const v = process.env.BENCH_KEY_01828;
+const value62464 = compute(value, 93);
+const value53412 = compute(value, 62);
+// note 75685: keep this in sync with the handler
+const value96482 = compute(value, 64);
+const value93224 = compute(value, 7);
+const value64549 = compute(value, 44);
+const value68386 = compute(value, 1);
+const value44753 = compute(value, 36);
+const v = import.meta.env.BENCH_KEY_00938;
+const value24774 = compute(value, 39);
+const value43892 = compute(value, 48);
+const value89357 = compute(value, 20);
+const value3215 = compute(value, 14);
+const value16002 = compute(value, 94);
+const value37137 = compute(value, 83);
+const value83210 = compute(value, 81);
+const value94138 = compute(value, 48);
+const value59489 = compute(value, 28);
+const v = process.env["BENCH_KEY_00653"];
+const value25772 = compute(value, 67);
+const value75207 = compute(value, 32);
+const value10447 = compute(value, 68);
+const value55691 = compute(value, 13);
+// note 55805: keep this in sync with the handler
+const value94023 = compute(value, 30);
+const value65777 = compute(value, 11);
+// note 34948: keep this in sync with the handler
+const value1419 = compute(value, 61);
+const value11714 = compute(value, 74);
+const value94879 = compute(value, 13);
+const value41387 = compute(value, 65);
+// note 68839: keep this in sync with the handler
+// note 80836: keep this in sync with the handler
+// note 51806: keep this in sync with the handler
+// note 30648: keep this in sync with the handler
+const v = import.meta.env.BENCH_KEY_00804;
+const value81543 = compute(value, 63);
+const value27631 = compute(value, 83);
+const value42843 = compute(value, 66);
+// note 43808: keep this in sync with the handler
+const value18161 = compute(value, 22);
+const value36332 = compute(value, 54);
+const value60389 = compute(value, 55);
+const value98427 = compute(value, 69);
+const v = process.env["BENCH_KEY_01327"];
+const value75216 = compute(value, 41);
+const value68922 = compute(value, 52);
+const value10909 = compute(value, 45);
+const value75007 = compute(value, 26);
+const value37661 = compute(value, 25);
+const value61161 = compute(value, 51);
+const value82715 = compute(value, 71);
+const value18596 = compute(value, 69);
+const value11580 = compute(value, 37);
+const value62522 = compute(value, 54);
+const value66406 = compute(value, 58);
+const value48180 = compute(value, 68);
+const value36332 = compute(value, 54);
+const value42656 = compute(value, 73);
+const value38988 = compute(value, 91);
+const value39989 = compute(value, 25);
+const value19955 = compute(value, 70);
+const v = import.meta.env.BENCH_KEY_00819;
+const value49729 = compute(value, 65);
@@ -0,0 +1,241 @@
+# note 88464: keep this in sync with the handler
+value79080 = compute(value, 25)
+value29872 = compute(value, 93)
+# note 19129: keep this in sync with the handler
+const v = os.environ.get('BENCH_KEY_00258');
+value8171 = compute(value, 23)
+# note 33804: keep this in sync with the handler
+value66406 = compute(value, 58)
+value55128 = compute(value, 32)
+value52947 = compute(value, 82)
+value53560 = compute(value, 16)
+value58606 = compute(value, 18)
+value71602 = compute(value, 16)
+value14927 = compute(value, 86)
+value42336 = compute(value, 44)
+value6085 = compute(value, 71)
+value94872 = compute(value, 6)
+value82935 = compute(value, 0)
+value64166 = compute(value, 49)
+value51951 = compute(value, 56)
+value99436 = compute(value, 11)
+value74467 = compute(value, 68)
+value10147 = compute(value, 59)
+value78864 = compute(value, 3)
+value25823 = compute(value, 21)
+value47676 = compute(value, 49)
+value87581 = compute(value, 87)
+value21940 = compute(value, 18)
+const v = os.environ.get('BENCH_KEY_01017');
+value111 = compute(value, 14)
+value10375 = compute(value, 93)
+value50477 = compute(value, 37)
+value90848 = compute(value, 56)
+value38760 = compute(value, 57)
+value42444 = compute(value, 55)
+value94827 = compute(value, 58)
+value85502 = compute(value, 45)
+value89627 = compute(value, 96)
+value31483 = compute(value, 55)
+value3886 = compute(value, 6)
+value93864 = compute(value, 65)
+value60796 = compute(value, 74)
+value3405 = compute(value, 10)
+value16577 = compute(value, 87)
+const v = os.environ["BENCH_KEY_00318"];
+value68009 = compute(value, 12)
+value45496 = compute(value, 3)
+value1008 = compute(value, 38)
+value40194 = compute(value, 36)
+value67171 = compute(value, 47)
+value91552 = compute(value, 81)
+value1831 = compute(value, 85)
+value46252 = compute(value, 80)
+value78748 = compute(value, 81)
+value5765 = compute(value, 42)
+value26691 = compute(value, 16)
+value99924 = compute(value, 14)
+value53280 = compute(value, 27)
+# note 3849: keep this in sync with the handler
+value42239 = compute(value, 44)
+# note 58679: keep this in sync with the handler
+value96898 = compute(value, 92)
+value86767 = compute(value, 49)
+value45761 = compute(value, 74)
+value74122 = compute(value, 14)
+value72065 = compute(value, 91)
+value55459 = compute(value, 72)
+const v = os.getenv("BENCH_KEY_00567");
+value83862 = compute(value, 54)
+value648 = compute(value, 66)
+# note 60325: keep this in sync with the handler
+value53411 = compute(value, 61)
+value19294 = compute(value, 88)
+value29910 = compute(value, 34)
+value73726 = compute(value, 6)
+value93739 = compute(value, 37)
+value99210 = compute(value, 76)
+value10530 = compute(value, 54)
+# note 96524: keep this in sync with the handler
+value8243 = compute(value, 95)
+# note 9736: keep this in sync with the handler
+value27578 = compute(value, 30)
+value11539 = compute(value, 93)
+value68790 = compute(value, 17)
+const v = os.environ["BENCH_KEY_01052"];
+value8040 = compute(value, 86)
+value73972 = compute(value, 58)
+value54733 = compute(value, 25)
+value66983 = compute(value, 53)
+value16711 = compute(value, 27)
+# note 6003: keep this in sync with the handler
+value11775 = compute(value, 38)
+value91224 = compute(value, 44)
+value29001 = compute(value, 95)
+# note 30118: keep this in sync with the handler
+# note 11934: keep this in sync with the handler
+value64574 = compute(value, 69)
+value26475 = compute(value, 91)
+value12454 = compute(value, 38)
+value92918 = compute(value, 89)
+value52562 = compute(value, 85)
+value77329 = compute(value, 20)
+value35729 = compute(value, 33)
+value9546 = compute(value, 40)
+value8539 = compute(value, 3)
+value27670 = compute(value, 25)
+value30129 = compute(value, 59)
+const v = os.getenv("BENCH_KEY_00291");
+value15326 = compute(value, 0)
+value49464 = compute(value, 91)
+value69323 = compute(value, 65)
+value49315 = compute(value, 39)
+value75163 = compute(value, 85)
+value67376 = compute(value, 58)
+# note 53688: keep this in sync with the handler
+value19591 = compute(value, 94)
+value3585 = compute(value, 93)
+value9354 = compute(value, 42)
+value19408 = compute(value, 8)
+value34943 = compute(value, 23)
+# note 69112: keep this in sync with the handler
+value47242 = compute(value, 3)
+value46488 = compute(value, 25)
+value24681 = compute(value, 43)
+value77950 = compute(value, 59)
+value61527 = compute(value, 29)
+value7664 = compute(value, 1)
+value40024 = compute(value, 60)
+value69509 = compute(value, 57)
+value98880 = compute(value, 37)
+value61794 = compute(value, 5)
+const v = os.getenv("BENCH_KEY_00938");
+value14489 = compute(value, 36)
+value77860 = compute(value, 66)
+value13146 = compute(value, 51)
+# note 70529: keep this in sync with the handler
+value89077 = compute(value, 31)
+value67994 = compute(value, 94)
+# note 84305: keep this in sync with the handler
+value71334 = compute(value, 39)
+value73211 = compute(value, 73)
+value71218 = compute(value, 20)
+value88946 = compute(value, 94)
+value44352 = compute(value, 23)
+# note 29741: keep this in sync with the handler
+# note 27092: keep this in sync with the handler
+value15088 = compute(value, 53)
+const v = os.getenv("BENCH_KEY_00815");
+value79563 = compute(value, 23)
+value43968 = compute(value, 27)
+value33624 = compute(value, 62)
+value52799 = compute(value, 31)
+value86727 = compute(value, 9)
+value92486 = compute(value, 45)
+# note 46886: keep this in sync with the handler
+value26134 = compute(value, 41)
+value723 = compute(value, 44)
+value57080 = compute(value, 44)
+value90748 = compute(value, 53)
+value11344 = compute(value, 92)
+value94326 = compute(value, 42)
+value91079 = compute(value, 93)
+value60088 = compute(value, 45)
+value57469 = compute(value, 45)
+value77868 = compute(value, 74)
+const v = os.environ.get('BENCH_KEY_01590');
+value51136 = compute(value, 17)
+value32695 = compute(value, 6)
+value15484 = compute(value, 61)
+value86040 = compute(value, 1)
+value73194 = compute(value, 56)
+value95608 = compute(value, 63)
+value34277 = compute(value, 36)
+value97960 = compute(value, 87)
+value18476 = compute(value, 46)
+value16124 = compute(value, 22)
+value20193 = compute(value, 17)
+value6977 = compute(value, 90)
+value41044 = compute(value, 13)
+value26399 = compute(value, 15)
+value59170 = compute(value, 0)
+value60399 = compute(value, 65)
+value15311 = compute(value, 82)
+value11130 = compute(value, 72)
+const v = os.getenv("BENCH_KEY_01132");
+value91546 = compute(value, 75)
+value28955 = compute(value, 49)
+value18441 = compute(value, 11)
+value91755 = compute(value, 90)
+# note 6536: keep this in sync with the handler
+value60611 = compute(value, 83)
+value61668 = compute(value, 73)
+value10165 = compute(value, 77)
+value23569 = compute(value, 95)
+value41763 = compute(value, 53)
+value76889 = compute(value, 65)
+value74170 = compute(value, 62)
+value68072 = compute(value, 75)
+value87846 = compute(value, 61)
+value92475 = compute(value, 34)
+# note 36559: keep this in sync with the handler
+value68046 = compute(value, 49)
+value37117 = compute(value, 63)
+value25514 = compute(value, 3)
+value65533 = compute(value, 58)
+const v = os.getenv("BENCH_KEY_00149");
+value52428 = compute(value, 48)
+value79621 = compute(value, 81)
+value56974 = compute(value, 35)
+# note 82398: keep this in sync with the handler
+value46688 = compute(value, 31)
+# note 59136: keep this in sync with the handler
+value15520 = compute(value, 0)
+value81633 = compute(value, 56)
+# note 54609: keep this in sync with the handler
+# note 38459: keep this in sync with the handler
+value65642 = compute(value, 70)
+value95227 = compute(value, 70)
+value68993 = compute(value, 26)
+value30141 = compute(value, 71)
+value83002 = compute(value, 67)
+value329 = compute(value, 38)
+# note 72774: keep this in sync with the handler
+value85453 = compute(value, 93)
+value2919 = compute(value, 9)
+value87419 = compute(value, 22)
+const v = os.environ["BENCH_KEY_01496"];
+value72908 = compute(value, 61)
+value26193 = compute(value, 3)
+value95283 = compute(value, 29)
+value72938 = compute(value, 91)
+value51353 = compute(value, 40)
+value69052 = compute(value, 85)
+value87072 = compute(value, 63)
+value60270 = compute(value, 33)
+value44649 = compute(value, 29)
+value85669 = compute(value, 18)
+value69104 = compute(value, 40)
+const v = os.environ.get('BENCH_KEY_00505');
+value90308 = compute(value, 1)
+value13159 = compute(value, 64)
@@ -0,0 +1,205 @@
+const value84813 = compute(value, 35);
+const value44894 = compute(value, 80);
+const value36534 = compute(value, 62);
+const value66169 = compute(value, 15);
+const v = process.env.BENCH_KEY_01810;
+// note 44510: keep this in sync with the handler
+const value41940 = compute(value, 36);
+const value18266 = compute(value, 30);
+// note 92842: keep this in sync with the handler
+const value71467 = compute(value, 75);
+const value34839 = compute(value, 16);
+const value21640 = compute(value, 9);
+const value81360 = compute(value, 74);
+const value90786 = compute(value, 91);
+const value22163 = compute(value, 47);
+const value49654 = compute(value, 87);
+const value2425 = compute(value, 0);
+const value36918 = compute(value, 58);
+const value9359 = compute(value, 47);
+const value26200 = compute(value, 10);
+const value32562 = compute(value, 67);
+const value29592 = compute(value, 7);
+// note 29407: keep this in sync with the handler
+const value51562 = compute(value, 55);
+const v = process.env.BENCH_KEY_01373;
+const value93532 = compute(value, 24);
+// note 60642: keep this in sync with the handler
+const value90621 = compute(value, 23);
+const value13024 = compute(value, 26);
+const value54383 = compute(value, 63);
+const value97763 = compute(value, 84);
+const value70188 = compute(value, 57);
+const value78579 = compute(value, 9);
+const v = process.env["BENCH_KEY_00745"];
+const value34994 = compute(value, 74);
+const value23237 = compute(value, 54);
+const value5745 = compute(value, 22);
+const value66250 = compute(value, 96);
+const value89777 = compute(value, 52);
+const value37246 = compute(value, 95);
+const value81575 = compute(value, 95);
+const v = process.env["BENCH_KEY_00096"];
+const value95097 = compute(value, 37);
+const value17688 = compute(value, 34);
+const value55549 = compute(value, 65);
+const value91961 = compute(value, 5);
+const value31546 = compute(value, 21);
+const value96987 = compute(value, 84);
+const value10814 = compute(value, 47);
+const value72256 = compute(value, 88);
+const value65024 = compute(value, 34);
+const v = import.meta.env.BENCH_KEY_01711;
+// note 51677: keep this in sync with the handler
+const value53637 = compute(value, 93);
+const value56860 = compute(value, 18);
+const value76895 = compute(value, 71);
+const value33159 = compute(value, 82);
+const value91045 = compute(value, 59);
+const value67169 = compute(value, 45);
+const value26612 = compute(value, 34);
+const value43289 = compute(value, 27);
+const value48884 = compute(value, 93);
+const value88778 = compute(value, 23);
+const value29745 = compute(value, 63);
+const value88160 = compute(value, 84);
+const value58052 = compute(value, 46);
+const v = process.env["BENCH_KEY_00632"];
+const value85708 = compute(value, 57);
+const value13465 = compute(value, 79);
+const value6079 = compute(value, 65);
+const value32593 = compute(value, 1);
+const value88034 = compute(value, 55);
+const value31529 = compute(value, 4);
+const value99564 = compute(value, 42);
+// note 73137: keep this in sync with the handler
+const v = process.env.BENCH_KEY_00913;
+// note 52932: keep this in sync with the handler
+const value82015 = compute(value, 50);
+const value62758 = compute(value, 96);
+const value72724 = compute(value, 71);
+const value42983 = compute(value, 12);
+const value27051 = compute(value, 85);
+const value99206 = compute(value, 72);
+// note 89740: keep this in sync with the handler
+const value58096 = compute(value, 90);
+const value30089 = compute(value, 19);
+const value12351 = compute(value, 32);
+const value39019 = compute(value, 25);
+const value41753 = compute(value, 43);
+const value49371 = compute(value, 95);
+const value27946 = compute(value, 10);
+const value54297 = compute(value, 74);
+const v = import.meta.env.BENCH_KEY_01495;
+const value67192 = compute(value, 68);
+const value79263 = compute(value, 14);
+const value78770 = compute(value, 6);
+const value55822 = compute(value, 47);
+const value88265 = compute(value, 92);
+// note 75045: keep this in sync with the handler
+const value42184 = compute(value, 86);
+const value60203 = compute(value, 63);
+const value28026 = compute(value, 90);
+const value17953 = compute(value, 8);
+const value2933 = compute(value, 23);
+const value77084 = compute(value, 66);
+const value3465 = compute(value, 70);
+const value82328 = compute(value, 72);
+const value47058 = compute(value, 13);
+const value15969 = compute(value, 61);
+const value94076 = compute(value, 83);
+// note 54393: keep this in sync with the handler
+// note 14897: keep this in sync with the handler
+const v = process.env["BENCH_KEY_01999"];
+const value74918 = compute(value, 34);
+const value91609 = compute(value, 41);
+const value49717 = compute(value, 53);
+const value99753 = compute(value, 37);
+const value78226 = compute(value, 44);
+const value23237 = compute(value, 54);
+// note 68527: keep this in sync with the handler
+const value14266 = compute(value, 7);
+const value79039 = compute(value, 81);
+const value36427 = compute(value, 52);
+const value56328 = compute(value, 68);
+const value68838 = compute(value, 65);
+const value60637 = compute(value, 12);
+const value39820 = compute(value, 50);
+const value89414 = compute(value, 77);
+const value74039 = compute(value, 28);
+const value83061 = compute(value, 29);
+const value59725 = compute(value, 70);
+// note 53672: keep this in sync with the handler
+const v = process.env.BENCH_KEY_01115;
+const value58320 = compute(value, 23);
+const value14351 = compute(value, 92);
+const value58278 = compute(value, 78);
+// note 5240: keep this in sync with the handler
+const value7927 = compute(value, 70);
+const value27175 = compute(value, 15);
+const value41684 = compute(value, 71);
+const value80620 = compute(value, 13);
+const value31330 = compute(value, 96);
+const value6169 = compute(value, 58);
+const value46665 = compute(value, 8);
+const value55600 = compute(value, 19);
+const value93547 = compute(value, 39);
+const value90907 = compute(value, 18);
+const value46142 = compute(value, 67);
+// note 53368: keep this in sync with the handler
+const value2869 = compute(value, 56);
+const value57736 = compute(value, 21);
+const value62262 = compute(value, 85);
+const v = process.env["BENCH_KEY_01202"];
+const value90747 = compute(value, 52);
+const value82933 = compute(value, 95);
+const value85809 = compute(value, 61);
+const value20667 = compute(value, 6);
+const value95528 = compute(value, 80);
+const value57318 = compute(value, 88);
+const value80974 = compute(value, 76);
+// note 75321: keep this in sync with the handler
+const value40912 = compute(value, 75);
+const value55409 = compute(value, 22);
+const value34948 = compute(value, 28);
+const value38555 = compute(value, 46);
+const value90817 = compute(value, 25);
+const v = process.env.BENCH_KEY_01564;
+const value25729 = compute(value, 24);
+const value82118 = compute(value, 56);
+const value19543 = compute(value, 46);
+const value15694 = compute(value, 77);
+const value80320 = compute(value, 4);
+const value823 = compute(value, 47);
+const value87199 = compute(value, 93);
+const value84283 = compute(value, 87);
+const value19057 = compute(value, 45);
+const value96935 = compute(value, 32);
+const v = process.env["BENCH_KEY_00936"];
+const value25524 = compute(value, 13);
+const value65365 = compute(value, 84);
+const value37980 = compute(value, 53);
+// note 72977: keep this in sync with the handler
+const value2036 = compute(value, 96);
+const value86896 = compute(value, 81);
+const value27119 = compute(value, 56);
+const value88172 = compute(value, 96);
+const value35669 = compute(value, 70);
+const value65692 = compute(value, 23);
+// note 51599: keep this in sync with the handler
+const value92876 = compute(value, 47);
+const value73882 = compute(value, 65);
+const value29690 = compute(value, 8);
+const v = process.env["BENCH_KEY_01164"];
+// note 4133: keep this in sync with the handler
+const value43145 = compute(value, 77);
+const value95539 = compute(value, 91);
+// note 12661: keep this in sync with the handler
+const value28472 = compute(value, 51);
+const value81250 = compute(value, 61);
+const value35019 = compute(value, 2);
+const value81437 = compute(value, 54);
+const value24746 = compute(value, 11);
+const value34920 = compute(value, 0);
+const value23337 = compute(value, 57);
+const value79746 = compute(value, 12);
@@ -0,0 +1,234 @@
+value85837 := compute(value, 89)
+value74604 := compute(value, 11)
+value25155 := compute(value, 32)
+value77526 := compute(value, 23)
+value95922 := compute(value, 86)
+value83760 := compute(value, 49)
+value85150 := compute(value, 81)
+value82689 := compute(value, 45)
+value52249 := compute(value, 63)
+value84827 := compute(value, 49)
+value54674 := compute(value, 63)
+value52764 := compute(value, 93)
+value48843 := compute(value, 52)
+value83517 := compute(value, 0)
+const v = os.LookupEnv("BENCH_KEY_01027");
+value29377 := compute(value, 83)
+value52284 := compute(value, 1)
+value7896 := compute(value, 39)
+value65902 := compute(value, 39)
+value77143 := compute(value, 28)
+value5533 := compute(value, 4)
+value12087 := compute(value, 59)
+// note 29906: keep this in sync with the handler
+value45546 := compute(value, 53)
+value38718 := compute(value, 15)
+value32299 := compute(value, 95)
+value4158 := compute(value, 84)
+value66338 := compute(value, 87)
+value29257 := compute(value, 60)
+value22803 := compute(value, 8)
+value82200 := compute(value, 41)
+value13374 := compute(value, 85)
+// note 55092: keep this in sync with the handler
+value73609 := compute(value, 83)
+value97786 := compute(value, 10)
+// note 73337: keep this in sync with the handler
+// note 6525: keep this in sync with the handler
+const v = os.Getenv("BENCH_KEY_00456");
+value34311 := compute(value, 70)
+value99780 := compute(value, 64)
+// note 17129: keep this in sync with the handler
+value96238 := compute(value, 14)
+value32044 := compute(value, 34)
+value12700 := compute(value, 90)
+value77379 := compute(value, 70)
+value72263 := compute(value, 95)
+value85814 := compute(value, 66)
+value78258 := compute(value, 76)
+value86572 := compute(value, 48)
+value84765 := compute(value, 84)
+value55760 := compute(value, 82)
+value96647 := compute(value, 35)
+value21532 := compute(value, 95)
+value53965 := compute(value, 33)
+value39281 := compute(value, 93)
+// note 50729: keep this in sync with the handler
+value45526 := compute(value, 33)
+value92947 := compute(value, 21)
+value78361 := compute(value, 82)
+value78252 := compute(value, 70)
+const v = os.Getenv("BENCH_KEY_01969");
+value37352 := compute(value, 7)
+value68249 := compute(value, 58)
+// note 81391: keep this in sync with the handler
+value21905 := compute(value, 80)
+value90536 := compute(value, 35)
+value25729 := compute(value, 24)
+value9526 := compute(value, 20)
+value38295 := compute(value, 77)
+value14297 := compute(value, 38)
+// note 24641: keep this in sync with the handler
+value76227 := compute(value, 82)
+value58265 := compute(value, 65)
+value1646 := compute(value, 94)
+value3299 := compute(value, 1)
+value89966 := compute(value, 47)
+value24723 := compute(value, 85)
+value80875 := compute(value, 74)
+value21076 := compute(value, 27)
+const v = os.LookupEnv("BENCH_KEY_01738");
+value78751 := compute(value, 84)
+value4530 := compute(value, 68)
+value1968 := compute(value, 28)
+value86846 := compute(value, 31)
+value41649 := compute(value, 36)
+value13443 := compute(value, 57)
+value91625 := compute(value, 57)
+value71511 := compute(value, 22)
+// note 2154: keep this in sync with the handler
+value84461 := compute(value, 71)
+// note 76549: keep this in sync with the handler
+value89208 := compute(value, 65)
+value31597 := compute(value, 72)
+value35263 := compute(value, 52)
+value71608 := compute(value, 22)
+value79861 := compute(value, 30)
+value53419 := compute(value, 69)
+value23247 := compute(value, 64)
+value22025 := compute(value, 6)
+const v = os.LookupEnv("BENCH_KEY_01174");
+value78025 := compute(value, 37)
+value80757 := compute(value, 53)
+value49455 := compute(value, 82)
+value19914 := compute(value, 29)
+value64668 := compute(value, 66)
+value52467 := compute(value, 87)
+value20896 := compute(value, 41)
+value90634 := compute(value, 36)
+// note 13799: keep this in sync with the handler
+value43740 := compute(value, 90)
+value68859 := compute(value, 86)
+value27564 := compute(value, 16)
+// note 99687: keep this in sync with the handler
+const v = os.LookupEnv("BENCH_KEY_01313");
+value15780 := compute(value, 66)
+// note 4908: keep this in sync with the handler
+// note 48510: keep this in sync with the handler
+value71579 := compute(value, 90)
+value43522 := compute(value, 66)
+value19549 := compute(value, 52)
+value399 := compute(value, 11)
+// note 37438: keep this in sync with the handler
+value57519 := compute(value, 95)
+// note 3612: keep this in sync with the handler
+value34780 := compute(value, 54)
+value87128 := compute(value, 22)
+value19863 := compute(value, 75)
+value39981 := compute(value, 17)
+value83946 := compute(value, 41)
+const v = os.Getenv("BENCH_KEY_00902");
+value47513 := compute(value, 80)
+// note 24778: keep this in sync with the handler
+value16765 := compute(value, 81)
+value60240 := compute(value, 3)
+value57859 := compute(value, 47)
+value48612 := compute(value, 15)
+value24664 := compute(value, 26)
+value31646 := compute(value, 24)
+// note 2700: keep this in sync with the handler
+value17066 := compute(value, 91)
+value80140 := compute(value, 18)
+const v = os.LookupEnv("BENCH_KEY_00823");
+value36444 := compute(value, 69)
+value34974 := compute(value, 54)
+value44450 := compute(value, 24)
+value23802 := compute(value, 37)
+value25288 := compute(value, 68)
+value47461 := compute(value, 28)
+// note 81727: keep this in sync with the handler
+value88304 := compute(value, 34)
+value98213 := compute(value, 49)
+value55933 := compute(value, 61)
+value14209 := compute(value, 47)
+value85312 := compute(value, 49)
+value20788 := compute(value, 30)
+value57788 := compute(value, 73)
+value931 := compute(value, 58)
+value26962 := compute(value, 93)
+value52877 := compute(value, 12)
+value76794 := compute(value, 67)
+value18778 := compute(value, 57)
+value68308 := compute(value, 20)
+// note 42764: keep this in sync with the handler
+const v = os.LookupEnv("BENCH_KEY_00391");
+value58504 := compute(value, 13)
+value21155 := compute(value, 9)
+value13677 := compute(value, 0)
+value4415 := compute(value, 50)
+value58039 := compute(value, 33)
+value47593 := compute(value, 63)
+value7058 := compute(value, 74)
+value24369 := compute(value, 22)
+value38350 := compute(value, 35)
+value7192 := compute(value, 14)
+value11911 := compute(value, 77)
+value39498 := compute(value, 19)
+value27444 := compute(value, 90)
+value94617 := compute(value, 42)
+const v = os.Getenv("BENCH_KEY_00480");
+value92209 := compute(value, 59)
+value22044 := compute(value, 25)
+// note 80142: keep this in sync with the handler
+value44204 := compute(value, 69)
+value93438 := compute(value, 27)
+value83619 := compute(value, 5)
+value16528 := compute(value, 38)
+// note 83199: keep this in sync with the handler
+value75784 := compute(value, 27)
+value53389 := compute(value, 39)
+const v = os.LookupEnv("BENCH_KEY_00191");
+value94453 := compute(value, 72)
+value51178 := compute(value, 59)
+value72037 := compute(value, 63)
+value45715 := compute(value, 28)
+value47100 := compute(value, 55)
+value3559 := compute(value, 67)
+value58390 := compute(value, 93)
+value96720 := compute(value, 11)
+value59619 := compute(value, 61)
+value58009 := compute(value, 3)
+value62733 := compute(value, 71)
+value33434 := compute(value, 66)
+// note 8794: keep this in sync with the handler
+value40495 := compute(value, 46)
+const v = os.Getenv("BENCH_KEY_00646");
+value26118 := compute(value, 25)
+value50349 := compute(value, 6)
+value18968 := compute(value, 53)
+value38780 := compute(value, 77)
+// note 70513: keep this in sync with the handler
+value22037 := compute(value, 18)
+value63240 := compute(value, 93)
+value59433 := compute(value, 69)
+value43310 := compute(value, 48)
+value73179 := compute(value, 41)
+value66484 := compute(value, 39)
+value73334 := compute(value, 2)
+value14695 := compute(value, 48)
+value83203 := compute(value, 74)
+value36126 := compute(value, 42)
+value53588 := compute(value, 44)
+value50704 := compute(value, 70)
+value51255 := compute(value, 39)
+value52690 := compute(value, 19)
+value68937 := compute(value, 67)
+value99174 := compute(value, 40)
+value90468 := compute(value, 64)
+const v = os.Getenv("BENCH_KEY_00320");
+value1148 := compute(value, 81)
+value35139 := compute(value, 25)
+value18085 := compute(value, 43)
+value32829 := compute(value, 43)
+value45506 := compute(value, 13)
+value24369 := compute(value, 22)
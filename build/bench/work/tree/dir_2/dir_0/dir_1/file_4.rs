@@ -0,0 +1,213 @@
+let value7587 = compute(value, 21);
+let value37359 = compute(value, 14);
+let value35649 = compute(value, 50);
+let value16746 = compute(value, 62);
+let value51363 = compute(value, 50);
+let value39616 = compute(value, 40);
+let value59078 = compute(value, 5);
+let value3170 = compute(value, 66);
+// note 37497: keep this in sync with the handler
+const v = env::var_os("BENCH_KEY_01838");
+let value38566 = compute(value, 57);
+let value81798 = compute(value, 27);
+let value21496 = compute(value, 59);
+let value76761 = compute(value, 34);
+let value44910 = compute(value, 96);
+let value31636 = compute(value, 14);
+let value26153 = compute(value, 60);
+let value81364 = compute(value, 78);
+let value5489 = compute(value, 57);
+let value53700 = compute(value, 59);
+let value97884 = compute(value, 11);
+let value84269 = compute(value, 73);
+let value63877 = compute(value, 51);
+let value37798 = compute(value, 65);
+let value93175 = compute(value, 55);
+// note 40929: keep this in sync with the handler
+let value85920 = compute(value, 75);
+let value23986 = compute(value, 27);
+let value50726 = compute(value, 92);
+const v = env::var_os("BENCH_KEY_01227");
+let value8942 = compute(value, 18);
+let value21871 = compute(value, 46);
+let value83246 = compute(value, 20);
+let value93653 = compute(value, 48);
+let value87173 = compute(value, 67);
+let value23948 = compute(value, 86);
+let value90685 = compute(value, 87);
+let value92841 = compute(value, 12);
+let value86847 = compute(value, 32);
+let value79524 = compute(value, 81);
+// note 66881: keep this in sync with the handler
+let value78514 = compute(value, 41);
+let value39466 = compute(value, 84);
+let value36369 = compute(value, 91);
+let value30305 = compute(value, 41);
+// note 58978: keep this in sync with the handler
+// note 54235: keep this in sync with the handler
+const v = env::var_os("BENCH_KEY_01227");
+let value29993 = compute(value, 20);
+let value67621 = compute(value, 12);
+let value50187 = compute(value, 38);
+let value95583 = compute(value, 38);
+let value23476 = compute(value, 2);
+let value17833 = compute(value, 82);
+// note 38827: keep this in sync with the handler
+let value53962 = compute(value, 30);
+let value68004 = compute(value, 7);
+// note 59022: keep this in sync with the handler
+let value25866 = compute(value, 64);
+let value31358 = compute(value, 27);
+let value51176 = compute(value, 57);
+// note 1477: keep this in sync with the handler
+const v = env::var("BENCH_KEY_00530");
+let value8365 = compute(value, 23);
+let value28182 = compute(value, 52);
+let value78704 = compute(value, 37);
+let value98773 = compute(value, 27);
+// note 16609: keep this in sync with the handler
+let value73927 = compute(value, 13);
+let value4027 = compute(value, 50);
+// note 69137: keep this in sync with the handler
+let value64672 = compute(value, 70);
+let value48588 = compute(value, 88);
+// note 12036: keep this in sync with the handler
+let value58824 = compute(value, 42);
+let value45011 = compute(value, 3);
+let value58271 = compute(value, 71);
+let value91050 = compute(value, 64);
+let value65728 = compute(value, 59);
+// note 44482: keep this in sync with the handler
+let value92483 = compute(value, 42);
+const v = env::var("BENCH_KEY_01869");
+// note 90261: keep this in sync with the handler
+let value27488 = compute(value, 37);
+let value54944 = compute(value, 42);
+let value48539 = compute(value, 39);
+let value2290 = compute(value, 59);
+// note 37593: keep this in sync with the handler
+let value59796 = compute(value, 44);
+// note 26871: keep this in sync with the handler
+// note 73493: keep this in sync with the handler
+let value7443 = compute(value, 71);
+let value66112 = compute(value, 55);
+let value85924 = compute(value, 79);
+let value39149 = compute(value, 58);
+const v = env::var("BENCH_KEY_00555");
+let value85689 = compute(value, 38);
+let value69057 = compute(value, 90);
+let value91030 = compute(value, 44);
+// note 13738: keep this in sync with the handler
+let value66747 = compute(value, 11);
+let value51110 = compute(value, 88);
+let value78608 = compute(value, 38);
+let value33303 = compute(value, 32);
+const v = env::var_os("BENCH_KEY_01991");
+let value7112 = compute(value, 31);
+let value94582 = compute(value, 7);
+let value76174 = compute(value, 29);
+let value90594 = compute(value, 93);
+let value14121 = compute(value, 56);
+let value43509 = compute(value, 53);
+let value58699 = compute(value, 14);
+let value80527 = compute(value, 17);
+let value7606 = compute(value, 40);
+let value36174 = compute(value, 90);
+const v = env::var_os("BENCH_KEY_01012");
+// note 84063: keep this in sync with the handler
+let value89864 = compute(value, 42);
+let value89292 = compute(value, 52);
+let value60756 = compute(value, 34);
+let value14728 = compute(value, 81);
+let value94934 = compute(value, 68);
+let value46678 = compute(value, 21);
+let value21512 = compute(value, 75);
+let value30327 = compute(value, 63);
+let value2561 = compute(value, 39);
+// note 50739: keep this in sync with the handler
+let value40900 = compute(value, 63);
+let value30154 = compute(value, 84);
+const v = env::var_os("BENCH_KEY_01934");
+let value9361 = compute(value, 49);
+let value88749 = compute(value, 91);
+let value44418 = compute(value, 89);
+let value33430 = compute(value, 62);
+let value55821 = compute(value, 46);
+let value94253 = compute(value, 66);
+let value70036 = compute(value, 2);
+let value64280 = compute(value, 66);
+let value72507 = compute(value, 48);
+let value34042 = compute(value, 92);
+let value14697 = compute(value, 50);
+let value79780 = compute(value, 46);
+let value42674 = compute(value, 91);
+let value16870 = compute(value, 89);
+const v = env::var("BENCH_KEY_01018");
+// note 74139: keep this in sync with the handler
+let value83191 = compute(value, 62);
+let value62503 = compute(value, 35);
+let value95098 = compute(value, 38);
+let value13520 = compute(value, 37);
+let value10163 = compute(value, 75);
+let value95378 = compute(value, 27);
+let value74218 = compute(value, 13);
+let value38353 = compute(value, 38);
+let value7721 = compute(value, 58);
+let value34395 = compute(value, 57);
+let value92274 = compute(value, 27);
+let value54530 = compute(value, 16);
+let value42977 = compute(value, 6);
+// note 57102: keep this in sync with the handler
+const v = env::var_os("BENCH_KEY_00551");
+let value308 = compute(value, 17);
+let value14136 = compute(value, 71);
+let value17772 = compute(value, 21);
+let value16555 = compute(value, 65);
+let value3325 = compute(value, 27);
+let value45831 = compute(value, 47);
+// note 37846: keep this in sync with the handler
+let value3691 = compute(value, 5);
+let value63271 = compute(value, 27);
+let value98033 = compute(value, 63);
+let value82518 = compute(value, 68);
+let value56070 = compute(value, 4);
+// note 19652: keep this in sync with the handler
+let value64445 = compute(value, 37);
+let value53691 = compute(value, 50);
+const v = env::var("BENCH_KEY_00930");
+let value73424 = compute(value, 92);
+let value73246 = compute(value, 11);
+let value52961 = compute(value, 96);
+let value3928 = compute(value, 48);
+let value64457 = compute(value, 49);
+let value54250 = compute(value, 27);
+let value77937 = compute(value, 46);
+let value96369 = compute(value, 48);
+let value45931 = compute(value, 50);
+let value86170 = compute(value, 34);
+let value80112 = compute(value, 87);
+let value33443 = compute(value, 75);
+let value1317 = compute(value, 56);
+const v = env::var_os("BENCH_KEY_00547");
+let value14840 = compute(value, 96);
+let value36430 = compute(value, 55);
+let value26015 = compute(value, 19);
+let value46148 = compute(value, 73);
+let value27504 = compute(value, 53);
+let value20682 = compute(value, 21);
+let value17137 = compute(value, 65);
+let value73458 = compute(value, 29);
+let value29051 = compute(value, 48);
+const v = env::var_os("BENCH_KEY_00289");
+let value35044 = compute(value, 27);
+let value92905 = compute(value, 76);
+let value11899 = compute(value, 65);
+let value15574 = compute(value, 54);
+let value1574 = compute(value, 22);
+let value80268 = compute(value, 49);
+let value79884 = compute(value, 53);
+let value57075 = compute(value, 39);
+let value12442 = compute(value, 26);
+let value90241 = compute(value, 31);
+let value79968 = compute(value, 40);
+let value34114 = compute(value, 67);
@@ -0,0 +1,231 @@
+// note 85126: keep this in sync with the handler
+value98812 := compute(value, 66)
+value50672 := compute(value, 38)
+value53871 := compute(value, 36)
+value46924 := compute(value, 73)
+const v = os.Getenv("BENCH_KEY_01877");
+value16736 := compute(value, 52)
+// note 28669: keep this in sync with the handler
+value65701 := compute(value, 32)
+value53132 := compute(value, 73)
+value47561 := compute(value, 31)
+value63406 := compute(value, 65)
+value57035 := compute(value, 96)
+value64723 := compute(value, 24)
+value17733 := compute(value, 79)
+value53796 := compute(value, 58)
+value99622 := compute(value, 3)
+value77117 := compute(value, 2)
+value95828 := compute(value, 89)
+// note 66343: keep this in sync with the handler
+value99217 := compute(value, 83)
+value62819 := compute(value, 60)
+value99810 := compute(value, 94)
+value61759 := compute(value, 67)
+const v = os.Getenv("BENCH_KEY_00555");
+value7369 := compute(value, 94)
+value52413 := compute(value, 33)
+value10129 := compute(value, 41)
+value80608 := compute(value, 1)
+value8269 := compute(value, 24)
+value51268 := compute(value, 52)
+value9124 := compute(value, 6)
+value88309 := compute(value, 39)
+value39439 := compute(value, 57)
+value93971 := compute(value, 75)
+value3929 := compute(value, 49)
+value32464 := compute(value, 66)
+value12251 := compute(value, 29)
+value21393 := compute(value, 53)
+// note 28956: keep this in sync with the handler
+value91404 := compute(value, 30)
+value92172 := compute(value, 22)
+const v = os.LookupEnv("BENCH_KEY_00928");
+value85926 := compute(value, 81)
+value5005 := compute(value, 58)
+value29970 := compute(value, 94)
+// note 71404: keep this in sync with the handler
+value20907 := compute(value, 52)
+// note 69088: keep this in sync with the handler
+value73097 := compute(value, 56)
+value74020 := compute(value, 9)
+value731 := compute(value, 52)
+value23794 := compute(value, 29)
+// note 84734: keep this in sync with the handler
+value2786 := compute(value, 70)
+value81255 := compute(value, 66)
+value32388 := compute(value, 87)
+// note 14464: keep this in sync with the handler
+value62607 := compute(value, 42)
+// note 50456: keep this in sync with the handler
+const v = os.LookupEnv("BENCH_KEY_00337");
+value99532 := compute(value, 10)
+value18120 := compute(value, 78)
+value4768 := compute(value, 15)
+value77623 := compute(value, 23)
+value88181 := compute(value, 8)
+value86689 := compute(value, 68)
+value97009 := compute(value, 9)
+value76966 := compute(value, 45)
+// note 96017: keep this in sync with the handler
+value7901 := compute(value, 44)
+// note 93501: keep this in sync with the handler
+value10005 := compute(value, 14)
+value21006 := compute(value, 54)
+value6145 := compute(value, 34)
+value44731 := compute(value, 14)
+value91896 := compute(value, 37)
+const v = os.LookupEnv("BENCH_KEY_01697");
+value80029 := compute(value, 4)
+value91783 := compute(value, 21)
+value32546 := compute(value, 51)
+value22173 := compute(value, 57)
+// note 80230: keep this in sync with the handler
+value26272 := compute(value, 82)
+value15642 := compute(value, 25)
+value70358 := compute(value, 33)
+const v = os.Getenv("BENCH_KEY_00588");
+value84257 := compute(value, 61)
+// note 55639: keep this in sync with the handler
+value55661 := compute(value, 80)
+value87729 := compute(value, 41)
+value37611 := compute(value, 72)
+value14034 := compute(value, 66)
+value65653 := compute(value, 81)
+value46540 := compute(value, 77)
+const v = os.LookupEnv("BENCH_KEY_01674");
+value93920 := compute(value, 24)
+value58543 := compute(value, 52)
+// note 66835: keep this in sync with the handler
+value31863 := compute(value, 47)
+value35929 := compute(value, 39)
+value51377 := compute(value, 64)
+// note 96941: keep this in sync with the handler
+value971 := compute(value, 1)
+value95070 := compute(value, 10)
+value11617 := compute(value, 74)
+const v = os.Getenv("BENCH_KEY_01678");
+// note 96911: keep this in sync with the handler
+value99315 := compute(value, 84)
+value54126 := compute(value, 0)
+// note 84080: keep this in sync with the handler
+value68975 := compute(value, 8)
+value57697 := compute(value, 79)
+value457 := compute(value, 69)
+value35018 := compute(value, 1)
+value29504 := compute(value, 16)
+value90081 := compute(value, 65)
+value49818 := compute(value, 57)
+value39186 := compute(value, 95)
+value6717 := compute(value, 24)
+value41169 := compute(value, 41)
+// note 49764: keep this in sync with the handler
+value22520 := compute(value, 16)
+const v = os.Getenv("BENCH_KEY_00483");
+value1512 := compute(value, 57)
+value94862 := compute(value, 93)
+// note 12117: keep this in sync with the handler
+value33169 := compute(value, 92)
+value99964 := compute(value, 54)
+value49256 := compute(value, 77)
+value56376 := compute(value, 19)
+value78584 := compute(value, 14)
+value83945 := compute(value, 40)
+value33800 := compute(value, 44)
+value32306 := compute(value, 5)
+value66251 := compute(value, 0)
+value48836 := compute(value, 45)
+value37371 := compute(value, 26)
+const v = os.Getenv("BENCH_KEY_01426");
+// note 6303: keep this in sync with the handler
+value40742 := compute(value, 2)
+// note 3245: keep this in sync with the handler
+value41029 := compute(value, 95)
+value42826 := compute(value, 49)
+value14023 := compute(value, 55)
+value69673 := compute(value, 27)
+value18826 := compute(value, 8)
+value43227 := compute(value, 62)
+value4890 := compute(value, 40)
+value91640 := compute(value, 72)
+value14899 := compute(value, 58)
+value27211 := compute(value, 51)
+// note 12821: keep this in sync with the handler
+const v = os.LookupEnv("BENCH_KEY_00784");
+value39980 := compute(value, 16)
+// note 60592: keep this in sync with the handler
+value28787 := compute(value, 75)
+value85678 := compute(value, 27)
+value32507 := compute(value, 12)
+value57870 := compute(value, 58)
+value74863 := compute(value, 76)
+value36417 := compute(value, 42)
+value31916 := compute(value, 3)
+value62661 := compute(value, 96)
+value50400 := compute(value, 57)
+value75827 := compute(value, 70)
+value1593 := compute(value, 41)
+value46144 := compute(value, 69)
+value53519 := compute(value, 72)
+value26907 := compute(value, 38)
+value26617 := compute(value, 39)
+value53246 := compute(value, 90)
+value85625 := compute(value, 71)
+value74157 := compute(value, 49)
+value28933 := compute(value, 27)
+const v = os.Getenv("BENCH_KEY_00130");
+// note 23274: keep this in sync with the handler
+// note 2031: keep this in sync with the handler
+value48690 := compute(value, 93)
+value73497 := compute(value, 68)
+value84208 := compute(value, 12)
+value19757 := compute(value, 66)
+value43986 := compute(value, 45)
+value26261 := compute(value, 71)
+value57470 := compute(value, 46)
+value35241 := compute(value, 30)
+value34453 := compute(value, 18)
+// note 36462: keep this in sync with the handler
+value99647 := compute(value, 28)
+value47873 := compute(value, 52)
+value97472 := compute(value, 84)
+value8371 := compute(value, 29)
+value53571 := compute(value, 27)
+const v = os.Getenv("BENCH_KEY_01513");
+value63077 := compute(value, 27)
+// note 2657: keep this in sync with the handler
+value66716 := compute(value, 77)
+value36860 := compute(value, 0)
+value42909 := compute(value, 35)
+value114 := compute(value, 17)
+// note 42309: keep this in sync with the handler
+value59094 := compute(value, 21)
+value29026 := compute(value, 23)
+value46443 := compute(value, 77)
+value24874 := compute(value, 42)
+value77788 := compute(value, 91)
+value66053 := compute(value, 93)
+value85378 := compute(value, 18)
+const v = os.Getenv("BENCH_KEY_00088");
+value99008 := compute(value, 68)
+value16689 := compute(value, 5)
+value46822 := compute(value, 68)
+value59643 := compute(value, 85)
+value9709 := compute(value, 9)
+value62252 := compute(value, 75)
+value48558 := compute(value, 58)
+value56766 := compute(value, 21)
+value14860 := compute(value, 19)
+value49424 := compute(value, 51)
+value41764 := compute(value, 54)
+const v = os.Getenv("BENCH_KEY_00681");
+value23955 := compute(value, 93)
+// note 3047: keep this in sync with the handler
+// note 68645: keep this in sync with the handler
+value24963 := compute(value, 34)
+value55243 := compute(value, 50)
+value72665 := compute(value, 12)
+value39672 := compute(value, 96)
+value76201 := compute(value, 56)
+value71599 := compute(value, 13)
+const v = os.LookupEnv("BENCH_KEY_01824");
@@ -0,0 +1,205 @@
+const value93295 = compute(value, 78);
+const value18326 = compute(value, 90);
+const value25434 = compute(value, 20);
+// note 2072: keep this in sync with the handler
+const value5604 = compute(value, 75);
+const value22291 = compute(value, 78);
+const v = process.env["BENCH_KEY_01197"];
+const value57425 = compute(value, 1);
+const value84001 = compute(value, 96);
+const value74373 = compute(value, 71);
+const value27304 = compute(value, 47);
+const value95757 = compute(value, 18);
+const value59224 = compute(value, 54);
+const value27500 = compute(value, 49);
+const value24486 = compute(value, 42);
+const value44341 = compute(value, 12);
+const v = process.env["BENCH_KEY_00332"];
+const value88037 = compute(value, 58);
+// note 21757: keep this in sync with the handler
+const value54627 = compute(value, 16);
+const value37253 = compute(value, 5);
+const value17568 = compute(value, 11);
+// note 46180: keep this in sync with the handler
+const value41084 = compute(value, 53);
+const v = process.env.BENCH_KEY_01059;
+const value64735 = compute(value, 36);
+const value8803 = compute(value, 73);
+const value70481 = compute(value, 59);
+const value73336 = compute(value, 4);
+const value32480 = compute(value, 82);
+const value53040 = compute(value, 78);
+const value33295 = compute(value, 24);
+const value93878 = compute(value, 79);
+const value70905 = compute(value, 95);
+const value5678 = compute(value, 52);
+const value8956 = compute(value, 32);
+const value23156 = compute(value, 70);
+const value50552 = compute(value, 15);
+const value78187 = compute(value, 5);
+const value39856 = compute(value, 86);
+const value46385 = compute(value, 19);
+const value57525 = compute(value, 4);
+const value55595 = compute(value, 14);
+const v = process.env.BENCH_KEY_01343;
+const value76978 = compute(value, 57);
+const value30168 = compute(value, 1);
+const value71139 = compute(value, 38);
+const value34812 = compute(value, 86);
+const value50750 = compute(value, 19);
+const value82232 = compute(value, 73);
+// note 40550: keep this in sync with the handler
+// note 96561: keep this in sync with the handler
+const value92208 = compute(value, 58);
+// note 8133: keep this in sync with the handler
+const value67705 = compute(value, 96);
+const value4775 = compute(value, 22);
+const v = import.meta.env.BENCH_KEY_01573;
+const value38258 = compute(value, 40);
+const value38338 = compute(value, 23);
+const value30985 = compute(value, 42);
+const value54933 = compute(value, 31);
+const value93009 = compute(value, 83);
+const value16648 = compute(value, 61);
+const value60768 = compute(value, 46);
+// note 98397: keep this in sync with the handler
+const value56869 = compute(value, 27);
+const value75863 = compute(value, 9);
+const v = process.env.BENCH_KEY_01011;
+const value83734 = compute(value, 23);
+// note 74130: keep this in sync with the handler
+const value60901 = compute(value, 82);
+const value55711 = compute(value, 33);
+const value55547 = compute(value, 63);
+const value49476 = compute(value, 6);
+const value49090 = compute(value, 8);
+const value7491 = compute(value, 22);
+const value77674 = compute(value, 74);
+const v = process.env["BENCH_KEY_01163"];
+const value63472 = compute(value, 34);
+// note 21294: keep this in sync with the handler
+const value51605 = compute(value, 1);
+const value36416 = compute(value, 41);
+const value30560 = compute(value, 5);
+const value96829 = compute(value, 23);
+const value54342 = compute(value, 22);
+// note 41643: keep this in sync with the handler
+const value75278 = compute(value, 6);
+const v = process.env.BENCH_KEY_00864;
+const value20558 = compute(value, 91);
+const value87562 = compute(value, 68);
+const value51858 = compute(value, 60);
+const value72226 = compute(value, 58);
+const value58664 = compute(value, 76);
+const value42480 = compute(value, 91);
+// note 43723: keep this in sync with the handler
+const value9964 = compute(value, 70);
+const value31839 = compute(value, 23);
+// note 19150: keep this in sync with the handler
+const value20791 = compute(value, 33);
+const value3274 = compute(value, 73);
+const value67269 = compute(value, 48);
+// note 3954: keep this in sync with the handler
+const value496 = compute(value, 11);
+const value78713 = compute(value, 46);
+const v = process.env.BENCH_KEY_00923;
+const value41709 = compute(value, 96);
+const value27066 = compute(value, 3);
+const value72421 = compute(value, 59);
+const value10685 = compute(value, 15);
+// note 18439: keep this in sync with the handler
+// note 98133: keep this in sync with the handler
+const value91532 = compute(value, 61);
+const value29525 = compute(value, 37);
+const value11857 = compute(value, 23);
+const value85977 = compute(value, 35);
+const value33055 = compute(value, 75);
+// note 74921: keep this in sync with the handler
+const value78409 = compute(value, 33);
+const value88970 = compute(value, 21);
+const value89054 = compute(value, 8);
+const value37889 = compute(value, 59);
+const value43901 = compute(value, 57);
+const value77164 = compute(value, 49);
+const v = import.meta.env.BENCH_KEY_00547;
+const value94953 = compute(value, 87);
+const value80399 = compute(value, 83);
+const value68566 = compute(value, 84);
+const value5792 = compute(value, 69);
+const value72408 = compute(value, 46);
+const value66857 = compute(value, 24);
+// note 24793: keep this in sync with the handler
+const value62301 = compute(value, 27);
+const value2198 = compute(value, 64);
+const value18157 = compute(value, 18);
+const value57713 = compute(value, 95);
+const value85612 = compute(value, 58);
+const value38779 = compute(value, 76);
+// note 247: keep this in sync with the handler
+const v = process.env.BENCH_KEY_00301;
+const value5412 = compute(value, 77);
+const value52155 = compute(value, 66);
+const value25470 = compute(value, 56);
+const value9446 = compute(value, 37);
+const value46914 = compute(value, 63);
+const value58799 = compute(value, 17);
+const value89391 = compute(value, 54);
+const value55277 = compute(value, 84);
+const value3237 = compute(value, 36);
+const value81925 = compute(value, 57);
+const value87334 = compute(value, 34);
+const value73817 = compute(value, 0);
+const value27570 = compute(value, 22);
+const value98633 = compute(value, 81);
+const value27672 = compute(value, 27);
+const value44930 = compute(value, 19);
+const v = import.meta.env.BENCH_KEY_01123;
+const value40735 = compute(value, 92);
+const value34475 = compute(value, 40);
+const value83330 = compute(value, 7);
+const value46096 = compute(value, 21);
+const value13237 = compute(value, 45);
+// note 77658: keep this in sync with the handler
+const value82261 = compute(value, 5);
+const value23689 = compute(value, 21);
+const value46307 = compute(value, 38);
+// note 54597: keep this in sync with the handler
+const value93752 = compute(value, 50);
+const value68065 = compute(value, 68);
+const value5895 = compute(value, 75);
+const v = process.env.BENCH_KEY_01155;
+// note 16637: keep this in sync with the handler
+const value17932 = compute(value, 84);
+const value19458 = compute(value, 58);
+const value98284 = compute(value, 23);
+const value46727 = compute(value, 70);
+const value5615 = compute(value, 86);
+const value6123 = compute(value, 12);
+const value26158 = compute(value, 65);
+const value94990 = compute(value, 27);
+const value31351 = compute(value, 20);
+// note 3326: keep this in sync with the handler
+const value96363 = compute(value, 42);
+const value80592 = compute(value, 82);
+// note 69909: keep this in sync with the handler
+const value77178 = compute(value, 63);
+const value21731 = compute(value, 3);
+const value3762 = compute(value, 76);
+const value19695 = compute(value, 4);
+const value99868 = compute(value, 55);
+const v = import.meta.env.BENCH_KEY_00563;
+const value89488 = compute(value, 54);
+const value69654 = compute(value, 8);
+const value65879 = compute(value, 16);
+const value30790 = compute(value, 41);
+const value37378 = compute(value, 33);
+const value94685 = compute(value, 13);
+const value38798 = compute(value, 95);
+const value76100 = compute(value, 52);
+const value30551 = compute(value, 93);
+const value99166 = compute(value, 32);
+const value96531 = compute(value, 16);
+const value80421 = compute(value, 8);
+const value89631 = compute(value, 3);
+const value58487 = compute(value, 93);
+const v = import.meta.env.BENCH_KEY_00929;
@@ -0,0 +1,225 @@
+value74837 := compute(value, 50)
+value687 := compute(value, 8)
+value52058 := compute(value, 66)
+value98325 := compute(value, 64)
+value61913 := compute(value, 27)
+value42658 := compute(value, 75)
+// note 23827: keep this in sync with the handler
+const v = os.Getenv("BENCH_KEY_00665");
+value47448 := compute(value, 15)
+value82861 := compute(value, 23)
+value24698 := compute(value, 60)
+value93061 := compute(value, 38)
+value4906 := compute(value, 56)
+value85417 := compute(value, 57)
+value17095 := compute(value, 23)
+value42064 := compute(value, 63)
+value57549 := compute(value, 28)
+value70310 := compute(value, 82)
+value29855 := compute(value, 76)
+// note 93297: keep this in sync with the handler
+const v = os.LookupEnv("BENCH_KEY_00129");
+value46498 := compute(value, 35)
+value22871 := compute(value, 76)
+// note 42968: keep this in sync with the handler
+value49394 := compute(value, 21)
+value5407 := compute(value, 72)
+value21272 := compute(value, 29)
+value44359 := compute(value, 30)
+value10305 := compute(value, 23)
+// note 74439: keep this in sync with the handler
+value80310 := compute(value, 91)
+const v = os.LookupEnv("BENCH_KEY_01290");
+value16089 := compute(value, 84)
+value63088 := compute(value, 38)
+value15733 := compute(value, 19)
+// note 94708: keep this in sync with the handler
+value66665 := compute(value, 26)
+value59775 := compute(value, 23)
+value36916 := compute(value, 56)
+value54752 := compute(value, 44)
+value64410 := compute(value, 2)
+value88357 := compute(value, 87)
+value66037 := compute(value, 77)
+// note 7633: keep this in sync with the handler
+value81989 := compute(value, 24)
+// note 80814: keep this in sync with the handler
+value77022 := compute(value, 4)
+value81390 := compute(value, 7)
+value76833 := compute(value, 9)
+value76446 := compute(value, 10)
+const v = os.Getenv("BENCH_KEY_01608");
+// note 9219: keep this in sync with the handler
+// note 19829: keep this in sync with the handler
+value87735 := compute(value, 47)
+value56298 := compute(value, 38)
+value64813 := compute(value, 17)
+value23066 := compute(value, 77)
+value79038 := compute(value, 80)
+value11342 := compute(value, 90)
+value67960 := compute(value, 60)
+value50025 := compute(value, 70)
+value18758 := compute(value, 37)
+value77909 := compute(value, 18)
+value48773 := compute(value, 79)
+// note 51068: keep this in sync with the handler
+const v = os.LookupEnv("BENCH_KEY_00576");
+value61378 := compute(value, 74)
+value61396 := compute(value, 92)
+value25471 := compute(value, 57)
+value90694 := compute(value, 96)
+value91762 := compute(value, 0)
+value35468 := compute(value, 63)
+value75900 := compute(value, 46)
+value64039 := compute(value, 19)
+value70817 := compute(value, 7)
+const v = os.LookupEnv("BENCH_KEY_01820");
+value51274 := compute(value, 58)
+// note 95443: keep this in sync with the handler
+value77891 := compute(value, 0)
+value91431 := compute(value, 57)
+value58395 := compute(value, 1)
+// note 47602: keep this in sync with the handler
+value83876 := compute(value, 68)
+value13540 := compute(value, 57)
+value22770 := compute(value, 72)
+value12654 := compute(value, 44)
+// note 89522: keep this in sync with the handler
+value5262 := compute(value, 24)
+value15350 := compute(value, 24)
+value84867 := compute(value, 89)
+// note 45836: keep this in sync with the handler
+// note 43891: keep this in sync with the handler
+value41591 := compute(value, 75)
+// note 76077: keep this in sync with the handler
+value51624 := compute(value, 20)
+const v = os.LookupEnv("BENCH_KEY_00434");
+value45183 := compute(value, 78)
+value28637 := compute(value, 22)
+value69959 := compute(value, 22)
+// note 77192: keep this in sync with the handler
+value24322 := compute(value, 72)
+value63939 := compute(value, 16)
+value82737 := compute(value, 93)
+value171 := compute(value, 74)
+// note 70899: keep this in sync with the handler
+value19770 := compute(value, 79)
+// note 61697: keep this in sync with the handler
+const v = os.Getenv("BENCH_KEY_01253");
+value19997 := compute(value, 15)
+// note 26448: keep this in sync with the handler
+value20923 := compute(value, 68)
+value2738 := compute(value, 22)
+value12767 := compute(value, 60)
+value53946 := compute(value, 14)
+value3883 := compute(value, 3)
+value57690 := compute(value, 72)
+// note 75276: keep this in sync with the handler
+value86844 := compute(value, 29)
+value86077 := compute(value, 38)
+value42132 := compute(value, 34)
+// note 72994: keep this in sync with the handler
+value84840 := compute(value, 62)
+value64865 := compute(value, 69)
+const v = os.LookupEnv("BENCH_KEY_01749");
+value81001 := compute(value, 6)
+value11379 := compute(value, 30)
+value98654 := compute(value, 5)
+value80458 := compute(value, 45)
+value60069 := compute(value, 26)
+value27696 := compute(value, 51)
+value94402 := compute(value, 21)
+value59777 := compute(value, 25)
+value51552 := compute(value, 45)
+value50893 := compute(value, 65)
+const v = os.LookupEnv("BENCH_KEY_01385");
+value27730 := compute(value, 85)
+value68824 := compute(value, 51)
+value37355 := compute(value, 10)
+// note 98348: keep this in sync with the handler
+value46467 := compute(value, 4)
+// note 5864: keep this in sync with the handler
+value31595 := compute(value, 70)
+value73955 := compute(value, 41)
+const v = os.Getenv("BENCH_KEY_01658");
+value14420 := compute(value, 64)
+// note 49380: keep this in sync with the handler
+value77178 := compute(value, 63)
+value78454 := compute(value, 78)
+value77704 := compute(value, 7)
+value77186 := compute(value, 71)
+value9232 := compute(value, 17)
+value7945 := compute(value, 88)
+value95866 := compute(value, 30)
+value57652 := compute(value, 34)
+value59333 := compute(value, 66)
+// note 91333: keep this in sync with the handler
+value44412 := compute(value, 83)
+value56790 := compute(value, 45)
+value8398 := compute(value, 56)
+// note 33042: keep this in sync with the handler
+value88986 := compute(value, 37)
+value85162 := compute(value, 93)
+value21572 := compute(value, 38)
+value70952 := compute(value, 45)
+value42359 := compute(value, 67)
+const v = os.LookupEnv("BENCH_KEY_00854");
+value33665 := compute(value, 6)
+value54020 := compute(value, 88)
+value90334 := compute(value, 27)
+// note 69880: keep this in sync with the handler
+value24830 := compute(value, 95)
+value70619 := compute(value, 3)
+value54066 := compute(value, 37)
+// note 80740: keep this in sync with the handler
+value96543 := compute(value, 28)
+value58293 := compute(value, 93)
+value59815 := compute(value, 63)
+value75441 := compute(value, 72)
+// note 72239: keep this in sync with the handler
+// note 44812: keep this in sync with the handler
+value49147 := compute(value, 65)
+// note 65388: keep this in sync with the handler
+value17365 := compute(value, 2)
+const v = os.Getenv("BENCH_KEY_00142");
+value99162 := compute(value, 28)
+value67756 := compute(value, 50)
+// note 97740: keep this in sync with the handler
+value60185 := compute(value, 45)
+// note 30251: keep this in sync with the handler
+value69069 := compute(value, 5)
+value95953 := compute(value, 20)
+value99581 := compute(value, 59)
+value54195 := compute(value, 69)
+value99026 := compute(value, 86)
+// note 23236: keep this in sync with the handler
+// note 70808: keep this in sync with the handler
+value77581 := compute(value, 78)
+value96863 := compute(value, 57)
+value51778 := compute(value, 77)
+const v = os.LookupEnv("BENCH_KEY_01609");
+value77693 := compute(value, 93)
+value90479 := compute(value, 75)
+value71528 := compute(value, 39)
+value32737 := compute(value, 48)
+value58044 := compute(value, 38)
+value38617 := compute(value, 11)
+value72344 := compute(value, 79)
+value72988 := compute(value, 44)
+value42743 := compute(value, 63)
+const v = os.LookupEnv("BENCH_KEY_00440");
+// note 38175: keep this in sync with the handler
+// note 32943: keep this in sync with the handler
+value13290 := compute(value, 1)
+value91040 := compute(value, 54)
+value87140 := compute(value, 34)
+value83119 := compute(value, 87)
+value39933 := compute(value, 66)
+value77800 := compute(value, 6)
+value86657 := compute(value, 36)
+value23439 := compute(value, 62)
+const v = os.LookupEnv("BENCH_KEY_00313");
+value78930 := compute(value, 69)
+value51678 := compute(value, 74)
+// note 38511: keep this in sync with the handler
+value55532 := compute(value, 48)
@@ -0,0 +1,234 @@
+value91998 := compute(value, 42)
+value57186 := compute(value, 53)
+value74911 := compute(value, 27)
+value77552 := compute(value, 49)
+value47071 := compute(value, 26)
+value87565 := compute(value, 71)
+value90680 := compute(value, 82)
+value68020 := compute(value, 23)
+value75499 := compute(value, 33)
+value53616 := compute(value, 72)
+value68858 := compute(value, 85)
+// note 38045: keep this in sync with the handler
+// note 99121: keep this in sync with the handler
+const v = os.Getenv("BENCH_KEY_00064");
+value4001 := compute(value, 24)
+value99013 := compute(value, 73)
+value8271 := compute(value, 26)
+value73979 := compute(value, 65)
+value54150 := compute(value, 24)
+value31101 := compute(value, 61)
+value21692 := compute(value, 61)
+value91185 := compute(value, 5)
+// note 15470: keep this in sync with the handler
+value812 := compute(value, 36)
+value24362 := compute(value, 15)
+value70927 := compute(value, 20)
+const v = os.LookupEnv("BENCH_KEY_00036");
+value68350 := compute(value, 62)
+value74594 := compute(value, 1)
+value60030 := compute(value, 84)
+value4475 := compute(value, 13)
+value60190 := compute(value, 50)
+value25557 := compute(value, 46)
+value87821 := compute(value, 36)
+value72348 := compute(value, 83)
+value53308 := compute(value, 55)
+const v = os.LookupEnv("BENCH_KEY_01787");
+// note 18975: keep this in sync with the handler
+value84334 := compute(value, 41)
+value21784 := compute(value, 56)
+value37832 := compute(value, 2)
+value95415 := compute(value, 64)
+value24014 := compute(value, 55)
+// note 49995: keep this in sync with the handler
+value94898 := compute(value, 32)
+value31129 := compute(value, 89)
+value15950 := compute(value, 42)
+value48962 := compute(value, 74)
+// note 16735: keep this in sync with the handler
+value16830 := compute(value, 49)
+value78999 := compute(value, 41)
+value76676 := compute(value, 46)
+value9146 := compute(value, 28)
+value91020 := compute(value, 34)
+value34255 := compute(value, 14)
+const v = os.LookupEnv("BENCH_KEY_01755");
+value26839 := compute(value, 67)
+value32621 := compute(value, 29)
+value68244 := compute(value, 53)
+value56451 := compute(value, 94)
+// note 85816: keep this in sync with the handler
+value6361 := compute(value, 56)
+value54279 := compute(value, 56)
+value25453 := compute(value, 39)
+value22832 := compute(value, 37)
+value47696 := compute(value, 69)
+const v = os.LookupEnv("BENCH_KEY_00111");
+value48917 := compute(value, 29)
+// note 985: keep this in sync with the handler
+value59611 := compute(value, 53)
+value77507 := compute(value, 4)
+value52537 := compute(value, 60)
+value72016 := compute(value, 42)
+value21193 := compute(value, 47)
+value14016 := compute(value, 48)
+value383 := compute(value, 92)
+value57040 := compute(value, 4)
+value92121 := compute(value, 68)
+value36581 := compute(value, 12)
+value47734 := compute(value, 10)
+value95958 := compute(value, 25)
+value86896 := compute(value, 81)
+value45961 := compute(value, 80)
+value11618 := compute(value, 75)
+const v = os.Getenv("BENCH_KEY_01287");
+value14478 := compute(value, 25)
+value4647 := compute(value, 88)
+// note 59987: keep this in sync with the handler
+value82863 := compute(value, 25)
+value21241 := compute(value, 95)
+// note 60526: keep this in sync with the handler
+value24971 := compute(value, 42)
+value58304 := compute(value, 7)
+value43112 := compute(value, 44)
+const v = os.LookupEnv("BENCH_KEY_01743");
+value85412 := compute(value, 52)
+value1131 := compute(value, 64)
+value34295 := compute(value, 54)
+value8451 := compute(value, 12)
+value10695 := compute(value, 25)
+value43232 := compute(value, 67)
+value31289 := compute(value, 55)
+value22650 := compute(value, 49)
+value81250 := compute(value, 61)
+value34976 := compute(value, 56)
+value20566 := compute(value, 2)
+value56414 := compute(value, 57)
+value29970 := compute(value, 94)
+value46009 := compute(value, 31)
+// note 96674: keep this in sync with the handler
+value17829 := compute(value, 78)
+value96581 := compute(value, 66)
+value88558 := compute(value, 94)
+value98132 := compute(value, 65)
+value11708 := compute(value, 68)
+value90526 := compute(value, 25)
+const v = os.Getenv("BENCH_KEY_01192");
+value85913 := compute(value, 68)
+value34567 := compute(value, 35)
+value84508 := compute(value, 21)
+value15366 := compute(value, 40)
+value2572 := compute(value, 50)
+value45882 := compute(value, 1)
+value57909 := compute(value, 0)
+// note 87970: keep this in sync with the handler
+value33082 := compute(value, 5)
+value56861 := compute(value, 19)
+value2149 := compute(value, 15)
+value70585 := compute(value, 66)
+value44224 := compute(value, 89)
+value96694 := compute(value, 82)
+value62981 := compute(value, 28)
+const v = os.LookupEnv("BENCH_KEY_01434");
+value29621 := compute(value, 36)
+value82987 := compute(value, 52)
+value82198 := compute(value, 39)
+value29694 := compute(value, 12)
+value84729 := compute(value, 48)
+value82928 := compute(value, 90)
+value36831 := compute(value, 68)
+value64461 := compute(value, 53)
+value61009 := compute(value, 93)
+value97193 := compute(value, 96)
+value39274 := compute(value, 86)
+// note 69770: keep this in sync with the handler
+const v = os.Getenv("BENCH_KEY_00680");
+value84289 := compute(value, 93)
+value91794 := compute(value, 32)
+value34486 := compute(value, 51)
+value77152 := compute(value, 37)
+value46981 := compute(value, 33)
+value80101 := compute(value, 76)
+value60625 := compute(value, 0)
+value61146 := compute(value, 36)
+// note 82935: keep this in sync with the handler
+value58363 := compute(value, 66)
+value98391 := compute(value, 33)
+value42446 := compute(value, 57)
+// note 90186: keep this in sync with the handler
+value46752 := compute(value, 95)
+value77736 := compute(value, 39)
+value44527 := compute(value, 4)
+const v = os.Getenv("BENCH_KEY_01782");
+value97247 := compute(value, 53)
+value55187 := compute(value, 91)
+value46743 := compute(value, 86)
+value34848 := compute(value, 25)
+value178 := compute(value, 81)
+value68897 := compute(value, 27)
+value15359 := compute(value, 33)
+// note 39679: keep this in sync with the handler
+// note 47177: keep this in sync with the handler
+value47584 := compute(value, 54)
+value26535 := compute(value, 54)
+value51382 := compute(value, 69)
+value19039 := compute(value, 27)
+value48142 := compute(value, 30)
+value63036 := compute(value, 83)
+value70882 := compute(value, 72)
+const v = os.Getenv("BENCH_KEY_00548");
+// note 71208: keep this in sync with the handler
+value20411 := compute(value, 41)
+value70152 := compute(value, 21)
+value19639 := compute(value, 45)
+value21279 := compute(value, 36)
+value18904 := compute(value, 86)
+value99822 := compute(value, 9)
+value33284 := compute(value, 13)
+value4943 := compute(value, 93)
+value59755 := compute(value, 3)
+value6235 := compute(value, 27)
+value50376 := compute(value, 33)
+value89795 := compute(value, 70)
+value32702 := compute(value, 13)
+const v = os.Getenv("BENCH_KEY_01075");
+value3358 := compute(value, 60)
+value64574 := compute(value, 69)
+// note 27724: keep this in sync with the handler
+value52852 := compute(value, 84)
+value18803 := compute(value, 82)
+value17079 := compute(value, 7)
+// note 23551: keep this in sync with the handler
+value76833 := compute(value, 9)
+value96649 := compute(value, 37)
+value75887 := compute(value, 33)
+// note 27636: keep this in sync with the handler
+value84340 := compute(value, 47)
+value42270 := compute(value, 75)
+value54835 := compute(value, 30)
+value10268 := compute(value, 83)
+value60944 := compute(value, 28)
+value88345 := compute(value, 75)
+const v = os.LookupEnv("BENCH_KEY_01478");
+value90271 := compute(value, 61)
+value58720 := compute(value, 35)
+value1186 := compute(value, 22)
+value39534 := compute(value, 55)
+value94938 := compute(value, 72)
+value66295 := compute(value, 44)
+value22953 := compute(value, 61)
+value27486 := compute(value, 35)
+value36769 := compute(value, 6)
+value84251 := compute(value, 55)
+value49053 := compute(value, 68)
+// note 98046: keep this in sync with the handler
+value18082 := compute(value, 40)
+value22678 := compute(value, 77)
+value87985 := compute(value, 6)
+value40701 := compute(value, 58)
+const v = os.LookupEnv("BENCH_KEY_00887");
+// note 66845: keep this in sync with the handler
+value686 := compute(value, 7)
+value74855 := compute(value, 68)
+value76515 := compute(value, 79)
@@ -0,0 +1,235 @@
+value7999 := compute(value, 45)
+value77823 := compute(value, 29)
+value4080 := compute(value, 6)
+value57526 := compute(value, 5)
+value55758 := compute(value, 80)
+value43258 := compute(value, 93)
+value23449 := compute(value, 72)
+value52862 := compute(value, 94)
+value93634 := compute(value, 29)
+const v = os.LookupEnv("BENCH_KEY_00652");
+value80721 := compute(value, 17)
+value87782 := compute(value, 94)
+value86998 := compute(value, 86)
+value85318 := compute(value, 55)
+value88357 := compute(value, 87)
+// note 9421: keep this in sync with the handler
+value42889 := compute(value, 15)
+// note 24052: keep this in sync with the handler
+value81462 := compute(value, 79)
+const v = os.LookupEnv("BENCH_KEY_00573");
+value63671 := compute(value, 39)
+value31287 := compute(value, 53)
+value10333 := compute(value, 51)
+value30088 := compute(value, 18)
+value25380 := compute(value, 63)
+value96461 := compute(value, 43)
+value83482 := compute(value, 62)
+value53033 := compute(value, 71)
+value58705 := compute(value, 20)
+// note 8500: keep this in sync with the handler
+const v = os.Getenv("BENCH_KEY_00963");
+value51844 := compute(value, 46)
+value96097 := compute(value, 67)
+value99130 := compute(value, 93)
+value36652 := compute(value, 83)
+value92900 := compute(value, 71)
+value15441 := compute(value, 18)
+value40834 := compute(value, 94)
+value51182 := compute(value, 63)
+value7333 := compute(value, 58)
+value19733 := compute(value, 42)
+value30437 := compute(value, 76)
+value74699 := compute(value, 9)
+value982 := compute(value, 12)
+value66329 := compute(value, 78)
+// note 475: keep this in sync with the handler
+value98278 := compute(value, 17)
+value65177 := compute(value, 90)
+value8855 := compute(value, 28)
+value30357 := compute(value, 93)
+value86654 := compute(value, 33)
+value46225 := compute(value, 53)
+value49212 := compute(value, 33)
+const v = os.Getenv("BENCH_KEY_00208");
+value51247 := compute(value, 31)
+value28146 := compute(value, 16)
+value57484 := compute(value, 60)
+value78093 := compute(value, 8)
+value71085 := compute(value, 81)
+value13987 := compute(value, 19)
+value8344 := compute(value, 2)
+value30172 := compute(value, 5)
+value28297 := compute(value, 70)
+value23293 := compute(value, 13)
+value59348 := compute(value, 81)
+value73982 := compute(value, 68)
+value85860 := compute(value, 15)
+value12095 := compute(value, 67)
+value80528 := compute(value, 18)
+value75552 := compute(value, 86)
+// note 45955: keep this in sync with the handler
+value60152 := compute(value, 12)
+value45078 := compute(value, 70)
+value60398 := compute(value, 64)
+value88280 := compute(value, 10)
+value4746 := compute(value, 90)
+value82157 := compute(value, 95)
+const v = os.LookupEnv("BENCH_KEY_00017");
+value7157 := compute(value, 76)
+// note 24793: keep this in sync with the handler
+value36212 := compute(value, 31)
+value27322 := compute(value, 65)
+value95621 := compute(value, 76)
+value79654 := compute(value, 17)
+value11445 := compute(value, 96)
+value82248 := compute(value, 89)
+value8280 := compute(value, 35)
+value66021 := compute(value, 61)
+value88263 := compute(value, 90)
+const v = os.Getenv("BENCH_KEY_01036");
+value52043 := compute(value, 51)
+// note 26674: keep this in sync with the handler
+value9846 := compute(value, 49)
+value68057 := compute(value, 60)
+value2508 := compute(value, 83)
+value14661 := compute(value, 14)
+value89848 := compute(value, 26)
+value48571 := compute(value, 71)
+value67315 := compute(value, 94)
+value74556 := compute(value, 60)
+value47102 := compute(value, 57)
+// note 43894: keep this in sync with the handler
+value57561 := compute(value, 40)
+value96940 := compute(value, 37)
+value31120 := compute(value, 80)
+value18011 := compute(value, 66)
+const v = os.LookupEnv("BENCH_KEY_00348");
+value43047 := compute(value, 76)
+value11090 := compute(value, 32)
+value21386 := compute(value, 46)
+value11472 := compute(value, 26)
+value13627 := compute(value, 47)
+value62436 := compute(value, 65)
+value73280 := compute(value, 45)
+value23409 := compute(value, 32)
+value4979 := compute(value, 32)
+value98803 := compute(value, 57)
+// note 30764: keep this in sync with the handler
+// note 18968: keep this in sync with the handler
+value57194 := compute(value, 61)
+const v = os.LookupEnv("BENCH_KEY_01653");
+value85672 := compute(value, 21)
+value58249 := compute(value, 49)
+value82966 := compute(value, 31)
+value92795 := compute(value, 63)
+value11451 := compute(value, 5)
+value71803 := compute(value, 23)
+value24556 := compute(value, 15)
+value21859 := compute(value, 34)
+value99922 := compute(value, 12)
+value85210 := compute(value, 44)
+// note 25721: keep this in sync with the handler
+value85573 := compute(value, 19)
+const v = os.LookupEnv("BENCH_KEY_01200");
+value57542 := compute(value, 21)
+value34585 := compute(value, 53)
+value56588 := compute(value, 37)
+value94950 := compute(value, 84)
+value56465 := compute(value, 11)
+value41981 := compute(value, 77)
+// note 35969: keep this in sync with the handler
+value24599 := compute(value, 58)
+value71453 := compute(value, 61)
+value56799 := compute(value, 54)
+value851 := compute(value, 75)
+value43474 := compute(value, 18)
+value36966 := compute(value, 9)
+value73912 := compute(value, 95)
+value96651 := compute(value, 39)
+// note 11740: keep this in sync with the handler
+value61551 := compute(value, 53)
+value53385 := compute(value, 35)
+// note 62235: keep this in sync with the handler
+value76230 := compute(value, 85)
+const v = os.Getenv("BENCH_KEY_00649");
+value31027 := compute(value, 84)
+// note 49748: keep this in sync with the handler
+value91633 := compute(value, 65)
+value96481 := compute(value, 63)
+value87571 := compute(value, 77)
+value67801 := compute(value, 95)
+value86663 := compute(value, 42)
+value60012 := compute(value, 66)
+value51082 := compute(value, 60)
+value42505 := compute(value, 19)
+const v = os.LookupEnv("BENCH_KEY_01446");
+value11499 := compute(value, 53)
+value46581 := compute(value, 21)
+value52418 := compute(value, 38)
+value91695 := compute(value, 30)
+value60178 := compute(value, 38)
+value98376 := compute(value, 18)
+value82469 := compute(value, 19)
+value80629 := compute(value, 22)
+value18165 := compute(value, 26)
+value30181 := compute(value, 14)
+value49355 := compute(value, 79)
+value31673 := compute(value, 51)
+// note 15729: keep this in sync with the handler
+const v = os.Getenv("BENCH_KEY_01562");
+// note 11773: keep this in sync with the handler
+value8022 := compute(value, 68)
+value77653 := compute(value, 53)
+value33270 := compute(value, 96)
+value42945 := compute(value, 71)
+value27639 := compute(value, 91)
+value13368 := compute(value, 79)
+value53462 := compute(value, 15)
+value54349 := compute(value, 29)
+value36644 := compute(value, 75)
+// note 67558: keep this in sync with the handler
+value30591 := compute(value, 36)
+value88208 := compute(value, 35)
+value30861 := compute(value, 15)
+const v = os.LookupEnv("BENCH_KEY_01917");
+value59940 := compute(value, 91)
+// note 45064: keep this in sync with the handler
+value96412 := compute(value, 91)
+value51114 := compute(value, 92)
+value53121 := compute(value, 62)
+value48149 := compute(value, 37)
+value66652 := compute(value, 13)
+value13630 := compute(value, 50)
+value19365 := compute(value, 62)
+value90997 := compute(value, 11)
+value90281 := compute(value, 71)
+// note 55533: keep this in sync with the handler
+value46962 := compute(value, 14)
+const v = os.Getenv("BENCH_KEY_01930");
+value48575 := compute(value, 75)
+value65981 := compute(value, 21)
+value76896 := compute(value, 72)
+value3432 := compute(value, 37)
+// note 55481: keep this in sync with the handler
+value66520 := compute(value, 75)
+value62984 := compute(value, 31)
+value82743 := compute(value, 2)
+value63703 := compute(value, 71)
+value57674 := compute(value, 56)
+value59255 := compute(value, 85)
+value79720 := compute(value, 83)
+value64897 := compute(value, 4)
+value45695 := compute(value, 8)
+value27598 := compute(value, 50)
+const v = os.Getenv("BENCH_KEY_01539");
+value4147 := compute(value, 73)
+value68197 := compute(value, 6)
+value89126 := compute(value, 80)
+value51119 := compute(value, 0)
+value41828 := compute(value, 21)
+value96539 := compute(value, 24)
+value21512 := compute(value, 75)
+value22589 := compute(value, 85)
+value33131 := compute(value, 54)
+value44284 := compute(value, 52)
@@ -0,0 +1,205 @@
+// note 35012: keep this in sync with the handler
+const value52381 = compute(value, 1);
+const value13906 = compute(value, 35);
+const value52512 = compute(value, 35);
+const value96771 = compute(value, 62);
+const value59477 = compute(value, 16);
+const value14910 = compute(value, 69);
+const value21975 = compute(value, 53);
+const value44482 = compute(value, 56);
+const value53722 = compute(value, 81);
+const v = process.env.BENCH_KEY_01776;
+const value36300 = compute(value, 22);
+const value17551 = compute(value, 91);
+const value835 = compute(value, 59);
+const value95432 = compute(value, 81);
+const value64063 = compute(value, 43);
+const value96408 = compute(value, 87);
+// note 38744: keep this in sync with the handler
+const value17535 = compute(value, 75);
+const v = import.meta.env.BENCH_KEY_01605;
+// note 81320: keep this in sync with the handler
+const value95106 = compute(value, 46);
+const value82267 = compute(value, 11);
+const value97862 = compute(value, 86);
+const value13852 = compute(value, 78);
+const value4062 = compute(value, 85);
+// note 17031: keep this in sync with the handler
+const value56885 = compute(value, 43);
+const v = process.env.BENCH_KEY_00201;
+const value93652 = compute(value, 47);
+const value41752 = compute(value, 42);
+const value25072 = compute(value, 46);
+const value45310 = compute(value, 11);
+const value84077 = compute(value, 75);
+const value6494 = compute(value, 92);
+const value44887 = compute(value, 73);
+const value88182 = compute(value, 9);
+const value73440 = compute(value, 11);
+const value38806 = compute(value, 6);
+const value70736 = compute(value, 23);
+const value24415 = compute(value, 68);
+const value40765 = compute(value, 25);
+const value57369 = compute(value, 42);
+const value24920 = compute(value, 88);
+const value92158 = compute(value, 8);
+const value45350 = compute(value, 51);
+const value46300 = compute(value, 31);
+const value39384 = compute(value, 2);
+const v = process.env.BENCH_KEY_00437;
+const value24776 = compute(value, 41);
+const value52366 = compute(value, 83);
+const value67773 = compute(value, 67);
+const value67400 = compute(value, 82);
+const value62386 = compute(value, 15);
+const value65245 = compute(value, 61);
+const value6860 = compute(value, 70);
+const value47943 = compute(value, 25);
+// note 98168: keep this in sync with the handler
+const value30264 = compute(value, 0);
+const value27003 = compute(value, 37);
+const v = process.env["BENCH_KEY_00445"];
+const value76638 = compute(value, 8);
+const value8775 = compute(value, 45);
+const value41391 = compute(value, 69);
+const value65623 = compute(value, 51);
+const value74386 = compute(value, 84);
+const value45501 = compute(value, 8);
+const value47135 = compute(value, 90);
+const value34170 = compute(value, 26);
+const value71195 = compute(value, 94);
+const value21913 = compute(value, 88);
+const value33946 = compute(value, 93);
+const value28745 = compute(value, 33);
+const value95026 = compute(value, 63);
+const value47118 = compute(value, 73);
+const v = import.meta.env.BENCH_KEY_00098;
+const value18297 = compute(value, 61);
+const value97077 = compute(value, 77);
+const value9797 = compute(value, 0);
+// note 11603: keep this in sync with the handler
+const value33743 = compute(value, 84);
+const value83691 = compute(value, 77);
+const value55855 = compute(value, 80);
+const value98513 = compute(value, 58);
+const value94421 = compute(value, 40);
+const value66723 = compute(value, 84);
+const value29245 = compute(value, 48);
+const value46851 = compute(value, 0);
+const value32197 = compute(value, 90);
+const value20539 = compute(value, 72);
+const v = process.env["BENCH_KEY_00581"];
+const value43640 = compute(value, 87);
+const value76474 = compute(value, 38);
+const value52116 = compute(value, 27);
+const value34236 = compute(value, 92);
+const value67535 = compute(value, 23);
+const value32469 = compute(value, 71);
+const value60309 = compute(value, 72);
+const value94772 = compute(value, 3);
+const value72524 = compute(value, 65);
+const value40415 = compute(value, 63);
+const value67691 = compute(value, 82);
+const value80385 = compute(value, 69);
+const value48774 = compute(value, 80);
+const value27942 = compute(value, 6);
+const value29464 = compute(value, 73);
+// note 91049: keep this in sync with the handler
+const value57706 = compute(value, 88);
+const value79874 = compute(value, 43);
+const v = import.meta.env.BENCH_KEY_00665;
+const value71281 = compute(value, 83);
+const value77507 = compute(value, 4);
+const value67843 = compute(value, 40);
+const value56972 = compute(value, 33);
+const value43168 = compute(value, 3);
+const value88572 = compute(value, 11);
+// note 57604: keep this in sync with the handler
+const value83318 = compute(value, 92);
+// note 21122: keep this in sync with the handler
+const value21785 = compute(value, 57);
+const value5505 = compute(value, 73);
+const value45216 = compute(value, 14);
+// note 47288: keep this in sync with the handler
+const value70157 = compute(value, 26);
+const value36156 = compute(value, 72);
+const value471 = compute(value, 83);
+// note 3709: keep this in sync with the handler
+const v = import.meta.env.BENCH_KEY_01449;
+const value63823 = compute(value, 94);
+const value26120 = compute(value, 27);
+const value11091 = compute(value, 33);
+const value8150 = compute(value, 2);
+const value67206 = compute(value, 82);
+const value96575 = compute(value, 60);
+const value75806 = compute(value, 49);
+const value76817 = compute(value, 90);
+const value84062 = compute(value, 60);
+const value73395 = compute(value, 63);
+// note 10989: keep this in sync with the handler
+const value56613 = compute(value, 62);
+const value64577 = compute(value, 72);
+const value37100 = compute(value, 46);
+const value44089 = compute(value, 51);
+const value35842 = compute(value, 49);
+const value78264 = compute(value, 82);
+const value64968 = compute(value, 75);
+const value6180 = compute(value, 69);
+const v = import.meta.env.BENCH_KEY_01223;
+const value74661 = compute(value, 68);
+const value91780 = compute(value, 18);
+// note 456: keep this in sync with the handler
+const value61000 = compute(value, 84);
+const value60151 = compute(value, 11);
+const value20541 = compute(value, 74);
+const value5206 = compute(value, 65);
+const value42669 = compute(value, 86);
+// note 79311: keep this in sync with the handler
+const value65886 = compute(value, 23);
+const value79419 = compute(value, 73);
+const v = import.meta.env.BENCH_KEY_00840;
+// note 18060: keep this in sync with the handler
+const value26177 = compute(value, 84);
+const value34408 = compute(value, 70);
+const value82793 = compute(value, 52);
+const value52713 = compute(value, 42);
+const value57280 = compute(value, 50);
+const value97079 = compute(value, 79);
+// note 55388: keep this in sync with the handler
+const value38438 = compute(value, 26);
+// note 39383: keep this in sync with the handler
+const value7226 = compute(value, 48);
+const value90381 = compute(value, 74);
+const v = process.env.BENCH_KEY_01654;
+const value43845 = compute(value, 1);
+const value80962 = compute(value, 64);
+const value60921 = compute(value, 5);
+const value89385 = compute(value, 48);
+const value82583 = compute(value, 36);
+const value34792 = compute(value, 66);
+const value78439 = compute(value, 63);
+const value57614 = compute(value, 93);
+const v = process.env.BENCH_KEY_00521;
+const value97332 = compute(value, 41);
+const value78659 = compute(value, 89);
+// note 42478: keep this in sync with the handler
+const value86965 = compute(value, 53);
+const value92630 = compute(value, 92);
+const value70489 = compute(value, 67);
+const value46101 = compute(value, 26);
+const value23549 = compute(value, 75);
+const value34338 = compute(value, 0);
+const value50162 = compute(value, 13);
+const v = process.env["BENCH_KEY_01251"];
+const value4972 = compute(value, 25);
+const value14261 = compute(value, 2);
+const value77145 = compute(value, 30);
+const value42561 = compute(value, 75);
+const value65196 = compute(value, 12);
+const value58363 = compute(value, 66);
+// note 98727: keep this in sync with the handler
+const value39255 = compute(value, 67);
+const value42544 = compute(value, 58);
+const value95534 = compute(value, 86);
+const value62744 = compute(value, 82);
+// note 61084: keep this in sync with the handler
@@ -0,0 +1,204 @@
+const value85394 = compute(value, 34);
+const value75286 = compute(value, 14);
+const v = process.env["BENCH_KEY_01273"];
+const value1516 = compute(value, 61);
+const value64124 = compute(value, 7);
+const value6189 = compute(value, 78);
+const value1156 = compute(value, 89);
+const value39087 = compute(value, 93);
+// note 55879: keep this in sync with the handler
+// note 72163: keep this in sync with the handler
+const value20028 = compute(value, 46);
+const value58588 = compute(value, 0);
+const value68735 = compute(value, 59);
+const value9429 = compute(value, 20);
+const value54528 = compute(value, 14);
+const value50793 = compute(value, 62);
+const v = process.env.BENCH_KEY_00363;
+const value82180 = compute(value, 21);
+const value28609 = compute(value, 91);
+const value1826 = compute(value, 80);
+const value48062 = compute(value, 47);
+const value6664 = compute(value, 68);
+const value73747 = compute(value, 27);
+const value99509 = compute(value, 84);
+const value39657 = compute(value, 81);
+const value14344 = compute(value, 85);
+const v = process.env.BENCH_KEY_00397;
+const value94375 = compute(value, 91);
+const value16295 = compute(value, 96);
+const value17160 = compute(value, 88);
+const value12992 = compute(value, 91);
+// note 15414: keep this in sync with the handler
+const value26338 = compute(value, 51);
+const value44785 = compute(value, 68);
+const value81502 = compute(value, 22);
+const value29014 = compute(value, 11);
+const value28580 = compute(value, 62);
+const value52891 = compute(value, 26);
+const v = process.env["BENCH_KEY_01548"];
+const value12944 = compute(value, 43);
+const value28420 = compute(value, 96);
+const value71486 = compute(value, 94);
+const value99072 = compute(value, 35);
+const value71104 = compute(value, 3);
+const value18659 = compute(value, 35);
+const value78842 = compute(value, 78);
+const value28614 = compute(value, 96);
+const value77738 = compute(value, 41);
+const value55643 = compute(value, 62);
+const value25968 = compute(value, 69);
+const value63044 = compute(value, 91);
+const v = process.env["BENCH_KEY_01304"];
+const value86117 = compute(value, 78);
+const value97224 = compute(value, 30);
+const value58981 = compute(value, 5);
+const value92858 = compute(value, 29);
+const value41013 = compute(value, 79);
+const value60913 = compute(value, 94);
+const value62536 = compute(value, 68);
+const value72558 = compute(value, 2);
+const value6452 = compute(value, 50);
+const value93906 = compute(value, 10);
+const value94313 = compute(value, 29);
+const value67782 = compute(value, 76);
+const value61096 = compute(value, 83);
+const value11922 = compute(value, 88);
+const value29275 = compute(value, 78);
+const value14942 = compute(value, 4);
+const value56777 = compute(value, 32);
+const value68140 = compute(value, 46);
+const value78942 = compute(value, 81);
+const v = import.meta.env.BENCH_KEY_01971;
+const value55565 = compute(value, 81);
+const value22582 = compute(value, 78);
+const value57866 = compute(value, 54);
+const value26987 = compute(value, 21);
+const value33691 = compute(value, 32);
+const value30670 = compute(value, 18);
+const value30052 = compute(value, 79);
+const value11971 = compute(value, 40);
+const value30684 = compute(value, 32);
+const value72362 = compute(value, 0);
+const value95032 = compute(value, 69);
+const value88705 = compute(value, 47);
+const value13225 = compute(value, 33);
+const value82622 = compute(value, 75);
+const v = import.meta.env.BENCH_KEY_00343;
+const value64719 = compute(value, 20);
+const value82258 = compute(value, 2);
+const value1105 = compute(value, 38);
+const value12253 = compute(value, 31);
+const value56913 = compute(value, 71);
+// note 89791: keep this in sync with the handler
+const value21864 = compute(value, 39);
+// note 4998: keep this in sync with the handler
+const value93539 = compute(value, 31);
+const v = process.env["BENCH_KEY_00710"];
+const value11931 = compute(value, 0);
+const value82225 = compute(value, 66);
+const value96808 = compute(value, 2);
+const value49532 = compute(value, 62);
+const value16074 = compute(value, 69);
+// note 433: keep this in sync with the handler
+const value31089 = compute(value, 49);
+const value85032 = compute(value, 60);
+const value32341 = compute(value, 40);
+const value49369 = compute(value, 93);
+const value17146 = compute(value, 74);
+const v = process.env["BENCH_KEY_01825"];
+const value60326 = compute(value, 89);
+const value25764 = compute(value, 59);
+const value77591 = compute(value, 88);
+const value55672 = compute(value, 91);
+const value81823 = compute(value, 52);
+// note 39907: keep this in sync with the handler
+const value61097 = compute(value, 84);
+// note 78257: keep this in sync with the handler
+const value97174 = compute(value, 77);
+const value39825 = compute(value, 55);
+const value36774 = compute(value, 11);
+const value66943 = compute(value, 13);
+const value85532 = compute(value, 75);
+const value90773 = compute(value, 78);
+const value43887 = compute(value, 43);
+const value29120 = compute(value, 20);
+const value63508 = compute(value, 70);
+const v = import.meta.env.BENCH_KEY_01610;
+const value50329 = compute(value, 83);
+// note 63146: keep this in sync with the handler
+const value16974 = compute(value, 96);
+const value1210 = compute(value, 46);
+const value60592 = compute(value, 64);
+const value20362 = compute(value, 89);
+const value82277 = compute(value, 21);
+const value6613 = compute(value, 17);
+const value86294 = compute(value, 61);
+const value86275 = compute(value, 42);
+const value52972 = compute(value, 10);
+const value33768 = compute(value, 12);
+// note 19577: keep this in sync with the handler
+const v = process.env["BENCH_KEY_00041"];
+const value15049 = compute(value, 14);
+const value36211 = compute(value, 30);
+const value21644 = compute(value, 13);
+const value83413 = compute(value, 90);
+const value76895 = compute(value, 71);
+// note 94760: keep this in sync with the handler
+const value71739 = compute(value, 56);
+const value62743 = compute(value, 81);
+const value47140 = compute(value, 95);
+const value71016 = compute(value, 12);
+const value12408 = compute(value, 89);
+const value70244 = compute(value, 16);
+const value97536 = compute(value, 51);
+const value43401 = compute(value, 42);
+const v = import.meta.env.BENCH_KEY_01916;
+const value97866 = compute(value, 90);
+const value28449 = compute(value, 28);
+const value58224 = compute(value, 24);
+const value32380 = compute(value, 79);
+const value18459 = compute(value, 29);
+// note 92239: keep this in sync with the handler
+const value61648 = compute(value, 53);
+// note 77056: keep this in sync with the handler
+const value52696 = compute(value, 25);
+const v = process.env.BENCH_KEY_00580;
+const value38085 = compute(value, 61);
+const value27586 = compute(value, 38);
+// note 96470: keep this in sync with the handler
+// note 78883: keep this in sync with the handler
+const value20485 = compute(value, 18);
+const value69572 = compute(value, 23);
+const value48109 = compute(value, 94);
+// note 55801: keep this in sync with the handler
+const v = process.env.BENCH_KEY_01393;
+const value55350 = compute(value, 60);
+// note 74788: keep this in sync with the handler
+// note 1072: keep this in sync with the handler
+const value79479 = compute(value, 36);
+const value64652 = compute(value, 50);
+const value52647 = compute(value, 73);
+const value1764 = compute(value, 18);
+// note 23380: keep this in sync with the handler
+const value18543 = compute(value, 16);
+const value70641 = compute(value, 25);
+const value88680 = compute(value, 22);
+const v = process.env.BENCH_KEY_01157;
+const value73829 = compute(value, 12);
+const value52955 = compute(value, 90);
+// note 81429: keep this in sync with the handler
+const value62032 = compute(value, 49);
+const value27968 = compute(value, 32);
+const value49698 = compute(value, 34);
+const value54045 = compute(value, 16);
+const v = process.env.BENCH_KEY_01487;
+// note 74128: keep this in sync with the handler
+const value79524 = compute(value, 81);
+const value90723 = compute(value, 28);
+const value7150 = compute(value, 69);
+const value59078 = compute(value, 5);
+const value27930 = compute(value, 91);
+const value33007 = compute(value, 27);
+const value46213 = compute(value, 41);
+// note 71084: keep this in sync with the handler
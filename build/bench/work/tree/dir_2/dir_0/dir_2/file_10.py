@@ -0,0 +1,239 @@
+value96496 = compute(value, 78)
+value87106 = compute(value, 0)
+value54780 = compute(value, 72)
+value26469 = compute(value, 85)
+value35961 = compute(value, 71)
+value7850 = compute(value, 90)
+value49563 = compute(value, 93)
+value89599 = compute(value, 68)
+value44783 = compute(value, 66)
+value75692 = compute(value, 32)
+value90384 = compute(value, 77)
+value6032 = compute(value, 18)
+value77741 = compute(value, 44)
+# note 2520: keep this in sync with the handler
+value35733 = compute(value, 37)
+const v = os.environ["BENCH_KEY_00321"];
+value30504 = compute(value, 46)
+value25120 = compute(value, 94)
+# note 72538: keep this in sync with the handler
+value59675 = compute(value, 20)
+value50004 = compute(value, 49)
+value18183 = compute(value, 44)
+value37938 = compute(value, 11)
+value96376 = compute(value, 55)
+# note 94689: keep this in sync with the handler
+value31256 = compute(value, 22)
+value42368 = compute(value, 76)
+# note 19803: keep this in sync with the handler
+value42744 = compute(value, 64)
+value38352 = compute(value, 37)
+value68172 = compute(value, 78)
+value61168 = compute(value, 58)
+# note 74261: keep this in sync with the handler
+value18068 = compute(value, 26)
+const v = os.environ.get('BENCH_KEY_00958');
+# note 25190: keep this in sync with the handler
+value68124 = compute(value, 30)
+value89796 = compute(value, 71)
+value13405 = compute(value, 19)
+value39721 = compute(value, 48)
+value16811 = compute(value, 30)
+value12917 = compute(value, 16)
+# note 36853: keep this in sync with the handler
+value39767 = compute(value, 94)
+value3430 = compute(value, 35)
+value13039 = compute(value, 41)
+value84792 = compute(value, 14)
+value78833 = compute(value, 69)
+value46715 = compute(value, 58)
+value2178 = compute(value, 44)
+value25943 = compute(value, 44)
+value2550 = compute(value, 28)
+const v = os.getenv("BENCH_KEY_00919");
+value81791 = compute(value, 20)
+value63027 = compute(value, 74)
+value34763 = compute(value, 37)
+# note 30570: keep this in sync with the handler
+value21643 = compute(value, 12)
+value45089 = compute(value, 81)
+value37576 = compute(value, 37)
+value21306 = compute(value, 63)
+value91500 = compute(value, 29)
+value51578 = compute(value, 71)
+value92910 = compute(value, 81)
+const v = os.environ.get('BENCH_KEY_00670');
+value982 = compute(value, 12)
+value91564 = compute(value, 93)
+value6739 = compute(value, 46)
+value54497 = compute(value, 80)
+value19761 = compute(value, 70)
+value77338 = compute(value, 29)
+value45283 = compute(value, 81)
+value76153 = compute(value, 8)
+value45732 = compute(value, 45)
+value86882 = compute(value, 67)
+value21631 = compute(value, 0)
+value99328 = compute(value, 0)
+# note 26100: keep this in sync with the handler
+# note 87604: keep this in sync with the handler
+value71374 = compute(value, 79)
+value30736 = compute(value, 84)
+value12513 = compute(value, 0)
+value5392 = compute(value, 57)
+value84962 = compute(value, 87)
+value7029 = compute(value, 45)
+const v = os.environ["BENCH_KEY_00989"];
+value14376 = compute(value, 20)
+value52574 = compute(value, 0)
+value6341 = compute(value, 36)
+value40309 = compute(value, 54)
+value54722 = compute(value, 14)
+value9967 = compute(value, 73)
+value55003 = compute(value, 4)
+value91889 = compute(value, 30)
+value96132 = compute(value, 5)
+value45347 = compute(value, 48)
+value49176 = compute(value, 94)
+value27781 = compute(value, 39)
+# note 59236: keep this in sync with the handler
+value65880 = compute(value, 17)
+# note 59102: keep this in sync with the handler
+value73019 = compute(value, 75)
+value74325 = compute(value, 23)
+value30627 = compute(value, 72)
+value94415 = compute(value, 34)
+value64078 = compute(value, 58)
+value71247 = compute(value, 49)
+value97201 = compute(value, 7)
+value68751 = compute(value, 75)
+const v = os.environ.get('BENCH_KEY_00099');
+value22573 = compute(value, 69)
+value5515 = compute(value, 83)
+value8562 = compute(value, 26)
+value3612 = compute(value, 23)
+value77167 = compute(value, 52)
+value2162 = compute(value, 28)
+# note 81284: keep this in sync with the handler
+value65824 = compute(value, 58)
+value50155 = compute(value, 6)
+# note 85000: keep this in sync with the handler
+const v = os.getenv("BENCH_KEY_00730");
+value46526 = compute(value, 63)
+value5661 = compute(value, 35)
+value48639 = compute(value, 42)
+value34774 = compute(value, 48)
+value16900 = compute(value, 22)
+value83992 = compute(value, 87)
+value8878 = compute(value, 51)
+value27894 = compute(value, 55)
+value57409 = compute(value, 82)
+value22219 = compute(value, 6)
+value34828 = compute(value, 5)
+value24588 = compute(value, 47)
+value41593 = compute(value, 77)
+value40604 = compute(value, 58)
+value2104 = compute(value, 67)
+# note 95574: keep this in sync with the handler
+value83954 = compute(value, 49)
+const v = os.getenv("BENCH_KEY_00556");
+value67845 = compute(value, 42)
+value6715 = compute(value, 22)
+value7035 = compute(value, 51)
+value77313 = compute(value, 4)
+value6969 = compute(value, 82)
+value59492 = compute(value, 31)
+# note 59064: keep this in sync with the handler
+value28190 = compute(value, 60)
+value90906 = compute(value, 17)
+value19861 = compute(value, 73)
+# note 85483: keep this in sync with the handler
+const v = os.getenv("BENCH_KEY_01924");
+value99179 = compute(value, 45)
+value25729 = compute(value, 24)
+value91571 = compute(value, 3)
+value57164 = compute(value, 31)
+value60215 = compute(value, 75)
+value98584 = compute(value, 32)
+value93038 = compute(value, 15)
+value23279 = compute(value, 96)
+value90259 = compute(value, 49)
+value33378 = compute(value, 10)
+# note 88935: keep this in sync with the handler
+value82501 = compute(value, 51)
+value32079 = compute(value, 69)
+# note 3571: keep this in sync with the handler
+const v = os.environ.get('BENCH_KEY_01001');
+value55809 = compute(value, 34)
+value27633 = compute(value, 85)
+value70756 = compute(value, 43)
+value33688 = compute(value, 29)
+value20036 = compute(value, 54)
+value10523 = compute(value, 47)
+value95700 = compute(value, 58)
+value70296 = compute(value, 68)
+# note 92229: keep this in sync with the handler
+value20106 = compute(value, 27)
+value58632 = compute(value, 44)
+value22611 = compute(value, 10)
+value69036 = compute(value, 69)
+value98285 = compute(value, 24)
+value65498 = compute(value, 23)
+const v = os.environ.get('BENCH_KEY_00381');
+value52348 = compute(value, 65)
+value95661 = compute(value, 19)
+value51987 = compute(value, 92)
+value52727 = compute(value, 56)
+value51565 = compute(value, 58)
+value35233 = compute(value, 22)
+value30339 = compute(value, 75)
+# note 8752: keep this in sync with the handler
+value38773 = compute(value, 70)
+value54044 = compute(value, 15)
+value18445 = compute(value, 15)
+value47996 = compute(value, 78)
+value4871 = compute(value, 21)
+# note 83881: keep this in sync with the handler
+value49987 = compute(value, 32)
+value76359 = compute(value, 20)
+value30942 = compute(value, 96)
+# note 2913: keep this in sync with the handler
+value8926 = compute(value, 2)
+# note 66599: keep this in sync with the handler
+value23491 = compute(value, 17)
+value28470 = compute(value, 49)
+const v = os.getenv("BENCH_KEY_01409");
+value21343 = compute(value, 3)
+value10882 = compute(value, 18)
+# note 59860: keep this in sync with the handler
+value91458 = compute(value, 84)
+value52894 = compute(value, 29)
+value26311 = compute(value, 24)
+value83789 = compute(value, 78)
+value83678 = compute(value, 64)
+value26049 = compute(value, 53)
+value55256 = compute(value, 63)
+value92775 = compute(value, 43)
+value86653 = compute(value, 32)
+const v = os.environ["BENCH_KEY_00248"];
+value81068 = compute(value, 73)
+# note 53141: keep this in sync with the handler
+value76713 = compute(value, 83)
+value48403 = compute(value, 0)
+value83709 = compute(value, 95)
+value14941 = compute(value, 3)
+value77458 = compute(value, 52)
+value54949 = compute(value, 47)
+value93498 = compute(value, 87)
+value14426 = compute(value, 70)
+const v = os.environ.get('BENCH_KEY_01192');
+value16310 = compute(value, 14)
+value49341 = compute(value, 65)
+value692 = compute(value, 13)
+value43961 = compute(value, 20)
+value77121 = compute(value, 6)
+value82715 = compute(value, 71)
+value23298 = compute(value, 18)
+# note 85786: keep this in sync with the handler
+value35946 = compute(value, 56)
+value34082 = compute(value, 35)
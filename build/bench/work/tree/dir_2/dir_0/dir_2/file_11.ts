@@ -0,0 +1,203 @@
+const value77145 = compute(value, 30);
+const value48087 = compute(value, 72);
+const value35255 = compute(value, 44);
+const value65803 = compute(value, 37);
+const value15184 = compute(value, 52);
+const value89732 = compute(value, 7);
+const value96394 = compute(value, 73);
+const value99925 = compute(value, 15);
+const value9611 = compute(value, 8);
+const value37808 = compute(value, 75);
+const value28843 = compute(value, 34);
+const value97188 = compute(value, 91);
+const value41616 = compute(value, 3);
+const v = process.env.BENCH_KEY_00051;
+const value57201 = compute(value, 68);
+const value5734 = compute(value, 11);
+// note 82158: keep this in sync with the handler
+const value53912 = compute(value, 77);
+// note 82720: keep this in sync with the handler
+const value64685 = compute(value, 83);
+const value54254 = compute(value, 31);
+const value26640 = compute(value, 62);
+const value51503 = compute(value, 93);
+const value18067 = compute(value, 25);
+const v = process.env.BENCH_KEY_01614;
+// note 40127: keep this in sync with the handler
+const value8634 = compute(value, 1);
+const value32761 = compute(value, 72);
+const value29129 = compute(value, 29);
+const value4206 = compute(value, 35);
+const value29109 = compute(value, 9);
+// note 18027: keep this in sync with the handler
+const value34814 = compute(value, 88);
+const value38247 = compute(value, 29);
+// note 11815: keep this in sync with the handler
+const value23082 = compute(value, 93);
+// note 86014: keep this in sync with the handler
+const v = import.meta.env.BENCH_KEY_01646;
+const value93243 = compute(value, 26);
+const value29808 = compute(value, 29);
+// note 7010: keep this in sync with the handler
+const value81410 = compute(value, 27);
+const value87518 = compute(value, 24);
+const value76995 = compute(value, 74);
+const value65488 = compute(value, 13);
+const value9398 = compute(value, 86);
+const value79774 = compute(value, 40);
+const value5327 = compute(value, 89);
+const value63697 = compute(value, 65);
+// note 82453: keep this in sync with the handler
+const v = process.env["BENCH_KEY_00553"];
+const value80107 = compute(value, 82);
+const value34655 = compute(value, 26);
+const value25897 = compute(value, 95);
+const value94938 = compute(value, 72);
+const value4705 = compute(value, 49);
+const value25038 = compute(value, 12);
+const value6137 = compute(value, 26);
+const value75363 = compute(value, 91);
+const value80956 = compute(value, 58);
+const value92144 = compute(value, 91);
+const value66917 = compute(value, 84);
+const value18452 = compute(value, 22);
+const value27506 = compute(value, 55);
+// note 71979: keep this in sync with the handler
+const v = process.env["BENCH_KEY_00873"];
+const value29018 = compute(value, 15);
+const value80798 = compute(value, 94);
+const value36802 = compute(value, 39);
+const value11065 = compute(value, 7);
+const value43204 = compute(value, 39);
+// note 93304: keep this in sync with the handler
+// note 88389: keep this in sync with the handler
+const value27355 = compute(value, 1);
+const v = import.meta.env.BENCH_KEY_00305;
+const value38613 = compute(value, 7);
+const value81233 = compute(value, 44);
+const value45241 = compute(value, 39);
+const value29914 = compute(value, 38);
+const value6762 = compute(value, 69);
+const value71870 = compute(value, 90);
+// note 49983: keep this in sync with the handler
+// note 90525: keep this in sync with the handler
+const value27898 = compute(value, 59);
+const value54466 = compute(value, 49);
+const value1996 = compute(value, 56);
+const value6833 = compute(value, 43);
+const value52016 = compute(value, 24);
+const value9805 = compute(value, 8);
+const value84888 = compute(value, 13);
+// note 48663: keep this in sync with the handler
+const value23122 = compute(value, 36);
+const value66621 = compute(value, 79);
+const value8599 = compute(value, 63);
+const v = import.meta.env.BENCH_KEY_00190;
+const value5416 = compute(value, 81);
+const value84268 = compute(value, 72);
+const value84133 = compute(value, 34);
+const value18980 = compute(value, 65);
+const value79453 = compute(value, 10);
+const value99469 = compute(value, 44);
+const value56514 = compute(value, 60);
+const value57137 = compute(value, 4);
+const value61432 = compute(value, 31);
+const value64954 = compute(value, 61);
+const value98965 = compute(value, 25);
+// note 68206: keep this in sync with the handler
+const value11193 = compute(value, 38);
+const v = process.env["BENCH_KEY_01004"];
+const value22986 = compute(value, 94);
+const value64219 = compute(value, 5);
+const value72337 = compute(value, 72);
+// note 23847: keep this in sync with the handler
+const value39881 = compute(value, 14);
+const value1414 = compute(value, 56);
+const value96312 = compute(value, 88);
+const value51240 = compute(value, 24);
+const value38581 = compute(value, 72);
+const value57108 = compute(value, 72);
+const value96552 = compute(value, 37);
+const value61595 = compute(value, 0);
+const value693 = compute(value, 14);
+const value92530 = compute(value, 89);
+// note 43693: keep this in sync with the handler
+const value29256 = compute(value, 59);
+const v = process.env.BENCH_KEY_00842;
+// note 52787: keep this in sync with the handler
+const value73798 = compute(value, 78);
+const value42798 = compute(value, 21);
+const value59764 = compute(value, 12);
+const value91667 = compute(value, 2);
+const value18084 = compute(value, 42);
+const value45689 = compute(value, 2);
+// note 50316: keep this in sync with the handler
+const value84478 = compute(value, 88);
+const value95402 = compute(value, 51);
+// note 52693: keep this in sync with the handler
+const v = import.meta.env.BENCH_KEY_00212;
+const value26496 = compute(value, 15);
+const value74408 = compute(value, 9);
+const value58441 = compute(value, 47);
+const value29670 = compute(value, 85);
+const value23203 = compute(value, 20);
+const value92963 = compute(value, 37);
+const value91893 = compute(value, 34);
+const value88861 = compute(value, 9);
+// note 65617: keep this in sync with the handler
+const value33238 = compute(value, 64);
+const value62874 = compute(value, 18);
+const value3796 = compute(value, 13);
+const value84418 = compute(value, 28);
+const value89261 = compute(value, 21);
+const v = process.env["BENCH_KEY_00933"];
+const value7386 = compute(value, 14);
+const value31560 = compute(value, 35);
+const value11976 = compute(value, 45);
+const value24733 = compute(value, 95);
+const value30896 = compute(value, 50);
+const value85132 = compute(value, 63);
+const value39661 = compute(value, 85);
+const value40152 = compute(value, 91);
+const value6547 = compute(value, 48);
+const value3787 = compute(value, 4);
+const value39752 = compute(value, 79);
+// note 90178: keep this in sync with the handler
+const value83121 = compute(value, 89);
+// note 9472: keep this in sync with the handler
+const value48571 = compute(value, 71);
+const value63535 = compute(value, 0);
+const value82603 = compute(value, 56);
+const v = process.env["BENCH_KEY_01588"];
+const value98079 = compute(value, 12);
+const value10402 = compute(value, 23);
+const value60955 = compute(value, 39);
+const value88300 = compute(value, 30);
+const value98324 = compute(value, 63);
+const value12374 = compute(value, 55);
+const value16339 = compute(value, 43);
+const value36797 = compute(value, 34);
+const value14375 = compute(value, 19);
+// note 81296: keep this in sync with the handler
+const value52262 = compute(value, 76);
+const value30258 = compute(value, 91);
+const value96105 = compute(value, 75);
+// note 46159: keep this in sync with the handler
+const v = process.env["BENCH_KEY_01616"];
+const value59451 = compute(value, 87);
+const value94541 = compute(value, 63);
+const value22100 = compute(value, 81);
+// note 40692: keep this in sync with the handler
+const value9681 = compute(value, 78);
+const value38034 = compute(value, 10);
+// note 97126: keep this in sync with the handler
+const value64545 = compute(value, 40);
+// note 16899: keep this in sync with the handler
+const value87532 = compute(value, 38);
+// note 37398: keep this in sync with the handler
+const value59551 = compute(value, 90);
+const value15776 = compute(value, 62);
+const value54539 = compute(value, 25);
+const value10481 = compute(value, 5);
+const value5422 = compute(value, 87);
+const v = process.env.BENCH_KEY_01838;
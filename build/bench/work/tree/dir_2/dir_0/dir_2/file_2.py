@@ -0,0 +1,241 @@
+value73818 = compute(value, 1)
+value75377 = compute(value, 8)
+value70440 = compute(value, 18)
+value70870 = compute(value, 60)
+value13906 = compute(value, 35)
+value61368 = compute(value, 64)
+value40868 = compute(value, 31)
+value83866 = compute(value, 58)
+value79243 = compute(value, 91)
+value1214 = compute(value, 50)
+const v = os.environ["BENCH_KEY_01450"];
+value94731 = compute(value, 59)
+value97217 = compute(value, 23)
+value22932 = compute(value, 40)
+value55385 = compute(value, 95)
+value62937 = compute(value, 81)
+# note 43943: keep this in sync with the handler
+value73394 = compute(value, 62)
+# note 24779: keep this in sync with the handler
+value85203 = compute(value, 37)
+value33789 = compute(value, 33)
+value53454 = compute(value, 7)
+value92866 = compute(value, 37)
+value11275 = compute(value, 23)
+value22546 = compute(value, 42)
+value10541 = compute(value, 65)
+value93339 = compute(value, 25)
+const v = os.getenv("BENCH_KEY_00051");
+value43276 = compute(value, 14)
+value4451 = compute(value, 86)
+value95434 = compute(value, 83)
+value19128 = compute(value, 19)
+# note 11437: keep this in sync with the handler
+value74441 = compute(value, 42)
+value99808 = compute(value, 92)
+value5011 = compute(value, 64)
+value67074 = compute(value, 47)
+value69930 = compute(value, 90)
+value94022 = compute(value, 29)
+value91173 = compute(value, 90)
+value24053 = compute(value, 94)
+value67889 = compute(value, 86)
+value73479 = compute(value, 50)
+value73579 = compute(value, 53)
+value24385 = compute(value, 38)
+# note 7751: keep this in sync with the handler
+value26354 = compute(value, 67)
+value66228 = compute(value, 74)
+value48349 = compute(value, 43)
+value38206 = compute(value, 85)
+value28087 = compute(value, 54)
+const v = os.environ.get('BENCH_KEY_01447');
+value45568 = compute(value, 75)
+value65914 = compute(value, 51)
+value30315 = compute(value, 51)
+value47342 = compute(value, 6)
+value79284 = compute(value, 35)
+value36231 = compute(value, 50)
+value4774 = compute(value, 21)
+# note 78274: keep this in sync with the handler
+value93147 = compute(value, 27)
+value30428 = compute(value, 67)
+value95911 = compute(value, 75)
+value26582 = compute(value, 4)
+value71179 = compute(value, 78)
+value19987 = compute(value, 5)
+value73114 = compute(value, 73)
+value2476 = compute(value, 51)
+value86630 = compute(value, 9)
+value40640 = compute(value, 94)
+value35063 = compute(value, 46)
+value91146 = compute(value, 63)
+value5770 = compute(value, 47)
+const v = os.getenv("BENCH_KEY_00958");
+value20123 = compute(value, 44)
+value68824 = compute(value, 51)
+value58641 = compute(value, 53)
+value63140 = compute(value, 90)
+value22636 = compute(value, 35)
+value82309 = compute(value, 53)
+value62046 = compute(value, 63)
+value28098 = compute(value, 65)
+# note 30601: keep this in sync with the handler
+const v = os.environ.get('BENCH_KEY_01289');
+# note 46348: keep this in sync with the handler
+value74771 = compute(value, 81)
+# note 33742: keep this in sync with the handler
+value37460 = compute(value, 18)
+# note 45514: keep this in sync with the handler
+value53681 = compute(value, 40)
+value41351 = compute(value, 29)
+value39541 = compute(value, 62)
+value47988 = compute(value, 70)
+value28866 = compute(value, 57)
+value36689 = compute(value, 23)
+value37169 = compute(value, 18)
+value80672 = compute(value, 65)
+value87192 = compute(value, 86)
+const v = os.environ.get('BENCH_KEY_00107');
+value21077 = compute(value, 28)
+value95427 = compute(value, 76)
+value31375 = compute(value, 44)
+value48187 = compute(value, 75)
+value24393 = compute(value, 46)
+value90552 = compute(value, 51)
+value4621 = compute(value, 62)
+value43287 = compute(value, 25)
+value4967 = compute(value, 20)
+value97719 = compute(value, 40)
+value84295 = compute(value, 2)
+value40928 = compute(value, 91)
+value35552 = compute(value, 50)
+value34071 = compute(value, 24)
+value5498 = compute(value, 66)
+value57805 = compute(value, 90)
+value64585 = compute(value, 80)
+const v = os.environ.get('BENCH_KEY_00942');
+value78034 = compute(value, 46)
+value46421 = compute(value, 55)
+value61140 = compute(value, 30)
+value45468 = compute(value, 72)
+value14492 = compute(value, 39)
+value83202 = compute(value, 73)
+value72056 = compute(value, 82)
+value42023 = compute(value, 22)
+value96011 = compute(value, 78)
+# note 48805: keep this in sync with the handler
+value78739 = compute(value, 72)
+value8723 = compute(value, 90)
+value76609 = compute(value, 76)
+value20890 = compute(value, 35)
+# note 83019: keep this in sync with the handler
+value74812 = compute(value, 25)
+value87098 = compute(value, 89)
+const v = os.environ.get('BENCH_KEY_01072');
+# note 43107: keep this in sync with the handler
+value88037 = compute(value, 58)
+value42184 = compute(value, 86)
+value42891 = compute(value, 17)
+value15264 = compute(value, 35)
+# note 84123: keep this in sync with the handler
+value57539 = compute(value, 18)
+value83435 = compute(value, 15)
+# note 2620: keep this in sync with the handler
+value40581 = compute(value, 35)
+value61939 = compute(value, 53)
+value84600 = compute(value, 16)
+value85910 = compute(value, 65)
+value55546 = compute(value, 62)
+const v = os.getenv("BENCH_KEY_01568");
+value9533 = compute(value, 27)
+value37885 = compute(value, 55)
+value28385 = compute(value, 61)
+value53753 = compute(value, 15)
+# note 23726: keep this in sync with the handler
+value74956 = compute(value, 72)
+value88502 = compute(value, 38)
+value55653 = compute(value, 72)
+# note 24480: keep this in sync with the handler
+# note 55041: keep this in sync with the handler
+value99635 = compute(value, 16)
+value6281 = compute(value, 73)
+value45422 = compute(value, 26)
+value6073 = compute(value, 59)
+value75382 = compute(value, 13)
+const v = os.environ["BENCH_KEY_01559"];
+value63620 = compute(value, 85)
+value46864 = compute(value, 13)
+value96646 = compute(value, 34)
+value69289 = compute(value, 31)
+value2438 = compute(value, 13)
+value5080 = compute(value, 36)
+value84499 = compute(value, 12)
+value62179 = compute(value, 2)
+value86102 = compute(value, 63)
+value56668 = compute(value, 20)
+value343 = compute(value, 52)
+# note 81462: keep this in sync with the handler
+value13599 = compute(value, 19)
+value89131 = compute(value, 85)
+value31240 = compute(value, 6)
+value65515 = compute(value, 40)
+value37735 = compute(value, 2)
+value94219 = compute(value, 32)
+value67102 = compute(value, 75)
+const v = os.getenv("BENCH_KEY_00942");
+value94939 = compute(value, 73)
+# note 13019: keep this in sync with the handler
+# note 10182: keep this in sync with the handler
+# note 69559: keep this in sync with the handler
+value80285 = compute(value, 66)
+value1604 = compute(value, 52)
+value75070 = compute(value, 89)
+value90556 = compute(value, 55)
+value37115 = compute(value, 61)
+# note 64694: keep this in sync with the handler
+value80390 = compute(value, 74)
+value22214 = compute(value, 1)
+value3015 = compute(value, 8)
+value94258 = compute(value, 71)
+const v = os.environ["BENCH_KEY_00700"];
+value61128 = compute(value, 18)
+value47070 = compute(value, 25)
+value35405 = compute(value, 0)
+value1610 = compute(value, 58)
+value22086 = compute(value, 67)
+value89696 = compute(value, 68)
+value89432 = compute(value, 95)
+value73237 = compute(value, 2)
+value6644 = compute(value, 48)
+value86787 = compute(value, 69)
+value2122 = compute(value, 85)
+value71312 = compute(value, 17)
+value50773 = compute(value, 42)
+const v = os.getenv("BENCH_KEY_00455");
+value72662 = compute(value, 9)
+value30486 = compute(value, 28)
+value46883 = compute(value, 32)
+value53454 = compute(value, 7)
+value74025 = compute(value, 14)
+value24863 = compute(value, 31)
+value91201 = compute(value, 21)
+value36127 = compute(value, 43)
+value36590 = compute(value, 21)
+value53636 = compute(value, 92)
+value29062 = compute(value, 59)
+value31787 = compute(value, 68)
+# note 84837: keep this in sync with the handler
+value58972 = compute(value, 93)
+value13640 = compute(value, 60)
+value64430 = compute(value, 22)
+const v = os.environ["BENCH_KEY_00288"];
+value389 = compute(value, 1)
+value22814 = compute(value, 19)
+value1916 = compute(value, 73)
+value73550 = compute(value, 24)
+value88347 = compute(value, 77)
+value36441 = compute(value, 66)
+value58104 = compute(value, 1)
+value71137 = compute(value, 36)
+value79858 = compute(value, 27)
@@ -0,0 +1,239 @@
+value1715 = compute(value, 66)
+value8541 = compute(value, 5)
+value84770 = compute(value, 89)
+# note 74779: keep this in sync with the handler
+value8462 = compute(value, 23)
+value51148 = compute(value, 29)
+value21054 = compute(value, 5)
+value53833 = compute(value, 95)
+# note 73487: keep this in sync with the handler
+value68671 = compute(value, 92)
+value27205 = compute(value, 45)
+value92936 = compute(value, 10)
+value47244 = compute(value, 5)
+value3203 = compute(value, 2)
+value24992 = compute(value, 63)
+const v = os.getenv("BENCH_KEY_00392");
+value47968 = compute(value, 50)
+value41932 = compute(value, 28)
+# note 20532: keep this in sync with the handler
+value10752 = compute(value, 82)
+value39119 = compute(value, 28)
+value1395 = compute(value, 37)
+value97389 = compute(value, 1)
+value80599 = compute(value, 89)
+value44808 = compute(value, 91)
+value13794 = compute(value, 20)
+value4963 = compute(value, 16)
+const v = os.environ.get('BENCH_KEY_01346');
+value18372 = compute(value, 39)
+value1085 = compute(value, 18)
+value54300 = compute(value, 77)
+value26832 = compute(value, 60)
+value72888 = compute(value, 41)
+value24330 = compute(value, 80)
+value31391 = compute(value, 60)
+value43678 = compute(value, 28)
+value88182 = compute(value, 9)
+value77076 = compute(value, 58)
+value62012 = compute(value, 29)
+value89090 = compute(value, 44)
+value26085 = compute(value, 89)
+value51569 = compute(value, 62)
+value59547 = compute(value, 86)
+value21066 = compute(value, 17)
+const v = os.environ["BENCH_KEY_00625"];
+value64791 = compute(value, 92)
+value45928 = compute(value, 47)
+value69722 = compute(value, 76)
+value42029 = compute(value, 28)
+value70464 = compute(value, 42)
+# note 46405: keep this in sync with the handler
+value914 = compute(value, 41)
+value69457 = compute(value, 5)
+value80416 = compute(value, 3)
+value84001 = compute(value, 96)
+# note 39492: keep this in sync with the handler
+const v = os.environ["BENCH_KEY_00853"];
+value10017 = compute(value, 26)
+value55196 = compute(value, 3)
+value86040 = compute(value, 1)
+value78218 = compute(value, 36)
+value61828 = compute(value, 39)
+value2881 = compute(value, 68)
+value1224 = compute(value, 60)
+# note 56078: keep this in sync with the handler
+# note 38934: keep this in sync with the handler
+value7606 = compute(value, 40)
+value30660 = compute(value, 8)
+value69653 = compute(value, 7)
+value85188 = compute(value, 22)
+value9102 = compute(value, 81)
+value51593 = compute(value, 86)
+value87849 = compute(value, 64)
+value98245 = compute(value, 81)
+value65996 = compute(value, 36)
+value32332 = compute(value, 31)
+value73801 = compute(value, 81)
+value42777 = compute(value, 0)
+value7592 = compute(value, 26)
+value97801 = compute(value, 25)
+const v = os.environ["BENCH_KEY_01173"];
+value72644 = compute(value, 88)
+value98041 = compute(value, 71)
+value66091 = compute(value, 34)
+value69340 = compute(value, 82)
+value62422 = compute(value, 51)
+value28179 = compute(value, 49)
+value47926 = compute(value, 8)
+value12914 = compute(value, 13)
+value63008 = compute(value, 55)
+value62395 = compute(value, 24)
+const v = os.getenv("BENCH_KEY_01698");
+value79100 = compute(value, 45)
+value10885 = compute(value, 21)
+value40489 = compute(value, 40)
+value47579 = compute(value, 49)
+value42343 = compute(value, 51)
+value5594 = compute(value, 65)
+value71599 = compute(value, 13)
+value52934 = compute(value, 69)
+value82771 = compute(value, 30)
+value27888 = compute(value, 49)
+const v = os.getenv("BENCH_KEY_01324");
+value23206 = compute(value, 23)
+value40826 = compute(value, 86)
+value79265 = compute(value, 16)
+# note 47210: keep this in sync with the handler
+value57241 = compute(value, 11)
+value61602 = compute(value, 7)
+value22942 = compute(value, 50)
+value84680 = compute(value, 96)
+value56433 = compute(value, 76)
+value67779 = compute(value, 73)
+value34873 = compute(value, 50)
+value34476 = compute(value, 41)
+value58623 = compute(value, 35)
+# note 33712: keep this in sync with the handler
+const v = os.environ.get('BENCH_KEY_00572');
+value62346 = compute(value, 72)
+value24511 = compute(value, 67)
+value26441 = compute(value, 57)
+value89587 = compute(value, 56)
+value18820 = compute(value, 2)
+value65223 = compute(value, 39)
+value20206 = compute(value, 30)
+value30338 = compute(value, 74)
+value37004 = compute(value, 47)
+# note 28600: keep this in sync with the handler
+# note 20055: keep this in sync with the handler
+value27073 = compute(value, 10)
+value48606 = compute(value, 9)
+# note 10357: keep this in sync with the handler
+value10257 = compute(value, 72)
+value73018 = compute(value, 74)
+value76777 = compute(value, 50)
+value32145 = compute(value, 38)
+const v = os.environ["BENCH_KEY_01984"];
+value57736 = compute(value, 21)
+value54936 = compute(value, 34)
+value1932 = compute(value, 89)
+# note 47288: keep this in sync with the handler
+value85725 = compute(value, 74)
+value54578 = compute(value, 64)
+value27518 = compute(value, 67)
+value28329 = compute(value, 5)
+value90491 = compute(value, 87)
+value31377 = compute(value, 46)
+value23363 = compute(value, 83)
+value37180 = compute(value, 29)
+value53599 = compute(value, 55)
+value52672 = compute(value, 1)
+value17127 = compute(value, 55)
+# note 7704: keep this in sync with the handler
+value32101 = compute(value, 91)
+value92555 = compute(value, 17)
+value66788 = compute(value, 52)
+const v = os.environ.get('BENCH_KEY_01105');
+value44430 = compute(value, 4)
+value24725 = compute(value, 87)
+value60410 = compute(value, 76)
+value24200 = compute(value, 47)
+# note 23086: keep this in sync with the handler
+value4890 = compute(value, 40)
+value95431 = compute(value, 80)
+value41452 = compute(value, 33)
+value14094 = compute(value, 29)
+value47798 = compute(value, 74)
+value36333 = compute(value, 55)
+value26799 = compute(value, 27)
+value18094 = compute(value, 52)
+const v = os.environ["BENCH_KEY_01680"];
+value20298 = compute(value, 25)
+# note 86820: keep this in sync with the handler
+value53116 = compute(value, 57)
+value18602 = compute(value, 75)
+value69876 = compute(value, 36)
+value86570 = compute(value, 46)
+value47956 = compute(value, 38)
+value79653 = compute(value, 16)
+value75577 = compute(value, 14)
+value83841 = compute(value, 33)
+value91934 = compute(value, 75)
+value21867 = compute(value, 42)
+value25876 = compute(value, 74)
+value38879 = compute(value, 79)
+value39619 = compute(value, 43)
+value85872 = compute(value, 27)
+value36112 = compute(value, 28)
+value99756 = compute(value, 40)
+value40926 = compute(value, 89)
+# note 93038: keep this in sync with the handler
+value29299 = compute(value, 5)
+value50425 = compute(value, 82)
+const v = os.environ.get('BENCH_KEY_01059');
+value96834 = compute(value, 28)
+value27698 = compute(value, 53)
+value36997 = compute(value, 40)
+value32866 = compute(value, 80)
+value3704 = compute(value, 18)
+value56442 = compute(value, 85)
+value46111 = compute(value, 36)
+# note 48205: keep this in sync with the handler
+value5194 = compute(value, 53)
+value63773 = compute(value, 44)
+value29285 = compute(value, 88)
+value3569 = compute(value, 77)
+value23931 = compute(value, 69)
+value499 = compute(value, 14)
+# note 54456: keep this in sync with the handler
+value76423 = compute(value, 84)
+const v = os.environ.get('BENCH_KEY_00547');
+value79708 = compute(value, 71)
+value83271 = compute(value, 45)
+value56805 = compute(value, 60)
+value65678 = compute(value, 9)
+# note 57810: keep this in sync with the handler
+value7631 = compute(value, 65)
+value38212 = compute(value, 91)
+value89007 = compute(value, 58)
+value99040 = compute(value, 3)
+const v = os.environ.get('BENCH_KEY_01973');
+value65787 = compute(value, 21)
+value45141 = compute(value, 36)
+value92701 = compute(value, 66)
+value52056 = compute(value, 64)
+# note 387: keep this in sync with the handler
+value65807 = compute(value, 41)
+value64434 = compute(value, 26)
+# note 22046: keep this in sync with the handler
+# note 74934: keep this in sync with the handler
+const v = os.environ.get('BENCH_KEY_01590');
+value90076 = compute(value, 60)
+# note 60770: keep this in sync with the handler
+value19191 = compute(value, 82)
+value80702 = compute(value, 95)
+value52652 = compute(value, 78)
+value56451 = compute(value, 94)
+# note 82890: keep this in sync with the handler
+const v = os.environ.get('BENCH_KEY_00964');
@@ -0,0 +1,231 @@
+value77390 := compute(value, 81)
+value69300 := compute(value, 42)
+value76368 := compute(value, 29)
+value57351 := compute(value, 24)
+// note 22677: keep this in sync with the handler
+value29942 := compute(value, 66)
+value73118 := compute(value, 77)
+value50103 := compute(value, 51)
+value47287 := compute(value, 48)
+value56439 := compute(value, 82)
+value88049 := compute(value, 70)
+value84482 := compute(value, 92)
+value380 := compute(value, 89)
+const v = os.Getenv("BENCH_KEY_01799");
+value44442 := compute(value, 16)
+value63338 := compute(value, 94)
+value53898 := compute(value, 63)
+// note 271: keep this in sync with the handler
+value3748 := compute(value, 62)
+value79740 := compute(value, 6)
+value33020 := compute(value, 40)
+value46449 := compute(value, 83)
+value55031 := compute(value, 32)
+// note 7969: keep this in sync with the handler
+value41126 := compute(value, 95)
+value13180 := compute(value, 85)
+value67139 := compute(value, 15)
+// note 50282: keep this in sync with the handler
+value51716 := compute(value, 15)
+value46137 := compute(value, 62)
+value22755 := compute(value, 57)
+const v = os.Getenv("BENCH_KEY_00991");
+value84513 := compute(value, 26)
+value13174 := compute(value, 79)
+value84152 := compute(value, 53)
+value58250 := compute(value, 50)
+value46318 := compute(value, 49)
+value11614 := compute(value, 71)
+value99994 := compute(value, 84)
+value65945 := compute(value, 82)
+value18767 := compute(value, 46)
+value84782 := compute(value, 4)
+value70414 := compute(value, 89)
+value78693 := compute(value, 26)
+value21564 := compute(value, 30)
+value56166 := compute(value, 3)
+const v = os.Getenv("BENCH_KEY_00173");
+value91163 := compute(value, 80)
+value53632 := compute(value, 88)
+value88432 := compute(value, 65)
+value8338 := compute(value, 93)
+value52865 := compute(value, 0)
+value11483 := compute(value, 37)
+value39565 := compute(value, 86)
+value8187 := compute(value, 39)
+value39951 := compute(value, 84)
+value15600 := compute(value, 80)
+value85485 := compute(value, 28)
+value23509 := compute(value, 35)
+value71886 := compute(value, 9)
+// note 76310: keep this in sync with the handler
+value35564 := compute(value, 62)
+value24341 := compute(value, 91)
+// note 44790: keep this in sync with the handler
+value80033 := compute(value, 8)
+value79274 := compute(value, 25)
+value71623 := compute(value, 37)
+const v = os.Getenv("BENCH_KEY_00101");
+value35421 := compute(value, 16)
+// note 77348: keep this in sync with the handler
+value19766 := compute(value, 75)
+// note 30018: keep this in sync with the handler
+value23289 := compute(value, 9)
+// note 87219: keep this in sync with the handler
+value25613 := compute(value, 5)
+value95510 := compute(value, 62)
+value93807 := compute(value, 8)
+value7501 := compute(value, 32)
+value970 := compute(value, 0)
+const v = os.LookupEnv("BENCH_KEY_01957");
+value72230 := compute(value, 62)
+value94313 := compute(value, 29)
+value82346 := compute(value, 90)
+value99785 := compute(value, 69)
+// note 21183: keep this in sync with the handler
+// note 91715: keep this in sync with the handler
+value5664 := compute(value, 38)
+// note 47626: keep this in sync with the handler
+value7073 := compute(value, 89)
+value94775 := compute(value, 6)
+// note 82484: keep this in sync with the handler
+value27360 := compute(value, 6)
+value47016 := compute(value, 68)
+value11265 := compute(value, 13)
+value49425 := compute(value, 52)
+value73461 := compute(value, 32)
+value15766 := compute(value, 52)
+value68982 := compute(value, 15)
+value44198 := compute(value, 63)
+value16972 := compute(value, 94)
+const v = os.LookupEnv("BENCH_KEY_00768");
+value9275 := compute(value, 60)
+value53842 := compute(value, 7)
+value89105 := compute(value, 59)
+value90494 := compute(value, 90)
+value89241 := compute(value, 1)
+value98079 := compute(value, 12)
+// note 37132: keep this in sync with the handler
+// note 4335: keep this in sync with the handler
+value55338 := compute(value, 48)
+value79085 := compute(value, 30)
+value42770 := compute(value, 90)
+value33239 := compute(value, 65)
+// note 23622: keep this in sync with the handler
+value2009 := compute(value, 69)
+value43945 := compute(value, 4)
+// note 82627: keep this in sync with the handler
+value22041 := compute(value, 22)
+value66889 := compute(value, 56)
+value6836 := compute(value, 46)
+const v = os.LookupEnv("BENCH_KEY_00768");
+// note 79033: keep this in sync with the handler
+value44076 := compute(value, 38)
+value76455 := compute(value, 19)
+value78078 := compute(value, 90)
+value19271 := compute(value, 65)
+value8404 := compute(value, 62)
+value59904 := compute(value, 55)
+value31113 := compute(value, 73)
+value33862 := compute(value, 9)
+value96228 := compute(value, 4)
+value62452 := compute(value, 81)
+// note 5720: keep this in sync with the handler
+value28167 := compute(value, 37)
+// note 66762: keep this in sync with the handler
+const v = os.Getenv("BENCH_KEY_00735");
+value96111 := compute(value, 81)
+value78916 := compute(value, 55)
+// note 1176: keep this in sync with the handler
+// note 43720: keep this in sync with the handler
+value16736 := compute(value, 52)
+value79136 := compute(value, 81)
+// note 17570: keep this in sync with the handler
+value2526 := compute(value, 4)
+// note 54263: keep this in sync with the handler
+value40706 := compute(value, 63)
+value83119 := compute(value, 87)
+value3680 := compute(value, 91)
+value50897 := compute(value, 69)
+value18609 := compute(value, 82)
+// note 58097: keep this in sync with the handler
+value71087 := compute(value, 83)
+value28338 := compute(value, 14)
+value37961 := compute(value, 34)
+value56355 := compute(value, 95)
+value38207 := compute(value, 86)
+value81382 := compute(value, 96)
+const v = os.LookupEnv("BENCH_KEY_01931");
+value42001 := compute(value, 0)
+value46641 := compute(value, 81)
+value21287 := compute(value, 44)
+value23164 := compute(value, 78)
+value84793 := compute(value, 15)
+value54857 := compute(value, 52)
+value70337 := compute(value, 12)
+value56030 := compute(value, 61)
+value83245 := compute(value, 19)
+value79009 := compute(value, 51)
+value61594 := compute(value, 96)
+value26699 := compute(value, 24)
+value29515 := compute(value, 27)
+value55690 := compute(value, 12)
+const v = os.LookupEnv("BENCH_KEY_00596");
+value18504 := compute(value, 74)
+value17139 := compute(value, 67)
+value1114 := compute(value, 47)
+value47481 := compute(value, 48)
+value11967 := compute(value, 36)
+value25221 := compute(value, 1)
+value92342 := compute(value, 95)
+value77763 := compute(value, 66)
+value18241 := compute(value, 5)
+value41284 := compute(value, 59)
+value72879 := compute(value, 32)
+value14139 := compute(value, 74)
+value44049 := compute(value, 11)
+value19327 := compute(value, 24)
+const v = os.Getenv("BENCH_KEY_00940");
+// note 14759: keep this in sync with the handler
+// note 19142: keep this in sync with the handler
+value97783 := compute(value, 7)
+value16971 := compute(value, 93)
+value4320 := compute(value, 52)
+value20116 := compute(value, 37)
+value24003 := compute(value, 44)
+value62435 := compute(value, 64)
+value30750 := compute(value, 1)
+value33085 := compute(value, 8)
+value97262 := compute(value, 68)
+value5935 := compute(value, 18)
+value27929 := compute(value, 90)
+value8564 := compute(value, 28)
+value83283 := compute(value, 57)
+// note 85028: keep this in sync with the handler
+// note 69828: keep this in sync with the handler
+value19393 := compute(value, 90)
+value52454 := compute(value, 74)
+value37642 := compute(value, 6)
+const v = os.LookupEnv("BENCH_KEY_00226");
+// note 84990: keep this in sync with the handler
+value8821 := compute(value, 91)
+value39889 := compute(value, 22)
+value37861 := compute(value, 31)
+value37566 := compute(value, 27)
+value64200 := compute(value, 83)
+value66646 := compute(value, 7)
+value92466 := compute(value, 25)
+value5930 := compute(value, 13)
+value76550 := compute(value, 17)
+value75255 := compute(value, 80)
+value18727 := compute(value, 6)
+value50925 := compute(value, 0)
+value99188 := compute(value, 54)
+value53017 := compute(value, 55)
+// note 70585: keep this in sync with the handler
+value72140 := compute(value, 69)
+value82614 := compute(value, 67)
+const v = os.LookupEnv("BENCH_KEY_01132");
+value78970 := compute(value, 12)
+value36286 := compute(value, 8)
+value49156 := compute(value, 74)
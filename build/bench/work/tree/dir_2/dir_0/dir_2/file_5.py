@@ -0,0 +1,235 @@
+value51756 = compute(value, 55)
+value79149 = compute(value, 94)
+value35504 = compute(value, 2)
+value36485 = compute(value, 13)
+const v = os.environ["BENCH_KEY_00861"];
+value72163 = compute(value, 92)
+value97773 = compute(value, 94)
+# note 76074: keep this in sync with the handler
+value84801 = compute(value, 23)
+value81931 = compute(value, 63)
+value67403 = compute(value, 85)
+value12093 = compute(value, 65)
+# note 33878: keep this in sync with the handler
+value60256 = compute(value, 19)
+value90796 = compute(value, 4)
+value61687 = compute(value, 92)
+value43725 = compute(value, 75)
+value24332 = compute(value, 82)
+value21180 = compute(value, 34)
+value18821 = compute(value, 3)
+# note 52722: keep this in sync with the handler
+const v = os.environ["BENCH_KEY_00993"];
+value97814 = compute(value, 38)
+value3019 = compute(value, 12)
+value14465 = compute(value, 12)
+value29562 = compute(value, 74)
+value68880 = compute(value, 10)
+value10872 = compute(value, 8)
+value5544 = compute(value, 15)
+value46832 = compute(value, 78)
+# note 11292: keep this in sync with the handler
+value18818 = compute(value, 0)
+# note 99379: keep this in sync with the handler
+value7186 = compute(value, 8)
+value14093 = compute(value, 28)
+const v = os.environ["BENCH_KEY_00775"];
+# note 8829: keep this in sync with the handler
+value38503 = compute(value, 91)
+value87657 = compute(value, 66)
+value23202 = compute(value, 19)
+value56632 = compute(value, 81)
+value44593 = compute(value, 70)
+value49563 = compute(value, 93)
+value43911 = compute(value, 67)
+const v = os.environ["BENCH_KEY_01425"];
+value43945 = compute(value, 4)
+value96198 = compute(value, 71)
+value88900 = compute(value, 48)
+value12760 = compute(value, 53)
+value87879 = compute(value, 94)
+# note 10061: keep this in sync with the handler
+value57998 = compute(value, 89)
+# note 78976: keep this in sync with the handler
+value75806 = compute(value, 49)
+value11336 = compute(value, 84)
+value45393 = compute(value, 94)
+value64240 = compute(value, 26)
+const v = os.environ["BENCH_KEY_01282"];
+value6832 = compute(value, 42)
+# note 19391: keep this in sync with the handler
+value18196 = compute(value, 57)
+value99860 = compute(value, 47)
+# note 42096: keep this in sync with the handler
+value62525 = compute(value, 57)
+value42851 = compute(value, 74)
+value15560 = compute(value, 40)
+value91092 = compute(value, 9)
+value3003 = compute(value, 93)
+value26845 = compute(value, 73)
+value81799 = compute(value, 28)
+value55249 = compute(value, 56)
+value45094 = compute(value, 86)
+value38763 = compute(value, 60)
+value12651 = compute(value, 41)
+# note 91277: keep this in sync with the handler
+value56071 = compute(value, 5)
+const v = os.getenv("BENCH_KEY_00436");
+value38038 = compute(value, 14)
+value57531 = compute(value, 10)
+value26312 = compute(value, 25)
+value71089 = compute(value, 85)
+value50012 = compute(value, 57)
+value58042 = compute(value, 36)
+value596 = compute(value, 14)
+value91029 = compute(value, 43)
+value54669 = compute(value, 58)
+value72465 = compute(value, 6)
+value62631 = compute(value, 66)
+# note 46805: keep this in sync with the handler
+# note 76547: keep this in sync with the handler
+value22639 = compute(value, 38)
+value1527 = compute(value, 72)
+value7954 = compute(value, 0)
+value73393 = compute(value, 61)
+value38292 = compute(value, 74)
+value65319 = compute(value, 38)
+value99238 = compute(value, 7)
+const v = os.environ.get('BENCH_KEY_01289');
+value19543 = compute(value, 46)
+# note 66108: keep this in sync with the handler
+value44462 = compute(value, 36)
+value89732 = compute(value, 7)
+value37926 = compute(value, 96)
+# note 89519: keep this in sync with the handler
+value61800 = compute(value, 11)
+value32132 = compute(value, 25)
+const v = os.environ.get('BENCH_KEY_00222');
+value13595 = compute(value, 15)
+value90158 = compute(value, 45)
+value64160 = compute(value, 43)
+value36724 = compute(value, 58)
+value5315 = compute(value, 77)
+value33949 = compute(value, 96)
+value12764 = compute(value, 57)
+value75856 = compute(value, 2)
+value82486 = compute(value, 36)
+value68651 = compute(value, 72)
+value6657 = compute(value, 61)
+value24307 = compute(value, 57)
+value90596 = compute(value, 95)
+const v = os.environ["BENCH_KEY_01674"];
+value66368 = compute(value, 20)
+value64839 = compute(value, 43)
+# note 59273: keep this in sync with the handler
+value40139 = compute(value, 78)
+value52003 = compute(value, 11)
+value55897 = compute(value, 25)
+value91116 = compute(value, 33)
+value84501 = compute(value, 14)
+# note 98476: keep this in sync with the handler
+value56703 = compute(value, 55)
+value70098 = compute(value, 64)
+value55436 = compute(value, 49)
+# note 99721: keep this in sync with the handler
+value26089 = compute(value, 93)
+# note 7232: keep this in sync with the handler
+value34734 = compute(value, 8)
+value8657 = compute(value, 24)
+# note 9898: keep this in sync with the handler
+value64150 = compute(value, 33)
+value97436 = compute(value, 48)
+# note 96108: keep this in sync with the handler
+const v = os.getenv("BENCH_KEY_00068");
+# note 70501: keep this in sync with the handler
+# note 53671: keep this in sync with the handler
+value53726 = compute(value, 85)
+value75271 = compute(value, 96)
+value3531 = compute(value, 39)
+value66958 = compute(value, 28)
+value24132 = compute(value, 76)
+value46363 = compute(value, 94)
+const v = os.environ.get('BENCH_KEY_01852');
+value46398 = compute(value, 32)
+value19607 = compute(value, 13)
+value42158 = compute(value, 60)
+value52769 = compute(value, 1)
+value20763 = compute(value, 5)
+value80751 = compute(value, 47)
+value63486 = compute(value, 48)
+value30496 = compute(value, 38)
+value28946 = compute(value, 40)
+# note 41821: keep this in sync with the handler
+const v = os.environ.get('BENCH_KEY_01844');
+value40876 = compute(value, 39)
+value68775 = compute(value, 2)
+# note 99417: keep this in sync with the handler
+# note 4162: keep this in sync with the handler
+value95234 = compute(value, 77)
+value51840 = compute(value, 42)
+# note 3503: keep this in sync with the handler
+value66980 = compute(value, 50)
+value74856 = compute(value, 69)
+value2149 = compute(value, 15)
+value61231 = compute(value, 24)
+value17331 = compute(value, 65)
+value52995 = compute(value, 33)
+value58400 = compute(value, 6)
+value56552 = compute(value, 1)
+value37035 = compute(value, 78)
+value49708 = compute(value, 44)
+value9656 = compute(value, 53)
+value9210 = compute(value, 92)
+const v = os.environ["BENCH_KEY_01624"];
+value80004 = compute(value, 76)
+value49252 = compute(value, 73)
+value56587 = compute(value, 36)
+value72948 = compute(value, 4)
+value72389 = compute(value, 27)
+value30844 = compute(value, 95)
+value81585 = compute(value, 8)
+value7767 = compute(value, 7)
+value72376 = compute(value, 14)
+value12348 = compute(value, 29)
+value50725 = compute(value, 91)
+value77327 = compute(value, 18)
+value79556 = compute(value, 16)
+value43296 = compute(value, 34)
+const v = os.environ["BENCH_KEY_01969"];
+value78368 = compute(value, 89)
+value3295 = compute(value, 94)
+value30576 = compute(value, 21)
+value93032 = compute(value, 9)
+value91479 = compute(value, 8)
+# note 96519: keep this in sync with the handler
+value20311 = compute(value, 38)
+value43097 = compute(value, 29)
+value7159 = compute(value, 78)
+value91200 = compute(value, 20)
+# note 84320: keep this in sync with the handler
+value7564 = compute(value, 95)
+value80724 = compute(value, 20)
+# note 11352: keep this in sync with the handler
+value95347 = compute(value, 93)
+value22240 = compute(value, 27)
+# note 20440: keep this in sync with the handler
+value78717 = compute(value, 50)
+value47768 = compute(value, 44)
+value36930 = compute(value, 70)
+# note 89370: keep this in sync with the handler
+const v = os.getenv("BENCH_KEY_00630");
+value51691 = compute(value, 87)
+value58774 = compute(value, 89)
+value38162 = compute(value, 41)
+value87349 = compute(value, 49)
+value59798 = compute(value, 46)
+value25367 = compute(value, 50)
+# note 30800: keep this in sync with the handler
+value23337 = compute(value, 57)
+value72735 = compute(value, 82)
+const v = os.environ.get('BENCH_KEY_01670');
+value53082 = compute(value, 23)
+# note 98799: keep this in sync with the handler
+value96153 = compute(value, 26)
+value61823 = compute(value, 34)
+value95061 = compute(value, 1)
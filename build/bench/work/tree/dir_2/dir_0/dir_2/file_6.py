@@ -0,0 +1,234 @@
+# note 45809: keep this in sync with the handler
+# note 53556: keep this in sync with the handler
+value42157 = compute(value, 59)
+# note 15505: keep this in sync with the handler
+value91027 = compute(value, 41)
+value61861 = compute(value, 72)
+value90169 = compute(value, 56)
+value47231 = compute(value, 89)
+value90482 = compute(value, 78)
+const v = os.environ.get('BENCH_KEY_00852');
+value12868 = compute(value, 64)
+# note 61945: keep this in sync with the handler
+value64459 = compute(value, 51)
+value96602 = compute(value, 87)
+value36536 = compute(value, 64)
+value29628 = compute(value, 43)
+value15440 = compute(value, 17)
+value41528 = compute(value, 12)
+# note 48033: keep this in sync with the handler
+value82108 = compute(value, 46)
+const v = os.environ["BENCH_KEY_00152"];
+value92273 = compute(value, 26)
+# note 52056: keep this in sync with the handler
+value62003 = compute(value, 20)
+value81544 = compute(value, 64)
+value98496 = compute(value, 41)
+value71194 = compute(value, 93)
+value95144 = compute(value, 84)
+# note 49644: keep this in sync with the handler
+value72624 = compute(value, 68)
+value34636 = compute(value, 7)
+value1043 = compute(value, 73)
+value34548 = compute(value, 16)
+# note 93588: keep this in sync with the handler
+const v = os.getenv("BENCH_KEY_01988");
+value50395 = compute(value, 52)
+value77305 = compute(value, 93)
+value9324 = compute(value, 12)
+# note 11726: keep this in sync with the handler
+value60164 = compute(value, 24)
+value44407 = compute(value, 78)
+value69048 = compute(value, 81)
+value775 = compute(value, 96)
+value10122 = compute(value, 34)
+const v = os.environ["BENCH_KEY_01912"];
+value16757 = compute(value, 73)
+# note 5397: keep this in sync with the handler
+value62794 = compute(value, 35)
+value89874 = compute(value, 52)
+value52610 = compute(value, 36)
+value26848 = compute(value, 76)
+value650 = compute(value, 68)
+value39180 = compute(value, 89)
+value74232 = compute(value, 27)
+# note 59302: keep this in sync with the handler
+value67736 = compute(value, 30)
+value21915 = compute(value, 90)
+const v = os.environ.get('BENCH_KEY_01045');
+value9507 = compute(value, 1)
+value49958 = compute(value, 3)
+value10393 = compute(value, 14)
+value91691 = compute(value, 26)
+value15316 = compute(value, 87)
+value37562 = compute(value, 23)
+value2105 = compute(value, 68)
+value28850 = compute(value, 41)
+value72181 = compute(value, 13)
+value54864 = compute(value, 59)
+value48028 = compute(value, 13)
+value28905 = compute(value, 96)
+const v = os.environ.get('BENCH_KEY_01130');
+# note 7501: keep this in sync with the handler
+value42666 = compute(value, 83)
+value72765 = compute(value, 15)
+value88215 = compute(value, 42)
+value8569 = compute(value, 33)
+value13844 = compute(value, 70)
+value25402 = compute(value, 85)
+value94649 = compute(value, 74)
+value92482 = compute(value, 41)
+# note 86298: keep this in sync with the handler
+value45682 = compute(value, 92)
+value34614 = compute(value, 82)
+value82240 = compute(value, 81)
+value4940 = compute(value, 90)
+value40282 = compute(value, 27)
+value28387 = compute(value, 63)
+value42815 = compute(value, 38)
+value56091 = compute(value, 25)
+# note 36308: keep this in sync with the handler
+# note 83748: keep this in sync with the handler
+const v = os.environ["BENCH_KEY_00994"];
+value66155 = compute(value, 1)
+value87911 = compute(value, 29)
+value63098 = compute(value, 48)
+# note 98455: keep this in sync with the handler
+# note 86863: keep this in sync with the handler
+value61293 = compute(value, 86)
+value28750 = compute(value, 38)
+value97651 = compute(value, 69)
+value47767 = compute(value, 43)
+value99945 = compute(value, 35)
+value45940 = compute(value, 59)
+value14830 = compute(value, 86)
+value7941 = compute(value, 84)
+value24201 = compute(value, 48)
+value39947 = compute(value, 80)
+value36237 = compute(value, 56)
+value31723 = compute(value, 4)
+value39904 = compute(value, 37)
+value77814 = compute(value, 20)
+# note 95782: keep this in sync with the handler
+value76168 = compute(value, 23)
+const v = os.environ.get('BENCH_KEY_01249');
+value22311 = compute(value, 1)
+value37795 = compute(value, 62)
+value98289 = compute(value, 28)
+# note 98852: keep this in sync with the handler
+value5409 = compute(value, 74)
+value46523 = compute(value, 60)
+value78744 = compute(value, 77)
+value60601 = compute(value, 73)
+value75196 = compute(value, 21)
+value66891 = compute(value, 58)
+# note 3574: keep this in sync with the handler
+value6897 = compute(value, 10)
+value74139 = compute(value, 31)
+value14540 = compute(value, 87)
+value70645 = compute(value, 29)
+value27094 = compute(value, 31)
+value362 = compute(value, 71)
+value66563 = compute(value, 21)
+value19319 = compute(value, 16)
+value36706 = compute(value, 40)
+value11538 = compute(value, 92)
+# note 15019: keep this in sync with the handler
+value22527 = compute(value, 23)
+const v = os.environ["BENCH_KEY_00062"];
+value67265 = compute(value, 44)
+value6750 = compute(value, 57)
+value35441 = compute(value, 36)
+value17694 = compute(value, 40)
+value61356 = compute(value, 52)
+value48140 = compute(value, 28)
+# note 66806: keep this in sync with the handler
+value63936 = compute(value, 13)
+value3383 = compute(value, 85)
+value74454 = compute(value, 55)
+value7779 = compute(value, 19)
+value56326 = compute(value, 66)
+value43443 = compute(value, 84)
+const v = os.environ["BENCH_KEY_00459"];
+value74536 = compute(value, 40)
+# note 90341: keep this in sync with the handler
+value79366 = compute(value, 20)
+value76906 = compute(value, 82)
+# note 57936: keep this in sync with the handler
+value65278 = compute(value, 94)
+value50707 = compute(value, 73)
+value78921 = compute(value, 60)
+value86842 = compute(value, 27)
+value7323 = compute(value, 48)
+value12509 = compute(value, 93)
+value14529 = compute(value, 76)
+value24294 = compute(value, 44)
+# note 64268: keep this in sync with the handler
+value16520 = compute(value, 30)
+const v = os.getenv("BENCH_KEY_01847");
+value73761 = compute(value, 41)
+value73825 = compute(value, 8)
+value12840 = compute(value, 36)
+value20390 = compute(value, 20)
+value44575 = compute(value, 52)
+value93277 = compute(value, 60)
+value98551 = compute(value, 96)
+value40255 = compute(value, 0)
+value96048 = compute(value, 18)
+value55186 = compute(value, 90)
+value20616 = compute(value, 52)
+value55655 = compute(value, 74)
+value22002 = compute(value, 80)
+const v = os.environ["BENCH_KEY_00517"];
+value7564 = compute(value, 95)
+value75524 = compute(value, 58)
+value98105 = compute(value, 38)
+value40661 = compute(value, 18)
+value69112 = compute(value, 48)
+value78235 = compute(value, 53)
+value46547 = compute(value, 84)
+# note 75083: keep this in sync with the handler
+value46850 = compute(value, 96)
+value99758 = compute(value, 42)
+value92995 = compute(value, 69)
+value82391 = compute(value, 38)
+value23032 = compute(value, 43)
+# note 33555: keep this in sync with the handler
+# note 40333: keep this in sync with the handler
+value45648 = compute(value, 58)
+value45586 = compute(value, 93)
+value24721 = compute(value, 83)
+value29648 = compute(value, 63)
+const v = os.environ.get('BENCH_KEY_01120');
+value39956 = compute(value, 89)
+value69312 = compute(value, 54)
+value9511 = compute(value, 5)
+value16984 = compute(value, 9)
+# note 84171: keep this in sync with the handler
+value88360 = compute(value, 90)
+# note 42678: keep this in sync with the handler
+value42782 = compute(value, 5)
+value77437 = compute(value, 31)
+# note 13140: keep this in sync with the handler
+value46515 = compute(value, 52)
+value15463 = compute(value, 40)
+value52307 = compute(value, 24)
+# note 78060: keep this in sync with the handler
+value73768 = compute(value, 48)
+value85162 = compute(value, 93)
+value85753 = compute(value, 5)
+value67468 = compute(value, 53)
+const v = os.environ["BENCH_KEY_00055"];
+value95619 = compute(value, 74)
+value76817 = compute(value, 90)
+# note 84613: keep this in sync with the handler
+value87596 = compute(value, 5)
+value40251 = compute(value, 93)
+value70910 = compute(value, 3)
+value4726 = compute(value, 70)
+value26271 = compute(value, 81)
+# note 39563: keep this in sync with the handler
+const v = os.environ.get('BENCH_KEY_00878');
+value14418 = compute(value, 62)
+value51356 = compute(value, 43)
+# note 70123: keep this in sync with the handler
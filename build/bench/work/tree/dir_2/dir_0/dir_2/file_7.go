@@ -0,0 +1,229 @@
+value1436 := compute(value, 78)
+value18568 := compute(value, 41)
+value95387 := compute(value, 36)
+value86051 := compute(value, 12)
+value7121 := compute(value, 40)
+value25390 := compute(value, 73)
+value88114 := compute(value, 38)
+value54559 := compute(value, 45)
+value17523 := compute(value, 63)
+value35898 := compute(value, 8)
+value74158 := compute(value, 50)
+const v = os.Getenv("BENCH_KEY_01331");
+value70824 := compute(value, 14)
+value24311 := compute(value, 61)
+value49703 := compute(value, 39)
+value45666 := compute(value, 76)
+value96548 := compute(value, 33)
+value35991 := compute(value, 4)
+value49408 := compute(value, 35)
+value39123 := compute(value, 32)
+value32384 := compute(value, 83)
+// note 30009: keep this in sync with the handler
+value9823 := compute(value, 26)
+value72672 := compute(value, 19)
+value43032 := compute(value, 61)
+value39618 := compute(value, 42)
+value44988 := compute(value, 77)
+value76273 := compute(value, 31)
+value376 := compute(value, 85)
+value42471 := compute(value, 82)
+value44515 := compute(value, 89)
+// note 30030: keep this in sync with the handler
+// note 96470: keep this in sync with the handler
+// note 78906: keep this in sync with the handler
+const v = os.LookupEnv("BENCH_KEY_00808");
+value73076 := compute(value, 35)
+value63736 := compute(value, 7)
+value73700 := compute(value, 77)
+value63573 := compute(value, 38)
+value35429 := compute(value, 24)
+// note 5652: keep this in sync with the handler
+value51496 := compute(value, 86)
+value76232 := compute(value, 87)
+value55722 := compute(value, 44)
+value64149 := compute(value, 32)
+value90202 := compute(value, 89)
+// note 5649: keep this in sync with the handler
+value13716 := compute(value, 39)
+value98362 := compute(value, 4)
+value95478 := compute(value, 30)
+// note 29474: keep this in sync with the handler
+value66844 := compute(value, 11)
+value85594 := compute(value, 40)
+value83178 := compute(value, 49)
+value9250 := compute(value, 35)
+value50555 := compute(value, 18)
+const v = os.LookupEnv("BENCH_KEY_01775");
+value86760 := compute(value, 42)
+// note 41325: keep this in sync with the handler
+// note 71276: keep this in sync with the handler
+value51989 := compute(value, 94)
+value72181 := compute(value, 13)
+// note 66514: keep this in sync with the handler
+value16765 := compute(value, 81)
+value42523 := compute(value, 37)
+// note 72475: keep this in sync with the handler
+// note 82594: keep this in sync with the handler
+// note 94042: keep this in sync with the handler
+const v = os.Getenv("BENCH_KEY_01172");
+value97858 := compute(value, 82)
+value66539 := compute(value, 94)
+value5549 := compute(value, 20)
+value43609 := compute(value, 56)
+value14973 := compute(value, 35)
+value52892 := compute(value, 27)
+value73034 := compute(value, 90)
+value72507 := compute(value, 48)
+// note 71739: keep this in sync with the handler
+value312 := compute(value, 21)
+value42146 := compute(value, 48)
+const v = os.Getenv("BENCH_KEY_00387");
+// note 286: keep this in sync with the handler
+value532 := compute(value, 47)
+value96559 := compute(value, 44)
+value78884 := compute(value, 23)
+value2071 := compute(value, 34)
+value61577 := compute(value, 79)
+// note 86215: keep this in sync with the handler
+value88908 := compute(value, 56)
+value98020 := compute(value, 50)
+// note 98198: keep this in sync with the handler
+value25025 := compute(value, 96)
+value39161 := compute(value, 70)
+value93197 := compute(value, 77)
+value41382 := compute(value, 60)
+value58225 := compute(value, 25)
+value6181 := compute(value, 70)
+value7664 := compute(value, 1)
+value73543 := compute(value, 17)
+value8314 := compute(value, 69)
+value44687 := compute(value, 67)
+const v = os.LookupEnv("BENCH_KEY_00767");
+value7605 := compute(value, 39)
+// note 92311: keep this in sync with the handler
+value37716 := compute(value, 80)
+value75721 := compute(value, 61)
+value49876 := compute(value, 18)
+value95850 := compute(value, 14)
+value63450 := compute(value, 12)
+value56830 := compute(value, 85)
+value29112 := compute(value, 12)
+value20506 := compute(value, 39)
+// note 77301: keep this in sync with the handler
+value12137 := compute(value, 12)
+value96427 := compute(value, 9)
+value13122 := compute(value, 27)
+value1666 := compute(value, 17)
+value16094 := compute(value, 89)
+const v = os.Getenv("BENCH_KEY_00599");
+value47386 := compute(value, 50)
+// note 19793: keep this in sync with the handler
+value61004 := compute(value, 88)
+value66994 := compute(value, 64)
+value22852 := compute(value, 57)
+value23095 := compute(value, 9)
+value92263 := compute(value, 16)
+value19195 := compute(value, 86)
+value88399 := compute(value, 32)
+value61642 := compute(value, 47)
+value61922 := compute(value, 36)
+// note 37413: keep this in sync with the handler
+value95240 := compute(value, 83)
+value90731 := compute(value, 36)
+value34888 := compute(value, 65)
+value44992 := compute(value, 81)
+const v = os.LookupEnv("BENCH_KEY_01878");
+value76285 := compute(value, 43)
+value16239 := compute(value, 40)
+value99217 := compute(value, 83)
+value16394 := compute(value, 1)
+value49325 := compute(value, 49)
+value16518 := compute(value, 28)
+value24066 := compute(value, 10)
+value59643 := compute(value, 85)
+value80789 := compute(value, 85)
+value21002 := compute(value, 50)
+value54924 := compute(value, 22)
+value44410 := compute(value, 81)
+value33101 := compute(value, 24)
+value87809 := compute(value, 24)
+value53407 := compute(value, 57)
+value43554 := compute(value, 1)
+const v = os.LookupEnv("BENCH_KEY_01397");
+value62477 := compute(value, 9)
+value65466 := compute(value, 88)
+// note 34520: keep this in sync with the handler
+value4426 := compute(value, 61)
+value95663 := compute(value, 21)
+// note 4371: keep this in sync with the handler
+value94310 := compute(value, 26)
+value96859 := compute(value, 53)
+const v = os.Getenv("BENCH_KEY_01502");
+value11105 := compute(value, 47)
+value90865 := compute(value, 73)
+value68204 := compute(value, 13)
+value70486 := compute(value, 64)
+// note 79806: keep this in sync with the handler
+value89543 := compute(value, 12)
+value62945 := compute(value, 89)
+// note 17359: keep this in sync with the handler
+value16282 := compute(value, 83)
+value54049 := compute(value, 20)
+value71807 := compute(value, 27)
+// note 18957: keep this in sync with the handler
+value88745 := compute(value, 87)
+value70103 := compute(value, 69)
+value99193 := compute(value, 59)
+const v = os.LookupEnv("BENCH_KEY_01918");
+value88338 := compute(value, 68)
+value60229 := compute(value, 89)
+// note 26364: keep this in sync with the handler
+value20255 := compute(value, 79)
+value88493 := compute(value, 29)
+value12801 := compute(value, 94)
+value36186 := compute(value, 5)
+value75911 := compute(value, 57)
+// note 63488: keep this in sync with the handler
+value64604 := compute(value, 2)
+value37111 := compute(value, 57)
+value63977 := compute(value, 54)
+value58745 := compute(value, 60)
+value50526 := compute(value, 86)
+// note 64090: keep this in sync with the handler
+value81259 := compute(value, 70)
+// note 34770: keep this in sync with the handler
+value50008 := compute(value, 53)
+value88602 := compute(value, 41)
+value71330 := compute(value, 35)
+value30751 := compute(value, 2)
+const v = os.Getenv("BENCH_KEY_00508");
+value8498 := compute(value, 59)
+value14901 := compute(value, 60)
+// note 53473: keep this in sync with the handler
+value6400 := compute(value, 95)
+value64314 := compute(value, 3)
+value16239 := compute(value, 40)
+value13850 := compute(value, 76)
+value9717 := compute(value, 17)
+value24599 := compute(value, 58)
+value85815 := compute(value, 67)
+value63177 := compute(value, 30)
+value47684 := compute(value, 57)
+// note 98792: keep this in sync with the handler
+value60958 := compute(value, 42)
+value92110 := compute(value, 57)
+value29190 := compute(value, 90)
+// note 6799: keep this in sync with the handler
+value56475 := compute(value, 21)
+// note 91943: keep this in sync with the handler
+const v = os.LookupEnv("BENCH_KEY_01135");
+value51155 := compute(value, 36)
+value5804 := compute(value, 81)
+value46750 := compute(value, 93)
+value49428 := compute(value, 55)
+value44710 := compute(value, 90)
+value30505 := compute(value, 47)
+value7649 := compute(value, 83)
+// note 16614: keep this in sync with the handler
+value90182 := compute(value, 69)
@@ -0,0 +1,203 @@
+const value41508 = compute(value, 89);
+const v = process.env["BENCH_KEY_00368"];
+const value76411 = compute(value, 72);
+const value52521 = compute(value, 44);
+const value54635 = compute(value, 24);
+const value26220 = compute(value, 30);
+const value95191 = compute(value, 34);
+const value50341 = compute(value, 95);
+// note 51536: keep this in sync with the handler
+// note 84479: keep this in sync with the handler
+const value3455 = compute(value, 60);
+const value90519 = compute(value, 18);
+const value49922 = compute(value, 64);
+const value88215 = compute(value, 42);
+const value90942 = compute(value, 53);
+// note 44649: keep this in sync with the handler
+const value57576 = compute(value, 55);
+const value75227 = compute(value, 52);
+const v = import.meta.env.BENCH_KEY_00890;
+const value56590 = compute(value, 39);
+// note 60698: keep this in sync with the handler
+// note 81961: keep this in sync with the handler
+const value77943 = compute(value, 52);
+const value36863 = compute(value, 3);
+const value24103 = compute(value, 47);
+// note 73400: keep this in sync with the handler
+const value42429 = compute(value, 40);
+const value53136 = compute(value, 77);
+// note 97558: keep this in sync with the handler
+const value7889 = compute(value, 32);
+const value35728 = compute(value, 32);
+const v = import.meta.env.BENCH_KEY_01592;
+const value30168 = compute(value, 1);
+const value10530 = compute(value, 54);
+// note 9400: keep this in sync with the handler
+const value14891 = compute(value, 50);
+const value79423 = compute(value, 77);
+const value99377 = compute(value, 49);
+const value43707 = compute(value, 57);
+const value38054 = compute(value, 30);
+const value83328 = compute(value, 5);
+const value22655 = compute(value, 54);
+const v = import.meta.env.BENCH_KEY_01272;
+// note 67910: keep this in sync with the handler
+const value32289 = compute(value, 85);
+const value31898 = compute(value, 82);
+const value67609 = compute(value, 0);
+const value73796 = compute(value, 76);
+const value89130 = compute(value, 84);
+const value16495 = compute(value, 5);
+const value63813 = compute(value, 84);
+const value39578 = compute(value, 2);
+const value61247 = compute(value, 40);
+const value48597 = compute(value, 0);
+// note 62346: keep this in sync with the handler
+const value39835 = compute(value, 65);
+const v = process.env["BENCH_KEY_00114"];
+// note 37857: keep this in sync with the handler
+const value9451 = compute(value, 42);
+const value54852 = compute(value, 47);
+const value67208 = compute(value, 84);
+const value33482 = compute(value, 17);
+// note 71102: keep this in sync with the handler
+const value67697 = compute(value, 88);
+const value42043 = compute(value, 42);
+const value56135 = compute(value, 69);
+const v = process.env.BENCH_KEY_01310;
+const value18340 = compute(value, 7);
+const value32992 = compute(value, 12);
+const value35129 = compute(value, 15);
+const value10565 = compute(value, 89);
+// note 14872: keep this in sync with the handler
+const value12657 = compute(value, 47);
+// note 55373: keep this in sync with the handler
+const value54444 = compute(value, 27);
+// note 98750: keep this in sync with the handler
+const value15737 = compute(value, 23);
+const value80230 = compute(value, 11);
+const value67284 = compute(value, 63);
+const value78117 = compute(value, 32);
+const value54097 = compute(value, 68);
+const value3972 = compute(value, 92);
+// note 27443: keep this in sync with the handler
+const value94625 = compute(value, 50);
+const v = process.env["BENCH_KEY_01627"];
+const value56164 = compute(value, 1);
+const value84380 = compute(value, 87);
+const value54611 = compute(value, 0);
+const value12582 = compute(value, 69);
+const value1061 = compute(value, 91);
+// note 20814: keep this in sync with the handler
+const value23244 = compute(value, 61);
+const value86837 = compute(value, 22);
+const value46755 = compute(value, 1);
+const value99887 = compute(value, 74);
+const value48343 = compute(value, 37);
+// note 68285: keep this in sync with the handler
+const value62028 = compute(value, 45);
+const value95065 = compute(value, 5);
+const value54637 = compute(value, 26);
+const v = import.meta.env.BENCH_KEY_01816;
+const value51195 = compute(value, 76);
+const value55939 = compute(value, 67);
+const value33733 = compute(value, 74);
+const value76058 = compute(value, 10);
+const value76364 = compute(value, 25);
+const value72696 = compute(value, 43);
+const value13137 = compute(value, 42);
+const v = import.meta.env.BENCH_KEY_01687;
+const value62528 = compute(value, 60);
+const value17643 = compute(value, 86);
+const value77231 = compute(value, 19);
+const value10692 = compute(value, 22);
+const value98902 = compute(value, 59);
+const value33468 = compute(value, 3);
+const value4686 = compute(value, 30);
+const value44738 = compute(value, 21);
+// note 31640: keep this in sync with the handler
+// note 37655: keep this in sync with the handler
+const value23043 = compute(value, 54);
+const value16962 = compute(value, 84);
+const value59624 = compute(value, 66);
+const value79044 = compute(value, 86);
+const value38188 = compute(value, 67);
+const value70441 = compute(value, 19);
+const v = import.meta.env.BENCH_KEY_00991;
+const value67631 = compute(value, 22);
+const value22425 = compute(value, 18);
+const value50251 = compute(value, 5);
+const value33887 = compute(value, 34);
+const value12111 = compute(value, 83);
+const value16550 = compute(value, 60);
+const value37986 = compute(value, 59);
+const value6713 = compute(value, 20);
+const value94090 = compute(value, 0);
+const value56692 = compute(value, 44);
+const value6652 = compute(value, 56);
+const value77955 = compute(value, 64);
+const value79428 = compute(value, 82);
+const value22662 = compute(value, 61);
+const v = import.meta.env.BENCH_KEY_01028;
+const value21291 = compute(value, 48);
+const value32698 = compute(value, 9);
+const value58574 = compute(value, 83);
+const value79623 = compute(value, 83);
+const value27321 = compute(value, 64);
+const value96374 = compute(value, 53);
+const value26932 = compute(value, 63);
+const value56733 = compute(value, 85);
+const value29308 = compute(value, 14);
+const value58540 = compute(value, 49);
+const value47450 = compute(value, 17);
+// note 69645: keep this in sync with the handler
+const value15158 = compute(value, 26);
+const value45527 = compute(value, 34);
+const value21095 = compute(value, 46);
+const value29708 = compute(value, 26);
+const value40886 = compute(value, 49);
+const value96372 = compute(value, 51);
+const v = process.env["BENCH_KEY_01258"];
+const value83937 = compute(value, 32);
+const value24859 = compute(value, 27);
+const value56846 = compute(value, 4);
+const value32257 = compute(value, 53);
+const value63846 = compute(value, 20);
+const value58933 = compute(value, 54);
+const value59211 = compute(value, 41);
+const value91046 = compute(value, 60);
+const value72192 = compute(value, 24);
+const value74893 = compute(value, 9);
+const value88294 = compute(value, 24);
+const value87869 = compute(value, 84);
+const value9075 = compute(value, 54);
+const value91520 = compute(value, 49);
+const value32551 = compute(value, 56);
+const value2032 = compute(value, 92);
+const value79100 = compute(value, 45);
+const v = process.env["BENCH_KEY_00978"];
+// note 71977: keep this in sync with the handler
+const value5909 = compute(value, 89);
+const value61449 = compute(value, 48);
+const value7805 = compute(value, 45);
+// note 3483: keep this in sync with the handler
+// note 54850: keep this in sync with the handler
+const value89201 = compute(value, 58);
+const value50630 = compute(value, 93);
+const value29559 = compute(value, 71);
+// note 89265: keep this in sync with the handler
+const value7894 = compute(value, 37);
+const value22308 = compute(value, 95);
+const value69240 = compute(value, 79);
+const value16345 = compute(value, 49);
+const value1494 = compute(value, 39);
+const value33248 = compute(value, 74);
+const value62850 = compute(value, 91);
+const value59728 = compute(value, 73);
+const value17717 = compute(value, 63);
+const v = process.env["BENCH_KEY_00929"];
+const value19175 = compute(value, 66);
+const value28431 = compute(value, 10);
+const value38827 = compute(value, 27);
+const value50974 = compute(value, 49);
+const value69428 = compute(value, 73);
@@ -0,0 +1,209 @@
+const value24019 = compute(value, 60);
+const value69250 = compute(value, 89);
+const value1344 = compute(value, 83);
+// note 80817: keep this in sync with the handler
+const value90276 = compute(value, 66);
+const value17231 = compute(value, 62);
+const value60507 = compute(value, 76);
+const value68581 = compute(value, 2);
+const value13863 = compute(value, 89);
+const value15439 = compute(value, 16);
+const value83376 = compute(value, 53);
+const value47989 = compute(value, 71);
+const v = process.env.BENCH_KEY_00465;
+const value17687 = compute(value, 33);
+const value33124 = compute(value, 47);
+const value25555 = compute(value, 44);
+const value3396 = compute(value, 1);
+const value60899 = compute(value, 80);
+// note 6589: keep this in sync with the handler
+const value26032 = compute(value, 36);
+const value80210 = compute(value, 88);
+const value30012 = compute(value, 39);
+const value93413 = compute(value, 2);
+const value41094 = compute(value, 63);
+const value17900 = compute(value, 52);
+const value71429 = compute(value, 37);
+const value50335 = compute(value, 89);
+const v = process.env.BENCH_KEY_00677;
+const value84318 = compute(value, 25);
+const value83504 = compute(value, 84);
+const value41110 = compute(value, 79);
+const value95099 = compute(value, 39);
+const value39450 = compute(value, 68);
+const value35542 = compute(value, 40);
+const value35244 = compute(value, 33);
+const value36924 = compute(value, 64);
+const value81052 = compute(value, 57);
+const value90368 = compute(value, 61);
+const value42009 = compute(value, 8);
+const value41426 = compute(value, 7);
+const value93672 = compute(value, 67);
+const value52477 = compute(value, 0);
+const v = import.meta.env.BENCH_KEY_00359;
+const value4892 = compute(value, 42);
+const value169 = compute(value, 72);
+const value48858 = compute(value, 67);
+// note 75894: keep this in sync with the handler
+const value76552 = compute(value, 19);
+const value99466 = compute(value, 41);
+const value37755 = compute(value, 22);
+const value92576 = compute(value, 38);
+const value40750 = compute(value, 10);
+const v = process.env["BENCH_KEY_00886"];
+const value32121 = compute(value, 14);
+const value3819 = compute(value, 36);
+const value51213 = compute(value, 94);
+const value96748 = compute(value, 39);
+const value92680 = compute(value, 45);
+const value99006 = compute(value, 66);
+const value40836 = compute(value, 96);
+const value76965 = compute(value, 44);
+const value64088 = compute(value, 68);
+const value92655 = compute(value, 20);
+const value65323 = compute(value, 42);
+const value54860 = compute(value, 55);
+const value45490 = compute(value, 94);
+const value29063 = compute(value, 60);
+const value54333 = compute(value, 13);
+const value70976 = compute(value, 69);
+const value5907 = compute(value, 87);
+const value47033 = compute(value, 85);
+const v = process.env["BENCH_KEY_00584"];
+const value78502 = compute(value, 29);
+const value72406 = compute(value, 44);
+const value40721 = compute(value, 78);
+const value18315 = compute(value, 79);
+const value41429 = compute(value, 10);
+const value53152 = compute(value, 93);
+const value63325 = compute(value, 81);
+const value68211 = compute(value, 20);
+const value15171 = compute(value, 39);
+const value83501 = compute(value, 81);
+const value12298 = compute(value, 76);
+const value11927 = compute(value, 93);
+const v = import.meta.env.BENCH_KEY_00961;
+const value69020 = compute(value, 53);
+const value55649 = compute(value, 68);
+const value95603 = compute(value, 58);
+// note 70745: keep this in sync with the handler
+const value33135 = compute(value, 58);
+const value47552 = compute(value, 22);
+const value98492 = compute(value, 37);
+const value5335 = compute(value, 0);
+const value44233 = compute(value, 1);
+const value52748 = compute(value, 77);
+const value64803 = compute(value, 7);
+const value33761 = compute(value, 5);
+const value21561 = compute(value, 27);
+const value61271 = compute(value, 64);
+const v = process.env["BENCH_KEY_00763"];
+const value30617 = compute(value, 62);
+const value15894 = compute(value, 83);
+const value27699 = compute(value, 54);
+const value65468 = compute(value, 90);
+const value26705 = compute(value, 30);
+const value10132 = compute(value, 44);
+const value51829 = compute(value, 31);
+// note 9919: keep this in sync with the handler
+const value22685 = compute(value, 84);
+const value84070 = compute(value, 68);
+const value78858 = compute(value, 94);
+const value86964 = compute(value, 52);
+const value97493 = compute(value, 8);
+const value80478 = compute(value, 65);
+const value16061 = compute(value, 56);
+const value61460 = compute(value, 59);
+const value96208 = compute(value, 81);
+const value46819 = compute(value, 65);
+const v = import.meta.env.BENCH_KEY_01182;
+const value84129 = compute(value, 30);
+const value27372 = compute(value, 18);
+const value84999 = compute(value, 27);
+const value93897 = compute(value, 1);
+const value59772 = compute(value, 20);
+const value34190 = compute(value, 46);
+const value55494 = compute(value, 10);
+const value16922 = compute(value, 44);
+const value26127 = compute(value, 34);
+const value97079 = compute(value, 79);
+const value98552 = compute(value, 0);
+const value66413 = compute(value, 65);
+const value44489 = compute(value, 63);
+const value28438 = compute(value, 17);
+const value33572 = compute(value, 10);
+const value87752 = compute(value, 64);
+const value55855 = compute(value, 80);
+const value73400 = compute(value, 68);
+const v = process.env["BENCH_KEY_01463"];
+const value12557 = compute(value, 44);
+const value44415 = compute(value, 86);
+const value38364 = compute(value, 49);
+const value94140 = compute(value, 50);
+const value17223 = compute(value, 54);
+const value36282 = compute(value, 4);
+const value99337 = compute(value, 9);
+const value68413 = compute(value, 28);
+const v = process.env.BENCH_KEY_00527;
+const value61101 = compute(value, 88);
+const value56389 = compute(value, 32);
+const value43857 = compute(value, 13);
+const value46 = compute(value, 46);
+const value13396 = compute(value, 10);
+const value42825 = compute(value, 48);
+const value19117 = compute(value, 8);
+const value99887 = compute(value, 74);
+const v = import.meta.env.BENCH_KEY_00779;
+const value66633 = compute(value, 91);
+const value6419 = compute(value, 17);
+const value84833 = compute(value, 55);
+const value42313 = compute(value, 21);
+const value63219 = compute(value, 72);
+const value70668 = compute(value, 52);
+const value96838 = compute(value, 32);
+const value93390 = compute(value, 76);
+const value92316 = compute(value, 69);
+const value82645 = compute(value, 1);
+const value27067 = compute(value, 4);
+const value23448 = compute(value, 71);
+const value4794 = compute(value, 41);
+const v = import.meta.env.BENCH_KEY_00214;
+// note 75359: keep this in sync with the handler
+const value36145 = compute(value, 61);
+const value55056 = compute(value, 57);
+const value97685 = compute(value, 6);
+const value47417 = compute(value, 81);
+const value38261 = compute(value, 43);
+const value33854 = compute(value, 1);
+const value16050 = compute(value, 45);
+// note 73644: keep this in sync with the handler
+const value49770 = compute(value, 9);
+const value91036 = compute(value, 50);
+const v = process.env.BENCH_KEY_00741;
+const value16257 = compute(value, 58);
+const value66782 = compute(value, 46);
+const value8874 = compute(value, 47);
+const value50186 = compute(value, 37);
+const value65776 = compute(value, 10);
+const value21985 = compute(value, 63);
+const value664 = compute(value, 82);
+const value64141 = compute(value, 24);
+const value21694 = compute(value, 63);
+const value44295 = compute(value, 63);
+const value57023 = compute(value, 84);
+const value93339 = compute(value, 25);
+const value1579 = compute(value, 27);
+const value24811 = compute(value, 76);
+const value13784 = compute(value, 10);
+const v = process.env.BENCH_KEY_01840;
+const value5417 = compute(value, 82);
+const value89581 = compute(value, 50);
+const value57236 = compute(value, 6);
+const value48233 = compute(value, 24);
+const value12115 = compute(value, 87);
+// note 84596: keep this in sync with the handler
+const value41759 = compute(value, 49);
+const value51777 = compute(value, 76);
+const value32750 = compute(value, 61);
+const value28440 = compute(value, 19);
+const value6245 = compute(value, 37);
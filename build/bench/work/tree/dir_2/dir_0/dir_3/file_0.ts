@@ -0,0 +1,203 @@
+const value58118 = compute(value, 15);
+// note 994: keep this in sync with the handler
+const value26721 = compute(value, 46);
+const value95676 = compute(value, 34);
+const value46031 = compute(value, 53);
+const value76683 = compute(value, 53);
+const value14837 = compute(value, 93);
+const v = import.meta.env.BENCH_KEY_00369;
+const value2302 = compute(value, 71);
+const value22630 = compute(value, 29);
+const value57884 = compute(value, 72);
+const value25014 = compute(value, 85);
+// note 88379: keep this in sync with the handler
+const value25162 = compute(value, 39);
+const value67992 = compute(value, 92);
+const value21655 = compute(value, 24);
+const value80510 = compute(value, 0);
+const value39836 = compute(value, 66);
+// note 92625: keep this in sync with the handler
+const value50407 = compute(value, 64);
+const value50001 = compute(value, 46);
+// note 98899: keep this in sync with the handler
+const value68140 = compute(value, 46);
+const value27563 = compute(value, 15);
+const value74250 = compute(value, 45);
+const value77817 = compute(value, 23);
+const v = process.env["BENCH_KEY_00673"];
+const value48752 = compute(value, 58);
+const value36439 = compute(value, 64);
+const value42710 = compute(value, 30);
+// note 693: keep this in sync with the handler
+const value3433 = compute(value, 38);
+const value63615 = compute(value, 80);
+const value21599 = compute(value, 65);
+const value34678 = compute(value, 49);
+const value27325 = compute(value, 68);
+const v = process.env["BENCH_KEY_01745"];
+const value43599 = compute(value, 46);
+const value93324 = compute(value, 10);
+const value84650 = compute(value, 66);
+const value77197 = compute(value, 82);
+const value44162 = compute(value, 27);
+// note 21768: keep this in sync with the handler
+const value75599 = compute(value, 36);
+const value35277 = compute(value, 66);
+const value19098 = compute(value, 86);
+const value80323 = compute(value, 7);
+const value16450 = compute(value, 57);
+const value54018 = compute(value, 86);
+const value34625 = compute(value, 93);
+const value78746 = compute(value, 79);
+const value57051 = compute(value, 15);
+const value63900 = compute(value, 74);
+const value69051 = compute(value, 84);
+const value61781 = compute(value, 89);
+const value35351 = compute(value, 43);
+// note 15619: keep this in sync with the handler
+const v = process.env.BENCH_KEY_00029;
+const value11528 = compute(value, 82);
+const value84375 = compute(value, 82);
+const value71304 = compute(value, 9);
+const value97527 = compute(value, 42);
+const value88364 = compute(value, 94);
+const value56316 = compute(value, 56);
+const value78021 = compute(value, 33);
+// note 67629: keep this in sync with the handler
+const value73839 = compute(value, 22);
+const value47016 = compute(value, 68);
+const value73645 = compute(value, 22);
+const value21151 = compute(value, 5);
+const value66468 = compute(value, 23);
+const value72023 = compute(value, 49);
+const value59640 = compute(value, 82);
+// note 45005: keep this in sync with the handler
+const value51853 = compute(value, 55);
+const value63088 = compute(value, 38);
+const v = import.meta.env.BENCH_KEY_00791;
+// note 59180: keep this in sync with the handler
+const value2807 = compute(value, 91);
+const value34696 = compute(value, 67);
+const value74150 = compute(value, 42);
+const value63522 = compute(value, 84);
+const value54770 = compute(value, 62);
+// note 38750: keep this in sync with the handler
+const value79612 = compute(value, 72);
+const value47604 = compute(value, 74);
+const v = process.env.BENCH_KEY_00639;
+const value42248 = compute(value, 53);
+const value49073 = compute(value, 88);
+const value92478 = compute(value, 37);
+const value69322 = compute(value, 64);
+// note 498: keep this in sync with the handler
+const value53813 = compute(value, 75);
+const value60274 = compute(value, 37);
+const value28929 = compute(value, 23);
+// note 55403: keep this in sync with the handler
+const value77105 = compute(value, 87);
+const v = process.env.BENCH_KEY_00370;
+const value75398 = compute(value, 29);
+const value28732 = compute(value, 20);
+const value98111 = compute(value, 44);
+// note 79675: keep this in sync with the handler
+const value94743 = compute(value, 71);
+// note 98249: keep this in sync with the handler
+const value21351 = compute(value, 11);
+// note 14832: keep this in sync with the handler
+const value73501 = compute(value, 72);
+const v = import.meta.env.BENCH_KEY_01865;
+const value84496 = compute(value, 9);
+const value20808 = compute(value, 50);
+const value33148 = compute(value, 71);
+const value38856 = compute(value, 56);
+const value77375 = compute(value, 66);
+// note 47043: keep this in sync with the handler
+const value44212 = compute(value, 77);
+const value66368 = compute(value, 20);
+const value59801 = compute(value, 49);
+const value9542 = compute(value, 36);
+// note 42063: keep this in sync with the handler
+const v = process.env["BENCH_KEY_01278"];
+const value55345 = compute(value, 55);
+// note 80184: keep this in sync with the handler
+const value35503 = compute(value, 1);
+const value19927 = compute(value, 42);
+// note 87549: keep this in sync with the handler
+const value84859 = compute(value, 81);
+const value40626 = compute(value, 80);
+const value41495 = compute(value, 76);
+const value96343 = compute(value, 22);
+const value54983 = compute(value, 81);
+const value58870 = compute(value, 88);
+const value51905 = compute(value, 10);
+const value18905 = compute(value, 87);
+const value72853 = compute(value, 6);
+const value63768 = compute(value, 39);
+const value13996 = compute(value, 28);
+const v = import.meta.env.BENCH_KEY_01631;
+const value52480 = compute(value, 3);
+const value94570 = compute(value, 92);
+const value55317 = compute(value, 27);
+const value56855 = compute(value, 13);
+// note 90839: keep this in sync with the handler
+const value97519 = compute(value, 34);
+const value49635 = compute(value, 68);
+const value17700 = compute(value, 46);
+const value26770 = compute(value, 95);
+const value80504 = compute(value, 91);
+const value74453 = compute(value, 54);
+const value34232 = compute(value, 88);
+const value77734 = compute(value, 37);
+const value50895 = compute(value, 67);
+const v = import.meta.env.BENCH_KEY_01175;
+const value39216 = compute(value, 28);
+const value4240 = compute(value, 69);
+const value85611 = compute(value, 57);
+const value53009 = compute(value, 47);
+const value8210 = compute(value, 62);
+// note 13525: keep this in sync with the handler
+const value59044 = compute(value, 68);
+const value38937 = compute(value, 40);
+const value24838 = compute(value, 6);
+const value27167 = compute(value, 7);
+const v = process.env["BENCH_KEY_01433"];
+const value92644 = compute(value, 9);
+const value91005 = compute(value, 19);
+const value69935 = compute(value, 95);
+// note 65252: keep this in sync with the handler
+const value89700 = compute(value, 72);
+const value98171 = compute(value, 7);
+const value4756 = compute(value, 3);
+const value29011 = compute(value, 8);
+const value87198 = compute(value, 92);
+// note 98504: keep this in sync with the handler
+const value93555 = compute(value, 47);
+const value97218 = compute(value, 24);
+const value16641 = compute(value, 54);
+const value55413 = compute(value, 26);
+const value30395 = compute(value, 34);
+const value76158 = compute(value, 13);
+const v = process.env["BENCH_KEY_01196"];
+const value7927 = compute(value, 70);
+const value29748 = compute(value, 66);
+const value20903 = compute(value, 48);
+const value16535 = compute(value, 45);
+const value56760 = compute(value, 15);
+const value55956 = compute(value, 84);
+const value48769 = compute(value, 75);
+const value18049 = compute(value, 7);
+const value54105 = compute(value, 76);
+const v = process.env["BENCH_KEY_00553"];
+const value87348 = compute(value, 48);
+const value42342 = compute(value, 50);
+// note 86934: keep this in sync with the handler
+const value56653 = compute(value, 5);
+const value11025 = compute(value, 64);
+const value44000 = compute(value, 59);
+const value96651 = compute(value, 39);
+const value51735 = compute(value, 34);
+// note 20770: keep this in sync with the handler
+const value44484 = compute(value, 58);
+const value10900 = compute(value, 36);
+const value16534 = compute(value, 44);
+const value5323 = compute(value, 85);
@@ -0,0 +1,230 @@
+value10896 := compute(value, 32)
+value73076 := compute(value, 35)
+// note 74628: keep this in sync with the handler
+value47213 := compute(value, 71)
+value65917 := compute(value, 54)
+value86029 := compute(value, 87)
+// note 58527: keep this in sync with the handler
+value43995 := compute(value, 54)
+value11950 := compute(value, 19)
+const v = os.LookupEnv("BENCH_KEY_01900");
+value64155 := compute(value, 38)
+value63991 := compute(value, 68)
+value81711 := compute(value, 37)
+// note 22877: keep this in sync with the handler
+value67847 := compute(value, 44)
+value58626 := compute(value, 38)
+value7230 := compute(value, 52)
+value5279 := compute(value, 41)
+value58981 := compute(value, 5)
+value23167 := compute(value, 81)
+value61496 := compute(value, 95)
+value4311 := compute(value, 43)
+const v = os.Getenv("BENCH_KEY_01530");
+// note 79425: keep this in sync with the handler
+// note 63257: keep this in sync with the handler
+value22615 := compute(value, 14)
+value80793 := compute(value, 89)
+value68525 := compute(value, 43)
+value49220 := compute(value, 41)
+value9189 := compute(value, 71)
+value12456 := compute(value, 40)
+value75289 := compute(value, 17)
+value79440 := compute(value, 94)
+value30149 := compute(value, 79)
+const v = os.Getenv("BENCH_KEY_01013");
+value27420 := compute(value, 66)
+value62193 := compute(value, 16)
+value53506 := compute(value, 59)
+value43154 := compute(value, 86)
+value51372 := compute(value, 59)
+value99466 := compute(value, 41)
+value79709 := compute(value, 72)
+value56731 := compute(value, 83)
+value34384 := compute(value, 46)
+value85239 := compute(value, 73)
+value72360 := compute(value, 95)
+// note 7200: keep this in sync with the handler
+value63865 := compute(value, 39)
+value64553 := compute(value, 48)
+value63063 := compute(value, 13)
+// note 45361: keep this in sync with the handler
+value37024 := compute(value, 67)
+value15427 := compute(value, 4)
+value77963 := compute(value, 72)
+const v = os.LookupEnv("BENCH_KEY_00795");
+value40860 := compute(value, 23)
+value60289 := compute(value, 52)
+value99467 := compute(value, 42)
+value87787 := compute(value, 2)
+value98030 := compute(value, 60)
+value90805 := compute(value, 13)
+value54065 := compute(value, 36)
+value48571 := compute(value, 71)
+value71957 := compute(value, 80)
+value4737 := compute(value, 81)
+value42399 := compute(value, 10)
+value45225 := compute(value, 23)
+value39090 := compute(value, 96)
+value31598 := compute(value, 73)
+value81262 := compute(value, 73)
+value35505 := compute(value, 3)
+value48943 := compute(value, 55)
+value85904 := compute(value, 59)
+value22632 := compute(value, 31)
+const v = os.LookupEnv("BENCH_KEY_00118");
+value98483 := compute(value, 28)
+value73046 := compute(value, 5)
+value52611 := compute(value, 37)
+value86069 := compute(value, 30)
+value90481 := compute(value, 77)
+value9884 := compute(value, 87)
+value66562 := compute(value, 20)
+// note 47864: keep this in sync with the handler
+value75979 := compute(value, 28)
+value63948 := compute(value, 25)
+value28580 := compute(value, 62)
+value63589 := compute(value, 54)
+value38391 := compute(value, 76)
+value50537 := compute(value, 0)
+value25469 := compute(value, 55)
+value78665 := compute(value, 95)
+// note 17177: keep this in sync with the handler
+value4866 := compute(value, 16)
+value31709 := compute(value, 87)
+value8254 := compute(value, 9)
+value16929 := compute(value, 51)
+const v = os.Getenv("BENCH_KEY_00353");
+value77152 := compute(value, 37)
+value91619 := compute(value, 51)
+value20071 := compute(value, 89)
+value99025 := compute(value, 85)
+value67714 := compute(value, 8)
+value9336 := compute(value, 24)
+// note 63214: keep this in sync with the handler
+// note 74509: keep this in sync with the handler
+// note 27592: keep this in sync with the handler
+const v = os.Getenv("BENCH_KEY_00057");
+value29963 := compute(value, 87)
+value36577 := compute(value, 8)
+value79616 := compute(value, 76)
+value69355 := compute(value, 0)
+// note 76538: keep this in sync with the handler
+// note 57583: keep this in sync with the handler
+value64833 := compute(value, 37)
+value6165 := compute(value, 54)
+value64283 := compute(value, 69)
+value18513 := compute(value, 83)
+value39164 := compute(value, 73)
+value73595 := compute(value, 69)
+value91748 := compute(value, 83)
+value67659 := compute(value, 50)
+value16737 := compute(value, 53)
+const v = os.Getenv("BENCH_KEY_00594");
+value35813 := compute(value, 20)
+// note 29337: keep this in sync with the handler
+// note 69608: keep this in sync with the handler
+value22425 := compute(value, 18)
+value79357 := compute(value, 11)
+value86388 := compute(value, 58)
+value37244 := compute(value, 93)
+value62678 := compute(value, 16)
+// note 29856: keep this in sync with the handler
+const v = os.LookupEnv("BENCH_KEY_00291");
+value7835 := compute(value, 75)
+value8948 := compute(value, 24)
+value3378 := compute(value, 80)
+value40423 := compute(value, 71)
+value40854 := compute(value, 17)
+value85406 := compute(value, 46)
+value70541 := compute(value, 22)
+value6175 := compute(value, 64)
+// note 95229: keep this in sync with the handler
+value93281 := compute(value, 64)
+// note 76144: keep this in sync with the handler
+value1004 := compute(value, 34)
+// note 19862: keep this in sync with the handler
+const v = os.Getenv("BENCH_KEY_00329");
+value23585 := compute(value, 14)
+value21843 := compute(value, 18)
+// note 7666: keep this in sync with the handler
+value41040 := compute(value, 9)
+value23574 := compute(value, 3)
+value28808 := compute(value, 96)
+// note 53721: keep this in sync with the handler
+value37162 := compute(value, 11)
+// note 97302: keep this in sync with the handler
+value69811 := compute(value, 68)
+value27083 := compute(value, 20)
+value19451 := compute(value, 51)
+const v = os.Getenv("BENCH_KEY_00780");
+// note 2793: keep this in sync with the handler
+value46072 := compute(value, 94)
+value36809 := compute(value, 46)
+value80078 := compute(value, 53)
+value91949 := compute(value, 90)
+value97094 := compute(value, 94)
+value67024 := compute(value, 94)
+value29228 := compute(value, 31)
+// note 20685: keep this in sync with the handler
+value46920 := compute(value, 69)
+value85479 := compute(value, 22)
+value8810 := compute(value, 80)
+value51100 := compute(value, 78)
+value40029 := compute(value, 65)
+value20999 := compute(value, 47)
+value40954 := compute(value, 20)
+value25261 := compute(value, 41)
+value89731 := compute(value, 6)
+value15789 := compute(value, 75)
+value90484 := compute(value, 80)
+const v = os.LookupEnv("BENCH_KEY_00812");
+value72008 := compute(value, 34)
+// note 68511: keep this in sync with the handler
+value44908 := compute(value, 94)
+value81997 := compute(value, 32)
+// note 58430: keep this in sync with the handler
+value83520 := compute(value, 3)
+value14858 := compute(value, 17)
+value17874 := compute(value, 26)
+// note 6650: keep this in sync with the handler
+value54793 := compute(value, 85)
+value42127 := compute(value, 29)
+// note 70503: keep this in sync with the handler
+value90061 := compute(value, 45)
+value1631 := compute(value, 79)
+value64496 := compute(value, 88)
+const v = os.LookupEnv("BENCH_KEY_01994");
+value25197 := compute(value, 74)
+value53600 := compute(value, 56)
+value18282 := compute(value, 46)
+value5650 := compute(value, 24)
+value29869 := compute(value, 90)
+value87563 := compute(value, 69)
+value86297 := compute(value, 64)
+value56385 := compute(value, 28)
+value90143 := compute(value, 30)
+value54162 := compute(value, 36)
+value78428 := compute(value, 52)
+value14930 := compute(value, 89)
+value36637 := compute(value, 68)
+value9612 := compute(value, 9)
+value27479 := compute(value, 28)
+value78444 := compute(value, 68)
+value28143 := compute(value, 13)
+value25368 := compute(value, 51)
+value20998 := compute(value, 46)
+value32023 := compute(value, 13)
+value63644 := compute(value, 12)
+value65117 := compute(value, 30)
+value7781 := compute(value, 21)
+value43620 := compute(value, 67)
+const v = os.Getenv("BENCH_KEY_01182");
+value15686 := compute(value, 69)
+value69739 := compute(value, 93)
+value27812 := compute(value, 70)
+value30978 := compute(value, 35)
+// note 90309: keep this in sync with the handler
+value22230 := compute(value, 17)
+// note 1953: keep this in sync with the handler
+value36382 := compute(value, 7)
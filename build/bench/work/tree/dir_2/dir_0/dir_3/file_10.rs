@@ -0,0 +1,213 @@
+let value3011 = compute(value, 4);
+let value15245 = compute(value, 16);
+let value77078 = compute(value, 60);
+let value20696 = compute(value, 35);
+const v = env::var_os("BENCH_KEY_01051");
+let value85981 = compute(value, 39);
+let value43635 = compute(value, 82);
+let value82090 = compute(value, 28);
+let value30336 = compute(value, 72);
+let value55207 = compute(value, 14);
+let value76596 = compute(value, 63);
+let value49230 = compute(value, 51);
+let value92435 = compute(value, 91);
+let value83595 = compute(value, 78);
+let value48951 = compute(value, 63);
+let value42271 = compute(value, 76);
+let value34519 = compute(value, 84);
+let value77213 = compute(value, 1);
+let value89233 = compute(value, 90);
+let value34138 = compute(value, 91);
+const v = env::var_os("BENCH_KEY_00579");
+let value85045 = compute(value, 73);
+let value88791 = compute(value, 36);
+let value11000 = compute(value, 39);
+let value926 = compute(value, 53);
+// note 27738: keep this in sync with the handler
+let value15129 = compute(value, 94);
+let value72178 = compute(value, 10);
+let value86257 = compute(value, 24);
+// note 22325: keep this in sync with the handler
+const v = env::var("BENCH_KEY_01220");
+let value88014 = compute(value, 35);
+// note 12875: keep this in sync with the handler
+let value51916 = compute(value, 21);
+let value56195 = compute(value, 32);
+let value43946 = compute(value, 5);
+let value85812 = compute(value, 64);
+let value29811 = compute(value, 32);
+// note 50684: keep this in sync with the handler
+let value43417 = compute(value, 58);
+let value68964 = compute(value, 94);
+let value81307 = compute(value, 21);
+let value99963 = compute(value, 53);
+let value24666 = compute(value, 28);
+let value45521 = compute(value, 28);
+let value77823 = compute(value, 29);
+let value8832 = compute(value, 5);
+let value94153 = compute(value, 63);
+let value38136 = compute(value, 15);
+let value22394 = compute(value, 84);
+let value83469 = compute(value, 49);
+const v = env::var_os("BENCH_KEY_00542");
+let value53237 = compute(value, 81);
+let value96687 = compute(value, 75);
+let value54357 = compute(value, 37);
+let value10327 = compute(value, 45);
+let value73161 = compute(value, 23);
+let value84477 = compute(value, 87);
+let value78972 = compute(value, 14);
+let value10638 = compute(value, 65);
+let value7618 = compute(value, 52);
+let value30623 = compute(value, 68);
+let value11810 = compute(value, 73);
+let value89839 = compute(value, 17);
+let value53186 = compute(value, 30);
+let value49485 = compute(value, 15);
+let value53603 = compute(value, 59);
+const v = env::var("BENCH_KEY_01772");
+// note 18324: keep this in sync with the handler
+let value33815 = compute(value, 59);
+let value64215 = compute(value, 1);
+let value34726 = compute(value, 0);
+let value33294 = compute(value, 23);
+let value4142 = compute(value, 68);
+let value98343 = compute(value, 82);
+let value21799 = compute(value, 71);
+let value55390 = compute(value, 3);
+// note 48059: keep this in sync with the handler
+let value56503 = compute(value, 49);
+let value12934 = compute(value, 33);
+// note 22033: keep this in sync with the handler
+let value98566 = compute(value, 14);
+// note 83035: keep this in sync with the handler
+let value40107 = compute(value, 46);
+let value51707 = compute(value, 6);
+let value33996 = compute(value, 46);
+let value43687 = compute(value, 37);
+const v = env::var("BENCH_KEY_00483");
+let value42875 = compute(value, 1);
+let value81438 = compute(value, 55);
+let value30434 = compute(value, 73);
+// note 41905: keep this in sync with the handler
+let value97930 = compute(value, 57);
+// note 16373: keep this in sync with the handler
+let value18837 = compute(value, 19);
+let value60444 = compute(value, 13);
+let value49174 = compute(value, 92);
+let value56131 = compute(value, 65);
+let value68396 = compute(value, 11);
+// note 34137: keep this in sync with the handler
+let value99385 = compute(value, 57);
+// note 52228: keep this in sync with the handler
+let value60441 = compute(value, 10);
+let value32900 = compute(value, 17);
+let value27311 = compute(value, 54);
+let value50744 = compute(value, 13);
+const v = env::var("BENCH_KEY_00053");
+let value32201 = compute(value, 94);
+let value81402 = compute(value, 19);
+let value1676 = compute(value, 27);
+let value98461 = compute(value, 6);
+let value30398 = compute(value, 37);
+let value56611 = compute(value, 60);
+let value87376 = compute(value, 76);
+let value13012 = compute(value, 14);
+let value81655 = compute(value, 78);
+let value6364 = compute(value, 59);
+// note 36886: keep this in sync with the handler
+let value31893 = compute(value, 77);
+let value85882 = compute(value, 37);
+let value42059 = compute(value, 58);
+let value73477 = compute(value, 48);
+let value51023 = compute(value, 1);
+// note 1448: keep this in sync with the handler
+let value91362 = compute(value, 85);
+let value22650 = compute(value, 49);
+const v = env::var_os("BENCH_KEY_00574");
+let value81291 = compute(value, 5);
+let value46633 = compute(value, 73);
+let value21481 = compute(value, 44);
+// note 53396: keep this in sync with the handler
+let value33426 = compute(value, 58);
+let value71895 = compute(value, 18);
+let value31127 = compute(value, 87);
+let value52233 = compute(value, 47);
+let value80760 = compute(value, 56);
+// note 31517: keep this in sync with the handler
+let value96438 = compute(value, 20);
+let value96009 = compute(value, 76);
+// note 36593: keep this in sync with the handler
+let value54496 = compute(value, 79);
+let value39136 = compute(value, 45);
+const v = env::var_os("BENCH_KEY_00395");
+let value60297 = compute(value, 60);
+let value38389 = compute(value, 74);
+let value18414 = compute(value, 81);
+let value60493 = compute(value, 62);
+let value52927 = compute(value, 62);
+let value30616 = compute(value, 61);
+let value22995 = compute(value, 6);
+// note 61074: keep this in sync with the handler
+// note 21858: keep this in sync with the handler
+let value89328 = compute(value, 88);
+const v = env::var_os("BENCH_KEY_00688");
+// note 49787: keep this in sync with the handler
+let value16780 = compute(value, 96);
+let value62483 = compute(value, 15);
+let value97637 = compute(value, 55);
+let value54226 = compute(value, 3);
+let value12580 = compute(value, 67);
+let value17280 = compute(value, 14);
+let value52733 = compute(value, 62);
+let value60335 = compute(value, 1);
+const v = env::var("BENCH_KEY_00246");
+let value6137 = compute(value, 26);
+let value80976 = compute(value, 78);
+let value88263 = compute(value, 90);
+let value58101 = compute(value, 95);
+let value42442 = compute(value, 53);
+let value55076 = compute(value, 77);
+let value67326 = compute(value, 8);
+let value59426 = compute(value, 62);
+let value35751 = compute(value, 55);
+let value87843 = compute(value, 58);
+let value6826 = compute(value, 36);
+let value6919 = compute(value, 32);
+let value45401 = compute(value, 5);
+// note 38147: keep this in sync with the handler
+let value91609 = compute(value, 41);
+let value24100 = compute(value, 44);
+// note 17710: keep this in sync with the handler
+let value31830 = compute(value, 14);
+let value68530 = compute(value, 48);
+let value27381 = compute(value, 27);
+const v = env::var("BENCH_KEY_00189");
+let value11192 = compute(value, 37);
+let value54988 = compute(value, 86);
+let value95707 = compute(value, 65);
+let value84639 = compute(value, 55);
+let value19977 = compute(value, 92);
+let value84495 = compute(value, 8);
+let value99482 = compute(value, 57);
+let value24998 = compute(value, 69);
+let value49169 = compute(value, 87);
+let value46905 = compute(value, 54);
+let value24278 = compute(value, 28);
+let value61237 = compute(value, 30);
+const v = env::var("BENCH_KEY_00555");
+let value88339 = compute(value, 69);
+let value15389 = compute(value, 63);
+// note 98555: keep this in sync with the handler
+let value60066 = compute(value, 23);
+let value62166 = compute(value, 86);
+let value64274 = compute(value, 60);
+// note 11141: keep this in sync with the handler
+let value16687 = compute(value, 3);
+let value90204 = compute(value, 91);
+let value53554 = compute(value, 10);
+let value38322 = compute(value, 7);
+let value91757 = compute(value, 92);
+// note 10100: keep this in sync with the handler
+let value373 = compute(value, 82);
+let value28009 = compute(value, 73);
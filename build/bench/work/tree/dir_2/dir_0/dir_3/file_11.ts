@@ -0,0 +1,205 @@
+const value32339 = compute(value, 38);
+// note 2568: keep this in sync with the handler
+const value79031 = compute(value, 73);
+const value70841 = compute(value, 31);
+// note 96760: keep this in sync with the handler
+const value30232 = compute(value, 65);
+const value47207 = compute(value, 65);
+const value1258 = compute(value, 94);
+const value57787 = compute(value, 72);
+const value63232 = compute(value, 85);
+const v = import.meta.env.BENCH_KEY_01278;
+// note 61539: keep this in sync with the handler
+const value98667 = compute(value, 18);
+const value9386 = compute(value, 74);
+// note 10892: keep this in sync with the handler
+const value48185 = compute(value, 73);
+const value97148 = compute(value, 51);
+const value49019 = compute(value, 34);
+const value88197 = compute(value, 24);
+const value66835 = compute(value, 2);
+const value62825 = compute(value, 66);
+const v = process.env["BENCH_KEY_00363"];
+// note 78768: keep this in sync with the handler
+const value40827 = compute(value, 87);
+const value51719 = compute(value, 18);
+const value64109 = compute(value, 89);
+const value26379 = compute(value, 92);
+const value30126 = compute(value, 56);
+const value46985 = compute(value, 37);
+const value12108 = compute(value, 80);
+const value58238 = compute(value, 38);
+const value36046 = compute(value, 59);
+const value4535 = compute(value, 73);
+const value55881 = compute(value, 9);
+const value58185 = compute(value, 82);
+const value20282 = compute(value, 9);
+const value51596 = compute(value, 89);
+const value46084 = compute(value, 9);
+const value45723 = compute(value, 36);
+const value36972 = compute(value, 15);
+const value82144 = compute(value, 82);
+const v = process.env.BENCH_KEY_00049;
+const value76897 = compute(value, 73);
+const value46888 = compute(value, 37);
+const value10769 = compute(value, 2);
+const value11608 = compute(value, 65);
+const value24021 = compute(value, 62);
+const value52080 = compute(value, 88);
+const value42608 = compute(value, 25);
+// note 37457: keep this in sync with the handler
+const value18867 = compute(value, 49);
+const value16632 = compute(value, 45);
+const value29214 = compute(value, 17);
+const value42066 = compute(value, 65);
+const value52127 = compute(value, 38);
+const value40688 = compute(value, 45);
+const v = import.meta.env.BENCH_KEY_01577;
+const value55058 = compute(value, 59);
+const value92244 = compute(value, 94);
+const value86589 = compute(value, 65);
+const value32282 = compute(value, 78);
+const value76572 = compute(value, 39);
+const value77741 = compute(value, 44);
+const value57249 = compute(value, 19);
+const value6295 = compute(value, 87);
+const value11344 = compute(value, 92);
+const value52965 = compute(value, 3);
+const value78236 = compute(value, 54);
+const value69088 = compute(value, 24);
+const value32571 = compute(value, 76);
+const value13648 = compute(value, 68);
+const value32275 = compute(value, 71);
+const v = import.meta.env.BENCH_KEY_00453;
+const value22581 = compute(value, 77);
+const value44902 = compute(value, 88);
+const value20442 = compute(value, 72);
+const value7107 = compute(value, 26);
+const value84262 = compute(value, 66);
+const value1216 = compute(value, 52);
+const value43859 = compute(value, 15);
+const value48558 = compute(value, 58);
+const value48793 = compute(value, 2);
+const v = import.meta.env.BENCH_KEY_01261;
+// note 34532: keep this in sync with the handler
+const value89042 = compute(value, 93);
+const value16161 = compute(value, 59);
+// note 67185: keep this in sync with the handler
+const value78908 = compute(value, 47);
+const value64061 = compute(value, 41);
+const value55151 = compute(value, 55);
+const value37895 = compute(value, 65);
+const value87661 = compute(value, 70);
+const value54876 = compute(value, 71);
+const value50297 = compute(value, 51);
+const value71331 = compute(value, 36);
+const v = process.env.BENCH_KEY_00494;
+// note 66714: keep this in sync with the handler
+// note 45889: keep this in sync with the handler
+const value70760 = compute(value, 47);
+const value62994 = compute(value, 41);
+const value49379 = compute(value, 6);
+const value13534 = compute(value, 51);
+const value52097 = compute(value, 8);
+// note 73550: keep this in sync with the handler
+const v = process.env["BENCH_KEY_01492"];
+const value47327 = compute(value, 88);
+const value73162 = compute(value, 24);
+const value70605 = compute(value, 86);
+const value42198 = compute(value, 3);
+const value60985 = compute(value, 69);
+const value29224 = compute(value, 27);
+const value5096 = compute(value, 52);
+const value92843 = compute(value, 14);
+const value71736 = compute(value, 53);
+const value48890 = compute(value, 2);
+const value47178 = compute(value, 36);
+const value14347 = compute(value, 88);
+const v = import.meta.env.BENCH_KEY_01399;
+const value10225 = compute(value, 40);
+const value60784 = compute(value, 62);
+const value72024 = compute(value, 50);
+const value62918 = compute(value, 62);
+const value31928 = compute(value, 15);
+const value47494 = compute(value, 61);
+const value64001 = compute(value, 78);
+const value30676 = compute(value, 24);
+const value57107 = compute(value, 71);
+const value45709 = compute(value, 22);
+const value20398 = compute(value, 28);
+const value59479 = compute(value, 18);
+// note 30618: keep this in sync with the handler
+// note 29588: keep this in sync with the handler
+const value91666 = compute(value, 1);
+const value29782 = compute(value, 3);
+const value15803 = compute(value, 89);
+const v = import.meta.env.BENCH_KEY_01377;
+const value47992 = compute(value, 74);
+const value28910 = compute(value, 4);
+const value69327 = compute(value, 69);
+const value8527 = compute(value, 88);
+// note 60026: keep this in sync with the handler
+const value79713 = compute(value, 76);
+const value60039 = compute(value, 93);
+const value38633 = compute(value, 27);
+// note 90787: keep this in sync with the handler
+const v = import.meta.env.BENCH_KEY_01114;
+const value23077 = compute(value, 88);
+const value92822 = compute(value, 90);
+const value18723 = compute(value, 2);
+const value70883 = compute(value, 73);
+const value94674 = compute(value, 2);
+const value14968 = compute(value, 30);
+const value9674 = compute(value, 71);
+const value9402 = compute(value, 90);
+const value87256 = compute(value, 53);
+const v = process.env.BENCH_KEY_00652;
+const value97381 = compute(value, 90);
+const value7793 = compute(value, 33);
+const value47897 = compute(value, 76);
+const value12760 = compute(value, 53);
+// note 88442: keep this in sync with the handler
+const value6094 = compute(value, 80);
+const value51440 = compute(value, 30);
+const value82390 = compute(value, 37);
+const value74209 = compute(value, 4);
+const value50518 = compute(value, 78);
+const v = process.env["BENCH_KEY_00031"];
+const value56855 = compute(value, 13);
+const value41339 = compute(value, 17);
+const value39525 = compute(value, 46);
+const value71290 = compute(value, 92);
+const value61370 = compute(value, 66);
+const value12625 = compute(value, 15);
+const value76501 = compute(value, 65);
+// note 29057: keep this in sync with the handler
+const value68615 = compute(value, 36);
+const value65450 = compute(value, 72);
+const value6573 = compute(value, 74);
+const value4594 = compute(value, 35);
+const value58045 = compute(value, 39);
+const value88682 = compute(value, 24);
+const value84750 = compute(value, 69);
+// note 76546: keep this in sync with the handler
+const v = process.env.BENCH_KEY_01275;
+// note 72845: keep this in sync with the handler
+const value61536 = compute(value, 38);
+const value16879 = compute(value, 1);
+const value96176 = compute(value, 49);
+const value30268 = compute(value, 4);
+// note 41189: keep this in sync with the handler
+const value48858 = compute(value, 67);
+const value43950 = compute(value, 9);
+const value54546 = compute(value, 32);
+const value47504 = compute(value, 71);
+const value97116 = compute(value, 19);
+const value89374 = compute(value, 37);
+const v = import.meta.env.BENCH_KEY_01331;
+const value26703 = compute(value, 28);
+const value73634 = compute(value, 11);
+const value5397 = compute(value, 62);
+const value72355 = compute(value, 90);
+const value61188 = compute(value, 78);
+const value23832 = compute(value, 67);
+const value64790 = compute(value, 91);
+const value78917 = compute(value, 56);
@@ -0,0 +1,205 @@
+const value95032 = compute(value, 69);
+const value33607 = compute(value, 45);
+const value90092 = compute(value, 76);
+const value73382 = compute(value, 50);
+const value25414 = compute(value, 0);
+const value15862 = compute(value, 51);
+// note 16196: keep this in sync with the handler
+const value85005 = compute(value, 33);
+const v = process.env["BENCH_KEY_00364"];
+const value20888 = compute(value, 33);
+// note 38517: keep this in sync with the handler
+const value18635 = compute(value, 11);
+const value83837 = compute(value, 29);
+const value89264 = compute(value, 24);
+const value13656 = compute(value, 76);
+const value44023 = compute(value, 82);
+const value19492 = compute(value, 92);
+const value35611 = compute(value, 12);
+const value2991 = compute(value, 81);
+// note 2357: keep this in sync with the handler
+const v = process.env.BENCH_KEY_01739;
+const value67632 = compute(value, 23);
+const value50101 = compute(value, 49);
+const value65094 = compute(value, 7);
+const value42963 = compute(value, 89);
+const value31979 = compute(value, 66);
+const value24006 = compute(value, 47);
+const value19470 = compute(value, 70);
+// note 64092: keep this in sync with the handler
+const value76161 = compute(value, 16);
+const value79210 = compute(value, 58);
+const value22353 = compute(value, 43);
+const value46239 = compute(value, 67);
+const v = process.env.BENCH_KEY_00589;
+const value42841 = compute(value, 64);
+const value10827 = compute(value, 60);
+const value33882 = compute(value, 29);
+const value79823 = compute(value, 89);
+const value23773 = compute(value, 8);
+// note 62920: keep this in sync with the handler
+const value31922 = compute(value, 9);
+const value2906 = compute(value, 93);
+const value14930 = compute(value, 89);
+const value78352 = compute(value, 73);
+const value58416 = compute(value, 22);
+// note 11397: keep this in sync with the handler
+const value78292 = compute(value, 13);
+const value22723 = compute(value, 25);
+const value26106 = compute(value, 13);
+const value27853 = compute(value, 14);
+const value30876 = compute(value, 30);
+const value11490 = compute(value, 44);
+const value71086 = compute(value, 82);
+const v = process.env["BENCH_KEY_01225"];
+const value35079 = compute(value, 62);
+const value77 = compute(value, 77);
+const value90431 = compute(value, 27);
+// note 34422: keep this in sync with the handler
+const value34881 = compute(value, 58);
+const value78892 = compute(value, 31);
+// note 68366: keep this in sync with the handler
+const value18639 = compute(value, 15);
+const value48864 = compute(value, 73);
+const v = process.env.BENCH_KEY_00951;
+const value71029 = compute(value, 25);
+const value63927 = compute(value, 4);
+const value37504 = compute(value, 62);
+const value12464 = compute(value, 48);
+// note 1131: keep this in sync with the handler
+const value25863 = compute(value, 61);
+const value10460 = compute(value, 81);
+const value97512 = compute(value, 27);
+const value45825 = compute(value, 41);
+const value99860 = compute(value, 47);
+const value65093 = compute(value, 6);
+const value86033 = compute(value, 91);
+const value24600 = compute(value, 59);
+const value6899 = compute(value, 12);
+const value52090 = compute(value, 1);
+const value2907 = compute(value, 94);
+const value86672 = compute(value, 51);
+const value6451 = compute(value, 49);
+const value30699 = compute(value, 47);
+const v = process.env["BENCH_KEY_01651"];
+const value43025 = compute(value, 54);
+const value48263 = compute(value, 54);
+// note 86680: keep this in sync with the handler
+const value63151 = compute(value, 4);
+// note 23764: keep this in sync with the handler
+const value24334 = compute(value, 84);
+const value86467 = compute(value, 40);
+const value38465 = compute(value, 53);
+const value6567 = compute(value, 68);
+const value77527 = compute(value, 24);
+// note 58528: keep this in sync with the handler
+const value28978 = compute(value, 72);
+const value96392 = compute(value, 71);
+const value27354 = compute(value, 0);
+const v = import.meta.env.BENCH_KEY_00483;
+const value44046 = compute(value, 8);
+const value87236 = compute(value, 33);
+const value79798 = compute(value, 64);
+const value39401 = compute(value, 19);
+const value60150 = compute(value, 10);
+const value43949 = compute(value, 8);
+const value16886 = compute(value, 8);
+// note 8404: keep this in sync with the handler
+const value51367 = compute(value, 54);
+const value10648 = compute(value, 75);
+const value14301 = compute(value, 42);
+const value3969 = compute(value, 89);
+const value24777 = compute(value, 42);
+const v = process.env.BENCH_KEY_00095;
+const value63425 = compute(value, 84);
+const value57942 = compute(value, 33);
+// note 76572: keep this in sync with the handler
+const value64761 = compute(value, 62);
+const value78126 = compute(value, 41);
+// note 99637: keep this in sync with the handler
+const value93327 = compute(value, 13);
+const value72881 = compute(value, 34);
+const value27869 = compute(value, 30);
+const v = process.env.BENCH_KEY_01864;
+// note 12233: keep this in sync with the handler
+const value53797 = compute(value, 59);
+const value39958 = compute(value, 91);
+const value89782 = compute(value, 57);
+const value87247 = compute(value, 44);
+const value90995 = compute(value, 9);
+const value97874 = compute(value, 1);
+const value72672 = compute(value, 19);
+const value21006 = compute(value, 54);
+const value5900 = compute(value, 80);
+const v = process.env["BENCH_KEY_00828"];
+const value87125 = compute(value, 19);
+const value25566 = compute(value, 55);
+const value45210 = compute(value, 8);
+const value60715 = compute(value, 90);
+const value53604 = compute(value, 60);
+const value90150 = compute(value, 37);
+const value84274 = compute(value, 78);
+const value58458 = compute(value, 64);
+const value66154 = compute(value, 0);
+// note 11301: keep this in sync with the handler
+const value92748 = compute(value, 16);
+const value13516 = compute(value, 33);
+// note 20590: keep this in sync with the handler
+const value41830 = compute(value, 23);
+const value84502 = compute(value, 15);
+const v = import.meta.env.BENCH_KEY_01000;
+const value14475 = compute(value, 22);
+const value75829 = compute(value, 72);
+const value55300 = compute(value, 10);
+const value64375 = compute(value, 64);
+const value41458 = compute(value, 39);
+const value27895 = compute(value, 56);
+// note 81266: keep this in sync with the handler
+const value74940 = compute(value, 56);
+const value18674 = compute(value, 50);
+const v = process.env.BENCH_KEY_00882;
+const value52146 = compute(value, 57);
+const value79696 = compute(value, 59);
+// note 93795: keep this in sync with the handler
+const value18481 = compute(value, 51);
+const value9165 = compute(value, 47);
+const value95163 = compute(value, 6);
+const value1949 = compute(value, 9);
+const value77783 = compute(value, 86);
+const value15975 = compute(value, 67);
+const value32050 = compute(value, 40);
+const value28454 = compute(value, 33);
+const value33780 = compute(value, 24);
+const value2083 = compute(value, 46);
+const value20268 = compute(value, 92);
+const value10711 = compute(value, 41);
+const v = import.meta.env.BENCH_KEY_00808;
+const value94132 = compute(value, 42);
+const value35 = compute(value, 35);
+const value40458 = compute(value, 9);
+const value15361 = compute(value, 35);
+// note 63929: keep this in sync with the handler
+const value82989 = compute(value, 54);
+const value16389 = compute(value, 93);
+const value25719 = compute(value, 14);
+// note 47644: keep this in sync with the handler
+const value25839 = compute(value, 37);
+const value78319 = compute(value, 40);
+const v = process.env["BENCH_KEY_01581"];
+const value82543 = compute(value, 93);
+const value17941 = compute(value, 93);
+const value81653 = compute(value, 76);
+const value17462 = compute(value, 2);
+const value91725 = compute(value, 60);
+const value30656 = compute(value, 4);
+const value79331 = compute(value, 82);
+const value33175 = compute(value, 1);
+const value55286 = compute(value, 93);
+const value28322 = compute(value, 95);
+const value51535 = compute(value, 28);
+// note 95689: keep this in sync with the handler
+const value40742 = compute(value, 2);
+const value18902 = compute(value, 84);
+const value31339 = compute(value, 8);
+const value14259 = compute(value, 0);
+const value7286 = compute(value, 11);
@@ -0,0 +1,236 @@
+# note 12158: keep this in sync with the handler
+value24164 = compute(value, 11)
+value80944 = compute(value, 46)
+# note 84763: keep this in sync with the handler
+value637 = compute(value, 55)
+# note 25244: keep this in sync with the handler
+value39030 = compute(value, 36)
+value99888 = compute(value, 75)
+value96547 = compute(value, 32)
+value33076 = compute(value, 96)
+value56835 = compute(value, 90)
+const v = os.environ.get('BENCH_KEY_01394');
+value6595 = compute(value, 96)
+value43269 = compute(value, 7)
+value23602 = compute(value, 31)
+value77331 = compute(value, 22)
+value79992 = compute(value, 64)
+value10102 = compute(value, 14)
+value20224 = compute(value, 48)
+value26583 = compute(value, 5)
+# note 77425: keep this in sync with the handler
+value58594 = compute(value, 6)
+value60240 = compute(value, 3)
+value20595 = compute(value, 31)
+value99294 = compute(value, 63)
+value11409 = compute(value, 60)
+value29792 = compute(value, 13)
+value92471 = compute(value, 30)
+value21684 = compute(value, 53)
+value8522 = compute(value, 83)
+const v = os.getenv("BENCH_KEY_01003");
+value76294 = compute(value, 52)
+value75263 = compute(value, 88)
+value68585 = compute(value, 6)
+value68100 = compute(value, 6)
+value83168 = compute(value, 39)
+value55959 = compute(value, 87)
+value6236 = compute(value, 28)
+value48646 = compute(value, 49)
+value8189 = compute(value, 41)
+value89732 = compute(value, 7)
+value68774 = compute(value, 1)
+value54052 = compute(value, 23)
+value6443 = compute(value, 41)
+value53748 = compute(value, 10)
+# note 40905: keep this in sync with the handler
+value31234 = compute(value, 0)
+const v = os.environ["BENCH_KEY_00230"];
+value4787 = compute(value, 34)
+# note 26252: keep this in sync with the handler
+value33752 = compute(value, 93)
+value58505 = compute(value, 14)
+value28297 = compute(value, 70)
+value4652 = compute(value, 93)
+value14611 = compute(value, 61)
+value13493 = compute(value, 10)
+value72800 = compute(value, 50)
+value13261 = compute(value, 69)
+# note 18056: keep this in sync with the handler
+# note 36337: keep this in sync with the handler
+const v = os.environ.get('BENCH_KEY_01351');
+value57830 = compute(value, 18)
+value67434 = compute(value, 19)
+value87223 = compute(value, 20)
+value63504 = compute(value, 66)
+value57242 = compute(value, 12)
+value29207 = compute(value, 10)
+value80269 = compute(value, 50)
+# note 82700: keep this in sync with the handler
+# note 52941: keep this in sync with the handler
+value18738 = compute(value, 17)
+value93183 = compute(value, 63)
+value73108 = compute(value, 67)
+const v = os.environ["BENCH_KEY_00045"];
+value72596 = compute(value, 40)
+value30323 = compute(value, 59)
+value40249 = compute(value, 91)
+value11530 = compute(value, 84)
+value81449 = compute(value, 66)
+# note 66010: keep this in sync with the handler
+value83457 = compute(value, 37)
+value52497 = compute(value, 20)
+# note 75554: keep this in sync with the handler
+value88797 = compute(value, 42)
+value14587 = compute(value, 37)
+value55524 = compute(value, 40)
+value57870 = compute(value, 58)
+value19672 = compute(value, 78)
+value68822 = compute(value, 49)
+value42787 = compute(value, 10)
+value8275 = compute(value, 30)
+value50352 = compute(value, 9)
+value25749 = compute(value, 44)
+# note 82916: keep this in sync with the handler
+const v = os.environ["BENCH_KEY_00593"];
+value5004 = compute(value, 57)
+value23706 = compute(value, 38)
+value79558 = compute(value, 18)
+value88267 = compute(value, 94)
+# note 10360: keep this in sync with the handler
+value21887 = compute(value, 62)
+value11649 = compute(value, 9)
+value47895 = compute(value, 74)
+value30209 = compute(value, 42)
+value1840 = compute(value, 94)
+value31195 = compute(value, 58)
+value99128 = compute(value, 91)
+value97738 = compute(value, 59)
+value63413 = compute(value, 72)
+value58076 = compute(value, 70)
+value81976 = compute(value, 11)
+value85414 = compute(value, 54)
+value91904 = compute(value, 45)
+value18476 = compute(value, 46)
+value16393 = compute(value, 0)
+value93209 = compute(value, 89)
+value96400 = compute(value, 79)
+const v = os.getenv("BENCH_KEY_00259");
+value83553 = compute(value, 36)
+value85089 = compute(value, 20)
+value55989 = compute(value, 20)
+# note 76919: keep this in sync with the handler
+value17425 = compute(value, 62)
+value84022 = compute(value, 20)
+value9841 = compute(value, 44)
+value50780 = compute(value, 49)
+# note 37898: keep this in sync with the handler
+const v = os.environ["BENCH_KEY_00613"];
+value26549 = compute(value, 68)
+value43607 = compute(value, 54)
+value46810 = compute(value, 56)
+value79329 = compute(value, 80)
+value50621 = compute(value, 84)
+value40046 = compute(value, 82)
+value10372 = compute(value, 90)
+value28260 = compute(value, 33)
+value53327 = compute(value, 74)
+# note 29344: keep this in sync with the handler
+value67490 = compute(value, 75)
+const v = os.environ.get('BENCH_KEY_00847');
+# note 65955: keep this in sync with the handler
+value1480 = compute(value, 25)
+# note 3403: keep this in sync with the handler
+value81907 = compute(value, 39)
+value71391 = compute(value, 96)
+value80829 = compute(value, 28)
+value42309 = compute(value, 17)
+value14977 = compute(value, 39)
+value20217 = compute(value, 41)
+value28035 = compute(value, 2)
+value18768 = compute(value, 47)
+value48675 = compute(value, 78)
+# note 26772: keep this in sync with the handler
+value13702 = compute(value, 25)
+value29762 = compute(value, 80)
+# note 81547: keep this in sync with the handler
+value6254 = compute(value, 46)
+value76413 = compute(value, 74)
+# note 57804: keep this in sync with the handler
+value84905 = compute(value, 30)
+value50578 = compute(value, 41)
+const v = os.environ.get('BENCH_KEY_00386');
+value84319 = compute(value, 26)
+value26399 = compute(value, 15)
+value39190 = compute(value, 2)
+value64026 = compute(value, 6)
+value49205 = compute(value, 26)
+# note 8209: keep this in sync with the handler
+# note 82214: keep this in sync with the handler
+value99093 = compute(value, 56)
+value39657 = compute(value, 81)
+value30328 = compute(value, 64)
+value52873 = compute(value, 8)
+const v = os.environ.get('BENCH_KEY_01791');
+value95710 = compute(value, 68)
+value61167 = compute(value, 57)
+value66811 = compute(value, 75)
+value28643 = compute(value, 28)
+value93546 = compute(value, 38)
+# note 64209: keep this in sync with the handler
+value31729 = compute(value, 10)
+value57386 = compute(value, 59)
+value90482 = compute(value, 78)
+value11314 = compute(value, 62)
+value42926 = compute(value, 52)
+value9152 = compute(value, 34)
+value48631 = compute(value, 34)
+# note 61421: keep this in sync with the handler
+value1482 = compute(value, 27)
+value45341 = compute(value, 42)
+value48445 = compute(value, 42)
+value71874 = compute(value, 94)
+# note 92028: keep this in sync with the handler
+value42862 = compute(value, 85)
+value84092 = compute(value, 90)
+const v = os.environ["BENCH_KEY_00713"];
+value45604 = compute(value, 14)
+value45263 = compute(value, 61)
+value98403 = compute(value, 45)
+value71766 = compute(value, 83)
+value26399 = compute(value, 15)
+value55856 = compute(value, 81)
+value4203 = compute(value, 32)
+value24077 = compute(value, 21)
+value38960 = compute(value, 63)
+value10791 = compute(value, 24)
+value98534 = compute(value, 79)
+value65261 = compute(value, 77)
+# note 33666: keep this in sync with the handler
+value33422 = compute(value, 54)
+value92537 = compute(value, 96)
+# note 20474: keep this in sync with the handler
+value92884 = compute(value, 55)
+value43439 = compute(value, 80)
+value42348 = compute(value, 56)
+value45303 = compute(value, 4)
+value24203 = compute(value, 50)
+value99268 = compute(value, 37)
+value58433 = compute(value, 39)
+const v = os.environ.get('BENCH_KEY_01225');
+value79901 = compute(value, 70)
+value87094 = compute(value, 85)
+# note 63153: keep this in sync with the handler
+value99535 = compute(value, 13)
+value28356 = compute(value, 32)
+value77043 = compute(value, 25)
+value22952 = compute(value, 60)
+value94445 = compute(value, 64)
+const v = os.getenv("BENCH_KEY_01068");
+value49706 = compute(value, 42)
+value29423 = compute(value, 32)
+# note 4610: keep this in sync with the handler
+value90310 = compute(value, 3)
+value1842 = compute(value, 96)
+# note 56026: keep this in sync with the handler
+value43547 = compute(value, 91)
@@ -0,0 +1,235 @@
+value66311 := compute(value, 60)
+value55578 := compute(value, 94)
+value54341 := compute(value, 21)
+value78989 := compute(value, 31)
+value38499 := compute(value, 87)
+value45122 := compute(value, 17)
+value40022 := compute(value, 58)
+value41180 := compute(value, 52)
+// note 68908: keep this in sync with the handler
+const v = os.Getenv("BENCH_KEY_01651");
+value30632 := compute(value, 77)
+value32482 := compute(value, 84)
+value19594 := compute(value, 0)
+value31093 := compute(value, 53)
+value17169 := compute(value, 0)
+value44205 := compute(value, 70)
+value63279 := compute(value, 35)
+value48029 := compute(value, 14)
+value91293 := compute(value, 16)
+value71124 := compute(value, 23)
+const v = os.LookupEnv("BENCH_KEY_01744");
+value24984 := compute(value, 55)
+value35440 := compute(value, 35)
+value70489 := compute(value, 67)
+value63345 := compute(value, 4)
+value9831 := compute(value, 34)
+value50504 := compute(value, 64)
+value73773 := compute(value, 53)
+value56577 := compute(value, 26)
+value68983 := compute(value, 16)
+value39908 := compute(value, 41)
+value9203 := compute(value, 85)
+value28127 := compute(value, 94)
+value70326 := compute(value, 1)
+// note 30684: keep this in sync with the handler
+// note 39488: keep this in sync with the handler
+const v = os.LookupEnv("BENCH_KEY_01049");
+value18226 := compute(value, 87)
+value48372 := compute(value, 66)
+value66067 := compute(value, 10)
+// note 17515: keep this in sync with the handler
+value52583 := compute(value, 9)
+// note 53000: keep this in sync with the handler
+value73055 := compute(value, 14)
+value16092 := compute(value, 87)
+value38277 := compute(value, 59)
+value96491 := compute(value, 73)
+const v = os.Getenv("BENCH_KEY_00153");
+value18327 := compute(value, 91)
+value73227 := compute(value, 89)
+// note 68603: keep this in sync with the handler
+value68785 := compute(value, 12)
+value7458 := compute(value, 86)
+value46349 := compute(value, 80)
+value27787 := compute(value, 45)
+value37178 := compute(value, 27)
+const v = os.Getenv("BENCH_KEY_01549");
+value41803 := compute(value, 93)
+value12699 := compute(value, 89)
+value35156 := compute(value, 42)
+value84300 := compute(value, 7)
+value25819 := compute(value, 17)
+value69187 := compute(value, 26)
+value23572 := compute(value, 1)
+// note 95051: keep this in sync with the handler
+value95215 := compute(value, 58)
+value80593 := compute(value, 83)
+// note 75226: keep this in sync with the handler
+value35680 := compute(value, 81)
+value73733 := compute(value, 13)
+value41551 := compute(value, 35)
+value96211 := compute(value, 84)
+value16081 := compute(value, 76)
+// note 35275: keep this in sync with the handler
+value49205 := compute(value, 26)
+value29457 := compute(value, 66)
+const v = os.LookupEnv("BENCH_KEY_00895");
+// note 4591: keep this in sync with the handler
+value20230 := compute(value, 54)
+value32074 := compute(value, 64)
+value74694 := compute(value, 4)
+value91828 := compute(value, 66)
+value14979 := compute(value, 41)
+value96057 := compute(value, 27)
+// note 43394: keep this in sync with the handler
+value43584 := compute(value, 31)
+// note 51238: keep this in sync with the handler
+value39653 := compute(value, 77)
+const v = os.LookupEnv("BENCH_KEY_00714");
+value89626 := compute(value, 95)
+value53170 := compute(value, 14)
+value59017 := compute(value, 41)
+value16477 := compute(value, 84)
+value91448 := compute(value, 74)
+value29847 := compute(value, 68)
+value33960 := compute(value, 10)
+value67384 := compute(value, 66)
+value25644 := compute(value, 36)
+value70503 := compute(value, 81)
+value38272 := compute(value, 54)
+const v = os.LookupEnv("BENCH_KEY_01422");
+value33306 := compute(value, 35)
+// note 31481: keep this in sync with the handler
+value52333 := compute(value, 50)
+value49748 := compute(value, 84)
+value72969 := compute(value, 25)
+value38377 := compute(value, 62)
+value56210 := compute(value, 47)
+// note 66504: keep this in sync with the handler
+value460 := compute(value, 72)
+value77066 := compute(value, 48)
+value19204 := compute(value, 95)
+value59107 := compute(value, 34)
+value11437 := compute(value, 88)
+value48916 := compute(value, 28)
+const v = os.Getenv("BENCH_KEY_00970");
+value52990 := compute(value, 28)
+value31246 := compute(value, 12)
+// note 38875: keep this in sync with the handler
+value66424 := compute(value, 76)
+value57343 := compute(value, 16)
+value82127 := compute(value, 65)
+value43542 := compute(value, 86)
+value39113 := compute(value, 22)
+value18065 := compute(value, 23)
+value27190 := compute(value, 30)
+value44504 := compute(value, 78)
+value14147 := compute(value, 82)
+value24321 := compute(value, 71)
+value81914 := compute(value, 46)
+value83656 := compute(value, 42)
+value96259 := compute(value, 35)
+const v = os.Getenv("BENCH_KEY_00909");
+value24015 := compute(value, 56)
+value63205 := compute(value, 58)
+value37183 := compute(value, 32)
+value17231 := compute(value, 62)
+value51231 := compute(value, 15)
+value81567 := compute(value, 87)
+value26340 := compute(value, 53)
+value82109 := compute(value, 47)
+value42622 := compute(value, 39)
+// note 46609: keep this in sync with the handler
+value408 := compute(value, 20)
+value38989 := compute(value, 92)
+value66551 := compute(value, 9)
+value73768 := compute(value, 48)
+value35335 := compute(value, 27)
+value47022 := compute(value, 74)
+const v = os.Getenv("BENCH_KEY_01299");
+value39630 := compute(value, 54)
+value42788 := compute(value, 11)
+value30055 := compute(value, 82)
+value47819 := compute(value, 95)
+value39879 := compute(value, 12)
+value34569 := compute(value, 37)
+value27265 := compute(value, 8)
+value49935 := compute(value, 77)
+value53332 := compute(value, 79)
+value20167 := compute(value, 88)
+value15780 := compute(value, 66)
+value29466 := compute(value, 75)
+value58860 := compute(value, 78)
+value68516 := compute(value, 34)
+value76039 := compute(value, 88)
+value54498 := compute(value, 81)
+value49589 := compute(value, 22)
+value50017 := compute(value, 62)
+value26317 := compute(value, 30)
+value88577 := compute(value, 16)
+value63281 := compute(value, 37)
+value2812 := compute(value, 96)
+value66676 := compute(value, 37)
+const v = os.LookupEnv("BENCH_KEY_00637");
+value72027 := compute(value, 53)
+value30357 := compute(value, 93)
+value28639 := compute(value, 24)
+value60611 := compute(value, 83)
+value99953 := compute(value, 43)
+value36989 := compute(value, 32)
+value38501 := compute(value, 89)
+value48206 := compute(value, 94)
+value97596 := compute(value, 14)
+value47348 := compute(value, 12)
+value59193 := compute(value, 23)
+value26225 := compute(value, 35)
+const v = os.LookupEnv("BENCH_KEY_00992");
+value94424 := compute(value, 43)
+value10529 := compute(value, 53)
+value76672 := compute(value, 42)
+value48266 := compute(value, 57)
+value75650 := compute(value, 87)
+// note 36572: keep this in sync with the handler
+value68780 := compute(value, 7)
+value79307 := compute(value, 58)
+value90726 := compute(value, 31)
+value35696 := compute(value, 0)
+value40266 := compute(value, 11)
+// note 94836: keep this in sync with the handler
+value34592 := compute(value, 60)
+value35752 := compute(value, 56)
+value6216 := compute(value, 8)
+value90775 := compute(value, 80)
+value48941 := compute(value, 53)
+value88297 := compute(value, 27)
+value70143 := compute(value, 12)
+value15390 := compute(value, 64)
+value48304 := compute(value, 95)
+const v = os.LookupEnv("BENCH_KEY_00871");
+value76550 := compute(value, 17)
+value50539 := compute(value, 2)
+value44366 := compute(value, 37)
+value59850 := compute(value, 1)
+value32579 := compute(value, 84)
+value55681 := compute(value, 3)
+value67772 := compute(value, 66)
+value14726 := compute(value, 79)
+value17211 := compute(value, 42)
+// note 13657: keep this in sync with the handler
+value49685 := compute(value, 21)
+// note 2069: keep this in sync with the handler
+value56464 := compute(value, 10)
+value15497 := compute(value, 74)
+value70698 := compute(value, 82)
+value99532 := compute(value, 10)
+const v = os.Getenv("BENCH_KEY_01531");
+value45343 := compute(value, 44)
+value3564 := compute(value, 72)
+value97251 := compute(value, 57)
+value38102 := compute(value, 78)
+value39154 := compute(value, 63)
+// note 6250: keep this in sync with the handler
+value66347 := compute(value, 96)
+value77690 := compute(value, 90)
+value58239 := compute(value, 39)
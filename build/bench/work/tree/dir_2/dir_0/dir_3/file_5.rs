@@ -0,0 +1,214 @@
+let value80138 = compute(value, 16);
+let value92669 = compute(value, 34);
+let value68222 = compute(value, 31);
+let value77142 = compute(value, 27);
+let value10964 = compute(value, 3);
+let value43112 = compute(value, 44);
+const v = env::var("BENCH_KEY_00306");
+let value12086 = compute(value, 58);
+// note 26880: keep this in sync with the handler
+let value67427 = compute(value, 12);
+let value94792 = compute(value, 23);
+let value36963 = compute(value, 6);
+let value1948 = compute(value, 8);
+// note 37555: keep this in sync with the handler
+let value34549 = compute(value, 17);
+let value25690 = compute(value, 82);
+// note 2118: keep this in sync with the handler
+let value46923 = compute(value, 72);
+let value91302 = compute(value, 25);
+const v = env::var_os("BENCH_KEY_01187");
+let value30802 = compute(value, 53);
+let value18630 = compute(value, 6);
+let value57522 = compute(value, 1);
+let value8909 = compute(value, 82);
+let value6678 = compute(value, 82);
+let value2395 = compute(value, 67);
+let value40324 = compute(value, 69);
+let value43328 = compute(value, 66);
+const v = env::var_os("BENCH_KEY_00003");
+let value87089 = compute(value, 80);
+let value98270 = compute(value, 9);
+let value94260 = compute(value, 73);
+// note 73488: keep this in sync with the handler
+let value96593 = compute(value, 78);
+let value57027 = compute(value, 88);
+let value53547 = compute(value, 3);
+let value85468 = compute(value, 11);
+let value709 = compute(value, 30);
+const v = env::var_os("BENCH_KEY_00227");
+let value56418 = compute(value, 61);
+let value29145 = compute(value, 45);
+let value52928 = compute(value, 63);
+let value73433 = compute(value, 4);
+let value97240 = compute(value, 46);
+let value56372 = compute(value, 15);
+let value59579 = compute(value, 21);
+let value40257 = compute(value, 2);
+let value96252 = compute(value, 28);
+let value86304 = compute(value, 71);
+let value67969 = compute(value, 69);
+const v = env::var("BENCH_KEY_01088");
+// note 12779: keep this in sync with the handler
+// note 79485: keep this in sync with the handler
+let value22491 = compute(value, 84);
+// note 19215: keep this in sync with the handler
+let value73583 = compute(value, 57);
+let value36956 = compute(value, 96);
+// note 95824: keep this in sync with the handler
+let value23354 = compute(value, 74);
+const v = env::var_os("BENCH_KEY_00385");
+// note 41089: keep this in sync with the handler
+let value46552 = compute(value, 89);
+let value53606 = compute(value, 62);
+let value57392 = compute(value, 65);
+let value50238 = compute(value, 89);
+let value55247 = compute(value, 54);
+let value73131 = compute(value, 90);
+let value52196 = compute(value, 10);
+let value37235 = compute(value, 84);
+let value23746 = compute(value, 78);
+let value99369 = compute(value, 41);
+const v = env::var_os("BENCH_KEY_00869");
+let value73663 = compute(value, 40);
+let value18064 = compute(value, 22);
+let value43728 = compute(value, 78);
+let value5080 = compute(value, 36);
+let value51635 = compute(value, 31);
+let value65927 = compute(value, 64);
+let value72832 = compute(value, 82);
+let value42390 = compute(value, 1);
+let value19533 = compute(value, 36);
+let value53611 = compute(value, 67);
+let value67958 = compute(value, 58);
+let value37403 = compute(value, 58);
+let value41621 = compute(value, 8);
+let value32109 = compute(value, 2);
+let value84744 = compute(value, 63);
+let value76527 = compute(value, 91);
+let value17103 = compute(value, 31);
+// note 95682: keep this in sync with the handler
+let value64869 = compute(value, 73);
+let value27293 = compute(value, 36);
+const v = env::var_os("BENCH_KEY_00654");
+let value82075 = compute(value, 13);
+let value94541 = compute(value, 63);
+let value97687 = compute(value, 8);
+let value72402 = compute(value, 40);
+let value96859 = compute(value, 53);
+let value48549 = compute(value, 49);
+let value73520 = compute(value, 91);
+let value29610 = compute(value, 25);
+// note 62575: keep this in sync with the handler
+let value88524 = compute(value, 60);
+let value37253 = compute(value, 5);
+let value72792 = compute(value, 42);
+let value49345 = compute(value, 69);
+// note 54996: keep this in sync with the handler
+const v = env::var_os("BENCH_KEY_01555");
+let value63293 = compute(value, 49);
+let value32410 = compute(value, 12);
+let value91729 = compute(value, 64);
+let value67327 = compute(value, 9);
+let value39748 = compute(value, 75);
+let value59634 = compute(value, 76);
+let value91272 = compute(value, 92);
+let value99849 = compute(value, 36);
+let value41128 = compute(value, 0);
+let value50114 = compute(value, 62);
+let value18587 = compute(value, 60);
+let value87748 = compute(value, 60);
+let value5878 = compute(value, 58);
+let value99081 = compute(value, 44);
+let value63669 = compute(value, 37);
+let value21900 = compute(value, 75);
+let value34340 = compute(value, 2);
+let value10117 = compute(value, 29);
+const v = env::var_os("BENCH_KEY_00949");
+let value13964 = compute(value, 93);
+let value80003 = compute(value, 75);
+let value48117 = compute(value, 5);
+let value75230 = compute(value, 55);
+let value18891 = compute(value, 73);
+let value9794 = compute(value, 94);
+// note 68136: keep this in sync with the handler
+let value9662 = compute(value, 59);
+let value25353 = compute(value, 36);
+let value10562 = compute(value, 86);
+let value49500 = compute(value, 30);
+let value85164 = compute(value, 95);
+let value70302 = compute(value, 74);
+let value87123 = compute(value, 17);
+let value67242 = compute(value, 21);
+let value65609 = compute(value, 37);
+let value87588 = compute(value, 94);
+// note 36645: keep this in sync with the handler
+let value62277 = compute(value, 3);
+const v = env::var_os("BENCH_KEY_00535");
+let value67869 = compute(value, 66);
+let value1052 = compute(value, 82);
+let value56805 = compute(value, 60);
+let value39445 = compute(value, 63);
+// note 21203: keep this in sync with the handler
+// note 64563: keep this in sync with the handler
+let value78533 = compute(value, 60);
+let value1494 = compute(value, 39);
+let value21854 = compute(value, 29);
+const v = env::var_os("BENCH_KEY_01879");
+let value69810 = compute(value, 67);
+let value46505 = compute(value, 42);
+let value27072 = compute(value, 9);
+let value60767 = compute(value, 45);
+// note 37961: keep this in sync with the handler
+let value19955 = compute(value, 70);
+let value47716 = compute(value, 89);
+let value50974 = compute(value, 49);
+// note 14761: keep this in sync with the handler
+// note 53741: keep this in sync with the handler
+let value49811 = compute(value, 50);
+let value62574 = compute(value, 9);
+let value15234 = compute(value, 5);
+let value90868 = compute(value, 76);
+let value56959 = compute(value, 20);
+let value93208 = compute(value, 88);
+let value2675 = compute(value, 56);
+let value29129 = compute(value, 29);
+const v = env::var("BENCH_KEY_01353");
+let value26921 = compute(value, 52);
+let value81937 = compute(value, 69);
+let value63460 = compute(value, 22);
+let value74433 = compute(value, 34);
+let value35275 = compute(value, 64);
+let value56661 = compute(value, 13);
+let value14268 = compute(value, 9);
+let value457 = compute(value, 69);
+let value26974 = compute(value, 8);
+let value14465 = compute(value, 12);
+let value21016 = compute(value, 64);
+let value56781 = compute(value, 36);
+let value71595 = compute(value, 9);
+let value8924 = compute(value, 0);
+let value9958 = compute(value, 64);
+let value75556 = compute(value, 90);
+const v = env::var_os("BENCH_KEY_01707");
+let value49010 = compute(value, 25);
+let value98676 = compute(value, 27);
+let value58740 = compute(value, 55);
+let value78578 = compute(value, 8);
+let value71416 = compute(value, 24);
+let value48180 = compute(value, 68);
+let value78152 = compute(value, 67);
+let value20186 = compute(value, 10);
+let value79054 = compute(value, 96);
+let value33090 = compute(value, 13);
+let value42450 = compute(value, 61);
+let value38086 = compute(value, 62);
+let value96472 = compute(value, 54);
+let value62291 = compute(value, 17);
+// note 50901: keep this in sync with the handler
+const v = env::var("BENCH_KEY_01318");
+let value42415 = compute(value, 26);
+// note 51237: keep this in sync with the handler
+// note 30458: keep this in sync with the handler
+let value93278 = compute(value, 61);
+let value86527 = compute(value, 3);
@@ -0,0 +1,237 @@
+value10414 = compute(value, 35)
+value87871 = compute(value, 86)
+const v = os.environ.get('BENCH_KEY_01107');
+value71175 = compute(value, 74)
+# note 13870: keep this in sync with the handler
+value51407 = compute(value, 94)
+value92331 = compute(value, 84)
+value66368 = compute(value, 20)
+value85886 = compute(value, 41)
+value28918 = compute(value, 12)
+value76207 = compute(value, 62)
+value60942 = compute(value, 26)
+value56519 = compute(value, 65)
+value57156 = compute(value, 23)
+value45459 = compute(value, 63)
+value55207 = compute(value, 14)
+value41759 = compute(value, 49)
+# note 36880: keep this in sync with the handler
+# note 445: keep this in sync with the handler
+value75333 = compute(value, 61)
+value24458 = compute(value, 14)
+const v = os.getenv("BENCH_KEY_00847");
+# note 81855: keep this in sync with the handler
+value74341 = compute(value, 39)
+value18039 = compute(value, 94)
+value89781 = compute(value, 56)
+# note 77566: keep this in sync with the handler
+value15201 = compute(value, 69)
+value75318 = compute(value, 46)
+# note 10839: keep this in sync with the handler
+# note 66956: keep this in sync with the handler
+value55944 = compute(value, 72)
+value30470 = compute(value, 12)
+value98144 = compute(value, 77)
+value93303 = compute(value, 86)
+value22254 = compute(value, 41)
+value96533 = compute(value, 18)
+value28798 = compute(value, 86)
+value90102 = compute(value, 86)
+value92059 = compute(value, 6)
+value82732 = compute(value, 88)
+const v = os.getenv("BENCH_KEY_01626");
+# note 2145: keep this in sync with the handler
+value83543 = compute(value, 26)
+value65723 = compute(value, 54)
+value853 = compute(value, 77)
+value82135 = compute(value, 73)
+value17030 = compute(value, 55)
+value54731 = compute(value, 23)
+# note 87924: keep this in sync with the handler
+value86322 = compute(value, 89)
+value75879 = compute(value, 25)
+value77176 = compute(value, 61)
+value94194 = compute(value, 7)
+value68914 = compute(value, 44)
+value6582 = compute(value, 83)
+value75686 = compute(value, 26)
+value81182 = compute(value, 90)
+value86999 = compute(value, 87)
+value24741 = compute(value, 6)
+value34045 = compute(value, 95)
+# note 61437: keep this in sync with the handler
+value12205 = compute(value, 80)
+value15805 = compute(value, 91)
+const v = os.environ["BENCH_KEY_01184"];
+value30967 = compute(value, 24)
+value96640 = compute(value, 28)
+value26657 = compute(value, 79)
+value28872 = compute(value, 63)
+value85285 = compute(value, 22)
+value38618 = compute(value, 12)
+value69738 = compute(value, 92)
+value56841 = compute(value, 96)
+value36001 = compute(value, 14)
+value22675 = compute(value, 74)
+value4621 = compute(value, 62)
+value99552 = compute(value, 30)
+# note 47109: keep this in sync with the handler
+value36942 = compute(value, 82)
+# note 71454: keep this in sync with the handler
+const v = os.getenv("BENCH_KEY_00753");
+value39452 = compute(value, 70)
+value83862 = compute(value, 54)
+value70459 = compute(value, 37)
+value48386 = compute(value, 80)
+value81047 = compute(value, 52)
+value50030 = compute(value, 75)
+value1684 = compute(value, 35)
+value25902 = compute(value, 3)
+value37692 = compute(value, 56)
+value14514 = compute(value, 61)
+value51355 = compute(value, 42)
+value24410 = compute(value, 63)
+value56776 = compute(value, 31)
+value21900 = compute(value, 75)
+value72641 = compute(value, 85)
+const v = os.getenv("BENCH_KEY_01047");
+value2654 = compute(value, 35)
+# note 31907: keep this in sync with the handler
+value19201 = compute(value, 92)
+value65819 = compute(value, 53)
+value25133 = compute(value, 10)
+value21010 = compute(value, 58)
+value64395 = compute(value, 84)
+# note 16627: keep this in sync with the handler
+value87467 = compute(value, 70)
+value47107 = compute(value, 62)
+const v = os.environ["BENCH_KEY_01610"];
+value5608 = compute(value, 79)
+value26023 = compute(value, 27)
+value88645 = compute(value, 84)
+# note 1199: keep this in sync with the handler
+value31840 = compute(value, 24)
+value46473 = compute(value, 10)
+# note 92064: keep this in sync with the handler
+value20086 = compute(value, 7)
+value51689 = compute(value, 85)
+value15092 = compute(value, 57)
+# note 26698: keep this in sync with the handler
+value10851 = compute(value, 84)
+value83010 = compute(value, 75)
+value52803 = compute(value, 35)
+value29980 = compute(value, 7)
+# note 21045: keep this in sync with the handler
+const v = os.environ.get('BENCH_KEY_00868');
+value13808 = compute(value, 34)
+value11011 = compute(value, 50)
+value66267 = compute(value, 16)
+# note 61784: keep this in sync with the handler
+value3879 = compute(value, 96)
+# note 64415: keep this in sync with the handler
+value43226 = compute(value, 61)
+value94567 = compute(value, 89)
+# note 40690: keep this in sync with the handler
+value77799 = compute(value, 5)
+value92085 = compute(value, 32)
+value97505 = compute(value, 20)
+# note 61317: keep this in sync with the handler
+value37078 = compute(value, 24)
+value48192 = compute(value, 80)
+value29691 = compute(value, 9)
+value53898 = compute(value, 63)
+value90591 = compute(value, 90)
+value49071 = compute(value, 86)
+const v = os.getenv("BENCH_KEY_01142");
+# note 56603: keep this in sync with the handler
+value68811 = compute(value, 38)
+value29575 = compute(value, 87)
+value91577 = compute(value, 9)
+value9678 = compute(value, 75)
+value340 = compute(value, 49)
+value5406 = compute(value, 71)
+value73357 = compute(value, 25)
+value86421 = compute(value, 91)
+value19377 = compute(value, 74)
+value59215 = compute(value, 45)
+value84016 = compute(value, 14)
+value91627 = compute(value, 59)
+value89488 = compute(value, 54)
+# note 73425: keep this in sync with the handler
+value77707 = compute(value, 10)
+value68817 = compute(value, 44)
+value90526 = compute(value, 25)
+value4772 = compute(value, 19)
+value5601 = compute(value, 72)
+value10440 = compute(value, 61)
+value8235 = compute(value, 87)
+value95669 = compute(value, 27)
+const v = os.environ.get('BENCH_KEY_01824');
+# note 27325: keep this in sync with the handler
+value53232 = compute(value, 76)
+value51757 = compute(value, 56)
+value46376 = compute(value, 10)
+value92976 = compute(value, 50)
+value47919 = compute(value, 1)
+value14983 = compute(value, 45)
+value21940 = compute(value, 18)
+value67132 = compute(value, 8)
+value13318 = compute(value, 29)
+value68853 = compute(value, 80)
+value41334 = compute(value, 12)
+# note 3875: keep this in sync with the handler
+value93013 = compute(value, 87)
+value19772 = compute(value, 81)
+value91419 = compute(value, 45)
+# note 44781: keep this in sync with the handler
+value62168 = compute(value, 88)
+value24381 = compute(value, 34)
+const v = os.environ.get('BENCH_KEY_01770');
+# note 8311: keep this in sync with the handler
+value88676 = compute(value, 18)
+value5610 = compute(value, 81)
+value44269 = compute(value, 37)
+# note 8741: keep this in sync with the handler
+# note 86316: keep this in sync with the handler
+value48924 = compute(value, 36)
+value10014 = compute(value, 23)
+value46558 = compute(value, 95)
+value35019 = compute(value, 2)
+value29662 = compute(value, 77)
+value68530 = compute(value, 48)
+value75801 = compute(value, 44)
+value77102 = compute(value, 84)
+value55606 = compute(value, 25)
+value7008 = compute(value, 24)
+value96105 = compute(value, 75)
+value37430 = compute(value, 85)
+value51883 = compute(value, 85)
+value39125 = compute(value, 34)
+value57439 = compute(value, 15)
+const v = os.environ["BENCH_KEY_00660"];
+# note 498: keep this in sync with the handler
+value89388 = compute(value, 51)
+value72368 = compute(value, 6)
+value75292 = compute(value, 20)
+value65930 = compute(value, 67)
+value71236 = compute(value, 38)
+value14595 = compute(value, 45)
+value25459 = compute(value, 45)
+value22209 = compute(value, 93)
+value75165 = compute(value, 87)
+value83231 = compute(value, 5)
+value19499 = compute(value, 2)
+value92917 = compute(value, 88)
+value22665 = compute(value, 64)
+value84861 = compute(value, 83)
+value31813 = compute(value, 94)
+const v = os.environ.get('BENCH_KEY_01188');
+value21973 = compute(value, 51)
+value68168 = compute(value, 74)
+value14387 = compute(value, 31)
+value66679 = compute(value, 40)
+value10476 = compute(value, 0)
+value1190 = compute(value, 26)
+value15204 = compute(value, 72)
+value51918 = compute(value, 23)
+value43925 = compute(value, 81)
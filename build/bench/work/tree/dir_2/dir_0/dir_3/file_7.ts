@@ -0,0 +1,204 @@
+const value20788 = compute(value, 30);
+const value67798 = compute(value, 92);
+const value35095 = compute(value, 78);
+const value56771 = compute(value, 26);
+const value75886 = compute(value, 32);
+const value25223 = compute(value, 3);
+const v = process.env["BENCH_KEY_00677"];
+const value83938 = compute(value, 33);
+// note 66912: keep this in sync with the handler
+const value64408 = compute(value, 0);
+const value37453 = compute(value, 11);
+const value8627 = compute(value, 91);
+const value36215 = compute(value, 34);
+const value87853 = compute(value, 68);
+const value70729 = compute(value, 16);
+const value74761 = compute(value, 71);
+const value94521 = compute(value, 43);
+const value13374 = compute(value, 85);
+const value18622 = compute(value, 95);
+// note 92427: keep this in sync with the handler
+// note 29429: keep this in sync with the handler
+const value63825 = compute(value, 96);
+const value54274 = compute(value, 51);
+// note 12950: keep this in sync with the handler
+// note 81643: keep this in sync with the handler
+const v = process.env.BENCH_KEY_01261;
+const value54256 = compute(value, 33);
+const value45491 = compute(value, 95);
+const value72721 = compute(value, 68);
+const value99430 = compute(value, 5);
+const value56067 = compute(value, 1);
+const value19026 = compute(value, 14);
+const value63254 = compute(value, 10);
+// note 36715: keep this in sync with the handler
+const value5318 = compute(value, 80);
+const value7040 = compute(value, 56);
+const value89006 = compute(value, 57);
+const v = import.meta.env.BENCH_KEY_01292;
+const value38888 = compute(value, 88);
+const value75294 = compute(value, 22);
+const value64626 = compute(value, 24);
+const value60207 = compute(value, 67);
+const value77335 = compute(value, 26);
+const value41333 = compute(value, 11);
+const value82891 = compute(value, 53);
+const value51389 = compute(value, 76);
+const value17397 = compute(value, 34);
+const value20728 = compute(value, 67);
+const value1177 = compute(value, 13);
+// note 25578: keep this in sync with the handler
+const value78498 = compute(value, 25);
+const value54516 = compute(value, 2);
+const value8763 = compute(value, 33);
+const value62859 = compute(value, 3);
+const v = process.env["BENCH_KEY_01858"];
+const value41339 = compute(value, 17);
+const value4297 = compute(value, 29);
+const value28471 = compute(value, 50);
+// note 90670: keep this in sync with the handler
+const value30333 = compute(value, 69);
+const value46993 = compute(value, 45);
+const value1967 = compute(value, 27);
+const value4733 = compute(value, 77);
+const v = import.meta.env.BENCH_KEY_00459;
+// note 7568: keep this in sync with the handler
+const value59366 = compute(value, 2);
+const value7387 = compute(value, 15);
+const value25189 = compute(value, 66);
+const value31369 = compute(value, 38);
+const value77627 = compute(value, 27);
+const value23003 = compute(value, 14);
+const value97968 = compute(value, 95);
+const v = process.env.BENCH_KEY_01535;
+// note 28198: keep this in sync with the handler
+const value63944 = compute(value, 21);
+const value3844 = compute(value, 61);
+const value24986 = compute(value, 57);
+// note 60125: keep this in sync with the handler
+const value57258 = compute(value, 28);
+const value85163 = compute(value, 94);
+// note 36221: keep this in sync with the handler
+const v = import.meta.env.BENCH_KEY_01490;
+const value39989 = compute(value, 25);
+const value96318 = compute(value, 94);
+const value86466 = compute(value, 39);
+// note 97194: keep this in sync with the handler
+const value21531 = compute(value, 94);
+const value14467 = compute(value, 14);
+const value1467 = compute(value, 12);
+const value11886 = compute(value, 52);
+const value43501 = compute(value, 45);
+const v = process.env.BENCH_KEY_01273;
+const value96271 = compute(value, 47);
+const value80793 = compute(value, 89);
+const value85852 = compute(value, 7);
+const value2947 = compute(value, 37);
+const value84306 = compute(value, 13);
+const value10584 = compute(value, 11);
+const value6748 = compute(value, 55);
+const value3637 = compute(value, 48);
+const value60665 = compute(value, 40);
+// note 22068: keep this in sync with the handler
+const value39975 = compute(value, 11);
+const value28319 = compute(value, 92);
+const value5192 = compute(value, 51);
+const value99388 = compute(value, 60);
+const value73524 = compute(value, 95);
+const value13706 = compute(value, 29);
+const v = process.env.BENCH_KEY_01822;
+const value53247 = compute(value, 91);
+const value72541 = compute(value, 82);
+const value80484 = compute(value, 71);
+const value42214 = compute(value, 19);
+const value2687 = compute(value, 68);
+const value75544 = compute(value, 78);
+const value76377 = compute(value, 38);
+const value25578 = compute(value, 67);
+const value27111 = compute(value, 48);
+const v = import.meta.env.BENCH_KEY_01069;
+const value84228 = compute(value, 32);
+const value24930 = compute(value, 1);
+const value24199 = compute(value, 46);
+const value99346 = compute(value, 18);
+// note 80594: keep this in sync with the handler
+const value31038 = compute(value, 95);
+const value8563 = compute(value, 27);
+const value64996 = compute(value, 6);
+// note 12534: keep this in sync with the handler
+const value96695 = compute(value, 83);
+const value63799 = compute(value, 70);
+const value46143 = compute(value, 68);
+const v = import.meta.env.BENCH_KEY_00912;
+const value97189 = compute(value, 92);
+const value81173 = compute(value, 81);
+const value95981 = compute(value, 48);
+const value41284 = compute(value, 59);
+const value22756 = compute(value, 58);
+const value41832 = compute(value, 25);
+const value43840 = compute(value, 93);
+const value8481 = compute(value, 42);
+const value95311 = compute(value, 57);
+const value43690 = compute(value, 40);
+const value94489 = compute(value, 11);
+const value65639 = compute(value, 67);
+const value24396 = compute(value, 49);
+const value47401 = compute(value, 65);
+// note 39474: keep this in sync with the handler
+const value25131 = compute(value, 8);
+const v = import.meta.env.BENCH_KEY_00552;
+// note 1306: keep this in sync with the handler
+const value17386 = compute(value, 23);
+const value42739 = compute(value, 59);
+const value52644 = compute(value, 70);
+const value84298 = compute(value, 5);
+const value12416 = compute(value, 0);
+const value33395 = compute(value, 27);
+const value99881 = compute(value, 68);
+const value37622 = compute(value, 83);
+const value47178 = compute(value, 36);
+const value76903 = compute(value, 79);
+const value64310 = compute(value, 96);
+const value62071 = compute(value, 88);
+const v = import.meta.env.BENCH_KEY_01944;
+const value62052 = compute(value, 69);
+const value62820 = compute(value, 61);
+const value98085 = compute(value, 18);
+const value96109 = compute(value, 79);
+const value45430 = compute(value, 34);
+const value39695 = compute(value, 22);
+// note 36930: keep this in sync with the handler
+// note 66614: keep this in sync with the handler
+const value89942 = compute(value, 23);
+const value94421 = compute(value, 40);
+const value38895 = compute(value, 95);
+const value91265 = compute(value, 85);
+const value85855 = compute(value, 10);
+const value65006 = compute(value, 16);
+const value8606 = compute(value, 70);
+const v = process.env.BENCH_KEY_00365;
+const value63571 = compute(value, 36);
+const value10986 = compute(value, 25);
+const value94477 = compute(value, 96);
+const value84755 = compute(value, 74);
+const value83208 = compute(value, 79);
+const value60991 = compute(value, 75);
+const value65681 = compute(value, 12);
+const value74404 = compute(value, 5);
+const value63410 = compute(value, 69);
+const v = import.meta.env.BENCH_KEY_01644;
+const value62782 = compute(value, 23);
+const value87344 = compute(value, 44);
+const value69508 = compute(value, 56);
+// note 26974: keep this in sync with the handler
+const value85288 = compute(value, 25);
+// note 45351: keep this in sync with the handler
+// note 88869: keep this in sync with the handler
+const value99529 = compute(value, 7);
+// note 70513: keep this in sync with the handler
+const value95959 = compute(value, 26);
+const value25361 = compute(value, 44);
+const value84113 = compute(value, 14);
+const value37773 = compute(value, 40);
+const v = import.meta.env.BENCH_KEY_01056;
+const value184 = compute(value, 87);
@@ -0,0 +1,206 @@
+const value93571 = compute(value, 63);
+const value36280 = compute(value, 2);
+const value28607 = compute(value, 89);
+const value88909 = compute(value, 57);
+const value5450 = compute(value, 18);
+const value84637 = compute(value, 53);
+const value414 = compute(value, 26);
+const value7109 = compute(value, 28);
+const value59282 = compute(value, 15);
+const value4225 = compute(value, 54);
+const value66371 = compute(value, 23);
+const value40541 = compute(value, 92);
+const v = import.meta.env.BENCH_KEY_01812;
+const value86596 = compute(value, 72);
+const value91636 = compute(value, 68);
+const value77407 = compute(value, 1);
+const value78806 = compute(value, 42);
+const value51833 = compute(value, 35);
+const value27089 = compute(value, 26);
+const value130 = compute(value, 33);
+const value37598 = compute(value, 59);
+const value32097 = compute(value, 87);
+const value69620 = compute(value, 71);
+const value27708 = compute(value, 63);
+const value46515 = compute(value, 52);
+const value96666 = compute(value, 54);
+const v = process.env.BENCH_KEY_00173;
+const value27479 = compute(value, 28);
+const value95307 = compute(value, 53);
+const value63992 = compute(value, 69);
+const value88496 = compute(value, 32);
+const value66068 = compute(value, 11);
+const value98639 = compute(value, 87);
+const value42504 = compute(value, 18);
+const value24141 = compute(value, 85);
+const value34269 = compute(value, 28);
+const value13971 = compute(value, 3);
+// note 16952: keep this in sync with the handler
+const v = import.meta.env.BENCH_KEY_01173;
+const value62621 = compute(value, 56);
+const value38021 = compute(value, 94);
+const value62939 = compute(value, 83);
+const value80406 = compute(value, 90);
+const value92289 = compute(value, 42);
+const value25456 = compute(value, 42);
+const value64543 = compute(value, 38);
+const value12571 = compute(value, 58);
+const value90734 = compute(value, 39);
+const v = import.meta.env.BENCH_KEY_01383;
+const value71913 = compute(value, 36);
+const value29055 = compute(value, 52);
+const value4182 = compute(value, 11);
+const value93086 = compute(value, 63);
+const value7237 = compute(value, 59);
+const value4684 = compute(value, 28);
+const value34051 = compute(value, 4);
+const value66725 = compute(value, 86);
+const value24984 = compute(value, 55);
+const value5628 = compute(value, 2);
+const value51559 = compute(value, 52);
+const value35064 = compute(value, 47);
+const v = process.env["BENCH_KEY_01579"];
+// note 84503: keep this in sync with the handler
+const value19763 = compute(value, 72);
+const value78489 = compute(value, 16);
+const value7818 = compute(value, 58);
+const value52532 = compute(value, 55);
+const value81238 = compute(value, 49);
+const value80799 = compute(value, 95);
+const value82058 = compute(value, 93);
+const value97710 = compute(value, 31);
+const value86608 = compute(value, 84);
+const v = process.env["BENCH_KEY_01968"];
+const value51341 = compute(value, 28);
+const value15726 = compute(value, 12);
+const value98830 = compute(value, 84);
+const value18161 = compute(value, 22);
+const value8375 = compute(value, 33);
+const value53604 = compute(value, 60);
+const value64864 = compute(value, 68);
+const value93068 = compute(value, 45);
+const value36965 = compute(value, 8);
+const value45782 = compute(value, 95);
+// note 32009: keep this in sync with the handler
+const value57343 = compute(value, 16);
+const value29972 = compute(value, 96);
+const value6672 = compute(value, 76);
+const v = import.meta.env.BENCH_KEY_00513;
+const value67612 = compute(value, 3);
+const value23075 = compute(value, 86);
+const value65448 = compute(value, 70);
+// note 8134: keep this in sync with the handler
+// note 94207: keep this in sync with the handler
+const value8030 = compute(value, 76);
+const value96879 = compute(value, 73);
+const value89943 = compute(value, 24);
+const value1542 = compute(value, 87);
+const value11723 = compute(value, 83);
+const value89499 = compute(value, 65);
+const value28970 = compute(value, 64);
+const value20828 = compute(value, 70);
+const value57037 = compute(value, 1);
+const value57949 = compute(value, 40);
+const v = process.env.BENCH_KEY_01277;
+const value85768 = compute(value, 20);
+const value73392 = compute(value, 60);
+const value1944 = compute(value, 4);
+const value28092 = compute(value, 59);
+const value71234 = compute(value, 36);
+const value34969 = compute(value, 49);
+const value16181 = compute(value, 79);
+const value55198 = compute(value, 5);
+const value28192 = compute(value, 62);
+const value42674 = compute(value, 91);
+const value35468 = compute(value, 63);
+const value88037 = compute(value, 58);
+const value94356 = compute(value, 72);
+// note 57029: keep this in sync with the handler
+const value83723 = compute(value, 12);
+const value68655 = compute(value, 76);
+const value15044 = compute(value, 9);
+const value32180 = compute(value, 73);
+const v = import.meta.env.BENCH_KEY_00107;
+// note 93186: keep this in sync with the handler
+// note 7422: keep this in sync with the handler
+const value25468 = compute(value, 54);
+const value53430 = compute(value, 80);
+const value54048 = compute(value, 19);
+const value66501 = compute(value, 56);
+const value7868 = compute(value, 11);
+const value78371 = compute(value, 92);
+const value9553 = compute(value, 47);
+const value86220 = compute(value, 84);
+const value1435 = compute(value, 77);
+const value4757 = compute(value, 4);
+const value9250 = compute(value, 35);
+// note 48360: keep this in sync with the handler
+const value58549 = compute(value, 58);
+const value50944 = compute(value, 19);
+const v = process.env.BENCH_KEY_00891;
+const value99053 = compute(value, 16);
+const value1769 = compute(value, 23);
+const value17315 = compute(value, 49);
+const value39590 = compute(value, 14);
+const value18761 = compute(value, 40);
+const value39046 = compute(value, 52);
+const value33956 = compute(value, 6);
+const value46636 = compute(value, 76);
+const value57633 = compute(value, 15);
+// note 82954: keep this in sync with the handler
+const v = process.env.BENCH_KEY_01794;
+const value1783 = compute(value, 37);
+const value65959 = compute(value, 96);
+// note 95555: keep this in sync with the handler
+const value11582 = compute(value, 39);
+const value21370 = compute(value, 30);
+const value37532 = compute(value, 90);
+const value66270 = compute(value, 19);
+const value68406 = compute(value, 21);
+const value65038 = compute(value, 48);
+const value38903 = compute(value, 6);
+const value95833 = compute(value, 94);
+// note 885: keep this in sync with the handler
+const value18495 = compute(value, 65);
+const value43965 = compute(value, 24);
+const value82671 = compute(value, 27);
+const value75097 = compute(value, 19);
+const value53593 = compute(value, 49);
+const v = process.env["BENCH_KEY_00463"];
+const value42697 = compute(value, 17);
+// note 9964: keep this in sync with the handler
+const value39644 = compute(value, 68);
+const value5059 = compute(value, 15);
+const value14841 = compute(value, 0);
+const value20830 = compute(value, 72);
+const value38533 = compute(value, 24);
+// note 39896: keep this in sync with the handler
+const v = import.meta.env.BENCH_KEY_00485;
+const value20975 = compute(value, 23);
+const value36734 = compute(value, 68);
+const value16004 = compute(value, 96);
+// note 67193: keep this in sync with the handler
+const value11850 = compute(value, 16);
+const value77963 = compute(value, 72);
+const value61424 = compute(value, 23);
+const value64153 = compute(value, 36);
+const value94528 = compute(value, 50);
+const value92888 = compute(value, 59);
+const value63677 = compute(value, 45);
+const value49222 = compute(value, 43);
+const value443 = compute(value, 55);
+const value42336 = compute(value, 44);
+const value19308 = compute(value, 5);
+const value30798 = compute(value, 49);
+const value41286 = compute(value, 61);
+const v = process.env["BENCH_KEY_01546"];
+const value28391 = compute(value, 67);
+const value17728 = compute(value, 74);
+const value26689 = compute(value, 14);
+const value3084 = compute(value, 77);
+const value31793 = compute(value, 74);
+const value59304 = compute(value, 37);
+const value36364 = compute(value, 86);
+const value74155 = compute(value, 47);
+// note 38596: keep this in sync with the handler
+const value84324 = compute(value, 31);
@@ -0,0 +1,205 @@
+const value3038 = compute(value, 31);
+const value89128 = compute(value, 82);
+const value78035 = compute(value, 47);
+const value19452 = compute(value, 52);
+const value72771 = compute(value, 21);
+const value67838 = compute(value, 35);
+const value74582 = compute(value, 86);
+const value10313 = compute(value, 31);
+const value60663 = compute(value, 38);
+const v = process.env.BENCH_KEY_01255;
+const value32001 = compute(value, 88);
+// note 23385: keep this in sync with the handler
+const value23769 = compute(value, 4);
+const value70963 = compute(value, 56);
+const value85964 = compute(value, 22);
+const value75632 = compute(value, 69);
+const value44601 = compute(value, 78);
+const value56890 = compute(value, 48);
+const value79955 = compute(value, 27);
+const value39864 = compute(value, 94);
+const value57851 = compute(value, 39);
+const value62657 = compute(value, 92);
+// note 14805: keep this in sync with the handler
+const value6951 = compute(value, 64);
+const v = process.env.BENCH_KEY_00911;
+// note 48358: keep this in sync with the handler
+const value47685 = compute(value, 58);
+const value5312 = compute(value, 74);
+const value91929 = compute(value, 70);
+const value3222 = compute(value, 21);
+const value9345 = compute(value, 33);
+const value88044 = compute(value, 65);
+const value75978 = compute(value, 27);
+const value54708 = compute(value, 0);
+const value93503 = compute(value, 92);
+const value34194 = compute(value, 50);
+// note 82791: keep this in sync with the handler
+const value51976 = compute(value, 81);
+const value6877 = compute(value, 87);
+const value63000 = compute(value, 47);
+const v = process.env["BENCH_KEY_00354"];
+const value19977 = compute(value, 92);
+const value68338 = compute(value, 50);
+const value31686 = compute(value, 64);
+const value5531 = compute(value, 2);
+// note 91665: keep this in sync with the handler
+const value6933 = compute(value, 46);
+const value89417 = compute(value, 80);
+const value81075 = compute(value, 80);
+const value57607 = compute(value, 86);
+const value92388 = compute(value, 44);
+const value1811 = compute(value, 65);
+const value56579 = compute(value, 28);
+const value27339 = compute(value, 82);
+const value59102 = compute(value, 29);
+// note 99: keep this in sync with the handler
+const value52864 = compute(value, 96);
+const value17641 = compute(value, 84);
+const value99964 = compute(value, 54);
+const v = process.env.BENCH_KEY_01835;
+const value47158 = compute(value, 16);
+// note 76041: keep this in sync with the handler
+const value92457 = compute(value, 16);
+const value27790 = compute(value, 48);
+const value31175 = compute(value, 38);
+const value14538 = compute(value, 85);
+const value53956 = compute(value, 24);
+const value57926 = compute(value, 17);
+// note 18895: keep this in sync with the handler
+const value15136 = compute(value, 4);
+const v = process.env["BENCH_KEY_00225"];
+const value25238 = compute(value, 18);
+// note 68264: keep this in sync with the handler
+const value96999 = compute(value, 96);
+const value22634 = compute(value, 33);
+const value34294 = compute(value, 53);
+const value71852 = compute(value, 72);
+const value23157 = compute(value, 71);
+const value62049 = compute(value, 66);
+const value66896 = compute(value, 63);
+const value1679 = compute(value, 30);
+const value42684 = compute(value, 4);
+const value61846 = compute(value, 57);
+const value39373 = compute(value, 88);
+const v = process.env.BENCH_KEY_01057;
+const value53188 = compute(value, 32);
+const value65012 = compute(value, 22);
+// note 82758: keep this in sync with the handler
+const value25130 = compute(value, 7);
+// note 56695: keep this in sync with the handler
+const value43107 = compute(value, 39);
+const value96904 = compute(value, 1);
+const value95988 = compute(value, 55);
+const v = process.env["BENCH_KEY_00185"];
+const value19778 = compute(value, 87);
+const value69901 = compute(value, 61);
+const value75260 = compute(value, 85);
+const value71001 = compute(value, 94);
+const value62555 = compute(value, 87);
+const value49997 = compute(value, 42);
+const value10506 = compute(value, 30);
+const value69858 = compute(value, 18);
+const v = import.meta.env.BENCH_KEY_00496;
+const value15449 = compute(value, 26);
+const value16914 = compute(value, 36);
+const value95904 = compute(value, 68);
+const value42260 = compute(value, 65);
+// note 95178: keep this in sync with the handler
+const value81670 = compute(value, 93);
+const value27933 = compute(value, 94);
+const value83518 = compute(value, 1);
+const value56283 = compute(value, 23);
+const value58032 = compute(value, 26);
+const value31459 = compute(value, 31);
+const v = import.meta.env.BENCH_KEY_01357;
+const value44487 = compute(value, 61);
+const value50594 = compute(value, 57);
+const value87287 = compute(value, 84);
+const value79818 = compute(value, 84);
+const value50065 = compute(value, 13);
+const value93438 = compute(value, 27);
+const value36978 = compute(value, 21);
+const value70978 = compute(value, 71);
+const v = process.env["BENCH_KEY_00048"];
+const value1155 = compute(value, 88);
+const value94683 = compute(value, 11);
+// note 65576: keep this in sync with the handler
+// note 93343: keep this in sync with the handler
+const value94375 = compute(value, 91);
+// note 55945: keep this in sync with the handler
+const value44901 = compute(value, 87);
+const value47764 = compute(value, 40);
+const v = process.env["BENCH_KEY_00437"];
+const value66472 = compute(value, 27);
+const value19114 = compute(value, 5);
+const value89815 = compute(value, 90);
+// note 4926: keep this in sync with the handler
+const value89061 = compute(value, 15);
+const value67741 = compute(value, 35);
+const value17818 = compute(value, 67);
+const value6312 = compute(value, 7);
+const value5902 = compute(value, 82);
+const value29167 = compute(value, 67);
+const value11943 = compute(value, 12);
+const value57812 = compute(value, 0);
+const value87700 = compute(value, 12);
+const value68866 = compute(value, 93);
+const v = import.meta.env.BENCH_KEY_01659;
+const value82665 = compute(value, 21);
+const value60978 = compute(value, 62);
+const value8164 = compute(value, 16);
+// note 54346: keep this in sync with the handler
+const value21127 = compute(value, 78);
+const value37787 = compute(value, 54);
+const value53906 = compute(value, 71);
+// note 61901: keep this in sync with the handler
+const value94309 = compute(value, 25);
+const value89751 = compute(value, 26);
+const value29487 = compute(value, 96);
+const value88040 = compute(value, 61);
+const value4935 = compute(value, 85);
+const value28461 = compute(value, 40);
+const value10088 = compute(value, 0);
+const value111 = compute(value, 14);
+const value14125 = compute(value, 60);
+const value70361 = compute(value, 36);
+const value86910 = compute(value, 95);
+const v = process.env["BENCH_KEY_00436"];
+const value33365 = compute(value, 94);
+const value34609 = compute(value, 77);
+const value15574 = compute(value, 54);
+const value96657 = compute(value, 45);
+const value75784 = compute(value, 27);
+const value3818 = compute(value, 35);
+const value27848 = compute(value, 9);
+const value706 = compute(value, 27);
+// note 94425: keep this in sync with the handler
+const value58679 = compute(value, 91);
+const value64173 = compute(value, 56);
+const value83340 = compute(value, 17);
+const value32000 = compute(value, 87);
+const value58730 = compute(value, 45);
+const value10306 = compute(value, 24);
+// note 84607: keep this in sync with the handler
+const v = process.env.BENCH_KEY_00206;
+const value94078 = compute(value, 85);
+const value86464 = compute(value, 37);
+const value25495 = compute(value, 81);
+const value837 = compute(value, 61);
+// note 57001: keep this in sync with the handler
+const value41467 = compute(value, 48);
+const value23157 = compute(value, 71);
+const value14050 = compute(value, 82);
+const v = process.env.BENCH_KEY_01542;
+const value32297 = compute(value, 93);
+const value75456 = compute(value, 87);
+const value62728 = compute(value, 66);
+const value39567 = compute(value, 88);
+const value67767 = compute(value, 61);
+const value87925 = compute(value, 43);
+const value828 = compute(value, 52);
+const value23554 = compute(value, 80);
+const value82569 = compute(value, 22);
+const value60137 = compute(value, 94);
+const value38320 = compute(value, 5);
@@ -0,0 +1,232 @@
+value12824 := compute(value, 20)
+value89344 := compute(value, 7)
+value88548 := compute(value, 84)
+value72381 := compute(value, 19)
+value66235 := compute(value, 81)
+value6127 := compute(value, 16)
+value62401 := compute(value, 30)
+value89456 := compute(value, 22)
+value16998 := compute(value, 23)
+value23284 := compute(value, 4)
+value97478 := compute(value, 90)
+value30000 := compute(value, 27)
+value79848 := compute(value, 17)
+value6674 := compute(value, 78)
+const v = os.LookupEnv("BENCH_KEY_00457");
+value33123 := compute(value, 46)
+value29243 := compute(value, 46)
+value7409 := compute(value, 37)
+value70225 := compute(value, 94)
+value68340 := compute(value, 52)
+// note 41115: keep this in sync with the handler
+value69610 := compute(value, 61)
+value35476 := compute(value, 71)
+value48792 := compute(value, 1)
+// note 77518: keep this in sync with the handler
+value33261 := compute(value, 87)
+value56663 := compute(value, 15)
+value49251 := compute(value, 72)
+value73601 := compute(value, 75)
+value75475 := compute(value, 9)
+value71615 := compute(value, 29)
+value93666 := compute(value, 61)
+// note 86976: keep this in sync with the handler
+value66643 := compute(value, 4)
+const v = os.LookupEnv("BENCH_KEY_01193");
+value38672 := compute(value, 66)
+value55807 := compute(value, 32)
+value25304 := compute(value, 84)
+value79387 := compute(value, 41)
+value84068 := compute(value, 66)
+value4777 := compute(value, 24)
+value94889 := compute(value, 23)
+value70389 := compute(value, 64)
+value67200 := compute(value, 76)
+value52330 := compute(value, 47)
+const v = os.Getenv("BENCH_KEY_01037");
+value74078 := compute(value, 67)
+// note 21490: keep this in sync with the handler
+value44564 := compute(value, 41)
+value31581 := compute(value, 56)
+value74597 := compute(value, 4)
+value45847 := compute(value, 63)
+value23075 := compute(value, 86)
+// note 22995: keep this in sync with the handler
+const v = os.LookupEnv("BENCH_KEY_01404");
+value96980 := compute(value, 77)
+value86067 := compute(value, 28)
+value86800 := compute(value, 82)
+value18570 := compute(value, 43)
+// note 374: keep this in sync with the handler
+value17187 := compute(value, 18)
+value15537 := compute(value, 17)
+value5104 := compute(value, 60)
+value73803 := compute(value, 83)
+value49141 := compute(value, 59)
+value3899 := compute(value, 19)
+value61975 := compute(value, 89)
+value77967 := compute(value, 76)
+value66263 := compute(value, 12)
+const v = os.Getenv("BENCH_KEY_01023");
+value28178 := compute(value, 48)
+value27255 := compute(value, 95)
+value60977 := compute(value, 61)
+// note 42470: keep this in sync with the handler
+// note 78610: keep this in sync with the handler
+value62915 := compute(value, 59)
+value88700 := compute(value, 42)
+value47512 := compute(value, 79)
+value61883 := compute(value, 94)
+value45732 := compute(value, 45)
+const v = os.LookupEnv("BENCH_KEY_00807");
+value41204 := compute(value, 76)
+value62355 := compute(value, 81)
+// note 25269: keep this in sync with the handler
+value16915 := compute(value, 37)
+value89273 := compute(value, 33)
+value84900 := compute(value, 25)
+value48346 := compute(value, 40)
+value1564 := compute(value, 12)
+value95900 := compute(value, 64)
+value28110 := compute(value, 77)
+value87178 := compute(value, 72)
+value96300 := compute(value, 76)
+value30357 := compute(value, 93)
+value34520 := compute(value, 85)
+value42980 := compute(value, 9)
+value53873 := compute(value, 38)
+value45286 := compute(value, 84)
+value76295 := compute(value, 53)
+value74555 := compute(value, 59)
+value96123 := compute(value, 93)
+const v = os.Getenv("BENCH_KEY_01124");
+value96864 := compute(value, 58)
+value20649 := compute(value, 85)
+// note 97160: keep this in sync with the handler
+value49336 := compute(value, 60)
+value51187 := compute(value, 68)
+// note 19859: keep this in sync with the handler
+value39858 := compute(value, 88)
+value90280 := compute(value, 70)
+value86577 := compute(value, 53)
+const v = os.Getenv("BENCH_KEY_00409");
+value84210 := compute(value, 14)
+value12475 := compute(value, 59)
+value2493 := compute(value, 68)
+value5222 := compute(value, 81)
+// note 45410: keep this in sync with the handler
+value61174 := compute(value, 64)
+value45337 := compute(value, 38)
+value51109 := compute(value, 87)
+value78765 := compute(value, 1)
+value9487 := compute(value, 78)
+value43723 := compute(value, 73)
+value95626 := compute(value, 81)
+value73703 := compute(value, 80)
+value12751 := compute(value, 44)
+value96315 := compute(value, 91)
+value27804 := compute(value, 62)
+value54151 := compute(value, 25)
+// note 98130: keep this in sync with the handler
+value30833 := compute(value, 84)
+value26123 := compute(value, 30)
+// note 11799: keep this in sync with the handler
+const v = os.Getenv("BENCH_KEY_01419");
+value72447 := compute(value, 85)
+value49202 := compute(value, 23)
+value6803 := compute(value, 13)
+// note 59496: keep this in sync with the handler
+value64754 := compute(value, 55)
+value7125 := compute(value, 44)
+value45253 := compute(value, 51)
+value72221 := compute(value, 53)
+value53470 := compute(value, 23)
+value48724 := compute(value, 30)
+value2890 := compute(value, 77)
+// note 97282: keep this in sync with the handler
+value21630 := compute(value, 96)
+value68142 := compute(value, 48)
+value66465 := compute(value, 20)
+value74681 := compute(value, 88)
+value72762 := compute(value, 12)
+const v = os.Getenv("BENCH_KEY_00807");
+value61650 := compute(value, 55)
+value62624 := compute(value, 59)
+value83568 := compute(value, 51)
+value49120 := compute(value, 38)
+value9475 := compute(value, 66)
+value31538 := compute(value, 13)
+value72065 := compute(value, 91)
+value7492 := compute(value, 23)
+value172 := compute(value, 75)
+// note 468: keep this in sync with the handler
+value93453 := compute(value, 42)
+value54065 := compute(value, 36)
+value29566 := compute(value, 78)
+value11029 := compute(value, 68)
+value40018 := compute(value, 54)
+const v = os.LookupEnv("BENCH_KEY_00807");
+value53536 := compute(value, 89)
+value56952 := compute(value, 13)
+value40543 := compute(value, 94)
+value69587 := compute(value, 38)
+value38368 := compute(value, 53)
+value23447 := compute(value, 70)
+value32572 := compute(value, 77)
+value78339 := compute(value, 60)
+// note 52384: keep this in sync with the handler
+value78114 := compute(value, 29)
+// note 15156: keep this in sync with the handler
+// note 99269: keep this in sync with the handler
+value99005 := compute(value, 65)
+value31022 := compute(value, 79)
+value72329 := compute(value, 64)
+const v = os.LookupEnv("BENCH_KEY_00158");
+value16052 := compute(value, 47)
+value42742 := compute(value, 62)
+value29548 := compute(value, 60)
+value77879 := compute(value, 85)
+value98727 := compute(value, 78)
+value17904 := compute(value, 56)
+value4336 := compute(value, 68)
+value22248 := compute(value, 35)
+value16644 := compute(value, 57)
+const v = os.LookupEnv("BENCH_KEY_00868");
+// note 52298: keep this in sync with the handler
+value89484 := compute(value, 50)
+value50624 := compute(value, 87)
+value22286 := compute(value, 73)
+value19139 := compute(value, 30)
+value24632 := compute(value, 91)
+value10999 := compute(value, 38)
+// note 82217: keep this in sync with the handler
+value37260 := compute(value, 12)
+value44649 := compute(value, 29)
+// note 18977: keep this in sync with the handler
+value7866 := compute(value, 9)
+const v = os.LookupEnv("BENCH_KEY_01683");
+value24649 := compute(value, 11)
+value70186 := compute(value, 55)
+// note 18707: keep this in sync with the handler
+// note 82135: keep this in sync with the handler
+value37364 := compute(value, 19)
+value58701 := compute(value, 16)
+value8002 := compute(value, 48)
+value86517 := compute(value, 90)
+value66598 := compute(value, 56)
+const v = os.Getenv("BENCH_KEY_00957");
+value79533 := compute(value, 90)
+value195 := compute(value, 1)
+value22079 := compute(value, 60)
+value60919 := compute(value, 3)
+value20340 := compute(value, 67)
+value3676 := compute(value, 87)
+// note 95434: keep this in sync with the handler
+value36386 := compute(value, 11)
+const v = os.Getenv("BENCH_KEY_00466");
+value22069 := compute(value, 50)
+value72437 := compute(value, 75)
+value31815 := compute(value, 96)
+value41786 := compute(value, 76)
+value42160 := compute(value, 62)
+value72365 := compute(value, 3)
@@ -0,0 +1,207 @@
+const value11671 = compute(value, 31);
+const value75422 = compute(value, 53);
+const value61066 = compute(value, 53);
+const value9331 = compute(value, 19);
+const value70889 = compute(value, 79);
+const value64798 = compute(value, 2);
+const value86910 = compute(value, 95);
+const value93982 = compute(value, 86);
+const value91696 = compute(value, 31);
+const value52943 = compute(value, 78);
+const v = process.env.BENCH_KEY_00150;
+const value19596 = compute(value, 2);
+const value64634 = compute(value, 32);
+const value8853 = compute(value, 26);
+const value70185 = compute(value, 54);
+const value84816 = compute(value, 38);
+const value14605 = compute(value, 55);
+const value34427 = compute(value, 89);
+const value65282 = compute(value, 1);
+const v = process.env.BENCH_KEY_01185;
+const value13800 = compute(value, 26);
+const value12853 = compute(value, 49);
+const value37438 = compute(value, 93);
+const value83293 = compute(value, 67);
+const value18644 = compute(value, 20);
+const value86553 = compute(value, 29);
+const value31517 = compute(value, 89);
+const value58348 = compute(value, 51);
+const value84505 = compute(value, 18);
+const v = import.meta.env.BENCH_KEY_01707;
+// note 39796: keep this in sync with the handler
+const value32298 = compute(value, 94);
+const value60414 = compute(value, 80);
+const value78972 = compute(value, 14);
+const value92346 = compute(value, 2);
+const value69276 = compute(value, 18);
+const value87331 = compute(value, 31);
+const v = process.env["BENCH_KEY_01070"];
+const value49935 = compute(value, 77);
+const value24947 = compute(value, 18);
+// note 38432: keep this in sync with the handler
+const value67159 = compute(value, 35);
+// note 89241: keep this in sync with the handler
+const value62154 = compute(value, 74);
+const value30816 = compute(value, 67);
+const v = process.env["BENCH_KEY_00372"];
+const value45580 = compute(value, 87);
+const value48064 = compute(value, 49);
+const value31161 = compute(value, 24);
+// note 93274: keep this in sync with the handler
+const value61860 = compute(value, 71);
+const value74955 = compute(value, 71);
+// note 70271: keep this in sync with the handler
+// note 99954: keep this in sync with the handler
+const value55539 = compute(value, 55);
+const value17483 = compute(value, 23);
+const value23468 = compute(value, 91);
+const value35313 = compute(value, 5);
+const value43112 = compute(value, 44);
+const v = process.env.BENCH_KEY_01914;
+const value14630 = compute(value, 80);
+const value10498 = compute(value, 22);
+const value92694 = compute(value, 59);
+const value64232 = compute(value, 18);
+const value15207 = compute(value, 75);
+const value38755 = compute(value, 52);
+const value86113 = compute(value, 74);
+const value51029 = compute(value, 7);
+const value20804 = compute(value, 46);
+const value56677 = compute(value, 29);
+const value2615 = compute(value, 93);
+const value19814 = compute(value, 26);
+const value74482 = compute(value, 83);
+const value73866 = compute(value, 49);
+const value58504 = compute(value, 13);
+const v = process.env.BENCH_KEY_01550;
+const value66208 = compute(value, 54);
+const value44617 = compute(value, 94);
+const value97127 = compute(value, 30);
+const value39636 = compute(value, 60);
+const value57928 = compute(value, 19);
+const value68833 = compute(value, 60);
+const value74527 = compute(value, 31);
+const value63865 = compute(value, 39);
+const value36938 = compute(value, 78);
+const value99861 = compute(value, 48);
+const value42924 = compute(value, 50);
+const value59314 = compute(value, 47);
+const value34734 = compute(value, 8);
+const v = import.meta.env.BENCH_KEY_00606;
+const value61430 = compute(value, 29);
+const value81798 = compute(value, 27);
+const value26927 = compute(value, 58);
+const value77530 = compute(value, 27);
+const value89787 = compute(value, 62);
+const value60485 = compute(value, 54);
+const value58502 = compute(value, 11);
+const value73231 = compute(value, 93);
+const value30799 = compute(value, 50);
+const value10381 = compute(value, 2);
+const value42352 = compute(value, 60);
+// note 90393: keep this in sync with the handler
+const value65456 = compute(value, 78);
+const value54180 = compute(value, 54);
+const value70294 = compute(value, 66);
+const value56304 = compute(value, 44);
+const value32677 = compute(value, 85);
+const value93291 = compute(value, 74);
+const v = process.env["BENCH_KEY_00770"];
+const value37278 = compute(value, 30);
+const value2826 = compute(value, 13);
+const value23814 = compute(value, 49);
+const value83121 = compute(value, 89);
+const value62005 = compute(value, 22);
+const value30695 = compute(value, 43);
+const value28352 = compute(value, 28);
+const value75606 = compute(value, 43);
+const value59926 = compute(value, 77);
+const value97564 = compute(value, 79);
+const value37074 = compute(value, 20);
+const value65603 = compute(value, 31);
+const v = process.env.BENCH_KEY_01972;
+const value36065 = compute(value, 78);
+const value76271 = compute(value, 29);
+const value62692 = compute(value, 30);
+const value19814 = compute(value, 26);
+const value86528 = compute(value, 4);
+const value1972 = compute(value, 32);
+const value8156 = compute(value, 8);
+const value19569 = compute(value, 72);
+const value83386 = compute(value, 63);
+const value75969 = compute(value, 18);
+const value7847 = compute(value, 87);
+// note 17089: keep this in sync with the handler
+const value60743 = compute(value, 21);
+const value53563 = compute(value, 19);
+const value86023 = compute(value, 81);
+const v = process.env.BENCH_KEY_00478;
+const value90702 = compute(value, 7);
+const value48025 = compute(value, 10);
+// note 88278: keep this in sync with the handler
+// note 47416: keep this in sync with the handler
+const value71059 = compute(value, 55);
+const value64952 = compute(value, 59);
+const value27509 = compute(value, 58);
+const value81120 = compute(value, 28);
+const value23676 = compute(value, 8);
+const value48028 = compute(value, 13);
+const value31010 = compute(value, 67);
+const value58690 = compute(value, 5);
+const value82918 = compute(value, 80);
+const value55241 = compute(value, 48);
+const value94573 = compute(value, 95);
+const value97486 = compute(value, 1);
+const v = process.env.BENCH_KEY_00387;
+const value71861 = compute(value, 81);
+const value77163 = compute(value, 48);
+const value10352 = compute(value, 70);
+const value19116 = compute(value, 7);
+const value30303 = compute(value, 39);
+const value18904 = compute(value, 86);
+const value38821 = compute(value, 21);
+const value4993 = compute(value, 46);
+const value57981 = compute(value, 72);
+// note 31606: keep this in sync with the handler
+const value46781 = compute(value, 27);
+const value27844 = compute(value, 5);
+const v = process.env["BENCH_KEY_01184"];
+const value69649 = compute(value, 3);
+const value69801 = compute(value, 58);
+const value47706 = compute(value, 79);
+const value9800 = compute(value, 3);
+const value96670 = compute(value, 58);
+const value69525 = compute(value, 73);
+const value99279 = compute(value, 48);
+const value10342 = compute(value, 60);
+const value61855 = compute(value, 66);
+const value93041 = compute(value, 18);
+const v = process.env["BENCH_KEY_00543"];
+const value61300 = compute(value, 93);
+const value18246 = compute(value, 10);
+// note 25973: keep this in sync with the handler
+const value41683 = compute(value, 70);
+const value54876 = compute(value, 71);
+const value57939 = compute(value, 30);
+const value85862 = compute(value, 17);
+const value79196 = compute(value, 44);
+// note 6250: keep this in sync with the handler
+const value61542 = compute(value, 44);
+const value57363 = compute(value, 36);
+const value39312 = compute(value, 27);
+const value78740 = compute(value, 73);
+const value27576 = compute(value, 28);
+const v = process.env["BENCH_KEY_01218"];
+const value69776 = compute(value, 33);
+const value47478 = compute(value, 45);
+const value5225 = compute(value, 84);
+const value21450 = compute(value, 13);
+const value95075 = compute(value, 15);
+const value9258 = compute(value, 43);
+const value61785 = compute(value, 93);
+const value93160 = compute(value, 40);
+const value12635 = compute(value, 25);
+const value65950 = compute(value, 87);
+const value60995 = compute(value, 79);
+const value32168 = compute(value, 61);
+const value16262 = compute(value, 63);
@@ -0,0 +1,240 @@
+value70746 = compute(value, 33)
+value41385 = compute(value, 63)
+value81254 = compute(value, 65)
+# note 82390: keep this in sync with the handler
+value43383 = compute(value, 24)
+value85177 = compute(value, 11)
+value25807 = compute(value, 5)
+value69698 = compute(value, 52)
+value29698 = compute(value, 16)
+const v = os.environ["BENCH_KEY_00963"];
+value61219 = compute(value, 12)
+value45518 = compute(value, 25)
+value22435 = compute(value, 28)
+value94553 = compute(value, 75)
+value15365 = compute(value, 39)
+value50723 = compute(value, 89)
+value41476 = compute(value, 57)
+value37815 = compute(value, 82)
+value70259 = compute(value, 31)
+value31488 = compute(value, 60)
+value92718 = compute(value, 83)
+const v = os.environ.get('BENCH_KEY_01055');
+value36704 = compute(value, 38)
+# note 25836: keep this in sync with the handler
+value94041 = compute(value, 48)
+# note 50175: keep this in sync with the handler
+value45823 = compute(value, 39)
+value71512 = compute(value, 23)
+value58259 = compute(value, 59)
+value88797 = compute(value, 42)
+value89221 = compute(value, 78)
+value77056 = compute(value, 38)
+value29020 = compute(value, 17)
+value38356 = compute(value, 41)
+value51884 = compute(value, 86)
+value86014 = compute(value, 72)
+value54429 = compute(value, 12)
+value34665 = compute(value, 36)
+# note 40424: keep this in sync with the handler
+const v = os.environ.get('BENCH_KEY_01714');
+value4135 = compute(value, 61)
+value67659 = compute(value, 50)
+value10866 = compute(value, 2)
+value88020 = compute(value, 41)
+value23162 = compute(value, 76)
+value65605 = compute(value, 33)
+value46730 = compute(value, 73)
+value1374 = compute(value, 16)
+value68052 = compute(value, 55)
+value59680 = compute(value, 25)
+value10079 = compute(value, 88)
+value39924 = compute(value, 57)
+value36804 = compute(value, 41)
+value56726 = compute(value, 78)
+value46652 = compute(value, 92)
+value12718 = compute(value, 11)
+value52252 = compute(value, 66)
+const v = os.getenv("BENCH_KEY_01812");
+value63989 = compute(value, 66)
+value61201 = compute(value, 91)
+# note 49098: keep this in sync with the handler
+value86821 = compute(value, 6)
+# note 4656: keep this in sync with the handler
+value80021 = compute(value, 93)
+# note 19992: keep this in sync with the handler
+value25563 = compute(value, 52)
+value91068 = compute(value, 82)
+value10940 = compute(value, 76)
+value1917 = compute(value, 74)
+value98839 = compute(value, 93)
+value8616 = compute(value, 80)
+value92045 = compute(value, 89)
+value62844 = compute(value, 85)
+value29875 = compute(value, 96)
+value54960 = compute(value, 58)
+const v = os.environ.get('BENCH_KEY_00863');
+value17003 = compute(value, 28)
+value94586 = compute(value, 11)
+value51909 = compute(value, 14)
+value31211 = compute(value, 74)
+value12274 = compute(value, 52)
+value58244 = compute(value, 44)
+value71139 = compute(value, 38)
+value51586 = compute(value, 79)
+value7742 = compute(value, 79)
+value14305 = compute(value, 46)
+value21749 = compute(value, 21)
+const v = os.getenv("BENCH_KEY_01524");
+value3477 = compute(value, 82)
+value77053 = compute(value, 35)
+value8663 = compute(value, 30)
+value8732 = compute(value, 2)
+value10112 = compute(value, 24)
+value15941 = compute(value, 33)
+value72188 = compute(value, 20)
+value42803 = compute(value, 26)
+value98862 = compute(value, 19)
+value90733 = compute(value, 38)
+value8154 = compute(value, 6)
+value36832 = compute(value, 69)
+value54760 = compute(value, 52)
+value38616 = compute(value, 10)
+value32682 = compute(value, 90)
+# note 14675: keep this in sync with the handler
+value90267 = compute(value, 57)
+value99444 = compute(value, 19)
+value51116 = compute(value, 94)
+value9519 = compute(value, 13)
+value27165 = compute(value, 5)
+value66922 = compute(value, 89)
+value66092 = compute(value, 35)
+const v = os.getenv("BENCH_KEY_00712");
+value88335 = compute(value, 65)
+value4126 = compute(value, 52)
+value46214 = compute(value, 42)
+value96590 = compute(value, 75)
+value59394 = compute(value, 30)
+value85717 = compute(value, 66)
+value39988 = compute(value, 24)
+value96874 = compute(value, 68)
+value66794 = compute(value, 58)
+value34385 = compute(value, 47)
+value35485 = compute(value, 80)
+value71495 = compute(value, 6)
+value70437 = compute(value, 15)
+value48487 = compute(value, 84)
+# note 25725: keep this in sync with the handler
+value61944 = compute(value, 58)
+value99969 = compute(value, 59)
+value50410 = compute(value, 67)
+value29296 = compute(value, 2)
+value9906 = compute(value, 12)
+const v = os.environ["BENCH_KEY_01095"];
+# note 93433: keep this in sync with the handler
+value12981 = compute(value, 80)
+value89154 = compute(value, 11)
+value19914 = compute(value, 29)
+value42097 = compute(value, 96)
+value75958 = compute(value, 7)
+value36142 = compute(value, 58)
+value48479 = compute(value, 76)
+value76399 = compute(value, 60)
+const v = os.environ.get('BENCH_KEY_00166');
+value15728 = compute(value, 14)
+# note 93889: keep this in sync with the handler
+value82974 = compute(value, 39)
+value23864 = compute(value, 2)
+value32525 = compute(value, 30)
+value77037 = compute(value, 19)
+# note 67375: keep this in sync with the handler
+value10401 = compute(value, 22)
+# note 81430: keep this in sync with the handler
+value78381 = compute(value, 5)
+value26037 = compute(value, 41)
+value28926 = compute(value, 20)
+value62412 = compute(value, 41)
+value53022 = compute(value, 60)
+const v = os.environ["BENCH_KEY_00460"];
+# note 53895: keep this in sync with the handler
+value62442 = compute(value, 71)
+value37999 = compute(value, 72)
+# note 87172: keep this in sync with the handler
+value99170 = compute(value, 36)
+value7097 = compute(value, 16)
+value35771 = compute(value, 75)
+value17022 = compute(value, 47)
+value94114 = compute(value, 24)
+value40725 = compute(value, 82)
+value87478 = compute(value, 81)
+value72695 = compute(value, 42)
+value20705 = compute(value, 44)
+value36452 = compute(value, 77)
+# note 28513: keep this in sync with the handler
+value27090 = compute(value, 27)
+value56590 = compute(value, 39)
+value26416 = compute(value, 32)
+value45046 = compute(value, 38)
+const v = os.environ["BENCH_KEY_00445"];
+value25892 = compute(value, 90)
+# note 32139: keep this in sync with the handler
+value76444 = compute(value, 8)
+value76889 = compute(value, 65)
+value73798 = compute(value, 78)
+value82004 = compute(value, 39)
+value90739 = compute(value, 44)
+# note 30809: keep this in sync with the handler
+value93407 = compute(value, 93)
+value92241 = compute(value, 91)
+value36894 = compute(value, 34)
+value62032 = compute(value, 49)
+value14534 = compute(value, 81)
+value30847 = compute(value, 1)
+value6450 = compute(value, 48)
+value23126 = compute(value, 40)
+value25814 = compute(value, 12)
+value70820 = compute(value, 10)
+value83548 = compute(value, 31)
+# note 47873: keep this in sync with the handler
+const v = os.environ.get('BENCH_KEY_01061');
+value98031 = compute(value, 61)
+# note 53613: keep this in sync with the handler
+value98651 = compute(value, 2)
+value69414 = compute(value, 59)
+value66772 = compute(value, 36)
+value84546 = compute(value, 59)
+value18678 = compute(value, 54)
+value48371 = compute(value, 65)
+value64702 = compute(value, 3)
+# note 28468: keep this in sync with the handler
+# note 96391: keep this in sync with the handler
+value88304 = compute(value, 34)
+# note 97504: keep this in sync with the handler
+value30795 = compute(value, 46)
+value37725 = compute(value, 89)
+value13425 = compute(value, 39)
+value17913 = compute(value, 65)
+const v = os.environ.get('BENCH_KEY_01331');
+value27219 = compute(value, 59)
+value11452 = compute(value, 6)
+value22878 = compute(value, 83)
+value65367 = compute(value, 86)
+value24046 = compute(value, 87)
+value60039 = compute(value, 93)
+value50538 = compute(value, 1)
+value83934 = compute(value, 29)
+value15552 = compute(value, 32)
+value47552 = compute(value, 22)
+value10264 = compute(value, 79)
+value94610 = compute(value, 35)
+value93191 = compute(value, 71)
+const v = os.environ["BENCH_KEY_01505"];
+# note 25848: keep this in sync with the handler
+value64132 = compute(value, 15)
+value47128 = compute(value, 83)
+value70648 = compute(value, 32)
+# note 36928: keep this in sync with the handler
+value44925 = compute(value, 14)
+value28792 = compute(value, 80)
+value74208 = compute(value, 3)
+value90797 = compute(value, 5)
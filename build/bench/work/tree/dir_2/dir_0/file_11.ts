@@ -0,0 +1,204 @@
+const value59225 = compute(value, 55);
+const value54004 = compute(value, 72);
+const value31503 = compute(value, 75);
+const value31429 = compute(value, 1);
+// note 87772: keep this in sync with the handler
+const value26084 = compute(value, 88);
+// note 90370: keep this in sync with the handler
+const v = import.meta.env.BENCH_KEY_01269;
+const value31766 = compute(value, 47);
+const value83341 = compute(value, 18);
+const value33224 = compute(value, 50);
+const value28814 = compute(value, 5);
+// note 29991: keep this in sync with the handler
+// note 92085: keep this in sync with the handler
+const value43242 = compute(value, 77);
+const value62279 = compute(value, 5);
+const value9878 = compute(value, 81);
+const value51855 = compute(value, 57);
+const value5658 = compute(value, 32);
+const value68506 = compute(value, 24);
+const value74240 = compute(value, 35);
+const value4244 = compute(value, 73);
+const value4829 = compute(value, 76);
+const value19413 = compute(value, 13);
+const v = process.env["BENCH_KEY_00950"];
+const value18848 = compute(value, 30);
+const value63957 = compute(value, 34);
+const value83959 = compute(value, 54);
+const value94126 = compute(value, 36);
+const value6975 = compute(value, 88);
+const value10768 = compute(value, 1);
+const value41022 = compute(value, 88);
+const value79880 = compute(value, 49);
+const value89028 = compute(value, 79);
+const value55597 = compute(value, 16);
+const value19968 = compute(value, 83);
+const v = import.meta.env.BENCH_KEY_01610;
+const value21405 = compute(value, 65);
+const value71989 = compute(value, 15);
+const value29443 = compute(value, 52);
+const value84361 = compute(value, 68);
+const value60484 = compute(value, 53);
+const value89724 = compute(value, 96);
+const value26516 = compute(value, 35);
+const value70394 = compute(value, 69);
+const v = import.meta.env.BENCH_KEY_01337;
+const value85046 = compute(value, 74);
+const value74834 = compute(value, 47);
+const value3794 = compute(value, 11);
+const value50109 = compute(value, 57);
+const value88508 = compute(value, 44);
+const value6388 = compute(value, 83);
+const value15903 = compute(value, 92);
+const value24826 = compute(value, 91);
+const v = import.meta.env.BENCH_KEY_01790;
+const value52778 = compute(value, 10);
+const value46049 = compute(value, 71);
+// note 36214: keep this in sync with the handler
+const value31770 = compute(value, 51);
+// note 25674: keep this in sync with the handler
+const value90958 = compute(value, 69);
+// note 55609: keep this in sync with the handler
+const value46020 = compute(value, 42);
+const value10150 = compute(value, 62);
+const value39490 = compute(value, 11);
+const value65055 = compute(value, 65);
+const value12498 = compute(value, 82);
+const value74215 = compute(value, 10);
+const value73232 = compute(value, 94);
+const v = process.env.BENCH_KEY_01112;
+const value16744 = compute(value, 60);
+const value40692 = compute(value, 49);
+const value9031 = compute(value, 10);
+const value1654 = compute(value, 5);
+const value88755 = compute(value, 0);
+const value74900 = compute(value, 16);
+const value92166 = compute(value, 16);
+const value5961 = compute(value, 44);
+const value84928 = compute(value, 53);
+const value84485 = compute(value, 95);
+const value55042 = compute(value, 43);
+const v = import.meta.env.BENCH_KEY_00991;
+// note 52645: keep this in sync with the handler
+const value64847 = compute(value, 51);
+const value37233 = compute(value, 82);
+const value1134 = compute(value, 67);
+const value62821 = compute(value, 62);
+// note 57047: keep this in sync with the handler
+// note 56672: keep this in sync with the handler
+const value51706 = compute(value, 5);
+const value34647 = compute(value, 18);
+const value52188 = compute(value, 2);
+const value16140 = compute(value, 38);
+const value50487 = compute(value, 47);
+const value24948 = compute(value, 19);
+const value84117 = compute(value, 18);
+const value1648 = compute(value, 96);
+const v = process.env.BENCH_KEY_01176;
+const value57672 = compute(value, 54);
+// note 76385: keep this in sync with the handler
+// note 26900: keep this in sync with the handler
+const value23979 = compute(value, 20);
+const value66967 = compute(value, 37);
+const value37225 = compute(value, 74);
+const value3825 = compute(value, 42);
+const value3217 = compute(value, 16);
+const value90829 = compute(value, 37);
+const value59868 = compute(value, 19);
+const value74334 = compute(value, 32);
+const value21369 = compute(value, 29);
+const value23509 = compute(value, 35);
+const value82975 = compute(value, 40);
+const value48808 = compute(value, 17);
+const v = process.env.BENCH_KEY_01468;
+const value40696 = compute(value, 53);
+const value45729 = compute(value, 42);
+const value98541 = compute(value, 86);
+const value81170 = compute(value, 78);
+const value4051 = compute(value, 74);
+const value73730 = compute(value, 10);
+const value94750 = compute(value, 78);
+// note 76556: keep this in sync with the handler
+const value23329 = compute(value, 49);
+const value54968 = compute(value, 66);
+const v = import.meta.env.BENCH_KEY_00526;
+const value16813 = compute(value, 32);
+const value15289 = compute(value, 60);
+const value65921 = compute(value, 58);
+const value23514 = compute(value, 40);
+const value79016 = compute(value, 58);
+// note 60605: keep this in sync with the handler
+const value9356 = compute(value, 44);
+const value21672 = compute(value, 41);
+const value15366 = compute(value, 40);
+const value46402 = compute(value, 36);
+const value85344 = compute(value, 81);
+const value91397 = compute(value, 23);
+const value64335 = compute(value, 24);
+const value61498 = compute(value, 0);
+const v = import.meta.env.BENCH_KEY_01192;
+const value48427 = compute(value, 24);
+const value84521 = compute(value, 34);
+const value63066 = compute(value, 16);
+const value2731 = compute(value, 15);
+// note 60541: keep this in sync with the handler
+const value75377 = compute(value, 8);
+const value41567 = compute(value, 51);
+const value41531 = compute(value, 15);
+const value73267 = compute(value, 32);
+const value26998 = compute(value, 32);
+const value40717 = compute(value, 74);
+const value9854 = compute(value, 57);
+const value52151 = compute(value, 62);
+const value80942 = compute(value, 44);
+const value76720 = compute(value, 90);
+const value93297 = compute(value, 80);
+const value3922 = compute(value, 42);
+const value90337 = compute(value, 30);
+const value32391 = compute(value, 90);
+const v = import.meta.env.BENCH_KEY_01789;
+const value73280 = compute(value, 45);
+// note 12440: keep this in sync with the handler
+const value86003 = compute(value, 61);
+const value39651 = compute(value, 75);
+const value81571 = compute(value, 91);
+const value96112 = compute(value, 82);
+const value17758 = compute(value, 7);
+const value9259 = compute(value, 44);
+const value87082 = compute(value, 73);
+const v = process.env["BENCH_KEY_00426"];
+const value16315 = compute(value, 19);
+// note 18690: keep this in sync with the handler
+const value97719 = compute(value, 40);
+// note 33124: keep this in sync with the handler
+const value95960 = compute(value, 27);
+const value49658 = compute(value, 91);
+const value36234 = compute(value, 53);
+const value15321 = compute(value, 92);
+const v = import.meta.env.BENCH_KEY_00719;
+// note 58336: keep this in sync with the handler
+const value44864 = compute(value, 50);
+const value28491 = compute(value, 70);
+const value28819 = compute(value, 10);
+const value88544 = compute(value, 80);
+const value65358 = compute(value, 77);
+const value19479 = compute(value, 79);
+const value93 = compute(value, 93);
+const value29577 = compute(value, 89);
+// note 43189: keep this in sync with the handler
+const value71955 = compute(value, 78);
+// note 31327: keep this in sync with the handler
+const value64533 = compute(value, 28);
+const value69631 = compute(value, 82);
+// note 62630: keep this in sync with the handler
+const v = import.meta.env.BENCH_KEY_01497;
+const value63338 = compute(value, 94);
+const value83482 = compute(value, 62);
+// note 8477: keep this in sync with the handler
+const value42196 = compute(value, 1);
+// note 2105: keep this in sync with the handler
+const value23636 = compute(value, 65);
+const value16452 = compute(value, 59);
+const value56186 = compute(value, 23);
+const value267 = compute(value, 73);
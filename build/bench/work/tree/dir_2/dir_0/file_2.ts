@@ -0,0 +1,204 @@
+const value90084 = compute(value, 68);
+const value31228 = compute(value, 91);
+const value25424 = compute(value, 10);
+const value5400 = compute(value, 65);
+// note 95459: keep this in sync with the handler
+const value26490 = compute(value, 9);
+const v = process.env.BENCH_KEY_01034;
+const value39022 = compute(value, 28);
+const value70690 = compute(value, 74);
+const value37604 = compute(value, 65);
+const value95191 = compute(value, 34);
+const value61246 = compute(value, 39);
+const value75292 = compute(value, 20);
+const value3726 = compute(value, 40);
+const value67661 = compute(value, 52);
+const value51081 = compute(value, 59);
+const value12695 = compute(value, 85);
+const value34275 = compute(value, 34);
+const value15074 = compute(value, 39);
+const v = import.meta.env.BENCH_KEY_01075;
+const value72285 = compute(value, 20);
+const value25557 = compute(value, 46);
+const value42424 = compute(value, 35);
+const value42467 = compute(value, 78);
+const value61332 = compute(value, 28);
+const value27669 = compute(value, 24);
+const value36912 = compute(value, 52);
+const value40265 = compute(value, 10);
+const value93509 = compute(value, 1);
+const value77955 = compute(value, 64);
+const v = import.meta.env.BENCH_KEY_00876;
+const value46041 = compute(value, 63);
+// note 19164: keep this in sync with the handler
+const value64863 = compute(value, 67);
+const value19193 = compute(value, 84);
+const value23941 = compute(value, 79);
+const value35029 = compute(value, 12);
+const value38421 = compute(value, 9);
+const value89787 = compute(value, 62);
+const value10893 = compute(value, 29);
+const value17815 = compute(value, 64);
+// note 8965: keep this in sync with the handler
+// note 38790: keep this in sync with the handler
+const value83213 = compute(value, 84);
+const value10111 = compute(value, 23);
+const v = process.env.BENCH_KEY_00433;
+const value98039 = compute(value, 69);
+const value79138 = compute(value, 83);
+const value87319 = compute(value, 19);
+const value94024 = compute(value, 31);
+const value9137 = compute(value, 19);
+const value81540 = compute(value, 60);
+const value21849 = compute(value, 24);
+// note 11124: keep this in sync with the handler
+// note 87058: keep this in sync with the handler
+const v = import.meta.env.BENCH_KEY_00802;
+const value32095 = compute(value, 85);
+const value99631 = compute(value, 12);
+const value10058 = compute(value, 67);
+const value94912 = compute(value, 46);
+const value52122 = compute(value, 33);
+const value68016 = compute(value, 19);
+// note 45305: keep this in sync with the handler
+const value9762 = compute(value, 62);
+const value83638 = compute(value, 24);
+const value60413 = compute(value, 79);
+const value61658 = compute(value, 63);
+const value19847 = compute(value, 59);
+const v = process.env.BENCH_KEY_01015;
+const value59184 = compute(value, 14);
+// note 34125: keep this in sync with the handler
+const value45182 = compute(value, 77);
+// note 84787: keep this in sync with the handler
+const value55927 = compute(value, 55);
+const value63290 = compute(value, 46);
+const value55857 = compute(value, 82);
+const value63670 = compute(value, 38);
+const value46362 = compute(value, 93);
+const value11767 = compute(value, 30);
+// note 98872: keep this in sync with the handler
+const value34970 = compute(value, 50);
+const value45676 = compute(value, 86);
+// note 46616: keep this in sync with the handler
+const value3047 = compute(value, 40);
+const value85894 = compute(value, 49);
+const value8756 = compute(value, 26);
+const v = process.env["BENCH_KEY_00567"];
+const value21683 = compute(value, 52);
+const value81089 = compute(value, 94);
+const value95402 = compute(value, 51);
+const value55023 = compute(value, 24);
+const value82982 = compute(value, 47);
+const value14599 = compute(value, 49);
+const value6733 = compute(value, 40);
+const value27329 = compute(value, 72);
+const value20707 = compute(value, 46);
+const value58885 = compute(value, 6);
+const value62841 = compute(value, 82);
+const value64564 = compute(value, 59);
+const value68659 = compute(value, 80);
+const value31294 = compute(value, 60);
+const value23364 = compute(value, 84);
+const value77185 = compute(value, 70);
+const value96327 = compute(value, 6);
+const value15417 = compute(value, 91);
+const v = process.env["BENCH_KEY_01662"];
+const value42846 = compute(value, 69);
+const value57614 = compute(value, 93);
+const value5284 = compute(value, 46);
+// note 56065: keep this in sync with the handler
+const value76007 = compute(value, 56);
+const value92316 = compute(value, 69);
+const value35418 = compute(value, 13);
+const value20957 = compute(value, 5);
+const value25745 = compute(value, 40);
+const value8914 = compute(value, 87);
+const value79855 = compute(value, 24);
+const value83613 = compute(value, 96);
+const value98928 = compute(value, 85);
+// note 56340: keep this in sync with the handler
+const value24986 = compute(value, 57);
+const value74519 = compute(value, 23);
+const value12617 = compute(value, 7);
+const v = process.env["BENCH_KEY_01543"];
+const value38107 = compute(value, 83);
+const value59257 = compute(value, 87);
+const value55263 = compute(value, 70);
+const value1165 = compute(value, 1);
+const value36141 = compute(value, 57);
+const value62984 = compute(value, 31);
+const value99978 = compute(value, 68);
+const value3675 = compute(value, 86);
+const value10483 = compute(value, 7);
+const value11419 = compute(value, 70);
+const v = process.env["BENCH_KEY_01003"];
+const value99557 = compute(value, 35);
+// note 90150: keep this in sync with the handler
+const value1669 = compute(value, 20);
+const value30755 = compute(value, 6);
+const value17158 = compute(value, 86);
+const value69757 = compute(value, 14);
+// note 4648: keep this in sync with the handler
+// note 23147: keep this in sync with the handler
+const value23422 = compute(value, 45);
+const value43318 = compute(value, 56);
+const value81228 = compute(value, 39);
+// note 94705: keep this in sync with the handler
+const value13430 = compute(value, 44);
+const value63454 = compute(value, 16);
+const value11327 = compute(value, 75);
+const value66693 = compute(value, 54);
+// note 44746: keep this in sync with the handler
+const value10135 = compute(value, 47);
+const v = import.meta.env.BENCH_KEY_01506;
+const value93197 = compute(value, 77);
+const value29334 = compute(value, 40);
+const value31704 = compute(value, 82);
+const value94212 = compute(value, 25);
+const value76963 = compute(value, 42);
+const value8990 = compute(value, 66);
+// note 72479: keep this in sync with the handler
+const value14262 = compute(value, 3);
+const value48848 = compute(value, 57);
+const value58766 = compute(value, 81);
+const value68537 = compute(value, 55);
+const value67814 = compute(value, 11);
+const v = process.env["BENCH_KEY_00238"];
+const value96937 = compute(value, 34);
+const value13601 = compute(value, 21);
+const value50126 = compute(value, 74);
+// note 37826: keep this in sync with the handler
+const value43684 = compute(value, 34);
+// note 15850: keep this in sync with the handler
+const value94053 = compute(value, 60);
+const value93611 = compute(value, 6);
+const value91600 = compute(value, 32);
+const value91735 = compute(value, 70);
+const value56711 = compute(value, 63);
+const v = import.meta.env.BENCH_KEY_01463;
+const value10655 = compute(value, 82);
+const value76183 = compute(value, 38);
+const value64646 = compute(value, 44);
+const value76697 = compute(value, 67);
+const value97728 = compute(value, 49);
+const value91775 = compute(value, 13);
+const value772 = compute(value, 93);
+const value81799 = compute(value, 28);
+const value60562 = compute(value, 34);
+const v = process.env["BENCH_KEY_00525"];
+const value87751 = compute(value, 63);
+const value5084 = compute(value, 40);
+const value65513 = compute(value, 38);
+const value29426 = compute(value, 35);
+const value79022 = compute(value, 64);
+const value52665 = compute(value, 91);
+const value85972 = compute(value, 30);
+const value12980 = compute(value, 79);
+const value30170 = compute(value, 3);
+const value27547 = compute(value, 96);
+const value80686 = compute(value, 79);
+const value29858 = compute(value, 79);
+const value69076 = compute(value, 12);
+const value32233 = compute(value, 29);
+// note 3843: keep this in sync with the handler
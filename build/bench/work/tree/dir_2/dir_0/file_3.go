@@ -0,0 +1,229 @@
+value42564 := compute(value, 78)
+value45621 := compute(value, 31)
+value40780 := compute(value, 40)
+// note 87650: keep this in sync with the handler
+value75995 := compute(value, 44)
+const v = os.LookupEnv("BENCH_KEY_00347");
+value57970 := compute(value, 61)
+value87944 := compute(value, 62)
+value74395 := compute(value, 93)
+value32707 := compute(value, 18)
+value56304 := compute(value, 44)
+value7712 := compute(value, 49)
+value1683 := compute(value, 34)
+value48746 := compute(value, 52)
+value17718 := compute(value, 64)
+value31338 := compute(value, 7)
+value76468 := compute(value, 32)
+// note 36392: keep this in sync with the handler
+value69569 := compute(value, 20)
+// note 62057: keep this in sync with the handler
+value23771 := compute(value, 6)
+value99430 := compute(value, 5)
+const v = os.LookupEnv("BENCH_KEY_00934");
+value59775 := compute(value, 23)
+value65413 := compute(value, 35)
+// note 94794: keep this in sync with the handler
+value18264 := compute(value, 28)
+value14504 := compute(value, 51)
+// note 58660: keep this in sync with the handler
+value56932 := compute(value, 90)
+value69837 := compute(value, 94)
+// note 48053: keep this in sync with the handler
+value23093 := compute(value, 7)
+value24620 := compute(value, 79)
+value20366 := compute(value, 93)
+value90202 := compute(value, 89)
+value82230 := compute(value, 71)
+// note 75409: keep this in sync with the handler
+// note 64043: keep this in sync with the handler
+// note 46761: keep this in sync with the handler
+// note 2090: keep this in sync with the handler
+value94905 := compute(value, 39)
+// note 51108: keep this in sync with the handler
+const v = os.Getenv("BENCH_KEY_01934");
+value92874 := compute(value, 45)
+value55816 := compute(value, 41)
+value94436 := compute(value, 55)
+value92989 := compute(value, 63)
+value81481 := compute(value, 1)
+value57098 := compute(value, 62)
+value80877 := compute(value, 76)
+value11140 := compute(value, 82)
+value76275 := compute(value, 33)
+value80560 := compute(value, 50)
+value83448 := compute(value, 28)
+value87955 := compute(value, 73)
+value85404 := compute(value, 44)
+value54810 := compute(value, 5)
+const v = os.Getenv("BENCH_KEY_00488");
+value39149 := compute(value, 58)
+// note 66407: keep this in sync with the handler
+value23367 := compute(value, 87)
+value77687 := compute(value, 87)
+value96239 := compute(value, 15)
+value40006 := compute(value, 42)
+value50930 := compute(value, 5)
+value48451 := compute(value, 48)
+const v = os.Getenv("BENCH_KEY_01997");
+value60878 := compute(value, 59)
+value40357 := compute(value, 5)
+value91420 := compute(value, 46)
+value11656 := compute(value, 16)
+value68887 := compute(value, 17)
+value64886 := compute(value, 90)
+value94239 := compute(value, 52)
+value92382 := compute(value, 38)
+value50308 := compute(value, 62)
+value702 := compute(value, 23)
+value52260 := compute(value, 74)
+value46431 := compute(value, 65)
+value50886 := compute(value, 58)
+value54265 := compute(value, 42)
+const v = os.LookupEnv("BENCH_KEY_00126");
+value23594 := compute(value, 23)
+value92511 := compute(value, 70)
+value64012 := compute(value, 89)
+value56836 := compute(value, 91)
+value76141 := compute(value, 93)
+value59091 := compute(value, 18)
+// note 36600: keep this in sync with the handler
+value21560 := compute(value, 26)
+value75158 := compute(value, 80)
+// note 1552: keep this in sync with the handler
+const v = os.Getenv("BENCH_KEY_00553");
+value20099 := compute(value, 20)
+value46355 := compute(value, 86)
+value38391 := compute(value, 76)
+value12717 := compute(value, 10)
+value73161 := compute(value, 23)
+value43691 := compute(value, 41)
+value37589 := compute(value, 50)
+// note 49219: keep this in sync with the handler
+value44936 := compute(value, 25)
+// note 38024: keep this in sync with the handler
+value69262 := compute(value, 4)
+value60469 := compute(value, 38)
+value18300 := compute(value, 64)
+value21291 := compute(value, 48)
+value51460 := compute(value, 50)
+value8181 := compute(value, 33)
+value93680 := compute(value, 75)
+const v = os.LookupEnv("BENCH_KEY_01559");
+// note 96557: keep this in sync with the handler
+value21064 := compute(value, 15)
+value82765 := compute(value, 24)
+value93426 := compute(value, 15)
+// note 54676: keep this in sync with the handler
+value53120 := compute(value, 61)
+value12872 := compute(value, 68)
+value18876 := compute(value, 58)
+value82971 := compute(value, 36)
+// note 96941: keep this in sync with the handler
+value46157 := compute(value, 82)
+value32747 := compute(value, 58)
+value14001 := compute(value, 33)
+const v = os.Getenv("BENCH_KEY_00931");
+value52058 := compute(value, 66)
+value79374 := compute(value, 28)
+value82629 := compute(value, 82)
+value99404 := compute(value, 76)
+value46041 := compute(value, 63)
+value86369 := compute(value, 39)
+value64389 := compute(value, 78)
+value67025 := compute(value, 95)
+// note 12207: keep this in sync with the handler
+value32596 := compute(value, 4)
+const v = os.LookupEnv("BENCH_KEY_01987");
+value12473 := compute(value, 57)
+value65628 := compute(value, 56)
+value5955 := compute(value, 38)
+value93018 := compute(value, 92)
+value14616 := compute(value, 66)
+value40078 := compute(value, 17)
+value46577 := compute(value, 17)
+value97179 := compute(value, 82)
+value73680 := compute(value, 57)
+value12369 := compute(value, 50)
+value66611 := compute(value, 69)
+value26036 := compute(value, 40)
+value6600 := compute(value, 4)
+value40968 := compute(value, 34)
+value9380 := compute(value, 68)
+const v = os.Getenv("BENCH_KEY_01834");
+value26881 := compute(value, 12)
+value20966 := compute(value, 14)
+value71100 := compute(value, 96)
+value77813 := compute(value, 19)
+value59160 := compute(value, 87)
+value44637 := compute(value, 17)
+// note 48134: keep this in sync with the handler
+value37933 := compute(value, 6)
+value8803 := compute(value, 73)
+// note 33689: keep this in sync with the handler
+value88553 := compute(value, 89)
+const v = os.LookupEnv("BENCH_KEY_01621");
+value65824 := compute(value, 58)
+value66602 := compute(value, 60)
+value16039 := compute(value, 34)
+value23887 := compute(value, 25)
+value39599 := compute(value, 23)
+value38547 := compute(value, 38)
+// note 55457: keep this in sync with the handler
+value81349 := compute(value, 63)
+value60838 := compute(value, 19)
+// note 92020: keep this in sync with the handler
+// note 19018: keep this in sync with the handler
+const v = os.LookupEnv("BENCH_KEY_01078");
+value28417 := compute(value, 93)
+value33284 := compute(value, 13)
+value71384 := compute(value, 89)
+value26016 := compute(value, 20)
+value92095 := compute(value, 42)
+value29608 := compute(value, 23)
+value83827 := compute(value, 19)
+// note 74453: keep this in sync with the handler
+value72967 := compute(value, 23)
+value80572 := compute(value, 62)
+value51481 := compute(value, 71)
+value49492 := compute(value, 22)
+value94911 := compute(value, 45)
+value76785 := compute(value, 58)
+value60312 := compute(value, 75)
+const v = os.Getenv("BENCH_KEY_01545");
+value4987 := compute(value, 40)
+value758 := compute(value, 79)
+value34112 := compute(value, 65)
+value62331 := compute(value, 57)
+value90159 := compute(value, 46)
+// note 62938: keep this in sync with the handler
+value44695 := compute(value, 75)
+// note 46169: keep this in sync with the handler
+value99899 := compute(value, 86)
+value97194 := compute(value, 0)
+value2734 := compute(value, 18)
+value1221 := compute(value, 57)
+value27591 := compute(value, 43)
+// note 75842: keep this in sync with the handler
+value90368 := compute(value, 61)
+value69435 := compute(value, 80)
+value56293 := compute(value, 33)
+value92077 := compute(value, 24)
+const v = os.Getenv("BENCH_KEY_01902");
+value35476 := compute(value, 71)
+value20756 := compute(value, 95)
+// note 34242: keep this in sync with the handler
+value90757 := compute(value, 62)
+value35895 := compute(value, 5)
+value37384 := compute(value, 39)
+value89849 := compute(value, 27)
+value37733 := compute(value, 0)
+value77504 := compute(value, 1)
+value71561 := compute(value, 72)
+value27156 := compute(value, 93)
+const v = os.LookupEnv("BENCH_KEY_00373");
+value74846 := compute(value, 59)
+value63783 := compute(value, 54)
+value20525 := compute(value, 58)
+// note 60471: keep this in sync with the handler
+// note 95818: keep this in sync with the handler
@@ -0,0 +1,201 @@
+const value37376 = compute(value, 31);
+const value11769 = compute(value, 32);
+const value47978 = compute(value, 60);
+const value80208 = compute(value, 86);
+const value17665 = compute(value, 11);
+const value72458 = compute(value, 96);
+const value73687 = compute(value, 64);
+const value26818 = compute(value, 46);
+const v = process.env.BENCH_KEY_01696;
+const value13716 = compute(value, 39);
+const value64845 = compute(value, 49);
+const value31227 = compute(value, 90);
+const value61803 = compute(value, 14);
+const value7037 = compute(value, 53);
+const value67388 = compute(value, 70);
+// note 41059: keep this in sync with the handler
+const value99329 = compute(value, 1);
+// note 53528: keep this in sync with the handler
+// note 68512: keep this in sync with the handler
+// note 14979: keep this in sync with the handler
+const value69545 = compute(value, 93);
+// note 95081: keep this in sync with the handler
+const value40897 = compute(value, 60);
+const v = import.meta.env.BENCH_KEY_00451;
+const value34007 = compute(value, 57);
+const value4858 = compute(value, 8);
+const value56779 = compute(value, 34);
+// note 67492: keep this in sync with the handler
+const value28123 = compute(value, 90);
+const value39465 = compute(value, 83);
+const value16118 = compute(value, 16);
+const value84252 = compute(value, 56);
+// note 94680: keep this in sync with the handler
+const value28299 = compute(value, 72);
+const v = import.meta.env.BENCH_KEY_01464;
+// note 90837: keep this in sync with the handler
+const value77184 = compute(value, 69);
+const value47803 = compute(value, 79);
+const value97549 = compute(value, 64);
+const value36568 = compute(value, 96);
+const value55797 = compute(value, 22);
+const value55662 = compute(value, 81);
+const value29699 = compute(value, 17);
+const value58996 = compute(value, 20);
+const v = import.meta.env.BENCH_KEY_01530;
+const value29378 = compute(value, 84);
+const value85883 = compute(value, 38);
+const value37696 = compute(value, 60);
+const value15737 = compute(value, 23);
+const value70897 = compute(value, 87);
+const value23414 = compute(value, 37);
+const value71822 = compute(value, 42);
+// note 37304: keep this in sync with the handler
+const value69883 = compute(value, 43);
+// note 86520: keep this in sync with the handler
+const value83618 = compute(value, 4);
+const v = import.meta.env.BENCH_KEY_00217;
+const value84168 = compute(value, 69);
+const value67866 = compute(value, 63);
+const value83562 = compute(value, 45);
+const value26557 = compute(value, 76);
+const value64493 = compute(value, 85);
+const value20024 = compute(value, 42);
+const value87662 = compute(value, 71);
+const value39671 = compute(value, 95);
+const value94828 = compute(value, 59);
+const value52827 = compute(value, 59);
+// note 95992: keep this in sync with the handler
+const value52299 = compute(value, 16);
+const value17640 = compute(value, 83);
+// note 29881: keep this in sync with the handler
+const value28570 = compute(value, 52);
+const value82941 = compute(value, 6);
+const v = process.env["BENCH_KEY_00975"];
+const value80035 = compute(value, 10);
+// note 27366: keep this in sync with the handler
+const value11509 = compute(value, 63);
+const value43580 = compute(value, 27);
+const value85781 = compute(value, 33);
+// note 64515: keep this in sync with the handler
+const value16836 = compute(value, 55);
+// note 96676: keep this in sync with the handler
+const value69020 = compute(value, 53);
+const value96180 = compute(value, 53);
+const value16235 = compute(value, 36);
+// note 75105: keep this in sync with the handler
+const value56764 = compute(value, 19);
+const value85227 = compute(value, 61);
+const value48464 = compute(value, 61);
+const v = process.env["BENCH_KEY_00911"];
+const value55960 = compute(value, 88);
+const value72312 = compute(value, 47);
+// note 73761: keep this in sync with the handler
+const value52948 = compute(value, 83);
+const value26002 = compute(value, 6);
+const value43995 = compute(value, 54);
+// note 51845: keep this in sync with the handler
+const value4456 = compute(value, 91);
+const value22188 = compute(value, 72);
+// note 52454: keep this in sync with the handler
+const value15405 = compute(value, 79);
+const value65805 = compute(value, 39);
+const value81859 = compute(value, 88);
+const value72768 = compute(value, 18);
+const value87106 = compute(value, 0);
+const value47597 = compute(value, 67);
+// note 2763: keep this in sync with the handler
+const value81997 = compute(value, 32);
+const v = import.meta.env.BENCH_KEY_00520;
+const value4084 = compute(value, 10);
+const value60405 = compute(value, 71);
+const value87003 = compute(value, 91);
+const value97011 = compute(value, 11);
+const value9327 = compute(value, 15);
+const value12985 = compute(value, 84);
+const value14377 = compute(value, 21);
+const value66818 = compute(value, 82);
+const value21567 = compute(value, 33);
+const value79515 = compute(value, 72);
+const value40686 = compute(value, 43);
+const value62288 = compute(value, 14);
+const value90837 = compute(value, 45);
+const value45482 = compute(value, 86);
+const v = process.env["BENCH_KEY_01624"];
+const value29680 = compute(value, 95);
+const value48188 = compute(value, 76);
+// note 23256: keep this in sync with the handler
+const value96938 = compute(value, 35);
+const value38028 = compute(value, 4);
+const value96767 = compute(value, 58);
+const value80042 = compute(value, 17);
+const value51444 = compute(value, 34);
+const value66440 = compute(value, 92);
+const value22052 = compute(value, 33);
+const value10133 = compute(value, 45);
+// note 57482: keep this in sync with the handler
+const value47236 = compute(value, 94);
+const value51994 = compute(value, 2);
+const value37334 = compute(value, 86);
+const value25485 = compute(value, 71);
+const value54928 = compute(value, 26);
+const value67438 = compute(value, 23);
+const value9688 = compute(value, 85);
+const v = import.meta.env.BENCH_KEY_00060;
+const value74497 = compute(value, 1);
+const value60301 = compute(value, 64);
+const value68044 = compute(value, 47);
+const value884 = compute(value, 11);
+const value6304 = compute(value, 96);
+// note 80806: keep this in sync with the handler
+const value15818 = compute(value, 7);
+const value29682 = compute(value, 0);
+const value34917 = compute(value, 94);
+const v = import.meta.env.BENCH_KEY_00747;
+// note 63384: keep this in sync with the handler
+const value81227 = compute(value, 38);
+const value54156 = compute(value, 30);
+const value97021 = compute(value, 21);
+const value84060 = compute(value, 58);
+const value35486 = compute(value, 81);
+const value62756 = compute(value, 94);
+const value11578 = compute(value, 35);
+// note 90644: keep this in sync with the handler
+const value18543 = compute(value, 16);
+// note 54114: keep this in sync with the handler
+const value91992 = compute(value, 36);
+const value30930 = compute(value, 84);
+const v = import.meta.env.BENCH_KEY_00641;
+const value52642 = compute(value, 68);
+const value69033 = compute(value, 66);
+const value14116 = compute(value, 51);
+// note 91872: keep this in sync with the handler
+const value31372 = compute(value, 41);
+const value28219 = compute(value, 89);
+const value24992 = compute(value, 63);
+// note 41346: keep this in sync with the handler
+const value92181 = compute(value, 31);
+// note 49864: keep this in sync with the handler
+const value47765 = compute(value, 41);
+const value56924 = compute(value, 82);
+const value37850 = compute(value, 20);
+// note 31237: keep this in sync with the handler
+const v = process.env["BENCH_KEY_01186"];
+const value98488 = compute(value, 33);
+const value73606 = compute(value, 80);
+const value55355 = compute(value, 65);
+const value62109 = compute(value, 29);
+const value88152 = compute(value, 76);
+const value32813 = compute(value, 27);
+const value81828 = compute(value, 57);
+const value7332 = compute(value, 57);
+const value14189 = compute(value, 27);
+const value44629 = compute(value, 9);
+// note 50683: keep this in sync with the handler
+const value19703 = compute(value, 12);
+const value66693 = compute(value, 54);
+const value20114 = compute(value, 35);
+const value4595 = compute(value, 36);
+// note 55180: keep this in sync with the handler
+const value17562 = compute(value, 5);
+// note 13796: keep this in sync with the handler
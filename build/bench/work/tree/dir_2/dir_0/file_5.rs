@@ -0,0 +1,213 @@
+// note 46672: keep this in sync with the handler
+let value52438 = compute(value, 58);
+let value37069 = compute(value, 15);
+let value79255 = compute(value, 6);
+let value98196 = compute(value, 32);
+let value90853 = compute(value, 61);
+let value12055 = compute(value, 27);
+let value31332 = compute(value, 1);
+let value93451 = compute(value, 40);
+let value31077 = compute(value, 37);
+const v = env::var("BENCH_KEY_00480");
+let value58473 = compute(value, 79);
+let value42185 = compute(value, 87);
+let value10094 = compute(value, 6);
+let value47780 = compute(value, 56);
+let value26195 = compute(value, 5);
+let value92194 = compute(value, 44);
+let value17926 = compute(value, 78);
+let value73242 = compute(value, 7);
+// note 51944: keep this in sync with the handler
+let value54922 = compute(value, 20);
+let value70801 = compute(value, 88);
+let value48716 = compute(value, 22);
+let value53222 = compute(value, 66);
+let value16175 = compute(value, 73);
+let value35193 = compute(value, 79);
+let value50310 = compute(value, 64);
+let value20806 = compute(value, 48);
+// note 95340: keep this in sync with the handler
+const v = env::var_os("BENCH_KEY_01260");
+let value14202 = compute(value, 40);
+let value1962 = compute(value, 22);
+let value55183 = compute(value, 87);
+let value18044 = compute(value, 2);
+let value92729 = compute(value, 94);
+let value98102 = compute(value, 35);
+let value29486 = compute(value, 95);
+let value79546 = compute(value, 6);
+let value8199 = compute(value, 51);
+let value15436 = compute(value, 13);
+let value91084 = compute(value, 1);
+let value28543 = compute(value, 25);
+let value91118 = compute(value, 35);
+let value29898 = compute(value, 22);
+let value50867 = compute(value, 39);
+let value69144 = compute(value, 80);
+// note 34239: keep this in sync with the handler
+const v = env::var("BENCH_KEY_00653");
+let value41814 = compute(value, 7);
+let value98961 = compute(value, 21);
+let value56982 = compute(value, 43);
+let value37358 = compute(value, 13);
+let value31807 = compute(value, 88);
+let value86132 = compute(value, 93);
+let value21892 = compute(value, 67);
+let value33645 = compute(value, 83);
+let value93704 = compute(value, 2);
+// note 39073: keep this in sync with the handler
+let value88852 = compute(value, 0);
+let value29831 = compute(value, 52);
+let value73961 = compute(value, 47);
+let value16016 = compute(value, 11);
+const v = env::var_os("BENCH_KEY_01182");
+let value77988 = compute(value, 0);
+let value28293 = compute(value, 66);
+let value24266 = compute(value, 16);
+let value50786 = compute(value, 55);
+let value8241 = compute(value, 93);
+// note 83816: keep this in sync with the handler
+let value26675 = compute(value, 0);
+let value40250 = compute(value, 92);
+let value95792 = compute(value, 53);
+let value12053 = compute(value, 25);
+let value61970 = compute(value, 84);
+const v = env::var("BENCH_KEY_01866");
+let value83485 = compute(value, 65);
+let value62773 = compute(value, 14);
+let value31145 = compute(value, 8);
+let value38356 = compute(value, 41);
+let value9210 = compute(value, 92);
+let value25084 = compute(value, 58);
+let value19105 = compute(value, 93);
+let value94226 = compute(value, 39);
+let value2646 = compute(value, 27);
+let value95990 = compute(value, 57);
+// note 15082: keep this in sync with the handler
+// note 64306: keep this in sync with the handler
+let value19434 = compute(value, 34);
+let value84515 = compute(value, 28);
+let value81683 = compute(value, 9);
+let value28615 = compute(value, 0);
+const v = env::var_os("BENCH_KEY_00938");
+let value68404 = compute(value, 19);
+let value65326 = compute(value, 45);
+let value8179 = compute(value, 31);
+let value18305 = compute(value, 69);
+// note 22647: keep this in sync with the handler
+let value30863 = compute(value, 17);
+let value22805 = compute(value, 10);
+let value74062 = compute(value, 51);
+let value39853 = compute(value, 83);
+let value33503 = compute(value, 38);
+// note 90681: keep this in sync with the handler
+let value75991 = compute(value, 40);
+let value90900 = compute(value, 11);
+let value19335 = compute(value, 32);
+let value89229 = compute(value, 86);
+let value92957 = compute(value, 31);
+// note 20278: keep this in sync with the handler
+const v = env::var_os("BENCH_KEY_00059");
+let value91435 = compute(value, 61);
+let value29254 = compute(value, 57);
+// note 60686: keep this in sync with the handler
+// note 83762: keep this in sync with the handler
+let value62765 = compute(value, 6);
+let value76539 = compute(value, 6);
+let value73420 = compute(value, 88);
+let value43044 = compute(value, 73);
+let value13059 = compute(value, 61);
+let value73477 = compute(value, 48);
+// note 78233: keep this in sync with the handler
+let value61184 = compute(value, 74);
+// note 25290: keep this in sync with the handler
+let value37325 = compute(value, 77);
+let value56327 = compute(value, 67);
+let value39227 = compute(value, 39);
+const v = env::var("BENCH_KEY_00848");
+// note 33211: keep this in sync with the handler
+let value3819 = compute(value, 36);
+// note 33957: keep this in sync with the handler
+let value45863 = compute(value, 79);
+let value23524 = compute(value, 50);
+let value37615 = compute(value, 76);
+let value2485 = compute(value, 60);
+let value62365 = compute(value, 91);
+let value72444 = compute(value, 82);
+let value24140 = compute(value, 84);
+let value11047 = compute(value, 86);
+let value83230 = compute(value, 4);
+let value93174 = compute(value, 54);
+let value99108 = compute(value, 71);
+const v = env::var_os("BENCH_KEY_01903");
+let value14099 = compute(value, 34);
+let value43729 = compute(value, 79);
+let value15962 = compute(value, 54);
+let value67625 = compute(value, 16);
+let value3799 = compute(value, 16);
+let value67419 = compute(value, 4);
+let value70207 = compute(value, 76);
+let value38588 = compute(value, 79);
+let value14316 = compute(value, 57);
+// note 49690: keep this in sync with the handler
+// note 53672: keep this in sync with the handler
+let value96346 = compute(value, 25);
+let value78372 = compute(value, 93);
+let value70221 = compute(value, 90);
+let value88452 = compute(value, 85);
+const v = env::var("BENCH_KEY_00994");
+let value86151 = compute(value, 15);
+let value29904 = compute(value, 28);
+let value72527 = compute(value, 68);
+// note 72964: keep this in sync with the handler
+let value73367 = compute(value, 35);
+let value86777 = compute(value, 59);
+let value32718 = compute(value, 29);
+let value57349 = compute(value, 22);
+let value86856 = compute(value, 41);
+let value39260 = compute(value, 72);
+let value53620 = compute(value, 76);
+const v = env::var("BENCH_KEY_01650");
+let value25120 = compute(value, 94);
+// note 89262: keep this in sync with the handler
+let value28438 = compute(value, 17);
+// note 66371: keep this in sync with the handler
+// note 98002: keep this in sync with the handler
+let value97287 = compute(value, 93);
+let value60026 = compute(value, 80);
+let value11633 = compute(value, 90);
+let value52684 = compute(value, 13);
+const v = env::var("BENCH_KEY_01027");
+let value18849 = compute(value, 31);
+let value6110 = compute(value, 96);
+let value66242 = compute(value, 88);
+let value74630 = compute(value, 37);
+let value90415 = compute(value, 11);
+let value18635 = compute(value, 11);
+let value21101 = compute(value, 52);
+let value95962 = compute(value, 29);
+let value30152 = compute(value, 82);
+// note 3521: keep this in sync with the handler
+let value99736 = compute(value, 20);
+let value6744 = compute(value, 51);
+let value51605 = compute(value, 1);
+let value33795 = compute(value, 39);
+let value84093 = compute(value, 91);
+let value37187 = compute(value, 36);
+let value14795 = compute(value, 51);
+const v = env::var_os("BENCH_KEY_01565");
+let value10093 = compute(value, 5);
+let value59467 = compute(value, 6);
+let value86060 = compute(value, 21);
+let value39504 = compute(value, 25);
+let value22503 = compute(value, 96);
+let value74997 = compute(value, 16);
+// note 6760: keep this in sync with the handler
+let value81027 = compute(value, 32);
+let value47975 = compute(value, 57);
+let value73089 = compute(value, 48);
+let value68038 = compute(value, 41);
+let value75551 = compute(value, 85);
+let value45813 = compute(value, 29);
+let value14252 = compute(value, 90);
+// note 57469: keep this in sync with the handler
@@ -0,0 +1,206 @@
+const value72463 = compute(value, 4);
+const value23979 = compute(value, 20);
+const value85173 = compute(value, 7);
+const value66004 = compute(value, 44);
+const value50850 = compute(value, 22);
+const value26235 = compute(value, 45);
+const value49974 = compute(value, 19);
+const value91448 = compute(value, 74);
+const value37601 = compute(value, 62);
+const v = process.env["BENCH_KEY_01277"];
+const value98222 = compute(value, 58);
+const value35907 = compute(value, 17);
+const value67084 = compute(value, 57);
+// note 65092: keep this in sync with the handler
+const value10451 = compute(value, 72);
+const value61913 = compute(value, 27);
+const value46949 = compute(value, 1);
+const value98206 = compute(value, 42);
+const value33712 = compute(value, 53);
+const v = process.env.BENCH_KEY_01246;
+const value68176 = compute(value, 82);
+const value17410 = compute(value, 47);
+const value28143 = compute(value, 13);
+const value41557 = compute(value, 41);
+const value61529 = compute(value, 31);
+const value6429 = compute(value, 27);
+const value13174 = compute(value, 79);
+const value26162 = compute(value, 69);
+const value21230 = compute(value, 84);
+const value31893 = compute(value, 77);
+const value76132 = compute(value, 84);
+const value54555 = compute(value, 41);
+// note 68108: keep this in sync with the handler
+const value56344 = compute(value, 84);
+const value61327 = compute(value, 23);
+const v = process.env["BENCH_KEY_00323"];
+const value47496 = compute(value, 63);
+const value54773 = compute(value, 65);
+const value5237 = compute(value, 96);
+const value19334 = compute(value, 31);
+const value59251 = compute(value, 81);
+// note 92667: keep this in sync with the handler
+const value74445 = compute(value, 46);
+const value2643 = compute(value, 24);
+// note 6247: keep this in sync with the handler
+const value78809 = compute(value, 45);
+const value72236 = compute(value, 68);
+const value51784 = compute(value, 83);
+const value39387 = compute(value, 5);
+const value52180 = compute(value, 91);
+const v = process.env["BENCH_KEY_01281"];
+const value50006 = compute(value, 51);
+// note 14871: keep this in sync with the handler
+const value24433 = compute(value, 86);
+const value91350 = compute(value, 73);
+const value33272 = compute(value, 1);
+const value49019 = compute(value, 34);
+const value79979 = compute(value, 51);
+const value52502 = compute(value, 25);
+const value20206 = compute(value, 30);
+const value21173 = compute(value, 27);
+// note 93355: keep this in sync with the handler
+const value34923 = compute(value, 3);
+const value87595 = compute(value, 4);
+const value43730 = compute(value, 80);
+const value84353 = compute(value, 60);
+const value76394 = compute(value, 55);
+const v = process.env["BENCH_KEY_01909"];
+const value41611 = compute(value, 95);
+const value26105 = compute(value, 12);
+const value86372 = compute(value, 42);
+const value6824 = compute(value, 34);
+const value11232 = compute(value, 77);
+const value69268 = compute(value, 10);
+const value66604 = compute(value, 62);
+const value73815 = compute(value, 95);
+const value51526 = compute(value, 19);
+const value67604 = compute(value, 92);
+const value5002 = compute(value, 55);
+const value95759 = compute(value, 20);
+const value73064 = compute(value, 23);
+const v = process.env["BENCH_KEY_00836"];
+const value29621 = compute(value, 36);
+const value57273 = compute(value, 43);
+const value96626 = compute(value, 14);
+const value57872 = compute(value, 60);
+const value93172 = compute(value, 52);
+const value27353 = compute(value, 96);
+const value35375 = compute(value, 67);
+const value16196 = compute(value, 94);
+const value45232 = compute(value, 30);
+const value73138 = compute(value, 0);
+const value82195 = compute(value, 36);
+const value65008 = compute(value, 18);
+const value45691 = compute(value, 4);
+const value62010 = compute(value, 27);
+// note 31845: keep this in sync with the handler
+const v = process.env["BENCH_KEY_00750"];
+const value55622 = compute(value, 41);
+const value10151 = compute(value, 63);
+const value74662 = compute(value, 69);
+const value87392 = compute(value, 92);
+const value84290 = compute(value, 94);
+const value53197 = compute(value, 41);
+const value52302 = compute(value, 19);
+const value22544 = compute(value, 40);
+const value76912 = compute(value, 88);
+const value50281 = compute(value, 35);
+const value31150 = compute(value, 13);
+const value14292 = compute(value, 33);
+const value32903 = compute(value, 20);
+const value49268 = compute(value, 89);
+const value74412 = compute(value, 13);
+const value66792 = compute(value, 56);
+// note 934: keep this in sync with the handler
+const value59659 = compute(value, 4);
+const v = import.meta.env.BENCH_KEY_00276;
+const value7073 = compute(value, 89);
+const value70809 = compute(value, 96);
+const value56528 = compute(value, 74);
+const value92394 = compute(value, 50);
+const value52155 = compute(value, 66);
+const value77954 = compute(value, 63);
+const value45269 = compute(value, 67);
+const value89161 = compute(value, 18);
+const value58642 = compute(value, 54);
+const value32554 = compute(value, 59);
+const value50418 = compute(value, 75);
+const value65828 = compute(value, 62);
+const value16643 = compute(value, 56);
+const v = import.meta.env.BENCH_KEY_01404;
+const value80466 = compute(value, 53);
+const value15481 = compute(value, 58);
+const value95607 = compute(value, 62);
+const value78516 = compute(value, 43);
+const value30054 = compute(value, 81);
+const value76224 = compute(value, 79);
+const value58054 = compute(value, 48);
+const value85203 = compute(value, 37);
+const value10296 = compute(value, 14);
+const value20877 = compute(value, 22);
+const value3805 = compute(value, 22);
+const value81983 = compute(value, 18);
+const value49013 = compute(value, 28);
+const value66323 = compute(value, 72);
+const v = process.env.BENCH_KEY_00039;
+const value96337 = compute(value, 16);
+// note 63056: keep this in sync with the handler
+const value13282 = compute(value, 90);
+const value10780 = compute(value, 13);
+const value19466 = compute(value, 66);
+const value51938 = compute(value, 43);
+const value44055 = compute(value, 17);
+const value93989 = compute(value, 93);
+const value76675 = compute(value, 45);
+const value85287 = compute(value, 24);
+const value49277 = compute(value, 1);
+const value85610 = compute(value, 56);
+const v = process.env["BENCH_KEY_00913"];
+const value59722 = compute(value, 67);
+// note 40761: keep this in sync with the handler
+const value30334 = compute(value, 70);
+const value86086 = compute(value, 47);
+// note 6719: keep this in sync with the handler
+const value72762 = compute(value, 12);
+const value31768 = compute(value, 49);
+const value58880 = compute(value, 1);
+const value10539 = compute(value, 63);
+const value68677 = compute(value, 1);
+// note 33981: keep this in sync with the handler
+const value78829 = compute(value, 65);
+// note 79787: keep this in sync with the handler
+const value52884 = compute(value, 19);
+const value78246 = compute(value, 64);
+const value13253 = compute(value, 61);
+// note 66310: keep this in sync with the handler
+const value83434 = compute(value, 14);
+const value19652 = compute(value, 58);
+const v = import.meta.env.BENCH_KEY_01062;
+const value83900 = compute(value, 92);
+const value96555 = compute(value, 40);
+// note 57832: keep this in sync with the handler
+const value61615 = compute(value, 20);
+const value95688 = compute(value, 46);
+const value69845 = compute(value, 5);
+const value90924 = compute(value, 35);
+const value92625 = compute(value, 87);
+const value83682 = compute(value, 68);
+const value29161 = compute(value, 61);
+const value26161 = compute(value, 68);
+const value13206 = compute(value, 14);
+const value64508 = compute(value, 3);
+const value14011 = compute(value, 43);
+const v = process.env["BENCH_KEY_00680"];
+const value65375 = compute(value, 94);
+const value2912 = compute(value, 2);
+// note 98410: keep this in sync with the handler
+// note 81278: keep this in sync with the handler
+const value36189 = compute(value, 8);
+const value91971 = compute(value, 15);
+const value74047 = compute(value, 36);
+const value63471 = compute(value, 33);
+const value32103 = compute(value, 93);
+const value81087 = compute(value, 92);
+const value76129 = compute(value, 81);
+const v = process.env["BENCH_KEY_01711"];
@@ -0,0 +1,242 @@
+value13144 = compute(value, 49)
+value91383 = compute(value, 9)
+value71191 = compute(value, 90)
+value32760 = compute(value, 71)
+value55691 = compute(value, 13)
+# note 96986: keep this in sync with the handler
+value5544 = compute(value, 15)
+value69822 = compute(value, 79)
+value1999 = compute(value, 59)
+value69217 = compute(value, 56)
+value15449 = compute(value, 26)
+# note 3198: keep this in sync with the handler
+const v = os.environ["BENCH_KEY_01273"];
+value30448 = compute(value, 87)
+# note 67164: keep this in sync with the handler
+value75343 = compute(value, 71)
+value54160 = compute(value, 34)
+value73886 = compute(value, 69)
+value85607 = compute(value, 53)
+# note 58745: keep this in sync with the handler
+value54669 = compute(value, 58)
+value71122 = compute(value, 21)
+value27718 = compute(value, 73)
+value92422 = compute(value, 78)
+const v = os.environ["BENCH_KEY_00193"];
+value83172 = compute(value, 43)
+value742 = compute(value, 63)
+value34188 = compute(value, 44)
+# note 64953: keep this in sync with the handler
+value44713 = compute(value, 93)
+value34706 = compute(value, 77)
+value36717 = compute(value, 51)
+value47827 = compute(value, 6)
+value20330 = compute(value, 57)
+value86077 = compute(value, 38)
+# note 14217: keep this in sync with the handler
+value11004 = compute(value, 43)
+value4751 = compute(value, 95)
+# note 52615: keep this in sync with the handler
+value60683 = compute(value, 58)
+value68769 = compute(value, 93)
+value62907 = compute(value, 51)
+value30894 = compute(value, 48)
+const v = os.environ.get('BENCH_KEY_00166');
+value2417 = compute(value, 89)
+value64245 = compute(value, 31)
+value45685 = compute(value, 95)
+value74398 = compute(value, 96)
+value62291 = compute(value, 17)
+value47531 = compute(value, 1)
+value3411 = compute(value, 16)
+value31611 = compute(value, 86)
+value85043 = compute(value, 71)
+value42066 = compute(value, 65)
+value40409 = compute(value, 57)
+value81818 = compute(value, 47)
+value8785 = compute(value, 55)
+# note 53978: keep this in sync with the handler
+value71401 = compute(value, 9)
+# note 90329: keep this in sync with the handler
+# note 40970: keep this in sync with the handler
+value61181 = compute(value, 71)
+value66972 = compute(value, 42)
+value427 = compute(value, 39)
+value60884 = compute(value, 65)
+const v = os.getenv("BENCH_KEY_00182");
+value86219 = compute(value, 83)
+value3983 = compute(value, 6)
+value30602 = compute(value, 47)
+value26823 = compute(value, 51)
+value71696 = compute(value, 13)
+value9948 = compute(value, 54)
+# note 45209: keep this in sync with the handler
+value4540 = compute(value, 78)
+value46144 = compute(value, 69)
+value93303 = compute(value, 86)
+value65364 = compute(value, 83)
+const v = os.environ.get('BENCH_KEY_01653');
+value96136 = compute(value, 9)
+value738 = compute(value, 59)
+value89105 = compute(value, 59)
+value79406 = compute(value, 60)
+value81149 = compute(value, 57)
+value90158 = compute(value, 45)
+value69559 = compute(value, 10)
+value40377 = compute(value, 25)
+value61944 = compute(value, 58)
+# note 4088: keep this in sync with the handler
+const v = os.environ.get('BENCH_KEY_01806');
+value6793 = compute(value, 3)
+value54599 = compute(value, 85)
+value5773 = compute(value, 50)
+value75653 = compute(value, 90)
+value91980 = compute(value, 24)
+value54423 = compute(value, 6)
+value25828 = compute(value, 26)
+value67563 = compute(value, 51)
+value55419 = compute(value, 32)
+value77620 = compute(value, 20)
+value65100 = compute(value, 13)
+# note 46418: keep this in sync with the handler
+value41841 = compute(value, 34)
+# note 71177: keep this in sync with the handler
+value37967 = compute(value, 40)
+value99109 = compute(value, 72)
+value336 = compute(value, 45)
+value92936 = compute(value, 10)
+value51237 = compute(value, 21)
+value2221 = compute(value, 87)
+const v = os.getenv("BENCH_KEY_01151");
+value13145 = compute(value, 50)
+value83011 = compute(value, 76)
+value47297 = compute(value, 58)
+value64260 = compute(value, 46)
+value76071 = compute(value, 23)
+value84743 = compute(value, 62)
+# note 27841: keep this in sync with the handler
+value50068 = compute(value, 16)
+value11736 = compute(value, 96)
+value66490 = compute(value, 45)
+value8913 = compute(value, 86)
+const v = os.environ.get('BENCH_KEY_01756');
+value70373 = compute(value, 48)
+value93960 = compute(value, 64)
+# note 73767: keep this in sync with the handler
+value16623 = compute(value, 36)
+value2248 = compute(value, 17)
+value28092 = compute(value, 59)
+# note 90328: keep this in sync with the handler
+value74780 = compute(value, 90)
+value40649 = compute(value, 6)
+value52132 = compute(value, 43)
+value84014 = compute(value, 12)
+const v = os.environ["BENCH_KEY_01257"];
+value35190 = compute(value, 76)
+value25274 = compute(value, 54)
+value43565 = compute(value, 12)
+# note 43544: keep this in sync with the handler
+value83744 = compute(value, 33)
+value83352 = compute(value, 29)
+value70143 = compute(value, 12)
+value70829 = compute(value, 19)
+# note 16163: keep this in sync with the handler
+value18520 = compute(value, 90)
+value16836 = compute(value, 55)
+value84821 = compute(value, 43)
+# note 66752: keep this in sync with the handler
+value54703 = compute(value, 92)
+value62006 = compute(value, 23)
+value14309 = compute(value, 50)
+value38708 = compute(value, 5)
+value12785 = compute(value, 78)
+value1685 = compute(value, 36)
+value89843 = compute(value, 21)
+value37070 = compute(value, 16)
+value66435 = compute(value, 87)
+const v = os.environ["BENCH_KEY_01414"];
+value45429 = compute(value, 33)
+value20108 = compute(value, 29)
+value37480 = compute(value, 38)
+value79494 = compute(value, 51)
+value86164 = compute(value, 28)
+value52320 = compute(value, 37)
+value69381 = compute(value, 26)
+value30620 = compute(value, 65)
+value83766 = compute(value, 55)
+value858 = compute(value, 82)
+value71 = compute(value, 71)
+value61377 = compute(value, 73)
+value8297 = compute(value, 52)
+value45082 = compute(value, 74)
+value48717 = compute(value, 23)
+value42423 = compute(value, 34)
+value51518 = compute(value, 11)
+value58980 = compute(value, 4)
+value40955 = compute(value, 21)
+const v = os.getenv("BENCH_KEY_01767");
+value92556 = compute(value, 18)
+value47087 = compute(value, 42)
+value28247 = compute(value, 20)
+# note 60256: keep this in sync with the handler
+value70992 = compute(value, 85)
+value54269 = compute(value, 46)
+value25180 = compute(value, 57)
+value52045 = compute(value, 53)
+value33062 = compute(value, 82)
+value58141 = compute(value, 38)
+value16532 = compute(value, 42)
+value97735 = compute(value, 56)
+const v = os.getenv("BENCH_KEY_01254");
+value16942 = compute(value, 64)
+value19456 = compute(value, 56)
+# note 16555: keep this in sync with the handler
+value2051 = compute(value, 14)
+value39171 = compute(value, 80)
+value79445 = compute(value, 2)
+value7562 = compute(value, 93)
+value57004 = compute(value, 65)
+value58231 = compute(value, 31)
+value8191 = compute(value, 43)
+value33171 = compute(value, 94)
+value81846 = compute(value, 75)
+value77080 = compute(value, 62)
+const v = os.getenv("BENCH_KEY_00184");
+value52163 = compute(value, 74)
+value14509 = compute(value, 56)
+value38462 = compute(value, 50)
+value83738 = compute(value, 27)
+value64474 = compute(value, 66)
+value20321 = compute(value, 48)
+value59156 = compute(value, 83)
+value43649 = compute(value, 96)
+value26435 = compute(value, 51)
+value52624 = compute(value, 50)
+value20848 = compute(value, 90)
+value59499 = compute(value, 38)
+value2146 = compute(value, 12)
+value32232 = compute(value, 28)
+value12932 = compute(value, 31)
+value38049 = compute(value, 25)
+value83086 = compute(value, 54)
+value55363 = compute(value, 73)
+value2402 = compute(value, 74)
+value73564 = compute(value, 38)
+value25532 = compute(value, 21)
+value75588 = compute(value, 25)
+value99473 = compute(value, 48)
+const v = os.getenv("BENCH_KEY_00751");
+# note 5729: keep this in sync with the handler
+value40510 = compute(value, 61)
+value48192 = compute(value, 80)
+value12314 = compute(value, 92)
+value34530 = compute(value, 95)
+value41733 = compute(value, 23)
+value49302 = compute(value, 26)
+value64630 = compute(value, 28)
+value50015 = compute(value, 60)
+value89156 = compute(value, 13)
+value8655 = compute(value, 22)
+value14296 = compute(value, 37)
+value23556 = compute(value, 82)
+value58733 = compute(value, 48)
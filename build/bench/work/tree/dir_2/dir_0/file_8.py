@@ -0,0 +1,242 @@
+value94055 = compute(value, 62)
+value44217 = compute(value, 82)
+value75509 = compute(value, 43)
+value26590 = compute(value, 12)
+value15493 = compute(value, 70)
+value64327 = compute(value, 16)
+value44061 = compute(value, 23)
+# note 42705: keep this in sync with the handler
+value86094 = compute(value, 55)
+value65664 = compute(value, 92)
+value6360 = compute(value, 55)
+# note 11830: keep this in sync with the handler
+const v = os.environ["BENCH_KEY_00012"];
+# note 29084: keep this in sync with the handler
+value3868 = compute(value, 85)
+value62686 = compute(value, 24)
+value29446 = compute(value, 55)
+value67792 = compute(value, 86)
+value38840 = compute(value, 40)
+value32608 = compute(value, 16)
+value86956 = compute(value, 44)
+value57720 = compute(value, 5)
+value63754 = compute(value, 25)
+value43548 = compute(value, 92)
+value41423 = compute(value, 4)
+value70696 = compute(value, 80)
+value90151 = compute(value, 38)
+value99606 = compute(value, 84)
+value25928 = compute(value, 29)
+value94626 = compute(value, 51)
+value3189 = compute(value, 85)
+value90802 = compute(value, 10)
+value9121 = compute(value, 3)
+value12571 = compute(value, 58)
+value78751 = compute(value, 84)
+const v = os.getenv("BENCH_KEY_01650");
+value39162 = compute(value, 71)
+value20159 = compute(value, 80)
+value12897 = compute(value, 93)
+value23539 = compute(value, 65)
+# note 10660: keep this in sync with the handler
+value43390 = compute(value, 31)
+value60935 = compute(value, 19)
+value83026 = compute(value, 91)
+value1032 = compute(value, 62)
+value79752 = compute(value, 18)
+value73473 = compute(value, 44)
+value24409 = compute(value, 62)
+value41760 = compute(value, 50)
+value9952 = compute(value, 58)
+const v = os.environ["BENCH_KEY_01392"];
+value91153 = compute(value, 70)
+# note 39636: keep this in sync with the handler
+value36326 = compute(value, 48)
+value76734 = compute(value, 7)
+value45672 = compute(value, 82)
+value34643 = compute(value, 14)
+value1498 = compute(value, 43)
+value28972 = compute(value, 66)
+value55154 = compute(value, 58)
+value25801 = compute(value, 96)
+# note 78648: keep this in sync with the handler
+value4020 = compute(value, 43)
+value35103 = compute(value, 86)
+value40925 = compute(value, 88)
+value25943 = compute(value, 44)
+value178 = compute(value, 81)
+value26605 = compute(value, 27)
+value13383 = compute(value, 94)
+value59999 = compute(value, 53)
+value3163 = compute(value, 59)
+value95441 = compute(value, 90)
+value4335 = compute(value, 67)
+# note 68357: keep this in sync with the handler
+const v = os.environ["BENCH_KEY_00795"];
+value65715 = compute(value, 46)
+# note 95759: keep this in sync with the handler
+value92347 = compute(value, 3)
+value89918 = compute(value, 96)
+value62513 = compute(value, 45)
+value74522 = compute(value, 26)
+value66100 = compute(value, 43)
+value46123 = compute(value, 48)
+value9201 = compute(value, 83)
+value88065 = compute(value, 86)
+value5094 = compute(value, 50)
+value95488 = compute(value, 40)
+value63709 = compute(value, 77)
+const v = os.environ["BENCH_KEY_00128"];
+value53377 = compute(value, 27)
+value70401 = compute(value, 76)
+value84739 = compute(value, 58)
+value63532 = compute(value, 94)
+value22540 = compute(value, 36)
+value98333 = compute(value, 72)
+value37828 = compute(value, 95)
+value91232 = compute(value, 52)
+value80119 = compute(value, 94)
+# note 73595: keep this in sync with the handler
+value51841 = compute(value, 43)
+value1238 = compute(value, 74)
+value98407 = compute(value, 49)
+const v = os.environ["BENCH_KEY_01641"];
+# note 25960: keep this in sync with the handler
+value59074 = compute(value, 1)
+value67132 = compute(value, 8)
+value33955 = compute(value, 5)
+value36536 = compute(value, 64)
+value82561 = compute(value, 14)
+value43809 = compute(value, 62)
+value20014 = compute(value, 32)
+# note 6580: keep this in sync with the handler
+const v = os.environ["BENCH_KEY_00742"];
+value35363 = compute(value, 55)
+value61687 = compute(value, 92)
+value73608 = compute(value, 82)
+value7076 = compute(value, 92)
+# note 51710: keep this in sync with the handler
+value74984 = compute(value, 3)
+value24922 = compute(value, 90)
+value75579 = compute(value, 16)
+value51496 = compute(value, 86)
+value33248 = compute(value, 74)
+const v = os.environ["BENCH_KEY_01884"];
+value73364 = compute(value, 32)
+value7948 = compute(value, 91)
+value39191 = compute(value, 3)
+value2350 = compute(value, 22)
+value58978 = compute(value, 2)
+value37283 = compute(value, 35)
+# note 78022: keep this in sync with the handler
+value13737 = compute(value, 60)
+# note 62127: keep this in sync with the handler
+const v = os.getenv("BENCH_KEY_01270");
+value61632 = compute(value, 37)
+value93890 = compute(value, 91)
+value50067 = compute(value, 15)
+value15083 = compute(value, 48)
+value54203 = compute(value, 77)
+value40441 = compute(value, 89)
+value24304 = compute(value, 54)
+value32038 = compute(value, 28)
+value42462 = compute(value, 73)
+value94877 = compute(value, 11)
+value17570 = compute(value, 13)
+value37745 = compute(value, 12)
+value63077 = compute(value, 27)
+value17706 = compute(value, 52)
+value35229 = compute(value, 18)
+value81769 = compute(value, 95)
+value36162 = compute(value, 78)
+# note 53502: keep this in sync with the handler
+const v = os.getenv("BENCH_KEY_00603");
+value21649 = compute(value, 18)
+value23715 = compute(value, 47)
+# note 14166: keep this in sync with the handler
+value35718 = compute(value, 22)
+# note 70287: keep this in sync with the handler
+value17216 = compute(value, 47)
+value50325 = compute(value, 79)
+# note 80343: keep this in sync with the handler
+value28880 = compute(value, 71)
+# note 32830: keep this in sync with the handler
+const v = os.getenv("BENCH_KEY_01685");
+value89106 = compute(value, 60)
+value55955 = compute(value, 83)
+value60046 = compute(value, 3)
+value29029 = compute(value, 26)
+value60614 = compute(value, 86)
+value80001 = compute(value, 73)
+value35776 = compute(value, 80)
+value41675 = compute(value, 62)
+# note 96915: keep this in sync with the handler
+value52132 = compute(value, 43)
+value95791 = compute(value, 52)
+value96222 = compute(value, 95)
+value84770 = compute(value, 89)
+value44453 = compute(value, 27)
+value47901 = compute(value, 80)
+value37465 = compute(value, 23)
+value24554 = compute(value, 13)
+value16937 = compute(value, 59)
+value68761 = compute(value, 85)
+value25999 = compute(value, 3)
+# note 40837: keep this in sync with the handler
+value6735 = compute(value, 42)
+const v = os.environ.get('BENCH_KEY_01834');
+value37249 = compute(value, 1)
+value38945 = compute(value, 48)
+value23860 = compute(value, 95)
+value8842 = compute(value, 15)
+value68834 = compute(value, 61)
+value48996 = compute(value, 11)
+value64442 = compute(value, 34)
+value80361 = compute(value, 45)
+value50407 = compute(value, 64)
+value85821 = compute(value, 73)
+value373 = compute(value, 82)
+value58512 = compute(value, 21)
+value12203 = compute(value, 78)
+value86631 = compute(value, 10)
+value74166 = compute(value, 58)
+value28254 = compute(value, 27)
+const v = os.environ["BENCH_KEY_00979"];
+value90461 = compute(value, 57)
+value96999 = compute(value, 96)
+value19465 = compute(value, 65)
+value83224 = compute(value, 95)
+value11467 = compute(value, 21)
+value65387 = compute(value, 9)
+value76557 = compute(value, 24)
+value10612 = compute(value, 39)
+value16290 = compute(value, 91)
+value67223 = compute(value, 2)
+value46243 = compute(value, 71)
+value97668 = compute(value, 86)
+value38633 = compute(value, 27)
+value5519 = compute(value, 87)
+value54900 = compute(value, 95)
+value2744 = compute(value, 28)
+value73614 = compute(value, 88)
+value4877 = compute(value, 27)
+value25567 = compute(value, 56)
+value45295 = compute(value, 93)
+const v = os.environ.get('BENCH_KEY_01354');
+value45989 = compute(value, 11)
+value64106 = compute(value, 86)
+value58930 = compute(value, 51)
+value20648 = compute(value, 84)
+value39229 = compute(value, 41)
+value10258 = compute(value, 73)
+value4407 = compute(value, 42)
+value43917 = compute(value, 73)
+value2831 = compute(value, 18)
+const v = os.getenv("BENCH_KEY_00592");
+value34699 = compute(value, 70)
+value94804 = compute(value, 35)
+value85267 = compute(value, 4)
+value64108 = compute(value, 88)
+value5523 = compute(value, 91)
+value93545 = compute(value, 37)
+# note 82888: keep this in sync with the handler
@@ -0,0 +1,212 @@
+let value75135 = compute(value, 57);
+let value15898 = compute(value, 87);
+let value73079 = compute(value, 38);
+const v = env::var("BENCH_KEY_00674");
+let value20649 = compute(value, 85);
+let value38093 = compute(value, 69);
+let value86571 = compute(value, 47);
+let value51161 = compute(value, 42);
+let value42478 = compute(value, 89);
+let value14789 = compute(value, 45);
+let value93429 = compute(value, 18);
+let value65198 = compute(value, 14);
+let value82506 = compute(value, 56);
+let value95850 = compute(value, 14);
+let value50307 = compute(value, 61);
+let value8676 = compute(value, 43);
+let value63302 = compute(value, 58);
+// note 66372: keep this in sync with the handler
+let value42443 = compute(value, 54);
+let value83570 = compute(value, 53);
+// note 50595: keep this in sync with the handler
+let value23157 = compute(value, 71);
+const v = env::var("BENCH_KEY_00929");
+let value81657 = compute(value, 80);
+let value85560 = compute(value, 6);
+let value35010 = compute(value, 90);
+let value12132 = compute(value, 7);
+// note 75065: keep this in sync with the handler
+// note 11408: keep this in sync with the handler
+let value37731 = compute(value, 95);
+const v = env::var_os("BENCH_KEY_00428");
+let value15083 = compute(value, 48);
+// note 70056: keep this in sync with the handler
+let value32380 = compute(value, 79);
+let value92228 = compute(value, 78);
+let value24277 = compute(value, 27);
+let value44318 = compute(value, 86);
+let value68593 = compute(value, 14);
+let value46782 = compute(value, 28);
+let value65333 = compute(value, 52);
+let value92763 = compute(value, 31);
+let value20490 = compute(value, 23);
+let value58206 = compute(value, 6);
+let value75594 = compute(value, 31);
+let value51268 = compute(value, 52);
+let value52966 = compute(value, 4);
+// note 50119: keep this in sync with the handler
+const v = env::var_os("BENCH_KEY_01200");
+// note 73685: keep this in sync with the handler
+let value7307 = compute(value, 32);
+let value15158 = compute(value, 26);
+let value69208 = compute(value, 47);
+let value86212 = compute(value, 76);
+let value21498 = compute(value, 61);
+let value83185 = compute(value, 56);
+let value62898 = compute(value, 42);
+let value61023 = compute(value, 10);
+let value18592 = compute(value, 65);
+let value60792 = compute(value, 70);
+let value86291 = compute(value, 58);
+let value80318 = compute(value, 2);
+const v = env::var("BENCH_KEY_00996");
+// note 2931: keep this in sync with the handler
+let value35071 = compute(value, 54);
+let value69760 = compute(value, 17);
+let value35757 = compute(value, 61);
+let value73273 = compute(value, 38);
+let value30559 = compute(value, 4);
+let value44832 = compute(value, 18);
+let value5161 = compute(value, 20);
+let value48550 = compute(value, 50);
+let value90011 = compute(value, 92);
+let value91060 = compute(value, 74);
+const v = env::var_os("BENCH_KEY_00637");
+let value92656 = compute(value, 21);
+let value31818 = compute(value, 2);
+let value25505 = compute(value, 91);
+let value24578 = compute(value, 37);
+let value37750 = compute(value, 17);
+let value47682 = compute(value, 55);
+let value302 = compute(value, 11);
+let value82828 = compute(value, 87);
+let value75873 = compute(value, 19);
+let value13008 = compute(value, 10);
+let value82572 = compute(value, 25);
+let value54319 = compute(value, 96);
+let value4181 = compute(value, 10);
+let value40947 = compute(value, 13);
+let value5923 = compute(value, 6);
+let value1108 = compute(value, 41);
+let value36463 = compute(value, 88);
+let value43707 = compute(value, 57);
+// note 96164: keep this in sync with the handler
+const v = env::var_os("BENCH_KEY_01243");
+let value24635 = compute(value, 94);
+let value19585 = compute(value, 88);
+let value84502 = compute(value, 15);
+let value92478 = compute(value, 37);
+let value39328 = compute(value, 43);
+let value97805 = compute(value, 29);
+// note 51163: keep this in sync with the handler
+let value80614 = compute(value, 7);
+// note 55289: keep this in sync with the handler
+let value36429 = compute(value, 54);
+const v = env::var_os("BENCH_KEY_00206");
+let value45193 = compute(value, 88);
+let value61312 = compute(value, 8);
+let value94789 = compute(value, 20);
+let value9192 = compute(value, 74);
+// note 21592: keep this in sync with the handler
+let value84208 = compute(value, 12);
+let value91807 = compute(value, 45);
+let value46078 = compute(value, 3);
+let value86323 = compute(value, 90);
+let value70680 = compute(value, 64);
+let value19425 = compute(value, 25);
+let value65379 = compute(value, 1);
+let value65957 = compute(value, 94);
+let value2548 = compute(value, 26);
+// note 2885: keep this in sync with the handler
+const v = env::var_os("BENCH_KEY_01811");
+let value5533 = compute(value, 4);
+let value71353 = compute(value, 58);
+let value72158 = compute(value, 87);
+// note 65969: keep this in sync with the handler
+let value9774 = compute(value, 74);
+let value64955 = compute(value, 62);
+let value93945 = compute(value, 49);
+let value68666 = compute(value, 87);
+let value23225 = compute(value, 42);
+let value21797 = compute(value, 69);
+let value58993 = compute(value, 17);
+let value73005 = compute(value, 61);
+let value88402 = compute(value, 35);
+let value53632 = compute(value, 88);
+let value36805 = compute(value, 42);
+let value58933 = compute(value, 54);
+let value10983 = compute(value, 22);
+let value83693 = compute(value, 79);
+let value47217 = compute(value, 75);
+const v = env::var_os("BENCH_KEY_01787");
+let value54547 = compute(value, 33);
+let value39626 = compute(value, 50);
+let value35673 = compute(value, 74);
+let value64910 = compute(value, 17);
+let value12582 = compute(value, 69);
+let value31901 = compute(value, 85);
+let value5840 = compute(value, 20);
+// note 51514: keep this in sync with the handler
+let value91225 = compute(value, 45);
+const v = env::var_os("BENCH_KEY_00305");
+let value73364 = compute(value, 32);
+let value60830 = compute(value, 11);
+let value96516 = compute(value, 1);
+let value21035 = compute(value, 83);
+// note 14643: keep this in sync with the handler
+let value52421 = compute(value, 41);
+let value85078 = compute(value, 9);
+let value25837 = compute(value, 35);
+let value98787 = compute(value, 41);
+let value6618 = compute(value, 22);
+// note 70653: keep this in sync with the handler
+const v = env::var_os("BENCH_KEY_00571");
+let value85405 = compute(value, 45);
+// note 66724: keep this in sync with the handler
+let value22252 = compute(value, 39);
+let value95521 = compute(value, 73);
+// note 49577: keep this in sync with the handler
+let value72578 = compute(value, 22);
+let value30974 = compute(value, 31);
+let value97394 = compute(value, 6);
+// note 31344: keep this in sync with the handler
+let value87038 = compute(value, 29);
+let value46637 = compute(value, 77);
+let value70663 = compute(value, 47);
+let value93466 = compute(value, 55);
+let value84739 = compute(value, 58);
+let value4713 = compute(value, 57);
+const v = env::var_os("BENCH_KEY_01515");
+let value76264 = compute(value, 22);
+let value27761 = compute(value, 19);
+let value32981 = compute(value, 1);
+let value75509 = compute(value, 43);
+let value3101 = compute(value, 94);
+let value42610 = compute(value, 27);
+let value66369 = compute(value, 21);
+let value50645 = compute(value, 11);
+// note 60824: keep this in sync with the handler
+let value64318 = compute(value, 7);
+let value34954 = compute(value, 34);
+let value53426 = compute(value, 76);
+let value12455 = compute(value, 39);
+// note 80167: keep this in sync with the handler
+let value24451 = compute(value, 7);
+let value58337 = compute(value, 40);
+let value2052 = compute(value, 15);
+let value66080 = compute(value, 23);
+const v = env::var_os("BENCH_KEY_00669");
+let value85906 = compute(value, 61);
+let value27903 = compute(value, 64);
+// note 82504: keep this in sync with the handler
+let value12338 = compute(value, 19);
+let value50592 = compute(value, 55);
+let value16419 = compute(value, 26);
+let value81908 = compute(value, 40);
+let value36776 = compute(value, 13);
+const v = env::var_os("BENCH_KEY_01521");
+let value75780 = compute(value, 23);
+let value47011 = compute(value, 63);
+// note 51172: keep this in sync with the handler
+// note 99600: keep this in sync with the handler
+// note 38980: keep this in sync with the handler
@@ -0,0 +1,201 @@
+const value7043 = compute(value, 59);
+const value39873 = compute(value, 6);
+// note 63667: keep this in sync with the handler
+const value46907 = compute(value, 56);
+const value61834 = compute(value, 45);
+// note 17439: keep this in sync with the handler
+const v = import.meta.env.BENCH_KEY_00616;
+// note 70634: keep this in sync with the handler
+const value23452 = compute(value, 75);
+const value36001 = compute(value, 14);
+const value98694 = compute(value, 45);
+const value66603 = compute(value, 61);
+// note 87794: keep this in sync with the handler
+const value47134 = compute(value, 89);
+// note 57588: keep this in sync with the handler
+const value60525 = compute(value, 94);
+const v = process.env.BENCH_KEY_00179;
+const value88186 = compute(value, 13);
+const value77034 = compute(value, 16);
+const value33718 = compute(value, 59);
+const value66391 = compute(value, 43);
+const value24158 = compute(value, 5);
+const value12402 = compute(value, 83);
+const value59992 = compute(value, 46);
+const value37766 = compute(value, 33);
+const value61371 = compute(value, 67);
+const value40087 = compute(value, 26);
+const value30894 = compute(value, 48);
+const value3469 = compute(value, 74);
+const value61725 = compute(value, 33);
+const value40240 = compute(value, 82);
+const value76076 = compute(value, 28);
+const value2150 = compute(value, 16);
+// note 13265: keep this in sync with the handler
+const value78569 = compute(value, 96);
+const value22012 = compute(value, 90);
+const value51963 = compute(value, 68);
+const v = process.env.BENCH_KEY_01485;
+const value48738 = compute(value, 44);
+const value27489 = compute(value, 38);
+// note 21411: keep this in sync with the handler
+const value48470 = compute(value, 67);
+const value99008 = compute(value, 68);
+// note 30222: keep this in sync with the handler
+const value8006 = compute(value, 52);
+const value44019 = compute(value, 78);
+const value66982 = compute(value, 52);
+const v = import.meta.env.BENCH_KEY_00043;
+const value58805 = compute(value, 23);
+const value98746 = compute(value, 0);
+const value38028 = compute(value, 4);
+// note 15065: keep this in sync with the handler
+const value79925 = compute(value, 94);
+const value21293 = compute(value, 50);
+const value70433 = compute(value, 11);
+const value72620 = compute(value, 64);
+const value36311 = compute(value, 33);
+const value39316 = compute(value, 31);
+// note 90007: keep this in sync with the handler
+const value27561 = compute(value, 13);
+const v = process.env.BENCH_KEY_01878;
+const value63087 = compute(value, 37);
+const value32483 = compute(value, 85);
+const value47894 = compute(value, 73);
+const value42289 = compute(value, 94);
+const value32268 = compute(value, 64);
+const value84849 = compute(value, 71);
+const value53386 = compute(value, 36);
+const value83401 = compute(value, 78);
+const value79701 = compute(value, 64);
+const v = process.env.BENCH_KEY_01682;
+// note 48833: keep this in sync with the handler
+const value98707 = compute(value, 58);
+// note 67741: keep this in sync with the handler
+const value60924 = compute(value, 8);
+// note 52109: keep this in sync with the handler
+const value10338 = compute(value, 56);
+// note 10461: keep this in sync with the handler
+const value56122 = compute(value, 56);
+const value54713 = compute(value, 5);
+const value29111 = compute(value, 11);
+const value5458 = compute(value, 26);
+const value24012 = compute(value, 53);
+const value75521 = compute(value, 55);
+const v = import.meta.env.BENCH_KEY_00339;
+const value18427 = compute(value, 94);
+const value54758 = compute(value, 50);
+const value13433 = compute(value, 47);
+const value12212 = compute(value, 87);
+// note 61338: keep this in sync with the handler
+// note 88795: keep this in sync with the handler
+const value40916 = compute(value, 79);
+const v = process.env["BENCH_KEY_00670"];
+const value51209 = compute(value, 90);
+const value60327 = compute(value, 90);
+// note 64201: keep this in sync with the handler
+const value59231 = compute(value, 61);
+const value79699 = compute(value, 62);
+const value41493 = compute(value, 74);
+// note 49070: keep this in sync with the handler
+const value5900 = compute(value, 80);
+const value17824 = compute(value, 73);
+const value51031 = compute(value, 9);
+// note 34735: keep this in sync with the handler
+const value75661 = compute(value, 1);
+// note 45177: keep this in sync with the handler
+const value27206 = compute(value, 46);
+const v = process.env.BENCH_KEY_00020;
+const value54160 = compute(value, 34);
+const value87543 = compute(value, 49);
+const value72748 = compute(value, 95);
+const value60205 = compute(value, 65);
+// note 39788: keep this in sync with the handler
+const value69392 = compute(value, 37);
+const value83574 = compute(value, 57);
+const value59162 = compute(value, 89);
+const value29008 = compute(value, 5);
+const value80809 = compute(value, 8);
+// note 26390: keep this in sync with the handler
+const value4929 = compute(value, 79);
+const value16283 = compute(value, 84);
+const value99054 = compute(value, 17);
+const value89344 = compute(value, 7);
+const value78910 = compute(value, 49);
+const value22727 = compute(value, 29);
+const v = import.meta.env.BENCH_KEY_00765;
+const value16385 = compute(value, 89);
+const value49825 = compute(value, 64);
+const value80729 = compute(value, 25);
+const value97368 = compute(value, 77);
+const value9175 = compute(value, 57);
+const value24349 = compute(value, 2);
+const value82779 = compute(value, 38);
+const value87714 = compute(value, 26);
+// note 34857: keep this in sync with the handler
+const value58296 = compute(value, 96);
+// note 17333: keep this in sync with the handler
+const value8103 = compute(value, 52);
+const value20633 = compute(value, 69);
+const value72386 = compute(value, 24);
+const value19734 = compute(value, 43);
+const value32205 = compute(value, 1);
+// note 7486: keep this in sync with the handler
+const v = process.env.BENCH_KEY_00343;
+const value23155 = compute(value, 69);
+const value97881 = compute(value, 8);
+const value11486 = compute(value, 40);
+const value1428 = compute(value, 70);
+const value57848 = compute(value, 36);
+// note 81376: keep this in sync with the handler
+const value9835 = compute(value, 38);
+const value59494 = compute(value, 33);
+// note 88288: keep this in sync with the handler
+const value23499 = compute(value, 25);
+const value18918 = compute(value, 3);
+const value68129 = compute(value, 35);
+const value68514 = compute(value, 32);
+const value75417 = compute(value, 48);
+// note 54546: keep this in sync with the handler
+const value90496 = compute(value, 92);
+const v = import.meta.env.BENCH_KEY_00239;
+const value82172 = compute(value, 13);
+const value33183 = compute(value, 9);
+const value37758 = compute(value, 25);
+// note 45007: keep this in sync with the handler
+// note 38205: keep this in sync with the handler
+const value41385 = compute(value, 63);
+// note 49837: keep this in sync with the handler
+const value43015 = compute(value, 44);
+const value70292 = compute(value, 64);
+const value88119 = compute(value, 43);
+const value56041 = compute(value, 72);
+const v = process.env["BENCH_KEY_01558"];
+const value84913 = compute(value, 38);
+const value80383 = compute(value, 67);
+const value54283 = compute(value, 60);
+// note 28662: keep this in sync with the handler
+const value39309 = compute(value, 24);
+const value75671 = compute(value, 11);
+const value3871 = compute(value, 88);
+const value25150 = compute(value, 27);
+const value73225 = compute(value, 87);
+const value41205 = compute(value, 77);
+const value80065 = compute(value, 40);
+const value20688 = compute(value, 27);
+const value23471 = compute(value, 94);
+const value29608 = compute(value, 23);
+// note 63562: keep this in sync with the handler
+const v = process.env.BENCH_KEY_00620;
+const value28637 = compute(value, 22);
+const value40658 = compute(value, 15);
+const value67473 = compute(value, 58);
+const value73612 = compute(value, 86);
+const value52007 = compute(value, 15);
+const value17301 = compute(value, 35);
+const value21177 = compute(value, 31);
+const value63184 = compute(value, 37);
+const value34688 = compute(value, 59);
+const value88949 = compute(value, 0);
+const value8139 = compute(value, 88);
+const value55257 = compute(value, 64);
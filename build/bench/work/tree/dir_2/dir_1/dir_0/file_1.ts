@@ -0,0 +1,204 @@
+const value76472 = compute(value, 36);
+const value48712 = compute(value, 18);
+const value43637 = compute(value, 84);
+const v = process.env.BENCH_KEY_00144;
+const value33147 = compute(value, 70);
+const value32393 = compute(value, 92);
+// note 53738: keep this in sync with the handler
+// note 79597: keep this in sync with the handler
+// note 5695: keep this in sync with the handler
+const value18186 = compute(value, 47);
+const value49792 = compute(value, 31);
+const value46441 = compute(value, 75);
+const value56027 = compute(value, 58);
+const value14850 = compute(value, 9);
+const value81940 = compute(value, 72);
+const value57241 = compute(value, 11);
+const v = import.meta.env.BENCH_KEY_01380;
+const value83351 = compute(value, 28);
+const value93744 = compute(value, 42);
+// note 94269: keep this in sync with the handler
+const value46655 = compute(value, 95);
+const value50097 = compute(value, 45);
+const value29679 = compute(value, 94);
+const value53700 = compute(value, 59);
+const value83298 = compute(value, 72);
+// note 93861: keep this in sync with the handler
+const value48761 = compute(value, 67);
+const value69395 = compute(value, 40);
+const value12466 = compute(value, 50);
+const value35728 = compute(value, 32);
+const value1560 = compute(value, 8);
+const value31035 = compute(value, 92);
+const v = process.env.BENCH_KEY_01123;
+const value19639 = compute(value, 45);
+const value58107 = compute(value, 4);
+// note 41799: keep this in sync with the handler
+const value44007 = compute(value, 66);
+const value48888 = compute(value, 0);
+const value57619 = compute(value, 1);
+const value70894 = compute(value, 84);
+const value76358 = compute(value, 19);
+const value44211 = compute(value, 76);
+// note 80033: keep this in sync with the handler
+const value78588 = compute(value, 18);
+const value86296 = compute(value, 63);
+const value72059 = compute(value, 85);
+const value2226 = compute(value, 92);
+const value31020 = compute(value, 77);
+const v = process.env["BENCH_KEY_00309"];
+const value90666 = compute(value, 68);
+const value55484 = compute(value, 0);
+const value35920 = compute(value, 30);
+const value56097 = compute(value, 31);
+const value97407 = compute(value, 19);
+const value56978 = compute(value, 39);
+const value47730 = compute(value, 6);
+const value75708 = compute(value, 48);
+const value59722 = compute(value, 67);
+const value25290 = compute(value, 70);
+const value22964 = compute(value, 72);
+const value99280 = compute(value, 49);
+const v = process.env.BENCH_KEY_00734;
+const value38908 = compute(value, 11);
+const value40251 = compute(value, 93);
+const value44052 = compute(value, 14);
+const value82459 = compute(value, 9);
+const value71459 = compute(value, 67);
+const value74581 = compute(value, 85);
+const value69581 = compute(value, 32);
+const value36459 = compute(value, 84);
+const value18034 = compute(value, 89);
+const value65627 = compute(value, 55);
+const value49900 = compute(value, 42);
+const v = process.env["BENCH_KEY_01133"];
+const value96536 = compute(value, 21);
+const value4339 = compute(value, 71);
+const value12912 = compute(value, 11);
+const value19981 = compute(value, 96);
+const value28137 = compute(value, 7);
+const value46204 = compute(value, 32);
+// note 65680: keep this in sync with the handler
+// note 19641: keep this in sync with the handler
+const value54894 = compute(value, 89);
+// note 90541: keep this in sync with the handler
+const value6032 = compute(value, 18);
+const value31321 = compute(value, 87);
+const value73519 = compute(value, 90);
+const value48439 = compute(value, 36);
+const value90734 = compute(value, 39);
+// note 56401: keep this in sync with the handler
+// note 26593: keep this in sync with the handler
+const v = process.env["BENCH_KEY_01767"];
+// note 19445: keep this in sync with the handler
+const value68784 = compute(value, 11);
+const value56776 = compute(value, 31);
+const value22960 = compute(value, 68);
+// note 49488: keep this in sync with the handler
+const value83634 = compute(value, 20);
+// note 25763: keep this in sync with the handler
+const v = process.env.BENCH_KEY_00628;
+const value57537 = compute(value, 16);
+// note 48757: keep this in sync with the handler
+const value57978 = compute(value, 69);
+// note 76361: keep this in sync with the handler
+const value57132 = compute(value, 96);
+const value69322 = compute(value, 64);
+const value60883 = compute(value, 64);
+const value24079 = compute(value, 23);
+const value16226 = compute(value, 27);
+const value18401 = compute(value, 68);
+const value9161 = compute(value, 43);
+const value44967 = compute(value, 56);
+const value4767 = compute(value, 14);
+const value21615 = compute(value, 81);
+const value885 = compute(value, 12);
+const value84756 = compute(value, 75);
+const value39425 = compute(value, 43);
+const v = import.meta.env.BENCH_KEY_00320;
+const value17880 = compute(value, 32);
+const value29149 = compute(value, 49);
+const value2369 = compute(value, 41);
+const value80196 = compute(value, 74);
+const value41566 = compute(value, 50);
+const value44667 = compute(value, 47);
+const value83231 = compute(value, 5);
+const value3147 = compute(value, 43);
+const v = import.meta.env.BENCH_KEY_01853;
+const value33420 = compute(value, 52);
+const value28327 = compute(value, 3);
+const value16719 = compute(value, 35);
+const value6901 = compute(value, 14);
+const value805 = compute(value, 29);
+const value55784 = compute(value, 9);
+const value3221 = compute(value, 20);
+const value63665 = compute(value, 33);
+const value67156 = compute(value, 32);
+const value72055 = compute(value, 81);
+const value99123 = compute(value, 86);
+const value62772 = compute(value, 13);
+const value24084 = compute(value, 28);
+const value53990 = compute(value, 58);
+const value80714 = compute(value, 10);
+const value64566 = compute(value, 61);
+const value95736 = compute(value, 94);
+const value44123 = compute(value, 85);
+const value65685 = compute(value, 16);
+const v = process.env["BENCH_KEY_01052"];
+const value2362 = compute(value, 34);
+const value61179 = compute(value, 69);
+const value65395 = compute(value, 17);
+const value17088 = compute(value, 16);
+const value26783 = compute(value, 11);
+// note 47557: keep this in sync with the handler
+const value64926 = compute(value, 33);
+const value73123 = compute(value, 82);
+const value96917 = compute(value, 14);
+const v = process.env["BENCH_KEY_01202"];
+const value13316 = compute(value, 27);
+const value75659 = compute(value, 96);
+const value96036 = compute(value, 6);
+const value29862 = compute(value, 83);
+const value71039 = compute(value, 35);
+// note 20448: keep this in sync with the handler
+const value36343 = compute(value, 65);
+const value12233 = compute(value, 11);
+const value24994 = compute(value, 65);
+const value50455 = compute(value, 15);
+const value19800 = compute(value, 12);
+const v = import.meta.env.BENCH_KEY_00724;
+// note 46907: keep this in sync with the handler
+// note 59789: keep this in sync with the handler
+// note 44927: keep this in sync with the handler
+const value94715 = compute(value, 43);
+const value87533 = compute(value, 39);
+const value90210 = compute(value, 0);
+const value68540 = compute(value, 58);
+const value74312 = compute(value, 10);
+const value533 = compute(value, 48);
+const value50701 = compute(value, 67);
+const value31145 = compute(value, 8);
+const value10148 = compute(value, 60);
+const value2090 = compute(value, 53);
+const value30578 = compute(value, 23);
+const value61689 = compute(value, 94);
+const v = process.env.BENCH_KEY_00950;
+const value4578 = compute(value, 19);
+const value80313 = compute(value, 94);
+const value80374 = compute(value, 58);
+const value89934 = compute(value, 15);
+const value37506 = compute(value, 64);
+// note 34003: keep this in sync with the handler
+const value25835 = compute(value, 33);
+const value79726 = compute(value, 89);
+const value81573 = compute(value, 93);
+const value6945 = compute(value, 58);
+const value18007 = compute(value, 62);
+const value7838 = compute(value, 78);
+const v = import.meta.env.BENCH_KEY_01173;
+// note 49022: keep this in sync with the handler
+// note 2541: keep this in sync with the handler
+const value33185 = compute(value, 11);
+const value11079 = compute(value, 21);
+const value15496 = compute(value, 73);
+const value47944 = compute(value, 26);
@@ -0,0 +1,203 @@
+const value68961 = compute(value, 91);
+const value37027 = compute(value, 70);
+const value94743 = compute(value, 71);
+// note 76876: keep this in sync with the handler
+const value46073 = compute(value, 95);
+const value59055 = compute(value, 79);
+const v = import.meta.env.BENCH_KEY_01776;
+const value92252 = compute(value, 5);
+const value79877 = compute(value, 46);
+const value42875 = compute(value, 1);
+const value33245 = compute(value, 71);
+// note 20445: keep this in sync with the handler
+const value3109 = compute(value, 5);
+const value30422 = compute(value, 61);
+const value50548 = compute(value, 11);
+// note 20823: keep this in sync with the handler
+const value27775 = compute(value, 33);
+const value8566 = compute(value, 30);
+const value57566 = compute(value, 45);
+const value22129 = compute(value, 13);
+const v = process.env["BENCH_KEY_01454"];
+// note 90878: keep this in sync with the handler
+const value31713 = compute(value, 91);
+const value52115 = compute(value, 26);
+const value51615 = compute(value, 11);
+const value557 = compute(value, 72);
+const value93234 = compute(value, 17);
+const value74498 = compute(value, 2);
+const value87163 = compute(value, 57);
+const value2757 = compute(value, 41);
+const value21461 = compute(value, 24);
+const value91515 = compute(value, 44);
+const value54017 = compute(value, 85);
+const value72219 = compute(value, 51);
+const v = import.meta.env.BENCH_KEY_00068;
+const value93423 = compute(value, 12);
+const value98204 = compute(value, 40);
+const value3454 = compute(value, 59);
+const value79860 = compute(value, 29);
+const value1809 = compute(value, 63);
+const value48206 = compute(value, 94);
+const value62408 = compute(value, 37);
+const value37490 = compute(value, 48);
+const value56339 = compute(value, 79);
+const v = process.env["BENCH_KEY_01636"];
+const value91222 = compute(value, 42);
+const value98421 = compute(value, 63);
+const value23271 = compute(value, 88);
+const value6127 = compute(value, 16);
+const value94974 = compute(value, 11);
+// note 48916: keep this in sync with the handler
+const value8394 = compute(value, 52);
+const v = process.env.BENCH_KEY_00375;
+const value52841 = compute(value, 73);
+// note 12948: keep this in sync with the handler
+const value32678 = compute(value, 86);
+// note 19663: keep this in sync with the handler
+// note 801: keep this in sync with the handler
+const value25208 = compute(value, 85);
+const value61020 = compute(value, 7);
+// note 97157: keep this in sync with the handler
+const value48471 = compute(value, 68);
+const value14919 = compute(value, 78);
+const value17418 = compute(value, 55);
+const value89258 = compute(value, 18);
+const v = process.env.BENCH_KEY_00093;
+const value11197 = compute(value, 42);
+const value7420 = compute(value, 48);
+const value15022 = compute(value, 84);
+const value57746 = compute(value, 31);
+const value93621 = compute(value, 16);
+const value81897 = compute(value, 29);
+const value10588 = compute(value, 15);
+const value98787 = compute(value, 41);
+const value12392 = compute(value, 73);
+const value49045 = compute(value, 60);
+const value10781 = compute(value, 14);
+const value88857 = compute(value, 5);
+const value17104 = compute(value, 32);
+// note 79095: keep this in sync with the handler
+const v = process.env.BENCH_KEY_00994;
+const value2903 = compute(value, 90);
+const value93159 = compute(value, 39);
+// note 79427: keep this in sync with the handler
+const value27764 = compute(value, 22);
+const value35826 = compute(value, 33);
+const value22132 = compute(value, 16);
+const value63541 = compute(value, 6);
+const value29936 = compute(value, 60);
+const value79459 = compute(value, 16);
+const v = process.env.BENCH_KEY_01436;
+const value74196 = compute(value, 88);
+const value5695 = compute(value, 69);
+const value97829 = compute(value, 53);
+// note 68441: keep this in sync with the handler
+const value16328 = compute(value, 32);
+const value78132 = compute(value, 47);
+const value17202 = compute(value, 33);
+const value34895 = compute(value, 72);
+const value41112 = compute(value, 81);
+const value70572 = compute(value, 53);
+const value6741 = compute(value, 48);
+const value94367 = compute(value, 83);
+// note 94083: keep this in sync with the handler
+// note 79160: keep this in sync with the handler
+const v = process.env.BENCH_KEY_00238;
+const value87651 = compute(value, 60);
+const value56907 = compute(value, 65);
+const value33999 = compute(value, 49);
+const value61966 = compute(value, 80);
+const value62466 = compute(value, 95);
+const value51926 = compute(value, 31);
+const value84741 = compute(value, 60);
+const value20149 = compute(value, 70);
+const value62746 = compute(value, 84);
+const value87766 = compute(value, 78);
+const value43149 = compute(value, 81);
+const value19477 = compute(value, 77);
+const value10627 = compute(value, 54);
+const value92743 = compute(value, 11);
+const value81686 = compute(value, 12);
+const value81012 = compute(value, 17);
+const value61523 = compute(value, 25);
+const value26992 = compute(value, 26);
+const value80381 = compute(value, 65);
+const value78637 = compute(value, 67);
+const v = process.env.BENCH_KEY_00216;
+const value88667 = compute(value, 9);
+const value70825 = compute(value, 15);
+const value54686 = compute(value, 75);
+const value37061 = compute(value, 7);
+const value49251 = compute(value, 72);
+const value64170 = compute(value, 53);
+const value59468 = compute(value, 7);
+// note 21207: keep this in sync with the handler
+const value98597 = compute(value, 45);
+const value47532 = compute(value, 2);
+const value83531 = compute(value, 14);
+const value54609 = compute(value, 95);
+const value99190 = compute(value, 56);
+const value23772 = compute(value, 7);
+const v = process.env["BENCH_KEY_00580"];
+// note 59200: keep this in sync with the handler
+const value82593 = compute(value, 46);
+const value22977 = compute(value, 85);
+const value7728 = compute(value, 65);
+const value13074 = compute(value, 76);
+const value85864 = compute(value, 19);
+const value79050 = compute(value, 92);
+// note 34376: keep this in sync with the handler
+const v = import.meta.env.BENCH_KEY_00234;
+const value31889 = compute(value, 73);
+const value38380 = compute(value, 65);
+const value44698 = compute(value, 78);
+// note 35538: keep this in sync with the handler
+const value19583 = compute(value, 86);
+const value3742 = compute(value, 56);
+const value91711 = compute(value, 46);
+// note 73176: keep this in sync with the handler
+// note 35997: keep this in sync with the handler
+const v = process.env["BENCH_KEY_00027"];
+const value61268 = compute(value, 61);
+const value66131 = compute(value, 74);
+const value72470 = compute(value, 11);
+const value25150 = compute(value, 27);
+const value93240 = compute(value, 23);
+const value83551 = compute(value, 34);
+const value21264 = compute(value, 21);
+// note 72967: keep this in sync with the handler
+const v = process.env.BENCH_KEY_01069;
+const value54401 = compute(value, 81);
+const value10527 = compute(value, 51);
+const value85636 = compute(value, 82);
+const value44490 = compute(value, 64);
+const value28814 = compute(value, 5);
+const value68626 = compute(value, 47);
+// note 9192: keep this in sync with the handler
+// note 28397: keep this in sync with the handler
+// note 27734: keep this in sync with the handler
+const value29436 = compute(value, 45);
+const value25872 = compute(value, 70);
+const value56210 = compute(value, 47);
+const value51403 = compute(value, 90);
+const value19153 = compute(value, 44);
+const value29287 = compute(value, 90);
+const value16072 = compute(value, 67);
+const value84383 = compute(value, 90);
+const value38139 = compute(value, 18);
+const value54309 = compute(value, 86);
+const v = process.env.BENCH_KEY_01046;
+// note 28818: keep this in sync with the handler
+const value95922 = compute(value, 86);
+const value48264 = compute(value, 55);
+const value11187 = compute(value, 32);
+const value44064 = compute(value, 26);
+const value55111 = compute(value, 15);
+const value5019 = compute(value, 72);
+const v = process.env.BENCH_KEY_00542;
+const value85745 = compute(value, 94);
+const value92325 = compute(value, 78);
+const value85700 = compute(value, 49);
+const value40371 = compute(value, 19);
+// note 62103: keep this in sync with the handler
@@ -0,0 +1,239 @@
+value38327 = compute(value, 12)
+value20288 = compute(value, 15)
+value17775 = compute(value, 24)
+value60970 = compute(value, 54)
+value96173 = compute(value, 46)
+value13 = compute(value, 13)
+value65183 = compute(value, 96)
+value71752 = compute(value, 69)
+value62386 = compute(value, 15)
+value39769 = compute(value, 96)
+const v = os.getenv("BENCH_KEY_01450");
+value58562 = compute(value, 71)
+value3718 = compute(value, 32)
+value6810 = compute(value, 20)
+value56003 = compute(value, 34)
+value21499 = compute(value, 62)
+# note 98495: keep this in sync with the handler
+value48084 = compute(value, 69)
+value60903 = compute(value, 84)
+value41236 = compute(value, 11)
+value29432 = compute(value, 41)
+value21094 = compute(value, 45)
+value37426 = compute(value, 81)
+value45205 = compute(value, 3)
+value23437 = compute(value, 60)
+value45848 = compute(value, 64)
+value19936 = compute(value, 51)
+# note 65561: keep this in sync with the handler
+const v = os.environ.get('BENCH_KEY_00872');
+value63101 = compute(value, 51)
+value84860 = compute(value, 82)
+value48313 = compute(value, 7)
+value31845 = compute(value, 29)
+# note 43846: keep this in sync with the handler
+value17644 = compute(value, 87)
+value44041 = compute(value, 3)
+value82108 = compute(value, 46)
+value32312 = compute(value, 11)
+value83255 = compute(value, 29)
+value27113 = compute(value, 50)
+const v = os.environ.get('BENCH_KEY_01830');
+value45902 = compute(value, 21)
+value75748 = compute(value, 88)
+value5729 = compute(value, 6)
+value9441 = compute(value, 32)
+value6154 = compute(value, 43)
+# note 32249: keep this in sync with the handler
+value85813 = compute(value, 65)
+value12451 = compute(value, 35)
+value31825 = compute(value, 9)
+# note 56049: keep this in sync with the handler
+value31874 = compute(value, 58)
+value49349 = compute(value, 73)
+value28548 = compute(value, 30)
+const v = os.environ.get('BENCH_KEY_00071');
+value23474 = compute(value, 0)
+value94958 = compute(value, 92)
+value5225 = compute(value, 84)
+value83351 = compute(value, 28)
+value81595 = compute(value, 18)
+value91306 = compute(value, 29)
+value16118 = compute(value, 16)
+value94266 = compute(value, 79)
+value4060 = compute(value, 83)
+value85011 = compute(value, 39)
+value66917 = compute(value, 84)
+# note 39465: keep this in sync with the handler
+value32692 = compute(value, 3)
+value1463 = compute(value, 8)
+value60095 = compute(value, 52)
+# note 46977: keep this in sync with the handler
+const v = os.getenv("BENCH_KEY_01464");
+value74463 = compute(value, 64)
+value70364 = compute(value, 39)
+value16299 = compute(value, 3)
+value26392 = compute(value, 8)
+value86663 = compute(value, 42)
+value23161 = compute(value, 75)
+value41555 = compute(value, 39)
+value40869 = compute(value, 32)
+value75366 = compute(value, 94)
+value3891 = compute(value, 11)
+value78862 = compute(value, 1)
+value60142 = compute(value, 2)
+value1898 = compute(value, 55)
+value45652 = compute(value, 62)
+const v = os.environ["BENCH_KEY_01360"];
+value82355 = compute(value, 2)
+value89415 = compute(value, 78)
+value32669 = compute(value, 77)
+value24238 = compute(value, 85)
+value59473 = compute(value, 12)
+value31487 = compute(value, 59)
+value23211 = compute(value, 28)
+# note 95321: keep this in sync with the handler
+value19110 = compute(value, 1)
+# note 51643: keep this in sync with the handler
+value49025 = compute(value, 40)
+# note 31856: keep this in sync with the handler
+value68982 = compute(value, 15)
+value68611 = compute(value, 32)
+const v = os.environ.get('BENCH_KEY_01398');
+value80509 = compute(value, 96)
+value38949 = compute(value, 52)
+value13028 = compute(value, 30)
+value58892 = compute(value, 13)
+value93180 = compute(value, 60)
+value57331 = compute(value, 4)
+value23653 = compute(value, 82)
+value35173 = compute(value, 59)
+value46561 = compute(value, 1)
+value48120 = compute(value, 8)
+value2519 = compute(value, 94)
+value8755 = compute(value, 25)
+value57289 = compute(value, 59)
+value79781 = compute(value, 47)
+value98966 = compute(value, 26)
+# note 15775: keep this in sync with the handler
+value43855 = compute(value, 11)
+value86263 = compute(value, 30)
+const v = os.getenv("BENCH_KEY_01083");
+value76638 = compute(value, 8)
+value83237 = compute(value, 11)
+value46590 = compute(value, 30)
+value78770 = compute(value, 6)
+value94255 = compute(value, 68)
+value87550 = compute(value, 56)
+value93482 = compute(value, 71)
+value49737 = compute(value, 73)
+value12408 = compute(value, 89)
+value98156 = compute(value, 89)
+value91817 = compute(value, 55)
+value80920 = compute(value, 22)
+value97587 = compute(value, 5)
+value39029 = compute(value, 35)
+value75363 = compute(value, 91)
+# note 2482: keep this in sync with the handler
+# note 11963: keep this in sync with the handler
+value55466 = compute(value, 79)
+value66225 = compute(value, 71)
+value4011 = compute(value, 34)
+const v = os.environ["BENCH_KEY_00088"];
+# note 90313: keep this in sync with the handler
+value52011 = compute(value, 19)
+# note 37667: keep this in sync with the handler
+value21153 = compute(value, 7)
+value51063 = compute(value, 41)
+value87425 = compute(value, 28)
+value55564 = compute(value, 80)
+value91614 = compute(value, 46)
+value33691 = compute(value, 32)
+value2874 = compute(value, 61)
+# note 82830: keep this in sync with the handler
+value1939 = compute(value, 96)
+value75267 = compute(value, 92)
+value91579 = compute(value, 11)
+value717 = compute(value, 38)
+value23535 = compute(value, 61)
+value25771 = compute(value, 66)
+value77777 = compute(value, 80)
+# note 82329: keep this in sync with the handler
+const v = os.getenv("BENCH_KEY_01342");
+value7641 = compute(value, 75)
+value63603 = compute(value, 68)
+value4298 = compute(value, 30)
+value54809 = compute(value, 4)
+value16617 = compute(value, 30)
+value98176 = compute(value, 12)
+value8547 = compute(value, 11)
+value66255 = compute(value, 4)
+value40690 = compute(value, 47)
+value42347 = compute(value, 55)
+value15522 = compute(value, 2)
+value47498 = compute(value, 65)
+value61510 = compute(value, 12)
+# note 86160: keep this in sync with the handler
+value6797 = compute(value, 7)
+value76579 = compute(value, 46)
+value13525 = compute(value, 42)
+# note 99687: keep this in sync with the handler
+# note 16779: keep this in sync with the handler
+const v = os.environ["BENCH_KEY_00301"];
+value79766 = compute(value, 32)
+value36006 = compute(value, 19)
+value23996 = compute(value, 37)
+value1410 = compute(value, 52)
+# note 60984: keep this in sync with the handler
+# note 22041: keep this in sync with the handler
+value40833 = compute(value, 93)
+value1714 = compute(value, 65)
+value40359 = compute(value, 7)
+value772 = compute(value, 93)
+value86541 = compute(value, 17)
+const v = os.environ.get('BENCH_KEY_00260');
+value41847 = compute(value, 40)
+value3612 = compute(value, 23)
+value12004 = compute(value, 73)
+value78268 = compute(value, 86)
+value36503 = compute(value, 31)
+# note 82787: keep this in sync with the handler
+value7232 = compute(value, 54)
+# note 60102: keep this in sync with the handler
+value60236 = compute(value, 96)
+const v = os.environ.get('BENCH_KEY_01933');
+value49681 = compute(value, 17)
+# note 14162: keep this in sync with the handler
+value61002 = compute(value, 86)
+# note 31769: keep this in sync with the handler
+value41154 = compute(value, 26)
+# note 4367: keep this in sync with the handler
+value92700 = compute(value, 65)
+value7948 = compute(value, 91)
+value48496 = compute(value, 93)
+value80063 = compute(value, 38)
+value67598 = compute(value, 86)
+value97176 = compute(value, 79)
+value99892 = compute(value, 79)
+value20067 = compute(value, 85)
+value44956 = compute(value, 45)
+value36222 = compute(value, 41)
+value21999 = compute(value, 77)
+value24086 = compute(value, 30)
+value88418 = compute(value, 51)
+value59061 = compute(value, 85)
+const v = os.environ.get('BENCH_KEY_00727');
+value48719 = compute(value, 25)
+value51452 = compute(value, 42)
+value78649 = compute(value, 79)
+value16794 = compute(value, 13)
+value84973 = compute(value, 1)
+value89377 = compute(value, 40)
+value45259 = compute(value, 57)
+value19638 = compute(value, 44)
+value16386 = compute(value, 90)
+value74984 = compute(value, 3)
+value26778 = compute(value, 6)
+value79304 = compute(value, 55)
+value14296 = compute(value, 37)
+value98348 = compute(value, 87)
@@ -0,0 +1,205 @@
+const value69462 = compute(value, 10);
+const value84782 = compute(value, 4);
+const v = import.meta.env.BENCH_KEY_01587;
+const value78058 = compute(value, 70);
+const value87928 = compute(value, 46);
+const value67053 = compute(value, 26);
+const value93994 = compute(value, 1);
+const value1001 = compute(value, 31);
+const value41121 = compute(value, 90);
+// note 3750: keep this in sync with the handler
+const value81432 = compute(value, 49);
+const value18099 = compute(value, 57);
+const value18498 = compute(value, 68);
+const v = process.env.BENCH_KEY_00240;
+const value39173 = compute(value, 82);
+const value11611 = compute(value, 68);
+const value22945 = compute(value, 53);
+const value94511 = compute(value, 33);
+// note 40176: keep this in sync with the handler
+const value99371 = compute(value, 43);
+const value21528 = compute(value, 91);
+const value81705 = compute(value, 31);
+const value74553 = compute(value, 57);
+const value36590 = compute(value, 21);
+const value65912 = compute(value, 49);
+const v = process.env["BENCH_KEY_01233"];
+const value37469 = compute(value, 27);
+const value64233 = compute(value, 19);
+const value62067 = compute(value, 84);
+const value60248 = compute(value, 11);
+const value18178 = compute(value, 39);
+const value15178 = compute(value, 46);
+const value62413 = compute(value, 42);
+// note 53723: keep this in sync with the handler
+const value13961 = compute(value, 90);
+// note 1726: keep this in sync with the handler
+const value86740 = compute(value, 22);
+const v = process.env.BENCH_KEY_01805;
+// note 13693: keep this in sync with the handler
+const value214 = compute(value, 20);
+// note 66563: keep this in sync with the handler
+const value12841 = compute(value, 37);
+const value87503 = compute(value, 9);
+const value68385 = compute(value, 0);
+const value48403 = compute(value, 0);
+const value78816 = compute(value, 52);
+const v = process.env["BENCH_KEY_00333"];
+const value89457 = compute(value, 23);
+const value32418 = compute(value, 20);
+const value63827 = compute(value, 1);
+const value39878 = compute(value, 11);
+const value2000 = compute(value, 60);
+// note 353: keep this in sync with the handler
+const value53245 = compute(value, 89);
+const value91465 = compute(value, 91);
+const value96607 = compute(value, 92);
+const value6831 = compute(value, 41);
+const value54555 = compute(value, 41);
+const value61528 = compute(value, 30);
+const value89549 = compute(value, 18);
+const value1965 = compute(value, 25);
+const v = process.env.BENCH_KEY_00960;
+const value18255 = compute(value, 19);
+// note 44019: keep this in sync with the handler
+const value87321 = compute(value, 21);
+const value92924 = compute(value, 95);
+const value77379 = compute(value, 70);
+const value20971 = compute(value, 19);
+const value79404 = compute(value, 58);
+const value93008 = compute(value, 82);
+const value71498 = compute(value, 9);
+const value10857 = compute(value, 90);
+const value18434 = compute(value, 4);
+const value92944 = compute(value, 18);
+const value63289 = compute(value, 45);
+const value28625 = compute(value, 10);
+const value56209 = compute(value, 46);
+const value18537 = compute(value, 10);
+const value79941 = compute(value, 13);
+const value90854 = compute(value, 62);
+const value83692 = compute(value, 78);
+const v = import.meta.env.BENCH_KEY_01288;
+const value11503 = compute(value, 57);
+const value51603 = compute(value, 96);
+const value28524 = compute(value, 6);
+// note 99875: keep this in sync with the handler
+const value25943 = compute(value, 44);
+const value7678 = compute(value, 15);
+const value74233 = compute(value, 28);
+const value63895 = compute(value, 69);
+const value91919 = compute(value, 60);
+const value85192 = compute(value, 26);
+const value84465 = compute(value, 75);
+const value31853 = compute(value, 37);
+const value23781 = compute(value, 16);
+const value94873 = compute(value, 7);
+const value26548 = compute(value, 67);
+const v = process.env.BENCH_KEY_01843;
+const value73659 = compute(value, 36);
+const value19076 = compute(value, 64);
+const value11288 = compute(value, 36);
+const value61970 = compute(value, 84);
+// note 66015: keep this in sync with the handler
+const value11591 = compute(value, 48);
+const value94302 = compute(value, 18);
+const value11596 = compute(value, 53);
+const value11184 = compute(value, 29);
+const value52306 = compute(value, 23);
+const v = import.meta.env.BENCH_KEY_00104;
+const value80795 = compute(value, 91);
+const value75295 = compute(value, 23);
+const value2181 = compute(value, 47);
+const value46072 = compute(value, 94);
+// note 83959: keep this in sync with the handler
+const value33916 = compute(value, 63);
+const value65565 = compute(value, 90);
+const value69403 = compute(value, 48);
+const value68881 = compute(value, 11);
+const value15562 = compute(value, 42);
+const value24900 = compute(value, 68);
+const value35183 = compute(value, 69);
+const value37878 = compute(value, 48);
+const value8636 = compute(value, 3);
+const value61669 = compute(value, 74);
+const value76550 = compute(value, 17);
+const v = process.env["BENCH_KEY_01785"];
+const value65002 = compute(value, 12);
+const value94089 = compute(value, 96);
+const value67891 = compute(value, 88);
+const value219 = compute(value, 25);
+const value41255 = compute(value, 30);
+const value31440 = compute(value, 12);
+const value97940 = compute(value, 67);
+const value58056 = compute(value, 50);
+const value99323 = compute(value, 92);
+const value73741 = compute(value, 21);
+const value95500 = compute(value, 52);
+// note 68487: keep this in sync with the handler
+const value48590 = compute(value, 90);
+const value64329 = compute(value, 18);
+const value49952 = compute(value, 94);
+const v = process.env["BENCH_KEY_00052"];
+const value53462 = compute(value, 15);
+// note 48089: keep this in sync with the handler
+const value20865 = compute(value, 10);
+const value97262 = compute(value, 68);
+const value48562 = compute(value, 62);
+const value88644 = compute(value, 83);
+// note 17761: keep this in sync with the handler
+const value59387 = compute(value, 23);
+// note 59876: keep this in sync with the handler
+const value30117 = compute(value, 47);
+const value11889 = compute(value, 55);
+const value43362 = compute(value, 3);
+const value99927 = compute(value, 17);
+const value46310 = compute(value, 41);
+const v = import.meta.env.BENCH_KEY_01702;
+// note 27603: keep this in sync with the handler
+// note 68881: keep this in sync with the handler
+const value14359 = compute(value, 3);
+const value42722 = compute(value, 42);
+const value83259 = compute(value, 33);
+const value32163 = compute(value, 56);
+// note 3052: keep this in sync with the handler
+const value56870 = compute(value, 28);
+const value17479 = compute(value, 19);
+const value21927 = compute(value, 5);
+const value15564 = compute(value, 44);
+const value56577 = compute(value, 26);
+const v = process.env.BENCH_KEY_01026;
+const value71647 = compute(value, 61);
+const value66740 = compute(value, 4);
+const value76899 = compute(value, 75);
+const value237 = compute(value, 43);
+const value13029 = compute(value, 31);
+const value40906 = compute(value, 69);
+const value64313 = compute(value, 2);
+const value53518 = compute(value, 71);
+const value29016 = compute(value, 13);
+const value72912 = compute(value, 65);
+const value56913 = compute(value, 71);
+const value97015 = compute(value, 15);
+const value39809 = compute(value, 39);
+const value62841 = compute(value, 82);
+// note 80846: keep this in sync with the handler
+const value25931 = compute(value, 32);
+const v = import.meta.env.BENCH_KEY_00500;
+const value94726 = compute(value, 54);
+const value73061 = compute(value, 20);
+const value92707 = compute(value, 72);
+const value33297 = compute(value, 26);
+// note 24074: keep this in sync with the handler
+const value25704 = compute(value, 96);
+const value10439 = compute(value, 60);
+const value92661 = compute(value, 26);
+const value96308 = compute(value, 84);
+const value18707 = compute(value, 83);
+const v = import.meta.env.BENCH_KEY_01000;
+const value80884 = compute(value, 83);
+const value74514 = compute(value, 18);
+const value58710 = compute(value, 25);
+const value53533 = compute(value, 86);
+const value31032 = compute(value, 89);
+const value42471 = compute(value, 82);
+const value12150 = compute(value, 25);
@@ -0,0 +1,229 @@
+value72366 := compute(value, 4)
+value3281 := compute(value, 80)
+value30962 := compute(value, 19)
+value37327 := compute(value, 79)
+const v = os.LookupEnv("BENCH_KEY_00002");
+// note 9017: keep this in sync with the handler
+value26902 := compute(value, 33)
+value95729 := compute(value, 87)
+value44680 := compute(value, 60)
+// note 50619: keep this in sync with the handler
+value84699 := compute(value, 18)
+value93984 := compute(value, 88)
+value95109 := compute(value, 49)
+value99329 := compute(value, 1)
+value22949 := compute(value, 57)
+value23915 := compute(value, 53)
+value94064 := compute(value, 71)
+value84198 := compute(value, 2)
+// note 38223: keep this in sync with the handler
+value65712 := compute(value, 43)
+value22488 := compute(value, 81)
+// note 56831: keep this in sync with the handler
+value91984 := compute(value, 28)
+value33261 := compute(value, 87)
+value5951 := compute(value, 34)
+// note 11387: keep this in sync with the handler
+const v = os.Getenv("BENCH_KEY_00544");
+// note 64058: keep this in sync with the handler
+value95785 := compute(value, 46)
+value40800 := compute(value, 60)
+// note 28409: keep this in sync with the handler
+value85738 := compute(value, 87)
+// note 97269: keep this in sync with the handler
+value36302 := compute(value, 24)
+value69334 := compute(value, 76)
+value73093 := compute(value, 52)
+// note 61747: keep this in sync with the handler
+value2666 := compute(value, 47)
+value28089 := compute(value, 56)
+value775 := compute(value, 96)
+value94720 := compute(value, 48)
+value21389 := compute(value, 49)
+value48702 := compute(value, 8)
+value24258 := compute(value, 8)
+value33270 := compute(value, 96)
+// note 79520: keep this in sync with the handler
+// note 69097: keep this in sync with the handler
+const v = os.Getenv("BENCH_KEY_01174");
+value11359 := compute(value, 10)
+// note 64202: keep this in sync with the handler
+value54151 := compute(value, 25)
+value24527 := compute(value, 83)
+value48372 := compute(value, 66)
+// note 35334: keep this in sync with the handler
+value33038 := compute(value, 58)
+value36303 := compute(value, 25)
+value61831 := compute(value, 42)
+value39016 := compute(value, 22)
+value36172 := compute(value, 88)
+value80360 := compute(value, 44)
+// note 2953: keep this in sync with the handler
+value53822 := compute(value, 84)
+const v = os.LookupEnv("BENCH_KEY_00443");
+value34580 := compute(value, 48)
+// note 95061: keep this in sync with the handler
+value80266 := compute(value, 47)
+value7321 := compute(value, 46)
+value94942 := compute(value, 76)
+value29012 := compute(value, 9)
+value63922 := compute(value, 96)
+value44643 := compute(value, 23)
+value51345 := compute(value, 32)
+value62699 := compute(value, 37)
+value50852 := compute(value, 24)
+value33130 := compute(value, 53)
+value13017 := compute(value, 19)
+value78298 := compute(value, 19)
+value77567 := compute(value, 64)
+value64456 := compute(value, 48)
+value57592 := compute(value, 71)
+// note 64671: keep this in sync with the handler
+value85463 := compute(value, 6)
+value62844 := compute(value, 85)
+value2246 := compute(value, 15)
+value56105 := compute(value, 39)
+value9186 := compute(value, 68)
+const v = os.LookupEnv("BENCH_KEY_01559");
+value83933 := compute(value, 28)
+value73598 := compute(value, 72)
+value66707 := compute(value, 68)
+value2840 := compute(value, 27)
+value43151 := compute(value, 83)
+// note 45023: keep this in sync with the handler
+value81825 := compute(value, 54)
+value46871 := compute(value, 20)
+value39749 := compute(value, 76)
+value98638 := compute(value, 86)
+const v = os.LookupEnv("BENCH_KEY_01644");
+value94747 := compute(value, 75)
+value83208 := compute(value, 79)
+value41596 := compute(value, 80)
+value78296 := compute(value, 17)
+value49551 := compute(value, 81)
+value60877 := compute(value, 58)
+value35055 := compute(value, 38)
+value14903 := compute(value, 62)
+const v = os.Getenv("BENCH_KEY_01515");
+value11118 := compute(value, 60)
+value86364 := compute(value, 34)
+value87821 := compute(value, 36)
+value7 := compute(value, 7)
+value65326 := compute(value, 45)
+value55612 := compute(value, 31)
+// note 12352: keep this in sync with the handler
+value49507 := compute(value, 37)
+value20407 := compute(value, 37)
+// note 50298: keep this in sync with the handler
+value64972 := compute(value, 79)
+value19324 := compute(value, 21)
+value50280 := compute(value, 34)
+const v = os.LookupEnv("BENCH_KEY_01571");
+value72210 := compute(value, 42)
+value88768 := compute(value, 13)
+value16658 := compute(value, 71)
+value82439 := compute(value, 86)
+value46658 := compute(value, 1)
+value12837 := compute(value, 33)
+value57919 := compute(value, 10)
+value4320 := compute(value, 52)
+// note 48720: keep this in sync with the handler
+// note 36242: keep this in sync with the handler
+value93500 := compute(value, 89)
+value10170 := compute(value, 82)
+value75779 := compute(value, 22)
+value96477 := compute(value, 59)
+value74517 := compute(value, 21)
+const v = os.Getenv("BENCH_KEY_01134");
+// note 10686: keep this in sync with the handler
+value71863 := compute(value, 83)
+value60245 := compute(value, 8)
+value60512 := compute(value, 81)
+// note 69846: keep this in sync with the handler
+value776 := compute(value, 0)
+value76660 := compute(value, 30)
+// note 21131: keep this in sync with the handler
+// note 60891: keep this in sync with the handler
+value31481 := compute(value, 53)
+// note 94824: keep this in sync with the handler
+value85556 := compute(value, 2)
+value54014 := compute(value, 82)
+value11149 := compute(value, 91)
+value1986 := compute(value, 46)
+value58679 := compute(value, 91)
+// note 50717: keep this in sync with the handler
+value16384 := compute(value, 88)
+const v = os.Getenv("BENCH_KEY_00205");
+value15880 := compute(value, 69)
+value5678 := compute(value, 52)
+value96814 := compute(value, 8)
+value91444 := compute(value, 70)
+value51029 := compute(value, 7)
+value48575 := compute(value, 75)
+value79261 := compute(value, 12)
+value50055 := compute(value, 3)
+value11845 := compute(value, 11)
+value98705 := compute(value, 56)
+value92163 := compute(value, 13)
+value80270 := compute(value, 51)
+value79174 := compute(value, 22)
+value68924 := compute(value, 54)
+value60014 := compute(value, 68)
+value50477 := compute(value, 37)
+value93528 := compute(value, 20)
+value7098 := compute(value, 17)
+value23851 := compute(value, 86)
+value91158 := compute(value, 75)
+value34913 := compute(value, 90)
+value56209 := compute(value, 46)
+value3904 := compute(value, 24)
+const v = os.Getenv("BENCH_KEY_00189");
+value69664 := compute(value, 18)
+value3449 := compute(value, 54)
+value20572 := compute(value, 8)
+value55270 := compute(value, 77)
+// note 31934: keep this in sync with the handler
+value88609 := compute(value, 48)
+value12372 := compute(value, 53)
+// note 41635: keep this in sync with the handler
+const v = os.LookupEnv("BENCH_KEY_00551");
+value10734 := compute(value, 64)
+value97081 := compute(value, 81)
+value21813 := compute(value, 85)
+value46530 := compute(value, 67)
+value62893 := compute(value, 37)
+value50365 := compute(value, 22)
+value91758 := compute(value, 93)
+// note 57258: keep this in sync with the handler
+value53550 := compute(value, 6)
+value9860 := compute(value, 63)
+value41313 := compute(value, 88)
+value73530 := compute(value, 4)
+const v = os.Getenv("BENCH_KEY_01513");
+// note 30882: keep this in sync with the handler
+value56132 := compute(value, 66)
+value13998 := compute(value, 30)
+// note 10148: keep this in sync with the handler
+value15922 := compute(value, 14)
+value20586 := compute(value, 22)
+value86370 := compute(value, 40)
+value41630 := compute(value, 17)
+value66425 := compute(value, 77)
+value44282 := compute(value, 50)
+value6455 := compute(value, 53)
+value71764 := compute(value, 81)
+value40651 := compute(value, 8)
+value5303 := compute(value, 65)
+value44849 := compute(value, 35)
+// note 90754: keep this in sync with the handler
+const v = os.LookupEnv("BENCH_KEY_01312");
+value19413 := compute(value, 13)
+value1323 := compute(value, 62)
+value15688 := compute(value, 71)
+value92751 := compute(value, 19)
+value48075 := compute(value, 60)
+value49072 := compute(value, 87)
+// note 29146: keep this in sync with the handler
+value86846 := compute(value, 31)
+value92653 := compute(value, 18)
+value57004 := compute(value, 65)
@@ -0,0 +1,203 @@
+const value69572 = compute(value, 23);
+const value78562 = compute(value, 89);
+// note 33927: keep this in sync with the handler
+const value70193 = compute(value, 62);
+const value36123 = compute(value, 39);
+const value8254 = compute(value, 9);
+const value77641 = compute(value, 41);
+const v = process.env.BENCH_KEY_00775;
+const value34503 = compute(value, 68);
+const value43652 = compute(value, 2);
+const value84636 = compute(value, 52);
+const value1383 = compute(value, 25);
+const value71674 = compute(value, 88);
+const value6004 = compute(value, 87);
+const value30241 = compute(value, 74);
+const value71381 = compute(value, 86);
+// note 45516: keep this in sync with the handler
+const v = import.meta.env.BENCH_KEY_00633;
+const value47141 = compute(value, 96);
+const value99737 = compute(value, 21);
+// note 28933: keep this in sync with the handler
+const value5153 = compute(value, 12);
+const value54491 = compute(value, 74);
+const value26867 = compute(value, 95);
+const value28426 = compute(value, 5);
+const value316 = compute(value, 25);
+const value11388 = compute(value, 39);
+const value27571 = compute(value, 23);
+const value39256 = compute(value, 68);
+const v = process.env.BENCH_KEY_00110;
+// note 44282: keep this in sync with the handler
+// note 22400: keep this in sync with the handler
+const value81719 = compute(value, 45);
+const value38100 = compute(value, 76);
+const value26040 = compute(value, 44);
+const value49257 = compute(value, 78);
+const value90723 = compute(value, 28);
+// note 56224: keep this in sync with the handler
+const value3010 = compute(value, 3);
+const value73425 = compute(value, 93);
+const value10341 = compute(value, 59);
+const value7722 = compute(value, 59);
+const value72535 = compute(value, 76);
+const value46864 = compute(value, 13);
+const v = process.env.BENCH_KEY_01036;
+const value54884 = compute(value, 79);
+const value71892 = compute(value, 15);
+// note 16281: keep this in sync with the handler
+// note 36430: keep this in sync with the handler
+const value29564 = compute(value, 76);
+const value95100 = compute(value, 40);
+const value88092 = compute(value, 16);
+const v = process.env["BENCH_KEY_00265"];
+const value12299 = compute(value, 77);
+// note 4855: keep this in sync with the handler
+const value13770 = compute(value, 93);
+const value92530 = compute(value, 89);
+const value86513 = compute(value, 86);
+const value38512 = compute(value, 3);
+const value89321 = compute(value, 81);
+const value4139 = compute(value, 65);
+const value81113 = compute(value, 21);
+const value34475 = compute(value, 40);
+const value61221 = compute(value, 14);
+const value37352 = compute(value, 7);
+const v = import.meta.env.BENCH_KEY_01441;
+const value83900 = compute(value, 92);
+// note 30786: keep this in sync with the handler
+const value95645 = compute(value, 3);
+const value65248 = compute(value, 64);
+const value23337 = compute(value, 57);
+const value44840 = compute(value, 26);
+const value58748 = compute(value, 63);
+const value90747 = compute(value, 52);
+const value59428 = compute(value, 64);
+const value44505 = compute(value, 79);
+const value24452 = compute(value, 8);
+const value75722 = compute(value, 62);
+const value59120 = compute(value, 47);
+const value54512 = compute(value, 95);
+const value35960 = compute(value, 70);
+const value47736 = compute(value, 12);
+const value44699 = compute(value, 79);
+const v = process.env.BENCH_KEY_01561;
+const value32293 = compute(value, 89);
+// note 93323: keep this in sync with the handler
+const value61535 = compute(value, 37);
+const value63482 = compute(value, 44);
+const value38728 = compute(value, 25);
+// note 16331: keep this in sync with the handler
+const value23128 = compute(value, 42);
+const value62485 = compute(value, 17);
+const value59515 = compute(value, 54);
+const value44879 = compute(value, 65);
+const value95089 = compute(value, 29);
+const value53735 = compute(value, 94);
+const value87497 = compute(value, 3);
+// note 95676: keep this in sync with the handler
+const value30771 = compute(value, 22);
+const value44700 = compute(value, 80);
+// note 91141: keep this in sync with the handler
+const value96056 = compute(value, 26);
+const value47137 = compute(value, 92);
+const v = import.meta.env.BENCH_KEY_01095;
+const value12796 = compute(value, 89);
+const value9696 = compute(value, 93);
+const value32651 = compute(value, 59);
+const value4992 = compute(value, 45);
+const value62942 = compute(value, 86);
+const value64782 = compute(value, 83);
+const value57639 = compute(value, 21);
+const value16429 = compute(value, 36);
+const value2562 = compute(value, 40);
+const v = process.env["BENCH_KEY_01852"];
+const value2322 = compute(value, 91);
+const value46013 = compute(value, 35);
+const value81481 = compute(value, 1);
+const value90627 = compute(value, 29);
+const value73993 = compute(value, 79);
+const value1340 = compute(value, 79);
+// note 58059: keep this in sync with the handler
+// note 40119: keep this in sync with the handler
+const value31608 = compute(value, 83);
+// note 72609: keep this in sync with the handler
+const value99299 = compute(value, 68);
+const value89933 = compute(value, 14);
+const value30230 = compute(value, 63);
+const value88588 = compute(value, 27);
+const value59129 = compute(value, 56);
+const value75063 = compute(value, 82);
+const v = process.env["BENCH_KEY_01195"];
+// note 64076: keep this in sync with the handler
+const value91228 = compute(value, 48);
+const value33547 = compute(value, 82);
+const value29324 = compute(value, 30);
+const value30072 = compute(value, 2);
+const value29566 = compute(value, 78);
+const value98139 = compute(value, 72);
+const v = process.env.BENCH_KEY_01952;
+// note 89094: keep this in sync with the handler
+const value49448 = compute(value, 75);
+// note 28067: keep this in sync with the handler
+const value1875 = compute(value, 32);
+const value10536 = compute(value, 60);
+const value30360 = compute(value, 96);
+const value56024 = compute(value, 55);
+const v = process.env["BENCH_KEY_00714"];
+const value65373 = compute(value, 92);
+const value6320 = compute(value, 15);
+const value99207 = compute(value, 73);
+const value14725 = compute(value, 78);
+const value23478 = compute(value, 4);
+const value78150 = compute(value, 65);
+const value85078 = compute(value, 9);
+// note 37455: keep this in sync with the handler
+const value10516 = compute(value, 40);
+const value24376 = compute(value, 29);
+const value19886 = compute(value, 1);
+const value50142 = compute(value, 90);
+const value23994 = compute(value, 35);
+const value71425 = compute(value, 33);
+const value46461 = compute(value, 95);
+const value9881 = compute(value, 84);
+const value53686 = compute(value, 45);
+const v = process.env.BENCH_KEY_01862;
+// note 57569: keep this in sync with the handler
+const value15260 = compute(value, 31);
+// note 29508: keep this in sync with the handler
+const value12700 = compute(value, 90);
+const value73770 = compute(value, 50);
+const value25410 = compute(value, 93);
+const value71797 = compute(value, 17);
+const value43446 = compute(value, 87);
+const value43612 = compute(value, 59);
+const value95466 = compute(value, 18);
+const value8959 = compute(value, 35);
+const value78543 = compute(value, 70);
+const value42444 = compute(value, 55);
+const v = process.env["BENCH_KEY_00911"];
+const value65706 = compute(value, 37);
+const value71433 = compute(value, 41);
+const value21721 = compute(value, 90);
+const value30714 = compute(value, 62);
+const value50737 = compute(value, 6);
+const value47612 = compute(value, 82);
+const value67386 = compute(value, 68);
+const value35653 = compute(value, 54);
+const value86166 = compute(value, 30);
+const value34011 = compute(value, 61);
+const value59026 = compute(value, 50);
+// note 42795: keep this in sync with the handler
+const value21653 = compute(value, 22);
+const v = process.env["BENCH_KEY_01755"];
+const value55074 = compute(value, 75);
+// note 7825: keep this in sync with the handler
+const value10947 = compute(value, 83);
+const value96187 = compute(value, 60);
+const value59030 = compute(value, 54);
+// note 55983: keep this in sync with the handler
+const value61464 = compute(value, 63);
+const value78776 = compute(value, 12);
+const v = import.meta.env.BENCH_KEY_01581;
+const value84058 = compute(value, 56);
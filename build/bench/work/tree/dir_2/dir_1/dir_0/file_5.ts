@@ -0,0 +1,202 @@
+const value35957 = compute(value, 67);
+const value35581 = compute(value, 79);
+const value35912 = compute(value, 22);
+const value23397 = compute(value, 20);
+// note 46911: keep this in sync with the handler
+const value42361 = compute(value, 69);
+const v = import.meta.env.BENCH_KEY_01581;
+const value82973 = compute(value, 38);
+const value29386 = compute(value, 92);
+const value20024 = compute(value, 42);
+const value94896 = compute(value, 30);
+const value34160 = compute(value, 16);
+const value65869 = compute(value, 6);
+const value87462 = compute(value, 65);
+const value7617 = compute(value, 51);
+// note 6858: keep this in sync with the handler
+const value56283 = compute(value, 23);
+const v = import.meta.env.BENCH_KEY_00488;
+const value29990 = compute(value, 17);
+const value33603 = compute(value, 41);
+const value16438 = compute(value, 45);
+const value99895 = compute(value, 82);
+const value82396 = compute(value, 43);
+const value25618 = compute(value, 10);
+const value95810 = compute(value, 71);
+const v = import.meta.env.BENCH_KEY_01067;
+const value49510 = compute(value, 40);
+const value17454 = compute(value, 91);
+// note 8119: keep this in sync with the handler
+const value23162 = compute(value, 76);
+const value64304 = compute(value, 90);
+const value89042 = compute(value, 93);
+const value74775 = compute(value, 85);
+const value80409 = compute(value, 93);
+const value61360 = compute(value, 56);
+const value74902 = compute(value, 18);
+const value11836 = compute(value, 2);
+const value89528 = compute(value, 94);
+const value18514 = compute(value, 84);
+// note 34668: keep this in sync with the handler
+// note 10495: keep this in sync with the handler
+const v = import.meta.env.BENCH_KEY_00650;
+const value27821 = compute(value, 79);
+const value66606 = compute(value, 64);
+const value25817 = compute(value, 15);
+// note 77705: keep this in sync with the handler
+// note 73070: keep this in sync with the handler
+const value77014 = compute(value, 93);
+const value18658 = compute(value, 34);
+const value82222 = compute(value, 63);
+const value816 = compute(value, 40);
+const value44119 = compute(value, 81);
+const value87438 = compute(value, 41);
+const value95925 = compute(value, 89);
+const value50120 = compute(value, 68);
+const v = import.meta.env.BENCH_KEY_00916;
+const value40818 = compute(value, 78);
+// note 87547: keep this in sync with the handler
+const value45084 = compute(value, 76);
+const value78161 = compute(value, 76);
+const value42981 = compute(value, 10);
+const value99218 = compute(value, 84);
+const value77944 = compute(value, 53);
+const value42771 = compute(value, 91);
+const value76474 = compute(value, 38);
+const v = process.env["BENCH_KEY_01417"];
+// note 85192: keep this in sync with the handler
+const value44513 = compute(value, 87);
+const value40738 = compute(value, 95);
+const value81637 = compute(value, 60);
+// note 3155: keep this in sync with the handler
+// note 63932: keep this in sync with the handler
+const value89189 = compute(value, 46);
+const value8391 = compute(value, 49);
+const value80354 = compute(value, 38);
+const value17497 = compute(value, 37);
+// note 44079: keep this in sync with the handler
+const v = import.meta.env.BENCH_KEY_00481;
+// note 75158: keep this in sync with the handler
+// note 53214: keep this in sync with the handler
+// note 39194: keep this in sync with the handler
+const value69294 = compute(value, 36);
+const value76761 = compute(value, 34);
+const value46523 = compute(value, 60);
+const value79482 = compute(value, 39);
+const value96292 = compute(value, 68);
+const value94244 = compute(value, 57);
+const value18013 = compute(value, 68);
+const value33614 = compute(value, 52);
+const value22511 = compute(value, 7);
+const value69390 = compute(value, 35);
+const value42675 = compute(value, 92);
+const value8980 = compute(value, 56);
+// note 57053: keep this in sync with the handler
+const value50632 = compute(value, 95);
+const value85986 = compute(value, 44);
+const value14438 = compute(value, 82);
+const v = import.meta.env.BENCH_KEY_00004;
+const value14789 = compute(value, 45);
+const value38091 = compute(value, 67);
+const value59098 = compute(value, 25);
+const value21333 = compute(value, 90);
+// note 63123: keep this in sync with the handler
+const value60679 = compute(value, 54);
+// note 52953: keep this in sync with the handler
+// note 46287: keep this in sync with the handler
+// note 87177: keep this in sync with the handler
+const value31323 = compute(value, 89);
+const value92879 = compute(value, 50);
+const value91836 = compute(value, 74);
+const value35564 = compute(value, 62);
+const value42946 = compute(value, 72);
+const value13192 = compute(value, 0);
+const value48425 = compute(value, 22);
+const value38966 = compute(value, 69);
+const value4914 = compute(value, 64);
+const v = process.env.BENCH_KEY_01973;
+const value31736 = compute(value, 17);
+const value28292 = compute(value, 65);
+const value85791 = compute(value, 43);
+const value38251 = compute(value, 33);
+const value78851 = compute(value, 87);
+const value17853 = compute(value, 5);
+const value11814 = compute(value, 77);
+const value41477 = compute(value, 58);
+const value63378 = compute(value, 37);
+const value68688 = compute(value, 12);
+const v = import.meta.env.BENCH_KEY_00653;
+const value23454 = compute(value, 77);
+const value27585 = compute(value, 37);
+const value25701 = compute(value, 93);
+const value27220 = compute(value, 60);
+const value5400 = compute(value, 65);
+const value26922 = compute(value, 53);
+const value88040 = compute(value, 61);
+const value30939 = compute(value, 93);
+const value65450 = compute(value, 72);
+const value33905 = compute(value, 52);
+const value71123 = compute(value, 22);
+const value23736 = compute(value, 68);
+const value62206 = compute(value, 29);
+const value99267 = compute(value, 36);
+const v = process.env.BENCH_KEY_00316;
+const value41080 = compute(value, 49);
+// note 71629: keep this in sync with the handler
+const value40926 = compute(value, 89);
+const value17059 = compute(value, 84);
+const value68502 = compute(value, 20);
+const value4370 = compute(value, 5);
+const value17665 = compute(value, 11);
+// note 53509: keep this in sync with the handler
+const value24586 = compute(value, 45);
+const value52894 = compute(value, 29);
+const value32090 = compute(value, 80);
+const value91144 = compute(value, 61);
+const value45675 = compute(value, 85);
+const value93585 = compute(value, 77);
+const value81450 = compute(value, 67);
+const value82517 = compute(value, 67);
+const value71989 = compute(value, 15);
+const v = import.meta.env.BENCH_KEY_00410;
+const value23022 = compute(value, 33);
+// note 52969: keep this in sync with the handler
+const value94581 = compute(value, 6);
+const value42469 = compute(value, 80);
+const value54820 = compute(value, 15);
+const value45456 = compute(value, 60);
+const value13568 = compute(value, 85);
+const value90361 = compute(value, 54);
+const value47058 = compute(value, 13);
+const value63149 = compute(value, 2);
+const value80202 = compute(value, 80);
+const value88992 = compute(value, 43);
+const value58912 = compute(value, 33);
+// note 55397: keep this in sync with the handler
+const v = process.env["BENCH_KEY_00162"];
+const value5800 = compute(value, 77);
+const value2624 = compute(value, 5);
+const value6787 = compute(value, 94);
+const value69894 = compute(value, 54);
+const value45953 = compute(value, 72);
+const value30484 = compute(value, 26);
+const value88847 = compute(value, 92);
+const value74060 = compute(value, 49);
+const value99768 = compute(value, 52);
+const value50172 = compute(value, 23);
+const value58124 = compute(value, 21);
+const value38642 = compute(value, 36);
+// note 63331: keep this in sync with the handler
+const value57438 = compute(value, 14);
+const value73115 = compute(value, 74);
+// note 29100: keep this in sync with the handler
+const value63044 = compute(value, 91);
+const v = process.env.BENCH_KEY_01744;
+// note 5241: keep this in sync with the handler
+const value27887 = compute(value, 48);
+const value4321 = compute(value, 53);
+const value47393 = compute(value, 57);
+const value66734 = compute(value, 95);
+// note 80386: keep this in sync with the handler
+const value33450 = compute(value, 82);
+// note 47944: keep this in sync with the handler
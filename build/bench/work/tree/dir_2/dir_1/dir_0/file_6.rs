@@ -0,0 +1,212 @@
+let value3921 = compute(value, 41);
+let value76471 = compute(value, 35);
+let value3512 = compute(value, 20);
+let value91089 = compute(value, 6);
+let value13500 = compute(value, 17);
+let value15148 = compute(value, 16);
+let value47746 = compute(value, 22);
+let value72143 = compute(value, 72);
+// note 87733: keep this in sync with the handler
+const v = env::var_os("BENCH_KEY_01951");
+let value9613 = compute(value, 10);
+let value23068 = compute(value, 79);
+let value52725 = compute(value, 54);
+let value7035 = compute(value, 51);
+let value14752 = compute(value, 8);
+let value53433 = compute(value, 83);
+let value68983 = compute(value, 16);
+let value30250 = compute(value, 83);
+const v = env::var_os("BENCH_KEY_01396");
+let value45618 = compute(value, 28);
+let value21876 = compute(value, 51);
+let value36674 = compute(value, 8);
+let value22757 = compute(value, 59);
+let value44526 = compute(value, 3);
+let value72613 = compute(value, 57);
+let value26864 = compute(value, 92);
+let value45296 = compute(value, 94);
+let value55697 = compute(value, 19);
+let value81506 = compute(value, 26);
+let value23348 = compute(value, 68);
+let value4361 = compute(value, 93);
+// note 29032: keep this in sync with the handler
+const v = env::var("BENCH_KEY_01535");
+let value48349 = compute(value, 43);
+let value44676 = compute(value, 56);
+let value27296 = compute(value, 39);
+let value6542 = compute(value, 43);
+let value41870 = compute(value, 63);
+let value93470 = compute(value, 59);
+let value42781 = compute(value, 4);
+let value11089 = compute(value, 31);
+const v = env::var("BENCH_KEY_00344");
+let value4830 = compute(value, 77);
+let value42149 = compute(value, 51);
+let value4986 = compute(value, 39);
+let value62085 = compute(value, 5);
+let value26618 = compute(value, 40);
+let value54802 = compute(value, 94);
+let value12010 = compute(value, 79);
+let value72395 = compute(value, 33);
+let value16562 = compute(value, 72);
+let value24438 = compute(value, 91);
+let value31014 = compute(value, 71);
+let value65713 = compute(value, 44);
+let value95188 = compute(value, 31);
+let value94174 = compute(value, 84);
+let value4534 = compute(value, 72);
+// note 50970: keep this in sync with the handler
+let value6954 = compute(value, 67);
+let value58548 = compute(value, 57);
+let value29205 = compute(value, 8);
+// note 86724: keep this in sync with the handler
+const v = env::var_os("BENCH_KEY_00894");
+let value45464 = compute(value, 68);
+let value7021 = compute(value, 37);
+let value61089 = compute(value, 76);
+let value17474 = compute(value, 14);
+// note 63388: keep this in sync with the handler
+let value91153 = compute(value, 70);
+// note 22256: keep this in sync with the handler
+let value55840 = compute(value, 65);
+let value93229 = compute(value, 12);
+let value60916 = compute(value, 0);
+let value38587 = compute(value, 78);
+let value70631 = compute(value, 15);
+// note 157: keep this in sync with the handler
+// note 65807: keep this in sync with the handler
+const v = env::var("BENCH_KEY_01220");
+let value95441 = compute(value, 90);
+let value26638 = compute(value, 60);
+let value58369 = compute(value, 72);
+let value58453 = compute(value, 59);
+let value9759 = compute(value, 59);
+let value86526 = compute(value, 2);
+// note 64286: keep this in sync with the handler
+let value82348 = compute(value, 92);
+let value95939 = compute(value, 6);
+let value99356 = compute(value, 28);
+let value73166 = compute(value, 28);
+// note 41091: keep this in sync with the handler
+// note 26646: keep this in sync with the handler
+let value75802 = compute(value, 45);
+let value68669 = compute(value, 90);
+let value50008 = compute(value, 53);
+const v = env::var("BENCH_KEY_01027");
+let value65418 = compute(value, 40);
+let value26440 = compute(value, 56);
+let value35465 = compute(value, 60);
+let value37389 = compute(value, 44);
+let value89566 = compute(value, 35);
+let value66092 = compute(value, 35);
+// note 56869: keep this in sync with the handler
+// note 55403: keep this in sync with the handler
+let value19456 = compute(value, 56);
+let value66040 = compute(value, 80);
+// note 97412: keep this in sync with the handler
+const v = env::var("BENCH_KEY_00654");
+let value89390 = compute(value, 53);
+let value74149 = compute(value, 41);
+let value23948 = compute(value, 86);
+// note 80686: keep this in sync with the handler
+let value96093 = compute(value, 63);
+let value88027 = compute(value, 48);
+let value99292 = compute(value, 61);
+let value39351 = compute(value, 66);
+let value62125 = compute(value, 45);
+// note 33447: keep this in sync with the handler
+let value71433 = compute(value, 41);
+let value9446 = compute(value, 37);
+const v = env::var("BENCH_KEY_00205");
+let value75468 = compute(value, 2);
+let value33484 = compute(value, 19);
+// note 13633: keep this in sync with the handler
+let value9307 = compute(value, 92);
+let value69197 = compute(value, 36);
+let value73604 = compute(value, 78);
+let value49691 = compute(value, 27);
+let value55629 = compute(value, 48);
+let value43396 = compute(value, 37);
+let value66879 = compute(value, 46);
+let value12267 = compute(value, 45);
+// note 83193: keep this in sync with the handler
+let value39503 = compute(value, 24);
+let value96539 = compute(value, 24);
+let value75580 = compute(value, 17);
+const v = env::var_os("BENCH_KEY_01879");
+let value10203 = compute(value, 18);
+let value5326 = compute(value, 88);
+let value32435 = compute(value, 37);
+let value78573 = compute(value, 3);
+let value55616 = compute(value, 35);
+let value15058 = compute(value, 23);
+// note 57182: keep this in sync with the handler
+let value10234 = compute(value, 49);
+let value69904 = compute(value, 64);
+let value45832 = compute(value, 48);
+let value4069 = compute(value, 92);
+let value34735 = compute(value, 9);
+let value66648 = compute(value, 9);
+let value37411 = compute(value, 66);
+// note 54837: keep this in sync with the handler
+let value34709 = compute(value, 80);
+let value67352 = compute(value, 34);
+let value10643 = compute(value, 70);
+let value55718 = compute(value, 40);
+let value89416 = compute(value, 79);
+let value81826 = compute(value, 55);
+const v = env::var_os("BENCH_KEY_00469");
+let value38999 = compute(value, 5);
+let value4145 = compute(value, 71);
+let value3637 = compute(value, 48);
+let value93449 = compute(value, 38);
+let value44825 = compute(value, 11);
+// note 94959: keep this in sync with the handler
+let value83263 = compute(value, 37);
+let value68374 = compute(value, 86);
+let value2905 = compute(value, 92);
+// note 69690: keep this in sync with the handler
+let value73500 = compute(value, 71);
+const v = env::var("BENCH_KEY_00230");
+// note 88943: keep this in sync with the handler
+let value17234 = compute(value, 65);
+let value74016 = compute(value, 5);
+let value87189 = compute(value, 83);
+// note 32668: keep this in sync with the handler
+let value83212 = compute(value, 83);
+let value76032 = compute(value, 81);
+let value37281 = compute(value, 33);
+let value2593 = compute(value, 71);
+let value12746 = compute(value, 39);
+let value41261 = compute(value, 36);
+const v = env::var("BENCH_KEY_01872");
+let value69184 = compute(value, 23);
+let value18365 = compute(value, 32);
+let value42262 = compute(value, 67);
+let value51872 = compute(value, 74);
+// note 65203: keep this in sync with the handler
+let value22538 = compute(value, 34);
+let value67316 = compute(value, 95);
+let value71254 = compute(value, 56);
+let value21461 = compute(value, 24);
+let value68004 = compute(value, 7);
+let value53292 = compute(value, 39);
+// note 34268: keep this in sync with the handler
+let value71134 = compute(value, 33);
+let value30617 = compute(value, 62);
+// note 41265: keep this in sync with the handler
+let value61524 = compute(value, 26);
+const v = env::var("BENCH_KEY_01218");
+let value45923 = compute(value, 42);
+let value30781 = compute(value, 32);
+let value51574 = compute(value, 67);
+let value44222 = compute(value, 87);
+let value16287 = compute(value, 88);
+let value69671 = compute(value, 25);
+let value86575 = compute(value, 51);
+let value16039 = compute(value, 34);
+let value40726 = compute(value, 83);
+// note 39021: keep this in sync with the handler
+let value42430 = compute(value, 41);
+const v = env::var_os("BENCH_KEY_00813");
+let value95968 = compute(value, 35);
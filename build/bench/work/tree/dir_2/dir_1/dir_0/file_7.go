@@ -0,0 +1,234 @@
+value63030 := compute(value, 77)
+value41391 := compute(value, 69)
+value47403 := compute(value, 67)
+value20592 := compute(value, 28)
+const v = os.Getenv("BENCH_KEY_00425");
+value16223 := compute(value, 24)
+value95917 := compute(value, 81)
+value73000 := compute(value, 56)
+value97983 := compute(value, 13)
+// note 52047: keep this in sync with the handler
+value64844 := compute(value, 48)
+value58196 := compute(value, 93)
+// note 47877: keep this in sync with the handler
+value25172 := compute(value, 49)
+value16911 := compute(value, 33)
+value85822 := compute(value, 74)
+value2995 := compute(value, 85)
+value49373 := compute(value, 0)
+value47570 := compute(value, 40)
+value40085 := compute(value, 24)
+value5801 := compute(value, 78)
+value44706 := compute(value, 86)
+value65304 := compute(value, 23)
+value98283 := compute(value, 22)
+value55482 := compute(value, 95)
+const v = os.LookupEnv("BENCH_KEY_00265");
+value84812 := compute(value, 34)
+value86783 := compute(value, 65)
+value17571 := compute(value, 14)
+// note 65569: keep this in sync with the handler
+value27924 := compute(value, 85)
+value57530 := compute(value, 9)
+value97859 := compute(value, 83)
+value58650 := compute(value, 62)
+value84474 := compute(value, 84)
+value28789 := compute(value, 77)
+value84538 := compute(value, 51)
+const v = os.Getenv("BENCH_KEY_01064");
+value57921 := compute(value, 12)
+value34331 := compute(value, 90)
+value25374 := compute(value, 57)
+// note 78808: keep this in sync with the handler
+value95575 := compute(value, 30)
+value51223 := compute(value, 7)
+value73098 := compute(value, 57)
+value84300 := compute(value, 7)
+value24559 := compute(value, 18)
+value37098 := compute(value, 44)
+value15413 := compute(value, 87)
+value86557 := compute(value, 33)
+// note 40876: keep this in sync with the handler
+value88088 := compute(value, 12)
+value20698 := compute(value, 37)
+value41303 := compute(value, 78)
+value94257 := compute(value, 70)
+value60367 := compute(value, 33)
+value42099 := compute(value, 1)
+value16525 := compute(value, 35)
+value45474 := compute(value, 78)
+value80627 := compute(value, 20)
+const v = os.Getenv("BENCH_KEY_00432");
+value13768 := compute(value, 91)
+value5706 := compute(value, 80)
+value2950 := compute(value, 40)
+value49962 := compute(value, 7)
+value44462 := compute(value, 36)
+value81308 := compute(value, 22)
+value55224 := compute(value, 31)
+value60140 := compute(value, 0)
+value19436 := compute(value, 36)
+const v = os.LookupEnv("BENCH_KEY_01385");
+value45377 := compute(value, 78)
+value64118 := compute(value, 1)
+value63324 := compute(value, 80)
+value97197 := compute(value, 3)
+value6750 := compute(value, 57)
+// note 45704: keep this in sync with the handler
+value94214 := compute(value, 27)
+value55677 := compute(value, 96)
+value76693 := compute(value, 63)
+// note 59183: keep this in sync with the handler
+value5779 := compute(value, 56)
+value33047 := compute(value, 67)
+value60581 := compute(value, 53)
+value42137 := compute(value, 39)
+value35605 := compute(value, 6)
+const v = os.Getenv("BENCH_KEY_01825");
+value39367 := compute(value, 82)
+value25288 := compute(value, 68)
+value95591 := compute(value, 46)
+value49969 := compute(value, 14)
+value5845 := compute(value, 25)
+value9069 := compute(value, 48)
+value81104 := compute(value, 12)
+value72633 := compute(value, 77)
+value84673 := compute(value, 89)
+value76320 := compute(value, 78)
+value97426 := compute(value, 38)
+value25103 := compute(value, 77)
+const v = os.LookupEnv("BENCH_KEY_01774");
+value35508 := compute(value, 6)
+value50124 := compute(value, 72)
+value2024 := compute(value, 84)
+value14014 := compute(value, 46)
+value52711 := compute(value, 40)
+value29881 := compute(value, 5)
+// note 10157: keep this in sync with the handler
+// note 88123: keep this in sync with the handler
+value36414 := compute(value, 39)
+value40227 := compute(value, 69)
+value96420 := compute(value, 2)
+value84470 := compute(value, 80)
+value48958 := compute(value, 70)
+value49744 := compute(value, 80)
+value18824 := compute(value, 6)
+const v = os.LookupEnv("BENCH_KEY_01067");
+// note 22168: keep this in sync with the handler
+value76291 := compute(value, 49)
+// note 34760: keep this in sync with the handler
+value6128 := compute(value, 17)
+// note 29169: keep this in sync with the handler
+value77121 := compute(value, 6)
+value87185 := compute(value, 79)
+value92815 := compute(value, 83)
+value54935 := compute(value, 33)
+value40670 := compute(value, 27)
+value54675 := compute(value, 64)
+value56147 := compute(value, 81)
+value90208 := compute(value, 95)
+value10888 := compute(value, 24)
+value17020 := compute(value, 45)
+value25857 := compute(value, 55)
+value65876 := compute(value, 13)
+value24022 := compute(value, 63)
+const v = os.LookupEnv("BENCH_KEY_00317");
+// note 83912: keep this in sync with the handler
+value21799 := compute(value, 71)
+value63585 := compute(value, 50)
+// note 77630: keep this in sync with the handler
+value22519 := compute(value, 15)
+// note 87768: keep this in sync with the handler
+value30978 := compute(value, 35)
+value70506 := compute(value, 84)
+value69675 := compute(value, 29)
+const v = os.LookupEnv("BENCH_KEY_00757");
+value84193 := compute(value, 94)
+value10002 := compute(value, 11)
+value16955 := compute(value, 77)
+value21509 := compute(value, 72)
+value90237 := compute(value, 27)
+value12430 := compute(value, 14)
+value20191 := compute(value, 15)
+value49568 := compute(value, 1)
+value43895 := compute(value, 51)
+value45606 := compute(value, 16)
+value74652 := compute(value, 59)
+const v = os.Getenv("BENCH_KEY_00078");
+value70318 := compute(value, 90)
+value15248 := compute(value, 19)
+value16176 := compute(value, 74)
+value28631 := compute(value, 16)
+value90952 := compute(value, 63)
+// note 98750: keep this in sync with the handler
+value36242 := compute(value, 61)
+// note 69611: keep this in sync with the handler
+value27146 := compute(value, 83)
+value35476 := compute(value, 71)
+value85908 := compute(value, 63)
+value4428 := compute(value, 63)
+value17171 := compute(value, 2)
+value25972 := compute(value, 73)
+value99059 := compute(value, 22)
+// note 57437: keep this in sync with the handler
+const v = os.LookupEnv("BENCH_KEY_01792");
+value42448 := compute(value, 59)
+value17886 := compute(value, 38)
+value29982 := compute(value, 9)
+value87459 := compute(value, 62)
+// note 52922: keep this in sync with the handler
+value55003 := compute(value, 4)
+value72410 := compute(value, 48)
+value65174 := compute(value, 87)
+value35752 := compute(value, 56)
+// note 22983: keep this in sync with the handler
+const v = os.Getenv("BENCH_KEY_01306");
+value75215 := compute(value, 40)
+value22781 := compute(value, 83)
+value16494 := compute(value, 4)
+value4941 := compute(value, 91)
+value96933 := compute(value, 30)
+value6781 := compute(value, 88)
+value38666 := compute(value, 60)
+value70702 := compute(value, 86)
+value39773 := compute(value, 3)
+value47833 := compute(value, 12)
+value95147 := compute(value, 87)
+value5039 := compute(value, 92)
+value59772 := compute(value, 20)
+value48718 := compute(value, 24)
+const v = os.Getenv("BENCH_KEY_00607");
+value90965 := compute(value, 76)
+value99119 := compute(value, 82)
+value53428 := compute(value, 78)
+value5734 := compute(value, 11)
+// note 37921: keep this in sync with the handler
+value45897 := compute(value, 16)
+value72548 := compute(value, 89)
+value93088 := compute(value, 65)
+value61807 := compute(value, 18)
+value91157 := compute(value, 74)
+value56006 := compute(value, 37)
+value8893 := compute(value, 66)
+value6178 := compute(value, 67)
+value8685 := compute(value, 52)
+value67364 := compute(value, 46)
+value46521 := compute(value, 58)
+const v = os.LookupEnv("BENCH_KEY_01244");
+value39157 := compute(value, 66)
+value32122 := compute(value, 15)
+value84437 := compute(value, 47)
+value9612 := compute(value, 9)
+value85123 := compute(value, 54)
+value62457 := compute(value, 86)
+value87392 := compute(value, 92)
+value7760 := compute(value, 0)
+value10625 := compute(value, 52)
+value87848 := compute(value, 63)
+// note 429: keep this in sync with the handler
+value21409 := compute(value, 69)
+value66938 := compute(value, 8)
+// note 29425: keep this in sync with the handler
+value90240 := compute(value, 30)
+// note 8602: keep this in sync with the handler
+value907 := compute(value, 34)
@@ -0,0 +1,235 @@
+value34885 := compute(value, 62)
+// note 37877: keep this in sync with the handler
+value7480 := compute(value, 11)
+value46223 := compute(value, 51)
+value18170 := compute(value, 31)
+value5849 := compute(value, 29)
+value58139 := compute(value, 36)
+value67690 := compute(value, 81)
+value72579 := compute(value, 23)
+const v = os.LookupEnv("BENCH_KEY_01039");
+value16710 := compute(value, 26)
+value9770 := compute(value, 70)
+value63977 := compute(value, 54)
+value46935 := compute(value, 84)
+value486 := compute(value, 1)
+value17488 := compute(value, 28)
+value56740 := compute(value, 92)
+value2163 := compute(value, 29)
+value99170 := compute(value, 36)
+value96199 := compute(value, 72)
+value70671 := compute(value, 55)
+value97275 := compute(value, 81)
+value43154 := compute(value, 86)
+value785 := compute(value, 9)
+// note 41550: keep this in sync with the handler
+const v = os.LookupEnv("BENCH_KEY_01245");
+value11142 := compute(value, 84)
+value76886 := compute(value, 62)
+value75456 := compute(value, 87)
+// note 65942: keep this in sync with the handler
+value35857 := compute(value, 64)
+value35675 := compute(value, 76)
+value86600 := compute(value, 76)
+value98395 := compute(value, 37)
+value90554 := compute(value, 53)
+value51549 := compute(value, 42)
+value44516 := compute(value, 90)
+value58107 := compute(value, 4)
+// note 3884: keep this in sync with the handler
+value82758 := compute(value, 17)
+value3399 := compute(value, 4)
+value14387 := compute(value, 31)
+value74027 := compute(value, 16)
+// note 44976: keep this in sync with the handler
+value28998 := compute(value, 92)
+value3252 := compute(value, 51)
+value19507 := compute(value, 10)
+const v = os.Getenv("BENCH_KEY_01601");
+value34429 := compute(value, 91)
+value79756 := compute(value, 22)
+value95574 := compute(value, 29)
+value95953 := compute(value, 20)
+value98250 := compute(value, 86)
+value16891 := compute(value, 13)
+value91865 := compute(value, 6)
+value63816 := compute(value, 87)
+value24030 := compute(value, 71)
+value98029 := compute(value, 59)
+value46418 := compute(value, 52)
+value81437 := compute(value, 54)
+value10716 := compute(value, 46)
+value67039 := compute(value, 12)
+value95083 := compute(value, 23)
+const v = os.LookupEnv("BENCH_KEY_01593");
+value6179 := compute(value, 68)
+value48328 := compute(value, 22)
+value69966 := compute(value, 29)
+value302 := compute(value, 11)
+value94947 := compute(value, 81)
+value85303 := compute(value, 40)
+value76737 := compute(value, 10)
+value17639 := compute(value, 82)
+value39457 := compute(value, 75)
+// note 40663: keep this in sync with the handler
+const v = os.Getenv("BENCH_KEY_00837");
+// note 98559: keep this in sync with the handler
+value53335 := compute(value, 82)
+// note 52813: keep this in sync with the handler
+value78903 := compute(value, 42)
+// note 41753: keep this in sync with the handler
+value82507 := compute(value, 57)
+value91947 := compute(value, 88)
+value66804 := compute(value, 68)
+value73111 := compute(value, 70)
+// note 82309: keep this in sync with the handler
+value8209 := compute(value, 61)
+value91718 := compute(value, 53)
+value50928 := compute(value, 3)
+value95761 := compute(value, 22)
+value15248 := compute(value, 19)
+value98393 := compute(value, 35)
+value60840 := compute(value, 21)
+const v = os.Getenv("BENCH_KEY_00906");
+value25815 := compute(value, 13)
+value66335 := compute(value, 84)
+value46776 := compute(value, 22)
+// note 60049: keep this in sync with the handler
+value91106 := compute(value, 23)
+value71769 := compute(value, 86)
+value99764 := compute(value, 48)
+value54986 := compute(value, 84)
+// note 6147: keep this in sync with the handler
+value53574 := compute(value, 30)
+value39527 := compute(value, 48)
+value98834 := compute(value, 88)
+value30410 := compute(value, 49)
+value75877 := compute(value, 23)
+value43462 := compute(value, 6)
+// note 11845: keep this in sync with the handler
+value23713 := compute(value, 45)
+value36848 := compute(value, 85)
+value46443 := compute(value, 77)
+value13039 := compute(value, 41)
+const v = os.Getenv("BENCH_KEY_00856");
+value8191 := compute(value, 43)
+value75919 := compute(value, 65)
+value27183 := compute(value, 23)
+value24323 := compute(value, 73)
+value17955 := compute(value, 10)
+value38721 := compute(value, 18)
+value74422 := compute(value, 23)
+value98552 := compute(value, 0)
+value11324 := compute(value, 72)
+value83804 := compute(value, 93)
+value34584 := compute(value, 52)
+const v = os.LookupEnv("BENCH_KEY_01734");
+value14827 := compute(value, 83)
+value30584 := compute(value, 29)
+// note 63228: keep this in sync with the handler
+value81845 := compute(value, 74)
+value58306 := compute(value, 9)
+value74878 := compute(value, 91)
+value64731 := compute(value, 32)
+value68771 := compute(value, 95)
+// note 75263: keep this in sync with the handler
+value33451 := compute(value, 83)
+value91301 := compute(value, 24)
+value32615 := compute(value, 23)
+value4032 := compute(value, 55)
+value24239 := compute(value, 86)
+value66074 := compute(value, 17)
+value47797 := compute(value, 73)
+value3887 := compute(value, 7)
+value67480 := compute(value, 65)
+value11730 := compute(value, 90)
+value28916 := compute(value, 10)
+const v = os.LookupEnv("BENCH_KEY_01184");
+value45354 := compute(value, 55)
+value26325 := compute(value, 38)
+value7557 := compute(value, 88)
+// note 80925: keep this in sync with the handler
+value75498 := compute(value, 32)
+value57940 := compute(value, 31)
+value59650 := compute(value, 92)
+value82174 := compute(value, 15)
+value47081 := compute(value, 36)
+value360 := compute(value, 69)
+value10015 := compute(value, 24)
+value56295 := compute(value, 35)
+const v = os.Getenv("BENCH_KEY_00603");
+value20903 := compute(value, 48)
+value96089 := compute(value, 59)
+value75206 := compute(value, 31)
+value421 := compute(value, 33)
+value39672 := compute(value, 96)
+value61814 := compute(value, 25)
+value49797 := compute(value, 36)
+// note 20297: keep this in sync with the handler
+value233 := compute(value, 39)
+value97968 := compute(value, 95)
+value10069 := compute(value, 78)
+value97770 := compute(value, 91)
+value2747 := compute(value, 31)
+value30193 := compute(value, 26)
+value38816 := compute(value, 16)
+// note 55980: keep this in sync with the handler
+const v = os.LookupEnv("BENCH_KEY_01827");
+value74096 := compute(value, 85)
+value79202 := compute(value, 50)
+value70434 := compute(value, 12)
+value34156 := compute(value, 12)
+value42728 := compute(value, 48)
+value62633 := compute(value, 68)
+value20044 := compute(value, 62)
+value3393 := compute(value, 95)
+value81268 := compute(value, 79)
+value65851 := compute(value, 85)
+// note 60220: keep this in sync with the handler
+value575 := compute(value, 90)
+value77794 := compute(value, 0)
+value24043 := compute(value, 84)
+value43610 := compute(value, 57)
+value75478 := compute(value, 12)
+const v = os.LookupEnv("BENCH_KEY_00411");
+value75378 := compute(value, 9)
+value88950 := compute(value, 1)
+value23075 := compute(value, 86)
+value97299 := compute(value, 8)
+value22902 := compute(value, 10)
+value86336 := compute(value, 6)
+value4461 := compute(value, 96)
+value63839 := compute(value, 13)
+// note 32850: keep this in sync with the handler
+value83429 := compute(value, 9)
+// note 45442: keep this in sync with the handler
+const v = os.LookupEnv("BENCH_KEY_00987");
+value82487 := compute(value, 37)
+value46207 := compute(value, 35)
+value41907 := compute(value, 3)
+value43317 := compute(value, 55)
+value97596 := compute(value, 14)
+value53753 := compute(value, 15)
+// note 58983: keep this in sync with the handler
+value2900 := compute(value, 87)
+value841 := compute(value, 65)
+value96610 := compute(value, 95)
+value59573 := compute(value, 15)
+value58585 := compute(value, 94)
+const v = os.Getenv("BENCH_KEY_01955");
+value87401 := compute(value, 4)
+value28556 := compute(value, 38)
+value16263 := compute(value, 64)
+value40380 := compute(value, 28)
+value86127 := compute(value, 88)
+value99212 := compute(value, 78)
+value10290 := compute(value, 8)
+value40441 := compute(value, 89)
+value71379 := compute(value, 84)
+value85334 := compute(value, 71)
+value98186 := compute(value, 22)
+value30276 := compute(value, 12)
+value7156 := compute(value, 75)
+value26017 := compute(value, 21)
+value23963 := compute(value, 4)
+value12136 := compute(value, 11)
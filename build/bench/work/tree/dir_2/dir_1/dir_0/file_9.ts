@@ -0,0 +1,202 @@
+const value98812 = compute(value, 66);
+// note 47169: keep this in sync with the handler
+const v = import.meta.env.BENCH_KEY_00079;
+const value90700 = compute(value, 5);
+const value98839 = compute(value, 93);
+const value85340 = compute(value, 77);
+const value30617 = compute(value, 62);
+const value1952 = compute(value, 12);
+const value48356 = compute(value, 50);
+const value25891 = compute(value, 89);
+const value64403 = compute(value, 92);
+const value1952 = compute(value, 12);
+const value60323 = compute(value, 86);
+const value53035 = compute(value, 73);
+const value85727 = compute(value, 76);
+const v = process.env["BENCH_KEY_00093"];
+const value8509 = compute(value, 70);
+const value5343 = compute(value, 8);
+const value71586 = compute(value, 0);
+const value4145 = compute(value, 71);
+const value99488 = compute(value, 63);
+const value36503 = compute(value, 31);
+const value81261 = compute(value, 72);
+const value55957 = compute(value, 85);
+const value20076 = compute(value, 94);
+// note 83626: keep this in sync with the handler
+// note 86607: keep this in sync with the handler
+const value95716 = compute(value, 74);
+const value37087 = compute(value, 33);
+const value11552 = compute(value, 9);
+const value52137 = compute(value, 48);
+const value76446 = compute(value, 10);
+const value42605 = compute(value, 22);
+const value40594 = compute(value, 48);
+const v = import.meta.env.BENCH_KEY_00982;
+const value96188 = compute(value, 61);
+const value37193 = compute(value, 42);
+const value6556 = compute(value, 57);
+// note 88346: keep this in sync with the handler
+const value15808 = compute(value, 94);
+// note 35102: keep this in sync with the handler
+const value36697 = compute(value, 31);
+const value5835 = compute(value, 15);
+const value40933 = compute(value, 96);
+const value7011 = compute(value, 27);
+const value26141 = compute(value, 48);
+const value58443 = compute(value, 49);
+const value81939 = compute(value, 71);
+const v = process.env.BENCH_KEY_01554;
+const value87022 = compute(value, 13);
+// note 98344: keep this in sync with the handler
+const value36781 = compute(value, 18);
+const value30262 = compute(value, 95);
+const value68526 = compute(value, 44);
+// note 71401: keep this in sync with the handler
+const value67469 = compute(value, 54);
+const value59750 = compute(value, 95);
+const v = process.env.BENCH_KEY_01217;
+const value1482 = compute(value, 27);
+const value49410 = compute(value, 37);
+const value30786 = compute(value, 37);
+const value79509 = compute(value, 66);
+const value9136 = compute(value, 18);
+const value11924 = compute(value, 90);
+const value66771 = compute(value, 35);
+const value67868 = compute(value, 65);
+const value39887 = compute(value, 20);
+// note 47783: keep this in sync with the handler
+const value52174 = compute(value, 85);
+const value75603 = compute(value, 40);
+const value16625 = compute(value, 38);
+const value22120 = compute(value, 4);
+const value85817 = compute(value, 69);
+const value94941 = compute(value, 75);
+// note 11572: keep this in sync with the handler
+const v = process.env.BENCH_KEY_00759;
+const value9962 = compute(value, 68);
+const value87654 = compute(value, 63);
+const value15619 = compute(value, 2);
+const value87172 = compute(value, 66);
+const value78072 = compute(value, 84);
+const value26340 = compute(value, 53);
+const value19050 = compute(value, 38);
+const value76356 = compute(value, 17);
+const value9988 = compute(value, 94);
+const value87584 = compute(value, 90);
+const value68021 = compute(value, 24);
+const value66697 = compute(value, 58);
+// note 3850: keep this in sync with the handler
+const value63276 = compute(value, 32);
+const v = process.env.BENCH_KEY_01594;
+const value12640 = compute(value, 30);
+const value4963 = compute(value, 16);
+const value48068 = compute(value, 53);
+const value24203 = compute(value, 50);
+const value34853 = compute(value, 30);
+// note 35781: keep this in sync with the handler
+// note 58969: keep this in sync with the handler
+const value3822 = compute(value, 39);
+const value89084 = compute(value, 38);
+const value4390 = compute(value, 25);
+// note 31834: keep this in sync with the handler
+const value86437 = compute(value, 10);
+const value18470 = compute(value, 40);
+const value40068 = compute(value, 7);
+// note 43414: keep this in sync with the handler
+const value75348 = compute(value, 76);
+const value14838 = compute(value, 94);
+const value8194 = compute(value, 46);
+// note 82374: keep this in sync with the handler
+const v = import.meta.env.BENCH_KEY_01390;
+const value23451 = compute(value, 74);
+const value57646 = compute(value, 28);
+const value12750 = compute(value, 43);
+const value365 = compute(value, 74);
+const value54984 = compute(value, 82);
+const value43929 = compute(value, 85);
+const value1124 = compute(value, 57);
+const value23262 = compute(value, 79);
+const value92058 = compute(value, 5);
+// note 80502: keep this in sync with the handler
+const value72713 = compute(value, 60);
+const value78345 = compute(value, 66);
+const value37705 = compute(value, 69);
+const value67456 = compute(value, 41);
+// note 77371: keep this in sync with the handler
+const value24888 = compute(value, 56);
+const value95562 = compute(value, 17);
+const v = process.env.BENCH_KEY_00475;
+const value756 = compute(value, 77);
+const value33042 = compute(value, 62);
+// note 95654: keep this in sync with the handler
+const value77925 = compute(value, 34);
+const value75613 = compute(value, 50);
+// note 22852: keep this in sync with the handler
+const value71634 = compute(value, 48);
+const v = process.env.BENCH_KEY_01071;
+const value37874 = compute(value, 44);
+const value30963 = compute(value, 20);
+const value33737 = compute(value, 78);
+const value48226 = compute(value, 17);
+const value78096 = compute(value, 11);
+const value80086 = compute(value, 61);
+const value90334 = compute(value, 27);
+const v = import.meta.env.BENCH_KEY_01470;
+const value72895 = compute(value, 48);
+const value36731 = compute(value, 65);
+const value39042 = compute(value, 48);
+const value75057 = compute(value, 76);
+const value75528 = compute(value, 62);
+const value20777 = compute(value, 19);
+const value82410 = compute(value, 57);
+const value84589 = compute(value, 5);
+// note 74419: keep this in sync with the handler
+const value79150 = compute(value, 95);
+const value2077 = compute(value, 40);
+const value70011 = compute(value, 74);
+// note 30066: keep this in sync with the handler
+const value43340 = compute(value, 78);
+const value77257 = compute(value, 45);
+const value123 = compute(value, 26);
+const value36987 = compute(value, 30);
+const value10856 = compute(value, 89);
+const v = process.env.BENCH_KEY_01166;
+const value31831 = compute(value, 15);
+const value69109 = compute(value, 45);
+const value98965 = compute(value, 25);
+const value47705 = compute(value, 78);
+// note 74767: keep this in sync with the handler
+// note 52491: keep this in sync with the handler
+const value51174 = compute(value, 55);
+const value40150 = compute(value, 89);
+const v = import.meta.env.BENCH_KEY_01587;
+const value76495 = compute(value, 59);
+// note 52763: keep this in sync with the handler
+// note 64835: keep this in sync with the handler
+const value72998 = compute(value, 54);
+const value83438 = compute(value, 18);
+const value43146 = compute(value, 78);
+// note 2922: keep this in sync with the handler
+const value30945 = compute(value, 2);
+// note 69032: keep this in sync with the handler
+const value87266 = compute(value, 63);
+// note 70853: keep this in sync with the handler
+const value17336 = compute(value, 70);
+const v = process.env.BENCH_KEY_01563;
+const value65201 = compute(value, 17);
+const value1046 = compute(value, 76);
+const value45590 = compute(value, 0);
+const value22298 = compute(value, 85);
+const value51379 = compute(value, 66);
+// note 14919: keep this in sync with the handler
+const value49110 = compute(value, 28);
+const value6156 = compute(value, 45);
+const value27866 = compute(value, 27);
+// note 38641: keep this in sync with the handler
+const value24488 = compute(value, 44);
+const value5318 = compute(value, 80);
+const v = import.meta.env.BENCH_KEY_00545;
+const value27935 = compute(value, 96);
+const value79811 = compute(value, 77);
+// note 60006: keep this in sync with the handler
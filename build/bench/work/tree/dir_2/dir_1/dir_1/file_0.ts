@@ -0,0 +1,206 @@
+const value61515 = compute(value, 17);
+const value83820 = compute(value, 12);
+const value2201 = compute(value, 67);
+const value77251 = compute(value, 39);
+const value61868 = compute(value, 79);
+// note 41544: keep this in sync with the handler
+const value95421 = compute(value, 70);
+const value97849 = compute(value, 73);
+const value50408 = compute(value, 65);
+const value78162 = compute(value, 77);
+const value12596 = compute(value, 83);
+const v = process.env["BENCH_KEY_00765"];
+const value36295 = compute(value, 17);
+const value38532 = compute(value, 23);
+const value32319 = compute(value, 18);
+const value93872 = compute(value, 73);
+const value95116 = compute(value, 56);
+const value41079 = compute(value, 48);
+const value60197 = compute(value, 57);
+const value44955 = compute(value, 44);
+const v = process.env.BENCH_KEY_01634;
+const value4244 = compute(value, 73);
+const value96476 = compute(value, 58);
+const value50597 = compute(value, 60);
+const value79363 = compute(value, 17);
+const value80013 = compute(value, 85);
+const value20630 = compute(value, 66);
+const value71690 = compute(value, 7);
+const value88391 = compute(value, 24);
+const value70642 = compute(value, 26);
+const value47043 = compute(value, 95);
+const value65818 = compute(value, 52);
+const v = process.env["BENCH_KEY_01968"];
+const value77664 = compute(value, 64);
+const value56719 = compute(value, 71);
+const value40579 = compute(value, 33);
+const value65929 = compute(value, 66);
+const value45053 = compute(value, 45);
+const value6808 = compute(value, 18);
+const value87657 = compute(value, 66);
+const value34811 = compute(value, 85);
+const value14536 = compute(value, 83);
+const v = process.env.BENCH_KEY_00214;
+const value48119 = compute(value, 7);
+// note 66432: keep this in sync with the handler
+const value58431 = compute(value, 37);
+const value30470 = compute(value, 12);
+// note 63696: keep this in sync with the handler
+const value20257 = compute(value, 81);
+const value28525 = compute(value, 7);
+// note 77073: keep this in sync with the handler
+const value89671 = compute(value, 43);
+const value12810 = compute(value, 6);
+const value48685 = compute(value, 88);
+const value9524 = compute(value, 18);
+const v = process.env.BENCH_KEY_00902;
+const value16767 = compute(value, 83);
+const value1900 = compute(value, 57);
+const value29136 = compute(value, 36);
+const value58063 = compute(value, 57);
+const value6974 = compute(value, 87);
+const value5428 = compute(value, 93);
+const value21135 = compute(value, 86);
+const value94087 = compute(value, 94);
+// note 21854: keep this in sync with the handler
+const value96919 = compute(value, 16);
+const v = process.env["BENCH_KEY_01758"];
+const value91387 = compute(value, 13);
+const value62113 = compute(value, 33);
+const value29966 = compute(value, 90);
+const value3640 = compute(value, 51);
+const value33273 = compute(value, 2);
+const value98851 = compute(value, 8);
+const value14073 = compute(value, 8);
+const value59574 = compute(value, 16);
+const value62633 = compute(value, 68);
+const value95306 = compute(value, 52);
+const value63985 = compute(value, 62);
+const value23495 = compute(value, 21);
+const value98056 = compute(value, 86);
+// note 68455: keep this in sync with the handler
+const value74758 = compute(value, 68);
+const value81293 = compute(value, 7);
+// note 53801: keep this in sync with the handler
+const v = process.env.BENCH_KEY_00038;
+const value48158 = compute(value, 46);
+const value74629 = compute(value, 36);
+const value84111 = compute(value, 12);
+const value72425 = compute(value, 63);
+const value77782 = compute(value, 85);
+// note 26301: keep this in sync with the handler
+const value36786 = compute(value, 23);
+const v = process.env.BENCH_KEY_01571;
+// note 82337: keep this in sync with the handler
+const value70456 = compute(value, 34);
+const value87567 = compute(value, 73);
+const value2099 = compute(value, 62);
+const value11942 = compute(value, 11);
+const value28210 = compute(value, 80);
+const value3261 = compute(value, 60);
+const v = process.env.BENCH_KEY_01553;
+const value71184 = compute(value, 83);
+const value24903 = compute(value, 71);
+// note 41357: keep this in sync with the handler
+const value50704 = compute(value, 70);
+const value84881 = compute(value, 6);
+const value38404 = compute(value, 89);
+const value3326 = compute(value, 28);
+const value90965 = compute(value, 76);
+const value80367 = compute(value, 51);
+const value25564 = compute(value, 53);
+const v = process.env.BENCH_KEY_01548;
+const value60882 = compute(value, 63);
+const value73127 = compute(value, 86);
+const value15461 = compute(value, 38);
+const value38334 = compute(value, 19);
+const value53790 = compute(value, 52);
+const value82129 = compute(value, 67);
+const value54882 = compute(value, 77);
+const value6089 = compute(value, 75);
+const value50109 = compute(value, 57);
+const value2007 = compute(value, 67);
+// note 54447: keep this in sync with the handler
+const value96051 = compute(value, 21);
+const value76844 = compute(value, 20);
+const value99568 = compute(value, 46);
+const v = process.env.BENCH_KEY_01944;
+const value50865 = compute(value, 37);
+const value66990 = compute(value, 60);
+const value37073 = compute(value, 19);
+const value1549 = compute(value, 94);
+const value27030 = compute(value, 64);
+const value78987 = compute(value, 29);
+const value84320 = compute(value, 27);
+const value39067 = compute(value, 73);
+const value74705 = compute(value, 15);
+const value85062 = compute(value, 90);
+const value95461 = compute(value, 13);
+const value4380 = compute(value, 15);
+const value98116 = compute(value, 49);
+const value21850 = compute(value, 25);
+const value95021 = compute(value, 58);
+const v = process.env["BENCH_KEY_00688"];
+const value44937 = compute(value, 26);
+const value57834 = compute(value, 22);
+const value66052 = compute(value, 92);
+const value72433 = compute(value, 71);
+const value69366 = compute(value, 11);
+const value45803 = compute(value, 19);
+const value17657 = compute(value, 3);
+const value17082 = compute(value, 10);
+const v = import.meta.env.BENCH_KEY_01090;
+const value25254 = compute(value, 34);
+const value88996 = compute(value, 47);
+const value76147 = compute(value, 2);
+const value92923 = compute(value, 94);
+const value79152 = compute(value, 0);
+const value82914 = compute(value, 76);
+const value38506 = compute(value, 94);
+const value15281 = compute(value, 52);
+const value68378 = compute(value, 90);
+const value54750 = compute(value, 42);
+// note 67104: keep this in sync with the handler
+// note 70143: keep this in sync with the handler
+const value45365 = compute(value, 66);
+// note 72158: keep this in sync with the handler
+// note 73929: keep this in sync with the handler
+const value59166 = compute(value, 93);
+const v = import.meta.env.BENCH_KEY_01844;
+const value95293 = compute(value, 39);
+const value8264 = compute(value, 19);
+const value98101 = compute(value, 34);
+const value31075 = compute(value, 35);
+const value15053 = compute(value, 18);
+const value73536 = compute(value, 10);
+const value40415 = compute(value, 63);
+// note 17180: keep this in sync with the handler
+const value81514 = compute(value, 34);
+// note 86384: keep this in sync with the handler
+const value16336 = compute(value, 40);
+const value36840 = compute(value, 77);
+const value10210 = compute(value, 25);
+const value5404 = compute(value, 69);
+const value97789 = compute(value, 13);
+const v = process.env["BENCH_KEY_01781"];
+// note 16017: keep this in sync with the handler
+const value53208 = compute(value, 52);
+const value37926 = compute(value, 96);
+const value28184 = compute(value, 54);
+const value3495 = compute(value, 3);
+const value26014 = compute(value, 18);
+const value14943 = compute(value, 5);
+const value82533 = compute(value, 83);
+const value17211 = compute(value, 42);
+const value67083 = compute(value, 56);
+const value53972 = compute(value, 40);
+const value22793 = compute(value, 95);
+const value86670 = compute(value, 49);
+const value41566 = compute(value, 50);
+const value59332 = compute(value, 65);
+const value93667 = compute(value, 62);
+const value9963 = compute(value, 69);
+const value55618 = compute(value, 37);
+const value73821 = compute(value, 4);
+const v = import.meta.env.BENCH_KEY_01970;
+const value2460 = compute(value, 35);
@@ -0,0 +1,205 @@
+const value28614 = compute(value, 96);
+const value91061 = compute(value, 75);
+const value9649 = compute(value, 46);
+const value21331 = compute(value, 88);
+const value60539 = compute(value, 11);
+const value15644 = compute(value, 27);
+const value40322 = compute(value, 67);
+const value48478 = compute(value, 75);
+const value50883 = compute(value, 55);
+const value12382 = compute(value, 63);
+const v = import.meta.env.BENCH_KEY_00898;
+const value63330 = compute(value, 86);
+const value651 = compute(value, 69);
+const value38264 = compute(value, 46);
+const value5130 = compute(value, 86);
+const value9859 = compute(value, 62);
+const value33933 = compute(value, 80);
+const value73901 = compute(value, 84);
+const value5730 = compute(value, 7);
+// note 75573: keep this in sync with the handler
+const v = process.env["BENCH_KEY_00270"];
+const value69882 = compute(value, 42);
+// note 15359: keep this in sync with the handler
+const value9955 = compute(value, 61);
+// note 42159: keep this in sync with the handler
+const value69310 = compute(value, 52);
+const value72288 = compute(value, 23);
+const value90158 = compute(value, 45);
+const v = process.env["BENCH_KEY_01480"];
+const value63042 = compute(value, 89);
+// note 41700: keep this in sync with the handler
+// note 183: keep this in sync with the handler
+const value87330 = compute(value, 30);
+const value10285 = compute(value, 3);
+const value91288 = compute(value, 11);
+const value59281 = compute(value, 14);
+const value89936 = compute(value, 17);
+const value36135 = compute(value, 51);
+const value54728 = compute(value, 20);
+const value94569 = compute(value, 91);
+const value44399 = compute(value, 70);
+const value60573 = compute(value, 45);
+const value71226 = compute(value, 28);
+const value46315 = compute(value, 46);
+// note 79243: keep this in sync with the handler
+const value34091 = compute(value, 44);
+const v = process.env.BENCH_KEY_01857;
+// note 46864: keep this in sync with the handler
+const value84669 = compute(value, 85);
+const value92842 = compute(value, 13);
+const value76571 = compute(value, 38);
+const value74857 = compute(value, 70);
+const value46641 = compute(value, 81);
+const value15761 = compute(value, 47);
+const value33628 = compute(value, 66);
+const value90576 = compute(value, 75);
+const value3168 = compute(value, 64);
+const value42193 = compute(value, 95);
+const value88225 = compute(value, 52);
+// note 9358: keep this in sync with the handler
+const v = import.meta.env.BENCH_KEY_01507;
+const value73749 = compute(value, 29);
+const value26840 = compute(value, 68);
+const value69511 = compute(value, 59);
+// note 24679: keep this in sync with the handler
+const value90756 = compute(value, 61);
+const value30360 = compute(value, 96);
+const value80134 = compute(value, 12);
+const value49724 = compute(value, 60);
+const v = process.env["BENCH_KEY_00180"];
+const value88047 = compute(value, 68);
+const value65787 = compute(value, 21);
+const value44440 = compute(value, 14);
+const value64058 = compute(value, 38);
+const value88241 = compute(value, 68);
+const value59546 = compute(value, 85);
+const value10718 = compute(value, 48);
+// note 63558: keep this in sync with the handler
+const value7397 = compute(value, 25);
+const value28903 = compute(value, 94);
+const v = process.env["BENCH_KEY_00971"];
+// note 32527: keep this in sync with the handler
+const value74190 = compute(value, 82);
+// note 35313: keep this in sync with the handler
+const value4322 = compute(value, 54);
+const value71836 = compute(value, 56);
+const value40362 = compute(value, 10);
+const value85603 = compute(value, 49);
+const value5105 = compute(value, 61);
+const value71445 = compute(value, 53);
+// note 84492: keep this in sync with the handler
+const value64425 = compute(value, 17);
+const value79914 = compute(value, 83);
+const value94810 = compute(value, 41);
+const value34309 = compute(value, 68);
+const v = process.env["BENCH_KEY_00015"];
+const value46608 = compute(value, 48);
+const value54640 = compute(value, 29);
+const value76767 = compute(value, 40);
+// note 85533: keep this in sync with the handler
+const value1159 = compute(value, 92);
+const value30718 = compute(value, 66);
+const value80939 = compute(value, 41);
+const value22894 = compute(value, 2);
+const value32704 = compute(value, 15);
+const value19627 = compute(value, 33);
+const value55811 = compute(value, 36);
+const value76006 = compute(value, 55);
+const value4272 = compute(value, 4);
+const v = process.env["BENCH_KEY_00369"];
+const value17829 = compute(value, 78);
+// note 17708: keep this in sync with the handler
+const value715 = compute(value, 36);
+const value91362 = compute(value, 85);
+const value16317 = compute(value, 21);
+const value67607 = compute(value, 95);
+const value9494 = compute(value, 85);
+const value37818 = compute(value, 85);
+const value30576 = compute(value, 21);
+const value37005 = compute(value, 48);
+const value14825 = compute(value, 81);
+const value44512 = compute(value, 86);
+const value89091 = compute(value, 45);
+const v = process.env["BENCH_KEY_01627"];
+const value58106 = compute(value, 3);
+const value58926 = compute(value, 47);
+const value89448 = compute(value, 14);
+const value1653 = compute(value, 4);
+const value24334 = compute(value, 84);
+const value16637 = compute(value, 50);
+const value98920 = compute(value, 77);
+const value15668 = compute(value, 51);
+const value21493 = compute(value, 56);
+// note 84521: keep this in sync with the handler
+const value16760 = compute(value, 76);
+const value80615 = compute(value, 8);
+const value98919 = compute(value, 76);
+const value61062 = compute(value, 49);
+const v = process.env.BENCH_KEY_01409;
+const value14080 = compute(value, 15);
+const value2194 = compute(value, 60);
+const value19426 = compute(value, 26);
+const value54130 = compute(value, 4);
+const value92601 = compute(value, 63);
+const value71531 = compute(value, 42);
+const value34251 = compute(value, 10);
+// note 66954: keep this in sync with the handler
+const value60490 = compute(value, 59);
+const value84397 = compute(value, 7);
+const value43609 = compute(value, 56);
+// note 25564: keep this in sync with the handler
+// note 44499: keep this in sync with the handler
+const v = process.env["BENCH_KEY_00066"];
+const value6652 = compute(value, 56);
+const value52940 = compute(value, 75);
+const value22098 = compute(value, 79);
+const value91830 = compute(value, 68);
+const value40034 = compute(value, 70);
+const value29320 = compute(value, 26);
+const value88818 = compute(value, 63);
+// note 75584: keep this in sync with the handler
+const value32004 = compute(value, 91);
+const value56219 = compute(value, 56);
+const value3630 = compute(value, 41);
+const v = import.meta.env.BENCH_KEY_00632;
+const value10643 = compute(value, 70);
+const value83633 = compute(value, 19);
+// note 92807: keep this in sync with the handler
+const value93086 = compute(value, 63);
+const value20588 = compute(value, 24);
+const value69813 = compute(value, 70);
+const value13737 = compute(value, 60);
+const value32097 = compute(value, 87);
+const value86010 = compute(value, 68);
+const value57616 = compute(value, 95);
+const value24850 = compute(value, 18);
+const value80406 = compute(value, 90);
+const value57795 = compute(value, 80);
+const value96961 = compute(value, 58);
+const v = import.meta.env.BENCH_KEY_00738;
+const value18 = compute(value, 18);
+const value99643 = compute(value, 24);
+const value66199 = compute(value, 45);
+const value69371 = compute(value, 16);
+const value26009 = compute(value, 13);
+const value2496 = compute(value, 71);
+const value93290 = compute(value, 73);
+const value15524 = compute(value, 4);
+const value30064 = compute(value, 91);
+const value12657 = compute(value, 47);
+const value52512 = compute(value, 35);
+const value80120 = compute(value, 95);
+const value58257 = compute(value, 57);
+const value80810 = compute(value, 9);
+const value44549 = compute(value, 26);
+const v = process.env.BENCH_KEY_01618;
+const value51232 = compute(value, 16);
+const value21146 = compute(value, 0);
+const value26084 = compute(value, 88);
+const value70084 = compute(value, 50);
+const value62584 = compute(value, 19);
+const value33110 = compute(value, 33);
+const value70523 = compute(value, 4);
+const value50422 = compute(value, 79);
+const value71966 = compute(value, 89);
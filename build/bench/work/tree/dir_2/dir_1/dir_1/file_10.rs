@@ -0,0 +1,211 @@
+let value8663 = compute(value, 30);
+let value86916 = compute(value, 4);
+let value18316 = compute(value, 80);
+let value71182 = compute(value, 81);
+let value82216 = compute(value, 57);
+let value21925 = compute(value, 3);
+const v = env::var("BENCH_KEY_00191");
+let value53390 = compute(value, 40);
+let value61610 = compute(value, 15);
+// note 82992: keep this in sync with the handler
+// note 75517: keep this in sync with the handler
+let value87616 = compute(value, 25);
+let value5878 = compute(value, 58);
+let value88995 = compute(value, 46);
+let value32924 = compute(value, 41);
+// note 53638: keep this in sync with the handler
+let value24582 = compute(value, 41);
+let value23748 = compute(value, 80);
+let value24792 = compute(value, 57);
+let value27353 = compute(value, 96);
+const v = env::var("BENCH_KEY_00028");
+let value69052 = compute(value, 85);
+let value66789 = compute(value, 53);
+let value96068 = compute(value, 38);
+let value29576 = compute(value, 88);
+let value54474 = compute(value, 57);
+let value58912 = compute(value, 33);
+let value66026 = compute(value, 66);
+let value8215 = compute(value, 67);
+let value52725 = compute(value, 54);
+let value33089 = compute(value, 12);
+let value71262 = compute(value, 64);
+let value40717 = compute(value, 74);
+let value86143 = compute(value, 7);
+let value34770 = compute(value, 44);
+let value73693 = compute(value, 70);
+const v = env::var("BENCH_KEY_01388");
+let value2572 = compute(value, 50);
+let value94605 = compute(value, 30);
+let value80994 = compute(value, 96);
+let value96012 = compute(value, 79);
+let value45215 = compute(value, 13);
+let value25126 = compute(value, 3);
+let value33970 = compute(value, 20);
+let value85760 = compute(value, 12);
+let value14814 = compute(value, 70);
+let value36743 = compute(value, 77);
+const v = env::var_os("BENCH_KEY_00596");
+let value65178 = compute(value, 91);
+let value42449 = compute(value, 60);
+let value72721 = compute(value, 68);
+let value31270 = compute(value, 36);
+// note 43655: keep this in sync with the handler
+let value44415 = compute(value, 86);
+let value89602 = compute(value, 71);
+let value81641 = compute(value, 64);
+// note 19300: keep this in sync with the handler
+let value7279 = compute(value, 4);
+let value63949 = compute(value, 26);
+let value39921 = compute(value, 54);
+let value18744 = compute(value, 23);
+const v = env::var("BENCH_KEY_00063");
+let value30281 = compute(value, 17);
+// note 18074: keep this in sync with the handler
+let value42382 = compute(value, 90);
+let value99073 = compute(value, 36);
+let value65655 = compute(value, 83);
+let value84830 = compute(value, 52);
+let value74188 = compute(value, 80);
+let value83797 = compute(value, 86);
+let value83403 = compute(value, 80);
+let value39770 = compute(value, 0);
+let value895 = compute(value, 22);
+let value6053 = compute(value, 39);
+const v = env::var_os("BENCH_KEY_01364");
+let value16603 = compute(value, 16);
+let value51408 = compute(value, 95);
+let value52313 = compute(value, 30);
+let value17997 = compute(value, 52);
+let value55086 = compute(value, 87);
+let value6689 = compute(value, 93);
+let value93913 = compute(value, 17);
+let value17701 = compute(value, 47);
+// note 67616: keep this in sync with the handler
+let value56896 = compute(value, 54);
+let value96498 = compute(value, 80);
+let value16709 = compute(value, 25);
+let value6708 = compute(value, 15);
+let value22998 = compute(value, 9);
+let value1913 = compute(value, 70);
+let value43506 = compute(value, 50);
+let value87397 = compute(value, 0);
+const v = env::var("BENCH_KEY_00251");
+let value71478 = compute(value, 86);
+let value14833 = compute(value, 89);
+let value88448 = compute(value, 81);
+let value39024 = compute(value, 30);
+// note 60450: keep this in sync with the handler
+let value7448 = compute(value, 76);
+let value14416 = compute(value, 60);
+let value10418 = compute(value, 39);
+let value91258 = compute(value, 78);
+let value29647 = compute(value, 62);
+// note 46096: keep this in sync with the handler
+let value70512 = compute(value, 90);
+let value60654 = compute(value, 29);
+let value22167 = compute(value, 51);
+let value47321 = compute(value, 82);
+let value7261 = compute(value, 83);
+let value97518 = compute(value, 33);
+let value59297 = compute(value, 30);
+// note 57664: keep this in sync with the handler
+const v = env::var_os("BENCH_KEY_01936");
+let value21447 = compute(value, 10);
+let value39217 = compute(value, 29);
+// note 41863: keep this in sync with the handler
+let value61124 = compute(value, 14);
+// note 16473: keep this in sync with the handler
+let value77298 = compute(value, 86);
+let value81086 = compute(value, 91);
+// note 34309: keep this in sync with the handler
+// note 91111: keep this in sync with the handler
+let value48257 = compute(value, 48);
+let value51521 = compute(value, 14);
+let value57011 = compute(value, 72);
+let value60091 = compute(value, 48);
+let value29257 = compute(value, 60);
+// note 37426: keep this in sync with the handler
+let value85061 = compute(value, 89);
+let value24634 = compute(value, 93);
+let value6414 = compute(value, 12);
+const v = env::var_os("BENCH_KEY_01879");
+let value21522 = compute(value, 85);
+// note 3927: keep this in sync with the handler
+let value37160 = compute(value, 9);
+let value93793 = compute(value, 91);
+let value81198 = compute(value, 9);
+let value66452 = compute(value, 7);
+let value32653 = compute(value, 61);
+// note 56417: keep this in sync with the handler
+// note 9211: keep this in sync with the handler
+// note 23580: keep this in sync with the handler
+let value44727 = compute(value, 10);
+let value5613 = compute(value, 84);
+let value36284 = compute(value, 6);
+// note 62976: keep this in sync with the handler
+let value42285 = compute(value, 90);
+let value8597 = compute(value, 61);
+let value76301 = compute(value, 59);
+const v = env::var("BENCH_KEY_00409");
+// note 91687: keep this in sync with the handler
+let value16869 = compute(value, 88);
+let value84712 = compute(value, 31);
+let value51421 = compute(value, 11);
+let value49764 = compute(value, 3);
+let value16452 = compute(value, 59);
+let value82594 = compute(value, 47);
+let value22438 = compute(value, 31);
+// note 22253: keep this in sync with the handler
+// note 88294: keep this in sync with the handler
+let value34365 = compute(value, 27);
+let value10917 = compute(value, 53);
+// note 81133: keep this in sync with the handler
+let value15031 = compute(value, 93);
+// note 84792: keep this in sync with the handler
+let value5765 = compute(value, 42);
+let value73933 = compute(value, 19);
+const v = env::var_os("BENCH_KEY_01780");
+let value52476 = compute(value, 96);
+let value50021 = compute(value, 66);
+let value23085 = compute(value, 96);
+let value87670 = compute(value, 79);
+let value12459 = compute(value, 43);
+// note 27037: keep this in sync with the handler
+let value60099 = compute(value, 56);
+let value56293 = compute(value, 33);
+// note 12114: keep this in sync with the handler
+let value12733 = compute(value, 26);
+const v = env::var("BENCH_KEY_00051");
+let value37012 = compute(value, 55);
+// note 21966: keep this in sync with the handler
+// note 89103: keep this in sync with the handler
+let value50476 = compute(value, 36);
+let value6355 = compute(value, 50);
+let value16125 = compute(value, 23);
+// note 79020: keep this in sync with the handler
+let value39562 = compute(value, 83);
+let value5481 = compute(value, 49);
+let value95478 = compute(value, 30);
+let value98952 = compute(value, 12);
+let value65704 = compute(value, 35);
+// note 3517: keep this in sync with the handler
+let value82948 = compute(value, 13);
+let value6923 = compute(value, 36);
+let value52546 = compute(value, 69);
+let value3041 = compute(value, 34);
+const v = env::var_os("BENCH_KEY_01555");
+let value68452 = compute(value, 67);
+let value83675 = compute(value, 61);
+let value88412 = compute(value, 45);
+let value429 = compute(value, 41);
+let value12043 = compute(value, 15);
+let value90142 = compute(value, 29);
+let value57046 = compute(value, 10);
+let value20525 = compute(value, 58);
+let value24902 = compute(value, 70);
+let value602 = compute(value, 20);
+let value11074 = compute(value, 16);
+let value80976 = compute(value, 78);
+let value12413 = compute(value, 94);
+const v = env::var_os("BENCH_KEY_01967");
@@ -0,0 +1,204 @@
+const value6795 = compute(value, 5);
+const value94761 = compute(value, 89);
+// note 2108: keep this in sync with the handler
+// note 53486: keep this in sync with the handler
+const value39756 = compute(value, 83);
+// note 30965: keep this in sync with the handler
+const value79988 = compute(value, 60);
+const value16228 = compute(value, 29);
+const value46346 = compute(value, 77);
+const v = process.env["BENCH_KEY_00987"];
+const value18389 = compute(value, 56);
+const value12563 = compute(value, 50);
+const value67821 = compute(value, 18);
+const value90635 = compute(value, 37);
+const value45999 = compute(value, 21);
+const value75868 = compute(value, 14);
+// note 39520: keep this in sync with the handler
+const v = process.env["BENCH_KEY_01461"];
+const value83003 = compute(value, 68);
+const value48642 = compute(value, 45);
+const value14733 = compute(value, 86);
+const value96897 = compute(value, 91);
+const value60761 = compute(value, 39);
+const value47931 = compute(value, 13);
+const value7838 = compute(value, 78);
+const value35909 = compute(value, 19);
+const value56717 = compute(value, 69);
+const value899 = compute(value, 26);
+const value54410 = compute(value, 90);
+const value77076 = compute(value, 58);
+const value18664 = compute(value, 40);
+const value49770 = compute(value, 9);
+const value20060 = compute(value, 78);
+// note 44553: keep this in sync with the handler
+// note 22731: keep this in sync with the handler
+const v = process.env.BENCH_KEY_01815;
+const value36801 = compute(value, 38);
+const value22622 = compute(value, 21);
+const value76601 = compute(value, 68);
+const value23107 = compute(value, 21);
+const value21560 = compute(value, 26);
+const value99903 = compute(value, 90);
+const value58096 = compute(value, 90);
+const v = process.env.BENCH_KEY_01827;
+const value58497 = compute(value, 6);
+const value75937 = compute(value, 83);
+const value5328 = compute(value, 90);
+const value69585 = compute(value, 36);
+const value62548 = compute(value, 80);
+const value87563 = compute(value, 69);
+const value8532 = compute(value, 93);
+const value30741 = compute(value, 89);
+const value44640 = compute(value, 20);
+const value60871 = compute(value, 52);
+const value72767 = compute(value, 17);
+// note 53047: keep this in sync with the handler
+const v = import.meta.env.BENCH_KEY_01554;
+const value51164 = compute(value, 45);
+const value96180 = compute(value, 53);
+const value24330 = compute(value, 80);
+const value93292 = compute(value, 75);
+const value88545 = compute(value, 81);
+const value93777 = compute(value, 75);
+const value47729 = compute(value, 5);
+const v = process.env["BENCH_KEY_00124"];
+// note 26981: keep this in sync with the handler
+const value59285 = compute(value, 18);
+const value54080 = compute(value, 51);
+const value12617 = compute(value, 7);
+const value80713 = compute(value, 9);
+const value63576 = compute(value, 41);
+const value78919 = compute(value, 58);
+const value44537 = compute(value, 14);
+const value99111 = compute(value, 74);
+const v = import.meta.env.BENCH_KEY_00905;
+const value92329 = compute(value, 82);
+// note 66239: keep this in sync with the handler
+const value98769 = compute(value, 23);
+const value92124 = compute(value, 71);
+const value27845 = compute(value, 6);
+const value39134 = compute(value, 43);
+// note 40846: keep this in sync with the handler
+const value50131 = compute(value, 79);
+const value57736 = compute(value, 21);
+// note 733: keep this in sync with the handler
+const value44913 = compute(value, 2);
+const value11054 = compute(value, 93);
+const value39046 = compute(value, 52);
+const v = process.env.BENCH_KEY_00803;
+// note 72005: keep this in sync with the handler
+// note 33168: keep this in sync with the handler
+const value57231 = compute(value, 1);
+const value66486 = compute(value, 41);
+const value17363 = compute(value, 0);
+const value72009 = compute(value, 35);
+const value81517 = compute(value, 37);
+const value49494 = compute(value, 24);
+const value44159 = compute(value, 24);
+const value46022 = compute(value, 44);
+const value53269 = compute(value, 16);
+const value13252 = compute(value, 60);
+const value67021 = compute(value, 91);
+const value15381 = compute(value, 55);
+const v = process.env.BENCH_KEY_00447;
+const value79010 = compute(value, 52);
+const value13964 = compute(value, 93);
+// note 80820: keep this in sync with the handler
+const value87690 = compute(value, 2);
+const value47474 = compute(value, 41);
+const value52409 = compute(value, 29);
+const value52368 = compute(value, 85);
+const value47808 = compute(value, 84);
+const value53709 = compute(value, 68);
+const value2950 = compute(value, 40);
+const value50097 = compute(value, 45);
+const v = import.meta.env.BENCH_KEY_01634;
+const value36048 = compute(value, 61);
+const value44947 = compute(value, 36);
+const value88623 = compute(value, 62);
+// note 99539: keep this in sync with the handler
+// note 35182: keep this in sync with the handler
+const value89582 = compute(value, 51);
+const value63910 = compute(value, 84);
+const value74628 = compute(value, 35);
+const value28599 = compute(value, 81);
+const value93564 = compute(value, 56);
+const value97350 = compute(value, 59);
+const value99218 = compute(value, 84);
+const value89611 = compute(value, 80);
+const value90826 = compute(value, 34);
+const value43396 = compute(value, 37);
+const value54589 = compute(value, 75);
+const value47829 = compute(value, 8);
+const value3366 = compute(value, 68);
+const value8836 = compute(value, 9);
+const value95602 = compute(value, 57);
+const v = process.env.BENCH_KEY_01008;
+const value21582 = compute(value, 48);
+const value53391 = compute(value, 41);
+// note 49681: keep this in sync with the handler
+const value47861 = compute(value, 40);
+const value64423 = compute(value, 15);
+const value57221 = compute(value, 88);
+const value62669 = compute(value, 7);
+const value24837 = compute(value, 5);
+const value25824 = compute(value, 22);
+const value33482 = compute(value, 17);
+const value41674 = compute(value, 61);
+const v = import.meta.env.BENCH_KEY_01615;
+const value42912 = compute(value, 38);
+const value29056 = compute(value, 53);
+const value87539 = compute(value, 45);
+const value98899 = compute(value, 56);
+const value11759 = compute(value, 22);
+// note 97960: keep this in sync with the handler
+// note 85484: keep this in sync with the handler
+const value46439 = compute(value, 73);
+const v = process.env["BENCH_KEY_01852"];
+const value31628 = compute(value, 6);
+const value53258 = compute(value, 5);
+const value86045 = compute(value, 6);
+const value52168 = compute(value, 79);
+const value30490 = compute(value, 32);
+const value79786 = compute(value, 52);
+const value61459 = compute(value, 58);
+const value23346 = compute(value, 66);
+const value91382 = compute(value, 8);
+const value93182 = compute(value, 62);
+const value79287 = compute(value, 38);
+const value41226 = compute(value, 1);
+const value34508 = compute(value, 73);
+const value24461 = compute(value, 17);
+const value52188 = compute(value, 2);
+const value63276 = compute(value, 32);
+const value3280 = compute(value, 79);
+const value57693 = compute(value, 75);
+const value4679 = compute(value, 23);
+const v = process.env["BENCH_KEY_00264"];
+const value13802 = compute(value, 28);
+const value35388 = compute(value, 80);
+const value44898 = compute(value, 84);
+const value55295 = compute(value, 5);
+// note 76549: keep this in sync with the handler
+// note 72430: keep this in sync with the handler
+// note 58687: keep this in sync with the handler
+const value85885 = compute(value, 40);
+const v = import.meta.env.BENCH_KEY_01738;
+const value87316 = compute(value, 16);
+const value49777 = compute(value, 16);
+const value66011 = compute(value, 51);
+// note 71882: keep this in sync with the handler
+const value50648 = compute(value, 14);
+const value67050 = compute(value, 23);
+const value7152 = compute(value, 71);
+const value43758 = compute(value, 11);
+const value89704 = compute(value, 76);
+const v = process.env["BENCH_KEY_00227"];
+const value18901 = compute(value, 83);
+const value90294 = compute(value, 84);
+const value96707 = compute(value, 95);
+const value3344 = compute(value, 46);
+const value75527 = compute(value, 61);
+const value26017 = compute(value, 21);
+const value42449 = compute(value, 60);
@@ -0,0 +1,239 @@
+value68603 = compute(value, 24)
+value70347 = compute(value, 22)
+value62295 = compute(value, 21)
+value17104 = compute(value, 32)
+value20506 = compute(value, 39)
+value14611 = compute(value, 61)
+value7650 = compute(value, 84)
+value51258 = compute(value, 42)
+const v = os.environ["BENCH_KEY_00514"];
+value25523 = compute(value, 12)
+value22576 = compute(value, 72)
+# note 9438: keep this in sync with the handler
+value2338 = compute(value, 10)
+# note 83884: keep this in sync with the handler
+value13072 = compute(value, 74)
+value55536 = compute(value, 52)
+value4137 = compute(value, 63)
+value17726 = compute(value, 72)
+# note 82164: keep this in sync with the handler
+value83928 = compute(value, 23)
+value16319 = compute(value, 23)
+value29377 = compute(value, 83)
+value18379 = compute(value, 46)
+value50367 = compute(value, 24)
+value58764 = compute(value, 79)
+value33412 = compute(value, 44)
+value65060 = compute(value, 70)
+# note 56978: keep this in sync with the handler
+value17976 = compute(value, 31)
+value72821 = compute(value, 71)
+value83066 = compute(value, 34)
+const v = os.environ.get('BENCH_KEY_00225');
+value97933 = compute(value, 60)
+value20867 = compute(value, 12)
+value59891 = compute(value, 42)
+value39288 = compute(value, 3)
+value70798 = compute(value, 85)
+value92080 = compute(value, 27)
+# note 13846: keep this in sync with the handler
+value79195 = compute(value, 43)
+value59328 = compute(value, 61)
+value21131 = compute(value, 82)
+value57619 = compute(value, 1)
+const v = os.environ.get('BENCH_KEY_01370');
+value25361 = compute(value, 44)
+# note 91798: keep this in sync with the handler
+value33327 = compute(value, 56)
+value98958 = compute(value, 18)
+value90212 = compute(value, 2)
+value9444 = compute(value, 35)
+value97566 = compute(value, 81)
+value12415 = compute(value, 96)
+value62103 = compute(value, 23)
+# note 88367: keep this in sync with the handler
+# note 86694: keep this in sync with the handler
+value81785 = compute(value, 14)
+value82580 = compute(value, 33)
+value885 = compute(value, 12)
+value10196 = compute(value, 11)
+value16358 = compute(value, 62)
+value77643 = compute(value, 43)
+const v = os.getenv("BENCH_KEY_00782");
+value11887 = compute(value, 53)
+value66616 = compute(value, 74)
+value47767 = compute(value, 43)
+# note 44051: keep this in sync with the handler
+# note 88930: keep this in sync with the handler
+value76206 = compute(value, 61)
+value57168 = compute(value, 35)
+value97135 = compute(value, 38)
+value65729 = compute(value, 60)
+value26631 = compute(value, 53)
+value12819 = compute(value, 15)
+value79485 = compute(value, 42)
+const v = os.environ["BENCH_KEY_01973"];
+value38686 = compute(value, 80)
+value19804 = compute(value, 16)
+value3865 = compute(value, 82)
+value15968 = compute(value, 60)
+value86592 = compute(value, 68)
+value26337 = compute(value, 50)
+# note 92204: keep this in sync with the handler
+value90170 = compute(value, 57)
+value44083 = compute(value, 45)
+const v = os.environ["BENCH_KEY_01849"];
+# note 64610: keep this in sync with the handler
+value43801 = compute(value, 54)
+value98654 = compute(value, 5)
+value31329 = compute(value, 95)
+value25325 = compute(value, 8)
+value17784 = compute(value, 33)
+value92269 = compute(value, 22)
+value29486 = compute(value, 95)
+value87475 = compute(value, 78)
+value77798 = compute(value, 4)
+value85627 = compute(value, 73)
+value5291 = compute(value, 53)
+value47334 = compute(value, 95)
+value21393 = compute(value, 53)
+value65715 = compute(value, 46)
+value43871 = compute(value, 27)
+value44564 = compute(value, 41)
+value87324 = compute(value, 24)
+value47089 = compute(value, 44)
+value66420 = compute(value, 72)
+value94820 = compute(value, 51)
+const v = os.environ.get('BENCH_KEY_01230');
+value98371 = compute(value, 13)
+value65182 = compute(value, 95)
+value63971 = compute(value, 48)
+value79730 = compute(value, 93)
+value47128 = compute(value, 83)
+value55283 = compute(value, 90)
+# note 76384: keep this in sync with the handler
+value13576 = compute(value, 93)
+value34250 = compute(value, 9)
+value16817 = compute(value, 36)
+# note 12910: keep this in sync with the handler
+value50572 = compute(value, 35)
+# note 97892: keep this in sync with the handler
+# note 56871: keep this in sync with the handler
+# note 85299: keep this in sync with the handler
+value27072 = compute(value, 9)
+value44092 = compute(value, 54)
+value14556 = compute(value, 6)
+value5496 = compute(value, 64)
+value50369 = compute(value, 26)
+const v = os.environ.get('BENCH_KEY_01191');
+value88312 = compute(value, 42)
+value80930 = compute(value, 32)
+# note 82862: keep this in sync with the handler
+value98922 = compute(value, 79)
+value9973 = compute(value, 79)
+value4619 = compute(value, 60)
+value81216 = compute(value, 27)
+value90796 = compute(value, 4)
+value50140 = compute(value, 88)
+value96527 = compute(value, 12)
+value79989 = compute(value, 61)
+const v = os.environ.get('BENCH_KEY_00564');
+value86901 = compute(value, 86)
+value60072 = compute(value, 29)
+value88620 = compute(value, 59)
+value95882 = compute(value, 46)
+value15218 = compute(value, 86)
+value69543 = compute(value, 91)
+# note 74623: keep this in sync with the handler
+value87770 = compute(value, 82)
+value94708 = compute(value, 36)
+value87017 = compute(value, 8)
+value38892 = compute(value, 92)
+value68491 = compute(value, 9)
+value62501 = compute(value, 33)
+const v = os.environ["BENCH_KEY_01919"];
+value59398 = compute(value, 34)
+value32132 = compute(value, 25)
+value37966 = compute(value, 39)
+value23397 = compute(value, 20)
+value54768 = compute(value, 60)
+value66587 = compute(value, 45)
+value1389 = compute(value, 31)
+value38815 = compute(value, 15)
+value53782 = compute(value, 44)
+value26055 = compute(value, 59)
+value46738 = compute(value, 81)
+value39878 = compute(value, 11)
+value26449 = compute(value, 65)
+value53530 = compute(value, 83)
+value37613 = compute(value, 74)
+value53526 = compute(value, 79)
+value80396 = compute(value, 80)
+# note 80277: keep this in sync with the handler
+value81061 = compute(value, 66)
+value22086 = compute(value, 67)
+const v = os.environ.get('BENCH_KEY_00102');
+value85682 = compute(value, 31)
+value98214 = compute(value, 50)
+value33374 = compute(value, 6)
+value29109 = compute(value, 9)
+value93263 = compute(value, 46)
+value35326 = compute(value, 18)
+value47083 = compute(value, 38)
+value50030 = compute(value, 75)
+value67891 = compute(value, 88)
+value61305 = compute(value, 1)
+value28455 = compute(value, 34)
+value5098 = compute(value, 54)
+value57465 = compute(value, 41)
+value25277 = compute(value, 57)
+# note 20387: keep this in sync with the handler
+value96731 = compute(value, 22)
+value10694 = compute(value, 24)
+value32186 = compute(value, 79)
+value26457 = compute(value, 73)
+value62678 = compute(value, 16)
+value32448 = compute(value, 50)
+const v = os.environ.get('BENCH_KEY_01603');
+value18491 = compute(value, 61)
+value14608 = compute(value, 58)
+value55202 = compute(value, 9)
+# note 6288: keep this in sync with the handler
+value67824 = compute(value, 21)
+# note 52813: keep this in sync with the handler
+value8986 = compute(value, 62)
+value30522 = compute(value, 64)
+value18165 = compute(value, 26)
+value23265 = compute(value, 82)
+value61660 = compute(value, 65)
+value82816 = compute(value, 75)
+const v = os.environ.get('BENCH_KEY_01937');
+value92955 = compute(value, 29)
+value26108 = compute(value, 15)
+value83198 = compute(value, 69)
+value89924 = compute(value, 5)
+value10542 = compute(value, 66)
+value86539 = compute(value, 15)
+value13602 = compute(value, 22)
+value13040 = compute(value, 42)
+value39365 = compute(value, 80)
+value56464 = compute(value, 10)
+const v = os.environ["BENCH_KEY_01560"];
+value20847 = compute(value, 89)
+value46276 = compute(value, 7)
+value53824 = compute(value, 86)
+value24759 = compute(value, 24)
+value19693 = compute(value, 2)
+# note 88369: keep this in sync with the handler
+value82784 = compute(value, 43)
+# note 12604: keep this in sync with the handler
+value2377 = compute(value, 49)
+# note 3591: keep this in sync with the handler
+value97442 = compute(value, 54)
+value91873 = compute(value, 14)
+value49666 = compute(value, 2)
+value36645 = compute(value, 76)
+value61745 = compute(value, 53)
+value86132 = compute(value, 93)
+value88276 = compute(value, 6)
+const v = os.getenv("BENCH_KEY_01962");
@@ -0,0 +1,203 @@
+const value33532 = compute(value, 67);
+// note 31929: keep this in sync with the handler
+// note 39354: keep this in sync with the handler
+const value52267 = compute(value, 81);
+// note 40181: keep this in sync with the handler
+const value71832 = compute(value, 52);
+// note 63220: keep this in sync with the handler
+const value50463 = compute(value, 23);
+const value40981 = compute(value, 47);
+const v = import.meta.env.BENCH_KEY_00196;
+const value36615 = compute(value, 46);
+const value12229 = compute(value, 7);
+const value46839 = compute(value, 85);
+const value68635 = compute(value, 56);
+const value42617 = compute(value, 34);
+const value79613 = compute(value, 73);
+const value97202 = compute(value, 8);
+// note 48825: keep this in sync with the handler
+const value45315 = compute(value, 16);
+const value39963 = compute(value, 96);
+const v = process.env.BENCH_KEY_01704;
+const value67058 = compute(value, 31);
+const value34567 = compute(value, 35);
+// note 85373: keep this in sync with the handler
+const value68261 = compute(value, 70);
+const value82134 = compute(value, 72);
+const value17052 = compute(value, 77);
+const value68188 = compute(value, 94);
+const v = process.env.BENCH_KEY_00695;
+const value39108 = compute(value, 17);
+const value34929 = compute(value, 9);
+const value11512 = compute(value, 66);
+const value92166 = compute(value, 16);
+const value83253 = compute(value, 27);
+const value89579 = compute(value, 48);
+const value75907 = compute(value, 53);
+const value26662 = compute(value, 84);
+const v = import.meta.env.BENCH_KEY_01024;
+const value56082 = compute(value, 16);
+const value32729 = compute(value, 40);
+const value82529 = compute(value, 79);
+const value37409 = compute(value, 64);
+const value58904 = compute(value, 25);
+const value27686 = compute(value, 41);
+const value95673 = compute(value, 31);
+// note 8789: keep this in sync with the handler
+const value3625 = compute(value, 36);
+// note 35835: keep this in sync with the handler
+const value20073 = compute(value, 91);
+const value94089 = compute(value, 96);
+const v = import.meta.env.BENCH_KEY_01882;
+// note 81259: keep this in sync with the handler
+const value79949 = compute(value, 21);
+// note 99449: keep this in sync with the handler
+const value57893 = compute(value, 81);
+const value13235 = compute(value, 43);
+const value1577 = compute(value, 25);
+const value2102 = compute(value, 65);
+// note 17808: keep this in sync with the handler
+const value94985 = compute(value, 22);
+const value80639 = compute(value, 32);
+const value76707 = compute(value, 77);
+const value73342 = compute(value, 10);
+const value74543 = compute(value, 47);
+const value24938 = compute(value, 9);
+// note 6133: keep this in sync with the handler
+const value45953 = compute(value, 72);
+const value78308 = compute(value, 29);
+const value82320 = compute(value, 64);
+const v = process.env.BENCH_KEY_00770;
+const value94970 = compute(value, 7);
+const value96891 = compute(value, 85);
+// note 4611: keep this in sync with the handler
+const value20974 = compute(value, 22);
+const value64421 = compute(value, 13);
+const value80175 = compute(value, 53);
+// note 17934: keep this in sync with the handler
+const value6206 = compute(value, 95);
+const value33731 = compute(value, 72);
+const value52751 = compute(value, 80);
+const value89571 = compute(value, 40);
+const value97859 = compute(value, 83);
+const value27986 = compute(value, 50);
+const value75038 = compute(value, 57);
+const value87178 = compute(value, 72);
+const value78681 = compute(value, 14);
+const value76263 = compute(value, 21);
+const value73289 = compute(value, 54);
+const value12356 = compute(value, 37);
+const v = import.meta.env.BENCH_KEY_01053;
+const value71992 = compute(value, 18);
+const value99061 = compute(value, 24);
+const value33590 = compute(value, 28);
+const value30255 = compute(value, 88);
+// note 63153: keep this in sync with the handler
+// note 61243: keep this in sync with the handler
+const value49344 = compute(value, 68);
+const v = process.env["BENCH_KEY_01122"];
+const value97941 = compute(value, 68);
+// note 68139: keep this in sync with the handler
+const value3864 = compute(value, 81);
+const value33213 = compute(value, 39);
+const value41223 = compute(value, 95);
+const value56266 = compute(value, 6);
+const value17580 = compute(value, 23);
+const value79608 = compute(value, 68);
+const value51747 = compute(value, 46);
+// note 46178: keep this in sync with the handler
+const v = process.env.BENCH_KEY_00038;
+const value60233 = compute(value, 93);
+const value53647 = compute(value, 6);
+const value85059 = compute(value, 87);
+const value77168 = compute(value, 53);
+const value45421 = compute(value, 25);
+const value62663 = compute(value, 1);
+const value47331 = compute(value, 92);
+// note 25711: keep this in sync with the handler
+const value35290 = compute(value, 79);
+const value52987 = compute(value, 25);
+const value49401 = compute(value, 28);
+const value37166 = compute(value, 15);
+const v = import.meta.env.BENCH_KEY_01909;
+const value47533 = compute(value, 3);
+const value51996 = compute(value, 4);
+const value69438 = compute(value, 83);
+const value28113 = compute(value, 80);
+const value5816 = compute(value, 93);
+const value50321 = compute(value, 75);
+const value96439 = compute(value, 21);
+// note 79227: keep this in sync with the handler
+// note 68732: keep this in sync with the handler
+const value46716 = compute(value, 59);
+const v = import.meta.env.BENCH_KEY_00240;
+const value73756 = compute(value, 36);
+const value19099 = compute(value, 87);
+const value95974 = compute(value, 41);
+const value23000 = compute(value, 11);
+const value62094 = compute(value, 14);
+const value43429 = compute(value, 70);
+const value6417 = compute(value, 15);
+const value9388 = compute(value, 76);
+const value37447 = compute(value, 5);
+const value30805 = compute(value, 56);
+// note 23310: keep this in sync with the handler
+const value62184 = compute(value, 7);
+// note 64063: keep this in sync with the handler
+const v = process.env.BENCH_KEY_01414;
+const value87557 = compute(value, 63);
+const value73495 = compute(value, 66);
+const value24463 = compute(value, 19);
+const value37889 = compute(value, 59);
+const value55897 = compute(value, 25);
+const value79700 = compute(value, 63);
+const value16501 = compute(value, 11);
+// note 71399: keep this in sync with the handler
+const value47933 = compute(value, 15);
+const value75135 = compute(value, 57);
+const value71185 = compute(value, 84);
+const value15106 = compute(value, 71);
+const value59414 = compute(value, 50);
+const value32015 = compute(value, 5);
+const value89322 = compute(value, 82);
+const value60864 = compute(value, 45);
+const value98006 = compute(value, 36);
+const value87248 = compute(value, 45);
+const value80514 = compute(value, 4);
+const v = process.env.BENCH_KEY_01296;
+const value96527 = compute(value, 12);
+const value19658 = compute(value, 64);
+const value22792 = compute(value, 94);
+// note 40347: keep this in sync with the handler
+const value4341 = compute(value, 73);
+const value3768 = compute(value, 82);
+const value27533 = compute(value, 82);
+const value76784 = compute(value, 57);
+const value90301 = compute(value, 91);
+const value58799 = compute(value, 17);
+const value14013 = compute(value, 45);
+const value16961 = compute(value, 83);
+const value37408 = compute(value, 63);
+const v = process.env.BENCH_KEY_01479;
+const value30447 = compute(value, 86);
+const value52105 = compute(value, 16);
+const value76616 = compute(value, 83);
+const value43643 = compute(value, 90);
+const value51734 = compute(value, 33);
+const value12478 = compute(value, 62);
+const value3319 = compute(value, 21);
+const value20340 = compute(value, 67);
+// note 17533: keep this in sync with the handler
+const value21234 = compute(value, 88);
+// note 56029: keep this in sync with the handler
+const value35815 = compute(value, 22);
+const value59446 = compute(value, 82);
+const value1045 = compute(value, 75);
+const value46460 = compute(value, 94);
+const value58237 = compute(value, 37);
+const value75053 = compute(value, 72);
+// note 47979: keep this in sync with the handler
+const value41065 = compute(value, 34);
+const v = import.meta.env.BENCH_KEY_00401;
+const value20086 = compute(value, 7);
+const value42794 = compute(value, 17);
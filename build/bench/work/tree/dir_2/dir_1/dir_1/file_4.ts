@@ -0,0 +1,206 @@
+const value11855 = compute(value, 21);
+const value81330 = compute(value, 44);
+const value7293 = compute(value, 18);
+const value45276 = compute(value, 74);
+const value74833 = compute(value, 46);
+const value46167 = compute(value, 92);
+const value88319 = compute(value, 49);
+const v = process.env.BENCH_KEY_01747;
+const value18225 = compute(value, 86);
+const value73474 = compute(value, 45);
+const value16702 = compute(value, 18);
+const value85549 = compute(value, 92);
+const value14271 = compute(value, 12);
+const value7079 = compute(value, 95);
+const value67714 = compute(value, 8);
+const value46617 = compute(value, 57);
+const value55939 = compute(value, 67);
+const v = process.env.BENCH_KEY_00112;
+const value44977 = compute(value, 66);
+const value17219 = compute(value, 50);
+const value60942 = compute(value, 26);
+const value47353 = compute(value, 17);
+const value94352 = compute(value, 68);
+const value37692 = compute(value, 56);
+const value10921 = compute(value, 57);
+const value69292 = compute(value, 34);
+const value32595 = compute(value, 3);
+const value75517 = compute(value, 51);
+const value73200 = compute(value, 62);
+const value30276 = compute(value, 12);
+const value39705 = compute(value, 32);
+const value59216 = compute(value, 46);
+const value77122 = compute(value, 7);
+const value59796 = compute(value, 44);
+const value74073 = compute(value, 62);
+// note 26147: keep this in sync with the handler
+const value6010 = compute(value, 93);
+const v = import.meta.env.BENCH_KEY_01375;
+const value10865 = compute(value, 1);
+const value10705 = compute(value, 35);
+const value33343 = compute(value, 72);
+const value13785 = compute(value, 11);
+const value21820 = compute(value, 92);
+const value54451 = compute(value, 34);
+const value78669 = compute(value, 2);
+const value54566 = compute(value, 52);
+const value9041 = compute(value, 20);
+const value12840 = compute(value, 36);
+const value85977 = compute(value, 35);
+const value76220 = compute(value, 75);
+const value4792 = compute(value, 39);
+const value68288 = compute(value, 0);
+// note 34728: keep this in sync with the handler
+const v = process.env["BENCH_KEY_01685"];
+const value68494 = compute(value, 12);
+const value73349 = compute(value, 17);
+const value42511 = compute(value, 25);
+const value2544 = compute(value, 22);
+const value20842 = compute(value, 84);
+const value36105 = compute(value, 21);
+const value14021 = compute(value, 53);
+const value3506 = compute(value, 14);
+const value98023 = compute(value, 53);
+const value59994 = compute(value, 48);
+const value37958 = compute(value, 31);
+const value22034 = compute(value, 15);
+const value72231 = compute(value, 63);
+const value58051 = compute(value, 45);
+const value91646 = compute(value, 78);
+const value20360 = compute(value, 87);
+const value57660 = compute(value, 42);
+const value69848 = compute(value, 8);
+const value39419 = compute(value, 37);
+const value52489 = compute(value, 12);
+const v = process.env.BENCH_KEY_00417;
+const value39013 = compute(value, 19);
+const value46985 = compute(value, 37);
+const value32125 = compute(value, 18);
+const value40922 = compute(value, 85);
+// note 95460: keep this in sync with the handler
+const value70846 = compute(value, 36);
+// note 92104: keep this in sync with the handler
+const value70344 = compute(value, 19);
+const value69793 = compute(value, 50);
+const value89483 = compute(value, 49);
+const value28542 = compute(value, 24);
+const value29942 = compute(value, 66);
+const v = process.env.BENCH_KEY_00724;
+const value90632 = compute(value, 34);
+const value64623 = compute(value, 21);
+const value29975 = compute(value, 2);
+const value77443 = compute(value, 37);
+const value15722 = compute(value, 8);
+const value54789 = compute(value, 81);
+const value19577 = compute(value, 80);
+const value25161 = compute(value, 38);
+const value97426 = compute(value, 38);
+const value13341 = compute(value, 52);
+const value32484 = compute(value, 86);
+const value39962 = compute(value, 95);
+const value1719 = compute(value, 70);
+const value20515 = compute(value, 48);
+const value1114 = compute(value, 47);
+const value6667 = compute(value, 71);
+const value28759 = compute(value, 47);
+const value73001 = compute(value, 57);
+const value91241 = compute(value, 61);
+const v = import.meta.env.BENCH_KEY_01903;
+const value3021 = compute(value, 14);
+const value77099 = compute(value, 81);
+const value33273 = compute(value, 2);
+const value82779 = compute(value, 38);
+const value91499 = compute(value, 28);
+const value66507 = compute(value, 62);
+const value84965 = compute(value, 90);
+const value90828 = compute(value, 36);
+// note 30137: keep this in sync with the handler
+const value49628 = compute(value, 61);
+const v = process.env.BENCH_KEY_01522;
+const value75284 = compute(value, 12);
+const value54233 = compute(value, 10);
+// note 75316: keep this in sync with the handler
+// note 46407: keep this in sync with the handler
+// note 73814: keep this in sync with the handler
+// note 33337: keep this in sync with the handler
+const value31108 = compute(value, 68);
+const value60746 = compute(value, 24);
+const value2744 = compute(value, 28);
+const v = process.env.BENCH_KEY_01093;
+const value26819 = compute(value, 47);
+const value62918 = compute(value, 62);
+// note 8287: keep this in sync with the handler
+const value11091 = compute(value, 33);
+const value12477 = compute(value, 61);
+const value5436 = compute(value, 4);
+const value9114 = compute(value, 93);
+const value19689 = compute(value, 95);
+// note 90602: keep this in sync with the handler
+const value62662 = compute(value, 0);
+// note 3616: keep this in sync with the handler
+const value69120 = compute(value, 56);
+const value79306 = compute(value, 57);
+const value56114 = compute(value, 48);
+const value45273 = compute(value, 71);
+const value89773 = compute(value, 48);
+const value58824 = compute(value, 42);
+const v = import.meta.env.BENCH_KEY_00366;
+const value20683 = compute(value, 22);
+const value96746 = compute(value, 37);
+const value62831 = compute(value, 72);
+const value68562 = compute(value, 80);
+const value94095 = compute(value, 5);
+const value97009 = compute(value, 9);
+const value11675 = compute(value, 35);
+const value96479 = compute(value, 61);
+const value49951 = compute(value, 93);
+const value57135 = compute(value, 2);
+const value41265 = compute(value, 40);
+const value84090 = compute(value, 88);
+const v = process.env["BENCH_KEY_00801"];
+const value57486 = compute(value, 62);
+const value24449 = compute(value, 5);
+const value72818 = compute(value, 68);
+const value47524 = compute(value, 91);
+const value38346 = compute(value, 31);
+const value2260 = compute(value, 29);
+const value76753 = compute(value, 26);
+const value5633 = compute(value, 7);
+const value46647 = compute(value, 87);
+const value47765 = compute(value, 41);
+const value8446 = compute(value, 7);
+const value79558 = compute(value, 18);
+// note 89503: keep this in sync with the handler
+const value58041 = compute(value, 35);
+const value6338 = compute(value, 33);
+const value34959 = compute(value, 39);
+const value80311 = compute(value, 92);
+const value46849 = compute(value, 95);
+const value8568 = compute(value, 32);
+const v = process.env.BENCH_KEY_00775;
+const value21140 = compute(value, 91);
+// note 904: keep this in sync with the handler
+const value25065 = compute(value, 39);
+const value22759 = compute(value, 61);
+const value14186 = compute(value, 24);
+// note 17933: keep this in sync with the handler
+const value2669 = compute(value, 50);
+const value93003 = compute(value, 77);
+const value88503 = compute(value, 39);
+const value62105 = compute(value, 25);
+const value71663 = compute(value, 77);
+const value93856 = compute(value, 57);
+const value1544 = compute(value, 89);
+const value29825 = compute(value, 46);
+const value20500 = compute(value, 33);
+const v = import.meta.env.BENCH_KEY_00186;
+const value84704 = compute(value, 23);
+const value58287 = compute(value, 87);
+const value92615 = compute(value, 77);
+const value65846 = compute(value, 80);
+const value90569 = compute(value, 68);
+const value98300 = compute(value, 39);
+// note 52696: keep this in sync with the handler
+const value73660 = compute(value, 37);
+const value92032 = compute(value, 76);
+// note 88318: keep this in sync with the handler
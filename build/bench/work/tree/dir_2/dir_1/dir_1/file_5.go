@@ -0,0 +1,233 @@
+value70888 := compute(value, 78)
+value7284 := compute(value, 9)
+value72959 := compute(value, 15)
+value57151 := compute(value, 18)
+value34081 := compute(value, 34)
+value9645 := compute(value, 42)
+value37684 := compute(value, 48)
+value26873 := compute(value, 4)
+value75270 := compute(value, 95)
+value43692 := compute(value, 42)
+// note 94628: keep this in sync with the handler
+const v = os.LookupEnv("BENCH_KEY_00894");
+value63417 := compute(value, 76)
+value50349 := compute(value, 6)
+value44963 := compute(value, 52)
+value69936 := compute(value, 96)
+value21729 := compute(value, 1)
+value70255 := compute(value, 27)
+value20640 := compute(value, 76)
+value64440 := compute(value, 32)
+// note 26311: keep this in sync with the handler
+value82663 := compute(value, 19)
+value89944 := compute(value, 25)
+value47495 := compute(value, 62)
+// note 34478: keep this in sync with the handler
+value4402 := compute(value, 37)
+value71602 := compute(value, 16)
+value58106 := compute(value, 3)
+value46653 := compute(value, 93)
+// note 7832: keep this in sync with the handler
+value2127 := compute(value, 90)
+value61118 := compute(value, 8)
+value47810 := compute(value, 86)
+const v = os.LookupEnv("BENCH_KEY_01628");
+value4417 := compute(value, 52)
+value10355 := compute(value, 73)
+value84095 := compute(value, 93)
+// note 9069: keep this in sync with the handler
+value24989 := compute(value, 60)
+value37109 := compute(value, 55)
+value93893 := compute(value, 94)
+value60354 := compute(value, 20)
+value88017 := compute(value, 38)
+value28257 := compute(value, 30)
+// note 50672: keep this in sync with the handler
+value94617 := compute(value, 42)
+value79144 := compute(value, 89)
+// note 45572: keep this in sync with the handler
+value17792 := compute(value, 41)
+const v = os.Getenv("BENCH_KEY_01470");
+value18509 := compute(value, 79)
+value85943 := compute(value, 1)
+value45415 := compute(value, 19)
+value65446 := compute(value, 68)
+value3064 := compute(value, 57)
+value51909 := compute(value, 14)
+value95963 := compute(value, 30)
+// note 89241: keep this in sync with the handler
+value99404 := compute(value, 76)
+value17456 := compute(value, 93)
+value18474 := compute(value, 44)
+value20927 := compute(value, 72)
+// note 35833: keep this in sync with the handler
+value67343 := compute(value, 25)
+value3475 := compute(value, 80)
+value4972 := compute(value, 25)
+value54349 := compute(value, 29)
+value55511 := compute(value, 27)
+value56782 := compute(value, 37)
+value81751 := compute(value, 77)
+const v = os.Getenv("BENCH_KEY_00045");
+value80571 := compute(value, 61)
+value56668 := compute(value, 20)
+value93610 := compute(value, 5)
+value90408 := compute(value, 4)
+value52202 := compute(value, 16)
+value57929 := compute(value, 20)
+value58842 := compute(value, 60)
+// note 13099: keep this in sync with the handler
+value9937 := compute(value, 43)
+value17541 := compute(value, 81)
+value52528 := compute(value, 51)
+value5109 := compute(value, 65)
+value31407 := compute(value, 76)
+// note 79318: keep this in sync with the handler
+value72301 := compute(value, 36)
+value21537 := compute(value, 3)
+value27047 := compute(value, 81)
+value175 := compute(value, 78)
+value6293 := compute(value, 85)
+value73925 := compute(value, 11)
+const v = os.LookupEnv("BENCH_KEY_01091");
+// note 14463: keep this in sync with the handler
+value3104 := compute(value, 0)
+value33742 := compute(value, 83)
+value22916 := compute(value, 24)
+value78268 := compute(value, 86)
+value61551 := compute(value, 53)
+value55847 := compute(value, 72)
+// note 87702: keep this in sync with the handler
+value80572 := compute(value, 62)
+value52181 := compute(value, 92)
+value66423 := compute(value, 75)
+const v = os.Getenv("BENCH_KEY_01773");
+value86426 := compute(value, 96)
+value92225 := compute(value, 75)
+value29867 := compute(value, 88)
+value96897 := compute(value, 91)
+value22281 := compute(value, 68)
+value32418 := compute(value, 20)
+value91312 := compute(value, 35)
+value7011 := compute(value, 27)
+value74783 := compute(value, 93)
+value15213 := compute(value, 81)
+value8263 := compute(value, 18)
+value56060 := compute(value, 91)
+value437 := compute(value, 49)
+value74296 := compute(value, 91)
+value4113 := compute(value, 39)
+const v = os.Getenv("BENCH_KEY_00211");
+value31181 := compute(value, 44)
+// note 60446: keep this in sync with the handler
+// note 1853: keep this in sync with the handler
+value37199 := compute(value, 48)
+value81536 := compute(value, 56)
+value85179 := compute(value, 13)
+value35271 := compute(value, 60)
+// note 1344: keep this in sync with the handler
+value84125 := compute(value, 26)
+value43868 := compute(value, 24)
+value22536 := compute(value, 32)
+// note 15934: keep this in sync with the handler
+const v = os.Getenv("BENCH_KEY_01958");
+value78730 := compute(value, 63)
+value78927 := compute(value, 66)
+value8029 := compute(value, 75)
+value92170 := compute(value, 20)
+value10509 := compute(value, 33)
+value87488 := compute(value, 91)
+value12270 := compute(value, 48)
+value17530 := compute(value, 70)
+value95996 := compute(value, 63)
+value2475 := compute(value, 50)
+// note 26011: keep this in sync with the handler
+value56599 := compute(value, 48)
+value97536 := compute(value, 51)
+value54357 := compute(value, 37)
+value27079 := compute(value, 16)
+value98872 := compute(value, 29)
+value37649 := compute(value, 13)
+value66288 := compute(value, 37)
+value71242 := compute(value, 44)
+// note 63421: keep this in sync with the handler
+value10222 := compute(value, 37)
+const v = os.Getenv("BENCH_KEY_01899");
+value67944 := compute(value, 44)
+value63356 := compute(value, 15)
+value40873 := compute(value, 36)
+// note 12205: keep this in sync with the handler
+value25720 := compute(value, 15)
+// note 42915: keep this in sync with the handler
+value79636 := compute(value, 96)
+value55456 := compute(value, 69)
+value65695 := compute(value, 26)
+value86572 := compute(value, 48)
+// note 38120: keep this in sync with the handler
+const v = os.Getenv("BENCH_KEY_01109");
+value13549 := compute(value, 66)
+value33420 := compute(value, 52)
+value44760 := compute(value, 43)
+value49839 := compute(value, 78)
+value88746 := compute(value, 88)
+value26870 := compute(value, 1)
+value27172 := compute(value, 12)
+value38894 := compute(value, 94)
+value55504 := compute(value, 20)
+value23358 := compute(value, 78)
+value25404 := compute(value, 87)
+value97467 := compute(value, 79)
+value88098 := compute(value, 22)
+value20027 := compute(value, 45)
+value68446 := compute(value, 61)
+value28824 := compute(value, 15)
+value27784 := compute(value, 42)
+// note 10332: keep this in sync with the handler
+// note 21424: keep this in sync with the handler
+value40166 := compute(value, 8)
+value1978 := compute(value, 38)
+value30189 := compute(value, 22)
+const v = os.LookupEnv("BENCH_KEY_01404");
+value95168 := compute(value, 11)
+value48770 := compute(value, 76)
+value15895 := compute(value, 84)
+value13610 := compute(value, 30)
+value96349 := compute(value, 28)
+value59441 := compute(value, 77)
+value82063 := compute(value, 1)
+value45048 := compute(value, 40)
+value35164 := compute(value, 50)
+value37355 := compute(value, 10)
+value91259 := compute(value, 79)
+value77208 := compute(value, 93)
+value75651 := compute(value, 88)
+const v = os.LookupEnv("BENCH_KEY_01363");
+// note 83182: keep this in sync with the handler
+value89180 := compute(value, 37)
+value89853 := compute(value, 31)
+value38132 := compute(value, 11)
+value23692 := compute(value, 24)
+value14202 := compute(value, 40)
+// note 95707: keep this in sync with the handler
+value61374 := compute(value, 70)
+value24951 := compute(value, 22)
+value299 := compute(value, 8)
+value90924 := compute(value, 35)
+value40291 := compute(value, 36)
+value99040 := compute(value, 3)
+const v = os.Getenv("BENCH_KEY_00708");
+value60062 := compute(value, 19)
+value58388 := compute(value, 91)
+value23998 := compute(value, 39)
+value43477 := compute(value, 21)
+value1494 := compute(value, 39)
+value67203 := compute(value, 79)
+value68680 := compute(value, 4)
+value74946 := compute(value, 62)
+value44820 := compute(value, 6)
+const v = os.Getenv("BENCH_KEY_01102");
+value95544 := compute(value, 96)
+value95000 := compute(value, 37)
+value11493 := compute(value, 47)
+value45033 := compute(value, 25)
+value72445 := compute(value, 83)
@@ -0,0 +1,214 @@
+let value50766 = compute(value, 35);
+let value20849 = compute(value, 91);
+let value15181 = compute(value, 49);
+let value68417 = compute(value, 32);
+let value33194 = compute(value, 20);
+let value28849 = compute(value, 40);
+let value63285 = compute(value, 41);
+let value9165 = compute(value, 47);
+let value82940 = compute(value, 5);
+const v = env::var_os("BENCH_KEY_01548");
+let value8232 = compute(value, 84);
+let value18983 = compute(value, 68);
+let value89531 = compute(value, 0);
+let value65832 = compute(value, 66);
+let value79620 = compute(value, 80);
+// note 54: keep this in sync with the handler
+let value1143 = compute(value, 76);
+let value48208 = compute(value, 96);
+let value16515 = compute(value, 25);
+let value70579 = compute(value, 60);
+// note 84942: keep this in sync with the handler
+const v = env::var("BENCH_KEY_01921");
+let value96564 = compute(value, 49);
+// note 14925: keep this in sync with the handler
+// note 27563: keep this in sync with the handler
+let value45905 = compute(value, 24);
+let value94623 = compute(value, 48);
+// note 2958: keep this in sync with the handler
+let value38759 = compute(value, 56);
+let value97093 = compute(value, 93);
+const v = env::var_os("BENCH_KEY_00677");
+let value34970 = compute(value, 50);
+let value96054 = compute(value, 24);
+let value10725 = compute(value, 55);
+let value24072 = compute(value, 16);
+let value97908 = compute(value, 35);
+let value97341 = compute(value, 50);
+let value69997 = compute(value, 60);
+let value89701 = compute(value, 73);
+let value37435 = compute(value, 90);
+let value81912 = compute(value, 44);
+const v = env::var("BENCH_KEY_01594");
+let value99611 = compute(value, 89);
+let value53302 = compute(value, 49);
+let value36201 = compute(value, 20);
+let value79368 = compute(value, 22);
+let value67542 = compute(value, 30);
+let value79478 = compute(value, 35);
+let value12039 = compute(value, 11);
+let value138 = compute(value, 41);
+let value95989 = compute(value, 56);
+let value94467 = compute(value, 86);
+let value29073 = compute(value, 70);
+let value37354 = compute(value, 9);
+let value71032 = compute(value, 28);
+let value60296 = compute(value, 59);
+let value87764 = compute(value, 76);
+let value52762 = compute(value, 91);
+let value69532 = compute(value, 80);
+let value16855 = compute(value, 74);
+const v = env::var_os("BENCH_KEY_00566");
+let value76033 = compute(value, 82);
+// note 21450: keep this in sync with the handler
+let value71722 = compute(value, 39);
+let value39158 = compute(value, 67);
+let value68612 = compute(value, 33);
+let value72472 = compute(value, 13);
+let value39714 = compute(value, 41);
+let value78519 = compute(value, 46);
+let value39964 = compute(value, 0);
+// note 57588: keep this in sync with the handler
+let value18014 = compute(value, 69);
+let value4075 = compute(value, 1);
+const v = env::var_os("BENCH_KEY_01231");
+let value24035 = compute(value, 76);
+let value99922 = compute(value, 12);
+let value91561 = compute(value, 90);
+let value24598 = compute(value, 57);
+let value22226 = compute(value, 13);
+let value22045 = compute(value, 26);
+let value36730 = compute(value, 64);
+let value58410 = compute(value, 16);
+let value39612 = compute(value, 36);
+let value55120 = compute(value, 24);
+// note 99756: keep this in sync with the handler
+let value13449 = compute(value, 63);
+let value96530 = compute(value, 15);
+const v = env::var_os("BENCH_KEY_01514");
+let value23667 = compute(value, 96);
+// note 39748: keep this in sync with the handler
+let value9506 = compute(value, 0);
+// note 69060: keep this in sync with the handler
+let value72454 = compute(value, 92);
+let value25657 = compute(value, 49);
+let value60921 = compute(value, 5);
+let value21575 = compute(value, 41);
+let value14716 = compute(value, 69);
+let value65094 = compute(value, 7);
+let value20661 = compute(value, 0);
+let value8871 = compute(value, 44);
+const v = env::var_os("BENCH_KEY_01895");
+let value69379 = compute(value, 24);
+let value96981 = compute(value, 78);
+let value84500 = compute(value, 13);
+let value19485 = compute(value, 85);
+let value39475 = compute(value, 93);
+let value59497 = compute(value, 36);
+let value71474 = compute(value, 82);
+let value30489 = compute(value, 31);
+let value24212 = compute(value, 59);
+let value72565 = compute(value, 9);
+let value51825 = compute(value, 27);
+// note 67977: keep this in sync with the handler
+let value8294 = compute(value, 49);
+// note 961: keep this in sync with the handler
+let value16204 = compute(value, 5);
+// note 36130: keep this in sync with the handler
+const v = env::var("BENCH_KEY_00409");
+let value17102 = compute(value, 30);
+let value33538 = compute(value, 73);
+let value10579 = compute(value, 6);
+let value3966 = compute(value, 86);
+let value40432 = compute(value, 80);
+let value47330 = compute(value, 91);
+let value15229 = compute(value, 0);
+let value41908 = compute(value, 4);
+const v = env::var_os("BENCH_KEY_01957");
+let value50693 = compute(value, 59);
+let value49595 = compute(value, 28);
+let value68280 = compute(value, 89);
+let value73793 = compute(value, 73);
+let value7569 = compute(value, 3);
+let value90662 = compute(value, 64);
+let value40202 = compute(value, 44);
+let value30096 = compute(value, 26);
+let value44104 = compute(value, 66);
+let value1314 = compute(value, 53);
+let value22790 = compute(value, 92);
+let value4300 = compute(value, 32);
+let value61454 = compute(value, 53);
+let value67993 = compute(value, 93);
+// note 62150: keep this in sync with the handler
+let value12574 = compute(value, 61);
+let value63007 = compute(value, 54);
+let value28432 = compute(value, 11);
+let value8256 = compute(value, 11);
+const v = env::var_os("BENCH_KEY_01691");
+let value78058 = compute(value, 70);
+// note 2700: keep this in sync with the handler
+let value78400 = compute(value, 24);
+let value48889 = compute(value, 1);
+let value51420 = compute(value, 10);
+let value57595 = compute(value, 74);
+let value2840 = compute(value, 27);
+// note 37456: keep this in sync with the handler
+let value67110 = compute(value, 83);
+let value53596 = compute(value, 52);
+let value4832 = compute(value, 79);
+// note 88013: keep this in sync with the handler
+let value76589 = compute(value, 56);
+let value78962 = compute(value, 4);
+let value82025 = compute(value, 60);
+let value34135 = compute(value, 88);
+let value76371 = compute(value, 32);
+let value43678 = compute(value, 28);
+let value89485 = compute(value, 51);
+const v = env::var_os("BENCH_KEY_01492");
+let value55472 = compute(value, 85);
+// note 87139: keep this in sync with the handler
+let value20979 = compute(value, 27);
+let value16518 = compute(value, 28);
+let value91491 = compute(value, 20);
+let value16011 = compute(value, 6);
+let value37020 = compute(value, 63);
+let value50769 = compute(value, 38);
+let value37299 = compute(value, 51);
+let value22618 = compute(value, 17);
+let value83144 = compute(value, 15);
+const v = env::var_os("BENCH_KEY_01093");
+let value7903 = compute(value, 46);
+let value84265 = compute(value, 69);
+// note 39476: keep this in sync with the handler
+let value50662 = compute(value, 28);
+// note 71136: keep this in sync with the handler
+let value95940 = compute(value, 7);
+let value38977 = compute(value, 80);
+let value99366 = compute(value, 38);
+let value36521 = compute(value, 49);
+let value18130 = compute(value, 88);
+let value4023 = compute(value, 46);
+let value10605 = compute(value, 32);
+let value41876 = compute(value, 69);
+// note 68303: keep this in sync with the handler
+let value49668 = compute(value, 4);
+let value36649 = compute(value, 80);
+let value51258 = compute(value, 42);
+const v = env::var("BENCH_KEY_00852");
+let value4640 = compute(value, 81);
+let value91748 = compute(value, 83);
+let value10028 = compute(value, 37);
+let value74165 = compute(value, 57);
+// note 48872: keep this in sync with the handler
+let value93993 = compute(value, 0);
+let value47939 = compute(value, 21);
+let value12060 = compute(value, 32);
+// note 23204: keep this in sync with the handler
+let value91073 = compute(value, 87);
+let value15611 = compute(value, 91);
+let value3517 = compute(value, 25);
+let value36959 = compute(value, 2);
+let value61679 = compute(value, 84);
+let value24527 = compute(value, 83);
+let value68874 = compute(value, 4);
+let value49737 = compute(value, 73);
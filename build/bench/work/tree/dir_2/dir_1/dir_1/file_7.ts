@@ -0,0 +1,204 @@
+const value70127 = compute(value, 93);
+const value79822 = compute(value, 88);
+const value91455 = compute(value, 81);
+const v = process.env.BENCH_KEY_01820;
+const value36539 = compute(value, 67);
+const value87224 = compute(value, 21);
+const value57189 = compute(value, 56);
+const value90389 = compute(value, 82);
+const value28496 = compute(value, 75);
+const value70283 = compute(value, 55);
+const value57432 = compute(value, 8);
+const value19309 = compute(value, 6);
+const value1491 = compute(value, 36);
+const value23936 = compute(value, 74);
+const value97996 = compute(value, 26);
+const value22574 = compute(value, 70);
+// note 78508: keep this in sync with the handler
+const value72429 = compute(value, 67);
+const value18138 = compute(value, 96);
+const value23129 = compute(value, 43);
+const value52288 = compute(value, 5);
+const v = import.meta.env.BENCH_KEY_00371;
+const value33556 = compute(value, 91);
+const value58514 = compute(value, 23);
+const value94084 = compute(value, 91);
+const value71400 = compute(value, 8);
+const value77401 = compute(value, 92);
+const value13479 = compute(value, 93);
+const value98022 = compute(value, 52);
+const value23599 = compute(value, 28);
+const value35127 = compute(value, 13);
+const value31808 = compute(value, 89);
+const value42126 = compute(value, 28);
+const value28432 = compute(value, 11);
+const value60327 = compute(value, 90);
+// note 8939: keep this in sync with the handler
+const value23674 = compute(value, 6);
+const value95337 = compute(value, 83);
+const v = process.env.BENCH_KEY_01904;
+const value92843 = compute(value, 14);
+// note 24304: keep this in sync with the handler
+const value30265 = compute(value, 1);
+const value83537 = compute(value, 20);
+const value12939 = compute(value, 38);
+const value23946 = compute(value, 84);
+const value39541 = compute(value, 62);
+const value89315 = compute(value, 75);
+const value49794 = compute(value, 33);
+const v = process.env.BENCH_KEY_01549;
+const value47293 = compute(value, 54);
+// note 13433: keep this in sync with the handler
+// note 256: keep this in sync with the handler
+// note 78916: keep this in sync with the handler
+const value97057 = compute(value, 57);
+const value56177 = compute(value, 14);
+const value46948 = compute(value, 0);
+const value94607 = compute(value, 32);
+const value27762 = compute(value, 20);
+const value45294 = compute(value, 92);
+const value96641 = compute(value, 29);
+const value22387 = compute(value, 77);
+const value83731 = compute(value, 20);
+const value59173 = compute(value, 3);
+const value75231 = compute(value, 56);
+const v = process.env.BENCH_KEY_01727;
+// note 71713: keep this in sync with the handler
+const value66456 = compute(value, 11);
+const value85160 = compute(value, 91);
+const value70711 = compute(value, 95);
+const value93067 = compute(value, 44);
+const value67786 = compute(value, 80);
+const value2081 = compute(value, 44);
+const value96148 = compute(value, 21);
+const value9094 = compute(value, 73);
+// note 16398: keep this in sync with the handler
+const value86876 = compute(value, 61);
+const value66428 = compute(value, 80);
+const value65058 = compute(value, 68);
+const value1741 = compute(value, 92);
+const value72639 = compute(value, 83);
+const value44507 = compute(value, 81);
+const value21372 = compute(value, 32);
+const v = process.env["BENCH_KEY_00799"];
+// note 47849: keep this in sync with the handler
+const value50743 = compute(value, 12);
+const value71269 = compute(value, 71);
+// note 40194: keep this in sync with the handler
+const value64742 = compute(value, 43);
+const value11113 = compute(value, 55);
+// note 17121: keep this in sync with the handler
+const value81492 = compute(value, 12);
+const v = process.env.BENCH_KEY_00427;
+const value94814 = compute(value, 45);
+const value61290 = compute(value, 83);
+const value31842 = compute(value, 26);
+const value31468 = compute(value, 40);
+const value34508 = compute(value, 73);
+const value75249 = compute(value, 74);
+const value74249 = compute(value, 44);
+const value88284 = compute(value, 14);
+const value86084 = compute(value, 45);
+const value9739 = compute(value, 39);
+const value35737 = compute(value, 41);
+const value14042 = compute(value, 74);
+const v = import.meta.env.BENCH_KEY_00026;
+const value42780 = compute(value, 3);
+const value66087 = compute(value, 30);
+// note 24079: keep this in sync with the handler
+const value69025 = compute(value, 58);
+const value54607 = compute(value, 93);
+const value48040 = compute(value, 25);
+const value69651 = compute(value, 5);
+const value41183 = compute(value, 55);
+// note 52891: keep this in sync with the handler
+const value27368 = compute(value, 14);
+// note 56586: keep this in sync with the handler
+const value57998 = compute(value, 89);
+const value57563 = compute(value, 42);
+const v = process.env["BENCH_KEY_00820"];
+const value22862 = compute(value, 67);
+// note 15438: keep this in sync with the handler
+const value60748 = compute(value, 26);
+const value3131 = compute(value, 27);
+const value12788 = compute(value, 81);
+// note 8819: keep this in sync with the handler
+const value99918 = compute(value, 8);
+const value53222 = compute(value, 66);
+const value9888 = compute(value, 91);
+const value97252 = compute(value, 58);
+const value45665 = compute(value, 75);
+const value79085 = compute(value, 30);
+const value64958 = compute(value, 65);
+const value19649 = compute(value, 55);
+const value95901 = compute(value, 65);
+const value41697 = compute(value, 84);
+const value94677 = compute(value, 5);
+const v = process.env.BENCH_KEY_01758;
+const value23991 = compute(value, 32);
+const value14465 = compute(value, 12);
+// note 22588: keep this in sync with the handler
+const value63161 = compute(value, 14);
+const value59595 = compute(value, 37);
+const value69454 = compute(value, 2);
+const value8923 = compute(value, 96);
+const value51466 = compute(value, 56);
+const value62977 = compute(value, 24);
+// note 65304: keep this in sync with the handler
+const value80173 = compute(value, 51);
+// note 7420: keep this in sync with the handler
+const value2969 = compute(value, 59);
+const value44086 = compute(value, 48);
+const value4166 = compute(value, 92);
+const v = process.env.BENCH_KEY_01503;
+const value4425 = compute(value, 60);
+const value36958 = compute(value, 1);
+const value66177 = compute(value, 23);
+const value11410 = compute(value, 61);
+// note 98323: keep this in sync with the handler
+const value56046 = compute(value, 77);
+const value30631 = compute(value, 76);
+const v = process.env["BENCH_KEY_00992"];
+// note 23096: keep this in sync with the handler
+// note 667: keep this in sync with the handler
+const value49566 = compute(value, 96);
+const value33425 = compute(value, 57);
+const value63544 = compute(value, 9);
+const value49554 = compute(value, 84);
+// note 844: keep this in sync with the handler
+const value83964 = compute(value, 59);
+const value38114 = compute(value, 90);
+// note 51623: keep this in sync with the handler
+const value69918 = compute(value, 78);
+const value97723 = compute(value, 44);
+const value1634 = compute(value, 82);
+const v = process.env.BENCH_KEY_00879;
+const value18340 = compute(value, 7);
+const value7495 = compute(value, 26);
+// note 29545: keep this in sync with the handler
+// note 32892: keep this in sync with the handler
+const value68029 = compute(value, 32);
+const value18637 = compute(value, 13);
+const value32031 = compute(value, 21);
+const v = process.env["BENCH_KEY_00676"];
+const value297 = compute(value, 6);
+const value67210 = compute(value, 86);
+const value81729 = compute(value, 55);
+const value14347 = compute(value, 88);
+// note 4123: keep this in sync with the handler
+const value54008 = compute(value, 76);
+const value6793 = compute(value, 3);
+const value26955 = compute(value, 86);
+const value57261 = compute(value, 31);
+const value47688 = compute(value, 61);
+const value85129 = compute(value, 60);
+const v = import.meta.env.BENCH_KEY_01468;
+const value95554 = compute(value, 9);
+const value63463 = compute(value, 25);
+const value1648 = compute(value, 96);
+const value23541 = compute(value, 67);
+const value4848 = compute(value, 95);
+const value48589 = compute(value, 89);
+const value91829 = compute(value, 67);
+const value2621 = compute(value, 2);
+const value4384 = compute(value, 19);
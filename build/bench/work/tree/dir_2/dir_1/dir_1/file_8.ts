@@ -0,0 +1,204 @@
+const value20592 = compute(value, 28);
+const value40303 = compute(value, 48);
+const v = process.env["BENCH_KEY_00288"];
+const value10153 = compute(value, 65);
+const value53388 = compute(value, 38);
+const value36124 = compute(value, 40);
+// note 27454: keep this in sync with the handler
+const value71691 = compute(value, 8);
+const value51904 = compute(value, 9);
+const value65755 = compute(value, 86);
+const value3245 = compute(value, 44);
+const value43219 = compute(value, 54);
+const value66234 = compute(value, 80);
+const value24277 = compute(value, 27);
+const value37003 = compute(value, 46);
+const value69742 = compute(value, 96);
+const value67237 = compute(value, 16);
+const value93824 = compute(value, 25);
+const value4351 = compute(value, 83);
+const value26983 = compute(value, 17);
+const v = process.env.BENCH_KEY_01915;
+const value8789 = compute(value, 59);
+const value50211 = compute(value, 62);
+const value59923 = compute(value, 74);
+const value50867 = compute(value, 39);
+const value82998 = compute(value, 63);
+const value84052 = compute(value, 50);
+const value64521 = compute(value, 16);
+const value19041 = compute(value, 29);
+const value8543 = compute(value, 7);
+const v = process.env["BENCH_KEY_00667"];
+const value18404 = compute(value, 71);
+const value11427 = compute(value, 78);
+// note 46615: keep this in sync with the handler
+const value61896 = compute(value, 10);
+const value26945 = compute(value, 76);
+const value85382 = compute(value, 22);
+const value80447 = compute(value, 34);
+const value42469 = compute(value, 80);
+const value15507 = compute(value, 84);
+// note 67174: keep this in sync with the handler
+const value82295 = compute(value, 39);
+const value22243 = compute(value, 30);
+const value54679 = compute(value, 68);
+const value72589 = compute(value, 33);
+const v = process.env["BENCH_KEY_01209"];
+const value69066 = compute(value, 2);
+const value62921 = compute(value, 65);
+const value69142 = compute(value, 78);
+const value83586 = compute(value, 69);
+const value6794 = compute(value, 4);
+const value69240 = compute(value, 79);
+const value85362 = compute(value, 2);
+const value77786 = compute(value, 89);
+const value21063 = compute(value, 14);
+const value56131 = compute(value, 65);
+const value18864 = compute(value, 46);
+const value22774 = compute(value, 76);
+const v = process.env.BENCH_KEY_00910;
+// note 19529: keep this in sync with the handler
+const value95398 = compute(value, 47);
+const value14128 = compute(value, 63);
+const value42799 = compute(value, 22);
+const value5602 = compute(value, 73);
+// note 91735: keep this in sync with the handler
+// note 88683: keep this in sync with the handler
+const value98067 = compute(value, 0);
+const value47727 = compute(value, 3);
+const value30806 = compute(value, 57);
+const value74486 = compute(value, 87);
+const value30595 = compute(value, 40);
+const value61969 = compute(value, 83);
+const value70173 = compute(value, 42);
+// note 70403: keep this in sync with the handler
+const value96313 = compute(value, 89);
+// note 8232: keep this in sync with the handler
+const v = process.env.BENCH_KEY_00752;
+const value92888 = compute(value, 59);
+const value26357 = compute(value, 70);
+const value79031 = compute(value, 73);
+const value46223 = compute(value, 51);
+const value3223 = compute(value, 22);
+const value12584 = compute(value, 71);
+const value27460 = compute(value, 9);
+const value95533 = compute(value, 85);
+const v = process.env.BENCH_KEY_01627;
+const value77621 = compute(value, 21);
+const value89512 = compute(value, 78);
+const value22887 = compute(value, 92);
+const value75754 = compute(value, 94);
+// note 21117: keep this in sync with the handler
+const value95196 = compute(value, 39);
+const value10281 = compute(value, 96);
+const value85815 = compute(value, 67);
+const value91662 = compute(value, 94);
+const value85516 = compute(value, 59);
+const value60553 = compute(value, 25);
+const v = import.meta.env.BENCH_KEY_01821;
+const value11822 = compute(value, 85);
+const value41357 = compute(value, 35);
+const value26595 = compute(value, 17);
+const value42671 = compute(value, 88);
+const value750 = compute(value, 71);
+const value22917 = compute(value, 25);
+const value386 = compute(value, 95);
+const value6640 = compute(value, 44);
+const value62534 = compute(value, 66);
+const value99585 = compute(value, 63);
+const value87629 = compute(value, 38);
+const value55942 = compute(value, 70);
+const value84855 = compute(value, 77);
+const value59264 = compute(value, 94);
+const value71963 = compute(value, 86);
+const value16219 = compute(value, 20);
+const value27553 = compute(value, 5);
+const v = process.env.BENCH_KEY_00293;
+const value91164 = compute(value, 81);
+const value92977 = compute(value, 51);
+const value13310 = compute(value, 21);
+const value87132 = compute(value, 26);
+const value79067 = compute(value, 12);
+const value79452 = compute(value, 9);
+const value50435 = compute(value, 92);
+const v = process.env["BENCH_KEY_01267"];
+const value45414 = compute(value, 18);
+const value19122 = compute(value, 13);
+const value14754 = compute(value, 10);
+const value67902 = compute(value, 2);
+const value16548 = compute(value, 58);
+const value53950 = compute(value, 18);
+const value23040 = compute(value, 51);
+// note 27169: keep this in sync with the handler
+const value46900 = compute(value, 49);
+const value64197 = compute(value, 80);
+// note 90245: keep this in sync with the handler
+const value26125 = compute(value, 32);
+const value56474 = compute(value, 20);
+const value17669 = compute(value, 15);
+const value82170 = compute(value, 11);
+const v = process.env.BENCH_KEY_01176;
+const value2522 = compute(value, 0);
+const value75488 = compute(value, 22);
+const value5708 = compute(value, 82);
+const value65691 = compute(value, 22);
+const value99038 = compute(value, 1);
+const value33791 = compute(value, 35);
+const value65689 = compute(value, 20);
+const value38369 = compute(value, 54);
+const value56347 = compute(value, 87);
+const value33536 = compute(value, 71);
+const value38959 = compute(value, 62);
+const value15737 = compute(value, 23);
+const value36939 = compute(value, 79);
+const v = import.meta.env.BENCH_KEY_00157;
+const value58515 = compute(value, 24);
+const value19862 = compute(value, 74);
+const value6232 = compute(value, 24);
+const value26813 = compute(value, 41);
+const value37290 = compute(value, 42);
+const value67274 = compute(value, 53);
+const value13052 = compute(value, 54);
+const value49198 = compute(value, 19);
+const value60516 = compute(value, 85);
+const value74242 = compute(value, 37);
+const value67906 = compute(value, 6);
+const value74635 = compute(value, 42);
+// note 4622: keep this in sync with the handler
+const v = process.env.BENCH_KEY_01925;
+const value55067 = compute(value, 68);
+const value45849 = compute(value, 65);
+const value57130 = compute(value, 94);
+const value23237 = compute(value, 54);
+// note 87754: keep this in sync with the handler
+// note 35876: keep this in sync with the handler
+const value49604 = compute(value, 37);
+const value6719 = compute(value, 26);
+const value79938 = compute(value, 10);
+// note 61843: keep this in sync with the handler
+const value14613 = compute(value, 63);
+const value60162 = compute(value, 22);
+const v = import.meta.env.BENCH_KEY_01212;
+const value93767 = compute(value, 65);
+const value5334 = compute(value, 96);
+// note 49238: keep this in sync with the handler
+const value66864 = compute(value, 31);
+const value3396 = compute(value, 1);
+const value92570 = compute(value, 32);
+// note 94882: keep this in sync with the handler
+const value49755 = compute(value, 91);
+const value18290 = compute(value, 54);
+const value81588 = compute(value, 11);
+// note 60009: keep this in sync with the handler
+// note 27364: keep this in sync with the handler
+const v = process.env["BENCH_KEY_00311"];
+// note 3042: keep this in sync with the handler
+// note 29533: keep this in sync with the handler
+const value73111 = compute(value, 70);
+// note 18255: keep this in sync with the handler
+const value10263 = compute(value, 78);
+const value63984 = compute(value, 61);
+// note 53246: keep this in sync with the handler
+const value73739 = compute(value, 19);
+const value3155 = compute(value, 51);
+const value97028 = compute(value, 28);
@@ -0,0 +1,204 @@
+const value73159 = compute(value, 21);
+const value7147 = compute(value, 66);
+const value46273 = compute(value, 4);
+// note 57928: keep this in sync with the handler
+const value62848 = compute(value, 89);
+// note 12949: keep this in sync with the handler
+const value89945 = compute(value, 26);
+const value6076 = compute(value, 62);
+const value51784 = compute(value, 83);
+const value41399 = compute(value, 77);
+const value92292 = compute(value, 45);
+const v = process.env["BENCH_KEY_00440"];
+const value84332 = compute(value, 39);
+const value81861 = compute(value, 90);
+const value36945 = compute(value, 85);
+const value19353 = compute(value, 50);
+const value336 = compute(value, 45);
+const value70714 = compute(value, 1);
+const value22997 = compute(value, 8);
+const value69815 = compute(value, 72);
+const v = import.meta.env.BENCH_KEY_01325;
+const value85543 = compute(value, 86);
+const value39826 = compute(value, 56);
+const value60201 = compute(value, 61);
+// note 58158: keep this in sync with the handler
+const value26633 = compute(value, 55);
+// note 72261: keep this in sync with the handler
+const value80826 = compute(value, 25);
+const value20395 = compute(value, 25);
+const value52229 = compute(value, 43);
+const v = process.env.BENCH_KEY_01715;
+const value3097 = compute(value, 90);
+const value18763 = compute(value, 42);
+const value64659 = compute(value, 57);
+const value68865 = compute(value, 92);
+const value53519 = compute(value, 72);
+const value92649 = compute(value, 14);
+const value58814 = compute(value, 32);
+const value98555 = compute(value, 3);
+const value41249 = compute(value, 24);
+const value49105 = compute(value, 23);
+const value51600 = compute(value, 93);
+const value6520 = compute(value, 21);
+const v = process.env.BENCH_KEY_01367;
+const value74258 = compute(value, 53);
+const value39409 = compute(value, 27);
+const value78287 = compute(value, 8);
+const value89218 = compute(value, 75);
+const value89476 = compute(value, 42);
+// note 6514: keep this in sync with the handler
+const value10397 = compute(value, 18);
+const value16437 = compute(value, 44);
+const value33730 = compute(value, 71);
+const v = process.env["BENCH_KEY_00936"];
+const value184 = compute(value, 87);
+const value49459 = compute(value, 86);
+const value89975 = compute(value, 56);
+const value73645 = compute(value, 22);
+const value44579 = compute(value, 56);
+const value32355 = compute(value, 54);
+const value37615 = compute(value, 76);
+const value35710 = compute(value, 14);
+const value6968 = compute(value, 81);
+const value87372 = compute(value, 72);
+// note 15324: keep this in sync with the handler
+const value27693 = compute(value, 48);
+const value28817 = compute(value, 8);
+const value76676 = compute(value, 46);
+const value37490 = compute(value, 48);
+const value76513 = compute(value, 77);
+const v = process.env.BENCH_KEY_01894;
+const value77659 = compute(value, 59);
+const value2314 = compute(value, 83);
+const value87459 = compute(value, 62);
+const value61584 = compute(value, 86);
+const value60023 = compute(value, 77);
+const value56746 = compute(value, 1);
+// note 72131: keep this in sync with the handler
+const value5036 = compute(value, 89);
+const value35110 = compute(value, 93);
+const value8698 = compute(value, 65);
+const value19578 = compute(value, 81);
+const value52319 = compute(value, 36);
+// note 764: keep this in sync with the handler
+const value42212 = compute(value, 17);
+const value79503 = compute(value, 60);
+const value83971 = compute(value, 66);
+const value1727 = compute(value, 78);
+const value3154 = compute(value, 50);
+const v = process.env["BENCH_KEY_01864"];
+const value22715 = compute(value, 17);
+const value16225 = compute(value, 26);
+const value57813 = compute(value, 1);
+const value65584 = compute(value, 12);
+const value6758 = compute(value, 65);
+const value5983 = compute(value, 66);
+const value24347 = compute(value, 0);
+const value67692 = compute(value, 83);
+const value25635 = compute(value, 27);
+const value38306 = compute(value, 88);
+const value55701 = compute(value, 23);
+// note 81157: keep this in sync with the handler
+const value31780 = compute(value, 61);
+// note 72688: keep this in sync with the handler
+const value84884 = compute(value, 9);
+const v = import.meta.env.BENCH_KEY_00275;
+// note 83801: keep this in sync with the handler
+const value47433 = compute(value, 0);
+const value35602 = compute(value, 3);
+const value32001 = compute(value, 88);
+const value35611 = compute(value, 12);
+const value28132 = compute(value, 2);
+const value50160 = compute(value, 11);
+// note 13863: keep this in sync with the handler
+const value81075 = compute(value, 80);
+const value87878 = compute(value, 93);
+const value25002 = compute(value, 73);
+// note 23262: keep this in sync with the handler
+const v = process.env.BENCH_KEY_01272;
+const value45604 = compute(value, 14);
+const value15556 = compute(value, 36);
+const value4501 = compute(value, 39);
+const value21063 = compute(value, 14);
+// note 65299: keep this in sync with the handler
+const value72017 = compute(value, 43);
+const value42701 = compute(value, 21);
+const value32388 = compute(value, 87);
+const value18840 = compute(value, 22);
+const value54790 = compute(value, 82);
+const value46921 = compute(value, 70);
+const value850 = compute(value, 74);
+const value36992 = compute(value, 35);
+const value19116 = compute(value, 7);
+const value89762 = compute(value, 37);
+const value13068 = compute(value, 70);
+const v = process.env["BENCH_KEY_00932"];
+const value68062 = compute(value, 65);
+const value41533 = compute(value, 17);
+const value75575 = compute(value, 12);
+const value93173 = compute(value, 53);
+const value71167 = compute(value, 66);
+const value20551 = compute(value, 84);
+const value49734 = compute(value, 70);
+// note 13976: keep this in sync with the handler
+const v = process.env["BENCH_KEY_00854"];
+// note 80040: keep this in sync with the handler
+const value50503 = compute(value, 63);
+const value3236 = compute(value, 35);
+const value9746 = compute(value, 46);
+const value17779 = compute(value, 28);
+const value63875 = compute(value, 49);
+const value36554 = compute(value, 82);
+const v = process.env["BENCH_KEY_01213"];
+const value17383 = compute(value, 20);
+const value54426 = compute(value, 9);
+const value43189 = compute(value, 24);
+// note 28069: keep this in sync with the handler
+const value23320 = compute(value, 40);
+const value92660 = compute(value, 25);
+const value25350 = compute(value, 33);
+const value88497 = compute(value, 33);
+const value14918 = compute(value, 77);
+const value67210 = compute(value, 86);
+const value2514 = compute(value, 89);
+const value56929 = compute(value, 87);
+const v = import.meta.env.BENCH_KEY_01268;
+const value18111 = compute(value, 69);
+// note 36355: keep this in sync with the handler
+const value74311 = compute(value, 9);
+const value19146 = compute(value, 37);
+// note 66949: keep this in sync with the handler
+const value11967 = compute(value, 36);
+const value38470 = compute(value, 58);
+const v = process.env.BENCH_KEY_00719;
+const value92306 = compute(value, 59);
+const value31598 = compute(value, 73);
+const value70609 = compute(value, 90);
+const value8688 = compute(value, 55);
+const value12283 = compute(value, 61);
+const value37966 = compute(value, 39);
+const value1643 = compute(value, 91);
+const value34964 = compute(value, 44);
+// note 67188: keep this in sync with the handler
+const v = process.env.BENCH_KEY_01625;
+const value7185 = compute(value, 7);
+// note 78749: keep this in sync with the handler
+// note 57090: keep this in sync with the handler
+const value23746 = compute(value, 78);
+const value47890 = compute(value, 69);
+const value75487 = compute(value, 21);
+const value67546 = compute(value, 34);
+const value9324 = compute(value, 12);
+// note 18209: keep this in sync with the handler
+const value8130 = compute(value, 79);
+const v = process.env["BENCH_KEY_00808"];
+// note 23631: keep this in sync with the handler
+// note 82568: keep this in sync with the handler
+const value18869 = compute(value, 51);
+const value27432 = compute(value, 78);
+const value6132 = compute(value, 21);
+const value27740 = compute(value, 95);
+const value26630 = compute(value, 52);
+const value53657 = compute(value, 16);
+const value60035 = compute(value, 89);
@@ -0,0 +1,205 @@
+const value15662 = compute(value, 45);
+const v = process.env.BENCH_KEY_00641;
+const value56497 = compute(value, 43);
+const value63282 = compute(value, 38);
+// note 91165: keep this in sync with the handler
+const value39480 = compute(value, 1);
+const value27588 = compute(value, 40);
+// note 58596: keep this in sync with the handler
+const value75899 = compute(value, 45);
+const value44031 = compute(value, 90);
+const value55949 = compute(value, 77);
+const value21959 = compute(value, 37);
+const v = process.env.BENCH_KEY_01692;
+const value59754 = compute(value, 2);
+// note 33833: keep this in sync with the handler
+const value18884 = compute(value, 66);
+const value26862 = compute(value, 90);
+const value9130 = compute(value, 12);
+const value78097 = compute(value, 12);
+const value30815 = compute(value, 66);
+// note 21241: keep this in sync with the handler
+const value18958 = compute(value, 43);
+const value36073 = compute(value, 86);
+const value16708 = compute(value, 24);
+// note 75269: keep this in sync with the handler
+const value76570 = compute(value, 37);
+const value96582 = compute(value, 67);
+const value9109 = compute(value, 88);
+const value75468 = compute(value, 2);
+const value35366 = compute(value, 58);
+const value8875 = compute(value, 48);
+const value81872 = compute(value, 4);
+const v = process.env.BENCH_KEY_01116;
+const value81070 = compute(value, 75);
+const value56391 = compute(value, 34);
+const value79306 = compute(value, 57);
+const value81014 = compute(value, 19);
+const value38008 = compute(value, 81);
+const value31498 = compute(value, 70);
+const value11664 = compute(value, 24);
+const value48764 = compute(value, 70);
+const v = process.env["BENCH_KEY_00112"];
+const value24171 = compute(value, 18);
+const value34000 = compute(value, 50);
+const value96872 = compute(value, 66);
+const value41876 = compute(value, 69);
+// note 47139: keep this in sync with the handler
+const value44062 = compute(value, 24);
+const value84828 = compute(value, 50);
+// note 66782: keep this in sync with the handler
+const value75192 = compute(value, 17);
+const value2348 = compute(value, 20);
+const value90165 = compute(value, 52);
+const value82036 = compute(value, 71);
+const value95814 = compute(value, 75);
+const v = import.meta.env.BENCH_KEY_01782;
+const value12106 = compute(value, 78);
+const value86024 = compute(value, 82);
+const value22507 = compute(value, 3);
+const value34514 = compute(value, 79);
+const value98253 = compute(value, 89);
+const value10563 = compute(value, 87);
+const value42573 = compute(value, 87);
+const value40769 = compute(value, 29);
+const v = process.env.BENCH_KEY_00803;
+// note 69696: keep this in sync with the handler
+const value64250 = compute(value, 36);
+const value13962 = compute(value, 91);
+const value70557 = compute(value, 38);
+const value56084 = compute(value, 18);
+const value59508 = compute(value, 47);
+const value1019 = compute(value, 49);
+const value37824 = compute(value, 91);
+const v = process.env["BENCH_KEY_00231"];
+const value22294 = compute(value, 81);
+// note 6469: keep this in sync with the handler
+const value82298 = compute(value, 42);
+const value78870 = compute(value, 9);
+const value66794 = compute(value, 58);
+const value45050 = compute(value, 42);
+// note 15328: keep this in sync with the handler
+const value28062 = compute(value, 29);
+const value34209 = compute(value, 65);
+const value89161 = compute(value, 18);
+const value48654 = compute(value, 57);
+const value24609 = compute(value, 68);
+const value21461 = compute(value, 24);
+// note 59643: keep this in sync with the handler
+const value29343 = compute(value, 49);
+const v = process.env.BENCH_KEY_01723;
+const value50298 = compute(value, 52);
+// note 48649: keep this in sync with the handler
+const value57937 = compute(value, 28);
+const value81142 = compute(value, 50);
+const value70356 = compute(value, 31);
+const value32130 = compute(value, 23);
+const value42466 = compute(value, 77);
+const value14735 = compute(value, 88);
+const value55455 = compute(value, 68);
+const value49431 = compute(value, 58);
+// note 34836: keep this in sync with the handler
+const value61527 = compute(value, 29);
+const value51183 = compute(value, 64);
+const value28396 = compute(value, 72);
+const v = process.env.BENCH_KEY_01544;
+const value64015 = compute(value, 92);
+const value3833 = compute(value, 50);
+const value53346 = compute(value, 93);
+const value92084 = compute(value, 31);
+const value92667 = compute(value, 32);
+const value58041 = compute(value, 35);
+const value49889 = compute(value, 31);
+const value10994 = compute(value, 33);
+const value90772 = compute(value, 77);
+const value24635 = compute(value, 94);
+const value6184 = compute(value, 73);
+const value18014 = compute(value, 69);
+const value77274 = compute(value, 62);
+const value36300 = compute(value, 22);
+const value40198 = compute(value, 40);
+const value96028 = compute(value, 95);
+const v = import.meta.env.BENCH_KEY_00164;
+const value36563 = compute(value, 91);
+const value87382 = compute(value, 82);
+const value78416 = compute(value, 40);
+const value56384 = compute(value, 27);
+const value13464 = compute(value, 78);
+const value21837 = compute(value, 12);
+const value6160 = compute(value, 49);
+const value96066 = compute(value, 36);
+const value82249 = compute(value, 90);
+const value59663 = compute(value, 8);
+const value82407 = compute(value, 54);
+const value34419 = compute(value, 81);
+const v = process.env["BENCH_KEY_00459"];
+const value11965 = compute(value, 34);
+const value25058 = compute(value, 32);
+const value23380 = compute(value, 3);
+const value22403 = compute(value, 93);
+const value3204 = compute(value, 3);
+const value28614 = compute(value, 96);
+const value30816 = compute(value, 67);
+const value15991 = compute(value, 83);
+const value78088 = compute(value, 3);
+const value24552 = compute(value, 11);
+const value14438 = compute(value, 82);
+const value6078 = compute(value, 64);
+const v = import.meta.env.BENCH_KEY_00668;
+const value51812 = compute(value, 14);
+const value2785 = compute(value, 69);
+const value74589 = compute(value, 93);
+const value74471 = compute(value, 72);
+// note 99786: keep this in sync with the handler
+// note 50274: keep this in sync with the handler
+const value55722 = compute(value, 44);
+// note 45625: keep this in sync with the handler
+const value74820 = compute(value, 33);
+const value68106 = compute(value, 12);
+const v = process.env["BENCH_KEY_00459"];
+const value5768 = compute(value, 45);
+const value76980 = compute(value, 59);
+const value12307 = compute(value, 85);
+const value42399 = compute(value, 10);
+const value86235 = compute(value, 2);
+const value10271 = compute(value, 86);
+const value71542 = compute(value, 53);
+const value45359 = compute(value, 60);
+const value96702 = compute(value, 90);
+const value34756 = compute(value, 30);
+const v = process.env.BENCH_KEY_00522;
+const value21379 = compute(value, 39);
+const value61617 = compute(value, 22);
+const value80439 = compute(value, 26);
+const value86251 = compute(value, 18);
+const value40497 = compute(value, 48);
+const value64949 = compute(value, 56);
+const value71986 = compute(value, 12);
+const value48892 = compute(value, 4);
+const value72675 = compute(value, 22);
+const value56177 = compute(value, 14);
+// note 56992: keep this in sync with the handler
+const value3239 = compute(value, 38);
+const value76073 = compute(value, 25);
+const value94963 = compute(value, 0);
+const value57656 = compute(value, 38);
+const value99884 = compute(value, 71);
+const value69623 = compute(value, 74);
+const v = process.env["BENCH_KEY_01900"];
+const value70857 = compute(value, 47);
+const value70436 = compute(value, 14);
+const value78184 = compute(value, 2);
+const value3899 = compute(value, 19);
+const value20499 = compute(value, 32);
+const value41998 = compute(value, 94);
+const value97960 = compute(value, 87);
+const value68047 = compute(value, 50);
+const value22270 = compute(value, 57);
+const v = process.env.BENCH_KEY_01653;
+const value92474 = compute(value, 33);
+// note 81740: keep this in sync with the handler
+const value57888 = compute(value, 76);
+const value54851 = compute(value, 46);
+const value66486 = compute(value, 41);
+// note 19137: keep this in sync with the handler
+const value87019 = compute(value, 10);
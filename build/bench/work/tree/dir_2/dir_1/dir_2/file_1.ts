@@ -0,0 +1,205 @@
+const value86200 = compute(value, 64);
+const value66760 = compute(value, 24);
+const value74373 = compute(value, 71);
+const value62279 = compute(value, 5);
+const value30500 = compute(value, 42);
+const value18634 = compute(value, 10);
+const value85372 = compute(value, 12);
+// note 11377: keep this in sync with the handler
+const v = import.meta.env.BENCH_KEY_01015;
+// note 60245: keep this in sync with the handler
+const value88554 = compute(value, 90);
+const value78960 = compute(value, 2);
+// note 9304: keep this in sync with the handler
+const value62842 = compute(value, 83);
+const value32875 = compute(value, 89);
+const value18391 = compute(value, 58);
+const value26054 = compute(value, 58);
+const value51487 = compute(value, 77);
+const value89184 = compute(value, 41);
+const value47007 = compute(value, 59);
+const value52286 = compute(value, 3);
+const value2117 = compute(value, 80);
+const v = process.env.BENCH_KEY_00409;
+const value63941 = compute(value, 18);
+const value77831 = compute(value, 37);
+const value83669 = compute(value, 55);
+const value95759 = compute(value, 20);
+const value29379 = compute(value, 85);
+const value2360 = compute(value, 32);
+const value83173 = compute(value, 44);
+const value99002 = compute(value, 62);
+const value42876 = compute(value, 2);
+const value64832 = compute(value, 36);
+const v = import.meta.env.BENCH_KEY_01040;
+const value58379 = compute(value, 82);
+const value18214 = compute(value, 75);
+const value29188 = compute(value, 88);
+const value96044 = compute(value, 14);
+const value24855 = compute(value, 23);
+const value11355 = compute(value, 6);
+const value33970 = compute(value, 20);
+const value32212 = compute(value, 8);
+const value37409 = compute(value, 64);
+// note 44235: keep this in sync with the handler
+const value73067 = compute(value, 26);
+const value41561 = compute(value, 45);
+const value55048 = compute(value, 49);
+const v = import.meta.env.BENCH_KEY_00254;
+const value53240 = compute(value, 84);
+const value34258 = compute(value, 17);
+// note 47424: keep this in sync with the handler
+const value72121 = compute(value, 50);
+const value76809 = compute(value, 82);
+const value64822 = compute(value, 26);
+const value5432 = compute(value, 0);
+// note 91901: keep this in sync with the handler
+const value77459 = compute(value, 53);
+const value85010 = compute(value, 38);
+const value10159 = compute(value, 71);
+const value48903 = compute(value, 15);
+// note 80526: keep this in sync with the handler
+const value38472 = compute(value, 60);
+const value89432 = compute(value, 95);
+// note 62516: keep this in sync with the handler
+const v = process.env.BENCH_KEY_00474;
+const value54972 = compute(value, 70);
+const value98835 = compute(value, 89);
+const value41428 = compute(value, 9);
+const value80004 = compute(value, 76);
+const value98916 = compute(value, 73);
+const value44247 = compute(value, 15);
+const value71590 = compute(value, 4);
+const value76872 = compute(value, 48);
+// note 85727: keep this in sync with the handler
+// note 43940: keep this in sync with the handler
+const value92440 = compute(value, 96);
+const value33417 = compute(value, 49);
+const value12049 = compute(value, 21);
+const value47427 = compute(value, 91);
+const value12385 = compute(value, 66);
+const value23080 = compute(value, 91);
+const value63864 = compute(value, 38);
+const v = process.env.BENCH_KEY_00470;
+// note 77125: keep this in sync with the handler
+const value51177 = compute(value, 58);
+const value6641 = compute(value, 45);
+const value97818 = compute(value, 42);
+const value97076 = compute(value, 76);
+const value58612 = compute(value, 24);
+const value37588 = compute(value, 49);
+const value15609 = compute(value, 89);
+const v = import.meta.env.BENCH_KEY_01570;
+// note 64360: keep this in sync with the handler
+const value56561 = compute(value, 10);
+const value43271 = compute(value, 9);
+const value43524 = compute(value, 68);
+const value15836 = compute(value, 25);
+const value62141 = compute(value, 61);
+const value80828 = compute(value, 27);
+const value71480 = compute(value, 88);
+const value45595 = compute(value, 5);
+const value59852 = compute(value, 3);
+const value39348 = compute(value, 63);
+const value86779 = compute(value, 61);
+const value85372 = compute(value, 12);
+const v = process.env.BENCH_KEY_00437;
+const value57839 = compute(value, 27);
+const value18046 = compute(value, 4);
+const value87389 = compute(value, 89);
+const value17661 = compute(value, 7);
+const value65379 = compute(value, 1);
+const value94864 = compute(value, 95);
+const value70441 = compute(value, 19);
+const value45057 = compute(value, 49);
+// note 39440: keep this in sync with the handler
+const value30391 = compute(value, 30);
+const value73312 = compute(value, 77);
+const value7256 = compute(value, 78);
+const value99503 = compute(value, 78);
+const v = process.env.BENCH_KEY_01769;
+const value95277 = compute(value, 23);
+const value1969 = compute(value, 29);
+const value30611 = compute(value, 56);
+const value25077 = compute(value, 51);
+const value64905 = compute(value, 12);
+const value41402 = compute(value, 80);
+const value55822 = compute(value, 47);
+const value68696 = compute(value, 20);
+const value35364 = compute(value, 56);
+// note 66069: keep this in sync with the handler
+// note 71820: keep this in sync with the handler
+const value13303 = compute(value, 14);
+// note 26608: keep this in sync with the handler
+const value77434 = compute(value, 28);
+const v = process.env["BENCH_KEY_00160"];
+const value92211 = compute(value, 61);
+const value67096 = compute(value, 69);
+const value86583 = compute(value, 59);
+const value29267 = compute(value, 70);
+const value20666 = compute(value, 5);
+const value32660 = compute(value, 68);
+const value16011 = compute(value, 6);
+const value30218 = compute(value, 51);
+const value70571 = compute(value, 52);
+const value49468 = compute(value, 95);
+const value31955 = compute(value, 42);
+const value15931 = compute(value, 23);
+const value5276 = compute(value, 38);
+const value30252 = compute(value, 85);
+// note 86644: keep this in sync with the handler
+const value64416 = compute(value, 8);
+const value42926 = compute(value, 52);
+const v = process.env["BENCH_KEY_00874"];
+// note 79865: keep this in sync with the handler
+const value23870 = compute(value, 8);
+const value53504 = compute(value, 57);
+const value65418 = compute(value, 40);
+const value25605 = compute(value, 94);
+const value16411 = compute(value, 18);
+const value69326 = compute(value, 68);
+const value2913 = compute(value, 3);
+// note 99544: keep this in sync with the handler
+const value11112 = compute(value, 54);
+const value82195 = compute(value, 36);
+const value67926 = compute(value, 26);
+const value15022 = compute(value, 84);
+const value23824 = compute(value, 59);
+const value58466 = compute(value, 72);
+const value55359 = compute(value, 69);
+const v = process.env.BENCH_KEY_00324;
+const value33550 = compute(value, 85);
+const value59690 = compute(value, 35);
+const value20859 = compute(value, 4);
+const value34681 = compute(value, 52);
+const value59272 = compute(value, 5);
+const value48084 = compute(value, 69);
+const value25081 = compute(value, 55);
+const value81442 = compute(value, 59);
+const value47260 = compute(value, 21);
+const value83820 = compute(value, 12);
+const value74420 = compute(value, 21);
+const v = import.meta.env.BENCH_KEY_01250;
+const value3444 = compute(value, 49);
+const value7661 = compute(value, 95);
+const value55096 = compute(value, 0);
+const value85435 = compute(value, 75);
+const value56327 = compute(value, 67);
+const value74704 = compute(value, 14);
+const value85701 = compute(value, 50);
+const value52794 = compute(value, 26);
+const value44644 = compute(value, 24);
+const value88880 = compute(value, 28);
+const value81610 = compute(value, 33);
+const value66500 = compute(value, 55);
+const v = process.env.BENCH_KEY_01124;
+const value5453 = compute(value, 21);
+const value44580 = compute(value, 57);
+const value38971 = compute(value, 74);
+const value91393 = compute(value, 19);
+const value37978 = compute(value, 51);
+// note 42543: keep this in sync with the handler
+// note 72585: keep this in sync with the handler
+const value25740 = compute(value, 35);
+const value27180 = compute(value, 20);
+const value14898 = compute(value, 57);
@@ -0,0 +1,240 @@
+value5866 = compute(value, 46)
+value7802 = compute(value, 42)
+value17080 = compute(value, 8)
+value66058 = compute(value, 1)
+value4118 = compute(value, 44)
+value22798 = compute(value, 3)
+value45205 = compute(value, 3)
+# note 48795: keep this in sync with the handler
+value10232 = compute(value, 47)
+value81533 = compute(value, 53)
+value74749 = compute(value, 59)
+value57389 = compute(value, 62)
+const v = os.environ["BENCH_KEY_00690"];
+value57671 = compute(value, 53)
+value24989 = compute(value, 60)
+value60332 = compute(value, 95)
+value50294 = compute(value, 48)
+value33299 = compute(value, 28)
+value88838 = compute(value, 83)
+value55159 = compute(value, 63)
+value21294 = compute(value, 51)
+value43796 = compute(value, 49)
+value67194 = compute(value, 70)
+# note 86040: keep this in sync with the handler
+value80873 = compute(value, 72)
+value53568 = compute(value, 24)
+value99469 = compute(value, 44)
+value47285 = compute(value, 46)
+value2832 = compute(value, 19)
+value44178 = compute(value, 43)
+value26171 = compute(value, 78)
+value67863 = compute(value, 60)
+value11006 = compute(value, 45)
+value8291 = compute(value, 46)
+value15481 = compute(value, 58)
+value45806 = compute(value, 22)
+const v = os.getenv("BENCH_KEY_00717");
+value45462 = compute(value, 66)
+value26027 = compute(value, 31)
+value30858 = compute(value, 12)
+value25963 = compute(value, 64)
+value1 = compute(value, 1)
+value18136 = compute(value, 94)
+value78610 = compute(value, 40)
+value21714 = compute(value, 83)
+value3455 = compute(value, 60)
+value93238 = compute(value, 21)
+value31970 = compute(value, 57)
+value31959 = compute(value, 46)
+value48946 = compute(value, 58)
+# note 24676: keep this in sync with the handler
+value76986 = compute(value, 65)
+value43816 = compute(value, 69)
+value38759 = compute(value, 56)
+value34591 = compute(value, 59)
+value635 = compute(value, 53)
+value89287 = compute(value, 47)
+const v = os.environ["BENCH_KEY_00601"];
+value83200 = compute(value, 71)
+value50029 = compute(value, 74)
+value54485 = compute(value, 68)
+# note 81759: keep this in sync with the handler
+value77519 = compute(value, 16)
+value79800 = compute(value, 66)
+value67777 = compute(value, 71)
+value25597 = compute(value, 86)
+# note 31515: keep this in sync with the handler
+value10970 = compute(value, 9)
+value4297 = compute(value, 29)
+value60091 = compute(value, 48)
+const v = os.environ.get('BENCH_KEY_00800');
+value60223 = compute(value, 83)
+value85629 = compute(value, 75)
+value43281 = compute(value, 19)
+value20893 = compute(value, 38)
+value85406 = compute(value, 46)
+value59228 = compute(value, 58)
+value63892 = compute(value, 66)
+value44545 = compute(value, 22)
+value21355 = compute(value, 15)
+value45534 = compute(value, 41)
+value20919 = compute(value, 64)
+value46904 = compute(value, 53)
+value71905 = compute(value, 28)
+# note 97664: keep this in sync with the handler
+value49575 = compute(value, 8)
+value33529 = compute(value, 64)
+value56470 = compute(value, 16)
+value73681 = compute(value, 58)
+const v = os.environ["BENCH_KEY_01269"];
+# note 52296: keep this in sync with the handler
+value36942 = compute(value, 82)
+value86422 = compute(value, 92)
+value58661 = compute(value, 73)
+value77485 = compute(value, 79)
+value98901 = compute(value, 58)
+value76216 = compute(value, 71)
+value28849 = compute(value, 40)
+value82590 = compute(value, 43)
+value19430 = compute(value, 30)
+const v = os.environ["BENCH_KEY_01669"];
+value74960 = compute(value, 76)
+value20729 = compute(value, 68)
+value21605 = compute(value, 71)
+value56606 = compute(value, 55)
+# note 70433: keep this in sync with the handler
+# note 42442: keep this in sync with the handler
+value29188 = compute(value, 88)
+value18197 = compute(value, 58)
+const v = os.environ["BENCH_KEY_00469"];
+# note 53883: keep this in sync with the handler
+value14929 = compute(value, 88)
+value50631 = compute(value, 94)
+value43501 = compute(value, 45)
+value74076 = compute(value, 65)
+value23326 = compute(value, 46)
+value13106 = compute(value, 11)
+value7111 = compute(value, 30)
+value80458 = compute(value, 45)
+value50040 = compute(value, 85)
+value72275 = compute(value, 10)
+value84035 = compute(value, 33)
+value21667 = compute(value, 36)
+value32744 = compute(value, 55)
+value294 = compute(value, 3)
+value15252 = compute(value, 23)
+const v = os.environ["BENCH_KEY_01785"];
+value77543 = compute(value, 40)
+value75154 = compute(value, 76)
+value94547 = compute(value, 69)
+# note 41466: keep this in sync with the handler
+value46341 = compute(value, 72)
+value93421 = compute(value, 10)
+value25786 = compute(value, 81)
+value228 = compute(value, 34)
+value4311 = compute(value, 43)
+value37158 = compute(value, 7)
+const v = os.environ.get('BENCH_KEY_01682');
+# note 49834: keep this in sync with the handler
+value38090 = compute(value, 66)
+# note 12465: keep this in sync with the handler
+value51592 = compute(value, 85)
+# note 46532: keep this in sync with the handler
+value26805 = compute(value, 33)
+# note 48325: keep this in sync with the handler
+value73809 = compute(value, 89)
+value23084 = compute(value, 95)
+value89054 = compute(value, 8)
+value93148 = compute(value, 28)
+# note 13513: keep this in sync with the handler
+value58037 = compute(value, 31)
+value64538 = compute(value, 33)
+# note 5088: keep this in sync with the handler
+value77306 = compute(value, 94)
+value58101 = compute(value, 95)
+value44470 = compute(value, 44)
+value99936 = compute(value, 26)
+value83251 = compute(value, 25)
+const v = os.getenv("BENCH_KEY_01547");
+value94304 = compute(value, 20)
+# note 8801: keep this in sync with the handler
+value11691 = compute(value, 51)
+value11483 = compute(value, 37)
+value63712 = compute(value, 80)
+value61113 = compute(value, 3)
+value25196 = compute(value, 73)
+value67340 = compute(value, 22)
+value38398 = compute(value, 83)
+value78098 = compute(value, 13)
+value5174 = compute(value, 33)
+value95152 = compute(value, 92)
+value86323 = compute(value, 90)
+value3800 = compute(value, 17)
+value47798 = compute(value, 74)
+value39233 = compute(value, 45)
+value91680 = compute(value, 15)
+value53465 = compute(value, 18)
+value40270 = compute(value, 15)
+value645 = compute(value, 63)
+# note 19341: keep this in sync with the handler
+const v = os.getenv("BENCH_KEY_00942");
+value41510 = compute(value, 91)
+value26324 = compute(value, 37)
+value21327 = compute(value, 84)
+value88647 = compute(value, 86)
+value35536 = compute(value, 34)
+value53112 = compute(value, 53)
+value98437 = compute(value, 79)
+value24003 = compute(value, 44)
+value54437 = compute(value, 20)
+value81444 = compute(value, 61)
+value98100 = compute(value, 33)
+value22631 = compute(value, 30)
+value13760 = compute(value, 83)
+value90965 = compute(value, 76)
+value13657 = compute(value, 77)
+value5429 = compute(value, 94)
+value68888 = compute(value, 18)
+# note 92500: keep this in sync with the handler
+value75017 = compute(value, 36)
+value38159 = compute(value, 38)
+value28898 = compute(value, 89)
+const v = os.getenv("BENCH_KEY_00313");
+# note 88829: keep this in sync with the handler
+value43751 = compute(value, 4)
+value21836 = compute(value, 11)
+value43331 = compute(value, 69)
+value35725 = compute(value, 29)
+value24002 = compute(value, 43)
+value5912 = compute(value, 92)
+# note 15421: keep this in sync with the handler
+value26330 = compute(value, 43)
+value46256 = compute(value, 84)
+const v = os.environ.get('BENCH_KEY_00488');
+value64287 = compute(value, 73)
+value17433 = compute(value, 70)
+value42751 = compute(value, 71)
+# note 88050: keep this in sync with the handler
+value91553 = compute(value, 82)
+value44735 = compute(value, 18)
+value80058 = compute(value, 33)
+# note 10725: keep this in sync with the handler
+value40881 = compute(value, 44)
+value56099 = compute(value, 33)
+value94935 = compute(value, 69)
+value34668 = compute(value, 39)
+value80486 = compute(value, 73)
+value28446 = compute(value, 25)
+# note 67410: keep this in sync with the handler
+value98121 = compute(value, 54)
+const v = os.getenv("BENCH_KEY_00983");
+value41963 = compute(value, 59)
+value95643 = compute(value, 1)
+value89067 = compute(value, 21)
+value54785 = compute(value, 77)
+value3088 = compute(value, 81)
+value11097 = compute(value, 39)
+value63902 = compute(value, 76)
+# note 65416: keep this in sync with the handler
+value11845 = compute(value, 11)
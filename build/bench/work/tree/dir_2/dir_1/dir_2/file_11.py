@@ -0,0 +1,237 @@
+# note 34452: keep this in sync with the handler
+value61745 = compute(value, 53)
+const v = os.environ["BENCH_KEY_00852"];
+value25542 = compute(value, 31)
+value30907 = compute(value, 61)
+value83786 = compute(value, 75)
+value9715 = compute(value, 15)
+value23537 = compute(value, 63)
+value12387 = compute(value, 68)
+# note 90942: keep this in sync with the handler
+value37579 = compute(value, 40)
+value1679 = compute(value, 30)
+value91994 = compute(value, 38)
+value81380 = compute(value, 94)
+value85699 = compute(value, 48)
+# note 44448: keep this in sync with the handler
+value35931 = compute(value, 41)
+value10584 = compute(value, 11)
+value52199 = compute(value, 13)
+value56727 = compute(value, 79)
+value30073 = compute(value, 3)
+value66305 = compute(value, 54)
+value90925 = compute(value, 36)
+value8614 = compute(value, 78)
+value71960 = compute(value, 83)
+const v = os.environ["BENCH_KEY_00275"];
+value6100 = compute(value, 86)
+value64922 = compute(value, 29)
+value73215 = compute(value, 77)
+value55485 = compute(value, 1)
+# note 79788: keep this in sync with the handler
+value9630 = compute(value, 27)
+# note 56128: keep this in sync with the handler
+value36301 = compute(value, 23)
+const v = os.getenv("BENCH_KEY_00109");
+value14990 = compute(value, 52)
+value1937 = compute(value, 94)
+# note 6898: keep this in sync with the handler
+value20802 = compute(value, 44)
+# note 47005: keep this in sync with the handler
+value26711 = compute(value, 36)
+value85102 = compute(value, 33)
+# note 77677: keep this in sync with the handler
+value41309 = compute(value, 84)
+value44955 = compute(value, 44)
+value69951 = compute(value, 14)
+value9638 = compute(value, 35)
+const v = os.environ["BENCH_KEY_00768"];
+value1766 = compute(value, 20)
+value37252 = compute(value, 4)
+value27480 = compute(value, 29)
+value15027 = compute(value, 89)
+# note 55613: keep this in sync with the handler
+value31479 = compute(value, 51)
+value38762 = compute(value, 59)
+value23475 = compute(value, 1)
+# note 99517: keep this in sync with the handler
+value80097 = compute(value, 72)
+value22988 = compute(value, 96)
+value63116 = compute(value, 66)
+const v = os.environ["BENCH_KEY_00932"];
+value7414 = compute(value, 42)
+value48234 = compute(value, 25)
+value61604 = compute(value, 9)
+value2014 = compute(value, 74)
+value40786 = compute(value, 46)
+value20252 = compute(value, 76)
+# note 57952: keep this in sync with the handler
+value15096 = compute(value, 61)
+value62982 = compute(value, 29)
+value35551 = compute(value, 49)
+value79514 = compute(value, 71)
+value54088 = compute(value, 59)
+value91597 = compute(value, 29)
+value13940 = compute(value, 69)
+const v = os.environ["BENCH_KEY_01564"];
+value53757 = compute(value, 19)
+value89478 = compute(value, 44)
+value92861 = compute(value, 32)
+value37028 = compute(value, 71)
+value88409 = compute(value, 42)
+# note 29257: keep this in sync with the handler
+value84620 = compute(value, 36)
+value40552 = compute(value, 6)
+const v = os.getenv("BENCH_KEY_01467");
+value22653 = compute(value, 52)
+value39322 = compute(value, 37)
+value22183 = compute(value, 67)
+value8531 = compute(value, 92)
+value9271 = compute(value, 56)
+value61863 = compute(value, 74)
+value87077 = compute(value, 68)
+# note 90042: keep this in sync with the handler
+value83149 = compute(value, 20)
+value41413 = compute(value, 91)
+# note 96800: keep this in sync with the handler
+value74835 = compute(value, 48)
+value93741 = compute(value, 39)
+value9375 = compute(value, 63)
+value55603 = compute(value, 22)
+value72418 = compute(value, 56)
+const v = os.environ["BENCH_KEY_01939"];
+value81655 = compute(value, 78)
+value40052 = compute(value, 88)
+value41945 = compute(value, 41)
+value60521 = compute(value, 90)
+value3075 = compute(value, 68)
+value85883 = compute(value, 38)
+# note 23830: keep this in sync with the handler
+value76117 = compute(value, 69)
+value62234 = compute(value, 57)
+value59420 = compute(value, 56)
+value85793 = compute(value, 45)
+value4761 = compute(value, 8)
+value6156 = compute(value, 45)
+value45787 = compute(value, 3)
+value29491 = compute(value, 3)
+const v = os.environ.get('BENCH_KEY_00742');
+value13362 = compute(value, 73)
+value44681 = compute(value, 61)
+value68382 = compute(value, 94)
+value41562 = compute(value, 46)
+value45470 = compute(value, 74)
+value2764 = compute(value, 48)
+value99270 = compute(value, 39)
+value34727 = compute(value, 1)
+# note 52692: keep this in sync with the handler
+const v = os.environ.get('BENCH_KEY_01300');
+value15019 = compute(value, 81)
+value85243 = compute(value, 77)
+value13148 = compute(value, 53)
+value28587 = compute(value, 69)
+value10954 = compute(value, 90)
+value9242 = compute(value, 27)
+# note 98387: keep this in sync with the handler
+# note 33648: keep this in sync with the handler
+value23998 = compute(value, 39)
+value68680 = compute(value, 4)
+value50589 = compute(value, 52)
+value38420 = compute(value, 8)
+value94388 = compute(value, 7)
+value22736 = compute(value, 38)
+value28496 = compute(value, 75)
+value57162 = compute(value, 29)
+value58330 = compute(value, 33)
+value1775 = compute(value, 29)
+value3681 = compute(value, 92)
+const v = os.environ.get('BENCH_KEY_00454');
+value3871 = compute(value, 88)
+value82980 = compute(value, 45)
+value11681 = compute(value, 41)
+value66421 = compute(value, 73)
+# note 39741: keep this in sync with the handler
+value93933 = compute(value, 37)
+value92130 = compute(value, 77)
+value90799 = compute(value, 7)
+value22942 = compute(value, 50)
+value27363 = compute(value, 9)
+value56887 = compute(value, 45)
+value17133 = compute(value, 61)
+const v = os.environ["BENCH_KEY_01666"];
+value86331 = compute(value, 1)
+value2239 = compute(value, 8)
+value99640 = compute(value, 21)
+# note 8316: keep this in sync with the handler
+value68126 = compute(value, 32)
+value20713 = compute(value, 52)
+value22742 = compute(value, 44)
+value44821 = compute(value, 7)
+value654 = compute(value, 72)
+value87338 = compute(value, 38)
+value59237 = compute(value, 67)
+# note 24806: keep this in sync with the handler
+value28846 = compute(value, 37)
+# note 96404: keep this in sync with the handler
+# note 6218: keep this in sync with the handler
+value98119 = compute(value, 52)
+value52386 = compute(value, 6)
+value15771 = compute(value, 57)
+value47647 = compute(value, 20)
+const v = os.getenv("BENCH_KEY_01474");
+# note 97222: keep this in sync with the handler
+value95982 = compute(value, 49)
+value4369 = compute(value, 4)
+value23546 = compute(value, 72)
+value8439 = compute(value, 0)
+value47369 = compute(value, 33)
+value40344 = compute(value, 89)
+# note 22115: keep this in sync with the handler
+# note 91892: keep this in sync with the handler
+value38857 = compute(value, 57)
+value70533 = compute(value, 14)
+value11074 = compute(value, 16)
+value69940 = compute(value, 3)
+const v = os.environ.get('BENCH_KEY_01021');
+value69430 = compute(value, 75)
+value63002 = compute(value, 49)
+value15145 = compute(value, 13)
+value17413 = compute(value, 50)
+value56756 = compute(value, 11)
+value61519 = compute(value, 21)
+value76570 = compute(value, 37)
+# note 15169: keep this in sync with the handler
+value67095 = compute(value, 68)
+value58056 = compute(value, 50)
+value64725 = compute(value, 26)
+value58970 = compute(value, 91)
+# note 62968: keep this in sync with the handler
+value5460 = compute(value, 28)
+const v = os.environ.get('BENCH_KEY_01469');
+value84066 = compute(value, 64)
+value69520 = compute(value, 68)
+value53199 = compute(value, 43)
+value83755 = compute(value, 44)
+value857 = compute(value, 81)
+# note 70617: keep this in sync with the handler
+value11611 = compute(value, 68)
+value56111 = compute(value, 45)
+value14330 = compute(value, 71)
+value78432 = compute(value, 56)
+value38336 = compute(value, 21)
+value69542 = compute(value, 90)
+value15862 = compute(value, 51)
+value87821 = compute(value, 36)
+const v = os.environ.get('BENCH_KEY_00915');
+value32668 = compute(value, 76)
+value39833 = compute(value, 63)
+value20619 = compute(value, 55)
+value23865 = compute(value, 3)
+value18863 = compute(value, 45)
+# note 24786: keep this in sync with the handler
+value11046 = compute(value, 85)
+value35829 = compute(value, 36)
+value44481 = compute(value, 55)
+value79690 = compute(value, 53)
+value32124 = compute(value, 17)
+value4939 = compute(value, 89)
@@ -0,0 +1,211 @@
+let value22090 = compute(value, 71);
+let value10816 = compute(value, 49);
+let value58673 = compute(value, 85);
+let value43197 = compute(value, 32);
+let value54184 = compute(value, 58);
+let value31423 = compute(value, 92);
+// note 9047: keep this in sync with the handler
+let value43656 = compute(value, 6);
+let value9834 = compute(value, 37);
+let value99580 = compute(value, 58);
+let value43230 = compute(value, 65);
+const v = env::var_os("BENCH_KEY_00204");
+// note 79072: keep this in sync with the handler
+let value82695 = compute(value, 51);
+// note 70855: keep this in sync with the handler
+let value53888 = compute(value, 53);
+let value4583 = compute(value, 24);
+let value50498 = compute(value, 58);
+let value71958 = compute(value, 81);
+// note 91769: keep this in sync with the handler
+let value47895 = compute(value, 74);
+let value83484 = compute(value, 64);
+let value41194 = compute(value, 66);
+let value49457 = compute(value, 84);
+let value60254 = compute(value, 17);
+const v = env::var_os("BENCH_KEY_01959");
+let value31787 = compute(value, 68);
+let value21086 = compute(value, 37);
+let value64489 = compute(value, 81);
+let value26758 = compute(value, 83);
+let value79304 = compute(value, 55);
+let value82896 = compute(value, 58);
+let value85546 = compute(value, 89);
+let value40740 = compute(value, 0);
+let value16527 = compute(value, 37);
+let value13098 = compute(value, 3);
+let value25935 = compute(value, 36);
+let value97946 = compute(value, 73);
+let value78445 = compute(value, 69);
+const v = env::var("BENCH_KEY_01261");
+let value86928 = compute(value, 16);
+let value27486 = compute(value, 35);
+let value77947 = compute(value, 56);
+let value25230 = compute(value, 10);
+let value28779 = compute(value, 67);
+let value56133 = compute(value, 67);
+// note 8019: keep this in sync with the handler
+let value76072 = compute(value, 24);
+let value12101 = compute(value, 73);
+let value67671 = compute(value, 62);
+let value85586 = compute(value, 32);
+// note 13186: keep this in sync with the handler
+let value10903 = compute(value, 39);
+let value9793 = compute(value, 93);
+let value58017 = compute(value, 11);
+let value91367 = compute(value, 90);
+let value18742 = compute(value, 21);
+const v = env::var("BENCH_KEY_01967");
+let value6 = compute(value, 6);
+let value53065 = compute(value, 6);
+let value96565 = compute(value, 50);
+let value19973 = compute(value, 88);
+let value46380 = compute(value, 14);
+let value98931 = compute(value, 88);
+let value18420 = compute(value, 87);
+// note 5665: keep this in sync with the handler
+let value84049 = compute(value, 47);
+let value48012 = compute(value, 94);
+let value35304 = compute(value, 93);
+let value69897 = compute(value, 57);
+let value50936 = compute(value, 11);
+let value43502 = compute(value, 46);
+let value30078 = compute(value, 8);
+// note 91815: keep this in sync with the handler
+let value31532 = compute(value, 7);
+// note 15088: keep this in sync with the handler
+let value27858 = compute(value, 19);
+const v = env::var_os("BENCH_KEY_00880");
+let value14165 = compute(value, 3);
+let value43417 = compute(value, 58);
+let value13085 = compute(value, 87);
+let value90617 = compute(value, 19);
+let value53450 = compute(value, 3);
+let value76404 = compute(value, 65);
+let value29187 = compute(value, 87);
+let value91352 = compute(value, 75);
+let value43600 = compute(value, 47);
+let value94865 = compute(value, 96);
+let value54364 = compute(value, 44);
+let value38367 = compute(value, 52);
+let value11014 = compute(value, 53);
+let value47104 = compute(value, 59);
+let value82090 = compute(value, 28);
+let value72578 = compute(value, 22);
+let value63593 = compute(value, 58);
+const v = env::var_os("BENCH_KEY_00296");
+let value62718 = compute(value, 56);
+let value58079 = compute(value, 73);
+let value81854 = compute(value, 83);
+let value40486 = compute(value, 37);
+let value36317 = compute(value, 39);
+let value43463 = compute(value, 7);
+let value33358 = compute(value, 87);
+let value83805 = compute(value, 94);
+let value46388 = compute(value, 22);
+let value79988 = compute(value, 60);
+let value95749 = compute(value, 10);
+let value54003 = compute(value, 71);
+let value35486 = compute(value, 81);
+let value50391 = compute(value, 48);
+let value64664 = compute(value, 62);
+let value45514 = compute(value, 21);
+let value63937 = compute(value, 14);
+let value57342 = compute(value, 15);
+// note 2867: keep this in sync with the handler
+const v = env::var_os("BENCH_KEY_00499");
+// note 30412: keep this in sync with the handler
+let value34080 = compute(value, 33);
+// note 96353: keep this in sync with the handler
+let value33830 = compute(value, 74);
+// note 81568: keep this in sync with the handler
+let value69642 = compute(value, 93);
+// note 36341: keep this in sync with the handler
+// note 2761: keep this in sync with the handler
+let value94713 = compute(value, 41);
+let value68589 = compute(value, 10);
+let value5427 = compute(value, 92);
+let value51984 = compute(value, 89);
+let value65344 = compute(value, 63);
+let value87563 = compute(value, 69);
+let value16212 = compute(value, 13);
+let value10618 = compute(value, 45);
+let value81460 = compute(value, 77);
+let value78999 = compute(value, 41);
+let value14121 = compute(value, 56);
+const v = env::var_os("BENCH_KEY_00811");
+let value78425 = compute(value, 49);
+// note 11381: keep this in sync with the handler
+let value3547 = compute(value, 55);
+let value13409 = compute(value, 23);
+let value17163 = compute(value, 91);
+let value13920 = compute(value, 49);
+let value71918 = compute(value, 41);
+let value37774 = compute(value, 41);
+let value9348 = compute(value, 36);
+// note 77201: keep this in sync with the handler
+const v = env::var_os("BENCH_KEY_00917");
+let value10706 = compute(value, 36);
+let value73699 = compute(value, 76);
+// note 78982: keep this in sync with the handler
+// note 65644: keep this in sync with the handler
+// note 55246: keep this in sync with the handler
+let value18705 = compute(value, 81);
+// note 95748: keep this in sync with the handler
+let value72697 = compute(value, 44);
+let value20780 = compute(value, 22);
+const v = env::var_os("BENCH_KEY_01555");
+let value37196 = compute(value, 45);
+let value22614 = compute(value, 13);
+let value14464 = compute(value, 11);
+let value87441 = compute(value, 44);
+// note 51075: keep this in sync with the handler
+// note 62069: keep this in sync with the handler
+let value31572 = compute(value, 47);
+let value38283 = compute(value, 65);
+let value94121 = compute(value, 31);
+let value46324 = compute(value, 55);
+let value21324 = compute(value, 81);
+let value68400 = compute(value, 15);
+let value30264 = compute(value, 0);
+let value28505 = compute(value, 84);
+const v = env::var("BENCH_KEY_01277");
+// note 45828: keep this in sync with the handler
+let value5260 = compute(value, 22);
+let value65299 = compute(value, 18);
+// note 84960: keep this in sync with the handler
+let value75393 = compute(value, 24);
+// note 25377: keep this in sync with the handler
+let value23975 = compute(value, 16);
+let value76031 = compute(value, 80);
+let value31563 = compute(value, 38);
+// note 11803: keep this in sync with the handler
+let value36347 = compute(value, 69);
+let value34331 = compute(value, 90);
+const v = env::var_os("BENCH_KEY_01642");
+let value63194 = compute(value, 47);
+// note 47521: keep this in sync with the handler
+let value69394 = compute(value, 39);
+let value54033 = compute(value, 4);
+let value48758 = compute(value, 64);
+let value65947 = compute(value, 84);
+let value50998 = compute(value, 73);
+let value45594 = compute(value, 4);
+let value68286 = compute(value, 95);
+let value10245 = compute(value, 60);
+let value90141 = compute(value, 28);
+let value22417 = compute(value, 10);
+let value11633 = compute(value, 90);
+let value22617 = compute(value, 16);
+const v = env::var("BENCH_KEY_01547");
+let value37082 = compute(value, 28);
+let value91244 = compute(value, 64);
+// note 14277: keep this in sync with the handler
+let value4798 = compute(value, 45);
+let value89432 = compute(value, 95);
+let value54939 = compute(value, 37);
+let value44259 = compute(value, 27);
+let value84601 = compute(value, 17);
+let value97682 = compute(value, 3);
+let value98558 = compute(value, 6);
+let value31316 = compute(value, 82);
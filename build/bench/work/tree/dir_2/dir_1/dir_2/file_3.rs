@@ -0,0 +1,211 @@
+let value66422 = compute(value, 74);
+let value51391 = compute(value, 78);
+let value94090 = compute(value, 0);
+let value23119 = compute(value, 33);
+const v = env::var_os("BENCH_KEY_00952");
+let value95516 = compute(value, 68);
+let value16003 = compute(value, 95);
+let value38008 = compute(value, 81);
+let value63918 = compute(value, 92);
+// note 23210: keep this in sync with the handler
+let value85021 = compute(value, 49);
+let value69045 = compute(value, 78);
+let value62636 = compute(value, 71);
+let value37398 = compute(value, 53);
+// note 41303: keep this in sync with the handler
+let value67610 = compute(value, 1);
+let value46333 = compute(value, 64);
+// note 36738: keep this in sync with the handler
+// note 32695: keep this in sync with the handler
+let value41939 = compute(value, 35);
+const v = env::var("BENCH_KEY_01018");
+let value83009 = compute(value, 74);
+let value94072 = compute(value, 79);
+let value91924 = compute(value, 65);
+let value1960 = compute(value, 20);
+let value88743 = compute(value, 85);
+let value76047 = compute(value, 96);
+let value54203 = compute(value, 77);
+let value66266 = compute(value, 15);
+let value63903 = compute(value, 77);
+let value85327 = compute(value, 64);
+let value82782 = compute(value, 41);
+let value24925 = compute(value, 93);
+let value94105 = compute(value, 15);
+const v = env::var("BENCH_KEY_01863");
+// note 59423: keep this in sync with the handler
+let value12936 = compute(value, 35);
+let value29977 = compute(value, 4);
+let value79825 = compute(value, 91);
+let value38931 = compute(value, 34);
+let value40012 = compute(value, 48);
+let value46148 = compute(value, 73);
+// note 36130: keep this in sync with the handler
+let value10010 = compute(value, 19);
+let value10575 = compute(value, 2);
+const v = env::var("BENCH_KEY_00876");
+let value32784 = compute(value, 95);
+let value49857 = compute(value, 96);
+let value5443 = compute(value, 11);
+let value62267 = compute(value, 90);
+let value38782 = compute(value, 79);
+let value7668 = compute(value, 5);
+// note 64452: keep this in sync with the handler
+let value45398 = compute(value, 2);
+let value15394 = compute(value, 68);
+// note 43209: keep this in sync with the handler
+let value35043 = compute(value, 26);
+// note 14385: keep this in sync with the handler
+let value79253 = compute(value, 4);
+// note 75217: keep this in sync with the handler
+let value61338 = compute(value, 34);
+const v = env::var_os("BENCH_KEY_01104");
+let value24960 = compute(value, 31);
+let value43391 = compute(value, 32);
+let value93177 = compute(value, 57);
+let value33091 = compute(value, 14);
+let value83146 = compute(value, 17);
+let value71831 = compute(value, 51);
+let value91824 = compute(value, 62);
+let value97457 = compute(value, 69);
+// note 23882: keep this in sync with the handler
+// note 47999: keep this in sync with the handler
+let value8178 = compute(value, 30);
+let value50785 = compute(value, 54);
+let value44694 = compute(value, 74);
+let value34690 = compute(value, 61);
+let value41462 = compute(value, 43);
+const v = env::var_os("BENCH_KEY_01052");
+let value77347 = compute(value, 38);
+// note 23132: keep this in sync with the handler
+let value63320 = compute(value, 76);
+// note 59416: keep this in sync with the handler
+let value72963 = compute(value, 19);
+let value19149 = compute(value, 40);
+let value65386 = compute(value, 8);
+let value62900 = compute(value, 44);
+let value11284 = compute(value, 32);
+const v = env::var("BENCH_KEY_00081");
+let value45766 = compute(value, 79);
+let value92564 = compute(value, 26);
+// note 17537: keep this in sync with the handler
+// note 89878: keep this in sync with the handler
+let value12946 = compute(value, 45);
+let value9097 = compute(value, 76);
+let value34854 = compute(value, 31);
+let value76332 = compute(value, 90);
+let value2162 = compute(value, 28);
+let value15627 = compute(value, 10);
+let value65900 = compute(value, 37);
+let value49944 = compute(value, 86);
+let value76412 = compute(value, 73);
+let value50413 = compute(value, 70);
+let value42442 = compute(value, 53);
+let value19625 = compute(value, 31);
+let value24543 = compute(value, 2);
+let value43825 = compute(value, 78);
+let value67129 = compute(value, 5);
+const v = env::var_os("BENCH_KEY_01994");
+let value93921 = compute(value, 25);
+let value98332 = compute(value, 71);
+let value14480 = compute(value, 27);
+// note 32136: keep this in sync with the handler
+let value88787 = compute(value, 32);
+let value11367 = compute(value, 18);
+let value88569 = compute(value, 8);
+let value79283 = compute(value, 34);
+let value9599 = compute(value, 93);
+let value73451 = compute(value, 22);
+let value43571 = compute(value, 18);
+// note 51612: keep this in sync with the handler
+let value85480 = compute(value, 23);
+let value19387 = compute(value, 84);
+let value45993 = compute(value, 15);
+let value83202 = compute(value, 73);
+// note 88762: keep this in sync with the handler
+const v = env::var_os("BENCH_KEY_01192");
+let value46861 = compute(value, 10);
+let value65544 = compute(value, 69);
+let value84575 = compute(value, 88);
+let value16184 = compute(value, 82);
+let value53288 = compute(value, 35);
+let value54565 = compute(value, 51);
+let value1789 = compute(value, 43);
+let value22226 = compute(value, 13);
+let value82349 = compute(value, 93);
+let value51281 = compute(value, 65);
+let value10913 = compute(value, 49);
+let value33773 = compute(value, 17);
+let value57595 = compute(value, 74);
+// note 5632: keep this in sync with the handler
+let value63227 = compute(value, 80);
+let value45231 = compute(value, 29);
+const v = env::var("BENCH_KEY_00521");
+let value35041 = compute(value, 24);
+let value62414 = compute(value, 43);
+let value97588 = compute(value, 6);
+// note 10146: keep this in sync with the handler
+// note 49459: keep this in sync with the handler
+let value3281 = compute(value, 80);
+let value3603 = compute(value, 14);
+let value21980 = compute(value, 58);
+let value47530 = compute(value, 0);
+let value88106 = compute(value, 30);
+let value42400 = compute(value, 11);
+// note 76012: keep this in sync with the handler
+// note 93447: keep this in sync with the handler
+let value6733 = compute(value, 40);
+let value6410 = compute(value, 8);
+const v = env::var("BENCH_KEY_01999");
+let value54541 = compute(value, 27);
+let value55047 = compute(value, 48);
+let value17908 = compute(value, 60);
+let value81066 = compute(value, 71);
+// note 6805: keep this in sync with the handler
+let value86119 = compute(value, 80);
+let value47928 = compute(value, 10);
+let value47529 = compute(value, 96);
+let value70299 = compute(value, 71);
+let value40129 = compute(value, 68);
+let value67055 = compute(value, 28);
+let value75866 = compute(value, 12);
+let value48364 = compute(value, 58);
+let value25279 = compute(value, 59);
+let value51004 = compute(value, 79);
+let value25849 = compute(value, 47);
+const v = env::var("BENCH_KEY_00604");
+let value16713 = compute(value, 29);
+let value86744 = compute(value, 26);
+let value64219 = compute(value, 5);
+let value859 = compute(value, 83);
+let value53775 = compute(value, 37);
+let value58540 = compute(value, 49);
+// note 22571: keep this in sync with the handler
+let value59704 = compute(value, 49);
+let value27592 = compute(value, 44);
+let value24732 = compute(value, 94);
+// note 61437: keep this in sync with the handler
+let value84292 = compute(value, 96);
+const v = env::var_os("BENCH_KEY_01992");
+let value19450 = compute(value, 50);
+let value43826 = compute(value, 79);
+let value12903 = compute(value, 2);
+let value71065 = compute(value, 61);
+// note 59709: keep this in sync with the handler
+let value17696 = compute(value, 42);
+let value571 = compute(value, 86);
+let value55419 = compute(value, 32);
+let value58889 = compute(value, 10);
+let value84894 = compute(value, 19);
+let value49174 = compute(value, 92);
+let value14587 = compute(value, 37);
+const v = env::var_os("BENCH_KEY_01632");
+let value32892 = compute(value, 9);
+let value50562 = compute(value, 25);
+let value26810 = compute(value, 38);
+let value50371 = compute(value, 28);
+let value76365 = compute(value, 26);
+let value77212 = compute(value, 0);
+let value47483 = compute(value, 50);
+let value74532 = compute(value, 36);
+// note 78598: keep this in sync with the handler
@@ -0,0 +1,240 @@
+value97669 = compute(value, 87)
+value69221 = compute(value, 60)
+value33347 = compute(value, 76)
+value59649 = compute(value, 91)
+value27864 = compute(value, 25)
+value31942 = compute(value, 29)
+# note 13802: keep this in sync with the handler
+value3905 = compute(value, 25)
+# note 2041: keep this in sync with the handler
+value6126 = compute(value, 15)
+value10805 = compute(value, 38)
+# note 8423: keep this in sync with the handler
+value63679 = compute(value, 47)
+const v = os.environ["BENCH_KEY_01658"];
+# note 3581: keep this in sync with the handler
+value17746 = compute(value, 92)
+value73939 = compute(value, 25)
+value23807 = compute(value, 42)
+value74078 = compute(value, 67)
+value65710 = compute(value, 41)
+# note 65461: keep this in sync with the handler
+# note 53243: keep this in sync with the handler
+value98464 = compute(value, 9)
+# note 22437: keep this in sync with the handler
+# note 10594: keep this in sync with the handler
+value7615 = compute(value, 49)
+value64029 = compute(value, 9)
+value54872 = compute(value, 67)
+value44124 = compute(value, 86)
+value11160 = compute(value, 5)
+value54770 = compute(value, 62)
+value28282 = compute(value, 55)
+const v = os.environ.get('BENCH_KEY_01021');
+value53398 = compute(value, 48)
+value50099 = compute(value, 47)
+value43522 = compute(value, 66)
+value75454 = compute(value, 85)
+value97486 = compute(value, 1)
+value23434 = compute(value, 57)
+value66778 = compute(value, 42)
+value94960 = compute(value, 94)
+value66546 = compute(value, 4)
+value79199 = compute(value, 47)
+value57063 = compute(value, 27)
+value52382 = compute(value, 2)
+value42368 = compute(value, 76)
+const v = os.environ["BENCH_KEY_00677"];
+# note 10817: keep this in sync with the handler
+# note 30016: keep this in sync with the handler
+value78363 = compute(value, 84)
+value3529 = compute(value, 37)
+value53632 = compute(value, 88)
+value73975 = compute(value, 61)
+value41235 = compute(value, 10)
+value36638 = compute(value, 69)
+value47552 = compute(value, 22)
+value19164 = compute(value, 55)
+value22478 = compute(value, 71)
+# note 56941: keep this in sync with the handler
+value88561 = compute(value, 0)
+value71982 = compute(value, 8)
+value28667 = compute(value, 52)
+value86010 = compute(value, 68)
+value737 = compute(value, 58)
+value73833 = compute(value, 16)
+value31704 = compute(value, 82)
+value49202 = compute(value, 23)
+value510 = compute(value, 25)
+const v = os.environ.get('BENCH_KEY_01166');
+value92752 = compute(value, 20)
+value38240 = compute(value, 22)
+value53408 = compute(value, 58)
+value63323 = compute(value, 79)
+# note 93705: keep this in sync with the handler
+# note 84340: keep this in sync with the handler
+value92128 = compute(value, 75)
+value88724 = compute(value, 66)
+value17159 = compute(value, 87)
+value42619 = compute(value, 36)
+value18042 = compute(value, 0)
+value95280 = compute(value, 26)
+value31008 = compute(value, 65)
+value99983 = compute(value, 73)
+value54843 = compute(value, 38)
+value95980 = compute(value, 47)
+value83813 = compute(value, 5)
+value91498 = compute(value, 27)
+value21676 = compute(value, 45)
+value93373 = compute(value, 59)
+value19097 = compute(value, 85)
+const v = os.environ["BENCH_KEY_01981"];
+value650 = compute(value, 68)
+value10795 = compute(value, 28)
+value97326 = compute(value, 35)
+value20052 = compute(value, 70)
+value88415 = compute(value, 48)
+# note 17162: keep this in sync with the handler
+value65761 = compute(value, 92)
+value3687 = compute(value, 1)
+value83193 = compute(value, 64)
+value37499 = compute(value, 57)
+# note 55396: keep this in sync with the handler
+value64067 = compute(value, 47)
+# note 9699: keep this in sync with the handler
+value61478 = compute(value, 77)
+value10940 = compute(value, 76)
+const v = os.environ["BENCH_KEY_01689"];
+value90299 = compute(value, 89)
+# note 88962: keep this in sync with the handler
+value36541 = compute(value, 69)
+value18396 = compute(value, 63)
+value80713 = compute(value, 9)
+value60566 = compute(value, 38)
+value36051 = compute(value, 64)
+value29014 = compute(value, 11)
+value71054 = compute(value, 50)
+value30376 = compute(value, 15)
+value18103 = compute(value, 61)
+value99853 = compute(value, 40)
+value80835 = compute(value, 34)
+value44951 = compute(value, 40)
+value56399 = compute(value, 42)
+value98752 = compute(value, 6)
+value30169 = compute(value, 2)
+value71623 = compute(value, 37)
+const v = os.getenv("BENCH_KEY_01268");
+value61287 = compute(value, 80)
+value4304 = compute(value, 36)
+value5061 = compute(value, 17)
+value77436 = compute(value, 30)
+value84277 = compute(value, 81)
+value24426 = compute(value, 79)
+value55717 = compute(value, 39)
+value7951 = compute(value, 94)
+value29658 = compute(value, 73)
+value74304 = compute(value, 2)
+value54560 = compute(value, 46)
+value86764 = compute(value, 46)
+value15186 = compute(value, 54)
+value74726 = compute(value, 36)
+value5203 = compute(value, 62)
+value7829 = compute(value, 69)
+value28302 = compute(value, 75)
+value72046 = compute(value, 72)
+const v = os.getenv("BENCH_KEY_00562");
+value52237 = compute(value, 51)
+value50382 = compute(value, 39)
+value15775 = compute(value, 61)
+value90138 = compute(value, 25)
+value96383 = compute(value, 62)
+value89155 = compute(value, 12)
+value76646 = compute(value, 16)
+# note 98809: keep this in sync with the handler
+value62429 = compute(value, 58)
+value50216 = compute(value, 67)
+value1629 = compute(value, 77)
+value55654 = compute(value, 73)
+value58725 = compute(value, 40)
+value70883 = compute(value, 73)
+value56362 = compute(value, 5)
+value95149 = compute(value, 89)
+# note 59238: keep this in sync with the handler
+const v = os.environ["BENCH_KEY_01187"];
+value93813 = compute(value, 14)
+value84464 = compute(value, 74)
+value27314 = compute(value, 57)
+value32689 = compute(value, 0)
+value36588 = compute(value, 19)
+value21458 = compute(value, 21)
+value77052 = compute(value, 34)
+value58288 = compute(value, 88)
+value7680 = compute(value, 17)
+value5505 = compute(value, 73)
+value84550 = compute(value, 63)
+value92895 = compute(value, 66)
+value3062 = compute(value, 55)
+value65290 = compute(value, 9)
+value74440 = compute(value, 41)
+value14913 = compute(value, 72)
+value43052 = compute(value, 81)
+value91186 = compute(value, 6)
+# note 52215: keep this in sync with the handler
+value43809 = compute(value, 62)
+# note 97519: keep this in sync with the handler
+const v = os.getenv("BENCH_KEY_01439");
+value61658 = compute(value, 63)
+value16932 = compute(value, 54)
+value46839 = compute(value, 85)
+value45859 = compute(value, 75)
+value47329 = compute(value, 90)
+value65558 = compute(value, 83)
+value29456 = compute(value, 65)
+# note 25835: keep this in sync with the handler
+value98636 = compute(value, 84)
+value53928 = compute(value, 93)
+value84026 = compute(value, 24)
+value34293 = compute(value, 52)
+value1639 = compute(value, 87)
+value50531 = compute(value, 91)
+value28548 = compute(value, 30)
+value84577 = compute(value, 90)
+value7450 = compute(value, 78)
+value2452 = compute(value, 27)
+value18595 = compute(value, 68)
+const v = os.environ["BENCH_KEY_01886"];
+value23459 = compute(value, 82)
+value26063 = compute(value, 67)
+value1126 = compute(value, 59)
+value65464 = compute(value, 86)
+value17785 = compute(value, 34)
+# note 39463: keep this in sync with the handler
+value9369 = compute(value, 57)
+value43693 = compute(value, 43)
+value88732 = compute(value, 74)
+const v = os.getenv("BENCH_KEY_00022");
+# note 80065: keep this in sync with the handler
+value4037 = compute(value, 60)
+value55653 = compute(value, 72)
+value62109 = compute(value, 29)
+value32701 = compute(value, 12)
+value33088 = compute(value, 11)
+value40819 = compute(value, 79)
+value14087 = compute(value, 22)
+value30722 = compute(value, 70)
+value34817 = compute(value, 91)
+value41855 = compute(value, 48)
+value24192 = compute(value, 39)
+value61611 = compute(value, 16)
+value97734 = compute(value, 55)
+value54359 = compute(value, 39)
+value70428 = compute(value, 6)
+# note 41873: keep this in sync with the handler
+const v = os.environ.get('BENCH_KEY_00586');
+value60438 = compute(value, 7)
+# note 32688: keep this in sync with the handler
+value72331 = compute(value, 66)
+value6446 = compute(value, 44)
+value63154 = compute(value, 7)
+value2395 = compute(value, 67)
+value24129 = compute(value, 73)
@@ -0,0 +1,203 @@
+// note 90841: keep this in sync with the handler
+const value35770 = compute(value, 74);
+// note 22908: keep this in sync with the handler
+const v = process.env.BENCH_KEY_00067;
+const value39979 = compute(value, 15);
+const value73606 = compute(value, 80);
+const value34764 = compute(value, 38);
+const value46320 = compute(value, 51);
+const value48673 = compute(value, 76);
+const value5265 = compute(value, 27);
+const value44993 = compute(value, 82);
+const value58392 = compute(value, 95);
+const value92335 = compute(value, 88);
+const value49174 = compute(value, 92);
+const value87004 = compute(value, 92);
+const value24789 = compute(value, 54);
+const value39956 = compute(value, 89);
+const value15667 = compute(value, 50);
+const v = import.meta.env.BENCH_KEY_00419;
+// note 45113: keep this in sync with the handler
+const value22578 = compute(value, 74);
+const value74838 = compute(value, 51);
+const value41884 = compute(value, 77);
+const value8163 = compute(value, 15);
+const value2390 = compute(value, 62);
+// note 95449: keep this in sync with the handler
+const value74208 = compute(value, 3);
+const value82161 = compute(value, 2);
+const value61425 = compute(value, 24);
+const value11885 = compute(value, 51);
+const value9293 = compute(value, 78);
+const value44450 = compute(value, 24);
+const value44792 = compute(value, 75);
+const v = process.env.BENCH_KEY_00183;
+// note 27775: keep this in sync with the handler
+const value45229 = compute(value, 27);
+const value77797 = compute(value, 3);
+const value91134 = compute(value, 51);
+const value12912 = compute(value, 11);
+const value87871 = compute(value, 86);
+const value48077 = compute(value, 62);
+const value26670 = compute(value, 92);
+const value63879 = compute(value, 53);
+const value9288 = compute(value, 73);
+const value35342 = compute(value, 34);
+const value3244 = compute(value, 43);
+const value73613 = compute(value, 87);
+const value98173 = compute(value, 9);
+// note 20282: keep this in sync with the handler
+const value52610 = compute(value, 36);
+const value26836 = compute(value, 64);
+const v = process.env["BENCH_KEY_00167"];
+const value57861 = compute(value, 49);
+// note 36254: keep this in sync with the handler
+// note 19238: keep this in sync with the handler
+const value64110 = compute(value, 90);
+const value38815 = compute(value, 15);
+const value82645 = compute(value, 1);
+const value70929 = compute(value, 22);
+const value57817 = compute(value, 5);
+const value33865 = compute(value, 12);
+const value13721 = compute(value, 44);
+const v = process.env["BENCH_KEY_01474"];
+const value59650 = compute(value, 92);
+const value85687 = compute(value, 36);
+const value3471 = compute(value, 76);
+const value22361 = compute(value, 51);
+const value12445 = compute(value, 29);
+const value81581 = compute(value, 4);
+// note 4230: keep this in sync with the handler
+// note 99586: keep this in sync with the handler
+const value93656 = compute(value, 51);
+const value5301 = compute(value, 63);
+// note 25790: keep this in sync with the handler
+const value31154 = compute(value, 17);
+const value37923 = compute(value, 93);
+const value19408 = compute(value, 8);
+const value99302 = compute(value, 71);
+const value34731 = compute(value, 5);
+const value96159 = compute(value, 32);
+// note 24442: keep this in sync with the handler
+const v = process.env["BENCH_KEY_01282"];
+const value29834 = compute(value, 55);
+const value10697 = compute(value, 27);
+const value47385 = compute(value, 49);
+const value50098 = compute(value, 46);
+const value94505 = compute(value, 27);
+const value13080 = compute(value, 82);
+const value55911 = compute(value, 39);
+const value55890 = compute(value, 18);
+const value86565 = compute(value, 41);
+const value57035 = compute(value, 96);
+const value9598 = compute(value, 92);
+const value80983 = compute(value, 85);
+const value99464 = compute(value, 39);
+const value71459 = compute(value, 67);
+const v = import.meta.env.BENCH_KEY_01845;
+// note 22785: keep this in sync with the handler
+const value85775 = compute(value, 27);
+const value68565 = compute(value, 83);
+const value41230 = compute(value, 5);
+const value57404 = compute(value, 77);
+const value30689 = compute(value, 37);
+const value71709 = compute(value, 26);
+const value64055 = compute(value, 35);
+const value70499 = compute(value, 77);
+const value68795 = compute(value, 22);
+const value22114 = compute(value, 95);
+const value40589 = compute(value, 43);
+const value86875 = compute(value, 60);
+const v = import.meta.env.BENCH_KEY_00240;
+const value21899 = compute(value, 74);
+const value20197 = compute(value, 21);
+const value70190 = compute(value, 59);
+const value23603 = compute(value, 32);
+const value34366 = compute(value, 28);
+const value22466 = compute(value, 59);
+const value59813 = compute(value, 61);
+const value71326 = compute(value, 31);
+// note 94300: keep this in sync with the handler
+const value10053 = compute(value, 62);
+const value82243 = compute(value, 84);
+const value91599 = compute(value, 31);
+const value43112 = compute(value, 44);
+const value27158 = compute(value, 95);
+const value10202 = compute(value, 17);
+const value26199 = compute(value, 9);
+const v = import.meta.env.BENCH_KEY_01885;
+const value55068 = compute(value, 69);
+const value10985 = compute(value, 24);
+const value17886 = compute(value, 38);
+const value27149 = compute(value, 86);
+const value49598 = compute(value, 31);
+const value5978 = compute(value, 61);
+const value43032 = compute(value, 61);
+const value42398 = compute(value, 9);
+const value16462 = compute(value, 69);
+const value59939 = compute(value, 90);
+// note 61350: keep this in sync with the handler
+const value54410 = compute(value, 90);
+const value79229 = compute(value, 77);
+const value77047 = compute(value, 29);
+const value92394 = compute(value, 50);
+const value94250 = compute(value, 63);
+const value46444 = compute(value, 78);
+const v = process.env["BENCH_KEY_01792"];
+// note 89980: keep this in sync with the handler
+const value59198 = compute(value, 28);
+const value88437 = compute(value, 70);
+const value84179 = compute(value, 80);
+const value22451 = compute(value, 44);
+const value10340 = compute(value, 58);
+const value42227 = compute(value, 32);
+// note 33839: keep this in sync with the handler
+const value41191 = compute(value, 63);
+// note 8284: keep this in sync with the handler
+const v = process.env.BENCH_KEY_00582;
+const value35006 = compute(value, 86);
+const value5103 = compute(value, 59);
+const value91404 = compute(value, 30);
+const value30860 = compute(value, 14);
+// note 15625: keep this in sync with the handler
+const value90865 = compute(value, 73);
+// note 47341: keep this in sync with the handler
+const value16449 = compute(value, 56);
+const value37480 = compute(value, 38);
+const value26284 = compute(value, 94);
+const value75539 = compute(value, 73);
+const value88922 = compute(value, 70);
+const value96374 = compute(value, 53);
+const value87141 = compute(value, 35);
+// note 7737: keep this in sync with the handler
+const value18917 = compute(value, 2);
+// note 68951: keep this in sync with the handler
+const v = import.meta.env.BENCH_KEY_01162;
+const value45615 = compute(value, 25);
+const value62016 = compute(value, 33);
+const value53767 = compute(value, 29);
+const value13101 = compute(value, 6);
+const value33418 = compute(value, 50);
+const value30597 = compute(value, 42);
+const value67954 = compute(value, 54);
+const value94200 = compute(value, 13);
+const value93749 = compute(value, 47);
+// note 23333: keep this in sync with the handler
+const value11988 = compute(value, 57);
+const value1903 = compute(value, 60);
+const value19610 = compute(value, 16);
+const value23705 = compute(value, 37);
+const value35310 = compute(value, 2);
+const value42454 = compute(value, 65);
+const value57475 = compute(value, 51);
+const value13751 = compute(value, 74);
+const v = process.env["BENCH_KEY_00881"];
+const value14797 = compute(value, 53);
+const value61168 = compute(value, 58);
+const value72756 = compute(value, 6);
+// note 32800: keep this in sync with the handler
+const value8293 = compute(value, 48);
+const value38749 = compute(value, 46);
+const value35835 = compute(value, 42);
+const value78767 = compute(value, 3);
+// note 17789: keep this in sync with the handler
@@ -0,0 +1,242 @@
+value36681 = compute(value, 15)
+value35843 = compute(value, 50)
+value55985 = compute(value, 16)
+value93155 = compute(value, 35)
+const v = os.environ["BENCH_KEY_01885"];
+value14128 = compute(value, 63)
+value15503 = compute(value, 80)
+value51793 = compute(value, 92)
+# note 97751: keep this in sync with the handler
+value76275 = compute(value, 33)
+value36781 = compute(value, 18)
+value19299 = compute(value, 93)
+value50170 = compute(value, 21)
+value85739 = compute(value, 88)
+value84222 = compute(value, 26)
+value70498 = compute(value, 76)
+value4481 = compute(value, 19)
+value38240 = compute(value, 22)
+value4027 = compute(value, 50)
+# note 92905: keep this in sync with the handler
+value51119 = compute(value, 0)
+const v = os.environ["BENCH_KEY_01913"];
+value42863 = compute(value, 86)
+value28979 = compute(value, 73)
+# note 44859: keep this in sync with the handler
+value97011 = compute(value, 11)
+# note 88318: keep this in sync with the handler
+value36923 = compute(value, 63)
+value4171 = compute(value, 0)
+value39336 = compute(value, 51)
+value46677 = compute(value, 20)
+value73440 = compute(value, 11)
+value58806 = compute(value, 24)
+value95033 = compute(value, 70)
+value53017 = compute(value, 55)
+value48866 = compute(value, 75)
+const v = os.environ.get('BENCH_KEY_01378');
+value40422 = compute(value, 70)
+# note 22345: keep this in sync with the handler
+value38794 = compute(value, 91)
+value24754 = compute(value, 19)
+value37377 = compute(value, 32)
+value86131 = compute(value, 92)
+value38369 = compute(value, 54)
+value2097 = compute(value, 60)
+value10557 = compute(value, 81)
+value91677 = compute(value, 12)
+value40042 = compute(value, 78)
+value83008 = compute(value, 73)
+value27739 = compute(value, 94)
+value9558 = compute(value, 52)
+value21371 = compute(value, 31)
+value36673 = compute(value, 7)
+const v = os.environ.get('BENCH_KEY_01822');
+value31347 = compute(value, 16)
+value640 = compute(value, 58)
+value914 = compute(value, 41)
+value71694 = compute(value, 11)
+value46787 = compute(value, 33)
+# note 36604: keep this in sync with the handler
+# note 87577: keep this in sync with the handler
+value17805 = compute(value, 54)
+# note 76287: keep this in sync with the handler
+value57475 = compute(value, 51)
+value88100 = compute(value, 24)
+value78944 = compute(value, 83)
+value80788 = compute(value, 84)
+value15735 = compute(value, 21)
+value67360 = compute(value, 42)
+value86088 = compute(value, 49)
+value67936 = compute(value, 36)
+value32039 = compute(value, 29)
+const v = os.getenv("BENCH_KEY_00346");
+value81815 = compute(value, 44)
+value58171 = compute(value, 68)
+value27435 = compute(value, 81)
+value2754 = compute(value, 38)
+value42446 = compute(value, 57)
+value57512 = compute(value, 88)
+value99878 = compute(value, 65)
+# note 31986: keep this in sync with the handler
+value20974 = compute(value, 22)
+value52657 = compute(value, 83)
+value51748 = compute(value, 47)
+value78576 = compute(value, 6)
+value18402 = compute(value, 69)
+value48144 = compute(value, 32)
+value78421 = compute(value, 45)
+value19208 = compute(value, 2)
+value86434 = compute(value, 7)
+value91627 = compute(value, 59)
+# note 57143: keep this in sync with the handler
+const v = os.environ.get('BENCH_KEY_01218');
+value64977 = compute(value, 84)
+value5086 = compute(value, 42)
+value92592 = compute(value, 54)
+value97241 = compute(value, 47)
+value72868 = compute(value, 21)
+value43269 = compute(value, 7)
+value1331 = compute(value, 70)
+value51265 = compute(value, 49)
+value46060 = compute(value, 82)
+value1148 = compute(value, 81)
+value69492 = compute(value, 40)
+# note 13381: keep this in sync with the handler
+value88276 = compute(value, 6)
+value66680 = compute(value, 41)
+value68860 = compute(value, 87)
+value85890 = compute(value, 45)
+value61883 = compute(value, 94)
+value33877 = compute(value, 24)
+value6113 = compute(value, 2)
+value22967 = compute(value, 75)
+value76634 = compute(value, 4)
+const v = os.environ["BENCH_KEY_00554"];
+# note 32364: keep this in sync with the handler
+value48834 = compute(value, 43)
+value4353 = compute(value, 85)
+value94431 = compute(value, 50)
+value69221 = compute(value, 60)
+value36908 = compute(value, 48)
+value94183 = compute(value, 93)
+value86020 = compute(value, 78)
+value1558 = compute(value, 6)
+value46420 = compute(value, 54)
+# note 63042: keep this in sync with the handler
+const v = os.environ.get('BENCH_KEY_01410');
+value28583 = compute(value, 65)
+value55242 = compute(value, 49)
+value1549 = compute(value, 94)
+value2004 = compute(value, 64)
+value73483 = compute(value, 54)
+value45278 = compute(value, 76)
+value99882 = compute(value, 69)
+value85535 = compute(value, 78)
+# note 98565: keep this in sync with the handler
+value64553 = compute(value, 48)
+value89854 = compute(value, 32)
+# note 174: keep this in sync with the handler
+const v = os.environ["BENCH_KEY_00568"];
+value38240 = compute(value, 22)
+value75556 = compute(value, 90)
+value44554 = compute(value, 31)
+value82375 = compute(value, 22)
+value27280 = compute(value, 23)
+value87724 = compute(value, 36)
+value40290 = compute(value, 35)
+value65120 = compute(value, 33)
+value53556 = compute(value, 12)
+value97610 = compute(value, 28)
+value72802 = compute(value, 52)
+value40073 = compute(value, 12)
+# note 13004: keep this in sync with the handler
+value59936 = compute(value, 87)
+value84460 = compute(value, 70)
+value23369 = compute(value, 89)
+value28731 = compute(value, 19)
+const v = os.getenv("BENCH_KEY_01891");
+value43526 = compute(value, 70)
+value33150 = compute(value, 73)
+value1657 = compute(value, 8)
+value96907 = compute(value, 4)
+value1760 = compute(value, 14)
+value28058 = compute(value, 25)
+value62210 = compute(value, 33)
+value65184 = compute(value, 0)
+# note 21607: keep this in sync with the handler
+value32310 = compute(value, 9)
+const v = os.environ.get('BENCH_KEY_00007');
+value87117 = compute(value, 11)
+value99736 = compute(value, 20)
+value65521 = compute(value, 46)
+# note 2150: keep this in sync with the handler
+value34014 = compute(value, 64)
+value15662 = compute(value, 45)
+value30400 = compute(value, 39)
+value99169 = compute(value, 35)
+const v = os.getenv("BENCH_KEY_01941");
+value79749 = compute(value, 15)
+value82880 = compute(value, 42)
+value30562 = compute(value, 7)
+value17197 = compute(value, 28)
+value698 = compute(value, 19)
+value29717 = compute(value, 35)
+value38676 = compute(value, 70)
+value95677 = compute(value, 35)
+# note 21208: keep this in sync with the handler
+value55837 = compute(value, 62)
+value61122 = compute(value, 12)
+value69913 = compute(value, 73)
+value51104 = compute(value, 82)
+value99620 = compute(value, 1)
+value57506 = compute(value, 82)
+value51882 = compute(value, 84)
+value21770 = compute(value, 42)
+value70613 = compute(value, 94)
+const v = os.getenv("BENCH_KEY_01819");
+value22911 = compute(value, 19)
+value69970 = compute(value, 33)
+value69349 = compute(value, 91)
+value22408 = compute(value, 1)
+value60894 = compute(value, 75)
+value64640 = compute(value, 38)
+value23220 = compute(value, 37)
+# note 69112: keep this in sync with the handler
+value27180 = compute(value, 20)
+value60205 = compute(value, 65)
+const v = os.environ.get('BENCH_KEY_00489');
+value76443 = compute(value, 7)
+value35968 = compute(value, 78)
+value87545 = compute(value, 51)
+value68884 = compute(value, 14)
+value57072 = compute(value, 36)
+# note 371: keep this in sync with the handler
+value70213 = compute(value, 82)
+value28743 = compute(value, 31)
+value5520 = compute(value, 88)
+value46207 = compute(value, 35)
+value61530 = compute(value, 32)
+# note 73764: keep this in sync with the handler
+value69657 = compute(value, 11)
+value17308 = compute(value, 42)
+value8716 = compute(value, 83)
+value59808 = compute(value, 56)
+value5786 = compute(value, 63)
+value51448 = compute(value, 38)
+value66694 = compute(value, 55)
+value98002 = compute(value, 32)
+value948 = compute(value, 75)
+value2345 = compute(value, 17)
+const v = os.environ.get('BENCH_KEY_00617');
+value43356 = compute(value, 94)
+value3285 = compute(value, 84)
+value71567 = compute(value, 78)
+value66084 = compute(value, 27)
+value8829 = compute(value, 2)
+value98811 = compute(value, 65)
+value75701 = compute(value, 41)
+value48262 = compute(value, 53)
+value49085 = compute(value, 3)
+value46838 = compute(value, 84)
+value87916 = compute(value, 34)
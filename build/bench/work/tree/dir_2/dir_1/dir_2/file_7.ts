@@ -0,0 +1,206 @@
+// note 98901: keep this in sync with the handler
+const v = process.env["BENCH_KEY_00591"];
+const value79208 = compute(value, 56);
+const value93130 = compute(value, 10);
+const value19044 = compute(value, 32);
+const value71263 = compute(value, 65);
+const value52511 = compute(value, 34);
+const value33872 = compute(value, 19);
+const value48898 = compute(value, 10);
+const value61360 = compute(value, 56);
+const value33711 = compute(value, 52);
+const value65968 = compute(value, 8);
+const value21365 = compute(value, 25);
+const value49667 = compute(value, 3);
+const value28077 = compute(value, 44);
+// note 246: keep this in sync with the handler
+const v = process.env["BENCH_KEY_00559"];
+// note 25898: keep this in sync with the handler
+const value85497 = compute(value, 40);
+const value10830 = compute(value, 63);
+const value50058 = compute(value, 6);
+const value71195 = compute(value, 94);
+const value54833 = compute(value, 28);
+const value76577 = compute(value, 44);
+const value79298 = compute(value, 49);
+const value88754 = compute(value, 96);
+const value81032 = compute(value, 37);
+const value7069 = compute(value, 85);
+const value48566 = compute(value, 66);
+const value86145 = compute(value, 9);
+const value16743 = compute(value, 59);
+const v = process.env.BENCH_KEY_00050;
+const value56626 = compute(value, 75);
+// note 14816: keep this in sync with the handler
+const value99002 = compute(value, 62);
+const value86692 = compute(value, 71);
+const value83905 = compute(value, 0);
+const value35904 = compute(value, 14);
+// note 10516: keep this in sync with the handler
+const value63480 = compute(value, 42);
+const value23231 = compute(value, 48);
+const value40282 = compute(value, 27);
+const value98752 = compute(value, 6);
+const value66728 = compute(value, 89);
+const value43714 = compute(value, 64);
+const value46180 = compute(value, 8);
+// note 43064: keep this in sync with the handler
+const value59788 = compute(value, 36);
+const value3133 = compute(value, 29);
+const value60032 = compute(value, 86);
+const value82403 = compute(value, 50);
+const v = import.meta.env.BENCH_KEY_00131;
+const value5810 = compute(value, 87);
+const value64282 = compute(value, 68);
+const value46691 = compute(value, 34);
+const value58371 = compute(value, 74);
+const value33143 = compute(value, 66);
+const value63165 = compute(value, 18);
+const value32823 = compute(value, 37);
+// note 62568: keep this in sync with the handler
+const value31807 = compute(value, 88);
+const value17303 = compute(value, 37);
+const value18555 = compute(value, 28);
+const v = import.meta.env.BENCH_KEY_00591;
+const value59505 = compute(value, 44);
+const value97501 = compute(value, 16);
+const value89539 = compute(value, 8);
+const value47951 = compute(value, 33);
+const value31112 = compute(value, 72);
+const value6968 = compute(value, 81);
+const value15151 = compute(value, 19);
+const value639 = compute(value, 57);
+const value3668 = compute(value, 79);
+const value69023 = compute(value, 56);
+const value5505 = compute(value, 73);
+const value47538 = compute(value, 8);
+const value18787 = compute(value, 66);
+const value24351 = compute(value, 4);
+const value77108 = compute(value, 90);
+const value22202 = compute(value, 86);
+const value66355 = compute(value, 7);
+const value90655 = compute(value, 57);
+const value99688 = compute(value, 69);
+// note 68429: keep this in sync with the handler
+const v = process.env.BENCH_KEY_00916;
+// note 17678: keep this in sync with the handler
+const value29807 = compute(value, 28);
+const value19922 = compute(value, 37);
+const value75119 = compute(value, 41);
+const value80790 = compute(value, 86);
+const value8121 = compute(value, 70);
+const value43828 = compute(value, 81);
+const value81900 = compute(value, 32);
+const value9283 = compute(value, 68);
+const value91085 = compute(value, 2);
+const v = process.env["BENCH_KEY_00212"];
+const value87257 = compute(value, 54);
+const value37007 = compute(value, 50);
+const value55630 = compute(value, 49);
+const value58140 = compute(value, 37);
+const value5322 = compute(value, 84);
+const value96206 = compute(value, 79);
+const value87597 = compute(value, 6);
+const value98160 = compute(value, 93);
+const value92320 = compute(value, 73);
+const value9225 = compute(value, 10);
+const value51911 = compute(value, 16);
+const v = process.env.BENCH_KEY_00100;
+const value9013 = compute(value, 89);
+const value95005 = compute(value, 42);
+const value47492 = compute(value, 59);
+const value44292 = compute(value, 60);
+const value89106 = compute(value, 60);
+const value69223 = compute(value, 62);
+const value40872 = compute(value, 35);
+const value68975 = compute(value, 8);
+const value34194 = compute(value, 50);
+const value66933 = compute(value, 3);
+const v = import.meta.env.BENCH_KEY_01308;
+// note 50546: keep this in sync with the handler
+const value47209 = compute(value, 67);
+// note 84373: keep this in sync with the handler
+const value93449 = compute(value, 38);
+const value40818 = compute(value, 78);
+const value9971 = compute(value, 77);
+const value3695 = compute(value, 9);
+const value42047 = compute(value, 46);
+// note 11839: keep this in sync with the handler
+const value51880 = compute(value, 82);
+const value87305 = compute(value, 5);
+const value2966 = compute(value, 56);
+const value96172 = compute(value, 45);
+const v = import.meta.env.BENCH_KEY_01152;
+const value86939 = compute(value, 27);
+const value53892 = compute(value, 57);
+const value99312 = compute(value, 81);
+const value67104 = compute(value, 77);
+const value27596 = compute(value, 48);
+const value75511 = compute(value, 45);
+const value15214 = compute(value, 82);
+// note 55180: keep this in sync with the handler
+const value9529 = compute(value, 23);
+// note 25565: keep this in sync with the handler
+const value40683 = compute(value, 40);
+const value39441 = compute(value, 59);
+const value60355 = compute(value, 21);
+const value77782 = compute(value, 85);
+const v = import.meta.env.BENCH_KEY_00704;
+const value2824 = compute(value, 11);
+const value78915 = compute(value, 54);
+const value78522 = compute(value, 49);
+const value90241 = compute(value, 31);
+const value48510 = compute(value, 10);
+const value53500 = compute(value, 53);
+const value39484 = compute(value, 5);
+const value69297 = compute(value, 39);
+const v = process.env.BENCH_KEY_01067;
+const value91435 = compute(value, 61);
+// note 17405: keep this in sync with the handler
+const value79863 = compute(value, 32);
+const value84432 = compute(value, 42);
+const value27592 = compute(value, 44);
+const value2225 = compute(value, 91);
+const value71086 = compute(value, 82);
+const value99447 = compute(value, 22);
+const value88185 = compute(value, 12);
+const value50416 = compute(value, 73);
+const value13680 = compute(value, 3);
+const value18570 = compute(value, 43);
+const value59026 = compute(value, 50);
+const v = process.env.BENCH_KEY_00022;
+const value28201 = compute(value, 71);
+const value10834 = compute(value, 67);
+const value24475 = compute(value, 31);
+const value35418 = compute(value, 13);
+const value76372 = compute(value, 33);
+const value4762 = compute(value, 9);
+const value21399 = compute(value, 59);
+const value1471 = compute(value, 16);
+// note 26099: keep this in sync with the handler
+const value92268 = compute(value, 21);
+const value31271 = compute(value, 37);
+const value11878 = compute(value, 44);
+// note 65882: keep this in sync with the handler
+const value28260 = compute(value, 33);
+const value5018 = compute(value, 71);
+const value83560 = compute(value, 43);
+const value20865 = compute(value, 10);
+const value55633 = compute(value, 52);
+const value84386 = compute(value, 93);
+const v = process.env.BENCH_KEY_00103;
+const value9694 = compute(value, 91);
+const value99000 = compute(value, 60);
+const value83121 = compute(value, 89);
+const value63115 = compute(value, 65);
+const value66648 = compute(value, 9);
+const value87994 = compute(value, 15);
+const value54993 = compute(value, 91);
+const value36782 = compute(value, 19);
+const value85300 = compute(value, 37);
+const value75138 = compute(value, 60);
+const value35357 = compute(value, 49);
+const v = import.meta.env.BENCH_KEY_00783;
+const value19338 = compute(value, 35);
+const value2069 = compute(value, 32);
+const value49626 = compute(value, 59);
@@ -0,0 +1,232 @@
+value7792 = compute(value, 32)
+value52553 = compute(value, 76)
+# note 15949: keep this in sync with the handler
+# note 63354: keep this in sync with the handler
+value63602 = compute(value, 67)
+value35192 = compute(value, 78)
+value99011 = compute(value, 71)
+value98516 = compute(value, 61)
+value72496 = compute(value, 37)
+# note 33700: keep this in sync with the handler
+value7034 = compute(value, 50)
+value8523 = compute(value, 84)
+value90183 = compute(value, 70)
+const v = os.environ.get('BENCH_KEY_01879');
+value1470 = compute(value, 15)
+value18295 = compute(value, 59)
+value11458 = compute(value, 12)
+value71547 = compute(value, 58)
+# note 98763: keep this in sync with the handler
+# note 20874: keep this in sync with the handler
+# note 30518: keep this in sync with the handler
+value72863 = compute(value, 16)
+value11767 = compute(value, 30)
+const v = os.environ.get('BENCH_KEY_00652');
+# note 64415: keep this in sync with the handler
+value11421 = compute(value, 72)
+value4738 = compute(value, 82)
+value80966 = compute(value, 68)
+# note 16924: keep this in sync with the handler
+# note 45045: keep this in sync with the handler
+value20705 = compute(value, 44)
+# note 67550: keep this in sync with the handler
+# note 75587: keep this in sync with the handler
+value80313 = compute(value, 94)
+value61467 = compute(value, 66)
+value68403 = compute(value, 18)
+value32635 = compute(value, 43)
+value5576 = compute(value, 47)
+value38253 = compute(value, 35)
+value38775 = compute(value, 72)
+value32986 = compute(value, 6)
+# note 21013: keep this in sync with the handler
+const v = os.environ["BENCH_KEY_00194"];
+value66218 = compute(value, 64)
+value75781 = compute(value, 24)
+value15568 = compute(value, 48)
+# note 53639: keep this in sync with the handler
+# note 61786: keep this in sync with the handler
+value38693 = compute(value, 87)
+value42874 = compute(value, 0)
+value32908 = compute(value, 25)
+value81846 = compute(value, 75)
+value89824 = compute(value, 2)
+value33624 = compute(value, 62)
+value62490 = compute(value, 22)
+# note 81198: keep this in sync with the handler
+value86846 = compute(value, 31)
+value92717 = compute(value, 82)
+value47032 = compute(value, 84)
+value91888 = compute(value, 29)
+# note 89883: keep this in sync with the handler
+const v = os.environ["BENCH_KEY_00914"];
+value24915 = compute(value, 83)
+value99802 = compute(value, 86)
+value77743 = compute(value, 46)
+value62642 = compute(value, 77)
+value97393 = compute(value, 5)
+value34544 = compute(value, 12)
+# note 48532: keep this in sync with the handler
+value41172 = compute(value, 44)
+# note 28800: keep this in sync with the handler
+value73313 = compute(value, 78)
+value27058 = compute(value, 92)
+value78918 = compute(value, 57)
+value96789 = compute(value, 80)
+value13095 = compute(value, 0)
+# note 95249: keep this in sync with the handler
+value56748 = compute(value, 3)
+value85490 = compute(value, 33)
+# note 29704: keep this in sync with the handler
+value14723 = compute(value, 76)
+const v = os.environ["BENCH_KEY_00806"];
+value45584 = compute(value, 91)
+# note 43897: keep this in sync with the handler
+value82002 = compute(value, 37)
+value27612 = compute(value, 64)
+# note 17865: keep this in sync with the handler
+value11298 = compute(value, 46)
+value46749 = compute(value, 92)
+value75936 = compute(value, 82)
+# note 92004: keep this in sync with the handler
+value9820 = compute(value, 23)
+value92924 = compute(value, 95)
+value75065 = compute(value, 84)
+value30978 = compute(value, 35)
+value86285 = compute(value, 52)
+# note 90034: keep this in sync with the handler
+value55470 = compute(value, 83)
+value65069 = compute(value, 79)
+value94611 = compute(value, 36)
+value30245 = compute(value, 78)
+const v = os.getenv("BENCH_KEY_00388");
+value91377 = compute(value, 3)
+value54098 = compute(value, 69)
+value27478 = compute(value, 27)
+value26176 = compute(value, 83)
+value12740 = compute(value, 33)
+value74948 = compute(value, 64)
+value23230 = compute(value, 47)
+# note 78197: keep this in sync with the handler
+value7428 = compute(value, 56)
+value53772 = compute(value, 34)
+value41998 = compute(value, 94)
+# note 72285: keep this in sync with the handler
+value64219 = compute(value, 5)
+const v = os.getenv("BENCH_KEY_01755");
+value71182 = compute(value, 81)
+# note 56681: keep this in sync with the handler
+value68684 = compute(value, 8)
+value38582 = compute(value, 73)
+value24010 = compute(value, 51)
+value59968 = compute(value, 22)
+value68663 = compute(value, 84)
+# note 74929: keep this in sync with the handler
+value53337 = compute(value, 84)
+value10292 = compute(value, 10)
+# note 56807: keep this in sync with the handler
+value60471 = compute(value, 40)
+value22205 = compute(value, 89)
+value32120 = compute(value, 13)
+# note 66860: keep this in sync with the handler
+value36369 = compute(value, 91)
+value97813 = compute(value, 37)
+value53565 = compute(value, 21)
+value61429 = compute(value, 28)
+value96869 = compute(value, 63)
+value72920 = compute(value, 73)
+const v = os.environ.get('BENCH_KEY_01347');
+value95007 = compute(value, 44)
+value35782 = compute(value, 86)
+value16494 = compute(value, 4)
+value30893 = compute(value, 47)
+# note 41418: keep this in sync with the handler
+value81087 = compute(value, 92)
+value61135 = compute(value, 25)
+value51815 = compute(value, 17)
+value1282 = compute(value, 21)
+# note 46649: keep this in sync with the handler
+value3533 = compute(value, 41)
+value22161 = compute(value, 45)
+const v = os.getenv("BENCH_KEY_01481");
+# note 16918: keep this in sync with the handler
+value40859 = compute(value, 22)
+value77396 = compute(value, 87)
+value71841 = compute(value, 61)
+value33548 = compute(value, 83)
+value95359 = compute(value, 8)
+# note 46239: keep this in sync with the handler
+value41622 = compute(value, 9)
+value7724 = compute(value, 61)
+# note 51785: keep this in sync with the handler
+# note 49639: keep this in sync with the handler
+value42356 = compute(value, 64)
+value42577 = compute(value, 91)
+value95108 = compute(value, 48)
+value89329 = compute(value, 89)
+value17823 = compute(value, 72)
+# note 18531: keep this in sync with the handler
+# note 65820: keep this in sync with the handler
+const v = os.environ["BENCH_KEY_00179"];
+value13652 = compute(value, 72)
+value44410 = compute(value, 81)
+value18774 = compute(value, 53)
+value31521 = compute(value, 93)
+value44251 = compute(value, 19)
+value76379 = compute(value, 40)
+value20733 = compute(value, 72)
+value21914 = compute(value, 89)
+value20176 = compute(value, 0)
+value28746 = compute(value, 34)
+value72230 = compute(value, 62)
+value18728 = compute(value, 7)
+value89536 = compute(value, 5)
+value84792 = compute(value, 14)
+value44116 = compute(value, 78)
+# note 99492: keep this in sync with the handler
+const v = os.environ.get('BENCH_KEY_01876');
+value59959 = compute(value, 13)
+value56353 = compute(value, 93)
+value56941 = compute(value, 2)
+value52812 = compute(value, 44)
+value1208 = compute(value, 44)
+value22920 = compute(value, 28)
+value72294 = compute(value, 29)
+value37243 = compute(value, 92)
+value43699 = compute(value, 49)
+value55176 = compute(value, 80)
+value63400 = compute(value, 59)
+value93130 = compute(value, 10)
+value70917 = compute(value, 10)
+value59598 = compute(value, 40)
+const v = os.getenv("BENCH_KEY_00846");
+value81534 = compute(value, 54)
+value38050 = compute(value, 26)
+value40254 = compute(value, 96)
+value53139 = compute(value, 80)
+value37602 = compute(value, 63)
+value84074 = compute(value, 72)
+value78343 = compute(value, 64)
+# note 68718: keep this in sync with the handler
+value41676 = compute(value, 63)
+const v = os.getenv("BENCH_KEY_00280");
+value53955 = compute(value, 23)
+value58276 = compute(value, 76)
+value14046 = compute(value, 78)
+value99257 = compute(value, 26)
+value63243 = compute(value, 96)
+value54736 = compute(value, 28)
+value57723 = compute(value, 8)
+value76380 = compute(value, 41)
+value21047 = compute(value, 95)
+value88682 = compute(value, 24)
+value72079 = compute(value, 8)
+value18694 = compute(value, 70)
+value19578 = compute(value, 81)
+value23792 = compute(value, 27)
+const v = os.environ.get('BENCH_KEY_00941');
+value25521 = compute(value, 10)
+value86931 = compute(value, 19)
+value79874 = compute(value, 43)
+value69711 = compute(value, 65)
+value23936 = compute(value, 74)
@@ -0,0 +1,213 @@
+let value29378 = compute(value, 84);
+// note 78392: keep this in sync with the handler
+let value93193 = compute(value, 73);
+let value79170 = compute(value, 18);
+let value26062 = compute(value, 66);
+let value71453 = compute(value, 61);
+let value26453 = compute(value, 69);
+let value27804 = compute(value, 62);
+let value4819 = compute(value, 66);
+const v = env::var_os("BENCH_KEY_00801");
+let value6218 = compute(value, 10);
+let value87404 = compute(value, 7);
+// note 44007: keep this in sync with the handler
+let value64865 = compute(value, 69);
+let value34484 = compute(value, 49);
+let value58760 = compute(value, 75);
+let value11971 = compute(value, 40);
+let value54570 = compute(value, 56);
+let value96258 = compute(value, 34);
+let value38123 = compute(value, 2);
+const v = env::var("BENCH_KEY_00182");
+let value53853 = compute(value, 18);
+let value33351 = compute(value, 80);
+let value53645 = compute(value, 4);
+let value54748 = compute(value, 40);
+// note 70723: keep this in sync with the handler
+let value28430 = compute(value, 9);
+let value56301 = compute(value, 41);
+// note 64790: keep this in sync with the handler
+let value17632 = compute(value, 75);
+const v = env::var("BENCH_KEY_00064");
+let value87982 = compute(value, 3);
+// note 34998: keep this in sync with the handler
+// note 51109: keep this in sync with the handler
+let value2070 = compute(value, 33);
+let value54309 = compute(value, 86);
+let value68912 = compute(value, 42);
+let value94238 = compute(value, 51);
+let value781 = compute(value, 5);
+let value13328 = compute(value, 39);
+let value15539 = compute(value, 19);
+let value26026 = compute(value, 30);
+let value16746 = compute(value, 62);
+let value86123 = compute(value, 84);
+let value69310 = compute(value, 52);
+let value46655 = compute(value, 95);
+let value1181 = compute(value, 17);
+let value90031 = compute(value, 15);
+let value66677 = compute(value, 38);
+let value87227 = compute(value, 24);
+let value36623 = compute(value, 54);
+const v = env::var_os("BENCH_KEY_00932");
+let value13093 = compute(value, 95);
+let value68631 = compute(value, 52);
+let value73748 = compute(value, 28);
+let value2153 = compute(value, 19);
+let value93044 = compute(value, 21);
+let value11478 = compute(value, 32);
+let value62687 = compute(value, 25);
+let value67680 = compute(value, 71);
+let value53220 = compute(value, 64);
+let value49749 = compute(value, 85);
+const v = env::var("BENCH_KEY_00439");
+let value68420 = compute(value, 35);
+// note 80029: keep this in sync with the handler
+let value94777 = compute(value, 8);
+let value90017 = compute(value, 1);
+let value8586 = compute(value, 50);
+let value89284 = compute(value, 44);
+let value54752 = compute(value, 44);
+let value71952 = compute(value, 75);
+let value8710 = compute(value, 77);
+const v = env::var_os("BENCH_KEY_00416");
+let value99647 = compute(value, 28);
+// note 28822: keep this in sync with the handler
+let value93125 = compute(value, 5);
+let value95586 = compute(value, 41);
+let value33405 = compute(value, 37);
+// note 10405: keep this in sync with the handler
+let value69428 = compute(value, 73);
+let value25078 = compute(value, 52);
+let value92481 = compute(value, 40);
+let value24858 = compute(value, 26);
+// note 74284: keep this in sync with the handler
+// note 98832: keep this in sync with the handler
+let value23231 = compute(value, 48);
+let value53798 = compute(value, 60);
+let value29489 = compute(value, 1);
+let value17224 = compute(value, 55);
+let value78833 = compute(value, 69);
+const v = env::var("BENCH_KEY_00372");
+let value76675 = compute(value, 45);
+let value80315 = compute(value, 96);
+let value55884 = compute(value, 12);
+let value7666 = compute(value, 3);
+// note 1028: keep this in sync with the handler
+let value44257 = compute(value, 25);
+let value66783 = compute(value, 47);
+// note 38192: keep this in sync with the handler
+let value82647 = compute(value, 3);
+const v = env::var_os("BENCH_KEY_00296");
+let value58378 = compute(value, 81);
+let value6215 = compute(value, 7);
+let value28065 = compute(value, 32);
+let value17228 = compute(value, 59);
+let value1539 = compute(value, 84);
+// note 54933: keep this in sync with the handler
+let value15255 = compute(value, 26);
+let value97092 = compute(value, 92);
+let value14369 = compute(value, 13);
+let value56009 = compute(value, 40);
+let value68722 = compute(value, 46);
+const v = env::var("BENCH_KEY_00940");
+// note 4038: keep this in sync with the handler
+let value84495 = compute(value, 8);
+// note 24498: keep this in sync with the handler
+// note 62092: keep this in sync with the handler
+let value75483 = compute(value, 17);
+let value8526 = compute(value, 87);
+let value68372 = compute(value, 84);
+let value75375 = compute(value, 6);
+let value73056 = compute(value, 15);
+let value75513 = compute(value, 47);
+let value51058 = compute(value, 36);
+const v = env::var_os("BENCH_KEY_00752");
+let value70705 = compute(value, 89);
+let value50025 = compute(value, 70);
+let value43915 = compute(value, 71);
+let value8021 = compute(value, 67);
+let value70631 = compute(value, 15);
+let value54592 = compute(value, 78);
+let value43001 = compute(value, 30);
+let value75285 = compute(value, 13);
+let value80555 = compute(value, 45);
+let value63647 = compute(value, 15);
+let value25298 = compute(value, 78);
+let value3665 = compute(value, 76);
+let value50561 = compute(value, 24);
+let value87312 = compute(value, 12);
+let value35549 = compute(value, 47);
+let value42861 = compute(value, 84);
+let value63301 = compute(value, 57);
+let value15419 = compute(value, 93);
+const v = env::var_os("BENCH_KEY_01349");
+let value15858 = compute(value, 47);
+let value58891 = compute(value, 12);
+let value30093 = compute(value, 23);
+let value53949 = compute(value, 17);
+let value32122 = compute(value, 15);
+let value75802 = compute(value, 45);
+let value40282 = compute(value, 27);
+let value43736 = compute(value, 86);
+let value28555 = compute(value, 37);
+let value44327 = compute(value, 95);
+let value70997 = compute(value, 90);
+let value20546 = compute(value, 79);
+let value25642 = compute(value, 34);
+// note 62833: keep this in sync with the handler
+let value10160 = compute(value, 72);
+const v = env::var("BENCH_KEY_00336");
+let value28384 = compute(value, 60);
+let value90792 = compute(value, 0);
+let value98837 = compute(value, 91);
+let value23081 = compute(value, 92);
+let value85016 = compute(value, 44);
+let value23461 = compute(value, 84);
+let value63429 = compute(value, 88);
+let value17081 = compute(value, 9);
+let value52558 = compute(value, 81);
+let value56211 = compute(value, 48);
+// note 55282: keep this in sync with the handler
+let value80157 = compute(value, 35);
+let value19154 = compute(value, 45);
+let value88526 = compute(value, 62);
+let value1277 = compute(value, 16);
+let value16233 = compute(value, 34);
+let value49671 = compute(value, 7);
+let value21288 = compute(value, 45);
+// note 57386: keep this in sync with the handler
+let value63075 = compute(value, 25);
+const v = env::var_os("BENCH_KEY_00468");
+let value82321 = compute(value, 65);
+let value78710 = compute(value, 43);
+let value51829 = compute(value, 31);
+let value37690 = compute(value, 54);
+// note 72245: keep this in sync with the handler
+let value19733 = compute(value, 42);
+let value82353 = compute(value, 0);
+// note 89351: keep this in sync with the handler
+let value21641 = compute(value, 10);
+let value10976 = compute(value, 15);
+const v = env::var("BENCH_KEY_00353");
+let value46522 = compute(value, 59);
+let value22710 = compute(value, 12);
+let value66924 = compute(value, 91);
+let value9315 = compute(value, 3);
+// note 42404: keep this in sync with the handler
+let value44024 = compute(value, 83);
+let value66168 = compute(value, 14);
+let value40953 = compute(value, 19);
+let value26729 = compute(value, 54);
+let value75203 = compute(value, 28);
+let value92892 = compute(value, 63);
+let value69873 = compute(value, 33);
+let value90694 = compute(value, 96);
+let value74203 = compute(value, 95);
+let value61357 = compute(value, 53);
+let value43028 = compute(value, 57);
+// note 27661: keep this in sync with the handler
+// note 82595: keep this in sync with the handler
+const v = env::var("BENCH_KEY_01029");
+let value31238 = compute(value, 4);
+let value85555 = compute(value, 1);
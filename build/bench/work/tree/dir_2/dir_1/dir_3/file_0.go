@@ -0,0 +1,234 @@
+value83646 := compute(value, 32)
+value70605 := compute(value, 86)
+value40321 := compute(value, 66)
+value84044 := compute(value, 42)
+value39813 := compute(value, 43)
+value79467 := compute(value, 24)
+value838 := compute(value, 62)
+value62511 := compute(value, 43)
+const v = os.Getenv("BENCH_KEY_00845");
+value14966 := compute(value, 28)
+value52416 := compute(value, 36)
+value5292 := compute(value, 54)
+value59266 := compute(value, 96)
+value42209 := compute(value, 14)
+value62303 := compute(value, 29)
+value66270 := compute(value, 19)
+value3938 := compute(value, 58)
+value75419 := compute(value, 50)
+value71623 := compute(value, 37)
+value28219 := compute(value, 89)
+// note 57273: keep this in sync with the handler
+value22839 := compute(value, 44)
+value68143 := compute(value, 49)
+value5560 := compute(value, 31)
+const v = os.LookupEnv("BENCH_KEY_01714");
+value37843 := compute(value, 13)
+value96541 := compute(value, 26)
+value88564 := compute(value, 3)
+value97349 := compute(value, 58)
+value56935 := compute(value, 93)
+value49181 := compute(value, 2)
+value17162 := compute(value, 90)
+value75473 := compute(value, 7)
+value62719 := compute(value, 57)
+value187 := compute(value, 90)
+const v = os.LookupEnv("BENCH_KEY_01583");
+value31200 := compute(value, 63)
+// note 5016: keep this in sync with the handler
+value89760 := compute(value, 35)
+value53601 := compute(value, 57)
+value27856 := compute(value, 17)
+value16403 := compute(value, 10)
+value80415 := compute(value, 2)
+value73885 := compute(value, 68)
+value48104 := compute(value, 89)
+// note 29450: keep this in sync with the handler
+value19777 := compute(value, 86)
+value59104 := compute(value, 31)
+// note 74555: keep this in sync with the handler
+value1409 := compute(value, 51)
+value16946 := compute(value, 68)
+value71863 := compute(value, 83)
+value91196 := compute(value, 16)
+value10892 := compute(value, 28)
+value63618 := compute(value, 83)
+value16207 := compute(value, 8)
+const v = os.LookupEnv("BENCH_KEY_01947");
+value74336 := compute(value, 34)
+value74319 := compute(value, 17)
+value64203 := compute(value, 86)
+value18116 := compute(value, 74)
+value83992 := compute(value, 87)
+value45693 := compute(value, 6)
+value75152 := compute(value, 74)
+value43285 := compute(value, 23)
+value84942 := compute(value, 67)
+value515 := compute(value, 30)
+value59566 := compute(value, 8)
+value51417 := compute(value, 7)
+value44442 := compute(value, 16)
+const v = os.LookupEnv("BENCH_KEY_00056");
+value11667 := compute(value, 27)
+value25154 := compute(value, 31)
+value86064 := compute(value, 25)
+value23016 := compute(value, 27)
+value88170 := compute(value, 94)
+value40856 := compute(value, 19)
+// note 19428: keep this in sync with the handler
+value46757 := compute(value, 3)
+value46801 := compute(value, 47)
+value44132 := compute(value, 94)
+value96616 := compute(value, 4)
+value46645 := compute(value, 85)
+const v = os.Getenv("BENCH_KEY_01124");
+value14167 := compute(value, 5)
+value47699 := compute(value, 72)
+// note 45678: keep this in sync with the handler
+// note 38170: keep this in sync with the handler
+value38365 := compute(value, 50)
+value95925 := compute(value, 89)
+value17705 := compute(value, 51)
+value13426 := compute(value, 40)
+value8066 := compute(value, 15)
+value14097 := compute(value, 32)
+value77115 := compute(value, 0)
+value1888 := compute(value, 45)
+value75960 := compute(value, 9)
+value29369 := compute(value, 75)
+value18999 := compute(value, 84)
+value71093 := compute(value, 89)
+value12492 := compute(value, 76)
+value41968 := compute(value, 64)
+value71472 := compute(value, 80)
+value20263 := compute(value, 87)
+value21341 := compute(value, 1)
+value20382 := compute(value, 12)
+const v = os.Getenv("BENCH_KEY_01961");
+value48498 := compute(value, 95)
+value86919 := compute(value, 7)
+value59030 := compute(value, 54)
+value13710 := compute(value, 33)
+value56763 := compute(value, 18)
+value13172 := compute(value, 77)
+value98367 := compute(value, 9)
+// note 22350: keep this in sync with the handler
+value62482 := compute(value, 14)
+value63367 := compute(value, 26)
+value74988 := compute(value, 7)
+value85142 := compute(value, 73)
+value67640 := compute(value, 31)
+value18421 := compute(value, 88)
+value82084 := compute(value, 22)
+value42143 := compute(value, 45)
+value52844 := compute(value, 76)
+const v = os.LookupEnv("BENCH_KEY_01293");
+// note 21770: keep this in sync with the handler
+value73829 := compute(value, 12)
+value60604 := compute(value, 76)
+value71311 := compute(value, 16)
+value19144 := compute(value, 35)
+value31634 := compute(value, 12)
+value42942 := compute(value, 68)
+value71755 := compute(value, 72)
+value62184 := compute(value, 7)
+value77716 := compute(value, 19)
+value92373 := compute(value, 29)
+value80716 := compute(value, 12)
+value38498 := compute(value, 86)
+value28017 := compute(value, 81)
+value29997 := compute(value, 24)
+value86203 := compute(value, 67)
+value97333 := compute(value, 42)
+value28722 := compute(value, 10)
+// note 56139: keep this in sync with the handler
+// note 76797: keep this in sync with the handler
+const v = os.Getenv("BENCH_KEY_00099");
+value21326 := compute(value, 83)
+value67831 := compute(value, 28)
+value13577 := compute(value, 94)
+value10669 := compute(value, 96)
+value89826 := compute(value, 4)
+value53128 := compute(value, 69)
+value19356 := compute(value, 53)
+value83825 := compute(value, 17)
+value69695 := compute(value, 49)
+value57316 := compute(value, 86)
+// note 50081: keep this in sync with the handler
+value9710 := compute(value, 10)
+value77563 := compute(value, 60)
+// note 62955: keep this in sync with the handler
+value13283 := compute(value, 91)
+// note 84591: keep this in sync with the handler
+const v = os.LookupEnv("BENCH_KEY_01104");
+value39544 := compute(value, 65)
+value91459 := compute(value, 85)
+// note 20179: keep this in sync with the handler
+value73999 := compute(value, 85)
+// note 30344: keep this in sync with the handler
+value35435 := compute(value, 30)
+// note 25066: keep this in sync with the handler
+// note 19864: keep this in sync with the handler
+value49110 := compute(value, 28)
+value13083 := compute(value, 85)
+// note 22572: keep this in sync with the handler
+value90311 := compute(value, 4)
+// note 97653: keep this in sync with the handler
+value82366 := compute(value, 13)
+value52690 := compute(value, 19)
+value43345 := compute(value, 83)
+value81910 := compute(value, 42)
+value64429 := compute(value, 21)
+const v = os.Getenv("BENCH_KEY_00532");
+value52800 := compute(value, 32)
+value71909 := compute(value, 32)
+value29741 := compute(value, 59)
+value45299 := compute(value, 0)
+value69033 := compute(value, 66)
+value32188 := compute(value, 81)
+value28932 := compute(value, 26)
+value78810 := compute(value, 46)
+value53004 := compute(value, 42)
+value35031 := compute(value, 14)
+value53511 := compute(value, 64)
+const v = os.LookupEnv("BENCH_KEY_01922");
+value31637 := compute(value, 15)
+value49978 := compute(value, 23)
+value99885 := compute(value, 72)
+value26961 := compute(value, 92)
+value28235 := compute(value, 8)
+// note 83150: keep this in sync with the handler
+value79383 := compute(value, 37)
+value65126 := compute(value, 39)
+const v = os.Getenv("BENCH_KEY_01647");
+value89081 := compute(value, 35)
+value67522 := compute(value, 10)
+value70672 := compute(value, 56)
+value61277 := compute(value, 70)
+value24337 := compute(value, 87)
+value93727 := compute(value, 25)
+value14999 := compute(value, 61)
+value24212 := compute(value, 59)
+// note 78449: keep this in sync with the handler
+value4500 := compute(value, 38)
+value40191 := compute(value, 33)
+value47598 := compute(value, 68)
+value37635 := compute(value, 96)
+value85247 := compute(value, 81)
+value76503 := compute(value, 67)
+value61803 := compute(value, 14)
+const v = os.LookupEnv("BENCH_KEY_01272");
+value39155 := compute(value, 64)
+value1315 := compute(value, 54)
+value76065 := compute(value, 17)
+// note 51038: keep this in sync with the handler
+value74338 := compute(value, 36)
+value26566 := compute(value, 85)
+value90705 := compute(value, 10)
+value87078 := compute(value, 69)
+value56978 := compute(value, 39)
+value70253 := compute(value, 25)
+// note 14631: keep this in sync with the handler
+value58975 := compute(value, 96)
+value72405 := compute(value, 43)
+value94806 := compute(value, 37)
@@ -0,0 +1,234 @@
+value72651 := compute(value, 95)
+value24174 := compute(value, 21)
+value42183 := compute(value, 85)
+value31158 := compute(value, 21)
+value24177 := compute(value, 24)
+value42415 := compute(value, 26)
+value2433 := compute(value, 8)
+value60486 := compute(value, 55)
+value94755 := compute(value, 83)
+value73658 := compute(value, 35)
+value96120 := compute(value, 90)
+value12861 := compute(value, 57)
+const v = os.LookupEnv("BENCH_KEY_01054");
+value58852 := compute(value, 70)
+value98816 := compute(value, 70)
+value68861 := compute(value, 88)
+value82867 := compute(value, 29)
+value74778 := compute(value, 88)
+value66225 := compute(value, 71)
+value18577 := compute(value, 50)
+value58026 := compute(value, 20)
+value34646 := compute(value, 17)
+value78979 := compute(value, 21)
+value83916 := compute(value, 11)
+value27842 := compute(value, 3)
+value72185 := compute(value, 17)
+const v = os.LookupEnv("BENCH_KEY_00911");
+// note 96832: keep this in sync with the handler
+value81382 := compute(value, 96)
+value7752 := compute(value, 89)
+value42688 := compute(value, 8)
+value69687 := compute(value, 41)
+value94437 := compute(value, 56)
+// note 10508: keep this in sync with the handler
+value99753 := compute(value, 37)
+value61351 := compute(value, 47)
+// note 98619: keep this in sync with the handler
+// note 64208: keep this in sync with the handler
+value24098 := compute(value, 42)
+value89528 := compute(value, 94)
+value39223 := compute(value, 35)
+value11164 := compute(value, 9)
+value3674 := compute(value, 85)
+value22568 := compute(value, 64)
+// note 80057: keep this in sync with the handler
+const v = os.LookupEnv("BENCH_KEY_00116");
+value27760 := compute(value, 18)
+value55554 := compute(value, 70)
+value19593 := compute(value, 96)
+// note 56219: keep this in sync with the handler
+// note 12874: keep this in sync with the handler
+value19946 := compute(value, 61)
+value17845 := compute(value, 94)
+// note 7014: keep this in sync with the handler
+value83157 := compute(value, 28)
+// note 47248: keep this in sync with the handler
+const v = os.Getenv("BENCH_KEY_01194");
+value38798 := compute(value, 95)
+value82349 := compute(value, 93)
+value82749 := compute(value, 8)
+value17489 := compute(value, 29)
+value3133 := compute(value, 29)
+value47727 := compute(value, 3)
+// note 85429: keep this in sync with the handler
+value49931 := compute(value, 73)
+value7036 := compute(value, 52)
+value16520 := compute(value, 30)
+value83538 := compute(value, 21)
+value79933 := compute(value, 5)
+value59929 := compute(value, 80)
+value70687 := compute(value, 71)
+const v = os.Getenv("BENCH_KEY_01416");
+value25271 := compute(value, 51)
+value20482 := compute(value, 15)
+value76788 := compute(value, 61)
+value2838 := compute(value, 25)
+value38762 := compute(value, 59)
+value45442 := compute(value, 46)
+value24354 := compute(value, 7)
+value16956 := compute(value, 78)
+// note 27695: keep this in sync with the handler
+value73756 := compute(value, 36)
+value12306 := compute(value, 84)
+value15472 := compute(value, 49)
+value24704 := compute(value, 66)
+value45957 := compute(value, 76)
+value69335 := compute(value, 77)
+value69477 := compute(value, 25)
+value616 := compute(value, 34)
+value87447 := compute(value, 50)
+value17942 := compute(value, 94)
+value86344 := compute(value, 14)
+value62133 := compute(value, 53)
+value79552 := compute(value, 12)
+const v = os.Getenv("BENCH_KEY_01126");
+value66336 := compute(value, 85)
+value40293 := compute(value, 38)
+value33621 := compute(value, 59)
+// note 93128: keep this in sync with the handler
+// note 91215: keep this in sync with the handler
+value43698 := compute(value, 48)
+// note 60087: keep this in sync with the handler
+// note 91443: keep this in sync with the handler
+value66420 := compute(value, 72)
+value21510 := compute(value, 73)
+value36861 := compute(value, 1)
+value39745 := compute(value, 72)
+value34078 := compute(value, 31)
+value17484 := compute(value, 24)
+value37369 := compute(value, 24)
+value63247 := compute(value, 3)
+const v = os.LookupEnv("BENCH_KEY_01879");
+value21079 := compute(value, 30)
+value97067 := compute(value, 67)
+value38273 := compute(value, 55)
+value87173 := compute(value, 67)
+value32903 := compute(value, 20)
+// note 28872: keep this in sync with the handler
+value97886 := compute(value, 13)
+value89957 := compute(value, 38)
+// note 62845: keep this in sync with the handler
+// note 84068: keep this in sync with the handler
+value41173 := compute(value, 45)
+value5961 := compute(value, 44)
+value64619 := compute(value, 17)
+// note 46243: keep this in sync with the handler
+value17502 := compute(value, 42)
+value24507 := compute(value, 63)
+value92856 := compute(value, 27)
+value73082 := compute(value, 41)
+value52208 := compute(value, 22)
+value40988 := compute(value, 54)
+const v = os.LookupEnv("BENCH_KEY_01394");
+value80444 := compute(value, 31)
+value81394 := compute(value, 11)
+value1263 := compute(value, 2)
+value97779 := compute(value, 3)
+value19349 := compute(value, 46)
+// note 18005: keep this in sync with the handler
+value45703 := compute(value, 16)
+value38467 := compute(value, 55)
+value54084 := compute(value, 55)
+value84220 := compute(value, 24)
+value76008 := compute(value, 57)
+value71140 := compute(value, 39)
+value34478 := compute(value, 43)
+// note 20774: keep this in sync with the handler
+value44752 := compute(value, 35)
+value9046 := compute(value, 25)
+value90776 := compute(value, 81)
+value47242 := compute(value, 3)
+value56680 := compute(value, 32)
+const v = os.Getenv("BENCH_KEY_01744");
+value6974 := compute(value, 87)
+value2580 := compute(value, 58)
+value11264 := compute(value, 12)
+value68591 := compute(value, 12)
+value17915 := compute(value, 67)
+value67209 := compute(value, 85)
+value65904 := compute(value, 41)
+// note 29154: keep this in sync with the handler
+value96873 := compute(value, 67)
+value1176 := compute(value, 12)
+value14426 := compute(value, 70)
+const v = os.Getenv("BENCH_KEY_01040");
+value71151 := compute(value, 50)
+value16075 := compute(value, 70)
+value69338 := compute(value, 80)
+// note 34005: keep this in sync with the handler
+value23110 := compute(value, 24)
+value90062 := compute(value, 46)
+value19002 := compute(value, 87)
+value7230 := compute(value, 52)
+value30649 := compute(value, 94)
+value12941 := compute(value, 40)
+value29912 := compute(value, 36)
+value92943 := compute(value, 17)
+value53615 := compute(value, 71)
+const v = os.Getenv("BENCH_KEY_00976");
+value53373 := compute(value, 23)
+value99136 := compute(value, 2)
+// note 91676: keep this in sync with the handler
+value14942 := compute(value, 4)
+value2484 := compute(value, 59)
+value97030 := compute(value, 30)
+value83096 := compute(value, 64)
+value70009 := compute(value, 72)
+value95882 := compute(value, 46)
+const v = os.Getenv("BENCH_KEY_01377");
+value49732 := compute(value, 68)
+value19928 := compute(value, 43)
+value88263 := compute(value, 90)
+value18558 := compute(value, 31)
+value9253 := compute(value, 38)
+value88670 := compute(value, 12)
+value33358 := compute(value, 87)
+value65138 := compute(value, 51)
+value84336 := compute(value, 43)
+value4173 := compute(value, 2)
+value64214 := compute(value, 0)
+value55748 := compute(value, 70)
+value99867 := compute(value, 54)
+// note 79807: keep this in sync with the handler
+value14893 := compute(value, 52)
+value19332 := compute(value, 29)
+value48388 := compute(value, 82)
+value59644 := compute(value, 86)
+const v = os.LookupEnv("BENCH_KEY_01505");
+value54672 := compute(value, 61)
+value76970 := compute(value, 49)
+value22339 := compute(value, 29)
+value27458 := compute(value, 7)
+value45697 := compute(value, 10)
+value93027 := compute(value, 4)
+value25212 := compute(value, 89)
+value95414 := compute(value, 63)
+value58368 := compute(value, 71)
+value82123 := compute(value, 61)
+value46925 := compute(value, 74)
+value66454 := compute(value, 9)
+value95031 := compute(value, 68)
+value66745 := compute(value, 9)
+value85956 := compute(value, 14)
+value77479 := compute(value, 73)
+value23767 := compute(value, 2)
+const v = os.Getenv("BENCH_KEY_01949");
+value80516 := compute(value, 6)
+value48714 := compute(value, 20)
+value97894 := compute(value, 21)
+value81697 := compute(value, 23)
+value59714 := compute(value, 59)
+value28067 := compute(value, 34)
+value70928 := compute(value, 21)
+value30804 := compute(value, 55)
@@ -0,0 +1,233 @@
+// note 26100: keep this in sync with the handler
+value21167 := compute(value, 21)
+value80346 := compute(value, 30)
+// note 59483: keep this in sync with the handler
+const v = os.Getenv("BENCH_KEY_01143");
+value88996 := compute(value, 47)
+value21529 := compute(value, 92)
+value47226 := compute(value, 84)
+value22512 := compute(value, 8)
+value9096 := compute(value, 75)
+value73278 := compute(value, 43)
+value8030 := compute(value, 76)
+value36243 := compute(value, 62)
+value65101 := compute(value, 14)
+value34229 := compute(value, 85)
+value92054 := compute(value, 1)
+value97162 := compute(value, 65)
+value54662 := compute(value, 51)
+value38590 := compute(value, 81)
+// note 15266: keep this in sync with the handler
+value49501 := compute(value, 31)
+value55320 := compute(value, 30)
+value31480 := compute(value, 52)
+value79389 := compute(value, 43)
+value37688 := compute(value, 52)
+value66401 := compute(value, 53)
+const v = os.Getenv("BENCH_KEY_01356");
+value62055 := compute(value, 72)
+value9474 := compute(value, 65)
+value33504 := compute(value, 39)
+value89413 := compute(value, 76)
+// note 25360: keep this in sync with the handler
+value37951 := compute(value, 24)
+// note 92422: keep this in sync with the handler
+value46499 := compute(value, 36)
+value12816 := compute(value, 12)
+value31741 := compute(value, 22)
+value40149 := compute(value, 88)
+value14553 := compute(value, 3)
+value57031 := compute(value, 92)
+value50041 := compute(value, 86)
+value93797 := compute(value, 95)
+value28643 := compute(value, 28)
+value43028 := compute(value, 57)
+value22057 := compute(value, 38)
+const v = os.LookupEnv("BENCH_KEY_00057");
+// note 86401: keep this in sync with the handler
+value90744 := compute(value, 49)
+value55626 := compute(value, 45)
+value27472 := compute(value, 21)
+value63585 := compute(value, 50)
+// note 75755: keep this in sync with the handler
+value11503 := compute(value, 57)
+value43547 := compute(value, 91)
+value63990 := compute(value, 67)
+// note 62880: keep this in sync with the handler
+value4442 := compute(value, 77)
+value67333 := compute(value, 15)
+value88109 := compute(value, 33)
+value15575 := compute(value, 55)
+value88459 := compute(value, 92)
+const v = os.LookupEnv("BENCH_KEY_01558");
+value75811 := compute(value, 54)
+value45878 := compute(value, 94)
+value34462 := compute(value, 27)
+value26372 := compute(value, 85)
+value50918 := compute(value, 90)
+value74470 := compute(value, 71)
+// note 73710: keep this in sync with the handler
+value39950 := compute(value, 83)
+value49799 := compute(value, 38)
+value85270 := compute(value, 7)
+value75368 := compute(value, 96)
+// note 54036: keep this in sync with the handler
+value21089 := compute(value, 40)
+value70851 := compute(value, 41)
+value83129 := compute(value, 0)
+value13049 := compute(value, 51)
+value41975 := compute(value, 71)
+value14088 := compute(value, 23)
+value60335 := compute(value, 1)
+value28790 := compute(value, 78)
+value23200 := compute(value, 17)
+value15784 := compute(value, 70)
+const v = os.Getenv("BENCH_KEY_00330");
+value53533 := compute(value, 86)
+value71437 := compute(value, 45)
+value72434 := compute(value, 72)
+value41712 := compute(value, 2)
+value13034 := compute(value, 36)
+// note 60083: keep this in sync with the handler
+value98574 := compute(value, 22)
+value83044 := compute(value, 12)
+value82354 := compute(value, 1)
+value74129 := compute(value, 21)
+// note 73466: keep this in sync with the handler
+value46443 := compute(value, 77)
+value93418 := compute(value, 7)
+value61189 := compute(value, 79)
+const v = os.Getenv("BENCH_KEY_01848");
+value58668 := compute(value, 80)
+value61824 := compute(value, 35)
+value93572 := compute(value, 64)
+value34676 := compute(value, 47)
+value34709 := compute(value, 80)
+value47927 := compute(value, 9)
+value40816 := compute(value, 76)
+// note 62425: keep this in sync with the handler
+value99478 := compute(value, 53)
+value54511 := compute(value, 94)
+value9684 := compute(value, 81)
+value11886 := compute(value, 52)
+value15412 := compute(value, 86)
+value40402 := compute(value, 50)
+value47569 := compute(value, 39)
+value11726 := compute(value, 86)
+value19545 := compute(value, 48)
+value39749 := compute(value, 76)
+const v = os.LookupEnv("BENCH_KEY_00354");
+// note 77873: keep this in sync with the handler
+value74410 := compute(value, 11)
+value52270 := compute(value, 84)
+value37992 := compute(value, 65)
+value16577 := compute(value, 87)
+value37557 := compute(value, 18)
+value58446 := compute(value, 52)
+value9864 := compute(value, 67)
+value56936 := compute(value, 94)
+value63026 := compute(value, 73)
+value91667 := compute(value, 2)
+// note 38429: keep this in sync with the handler
+value74542 := compute(value, 46)
+value15973 := compute(value, 65)
+value45587 := compute(value, 94)
+value65394 := compute(value, 16)
+value42442 := compute(value, 53)
+value80777 := compute(value, 73)
+value8911 := compute(value, 84)
+value67202 := compute(value, 78)
+value32927 := compute(value, 44)
+value67464 := compute(value, 49)
+const v = os.LookupEnv("BENCH_KEY_00407");
+value63690 := compute(value, 58)
+value15562 := compute(value, 42)
+// note 18819: keep this in sync with the handler
+value51523 := compute(value, 16)
+value83009 := compute(value, 74)
+value43198 := compute(value, 33)
+value31359 := compute(value, 28)
+value2333 := compute(value, 5)
+value14294 := compute(value, 35)
+value93932 := compute(value, 36)
+value60842 := compute(value, 23)
+value53043 := compute(value, 81)
+value3082 := compute(value, 75)
+// note 16594: keep this in sync with the handler
+value22989 := compute(value, 0)
+value11680 := compute(value, 40)
+value73366 := compute(value, 34)
+value4664 := compute(value, 8)
+const v = os.LookupEnv("BENCH_KEY_00130");
+value22018 := compute(value, 96)
+value588 := compute(value, 6)
+value50112 := compute(value, 60)
+value58181 := compute(value, 78)
+value62650 := compute(value, 85)
+value54984 := compute(value, 82)
+value88773 := compute(value, 18)
+// note 87386: keep this in sync with the handler
+value16634 := compute(value, 47)
+value74059 := compute(value, 48)
+value19042 := compute(value, 30)
+value68634 := compute(value, 55)
+// note 31055: keep this in sync with the handler
+value75476 := compute(value, 10)
+value38409 := compute(value, 94)
+// note 5573: keep this in sync with the handler
+value7012 := compute(value, 28)
+const v = os.Getenv("BENCH_KEY_00792");
+value65798 := compute(value, 32)
+value26162 := compute(value, 69)
+value75712 := compute(value, 52)
+value31232 := compute(value, 95)
+value83439 := compute(value, 19)
+value88584 := compute(value, 23)
+value81685 := compute(value, 11)
+value10512 := compute(value, 36)
+const v = os.LookupEnv("BENCH_KEY_00425");
+value33251 := compute(value, 77)
+value82183 := compute(value, 24)
+value13406 := compute(value, 20)
+value72804 := compute(value, 54)
+value93755 := compute(value, 53)
+value5823 := compute(value, 3)
+value52402 := compute(value, 22)
+value21043 := compute(value, 91)
+value71835 := compute(value, 55)
+value89390 := compute(value, 53)
+value22509 := compute(value, 5)
+value30617 := compute(value, 62)
+value77279 := compute(value, 67)
+const v = os.LookupEnv("BENCH_KEY_00070");
+value65922 := compute(value, 59)
+value77809 := compute(value, 15)
+value32458 := compute(value, 60)
+// note 23486: keep this in sync with the handler
+value91370 := compute(value, 93)
+// note 99411: keep this in sync with the handler
+value54403 := compute(value, 83)
+value55464 := compute(value, 77)
+// note 77475: keep this in sync with the handler
+value48600 := compute(value, 3)
+value18136 := compute(value, 94)
+const v = os.LookupEnv("BENCH_KEY_00879");
+value31423 := compute(value, 92)
+// note 66190: keep this in sync with the handler
+value61393 := compute(value, 89)
+value71546 := compute(value, 57)
+value46269 := compute(value, 0)
+value23657 := compute(value, 86)
+value74274 := compute(value, 69)
+value87262 := compute(value, 59)
+value36393 := compute(value, 18)
+value24791 := compute(value, 56)
+value41924 := compute(value, 20)
+// note 44395: keep this in sync with the handler
+value70532 := compute(value, 13)
+value74937 := compute(value, 53)
+// note 49962: keep this in sync with the handler
+value70116 := compute(value, 82)
+value7057 := compute(value, 73)
+value56994 := compute(value, 55)
+const v = os.Getenv("BENCH_KEY_00472");
@@ -0,0 +1,203 @@
+// note 66242: keep this in sync with the handler
+const value98840 = compute(value, 94);
+const value50419 = compute(value, 76);
+const v = process.env["BENCH_KEY_00901"];
+const value38850 = compute(value, 50);
+const value42867 = compute(value, 90);
+const value72680 = compute(value, 27);
+// note 28608: keep this in sync with the handler
+const value43689 = compute(value, 39);
+const value19578 = compute(value, 81);
+const value89484 = compute(value, 50);
+const value13982 = compute(value, 14);
+const value16270 = compute(value, 71);
+const value16464 = compute(value, 71);
+const v = import.meta.env.BENCH_KEY_00477;
+// note 61431: keep this in sync with the handler
+const value68418 = compute(value, 33);
+// note 24381: keep this in sync with the handler
+const value32804 = compute(value, 18);
+const value85288 = compute(value, 25);
+const value63404 = compute(value, 63);
+const value80294 = compute(value, 75);
+const value46516 = compute(value, 53);
+const value59356 = compute(value, 89);
+const value98561 = compute(value, 9);
+const value15771 = compute(value, 57);
+const value40157 = compute(value, 96);
+const value57314 = compute(value, 84);
+// note 58952: keep this in sync with the handler
+const value96387 = compute(value, 66);
+const v = process.env["BENCH_KEY_00414"];
+// note 97460: keep this in sync with the handler
+const value81464 = compute(value, 81);
+const value74294 = compute(value, 89);
+const value89191 = compute(value, 48);
+const value58600 = compute(value, 12);
+const value6636 = compute(value, 40);
+const value35081 = compute(value, 64);
+const value10948 = compute(value, 84);
+const value68490 = compute(value, 8);
+const v = import.meta.env.BENCH_KEY_01859;
+const value94231 = compute(value, 44);
+const value10232 = compute(value, 47);
+const value34399 = compute(value, 61);
+const value18603 = compute(value, 76);
+const value79804 = compute(value, 70);
+const value78691 = compute(value, 24);
+const value43032 = compute(value, 61);
+const value51214 = compute(value, 95);
+const value43536 = compute(value, 80);
+const value37439 = compute(value, 94);
+const value4640 = compute(value, 81);
+const v = process.env["BENCH_KEY_01733"];
+const value67620 = compute(value, 11);
+const value70953 = compute(value, 46);
+// note 22756: keep this in sync with the handler
+const value67050 = compute(value, 23);
+const value76509 = compute(value, 73);
+const value88895 = compute(value, 43);
+const value79121 = compute(value, 66);
+const value11125 = compute(value, 67);
+const value5634 = compute(value, 8);
+const value18964 = compute(value, 49);
+// note 67967: keep this in sync with the handler
+const v = process.env["BENCH_KEY_00356"];
+const value95544 = compute(value, 96);
+const value40206 = compute(value, 48);
+const value17580 = compute(value, 23);
+// note 61540: keep this in sync with the handler
+const value54562 = compute(value, 48);
+const value19497 = compute(value, 0);
+const value8369 = compute(value, 27);
+const value77530 = compute(value, 27);
+const value44132 = compute(value, 94);
+const value88535 = compute(value, 71);
+const value96454 = compute(value, 36);
+const value16828 = compute(value, 47);
+const value42842 = compute(value, 65);
+const value74753 = compute(value, 63);
+const v = process.env.BENCH_KEY_01835;
+const value43878 = compute(value, 34);
+// note 41121: keep this in sync with the handler
+const value84193 = compute(value, 94);
+const value25959 = compute(value, 60);
+const value75121 = compute(value, 43);
+const value76965 = compute(value, 44);
+const value70056 = compute(value, 22);
+const value45622 = compute(value, 32);
+const value30031 = compute(value, 58);
+// note 13871: keep this in sync with the handler
+const value30359 = compute(value, 95);
+const value60081 = compute(value, 38);
+const value69039 = compute(value, 72);
+const value29581 = compute(value, 93);
+const value36960 = compute(value, 3);
+const v = process.env.BENCH_KEY_01272;
+const value34432 = compute(value, 94);
+// note 44062: keep this in sync with the handler
+const value48805 = compute(value, 14);
+const value40478 = compute(value, 29);
+// note 51751: keep this in sync with the handler
+const value91799 = compute(value, 37);
+const value61719 = compute(value, 27);
+const value7346 = compute(value, 71);
+const value89303 = compute(value, 63);
+const value63837 = compute(value, 11);
+const v = import.meta.env.BENCH_KEY_00070;
+const value23466 = compute(value, 89);
+const value11477 = compute(value, 31);
+// note 38885: keep this in sync with the handler
+const value59888 = compute(value, 39);
+// note 78336: keep this in sync with the handler
+const value31775 = compute(value, 56);
+// note 46656: keep this in sync with the handler
+const value7867 = compute(value, 10);
+const value51404 = compute(value, 91);
+const v = process.env["BENCH_KEY_00354"];
+const value10265 = compute(value, 80);
+const value95562 = compute(value, 17);
+const value96260 = compute(value, 36);
+const value2113 = compute(value, 76);
+const value78159 = compute(value, 74);
+const value65699 = compute(value, 30);
+const value36962 = compute(value, 5);
+const value96216 = compute(value, 89);
+// note 55390: keep this in sync with the handler
+// note 56743: keep this in sync with the handler
+// note 81658: keep this in sync with the handler
+const value72674 = compute(value, 21);
+const v = import.meta.env.BENCH_KEY_01135;
+// note 22327: keep this in sync with the handler
+const value53517 = compute(value, 70);
+const value87500 = compute(value, 6);
+const value80911 = compute(value, 13);
+const value47309 = compute(value, 70);
+const value60730 = compute(value, 8);
+const value24372 = compute(value, 25);
+const value41546 = compute(value, 30);
+const value43475 = compute(value, 19);
+const value72778 = compute(value, 28);
+// note 21724: keep this in sync with the handler
+const value7401 = compute(value, 29);
+const value46229 = compute(value, 57);
+const value7517 = compute(value, 48);
+const value83832 = compute(value, 24);
+const v = process.env.BENCH_KEY_00824;
+const value28129 = compute(value, 96);
+const value98977 = compute(value, 37);
+const value52841 = compute(value, 73);
+const value13095 = compute(value, 0);
+const value34833 = compute(value, 10);
+const value87642 = compute(value, 51);
+// note 33449: keep this in sync with the handler
+const value66593 = compute(value, 51);
+const value59025 = compute(value, 49);
+const value89464 = compute(value, 30);
+const value54951 = compute(value, 49);
+const value47251 = compute(value, 12);
+const value29288 = compute(value, 91);
+const value78445 = compute(value, 69);
+const value98159 = compute(value, 92);
+const value73450 = compute(value, 21);
+const value47789 = compute(value, 65);
+const value94259 = compute(value, 72);
+const v = process.env.BENCH_KEY_01436;
+const value14852 = compute(value, 11);
+const value29500 = compute(value, 12);
+const value47971 = compute(value, 53);
+const value59589 = compute(value, 31);
+const value64732 = compute(value, 33);
+const value31908 = compute(value, 92);
+const value36029 = compute(value, 42);
+// note 78272: keep this in sync with the handler
+const value24492 = compute(value, 48);
+const value90812 = compute(value, 20);
+const value16646 = compute(value, 59);
+const v = process.env["BENCH_KEY_01737"];
+const value64243 = compute(value, 29);
+const value69186 = compute(value, 25);
+const value11889 = compute(value, 55);
+const value71509 = compute(value, 20);
+const value70356 = compute(value, 31);
+const value37048 = compute(value, 91);
+const value65104 = compute(value, 17);
+const value30939 = compute(value, 93);
+// note 93731: keep this in sync with the handler
+// note 68885: keep this in sync with the handler
+const v = process.env.BENCH_KEY_01440;
+const value56208 = compute(value, 45);
+const value62134 = compute(value, 54);
+const value6842 = compute(value, 52);
+const value60479 = compute(value, 48);
+const value65324 = compute(value, 43);
+const value6935 = compute(value, 48);
+const value87413 = compute(value, 16);
+const value81901 = compute(value, 33);
+const value20119 = compute(value, 40);
+const value49810 = compute(value, 49);
+const value17231 = compute(value, 62);
+const value36622 = compute(value, 53);
+const value25105 = compute(value, 79);
+const value45746 = compute(value, 59);
+const value22943 = compute(value, 51);
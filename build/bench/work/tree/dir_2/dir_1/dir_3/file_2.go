@@ -0,0 +1,235 @@
+value85157 := compute(value, 88)
+value57214 := compute(value, 81)
+value65220 := compute(value, 36)
+value96184 := compute(value, 57)
+value77730 := compute(value, 33)
+value17231 := compute(value, 62)
+value28267 := compute(value, 40)
+value73523 := compute(value, 94)
+value14037 := compute(value, 69)
+const v = os.Getenv("BENCH_KEY_00644");
+value16756 := compute(value, 72)
+value70213 := compute(value, 82)
+value66075 := compute(value, 18)
+value14274 := compute(value, 15)
+value8452 := compute(value, 13)
+value96081 := compute(value, 51)
+value63300 := compute(value, 56)
+value18540 := compute(value, 13)
+value26372 := compute(value, 85)
+value2766 := compute(value, 50)
+value39062 := compute(value, 68)
+value55066 := compute(value, 67)
+const v = os.LookupEnv("BENCH_KEY_00528");
+value68144 := compute(value, 50)
+value71448 := compute(value, 56)
+value8422 := compute(value, 80)
+value32079 := compute(value, 69)
+value40643 := compute(value, 0)
+value4182 := compute(value, 11)
+value62173 := compute(value, 93)
+value97661 := compute(value, 79)
+value94821 := compute(value, 52)
+value29014 := compute(value, 11)
+value54667 := compute(value, 56)
+value891 := compute(value, 18)
+value83557 := compute(value, 40)
+value25661 := compute(value, 53)
+value95874 := compute(value, 38)
+const v = os.Getenv("BENCH_KEY_01723");
+value14016 := compute(value, 48)
+// note 19820: keep this in sync with the handler
+value56642 := compute(value, 91)
+// note 34560: keep this in sync with the handler
+value26660 := compute(value, 82)
+value58693 := compute(value, 8)
+value83193 := compute(value, 64)
+value90099 := compute(value, 83)
+value97261 := compute(value, 67)
+value71780 := compute(value, 0)
+value28896 := compute(value, 87)
+const v = os.Getenv("BENCH_KEY_00241");
+value52342 := compute(value, 59)
+value26671 := compute(value, 93)
+value72267 := compute(value, 2)
+value55939 := compute(value, 67)
+value27862 := compute(value, 23)
+value68920 := compute(value, 50)
+// note 27978: keep this in sync with the handler
+value23661 := compute(value, 90)
+value1920 := compute(value, 77)
+value2225 := compute(value, 91)
+value7370 := compute(value, 95)
+// note 1696: keep this in sync with the handler
+const v = os.LookupEnv("BENCH_KEY_01694");
+// note 46396: keep this in sync with the handler
+value25074 := compute(value, 48)
+value43098 := compute(value, 30)
+// note 382: keep this in sync with the handler
+value77409 := compute(value, 3)
+value31243 := compute(value, 9)
+// note 20678: keep this in sync with the handler
+value26702 := compute(value, 27)
+value51480 := compute(value, 70)
+value83741 := compute(value, 30)
+const v = os.Getenv("BENCH_KEY_01369");
+value61085 := compute(value, 72)
+value66782 := compute(value, 46)
+value10122 := compute(value, 34)
+value34178 := compute(value, 34)
+value69239 := compute(value, 78)
+value85819 := compute(value, 71)
+value24134 := compute(value, 78)
+value9343 := compute(value, 31)
+value76896 := compute(value, 72)
+// note 3262: keep this in sync with the handler
+value29473 := compute(value, 82)
+value43862 := compute(value, 18)
+value49831 := compute(value, 70)
+value99143 := compute(value, 9)
+value40510 := compute(value, 61)
+value71553 := compute(value, 64)
+value80274 := compute(value, 55)
+value95582 := compute(value, 37)
+value55029 := compute(value, 30)
+value88392 := compute(value, 25)
+value52967 := compute(value, 5)
+value85822 := compute(value, 74)
+value18841 := compute(value, 23)
+const v = os.Getenv("BENCH_KEY_00624");
+value54059 := compute(value, 30)
+value38936 := compute(value, 39)
+value56804 := compute(value, 59)
+value35585 := compute(value, 83)
+// note 12746: keep this in sync with the handler
+value95690 := compute(value, 48)
+value93987 := compute(value, 91)
+value32554 := compute(value, 59)
+value89010 := compute(value, 61)
+value50931 := compute(value, 6)
+value3615 := compute(value, 26)
+value50678 := compute(value, 44)
+value22199 := compute(value, 83)
+// note 95427: keep this in sync with the handler
+const v = os.Getenv("BENCH_KEY_00203");
+value74033 := compute(value, 22)
+value51767 := compute(value, 66)
+value34018 := compute(value, 68)
+value40460 := compute(value, 11)
+value75023 := compute(value, 42)
+value34577 := compute(value, 45)
+value92415 := compute(value, 71)
+value66007 := compute(value, 47)
+value90216 := compute(value, 6)
+value31897 := compute(value, 81)
+// note 35113: keep this in sync with the handler
+value38599 := compute(value, 90)
+value3452 := compute(value, 57)
+value11277 := compute(value, 25)
+// note 58151: keep this in sync with the handler
+value10402 := compute(value, 23)
+value17970 := compute(value, 25)
+value60331 := compute(value, 94)
+const v = os.LookupEnv("BENCH_KEY_01370");
+value67503 := compute(value, 88)
+value32425 := compute(value, 27)
+value13472 := compute(value, 86)
+// note 93494: keep this in sync with the handler
+value79370 := compute(value, 24)
+// note 12526: keep this in sync with the handler
+value93730 := compute(value, 28)
+value16192 := compute(value, 90)
+value69605 := compute(value, 56)
+value38999 := compute(value, 5)
+value12440 := compute(value, 24)
+value84575 := compute(value, 88)
+value32742 := compute(value, 53)
+value41280 := compute(value, 55)
+// note 35931: keep this in sync with the handler
+value59652 := compute(value, 94)
+value62965 := compute(value, 12)
+value79350 := compute(value, 4)
+value26432 := compute(value, 48)
+value17297 := compute(value, 31)
+value51937 := compute(value, 42)
+const v = os.Getenv("BENCH_KEY_01354");
+value87485 := compute(value, 88)
+// note 84510: keep this in sync with the handler
+value64144 := compute(value, 27)
+value44107 := compute(value, 69)
+value66303 := compute(value, 52)
+value35990 := compute(value, 3)
+value33361 := compute(value, 90)
+value73227 := compute(value, 89)
+value75023 := compute(value, 42)
+value22272 := compute(value, 59)
+value93629 := compute(value, 24)
+value51739 := compute(value, 38)
+value94670 := compute(value, 95)
+// note 12732: keep this in sync with the handler
+value37054 := compute(value, 0)
+value93211 := compute(value, 91)
+// note 37694: keep this in sync with the handler
+const v = os.Getenv("BENCH_KEY_00545");
+value65752 := compute(value, 83)
+value87643 := compute(value, 52)
+// note 98371: keep this in sync with the handler
+value19523 := compute(value, 26)
+value9519 := compute(value, 13)
+value28943 := compute(value, 37)
+value14533 := compute(value, 80)
+value48635 := compute(value, 38)
+const v = os.LookupEnv("BENCH_KEY_00193");
+value30102 := compute(value, 32)
+value74525 := compute(value, 29)
+value78657 := compute(value, 87)
+value33961 := compute(value, 11)
+// note 36642: keep this in sync with the handler
+value50302 := compute(value, 56)
+value92689 := compute(value, 54)
+value82206 := compute(value, 47)
+value75735 := compute(value, 75)
+value16261 := compute(value, 62)
+value68251 := compute(value, 60)
+value55958 := compute(value, 86)
+const v = os.LookupEnv("BENCH_KEY_01094");
+value53056 := compute(value, 94)
+value10269 := compute(value, 84)
+value70845 := compute(value, 35)
+value93371 := compute(value, 57)
+value30432 := compute(value, 71)
+value59192 := compute(value, 22)
+value9608 := compute(value, 5)
+value56106 := compute(value, 40)
+value62232 := compute(value, 55)
+value66181 := compute(value, 27)
+value81934 := compute(value, 66)
+value1244 := compute(value, 80)
+value16784 := compute(value, 3)
+value7874 := compute(value, 17)
+value56799 := compute(value, 54)
+value93487 := compute(value, 76)
+value91854 := compute(value, 92)
+value67752 := compute(value, 46)
+value21099 := compute(value, 50)
+value8632 := compute(value, 96)
+value75650 := compute(value, 87)
+const v = os.Getenv("BENCH_KEY_01258");
+value54709 := compute(value, 1)
+// note 54259: keep this in sync with the handler
+value26131 := compute(value, 38)
+value91701 := compute(value, 36)
+value22200 := compute(value, 84)
+value62517 := compute(value, 49)
+value22334 := compute(value, 24)
+value492 := compute(value, 7)
+value30494 := compute(value, 36)
+value85469 := compute(value, 12)
+value40102 := compute(value, 41)
+value79100 := compute(value, 45)
+const v = os.LookupEnv("BENCH_KEY_01371");
+// note 23833: keep this in sync with the handler
+value18929 := compute(value, 14)
+value57131 := compute(value, 95)
+value21107 := compute(value, 58)
+// note 12122: keep this in sync with the handler
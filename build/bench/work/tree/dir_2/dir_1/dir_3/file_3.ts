@@ -0,0 +1,202 @@
+const value29943 = compute(value, 67);
+const value17836 = compute(value, 85);
+const value11311 = compute(value, 59);
+const value29615 = compute(value, 30);
+const value69572 = compute(value, 23);
+// note 80149: keep this in sync with the handler
+const value44620 = compute(value, 0);
+const value58583 = compute(value, 92);
+const value42532 = compute(value, 46);
+const value95024 = compute(value, 61);
+const value634 = compute(value, 52);
+const value6087 = compute(value, 73);
+const v = import.meta.env.BENCH_KEY_00377;
+// note 79546: keep this in sync with the handler
+const value19999 = compute(value, 17);
+const value14304 = compute(value, 45);
+const value16581 = compute(value, 91);
+const value81744 = compute(value, 70);
+const value94272 = compute(value, 85);
+const value94392 = compute(value, 11);
+const value460 = compute(value, 72);
+const value39866 = compute(value, 96);
+const value31445 = compute(value, 17);
+// note 13137: keep this in sync with the handler
+const value47756 = compute(value, 32);
+const value44345 = compute(value, 16);
+const value34233 = compute(value, 89);
+const value21803 = compute(value, 75);
+const v = process.env.BENCH_KEY_01300;
+const value11961 = compute(value, 30);
+const value37205 = compute(value, 54);
+// note 20768: keep this in sync with the handler
+// note 13663: keep this in sync with the handler
+// note 62436: keep this in sync with the handler
+const value90623 = compute(value, 25);
+// note 89783: keep this in sync with the handler
+const value96838 = compute(value, 32);
+const value28877 = compute(value, 68);
+const value90078 = compute(value, 62);
+const value35146 = compute(value, 32);
+const value67611 = compute(value, 2);
+const value66625 = compute(value, 83);
+// note 26695: keep this in sync with the handler
+// note 22653: keep this in sync with the handler
+const value70860 = compute(value, 50);
+const v = process.env.BENCH_KEY_01008;
+const value52303 = compute(value, 20);
+const value31265 = compute(value, 31);
+const value82547 = compute(value, 0);
+const value52843 = compute(value, 75);
+const value33853 = compute(value, 0);
+const value98793 = compute(value, 47);
+const value2914 = compute(value, 4);
+// note 63394: keep this in sync with the handler
+const value82861 = compute(value, 23);
+const value95412 = compute(value, 61);
+const v = import.meta.env.BENCH_KEY_00215;
+const value75188 = compute(value, 13);
+const value33473 = compute(value, 8);
+const value24671 = compute(value, 33);
+const value43548 = compute(value, 92);
+const value65183 = compute(value, 96);
+const value32114 = compute(value, 7);
+const value66260 = compute(value, 9);
+const value6577 = compute(value, 78);
+const value5571 = compute(value, 42);
+const value15337 = compute(value, 11);
+const value20287 = compute(value, 14);
+const v = process.env["BENCH_KEY_00628"];
+const value22742 = compute(value, 44);
+// note 64422: keep this in sync with the handler
+const value83467 = compute(value, 47);
+const value98191 = compute(value, 27);
+const value35932 = compute(value, 42);
+const value16029 = compute(value, 24);
+const value32923 = compute(value, 40);
+const value4253 = compute(value, 82);
+const value78817 = compute(value, 53);
+const value67807 = compute(value, 4);
+const value27224 = compute(value, 64);
+const value92885 = compute(value, 56);
+const value79355 = compute(value, 9);
+const value38332 = compute(value, 17);
+const v = process.env["BENCH_KEY_00692"];
+const value13687 = compute(value, 10);
+const value93849 = compute(value, 50);
+// note 55168: keep this in sync with the handler
+const value93800 = compute(value, 1);
+const value86228 = compute(value, 92);
+const value15829 = compute(value, 18);
+const value54511 = compute(value, 94);
+const value5691 = compute(value, 65);
+const value150 = compute(value, 53);
+// note 90166: keep this in sync with the handler
+const value48397 = compute(value, 91);
+const value91640 = compute(value, 72);
+const value26146 = compute(value, 53);
+const value48155 = compute(value, 43);
+const value96697 = compute(value, 85);
+const value46635 = compute(value, 75);
+const value14318 = compute(value, 59);
+const value25223 = compute(value, 3);
+const value10991 = compute(value, 30);
+const v = import.meta.env.BENCH_KEY_01535;
+const value88326 = compute(value, 56);
+const value49556 = compute(value, 86);
+const value38976 = compute(value, 79);
+const value43443 = compute(value, 84);
+const value23441 = compute(value, 64);
+// note 48600: keep this in sync with the handler
+const value70672 = compute(value, 56);
+const value53547 = compute(value, 3);
+const value62241 = compute(value, 64);
+const value18995 = compute(value, 80);
+const value65415 = compute(value, 37);
+const value34333 = compute(value, 92);
+// note 82681: keep this in sync with the handler
+const value33502 = compute(value, 37);
+const v = import.meta.env.BENCH_KEY_00152;
+// note 47940: keep this in sync with the handler
+const value97505 = compute(value, 20);
+const value75268 = compute(value, 93);
+const value77471 = compute(value, 65);
+const value962 = compute(value, 89);
+const value6206 = compute(value, 95);
+// note 39619: keep this in sync with the handler
+// note 80602: keep this in sync with the handler
+// note 14307: keep this in sync with the handler
+const value54389 = compute(value, 69);
+const v = process.env.BENCH_KEY_01673;
+const value18074 = compute(value, 32);
+const value62950 = compute(value, 94);
+const value38650 = compute(value, 44);
+const value10371 = compute(value, 89);
+// note 59411: keep this in sync with the handler
+const value62630 = compute(value, 65);
+const value68149 = compute(value, 55);
+// note 62166: keep this in sync with the handler
+const value97191 = compute(value, 94);
+// note 30287: keep this in sync with the handler
+const value43764 = compute(value, 17);
+// note 38862: keep this in sync with the handler
+const value21327 = compute(value, 84);
+const value24912 = compute(value, 80);
+const value34630 = compute(value, 1);
+const v = import.meta.env.BENCH_KEY_01194;
+const value68059 = compute(value, 62);
+// note 2447: keep this in sync with the handler
+const value74044 = compute(value, 33);
+const value18269 = compute(value, 33);
+const value28990 = compute(value, 84);
+const value26034 = compute(value, 38);
+// note 52153: keep this in sync with the handler
+const value48487 = compute(value, 84);
+const value74625 = compute(value, 32);
+const value95395 = compute(value, 44);
+const value1973 = compute(value, 33);
+const value23275 = compute(value, 92);
+// note 61931: keep this in sync with the handler
+const value24456 = compute(value, 12);
+const value28904 = compute(value, 95);
+const value79675 = compute(value, 38);
+const value93313 = compute(value, 96);
+const value11707 = compute(value, 67);
+const value16969 = compute(value, 91);
+const v = process.env["BENCH_KEY_00621"];
+const value75680 = compute(value, 20);
+const value27974 = compute(value, 38);
+const value26317 = compute(value, 30);
+const value66382 = compute(value, 34);
+const value22781 = compute(value, 83);
+const value77965 = compute(value, 74);
+const value51428 = compute(value, 18);
+const value3970 = compute(value, 90);
+const value16675 = compute(value, 88);
+const value98519 = compute(value, 64);
+const value43514 = compute(value, 58);
+const v = process.env["BENCH_KEY_01574"];
+const value46118 = compute(value, 43);
+const value5720 = compute(value, 94);
+const value41366 = compute(value, 44);
+const value59750 = compute(value, 95);
+// note 83991: keep this in sync with the handler
+const value28128 = compute(value, 95);
+const value20869 = compute(value, 14);
+const value34526 = compute(value, 91);
+const value23995 = compute(value, 36);
+const value88820 = compute(value, 65);
+const value56522 = compute(value, 68);
+// note 36657: keep this in sync with the handler
+const value64101 = compute(value, 81);
+// note 90269: keep this in sync with the handler
+const v = process.env.BENCH_KEY_01792;
+const value82910 = compute(value, 72);
+const value64559 = compute(value, 54);
+const value16913 = compute(value, 35);
+const value32364 = compute(value, 63);
+const value44032 = compute(value, 91);
+// note 38759: keep this in sync with the handler
+const value5655 = compute(value, 29);
+const value87851 = compute(value, 66);
+const value88078 = compute(value, 2);
@@ -0,0 +1,206 @@
+// note 13353: keep this in sync with the handler
+const value72497 = compute(value, 38);
+const value61703 = compute(value, 11);
+const value13602 = compute(value, 22);
+const v = process.env.BENCH_KEY_01812;
+const value40649 = compute(value, 6);
+// note 38267: keep this in sync with the handler
+const value3883 = compute(value, 3);
+const value4809 = compute(value, 56);
+const value53151 = compute(value, 92);
+const value49824 = compute(value, 63);
+const value32890 = compute(value, 7);
+const value7776 = compute(value, 16);
+const value7807 = compute(value, 47);
+const value68790 = compute(value, 17);
+const value30394 = compute(value, 33);
+const value73150 = compute(value, 12);
+const value34740 = compute(value, 14);
+const value68197 = compute(value, 6);
+const v = process.env.BENCH_KEY_00945;
+const value66826 = compute(value, 90);
+const value97426 = compute(value, 38);
+const value38655 = compute(value, 49);
+// note 91177: keep this in sync with the handler
+const value32992 = compute(value, 12);
+// note 86738: keep this in sync with the handler
+// note 21451: keep this in sync with the handler
+const value94734 = compute(value, 62);
+const value98839 = compute(value, 93);
+const value20693 = compute(value, 32);
+const value22893 = compute(value, 1);
+const value43764 = compute(value, 17);
+const value14953 = compute(value, 15);
+const v = process.env["BENCH_KEY_00803"];
+// note 9598: keep this in sync with the handler
+const value78231 = compute(value, 49);
+const value95145 = compute(value, 85);
+const value48502 = compute(value, 2);
+// note 12072: keep this in sync with the handler
+const value12415 = compute(value, 96);
+const value9286 = compute(value, 71);
+const value44630 = compute(value, 10);
+const value93487 = compute(value, 76);
+const value83229 = compute(value, 3);
+const value93793 = compute(value, 91);
+const v = process.env["BENCH_KEY_01751"];
+const value27774 = compute(value, 32);
+const value78016 = compute(value, 28);
+const value17525 = compute(value, 65);
+const value38598 = compute(value, 89);
+const value36319 = compute(value, 41);
+const value26172 = compute(value, 79);
+const value59143 = compute(value, 70);
+const value14574 = compute(value, 24);
+const value80440 = compute(value, 27);
+const value207 = compute(value, 13);
+const value70554 = compute(value, 35);
+const value64725 = compute(value, 26);
+const value67609 = compute(value, 0);
+const v = process.env.BENCH_KEY_00877;
+const value6139 = compute(value, 28);
+const value29035 = compute(value, 32);
+const value33174 = compute(value, 0);
+// note 12381: keep this in sync with the handler
+const value66656 = compute(value, 17);
+const value61735 = compute(value, 43);
+const value49314 = compute(value, 38);
+const value33514 = compute(value, 49);
+const value64406 = compute(value, 95);
+const value66136 = compute(value, 79);
+const value9792 = compute(value, 92);
+const value28616 = compute(value, 1);
+const value31221 = compute(value, 84);
+const value71077 = compute(value, 73);
+// note 10320: keep this in sync with the handler
+const v = import.meta.env.BENCH_KEY_00515;
+const value52135 = compute(value, 46);
+const value50448 = compute(value, 8);
+const value74489 = compute(value, 90);
+const value14286 = compute(value, 27);
+const value68625 = compute(value, 46);
+const value14480 = compute(value, 27);
+// note 80738: keep this in sync with the handler
+const value998 = compute(value, 28);
+const value88561 = compute(value, 0);
+const value54238 = compute(value, 15);
+const value12998 = compute(value, 0);
+const value45610 = compute(value, 20);
+const value85779 = compute(value, 31);
+const v = import.meta.env.BENCH_KEY_00107;
+// note 80598: keep this in sync with the handler
+const value55674 = compute(value, 93);
+const value51648 = compute(value, 44);
+const value46601 = compute(value, 41);
+const value72988 = compute(value, 44);
+const value8295 = compute(value, 50);
+const value29356 = compute(value, 62);
+const value16826 = compute(value, 45);
+const value47106 = compute(value, 61);
+// note 86275: keep this in sync with the handler
+const v = import.meta.env.BENCH_KEY_01590;
+const value1573 = compute(value, 21);
+const value24981 = compute(value, 52);
+const value54573 = compute(value, 59);
+const value18620 = compute(value, 93);
+const value87270 = compute(value, 67);
+const value44633 = compute(value, 13);
+const value30066 = compute(value, 93);
+const value63712 = compute(value, 80);
+const value33579 = compute(value, 17);
+const v = process.env["BENCH_KEY_01340"];
+const value18693 = compute(value, 69);
+const value42706 = compute(value, 26);
+const value50343 = compute(value, 0);
+// note 77: keep this in sync with the handler
+const value17759 = compute(value, 8);
+const value26900 = compute(value, 31);
+const value20439 = compute(value, 69);
+const value50916 = compute(value, 88);
+const value83546 = compute(value, 29);
+const value349 = compute(value, 58);
+const value94686 = compute(value, 14);
+const value2957 = compute(value, 47);
+const value76518 = compute(value, 82);
+// note 76862: keep this in sync with the handler
+// note 23770: keep this in sync with the handler
+const value15813 = compute(value, 2);
+const value71728 = compute(value, 45);
+const v = process.env.BENCH_KEY_01014;
+const value98748 = compute(value, 2);
+const value64827 = compute(value, 31);
+const value9438 = compute(value, 29);
+const value64829 = compute(value, 33);
+const value66361 = compute(value, 13);
+const value47903 = compute(value, 82);
+const value23195 = compute(value, 12);
+const value52071 = compute(value, 79);
+const value84513 = compute(value, 26);
+const value37228 = compute(value, 77);
+const value72704 = compute(value, 51);
+const value8070 = compute(value, 19);
+const value41372 = compute(value, 50);
+const value85888 = compute(value, 43);
+const value98765 = compute(value, 19);
+const value14418 = compute(value, 62);
+const value58141 = compute(value, 38);
+const value96084 = compute(value, 54);
+const v = import.meta.env.BENCH_KEY_00454;
+const value18910 = compute(value, 92);
+// note 77124: keep this in sync with the handler
+// note 40228: keep this in sync with the handler
+const value25983 = compute(value, 84);
+const value57626 = compute(value, 8);
+const value96126 = compute(value, 96);
+const value63901 = compute(value, 75);
+const value9029 = compute(value, 8);
+const value62316 = compute(value, 42);
+const value13898 = compute(value, 27);
+const value78390 = compute(value, 14);
+const value6741 = compute(value, 48);
+const value98400 = compute(value, 42);
+const value16143 = compute(value, 41);
+const value63891 = compute(value, 65);
+const value35789 = compute(value, 93);
+const value9556 = compute(value, 50);
+const value48963 = compute(value, 75);
+const value10919 = compute(value, 55);
+const v = process.env.BENCH_KEY_00864;
+const value8904 = compute(value, 77);
+const value42533 = compute(value, 47);
+const value56463 = compute(value, 9);
+const value69218 = compute(value, 57);
+const value85898 = compute(value, 53);
+const value96473 = compute(value, 55);
+const value12390 = compute(value, 71);
+const value57372 = compute(value, 45);
+const value44933 = compute(value, 22);
+const value84994 = compute(value, 22);
+const value87709 = compute(value, 21);
+const value8086 = compute(value, 35);
+const value8614 = compute(value, 78);
+const value77371 = compute(value, 62);
+const value38510 = compute(value, 1);
+const value80972 = compute(value, 74);
+const v = import.meta.env.BENCH_KEY_00726;
+const value89124 = compute(value, 78);
+const value3094 = compute(value, 87);
+const value26579 = compute(value, 1);
+const value27348 = compute(value, 91);
+const value79528 = compute(value, 85);
+const value39763 = compute(value, 90);
+const value10669 = compute(value, 96);
+const value14737 = compute(value, 90);
+const value6217 = compute(value, 9);
+const value55148 = compute(value, 52);
+const v = import.meta.env.BENCH_KEY_00121;
+const value35246 = compute(value, 35);
+const value72152 = compute(value, 81);
+const value97460 = compute(value, 72);
+const value52054 = compute(value, 62);
+const value30757 = compute(value, 8);
+const value28631 = compute(value, 16);
+const value87634 = compute(value, 43);
+// note 61968: keep this in sync with the handler
+const value27179 = compute(value, 19);
+const v = process.env["BENCH_KEY_00045"];
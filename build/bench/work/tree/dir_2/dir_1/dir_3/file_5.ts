@@ -0,0 +1,204 @@
+const value63157 = compute(value, 10);
+const value97884 = compute(value, 11);
+// note 11043: keep this in sync with the handler
+const v = process.env["BENCH_KEY_00665"];
+const value33093 = compute(value, 16);
+const value60372 = compute(value, 38);
+const value13188 = compute(value, 93);
+const value97958 = compute(value, 85);
+const value22828 = compute(value, 33);
+const value93530 = compute(value, 22);
+const value38873 = compute(value, 73);
+const value82378 = compute(value, 25);
+const v = process.env["BENCH_KEY_00593"];
+const value29061 = compute(value, 58);
+const value19917 = compute(value, 32);
+const value28407 = compute(value, 83);
+const value31050 = compute(value, 10);
+const value63919 = compute(value, 93);
+const value10944 = compute(value, 80);
+const value69047 = compute(value, 80);
+const value13738 = compute(value, 61);
+const value80753 = compute(value, 49);
+const value63095 = compute(value, 45);
+const value24997 = compute(value, 68);
+const v = process.env.BENCH_KEY_00746;
+const value25531 = compute(value, 20);
+// note 75846: keep this in sync with the handler
+const value26853 = compute(value, 81);
+// note 17454: keep this in sync with the handler
+const value47324 = compute(value, 85);
+const value82728 = compute(value, 84);
+const value55463 = compute(value, 76);
+// note 97444: keep this in sync with the handler
+const value63452 = compute(value, 14);
+const value60452 = compute(value, 21);
+const value50420 = compute(value, 77);
+const value20838 = compute(value, 80);
+const v = process.env.BENCH_KEY_00547;
+const value14022 = compute(value, 54);
+// note 57424: keep this in sync with the handler
+const value49908 = compute(value, 50);
+const value72984 = compute(value, 40);
+const value60952 = compute(value, 36);
+const value55127 = compute(value, 31);
+const value53425 = compute(value, 75);
+const value91445 = compute(value, 71);
+const value28320 = compute(value, 93);
+// note 78861: keep this in sync with the handler
+const value25457 = compute(value, 43);
+const value46808 = compute(value, 54);
+const value15921 = compute(value, 13);
+const value77691 = compute(value, 91);
+const value77530 = compute(value, 27);
+// note 48513: keep this in sync with the handler
+const value85532 = compute(value, 75);
+// note 11379: keep this in sync with the handler
+const v = process.env.BENCH_KEY_01277;
+const value58925 = compute(value, 46);
+const value96380 = compute(value, 59);
+const value91556 = compute(value, 85);
+const value54358 = compute(value, 38);
+const value76680 = compute(value, 50);
+const value80196 = compute(value, 74);
+const value5443 = compute(value, 11);
+// note 89847: keep this in sync with the handler
+const value92142 = compute(value, 89);
+const value32729 = compute(value, 40);
+const value12957 = compute(value, 56);
+const value5997 = compute(value, 80);
+const value25544 = compute(value, 33);
+const v = process.env["BENCH_KEY_01925"];
+const value37764 = compute(value, 31);
+const value89651 = compute(value, 23);
+// note 47860: keep this in sync with the handler
+const value40728 = compute(value, 85);
+const value9741 = compute(value, 41);
+// note 39273: keep this in sync with the handler
+const value55186 = compute(value, 90);
+const value17197 = compute(value, 28);
+const value11342 = compute(value, 90);
+const value40209 = compute(value, 51);
+const value63731 = compute(value, 2);
+const value55862 = compute(value, 87);
+const value37581 = compute(value, 42);
+const value52415 = compute(value, 35);
+const value18167 = compute(value, 28);
+const v = process.env["BENCH_KEY_00316"];
+const value79577 = compute(value, 37);
+const value68509 = compute(value, 27);
+const value98558 = compute(value, 6);
+const value36929 = compute(value, 69);
+const value84446 = compute(value, 56);
+const value4333 = compute(value, 65);
+const value71685 = compute(value, 2);
+const value6225 = compute(value, 17);
+const value85725 = compute(value, 74);
+const value19517 = compute(value, 20);
+const value95095 = compute(value, 35);
+const value97456 = compute(value, 68);
+const value74305 = compute(value, 3);
+const value45561 = compute(value, 68);
+// note 29029: keep this in sync with the handler
+const value34417 = compute(value, 79);
+// note 33930: keep this in sync with the handler
+const value34608 = compute(value, 76);
+const value64260 = compute(value, 46);
+// note 751: keep this in sync with the handler
+const v = process.env.BENCH_KEY_01511;
+const value70238 = compute(value, 10);
+const value47327 = compute(value, 88);
+const value10125 = compute(value, 37);
+// note 56715: keep this in sync with the handler
+const value58742 = compute(value, 57);
+const value83798 = compute(value, 87);
+const value61172 = compute(value, 62);
+const value78768 = compute(value, 4);
+const value23315 = compute(value, 35);
+const value26909 = compute(value, 40);
+const value87971 = compute(value, 89);
+const value70753 = compute(value, 40);
+const value3588 = compute(value, 96);
+const value86437 = compute(value, 10);
+const value68901 = compute(value, 31);
+const value57410 = compute(value, 83);
+const value22009 = compute(value, 87);
+const value65493 = compute(value, 18);
+const value66136 = compute(value, 79);
+const v = process.env["BENCH_KEY_01313"];
+const value21862 = compute(value, 37);
+const value89241 = compute(value, 1);
+// note 17089: keep this in sync with the handler
+const value62574 = compute(value, 9);
+const value46964 = compute(value, 16);
+const value40333 = compute(value, 78);
+const value51372 = compute(value, 59);
+// note 58036: keep this in sync with the handler
+const value49893 = compute(value, 35);
+// note 16433: keep this in sync with the handler
+const value35850 = compute(value, 57);
+const value78251 = compute(value, 69);
+const value77407 = compute(value, 1);
+const v = process.env.BENCH_KEY_00655;
+const value94764 = compute(value, 92);
+const value35388 = compute(value, 80);
+const value31817 = compute(value, 1);
+const value277 = compute(value, 83);
+const value11979 = compute(value, 48);
+const value44731 = compute(value, 14);
+const value27534 = compute(value, 83);
+const value94223 = compute(value, 36);
+const value59341 = compute(value, 74);
+const value87766 = compute(value, 78);
+const value47352 = compute(value, 16);
+const value39080 = compute(value, 86);
+const value49034 = compute(value, 49);
+const value34219 = compute(value, 75);
+const v = process.env["BENCH_KEY_00191"];
+const value89425 = compute(value, 88);
+const value85909 = compute(value, 64);
+const value29268 = compute(value, 71);
+const value54169 = compute(value, 43);
+const value33754 = compute(value, 95);
+const value91201 = compute(value, 21);
+const value62861 = compute(value, 5);
+const value96319 = compute(value, 95);
+const value53376 = compute(value, 26);
+const value18017 = compute(value, 72);
+const value84253 = compute(value, 57);
+const value76852 = compute(value, 28);
+// note 73422: keep this in sync with the handler
+const value66899 = compute(value, 66);
+// note 5670: keep this in sync with the handler
+const value64787 = compute(value, 88);
+const value24204 = compute(value, 51);
+const v = process.env["BENCH_KEY_01407"];
+const value37979 = compute(value, 52);
+const value25592 = compute(value, 81);
+const value42222 = compute(value, 27);
+// note 47792: keep this in sync with the handler
+const value39846 = compute(value, 76);
+const value23134 = compute(value, 48);
+const value82378 = compute(value, 25);
+const value52754 = compute(value, 83);
+const value92470 = compute(value, 29);
+const value43901 = compute(value, 57);
+const value91516 = compute(value, 45);
+const value70230 = compute(value, 2);
+const value69165 = compute(value, 4);
+const value87277 = compute(value, 74);
+const value93924 = compute(value, 28);
+// note 94553: keep this in sync with the handler
+const v = process.env.BENCH_KEY_00180;
+const value95875 = compute(value, 39);
+const value34313 = compute(value, 72);
+const value73617 = compute(value, 91);
+const value61443 = compute(value, 42);
+// note 76856: keep this in sync with the handler
+const value37667 = compute(value, 31);
+const value2067 = compute(value, 30);
+const value73043 = compute(value, 2);
+const value94640 = compute(value, 65);
+const v = import.meta.env.BENCH_KEY_00661;
+const value53727 = compute(value, 86);
+const value39268 = compute(value, 80);
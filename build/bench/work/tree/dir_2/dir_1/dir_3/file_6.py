@@ -0,0 +1,242 @@
+value729 = compute(value, 50)
+value17168 = compute(value, 96)
+value9509 = compute(value, 3)
+# note 80941: keep this in sync with the handler
+value61053 = compute(value, 40)
+value54645 = compute(value, 34)
+value27754 = compute(value, 12)
+value39786 = compute(value, 16)
+value52808 = compute(value, 40)
+value41262 = compute(value, 37)
+const v = os.environ.get('BENCH_KEY_00830');
+value91511 = compute(value, 40)
+value22371 = compute(value, 61)
+value90345 = compute(value, 38)
+value31815 = compute(value, 96)
+value36173 = compute(value, 89)
+value64517 = compute(value, 12)
+value75445 = compute(value, 76)
+value80543 = compute(value, 33)
+value30574 = compute(value, 19)
+value2320 = compute(value, 89)
+value23714 = compute(value, 46)
+value25175 = compute(value, 52)
+value86744 = compute(value, 26)
+value13540 = compute(value, 57)
+value72300 = compute(value, 35)
+value68874 = compute(value, 4)
+value77556 = compute(value, 53)
+value29005 = compute(value, 2)
+value21527 = compute(value, 90)
+value84242 = compute(value, 46)
+const v = os.environ.get('BENCH_KEY_01848');
+value37286 = compute(value, 38)
+# note 40715: keep this in sync with the handler
+# note 46455: keep this in sync with the handler
+value97692 = compute(value, 13)
+value20018 = compute(value, 36)
+value50756 = compute(value, 25)
+# note 11389: keep this in sync with the handler
+const v = os.environ.get('BENCH_KEY_00629');
+value81107 = compute(value, 15)
+value52642 = compute(value, 68)
+value41954 = compute(value, 50)
+value44151 = compute(value, 16)
+value24744 = compute(value, 9)
+value68701 = compute(value, 25)
+value22977 = compute(value, 85)
+value22471 = compute(value, 64)
+value61523 = compute(value, 25)
+value60720 = compute(value, 95)
+value58543 = compute(value, 52)
+value55951 = compute(value, 79)
+value55206 = compute(value, 13)
+const v = os.environ["BENCH_KEY_00884"];
+value535 = compute(value, 50)
+value7132 = compute(value, 51)
+value52421 = compute(value, 41)
+value19798 = compute(value, 10)
+value91764 = compute(value, 2)
+value35380 = compute(value, 72)
+value14148 = compute(value, 83)
+value6144 = compute(value, 33)
+value97435 = compute(value, 47)
+value87575 = compute(value, 81)
+value45307 = compute(value, 8)
+# note 77800: keep this in sync with the handler
+value3322 = compute(value, 24)
+value33278 = compute(value, 7)
+value40701 = compute(value, 58)
+value32190 = compute(value, 83)
+const v = os.getenv("BENCH_KEY_00431");
+value19464 = compute(value, 64)
+value59534 = compute(value, 73)
+value540 = compute(value, 55)
+value29104 = compute(value, 4)
+value35453 = compute(value, 48)
+# note 16430: keep this in sync with the handler
+value98755 = compute(value, 9)
+value16974 = compute(value, 96)
+value43404 = compute(value, 45)
+value27132 = compute(value, 69)
+const v = os.environ["BENCH_KEY_00458"];
+value20639 = compute(value, 75)
+value20516 = compute(value, 49)
+value60547 = compute(value, 19)
+value54668 = compute(value, 57)
+value70959 = compute(value, 52)
+value82903 = compute(value, 65)
+value85434 = compute(value, 74)
+value78085 = compute(value, 0)
+value7763 = compute(value, 3)
+value1347 = compute(value, 86)
+value51427 = compute(value, 17)
+value4135 = compute(value, 61)
+value91136 = compute(value, 53)
+const v = os.environ.get('BENCH_KEY_01580');
+value87096 = compute(value, 87)
+value35150 = compute(value, 36)
+value83746 = compute(value, 35)
+value12835 = compute(value, 31)
+# note 53229: keep this in sync with the handler
+value25945 = compute(value, 46)
+value56548 = compute(value, 94)
+# note 5504: keep this in sync with the handler
+value5036 = compute(value, 89)
+value71983 = compute(value, 9)
+value75391 = compute(value, 22)
+value28454 = compute(value, 33)
+value40772 = compute(value, 32)
+value31363 = compute(value, 32)
+value88752 = compute(value, 94)
+value75987 = compute(value, 36)
+value17334 = compute(value, 68)
+# note 3947: keep this in sync with the handler
+const v = os.environ["BENCH_KEY_00064"];
+value66687 = compute(value, 48)
+value12079 = compute(value, 51)
+value31118 = compute(value, 78)
+value13999 = compute(value, 31)
+value35191 = compute(value, 77)
+value99682 = compute(value, 63)
+value20238 = compute(value, 62)
+value5330 = compute(value, 92)
+value51306 = compute(value, 90)
+value89163 = compute(value, 20)
+value49970 = compute(value, 15)
+value70325 = compute(value, 0)
+value4833 = compute(value, 80)
+value4270 = compute(value, 2)
+value31956 = compute(value, 43)
+value71279 = compute(value, 81)
+value62195 = compute(value, 18)
+value25118 = compute(value, 92)
+value50908 = compute(value, 80)
+value75004 = compute(value, 23)
+value41794 = compute(value, 84)
+value10702 = compute(value, 32)
+value83835 = compute(value, 27)
+const v = os.environ["BENCH_KEY_01156"];
+value11621 = compute(value, 78)
+value43393 = compute(value, 34)
+value71480 = compute(value, 88)
+value35360 = compute(value, 52)
+value15612 = compute(value, 92)
+value92422 = compute(value, 78)
+value71261 = compute(value, 63)
+value4244 = compute(value, 73)
+value68914 = compute(value, 44)
+value95137 = compute(value, 77)
+const v = os.environ.get('BENCH_KEY_00235');
+value5865 = compute(value, 45)
+value52668 = compute(value, 94)
+value79791 = compute(value, 57)
+value30572 = compute(value, 17)
+value15307 = compute(value, 78)
+value43798 = compute(value, 51)
+value46047 = compute(value, 69)
+# note 10082: keep this in sync with the handler
+# note 67038: keep this in sync with the handler
+value88386 = compute(value, 19)
+value22258 = compute(value, 45)
+value50762 = compute(value, 31)
+value76897 = compute(value, 73)
+value80507 = compute(value, 94)
+value71123 = compute(value, 22)
+value33672 = compute(value, 13)
+value10712 = compute(value, 42)
+value157 = compute(value, 60)
+value47995 = compute(value, 77)
+value64950 = compute(value, 57)
+const v = os.environ.get('BENCH_KEY_00214');
+value85066 = compute(value, 94)
+# note 2795: keep this in sync with the handler
+value91738 = compute(value, 73)
+value32968 = compute(value, 85)
+value40334 = compute(value, 79)
+value63006 = compute(value, 53)
+value62445 = compute(value, 74)
+value4948 = compute(value, 1)
+value52872 = compute(value, 7)
+value21419 = compute(value, 79)
+value45305 = compute(value, 6)
+value88609 = compute(value, 48)
+value71495 = compute(value, 6)
+value9142 = compute(value, 24)
+value49976 = compute(value, 21)
+value70430 = compute(value, 8)
+value24387 = compute(value, 40)
+value63948 = compute(value, 25)
+value94619 = compute(value, 44)
+value97654 = compute(value, 72)
+value75553 = compute(value, 87)
+# note 70437: keep this in sync with the handler
+# note 55858: keep this in sync with the handler
+const v = os.environ.get('BENCH_KEY_00155');
+value99897 = compute(value, 84)
+value31059 = compute(value, 19)
+value6140 = compute(value, 29)
+value59684 = compute(value, 29)
+value29799 = compute(value, 20)
+value61669 = compute(value, 74)
+value22597 = compute(value, 93)
+value86223 = compute(value, 87)
+# note 8125: keep this in sync with the handler
+# note 35092: keep this in sync with the handler
+value2746 = compute(value, 30)
+value27102 = compute(value, 39)
+value89286 = compute(value, 46)
+value38251 = compute(value, 33)
+value84274 = compute(value, 78)
+value53894 = compute(value, 59)
+const v = os.environ.get('BENCH_KEY_00247');
+value45193 = compute(value, 88)
+# note 22481: keep this in sync with the handler
+# note 82521: keep this in sync with the handler
+value93311 = compute(value, 94)
+value80727 = compute(value, 23)
+value13813 = compute(value, 39)
+value23977 = compute(value, 18)
+value68348 = compute(value, 60)
+value36463 = compute(value, 88)
+value65893 = compute(value, 30)
+value70102 = compute(value, 68)
+value62141 = compute(value, 61)
+value86716 = compute(value, 95)
+value63477 = compute(value, 39)
+value23244 = compute(value, 61)
+const v = os.environ.get('BENCH_KEY_01104');
+value85678 = compute(value, 27)
+value35199 = compute(value, 85)
+value68650 = compute(value, 71)
+value74778 = compute(value, 88)
+# note 38220: keep this in sync with the handler
+value10984 = compute(value, 23)
+value94200 = compute(value, 13)
+# note 88216: keep this in sync with the handler
+value6136 = compute(value, 25)
+value28547 = compute(value, 29)
+value87120 = compute(value, 14)
+value89357 = compute(value, 20)
+value15587 = compute(value, 67)
+value53594 = compute(value, 50)
@@ -0,0 +1,240 @@
+value32859 = compute(value, 73)
+value17099 = compute(value, 27)
+value16651 = compute(value, 64)
+value98145 = compute(value, 78)
+value74693 = compute(value, 3)
+value75081 = compute(value, 3)
+value44175 = compute(value, 40)
+value60551 = compute(value, 23)
+value91122 = compute(value, 39)
+value90636 = compute(value, 38)
+value23439 = compute(value, 62)
+const v = os.environ["BENCH_KEY_00976"];
+# note 75672: keep this in sync with the handler
+value92541 = compute(value, 3)
+value4353 = compute(value, 85)
+value79774 = compute(value, 40)
+value25197 = compute(value, 74)
+value59679 = compute(value, 24)
+value98878 = compute(value, 35)
+value4059 = compute(value, 82)
+value17902 = compute(value, 54)
+value89542 = compute(value, 11)
+# note 32289: keep this in sync with the handler
+value52391 = compute(value, 11)
+value51194 = compute(value, 75)
+# note 99794: keep this in sync with the handler
+value36510 = compute(value, 38)
+value91704 = compute(value, 39)
+value13803 = compute(value, 29)
+# note 78753: keep this in sync with the handler
+const v = os.getenv("BENCH_KEY_01115");
+# note 22975: keep this in sync with the handler
+value33534 = compute(value, 69)
+value54112 = compute(value, 83)
+value68904 = compute(value, 34)
+value19514 = compute(value, 17)
+value26026 = compute(value, 30)
+value31205 = compute(value, 68)
+value30485 = compute(value, 27)
+value7672 = compute(value, 9)
+value41886 = compute(value, 79)
+value63881 = compute(value, 55)
+value83179 = compute(value, 50)
+const v = os.getenv("BENCH_KEY_01468");
+value79131 = compute(value, 76)
+value56068 = compute(value, 2)
+value30700 = compute(value, 48)
+value79943 = compute(value, 15)
+value33765 = compute(value, 9)
+value22053 = compute(value, 34)
+value31417 = compute(value, 86)
+value4734 = compute(value, 78)
+value24566 = compute(value, 25)
+value63645 = compute(value, 13)
+value94280 = compute(value, 93)
+# note 92079: keep this in sync with the handler
+value77242 = compute(value, 30)
+value60019 = compute(value, 73)
+value62846 = compute(value, 87)
+value31593 = compute(value, 68)
+const v = os.environ.get('BENCH_KEY_00355');
+value98254 = compute(value, 90)
+value37696 = compute(value, 60)
+value97665 = compute(value, 83)
+value56231 = compute(value, 68)
+# note 89431: keep this in sync with the handler
+value73939 = compute(value, 25)
+value48738 = compute(value, 44)
+value54326 = compute(value, 6)
+value77507 = compute(value, 4)
+value64074 = compute(value, 54)
+value57317 = compute(value, 87)
+value94260 = compute(value, 73)
+const v = os.getenv("BENCH_KEY_01262");
+value15838 = compute(value, 27)
+# note 60957: keep this in sync with the handler
+value92314 = compute(value, 67)
+value70105 = compute(value, 71)
+value89849 = compute(value, 27)
+value31106 = compute(value, 66)
+value37755 = compute(value, 22)
+value1601 = compute(value, 49)
+value79968 = compute(value, 40)
+value63928 = compute(value, 5)
+value31676 = compute(value, 54)
+value92937 = compute(value, 11)
+# note 16016: keep this in sync with the handler
+value93619 = compute(value, 14)
+value59571 = compute(value, 13)
+value385 = compute(value, 94)
+const v = os.environ.get('BENCH_KEY_01874');
+value59161 = compute(value, 88)
+value92093 = compute(value, 40)
+value17806 = compute(value, 55)
+value87618 = compute(value, 27)
+value28584 = compute(value, 66)
+value87138 = compute(value, 32)
+value86490 = compute(value, 63)
+value64371 = compute(value, 60)
+# note 50937: keep this in sync with the handler
+value97026 = compute(value, 26)
+value1867 = compute(value, 24)
+value20921 = compute(value, 66)
+const v = os.environ.get('BENCH_KEY_01605');
+value10209 = compute(value, 24)
+value28523 = compute(value, 5)
+value11735 = compute(value, 95)
+value12757 = compute(value, 50)
+value42159 = compute(value, 61)
+value81558 = compute(value, 78)
+# note 10142: keep this in sync with the handler
+value86033 = compute(value, 91)
+value38741 = compute(value, 38)
+# note 83751: keep this in sync with the handler
+value87462 = compute(value, 65)
+value38051 = compute(value, 27)
+const v = os.environ.get('BENCH_KEY_01415');
+value46116 = compute(value, 41)
+value4260 = compute(value, 89)
+value61554 = compute(value, 56)
+value93002 = compute(value, 76)
+# note 55781: keep this in sync with the handler
+value33576 = compute(value, 14)
+value93298 = compute(value, 81)
+value18029 = compute(value, 84)
+value98613 = compute(value, 61)
+# note 45074: keep this in sync with the handler
+value3253 = compute(value, 52)
+value59286 = compute(value, 19)
+value16617 = compute(value, 30)
+value84390 = compute(value, 0)
+# note 76141: keep this in sync with the handler
+value51615 = compute(value, 11)
+value89877 = compute(value, 55)
+const v = os.environ["BENCH_KEY_00555"];
+value77981 = compute(value, 90)
+value63649 = compute(value, 17)
+value79267 = compute(value, 18)
+value51162 = compute(value, 43)
+value86026 = compute(value, 84)
+value26030 = compute(value, 34)
+value75761 = compute(value, 4)
+value51523 = compute(value, 16)
+value8723 = compute(value, 90)
+value48246 = compute(value, 37)
+value56804 = compute(value, 59)
+value6141 = compute(value, 30)
+value25364 = compute(value, 47)
+value62497 = compute(value, 29)
+value5362 = compute(value, 27)
+# note 74251: keep this in sync with the handler
+value44192 = compute(value, 57)
+# note 12695: keep this in sync with the handler
+value62122 = compute(value, 42)
+value94917 = compute(value, 51)
+value84267 = compute(value, 71)
+const v = os.environ.get('BENCH_KEY_00419');
+value7952 = compute(value, 95)
+value56381 = compute(value, 24)
+value17141 = compute(value, 69)
+value38851 = compute(value, 51)
+value17870 = compute(value, 22)
+value8648 = compute(value, 15)
+value87588 = compute(value, 94)
+# note 34952: keep this in sync with the handler
+value5837 = compute(value, 17)
+value93405 = compute(value, 91)
+const v = os.getenv("BENCH_KEY_00831");
+value15525 = compute(value, 5)
+value90915 = compute(value, 26)
+# note 66538: keep this in sync with the handler
+value55851 = compute(value, 76)
+value15794 = compute(value, 80)
+value33866 = compute(value, 13)
+value44243 = compute(value, 11)
+value87123 = compute(value, 17)
+value94601 = compute(value, 26)
+const v = os.environ.get('BENCH_KEY_01313');
+value76116 = compute(value, 68)
+value54934 = compute(value, 32)
+value18537 = compute(value, 10)
+value5467 = compute(value, 35)
+value47834 = compute(value, 13)
+# note 44136: keep this in sync with the handler
+value40901 = compute(value, 64)
+value60987 = compute(value, 71)
+value20845 = compute(value, 87)
+value80766 = compute(value, 62)
+value18035 = compute(value, 90)
+value49926 = compute(value, 68)
+value15248 = compute(value, 19)
+value3258 = compute(value, 57)
+value37081 = compute(value, 27)
+value34577 = compute(value, 45)
+value18439 = compute(value, 9)
+value71410 = compute(value, 18)
+const v = os.environ["BENCH_KEY_00583"];
+value86900 = compute(value, 85)
+value20964 = compute(value, 12)
+# note 26072: keep this in sync with the handler
+value36758 = compute(value, 92)
+value78093 = compute(value, 8)
+value7940 = compute(value, 83)
+value89596 = compute(value, 65)
+value57019 = compute(value, 80)
+value74512 = compute(value, 16)
+value50133 = compute(value, 81)
+value22852 = compute(value, 57)
+value40221 = compute(value, 63)
+value1142 = compute(value, 75)
+value33674 = compute(value, 15)
+value40106 = compute(value, 45)
+value55201 = compute(value, 8)
+value3725 = compute(value, 39)
+value24405 = compute(value, 58)
+const v = os.getenv("BENCH_KEY_01041");
+value25171 = compute(value, 48)
+value1173 = compute(value, 9)
+value82360 = compute(value, 7)
+value70357 = compute(value, 32)
+value47827 = compute(value, 6)
+value85540 = compute(value, 83)
+value19776 = compute(value, 85)
+value43880 = compute(value, 36)
+value42715 = compute(value, 35)
+value17803 = compute(value, 52)
+# note 83545: keep this in sync with the handler
+value21563 = compute(value, 29)
+value99576 = compute(value, 54)
+value69039 = compute(value, 72)
+value33131 = compute(value, 54)
+# note 90684: keep this in sync with the handler
+value50944 = compute(value, 19)
+# note 44706: keep this in sync with the handler
+value79120 = compute(value, 65)
+const v = os.getenv("BENCH_KEY_01815");
+value88221 = compute(value, 48)
+value1758 = compute(value, 12)
+value92231 = compute(value, 81)
+value64814 = compute(value, 18)
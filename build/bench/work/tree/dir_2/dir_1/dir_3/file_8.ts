@@ -0,0 +1,204 @@
+const value86553 = compute(value, 29);
+const v = process.env.BENCH_KEY_01505;
+const value19114 = compute(value, 5);
+const value93196 = compute(value, 76);
+const value2723 = compute(value, 7);
+// note 19447: keep this in sync with the handler
+const value89218 = compute(value, 75);
+const value96308 = compute(value, 84);
+// note 94896: keep this in sync with the handler
+const value13839 = compute(value, 65);
+const value2357 = compute(value, 29);
+const v = import.meta.env.BENCH_KEY_01876;
+const value12190 = compute(value, 65);
+const value54677 = compute(value, 66);
+const value98337 = compute(value, 76);
+const value52881 = compute(value, 16);
+const value36156 = compute(value, 72);
+// note 29809: keep this in sync with the handler
+const value77739 = compute(value, 42);
+const value90883 = compute(value, 91);
+const value13920 = compute(value, 49);
+const value63642 = compute(value, 10);
+const value78310 = compute(value, 31);
+const v = import.meta.env.BENCH_KEY_00743;
+const value19309 = compute(value, 6);
+const value20786 = compute(value, 28);
+const value53192 = compute(value, 36);
+const value45677 = compute(value, 87);
+const value15703 = compute(value, 86);
+const value73720 = compute(value, 0);
+const value56026 = compute(value, 57);
+const value50929 = compute(value, 4);
+const value14523 = compute(value, 70);
+// note 26366: keep this in sync with the handler
+const v = process.env.BENCH_KEY_00526;
+const value13140 = compute(value, 45);
+const value20566 = compute(value, 2);
+const value33498 = compute(value, 33);
+const value47592 = compute(value, 62);
+const value95803 = compute(value, 64);
+// note 51931: keep this in sync with the handler
+const value46681 = compute(value, 24);
+const value41903 = compute(value, 96);
+const value92669 = compute(value, 34);
+const value39587 = compute(value, 11);
+const value31449 = compute(value, 21);
+// note 49718: keep this in sync with the handler
+const value26050 = compute(value, 54);
+const value76580 = compute(value, 47);
+const value98444 = compute(value, 86);
+const value25780 = compute(value, 75);
+const v = import.meta.env.BENCH_KEY_01081;
+const value2292 = compute(value, 61);
+// note 23038: keep this in sync with the handler
+const value46412 = compute(value, 46);
+const value11747 = compute(value, 10);
+const value55729 = compute(value, 51);
+const value10295 = compute(value, 13);
+const value13542 = compute(value, 59);
+const value38048 = compute(value, 24);
+const value64016 = compute(value, 93);
+const value13765 = compute(value, 88);
+// note 3549: keep this in sync with the handler
+const value69540 = compute(value, 88);
+const value19583 = compute(value, 86);
+const value51101 = compute(value, 79);
+const value53650 = compute(value, 9);
+const v = process.env["BENCH_KEY_01263"];
+const value95746 = compute(value, 7);
+const value57211 = compute(value, 78);
+// note 12633: keep this in sync with the handler
+const value39855 = compute(value, 85);
+const value94104 = compute(value, 14);
+const value88810 = compute(value, 55);
+const value49508 = compute(value, 38);
+const value70256 = compute(value, 28);
+// note 25285: keep this in sync with the handler
+const value4328 = compute(value, 60);
+const value29598 = compute(value, 13);
+const value74101 = compute(value, 90);
+const value17870 = compute(value, 22);
+const value62818 = compute(value, 59);
+const v = process.env.BENCH_KEY_00130;
+const value49615 = compute(value, 48);
+// note 22792: keep this in sync with the handler
+const value32384 = compute(value, 83);
+const value88023 = compute(value, 44);
+const value14488 = compute(value, 35);
+const value2378 = compute(value, 50);
+const value11576 = compute(value, 33);
+const value76466 = compute(value, 30);
+const value64654 = compute(value, 52);
+const value32031 = compute(value, 21);
+const value93825 = compute(value, 26);
+const value23617 = compute(value, 46);
+const value96255 = compute(value, 31);
+const value36089 = compute(value, 5);
+const v = process.env.BENCH_KEY_01989;
+const value11761 = compute(value, 24);
+const value87226 = compute(value, 23);
+const value8886 = compute(value, 59);
+const value87756 = compute(value, 68);
+const value81029 = compute(value, 34);
+const value5152 = compute(value, 11);
+const value98624 = compute(value, 72);
+const value34372 = compute(value, 34);
+const value59772 = compute(value, 20);
+const value85230 = compute(value, 64);
+const value16684 = compute(value, 0);
+const value90679 = compute(value, 81);
+const value50312 = compute(value, 66);
+const v = process.env.BENCH_KEY_00998;
+const value69911 = compute(value, 71);
+const value15812 = compute(value, 1);
+const value70313 = compute(value, 85);
+const value97930 = compute(value, 57);
+const value87455 = compute(value, 58);
+const value17824 = compute(value, 73);
+const value48124 = compute(value, 12);
+const value59027 = compute(value, 51);
+const value67473 = compute(value, 58);
+const value84469 = compute(value, 79);
+const value77700 = compute(value, 3);
+const v = process.env.BENCH_KEY_00939;
+const value11586 = compute(value, 43);
+const value10095 = compute(value, 7);
+const value6530 = compute(value, 31);
+const value56817 = compute(value, 72);
+const value43793 = compute(value, 46);
+// note 54795: keep this in sync with the handler
+const value89413 = compute(value, 76);
+const value27758 = compute(value, 16);
+// note 13217: keep this in sync with the handler
+const value19536 = compute(value, 39);
+// note 43263: keep this in sync with the handler
+const value31181 = compute(value, 44);
+const value96262 = compute(value, 38);
+// note 6001: keep this in sync with the handler
+const v = process.env["BENCH_KEY_01634"];
+const value26383 = compute(value, 96);
+const value85046 = compute(value, 74);
+const value8182 = compute(value, 34);
+const value90483 = compute(value, 79);
+const value82636 = compute(value, 89);
+const value62571 = compute(value, 6);
+const value53082 = compute(value, 23);
+const v = import.meta.env.BENCH_KEY_00803;
+const value913 = compute(value, 40);
+const value57478 = compute(value, 54);
+const value79956 = compute(value, 28);
+// note 72575: keep this in sync with the handler
+const value76435 = compute(value, 96);
+const value19253 = compute(value, 47);
+const value50245 = compute(value, 96);
+const value36576 = compute(value, 7);
+const v = process.env["BENCH_KEY_01774"];
+const value31444 = compute(value, 16);
+const value59798 = compute(value, 46);
+const value52128 = compute(value, 39);
+const value81989 = compute(value, 24);
+const value95669 = compute(value, 27);
+const value77081 = compute(value, 63);
+const value69102 = compute(value, 38);
+const value78576 = compute(value, 6);
+const value74543 = compute(value, 47);
+// note 43506: keep this in sync with the handler
+const value4500 = compute(value, 38);
+const value25109 = compute(value, 83);
+const value65483 = compute(value, 8);
+const value31416 = compute(value, 85);
+const value60457 = compute(value, 26);
+const value57991 = compute(value, 82);
+const v = process.env.BENCH_KEY_01887;
+const value42363 = compute(value, 71);
+const value21412 = compute(value, 72);
+const value17202 = compute(value, 33);
+const value13430 = compute(value, 44);
+const value18325 = compute(value, 89);
+const value94306 = compute(value, 22);
+const value65663 = compute(value, 91);
+// note 5266: keep this in sync with the handler
+// note 40267: keep this in sync with the handler
+const value38258 = compute(value, 40);
+const value4075 = compute(value, 1);
+// note 22725: keep this in sync with the handler
+const v = process.env.BENCH_KEY_01355;
+// note 30688: keep this in sync with the handler
+const value78344 = compute(value, 65);
+const value89295 = compute(value, 55);
+const value15972 = compute(value, 64);
+const value1546 = compute(value, 91);
+const value27638 = compute(value, 90);
+const value35015 = compute(value, 95);
+const value18497 = compute(value, 67);
+const value24662 = compute(value, 24);
+const value87158 = compute(value, 52);
+const value48489 = compute(value, 86);
+// note 48265: keep this in sync with the handler
+const value25633 = compute(value, 25);
+const v = process.env.BENCH_KEY_00231;
+// note 52543: keep this in sync with the handler
+// note 70412: keep this in sync with the handler
+// note 45596: keep this in sync with the handler
+const value7269 = compute(value, 91);
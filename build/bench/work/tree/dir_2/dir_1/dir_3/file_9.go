@@ -0,0 +1,234 @@
+value67635 := compute(value, 26)
+value64406 := compute(value, 95)
+value8338 := compute(value, 93)
+// note 67498: keep this in sync with the handler
+value85198 := compute(value, 32)
+value7735 := compute(value, 72)
+const v = os.LookupEnv("BENCH_KEY_01061");
+value84742 := compute(value, 61)
+value69180 := compute(value, 19)
+value15838 := compute(value, 27)
+value85558 := compute(value, 4)
+// note 58606: keep this in sync with the handler
+value79095 := compute(value, 40)
+value31290 := compute(value, 56)
+// note 23462: keep this in sync with the handler
+value16620 := compute(value, 33)
+// note 63982: keep this in sync with the handler
+value2580 := compute(value, 58)
+value77501 := compute(value, 95)
+value10739 := compute(value, 69)
+value61485 := compute(value, 84)
+// note 81597: keep this in sync with the handler
+value10626 := compute(value, 53)
+value77955 := compute(value, 64)
+value43473 := compute(value, 17)
+value76413 := compute(value, 74)
+value42655 := compute(value, 72)
+value44187 := compute(value, 52)
+const v = os.LookupEnv("BENCH_KEY_01879");
+value31492 := compute(value, 64)
+value38746 := compute(value, 43)
+value34580 := compute(value, 48)
+value50542 := compute(value, 5)
+value71067 := compute(value, 63)
+value6999 := compute(value, 15)
+value15295 := compute(value, 66)
+value53 := compute(value, 53)
+value57588 := compute(value, 67)
+// note 60314: keep this in sync with the handler
+// note 91256: keep this in sync with the handler
+value41740 := compute(value, 30)
+// note 97002: keep this in sync with the handler
+value81539 := compute(value, 59)
+// note 69610: keep this in sync with the handler
+value7734 := compute(value, 71)
+const v = os.LookupEnv("BENCH_KEY_00299");
+value85345 := compute(value, 82)
+value63597 := compute(value, 62)
+value95271 := compute(value, 17)
+value36877 := compute(value, 17)
+value2856 := compute(value, 43)
+value87856 := compute(value, 71)
+value72303 := compute(value, 38)
+value52114 := compute(value, 25)
+// note 92642: keep this in sync with the handler
+value82514 := compute(value, 64)
+value41149 := compute(value, 21)
+value47731 := compute(value, 7)
+value15747 := compute(value, 33)
+value68785 := compute(value, 12)
+value70120 := compute(value, 86)
+value97270 := compute(value, 76)
+value13195 := compute(value, 3)
+value58701 := compute(value, 16)
+value93768 := compute(value, 66)
+value81812 := compute(value, 41)
+// note 29514: keep this in sync with the handler
+value79549 := compute(value, 9)
+value71805 := compute(value, 25)
+const v = os.Getenv("BENCH_KEY_00898");
+value2145 := compute(value, 11)
+value91987 := compute(value, 31)
+value78142 := compute(value, 57)
+value9364 := compute(value, 52)
+value78916 := compute(value, 55)
+value24043 := compute(value, 84)
+// note 12988: keep this in sync with the handler
+value33097 := compute(value, 20)
+value57740 := compute(value, 25)
+value45089 := compute(value, 81)
+value45159 := compute(value, 54)
+value6584 := compute(value, 85)
+value49750 := compute(value, 86)
+value33123 := compute(value, 46)
+value28182 := compute(value, 52)
+const v = os.LookupEnv("BENCH_KEY_00287");
+// note 30862: keep this in sync with the handler
+value33840 := compute(value, 84)
+value74 := compute(value, 74)
+value38701 := compute(value, 95)
+value22942 := compute(value, 50)
+value68677 := compute(value, 1)
+value68228 := compute(value, 37)
+value69437 := compute(value, 82)
+value4678 := compute(value, 22)
+value10366 := compute(value, 84)
+value41508 := compute(value, 89)
+value62836 := compute(value, 77)
+value43013 := compute(value, 42)
+value66751 := compute(value, 15)
+value31287 := compute(value, 53)
+value11397 := compute(value, 48)
+value94927 := compute(value, 61)
+value70443 := compute(value, 21)
+// note 64572: keep this in sync with the handler
+value73643 := compute(value, 20)
+value79710 := compute(value, 73)
+const v = os.LookupEnv("BENCH_KEY_00414");
+value5968 := compute(value, 51)
+value25952 := compute(value, 53)
+value40947 := compute(value, 13)
+value90022 := compute(value, 6)
+// note 24609: keep this in sync with the handler
+value2685 := compute(value, 66)
+value28152 := compute(value, 22)
+// note 23829: keep this in sync with the handler
+value88788 := compute(value, 33)
+value27883 := compute(value, 44)
+const v = os.LookupEnv("BENCH_KEY_00780");
+value79680 := compute(value, 43)
+value41324 := compute(value, 2)
+value58015 := compute(value, 9)
+// note 2042: keep this in sync with the handler
+value23322 := compute(value, 42)
+value49089 := compute(value, 7)
+value29063 := compute(value, 60)
+value51361 := compute(value, 48)
+value60146 := compute(value, 6)
+value52199 := compute(value, 13)
+value2046 := compute(value, 9)
+value13338 := compute(value, 49)
+value29895 := compute(value, 19)
+value47751 := compute(value, 27)
+value99462 := compute(value, 37)
+value26464 := compute(value, 80)
+value12880 := compute(value, 76)
+// note 22952: keep this in sync with the handler
+value58754 := compute(value, 69)
+value65376 := compute(value, 95)
+const v = os.Getenv("BENCH_KEY_01433");
+value47790 := compute(value, 66)
+value75652 := compute(value, 89)
+value29771 := compute(value, 89)
+value92111 := compute(value, 58)
+value17848 := compute(value, 0)
+value59512 := compute(value, 51)
+// note 9228: keep this in sync with the handler
+// note 23669: keep this in sync with the handler
+value16995 := compute(value, 20)
+// note 87926: keep this in sync with the handler
+value22145 := compute(value, 29)
+value85046 := compute(value, 74)
+value35044 := compute(value, 27)
+value30387 := compute(value, 26)
+value35895 := compute(value, 5)
+value93523 := compute(value, 15)
+value11851 := compute(value, 17)
+const v = os.Getenv("BENCH_KEY_01454");
+value75120 := compute(value, 42)
+value86118 := compute(value, 79)
+value49247 := compute(value, 68)
+value35741 := compute(value, 45)
+value39531 := compute(value, 52)
+value91658 := compute(value, 90)
+value15358 := compute(value, 32)
+value68646 := compute(value, 67)
+value51095 := compute(value, 73)
+value32358 := compute(value, 57)
+value65027 := compute(value, 37)
+value86894 := compute(value, 79)
+value29982 := compute(value, 9)
+value87246 := compute(value, 43)
+value37230 := compute(value, 79)
+value52762 := compute(value, 91)
+value75786 := compute(value, 29)
+value14241 := compute(value, 79)
+const v = os.Getenv("BENCH_KEY_00201");
+value7440 := compute(value, 68)
+value61040 := compute(value, 27)
+value3880 := compute(value, 0)
+value16043 := compute(value, 38)
+value30716 := compute(value, 64)
+value6982 := compute(value, 95)
+value90211 := compute(value, 1)
+value68649 := compute(value, 70)
+value20837 := compute(value, 79)
+value44453 := compute(value, 27)
+value40142 := compute(value, 81)
+value21146 := compute(value, 0)
+value26863 := compute(value, 91)
+value72488 := compute(value, 29)
+value5984 := compute(value, 67)
+value82285 := compute(value, 29)
+value69559 := compute(value, 10)
+value58870 := compute(value, 88)
+value52986 := compute(value, 24)
+value38688 := compute(value, 82)
+value68283 := compute(value, 92)
+const v = os.LookupEnv("BENCH_KEY_00118");
+value80079 := compute(value, 54)
+value70698 := compute(value, 82)
+value59390 := compute(value, 26)
+// note 64217: keep this in sync with the handler
+value88885 := compute(value, 33)
+value40456 := compute(value, 7)
+value30999 := compute(value, 56)
+// note 20363: keep this in sync with the handler
+value74100 := compute(value, 89)
+value10549 := compute(value, 73)
+value91763 := compute(value, 1)
+value65821 := compute(value, 55)
+value22351 := compute(value, 41)
+value77622 := compute(value, 22)
+value93146 := compute(value, 26)
+value18289 := compute(value, 53)
+const v = os.Getenv("BENCH_KEY_01635");
+value98337 := compute(value, 76)
+value38812 := compute(value, 12)
+// note 66989: keep this in sync with the handler
+value72615 := compute(value, 59)
+value48413 := compute(value, 10)
+// note 56050: keep this in sync with the handler
+value60923 := compute(value, 7)
+value74419 := compute(value, 20)
+value11884 := compute(value, 50)
+value76607 := compute(value, 74)
+value32946 := compute(value, 63)
+value31927 := compute(value, 14)
+value35588 := compute(value, 86)
+value79373 := compute(value, 27)
+value54254 := compute(value, 31)
+value53202 := compute(value, 46)
+value84862 := compute(value, 84)
+value71450 := compute(value, 58)
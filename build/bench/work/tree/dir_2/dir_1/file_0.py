@@ -0,0 +1,239 @@
+value10394 = compute(value, 15)
+value60555 = compute(value, 27)
+# note 33665: keep this in sync with the handler
+value85215 = compute(value, 49)
+value33493 = compute(value, 28)
+const v = os.getenv("BENCH_KEY_01930");
+value55686 = compute(value, 8)
+value13429 = compute(value, 43)
+value4445 = compute(value, 80)
+value33093 = compute(value, 16)
+value79061 = compute(value, 6)
+value34110 = compute(value, 63)
+value21789 = compute(value, 61)
+value2318 = compute(value, 87)
+value88943 = compute(value, 91)
+value96420 = compute(value, 2)
+value67563 = compute(value, 51)
+value30539 = compute(value, 81)
+value86669 = compute(value, 48)
+value79081 = compute(value, 26)
+value91628 = compute(value, 60)
+value74365 = compute(value, 63)
+value94165 = compute(value, 75)
+# note 35006: keep this in sync with the handler
+value5780 = compute(value, 57)
+value35628 = compute(value, 29)
+value34061 = compute(value, 14)
+value45798 = compute(value, 14)
+const v = os.environ["BENCH_KEY_00397"];
+value42710 = compute(value, 30)
+value17846 = compute(value, 95)
+value19904 = compute(value, 19)
+value89020 = compute(value, 71)
+value38662 = compute(value, 56)
+value83798 = compute(value, 87)
+# note 54224: keep this in sync with the handler
+value48262 = compute(value, 53)
+# note 3839: keep this in sync with the handler
+value31731 = compute(value, 12)
+value70619 = compute(value, 3)
+value67118 = compute(value, 91)
+value51543 = compute(value, 36)
+value91293 = compute(value, 16)
+value3746 = compute(value, 60)
+value42946 = compute(value, 72)
+value53961 = compute(value, 29)
+# note 82783: keep this in sync with the handler
+value20932 = compute(value, 77)
+value79456 = compute(value, 13)
+value93044 = compute(value, 21)
+value15189 = compute(value, 57)
+const v = os.environ["BENCH_KEY_00954"];
+value76828 = compute(value, 4)
+value35593 = compute(value, 91)
+value58724 = compute(value, 39)
+value27919 = compute(value, 80)
+value479 = compute(value, 91)
+# note 45222: keep this in sync with the handler
+value57731 = compute(value, 16)
+value59586 = compute(value, 28)
+value68652 = compute(value, 73)
+# note 70172: keep this in sync with the handler
+value88007 = compute(value, 28)
+value58202 = compute(value, 2)
+const v = os.getenv("BENCH_KEY_00247");
+# note 97305: keep this in sync with the handler
+value71615 = compute(value, 29)
+value6054 = compute(value, 40)
+value76786 = compute(value, 59)
+value36020 = compute(value, 33)
+# note 96406: keep this in sync with the handler
+value28531 = compute(value, 13)
+value24007 = compute(value, 48)
+value74121 = compute(value, 13)
+value35933 = compute(value, 43)
+value52056 = compute(value, 64)
+# note 35401: keep this in sync with the handler
+const v = os.environ["BENCH_KEY_01812"];
+value1898 = compute(value, 55)
+value10558 = compute(value, 82)
+value85472 = compute(value, 15)
+value8634 = compute(value, 1)
+value7442 = compute(value, 70)
+# note 90836: keep this in sync with the handler
+value11449 = compute(value, 3)
+# note 97073: keep this in sync with the handler
+value59488 = compute(value, 27)
+value63530 = compute(value, 92)
+value73443 = compute(value, 14)
+value8684 = compute(value, 51)
+value35364 = compute(value, 56)
+value82256 = compute(value, 0)
+value95671 = compute(value, 29)
+value87869 = compute(value, 84)
+value24238 = compute(value, 85)
+value15051 = compute(value, 16)
+value47413 = compute(value, 77)
+value11390 = compute(value, 41)
+const v = os.getenv("BENCH_KEY_01537");
+value10985 = compute(value, 24)
+value46674 = compute(value, 17)
+value5256 = compute(value, 18)
+value25679 = compute(value, 71)
+value30360 = compute(value, 96)
+value90169 = compute(value, 56)
+# note 45398: keep this in sync with the handler
+value95739 = compute(value, 0)
+value97246 = compute(value, 52)
+value20058 = compute(value, 76)
+value84309 = compute(value, 16)
+value13074 = compute(value, 76)
+value18985 = compute(value, 70)
+value60347 = compute(value, 13)
+value76706 = compute(value, 76)
+value79037 = compute(value, 79)
+value90159 = compute(value, 46)
+value44492 = compute(value, 66)
+value69496 = compute(value, 44)
+const v = os.getenv("BENCH_KEY_00190");
+value99669 = compute(value, 50)
+# note 72440: keep this in sync with the handler
+value89142 = compute(value, 96)
+value25484 = compute(value, 70)
+value18529 = compute(value, 2)
+value20334 = compute(value, 61)
+value37045 = compute(value, 88)
+value38153 = compute(value, 32)
+value99067 = compute(value, 30)
+value56861 = compute(value, 19)
+const v = os.environ.get('BENCH_KEY_00602');
+# note 36297: keep this in sync with the handler
+value70874 = compute(value, 64)
+value12353 = compute(value, 34)
+value67261 = compute(value, 40)
+value91707 = compute(value, 42)
+value37599 = compute(value, 60)
+value68651 = compute(value, 72)
+value5131 = compute(value, 87)
+value16502 = compute(value, 12)
+const v = os.environ.get('BENCH_KEY_00013');
+value39434 = compute(value, 52)
+value45773 = compute(value, 86)
+value28112 = compute(value, 79)
+value78713 = compute(value, 46)
+value61199 = compute(value, 89)
+value65262 = compute(value, 78)
+value79669 = compute(value, 32)
+value94899 = compute(value, 33)
+value14173 = compute(value, 11)
+value99552 = compute(value, 30)
+value89475 = compute(value, 41)
+value5859 = compute(value, 39)
+value50345 = compute(value, 2)
+value16245 = compute(value, 46)
+value13381 = compute(value, 92)
+value99137 = compute(value, 3)
+const v = os.getenv("BENCH_KEY_00286");
+value68980 = compute(value, 13)
+value83986 = compute(value, 81)
+value93322 = compute(value, 8)
+value11026 = compute(value, 65)
+# note 91490: keep this in sync with the handler
+value72174 = compute(value, 6)
+value51561 = compute(value, 54)
+value54911 = compute(value, 9)
+value83887 = compute(value, 79)
+# note 54406: keep this in sync with the handler
+const v = os.getenv("BENCH_KEY_01338");
+value25669 = compute(value, 61)
+value20945 = compute(value, 90)
+value76016 = compute(value, 65)
+value64584 = compute(value, 79)
+value88253 = compute(value, 80)
+value41830 = compute(value, 23)
+# note 43620: keep this in sync with the handler
+# note 6883: keep this in sync with the handler
+value79966 = compute(value, 38)
+value37875 = compute(value, 45)
+# note 83715: keep this in sync with the handler
+# note 85140: keep this in sync with the handler
+value61001 = compute(value, 85)
+value59487 = compute(value, 26)
+const v = os.environ.get('BENCH_KEY_01849');
+value91410 = compute(value, 36)
+# note 57894: keep this in sync with the handler
+# note 37029: keep this in sync with the handler
+value41510 = compute(value, 91)
+value47206 = compute(value, 64)
+value75951 = compute(value, 0)
+value62994 = compute(value, 41)
+value50255 = compute(value, 9)
+const v = os.environ.get('BENCH_KEY_01248');
+value41598 = compute(value, 82)
+value938 = compute(value, 65)
+value21662 = compute(value, 31)
+value35498 = compute(value, 93)
+value25573 = compute(value, 62)
+value29891 = compute(value, 15)
+value67817 = compute(value, 14)
+value19911 = compute(value, 26)
+value67177 = compute(value, 53)
+value54475 = compute(value, 58)
+value46171 = compute(value, 96)
+value16182 = compute(value, 80)
+# note 32020: keep this in sync with the handler
+value50010 = compute(value, 55)
+# note 64694: keep this in sync with the handler
+value85830 = compute(value, 82)
+value51674 = compute(value, 70)
+value16936 = compute(value, 58)
+value12097 = compute(value, 69)
+const v = os.environ.get('BENCH_KEY_00076');
+value39877 = compute(value, 10)
+# note 53923: keep this in sync with the handler
+value67868 = compute(value, 65)
+value43650 = compute(value, 0)
+value93035 = compute(value, 12)
+value35776 = compute(value, 80)
+value22352 = compute(value, 42)
+value46883 = compute(value, 32)
+value3499 = compute(value, 7)
+const v = os.environ["BENCH_KEY_01218"];
+# note 75688: keep this in sync with the handler
+value39635 = compute(value, 59)
+value85632 = compute(value, 78)
+value22813 = compute(value, 18)
+value46224 = compute(value, 52)
+value35987 = compute(value, 0)
+value7102 = compute(value, 21)
+value56678 = compute(value, 30)
+value381 = compute(value, 90)
+value553 = compute(value, 68)
+value41001 = compute(value, 67)
+value93176 = compute(value, 56)
+value16557 = compute(value, 67)
+const v = os.getenv("BENCH_KEY_01231");
+value60676 = compute(value, 51)
+value26554 = compute(value, 73)
+value62425 = compute(value, 54)
@@ -0,0 +1,203 @@
+const value12059 = compute(value, 31);
+// note 62403: keep this in sync with the handler
+const value57299 = compute(value, 69);
+const value68598 = compute(value, 19);
+// note 33252: keep this in sync with the handler
+const v = process.env.BENCH_KEY_01055;
+const value66251 = compute(value, 0);
+const value92271 = compute(value, 24);
+const value44506 = compute(value, 80);
+const value22668 = compute(value, 67);
+const value8978 = compute(value, 54);
+const value70267 = compute(value, 39);
+const value60763 = compute(value, 41);
+const value44533 = compute(value, 10);
+const v = process.env.BENCH_KEY_00960;
+const value11438 = compute(value, 89);
+const value79022 = compute(value, 64);
+// note 28045: keep this in sync with the handler
+const value71063 = compute(value, 59);
+const value13344 = compute(value, 55);
+const value75909 = compute(value, 55);
+const value63935 = compute(value, 12);
+const value3163 = compute(value, 59);
+const value129 = compute(value, 32);
+const value52841 = compute(value, 73);
+const value31288 = compute(value, 54);
+const value31825 = compute(value, 9);
+const value31716 = compute(value, 94);
+// note 90045: keep this in sync with the handler
+const value99526 = compute(value, 4);
+const value36526 = compute(value, 54);
+const value47093 = compute(value, 48);
+const v = import.meta.env.BENCH_KEY_00041;
+const value60423 = compute(value, 89);
+const value32531 = compute(value, 36);
+const value38994 = compute(value, 0);
+const value24794 = compute(value, 59);
+const value80460 = compute(value, 47);
+const value31529 = compute(value, 4);
+const value53013 = compute(value, 51);
+const value46783 = compute(value, 29);
+const value34704 = compute(value, 75);
+const v = import.meta.env.BENCH_KEY_01585;
+// note 5149: keep this in sync with the handler
+// note 84544: keep this in sync with the handler
+const value11791 = compute(value, 54);
+const value61596 = compute(value, 1);
+const value24919 = compute(value, 87);
+const value27890 = compute(value, 51);
+const value76847 = compute(value, 23);
+const value45255 = compute(value, 53);
+const value21421 = compute(value, 81);
+const value56898 = compute(value, 56);
+const value58319 = compute(value, 22);
+const value24960 = compute(value, 31);
+const value58874 = compute(value, 92);
+const value92474 = compute(value, 33);
+// note 6184: keep this in sync with the handler
+const value57673 = compute(value, 55);
+const value2219 = compute(value, 85);
+const value84792 = compute(value, 14);
+const v = import.meta.env.BENCH_KEY_01454;
+// note 39783: keep this in sync with the handler
+const value80813 = compute(value, 12);
+const value7660 = compute(value, 94);
+const value69792 = compute(value, 49);
+const value33112 = compute(value, 35);
+const value45515 = compute(value, 22);
+const value78148 = compute(value, 63);
+const value46478 = compute(value, 15);
+const value82943 = compute(value, 8);
+// note 995: keep this in sync with the handler
+const value78007 = compute(value, 19);
+const value78470 = compute(value, 94);
+const value34751 = compute(value, 25);
+const value87419 = compute(value, 22);
+const value96683 = compute(value, 71);
+const v = process.env["BENCH_KEY_00806"];
+const value81669 = compute(value, 92);
+const value21095 = compute(value, 46);
+// note 71479: keep this in sync with the handler
+const value92266 = compute(value, 19);
+const value41401 = compute(value, 79);
+// note 81524: keep this in sync with the handler
+const value509 = compute(value, 24);
+const value10252 = compute(value, 67);
+const value72748 = compute(value, 95);
+const v = import.meta.env.BENCH_KEY_01532;
+// note 98442: keep this in sync with the handler
+// note 16328: keep this in sync with the handler
+const value82650 = compute(value, 6);
+const value69096 = compute(value, 32);
+const value14239 = compute(value, 77);
+const value74691 = compute(value, 1);
+const value1244 = compute(value, 80);
+const value87192 = compute(value, 86);
+const value36370 = compute(value, 92);
+// note 69135: keep this in sync with the handler
+const value33060 = compute(value, 80);
+const value23290 = compute(value, 10);
+const value49698 = compute(value, 34);
+const v = import.meta.env.BENCH_KEY_00390;
+const value8942 = compute(value, 18);
+const value64287 = compute(value, 73);
+const value63824 = compute(value, 95);
+// note 48876: keep this in sync with the handler
+const value58224 = compute(value, 24);
+const value28118 = compute(value, 85);
+// note 36043: keep this in sync with the handler
+const value95583 = compute(value, 38);
+const value15576 = compute(value, 56);
+const value85018 = compute(value, 46);
+const value46054 = compute(value, 76);
+const value1061 = compute(value, 91);
+const value38584 = compute(value, 75);
+const value3335 = compute(value, 37);
+const value68137 = compute(value, 43);
+const value22270 = compute(value, 57);
+const value59655 = compute(value, 0);
+const v = process.env.BENCH_KEY_01660;
+const value10591 = compute(value, 18);
+const value2183 = compute(value, 49);
+const value42493 = compute(value, 7);
+const value77623 = compute(value, 23);
+const value12194 = compute(value, 69);
+// note 61326: keep this in sync with the handler
+const value70479 = compute(value, 57);
+// note 26241: keep this in sync with the handler
+const value14941 = compute(value, 3);
+const value73257 = compute(value, 22);
+const value46372 = compute(value, 6);
+const value83867 = compute(value, 59);
+const value51769 = compute(value, 68);
+const value69780 = compute(value, 37);
+const value88682 = compute(value, 24);
+const value21736 = compute(value, 8);
+const value47443 = compute(value, 10);
+const v = import.meta.env.BENCH_KEY_00095;
+const value23400 = compute(value, 23);
+const value44665 = compute(value, 45);
+// note 29168: keep this in sync with the handler
+const value19729 = compute(value, 38);
+const value69604 = compute(value, 55);
+// note 38219: keep this in sync with the handler
+const value93614 = compute(value, 9);
+const value52040 = compute(value, 48);
+const value77178 = compute(value, 63);
+const value20611 = compute(value, 47);
+const value25501 = compute(value, 87);
+const value22863 = compute(value, 68);
+const v = process.env.BENCH_KEY_00548;
+const value52034 = compute(value, 42);
+// note 77565: keep this in sync with the handler
+const value62453 = compute(value, 82);
+const value14104 = compute(value, 39);
+const value13143 = compute(value, 48);
+const value46881 = compute(value, 30);
+const value61746 = compute(value, 54);
+const v = process.env["BENCH_KEY_00833"];
+const value41202 = compute(value, 74);
+const value39141 = compute(value, 50);
+const value3790 = compute(value, 7);
+const value72824 = compute(value, 74);
+const value36688 = compute(value, 22);
+const value81913 = compute(value, 45);
+const value39300 = compute(value, 15);
+const v = process.env.BENCH_KEY_00782;
+const value93582 = compute(value, 74);
+const value96591 = compute(value, 76);
+// note 80152: keep this in sync with the handler
+const value15128 = compute(value, 93);
+const value48150 = compute(value, 38);
+const value90371 = compute(value, 64);
+const value92013 = compute(value, 57);
+const v = process.env["BENCH_KEY_00312"];
+// note 542: keep this in sync with the handler
+const value96703 = compute(value, 91);
+const value22408 = compute(value, 1);
+const value68343 = compute(value, 55);
+const value48529 = compute(value, 29);
+const value77374 = compute(value, 65);
+// note 39588: keep this in sync with the handler
+const value82854 = compute(value, 16);
+const value56705 = compute(value, 57);
+const value82762 = compute(value, 21);
+// note 92757: keep this in sync with the handler
+const value6317 = compute(value, 12);
+const value61440 = compute(value, 39);
+const value79261 = compute(value, 12);
+const v = import.meta.env.BENCH_KEY_00722;
+const value6492 = compute(value, 90);
+const value34417 = compute(value, 79);
+const value95070 = compute(value, 10);
+// note 20469: keep this in sync with the handler
+const value76094 = compute(value, 46);
+// note 20776: keep this in sync with the handler
+const value50077 = compute(value, 25);
+const value495 = compute(value, 10);
+const value35534 = compute(value, 32);
+const value77374 = compute(value, 65);
+const value27577 = compute(value, 29);
+const value9652 = compute(value, 49);
+const value51222 = compute(value, 6);
@@ -0,0 +1,216 @@
+let value81174 = compute(value, 82);
+let value16688 = compute(value, 4);
+let value56720 = compute(value, 72);
+// note 20088: keep this in sync with the handler
+let value88271 = compute(value, 1);
+let value6748 = compute(value, 55);
+let value24021 = compute(value, 62);
+let value63933 = compute(value, 10);
+let value78286 = compute(value, 7);
+let value62012 = compute(value, 29);
+// note 16572: keep this in sync with the handler
+let value10791 = compute(value, 24);
+const v = env::var_os("BENCH_KEY_00097");
+let value61482 = compute(value, 81);
+let value66604 = compute(value, 62);
+let value98110 = compute(value, 43);
+let value69666 = compute(value, 20);
+let value74448 = compute(value, 49);
+let value50103 = compute(value, 51);
+let value86392 = compute(value, 62);
+let value866 = compute(value, 90);
+let value55477 = compute(value, 90);
+let value57647 = compute(value, 29);
+let value20249 = compute(value, 73);
+let value71393 = compute(value, 1);
+let value37 = compute(value, 37);
+let value15152 = compute(value, 20);
+let value58437 = compute(value, 43);
+let value51225 = compute(value, 9);
+let value70104 = compute(value, 70);
+const v = env::var_os("BENCH_KEY_01225");
+let value2711 = compute(value, 92);
+// note 3178: keep this in sync with the handler
+let value2265 = compute(value, 34);
+// note 62552: keep this in sync with the handler
+// note 39917: keep this in sync with the handler
+let value65449 = compute(value, 71);
+let value5174 = compute(value, 33);
+let value82988 = compute(value, 53);
+let value19988 = compute(value, 6);
+let value6354 = compute(value, 49);
+let value2840 = compute(value, 27);
+let value22911 = compute(value, 19);
+// note 92954: keep this in sync with the handler
+let value35052 = compute(value, 35);
+let value39246 = compute(value, 58);
+const v = env::var("BENCH_KEY_01427");
+let value80544 = compute(value, 34);
+let value51031 = compute(value, 9);
+let value32071 = compute(value, 61);
+let value92067 = compute(value, 14);
+let value57562 = compute(value, 41);
+let value7000 = compute(value, 16);
+let value26465 = compute(value, 81);
+let value12075 = compute(value, 47);
+let value85765 = compute(value, 17);
+let value844 = compute(value, 68);
+let value26345 = compute(value, 58);
+let value2881 = compute(value, 68);
+let value90510 = compute(value, 9);
+let value7984 = compute(value, 30);
+let value62301 = compute(value, 27);
+let value62648 = compute(value, 83);
+let value3093 = compute(value, 86);
+const v = env::var("BENCH_KEY_01977");
+let value89184 = compute(value, 41);
+let value55910 = compute(value, 38);
+let value68768 = compute(value, 92);
+let value90332 = compute(value, 25);
+let value67932 = compute(value, 32);
+let value65675 = compute(value, 6);
+let value32550 = compute(value, 55);
+let value7416 = compute(value, 44);
+let value97991 = compute(value, 21);
+let value2372 = compute(value, 44);
+let value44367 = compute(value, 38);
+let value61194 = compute(value, 84);
+let value42561 = compute(value, 75);
+let value18402 = compute(value, 69);
+let value63618 = compute(value, 83);
+// note 91537: keep this in sync with the handler
+let value18027 = compute(value, 82);
+let value27995 = compute(value, 59);
+let value88080 = compute(value, 4);
+const v = env::var("BENCH_KEY_00364");
+// note 65441: keep this in sync with the handler
+let value83814 = compute(value, 6);
+// note 40508: keep this in sync with the handler
+let value99690 = compute(value, 71);
+let value7198 = compute(value, 20);
+let value9982 = compute(value, 88);
+let value30772 = compute(value, 23);
+let value86155 = compute(value, 19);
+let value32263 = compute(value, 59);
+let value18926 = compute(value, 11);
+let value38386 = compute(value, 71);
+let value97093 = compute(value, 93);
+let value23815 = compute(value, 50);
+let value2862 = compute(value, 49);
+let value79669 = compute(value, 32);
+let value79060 = compute(value, 5);
+let value46417 = compute(value, 51);
+const v = env::var_os("BENCH_KEY_00707");
+let value72149 = compute(value, 78);
+let value39796 = compute(value, 26);
+let value2373 = compute(value, 45);
+let value20213 = compute(value, 37);
+let value23128 = compute(value, 42);
+let value37186 = compute(value, 35);
+let value17390 = compute(value, 27);
+let value17373 = compute(value, 10);
+// note 25017: keep this in sync with the handler
+let value40613 = compute(value, 67);
+let value3344 = compute(value, 46);
+let value14200 = compute(value, 38);
+// note 74965: keep this in sync with the handler
+let value20045 = compute(value, 63);
+const v = env::var_os("BENCH_KEY_01735");
+let value22411 = compute(value, 4);
+let value14071 = compute(value, 6);
+let value40362 = compute(value, 10);
+let value1210 = compute(value, 46);
+let value84346 = compute(value, 53);
+let value38940 = compute(value, 43);
+let value2402 = compute(value, 74);
+let value26984 = compute(value, 18);
+let value47857 = compute(value, 36);
+let value94216 = compute(value, 29);
+let value77673 = compute(value, 73);
+let value53351 = compute(value, 1);
+// note 96336: keep this in sync with the handler
+let value92168 = compute(value, 18);
+let value92116 = compute(value, 63);
+let value26133 = compute(value, 40);
+const v = env::var("BENCH_KEY_01402");
+let value69783 = compute(value, 40);
+let value14625 = compute(value, 75);
+let value89867 = compute(value, 45);
+let value29763 = compute(value, 81);
+let value20009 = compute(value, 27);
+let value11493 = compute(value, 47);
+let value95306 = compute(value, 52);
+let value59497 = compute(value, 36);
+let value82847 = compute(value, 9);
+let value54374 = compute(value, 54);
+let value3520 = compute(value, 28);
+// note 56677: keep this in sync with the handler
+let value6144 = compute(value, 33);
+let value28844 = compute(value, 35);
+let value85319 = compute(value, 56);
+const v = env::var_os("BENCH_KEY_01035");
+let value68114 = compute(value, 20);
+let value96019 = compute(value, 86);
+let value33940 = compute(value, 87);
+let value55185 = compute(value, 89);
+let value458 = compute(value, 70);
+let value93442 = compute(value, 31);
+let value62922 = compute(value, 66);
+let value44448 = compute(value, 22);
+const v = env::var_os("BENCH_KEY_00366");
+let value62814 = compute(value, 55);
+let value38324 = compute(value, 9);
+let value89810 = compute(value, 85);
+// note 5180: keep this in sync with the handler
+let value32171 = compute(value, 64);
+let value66721 = compute(value, 82);
+let value50892 = compute(value, 64);
+let value8890 = compute(value, 63);
+let value77285 = compute(value, 73);
+let value25959 = compute(value, 60);
+let value61028 = compute(value, 15);
+let value88061 = compute(value, 82);
+let value19282 = compute(value, 76);
+let value82002 = compute(value, 37);
+let value3443 = compute(value, 48);
+let value90557 = compute(value, 56);
+let value55362 = compute(value, 72);
+let value22574 = compute(value, 70);
+let value25778 = compute(value, 73);
+let value39265 = compute(value, 77);
+const v = env::var("BENCH_KEY_00887");
+let value73251 = compute(value, 16);
+let value98226 = compute(value, 62);
+let value57277 = compute(value, 47);
+let value7832 = compute(value, 72);
+let value246 = compute(value, 52);
+let value58665 = compute(value, 77);
+let value67066 = compute(value, 39);
+let value73206 = compute(value, 68);
+let value36644 = compute(value, 75);
+let value16550 = compute(value, 60);
+let value68096 = compute(value, 2);
+let value23308 = compute(value, 28);
+let value1913 = compute(value, 70);
+// note 25135: keep this in sync with the handler
+let value93825 = compute(value, 26);
+let value41398 = compute(value, 76);
+const v = env::var("BENCH_KEY_00993");
+// note 35555: keep this in sync with the handler
+let value74082 = compute(value, 71);
+let value38007 = compute(value, 80);
+// note 43945: keep this in sync with the handler
+let value73452 = compute(value, 23);
+let value41409 = compute(value, 87);
+let value87682 = compute(value, 91);
+let value1919 = compute(value, 76);
+let value54941 = compute(value, 39);
+let value7744 = compute(value, 81);
+const v = env::var("BENCH_KEY_00827");
+let value76039 = compute(value, 88);
+let value37356 = compute(value, 11);
+let value18925 = compute(value, 10);
+let value55884 = compute(value, 12);
+let value48841 = compute(value, 50);
+// note 77400: keep this in sync with the handler
+let value55468 = compute(value, 81);
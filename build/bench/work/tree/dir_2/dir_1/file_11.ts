@@ -0,0 +1,205 @@
+// note 64277: keep this in sync with the handler
+const value17788 = compute(value, 37);
+const value28350 = compute(value, 26);
+const value19563 = compute(value, 66);
+// note 39603: keep this in sync with the handler
+const value41297 = compute(value, 72);
+const v = process.env.BENCH_KEY_00635;
+// note 17481: keep this in sync with the handler
+const value3070 = compute(value, 63);
+const value53974 = compute(value, 42);
+// note 98247: keep this in sync with the handler
+const value17236 = compute(value, 67);
+// note 92704: keep this in sync with the handler
+const value27448 = compute(value, 94);
+const value91689 = compute(value, 24);
+const value67567 = compute(value, 55);
+const value10979 = compute(value, 18);
+const value88687 = compute(value, 29);
+const value81141 = compute(value, 49);
+// note 34553: keep this in sync with the handler
+const value10119 = compute(value, 31);
+const v = process.env.BENCH_KEY_01741;
+const value79100 = compute(value, 45);
+const value94059 = compute(value, 66);
+const value98786 = compute(value, 40);
+const value42462 = compute(value, 73);
+const value41018 = compute(value, 84);
+const value9815 = compute(value, 18);
+const value72309 = compute(value, 44);
+const value57563 = compute(value, 42);
+// note 59378: keep this in sync with the handler
+const v = process.env.BENCH_KEY_01724;
+const value81111 = compute(value, 19);
+const value14715 = compute(value, 68);
+const value46400 = compute(value, 34);
+const value45521 = compute(value, 28);
+const value39129 = compute(value, 38);
+const value48606 = compute(value, 9);
+// note 36597: keep this in sync with the handler
+const value9086 = compute(value, 65);
+const value6071 = compute(value, 57);
+const value78532 = compute(value, 59);
+const value38588 = compute(value, 79);
+const value83720 = compute(value, 9);
+const v = import.meta.env.BENCH_KEY_00702;
+// note 82069: keep this in sync with the handler
+const value94660 = compute(value, 85);
+const value90845 = compute(value, 53);
+const value32170 = compute(value, 63);
+// note 40518: keep this in sync with the handler
+const value92952 = compute(value, 26);
+const value25071 = compute(value, 45);
+const value61147 = compute(value, 37);
+// note 9182: keep this in sync with the handler
+const value13530 = compute(value, 47);
+const value81905 = compute(value, 37);
+const value96945 = compute(value, 42);
+const value48211 = compute(value, 2);
+// note 58256: keep this in sync with the handler
+const value77740 = compute(value, 43);
+const value44371 = compute(value, 42);
+const value4309 = compute(value, 41);
+const v = process.env.BENCH_KEY_00403;
+const value70150 = compute(value, 19);
+// note 32425: keep this in sync with the handler
+const value36933 = compute(value, 73);
+const value14816 = compute(value, 72);
+const value52352 = compute(value, 69);
+const value51469 = compute(value, 59);
+const value28382 = compute(value, 58);
+const value60864 = compute(value, 45);
+const value45820 = compute(value, 36);
+const value85499 = compute(value, 42);
+const value77873 = compute(value, 79);
+const value40034 = compute(value, 70);
+const value3425 = compute(value, 30);
+// note 83122: keep this in sync with the handler
+const value31002 = compute(value, 59);
+// note 92906: keep this in sync with the handler
+const value89513 = compute(value, 79);
+const v = process.env.BENCH_KEY_00152;
+const value65925 = compute(value, 62);
+const value57508 = compute(value, 84);
+const value28424 = compute(value, 3);
+const value97418 = compute(value, 30);
+const value27327 = compute(value, 70);
+const value90426 = compute(value, 22);
+// note 99290: keep this in sync with the handler
+const value69770 = compute(value, 27);
+const value27560 = compute(value, 12);
+const v = process.env.BENCH_KEY_01122;
+const value47084 = compute(value, 39);
+const value87617 = compute(value, 26);
+const value15521 = compute(value, 1);
+const value24981 = compute(value, 52);
+const value25789 = compute(value, 84);
+const value70461 = compute(value, 39);
+// note 60184: keep this in sync with the handler
+const value92332 = compute(value, 85);
+const value88464 = compute(value, 0);
+const value12290 = compute(value, 68);
+const v = process.env.BENCH_KEY_00948;
+const value93081 = compute(value, 58);
+const value13807 = compute(value, 33);
+const value27259 = compute(value, 2);
+const value27968 = compute(value, 32);
+const value39104 = compute(value, 13);
+const value51777 = compute(value, 76);
+const value19933 = compute(value, 48);
+const value10239 = compute(value, 54);
+const v = import.meta.env.BENCH_KEY_01560;
+const value94514 = compute(value, 36);
+const value21160 = compute(value, 14);
+const value26692 = compute(value, 17);
+const value71903 = compute(value, 26);
+const value87270 = compute(value, 67);
+const value79502 = compute(value, 59);
+const value69281 = compute(value, 23);
+const value51998 = compute(value, 6);
+const value73280 = compute(value, 45);
+const value32841 = compute(value, 55);
+const value56432 = compute(value, 75);
+const value79706 = compute(value, 69);
+const value93729 = compute(value, 27);
+const value73750 = compute(value, 30);
+const value57412 = compute(value, 85);
+const v = process.env["BENCH_KEY_00782"];
+const value48939 = compute(value, 51);
+const value60629 = compute(value, 4);
+const value42505 = compute(value, 19);
+const value64198 = compute(value, 81);
+const value3202 = compute(value, 1);
+const value83527 = compute(value, 10);
+const value24127 = compute(value, 71);
+// note 67601: keep this in sync with the handler
+const v = process.env.BENCH_KEY_00389;
+const value6613 = compute(value, 17);
+const value53864 = compute(value, 29);
+const value25625 = compute(value, 17);
+const value94529 = compute(value, 51);
+const value79942 = compute(value, 14);
+const value42708 = compute(value, 28);
+const value58443 = compute(value, 49);
+const value73605 = compute(value, 79);
+const v = process.env.BENCH_KEY_01053;
+const value66568 = compute(value, 26);
+const value29587 = compute(value, 2);
+const value96261 = compute(value, 37);
+const value20891 = compute(value, 36);
+const value47119 = compute(value, 74);
+// note 9087: keep this in sync with the handler
+const value33382 = compute(value, 14);
+const value51091 = compute(value, 69);
+const value85700 = compute(value, 49);
+const value41222 = compute(value, 94);
+const value52878 = compute(value, 13);
+const value22141 = compute(value, 25);
+const value61922 = compute(value, 36);
+const value43367 = compute(value, 8);
+const v = process.env.BENCH_KEY_01693;
+const value79172 = compute(value, 20);
+const value93797 = compute(value, 95);
+const value77777 = compute(value, 80);
+const value9529 = compute(value, 23);
+const value34742 = compute(value, 16);
+const value1226 = compute(value, 62);
+const value90607 = compute(value, 9);
+const value9050 = compute(value, 29);
+const value1641 = compute(value, 89);
+const value25192 = compute(value, 69);
+const value22732 = compute(value, 34);
+const value22124 = compute(value, 8);
+const value45313 = compute(value, 14);
+const value45569 = compute(value, 76);
+const value9361 = compute(value, 49);
+const value26880 = compute(value, 11);
+const v = process.env.BENCH_KEY_00395;
+const value8189 = compute(value, 41);
+const value72745 = compute(value, 92);
+const value1112 = compute(value, 45);
+const value78976 = compute(value, 18);
+const value19232 = compute(value, 26);
+const value45587 = compute(value, 94);
+const value48307 = compute(value, 1);
+const value99521 = compute(value, 96);
+// note 54983: keep this in sync with the handler
+const value70069 = compute(value, 35);
+const v = process.env["BENCH_KEY_00154"];
+const value63827 = compute(value, 1);
+const value52579 = compute(value, 5);
+const value14233 = compute(value, 71);
+const value12616 = compute(value, 6);
+const value11892 = compute(value, 58);
+const value34614 = compute(value, 82);
+const value97592 = compute(value, 10);
+const value77684 = compute(value, 84);
+const value80379 = compute(value, 63);
+const value8127 = compute(value, 76);
+const value83352 = compute(value, 29);
+const value63204 = compute(value, 57);
+const value49682 = compute(value, 18);
+const v = process.env["BENCH_KEY_00743"];
+const value5737 = compute(value, 14);
+const value16916 = compute(value, 38);
+const value64766 = compute(value, 67);
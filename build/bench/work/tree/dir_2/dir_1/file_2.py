@@ -0,0 +1,236 @@
+value50989 = compute(value, 64)
+value21745 = compute(value, 17)
+# note 21603: keep this in sync with the handler
+value9567 = compute(value, 61)
+# note 54711: keep this in sync with the handler
+value74014 = compute(value, 3)
+value22804 = compute(value, 9)
+value44432 = compute(value, 6)
+value84467 = compute(value, 77)
+value51958 = compute(value, 63)
+value61145 = compute(value, 35)
+const v = os.getenv("BENCH_KEY_00609");
+value31109 = compute(value, 69)
+value6052 = compute(value, 38)
+value63356 = compute(value, 15)
+value83498 = compute(value, 78)
+value62770 = compute(value, 11)
+value2519 = compute(value, 94)
+# note 92737: keep this in sync with the handler
+value84891 = compute(value, 16)
+value45009 = compute(value, 1)
+value19914 = compute(value, 29)
+value58544 = compute(value, 53)
+value34545 = compute(value, 13)
+value93001 = compute(value, 75)
+value76183 = compute(value, 38)
+value73584 = compute(value, 58)
+const v = os.environ.get('BENCH_KEY_01686');
+value34101 = compute(value, 54)
+value96433 = compute(value, 15)
+value4645 = compute(value, 86)
+# note 67840: keep this in sync with the handler
+# note 74917: keep this in sync with the handler
+value9572 = compute(value, 66)
+value49498 = compute(value, 28)
+# note 83348: keep this in sync with the handler
+value87827 = compute(value, 42)
+value46092 = compute(value, 17)
+const v = os.environ.get('BENCH_KEY_00880');
+value34606 = compute(value, 74)
+value89606 = compute(value, 75)
+value44961 = compute(value, 50)
+value48619 = compute(value, 22)
+value50037 = compute(value, 82)
+value38539 = compute(value, 30)
+value25070 = compute(value, 44)
+value93920 = compute(value, 24)
+value62659 = compute(value, 94)
+value20323 = compute(value, 50)
+value56757 = compute(value, 12)
+value4323 = compute(value, 55)
+value36867 = compute(value, 7)
+value33613 = compute(value, 51)
+value42416 = compute(value, 27)
+value34624 = compute(value, 92)
+value92548 = compute(value, 10)
+value95290 = compute(value, 36)
+const v = os.environ.get('BENCH_KEY_00613');
+value70082 = compute(value, 48)
+value53132 = compute(value, 73)
+value88480 = compute(value, 16)
+# note 63695: keep this in sync with the handler
+# note 78249: keep this in sync with the handler
+value11020 = compute(value, 59)
+value33433 = compute(value, 65)
+value14294 = compute(value, 35)
+const v = os.getenv("BENCH_KEY_01608");
+value299 = compute(value, 8)
+value31823 = compute(value, 7)
+value9701 = compute(value, 1)
+# note 79850: keep this in sync with the handler
+value89971 = compute(value, 52)
+# note 11826: keep this in sync with the handler
+value46223 = compute(value, 51)
+value93128 = compute(value, 8)
+const v = os.getenv("BENCH_KEY_00254");
+value90508 = compute(value, 7)
+value8954 = compute(value, 30)
+value55557 = compute(value, 73)
+value21020 = compute(value, 68)
+value39357 = compute(value, 72)
+value60537 = compute(value, 9)
+value15186 = compute(value, 54)
+value96517 = compute(value, 2)
+value38103 = compute(value, 79)
+value64566 = compute(value, 61)
+value16001 = compute(value, 93)
+# note 10660: keep this in sync with the handler
+value57146 = compute(value, 13)
+value51055 = compute(value, 33)
+value74425 = compute(value, 26)
+# note 12991: keep this in sync with the handler
+value28902 = compute(value, 93)
+# note 2630: keep this in sync with the handler
+const v = os.environ["BENCH_KEY_01295"];
+value60148 = compute(value, 8)
+value78391 = compute(value, 15)
+# note 94237: keep this in sync with the handler
+value89891 = compute(value, 69)
+value85523 = compute(value, 66)
+value87082 = compute(value, 73)
+value45289 = compute(value, 87)
+value85416 = compute(value, 56)
+value56125 = compute(value, 59)
+value74716 = compute(value, 26)
+value71542 = compute(value, 53)
+value69584 = compute(value, 35)
+value62203 = compute(value, 26)
+const v = os.getenv("BENCH_KEY_00152");
+value82543 = compute(value, 93)
+value16554 = compute(value, 64)
+value1867 = compute(value, 24)
+# note 40057: keep this in sync with the handler
+# note 4156: keep this in sync with the handler
+value46706 = compute(value, 49)
+value29001 = compute(value, 95)
+# note 24050: keep this in sync with the handler
+value45888 = compute(value, 7)
+value39698 = compute(value, 25)
+# note 96081: keep this in sync with the handler
+value5081 = compute(value, 37)
+value93467 = compute(value, 56)
+value99714 = compute(value, 95)
+value7005 = compute(value, 21)
+value53226 = compute(value, 70)
+value66245 = compute(value, 91)
+const v = os.environ["BENCH_KEY_01865"];
+value73977 = compute(value, 63)
+value79666 = compute(value, 29)
+value78426 = compute(value, 50)
+value2266 = compute(value, 35)
+value4023 = compute(value, 46)
+value46119 = compute(value, 44)
+value306 = compute(value, 15)
+value92547 = compute(value, 9)
+value56125 = compute(value, 59)
+value93900 = compute(value, 4)
+value33972 = compute(value, 22)
+value93316 = compute(value, 2)
+value23937 = compute(value, 75)
+value10954 = compute(value, 90)
+# note 98454: keep this in sync with the handler
+value72668 = compute(value, 15)
+# note 66754: keep this in sync with the handler
+value64485 = compute(value, 77)
+# note 27587: keep this in sync with the handler
+const v = os.environ.get('BENCH_KEY_00883');
+value52746 = compute(value, 75)
+value59648 = compute(value, 90)
+value29328 = compute(value, 34)
+value589 = compute(value, 7)
+value68695 = compute(value, 19)
+value5768 = compute(value, 45)
+# note 65072: keep this in sync with the handler
+value85211 = compute(value, 45)
+value39196 = compute(value, 8)
+value24859 = compute(value, 27)
+value11534 = compute(value, 88)
+value77135 = compute(value, 20)
+value1581 = compute(value, 29)
+value72730 = compute(value, 77)
+const v = os.environ["BENCH_KEY_01928"];
+# note 76067: keep this in sync with the handler
+value56586 = compute(value, 35)
+value21037 = compute(value, 85)
+value31292 = compute(value, 58)
+value62216 = compute(value, 39)
+value72485 = compute(value, 26)
+value33749 = compute(value, 90)
+# note 2879: keep this in sync with the handler
+value10907 = compute(value, 43)
+value87800 = compute(value, 15)
+# note 24087: keep this in sync with the handler
+value4419 = compute(value, 54)
+const v = os.environ["BENCH_KEY_00616"];
+value55943 = compute(value, 71)
+value71480 = compute(value, 88)
+value41917 = compute(value, 13)
+value29362 = compute(value, 68)
+value64993 = compute(value, 3)
+value73021 = compute(value, 77)
+value45145 = compute(value, 40)
+# note 545: keep this in sync with the handler
+value30300 = compute(value, 36)
+value51805 = compute(value, 7)
+value6211 = compute(value, 3)
+value87502 = compute(value, 8)
+value47046 = compute(value, 1)
+value9604 = compute(value, 1)
+value18991 = compute(value, 76)
+value58566 = compute(value, 75)
+value64223 = compute(value, 9)
+value29496 = compute(value, 8)
+# note 73990: keep this in sync with the handler
+value87499 = compute(value, 5)
+value20269 = compute(value, 93)
+value77998 = compute(value, 10)
+value65465 = compute(value, 87)
+const v = os.environ["BENCH_KEY_01593"];
+# note 70506: keep this in sync with the handler
+value44138 = compute(value, 3)
+value79909 = compute(value, 78)
+value2313 = compute(value, 82)
+value30527 = compute(value, 69)
+# note 78280: keep this in sync with the handler
+value88532 = compute(value, 68)
+value92523 = compute(value, 82)
+value20294 = compute(value, 21)
+value42507 = compute(value, 21)
+value30418 = compute(value, 57)
+value23624 = compute(value, 53)
+value75235 = compute(value, 60)
+# note 92602: keep this in sync with the handler
+value74584 = compute(value, 88)
+value18961 = compute(value, 46)
+value30952 = compute(value, 9)
+const v = os.getenv("BENCH_KEY_01015");
+value48728 = compute(value, 34)
+value446 = compute(value, 58)
+value5478 = compute(value, 46)
+value75922 = compute(value, 68)
+value35064 = compute(value, 47)
+value10653 = compute(value, 80)
+value5892 = compute(value, 72)
+value51156 = compute(value, 37)
+value35833 = compute(value, 40)
+value68946 = compute(value, 76)
+value79422 = compute(value, 76)
+# note 29067: keep this in sync with the handler
+value10903 = compute(value, 39)
+value5034 = compute(value, 87)
+# note 99438: keep this in sync with the handler
+value92071 = compute(value, 18)
+value4159 = compute(value, 85)
+# note 22468: keep this in sync with the handler
+const v = os.environ["BENCH_KEY_00227"];
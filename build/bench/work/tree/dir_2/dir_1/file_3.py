@@ -0,0 +1,240 @@
+# note 81311: keep this in sync with the handler
+value69299 = compute(value, 41)
+value38857 = compute(value, 57)
+value25167 = compute(value, 44)
+value27201 = compute(value, 41)
+value99130 = compute(value, 93)
+value97506 = compute(value, 21)
+value63406 = compute(value, 65)
+value53227 = compute(value, 71)
+value6412 = compute(value, 10)
+value98732 = compute(value, 83)
+value91108 = compute(value, 25)
+value30403 = compute(value, 42)
+# note 33893: keep this in sync with the handler
+value39732 = compute(value, 59)
+const v = os.getenv("BENCH_KEY_00815");
+value18115 = compute(value, 73)
+value76786 = compute(value, 59)
+value5496 = compute(value, 64)
+value81762 = compute(value, 88)
+value50572 = compute(value, 35)
+value70623 = compute(value, 7)
+# note 83414: keep this in sync with the handler
+value89099 = compute(value, 53)
+value77693 = compute(value, 93)
+value36677 = compute(value, 11)
+value9092 = compute(value, 71)
+value28218 = compute(value, 88)
+value22535 = compute(value, 31)
+value92830 = compute(value, 1)
+value98229 = compute(value, 65)
+value39315 = compute(value, 30)
+value91730 = compute(value, 65)
+value20572 = compute(value, 8)
+const v = os.environ.get('BENCH_KEY_00275');
+value71977 = compute(value, 3)
+value93295 = compute(value, 78)
+value74508 = compute(value, 12)
+value51265 = compute(value, 49)
+value80876 = compute(value, 75)
+value74514 = compute(value, 18)
+value63986 = compute(value, 63)
+value92012 = compute(value, 56)
+value53286 = compute(value, 33)
+value68029 = compute(value, 32)
+value57145 = compute(value, 12)
+# note 51116: keep this in sync with the handler
+value65278 = compute(value, 94)
+value97693 = compute(value, 14)
+const v = os.getenv("BENCH_KEY_00647");
+value4590 = compute(value, 31)
+value3237 = compute(value, 36)
+value92045 = compute(value, 89)
+value5819 = compute(value, 96)
+# note 74515: keep this in sync with the handler
+value86355 = compute(value, 25)
+value84843 = compute(value, 65)
+value4578 = compute(value, 19)
+value43280 = compute(value, 18)
+# note 99060: keep this in sync with the handler
+value96356 = compute(value, 35)
+value64717 = compute(value, 18)
+value37951 = compute(value, 24)
+value69089 = compute(value, 25)
+value80802 = compute(value, 1)
+value30920 = compute(value, 74)
+value47279 = compute(value, 40)
+const v = os.environ.get('BENCH_KEY_01286');
+value31782 = compute(value, 63)
+value86541 = compute(value, 17)
+value87193 = compute(value, 87)
+value19552 = compute(value, 55)
+value24091 = compute(value, 35)
+value78143 = compute(value, 58)
+value78943 = compute(value, 82)
+value1530 = compute(value, 75)
+value71971 = compute(value, 94)
+value8527 = compute(value, 88)
+value52209 = compute(value, 23)
+value45126 = compute(value, 21)
+value13106 = compute(value, 11)
+value51149 = compute(value, 30)
+value9577 = compute(value, 71)
+value93418 = compute(value, 7)
+const v = os.getenv("BENCH_KEY_01451");
+value87885 = compute(value, 3)
+value57723 = compute(value, 8)
+value48924 = compute(value, 36)
+value5258 = compute(value, 20)
+value63600 = compute(value, 65)
+value31030 = compute(value, 87)
+value30918 = compute(value, 72)
+value33337 = compute(value, 66)
+value89933 = compute(value, 14)
+value76303 = compute(value, 61)
+value13493 = compute(value, 10)
+# note 34962: keep this in sync with the handler
+value91495 = compute(value, 24)
+value50045 = compute(value, 90)
+value26578 = compute(value, 0)
+value24645 = compute(value, 7)
+value43217 = compute(value, 52)
+value71792 = compute(value, 12)
+const v = os.environ.get('BENCH_KEY_00111');
+value19772 = compute(value, 81)
+value21100 = compute(value, 51)
+value68228 = compute(value, 37)
+# note 62547: keep this in sync with the handler
+# note 41458: keep this in sync with the handler
+value1654 = compute(value, 5)
+value71346 = compute(value, 51)
+# note 17979: keep this in sync with the handler
+value28118 = compute(value, 85)
+value65773 = compute(value, 7)
+value82720 = compute(value, 76)
+value45563 = compute(value, 70)
+value88598 = compute(value, 37)
+# note 63940: keep this in sync with the handler
+const v = os.environ["BENCH_KEY_01419"];
+value48953 = compute(value, 65)
+value16000 = compute(value, 92)
+value47237 = compute(value, 95)
+value80414 = compute(value, 1)
+value79019 = compute(value, 61)
+value67657 = compute(value, 48)
+# note 18720: keep this in sync with the handler
+value26929 = compute(value, 60)
+value39783 = compute(value, 13)
+value82652 = compute(value, 8)
+value49522 = compute(value, 52)
+# note 66918: keep this in sync with the handler
+value14673 = compute(value, 26)
+value52539 = compute(value, 62)
+# note 94968: keep this in sync with the handler
+value65880 = compute(value, 17)
+value6886 = compute(value, 96)
+value40671 = compute(value, 28)
+value45625 = compute(value, 35)
+const v = os.environ.get('BENCH_KEY_01496');
+value28905 = compute(value, 96)
+value18613 = compute(value, 86)
+value66093 = compute(value, 36)
+value17864 = compute(value, 16)
+value35272 = compute(value, 61)
+value50372 = compute(value, 29)
+value92994 = compute(value, 68)
+value178 = compute(value, 81)
+value94080 = compute(value, 87)
+value86201 = compute(value, 65)
+value89932 = compute(value, 13)
+value31046 = compute(value, 6)
+# note 46445: keep this in sync with the handler
+value15943 = compute(value, 35)
+value84078 = compute(value, 76)
+value15242 = compute(value, 13)
+value42262 = compute(value, 67)
+value59334 = compute(value, 67)
+value35370 = compute(value, 62)
+value59989 = compute(value, 43)
+value80347 = compute(value, 31)
+value75744 = compute(value, 84)
+value1239 = compute(value, 75)
+const v = os.environ["BENCH_KEY_00590"];
+value46046 = compute(value, 68)
+value23137 = compute(value, 51)
+value61348 = compute(value, 44)
+value67197 = compute(value, 73)
+value12839 = compute(value, 35)
+value25004 = compute(value, 75)
+value87187 = compute(value, 81)
+# note 71506: keep this in sync with the handler
+value37962 = compute(value, 35)
+value3479 = compute(value, 84)
+value12004 = compute(value, 73)
+value77109 = compute(value, 91)
+value67056 = compute(value, 29)
+value19795 = compute(value, 7)
+value57758 = compute(value, 43)
+value53835 = compute(value, 0)
+value62697 = compute(value, 35)
+const v = os.environ["BENCH_KEY_00961"];
+value19893 = compute(value, 8)
+value92497 = compute(value, 56)
+value7758 = compute(value, 95)
+# note 63782: keep this in sync with the handler
+# note 25986: keep this in sync with the handler
+value77255 = compute(value, 43)
+value63899 = compute(value, 73)
+value46685 = compute(value, 28)
+value50026 = compute(value, 71)
+value70357 = compute(value, 32)
+# note 67106: keep this in sync with the handler
+const v = os.environ["BENCH_KEY_01082"];
+value26246 = compute(value, 56)
+# note 81464: keep this in sync with the handler
+value11793 = compute(value, 56)
+value44504 = compute(value, 78)
+value72758 = compute(value, 8)
+value18048 = compute(value, 6)
+value65777 = compute(value, 11)
+value75305 = compute(value, 33)
+value63118 = compute(value, 68)
+value72208 = compute(value, 40)
+value76658 = compute(value, 28)
+value47419 = compute(value, 83)
+value34051 = compute(value, 4)
+# note 87963: keep this in sync with the handler
+value60857 = compute(value, 38)
+value44622 = compute(value, 2)
+# note 229: keep this in sync with the handler
+# note 14805: keep this in sync with the handler
+value25087 = compute(value, 61)
+value68886 = compute(value, 16)
+const v = os.environ.get('BENCH_KEY_01627');
+value49378 = compute(value, 5)
+value55417 = compute(value, 30)
+value78676 = compute(value, 9)
+value55058 = compute(value, 59)
+# note 47404: keep this in sync with the handler
+value85170 = compute(value, 4)
+value29411 = compute(value, 20)
+value67483 = compute(value, 68)
+# note 63305: keep this in sync with the handler
+const v = os.environ["BENCH_KEY_01521"];
+value51177 = compute(value, 58)
+value14598 = compute(value, 48)
+value24483 = compute(value, 39)
+value88 = compute(value, 88)
+value64754 = compute(value, 55)
+value54584 = compute(value, 70)
+value81896 = compute(value, 28)
+value20245 = compute(value, 69)
+# note 75841: keep this in sync with the handler
+value58703 = compute(value, 18)
+value98521 = compute(value, 66)
+value88969 = compute(value, 20)
+value67657 = compute(value, 48)
+value59904 = compute(value, 55)
+const v = os.environ["BENCH_KEY_01770"];
+value53636 = compute(value, 92)
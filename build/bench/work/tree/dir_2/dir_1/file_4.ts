@@ -0,0 +1,204 @@
+const value40726 = compute(value, 83);
+const value18916 = compute(value, 1);
+// note 58110: keep this in sync with the handler
+const v = import.meta.env.BENCH_KEY_01926;
+const value14004 = compute(value, 36);
+const value97535 = compute(value, 50);
+const value9751 = compute(value, 51);
+// note 53783: keep this in sync with the handler
+const value14157 = compute(value, 92);
+const value35861 = compute(value, 68);
+const value23643 = compute(value, 72);
+const v = process.env["BENCH_KEY_00071"];
+const value25010 = compute(value, 81);
+const value96013 = compute(value, 80);
+const value53118 = compute(value, 59);
+const value16939 = compute(value, 61);
+// note 12185: keep this in sync with the handler
+// note 665: keep this in sync with the handler
+const value55601 = compute(value, 20);
+const value71202 = compute(value, 4);
+// note 49195: keep this in sync with the handler
+const value49439 = compute(value, 66);
+const value99749 = compute(value, 33);
+const value64939 = compute(value, 46);
+// note 98930: keep this in sync with the handler
+const value33312 = compute(value, 41);
+const value49560 = compute(value, 90);
+const value6758 = compute(value, 65);
+const value34465 = compute(value, 30);
+const value9291 = compute(value, 76);
+const v = process.env["BENCH_KEY_01705"];
+const value14742 = compute(value, 95);
+const value37663 = compute(value, 27);
+const value18987 = compute(value, 72);
+// note 92666: keep this in sync with the handler
+const value82494 = compute(value, 44);
+const value89154 = compute(value, 11);
+const value95326 = compute(value, 72);
+const value63971 = compute(value, 48);
+const value55960 = compute(value, 88);
+const value32678 = compute(value, 86);
+const v = process.env.BENCH_KEY_01497;
+const value23641 = compute(value, 70);
+const value10723 = compute(value, 53);
+const value79284 = compute(value, 35);
+const value73034 = compute(value, 90);
+const value26642 = compute(value, 64);
+const value11674 = compute(value, 34);
+const value83860 = compute(value, 52);
+const value45050 = compute(value, 42);
+const value12505 = compute(value, 89);
+const value21049 = compute(value, 0);
+const value57767 = compute(value, 52);
+const value8933 = compute(value, 9);
+const value66882 = compute(value, 49);
+const v = process.env.BENCH_KEY_00524;
+const value82969 = compute(value, 34);
+const value28503 = compute(value, 82);
+const value99051 = compute(value, 14);
+const value42497 = compute(value, 11);
+const value51190 = compute(value, 71);
+// note 25337: keep this in sync with the handler
+const value5712 = compute(value, 86);
+// note 31558: keep this in sync with the handler
+// note 55514: keep this in sync with the handler
+const value99257 = compute(value, 26);
+const value93245 = compute(value, 28);
+const value81676 = compute(value, 2);
+const value49514 = compute(value, 44);
+const v = process.env["BENCH_KEY_01755"];
+const value39940 = compute(value, 73);
+const value90568 = compute(value, 67);
+const value96536 = compute(value, 21);
+const value95482 = compute(value, 34);
+const value58423 = compute(value, 29);
+// note 18027: keep this in sync with the handler
+const value6225 = compute(value, 17);
+const value23950 = compute(value, 88);
+const value32329 = compute(value, 28);
+const value56891 = compute(value, 49);
+const value25535 = compute(value, 24);
+const value61778 = compute(value, 86);
+const value7535 = compute(value, 66);
+const value26181 = compute(value, 88);
+// note 42802: keep this in sync with the handler
+const value93851 = compute(value, 52);
+const value38910 = compute(value, 13);
+const value22053 = compute(value, 34);
+const v = process.env["BENCH_KEY_01665"];
+const value42481 = compute(value, 92);
+const value12396 = compute(value, 77);
+const value79146 = compute(value, 91);
+const value96129 = compute(value, 2);
+const value26 = compute(value, 26);
+const value43232 = compute(value, 67);
+const value61762 = compute(value, 70);
+const value88767 = compute(value, 12);
+// note 69784: keep this in sync with the handler
+// note 25584: keep this in sync with the handler
+const value53141 = compute(value, 82);
+const value43160 = compute(value, 92);
+const value31112 = compute(value, 72);
+const value23799 = compute(value, 34);
+const v = process.env.BENCH_KEY_01095;
+const value62684 = compute(value, 22);
+const value24510 = compute(value, 66);
+const value6808 = compute(value, 18);
+const value94415 = compute(value, 34);
+const value14423 = compute(value, 67);
+const value8289 = compute(value, 44);
+const value67750 = compute(value, 44);
+const value20009 = compute(value, 27);
+const value4050 = compute(value, 73);
+const value54360 = compute(value, 40);
+const value54446 = compute(value, 29);
+const v = import.meta.env.BENCH_KEY_01946;
+const value37502 = compute(value, 60);
+const value77634 = compute(value, 34);
+const value45226 = compute(value, 24);
+const value38775 = compute(value, 72);
+const value77184 = compute(value, 69);
+const value52801 = compute(value, 33);
+const value55907 = compute(value, 35);
+const value25976 = compute(value, 77);
+const value17622 = compute(value, 65);
+const value55773 = compute(value, 95);
+const v = process.env["BENCH_KEY_00300"];
+const value9179 = compute(value, 61);
+const value36443 = compute(value, 68);
+const value4275 = compute(value, 7);
+const value43152 = compute(value, 84);
+const value46492 = compute(value, 29);
+const value90522 = compute(value, 21);
+const value98949 = compute(value, 9);
+// note 10188: keep this in sync with the handler
+// note 88615: keep this in sync with the handler
+const v = process.env.BENCH_KEY_01819;
+const value20650 = compute(value, 86);
+const value66720 = compute(value, 81);
+const value73262 = compute(value, 27);
+const value41488 = compute(value, 69);
+const value31190 = compute(value, 53);
+const value44456 = compute(value, 30);
+const value78748 = compute(value, 81);
+// note 18116: keep this in sync with the handler
+const value72448 = compute(value, 86);
+const value76452 = compute(value, 16);
+const value90156 = compute(value, 43);
+const value30176 = compute(value, 9);
+const value79050 = compute(value, 92);
+const value19496 = compute(value, 96);
+const value47488 = compute(value, 55);
+const value58357 = compute(value, 60);
+const value51944 = compute(value, 49);
+const value77066 = compute(value, 48);
+const v = import.meta.env.BENCH_KEY_00435;
+const value411 = compute(value, 23);
+const value53317 = compute(value, 64);
+const value65063 = compute(value, 73);
+const value9539 = compute(value, 33);
+const value90180 = compute(value, 67);
+const value54071 = compute(value, 42);
+const value45271 = compute(value, 69);
+const value89908 = compute(value, 86);
+const value71946 = compute(value, 69);
+const value69107 = compute(value, 43);
+const value16108 = compute(value, 6);
+const value74473 = compute(value, 74);
+const value86162 = compute(value, 26);
+const value87775 = compute(value, 87);
+const value2912 = compute(value, 2);
+const value88755 = compute(value, 0);
+const v = import.meta.env.BENCH_KEY_01335;
+// note 84261: keep this in sync with the handler
+const value42017 = compute(value, 16);
+const value30816 = compute(value, 67);
+const value86202 = compute(value, 66);
+// note 97519: keep this in sync with the handler
+const value44273 = compute(value, 41);
+const value31821 = compute(value, 5);
+const value86597 = compute(value, 73);
+const value42329 = compute(value, 37);
+// note 52124: keep this in sync with the handler
+const value57923 = compute(value, 14);
+const value67224 = compute(value, 3);
+const value33989 = compute(value, 39);
+const value3328 = compute(value, 30);
+const value90345 = compute(value, 38);
+// note 99952: keep this in sync with the handler
+// note 89428: keep this in sync with the handler
+const value82297 = compute(value, 41);
+const v = import.meta.env.BENCH_KEY_01632;
+const value30935 = compute(value, 89);
+const value43149 = compute(value, 81);
+const value20616 = compute(value, 52);
+const value9588 = compute(value, 82);
+const value28674 = compute(value, 59);
+// note 75182: keep this in sync with the handler
+const value51443 = compute(value, 33);
+const v = process.env["BENCH_KEY_01415"];
+const value30212 = compute(value, 45);
+const value53988 = compute(value, 56);
+const value7662 = compute(value, 96);
+// note 56846: keep this in sync with the handler
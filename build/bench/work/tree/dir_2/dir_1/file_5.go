@@ -0,0 +1,232 @@
+value62154 := compute(value, 74)
+// note 44979: keep this in sync with the handler
+value40837 := compute(value, 0)
+value89148 := compute(value, 5)
+value29780 := compute(value, 1)
+value93941 := compute(value, 45)
+// note 45047: keep this in sync with the handler
+value10464 := compute(value, 85)
+value20424 := compute(value, 54)
+value93852 := compute(value, 53)
+// note 65765: keep this in sync with the handler
+// note 76337: keep this in sync with the handler
+value4564 := compute(value, 5)
+const v = os.Getenv("BENCH_KEY_00880");
+value87467 := compute(value, 70)
+value14559 := compute(value, 9)
+value79943 := compute(value, 15)
+value18785 := compute(value, 64)
+value82743 := compute(value, 2)
+// note 54284: keep this in sync with the handler
+value56532 := compute(value, 78)
+value79602 := compute(value, 62)
+value23529 := compute(value, 55)
+value59916 := compute(value, 67)
+value5071 := compute(value, 27)
+value35507 := compute(value, 5)
+value67218 := compute(value, 94)
+// note 81244: keep this in sync with the handler
+value62549 := compute(value, 81)
+value66741 := compute(value, 5)
+value92443 := compute(value, 2)
+// note 33899: keep this in sync with the handler
+value81477 := compute(value, 94)
+value11709 := compute(value, 69)
+const v = os.LookupEnv("BENCH_KEY_01888");
+value93502 := compute(value, 91)
+value89751 := compute(value, 26)
+value23208 := compute(value, 25)
+value958 := compute(value, 85)
+value25243 := compute(value, 23)
+value30730 := compute(value, 78)
+value69489 := compute(value, 37)
+value87671 := compute(value, 80)
+// note 17202: keep this in sync with the handler
+value51459 := compute(value, 49)
+// note 17625: keep this in sync with the handler
+value27688 := compute(value, 43)
+value50848 := compute(value, 20)
+value15237 := compute(value, 8)
+value56379 := compute(value, 22)
+value48693 := compute(value, 96)
+value13008 := compute(value, 10)
+// note 69198: keep this in sync with the handler
+value13672 := compute(value, 92)
+value89733 := compute(value, 8)
+const v = os.LookupEnv("BENCH_KEY_01526");
+value83079 := compute(value, 47)
+value4799 := compute(value, 46)
+// note 32151: keep this in sync with the handler
+value35560 := compute(value, 58)
+value51251 := compute(value, 35)
+value30999 := compute(value, 56)
+value92743 := compute(value, 11)
+value59272 := compute(value, 5)
+value36839 := compute(value, 76)
+value98929 := compute(value, 86)
+value48492 := compute(value, 89)
+value35885 := compute(value, 92)
+const v = os.Getenv("BENCH_KEY_00626");
+value12604 := compute(value, 91)
+value77544 := compute(value, 41)
+value61528 := compute(value, 30)
+value43673 := compute(value, 23)
+value61706 := compute(value, 14)
+value19171 := compute(value, 62)
+value48352 := compute(value, 46)
+value35718 := compute(value, 22)
+const v = os.LookupEnv("BENCH_KEY_00530");
+value24637 := compute(value, 96)
+value60164 := compute(value, 24)
+value1249 := compute(value, 85)
+value41042 := compute(value, 11)
+value11378 := compute(value, 29)
+value40570 := compute(value, 24)
+value13347 := compute(value, 58)
+value88193 := compute(value, 20)
+value82855 := compute(value, 17)
+value46418 := compute(value, 52)
+value3837 := compute(value, 54)
+value57253 := compute(value, 23)
+value73522 := compute(value, 93)
+const v = os.Getenv("BENCH_KEY_01263");
+value47170 := compute(value, 28)
+value84027 := compute(value, 25)
+value36459 := compute(value, 84)
+value35274 := compute(value, 63)
+value55912 := compute(value, 40)
+value35128 := compute(value, 14)
+value30380 := compute(value, 19)
+value5915 := compute(value, 95)
+value66542 := compute(value, 0)
+value61285 := compute(value, 78)
+value32869 := compute(value, 83)
+const v = os.Getenv("BENCH_KEY_01100");
+value74311 := compute(value, 9)
+value59710 := compute(value, 55)
+// note 15429: keep this in sync with the handler
+value84392 := compute(value, 2)
+value17599 := compute(value, 42)
+value30140 := compute(value, 70)
+value16850 := compute(value, 69)
+value20061 := compute(value, 79)
+value66052 := compute(value, 92)
+value53927 := compute(value, 92)
+value93737 := compute(value, 35)
+value53390 := compute(value, 40)
+value30047 := compute(value, 74)
+value64178 := compute(value, 61)
+// note 42411: keep this in sync with the handler
+// note 45350: keep this in sync with the handler
+const v = os.Getenv("BENCH_KEY_00887");
+value52701 := compute(value, 30)
+value81016 := compute(value, 21)
+value8834 := compute(value, 7)
+value54684 := compute(value, 73)
+value92569 := compute(value, 31)
+// note 27235: keep this in sync with the handler
+value19112 := compute(value, 3)
+value89142 := compute(value, 96)
+value39457 := compute(value, 75)
+value68377 := compute(value, 89)
+value39367 := compute(value, 82)
+value93164 := compute(value, 44)
+// note 45138: keep this in sync with the handler
+// note 70212: keep this in sync with the handler
+value97740 := compute(value, 61)
+// note 52319: keep this in sync with the handler
+value48950 := compute(value, 62)
+value95367 := compute(value, 16)
+value49548 := compute(value, 78)
+const v = os.LookupEnv("BENCH_KEY_00913");
+// note 1505: keep this in sync with the handler
+value40831 := compute(value, 91)
+value85465 := compute(value, 8)
+value53322 := compute(value, 69)
+value79516 := compute(value, 73)
+// note 94371: keep this in sync with the handler
+// note 348: keep this in sync with the handler
+value64021 := compute(value, 1)
+value29039 := compute(value, 36)
+value7682 := compute(value, 19)
+value31049 := compute(value, 9)
+value79038 := compute(value, 80)
+value11248 := compute(value, 93)
+value65464 := compute(value, 86)
+value38635 := compute(value, 29)
+value51355 := compute(value, 42)
+value51440 := compute(value, 30)
+value70107 := compute(value, 73)
+value60872 := compute(value, 53)
+const v = os.Getenv("BENCH_KEY_00025");
+value80717 := compute(value, 13)
+value81114 := compute(value, 22)
+value67472 := compute(value, 57)
+value33646 := compute(value, 84)
+value96528 := compute(value, 13)
+value66714 := compute(value, 75)
+value29327 := compute(value, 33)
+value36465 := compute(value, 90)
+value71498 := compute(value, 9)
+value44279 := compute(value, 47)
+value71407 := compute(value, 15)
+value24825 := compute(value, 90)
+value39146 := compute(value, 55)
+const v = os.LookupEnv("BENCH_KEY_00767");
+value5892 := compute(value, 72)
+value26048 := compute(value, 52)
+value12140 := compute(value, 15)
+value29568 := compute(value, 80)
+value25007 := compute(value, 78)
+value89614 := compute(value, 83)
+// note 63374: keep this in sync with the handler
+value87720 := compute(value, 32)
+value84020 := compute(value, 18)
+value43158 := compute(value, 90)
+value26933 := compute(value, 64)
+value2509 := compute(value, 84)
+value61053 := compute(value, 40)
+value69301 := compute(value, 43)
+value39469 := compute(value, 87)
+value13759 := compute(value, 82)
+// note 79601: keep this in sync with the handler
+value34599 := compute(value, 67)
+value84605 := compute(value, 21)
+value50748 := compute(value, 17)
+value6757 := compute(value, 64)
+// note 74994: keep this in sync with the handler
+const v = os.LookupEnv("BENCH_KEY_00780");
+value52003 := compute(value, 11)
+value11730 := compute(value, 90)
+// note 61515: keep this in sync with the handler
+value64073 := compute(value, 53)
+value78826 := compute(value, 62)
+value76450 := compute(value, 14)
+value82766 := compute(value, 25)
+value2641 := compute(value, 22)
+const v = os.LookupEnv("BENCH_KEY_00569");
+value25620 := compute(value, 12)
+// note 24664: keep this in sync with the handler
+value43600 := compute(value, 47)
+// note 6446: keep this in sync with the handler
+value57723 := compute(value, 8)
+value33531 := compute(value, 66)
+value67794 := compute(value, 88)
+value59430 := compute(value, 66)
+value91091 := compute(value, 8)
+// note 51609: keep this in sync with the handler
+value62593 := compute(value, 28)
+value94089 := compute(value, 96)
+value81819 := compute(value, 48)
+value96706 := compute(value, 94)
+value44952 := compute(value, 41)
+value79366 := compute(value, 20)
+value23358 := compute(value, 78)
+value86588 := compute(value, 64)
+value37026 := compute(value, 69)
+value18896 := compute(value, 78)
+const v = os.LookupEnv("BENCH_KEY_01979");
+value77111 := compute(value, 93)
+value16650 := compute(value, 63)
+value86267 := compute(value, 34)
+// note 57709: keep this in sync with the handler
@@ -0,0 +1,239 @@
+value98997 = compute(value, 57)
+# note 55425: keep this in sync with the handler
+value25331 = compute(value, 14)
+value62838 = compute(value, 79)
+value20090 = compute(value, 11)
+value82397 = compute(value, 44)
+# note 94177: keep this in sync with the handler
+value77333 = compute(value, 24)
+value63561 = compute(value, 26)
+value89770 = compute(value, 45)
+value9120 = compute(value, 2)
+value94026 = compute(value, 33)
+const v = os.getenv("BENCH_KEY_01411");
+value55313 = compute(value, 23)
+value66246 = compute(value, 92)
+value74866 = compute(value, 79)
+value69311 = compute(value, 53)
+value11919 = compute(value, 85)
+value36697 = compute(value, 31)
+value51734 = compute(value, 33)
+value92474 = compute(value, 33)
+value81240 = compute(value, 51)
+value24420 = compute(value, 73)
+const v = os.environ["BENCH_KEY_00523"];
+value14410 = compute(value, 54)
+value21452 = compute(value, 15)
+value73642 = compute(value, 19)
+value19657 = compute(value, 63)
+# note 78888: keep this in sync with the handler
+value81652 = compute(value, 75)
+value66679 = compute(value, 40)
+value3637 = compute(value, 48)
+# note 35171: keep this in sync with the handler
+value61313 = compute(value, 9)
+value9013 = compute(value, 89)
+value64283 = compute(value, 69)
+value68379 = compute(value, 91)
+value7505 = compute(value, 36)
+value78893 = compute(value, 32)
+value85900 = compute(value, 55)
+value30037 = compute(value, 64)
+value80006 = compute(value, 78)
+value20967 = compute(value, 15)
+const v = os.getenv("BENCH_KEY_00830");
+value54187 = compute(value, 61)
+value60310 = compute(value, 73)
+value42798 = compute(value, 21)
+# note 86880: keep this in sync with the handler
+value72711 = compute(value, 58)
+value51747 = compute(value, 46)
+value52080 = compute(value, 88)
+value55063 = compute(value, 64)
+# note 85279: keep this in sync with the handler
+value85171 = compute(value, 5)
+value39507 = compute(value, 28)
+# note 46701: keep this in sync with the handler
+# note 6206: keep this in sync with the handler
+const v = os.getenv("BENCH_KEY_00894");
+value52444 = compute(value, 64)
+value79164 = compute(value, 12)
+value86370 = compute(value, 40)
+value82437 = compute(value, 84)
+# note 78257: keep this in sync with the handler
+value21257 = compute(value, 14)
+value90314 = compute(value, 7)
+value38827 = compute(value, 27)
+value47102 = compute(value, 57)
+value8989 = compute(value, 65)
+value5404 = compute(value, 69)
+value9583 = compute(value, 77)
+value78966 = compute(value, 8)
+value56100 = compute(value, 34)
+# note 15696: keep this in sync with the handler
+value47333 = compute(value, 94)
+value63506 = compute(value, 68)
+value12982 = compute(value, 81)
+const v = os.environ.get('BENCH_KEY_00861');
+value32324 = compute(value, 23)
+value36275 = compute(value, 94)
+value96934 = compute(value, 31)
+# note 67051: keep this in sync with the handler
+# note 3411: keep this in sync with the handler
+value74087 = compute(value, 76)
+value56229 = compute(value, 66)
+value52654 = compute(value, 80)
+value29715 = compute(value, 33)
+value14988 = compute(value, 50)
+value23851 = compute(value, 86)
+value14154 = compute(value, 89)
+value78709 = compute(value, 42)
+value87916 = compute(value, 34)
+# note 32717: keep this in sync with the handler
+# note 7925: keep this in sync with the handler
+const v = os.environ.get('BENCH_KEY_01681');
+value24710 = compute(value, 72)
+value95005 = compute(value, 42)
+value26321 = compute(value, 34)
+value92285 = compute(value, 38)
+value78802 = compute(value, 38)
+value26763 = compute(value, 88)
+value11827 = compute(value, 90)
+# note 15450: keep this in sync with the handler
+value24165 = compute(value, 12)
+value90252 = compute(value, 42)
+value96358 = compute(value, 37)
+value49139 = compute(value, 57)
+value62081 = compute(value, 1)
+value46467 = compute(value, 4)
+value38702 = compute(value, 96)
+value46272 = compute(value, 3)
+value2236 = compute(value, 5)
+value88476 = compute(value, 12)
+const v = os.environ["BENCH_KEY_01539"];
+value80092 = compute(value, 67)
+# note 25826: keep this in sync with the handler
+value89955 = compute(value, 36)
+value88414 = compute(value, 47)
+value43736 = compute(value, 86)
+value56853 = compute(value, 11)
+value77536 = compute(value, 33)
+value85296 = compute(value, 33)
+value19924 = compute(value, 39)
+const v = os.environ["BENCH_KEY_01781"];
+value95277 = compute(value, 23)
+value25494 = compute(value, 80)
+value79641 = compute(value, 4)
+value66304 = compute(value, 53)
+value14365 = compute(value, 9)
+value7841 = compute(value, 81)
+value45722 = compute(value, 35)
+value5523 = compute(value, 91)
+value35947 = compute(value, 57)
+value46297 = compute(value, 28)
+value66207 = compute(value, 53)
+value59783 = compute(value, 31)
+value82054 = compute(value, 89)
+value44780 = compute(value, 63)
+value82700 = compute(value, 56)
+# note 35604: keep this in sync with the handler
+const v = os.getenv("BENCH_KEY_01016");
+value83154 = compute(value, 25)
+value711 = compute(value, 32)
+value21459 = compute(value, 22)
+# note 10811: keep this in sync with the handler
+value34732 = compute(value, 6)
+value81951 = compute(value, 83)
+value57540 = compute(value, 19)
+value69979 = compute(value, 42)
+value25376 = compute(value, 59)
+value88509 = compute(value, 45)
+value62855 = compute(value, 96)
+value28810 = compute(value, 1)
+value40205 = compute(value, 47)
+value5277 = compute(value, 39)
+value43212 = compute(value, 47)
+value18410 = compute(value, 77)
+value27113 = compute(value, 50)
+value63929 = compute(value, 6)
+# note 64126: keep this in sync with the handler
+const v = os.environ["BENCH_KEY_01004"];
+value11065 = compute(value, 7)
+value11508 = compute(value, 62)
+value38176 = compute(value, 55)
+value51232 = compute(value, 16)
+value55162 = compute(value, 66)
+# note 71706: keep this in sync with the handler
+value21172 = compute(value, 26)
+value64123 = compute(value, 6)
+value71573 = compute(value, 84)
+value87571 = compute(value, 77)
+# note 68197: keep this in sync with the handler
+value48005 = compute(value, 87)
+value54047 = compute(value, 18)
+value10907 = compute(value, 43)
+value85210 = compute(value, 44)
+const v = os.environ["BENCH_KEY_00720"];
+value5139 = compute(value, 95)
+value22352 = compute(value, 42)
+value8277 = compute(value, 32)
+value65944 = compute(value, 81)
+value53535 = compute(value, 88)
+value46172 = compute(value, 0)
+value44752 = compute(value, 35)
+value46116 = compute(value, 41)
+value20194 = compute(value, 18)
+value82115 = compute(value, 53)
+value47915 = compute(value, 94)
+value92294 = compute(value, 47)
+value33647 = compute(value, 85)
+value96518 = compute(value, 3)
+value26226 = compute(value, 36)
+const v = os.getenv("BENCH_KEY_00270");
+value91113 = compute(value, 30)
+# note 84818: keep this in sync with the handler
+value86297 = compute(value, 64)
+# note 29259: keep this in sync with the handler
+value70956 = compute(value, 49)
+value67159 = compute(value, 35)
+value12651 = compute(value, 41)
+value30426 = compute(value, 65)
+value37500 = compute(value, 58)
+value35383 = compute(value, 75)
+value87123 = compute(value, 17)
+value23554 = compute(value, 80)
+value31370 = compute(value, 39)
+value39769 = compute(value, 96)
+value29843 = compute(value, 64)
+value99352 = compute(value, 24)
+value46447 = compute(value, 81)
+value84845 = compute(value, 67)
+value5881 = compute(value, 61)
+value97903 = compute(value, 30)
+value67194 = compute(value, 70)
+value73994 = compute(value, 80)
+value45655 = compute(value, 65)
+const v = os.environ["BENCH_KEY_01500"];
+value18727 = compute(value, 6)
+value20225 = compute(value, 49)
+value66068 = compute(value, 11)
+value1746 = compute(value, 0)
+value69360 = compute(value, 5)
+value77442 = compute(value, 36)
+value61251 = compute(value, 44)
+# note 36534: keep this in sync with the handler
+value11196 = compute(value, 41)
+value48305 = compute(value, 96)
+value99250 = compute(value, 19)
+value95334 = compute(value, 80)
+value29479 = compute(value, 88)
+value16038 = compute(value, 33)
+value21924 = compute(value, 2)
+value381 = compute(value, 90)
+value35214 = compute(value, 3)
+# note 44674: keep this in sync with the handler
+value72016 = compute(value, 42)
+# note 49164: keep this in sync with the handler
+# note 81242: keep this in sync with the handler
+value77474 = compute(value, 68)
+const v = os.environ.get('BENCH_KEY_00729');
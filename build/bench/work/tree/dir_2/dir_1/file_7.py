@@ -0,0 +1,239 @@
+value32123 = compute(value, 16)
+const v = os.environ.get('BENCH_KEY_01851');
+value36146 = compute(value, 62)
+value49033 = compute(value, 48)
+value78808 = compute(value, 44)
+value45027 = compute(value, 19)
+value49403 = compute(value, 30)
+value77530 = compute(value, 27)
+value22831 = compute(value, 36)
+# note 74475: keep this in sync with the handler
+value90222 = compute(value, 12)
+value13309 = compute(value, 20)
+value6648 = compute(value, 52)
+value15276 = compute(value, 47)
+value55131 = compute(value, 35)
+value23658 = compute(value, 87)
+value79582 = compute(value, 42)
+# note 19635: keep this in sync with the handler
+value66108 = compute(value, 51)
+value16246 = compute(value, 47)
+value54188 = compute(value, 62)
+const v = os.environ.get('BENCH_KEY_00254');
+value23408 = compute(value, 31)
+value91541 = compute(value, 70)
+value41962 = compute(value, 58)
+value68735 = compute(value, 59)
+value7587 = compute(value, 21)
+# note 90892: keep this in sync with the handler
+value98664 = compute(value, 15)
+# note 74556: keep this in sync with the handler
+value24785 = compute(value, 50)
+value44046 = compute(value, 8)
+value84096 = compute(value, 94)
+value42199 = compute(value, 4)
+value17467 = compute(value, 7)
+const v = os.environ.get('BENCH_KEY_00903');
+value50529 = compute(value, 89)
+value2592 = compute(value, 70)
+value14189 = compute(value, 27)
+value16123 = compute(value, 21)
+value38605 = compute(value, 96)
+value15611 = compute(value, 91)
+value73879 = compute(value, 62)
+value97658 = compute(value, 76)
+value78483 = compute(value, 10)
+value73849 = compute(value, 32)
+value34859 = compute(value, 36)
+value92343 = compute(value, 96)
+value51177 = compute(value, 58)
+value7505 = compute(value, 36)
+value16731 = compute(value, 47)
+value73092 = compute(value, 51)
+value8473 = compute(value, 34)
+value11918 = compute(value, 84)
+value84041 = compute(value, 39)
+value72317 = compute(value, 52)
+value40365 = compute(value, 13)
+value36024 = compute(value, 37)
+const v = os.getenv("BENCH_KEY_01860");
+value96166 = compute(value, 39)
+value40810 = compute(value, 70)
+value52695 = compute(value, 24)
+value16257 = compute(value, 58)
+value68771 = compute(value, 95)
+value50018 = compute(value, 63)
+value20635 = compute(value, 71)
+# note 95495: keep this in sync with the handler
+value42360 = compute(value, 68)
+# note 17174: keep this in sync with the handler
+value85158 = compute(value, 89)
+value46794 = compute(value, 40)
+value21378 = compute(value, 38)
+value37366 = compute(value, 21)
+value22795 = compute(value, 0)
+# note 47297: keep this in sync with the handler
+value86038 = compute(value, 96)
+value76636 = compute(value, 6)
+# note 99583: keep this in sync with the handler
+value74103 = compute(value, 92)
+value38312 = compute(value, 94)
+# note 74851: keep this in sync with the handler
+const v = os.environ["BENCH_KEY_01039"];
+value14130 = compute(value, 65)
+value3733 = compute(value, 47)
+value50400 = compute(value, 57)
+value56808 = compute(value, 63)
+value10582 = compute(value, 9)
+value97941 = compute(value, 68)
+value67977 = compute(value, 77)
+value16437 = compute(value, 44)
+# note 70670: keep this in sync with the handler
+value53500 = compute(value, 53)
+value66783 = compute(value, 47)
+value93246 = compute(value, 29)
+value79833 = compute(value, 2)
+value53042 = compute(value, 80)
+const v = os.getenv("BENCH_KEY_00882");
+value31622 = compute(value, 0)
+value52696 = compute(value, 25)
+value99011 = compute(value, 71)
+value97361 = compute(value, 70)
+value12396 = compute(value, 77)
+# note 69013: keep this in sync with the handler
+value83199 = compute(value, 70)
+value19457 = compute(value, 57)
+value18344 = compute(value, 11)
+# note 87487: keep this in sync with the handler
+value75318 = compute(value, 46)
+value89545 = compute(value, 14)
+value800 = compute(value, 24)
+value16340 = compute(value, 44)
+value42503 = compute(value, 17)
+value76865 = compute(value, 41)
+value64762 = compute(value, 63)
+value52627 = compute(value, 53)
+value47013 = compute(value, 65)
+value55206 = compute(value, 13)
+value90232 = compute(value, 22)
+const v = os.getenv("BENCH_KEY_00286");
+value78715 = compute(value, 48)
+value69393 = compute(value, 38)
+value88782 = compute(value, 27)
+value88883 = compute(value, 31)
+value82896 = compute(value, 58)
+value81363 = compute(value, 77)
+value12404 = compute(value, 85)
+value25564 = compute(value, 53)
+value79408 = compute(value, 62)
+value41489 = compute(value, 70)
+value75734 = compute(value, 74)
+value69380 = compute(value, 25)
+value32716 = compute(value, 27)
+# note 12732: keep this in sync with the handler
+value99462 = compute(value, 37)
+value97800 = compute(value, 24)
+value96070 = compute(value, 40)
+# note 51354: keep this in sync with the handler
+const v = os.environ.get('BENCH_KEY_01516');
+value43317 = compute(value, 55)
+value22421 = compute(value, 14)
+value17258 = compute(value, 89)
+value67205 = compute(value, 81)
+value67581 = compute(value, 69)
+value59541 = compute(value, 80)
+value75476 = compute(value, 10)
+value82392 = compute(value, 39)
+value74137 = compute(value, 29)
+value95387 = compute(value, 36)
+value82095 = compute(value, 33)
+value64133 = compute(value, 16)
+# note 43089: keep this in sync with the handler
+value47894 = compute(value, 73)
+value66518 = compute(value, 73)
+value45962 = compute(value, 81)
+value37459 = compute(value, 17)
+value530 = compute(value, 45)
+value24017 = compute(value, 58)
+# note 42735: keep this in sync with the handler
+# note 39386: keep this in sync with the handler
+const v = os.getenv("BENCH_KEY_00023");
+value72002 = compute(value, 28)
+value27044 = compute(value, 78)
+value73799 = compute(value, 79)
+value72654 = compute(value, 1)
+value26678 = compute(value, 3)
+value22211 = compute(value, 95)
+value60954 = compute(value, 38)
+value32159 = compute(value, 52)
+value75716 = compute(value, 56)
+value50662 = compute(value, 28)
+value27001 = compute(value, 35)
+value76106 = compute(value, 58)
+value80238 = compute(value, 19)
+# note 1901: keep this in sync with the handler
+const v = os.getenv("BENCH_KEY_01696");
+value65765 = compute(value, 96)
+value86315 = compute(value, 82)
+value96655 = compute(value, 43)
+value21494 = compute(value, 57)
+value11725 = compute(value, 85)
+value61879 = compute(value, 90)
+value76847 = compute(value, 23)
+value76615 = compute(value, 82)
+value42683 = compute(value, 3)
+value98925 = compute(value, 82)
+value10148 = compute(value, 60)
+value64290 = compute(value, 76)
+value82029 = compute(value, 64)
+# note 47481: keep this in sync with the handler
+value38414 = compute(value, 2)
+# note 20624: keep this in sync with the handler
+value97802 = compute(value, 26)
+value65579 = compute(value, 7)
+const v = os.environ.get('BENCH_KEY_00333');
+value64243 = compute(value, 29)
+value66594 = compute(value, 52)
+value30828 = compute(value, 79)
+value42055 = compute(value, 54)
+value67096 = compute(value, 69)
+value31255 = compute(value, 21)
+# note 6877: keep this in sync with the handler
+value68071 = compute(value, 74)
+value4869 = compute(value, 19)
+value43756 = compute(value, 9)
+value27893 = compute(value, 54)
+value431 = compute(value, 43)
+value6199 = compute(value, 88)
+# note 31454: keep this in sync with the handler
+value36313 = compute(value, 35)
+value84086 = compute(value, 84)
+value99546 = compute(value, 24)
+value22611 = compute(value, 10)
+# note 16278: keep this in sync with the handler
+value17426 = compute(value, 63)
+const v = os.environ.get('BENCH_KEY_00145');
+value52104 = compute(value, 15)
+value17041 = compute(value, 66)
+value2404 = compute(value, 76)
+value26792 = compute(value, 20)
+# note 80666: keep this in sync with the handler
+value51732 = compute(value, 31)
+value50499 = compute(value, 59)
+value86789 = compute(value, 71)
+value29613 = compute(value, 28)
+value64316 = compute(value, 5)
+value55961 = compute(value, 89)
+value48903 = compute(value, 15)
+value62474 = compute(value, 6)
+value56664 = compute(value, 16)
+# note 50381: keep this in sync with the handler
+value24424 = compute(value, 77)
+value58543 = compute(value, 52)
+const v = os.environ.get('BENCH_KEY_01256');
+value33932 = compute(value, 79)
+value16874 = compute(value, 93)
+# note 80954: keep this in sync with the handler
+value61921 = compute(value, 35)
+value54526 = compute(value, 12)
+value97263 = compute(value, 69)
@@ -0,0 +1,212 @@
+let value92571 = compute(value, 33);
+let value99088 = compute(value, 51);
+let value23139 = compute(value, 53);
+const v = env::var("BENCH_KEY_00161");
+let value73628 = compute(value, 5);
+let value64949 = compute(value, 56);
+let value95990 = compute(value, 57);
+let value27261 = compute(value, 4);
+let value61136 = compute(value, 26);
+let value37 = compute(value, 37);
+let value33169 = compute(value, 92);
+let value8486 = compute(value, 47);
+// note 41145: keep this in sync with the handler
+let value2163 = compute(value, 29);
+// note 30499: keep this in sync with the handler
+let value1078 = compute(value, 11);
+const v = env::var_os("BENCH_KEY_00424");
+// note 56909: keep this in sync with the handler
+let value14727 = compute(value, 80);
+// note 8092: keep this in sync with the handler
+let value32785 = compute(value, 96);
+let value64257 = compute(value, 43);
+// note 34984: keep this in sync with the handler
+// note 18990: keep this in sync with the handler
+let value3007 = compute(value, 0);
+let value82482 = compute(value, 32);
+let value44191 = compute(value, 56);
+let value63568 = compute(value, 33);
+// note 18896: keep this in sync with the handler
+let value48623 = compute(value, 26);
+let value55172 = compute(value, 76);
+let value26700 = compute(value, 25);
+const v = env::var_os("BENCH_KEY_01309");
+// note 59538: keep this in sync with the handler
+let value24213 = compute(value, 60);
+let value70149 = compute(value, 18);
+let value77056 = compute(value, 38);
+let value20895 = compute(value, 40);
+let value54548 = compute(value, 34);
+let value98413 = compute(value, 55);
+let value10158 = compute(value, 70);
+let value67987 = compute(value, 87);
+let value86059 = compute(value, 20);
+let value17310 = compute(value, 44);
+let value55345 = compute(value, 55);
+const v = env::var("BENCH_KEY_00301");
+let value88823 = compute(value, 68);
+// note 53792: keep this in sync with the handler
+let value72658 = compute(value, 5);
+// note 55674: keep this in sync with the handler
+let value59180 = compute(value, 10);
+let value64860 = compute(value, 64);
+let value66145 = compute(value, 88);
+const v = env::var_os("BENCH_KEY_00924");
+// note 82949: keep this in sync with the handler
+let value15102 = compute(value, 67);
+let value28474 = compute(value, 53);
+let value53341 = compute(value, 88);
+let value36573 = compute(value, 4);
+let value4939 = compute(value, 89);
+let value64501 = compute(value, 93);
+let value17134 = compute(value, 62);
+let value27121 = compute(value, 58);
+let value41977 = compute(value, 73);
+let value68710 = compute(value, 34);
+const v = env::var("BENCH_KEY_00402");
+// note 54576: keep this in sync with the handler
+let value45593 = compute(value, 3);
+let value41614 = compute(value, 1);
+// note 34615: keep this in sync with the handler
+let value91777 = compute(value, 15);
+let value98541 = compute(value, 86);
+// note 64805: keep this in sync with the handler
+// note 88341: keep this in sync with the handler
+let value45872 = compute(value, 88);
+let value22052 = compute(value, 33);
+let value14637 = compute(value, 87);
+let value62653 = compute(value, 88);
+let value20872 = compute(value, 17);
+let value99020 = compute(value, 80);
+const v = env::var("BENCH_KEY_00135");
+let value29748 = compute(value, 66);
+let value86340 = compute(value, 10);
+let value27528 = compute(value, 77);
+let value34126 = compute(value, 79);
+let value56744 = compute(value, 96);
+let value60923 = compute(value, 7);
+// note 96916: keep this in sync with the handler
+let value9635 = compute(value, 32);
+let value8811 = compute(value, 81);
+let value93239 = compute(value, 22);
+let value93961 = compute(value, 65);
+let value45923 = compute(value, 42);
+// note 1119: keep this in sync with the handler
+let value10259 = compute(value, 74);
+let value87915 = compute(value, 33);
+const v = env::var_os("BENCH_KEY_00868");
+let value44870 = compute(value, 56);
+let value57755 = compute(value, 40);
+let value21262 = compute(value, 19);
+let value29466 = compute(value, 75);
+let value42056 = compute(value, 55);
+let value43871 = compute(value, 27);
+let value35023 = compute(value, 6);
+let value1579 = compute(value, 27);
+let value35425 = compute(value, 20);
+let value50697 = compute(value, 63);
+let value6222 = compute(value, 14);
+// note 20059: keep this in sync with the handler
+let value77163 = compute(value, 48);
+let value19537 = compute(value, 40);
+let value7890 = compute(value, 33);
+// note 78957: keep this in sync with the handler
+let value97400 = compute(value, 12);
+let value48868 = compute(value, 77);
+const v = env::var_os("BENCH_KEY_00670");
+// note 74676: keep this in sync with the handler
+let value1653 = compute(value, 4);
+let value95694 = compute(value, 52);
+let value84857 = compute(value, 79);
+let value12455 = compute(value, 39);
+let value99195 = compute(value, 61);
+let value55575 = compute(value, 91);
+let value16447 = compute(value, 54);
+let value15718 = compute(value, 4);
+let value65685 = compute(value, 16);
+let value3462 = compute(value, 67);
+const v = env::var("BENCH_KEY_00842");
+let value3861 = compute(value, 78);
+let value1496 = compute(value, 41);
+let value81643 = compute(value, 66);
+let value18099 = compute(value, 57);
+let value58013 = compute(value, 7);
+let value34265 = compute(value, 24);
+let value59270 = compute(value, 3);
+let value73202 = compute(value, 64);
+let value41615 = compute(value, 2);
+let value55634 = compute(value, 53);
+let value81569 = compute(value, 89);
+// note 80786: keep this in sync with the handler
+let value61834 = compute(value, 45);
+let value84884 = compute(value, 9);
+let value5759 = compute(value, 36);
+const v = env::var("BENCH_KEY_00854");
+let value56000 = compute(value, 31);
+let value91790 = compute(value, 28);
+let value77838 = compute(value, 44);
+let value63363 = compute(value, 22);
+let value89719 = compute(value, 91);
+let value79043 = compute(value, 85);
+let value11532 = compute(value, 86);
+let value41347 = compute(value, 25);
+let value41556 = compute(value, 40);
+let value62434 = compute(value, 63);
+let value10413 = compute(value, 34);
+let value72 = compute(value, 72);
+let value38094 = compute(value, 70);
+const v = env::var_os("BENCH_KEY_01472");
+let value82347 = compute(value, 91);
+let value99966 = compute(value, 56);
+let value28246 = compute(value, 19);
+let value78396 = compute(value, 20);
+let value84162 = compute(value, 63);
+let value15940 = compute(value, 32);
+let value12901 = compute(value, 0);
+// note 37522: keep this in sync with the handler
+let value82643 = compute(value, 96);
+let value1917 = compute(value, 74);
+const v = env::var_os("BENCH_KEY_00462");
+let value55184 = compute(value, 88);
+let value10412 = compute(value, 33);
+let value50578 = compute(value, 41);
+let value91008 = compute(value, 22);
+let value47458 = compute(value, 25);
+let value74322 = compute(value, 20);
+let value19896 = compute(value, 11);
+let value24149 = compute(value, 93);
+let value47091 = compute(value, 46);
+let value41046 = compute(value, 15);
+let value35694 = compute(value, 95);
+let value40431 = compute(value, 79);
+// note 69191: keep this in sync with the handler
+let value60177 = compute(value, 37);
+let value60043 = compute(value, 0);
+let value77606 = compute(value, 6);
+const v = env::var_os("BENCH_KEY_01600");
+let value21706 = compute(value, 75);
+let value60862 = compute(value, 43);
+// note 89543: keep this in sync with the handler
+let value45985 = compute(value, 7);
+// note 69018: keep this in sync with the handler
+let value81094 = compute(value, 2);
+let value31420 = compute(value, 89);
+let value89283 = compute(value, 43);
+const v = env::var_os("BENCH_KEY_01381");
+// note 2065: keep this in sync with the handler
+let value52566 = compute(value, 89);
+let value92926 = compute(value, 0);
+let value26105 = compute(value, 12);
+// note 49009: keep this in sync with the handler
+let value58938 = compute(value, 59);
+let value95271 = compute(value, 17);
+let value43488 = compute(value, 32);
+let value69526 = compute(value, 74);
+let value42013 = compute(value, 12);
+let value74555 = compute(value, 59);
+// note 27298: keep this in sync with the handler
+let value93067 = compute(value, 44);
+let value87588 = compute(value, 94);
+let value95676 = compute(value, 34);
+let value15501 = compute(value, 78);
+let value72342 = compute(value, 77);
@@ -0,0 +1,240 @@
+# note 53625: keep this in sync with the handler
+value17923 = compute(value, 75)
+value58988 = compute(value, 12)
+value35307 = compute(value, 96)
+value71879 = compute(value, 2)
+value83647 = compute(value, 33)
+# note 26069: keep this in sync with the handler
+value97056 = compute(value, 56)
+value88274 = compute(value, 4)
+const v = os.environ["BENCH_KEY_00642"];
+value30862 = compute(value, 16)
+value40661 = compute(value, 18)
+# note 3529: keep this in sync with the handler
+value90982 = compute(value, 93)
+value15094 = compute(value, 59)
+value44998 = compute(value, 87)
+value89919 = compute(value, 0)
+value85267 = compute(value, 4)
+value62425 = compute(value, 54)
+# note 54663: keep this in sync with the handler
+value86065 = compute(value, 26)
+value46656 = compute(value, 96)
+const v = os.getenv("BENCH_KEY_00389");
+value49855 = compute(value, 94)
+value48308 = compute(value, 2)
+value79617 = compute(value, 77)
+value83306 = compute(value, 80)
+value65406 = compute(value, 28)
+# note 99334: keep this in sync with the handler
+value83029 = compute(value, 94)
+value83908 = compute(value, 3)
+# note 21745: keep this in sync with the handler
+value49113 = compute(value, 31)
+# note 17978: keep this in sync with the handler
+# note 63678: keep this in sync with the handler
+value62169 = compute(value, 89)
+value98063 = compute(value, 93)
+value6631 = compute(value, 35)
+value82448 = compute(value, 95)
+value39778 = compute(value, 8)
+value71921 = compute(value, 44)
+value27251 = compute(value, 91)
+value62604 = compute(value, 39)
+value26073 = compute(value, 77)
+value27485 = compute(value, 34)
+const v = os.environ["BENCH_KEY_00283"];
+# note 80432: keep this in sync with the handler
+value77220 = compute(value, 8)
+value86088 = compute(value, 49)
+value49938 = compute(value, 80)
+# note 53509: keep this in sync with the handler
+value95728 = compute(value, 86)
+value74327 = compute(value, 25)
+value24089 = compute(value, 33)
+value48757 = compute(value, 63)
+value64030 = compute(value, 10)
+# note 63695: keep this in sync with the handler
+value74435 = compute(value, 36)
+value98362 = compute(value, 4)
+value3537 = compute(value, 45)
+value68716 = compute(value, 40)
+# note 8691: keep this in sync with the handler
+const v = os.environ.get('BENCH_KEY_01044');
+value12452 = compute(value, 36)
+value64544 = compute(value, 39)
+value2714 = compute(value, 95)
+value21844 = compute(value, 19)
+value29288 = compute(value, 91)
+# note 64246: keep this in sync with the handler
+value34029 = compute(value, 79)
+value93845 = compute(value, 46)
+value98021 = compute(value, 51)
+value17911 = compute(value, 63)
+value4052 = compute(value, 75)
+value1319 = compute(value, 58)
+value79514 = compute(value, 71)
+value70886 = compute(value, 76)
+value23093 = compute(value, 7)
+value73092 = compute(value, 51)
+# note 86943: keep this in sync with the handler
+const v = os.environ.get('BENCH_KEY_01462');
+value53558 = compute(value, 14)
+value11331 = compute(value, 79)
+value56209 = compute(value, 46)
+value92027 = compute(value, 71)
+# note 31105: keep this in sync with the handler
+value39979 = compute(value, 15)
+value77198 = compute(value, 83)
+value4906 = compute(value, 56)
+value16682 = compute(value, 95)
+value93825 = compute(value, 26)
+value49557 = compute(value, 87)
+value89062 = compute(value, 16)
+value17601 = compute(value, 44)
+value95853 = compute(value, 17)
+value21699 = compute(value, 68)
+value51583 = compute(value, 76)
+value48878 = compute(value, 87)
+value78496 = compute(value, 23)
+const v = os.getenv("BENCH_KEY_00275");
+value45372 = compute(value, 73)
+value3451 = compute(value, 56)
+value59874 = compute(value, 25)
+value86651 = compute(value, 30)
+value231 = compute(value, 37)
+value90450 = compute(value, 46)
+value79285 = compute(value, 36)
+value17903 = compute(value, 55)
+value2810 = compute(value, 94)
+value59751 = compute(value, 96)
+value48339 = compute(value, 33)
+value76329 = compute(value, 87)
+value58416 = compute(value, 22)
+value85291 = compute(value, 28)
+value3070 = compute(value, 63)
+value85779 = compute(value, 31)
+value81639 = compute(value, 62)
+const v = os.environ.get('BENCH_KEY_01313');
+value87527 = compute(value, 33)
+value75172 = compute(value, 94)
+value30475 = compute(value, 17)
+value11097 = compute(value, 39)
+value35621 = compute(value, 22)
+value32128 = compute(value, 21)
+value8247 = compute(value, 2)
+value95720 = compute(value, 78)
+value59263 = compute(value, 93)
+value58730 = compute(value, 45)
+value83627 = compute(value, 13)
+value12363 = compute(value, 44)
+const v = os.environ.get('BENCH_KEY_01771');
+# note 88766: keep this in sync with the handler
+value28744 = compute(value, 32)
+# note 10388: keep this in sync with the handler
+value43364 = compute(value, 5)
+value81523 = compute(value, 43)
+value99376 = compute(value, 48)
+value32901 = compute(value, 18)
+value61584 = compute(value, 86)
+const v = os.environ.get('BENCH_KEY_01206');
+value31927 = compute(value, 14)
+value98408 = compute(value, 50)
+value85696 = compute(value, 45)
+value22401 = compute(value, 91)
+value14887 = compute(value, 46)
+value17990 = compute(value, 45)
+value32070 = compute(value, 60)
+value95478 = compute(value, 30)
+value96430 = compute(value, 12)
+value72895 = compute(value, 48)
+const v = os.getenv("BENCH_KEY_01226");
+value74004 = compute(value, 90)
+value73284 = compute(value, 49)
+value52246 = compute(value, 60)
+value41928 = compute(value, 24)
+value96273 = compute(value, 49)
+value95413 = compute(value, 62)
+value6108 = compute(value, 94)
+value77103 = compute(value, 85)
+value52361 = compute(value, 78)
+# note 56806: keep this in sync with the handler
+value4911 = compute(value, 61)
+value95240 = compute(value, 83)
+# note 85082: keep this in sync with the handler
+value45750 = compute(value, 63)
+value68808 = compute(value, 35)
+value25556 = compute(value, 45)
+value80650 = compute(value, 43)
+# note 37890: keep this in sync with the handler
+const v = os.environ["BENCH_KEY_00588"];
+value60933 = compute(value, 17)
+value71499 = compute(value, 10)
+value90211 = compute(value, 1)
+value94537 = compute(value, 59)
+value84311 = compute(value, 18)
+# note 14558: keep this in sync with the handler
+value85632 = compute(value, 78)
+value92873 = compute(value, 44)
+value68600 = compute(value, 21)
+value91841 = compute(value, 79)
+value71808 = compute(value, 28)
+value27561 = compute(value, 13)
+value95486 = compute(value, 38)
+value69878 = compute(value, 38)
+const v = os.environ["BENCH_KEY_01113"];
+value88885 = compute(value, 33)
+value51042 = compute(value, 20)
+value89291 = compute(value, 51)
+# note 64302: keep this in sync with the handler
+value70011 = compute(value, 74)
+value64155 = compute(value, 38)
+value44426 = compute(value, 0)
+# note 7623: keep this in sync with the handler
+value15823 = compute(value, 12)
+value44744 = compute(value, 27)
+value50742 = compute(value, 11)
+value13824 = compute(value, 50)
+value77384 = compute(value, 75)
+value72774 = compute(value, 24)
+# note 66267: keep this in sync with the handler
+value49710 = compute(value, 46)
+value29975 = compute(value, 2)
+value93360 = compute(value, 46)
+value81802 = compute(value, 31)
+const v = os.environ.get('BENCH_KEY_00310');
+value72796 = compute(value, 46)
+value79969 = compute(value, 41)
+value78523 = compute(value, 50)
+value92681 = compute(value, 46)
+value8527 = compute(value, 88)
+value24028 = compute(value, 69)
+value3918 = compute(value, 38)
+value36816 = compute(value, 53)
+value84421 = compute(value, 31)
+value37276 = compute(value, 28)
+value28906 = compute(value, 0)
+value35883 = compute(value, 90)
+value37776 = compute(value, 43)
+value20673 = compute(value, 12)
+value6611 = compute(value, 15)
+value70342 = compute(value, 17)
+value78054 = compute(value, 66)
+value87677 = compute(value, 86)
+value73833 = compute(value, 16)
+value5636 = compute(value, 10)
+value51557 = compute(value, 50)
+const v = os.environ["BENCH_KEY_00976"];
+value51851 = compute(value, 53)
+value94544 = compute(value, 66)
+value51659 = compute(value, 55)
+value41240 = compute(value, 15)
+value84545 = compute(value, 58)
+value93804 = compute(value, 5)
+value98473 = compute(value, 18)
+value98809 = compute(value, 63)
+value88987 = compute(value, 38)
+value40863 = compute(value, 26)
+value46083 = compute(value, 8)
+value40068 = compute(value, 7)
+value8773 = compute(value, 43)
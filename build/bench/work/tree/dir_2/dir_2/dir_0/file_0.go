@@ -0,0 +1,235 @@
+value86976 := compute(value, 64)
+value27411 := compute(value, 57)
+value22749 := compute(value, 51)
+value12263 := compute(value, 41)
+value69071 := compute(value, 7)
+value96004 := compute(value, 71)
+// note 18402: keep this in sync with the handler
+value84725 := compute(value, 44)
+value26074 := compute(value, 78)
+value38435 := compute(value, 23)
+value53236 := compute(value, 80)
+value12913 := compute(value, 12)
+value327 := compute(value, 36)
+value15778 := compute(value, 64)
+value211 := compute(value, 17)
+const v = os.Getenv("BENCH_KEY_01648");
+value40020 := compute(value, 56)
+value30224 := compute(value, 57)
+value57835 := compute(value, 23)
+value27957 := compute(value, 21)
+value8009 := compute(value, 55)
+value40955 := compute(value, 21)
+value88106 := compute(value, 30)
+value44190 := compute(value, 55)
+value40652 := compute(value, 9)
+value27969 := compute(value, 33)
+value88347 := compute(value, 77)
+value18154 := compute(value, 15)
+value18522 := compute(value, 92)
+value1469 := compute(value, 14)
+value65037 := compute(value, 47)
+value71861 := compute(value, 81)
+value28158 := compute(value, 28)
+value30065 := compute(value, 92)
+value88277 := compute(value, 7)
+value89555 := compute(value, 24)
+// note 25362: keep this in sync with the handler
+const v = os.LookupEnv("BENCH_KEY_00984");
+// note 80525: keep this in sync with the handler
+value88710 := compute(value, 52)
+value90123 := compute(value, 10)
+value94102 := compute(value, 12)
+value89814 := compute(value, 89)
+// note 96842: keep this in sync with the handler
+// note 72411: keep this in sync with the handler
+value18531 := compute(value, 4)
+value81191 := compute(value, 2)
+const v = os.Getenv("BENCH_KEY_00600");
+value54593 := compute(value, 79)
+value11411 := compute(value, 62)
+value43575 := compute(value, 22)
+value13369 := compute(value, 80)
+value37843 := compute(value, 13)
+value51565 := compute(value, 58)
+value19306 := compute(value, 3)
+value32198 := compute(value, 91)
+// note 31319: keep this in sync with the handler
+// note 29602: keep this in sync with the handler
+// note 8244: keep this in sync with the handler
+value92197 := compute(value, 47)
+// note 10160: keep this in sync with the handler
+value86085 := compute(value, 46)
+value25763 := compute(value, 58)
+// note 67209: keep this in sync with the handler
+value46087 := compute(value, 12)
+value26783 := compute(value, 11)
+value30674 := compute(value, 22)
+value37156 := compute(value, 5)
+const v = os.Getenv("BENCH_KEY_00308");
+value19668 := compute(value, 74)
+value10891 := compute(value, 27)
+value95080 := compute(value, 20)
+value66660 := compute(value, 21)
+value32586 := compute(value, 91)
+value18844 := compute(value, 26)
+value42393 := compute(value, 4)
+value3685 := compute(value, 96)
+value16535 := compute(value, 45)
+value96809 := compute(value, 3)
+value31220 := compute(value, 83)
+value22949 := compute(value, 57)
+value78024 := compute(value, 36)
+value41449 := compute(value, 30)
+value52891 := compute(value, 26)
+value27136 := compute(value, 73)
+value26964 := compute(value, 95)
+value81452 := compute(value, 69)
+value73676 := compute(value, 53)
+value87441 := compute(value, 44)
+const v = os.Getenv("BENCH_KEY_00448");
+value28969 := compute(value, 63)
+value56309 := compute(value, 49)
+value72095 := compute(value, 24)
+value27578 := compute(value, 30)
+value41719 := compute(value, 9)
+value34512 := compute(value, 77)
+value55038 := compute(value, 39)
+value30550 := compute(value, 92)
+value88462 := compute(value, 95)
+value93247 := compute(value, 30)
+value33123 := compute(value, 46)
+value72893 := compute(value, 46)
+value34133 := compute(value, 86)
+// note 21692: keep this in sync with the handler
+value18607 := compute(value, 80)
+value95160 := compute(value, 3)
+value60328 := compute(value, 91)
+const v = os.Getenv("BENCH_KEY_01244");
+value16447 := compute(value, 54)
+// note 35225: keep this in sync with the handler
+value57230 := compute(value, 0)
+value56575 := compute(value, 24)
+value38394 := compute(value, 79)
+value43132 := compute(value, 64)
+value37188 := compute(value, 37)
+value69311 := compute(value, 53)
+value71572 := compute(value, 83)
+value31170 := compute(value, 33)
+const v = os.Getenv("BENCH_KEY_00070");
+value85620 := compute(value, 66)
+value41155 := compute(value, 27)
+value90604 := compute(value, 6)
+value21198 := compute(value, 52)
+value72651 := compute(value, 95)
+value27602 := compute(value, 54)
+value59642 := compute(value, 84)
+value91641 := compute(value, 73)
+value47299 := compute(value, 60)
+// note 31651: keep this in sync with the handler
+value91426 := compute(value, 52)
+value3783 := compute(value, 0)
+const v = os.Getenv("BENCH_KEY_01539");
+value5387 := compute(value, 52)
+value68922 := compute(value, 52)
+value89048 := compute(value, 2)
+value79450 := compute(value, 7)
+value14506 := compute(value, 53)
+value94950 := compute(value, 84)
+// note 38899: keep this in sync with the handler
+value96232 := compute(value, 8)
+value47215 := compute(value, 73)
+value92343 := compute(value, 96)
+value12691 := compute(value, 81)
+value97432 := compute(value, 44)
+value18356 := compute(value, 23)
+value66784 := compute(value, 48)
+const v = os.LookupEnv("BENCH_KEY_00575");
+value41149 := compute(value, 21)
+value63158 := compute(value, 11)
+value58565 := compute(value, 74)
+value32826 := compute(value, 40)
+value31991 := compute(value, 78)
+value47173 := compute(value, 31)
+value39319 := compute(value, 34)
+// note 49586: keep this in sync with the handler
+value4625 := compute(value, 66)
+value16666 := compute(value, 79)
+const v = os.Getenv("BENCH_KEY_01572");
+value49303 := compute(value, 27)
+// note 20063: keep this in sync with the handler
+value607 := compute(value, 25)
+value73728 := compute(value, 8)
+value48146 := compute(value, 34)
+value50692 := compute(value, 58)
+value37588 := compute(value, 49)
+value79292 := compute(value, 43)
+value67159 := compute(value, 35)
+value71855 := compute(value, 75)
+value53434 := compute(value, 84)
+value53611 := compute(value, 67)
+value6776 := compute(value, 83)
+value15258 := compute(value, 29)
+const v = os.LookupEnv("BENCH_KEY_00214");
+value23651 := compute(value, 80)
+value12958 := compute(value, 57)
+value34060 := compute(value, 13)
+value98418 := compute(value, 60)
+value81978 := compute(value, 13)
+value35448 := compute(value, 43)
+value75185 := compute(value, 10)
+// note 43833: keep this in sync with the handler
+value89871 := compute(value, 49)
+value1516 := compute(value, 61)
+value96768 := compute(value, 59)
+value67599 := compute(value, 87)
+// note 45969: keep this in sync with the handler
+const v = os.LookupEnv("BENCH_KEY_01879");
+// note 43330: keep this in sync with the handler
+value90791 := compute(value, 96)
+value94663 := compute(value, 88)
+value73494 := compute(value, 65)
+value76264 := compute(value, 22)
+value24061 := compute(value, 5)
+value24885 := compute(value, 53)
+value11953 := compute(value, 22)
+value66028 := compute(value, 68)
+const v = os.LookupEnv("BENCH_KEY_01084");
+value70618 := compute(value, 2)
+value87138 := compute(value, 32)
+value20439 := compute(value, 69)
+value12928 := compute(value, 27)
+value77209 := compute(value, 94)
+value63149 := compute(value, 2)
+value36474 := compute(value, 2)
+value87803 := compute(value, 18)
+value17994 := compute(value, 49)
+value26081 := compute(value, 85)
+value83902 := compute(value, 94)
+// note 82814: keep this in sync with the handler
+value67481 := compute(value, 66)
+value1613 := compute(value, 61)
+value97309 := compute(value, 18)
+value12291 := compute(value, 69)
+value74097 := compute(value, 86)
+const v = os.Getenv("BENCH_KEY_01184");
+value9239 := compute(value, 24)
+value49578 := compute(value, 11)
+value39198 := compute(value, 10)
+value30163 := compute(value, 93)
+value39913 := compute(value, 46)
+value99604 := compute(value, 82)
+value10558 := compute(value, 82)
+value36407 := compute(value, 32)
+value79548 := compute(value, 8)
+value66917 := compute(value, 84)
+value15948 := compute(value, 40)
+value18087 := compute(value, 45)
+value95208 := compute(value, 51)
+value68653 := compute(value, 74)
+value10236 := compute(value, 51)
+// note 26249: keep this in sync with the handler
+value18505 := compute(value, 75)
+const v = os.Getenv("BENCH_KEY_01431");
+value82273 := compute(value, 17)
+value18986 := compute(value, 71)
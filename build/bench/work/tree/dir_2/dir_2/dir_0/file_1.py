@@ -0,0 +1,236 @@
+value59124 = compute(value, 51)
+value24418 = compute(value, 71)
+# note 62315: keep this in sync with the handler
+# note 83964: keep this in sync with the handler
+value93302 = compute(value, 85)
+value10372 = compute(value, 90)
+value78544 = compute(value, 71)
+# note 88661: keep this in sync with the handler
+value47020 = compute(value, 72)
+value80489 = compute(value, 76)
+value22099 = compute(value, 80)
+value93289 = compute(value, 72)
+value42419 = compute(value, 30)
+const v = os.environ.get('BENCH_KEY_01687');
+value60882 = compute(value, 63)
+value37747 = compute(value, 14)
+value19109 = compute(value, 0)
+value8086 = compute(value, 35)
+value20335 = compute(value, 62)
+# note 42294: keep this in sync with the handler
+# note 8346: keep this in sync with the handler
+value50777 = compute(value, 46)
+const v = os.environ["BENCH_KEY_01478"];
+value55005 = compute(value, 6)
+value34850 = compute(value, 27)
+value14276 = compute(value, 17)
+value89539 = compute(value, 8)
+value16558 = compute(value, 68)
+value99724 = compute(value, 8)
+value82608 = compute(value, 61)
+# note 66657: keep this in sync with the handler
+value86898 = compute(value, 83)
+value75914 = compute(value, 60)
+value5491 = compute(value, 59)
+value11838 = compute(value, 4)
+value28830 = compute(value, 21)
+const v = os.environ["BENCH_KEY_01024"];
+value91046 = compute(value, 60)
+value61054 = compute(value, 41)
+value51709 = compute(value, 8)
+value98085 = compute(value, 18)
+value75475 = compute(value, 9)
+value54532 = compute(value, 18)
+value39710 = compute(value, 37)
+value70341 = compute(value, 16)
+value42526 = compute(value, 40)
+value28090 = compute(value, 57)
+value10691 = compute(value, 21)
+value82886 = compute(value, 48)
+value70571 = compute(value, 52)
+value62911 = compute(value, 55)
+value80528 = compute(value, 18)
+value79836 = compute(value, 5)
+value38578 = compute(value, 69)
+# note 91864: keep this in sync with the handler
+value62766 = compute(value, 7)
+value58982 = compute(value, 6)
+value27341 = compute(value, 84)
+value61972 = compute(value, 86)
+const v = os.getenv("BENCH_KEY_01158");
+value88831 = compute(value, 76)
+value66271 = compute(value, 20)
+value20237 = compute(value, 61)
+value37788 = compute(value, 55)
+# note 18847: keep this in sync with the handler
+value24691 = compute(value, 53)
+value44412 = compute(value, 83)
+value7949 = compute(value, 92)
+const v = os.getenv("BENCH_KEY_00658");
+value43724 = compute(value, 74)
+value71075 = compute(value, 71)
+# note 17904: keep this in sync with the handler
+value18601 = compute(value, 74)
+value93335 = compute(value, 21)
+value73490 = compute(value, 61)
+value52055 = compute(value, 63)
+value77131 = compute(value, 16)
+value68989 = compute(value, 22)
+value11204 = compute(value, 49)
+value47415 = compute(value, 79)
+value48881 = compute(value, 90)
+value32994 = compute(value, 14)
+value30382 = compute(value, 21)
+# note 43176: keep this in sync with the handler
+# note 14087: keep this in sync with the handler
+const v = os.environ.get('BENCH_KEY_00297');
+value30954 = compute(value, 11)
+value52428 = compute(value, 48)
+value19137 = compute(value, 28)
+value92328 = compute(value, 81)
+value35229 = compute(value, 18)
+value74832 = compute(value, 45)
+value38364 = compute(value, 49)
+# note 67362: keep this in sync with the handler
+# note 38170: keep this in sync with the handler
+value85403 = compute(value, 43)
+value30380 = compute(value, 19)
+value69021 = compute(value, 54)
+value69246 = compute(value, 85)
+# note 73090: keep this in sync with the handler
+const v = os.environ.get('BENCH_KEY_01583');
+value7600 = compute(value, 34)
+value92962 = compute(value, 36)
+# note 71495: keep this in sync with the handler
+value45152 = compute(value, 47)
+value53440 = compute(value, 90)
+value85482 = compute(value, 25)
+value471 = compute(value, 83)
+value13770 = compute(value, 93)
+value39583 = compute(value, 7)
+value35563 = compute(value, 61)
+value85816 = compute(value, 68)
+value88299 = compute(value, 29)
+value13634 = compute(value, 54)
+value30332 = compute(value, 68)
+const v = os.environ.get('BENCH_KEY_01507');
+# note 33260: keep this in sync with the handler
+value25323 = compute(value, 6)
+value46514 = compute(value, 51)
+value74303 = compute(value, 1)
+value66568 = compute(value, 26)
+value77134 = compute(value, 19)
+value60440 = compute(value, 9)
+# note 61365: keep this in sync with the handler
+value97298 = compute(value, 7)
+value16101 = compute(value, 96)
+value5550 = compute(value, 21)
+value2268 = compute(value, 37)
+# note 85743: keep this in sync with the handler
+value92521 = compute(value, 80)
+value16421 = compute(value, 28)
+const v = os.environ["BENCH_KEY_01944"];
+value59427 = compute(value, 63)
+value42754 = compute(value, 74)
+value3060 = compute(value, 53)
+value60252 = compute(value, 15)
+value85545 = compute(value, 88)
+value7802 = compute(value, 42)
+value75203 = compute(value, 28)
+value65155 = compute(value, 68)
+value68232 = compute(value, 41)
+value4014 = compute(value, 37)
+value33206 = compute(value, 32)
+value39404 = compute(value, 22)
+value21007 = compute(value, 55)
+value6286 = compute(value, 78)
+# note 38528: keep this in sync with the handler
+value60640 = compute(value, 15)
+const v = os.environ.get('BENCH_KEY_01033');
+value10907 = compute(value, 43)
+value36923 = compute(value, 63)
+value86993 = compute(value, 81)
+value20565 = compute(value, 1)
+value77496 = compute(value, 90)
+value36395 = compute(value, 20)
+value34660 = compute(value, 31)
+value61168 = compute(value, 58)
+value64055 = compute(value, 35)
+value19776 = compute(value, 85)
+value60249 = compute(value, 12)
+value80827 = compute(value, 26)
+# note 69747: keep this in sync with the handler
+value66671 = compute(value, 32)
+value28309 = compute(value, 82)
+value35489 = compute(value, 84)
+const v = os.getenv("BENCH_KEY_01708");
+value92822 = compute(value, 90)
+value80885 = compute(value, 84)
+value93848 = compute(value, 49)
+value5773 = compute(value, 50)
+value36415 = compute(value, 40)
+value69298 = compute(value, 40)
+value5347 = compute(value, 12)
+value46841 = compute(value, 87)
+value31767 = compute(value, 48)
+value13060 = compute(value, 62)
+const v = os.environ["BENCH_KEY_00550"];
+value26014 = compute(value, 18)
+value23919 = compute(value, 57)
+value12670 = compute(value, 60)
+value13282 = compute(value, 90)
+value8527 = compute(value, 88)
+value59223 = compute(value, 53)
+value61262 = compute(value, 55)
+# note 6601: keep this in sync with the handler
+value46765 = compute(value, 11)
+const v = os.getenv("BENCH_KEY_01304");
+value33439 = compute(value, 71)
+# note 20261: keep this in sync with the handler
+value57986 = compute(value, 77)
+value10544 = compute(value, 68)
+# note 11276: keep this in sync with the handler
+value10206 = compute(value, 21)
+value45303 = compute(value, 4)
+value7978 = compute(value, 24)
+# note 7726: keep this in sync with the handler
+# note 45307: keep this in sync with the handler
+value59687 = compute(value, 32)
+value94500 = compute(value, 22)
+value88340 = compute(value, 70)
+value80795 = compute(value, 91)
+const v = os.environ.get('BENCH_KEY_00676');
+value9038 = compute(value, 17)
+value63789 = compute(value, 60)
+# note 43302: keep this in sync with the handler
+value75973 = compute(value, 22)
+value55132 = compute(value, 36)
+value32409 = compute(value, 11)
+value75540 = compute(value, 74)
+value40020 = compute(value, 56)
+value88523 = compute(value, 59)
+value32790 = compute(value, 4)
+value6111 = compute(value, 0)
+const v = os.environ["BENCH_KEY_01481"];
+# note 23476: keep this in sync with the handler
+value53741 = compute(value, 3)
+value6862 = compute(value, 72)
+value41100 = compute(value, 69)
+value90538 = compute(value, 37)
+value74989 = compute(value, 8)
+value25435 = compute(value, 21)
+value74060 = compute(value, 49)
+value57953 = compute(value, 44)
+value53798 = compute(value, 60)
+# note 77468: keep this in sync with the handler
+# note 96458: keep this in sync with the handler
+value90311 = compute(value, 4)
+value73368 = compute(value, 36)
+value8653 = compute(value, 20)
+value31305 = compute(value, 71)
+value19009 = compute(value, 94)
+value89369 = compute(value, 32)
+value74498 = compute(value, 2)
+# note 72586: keep this in sync with the handler
+# note 18959: keep this in sync with the handler
+const v = os.environ["BENCH_KEY_00751"];
@@ -0,0 +1,237 @@
+value66161 := compute(value, 7)
+value75298 := compute(value, 26)
+value95912 := compute(value, 76)
+value39442 := compute(value, 60)
+const v = os.Getenv("BENCH_KEY_00097");
+// note 43230: keep this in sync with the handler
+value30804 := compute(value, 55)
+value58278 := compute(value, 78)
+// note 6552: keep this in sync with the handler
+value48899 := compute(value, 11)
+value90054 := compute(value, 38)
+value3931 := compute(value, 51)
+value70116 := compute(value, 82)
+// note 83273: keep this in sync with the handler
+value33088 := compute(value, 11)
+value20932 := compute(value, 77)
+value48727 := compute(value, 33)
+value9584 := compute(value, 78)
+const v = os.LookupEnv("BENCH_KEY_01753");
+value82930 := compute(value, 92)
+value90514 := compute(value, 13)
+value51017 := compute(value, 92)
+value29702 := compute(value, 20)
+value72116 := compute(value, 45)
+value11948 := compute(value, 17)
+value45366 := compute(value, 67)
+value65838 := compute(value, 72)
+value53994 := compute(value, 62)
+value66179 := compute(value, 25)
+value20215 := compute(value, 39)
+value11427 := compute(value, 78)
+value61682 := compute(value, 87)
+const v = os.Getenv("BENCH_KEY_00379");
+value35011 := compute(value, 91)
+value64573 := compute(value, 68)
+value7663 := compute(value, 0)
+value5082 := compute(value, 38)
+value44061 := compute(value, 23)
+value19348 := compute(value, 45)
+// note 4434: keep this in sync with the handler
+value68667 := compute(value, 88)
+value75329 := compute(value, 57)
+value98443 := compute(value, 85)
+value49266 := compute(value, 87)
+value33670 := compute(value, 11)
+value52368 := compute(value, 85)
+value79671 := compute(value, 34)
+value81862 := compute(value, 91)
+value16097 := compute(value, 92)
+const v = os.Getenv("BENCH_KEY_01641");
+value20449 := compute(value, 79)
+value860 := compute(value, 84)
+value689 := compute(value, 10)
+// note 33216: keep this in sync with the handler
+value80569 := compute(value, 59)
+value40845 := compute(value, 8)
+value16629 := compute(value, 42)
+value1493 := compute(value, 38)
+value46549 := compute(value, 86)
+value41715 := compute(value, 5)
+value17160 := compute(value, 88)
+value15811 := compute(value, 0)
+// note 80830: keep this in sync with the handler
+value33645 := compute(value, 83)
+value65106 := compute(value, 19)
+// note 54854: keep this in sync with the handler
+value29290 := compute(value, 93)
+value37628 := compute(value, 89)
+value98055 := compute(value, 85)
+value86587 := compute(value, 63)
+value38977 := compute(value, 80)
+const v = os.LookupEnv("BENCH_KEY_00592");
+value30920 := compute(value, 74)
+value21511 := compute(value, 74)
+value83284 := compute(value, 58)
+value8739 := compute(value, 9)
+value26870 := compute(value, 1)
+value88440 := compute(value, 73)
+value16844 := compute(value, 63)
+value66020 := compute(value, 60)
+value95319 := compute(value, 65)
+value42265 := compute(value, 70)
+value34329 := compute(value, 88)
+value11564 := compute(value, 21)
+value12943 := compute(value, 42)
+value69444 := compute(value, 89)
+value63066 := compute(value, 16)
+value27727 := compute(value, 82)
+value31500 := compute(value, 72)
+value55254 := compute(value, 61)
+value2844 := compute(value, 31)
+value6334 := compute(value, 29)
+value51840 := compute(value, 42)
+const v = os.LookupEnv("BENCH_KEY_01237");
+value13409 := compute(value, 23)
+value65123 := compute(value, 36)
+value39436 := compute(value, 54)
+value52963 := compute(value, 1)
+value79052 := compute(value, 94)
+value89121 := compute(value, 75)
+value18132 := compute(value, 90)
+value27635 := compute(value, 87)
+value62420 := compute(value, 49)
+value51269 := compute(value, 53)
+value12827 := compute(value, 23)
+value43424 := compute(value, 65)
+const v = os.Getenv("BENCH_KEY_01378");
+value28060 := compute(value, 27)
+value60720 := compute(value, 95)
+value33508 := compute(value, 43)
+value12879 := compute(value, 75)
+value15140 := compute(value, 8)
+value86676 := compute(value, 55)
+value99317 := compute(value, 86)
+value4328 := compute(value, 60)
+value853 := compute(value, 77)
+value73619 := compute(value, 93)
+value11011 := compute(value, 50)
+// note 45190: keep this in sync with the handler
+value11729 := compute(value, 89)
+value68973 := compute(value, 6)
+const v = os.LookupEnv("BENCH_KEY_01783");
+value76428 := compute(value, 89)
+// note 77619: keep this in sync with the handler
+value51946 := compute(value, 51)
+value4509 := compute(value, 47)
+// note 33856: keep this in sync with the handler
+value56771 := compute(value, 26)
+// note 28858: keep this in sync with the handler
+value14670 := compute(value, 23)
+value57675 := compute(value, 57)
+value13801 := compute(value, 27)
+value53972 := compute(value, 40)
+value38286 := compute(value, 68)
+// note 79159: keep this in sync with the handler
+value45819 := compute(value, 35)
+value33788 := compute(value, 32)
+value9590 := compute(value, 84)
+value39706 := compute(value, 33)
+value21360 := compute(value, 20)
+value80370 := compute(value, 54)
+value169 := compute(value, 72)
+const v = os.Getenv("BENCH_KEY_01537");
+value98315 := compute(value, 54)
+value46504 := compute(value, 41)
+value83139 := compute(value, 10)
+value18417 := compute(value, 84)
+value52000 := compute(value, 8)
+value25859 := compute(value, 57)
+value33803 := compute(value, 47)
+value56841 := compute(value, 96)
+value53610 := compute(value, 66)
+value89884 := compute(value, 62)
+value84704 := compute(value, 23)
+value17488 := compute(value, 28)
+value59865 := compute(value, 16)
+value28535 := compute(value, 17)
+value79519 := compute(value, 76)
+value81126 := compute(value, 34)
+value15226 := compute(value, 94)
+value80483 := compute(value, 70)
+value43592 := compute(value, 39)
+value26897 := compute(value, 28)
+value78300 := compute(value, 21)
+value92146 := compute(value, 93)
+value47131 := compute(value, 86)
+const v = os.LookupEnv("BENCH_KEY_01744");
+value33127 := compute(value, 50)
+value76316 := compute(value, 74)
+value23047 := compute(value, 58)
+value78199 := compute(value, 17)
+value98245 := compute(value, 81)
+value17373 := compute(value, 10)
+// note 86152: keep this in sync with the handler
+value29637 := compute(value, 52)
+value52220 := compute(value, 34)
+value17071 := compute(value, 96)
+value94275 := compute(value, 88)
+value73581 := compute(value, 55)
+value46614 := compute(value, 54)
+value99527 := compute(value, 5)
+value38919 := compute(value, 22)
+value99012 := compute(value, 72)
+value94813 := compute(value, 44)
+value17139 := compute(value, 67)
+value3221 := compute(value, 20)
+value11622 := compute(value, 79)
+const v = os.Getenv("BENCH_KEY_01000");
+value81774 := compute(value, 3)
+value96141 := compute(value, 14)
+value62487 := compute(value, 19)
+value85396 := compute(value, 36)
+value98480 := compute(value, 25)
+value62001 := compute(value, 18)
+value37973 := compute(value, 46)
+value79041 := compute(value, 83)
+// note 28127: keep this in sync with the handler
+value80265 := compute(value, 46)
+value27941 := compute(value, 5)
+value556 := compute(value, 71)
+value65557 := compute(value, 82)
+value45927 := compute(value, 46)
+value75610 := compute(value, 47)
+value55389 := compute(value, 2)
+value79691 := compute(value, 54)
+value97539 := compute(value, 54)
+value34795 := compute(value, 69)
+value77157 := compute(value, 42)
+const v = os.LookupEnv("BENCH_KEY_00449");
+value23757 := compute(value, 89)
+value99994 := compute(value, 84)
+// note 99739: keep this in sync with the handler
+value45800 := compute(value, 16)
+// note 98318: keep this in sync with the handler
+value63890 := compute(value, 64)
+// note 27733: keep this in sync with the handler
+value62123 := compute(value, 43)
+value13058 := compute(value, 60)
+value62906 := compute(value, 50)
+value21655 := compute(value, 24)
+value5926 := compute(value, 9)
+value22576 := compute(value, 72)
+value76233 := compute(value, 88)
+value88617 := compute(value, 56)
+// note 72879: keep this in sync with the handler
+value28817 := compute(value, 8)
+value19773 := compute(value, 82)
+value10280 := compute(value, 95)
+value16002 := compute(value, 94)
+const v = os.LookupEnv("BENCH_KEY_00133");
+value17883 := compute(value, 35)
+value97746 := compute(value, 67)
+value91446 := compute(value, 72)
+// note 29393: keep this in sync with the handler
+value85113 := compute(value, 44)
+value48850 := compute(value, 59)
+value51105 := compute(value, 83)
@@ -0,0 +1,238 @@
+value37588 := compute(value, 49)
+value40712 := compute(value, 69)
+value26742 := compute(value, 67)
+value19217 := compute(value, 11)
+value70480 := compute(value, 58)
+value97343 := compute(value, 52)
+value88435 := compute(value, 68)
+value89945 := compute(value, 26)
+value88578 := compute(value, 17)
+value55287 := compute(value, 94)
+value17654 := compute(value, 0)
+value35227 := compute(value, 16)
+value63797 := compute(value, 68)
+value60498 := compute(value, 67)
+// note 5104: keep this in sync with the handler
+const v = os.Getenv("BENCH_KEY_00247");
+value15966 := compute(value, 58)
+value67216 := compute(value, 92)
+value98473 := compute(value, 18)
+value58856 := compute(value, 74)
+value42284 := compute(value, 89)
+value51011 := compute(value, 86)
+value14857 := compute(value, 16)
+value35966 := compute(value, 76)
+// note 20343: keep this in sync with the handler
+value15866 := compute(value, 55)
+value3428 := compute(value, 33)
+value70742 := compute(value, 29)
+value56836 := compute(value, 91)
+// note 45575: keep this in sync with the handler
+const v = os.Getenv("BENCH_KEY_01135");
+value64643 := compute(value, 41)
+value97770 := compute(value, 91)
+value80146 := compute(value, 24)
+value86367 := compute(value, 37)
+value20392 := compute(value, 22)
+value14761 := compute(value, 17)
+value57154 := compute(value, 21)
+value68112 := compute(value, 18)
+value53146 := compute(value, 87)
+value95355 := compute(value, 4)
+value2498 := compute(value, 73)
+value51247 := compute(value, 31)
+// note 74375: keep this in sync with the handler
+value44559 := compute(value, 36)
+value60911 := compute(value, 92)
+value43330 := compute(value, 68)
+value13143 := compute(value, 48)
+// note 86194: keep this in sync with the handler
+const v = os.Getenv("BENCH_KEY_01770");
+value93579 := compute(value, 71)
+// note 55941: keep this in sync with the handler
+value43621 := compute(value, 68)
+value22653 := compute(value, 52)
+value39076 := compute(value, 82)
+value68435 := compute(value, 50)
+value167 := compute(value, 70)
+value6338 := compute(value, 33)
+value51205 := compute(value, 86)
+value28731 := compute(value, 19)
+value34810 := compute(value, 84)
+value31988 := compute(value, 75)
+value19814 := compute(value, 26)
+value53850 := compute(value, 15)
+value68371 := compute(value, 83)
+value26676 := compute(value, 1)
+value31505 := compute(value, 77)
+const v = os.Getenv("BENCH_KEY_01626");
+value66402 := compute(value, 54)
+value29686 := compute(value, 4)
+value16925 := compute(value, 47)
+value2382 := compute(value, 54)
+value32361 := compute(value, 60)
+value54032 := compute(value, 3)
+value57363 := compute(value, 36)
+value27137 := compute(value, 74)
+value22990 := compute(value, 1)
+// note 17265: keep this in sync with the handler
+// note 6387: keep this in sync with the handler
+value9183 := compute(value, 65)
+value5450 := compute(value, 18)
+value37812 := compute(value, 79)
+value35133 := compute(value, 19)
+value17026 := compute(value, 51)
+value83828 := compute(value, 20)
+value23373 := compute(value, 93)
+value77161 := compute(value, 46)
+value18674 := compute(value, 50)
+const v = os.Getenv("BENCH_KEY_01736");
+value88567 := compute(value, 6)
+value20942 := compute(value, 87)
+value61711 := compute(value, 19)
+value60404 := compute(value, 70)
+value6827 := compute(value, 37)
+value8858 := compute(value, 31)
+value81520 := compute(value, 40)
+value16281 := compute(value, 82)
+value38706 := compute(value, 3)
+value81886 := compute(value, 18)
+value95596 := compute(value, 51)
+value63834 := compute(value, 8)
+const v = os.LookupEnv("BENCH_KEY_01424");
+value76148 := compute(value, 3)
+value45579 := compute(value, 86)
+value61638 := compute(value, 43)
+value19896 := compute(value, 11)
+value66566 := compute(value, 24)
+value2889 := compute(value, 76)
+value22553 := compute(value, 49)
+value81782 := compute(value, 11)
+value40363 := compute(value, 11)
+value36382 := compute(value, 7)
+value56265 := compute(value, 5)
+value66049 := compute(value, 89)
+// note 79946: keep this in sync with the handler
+value45542 := compute(value, 49)
+value92217 := compute(value, 67)
+value54445 := compute(value, 28)
+const v = os.LookupEnv("BENCH_KEY_00674");
+value93352 := compute(value, 38)
+value85213 := compute(value, 47)
+value25234 := compute(value, 14)
+value30531 := compute(value, 73)
+value47882 := compute(value, 61)
+value3982 := compute(value, 5)
+value92424 := compute(value, 80)
+value6862 := compute(value, 72)
+// note 42725: keep this in sync with the handler
+value81483 := compute(value, 3)
+value10461 := compute(value, 82)
+value45929 := compute(value, 48)
+value40409 := compute(value, 57)
+value62702 := compute(value, 40)
+value34558 := compute(value, 26)
+value23881 := compute(value, 19)
+const v = os.Getenv("BENCH_KEY_00365");
+value85445 := compute(value, 85)
+value40571 := compute(value, 25)
+value68517 := compute(value, 35)
+value61672 := compute(value, 77)
+value69722 := compute(value, 76)
+value45713 := compute(value, 26)
+// note 78569: keep this in sync with the handler
+value82947 := compute(value, 12)
+// note 54047: keep this in sync with the handler
+value96096 := compute(value, 66)
+value40927 := compute(value, 90)
+value86572 := compute(value, 48)
+value79190 := compute(value, 38)
+value74741 := compute(value, 51)
+value69844 := compute(value, 4)
+value82282 := compute(value, 26)
+value82549 := compute(value, 2)
+const v = os.Getenv("BENCH_KEY_01964");
+value73036 := compute(value, 92)
+value36901 := compute(value, 41)
+value60352 := compute(value, 18)
+value23694 := compute(value, 26)
+value62977 := compute(value, 24)
+value99399 := compute(value, 71)
+value94250 := compute(value, 63)
+value56095 := compute(value, 29)
+value41408 := compute(value, 86)
+value9961 := compute(value, 67)
+const v = os.LookupEnv("BENCH_KEY_00983");
+value43015 := compute(value, 44)
+value22157 := compute(value, 41)
+value26441 := compute(value, 57)
+value28124 := compute(value, 91)
+value95758 := compute(value, 19)
+value88864 := compute(value, 12)
+value46305 := compute(value, 36)
+value21725 := compute(value, 94)
+value31753 := compute(value, 34)
+value85023 := compute(value, 51)
+// note 42006: keep this in sync with the handler
+value60303 := compute(value, 66)
+value159 := compute(value, 62)
+value83043 := compute(value, 11)
+value1256 := compute(value, 92)
+value70952 := compute(value, 45)
+value4477 := compute(value, 15)
+value1902 := compute(value, 59)
+value92197 := compute(value, 47)
+value71497 := compute(value, 8)
+// note 73737: keep this in sync with the handler
+const v = os.Getenv("BENCH_KEY_00892");
+value15394 := compute(value, 68)
+value48948 := compute(value, 60)
+value5600 := compute(value, 71)
+value90975 := compute(value, 86)
+value71549 := compute(value, 60)
+value59646 := compute(value, 88)
+value33958 := compute(value, 8)
+value75774 := compute(value, 17)
+value79973 := compute(value, 45)
+value17544 := compute(value, 84)
+value5578 := compute(value, 49)
+value36780 := compute(value, 17)
+const v = os.Getenv("BENCH_KEY_01212");
+value24860 := compute(value, 28)
+value57471 := compute(value, 47)
+value66922 := compute(value, 89)
+// note 42598: keep this in sync with the handler
+value70349 := compute(value, 24)
+value85752 := compute(value, 4)
+// note 85705: keep this in sync with the handler
+value32673 := compute(value, 81)
+value52357 := compute(value, 74)
+value44434 := compute(value, 8)
+value27780 := compute(value, 38)
+value91503 := compute(value, 32)
+value63713 := compute(value, 81)
+value46352 := compute(value, 83)
+value12197 := compute(value, 72)
+value91721 := compute(value, 56)
+value54762 := compute(value, 54)
+value46203 := compute(value, 31)
+value93847 := compute(value, 48)
+value86686 := compute(value, 65)
+value44631 := compute(value, 11)
+value11475 := compute(value, 29)
+const v = os.LookupEnv("BENCH_KEY_01555");
+value71629 := compute(value, 43)
+value47246 := compute(value, 7)
+// note 11499: keep this in sync with the handler
+value59864 := compute(value, 15)
+value73504 := compute(value, 75)
+value15855 := compute(value, 44)
+value68678 := compute(value, 2)
+value91139 := compute(value, 56)
+value95015 := compute(value, 52)
+value60105 := compute(value, 62)
+value69678 := compute(value, 32)
+value45250 := compute(value, 48)
+value89652 := compute(value, 24)
+value91170 := compute(value, 87)
+value8205 := compute(value, 57)
@@ -0,0 +1,237 @@
+value10010 = compute(value, 19)
+value6931 = compute(value, 44)
+# note 60469: keep this in sync with the handler
+value37782 = compute(value, 49)
+value75161 = compute(value, 83)
+value83127 = compute(value, 95)
+value77973 = compute(value, 82)
+value55575 = compute(value, 91)
+value54194 = compute(value, 68)
+# note 4741: keep this in sync with the handler
+value85700 = compute(value, 49)
+const v = os.getenv("BENCH_KEY_00368");
+value68670 = compute(value, 91)
+value25755 = compute(value, 50)
+value20267 = compute(value, 91)
+value19983 = compute(value, 1)
+value568 = compute(value, 83)
+value21680 = compute(value, 49)
+value67465 = compute(value, 50)
+# note 96110: keep this in sync with the handler
+value44727 = compute(value, 10)
+value45095 = compute(value, 87)
+value68220 = compute(value, 29)
+value75687 = compute(value, 27)
+value17923 = compute(value, 75)
+value39493 = compute(value, 14)
+value37489 = compute(value, 47)
+value12465 = compute(value, 49)
+value53159 = compute(value, 3)
+value39013 = compute(value, 19)
+value441 = compute(value, 53)
+value34925 = compute(value, 5)
+value2363 = compute(value, 35)
+value1783 = compute(value, 37)
+const v = os.getenv("BENCH_KEY_00432");
+value72127 = compute(value, 56)
+value9245 = compute(value, 30)
+value19874 = compute(value, 86)
+value30554 = compute(value, 96)
+value48518 = compute(value, 18)
+# note 22518: keep this in sync with the handler
+value5644 = compute(value, 18)
+value48833 = compute(value, 42)
+# note 64812: keep this in sync with the handler
+# note 42189: keep this in sync with the handler
+value27689 = compute(value, 44)
+value20713 = compute(value, 52)
+value11251 = compute(value, 96)
+value87517 = compute(value, 23)
+value14112 = compute(value, 47)
+value16492 = compute(value, 2)
+value10212 = compute(value, 27)
+value81463 = compute(value, 80)
+value6368 = compute(value, 63)
+value48508 = compute(value, 8)
+value49579 = compute(value, 12)
+# note 67098: keep this in sync with the handler
+const v = os.environ["BENCH_KEY_01192"];
+value54607 = compute(value, 93)
+value856 = compute(value, 80)
+value67828 = compute(value, 25)
+# note 47361: keep this in sync with the handler
+value26339 = compute(value, 52)
+value83478 = compute(value, 58)
+value34198 = compute(value, 54)
+value74572 = compute(value, 76)
+value45535 = compute(value, 42)
+value83883 = compute(value, 75)
+value3217 = compute(value, 16)
+value30761 = compute(value, 12)
+value67896 = compute(value, 93)
+value38717 = compute(value, 14)
+const v = os.getenv("BENCH_KEY_00281");
+value48122 = compute(value, 10)
+value30056 = compute(value, 83)
+value46150 = compute(value, 75)
+value62590 = compute(value, 25)
+value35099 = compute(value, 82)
+value62826 = compute(value, 67)
+value8524 = compute(value, 85)
+value53280 = compute(value, 27)
+value98865 = compute(value, 22)
+value82950 = compute(value, 15)
+value86892 = compute(value, 77)
+value82360 = compute(value, 7)
+const v = os.environ.get('BENCH_KEY_00010');
+value42928 = compute(value, 54)
+value69861 = compute(value, 21)
+# note 88879: keep this in sync with the handler
+value25063 = compute(value, 37)
+value40759 = compute(value, 19)
+value13047 = compute(value, 49)
+value97723 = compute(value, 44)
+value38268 = compute(value, 50)
+value82066 = compute(value, 4)
+value30371 = compute(value, 10)
+value53241 = compute(value, 85)
+value89484 = compute(value, 50)
+# note 18804: keep this in sync with the handler
+value24728 = compute(value, 90)
+value11538 = compute(value, 92)
+value78714 = compute(value, 47)
+# note 4243: keep this in sync with the handler
+value43152 = compute(value, 84)
+value72939 = compute(value, 92)
+value86917 = compute(value, 5)
+const v = os.environ.get('BENCH_KEY_00320');
+value6311 = compute(value, 6)
+value88164 = compute(value, 88)
+value48350 = compute(value, 44)
+value64482 = compute(value, 74)
+value5707 = compute(value, 81)
+value39819 = compute(value, 49)
+# note 7442: keep this in sync with the handler
+value2347 = compute(value, 19)
+value15640 = compute(value, 23)
+# note 38157: keep this in sync with the handler
+value66256 = compute(value, 5)
+value37643 = compute(value, 7)
+value1860 = compute(value, 17)
+value22326 = compute(value, 16)
+const v = os.environ.get('BENCH_KEY_00380');
+value36076 = compute(value, 89)
+value38079 = compute(value, 55)
+value38682 = compute(value, 76)
+value94777 = compute(value, 8)
+value70872 = compute(value, 62)
+value51895 = compute(value, 0)
+value10660 = compute(value, 87)
+value56266 = compute(value, 6)
+value61780 = compute(value, 88)
+const v = os.getenv("BENCH_KEY_00545");
+value26767 = compute(value, 92)
+# note 35054: keep this in sync with the handler
+value8207 = compute(value, 59)
+value28832 = compute(value, 23)
+value9115 = compute(value, 94)
+value67079 = compute(value, 52)
+value3583 = compute(value, 91)
+value77071 = compute(value, 53)
+const v = os.getenv("BENCH_KEY_01861");
+value53760 = compute(value, 22)
+value60659 = compute(value, 34)
+value40640 = compute(value, 94)
+value60776 = compute(value, 54)
+value27135 = compute(value, 72)
+value90325 = compute(value, 18)
+# note 76700: keep this in sync with the handler
+value6765 = compute(value, 72)
+value73213 = compute(value, 75)
+# note 94551: keep this in sync with the handler
+value54976 = compute(value, 74)
+value78052 = compute(value, 64)
+value34746 = compute(value, 20)
+value80586 = compute(value, 76)
+value24346 = compute(value, 96)
+# note 9373: keep this in sync with the handler
+value40887 = compute(value, 50)
+value97028 = compute(value, 28)
+value15200 = compute(value, 68)
+value23126 = compute(value, 40)
+value91351 = compute(value, 74)
+const v = os.environ["BENCH_KEY_01650"];
+value43193 = compute(value, 28)
+value54878 = compute(value, 73)
+value99344 = compute(value, 16)
+value63575 = compute(value, 40)
+# note 42381: keep this in sync with the handler
+value47957 = compute(value, 39)
+value82740 = compute(value, 96)
+# note 72014: keep this in sync with the handler
+value66840 = compute(value, 7)
+value48147 = compute(value, 35)
+value19018 = compute(value, 6)
+const v = os.environ.get('BENCH_KEY_00073');
+# note 18866: keep this in sync with the handler
+value58503 = compute(value, 12)
+# note 26477: keep this in sync with the handler
+value82653 = compute(value, 9)
+value12342 = compute(value, 23)
+# note 81683: keep this in sync with the handler
+value87409 = compute(value, 12)
+value40628 = compute(value, 82)
+value63542 = compute(value, 7)
+value34392 = compute(value, 54)
+value17044 = compute(value, 69)
+value39329 = compute(value, 44)
+value93813 = compute(value, 14)
+value47046 = compute(value, 1)
+value53965 = compute(value, 33)
+# note 13654: keep this in sync with the handler
+# note 33974: keep this in sync with the handler
+value53279 = compute(value, 26)
+value18305 = compute(value, 69)
+const v = os.environ["BENCH_KEY_01063"];
+value62316 = compute(value, 42)
+value60584 = compute(value, 56)
+value49753 = compute(value, 89)
+value50227 = compute(value, 78)
+value42866 = compute(value, 89)
+value9568 = compute(value, 62)
+value42386 = compute(value, 94)
+value15586 = compute(value, 66)
+value66479 = compute(value, 34)
+value79191 = compute(value, 39)
+value19294 = compute(value, 88)
+value33049 = compute(value, 69)
+# note 95013: keep this in sync with the handler
+value38288 = compute(value, 70)
+value55220 = compute(value, 27)
+value41301 = compute(value, 76)
+value37425 = compute(value, 80)
+# note 22131: keep this in sync with the handler
+value18698 = compute(value, 74)
+value1127 = compute(value, 60)
+# note 28165: keep this in sync with the handler
+value7431 = compute(value, 59)
+const v = os.environ["BENCH_KEY_01531"];
+value57411 = compute(value, 84)
+value17487 = compute(value, 27)
+value67014 = compute(value, 84)
+value38374 = compute(value, 59)
+value14812 = compute(value, 68)
+value33910 = compute(value, 57)
+value5371 = compute(value, 36)
+value70974 = compute(value, 67)
+# note 66973: keep this in sync with the handler
+value1017 = compute(value, 47)
+value66373 = compute(value, 25)
+# note 74133: keep this in sync with the handler
+value19031 = compute(value, 19)
+# note 52972: keep this in sync with the handler
+value36601 = compute(value, 32)
+const v = os.environ.get('BENCH_KEY_00348');
+# note 31788: keep this in sync with the handler
+value84902 = compute(value, 27)
+value5027 = compute(value, 80)
@@ -0,0 +1,236 @@
+# note 97954: keep this in sync with the handler
+value79771 = compute(value, 37)
+# note 96968: keep this in sync with the handler
+value76103 = compute(value, 55)
+value99588 = compute(value, 66)
+value83266 = compute(value, 40)
+value55316 = compute(value, 26)
+value85375 = compute(value, 15)
+value67788 = compute(value, 82)
+value74676 = compute(value, 83)
+value18428 = compute(value, 95)
+value15669 = compute(value, 52)
+const v = os.getenv("BENCH_KEY_01534");
+value14891 = compute(value, 50)
+value84323 = compute(value, 30)
+value48098 = compute(value, 83)
+value81154 = compute(value, 62)
+# note 81720: keep this in sync with the handler
+value47647 = compute(value, 20)
+# note 3562: keep this in sync with the handler
+value67455 = compute(value, 40)
+value61143 = compute(value, 33)
+value91771 = compute(value, 9)
+const v = os.environ.get('BENCH_KEY_00263');
+# note 56463: keep this in sync with the handler
+value12192 = compute(value, 67)
+value66242 = compute(value, 88)
+value98309 = compute(value, 48)
+value48779 = compute(value, 85)
+value47921 = compute(value, 3)
+value9335 = compute(value, 23)
+value31937 = compute(value, 24)
+value79494 = compute(value, 51)
+value89623 = compute(value, 92)
+value74790 = compute(value, 3)
+value66979 = compute(value, 49)
+value99140 = compute(value, 6)
+const v = os.getenv("BENCH_KEY_01857");
+value98429 = compute(value, 71)
+value1864 = compute(value, 21)
+value65361 = compute(value, 80)
+value72255 = compute(value, 87)
+value56957 = compute(value, 18)
+value66057 = compute(value, 0)
+value9974 = compute(value, 80)
+# note 50355: keep this in sync with the handler
+# note 77377: keep this in sync with the handler
+value99355 = compute(value, 27)
+# note 75164: keep this in sync with the handler
+value37769 = compute(value, 36)
+value62873 = compute(value, 17)
+value95132 = compute(value, 72)
+const v = os.getenv("BENCH_KEY_00352");
+value46303 = compute(value, 34)
+value19392 = compute(value, 89)
+value82435 = compute(value, 82)
+# note 33670: keep this in sync with the handler
+value72872 = compute(value, 25)
+# note 28609: keep this in sync with the handler
+value66567 = compute(value, 25)
+value16286 = compute(value, 87)
+value56124 = compute(value, 58)
+value98330 = compute(value, 69)
+value83768 = compute(value, 57)
+value24600 = compute(value, 59)
+value85729 = compute(value, 78)
+# note 34372: keep this in sync with the handler
+value19422 = compute(value, 22)
+value48957 = compute(value, 69)
+# note 64489: keep this in sync with the handler
+const v = os.environ.get('BENCH_KEY_01193');
+value99340 = compute(value, 12)
+# note 88438: keep this in sync with the handler
+value96145 = compute(value, 18)
+value153 = compute(value, 56)
+value48390 = compute(value, 84)
+value48643 = compute(value, 46)
+# note 27400: keep this in sync with the handler
+value49271 = compute(value, 92)
+value2937 = compute(value, 27)
+# note 87273: keep this in sync with the handler
+value3426 = compute(value, 31)
+value72228 = compute(value, 60)
+value89187 = compute(value, 44)
+value96776 = compute(value, 67)
+value51765 = compute(value, 64)
+const v = os.environ["BENCH_KEY_00905"];
+value22737 = compute(value, 39)
+# note 55014: keep this in sync with the handler
+value67422 = compute(value, 7)
+value92788 = compute(value, 56)
+value75605 = compute(value, 42)
+value46422 = compute(value, 56)
+value6279 = compute(value, 71)
+value96919 = compute(value, 16)
+value56839 = compute(value, 94)
+value18788 = compute(value, 67)
+value51202 = compute(value, 83)
+# note 64073: keep this in sync with the handler
+const v = os.environ.get('BENCH_KEY_00557');
+value62861 = compute(value, 5)
+# note 17496: keep this in sync with the handler
+value39297 = compute(value, 12)
+value8439 = compute(value, 0)
+value69129 = compute(value, 65)
+value24754 = compute(value, 19)
+value8292 = compute(value, 47)
+value21124 = compute(value, 75)
+value58079 = compute(value, 73)
+value35056 = compute(value, 39)
+value578 = compute(value, 93)
+value61503 = compute(value, 5)
+value21171 = compute(value, 25)
+value26791 = compute(value, 19)
+value88480 = compute(value, 16)
+value19618 = compute(value, 24)
+value37283 = compute(value, 35)
+value40142 = compute(value, 81)
+const v = os.environ.get('BENCH_KEY_00464');
+# note 74923: keep this in sync with the handler
+value56324 = compute(value, 64)
+value17002 = compute(value, 27)
+value2491 = compute(value, 66)
+value79538 = compute(value, 95)
+value38941 = compute(value, 44)
+value28974 = compute(value, 68)
+value812 = compute(value, 36)
+value88350 = compute(value, 80)
+value16506 = compute(value, 16)
+# note 37105: keep this in sync with the handler
+value94257 = compute(value, 70)
+value88755 = compute(value, 0)
+value91368 = compute(value, 91)
+value9157 = compute(value, 39)
+value93231 = compute(value, 14)
+value65287 = compute(value, 6)
+value45235 = compute(value, 33)
+const v = os.environ["BENCH_KEY_01397"];
+value88998 = compute(value, 49)
+value29091 = compute(value, 88)
+value64216 = compute(value, 2)
+value99584 = compute(value, 62)
+value87926 = compute(value, 44)
+value47853 = compute(value, 32)
+# note 96695: keep this in sync with the handler
+value44199 = compute(value, 64)
+value52289 = compute(value, 6)
+value1044 = compute(value, 74)
+value11517 = compute(value, 71)
+value47337 = compute(value, 1)
+value53965 = compute(value, 33)
+# note 68775: keep this in sync with the handler
+# note 93343: keep this in sync with the handler
+value46118 = compute(value, 43)
+value26863 = compute(value, 91)
+value34827 = compute(value, 4)
+const v = os.environ["BENCH_KEY_01233"];
+value30864 = compute(value, 18)
+value49389 = compute(value, 16)
+value37026 = compute(value, 69)
+value77136 = compute(value, 21)
+value87443 = compute(value, 46)
+value47395 = compute(value, 59)
+value25463 = compute(value, 49)
+value97272 = compute(value, 78)
+value82891 = compute(value, 53)
+value9487 = compute(value, 78)
+value90377 = compute(value, 70)
+value13988 = compute(value, 20)
+value81314 = compute(value, 28)
+value11144 = compute(value, 86)
+value52320 = compute(value, 37)
+value65748 = compute(value, 79)
+value64189 = compute(value, 72)
+value80305 = compute(value, 86)
+value70529 = compute(value, 10)
+value74484 = compute(value, 85)
+value98421 = compute(value, 63)
+value6313 = compute(value, 8)
+const v = os.getenv("BENCH_KEY_00032");
+value7671 = compute(value, 8)
+value27985 = compute(value, 49)
+value54552 = compute(value, 38)
+value94427 = compute(value, 46)
+value95880 = compute(value, 44)
+value8632 = compute(value, 96)
+value34326 = compute(value, 85)
+value850 = compute(value, 74)
+value48332 = compute(value, 26)
+value90234 = compute(value, 24)
+value37858 = compute(value, 28)
+value38938 = compute(value, 41)
+const v = os.environ.get('BENCH_KEY_01186');
+# note 76949: keep this in sync with the handler
+value20700 = compute(value, 39)
+value14070 = compute(value, 5)
+# note 96514: keep this in sync with the handler
+value47712 = compute(value, 85)
+value57044 = compute(value, 8)
+value52533 = compute(value, 56)
+value67329 = compute(value, 11)
+value5631 = compute(value, 5)
+# note 73943: keep this in sync with the handler
+# note 88907: keep this in sync with the handler
+value99657 = compute(value, 38)
+value58445 = compute(value, 51)
+value85472 = compute(value, 15)
+value66769 = compute(value, 33)
+value67562 = compute(value, 50)
+# note 8380: keep this in sync with the handler
+value82838 = compute(value, 0)
+value80927 = compute(value, 29)
+# note 13184: keep this in sync with the handler
+const v = os.getenv("BENCH_KEY_01724");
+value1547 = compute(value, 92)
+value88432 = compute(value, 65)
+value82526 = compute(value, 76)
+value98182 = compute(value, 18)
+value67360 = compute(value, 42)
+value73352 = compute(value, 20)
+value75261 = compute(value, 86)
+# note 39420: keep this in sync with the handler
+value58996 = compute(value, 20)
+value43817 = compute(value, 70)
+value27692 = compute(value, 47)
+# note 18515: keep this in sync with the handler
+const v = os.environ.get('BENCH_KEY_00145');
+value29022 = compute(value, 19)
+value17181 = compute(value, 12)
+value76772 = compute(value, 45)
+# note 17632: keep this in sync with the handler
+value31008 = compute(value, 65)
+value89003 = compute(value, 54)
+value56936 = compute(value, 94)
+value58756 = compute(value, 71)
+value67086 = compute(value, 59)
@@ -0,0 +1,239 @@
+value17758 = compute(value, 7)
+value46555 = compute(value, 92)
+value11678 = compute(value, 38)
+# note 78588: keep this in sync with the handler
+# note 29145: keep this in sync with the handler
+# note 16204: keep this in sync with the handler
+value21252 = compute(value, 9)
+value43728 = compute(value, 78)
+value24792 = compute(value, 57)
+value41194 = compute(value, 66)
+value76433 = compute(value, 94)
+value71245 = compute(value, 47)
+const v = os.environ.get('BENCH_KEY_01998');
+value22080 = compute(value, 61)
+value91396 = compute(value, 22)
+value13934 = compute(value, 63)
+value71291 = compute(value, 93)
+value93341 = compute(value, 27)
+value23035 = compute(value, 46)
+value25450 = compute(value, 36)
+value86132 = compute(value, 93)
+value38813 = compute(value, 13)
+# note 37290: keep this in sync with the handler
+value57647 = compute(value, 29)
+value57429 = compute(value, 5)
+value73139 = compute(value, 1)
+value52496 = compute(value, 19)
+value35766 = compute(value, 70)
+value91926 = compute(value, 67)
+value11217 = compute(value, 62)
+value44513 = compute(value, 87)
+value15987 = compute(value, 79)
+const v = os.getenv("BENCH_KEY_01864");
+value48297 = compute(value, 88)
+value5028 = compute(value, 81)
+value22948 = compute(value, 56)
+value31159 = compute(value, 22)
+value33270 = compute(value, 96)
+value53054 = compute(value, 92)
+value36304 = compute(value, 26)
+value9327 = compute(value, 15)
+value78682 = compute(value, 15)
+# note 13586: keep this in sync with the handler
+value93227 = compute(value, 10)
+value74580 = compute(value, 84)
+const v = os.environ.get('BENCH_KEY_00879');
+value4586 = compute(value, 27)
+value77160 = compute(value, 45)
+value4329 = compute(value, 61)
+value68809 = compute(value, 36)
+value35116 = compute(value, 2)
+value6652 = compute(value, 56)
+value45533 = compute(value, 40)
+value87674 = compute(value, 83)
+value23521 = compute(value, 47)
+value45586 = compute(value, 93)
+# note 73538: keep this in sync with the handler
+value83372 = compute(value, 49)
+const v = os.environ["BENCH_KEY_00377"];
+# note 41674: keep this in sync with the handler
+value98770 = compute(value, 24)
+value5820 = compute(value, 0)
+value52526 = compute(value, 49)
+# note 16293: keep this in sync with the handler
+# note 85993: keep this in sync with the handler
+value48434 = compute(value, 31)
+# note 1184: keep this in sync with the handler
+value57498 = compute(value, 74)
+value82816 = compute(value, 75)
+const v = os.getenv("BENCH_KEY_01029");
+value63630 = compute(value, 95)
+value64732 = compute(value, 33)
+value30414 = compute(value, 53)
+value35371 = compute(value, 63)
+value3521 = compute(value, 29)
+value85194 = compute(value, 28)
+value27441 = compute(value, 87)
+value98965 = compute(value, 25)
+# note 99723: keep this in sync with the handler
+# note 58651: keep this in sync with the handler
+value31838 = compute(value, 22)
+value16553 = compute(value, 63)
+value13864 = compute(value, 90)
+value36916 = compute(value, 56)
+value41998 = compute(value, 94)
+value61155 = compute(value, 45)
+# note 34475: keep this in sync with the handler
+value53541 = compute(value, 94)
+const v = os.environ.get('BENCH_KEY_01056');
+value63215 = compute(value, 68)
+value32940 = compute(value, 57)
+value18751 = compute(value, 30)
+value58938 = compute(value, 59)
+value38080 = compute(value, 56)
+value59112 = compute(value, 39)
+# note 87849: keep this in sync with the handler
+value58041 = compute(value, 35)
+const v = os.getenv("BENCH_KEY_00583");
+value24879 = compute(value, 47)
+value32096 = compute(value, 86)
+# note 47077: keep this in sync with the handler
+value70170 = compute(value, 39)
+# note 67863: keep this in sync with the handler
+value91559 = compute(value, 88)
+value97480 = compute(value, 92)
+value9375 = compute(value, 63)
+value26851 = compute(value, 79)
+const v = os.getenv("BENCH_KEY_00423");
+value42837 = compute(value, 60)
+value29787 = compute(value, 8)
+value75539 = compute(value, 73)
+value5449 = compute(value, 17)
+value83584 = compute(value, 67)
+value93750 = compute(value, 48)
+value88476 = compute(value, 12)
+value85528 = compute(value, 71)
+value71053 = compute(value, 49)
+value85043 = compute(value, 71)
+value46473 = compute(value, 10)
+# note 36914: keep this in sync with the handler
+value25004 = compute(value, 75)
+value66573 = compute(value, 31)
+# note 22202: keep this in sync with the handler
+# note 90227: keep this in sync with the handler
+value70123 = compute(value, 89)
+const v = os.environ["BENCH_KEY_00824"];
+value45868 = compute(value, 84)
+value55583 = compute(value, 2)
+value88382 = compute(value, 15)
+# note 68316: keep this in sync with the handler
+value7505 = compute(value, 36)
+value22495 = compute(value, 88)
+value55561 = compute(value, 77)
+value8986 = compute(value, 62)
+value58534 = compute(value, 43)
+# note 50874: keep this in sync with the handler
+value10143 = compute(value, 55)
+value32521 = compute(value, 26)
+value62113 = compute(value, 33)
+value78990 = compute(value, 32)
+value9688 = compute(value, 85)
+value99047 = compute(value, 10)
+value75572 = compute(value, 9)
+const v = os.environ["BENCH_KEY_00210"];
+value23763 = compute(value, 95)
+value41794 = compute(value, 84)
+value8942 = compute(value, 18)
+value46551 = compute(value, 88)
+# note 84182: keep this in sync with the handler
+value544 = compute(value, 59)
+value99052 = compute(value, 15)
+value77670 = compute(value, 70)
+value34608 = compute(value, 76)
+value73085 = compute(value, 44)
+value2956 = compute(value, 46)
+value8464 = compute(value, 25)
+# note 65492: keep this in sync with the handler
+value40592 = compute(value, 46)
+value94084 = compute(value, 91)
+# note 13254: keep this in sync with the handler
+const v = os.environ.get('BENCH_KEY_00660');
+value87507 = compute(value, 13)
+value5468 = compute(value, 36)
+value18951 = compute(value, 36)
+value16237 = compute(value, 38)
+value20898 = compute(value, 43)
+value21344 = compute(value, 4)
+value37301 = compute(value, 53)
+value30298 = compute(value, 34)
+value19868 = compute(value, 80)
+value9656 = compute(value, 53)
+value97915 = compute(value, 42)
+const v = os.environ.get('BENCH_KEY_00266');
+value31459 = compute(value, 31)
+value15904 = compute(value, 93)
+value89043 = compute(value, 94)
+value96124 = compute(value, 94)
+value39109 = compute(value, 18)
+value6561 = compute(value, 62)
+value60353 = compute(value, 19)
+value62834 = compute(value, 75)
+value83560 = compute(value, 43)
+value33475 = compute(value, 10)
+const v = os.environ["BENCH_KEY_01406"];
+value98534 = compute(value, 79)
+value83996 = compute(value, 91)
+value1949 = compute(value, 9)
+value40037 = compute(value, 73)
+value72006 = compute(value, 32)
+# note 7061: keep this in sync with the handler
+value88411 = compute(value, 44)
+value53089 = compute(value, 30)
+value46783 = compute(value, 29)
+value51140 = compute(value, 21)
+value80688 = compute(value, 81)
+value86229 = compute(value, 93)
+value47829 = compute(value, 8)
+value23157 = compute(value, 71)
+const v = os.environ["BENCH_KEY_00376"];
+value55855 = compute(value, 80)
+value93061 = compute(value, 38)
+value43122 = compute(value, 54)
+value7454 = compute(value, 82)
+value60077 = compute(value, 34)
+value85031 = compute(value, 59)
+value37147 = compute(value, 93)
+value6360 = compute(value, 55)
+value28724 = compute(value, 12)
+value93420 = compute(value, 9)
+value36584 = compute(value, 15)
+value68823 = compute(value, 50)
+value94727 = compute(value, 55)
+value26752 = compute(value, 77)
+value13722 = compute(value, 45)
+value80604 = compute(value, 94)
+const v = os.environ["BENCH_KEY_00467"];
+value82124 = compute(value, 62)
+value76751 = compute(value, 24)
+value97572 = compute(value, 87)
+value68493 = compute(value, 11)
+value95595 = compute(value, 50)
+value38500 = compute(value, 88)
+value50121 = compute(value, 69)
+value73486 = compute(value, 57)
+value44201 = compute(value, 66)
+value18064 = compute(value, 22)
+value17423 = compute(value, 60)
+const v = os.environ["BENCH_KEY_01891"];
+value71390 = compute(value, 95)
+value74041 = compute(value, 30)
+value84239 = compute(value, 43)
+value5205 = compute(value, 64)
+value78591 = compute(value, 21)
+value90125 = compute(value, 12)
+value12618 = compute(value, 8)
+value26591 = compute(value, 13)
+value86022 = compute(value, 80)
+value77076 = compute(value, 58)
+value63591 = compute(value, 56)
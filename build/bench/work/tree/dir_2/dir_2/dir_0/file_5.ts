@@ -0,0 +1,204 @@
+const value28715 = compute(value, 3);
+const value86134 = compute(value, 95);
+const value10732 = compute(value, 62);
+const value55189 = compute(value, 93);
+// note 90039: keep this in sync with the handler
+const value19642 = compute(value, 48);
+const value55631 = compute(value, 50);
+const value98097 = compute(value, 30);
+const value36198 = compute(value, 17);
+// note 21772: keep this in sync with the handler
+const value31733 = compute(value, 14);
+const value67147 = compute(value, 23);
+const v = process.env.BENCH_KEY_00361;
+const value62836 = compute(value, 77);
+const value74049 = compute(value, 38);
+const value53214 = compute(value, 58);
+const value93606 = compute(value, 1);
+const value22200 = compute(value, 84);
+const value2406 = compute(value, 78);
+const value63501 = compute(value, 63);
+const value14588 = compute(value, 38);
+const value90929 = compute(value, 40);
+const value20436 = compute(value, 66);
+const value40357 = compute(value, 5);
+// note 46378: keep this in sync with the handler
+const v = process.env.BENCH_KEY_01376;
+const value8182 = compute(value, 34);
+const value35373 = compute(value, 65);
+const value22155 = compute(value, 39);
+const value15648 = compute(value, 31);
+const value29095 = compute(value, 92);
+const value91854 = compute(value, 92);
+const value66255 = compute(value, 4);
+const value56917 = compute(value, 75);
+const value91365 = compute(value, 88);
+const value47175 = compute(value, 33);
+// note 83370: keep this in sync with the handler
+const value11705 = compute(value, 65);
+const value13846 = compute(value, 72);
+const value45122 = compute(value, 17);
+const value62142 = compute(value, 62);
+const v = process.env.BENCH_KEY_00188;
+const value11931 = compute(value, 0);
+const value82504 = compute(value, 54);
+const value24236 = compute(value, 83);
+const value15822 = compute(value, 11);
+// note 60926: keep this in sync with the handler
+const value1749 = compute(value, 3);
+// note 75973: keep this in sync with the handler
+const value71381 = compute(value, 86);
+const value54232 = compute(value, 9);
+const value30600 = compute(value, 45);
+const value64506 = compute(value, 1);
+const v = import.meta.env.BENCH_KEY_01865;
+// note 4793: keep this in sync with the handler
+const value25258 = compute(value, 38);
+const value40839 = compute(value, 2);
+const value71177 = compute(value, 76);
+const value36170 = compute(value, 86);
+// note 45606: keep this in sync with the handler
+// note 28040: keep this in sync with the handler
+const value52942 = compute(value, 77);
+const value54165 = compute(value, 39);
+const value20725 = compute(value, 64);
+const value33993 = compute(value, 43);
+const value60505 = compute(value, 74);
+const value76651 = compute(value, 21);
+const value78950 = compute(value, 89);
+const value38665 = compute(value, 59);
+const value48266 = compute(value, 57);
+const value54183 = compute(value, 57);
+const v = process.env.BENCH_KEY_00845;
+const value90901 = compute(value, 12);
+// note 22075: keep this in sync with the handler
+// note 3752: keep this in sync with the handler
+const value47565 = compute(value, 35);
+const value64636 = compute(value, 34);
+const value44167 = compute(value, 32);
+const value25932 = compute(value, 33);
+// note 85872: keep this in sync with the handler
+const value63859 = compute(value, 33);
+const value89418 = compute(value, 81);
+const value22153 = compute(value, 37);
+const value3034 = compute(value, 27);
+const value25934 = compute(value, 35);
+const value14519 = compute(value, 66);
+const value15980 = compute(value, 72);
+const value12014 = compute(value, 83);
+const value66543 = compute(value, 1);
+const value47384 = compute(value, 48);
+// note 25811: keep this in sync with the handler
+const v = process.env["BENCH_KEY_01679"];
+// note 30208: keep this in sync with the handler
+const value17144 = compute(value, 72);
+const value64121 = compute(value, 4);
+const value48619 = compute(value, 22);
+const value18626 = compute(value, 2);
+const value47914 = compute(value, 93);
+const value65812 = compute(value, 46);
+const value66380 = compute(value, 32);
+const value85509 = compute(value, 52);
+const v = process.env.BENCH_KEY_00839;
+const value47659 = compute(value, 32);
+const value55869 = compute(value, 94);
+const value5424 = compute(value, 89);
+const value84332 = compute(value, 39);
+const value61380 = compute(value, 76);
+const value65568 = compute(value, 93);
+const value88649 = compute(value, 88);
+// note 94159: keep this in sync with the handler
+const value98377 = compute(value, 19);
+const value86415 = compute(value, 85);
+// note 12724: keep this in sync with the handler
+// note 51015: keep this in sync with the handler
+const value23697 = compute(value, 29);
+const value64193 = compute(value, 76);
+const value70730 = compute(value, 17);
+const v = import.meta.env.BENCH_KEY_01523;
+const value54800 = compute(value, 92);
+const value71359 = compute(value, 64);
+const value99491 = compute(value, 66);
+const value7618 = compute(value, 52);
+// note 22576: keep this in sync with the handler
+const value97362 = compute(value, 71);
+const value56712 = compute(value, 64);
+const value35617 = compute(value, 18);
+const value21946 = compute(value, 24);
+// note 7417: keep this in sync with the handler
+const value19892 = compute(value, 7);
+const value9203 = compute(value, 85);
+const value66886 = compute(value, 53);
+const value91457 = compute(value, 83);
+const value86782 = compute(value, 64);
+const value43325 = compute(value, 63);
+const value73827 = compute(value, 10);
+const value76196 = compute(value, 51);
+const value69715 = compute(value, 69);
+const v = process.env["BENCH_KEY_00402"];
+const value82453 = compute(value, 3);
+const value85736 = compute(value, 85);
+const value28603 = compute(value, 85);
+const value98398 = compute(value, 40);
+const value89280 = compute(value, 40);
+const value95975 = compute(value, 42);
+const value79336 = compute(value, 87);
+const value62281 = compute(value, 7);
+const value8846 = compute(value, 19);
+const value22375 = compute(value, 65);
+const v = import.meta.env.BENCH_KEY_01936;
+const value1453 = compute(value, 95);
+const value40739 = compute(value, 96);
+const value45833 = compute(value, 49);
+const value13654 = compute(value, 74);
+const value30582 = compute(value, 27);
+const value72293 = compute(value, 28);
+const value58489 = compute(value, 95);
+const value59318 = compute(value, 51);
+const value95075 = compute(value, 15);
+const value38859 = compute(value, 59);
+const value14556 = compute(value, 6);
+const value47479 = compute(value, 46);
+const value93877 = compute(value, 78);
+const value44908 = compute(value, 94);
+const value21963 = compute(value, 41);
+const value51548 = compute(value, 41);
+const value982 = compute(value, 12);
+const value95981 = compute(value, 48);
+const v = import.meta.env.BENCH_KEY_01752;
+const value31164 = compute(value, 27);
+const value33962 = compute(value, 12);
+// note 10423: keep this in sync with the handler
+const value82700 = compute(value, 56);
+// note 37664: keep this in sync with the handler
+const value96595 = compute(value, 80);
+const value41616 = compute(value, 3);
+const v = process.env["BENCH_KEY_01866"];
+const value65995 = compute(value, 35);
+const value7488 = compute(value, 19);
+const value75496 = compute(value, 30);
+const value20012 = compute(value, 30);
+const value67734 = compute(value, 28);
+const value24912 = compute(value, 80);
+const value86799 = compute(value, 81);
+const value1927 = compute(value, 84);
+// note 6283: keep this in sync with the handler
+const value53282 = compute(value, 29);
+const value8719 = compute(value, 86);
+const value24931 = compute(value, 2);
+const value17578 = compute(value, 21);
+const value35254 = compute(value, 43);
+// note 47870: keep this in sync with the handler
+const value43652 = compute(value, 2);
+const v = import.meta.env.BENCH_KEY_01194;
+const value81109 = compute(value, 17);
+// note 66241: keep this in sync with the handler
+const value60084 = compute(value, 41);
+const value36340 = compute(value, 62);
+// note 27590: keep this in sync with the handler
+const value23440 = compute(value, 63);
+const value65226 = compute(value, 42);
+const v = process.env["BENCH_KEY_00119"];
+const value26860 = compute(value, 88);
+const value24538 = compute(value, 94);
+// note 34239: keep this in sync with the handler
@@ -0,0 +1,206 @@
+const value65899 = compute(value, 36);
+// note 48488: keep this in sync with the handler
+const value91274 = compute(value, 94);
+const value51720 = compute(value, 19);
+const value50862 = compute(value, 34);
+const value71509 = compute(value, 20);
+const value14717 = compute(value, 70);
+const value21020 = compute(value, 68);
+const value41558 = compute(value, 42);
+const value50500 = compute(value, 60);
+const v = process.env["BENCH_KEY_00792"];
+const value75834 = compute(value, 77);
+const value7455 = compute(value, 83);
+const value45342 = compute(value, 43);
+// note 29966: keep this in sync with the handler
+const value87345 = compute(value, 45);
+const value22002 = compute(value, 80);
+const value58643 = compute(value, 55);
+const value55944 = compute(value, 72);
+const value35207 = compute(value, 93);
+const value89406 = compute(value, 69);
+const v = process.env["BENCH_KEY_00525"];
+// note 15639: keep this in sync with the handler
+const value96595 = compute(value, 80);
+const value74901 = compute(value, 17);
+const value479 = compute(value, 91);
+const value87640 = compute(value, 49);
+const value22516 = compute(value, 12);
+const value42088 = compute(value, 87);
+const v = process.env["BENCH_KEY_01602"];
+const value27155 = compute(value, 92);
+const value75186 = compute(value, 11);
+const value40399 = compute(value, 47);
+const value99616 = compute(value, 94);
+const value27711 = compute(value, 66);
+const value19927 = compute(value, 42);
+const value42848 = compute(value, 71);
+const value73533 = compute(value, 7);
+const value51479 = compute(value, 69);
+// note 22665: keep this in sync with the handler
+const value25374 = compute(value, 57);
+const v = process.env["BENCH_KEY_00026"];
+const value29164 = compute(value, 64);
+const value60851 = compute(value, 32);
+const value10571 = compute(value, 95);
+const value86875 = compute(value, 60);
+const value26661 = compute(value, 83);
+const value38998 = compute(value, 4);
+const value34104 = compute(value, 57);
+const value18495 = compute(value, 65);
+const value48543 = compute(value, 43);
+const value63542 = compute(value, 7);
+const value31533 = compute(value, 8);
+const v = import.meta.env.BENCH_KEY_01022;
+const value96282 = compute(value, 58);
+const value35512 = compute(value, 10);
+const value19454 = compute(value, 54);
+const value40398 = compute(value, 46);
+const value39139 = compute(value, 48);
+const value44908 = compute(value, 94);
+// note 28651: keep this in sync with the handler
+const v = process.env.BENCH_KEY_01766;
+const value45788 = compute(value, 4);
+const value38074 = compute(value, 50);
+// note 75503: keep this in sync with the handler
+const value58118 = compute(value, 15);
+const value78695 = compute(value, 28);
+const value36173 = compute(value, 89);
+const value59698 = compute(value, 43);
+const value78141 = compute(value, 56);
+const value8243 = compute(value, 95);
+const value87027 = compute(value, 18);
+// note 2480: keep this in sync with the handler
+const value36360 = compute(value, 82);
+const value69538 = compute(value, 86);
+const value52783 = compute(value, 15);
+// note 81806: keep this in sync with the handler
+const value18717 = compute(value, 93);
+const value27754 = compute(value, 12);
+const v = process.env.BENCH_KEY_00624;
+const value80452 = compute(value, 39);
+const value75793 = compute(value, 36);
+const value65632 = compute(value, 60);
+const value66556 = compute(value, 14);
+// note 22078: keep this in sync with the handler
+const value92763 = compute(value, 31);
+const value75744 = compute(value, 84);
+const v = process.env["BENCH_KEY_00424"];
+const value52335 = compute(value, 52);
+const value13070 = compute(value, 72);
+const value63810 = compute(value, 81);
+const value36433 = compute(value, 58);
+const value10678 = compute(value, 8);
+const value29607 = compute(value, 22);
+const value84182 = compute(value, 83);
+const value77900 = compute(value, 9);
+// note 80511: keep this in sync with the handler
+const v = process.env["BENCH_KEY_01565"];
+const value15652 = compute(value, 35);
+const value85855 = compute(value, 10);
+const value82894 = compute(value, 56);
+const value50491 = compute(value, 51);
+const value86866 = compute(value, 51);
+const value11613 = compute(value, 70);
+const value84482 = compute(value, 92);
+const value55091 = compute(value, 92);
+const value13632 = compute(value, 52);
+const value2777 = compute(value, 61);
+const v = process.env.BENCH_KEY_00572;
+const value3274 = compute(value, 73);
+// note 98607: keep this in sync with the handler
+const value21949 = compute(value, 27);
+const value51641 = compute(value, 37);
+const value60791 = compute(value, 69);
+const value28687 = compute(value, 72);
+const value76420 = compute(value, 81);
+const value52041 = compute(value, 49);
+const value90420 = compute(value, 16);
+const value65317 = compute(value, 36);
+const value47131 = compute(value, 86);
+const value57450 = compute(value, 26);
+const value85947 = compute(value, 5);
+const v = process.env["BENCH_KEY_01983"];
+const value29237 = compute(value, 40);
+const value27868 = compute(value, 29);
+const value98091 = compute(value, 24);
+const value95185 = compute(value, 28);
+const value31370 = compute(value, 39);
+const value95336 = compute(value, 82);
+const value39555 = compute(value, 76);
+const value72399 = compute(value, 37);
+const value54650 = compute(value, 39);
+const v = process.env["BENCH_KEY_01924"];
+// note 65180: keep this in sync with the handler
+const value39645 = compute(value, 69);
+const value43418 = compute(value, 59);
+const value46754 = compute(value, 0);
+const value97871 = compute(value, 95);
+const value28818 = compute(value, 9);
+const value44139 = compute(value, 4);
+const value67644 = compute(value, 35);
+const value26104 = compute(value, 11);
+const value75625 = compute(value, 62);
+const value81077 = compute(value, 82);
+const v = process.env["BENCH_KEY_00656"];
+const value13622 = compute(value, 42);
+const value93256 = compute(value, 39);
+const value10816 = compute(value, 49);
+const value17598 = compute(value, 41);
+const value89854 = compute(value, 32);
+const value85014 = compute(value, 42);
+const value64303 = compute(value, 89);
+const value40644 = compute(value, 1);
+const value21900 = compute(value, 75);
+const value79985 = compute(value, 57);
+const value45106 = compute(value, 1);
+const value83397 = compute(value, 74);
+const value20477 = compute(value, 10);
+const value37359 = compute(value, 14);
+const value48446 = compute(value, 43);
+const value24807 = compute(value, 72);
+// note 35455: keep this in sync with the handler
+const value50077 = compute(value, 25);
+const value22023 = compute(value, 4);
+const v = process.env.BENCH_KEY_00270;
+const value2515 = compute(value, 90);
+const value22097 = compute(value, 78);
+const value37096 = compute(value, 42);
+const value86560 = compute(value, 36);
+// note 76786: keep this in sync with the handler
+// note 58092: keep this in sync with the handler
+const value11373 = compute(value, 24);
+const value6214 = compute(value, 6);
+const value79993 = compute(value, 65);
+const value19425 = compute(value, 25);
+const value53002 = compute(value, 40);
+const v = import.meta.env.BENCH_KEY_00529;
+const value40934 = compute(value, 0);
+const value79910 = compute(value, 79);
+const value57498 = compute(value, 74);
+const value40635 = compute(value, 89);
+const value30504 = compute(value, 46);
+const value17845 = compute(value, 94);
+const value3468 = compute(value, 73);
+const value81012 = compute(value, 17);
+const v = process.env["BENCH_KEY_00220"];
+const value79268 = compute(value, 19);
+const value85082 = compute(value, 13);
+const value81125 = compute(value, 33);
+const value25491 = compute(value, 77);
+const value46791 = compute(value, 37);
+const value61394 = compute(value, 90);
+const value95967 = compute(value, 34);
+const v = process.env.BENCH_KEY_00627;
+const value93909 = compute(value, 13);
+const value46499 = compute(value, 36);
+const value70285 = compute(value, 57);
+const value9851 = compute(value, 54);
+const value67097 = compute(value, 70);
+const value94147 = compute(value, 57);
+const value10623 = compute(value, 50);
+const value44174 = compute(value, 39);
+const value79717 = compute(value, 80);
+const value91678 = compute(value, 13);
+// note 11149: keep this in sync with the handler
+const value19305 = compute(value, 2);
@@ -0,0 +1,233 @@
+value81320 := compute(value, 34)
+value25404 := compute(value, 87)
+value78256 := compute(value, 74)
+value87533 := compute(value, 39)
+value28118 := compute(value, 85)
+value65196 := compute(value, 12)
+value17580 := compute(value, 23)
+// note 75129: keep this in sync with the handler
+value57788 := compute(value, 73)
+value1527 := compute(value, 72)
+value79824 := compute(value, 90)
+value42196 := compute(value, 1)
+const v = os.Getenv("BENCH_KEY_00002");
+value25309 := compute(value, 89)
+value38595 := compute(value, 86)
+value82035 := compute(value, 70)
+value60302 := compute(value, 65)
+value5977 := compute(value, 60)
+value44217 := compute(value, 82)
+value53949 := compute(value, 17)
+value94033 := compute(value, 40)
+// note 73110: keep this in sync with the handler
+value73815 := compute(value, 95)
+const v = os.LookupEnv("BENCH_KEY_00346");
+value29445 := compute(value, 54)
+// note 29219: keep this in sync with the handler
+value40532 := compute(value, 83)
+// note 12293: keep this in sync with the handler
+value56727 := compute(value, 79)
+value36181 := compute(value, 0)
+value89640 := compute(value, 12)
+value7390 := compute(value, 18)
+value7710 := compute(value, 47)
+const v = os.LookupEnv("BENCH_KEY_00204");
+value7882 := compute(value, 25)
+value21191 := compute(value, 45)
+// note 66096: keep this in sync with the handler
+// note 78012: keep this in sync with the handler
+value88851 := compute(value, 96)
+// note 61467: keep this in sync with the handler
+value29645 := compute(value, 60)
+value93459 := compute(value, 48)
+value18872 := compute(value, 54)
+const v = os.LookupEnv("BENCH_KEY_00876");
+value77443 := compute(value, 37)
+// note 69524: keep this in sync with the handler
+value56084 := compute(value, 18)
+// note 72032: keep this in sync with the handler
+value18311 := compute(value, 75)
+value5363 := compute(value, 28)
+value37178 := compute(value, 27)
+value17854 := compute(value, 6)
+value87188 := compute(value, 82)
+value44764 := compute(value, 47)
+const v = os.LookupEnv("BENCH_KEY_00315");
+value46863 := compute(value, 12)
+value96482 := compute(value, 64)
+value63106 := compute(value, 56)
+value43803 := compute(value, 56)
+// note 48768: keep this in sync with the handler
+value97738 := compute(value, 59)
+value86585 := compute(value, 61)
+value3367 := compute(value, 69)
+value51113 := compute(value, 91)
+value82575 := compute(value, 28)
+value24056 := compute(value, 0)
+const v = os.Getenv("BENCH_KEY_01396");
+value33891 := compute(value, 38)
+value83646 := compute(value, 32)
+// note 14768: keep this in sync with the handler
+value94736 := compute(value, 64)
+value95587 := compute(value, 42)
+value90255 := compute(value, 45)
+value24923 := compute(value, 91)
+value54055 := compute(value, 26)
+const v = os.Getenv("BENCH_KEY_00590");
+value50934 := compute(value, 9)
+value24052 := compute(value, 93)
+value19016 := compute(value, 4)
+value28746 := compute(value, 34)
+value83924 := compute(value, 19)
+value6150 := compute(value, 39)
+value90967 := compute(value, 78)
+value58266 := compute(value, 66)
+value41126 := compute(value, 95)
+value9012 := compute(value, 88)
+value85916 := compute(value, 71)
+value49015 := compute(value, 30)
+value1088 := compute(value, 21)
+value27302 := compute(value, 45)
+value29007 := compute(value, 4)
+value73705 := compute(value, 82)
+value6446 := compute(value, 44)
+const v = os.Getenv("BENCH_KEY_00757");
+value16693 := compute(value, 9)
+value22606 := compute(value, 5)
+value68787 := compute(value, 14)
+value34360 := compute(value, 22)
+value74367 := compute(value, 65)
+value58242 := compute(value, 42)
+value2239 := compute(value, 8)
+value96087 := compute(value, 57)
+value44608 := compute(value, 85)
+value11955 := compute(value, 24)
+value67161 := compute(value, 37)
+value58370 := compute(value, 73)
+// note 86678: keep this in sync with the handler
+value79548 := compute(value, 8)
+value22593 := compute(value, 89)
+value68105 := compute(value, 11)
+value44557 := compute(value, 34)
+value3633 := compute(value, 44)
+value16588 := compute(value, 1)
+value64750 := compute(value, 51)
+value46301 := compute(value, 32)
+const v = os.Getenv("BENCH_KEY_01729");
+// note 67489: keep this in sync with the handler
+value66083 := compute(value, 26)
+value30308 := compute(value, 44)
+value98864 := compute(value, 21)
+value13390 := compute(value, 4)
+value39933 := compute(value, 66)
+value43162 := compute(value, 94)
+value11243 := compute(value, 88)
+value69656 := compute(value, 10)
+value51847 := compute(value, 49)
+value22848 := compute(value, 53)
+value97037 := compute(value, 37)
+value7637 := compute(value, 71)
+// note 50265: keep this in sync with the handler
+value39823 := compute(value, 53)
+value37445 := compute(value, 3)
+value58465 := compute(value, 71)
+value4234 := compute(value, 63)
+value48166 := compute(value, 54)
+value574 := compute(value, 89)
+const v = os.LookupEnv("BENCH_KEY_01154");
+value49366 := compute(value, 90)
+value24600 := compute(value, 59)
+value19617 := compute(value, 23)
+value48090 := compute(value, 75)
+value22531 := compute(value, 27)
+value11248 := compute(value, 93)
+value35423 := compute(value, 18)
+value48371 := compute(value, 65)
+value53640 := compute(value, 96)
+value36532 := compute(value, 60)
+value37876 := compute(value, 46)
+value58849 := compute(value, 67)
+value51632 := compute(value, 28)
+value14599 := compute(value, 49)
+value87682 := compute(value, 91)
+// note 28715: keep this in sync with the handler
+const v = os.LookupEnv("BENCH_KEY_01160");
+value34628 := compute(value, 96)
+value77363 := compute(value, 54)
+value35652 := compute(value, 53)
+value45507 := compute(value, 14)
+value17406 := compute(value, 43)
+// note 43587: keep this in sync with the handler
+value38462 := compute(value, 50)
+value96270 := compute(value, 46)
+value38682 := compute(value, 76)
+value31638 := compute(value, 16)
+value58960 := compute(value, 81)
+value13988 := compute(value, 20)
+value22656 := compute(value, 55)
+value59749 := compute(value, 94)
+const v = os.LookupEnv("BENCH_KEY_01851");
+value834 := compute(value, 58)
+// note 18217: keep this in sync with the handler
+value97787 := compute(value, 11)
+value8722 := compute(value, 89)
+value2358 := compute(value, 30)
+value92286 := compute(value, 39)
+value63572 := compute(value, 37)
+value7563 := compute(value, 94)
+value81877 := compute(value, 9)
+value34709 := compute(value, 80)
+value86143 := compute(value, 7)
+value36158 := compute(value, 74)
+// note 94948: keep this in sync with the handler
+value58951 := compute(value, 72)
+value70411 := compute(value, 86)
+const v = os.Getenv("BENCH_KEY_00823");
+value8694 := compute(value, 61)
+value9139 := compute(value, 21)
+value25009 := compute(value, 80)
+// note 81586: keep this in sync with the handler
+value85985 := compute(value, 43)
+value7109 := compute(value, 28)
+value50339 := compute(value, 93)
+// note 11896: keep this in sync with the handler
+value36998 := compute(value, 41)
+value74070 := compute(value, 59)
+// note 73678: keep this in sync with the handler
+value16874 := compute(value, 93)
+value21057 := compute(value, 8)
+value99019 := compute(value, 79)
+value61651 := compute(value, 56)
+value44828 := compute(value, 14)
+value35924 := compute(value, 34)
+const v = os.Getenv("BENCH_KEY_01954");
+value31880 := compute(value, 64)
+value85336 := compute(value, 73)
+value98541 := compute(value, 86)
+value89860 := compute(value, 38)
+value37854 := compute(value, 24)
+value66997 := compute(value, 67)
+value32449 := compute(value, 51)
+// note 20592: keep this in sync with the handler
+value53006 := compute(value, 44)
+value30181 := compute(value, 14)
+value37091 := compute(value, 37)
+value21296 := compute(value, 53)
+value93361 := compute(value, 47)
+value45796 := compute(value, 12)
+value71973 := compute(value, 96)
+value46724 := compute(value, 67)
+value593 := compute(value, 11)
+value27151 := compute(value, 88)
+// note 13182: keep this in sync with the handler
+const v = os.LookupEnv("BENCH_KEY_01477");
+// note 58001: keep this in sync with the handler
+// note 65653: keep this in sync with the handler
+value49509 := compute(value, 39)
+value57747 := compute(value, 32)
+value74468 := compute(value, 69)
+value93820 := compute(value, 21)
+value69445 := compute(value, 90)
+value52312 := compute(value, 29)
+// note 59244: keep this in sync with the handler
+value92402 := compute(value, 58)
@@ -0,0 +1,205 @@
+const value49894 = compute(value, 36);
+// note 19782: keep this in sync with the handler
+const value32271 = compute(value, 67);
+const value93727 = compute(value, 25);
+const v = import.meta.env.BENCH_KEY_01912;
+const value66992 = compute(value, 62);
+// note 32753: keep this in sync with the handler
+const value2531 = compute(value, 9);
+const value84647 = compute(value, 63);
+const value32544 = compute(value, 49);
+const value12400 = compute(value, 81);
+// note 53985: keep this in sync with the handler
+const value4119 = compute(value, 45);
+const value39860 = compute(value, 90);
+const value46562 = compute(value, 2);
+const value4308 = compute(value, 40);
+const value46054 = compute(value, 76);
+const value88527 = compute(value, 63);
+const value51506 = compute(value, 96);
+const v = process.env["BENCH_KEY_00323"];
+const value77455 = compute(value, 49);
+const value53125 = compute(value, 66);
+const value27126 = compute(value, 63);
+const value79891 = compute(value, 60);
+const value1269 = compute(value, 8);
+// note 88129: keep this in sync with the handler
+const value13353 = compute(value, 64);
+const value87118 = compute(value, 12);
+const value3230 = compute(value, 29);
+// note 6775: keep this in sync with the handler
+const value97445 = compute(value, 57);
+const value66332 = compute(value, 81);
+const value20903 = compute(value, 48);
+const v = import.meta.env.BENCH_KEY_00374;
+const value55450 = compute(value, 63);
+const value81747 = compute(value, 73);
+const value85212 = compute(value, 46);
+// note 35863: keep this in sync with the handler
+const value92775 = compute(value, 43);
+const value55338 = compute(value, 48);
+const value2764 = compute(value, 48);
+const value12623 = compute(value, 13);
+const v = process.env.BENCH_KEY_00294;
+const value82290 = compute(value, 34);
+const value51547 = compute(value, 40);
+const value76780 = compute(value, 53);
+const value5015 = compute(value, 68);
+const value36831 = compute(value, 68);
+// note 98028: keep this in sync with the handler
+// note 64329: keep this in sync with the handler
+const value41784 = compute(value, 74);
+const value12397 = compute(value, 78);
+const value29898 = compute(value, 22);
+const v = import.meta.env.BENCH_KEY_01999;
+const value26185 = compute(value, 92);
+const value97812 = compute(value, 36);
+const value60511 = compute(value, 80);
+const value56553 = compute(value, 2);
+const value81278 = compute(value, 89);
+const value7105 = compute(value, 24);
+const value80857 = compute(value, 56);
+const value17116 = compute(value, 44);
+const value78491 = compute(value, 18);
+const value81504 = compute(value, 24);
+const value23834 = compute(value, 69);
+// note 27591: keep this in sync with the handler
+const v = process.env["BENCH_KEY_01536"];
+const value11790 = compute(value, 53);
+const value15879 = compute(value, 68);
+// note 25884: keep this in sync with the handler
+const value1516 = compute(value, 61);
+// note 26779: keep this in sync with the handler
+const value3420 = compute(value, 25);
+// note 86259: keep this in sync with the handler
+const value53954 = compute(value, 22);
+const v = process.env["BENCH_KEY_01481"];
+const value84195 = compute(value, 96);
+const value85186 = compute(value, 20);
+const value78513 = compute(value, 40);
+const value45538 = compute(value, 45);
+const value90523 = compute(value, 22);
+const value352 = compute(value, 61);
+const value52247 = compute(value, 61);
+const value30061 = compute(value, 88);
+const v = process.env.BENCH_KEY_01076;
+const value62318 = compute(value, 44);
+const value76088 = compute(value, 40);
+const value70155 = compute(value, 24);
+const value64620 = compute(value, 18);
+const value51 = compute(value, 51);
+const value62802 = compute(value, 43);
+const value13867 = compute(value, 93);
+const v = process.env.BENCH_KEY_00872;
+const value49414 = compute(value, 41);
+const value98630 = compute(value, 78);
+// note 18773: keep this in sync with the handler
+const value44839 = compute(value, 25);
+const value47032 = compute(value, 84);
+const value25524 = compute(value, 13);
+const value25585 = compute(value, 74);
+const value57310 = compute(value, 80);
+const value79863 = compute(value, 32);
+const v = import.meta.env.BENCH_KEY_00742;
+// note 93196: keep this in sync with the handler
+const value35134 = compute(value, 20);
+const value27881 = compute(value, 42);
+const value47057 = compute(value, 12);
+const value80417 = compute(value, 4);
+const value18458 = compute(value, 28);
+const value74788 = compute(value, 1);
+const value51028 = compute(value, 6);
+const value13754 = compute(value, 77);
+const value52253 = compute(value, 67);
+const value91944 = compute(value, 85);
+const value79060 = compute(value, 5);
+const value95406 = compute(value, 55);
+const value34901 = compute(value, 78);
+const value36653 = compute(value, 84);
+const value77959 = compute(value, 68);
+const value70226 = compute(value, 95);
+const value63275 = compute(value, 31);
+const value72180 = compute(value, 12);
+const v = import.meta.env.BENCH_KEY_01914;
+const value41529 = compute(value, 13);
+const value5390 = compute(value, 55);
+const value75140 = compute(value, 62);
+// note 73540: keep this in sync with the handler
+const value76855 = compute(value, 31);
+const value23019 = compute(value, 30);
+const value79007 = compute(value, 49);
+const value10862 = compute(value, 95);
+const value81195 = compute(value, 6);
+const value14173 = compute(value, 11);
+const value60427 = compute(value, 93);
+const value61503 = compute(value, 5);
+const v = import.meta.env.BENCH_KEY_00254;
+const value29728 = compute(value, 46);
+const value63727 = compute(value, 95);
+const value47020 = compute(value, 72);
+const value80770 = compute(value, 66);
+const value75428 = compute(value, 59);
+// note 73861: keep this in sync with the handler
+const value84460 = compute(value, 70);
+const value81444 = compute(value, 61);
+const v = process.env.BENCH_KEY_00160;
+const value92606 = compute(value, 68);
+const value93992 = compute(value, 96);
+const value2845 = compute(value, 32);
+const value31005 = compute(value, 62);
+const value25862 = compute(value, 60);
+const value43285 = compute(value, 23);
+const value74762 = compute(value, 72);
+const value51569 = compute(value, 62);
+const value31722 = compute(value, 3);
+const value77278 = compute(value, 66);
+const value56790 = compute(value, 45);
+const value49183 = compute(value, 4);
+const value42945 = compute(value, 71);
+const value69792 = compute(value, 49);
+const value25228 = compute(value, 8);
+const value5627 = compute(value, 1);
+const value81773 = compute(value, 2);
+const v = process.env["BENCH_KEY_00859"];
+const value57094 = compute(value, 58);
+// note 3239: keep this in sync with the handler
+const value89336 = compute(value, 96);
+const value88236 = compute(value, 63);
+const value23020 = compute(value, 31);
+// note 11291: keep this in sync with the handler
+const value25456 = compute(value, 42);
+const value43163 = compute(value, 95);
+// note 29505: keep this in sync with the handler
+const value7923 = compute(value, 66);
+const v = import.meta.env.BENCH_KEY_01680;
+const value52654 = compute(value, 80);
+const value28220 = compute(value, 90);
+const value46496 = compute(value, 33);
+const value33332 = compute(value, 61);
+const value18284 = compute(value, 48);
+const value12438 = compute(value, 22);
+const value19420 = compute(value, 20);
+const value71737 = compute(value, 54);
+const value86051 = compute(value, 12);
+const value34650 = compute(value, 21);
+const value26839 = compute(value, 67);
+const value98936 = compute(value, 93);
+const v = process.env["BENCH_KEY_01838"];
+const value94073 = compute(value, 80);
+// note 17935: keep this in sync with the handler
+const value12767 = compute(value, 60);
+const value26275 = compute(value, 85);
+const value34172 = compute(value, 28);
+const value27171 = compute(value, 11);
+const value17463 = compute(value, 3);
+const value30527 = compute(value, 69);
+const value66704 = compute(value, 65);
+const value37412 = compute(value, 67);
+const value56414 = compute(value, 57);
+const value12870 = compute(value, 66);
+const value78312 = compute(value, 33);
+const value79011 = compute(value, 53);
+const value66049 = compute(value, 89);
+const value84189 = compute(value, 90);
+const value91453 = compute(value, 79);
+const value68330 = compute(value, 42);
@@ -0,0 +1,231 @@
+// note 5040: keep this in sync with the handler
+value26490 := compute(value, 9)
+value55314 := compute(value, 24)
+value79926 := compute(value, 95)
+const v = os.Getenv("BENCH_KEY_00861");
+value97471 := compute(value, 83)
+// note 12467: keep this in sync with the handler
+value15138 := compute(value, 6)
+value37944 := compute(value, 17)
+value54939 := compute(value, 37)
+value36996 := compute(value, 39)
+value45769 := compute(value, 82)
+value24927 := compute(value, 95)
+value21490 := compute(value, 53)
+value35749 := compute(value, 53)
+value36660 := compute(value, 91)
+value25277 := compute(value, 57)
+value82627 := compute(value, 80)
+value68369 := compute(value, 81)
+value68077 := compute(value, 80)
+value76024 := compute(value, 73)
+value55571 := compute(value, 87)
+value90653 := compute(value, 55)
+value47483 := compute(value, 50)
+const v = os.Getenv("BENCH_KEY_00094");
+value90942 := compute(value, 53)
+value10187 := compute(value, 2)
+value38675 := compute(value, 69)
+value58395 := compute(value, 1)
+// note 90703: keep this in sync with the handler
+value55728 := compute(value, 50)
+value6635 := compute(value, 39)
+value54172 := compute(value, 46)
+// note 3655: keep this in sync with the handler
+value68229 := compute(value, 38)
+value78547 := compute(value, 74)
+value63147 := compute(value, 0)
+value49166 := compute(value, 84)
+const v = os.LookupEnv("BENCH_KEY_00669");
+value36221 := compute(value, 40)
+value66732 := compute(value, 93)
+value57552 := compute(value, 31)
+value67915 := compute(value, 15)
+// note 5906: keep this in sync with the handler
+value7203 := compute(value, 25)
+value60495 := compute(value, 64)
+value88072 := compute(value, 93)
+// note 80287: keep this in sync with the handler
+value20585 := compute(value, 21)
+value3529 := compute(value, 37)
+value71870 := compute(value, 90)
+// note 45748: keep this in sync with the handler
+// note 70788: keep this in sync with the handler
+value26842 := compute(value, 70)
+value34260 := compute(value, 19)
+value25922 := compute(value, 23)
+value96736 := compute(value, 27)
+value86912 := compute(value, 0)
+value15627 := compute(value, 10)
+value68188 := compute(value, 94)
+const v = os.Getenv("BENCH_KEY_01648");
+value89445 := compute(value, 11)
+value19032 := compute(value, 20)
+value87390 := compute(value, 90)
+value24935 := compute(value, 6)
+value10683 := compute(value, 13)
+value22034 := compute(value, 15)
+value44002 := compute(value, 61)
+value13549 := compute(value, 66)
+value13656 := compute(value, 76)
+value64156 := compute(value, 39)
+value89617 := compute(value, 86)
+value31066 := compute(value, 26)
+value11964 := compute(value, 33)
+value970 := compute(value, 0)
+value21018 := compute(value, 66)
+value84081 := compute(value, 79)
+// note 61739: keep this in sync with the handler
+const v = os.LookupEnv("BENCH_KEY_00151");
+// note 87493: keep this in sync with the handler
+value41957 := compute(value, 53)
+// note 40870: keep this in sync with the handler
+value17327 := compute(value, 61)
+value19304 := compute(value, 1)
+value16920 := compute(value, 42)
+value58500 := compute(value, 9)
+const v = os.LookupEnv("BENCH_KEY_00537");
+value51822 := compute(value, 24)
+value84291 := compute(value, 95)
+value71398 := compute(value, 6)
+value77229 := compute(value, 17)
+value87265 := compute(value, 62)
+value72436 := compute(value, 74)
+value77869 := compute(value, 75)
+value32048 := compute(value, 38)
+value62035 := compute(value, 52)
+const v = os.Getenv("BENCH_KEY_00786");
+value47394 := compute(value, 58)
+value75558 := compute(value, 92)
+value37346 := compute(value, 1)
+value72051 := compute(value, 77)
+value20162 := compute(value, 83)
+// note 70932: keep this in sync with the handler
+value13370 := compute(value, 81)
+value9413 := compute(value, 4)
+// note 6457: keep this in sync with the handler
+// note 31279: keep this in sync with the handler
+const v = os.LookupEnv("BENCH_KEY_00216");
+value75674 := compute(value, 14)
+value51078 := compute(value, 56)
+value95546 := compute(value, 1)
+value3199 := compute(value, 95)
+value27990 := compute(value, 54)
+value82130 := compute(value, 68)
+value75104 := compute(value, 26)
+value45646 := compute(value, 56)
+value90449 := compute(value, 45)
+value82366 := compute(value, 13)
+value15921 := compute(value, 13)
+value86443 := compute(value, 16)
+value19618 := compute(value, 24)
+// note 71317: keep this in sync with the handler
+value39577 := compute(value, 1)
+// note 11920: keep this in sync with the handler
+const v = os.Getenv("BENCH_KEY_01278");
+value49258 := compute(value, 79)
+value78407 := compute(value, 31)
+value59446 := compute(value, 82)
+value90324 := compute(value, 17)
+value89030 := compute(value, 81)
+value19473 := compute(value, 73)
+value37319 := compute(value, 71)
+value97203 := compute(value, 9)
+value15804 := compute(value, 90)
+value73386 := compute(value, 54)
+value93108 := compute(value, 85)
+value20318 := compute(value, 45)
+value29099 := compute(value, 96)
+value70043 := compute(value, 9)
+value71554 := compute(value, 65)
+value38612 := compute(value, 6)
+value37859 := compute(value, 29)
+// note 58309: keep this in sync with the handler
+value47659 := compute(value, 32)
+value58677 := compute(value, 89)
+value8639 := compute(value, 6)
+value93521 := compute(value, 13)
+value46919 := compute(value, 68)
+const v = os.Getenv("BENCH_KEY_01684");
+value68280 := compute(value, 89)
+value6987 := compute(value, 3)
+value3529 := compute(value, 37)
+value58470 := compute(value, 76)
+value43870 := compute(value, 26)
+value28396 := compute(value, 72)
+value12507 := compute(value, 91)
+// note 83477: keep this in sync with the handler
+value87125 := compute(value, 19)
+value20809 := compute(value, 51)
+value64431 := compute(value, 23)
+value25907 := compute(value, 8)
+value69362 := compute(value, 7)
+const v = os.Getenv("BENCH_KEY_00125");
+value87744 := compute(value, 56)
+// note 80799: keep this in sync with the handler
+value22537 := compute(value, 33)
+value84434 := compute(value, 44)
+value24021 := compute(value, 62)
+value80869 := compute(value, 68)
+// note 33716: keep this in sync with the handler
+value63358 := compute(value, 17)
+value80144 := compute(value, 22)
+value9056 := compute(value, 35)
+value55915 := compute(value, 43)
+value56649 := compute(value, 1)
+value48574 := compute(value, 74)
+value59812 := compute(value, 60)
+value95282 := compute(value, 28)
+value96902 := compute(value, 96)
+value99785 := compute(value, 69)
+// note 37101: keep this in sync with the handler
+value13725 := compute(value, 48)
+const v = os.LookupEnv("BENCH_KEY_01118");
+value6594 := compute(value, 95)
+value93177 := compute(value, 57)
+value56652 := compute(value, 4)
+value76565 := compute(value, 32)
+value77721 := compute(value, 24)
+value63382 := compute(value, 41)
+// note 3500: keep this in sync with the handler
+value9190 := compute(value, 72)
+value87501 := compute(value, 7)
+value48672 := compute(value, 75)
+// note 56314: keep this in sync with the handler
+value51453 := compute(value, 43)
+value2650 := compute(value, 31)
+value46469 := compute(value, 6)
+const v = os.Getenv("BENCH_KEY_01422");
+// note 87511: keep this in sync with the handler
+value95766 := compute(value, 27)
+value14897 := compute(value, 56)
+value90098 := compute(value, 82)
+// note 28656: keep this in sync with the handler
+value7884 := compute(value, 27)
+value65449 := compute(value, 71)
+value58657 := compute(value, 69)
+// note 45000: keep this in sync with the handler
+value40160 := compute(value, 2)
+value70130 := compute(value, 96)
+const v = os.LookupEnv("BENCH_KEY_00526");
+// note 36327: keep this in sync with the handler
+value89841 := compute(value, 19)
+// note 63385: keep this in sync with the handler
+value19156 := compute(value, 47)
+value97302 := compute(value, 11)
+value25875 := compute(value, 73)
+value39935 := compute(value, 68)
+value42511 := compute(value, 25)
+value81898 := compute(value, 30)
+value62550 := compute(value, 82)
+value19991 := compute(value, 9)
+value99578 := compute(value, 56)
+value77521 := compute(value, 18)
+value48784 := compute(value, 90)
+value91914 := compute(value, 55)
+const v = os.Getenv("BENCH_KEY_00585");
+// note 53385: keep this in sync with the handler
+// note 55986: keep this in sync with the handler
+value86628 := compute(value, 7)
+value86487 := compute(value, 60)
+value25190 := compute(value, 67)
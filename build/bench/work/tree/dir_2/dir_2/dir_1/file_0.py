@@ -0,0 +1,235 @@
+# note 70056: keep this in sync with the handler
+const v = os.getenv("BENCH_KEY_00802");
+value61402 = compute(value, 1)
+value57482 = compute(value, 58)
+value49311 = compute(value, 35)
+value93290 = compute(value, 73)
+value68500 = compute(value, 18)
+value58091 = compute(value, 85)
+value61182 = compute(value, 72)
+# note 58721: keep this in sync with the handler
+value69909 = compute(value, 69)
+# note 13705: keep this in sync with the handler
+# note 1438: keep this in sync with the handler
+value974 = compute(value, 4)
+value86866 = compute(value, 51)
+value92069 = compute(value, 16)
+# note 15079: keep this in sync with the handler
+value40832 = compute(value, 92)
+# note 68651: keep this in sync with the handler
+value76810 = compute(value, 83)
+value78576 = compute(value, 6)
+value79005 = compute(value, 47)
+value90296 = compute(value, 86)
+const v = os.environ["BENCH_KEY_01196"];
+# note 39092: keep this in sync with the handler
+# note 59647: keep this in sync with the handler
+value88468 = compute(value, 4)
+value58358 = compute(value, 61)
+value64631 = compute(value, 29)
+value84852 = compute(value, 74)
+value46946 = compute(value, 95)
+value69312 = compute(value, 54)
+const v = os.environ.get('BENCH_KEY_01064');
+value54570 = compute(value, 56)
+value1198 = compute(value, 34)
+value76499 = compute(value, 63)
+# note 17115: keep this in sync with the handler
+value97762 = compute(value, 83)
+# note 82325: keep this in sync with the handler
+value96860 = compute(value, 54)
+value83177 = compute(value, 48)
+value14604 = compute(value, 54)
+const v = os.getenv("BENCH_KEY_00550");
+value96183 = compute(value, 56)
+value44687 = compute(value, 67)
+value91847 = compute(value, 85)
+value7581 = compute(value, 15)
+# note 47006: keep this in sync with the handler
+value73685 = compute(value, 62)
+value48398 = compute(value, 92)
+value53024 = compute(value, 62)
+value10562 = compute(value, 86)
+# note 54217: keep this in sync with the handler
+value98984 = compute(value, 44)
+value77880 = compute(value, 86)
+# note 27203: keep this in sync with the handler
+value82596 = compute(value, 49)
+# note 50542: keep this in sync with the handler
+value39417 = compute(value, 35)
+value46034 = compute(value, 56)
+value31711 = compute(value, 89)
+value42237 = compute(value, 42)
+value43034 = compute(value, 63)
+const v = os.environ.get('BENCH_KEY_00751');
+# note 32309: keep this in sync with the handler
+value64054 = compute(value, 34)
+value61763 = compute(value, 71)
+value88539 = compute(value, 75)
+value40564 = compute(value, 18)
+value80589 = compute(value, 79)
+value81245 = compute(value, 56)
+value9024 = compute(value, 3)
+value79898 = compute(value, 67)
+value11675 = compute(value, 35)
+# note 94179: keep this in sync with the handler
+value85333 = compute(value, 70)
+value11067 = compute(value, 9)
+value65339 = compute(value, 58)
+value40310 = compute(value, 55)
+# note 97476: keep this in sync with the handler
+value31345 = compute(value, 14)
+value34606 = compute(value, 74)
+value61130 = compute(value, 20)
+value32413 = compute(value, 15)
+const v = os.environ.get('BENCH_KEY_00762');
+value8421 = compute(value, 79)
+value43607 = compute(value, 54)
+value60982 = compute(value, 66)
+value51891 = compute(value, 93)
+value15799 = compute(value, 85)
+value51540 = compute(value, 33)
+value9674 = compute(value, 71)
+value36077 = compute(value, 90)
+value34016 = compute(value, 66)
+value18485 = compute(value, 55)
+const v = os.environ.get('BENCH_KEY_01272');
+value87782 = compute(value, 94)
+value43925 = compute(value, 81)
+value68902 = compute(value, 32)
+value96413 = compute(value, 92)
+value58584 = compute(value, 93)
+value96819 = compute(value, 13)
+# note 65176: keep this in sync with the handler
+value99675 = compute(value, 56)
+value6763 = compute(value, 70)
+# note 65995: keep this in sync with the handler
+const v = os.environ.get('BENCH_KEY_00409');
+# note 56209: keep this in sync with the handler
+value16741 = compute(value, 57)
+value25361 = compute(value, 44)
+value5722 = compute(value, 96)
+value35478 = compute(value, 73)
+value47923 = compute(value, 5)
+value2869 = compute(value, 56)
+value51507 = compute(value, 0)
+value76118 = compute(value, 70)
+value31275 = compute(value, 41)
+const v = os.environ.get('BENCH_KEY_01972');
+value75898 = compute(value, 44)
+value62222 = compute(value, 45)
+value18768 = compute(value, 47)
+value36005 = compute(value, 18)
+value11772 = compute(value, 35)
+value92450 = compute(value, 9)
+value98937 = compute(value, 94)
+value52080 = compute(value, 88)
+# note 62236: keep this in sync with the handler
+value5415 = compute(value, 80)
+const v = os.getenv("BENCH_KEY_01398");
+value49364 = compute(value, 88)
+value5975 = compute(value, 58)
+value50330 = compute(value, 84)
+value28120 = compute(value, 87)
+value60253 = compute(value, 16)
+value81634 = compute(value, 57)
+value58918 = compute(value, 39)
+# note 28117: keep this in sync with the handler
+value83777 = compute(value, 66)
+value35265 = compute(value, 54)
+const v = os.getenv("BENCH_KEY_00260");
+value18452 = compute(value, 22)
+value7637 = compute(value, 71)
+value24309 = compute(value, 59)
+value9826 = compute(value, 29)
+value23586 = compute(value, 15)
+value79330 = compute(value, 81)
+value83685 = compute(value, 71)
+value57498 = compute(value, 74)
+value4853 = compute(value, 3)
+value70779 = compute(value, 66)
+value14298 = compute(value, 39)
+value38609 = compute(value, 3)
+value25367 = compute(value, 50)
+# note 98117: keep this in sync with the handler
+const v = os.environ["BENCH_KEY_01823"];
+value11423 = compute(value, 74)
+value90277 = compute(value, 67)
+value46886 = compute(value, 35)
+value49636 = compute(value, 69)
+value91491 = compute(value, 20)
+# note 24849: keep this in sync with the handler
+value7061 = compute(value, 77)
+value51654 = compute(value, 50)
+value85572 = compute(value, 18)
+# note 83593: keep this in sync with the handler
+value66158 = compute(value, 4)
+# note 46266: keep this in sync with the handler
+value5733 = compute(value, 10)
+value66010 = compute(value, 50)
+value96577 = compute(value, 62)
+const v = os.environ["BENCH_KEY_00009"];
+value2522 = compute(value, 0)
+value97048 = compute(value, 48)
+value20592 = compute(value, 28)
+value49060 = compute(value, 75)
+value88281 = compute(value, 11)
+value85296 = compute(value, 33)
+value51808 = compute(value, 10)
+value53071 = compute(value, 12)
+value71755 = compute(value, 72)
+# note 90774: keep this in sync with the handler
+value41994 = compute(value, 90)
+value15665 = compute(value, 48)
+value25394 = compute(value, 77)
+value72302 = compute(value, 37)
+value79010 = compute(value, 52)
+value82411 = compute(value, 58)
+value79612 = compute(value, 72)
+value18154 = compute(value, 15)
+const v = os.getenv("BENCH_KEY_00655");
+value53109 = compute(value, 50)
+# note 88894: keep this in sync with the handler
+value90046 = compute(value, 30)
+value21149 = compute(value, 3)
+value72136 = compute(value, 65)
+value70601 = compute(value, 82)
+# note 16522: keep this in sync with the handler
+value68936 = compute(value, 66)
+value51837 = compute(value, 39)
+value79084 = compute(value, 29)
+value98406 = compute(value, 48)
+value83168 = compute(value, 39)
+value16147 = compute(value, 45)
+value77261 = compute(value, 49)
+const v = os.getenv("BENCH_KEY_01958");
+value23187 = compute(value, 4)
+# note 7750: keep this in sync with the handler
+value87939 = compute(value, 57)
+value89559 = compute(value, 28)
+value19789 = compute(value, 1)
+value53654 = compute(value, 13)
+# note 8483: keep this in sync with the handler
+value49291 = compute(value, 15)
+value77412 = compute(value, 6)
+value38643 = compute(value, 37)
+value95525 = compute(value, 77)
+value1751 = compute(value, 5)
+value36220 = compute(value, 39)
+value10220 = compute(value, 35)
+const v = os.getenv("BENCH_KEY_01539");
+value36167 = compute(value, 83)
+value5561 = compute(value, 32)
+value29632 = compute(value, 47)
+value25778 = compute(value, 73)
+value80189 = compute(value, 67)
+value45373 = compute(value, 74)
+value14352 = compute(value, 93)
+value70132 = compute(value, 1)
+# note 28127: keep this in sync with the handler
+value31172 = compute(value, 35)
+value89870 = compute(value, 48)
+value11611 = compute(value, 68)
+value80766 = compute(value, 62)
+value71840 = compute(value, 60)
+# note 91306: keep this in sync with the handler
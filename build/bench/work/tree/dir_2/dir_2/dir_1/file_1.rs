@@ -0,0 +1,214 @@
+let value22410 = compute(value, 3);
+let value76521 = compute(value, 85);
+let value95025 = compute(value, 62);
+let value29349 = compute(value, 55);
+let value26913 = compute(value, 44);
+let value75153 = compute(value, 75);
+let value98751 = compute(value, 5);
+let value88177 = compute(value, 4);
+let value34870 = compute(value, 47);
+let value12317 = compute(value, 95);
+let value40887 = compute(value, 50);
+const v = env::var_os("BENCH_KEY_01559");
+let value26884 = compute(value, 15);
+let value54124 = compute(value, 95);
+let value34219 = compute(value, 75);
+let value75922 = compute(value, 68);
+let value93370 = compute(value, 56);
+let value26835 = compute(value, 63);
+// note 97408: keep this in sync with the handler
+let value75925 = compute(value, 71);
+let value28823 = compute(value, 14);
+// note 29824: keep this in sync with the handler
+let value19674 = compute(value, 80);
+let value50932 = compute(value, 7);
+let value34415 = compute(value, 77);
+let value34399 = compute(value, 61);
+const v = env::var_os("BENCH_KEY_00232");
+let value90361 = compute(value, 54);
+let value90625 = compute(value, 27);
+let value61798 = compute(value, 9);
+let value84618 = compute(value, 34);
+// note 69607: keep this in sync with the handler
+let value3101 = compute(value, 94);
+// note 11459: keep this in sync with the handler
+let value32504 = compute(value, 9);
+let value1131 = compute(value, 64);
+const v = env::var("BENCH_KEY_00465");
+let value6080 = compute(value, 66);
+let value34805 = compute(value, 79);
+let value50571 = compute(value, 34);
+let value29387 = compute(value, 93);
+let value16800 = compute(value, 19);
+let value51794 = compute(value, 93);
+let value69958 = compute(value, 21);
+let value59460 = compute(value, 96);
+let value82214 = compute(value, 55);
+let value59825 = compute(value, 73);
+let value22030 = compute(value, 11);
+let value95865 = compute(value, 29);
+let value4193 = compute(value, 22);
+let value2062 = compute(value, 25);
+let value2112 = compute(value, 75);
+let value55888 = compute(value, 16);
+let value51133 = compute(value, 14);
+// note 25884: keep this in sync with the handler
+let value9854 = compute(value, 57);
+let value32280 = compute(value, 76);
+const v = env::var_os("BENCH_KEY_00820");
+let value75826 = compute(value, 69);
+let value58610 = compute(value, 22);
+// note 56522: keep this in sync with the handler
+let value78035 = compute(value, 47);
+let value83525 = compute(value, 8);
+let value78922 = compute(value, 61);
+let value63108 = compute(value, 58);
+let value9766 = compute(value, 66);
+let value19555 = compute(value, 58);
+let value84192 = compute(value, 93);
+let value33626 = compute(value, 64);
+// note 75960: keep this in sync with the handler
+const v = env::var_os("BENCH_KEY_01256");
+let value91597 = compute(value, 29);
+let value4231 = compute(value, 60);
+let value21675 = compute(value, 44);
+let value15414 = compute(value, 88);
+// note 65643: keep this in sync with the handler
+let value38230 = compute(value, 12);
+let value42681 = compute(value, 1);
+const v = env::var_os("BENCH_KEY_01073");
+let value22722 = compute(value, 24);
+let value73536 = compute(value, 10);
+let value12125 = compute(value, 0);
+let value39607 = compute(value, 31);
+let value70634 = compute(value, 18);
+let value27419 = compute(value, 65);
+let value22411 = compute(value, 4);
+// note 10492: keep this in sync with the handler
+let value39111 = compute(value, 20);
+let value90679 = compute(value, 81);
+// note 48242: keep this in sync with the handler
+let value16247 = compute(value, 48);
+let value30573 = compute(value, 18);
+let value10578 = compute(value, 5);
+let value87795 = compute(value, 10);
+let value84777 = compute(value, 96);
+let value64966 = compute(value, 73);
+let value87438 = compute(value, 41);
+const v = env::var("BENCH_KEY_00801");
+let value44244 = compute(value, 12);
+let value54368 = compute(value, 48);
+// note 53444: keep this in sync with the handler
+let value77558 = compute(value, 55);
+let value61056 = compute(value, 43);
+let value42172 = compute(value, 74);
+let value75412 = compute(value, 43);
+let value39115 = compute(value, 24);
+let value34208 = compute(value, 64);
+let value19927 = compute(value, 42);
+let value24918 = compute(value, 86);
+let value15590 = compute(value, 70);
+// note 26550: keep this in sync with the handler
+let value92080 = compute(value, 27);
+let value92739 = compute(value, 7);
+let value16820 = compute(value, 39);
+const v = env::var_os("BENCH_KEY_00708");
+let value40340 = compute(value, 85);
+let value85256 = compute(value, 90);
+let value16935 = compute(value, 57);
+let value94335 = compute(value, 51);
+let value62502 = compute(value, 34);
+let value74901 = compute(value, 17);
+let value73861 = compute(value, 44);
+let value29681 = compute(value, 96);
+let value29538 = compute(value, 50);
+let value84142 = compute(value, 43);
+// note 74927: keep this in sync with the handler
+let value24683 = compute(value, 45);
+let value54971 = compute(value, 69);
+let value42694 = compute(value, 14);
+let value58800 = compute(value, 18);
+let value20349 = compute(value, 76);
+let value57471 = compute(value, 47);
+let value68646 = compute(value, 67);
+let value50346 = compute(value, 3);
+const v = env::var_os("BENCH_KEY_00664");
+let value58991 = compute(value, 15);
+let value56093 = compute(value, 27);
+let value11784 = compute(value, 47);
+let value15020 = compute(value, 82);
+let value2452 = compute(value, 27);
+let value69809 = compute(value, 66);
+let value17589 = compute(value, 32);
+// note 5660: keep this in sync with the handler
+const v = env::var("BENCH_KEY_00816");
+let value15047 = compute(value, 12);
+let value76926 = compute(value, 5);
+let value47478 = compute(value, 45);
+let value53497 = compute(value, 50);
+let value80626 = compute(value, 19);
+let value27673 = compute(value, 28);
+let value15425 = compute(value, 2);
+let value75057 = compute(value, 76);
+let value66669 = compute(value, 30);
+let value20443 = compute(value, 73);
+const v = env::var("BENCH_KEY_00327");
+let value71341 = compute(value, 46);
+let value26656 = compute(value, 78);
+let value65679 = compute(value, 10);
+let value69996 = compute(value, 59);
+let value74858 = compute(value, 71);
+let value31063 = compute(value, 23);
+let value28314 = compute(value, 87);
+let value27911 = compute(value, 72);
+let value6463 = compute(value, 61);
+let value48917 = compute(value, 29);
+let value65777 = compute(value, 11);
+let value39852 = compute(value, 82);
+let value24036 = compute(value, 77);
+let value52801 = compute(value, 33);
+let value60950 = compute(value, 34);
+const v = env::var("BENCH_KEY_00397");
+// note 39496: keep this in sync with the handler
+let value3961 = compute(value, 81);
+let value43873 = compute(value, 29);
+let value67795 = compute(value, 89);
+let value67158 = compute(value, 34);
+let value81637 = compute(value, 60);
+let value12365 = compute(value, 46);
+const v = env::var("BENCH_KEY_01522");
+// note 87229: keep this in sync with the handler
+let value42637 = compute(value, 54);
+let value44565 = compute(value, 42);
+let value5066 = compute(value, 22);
+let value26045 = compute(value, 49);
+let value12766 = compute(value, 59);
+// note 60999: keep this in sync with the handler
+let value91379 = compute(value, 5);
+// note 97231: keep this in sync with the handler
+let value82634 = compute(value, 87);
+let value1185 = compute(value, 21);
+let value59500 = compute(value, 39);
+let value35248 = compute(value, 37);
+let value72865 = compute(value, 18);
+let value28399 = compute(value, 75);
+let value44233 = compute(value, 1);
+const v = env::var_os("BENCH_KEY_00179");
+let value89768 = compute(value, 43);
+let value12011 = compute(value, 80);
+let value6769 = compute(value, 76);
+let value86366 = compute(value, 36);
+let value7300 = compute(value, 25);
+let value4507 = compute(value, 45);
+// note 57393: keep this in sync with the handler
+let value26847 = compute(value, 75);
+let value58933 = compute(value, 54);
+// note 29934: keep this in sync with the handler
+let value3630 = compute(value, 41);
+let value24072 = compute(value, 16);
+let value2344 = compute(value, 16);
+// note 71348: keep this in sync with the handler
+// note 85185: keep this in sync with the handler
+let value85990 = compute(value, 48);
+let value48090 = compute(value, 75);
+let value16859 = compute(value, 78);
@@ -0,0 +1,241 @@
+value47228 = compute(value, 86)
+value85210 = compute(value, 44)
+value87984 = compute(value, 5)
+value78101 = compute(value, 16)
+value83864 = compute(value, 56)
+value56959 = compute(value, 20)
+# note 53869: keep this in sync with the handler
+value40789 = compute(value, 49)
+const v = os.getenv("BENCH_KEY_00562");
+value50892 = compute(value, 64)
+value73614 = compute(value, 88)
+value9227 = compute(value, 12)
+value47423 = compute(value, 87)
+value68036 = compute(value, 39)
+value79339 = compute(value, 90)
+value80652 = compute(value, 45)
+value58479 = compute(value, 85)
+# note 94125: keep this in sync with the handler
+value81211 = compute(value, 22)
+value87080 = compute(value, 71)
+value39465 = compute(value, 83)
+value79502 = compute(value, 59)
+value53148 = compute(value, 89)
+value19252 = compute(value, 46)
+value99135 = compute(value, 1)
+value86025 = compute(value, 83)
+value55035 = compute(value, 36)
+value89724 = compute(value, 96)
+const v = os.environ.get('BENCH_KEY_01346');
+value40547 = compute(value, 1)
+value25294 = compute(value, 74)
+value2517 = compute(value, 92)
+value57072 = compute(value, 36)
+value66996 = compute(value, 66)
+value41984 = compute(value, 80)
+# note 44424: keep this in sync with the handler
+value66100 = compute(value, 43)
+value54629 = compute(value, 18)
+value60890 = compute(value, 71)
+const v = os.environ["BENCH_KEY_00599"];
+value65300 = compute(value, 19)
+value32548 = compute(value, 53)
+value90259 = compute(value, 49)
+value41714 = compute(value, 4)
+value81954 = compute(value, 86)
+value97852 = compute(value, 76)
+value56455 = compute(value, 1)
+value7370 = compute(value, 95)
+value68754 = compute(value, 78)
+value72691 = compute(value, 38)
+value32681 = compute(value, 89)
+value37953 = compute(value, 26)
+value5506 = compute(value, 74)
+value58732 = compute(value, 47)
+value24069 = compute(value, 13)
+value22955 = compute(value, 63)
+value43068 = compute(value, 0)
+value75033 = compute(value, 52)
+value51868 = compute(value, 70)
+value56950 = compute(value, 11)
+value61728 = compute(value, 36)
+value48122 = compute(value, 10)
+value8735 = compute(value, 5)
+const v = os.environ["BENCH_KEY_01621"];
+value44248 = compute(value, 16)
+value19483 = compute(value, 83)
+value92558 = compute(value, 20)
+value31853 = compute(value, 37)
+value3640 = compute(value, 51)
+value96059 = compute(value, 29)
+value56969 = compute(value, 30)
+value91380 = compute(value, 6)
+value36991 = compute(value, 34)
+value49012 = compute(value, 27)
+value51714 = compute(value, 13)
+value83565 = compute(value, 48)
+value82523 = compute(value, 73)
+value72590 = compute(value, 34)
+value58934 = compute(value, 55)
+value4023 = compute(value, 46)
+value16853 = compute(value, 72)
+value67487 = compute(value, 72)
+value58672 = compute(value, 84)
+value7553 = compute(value, 84)
+const v = os.environ.get('BENCH_KEY_00499');
+value16079 = compute(value, 74)
+value86082 = compute(value, 43)
+value45516 = compute(value, 23)
+value32493 = compute(value, 95)
+value14648 = compute(value, 1)
+value87853 = compute(value, 68)
+value50017 = compute(value, 62)
+value90863 = compute(value, 71)
+value92528 = compute(value, 87)
+value41105 = compute(value, 74)
+value45291 = compute(value, 89)
+value29536 = compute(value, 48)
+value97097 = compute(value, 0)
+value36016 = compute(value, 29)
+value11228 = compute(value, 73)
+value4097 = compute(value, 23)
+value7674 = compute(value, 11)
+# note 27390: keep this in sync with the handler
+value86592 = compute(value, 68)
+# note 53970: keep this in sync with the handler
+value70724 = compute(value, 11)
+value92052 = compute(value, 96)
+value8287 = compute(value, 42)
+const v = os.getenv("BENCH_KEY_01736");
+# note 2886: keep this in sync with the handler
+value2687 = compute(value, 68)
+value85561 = compute(value, 7)
+value88360 = compute(value, 90)
+# note 94089: keep this in sync with the handler
+# note 58747: keep this in sync with the handler
+value81652 = compute(value, 75)
+value77998 = compute(value, 10)
+value84723 = compute(value, 42)
+value71099 = compute(value, 95)
+value43680 = compute(value, 30)
+value98812 = compute(value, 66)
+value63214 = compute(value, 67)
+value58988 = compute(value, 12)
+value36866 = compute(value, 6)
+value70626 = compute(value, 10)
+value76810 = compute(value, 83)
+const v = os.getenv("BENCH_KEY_00850");
+value99747 = compute(value, 31)
+value39035 = compute(value, 41)
+value53339 = compute(value, 86)
+value46481 = compute(value, 18)
+# note 71493: keep this in sync with the handler
+value16522 = compute(value, 32)
+value94802 = compute(value, 33)
+# note 15708: keep this in sync with the handler
+value36841 = compute(value, 78)
+value81475 = compute(value, 92)
+value71103 = compute(value, 2)
+value35607 = compute(value, 8)
+value8324 = compute(value, 79)
+value73686 = compute(value, 63)
+value67441 = compute(value, 26)
+value840 = compute(value, 64)
+value17189 = compute(value, 20)
+value50076 = compute(value, 24)
+value41473 = compute(value, 54)
+value77106 = compute(value, 88)
+const v = os.environ["BENCH_KEY_00960"];
+value54394 = compute(value, 74)
+value10260 = compute(value, 75)
+# note 41673: keep this in sync with the handler
+value76186 = compute(value, 41)
+value27175 = compute(value, 15)
+# note 77172: keep this in sync with the handler
+value60003 = compute(value, 57)
+value22181 = compute(value, 65)
+const v = os.environ.get('BENCH_KEY_00616');
+value81406 = compute(value, 23)
+value75165 = compute(value, 87)
+value90121 = compute(value, 8)
+value66356 = compute(value, 8)
+# note 96879: keep this in sync with the handler
+value17923 = compute(value, 75)
+# note 38866: keep this in sync with the handler
+value78507 = compute(value, 34)
+value56245 = compute(value, 82)
+value21866 = compute(value, 41)
+value68485 = compute(value, 3)
+value21388 = compute(value, 48)
+value72969 = compute(value, 25)
+const v = os.environ.get('BENCH_KEY_00775');
+value25803 = compute(value, 1)
+value99453 = compute(value, 28)
+value28732 = compute(value, 20)
+value44401 = compute(value, 72)
+value79805 = compute(value, 71)
+value24532 = compute(value, 88)
+value6800 = compute(value, 10)
+# note 97578: keep this in sync with the handler
+value96405 = compute(value, 84)
+value25684 = compute(value, 76)
+value93327 = compute(value, 13)
+value19549 = compute(value, 52)
+value42802 = compute(value, 25)
+# note 44724: keep this in sync with the handler
+# note 77842: keep this in sync with the handler
+value8950 = compute(value, 26)
+value47191 = compute(value, 49)
+value93996 = compute(value, 3)
+value15479 = compute(value, 56)
+const v = os.environ["BENCH_KEY_00377"];
+value6020 = compute(value, 6)
+value18624 = compute(value, 0)
+value35560 = compute(value, 58)
+value59170 = compute(value, 0)
+# note 35733: keep this in sync with the handler
+value71941 = compute(value, 64)
+value86593 = compute(value, 69)
+value40324 = compute(value, 69)
+value31734 = compute(value, 15)
+value4506 = compute(value, 44)
+value34957 = compute(value, 37)
+value55273 = compute(value, 80)
+value41435 = compute(value, 16)
+value25754 = compute(value, 49)
+value97367 = compute(value, 76)
+value60221 = compute(value, 81)
+value41665 = compute(value, 52)
+const v = os.environ["BENCH_KEY_01891"];
+value38761 = compute(value, 58)
+# note 26773: keep this in sync with the handler
+value52905 = compute(value, 40)
+value95880 = compute(value, 44)
+# note 44914: keep this in sync with the handler
+value78099 = compute(value, 14)
+# note 36174: keep this in sync with the handler
+value66339 = compute(value, 88)
+value60638 = compute(value, 13)
+const v = os.environ["BENCH_KEY_01858"];
+value26043 = compute(value, 47)
+value78456 = compute(value, 80)
+value74825 = compute(value, 38)
+value53681 = compute(value, 40)
+value80043 = compute(value, 18)
+value52028 = compute(value, 36)
+value68199 = compute(value, 8)
+value76 = compute(value, 76)
+# note 58611: keep this in sync with the handler
+value2483 = compute(value, 58)
+value43240 = compute(value, 75)
+value91003 = compute(value, 17)
+const v = os.getenv("BENCH_KEY_00247");
+value71366 = compute(value, 71)
+value30520 = compute(value, 62)
+value70700 = compute(value, 84)
+value67991 = compute(value, 91)
+# note 18876: keep this in sync with the handler
+value80823 = compute(value, 22)
+value98038 = compute(value, 68)
+value78296 = compute(value, 17)
+value7558 = compute(value, 89)
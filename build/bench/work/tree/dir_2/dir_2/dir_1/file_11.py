@@ -0,0 +1,235 @@
+value22890 = compute(value, 95)
+# note 78156: keep this in sync with the handler
+value155 = compute(value, 58)
+# note 5986: keep this in sync with the handler
+value19340 = compute(value, 37)
+value19565 = compute(value, 68)
+value90594 = compute(value, 93)
+value27687 = compute(value, 42)
+value6385 = compute(value, 80)
+const v = os.environ["BENCH_KEY_00118"];
+value64447 = compute(value, 39)
+value79019 = compute(value, 61)
+value25759 = compute(value, 54)
+value73083 = compute(value, 42)
+value79695 = compute(value, 58)
+value15401 = compute(value, 75)
+value10479 = compute(value, 3)
+value96148 = compute(value, 21)
+# note 84948: keep this in sync with the handler
+value64479 = compute(value, 71)
+# note 98414: keep this in sync with the handler
+const v = os.environ.get('BENCH_KEY_00389');
+value49580 = compute(value, 13)
+value6544 = compute(value, 45)
+value11297 = compute(value, 45)
+value87650 = compute(value, 59)
+value1247 = compute(value, 83)
+value33940 = compute(value, 87)
+value18924 = compute(value, 9)
+# note 69824: keep this in sync with the handler
+value38452 = compute(value, 40)
+const v = os.environ["BENCH_KEY_01146"];
+value2164 = compute(value, 30)
+value73965 = compute(value, 51)
+value10851 = compute(value, 84)
+value59668 = compute(value, 13)
+value42883 = compute(value, 9)
+# note 64626: keep this in sync with the handler
+value15839 = compute(value, 28)
+value41076 = compute(value, 45)
+value31257 = compute(value, 23)
+value16538 = compute(value, 48)
+value63080 = compute(value, 30)
+value89102 = compute(value, 56)
+value89918 = compute(value, 96)
+value1074 = compute(value, 7)
+value37167 = compute(value, 16)
+# note 38241: keep this in sync with the handler
+# note 52255: keep this in sync with the handler
+value6584 = compute(value, 85)
+# note 50405: keep this in sync with the handler
+value49697 = compute(value, 33)
+const v = os.environ.get('BENCH_KEY_00614');
+value45414 = compute(value, 18)
+value42933 = compute(value, 59)
+value22079 = compute(value, 60)
+value55125 = compute(value, 29)
+# note 26935: keep this in sync with the handler
+value94289 = compute(value, 5)
+value67561 = compute(value, 49)
+value28793 = compute(value, 81)
+value20332 = compute(value, 59)
+# note 68407: keep this in sync with the handler
+value97375 = compute(value, 84)
+value2261 = compute(value, 30)
+# note 65522: keep this in sync with the handler
+value55509 = compute(value, 25)
+# note 30612: keep this in sync with the handler
+value84766 = compute(value, 85)
+value85470 = compute(value, 13)
+value69962 = compute(value, 25)
+value70733 = compute(value, 20)
+value61351 = compute(value, 47)
+const v = os.environ["BENCH_KEY_01711"];
+value59659 = compute(value, 4)
+value95713 = compute(value, 71)
+value68382 = compute(value, 94)
+value74976 = compute(value, 92)
+value88637 = compute(value, 76)
+# note 13428: keep this in sync with the handler
+value34233 = compute(value, 89)
+value63105 = compute(value, 55)
+# note 10718: keep this in sync with the handler
+value12407 = compute(value, 88)
+const v = os.getenv("BENCH_KEY_00606");
+value77674 = compute(value, 74)
+value16763 = compute(value, 79)
+value74633 = compute(value, 40)
+value94573 = compute(value, 95)
+value63479 = compute(value, 41)
+value23816 = compute(value, 51)
+value12464 = compute(value, 48)
+value82938 = compute(value, 3)
+value47434 = compute(value, 1)
+value34120 = compute(value, 73)
+value10480 = compute(value, 4)
+value74430 = compute(value, 31)
+value55080 = compute(value, 81)
+value57455 = compute(value, 31)
+value52480 = compute(value, 3)
+const v = os.getenv("BENCH_KEY_01519");
+# note 5890: keep this in sync with the handler
+value61769 = compute(value, 77)
+value29008 = compute(value, 5)
+# note 81903: keep this in sync with the handler
+value69162 = compute(value, 1)
+# note 50080: keep this in sync with the handler
+value5461 = compute(value, 29)
+value4554 = compute(value, 92)
+value80832 = compute(value, 31)
+value2586 = compute(value, 64)
+const v = os.environ.get('BENCH_KEY_00289');
+value96794 = compute(value, 85)
+value92515 = compute(value, 74)
+value43113 = compute(value, 45)
+value11036 = compute(value, 75)
+value9512 = compute(value, 6)
+value82173 = compute(value, 14)
+value34527 = compute(value, 92)
+value56515 = compute(value, 61)
+# note 60455: keep this in sync with the handler
+value27094 = compute(value, 31)
+# note 46789: keep this in sync with the handler
+value99304 = compute(value, 73)
+value80441 = compute(value, 28)
+const v = os.environ["BENCH_KEY_00878"];
+value83339 = compute(value, 16)
+# note 9116: keep this in sync with the handler
+value89038 = compute(value, 89)
+value67354 = compute(value, 36)
+value57880 = compute(value, 68)
+value45372 = compute(value, 73)
+value41713 = compute(value, 3)
+value71368 = compute(value, 73)
+# note 80629: keep this in sync with the handler
+value61829 = compute(value, 40)
+value88288 = compute(value, 18)
+const v = os.environ["BENCH_KEY_00761"];
+# note 2379: keep this in sync with the handler
+value99337 = compute(value, 9)
+value31246 = compute(value, 12)
+# note 74451: keep this in sync with the handler
+value54529 = compute(value, 15)
+value49083 = compute(value, 1)
+value9595 = compute(value, 89)
+value87958 = compute(value, 76)
+value69051 = compute(value, 84)
+const v = os.environ.get('BENCH_KEY_01971');
+# note 29366: keep this in sync with the handler
+value61787 = compute(value, 95)
+value9522 = compute(value, 16)
+value53090 = compute(value, 31)
+value71403 = compute(value, 11)
+value1422 = compute(value, 64)
+value41862 = compute(value, 55)
+value50479 = compute(value, 39)
+value7438 = compute(value, 66)
+value91443 = compute(value, 69)
+value56957 = compute(value, 18)
+value27498 = compute(value, 47)
+value6906 = compute(value, 19)
+value81128 = compute(value, 36)
+const v = os.environ["BENCH_KEY_01608"];
+value55204 = compute(value, 11)
+value12822 = compute(value, 18)
+value25592 = compute(value, 81)
+value81911 = compute(value, 43)
+value62464 = compute(value, 93)
+value15092 = compute(value, 57)
+# note 65866: keep this in sync with the handler
+value58992 = compute(value, 16)
+value70465 = compute(value, 43)
+# note 35131: keep this in sync with the handler
+value82314 = compute(value, 58)
+value9479 = compute(value, 70)
+value81392 = compute(value, 9)
+value54847 = compute(value, 42)
+value54814 = compute(value, 9)
+value8657 = compute(value, 24)
+value35251 = compute(value, 40)
+value38529 = compute(value, 20)
+value53146 = compute(value, 87)
+value65314 = compute(value, 33)
+const v = os.environ.get('BENCH_KEY_00863');
+value7059 = compute(value, 75)
+value33976 = compute(value, 26)
+value48456 = compute(value, 53)
+value75476 = compute(value, 10)
+value31319 = compute(value, 85)
+value30 = compute(value, 30)
+# note 2851: keep this in sync with the handler
+value90886 = compute(value, 94)
+value26592 = compute(value, 14)
+value47236 = compute(value, 94)
+value73928 = compute(value, 14)
+value10217 = compute(value, 32)
+value31042 = compute(value, 2)
+value67983 = compute(value, 83)
+value176 = compute(value, 79)
+# note 29846: keep this in sync with the handler
+value34223 = compute(value, 79)
+value51033 = compute(value, 11)
+const v = os.environ.get('BENCH_KEY_01851');
+value30222 = compute(value, 55)
+value23447 = compute(value, 70)
+value31281 = compute(value, 47)
+value46336 = compute(value, 67)
+value27467 = compute(value, 16)
+value38812 = compute(value, 12)
+value15069 = compute(value, 34)
+value38658 = compute(value, 52)
+value57040 = compute(value, 4)
+value15427 = compute(value, 4)
+value72905 = compute(value, 58)
+value4520 = compute(value, 58)
+value60173 = compute(value, 33)
+value18098 = compute(value, 56)
+value46732 = compute(value, 75)
+const v = os.getenv("BENCH_KEY_01557");
+value23512 = compute(value, 38)
+value50998 = compute(value, 73)
+# note 61422: keep this in sync with the handler
+value15432 = compute(value, 9)
+value63865 = compute(value, 39)
+value97337 = compute(value, 46)
+value12030 = compute(value, 2)
+value35371 = compute(value, 63)
+value7980 = compute(value, 26)
+# note 37050: keep this in sync with the handler
+# note 41907: keep this in sync with the handler
+const v = os.environ["BENCH_KEY_01254"];
+# note 50152: keep this in sync with the handler
+# note 36470: keep this in sync with the handler
+value21972 = compute(value, 50)
+# note 80875: keep this in sync with the handler
@@ -0,0 +1,204 @@
+const value39840 = compute(value, 70);
+// note 52735: keep this in sync with the handler
+const value91564 = compute(value, 93);
+const value98689 = compute(value, 40);
+const value76485 = compute(value, 49);
+const value43255 = compute(value, 90);
+const value1562 = compute(value, 10);
+const value86978 = compute(value, 66);
+const value10190 = compute(value, 5);
+const value67212 = compute(value, 88);
+const value75578 = compute(value, 15);
+const value2033 = compute(value, 93);
+const value24063 = compute(value, 7);
+const v = import.meta.env.BENCH_KEY_00868;
+const value43021 = compute(value, 50);
+const value70945 = compute(value, 38);
+const value2903 = compute(value, 90);
+const value22605 = compute(value, 4);
+const value1539 = compute(value, 84);
+const value74969 = compute(value, 85);
+// note 6309: keep this in sync with the handler
+const value46375 = compute(value, 9);
+const value58090 = compute(value, 84);
+const v = import.meta.env.BENCH_KEY_01969;
+const value30330 = compute(value, 66);
+// note 76659: keep this in sync with the handler
+const value62987 = compute(value, 34);
+const value42178 = compute(value, 80);
+const value45517 = compute(value, 24);
+const value64719 = compute(value, 20);
+const value29613 = compute(value, 28);
+const value90217 = compute(value, 7);
+const value80970 = compute(value, 72);
+const value49138 = compute(value, 56);
+const value51700 = compute(value, 96);
+const value33112 = compute(value, 35);
+const value60836 = compute(value, 17);
+const v = import.meta.env.BENCH_KEY_01579;
+const value50318 = compute(value, 72);
+const value18646 = compute(value, 22);
+const value72712 = compute(value, 59);
+const value86203 = compute(value, 67);
+// note 72355: keep this in sync with the handler
+const value73436 = compute(value, 7);
+const value42314 = compute(value, 22);
+const value72983 = compute(value, 39);
+const value82894 = compute(value, 56);
+const value61734 = compute(value, 42);
+const value14512 = compute(value, 59);
+const value90843 = compute(value, 51);
+// note 5020: keep this in sync with the handler
+const value29471 = compute(value, 80);
+const value22450 = compute(value, 43);
+const value35640 = compute(value, 41);
+const value41314 = compute(value, 89);
+const value14434 = compute(value, 78);
+const v = process.env.BENCH_KEY_00348;
+const value77299 = compute(value, 87);
+const value19094 = compute(value, 82);
+const value77796 = compute(value, 2);
+const value48789 = compute(value, 95);
+const value35955 = compute(value, 65);
+const value43903 = compute(value, 59);
+const value62323 = compute(value, 49);
+const value11384 = compute(value, 35);
+const value98148 = compute(value, 81);
+// note 46644: keep this in sync with the handler
+const value31259 = compute(value, 25);
+const value26251 = compute(value, 61);
+const value37223 = compute(value, 72);
+// note 54861: keep this in sync with the handler
+const v = process.env["BENCH_KEY_00816"];
+const value46085 = compute(value, 10);
+const value75061 = compute(value, 80);
+const value37332 = compute(value, 84);
+const value11390 = compute(value, 41);
+const value74288 = compute(value, 83);
+// note 27125: keep this in sync with the handler
+const value64606 = compute(value, 4);
+const value49092 = compute(value, 10);
+const value97956 = compute(value, 83);
+const value9664 = compute(value, 61);
+// note 19236: keep this in sync with the handler
+// note 84517: keep this in sync with the handler
+const value82454 = compute(value, 4);
+const value30233 = compute(value, 66);
+// note 95114: keep this in sync with the handler
+const value82206 = compute(value, 47);
+const value20281 = compute(value, 8);
+const value83461 = compute(value, 41);
+const value79048 = compute(value, 90);
+const v = process.env["BENCH_KEY_00352"];
+const value47321 = compute(value, 82);
+// note 29798: keep this in sync with the handler
+const value93215 = compute(value, 95);
+const value44748 = compute(value, 31);
+const value92974 = compute(value, 48);
+const value56962 = compute(value, 23);
+const value9785 = compute(value, 85);
+const value86598 = compute(value, 74);
+const value45033 = compute(value, 25);
+const value98119 = compute(value, 52);
+const value59172 = compute(value, 2);
+const value53481 = compute(value, 34);
+const value72369 = compute(value, 7);
+const value20164 = compute(value, 85);
+const v = process.env.BENCH_KEY_01700;
+const value34627 = compute(value, 95);
+const value35394 = compute(value, 86);
+const value13316 = compute(value, 27);
+// note 7295: keep this in sync with the handler
+const value80197 = compute(value, 75);
+const value9407 = compute(value, 95);
+const value9261 = compute(value, 46);
+const value93606 = compute(value, 1);
+const v = process.env["BENCH_KEY_00911"];
+const value56395 = compute(value, 38);
+const value46089 = compute(value, 14);
+// note 37108: keep this in sync with the handler
+const value49000 = compute(value, 15);
+const value60763 = compute(value, 41);
+const value39704 = compute(value, 31);
+const value82743 = compute(value, 2);
+const value45425 = compute(value, 29);
+const value90586 = compute(value, 85);
+const value80943 = compute(value, 45);
+const value70030 = compute(value, 93);
+const value57331 = compute(value, 4);
+const value35325 = compute(value, 17);
+const value80164 = compute(value, 42);
+const value5343 = compute(value, 8);
+const value17232 = compute(value, 63);
+const value21158 = compute(value, 12);
+const v = process.env["BENCH_KEY_01047"];
+const value99377 = compute(value, 49);
+const value2454 = compute(value, 29);
+// note 12757: keep this in sync with the handler
+const value67415 = compute(value, 0);
+const value96941 = compute(value, 38);
+const value57802 = compute(value, 87);
+// note 40068: keep this in sync with the handler
+const value69062 = compute(value, 95);
+const value12709 = compute(value, 2);
+// note 12251: keep this in sync with the handler
+const value23869 = compute(value, 7);
+// note 53775: keep this in sync with the handler
+const value15242 = compute(value, 13);
+const value59661 = compute(value, 6);
+const v = process.env["BENCH_KEY_01038"];
+const value76234 = compute(value, 89);
+const value91676 = compute(value, 11);
+const value47093 = compute(value, 48);
+const value7031 = compute(value, 47);
+// note 67651: keep this in sync with the handler
+const value58598 = compute(value, 10);
+const value20740 = compute(value, 79);
+const value24799 = compute(value, 64);
+const value63127 = compute(value, 77);
+const value55770 = compute(value, 92);
+const value27034 = compute(value, 68);
+const value17683 = compute(value, 29);
+const value86628 = compute(value, 7);
+const v = import.meta.env.BENCH_KEY_00326;
+const value56932 = compute(value, 90);
+const value12999 = compute(value, 1);
+const value20240 = compute(value, 64);
+const value68980 = compute(value, 13);
+const value71579 = compute(value, 90);
+const value14334 = compute(value, 75);
+const value21762 = compute(value, 34);
+const value77908 = compute(value, 17);
+const value5512 = compute(value, 80);
+const value38708 = compute(value, 5);
+const v = import.meta.env.BENCH_KEY_01846;
+const value52919 = compute(value, 54);
+const value23093 = compute(value, 7);
+// note 87907: keep this in sync with the handler
+const value79392 = compute(value, 46);
+// note 9696: keep this in sync with the handler
+const value93024 = compute(value, 1);
+// note 93254: keep this in sync with the handler
+const value65149 = compute(value, 62);
+const value88950 = compute(value, 1);
+const value47886 = compute(value, 65);
+const value82193 = compute(value, 34);
+// note 17390: keep this in sync with the handler
+const value10461 = compute(value, 82);
+const value23415 = compute(value, 38);
+const value24538 = compute(value, 94);
+const value79540 = compute(value, 0);
+const value42568 = compute(value, 82);
+const value40133 = compute(value, 72);
+const value68782 = compute(value, 9);
+const v = process.env.BENCH_KEY_00200;
+const value18355 = compute(value, 22);
+const value16282 = compute(value, 83);
+const value92513 = compute(value, 72);
+// note 84426: keep this in sync with the handler
+const value65681 = compute(value, 12);
+const value7193 = compute(value, 15);
+const value72981 = compute(value, 37);
+const value92630 = compute(value, 92);
+const value46740 = compute(value, 83);
+const value56824 = compute(value, 79);
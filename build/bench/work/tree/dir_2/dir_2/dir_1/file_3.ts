@@ -0,0 +1,205 @@
+const value81837 = compute(value, 66);
+// note 90900: keep this in sync with the handler
+const value74019 = compute(value, 8);
+const value38010 = compute(value, 83);
+const value24098 = compute(value, 42);
+const value75056 = compute(value, 75);
+const value83022 = compute(value, 87);
+const value16477 = compute(value, 84);
+const v = process.env["BENCH_KEY_00524"];
+const value62986 = compute(value, 33);
+const value22327 = compute(value, 17);
+const value20483 = compute(value, 16);
+const value62386 = compute(value, 15);
+// note 32644: keep this in sync with the handler
+const value82125 = compute(value, 63);
+const value64420 = compute(value, 12);
+const v = process.env.BENCH_KEY_01394;
+const value30298 = compute(value, 34);
+const value58209 = compute(value, 9);
+const value80474 = compute(value, 61);
+const value9677 = compute(value, 74);
+const value28516 = compute(value, 95);
+const value41598 = compute(value, 82);
+const value23741 = compute(value, 73);
+const value14300 = compute(value, 41);
+// note 46007: keep this in sync with the handler
+const v = process.env.BENCH_KEY_00864;
+const value55890 = compute(value, 18);
+const value41318 = compute(value, 93);
+const value55540 = compute(value, 56);
+const value86722 = compute(value, 4);
+// note 93234: keep this in sync with the handler
+const value87046 = compute(value, 37);
+const value3101 = compute(value, 94);
+const value24315 = compute(value, 65);
+const value12391 = compute(value, 72);
+const value30580 = compute(value, 25);
+const value54736 = compute(value, 28);
+const value36995 = compute(value, 38);
+// note 58494: keep this in sync with the handler
+const value93612 = compute(value, 7);
+const value79362 = compute(value, 16);
+const value68169 = compute(value, 75);
+const value98894 = compute(value, 51);
+const v = process.env["BENCH_KEY_01854"];
+// note 55081: keep this in sync with the handler
+const value85545 = compute(value, 88);
+// note 96233: keep this in sync with the handler
+const value31593 = compute(value, 68);
+const value92688 = compute(value, 53);
+const value27688 = compute(value, 43);
+// note 41440: keep this in sync with the handler
+const value94845 = compute(value, 76);
+const value11260 = compute(value, 8);
+const value45446 = compute(value, 50);
+const value24421 = compute(value, 74);
+const value34913 = compute(value, 90);
+const v = process.env.BENCH_KEY_00964;
+const value24988 = compute(value, 59);
+const value80487 = compute(value, 74);
+const value28491 = compute(value, 70);
+const value77800 = compute(value, 6);
+const value59070 = compute(value, 94);
+const value83609 = compute(value, 92);
+const value75873 = compute(value, 19);
+const value51763 = compute(value, 62);
+const value70608 = compute(value, 89);
+const value88743 = compute(value, 85);
+const value83332 = compute(value, 9);
+const value30622 = compute(value, 67);
+const value94771 = compute(value, 2);
+const value51345 = compute(value, 32);
+const v = process.env.BENCH_KEY_01847;
+const value55984 = compute(value, 15);
+const value3344 = compute(value, 46);
+const value51914 = compute(value, 19);
+const value21130 = compute(value, 81);
+const value98212 = compute(value, 48);
+// note 51817: keep this in sync with the handler
+const value25754 = compute(value, 49);
+const value72629 = compute(value, 73);
+const value90525 = compute(value, 24);
+const value77484 = compute(value, 78);
+const value77971 = compute(value, 80);
+const value11173 = compute(value, 18);
+const value33045 = compute(value, 65);
+// note 2054: keep this in sync with the handler
+const v = import.meta.env.BENCH_KEY_01696;
+const value68138 = compute(value, 44);
+const value7335 = compute(value, 60);
+const value69202 = compute(value, 41);
+const value63153 = compute(value, 6);
+const value7286 = compute(value, 11);
+const value19050 = compute(value, 38);
+const value65291 = compute(value, 10);
+const value41449 = compute(value, 30);
+const value60371 = compute(value, 37);
+const value62257 = compute(value, 80);
+const value7967 = compute(value, 13);
+const value45515 = compute(value, 22);
+const value29645 = compute(value, 60);
+const value51543 = compute(value, 36);
+const value33127 = compute(value, 50);
+const v = process.env["BENCH_KEY_00582"];
+const value87945 = compute(value, 63);
+const value53752 = compute(value, 14);
+const value70609 = compute(value, 90);
+const value4931 = compute(value, 81);
+const value85241 = compute(value, 75);
+const value25965 = compute(value, 66);
+const value61924 = compute(value, 38);
+const value68788 = compute(value, 15);
+const v = process.env["BENCH_KEY_01581"];
+const value33073 = compute(value, 93);
+const value21899 = compute(value, 74);
+const value57795 = compute(value, 80);
+const value3412 = compute(value, 17);
+const value31130 = compute(value, 90);
+const value41522 = compute(value, 6);
+const value66667 = compute(value, 28);
+const value45406 = compute(value, 10);
+const value52285 = compute(value, 2);
+const value29886 = compute(value, 10);
+const v = import.meta.env.BENCH_KEY_01263;
+const value33778 = compute(value, 22);
+const value82052 = compute(value, 87);
+const value53339 = compute(value, 86);
+const value17409 = compute(value, 46);
+const value68868 = compute(value, 95);
+const value47396 = compute(value, 60);
+// note 42776: keep this in sync with the handler
+const value82018 = compute(value, 53);
+const value36186 = compute(value, 5);
+const v = process.env["BENCH_KEY_01934"];
+const value46596 = compute(value, 36);
+const value96134 = compute(value, 7);
+const value565 = compute(value, 80);
+const value24116 = compute(value, 60);
+const value94890 = compute(value, 24);
+const value84594 = compute(value, 10);
+const value51256 = compute(value, 40);
+const value48722 = compute(value, 28);
+const value48814 = compute(value, 23);
+const value54289 = compute(value, 66);
+const value64344 = compute(value, 33);
+const value39423 = compute(value, 41);
+const value13203 = compute(value, 11);
+// note 55576: keep this in sync with the handler
+const value84167 = compute(value, 68);
+const value67580 = compute(value, 68);
+// note 59374: keep this in sync with the handler
+const v = process.env.BENCH_KEY_00282;
+const value72861 = compute(value, 14);
+const value69332 = compute(value, 74);
+const value68427 = compute(value, 42);
+// note 60323: keep this in sync with the handler
+const value83848 = compute(value, 40);
+const value44376 = compute(value, 47);
+const value59232 = compute(value, 62);
+const value317 = compute(value, 26);
+const v = process.env.BENCH_KEY_01221;
+const value51758 = compute(value, 57);
+// note 90285: keep this in sync with the handler
+const value53147 = compute(value, 88);
+const value92846 = compute(value, 17);
+const value4889 = compute(value, 39);
+const value33971 = compute(value, 21);
+const value66302 = compute(value, 51);
+const value40526 = compute(value, 77);
+const value52198 = compute(value, 12);
+const value70725 = compute(value, 12);
+const value18691 = compute(value, 67);
+const value94191 = compute(value, 4);
+const v = process.env.BENCH_KEY_01322;
+const value66735 = compute(value, 96);
+const value81246 = compute(value, 57);
+const value92492 = compute(value, 51);
+const value50679 = compute(value, 45);
+// note 98987: keep this in sync with the handler
+const value67759 = compute(value, 53);
+const value10027 = compute(value, 36);
+const value72216 = compute(value, 48);
+// note 58140: keep this in sync with the handler
+const value37241 = compute(value, 90);
+// note 32042: keep this in sync with the handler
+const value69486 = compute(value, 34);
+const value37638 = compute(value, 2);
+const value57323 = compute(value, 93);
+const value5687 = compute(value, 61);
+const value98909 = compute(value, 66);
+const v = process.env["BENCH_KEY_01832"];
+// note 56594: keep this in sync with the handler
+const value38235 = compute(value, 17);
+const value5658 = compute(value, 32);
+const value43393 = compute(value, 34);
+const value77339 = compute(value, 30);
+const value18804 = compute(value, 83);
+const value58409 = compute(value, 15);
+const value8790 = compute(value, 60);
+// note 72444: keep this in sync with the handler
+const value73045 = compute(value, 4);
+const value93602 = compute(value, 94);
+const value6390 = compute(value, 85);
+const value63394 = compute(value, 53);
+// note 27444: keep this in sync with the handler
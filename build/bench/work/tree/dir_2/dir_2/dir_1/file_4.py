@@ -0,0 +1,243 @@
+# note 46004: keep this in sync with the handler
+value46311 = compute(value, 42)
+value36305 = compute(value, 27)
+value73897 = compute(value, 80)
+const v = os.getenv("BENCH_KEY_00940");
+value44763 = compute(value, 46)
+# note 12180: keep this in sync with the handler
+value3176 = compute(value, 72)
+value33762 = compute(value, 6)
+value97804 = compute(value, 28)
+value82808 = compute(value, 67)
+value64160 = compute(value, 43)
+value28597 = compute(value, 79)
+value7628 = compute(value, 62)
+const v = os.getenv("BENCH_KEY_00981");
+# note 20816: keep this in sync with the handler
+value4249 = compute(value, 78)
+value60621 = compute(value, 93)
+value51233 = compute(value, 17)
+value20174 = compute(value, 95)
+value34829 = compute(value, 6)
+value51824 = compute(value, 26)
+value46099 = compute(value, 24)
+value84966 = compute(value, 91)
+const v = os.environ.get('BENCH_KEY_01659');
+value82087 = compute(value, 25)
+# note 95829: keep this in sync with the handler
+value12971 = compute(value, 70)
+value30125 = compute(value, 55)
+value26110 = compute(value, 17)
+value14930 = compute(value, 89)
+value93680 = compute(value, 75)
+value10682 = compute(value, 12)
+value84741 = compute(value, 60)
+value48146 = compute(value, 34)
+value1289 = compute(value, 28)
+value48009 = compute(value, 91)
+# note 94783: keep this in sync with the handler
+value2611 = compute(value, 89)
+value96565 = compute(value, 50)
+value99946 = compute(value, 36)
+value29291 = compute(value, 94)
+const v = os.environ["BENCH_KEY_00891"];
+value56567 = compute(value, 16)
+value28449 = compute(value, 28)
+value30026 = compute(value, 53)
+value79700 = compute(value, 63)
+value88298 = compute(value, 28)
+value43670 = compute(value, 20)
+value48241 = compute(value, 32)
+value20842 = compute(value, 84)
+# note 25361: keep this in sync with the handler
+value46544 = compute(value, 81)
+value83022 = compute(value, 87)
+value73149 = compute(value, 11)
+value42676 = compute(value, 93)
+value22893 = compute(value, 1)
+value46453 = compute(value, 87)
+value44228 = compute(value, 93)
+value29960 = compute(value, 84)
+value39008 = compute(value, 14)
+value84984 = compute(value, 12)
+value98524 = compute(value, 69)
+value77671 = compute(value, 71)
+value50717 = compute(value, 83)
+value62865 = compute(value, 9)
+const v = os.getenv("BENCH_KEY_00156");
+value4208 = compute(value, 37)
+value41247 = compute(value, 22)
+value51768 = compute(value, 67)
+value38917 = compute(value, 20)
+value86128 = compute(value, 89)
+value60671 = compute(value, 46)
+value88472 = compute(value, 8)
+value41529 = compute(value, 13)
+value19796 = compute(value, 8)
+value23046 = compute(value, 57)
+value28755 = compute(value, 43)
+const v = os.environ["BENCH_KEY_01000"];
+value3466 = compute(value, 71)
+value72510 = compute(value, 51)
+value51399 = compute(value, 86)
+# note 68168: keep this in sync with the handler
+value9019 = compute(value, 95)
+value43531 = compute(value, 75)
+value20239 = compute(value, 63)
+value30904 = compute(value, 58)
+value48285 = compute(value, 76)
+value5141 = compute(value, 0)
+value73303 = compute(value, 68)
+value77880 = compute(value, 86)
+value66537 = compute(value, 92)
+value44834 = compute(value, 20)
+# note 67932: keep this in sync with the handler
+const v = os.getenv("BENCH_KEY_00864");
+value81778 = compute(value, 7)
+value10381 = compute(value, 2)
+value45556 = compute(value, 63)
+value57841 = compute(value, 29)
+value69977 = compute(value, 40)
+value2383 = compute(value, 55)
+value13615 = compute(value, 35)
+value72020 = compute(value, 46)
+value13675 = compute(value, 95)
+value28826 = compute(value, 17)
+value35593 = compute(value, 91)
+value7533 = compute(value, 64)
+value24567 = compute(value, 26)
+value50484 = compute(value, 44)
+value68280 = compute(value, 89)
+value48772 = compute(value, 78)
+value41401 = compute(value, 79)
+value98071 = compute(value, 4)
+# note 91499: keep this in sync with the handler
+value96198 = compute(value, 71)
+value82880 = compute(value, 42)
+value26320 = compute(value, 33)
+value9297 = compute(value, 82)
+const v = os.getenv("BENCH_KEY_01626");
+# note 79513: keep this in sync with the handler
+value17412 = compute(value, 49)
+value79203 = compute(value, 51)
+value97442 = compute(value, 54)
+value51867 = compute(value, 69)
+value85398 = compute(value, 38)
+value92677 = compute(value, 42)
+value84141 = compute(value, 42)
+value21355 = compute(value, 15)
+value2645 = compute(value, 26)
+value84685 = compute(value, 4)
+value94901 = compute(value, 35)
+# note 6896: keep this in sync with the handler
+value16158 = compute(value, 56)
+value90565 = compute(value, 64)
+const v = os.getenv("BENCH_KEY_01447");
+value89416 = compute(value, 79)
+value71507 = compute(value, 18)
+value69875 = compute(value, 35)
+value58033 = compute(value, 27)
+value7440 = compute(value, 68)
+value29415 = compute(value, 24)
+value56346 = compute(value, 86)
+value88038 = compute(value, 59)
+value1041 = compute(value, 71)
+value19050 = compute(value, 38)
+value86236 = compute(value, 3)
+value13576 = compute(value, 93)
+value19487 = compute(value, 87)
+value30000 = compute(value, 27)
+value96395 = compute(value, 74)
+value8461 = compute(value, 22)
+value82406 = compute(value, 53)
+value11426 = compute(value, 77)
+value52300 = compute(value, 17)
+value329 = compute(value, 38)
+value66891 = compute(value, 58)
+value90847 = compute(value, 55)
+value12192 = compute(value, 67)
+value17473 = compute(value, 13)
+const v = os.environ.get('BENCH_KEY_00182');
+value71051 = compute(value, 47)
+value89123 = compute(value, 77)
+value38462 = compute(value, 50)
+# note 11017: keep this in sync with the handler
+value70951 = compute(value, 44)
+value18913 = compute(value, 95)
+value90160 = compute(value, 47)
+# note 52875: keep this in sync with the handler
+value66894 = compute(value, 61)
+# note 61407: keep this in sync with the handler
+value54153 = compute(value, 27)
+value43784 = compute(value, 37)
+value90787 = compute(value, 92)
+value38724 = compute(value, 21)
+value38086 = compute(value, 62)
+value66019 = compute(value, 59)
+value74802 = compute(value, 15)
+const v = os.environ["BENCH_KEY_00691"];
+value37963 = compute(value, 36)
+value57692 = compute(value, 74)
+value62180 = compute(value, 3)
+value51163 = compute(value, 44)
+value44907 = compute(value, 93)
+value25901 = compute(value, 2)
+value44650 = compute(value, 30)
+# note 77201: keep this in sync with the handler
+value89882 = compute(value, 60)
+value19265 = compute(value, 59)
+value44250 = compute(value, 18)
+value88728 = compute(value, 70)
+value96918 = compute(value, 15)
+value70214 = compute(value, 83)
+value55790 = compute(value, 15)
+const v = os.environ.get('BENCH_KEY_01474');
+value85301 = compute(value, 38)
+value28529 = compute(value, 11)
+value21556 = compute(value, 22)
+value42643 = compute(value, 60)
+value34824 = compute(value, 1)
+value40989 = compute(value, 55)
+value61187 = compute(value, 77)
+value74460 = compute(value, 61)
+value71370 = compute(value, 75)
+value65970 = compute(value, 10)
+value32904 = compute(value, 21)
+value14110 = compute(value, 45)
+value85165 = compute(value, 96)
+# note 32053: keep this in sync with the handler
+const v = os.environ.get('BENCH_KEY_01301');
+value66001 = compute(value, 41)
+value52015 = compute(value, 23)
+value32269 = compute(value, 65)
+# note 30084: keep this in sync with the handler
+value61057 = compute(value, 44)
+value26961 = compute(value, 92)
+value17956 = compute(value, 11)
+value89151 = compute(value, 8)
+value12690 = compute(value, 80)
+value2939 = compute(value, 29)
+# note 62033: keep this in sync with the handler
+value76313 = compute(value, 71)
+value756 = compute(value, 77)
+value96625 = compute(value, 13)
+value55619 = compute(value, 38)
+value78747 = compute(value, 80)
+value91515 = compute(value, 44)
+# note 486: keep this in sync with the handler
+value53006 = compute(value, 44)
+const v = os.environ.get('BENCH_KEY_01271');
+value95546 = compute(value, 1)
+# note 55642: keep this in sync with the handler
+value14917 = compute(value, 76)
+value55978 = compute(value, 9)
+value8716 = compute(value, 83)
+value18997 = compute(value, 82)
+value47726 = compute(value, 2)
+value36038 = compute(value, 51)
+value13382 = compute(value, 93)
+value59848 = compute(value, 96)
+value49083 = compute(value, 1)
+value74473 = compute(value, 74)
+value31993 = compute(value, 80)
+value42844 = compute(value, 67)
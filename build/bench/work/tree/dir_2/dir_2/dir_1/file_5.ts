@@ -0,0 +1,203 @@
+const value8969 = compute(value, 45);
+const value89518 = compute(value, 84);
+// note 26058: keep this in sync with the handler
+const v = import.meta.env.BENCH_KEY_01607;
+const value15009 = compute(value, 71);
+const value76473 = compute(value, 37);
+const value6635 = compute(value, 39);
+const value63461 = compute(value, 23);
+const value76452 = compute(value, 16);
+const value2559 = compute(value, 37);
+const value6250 = compute(value, 42);
+const value88608 = compute(value, 47);
+const value80314 = compute(value, 95);
+const value91283 = compute(value, 6);
+const value52619 = compute(value, 45);
+const value8975 = compute(value, 51);
+const value14444 = compute(value, 88);
+const value84541 = compute(value, 54);
+const value46079 = compute(value, 4);
+const value634 = compute(value, 52);
+const value83613 = compute(value, 96);
+const value7584 = compute(value, 18);
+const v = process.env["BENCH_KEY_01529"];
+// note 95602: keep this in sync with the handler
+const value1200 = compute(value, 36);
+// note 12761: keep this in sync with the handler
+const value6249 = compute(value, 41);
+// note 28909: keep this in sync with the handler
+const value41453 = compute(value, 34);
+const value15391 = compute(value, 65);
+const value45475 = compute(value, 79);
+// note 50517: keep this in sync with the handler
+const v = import.meta.env.BENCH_KEY_00273;
+const value72557 = compute(value, 1);
+const value57421 = compute(value, 94);
+const value81829 = compute(value, 58);
+const value98832 = compute(value, 86);
+// note 45380: keep this in sync with the handler
+const value46632 = compute(value, 72);
+const value2082 = compute(value, 45);
+const value88437 = compute(value, 70);
+const value99702 = compute(value, 83);
+const value8869 = compute(value, 42);
+const value58312 = compute(value, 15);
+const value86737 = compute(value, 19);
+// note 46472: keep this in sync with the handler
+const value61770 = compute(value, 78);
+const value12416 = compute(value, 0);
+const v = import.meta.env.BENCH_KEY_00796;
+const value42105 = compute(value, 7);
+const value64358 = compute(value, 47);
+const value11182 = compute(value, 27);
+const value48106 = compute(value, 91);
+const value71204 = compute(value, 6);
+const value20 = compute(value, 20);
+const value21917 = compute(value, 92);
+const value2705 = compute(value, 86);
+const value67419 = compute(value, 4);
+const value51798 = compute(value, 0);
+const value7558 = compute(value, 89);
+// note 24604: keep this in sync with the handler
+const value37176 = compute(value, 25);
+const value21296 = compute(value, 53);
+const value30560 = compute(value, 5);
+const value91654 = compute(value, 86);
+const v = process.env["BENCH_KEY_01272"];
+// note 27264: keep this in sync with the handler
+const value90450 = compute(value, 46);
+const value50397 = compute(value, 54);
+const value81916 = compute(value, 48);
+const value66472 = compute(value, 27);
+const value29866 = compute(value, 87);
+const value4255 = compute(value, 84);
+const value40211 = compute(value, 53);
+const value48392 = compute(value, 86);
+const value27897 = compute(value, 58);
+const value49319 = compute(value, 43);
+const value55269 = compute(value, 76);
+const value85000 = compute(value, 28);
+// note 32400: keep this in sync with the handler
+// note 22781: keep this in sync with the handler
+const v = process.env.BENCH_KEY_00412;
+const value48358 = compute(value, 52);
+const value22454 = compute(value, 47);
+// note 20577: keep this in sync with the handler
+const value25062 = compute(value, 36);
+const value93938 = compute(value, 42);
+// note 96558: keep this in sync with the handler
+const value95259 = compute(value, 5);
+const value31903 = compute(value, 87);
+const value86663 = compute(value, 42);
+const value22426 = compute(value, 19);
+const value88405 = compute(value, 38);
+const value4415 = compute(value, 50);
+const v = process.env["BENCH_KEY_00166"];
+const value94699 = compute(value, 27);
+// note 48040: keep this in sync with the handler
+const value29590 = compute(value, 5);
+const value18966 = compute(value, 51);
+const value76375 = compute(value, 36);
+const value69282 = compute(value, 24);
+const value10101 = compute(value, 13);
+const value25774 = compute(value, 69);
+const value24038 = compute(value, 79);
+const value15117 = compute(value, 82);
+const value97760 = compute(value, 81);
+const value22300 = compute(value, 87);
+const value94576 = compute(value, 1);
+const value38581 = compute(value, 72);
+const value40270 = compute(value, 15);
+const value34837 = compute(value, 14);
+const value67266 = compute(value, 45);
+const value38168 = compute(value, 47);
+const v = process.env.BENCH_KEY_00594;
+const value26189 = compute(value, 96);
+// note 37688: keep this in sync with the handler
+const value4142 = compute(value, 68);
+const value45853 = compute(value, 69);
+const value90082 = compute(value, 66);
+const value67676 = compute(value, 67);
+const value36634 = compute(value, 65);
+const value50431 = compute(value, 88);
+// note 29474: keep this in sync with the handler
+const value46271 = compute(value, 2);
+const value34475 = compute(value, 40);
+const value25859 = compute(value, 57);
+const v = process.env["BENCH_KEY_00402"];
+const value40950 = compute(value, 16);
+const value79521 = compute(value, 78);
+const value34424 = compute(value, 86);
+// note 18612: keep this in sync with the handler
+const value44698 = compute(value, 78);
+const value88118 = compute(value, 42);
+// note 19608: keep this in sync with the handler
+const value4596 = compute(value, 37);
+const value97003 = compute(value, 3);
+const value2156 = compute(value, 22);
+const value68338 = compute(value, 50);
+const value12599 = compute(value, 86);
+// note 70842: keep this in sync with the handler
+const value36165 = compute(value, 81);
+const v = process.env["BENCH_KEY_01953"];
+const value5895 = compute(value, 75);
+// note 11768: keep this in sync with the handler
+const value52667 = compute(value, 93);
+const value92021 = compute(value, 65);
+const value67192 = compute(value, 68);
+const value44293 = compute(value, 61);
+const value21301 = compute(value, 58);
+const value75865 = compute(value, 11);
+const value15337 = compute(value, 11);
+const value27277 = compute(value, 20);
+const value69446 = compute(value, 91);
+const v = process.env["BENCH_KEY_00028"];
+const value78413 = compute(value, 37);
+const value91400 = compute(value, 26);
+const value85938 = compute(value, 93);
+const value71472 = compute(value, 80);
+const value4602 = compute(value, 43);
+const value95405 = compute(value, 54);
+const value20095 = compute(value, 16);
+// note 43202: keep this in sync with the handler
+const value49306 = compute(value, 30);
+// note 32026: keep this in sync with the handler
+// note 57092: keep this in sync with the handler
+const value91654 = compute(value, 86);
+const v = process.env.BENCH_KEY_00160;
+const value99066 = compute(value, 29);
+const value22021 = compute(value, 2);
+const value863 = compute(value, 87);
+const value20535 = compute(value, 68);
+const value27578 = compute(value, 30);
+const value9001 = compute(value, 77);
+const value18774 = compute(value, 53);
+const value3618 = compute(value, 29);
+const value66979 = compute(value, 49);
+const value92128 = compute(value, 75);
+const value37228 = compute(value, 77);
+const value81906 = compute(value, 38);
+const value38185 = compute(value, 64);
+const value64688 = compute(value, 86);
+// note 46615: keep this in sync with the handler
+const v = process.env.BENCH_KEY_01314;
+const value84636 = compute(value, 52);
+// note 96475: keep this in sync with the handler
+const value97663 = compute(value, 81);
+const value30249 = compute(value, 82);
+// note 39484: keep this in sync with the handler
+const value89187 = compute(value, 44);
+const value7950 = compute(value, 93);
+// note 74706: keep this in sync with the handler
+const value71093 = compute(value, 89);
+// note 1823: keep this in sync with the handler
+const value43548 = compute(value, 92);
+const v = process.env["BENCH_KEY_01271"];
+const value94874 = compute(value, 8);
+const value38230 = compute(value, 12);
+const value36776 = compute(value, 13);
+const value44331 = compute(value, 2);
+const value4040 = compute(value, 63);
+// note 63975: keep this in sync with the handler
+const value6024 = compute(value, 10);
+// note 85318: keep this in sync with the handler
@@ -0,0 +1,236 @@
+value63333 = compute(value, 89)
+value73608 = compute(value, 82)
+value62917 = compute(value, 61)
+value13317 = compute(value, 28)
+value82764 = compute(value, 23)
+value89385 = compute(value, 48)
+value37011 = compute(value, 54)
+value75741 = compute(value, 81)
+value3311 = compute(value, 13)
+value39500 = compute(value, 21)
+value80863 = compute(value, 62)
+# note 8744: keep this in sync with the handler
+value5159 = compute(value, 18)
+value43768 = compute(value, 21)
+const v = os.getenv("BENCH_KEY_01250");
+value64522 = compute(value, 17)
+value89327 = compute(value, 87)
+value56865 = compute(value, 23)
+value41187 = compute(value, 59)
+# note 74026: keep this in sync with the handler
+value88379 = compute(value, 12)
+value32568 = compute(value, 73)
+# note 89725: keep this in sync with the handler
+value87169 = compute(value, 63)
+value67321 = compute(value, 3)
+# note 55629: keep this in sync with the handler
+value23420 = compute(value, 43)
+const v = os.environ.get('BENCH_KEY_01768');
+value15220 = compute(value, 88)
+value88555 = compute(value, 91)
+value29617 = compute(value, 32)
+# note 21581: keep this in sync with the handler
+value51350 = compute(value, 37)
+value92819 = compute(value, 87)
+value5252 = compute(value, 14)
+value64970 = compute(value, 77)
+# note 16934: keep this in sync with the handler
+value94288 = compute(value, 4)
+value46685 = compute(value, 28)
+value8907 = compute(value, 80)
+# note 62747: keep this in sync with the handler
+const v = os.environ.get('BENCH_KEY_00290');
+value3965 = compute(value, 85)
+value54061 = compute(value, 32)
+value84711 = compute(value, 30)
+# note 54190: keep this in sync with the handler
+value84745 = compute(value, 64)
+value82550 = compute(value, 3)
+value16556 = compute(value, 66)
+value78838 = compute(value, 74)
+value25287 = compute(value, 67)
+value8832 = compute(value, 5)
+const v = os.environ["BENCH_KEY_00398"];
+value31171 = compute(value, 34)
+# note 74426: keep this in sync with the handler
+value3410 = compute(value, 15)
+value94010 = compute(value, 17)
+value46664 = compute(value, 7)
+value36616 = compute(value, 47)
+# note 81749: keep this in sync with the handler
+value43853 = compute(value, 9)
+value12458 = compute(value, 42)
+value85294 = compute(value, 31)
+value85846 = compute(value, 1)
+value71782 = compute(value, 2)
+value98793 = compute(value, 47)
+value37030 = compute(value, 73)
+value58774 = compute(value, 89)
+value78591 = compute(value, 21)
+value68609 = compute(value, 30)
+# note 70147: keep this in sync with the handler
+value20585 = compute(value, 21)
+value83896 = compute(value, 88)
+value67341 = compute(value, 23)
+const v = os.environ.get('BENCH_KEY_01018');
+# note 97474: keep this in sync with the handler
+value86705 = compute(value, 84)
+value9112 = compute(value, 91)
+# note 12396: keep this in sync with the handler
+value54765 = compute(value, 57)
+value54315 = compute(value, 92)
+value96035 = compute(value, 5)
+# note 30561: keep this in sync with the handler
+value63732 = compute(value, 3)
+const v = os.environ["BENCH_KEY_00704"];
+value5650 = compute(value, 24)
+value61635 = compute(value, 40)
+value20400 = compute(value, 30)
+value7183 = compute(value, 5)
+# note 18373: keep this in sync with the handler
+value30384 = compute(value, 23)
+value35103 = compute(value, 86)
+# note 93042: keep this in sync with the handler
+value3363 = compute(value, 65)
+value64108 = compute(value, 88)
+value83014 = compute(value, 79)
+value96064 = compute(value, 34)
+value11735 = compute(value, 95)
+value16498 = compute(value, 8)
+value30956 = compute(value, 13)
+# note 58590: keep this in sync with the handler
+const v = os.getenv("BENCH_KEY_01235");
+value7002 = compute(value, 18)
+value53826 = compute(value, 88)
+value68910 = compute(value, 40)
+value87745 = compute(value, 57)
+value31756 = compute(value, 37)
+value60725 = compute(value, 3)
+value28319 = compute(value, 92)
+value93269 = compute(value, 52)
+# note 29447: keep this in sync with the handler
+value70174 = compute(value, 43)
+# note 60182: keep this in sync with the handler
+value94421 = compute(value, 40)
+value38269 = compute(value, 51)
+const v = os.getenv("BENCH_KEY_00338");
+value29444 = compute(value, 53)
+value93485 = compute(value, 74)
+value26916 = compute(value, 47)
+# note 29509: keep this in sync with the handler
+value15357 = compute(value, 31)
+value19563 = compute(value, 66)
+value58957 = compute(value, 78)
+# note 31882: keep this in sync with the handler
+value58190 = compute(value, 87)
+value98217 = compute(value, 53)
+value35338 = compute(value, 30)
+value50024 = compute(value, 69)
+value54511 = compute(value, 94)
+# note 21474: keep this in sync with the handler
+const v = os.environ.get('BENCH_KEY_01957');
+# note 23078: keep this in sync with the handler
+value56660 = compute(value, 12)
+value97621 = compute(value, 39)
+value38281 = compute(value, 63)
+value38527 = compute(value, 18)
+value72653 = compute(value, 0)
+value40559 = compute(value, 13)
+value29042 = compute(value, 39)
+const v = os.environ["BENCH_KEY_01519"];
+value30674 = compute(value, 22)
+value15333 = compute(value, 7)
+# note 38471: keep this in sync with the handler
+# note 57912: keep this in sync with the handler
+value6745 = compute(value, 52)
+value67781 = compute(value, 75)
+value95200 = compute(value, 43)
+value40648 = compute(value, 5)
+value9414 = compute(value, 5)
+value61702 = compute(value, 10)
+# note 16900: keep this in sync with the handler
+value82987 = compute(value, 52)
+value55173 = compute(value, 77)
+value46090 = compute(value, 15)
+value10757 = compute(value, 87)
+const v = os.environ.get('BENCH_KEY_00498');
+value71222 = compute(value, 24)
+value72805 = compute(value, 55)
+value301 = compute(value, 10)
+value29348 = compute(value, 54)
+value77595 = compute(value, 92)
+value88467 = compute(value, 3)
+value9428 = compute(value, 19)
+value18891 = compute(value, 73)
+value92399 = compute(value, 55)
+value95359 = compute(value, 8)
+value23863 = compute(value, 1)
+value35458 = compute(value, 53)
+# note 18069: keep this in sync with the handler
+value90763 = compute(value, 68)
+value31022 = compute(value, 79)
+const v = os.getenv("BENCH_KEY_01132");
+value19615 = compute(value, 21)
+value74111 = compute(value, 3)
+value39065 = compute(value, 71)
+# note 31417: keep this in sync with the handler
+value36091 = compute(value, 7)
+value6055 = compute(value, 41)
+value86465 = compute(value, 38)
+value52240 = compute(value, 54)
+value61786 = compute(value, 94)
+value66179 = compute(value, 25)
+# note 50793: keep this in sync with the handler
+value54455 = compute(value, 38)
+value39028 = compute(value, 34)
+value12380 = compute(value, 61)
+value46708 = compute(value, 51)
+value29500 = compute(value, 12)
+value65195 = compute(value, 11)
+value26700 = compute(value, 25)
+value1531 = compute(value, 76)
+const v = os.environ.get('BENCH_KEY_00091');
+value64238 = compute(value, 24)
+value21741 = compute(value, 13)
+value27521 = compute(value, 70)
+value29362 = compute(value, 68)
+value49668 = compute(value, 4)
+# note 78896: keep this in sync with the handler
+value2652 = compute(value, 33)
+value37351 = compute(value, 6)
+value4683 = compute(value, 27)
+value75948 = compute(value, 94)
+value33453 = compute(value, 85)
+value49297 = compute(value, 21)
+# note 95413: keep this in sync with the handler
+value92728 = compute(value, 93)
+value17828 = compute(value, 77)
+value73217 = compute(value, 79)
+value65287 = compute(value, 6)
+value43919 = compute(value, 75)
+value31435 = compute(value, 7)
+value90374 = compute(value, 67)
+value13548 = compute(value, 65)
+value21543 = compute(value, 9)
+value95489 = compute(value, 41)
+const v = os.environ["BENCH_KEY_00844"];
+value26455 = compute(value, 71)
+value39582 = compute(value, 6)
+value87504 = compute(value, 10)
+value4480 = compute(value, 18)
+value39030 = compute(value, 36)
+# note 3962: keep this in sync with the handler
+value73341 = compute(value, 9)
+value57547 = compute(value, 26)
+value54299 = compute(value, 76)
+# note 93411: keep this in sync with the handler
+value35184 = compute(value, 70)
+value57243 = compute(value, 13)
+value24849 = compute(value, 17)
+value60402 = compute(value, 68)
+value34677 = compute(value, 48)
+value74797 = compute(value, 10)
+value68869 = compute(value, 96)
+value16585 = compute(value, 95)
+value74726 = compute(value, 36)
+value53131 = compute(value, 72)
@@ -0,0 +1,230 @@
+// note 69577: keep this in sync with the handler
+value71441 := compute(value, 49)
+value66712 := compute(value, 73)
+const v = os.Getenv("BENCH_KEY_01850");
+// note 50734: keep this in sync with the handler
+value73172 := compute(value, 34)
+value53684 := compute(value, 43)
+value2233 := compute(value, 2)
+value67469 := compute(value, 54)
+value29820 := compute(value, 41)
+// note 85651: keep this in sync with the handler
+// note 9565: keep this in sync with the handler
+// note 85404: keep this in sync with the handler
+value93899 := compute(value, 3)
+value22975 := compute(value, 83)
+value56426 := compute(value, 69)
+value41601 := compute(value, 85)
+// note 91430: keep this in sync with the handler
+const v = os.Getenv("BENCH_KEY_00781");
+// note 46386: keep this in sync with the handler
+value95749 := compute(value, 10)
+value98134 := compute(value, 67)
+value9675 := compute(value, 72)
+value24108 := compute(value, 52)
+// note 43165: keep this in sync with the handler
+value45345 := compute(value, 46)
+value40330 := compute(value, 75)
+value69491 := compute(value, 39)
+value84847 := compute(value, 69)
+// note 53403: keep this in sync with the handler
+const v = os.Getenv("BENCH_KEY_01932");
+value61112 := compute(value, 2)
+value72889 := compute(value, 42)
+value10257 := compute(value, 72)
+value60911 := compute(value, 92)
+value93280 := compute(value, 63)
+value60773 := compute(value, 51)
+value78018 := compute(value, 30)
+// note 8098: keep this in sync with the handler
+value26220 := compute(value, 30)
+value50785 := compute(value, 54)
+value49225 := compute(value, 46)
+const v = os.Getenv("BENCH_KEY_00357");
+value74467 := compute(value, 68)
+value35490 := compute(value, 85)
+// note 65309: keep this in sync with the handler
+value65475 := compute(value, 0)
+value46417 := compute(value, 51)
+value53647 := compute(value, 6)
+// note 29463: keep this in sync with the handler
+value94160 := compute(value, 70)
+value97789 := compute(value, 13)
+value39021 := compute(value, 27)
+value86677 := compute(value, 56)
+value38053 := compute(value, 29)
+value68296 := compute(value, 8)
+value47294 := compute(value, 55)
+value25572 := compute(value, 61)
+value20159 := compute(value, 80)
+value47625 := compute(value, 95)
+value5612 := compute(value, 83)
+value43023 := compute(value, 52)
+value33625 := compute(value, 63)
+const v = os.Getenv("BENCH_KEY_01938");
+value47865 := compute(value, 44)
+value68872 := compute(value, 2)
+value2669 := compute(value, 50)
+value95790 := compute(value, 51)
+value50743 := compute(value, 12)
+value55970 := compute(value, 1)
+value71817 := compute(value, 37)
+value16064 := compute(value, 59)
+value95221 := compute(value, 64)
+// note 89478: keep this in sync with the handler
+const v = os.LookupEnv("BENCH_KEY_00328");
+value60033 := compute(value, 87)
+// note 26364: keep this in sync with the handler
+value98500 := compute(value, 45)
+value26949 := compute(value, 80)
+value34464 := compute(value, 29)
+value2724 := compute(value, 8)
+value39588 := compute(value, 12)
+// note 88233: keep this in sync with the handler
+const v = os.LookupEnv("BENCH_KEY_01660");
+value26398 := compute(value, 14)
+value34287 := compute(value, 46)
+value47898 := compute(value, 77)
+value89500 := compute(value, 66)
+value10898 := compute(value, 34)
+value2423 := compute(value, 95)
+value67052 := compute(value, 25)
+value57828 := compute(value, 16)
+value67777 := compute(value, 71)
+const v = os.Getenv("BENCH_KEY_00627");
+value93138 := compute(value, 18)
+value5057 := compute(value, 13)
+value63383 := compute(value, 42)
+value19644 := compute(value, 50)
+value746 := compute(value, 67)
+value7516 := compute(value, 47)
+value99616 := compute(value, 94)
+// note 7774: keep this in sync with the handler
+const v = os.Getenv("BENCH_KEY_00598");
+value33485 := compute(value, 20)
+value25278 := compute(value, 58)
+// note 23631: keep this in sync with the handler
+value32038 := compute(value, 28)
+value18085 := compute(value, 43)
+value38374 := compute(value, 59)
+value27415 := compute(value, 61)
+value5161 := compute(value, 20)
+value30789 := compute(value, 40)
+value48868 := compute(value, 77)
+value94912 := compute(value, 46)
+value76085 := compute(value, 37)
+value89929 := compute(value, 10)
+value5452 := compute(value, 20)
+value13348 := compute(value, 59)
+// note 29487: keep this in sync with the handler
+value42949 := compute(value, 75)
+const v = os.LookupEnv("BENCH_KEY_01622");
+value15944 := compute(value, 36)
+value31440 := compute(value, 12)
+value59418 := compute(value, 54)
+value76358 := compute(value, 19)
+value65160 := compute(value, 73)
+value57334 := compute(value, 7)
+value45634 := compute(value, 44)
+value34003 := compute(value, 53)
+value25786 := compute(value, 81)
+value75222 := compute(value, 47)
+const v = os.LookupEnv("BENCH_KEY_00516");
+value70631 := compute(value, 15)
+value95012 := compute(value, 49)
+value85940 := compute(value, 95)
+value34625 := compute(value, 93)
+value78449 := compute(value, 73)
+value20361 := compute(value, 88)
+// note 93355: keep this in sync with the handler
+// note 18220: keep this in sync with the handler
+value94133 := compute(value, 43)
+value31400 := compute(value, 69)
+// note 77670: keep this in sync with the handler
+value95180 := compute(value, 23)
+value59983 := compute(value, 37)
+value78377 := compute(value, 1)
+value19070 := compute(value, 58)
+// note 22564: keep this in sync with the handler
+value63838 := compute(value, 12)
+// note 77090: keep this in sync with the handler
+value97746 := compute(value, 67)
+const v = os.Getenv("BENCH_KEY_00004");
+value5755 := compute(value, 32)
+value65507 := compute(value, 32)
+value92942 := compute(value, 16)
+value74834 := compute(value, 47)
+value51122 := compute(value, 3)
+// note 26124: keep this in sync with the handler
+// note 37563: keep this in sync with the handler
+value64555 := compute(value, 50)
+// note 30455: keep this in sync with the handler
+value50897 := compute(value, 69)
+value713 := compute(value, 34)
+// note 8402: keep this in sync with the handler
+value37644 := compute(value, 8)
+value93495 := compute(value, 84)
+value36487 := compute(value, 15)
+value52499 := compute(value, 22)
+const v = os.Getenv("BENCH_KEY_01172");
+value60244 := compute(value, 7)
+value52411 := compute(value, 31)
+value65719 := compute(value, 50)
+value88409 := compute(value, 42)
+value48085 := compute(value, 70)
+value24399 := compute(value, 52)
+value19661 := compute(value, 67)
+value46975 := compute(value, 27)
+// note 18080: keep this in sync with the handler
+value70149 := compute(value, 18)
+const v = os.Getenv("BENCH_KEY_01327");
+value75261 := compute(value, 86)
+value78084 := compute(value, 96)
+value72245 := compute(value, 77)
+value63299 := compute(value, 55)
+value52438 := compute(value, 58)
+value67946 := compute(value, 46)
+value4538 := compute(value, 76)
+value56799 := compute(value, 54)
+value13137 := compute(value, 42)
+value3472 := compute(value, 77)
+value61235 := compute(value, 28)
+value74901 := compute(value, 17)
+// note 46408: keep this in sync with the handler
+value94224 := compute(value, 37)
+value4956 := compute(value, 9)
+value86063 := compute(value, 24)
+value3238 := compute(value, 37)
+value47011 := compute(value, 63)
+value53587 := compute(value, 43)
+const v = os.Getenv("BENCH_KEY_00964");
+value33644 := compute(value, 82)
+value30268 := compute(value, 4)
+value14543 := compute(value, 90)
+value86740 := compute(value, 22)
+value67132 := compute(value, 8)
+value49743 := compute(value, 79)
+value4069 := compute(value, 92)
+value63982 := compute(value, 59)
+value34737 := compute(value, 11)
+value6425 := compute(value, 23)
+value23398 := compute(value, 21)
+value71793 := compute(value, 13)
+value20607 := compute(value, 43)
+value26680 := compute(value, 5)
+const v = os.Getenv("BENCH_KEY_00422");
+value93297 := compute(value, 80)
+value22280 := compute(value, 67)
+// note 81770: keep this in sync with the handler
+value8334 := compute(value, 89)
+value55782 := compute(value, 7)
+value42900 := compute(value, 26)
+// note 27080: keep this in sync with the handler
+value47575 := compute(value, 45)
+value18192 := compute(value, 53)
+value85556 := compute(value, 2)
+const v = os.LookupEnv("BENCH_KEY_01704");
+value20792 := compute(value, 34)
+value9745 := compute(value, 45)
+value85468 := compute(value, 11)
+value12907 := compute(value, 6)
@@ -0,0 +1,213 @@
+let value2814 = compute(value, 1);
+let value90895 = compute(value, 6);
+let value46464 = compute(value, 1);
+let value21485 = compute(value, 48);
+let value85715 = compute(value, 64);
+let value39979 = compute(value, 15);
+let value48089 = compute(value, 74);
+let value71572 = compute(value, 83);
+let value68972 = compute(value, 5);
+let value67410 = compute(value, 92);
+let value12778 = compute(value, 71);
+const v = env::var("BENCH_KEY_01859");
+let value80834 = compute(value, 33);
+// note 80261: keep this in sync with the handler
+let value45982 = compute(value, 4);
+let value80225 = compute(value, 6);
+let value84727 = compute(value, 46);
+let value51719 = compute(value, 18);
+let value16396 = compute(value, 3);
+let value30742 = compute(value, 90);
+let value31834 = compute(value, 18);
+// note 38864: keep this in sync with the handler
+let value80116 = compute(value, 91);
+let value62179 = compute(value, 2);
+let value54038 = compute(value, 9);
+let value62039 = compute(value, 56);
+let value61693 = compute(value, 1);
+let value99268 = compute(value, 37);
+const v = env::var_os("BENCH_KEY_00641");
+let value31455 = compute(value, 27);
+let value96987 = compute(value, 84);
+let value22318 = compute(value, 8);
+let value35838 = compute(value, 45);
+let value40256 = compute(value, 1);
+let value95072 = compute(value, 12);
+// note 56503: keep this in sync with the handler
+let value67359 = compute(value, 41);
+let value5274 = compute(value, 36);
+let value9562 = compute(value, 56);
+const v = env::var_os("BENCH_KEY_00131");
+let value25429 = compute(value, 15);
+let value71314 = compute(value, 19);
+let value85862 = compute(value, 17);
+let value90537 = compute(value, 36);
+let value58727 = compute(value, 42);
+let value24581 = compute(value, 40);
+let value54098 = compute(value, 69);
+let value78672 = compute(value, 5);
+// note 93848: keep this in sync with the handler
+let value17356 = compute(value, 90);
+let value98506 = compute(value, 51);
+let value12656 = compute(value, 46);
+let value15027 = compute(value, 89);
+const v = env::var("BENCH_KEY_01943");
+let value18072 = compute(value, 30);
+let value16207 = compute(value, 8);
+let value51280 = compute(value, 64);
+let value73668 = compute(value, 45);
+let value31940 = compute(value, 27);
+let value97267 = compute(value, 73);
+let value46836 = compute(value, 82);
+let value46046 = compute(value, 68);
+let value72625 = compute(value, 69);
+let value69691 = compute(value, 45);
+let value89202 = compute(value, 59);
+let value24699 = compute(value, 61);
+let value69837 = compute(value, 94);
+const v = env::var_os("BENCH_KEY_01960");
+// note 50368: keep this in sync with the handler
+let value922 = compute(value, 49);
+// note 33873: keep this in sync with the handler
+// note 59016: keep this in sync with the handler
+let value24641 = compute(value, 3);
+// note 70458: keep this in sync with the handler
+let value950 = compute(value, 77);
+let value22684 = compute(value, 83);
+// note 31757: keep this in sync with the handler
+let value74124 = compute(value, 16);
+let value35887 = compute(value, 94);
+// note 59225: keep this in sync with the handler
+let value96130 = compute(value, 3);
+let value96184 = compute(value, 57);
+let value12489 = compute(value, 73);
+let value38427 = compute(value, 15);
+let value97008 = compute(value, 8);
+const v = env::var("BENCH_KEY_01907");
+let value11832 = compute(value, 95);
+let value7504 = compute(value, 35);
+let value69708 = compute(value, 62);
+let value19053 = compute(value, 41);
+let value78472 = compute(value, 96);
+let value67407 = compute(value, 89);
+// note 26909: keep this in sync with the handler
+let value37904 = compute(value, 74);
+let value45951 = compute(value, 70);
+let value69544 = compute(value, 92);
+// note 61125: keep this in sync with the handler
+const v = env::var_os("BENCH_KEY_00627");
+let value96006 = compute(value, 73);
+let value7985 = compute(value, 31);
+// note 74585: keep this in sync with the handler
+let value63655 = compute(value, 23);
+let value93836 = compute(value, 37);
+let value2964 = compute(value, 54);
+let value69212 = compute(value, 51);
+let value35367 = compute(value, 59);
+// note 42854: keep this in sync with the handler
+let value64626 = compute(value, 24);
+// note 16607: keep this in sync with the handler
+let value89997 = compute(value, 78);
+let value4454 = compute(value, 89);
+let value76282 = compute(value, 40);
+let value1175 = compute(value, 11);
+let value83857 = compute(value, 49);
+const v = env::var_os("BENCH_KEY_01148");
+let value9796 = compute(value, 96);
+let value4996 = compute(value, 49);
+let value58603 = compute(value, 15);
+let value509 = compute(value, 24);
+let value34704 = compute(value, 75);
+let value99312 = compute(value, 81);
+let value93432 = compute(value, 21);
+let value26711 = compute(value, 36);
+let value3648 = compute(value, 59);
+let value43644 = compute(value, 91);
+let value56043 = compute(value, 74);
+let value43523 = compute(value, 67);
+let value8724 = compute(value, 91);
+let value59444 = compute(value, 80);
+let value48325 = compute(value, 19);
+// note 810: keep this in sync with the handler
+let value15516 = compute(value, 93);
+let value49877 = compute(value, 19);
+let value75915 = compute(value, 61);
+let value32924 = compute(value, 41);
+const v = env::var("BENCH_KEY_00824");
+let value39789 = compute(value, 19);
+let value9989 = compute(value, 95);
+let value71993 = compute(value, 19);
+let value34013 = compute(value, 63);
+let value23609 = compute(value, 38);
+let value16292 = compute(value, 93);
+let value27619 = compute(value, 71);
+// note 62254: keep this in sync with the handler
+const v = env::var("BENCH_KEY_00565");
+let value58629 = compute(value, 41);
+let value8791 = compute(value, 61);
+let value8136 = compute(value, 85);
+let value61225 = compute(value, 18);
+let value77563 = compute(value, 60);
+// note 17873: keep this in sync with the handler
+let value15187 = compute(value, 55);
+// note 30368: keep this in sync with the handler
+let value15892 = compute(value, 81);
+// note 55810: keep this in sync with the handler
+let value35466 = compute(value, 61);
+let value68858 = compute(value, 85);
+let value203 = compute(value, 9);
+// note 73403: keep this in sync with the handler
+const v = env::var_os("BENCH_KEY_01817");
+let value20318 = compute(value, 45);
+let value57598 = compute(value, 77);
+let value53938 = compute(value, 6);
+let value35564 = compute(value, 62);
+let value20543 = compute(value, 76);
+let value49473 = compute(value, 3);
+let value93385 = compute(value, 71);
+// note 83996: keep this in sync with the handler
+let value28242 = compute(value, 15);
+// note 26723: keep this in sync with the handler
+let value13071 = compute(value, 73);
+const v = env::var_os("BENCH_KEY_00675");
+let value91150 = compute(value, 67);
+let value7360 = compute(value, 85);
+let value60762 = compute(value, 40);
+let value84913 = compute(value, 38);
+let value35592 = compute(value, 90);
+let value87580 = compute(value, 86);
+let value37482 = compute(value, 40);
+// note 35318: keep this in sync with the handler
+let value34152 = compute(value, 8);
+let value90942 = compute(value, 53);
+const v = env::var_os("BENCH_KEY_01374");
+// note 1788: keep this in sync with the handler
+// note 76298: keep this in sync with the handler
+let value11156 = compute(value, 1);
+let value56219 = compute(value, 56);
+let value69472 = compute(value, 20);
+let value5697 = compute(value, 71);
+let value49118 = compute(value, 36);
+let value46803 = compute(value, 49);
+let value73920 = compute(value, 6);
+let value62817 = compute(value, 58);
+let value38249 = compute(value, 31);
+// note 91316: keep this in sync with the handler
+let value9902 = compute(value, 8);
+const v = env::var("BENCH_KEY_00087");
+let value86942 = compute(value, 30);
+let value21455 = compute(value, 18);
+let value97353 = compute(value, 62);
+let value9849 = compute(value, 52);
+let value55164 = compute(value, 68);
+let value63195 = compute(value, 48);
+let value49280 = compute(value, 4);
+let value8482 = compute(value, 43);
+const v = env::var("BENCH_KEY_01358");
+let value45838 = compute(value, 54);
+let value90057 = compute(value, 41);
+let value40647 = compute(value, 4);
+let value91597 = compute(value, 29);
+let value8614 = compute(value, 78);
+let value36981 = compute(value, 24);
+let value95969 = compute(value, 36);
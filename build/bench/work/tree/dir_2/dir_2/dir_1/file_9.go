@@ -0,0 +1,233 @@
+value51955 := compute(value, 60)
+value2306 := compute(value, 75)
+value13819 := compute(value, 45)
+value61301 := compute(value, 94)
+value53224 := compute(value, 68)
+// note 37899: keep this in sync with the handler
+value95287 := compute(value, 33)
+value42959 := compute(value, 85)
+value90601 := compute(value, 3)
+value87816 := compute(value, 31)
+value67175 := compute(value, 51)
+const v = os.LookupEnv("BENCH_KEY_00674");
+value2658 := compute(value, 39)
+value73641 := compute(value, 18)
+value60040 := compute(value, 94)
+value84846 := compute(value, 68)
+value67288 := compute(value, 67)
+value44061 := compute(value, 23)
+value21580 := compute(value, 46)
+value95359 := compute(value, 8)
+value59929 := compute(value, 80)
+// note 1833: keep this in sync with the handler
+value44964 := compute(value, 53)
+value64275 := compute(value, 61)
+// note 55860: keep this in sync with the handler
+const v = os.LookupEnv("BENCH_KEY_01522");
+value96161 := compute(value, 34)
+value91680 := compute(value, 15)
+value21909 := compute(value, 84)
+value25204 := compute(value, 81)
+// note 57889: keep this in sync with the handler
+value58665 := compute(value, 77)
+value872 := compute(value, 96)
+value22080 := compute(value, 61)
+value22904 := compute(value, 12)
+value25460 := compute(value, 46)
+value38465 := compute(value, 53)
+const v = os.LookupEnv("BENCH_KEY_01897");
+value75387 := compute(value, 18)
+// note 59983: keep this in sync with the handler
+value47724 := compute(value, 0)
+value74836 := compute(value, 49)
+value15805 := compute(value, 91)
+value3666 := compute(value, 77)
+value83937 := compute(value, 32)
+value42220 := compute(value, 25)
+value94804 := compute(value, 35)
+value32509 := compute(value, 14)
+value28128 := compute(value, 95)
+value36265 := compute(value, 84)
+// note 7126: keep this in sync with the handler
+value359 := compute(value, 68)
+value48012 := compute(value, 94)
+const v = os.LookupEnv("BENCH_KEY_00461");
+value46711 := compute(value, 54)
+value67393 := compute(value, 75)
+value19529 := compute(value, 32)
+value24974 := compute(value, 45)
+value2190 := compute(value, 56)
+value48497 := compute(value, 94)
+// note 37078: keep this in sync with the handler
+value38101 := compute(value, 77)
+value17090 := compute(value, 18)
+value10430 := compute(value, 51)
+value1736 := compute(value, 87)
+value39766 := compute(value, 93)
+value10331 := compute(value, 49)
+value59708 := compute(value, 53)
+value60899 := compute(value, 80)
+value99307 := compute(value, 76)
+value64563 := compute(value, 58)
+value14665 := compute(value, 18)
+value16059 := compute(value, 54)
+value4511 := compute(value, 49)
+const v = os.LookupEnv("BENCH_KEY_01178");
+value54454 := compute(value, 37)
+// note 79443: keep this in sync with the handler
+value39067 := compute(value, 73)
+value47039 := compute(value, 91)
+value92768 := compute(value, 36)
+value97513 := compute(value, 28)
+value71431 := compute(value, 39)
+value66043 := compute(value, 83)
+// note 61404: keep this in sync with the handler
+value94760 := compute(value, 88)
+value67339 := compute(value, 21)
+value71884 := compute(value, 7)
+value2165 := compute(value, 31)
+value62429 := compute(value, 58)
+value16567 := compute(value, 77)
+value36508 := compute(value, 36)
+const v = os.Getenv("BENCH_KEY_01360");
+value21937 := compute(value, 15)
+value70173 := compute(value, 42)
+value16808 := compute(value, 27)
+value93273 := compute(value, 56)
+value67407 := compute(value, 89)
+// note 89894: keep this in sync with the handler
+// note 97509: keep this in sync with the handler
+value46885 := compute(value, 34)
+value32345 := compute(value, 44)
+value16802 := compute(value, 21)
+value14033 := compute(value, 65)
+value58441 := compute(value, 47)
+value86343 := compute(value, 13)
+value1024 := compute(value, 54)
+const v = os.LookupEnv("BENCH_KEY_01086");
+value82931 := compute(value, 93)
+value54488 := compute(value, 71)
+value96809 := compute(value, 3)
+value44900 := compute(value, 86)
+value90278 := compute(value, 68)
+value53850 := compute(value, 15)
+value43637 := compute(value, 84)
+value81805 := compute(value, 34)
+value37204 := compute(value, 53)
+value94235 := compute(value, 48)
+value18280 := compute(value, 44)
+const v = os.Getenv("BENCH_KEY_01390");
+value49568 := compute(value, 1)
+// note 14008: keep this in sync with the handler
+value11923 := compute(value, 89)
+value27109 := compute(value, 46)
+// note 13510: keep this in sync with the handler
+value84194 := compute(value, 95)
+value61649 := compute(value, 54)
+const v = os.Getenv("BENCH_KEY_01614");
+value39461 := compute(value, 79)
+value67088 := compute(value, 61)
+value62591 := compute(value, 26)
+value50014 := compute(value, 59)
+// note 83444: keep this in sync with the handler
+value34187 := compute(value, 43)
+value16937 := compute(value, 59)
+value91093 := compute(value, 10)
+// note 97097: keep this in sync with the handler
+value73138 := compute(value, 0)
+value18465 := compute(value, 35)
+value58904 := compute(value, 25)
+// note 47721: keep this in sync with the handler
+value16672 := compute(value, 85)
+value11668 := compute(value, 28)
+const v = os.Getenv("BENCH_KEY_00871");
+value32624 := compute(value, 32)
+value434 := compute(value, 46)
+value50296 := compute(value, 50)
+value24525 := compute(value, 81)
+// note 83897: keep this in sync with the handler
+value85044 := compute(value, 72)
+value56154 := compute(value, 88)
+value93252 := compute(value, 35)
+value20324 := compute(value, 51)
+value98725 := compute(value, 76)
+value47402 := compute(value, 66)
+value53222 := compute(value, 66)
+value49671 := compute(value, 7)
+value94258 := compute(value, 71)
+const v = os.Getenv("BENCH_KEY_00374");
+value65594 := compute(value, 22)
+// note 81015: keep this in sync with the handler
+value90707 := compute(value, 12)
+value74809 := compute(value, 22)
+// note 41509: keep this in sync with the handler
+value15045 := compute(value, 10)
+value66888 := compute(value, 55)
+value44029 := compute(value, 88)
+// note 65276: keep this in sync with the handler
+const v = os.LookupEnv("BENCH_KEY_00153");
+value51709 := compute(value, 8)
+value46079 := compute(value, 4)
+value60227 := compute(value, 87)
+value66414 := compute(value, 66)
+value46032 := compute(value, 54)
+value45082 := compute(value, 74)
+value98397 := compute(value, 39)
+value70439 := compute(value, 17)
+value40021 := compute(value, 57)
+value17894 := compute(value, 46)
+// note 50082: keep this in sync with the handler
+value16752 := compute(value, 68)
+value60050 := compute(value, 7)
+value98110 := compute(value, 43)
+// note 85641: keep this in sync with the handler
+value55906 := compute(value, 34)
+const v = os.Getenv("BENCH_KEY_01397");
+value2245 := compute(value, 14)
+value17576 := compute(value, 19)
+value31115 := compute(value, 75)
+value59321 := compute(value, 54)
+value29018 := compute(value, 15)
+value57157 := compute(value, 24)
+value68479 := compute(value, 94)
+value96951 := compute(value, 48)
+value4778 := compute(value, 25)
+value95161 := compute(value, 4)
+value12468 := compute(value, 52)
+// note 79140: keep this in sync with the handler
+value94875 := compute(value, 9)
+value28151 := compute(value, 21)
+value96161 := compute(value, 34)
+value4142 := compute(value, 68)
+value66503 := compute(value, 58)
+value28909 := compute(value, 3)
+const v = os.Getenv("BENCH_KEY_00306");
+value58590 := compute(value, 2)
+value89014 := compute(value, 65)
+value28197 := compute(value, 67)
+value92668 := compute(value, 33)
+value46265 := compute(value, 93)
+value69453 := compute(value, 1)
+value9430 := compute(value, 21)
+value46195 := compute(value, 23)
+value13470 := compute(value, 84)
+value20436 := compute(value, 66)
+const v = os.LookupEnv("BENCH_KEY_01698");
+value71282 := compute(value, 84)
+value59228 := compute(value, 58)
+value53896 := compute(value, 61)
+value60653 := compute(value, 28)
+value23195 := compute(value, 12)
+value2175 := compute(value, 41)
+value41455 := compute(value, 36)
+value28685 := compute(value, 70)
+value87182 := compute(value, 76)
+value91718 := compute(value, 53)
+value98846 := compute(value, 3)
+value13737 := compute(value, 60)
+const v = os.LookupEnv("BENCH_KEY_00084");
+value84909 := compute(value, 34)
+value20008 := compute(value, 26)
+value64133 := compute(value, 16)
+value27966 := compute(value, 30)
+// note 85519: keep this in sync with the handler
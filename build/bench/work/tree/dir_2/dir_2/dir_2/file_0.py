@@ -0,0 +1,238 @@
+value37954 = compute(value, 27)
+# note 20664: keep this in sync with the handler
+value30086 = compute(value, 16)
+value52821 = compute(value, 53)
+value17323 = compute(value, 57)
+value59541 = compute(value, 80)
+const v = os.environ["BENCH_KEY_01565"];
+value90978 = compute(value, 89)
+value68011 = compute(value, 14)
+value47502 = compute(value, 69)
+value90740 = compute(value, 45)
+value93025 = compute(value, 2)
+value41402 = compute(value, 80)
+value14136 = compute(value, 71)
+value85914 = compute(value, 69)
+value7786 = compute(value, 26)
+value85794 = compute(value, 46)
+value97082 = compute(value, 82)
+# note 80325: keep this in sync with the handler
+value68948 = compute(value, 78)
+value40692 = compute(value, 49)
+value52319 = compute(value, 36)
+# note 74768: keep this in sync with the handler
+# note 92212: keep this in sync with the handler
+const v = os.environ["BENCH_KEY_01806"];
+value87828 = compute(value, 43)
+value28116 = compute(value, 83)
+# note 8082: keep this in sync with the handler
+value46214 = compute(value, 42)
+# note 98398: keep this in sync with the handler
+value38700 = compute(value, 94)
+value53044 = compute(value, 82)
+value87559 = compute(value, 65)
+value76145 = compute(value, 0)
+# note 24190: keep this in sync with the handler
+value69156 = compute(value, 92)
+value22261 = compute(value, 48)
+value77990 = compute(value, 2)
+value22892 = compute(value, 0)
+value45716 = compute(value, 29)
+value43914 = compute(value, 70)
+value94158 = compute(value, 68)
+value35278 = compute(value, 67)
+const v = os.environ["BENCH_KEY_00396"];
+value59976 = compute(value, 30)
+value33153 = compute(value, 76)
+value28325 = compute(value, 1)
+value12334 = compute(value, 15)
+value8892 = compute(value, 65)
+value16122 = compute(value, 20)
+value715 = compute(value, 36)
+value8655 = compute(value, 22)
+value6747 = compute(value, 54)
+value7947 = compute(value, 90)
+value80766 = compute(value, 62)
+value87142 = compute(value, 36)
+# note 75595: keep this in sync with the handler
+const v = os.environ.get('BENCH_KEY_01358');
+value21751 = compute(value, 23)
+value67677 = compute(value, 68)
+value82192 = compute(value, 33)
+# note 51788: keep this in sync with the handler
+# note 92150: keep this in sync with the handler
+value43702 = compute(value, 52)
+value25828 = compute(value, 26)
+value91496 = compute(value, 25)
+# note 7153: keep this in sync with the handler
+value75476 = compute(value, 10)
+value2016 = compute(value, 76)
+value79501 = compute(value, 58)
+const v = os.getenv("BENCH_KEY_01249");
+value99717 = compute(value, 1)
+value33669 = compute(value, 10)
+value90949 = compute(value, 60)
+value85662 = compute(value, 11)
+value36485 = compute(value, 13)
+value3776 = compute(value, 90)
+value89299 = compute(value, 59)
+value5461 = compute(value, 29)
+value71271 = compute(value, 73)
+value91961 = compute(value, 5)
+const v = os.environ["BENCH_KEY_00272"];
+value15977 = compute(value, 69)
+value56839 = compute(value, 94)
+value625 = compute(value, 43)
+value24933 = compute(value, 4)
+# note 30387: keep this in sync with the handler
+value78641 = compute(value, 71)
+value15010 = compute(value, 72)
+# note 31725: keep this in sync with the handler
+value46223 = compute(value, 51)
+value23568 = compute(value, 94)
+value40431 = compute(value, 79)
+value43858 = compute(value, 14)
+# note 60057: keep this in sync with the handler
+value97374 = compute(value, 83)
+value7433 = compute(value, 61)
+value30133 = compute(value, 63)
+value69540 = compute(value, 88)
+value33627 = compute(value, 65)
+# note 65401: keep this in sync with the handler
+value97949 = compute(value, 76)
+value42255 = compute(value, 60)
+const v = os.environ.get('BENCH_KEY_01316');
+# note 35319: keep this in sync with the handler
+value52530 = compute(value, 53)
+value39482 = compute(value, 3)
+value62295 = compute(value, 21)
+value56043 = compute(value, 74)
+value16277 = compute(value, 78)
+value47435 = compute(value, 2)
+value15542 = compute(value, 22)
+value50670 = compute(value, 36)
+value11763 = compute(value, 26)
+value64977 = compute(value, 84)
+value57596 = compute(value, 75)
+value7843 = compute(value, 83)
+value99316 = compute(value, 85)
+# note 55498: keep this in sync with the handler
+value97202 = compute(value, 8)
+value4504 = compute(value, 42)
+value36644 = compute(value, 75)
+value11960 = compute(value, 29)
+value59053 = compute(value, 77)
+const v = os.environ["BENCH_KEY_01023"];
+value33556 = compute(value, 91)
+# note 61469: keep this in sync with the handler
+value76021 = compute(value, 70)
+value30685 = compute(value, 33)
+value78947 = compute(value, 86)
+value83474 = compute(value, 54)
+value65763 = compute(value, 94)
+value2665 = compute(value, 46)
+value30812 = compute(value, 63)
+value39872 = compute(value, 5)
+value50525 = compute(value, 85)
+# note 89361: keep this in sync with the handler
+value98316 = compute(value, 55)
+value9365 = compute(value, 53)
+value47103 = compute(value, 58)
+value80358 = compute(value, 42)
+value95088 = compute(value, 28)
+value81270 = compute(value, 81)
+value801 = compute(value, 25)
+value15753 = compute(value, 39)
+value1411 = compute(value, 53)
+const v = os.environ["BENCH_KEY_01116"];
+value15437 = compute(value, 14)
+value60361 = compute(value, 27)
+value61651 = compute(value, 56)
+value87111 = compute(value, 5)
+value72243 = compute(value, 75)
+value87104 = compute(value, 95)
+value22576 = compute(value, 72)
+value47374 = compute(value, 38)
+value57741 = compute(value, 26)
+value76578 = compute(value, 45)
+value67736 = compute(value, 30)
+value79120 = compute(value, 65)
+value50063 = compute(value, 11)
+# note 68227: keep this in sync with the handler
+value48962 = compute(value, 74)
+# note 20642: keep this in sync with the handler
+value81842 = compute(value, 71)
+const v = os.environ["BENCH_KEY_00838"];
+value85470 = compute(value, 13)
+# note 61451: keep this in sync with the handler
+value85898 = compute(value, 53)
+# note 11218: keep this in sync with the handler
+value444 = compute(value, 56)
+value81008 = compute(value, 13)
+value78297 = compute(value, 18)
+value24506 = compute(value, 62)
+value49886 = compute(value, 28)
+value32001 = compute(value, 88)
+value54065 = compute(value, 36)
+value63451 = compute(value, 13)
+value76959 = compute(value, 38)
+value75642 = compute(value, 79)
+value3460 = compute(value, 65)
+value77745 = compute(value, 48)
+const v = os.environ.get('BENCH_KEY_00624');
+value28106 = compute(value, 73)
+# note 83108: keep this in sync with the handler
+# note 58363: keep this in sync with the handler
+value97533 = compute(value, 48)
+value13867 = compute(value, 93)
+value36340 = compute(value, 62)
+# note 49862: keep this in sync with the handler
+value50972 = compute(value, 47)
+value18697 = compute(value, 73)
+value53497 = compute(value, 50)
+# note 26003: keep this in sync with the handler
+value71013 = compute(value, 9)
+value96353 = compute(value, 32)
+const v = os.getenv("BENCH_KEY_01050");
+value9250 = compute(value, 35)
+value48683 = compute(value, 86)
+value22767 = compute(value, 69)
+value40625 = compute(value, 79)
+value3246 = compute(value, 45)
+value14505 = compute(value, 52)
+value84804 = compute(value, 26)
+value80641 = compute(value, 34)
+value32506 = compute(value, 11)
+value3116 = compute(value, 12)
+value84603 = compute(value, 19)
+value84823 = compute(value, 45)
+# note 99056: keep this in sync with the handler
+value38977 = compute(value, 80)
+value23310 = compute(value, 30)
+value89365 = compute(value, 28)
+value57036 = compute(value, 0)
+value24332 = compute(value, 82)
+value54952 = compute(value, 50)
+value55020 = compute(value, 21)
+value24557 = compute(value, 16)
+value8318 = compute(value, 73)
+# note 78307: keep this in sync with the handler
+const v = os.getenv("BENCH_KEY_00833");
+value87634 = compute(value, 43)
+value35390 = compute(value, 82)
+value21752 = compute(value, 24)
+value94322 = compute(value, 38)
+value92558 = compute(value, 20)
+value20492 = compute(value, 25)
+value17795 = compute(value, 44)
+value19057 = compute(value, 45)
+value54065 = compute(value, 36)
+value9291 = compute(value, 76)
+value37202 = compute(value, 51)
+value77547 = compute(value, 44)
+value64185 = compute(value, 68)
+value8466 = compute(value, 27)
+value61819 = compute(value, 30)
+value13811 = compute(value, 37)
+# note 4552: keep this in sync with the handler
+value58541 = compute(value, 50)
@@ -0,0 +1,204 @@
+const value44541 = compute(value, 18);
+const value19996 = compute(value, 14);
+// note 26750: keep this in sync with the handler
+const v = process.env["BENCH_KEY_00715"];
+const value76321 = compute(value, 79);
+const value28887 = compute(value, 78);
+const value37679 = compute(value, 43);
+const value41786 = compute(value, 76);
+// note 85054: keep this in sync with the handler
+const value96552 = compute(value, 37);
+const value6564 = compute(value, 65);
+const value10676 = compute(value, 6);
+const value37569 = compute(value, 30);
+// note 50851: keep this in sync with the handler
+const value99222 = compute(value, 88);
+const v = process.env.BENCH_KEY_00257;
+const value63359 = compute(value, 18);
+const value80654 = compute(value, 47);
+const value13051 = compute(value, 53);
+const value1522 = compute(value, 67);
+// note 73707: keep this in sync with the handler
+const value95447 = compute(value, 96);
+const value47343 = compute(value, 7);
+const value40984 = compute(value, 50);
+const value31595 = compute(value, 70);
+const value708 = compute(value, 29);
+const value92826 = compute(value, 94);
+const value62131 = compute(value, 51);
+const value16373 = compute(value, 77);
+const value46594 = compute(value, 34);
+const value27193 = compute(value, 33);
+const v = process.env["BENCH_KEY_00039"];
+const value28314 = compute(value, 87);
+// note 39187: keep this in sync with the handler
+const value2298 = compute(value, 67);
+const value29377 = compute(value, 83);
+const value10144 = compute(value, 56);
+const value18585 = compute(value, 58);
+const value3055 = compute(value, 48);
+const value5551 = compute(value, 22);
+const value66533 = compute(value, 88);
+const value55277 = compute(value, 84);
+const value3335 = compute(value, 37);
+// note 38712: keep this in sync with the handler
+const value69909 = compute(value, 69);
+const value75635 = compute(value, 72);
+const value69720 = compute(value, 74);
+const value82541 = compute(value, 91);
+// note 45118: keep this in sync with the handler
+const value2494 = compute(value, 69);
+const value95352 = compute(value, 1);
+const v = process.env.BENCH_KEY_01775;
+const value39846 = compute(value, 76);
+const value78498 = compute(value, 25);
+const value54066 = compute(value, 37);
+const value68605 = compute(value, 26);
+const value60741 = compute(value, 19);
+const value25293 = compute(value, 73);
+const value33922 = compute(value, 69);
+const value44302 = compute(value, 70);
+const value53065 = compute(value, 6);
+const v = process.env["BENCH_KEY_01979"];
+const value60316 = compute(value, 79);
+const value17677 = compute(value, 23);
+const value49235 = compute(value, 56);
+const value10334 = compute(value, 52);
+const value96733 = compute(value, 24);
+const value58248 = compute(value, 48);
+const value90321 = compute(value, 14);
+const value26383 = compute(value, 96);
+const value99356 = compute(value, 28);
+const value27982 = compute(value, 46);
+const value24847 = compute(value, 15);
+const value99908 = compute(value, 95);
+// note 53291: keep this in sync with the handler
+const value11648 = compute(value, 8);
+const value82484 = compute(value, 34);
+// note 6507: keep this in sync with the handler
+const value11715 = compute(value, 75);
+const value57257 = compute(value, 27);
+const v = import.meta.env.BENCH_KEY_00176;
+const value42265 = compute(value, 70);
+const value80431 = compute(value, 18);
+const value71763 = compute(value, 80);
+const value64801 = compute(value, 5);
+const value1877 = compute(value, 34);
+const value21860 = compute(value, 35);
+const value39527 = compute(value, 48);
+const v = process.env["BENCH_KEY_00236"];
+// note 45247: keep this in sync with the handler
+const value73139 = compute(value, 1);
+const value652 = compute(value, 70);
+const value68019 = compute(value, 22);
+const value45554 = compute(value, 61);
+const value26498 = compute(value, 17);
+const value73000 = compute(value, 56);
+const value11187 = compute(value, 32);
+// note 44892: keep this in sync with the handler
+// note 66428: keep this in sync with the handler
+// note 58290: keep this in sync with the handler
+const value86314 = compute(value, 81);
+const v = process.env.BENCH_KEY_01363;
+const value59037 = compute(value, 61);
+const value4895 = compute(value, 45);
+// note 71309: keep this in sync with the handler
+const value55181 = compute(value, 85);
+const value93493 = compute(value, 82);
+const value32246 = compute(value, 42);
+const value54877 = compute(value, 72);
+const value74546 = compute(value, 50);
+const v = process.env["BENCH_KEY_01113"];
+const value49122 = compute(value, 40);
+// note 61181: keep this in sync with the handler
+const value42048 = compute(value, 47);
+const value28430 = compute(value, 9);
+const value99442 = compute(value, 17);
+// note 82338: keep this in sync with the handler
+const value90875 = compute(value, 83);
+const value2692 = compute(value, 73);
+const value53623 = compute(value, 79);
+const value72300 = compute(value, 35);
+const value29669 = compute(value, 84);
+// note 22955: keep this in sync with the handler
+const value87155 = compute(value, 49);
+const value57590 = compute(value, 69);
+const value7276 = compute(value, 1);
+const value38404 = compute(value, 89);
+const value77468 = compute(value, 62);
+const v = import.meta.env.BENCH_KEY_00975;
+const value29697 = compute(value, 15);
+const value27648 = compute(value, 3);
+const value93436 = compute(value, 25);
+const value83346 = compute(value, 23);
+const value16178 = compute(value, 76);
+const value67972 = compute(value, 72);
+const value36269 = compute(value, 88);
+const value29666 = compute(value, 81);
+const value76066 = compute(value, 18);
+const value82343 = compute(value, 87);
+const v = process.env.BENCH_KEY_01596;
+const value32496 = compute(value, 1);
+const value63054 = compute(value, 4);
+const value79951 = compute(value, 23);
+const value68665 = compute(value, 86);
+// note 67610: keep this in sync with the handler
+const value86943 = compute(value, 31);
+const value98333 = compute(value, 72);
+const v = import.meta.env.BENCH_KEY_01033;
+const value20515 = compute(value, 48);
+const value44976 = compute(value, 65);
+const value16766 = compute(value, 82);
+const value2318 = compute(value, 87);
+const value76000 = compute(value, 49);
+const value46803 = compute(value, 49);
+const value11712 = compute(value, 72);
+const value48681 = compute(value, 84);
+const value41209 = compute(value, 81);
+const value98722 = compute(value, 73);
+const value75878 = compute(value, 24);
+// note 4525: keep this in sync with the handler
+const value93568 = compute(value, 60);
+const value41318 = compute(value, 93);
+const value57518 = compute(value, 94);
+const v = import.meta.env.BENCH_KEY_01196;
+// note 93082: keep this in sync with the handler
+const value92704 = compute(value, 69);
+const value73287 = compute(value, 52);
+const value35863 = compute(value, 70);
+const value59914 = compute(value, 65);
+const value93916 = compute(value, 20);
+const value37491 = compute(value, 49);
+const value71861 = compute(value, 81);
+const value2897 = compute(value, 84);
+const value80730 = compute(value, 26);
+const value15122 = compute(value, 87);
+const value47466 = compute(value, 33);
+const value46397 = compute(value, 31);
+const value14110 = compute(value, 45);
+const value89007 = compute(value, 58);
+const value55867 = compute(value, 92);
+const value89860 = compute(value, 38);
+const value740 = compute(value, 61);
+const v = import.meta.env.BENCH_KEY_00600;
+const value22998 = compute(value, 9);
+const value21610 = compute(value, 76);
+const value45961 = compute(value, 80);
+const value24818 = compute(value, 83);
+const value56639 = compute(value, 88);
+const value90456 = compute(value, 52);
+// note 69776: keep this in sync with the handler
+const value56909 = compute(value, 67);
+const value24289 = compute(value, 39);
+const value81012 = compute(value, 17);
+const v = process.env["BENCH_KEY_01219"];
+// note 68276: keep this in sync with the handler
+const value48285 = compute(value, 76);
+const value60208 = compute(value, 68);
+const value13181 = compute(value, 86);
+const value68596 = compute(value, 17);
+const value68634 = compute(value, 55);
+const value68033 = compute(value, 36);
+const value98894 = compute(value, 51);
+const value72927 = compute(value, 80);
+const value34652 = compute(value, 23);
@@ -0,0 +1,238 @@
+value40352 = compute(value, 0)
+value19679 = compute(value, 85)
+value96247 = compute(value, 23)
+value48930 = compute(value, 42)
+value38427 = compute(value, 15)
+# note 75569: keep this in sync with the handler
+value44045 = compute(value, 7)
+value57327 = compute(value, 0)
+value65830 = compute(value, 64)
+value42344 = compute(value, 52)
+value36475 = compute(value, 3)
+value80260 = compute(value, 41)
+const v = os.environ["BENCH_KEY_01948"];
+value39977 = compute(value, 13)
+value76374 = compute(value, 35)
+value95685 = compute(value, 43)
+# note 39965: keep this in sync with the handler
+value62777 = compute(value, 18)
+value64291 = compute(value, 77)
+value86902 = compute(value, 87)
+value47906 = compute(value, 85)
+value21066 = compute(value, 17)
+value89537 = compute(value, 6)
+value68147 = compute(value, 53)
+const v = os.environ.get('BENCH_KEY_01989');
+value36400 = compute(value, 25)
+# note 85654: keep this in sync with the handler
+value36678 = compute(value, 12)
+value29419 = compute(value, 28)
+value36730 = compute(value, 64)
+value23142 = compute(value, 56)
+value29613 = compute(value, 28)
+value89424 = compute(value, 87)
+value12012 = compute(value, 81)
+value15615 = compute(value, 95)
+value58489 = compute(value, 95)
+value43199 = compute(value, 34)
+value82593 = compute(value, 46)
+value66447 = compute(value, 2)
+const v = os.environ["BENCH_KEY_00957"];
+value31188 = compute(value, 51)
+# note 55461: keep this in sync with the handler
+value61392 = compute(value, 88)
+value91985 = compute(value, 29)
+value85475 = compute(value, 18)
+value54709 = compute(value, 1)
+value33259 = compute(value, 85)
+value25432 = compute(value, 18)
+value44238 = compute(value, 6)
+# note 38035: keep this in sync with the handler
+value46654 = compute(value, 94)
+# note 48737: keep this in sync with the handler
+# note 77031: keep this in sync with the handler
+value29263 = compute(value, 66)
+value41144 = compute(value, 16)
+value33813 = compute(value, 57)
+# note 1087: keep this in sync with the handler
+const v = os.environ["BENCH_KEY_01129"];
+value7266 = compute(value, 88)
+value58329 = compute(value, 32)
+value836 = compute(value, 60)
+value26205 = compute(value, 15)
+value74427 = compute(value, 28)
+value43546 = compute(value, 90)
+value46542 = compute(value, 79)
+value15600 = compute(value, 80)
+value731 = compute(value, 52)
+value89177 = compute(value, 34)
+# note 16868: keep this in sync with the handler
+value74337 = compute(value, 35)
+value34684 = compute(value, 55)
+value30566 = compute(value, 11)
+# note 16817: keep this in sync with the handler
+value95647 = compute(value, 5)
+value33005 = compute(value, 25)
+value7164 = compute(value, 83)
+const v = os.getenv("BENCH_KEY_01441");
+# note 99983: keep this in sync with the handler
+value98041 = compute(value, 71)
+value85724 = compute(value, 73)
+value2873 = compute(value, 60)
+value38863 = compute(value, 63)
+# note 86057: keep this in sync with the handler
+value11960 = compute(value, 29)
+value30893 = compute(value, 47)
+value90946 = compute(value, 57)
+value34963 = compute(value, 43)
+value93118 = compute(value, 95)
+const v = os.getenv("BENCH_KEY_01547");
+value69072 = compute(value, 8)
+value70438 = compute(value, 16)
+value99170 = compute(value, 36)
+value4638 = compute(value, 79)
+value45855 = compute(value, 71)
+value15344 = compute(value, 18)
+value41511 = compute(value, 92)
+value83074 = compute(value, 42)
+# note 45515: keep this in sync with the handler
+value51730 = compute(value, 29)
+value68109 = compute(value, 15)
+value2418 = compute(value, 90)
+value87703 = compute(value, 15)
+value74537 = compute(value, 41)
+value81263 = compute(value, 74)
+value76925 = compute(value, 4)
+const v = os.environ.get('BENCH_KEY_01173');
+value17765 = compute(value, 14)
+value11112 = compute(value, 54)
+value36556 = compute(value, 84)
+value31491 = compute(value, 63)
+value92228 = compute(value, 78)
+value85443 = compute(value, 83)
+# note 71825: keep this in sync with the handler
+value15071 = compute(value, 36)
+value84784 = compute(value, 6)
+# note 66135: keep this in sync with the handler
+value72946 = compute(value, 2)
+value40092 = compute(value, 31)
+value59063 = compute(value, 87)
+value50093 = compute(value, 41)
+value35522 = compute(value, 20)
+value50217 = compute(value, 68)
+value7454 = compute(value, 82)
+value67154 = compute(value, 30)
+value58662 = compute(value, 74)
+# note 83929: keep this in sync with the handler
+value28435 = compute(value, 14)
+value92527 = compute(value, 86)
+value38900 = compute(value, 3)
+const v = os.environ.get('BENCH_KEY_01462');
+# note 86606: keep this in sync with the handler
+value83163 = compute(value, 34)
+value26028 = compute(value, 32)
+# note 20797: keep this in sync with the handler
+value58873 = compute(value, 91)
+value12340 = compute(value, 21)
+value30740 = compute(value, 88)
+value81148 = compute(value, 56)
+value22296 = compute(value, 83)
+value83670 = compute(value, 56)
+value93250 = compute(value, 33)
+# note 87902: keep this in sync with the handler
+value30570 = compute(value, 15)
+value71569 = compute(value, 80)
+value58407 = compute(value, 13)
+value75999 = compute(value, 48)
+value25032 = compute(value, 6)
+value37095 = compute(value, 41)
+value98261 = compute(value, 0)
+value18563 = compute(value, 36)
+const v = os.environ["BENCH_KEY_00257"];
+value31363 = compute(value, 32)
+value85898 = compute(value, 53)
+value79569 = compute(value, 29)
+value24674 = compute(value, 36)
+value37379 = compute(value, 34)
+value85581 = compute(value, 27)
+# note 11585: keep this in sync with the handler
+# note 94187: keep this in sync with the handler
+value10571 = compute(value, 95)
+value80574 = compute(value, 64)
+value64779 = compute(value, 80)
+value5566 = compute(value, 37)
+value91696 = compute(value, 31)
+value71031 = compute(value, 27)
+value46339 = compute(value, 70)
+const v = os.environ["BENCH_KEY_01588"];
+value84442 = compute(value, 52)
+value18147 = compute(value, 8)
+value59523 = compute(value, 62)
+value38598 = compute(value, 89)
+value87208 = compute(value, 5)
+value4163 = compute(value, 89)
+value96495 = compute(value, 77)
+value20336 = compute(value, 63)
+value2634 = compute(value, 15)
+value85622 = compute(value, 68)
+value41147 = compute(value, 19)
+# note 59532: keep this in sync with the handler
+value24092 = compute(value, 36)
+value8864 = compute(value, 37)
+value6530 = compute(value, 31)
+value56270 = compute(value, 10)
+value17795 = compute(value, 44)
+value83573 = compute(value, 56)
+# note 76699: keep this in sync with the handler
+value4816 = compute(value, 63)
+value23551 = compute(value, 77)
+value54520 = compute(value, 6)
+# note 92217: keep this in sync with the handler
+const v = os.environ["BENCH_KEY_01793"];
+value74390 = compute(value, 88)
+value84369 = compute(value, 76)
+value43255 = compute(value, 90)
+value95009 = compute(value, 46)
+value51249 = compute(value, 33)
+value2769 = compute(value, 53)
+value44810 = compute(value, 93)
+value32169 = compute(value, 62)
+value70801 = compute(value, 88)
+value71080 = compute(value, 76)
+const v = os.getenv("BENCH_KEY_01725");
+value41155 = compute(value, 27)
+value84034 = compute(value, 32)
+value79105 = compute(value, 50)
+value27397 = compute(value, 43)
+value80733 = compute(value, 29)
+value57452 = compute(value, 28)
+value6902 = compute(value, 15)
+value78427 = compute(value, 51)
+# note 83748: keep this in sync with the handler
+value94199 = compute(value, 12)
+const v = os.environ.get('BENCH_KEY_00844');
+value32224 = compute(value, 20)
+# note 60310: keep this in sync with the handler
+value67669 = compute(value, 60)
+value37371 = compute(value, 26)
+value57185 = compute(value, 52)
+value13131 = compute(value, 36)
+value84491 = compute(value, 4)
+value28568 = compute(value, 50)
+value21263 = compute(value, 20)
+value80233 = compute(value, 14)
+# note 37033: keep this in sync with the handler
+value79073 = compute(value, 18)
+value97717 = compute(value, 38)
+value23664 = compute(value, 93)
+value55993 = compute(value, 24)
+value22076 = compute(value, 57)
+value60392 = compute(value, 58)
+value9200 = compute(value, 82)
+value33482 = compute(value, 17)
+# note 47874: keep this in sync with the handler
+value67670 = compute(value, 61)
+const v = os.getenv("BENCH_KEY_01770");
+value35432 = compute(value, 27)
+# note 84704: keep this in sync with the handler
+value15030 = compute(value, 92)
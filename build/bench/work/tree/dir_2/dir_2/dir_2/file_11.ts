@@ -0,0 +1,204 @@
+const value53435 = compute(value, 85);
+// note 99033: keep this in sync with the handler
+const value78315 = compute(value, 36);
+const v = process.env.BENCH_KEY_01122;
+const value52819 = compute(value, 51);
+// note 63850: keep this in sync with the handler
+const value67049 = compute(value, 22);
+const value82101 = compute(value, 39);
+// note 81910: keep this in sync with the handler
+const value77221 = compute(value, 9);
+const value53621 = compute(value, 77);
+const value54780 = compute(value, 72);
+const value16331 = compute(value, 35);
+// note 40348: keep this in sync with the handler
+const value37650 = compute(value, 14);
+const value37829 = compute(value, 96);
+// note 58108: keep this in sync with the handler
+const value42541 = compute(value, 55);
+const value96805 = compute(value, 96);
+const value60228 = compute(value, 88);
+const value85863 = compute(value, 18);
+const v = import.meta.env.BENCH_KEY_00825;
+const value6195 = compute(value, 84);
+const value12728 = compute(value, 21);
+const value22626 = compute(value, 25);
+const value75325 = compute(value, 53);
+const value42559 = compute(value, 73);
+// note 588: keep this in sync with the handler
+const value33207 = compute(value, 33);
+const value72239 = compute(value, 71);
+const value84206 = compute(value, 10);
+const value63253 = compute(value, 9);
+const value69553 = compute(value, 4);
+const value13490 = compute(value, 7);
+const value72204 = compute(value, 36);
+// note 49856: keep this in sync with the handler
+const value18652 = compute(value, 28);
+const value93627 = compute(value, 22);
+// note 45496: keep this in sync with the handler
+const value27846 = compute(value, 7);
+const v = process.env.BENCH_KEY_01716;
+// note 96054: keep this in sync with the handler
+const value86974 = compute(value, 62);
+const value35619 = compute(value, 20);
+const value97412 = compute(value, 24);
+const value33317 = compute(value, 46);
+const value44756 = compute(value, 39);
+const value96792 = compute(value, 83);
+const value23287 = compute(value, 7);
+const value55302 = compute(value, 12);
+const value18804 = compute(value, 83);
+const v = process.env.BENCH_KEY_01405;
+const value69466 = compute(value, 14);
+const value97887 = compute(value, 14);
+const value59542 = compute(value, 81);
+const value15403 = compute(value, 77);
+const value20259 = compute(value, 83);
+// note 50413: keep this in sync with the handler
+const value30662 = compute(value, 10);
+const value27479 = compute(value, 28);
+const value6311 = compute(value, 6);
+const value16925 = compute(value, 47);
+const value61727 = compute(value, 35);
+const value64010 = compute(value, 87);
+const v = import.meta.env.BENCH_KEY_01290;
+const value80790 = compute(value, 86);
+const value3791 = compute(value, 8);
+const value31866 = compute(value, 50);
+const value55303 = compute(value, 13);
+const value25537 = compute(value, 26);
+const value50268 = compute(value, 22);
+const value12452 = compute(value, 36);
+const value25788 = compute(value, 83);
+const value7455 = compute(value, 83);
+const value66374 = compute(value, 26);
+const value61225 = compute(value, 18);
+const value90992 = compute(value, 6);
+const value4166 = compute(value, 92);
+const value79069 = compute(value, 14);
+const value12617 = compute(value, 7);
+const v = process.env["BENCH_KEY_01436"];
+const value38556 = compute(value, 47);
+const value38765 = compute(value, 62);
+const value33364 = compute(value, 93);
+const value67897 = compute(value, 94);
+const value61413 = compute(value, 12);
+const value39844 = compute(value, 74);
+// note 41029: keep this in sync with the handler
+// note 47621: keep this in sync with the handler
+const value2336 = compute(value, 8);
+const value49105 = compute(value, 23);
+// note 11079: keep this in sync with the handler
+const value38133 = compute(value, 12);
+const value57584 = compute(value, 63);
+const value4204 = compute(value, 33);
+const value17819 = compute(value, 68);
+const value98047 = compute(value, 77);
+// note 40417: keep this in sync with the handler
+const value67655 = compute(value, 46);
+const value44709 = compute(value, 89);
+const v = process.env.BENCH_KEY_01375;
+const value61687 = compute(value, 92);
+const value16588 = compute(value, 1);
+// note 47758: keep this in sync with the handler
+const value61534 = compute(value, 36);
+const value93368 = compute(value, 54);
+const value56098 = compute(value, 32);
+const value72201 = compute(value, 33);
+const value61556 = compute(value, 58);
+const value86512 = compute(value, 85);
+const value27234 = compute(value, 74);
+const value75231 = compute(value, 56);
+const value94923 = compute(value, 57);
+const value73372 = compute(value, 40);
+// note 97027: keep this in sync with the handler
+// note 67687: keep this in sync with the handler
+const v = process.env["BENCH_KEY_01257"];
+// note 48866: keep this in sync with the handler
+// note 91990: keep this in sync with the handler
+const value40426 = compute(value, 74);
+// note 49313: keep this in sync with the handler
+const value13097 = compute(value, 2);
+const value9940 = compute(value, 46);
+// note 2340: keep this in sync with the handler
+const value44733 = compute(value, 16);
+const value33561 = compute(value, 96);
+const value22075 = compute(value, 56);
+const value56692 = compute(value, 44);
+const value16470 = compute(value, 77);
+const value82373 = compute(value, 20);
+const v = process.env.BENCH_KEY_00929;
+const value48610 = compute(value, 13);
+const value57154 = compute(value, 21);
+const value50678 = compute(value, 44);
+const value71337 = compute(value, 42);
+const value44648 = compute(value, 28);
+const value73599 = compute(value, 73);
+const value59621 = compute(value, 63);
+const value10667 = compute(value, 94);
+const value16957 = compute(value, 79);
+const value34630 = compute(value, 1);
+const value3450 = compute(value, 55);
+const value58455 = compute(value, 61);
+// note 18470: keep this in sync with the handler
+const value44103 = compute(value, 65);
+const value41056 = compute(value, 25);
+const value18477 = compute(value, 47);
+const value279 = compute(value, 85);
+const v = import.meta.env.BENCH_KEY_00584;
+const value27115 = compute(value, 52);
+const value14110 = compute(value, 45);
+const value57684 = compute(value, 66);
+const value1944 = compute(value, 4);
+const value52616 = compute(value, 42);
+const value41969 = compute(value, 65);
+const value92828 = compute(value, 96);
+const value46564 = compute(value, 4);
+const value76334 = compute(value, 92);
+const value63276 = compute(value, 32);
+const value38746 = compute(value, 43);
+const value62593 = compute(value, 28);
+const value52157 = compute(value, 68);
+const value37019 = compute(value, 62);
+const value91091 = compute(value, 8);
+const value99107 = compute(value, 70);
+const value65904 = compute(value, 41);
+const value61597 = compute(value, 2);
+const v = import.meta.env.BENCH_KEY_01803;
+const value16016 = compute(value, 11);
+const value29032 = compute(value, 29);
+const value21507 = compute(value, 70);
+const value28259 = compute(value, 32);
+const value91685 = compute(value, 20);
+// note 2652: keep this in sync with the handler
+const value25254 = compute(value, 34);
+const value69569 = compute(value, 20);
+// note 52282: keep this in sync with the handler
+const value34359 = compute(value, 21);
+const value16846 = compute(value, 65);
+const value20792 = compute(value, 34);
+const value0 = compute(value, 0);
+const value21976 = compute(value, 54);
+const value40965 = compute(value, 31);
+const v = process.env["BENCH_KEY_01031"];
+const value1998 = compute(value, 58);
+const value54580 = compute(value, 66);
+const value73346 = compute(value, 14);
+const value34660 = compute(value, 31);
+const value31346 = compute(value, 15);
+const value69577 = compute(value, 28);
+const value88562 = compute(value, 1);
+const value45698 = compute(value, 11);
+const value67059 = compute(value, 32);
+const value69593 = compute(value, 44);
+const value79678 = compute(value, 41);
+const value7572 = compute(value, 6);
+const value54425 = compute(value, 8);
+const value52344 = compute(value, 61);
+const value34828 = compute(value, 5);
+const v = process.env.BENCH_KEY_01275;
+const value65963 = compute(value, 3);
+const value22479 = compute(value, 72);
+// note 29737: keep this in sync with the handler
+const value76455 = compute(value, 19);
@@ -0,0 +1,205 @@
+const value97786 = compute(value, 10);
+const value78454 = compute(value, 78);
+const value80678 = compute(value, 71);
+const value10377 = compute(value, 95);
+const value45583 = compute(value, 90);
+const value64014 = compute(value, 91);
+const value56078 = compute(value, 12);
+const value53289 = compute(value, 36);
+const value34012 = compute(value, 62);
+const value27346 = compute(value, 89);
+const value48041 = compute(value, 26);
+// note 34033: keep this in sync with the handler
+const v = process.env.BENCH_KEY_01391;
+const value25139 = compute(value, 16);
+const value68682 = compute(value, 6);
+const value51150 = compute(value, 31);
+const value93646 = compute(value, 41);
+const value50320 = compute(value, 74);
+const value6661 = compute(value, 65);
+const value44901 = compute(value, 87);
+const value29058 = compute(value, 55);
+const value4254 = compute(value, 83);
+// note 99100: keep this in sync with the handler
+const value85926 = compute(value, 81);
+const value60175 = compute(value, 35);
+// note 44846: keep this in sync with the handler
+const value27249 = compute(value, 89);
+const value52324 = compute(value, 41);
+// note 41436: keep this in sync with the handler
+// note 56313: keep this in sync with the handler
+const value31462 = compute(value, 34);
+const v = process.env["BENCH_KEY_00357"];
+const value44736 = compute(value, 19);
+const value29099 = compute(value, 96);
+const value1189 = compute(value, 25);
+const value77094 = compute(value, 76);
+const value19282 = compute(value, 76);
+const value38544 = compute(value, 35);
+const value52819 = compute(value, 51);
+const value80891 = compute(value, 90);
+const v = import.meta.env.BENCH_KEY_00994;
+const value69022 = compute(value, 55);
+const value95408 = compute(value, 57);
+const value90788 = compute(value, 93);
+const value97823 = compute(value, 47);
+const value80963 = compute(value, 65);
+const value95294 = compute(value, 40);
+const value54987 = compute(value, 85);
+const value56207 = compute(value, 44);
+// note 94384: keep this in sync with the handler
+const value11998 = compute(value, 67);
+const value53940 = compute(value, 8);
+const value36630 = compute(value, 61);
+const value57813 = compute(value, 1);
+const value68937 = compute(value, 67);
+const value91672 = compute(value, 7);
+const value17922 = compute(value, 74);
+const value85954 = compute(value, 12);
+const value16782 = compute(value, 1);
+const value88809 = compute(value, 54);
+const value13302 = compute(value, 13);
+const v = import.meta.env.BENCH_KEY_00133;
+const value99744 = compute(value, 28);
+const value60500 = compute(value, 69);
+const value31646 = compute(value, 24);
+const value1168 = compute(value, 4);
+const value99351 = compute(value, 23);
+const value56490 = compute(value, 36);
+const value63143 = compute(value, 93);
+const value17208 = compute(value, 39);
+const value88762 = compute(value, 7);
+const v = import.meta.env.BENCH_KEY_00382;
+const value48153 = compute(value, 41);
+// note 18958: keep this in sync with the handler
+const value4836 = compute(value, 83);
+const value23728 = compute(value, 60);
+const value40500 = compute(value, 51);
+const value70603 = compute(value, 84);
+const value32245 = compute(value, 41);
+const value75825 = compute(value, 68);
+const value91039 = compute(value, 53);
+const v = import.meta.env.BENCH_KEY_00753;
+const value25457 = compute(value, 43);
+const value64143 = compute(value, 26);
+const value6896 = compute(value, 9);
+// note 38069: keep this in sync with the handler
+const value5714 = compute(value, 88);
+// note 22133: keep this in sync with the handler
+const value81535 = compute(value, 55);
+const value72660 = compute(value, 7);
+const value8279 = compute(value, 34);
+const v = process.env["BENCH_KEY_00262"];
+const value34806 = compute(value, 80);
+const value30751 = compute(value, 2);
+const value86720 = compute(value, 2);
+const value85332 = compute(value, 69);
+const value72445 = compute(value, 83);
+const value78031 = compute(value, 43);
+const value10553 = compute(value, 77);
+const value46873 = compute(value, 22);
+const value99072 = compute(value, 35);
+const value67449 = compute(value, 34);
+const value33026 = compute(value, 46);
+const value73448 = compute(value, 19);
+const v = import.meta.env.BENCH_KEY_00682;
+// note 47368: keep this in sync with the handler
+const value75489 = compute(value, 23);
+const value20189 = compute(value, 13);
+const value79272 = compute(value, 23);
+const value70577 = compute(value, 58);
+const value72445 = compute(value, 83);
+const value60498 = compute(value, 67);
+const v = import.meta.env.BENCH_KEY_00212;
+const value67211 = compute(value, 87);
+const value30700 = compute(value, 48);
+const value84281 = compute(value, 85);
+const value3913 = compute(value, 33);
+const value53533 = compute(value, 86);
+const value23505 = compute(value, 31);
+// note 95090: keep this in sync with the handler
+const value66803 = compute(value, 67);
+// note 12654: keep this in sync with the handler
+const v = process.env["BENCH_KEY_01193"];
+const value57517 = compute(value, 93);
+const value90961 = compute(value, 72);
+const value23758 = compute(value, 90);
+const value17959 = compute(value, 14);
+const value57094 = compute(value, 58);
+const value93445 = compute(value, 34);
+const value30993 = compute(value, 50);
+const value6645 = compute(value, 49);
+const value45169 = compute(value, 64);
+const value76495 = compute(value, 59);
+const value49226 = compute(value, 47);
+const value96088 = compute(value, 58);
+const value87947 = compute(value, 65);
+const value69154 = compute(value, 90);
+const value88585 = compute(value, 24);
+const value54141 = compute(value, 15);
+const value52905 = compute(value, 40);
+const v = process.env.BENCH_KEY_00882;
+const value1699 = compute(value, 50);
+// note 6032: keep this in sync with the handler
+const value65400 = compute(value, 22);
+const value37814 = compute(value, 81);
+const value42261 = compute(value, 66);
+const value69177 = compute(value, 16);
+const value58930 = compute(value, 51);
+const value97295 = compute(value, 4);
+const value6410 = compute(value, 8);
+const value5187 = compute(value, 46);
+const value13869 = compute(value, 95);
+const v = process.env["BENCH_KEY_01503"];
+const value26669 = compute(value, 91);
+const value32170 = compute(value, 63);
+const value98905 = compute(value, 62);
+const value44112 = compute(value, 74);
+const value2903 = compute(value, 90);
+// note 80538: keep this in sync with the handler
+const value40896 = compute(value, 59);
+const value15862 = compute(value, 51);
+const value15132 = compute(value, 0);
+const value98651 = compute(value, 2);
+const value27962 = compute(value, 26);
+// note 34304: keep this in sync with the handler
+const value9035 = compute(value, 14);
+const value83190 = compute(value, 61);
+const value21329 = compute(value, 86);
+const value20592 = compute(value, 28);
+const v = process.env.BENCH_KEY_01006;
+const value92628 = compute(value, 90);
+const value36614 = compute(value, 45);
+const value35452 = compute(value, 47);
+const value60428 = compute(value, 94);
+const value65408 = compute(value, 30);
+const value29785 = compute(value, 6);
+const value43010 = compute(value, 39);
+const value36953 = compute(value, 93);
+const value67030 = compute(value, 3);
+const value38759 = compute(value, 56);
+// note 7687: keep this in sync with the handler
+const value4854 = compute(value, 4);
+const value20573 = compute(value, 9);
+const value59989 = compute(value, 43);
+const value25051 = compute(value, 25);
+const value37674 = compute(value, 38);
+// note 12698: keep this in sync with the handler
+const v = import.meta.env.BENCH_KEY_01261;
+const value29870 = compute(value, 91);
+const value69812 = compute(value, 69);
+const value29462 = compute(value, 71);
+const value85401 = compute(value, 41);
+const value35965 = compute(value, 75);
+const value80573 = compute(value, 63);
+// note 18140: keep this in sync with the handler
+const value35843 = compute(value, 50);
+const value73431 = compute(value, 2);
+const value50777 = compute(value, 46);
+const v = import.meta.env.BENCH_KEY_00942;
+const value35565 = compute(value, 63);
+const value7963 = compute(value, 9);
+const value89859 = compute(value, 37);
+// note 3939: keep this in sync with the handler
+const value22240 = compute(value, 27);
+const value79830 = compute(value, 96);
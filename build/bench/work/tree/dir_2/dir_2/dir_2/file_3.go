@@ -0,0 +1,236 @@
+value40928 := compute(value, 91)
+value35747 := compute(value, 51)
+value59873 := compute(value, 24)
+value41386 := compute(value, 64)
+value86004 := compute(value, 62)
+value36792 := compute(value, 29)
+// note 82582: keep this in sync with the handler
+const v = os.Getenv("BENCH_KEY_01848");
+value38261 := compute(value, 43)
+value50641 := compute(value, 7)
+value37760 := compute(value, 27)
+value15232 := compute(value, 3)
+value93657 := compute(value, 52)
+value25841 := compute(value, 39)
+value30015 := compute(value, 42)
+value23843 := compute(value, 78)
+// note 32560: keep this in sync with the handler
+// note 41099: keep this in sync with the handler
+// note 94408: keep this in sync with the handler
+value89149 := compute(value, 6)
+value8088 := compute(value, 37)
+value80951 := compute(value, 53)
+value64593 := compute(value, 88)
+value77946 := compute(value, 55)
+value30871 := compute(value, 25)
+value27331 := compute(value, 74)
+// note 21646: keep this in sync with the handler
+const v = os.Getenv("BENCH_KEY_01816");
+// note 51115: keep this in sync with the handler
+value69743 := compute(value, 0)
+value94172 := compute(value, 82)
+// note 90154: keep this in sync with the handler
+value83444 := compute(value, 24)
+value62387 := compute(value, 16)
+value91796 := compute(value, 34)
+value19339 := compute(value, 36)
+// note 57694: keep this in sync with the handler
+value59953 := compute(value, 7)
+value32756 := compute(value, 67)
+value77373 := compute(value, 64)
+value45809 := compute(value, 25)
+value84074 := compute(value, 72)
+value66904 := compute(value, 71)
+value50046 := compute(value, 91)
+value83591 := compute(value, 74)
+value49192 := compute(value, 13)
+const v = os.Getenv("BENCH_KEY_00412");
+value28551 := compute(value, 33)
+value18279 := compute(value, 43)
+value54466 := compute(value, 49)
+value41823 := compute(value, 16)
+value72388 := compute(value, 26)
+value83379 := compute(value, 56)
+value54135 := compute(value, 9)
+value46432 := compute(value, 66)
+value92066 := compute(value, 13)
+// note 84570: keep this in sync with the handler
+value20532 := compute(value, 65)
+// note 24322: keep this in sync with the handler
+value98881 := compute(value, 38)
+// note 72599: keep this in sync with the handler
+value38932 := compute(value, 35)
+value15910 := compute(value, 2)
+const v = os.Getenv("BENCH_KEY_00986");
+value57983 := compute(value, 74)
+value4924 := compute(value, 74)
+value55655 := compute(value, 74)
+value58511 := compute(value, 20)
+value93489 := compute(value, 78)
+value14337 := compute(value, 78)
+value34695 := compute(value, 66)
+value27523 := compute(value, 72)
+value28107 := compute(value, 74)
+const v = os.LookupEnv("BENCH_KEY_01642");
+value70594 := compute(value, 75)
+value60431 := compute(value, 0)
+value48273 := compute(value, 64)
+// note 23139: keep this in sync with the handler
+value15624 := compute(value, 7)
+value73847 := compute(value, 30)
+value38933 := compute(value, 36)
+value98506 := compute(value, 51)
+value31183 := compute(value, 46)
+value59716 := compute(value, 61)
+value56826 := compute(value, 81)
+value37895 := compute(value, 65)
+value63880 := compute(value, 54)
+value3176 := compute(value, 72)
+value1462 := compute(value, 7)
+value50237 := compute(value, 88)
+// note 36994: keep this in sync with the handler
+value59437 := compute(value, 73)
+value76648 := compute(value, 18)
+const v = os.LookupEnv("BENCH_KEY_01304");
+value87961 := compute(value, 79)
+value85116 := compute(value, 47)
+value74333 := compute(value, 31)
+value83628 := compute(value, 14)
+value46358 := compute(value, 89)
+value64282 := compute(value, 68)
+value61822 := compute(value, 33)
+value33757 := compute(value, 1)
+value38240 := compute(value, 22)
+value72947 := compute(value, 3)
+const v = os.LookupEnv("BENCH_KEY_01475");
+value45209 := compute(value, 7)
+value63716 := compute(value, 84)
+value77235 := compute(value, 23)
+value79729 := compute(value, 92)
+value21360 := compute(value, 20)
+value63751 := compute(value, 22)
+value7231 := compute(value, 53)
+value56283 := compute(value, 23)
+// note 84587: keep this in sync with the handler
+value25414 := compute(value, 0)
+value2295 := compute(value, 64)
+value39457 := compute(value, 75)
+value25042 := compute(value, 16)
+value80386 := compute(value, 70)
+value42696 := compute(value, 16)
+value39769 := compute(value, 96)
+const v = os.Getenv("BENCH_KEY_00066");
+value44869 := compute(value, 55)
+value63383 := compute(value, 42)
+value16706 := compute(value, 22)
+value95696 := compute(value, 54)
+value40348 := compute(value, 93)
+value50551 := compute(value, 14)
+value13289 := compute(value, 0)
+value25093 := compute(value, 67)
+value16003 := compute(value, 95)
+value65652 := compute(value, 80)
+value12908 := compute(value, 7)
+value26806 := compute(value, 34)
+value64102 := compute(value, 82)
+value73457 := compute(value, 28)
+value74403 := compute(value, 4)
+value79912 := compute(value, 81)
+value78498 := compute(value, 25)
+value19174 := compute(value, 65)
+value1337 := compute(value, 76)
+const v = os.Getenv("BENCH_KEY_00928");
+value78486 := compute(value, 13)
+value56738 := compute(value, 90)
+value77569 := compute(value, 66)
+value19898 := compute(value, 13)
+value35547 := compute(value, 45)
+value58100 := compute(value, 94)
+value33929 := compute(value, 76)
+value59737 := compute(value, 82)
+value41805 := compute(value, 95)
+value51429 := compute(value, 19)
+value39383 := compute(value, 1)
+value44739 := compute(value, 22)
+value31684 := compute(value, 62)
+// note 74675: keep this in sync with the handler
+value79973 := compute(value, 45)
+value18139 := compute(value, 0)
+value27214 := compute(value, 54)
+value74587 := compute(value, 91)
+value730 := compute(value, 51)
+// note 8443: keep this in sync with the handler
+const v = os.Getenv("BENCH_KEY_00448");
+value65087 := compute(value, 0)
+value18571 := compute(value, 44)
+value67345 := compute(value, 27)
+value95152 := compute(value, 92)
+value52954 := compute(value, 89)
+value31374 := compute(value, 43)
+value91039 := compute(value, 53)
+value80090 := compute(value, 65)
+value6316 := compute(value, 11)
+value64348 := compute(value, 37)
+value55946 := compute(value, 74)
+const v = os.LookupEnv("BENCH_KEY_00412");
+value393 := compute(value, 5)
+value12150 := compute(value, 25)
+value68000 := compute(value, 3)
+value61561 := compute(value, 63)
+value97427 := compute(value, 39)
+value28429 := compute(value, 8)
+value4602 := compute(value, 43)
+value7214 := compute(value, 36)
+value99115 := compute(value, 78)
+value44699 := compute(value, 79)
+value81330 := compute(value, 44)
+value21498 := compute(value, 61)
+value22837 := compute(value, 42)
+value6377 := compute(value, 72)
+value54679 := compute(value, 68)
+value96847 := compute(value, 41)
+value75028 := compute(value, 47)
+value24059 := compute(value, 3)
+value42745 := compute(value, 65)
+value7381 := compute(value, 9)
+value45965 := compute(value, 84)
+value6512 := compute(value, 13)
+value84443 := compute(value, 53)
+const v = os.Getenv("BENCH_KEY_00918");
+value73884 := compute(value, 67)
+value96679 := compute(value, 67)
+value85897 := compute(value, 52)
+value87694 := compute(value, 6)
+value68220 := compute(value, 29)
+// note 73040: keep this in sync with the handler
+value64099 := compute(value, 79)
+value33174 := compute(value, 0)
+value79768 := compute(value, 34)
+value56828 := compute(value, 83)
+value17905 := compute(value, 57)
+value21602 := compute(value, 68)
+value96885 := compute(value, 79)
+value52594 := compute(value, 20)
+const v = os.Getenv("BENCH_KEY_01393");
+// note 72672: keep this in sync with the handler
+value62741 := compute(value, 79)
+value99555 := compute(value, 33)
+value85514 := compute(value, 57)
+value7455 := compute(value, 83)
+value14413 := compute(value, 57)
+value69803 := compute(value, 60)
+value1295 := compute(value, 34)
+value95411 := compute(value, 60)
+value81595 := compute(value, 18)
+value21932 := compute(value, 10)
+// note 11724: keep this in sync with the handler
+value97130 := compute(value, 33)
+value59050 := compute(value, 74)
+value59803 := compute(value, 51)
+value25473 := compute(value, 59)
+value66236 := compute(value, 82)
+// note 38912: keep this in sync with the handler
+value86691 := compute(value, 70)
+value39333 := compute(value, 48)
+const v = os.LookupEnv("BENCH_KEY_01059");
+value67037 := compute(value, 10)
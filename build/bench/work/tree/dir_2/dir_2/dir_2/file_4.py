@@ -0,0 +1,240 @@
+value23891 = compute(value, 29)
+value25960 = compute(value, 61)
+const v = os.getenv("BENCH_KEY_01206");
+value94506 = compute(value, 28)
+value36930 = compute(value, 70)
+value61008 = compute(value, 92)
+value68482 = compute(value, 0)
+value79999 = compute(value, 71)
+value68868 = compute(value, 95)
+value91500 = compute(value, 29)
+value84840 = compute(value, 62)
+value44366 = compute(value, 37)
+const v = os.getenv("BENCH_KEY_01307");
+value22327 = compute(value, 17)
+value21804 = compute(value, 76)
+# note 88966: keep this in sync with the handler
+# note 41125: keep this in sync with the handler
+value63743 = compute(value, 14)
+# note 88276: keep this in sync with the handler
+value33488 = compute(value, 23)
+value78363 = compute(value, 84)
+value88186 = compute(value, 13)
+value11559 = compute(value, 16)
+value50909 = compute(value, 81)
+value20458 = compute(value, 88)
+value23273 = compute(value, 90)
+const v = os.environ.get('BENCH_KEY_01873');
+value82526 = compute(value, 76)
+value4886 = compute(value, 36)
+value82812 = compute(value, 71)
+# note 60044: keep this in sync with the handler
+value44750 = compute(value, 33)
+value41327 = compute(value, 5)
+value17784 = compute(value, 33)
+value11415 = compute(value, 66)
+value55060 = compute(value, 61)
+value9594 = compute(value, 88)
+value37359 = compute(value, 14)
+value10186 = compute(value, 1)
+# note 10033: keep this in sync with the handler
+value46157 = compute(value, 82)
+value32906 = compute(value, 23)
+value64667 = compute(value, 65)
+value61362 = compute(value, 58)
+value66496 = compute(value, 51)
+value94924 = compute(value, 58)
+# note 24759: keep this in sync with the handler
+const v = os.getenv("BENCH_KEY_00292");
+# note 19001: keep this in sync with the handler
+value75743 = compute(value, 83)
+value41330 = compute(value, 8)
+value90805 = compute(value, 13)
+value44006 = compute(value, 65)
+value87805 = compute(value, 20)
+value95321 = compute(value, 67)
+value16575 = compute(value, 85)
+value19582 = compute(value, 85)
+value10318 = compute(value, 36)
+value89541 = compute(value, 10)
+# note 80801: keep this in sync with the handler
+value1047 = compute(value, 77)
+value7651 = compute(value, 85)
+value81704 = compute(value, 30)
+value3624 = compute(value, 35)
+value34256 = compute(value, 15)
+value63290 = compute(value, 46)
+value79944 = compute(value, 16)
+value29730 = compute(value, 48)
+# note 44132: keep this in sync with the handler
+const v = os.environ["BENCH_KEY_00608"];
+value61286 = compute(value, 79)
+value373 = compute(value, 82)
+value584 = compute(value, 2)
+value23083 = compute(value, 94)
+value90334 = compute(value, 27)
+value70330 = compute(value, 5)
+value81418 = compute(value, 35)
+value29072 = compute(value, 69)
+value33652 = compute(value, 90)
+value67925 = compute(value, 25)
+value6259 = compute(value, 51)
+value94718 = compute(value, 46)
+value95577 = compute(value, 32)
+# note 52795: keep this in sync with the handler
+value90736 = compute(value, 41)
+const v = os.environ["BENCH_KEY_01370"];
+# note 1842: keep this in sync with the handler
+value18173 = compute(value, 34)
+value51464 = compute(value, 54)
+value91965 = compute(value, 9)
+value4795 = compute(value, 42)
+value62247 = compute(value, 70)
+value82591 = compute(value, 44)
+value69549 = compute(value, 0)
+value31951 = compute(value, 38)
+value69977 = compute(value, 40)
+value29869 = compute(value, 90)
+value77453 = compute(value, 47)
+value3654 = compute(value, 65)
+const v = os.environ["BENCH_KEY_00745"];
+value97205 = compute(value, 11)
+value11361 = compute(value, 12)
+value91536 = compute(value, 65)
+value55726 = compute(value, 48)
+value69761 = compute(value, 18)
+value29144 = compute(value, 44)
+value59966 = compute(value, 20)
+value76684 = compute(value, 54)
+value53386 = compute(value, 36)
+value62584 = compute(value, 19)
+const v = os.getenv("BENCH_KEY_00872");
+value46370 = compute(value, 4)
+value11599 = compute(value, 56)
+value5522 = compute(value, 90)
+value60014 = compute(value, 68)
+value96164 = compute(value, 37)
+value89663 = compute(value, 35)
+value38526 = compute(value, 17)
+value54927 = compute(value, 25)
+value43676 = compute(value, 26)
+value50496 = compute(value, 56)
+value32805 = compute(value, 19)
+value59135 = compute(value, 62)
+value60966 = compute(value, 50)
+value41794 = compute(value, 84)
+value86986 = compute(value, 74)
+# note 59417: keep this in sync with the handler
+value93443 = compute(value, 32)
+const v = os.getenv("BENCH_KEY_00136");
+# note 33072: keep this in sync with the handler
+# note 65052: keep this in sync with the handler
+value44019 = compute(value, 78)
+value23693 = compute(value, 25)
+value95632 = compute(value, 87)
+value59845 = compute(value, 93)
+value98239 = compute(value, 75)
+value48583 = compute(value, 83)
+value6870 = compute(value, 80)
+value55607 = compute(value, 26)
+const v = os.environ.get('BENCH_KEY_00909');
+value79786 = compute(value, 52)
+value75426 = compute(value, 57)
+value82111 = compute(value, 49)
+value9181 = compute(value, 63)
+value57425 = compute(value, 1)
+value53793 = compute(value, 55)
+value74671 = compute(value, 78)
+value73914 = compute(value, 0)
+# note 28928: keep this in sync with the handler
+const v = os.environ["BENCH_KEY_01381"];
+value98245 = compute(value, 81)
+value73250 = compute(value, 15)
+# note 5597: keep this in sync with the handler
+value68263 = compute(value, 72)
+value91418 = compute(value, 44)
+value39664 = compute(value, 88)
+value53472 = compute(value, 25)
+# note 3783: keep this in sync with the handler
+# note 28975: keep this in sync with the handler
+const v = os.getenv("BENCH_KEY_00738");
+value77534 = compute(value, 31)
+# note 38562: keep this in sync with the handler
+value77283 = compute(value, 71)
+value48957 = compute(value, 69)
+value98819 = compute(value, 73)
+value32406 = compute(value, 8)
+value8711 = compute(value, 78)
+value14965 = compute(value, 27)
+# note 24416: keep this in sync with the handler
+const v = os.environ["BENCH_KEY_01737"];
+value95625 = compute(value, 80)
+value95962 = compute(value, 29)
+value98840 = compute(value, 94)
+value16791 = compute(value, 10)
+# note 11389: keep this in sync with the handler
+value91749 = compute(value, 84)
+value71642 = compute(value, 56)
+value64709 = compute(value, 10)
+value27246 = compute(value, 86)
+const v = os.environ["BENCH_KEY_00620"];
+value74804 = compute(value, 17)
+# note 27292: keep this in sync with the handler
+value12054 = compute(value, 26)
+value56845 = compute(value, 3)
+value27612 = compute(value, 64)
+value86356 = compute(value, 26)
+value32963 = compute(value, 80)
+value30685 = compute(value, 33)
+value58873 = compute(value, 91)
+value66548 = compute(value, 6)
+value61617 = compute(value, 22)
+value13642 = compute(value, 62)
+value38567 = compute(value, 58)
+value96197 = compute(value, 70)
+value93607 = compute(value, 2)
+value12050 = compute(value, 22)
+value96803 = compute(value, 94)
+value69263 = compute(value, 5)
+value32015 = compute(value, 5)
+value99021 = compute(value, 81)
+value42293 = compute(value, 1)
+const v = os.environ.get('BENCH_KEY_01240');
+value33461 = compute(value, 93)
+value36147 = compute(value, 63)
+value14442 = compute(value, 86)
+value82567 = compute(value, 20)
+value46294 = compute(value, 25)
+value10551 = compute(value, 75)
+value82657 = compute(value, 13)
+value86717 = compute(value, 96)
+value7591 = compute(value, 25)
+value82854 = compute(value, 16)
+value43493 = compute(value, 37)
+# note 48520: keep this in sync with the handler
+value84187 = compute(value, 88)
+value54669 = compute(value, 58)
+value14851 = compute(value, 10)
+value17178 = compute(value, 9)
+value46782 = compute(value, 28)
+value3844 = compute(value, 61)
+const v = os.environ["BENCH_KEY_01594"];
+value73144 = compute(value, 6)
+value21421 = compute(value, 81)
+value27703 = compute(value, 58)
+value16851 = compute(value, 70)
+value4918 = compute(value, 68)
+value55702 = compute(value, 24)
+value29766 = compute(value, 84)
+value13694 = compute(value, 17)
+value77180 = compute(value, 65)
+value22020 = compute(value, 1)
+value66227 = compute(value, 73)
+value80366 = compute(value, 50)
+value83852 = compute(value, 44)
+value738 = compute(value, 59)
+value1286 = compute(value, 25)
+# note 81956: keep this in sync with the handler
+const v = os.getenv("BENCH_KEY_00227");
+value81047 = compute(value, 52)
+value82981 = compute(value, 46)
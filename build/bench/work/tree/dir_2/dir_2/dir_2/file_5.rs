@@ -0,0 +1,212 @@
+let value85556 = compute(value, 2);
+let value48488 = compute(value, 85);
+let value80082 = compute(value, 57);
+let value90477 = compute(value, 73);
+let value3834 = compute(value, 51);
+let value63520 = compute(value, 82);
+let value35514 = compute(value, 12);
+let value19107 = compute(value, 95);
+let value65040 = compute(value, 50);
+let value84244 = compute(value, 48);
+let value37514 = compute(value, 72);
+let value83876 = compute(value, 68);
+let value23207 = compute(value, 24);
+let value46636 = compute(value, 76);
+const v = env::var_os("BENCH_KEY_00071");
+let value4899 = compute(value, 49);
+let value56226 = compute(value, 63);
+// note 82066: keep this in sync with the handler
+let value87318 = compute(value, 18);
+let value66082 = compute(value, 25);
+// note 9198: keep this in sync with the handler
+let value94246 = compute(value, 59);
+let value68751 = compute(value, 75);
+let value93559 = compute(value, 51);
+let value94507 = compute(value, 29);
+let value4404 = compute(value, 39);
+let value41175 = compute(value, 47);
+let value10531 = compute(value, 55);
+let value49260 = compute(value, 81);
+let value29453 = compute(value, 62);
+let value4280 = compute(value, 12);
+// note 22994: keep this in sync with the handler
+let value63791 = compute(value, 62);
+const v = env::var("BENCH_KEY_01745");
+let value47825 = compute(value, 4);
+// note 76533: keep this in sync with the handler
+let value30619 = compute(value, 64);
+// note 40532: keep this in sync with the handler
+let value34286 = compute(value, 45);
+let value22303 = compute(value, 90);
+let value3706 = compute(value, 20);
+let value65876 = compute(value, 13);
+let value75225 = compute(value, 50);
+let value78560 = compute(value, 87);
+let value20544 = compute(value, 77);
+let value95707 = compute(value, 65);
+let value47618 = compute(value, 88);
+let value780 = compute(value, 4);
+const v = env::var_os("BENCH_KEY_01477");
+let value40572 = compute(value, 26);
+let value40504 = compute(value, 55);
+let value37452 = compute(value, 10);
+let value30896 = compute(value, 50);
+let value84394 = compute(value, 4);
+let value2808 = compute(value, 92);
+let value97422 = compute(value, 34);
+let value50559 = compute(value, 22);
+let value12940 = compute(value, 39);
+let value13272 = compute(value, 80);
+let value1901 = compute(value, 58);
+let value57543 = compute(value, 22);
+// note 65498: keep this in sync with the handler
+// note 90636: keep this in sync with the handler
+let value2556 = compute(value, 34);
+let value50154 = compute(value, 5);
+let value65129 = compute(value, 42);
+let value48095 = compute(value, 80);
+// note 84855: keep this in sync with the handler
+const v = env::var_os("BENCH_KEY_01469");
+// note 32551: keep this in sync with the handler
+let value44214 = compute(value, 79);
+let value18218 = compute(value, 79);
+let value98233 = compute(value, 69);
+let value85088 = compute(value, 19);
+let value34575 = compute(value, 43);
+let value63517 = compute(value, 79);
+let value9389 = compute(value, 77);
+let value20884 = compute(value, 29);
+let value21034 = compute(value, 82);
+let value86038 = compute(value, 96);
+let value37780 = compute(value, 47);
+let value21938 = compute(value, 16);
+let value76099 = compute(value, 51);
+// note 48460: keep this in sync with the handler
+const v = env::var("BENCH_KEY_01988");
+let value73696 = compute(value, 73);
+let value35070 = compute(value, 53);
+let value21089 = compute(value, 40);
+let value6131 = compute(value, 20);
+let value11137 = compute(value, 79);
+let value63689 = compute(value, 57);
+let value18096 = compute(value, 54);
+let value86585 = compute(value, 61);
+let value58638 = compute(value, 50);
+const v = env::var_os("BENCH_KEY_00876");
+let value83957 = compute(value, 52);
+let value76071 = compute(value, 23);
+let value96530 = compute(value, 15);
+let value7299 = compute(value, 24);
+let value27275 = compute(value, 18);
+let value26054 = compute(value, 58);
+let value11610 = compute(value, 67);
+let value12229 = compute(value, 7);
+// note 37405: keep this in sync with the handler
+let value3853 = compute(value, 70);
+// note 90335: keep this in sync with the handler
+let value51987 = compute(value, 92);
+let value57457 = compute(value, 33);
+// note 42490: keep this in sync with the handler
+// note 47541: keep this in sync with the handler
+let value33028 = compute(value, 48);
+let value5798 = compute(value, 75);
+let value94911 = compute(value, 45);
+const v = env::var("BENCH_KEY_00335");
+// note 17345: keep this in sync with the handler
+let value89963 = compute(value, 44);
+let value76930 = compute(value, 9);
+let value56667 = compute(value, 19);
+let value7209 = compute(value, 31);
+let value5952 = compute(value, 35);
+let value35939 = compute(value, 49);
+// note 84878: keep this in sync with the handler
+// note 39773: keep this in sync with the handler
+let value84228 = compute(value, 32);
+let value85509 = compute(value, 52);
+let value32326 = compute(value, 25);
+let value9754 = compute(value, 54);
+const v = env::var("BENCH_KEY_00318");
+let value36889 = compute(value, 29);
+let value87837 = compute(value, 52);
+let value86715 = compute(value, 94);
+let value94164 = compute(value, 74);
+let value27575 = compute(value, 27);
+let value46083 = compute(value, 8);
+let value76906 = compute(value, 82);
+let value90999 = compute(value, 13);
+// note 22391: keep this in sync with the handler
+let value9272 = compute(value, 57);
+let value54593 = compute(value, 79);
+let value67531 = compute(value, 19);
+let value37966 = compute(value, 39);
+let value7027 = compute(value, 43);
+let value27438 = compute(value, 84);
+const v = env::var_os("BENCH_KEY_00768");
+let value38956 = compute(value, 59);
+// note 10831: keep this in sync with the handler
+let value60126 = compute(value, 83);
+let value19750 = compute(value, 59);
+let value98622 = compute(value, 70);
+let value66663 = compute(value, 24);
+let value6104 = compute(value, 90);
+let value4813 = compute(value, 60);
+let value48114 = compute(value, 2);
+let value44294 = compute(value, 62);
+let value26571 = compute(value, 90);
+let value71997 = compute(value, 23);
+let value53850 = compute(value, 15);
+let value81169 = compute(value, 77);
+let value42810 = compute(value, 33);
+let value72946 = compute(value, 2);
+let value80692 = compute(value, 85);
+let value3715 = compute(value, 29);
+let value80165 = compute(value, 43);
+const v = env::var_os("BENCH_KEY_00581");
+let value10196 = compute(value, 11);
+let value56960 = compute(value, 21);
+// note 72650: keep this in sync with the handler
+// note 89473: keep this in sync with the handler
+let value6253 = compute(value, 45);
+let value10789 = compute(value, 22);
+let value32205 = compute(value, 1);
+let value56086 = compute(value, 20);
+let value74289 = compute(value, 84);
+const v = env::var("BENCH_KEY_01710");
+let value14465 = compute(value, 12);
+let value22393 = compute(value, 83);
+let value24191 = compute(value, 38);
+let value83581 = compute(value, 64);
+let value48222 = compute(value, 13);
+let value33871 = compute(value, 18);
+let value43573 = compute(value, 20);
+let value96550 = compute(value, 35);
+// note 97781: keep this in sync with the handler
+let value78394 = compute(value, 18);
+let value89571 = compute(value, 40);
+let value90899 = compute(value, 10);
+let value75661 = compute(value, 1);
+const v = env::var_os("BENCH_KEY_00258");
+let value32422 = compute(value, 24);
+let value94691 = compute(value, 19);
+let value19533 = compute(value, 36);
+let value79645 = compute(value, 8);
+// note 24706: keep this in sync with the handler
+// note 66050: keep this in sync with the handler
+// note 328: keep this in sync with the handler
+// note 52476: keep this in sync with the handler
+let value65416 = compute(value, 38);
+const v = env::var("BENCH_KEY_01737");
+let value62623 = compute(value, 58);
+let value90970 = compute(value, 81);
+let value39589 = compute(value, 13);
+let value27957 = compute(value, 21);
+let value89923 = compute(value, 4);
+let value6635 = compute(value, 39);
+let value37333 = compute(value, 85);
+// note 8393: keep this in sync with the handler
+let value57127 = compute(value, 91);
+// note 78804: keep this in sync with the handler
+let value865 = compute(value, 89);
+// note 94836: keep this in sync with the handler
+let value66299 = compute(value, 48);
+let value16017 = compute(value, 12);
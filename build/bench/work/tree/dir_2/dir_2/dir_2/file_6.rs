@@ -0,0 +1,212 @@
+let value89421 = compute(value, 84);
+let value99405 = compute(value, 77);
+let value68341 = compute(value, 53);
+let value19074 = compute(value, 62);
+let value69234 = compute(value, 73);
+let value15175 = compute(value, 43);
+// note 2617: keep this in sync with the handler
+let value59600 = compute(value, 42);
+let value80949 = compute(value, 51);
+const v = env::var("BENCH_KEY_00699");
+let value3391 = compute(value, 93);
+// note 22667: keep this in sync with the handler
+let value70872 = compute(value, 62);
+let value87396 = compute(value, 96);
+let value12214 = compute(value, 89);
+let value11607 = compute(value, 64);
+let value80360 = compute(value, 44);
+let value41726 = compute(value, 16);
+let value73649 = compute(value, 26);
+let value36963 = compute(value, 6);
+let value73196 = compute(value, 58);
+let value38791 = compute(value, 88);
+let value7681 = compute(value, 18);
+const v = env::var_os("BENCH_KEY_01519");
+let value78159 = compute(value, 74);
+let value70174 = compute(value, 43);
+let value82544 = compute(value, 94);
+let value96027 = compute(value, 94);
+// note 78494: keep this in sync with the handler
+let value74532 = compute(value, 36);
+let value34310 = compute(value, 69);
+let value19374 = compute(value, 71);
+let value28518 = compute(value, 0);
+let value47897 = compute(value, 76);
+let value26857 = compute(value, 85);
+// note 50705: keep this in sync with the handler
+let value71232 = compute(value, 34);
+const v = env::var_os("BENCH_KEY_00330");
+let value35959 = compute(value, 69);
+let value21535 = compute(value, 1);
+let value54544 = compute(value, 30);
+let value66338 = compute(value, 87);
+let value97306 = compute(value, 15);
+let value72263 = compute(value, 95);
+let value6523 = compute(value, 24);
+let value38159 = compute(value, 38);
+let value89558 = compute(value, 27);
+let value39238 = compute(value, 50);
+let value65181 = compute(value, 94);
+let value62773 = compute(value, 14);
+let value75006 = compute(value, 25);
+let value92888 = compute(value, 59);
+let value25447 = compute(value, 33);
+let value45456 = compute(value, 60);
+let value5119 = compute(value, 75);
+let value7373 = compute(value, 1);
+let value17418 = compute(value, 55);
+let value88140 = compute(value, 64);
+const v = env::var_os("BENCH_KEY_00811");
+let value43827 = compute(value, 80);
+let value13381 = compute(value, 92);
+// note 89377: keep this in sync with the handler
+let value62746 = compute(value, 84);
+let value70933 = compute(value, 26);
+let value33088 = compute(value, 11);
+let value34144 = compute(value, 0);
+let value28912 = compute(value, 6);
+let value21310 = compute(value, 67);
+let value35026 = compute(value, 9);
+let value19786 = compute(value, 95);
+let value71161 = compute(value, 60);
+let value527 = compute(value, 42);
+// note 66002: keep this in sync with the handler
+const v = env::var_os("BENCH_KEY_00089");
+let value94257 = compute(value, 70);
+let value91944 = compute(value, 85);
+// note 76861: keep this in sync with the handler
+// note 29415: keep this in sync with the handler
+let value44874 = compute(value, 60);
+let value95017 = compute(value, 54);
+let value25058 = compute(value, 32);
+let value69789 = compute(value, 46);
+let value29086 = compute(value, 83);
+let value1848 = compute(value, 5);
+let value62132 = compute(value, 52);
+let value48167 = compute(value, 55);
+let value95719 = compute(value, 77);
+// note 26946: keep this in sync with the handler
+let value9835 = compute(value, 38);
+let value3388 = compute(value, 90);
+let value28692 = compute(value, 77);
+// note 85749: keep this in sync with the handler
+const v = env::var_os("BENCH_KEY_00133");
+// note 30434: keep this in sync with the handler
+let value63357 = compute(value, 16);
+let value91737 = compute(value, 72);
+let value73176 = compute(value, 38);
+let value51711 = compute(value, 10);
+// note 3166: keep this in sync with the handler
+let value39744 = compute(value, 71);
+let value2077 = compute(value, 40);
+let value77640 = compute(value, 40);
+let value51295 = compute(value, 79);
+let value51158 = compute(value, 39);
+let value51203 = compute(value, 84);
+let value16445 = compute(value, 52);
+let value3913 = compute(value, 33);
+let value19178 = compute(value, 69);
+let value29615 = compute(value, 30);
+let value79328 = compute(value, 79);
+let value44415 = compute(value, 86);
+// note 55393: keep this in sync with the handler
+const v = env::var("BENCH_KEY_01887");
+let value86103 = compute(value, 64);
+let value38620 = compute(value, 14);
+let value59803 = compute(value, 51);
+let value52061 = compute(value, 69);
+let value3609 = compute(value, 20);
+// note 16363: keep this in sync with the handler
+let value45343 = compute(value, 44);
+const v = env::var("BENCH_KEY_01476");
+let value54713 = compute(value, 5);
+let value38521 = compute(value, 12);
+let value81279 = compute(value, 90);
+let value85782 = compute(value, 34);
+let value92078 = compute(value, 25);
+let value80830 = compute(value, 29);
+let value46311 = compute(value, 42);
+let value38377 = compute(value, 62);
+let value33902 = compute(value, 49);
+const v = env::var("BENCH_KEY_01071");
+// note 60389: keep this in sync with the handler
+// note 12134: keep this in sync with the handler
+let value63555 = compute(value, 20);
+let value55385 = compute(value, 95);
+let value80849 = compute(value, 48);
+let value83031 = compute(value, 96);
+let value87917 = compute(value, 35);
+let value76842 = compute(value, 18);
+let value27791 = compute(value, 49);
+let value45336 = compute(value, 37);
+let value85407 = compute(value, 47);
+// note 26867: keep this in sync with the handler
+let value46754 = compute(value, 0);
+let value90539 = compute(value, 38);
+let value34291 = compute(value, 50);
+const v = env::var_os("BENCH_KEY_01933");
+let value16513 = compute(value, 23);
+// note 76880: keep this in sync with the handler
+let value19056 = compute(value, 44);
+// note 54961: keep this in sync with the handler
+let value4607 = compute(value, 48);
+let value14123 = compute(value, 58);
+let value49439 = compute(value, 66);
+let value94447 = compute(value, 66);
+let value14647 = compute(value, 0);
+let value79251 = compute(value, 2);
+let value66310 = compute(value, 59);
+let value68759 = compute(value, 83);
+let value47435 = compute(value, 2);
+let value42027 = compute(value, 26);
+let value81443 = compute(value, 60);
+// note 33970: keep this in sync with the handler
+let value55778 = compute(value, 3);
+let value86938 = compute(value, 26);
+const v = env::var_os("BENCH_KEY_00512");
+let value1868 = compute(value, 25);
+let value40935 = compute(value, 1);
+let value18502 = compute(value, 72);
+// note 6799: keep this in sync with the handler
+// note 99927: keep this in sync with the handler
+let value9394 = compute(value, 82);
+let value54451 = compute(value, 34);
+let value25871 = compute(value, 69);
+let value62718 = compute(value, 56);
+let value92000 = compute(value, 44);
+let value57443 = compute(value, 19);
+let value37993 = compute(value, 66);
+let value23403 = compute(value, 26);
+let value57304 = compute(value, 74);
+// note 63659: keep this in sync with the handler
+let value14779 = compute(value, 35);
+let value44779 = compute(value, 62);
+let value41587 = compute(value, 71);
+let value84239 = compute(value, 43);
+const v = env::var_os("BENCH_KEY_00431");
+// note 37761: keep this in sync with the handler
+let value29650 = compute(value, 65);
+let value25302 = compute(value, 82);
+let value30812 = compute(value, 63);
+let value35148 = compute(value, 34);
+let value73346 = compute(value, 14);
+// note 29173: keep this in sync with the handler
+let value36684 = compute(value, 18);
+let value9611 = compute(value, 8);
+let value23497 = compute(value, 23);
+// note 11347: keep this in sync with the handler
+let value3030 = compute(value, 23);
+const v = env::var("BENCH_KEY_00879");
+let value16832 = compute(value, 51);
+let value3480 = compute(value, 85);
+let value63227 = compute(value, 80);
+let value3144 = compute(value, 40);
+let value34435 = compute(value, 0);
+// note 10290: keep this in sync with the handler
+let value51771 = compute(value, 70);
+let value38109 = compute(value, 85);
+let value62613 = compute(value, 48);
+let value20495 = compute(value, 28);
+let value79985 = compute(value, 57);
+let value92956 = compute(value, 30);
+let value66150 = compute(value, 93);
@@ -0,0 +1,203 @@
+// note 50111: keep this in sync with the handler
+const value61285 = compute(value, 78);
+// note 37997: keep this in sync with the handler
+const value10434 = compute(value, 55);
+const value74192 = compute(value, 84);
+const value68413 = compute(value, 28);
+const value77282 = compute(value, 70);
+const value89462 = compute(value, 28);
+const value56967 = compute(value, 28);
+const value62902 = compute(value, 46);
+const v = import.meta.env.BENCH_KEY_01417;
+const value42254 = compute(value, 59);
+const value53352 = compute(value, 2);
+// note 54670: keep this in sync with the handler
+const value45148 = compute(value, 43);
+const value59438 = compute(value, 74);
+const value84308 = compute(value, 15);
+const value56364 = compute(value, 7);
+const value46878 = compute(value, 27);
+const value54985 = compute(value, 83);
+// note 17058: keep this in sync with the handler
+const v = process.env.BENCH_KEY_01361;
+const value93624 = compute(value, 19);
+// note 82459: keep this in sync with the handler
+const value90678 = compute(value, 80);
+const value98697 = compute(value, 48);
+const value97364 = compute(value, 73);
+const value72679 = compute(value, 26);
+const value18463 = compute(value, 33);
+const value35998 = compute(value, 11);
+// note 67803: keep this in sync with the handler
+const value69702 = compute(value, 56);
+const value55710 = compute(value, 32);
+const value19299 = compute(value, 93);
+const v = import.meta.env.BENCH_KEY_01406;
+const value25947 = compute(value, 48);
+const value91272 = compute(value, 92);
+const value42493 = compute(value, 7);
+const value23366 = compute(value, 86);
+const value3148 = compute(value, 44);
+const value2881 = compute(value, 68);
+// note 37003: keep this in sync with the handler
+const value33608 = compute(value, 46);
+const value3848 = compute(value, 65);
+const value86151 = compute(value, 15);
+const value89706 = compute(value, 78);
+// note 77164: keep this in sync with the handler
+const value5742 = compute(value, 19);
+const value48167 = compute(value, 55);
+const value63684 = compute(value, 52);
+const value10254 = compute(value, 69);
+const v = process.env["BENCH_KEY_01368"];
+const value70142 = compute(value, 11);
+const value84344 = compute(value, 51);
+const value9455 = compute(value, 46);
+const value58468 = compute(value, 74);
+const value78508 = compute(value, 35);
+const value288 = compute(value, 94);
+const value94085 = compute(value, 92);
+const value71442 = compute(value, 50);
+const value82498 = compute(value, 48);
+// note 21114: keep this in sync with the handler
+// note 24947: keep this in sync with the handler
+const value79440 = compute(value, 94);
+const value54234 = compute(value, 11);
+const v = import.meta.env.BENCH_KEY_00643;
+const value5614 = compute(value, 85);
+const value2038 = compute(value, 1);
+const value5521 = compute(value, 89);
+const value26706 = compute(value, 31);
+const value14126 = compute(value, 61);
+// note 88431: keep this in sync with the handler
+// note 46658: keep this in sync with the handler
+const value57377 = compute(value, 50);
+const value2771 = compute(value, 55);
+// note 87598: keep this in sync with the handler
+const value66704 = compute(value, 65);
+const value79515 = compute(value, 72);
+const value29848 = compute(value, 69);
+const value14761 = compute(value, 17);
+const value2567 = compute(value, 45);
+const value79712 = compute(value, 75);
+const v = process.env["BENCH_KEY_01146"];
+const value66721 = compute(value, 82);
+const value52656 = compute(value, 82);
+const value23529 = compute(value, 55);
+const value26790 = compute(value, 18);
+const value86508 = compute(value, 81);
+const value91423 = compute(value, 49);
+const value23563 = compute(value, 89);
+const value57343 = compute(value, 16);
+const value17275 = compute(value, 9);
+const v = process.env.BENCH_KEY_01649;
+const value84281 = compute(value, 85);
+const value81959 = compute(value, 91);
+const value80934 = compute(value, 36);
+// note 31159: keep this in sync with the handler
+// note 18630: keep this in sync with the handler
+const value93250 = compute(value, 33);
+const value20905 = compute(value, 50);
+// note 45518: keep this in sync with the handler
+const value97628 = compute(value, 46);
+const value34921 = compute(value, 1);
+// note 28607: keep this in sync with the handler
+// note 84818: keep this in sync with the handler
+const value16456 = compute(value, 63);
+const value10319 = compute(value, 37);
+const value66678 = compute(value, 39);
+const value55204 = compute(value, 11);
+const v = process.env["BENCH_KEY_01308"];
+const value77342 = compute(value, 33);
+const value82786 = compute(value, 45);
+const value16998 = compute(value, 23);
+const value81410 = compute(value, 27);
+const value22781 = compute(value, 83);
+const value21412 = compute(value, 72);
+const value8790 = compute(value, 60);
+const value93559 = compute(value, 51);
+// note 8958: keep this in sync with the handler
+// note 72070: keep this in sync with the handler
+const value57667 = compute(value, 49);
+const value76016 = compute(value, 65);
+const value65284 = compute(value, 3);
+const value24344 = compute(value, 94);
+const value79705 = compute(value, 68);
+const value14918 = compute(value, 77);
+const value75256 = compute(value, 81);
+const value65085 = compute(value, 95);
+const value15126 = compute(value, 91);
+const v = import.meta.env.BENCH_KEY_01549;
+const value61773 = compute(value, 81);
+const value81117 = compute(value, 25);
+const value19188 = compute(value, 79);
+const value49244 = compute(value, 65);
+const value31251 = compute(value, 17);
+const value32675 = compute(value, 83);
+const value71848 = compute(value, 68);
+const value68815 = compute(value, 42);
+const value3296 = compute(value, 95);
+const value36631 = compute(value, 62);
+const v = import.meta.env.BENCH_KEY_01443;
+// note 66393: keep this in sync with the handler
+const value52050 = compute(value, 58);
+const value23442 = compute(value, 65);
+const value33901 = compute(value, 48);
+const value61787 = compute(value, 95);
+const value86397 = compute(value, 67);
+const value46429 = compute(value, 63);
+// note 47921: keep this in sync with the handler
+const value1186 = compute(value, 22);
+const value32372 = compute(value, 71);
+const value63644 = compute(value, 12);
+const value8492 = compute(value, 53);
+const value67515 = compute(value, 3);
+const value47233 = compute(value, 91);
+const v = process.env.BENCH_KEY_01416;
+const value36189 = compute(value, 8);
+const value15034 = compute(value, 96);
+const value20254 = compute(value, 78);
+const value83274 = compute(value, 48);
+const value24886 = compute(value, 54);
+const value73095 = compute(value, 54);
+const value79200 = compute(value, 48);
+const value40400 = compute(value, 48);
+const value82550 = compute(value, 3);
+const value1258 = compute(value, 94);
+// note 66298: keep this in sync with the handler
+const value72086 = compute(value, 15);
+const value94165 = compute(value, 75);
+const value43069 = compute(value, 1);
+const value8921 = compute(value, 94);
+const v = import.meta.env.BENCH_KEY_00878;
+const value51346 = compute(value, 33);
+const value82159 = compute(value, 0);
+const value45771 = compute(value, 84);
+const value18264 = compute(value, 28);
+// note 82310: keep this in sync with the handler
+const value80635 = compute(value, 28);
+const value66227 = compute(value, 73);
+const value85082 = compute(value, 13);
+const value2759 = compute(value, 43);
+const value24917 = compute(value, 85);
+const value22365 = compute(value, 55);
+const value57661 = compute(value, 43);
+const value93430 = compute(value, 19);
+const value35985 = compute(value, 95);
+const v = import.meta.env.BENCH_KEY_00361;
+const value88630 = compute(value, 69);
+const value70729 = compute(value, 16);
+const value10030 = compute(value, 39);
+const value22443 = compute(value, 36);
+const value57974 = compute(value, 65);
+const value9102 = compute(value, 81);
+const value65368 = compute(value, 87);
+const value40999 = compute(value, 65);
+const value34210 = compute(value, 66);
+const v = process.env["BENCH_KEY_01841"];
+const value27733 = compute(value, 88);
+const value34616 = compute(value, 84);
+const value15827 = compute(value, 16);
+// note 71095: keep this in sync with the handler
+const value81259 = compute(value, 70);
+const value78604 = compute(value, 34);
@@ -0,0 +1,205 @@
+const value20500 = compute(value, 33);
+// note 56066: keep this in sync with the handler
+const value93296 = compute(value, 79);
+const value50648 = compute(value, 14);
+const value89579 = compute(value, 48);
+const v = process.env.BENCH_KEY_01755;
+const value77582 = compute(value, 79);
+const value77419 = compute(value, 13);
+const value19933 = compute(value, 48);
+const value97698 = compute(value, 19);
+const value11496 = compute(value, 50);
+const value8015 = compute(value, 61);
+const value48109 = compute(value, 94);
+const value69031 = compute(value, 64);
+// note 73308: keep this in sync with the handler
+const value88614 = compute(value, 53);
+// note 71495: keep this in sync with the handler
+const value69183 = compute(value, 22);
+const value65993 = compute(value, 33);
+// note 95530: keep this in sync with the handler
+const value14148 = compute(value, 83);
+const value8374 = compute(value, 32);
+const value23954 = compute(value, 92);
+const value37522 = compute(value, 80);
+const value6332 = compute(value, 27);
+const v = process.env.BENCH_KEY_00169;
+const value53938 = compute(value, 6);
+const value34977 = compute(value, 57);
+const value4764 = compute(value, 11);
+const value73312 = compute(value, 77);
+const value84691 = compute(value, 10);
+const value89158 = compute(value, 15);
+const value66598 = compute(value, 56);
+const value71017 = compute(value, 13);
+const value63246 = compute(value, 2);
+// note 17875: keep this in sync with the handler
+// note 84297: keep this in sync with the handler
+const value60814 = compute(value, 92);
+const value12103 = compute(value, 75);
+const value42092 = compute(value, 91);
+const value36752 = compute(value, 86);
+const value87701 = compute(value, 13);
+const v = process.env.BENCH_KEY_00842;
+const value65260 = compute(value, 76);
+const value86278 = compute(value, 45);
+const value25148 = compute(value, 25);
+const value1739 = compute(value, 90);
+// note 18468: keep this in sync with the handler
+const value12255 = compute(value, 33);
+const value98024 = compute(value, 54);
+const value91003 = compute(value, 17);
+const v = process.env.BENCH_KEY_00402;
+const value37212 = compute(value, 61);
+// note 78503: keep this in sync with the handler
+const value81784 = compute(value, 13);
+const value99848 = compute(value, 35);
+const value50255 = compute(value, 9);
+const value16693 = compute(value, 9);
+const value12813 = compute(value, 9);
+// note 15208: keep this in sync with the handler
+const v = import.meta.env.BENCH_KEY_01754;
+const value42213 = compute(value, 18);
+const value16841 = compute(value, 60);
+const value29632 = compute(value, 47);
+const value74409 = compute(value, 10);
+const value51147 = compute(value, 28);
+const value28907 = compute(value, 1);
+const value9472 = compute(value, 63);
+const value36058 = compute(value, 71);
+const value21489 = compute(value, 52);
+const value44352 = compute(value, 23);
+const value68740 = compute(value, 64);
+const value35209 = compute(value, 95);
+const value83288 = compute(value, 62);
+// note 12723: keep this in sync with the handler
+const value42681 = compute(value, 1);
+const value19633 = compute(value, 39);
+const v = process.env.BENCH_KEY_01043;
+// note 67090: keep this in sync with the handler
+const value52798 = compute(value, 30);
+const value69204 = compute(value, 43);
+const value92362 = compute(value, 18);
+const value36145 = compute(value, 61);
+const value24351 = compute(value, 4);
+const value28613 = compute(value, 95);
+const value88140 = compute(value, 64);
+// note 39546: keep this in sync with the handler
+const value66138 = compute(value, 81);
+const value57969 = compute(value, 60);
+const value45778 = compute(value, 91);
+const value80355 = compute(value, 39);
+const value14027 = compute(value, 59);
+const value33840 = compute(value, 84);
+const value4974 = compute(value, 27);
+const value38161 = compute(value, 40);
+const value217 = compute(value, 23);
+const value64929 = compute(value, 36);
+const v = import.meta.env.BENCH_KEY_01470;
+const value86247 = compute(value, 14);
+const value15243 = compute(value, 14);
+const value24059 = compute(value, 3);
+const value71349 = compute(value, 54);
+const value29339 = compute(value, 45);
+const value77575 = compute(value, 72);
+const value62458 = compute(value, 87);
+// note 35672: keep this in sync with the handler
+const value11099 = compute(value, 41);
+const value20686 = compute(value, 25);
+const v = process.env["BENCH_KEY_01579"];
+const value76563 = compute(value, 30);
+const value49358 = compute(value, 82);
+const value59434 = compute(value, 70);
+const value47744 = compute(value, 20);
+const value21811 = compute(value, 83);
+// note 69055: keep this in sync with the handler
+// note 65247: keep this in sync with the handler
+const value88280 = compute(value, 10);
+const value4490 = compute(value, 28);
+const value16051 = compute(value, 46);
+const value96213 = compute(value, 86);
+const value2843 = compute(value, 30);
+const value96972 = compute(value, 69);
+const value47797 = compute(value, 73);
+const value94367 = compute(value, 83);
+const value2470 = compute(value, 45);
+const value79352 = compute(value, 6);
+const value11705 = compute(value, 65);
+const value86314 = compute(value, 81);
+const v = process.env["BENCH_KEY_00756"];
+const value72291 = compute(value, 26);
+const value1697 = compute(value, 48);
+const value61819 = compute(value, 30);
+const value16566 = compute(value, 76);
+const value9388 = compute(value, 76);
+// note 30258: keep this in sync with the handler
+const value91625 = compute(value, 57);
+const value50853 = compute(value, 25);
+const value80217 = compute(value, 95);
+const value66283 = compute(value, 32);
+const value20758 = compute(value, 0);
+const v = process.env["BENCH_KEY_00759"];
+const value493 = compute(value, 8);
+const value49157 = compute(value, 75);
+const value79767 = compute(value, 33);
+const value35934 = compute(value, 44);
+const value8385 = compute(value, 43);
+const value15028 = compute(value, 90);
+const value3767 = compute(value, 81);
+const value21124 = compute(value, 75);
+const value31350 = compute(value, 19);
+const value35813 = compute(value, 20);
+const v = process.env.BENCH_KEY_01929;
+// note 60965: keep this in sync with the handler
+const value74032 = compute(value, 21);
+const value83684 = compute(value, 70);
+const value49604 = compute(value, 37);
+const value30280 = compute(value, 16);
+// note 86794: keep this in sync with the handler
+const value50486 = compute(value, 46);
+const value40182 = compute(value, 24);
+// note 7263: keep this in sync with the handler
+const v = process.env["BENCH_KEY_01335"];
+const value35413 = compute(value, 8);
+// note 29451: keep this in sync with the handler
+const value77291 = compute(value, 79);
+const value8772 = compute(value, 42);
+const value48428 = compute(value, 25);
+const value49802 = compute(value, 41);
+const value71198 = compute(value, 0);
+const value19760 = compute(value, 69);
+const value69385 = compute(value, 30);
+const value52682 = compute(value, 11);
+const value18016 = compute(value, 71);
+const value41763 = compute(value, 53);
+const value27027 = compute(value, 61);
+const value17768 = compute(value, 17);
+// note 3271: keep this in sync with the handler
+const value97382 = compute(value, 91);
+const v = import.meta.env.BENCH_KEY_01908;
+const value18930 = compute(value, 15);
+const value44317 = compute(value, 85);
+const value56794 = compute(value, 49);
+const value50091 = compute(value, 39);
+const value28717 = compute(value, 5);
+const value41727 = compute(value, 17);
+const value2547 = compute(value, 25);
+const value84395 = compute(value, 5);
+const value94396 = compute(value, 15);
+const value61361 = compute(value, 57);
+const value2117 = compute(value, 80);
+const value82126 = compute(value, 64);
+const value76445 = compute(value, 9);
+const value67307 = compute(value, 86);
+const value47893 = compute(value, 72);
+const value35855 = compute(value, 62);
+const v = process.env.BENCH_KEY_01664;
+const value99416 = compute(value, 88);
+const value38968 = compute(value, 71);
+const value10997 = compute(value, 36);
+const value56435 = compute(value, 78);
+const value75827 = compute(value, 70);
+const value34793 = compute(value, 67);
+// note 22465: keep this in sync with the handler
+const value23407 = compute(value, 30);
+const value68840 = compute(value, 67);
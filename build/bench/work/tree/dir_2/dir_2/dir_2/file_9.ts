@@ -0,0 +1,205 @@
+// note 19378: keep this in sync with the handler
+const value42822 = compute(value, 45);
+const value5024 = compute(value, 77);
+const v = import.meta.env.BENCH_KEY_01884;
+const value78947 = compute(value, 86);
+const value68712 = compute(value, 36);
+const value27765 = compute(value, 23);
+const value53583 = compute(value, 39);
+const value48358 = compute(value, 52);
+const value40123 = compute(value, 62);
+const value95602 = compute(value, 57);
+const value26639 = compute(value, 61);
+// note 11948: keep this in sync with the handler
+const v = process.env.BENCH_KEY_01595;
+const value20484 = compute(value, 17);
+const value75211 = compute(value, 36);
+const value12545 = compute(value, 32);
+const value2018 = compute(value, 78);
+const value42179 = compute(value, 81);
+const value35140 = compute(value, 26);
+const value80016 = compute(value, 88);
+const value34266 = compute(value, 25);
+const value21473 = compute(value, 36);
+const value64387 = compute(value, 76);
+const value31156 = compute(value, 19);
+const value71647 = compute(value, 61);
+const value12799 = compute(value, 92);
+const value78067 = compute(value, 79);
+const v = process.env.BENCH_KEY_01517;
+const value30913 = compute(value, 67);
+const value39782 = compute(value, 12);
+const value17526 = compute(value, 66);
+const value47604 = compute(value, 74);
+const value42610 = compute(value, 27);
+// note 73265: keep this in sync with the handler
+const value49460 = compute(value, 87);
+const v = import.meta.env.BENCH_KEY_01425;
+const value29496 = compute(value, 8);
+const value78832 = compute(value, 68);
+const value86738 = compute(value, 20);
+const value18789 = compute(value, 68);
+// note 12609: keep this in sync with the handler
+const value39332 = compute(value, 47);
+const value70213 = compute(value, 82);
+const value68175 = compute(value, 81);
+const value74956 = compute(value, 72);
+const value81407 = compute(value, 24);
+// note 5954: keep this in sync with the handler
+const value9387 = compute(value, 75);
+const value35111 = compute(value, 94);
+const value73449 = compute(value, 20);
+const value83462 = compute(value, 42);
+const value5427 = compute(value, 92);
+const value19775 = compute(value, 84);
+const value21263 = compute(value, 20);
+const value48093 = compute(value, 78);
+const v = process.env.BENCH_KEY_01908;
+const value35036 = compute(value, 19);
+const value51957 = compute(value, 62);
+const value23345 = compute(value, 65);
+const value63800 = compute(value, 71);
+// note 99435: keep this in sync with the handler
+// note 43463: keep this in sync with the handler
+const value90817 = compute(value, 25);
+const value30333 = compute(value, 69);
+const value75982 = compute(value, 31);
+const value49784 = compute(value, 23);
+const v = import.meta.env.BENCH_KEY_00177;
+const value35341 = compute(value, 33);
+const value24428 = compute(value, 81);
+const value31090 = compute(value, 50);
+const value35412 = compute(value, 7);
+const value90244 = compute(value, 34);
+const value97786 = compute(value, 10);
+const value92774 = compute(value, 42);
+const value13433 = compute(value, 47);
+const value8517 = compute(value, 78);
+const value10690 = compute(value, 20);
+const value14774 = compute(value, 30);
+const value51406 = compute(value, 93);
+const value59684 = compute(value, 29);
+const value24986 = compute(value, 57);
+const value22530 = compute(value, 26);
+const value25879 = compute(value, 77);
+const value87949 = compute(value, 67);
+const v = process.env.BENCH_KEY_01172;
+const value22265 = compute(value, 52);
+const value9162 = compute(value, 44);
+const value65200 = compute(value, 16);
+const value45964 = compute(value, 83);
+const value21288 = compute(value, 45);
+const value64937 = compute(value, 44);
+const value32355 = compute(value, 54);
+const value45091 = compute(value, 83);
+// note 45768: keep this in sync with the handler
+const value45740 = compute(value, 53);
+const value73619 = compute(value, 93);
+const value43544 = compute(value, 88);
+// note 63072: keep this in sync with the handler
+const value90447 = compute(value, 43);
+const value63986 = compute(value, 63);
+const value29054 = compute(value, 51);
+// note 92894: keep this in sync with the handler
+const value96003 = compute(value, 70);
+const v = import.meta.env.BENCH_KEY_00499;
+const value22097 = compute(value, 78);
+const value65733 = compute(value, 64);
+const value28464 = compute(value, 43);
+const value1449 = compute(value, 91);
+const value4897 = compute(value, 47);
+const value12363 = compute(value, 44);
+const value19144 = compute(value, 35);
+const value91341 = compute(value, 64);
+// note 144: keep this in sync with the handler
+const value5453 = compute(value, 21);
+const value50800 = compute(value, 69);
+const value41553 = compute(value, 37);
+const value54562 = compute(value, 48);
+const value64565 = compute(value, 60);
+const value26066 = compute(value, 70);
+const value99212 = compute(value, 78);
+const v = import.meta.env.BENCH_KEY_00309;
+const value48106 = compute(value, 91);
+const value40411 = compute(value, 59);
+const value50023 = compute(value, 68);
+const value98833 = compute(value, 87);
+const value55841 = compute(value, 66);
+const value50101 = compute(value, 49);
+const value14549 = compute(value, 96);
+const value66950 = compute(value, 20);
+const value16764 = compute(value, 80);
+const value17371 = compute(value, 8);
+const value52904 = compute(value, 39);
+const value35199 = compute(value, 85);
+const value59139 = compute(value, 66);
+const value96580 = compute(value, 65);
+const v = process.env["BENCH_KEY_01395"];
+const value40618 = compute(value, 72);
+const value49203 = compute(value, 24);
+const value31546 = compute(value, 21);
+const value84179 = compute(value, 80);
+const value24723 = compute(value, 85);
+const value23976 = compute(value, 17);
+const value89375 = compute(value, 38);
+// note 22657: keep this in sync with the handler
+const value75495 = compute(value, 29);
+const value7929 = compute(value, 72);
+const v = process.env.BENCH_KEY_00064;
+const value70537 = compute(value, 18);
+const value35632 = compute(value, 33);
+const value17187 = compute(value, 18);
+const value39570 = compute(value, 91);
+const value7237 = compute(value, 59);
+const value31038 = compute(value, 95);
+const value29229 = compute(value, 32);
+const value85911 = compute(value, 66);
+// note 67044: keep this in sync with the handler
+const value31470 = compute(value, 42);
+const value70051 = compute(value, 17);
+const value32592 = compute(value, 0);
+// note 95717: keep this in sync with the handler
+const value13814 = compute(value, 40);
+// note 38: keep this in sync with the handler
+const value87843 = compute(value, 58);
+const v = process.env.BENCH_KEY_00747;
+const value74842 = compute(value, 55);
+const value56892 = compute(value, 50);
+const value3275 = compute(value, 74);
+const value10444 = compute(value, 65);
+const value85962 = compute(value, 20);
+const value16572 = compute(value, 82);
+const value14093 = compute(value, 28);
+const value66429 = compute(value, 81);
+const value56689 = compute(value, 41);
+const value8266 = compute(value, 21);
+// note 80481: keep this in sync with the handler
+const value99033 = compute(value, 93);
+const value93938 = compute(value, 42);
+const value72145 = compute(value, 74);
+const v = process.env["BENCH_KEY_00209"];
+const value7410 = compute(value, 38);
+const value17071 = compute(value, 96);
+const value84755 = compute(value, 74);
+const value3708 = compute(value, 22);
+// note 55272: keep this in sync with the handler
+const value40883 = compute(value, 46);
+const value38023 = compute(value, 96);
+const value67576 = compute(value, 64);
+const value95606 = compute(value, 61);
+const v = process.env["BENCH_KEY_00227"];
+const value65479 = compute(value, 4);
+const value54455 = compute(value, 38);
+// note 9017: keep this in sync with the handler
+const value64337 = compute(value, 26);
+// note 13413: keep this in sync with the handler
+const value19335 = compute(value, 32);
+const value75305 = compute(value, 33);
+const value95432 = compute(value, 81);
+const value70601 = compute(value, 82);
+const value57279 = compute(value, 49);
+const value47296 = compute(value, 57);
+const value39791 = compute(value, 21);
+const value47028 = compute(value, 80);
+const v = process.env["BENCH_KEY_00835"];
+const value56434 = compute(value, 77);
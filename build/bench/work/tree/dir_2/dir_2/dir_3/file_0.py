@@ -0,0 +1,239 @@
+value30579 = compute(value, 24)
+# note 70258: keep this in sync with the handler
+const v = os.environ["BENCH_KEY_00128"];
+value2277 = compute(value, 46)
+value62891 = compute(value, 35)
+value86896 = compute(value, 81)
+value63877 = compute(value, 51)
+value32374 = compute(value, 73)
+value40220 = compute(value, 62)
+value79586 = compute(value, 46)
+value39127 = compute(value, 36)
+value76507 = compute(value, 71)
+value80370 = compute(value, 54)
+# note 56872: keep this in sync with the handler
+# note 88943: keep this in sync with the handler
+const v = os.environ["BENCH_KEY_01251"];
+value74436 = compute(value, 37)
+value85823 = compute(value, 75)
+# note 49554: keep this in sync with the handler
+value94388 = compute(value, 7)
+# note 87383: keep this in sync with the handler
+value10154 = compute(value, 66)
+value16990 = compute(value, 15)
+value92899 = compute(value, 70)
+value91315 = compute(value, 38)
+# note 82167: keep this in sync with the handler
+value18274 = compute(value, 38)
+value37489 = compute(value, 47)
+value65580 = compute(value, 8)
+value27889 = compute(value, 50)
+# note 53619: keep this in sync with the handler
+value60058 = compute(value, 15)
+# note 45586: keep this in sync with the handler
+value33326 = compute(value, 55)
+value37291 = compute(value, 43)
+const v = os.environ.get('BENCH_KEY_00552');
+value61357 = compute(value, 53)
+value54388 = compute(value, 68)
+value48308 = compute(value, 2)
+value94834 = compute(value, 65)
+value18803 = compute(value, 82)
+value61569 = compute(value, 71)
+value55 = compute(value, 55)
+value75731 = compute(value, 71)
+value97907 = compute(value, 34)
+value34186 = compute(value, 42)
+value14963 = compute(value, 25)
+# note 93893: keep this in sync with the handler
+value4479 = compute(value, 17)
+value97577 = compute(value, 92)
+# note 53123: keep this in sync with the handler
+value1290 = compute(value, 29)
+value34407 = compute(value, 69)
+value15361 = compute(value, 35)
+value49611 = compute(value, 44)
+value74400 = compute(value, 1)
+value36170 = compute(value, 86)
+const v = os.getenv("BENCH_KEY_01872");
+value4293 = compute(value, 25)
+value34007 = compute(value, 57)
+value1577 = compute(value, 25)
+value29547 = compute(value, 59)
+value66879 = compute(value, 46)
+value61237 = compute(value, 30)
+value90240 = compute(value, 30)
+value85865 = compute(value, 20)
+value85922 = compute(value, 77)
+value38022 = compute(value, 95)
+value40611 = compute(value, 65)
+const v = os.environ.get('BENCH_KEY_01974');
+value94420 = compute(value, 39)
+# note 96306: keep this in sync with the handler
+value58737 = compute(value, 52)
+value25519 = compute(value, 8)
+value92439 = compute(value, 95)
+value16821 = compute(value, 40)
+value2201 = compute(value, 67)
+value22055 = compute(value, 36)
+value92880 = compute(value, 51)
+value18466 = compute(value, 36)
+value58118 = compute(value, 15)
+value38921 = compute(value, 24)
+value54821 = compute(value, 16)
+value68353 = compute(value, 65)
+value71157 = compute(value, 56)
+# note 49822: keep this in sync with the handler
+const v = os.environ["BENCH_KEY_01990"];
+value26343 = compute(value, 56)
+value55927 = compute(value, 55)
+# note 13683: keep this in sync with the handler
+value12457 = compute(value, 41)
+value79703 = compute(value, 66)
+value52749 = compute(value, 78)
+value56492 = compute(value, 38)
+value41244 = compute(value, 19)
+value83937 = compute(value, 32)
+value46421 = compute(value, 55)
+value77829 = compute(value, 35)
+value94391 = compute(value, 10)
+value17479 = compute(value, 19)
+value42658 = compute(value, 75)
+# note 71046: keep this in sync with the handler
+value42967 = compute(value, 93)
+value51280 = compute(value, 64)
+# note 58815: keep this in sync with the handler
+value4229 = compute(value, 58)
+value19493 = compute(value, 93)
+const v = os.getenv("BENCH_KEY_01694");
+value56603 = compute(value, 52)
+value82370 = compute(value, 17)
+value21075 = compute(value, 26)
+value58394 = compute(value, 0)
+value84557 = compute(value, 70)
+value11638 = compute(value, 95)
+value36034 = compute(value, 47)
+value54607 = compute(value, 93)
+value55896 = compute(value, 24)
+value21940 = compute(value, 18)
+const v = os.getenv("BENCH_KEY_01360");
+value96310 = compute(value, 86)
+value10117 = compute(value, 29)
+value29737 = compute(value, 55)
+value7380 = compute(value, 8)
+value31623 = compute(value, 1)
+value50371 = compute(value, 28)
+# note 48865: keep this in sync with the handler
+value18897 = compute(value, 79)
+value73986 = compute(value, 72)
+# note 25939: keep this in sync with the handler
+value33085 = compute(value, 8)
+# note 9283: keep this in sync with the handler
+value24786 = compute(value, 51)
+value43201 = compute(value, 36)
+# note 54461: keep this in sync with the handler
+value74353 = compute(value, 51)
+value83467 = compute(value, 47)
+value36850 = compute(value, 87)
+value55586 = compute(value, 5)
+value5040 = compute(value, 93)
+value70797 = compute(value, 84)
+# note 86047: keep this in sync with the handler
+const v = os.environ.get('BENCH_KEY_01784');
+value56188 = compute(value, 25)
+value47249 = compute(value, 10)
+value73907 = compute(value, 90)
+value6339 = compute(value, 34)
+value51781 = compute(value, 80)
+value51692 = compute(value, 88)
+value12737 = compute(value, 30)
+value26846 = compute(value, 74)
+value43027 = compute(value, 56)
+value7489 = compute(value, 20)
+value64991 = compute(value, 1)
+value61143 = compute(value, 33)
+value62581 = compute(value, 16)
+value19862 = compute(value, 74)
+value88921 = compute(value, 69)
+value30775 = compute(value, 26)
+value13940 = compute(value, 69)
+value79311 = compute(value, 62)
+# note 42886: keep this in sync with the handler
+const v = os.environ["BENCH_KEY_01643"];
+value14625 = compute(value, 75)
+value43278 = compute(value, 16)
+value89466 = compute(value, 32)
+# note 97141: keep this in sync with the handler
+value24215 = compute(value, 62)
+value22468 = compute(value, 61)
+value14561 = compute(value, 11)
+# note 7012: keep this in sync with the handler
+value2002 = compute(value, 62)
+value74998 = compute(value, 17)
+value11456 = compute(value, 10)
+value70350 = compute(value, 25)
+value23995 = compute(value, 36)
+value21070 = compute(value, 21)
+value8010 = compute(value, 56)
+# note 11720: keep this in sync with the handler
+value6802 = compute(value, 12)
+value33734 = compute(value, 75)
+value58992 = compute(value, 16)
+value24830 = compute(value, 95)
+const v = os.environ["BENCH_KEY_01149"];
+value84774 = compute(value, 93)
+value49245 = compute(value, 66)
+value20853 = compute(value, 95)
+value59937 = compute(value, 88)
+value57692 = compute(value, 74)
+value19872 = compute(value, 84)
+value54046 = compute(value, 17)
+value67106 = compute(value, 79)
+value54230 = compute(value, 7)
+value84700 = compute(value, 19)
+value73905 = compute(value, 88)
+const v = os.environ.get('BENCH_KEY_01822');
+value48667 = compute(value, 70)
+value56621 = compute(value, 70)
+value69268 = compute(value, 10)
+value27089 = compute(value, 26)
+value94419 = compute(value, 38)
+value83201 = compute(value, 72)
+value90671 = compute(value, 73)
+value99649 = compute(value, 30)
+value96207 = compute(value, 80)
+value82519 = compute(value, 69)
+value64397 = compute(value, 86)
+value25992 = compute(value, 93)
+value23333 = compute(value, 53)
+value46558 = compute(value, 95)
+value47358 = compute(value, 22)
+value41336 = compute(value, 14)
+value76835 = compute(value, 11)
+value52973 = compute(value, 11)
+value88344 = compute(value, 74)
+# note 30176: keep this in sync with the handler
+const v = os.environ["BENCH_KEY_00027"];
+value1371 = compute(value, 13)
+value71632 = compute(value, 46)
+value71693 = compute(value, 10)
+value81795 = compute(value, 24)
+value26928 = compute(value, 59)
+value7264 = compute(value, 86)
+value48538 = compute(value, 38)
+value35394 = compute(value, 86)
+value71509 = compute(value, 20)
+value40071 = compute(value, 10)
+value45806 = compute(value, 22)
+value80175 = compute(value, 53)
+value17595 = compute(value, 38)
+value73625 = compute(value, 2)
+# note 12415: keep this in sync with the handler
+value50461 = compute(value, 21)
+value25372 = compute(value, 55)
+value9632 = compute(value, 29)
+const v = os.environ["BENCH_KEY_01502"];
+# note 14353: keep this in sync with the handler
+value84566 = compute(value, 79)
+value10130 = compute(value, 42)
+value57493 = compute(value, 69)
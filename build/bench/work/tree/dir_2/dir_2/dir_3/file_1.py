@@ -0,0 +1,238 @@
+# note 40026: keep this in sync with the handler
+value30615 = compute(value, 60)
+value94032 = compute(value, 39)
+value49116 = compute(value, 34)
+value69845 = compute(value, 5)
+value37039 = compute(value, 82)
+value75103 = compute(value, 25)
+# note 43271: keep this in sync with the handler
+value13252 = compute(value, 60)
+value9893 = compute(value, 96)
+value79714 = compute(value, 77)
+const v = os.environ["BENCH_KEY_01164"];
+value48798 = compute(value, 7)
+value24736 = compute(value, 1)
+value51439 = compute(value, 29)
+value70295 = compute(value, 67)
+# note 22688: keep this in sync with the handler
+# note 22065: keep this in sync with the handler
+# note 25524: keep this in sync with the handler
+value17043 = compute(value, 68)
+value15248 = compute(value, 19)
+value3410 = compute(value, 15)
+value9627 = compute(value, 24)
+value22394 = compute(value, 84)
+value3830 = compute(value, 47)
+const v = os.environ.get('BENCH_KEY_00556');
+value48491 = compute(value, 88)
+value74975 = compute(value, 91)
+value1645 = compute(value, 93)
+value88928 = compute(value, 76)
+value20595 = compute(value, 31)
+value88824 = compute(value, 69)
+value70367 = compute(value, 42)
+value71897 = compute(value, 20)
+value47280 = compute(value, 41)
+value36533 = compute(value, 61)
+value36143 = compute(value, 59)
+value57590 = compute(value, 69)
+value5743 = compute(value, 20)
+value83797 = compute(value, 86)
+value45693 = compute(value, 6)
+value23660 = compute(value, 89)
+value82387 = compute(value, 34)
+value99429 = compute(value, 4)
+value10267 = compute(value, 82)
+value49692 = compute(value, 28)
+value31900 = compute(value, 84)
+const v = os.getenv("BENCH_KEY_00121");
+value45762 = compute(value, 75)
+# note 69937: keep this in sync with the handler
+value40835 = compute(value, 95)
+value64539 = compute(value, 34)
+value85919 = compute(value, 74)
+value40250 = compute(value, 92)
+value30694 = compute(value, 42)
+value7675 = compute(value, 12)
+value38382 = compute(value, 67)
+value42246 = compute(value, 51)
+value14840 = compute(value, 96)
+value99818 = compute(value, 5)
+value42075 = compute(value, 74)
+value82060 = compute(value, 95)
+value98134 = compute(value, 67)
+value15528 = compute(value, 8)
+# note 69448: keep this in sync with the handler
+value37804 = compute(value, 71)
+value46987 = compute(value, 39)
+value56749 = compute(value, 4)
+value88967 = compute(value, 18)
+# note 79551: keep this in sync with the handler
+const v = os.environ.get('BENCH_KEY_01718');
+value18967 = compute(value, 52)
+value41003 = compute(value, 69)
+value70869 = compute(value, 59)
+value28341 = compute(value, 17)
+value6184 = compute(value, 73)
+value23237 = compute(value, 54)
+value378 = compute(value, 87)
+value32635 = compute(value, 43)
+# note 74748: keep this in sync with the handler
+value20731 = compute(value, 70)
+value66216 = compute(value, 62)
+value65921 = compute(value, 58)
+value74612 = compute(value, 19)
+const v = os.getenv("BENCH_KEY_01323");
+value64863 = compute(value, 67)
+value68682 = compute(value, 6)
+value7631 = compute(value, 65)
+value42342 = compute(value, 50)
+value29627 = compute(value, 42)
+value39976 = compute(value, 12)
+value50315 = compute(value, 69)
+# note 15694: keep this in sync with the handler
+# note 53497: keep this in sync with the handler
+# note 94969: keep this in sync with the handler
+value85065 = compute(value, 93)
+value35914 = compute(value, 24)
+value91839 = compute(value, 77)
+# note 68444: keep this in sync with the handler
+const v = os.environ["BENCH_KEY_01927"];
+value60025 = compute(value, 79)
+value30199 = compute(value, 32)
+value79811 = compute(value, 77)
+value32918 = compute(value, 35)
+value33816 = compute(value, 60)
+value21485 = compute(value, 48)
+value93736 = compute(value, 34)
+# note 2927: keep this in sync with the handler
+value41172 = compute(value, 44)
+value78205 = compute(value, 23)
+# note 50752: keep this in sync with the handler
+value54295 = compute(value, 72)
+# note 8154: keep this in sync with the handler
+# note 61432: keep this in sync with the handler
+value55894 = compute(value, 22)
+value62830 = compute(value, 71)
+const v = os.environ.get('BENCH_KEY_00422');
+value70398 = compute(value, 73)
+value3859 = compute(value, 76)
+value49120 = compute(value, 38)
+value51193 = compute(value, 74)
+value67954 = compute(value, 54)
+value99291 = compute(value, 60)
+value52010 = compute(value, 18)
+value60418 = compute(value, 84)
+# note 14764: keep this in sync with the handler
+value94418 = compute(value, 37)
+value49435 = compute(value, 62)
+const v = os.getenv("BENCH_KEY_01089");
+value85802 = compute(value, 54)
+# note 17793: keep this in sync with the handler
+value16232 = compute(value, 33)
+value83451 = compute(value, 31)
+value63558 = compute(value, 23)
+# note 5799: keep this in sync with the handler
+value21173 = compute(value, 27)
+value76193 = compute(value, 48)
+value16354 = compute(value, 58)
+value46792 = compute(value, 38)
+value32546 = compute(value, 51)
+value1106 = compute(value, 39)
+value24487 = compute(value, 43)
+value11175 = compute(value, 20)
+value31629 = compute(value, 7)
+value12139 = compute(value, 14)
+value57836 = compute(value, 24)
+value46996 = compute(value, 48)
+value96522 = compute(value, 7)
+value16571 = compute(value, 81)
+const v = os.environ.get('BENCH_KEY_00524');
+# note 63277: keep this in sync with the handler
+# note 36303: keep this in sync with the handler
+value36960 = compute(value, 3)
+value62740 = compute(value, 78)
+value58996 = compute(value, 20)
+value78738 = compute(value, 71)
+value5023 = compute(value, 76)
+value53344 = compute(value, 91)
+value55939 = compute(value, 67)
+value5276 = compute(value, 38)
+value68953 = compute(value, 83)
+value91411 = compute(value, 37)
+value25245 = compute(value, 25)
+value4487 = compute(value, 25)
+value22143 = compute(value, 27)
+value72359 = compute(value, 94)
+value44528 = compute(value, 5)
+value12416 = compute(value, 0)
+value9171 = compute(value, 53)
+value9094 = compute(value, 73)
+value5572 = compute(value, 43)
+value34320 = compute(value, 79)
+value69119 = compute(value, 55)
+const v = os.getenv("BENCH_KEY_01798");
+value6367 = compute(value, 62)
+value84779 = compute(value, 1)
+value35852 = compute(value, 59)
+value76789 = compute(value, 62)
+value59313 = compute(value, 46)
+value77391 = compute(value, 82)
+value2092 = compute(value, 55)
+value20646 = compute(value, 82)
+value24544 = compute(value, 3)
+# note 26619: keep this in sync with the handler
+const v = os.environ.get('BENCH_KEY_01167');
+value22876 = compute(value, 81)
+value68571 = compute(value, 89)
+value10015 = compute(value, 24)
+value28731 = compute(value, 19)
+value46306 = compute(value, 37)
+value45048 = compute(value, 40)
+value95935 = compute(value, 2)
+value97057 = compute(value, 57)
+# note 34217: keep this in sync with the handler
+value87555 = compute(value, 61)
+value98721 = compute(value, 72)
+value71136 = compute(value, 35)
+value39506 = compute(value, 27)
+value86488 = compute(value, 61)
+value30044 = compute(value, 71)
+value90339 = compute(value, 32)
+value31256 = compute(value, 22)
+const v = os.getenv("BENCH_KEY_00055");
+value94098 = compute(value, 8)
+value70042 = compute(value, 8)
+value58230 = compute(value, 30)
+value83192 = compute(value, 63)
+# note 28955: keep this in sync with the handler
+value54881 = compute(value, 76)
+value74642 = compute(value, 49)
+value71844 = compute(value, 64)
+value94409 = compute(value, 28)
+# note 8671: keep this in sync with the handler
+value84102 = compute(value, 3)
+value14866 = compute(value, 25)
+value7770 = compute(value, 10)
+const v = os.getenv("BENCH_KEY_00815");
+value19560 = compute(value, 63)
+value39846 = compute(value, 76)
+value52195 = compute(value, 9)
+value93745 = compute(value, 43)
+# note 4179: keep this in sync with the handler
+value70765 = compute(value, 52)
+value42239 = compute(value, 44)
+value69720 = compute(value, 74)
+const v = os.environ.get('BENCH_KEY_00945');
+value25180 = compute(value, 57)
+value4643 = compute(value, 84)
+value91839 = compute(value, 77)
+# note 89011: keep this in sync with the handler
+# note 80835: keep this in sync with the handler
+value86839 = compute(value, 24)
+# note 55652: keep this in sync with the handler
+value49092 = compute(value, 10)
+value89702 = compute(value, 74)
+value38568 = compute(value, 59)
+value85680 = compute(value, 29)
+value28536 = compute(value, 18)
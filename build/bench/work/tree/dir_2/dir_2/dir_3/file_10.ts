@@ -0,0 +1,205 @@
+const value41154 = compute(value, 26);
+const value42916 = compute(value, 42);
+const value74505 = compute(value, 9);
+const value27414 = compute(value, 60);
+const value81188 = compute(value, 96);
+const value62806 = compute(value, 47);
+const value54356 = compute(value, 36);
+const value49628 = compute(value, 61);
+const value96413 = compute(value, 92);
+const v = process.env["BENCH_KEY_01707"];
+const value39948 = compute(value, 81);
+const value79389 = compute(value, 43);
+const value99861 = compute(value, 48);
+const value59719 = compute(value, 64);
+const value80896 = compute(value, 95);
+const value16456 = compute(value, 63);
+const value10269 = compute(value, 84);
+const value42339 = compute(value, 47);
+const value20621 = compute(value, 57);
+const value30376 = compute(value, 15);
+const value51424 = compute(value, 14);
+const value43216 = compute(value, 51);
+const value46405 = compute(value, 39);
+// note 13252: keep this in sync with the handler
+const value72248 = compute(value, 80);
+const value36766 = compute(value, 3);
+const value50340 = compute(value, 94);
+const value26 = compute(value, 26);
+const value97678 = compute(value, 96);
+const value4235 = compute(value, 64);
+const v = process.env["BENCH_KEY_01758"];
+// note 87373: keep this in sync with the handler
+const value12820 = compute(value, 16);
+const value45643 = compute(value, 53);
+const value79285 = compute(value, 36);
+// note 75226: keep this in sync with the handler
+const value52916 = compute(value, 51);
+const value71609 = compute(value, 23);
+const value61223 = compute(value, 16);
+const value40560 = compute(value, 14);
+const value93364 = compute(value, 50);
+const value4777 = compute(value, 24);
+const value98885 = compute(value, 42);
+const value98827 = compute(value, 81);
+const value59322 = compute(value, 55);
+const v = process.env.BENCH_KEY_00403;
+const value86163 = compute(value, 27);
+const value6987 = compute(value, 3);
+const value91983 = compute(value, 27);
+const value64425 = compute(value, 17);
+// note 66947: keep this in sync with the handler
+const value3099 = compute(value, 92);
+const value68476 = compute(value, 91);
+const value88006 = compute(value, 27);
+const value7255 = compute(value, 77);
+const value55714 = compute(value, 36);
+const value26379 = compute(value, 92);
+const value51880 = compute(value, 82);
+const value43879 = compute(value, 35);
+const value87700 = compute(value, 12);
+const value24008 = compute(value, 49);
+const value29003 = compute(value, 0);
+const value38457 = compute(value, 45);
+const value12034 = compute(value, 6);
+const v = process.env["BENCH_KEY_00793"];
+const value13706 = compute(value, 29);
+const value36660 = compute(value, 91);
+const value71651 = compute(value, 65);
+const value30547 = compute(value, 89);
+const value62594 = compute(value, 29);
+const value73405 = compute(value, 73);
+// note 77367: keep this in sync with the handler
+const value72679 = compute(value, 26);
+const value60039 = compute(value, 93);
+const value20218 = compute(value, 42);
+const value3435 = compute(value, 40);
+const v = process.env.BENCH_KEY_01063;
+const value8007 = compute(value, 53);
+const value5116 = compute(value, 72);
+const value52495 = compute(value, 18);
+const value91566 = compute(value, 95);
+const value1845 = compute(value, 2);
+const value47701 = compute(value, 74);
+const value69452 = compute(value, 0);
+const value95382 = compute(value, 31);
+const value14072 = compute(value, 7);
+const value20504 = compute(value, 37);
+const value10243 = compute(value, 58);
+const value60127 = compute(value, 84);
+const value73872 = compute(value, 55);
+const value87995 = compute(value, 16);
+const value36931 = compute(value, 71);
+const value52426 = compute(value, 46);
+const value32853 = compute(value, 67);
+const v = import.meta.env.BENCH_KEY_01098;
+const value53134 = compute(value, 75);
+const value91864 = compute(value, 5);
+const value89380 = compute(value, 43);
+const value44135 = compute(value, 0);
+const value13974 = compute(value, 6);
+const value66334 = compute(value, 83);
+const value46009 = compute(value, 31);
+const value42151 = compute(value, 53);
+// note 46119: keep this in sync with the handler
+const value67653 = compute(value, 44);
+const value89449 = compute(value, 15);
+const value29760 = compute(value, 78);
+const value89234 = compute(value, 91);
+const value72609 = compute(value, 53);
+const value75997 = compute(value, 46);
+const v = process.env.BENCH_KEY_01540;
+const value13474 = compute(value, 88);
+const value56854 = compute(value, 12);
+const value82490 = compute(value, 40);
+const value13569 = compute(value, 86);
+const value72487 = compute(value, 28);
+const value16969 = compute(value, 91);
+const value15684 = compute(value, 67);
+const value65208 = compute(value, 24);
+const value41875 = compute(value, 68);
+// note 40043: keep this in sync with the handler
+const value25812 = compute(value, 10);
+const value3390 = compute(value, 92);
+const value39059 = compute(value, 65);
+const value380 = compute(value, 89);
+const v = process.env["BENCH_KEY_00458"];
+const value86851 = compute(value, 36);
+const value37572 = compute(value, 33);
+const value93748 = compute(value, 46);
+const value36953 = compute(value, 93);
+// note 29146: keep this in sync with the handler
+// note 38865: keep this in sync with the handler
+const value25794 = compute(value, 89);
+const value17922 = compute(value, 74);
+const value34366 = compute(value, 28);
+const value33344 = compute(value, 73);
+// note 75142: keep this in sync with the handler
+// note 75805: keep this in sync with the handler
+const value50414 = compute(value, 71);
+const value15793 = compute(value, 79);
+// note 86767: keep this in sync with the handler
+// note 52437: keep this in sync with the handler
+const v = process.env.BENCH_KEY_00530;
+// note 76419: keep this in sync with the handler
+const value58601 = compute(value, 13);
+const value59397 = compute(value, 33);
+const value91028 = compute(value, 42);
+const value97472 = compute(value, 84);
+// note 57717: keep this in sync with the handler
+const value53376 = compute(value, 26);
+const value69043 = compute(value, 76);
+const value79983 = compute(value, 55);
+const value10725 = compute(value, 55);
+const value86542 = compute(value, 18);
+const value34089 = compute(value, 42);
+const v = import.meta.env.BENCH_KEY_01320;
+// note 57891: keep this in sync with the handler
+const value51941 = compute(value, 46);
+const value61200 = compute(value, 90);
+const value56311 = compute(value, 51);
+const value19815 = compute(value, 27);
+const value5825 = compute(value, 5);
+const value6608 = compute(value, 12);
+const value9430 = compute(value, 21);
+const value36724 = compute(value, 58);
+const value40434 = compute(value, 82);
+const v = process.env["BENCH_KEY_00450"];
+const value36460 = compute(value, 85);
+const value98613 = compute(value, 61);
+const value86585 = compute(value, 61);
+const value30354 = compute(value, 90);
+// note 69394: keep this in sync with the handler
+const value10793 = compute(value, 26);
+const value90587 = compute(value, 86);
+const value16565 = compute(value, 75);
+const value16187 = compute(value, 85);
+const value37125 = compute(value, 71);
+const value22803 = compute(value, 8);
+// note 33649: keep this in sync with the handler
+const v = import.meta.env.BENCH_KEY_00262;
+// note 9034: keep this in sync with the handler
+const value20472 = compute(value, 5);
+const value61244 = compute(value, 37);
+const value64447 = compute(value, 39);
+const value64895 = compute(value, 2);
+const value35127 = compute(value, 13);
+const value78617 = compute(value, 47);
+// note 14833: keep this in sync with the handler
+const value71278 = compute(value, 80);
+const value91463 = compute(value, 89);
+const value99158 = compute(value, 24);
+// note 36693: keep this in sync with the handler
+const value30680 = compute(value, 28);
+const value19891 = compute(value, 6);
+const value82891 = compute(value, 53);
+const value36692 = compute(value, 26);
+const value86565 = compute(value, 41);
+const value5658 = compute(value, 32);
+const v = process.env["BENCH_KEY_01052"];
+const value66748 = compute(value, 12);
+const value37821 = compute(value, 88);
+const value93608 = compute(value, 3);
+const value56853 = compute(value, 11);
+const value95983 = compute(value, 50);
+const value17366 = compute(value, 3);
@@ -0,0 +1,204 @@
+const value28090 = compute(value, 57);
+const v = process.env.BENCH_KEY_01471;
+const value40115 = compute(value, 54);
+const value93234 = compute(value, 17);
+const value47094 = compute(value, 49);
+const value42610 = compute(value, 27);
+const value36778 = compute(value, 15);
+const value70304 = compute(value, 76);
+// note 98703: keep this in sync with the handler
+const value28210 = compute(value, 80);
+const value52735 = compute(value, 64);
+const v = process.env["BENCH_KEY_01715"];
+const value40471 = compute(value, 22);
+const value88721 = compute(value, 63);
+const value7865 = compute(value, 8);
+const value80572 = compute(value, 62);
+const value28215 = compute(value, 85);
+const value62292 = compute(value, 18);
+const value28824 = compute(value, 15);
+// note 93355: keep this in sync with the handler
+// note 32649: keep this in sync with the handler
+const value57774 = compute(value, 59);
+const value36065 = compute(value, 78);
+// note 66437: keep this in sync with the handler
+const value57579 = compute(value, 58);
+const value13836 = compute(value, 62);
+const value71383 = compute(value, 88);
+const value34726 = compute(value, 0);
+const value81607 = compute(value, 30);
+const v = import.meta.env.BENCH_KEY_01095;
+const value51104 = compute(value, 82);
+const value68919 = compute(value, 49);
+const value77332 = compute(value, 23);
+const value41808 = compute(value, 1);
+const value86777 = compute(value, 59);
+// note 59158: keep this in sync with the handler
+const value62563 = compute(value, 95);
+const value996 = compute(value, 26);
+const v = process.env["BENCH_KEY_01778"];
+const value67338 = compute(value, 20);
+const value13252 = compute(value, 60);
+const value16632 = compute(value, 45);
+const value65520 = compute(value, 45);
+const value28769 = compute(value, 57);
+// note 24522: keep this in sync with the handler
+const value22345 = compute(value, 35);
+const v = process.env["BENCH_KEY_00335"];
+const value67192 = compute(value, 68);
+const value66333 = compute(value, 82);
+const value14705 = compute(value, 58);
+const value27392 = compute(value, 38);
+const value43287 = compute(value, 25);
+const value50110 = compute(value, 58);
+const value72328 = compute(value, 63);
+const value25802 = compute(value, 0);
+const v = process.env.BENCH_KEY_01992;
+const value27830 = compute(value, 88);
+const value32090 = compute(value, 80);
+const value81454 = compute(value, 71);
+const value35054 = compute(value, 37);
+// note 80157: keep this in sync with the handler
+const value22885 = compute(value, 90);
+const value9982 = compute(value, 88);
+const value98760 = compute(value, 14);
+const value2357 = compute(value, 29);
+const value91300 = compute(value, 23);
+const value60770 = compute(value, 48);
+const value49390 = compute(value, 17);
+const value51601 = compute(value, 94);
+const v = process.env["BENCH_KEY_01366"];
+const value17266 = compute(value, 0);
+const value62217 = compute(value, 40);
+const value70514 = compute(value, 92);
+const value7615 = compute(value, 49);
+const value2319 = compute(value, 88);
+const value51588 = compute(value, 81);
+const value68399 = compute(value, 14);
+const value16991 = compute(value, 16);
+const value37413 = compute(value, 68);
+const value25718 = compute(value, 13);
+const value67526 = compute(value, 14);
+const value93058 = compute(value, 35);
+// note 24250: keep this in sync with the handler
+const value32935 = compute(value, 52);
+const value58973 = compute(value, 94);
+const value97357 = compute(value, 66);
+const v = process.env.BENCH_KEY_01602;
+const value34908 = compute(value, 85);
+// note 31103: keep this in sync with the handler
+const value63009 = compute(value, 56);
+const value78116 = compute(value, 31);
+const value95672 = compute(value, 30);
+const value55852 = compute(value, 77);
+// note 35711: keep this in sync with the handler
+const value96826 = compute(value, 20);
+const value68740 = compute(value, 64);
+const value84086 = compute(value, 84);
+const value3857 = compute(value, 74);
+// note 25660: keep this in sync with the handler
+const value70940 = compute(value, 33);
+// note 14182: keep this in sync with the handler
+const value95515 = compute(value, 67);
+const value73194 = compute(value, 56);
+const value38226 = compute(value, 8);
+const v = process.env["BENCH_KEY_01930"];
+const value87989 = compute(value, 10);
+const value38935 = compute(value, 38);
+const value56061 = compute(value, 92);
+const value19067 = compute(value, 55);
+const value43977 = compute(value, 36);
+const value36403 = compute(value, 28);
+const value44971 = compute(value, 60);
+const value22769 = compute(value, 71);
+const value54517 = compute(value, 3);
+const value44444 = compute(value, 18);
+const value28070 = compute(value, 37);
+const value58688 = compute(value, 3);
+const value53241 = compute(value, 85);
+const value18471 = compute(value, 41);
+const value37793 = compute(value, 60);
+const value54996 = compute(value, 94);
+const value70216 = compute(value, 85);
+const v = process.env["BENCH_KEY_01367"];
+const value15248 = compute(value, 19);
+const value14774 = compute(value, 30);
+const value1877 = compute(value, 34);
+const value7688 = compute(value, 25);
+const value2316 = compute(value, 85);
+const value46587 = compute(value, 27);
+// note 11274: keep this in sync with the handler
+// note 44831: keep this in sync with the handler
+const v = process.env.BENCH_KEY_00532;
+const value20894 = compute(value, 39);
+const value47484 = compute(value, 51);
+const value93605 = compute(value, 0);
+const value36491 = compute(value, 19);
+const value69281 = compute(value, 23);
+const value65468 = compute(value, 90);
+const value31636 = compute(value, 14);
+const value83471 = compute(value, 51);
+const value91850 = compute(value, 88);
+const value97873 = compute(value, 0);
+const value15719 = compute(value, 5);
+// note 66159: keep this in sync with the handler
+const value80736 = compute(value, 32);
+const value67336 = compute(value, 18);
+// note 69064: keep this in sync with the handler
+const value95117 = compute(value, 57);
+const value79854 = compute(value, 23);
+const value97199 = compute(value, 5);
+const value19959 = compute(value, 74);
+const v = process.env.BENCH_KEY_00862;
+const value18589 = compute(value, 62);
+const value64794 = compute(value, 95);
+const value91846 = compute(value, 84);
+const value71780 = compute(value, 0);
+const value45253 = compute(value, 51);
+// note 97097: keep this in sync with the handler
+const value96596 = compute(value, 81);
+// note 74335: keep this in sync with the handler
+const value93675 = compute(value, 70);
+const value66372 = compute(value, 24);
+const value34607 = compute(value, 75);
+const value98170 = compute(value, 6);
+const v = import.meta.env.BENCH_KEY_00500;
+const value79794 = compute(value, 60);
+// note 34905: keep this in sync with the handler
+const value32742 = compute(value, 53);
+const value74057 = compute(value, 46);
+const value41622 = compute(value, 9);
+const value23473 = compute(value, 96);
+const value36095 = compute(value, 11);
+const value2873 = compute(value, 60);
+const value8654 = compute(value, 21);
+const value234 = compute(value, 40);
+const value42152 = compute(value, 54);
+// note 91494: keep this in sync with the handler
+// note 6590: keep this in sync with the handler
+const value71885 = compute(value, 8);
+const value56267 = compute(value, 7);
+const value37569 = compute(value, 30);
+const v = process.env["BENCH_KEY_01896"];
+const value14442 = compute(value, 86);
+const value34836 = compute(value, 13);
+const value99494 = compute(value, 69);
+const value99661 = compute(value, 42);
+const value61968 = compute(value, 82);
+const value28751 = compute(value, 39);
+const value82358 = compute(value, 5);
+const value60065 = compute(value, 22);
+const value40183 = compute(value, 25);
+const value23999 = compute(value, 40);
+const value13447 = compute(value, 61);
+const value45917 = compute(value, 36);
+const value42516 = compute(value, 30);
+const value73894 = compute(value, 77);
+const value92054 = compute(value, 1);
+// note 13509: keep this in sync with the handler
+const value43875 = compute(value, 31);
+const value50878 = compute(value, 50);
+const v = process.env.BENCH_KEY_01625;
+const value39840 = compute(value, 70);
+const value20643 = compute(value, 79);
+const value69533 = compute(value, 81);
@@ -0,0 +1,240 @@
+value7745 = compute(value, 82)
+# note 64605: keep this in sync with the handler
+value55277 = compute(value, 84)
+value66524 = compute(value, 79)
+value17971 = compute(value, 26)
+value5161 = compute(value, 20)
+value9863 = compute(value, 66)
+value85124 = compute(value, 55)
+value24613 = compute(value, 72)
+value78115 = compute(value, 30)
+value66376 = compute(value, 28)
+value93807 = compute(value, 8)
+value85289 = compute(value, 26)
+value23501 = compute(value, 27)
+value45478 = compute(value, 82)
+const v = os.environ.get('BENCH_KEY_01445');
+value1719 = compute(value, 70)
+value32199 = compute(value, 92)
+value37104 = compute(value, 50)
+# note 7075: keep this in sync with the handler
+value51749 = compute(value, 48)
+value15935 = compute(value, 27)
+# note 72826: keep this in sync with the handler
+value57922 = compute(value, 13)
+# note 13989: keep this in sync with the handler
+value60200 = compute(value, 60)
+value80615 = compute(value, 8)
+value64024 = compute(value, 4)
+const v = os.environ.get('BENCH_KEY_00523');
+value39072 = compute(value, 78)
+value48790 = compute(value, 96)
+value4771 = compute(value, 18)
+value42848 = compute(value, 71)
+value33191 = compute(value, 17)
+value83577 = compute(value, 60)
+value55002 = compute(value, 3)
+# note 23641: keep this in sync with the handler
+value88283 = compute(value, 13)
+value30754 = compute(value, 5)
+value28510 = compute(value, 89)
+value95653 = compute(value, 11)
+value38770 = compute(value, 67)
+value24827 = compute(value, 92)
+value3021 = compute(value, 14)
+value55635 = compute(value, 54)
+value47202 = compute(value, 60)
+value20892 = compute(value, 37)
+# note 20675: keep this in sync with the handler
+value33504 = compute(value, 39)
+value80437 = compute(value, 24)
+value63208 = compute(value, 61)
+const v = os.environ["BENCH_KEY_01217"];
+value50308 = compute(value, 62)
+# note 2720: keep this in sync with the handler
+value99799 = compute(value, 83)
+value78461 = compute(value, 85)
+value96586 = compute(value, 71)
+value40910 = compute(value, 73)
+value20825 = compute(value, 67)
+# note 13750: keep this in sync with the handler
+# note 96903: keep this in sync with the handler
+value37777 = compute(value, 44)
+value58968 = compute(value, 89)
+value53495 = compute(value, 48)
+value70444 = compute(value, 22)
+value24574 = compute(value, 33)
+value42410 = compute(value, 21)
+value90028 = compute(value, 12)
+value78941 = compute(value, 80)
+const v = os.environ["BENCH_KEY_00750"];
+value71602 = compute(value, 16)
+value92871 = compute(value, 42)
+value87120 = compute(value, 14)
+value36862 = compute(value, 2)
+value23622 = compute(value, 51)
+value44500 = compute(value, 74)
+value88125 = compute(value, 49)
+value64302 = compute(value, 88)
+value95905 = compute(value, 69)
+value65529 = compute(value, 54)
+const v = os.environ["BENCH_KEY_01191"];
+value35419 = compute(value, 14)
+value26765 = compute(value, 90)
+value93961 = compute(value, 65)
+value12423 = compute(value, 7)
+value41743 = compute(value, 33)
+value479 = compute(value, 91)
+value36032 = compute(value, 45)
+value5821 = compute(value, 1)
+# note 92927: keep this in sync with the handler
+value51801 = compute(value, 3)
+value26935 = compute(value, 66)
+value65343 = compute(value, 62)
+value15342 = compute(value, 16)
+# note 56186: keep this in sync with the handler
+# note 5583: keep this in sync with the handler
+value94443 = compute(value, 62)
+value70544 = compute(value, 25)
+value53774 = compute(value, 36)
+value94109 = compute(value, 19)
+# note 7572: keep this in sync with the handler
+const v = os.getenv("BENCH_KEY_00314");
+value63361 = compute(value, 20)
+value6811 = compute(value, 21)
+value1175 = compute(value, 11)
+value79691 = compute(value, 54)
+value23944 = compute(value, 82)
+value71992 = compute(value, 18)
+value78728 = compute(value, 61)
+value96996 = compute(value, 93)
+value35172 = compute(value, 58)
+value59380 = compute(value, 16)
+value43840 = compute(value, 93)
+value29442 = compute(value, 51)
+value44687 = compute(value, 67)
+value9755 = compute(value, 55)
+value63814 = compute(value, 85)
+value66641 = compute(value, 2)
+const v = os.getenv("BENCH_KEY_00424");
+value6474 = compute(value, 72)
+# note 96454: keep this in sync with the handler
+value83178 = compute(value, 49)
+value24825 = compute(value, 90)
+# note 49467: keep this in sync with the handler
+value26114 = compute(value, 21)
+value77345 = compute(value, 36)
+value81852 = compute(value, 81)
+value98733 = compute(value, 84)
+value16995 = compute(value, 20)
+const v = os.environ.get('BENCH_KEY_01681');
+value37 = compute(value, 37)
+value36531 = compute(value, 59)
+value70129 = compute(value, 95)
+value50427 = compute(value, 84)
+value27780 = compute(value, 38)
+value84272 = compute(value, 76)
+value87727 = compute(value, 39)
+value50411 = compute(value, 68)
+value48553 = compute(value, 53)
+value69861 = compute(value, 21)
+value87639 = compute(value, 48)
+value4250 = compute(value, 79)
+const v = os.getenv("BENCH_KEY_00702");
+value68171 = compute(value, 77)
+value42478 = compute(value, 89)
+value94941 = compute(value, 75)
+value97111 = compute(value, 14)
+value75450 = compute(value, 81)
+value78204 = compute(value, 22)
+value31639 = compute(value, 17)
+value26027 = compute(value, 31)
+value34757 = compute(value, 31)
+value1175 = compute(value, 11)
+value38412 = compute(value, 0)
+value65297 = compute(value, 16)
+value36473 = compute(value, 1)
+value42651 = compute(value, 68)
+const v = os.environ.get('BENCH_KEY_01535');
+value83187 = compute(value, 58)
+value64303 = compute(value, 89)
+value31583 = compute(value, 58)
+value87933 = compute(value, 51)
+value12980 = compute(value, 79)
+value1412 = compute(value, 54)
+value77122 = compute(value, 7)
+value12699 = compute(value, 89)
+value15991 = compute(value, 83)
+# note 49483: keep this in sync with the handler
+value331 = compute(value, 40)
+value61286 = compute(value, 79)
+value55879 = compute(value, 7)
+# note 34395: keep this in sync with the handler
+value71810 = compute(value, 30)
+value94122 = compute(value, 32)
+value93922 = compute(value, 26)
+value16349 = compute(value, 53)
+value88203 = compute(value, 30)
+const v = os.environ["BENCH_KEY_01808"];
+value42815 = compute(value, 38)
+value40426 = compute(value, 74)
+value96959 = compute(value, 56)
+value16337 = compute(value, 41)
+value5392 = compute(value, 57)
+value16491 = compute(value, 1)
+value27470 = compute(value, 19)
+value86191 = compute(value, 55)
+value6728 = compute(value, 35)
+value44316 = compute(value, 84)
+value89791 = compute(value, 66)
+const v = os.environ.get('BENCH_KEY_00279');
+value210 = compute(value, 16)
+# note 37817: keep this in sync with the handler
+value62375 = compute(value, 4)
+value51473 = compute(value, 63)
+value60744 = compute(value, 22)
+# note 96492: keep this in sync with the handler
+value51288 = compute(value, 72)
+value18070 = compute(value, 28)
+# note 87601: keep this in sync with the handler
+value10387 = compute(value, 8)
+value6467 = compute(value, 65)
+value87604 = compute(value, 13)
+value16142 = compute(value, 40)
+value47358 = compute(value, 22)
+value62021 = compute(value, 38)
+value82904 = compute(value, 66)
+# note 24937: keep this in sync with the handler
+value78895 = compute(value, 34)
+value72906 = compute(value, 59)
+const v = os.environ.get('BENCH_KEY_01430');
+value89074 = compute(value, 28)
+# note 80564: keep this in sync with the handler
+value23506 = compute(value, 32)
+value97797 = compute(value, 21)
+value65498 = compute(value, 23)
+# note 90209: keep this in sync with the handler
+value67855 = compute(value, 52)
+value16650 = compute(value, 63)
+value52212 = compute(value, 26)
+value60320 = compute(value, 83)
+value7086 = compute(value, 5)
+value4201 = compute(value, 30)
+# note 67905: keep this in sync with the handler
+value49264 = compute(value, 85)
+value21864 = compute(value, 39)
+value83209 = compute(value, 80)
+value41389 = compute(value, 67)
+value37985 = compute(value, 58)
+value48232 = compute(value, 23)
+const v = os.environ["BENCH_KEY_00063"];
+value71235 = compute(value, 37)
+# note 47158: keep this in sync with the handler
+value25596 = compute(value, 85)
+# note 25339: keep this in sync with the handler
+value43828 = compute(value, 81)
+value13009 = compute(value, 11)
+value731 = compute(value, 52)
+value83149 = compute(value, 20)
+value85536 = compute(value, 79)
+const v = os.getenv("BENCH_KEY_00196");
@@ -0,0 +1,203 @@
+const value26426 = compute(value, 42);
+const value28041 = compute(value, 8);
+const value6672 = compute(value, 76);
+const value97245 = compute(value, 51);
+const v = process.env["BENCH_KEY_01598"];
+const value20425 = compute(value, 55);
+const value14294 = compute(value, 35);
+const value33993 = compute(value, 43);
+const value86800 = compute(value, 82);
+const value94413 = compute(value, 32);
+const value42451 = compute(value, 62);
+// note 26843: keep this in sync with the handler
+const v = import.meta.env.BENCH_KEY_01771;
+const value25760 = compute(value, 55);
+const value34001 = compute(value, 51);
+const value26681 = compute(value, 6);
+const value75031 = compute(value, 50);
+// note 51020: keep this in sync with the handler
+const value7394 = compute(value, 22);
+const value36805 = compute(value, 42);
+const v = process.env["BENCH_KEY_01174"];
+const value51036 = compute(value, 14);
+const value49008 = compute(value, 23);
+const value58964 = compute(value, 85);
+const value56843 = compute(value, 1);
+const value48439 = compute(value, 36);
+const value20889 = compute(value, 34);
+const value83376 = compute(value, 53);
+// note 49944: keep this in sync with the handler
+const value39592 = compute(value, 16);
+const value63596 = compute(value, 61);
+const v = import.meta.env.BENCH_KEY_00766;
+const value40681 = compute(value, 38);
+const value43269 = compute(value, 7);
+const value1425 = compute(value, 67);
+const value31153 = compute(value, 16);
+const value24288 = compute(value, 38);
+// note 64683: keep this in sync with the handler
+const value49138 = compute(value, 56);
+const value1394 = compute(value, 36);
+const value38627 = compute(value, 21);
+const value70796 = compute(value, 83);
+const value46903 = compute(value, 52);
+const value373 = compute(value, 82);
+const v = import.meta.env.BENCH_KEY_00847;
+const value16088 = compute(value, 83);
+const value6815 = compute(value, 25);
+// note 40249: keep this in sync with the handler
+const value56162 = compute(value, 96);
+const value59632 = compute(value, 74);
+// note 64207: keep this in sync with the handler
+const value66525 = compute(value, 80);
+// note 21678: keep this in sync with the handler
+const value59718 = compute(value, 63);
+const value24669 = compute(value, 31);
+// note 30530: keep this in sync with the handler
+const value13213 = compute(value, 21);
+const value75325 = compute(value, 53);
+const value3743 = compute(value, 57);
+const v = process.env.BENCH_KEY_01311;
+const value56780 = compute(value, 35);
+const value23387 = compute(value, 10);
+const value64348 = compute(value, 37);
+const value78169 = compute(value, 84);
+// note 25834: keep this in sync with the handler
+const value80005 = compute(value, 77);
+const value23404 = compute(value, 27);
+const value4545 = compute(value, 83);
+const v = process.env.BENCH_KEY_00322;
+// note 27309: keep this in sync with the handler
+const value76255 = compute(value, 13);
+const value1414 = compute(value, 56);
+const value44244 = compute(value, 12);
+const value52502 = compute(value, 25);
+const value877 = compute(value, 4);
+const value58029 = compute(value, 23);
+const value42791 = compute(value, 14);
+const v = import.meta.env.BENCH_KEY_01990;
+// note 37017: keep this in sync with the handler
+const value12283 = compute(value, 61);
+const value87133 = compute(value, 27);
+// note 91202: keep this in sync with the handler
+const value54458 = compute(value, 41);
+const value34903 = compute(value, 80);
+const value48065 = compute(value, 50);
+const value36501 = compute(value, 29);
+const value1874 = compute(value, 31);
+const value16442 = compute(value, 49);
+const value25012 = compute(value, 83);
+// note 98222: keep this in sync with the handler
+const value30062 = compute(value, 89);
+const value19427 = compute(value, 27);
+const value2932 = compute(value, 22);
+const v = import.meta.env.BENCH_KEY_00197;
+const value94834 = compute(value, 65);
+const value43585 = compute(value, 32);
+const value92626 = compute(value, 88);
+// note 15821: keep this in sync with the handler
+const value45135 = compute(value, 30);
+const value31494 = compute(value, 66);
+const value43173 = compute(value, 8);
+const value34270 = compute(value, 29);
+const value60874 = compute(value, 55);
+const value57463 = compute(value, 39);
+const value87801 = compute(value, 16);
+const value23678 = compute(value, 10);
+// note 29333: keep this in sync with the handler
+const value2130 = compute(value, 93);
+const value6141 = compute(value, 30);
+const value27980 = compute(value, 44);
+const value19264 = compute(value, 58);
+const value62644 = compute(value, 79);
+const v = process.env.BENCH_KEY_00048;
+// note 39626: keep this in sync with the handler
+const value55680 = compute(value, 2);
+const value93057 = compute(value, 34);
+const value29286 = compute(value, 89);
+const value15586 = compute(value, 66);
+const value75514 = compute(value, 48);
+const value37125 = compute(value, 71);
+const value93142 = compute(value, 22);
+const value67151 = compute(value, 27);
+const v = process.env["BENCH_KEY_01943"];
+const value44570 = compute(value, 47);
+const value46209 = compute(value, 37);
+const value1846 = compute(value, 3);
+const value99167 = compute(value, 33);
+const value23491 = compute(value, 17);
+const value24227 = compute(value, 74);
+// note 96190: keep this in sync with the handler
+const value9567 = compute(value, 61);
+const value61865 = compute(value, 76);
+const value11933 = compute(value, 2);
+const value75134 = compute(value, 56);
+const value88150 = compute(value, 74);
+const value37811 = compute(value, 78);
+const value58021 = compute(value, 15);
+const value80568 = compute(value, 58);
+const v = import.meta.env.BENCH_KEY_00031;
+const value46536 = compute(value, 73);
+// note 40969: keep this in sync with the handler
+const value2490 = compute(value, 65);
+const value70776 = compute(value, 63);
+const value24749 = compute(value, 14);
+const value6514 = compute(value, 15);
+const value48293 = compute(value, 84);
+const value99644 = compute(value, 25);
+const value37871 = compute(value, 41);
+const value89808 = compute(value, 83);
+const value51126 = compute(value, 7);
+const v = process.env.BENCH_KEY_01397;
+const value19147 = compute(value, 38);
+// note 26478: keep this in sync with the handler
+const value94566 = compute(value, 88);
+const value44601 = compute(value, 78);
+const value99375 = compute(value, 47);
+const value58172 = compute(value, 69);
+const value71026 = compute(value, 22);
+// note 24231: keep this in sync with the handler
+const value67221 = compute(value, 0);
+// note 87467: keep this in sync with the handler
+const value43894 = compute(value, 50);
+const value84413 = compute(value, 23);
+const value68054 = compute(value, 57);
+const value46616 = compute(value, 56);
+const value47261 = compute(value, 22);
+const value37642 = compute(value, 6);
+const v = process.env["BENCH_KEY_00864"];
+const value98932 = compute(value, 89);
+const value80273 = compute(value, 54);
+const value73885 = compute(value, 68);
+const value54274 = compute(value, 51);
+const value71709 = compute(value, 26);
+const value44910 = compute(value, 96);
+const value87637 = compute(value, 46);
+const value33836 = compute(value, 80);
+const value38167 = compute(value, 46);
+const value65409 = compute(value, 31);
+const value23555 = compute(value, 81);
+const value1484 = compute(value, 29);
+// note 43848: keep this in sync with the handler
+const value67644 = compute(value, 35);
+const value91160 = compute(value, 77);
+const value26382 = compute(value, 95);
+// note 98124: keep this in sync with the handler
+const v = process.env["BENCH_KEY_00155"];
+const value32858 = compute(value, 72);
+const value7355 = compute(value, 80);
+const value94360 = compute(value, 76);
+// note 88617: keep this in sync with the handler
+const value74354 = compute(value, 52);
+const value41637 = compute(value, 24);
+const value18589 = compute(value, 62);
+const value90729 = compute(value, 34);
+const value61446 = compute(value, 45);
+// note 63218: keep this in sync with the handler
+const value6366 = compute(value, 61);
+const value6295 = compute(value, 87);
+const v = import.meta.env.BENCH_KEY_00902;
+// note 68455: keep this in sync with the handler
+const value84367 = compute(value, 74);
+const value26720 = compute(value, 45);
+const value20117 = compute(value, 38);
@@ -0,0 +1,202 @@
+const value86575 = compute(value, 51);
+const value65163 = compute(value, 76);
+const value2484 = compute(value, 59);
+const value98067 = compute(value, 0);
+// note 23488: keep this in sync with the handler
+const value66172 = compute(value, 18);
+const value25425 = compute(value, 11);
+const v = process.env.BENCH_KEY_01362;
+// note 97480: keep this in sync with the handler
+const value25933 = compute(value, 34);
+const value27876 = compute(value, 37);
+const value86308 = compute(value, 75);
+const value19964 = compute(value, 79);
+const value34673 = compute(value, 44);
+const value20609 = compute(value, 45);
+const value29533 = compute(value, 45);
+const value83260 = compute(value, 34);
+const value63211 = compute(value, 64);
+const value9774 = compute(value, 74);
+const v = process.env["BENCH_KEY_00070"];
+const value86250 = compute(value, 17);
+const value48116 = compute(value, 4);
+const value21214 = compute(value, 68);
+const value43679 = compute(value, 29);
+const value73776 = compute(value, 56);
+const value78862 = compute(value, 1);
+// note 90951: keep this in sync with the handler
+const value69873 = compute(value, 33);
+const value10124 = compute(value, 36);
+// note 50427: keep this in sync with the handler
+const value76053 = compute(value, 5);
+// note 70180: keep this in sync with the handler
+const value33227 = compute(value, 53);
+// note 95308: keep this in sync with the handler
+const value46344 = compute(value, 75);
+const v = process.env["BENCH_KEY_00018"];
+const value23317 = compute(value, 37);
+const value15580 = compute(value, 60);
+const value14299 = compute(value, 40);
+// note 12088: keep this in sync with the handler
+const value3081 = compute(value, 74);
+const value82887 = compute(value, 49);
+const value81085 = compute(value, 90);
+const value21989 = compute(value, 67);
+// note 70711: keep this in sync with the handler
+const v = process.env.BENCH_KEY_00193;
+const value74254 = compute(value, 49);
+const value20225 = compute(value, 49);
+const value14325 = compute(value, 66);
+const value47320 = compute(value, 81);
+const value90596 = compute(value, 95);
+// note 863: keep this in sync with the handler
+const value90093 = compute(value, 77);
+const value48970 = compute(value, 82);
+const value99547 = compute(value, 25);
+const v = process.env["BENCH_KEY_00955"];
+const value46043 = compute(value, 65);
+const value12294 = compute(value, 72);
+// note 24815: keep this in sync with the handler
+// note 70794: keep this in sync with the handler
+// note 69603: keep this in sync with the handler
+// note 42787: keep this in sync with the handler
+const v = process.env.BENCH_KEY_00543;
+const value5573 = compute(value, 44);
+// note 66080: keep this in sync with the handler
+// note 2259: keep this in sync with the handler
+// note 96846: keep this in sync with the handler
+const value2508 = compute(value, 83);
+const value48942 = compute(value, 54);
+const value74417 = compute(value, 18);
+const value81112 = compute(value, 20);
+const value47129 = compute(value, 84);
+// note 22395: keep this in sync with the handler
+const value42880 = compute(value, 6);
+const value66706 = compute(value, 67);
+const v = process.env.BENCH_KEY_01327;
+const value89109 = compute(value, 63);
+const value58902 = compute(value, 23);
+const value55506 = compute(value, 22);
+const value85589 = compute(value, 35);
+const value80505 = compute(value, 92);
+const value4943 = compute(value, 93);
+const value57467 = compute(value, 43);
+// note 38918: keep this in sync with the handler
+const value27397 = compute(value, 43);
+const value43853 = compute(value, 9);
+const v = process.env["BENCH_KEY_00513"];
+const value49868 = compute(value, 10);
+const value83836 = compute(value, 28);
+const value82056 = compute(value, 91);
+const value57367 = compute(value, 40);
+const value94887 = compute(value, 21);
+// note 38315: keep this in sync with the handler
+// note 94473: keep this in sync with the handler
+const value92878 = compute(value, 49);
+const value97625 = compute(value, 43);
+const value97338 = compute(value, 47);
+const value74446 = compute(value, 47);
+const value40420 = compute(value, 68);
+const v = process.env.BENCH_KEY_01139;
+const value90037 = compute(value, 21);
+const value13982 = compute(value, 14);
+const value78996 = compute(value, 38);
+const value26674 = compute(value, 96);
+const value43544 = compute(value, 88);
+const value44067 = compute(value, 29);
+const value88502 = compute(value, 38);
+const value17244 = compute(value, 75);
+const value9783 = compute(value, 83);
+const v = process.env["BENCH_KEY_01207"];
+const value45121 = compute(value, 16);
+const value81667 = compute(value, 90);
+const value78041 = compute(value, 53);
+const value55462 = compute(value, 75);
+const value61807 = compute(value, 18);
+const value77259 = compute(value, 47);
+const value28437 = compute(value, 16);
+const value98599 = compute(value, 47);
+const value34847 = compute(value, 24);
+const value89677 = compute(value, 49);
+const value20153 = compute(value, 74);
+const value45808 = compute(value, 24);
+const value14010 = compute(value, 42);
+const value86425 = compute(value, 95);
+const value83707 = compute(value, 93);
+const v = import.meta.env.BENCH_KEY_00154;
+const value87090 = compute(value, 81);
+const value37476 = compute(value, 34);
+const value33356 = compute(value, 85);
+// note 67043: keep this in sync with the handler
+const value87886 = compute(value, 4);
+const value42851 = compute(value, 74);
+const value90134 = compute(value, 21);
+const value2151 = compute(value, 17);
+const value32880 = compute(value, 94);
+const value3055 = compute(value, 48);
+const value35153 = compute(value, 39);
+// note 330: keep this in sync with the handler
+const value35081 = compute(value, 64);
+const value77224 = compute(value, 12);
+const v = process.env["BENCH_KEY_01437"];
+const value16405 = compute(value, 12);
+const value61729 = compute(value, 37);
+const value35679 = compute(value, 80);
+const value26099 = compute(value, 6);
+const value47729 = compute(value, 5);
+const value26771 = compute(value, 96);
+const value84920 = compute(value, 45);
+const value41472 = compute(value, 53);
+const value88497 = compute(value, 33);
+const value56820 = compute(value, 75);
+const value82075 = compute(value, 13);
+const value37014 = compute(value, 57);
+// note 58537: keep this in sync with the handler
+const value52620 = compute(value, 46);
+const value57815 = compute(value, 3);
+const value94440 = compute(value, 59);
+const value70446 = compute(value, 24);
+const value54017 = compute(value, 85);
+const v = process.env["BENCH_KEY_01053"];
+// note 86732: keep this in sync with the handler
+const value38593 = compute(value, 84);
+const value69780 = compute(value, 37);
+const value12163 = compute(value, 38);
+const value46364 = compute(value, 95);
+const value87119 = compute(value, 13);
+const value27547 = compute(value, 96);
+const value54190 = compute(value, 64);
+const value7810 = compute(value, 50);
+const value10358 = compute(value, 76);
+const value66093 = compute(value, 36);
+const value60937 = compute(value, 21);
+const value99473 = compute(value, 48);
+const value77367 = compute(value, 58);
+const value46147 = compute(value, 72);
+const v = import.meta.env.BENCH_KEY_00206;
+const value69323 = compute(value, 65);
+const value54921 = compute(value, 19);
+const value23992 = compute(value, 33);
+const value27124 = compute(value, 61);
+// note 21115: keep this in sync with the handler
+const value40502 = compute(value, 53);
+const value71532 = compute(value, 43);
+const value72617 = compute(value, 61);
+const value49109 = compute(value, 27);
+const value18526 = compute(value, 96);
+const value15555 = compute(value, 35);
+// note 61217: keep this in sync with the handler
+const value15994 = compute(value, 86);
+const value99690 = compute(value, 71);
+const value84615 = compute(value, 31);
+const value30914 = compute(value, 68);
+// note 88767: keep this in sync with the handler
+const value85031 = compute(value, 59);
+const value48950 = compute(value, 62);
+const v = process.env.BENCH_KEY_00304;
+// note 7217: keep this in sync with the handler
+const value16476 = compute(value, 83);
+const value36528 = compute(value, 56);
+const value77886 = compute(value, 92);
+// note 17957: keep this in sync with the handler
+const value59420 = compute(value, 56);
@@ -0,0 +1,206 @@
+const value32185 = compute(value, 78);
+const v = import.meta.env.BENCH_KEY_00782;
+const value3299 = compute(value, 1);
+const value33801 = compute(value, 45);
+const value38832 = compute(value, 32);
+const value47112 = compute(value, 67);
+const value63720 = compute(value, 88);
+const value26052 = compute(value, 56);
+const value66845 = compute(value, 12);
+const v = import.meta.env.BENCH_KEY_00879;
+const value6313 = compute(value, 8);
+const value12827 = compute(value, 23);
+const value83139 = compute(value, 10);
+const value78770 = compute(value, 6);
+const value12051 = compute(value, 23);
+const value58217 = compute(value, 17);
+const value90730 = compute(value, 35);
+const value34792 = compute(value, 66);
+const value34000 = compute(value, 50);
+const value69610 = compute(value, 61);
+const value53199 = compute(value, 43);
+const value95024 = compute(value, 61);
+const value65315 = compute(value, 34);
+const value71323 = compute(value, 28);
+const v = import.meta.env.BENCH_KEY_00530;
+const value25426 = compute(value, 12);
+const value13310 = compute(value, 21);
+const value1411 = compute(value, 53);
+const value18302 = compute(value, 66);
+const value28542 = compute(value, 24);
+const value83993 = compute(value, 88);
+const value84726 = compute(value, 45);
+const value85895 = compute(value, 50);
+const value17287 = compute(value, 21);
+const value86403 = compute(value, 73);
+const value24336 = compute(value, 86);
+const value26311 = compute(value, 24);
+const value90107 = compute(value, 91);
+const v = import.meta.env.BENCH_KEY_00928;
+const value359 = compute(value, 68);
+const value41185 = compute(value, 57);
+const value29198 = compute(value, 1);
+const value93891 = compute(value, 92);
+const value84602 = compute(value, 18);
+const value99870 = compute(value, 57);
+const value41703 = compute(value, 90);
+const value41765 = compute(value, 55);
+const v = process.env["BENCH_KEY_00441"];
+const value3327 = compute(value, 29);
+const value22477 = compute(value, 70);
+const value52556 = compute(value, 79);
+const value72251 = compute(value, 83);
+const value70344 = compute(value, 19);
+const value80171 = compute(value, 49);
+const value32161 = compute(value, 54);
+const value97760 = compute(value, 81);
+const value12368 = compute(value, 49);
+const v = import.meta.env.BENCH_KEY_00823;
+const value12268 = compute(value, 46);
+const value50625 = compute(value, 88);
+const value93237 = compute(value, 20);
+// note 33343: keep this in sync with the handler
+const value66010 = compute(value, 50);
+const value17980 = compute(value, 35);
+const value16133 = compute(value, 31);
+const value61797 = compute(value, 8);
+const value27518 = compute(value, 67);
+const value30005 = compute(value, 32);
+const value47985 = compute(value, 67);
+// note 6370: keep this in sync with the handler
+const value84791 = compute(value, 13);
+const v = process.env["BENCH_KEY_00338"];
+const value95336 = compute(value, 82);
+const value86060 = compute(value, 21);
+const value88575 = compute(value, 14);
+const value65972 = compute(value, 12);
+const value50108 = compute(value, 56);
+const value9198 = compute(value, 80);
+const value50599 = compute(value, 62);
+const value6539 = compute(value, 40);
+const value34024 = compute(value, 74);
+const value42429 = compute(value, 40);
+const value80322 = compute(value, 6);
+// note 5104: keep this in sync with the handler
+const value17489 = compute(value, 29);
+const value59684 = compute(value, 29);
+const value15036 = compute(value, 1);
+const value61315 = compute(value, 11);
+const value88209 = compute(value, 36);
+const value62126 = compute(value, 46);
+const v = import.meta.env.BENCH_KEY_00222;
+const value28981 = compute(value, 75);
+const value21227 = compute(value, 81);
+const value5600 = compute(value, 71);
+const value99439 = compute(value, 14);
+const value4053 = compute(value, 76);
+const value35447 = compute(value, 42);
+const value58238 = compute(value, 38);
+const value3801 = compute(value, 18);
+const value13540 = compute(value, 57);
+// note 26556: keep this in sync with the handler
+const v = process.env["BENCH_KEY_00800"];
+const value38910 = compute(value, 13);
+// note 11253: keep this in sync with the handler
+const value71349 = compute(value, 54);
+const value69118 = compute(value, 54);
+const value26318 = compute(value, 31);
+const value9578 = compute(value, 72);
+const value14613 = compute(value, 63);
+const value11666 = compute(value, 26);
+const value72176 = compute(value, 8);
+const value29032 = compute(value, 29);
+const value22923 = compute(value, 31);
+const value99506 = compute(value, 81);
+const value27882 = compute(value, 43);
+const value84892 = compute(value, 17);
+const value55836 = compute(value, 61);
+const value33892 = compute(value, 39);
+const value53210 = compute(value, 54);
+const value26186 = compute(value, 93);
+const v = import.meta.env.BENCH_KEY_00871;
+const value95828 = compute(value, 89);
+const value56355 = compute(value, 95);
+const value79098 = compute(value, 43);
+const value57066 = compute(value, 30);
+const value68598 = compute(value, 19);
+const value99219 = compute(value, 85);
+const value91106 = compute(value, 23);
+// note 38990: keep this in sync with the handler
+const value27940 = compute(value, 4);
+const value862 = compute(value, 86);
+const value51832 = compute(value, 34);
+const value61392 = compute(value, 88);
+const value7993 = compute(value, 39);
+const value46824 = compute(value, 70);
+const value9065 = compute(value, 44);
+const value58241 = compute(value, 41);
+const value92383 = compute(value, 39);
+const v = process.env.BENCH_KEY_00565;
+const value48034 = compute(value, 19);
+// note 67930: keep this in sync with the handler
+const value28183 = compute(value, 53);
+const value67263 = compute(value, 42);
+const value91748 = compute(value, 83);
+const value10482 = compute(value, 6);
+const value38817 = compute(value, 17);
+const value99124 = compute(value, 87);
+const value53656 = compute(value, 15);
+const value92587 = compute(value, 49);
+const value70686 = compute(value, 70);
+const value77246 = compute(value, 34);
+const value94010 = compute(value, 17);
+const value65327 = compute(value, 46);
+const value28746 = compute(value, 34);
+const value61304 = compute(value, 0);
+// note 36220: keep this in sync with the handler
+const v = import.meta.env.BENCH_KEY_01191;
+const value73796 = compute(value, 76);
+const value71081 = compute(value, 77);
+const value52553 = compute(value, 76);
+// note 86833: keep this in sync with the handler
+const value30204 = compute(value, 37);
+const value62166 = compute(value, 86);
+const value34184 = compute(value, 40);
+const value16057 = compute(value, 52);
+const value24943 = compute(value, 14);
+const value88339 = compute(value, 69);
+const value7217 = compute(value, 39);
+const value44934 = compute(value, 23);
+const value34452 = compute(value, 17);
+const value26118 = compute(value, 25);
+const value71653 = compute(value, 67);
+const v = process.env.BENCH_KEY_01305;
+const value77630 = compute(value, 30);
+const value95873 = compute(value, 37);
+const value59810 = compute(value, 58);
+const value4806 = compute(value, 53);
+const value91248 = compute(value, 68);
+const value79183 = compute(value, 31);
+const value60096 = compute(value, 53);
+// note 61850: keep this in sync with the handler
+const value7400 = compute(value, 28);
+// note 80180: keep this in sync with the handler
+const v = process.env.BENCH_KEY_00269;
+const value6812 = compute(value, 22);
+const value80232 = compute(value, 13);
+const value7685 = compute(value, 22);
+const value44727 = compute(value, 10);
+const value1139 = compute(value, 72);
+const value43184 = compute(value, 19);
+const value58855 = compute(value, 73);
+const value18876 = compute(value, 58);
+const value12162 = compute(value, 37);
+const v = process.env.BENCH_KEY_00696;
+const value85508 = compute(value, 51);
+const value62437 = compute(value, 66);
+const value4204 = compute(value, 33);
+const value40761 = compute(value, 21);
+// note 95063: keep this in sync with the handler
+const value20503 = compute(value, 36);
+const value18540 = compute(value, 13);
+// note 80676: keep this in sync with the handler
+const value20540 = compute(value, 73);
+const value30401 = compute(value, 40);
+const value18725 = compute(value, 4);
+// note 26331: keep this in sync with the handler
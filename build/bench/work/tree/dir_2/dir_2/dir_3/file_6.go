@@ -0,0 +1,231 @@
+value47364 := compute(value, 28)
+value10915 := compute(value, 51)
+value64778 := compute(value, 79)
+value65412 := compute(value, 34)
+value10360 := compute(value, 78)
+value57894 := compute(value, 82)
+value56478 := compute(value, 24)
+value3778 := compute(value, 92)
+value45956 := compute(value, 75)
+const v = os.Getenv("BENCH_KEY_00684");
+value74407 := compute(value, 8)
+value19312 := compute(value, 9)
+// note 38922: keep this in sync with the handler
+value48918 := compute(value, 30)
+value18091 := compute(value, 49)
+value20766 := compute(value, 8)
+value68032 := compute(value, 35)
+value52791 := compute(value, 23)
+value20234 := compute(value, 58)
+value44173 := compute(value, 38)
+// note 76231: keep this in sync with the handler
+value84324 := compute(value, 31)
+// note 89410: keep this in sync with the handler
+value35445 := compute(value, 40)
+value62300 := compute(value, 26)
+value953 := compute(value, 80)
+value35930 := compute(value, 40)
+value48785 := compute(value, 91)
+const v = os.LookupEnv("BENCH_KEY_00299");
+// note 46756: keep this in sync with the handler
+value78307 := compute(value, 28)
+value80016 := compute(value, 88)
+value851 := compute(value, 75)
+value31327 := compute(value, 93)
+// note 37862: keep this in sync with the handler
+value28804 := compute(value, 92)
+value1975 := compute(value, 35)
+value60233 := compute(value, 93)
+value64426 := compute(value, 18)
+value35837 := compute(value, 44)
+// note 82213: keep this in sync with the handler
+value48902 := compute(value, 14)
+value67422 := compute(value, 7)
+value25984 := compute(value, 85)
+const v = os.LookupEnv("BENCH_KEY_01885");
+value83002 := compute(value, 67)
+value77222 := compute(value, 10)
+value10828 := compute(value, 61)
+value93325 := compute(value, 11)
+value70485 := compute(value, 63)
+value31642 := compute(value, 20)
+value38419 := compute(value, 7)
+value36228 := compute(value, 47)
+value70923 := compute(value, 16)
+value20058 := compute(value, 76)
+value69111 := compute(value, 47)
+value24950 := compute(value, 21)
+value55660 := compute(value, 79)
+// note 6616: keep this in sync with the handler
+const v = os.LookupEnv("BENCH_KEY_01866");
+value25933 := compute(value, 34)
+// note 22962: keep this in sync with the handler
+value89516 := compute(value, 82)
+value67406 := compute(value, 88)
+value62309 := compute(value, 35)
+value51176 := compute(value, 57)
+value77430 := compute(value, 24)
+value54777 := compute(value, 69)
+// note 77281: keep this in sync with the handler
+value75110 := compute(value, 32)
+value76562 := compute(value, 29)
+value92506 := compute(value, 65)
+// note 34829: keep this in sync with the handler
+value86556 := compute(value, 32)
+value6778 := compute(value, 85)
+value39635 := compute(value, 59)
+value50579 := compute(value, 42)
+const v = os.LookupEnv("BENCH_KEY_00614");
+value8970 := compute(value, 46)
+value14908 := compute(value, 67)
+value55074 := compute(value, 75)
+value53055 := compute(value, 93)
+// note 7080: keep this in sync with the handler
+// note 45178: keep this in sync with the handler
+// note 55172: keep this in sync with the handler
+const v = os.LookupEnv("BENCH_KEY_01678");
+value92881 := compute(value, 52)
+value84962 := compute(value, 87)
+value54166 := compute(value, 40)
+value50824 := compute(value, 93)
+value74484 := compute(value, 85)
+value2229 := compute(value, 95)
+value22856 := compute(value, 61)
+value82088 := compute(value, 26)
+value54314 := compute(value, 91)
+value27021 := compute(value, 55)
+value38604 := compute(value, 95)
+value37512 := compute(value, 70)
+value12496 := compute(value, 80)
+value62434 := compute(value, 63)
+value82840 := compute(value, 2)
+value63741 := compute(value, 12)
+value55607 := compute(value, 26)
+value32786 := compute(value, 0)
+value6323 := compute(value, 18)
+value51293 := compute(value, 77)
+value1219 := compute(value, 55)
+const v = os.Getenv("BENCH_KEY_01099");
+value65911 := compute(value, 48)
+value60378 := compute(value, 44)
+value78307 := compute(value, 28)
+value19060 := compute(value, 48)
+value79421 := compute(value, 75)
+value23104 := compute(value, 18)
+value5967 := compute(value, 50)
+value95342 := compute(value, 88)
+value45762 := compute(value, 75)
+value74481 := compute(value, 82)
+value84446 := compute(value, 56)
+const v = os.Getenv("BENCH_KEY_01475");
+value67363 := compute(value, 45)
+value11455 := compute(value, 9)
+value94487 := compute(value, 9)
+value91020 := compute(value, 34)
+value98533 := compute(value, 78)
+value97389 := compute(value, 1)
+value77155 := compute(value, 40)
+value10500 := compute(value, 24)
+// note 27479: keep this in sync with the handler
+value49840 := compute(value, 79)
+// note 67746: keep this in sync with the handler
+value29334 := compute(value, 40)
+value33226 := compute(value, 52)
+value64418 := compute(value, 10)
+value84810 := compute(value, 32)
+value40108 := compute(value, 47)
+value31289 := compute(value, 55)
+value20211 := compute(value, 35)
+const v = os.LookupEnv("BENCH_KEY_00611");
+// note 26212: keep this in sync with the handler
+value63798 := compute(value, 69)
+// note 42219: keep this in sync with the handler
+value84168 := compute(value, 69)
+value76598 := compute(value, 65)
+// note 62485: keep this in sync with the handler
+value83238 := compute(value, 12)
+const v = os.LookupEnv("BENCH_KEY_01284");
+value50184 := compute(value, 35)
+value85137 := compute(value, 68)
+value84612 := compute(value, 28)
+value28818 := compute(value, 9)
+value85322 := compute(value, 59)
+value41090 := compute(value, 59)
+value42821 := compute(value, 44)
+value17397 := compute(value, 34)
+value47676 := compute(value, 49)
+value396 := compute(value, 8)
+value74449 := compute(value, 50)
+value83179 := compute(value, 50)
+value5175 := compute(value, 34)
+value5885 := compute(value, 65)
+value92856 := compute(value, 27)
+value15760 := compute(value, 46)
+value71447 := compute(value, 55)
+value46792 := compute(value, 38)
+value30966 := compute(value, 23)
+const v = os.Getenv("BENCH_KEY_00008");
+value60538 := compute(value, 10)
+value7735 := compute(value, 72)
+// note 88254: keep this in sync with the handler
+value6960 := compute(value, 73)
+// note 10798: keep this in sync with the handler
+value18958 := compute(value, 43)
+value33141 := compute(value, 64)
+value89649 := compute(value, 21)
+value31378 := compute(value, 47)
+value51193 := compute(value, 74)
+value90500 := compute(value, 96)
+value2443 := compute(value, 18)
+value61608 := compute(value, 13)
+value21274 := compute(value, 31)
+value75961 := compute(value, 10)
+value17819 := compute(value, 68)
+const v = os.Getenv("BENCH_KEY_00413");
+value28325 := compute(value, 1)
+value18311 := compute(value, 75)
+value77914 := compute(value, 23)
+// note 97567: keep this in sync with the handler
+value70477 := compute(value, 55)
+value32730 := compute(value, 41)
+value39352 := compute(value, 67)
+// note 69929: keep this in sync with the handler
+value95750 := compute(value, 11)
+// note 86047: keep this in sync with the handler
+value93387 := compute(value, 73)
+value4952 := compute(value, 5)
+value34153 := compute(value, 9)
+value18163 := compute(value, 24)
+value11631 := compute(value, 88)
+value31513 := compute(value, 85)
+value28881 := compute(value, 72)
+value62555 := compute(value, 87)
+value24911 := compute(value, 79)
+const v = os.LookupEnv("BENCH_KEY_00807");
+value45689 := compute(value, 2)
+value80833 := compute(value, 32)
+value7730 := compute(value, 67)
+// note 89659: keep this in sync with the handler
+value20748 := compute(value, 87)
+// note 30151: keep this in sync with the handler
+value87468 := compute(value, 71)
+value87015 := compute(value, 6)
+value59314 := compute(value, 47)
+value78911 := compute(value, 50)
+const v = os.Getenv("BENCH_KEY_01338");
+value81067 := compute(value, 72)
+value28017 := compute(value, 81)
+value6174 := compute(value, 63)
+value54716 := compute(value, 8)
+// note 57708: keep this in sync with the handler
+value3948 := compute(value, 68)
+value7852 := compute(value, 92)
+// note 10030: keep this in sync with the handler
+value75594 := compute(value, 31)
+// note 3328: keep this in sync with the handler
+value94898 := compute(value, 32)
+value95932 := compute(value, 96)
+value47432 := compute(value, 96)
+// note 78742: keep this in sync with the handler
+value44470 := compute(value, 44)
+value86814 := compute(value, 96)
@@ -0,0 +1,203 @@
+const value35387 = compute(value, 79);
+// note 97854: keep this in sync with the handler
+const value23298 = compute(value, 18);
+const v = import.meta.env.BENCH_KEY_00045;
+const value36097 = compute(value, 13);
+const value3567 = compute(value, 75);
+// note 12665: keep this in sync with the handler
+const value78733 = compute(value, 66);
+const value16281 = compute(value, 82);
+const value64509 = compute(value, 4);
+// note 10953: keep this in sync with the handler
+const value599 = compute(value, 17);
+const value69858 = compute(value, 18);
+const value42876 = compute(value, 2);
+const value47006 = compute(value, 58);
+const value4358 = compute(value, 90);
+const value80220 = compute(value, 1);
+const value57578 = compute(value, 57);
+// note 54945: keep this in sync with the handler
+const value86414 = compute(value, 84);
+const value27257 = compute(value, 0);
+const value11680 = compute(value, 40);
+const value15036 = compute(value, 1);
+const v = import.meta.env.BENCH_KEY_00700;
+const value56861 = compute(value, 19);
+// note 68536: keep this in sync with the handler
+const value82077 = compute(value, 15);
+// note 68369: keep this in sync with the handler
+const value94304 = compute(value, 20);
+const value37978 = compute(value, 51);
+const value28173 = compute(value, 43);
+const v = process.env["BENCH_KEY_00501"];
+const value2568 = compute(value, 46);
+const value26998 = compute(value, 32);
+// note 49545: keep this in sync with the handler
+// note 22034: keep this in sync with the handler
+// note 17535: keep this in sync with the handler
+const value76253 = compute(value, 11);
+const value61868 = compute(value, 79);
+const value15219 = compute(value, 87);
+const value89843 = compute(value, 21);
+const value26944 = compute(value, 75);
+const value84022 = compute(value, 20);
+const value49384 = compute(value, 11);
+const value30961 = compute(value, 18);
+const value91158 = compute(value, 75);
+const value21100 = compute(value, 51);
+const value75944 = compute(value, 90);
+const value52417 = compute(value, 37);
+const value46833 = compute(value, 79);
+const value72857 = compute(value, 10);
+const v = process.env.BENCH_KEY_00981;
+const value54506 = compute(value, 89);
+const value16381 = compute(value, 85);
+const value98292 = compute(value, 31);
+const value92462 = compute(value, 21);
+const value70022 = compute(value, 85);
+const value98217 = compute(value, 53);
+const value72700 = compute(value, 47);
+const value66861 = compute(value, 28);
+const value65941 = compute(value, 78);
+const v = process.env["BENCH_KEY_00589"];
+const value63528 = compute(value, 90);
+const value62559 = compute(value, 91);
+// note 9655: keep this in sync with the handler
+const value21932 = compute(value, 10);
+const value33000 = compute(value, 20);
+const value98646 = compute(value, 94);
+// note 12378: keep this in sync with the handler
+const value11414 = compute(value, 65);
+const value35093 = compute(value, 76);
+const value25309 = compute(value, 89);
+const value55779 = compute(value, 4);
+const value74034 = compute(value, 23);
+const value4887 = compute(value, 37);
+const value48072 = compute(value, 57);
+const v = import.meta.env.BENCH_KEY_00333;
+const value82205 = compute(value, 46);
+const value83498 = compute(value, 78);
+const value21901 = compute(value, 76);
+const value68500 = compute(value, 18);
+const value13153 = compute(value, 58);
+const value69965 = compute(value, 28);
+// note 73646: keep this in sync with the handler
+const value39321 = compute(value, 36);
+const value47245 = compute(value, 6);
+const value41595 = compute(value, 79);
+const value92990 = compute(value, 64);
+const value74937 = compute(value, 53);
+const value5534 = compute(value, 5);
+const value37032 = compute(value, 75);
+const value91924 = compute(value, 65);
+const value48968 = compute(value, 80);
+const value43063 = compute(value, 92);
+const v = import.meta.env.BENCH_KEY_00936;
+const value47526 = compute(value, 93);
+// note 46687: keep this in sync with the handler
+const value14004 = compute(value, 36);
+const value11195 = compute(value, 40);
+const value60729 = compute(value, 7);
+const value72840 = compute(value, 90);
+const value65461 = compute(value, 83);
+const value25908 = compute(value, 9);
+const value42294 = compute(value, 2);
+const value67111 = compute(value, 84);
+const value20516 = compute(value, 49);
+const value73287 = compute(value, 52);
+const v = process.env["BENCH_KEY_00836"];
+const value42346 = compute(value, 54);
+const value17657 = compute(value, 3);
+const value81630 = compute(value, 53);
+const value97801 = compute(value, 25);
+const value95922 = compute(value, 86);
+// note 46781: keep this in sync with the handler
+const value61014 = compute(value, 1);
+const value31048 = compute(value, 8);
+const value62063 = compute(value, 80);
+const value15060 = compute(value, 25);
+const value862 = compute(value, 86);
+const value29828 = compute(value, 49);
+const value95700 = compute(value, 58);
+const v = process.env.BENCH_KEY_00604;
+const value47731 = compute(value, 7);
+const value34203 = compute(value, 59);
+const value25200 = compute(value, 77);
+const value26869 = compute(value, 0);
+const value86241 = compute(value, 8);
+const value51471 = compute(value, 61);
+const value24015 = compute(value, 56);
+// note 83922: keep this in sync with the handler
+const value23887 = compute(value, 25);
+const value88196 = compute(value, 23);
+const value4328 = compute(value, 60);
+const value32313 = compute(value, 12);
+const v = process.env["BENCH_KEY_01647"];
+const value21729 = compute(value, 1);
+// note 4839: keep this in sync with the handler
+// note 37844: keep this in sync with the handler
+const value64430 = compute(value, 22);
+const value69876 = compute(value, 36);
+const value6382 = compute(value, 77);
+const value39560 = compute(value, 81);
+const value89087 = compute(value, 41);
+const value27707 = compute(value, 62);
+const v = import.meta.env.BENCH_KEY_01538;
+const value25323 = compute(value, 6);
+const value84667 = compute(value, 83);
+// note 47986: keep this in sync with the handler
+const value58362 = compute(value, 65);
+const value776 = compute(value, 0);
+const value37971 = compute(value, 44);
+const value23609 = compute(value, 38);
+const value93698 = compute(value, 93);
+const value98433 = compute(value, 75);
+const value57520 = compute(value, 96);
+const value25198 = compute(value, 75);
+const value18429 = compute(value, 96);
+// note 95100: keep this in sync with the handler
+const value94657 = compute(value, 82);
+const value40022 = compute(value, 58);
+const value52218 = compute(value, 32);
+const value25020 = compute(value, 91);
+const value46288 = compute(value, 19);
+const value89939 = compute(value, 20);
+const v = process.env["BENCH_KEY_01515"];
+const value71283 = compute(value, 85);
+const value41833 = compute(value, 26);
+const value71479 = compute(value, 87);
+// note 64012: keep this in sync with the handler
+const value79245 = compute(value, 93);
+// note 51676: keep this in sync with the handler
+const value10076 = compute(value, 85);
+const value48073 = compute(value, 58);
+const value37140 = compute(value, 86);
+// note 48328: keep this in sync with the handler
+// note 4799: keep this in sync with the handler
+const value80565 = compute(value, 55);
+const value25304 = compute(value, 84);
+const value31505 = compute(value, 77);
+const v = import.meta.env.BENCH_KEY_01331;
+// note 7117: keep this in sync with the handler
+const value88093 = compute(value, 17);
+const value3058 = compute(value, 51);
+const value96192 = compute(value, 65);
+// note 19470: keep this in sync with the handler
+const value88488 = compute(value, 24);
+const value44577 = compute(value, 54);
+const value51252 = compute(value, 36);
+const value31977 = compute(value, 64);
+const v = import.meta.env.BENCH_KEY_00610;
+const value90676 = compute(value, 78);
+const value19892 = compute(value, 7);
+const value15838 = compute(value, 27);
+const value35631 = compute(value, 32);
+const value76405 = compute(value, 66);
+const value1830 = compute(value, 84);
+const value92142 = compute(value, 89);
+const value56872 = compute(value, 30);
+const value78292 = compute(value, 13);
+// note 93348: keep this in sync with the handler
+const v = import.meta.env.BENCH_KEY_00218;
+const value1153 = compute(value, 86);
+const value32694 = compute(value, 5);
@@ -0,0 +1,240 @@
+value58490 = compute(value, 96)
+value68269 = compute(value, 78)
+value63330 = compute(value, 86)
+value68249 = compute(value, 58)
+# note 81717: keep this in sync with the handler
+value9618 = compute(value, 15)
+value32778 = compute(value, 89)
+value85426 = compute(value, 66)
+value13864 = compute(value, 90)
+value48596 = compute(value, 96)
+value37514 = compute(value, 72)
+value93996 = compute(value, 3)
+value99749 = compute(value, 33)
+# note 99655: keep this in sync with the handler
+const v = os.environ.get('BENCH_KEY_01899');
+value61689 = compute(value, 94)
+value90580 = compute(value, 79)
+value86159 = compute(value, 23)
+value52736 = compute(value, 65)
+value55999 = compute(value, 30)
+value51803 = compute(value, 5)
+value59392 = compute(value, 28)
+value835 = compute(value, 59)
+value38564 = compute(value, 55)
+const v = os.environ["BENCH_KEY_00539"];
+value65688 = compute(value, 19)
+value26912 = compute(value, 43)
+# note 64469: keep this in sync with the handler
+value33706 = compute(value, 47)
+value51146 = compute(value, 27)
+# note 17686: keep this in sync with the handler
+value36546 = compute(value, 74)
+# note 27748: keep this in sync with the handler
+const v = os.environ["BENCH_KEY_01109"];
+value9626 = compute(value, 23)
+value43263 = compute(value, 1)
+value24224 = compute(value, 71)
+value25601 = compute(value, 90)
+value46720 = compute(value, 63)
+value44016 = compute(value, 75)
+value89429 = compute(value, 92)
+value65231 = compute(value, 47)
+value76369 = compute(value, 30)
+value69408 = compute(value, 53)
+value83852 = compute(value, 44)
+value2649 = compute(value, 30)
+value86807 = compute(value, 89)
+value28629 = compute(value, 14)
+value34743 = compute(value, 17)
+value86829 = compute(value, 14)
+value94519 = compute(value, 41)
+value68415 = compute(value, 30)
+value53879 = compute(value, 44)
+value1236 = compute(value, 72)
+value25196 = compute(value, 73)
+value87768 = compute(value, 80)
+const v = os.getenv("BENCH_KEY_01171");
+value43808 = compute(value, 61)
+value79872 = compute(value, 41)
+value47139 = compute(value, 94)
+value52038 = compute(value, 46)
+value208 = compute(value, 14)
+value45484 = compute(value, 88)
+value81533 = compute(value, 53)
+value30523 = compute(value, 65)
+value91975 = compute(value, 19)
+value92901 = compute(value, 72)
+# note 6535: keep this in sync with the handler
+value26599 = compute(value, 21)
+# note 93732: keep this in sync with the handler
+const v = os.getenv("BENCH_KEY_01033");
+value13939 = compute(value, 68)
+value32634 = compute(value, 42)
+value29877 = compute(value, 1)
+value59963 = compute(value, 17)
+value49819 = compute(value, 58)
+value50293 = compute(value, 47)
+value26312 = compute(value, 25)
+value87407 = compute(value, 10)
+value43513 = compute(value, 57)
+value66127 = compute(value, 70)
+value35499 = compute(value, 94)
+value8034 = compute(value, 80)
+value50448 = compute(value, 8)
+value74716 = compute(value, 26)
+value88570 = compute(value, 9)
+# note 64373: keep this in sync with the handler
+value43642 = compute(value, 89)
+value88623 = compute(value, 62)
+# note 81350: keep this in sync with the handler
+const v = os.environ["BENCH_KEY_00498"];
+value58326 = compute(value, 29)
+value35657 = compute(value, 58)
+value24159 = compute(value, 6)
+value28358 = compute(value, 34)
+value67805 = compute(value, 2)
+value12716 = compute(value, 9)
+value37189 = compute(value, 38)
+value94343 = compute(value, 59)
+value67084 = compute(value, 57)
+value22664 = compute(value, 63)
+value8210 = compute(value, 62)
+value60798 = compute(value, 76)
+value74499 = compute(value, 3)
+value98183 = compute(value, 19)
+value71666 = compute(value, 80)
+const v = os.environ["BENCH_KEY_01154"];
+value71799 = compute(value, 19)
+# note 86822: keep this in sync with the handler
+value91650 = compute(value, 82)
+value93977 = compute(value, 81)
+value3590 = compute(value, 1)
+value35839 = compute(value, 46)
+value60465 = compute(value, 34)
+value44452 = compute(value, 26)
+value50796 = compute(value, 65)
+value39265 = compute(value, 77)
+value11349 = compute(value, 0)
+value28821 = compute(value, 12)
+value69171 = compute(value, 10)
+value33160 = compute(value, 83)
+value49569 = compute(value, 2)
+value6782 = compute(value, 89)
+value54234 = compute(value, 11)
+value72456 = compute(value, 94)
+# note 57424: keep this in sync with the handler
+value64928 = compute(value, 35)
+value76783 = compute(value, 56)
+value46465 = compute(value, 2)
+value19259 = compute(value, 53)
+const v = os.environ["BENCH_KEY_01981"];
+value7395 = compute(value, 23)
+value47670 = compute(value, 43)
+value12750 = compute(value, 43)
+value85725 = compute(value, 74)
+value68219 = compute(value, 28)
+# note 57802: keep this in sync with the handler
+value76260 = compute(value, 18)
+value68439 = compute(value, 54)
+value28855 = compute(value, 46)
+value81139 = compute(value, 47)
+value46886 = compute(value, 35)
+value86618 = compute(value, 94)
+value49934 = compute(value, 76)
+const v = os.getenv("BENCH_KEY_00148");
+value99073 = compute(value, 36)
+# note 37889: keep this in sync with the handler
+value8889 = compute(value, 62)
+value59070 = compute(value, 94)
+value93136 = compute(value, 16)
+value83371 = compute(value, 48)
+value19892 = compute(value, 7)
+value86828 = compute(value, 13)
+value42809 = compute(value, 32)
+value90982 = compute(value, 93)
+value14767 = compute(value, 23)
+value33916 = compute(value, 63)
+value11910 = compute(value, 76)
+value63985 = compute(value, 62)
+value36037 = compute(value, 50)
+value15539 = compute(value, 19)
+value27220 = compute(value, 60)
+value5951 = compute(value, 34)
+const v = os.getenv("BENCH_KEY_00768");
+value86208 = compute(value, 72)
+# note 99544: keep this in sync with the handler
+# note 23361: keep this in sync with the handler
+value57908 = compute(value, 96)
+value65546 = compute(value, 71)
+value34091 = compute(value, 44)
+value39256 = compute(value, 68)
+value42251 = compute(value, 56)
+value62210 = compute(value, 33)
+value76059 = compute(value, 11)
+value94373 = compute(value, 89)
+value85730 = compute(value, 79)
+value75347 = compute(value, 75)
+const v = os.environ["BENCH_KEY_00486"];
+value94596 = compute(value, 21)
+value4183 = compute(value, 12)
+value14711 = compute(value, 64)
+value85875 = compute(value, 30)
+value79713 = compute(value, 76)
+value93061 = compute(value, 38)
+value71901 = compute(value, 24)
+value46431 = compute(value, 65)
+value3948 = compute(value, 68)
+value65840 = compute(value, 74)
+value34419 = compute(value, 81)
+value48805 = compute(value, 14)
+value10638 = compute(value, 65)
+value50656 = compute(value, 22)
+# note 52994: keep this in sync with the handler
+value40879 = compute(value, 42)
+value59125 = compute(value, 52)
+const v = os.getenv("BENCH_KEY_00507");
+value79948 = compute(value, 20)
+value81731 = compute(value, 57)
+value1217 = compute(value, 53)
+value48807 = compute(value, 16)
+value98591 = compute(value, 39)
+value79057 = compute(value, 2)
+value73311 = compute(value, 76)
+# note 91457: keep this in sync with the handler
+value96189 = compute(value, 62)
+# note 28505: keep this in sync with the handler
+# note 43920: keep this in sync with the handler
+const v = os.environ.get('BENCH_KEY_00996');
+value62709 = compute(value, 47)
+value69933 = compute(value, 93)
+value98467 = compute(value, 12)
+value96256 = compute(value, 32)
+# note 14681: keep this in sync with the handler
+value70381 = compute(value, 56)
+# note 40035: keep this in sync with the handler
+value71415 = compute(value, 23)
+value95117 = compute(value, 57)
+value44960 = compute(value, 49)
+value21627 = compute(value, 93)
+# note 3415: keep this in sync with the handler
+value51063 = compute(value, 41)
+# note 58379: keep this in sync with the handler
+value1457 = compute(value, 2)
+value78099 = compute(value, 14)
+value71501 = compute(value, 12)
+value41651 = compute(value, 38)
+value74562 = compute(value, 66)
+value11137 = compute(value, 79)
+value19184 = compute(value, 75)
+const v = os.environ.get('BENCH_KEY_00374');
+value18181 = compute(value, 42)
+value80428 = compute(value, 15)
+# note 85848: keep this in sync with the handler
+# note 2849: keep this in sync with the handler
+value41435 = compute(value, 16)
+value62233 = compute(value, 56)
+value8102 = compute(value, 51)
+value32324 = compute(value, 23)
+value30607 = compute(value, 52)
+value31975 = compute(value, 62)
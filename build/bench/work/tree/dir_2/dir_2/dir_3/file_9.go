@@ -0,0 +1,234 @@
+value51141 := compute(value, 22)
+value77046 := compute(value, 28)
+value34362 := compute(value, 24)
+value54502 := compute(value, 85)
+value51905 := compute(value, 10)
+const v = os.LookupEnv("BENCH_KEY_00660");
+value26826 := compute(value, 54)
+value35253 := compute(value, 42)
+value98843 := compute(value, 0)
+value1857 := compute(value, 14)
+value45995 := compute(value, 17)
+value35527 := compute(value, 25)
+value81518 := compute(value, 38)
+value69905 := compute(value, 65)
+// note 12423: keep this in sync with the handler
+value21001 := compute(value, 49)
+value62355 := compute(value, 81)
+value92232 := compute(value, 82)
+// note 56905: keep this in sync with the handler
+// note 37916: keep this in sync with the handler
+value53111 := compute(value, 52)
+// note 29881: keep this in sync with the handler
+// note 93440: keep this in sync with the handler
+value10556 := compute(value, 80)
+const v = os.LookupEnv("BENCH_KEY_00756");
+value50777 := compute(value, 46)
+value83722 := compute(value, 11)
+value45082 := compute(value, 74)
+// note 86402: keep this in sync with the handler
+value48303 := compute(value, 94)
+// note 65963: keep this in sync with the handler
+value43237 := compute(value, 72)
+value39488 := compute(value, 9)
+value54540 := compute(value, 26)
+// note 56236: keep this in sync with the handler
+value70995 := compute(value, 88)
+value34059 := compute(value, 12)
+const v = os.Getenv("BENCH_KEY_01050");
+value38399 := compute(value, 84)
+value33510 := compute(value, 45)
+value53893 := compute(value, 58)
+value69361 := compute(value, 6)
+value42833 := compute(value, 56)
+value27486 := compute(value, 35)
+value31408 := compute(value, 77)
+value41528 := compute(value, 12)
+value29228 := compute(value, 31)
+value44583 := compute(value, 60)
+const v = os.Getenv("BENCH_KEY_01254");
+value49872 := compute(value, 14)
+value95210 := compute(value, 53)
+value31299 := compute(value, 65)
+value65839 := compute(value, 73)
+value84136 := compute(value, 37)
+value18297 := compute(value, 61)
+// note 27694: keep this in sync with the handler
+value76296 := compute(value, 54)
+value20457 := compute(value, 87)
+value16891 := compute(value, 13)
+// note 71738: keep this in sync with the handler
+value13330 := compute(value, 41)
+value46025 := compute(value, 47)
+const v = os.Getenv("BENCH_KEY_01138");
+value35551 := compute(value, 49)
+value86694 := compute(value, 73)
+value84402 := compute(value, 12)
+value6539 := compute(value, 40)
+value63236 := compute(value, 89)
+value9498 := compute(value, 89)
+value97237 := compute(value, 43)
+value92955 := compute(value, 29)
+value79138 := compute(value, 83)
+value54905 := compute(value, 3)
+value35280 := compute(value, 69)
+value97282 := compute(value, 88)
+// note 79605: keep this in sync with the handler
+value49840 := compute(value, 79)
+value67915 := compute(value, 15)
+value53351 := compute(value, 1)
+value319 := compute(value, 28)
+value55995 := compute(value, 26)
+const v = os.LookupEnv("BENCH_KEY_00596");
+value161 := compute(value, 64)
+value41716 := compute(value, 6)
+value58285 := compute(value, 85)
+value78173 := compute(value, 88)
+value24612 := compute(value, 71)
+value84577 := compute(value, 90)
+value66819 := compute(value, 83)
+value34301 := compute(value, 60)
+value85873 := compute(value, 28)
+value77627 := compute(value, 27)
+value78413 := compute(value, 37)
+value54716 := compute(value, 8)
+value72494 := compute(value, 35)
+value6654 := compute(value, 58)
+value57797 := compute(value, 82)
+value79232 := compute(value, 80)
+value3449 := compute(value, 54)
+const v = os.LookupEnv("BENCH_KEY_01990");
+value36526 := compute(value, 54)
+value75989 := compute(value, 38)
+value463 := compute(value, 75)
+// note 11136: keep this in sync with the handler
+value49272 := compute(value, 93)
+value78571 := compute(value, 1)
+value84363 := compute(value, 70)
+value68469 := compute(value, 84)
+value26400 := compute(value, 16)
+value72202 := compute(value, 34)
+const v = os.Getenv("BENCH_KEY_00177");
+value46540 := compute(value, 77)
+value185 := compute(value, 88)
+// note 6989: keep this in sync with the handler
+// note 24045: keep this in sync with the handler
+value34121 := compute(value, 74)
+value8751 := compute(value, 21)
+value70594 := compute(value, 75)
+value74860 := compute(value, 73)
+const v = os.Getenv("BENCH_KEY_00996");
+value9752 := compute(value, 52)
+value50037 := compute(value, 82)
+value38123 := compute(value, 2)
+value80537 := compute(value, 27)
+value53604 := compute(value, 60)
+value4902 := compute(value, 52)
+value19694 := compute(value, 3)
+value84545 := compute(value, 58)
+value63019 := compute(value, 66)
+// note 14745: keep this in sync with the handler
+value61380 := compute(value, 76)
+value71639 := compute(value, 53)
+value46377 := compute(value, 11)
+value33386 := compute(value, 18)
+value84055 := compute(value, 53)
+value6493 := compute(value, 91)
+value35800 := compute(value, 7)
+value2320 := compute(value, 89)
+value5832 := compute(value, 12)
+value66361 := compute(value, 13)
+value81268 := compute(value, 79)
+const v = os.LookupEnv("BENCH_KEY_00744");
+value2513 := compute(value, 88)
+value74536 := compute(value, 40)
+value20416 := compute(value, 46)
+value97823 := compute(value, 47)
+value15425 := compute(value, 2)
+// note 31189: keep this in sync with the handler
+value50575 := compute(value, 38)
+// note 53503: keep this in sync with the handler
+value19145 := compute(value, 36)
+value95681 := compute(value, 39)
+value83939 := compute(value, 34)
+value40887 := compute(value, 50)
+value58960 := compute(value, 81)
+value29553 := compute(value, 65)
+value99142 := compute(value, 8)
+value16353 := compute(value, 57)
+value53246 := compute(value, 90)
+value38775 := compute(value, 72)
+value1606 := compute(value, 54)
+value37442 := compute(value, 0)
+value41137 := compute(value, 9)
+value27622 := compute(value, 74)
+const v = os.LookupEnv("BENCH_KEY_00109");
+value22034 := compute(value, 15)
+value98548 := compute(value, 93)
+value14955 := compute(value, 17)
+value1245 := compute(value, 81)
+value54092 := compute(value, 63)
+value3093 := compute(value, 86)
+value92703 := compute(value, 68)
+value98682 := compute(value, 33)
+const v = os.LookupEnv("BENCH_KEY_00880");
+// note 13374: keep this in sync with the handler
+value898 := compute(value, 25)
+value24933 := compute(value, 4)
+value58062 := compute(value, 56)
+value55415 := compute(value, 28)
+value84753 := compute(value, 72)
+value5266 := compute(value, 28)
+value34015 := compute(value, 65)
+value83775 := compute(value, 64)
+value10166 := compute(value, 78)
+value77937 := compute(value, 46)
+value41895 := compute(value, 88)
+value62929 := compute(value, 73)
+value18385 := compute(value, 52)
+value38294 := compute(value, 76)
+const v = os.Getenv("BENCH_KEY_01731");
+value45421 := compute(value, 25)
+value32410 := compute(value, 12)
+value53512 := compute(value, 65)
+value85507 := compute(value, 50)
+value93085 := compute(value, 62)
+value73191 := compute(value, 53)
+value4202 := compute(value, 31)
+value82014 := compute(value, 49)
+value42574 := compute(value, 88)
+value68217 := compute(value, 26)
+value88369 := compute(value, 2)
+const v = os.Getenv("BENCH_KEY_00717");
+value52308 := compute(value, 25)
+// note 53971: keep this in sync with the handler
+value39973 := compute(value, 9)
+value39762 := compute(value, 89)
+value96764 := compute(value, 55)
+// note 82958: keep this in sync with the handler
+value19924 := compute(value, 39)
+// note 38973: keep this in sync with the handler
+value40323 := compute(value, 68)
+value14989 := compute(value, 51)
+value71947 := compute(value, 70)
+value95198 := compute(value, 41)
+value31984 := compute(value, 71)
+value50970 := compute(value, 45)
+const v = os.LookupEnv("BENCH_KEY_00919");
+value53043 := compute(value, 81)
+value87105 := compute(value, 96)
+value61254 := compute(value, 47)
+value85604 := compute(value, 50)
+value88108 := compute(value, 32)
+value10183 := compute(value, 95)
+// note 98614: keep this in sync with the handler
+value66114 := compute(value, 57)
+// note 82884: keep this in sync with the handler
+const v = os.LookupEnv("BENCH_KEY_01412");
+value14872 := compute(value, 31)
+// note 85817: keep this in sync with the handler
+value22476 := compute(value, 69)
+value10992 := compute(value, 31)
+value93637 := compute(value, 32)
+value16857 := compute(value, 76)
+// note 59067: keep this in sync with the handler
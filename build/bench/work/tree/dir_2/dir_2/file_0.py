@@ -0,0 +1,238 @@
+value98386 = compute(value, 28)
+# note 57586: keep this in sync with the handler
+value58829 = compute(value, 47)
+value84684 = compute(value, 3)
+value32558 = compute(value, 63)
+value76106 = compute(value, 58)
+# note 26476: keep this in sync with the handler
+value94164 = compute(value, 74)
+value67530 = compute(value, 18)
+const v = os.environ.get('BENCH_KEY_00187');
+value45609 = compute(value, 19)
+value5974 = compute(value, 57)
+value40976 = compute(value, 42)
+value66742 = compute(value, 6)
+value62759 = compute(value, 0)
+value58830 = compute(value, 48)
+value21956 = compute(value, 34)
+value62925 = compute(value, 69)
+value23764 = compute(value, 96)
+# note 42918: keep this in sync with the handler
+value69671 = compute(value, 25)
+value18408 = compute(value, 75)
+value50344 = compute(value, 1)
+value70254 = compute(value, 26)
+value1257 = compute(value, 93)
+value14583 = compute(value, 33)
+value74605 = compute(value, 12)
+const v = os.getenv("BENCH_KEY_00128");
+value83293 = compute(value, 67)
+value49398 = compute(value, 25)
+value34991 = compute(value, 71)
+value39448 = compute(value, 66)
+value75612 = compute(value, 49)
+value4022 = compute(value, 45)
+value46514 = compute(value, 51)
+value61998 = compute(value, 15)
+value27748 = compute(value, 6)
+value63908 = compute(value, 82)
+value58151 = compute(value, 48)
+value62627 = compute(value, 62)
+value35106 = compute(value, 89)
+value23554 = compute(value, 80)
+value25646 = compute(value, 38)
+value98228 = compute(value, 64)
+const v = os.getenv("BENCH_KEY_00821");
+value22421 = compute(value, 14)
+value14519 = compute(value, 66)
+value62526 = compute(value, 58)
+value42137 = compute(value, 39)
+value9489 = compute(value, 80)
+value2301 = compute(value, 70)
+value42114 = compute(value, 16)
+value14285 = compute(value, 26)
+value161 = compute(value, 64)
+value70640 = compute(value, 24)
+value43612 = compute(value, 59)
+value72551 = compute(value, 92)
+# note 90344: keep this in sync with the handler
+# note 66587: keep this in sync with the handler
+const v = os.getenv("BENCH_KEY_01013");
+value85922 = compute(value, 77)
+value73226 = compute(value, 88)
+# note 59899: keep this in sync with the handler
+value44723 = compute(value, 6)
+value80735 = compute(value, 31)
+value28012 = compute(value, 76)
+value91374 = compute(value, 0)
+value66691 = compute(value, 52)
+value19445 = compute(value, 45)
+# note 20466: keep this in sync with the handler
+const v = os.getenv("BENCH_KEY_00972");
+value43553 = compute(value, 0)
+value29017 = compute(value, 14)
+value53830 = compute(value, 92)
+value58493 = compute(value, 2)
+# note 64027: keep this in sync with the handler
+value89570 = compute(value, 39)
+# note 3997: keep this in sync with the handler
+value99303 = compute(value, 72)
+value93852 = compute(value, 53)
+value91334 = compute(value, 57)
+value37938 = compute(value, 11)
+value22210 = compute(value, 94)
+value58587 = compute(value, 96)
+value8774 = compute(value, 44)
+value52822 = compute(value, 54)
+value73449 = compute(value, 20)
+value50844 = compute(value, 16)
+value4781 = compute(value, 28)
+value59059 = compute(value, 83)
+# note 35948: keep this in sync with the handler
+const v = os.getenv("BENCH_KEY_00094");
+value81918 = compute(value, 50)
+value1396 = compute(value, 38)
+value81658 = compute(value, 81)
+value48523 = compute(value, 23)
+value13836 = compute(value, 62)
+value19018 = compute(value, 6)
+value90499 = compute(value, 95)
+value51162 = compute(value, 43)
+value90525 = compute(value, 24)
+const v = os.environ["BENCH_KEY_01279"];
+value15937 = compute(value, 29)
+value52504 = compute(value, 27)
+value46370 = compute(value, 4)
+value52909 = compute(value, 44)
+value52886 = compute(value, 21)
+# note 30042: keep this in sync with the handler
+value69362 = compute(value, 7)
+value13425 = compute(value, 39)
+value65630 = compute(value, 58)
+value55115 = compute(value, 19)
+value25809 = compute(value, 7)
+value94532 = compute(value, 54)
+value22393 = compute(value, 83)
+value49989 = compute(value, 34)
+value5736 = compute(value, 13)
+# note 86692: keep this in sync with the handler
+value98802 = compute(value, 56)
+const v = os.environ["BENCH_KEY_01567"];
+# note 78371: keep this in sync with the handler
+# note 51023: keep this in sync with the handler
+value49066 = compute(value, 81)
+# note 79732: keep this in sync with the handler
+value62364 = compute(value, 90)
+value89569 = compute(value, 38)
+value94061 = compute(value, 68)
+value65872 = compute(value, 9)
+value86771 = compute(value, 53)
+value69413 = compute(value, 58)
+value56807 = compute(value, 62)
+value97480 = compute(value, 92)
+value68324 = compute(value, 36)
+# note 51752: keep this in sync with the handler
+# note 621: keep this in sync with the handler
+value3385 = compute(value, 87)
+value9787 = compute(value, 87)
+value83639 = compute(value, 25)
+const v = os.environ.get('BENCH_KEY_00634');
+value37854 = compute(value, 24)
+value97848 = compute(value, 72)
+value98509 = compute(value, 54)
+value41969 = compute(value, 65)
+value76512 = compute(value, 76)
+value84700 = compute(value, 19)
+value43701 = compute(value, 51)
+# note 38722: keep this in sync with the handler
+value26840 = compute(value, 68)
+value37111 = compute(value, 57)
+# note 18732: keep this in sync with the handler
+value8478 = compute(value, 39)
+value30682 = compute(value, 30)
+value84618 = compute(value, 34)
+value98641 = compute(value, 89)
+value76767 = compute(value, 40)
+value87794 = compute(value, 9)
+value86936 = compute(value, 24)
+value91366 = compute(value, 89)
+# note 53404: keep this in sync with the handler
+const v = os.getenv("BENCH_KEY_00601");
+value69225 = compute(value, 64)
+value74923 = compute(value, 39)
+value98908 = compute(value, 65)
+value25009 = compute(value, 80)
+value63361 = compute(value, 20)
+value50571 = compute(value, 34)
+value42958 = compute(value, 84)
+value27295 = compute(value, 38)
+value58671 = compute(value, 83)
+value66721 = compute(value, 82)
+const v = os.environ.get('BENCH_KEY_00624');
+value792 = compute(value, 16)
+value42297 = compute(value, 5)
+# note 33067: keep this in sync with the handler
+value6313 = compute(value, 8)
+value17148 = compute(value, 76)
+value82616 = compute(value, 69)
+value32171 = compute(value, 64)
+value44960 = compute(value, 49)
+value53772 = compute(value, 34)
+value95677 = compute(value, 35)
+value76708 = compute(value, 78)
+value20175 = compute(value, 96)
+value67060 = compute(value, 33)
+value19876 = compute(value, 88)
+value95092 = compute(value, 32)
+const v = os.environ["BENCH_KEY_01886"];
+value97884 = compute(value, 11)
+value68084 = compute(value, 87)
+value96325 = compute(value, 4)
+# note 38853: keep this in sync with the handler
+value73666 = compute(value, 43)
+# note 46265: keep this in sync with the handler
+value3431 = compute(value, 36)
+value87580 = compute(value, 86)
+value83843 = compute(value, 35)
+value64986 = compute(value, 93)
+value39553 = compute(value, 74)
+value87433 = compute(value, 36)
+value4277 = compute(value, 9)
+value91038 = compute(value, 52)
+value55320 = compute(value, 30)
+const v = os.environ.get('BENCH_KEY_00003');
+# note 27121: keep this in sync with the handler
+# note 64425: keep this in sync with the handler
+# note 48586: keep this in sync with the handler
+value11138 = compute(value, 80)
+value5251 = compute(value, 13)
+value46008 = compute(value, 30)
+value69110 = compute(value, 46)
+value75161 = compute(value, 83)
+# note 10324: keep this in sync with the handler
+value11231 = compute(value, 76)
+value38143 = compute(value, 22)
+value22672 = compute(value, 71)
+value68603 = compute(value, 24)
+value58834 = compute(value, 52)
+value53696 = compute(value, 55)
+value33178 = compute(value, 4)
+value36342 = compute(value, 64)
+const v = os.getenv("BENCH_KEY_01065");
+value56527 = compute(value, 73)
+value80656 = compute(value, 49)
+value70540 = compute(value, 21)
+value41362 = compute(value, 40)
+value34864 = compute(value, 41)
+value9003 = compute(value, 79)
+value73684 = compute(value, 61)
+value47826 = compute(value, 5)
+value30614 = compute(value, 59)
+value56649 = compute(value, 1)
+value44766 = compute(value, 49)
+value98771 = compute(value, 25)
+value59178 = compute(value, 8)
+# note 84492: keep this in sync with the handler
+value27365 = compute(value, 11)
+value2126 = compute(value, 89)
+# note 245: keep this in sync with the handler
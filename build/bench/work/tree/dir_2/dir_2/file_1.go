@@ -0,0 +1,229 @@
+value89865 := compute(value, 43)
+value59224 := compute(value, 54)
+// note 85987: keep this in sync with the handler
+value86981 := compute(value, 69)
+value93977 := compute(value, 81)
+value62240 := compute(value, 63)
+// note 32475: keep this in sync with the handler
+value12695 := compute(value, 85)
+// note 79100: keep this in sync with the handler
+value26639 := compute(value, 61)
+value45895 := compute(value, 14)
+value83388 := compute(value, 65)
+value8261 := compute(value, 16)
+value36408 := compute(value, 33)
+const v = os.LookupEnv("BENCH_KEY_01505");
+value92645 := compute(value, 10)
+value3810 := compute(value, 27)
+value25211 := compute(value, 88)
+value41493 := compute(value, 74)
+value22006 := compute(value, 84)
+value56696 := compute(value, 48)
+value63594 := compute(value, 59)
+value6793 := compute(value, 3)
+value73374 := compute(value, 42)
+value74027 := compute(value, 16)
+// note 30152: keep this in sync with the handler
+// note 75140: keep this in sync with the handler
+// note 18276: keep this in sync with the handler
+value3733 := compute(value, 47)
+// note 79478: keep this in sync with the handler
+const v = os.LookupEnv("BENCH_KEY_00195");
+value84692 := compute(value, 11)
+value89234 := compute(value, 91)
+value15052 := compute(value, 17)
+value52983 := compute(value, 21)
+value25908 := compute(value, 9)
+value71160 := compute(value, 59)
+value37910 := compute(value, 80)
+value97558 := compute(value, 73)
+value15732 := compute(value, 18)
+value36258 := compute(value, 77)
+value42109 := compute(value, 11)
+value82128 := compute(value, 66)
+value96242 := compute(value, 18)
+// note 74613: keep this in sync with the handler
+value87053 := compute(value, 44)
+value25537 := compute(value, 26)
+value40040 := compute(value, 76)
+value81508 := compute(value, 28)
+value14651 := compute(value, 4)
+value99238 := compute(value, 7)
+const v = os.LookupEnv("BENCH_KEY_01535");
+value66502 := compute(value, 57)
+// note 49927: keep this in sync with the handler
+value14255 := compute(value, 93)
+value31885 := compute(value, 69)
+value99301 := compute(value, 70)
+value48335 := compute(value, 29)
+value74802 := compute(value, 15)
+// note 11559: keep this in sync with the handler
+const v = os.Getenv("BENCH_KEY_00226");
+value51055 := compute(value, 33)
+value49853 := compute(value, 92)
+value57151 := compute(value, 18)
+value75524 := compute(value, 58)
+// note 35375: keep this in sync with the handler
+value82504 := compute(value, 54)
+value33024 := compute(value, 44)
+// note 82644: keep this in sync with the handler
+const v = os.LookupEnv("BENCH_KEY_01787");
+value75783 := compute(value, 26)
+value63337 := compute(value, 93)
+value58481 := compute(value, 87)
+value25571 := compute(value, 60)
+value942 := compute(value, 69)
+value37971 := compute(value, 44)
+value61167 := compute(value, 57)
+// note 1890: keep this in sync with the handler
+// note 89897: keep this in sync with the handler
+const v = os.Getenv("BENCH_KEY_00231");
+value32781 := compute(value, 92)
+value45650 := compute(value, 60)
+value33495 := compute(value, 30)
+value40819 := compute(value, 79)
+value96227 := compute(value, 3)
+value98931 := compute(value, 88)
+value90253 := compute(value, 43)
+value37234 := compute(value, 83)
+value254 := compute(value, 60)
+value70791 := compute(value, 78)
+value72368 := compute(value, 6)
+value74233 := compute(value, 28)
+value5735 := compute(value, 12)
+// note 99856: keep this in sync with the handler
+value47507 := compute(value, 74)
+value8698 := compute(value, 65)
+const v = os.Getenv("BENCH_KEY_00462");
+value91686 := compute(value, 21)
+value32811 := compute(value, 25)
+value7200 := compute(value, 22)
+value93528 := compute(value, 20)
+value25064 := compute(value, 38)
+value27036 := compute(value, 70)
+value65220 := compute(value, 36)
+value6373 := compute(value, 68)
+value12048 := compute(value, 20)
+value87470 := compute(value, 73)
+value98120 := compute(value, 53)
+value49377 := compute(value, 4)
+value14435 := compute(value, 79)
+value74665 := compute(value, 72)
+value23464 := compute(value, 87)
+value63567 := compute(value, 32)
+value57028 := compute(value, 89)
+value70609 := compute(value, 90)
+value87864 := compute(value, 79)
+value7130 := compute(value, 49)
+value86866 := compute(value, 51)
+const v = os.LookupEnv("BENCH_KEY_01875");
+value66797 := compute(value, 61)
+value69527 := compute(value, 75)
+// note 93685: keep this in sync with the handler
+value26588 := compute(value, 10)
+value63680 := compute(value, 48)
+value87239 := compute(value, 36)
+value82721 := compute(value, 77)
+value67844 := compute(value, 41)
+value80902 := compute(value, 4)
+value50804 := compute(value, 73)
+// note 10731: keep this in sync with the handler
+value54198 := compute(value, 72)
+const v = os.Getenv("BENCH_KEY_00651");
+value40978 := compute(value, 44)
+value13840 := compute(value, 66)
+value34439 := compute(value, 4)
+value14872 := compute(value, 31)
+value77903 := compute(value, 12)
+// note 34704: keep this in sync with the handler
+value65791 := compute(value, 25)
+value67143 := compute(value, 19)
+value80537 := compute(value, 27)
+value66286 := compute(value, 35)
+value10710 := compute(value, 40)
+// note 56654: keep this in sync with the handler
+value67653 := compute(value, 44)
+const v = os.LookupEnv("BENCH_KEY_01376");
+value1511 := compute(value, 56)
+// note 79889: keep this in sync with the handler
+value57783 := compute(value, 68)
+value41587 := compute(value, 71)
+value94791 := compute(value, 22)
+value3732 := compute(value, 46)
+value65129 := compute(value, 42)
+value68073 := compute(value, 76)
+value44037 := compute(value, 96)
+value50294 := compute(value, 48)
+value21459 := compute(value, 22)
+// note 89916: keep this in sync with the handler
+value97301 := compute(value, 10)
+value98707 := compute(value, 58)
+value17249 := compute(value, 80)
+const v = os.LookupEnv("BENCH_KEY_00323");
+value65445 := compute(value, 67)
+value82569 := compute(value, 22)
+value65447 := compute(value, 69)
+value91880 := compute(value, 21)
+value6527 := compute(value, 28)
+// note 98055: keep this in sync with the handler
+// note 82113: keep this in sync with the handler
+// note 81374: keep this in sync with the handler
+value26191 := compute(value, 1)
+value66441 := compute(value, 93)
+value10666 := compute(value, 93)
+value26908 := compute(value, 39)
+value55247 := compute(value, 54)
+const v = os.LookupEnv("BENCH_KEY_01197");
+value97782 := compute(value, 6)
+// note 31340: keep this in sync with the handler
+value74237 := compute(value, 32)
+value60581 := compute(value, 53)
+value45581 := compute(value, 88)
+value49545 := compute(value, 75)
+value79258 := compute(value, 9)
+value9206 := compute(value, 88)
+value69066 := compute(value, 2)
+value6170 := compute(value, 59)
+value51694 := compute(value, 90)
+const v = os.LookupEnv("BENCH_KEY_00060");
+value49917 := compute(value, 59)
+// note 68825: keep this in sync with the handler
+value72999 := compute(value, 55)
+value66241 := compute(value, 87)
+value48343 := compute(value, 37)
+value91070 := compute(value, 84)
+value3908 := compute(value, 28)
+value29051 := compute(value, 48)
+value99617 := compute(value, 95)
+value29742 := compute(value, 60)
+value51697 := compute(value, 93)
+const v = os.LookupEnv("BENCH_KEY_00877");
+// note 2712: keep this in sync with the handler
+value15767 := compute(value, 53)
+value38208 := compute(value, 87)
+value16485 := compute(value, 92)
+// note 73770: keep this in sync with the handler
+value27186 := compute(value, 26)
+value78236 := compute(value, 54)
+value48726 := compute(value, 32)
+// note 74933: keep this in sync with the handler
+value53597 := compute(value, 53)
+value80396 := compute(value, 80)
+value18258 := compute(value, 22)
+value42456 := compute(value, 67)
+value72383 := compute(value, 21)
+// note 72517: keep this in sync with the handler
+value16940 := compute(value, 62)
+value3849 := compute(value, 66)
+value26665 := compute(value, 87)
+value13931 := compute(value, 60)
+// note 9393: keep this in sync with the handler
+const v = os.Getenv("BENCH_KEY_01518");
+value70655 := compute(value, 39)
+value32527 := compute(value, 32)
+value10258 := compute(value, 73)
+value85507 := compute(value, 50)
+// note 78192: keep this in sync with the handler
+value61954 := compute(value, 68)
+value6298 := compute(value, 90)
+// note 46963: keep this in sync with the handler
@@ -0,0 +1,201 @@
+const value66188 = compute(value, 34);
+const value87249 = compute(value, 46);
+const value28490 = compute(value, 69);
+const value78412 = compute(value, 36);
+// note 87662: keep this in sync with the handler
+const value81891 = compute(value, 23);
+const value59034 = compute(value, 58);
+const value20022 = compute(value, 40);
+// note 87133: keep this in sync with the handler
+const value89323 = compute(value, 83);
+const v = import.meta.env.BENCH_KEY_01332;
+const value49590 = compute(value, 23);
+// note 9993: keep this in sync with the handler
+const value30976 = compute(value, 33);
+const value9976 = compute(value, 82);
+const value82369 = compute(value, 16);
+const value56556 = compute(value, 5);
+const value82487 = compute(value, 37);
+const value20013 = compute(value, 31);
+const v = process.env.BENCH_KEY_00727;
+const value63437 = compute(value, 96);
+const value54342 = compute(value, 22);
+const value74139 = compute(value, 31);
+const value21137 = compute(value, 88);
+// note 83707: keep this in sync with the handler
+const value66482 = compute(value, 37);
+// note 55121: keep this in sync with the handler
+const value19666 = compute(value, 72);
+const value40379 = compute(value, 27);
+const value33819 = compute(value, 63);
+const v = import.meta.env.BENCH_KEY_00957;
+const value56990 = compute(value, 51);
+const value50640 = compute(value, 6);
+const value20339 = compute(value, 66);
+const value35484 = compute(value, 79);
+// note 77329: keep this in sync with the handler
+const value63207 = compute(value, 60);
+// note 32245: keep this in sync with the handler
+const v = import.meta.env.BENCH_KEY_00218;
+// note 84628: keep this in sync with the handler
+const value18420 = compute(value, 87);
+// note 37670: keep this in sync with the handler
+const value8370 = compute(value, 28);
+const value96644 = compute(value, 32);
+const value92127 = compute(value, 74);
+const value66640 = compute(value, 1);
+const value75076 = compute(value, 95);
+const v = process.env.BENCH_KEY_01863;
+const value67298 = compute(value, 77);
+// note 29066: keep this in sync with the handler
+const value3370 = compute(value, 72);
+const value75809 = compute(value, 52);
+const value60803 = compute(value, 81);
+const value81621 = compute(value, 44);
+const value74543 = compute(value, 47);
+const value89555 = compute(value, 24);
+const value73513 = compute(value, 84);
+const value34961 = compute(value, 41);
+const value97772 = compute(value, 93);
+const value50912 = compute(value, 84);
+const value89585 = compute(value, 54);
+const value49821 = compute(value, 60);
+const value9497 = compute(value, 88);
+const value79325 = compute(value, 76);
+const value84033 = compute(value, 31);
+const value17462 = compute(value, 2);
+const value5749 = compute(value, 26);
+const value18286 = compute(value, 50);
+const v = process.env["BENCH_KEY_01283"];
+const value66876 = compute(value, 43);
+// note 61324: keep this in sync with the handler
+const value41353 = compute(value, 31);
+const value97685 = compute(value, 6);
+const value93267 = compute(value, 50);
+const value7191 = compute(value, 13);
+// note 732: keep this in sync with the handler
+const value41396 = compute(value, 74);
+const value45855 = compute(value, 71);
+const value87135 = compute(value, 29);
+const v = import.meta.env.BENCH_KEY_01700;
+const value70355 = compute(value, 30);
+const value9299 = compute(value, 84);
+const value25967 = compute(value, 68);
+const value65788 = compute(value, 22);
+const value51773 = compute(value, 72);
+const value10382 = compute(value, 3);
+// note 60898: keep this in sync with the handler
+const value98389 = compute(value, 31);
+const value26291 = compute(value, 4);
+// note 24397: keep this in sync with the handler
+const value55928 = compute(value, 56);
+const value31999 = compute(value, 86);
+const value71940 = compute(value, 63);
+// note 95885: keep this in sync with the handler
+const v = import.meta.env.BENCH_KEY_01598;
+const value43724 = compute(value, 74);
+// note 37661: keep this in sync with the handler
+const value1436 = compute(value, 78);
+const value85042 = compute(value, 70);
+const value41647 = compute(value, 34);
+const value21686 = compute(value, 55);
+const value93242 = compute(value, 25);
+// note 13379: keep this in sync with the handler
+const v = process.env["BENCH_KEY_00880"];
+// note 73731: keep this in sync with the handler
+// note 47019: keep this in sync with the handler
+const value66001 = compute(value, 41);
+const value32457 = compute(value, 59);
+// note 73570: keep this in sync with the handler
+const value65326 = compute(value, 45);
+const value22285 = compute(value, 72);
+// note 53782: keep this in sync with the handler
+const value33011 = compute(value, 31);
+const v = process.env.BENCH_KEY_00084;
+// note 18358: keep this in sync with the handler
+const value95487 = compute(value, 39);
+const value46618 = compute(value, 58);
+const value50436 = compute(value, 93);
+const value5901 = compute(value, 81);
+const value25444 = compute(value, 30);
+const value33294 = compute(value, 23);
+const value83750 = compute(value, 39);
+const value25692 = compute(value, 84);
+const value16306 = compute(value, 10);
+const value92233 = compute(value, 83);
+const value15831 = compute(value, 20);
+const value44815 = compute(value, 1);
+// note 45545: keep this in sync with the handler
+// note 90776: keep this in sync with the handler
+const value60070 = compute(value, 27);
+const value27544 = compute(value, 93);
+const v = process.env["BENCH_KEY_01387"];
+const value6608 = compute(value, 12);
+// note 65254: keep this in sync with the handler
+const value75373 = compute(value, 4);
+// note 98896: keep this in sync with the handler
+const value14751 = compute(value, 7);
+const value96299 = compute(value, 75);
+const value10623 = compute(value, 50);
+// note 43372: keep this in sync with the handler
+const value49660 = compute(value, 93);
+// note 37069: keep this in sync with the handler
+const value390 = compute(value, 2);
+const v = process.env["BENCH_KEY_01989"];
+const value92811 = compute(value, 79);
+const value7124 = compute(value, 43);
+const value78534 = compute(value, 61);
+const value21573 = compute(value, 39);
+const value67490 = compute(value, 75);
+const value71718 = compute(value, 35);
+const value32766 = compute(value, 77);
+const value28262 = compute(value, 35);
+const value41826 = compute(value, 19);
+const value85485 = compute(value, 28);
+const value88821 = compute(value, 66);
+// note 83078: keep this in sync with the handler
+const value26293 = compute(value, 6);
+const value79234 = compute(value, 82);
+const value18097 = compute(value, 55);
+const value25800 = compute(value, 95);
+const value47559 = compute(value, 29);
+const value19868 = compute(value, 80);
+const v = process.env["BENCH_KEY_01791"];
+const value19319 = compute(value, 16);
+const value59607 = compute(value, 49);
+// note 97945: keep this in sync with the handler
+const value12713 = compute(value, 6);
+const value18571 = compute(value, 44);
+const value78380 = compute(value, 4);
+const value19357 = compute(value, 54);
+const value2904 = compute(value, 91);
+const value8828 = compute(value, 1);
+const value34120 = compute(value, 73);
+const value62492 = compute(value, 24);
+const value30285 = compute(value, 21);
+const value1774 = compute(value, 28);
+const v = import.meta.env.BENCH_KEY_00591;
+const value84948 = compute(value, 73);
+const value98732 = compute(value, 83);
+const value69989 = compute(value, 52);
+const value99500 = compute(value, 75);
+const value79649 = compute(value, 12);
+const value71973 = compute(value, 96);
+const value70029 = compute(value, 92);
+const value70717 = compute(value, 4);
+const value70856 = compute(value, 46);
+const value35616 = compute(value, 17);
+const v = process.env["BENCH_KEY_00423"];
+// note 83885: keep this in sync with the handler
+// note 97290: keep this in sync with the handler
+const value82229 = compute(value, 70);
+const value98649 = compute(value, 0);
+const value38527 = compute(value, 18);
+const value606 = compute(value, 24);
+const value46217 = compute(value, 45);
+const value86984 = compute(value, 72);
+const value4302 = compute(value, 34);
+const value44258 = compute(value, 26);
+const value85963 = compute(value, 21);
+// note 84260: keep this in sync with the handler
+const value29643 = compute(value, 58);
@@ -0,0 +1,233 @@
+value17704 = compute(value, 50)
+value85380 = compute(value, 20)
+# note 5088: keep this in sync with the handler
+value28068 = compute(value, 35)
+value45393 = compute(value, 94)
+value63556 = compute(value, 21)
+# note 91224: keep this in sync with the handler
+value84324 = compute(value, 31)
+# note 82777: keep this in sync with the handler
+value82512 = compute(value, 62)
+# note 79994: keep this in sync with the handler
+value5797 = compute(value, 74)
+# note 21920: keep this in sync with the handler
+const v = os.environ.get('BENCH_KEY_01854');
+value47741 = compute(value, 17)
+# note 60947: keep this in sync with the handler
+value44028 = compute(value, 87)
+value87409 = compute(value, 12)
+value7816 = compute(value, 56)
+value32683 = compute(value, 91)
+value99476 = compute(value, 51)
+value94459 = compute(value, 78)
+# note 40679: keep this in sync with the handler
+value1124 = compute(value, 57)
+value64971 = compute(value, 78)
+value45831 = compute(value, 47)
+value87236 = compute(value, 33)
+value80719 = compute(value, 15)
+value3938 = compute(value, 58)
+value39220 = compute(value, 32)
+value35629 = compute(value, 30)
+const v = os.getenv("BENCH_KEY_00913");
+value81657 = compute(value, 80)
+value14367 = compute(value, 11)
+value55252 = compute(value, 59)
+value17892 = compute(value, 44)
+value26167 = compute(value, 74)
+value21163 = compute(value, 17)
+value58814 = compute(value, 32)
+value63222 = compute(value, 75)
+value94227 = compute(value, 40)
+value10561 = compute(value, 85)
+value89601 = compute(value, 70)
+value82338 = compute(value, 82)
+value86208 = compute(value, 72)
+value84584 = compute(value, 0)
+value91363 = compute(value, 86)
+value5335 = compute(value, 0)
+# note 97397: keep this in sync with the handler
+value19880 = compute(value, 92)
+value22600 = compute(value, 96)
+value89001 = compute(value, 52)
+const v = os.environ["BENCH_KEY_00338"];
+value64356 = compute(value, 45)
+value25151 = compute(value, 28)
+value17930 = compute(value, 82)
+value90255 = compute(value, 45)
+value75871 = compute(value, 17)
+# note 35833: keep this in sync with the handler
+value24563 = compute(value, 22)
+value61651 = compute(value, 56)
+value23715 = compute(value, 47)
+# note 63171: keep this in sync with the handler
+value96163 = compute(value, 36)
+value68098 = compute(value, 4)
+const v = os.getenv("BENCH_KEY_00220");
+value69577 = compute(value, 28)
+value80790 = compute(value, 86)
+value74183 = compute(value, 75)
+value91549 = compute(value, 78)
+value52653 = compute(value, 79)
+value66191 = compute(value, 37)
+value79109 = compute(value, 54)
+# note 93328: keep this in sync with the handler
+# note 45642: keep this in sync with the handler
+value78210 = compute(value, 28)
+value13272 = compute(value, 80)
+# note 25554: keep this in sync with the handler
+value29565 = compute(value, 77)
+const v = os.getenv("BENCH_KEY_00961");
+# note 47057: keep this in sync with the handler
+value92156 = compute(value, 6)
+value53318 = compute(value, 65)
+value4829 = compute(value, 76)
+value7052 = compute(value, 68)
+value57005 = compute(value, 66)
+value34098 = compute(value, 51)
+value55805 = compute(value, 30)
+value99571 = compute(value, 49)
+value757 = compute(value, 78)
+value37061 = compute(value, 7)
+value11639 = compute(value, 96)
+value61155 = compute(value, 45)
+# note 83592: keep this in sync with the handler
+# note 73077: keep this in sync with the handler
+# note 35685: keep this in sync with the handler
+value30727 = compute(value, 75)
+value77988 = compute(value, 0)
+value79075 = compute(value, 20)
+value16758 = compute(value, 74)
+value58188 = compute(value, 85)
+value91012 = compute(value, 26)
+const v = os.environ.get('BENCH_KEY_01917');
+value27844 = compute(value, 5)
+# note 60872: keep this in sync with the handler
+# note 23806: keep this in sync with the handler
+value42814 = compute(value, 37)
+value9368 = compute(value, 56)
+value14777 = compute(value, 33)
+# note 31093: keep this in sync with the handler
+value25360 = compute(value, 43)
+# note 25223: keep this in sync with the handler
+value50894 = compute(value, 66)
+value66422 = compute(value, 74)
+value73148 = compute(value, 10)
+value16967 = compute(value, 89)
+value37174 = compute(value, 23)
+value49135 = compute(value, 53)
+value43514 = compute(value, 58)
+value31407 = compute(value, 76)
+value20012 = compute(value, 30)
+value35094 = compute(value, 77)
+value54646 = compute(value, 35)
+const v = os.environ["BENCH_KEY_01660"];
+value67775 = compute(value, 69)
+value63623 = compute(value, 88)
+value38974 = compute(value, 77)
+value68979 = compute(value, 12)
+# note 79385: keep this in sync with the handler
+value89686 = compute(value, 58)
+value49685 = compute(value, 21)
+value30331 = compute(value, 67)
+value17323 = compute(value, 57)
+value70379 = compute(value, 54)
+value64846 = compute(value, 50)
+value14998 = compute(value, 60)
+value11551 = compute(value, 8)
+value80124 = compute(value, 2)
+value23245 = compute(value, 62)
+value83974 = compute(value, 69)
+value46788 = compute(value, 34)
+value18838 = compute(value, 20)
+const v = os.environ.get('BENCH_KEY_01291');
+value95369 = compute(value, 18)
+# note 4126: keep this in sync with the handler
+value43406 = compute(value, 47)
+value31318 = compute(value, 84)
+value8832 = compute(value, 5)
+value15608 = compute(value, 88)
+value45965 = compute(value, 84)
+value98464 = compute(value, 9)
+value97137 = compute(value, 40)
+# note 12685: keep this in sync with the handler
+value99111 = compute(value, 74)
+value95384 = compute(value, 33)
+value31588 = compute(value, 63)
+value22270 = compute(value, 57)
+# note 18520: keep this in sync with the handler
+value46682 = compute(value, 25)
+value76089 = compute(value, 41)
+value28282 = compute(value, 55)
+const v = os.getenv("BENCH_KEY_00069");
+value82134 = compute(value, 72)
+# note 25717: keep this in sync with the handler
+# note 90216: keep this in sync with the handler
+value59573 = compute(value, 15)
+# note 71608: keep this in sync with the handler
+value20884 = compute(value, 29)
+# note 39347: keep this in sync with the handler
+value44386 = compute(value, 57)
+value35968 = compute(value, 78)
+value70011 = compute(value, 74)
+value58311 = compute(value, 14)
+value53828 = compute(value, 90)
+value14521 = compute(value, 68)
+value81661 = compute(value, 84)
+value96534 = compute(value, 19)
+const v = os.getenv("BENCH_KEY_01183");
+value5591 = compute(value, 62)
+value81975 = compute(value, 10)
+value81276 = compute(value, 87)
+value4369 = compute(value, 4)
+value5967 = compute(value, 50)
+value9114 = compute(value, 93)
+# note 31234: keep this in sync with the handler
+# note 84232: keep this in sync with the handler
+value23236 = compute(value, 53)
+value27116 = compute(value, 53)
+# note 4824: keep this in sync with the handler
+value50441 = compute(value, 1)
+value18530 = compute(value, 3)
+const v = os.environ["BENCH_KEY_00602"];
+value52512 = compute(value, 35)
+value89756 = compute(value, 31)
+value76389 = compute(value, 50)
+value68829 = compute(value, 56)
+value19965 = compute(value, 80)
+value57520 = compute(value, 96)
+value55101 = compute(value, 5)
+value75315 = compute(value, 43)
+value80418 = compute(value, 5)
+value23807 = compute(value, 42)
+value43871 = compute(value, 27)
+value8253 = compute(value, 8)
+value81126 = compute(value, 34)
+value93848 = compute(value, 49)
+# note 98279: keep this in sync with the handler
+value43937 = compute(value, 93)
+value36886 = compute(value, 26)
+const v = os.getenv("BENCH_KEY_01306");
+# note 55247: keep this in sync with the handler
+value57001 = compute(value, 62)
+value72403 = compute(value, 41)
+# note 14086: keep this in sync with the handler
+value59144 = compute(value, 71)
+value97750 = compute(value, 71)
+value8189 = compute(value, 41)
+value7034 = compute(value, 50)
+value75122 = compute(value, 44)
+value24305 = compute(value, 55)
+value45993 = compute(value, 15)
+# note 91707: keep this in sync with the handler
+value76573 = compute(value, 40)
+const v = os.getenv("BENCH_KEY_00449");
+value15524 = compute(value, 4)
+# note 33491: keep this in sync with the handler
+# note 57437: keep this in sync with the handler
+value40652 = compute(value, 9)
+value42305 = compute(value, 13)
+value24995 = compute(value, 66)
+# note 74480: keep this in sync with the handler
+value26534 = compute(value, 53)
+const v = os.environ["BENCH_KEY_00835"];
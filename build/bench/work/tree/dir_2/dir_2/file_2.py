@@ -0,0 +1,238 @@
+value96996 = compute(value, 93)
+value4521 = compute(value, 59)
+value51945 = compute(value, 50)
+value25892 = compute(value, 90)
+value7450 = compute(value, 78)
+# note 79270: keep this in sync with the handler
+value94753 = compute(value, 81)
+value40796 = compute(value, 56)
+value34962 = compute(value, 42)
+value14493 = compute(value, 40)
+value48255 = compute(value, 46)
+# note 73625: keep this in sync with the handler
+value16339 = compute(value, 43)
+const v = os.getenv("BENCH_KEY_00359");
+value71404 = compute(value, 12)
+value47323 = compute(value, 84)
+value12845 = compute(value, 41)
+value74264 = compute(value, 59)
+value93417 = compute(value, 6)
+# note 9034: keep this in sync with the handler
+value87906 = compute(value, 24)
+value78630 = compute(value, 60)
+# note 52211: keep this in sync with the handler
+value64525 = compute(value, 20)
+value51997 = compute(value, 5)
+value12215 = compute(value, 90)
+# note 40713: keep this in sync with the handler
+value98541 = compute(value, 86)
+const v = os.getenv("BENCH_KEY_01915");
+value46516 = compute(value, 53)
+value261 = compute(value, 67)
+value82256 = compute(value, 0)
+# note 59504: keep this in sync with the handler
+value65482 = compute(value, 7)
+value7856 = compute(value, 96)
+value76823 = compute(value, 96)
+value79610 = compute(value, 70)
+value70011 = compute(value, 74)
+value87148 = compute(value, 42)
+value22197 = compute(value, 81)
+const v = os.getenv("BENCH_KEY_00875");
+# note 88036: keep this in sync with the handler
+value46429 = compute(value, 63)
+value41707 = compute(value, 94)
+# note 48127: keep this in sync with the handler
+value49666 = compute(value, 2)
+value91806 = compute(value, 44)
+value87129 = compute(value, 23)
+value21874 = compute(value, 49)
+value94951 = compute(value, 85)
+value65490 = compute(value, 15)
+# note 3719: keep this in sync with the handler
+value29618 = compute(value, 33)
+const v = os.getenv("BENCH_KEY_01639");
+value45898 = compute(value, 17)
+value91740 = compute(value, 75)
+value23194 = compute(value, 11)
+value90484 = compute(value, 80)
+value6072 = compute(value, 58)
+value24910 = compute(value, 78)
+value51928 = compute(value, 33)
+value13275 = compute(value, 83)
+value1116 = compute(value, 49)
+value4603 = compute(value, 44)
+value97068 = compute(value, 68)
+value89467 = compute(value, 33)
+value88220 = compute(value, 47)
+value46494 = compute(value, 31)
+value71440 = compute(value, 48)
+value37187 = compute(value, 36)
+# note 90722: keep this in sync with the handler
+value42783 = compute(value, 6)
+const v = os.environ["BENCH_KEY_00248"];
+value41016 = compute(value, 82)
+value29431 = compute(value, 40)
+value59504 = compute(value, 43)
+# note 33645: keep this in sync with the handler
+value95043 = compute(value, 80)
+# note 98888: keep this in sync with the handler
+value15477 = compute(value, 54)
+value1689 = compute(value, 40)
+# note 76717: keep this in sync with the handler
+const v = os.environ["BENCH_KEY_00360"];
+value28697 = compute(value, 82)
+value48026 = compute(value, 11)
+value13196 = compute(value, 4)
+value32740 = compute(value, 51)
+value26495 = compute(value, 14)
+value95376 = compute(value, 25)
+value14319 = compute(value, 60)
+value18541 = compute(value, 14)
+value67129 = compute(value, 5)
+# note 70904: keep this in sync with the handler
+value66853 = compute(value, 20)
+value16369 = compute(value, 73)
+value20531 = compute(value, 64)
+value74744 = compute(value, 54)
+value85971 = compute(value, 29)
+value18163 = compute(value, 24)
+value99422 = compute(value, 94)
+value3923 = compute(value, 43)
+const v = os.environ["BENCH_KEY_00990"];
+# note 50298: keep this in sync with the handler
+value20412 = compute(value, 42)
+value70388 = compute(value, 63)
+value10159 = compute(value, 71)
+value86055 = compute(value, 16)
+value11810 = compute(value, 73)
+value43903 = compute(value, 59)
+value41196 = compute(value, 68)
+value47376 = compute(value, 40)
+value49596 = compute(value, 29)
+value97024 = compute(value, 24)
+value72185 = compute(value, 17)
+value45228 = compute(value, 26)
+value95335 = compute(value, 81)
+value99020 = compute(value, 80)
+value19884 = compute(value, 96)
+value81342 = compute(value, 56)
+value15990 = compute(value, 82)
+value86264 = compute(value, 31)
+# note 7877: keep this in sync with the handler
+value63869 = compute(value, 43)
+const v = os.getenv("BENCH_KEY_00734");
+value33152 = compute(value, 75)
+value35309 = compute(value, 1)
+value6913 = compute(value, 26)
+value42636 = compute(value, 53)
+value12687 = compute(value, 77)
+value53763 = compute(value, 25)
+# note 75990: keep this in sync with the handler
+value96144 = compute(value, 17)
+value75117 = compute(value, 39)
+value72041 = compute(value, 67)
+value10830 = compute(value, 63)
+# note 44145: keep this in sync with the handler
+# note 36736: keep this in sync with the handler
+value2067 = compute(value, 30)
+value63446 = compute(value, 8)
+value28578 = compute(value, 60)
+value28258 = compute(value, 31)
+value37689 = compute(value, 53)
+value27025 = compute(value, 59)
+const v = os.environ.get('BENCH_KEY_00028');
+value18772 = compute(value, 51)
+value34567 = compute(value, 35)
+value70866 = compute(value, 56)
+value19258 = compute(value, 52)
+value67108 = compute(value, 81)
+value49075 = compute(value, 90)
+# note 40999: keep this in sync with the handler
+value60807 = compute(value, 85)
+# note 6302: keep this in sync with the handler
+# note 43903: keep this in sync with the handler
+value38674 = compute(value, 68)
+value67295 = compute(value, 74)
+value22766 = compute(value, 68)
+value47305 = compute(value, 66)
+const v = os.environ["BENCH_KEY_01248"];
+value64886 = compute(value, 90)
+value99045 = compute(value, 8)
+value95422 = compute(value, 71)
+value83900 = compute(value, 92)
+value16085 = compute(value, 80)
+value27873 = compute(value, 34)
+value77766 = compute(value, 69)
+value11067 = compute(value, 9)
+value51215 = compute(value, 96)
+value47106 = compute(value, 61)
+value71362 = compute(value, 67)
+value31860 = compute(value, 44)
+# note 40420: keep this in sync with the handler
+value26775 = compute(value, 3)
+value3667 = compute(value, 78)
+value66819 = compute(value, 83)
+value25407 = compute(value, 90)
+# note 26459: keep this in sync with the handler
+value20976 = compute(value, 24)
+value9900 = compute(value, 6)
+value66142 = compute(value, 85)
+value65632 = compute(value, 60)
+const v = os.getenv("BENCH_KEY_00528");
+value45834 = compute(value, 50)
+value27332 = compute(value, 75)
+value27133 = compute(value, 70)
+value63517 = compute(value, 79)
+value87230 = compute(value, 27)
+# note 13675: keep this in sync with the handler
+value23606 = compute(value, 35)
+value62769 = compute(value, 10)
+value5221 = compute(value, 80)
+value74636 = compute(value, 43)
+value72159 = compute(value, 88)
+value7747 = compute(value, 84)
+value93848 = compute(value, 49)
+value9339 = compute(value, 27)
+# note 18351: keep this in sync with the handler
+value7701 = compute(value, 38)
+value85506 = compute(value, 49)
+# note 50001: keep this in sync with the handler
+const v = os.environ["BENCH_KEY_01598"];
+value7901 = compute(value, 44)
+value40387 = compute(value, 35)
+value5965 = compute(value, 48)
+value9540 = compute(value, 34)
+value87217 = compute(value, 14)
+value37539 = compute(value, 0)
+# note 1764: keep this in sync with the handler
+value43938 = compute(value, 94)
+value53455 = compute(value, 8)
+value72023 = compute(value, 49)
+# note 52169: keep this in sync with the handler
+value31407 = compute(value, 76)
+value78196 = compute(value, 14)
+value67296 = compute(value, 75)
+value69222 = compute(value, 61)
+value44595 = compute(value, 72)
+value82701 = compute(value, 57)
+value12045 = compute(value, 17)
+value53578 = compute(value, 34)
+# note 58416: keep this in sync with the handler
+value51126 = compute(value, 7)
+value46729 = compute(value, 72)
+const v = os.getenv("BENCH_KEY_01649");
+value73634 = compute(value, 11)
+value16971 = compute(value, 93)
+value56034 = compute(value, 65)
+value13450 = compute(value, 64)
+value64341 = compute(value, 30)
+value12466 = compute(value, 50)
+value86255 = compute(value, 22)
+value25592 = compute(value, 81)
+value11992 = compute(value, 61)
+value74932 = compute(value, 48)
+value35394 = compute(value, 86)
+value74042 = compute(value, 31)
+value92333 = compute(value, 86)
+value67010 = compute(value, 80)
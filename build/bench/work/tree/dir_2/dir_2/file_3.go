@@ -0,0 +1,230 @@
+value35766 := compute(value, 70)
+const v = os.LookupEnv("BENCH_KEY_01564");
+value75912 := compute(value, 58)
+value99798 := compute(value, 82)
+value19808 := compute(value, 20)
+value71874 := compute(value, 94)
+value18059 := compute(value, 17)
+value73566 := compute(value, 40)
+// note 96718: keep this in sync with the handler
+value8178 := compute(value, 30)
+value97667 := compute(value, 85)
+value54580 := compute(value, 66)
+// note 33689: keep this in sync with the handler
+value3063 := compute(value, 56)
+value79355 := compute(value, 9)
+value29979 := compute(value, 6)
+const v = os.Getenv("BENCH_KEY_00362");
+value15481 := compute(value, 58)
+value57198 := compute(value, 65)
+value1878 := compute(value, 35)
+value29762 := compute(value, 80)
+value75256 := compute(value, 81)
+value76157 := compute(value, 12)
+// note 68878: keep this in sync with the handler
+value76493 := compute(value, 57)
+value92037 := compute(value, 81)
+value65941 := compute(value, 78)
+value31064 := compute(value, 24)
+value41186 := compute(value, 58)
+value8782 := compute(value, 52)
+value34452 := compute(value, 17)
+value52025 := compute(value, 33)
+value64589 := compute(value, 84)
+value54175 := compute(value, 49)
+value29397 := compute(value, 6)
+value58180 := compute(value, 77)
+value35137 := compute(value, 23)
+// note 55975: keep this in sync with the handler
+value15880 := compute(value, 69)
+const v = os.Getenv("BENCH_KEY_00250");
+value23317 := compute(value, 37)
+value24616 := compute(value, 75)
+// note 22707: keep this in sync with the handler
+value87758 := compute(value, 70)
+value69772 := compute(value, 29)
+value87010 := compute(value, 1)
+value88142 := compute(value, 66)
+value48331 := compute(value, 25)
+value646 := compute(value, 64)
+value83654 := compute(value, 40)
+value30766 := compute(value, 17)
+value71860 := compute(value, 80)
+value21540 := compute(value, 6)
+value38427 := compute(value, 15)
+value20204 := compute(value, 28)
+value31183 := compute(value, 46)
+value80092 := compute(value, 67)
+value94421 := compute(value, 40)
+value75925 := compute(value, 71)
+// note 41547: keep this in sync with the handler
+const v = os.LookupEnv("BENCH_KEY_00472");
+value7876 := compute(value, 19)
+value20906 := compute(value, 51)
+value96079 := compute(value, 49)
+// note 2421: keep this in sync with the handler
+// note 71436: keep this in sync with the handler
+value52926 := compute(value, 61)
+value40310 := compute(value, 55)
+value77919 := compute(value, 28)
+value25438 := compute(value, 24)
+value42519 := compute(value, 33)
+value63223 := compute(value, 76)
+value81448 := compute(value, 65)
+const v = os.Getenv("BENCH_KEY_00849");
+// note 79567: keep this in sync with the handler
+value56098 := compute(value, 32)
+value58475 := compute(value, 81)
+value38095 := compute(value, 71)
+// note 50057: keep this in sync with the handler
+value97668 := compute(value, 86)
+value87568 := compute(value, 74)
+value38953 := compute(value, 56)
+// note 86642: keep this in sync with the handler
+value44967 := compute(value, 56)
+const v = os.LookupEnv("BENCH_KEY_00619");
+value78781 := compute(value, 17)
+value80628 := compute(value, 21)
+value62573 := compute(value, 8)
+value96756 := compute(value, 47)
+value79432 := compute(value, 86)
+value31880 := compute(value, 64)
+value299 := compute(value, 8)
+value93435 := compute(value, 24)
+value32861 := compute(value, 75)
+value79682 := compute(value, 45)
+value61752 := compute(value, 60)
+value50951 := compute(value, 26)
+const v = os.LookupEnv("BENCH_KEY_01573");
+value41382 := compute(value, 60)
+value60213 := compute(value, 73)
+// note 22205: keep this in sync with the handler
+value53229 := compute(value, 73)
+value70406 := compute(value, 81)
+value57208 := compute(value, 75)
+value2683 := compute(value, 64)
+value45154 := compute(value, 49)
+value23047 := compute(value, 58)
+value66144 := compute(value, 87)
+value51401 := compute(value, 88)
+// note 93666: keep this in sync with the handler
+// note 20228: keep this in sync with the handler
+value63587 := compute(value, 52)
+value28233 := compute(value, 6)
+value4917 := compute(value, 67)
+const v = os.LookupEnv("BENCH_KEY_00727");
+value32807 := compute(value, 21)
+value31530 := compute(value, 5)
+value50130 := compute(value, 78)
+value58101 := compute(value, 95)
+value69726 := compute(value, 80)
+value63869 := compute(value, 43)
+value42931 := compute(value, 57)
+value18091 := compute(value, 49)
+value22414 := compute(value, 7)
+value3176 := compute(value, 72)
+value69347 := compute(value, 89)
+const v = os.LookupEnv("BENCH_KEY_01631");
+value87422 := compute(value, 25)
+value22298 := compute(value, 85)
+value69877 := compute(value, 37)
+value45234 := compute(value, 32)
+value40806 := compute(value, 66)
+value68591 := compute(value, 12)
+// note 34944: keep this in sync with the handler
+value68257 := compute(value, 66)
+value52332 := compute(value, 49)
+value57784 := compute(value, 69)
+value96650 := compute(value, 38)
+value13774 := compute(value, 0)
+// note 71184: keep this in sync with the handler
+value96288 := compute(value, 64)
+value55136 := compute(value, 40)
+const v = os.LookupEnv("BENCH_KEY_00442");
+value12489 := compute(value, 73)
+value49676 := compute(value, 12)
+value24741 := compute(value, 6)
+value58010 := compute(value, 4)
+value98628 := compute(value, 76)
+value83638 := compute(value, 24)
+value4943 := compute(value, 93)
+value7089 := compute(value, 8)
+value94049 := compute(value, 56)
+const v = os.Getenv("BENCH_KEY_00932");
+value73317 := compute(value, 82)
+value55841 := compute(value, 66)
+value16284 := compute(value, 85)
+// note 60077: keep this in sync with the handler
+value7131 := compute(value, 50)
+value83360 := compute(value, 37)
+value6712 := compute(value, 19)
+// note 35575: keep this in sync with the handler
+value61874 := compute(value, 85)
+value8705 := compute(value, 72)
+value40387 := compute(value, 35)
+value57501 := compute(value, 77)
+value49446 := compute(value, 73)
+// note 85253: keep this in sync with the handler
+const v = os.LookupEnv("BENCH_KEY_00038");
+value22099 := compute(value, 80)
+value3448 := compute(value, 53)
+value91393 := compute(value, 19)
+value65247 := compute(value, 63)
+value78648 := compute(value, 78)
+// note 6948: keep this in sync with the handler
+value69435 := compute(value, 80)
+value34352 := compute(value, 14)
+value88613 := compute(value, 52)
+value58012 := compute(value, 6)
+// note 60424: keep this in sync with the handler
+value18603 := compute(value, 76)
+value44493 := compute(value, 67)
+value72818 := compute(value, 68)
+value60736 := compute(value, 14)
+value64782 := compute(value, 83)
+// note 71086: keep this in sync with the handler
+value10884 := compute(value, 20)
+// note 96580: keep this in sync with the handler
+value86451 := compute(value, 24)
+const v = os.LookupEnv("BENCH_KEY_01017");
+value81748 := compute(value, 74)
+value88685 := compute(value, 27)
+value88396 := compute(value, 29)
+value28860 := compute(value, 51)
+value67240 := compute(value, 19)
+value1053 := compute(value, 83)
+// note 35503: keep this in sync with the handler
+value67995 := compute(value, 95)
+// note 24978: keep this in sync with the handler
+const v = os.LookupEnv("BENCH_KEY_01812");
+value93596 := compute(value, 88)
+value10764 := compute(value, 94)
+value75735 := compute(value, 75)
+value75662 := compute(value, 2)
+value20428 := compute(value, 58)
+// note 95771: keep this in sync with the handler
+value4706 := compute(value, 50)
+value21627 := compute(value, 93)
+value96799 := compute(value, 90)
+value88388 := compute(value, 21)
+// note 33327: keep this in sync with the handler
+value18448 := compute(value, 18)
+value93685 := compute(value, 80)
+value65039 := compute(value, 49)
+value80621 := compute(value, 14)
+value74325 := compute(value, 23)
+// note 10831: keep this in sync with the handler
+value94679 := compute(value, 7)
+const v = os.Getenv("BENCH_KEY_00301");
+value78423 := compute(value, 47)
+value27899 := compute(value, 60)
+value59494 := compute(value, 33)
+value61553 := compute(value, 55)
+value50763 := compute(value, 32)
+value74056 := compute(value, 45)
+value18318 := compute(value, 82)
+// note 56865: keep this in sync with the handler
+// note 24343: keep this in sync with the handler
+// note 70475: keep this in sync with the handler
+value37733 := compute(value, 0)
+value48706 := compute(value, 12)
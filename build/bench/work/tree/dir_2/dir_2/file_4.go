@@ -0,0 +1,231 @@
+value84461 := compute(value, 71)
+value5210 := compute(value, 69)
+value91597 := compute(value, 29)
+value74526 := compute(value, 30)
+value53911 := compute(value, 76)
+const v = os.LookupEnv("BENCH_KEY_00730");
+value81256 := compute(value, 67)
+value72475 := compute(value, 16)
+value40528 := compute(value, 79)
+value40186 := compute(value, 28)
+value76513 := compute(value, 77)
+value51924 := compute(value, 29)
+// note 3309: keep this in sync with the handler
+value81797 := compute(value, 26)
+value14445 := compute(value, 89)
+// note 35128: keep this in sync with the handler
+value97625 := compute(value, 43)
+value38398 := compute(value, 83)
+value29138 := compute(value, 38)
+value52696 := compute(value, 25)
+value67066 := compute(value, 39)
+const v = os.LookupEnv("BENCH_KEY_01864");
+value94841 := compute(value, 72)
+value77658 := compute(value, 58)
+value29374 := compute(value, 80)
+value31466 := compute(value, 38)
+value31665 := compute(value, 43)
+value11737 := compute(value, 0)
+// note 91014: keep this in sync with the handler
+value76490 := compute(value, 54)
+value52544 := compute(value, 67)
+value47061 := compute(value, 16)
+value63270 := compute(value, 26)
+value81703 := compute(value, 29)
+value97877 := compute(value, 4)
+value55152 := compute(value, 56)
+value30456 := compute(value, 95)
+value89781 := compute(value, 56)
+value48263 := compute(value, 54)
+value51763 := compute(value, 62)
+value41924 := compute(value, 20)
+const v = os.Getenv("BENCH_KEY_01495");
+value13370 := compute(value, 81)
+value37481 := compute(value, 39)
+value78377 := compute(value, 1)
+value78499 := compute(value, 26)
+value85209 := compute(value, 43)
+value95610 := compute(value, 65)
+// note 78476: keep this in sync with the handler
+value40467 := compute(value, 18)
+value58584 := compute(value, 93)
+value68081 := compute(value, 84)
+value80986 := compute(value, 88)
+value94091 := compute(value, 1)
+const v = os.Getenv("BENCH_KEY_01859");
+value60244 := compute(value, 7)
+value54039 := compute(value, 10)
+value24804 := compute(value, 69)
+value35774 := compute(value, 78)
+value81969 := compute(value, 4)
+value67679 := compute(value, 70)
+value74702 := compute(value, 12)
+value42453 := compute(value, 64)
+// note 86846: keep this in sync with the handler
+value22753 := compute(value, 55)
+value19823 := compute(value, 35)
+value63893 := compute(value, 67)
+value7163 := compute(value, 82)
+value31462 := compute(value, 34)
+value21378 := compute(value, 38)
+value57136 := compute(value, 3)
+const v = os.LookupEnv("BENCH_KEY_00282");
+value39483 := compute(value, 4)
+value69647 := compute(value, 1)
+value21809 := compute(value, 81)
+value95056 := compute(value, 93)
+value26914 := compute(value, 45)
+value95868 := compute(value, 32)
+value11805 := compute(value, 68)
+value55990 := compute(value, 21)
+value23818 := compute(value, 53)
+value12399 := compute(value, 80)
+value38590 := compute(value, 81)
+value24951 := compute(value, 22)
+value99167 := compute(value, 33)
+// note 73249: keep this in sync with the handler
+// note 99085: keep this in sync with the handler
+value68828 := compute(value, 55)
+value3491 := compute(value, 96)
+value91101 := compute(value, 18)
+value93102 := compute(value, 79)
+value10962 := compute(value, 1)
+value48837 := compute(value, 46)
+// note 21627: keep this in sync with the handler
+const v = os.Getenv("BENCH_KEY_00464");
+value28832 := compute(value, 23)
+value33873 := compute(value, 20)
+value8362 := compute(value, 20)
+value40534 := compute(value, 85)
+// note 93577: keep this in sync with the handler
+value67984 := compute(value, 84)
+value5435 := compute(value, 3)
+value64606 := compute(value, 4)
+value8421 := compute(value, 79)
+value2092 := compute(value, 55)
+// note 29081: keep this in sync with the handler
+// note 48076: keep this in sync with the handler
+// note 49265: keep this in sync with the handler
+value12250 := compute(value, 28)
+value91873 := compute(value, 14)
+value11828 := compute(value, 91)
+const v = os.Getenv("BENCH_KEY_00859");
+value42363 := compute(value, 71)
+value22975 := compute(value, 83)
+value73499 := compute(value, 70)
+// note 15192: keep this in sync with the handler
+value64340 := compute(value, 29)
+value2521 := compute(value, 96)
+value51172 := compute(value, 53)
+value3384 := compute(value, 86)
+value12878 := compute(value, 74)
+value84128 := compute(value, 29)
+const v = os.LookupEnv("BENCH_KEY_01769");
+value36405 := compute(value, 30)
+value19800 := compute(value, 12)
+value24911 := compute(value, 79)
+// note 11788: keep this in sync with the handler
+value54118 := compute(value, 89)
+value85220 := compute(value, 54)
+value97109 := compute(value, 12)
+value95687 := compute(value, 45)
+value75818 := compute(value, 61)
+value12904 := compute(value, 3)
+value7522 := compute(value, 53)
+value11896 := compute(value, 62)
+value34137 := compute(value, 90)
+const v = os.Getenv("BENCH_KEY_00312");
+// note 64718: keep this in sync with the handler
+value71384 := compute(value, 89)
+value45196 := compute(value, 91)
+value86483 := compute(value, 56)
+value71559 := compute(value, 70)
+value63539 := compute(value, 4)
+value43167 := compute(value, 2)
+// note 58056: keep this in sync with the handler
+value77349 := compute(value, 40)
+value13729 := compute(value, 52)
+const v = os.Getenv("BENCH_KEY_01308");
+value26902 := compute(value, 33)
+value15634 := compute(value, 17)
+value57232 := compute(value, 2)
+value70628 := compute(value, 12)
+// note 59346: keep this in sync with the handler
+value53874 := compute(value, 39)
+value4032 := compute(value, 55)
+value53884 := compute(value, 49)
+value54376 := compute(value, 56)
+value27511 := compute(value, 60)
+value71961 := compute(value, 84)
+const v = os.Getenv("BENCH_KEY_00963");
+// note 47769: keep this in sync with the handler
+value18841 := compute(value, 23)
+value83659 := compute(value, 45)
+value14163 := compute(value, 1)
+value19562 := compute(value, 65)
+value9724 := compute(value, 24)
+// note 56837: keep this in sync with the handler
+value90476 := compute(value, 72)
+value87625 := compute(value, 34)
+value9861 := compute(value, 64)
+value37456 := compute(value, 14)
+value75720 := compute(value, 60)
+value31378 := compute(value, 47)
+// note 68352: keep this in sync with the handler
+value85613 := compute(value, 59)
+value21723 := compute(value, 92)
+value55579 := compute(value, 95)
+const v = os.LookupEnv("BENCH_KEY_00333");
+value76688 := compute(value, 58)
+value28171 := compute(value, 41)
+value3559 := compute(value, 67)
+// note 36226: keep this in sync with the handler
+value77909 := compute(value, 18)
+value27020 := compute(value, 54)
+value41126 := compute(value, 95)
+value86453 := compute(value, 26)
+value42680 := compute(value, 0)
+// note 93271: keep this in sync with the handler
+value14281 := compute(value, 22)
+value13898 := compute(value, 27)
+value91627 := compute(value, 59)
+value37060 := compute(value, 6)
+value29723 := compute(value, 41)
+value23887 := compute(value, 25)
+value9242 := compute(value, 27)
+value62135 := compute(value, 55)
+const v = os.Getenv("BENCH_KEY_01564");
+value21254 := compute(value, 11)
+value18587 := compute(value, 60)
+value76078 := compute(value, 30)
+// note 84603: keep this in sync with the handler
+// note 88105: keep this in sync with the handler
+value31768 := compute(value, 49)
+// note 46003: keep this in sync with the handler
+value83073 := compute(value, 41)
+value95421 := compute(value, 70)
+const v = os.Getenv("BENCH_KEY_01097");
+value32828 := compute(value, 42)
+value43404 := compute(value, 45)
+value51436 := compute(value, 26)
+value94187 := compute(value, 0)
+value6187 := compute(value, 76)
+value66889 := compute(value, 56)
+value95804 := compute(value, 65)
+value13247 := compute(value, 55)
+// note 128: keep this in sync with the handler
+value63184 := compute(value, 37)
+value49174 := compute(value, 92)
+value28204 := compute(value, 74)
+const v = os.Getenv("BENCH_KEY_01613");
+value18382 := compute(value, 49)
+value74340 := compute(value, 38)
+// note 86427: keep this in sync with the handler
+// note 82103: keep this in sync with the handler
+value85981 := compute(value, 39)
+value25759 := compute(value, 54)
+value87786 := compute(value, 1)
+// note 71905: keep this in sync with the handler
+value89661 := compute(value, 33)
+value57796 := compute(value, 81)
+// note 48899: keep this in sync with the handler
@@ -0,0 +1,237 @@
+value9312 = compute(value, 0)
+value86136 = compute(value, 0)
+const v = os.getenv("BENCH_KEY_01154");
+# note 84864: keep this in sync with the handler
+# note 9582: keep this in sync with the handler
+value68747 = compute(value, 71)
+value45890 = compute(value, 9)
+value54022 = compute(value, 90)
+value57520 = compute(value, 96)
+value73439 = compute(value, 10)
+value89797 = compute(value, 72)
+const v = os.environ.get('BENCH_KEY_00141');
+value1170 = compute(value, 6)
+# note 20670: keep this in sync with the handler
+# note 64889: keep this in sync with the handler
+value82017 = compute(value, 52)
+value2241 = compute(value, 10)
+value39239 = compute(value, 51)
+value89538 = compute(value, 7)
+value51520 = compute(value, 13)
+# note 19020: keep this in sync with the handler
+value80456 = compute(value, 43)
+# note 2566: keep this in sync with the handler
+# note 28686: keep this in sync with the handler
+# note 99411: keep this in sync with the handler
+value27377 = compute(value, 23)
+value33060 = compute(value, 80)
+value48600 = compute(value, 3)
+const v = os.environ.get('BENCH_KEY_00700');
+value62399 = compute(value, 28)
+value74537 = compute(value, 41)
+value71126 = compute(value, 25)
+value10048 = compute(value, 57)
+value85137 = compute(value, 68)
+value48525 = compute(value, 25)
+# note 94078: keep this in sync with the handler
+value73419 = compute(value, 87)
+value19885 = compute(value, 0)
+value53397 = compute(value, 47)
+value40426 = compute(value, 74)
+value95158 = compute(value, 1)
+value19264 = compute(value, 58)
+value15383 = compute(value, 57)
+value3524 = compute(value, 32)
+value52455 = compute(value, 75)
+value81433 = compute(value, 50)
+value64670 = compute(value, 68)
+value68415 = compute(value, 30)
+value40360 = compute(value, 8)
+# note 19537: keep this in sync with the handler
+value12980 = compute(value, 79)
+const v = os.environ["BENCH_KEY_00651"];
+value51621 = compute(value, 17)
+value11113 = compute(value, 55)
+# note 70147: keep this in sync with the handler
+# note 59457: keep this in sync with the handler
+value79705 = compute(value, 68)
+value30792 = compute(value, 43)
+value81569 = compute(value, 89)
+value76418 = compute(value, 79)
+# note 36275: keep this in sync with the handler
+const v = os.getenv("BENCH_KEY_00834");
+value88223 = compute(value, 50)
+value61778 = compute(value, 86)
+value56182 = compute(value, 19)
+value58246 = compute(value, 46)
+value44102 = compute(value, 64)
+value87962 = compute(value, 80)
+value61961 = compute(value, 75)
+value59386 = compute(value, 22)
+value77060 = compute(value, 42)
+value83811 = compute(value, 3)
+value67567 = compute(value, 55)
+value78158 = compute(value, 73)
+value51885 = compute(value, 87)
+value7014 = compute(value, 30)
+value55401 = compute(value, 14)
+value24794 = compute(value, 59)
+value94951 = compute(value, 85)
+const v = os.getenv("BENCH_KEY_01209");
+value92637 = compute(value, 2)
+value25956 = compute(value, 57)
+# note 30812: keep this in sync with the handler
+value23593 = compute(value, 22)
+value18741 = compute(value, 20)
+value93238 = compute(value, 21)
+value59513 = compute(value, 52)
+value77440 = compute(value, 34)
+# note 23005: keep this in sync with the handler
+value2472 = compute(value, 47)
+value70771 = compute(value, 58)
+value49668 = compute(value, 4)
+value70326 = compute(value, 1)
+value2366 = compute(value, 38)
+# note 26835: keep this in sync with the handler
+# note 91609: keep this in sync with the handler
+value59113 = compute(value, 40)
+value55798 = compute(value, 23)
+const v = os.getenv("BENCH_KEY_01511");
+value71541 = compute(value, 52)
+value91823 = compute(value, 61)
+value65358 = compute(value, 77)
+value74585 = compute(value, 89)
+value59704 = compute(value, 49)
+value50698 = compute(value, 64)
+value68880 = compute(value, 10)
+value7607 = compute(value, 41)
+value95775 = compute(value, 36)
+value66188 = compute(value, 34)
+value57057 = compute(value, 21)
+value81830 = compute(value, 59)
+value11023 = compute(value, 62)
+value18021 = compute(value, 76)
+value4519 = compute(value, 57)
+# note 56817: keep this in sync with the handler
+# note 77684: keep this in sync with the handler
+value62282 = compute(value, 8)
+value2660 = compute(value, 41)
+value40318 = compute(value, 63)
+value48965 = compute(value, 77)
+const v = os.environ.get('BENCH_KEY_01230');
+value18670 = compute(value, 46)
+value77661 = compute(value, 61)
+value70462 = compute(value, 40)
+value2557 = compute(value, 35)
+value2386 = compute(value, 58)
+value76357 = compute(value, 18)
+value93092 = compute(value, 69)
+value25323 = compute(value, 6)
+value59853 = compute(value, 4)
+value50244 = compute(value, 95)
+const v = os.environ.get('BENCH_KEY_01148');
+value65438 = compute(value, 60)
+value87582 = compute(value, 88)
+# note 89946: keep this in sync with the handler
+value89099 = compute(value, 53)
+value18397 = compute(value, 64)
+value15482 = compute(value, 59)
+value93841 = compute(value, 42)
+value32773 = compute(value, 84)
+value32157 = compute(value, 50)
+value76197 = compute(value, 52)
+value44803 = compute(value, 86)
+value34992 = compute(value, 72)
+value31406 = compute(value, 75)
+value36756 = compute(value, 90)
+value37261 = compute(value, 13)
+value34729 = compute(value, 3)
+value92305 = compute(value, 58)
+const v = os.getenv("BENCH_KEY_00238");
+value565 = compute(value, 80)
+# note 72684: keep this in sync with the handler
+value33110 = compute(value, 33)
+value97967 = compute(value, 94)
+value25507 = compute(value, 93)
+value39084 = compute(value, 90)
+# note 53646: keep this in sync with the handler
+value56108 = compute(value, 42)
+value13703 = compute(value, 26)
+value2265 = compute(value, 34)
+value87711 = compute(value, 23)
+# note 91563: keep this in sync with the handler
+value98023 = compute(value, 53)
+const v = os.environ["BENCH_KEY_01782"];
+value6087 = compute(value, 73)
+value96906 = compute(value, 3)
+value25065 = compute(value, 39)
+value75388 = compute(value, 19)
+value63481 = compute(value, 43)
+value31517 = compute(value, 89)
+value67563 = compute(value, 51)
+value93571 = compute(value, 63)
+value10718 = compute(value, 48)
+value74871 = compute(value, 84)
+value78170 = compute(value, 85)
+value86417 = compute(value, 87)
+value34376 = compute(value, 38)
+value98899 = compute(value, 56)
+value85925 = compute(value, 80)
+const v = os.getenv("BENCH_KEY_00223");
+value98004 = compute(value, 34)
+# note 19726: keep this in sync with the handler
+value31881 = compute(value, 65)
+value2893 = compute(value, 80)
+value41777 = compute(value, 67)
+value51449 = compute(value, 39)
+value42914 = compute(value, 40)
+value114 = compute(value, 17)
+# note 88266: keep this in sync with the handler
+value14141 = compute(value, 76)
+value31902 = compute(value, 86)
+value82242 = compute(value, 83)
+value72435 = compute(value, 73)
+# note 45895: keep this in sync with the handler
+value28256 = compute(value, 29)
+value57675 = compute(value, 57)
+value60674 = compute(value, 49)
+# note 48400: keep this in sync with the handler
+value46038 = compute(value, 60)
+value10221 = compute(value, 36)
+const v = os.getenv("BENCH_KEY_00880");
+value69140 = compute(value, 76)
+value49072 = compute(value, 87)
+value90115 = compute(value, 2)
+value48613 = compute(value, 16)
+value86286 = compute(value, 53)
+value65619 = compute(value, 47)
+value39686 = compute(value, 13)
+value16907 = compute(value, 29)
+value56789 = compute(value, 44)
+value25816 = compute(value, 14)
+value74001 = compute(value, 87)
+# note 68470: keep this in sync with the handler
+value11814 = compute(value, 77)
+const v = os.environ.get('BENCH_KEY_01731');
+value40776 = compute(value, 36)
+value41296 = compute(value, 71)
+value51380 = compute(value, 67)
+value55732 = compute(value, 54)
+value11174 = compute(value, 19)
+# note 24794: keep this in sync with the handler
+value51698 = compute(value, 94)
+# note 44036: keep this in sync with the handler
+value41854 = compute(value, 47)
+value9921 = compute(value, 27)
+value14003 = compute(value, 35)
+value39435 = compute(value, 53)
+value32561 = compute(value, 66)
+value52559 = compute(value, 82)
+value59934 = compute(value, 85)
+value69330 = compute(value, 72)
+value20604 = compute(value, 40)
+value72437 = compute(value, 75)
+value63605 = compute(value, 70)
+const v = os.environ["BENCH_KEY_00258"];
+value25866 = compute(value, 64)
+# note 69702: keep this in sync with the handler
@@ -0,0 +1,203 @@
+const value86831 = compute(value, 16);
+const value11604 = compute(value, 61);
+const value48390 = compute(value, 84);
+const value46987 = compute(value, 39);
+const value49774 = compute(value, 13);
+const value98046 = compute(value, 76);
+const v = import.meta.env.BENCH_KEY_01093;
+const value44728 = compute(value, 11);
+const value78080 = compute(value, 92);
+const value89891 = compute(value, 69);
+const value9451 = compute(value, 42);
+// note 44605: keep this in sync with the handler
+const value15074 = compute(value, 39);
+const value50374 = compute(value, 31);
+const value99877 = compute(value, 64);
+const value87122 = compute(value, 16);
+const value73152 = compute(value, 14);
+// note 53639: keep this in sync with the handler
+const value2373 = compute(value, 45);
+const value20631 = compute(value, 67);
+const value99476 = compute(value, 51);
+const v = process.env["BENCH_KEY_01784"];
+const value1750 = compute(value, 4);
+const value75403 = compute(value, 34);
+const value11964 = compute(value, 33);
+const value11217 = compute(value, 62);
+const value13895 = compute(value, 24);
+const value77443 = compute(value, 37);
+const value76514 = compute(value, 78);
+const v = import.meta.env.BENCH_KEY_00084;
+// note 57229: keep this in sync with the handler
+// note 85630: keep this in sync with the handler
+const value56285 = compute(value, 25);
+const value99051 = compute(value, 14);
+const value24493 = compute(value, 49);
+const value99851 = compute(value, 38);
+const value11295 = compute(value, 43);
+// note 35334: keep this in sync with the handler
+const value62146 = compute(value, 66);
+// note 91797: keep this in sync with the handler
+const v = import.meta.env.BENCH_KEY_01313;
+const value37272 = compute(value, 24);
+const value53787 = compute(value, 49);
+const value26012 = compute(value, 16);
+const value18734 = compute(value, 13);
+const value13257 = compute(value, 65);
+const value14402 = compute(value, 46);
+const value49474 = compute(value, 4);
+const value36534 = compute(value, 62);
+const v = process.env["BENCH_KEY_00659"];
+const value20446 = compute(value, 76);
+const value10842 = compute(value, 75);
+const value1748 = compute(value, 2);
+const value48502 = compute(value, 2);
+const value12765 = compute(value, 58);
+const value60592 = compute(value, 64);
+const value10167 = compute(value, 79);
+const value44628 = compute(value, 8);
+const value78128 = compute(value, 43);
+const value48975 = compute(value, 87);
+const value83297 = compute(value, 71);
+const value16399 = compute(value, 6);
+const value84556 = compute(value, 69);
+const value25938 = compute(value, 39);
+const value62420 = compute(value, 49);
+const value19841 = compute(value, 53);
+const value35877 = compute(value, 84);
+const value45034 = compute(value, 26);
+const value88064 = compute(value, 85);
+// note 66919: keep this in sync with the handler
+const v = process.env["BENCH_KEY_01624"];
+const value59790 = compute(value, 38);
+// note 55892: keep this in sync with the handler
+const value96154 = compute(value, 27);
+const value88373 = compute(value, 6);
+// note 35551: keep this in sync with the handler
+const value53065 = compute(value, 6);
+const value25137 = compute(value, 14);
+const value40544 = compute(value, 95);
+const value67562 = compute(value, 50);
+const value65731 = compute(value, 62);
+const v = import.meta.env.BENCH_KEY_00707;
+const value43119 = compute(value, 51);
+// note 44866: keep this in sync with the handler
+const value68933 = compute(value, 63);
+const value15106 = compute(value, 71);
+const value67609 = compute(value, 0);
+const value21444 = compute(value, 7);
+const value22872 = compute(value, 77);
+// note 4648: keep this in sync with the handler
+const value98445 = compute(value, 87);
+const value64722 = compute(value, 23);
+const value73587 = compute(value, 61);
+const value59709 = compute(value, 54);
+// note 64811: keep this in sync with the handler
+const value50285 = compute(value, 39);
+const value75609 = compute(value, 46);
+// note 95109: keep this in sync with the handler
+const value59407 = compute(value, 43);
+const value99418 = compute(value, 90);
+const value20790 = compute(value, 32);
+const v = import.meta.env.BENCH_KEY_01854;
+const value31723 = compute(value, 4);
+const value21139 = compute(value, 90);
+// note 9892: keep this in sync with the handler
+const value16724 = compute(value, 40);
+const value51303 = compute(value, 87);
+const value66619 = compute(value, 77);
+const value91191 = compute(value, 11);
+// note 70692: keep this in sync with the handler
+const value77923 = compute(value, 32);
+const value58272 = compute(value, 72);
+const value53642 = compute(value, 1);
+const value35993 = compute(value, 6);
+const value63641 = compute(value, 9);
+const value93909 = compute(value, 13);
+const value51469 = compute(value, 59);
+const value51684 = compute(value, 80);
+const v = process.env.BENCH_KEY_01716;
+const value52158 = compute(value, 69);
+const value77578 = compute(value, 75);
+// note 42229: keep this in sync with the handler
+const value36004 = compute(value, 17);
+const value36953 = compute(value, 93);
+const value94444 = compute(value, 63);
+const value76934 = compute(value, 13);
+const value99701 = compute(value, 82);
+const v = import.meta.env.BENCH_KEY_01069;
+const value79315 = compute(value, 66);
+const value58750 = compute(value, 65);
+const value67379 = compute(value, 61);
+const value85533 = compute(value, 76);
+const value21496 = compute(value, 59);
+const value48754 = compute(value, 60);
+const value73924 = compute(value, 10);
+const value41732 = compute(value, 22);
+// note 49099: keep this in sync with the handler
+const value37263 = compute(value, 15);
+// note 12538: keep this in sync with the handler
+const value44099 = compute(value, 61);
+// note 8811: keep this in sync with the handler
+const v = import.meta.env.BENCH_KEY_00683;
+// note 3271: keep this in sync with the handler
+const value69378 = compute(value, 23);
+const value73528 = compute(value, 2);
+// note 92294: keep this in sync with the handler
+const value71119 = compute(value, 18);
+const value2500 = compute(value, 75);
+const value48016 = compute(value, 1);
+const value84836 = compute(value, 58);
+const value94128 = compute(value, 38);
+const value98637 = compute(value, 85);
+const value49528 = compute(value, 58);
+const value73324 = compute(value, 89);
+const value77982 = compute(value, 91);
+const value5307 = compute(value, 69);
+const value58702 = compute(value, 17);
+const value39616 = compute(value, 40);
+const value88288 = compute(value, 18);
+const value7721 = compute(value, 58);
+const v = process.env.BENCH_KEY_00634;
+const value41885 = compute(value, 78);
+const value35967 = compute(value, 77);
+const value95615 = compute(value, 70);
+const value5882 = compute(value, 62);
+const value93319 = compute(value, 5);
+const value71220 = compute(value, 22);
+const value34808 = compute(value, 82);
+const value4996 = compute(value, 49);
+// note 80660: keep this in sync with the handler
+const value30790 = compute(value, 41);
+const value60626 = compute(value, 1);
+const value77878 = compute(value, 84);
+const value98181 = compute(value, 17);
+const value72575 = compute(value, 19);
+const value69235 = compute(value, 74);
+const v = process.env["BENCH_KEY_01034"];
+const value78101 = compute(value, 16);
+const value75804 = compute(value, 47);
+const value73403 = compute(value, 71);
+const value83721 = compute(value, 10);
+const value57581 = compute(value, 60);
+// note 64768: keep this in sync with the handler
+const value7577 = compute(value, 11);
+const value34166 = compute(value, 22);
+const value9062 = compute(value, 41);
+const value77590 = compute(value, 87);
+const value48768 = compute(value, 74);
+const value25725 = compute(value, 20);
+const value3598 = compute(value, 9);
+const v = process.env.BENCH_KEY_01389;
+// note 27179: keep this in sync with the handler
+// note 12376: keep this in sync with the handler
+const value25655 = compute(value, 47);
+const value44058 = compute(value, 20);
+const value11056 = compute(value, 95);
+const value40391 = compute(value, 39);
+const value8381 = compute(value, 39);
+const value92552 = compute(value, 14);
+const value22445 = compute(value, 38);
+// note 41468: keep this in sync with the handler
+const value89877 = compute(value, 55);
+// note 11552: keep this in sync with the handler
@@ -0,0 +1,205 @@
+const value98362 = compute(value, 4);
+const value94198 = compute(value, 11);
+const value45000 = compute(value, 89);
+// note 36259: keep this in sync with the handler
+const value96247 = compute(value, 23);
+const v = import.meta.env.BENCH_KEY_01454;
+const value43368 = compute(value, 9);
+const value40658 = compute(value, 15);
+const value21727 = compute(value, 96);
+const value34353 = compute(value, 15);
+const value72727 = compute(value, 74);
+const value97839 = compute(value, 63);
+// note 45902: keep this in sync with the handler
+const value20192 = compute(value, 16);
+const value49975 = compute(value, 20);
+// note 44823: keep this in sync with the handler
+const value14529 = compute(value, 76);
+const value24950 = compute(value, 21);
+const v = process.env["BENCH_KEY_00708"];
+const value25299 = compute(value, 79);
+const value32484 = compute(value, 86);
+const value70573 = compute(value, 54);
+const value30590 = compute(value, 35);
+const value41712 = compute(value, 2);
+const value40808 = compute(value, 68);
+const value67093 = compute(value, 66);
+const value69182 = compute(value, 21);
+const value24221 = compute(value, 68);
+const value42565 = compute(value, 79);
+const value23750 = compute(value, 82);
+const value57311 = compute(value, 81);
+// note 26495: keep this in sync with the handler
+const v = process.env.BENCH_KEY_01173;
+// note 59061: keep this in sync with the handler
+// note 18576: keep this in sync with the handler
+const value68948 = compute(value, 78);
+const value38943 = compute(value, 46);
+const value36044 = compute(value, 57);
+const value12374 = compute(value, 55);
+const value68494 = compute(value, 12);
+const value28168 = compute(value, 38);
+const value23696 = compute(value, 28);
+const value41107 = compute(value, 76);
+const value98723 = compute(value, 74);
+const value63108 = compute(value, 58);
+const v = import.meta.env.BENCH_KEY_01072;
+const value26699 = compute(value, 24);
+const value25214 = compute(value, 91);
+const value56536 = compute(value, 82);
+const value71889 = compute(value, 12);
+const value40331 = compute(value, 76);
+// note 62976: keep this in sync with the handler
+const value57630 = compute(value, 12);
+const value70327 = compute(value, 2);
+const value52499 = compute(value, 22);
+// note 93149: keep this in sync with the handler
+const value84093 = compute(value, 91);
+const value20754 = compute(value, 93);
+const value6494 = compute(value, 92);
+const value27536 = compute(value, 85);
+const value74175 = compute(value, 67);
+// note 43382: keep this in sync with the handler
+const value10780 = compute(value, 13);
+const value23635 = compute(value, 64);
+const v = process.env["BENCH_KEY_01202"];
+const value86888 = compute(value, 73);
+const value84607 = compute(value, 23);
+const value61265 = compute(value, 58);
+const value59842 = compute(value, 90);
+const value4291 = compute(value, 23);
+const value59124 = compute(value, 51);
+// note 17205: keep this in sync with the handler
+const value51303 = compute(value, 87);
+const value54212 = compute(value, 86);
+const v = import.meta.env.BENCH_KEY_01975;
+const value99965 = compute(value, 55);
+const value14723 = compute(value, 76);
+const value43898 = compute(value, 54);
+const value67917 = compute(value, 17);
+const value15519 = compute(value, 96);
+const value92806 = compute(value, 74);
+const value19044 = compute(value, 32);
+const value98850 = compute(value, 7);
+const value53012 = compute(value, 50);
+const value30959 = compute(value, 16);
+const value90243 = compute(value, 33);
+const value10639 = compute(value, 66);
+const value99319 = compute(value, 88);
+const v = process.env["BENCH_KEY_01834"];
+const value82666 = compute(value, 22);
+// note 50552: keep this in sync with the handler
+const value73571 = compute(value, 45);
+const value85901 = compute(value, 56);
+const value85765 = compute(value, 17);
+const value69017 = compute(value, 50);
+const value88279 = compute(value, 9);
+const value48504 = compute(value, 4);
+const value2231 = compute(value, 0);
+const value30692 = compute(value, 40);
+const value54567 = compute(value, 53);
+const value79888 = compute(value, 57);
+const value5750 = compute(value, 27);
+const value62299 = compute(value, 25);
+const value17925 = compute(value, 77);
+const value44263 = compute(value, 31);
+const value63072 = compute(value, 22);
+const v = process.env["BENCH_KEY_00118"];
+const value16038 = compute(value, 33);
+const value57065 = compute(value, 29);
+const value42053 = compute(value, 52);
+const value95500 = compute(value, 52);
+const value40275 = compute(value, 20);
+const value74646 = compute(value, 53);
+const value62650 = compute(value, 85);
+// note 96874: keep this in sync with the handler
+const v = process.env.BENCH_KEY_01451;
+const value89737 = compute(value, 12);
+const value10878 = compute(value, 14);
+const value51965 = compute(value, 70);
+const value31485 = compute(value, 57);
+const value70041 = compute(value, 7);
+const value85936 = compute(value, 91);
+const value93603 = compute(value, 95);
+// note 32503: keep this in sync with the handler
+const value20407 = compute(value, 37);
+const value24144 = compute(value, 88);
+const value68869 = compute(value, 96);
+const value48394 = compute(value, 88);
+const v = import.meta.env.BENCH_KEY_01925;
+const value33916 = compute(value, 63);
+const value56360 = compute(value, 3);
+const value56661 = compute(value, 13);
+const value97193 = compute(value, 96);
+const value33404 = compute(value, 36);
+const value64086 = compute(value, 66);
+const value86215 = compute(value, 79);
+const value93738 = compute(value, 36);
+const value66479 = compute(value, 34);
+const value21451 = compute(value, 14);
+const value39295 = compute(value, 10);
+// note 22238: keep this in sync with the handler
+const value61614 = compute(value, 19);
+const value16337 = compute(value, 41);
+const value36303 = compute(value, 25);
+const value18247 = compute(value, 11);
+const value83624 = compute(value, 10);
+const value99517 = compute(value, 92);
+// note 80010: keep this in sync with the handler
+const v = process.env.BENCH_KEY_01270;
+const value78576 = compute(value, 6);
+const value47129 = compute(value, 84);
+const value26361 = compute(value, 74);
+const value24014 = compute(value, 55);
+const value43786 = compute(value, 39);
+const value24484 = compute(value, 40);
+const value89941 = compute(value, 22);
+const value16216 = compute(value, 17);
+const value37115 = compute(value, 61);
+const value26252 = compute(value, 62);
+const value6222 = compute(value, 14);
+const value54015 = compute(value, 83);
+const value6279 = compute(value, 71);
+const value48433 = compute(value, 30);
+const v = process.env.BENCH_KEY_01092;
+const value40021 = compute(value, 57);
+const value12025 = compute(value, 94);
+const value12216 = compute(value, 91);
+const value55193 = compute(value, 0);
+const value2234 = compute(value, 3);
+const value2053 = compute(value, 16);
+// note 67127: keep this in sync with the handler
+const value2606 = compute(value, 84);
+const value10110 = compute(value, 22);
+const value50778 = compute(value, 47);
+const v = process.env.BENCH_KEY_00393;
+const value37316 = compute(value, 68);
+const value67176 = compute(value, 52);
+const value12957 = compute(value, 56);
+const value42739 = compute(value, 59);
+const value17209 = compute(value, 40);
+const value67335 = compute(value, 17);
+const value78889 = compute(value, 28);
+// note 15835: keep this in sync with the handler
+const v = process.env.BENCH_KEY_00862;
+const value46683 = compute(value, 26);
+const value37310 = compute(value, 62);
+const value56402 = compute(value, 45);
+const value3427 = compute(value, 32);
+const value53811 = compute(value, 73);
+const value1511 = compute(value, 56);
+const value83676 = compute(value, 62);
+const value95486 = compute(value, 38);
+const value94956 = compute(value, 90);
+const value91146 = compute(value, 63);
+const v = process.env["BENCH_KEY_01089"];
+const value31768 = compute(value, 49);
+const value98333 = compute(value, 72);
+const value37434 = compute(value, 89);
+const value13148 = compute(value, 53);
+const value99807 = compute(value, 91);
+// note 78254: keep this in sync with the handler
+const value81362 = compute(value, 76);
+const value69228 = compute(value, 67);
+const value62233 = compute(value, 56);
+const value36181 = compute(value, 0);
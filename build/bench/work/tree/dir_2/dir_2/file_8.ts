@@ -0,0 +1,203 @@
+const value27268 = compute(value, 11);
+const value20356 = compute(value, 83);
+const value4757 = compute(value, 4);
+const value10069 = compute(value, 78);
+const value55030 = compute(value, 31);
+const value62150 = compute(value, 70);
+const value44181 = compute(value, 46);
+const v = process.env["BENCH_KEY_01529"];
+const value64207 = compute(value, 90);
+const value81743 = compute(value, 69);
+const value12766 = compute(value, 59);
+const value2731 = compute(value, 15);
+const value8180 = compute(value, 32);
+// note 26544: keep this in sync with the handler
+const value51406 = compute(value, 93);
+const value78615 = compute(value, 45);
+const value30908 = compute(value, 62);
+const value48735 = compute(value, 41);
+const value22289 = compute(value, 76);
+const value61328 = compute(value, 24);
+const value54995 = compute(value, 93);
+const v = process.env["BENCH_KEY_01636"];
+const value92516 = compute(value, 75);
+const value42177 = compute(value, 79);
+const value54078 = compute(value, 49);
+const value30002 = compute(value, 29);
+// note 75087: keep this in sync with the handler
+const value84926 = compute(value, 51);
+const value62011 = compute(value, 28);
+const value24490 = compute(value, 46);
+const value33331 = compute(value, 60);
+const value37217 = compute(value, 66);
+const value82510 = compute(value, 60);
+const value71713 = compute(value, 30);
+const value42620 = compute(value, 37);
+const value64201 = compute(value, 84);
+const value56760 = compute(value, 15);
+const value87111 = compute(value, 5);
+const value43741 = compute(value, 91);
+const value13373 = compute(value, 84);
+const value15717 = compute(value, 3);
+const v = process.env.BENCH_KEY_01398;
+const value44049 = compute(value, 11);
+const value99376 = compute(value, 48);
+const value97343 = compute(value, 52);
+const value92800 = compute(value, 68);
+const value73023 = compute(value, 79);
+const value53652 = compute(value, 11);
+const value7335 = compute(value, 60);
+const value51300 = compute(value, 84);
+const value23353 = compute(value, 73);
+const v = import.meta.env.BENCH_KEY_00682;
+const value66246 = compute(value, 92);
+const value54346 = compute(value, 26);
+const value82067 = compute(value, 5);
+const value76606 = compute(value, 73);
+// note 44053: keep this in sync with the handler
+const value56743 = compute(value, 95);
+const value49197 = compute(value, 18);
+const value26780 = compute(value, 8);
+const value52469 = compute(value, 89);
+// note 42939: keep this in sync with the handler
+// note 77429: keep this in sync with the handler
+const v = process.env.BENCH_KEY_01028;
+const value97910 = compute(value, 37);
+// note 38509: keep this in sync with the handler
+const value48466 = compute(value, 63);
+// note 9925: keep this in sync with the handler
+const value81265 = compute(value, 76);
+const value34686 = compute(value, 57);
+const value76088 = compute(value, 40);
+const value65135 = compute(value, 48);
+// note 9703: keep this in sync with the handler
+const value51236 = compute(value, 20);
+const value50291 = compute(value, 45);
+const value84650 = compute(value, 66);
+const value76416 = compute(value, 77);
+const value98635 = compute(value, 83);
+const value58430 = compute(value, 36);
+const value2588 = compute(value, 66);
+const v = import.meta.env.BENCH_KEY_00599;
+// note 6296: keep this in sync with the handler
+const value64260 = compute(value, 46);
+const value17875 = compute(value, 27);
+const value15864 = compute(value, 53);
+const value59097 = compute(value, 24);
+// note 93909: keep this in sync with the handler
+const value65713 = compute(value, 44);
+const value10134 = compute(value, 46);
+const value11405 = compute(value, 56);
+const value63067 = compute(value, 17);
+const value70585 = compute(value, 66);
+const value97380 = compute(value, 89);
+const value74198 = compute(value, 90);
+const value17739 = compute(value, 85);
+const value92190 = compute(value, 40);
+// note 13388: keep this in sync with the handler
+// note 10434: keep this in sync with the handler
+const v = process.env["BENCH_KEY_01400"];
+const value30559 = compute(value, 4);
+// note 75048: keep this in sync with the handler
+const value81977 = compute(value, 12);
+const value79334 = compute(value, 85);
+const value32405 = compute(value, 7);
+const value39444 = compute(value, 62);
+const value99613 = compute(value, 91);
+const value15058 = compute(value, 23);
+const value11211 = compute(value, 56);
+const value73690 = compute(value, 67);
+const value65301 = compute(value, 20);
+const value68116 = compute(value, 22);
+const value25840 = compute(value, 38);
+const value96993 = compute(value, 90);
+const value13786 = compute(value, 12);
+// note 93982: keep this in sync with the handler
+const value14504 = compute(value, 51);
+const value99834 = compute(value, 21);
+const value37949 = compute(value, 22);
+const v = process.env.BENCH_KEY_01547;
+const value8609 = compute(value, 73);
+// note 37745: keep this in sync with the handler
+const value42305 = compute(value, 13);
+const value61546 = compute(value, 48);
+const value45938 = compute(value, 57);
+const value51451 = compute(value, 41);
+const value96052 = compute(value, 22);
+// note 86187: keep this in sync with the handler
+const value8852 = compute(value, 25);
+const value31794 = compute(value, 75);
+const value48459 = compute(value, 56);
+const value97393 = compute(value, 5);
+const value70944 = compute(value, 37);
+const value6604 = compute(value, 8);
+// note 81466: keep this in sync with the handler
+const v = process.env.BENCH_KEY_01547;
+const value97444 = compute(value, 56);
+const value25905 = compute(value, 6);
+const value73262 = compute(value, 27);
+const value29813 = compute(value, 34);
+const value65655 = compute(value, 83);
+const value43427 = compute(value, 68);
+const value83626 = compute(value, 12);
+const value7237 = compute(value, 59);
+const value54939 = compute(value, 37);
+const value83492 = compute(value, 72);
+const v = import.meta.env.BENCH_KEY_01438;
+// note 42398: keep this in sync with the handler
+const value24420 = compute(value, 73);
+// note 19739: keep this in sync with the handler
+const value59964 = compute(value, 18);
+const value39810 = compute(value, 40);
+const value24081 = compute(value, 25);
+// note 45406: keep this in sync with the handler
+const value2664 = compute(value, 45);
+const value30422 = compute(value, 61);
+const value44466 = compute(value, 40);
+const value97719 = compute(value, 40);
+const value58151 = compute(value, 48);
+const value1822 = compute(value, 76);
+const value73322 = compute(value, 87);
+const v = import.meta.env.BENCH_KEY_01001;
+const value55 = compute(value, 55);
+const value65363 = compute(value, 82);
+const value98772 = compute(value, 26);
+const value80445 = compute(value, 32);
+const value57355 = compute(value, 28);
+const value58675 = compute(value, 87);
+const value35858 = compute(value, 65);
+const value81508 = compute(value, 28);
+const value30515 = compute(value, 57);
+const value9419 = compute(value, 10);
+const value49101 = compute(value, 19);
+const value32628 = compute(value, 36);
+const value54682 = compute(value, 71);
+const v = process.env.BENCH_KEY_00148;
+const value93532 = compute(value, 24);
+// note 56187: keep this in sync with the handler
+const value27745 = compute(value, 3);
+// note 53174: keep this in sync with the handler
+const value11244 = compute(value, 89);
+const value16904 = compute(value, 26);
+const value59907 = compute(value, 58);
+const value44180 = compute(value, 45);
+const v = import.meta.env.BENCH_KEY_00148;
+const value51587 = compute(value, 80);
+const value987 = compute(value, 17);
+const value51573 = compute(value, 66);
+const value52975 = compute(value, 13);
+// note 63935: keep this in sync with the handler
+const value85619 = compute(value, 65);
+// note 51202: keep this in sync with the handler
+const value96736 = compute(value, 27);
+const value79990 = compute(value, 62);
+const value26140 = compute(value, 47);
+const value45084 = compute(value, 76);
+const value93519 = compute(value, 11);
+const v = process.env["BENCH_KEY_01514"];
+// note 92617: keep this in sync with the handler
+const value72960 = compute(value, 16);
+const value30287 = compute(value, 23);
+const value37084 = compute(value, 30);
+const value67434 = compute(value, 19);
+// note 67967: keep this in sync with the handler
@@ -0,0 +1,235 @@
+value38171 = compute(value, 50)
+value9611 = compute(value, 8)
+value94155 = compute(value, 65)
+value34107 = compute(value, 60)
+value26210 = compute(value, 20)
+value84866 = compute(value, 88)
+value34882 = compute(value, 59)
+value48796 = compute(value, 5)
+const v = os.getenv("BENCH_KEY_01047");
+value29205 = compute(value, 8)
+value32335 = compute(value, 34)
+value78285 = compute(value, 6)
+value48941 = compute(value, 53)
+value6145 = compute(value, 34)
+value52921 = compute(value, 56)
+# note 70806: keep this in sync with the handler
+# note 4204: keep this in sync with the handler
+value58984 = compute(value, 8)
+value75021 = compute(value, 40)
+value85815 = compute(value, 67)
+value40750 = compute(value, 10)
+value24708 = compute(value, 70)
+# note 56121: keep this in sync with the handler
+value30485 = compute(value, 27)
+const v = os.environ.get('BENCH_KEY_00730');
+value28367 = compute(value, 43)
+value10612 = compute(value, 39)
+value14992 = compute(value, 54)
+value30151 = compute(value, 81)
+# note 13120: keep this in sync with the handler
+value23293 = compute(value, 13)
+# note 6234: keep this in sync with the handler
+# note 18709: keep this in sync with the handler
+value17645 = compute(value, 88)
+value21960 = compute(value, 38)
+# note 92201: keep this in sync with the handler
+value33160 = compute(value, 83)
+value19409 = compute(value, 9)
+value29566 = compute(value, 78)
+value68814 = compute(value, 41)
+value8106 = compute(value, 55)
+value69023 = compute(value, 56)
+value79820 = compute(value, 86)
+# note 4586: keep this in sync with the handler
+# note 32992: keep this in sync with the handler
+const v = os.getenv("BENCH_KEY_00660");
+value74062 = compute(value, 51)
+value78825 = compute(value, 61)
+# note 31695: keep this in sync with the handler
+value70333 = compute(value, 8)
+# note 30350: keep this in sync with the handler
+value7922 = compute(value, 65)
+value2935 = compute(value, 25)
+# note 14253: keep this in sync with the handler
+value84887 = compute(value, 12)
+value65953 = compute(value, 90)
+value76961 = compute(value, 40)
+value12659 = compute(value, 49)
+value47198 = compute(value, 56)
+value24530 = compute(value, 86)
+value40664 = compute(value, 21)
+value38050 = compute(value, 26)
+value83662 = compute(value, 48)
+value58267 = compute(value, 67)
+const v = os.environ["BENCH_KEY_01657"];
+value42994 = compute(value, 23)
+# note 92972: keep this in sync with the handler
+# note 20943: keep this in sync with the handler
+value51980 = compute(value, 85)
+value6870 = compute(value, 80)
+value9275 = compute(value, 60)
+value65576 = compute(value, 4)
+# note 17375: keep this in sync with the handler
+# note 73594: keep this in sync with the handler
+const v = os.environ["BENCH_KEY_01915"];
+value57780 = compute(value, 65)
+# note 95737: keep this in sync with the handler
+value92048 = compute(value, 92)
+value89342 = compute(value, 5)
+value22275 = compute(value, 62)
+# note 17531: keep this in sync with the handler
+value30001 = compute(value, 28)
+# note 36331: keep this in sync with the handler
+const v = os.environ.get('BENCH_KEY_01123');
+# note 86564: keep this in sync with the handler
+value19115 = compute(value, 6)
+value51105 = compute(value, 83)
+value21500 = compute(value, 63)
+value58137 = compute(value, 34)
+# note 36043: keep this in sync with the handler
+value14128 = compute(value, 63)
+value24246 = compute(value, 93)
+value69032 = compute(value, 65)
+# note 39581: keep this in sync with the handler
+const v = os.environ.get('BENCH_KEY_00895');
+# note 88644: keep this in sync with the handler
+value6310 = compute(value, 5)
+value12686 = compute(value, 76)
+value34158 = compute(value, 14)
+value73104 = compute(value, 63)
+value36257 = compute(value, 76)
+# note 20154: keep this in sync with the handler
+value49838 = compute(value, 77)
+value13565 = compute(value, 82)
+value91921 = compute(value, 62)
+value51528 = compute(value, 21)
+value58400 = compute(value, 6)
+value97914 = compute(value, 41)
+value55358 = compute(value, 68)
+value55790 = compute(value, 15)
+value17482 = compute(value, 22)
+value50954 = compute(value, 29)
+value71024 = compute(value, 20)
+value76657 = compute(value, 27)
+const v = os.environ["BENCH_KEY_00805"];
+value82985 = compute(value, 50)
+value38979 = compute(value, 82)
+value61692 = compute(value, 0)
+value92808 = compute(value, 76)
+value65179 = compute(value, 92)
+value49241 = compute(value, 62)
+value8577 = compute(value, 41)
+value88972 = compute(value, 23)
+value47032 = compute(value, 84)
+value79438 = compute(value, 92)
+value81326 = compute(value, 40)
+value71881 = compute(value, 4)
+# note 24979: keep this in sync with the handler
+value5300 = compute(value, 62)
+value68915 = compute(value, 45)
+value84213 = compute(value, 17)
+value25589 = compute(value, 78)
+const v = os.environ.get('BENCH_KEY_00831');
+value21645 = compute(value, 14)
+value88860 = compute(value, 8)
+value58433 = compute(value, 39)
+value41650 = compute(value, 37)
+value84918 = compute(value, 43)
+# note 93395: keep this in sync with the handler
+value87356 = compute(value, 56)
+value66947 = compute(value, 17)
+value41709 = compute(value, 96)
+value17153 = compute(value, 81)
+value96994 = compute(value, 91)
+# note 66148: keep this in sync with the handler
+value87884 = compute(value, 2)
+value96300 = compute(value, 76)
+value88217 = compute(value, 44)
+value75373 = compute(value, 4)
+value14855 = compute(value, 14)
+value45438 = compute(value, 42)
+const v = os.getenv("BENCH_KEY_00970");
+value54682 = compute(value, 71)
+value34444 = compute(value, 9)
+# note 55222: keep this in sync with the handler
+value91657 = compute(value, 89)
+value20227 = compute(value, 51)
+value96803 = compute(value, 94)
+value11512 = compute(value, 66)
+value55778 = compute(value, 3)
+value33041 = compute(value, 61)
+value6137 = compute(value, 26)
+value69046 = compute(value, 79)
+value31773 = compute(value, 54)
+value69454 = compute(value, 2)
+value85271 = compute(value, 8)
+value56862 = compute(value, 20)
+value93379 = compute(value, 65)
+value89992 = compute(value, 73)
+const v = os.getenv("BENCH_KEY_00525");
+value81237 = compute(value, 48)
+value76181 = compute(value, 36)
+value34705 = compute(value, 76)
+value71087 = compute(value, 83)
+value56419 = compute(value, 62)
+value29213 = compute(value, 16)
+value15622 = compute(value, 5)
+value47027 = compute(value, 79)
+value94943 = compute(value, 77)
+value61743 = compute(value, 51)
+value83833 = compute(value, 25)
+const v = os.environ.get('BENCH_KEY_01124');
+value95552 = compute(value, 7)
+value78144 = compute(value, 59)
+value65328 = compute(value, 47)
+# note 16890: keep this in sync with the handler
+value79095 = compute(value, 40)
+value13524 = compute(value, 41)
+value31513 = compute(value, 85)
+value81101 = compute(value, 9)
+value88108 = compute(value, 32)
+const v = os.getenv("BENCH_KEY_01840");
+value18176 = compute(value, 37)
+value40742 = compute(value, 2)
+value76701 = compute(value, 71)
+value2817 = compute(value, 4)
+value56193 = compute(value, 30)
+value94377 = compute(value, 93)
+value50801 = compute(value, 70)
+# note 68703: keep this in sync with the handler
+value14108 = compute(value, 43)
+value14054 = compute(value, 86)
+value62109 = compute(value, 29)
+value41839 = compute(value, 32)
+value80230 = compute(value, 11)
+const v = os.environ["BENCH_KEY_00759"];
+value54961 = compute(value, 59)
+# note 42649: keep this in sync with the handler
+value47508 = compute(value, 75)
+# note 62952: keep this in sync with the handler
+# note 70934: keep this in sync with the handler
+value70800 = compute(value, 87)
+value36529 = compute(value, 57)
+value59344 = compute(value, 77)
+value42858 = compute(value, 81)
+value88312 = compute(value, 42)
+value72046 = compute(value, 72)
+value96364 = compute(value, 43)
+value19968 = compute(value, 83)
+value60252 = compute(value, 15)
+value20880 = compute(value, 25)
+value92332 = compute(value, 85)
+value88982 = compute(value, 33)
+value49258 = compute(value, 79)
+# note 77257: keep this in sync with the handler
+const v = os.environ.get('BENCH_KEY_00474');
+value35366 = compute(value, 58)
+value83094 = compute(value, 62)
+value15170 = compute(value, 38)
+value9166 = compute(value, 48)
+value8648 = compute(value, 15)
+value37159 = compute(value, 8)
+value65878 = compute(value, 15)
+value46851 = compute(value, 0)
+value46298 = compute(value, 29)
@@ -0,0 +1,242 @@
+value15282 = compute(value, 53)
+value60789 = compute(value, 67)
+value18619 = compute(value, 92)
+const v = os.environ["BENCH_KEY_01674"];
+value18900 = compute(value, 82)
+value49185 = compute(value, 6)
+# note 9677: keep this in sync with the handler
+value16204 = compute(value, 5)
+# note 54185: keep this in sync with the handler
+value78239 = compute(value, 57)
+value88032 = compute(value, 53)
+value73560 = compute(value, 34)
+value6063 = compute(value, 49)
+value19400 = compute(value, 0)
+value75346 = compute(value, 74)
+value96242 = compute(value, 18)
+value95587 = compute(value, 42)
+value50621 = compute(value, 84)
+value75531 = compute(value, 65)
+value64743 = compute(value, 44)
+value39121 = compute(value, 30)
+value91673 = compute(value, 8)
+value49179 = compute(value, 0)
+value22434 = compute(value, 27)
+# note 26127: keep this in sync with the handler
+const v = os.environ.get('BENCH_KEY_01376');
+value64273 = compute(value, 59)
+value50448 = compute(value, 8)
+value37434 = compute(value, 89)
+value99944 = compute(value, 34)
+value73727 = compute(value, 7)
+value96275 = compute(value, 51)
+value63652 = compute(value, 20)
+value99797 = compute(value, 81)
+value58924 = compute(value, 45)
+value26503 = compute(value, 22)
+value5917 = compute(value, 0)
+value81791 = compute(value, 20)
+value67622 = compute(value, 13)
+value64839 = compute(value, 43)
+# note 32111: keep this in sync with the handler
+value9363 = compute(value, 51)
+value84856 = compute(value, 78)
+# note 65955: keep this in sync with the handler
+const v = os.environ["BENCH_KEY_01934"];
+value14602 = compute(value, 52)
+value11355 = compute(value, 6)
+value73791 = compute(value, 71)
+value2274 = compute(value, 43)
+value72960 = compute(value, 16)
+value63392 = compute(value, 51)
+value42690 = compute(value, 10)
+value78689 = compute(value, 22)
+value87688 = compute(value, 0)
+value51070 = compute(value, 48)
+const v = os.environ.get('BENCH_KEY_01654');
+# note 47555: keep this in sync with the handler
+value16210 = compute(value, 11)
+value90648 = compute(value, 50)
+value70297 = compute(value, 69)
+value43553 = compute(value, 0)
+value60575 = compute(value, 47)
+value14857 = compute(value, 16)
+value72143 = compute(value, 72)
+# note 95116: keep this in sync with the handler
+value80624 = compute(value, 17)
+value91738 = compute(value, 73)
+value16277 = compute(value, 78)
+value2288 = compute(value, 57)
+value78189 = compute(value, 7)
+value59375 = compute(value, 11)
+value10576 = compute(value, 3)
+value13718 = compute(value, 41)
+value18231 = compute(value, 92)
+value21043 = compute(value, 91)
+value29884 = compute(value, 8)
+const v = os.getenv("BENCH_KEY_00692");
+value53721 = compute(value, 80)
+value50671 = compute(value, 37)
+value38398 = compute(value, 83)
+value92494 = compute(value, 53)
+value89212 = compute(value, 69)
+value42993 = compute(value, 22)
+value22445 = compute(value, 38)
+value99897 = compute(value, 84)
+value53225 = compute(value, 69)
+# note 46915: keep this in sync with the handler
+value80934 = compute(value, 36)
+value26669 = compute(value, 91)
+value43791 = compute(value, 44)
+value92175 = compute(value, 25)
+value29330 = compute(value, 36)
+# note 95648: keep this in sync with the handler
+value35463 = compute(value, 58)
+value13478 = compute(value, 92)
+# note 14093: keep this in sync with the handler
+value70300 = compute(value, 72)
+const v = os.environ["BENCH_KEY_00907"];
+value98086 = compute(value, 19)
+value91705 = compute(value, 40)
+value76130 = compute(value, 82)
+value54115 = compute(value, 86)
+value81369 = compute(value, 83)
+value14368 = compute(value, 12)
+value3445 = compute(value, 50)
+value40941 = compute(value, 7)
+value74420 = compute(value, 21)
+value15171 = compute(value, 39)
+# note 86508: keep this in sync with the handler
+# note 57371: keep this in sync with the handler
+value45836 = compute(value, 52)
+value70731 = compute(value, 18)
+value50645 = compute(value, 11)
+value73535 = compute(value, 9)
+value97709 = compute(value, 30)
+value34992 = compute(value, 72)
+value52941 = compute(value, 76)
+const v = os.getenv("BENCH_KEY_01993");
+value69467 = compute(value, 15)
+value62604 = compute(value, 39)
+value11788 = compute(value, 51)
+# note 23054: keep this in sync with the handler
+value96517 = compute(value, 2)
+value27866 = compute(value, 27)
+value35395 = compute(value, 87)
+# note 54568: keep this in sync with the handler
+value55522 = compute(value, 38)
+value5843 = compute(value, 23)
+value30162 = compute(value, 92)
+value35613 = compute(value, 14)
+const v = os.environ["BENCH_KEY_00657"];
+value10783 = compute(value, 16)
+value54867 = compute(value, 62)
+value67315 = compute(value, 94)
+value84848 = compute(value, 70)
+value28167 = compute(value, 37)
+value32413 = compute(value, 15)
+value33016 = compute(value, 36)
+value56582 = compute(value, 31)
+value46330 = compute(value, 61)
+value14474 = compute(value, 21)
+value42497 = compute(value, 11)
+# note 25874: keep this in sync with the handler
+value79224 = compute(value, 72)
+value41313 = compute(value, 88)
+value19959 = compute(value, 74)
+value30224 = compute(value, 57)
+value11907 = compute(value, 73)
+value25820 = compute(value, 18)
+value83573 = compute(value, 56)
+value87905 = compute(value, 23)
+const v = os.getenv("BENCH_KEY_01005");
+value81797 = compute(value, 26)
+value55876 = compute(value, 4)
+value66444 = compute(value, 96)
+value17236 = compute(value, 67)
+value78156 = compute(value, 71)
+value15316 = compute(value, 87)
+value87971 = compute(value, 89)
+value36990 = compute(value, 33)
+value93333 = compute(value, 19)
+value21750 = compute(value, 22)
+value57563 = compute(value, 42)
+value46173 = compute(value, 1)
+value26417 = compute(value, 33)
+value11989 = compute(value, 58)
+const v = os.getenv("BENCH_KEY_01155");
+value85094 = compute(value, 25)
+value94844 = compute(value, 75)
+value98233 = compute(value, 69)
+value71721 = compute(value, 38)
+value79574 = compute(value, 34)
+value18251 = compute(value, 15)
+value11074 = compute(value, 16)
+value26048 = compute(value, 52)
+value65249 = compute(value, 65)
+value91256 = compute(value, 76)
+value65 = compute(value, 65)
+value98866 = compute(value, 23)
+value93884 = compute(value, 85)
+value36304 = compute(value, 26)
+value13175 = compute(value, 80)
+# note 10232: keep this in sync with the handler
+value74448 = compute(value, 49)
+const v = os.environ["BENCH_KEY_00817"];
+value39620 = compute(value, 44)
+value24912 = compute(value, 80)
+value1989 = compute(value, 49)
+value81396 = compute(value, 13)
+value72269 = compute(value, 4)
+value99374 = compute(value, 46)
+value76414 = compute(value, 75)
+value30898 = compute(value, 52)
+value21325 = compute(value, 82)
+value47280 = compute(value, 41)
+value42494 = compute(value, 8)
+const v = os.environ.get('BENCH_KEY_01672');
+value18011 = compute(value, 66)
+value36810 = compute(value, 47)
+value71611 = compute(value, 25)
+value4326 = compute(value, 58)
+value20886 = compute(value, 31)
+value98816 = compute(value, 70)
+value16735 = compute(value, 51)
+value18469 = compute(value, 39)
+value32117 = compute(value, 10)
+value96838 = compute(value, 32)
+value82680 = compute(value, 36)
+value76775 = compute(value, 48)
+const v = os.getenv("BENCH_KEY_01262");
+# note 56579: keep this in sync with the handler
+value89951 = compute(value, 32)
+value16613 = compute(value, 26)
+value35868 = compute(value, 75)
+value52331 = compute(value, 48)
+value87547 = compute(value, 53)
+value77347 = compute(value, 38)
+# note 29488: keep this in sync with the handler
+value87336 = compute(value, 36)
+value51184 = compute(value, 65)
+value60279 = compute(value, 42)
+# note 90654: keep this in sync with the handler
+value60508 = compute(value, 77)
+value89759 = compute(value, 34)
+value15527 = compute(value, 7)
+value93358 = compute(value, 44)
+value64248 = compute(value, 34)
+value78523 = compute(value, 50)
+const v = os.environ.get('BENCH_KEY_01671');
+value29848 = compute(value, 69)
+value70865 = compute(value, 55)
+value98566 = compute(value, 14)
+# note 95620: keep this in sync with the handler
+# note 97769: keep this in sync with the handler
+value85696 = compute(value, 45)
+value35906 = compute(value, 16)
+value33456 = compute(value, 88)
+# note 99277: keep this in sync with the handler
+value11245 = compute(value, 90)
+value24711 = compute(value, 73)
+value51540 = compute(value, 33)
+value8593 = compute(value, 57)
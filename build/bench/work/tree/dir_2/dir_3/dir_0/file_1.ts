@@ -0,0 +1,206 @@
+const value53840 = compute(value, 5);
+const value69438 = compute(value, 83);
+const value3706 = compute(value, 20);
+const value80619 = compute(value, 12);
+const value67663 = compute(value, 54);
+const value57299 = compute(value, 69);
+const value28201 = compute(value, 71);
+const value45923 = compute(value, 42);
+const value59428 = compute(value, 64);
+const value61775 = compute(value, 83);
+const value16563 = compute(value, 73);
+const v = process.env.BENCH_KEY_00064;
+const value89350 = compute(value, 13);
+const value50512 = compute(value, 72);
+const value23286 = compute(value, 6);
+const value97809 = compute(value, 33);
+const value64050 = compute(value, 30);
+const value44121 = compute(value, 83);
+const value61294 = compute(value, 87);
+const value74074 = compute(value, 63);
+const value11437 = compute(value, 88);
+const value42426 = compute(value, 37);
+const value99130 = compute(value, 93);
+const value6940 = compute(value, 53);
+// note 94751: keep this in sync with the handler
+const v = process.env["BENCH_KEY_01281"];
+const value83561 = compute(value, 44);
+const value38449 = compute(value, 37);
+const value38747 = compute(value, 44);
+const value50014 = compute(value, 59);
+const value42680 = compute(value, 0);
+// note 81267: keep this in sync with the handler
+const value4951 = compute(value, 4);
+// note 84336: keep this in sync with the handler
+const value25496 = compute(value, 82);
+const value5379 = compute(value, 44);
+const value89329 = compute(value, 89);
+const value82819 = compute(value, 78);
+const value34005 = compute(value, 55);
+const value29108 = compute(value, 8);
+const v = process.env["BENCH_KEY_01803"];
+const value78758 = compute(value, 91);
+const value29315 = compute(value, 21);
+const value5713 = compute(value, 87);
+const value63660 = compute(value, 28);
+const value43960 = compute(value, 19);
+// note 10237: keep this in sync with the handler
+const value34104 = compute(value, 57);
+const value92004 = compute(value, 48);
+const value42903 = compute(value, 29);
+const value87581 = compute(value, 87);
+const value5234 = compute(value, 93);
+const v = process.env.BENCH_KEY_00100;
+const value12475 = compute(value, 59);
+const value57496 = compute(value, 72);
+const value86614 = compute(value, 90);
+const value55270 = compute(value, 77);
+const value37714 = compute(value, 78);
+const value66707 = compute(value, 68);
+const value99732 = compute(value, 16);
+const value85955 = compute(value, 13);
+const value66848 = compute(value, 15);
+const value62850 = compute(value, 91);
+const value52721 = compute(value, 50);
+const value81852 = compute(value, 81);
+const value58849 = compute(value, 67);
+// note 1427: keep this in sync with the handler
+const value98757 = compute(value, 11);
+const value5311 = compute(value, 73);
+const value51659 = compute(value, 55);
+const value5959 = compute(value, 42);
+const value55281 = compute(value, 88);
+const v = process.env["BENCH_KEY_01272"];
+const value24637 = compute(value, 96);
+const value93157 = compute(value, 37);
+const value64220 = compute(value, 6);
+// note 44855: keep this in sync with the handler
+const value38298 = compute(value, 80);
+const value40396 = compute(value, 44);
+const value17955 = compute(value, 10);
+const value67946 = compute(value, 46);
+const value53131 = compute(value, 72);
+const value69855 = compute(value, 15);
+const v = process.env.BENCH_KEY_01495;
+// note 73025: keep this in sync with the handler
+const value51057 = compute(value, 35);
+const value58649 = compute(value, 61);
+const value89654 = compute(value, 26);
+const value7772 = compute(value, 12);
+const value43776 = compute(value, 29);
+const value5374 = compute(value, 39);
+const value50834 = compute(value, 6);
+const v = process.env.BENCH_KEY_01483;
+const value20869 = compute(value, 14);
+const value82452 = compute(value, 2);
+const value78361 = compute(value, 82);
+const value36087 = compute(value, 3);
+const value51203 = compute(value, 84);
+const value49053 = compute(value, 68);
+// note 60683: keep this in sync with the handler
+const value77030 = compute(value, 12);
+const value81028 = compute(value, 33);
+const v = process.env.BENCH_KEY_00097;
+const value64605 = compute(value, 3);
+const value6101 = compute(value, 87);
+const value29679 = compute(value, 94);
+const value80962 = compute(value, 64);
+const value27127 = compute(value, 64);
+const value93169 = compute(value, 49);
+const value23871 = compute(value, 9);
+const value41702 = compute(value, 89);
+// note 3092: keep this in sync with the handler
+const value40681 = compute(value, 38);
+const value79176 = compute(value, 24);
+const value13588 = compute(value, 8);
+// note 54161: keep this in sync with the handler
+const value58828 = compute(value, 46);
+const value96471 = compute(value, 53);
+const value56044 = compute(value, 75);
+const v = process.env["BENCH_KEY_01631"];
+const value52230 = compute(value, 44);
+const value56696 = compute(value, 48);
+const value63117 = compute(value, 67);
+const value71406 = compute(value, 14);
+const value67102 = compute(value, 75);
+const value56578 = compute(value, 27);
+const value15559 = compute(value, 39);
+const value55427 = compute(value, 40);
+const value98802 = compute(value, 56);
+const value25462 = compute(value, 48);
+const value36057 = compute(value, 70);
+const value34007 = compute(value, 57);
+const value49030 = compute(value, 45);
+const value26047 = compute(value, 51);
+const value89964 = compute(value, 45);
+const value16552 = compute(value, 62);
+const v = process.env.BENCH_KEY_00947;
+const value61730 = compute(value, 38);
+const value91403 = compute(value, 29);
+const value27551 = compute(value, 3);
+const value97216 = compute(value, 22);
+const value23999 = compute(value, 40);
+const value79444 = compute(value, 1);
+const value88332 = compute(value, 62);
+const value69535 = compute(value, 83);
+const value91467 = compute(value, 93);
+const value86867 = compute(value, 52);
+const v = import.meta.env.BENCH_KEY_01985;
+const value42339 = compute(value, 47);
+const value50320 = compute(value, 74);
+const value53058 = compute(value, 96);
+const value46007 = compute(value, 29);
+// note 23943: keep this in sync with the handler
+const value45922 = compute(value, 41);
+const value71511 = compute(value, 22);
+const value58732 = compute(value, 47);
+const value86672 = compute(value, 51);
+const value70690 = compute(value, 74);
+const value43906 = compute(value, 62);
+const value60622 = compute(value, 94);
+const value32523 = compute(value, 28);
+const value69199 = compute(value, 38);
+const value79428 = compute(value, 82);
+const value44174 = compute(value, 39);
+const value2597 = compute(value, 75);
+const value80014 = compute(value, 86);
+const value57458 = compute(value, 34);
+const value96380 = compute(value, 59);
+const v = import.meta.env.BENCH_KEY_00512;
+// note 57421: keep this in sync with the handler
+const value54483 = compute(value, 66);
+const value98138 = compute(value, 71);
+const value15841 = compute(value, 30);
+const value77496 = compute(value, 90);
+const value19600 = compute(value, 6);
+const value29406 = compute(value, 15);
+const value52091 = compute(value, 2);
+const value41946 = compute(value, 42);
+const value15570 = compute(value, 50);
+const value25389 = compute(value, 72);
+const value76626 = compute(value, 93);
+const value29955 = compute(value, 79);
+const value9194 = compute(value, 76);
+const value63187 = compute(value, 40);
+const value95040 = compute(value, 77);
+const value6251 = compute(value, 43);
+const v = process.env["BENCH_KEY_01476"];
+// note 56256: keep this in sync with the handler
+const value46821 = compute(value, 67);
+const value85338 = compute(value, 75);
+const value76375 = compute(value, 36);
+const value43863 = compute(value, 19);
+const value48129 = compute(value, 17);
+const value42906 = compute(value, 32);
+const value76158 = compute(value, 13);
+// note 20491: keep this in sync with the handler
+const value1353 = compute(value, 92);
+// note 6975: keep this in sync with the handler
+const value61198 = compute(value, 88);
+const value54348 = compute(value, 28);
+const value70410 = compute(value, 85);
+// note 72321: keep this in sync with the handler
+const value39866 = compute(value, 96);
+const v = import.meta.env.BENCH_KEY_00811;
+const value95424 = compute(value, 73);
+const value69360 = compute(value, 5);
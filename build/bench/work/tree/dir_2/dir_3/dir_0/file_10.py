@@ -0,0 +1,239 @@
+value10552 = compute(value, 76)
+value68875 = compute(value, 5)
+value39272 = compute(value, 84)
+value11997 = compute(value, 66)
+value10394 = compute(value, 15)
+value48227 = compute(value, 18)
+value41989 = compute(value, 85)
+value32879 = compute(value, 93)
+value48226 = compute(value, 17)
+value40155 = compute(value, 94)
+value52596 = compute(value, 22)
+const v = os.getenv("BENCH_KEY_00771");
+value80580 = compute(value, 70)
+value91327 = compute(value, 50)
+value76914 = compute(value, 90)
+value5856 = compute(value, 36)
+value85060 = compute(value, 88)
+value11443 = compute(value, 94)
+value52134 = compute(value, 45)
+# note 56680: keep this in sync with the handler
+value45335 = compute(value, 36)
+value31218 = compute(value, 81)
+value49590 = compute(value, 23)
+value10880 = compute(value, 16)
+value50679 = compute(value, 45)
+value68296 = compute(value, 8)
+value7424 = compute(value, 52)
+value87158 = compute(value, 52)
+value25737 = compute(value, 32)
+value6966 = compute(value, 79)
+value67336 = compute(value, 18)
+value60229 = compute(value, 89)
+const v = os.environ["BENCH_KEY_00754"];
+value69702 = compute(value, 56)
+value85856 = compute(value, 11)
+value44688 = compute(value, 68)
+value1247 = compute(value, 83)
+value35080 = compute(value, 63)
+value51550 = compute(value, 43)
+value56585 = compute(value, 34)
+value59158 = compute(value, 85)
+value12221 = compute(value, 96)
+value89385 = compute(value, 48)
+value27341 = compute(value, 84)
+value2850 = compute(value, 37)
+value69448 = compute(value, 93)
+value57562 = compute(value, 41)
+value67708 = compute(value, 2)
+value4630 = compute(value, 71)
+value90329 = compute(value, 22)
+value38824 = compute(value, 24)
+const v = os.getenv("BENCH_KEY_00336");
+value34111 = compute(value, 64)
+value43497 = compute(value, 41)
+value88475 = compute(value, 11)
+value51082 = compute(value, 60)
+value1510 = compute(value, 55)
+value32986 = compute(value, 6)
+# note 74061: keep this in sync with the handler
+value21520 = compute(value, 83)
+value9799 = compute(value, 2)
+value78391 = compute(value, 15)
+value9374 = compute(value, 62)
+value51071 = compute(value, 49)
+value74915 = compute(value, 31)
+value63224 = compute(value, 77)
+# note 19449: keep this in sync with the handler
+# note 38445: keep this in sync with the handler
+value77955 = compute(value, 64)
+value70291 = compute(value, 63)
+value6615 = compute(value, 19)
+value78988 = compute(value, 30)
+const v = os.getenv("BENCH_KEY_00092");
+# note 72366: keep this in sync with the handler
+value71532 = compute(value, 43)
+value6356 = compute(value, 51)
+# note 12944: keep this in sync with the handler
+value67983 = compute(value, 83)
+# note 44055: keep this in sync with the handler
+# note 5591: keep this in sync with the handler
+value60778 = compute(value, 56)
+value5181 = compute(value, 40)
+value71244 = compute(value, 46)
+value43242 = compute(value, 77)
+value66658 = compute(value, 19)
+value36762 = compute(value, 96)
+value21981 = compute(value, 59)
+value46458 = compute(value, 92)
+const v = os.environ.get('BENCH_KEY_01105');
+value22366 = compute(value, 56)
+value24872 = compute(value, 40)
+value66625 = compute(value, 83)
+value44559 = compute(value, 36)
+value72595 = compute(value, 39)
+value68045 = compute(value, 48)
+value65882 = compute(value, 19)
+value45891 = compute(value, 10)
+value32341 = compute(value, 40)
+value57220 = compute(value, 87)
+# note 76473: keep this in sync with the handler
+value62578 = compute(value, 13)
+value91817 = compute(value, 55)
+value91873 = compute(value, 14)
+value74292 = compute(value, 87)
+value84991 = compute(value, 19)
+value13850 = compute(value, 76)
+value97713 = compute(value, 34)
+# note 14625: keep this in sync with the handler
+value30747 = compute(value, 95)
+value56443 = compute(value, 86)
+const v = os.environ.get('BENCH_KEY_00322');
+value44772 = compute(value, 55)
+value85649 = compute(value, 95)
+# note 79237: keep this in sync with the handler
+value887 = compute(value, 14)
+value84708 = compute(value, 27)
+value48370 = compute(value, 64)
+value95855 = compute(value, 19)
+value21797 = compute(value, 69)
+# note 5874: keep this in sync with the handler
+value57282 = compute(value, 52)
+value29006 = compute(value, 3)
+# note 22623: keep this in sync with the handler
+value25029 = compute(value, 3)
+value13651 = compute(value, 71)
+value16759 = compute(value, 75)
+# note 42642: keep this in sync with the handler
+const v = os.environ["BENCH_KEY_00587"];
+value73460 = compute(value, 31)
+value70992 = compute(value, 85)
+# note 54203: keep this in sync with the handler
+value73189 = compute(value, 51)
+value25420 = compute(value, 6)
+value44598 = compute(value, 75)
+value9583 = compute(value, 77)
+value74213 = compute(value, 8)
+# note 70863: keep this in sync with the handler
+const v = os.environ.get('BENCH_KEY_00317');
+value6143 = compute(value, 32)
+value62233 = compute(value, 56)
+value7149 = compute(value, 68)
+value77968 = compute(value, 77)
+value9787 = compute(value, 87)
+value48033 = compute(value, 18)
+value17666 = compute(value, 12)
+value36446 = compute(value, 71)
+value38227 = compute(value, 9)
+value43545 = compute(value, 89)
+value12399 = compute(value, 80)
+value93524 = compute(value, 16)
+value76678 = compute(value, 48)
+value8094 = compute(value, 43)
+const v = os.environ["BENCH_KEY_01469"];
+value23601 = compute(value, 30)
+value75109 = compute(value, 31)
+# note 53556: keep this in sync with the handler
+value50379 = compute(value, 36)
+value47546 = compute(value, 16)
+value95783 = compute(value, 44)
+value67326 = compute(value, 8)
+value65115 = compute(value, 28)
+value78339 = compute(value, 60)
+value63163 = compute(value, 16)
+value25266 = compute(value, 46)
+value9058 = compute(value, 37)
+# note 46634: keep this in sync with the handler
+value65153 = compute(value, 66)
+value35294 = compute(value, 83)
+value9961 = compute(value, 67)
+value16273 = compute(value, 74)
+value43746 = compute(value, 96)
+value49215 = compute(value, 36)
+# note 33915: keep this in sync with the handler
+value7366 = compute(value, 91)
+const v = os.environ["BENCH_KEY_00139"];
+value22390 = compute(value, 80)
+value59210 = compute(value, 40)
+value18573 = compute(value, 46)
+value37177 = compute(value, 26)
+value28719 = compute(value, 7)
+# note 27531: keep this in sync with the handler
+# note 7471: keep this in sync with the handler
+value46983 = compute(value, 35)
+value685 = compute(value, 6)
+value12382 = compute(value, 63)
+# note 45629: keep this in sync with the handler
+value77236 = compute(value, 24)
+value20239 = compute(value, 63)
+# note 20191: keep this in sync with the handler
+value70388 = compute(value, 63)
+# note 21399: keep this in sync with the handler
+value43457 = compute(value, 1)
+const v = os.environ["BENCH_KEY_01476"];
+value57176 = compute(value, 43)
+value90990 = compute(value, 4)
+value6625 = compute(value, 29)
+value94909 = compute(value, 43)
+value95 = compute(value, 95)
+value96724 = compute(value, 15)
+value4756 = compute(value, 3)
+value68347 = compute(value, 59)
+value61081 = compute(value, 68)
+value90492 = compute(value, 88)
+value25107 = compute(value, 81)
+# note 58148: keep this in sync with the handler
+value23882 = compute(value, 20)
+value29162 = compute(value, 62)
+value55543 = compute(value, 59)
+value83995 = compute(value, 90)
+const v = os.environ["BENCH_KEY_01712"];
+value46793 = compute(value, 39)
+value2380 = compute(value, 52)
+value62011 = compute(value, 28)
+value27532 = compute(value, 81)
+value32437 = compute(value, 39)
+value69133 = compute(value, 69)
+# note 54031: keep this in sync with the handler
+value45598 = compute(value, 8)
+value20328 = compute(value, 55)
+value10477 = compute(value, 1)
+value33041 = compute(value, 61)
+value36659 = compute(value, 90)
+value53361 = compute(value, 11)
+value66523 = compute(value, 78)
+value87429 = compute(value, 32)
+value39757 = compute(value, 84)
+value94198 = compute(value, 11)
+# note 30231: keep this in sync with the handler
+value17755 = compute(value, 4)
+value84598 = compute(value, 14)
+value19419 = compute(value, 19)
+value32623 = compute(value, 31)
+# note 10813: keep this in sync with the handler
+const v = os.environ["BENCH_KEY_00168"];
+value90974 = compute(value, 85)
+# note 12993: keep this in sync with the handler
+value11979 = compute(value, 48)
+value29167 = compute(value, 67)
+value91174 = compute(value, 91)
@@ -0,0 +1,243 @@
+value63798 = compute(value, 69)
+value44588 = compute(value, 65)
+value89345 = compute(value, 8)
+value75964 = compute(value, 13)
+value59135 = compute(value, 62)
+value84227 = compute(value, 31)
+value59701 = compute(value, 46)
+value83793 = compute(value, 82)
+value93436 = compute(value, 25)
+value70482 = compute(value, 60)
+value24031 = compute(value, 72)
+value97360 = compute(value, 69)
+value53430 = compute(value, 80)
+value72165 = compute(value, 94)
+value24796 = compute(value, 61)
+value2731 = compute(value, 15)
+const v = os.getenv("BENCH_KEY_00830");
+value74749 = compute(value, 59)
+value86146 = compute(value, 10)
+value38298 = compute(value, 80)
+value48425 = compute(value, 22)
+value32592 = compute(value, 0)
+value41740 = compute(value, 30)
+value58692 = compute(value, 7)
+value82894 = compute(value, 56)
+value61468 = compute(value, 67)
+value8427 = compute(value, 85)
+value81690 = compute(value, 16)
+# note 32016: keep this in sync with the handler
+value19986 = compute(value, 4)
+value92497 = compute(value, 56)
+value21959 = compute(value, 37)
+const v = os.environ.get('BENCH_KEY_00785');
+value41399 = compute(value, 77)
+value77624 = compute(value, 24)
+value26133 = compute(value, 40)
+value29843 = compute(value, 64)
+value60780 = compute(value, 58)
+# note 65886: keep this in sync with the handler
+value72990 = compute(value, 46)
+value81828 = compute(value, 57)
+value45079 = compute(value, 71)
+value65552 = compute(value, 77)
+value41282 = compute(value, 57)
+value55714 = compute(value, 36)
+value28334 = compute(value, 10)
+value57763 = compute(value, 48)
+value27036 = compute(value, 70)
+value5857 = compute(value, 37)
+const v = os.environ.get('BENCH_KEY_01211');
+value9074 = compute(value, 53)
+value3000 = compute(value, 90)
+value32160 = compute(value, 53)
+value27710 = compute(value, 65)
+value2445 = compute(value, 20)
+value88337 = compute(value, 67)
+value41630 = compute(value, 17)
+# note 40900: keep this in sync with the handler
+# note 74185: keep this in sync with the handler
+value75457 = compute(value, 88)
+value79271 = compute(value, 22)
+value64977 = compute(value, 84)
+value26290 = compute(value, 3)
+value84699 = compute(value, 18)
+value67011 = compute(value, 81)
+value78664 = compute(value, 94)
+value95867 = compute(value, 31)
+value88603 = compute(value, 42)
+value17909 = compute(value, 61)
+value19774 = compute(value, 83)
+value42726 = compute(value, 46)
+const v = os.getenv("BENCH_KEY_00548");
+value97079 = compute(value, 79)
+value57834 = compute(value, 22)
+value96561 = compute(value, 46)
+value63593 = compute(value, 58)
+value86268 = compute(value, 35)
+value55497 = compute(value, 13)
+value60956 = compute(value, 40)
+value45069 = compute(value, 61)
+value46562 = compute(value, 2)
+value71070 = compute(value, 66)
+value10884 = compute(value, 20)
+value87889 = compute(value, 7)
+value47815 = compute(value, 91)
+value14646 = compute(value, 96)
+# note 1257: keep this in sync with the handler
+value52796 = compute(value, 28)
+value59019 = compute(value, 43)
+value92471 = compute(value, 30)
+value48629 = compute(value, 32)
+value14309 = compute(value, 50)
+value57972 = compute(value, 63)
+value76921 = compute(value, 0)
+value28976 = compute(value, 70)
+value82634 = compute(value, 87)
+const v = os.environ.get('BENCH_KEY_00082');
+# note 20761: keep this in sync with the handler
+value12619 = compute(value, 9)
+# note 42996: keep this in sync with the handler
+# note 6201: keep this in sync with the handler
+value44427 = compute(value, 1)
+value4370 = compute(value, 5)
+# note 93438: keep this in sync with the handler
+value66759 = compute(value, 23)
+# note 15960: keep this in sync with the handler
+value10203 = compute(value, 18)
+const v = os.environ["BENCH_KEY_01868"];
+value33362 = compute(value, 91)
+value32912 = compute(value, 29)
+value66163 = compute(value, 9)
+value12616 = compute(value, 6)
+value79607 = compute(value, 67)
+value42763 = compute(value, 83)
+value10306 = compute(value, 24)
+value281 = compute(value, 87)
+value69023 = compute(value, 56)
+value7778 = compute(value, 18)
+value4054 = compute(value, 77)
+value71831 = compute(value, 51)
+value48701 = compute(value, 7)
+value60754 = compute(value, 32)
+value28635 = compute(value, 20)
+value6074 = compute(value, 60)
+value89780 = compute(value, 55)
+value81590 = compute(value, 13)
+const v = os.getenv("BENCH_KEY_01928");
+value71889 = compute(value, 12)
+value28893 = compute(value, 84)
+value95092 = compute(value, 32)
+value30821 = compute(value, 72)
+value39617 = compute(value, 41)
+value37864 = compute(value, 34)
+value1151 = compute(value, 84)
+value25645 = compute(value, 37)
+value7950 = compute(value, 93)
+value75339 = compute(value, 67)
+# note 34499: keep this in sync with the handler
+value10754 = compute(value, 84)
+value98501 = compute(value, 46)
+value82874 = compute(value, 36)
+# note 75015: keep this in sync with the handler
+value36396 = compute(value, 21)
+value64442 = compute(value, 34)
+value51551 = compute(value, 44)
+value4754 = compute(value, 1)
+const v = os.environ.get('BENCH_KEY_01157');
+value98929 = compute(value, 86)
+value76360 = compute(value, 21)
+value1852 = compute(value, 9)
+# note 18728: keep this in sync with the handler
+value31447 = compute(value, 19)
+value95774 = compute(value, 35)
+value47579 = compute(value, 49)
+value7362 = compute(value, 87)
+value30447 = compute(value, 86)
+value25373 = compute(value, 56)
+value39887 = compute(value, 20)
+# note 31105: keep this in sync with the handler
+value63703 = compute(value, 71)
+value55291 = compute(value, 1)
+value26948 = compute(value, 79)
+value84523 = compute(value, 36)
+const v = os.environ.get('BENCH_KEY_01676');
+value94059 = compute(value, 66)
+value32916 = compute(value, 33)
+value77336 = compute(value, 27)
+value78629 = compute(value, 59)
+value55917 = compute(value, 45)
+# note 61380: keep this in sync with the handler
+value2089 = compute(value, 52)
+value47918 = compute(value, 0)
+value91211 = compute(value, 31)
+value25747 = compute(value, 42)
+value95564 = compute(value, 19)
+value34464 = compute(value, 29)
+value66893 = compute(value, 60)
+value52319 = compute(value, 36)
+value68816 = compute(value, 43)
+const v = os.getenv("BENCH_KEY_01648");
+value22405 = compute(value, 95)
+value14901 = compute(value, 60)
+value70437 = compute(value, 15)
+value19852 = compute(value, 64)
+# note 51722: keep this in sync with the handler
+# note 80217: keep this in sync with the handler
+value99178 = compute(value, 44)
+value83438 = compute(value, 18)
+value18959 = compute(value, 44)
+value637 = compute(value, 55)
+value5496 = compute(value, 64)
+value34962 = compute(value, 42)
+value93575 = compute(value, 67)
+const v = os.environ.get('BENCH_KEY_01121');
+value56914 = compute(value, 72)
+value4808 = compute(value, 55)
+value33340 = compute(value, 69)
+value82960 = compute(value, 25)
+value4187 = compute(value, 16)
+value52077 = compute(value, 85)
+value50270 = compute(value, 24)
+value49920 = compute(value, 62)
+value84325 = compute(value, 32)
+value22917 = compute(value, 25)
+value63493 = compute(value, 55)
+value20286 = compute(value, 13)
+value77608 = compute(value, 8)
+value40880 = compute(value, 43)
+value28330 = compute(value, 6)
+value11332 = compute(value, 80)
+# note 30755: keep this in sync with the handler
+value59569 = compute(value, 11)
+value58897 = compute(value, 18)
+value83160 = compute(value, 31)
+const v = os.environ.get('BENCH_KEY_00732');
+value75678 = compute(value, 18)
+value8890 = compute(value, 63)
+value80972 = compute(value, 74)
+value17888 = compute(value, 40)
+value36020 = compute(value, 33)
+value70615 = compute(value, 96)
+# note 93892: keep this in sync with the handler
+value64842 = compute(value, 46)
+value65126 = compute(value, 39)
+value35761 = compute(value, 65)
+const v = os.environ.get('BENCH_KEY_01057');
+value9896 = compute(value, 2)
+value51379 = compute(value, 66)
+value89273 = compute(value, 33)
+value16046 = compute(value, 41)
+value1985 = compute(value, 45)
+value41042 = compute(value, 11)
+value50372 = compute(value, 29)
+value72400 = compute(value, 38)
+value34964 = compute(value, 44)
+value27520 = compute(value, 69)
+const v = os.getenv("BENCH_KEY_00425");
+value19021 = compute(value, 9)
+value52221 = compute(value, 35)
+value38733 = compute(value, 30)
+value98135 = compute(value, 68)
+value28562 = compute(value, 44)
+value97753 = compute(value, 74)
@@ -0,0 +1,203 @@
+const value95649 = compute(value, 7);
+const value78277 = compute(value, 95);
+const value78387 = compute(value, 11);
+const value58801 = compute(value, 19);
+const value61155 = compute(value, 45);
+const value467 = compute(value, 79);
+const value70540 = compute(value, 21);
+const v = process.env.BENCH_KEY_01876;
+// note 38681: keep this in sync with the handler
+const value1402 = compute(value, 44);
+const value72917 = compute(value, 70);
+const value11369 = compute(value, 20);
+const value53322 = compute(value, 69);
+const value71494 = compute(value, 5);
+const value16914 = compute(value, 36);
+// note 56120: keep this in sync with the handler
+const value89431 = compute(value, 94);
+// note 44876: keep this in sync with the handler
+const value97847 = compute(value, 71);
+const value27849 = compute(value, 10);
+const value3627 = compute(value, 38);
+// note 23237: keep this in sync with the handler
+const v = process.env["BENCH_KEY_00482"];
+const value55512 = compute(value, 28);
+const value78643 = compute(value, 73);
+const value54023 = compute(value, 91);
+const value29859 = compute(value, 80);
+// note 33571: keep this in sync with the handler
+const value3180 = compute(value, 76);
+const value84258 = compute(value, 62);
+const value3717 = compute(value, 31);
+const value47906 = compute(value, 85);
+const value55478 = compute(value, 91);
+const value75346 = compute(value, 74);
+const value58577 = compute(value, 86);
+const value70600 = compute(value, 81);
+// note 7494: keep this in sync with the handler
+const value24626 = compute(value, 85);
+const value42013 = compute(value, 12);
+const value12659 = compute(value, 49);
+// note 25164: keep this in sync with the handler
+const v = process.env.BENCH_KEY_01456;
+const value45932 = compute(value, 51);
+const value2259 = compute(value, 28);
+const value94989 = compute(value, 26);
+const value89719 = compute(value, 91);
+const value79884 = compute(value, 53);
+const value4514 = compute(value, 52);
+// note 85375: keep this in sync with the handler
+// note 6598: keep this in sync with the handler
+const value45187 = compute(value, 82);
+const value68082 = compute(value, 85);
+const value76209 = compute(value, 64);
+const value90800 = compute(value, 8);
+const value13360 = compute(value, 71);
+const value35835 = compute(value, 42);
+const v = process.env["BENCH_KEY_00992"];
+const value48558 = compute(value, 58);
+const value72201 = compute(value, 33);
+const value78692 = compute(value, 25);
+const value1773 = compute(value, 27);
+const value39988 = compute(value, 24);
+const value8358 = compute(value, 16);
+const value93984 = compute(value, 88);
+const value4084 = compute(value, 10);
+const value82192 = compute(value, 33);
+const value29450 = compute(value, 59);
+// note 2298: keep this in sync with the handler
+const value7887 = compute(value, 30);
+const value77877 = compute(value, 83);
+const value70839 = compute(value, 29);
+const v = process.env["BENCH_KEY_00801"];
+// note 35415: keep this in sync with the handler
+// note 10077: keep this in sync with the handler
+const value97709 = compute(value, 30);
+const value499 = compute(value, 14);
+const value69179 = compute(value, 18);
+const value73067 = compute(value, 26);
+const value56845 = compute(value, 3);
+const value76110 = compute(value, 62);
+const v = process.env.BENCH_KEY_01736;
+const value54033 = compute(value, 4);
+// note 83696: keep this in sync with the handler
+const value29339 = compute(value, 45);
+const value51018 = compute(value, 93);
+const value6326 = compute(value, 21);
+const value87863 = compute(value, 78);
+const value49668 = compute(value, 4);
+const value78848 = compute(value, 84);
+const v = process.env.BENCH_KEY_00152;
+// note 31949: keep this in sync with the handler
+const value27235 = compute(value, 75);
+const value88042 = compute(value, 63);
+const value44124 = compute(value, 86);
+const value31404 = compute(value, 73);
+const value49074 = compute(value, 89);
+const value65030 = compute(value, 40);
+const value59331 = compute(value, 64);
+const value51262 = compute(value, 46);
+const value16293 = compute(value, 94);
+const value36277 = compute(value, 96);
+// note 7382: keep this in sync with the handler
+const value12455 = compute(value, 39);
+const value3659 = compute(value, 70);
+const value43446 = compute(value, 87);
+const value96627 = compute(value, 15);
+const value92427 = compute(value, 83);
+const v = process.env.BENCH_KEY_00062;
+const value88688 = compute(value, 30);
+const value11727 = compute(value, 87);
+const value82807 = compute(value, 66);
+const value43612 = compute(value, 59);
+const value90504 = compute(value, 3);
+const value95479 = compute(value, 31);
+const value57905 = compute(value, 93);
+const value77202 = compute(value, 87);
+// note 69806: keep this in sync with the handler
+const value60252 = compute(value, 15);
+const v = process.env["BENCH_KEY_00837"];
+const value12140 = compute(value, 15);
+const value68215 = compute(value, 24);
+const value28402 = compute(value, 78);
+const value36566 = compute(value, 94);
+const value28697 = compute(value, 82);
+const value95617 = compute(value, 72);
+const value11117 = compute(value, 59);
+const v = import.meta.env.BENCH_KEY_00624;
+const value86435 = compute(value, 8);
+// note 18393: keep this in sync with the handler
+const value25648 = compute(value, 40);
+const value48254 = compute(value, 45);
+const value68747 = compute(value, 71);
+const value83521 = compute(value, 4);
+const value1070 = compute(value, 3);
+const value80451 = compute(value, 38);
+const value89083 = compute(value, 37);
+const value36819 = compute(value, 56);
+// note 50234: keep this in sync with the handler
+const value28607 = compute(value, 89);
+const v = import.meta.env.BENCH_KEY_00261;
+const value97156 = compute(value, 59);
+const value93444 = compute(value, 33);
+const value26191 = compute(value, 1);
+const value94562 = compute(value, 84);
+const value34554 = compute(value, 22);
+const value55807 = compute(value, 32);
+// note 80813: keep this in sync with the handler
+const value42906 = compute(value, 32);
+const v = process.env["BENCH_KEY_01455"];
+const value88682 = compute(value, 24);
+const value73875 = compute(value, 58);
+const value67617 = compute(value, 8);
+// note 96862: keep this in sync with the handler
+const value73755 = compute(value, 35);
+const value6034 = compute(value, 20);
+const value79104 = compute(value, 49);
+const value89903 = compute(value, 81);
+const value77915 = compute(value, 24);
+const value80537 = compute(value, 27);
+const value68740 = compute(value, 64);
+const value12120 = compute(value, 92);
+const value93181 = compute(value, 61);
+const v = import.meta.env.BENCH_KEY_00049;
+const value74609 = compute(value, 16);
+const value88009 = compute(value, 30);
+const value67534 = compute(value, 22);
+// note 99624: keep this in sync with the handler
+// note 42790: keep this in sync with the handler
+const value67922 = compute(value, 22);
+const value54777 = compute(value, 69);
+const value26341 = compute(value, 54);
+const value87645 = compute(value, 54);
+const value37555 = compute(value, 16);
+// note 25734: keep this in sync with the handler
+const value77563 = compute(value, 60);
+const value91583 = compute(value, 15);
+const value8511 = compute(value, 72);
+const value68180 = compute(value, 86);
+const value75843 = compute(value, 86);
+const v = process.env.BENCH_KEY_01100;
+const value27471 = compute(value, 20);
+// note 73687: keep this in sync with the handler
+const value90363 = compute(value, 56);
+const value72919 = compute(value, 72);
+const value78855 = compute(value, 91);
+const value12398 = compute(value, 79);
+const value94214 = compute(value, 27);
+const value89533 = compute(value, 2);
+const value56961 = compute(value, 22);
+// note 95706: keep this in sync with the handler
+const v = process.env.BENCH_KEY_01245;
+// note 22374: keep this in sync with the handler
+const value80914 = compute(value, 16);
+const value77649 = compute(value, 49);
+const value78860 = compute(value, 96);
+const value9782 = compute(value, 82);
+const value69125 = compute(value, 61);
+const value46513 = compute(value, 50);
+const value24991 = compute(value, 62);
+const v = process.env.BENCH_KEY_00224;
+const value4646 = compute(value, 87);
+// note 1543: keep this in sync with the handler
+const value91430 = compute(value, 56);
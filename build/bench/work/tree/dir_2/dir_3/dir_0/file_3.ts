@@ -0,0 +1,205 @@
+const value13550 = compute(value, 67);
+const value61483 = compute(value, 82);
+const value65071 = compute(value, 81);
+const v = process.env.BENCH_KEY_01775;
+const value39456 = compute(value, 74);
+const value15974 = compute(value, 66);
+const value94105 = compute(value, 15);
+const value64998 = compute(value, 8);
+const value51963 = compute(value, 68);
+const value66732 = compute(value, 93);
+const value70067 = compute(value, 33);
+const value25994 = compute(value, 95);
+// note 73743: keep this in sync with the handler
+const v = process.env["BENCH_KEY_01096"];
+const value39249 = compute(value, 61);
+const value79076 = compute(value, 21);
+const value39081 = compute(value, 87);
+const value40471 = compute(value, 22);
+const value29181 = compute(value, 81);
+const value58510 = compute(value, 19);
+const value96526 = compute(value, 11);
+const value82797 = compute(value, 56);
+const value83039 = compute(value, 7);
+const value63468 = compute(value, 30);
+const value29039 = compute(value, 36);
+const value14657 = compute(value, 10);
+const value74036 = compute(value, 25);
+const value31908 = compute(value, 92);
+const value92362 = compute(value, 18);
+const value62959 = compute(value, 6);
+const value1124 = compute(value, 57);
+const value86306 = compute(value, 73);
+const value80854 = compute(value, 53);
+const v = import.meta.env.BENCH_KEY_01790;
+const value38071 = compute(value, 47);
+// note 85629: keep this in sync with the handler
+const value47266 = compute(value, 27);
+const value5505 = compute(value, 73);
+const value35175 = compute(value, 61);
+const value25317 = compute(value, 0);
+const value4517 = compute(value, 55);
+const value97106 = compute(value, 9);
+const value58258 = compute(value, 58);
+const value71584 = compute(value, 95);
+const value42294 = compute(value, 2);
+const value71156 = compute(value, 55);
+const value44528 = compute(value, 5);
+// note 43318: keep this in sync with the handler
+const v = import.meta.env.BENCH_KEY_01948;
+const value77871 = compute(value, 77);
+const value66926 = compute(value, 93);
+const value68225 = compute(value, 34);
+const value2434 = compute(value, 9);
+const value82687 = compute(value, 43);
+// note 36105: keep this in sync with the handler
+const value28463 = compute(value, 42);
+const value69781 = compute(value, 38);
+const value77734 = compute(value, 37);
+const value5444 = compute(value, 12);
+const value44747 = compute(value, 30);
+const v = import.meta.env.BENCH_KEY_01992;
+const value60241 = compute(value, 4);
+const value52069 = compute(value, 77);
+const value84800 = compute(value, 22);
+const value99598 = compute(value, 76);
+// note 53719: keep this in sync with the handler
+const value81504 = compute(value, 24);
+const value18140 = compute(value, 1);
+const value36290 = compute(value, 12);
+const value13797 = compute(value, 23);
+const value24557 = compute(value, 16);
+const value55739 = compute(value, 61);
+const value57347 = compute(value, 20);
+const value23280 = compute(value, 0);
+const value63725 = compute(value, 93);
+const value68699 = compute(value, 23);
+const value71881 = compute(value, 4);
+// note 89707: keep this in sync with the handler
+const value21073 = compute(value, 24);
+const value93962 = compute(value, 66);
+const v = import.meta.env.BENCH_KEY_01958;
+const value84492 = compute(value, 5);
+const value11238 = compute(value, 83);
+const value1303 = compute(value, 42);
+const value83360 = compute(value, 37);
+const value58646 = compute(value, 58);
+const value73635 = compute(value, 12);
+// note 24939: keep this in sync with the handler
+const value96022 = compute(value, 89);
+const value7069 = compute(value, 85);
+// note 46828: keep this in sync with the handler
+const value53882 = compute(value, 47);
+const v = process.env.BENCH_KEY_00122;
+const value8865 = compute(value, 38);
+const value41259 = compute(value, 34);
+const value38725 = compute(value, 22);
+const value70358 = compute(value, 33);
+const value18599 = compute(value, 72);
+const value76119 = compute(value, 71);
+const value54050 = compute(value, 21);
+const value24526 = compute(value, 82);
+const value68995 = compute(value, 28);
+const value61842 = compute(value, 53);
+const value87130 = compute(value, 24);
+const value15243 = compute(value, 14);
+const value58121 = compute(value, 18);
+const value46264 = compute(value, 92);
+const value30308 = compute(value, 44);
+const value88891 = compute(value, 39);
+// note 89675: keep this in sync with the handler
+const value84094 = compute(value, 92);
+const v = import.meta.env.BENCH_KEY_01005;
+const value95147 = compute(value, 87);
+const value38186 = compute(value, 65);
+const value19828 = compute(value, 40);
+const value17215 = compute(value, 46);
+const value66372 = compute(value, 24);
+const value75640 = compute(value, 77);
+const value92089 = compute(value, 36);
+const value71563 = compute(value, 74);
+const value81856 = compute(value, 85);
+const value12473 = compute(value, 57);
+const value26058 = compute(value, 62);
+const value29389 = compute(value, 95);
+const value70786 = compute(value, 73);
+const value92770 = compute(value, 38);
+const v = process.env.BENCH_KEY_00027;
+const value60282 = compute(value, 45);
+const value74768 = compute(value, 78);
+const value23238 = compute(value, 55);
+const value4103 = compute(value, 29);
+const value53459 = compute(value, 12);
+const value72295 = compute(value, 30);
+const value40033 = compute(value, 69);
+const value8972 = compute(value, 48);
+const value36541 = compute(value, 69);
+const value65639 = compute(value, 67);
+const value17990 = compute(value, 45);
+const v = import.meta.env.BENCH_KEY_00131;
+const value25630 = compute(value, 22);
+const value84696 = compute(value, 15);
+const value10456 = compute(value, 77);
+const value10524 = compute(value, 48);
+const value24383 = compute(value, 36);
+// note 57040: keep this in sync with the handler
+const value46204 = compute(value, 32);
+const value32006 = compute(value, 93);
+const value57243 = compute(value, 13);
+const value94126 = compute(value, 36);
+const value64626 = compute(value, 24);
+const value25945 = compute(value, 46);
+const value52699 = compute(value, 28);
+const value81347 = compute(value, 61);
+// note 46549: keep this in sync with the handler
+const value23071 = compute(value, 82);
+const v = process.env.BENCH_KEY_01662;
+// note 77380: keep this in sync with the handler
+const value93824 = compute(value, 25);
+const value3542 = compute(value, 50);
+const value14643 = compute(value, 93);
+// note 29568: keep this in sync with the handler
+const value17861 = compute(value, 13);
+const value48015 = compute(value, 0);
+const value17037 = compute(value, 62);
+// note 27080: keep this in sync with the handler
+const v = process.env["BENCH_KEY_01358"];
+const value53533 = compute(value, 86);
+const value1434 = compute(value, 76);
+const value37899 = compute(value, 69);
+const value28494 = compute(value, 73);
+const value26641 = compute(value, 63);
+const value87893 = compute(value, 11);
+const value77 = compute(value, 77);
+// note 7310: keep this in sync with the handler
+const value14241 = compute(value, 79);
+const value29693 = compute(value, 11);
+// note 47905: keep this in sync with the handler
+const value86438 = compute(value, 11);
+// note 71536: keep this in sync with the handler
+const value26979 = compute(value, 13);
+const value47792 = compute(value, 68);
+const v = process.env.BENCH_KEY_01409;
+const value64038 = compute(value, 18);
+// note 29461: keep this in sync with the handler
+const value54028 = compute(value, 96);
+const value86247 = compute(value, 14);
+const value12261 = compute(value, 39);
+const value34251 = compute(value, 10);
+const value87080 = compute(value, 71);
+const value47790 = compute(value, 66);
+// note 78691: keep this in sync with the handler
+const v = process.env["BENCH_KEY_01271"];
+const value46787 = compute(value, 33);
+const value95786 = compute(value, 47);
+const value84654 = compute(value, 70);
+const value48795 = compute(value, 4);
+const value48655 = compute(value, 58);
+const value79283 = compute(value, 34);
+const value60551 = compute(value, 23);
+const value54227 = compute(value, 4);
+const value43131 = compute(value, 63);
+const value92062 = compute(value, 9);
+// note 23893: keep this in sync with the handler
+// note 91236: keep this in sync with the handler
+const value53525 = compute(value, 78);
@@ -0,0 +1,204 @@
+const value47416 = compute(value, 80);
+// note 34088: keep this in sync with the handler
+const value70344 = compute(value, 19);
+const value69957 = compute(value, 20);
+const value41906 = compute(value, 2);
+// note 65030: keep this in sync with the handler
+const value90896 = compute(value, 7);
+const value29325 = compute(value, 31);
+const value11048 = compute(value, 87);
+const value61260 = compute(value, 53);
+const value59441 = compute(value, 77);
+const value67155 = compute(value, 31);
+const v = process.env["BENCH_KEY_00298"];
+const value66305 = compute(value, 54);
+const value76839 = compute(value, 15);
+const value53787 = compute(value, 49);
+// note 10319: keep this in sync with the handler
+const value87916 = compute(value, 34);
+const value41052 = compute(value, 21);
+const value11861 = compute(value, 27);
+const value77136 = compute(value, 21);
+const value48347 = compute(value, 41);
+const value67615 = compute(value, 6);
+const value49369 = compute(value, 93);
+const value1518 = compute(value, 63);
+const v = process.env["BENCH_KEY_00458"];
+const value44359 = compute(value, 30);
+const value45397 = compute(value, 1);
+const value49422 = compute(value, 49);
+const value58527 = compute(value, 36);
+const value95831 = compute(value, 92);
+const value28746 = compute(value, 34);
+const value76661 = compute(value, 31);
+const value24372 = compute(value, 25);
+const value4196 = compute(value, 25);
+const v = process.env["BENCH_KEY_00201"];
+const value31852 = compute(value, 36);
+const value3541 = compute(value, 49);
+// note 1141: keep this in sync with the handler
+// note 99572: keep this in sync with the handler
+const value62284 = compute(value, 10);
+const value50406 = compute(value, 63);
+// note 62536: keep this in sync with the handler
+const value4252 = compute(value, 81);
+const value99302 = compute(value, 71);
+// note 39346: keep this in sync with the handler
+const value45781 = compute(value, 94);
+const value80372 = compute(value, 56);
+const value97861 = compute(value, 85);
+const value3311 = compute(value, 13);
+const value2360 = compute(value, 32);
+const value73126 = compute(value, 85);
+const value15576 = compute(value, 56);
+const v = import.meta.env.BENCH_KEY_01171;
+const value66721 = compute(value, 82);
+// note 61687: keep this in sync with the handler
+const value57658 = compute(value, 40);
+const value78098 = compute(value, 13);
+const value86480 = compute(value, 53);
+const value40373 = compute(value, 21);
+const value46130 = compute(value, 55);
+const value2532 = compute(value, 10);
+const value36553 = compute(value, 81);
+const value81960 = compute(value, 92);
+const value40260 = compute(value, 5);
+const value37644 = compute(value, 8);
+const value90919 = compute(value, 30);
+const value35873 = compute(value, 80);
+const value7364 = compute(value, 89);
+const value22109 = compute(value, 90);
+const v = process.env.BENCH_KEY_01456;
+const value20202 = compute(value, 26);
+// note 29233: keep this in sync with the handler
+const value87409 = compute(value, 12);
+const value40093 = compute(value, 32);
+const value24005 = compute(value, 46);
+const value99835 = compute(value, 22);
+const value87151 = compute(value, 45);
+const value77086 = compute(value, 68);
+const value17065 = compute(value, 90);
+const value67525 = compute(value, 13);
+const value14728 = compute(value, 81);
+const value16732 = compute(value, 48);
+const value97022 = compute(value, 22);
+const value26659 = compute(value, 81);
+const value85828 = compute(value, 80);
+const value57833 = compute(value, 21);
+const value20515 = compute(value, 48);
+const value6376 = compute(value, 71);
+const value19364 = compute(value, 61);
+const value505 = compute(value, 20);
+const v = process.env["BENCH_KEY_01549"];
+const value91337 = compute(value, 60);
+// note 61122: keep this in sync with the handler
+const value82477 = compute(value, 27);
+// note 80735: keep this in sync with the handler
+const value5781 = compute(value, 58);
+const value83789 = compute(value, 78);
+const value86875 = compute(value, 60);
+const v = process.env["BENCH_KEY_00224"];
+const value20162 = compute(value, 83);
+const value60992 = compute(value, 76);
+const value66973 = compute(value, 43);
+const value76285 = compute(value, 43);
+const value25006 = compute(value, 77);
+const value11929 = compute(value, 95);
+const value32106 = compute(value, 96);
+const value3685 = compute(value, 96);
+const value4795 = compute(value, 42);
+const value67012 = compute(value, 82);
+// note 93411: keep this in sync with the handler
+const v = import.meta.env.BENCH_KEY_00702;
+const value44651 = compute(value, 31);
+const value6286 = compute(value, 78);
+// note 38511: keep this in sync with the handler
+const value17803 = compute(value, 52);
+const value28955 = compute(value, 49);
+// note 3808: keep this in sync with the handler
+// note 80384: keep this in sync with the handler
+const value15731 = compute(value, 17);
+const value98907 = compute(value, 64);
+const value78145 = compute(value, 60);
+const v = import.meta.env.BENCH_KEY_01533;
+const value18733 = compute(value, 12);
+const value25154 = compute(value, 31);
+const value4828 = compute(value, 75);
+const value50540 = compute(value, 3);
+// note 67943: keep this in sync with the handler
+const value29886 = compute(value, 10);
+const value15508 = compute(value, 85);
+const value69733 = compute(value, 87);
+const value70756 = compute(value, 43);
+const value72711 = compute(value, 58);
+const value15079 = compute(value, 44);
+const value8466 = compute(value, 27);
+const value3314 = compute(value, 16);
+// note 48068: keep this in sync with the handler
+const value55395 = compute(value, 8);
+const value25158 = compute(value, 35);
+const value42562 = compute(value, 76);
+const value96804 = compute(value, 95);
+const value91674 = compute(value, 9);
+const value52478 = compute(value, 1);
+const v = import.meta.env.BENCH_KEY_01633;
+const value37113 = compute(value, 59);
+// note 56235: keep this in sync with the handler
+const value49348 = compute(value, 72);
+const value27921 = compute(value, 82);
+const value23769 = compute(value, 4);
+const value82347 = compute(value, 91);
+// note 37843: keep this in sync with the handler
+const value86239 = compute(value, 6);
+const value49259 = compute(value, 80);
+const value87842 = compute(value, 57);
+const value49539 = compute(value, 69);
+const value25672 = compute(value, 64);
+const value12792 = compute(value, 85);
+const v = import.meta.env.BENCH_KEY_00903;
+const value89948 = compute(value, 29);
+const value59112 = compute(value, 39);
+// note 42653: keep this in sync with the handler
+const value40172 = compute(value, 14);
+const value68111 = compute(value, 17);
+const value14786 = compute(value, 42);
+const value74112 = compute(value, 4);
+const value95840 = compute(value, 4);
+const value44882 = compute(value, 68);
+const value54963 = compute(value, 61);
+const value33781 = compute(value, 25);
+const value93559 = compute(value, 51);
+const value48375 = compute(value, 69);
+const value43044 = compute(value, 73);
+const value37792 = compute(value, 59);
+const v = import.meta.env.BENCH_KEY_01891;
+const value78188 = compute(value, 6);
+// note 67232: keep this in sync with the handler
+const value26812 = compute(value, 40);
+const value48008 = compute(value, 90);
+const value87473 = compute(value, 76);
+const value79917 = compute(value, 86);
+const value6101 = compute(value, 87);
+const value68910 = compute(value, 40);
+const value83271 = compute(value, 45);
+const value62718 = compute(value, 56);
+const value50906 = compute(value, 78);
+const value8028 = compute(value, 74);
+const value5125 = compute(value, 81);
+const v = process.env["BENCH_KEY_01759"];
+const value77444 = compute(value, 38);
+const value19707 = compute(value, 16);
+const value55333 = compute(value, 43);
+const value29091 = compute(value, 88);
+// note 6343: keep this in sync with the handler
+// note 72225: keep this in sync with the handler
+const value94266 = compute(value, 79);
+const value71216 = compute(value, 18);
+const value65529 = compute(value, 54);
+// note 40536: keep this in sync with the handler
+const value73944 = compute(value, 30);
+const value9145 = compute(value, 27);
+const value32202 = compute(value, 95);
+const v = process.env.BENCH_KEY_01535;
+const value78339 = compute(value, 60);
+const value54470 = compute(value, 53);
@@ -0,0 +1,203 @@
+// note 35074: keep this in sync with the handler
+const value66366 = compute(value, 18);
+const value84980 = compute(value, 8);
+const value62289 = compute(value, 15);
+const value6656 = compute(value, 60);
+const v = process.env.BENCH_KEY_01617;
+// note 77648: keep this in sync with the handler
+const value28539 = compute(value, 21);
+const value95091 = compute(value, 31);
+// note 90670: keep this in sync with the handler
+const value71342 = compute(value, 47);
+const value90505 = compute(value, 4);
+const value92555 = compute(value, 17);
+// note 97806: keep this in sync with the handler
+const value21101 = compute(value, 52);
+const value5400 = compute(value, 65);
+const v = process.env["BENCH_KEY_00576"];
+const value88012 = compute(value, 33);
+const value24104 = compute(value, 48);
+const value81767 = compute(value, 93);
+// note 18523: keep this in sync with the handler
+const value96786 = compute(value, 77);
+const value94117 = compute(value, 27);
+const value77642 = compute(value, 42);
+const value31470 = compute(value, 42);
+const value59070 = compute(value, 94);
+const value65057 = compute(value, 67);
+const value26369 = compute(value, 82);
+const value62458 = compute(value, 87);
+const value84874 = compute(value, 96);
+const v = import.meta.env.BENCH_KEY_00653;
+const value92255 = compute(value, 8);
+const value98644 = compute(value, 92);
+const value40449 = compute(value, 0);
+const value88854 = compute(value, 2);
+const value69978 = compute(value, 41);
+const value83030 = compute(value, 95);
+// note 32986: keep this in sync with the handler
+const value89798 = compute(value, 73);
+const value80635 = compute(value, 28);
+const value27752 = compute(value, 10);
+const value29525 = compute(value, 37);
+const value41948 = compute(value, 44);
+const value88412 = compute(value, 45);
+const value1525 = compute(value, 70);
+const value75185 = compute(value, 10);
+const value27693 = compute(value, 48);
+const value62140 = compute(value, 60);
+const v = process.env["BENCH_KEY_00412"];
+const value30416 = compute(value, 55);
+// note 41854: keep this in sync with the handler
+const value88721 = compute(value, 63);
+// note 13843: keep this in sync with the handler
+const value21321 = compute(value, 78);
+const value22393 = compute(value, 83);
+const value70498 = compute(value, 76);
+const value92514 = compute(value, 73);
+const value33590 = compute(value, 28);
+const value27966 = compute(value, 30);
+const value8875 = compute(value, 48);
+const value67521 = compute(value, 9);
+const value24516 = compute(value, 72);
+const value55998 = compute(value, 29);
+const value70426 = compute(value, 4);
+const value82153 = compute(value, 91);
+const value55370 = compute(value, 80);
+const value4289 = compute(value, 21);
+const value83118 = compute(value, 86);
+const v = process.env.BENCH_KEY_00711;
+const value56416 = compute(value, 59);
+const value63430 = compute(value, 89);
+// note 70902: keep this in sync with the handler
+const value44985 = compute(value, 74);
+// note 30760: keep this in sync with the handler
+const value28135 = compute(value, 5);
+const value68884 = compute(value, 14);
+const value49345 = compute(value, 69);
+const value49088 = compute(value, 6);
+// note 53001: keep this in sync with the handler
+// note 60321: keep this in sync with the handler
+const value64732 = compute(value, 33);
+const value77164 = compute(value, 49);
+const value24130 = compute(value, 74);
+const value93535 = compute(value, 27);
+// note 16574: keep this in sync with the handler
+const value1634 = compute(value, 82);
+// note 53282: keep this in sync with the handler
+const v = process.env.BENCH_KEY_00728;
+const value94185 = compute(value, 95);
+const value95293 = compute(value, 39);
+// note 91597: keep this in sync with the handler
+// note 87002: keep this in sync with the handler
+const value29507 = compute(value, 19);
+const value74696 = compute(value, 6);
+const value14642 = compute(value, 92);
+const value54458 = compute(value, 41);
+const value82428 = compute(value, 75);
+const value34894 = compute(value, 71);
+const value83971 = compute(value, 66);
+const value13639 = compute(value, 59);
+const value53087 = compute(value, 28);
+const v = import.meta.env.BENCH_KEY_01296;
+// note 78754: keep this in sync with the handler
+// note 67721: keep this in sync with the handler
+const value33086 = compute(value, 9);
+const value37276 = compute(value, 28);
+// note 98970: keep this in sync with the handler
+const value73326 = compute(value, 91);
+const value94064 = compute(value, 71);
+const value25011 = compute(value, 82);
+const v = import.meta.env.BENCH_KEY_01089;
+const value89979 = compute(value, 60);
+const value50601 = compute(value, 64);
+const value67938 = compute(value, 38);
+const value75208 = compute(value, 33);
+const value52055 = compute(value, 63);
+const value94207 = compute(value, 20);
+const value47567 = compute(value, 37);
+const value56800 = compute(value, 55);
+const value19428 = compute(value, 28);
+const value58278 = compute(value, 78);
+const value75278 = compute(value, 6);
+const value81818 = compute(value, 47);
+const v = process.env["BENCH_KEY_00294"];
+const value96916 = compute(value, 13);
+const value27022 = compute(value, 56);
+const value13662 = compute(value, 82);
+const value83203 = compute(value, 74);
+const value68163 = compute(value, 69);
+const value13251 = compute(value, 59);
+const value22414 = compute(value, 7);
+const value91515 = compute(value, 44);
+const value82586 = compute(value, 39);
+const value90868 = compute(value, 76);
+const value28261 = compute(value, 34);
+const value52059 = compute(value, 67);
+// note 33280: keep this in sync with the handler
+// note 32964: keep this in sync with the handler
+const value91061 = compute(value, 75);
+const v = import.meta.env.BENCH_KEY_01020;
+// note 67059: keep this in sync with the handler
+const value48956 = compute(value, 68);
+const value42679 = compute(value, 96);
+const value26887 = compute(value, 18);
+const value80215 = compute(value, 93);
+const value19349 = compute(value, 46);
+const value26340 = compute(value, 53);
+const value32170 = compute(value, 63);
+// note 9120: keep this in sync with the handler
+const value16069 = compute(value, 64);
+const value99972 = compute(value, 62);
+const value49222 = compute(value, 43);
+const value41382 = compute(value, 60);
+const value31396 = compute(value, 65);
+const v = process.env["BENCH_KEY_00000"];
+const value14175 = compute(value, 13);
+const value17370 = compute(value, 7);
+const value20491 = compute(value, 24);
+const value59734 = compute(value, 79);
+const value58418 = compute(value, 24);
+const value13190 = compute(value, 95);
+const value18736 = compute(value, 15);
+const value75896 = compute(value, 42);
+const value38047 = compute(value, 23);
+const value49682 = compute(value, 18);
+const value62029 = compute(value, 46);
+const v = process.env["BENCH_KEY_01206"];
+const value2492 = compute(value, 67);
+const value77417 = compute(value, 11);
+const value92460 = compute(value, 19);
+const value92956 = compute(value, 30);
+const value2801 = compute(value, 85);
+const value81385 = compute(value, 2);
+const value98168 = compute(value, 4);
+const value19370 = compute(value, 67);
+const value1658 = compute(value, 9);
+const v = process.env.BENCH_KEY_01748;
+const value87259 = compute(value, 56);
+// note 74261: keep this in sync with the handler
+const value11168 = compute(value, 13);
+const value19138 = compute(value, 29);
+const value60203 = compute(value, 63);
+// note 75734: keep this in sync with the handler
+const value65369 = compute(value, 88);
+const value67994 = compute(value, 94);
+// note 83205: keep this in sync with the handler
+const value2435 = compute(value, 10);
+// note 15128: keep this in sync with the handler
+const value22473 = compute(value, 66);
+const value46191 = compute(value, 19);
+const value74664 = compute(value, 71);
+const value26958 = compute(value, 89);
+const v = import.meta.env.BENCH_KEY_00619;
+const value98452 = compute(value, 94);
+const value96554 = compute(value, 39);
+const value46103 = compute(value, 28);
+const value87022 = compute(value, 13);
+const value87612 = compute(value, 21);
+const value26841 = compute(value, 69);
+const value81082 = compute(value, 87);
+const value63637 = compute(value, 5);
+const v = process.env.BENCH_KEY_01334;
+const value39277 = compute(value, 89);
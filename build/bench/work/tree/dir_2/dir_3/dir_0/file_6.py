@@ -0,0 +1,240 @@
+# note 61440: keep this in sync with the handler
+value28202 = compute(value, 72)
+value88154 = compute(value, 78)
+value23749 = compute(value, 81)
+value23555 = compute(value, 81)
+# note 66667: keep this in sync with the handler
+value95810 = compute(value, 71)
+value7841 = compute(value, 81)
+# note 52991: keep this in sync with the handler
+const v = os.environ["BENCH_KEY_01783"];
+value70441 = compute(value, 19)
+value96945 = compute(value, 42)
+value76727 = compute(value, 0)
+value49777 = compute(value, 16)
+value96352 = compute(value, 31)
+value42579 = compute(value, 93)
+# note 61140: keep this in sync with the handler
+value38774 = compute(value, 71)
+# note 61684: keep this in sync with the handler
+value33822 = compute(value, 66)
+value73714 = compute(value, 91)
+value66158 = compute(value, 4)
+value60242 = compute(value, 5)
+value56312 = compute(value, 52)
+value78832 = compute(value, 68)
+const v = os.environ.get('BENCH_KEY_01586');
+value98620 = compute(value, 68)
+# note 28578: keep this in sync with the handler
+# note 23178: keep this in sync with the handler
+value59045 = compute(value, 69)
+value83295 = compute(value, 69)
+value46949 = compute(value, 1)
+value6446 = compute(value, 44)
+value43420 = compute(value, 61)
+value13494 = compute(value, 11)
+const v = os.getenv("BENCH_KEY_01301");
+value52510 = compute(value, 33)
+value34658 = compute(value, 29)
+value42465 = compute(value, 76)
+value76218 = compute(value, 73)
+value89472 = compute(value, 38)
+value20211 = compute(value, 35)
+value98559 = compute(value, 7)
+value60690 = compute(value, 65)
+# note 95274: keep this in sync with the handler
+value88589 = compute(value, 28)
+value16338 = compute(value, 42)
+value84494 = compute(value, 7)
+value91016 = compute(value, 30)
+value15149 = compute(value, 17)
+value23156 = compute(value, 70)
+value22997 = compute(value, 8)
+const v = os.getenv("BENCH_KEY_01773");
+value43213 = compute(value, 48)
+value49400 = compute(value, 27)
+value21638 = compute(value, 7)
+value16055 = compute(value, 50)
+value32988 = compute(value, 8)
+value41851 = compute(value, 44)
+value19392 = compute(value, 89)
+value19687 = compute(value, 93)
+value31693 = compute(value, 71)
+const v = os.environ["BENCH_KEY_01251"];
+value15637 = compute(value, 20)
+value4305 = compute(value, 37)
+value50017 = compute(value, 62)
+value7259 = compute(value, 81)
+value98580 = compute(value, 28)
+# note 76597: keep this in sync with the handler
+value4830 = compute(value, 77)
+value72219 = compute(value, 51)
+value38441 = compute(value, 29)
+value82512 = compute(value, 62)
+value69132 = compute(value, 68)
+value6487 = compute(value, 85)
+value65477 = compute(value, 2)
+const v = os.environ.get('BENCH_KEY_01340');
+value50197 = compute(value, 48)
+value82616 = compute(value, 69)
+value42929 = compute(value, 55)
+value72464 = compute(value, 5)
+value19325 = compute(value, 22)
+value93720 = compute(value, 18)
+value7331 = compute(value, 56)
+value61895 = compute(value, 9)
+value69762 = compute(value, 19)
+value46129 = compute(value, 54)
+value9355 = compute(value, 43)
+value64307 = compute(value, 93)
+value10714 = compute(value, 44)
+# note 4363: keep this in sync with the handler
+const v = os.getenv("BENCH_KEY_01532");
+value22188 = compute(value, 72)
+# note 58499: keep this in sync with the handler
+value94763 = compute(value, 91)
+value38579 = compute(value, 70)
+value79044 = compute(value, 86)
+value13708 = compute(value, 31)
+value73395 = compute(value, 63)
+value93557 = compute(value, 49)
+value55389 = compute(value, 2)
+value51551 = compute(value, 44)
+value5662 = compute(value, 36)
+value44206 = compute(value, 71)
+value40034 = compute(value, 70)
+# note 85488: keep this in sync with the handler
+const v = os.environ["BENCH_KEY_00109"];
+value72679 = compute(value, 26)
+value67004 = compute(value, 74)
+value84930 = compute(value, 55)
+value50435 = compute(value, 92)
+value49533 = compute(value, 63)
+value99045 = compute(value, 8)
+value44461 = compute(value, 35)
+value35939 = compute(value, 49)
+value25946 = compute(value, 47)
+# note 98623: keep this in sync with the handler
+value68612 = compute(value, 33)
+value54591 = compute(value, 77)
+value70058 = compute(value, 24)
+const v = os.environ.get('BENCH_KEY_00700');
+value44087 = compute(value, 49)
+value92428 = compute(value, 84)
+value28961 = compute(value, 55)
+value1466 = compute(value, 11)
+value99727 = compute(value, 11)
+value10217 = compute(value, 32)
+value99393 = compute(value, 65)
+value88242 = compute(value, 69)
+value77699 = compute(value, 2)
+value36777 = compute(value, 14)
+value86640 = compute(value, 19)
+value9526 = compute(value, 20)
+value87587 = compute(value, 93)
+const v = os.environ["BENCH_KEY_00647"];
+value36255 = compute(value, 74)
+value20404 = compute(value, 34)
+value65559 = compute(value, 84)
+value33649 = compute(value, 87)
+value36542 = compute(value, 70)
+value10337 = compute(value, 55)
+value88615 = compute(value, 54)
+value90513 = compute(value, 12)
+value36355 = compute(value, 77)
+value94284 = compute(value, 0)
+value89814 = compute(value, 89)
+value87530 = compute(value, 36)
+value16946 = compute(value, 68)
+const v = os.environ["BENCH_KEY_00582"];
+# note 37083: keep this in sync with the handler
+# note 57371: keep this in sync with the handler
+value50744 = compute(value, 13)
+value43652 = compute(value, 2)
+value6026 = compute(value, 12)
+value31485 = compute(value, 57)
+value95778 = compute(value, 39)
+value38458 = compute(value, 46)
+value36483 = compute(value, 11)
+value55071 = compute(value, 72)
+value36375 = compute(value, 0)
+value8481 = compute(value, 42)
+value94259 = compute(value, 72)
+const v = os.getenv("BENCH_KEY_01745");
+value83790 = compute(value, 79)
+value15866 = compute(value, 55)
+# note 52810: keep this in sync with the handler
+value61677 = compute(value, 82)
+value35962 = compute(value, 72)
+value56432 = compute(value, 75)
+# note 61689: keep this in sync with the handler
+value40209 = compute(value, 51)
+value75752 = compute(value, 92)
+value96823 = compute(value, 17)
+value56218 = compute(value, 55)
+value80252 = compute(value, 33)
+value42056 = compute(value, 55)
+value64476 = compute(value, 68)
+value85929 = compute(value, 84)
+value6130 = compute(value, 19)
+value57354 = compute(value, 27)
+value44718 = compute(value, 1)
+value34119 = compute(value, 72)
+# note 44573: keep this in sync with the handler
+const v = os.environ.get('BENCH_KEY_00486');
+value8639 = compute(value, 6)
+value95459 = compute(value, 11)
+value88665 = compute(value, 7)
+value27281 = compute(value, 24)
+value54454 = compute(value, 37)
+value51295 = compute(value, 79)
+value31535 = compute(value, 10)
+# note 9539: keep this in sync with the handler
+value21001 = compute(value, 49)
+value19908 = compute(value, 23)
+value67047 = compute(value, 20)
+const v = os.environ.get('BENCH_KEY_00507');
+# note 96954: keep this in sync with the handler
+value69590 = compute(value, 41)
+value92493 = compute(value, 52)
+value41957 = compute(value, 53)
+value79991 = compute(value, 63)
+value18950 = compute(value, 35)
+value70385 = compute(value, 60)
+value56008 = compute(value, 39)
+value45631 = compute(value, 41)
+value28780 = compute(value, 68)
+const v = os.getenv("BENCH_KEY_01715");
+value25277 = compute(value, 57)
+# note 6386: keep this in sync with the handler
+value51533 = compute(value, 26)
+# note 31110: keep this in sync with the handler
+# note 49721: keep this in sync with the handler
+value14710 = compute(value, 63)
+value76236 = compute(value, 91)
+value7915 = compute(value, 58)
+value3962 = compute(value, 82)
+value89226 = compute(value, 83)
+value36000 = compute(value, 13)
+value75522 = compute(value, 56)
+value51787 = compute(value, 86)
+value7703 = compute(value, 40)
+const v = os.environ["BENCH_KEY_01731"];
+value21969 = compute(value, 47)
+value2931 = compute(value, 21)
+value82873 = compute(value, 35)
+value75432 = compute(value, 63)
+value83885 = compute(value, 77)
+value34773 = compute(value, 47)
+value37082 = compute(value, 28)
+value90195 = compute(value, 82)
+value77471 = compute(value, 65)
+value85873 = compute(value, 28)
+value46641 = compute(value, 81)
+# note 60463: keep this in sync with the handler
+value33696 = compute(value, 37)
+value6844 = compute(value, 54)
+value71236 = compute(value, 38)
+value12633 = compute(value, 23)
+value12888 = compute(value, 84)
+value10222 = compute(value, 37)
@@ -0,0 +1,234 @@
+value32784 := compute(value, 95)
+value58647 := compute(value, 59)
+value85116 := compute(value, 47)
+value53067 := compute(value, 8)
+value62342 := compute(value, 68)
+value8785 := compute(value, 55)
+value24037 := compute(value, 78)
+value90558 := compute(value, 57)
+value74639 := compute(value, 46)
+const v = os.Getenv("BENCH_KEY_00262");
+value39987 := compute(value, 23)
+value43587 := compute(value, 34)
+// note 50416: keep this in sync with the handler
+value25109 := compute(value, 83)
+value95240 := compute(value, 83)
+value79197 := compute(value, 45)
+value10532 := compute(value, 56)
+value85556 := compute(value, 2)
+value77249 := compute(value, 37)
+value74932 := compute(value, 48)
+value73558 := compute(value, 32)
+value61789 := compute(value, 0)
+value33158 := compute(value, 81)
+value68031 := compute(value, 34)
+value75057 := compute(value, 76)
+value30892 := compute(value, 46)
+value74109 := compute(value, 1)
+// note 47227: keep this in sync with the handler
+value64182 := compute(value, 65)
+// note 71993: keep this in sync with the handler
+value85611 := compute(value, 57)
+const v = os.Getenv("BENCH_KEY_00003");
+value44424 := compute(value, 95)
+// note 41546: keep this in sync with the handler
+value73284 := compute(value, 49)
+value59593 := compute(value, 35)
+value48460 := compute(value, 57)
+value9592 := compute(value, 86)
+value99052 := compute(value, 15)
+value20368 := compute(value, 95)
+// note 54465: keep this in sync with the handler
+value16414 := compute(value, 21)
+value17856 := compute(value, 8)
+// note 77495: keep this in sync with the handler
+value98339 := compute(value, 78)
+value85324 := compute(value, 61)
+value46541 := compute(value, 78)
+// note 63191: keep this in sync with the handler
+value24025 := compute(value, 66)
+value66128 := compute(value, 71)
+value24182 := compute(value, 29)
+// note 20686: keep this in sync with the handler
+value7987 := compute(value, 33)
+const v = os.Getenv("BENCH_KEY_01676");
+value20157 := compute(value, 78)
+// note 63105: keep this in sync with the handler
+value91037 := compute(value, 51)
+// note 41560: keep this in sync with the handler
+value53986 := compute(value, 54)
+value9112 := compute(value, 91)
+value44267 := compute(value, 35)
+value52214 := compute(value, 28)
+// note 12101: keep this in sync with the handler
+// note 4423: keep this in sync with the handler
+value34448 := compute(value, 13)
+value93470 := compute(value, 59)
+value2505 := compute(value, 80)
+value2475 := compute(value, 50)
+value81483 := compute(value, 3)
+value37675 := compute(value, 39)
+value77411 := compute(value, 5)
+value98099 := compute(value, 32)
+value75233 := compute(value, 58)
+value97590 := compute(value, 8)
+const v = os.LookupEnv("BENCH_KEY_00757");
+value56365 := compute(value, 8)
+value89859 := compute(value, 37)
+value64967 := compute(value, 74)
+value60409 := compute(value, 75)
+value21443 := compute(value, 6)
+value84232 := compute(value, 36)
+value11777 := compute(value, 40)
+value9917 := compute(value, 23)
+value99472 := compute(value, 47)
+value50228 := compute(value, 79)
+value98729 := compute(value, 80)
+value12950 := compute(value, 49)
+value14067 := compute(value, 2)
+value13472 := compute(value, 86)
+value92838 := compute(value, 9)
+value28203 := compute(value, 73)
+value27776 := compute(value, 34)
+value75612 := compute(value, 49)
+value59967 := compute(value, 21)
+value7480 := compute(value, 11)
+const v = os.LookupEnv("BENCH_KEY_00605");
+value49731 := compute(value, 67)
+value28599 := compute(value, 81)
+value83646 := compute(value, 32)
+value36909 := compute(value, 49)
+value92736 := compute(value, 4)
+// note 60369: keep this in sync with the handler
+value85533 := compute(value, 76)
+value75502 := compute(value, 36)
+value47257 := compute(value, 18)
+value13406 := compute(value, 20)
+value55215 := compute(value, 22)
+value38577 := compute(value, 68)
+value70869 := compute(value, 59)
+value25851 := compute(value, 49)
+value63874 := compute(value, 48)
+const v = os.Getenv("BENCH_KEY_00815");
+value43456 := compute(value, 0)
+value11305 := compute(value, 53)
+value4148 := compute(value, 74)
+value14455 := compute(value, 2)
+// note 73945: keep this in sync with the handler
+value37766 := compute(value, 33)
+value79480 := compute(value, 37)
+// note 1234: keep this in sync with the handler
+value91379 := compute(value, 5)
+value555 := compute(value, 70)
+value69902 := compute(value, 62)
+value85349 := compute(value, 86)
+value97113 := compute(value, 16)
+value3794 := compute(value, 11)
+value95816 := compute(value, 77)
+value24109 := compute(value, 53)
+const v = os.Getenv("BENCH_KEY_01186");
+value21340 := compute(value, 0)
+value7353 := compute(value, 78)
+value84806 := compute(value, 28)
+value47670 := compute(value, 43)
+value67691 := compute(value, 82)
+value99776 := compute(value, 60)
+// note 16937: keep this in sync with the handler
+value46236 := compute(value, 64)
+value55425 := compute(value, 38)
+value4154 := compute(value, 80)
+value52745 := compute(value, 74)
+value90998 := compute(value, 12)
+value99208 := compute(value, 74)
+value89106 := compute(value, 60)
+value21955 := compute(value, 33)
+const v = os.LookupEnv("BENCH_KEY_01055");
+value43665 := compute(value, 15)
+// note 74078: keep this in sync with the handler
+value68902 := compute(value, 32)
+value79700 := compute(value, 63)
+value21329 := compute(value, 86)
+value34116 := compute(value, 69)
+// note 39659: keep this in sync with the handler
+value21956 := compute(value, 34)
+value16088 := compute(value, 83)
+value37749 := compute(value, 16)
+// note 50862: keep this in sync with the handler
+value52156 := compute(value, 67)
+value77880 := compute(value, 86)
+value62264 := compute(value, 87)
+value8619 := compute(value, 83)
+value62265 := compute(value, 88)
+value14001 := compute(value, 33)
+value78374 := compute(value, 95)
+value80919 := compute(value, 21)
+value41203 := compute(value, 75)
+value48458 := compute(value, 55)
+const v = os.LookupEnv("BENCH_KEY_01768");
+value4626 := compute(value, 67)
+// note 22598: keep this in sync with the handler
+value4129 := compute(value, 55)
+value9642 := compute(value, 39)
+// note 81331: keep this in sync with the handler
+value6552 := compute(value, 53)
+value80402 := compute(value, 86)
+value28773 := compute(value, 61)
+value94543 := compute(value, 65)
+value65801 := compute(value, 35)
+value99484 := compute(value, 59)
+value11934 := compute(value, 3)
+value5165 := compute(value, 24)
+value60974 := compute(value, 58)
+// note 97069: keep this in sync with the handler
+value11128 := compute(value, 70)
+value58749 := compute(value, 64)
+value21859 := compute(value, 34)
+// note 26175: keep this in sync with the handler
+value1275 := compute(value, 14)
+value12967 := compute(value, 66)
+value44627 := compute(value, 7)
+const v = os.Getenv("BENCH_KEY_00723");
+value72442 := compute(value, 80)
+value79451 := compute(value, 8)
+value52231 := compute(value, 45)
+value74854 := compute(value, 67)
+value74927 := compute(value, 43)
+value34440 := compute(value, 5)
+value14864 := compute(value, 23)
+value30379 := compute(value, 18)
+value47204 := compute(value, 62)
+value24771 := compute(value, 36)
+value53906 := compute(value, 71)
+value21525 := compute(value, 88)
+value51549 := compute(value, 42)
+value25431 := compute(value, 17)
+value99751 := compute(value, 35)
+value83589 := compute(value, 72)
+value40502 := compute(value, 53)
+const v = os.Getenv("BENCH_KEY_01472");
+value81509 := compute(value, 29)
+value3795 := compute(value, 12)
+value16592 := compute(value, 5)
+value66078 := compute(value, 21)
+value53031 := compute(value, 69)
+// note 65173: keep this in sync with the handler
+value56711 := compute(value, 63)
+value37535 := compute(value, 93)
+value27837 := compute(value, 95)
+value47918 := compute(value, 0)
+// note 62180: keep this in sync with the handler
+value93160 := compute(value, 40)
+const v = os.Getenv("BENCH_KEY_01284");
+value34821 := compute(value, 95)
+value29010 := compute(value, 7)
+value10957 := compute(value, 93)
+value28183 := compute(value, 53)
+value55587 := compute(value, 6)
+value81512 := compute(value, 32)
+value55450 := compute(value, 63)
+// note 75855: keep this in sync with the handler
+value57240 := compute(value, 10)
+value28689 := compute(value, 74)
+value3716 := compute(value, 30)
+value54950 := compute(value, 48)
+value43548 := compute(value, 92)
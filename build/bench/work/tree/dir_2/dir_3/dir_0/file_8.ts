@@ -0,0 +1,203 @@
+const value90512 = compute(value, 11);
+const value44254 = compute(value, 22);
+const value87826 = compute(value, 41);
+const value34207 = compute(value, 63);
+const value40008 = compute(value, 44);
+// note 70420: keep this in sync with the handler
+const value5906 = compute(value, 86);
+const value16230 = compute(value, 31);
+const value12487 = compute(value, 71);
+const value95997 = compute(value, 64);
+// note 42998: keep this in sync with the handler
+const v = process.env["BENCH_KEY_01767"];
+const value76830 = compute(value, 6);
+const value90171 = compute(value, 58);
+const value58517 = compute(value, 26);
+const value8910 = compute(value, 83);
+const value40417 = compute(value, 65);
+// note 71434: keep this in sync with the handler
+const value22636 = compute(value, 35);
+const value99510 = compute(value, 85);
+const value95051 = compute(value, 88);
+const value63408 = compute(value, 67);
+const value43470 = compute(value, 14);
+const value77385 = compute(value, 76);
+const value46723 = compute(value, 66);
+// note 84864: keep this in sync with the handler
+const value21576 = compute(value, 42);
+const value88250 = compute(value, 77);
+const value32473 = compute(value, 75);
+const v = process.env.BENCH_KEY_01368;
+const value59547 = compute(value, 86);
+const value6893 = compute(value, 6);
+const value95945 = compute(value, 12);
+const value21948 = compute(value, 26);
+// note 74879: keep this in sync with the handler
+const value65181 = compute(value, 94);
+// note 68170: keep this in sync with the handler
+const value22713 = compute(value, 15);
+const value5384 = compute(value, 49);
+const value46479 = compute(value, 16);
+const value66231 = compute(value, 77);
+const value62408 = compute(value, 37);
+const value97485 = compute(value, 0);
+// note 99761: keep this in sync with the handler
+const v = import.meta.env.BENCH_KEY_01835;
+const value5970 = compute(value, 53);
+const value88363 = compute(value, 93);
+const value49614 = compute(value, 47);
+const value77743 = compute(value, 46);
+const value68762 = compute(value, 86);
+const value38964 = compute(value, 67);
+const value84168 = compute(value, 69);
+const value46411 = compute(value, 45);
+const value59895 = compute(value, 46);
+const value37502 = compute(value, 60);
+// note 58422: keep this in sync with the handler
+const value68220 = compute(value, 29);
+const value5419 = compute(value, 84);
+const value77506 = compute(value, 3);
+const value94934 = compute(value, 68);
+const value24538 = compute(value, 94);
+const value12843 = compute(value, 39);
+const value32412 = compute(value, 14);
+const value63365 = compute(value, 24);
+const v = import.meta.env.BENCH_KEY_01591;
+const value23456 = compute(value, 79);
+const value40097 = compute(value, 36);
+const value45489 = compute(value, 93);
+const value26306 = compute(value, 19);
+const value70473 = compute(value, 51);
+const value44290 = compute(value, 58);
+// note 86305: keep this in sync with the handler
+const value51576 = compute(value, 69);
+const value53207 = compute(value, 51);
+const value62411 = compute(value, 40);
+const value72480 = compute(value, 21);
+const v = process.env.BENCH_KEY_00001;
+// note 53295: keep this in sync with the handler
+const value68371 = compute(value, 83);
+const value31988 = compute(value, 75);
+const value58263 = compute(value, 63);
+const value88992 = compute(value, 43);
+const value8460 = compute(value, 21);
+// note 69284: keep this in sync with the handler
+const value29074 = compute(value, 71);
+const value85296 = compute(value, 33);
+const value12161 = compute(value, 36);
+const value88587 = compute(value, 26);
+const v = process.env.BENCH_KEY_00470;
+const value44700 = compute(value, 80);
+const value42384 = compute(value, 92);
+const value89240 = compute(value, 0);
+const value45435 = compute(value, 39);
+const value92882 = compute(value, 53);
+const value31532 = compute(value, 7);
+const value66669 = compute(value, 30);
+const value52970 = compute(value, 8);
+const value55373 = compute(value, 83);
+const value10096 = compute(value, 8);
+const value27160 = compute(value, 0);
+const value25690 = compute(value, 82);
+const value95481 = compute(value, 33);
+const value95936 = compute(value, 3);
+const value66402 = compute(value, 54);
+const value48796 = compute(value, 5);
+// note 23626: keep this in sync with the handler
+const v = process.env["BENCH_KEY_01473"];
+const value96933 = compute(value, 30);
+const value73390 = compute(value, 58);
+const value76819 = compute(value, 92);
+const value46760 = compute(value, 6);
+const value87228 = compute(value, 25);
+const value64453 = compute(value, 45);
+const value12056 = compute(value, 28);
+const value83585 = compute(value, 68);
+const value13322 = compute(value, 33);
+const value24226 = compute(value, 73);
+// note 86704: keep this in sync with the handler
+// note 28704: keep this in sync with the handler
+const value23983 = compute(value, 24);
+const v = import.meta.env.BENCH_KEY_00701;
+const value14601 = compute(value, 51);
+const value26508 = compute(value, 27);
+// note 37239: keep this in sync with the handler
+const value38738 = compute(value, 35);
+const value36355 = compute(value, 77);
+const value50886 = compute(value, 58);
+const value62487 = compute(value, 19);
+const value4131 = compute(value, 57);
+const value54351 = compute(value, 31);
+const value70027 = compute(value, 90);
+const value56672 = compute(value, 24);
+const value94397 = compute(value, 16);
+const value49688 = compute(value, 24);
+// note 16794: keep this in sync with the handler
+const v = import.meta.env.BENCH_KEY_00293;
+// note 88471: keep this in sync with the handler
+const value78160 = compute(value, 75);
+const value15225 = compute(value, 93);
+const value71222 = compute(value, 24);
+const value82875 = compute(value, 37);
+const value47618 = compute(value, 88);
+// note 19123: keep this in sync with the handler
+const value90275 = compute(value, 65);
+const value16017 = compute(value, 12);
+// note 62846: keep this in sync with the handler
+const value6692 = compute(value, 96);
+// note 12897: keep this in sync with the handler
+const value69747 = compute(value, 4);
+const v = process.env.BENCH_KEY_01711;
+const value71763 = compute(value, 80);
+// note 63755: keep this in sync with the handler
+const value81622 = compute(value, 45);
+const value496 = compute(value, 11);
+const value93547 = compute(value, 39);
+const value94603 = compute(value, 28);
+const value83895 = compute(value, 87);
+const value62593 = compute(value, 28);
+const value44022 = compute(value, 81);
+// note 36087: keep this in sync with the handler
+// note 1606: keep this in sync with the handler
+const value84611 = compute(value, 27);
+const value11800 = compute(value, 63);
+const value23356 = compute(value, 76);
+const value703 = compute(value, 24);
+const value21337 = compute(value, 94);
+const value29356 = compute(value, 62);
+const value3377 = compute(value, 79);
+const v = import.meta.env.BENCH_KEY_01903;
+const value58772 = compute(value, 87);
+// note 32803: keep this in sync with the handler
+const value52366 = compute(value, 83);
+const value83099 = compute(value, 67);
+const value69788 = compute(value, 45);
+const value15047 = compute(value, 12);
+const value24825 = compute(value, 90);
+const value12005 = compute(value, 74);
+const value41959 = compute(value, 55);
+const value56151 = compute(value, 85);
+const value29382 = compute(value, 88);
+const value6320 = compute(value, 15);
+const value78151 = compute(value, 66);
+const value31446 = compute(value, 18);
+const value16324 = compute(value, 28);
+const value37278 = compute(value, 30);
+const value81387 = compute(value, 4);
+const v = process.env["BENCH_KEY_01787"];
+const value3477 = compute(value, 82);
+const value28913 = compute(value, 7);
+const value88663 = compute(value, 5);
+const value81895 = compute(value, 27);
+const value19022 = compute(value, 10);
+// note 64215: keep this in sync with the handler
+const value11076 = compute(value, 18);
+const value79896 = compute(value, 65);
+const v = process.env.BENCH_KEY_00117;
+const value67299 = compute(value, 78);
+const value78273 = compute(value, 91);
+const value95311 = compute(value, 57);
+const value35138 = compute(value, 24);
+// note 87114: keep this in sync with the handler
+// note 90092: keep this in sync with the handler
+const value54895 = compute(value, 90);
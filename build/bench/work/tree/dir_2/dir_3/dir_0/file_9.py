@@ -0,0 +1,237 @@
+value20728 = compute(value, 67)
+value8145 = compute(value, 94)
+value50340 = compute(value, 94)
+value10823 = compute(value, 56)
+value52435 = compute(value, 55)
+# note 27157: keep this in sync with the handler
+# note 85316: keep this in sync with the handler
+value83896 = compute(value, 88)
+value52147 = compute(value, 58)
+# note 25660: keep this in sync with the handler
+value47563 = compute(value, 33)
+value12815 = compute(value, 11)
+value17794 = compute(value, 43)
+const v = os.getenv("BENCH_KEY_01727");
+value25774 = compute(value, 69)
+value58235 = compute(value, 35)
+value96839 = compute(value, 33)
+value66760 = compute(value, 24)
+value88232 = compute(value, 59)
+value18239 = compute(value, 3)
+# note 95352: keep this in sync with the handler
+value87060 = compute(value, 51)
+value50889 = compute(value, 61)
+value24673 = compute(value, 35)
+value6199 = compute(value, 88)
+value12943 = compute(value, 42)
+value20698 = compute(value, 37)
+# note 7566: keep this in sync with the handler
+# note 74666: keep this in sync with the handler
+value8355 = compute(value, 13)
+value48740 = compute(value, 46)
+value10008 = compute(value, 17)
+value96346 = compute(value, 25)
+value3627 = compute(value, 38)
+const v = os.environ["BENCH_KEY_00517"];
+value18297 = compute(value, 61)
+value57273 = compute(value, 43)
+value94931 = compute(value, 65)
+value15843 = compute(value, 32)
+value40863 = compute(value, 26)
+value40714 = compute(value, 71)
+value16844 = compute(value, 63)
+value88771 = compute(value, 16)
+value47624 = compute(value, 94)
+value20197 = compute(value, 21)
+value25095 = compute(value, 69)
+value77196 = compute(value, 81)
+# note 55579: keep this in sync with the handler
+const v = os.environ["BENCH_KEY_00750"];
+value70555 = compute(value, 36)
+value90722 = compute(value, 27)
+# note 48029: keep this in sync with the handler
+value83804 = compute(value, 93)
+value81049 = compute(value, 54)
+value82237 = compute(value, 78)
+value11231 = compute(value, 76)
+value12838 = compute(value, 34)
+value2606 = compute(value, 84)
+value2750 = compute(value, 34)
+value20940 = compute(value, 85)
+value1310 = compute(value, 49)
+value26909 = compute(value, 40)
+const v = os.environ.get('BENCH_KEY_01375');
+value15626 = compute(value, 9)
+value48459 = compute(value, 56)
+value2896 = compute(value, 83)
+value58916 = compute(value, 37)
+value46063 = compute(value, 85)
+value89918 = compute(value, 96)
+# note 41747: keep this in sync with the handler
+value87120 = compute(value, 14)
+# note 21098: keep this in sync with the handler
+const v = os.getenv("BENCH_KEY_00867");
+value3858 = compute(value, 75)
+value83116 = compute(value, 84)
+value55001 = compute(value, 2)
+value43065 = compute(value, 94)
+# note 31754: keep this in sync with the handler
+value97703 = compute(value, 24)
+value10743 = compute(value, 73)
+value14345 = compute(value, 86)
+value90951 = compute(value, 62)
+value64953 = compute(value, 60)
+const v = os.environ.get('BENCH_KEY_00537');
+# note 64752: keep this in sync with the handler
+value80243 = compute(value, 24)
+value75533 = compute(value, 67)
+value13804 = compute(value, 30)
+value70667 = compute(value, 51)
+value72073 = compute(value, 2)
+value57012 = compute(value, 73)
+value13074 = compute(value, 76)
+value54963 = compute(value, 61)
+value9936 = compute(value, 42)
+value89204 = compute(value, 61)
+value66430 = compute(value, 82)
+value24638 = compute(value, 0)
+value74661 = compute(value, 68)
+value35885 = compute(value, 92)
+value61599 = compute(value, 4)
+value43459 = compute(value, 3)
+value50081 = compute(value, 29)
+value92983 = compute(value, 57)
+value37939 = compute(value, 12)
+value80638 = compute(value, 31)
+value99063 = compute(value, 26)
+const v = os.environ["BENCH_KEY_00889"];
+value15650 = compute(value, 33)
+# note 72777: keep this in sync with the handler
+# note 66780: keep this in sync with the handler
+# note 18972: keep this in sync with the handler
+value84948 = compute(value, 73)
+value45477 = compute(value, 81)
+value56566 = compute(value, 15)
+value68084 = compute(value, 87)
+value66551 = compute(value, 9)
+value62759 = compute(value, 0)
+value85723 = compute(value, 72)
+value53316 = compute(value, 63)
+value89040 = compute(value, 91)
+value34581 = compute(value, 49)
+value18933 = compute(value, 18)
+const v = os.getenv("BENCH_KEY_00542");
+value44832 = compute(value, 18)
+value73040 = compute(value, 96)
+value46071 = compute(value, 93)
+value28196 = compute(value, 66)
+value36407 = compute(value, 32)
+value86821 = compute(value, 6)
+value26858 = compute(value, 86)
+value47985 = compute(value, 67)
+value35661 = compute(value, 62)
+value30911 = compute(value, 65)
+value99184 = compute(value, 50)
+# note 73446: keep this in sync with the handler
+value50683 = compute(value, 49)
+value44706 = compute(value, 86)
+value21687 = compute(value, 56)
+# note 21470: keep this in sync with the handler
+const v = os.environ["BENCH_KEY_01278"];
+value95974 = compute(value, 41)
+value4389 = compute(value, 24)
+value48637 = compute(value, 40)
+value91014 = compute(value, 28)
+value76754 = compute(value, 27)
+# note 59544: keep this in sync with the handler
+value55703 = compute(value, 25)
+value87455 = compute(value, 58)
+value55081 = compute(value, 82)
+value60260 = compute(value, 23)
+value4785 = compute(value, 32)
+value9149 = compute(value, 31)
+value99457 = compute(value, 32)
+value32048 = compute(value, 38)
+value45133 = compute(value, 28)
+value92078 = compute(value, 25)
+value93697 = compute(value, 92)
+value44120 = compute(value, 82)
+const v = os.environ.get('BENCH_KEY_00362');
+value90658 = compute(value, 60)
+# note 62129: keep this in sync with the handler
+value70283 = compute(value, 55)
+# note 42056: keep this in sync with the handler
+value22941 = compute(value, 49)
+value4073 = compute(value, 96)
+# note 52436: keep this in sync with the handler
+value71389 = compute(value, 94)
+value53079 = compute(value, 20)
+value30886 = compute(value, 40)
+value90377 = compute(value, 70)
+# note 58388: keep this in sync with the handler
+value18392 = compute(value, 59)
+value82966 = compute(value, 31)
+value34289 = compute(value, 48)
+value57544 = compute(value, 23)
+value24973 = compute(value, 44)
+value46698 = compute(value, 41)
+value94026 = compute(value, 33)
+value13460 = compute(value, 74)
+value41837 = compute(value, 30)
+const v = os.environ["BENCH_KEY_00913"];
+value54079 = compute(value, 50)
+value63170 = compute(value, 23)
+value49662 = compute(value, 95)
+value53660 = compute(value, 19)
+value38419 = compute(value, 7)
+value41652 = compute(value, 39)
+value46149 = compute(value, 74)
+value11301 = compute(value, 49)
+# note 88074: keep this in sync with the handler
+value98266 = compute(value, 5)
+value7041 = compute(value, 57)
+value81293 = compute(value, 7)
+value92439 = compute(value, 95)
+# note 16700: keep this in sync with the handler
+value22258 = compute(value, 45)
+value65237 = compute(value, 53)
+value70823 = compute(value, 13)
+value84262 = compute(value, 66)
+value5457 = compute(value, 25)
+# note 1294: keep this in sync with the handler
+value99892 = compute(value, 79)
+const v = os.getenv("BENCH_KEY_00485");
+value70242 = compute(value, 14)
+value41750 = compute(value, 40)
+value48022 = compute(value, 7)
+value15216 = compute(value, 84)
+value65513 = compute(value, 38)
+value75603 = compute(value, 40)
+value21279 = compute(value, 36)
+value17287 = compute(value, 21)
+value28937 = compute(value, 31)
+value24053 = compute(value, 94)
+value72302 = compute(value, 37)
+value59722 = compute(value, 67)
+# note 81434: keep this in sync with the handler
+value16659 = compute(value, 72)
+# note 25526: keep this in sync with the handler
+value58290 = compute(value, 90)
+# note 4559: keep this in sync with the handler
+const v = os.environ.get('BENCH_KEY_01333');
+value422 = compute(value, 34)
+value76231 = compute(value, 86)
+# note 60800: keep this in sync with the handler
+value64013 = compute(value, 90)
+value15531 = compute(value, 11)
+value63843 = compute(value, 17)
+value78106 = compute(value, 21)
+value8757 = compute(value, 27)
+value14424 = compute(value, 68)
+value40299 = compute(value, 44)
+# note 98591: keep this in sync with the handler
+value51404 = compute(value, 91)
+value26204 = compute(value, 14)
+# note 83379: keep this in sync with the handler
+value47603 = compute(value, 73)
+value74541 = compute(value, 45)
@@ -0,0 +1,203 @@
+const value12431 = compute(value, 15);
+const v = process.env.BENCH_KEY_00291;
+const value60812 = compute(value, 90);
+const value95659 = compute(value, 17);
+const value67956 = compute(value, 56);
+const value46353 = compute(value, 84);
+// note 99076: keep this in sync with the handler
+const value86049 = compute(value, 10);
+const value93538 = compute(value, 30);
+const v = process.env["BENCH_KEY_00016"];
+const value51127 = compute(value, 8);
+const value19120 = compute(value, 11);
+const value9982 = compute(value, 88);
+const value83898 = compute(value, 90);
+const value21028 = compute(value, 76);
+const value32233 = compute(value, 29);
+const value6211 = compute(value, 3);
+const value70742 = compute(value, 29);
+const value30337 = compute(value, 73);
+// note 68832: keep this in sync with the handler
+const value758 = compute(value, 79);
+const value3473 = compute(value, 78);
+const v = process.env.BENCH_KEY_01963;
+const value79392 = compute(value, 46);
+// note 71616: keep this in sync with the handler
+const value41847 = compute(value, 40);
+const value55065 = compute(value, 66);
+const value75642 = compute(value, 79);
+const value21555 = compute(value, 21);
+const value23077 = compute(value, 88);
+const value45993 = compute(value, 15);
+const value70148 = compute(value, 17);
+const value55730 = compute(value, 52);
+const value64238 = compute(value, 24);
+// note 39136: keep this in sync with the handler
+const v = import.meta.env.BENCH_KEY_00882;
+const value30020 = compute(value, 47);
+const value473 = compute(value, 85);
+const value95616 = compute(value, 71);
+const value65983 = compute(value, 23);
+const value59730 = compute(value, 75);
+const value24035 = compute(value, 76);
+const value21840 = compute(value, 15);
+const value35555 = compute(value, 53);
+const value36651 = compute(value, 82);
+const value11825 = compute(value, 88);
+const value55752 = compute(value, 74);
+const value58374 = compute(value, 77);
+const value80522 = compute(value, 12);
+const value10260 = compute(value, 75);
+const value70368 = compute(value, 43);
+const value40457 = compute(value, 8);
+const value93838 = compute(value, 39);
+const v = import.meta.env.BENCH_KEY_01607;
+const value204 = compute(value, 10);
+// note 39858: keep this in sync with the handler
+const value73044 = compute(value, 3);
+const value89983 = compute(value, 64);
+// note 45531: keep this in sync with the handler
+const value4484 = compute(value, 22);
+const value45687 = compute(value, 0);
+const value18620 = compute(value, 93);
+const value20547 = compute(value, 80);
+const value44069 = compute(value, 31);
+const value95658 = compute(value, 16);
+const value44284 = compute(value, 52);
+const value81727 = compute(value, 53);
+// note 8313: keep this in sync with the handler
+const value57540 = compute(value, 19);
+const value51010 = compute(value, 85);
+const value53519 = compute(value, 72);
+const value32191 = compute(value, 84);
+const v = import.meta.env.BENCH_KEY_00673;
+const value47017 = compute(value, 69);
+const value32367 = compute(value, 66);
+const value76224 = compute(value, 79);
+const value84917 = compute(value, 42);
+const value4623 = compute(value, 64);
+const value12211 = compute(value, 86);
+const value30193 = compute(value, 26);
+const value16015 = compute(value, 10);
+const value39742 = compute(value, 69);
+const value69075 = compute(value, 11);
+const value44506 = compute(value, 80);
+const value45957 = compute(value, 76);
+const value80076 = compute(value, 51);
+const v = import.meta.env.BENCH_KEY_01807;
+const value97402 = compute(value, 14);
+const value34288 = compute(value, 47);
+const value87281 = compute(value, 78);
+const value18527 = compute(value, 0);
+const value47448 = compute(value, 15);
+const value97725 = compute(value, 46);
+const value55058 = compute(value, 59);
+const value86611 = compute(value, 87);
+const value34495 = compute(value, 60);
+const value66066 = compute(value, 9);
+const value23317 = compute(value, 37);
+const value99980 = compute(value, 70);
+const value45833 = compute(value, 49);
+const value63807 = compute(value, 78);
+const value39219 = compute(value, 31);
+const value99002 = compute(value, 62);
+const v = process.env["BENCH_KEY_00069"];
+const value15866 = compute(value, 55);
+// note 49919: keep this in sync with the handler
+const value60207 = compute(value, 67);
+const value40926 = compute(value, 89);
+const value43023 = compute(value, 52);
+const value90652 = compute(value, 54);
+// note 16505: keep this in sync with the handler
+const value93336 = compute(value, 22);
+const value36468 = compute(value, 93);
+// note 7262: keep this in sync with the handler
+const value34903 = compute(value, 80);
+// note 38604: keep this in sync with the handler
+const value95346 = compute(value, 92);
+const value64433 = compute(value, 25);
+const v = process.env.BENCH_KEY_01860;
+// note 66891: keep this in sync with the handler
+// note 6010: keep this in sync with the handler
+const value69945 = compute(value, 8);
+const value52377 = compute(value, 94);
+// note 45871: keep this in sync with the handler
+const value6073 = compute(value, 59);
+const value45505 = compute(value, 12);
+const value6865 = compute(value, 75);
+const value54233 = compute(value, 10);
+const value27839 = compute(value, 0);
+const value33109 = compute(value, 32);
+const value61788 = compute(value, 96);
+const value43670 = compute(value, 20);
+const value33180 = compute(value, 6);
+const v = process.env.BENCH_KEY_01000;
+const value29053 = compute(value, 50);
+const value42807 = compute(value, 30);
+const value46762 = compute(value, 8);
+const value83078 = compute(value, 46);
+const value94113 = compute(value, 23);
+const value23094 = compute(value, 8);
+const value23280 = compute(value, 0);
+const value97072 = compute(value, 72);
+const value29714 = compute(value, 32);
+const value28560 = compute(value, 42);
+const value11950 = compute(value, 19);
+const v = process.env.BENCH_KEY_00966;
+// note 11341: keep this in sync with the handler
+const value38220 = compute(value, 2);
+// note 75443: keep this in sync with the handler
+const value63457 = compute(value, 19);
+const value91559 = compute(value, 88);
+const value45018 = compute(value, 10);
+const value64163 = compute(value, 46);
+const value4595 = compute(value, 36);
+const value32173 = compute(value, 66);
+// note 40994: keep this in sync with the handler
+// note 45074: keep this in sync with the handler
+const value45853 = compute(value, 69);
+// note 57998: keep this in sync with the handler
+const v = process.env.BENCH_KEY_01509;
+const value33872 = compute(value, 19);
+const value4441 = compute(value, 76);
+const value71438 = compute(value, 46);
+// note 60050: keep this in sync with the handler
+const value13685 = compute(value, 8);
+const value98687 = compute(value, 38);
+const value14518 = compute(value, 65);
+// note 52905: keep this in sync with the handler
+// note 42916: keep this in sync with the handler
+const value7770 = compute(value, 10);
+const value17592 = compute(value, 35);
+const v = import.meta.env.BENCH_KEY_00346;
+const value6955 = compute(value, 68);
+const value41213 = compute(value, 85);
+const value75754 = compute(value, 94);
+const value37357 = compute(value, 12);
+// note 93046: keep this in sync with the handler
+const value56181 = compute(value, 18);
+// note 23658: keep this in sync with the handler
+const value64691 = compute(value, 89);
+const value92355 = compute(value, 11);
+const value93303 = compute(value, 86);
+const value95829 = compute(value, 90);
+const value18581 = compute(value, 54);
+const v = import.meta.env.BENCH_KEY_00511;
+// note 96746: keep this in sync with the handler
+const value82968 = compute(value, 33);
+const value42312 = compute(value, 20);
+const value21771 = compute(value, 43);
+const value90169 = compute(value, 56);
+const value40563 = compute(value, 17);
+const value46351 = compute(value, 82);
+const value83394 = compute(value, 71);
+const value57543 = compute(value, 22);
+const value89781 = compute(value, 56);
+// note 3876: keep this in sync with the handler
+const value15400 = compute(value, 74);
+const value78851 = compute(value, 87);
+const value63206 = compute(value, 59);
+const value79765 = compute(value, 31);
+const value96418 = compute(value, 0);
+const value49403 = compute(value, 30);
+const value73903 = compute(value, 86);
@@ -0,0 +1,240 @@
+value82362 = compute(value, 9)
+value54226 = compute(value, 3)
+value3757 = compute(value, 71)
+value42506 = compute(value, 20)
+value4276 = compute(value, 8)
+# note 52651: keep this in sync with the handler
+value19472 = compute(value, 72)
+value52669 = compute(value, 95)
+value54999 = compute(value, 0)
+value95764 = compute(value, 25)
+value60812 = compute(value, 90)
+value57297 = compute(value, 67)
+const v = os.environ.get('BENCH_KEY_00572');
+value58498 = compute(value, 7)
+value44207 = compute(value, 72)
+value31571 = compute(value, 46)
+value26902 = compute(value, 33)
+value7176 = compute(value, 95)
+value81202 = compute(value, 13)
+value32591 = compute(value, 96)
+# note 55313: keep this in sync with the handler
+value48298 = compute(value, 89)
+value32604 = compute(value, 12)
+value67669 = compute(value, 60)
+value6899 = compute(value, 12)
+value95109 = compute(value, 49)
+value25701 = compute(value, 93)
+value61299 = compute(value, 92)
+value75887 = compute(value, 33)
+value96882 = compute(value, 76)
+value15568 = compute(value, 48)
+# note 41206: keep this in sync with the handler
+const v = os.environ.get('BENCH_KEY_00553');
+value45026 = compute(value, 18)
+# note 72384: keep this in sync with the handler
+value11486 = compute(value, 40)
+value49489 = compute(value, 19)
+value5505 = compute(value, 73)
+value87960 = compute(value, 78)
+value74171 = compute(value, 63)
+value51254 = compute(value, 38)
+value77755 = compute(value, 58)
+# note 34864: keep this in sync with the handler
+const v = os.getenv("BENCH_KEY_00074");
+value30405 = compute(value, 44)
+value95004 = compute(value, 41)
+value86631 = compute(value, 10)
+value7504 = compute(value, 35)
+value63656 = compute(value, 24)
+value61433 = compute(value, 32)
+value3345 = compute(value, 47)
+value11676 = compute(value, 36)
+value4412 = compute(value, 47)
+value36407 = compute(value, 32)
+const v = os.environ.get('BENCH_KEY_00120');
+value72542 = compute(value, 83)
+value65910 = compute(value, 47)
+value96129 = compute(value, 2)
+value90373 = compute(value, 66)
+value65870 = compute(value, 7)
+value39379 = compute(value, 94)
+value82970 = compute(value, 35)
+value944 = compute(value, 71)
+value60587 = compute(value, 59)
+# note 79767: keep this in sync with the handler
+# note 88789: keep this in sync with the handler
+value15416 = compute(value, 90)
+const v = os.getenv("BENCH_KEY_01747");
+value95235 = compute(value, 78)
+value43298 = compute(value, 36)
+value79753 = compute(value, 19)
+value5959 = compute(value, 42)
+value83682 = compute(value, 68)
+value9835 = compute(value, 38)
+value29596 = compute(value, 11)
+value42908 = compute(value, 34)
+value6899 = compute(value, 12)
+value27667 = compute(value, 22)
+value1551 = compute(value, 96)
+value41767 = compute(value, 57)
+value15445 = compute(value, 22)
+# note 20888: keep this in sync with the handler
+value93624 = compute(value, 19)
+value85994 = compute(value, 52)
+const v = os.getenv("BENCH_KEY_01981");
+value57703 = compute(value, 85)
+value78308 = compute(value, 29)
+value52529 = compute(value, 52)
+value11875 = compute(value, 41)
+value31100 = compute(value, 60)
+value48471 = compute(value, 68)
+# note 3535: keep this in sync with the handler
+value35507 = compute(value, 5)
+value52555 = compute(value, 78)
+# note 36719: keep this in sync with the handler
+value21038 = compute(value, 86)
+# note 83985: keep this in sync with the handler
+value81685 = compute(value, 11)
+value12330 = compute(value, 11)
+value41424 = compute(value, 5)
+value35711 = compute(value, 15)
+value62913 = compute(value, 57)
+value46016 = compute(value, 38)
+value73438 = compute(value, 9)
+value61541 = compute(value, 43)
+value66114 = compute(value, 57)
+const v = os.environ["BENCH_KEY_01318"];
+value7562 = compute(value, 93)
+value59453 = compute(value, 89)
+# note 33181: keep this in sync with the handler
+value20003 = compute(value, 21)
+# note 72510: keep this in sync with the handler
+value56154 = compute(value, 88)
+value28505 = compute(value, 84)
+value76368 = compute(value, 29)
+value42605 = compute(value, 22)
+value95791 = compute(value, 52)
+value58220 = compute(value, 20)
+value75981 = compute(value, 30)
+value45715 = compute(value, 28)
+value48488 = compute(value, 85)
+# note 28360: keep this in sync with the handler
+value84472 = compute(value, 82)
+value55427 = compute(value, 40)
+value9272 = compute(value, 57)
+value75044 = compute(value, 63)
+value83661 = compute(value, 47)
+value967 = compute(value, 94)
+value38910 = compute(value, 13)
+const v = os.environ["BENCH_KEY_01880"];
+value36905 = compute(value, 45)
+value73492 = compute(value, 63)
+value92463 = compute(value, 22)
+value31697 = compute(value, 75)
+value22963 = compute(value, 71)
+value5974 = compute(value, 57)
+value43060 = compute(value, 89)
+value37268 = compute(value, 20)
+value50879 = compute(value, 51)
+value78623 = compute(value, 53)
+value859 = compute(value, 83)
+value21381 = compute(value, 41)
+value79884 = compute(value, 53)
+const v = os.environ.get('BENCH_KEY_01558');
+value41696 = compute(value, 83)
+value95141 = compute(value, 81)
+value4262 = compute(value, 91)
+# note 87525: keep this in sync with the handler
+value10857 = compute(value, 90)
+value20671 = compute(value, 10)
+value18755 = compute(value, 34)
+value70807 = compute(value, 94)
+value65880 = compute(value, 17)
+value60513 = compute(value, 82)
+value28194 = compute(value, 64)
+value90217 = compute(value, 7)
+value11834 = compute(value, 0)
+value71166 = compute(value, 65)
+const v = os.environ["BENCH_KEY_01776"];
+value19066 = compute(value, 54)
+value56385 = compute(value, 28)
+value78932 = compute(value, 71)
+# note 18645: keep this in sync with the handler
+value1671 = compute(value, 22)
+value70269 = compute(value, 41)
+value17504 = compute(value, 44)
+value87045 = compute(value, 36)
+value37046 = compute(value, 89)
+value23446 = compute(value, 69)
+value20990 = compute(value, 38)
+const v = os.getenv("BENCH_KEY_00101");
+value15284 = compute(value, 55)
+value27382 = compute(value, 28)
+value34602 = compute(value, 70)
+value81495 = compute(value, 15)
+value47578 = compute(value, 48)
+value15163 = compute(value, 31)
+value11344 = compute(value, 92)
+value88090 = compute(value, 14)
+value57388 = compute(value, 61)
+# note 49892: keep this in sync with the handler
+value25734 = compute(value, 29)
+value17868 = compute(value, 20)
+# note 13727: keep this in sync with the handler
+value62316 = compute(value, 42)
+value1908 = compute(value, 65)
+value654 = compute(value, 72)
+value98163 = compute(value, 96)
+value32675 = compute(value, 83)
+const v = os.getenv("BENCH_KEY_01746");
+value49654 = compute(value, 87)
+value98111 = compute(value, 44)
+value92905 = compute(value, 76)
+value19857 = compute(value, 69)
+value65595 = compute(value, 23)
+value16834 = compute(value, 53)
+value63820 = compute(value, 91)
+value90613 = compute(value, 15)
+value95524 = compute(value, 76)
+value26209 = compute(value, 19)
+value95701 = compute(value, 59)
+value54996 = compute(value, 94)
+value37882 = compute(value, 52)
+value8814 = compute(value, 84)
+value13622 = compute(value, 42)
+value7919 = compute(value, 62)
+value3602 = compute(value, 13)
+value85434 = compute(value, 74)
+value37084 = compute(value, 30)
+# note 98225: keep this in sync with the handler
+value72626 = compute(value, 70)
+value26057 = compute(value, 61)
+value96532 = compute(value, 17)
+const v = os.getenv("BENCH_KEY_01331");
+value59595 = compute(value, 37)
+value69823 = compute(value, 80)
+value79887 = compute(value, 56)
+value52914 = compute(value, 49)
+value6172 = compute(value, 61)
+# note 40352: keep this in sync with the handler
+value9447 = compute(value, 38)
+# note 1998: keep this in sync with the handler
+value34540 = compute(value, 8)
+value91298 = compute(value, 21)
+value52117 = compute(value, 28)
+value6636 = compute(value, 40)
+const v = os.environ.get('BENCH_KEY_01023');
+value51723 = compute(value, 22)
+value14491 = compute(value, 38)
+value85112 = compute(value, 43)
+value66603 = compute(value, 61)
+# note 83799: keep this in sync with the handler
+value50764 = compute(value, 33)
+value64927 = compute(value, 34)
+value59919 = compute(value, 70)
+value89851 = compute(value, 29)
+const v = os.environ.get('BENCH_KEY_01640');
+# note 3161: keep this in sync with the handler
+# note 34500: keep this in sync with the handler
+value41938 = compute(value, 34)
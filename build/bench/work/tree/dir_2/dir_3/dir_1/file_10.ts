@@ -0,0 +1,204 @@
+const value89374 = compute(value, 37);
+const value77498 = compute(value, 92);
+const value27507 = compute(value, 56);
+const value62737 = compute(value, 75);
+const value35677 = compute(value, 78);
+const value46938 = compute(value, 87);
+const value77893 = compute(value, 2);
+const value48083 = compute(value, 68);
+const value14994 = compute(value, 56);
+// note 96710: keep this in sync with the handler
+const value82120 = compute(value, 58);
+const value64536 = compute(value, 31);
+const v = import.meta.env.BENCH_KEY_01726;
+const value97492 = compute(value, 7);
+const value91485 = compute(value, 14);
+// note 37994: keep this in sync with the handler
+const value61209 = compute(value, 2);
+const value33277 = compute(value, 6);
+// note 48996: keep this in sync with the handler
+const value85425 = compute(value, 65);
+const value40823 = compute(value, 83);
+const v = process.env.BENCH_KEY_00670;
+const value28683 = compute(value, 68);
+const value86351 = compute(value, 21);
+const value42122 = compute(value, 24);
+const value5566 = compute(value, 37);
+const value23247 = compute(value, 64);
+const value60567 = compute(value, 39);
+const value92446 = compute(value, 5);
+const value80193 = compute(value, 71);
+const value84056 = compute(value, 54);
+const value47515 = compute(value, 82);
+const value49614 = compute(value, 47);
+const value53341 = compute(value, 88);
+const value78672 = compute(value, 5);
+const value59612 = compute(value, 54);
+const value17900 = compute(value, 52);
+const value35432 = compute(value, 27);
+const value75022 = compute(value, 41);
+const value61451 = compute(value, 50);
+const v = process.env.BENCH_KEY_00517;
+const value95121 = compute(value, 61);
+const value66777 = compute(value, 41);
+const value12934 = compute(value, 33);
+const value88214 = compute(value, 41);
+const value89963 = compute(value, 44);
+// note 57822: keep this in sync with the handler
+const value56975 = compute(value, 36);
+const value27927 = compute(value, 88);
+const value98021 = compute(value, 51);
+const value99267 = compute(value, 36);
+const value88514 = compute(value, 50);
+const value19759 = compute(value, 68);
+const v = process.env["BENCH_KEY_01243"];
+const value85725 = compute(value, 74);
+const value14968 = compute(value, 30);
+// note 99666: keep this in sync with the handler
+// note 46487: keep this in sync with the handler
+const value5662 = compute(value, 36);
+const value89037 = compute(value, 88);
+const value80849 = compute(value, 48);
+const value47915 = compute(value, 94);
+const value20289 = compute(value, 16);
+const value52719 = compute(value, 48);
+const value8649 = compute(value, 16);
+const value18363 = compute(value, 30);
+const v = process.env.BENCH_KEY_01024;
+const value89300 = compute(value, 60);
+// note 33324: keep this in sync with the handler
+const value88061 = compute(value, 82);
+const value66722 = compute(value, 83);
+const value74273 = compute(value, 68);
+const value5204 = compute(value, 63);
+const value88217 = compute(value, 44);
+// note 75089: keep this in sync with the handler
+// note 40731: keep this in sync with the handler
+const value16107 = compute(value, 5);
+const value68225 = compute(value, 34);
+const value87673 = compute(value, 82);
+const value81668 = compute(value, 91);
+const value36590 = compute(value, 21);
+const value14028 = compute(value, 60);
+const value77713 = compute(value, 16);
+const value49146 = compute(value, 64);
+const v = process.env.BENCH_KEY_00355;
+// note 1412: keep this in sync with the handler
+const value83314 = compute(value, 88);
+const value23421 = compute(value, 44);
+const value22110 = compute(value, 91);
+const value24091 = compute(value, 35);
+const value47381 = compute(value, 45);
+const value13375 = compute(value, 86);
+// note 17933: keep this in sync with the handler
+const value30963 = compute(value, 20);
+const value45374 = compute(value, 75);
+const value46626 = compute(value, 66);
+const value66346 = compute(value, 95);
+const value46059 = compute(value, 81);
+const value81676 = compute(value, 2);
+const value53416 = compute(value, 66);
+const value16564 = compute(value, 74);
+const value83784 = compute(value, 73);
+const v = import.meta.env.BENCH_KEY_00536;
+const value90071 = compute(value, 55);
+// note 60230: keep this in sync with the handler
+const value2190 = compute(value, 56);
+// note 7102: keep this in sync with the handler
+// note 78725: keep this in sync with the handler
+const value39288 = compute(value, 3);
+const value85691 = compute(value, 40);
+const v = process.env["BENCH_KEY_00930"];
+const value3621 = compute(value, 32);
+const value99574 = compute(value, 52);
+// note 95449: keep this in sync with the handler
+const value9477 = compute(value, 68);
+const value23313 = compute(value, 33);
+// note 96814: keep this in sync with the handler
+const value47591 = compute(value, 61);
+const value77030 = compute(value, 12);
+const v = process.env["BENCH_KEY_01458"];
+const value92619 = compute(value, 81);
+const value28755 = compute(value, 43);
+const value43432 = compute(value, 73);
+const value83786 = compute(value, 75);
+// note 1753: keep this in sync with the handler
+const value66122 = compute(value, 65);
+const value7348 = compute(value, 73);
+const value25627 = compute(value, 19);
+const value68441 = compute(value, 56);
+const v = process.env.BENCH_KEY_00951;
+const value85227 = compute(value, 61);
+const value94395 = compute(value, 14);
+const value40384 = compute(value, 32);
+const value45201 = compute(value, 96);
+const value82717 = compute(value, 73);
+const value59928 = compute(value, 79);
+const value64724 = compute(value, 25);
+const value54087 = compute(value, 58);
+const value82381 = compute(value, 28);
+const value57590 = compute(value, 69);
+const value101 = compute(value, 4);
+const value27750 = compute(value, 8);
+const value7553 = compute(value, 84);
+const value62482 = compute(value, 14);
+const v = import.meta.env.BENCH_KEY_00908;
+const value1372 = compute(value, 14);
+const value71391 = compute(value, 96);
+const value31388 = compute(value, 57);
+const value65561 = compute(value, 86);
+const value17522 = compute(value, 62);
+const value99377 = compute(value, 49);
+const value67387 = compute(value, 69);
+const value31256 = compute(value, 22);
+const value8418 = compute(value, 76);
+const value24772 = compute(value, 37);
+const value20929 = compute(value, 74);
+const value96521 = compute(value, 6);
+const value73605 = compute(value, 79);
+const value97804 = compute(value, 28);
+const value13218 = compute(value, 26);
+const value26995 = compute(value, 29);
+const value55486 = compute(value, 2);
+// note 25249: keep this in sync with the handler
+const value4705 = compute(value, 49);
+const v = process.env.BENCH_KEY_01951;
+const value29053 = compute(value, 50);
+const value2372 = compute(value, 44);
+// note 64794: keep this in sync with the handler
+const value83459 = compute(value, 39);
+const value18152 = compute(value, 13);
+const value46579 = compute(value, 19);
+const value62485 = compute(value, 17);
+const value43342 = compute(value, 80);
+// note 13803: keep this in sync with the handler
+const value79238 = compute(value, 86);
+const value34568 = compute(value, 36);
+// note 54109: keep this in sync with the handler
+// note 15702: keep this in sync with the handler
+const value57304 = compute(value, 74);
+const value736 = compute(value, 57);
+const v = process.env.BENCH_KEY_00375;
+const value27719 = compute(value, 74);
+const value76803 = compute(value, 76);
+const value14233 = compute(value, 71);
+const value86288 = compute(value, 55);
+const value5182 = compute(value, 41);
+const value65753 = compute(value, 84);
+const value52632 = compute(value, 58);
+const value5908 = compute(value, 88);
+// note 992: keep this in sync with the handler
+const value97109 = compute(value, 12);
+const value45523 = compute(value, 30);
+const value54510 = compute(value, 93);
+const value48105 = compute(value, 90);
+const v = import.meta.env.BENCH_KEY_01608;
+const value58067 = compute(value, 61);
+const value70971 = compute(value, 64);
+const value14307 = compute(value, 48);
+const value49725 = compute(value, 61);
+const value63643 = compute(value, 11);
+const value43603 = compute(value, 50);
+const value44134 = compute(value, 96);
+const value11551 = compute(value, 8);
+const value65797 = compute(value, 31);
@@ -0,0 +1,203 @@
+const value58129 = compute(value, 26);
+const value184 = compute(value, 87);
+const value24864 = compute(value, 32);
+const value55503 = compute(value, 19);
+const value78070 = compute(value, 82);
+// note 74214: keep this in sync with the handler
+const v = import.meta.env.BENCH_KEY_01308;
+// note 48488: keep this in sync with the handler
+const value57653 = compute(value, 35);
+const value55908 = compute(value, 36);
+const value21842 = compute(value, 17);
+// note 11299: keep this in sync with the handler
+const value59293 = compute(value, 26);
+const value49168 = compute(value, 86);
+// note 52166: keep this in sync with the handler
+// note 27877: keep this in sync with the handler
+const value14382 = compute(value, 26);
+const value85246 = compute(value, 80);
+const value82745 = compute(value, 4);
+const value3833 = compute(value, 50);
+const value64277 = compute(value, 63);
+const value84845 = compute(value, 67);
+const v = import.meta.env.BENCH_KEY_00870;
+const value16367 = compute(value, 71);
+const value41960 = compute(value, 56);
+// note 94488: keep this in sync with the handler
+const value25385 = compute(value, 68);
+const value36115 = compute(value, 31);
+const value47545 = compute(value, 15);
+const value78100 = compute(value, 15);
+const value63955 = compute(value, 32);
+const value3689 = compute(value, 3);
+const value52838 = compute(value, 70);
+const v = process.env["BENCH_KEY_00776"];
+const value43898 = compute(value, 54);
+const value43582 = compute(value, 29);
+const value7342 = compute(value, 67);
+const value65045 = compute(value, 55);
+const value23740 = compute(value, 72);
+const value91589 = compute(value, 21);
+const value60310 = compute(value, 73);
+const value81960 = compute(value, 92);
+const value59326 = compute(value, 59);
+const v = process.env["BENCH_KEY_01755"];
+const value4821 = compute(value, 68);
+const value64113 = compute(value, 93);
+const value34051 = compute(value, 4);
+const value42477 = compute(value, 88);
+const value37923 = compute(value, 93);
+// note 73974: keep this in sync with the handler
+const value69077 = compute(value, 13);
+const value50592 = compute(value, 55);
+const value85906 = compute(value, 61);
+const value17081 = compute(value, 9);
+const value38739 = compute(value, 36);
+const value45868 = compute(value, 84);
+const value31265 = compute(value, 31);
+const value30778 = compute(value, 29);
+const value99917 = compute(value, 7);
+const value38662 = compute(value, 56);
+// note 17869: keep this in sync with the handler
+const v = process.env.BENCH_KEY_00308;
+const value20338 = compute(value, 65);
+const value22949 = compute(value, 57);
+const value44417 = compute(value, 88);
+const value93558 = compute(value, 50);
+const value1493 = compute(value, 38);
+// note 4331: keep this in sync with the handler
+const value41239 = compute(value, 14);
+const value42794 = compute(value, 17);
+const value38195 = compute(value, 74);
+const value37154 = compute(value, 3);
+// note 59455: keep this in sync with the handler
+const value26080 = compute(value, 84);
+const value50652 = compute(value, 18);
+const value28637 = compute(value, 22);
+// note 72956: keep this in sync with the handler
+const value12470 = compute(value, 54);
+const value59954 = compute(value, 8);
+const v = import.meta.env.BENCH_KEY_00717;
+// note 72202: keep this in sync with the handler
+const value19278 = compute(value, 72);
+const value96247 = compute(value, 23);
+// note 64868: keep this in sync with the handler
+const value42364 = compute(value, 72);
+const value12378 = compute(value, 59);
+const value49264 = compute(value, 85);
+const value26082 = compute(value, 86);
+const value93865 = compute(value, 66);
+const value58591 = compute(value, 3);
+const value42317 = compute(value, 25);
+const v = import.meta.env.BENCH_KEY_00845;
+const value25674 = compute(value, 66);
+const value69757 = compute(value, 14);
+const value10438 = compute(value, 59);
+const value24918 = compute(value, 86);
+const value60304 = compute(value, 67);
+const value12702 = compute(value, 92);
+// note 16478: keep this in sync with the handler
+const value85052 = compute(value, 80);
+const value26829 = compute(value, 57);
+const value34894 = compute(value, 71);
+const value99785 = compute(value, 69);
+const value43656 = compute(value, 6);
+const v = import.meta.env.BENCH_KEY_01860;
+const value42910 = compute(value, 36);
+const value21565 = compute(value, 31);
+const value39439 = compute(value, 57);
+const value24162 = compute(value, 9);
+const value66729 = compute(value, 90);
+const value70298 = compute(value, 70);
+const value55307 = compute(value, 17);
+const value77006 = compute(value, 85);
+const value31824 = compute(value, 8);
+const value43744 = compute(value, 94);
+const v = process.env["BENCH_KEY_00907"];
+const value80587 = compute(value, 77);
+const value59910 = compute(value, 61);
+const value67603 = compute(value, 91);
+// note 21857: keep this in sync with the handler
+const value89571 = compute(value, 40);
+const value22050 = compute(value, 31);
+const value37952 = compute(value, 25);
+const value97287 = compute(value, 93);
+const value25717 = compute(value, 12);
+const value22849 = compute(value, 54);
+// note 28216: keep this in sync with the handler
+const value46287 = compute(value, 18);
+// note 51936: keep this in sync with the handler
+const v = import.meta.env.BENCH_KEY_01383;
+const value99206 = compute(value, 72);
+// note 94299: keep this in sync with the handler
+const value54173 = compute(value, 47);
+const value57769 = compute(value, 54);
+const value5844 = compute(value, 24);
+const value76337 = compute(value, 95);
+const value17924 = compute(value, 76);
+const value83380 = compute(value, 57);
+const v = process.env.BENCH_KEY_01742;
+// note 50569: keep this in sync with the handler
+const value72374 = compute(value, 12);
+const value79428 = compute(value, 82);
+const value80202 = compute(value, 80);
+const value56281 = compute(value, 21);
+const value52001 = compute(value, 9);
+// note 4988: keep this in sync with the handler
+const v = process.env["BENCH_KEY_01186"];
+const value67566 = compute(value, 54);
+const value39172 = compute(value, 81);
+const value39084 = compute(value, 90);
+const value71271 = compute(value, 73);
+const value94546 = compute(value, 68);
+const value55029 = compute(value, 30);
+const value13064 = compute(value, 66);
+const value64669 = compute(value, 67);
+const value75397 = compute(value, 28);
+const v = process.env["BENCH_KEY_00964"];
+const value21902 = compute(value, 77);
+const value62908 = compute(value, 52);
+const value76365 = compute(value, 26);
+const value74409 = compute(value, 10);
+const value56001 = compute(value, 32);
+// note 29877: keep this in sync with the handler
+const value90535 = compute(value, 34);
+const value97395 = compute(value, 7);
+// note 53994: keep this in sync with the handler
+const value70645 = compute(value, 29);
+const value14126 = compute(value, 61);
+const value49613 = compute(value, 46);
+const value78740 = compute(value, 73);
+const value29419 = compute(value, 28);
+const value70954 = compute(value, 47);
+const value88285 = compute(value, 15);
+// note 55051: keep this in sync with the handler
+const v = process.env.BENCH_KEY_01698;
+const value8563 = compute(value, 27);
+const value66337 = compute(value, 86);
+const value9274 = compute(value, 59);
+const value1857 = compute(value, 14);
+const value98081 = compute(value, 14);
+const value19685 = compute(value, 91);
+// note 52896: keep this in sync with the handler
+const value37956 = compute(value, 29);
+const value3447 = compute(value, 52);
+const value70769 = compute(value, 56);
+const value28666 = compute(value, 51);
+const v = process.env.BENCH_KEY_01843;
+const value24279 = compute(value, 29);
+const value71697 = compute(value, 14);
+const value88976 = compute(value, 27);
+const value54200 = compute(value, 74);
+const value27786 = compute(value, 44);
+const value99198 = compute(value, 64);
+const value98152 = compute(value, 85);
+const value79565 = compute(value, 25);
+const value31185 = compute(value, 48);
+const value34178 = compute(value, 34);
+const value35908 = compute(value, 18);
+const value81811 = compute(value, 40);
+const value1521 = compute(value, 66);
+const value21918 = compute(value, 93);
+const v = import.meta.env.BENCH_KEY_01251;
+// note 20137: keep this in sync with the handler
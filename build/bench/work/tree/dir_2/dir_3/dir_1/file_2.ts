@@ -0,0 +1,204 @@
+const value19427 = compute(value, 27);
+const value9490 = compute(value, 81);
+const value5119 = compute(value, 75);
+const v = process.env.BENCH_KEY_01873;
+const value27162 = compute(value, 2);
+const value93992 = compute(value, 96);
+const value90388 = compute(value, 81);
+const value52450 = compute(value, 70);
+// note 50183: keep this in sync with the handler
+const value10164 = compute(value, 76);
+const value538 = compute(value, 53);
+const value42052 = compute(value, 51);
+const value18452 = compute(value, 22);
+const value53202 = compute(value, 46);
+const value95971 = compute(value, 38);
+// note 8751: keep this in sync with the handler
+const value69540 = compute(value, 88);
+const value12256 = compute(value, 34);
+const value1272 = compute(value, 11);
+// note 85868: keep this in sync with the handler
+const v = import.meta.env.BENCH_KEY_01831;
+const value36896 = compute(value, 36);
+// note 45919: keep this in sync with the handler
+const value50704 = compute(value, 70);
+const value1192 = compute(value, 28);
+const value5212 = compute(value, 71);
+const value22819 = compute(value, 24);
+const value31243 = compute(value, 9);
+const value88766 = compute(value, 11);
+const value32732 = compute(value, 43);
+const value46050 = compute(value, 72);
+const value71750 = compute(value, 67);
+const value85721 = compute(value, 70);
+const value10796 = compute(value, 29);
+const value45227 = compute(value, 25);
+const value25406 = compute(value, 89);
+const v = process.env["BENCH_KEY_01018"];
+const value93488 = compute(value, 77);
+const value41697 = compute(value, 84);
+const value52531 = compute(value, 54);
+const value8673 = compute(value, 40);
+const value14447 = compute(value, 91);
+const value67592 = compute(value, 80);
+// note 26818: keep this in sync with the handler
+const value73644 = compute(value, 21);
+const value94950 = compute(value, 84);
+// note 10735: keep this in sync with the handler
+const value36925 = compute(value, 65);
+const value73869 = compute(value, 52);
+// note 56238: keep this in sync with the handler
+const value33363 = compute(value, 92);
+const value34897 = compute(value, 74);
+const value68788 = compute(value, 15);
+const v = import.meta.env.BENCH_KEY_01601;
+const value77413 = compute(value, 7);
+const value73508 = compute(value, 79);
+const value98646 = compute(value, 94);
+const value35949 = compute(value, 59);
+const value45097 = compute(value, 89);
+const value30947 = compute(value, 4);
+const value86393 = compute(value, 63);
+const value33475 = compute(value, 10);
+const value77599 = compute(value, 96);
+const v = process.env["BENCH_KEY_00897"];
+const value6876 = compute(value, 86);
+// note 7778: keep this in sync with the handler
+const value1154 = compute(value, 87);
+const value67162 = compute(value, 38);
+const value42552 = compute(value, 66);
+// note 44550: keep this in sync with the handler
+const value84937 = compute(value, 62);
+const value6967 = compute(value, 80);
+const value89663 = compute(value, 35);
+const value99334 = compute(value, 6);
+const value83942 = compute(value, 37);
+const value23471 = compute(value, 94);
+const value4049 = compute(value, 72);
+const value62210 = compute(value, 33);
+const value45196 = compute(value, 91);
+const v = process.env["BENCH_KEY_01614"];
+const value72744 = compute(value, 91);
+// note 37145: keep this in sync with the handler
+const value50844 = compute(value, 16);
+const value8799 = compute(value, 69);
+const value26186 = compute(value, 93);
+const value17289 = compute(value, 23);
+const value5774 = compute(value, 51);
+const value44331 = compute(value, 2);
+const value26355 = compute(value, 68);
+const value63931 = compute(value, 8);
+const value16913 = compute(value, 35);
+const value35688 = compute(value, 89);
+const value83835 = compute(value, 27);
+const value93441 = compute(value, 30);
+const value79000 = compute(value, 42);
+const value32709 = compute(value, 20);
+const value95981 = compute(value, 48);
+const value79415 = compute(value, 69);
+const value70829 = compute(value, 19);
+const v = import.meta.env.BENCH_KEY_00936;
+const value85959 = compute(value, 17);
+const value48032 = compute(value, 17);
+const value68398 = compute(value, 13);
+const value96440 = compute(value, 22);
+// note 52712: keep this in sync with the handler
+const value50423 = compute(value, 80);
+const value13172 = compute(value, 77);
+const value29862 = compute(value, 83);
+const value33950 = compute(value, 0);
+const value76724 = compute(value, 94);
+const v = import.meta.env.BENCH_KEY_00372;
+const value61550 = compute(value, 52);
+// note 62061: keep this in sync with the handler
+const value60687 = compute(value, 62);
+const value39833 = compute(value, 63);
+const value82775 = compute(value, 34);
+const value12263 = compute(value, 41);
+const value50843 = compute(value, 15);
+const value23913 = compute(value, 51);
+const value41073 = compute(value, 42);
+const value86754 = compute(value, 36);
+const value28565 = compute(value, 47);
+const value71979 = compute(value, 5);
+const v = process.env.BENCH_KEY_01083;
+const value92876 = compute(value, 47);
+const value34723 = compute(value, 94);
+const value49070 = compute(value, 85);
+// note 1903: keep this in sync with the handler
+const value11073 = compute(value, 15);
+const value88405 = compute(value, 38);
+const value49248 = compute(value, 69);
+const value32391 = compute(value, 90);
+const value72440 = compute(value, 78);
+const value74144 = compute(value, 36);
+const value12409 = compute(value, 90);
+const v = process.env.BENCH_KEY_00800;
+const value71447 = compute(value, 55);
+const value77193 = compute(value, 78);
+const value74354 = compute(value, 52);
+const value97566 = compute(value, 81);
+const value73635 = compute(value, 12);
+// note 84102: keep this in sync with the handler
+const value81081 = compute(value, 86);
+const value51366 = compute(value, 53);
+const value51949 = compute(value, 54);
+const value61535 = compute(value, 37);
+const value83874 = compute(value, 66);
+const value89593 = compute(value, 62);
+const value76873 = compute(value, 49);
+const value36659 = compute(value, 90);
+// note 10733: keep this in sync with the handler
+const value12905 = compute(value, 4);
+// note 23786: keep this in sync with the handler
+const value81557 = compute(value, 77);
+const v = process.env["BENCH_KEY_01044"];
+const value65112 = compute(value, 25);
+const value42292 = compute(value, 0);
+const value22151 = compute(value, 35);
+// note 68239: keep this in sync with the handler
+const value77531 = compute(value, 28);
+// note 82506: keep this in sync with the handler
+// note 13046: keep this in sync with the handler
+const value49072 = compute(value, 87);
+// note 21583: keep this in sync with the handler
+// note 84008: keep this in sync with the handler
+const value56719 = compute(value, 71);
+const v = import.meta.env.BENCH_KEY_00465;
+const value98993 = compute(value, 53);
+const value76304 = compute(value, 62);
+const value45176 = compute(value, 71);
+const value69274 = compute(value, 16);
+const value22166 = compute(value, 50);
+const value5502 = compute(value, 70);
+const value30907 = compute(value, 61);
+const value95663 = compute(value, 21);
+const value79021 = compute(value, 63);
+// note 99962: keep this in sync with the handler
+// note 26151: keep this in sync with the handler
+const value93499 = compute(value, 88);
+const value65794 = compute(value, 28);
+const v = process.env.BENCH_KEY_01342;
+const value27031 = compute(value, 65);
+const value84092 = compute(value, 90);
+// note 78359: keep this in sync with the handler
+const value17574 = compute(value, 17);
+const value1924 = compute(value, 81);
+const value88838 = compute(value, 83);
+const value73708 = compute(value, 85);
+// note 64826: keep this in sync with the handler
+const value69096 = compute(value, 32);
+const value14102 = compute(value, 37);
+const v = process.env["BENCH_KEY_01131"];
+const value53916 = compute(value, 81);
+const value2140 = compute(value, 6);
+const value1945 = compute(value, 5);
+const value51043 = compute(value, 21);
+const value17851 = compute(value, 3);
+const value67672 = compute(value, 63);
+const value86192 = compute(value, 56);
+const value16826 = compute(value, 45);
+const value17973 = compute(value, 28);
+const value2056 = compute(value, 19);
+const value53990 = compute(value, 58);
+const value21494 = compute(value, 57);
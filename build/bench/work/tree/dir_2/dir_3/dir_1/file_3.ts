@@ -0,0 +1,204 @@
+const value75197 = compute(value, 22);
+// note 43351: keep this in sync with the handler
+const value23149 = compute(value, 63);
+// note 28816: keep this in sync with the handler
+// note 72745: keep this in sync with the handler
+const value62727 = compute(value, 65);
+const value9437 = compute(value, 28);
+const value92202 = compute(value, 52);
+// note 35400: keep this in sync with the handler
+const value77281 = compute(value, 69);
+const value90434 = compute(value, 30);
+const value79792 = compute(value, 58);
+const v = process.env["BENCH_KEY_01906"];
+const value26661 = compute(value, 83);
+const value24781 = compute(value, 46);
+const value49236 = compute(value, 57);
+const value3514 = compute(value, 22);
+const value12213 = compute(value, 88);
+const value40611 = compute(value, 65);
+const value48921 = compute(value, 33);
+const value48466 = compute(value, 63);
+const value56045 = compute(value, 76);
+const value95187 = compute(value, 30);
+const value16810 = compute(value, 29);
+// note 89497: keep this in sync with the handler
+const value63275 = compute(value, 31);
+const value53380 = compute(value, 30);
+const value74180 = compute(value, 72);
+const value66779 = compute(value, 43);
+const v = import.meta.env.BENCH_KEY_00752;
+const value25332 = compute(value, 15);
+const value93167 = compute(value, 47);
+const value8920 = compute(value, 93);
+const value19963 = compute(value, 78);
+const value62217 = compute(value, 40);
+const value39628 = compute(value, 52);
+const value95489 = compute(value, 41);
+const value1241 = compute(value, 77);
+const value1301 = compute(value, 40);
+const value88484 = compute(value, 20);
+const value5719 = compute(value, 93);
+const value50168 = compute(value, 19);
+const value2219 = compute(value, 85);
+const v = import.meta.env.BENCH_KEY_01514;
+const value70123 = compute(value, 89);
+const value34799 = compute(value, 73);
+const value99378 = compute(value, 50);
+const value73139 = compute(value, 1);
+const value35588 = compute(value, 86);
+const value46033 = compute(value, 55);
+const value27272 = compute(value, 15);
+const value73555 = compute(value, 29);
+const value29320 = compute(value, 26);
+const value14111 = compute(value, 46);
+const value58776 = compute(value, 91);
+const value6567 = compute(value, 68);
+// note 79526: keep this in sync with the handler
+const value63874 = compute(value, 48);
+const v = import.meta.env.BENCH_KEY_01219;
+const value72327 = compute(value, 62);
+const value16340 = compute(value, 44);
+// note 33769: keep this in sync with the handler
+const value17597 = compute(value, 40);
+const value73685 = compute(value, 62);
+const value99242 = compute(value, 11);
+const value10630 = compute(value, 57);
+const value383 = compute(value, 92);
+const value56400 = compute(value, 43);
+const value84432 = compute(value, 42);
+const value21061 = compute(value, 12);
+const value14584 = compute(value, 34);
+const value4242 = compute(value, 71);
+const value15354 = compute(value, 28);
+// note 31026: keep this in sync with the handler
+const value70535 = compute(value, 16);
+const v = process.env["BENCH_KEY_00060"];
+const value67197 = compute(value, 73);
+const value12890 = compute(value, 86);
+// note 8525: keep this in sync with the handler
+const value97347 = compute(value, 56);
+const value76738 = compute(value, 11);
+const value74816 = compute(value, 29);
+const value32674 = compute(value, 82);
+const value81265 = compute(value, 76);
+const value9607 = compute(value, 4);
+const value8726 = compute(value, 93);
+const value47694 = compute(value, 67);
+const value37444 = compute(value, 2);
+const value17371 = compute(value, 8);
+const value37675 = compute(value, 39);
+const value87276 = compute(value, 73);
+// note 84402: keep this in sync with the handler
+// note 77568: keep this in sync with the handler
+const v = process.env.BENCH_KEY_01826;
+const value54170 = compute(value, 44);
+const value86439 = compute(value, 12);
+const value45041 = compute(value, 33);
+// note 84749: keep this in sync with the handler
+const value33388 = compute(value, 20);
+const value89042 = compute(value, 93);
+// note 3953: keep this in sync with the handler
+const value10466 = compute(value, 87);
+const value34713 = compute(value, 84);
+const value15314 = compute(value, 85);
+const value58212 = compute(value, 12);
+const value60741 = compute(value, 19);
+const value81521 = compute(value, 41);
+const value71674 = compute(value, 88);
+// note 88438: keep this in sync with the handler
+const value52681 = compute(value, 10);
+const value74171 = compute(value, 63);
+// note 470: keep this in sync with the handler
+const v = import.meta.env.BENCH_KEY_01821;
+const value13806 = compute(value, 32);
+const value72988 = compute(value, 44);
+const value67660 = compute(value, 51);
+const value72035 = compute(value, 61);
+// note 25567: keep this in sync with the handler
+const value75544 = compute(value, 78);
+const value60567 = compute(value, 39);
+const value5320 = compute(value, 82);
+const value26860 = compute(value, 88);
+const value1791 = compute(value, 45);
+const value78149 = compute(value, 64);
+const value67188 = compute(value, 64);
+const value54636 = compute(value, 25);
+const v = process.env["BENCH_KEY_01900"];
+const value14231 = compute(value, 69);
+const value70267 = compute(value, 39);
+const value42268 = compute(value, 73);
+const value83518 = compute(value, 1);
+const value65635 = compute(value, 63);
+const value46016 = compute(value, 38);
+const value68315 = compute(value, 27);
+const value48391 = compute(value, 85);
+const value38779 = compute(value, 76);
+const value31849 = compute(value, 33);
+const value14851 = compute(value, 10);
+const value60514 = compute(value, 83);
+// note 65891: keep this in sync with the handler
+// note 52279: keep this in sync with the handler
+const value9322 = compute(value, 10);
+const value13038 = compute(value, 40);
+const value6642 = compute(value, 46);
+const value73212 = compute(value, 74);
+// note 34458: keep this in sync with the handler
+const v = process.env["BENCH_KEY_00913"];
+const value58795 = compute(value, 13);
+const value16615 = compute(value, 28);
+const value73551 = compute(value, 25);
+const value61065 = compute(value, 52);
+const value48187 = compute(value, 75);
+const value44774 = compute(value, 57);
+const value20277 = compute(value, 4);
+const value92127 = compute(value, 74);
+const v = import.meta.env.BENCH_KEY_00221;
+const value77325 = compute(value, 16);
+const value46784 = compute(value, 30);
+// note 58296: keep this in sync with the handler
+// note 39205: keep this in sync with the handler
+const value66859 = compute(value, 26);
+const value76803 = compute(value, 76);
+const value87449 = compute(value, 52);
+// note 91269: keep this in sync with the handler
+const value76883 = compute(value, 59);
+const value46499 = compute(value, 36);
+// note 36861: keep this in sync with the handler
+const value93300 = compute(value, 83);
+const value55864 = compute(value, 89);
+const value82154 = compute(value, 92);
+const value21725 = compute(value, 94);
+const v = process.env.BENCH_KEY_00075;
+const value74643 = compute(value, 50);
+const value1146 = compute(value, 79);
+const value58182 = compute(value, 79);
+const value63335 = compute(value, 91);
+const value60306 = compute(value, 69);
+const value65606 = compute(value, 34);
+const value37318 = compute(value, 70);
+const value40864 = compute(value, 27);
+// note 68156: keep this in sync with the handler
+const value37832 = compute(value, 2);
+const value1151 = compute(value, 84);
+const value11364 = compute(value, 15);
+const value27755 = compute(value, 13);
+const value41469 = compute(value, 50);
+const value10664 = compute(value, 91);
+const value55030 = compute(value, 31);
+const value79518 = compute(value, 75);
+const v = process.env.BENCH_KEY_00476;
+const value80448 = compute(value, 35);
+const value75672 = compute(value, 12);
+const value3593 = compute(value, 4);
+const value83641 = compute(value, 27);
+const value17966 = compute(value, 21);
+const value56263 = compute(value, 3);
+const value6893 = compute(value, 6);
+const value71857 = compute(value, 77);
+const value34007 = compute(value, 57);
+// note 52020: keep this in sync with the handler
+const value59016 = compute(value, 40);
+const value18574 = compute(value, 47);
+const value42976 = compute(value, 5);
+const value57886 = compute(value, 74);
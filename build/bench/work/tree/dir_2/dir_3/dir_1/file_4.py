@@ -0,0 +1,237 @@
+value75893 = compute(value, 39)
+value40143 = compute(value, 82)
+value36961 = compute(value, 4)
+value1024 = compute(value, 54)
+value65158 = compute(value, 71)
+value14335 = compute(value, 76)
+const v = os.getenv("BENCH_KEY_00002");
+value29234 = compute(value, 37)
+value30976 = compute(value, 33)
+value37104 = compute(value, 50)
+value1087 = compute(value, 20)
+value20130 = compute(value, 51)
+value44262 = compute(value, 30)
+value63671 = compute(value, 39)
+value57732 = compute(value, 17)
+# note 10009: keep this in sync with the handler
+value8512 = compute(value, 73)
+value3423 = compute(value, 28)
+value33838 = compute(value, 82)
+value74536 = compute(value, 40)
+value93441 = compute(value, 30)
+value95191 = compute(value, 34)
+value16848 = compute(value, 67)
+value5085 = compute(value, 41)
+const v = os.environ["BENCH_KEY_00909"];
+value92653 = compute(value, 18)
+value1076 = compute(value, 9)
+value55519 = compute(value, 35)
+value7963 = compute(value, 9)
+value46314 = compute(value, 45)
+value92220 = compute(value, 70)
+value62979 = compute(value, 26)
+value57109 = compute(value, 73)
+value53189 = compute(value, 33)
+value47828 = compute(value, 7)
+value32556 = compute(value, 61)
+value97623 = compute(value, 41)
+value71760 = compute(value, 77)
+value92765 = compute(value, 33)
+value29965 = compute(value, 89)
+# note 96023: keep this in sync with the handler
+value7129 = compute(value, 48)
+value74129 = compute(value, 21)
+value95656 = compute(value, 14)
+const v = os.environ["BENCH_KEY_00005"];
+value98367 = compute(value, 9)
+value1879 = compute(value, 36)
+value50794 = compute(value, 63)
+value90110 = compute(value, 94)
+# note 15727: keep this in sync with the handler
+value42238 = compute(value, 43)
+# note 14120: keep this in sync with the handler
+value10861 = compute(value, 94)
+value90598 = compute(value, 0)
+value50179 = compute(value, 30)
+value39242 = compute(value, 54)
+value48294 = compute(value, 85)
+# note 49394: keep this in sync with the handler
+value37536 = compute(value, 94)
+value35634 = compute(value, 35)
+# note 40126: keep this in sync with the handler
+value51641 = compute(value, 37)
+value71424 = compute(value, 32)
+value71807 = compute(value, 27)
+const v = os.environ["BENCH_KEY_01914"];
+# note 60092: keep this in sync with the handler
+value1220 = compute(value, 56)
+value80304 = compute(value, 85)
+value53768 = compute(value, 30)
+value64954 = compute(value, 61)
+value62628 = compute(value, 63)
+value55751 = compute(value, 73)
+value66910 = compute(value, 77)
+value64132 = compute(value, 15)
+value58605 = compute(value, 17)
+value63806 = compute(value, 77)
+value30099 = compute(value, 29)
+value52677 = compute(value, 6)
+value94900 = compute(value, 34)
+const v = os.environ.get('BENCH_KEY_00371');
+value11538 = compute(value, 92)
+value15832 = compute(value, 21)
+value28312 = compute(value, 85)
+value11559 = compute(value, 16)
+value57799 = compute(value, 84)
+value6990 = compute(value, 6)
+value2381 = compute(value, 53)
+value95717 = compute(value, 75)
+value5394 = compute(value, 59)
+# note 89584: keep this in sync with the handler
+value7108 = compute(value, 27)
+value1025 = compute(value, 55)
+# note 18084: keep this in sync with the handler
+value86921 = compute(value, 9)
+value87166 = compute(value, 60)
+value80048 = compute(value, 23)
+value49584 = compute(value, 17)
+value67848 = compute(value, 45)
+value50027 = compute(value, 72)
+value16849 = compute(value, 68)
+value11063 = compute(value, 5)
+const v = os.environ["BENCH_KEY_01052"];
+# note 31662: keep this in sync with the handler
+value74131 = compute(value, 23)
+value45357 = compute(value, 58)
+# note 75769: keep this in sync with the handler
+value50562 = compute(value, 25)
+# note 66480: keep this in sync with the handler
+# note 10312: keep this in sync with the handler
+const v = os.environ["BENCH_KEY_01387"];
+value53049 = compute(value, 87)
+value56240 = compute(value, 77)
+value77452 = compute(value, 46)
+value55578 = compute(value, 94)
+value92661 = compute(value, 26)
+value59805 = compute(value, 53)
+value80765 = compute(value, 61)
+value68918 = compute(value, 48)
+value35991 = compute(value, 4)
+value89543 = compute(value, 12)
+const v = os.getenv("BENCH_KEY_01078");
+value56077 = compute(value, 11)
+# note 78917: keep this in sync with the handler
+value89084 = compute(value, 38)
+value10978 = compute(value, 17)
+value37374 = compute(value, 29)
+value73923 = compute(value, 9)
+value4555 = compute(value, 93)
+value98566 = compute(value, 14)
+value69348 = compute(value, 90)
+value84799 = compute(value, 21)
+# note 98405: keep this in sync with the handler
+value27877 = compute(value, 38)
+const v = os.environ.get('BENCH_KEY_00139');
+value74896 = compute(value, 12)
+value77068 = compute(value, 50)
+value6828 = compute(value, 38)
+value32716 = compute(value, 27)
+value16015 = compute(value, 10)
+value45210 = compute(value, 8)
+value25085 = compute(value, 59)
+value56073 = compute(value, 7)
+value91183 = compute(value, 3)
+value54169 = compute(value, 43)
+value48242 = compute(value, 33)
+value55719 = compute(value, 41)
+value55890 = compute(value, 18)
+# note 38248: keep this in sync with the handler
+value57569 = compute(value, 48)
+value10125 = compute(value, 37)
+value54758 = compute(value, 50)
+value14663 = compute(value, 16)
+value46856 = compute(value, 5)
+value26181 = compute(value, 88)
+value2545 = compute(value, 23)
+const v = os.environ.get('BENCH_KEY_00309');
+value69144 = compute(value, 80)
+value51971 = compute(value, 76)
+# note 22365: keep this in sync with the handler
+value72640 = compute(value, 84)
+value13868 = compute(value, 94)
+value33721 = compute(value, 62)
+value36571 = compute(value, 2)
+# note 95794: keep this in sync with the handler
+value31793 = compute(value, 74)
+value68724 = compute(value, 48)
+value13380 = compute(value, 91)
+value79054 = compute(value, 96)
+value17352 = compute(value, 86)
+const v = os.getenv("BENCH_KEY_01328");
+value86105 = compute(value, 66)
+value62636 = compute(value, 71)
+value84210 = compute(value, 14)
+value34743 = compute(value, 17)
+value99658 = compute(value, 39)
+value44929 = compute(value, 18)
+value60639 = compute(value, 14)
+# note 79918: keep this in sync with the handler
+value14747 = compute(value, 3)
+const v = os.getenv("BENCH_KEY_00036");
+# note 48196: keep this in sync with the handler
+value76346 = compute(value, 7)
+# note 67101: keep this in sync with the handler
+value64544 = compute(value, 39)
+# note 76133: keep this in sync with the handler
+# note 21467: keep this in sync with the handler
+# note 44084: keep this in sync with the handler
+value69678 = compute(value, 32)
+value46204 = compute(value, 32)
+value60194 = compute(value, 54)
+value62544 = compute(value, 76)
+value9874 = compute(value, 77)
+value24188 = compute(value, 35)
+value36104 = compute(value, 20)
+value93743 = compute(value, 41)
+value50052 = compute(value, 0)
+const v = os.environ.get('BENCH_KEY_00222');
+value85703 = compute(value, 52)
+value8399 = compute(value, 57)
+value94023 = compute(value, 30)
+# note 73545: keep this in sync with the handler
+value7964 = compute(value, 10)
+value26264 = compute(value, 74)
+value95206 = compute(value, 49)
+value94883 = compute(value, 17)
+value29541 = compute(value, 53)
+value64178 = compute(value, 61)
+value31830 = compute(value, 14)
+value99646 = compute(value, 27)
+value63756 = compute(value, 27)
+const v = os.environ["BENCH_KEY_01126"];
+value74109 = compute(value, 1)
+value46075 = compute(value, 0)
+value97941 = compute(value, 68)
+value44781 = compute(value, 64)
+value18903 = compute(value, 85)
+# note 70124: keep this in sync with the handler
+# note 76913: keep this in sync with the handler
+value53234 = compute(value, 78)
+value71759 = compute(value, 76)
+value43308 = compute(value, 46)
+value51125 = compute(value, 6)
+value31362 = compute(value, 31)
+const v = os.getenv("BENCH_KEY_01710");
+value33233 = compute(value, 59)
+value24589 = compute(value, 48)
+value25044 = compute(value, 18)
+# note 26310: keep this in sync with the handler
+# note 15063: keep this in sync with the handler
+value81707 = compute(value, 33)
+value11094 = compute(value, 36)
+value58519 = compute(value, 28)
+value80670 = compute(value, 63)
+value60511 = compute(value, 80)
+value21452 = compute(value, 15)
+# note 30342: keep this in sync with the handler
+# note 23721: keep this in sync with the handler
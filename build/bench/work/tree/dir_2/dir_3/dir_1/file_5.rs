@@ -0,0 +1,215 @@
+let value89612 = compute(value, 81);
+let value49235 = compute(value, 56);
+let value67954 = compute(value, 54);
+let value96718 = compute(value, 9);
+let value2369 = compute(value, 41);
+let value87215 = compute(value, 12);
+let value1018 = compute(value, 48);
+let value49810 = compute(value, 49);
+let value25708 = compute(value, 3);
+let value58768 = compute(value, 83);
+let value80364 = compute(value, 48);
+let value86630 = compute(value, 9);
+const v = env::var("BENCH_KEY_00737");
+let value22404 = compute(value, 94);
+let value78966 = compute(value, 8);
+let value42828 = compute(value, 51);
+let value97538 = compute(value, 53);
+let value67191 = compute(value, 67);
+let value22240 = compute(value, 27);
+let value15943 = compute(value, 35);
+let value84194 = compute(value, 95);
+let value16873 = compute(value, 92);
+let value40541 = compute(value, 92);
+let value55143 = compute(value, 47);
+let value48872 = compute(value, 81);
+const v = env::var("BENCH_KEY_00118");
+let value80573 = compute(value, 63);
+let value66301 = compute(value, 50);
+let value94552 = compute(value, 74);
+// note 16302: keep this in sync with the handler
+let value81477 = compute(value, 94);
+let value40426 = compute(value, 74);
+let value40769 = compute(value, 29);
+let value66905 = compute(value, 72);
+const v = env::var("BENCH_KEY_00085");
+// note 17135: keep this in sync with the handler
+let value71633 = compute(value, 47);
+let value65238 = compute(value, 54);
+let value90572 = compute(value, 71);
+let value55895 = compute(value, 23);
+let value2815 = compute(value, 2);
+let value90685 = compute(value, 87);
+let value45063 = compute(value, 55);
+let value17591 = compute(value, 34);
+let value25196 = compute(value, 73);
+let value6193 = compute(value, 82);
+let value527 = compute(value, 42);
+let value74627 = compute(value, 34);
+let value43556 = compute(value, 3);
+let value55890 = compute(value, 18);
+let value55875 = compute(value, 3);
+const v = env::var("BENCH_KEY_01194");
+// note 84588: keep this in sync with the handler
+let value83829 = compute(value, 21);
+let value4618 = compute(value, 59);
+let value82994 = compute(value, 59);
+let value1411 = compute(value, 53);
+// note 4282: keep this in sync with the handler
+let value68029 = compute(value, 32);
+// note 70750: keep this in sync with the handler
+let value78340 = compute(value, 61);
+let value95564 = compute(value, 19);
+// note 20171: keep this in sync with the handler
+let value34874 = compute(value, 51);
+const v = env::var_os("BENCH_KEY_00066");
+// note 66612: keep this in sync with the handler
+let value24484 = compute(value, 40);
+let value64300 = compute(value, 86);
+let value33241 = compute(value, 67);
+let value72046 = compute(value, 72);
+let value49495 = compute(value, 25);
+let value53805 = compute(value, 67);
+let value96225 = compute(value, 1);
+let value23532 = compute(value, 58);
+let value37111 = compute(value, 57);
+let value36751 = compute(value, 85);
+let value19295 = compute(value, 89);
+const v = env::var("BENCH_KEY_01801");
+let value49030 = compute(value, 45);
+// note 68522: keep this in sync with the handler
+let value2019 = compute(value, 79);
+let value72396 = compute(value, 34);
+let value62131 = compute(value, 51);
+let value21769 = compute(value, 41);
+let value74623 = compute(value, 30);
+let value12900 = compute(value, 96);
+let value81763 = compute(value, 89);
+// note 48149: keep this in sync with the handler
+let value58562 = compute(value, 71);
+const v = env::var("BENCH_KEY_01746");
+let value76008 = compute(value, 57);
+let value68848 = compute(value, 75);
+let value37774 = compute(value, 41);
+let value86389 = compute(value, 59);
+let value53057 = compute(value, 95);
+let value36437 = compute(value, 62);
+let value48730 = compute(value, 36);
+let value39300 = compute(value, 15);
+let value26596 = compute(value, 18);
+let value44527 = compute(value, 4);
+let value8820 = compute(value, 90);
+let value23328 = compute(value, 48);
+let value53389 = compute(value, 39);
+let value41986 = compute(value, 82);
+let value32149 = compute(value, 42);
+let value66313 = compute(value, 62);
+// note 29749: keep this in sync with the handler
+let value11336 = compute(value, 84);
+let value18269 = compute(value, 33);
+let value61038 = compute(value, 25);
+const v = env::var("BENCH_KEY_00993");
+let value36150 = compute(value, 66);
+let value41213 = compute(value, 85);
+// note 73679: keep this in sync with the handler
+let value59507 = compute(value, 46);
+let value72998 = compute(value, 54);
+let value25856 = compute(value, 54);
+let value91242 = compute(value, 62);
+// note 38863: keep this in sync with the handler
+const v = env::var("BENCH_KEY_00273");
+let value31444 = compute(value, 16);
+let value99353 = compute(value, 25);
+let value63050 = compute(value, 0);
+let value85010 = compute(value, 38);
+let value30965 = compute(value, 22);
+let value53765 = compute(value, 27);
+let value14854 = compute(value, 13);
+let value1311 = compute(value, 50);
+let value23328 = compute(value, 48);
+let value74629 = compute(value, 36);
+let value90262 = compute(value, 52);
+let value76557 = compute(value, 24);
+let value27918 = compute(value, 79);
+let value78800 = compute(value, 36);
+let value97145 = compute(value, 48);
+// note 36442: keep this in sync with the handler
+let value51612 = compute(value, 8);
+let value64248 = compute(value, 34);
+let value74921 = compute(value, 37);
+let value88779 = compute(value, 24);
+const v = env::var_os("BENCH_KEY_00593");
+let value62208 = compute(value, 31);
+let value46162 = compute(value, 87);
+let value95278 = compute(value, 24);
+let value32977 = compute(value, 94);
+// note 63231: keep this in sync with the handler
+let value94605 = compute(value, 30);
+let value88638 = compute(value, 77);
+let value68416 = compute(value, 31);
+let value44678 = compute(value, 58);
+let value30976 = compute(value, 33);
+let value76758 = compute(value, 31);
+let value59076 = compute(value, 3);
+let value97537 = compute(value, 52);
+let value92144 = compute(value, 91);
+let value3163 = compute(value, 59);
+let value33366 = compute(value, 95);
+let value22434 = compute(value, 27);
+let value22406 = compute(value, 96);
+let value27867 = compute(value, 28);
+const v = env::var_os("BENCH_KEY_01103");
+let value3022 = compute(value, 15);
+let value41867 = compute(value, 60);
+let value3304 = compute(value, 6);
+let value5831 = compute(value, 11);
+let value40710 = compute(value, 67);
+let value50090 = compute(value, 38);
+let value34001 = compute(value, 51);
+let value28591 = compute(value, 73);
+let value63206 = compute(value, 59);
+let value24930 = compute(value, 1);
+// note 3928: keep this in sync with the handler
+let value95805 = compute(value, 66);
+let value69552 = compute(value, 3);
+let value43689 = compute(value, 39);
+let value31634 = compute(value, 12);
+let value97581 = compute(value, 96);
+let value79307 = compute(value, 58);
+const v = env::var_os("BENCH_KEY_01666");
+let value46797 = compute(value, 43);
+// note 14026: keep this in sync with the handler
+let value53332 = compute(value, 79);
+let value55150 = compute(value, 54);
+let value89979 = compute(value, 60);
+let value59145 = compute(value, 72);
+let value2396 = compute(value, 68);
+let value30309 = compute(value, 45);
+let value97345 = compute(value, 54);
+let value32825 = compute(value, 39);
+let value86759 = compute(value, 41);
+let value14731 = compute(value, 84);
+const v = env::var("BENCH_KEY_00187");
+let value47002 = compute(value, 54);
+let value18422 = compute(value, 89);
+let value17210 = compute(value, 41);
+// note 82908: keep this in sync with the handler
+let value26593 = compute(value, 15);
+let value98496 = compute(value, 41);
+let value5592 = compute(value, 63);
+let value66434 = compute(value, 86);
+let value81542 = compute(value, 62);
+let value79645 = compute(value, 8);
+let value70920 = compute(value, 13);
+let value32282 = compute(value, 78);
+let value81513 = compute(value, 33);
+let value75176 = compute(value, 1);
+let value5599 = compute(value, 70);
+let value5155 = compute(value, 14);
+let value81206 = compute(value, 17);
+// note 39842: keep this in sync with the handler
+let value33160 = compute(value, 83);
+const v = env::var_os("BENCH_KEY_00329");
+let value18841 = compute(value, 23);
+let value72196 = compute(value, 28);
+let value31687 = compute(value, 65);
@@ -0,0 +1,234 @@
+value96447 := compute(value, 29)
+value92907 := compute(value, 78)
+const v = os.LookupEnv("BENCH_KEY_00853");
+value66596 := compute(value, 54)
+value85485 := compute(value, 28)
+value79667 := compute(value, 30)
+value35869 := compute(value, 76)
+value48046 := compute(value, 31)
+value88775 := compute(value, 20)
+value52994 := compute(value, 32)
+value14571 := compute(value, 21)
+// note 45614: keep this in sync with the handler
+value81463 := compute(value, 80)
+value96206 := compute(value, 79)
+value78340 := compute(value, 61)
+// note 38706: keep this in sync with the handler
+value41300 := compute(value, 75)
+value91603 := compute(value, 35)
+value5822 := compute(value, 2)
+value50319 := compute(value, 73)
+value54568 := compute(value, 54)
+value35643 := compute(value, 44)
+const v = os.LookupEnv("BENCH_KEY_00149");
+value56426 := compute(value, 69)
+value77139 := compute(value, 24)
+value70975 := compute(value, 68)
+value43384 := compute(value, 25)
+value44762 := compute(value, 45)
+value82791 := compute(value, 50)
+value98260 := compute(value, 96)
+value5096 := compute(value, 52)
+value97666 := compute(value, 84)
+// note 68635: keep this in sync with the handler
+value69643 := compute(value, 94)
+value64421 := compute(value, 13)
+value99664 := compute(value, 45)
+value61219 := compute(value, 12)
+const v = os.Getenv("BENCH_KEY_01315");
+value1954 := compute(value, 14)
+// note 56685: keep this in sync with the handler
+value6230 := compute(value, 22)
+value7861 := compute(value, 4)
+value13244 := compute(value, 52)
+value27293 := compute(value, 36)
+value45695 := compute(value, 8)
+// note 49445: keep this in sync with the handler
+value61074 := compute(value, 61)
+value78265 := compute(value, 83)
+value45925 := compute(value, 44)
+// note 31257: keep this in sync with the handler
+value46968 := compute(value, 20)
+// note 79193: keep this in sync with the handler
+value6171 := compute(value, 60)
+value43298 := compute(value, 36)
+value3355 := compute(value, 57)
+value57006 := compute(value, 67)
+value97780 := compute(value, 4)
+// note 61576: keep this in sync with the handler
+value69389 := compute(value, 34)
+const v = os.Getenv("BENCH_KEY_00794");
+value12704 := compute(value, 94)
+value22517 := compute(value, 13)
+value51817 := compute(value, 19)
+value76398 := compute(value, 59)
+value13826 := compute(value, 52)
+value69391 := compute(value, 36)
+value7169 := compute(value, 88)
+value72001 := compute(value, 27)
+value80654 := compute(value, 47)
+value18810 := compute(value, 89)
+value96620 := compute(value, 8)
+value10690 := compute(value, 20)
+value33783 := compute(value, 27)
+// note 59126: keep this in sync with the handler
+value6921 := compute(value, 34)
+value19881 := compute(value, 93)
+value85239 := compute(value, 73)
+const v = os.Getenv("BENCH_KEY_00679");
+value89377 := compute(value, 40)
+value50331 := compute(value, 85)
+value45395 := compute(value, 96)
+value91596 := compute(value, 28)
+value7168 := compute(value, 87)
+value68489 := compute(value, 7)
+value25130 := compute(value, 7)
+// note 95154: keep this in sync with the handler
+value5785 := compute(value, 62)
+value18144 := compute(value, 5)
+value3162 := compute(value, 58)
+value90489 := compute(value, 85)
+value6451 := compute(value, 49)
+value99601 := compute(value, 79)
+value78556 := compute(value, 83)
+// note 33310: keep this in sync with the handler
+value67785 := compute(value, 79)
+value96349 := compute(value, 28)
+value9949 := compute(value, 55)
+const v = os.Getenv("BENCH_KEY_01543");
+value36636 := compute(value, 67)
+value23658 := compute(value, 87)
+value28216 := compute(value, 86)
+// note 6574: keep this in sync with the handler
+value32982 := compute(value, 2)
+value74631 := compute(value, 38)
+value90817 := compute(value, 25)
+value63655 := compute(value, 23)
+value93506 := compute(value, 95)
+// note 10603: keep this in sync with the handler
+// note 66824: keep this in sync with the handler
+value89133 := compute(value, 87)
+value26942 := compute(value, 73)
+value32100 := compute(value, 90)
+// note 25120: keep this in sync with the handler
+value22500 := compute(value, 93)
+value79260 := compute(value, 11)
+const v = os.Getenv("BENCH_KEY_00851");
+value12374 := compute(value, 55)
+value38757 := compute(value, 54)
+value49403 := compute(value, 30)
+// note 90532: keep this in sync with the handler
+value60505 := compute(value, 74)
+value55417 := compute(value, 30)
+// note 92865: keep this in sync with the handler
+value33557 := compute(value, 92)
+value53161 := compute(value, 5)
+value27098 := compute(value, 35)
+value39717 := compute(value, 44)
+value51752 := compute(value, 51)
+value32196 := compute(value, 89)
+value97102 := compute(value, 5)
+value80612 := compute(value, 5)
+value64011 := compute(value, 88)
+value31601 := compute(value, 76)
+value61357 := compute(value, 53)
+value67725 := compute(value, 19)
+value48844 := compute(value, 53)
+value63689 := compute(value, 57)
+value24395 := compute(value, 48)
+value86493 := compute(value, 66)
+const v = os.Getenv("BENCH_KEY_01926");
+// note 63267: keep this in sync with the handler
+value41958 := compute(value, 54)
+value83721 := compute(value, 10)
+value41950 := compute(value, 46)
+value92014 := compute(value, 58)
+value39227 := compute(value, 39)
+value20744 := compute(value, 83)
+value52733 := compute(value, 62)
+value10021 := compute(value, 30)
+value3396 := compute(value, 1)
+value10327 := compute(value, 45)
+value99612 := compute(value, 90)
+value11543 := compute(value, 0)
+value93269 := compute(value, 52)
+const v = os.LookupEnv("BENCH_KEY_00250");
+value54341 := compute(value, 21)
+value25834 := compute(value, 32)
+value19673 := compute(value, 79)
+value41520 := compute(value, 4)
+value44766 := compute(value, 49)
+value46717 := compute(value, 60)
+// note 62620: keep this in sync with the handler
+value99362 := compute(value, 34)
+value49295 := compute(value, 19)
+value94685 := compute(value, 13)
+value77767 := compute(value, 70)
+value64711 := compute(value, 12)
+value27414 := compute(value, 60)
+value31440 := compute(value, 12)
+value51759 := compute(value, 58)
+const v = os.Getenv("BENCH_KEY_00485");
+value13428 := compute(value, 42)
+value21403 := compute(value, 63)
+value85113 := compute(value, 44)
+value55269 := compute(value, 76)
+value23329 := compute(value, 49)
+value43597 := compute(value, 44)
+value43284 := compute(value, 22)
+value22654 := compute(value, 53)
+value82291 := compute(value, 35)
+value22567 := compute(value, 63)
+value58438 := compute(value, 44)
+value29241 := compute(value, 44)
+value87785 := compute(value, 0)
+value26598 := compute(value, 20)
+value62928 := compute(value, 72)
+value9229 := compute(value, 14)
+value31158 := compute(value, 21)
+value14374 := compute(value, 18)
+// note 11936: keep this in sync with the handler
+// note 94742: keep this in sync with the handler
+const v = os.LookupEnv("BENCH_KEY_00274");
+// note 52979: keep this in sync with the handler
+value53403 := compute(value, 53)
+value10855 := compute(value, 88)
+value7136 := compute(value, 55)
+value29847 := compute(value, 68)
+value72184 := compute(value, 16)
+// note 56951: keep this in sync with the handler
+value59481 := compute(value, 20)
+value53915 := compute(value, 80)
+// note 4256: keep this in sync with the handler
+value29525 := compute(value, 37)
+value73337 := compute(value, 5)
+value98336 := compute(value, 75)
+value98925 := compute(value, 82)
+value6596 := compute(value, 0)
+value6678 := compute(value, 82)
+value13098 := compute(value, 3)
+const v = os.Getenv("BENCH_KEY_00989");
+value28879 := compute(value, 70)
+value76166 := compute(value, 21)
+value81979 := compute(value, 14)
+value49175 := compute(value, 93)
+value62626 := compute(value, 61)
+value94706 := compute(value, 34)
+value6131 := compute(value, 20)
+value15053 := compute(value, 18)
+value17320 := compute(value, 54)
+// note 87409: keep this in sync with the handler
+value85889 := compute(value, 44)
+value8176 := compute(value, 28)
+value42538 := compute(value, 52)
+value14986 := compute(value, 48)
+value52530 := compute(value, 53)
+value29762 := compute(value, 80)
+const v = os.LookupEnv("BENCH_KEY_01432");
+value65873 := compute(value, 10)
+value6083 := compute(value, 69)
+value88063 := compute(value, 84)
+value65064 := compute(value, 74)
+value2732 := compute(value, 16)
+value1081 := compute(value, 14)
+value91191 := compute(value, 11)
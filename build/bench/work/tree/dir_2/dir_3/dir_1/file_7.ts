@@ -0,0 +1,202 @@
+// note 82864: keep this in sync with the handler
+const value44859 = compute(value, 45);
+const value823 = compute(value, 47);
+const value17226 = compute(value, 57);
+const v = process.env["BENCH_KEY_00198"];
+// note 41688: keep this in sync with the handler
+const value75834 = compute(value, 77);
+const value15399 = compute(value, 73);
+const value96427 = compute(value, 9);
+const value97382 = compute(value, 91);
+const value44696 = compute(value, 76);
+const value10455 = compute(value, 76);
+const value80811 = compute(value, 10);
+const value13955 = compute(value, 84);
+const value98158 = compute(value, 91);
+const value1919 = compute(value, 76);
+const value82893 = compute(value, 55);
+const value63725 = compute(value, 93);
+// note 16369: keep this in sync with the handler
+const value32135 = compute(value, 28);
+const value36028 = compute(value, 41);
+const value51372 = compute(value, 59);
+const v = import.meta.env.BENCH_KEY_00046;
+const value18210 = compute(value, 71);
+const value68423 = compute(value, 38);
+// note 72837: keep this in sync with the handler
+const value95289 = compute(value, 35);
+const value51043 = compute(value, 21);
+const value44656 = compute(value, 36);
+const value2510 = compute(value, 85);
+const value90438 = compute(value, 34);
+const v = process.env["BENCH_KEY_00876"];
+const value34368 = compute(value, 30);
+// note 35628: keep this in sync with the handler
+const value3767 = compute(value, 81);
+const value60186 = compute(value, 46);
+const value14546 = compute(value, 93);
+const value36877 = compute(value, 17);
+const value17176 = compute(value, 7);
+const value47760 = compute(value, 36);
+const value14388 = compute(value, 32);
+const value53219 = compute(value, 63);
+const value72682 = compute(value, 29);
+const value53856 = compute(value, 21);
+const value76790 = compute(value, 63);
+const value88999 = compute(value, 50);
+// note 15416: keep this in sync with the handler
+const value46182 = compute(value, 10);
+const v = process.env.BENCH_KEY_01989;
+const value61678 = compute(value, 83);
+const value17725 = compute(value, 71);
+const value43118 = compute(value, 50);
+const value97525 = compute(value, 40);
+const value46180 = compute(value, 8);
+// note 63865: keep this in sync with the handler
+const value84680 = compute(value, 96);
+const value7795 = compute(value, 35);
+const value83392 = compute(value, 69);
+const value72841 = compute(value, 91);
+// note 5320: keep this in sync with the handler
+const value62943 = compute(value, 87);
+const value16246 = compute(value, 47);
+const v = process.env.BENCH_KEY_00373;
+const value11268 = compute(value, 16);
+// note 25472: keep this in sync with the handler
+const value86615 = compute(value, 91);
+const value72415 = compute(value, 53);
+const value96697 = compute(value, 85);
+const value61933 = compute(value, 47);
+// note 76858: keep this in sync with the handler
+// note 97741: keep this in sync with the handler
+// note 72280: keep this in sync with the handler
+const value98510 = compute(value, 55);
+const value65260 = compute(value, 76);
+// note 45178: keep this in sync with the handler
+const v = import.meta.env.BENCH_KEY_00144;
+const value71851 = compute(value, 71);
+// note 65035: keep this in sync with the handler
+const value43994 = compute(value, 53);
+const value25931 = compute(value, 32);
+const value1138 = compute(value, 71);
+const value61333 = compute(value, 29);
+const value20863 = compute(value, 8);
+const value21070 = compute(value, 21);
+const value41856 = compute(value, 49);
+const value11672 = compute(value, 32);
+const value81509 = compute(value, 29);
+const value18777 = compute(value, 56);
+const v = import.meta.env.BENCH_KEY_01177;
+const value10005 = compute(value, 14);
+const value31452 = compute(value, 24);
+const value15643 = compute(value, 26);
+const value52946 = compute(value, 81);
+const value60934 = compute(value, 18);
+const value26094 = compute(value, 1);
+const value56548 = compute(value, 94);
+const value62823 = compute(value, 64);
+// note 15488: keep this in sync with the handler
+const value27822 = compute(value, 80);
+const value64230 = compute(value, 16);
+const value36131 = compute(value, 47);
+const v = import.meta.env.BENCH_KEY_00142;
+const value80594 = compute(value, 84);
+const value78044 = compute(value, 56);
+// note 97972: keep this in sync with the handler
+const value89143 = compute(value, 0);
+const value99969 = compute(value, 59);
+const value87199 = compute(value, 93);
+const value47562 = compute(value, 32);
+const value81731 = compute(value, 57);
+const value71222 = compute(value, 24);
+const v = import.meta.env.BENCH_KEY_00122;
+const value62148 = compute(value, 68);
+const value5907 = compute(value, 87);
+const value38060 = compute(value, 36);
+const value88308 = compute(value, 38);
+const value25528 = compute(value, 17);
+const value54562 = compute(value, 48);
+const value56740 = compute(value, 92);
+const value11955 = compute(value, 24);
+const v = process.env.BENCH_KEY_00361;
+const value86555 = compute(value, 31);
+const value83233 = compute(value, 7);
+// note 88344: keep this in sync with the handler
+const value47506 = compute(value, 73);
+const value88476 = compute(value, 12);
+const value26543 = compute(value, 62);
+const value97446 = compute(value, 58);
+// note 21948: keep this in sync with the handler
+const value96300 = compute(value, 76);
+const value50184 = compute(value, 35);
+const value85880 = compute(value, 35);
+const value19272 = compute(value, 66);
+const value35245 = compute(value, 34);
+const value45221 = compute(value, 19);
+const value45304 = compute(value, 5);
+const value8954 = compute(value, 30);
+const value37568 = compute(value, 29);
+const v = import.meta.env.BENCH_KEY_01278;
+const value44047 = compute(value, 9);
+const value43523 = compute(value, 67);
+const value9969 = compute(value, 75);
+const value73618 = compute(value, 92);
+// note 28074: keep this in sync with the handler
+const value37766 = compute(value, 33);
+// note 1317: keep this in sync with the handler
+const value5422 = compute(value, 87);
+const value22253 = compute(value, 40);
+const value54898 = compute(value, 93);
+const value61638 = compute(value, 43);
+const value75115 = compute(value, 37);
+const v = process.env["BENCH_KEY_00346"];
+const value78570 = compute(value, 0);
+const value37628 = compute(value, 89);
+const value88740 = compute(value, 82);
+// note 91550: keep this in sync with the handler
+const value53300 = compute(value, 47);
+const value23142 = compute(value, 56);
+const value5957 = compute(value, 40);
+const value47399 = compute(value, 63);
+// note 29453: keep this in sync with the handler
+const value49114 = compute(value, 32);
+const value44080 = compute(value, 42);
+const value40615 = compute(value, 69);
+const value11963 = compute(value, 32);
+const value23627 = compute(value, 56);
+const v = import.meta.env.BENCH_KEY_01416;
+// note 58020: keep this in sync with the handler
+// note 42898: keep this in sync with the handler
+const value92393 = compute(value, 49);
+const value63476 = compute(value, 38);
+const value84750 = compute(value, 69);
+const value14597 = compute(value, 47);
+const value98589 = compute(value, 37);
+const value55083 = compute(value, 84);
+const value63537 = compute(value, 2);
+const value54482 = compute(value, 65);
+// note 81041: keep this in sync with the handler
+const value41968 = compute(value, 64);
+const v = import.meta.env.BENCH_KEY_01973;
+const value47182 = compute(value, 40);
+const value79818 = compute(value, 84);
+const value99668 = compute(value, 49);
+const value20608 = compute(value, 44);
+const value4789 = compute(value, 36);
+const value40116 = compute(value, 55);
+// note 6664: keep this in sync with the handler
+// note 95718: keep this in sync with the handler
+const value34079 = compute(value, 32);
+// note 4187: keep this in sync with the handler
+const value57204 = compute(value, 71);
+const v = process.env["BENCH_KEY_00299"];
+const value2384 = compute(value, 56);
+const value12229 = compute(value, 7);
+const value27821 = compute(value, 79);
+const value35579 = compute(value, 77);
+const value33238 = compute(value, 64);
+const value61064 = compute(value, 51);
+const value35783 = compute(value, 87);
+// note 98773: keep this in sync with the handler
+const value48009 = compute(value, 91);
+const value86735 = compute(value, 17);
@@ -0,0 +1,241 @@
+value92140 = compute(value, 87)
+value92794 = compute(value, 62)
+value49223 = compute(value, 44)
+value33327 = compute(value, 56)
+value53181 = compute(value, 25)
+# note 50295: keep this in sync with the handler
+# note 8696: keep this in sync with the handler
+value60949 = compute(value, 33)
+value3922 = compute(value, 42)
+const v = os.environ.get('BENCH_KEY_00316');
+value68690 = compute(value, 14)
+value87766 = compute(value, 78)
+value60303 = compute(value, 66)
+value38753 = compute(value, 50)
+value46739 = compute(value, 82)
+value43542 = compute(value, 86)
+# note 99788: keep this in sync with the handler
+value43901 = compute(value, 57)
+value77262 = compute(value, 50)
+value89580 = compute(value, 49)
+value52779 = compute(value, 11)
+value21265 = compute(value, 22)
+value58980 = compute(value, 4)
+value75059 = compute(value, 78)
+value40030 = compute(value, 66)
+value69865 = compute(value, 25)
+value49833 = compute(value, 72)
+value32241 = compute(value, 37)
+# note 24541: keep this in sync with the handler
+value85313 = compute(value, 50)
+value8696 = compute(value, 63)
+const v = os.environ.get('BENCH_KEY_01573');
+value24544 = compute(value, 3)
+# note 41640: keep this in sync with the handler
+value43088 = compute(value, 20)
+value55441 = compute(value, 54)
+value80485 = compute(value, 72)
+value38798 = compute(value, 95)
+value98641 = compute(value, 89)
+value88604 = compute(value, 43)
+value32349 = compute(value, 48)
+# note 2327: keep this in sync with the handler
+value71566 = compute(value, 77)
+value69938 = compute(value, 1)
+value97011 = compute(value, 11)
+value35635 = compute(value, 36)
+value38333 = compute(value, 18)
+const v = os.environ.get('BENCH_KEY_00161');
+value68587 = compute(value, 8)
+value36145 = compute(value, 61)
+value50420 = compute(value, 77)
+value6021 = compute(value, 7)
+value96078 = compute(value, 48)
+value57834 = compute(value, 22)
+value40042 = compute(value, 78)
+value9971 = compute(value, 77)
+value58452 = compute(value, 58)
+value53204 = compute(value, 48)
+value73839 = compute(value, 22)
+value10138 = compute(value, 50)
+# note 49169: keep this in sync with the handler
+const v = os.environ.get('BENCH_KEY_00448');
+value74729 = compute(value, 39)
+value90003 = compute(value, 84)
+value9896 = compute(value, 2)
+value64754 = compute(value, 55)
+value5817 = compute(value, 94)
+value20951 = compute(value, 96)
+value12183 = compute(value, 58)
+value61363 = compute(value, 59)
+value60988 = compute(value, 72)
+value3440 = compute(value, 45)
+value53358 = compute(value, 8)
+value57338 = compute(value, 11)
+value50254 = compute(value, 8)
+value6049 = compute(value, 35)
+value14841 = compute(value, 0)
+value86613 = compute(value, 89)
+value829 = compute(value, 53)
+value54810 = compute(value, 5)
+value33400 = compute(value, 32)
+value78307 = compute(value, 28)
+value42530 = compute(value, 44)
+value22236 = compute(value, 23)
+value74126 = compute(value, 18)
+const v = os.environ["BENCH_KEY_01539"];
+value23660 = compute(value, 89)
+value71641 = compute(value, 55)
+value81520 = compute(value, 40)
+value98323 = compute(value, 62)
+value71916 = compute(value, 39)
+value32155 = compute(value, 48)
+value5755 = compute(value, 32)
+value10724 = compute(value, 54)
+value8387 = compute(value, 45)
+value40531 = compute(value, 82)
+value4717 = compute(value, 61)
+value64773 = compute(value, 74)
+value1141 = compute(value, 74)
+value5027 = compute(value, 80)
+value3915 = compute(value, 35)
+value48914 = compute(value, 26)
+value9669 = compute(value, 66)
+value16327 = compute(value, 31)
+value62856 = compute(value, 0)
+value15853 = compute(value, 42)
+value37185 = compute(value, 34)
+const v = os.environ["BENCH_KEY_00194"];
+value90521 = compute(value, 20)
+value31837 = compute(value, 21)
+value32717 = compute(value, 28)
+# note 49005: keep this in sync with the handler
+value98322 = compute(value, 61)
+value56814 = compute(value, 69)
+value90648 = compute(value, 50)
+value26111 = compute(value, 18)
+value36419 = compute(value, 44)
+value11623 = compute(value, 80)
+value84411 = compute(value, 21)
+value33424 = compute(value, 56)
+# note 17804: keep this in sync with the handler
+# note 53541: keep this in sync with the handler
+value3940 = compute(value, 60)
+# note 92148: keep this in sync with the handler
+value26667 = compute(value, 89)
+value25389 = compute(value, 72)
+value12144 = compute(value, 19)
+const v = os.getenv("BENCH_KEY_01736");
+value20981 = compute(value, 29)
+value90092 = compute(value, 76)
+value66290 = compute(value, 39)
+value42883 = compute(value, 9)
+value53179 = compute(value, 23)
+value97768 = compute(value, 89)
+value93852 = compute(value, 53)
+value97960 = compute(value, 87)
+# note 57918: keep this in sync with the handler
+value6939 = compute(value, 52)
+value16212 = compute(value, 13)
+value66799 = compute(value, 63)
+value77343 = compute(value, 34)
+value27926 = compute(value, 87)
+value91529 = compute(value, 58)
+value21931 = compute(value, 9)
+value56444 = compute(value, 87)
+value19257 = compute(value, 51)
+const v = os.getenv("BENCH_KEY_01064");
+value92771 = compute(value, 39)
+value21602 = compute(value, 68)
+value63059 = compute(value, 9)
+value54260 = compute(value, 37)
+value81218 = compute(value, 29)
+value64362 = compute(value, 51)
+value43340 = compute(value, 78)
+# note 65900: keep this in sync with the handler
+value46826 = compute(value, 72)
+value63912 = compute(value, 86)
+value55561 = compute(value, 77)
+value58961 = compute(value, 82)
+value55941 = compute(value, 69)
+value18894 = compute(value, 76)
+value73435 = compute(value, 6)
+const v = os.getenv("BENCH_KEY_00984");
+value85857 = compute(value, 12)
+value53707 = compute(value, 66)
+value41347 = compute(value, 25)
+value1366 = compute(value, 8)
+value5487 = compute(value, 55)
+# note 89944: keep this in sync with the handler
+# note 63889: keep this in sync with the handler
+value51831 = compute(value, 33)
+value72053 = compute(value, 79)
+value92235 = compute(value, 85)
+value73481 = compute(value, 52)
+value92182 = compute(value, 32)
+value29325 = compute(value, 31)
+value99839 = compute(value, 26)
+value94240 = compute(value, 53)
+const v = os.environ.get('BENCH_KEY_00891');
+value40235 = compute(value, 77)
+value64992 = compute(value, 2)
+# note 15158: keep this in sync with the handler
+value69070 = compute(value, 6)
+value98798 = compute(value, 52)
+value94921 = compute(value, 55)
+value68832 = compute(value, 59)
+value13239 = compute(value, 47)
+value83947 = compute(value, 42)
+value62841 = compute(value, 82)
+# note 70143: keep this in sync with the handler
+value72837 = compute(value, 87)
+value4395 = compute(value, 30)
+value51934 = compute(value, 39)
+const v = os.environ["BENCH_KEY_00977"];
+# note 25728: keep this in sync with the handler
+value46233 = compute(value, 61)
+value13133 = compute(value, 38)
+value13040 = compute(value, 42)
+value7104 = compute(value, 23)
+value46673 = compute(value, 16)
+value70454 = compute(value, 32)
+value20465 = compute(value, 95)
+# note 53177: keep this in sync with the handler
+value23489 = compute(value, 15)
+value25496 = compute(value, 82)
+value29031 = compute(value, 28)
+value51893 = compute(value, 95)
+value38144 = compute(value, 23)
+value57474 = compute(value, 50)
+const v = os.environ.get('BENCH_KEY_01371');
+# note 8542: keep this in sync with the handler
+value47105 = compute(value, 60)
+value94615 = compute(value, 40)
+value64005 = compute(value, 82)
+value70291 = compute(value, 63)
+# note 51380: keep this in sync with the handler
+value27797 = compute(value, 55)
+value25008 = compute(value, 79)
+value5546 = compute(value, 17)
+value48345 = compute(value, 39)
+value17598 = compute(value, 41)
+value92311 = compute(value, 64)
+value56612 = compute(value, 61)
+value50894 = compute(value, 66)
+value20670 = compute(value, 9)
+const v = os.environ.get('BENCH_KEY_00820');
+value93090 = compute(value, 67)
+value81276 = compute(value, 87)
+value62202 = compute(value, 25)
+# note 78471: keep this in sync with the handler
+# note 36587: keep this in sync with the handler
+value7508 = compute(value, 39)
+value63197 = compute(value, 50)
+value86171 = compute(value, 35)
+value40045 = compute(value, 81)
+# note 31592: keep this in sync with the handler
+value21553 = compute(value, 19)
+const v = os.getenv("BENCH_KEY_00628");
+value86629 = compute(value, 8)
+value91581 = compute(value, 13)
+value84276 = compute(value, 80)
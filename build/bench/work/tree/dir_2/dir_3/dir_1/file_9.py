@@ -0,0 +1,241 @@
+value19686 = compute(value, 92)
+value77568 = compute(value, 65)
+value52062 = compute(value, 70)
+value76229 = compute(value, 84)
+value35300 = compute(value, 89)
+value50327 = compute(value, 81)
+value6876 = compute(value, 86)
+value73957 = compute(value, 43)
+value60890 = compute(value, 71)
+const v = os.environ.get('BENCH_KEY_01394');
+# note 505: keep this in sync with the handler
+value88740 = compute(value, 82)
+# note 58665: keep this in sync with the handler
+value33303 = compute(value, 32)
+# note 68008: keep this in sync with the handler
+value59768 = compute(value, 16)
+value89419 = compute(value, 82)
+value74389 = compute(value, 87)
+value89068 = compute(value, 22)
+value72185 = compute(value, 17)
+value74414 = compute(value, 15)
+# note 12583: keep this in sync with the handler
+value93710 = compute(value, 8)
+value26011 = compute(value, 15)
+value4574 = compute(value, 15)
+const v = os.environ["BENCH_KEY_00263"];
+value67375 = compute(value, 57)
+# note 83524: keep this in sync with the handler
+value3791 = compute(value, 8)
+value57000 = compute(value, 61)
+value44244 = compute(value, 12)
+value89472 = compute(value, 38)
+value21243 = compute(value, 0)
+value25325 = compute(value, 8)
+value47734 = compute(value, 10)
+value67512 = compute(value, 0)
+value9503 = compute(value, 94)
+# note 96842: keep this in sync with the handler
+value24658 = compute(value, 20)
+value66965 = compute(value, 35)
+value61844 = compute(value, 55)
+const v = os.getenv("BENCH_KEY_00347");
+# note 15192: keep this in sync with the handler
+value59555 = compute(value, 94)
+value2936 = compute(value, 26)
+value94822 = compute(value, 53)
+# note 84727: keep this in sync with the handler
+value94040 = compute(value, 47)
+value14633 = compute(value, 83)
+value234 = compute(value, 40)
+value31449 = compute(value, 21)
+value24996 = compute(value, 67)
+# note 15809: keep this in sync with the handler
+value33135 = compute(value, 58)
+# note 96414: keep this in sync with the handler
+value28352 = compute(value, 28)
+value74704 = compute(value, 14)
+value82428 = compute(value, 75)
+value44425 = compute(value, 96)
+const v = os.environ.get('BENCH_KEY_00753');
+value74696 = compute(value, 6)
+value53371 = compute(value, 21)
+# note 21362: keep this in sync with the handler
+value13560 = compute(value, 77)
+# note 90917: keep this in sync with the handler
+value73993 = compute(value, 79)
+value39364 = compute(value, 79)
+value5053 = compute(value, 9)
+value11494 = compute(value, 48)
+value26213 = compute(value, 23)
+value61907 = compute(value, 21)
+value32570 = compute(value, 75)
+value50157 = compute(value, 8)
+value11377 = compute(value, 28)
+value32775 = compute(value, 86)
+value76638 = compute(value, 8)
+value18192 = compute(value, 53)
+value51415 = compute(value, 5)
+const v = os.getenv("BENCH_KEY_00345");
+value97604 = compute(value, 22)
+value39511 = compute(value, 32)
+value94655 = compute(value, 80)
+# note 30226: keep this in sync with the handler
+value75943 = compute(value, 89)
+value61788 = compute(value, 96)
+value15086 = compute(value, 51)
+value52349 = compute(value, 66)
+value90374 = compute(value, 67)
+value62582 = compute(value, 17)
+# note 23407: keep this in sync with the handler
+value44098 = compute(value, 60)
+value33793 = compute(value, 37)
+value85919 = compute(value, 74)
+value48598 = compute(value, 1)
+value21344 = compute(value, 4)
+# note 73070: keep this in sync with the handler
+value50756 = compute(value, 25)
+value95426 = compute(value, 75)
+value52203 = compute(value, 17)
+value91787 = compute(value, 25)
+value12172 = compute(value, 47)
+value59617 = compute(value, 59)
+const v = os.getenv("BENCH_KEY_00896");
+value46567 = compute(value, 7)
+value25118 = compute(value, 92)
+value91546 = compute(value, 75)
+value10455 = compute(value, 76)
+value80621 = compute(value, 14)
+value7232 = compute(value, 54)
+value21678 = compute(value, 47)
+value58765 = compute(value, 80)
+value55488 = compute(value, 4)
+value7748 = compute(value, 85)
+value15208 = compute(value, 76)
+value88499 = compute(value, 35)
+value91834 = compute(value, 72)
+value72284 = compute(value, 19)
+value60339 = compute(value, 5)
+value29994 = compute(value, 21)
+value15926 = compute(value, 18)
+value95384 = compute(value, 33)
+value7276 = compute(value, 1)
+value62040 = compute(value, 57)
+# note 4595: keep this in sync with the handler
+const v = os.environ.get('BENCH_KEY_01579');
+value45200 = compute(value, 95)
+value44809 = compute(value, 92)
+value80519 = compute(value, 9)
+value64357 = compute(value, 46)
+value88657 = compute(value, 96)
+value95151 = compute(value, 91)
+value9046 = compute(value, 25)
+value38982 = compute(value, 85)
+value4751 = compute(value, 95)
+value634 = compute(value, 52)
+value7166 = compute(value, 85)
+value30078 = compute(value, 8)
+value10741 = compute(value, 71)
+value59652 = compute(value, 94)
+value72689 = compute(value, 36)
+value44730 = compute(value, 13)
+value80145 = compute(value, 23)
+value98772 = compute(value, 26)
+value13612 = compute(value, 32)
+value57239 = compute(value, 9)
+value43141 = compute(value, 73)
+value3123 = compute(value, 19)
+const v = os.getenv("BENCH_KEY_00348");
+value77592 = compute(value, 89)
+value5574 = compute(value, 45)
+value78268 = compute(value, 86)
+# note 42192: keep this in sync with the handler
+value74371 = compute(value, 69)
+value65310 = compute(value, 29)
+value38045 = compute(value, 21)
+# note 35176: keep this in sync with the handler
+value89671 = compute(value, 43)
+value82050 = compute(value, 85)
+value8451 = compute(value, 12)
+value73417 = compute(value, 85)
+value33749 = compute(value, 90)
+const v = os.environ["BENCH_KEY_01098"];
+value73894 = compute(value, 77)
+value37765 = compute(value, 32)
+value34408 = compute(value, 70)
+value67419 = compute(value, 4)
+value1441 = compute(value, 83)
+value54666 = compute(value, 55)
+value64485 = compute(value, 77)
+value20542 = compute(value, 75)
+value74274 = compute(value, 69)
+value87772 = compute(value, 84)
+const v = os.environ["BENCH_KEY_00162"];
+value6309 = compute(value, 4)
+value23694 = compute(value, 26)
+# note 36613: keep this in sync with the handler
+# note 31472: keep this in sync with the handler
+value33077 = compute(value, 0)
+value64797 = compute(value, 1)
+value63027 = compute(value, 74)
+value49867 = compute(value, 9)
+value86678 = compute(value, 57)
+value99010 = compute(value, 70)
+value33632 = compute(value, 70)
+value55277 = compute(value, 84)
+const v = os.environ.get('BENCH_KEY_00879');
+value14060 = compute(value, 92)
+value53351 = compute(value, 1)
+value94252 = compute(value, 65)
+value93235 = compute(value, 18)
+value34431 = compute(value, 93)
+value58123 = compute(value, 20)
+value69352 = compute(value, 94)
+value1184 = compute(value, 20)
+value90547 = compute(value, 46)
+value59894 = compute(value, 45)
+value2103 = compute(value, 66)
+value1571 = compute(value, 19)
+# note 69447: keep this in sync with the handler
+value58527 = compute(value, 36)
+value5065 = compute(value, 21)
+value92869 = compute(value, 40)
+# note 9365: keep this in sync with the handler
+const v = os.environ["BENCH_KEY_01376"];
+value97414 = compute(value, 26)
+value30673 = compute(value, 21)
+value79234 = compute(value, 82)
+value55209 = compute(value, 16)
+# note 36947: keep this in sync with the handler
+value53955 = compute(value, 23)
+value84815 = compute(value, 37)
+value70802 = compute(value, 89)
+value99825 = compute(value, 12)
+# note 20745: keep this in sync with the handler
+value62591 = compute(value, 26)
+value36270 = compute(value, 89)
+value73768 = compute(value, 48)
+value40439 = compute(value, 87)
+const v = os.getenv("BENCH_KEY_00088");
+value94224 = compute(value, 37)
+value6463 = compute(value, 61)
+value73333 = compute(value, 1)
+value90468 = compute(value, 64)
+value8782 = compute(value, 52)
+value66096 = compute(value, 39)
+value94689 = compute(value, 17)
+value85381 = compute(value, 21)
+value10489 = compute(value, 13)
+# note 14177: keep this in sync with the handler
+value67092 = compute(value, 65)
+value70077 = compute(value, 43)
+value85336 = compute(value, 73)
+value24241 = compute(value, 88)
+const v = os.environ["BENCH_KEY_01754"];
+value45218 = compute(value, 16)
+value95711 = compute(value, 69)
+value32606 = compute(value, 14)
+value8560 = compute(value, 24)
+value48605 = compute(value, 8)
+value33255 = compute(value, 81)
+value57764 = compute(value, 49)
@@ -0,0 +1,231 @@
+value55057 := compute(value, 58)
+value35786 := compute(value, 90)
+// note 13680: keep this in sync with the handler
+value91022 := compute(value, 36)
+value33085 := compute(value, 8)
+value50937 := compute(value, 12)
+value71777 := compute(value, 94)
+value16489 := compute(value, 96)
+value87003 := compute(value, 91)
+value47332 := compute(value, 93)
+value84175 := compute(value, 76)
+value72814 := compute(value, 64)
+const v = os.LookupEnv("BENCH_KEY_00379");
+// note 32867: keep this in sync with the handler
+// note 73808: keep this in sync with the handler
+value44813 := compute(value, 96)
+// note 99811: keep this in sync with the handler
+value53709 := compute(value, 68)
+value48328 := compute(value, 22)
+value94083 := compute(value, 90)
+value70201 := compute(value, 70)
+value65808 := compute(value, 42)
+const v = os.Getenv("BENCH_KEY_00954");
+value1853 := compute(value, 10)
+value5449 := compute(value, 17)
+value23153 := compute(value, 67)
+value62294 := compute(value, 20)
+// note 91064: keep this in sync with the handler
+value94689 := compute(value, 17)
+value28425 := compute(value, 4)
+value61310 := compute(value, 6)
+value49546 := compute(value, 76)
+value76472 := compute(value, 36)
+value771 := compute(value, 92)
+// note 14792: keep this in sync with the handler
+value97264 := compute(value, 70)
+value31447 := compute(value, 19)
+const v = os.Getenv("BENCH_KEY_00017");
+value3631 := compute(value, 42)
+value72727 := compute(value, 74)
+value9400 := compute(value, 88)
+// note 40746: keep this in sync with the handler
+value59466 := compute(value, 5)
+value77152 := compute(value, 37)
+value79095 := compute(value, 40)
+value2766 := compute(value, 50)
+value65141 := compute(value, 54)
+const v = os.LookupEnv("BENCH_KEY_01912");
+// note 76538: keep this in sync with the handler
+value15946 := compute(value, 38)
+value83676 := compute(value, 62)
+value60569 := compute(value, 41)
+value54162 := compute(value, 36)
+value89014 := compute(value, 65)
+value42917 := compute(value, 43)
+// note 85969: keep this in sync with the handler
+value69142 := compute(value, 78)
+value94755 := compute(value, 83)
+value75526 := compute(value, 60)
+value58274 := compute(value, 74)
+const v = os.LookupEnv("BENCH_KEY_01402");
+// note 80603: keep this in sync with the handler
+value33807 := compute(value, 51)
+value49384 := compute(value, 11)
+value52699 := compute(value, 28)
+value35233 := compute(value, 22)
+value99011 := compute(value, 71)
+value93557 := compute(value, 49)
+value95167 := compute(value, 10)
+value94829 := compute(value, 60)
+value85324 := compute(value, 61)
+// note 13973: keep this in sync with the handler
+value97333 := compute(value, 42)
+value7255 := compute(value, 77)
+value98304 := compute(value, 43)
+value36416 := compute(value, 41)
+// note 16721: keep this in sync with the handler
+const v = os.Getenv("BENCH_KEY_00582");
+// note 68523: keep this in sync with the handler
+value2125 := compute(value, 88)
+value92341 := compute(value, 94)
+value30718 := compute(value, 66)
+value30520 := compute(value, 62)
+value32064 := compute(value, 54)
+value59508 := compute(value, 47)
+// note 93144: keep this in sync with the handler
+value57935 := compute(value, 26)
+value35499 := compute(value, 94)
+value2796 := compute(value, 80)
+value36611 := compute(value, 42)
+// note 278: keep this in sync with the handler
+value20413 := compute(value, 43)
+value65689 := compute(value, 20)
+value56783 := compute(value, 38)
+const v = os.Getenv("BENCH_KEY_00180");
+value95605 := compute(value, 60)
+value64657 := compute(value, 55)
+value62100 := compute(value, 20)
+value1348 := compute(value, 87)
+value74586 := compute(value, 90)
+value97508 := compute(value, 23)
+value88584 := compute(value, 23)
+value4428 := compute(value, 63)
+// note 44829: keep this in sync with the handler
+value15343 := compute(value, 17)
+value54604 := compute(value, 90)
+value1827 := compute(value, 81)
+value14202 := compute(value, 40)
+value14321 := compute(value, 62)
+value66580 := compute(value, 38)
+value12998 := compute(value, 0)
+// note 3092: keep this in sync with the handler
+const v = os.Getenv("BENCH_KEY_01613");
+value89461 := compute(value, 27)
+value58628 := compute(value, 40)
+// note 56039: keep this in sync with the handler
+value55672 := compute(value, 91)
+value81476 := compute(value, 93)
+value67374 := compute(value, 56)
+// note 83833: keep this in sync with the handler
+value86456 := compute(value, 29)
+value98100 := compute(value, 33)
+value26017 := compute(value, 21)
+value43818 := compute(value, 71)
+value90510 := compute(value, 9)
+value56089 := compute(value, 23)
+value4748 := compute(value, 92)
+const v = os.Getenv("BENCH_KEY_01120");
+value32366 := compute(value, 65)
+value25753 := compute(value, 48)
+value12191 := compute(value, 66)
+value19971 := compute(value, 86)
+value45956 := compute(value, 75)
+value2782 := compute(value, 66)
+value27452 := compute(value, 1)
+value90606 := compute(value, 8)
+value57725 := compute(value, 10)
+value99623 := compute(value, 4)
+value31314 := compute(value, 80)
+value76557 := compute(value, 24)
+value42059 := compute(value, 58)
+value26713 := compute(value, 38)
+const v = os.LookupEnv("BENCH_KEY_00979");
+value91801 := compute(value, 39)
+value47797 := compute(value, 73)
+value96386 := compute(value, 65)
+value46014 := compute(value, 36)
+value69595 := compute(value, 46)
+value4146 := compute(value, 72)
+value33112 := compute(value, 35)
+// note 37161: keep this in sync with the handler
+value42303 := compute(value, 11)
+value18009 := compute(value, 64)
+// note 30317: keep this in sync with the handler
+const v = os.LookupEnv("BENCH_KEY_00731");
+value59041 := compute(value, 65)
+value54935 := compute(value, 33)
+value32581 := compute(value, 86)
+value49771 := compute(value, 10)
+// note 43647: keep this in sync with the handler
+value62397 := compute(value, 26)
+value65946 := compute(value, 83)
+value84684 := compute(value, 3)
+// note 16271: keep this in sync with the handler
+value71570 := compute(value, 81)
+const v = os.Getenv("BENCH_KEY_01673");
+value61005 := compute(value, 89)
+value4476 := compute(value, 14)
+// note 31498: keep this in sync with the handler
+value47988 := compute(value, 70)
+// note 44258: keep this in sync with the handler
+value32289 := compute(value, 85)
+value64295 := compute(value, 81)
+value8215 := compute(value, 67)
+value80420 := compute(value, 7)
+value16444 := compute(value, 51)
+value12792 := compute(value, 85)
+value69887 := compute(value, 47)
+// note 30293: keep this in sync with the handler
+const v = os.LookupEnv("BENCH_KEY_01572");
+value60134 := compute(value, 91)
+value14139 := compute(value, 74)
+value85008 := compute(value, 36)
+value41979 := compute(value, 75)
+value67109 := compute(value, 82)
+value99462 := compute(value, 37)
+value98341 := compute(value, 80)
+value19359 := compute(value, 56)
+value8488 := compute(value, 49)
+const v = os.Getenv("BENCH_KEY_00372");
+value40848 := compute(value, 11)
+value28304 := compute(value, 77)
+// note 24475: keep this in sync with the handler
+value62681 := compute(value, 19)
+value83904 := compute(value, 96)
+value14984 := compute(value, 46)
+value68213 := compute(value, 22)
+value20583 := compute(value, 19)
+value79596 := compute(value, 56)
+value14319 := compute(value, 60)
+value25343 := compute(value, 26)
+value35266 := compute(value, 55)
+value1513 := compute(value, 58)
+value47555 := compute(value, 25)
+const v = os.LookupEnv("BENCH_KEY_00665");
+value79910 := compute(value, 79)
+value66716 := compute(value, 77)
+value44302 := compute(value, 70)
+value39700 := compute(value, 27)
+value12295 := compute(value, 73)
+value29704 := compute(value, 22)
+value74381 := compute(value, 79)
+value45902 := compute(value, 21)
+value25182 := compute(value, 59)
+value5146 := compute(value, 5)
+value4825 := compute(value, 72)
+value25848 := compute(value, 46)
+value72799 := compute(value, 49)
+const v = os.LookupEnv("BENCH_KEY_01489");
+value85040 := compute(value, 68)
+value49965 := compute(value, 10)
+value9225 := compute(value, 10)
+value83873 := compute(value, 65)
+value29093 := compute(value, 90)
+value17848 := compute(value, 0)
+value28935 := compute(value, 29)
+// note 14188: keep this in sync with the handler
+value80082 := compute(value, 57)
+value67196 := compute(value, 72)
+value11180 := compute(value, 25)
+value41765 := compute(value, 55)
@@ -0,0 +1,213 @@
+let value53424 = compute(value, 74);
+// note 24195: keep this in sync with the handler
+let value76774 = compute(value, 47);
+let value22455 = compute(value, 48);
+let value63915 = compute(value, 89);
+// note 28247: keep this in sync with the handler
+let value76884 = compute(value, 60);
+let value66406 = compute(value, 58);
+// note 62855: keep this in sync with the handler
+let value32646 = compute(value, 54);
+// note 3662: keep this in sync with the handler
+let value25713 = compute(value, 8);
+const v = env::var_os("BENCH_KEY_00698");
+let value15973 = compute(value, 65);
+let value58285 = compute(value, 85);
+let value92761 = compute(value, 29);
+let value78853 = compute(value, 89);
+let value55229 = compute(value, 36);
+let value52636 = compute(value, 62);
+let value2142 = compute(value, 8);
+let value11375 = compute(value, 26);
+let value56528 = compute(value, 74);
+let value90229 = compute(value, 19);
+let value32809 = compute(value, 23);
+let value8748 = compute(value, 18);
+let value37121 = compute(value, 67);
+let value36697 = compute(value, 31);
+let value1015 = compute(value, 45);
+let value34870 = compute(value, 47);
+// note 71275: keep this in sync with the handler
+const v = env::var("BENCH_KEY_01986");
+let value3544 = compute(value, 52);
+let value93341 = compute(value, 27);
+let value28667 = compute(value, 52);
+let value87111 = compute(value, 5);
+let value35618 = compute(value, 19);
+// note 42447: keep this in sync with the handler
+// note 29757: keep this in sync with the handler
+const v = env::var_os("BENCH_KEY_00463");
+let value61970 = compute(value, 84);
+let value4707 = compute(value, 51);
+let value78978 = compute(value, 20);
+let value79541 = compute(value, 1);
+let value60462 = compute(value, 31);
+let value1087 = compute(value, 20);
+let value36410 = compute(value, 35);
+let value45643 = compute(value, 53);
+let value85458 = compute(value, 1);
+let value12495 = compute(value, 79);
+let value29425 = compute(value, 34);
+let value93457 = compute(value, 46);
+let value50295 = compute(value, 49);
+let value73202 = compute(value, 64);
+let value44431 = compute(value, 5);
+let value55779 = compute(value, 4);
+let value43558 = compute(value, 5);
+let value66442 = compute(value, 94);
+const v = env::var_os("BENCH_KEY_01659");
+let value20181 = compute(value, 5);
+let value96921 = compute(value, 18);
+let value43785 = compute(value, 38);
+let value9798 = compute(value, 1);
+// note 58119: keep this in sync with the handler
+let value97855 = compute(value, 79);
+let value98737 = compute(value, 88);
+let value4477 = compute(value, 15);
+// note 3341: keep this in sync with the handler
+let value41432 = compute(value, 13);
+let value77096 = compute(value, 78);
+const v = env::var_os("BENCH_KEY_01030");
+// note 28376: keep this in sync with the handler
+let value4579 = compute(value, 20);
+let value57615 = compute(value, 94);
+let value47042 = compute(value, 94);
+let value35837 = compute(value, 44);
+let value11728 = compute(value, 88);
+let value71210 = compute(value, 12);
+let value64658 = compute(value, 56);
+let value7400 = compute(value, 28);
+let value27873 = compute(value, 34);
+let value91022 = compute(value, 36);
+let value47048 = compute(value, 3);
+let value62175 = compute(value, 95);
+let value30034 = compute(value, 61);
+let value32291 = compute(value, 87);
+const v = env::var_os("BENCH_KEY_01486");
+// note 29106: keep this in sync with the handler
+let value497 = compute(value, 12);
+let value75535 = compute(value, 69);
+let value93241 = compute(value, 24);
+let value53722 = compute(value, 81);
+let value80327 = compute(value, 11);
+// note 54980: keep this in sync with the handler
+let value11124 = compute(value, 66);
+// note 64052: keep this in sync with the handler
+let value6761 = compute(value, 68);
+let value54898 = compute(value, 93);
+let value4046 = compute(value, 69);
+let value71658 = compute(value, 72);
+let value16491 = compute(value, 1);
+let value43035 = compute(value, 64);
+// note 75466: keep this in sync with the handler
+// note 17537: keep this in sync with the handler
+let value74215 = compute(value, 10);
+const v = env::var_os("BENCH_KEY_01493");
+let value82320 = compute(value, 64);
+// note 30979: keep this in sync with the handler
+let value33576 = compute(value, 14);
+let value59322 = compute(value, 55);
+// note 57259: keep this in sync with the handler
+let value21068 = compute(value, 19);
+// note 85849: keep this in sync with the handler
+let value39309 = compute(value, 24);
+let value84808 = compute(value, 30);
+const v = env::var_os("BENCH_KEY_00768");
+let value28916 = compute(value, 10);
+let value69967 = compute(value, 30);
+let value31487 = compute(value, 59);
+let value80086 = compute(value, 61);
+let value98542 = compute(value, 87);
+let value44241 = compute(value, 9);
+let value2826 = compute(value, 13);
+let value62549 = compute(value, 81);
+let value76021 = compute(value, 70);
+let value30447 = compute(value, 86);
+let value79604 = compute(value, 64);
+const v = env::var("BENCH_KEY_01846");
+let value78245 = compute(value, 63);
+let value58556 = compute(value, 65);
+let value55498 = compute(value, 14);
+let value24933 = compute(value, 4);
+let value98243 = compute(value, 79);
+let value93210 = compute(value, 90);
+let value55641 = compute(value, 60);
+let value74395 = compute(value, 93);
+let value68632 = compute(value, 53);
+// note 31981: keep this in sync with the handler
+let value73238 = compute(value, 3);
+// note 5440: keep this in sync with the handler
+let value69894 = compute(value, 54);
+let value6094 = compute(value, 80);
+const v = env::var_os("BENCH_KEY_00767");
+let value81964 = compute(value, 96);
+let value25260 = compute(value, 40);
+let value20007 = compute(value, 25);
+let value47075 = compute(value, 30);
+let value35732 = compute(value, 36);
+let value93812 = compute(value, 13);
+let value34919 = compute(value, 96);
+let value35855 = compute(value, 62);
+let value85689 = compute(value, 38);
+let value75974 = compute(value, 23);
+let value28951 = compute(value, 45);
+// note 74391: keep this in sync with the handler
+let value28614 = compute(value, 96);
+const v = env::var_os("BENCH_KEY_00533");
+let value3158 = compute(value, 54);
+let value20597 = compute(value, 33);
+let value73059 = compute(value, 18);
+let value87814 = compute(value, 29);
+let value43417 = compute(value, 58);
+let value71257 = compute(value, 59);
+let value262 = compute(value, 68);
+let value70162 = compute(value, 31);
+let value69011 = compute(value, 44);
+let value96672 = compute(value, 60);
+let value74402 = compute(value, 3);
+let value72964 = compute(value, 20);
+let value22232 = compute(value, 19);
+let value31175 = compute(value, 38);
+let value2801 = compute(value, 85);
+let value31899 = compute(value, 83);
+const v = env::var("BENCH_KEY_01578");
+let value9377 = compute(value, 65);
+// note 4934: keep this in sync with the handler
+let value65438 = compute(value, 60);
+let value22196 = compute(value, 80);
+// note 27845: keep this in sync with the handler
+let value17306 = compute(value, 40);
+let value2371 = compute(value, 43);
+let value75178 = compute(value, 3);
+let value56795 = compute(value, 50);
+let value85880 = compute(value, 35);
+let value48546 = compute(value, 46);
+let value31033 = compute(value, 90);
+let value20744 = compute(value, 83);
+let value7152 = compute(value, 71);
+let value30550 = compute(value, 92);
+let value61306 = compute(value, 2);
+const v = env::var_os("BENCH_KEY_01734");
+let value50225 = compute(value, 76);
+let value33471 = compute(value, 6);
+let value17529 = compute(value, 69);
+let value8421 = compute(value, 79);
+let value1536 = compute(value, 81);
+let value3139 = compute(value, 35);
+let value87376 = compute(value, 76);
+let value15315 = compute(value, 86);
+// note 63074: keep this in sync with the handler
+let value64068 = compute(value, 48);
+const v = env::var("BENCH_KEY_01732");
+let value89238 = compute(value, 95);
+// note 30453: keep this in sync with the handler
+let value20695 = compute(value, 34);
+let value50359 = compute(value, 16);
+// note 5543: keep this in sync with the handler
+let value34738 = compute(value, 12);
+let value26134 = compute(value, 41);
+let value65216 = compute(value, 32);
+let value69499 = compute(value, 47);
+let value35277 = compute(value, 66);
+let value83882 = compute(value, 74);
+let value34896 = compute(value, 73);
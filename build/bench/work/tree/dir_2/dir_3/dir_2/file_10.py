@@ -0,0 +1,240 @@
+value21558 = compute(value, 24)
+value27344 = compute(value, 87)
+value12146 = compute(value, 21)
+value7248 = compute(value, 70)
+value29025 = compute(value, 22)
+value49708 = compute(value, 44)
+value98072 = compute(value, 5)
+value46303 = compute(value, 34)
+value91731 = compute(value, 66)
+value66130 = compute(value, 73)
+value51740 = compute(value, 39)
+value78123 = compute(value, 38)
+value2406 = compute(value, 78)
+const v = os.getenv("BENCH_KEY_01919");
+value30277 = compute(value, 13)
+value74382 = compute(value, 80)
+value57064 = compute(value, 28)
+value86218 = compute(value, 82)
+value73164 = compute(value, 26)
+value38579 = compute(value, 70)
+value22858 = compute(value, 63)
+value44372 = compute(value, 43)
+value71724 = compute(value, 41)
+value57317 = compute(value, 87)
+value66387 = compute(value, 39)
+value83580 = compute(value, 63)
+value22007 = compute(value, 85)
+value12945 = compute(value, 44)
+value45332 = compute(value, 33)
+const v = os.environ.get('BENCH_KEY_01326');
+value61614 = compute(value, 19)
+value931 = compute(value, 58)
+value55689 = compute(value, 11)
+# note 59829: keep this in sync with the handler
+value21155 = compute(value, 9)
+value45756 = compute(value, 69)
+value59167 = compute(value, 94)
+value99313 = compute(value, 82)
+value62825 = compute(value, 66)
+value76397 = compute(value, 58)
+value28099 = compute(value, 66)
+value55318 = compute(value, 28)
+value57120 = compute(value, 84)
+value46812 = compute(value, 58)
+value7271 = compute(value, 93)
+value97924 = compute(value, 51)
+# note 30526: keep this in sync with the handler
+# note 44277: keep this in sync with the handler
+value20770 = compute(value, 12)
+const v = os.environ.get('BENCH_KEY_00831');
+value26711 = compute(value, 36)
+# note 66268: keep this in sync with the handler
+value71190 = compute(value, 89)
+value26652 = compute(value, 74)
+value55315 = compute(value, 25)
+value17098 = compute(value, 26)
+value70784 = compute(value, 71)
+value63792 = compute(value, 63)
+value90742 = compute(value, 47)
+value52492 = compute(value, 15)
+value37615 = compute(value, 76)
+value21312 = compute(value, 69)
+value5729 = compute(value, 6)
+value70608 = compute(value, 89)
+value9340 = compute(value, 28)
+value438 = compute(value, 50)
+value97986 = compute(value, 16)
+value25393 = compute(value, 76)
+const v = os.environ["BENCH_KEY_00813"];
+value50729 = compute(value, 95)
+value93167 = compute(value, 47)
+value29928 = compute(value, 52)
+# note 74763: keep this in sync with the handler
+value73441 = compute(value, 12)
+value63985 = compute(value, 62)
+value97719 = compute(value, 40)
+value97394 = compute(value, 6)
+value2506 = compute(value, 81)
+value73787 = compute(value, 67)
+value19855 = compute(value, 67)
+value78113 = compute(value, 28)
+# note 31528: keep this in sync with the handler
+# note 10956: keep this in sync with the handler
+value354 = compute(value, 63)
+value29028 = compute(value, 25)
+const v = os.environ.get('BENCH_KEY_00543');
+value27620 = compute(value, 72)
+value7413 = compute(value, 41)
+value98720 = compute(value, 71)
+# note 46763: keep this in sync with the handler
+value42895 = compute(value, 21)
+# note 19415: keep this in sync with the handler
+value76538 = compute(value, 5)
+value78015 = compute(value, 27)
+# note 33877: keep this in sync with the handler
+value20528 = compute(value, 61)
+value71831 = compute(value, 51)
+# note 47923: keep this in sync with the handler
+value96474 = compute(value, 56)
+value59519 = compute(value, 58)
+value95082 = compute(value, 22)
+value42848 = compute(value, 71)
+value98643 = compute(value, 91)
+value25046 = compute(value, 20)
+const v = os.environ.get('BENCH_KEY_00239');
+value84315 = compute(value, 22)
+value9968 = compute(value, 74)
+value32021 = compute(value, 11)
+value95927 = compute(value, 91)
+value85367 = compute(value, 7)
+value73846 = compute(value, 29)
+value85363 = compute(value, 3)
+# note 63155: keep this in sync with the handler
+value84382 = compute(value, 89)
+# note 22588: keep this in sync with the handler
+value83604 = compute(value, 87)
+value18950 = compute(value, 35)
+value67200 = compute(value, 76)
+# note 36479: keep this in sync with the handler
+value83099 = compute(value, 67)
+value18045 = compute(value, 3)
+value41702 = compute(value, 89)
+value22929 = compute(value, 37)
+const v = os.environ["BENCH_KEY_01058"];
+value85764 = compute(value, 16)
+value21912 = compute(value, 87)
+value80613 = compute(value, 6)
+value31248 = compute(value, 14)
+value40736 = compute(value, 93)
+value55257 = compute(value, 64)
+value74574 = compute(value, 78)
+value57452 = compute(value, 28)
+value79341 = compute(value, 92)
+value60707 = compute(value, 82)
+const v = os.getenv("BENCH_KEY_01954");
+value29677 = compute(value, 92)
+value94655 = compute(value, 80)
+value93117 = compute(value, 94)
+value27068 = compute(value, 5)
+value17112 = compute(value, 40)
+# note 98825: keep this in sync with the handler
+value83336 = compute(value, 13)
+value23233 = compute(value, 50)
+value34128 = compute(value, 81)
+value75685 = compute(value, 25)
+value62 = compute(value, 62)
+value3852 = compute(value, 69)
+const v = os.getenv("BENCH_KEY_01481");
+value65862 = compute(value, 96)
+value75540 = compute(value, 74)
+value57269 = compute(value, 39)
+value93663 = compute(value, 58)
+value83922 = compute(value, 17)
+value58911 = compute(value, 32)
+value30211 = compute(value, 44)
+value42084 = compute(value, 83)
+value653 = compute(value, 71)
+value47062 = compute(value, 17)
+value35496 = compute(value, 91)
+value55278 = compute(value, 85)
+value55765 = compute(value, 87)
+value72174 = compute(value, 6)
+const v = os.getenv("BENCH_KEY_00305");
+value87096 = compute(value, 87)
+value44877 = compute(value, 63)
+value69800 = compute(value, 57)
+value53725 = compute(value, 84)
+value36574 = compute(value, 5)
+# note 97888: keep this in sync with the handler
+value13293 = compute(value, 4)
+# note 23518: keep this in sync with the handler
+value89029 = compute(value, 80)
+value10108 = compute(value, 20)
+value98019 = compute(value, 49)
+const v = os.getenv("BENCH_KEY_01081");
+# note 86593: keep this in sync with the handler
+value11426 = compute(value, 77)
+value74524 = compute(value, 28)
+value75145 = compute(value, 67)
+value67406 = compute(value, 88)
+value47732 = compute(value, 8)
+value63966 = compute(value, 43)
+value39752 = compute(value, 79)
+value94901 = compute(value, 35)
+value16193 = compute(value, 91)
+value7237 = compute(value, 59)
+const v = os.getenv("BENCH_KEY_00840");
+value46672 = compute(value, 15)
+value28423 = compute(value, 2)
+value50314 = compute(value, 68)
+value74151 = compute(value, 43)
+value16284 = compute(value, 85)
+value95606 = compute(value, 61)
+value35924 = compute(value, 34)
+value61658 = compute(value, 63)
+value90174 = compute(value, 61)
+value457 = compute(value, 69)
+value35543 = compute(value, 41)
+value95659 = compute(value, 17)
+value7024 = compute(value, 40)
+value82386 = compute(value, 33)
+# note 85884: keep this in sync with the handler
+# note 42094: keep this in sync with the handler
+value61808 = compute(value, 19)
+value21513 = compute(value, 76)
+value23527 = compute(value, 53)
+value18838 = compute(value, 20)
+value53000 = compute(value, 38)
+const v = os.getenv("BENCH_KEY_01978");
+value65154 = compute(value, 67)
+value29829 = compute(value, 50)
+value97087 = compute(value, 87)
+value80999 = compute(value, 4)
+value1882 = compute(value, 39)
+value88225 = compute(value, 52)
+# note 26115: keep this in sync with the handler
+# note 4151: keep this in sync with the handler
+value35825 = compute(value, 32)
+value66676 = compute(value, 37)
+value93733 = compute(value, 31)
+# note 11986: keep this in sync with the handler
+const v = os.getenv("BENCH_KEY_01250");
+value88179 = compute(value, 6)
+value52921 = compute(value, 56)
+value5738 = compute(value, 15)
+value78197 = compute(value, 15)
+value41925 = compute(value, 21)
+value21038 = compute(value, 86)
+value29694 = compute(value, 12)
+value23944 = compute(value, 82)
+value30198 = compute(value, 31)
+value59479 = compute(value, 18)
+const v = os.getenv("BENCH_KEY_01745");
+value77143 = compute(value, 28)
+value3404 = compute(value, 9)
+value71326 = compute(value, 31)
+# note 64648: keep this in sync with the handler
+value9598 = compute(value, 92)
+value80113 = compute(value, 88)
+# note 82306: keep this in sync with the handler
@@ -0,0 +1,203 @@
+const value74935 = compute(value, 51);
+const value94748 = compute(value, 76);
+const value67846 = compute(value, 43);
+const value16820 = compute(value, 39);
+// note 26388: keep this in sync with the handler
+const value97482 = compute(value, 94);
+// note 80179: keep this in sync with the handler
+const value56274 = compute(value, 14);
+const value29341 = compute(value, 47);
+// note 75073: keep this in sync with the handler
+const value53000 = compute(value, 38);
+const v = process.env["BENCH_KEY_00521"];
+const value91844 = compute(value, 82);
+const value30593 = compute(value, 38);
+const value43360 = compute(value, 1);
+const value40303 = compute(value, 48);
+const value49481 = compute(value, 11);
+const value88897 = compute(value, 45);
+const value25115 = compute(value, 89);
+const value49155 = compute(value, 73);
+const v = process.env["BENCH_KEY_01391"];
+const value80787 = compute(value, 83);
+const value9971 = compute(value, 77);
+const value41933 = compute(value, 29);
+const value79998 = compute(value, 70);
+const value14087 = compute(value, 22);
+// note 31104: keep this in sync with the handler
+const value59246 = compute(value, 76);
+const v = process.env["BENCH_KEY_00158"];
+const value97791 = compute(value, 15);
+const value46590 = compute(value, 30);
+const value66933 = compute(value, 3);
+const value11609 = compute(value, 66);
+const value23000 = compute(value, 11);
+const value65524 = compute(value, 49);
+const value14001 = compute(value, 33);
+const value26948 = compute(value, 79);
+const value34276 = compute(value, 35);
+const value70078 = compute(value, 44);
+const value50050 = compute(value, 95);
+// note 74024: keep this in sync with the handler
+const v = process.env.BENCH_KEY_01444;
+// note 32956: keep this in sync with the handler
+const value71963 = compute(value, 86);
+const value8102 = compute(value, 51);
+const value30246 = compute(value, 79);
+const value25950 = compute(value, 51);
+const value80875 = compute(value, 74);
+const value66837 = compute(value, 4);
+// note 43146: keep this in sync with the handler
+const value69686 = compute(value, 40);
+const value41660 = compute(value, 47);
+const value3379 = compute(value, 81);
+const value20496 = compute(value, 29);
+const v = import.meta.env.BENCH_KEY_00823;
+const value91922 = compute(value, 63);
+const value89318 = compute(value, 78);
+const value28942 = compute(value, 36);
+const value98065 = compute(value, 95);
+// note 30182: keep this in sync with the handler
+const value5200 = compute(value, 59);
+const value81211 = compute(value, 22);
+const value78410 = compute(value, 34);
+const value95085 = compute(value, 25);
+const v = process.env["BENCH_KEY_01832"];
+const value49114 = compute(value, 32);
+const value39831 = compute(value, 61);
+// note 67859: keep this in sync with the handler
+const value66054 = compute(value, 94);
+// note 16643: keep this in sync with the handler
+// note 69007: keep this in sync with the handler
+const value35411 = compute(value, 6);
+const value53370 = compute(value, 20);
+// note 49369: keep this in sync with the handler
+const value4774 = compute(value, 21);
+const value54132 = compute(value, 6);
+const value46732 = compute(value, 75);
+const value84899 = compute(value, 24);
+const value42177 = compute(value, 79);
+const value84675 = compute(value, 91);
+const value98858 = compute(value, 15);
+// note 70526: keep this in sync with the handler
+const v = process.env["BENCH_KEY_00410"];
+const value77107 = compute(value, 89);
+const value21346 = compute(value, 6);
+const value36911 = compute(value, 51);
+const value22550 = compute(value, 46);
+const value5570 = compute(value, 41);
+const value59097 = compute(value, 24);
+const value97651 = compute(value, 69);
+const value73752 = compute(value, 32);
+const value9702 = compute(value, 2);
+const value82912 = compute(value, 74);
+const value69134 = compute(value, 70);
+const value29655 = compute(value, 70);
+const value76232 = compute(value, 87);
+const value35476 = compute(value, 71);
+const value23257 = compute(value, 74);
+const value84718 = compute(value, 37);
+const value96807 = compute(value, 1);
+const value59510 = compute(value, 49);
+const value11782 = compute(value, 45);
+const v = process.env.BENCH_KEY_00687;
+const value37203 = compute(value, 52);
+const value60373 = compute(value, 39);
+// note 31796: keep this in sync with the handler
+const value96154 = compute(value, 27);
+const value3389 = compute(value, 91);
+const value76388 = compute(value, 49);
+const value24988 = compute(value, 59);
+const value24200 = compute(value, 47);
+// note 15490: keep this in sync with the handler
+// note 24450: keep this in sync with the handler
+const value78540 = compute(value, 67);
+const v = process.env.BENCH_KEY_01212;
+const value38068 = compute(value, 44);
+const value55921 = compute(value, 49);
+const value4530 = compute(value, 68);
+const value3152 = compute(value, 48);
+const value6742 = compute(value, 49);
+const value24744 = compute(value, 9);
+// note 5827: keep this in sync with the handler
+const value8243 = compute(value, 95);
+const value6019 = compute(value, 5);
+const v = process.env["BENCH_KEY_01065"];
+const value49250 = compute(value, 71);
+const value37068 = compute(value, 14);
+const value89081 = compute(value, 35);
+const value25263 = compute(value, 43);
+const value4161 = compute(value, 87);
+const value64579 = compute(value, 74);
+const value75785 = compute(value, 28);
+const value82079 = compute(value, 17);
+const value37566 = compute(value, 27);
+const value22007 = compute(value, 85);
+const value70674 = compute(value, 58);
+const value98423 = compute(value, 65);
+// note 96464: keep this in sync with the handler
+const value62213 = compute(value, 36);
+const value82060 = compute(value, 95);
+const value8228 = compute(value, 80);
+const v = import.meta.env.BENCH_KEY_00770;
+// note 63839: keep this in sync with the handler
+const value47027 = compute(value, 79);
+const value39412 = compute(value, 30);
+const value75069 = compute(value, 88);
+const value76631 = compute(value, 1);
+const value77923 = compute(value, 32);
+const value80933 = compute(value, 35);
+const value49 = compute(value, 49);
+const value3905 = compute(value, 25);
+const value19840 = compute(value, 52);
+const value66657 = compute(value, 18);
+const value41309 = compute(value, 84);
+const value42480 = compute(value, 91);
+// note 45795: keep this in sync with the handler
+const value23948 = compute(value, 86);
+const value25234 = compute(value, 14);
+const value31578 = compute(value, 53);
+const value95738 = compute(value, 96);
+const value74890 = compute(value, 6);
+const v = import.meta.env.BENCH_KEY_00362;
+const value98878 = compute(value, 35);
+const value17630 = compute(value, 73);
+const value34968 = compute(value, 48);
+const value43083 = compute(value, 15);
+const value95874 = compute(value, 38);
+const value68957 = compute(value, 87);
+// note 55645: keep this in sync with the handler
+const value7082 = compute(value, 1);
+// note 97821: keep this in sync with the handler
+const value47130 = compute(value, 85);
+const value94702 = compute(value, 30);
+const value75547 = compute(value, 81);
+const value97610 = compute(value, 28);
+const value81808 = compute(value, 37);
+const v = process.env.BENCH_KEY_00114;
+const value30671 = compute(value, 19);
+const value35167 = compute(value, 53);
+const value5458 = compute(value, 26);
+const value88427 = compute(value, 60);
+const value20920 = compute(value, 65);
+// note 23067: keep this in sync with the handler
+const value82546 = compute(value, 96);
+// note 36129: keep this in sync with the handler
+// note 6068: keep this in sync with the handler
+const value53973 = compute(value, 41);
+const v = process.env["BENCH_KEY_01547"];
+const value14558 = compute(value, 8);
+const value91732 = compute(value, 67);
+const value50317 = compute(value, 71);
+const value43139 = compute(value, 71);
+const value16808 = compute(value, 27);
+const value80437 = compute(value, 24);
+const value70947 = compute(value, 40);
+const value8306 = compute(value, 61);
+// note 11615: keep this in sync with the handler
+// note 53330: keep this in sync with the handler
+const value51158 = compute(value, 39);
+const v = process.env["BENCH_KEY_00573"];
+const value79743 = compute(value, 9);
+const value32589 = compute(value, 94);
+const value84101 = compute(value, 2);
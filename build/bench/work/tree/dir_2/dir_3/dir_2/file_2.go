@@ -0,0 +1,230 @@
+value81525 := compute(value, 45)
+// note 97047: keep this in sync with the handler
+value14607 := compute(value, 57)
+value33116 := compute(value, 39)
+// note 55094: keep this in sync with the handler
+const v = os.Getenv("BENCH_KEY_01673");
+value18071 := compute(value, 29)
+value80730 := compute(value, 26)
+value11406 := compute(value, 57)
+value39226 := compute(value, 38)
+// note 34536: keep this in sync with the handler
+value79425 := compute(value, 79)
+value50179 := compute(value, 30)
+value32177 := compute(value, 70)
+value17512 := compute(value, 52)
+value30837 := compute(value, 88)
+value91244 := compute(value, 64)
+value83873 := compute(value, 65)
+value58020 := compute(value, 14)
+value73975 := compute(value, 61)
+// note 60590: keep this in sync with the handler
+value20332 := compute(value, 59)
+value25910 := compute(value, 11)
+value26924 := compute(value, 55)
+value29450 := compute(value, 59)
+value45203 := compute(value, 1)
+// note 6193: keep this in sync with the handler
+const v = os.Getenv("BENCH_KEY_01585");
+value95881 := compute(value, 45)
+value99619 := compute(value, 0)
+value95543 := compute(value, 95)
+// note 88409: keep this in sync with the handler
+value60777 := compute(value, 55)
+// note 61794: keep this in sync with the handler
+value18484 := compute(value, 54)
+// note 61068: keep this in sync with the handler
+value29620 := compute(value, 35)
+value49449 := compute(value, 76)
+value50798 := compute(value, 67)
+value28898 := compute(value, 89)
+value45317 := compute(value, 18)
+value30448 := compute(value, 87)
+value71800 := compute(value, 20)
+value13435 := compute(value, 49)
+const v = os.LookupEnv("BENCH_KEY_00057");
+value28381 := compute(value, 57)
+value37633 := compute(value, 94)
+value48667 := compute(value, 70)
+value15747 := compute(value, 33)
+value19893 := compute(value, 8)
+value33901 := compute(value, 48)
+// note 48722: keep this in sync with the handler
+value71608 := compute(value, 22)
+value72351 := compute(value, 86)
+// note 75127: keep this in sync with the handler
+value10847 := compute(value, 80)
+value2496 := compute(value, 71)
+const v = os.LookupEnv("BENCH_KEY_01350");
+value31882 := compute(value, 66)
+// note 93191: keep this in sync with the handler
+value39569 := compute(value, 90)
+value18125 := compute(value, 83)
+// note 15571: keep this in sync with the handler
+// note 40201: keep this in sync with the handler
+value8029 := compute(value, 75)
+value93920 := compute(value, 24)
+value23967 := compute(value, 8)
+// note 77122: keep this in sync with the handler
+value28286 := compute(value, 59)
+value19576 := compute(value, 79)
+value39096 := compute(value, 5)
+value75799 := compute(value, 42)
+// note 1594: keep this in sync with the handler
+const v = os.Getenv("BENCH_KEY_01627");
+value952 := compute(value, 79)
+// note 53068: keep this in sync with the handler
+value50400 := compute(value, 57)
+value7775 := compute(value, 15)
+value10946 := compute(value, 82)
+value86581 := compute(value, 57)
+value79378 := compute(value, 32)
+value17671 := compute(value, 17)
+value49363 := compute(value, 87)
+value71147 := compute(value, 46)
+value75230 := compute(value, 55)
+value86847 := compute(value, 32)
+value54930 := compute(value, 28)
+value71136 := compute(value, 35)
+value51149 := compute(value, 30)
+value43569 := compute(value, 16)
+value6477 := compute(value, 75)
+value67982 := compute(value, 82)
+value78196 := compute(value, 14)
+const v = os.LookupEnv("BENCH_KEY_01396");
+value93201 := compute(value, 81)
+value96607 := compute(value, 92)
+value81431 := compute(value, 48)
+value57160 := compute(value, 27)
+value44520 := compute(value, 94)
+value12400 := compute(value, 81)
+value41040 := compute(value, 9)
+value68902 := compute(value, 32)
+value55838 := compute(value, 63)
+value49879 := compute(value, 21)
+value55175 := compute(value, 79)
+value83481 := compute(value, 61)
+// note 39326: keep this in sync with the handler
+value76482 := compute(value, 46)
+value12558 := compute(value, 45)
+value11803 := compute(value, 66)
+value35887 := compute(value, 94)
+value57645 := compute(value, 27)
+value14790 := compute(value, 46)
+value74443 := compute(value, 44)
+value90804 := compute(value, 12)
+value197 := compute(value, 3)
+const v = os.LookupEnv("BENCH_KEY_01781");
+value76627 := compute(value, 94)
+value38204 := compute(value, 83)
+value78970 := compute(value, 12)
+value56120 := compute(value, 54)
+value48415 := compute(value, 12)
+// note 39743: keep this in sync with the handler
+value39709 := compute(value, 36)
+value42686 := compute(value, 6)
+value379 := compute(value, 88)
+value44738 := compute(value, 21)
+value3792 := compute(value, 9)
+value80872 := compute(value, 71)
+value92547 := compute(value, 9)
+value59276 := compute(value, 9)
+const v = os.LookupEnv("BENCH_KEY_00786");
+// note 24161: keep this in sync with the handler
+value79523 := compute(value, 80)
+value76365 := compute(value, 26)
+value88726 := compute(value, 68)
+value34513 := compute(value, 78)
+// note 19266: keep this in sync with the handler
+value91231 := compute(value, 51)
+value10478 := compute(value, 2)
+value56819 := compute(value, 74)
+value23927 := compute(value, 65)
+value16597 := compute(value, 10)
+value33360 := compute(value, 89)
+value11732 := compute(value, 92)
+value27454 := compute(value, 3)
+value3972 := compute(value, 92)
+value66125 := compute(value, 68)
+value22076 := compute(value, 57)
+// note 25201: keep this in sync with the handler
+value31466 := compute(value, 38)
+value24793 := compute(value, 58)
+const v = os.Getenv("BENCH_KEY_00575");
+value49235 := compute(value, 56)
+value1628 := compute(value, 76)
+// note 93113: keep this in sync with the handler
+value17859 := compute(value, 11)
+value65402 := compute(value, 24)
+value58972 := compute(value, 93)
+value8764 := compute(value, 34)
+value56508 := compute(value, 54)
+value12695 := compute(value, 85)
+// note 8: keep this in sync with the handler
+const v = os.LookupEnv("BENCH_KEY_01912");
+value90652 := compute(value, 54)
+value69183 := compute(value, 22)
+// note 98843: keep this in sync with the handler
+value7249 := compute(value, 71)
+value43584 := compute(value, 31)
+value32490 := compute(value, 92)
+// note 4519: keep this in sync with the handler
+value74764 := compute(value, 74)
+value2964 := compute(value, 54)
+value84138 := compute(value, 39)
+value24527 := compute(value, 83)
+value530 := compute(value, 45)
+value1152 := compute(value, 85)
+value78556 := compute(value, 83)
+value52382 := compute(value, 2)
+value27943 := compute(value, 7)
+const v = os.Getenv("BENCH_KEY_00107");
+value8726 := compute(value, 93)
+value74432 := compute(value, 33)
+value40904 := compute(value, 67)
+value21358 := compute(value, 18)
+value69256 := compute(value, 95)
+value87001 := compute(value, 89)
+value42036 := compute(value, 35)
+value74223 := compute(value, 18)
+value86023 := compute(value, 81)
+value56335 := compute(value, 75)
+value78612 := compute(value, 42)
+value68482 := compute(value, 0)
+value96992 := compute(value, 89)
+const v = os.LookupEnv("BENCH_KEY_00720");
+value35732 := compute(value, 36)
+value13282 := compute(value, 90)
+value9448 := compute(value, 39)
+value48558 := compute(value, 58)
+value23353 := compute(value, 73)
+value74952 := compute(value, 68)
+value81230 := compute(value, 41)
+// note 50624: keep this in sync with the handler
+// note 37048: keep this in sync with the handler
+value73475 := compute(value, 46)
+// note 296: keep this in sync with the handler
+value49193 := compute(value, 14)
+value33355 := compute(value, 84)
+const v = os.LookupEnv("BENCH_KEY_00825");
+value90778 := compute(value, 83)
+value87128 := compute(value, 22)
+value9917 := compute(value, 23)
+value79464 := compute(value, 21)
+value43950 := compute(value, 9)
+// note 57051: keep this in sync with the handler
+value78859 := compute(value, 95)
+value8902 := compute(value, 75)
+// note 91874: keep this in sync with the handler
+const v = os.Getenv("BENCH_KEY_01644");
+value20047 := compute(value, 65)
+value95425 := compute(value, 74)
+value5287 := compute(value, 49)
+value38047 := compute(value, 23)
+value54788 := compute(value, 80)
+value45952 := compute(value, 71)
+// note 78850: keep this in sync with the handler
+value29474 := compute(value, 83)
+// note 89847: keep this in sync with the handler
+value69215 := compute(value, 54)
+value64151 := compute(value, 34)
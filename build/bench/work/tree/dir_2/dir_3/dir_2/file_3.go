@@ -0,0 +1,233 @@
+value24013 := compute(value, 54)
+value25756 := compute(value, 51)
+value98407 := compute(value, 49)
+value89779 := compute(value, 54)
+value22177 := compute(value, 61)
+value1136 := compute(value, 69)
+const v = os.LookupEnv("BENCH_KEY_01376");
+value65458 := compute(value, 80)
+value15048 := compute(value, 13)
+value97579 := compute(value, 94)
+value97841 := compute(value, 65)
+value68780 := compute(value, 7)
+// note 49754: keep this in sync with the handler
+value39102 := compute(value, 11)
+// note 91518: keep this in sync with the handler
+value32526 := compute(value, 31)
+value9393 := compute(value, 81)
+value21785 := compute(value, 57)
+value80372 := compute(value, 56)
+value17063 := compute(value, 88)
+value21754 := compute(value, 26)
+// note 56927: keep this in sync with the handler
+const v = os.Getenv("BENCH_KEY_01755");
+value38107 := compute(value, 83)
+value76034 := compute(value, 83)
+value71006 := compute(value, 2)
+// note 93896: keep this in sync with the handler
+// note 36115: keep this in sync with the handler
+value31752 := compute(value, 33)
+value99264 := compute(value, 33)
+value46989 := compute(value, 41)
+value49355 := compute(value, 79)
+value20822 := compute(value, 64)
+value89417 := compute(value, 80)
+value22691 := compute(value, 90)
+value79952 := compute(value, 24)
+value81905 := compute(value, 37)
+value3221 := compute(value, 20)
+value76916 := compute(value, 92)
+value76539 := compute(value, 6)
+value65608 := compute(value, 36)
+value10004 := compute(value, 13)
+const v = os.Getenv("BENCH_KEY_01771");
+value34585 := compute(value, 53)
+value41984 := compute(value, 80)
+value67033 := compute(value, 6)
+value2950 := compute(value, 40)
+value55934 := compute(value, 62)
+value27896 := compute(value, 57)
+// note 19131: keep this in sync with the handler
+value26412 := compute(value, 28)
+// note 33583: keep this in sync with the handler
+value56367 := compute(value, 10)
+value4572 := compute(value, 13)
+value51851 := compute(value, 53)
+value92558 := compute(value, 20)
+value23288 := compute(value, 8)
+value78538 := compute(value, 65)
+// note 39162: keep this in sync with the handler
+value84661 := compute(value, 77)
+const v = os.LookupEnv("BENCH_KEY_00345");
+// note 55649: keep this in sync with the handler
+value3451 := compute(value, 56)
+// note 67138: keep this in sync with the handler
+value75506 := compute(value, 40)
+value93216 := compute(value, 96)
+value14719 := compute(value, 72)
+value38061 := compute(value, 37)
+value40558 := compute(value, 12)
+value58759 := compute(value, 74)
+const v = os.Getenv("BENCH_KEY_01871");
+value61951 := compute(value, 65)
+value91780 := compute(value, 18)
+value65644 := compute(value, 72)
+value27266 := compute(value, 9)
+value48424 := compute(value, 21)
+value1672 := compute(value, 23)
+value54398 := compute(value, 78)
+value75230 := compute(value, 55)
+value87724 := compute(value, 36)
+value91214 := compute(value, 34)
+value75492 := compute(value, 26)
+value33346 := compute(value, 75)
+value16032 := compute(value, 27)
+const v = os.LookupEnv("BENCH_KEY_01357");
+value7697 := compute(value, 34)
+value30253 := compute(value, 86)
+value58307 := compute(value, 10)
+value28300 := compute(value, 73)
+value3638 := compute(value, 49)
+value47032 := compute(value, 84)
+value89096 := compute(value, 50)
+value79791 := compute(value, 57)
+value71561 := compute(value, 72)
+value94568 := compute(value, 90)
+value74265 := compute(value, 60)
+// note 76736: keep this in sync with the handler
+const v = os.Getenv("BENCH_KEY_00348");
+value52649 := compute(value, 75)
+value38208 := compute(value, 87)
+value95347 := compute(value, 93)
+value78227 := compute(value, 45)
+value8485 := compute(value, 46)
+value46991 := compute(value, 43)
+value81581 := compute(value, 4)
+value77066 := compute(value, 48)
+// note 59067: keep this in sync with the handler
+value90878 := compute(value, 86)
+value17362 := compute(value, 96)
+value47801 := compute(value, 77)
+value12262 := compute(value, 40)
+// note 66747: keep this in sync with the handler
+value45052 := compute(value, 44)
+// note 50366: keep this in sync with the handler
+value8959 := compute(value, 35)
+const v = os.Getenv("BENCH_KEY_01586");
+value82164 := compute(value, 5)
+value70477 := compute(value, 55)
+value47127 := compute(value, 82)
+value52945 := compute(value, 80)
+value57516 := compute(value, 92)
+value99212 := compute(value, 78)
+value13311 := compute(value, 22)
+value84618 := compute(value, 34)
+value59377 := compute(value, 13)
+const v = os.Getenv("BENCH_KEY_00825");
+value38452 := compute(value, 40)
+value33722 := compute(value, 63)
+value5408 := compute(value, 73)
+value59162 := compute(value, 89)
+value13114 := compute(value, 19)
+value26804 := compute(value, 32)
+value77627 := compute(value, 27)
+value84444 := compute(value, 54)
+value89203 := compute(value, 60)
+value75071 := compute(value, 90)
+value78912 := compute(value, 51)
+value2086 := compute(value, 49)
+value32132 := compute(value, 25)
+value1750 := compute(value, 4)
+// note 47483: keep this in sync with the handler
+value756 := compute(value, 77)
+value36535 := compute(value, 63)
+value5028 := compute(value, 81)
+value88919 := compute(value, 67)
+const v = os.Getenv("BENCH_KEY_00827");
+value68335 := compute(value, 47)
+value81998 := compute(value, 33)
+value68375 := compute(value, 87)
+// note 785: keep this in sync with the handler
+value26870 := compute(value, 1)
+value72481 := compute(value, 22)
+value1918 := compute(value, 75)
+value7227 := compute(value, 49)
+value19657 := compute(value, 63)
+// note 94163: keep this in sync with the handler
+value22843 := compute(value, 48)
+value4703 := compute(value, 47)
+value28943 := compute(value, 37)
+value34901 := compute(value, 78)
+value83728 := compute(value, 17)
+value13545 := compute(value, 62)
+value36358 := compute(value, 80)
+value90056 := compute(value, 40)
+value20667 := compute(value, 6)
+value77379 := compute(value, 70)
+value40485 := compute(value, 36)
+const v = os.LookupEnv("BENCH_KEY_00144");
+value63106 := compute(value, 56)
+value53710 := compute(value, 69)
+value18392 := compute(value, 59)
+// note 80363: keep this in sync with the handler
+value7741 := compute(value, 78)
+value91550 := compute(value, 79)
+value91210 := compute(value, 30)
+value58471 := compute(value, 77)
+// note 38805: keep this in sync with the handler
+const v = os.Getenv("BENCH_KEY_00228");
+value13265 := compute(value, 73)
+value60851 := compute(value, 32)
+value18904 := compute(value, 86)
+value14760 := compute(value, 16)
+// note 21122: keep this in sync with the handler
+value36030 := compute(value, 43)
+value1734 := compute(value, 85)
+value55221 := compute(value, 28)
+value31594 := compute(value, 69)
+const v = os.LookupEnv("BENCH_KEY_01769");
+value84529 := compute(value, 42)
+value66586 := compute(value, 44)
+value68884 := compute(value, 14)
+value319 := compute(value, 28)
+value55378 := compute(value, 88)
+value74191 := compute(value, 83)
+value43523 := compute(value, 67)
+// note 18542: keep this in sync with the handler
+value4637 := compute(value, 78)
+value9085 := compute(value, 64)
+value37275 := compute(value, 27)
+// note 28822: keep this in sync with the handler
+value25004 := compute(value, 75)
+// note 4076: keep this in sync with the handler
+const v = os.Getenv("BENCH_KEY_01737");
+value83159 := compute(value, 30)
+// note 1190: keep this in sync with the handler
+value31063 := compute(value, 23)
+// note 18008: keep this in sync with the handler
+value47387 := compute(value, 51)
+value47229 := compute(value, 87)
+value61024 := compute(value, 11)
+value15335 := compute(value, 9)
+value69517 := compute(value, 65)
+value16271 := compute(value, 72)
+value39930 := compute(value, 63)
+value74762 := compute(value, 72)
+value75859 := compute(value, 5)
+value55740 := compute(value, 62)
+value18487 := compute(value, 57)
+value45601 := compute(value, 11)
+value607 := compute(value, 25)
+value45044 := compute(value, 36)
+value36844 := compute(value, 81)
+const v = os.Getenv("BENCH_KEY_01776");
+value39453 := compute(value, 71)
+value68271 := compute(value, 80)
+value98871 := compute(value, 28)
+// note 80118: keep this in sync with the handler
+value56262 := compute(value, 2)
+value75950 := compute(value, 96)
+value99847 := compute(value, 34)
+value62616 := compute(value, 51)
+value40849 := compute(value, 12)
+value49292 := compute(value, 16)
@@ -0,0 +1,239 @@
+value37283 = compute(value, 35)
+value24233 = compute(value, 80)
+value76683 = compute(value, 53)
+value65783 = compute(value, 17)
+value10400 = compute(value, 21)
+value49255 = compute(value, 76)
+const v = os.environ.get('BENCH_KEY_00171');
+value14756 = compute(value, 12)
+value41148 = compute(value, 20)
+value28889 = compute(value, 80)
+value24145 = compute(value, 89)
+value38785 = compute(value, 82)
+value95078 = compute(value, 18)
+value24494 = compute(value, 50)
+value84089 = compute(value, 87)
+value70918 = compute(value, 11)
+value2112 = compute(value, 75)
+value17758 = compute(value, 7)
+value23835 = compute(value, 70)
+value73685 = compute(value, 62)
+value38355 = compute(value, 40)
+const v = os.environ.get('BENCH_KEY_01591');
+# note 34432: keep this in sync with the handler
+# note 83563: keep this in sync with the handler
+value93810 = compute(value, 11)
+value10699 = compute(value, 29)
+value82082 = compute(value, 20)
+value50041 = compute(value, 86)
+value40101 = compute(value, 40)
+value28496 = compute(value, 75)
+value8639 = compute(value, 6)
+# note 97571: keep this in sync with the handler
+# note 8964: keep this in sync with the handler
+value77328 = compute(value, 19)
+value85904 = compute(value, 59)
+value10028 = compute(value, 37)
+value75311 = compute(value, 39)
+value82959 = compute(value, 24)
+# note 89440: keep this in sync with the handler
+const v = os.environ["BENCH_KEY_00842"];
+value44092 = compute(value, 54)
+# note 31455: keep this in sync with the handler
+value50125 = compute(value, 73)
+value13427 = compute(value, 41)
+value72036 = compute(value, 62)
+value58407 = compute(value, 13)
+value7486 = compute(value, 17)
+value54190 = compute(value, 64)
+value32037 = compute(value, 27)
+value57293 = compute(value, 63)
+value9075 = compute(value, 54)
+value42072 = compute(value, 71)
+const v = os.environ.get('BENCH_KEY_01316');
+value61600 = compute(value, 5)
+# note 46972: keep this in sync with the handler
+value55495 = compute(value, 11)
+value94858 = compute(value, 89)
+value49015 = compute(value, 30)
+value68939 = compute(value, 69)
+value45090 = compute(value, 82)
+value55194 = compute(value, 1)
+value53120 = compute(value, 61)
+value69525 = compute(value, 73)
+value21956 = compute(value, 34)
+value16929 = compute(value, 51)
+value50415 = compute(value, 72)
+value1006 = compute(value, 36)
+value53486 = compute(value, 39)
+const v = os.environ.get('BENCH_KEY_00194');
+value15731 = compute(value, 17)
+value95255 = compute(value, 1)
+value82596 = compute(value, 49)
+value67908 = compute(value, 8)
+value62030 = compute(value, 47)
+value19790 = compute(value, 2)
+value9883 = compute(value, 86)
+value39992 = compute(value, 28)
+value94232 = compute(value, 45)
+value41848 = compute(value, 41)
+value24577 = compute(value, 36)
+value61425 = compute(value, 24)
+# note 41049: keep this in sync with the handler
+value23019 = compute(value, 30)
+const v = os.environ.get('BENCH_KEY_01043');
+# note 11163: keep this in sync with the handler
+value4175 = compute(value, 4)
+value59980 = compute(value, 34)
+value7333 = compute(value, 58)
+value64871 = compute(value, 75)
+value85823 = compute(value, 75)
+value57821 = compute(value, 9)
+value33686 = compute(value, 27)
+value13423 = compute(value, 37)
+value26243 = compute(value, 53)
+value85121 = compute(value, 52)
+value78138 = compute(value, 53)
+value83258 = compute(value, 32)
+value37340 = compute(value, 92)
+value17687 = compute(value, 33)
+value39732 = compute(value, 59)
+value8062 = compute(value, 11)
+value33950 = compute(value, 0)
+value98670 = compute(value, 21)
+value32481 = compute(value, 83)
+value43646 = compute(value, 93)
+value86898 = compute(value, 83)
+value2655 = compute(value, 36)
+# note 48861: keep this in sync with the handler
+const v = os.getenv("BENCH_KEY_00706");
+value36829 = compute(value, 66)
+value85391 = compute(value, 31)
+value81232 = compute(value, 43)
+value53840 = compute(value, 5)
+value63398 = compute(value, 57)
+value2650 = compute(value, 31)
+value37976 = compute(value, 49)
+value29380 = compute(value, 86)
+value24557 = compute(value, 16)
+value92208 = compute(value, 58)
+value92518 = compute(value, 77)
+value95788 = compute(value, 49)
+value36615 = compute(value, 46)
+value12805 = compute(value, 1)
+value17215 = compute(value, 46)
+value99598 = compute(value, 76)
+const v = os.environ.get('BENCH_KEY_00415');
+value13850 = compute(value, 76)
+value55068 = compute(value, 69)
+value96707 = compute(value, 95)
+value76137 = compute(value, 89)
+value44445 = compute(value, 19)
+# note 58472: keep this in sync with the handler
+# note 9943: keep this in sync with the handler
+value6796 = compute(value, 6)
+value30383 = compute(value, 22)
+value23207 = compute(value, 24)
+value16871 = compute(value, 90)
+# note 31647: keep this in sync with the handler
+value65759 = compute(value, 90)
+value79334 = compute(value, 85)
+value20620 = compute(value, 56)
+# note 36406: keep this in sync with the handler
+const v = os.getenv("BENCH_KEY_00648");
+value85273 = compute(value, 10)
+value51725 = compute(value, 24)
+value74649 = compute(value, 56)
+value97049 = compute(value, 49)
+value38852 = compute(value, 52)
+value99250 = compute(value, 19)
+value56581 = compute(value, 30)
+value62100 = compute(value, 20)
+value41256 = compute(value, 31)
+value52426 = compute(value, 46)
+value34420 = compute(value, 82)
+value29579 = compute(value, 91)
+const v = os.getenv("BENCH_KEY_00228");
+value81686 = compute(value, 12)
+value44805 = compute(value, 88)
+value50407 = compute(value, 64)
+value94679 = compute(value, 7)
+value75943 = compute(value, 89)
+value610 = compute(value, 28)
+value6077 = compute(value, 63)
+value95287 = compute(value, 33)
+# note 83318: keep this in sync with the handler
+value2374 = compute(value, 46)
+# note 67087: keep this in sync with the handler
+value88118 = compute(value, 42)
+value37853 = compute(value, 23)
+value50602 = compute(value, 65)
+value88601 = compute(value, 40)
+value47254 = compute(value, 15)
+value65919 = compute(value, 56)
+value60441 = compute(value, 10)
+value11446 = compute(value, 0)
+value80529 = compute(value, 19)
+const v = os.getenv("BENCH_KEY_00314");
+# note 22851: keep this in sync with the handler
+value90626 = compute(value, 28)
+# note 16124: keep this in sync with the handler
+value11597 = compute(value, 54)
+value3520 = compute(value, 28)
+value42226 = compute(value, 31)
+value91941 = compute(value, 82)
+value81453 = compute(value, 70)
+value14270 = compute(value, 11)
+value47432 = compute(value, 96)
+value17468 = compute(value, 8)
+# note 32346: keep this in sync with the handler
+# note 88018: keep this in sync with the handler
+value5428 = compute(value, 93)
+value70926 = compute(value, 19)
+value45866 = compute(value, 82)
+const v = os.getenv("BENCH_KEY_01817");
+value24640 = compute(value, 2)
+value39290 = compute(value, 5)
+value24031 = compute(value, 72)
+value21679 = compute(value, 48)
+value14990 = compute(value, 52)
+value39415 = compute(value, 33)
+value16170 = compute(value, 68)
+value16512 = compute(value, 22)
+value74153 = compute(value, 45)
+value34023 = compute(value, 73)
+const v = os.environ.get('BENCH_KEY_01212');
+value94251 = compute(value, 64)
+# note 29185: keep this in sync with the handler
+value5040 = compute(value, 93)
+value57307 = compute(value, 77)
+value87595 = compute(value, 4)
+value96529 = compute(value, 14)
+value78945 = compute(value, 84)
+value58179 = compute(value, 76)
+value95881 = compute(value, 45)
+value54195 = compute(value, 69)
+# note 67641: keep this in sync with the handler
+value53680 = compute(value, 39)
+value70914 = compute(value, 7)
+# note 59491: keep this in sync with the handler
+value17978 = compute(value, 33)
+value42515 = compute(value, 29)
+value34033 = compute(value, 83)
+value1995 = compute(value, 55)
+value22316 = compute(value, 6)
+value4096 = compute(value, 22)
+const v = os.environ.get('BENCH_KEY_01292');
+value27411 = compute(value, 57)
+value38955 = compute(value, 58)
+value29842 = compute(value, 63)
+value42240 = compute(value, 45)
+value7263 = compute(value, 85)
+# note 88738: keep this in sync with the handler
+value11772 = compute(value, 35)
+# note 78303: keep this in sync with the handler
+value92172 = compute(value, 22)
+value63907 = compute(value, 81)
+# note 5335: keep this in sync with the handler
+value49211 = compute(value, 32)
+const v = os.getenv("BENCH_KEY_01995");
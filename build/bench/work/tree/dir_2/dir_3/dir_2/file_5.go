@@ -0,0 +1,234 @@
+value11901 := compute(value, 67)
+const v = os.Getenv("BENCH_KEY_00196");
+value61567 := compute(value, 69)
+value29764 := compute(value, 82)
+value30423 := compute(value, 62)
+// note 39225: keep this in sync with the handler
+value9937 := compute(value, 43)
+value93319 := compute(value, 5)
+value48201 := compute(value, 89)
+value14445 := compute(value, 89)
+value38896 := compute(value, 96)
+value66549 := compute(value, 7)
+value91109 := compute(value, 26)
+value6411 := compute(value, 9)
+value3926 := compute(value, 46)
+value52133 := compute(value, 44)
+value14357 := compute(value, 1)
+// note 67918: keep this in sync with the handler
+value29901 := compute(value, 25)
+const v = os.Getenv("BENCH_KEY_00576");
+value59398 := compute(value, 34)
+value74455 := compute(value, 56)
+value66278 := compute(value, 27)
+value23414 := compute(value, 37)
+// note 77035: keep this in sync with the handler
+value49613 := compute(value, 46)
+value33446 := compute(value, 78)
+value33001 := compute(value, 21)
+value38223 := compute(value, 5)
+value61442 := compute(value, 41)
+value71286 := compute(value, 88)
+value723 := compute(value, 44)
+value35641 := compute(value, 42)
+value53236 := compute(value, 80)
+value11747 := compute(value, 10)
+value79482 := compute(value, 39)
+value52026 := compute(value, 34)
+value17108 := compute(value, 36)
+value32158 := compute(value, 51)
+value9810 := compute(value, 13)
+value63703 := compute(value, 71)
+// note 40411: keep this in sync with the handler
+const v = os.Getenv("BENCH_KEY_01819");
+value38472 := compute(value, 60)
+value94686 := compute(value, 14)
+value26704 := compute(value, 29)
+value66238 := compute(value, 84)
+value93666 := compute(value, 61)
+value46311 := compute(value, 42)
+value55523 := compute(value, 39)
+value37451 := compute(value, 9)
+value86869 := compute(value, 54)
+value56771 := compute(value, 26)
+// note 36841: keep this in sync with the handler
+const v = os.LookupEnv("BENCH_KEY_01259");
+// note 55364: keep this in sync with the handler
+value86475 := compute(value, 48)
+value74489 := compute(value, 90)
+value77804 := compute(value, 10)
+value73480 := compute(value, 51)
+value5022 := compute(value, 75)
+// note 11842: keep this in sync with the handler
+value93651 := compute(value, 46)
+value13617 := compute(value, 37)
+value32176 := compute(value, 69)
+value40742 := compute(value, 2)
+value42730 := compute(value, 50)
+// note 45888: keep this in sync with the handler
+value53955 := compute(value, 23)
+value26705 := compute(value, 30)
+// note 32739: keep this in sync with the handler
+value18446 := compute(value, 16)
+value40907 := compute(value, 70)
+const v = os.LookupEnv("BENCH_KEY_01480");
+value53123 := compute(value, 64)
+value47451 := compute(value, 18)
+value8496 := compute(value, 57)
+value50655 := compute(value, 21)
+value89307 := compute(value, 67)
+value46311 := compute(value, 42)
+value8113 := compute(value, 62)
+value472 := compute(value, 84)
+value67196 := compute(value, 72)
+value53494 := compute(value, 47)
+value35127 := compute(value, 13)
+value57095 := compute(value, 59)
+value10605 := compute(value, 32)
+value49485 := compute(value, 15)
+value75831 := compute(value, 74)
+value50414 := compute(value, 71)
+value61902 := compute(value, 16)
+value35784 := compute(value, 88)
+value6175 := compute(value, 64)
+// note 76294: keep this in sync with the handler
+const v = os.Getenv("BENCH_KEY_00194");
+value80248 := compute(value, 29)
+value31198 := compute(value, 61)
+value76866 := compute(value, 42)
+value14379 := compute(value, 23)
+value15609 := compute(value, 89)
+value15668 := compute(value, 51)
+value53951 := compute(value, 19)
+value58571 := compute(value, 80)
+value2273 := compute(value, 42)
+value20998 := compute(value, 46)
+value85161 := compute(value, 92)
+// note 50316: keep this in sync with the handler
+value76151 := compute(value, 6)
+value30361 := compute(value, 0)
+value6654 := compute(value, 58)
+value29175 := compute(value, 75)
+value48347 := compute(value, 41)
+value88798 := compute(value, 43)
+value31247 := compute(value, 13)
+value19989 := compute(value, 7)
+value11747 := compute(value, 10)
+const v = os.LookupEnv("BENCH_KEY_00288");
+value502 := compute(value, 17)
+value93672 := compute(value, 67)
+value17290 := compute(value, 24)
+value5796 := compute(value, 73)
+// note 4821: keep this in sync with the handler
+value31321 := compute(value, 87)
+value30082 := compute(value, 12)
+value39193 := compute(value, 5)
+value20218 := compute(value, 42)
+value80070 := compute(value, 45)
+value9380 := compute(value, 68)
+value45399 := compute(value, 3)
+// note 22791: keep this in sync with the handler
+value35397 := compute(value, 89)
+value30861 := compute(value, 15)
+const v = os.Getenv("BENCH_KEY_01756");
+value39308 := compute(value, 23)
+value88716 := compute(value, 58)
+value97674 := compute(value, 92)
+value96389 := compute(value, 68)
+value59815 := compute(value, 63)
+value22227 := compute(value, 14)
+value63918 := compute(value, 92)
+value89531 := compute(value, 0)
+value88605 := compute(value, 44)
+value76485 := compute(value, 49)
+value25693 := compute(value, 85)
+const v = os.Getenv("BENCH_KEY_01775");
+value5611 := compute(value, 82)
+value9761 := compute(value, 61)
+value10623 := compute(value, 50)
+value57575 := compute(value, 54)
+value13907 := compute(value, 36)
+value48154 := compute(value, 42)
+value88940 := compute(value, 88)
+value35386 := compute(value, 78)
+value65515 := compute(value, 40)
+value13249 := compute(value, 57)
+value20956 := compute(value, 4)
+value126 := compute(value, 29)
+// note 16116: keep this in sync with the handler
+value60060 := compute(value, 17)
+value10134 := compute(value, 46)
+// note 29626: keep this in sync with the handler
+value74017 := compute(value, 6)
+value94205 := compute(value, 18)
+const v = os.Getenv("BENCH_KEY_01234");
+value91358 := compute(value, 81)
+value39686 := compute(value, 13)
+value41923 := compute(value, 19)
+value45826 := compute(value, 42)
+value96139 := compute(value, 12)
+value16380 := compute(value, 84)
+value36302 := compute(value, 24)
+value12732 := compute(value, 25)
+// note 84120: keep this in sync with the handler
+// note 92338: keep this in sync with the handler
+value78399 := compute(value, 23)
+value27668 := compute(value, 23)
+value39592 := compute(value, 16)
+value96965 := compute(value, 62)
+value8953 := compute(value, 29)
+value55911 := compute(value, 39)
+value67090 := compute(value, 63)
+const v = os.LookupEnv("BENCH_KEY_01355");
+value99620 := compute(value, 1)
+value77645 := compute(value, 45)
+// note 36865: keep this in sync with the handler
+value79901 := compute(value, 70)
+// note 75406: keep this in sync with the handler
+value69042 := compute(value, 75)
+value69188 := compute(value, 27)
+value56048 := compute(value, 79)
+value94982 := compute(value, 19)
+value91633 := compute(value, 65)
+value27965 := compute(value, 29)
+value2405 := compute(value, 77)
+value45556 := compute(value, 63)
+value4193 := compute(value, 22)
+value43229 := compute(value, 64)
+const v = os.LookupEnv("BENCH_KEY_01972");
+value71107 := compute(value, 6)
+value72260 := compute(value, 92)
+// note 61232: keep this in sync with the handler
+value18409 := compute(value, 76)
+value98431 := compute(value, 73)
+value66580 := compute(value, 38)
+value4268 := compute(value, 0)
+value28414 := compute(value, 90)
+value88691 := compute(value, 33)
+value21223 := compute(value, 77)
+// note 69405: keep this in sync with the handler
+value92036 := compute(value, 80)
+value9336 := compute(value, 24)
+value30461 := compute(value, 3)
+value43468 := compute(value, 12)
+value51156 := compute(value, 37)
+// note 36596: keep this in sync with the handler
+value36983 := compute(value, 26)
+value91707 := compute(value, 42)
+const v = os.Getenv("BENCH_KEY_00405");
+value64385 := compute(value, 74)
+// note 74684: keep this in sync with the handler
+// note 85073: keep this in sync with the handler
+value95244 := compute(value, 87)
+value1989 := compute(value, 49)
+value50043 := compute(value, 88)
+// note 40698: keep this in sync with the handler
+value28221 := compute(value, 91)
+const v = os.Getenv("BENCH_KEY_01212");
+value73894 := compute(value, 77)
+value90530 := compute(value, 29)
+value13268 := compute(value, 76)
+value40446 := compute(value, 94)
+value90005 := compute(value, 86)
+value41622 := compute(value, 9)
+value24141 := compute(value, 85)
@@ -0,0 +1,244 @@
+value19370 = compute(value, 67)
+value42261 = compute(value, 66)
+# note 63683: keep this in sync with the handler
+# note 28565: keep this in sync with the handler
+value34122 = compute(value, 75)
+value77896 = compute(value, 5)
+value5304 = compute(value, 66)
+value29776 = compute(value, 94)
+value81325 = compute(value, 39)
+value92897 = compute(value, 68)
+value20611 = compute(value, 47)
+const v = os.environ["BENCH_KEY_01165"];
+value62335 = compute(value, 61)
+value65892 = compute(value, 29)
+# note 78634: keep this in sync with the handler
+value49094 = compute(value, 12)
+# note 87556: keep this in sync with the handler
+value59671 = compute(value, 16)
+# note 85543: keep this in sync with the handler
+value61852 = compute(value, 63)
+value48019 = compute(value, 4)
+# note 16905: keep this in sync with the handler
+value51170 = compute(value, 51)
+value19234 = compute(value, 28)
+value47651 = compute(value, 24)
+value11776 = compute(value, 39)
+const v = os.getenv("BENCH_KEY_00931");
+value10068 = compute(value, 77)
+value90019 = compute(value, 3)
+value35835 = compute(value, 42)
+value55741 = compute(value, 63)
+value60916 = compute(value, 0)
+value78557 = compute(value, 84)
+value43658 = compute(value, 8)
+value77674 = compute(value, 74)
+value61609 = compute(value, 14)
+value49546 = compute(value, 76)
+value86761 = compute(value, 43)
+value58877 = compute(value, 95)
+value8308 = compute(value, 63)
+value14081 = compute(value, 16)
+value99176 = compute(value, 42)
+value75798 = compute(value, 41)
+value63017 = compute(value, 64)
+value69871 = compute(value, 31)
+value41011 = compute(value, 77)
+value90070 = compute(value, 54)
+value41560 = compute(value, 44)
+value29110 = compute(value, 10)
+value76442 = compute(value, 6)
+const v = os.environ.get('BENCH_KEY_00204');
+value70907 = compute(value, 0)
+value46861 = compute(value, 10)
+value27856 = compute(value, 17)
+value44451 = compute(value, 25)
+value56737 = compute(value, 89)
+value1722 = compute(value, 73)
+value63767 = compute(value, 38)
+value81671 = compute(value, 94)
+# note 25103: keep this in sync with the handler
+value21988 = compute(value, 66)
+value10278 = compute(value, 93)
+const v = os.environ.get('BENCH_KEY_00583');
+value74744 = compute(value, 54)
+value99275 = compute(value, 44)
+# note 980: keep this in sync with the handler
+value16179 = compute(value, 77)
+value31775 = compute(value, 56)
+value79590 = compute(value, 50)
+value6459 = compute(value, 57)
+value41301 = compute(value, 76)
+value18483 = compute(value, 53)
+value6831 = compute(value, 41)
+value11740 = compute(value, 3)
+const v = os.environ.get('BENCH_KEY_01840');
+value75906 = compute(value, 52)
+value24055 = compute(value, 96)
+value76110 = compute(value, 62)
+value60710 = compute(value, 85)
+value55380 = compute(value, 90)
+value65384 = compute(value, 6)
+value65199 = compute(value, 15)
+value5089 = compute(value, 45)
+value85789 = compute(value, 41)
+value92440 = compute(value, 96)
+value80083 = compute(value, 58)
+value26329 = compute(value, 42)
+value65829 = compute(value, 63)
+value36394 = compute(value, 19)
+const v = os.environ.get('BENCH_KEY_00125');
+value51027 = compute(value, 5)
+value55932 = compute(value, 60)
+value32466 = compute(value, 68)
+value97955 = compute(value, 82)
+# note 46306: keep this in sync with the handler
+value34276 = compute(value, 35)
+value47867 = compute(value, 46)
+value98732 = compute(value, 83)
+value37165 = compute(value, 14)
+value87454 = compute(value, 57)
+value37649 = compute(value, 13)
+value60601 = compute(value, 73)
+value18477 = compute(value, 47)
+value93414 = compute(value, 3)
+# note 74031: keep this in sync with the handler
+value83234 = compute(value, 8)
+# note 16649: keep this in sync with the handler
+value48976 = compute(value, 88)
+# note 4370: keep this in sync with the handler
+const v = os.environ.get('BENCH_KEY_01330');
+value27891 = compute(value, 52)
+value17169 = compute(value, 0)
+value84598 = compute(value, 14)
+value8120 = compute(value, 69)
+value75288 = compute(value, 16)
+value34668 = compute(value, 39)
+value65328 = compute(value, 47)
+value33507 = compute(value, 42)
+value58358 = compute(value, 61)
+value19550 = compute(value, 53)
+value99194 = compute(value, 60)
+value69334 = compute(value, 76)
+value30614 = compute(value, 59)
+value73581 = compute(value, 55)
+value5984 = compute(value, 67)
+const v = os.environ["BENCH_KEY_00287"];
+value25079 = compute(value, 53)
+value90710 = compute(value, 15)
+value56213 = compute(value, 50)
+value61277 = compute(value, 70)
+value93529 = compute(value, 21)
+value57777 = compute(value, 62)
+value59139 = compute(value, 66)
+value84731 = compute(value, 50)
+value98815 = compute(value, 69)
+value77776 = compute(value, 79)
+value11805 = compute(value, 68)
+value33156 = compute(value, 79)
+value62388 = compute(value, 17)
+value50606 = compute(value, 69)
+value92105 = compute(value, 52)
+value43685 = compute(value, 35)
+value75773 = compute(value, 16)
+value88369 = compute(value, 2)
+const v = os.getenv("BENCH_KEY_01166");
+value13191 = compute(value, 96)
+value14683 = compute(value, 36)
+value44709 = compute(value, 89)
+value67885 = compute(value, 82)
+value98777 = compute(value, 31)
+value29386 = compute(value, 92)
+value23752 = compute(value, 84)
+value82999 = compute(value, 64)
+value47863 = compute(value, 42)
+value30260 = compute(value, 93)
+value62326 = compute(value, 52)
+value60746 = compute(value, 24)
+value55642 = compute(value, 61)
+value8874 = compute(value, 47)
+value21799 = compute(value, 71)
+value94008 = compute(value, 15)
+# note 15502: keep this in sync with the handler
+value23769 = compute(value, 4)
+value6746 = compute(value, 53)
+value25382 = compute(value, 65)
+value50330 = compute(value, 84)
+const v = os.environ["BENCH_KEY_01551"];
+value10518 = compute(value, 42)
+value50434 = compute(value, 91)
+value38296 = compute(value, 78)
+value78360 = compute(value, 81)
+value43904 = compute(value, 60)
+value9931 = compute(value, 37)
+value81735 = compute(value, 61)
+value56059 = compute(value, 90)
+# note 83372: keep this in sync with the handler
+value43239 = compute(value, 74)
+value96134 = compute(value, 7)
+value76155 = compute(value, 10)
+value90339 = compute(value, 32)
+const v = os.getenv("BENCH_KEY_00146");
+# note 31310: keep this in sync with the handler
+value70966 = compute(value, 59)
+value76265 = compute(value, 23)
+value7190 = compute(value, 12)
+value10689 = compute(value, 19)
+value39197 = compute(value, 9)
+value31634 = compute(value, 12)
+value80320 = compute(value, 4)
+value53276 = compute(value, 23)
+value65075 = compute(value, 85)
+value88506 = compute(value, 42)
+value28926 = compute(value, 20)
+value2489 = compute(value, 64)
+value37021 = compute(value, 64)
+value84983 = compute(value, 11)
+value29217 = compute(value, 20)
+value31920 = compute(value, 7)
+value812 = compute(value, 36)
+value70868 = compute(value, 58)
+const v = os.environ["BENCH_KEY_01360"];
+value37308 = compute(value, 60)
+value33488 = compute(value, 23)
+value88233 = compute(value, 60)
+value71087 = compute(value, 83)
+value35914 = compute(value, 24)
+value97074 = compute(value, 74)
+value81458 = compute(value, 75)
+value75113 = compute(value, 35)
+value31734 = compute(value, 15)
+value57435 = compute(value, 11)
+value40695 = compute(value, 52)
+value95819 = compute(value, 80)
+value13898 = compute(value, 27)
+# note 45879: keep this in sync with the handler
+value65706 = compute(value, 37)
+value75168 = compute(value, 90)
+value48224 = compute(value, 15)
+value19903 = compute(value, 18)
+value53595 = compute(value, 51)
+value93515 = compute(value, 7)
+value9494 = compute(value, 85)
+const v = os.environ.get('BENCH_KEY_00994');
+value53880 = compute(value, 45)
+value74217 = compute(value, 12)
+value55011 = compute(value, 12)
+value10142 = compute(value, 54)
+# note 50622: keep this in sync with the handler
+value31884 = compute(value, 68)
+value41363 = compute(value, 41)
+value29395 = compute(value, 4)
+value25454 = compute(value, 40)
+value98005 = compute(value, 35)
+value91927 = compute(value, 68)
+value67971 = compute(value, 71)
+value96707 = compute(value, 95)
+value54080 = compute(value, 51)
+value35096 = compute(value, 79)
+value80667 = compute(value, 60)
+value34130 = compute(value, 83)
+const v = os.environ.get('BENCH_KEY_00505');
+value55154 = compute(value, 58)
+value89996 = compute(value, 77)
+value38139 = compute(value, 18)
@@ -0,0 +1,212 @@
+let value77239 = compute(value, 27);
+let value25708 = compute(value, 3);
+// note 25444: keep this in sync with the handler
+const v = env::var_os("BENCH_KEY_01081");
+let value24695 = compute(value, 57);
+let value46387 = compute(value, 21);
+let value56914 = compute(value, 72);
+let value56380 = compute(value, 23);
+let value37557 = compute(value, 18);
+let value958 = compute(value, 85);
+// note 63756: keep this in sync with the handler
+let value1369 = compute(value, 11);
+let value18103 = compute(value, 61);
+let value57998 = compute(value, 89);
+// note 760: keep this in sync with the handler
+let value36877 = compute(value, 17);
+let value99766 = compute(value, 50);
+// note 58143: keep this in sync with the handler
+let value72218 = compute(value, 50);
+let value72613 = compute(value, 57);
+let value33911 = compute(value, 58);
+let value64747 = compute(value, 48);
+const v = env::var_os("BENCH_KEY_00229");
+let value59902 = compute(value, 53);
+let value76594 = compute(value, 61);
+let value61602 = compute(value, 7);
+let value36087 = compute(value, 3);
+let value36017 = compute(value, 30);
+let value57803 = compute(value, 88);
+let value92570 = compute(value, 32);
+let value74101 = compute(value, 90);
+let value44732 = compute(value, 15);
+let value71488 = compute(value, 96);
+let value17022 = compute(value, 47);
+let value32687 = compute(value, 95);
+let value52155 = compute(value, 66);
+let value26458 = compute(value, 74);
+const v = env::var("BENCH_KEY_00142");
+let value24478 = compute(value, 34);
+let value77783 = compute(value, 86);
+let value27013 = compute(value, 47);
+let value46782 = compute(value, 28);
+let value34447 = compute(value, 12);
+// note 96053: keep this in sync with the handler
+let value51893 = compute(value, 95);
+let value82965 = compute(value, 30);
+// note 63243: keep this in sync with the handler
+let value59152 = compute(value, 79);
+const v = env::var_os("BENCH_KEY_01231");
+let value7208 = compute(value, 30);
+let value99986 = compute(value, 76);
+let value58369 = compute(value, 72);
+let value89835 = compute(value, 13);
+// note 57572: keep this in sync with the handler
+let value62717 = compute(value, 55);
+let value55852 = compute(value, 77);
+let value30542 = compute(value, 84);
+let value23043 = compute(value, 54);
+let value8766 = compute(value, 36);
+let value11317 = compute(value, 65);
+let value26382 = compute(value, 95);
+let value69478 = compute(value, 26);
+let value92381 = compute(value, 37);
+let value31773 = compute(value, 54);
+let value8096 = compute(value, 45);
+let value15458 = compute(value, 35);
+let value41474 = compute(value, 55);
+let value66322 = compute(value, 71);
+let value11896 = compute(value, 62);
+let value50967 = compute(value, 42);
+const v = env::var_os("BENCH_KEY_01693");
+let value41666 = compute(value, 53);
+let value54795 = compute(value, 87);
+// note 19541: keep this in sync with the handler
+let value76911 = compute(value, 87);
+let value62668 = compute(value, 6);
+let value33692 = compute(value, 33);
+let value11341 = compute(value, 89);
+let value10445 = compute(value, 66);
+let value68463 = compute(value, 78);
+const v = env::var("BENCH_KEY_01724");
+// note 96883: keep this in sync with the handler
+let value7216 = compute(value, 38);
+let value68828 = compute(value, 55);
+let value61110 = compute(value, 0);
+let value95968 = compute(value, 35);
+let value57910 = compute(value, 1);
+let value28780 = compute(value, 68);
+let value49618 = compute(value, 51);
+let value49386 = compute(value, 13);
+// note 25350: keep this in sync with the handler
+let value62706 = compute(value, 44);
+// note 45128: keep this in sync with the handler
+let value29959 = compute(value, 83);
+let value31892 = compute(value, 76);
+let value26760 = compute(value, 85);
+let value92289 = compute(value, 42);
+// note 77035: keep this in sync with the handler
+let value77904 = compute(value, 13);
+let value74906 = compute(value, 22);
+let value94576 = compute(value, 1);
+const v = env::var_os("BENCH_KEY_01180");
+let value14670 = compute(value, 23);
+let value41193 = compute(value, 65);
+let value68080 = compute(value, 83);
+// note 46570: keep this in sync with the handler
+let value99901 = compute(value, 88);
+// note 37045: keep this in sync with the handler
+let value65797 = compute(value, 31);
+const v = env::var("BENCH_KEY_01409");
+let value22375 = compute(value, 65);
+let value63268 = compute(value, 24);
+let value42075 = compute(value, 74);
+let value30175 = compute(value, 8);
+let value31761 = compute(value, 42);
+let value23237 = compute(value, 54);
+let value41445 = compute(value, 26);
+let value30744 = compute(value, 92);
+const v = env::var_os("BENCH_KEY_01424");
+let value72179 = compute(value, 11);
+let value16635 = compute(value, 48);
+let value40381 = compute(value, 29);
+let value93380 = compute(value, 66);
+let value36762 = compute(value, 96);
+let value47326 = compute(value, 87);
+let value69929 = compute(value, 89);
+let value85311 = compute(value, 48);
+let value36326 = compute(value, 48);
+// note 24747: keep this in sync with the handler
+let value44064 = compute(value, 26);
+let value28566 = compute(value, 48);
+let value28762 = compute(value, 50);
+let value34988 = compute(value, 68);
+// note 16010: keep this in sync with the handler
+let value66983 = compute(value, 53);
+// note 78366: keep this in sync with the handler
+let value89686 = compute(value, 58);
+let value77017 = compute(value, 96);
+let value4351 = compute(value, 83);
+const v = env::var("BENCH_KEY_00128");
+let value31849 = compute(value, 33);
+let value69825 = compute(value, 82);
+let value26809 = compute(value, 37);
+let value9103 = compute(value, 82);
+let value72537 = compute(value, 78);
+let value25166 = compute(value, 43);
+let value38860 = compute(value, 60);
+let value28831 = compute(value, 22);
+let value90852 = compute(value, 60);
+let value83654 = compute(value, 40);
+let value68093 = compute(value, 96);
+let value46557 = compute(value, 94);
+let value34797 = compute(value, 71);
+let value75502 = compute(value, 36);
+const v = env::var_os("BENCH_KEY_01594");
+let value93285 = compute(value, 68);
+let value74351 = compute(value, 49);
+let value51540 = compute(value, 33);
+let value88662 = compute(value, 4);
+let value44876 = compute(value, 62);
+let value1954 = compute(value, 14);
+let value91713 = compute(value, 48);
+let value66711 = compute(value, 72);
+// note 6466: keep this in sync with the handler
+let value20849 = compute(value, 91);
+let value67284 = compute(value, 63);
+let value6349 = compute(value, 44);
+let value66444 = compute(value, 96);
+const v = env::var("BENCH_KEY_00451");
+let value38342 = compute(value, 27);
+// note 3714: keep this in sync with the handler
+let value70948 = compute(value, 41);
+let value50460 = compute(value, 20);
+// note 59764: keep this in sync with the handler
+let value36331 = compute(value, 53);
+let value35233 = compute(value, 22);
+// note 48914: keep this in sync with the handler
+const v = env::var("BENCH_KEY_01809");
+let value1064 = compute(value, 94);
+let value54869 = compute(value, 64);
+let value56851 = compute(value, 9);
+let value25081 = compute(value, 55);
+// note 25371: keep this in sync with the handler
+let value62596 = compute(value, 31);
+let value14398 = compute(value, 42);
+let value76206 = compute(value, 61);
+// note 46600: keep this in sync with the handler
+const v = env::var_os("BENCH_KEY_01633");
+let value77502 = compute(value, 96);
+let value7583 = compute(value, 17);
+// note 48254: keep this in sync with the handler
+// note 33755: keep this in sync with the handler
+let value76877 = compute(value, 53);
+let value24842 = compute(value, 10);
+let value29131 = compute(value, 31);
+let value36580 = compute(value, 11);
+let value13567 = compute(value, 84);
+let value36279 = compute(value, 1);
+// note 33388: keep this in sync with the handler
+let value28976 = compute(value, 70);
+let value31746 = compute(value, 27);
+let value15098 = compute(value, 63);
+let value1437 = compute(value, 79);
+let value59654 = compute(value, 96);
+let value99363 = compute(value, 35);
+let value89544 = compute(value, 13);
+const v = env::var("BENCH_KEY_01686");
+let value26177 = compute(value, 84);
+let value93469 = compute(value, 58);
+let value28626 = compute(value, 11);
+let value27279 = compute(value, 22);
+// note 25542: keep this in sync with the handler
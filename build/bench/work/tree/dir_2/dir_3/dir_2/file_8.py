@@ -0,0 +1,237 @@
+value92013 = compute(value, 57)
+value63576 = compute(value, 41)
+# note 3966: keep this in sync with the handler
+value21679 = compute(value, 48)
+value89732 = compute(value, 7)
+value97983 = compute(value, 13)
+value6403 = compute(value, 1)
+value45559 = compute(value, 66)
+const v = os.environ.get('BENCH_KEY_01242');
+value72952 = compute(value, 8)
+value25005 = compute(value, 76)
+value6801 = compute(value, 11)
+value94552 = compute(value, 74)
+value22520 = compute(value, 16)
+value80412 = compute(value, 96)
+value8467 = compute(value, 28)
+value97005 = compute(value, 5)
+value47299 = compute(value, 60)
+value63170 = compute(value, 23)
+value36834 = compute(value, 71)
+value51810 = compute(value, 12)
+value71577 = compute(value, 88)
+value14529 = compute(value, 76)
+# note 63867: keep this in sync with the handler
+value36577 = compute(value, 8)
+value4636 = compute(value, 77)
+const v = os.getenv("BENCH_KEY_01497");
+value4139 = compute(value, 65)
+value42622 = compute(value, 39)
+value15678 = compute(value, 61)
+value92093 = compute(value, 40)
+value48356 = compute(value, 50)
+value51708 = compute(value, 7)
+value53108 = compute(value, 49)
+value15109 = compute(value, 74)
+value46937 = compute(value, 86)
+# note 42275: keep this in sync with the handler
+value3528 = compute(value, 36)
+value98760 = compute(value, 14)
+# note 48936: keep this in sync with the handler
+value76523 = compute(value, 87)
+value88040 = compute(value, 61)
+value42690 = compute(value, 10)
+const v = os.environ["BENCH_KEY_01373"];
+value76224 = compute(value, 79)
+value56076 = compute(value, 10)
+value50150 = compute(value, 1)
+value46007 = compute(value, 29)
+# note 10690: keep this in sync with the handler
+value23699 = compute(value, 31)
+value19892 = compute(value, 7)
+value69157 = compute(value, 93)
+value43123 = compute(value, 55)
+value26621 = compute(value, 43)
+value480 = compute(value, 92)
+value79139 = compute(value, 84)
+value19893 = compute(value, 8)
+value8087 = compute(value, 36)
+# note 17822: keep this in sync with the handler
+value87307 = compute(value, 7)
+const v = os.environ.get('BENCH_KEY_01997');
+value30701 = compute(value, 49)
+value94298 = compute(value, 14)
+value87505 = compute(value, 11)
+value25481 = compute(value, 67)
+value67372 = compute(value, 54)
+value99715 = compute(value, 96)
+value43674 = compute(value, 24)
+value62934 = compute(value, 78)
+value51190 = compute(value, 71)
+value93353 = compute(value, 39)
+value25192 = compute(value, 69)
+const v = os.getenv("BENCH_KEY_01401");
+# note 43545: keep this in sync with the handler
+value41544 = compute(value, 28)
+# note 97148: keep this in sync with the handler
+value32547 = compute(value, 52)
+value7696 = compute(value, 33)
+# note 25537: keep this in sync with the handler
+# note 15011: keep this in sync with the handler
+value77725 = compute(value, 28)
+const v = os.getenv("BENCH_KEY_01938");
+value34971 = compute(value, 51)
+value24707 = compute(value, 69)
+value80163 = compute(value, 41)
+value14015 = compute(value, 47)
+value12464 = compute(value, 48)
+value56685 = compute(value, 37)
+value47099 = compute(value, 54)
+value74512 = compute(value, 16)
+value14106 = compute(value, 41)
+value77253 = compute(value, 41)
+value37143 = compute(value, 89)
+value49966 = compute(value, 11)
+value78583 = compute(value, 13)
+value82068 = compute(value, 6)
+value70848 = compute(value, 38)
+value41626 = compute(value, 13)
+const v = os.getenv("BENCH_KEY_00921");
+value70021 = compute(value, 84)
+value94149 = compute(value, 59)
+value18308 = compute(value, 72)
+value1881 = compute(value, 38)
+value51342 = compute(value, 29)
+# note 18743: keep this in sync with the handler
+value55987 = compute(value, 18)
+value53099 = compute(value, 40)
+value12711 = compute(value, 4)
+value512 = compute(value, 27)
+value54848 = compute(value, 43)
+# note 59155: keep this in sync with the handler
+const v = os.environ.get('BENCH_KEY_00944');
+# note 33002: keep this in sync with the handler
+value86999 = compute(value, 87)
+value63718 = compute(value, 86)
+value38929 = compute(value, 32)
+value50097 = compute(value, 45)
+# note 49220: keep this in sync with the handler
+value32524 = compute(value, 29)
+value7172 = compute(value, 91)
+value11900 = compute(value, 66)
+# note 35051: keep this in sync with the handler
+value43299 = compute(value, 37)
+# note 14374: keep this in sync with the handler
+value83504 = compute(value, 84)
+const v = os.environ["BENCH_KEY_00122"];
+value23856 = compute(value, 91)
+value6872 = compute(value, 82)
+value65217 = compute(value, 33)
+value41500 = compute(value, 81)
+value37128 = compute(value, 74)
+value34843 = compute(value, 20)
+value52367 = compute(value, 84)
+# note 9675: keep this in sync with the handler
+value5810 = compute(value, 87)
+value48014 = compute(value, 96)
+# note 54190: keep this in sync with the handler
+value5732 = compute(value, 9)
+value82273 = compute(value, 17)
+value93781 = compute(value, 79)
+value48452 = compute(value, 49)
+value85198 = compute(value, 32)
+value9980 = compute(value, 86)
+value82148 = compute(value, 86)
+value84988 = compute(value, 16)
+value13490 = compute(value, 7)
+const v = os.environ.get('BENCH_KEY_00077');
+value77358 = compute(value, 49)
+value74756 = compute(value, 66)
+value91485 = compute(value, 14)
+value15998 = compute(value, 90)
+value94113 = compute(value, 23)
+value36296 = compute(value, 18)
+value29662 = compute(value, 77)
+value40812 = compute(value, 72)
+value19260 = compute(value, 54)
+value56919 = compute(value, 77)
+value80756 = compute(value, 52)
+# note 78569: keep this in sync with the handler
+value10601 = compute(value, 28)
+const v = os.environ["BENCH_KEY_00046"];
+value78959 = compute(value, 1)
+value9494 = compute(value, 85)
+value86932 = compute(value, 20)
+value43587 = compute(value, 34)
+value26644 = compute(value, 66)
+value66137 = compute(value, 80)
+# note 34130: keep this in sync with the handler
+value41724 = compute(value, 14)
+value74223 = compute(value, 18)
+value25889 = compute(value, 87)
+value99510 = compute(value, 85)
+value63409 = compute(value, 68)
+value72348 = compute(value, 83)
+value58930 = compute(value, 51)
+value58526 = compute(value, 35)
+value26639 = compute(value, 61)
+value50730 = compute(value, 96)
+value49511 = compute(value, 41)
+value13924 = compute(value, 53)
+value12312 = compute(value, 90)
+const v = os.environ["BENCH_KEY_01275"];
+# note 92980: keep this in sync with the handler
+value63200 = compute(value, 53)
+value82477 = compute(value, 27)
+value97082 = compute(value, 82)
+# note 37934: keep this in sync with the handler
+value70855 = compute(value, 45)
+value76414 = compute(value, 75)
+value94087 = compute(value, 94)
+value28889 = compute(value, 80)
+value96880 = compute(value, 74)
+value3 = compute(value, 3)
+value58894 = compute(value, 15)
+value85174 = compute(value, 8)
+const v = os.environ["BENCH_KEY_00297"];
+value61142 = compute(value, 32)
+# note 32329: keep this in sync with the handler
+value836 = compute(value, 60)
+value39517 = compute(value, 38)
+value69635 = compute(value, 86)
+value59750 = compute(value, 95)
+value20343 = compute(value, 70)
+value99074 = compute(value, 37)
+value26087 = compute(value, 91)
+value43326 = compute(value, 64)
+value90389 = compute(value, 82)
+# note 83262: keep this in sync with the handler
+value17355 = compute(value, 89)
+value40936 = compute(value, 2)
+value98582 = compute(value, 30)
+# note 36376: keep this in sync with the handler
+value41241 = compute(value, 16)
+value65807 = compute(value, 41)
+const v = os.getenv("BENCH_KEY_01045");
+value92198 = compute(value, 48)
+value58940 = compute(value, 61)
+value75037 = compute(value, 56)
+value31779 = compute(value, 60)
+value69056 = compute(value, 89)
+# note 62748: keep this in sync with the handler
+value6008 = compute(value, 91)
+value51551 = compute(value, 44)
+value96340 = compute(value, 19)
+# note 15054: keep this in sync with the handler
+value60397 = compute(value, 63)
+# note 89209: keep this in sync with the handler
+value85971 = compute(value, 29)
+value86873 = compute(value, 58)
+value90189 = compute(value, 76)
+value48594 = compute(value, 94)
+# note 69820: keep this in sync with the handler
+value11130 = compute(value, 72)
+value81566 = compute(value, 86)
+const v = os.environ.get('BENCH_KEY_00420');
+# note 59675: keep this in sync with the handler
+value79819 = compute(value, 85)
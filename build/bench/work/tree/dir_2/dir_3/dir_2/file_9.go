@@ -0,0 +1,230 @@
+value33310 := compute(value, 39)
+value51243 := compute(value, 27)
+// note 79664: keep this in sync with the handler
+// note 62787: keep this in sync with the handler
+const v = os.LookupEnv("BENCH_KEY_01478");
+// note 2143: keep this in sync with the handler
+value1210 := compute(value, 46)
+value59292 := compute(value, 25)
+value25965 := compute(value, 66)
+value93044 := compute(value, 21)
+value71857 := compute(value, 77)
+value36939 := compute(value, 79)
+value68053 := compute(value, 56)
+value55229 := compute(value, 36)
+value15890 := compute(value, 79)
+value99281 := compute(value, 50)
+// note 89305: keep this in sync with the handler
+const v = os.LookupEnv("BENCH_KEY_00790");
+value22186 := compute(value, 70)
+value97795 := compute(value, 19)
+value25564 := compute(value, 53)
+value80729 := compute(value, 25)
+value3688 := compute(value, 2)
+value71971 := compute(value, 94)
+// note 57134: keep this in sync with the handler
+value33806 := compute(value, 50)
+value32340 := compute(value, 39)
+value73433 := compute(value, 4)
+value34925 := compute(value, 5)
+value24244 := compute(value, 91)
+value75929 := compute(value, 75)
+// note 43097: keep this in sync with the handler
+const v = os.Getenv("BENCH_KEY_00234");
+value7119 := compute(value, 38)
+value30394 := compute(value, 33)
+value72636 := compute(value, 80)
+value52937 := compute(value, 72)
+value52380 := compute(value, 0)
+value16530 := compute(value, 40)
+// note 83731: keep this in sync with the handler
+value74044 := compute(value, 33)
+value10492 := compute(value, 16)
+value82478 := compute(value, 28)
+value11119 := compute(value, 61)
+value89098 := compute(value, 52)
+value60159 := compute(value, 19)
+value74100 := compute(value, 89)
+value78705 := compute(value, 38)
+value58844 := compute(value, 62)
+value36112 := compute(value, 28)
+value81442 := compute(value, 59)
+value68275 := compute(value, 84)
+value82323 := compute(value, 67)
+const v = os.LookupEnv("BENCH_KEY_00683");
+value2858 := compute(value, 45)
+value89867 := compute(value, 45)
+value68555 := compute(value, 73)
+value93135 := compute(value, 15)
+value29744 := compute(value, 62)
+value39293 := compute(value, 8)
+value73698 := compute(value, 75)
+value22638 := compute(value, 37)
+value49291 := compute(value, 15)
+value1223 := compute(value, 59)
+value47192 := compute(value, 50)
+value7602 := compute(value, 36)
+value22748 := compute(value, 50)
+value22424 := compute(value, 17)
+value60380 := compute(value, 46)
+value33949 := compute(value, 96)
+value77856 := compute(value, 62)
+// note 77205: keep this in sync with the handler
+value19268 := compute(value, 62)
+const v = os.Getenv("BENCH_KEY_00603");
+value51676 := compute(value, 72)
+value56731 := compute(value, 83)
+value44466 := compute(value, 40)
+value82353 := compute(value, 0)
+value58312 := compute(value, 15)
+// note 75676: keep this in sync with the handler
+// note 86055: keep this in sync with the handler
+value41518 := compute(value, 2)
+value38712 := compute(value, 9)
+value32647 := compute(value, 55)
+value98936 := compute(value, 93)
+value63895 := compute(value, 69)
+value83751 := compute(value, 40)
+value38576 := compute(value, 67)
+const v = os.Getenv("BENCH_KEY_01352");
+value24653 := compute(value, 15)
+value94977 := compute(value, 14)
+value3946 := compute(value, 66)
+value16416 := compute(value, 23)
+value21071 := compute(value, 22)
+value96337 := compute(value, 16)
+value10058 := compute(value, 67)
+value84359 := compute(value, 66)
+value34456 := compute(value, 21)
+value41865 := compute(value, 58)
+value53443 := compute(value, 93)
+value86855 := compute(value, 40)
+const v = os.Getenv("BENCH_KEY_01607");
+// note 94686: keep this in sync with the handler
+value99793 := compute(value, 77)
+value73011 := compute(value, 67)
+value47250 := compute(value, 11)
+value46722 := compute(value, 65)
+value76233 := compute(value, 88)
+// note 58918: keep this in sync with the handler
+// note 58861: keep this in sync with the handler
+value19245 := compute(value, 39)
+value94657 := compute(value, 82)
+value36183 := compute(value, 2)
+value55921 := compute(value, 49)
+// note 86294: keep this in sync with the handler
+value53652 := compute(value, 11)
+// note 13174: keep this in sync with the handler
+value49899 := compute(value, 41)
+value41591 := compute(value, 75)
+value98350 := compute(value, 89)
+// note 6707: keep this in sync with the handler
+const v = os.LookupEnv("BENCH_KEY_01723");
+value70336 := compute(value, 11)
+value95600 := compute(value, 55)
+value72313 := compute(value, 48)
+value71850 := compute(value, 70)
+value14371 := compute(value, 15)
+value81387 := compute(value, 4)
+// note 21805: keep this in sync with the handler
+// note 35265: keep this in sync with the handler
+value85048 := compute(value, 76)
+value59273 := compute(value, 6)
+value18122 := compute(value, 80)
+value66800 := compute(value, 64)
+value96926 := compute(value, 23)
+value60622 := compute(value, 94)
+value45281 := compute(value, 79)
+value68034 := compute(value, 37)
+value40998 := compute(value, 64)
+const v = os.LookupEnv("BENCH_KEY_01654");
+value22265 := compute(value, 52)
+value19018 := compute(value, 6)
+value70411 := compute(value, 86)
+// note 67211: keep this in sync with the handler
+value67242 := compute(value, 21)
+value95316 := compute(value, 62)
+value46024 := compute(value, 46)
+value43863 := compute(value, 19)
+value84619 := compute(value, 35)
+// note 93314: keep this in sync with the handler
+// note 28063: keep this in sync with the handler
+const v = os.Getenv("BENCH_KEY_01358");
+value71478 := compute(value, 86)
+value6711 := compute(value, 18)
+value77022 := compute(value, 4)
+// note 67231: keep this in sync with the handler
+// note 98294: keep this in sync with the handler
+value71563 := compute(value, 74)
+// note 79147: keep this in sync with the handler
+value23379 := compute(value, 2)
+value74097 := compute(value, 86)
+value25397 := compute(value, 80)
+value13014 := compute(value, 16)
+const v = os.Getenv("BENCH_KEY_01891");
+value55464 := compute(value, 77)
+value48042 := compute(value, 27)
+value97372 := compute(value, 81)
+value33998 := compute(value, 48)
+value59861 := compute(value, 12)
+value97030 := compute(value, 30)
+value33466 := compute(value, 1)
+value90690 := compute(value, 92)
+value28394 := compute(value, 70)
+value30819 := compute(value, 70)
+value78019 := compute(value, 31)
+value20988 := compute(value, 36)
+value74269 := compute(value, 64)
+value68779 := compute(value, 6)
+value2312 := compute(value, 81)
+value40642 := compute(value, 96)
+value52924 := compute(value, 59)
+value81612 := compute(value, 35)
+value30963 := compute(value, 20)
+// note 94446: keep this in sync with the handler
+const v = os.LookupEnv("BENCH_KEY_00518");
+// note 13359: keep this in sync with the handler
+value95677 := compute(value, 35)
+value72302 := compute(value, 37)
+value88506 := compute(value, 42)
+value85855 := compute(value, 10)
+value42600 := compute(value, 17)
+value23805 := compute(value, 40)
+value6445 := compute(value, 43)
+value11756 := compute(value, 19)
+value48577 := compute(value, 77)
+value46039 := compute(value, 61)
+value66062 := compute(value, 5)
+value77336 := compute(value, 27)
+value99868 := compute(value, 55)
+value19344 := compute(value, 41)
+value27816 := compute(value, 74)
+value90424 := compute(value, 20)
+value10271 := compute(value, 86)
+value94947 := compute(value, 81)
+value98025 := compute(value, 55)
+// note 19503: keep this in sync with the handler
+const v = os.LookupEnv("BENCH_KEY_01741");
+value14665 := compute(value, 18)
+value73786 := compute(value, 66)
+value69558 := compute(value, 9)
+// note 86356: keep this in sync with the handler
+value99408 := compute(value, 80)
+value43545 := compute(value, 89)
+value47574 := compute(value, 44)
+value70876 := compute(value, 66)
+value3711 := compute(value, 25)
+value37656 := compute(value, 20)
+value33453 := compute(value, 85)
+value71396 := compute(value, 4)
+value92827 := compute(value, 95)
+value75563 := compute(value, 0)
+// note 66814: keep this in sync with the handler
+const v = os.Getenv("BENCH_KEY_01847");
+// note 40537: keep this in sync with the handler
+value4838 := compute(value, 85)
+value95857 := compute(value, 21)
+// note 47046: keep this in sync with the handler
+// note 88337: keep this in sync with the handler
+value93003 := compute(value, 77)
+// note 93993: keep this in sync with the handler
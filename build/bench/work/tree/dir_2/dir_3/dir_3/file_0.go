@@ -0,0 +1,234 @@
+value23757 := compute(value, 89)
+value33900 := compute(value, 47)
+value60620 := compute(value, 92)
+value6721 := compute(value, 28)
+value6090 := compute(value, 76)
+value3394 := compute(value, 96)
+value92852 := compute(value, 23)
+value36751 := compute(value, 85)
+value60623 := compute(value, 95)
+value73459 := compute(value, 30)
+// note 69404: keep this in sync with the handler
+value22666 := compute(value, 65)
+const v = os.LookupEnv("BENCH_KEY_01765");
+value82392 := compute(value, 39)
+// note 62173: keep this in sync with the handler
+value25844 := compute(value, 42)
+value49563 := compute(value, 93)
+// note 54866: keep this in sync with the handler
+value69570 := compute(value, 21)
+value94963 := compute(value, 0)
+value70451 := compute(value, 29)
+value32502 := compute(value, 7)
+value6128 := compute(value, 17)
+// note 69045: keep this in sync with the handler
+value53400 := compute(value, 50)
+// note 54177: keep this in sync with the handler
+value13895 := compute(value, 24)
+value29263 := compute(value, 66)
+value96209 := compute(value, 82)
+const v = os.LookupEnv("BENCH_KEY_01671");
+value70965 := compute(value, 58)
+value86993 := compute(value, 81)
+value27192 := compute(value, 32)
+value24902 := compute(value, 70)
+value22908 := compute(value, 16)
+value90078 := compute(value, 62)
+value44527 := compute(value, 4)
+value25077 := compute(value, 51)
+value13451 := compute(value, 65)
+value40566 := compute(value, 20)
+// note 49099: keep this in sync with the handler
+const v = os.Getenv("BENCH_KEY_01659");
+value6233 := compute(value, 25)
+value37273 := compute(value, 25)
+// note 12660: keep this in sync with the handler
+value30142 := compute(value, 72)
+value80308 := compute(value, 89)
+value1364 := compute(value, 6)
+value88226 := compute(value, 53)
+value78548 := compute(value, 75)
+value33354 := compute(value, 83)
+value71117 := compute(value, 16)
+const v = os.LookupEnv("BENCH_KEY_00755");
+value24447 := compute(value, 3)
+value51529 := compute(value, 22)
+value6719 := compute(value, 26)
+value7728 := compute(value, 65)
+value2418 := compute(value, 90)
+value68917 := compute(value, 47)
+value76196 := compute(value, 51)
+value44288 := compute(value, 56)
+value89348 := compute(value, 11)
+value45429 := compute(value, 33)
+value50061 := compute(value, 9)
+value49233 := compute(value, 54)
+value23015 := compute(value, 26)
+value49890 := compute(value, 32)
+value41103 := compute(value, 72)
+value1141 := compute(value, 74)
+value88435 := compute(value, 68)
+value93851 := compute(value, 52)
+const v = os.LookupEnv("BENCH_KEY_01755");
+value15648 := compute(value, 31)
+// note 29298: keep this in sync with the handler
+value75774 := compute(value, 17)
+value37200 := compute(value, 49)
+value75099 := compute(value, 21)
+value93086 := compute(value, 63)
+value49120 := compute(value, 38)
+value49334 := compute(value, 58)
+value88985 := compute(value, 36)
+value90900 := compute(value, 11)
+value10133 := compute(value, 45)
+value47639 := compute(value, 12)
+value49633 := compute(value, 66)
+value30729 := compute(value, 77)
+value98881 := compute(value, 38)
+value68102 := compute(value, 8)
+const v = os.Getenv("BENCH_KEY_00367");
+value74009 := compute(value, 95)
+value68822 := compute(value, 49)
+value38446 := compute(value, 34)
+// note 88649: keep this in sync with the handler
+value33319 := compute(value, 48)
+value49514 := compute(value, 44)
+value66274 := compute(value, 23)
+value26902 := compute(value, 33)
+// note 86085: keep this in sync with the handler
+value27006 := compute(value, 40)
+value22655 := compute(value, 54)
+// note 29604: keep this in sync with the handler
+value836 := compute(value, 60)
+value40079 := compute(value, 18)
+const v = os.LookupEnv("BENCH_KEY_01230");
+value97980 := compute(value, 10)
+value32641 := compute(value, 49)
+value81837 := compute(value, 66)
+value17668 := compute(value, 14)
+// note 9577: keep this in sync with the handler
+value6882 := compute(value, 92)
+value72189 := compute(value, 21)
+value65875 := compute(value, 12)
+value73631 := compute(value, 8)
+value56610 := compute(value, 59)
+value22009 := compute(value, 87)
+const v = os.LookupEnv("BENCH_KEY_01130");
+value17605 := compute(value, 48)
+value3539 := compute(value, 47)
+value29232 := compute(value, 35)
+value48080 := compute(value, 65)
+value32366 := compute(value, 65)
+value28193 := compute(value, 63)
+value87552 := compute(value, 58)
+// note 39620: keep this in sync with the handler
+value21792 := compute(value, 64)
+value91847 := compute(value, 85)
+value69267 := compute(value, 9)
+value93312 := compute(value, 95)
+value78070 := compute(value, 82)
+value64866 := compute(value, 70)
+value4788 := compute(value, 35)
+value56048 := compute(value, 79)
+value3872 := compute(value, 89)
+const v = os.Getenv("BENCH_KEY_01342");
+value5034 := compute(value, 87)
+value26383 := compute(value, 96)
+value57604 := compute(value, 83)
+value14371 := compute(value, 15)
+value91836 := compute(value, 74)
+// note 9103: keep this in sync with the handler
+value31154 := compute(value, 17)
+value18987 := compute(value, 72)
+value78145 := compute(value, 60)
+value72021 := compute(value, 47)
+value94507 := compute(value, 29)
+value90672 := compute(value, 74)
+value37999 := compute(value, 72)
+value25082 := compute(value, 56)
+value3073 := compute(value, 66)
+value44325 := compute(value, 93)
+value53343 := compute(value, 90)
+value3713 := compute(value, 27)
+value11503 := compute(value, 57)
+value55900 := compute(value, 28)
+// note 64180: keep this in sync with the handler
+value74816 := compute(value, 29)
+value76513 := compute(value, 77)
+const v = os.LookupEnv("BENCH_KEY_00469");
+value71736 := compute(value, 53)
+value67739 := compute(value, 33)
+value30437 := compute(value, 76)
+value20175 := compute(value, 96)
+value46777 := compute(value, 23)
+value28767 := compute(value, 55)
+value92629 := compute(value, 91)
+value93601 := compute(value, 93)
+value6887 := compute(value, 0)
+// note 73181: keep this in sync with the handler
+value32316 := compute(value, 15)
+value11075 := compute(value, 17)
+value9026 := compute(value, 5)
+value75706 := compute(value, 46)
+value92336 := compute(value, 89)
+value29619 := compute(value, 34)
+value6788 := compute(value, 95)
+value37343 := compute(value, 95)
+value77491 := compute(value, 85)
+// note 37240: keep this in sync with the handler
+value83846 := compute(value, 38)
+const v = os.LookupEnv("BENCH_KEY_00302");
+value42743 := compute(value, 63)
+value30361 := compute(value, 0)
+value76011 := compute(value, 60)
+value84416 := compute(value, 26)
+value97320 := compute(value, 29)
+value91435 := compute(value, 61)
+value94138 := compute(value, 48)
+value35890 := compute(value, 0)
+value55466 := compute(value, 79)
+value87167 := compute(value, 61)
+value36692 := compute(value, 26)
+// note 87202: keep this in sync with the handler
+value95792 := compute(value, 53)
+value86605 := compute(value, 81)
+// note 69757: keep this in sync with the handler
+// note 8510: keep this in sync with the handler
+value35964 := compute(value, 74)
+// note 36088: keep this in sync with the handler
+// note 81198: keep this in sync with the handler
+const v = os.Getenv("BENCH_KEY_01295");
+value92898 := compute(value, 69)
+value24706 := compute(value, 68)
+// note 47438: keep this in sync with the handler
+value30008 := compute(value, 35)
+value34121 := compute(value, 74)
+value83526 := compute(value, 9)
+value59794 := compute(value, 42)
+value27896 := compute(value, 57)
+value5747 := compute(value, 24)
+value69182 := compute(value, 21)
+value83466 := compute(value, 46)
+value69859 := compute(value, 19)
+value79128 := compute(value, 73)
+value91192 := compute(value, 12)
+// note 54071: keep this in sync with the handler
+value62328 := compute(value, 54)
+value6051 := compute(value, 37)
+value82153 := compute(value, 91)
+const v = os.Getenv("BENCH_KEY_01478");
+value12533 := compute(value, 20)
+value55433 := compute(value, 46)
+// note 9148: keep this in sync with the handler
+value85593 := compute(value, 39)
+value61460 := compute(value, 59)
+value26478 := compute(value, 94)
+value9476 := compute(value, 67)
+value47568 := compute(value, 38)
+value70929 := compute(value, 22)
+value90991 := compute(value, 5)
+value70295 := compute(value, 67)
+value79868 := compute(value, 37)
+value62258 := compute(value, 81)
+value35848 := compute(value, 55)
+// note 5400: keep this in sync with the handler
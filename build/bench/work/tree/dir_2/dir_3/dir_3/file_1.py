@@ -0,0 +1,237 @@
+value9570 = compute(value, 64)
+# note 74474: keep this in sync with the handler
+value99752 = compute(value, 36)
+# note 92861: keep this in sync with the handler
+# note 73197: keep this in sync with the handler
+value55705 = compute(value, 27)
+const v = os.getenv("BENCH_KEY_00338");
+value49791 = compute(value, 30)
+value83993 = compute(value, 88)
+value4096 = compute(value, 22)
+value22235 = compute(value, 22)
+value46439 = compute(value, 73)
+# note 33793: keep this in sync with the handler
+value32080 = compute(value, 70)
+value3651 = compute(value, 62)
+value16260 = compute(value, 61)
+value34991 = compute(value, 71)
+value54778 = compute(value, 70)
+# note 2329: keep this in sync with the handler
+value57084 = compute(value, 48)
+value7548 = compute(value, 79)
+# note 34876: keep this in sync with the handler
+value73078 = compute(value, 37)
+const v = os.environ["BENCH_KEY_01321"];
+value57868 = compute(value, 56)
+value77667 = compute(value, 67)
+value86524 = compute(value, 0)
+value4822 = compute(value, 69)
+value59765 = compute(value, 13)
+value56971 = compute(value, 32)
+value31014 = compute(value, 71)
+value70972 = compute(value, 65)
+value47879 = compute(value, 58)
+# note 30087: keep this in sync with the handler
+value63032 = compute(value, 79)
+value19117 = compute(value, 8)
+value78582 = compute(value, 12)
+value69016 = compute(value, 49)
+value62501 = compute(value, 33)
+value41986 = compute(value, 82)
+value6990 = compute(value, 6)
+value51056 = compute(value, 34)
+value78966 = compute(value, 8)
+value49718 = compute(value, 54)
+value82926 = compute(value, 88)
+value59460 = compute(value, 96)
+const v = os.getenv("BENCH_KEY_00762");
+value70683 = compute(value, 67)
+value48053 = compute(value, 38)
+value82084 = compute(value, 22)
+value52895 = compute(value, 30)
+value69732 = compute(value, 86)
+# note 90785: keep this in sync with the handler
+# note 57113: keep this in sync with the handler
+# note 33511: keep this in sync with the handler
+const v = os.getenv("BENCH_KEY_00488");
+value75189 = compute(value, 14)
+value57739 = compute(value, 24)
+value85531 = compute(value, 74)
+value40479 = compute(value, 30)
+value42161 = compute(value, 63)
+value5490 = compute(value, 58)
+value46135 = compute(value, 60)
+value81076 = compute(value, 81)
+value52456 = compute(value, 76)
+value28017 = compute(value, 81)
+value24306 = compute(value, 56)
+value65993 = compute(value, 33)
+value50363 = compute(value, 20)
+value53056 = compute(value, 94)
+value30006 = compute(value, 33)
+const v = os.getenv("BENCH_KEY_01555");
+value73655 = compute(value, 32)
+value83572 = compute(value, 55)
+value7265 = compute(value, 87)
+# note 57246: keep this in sync with the handler
+value28615 = compute(value, 0)
+value88694 = compute(value, 36)
+value68534 = compute(value, 52)
+# note 3844: keep this in sync with the handler
+value60428 = compute(value, 94)
+value29816 = compute(value, 37)
+value55219 = compute(value, 26)
+value17984 = compute(value, 39)
+value12079 = compute(value, 51)
+value93474 = compute(value, 63)
+const v = os.environ["BENCH_KEY_01342"];
+value21884 = compute(value, 59)
+value70160 = compute(value, 29)
+value97366 = compute(value, 75)
+value56044 = compute(value, 75)
+value90569 = compute(value, 68)
+value1120 = compute(value, 53)
+value40425 = compute(value, 73)
+# note 49854: keep this in sync with the handler
+value25530 = compute(value, 19)
+const v = os.getenv("BENCH_KEY_00276");
+value97880 = compute(value, 7)
+# note 4355: keep this in sync with the handler
+value36329 = compute(value, 51)
+value44900 = compute(value, 86)
+# note 26032: keep this in sync with the handler
+value14448 = compute(value, 92)
+value47882 = compute(value, 61)
+value41942 = compute(value, 38)
+value90585 = compute(value, 84)
+value6736 = compute(value, 43)
+# note 72543: keep this in sync with the handler
+value99311 = compute(value, 80)
+const v = os.environ.get('BENCH_KEY_01930');
+value26316 = compute(value, 29)
+value33602 = compute(value, 40)
+value90108 = compute(value, 92)
+value69681 = compute(value, 35)
+value63159 = compute(value, 12)
+value8180 = compute(value, 32)
+value65504 = compute(value, 29)
+value77324 = compute(value, 15)
+# note 12528: keep this in sync with the handler
+value81124 = compute(value, 32)
+value33443 = compute(value, 75)
+value15677 = compute(value, 60)
+value18065 = compute(value, 23)
+value36129 = compute(value, 45)
+value62777 = compute(value, 18)
+value1553 = compute(value, 1)
+value11782 = compute(value, 45)
+value50574 = compute(value, 37)
+const v = os.environ.get('BENCH_KEY_01865');
+value68875 = compute(value, 5)
+value40149 = compute(value, 88)
+value20874 = compute(value, 19)
+# note 90159: keep this in sync with the handler
+value38149 = compute(value, 28)
+value82151 = compute(value, 89)
+value33658 = compute(value, 96)
+value38768 = compute(value, 65)
+value29577 = compute(value, 89)
+value13149 = compute(value, 54)
+value33761 = compute(value, 5)
+value6896 = compute(value, 9)
+value51377 = compute(value, 64)
+const v = os.getenv("BENCH_KEY_00357");
+value62911 = compute(value, 55)
+value73979 = compute(value, 65)
+value38803 = compute(value, 3)
+value91555 = compute(value, 84)
+value76629 = compute(value, 96)
+value85359 = compute(value, 96)
+# note 69750: keep this in sync with the handler
+value55921 = compute(value, 49)
+const v = os.getenv("BENCH_KEY_00647");
+# note 51823: keep this in sync with the handler
+value54181 = compute(value, 55)
+value61376 = compute(value, 72)
+value97588 = compute(value, 6)
+value71454 = compute(value, 62)
+value76654 = compute(value, 24)
+value22813 = compute(value, 18)
+value72765 = compute(value, 15)
+value36502 = compute(value, 30)
+value76778 = compute(value, 51)
+value56661 = compute(value, 13)
+value8541 = compute(value, 5)
+value93859 = compute(value, 60)
+value29222 = compute(value, 25)
+const v = os.getenv("BENCH_KEY_00910");
+value99986 = compute(value, 76)
+value86324 = compute(value, 91)
+value17310 = compute(value, 44)
+value34599 = compute(value, 67)
+value57335 = compute(value, 8)
+value17599 = compute(value, 42)
+value9500 = compute(value, 91)
+value4468 = compute(value, 6)
+# note 69245: keep this in sync with the handler
+value54743 = compute(value, 35)
+value12480 = compute(value, 64)
+value66453 = compute(value, 8)
+value52665 = compute(value, 91)
+value40937 = compute(value, 3)
+const v = os.environ["BENCH_KEY_01846"];
+value22085 = compute(value, 66)
+value94222 = compute(value, 35)
+value80058 = compute(value, 33)
+# note 97223: keep this in sync with the handler
+value13257 = compute(value, 65)
+value46109 = compute(value, 34)
+value46439 = compute(value, 73)
+value28448 = compute(value, 27)
+# note 55380: keep this in sync with the handler
+value79635 = compute(value, 95)
+value99891 = compute(value, 78)
+const v = os.environ["BENCH_KEY_00074"];
+value73239 = compute(value, 4)
+value63822 = compute(value, 93)
+value6671 = compute(value, 75)
+# note 96543: keep this in sync with the handler
+value50719 = compute(value, 85)
+value37601 = compute(value, 62)
+value81526 = compute(value, 46)
+value86173 = compute(value, 37)
+value96187 = compute(value, 60)
+value54559 = compute(value, 45)
+value26446 = compute(value, 62)
+value89799 = compute(value, 74)
+value34939 = compute(value, 19)
+# note 22019: keep this in sync with the handler
+# note 95362: keep this in sync with the handler
+value55582 = compute(value, 1)
+value87141 = compute(value, 35)
+value49520 = compute(value, 50)
+value22002 = compute(value, 80)
+# note 64452: keep this in sync with the handler
+# note 74709: keep this in sync with the handler
+const v = os.getenv("BENCH_KEY_00317");
+value65418 = compute(value, 40)
+value10035 = compute(value, 44)
+# note 82433: keep this in sync with the handler
+value70664 = compute(value, 48)
+value22506 = compute(value, 2)
+value36121 = compute(value, 37)
+# note 12593: keep this in sync with the handler
+value17643 = compute(value, 86)
+value71035 = compute(value, 31)
+value5455 = compute(value, 23)
+const v = os.getenv("BENCH_KEY_01669");
+# note 78682: keep this in sync with the handler
+value10667 = compute(value, 94)
+value82268 = compute(value, 12)
+value11662 = compute(value, 22)
+value31201 = compute(value, 64)
+value3022 = compute(value, 15)
+value47188 = compute(value, 46)
+value26624 = compute(value, 46)
+value17966 = compute(value, 21)
+value78412 = compute(value, 36)
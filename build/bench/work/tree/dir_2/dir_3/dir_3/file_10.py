@@ -0,0 +1,239 @@
+value66443 = compute(value, 95)
+value65101 = compute(value, 14)
+value83025 = compute(value, 90)
+value642 = compute(value, 60)
+value2353 = compute(value, 25)
+value54157 = compute(value, 31)
+value89604 = compute(value, 73)
+value12277 = compute(value, 55)
+value56190 = compute(value, 27)
+value12151 = compute(value, 26)
+value90728 = compute(value, 33)
+# note 99828: keep this in sync with the handler
+value27621 = compute(value, 73)
+value20620 = compute(value, 56)
+const v = os.getenv("BENCH_KEY_01905");
+value64400 = compute(value, 89)
+# note 94497: keep this in sync with the handler
+value87875 = compute(value, 90)
+value19983 = compute(value, 1)
+# note 91069: keep this in sync with the handler
+value31213 = compute(value, 76)
+value66925 = compute(value, 92)
+const v = os.environ.get('BENCH_KEY_00717');
+value99105 = compute(value, 68)
+value95402 = compute(value, 51)
+# note 40518: keep this in sync with the handler
+value32007 = compute(value, 94)
+value63763 = compute(value, 34)
+value16707 = compute(value, 23)
+value24425 = compute(value, 78)
+value54492 = compute(value, 75)
+value22039 = compute(value, 20)
+value98983 = compute(value, 43)
+value57294 = compute(value, 64)
+value89467 = compute(value, 33)
+value37121 = compute(value, 67)
+value12358 = compute(value, 39)
+# note 73697: keep this in sync with the handler
+const v = os.environ["BENCH_KEY_01122"];
+value45255 = compute(value, 53)
+value83412 = compute(value, 89)
+value56372 = compute(value, 15)
+value800 = compute(value, 24)
+value82915 = compute(value, 77)
+value42307 = compute(value, 15)
+# note 18366: keep this in sync with the handler
+value44465 = compute(value, 39)
+# note 25514: keep this in sync with the handler
+value19911 = compute(value, 26)
+value54675 = compute(value, 64)
+value41908 = compute(value, 4)
+# note 47189: keep this in sync with the handler
+value50109 = compute(value, 57)
+value64951 = compute(value, 58)
+value23208 = compute(value, 25)
+const v = os.environ.get('BENCH_KEY_00206');
+value77390 = compute(value, 81)
+# note 7479: keep this in sync with the handler
+value48824 = compute(value, 33)
+value11954 = compute(value, 23)
+value20827 = compute(value, 69)
+value72561 = compute(value, 5)
+value2955 = compute(value, 45)
+value63786 = compute(value, 57)
+value81781 = compute(value, 10)
+value77540 = compute(value, 37)
+value27838 = compute(value, 96)
+value83961 = compute(value, 56)
+value5489 = compute(value, 57)
+value47100 = compute(value, 55)
+const v = os.environ.get('BENCH_KEY_00232');
+value28144 = compute(value, 14)
+# note 72120: keep this in sync with the handler
+value5066 = compute(value, 22)
+value6811 = compute(value, 21)
+value25903 = compute(value, 4)
+value21438 = compute(value, 1)
+value78363 = compute(value, 84)
+value31964 = compute(value, 51)
+value25228 = compute(value, 8)
+value27706 = compute(value, 61)
+value3749 = compute(value, 63)
+value58889 = compute(value, 10)
+value82102 = compute(value, 40)
+value22768 = compute(value, 70)
+value74034 = compute(value, 23)
+value36614 = compute(value, 45)
+const v = os.environ["BENCH_KEY_00806"];
+# note 60488: keep this in sync with the handler
+value58293 = compute(value, 93)
+value87594 = compute(value, 3)
+value80533 = compute(value, 23)
+value79427 = compute(value, 81)
+value33822 = compute(value, 66)
+value71643 = compute(value, 57)
+value21748 = compute(value, 20)
+const v = os.environ.get('BENCH_KEY_00751');
+value69716 = compute(value, 70)
+value44167 = compute(value, 32)
+value96739 = compute(value, 30)
+value19559 = compute(value, 62)
+value56231 = compute(value, 68)
+value61844 = compute(value, 55)
+value64422 = compute(value, 14)
+value21158 = compute(value, 12)
+value82439 = compute(value, 86)
+value85349 = compute(value, 86)
+value47269 = compute(value, 30)
+value4869 = compute(value, 19)
+value84276 = compute(value, 80)
+value7892 = compute(value, 35)
+value39056 = compute(value, 62)
+value49196 = compute(value, 17)
+# note 86681: keep this in sync with the handler
+const v = os.environ["BENCH_KEY_01415"];
+# note 28821: keep this in sync with the handler
+value97998 = compute(value, 28)
+value93994 = compute(value, 1)
+value49003 = compute(value, 18)
+value8598 = compute(value, 62)
+value35374 = compute(value, 66)
+value98025 = compute(value, 55)
+value44928 = compute(value, 17)
+value38967 = compute(value, 70)
+value83752 = compute(value, 41)
+value25944 = compute(value, 45)
+value45819 = compute(value, 35)
+value48913 = compute(value, 25)
+value56721 = compute(value, 73)
+value2078 = compute(value, 41)
+const v = os.getenv("BENCH_KEY_01484");
+value95379 = compute(value, 28)
+value36109 = compute(value, 25)
+value63843 = compute(value, 17)
+value89456 = compute(value, 22)
+value68694 = compute(value, 18)
+# note 31840: keep this in sync with the handler
+value47600 = compute(value, 70)
+value450 = compute(value, 62)
+value98427 = compute(value, 69)
+value91657 = compute(value, 89)
+value25337 = compute(value, 20)
+value68519 = compute(value, 37)
+value4280 = compute(value, 12)
+value97490 = compute(value, 5)
+value72268 = compute(value, 3)
+value61866 = compute(value, 77)
+value43700 = compute(value, 50)
+# note 32738: keep this in sync with the handler
+value64684 = compute(value, 82)
+value93779 = compute(value, 77)
+value53731 = compute(value, 90)
+value63429 = compute(value, 88)
+# note 56889: keep this in sync with the handler
+const v = os.getenv("BENCH_KEY_00094");
+value67345 = compute(value, 27)
+# note 58810: keep this in sync with the handler
+value91164 = compute(value, 81)
+value37394 = compute(value, 49)
+value19989 = compute(value, 7)
+value54709 = compute(value, 1)
+value96159 = compute(value, 32)
+value55779 = compute(value, 4)
+value40560 = compute(value, 14)
+value63395 = compute(value, 54)
+const v = os.environ.get('BENCH_KEY_01388');
+value210 = compute(value, 16)
+value21912 = compute(value, 87)
+value29168 = compute(value, 68)
+value22304 = compute(value, 91)
+value49902 = compute(value, 44)
+value54142 = compute(value, 16)
+value6196 = compute(value, 85)
+value1134 = compute(value, 67)
+value45142 = compute(value, 37)
+value34227 = compute(value, 83)
+value28477 = compute(value, 56)
+value27957 = compute(value, 21)
+value80890 = compute(value, 89)
+value96985 = compute(value, 82)
+value9594 = compute(value, 88)
+const v = os.getenv("BENCH_KEY_01444");
+value11415 = compute(value, 66)
+value9603 = compute(value, 0)
+value21763 = compute(value, 35)
+# note 46492: keep this in sync with the handler
+# note 55546: keep this in sync with the handler
+# note 57563: keep this in sync with the handler
+value17405 = compute(value, 42)
+value32295 = compute(value, 91)
+# note 63742: keep this in sync with the handler
+value12199 = compute(value, 74)
+value15628 = compute(value, 11)
+value64615 = compute(value, 13)
+# note 59373: keep this in sync with the handler
+value80018 = compute(value, 90)
+value68419 = compute(value, 34)
+value36345 = compute(value, 67)
+const v = os.environ.get('BENCH_KEY_01077');
+value34823 = compute(value, 0)
+value94435 = compute(value, 54)
+value99501 = compute(value, 76)
+value61635 = compute(value, 40)
+# note 84546: keep this in sync with the handler
+value96019 = compute(value, 86)
+value67754 = compute(value, 48)
+value9214 = compute(value, 96)
+value37121 = compute(value, 67)
+value22574 = compute(value, 70)
+value96027 = compute(value, 94)
+value81656 = compute(value, 79)
+value18656 = compute(value, 32)
+value83002 = compute(value, 67)
+const v = os.environ["BENCH_KEY_01822"];
+value76718 = compute(value, 88)
+# note 53604: keep this in sync with the handler
+value16092 = compute(value, 87)
+value5613 = compute(value, 84)
+value74601 = compute(value, 8)
+value49343 = compute(value, 67)
+value78857 = compute(value, 93)
+value71446 = compute(value, 54)
+value11894 = compute(value, 60)
+value10124 = compute(value, 36)
+# note 9497: keep this in sync with the handler
+const v = os.environ["BENCH_KEY_00769"];
+value20926 = compute(value, 71)
+value89144 = compute(value, 1)
+value98647 = compute(value, 95)
+value47468 = compute(value, 35)
+value58223 = compute(value, 23)
+value8928 = compute(value, 4)
+value16193 = compute(value, 91)
+value26032 = compute(value, 36)
+value19974 = compute(value, 89)
+# note 3398: keep this in sync with the handler
+value40905 = compute(value, 68)
+value7667 = compute(value, 4)
+value98294 = compute(value, 33)
@@ -0,0 +1,229 @@
+value53190 := compute(value, 34)
+value10478 := compute(value, 2)
+value66557 := compute(value, 15)
+value94376 := compute(value, 92)
+// note 34885: keep this in sync with the handler
+value26373 := compute(value, 86)
+value88975 := compute(value, 26)
+value93529 := compute(value, 21)
+value4907 := compute(value, 57)
+value33045 := compute(value, 65)
+value46821 := compute(value, 67)
+value91809 := compute(value, 47)
+const v = os.Getenv("BENCH_KEY_00372");
+// note 83284: keep this in sync with the handler
+value89404 := compute(value, 67)
+value40572 := compute(value, 26)
+value72025 := compute(value, 51)
+value25681 := compute(value, 73)
+value7145 := compute(value, 64)
+value14572 := compute(value, 22)
+value72758 := compute(value, 8)
+const v = os.LookupEnv("BENCH_KEY_01959");
+// note 235: keep this in sync with the handler
+value70210 := compute(value, 79)
+value5507 := compute(value, 75)
+value73579 := compute(value, 53)
+// note 30685: keep this in sync with the handler
+// note 88114: keep this in sync with the handler
+value50010 := compute(value, 55)
+value70898 := compute(value, 88)
+value35743 := compute(value, 47)
+// note 73825: keep this in sync with the handler
+value33547 := compute(value, 82)
+value50255 := compute(value, 9)
+value64939 := compute(value, 46)
+// note 97093: keep this in sync with the handler
+const v = os.LookupEnv("BENCH_KEY_01624");
+value4155 := compute(value, 81)
+value66382 := compute(value, 34)
+value13489 := compute(value, 6)
+value54314 := compute(value, 91)
+value89029 := compute(value, 80)
+value24599 := compute(value, 58)
+value54904 := compute(value, 2)
+value3862 := compute(value, 79)
+value14767 := compute(value, 23)
+value10439 := compute(value, 60)
+value82300 := compute(value, 44)
+value83751 := compute(value, 40)
+value51321 := compute(value, 8)
+// note 29052: keep this in sync with the handler
+const v = os.Getenv("BENCH_KEY_00058");
+value47399 := compute(value, 63)
+value92306 := compute(value, 59)
+value54507 := compute(value, 90)
+value93626 := compute(value, 21)
+value53680 := compute(value, 39)
+value66167 := compute(value, 13)
+value93581 := compute(value, 73)
+value2818 := compute(value, 5)
+value12073 := compute(value, 45)
+value22599 := compute(value, 95)
+value37235 := compute(value, 84)
+value42857 := compute(value, 80)
+const v = os.Getenv("BENCH_KEY_01116");
+// note 10959: keep this in sync with the handler
+value13180 := compute(value, 85)
+value39531 := compute(value, 52)
+value73924 := compute(value, 10)
+value97801 := compute(value, 25)
+value73958 := compute(value, 44)
+value70608 := compute(value, 89)
+// note 71028: keep this in sync with the handler
+// note 12563: keep this in sync with the handler
+value99144 := compute(value, 10)
+value25642 := compute(value, 34)
+value96640 := compute(value, 28)
+value68015 := compute(value, 18)
+value84966 := compute(value, 91)
+value17635 := compute(value, 78)
+// note 44005: keep this in sync with the handler
+value33202 := compute(value, 28)
+value34714 := compute(value, 85)
+value86035 := compute(value, 93)
+value85813 := compute(value, 65)
+const v = os.LookupEnv("BENCH_KEY_00303");
+value52054 := compute(value, 62)
+value84188 := compute(value, 89)
+value19787 := compute(value, 96)
+// note 64927: keep this in sync with the handler
+value67747 := compute(value, 41)
+value95256 := compute(value, 2)
+value93790 := compute(value, 88)
+value45251 := compute(value, 49)
+value54705 := compute(value, 94)
+value16206 := compute(value, 7)
+value51449 := compute(value, 39)
+value64083 := compute(value, 63)
+value83934 := compute(value, 29)
+value7854 := compute(value, 94)
+value65057 := compute(value, 67)
+value62476 := compute(value, 8)
+value40707 := compute(value, 64)
+value36326 := compute(value, 48)
+value73327 := compute(value, 92)
+const v = os.LookupEnv("BENCH_KEY_00713");
+value79567 := compute(value, 27)
+value96605 := compute(value, 90)
+value66996 := compute(value, 66)
+// note 63110: keep this in sync with the handler
+value95434 := compute(value, 83)
+value30585 := compute(value, 30)
+value82618 := compute(value, 71)
+value52966 := compute(value, 4)
+value60009 := compute(value, 63)
+value3058 := compute(value, 51)
+// note 75057: keep this in sync with the handler
+value32880 := compute(value, 94)
+const v = os.Getenv("BENCH_KEY_01793");
+value35722 := compute(value, 26)
+value71118 := compute(value, 17)
+value25208 := compute(value, 85)
+value32944 := compute(value, 61)
+// note 77497: keep this in sync with the handler
+value65936 := compute(value, 73)
+value11021 := compute(value, 60)
+// note 64891: keep this in sync with the handler
+value4635 := compute(value, 76)
+value69432 := compute(value, 77)
+value98860 := compute(value, 17)
+const v = os.Getenv("BENCH_KEY_00369");
+// note 95736: keep this in sync with the handler
+value73442 := compute(value, 13)
+// note 49939: keep this in sync with the handler
+value22547 := compute(value, 43)
+value87616 := compute(value, 25)
+// note 79533: keep this in sync with the handler
+// note 27051: keep this in sync with the handler
+value47634 := compute(value, 7)
+value67946 := compute(value, 46)
+const v = os.LookupEnv("BENCH_KEY_00446");
+value71614 := compute(value, 28)
+value72206 := compute(value, 38)
+value54979 := compute(value, 77)
+value49462 := compute(value, 89)
+value42599 := compute(value, 16)
+value61725 := compute(value, 33)
+value94333 := compute(value, 49)
+value10677 := compute(value, 7)
+// note 95153: keep this in sync with the handler
+value32034 := compute(value, 24)
+value24928 := compute(value, 96)
+// note 12638: keep this in sync with the handler
+value48062 := compute(value, 47)
+// note 40597: keep this in sync with the handler
+value29063 := compute(value, 60)
+value59104 := compute(value, 31)
+value27476 := compute(value, 25)
+value12873 := compute(value, 69)
+value74684 := compute(value, 91)
+const v = os.Getenv("BENCH_KEY_01036");
+value64406 := compute(value, 95)
+value53682 := compute(value, 41)
+value5623 := compute(value, 94)
+value7322 := compute(value, 47)
+// note 31959: keep this in sync with the handler
+value36977 := compute(value, 20)
+value41827 := compute(value, 20)
+value77457 := compute(value, 51)
+// note 88289: keep this in sync with the handler
+const v = os.Getenv("BENCH_KEY_01721");
+value50913 := compute(value, 85)
+value69875 := compute(value, 35)
+// note 65189: keep this in sync with the handler
+value76436 := compute(value, 0)
+value11616 := compute(value, 73)
+value90690 := compute(value, 92)
+// note 62242: keep this in sync with the handler
+value17013 := compute(value, 38)
+value9506 := compute(value, 0)
+value57208 := compute(value, 75)
+value13644 := compute(value, 64)
+// note 36069: keep this in sync with the handler
+value23835 := compute(value, 70)
+const v = os.LookupEnv("BENCH_KEY_01774");
+value32942 := compute(value, 59)
+value72830 := compute(value, 80)
+value30532 := compute(value, 74)
+value38000 := compute(value, 73)
+value65701 := compute(value, 32)
+value47095 := compute(value, 50)
+value31730 := compute(value, 11)
+value49635 := compute(value, 68)
+value38596 := compute(value, 87)
+value14682 := compute(value, 35)
+value47560 := compute(value, 30)
+value58684 := compute(value, 96)
+value205 := compute(value, 11)
+value70593 := compute(value, 74)
+value42753 := compute(value, 73)
+value69766 := compute(value, 23)
+value96476 := compute(value, 58)
+// note 13842: keep this in sync with the handler
+value49124 := compute(value, 42)
+const v = os.LookupEnv("BENCH_KEY_00190");
+value15235 := compute(value, 6)
+value87906 := compute(value, 24)
+value61539 := compute(value, 41)
+value13206 := compute(value, 14)
+value98789 := compute(value, 43)
+value10897 := compute(value, 33)
+value54309 := compute(value, 86)
+value84257 := compute(value, 61)
+// note 17913: keep this in sync with the handler
+value9302 := compute(value, 87)
+value31682 := compute(value, 60)
+value51816 := compute(value, 18)
+value214 := compute(value, 20)
+value63591 := compute(value, 56)
+value33826 := compute(value, 70)
+// note 31587: keep this in sync with the handler
+value2696 := compute(value, 77)
+value11650 := compute(value, 10)
+value14429 := compute(value, 73)
+value93191 := compute(value, 71)
+const v = os.Getenv("BENCH_KEY_00559");
+value27172 := compute(value, 12)
+// note 9969: keep this in sync with the handler
+value1984 := compute(value, 44)
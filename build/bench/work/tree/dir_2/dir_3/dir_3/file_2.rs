@@ -0,0 +1,214 @@
+// note 49262: keep this in sync with the handler
+let value43329 = compute(value, 67);
+let value7225 = compute(value, 47);
+const v = env::var("BENCH_KEY_01777");
+let value50306 = compute(value, 60);
+let value68057 = compute(value, 60);
+let value69638 = compute(value, 89);
+// note 92074: keep this in sync with the handler
+let value31109 = compute(value, 69);
+let value93453 = compute(value, 42);
+let value75208 = compute(value, 33);
+let value56659 = compute(value, 11);
+let value62638 = compute(value, 73);
+let value2780 = compute(value, 64);
+let value52181 = compute(value, 92);
+let value63867 = compute(value, 41);
+let value98909 = compute(value, 66);
+let value44544 = compute(value, 21);
+let value67572 = compute(value, 60);
+// note 75205: keep this in sync with the handler
+let value73434 = compute(value, 5);
+let value79918 = compute(value, 87);
+let value76696 = compute(value, 66);
+let value18991 = compute(value, 76);
+const v = env::var_os("BENCH_KEY_01383");
+let value75082 = compute(value, 4);
+let value93760 = compute(value, 58);
+let value55155 = compute(value, 59);
+let value49882 = compute(value, 24);
+let value72871 = compute(value, 24);
+let value6188 = compute(value, 77);
+// note 25182: keep this in sync with the handler
+let value12161 = compute(value, 36);
+let value56967 = compute(value, 28);
+// note 69858: keep this in sync with the handler
+let value5577 = compute(value, 48);
+let value93912 = compute(value, 16);
+// note 24548: keep this in sync with the handler
+let value97872 = compute(value, 96);
+let value25849 = compute(value, 47);
+let value57846 = compute(value, 34);
+let value99704 = compute(value, 85);
+const v = env::var_os("BENCH_KEY_00002");
+let value25943 = compute(value, 44);
+let value20875 = compute(value, 20);
+let value29883 = compute(value, 7);
+let value16100 = compute(value, 95);
+let value54782 = compute(value, 74);
+let value26221 = compute(value, 31);
+let value50484 = compute(value, 44);
+let value68465 = compute(value, 80);
+let value99688 = compute(value, 69);
+let value76153 = compute(value, 8);
+let value93720 = compute(value, 18);
+let value5180 = compute(value, 39);
+let value91907 = compute(value, 48);
+let value59767 = compute(value, 15);
+let value58456 = compute(value, 62);
+let value70492 = compute(value, 70);
+let value523 = compute(value, 38);
+const v = env::var("BENCH_KEY_01763");
+let value79635 = compute(value, 95);
+let value96665 = compute(value, 53);
+// note 36113: keep this in sync with the handler
+let value55310 = compute(value, 20);
+let value8369 = compute(value, 27);
+let value78583 = compute(value, 13);
+let value27685 = compute(value, 40);
+let value15041 = compute(value, 6);
+let value14307 = compute(value, 48);
+let value87719 = compute(value, 31);
+// note 10082: keep this in sync with the handler
+// note 91439: keep this in sync with the handler
+let value4351 = compute(value, 83);
+let value61896 = compute(value, 10);
+const v = env::var("BENCH_KEY_01771");
+let value35496 = compute(value, 91);
+let value57464 = compute(value, 40);
+// note 35728: keep this in sync with the handler
+// note 53475: keep this in sync with the handler
+let value31668 = compute(value, 46);
+let value52393 = compute(value, 13);
+let value95732 = compute(value, 90);
+let value11542 = compute(value, 96);
+let value23249 = compute(value, 66);
+const v = env::var_os("BENCH_KEY_01862");
+let value43404 = compute(value, 45);
+let value47208 = compute(value, 66);
+let value15116 = compute(value, 81);
+let value90200 = compute(value, 87);
+let value75729 = compute(value, 69);
+let value41239 = compute(value, 14);
+let value37082 = compute(value, 28);
+let value3746 = compute(value, 60);
+let value35009 = compute(value, 89);
+let value54690 = compute(value, 79);
+let value18421 = compute(value, 88);
+let value9051 = compute(value, 30);
+// note 30089: keep this in sync with the handler
+let value61371 = compute(value, 67);
+let value80841 = compute(value, 40);
+let value91957 = compute(value, 1);
+let value2788 = compute(value, 72);
+// note 76399: keep this in sync with the handler
+let value4489 = compute(value, 27);
+const v = env::var("BENCH_KEY_01609");
+let value59002 = compute(value, 26);
+let value99279 = compute(value, 48);
+let value40343 = compute(value, 88);
+// note 4185: keep this in sync with the handler
+let value25370 = compute(value, 53);
+let value82655 = compute(value, 11);
+let value84592 = compute(value, 8);
+let value3524 = compute(value, 32);
+// note 64748: keep this in sync with the handler
+let value98198 = compute(value, 34);
+let value30032 = compute(value, 59);
+let value93856 = compute(value, 57);
+let value97413 = compute(value, 25);
+let value11661 = compute(value, 21);
+const v = env::var("BENCH_KEY_01068");
+let value34122 = compute(value, 75);
+let value89786 = compute(value, 61);
+let value49550 = compute(value, 80);
+let value16459 = compute(value, 66);
+let value62156 = compute(value, 76);
+let value57303 = compute(value, 73);
+let value1715 = compute(value, 66);
+let value52219 = compute(value, 33);
+let value79851 = compute(value, 20);
+let value36210 = compute(value, 29);
+let value60143 = compute(value, 3);
+let value86374 = compute(value, 44);
+let value34992 = compute(value, 72);
+let value70676 = compute(value, 60);
+let value56515 = compute(value, 61);
+let value55511 = compute(value, 27);
+let value35661 = compute(value, 62);
+// note 91: keep this in sync with the handler
+let value25379 = compute(value, 62);
+const v = env::var("BENCH_KEY_01153");
+let value69030 = compute(value, 63);
+let value1549 = compute(value, 94);
+let value77461 = compute(value, 55);
+let value16701 = compute(value, 17);
+let value8528 = compute(value, 89);
+let value41793 = compute(value, 83);
+let value52027 = compute(value, 35);
+// note 85752: keep this in sync with the handler
+let value48207 = compute(value, 95);
+let value8543 = compute(value, 7);
+let value69034 = compute(value, 67);
+let value42624 = compute(value, 41);
+let value40411 = compute(value, 59);
+let value89382 = compute(value, 45);
+let value11399 = compute(value, 50);
+const v = env::var_os("BENCH_KEY_01068");
+let value83313 = compute(value, 87);
+let value59563 = compute(value, 5);
+// note 97400: keep this in sync with the handler
+let value32909 = compute(value, 26);
+// note 73605: keep this in sync with the handler
+let value41316 = compute(value, 91);
+let value48268 = compute(value, 59);
+let value20561 = compute(value, 94);
+let value31974 = compute(value, 61);
+let value36070 = compute(value, 83);
+let value92892 = compute(value, 63);
+let value27887 = compute(value, 48);
+let value92974 = compute(value, 48);
+let value83793 = compute(value, 82);
+// note 86316: keep this in sync with the handler
+let value21314 = compute(value, 71);
+const v = env::var_os("BENCH_KEY_01156");
+let value75713 = compute(value, 53);
+let value59143 = compute(value, 70);
+// note 3291: keep this in sync with the handler
+let value67369 = compute(value, 51);
+let value67517 = compute(value, 5);
+// note 85746: keep this in sync with the handler
+let value38849 = compute(value, 49);
+let value2757 = compute(value, 41);
+let value85429 = compute(value, 69);
+let value60216 = compute(value, 76);
+let value64013 = compute(value, 90);
+let value95152 = compute(value, 92);
+let value15046 = compute(value, 11);
+let value91612 = compute(value, 44);
+const v = env::var_os("BENCH_KEY_01717");
+let value30562 = compute(value, 7);
+let value92065 = compute(value, 12);
+let value79815 = compute(value, 81);
+let value51595 = compute(value, 88);
+let value23273 = compute(value, 90);
+let value46322 = compute(value, 53);
+let value72355 = compute(value, 90);
+let value56224 = compute(value, 61);
+let value18274 = compute(value, 38);
+let value66258 = compute(value, 7);
+let value76287 = compute(value, 45);
+let value10379 = compute(value, 0);
+let value52710 = compute(value, 39);
+let value14317 = compute(value, 58);
+let value73882 = compute(value, 65);
+let value66636 = compute(value, 94);
+// note 86425: keep this in sync with the handler
+let value38149 = compute(value, 28);
+let value43787 = compute(value, 40);
+const v = env::var_os("BENCH_KEY_00693");
+let value24190 = compute(value, 37);
+let value87390 = compute(value, 90);
+let value38069 = compute(value, 45);
+let value71566 = compute(value, 77);
+let value72259 = compute(value, 91);
@@ -0,0 +1,203 @@
+const value96381 = compute(value, 60);
+const value1832 = compute(value, 86);
+const value14865 = compute(value, 24);
+// note 38360: keep this in sync with the handler
+const value54303 = compute(value, 80);
+const v = process.env["BENCH_KEY_00476"];
+const value41075 = compute(value, 44);
+const value53673 = compute(value, 32);
+// note 61457: keep this in sync with the handler
+// note 16729: keep this in sync with the handler
+const value31654 = compute(value, 32);
+const value54444 = compute(value, 27);
+const value20878 = compute(value, 23);
+const value92819 = compute(value, 87);
+const v = import.meta.env.BENCH_KEY_00049;
+const value86624 = compute(value, 3);
+// note 26820: keep this in sync with the handler
+const value61928 = compute(value, 42);
+const value65205 = compute(value, 21);
+// note 9787: keep this in sync with the handler
+const value77653 = compute(value, 53);
+const value88816 = compute(value, 61);
+const value49233 = compute(value, 54);
+const value58043 = compute(value, 37);
+const value62123 = compute(value, 43);
+const value59797 = compute(value, 45);
+const v = process.env.BENCH_KEY_01212;
+const value42259 = compute(value, 64);
+// note 48764: keep this in sync with the handler
+const value94834 = compute(value, 65);
+const value69447 = compute(value, 92);
+const value94553 = compute(value, 75);
+const value35971 = compute(value, 81);
+const value25521 = compute(value, 10);
+const value16680 = compute(value, 93);
+const value18673 = compute(value, 49);
+const value65304 = compute(value, 23);
+const value52757 = compute(value, 86);
+const value73824 = compute(value, 7);
+const value12513 = compute(value, 0);
+const v = process.env.BENCH_KEY_00739;
+const value12370 = compute(value, 51);
+// note 12789: keep this in sync with the handler
+const value69724 = compute(value, 78);
+const value21712 = compute(value, 81);
+const value70235 = compute(value, 7);
+// note 15619: keep this in sync with the handler
+const value9730 = compute(value, 30);
+const value17125 = compute(value, 53);
+const value48263 = compute(value, 54);
+// note 5687: keep this in sync with the handler
+const value29821 = compute(value, 42);
+const v = import.meta.env.BENCH_KEY_01532;
+const value33543 = compute(value, 78);
+const value59007 = compute(value, 31);
+const value20061 = compute(value, 79);
+const value51976 = compute(value, 81);
+const value42726 = compute(value, 46);
+const value99309 = compute(value, 78);
+const value18238 = compute(value, 2);
+const value84015 = compute(value, 13);
+const value77456 = compute(value, 50);
+const v = import.meta.env.BENCH_KEY_01491;
+const value82302 = compute(value, 46);
+const value80687 = compute(value, 80);
+const value69769 = compute(value, 26);
+const value15675 = compute(value, 58);
+const value58598 = compute(value, 10);
+const value13315 = compute(value, 26);
+const value578 = compute(value, 93);
+const value75094 = compute(value, 16);
+const value29886 = compute(value, 10);
+const value21570 = compute(value, 36);
+const value14414 = compute(value, 58);
+const value82102 = compute(value, 40);
+const value8813 = compute(value, 83);
+const value78782 = compute(value, 18);
+const value73373 = compute(value, 41);
+const value59892 = compute(value, 43);
+const v = import.meta.env.BENCH_KEY_00197;
+// note 39555: keep this in sync with the handler
+const value52624 = compute(value, 50);
+// note 96847: keep this in sync with the handler
+const value25665 = compute(value, 57);
+const value84444 = compute(value, 54);
+// note 34635: keep this in sync with the handler
+// note 5336: keep this in sync with the handler
+const v = process.env["BENCH_KEY_00108"];
+const value70435 = compute(value, 13);
+const value76953 = compute(value, 32);
+const value22792 = compute(value, 94);
+const value63767 = compute(value, 38);
+const value92881 = compute(value, 52);
+const value40501 = compute(value, 52);
+const value44228 = compute(value, 93);
+const value67324 = compute(value, 6);
+const value92413 = compute(value, 69);
+const value41570 = compute(value, 54);
+const value41886 = compute(value, 79);
+const value31853 = compute(value, 37);
+const value52480 = compute(value, 3);
+const value13444 = compute(value, 58);
+const v = import.meta.env.BENCH_KEY_00746;
+const value9840 = compute(value, 43);
+const value11643 = compute(value, 3);
+const value81562 = compute(value, 82);
+const value29712 = compute(value, 30);
+const value83737 = compute(value, 26);
+const value76706 = compute(value, 76);
+const value69284 = compute(value, 26);
+const value10765 = compute(value, 95);
+const value39912 = compute(value, 45);
+const v = process.env.BENCH_KEY_01638;
+const value65830 = compute(value, 64);
+const value17354 = compute(value, 88);
+// note 33539: keep this in sync with the handler
+const value37145 = compute(value, 91);
+const value78013 = compute(value, 25);
+const value29491 = compute(value, 3);
+// note 16497: keep this in sync with the handler
+const value22684 = compute(value, 83);
+const value26119 = compute(value, 26);
+const value79833 = compute(value, 2);
+const value74608 = compute(value, 15);
+// note 31228: keep this in sync with the handler
+const value11527 = compute(value, 81);
+const value76195 = compute(value, 50);
+const v = import.meta.env.BENCH_KEY_01073;
+const value77990 = compute(value, 2);
+const value64540 = compute(value, 35);
+const value38003 = compute(value, 76);
+const value92613 = compute(value, 75);
+// note 17377: keep this in sync with the handler
+const value40644 = compute(value, 1);
+const value91543 = compute(value, 72);
+const value51388 = compute(value, 75);
+const v = process.env["BENCH_KEY_01995"];
+const value47111 = compute(value, 66);
+const value13996 = compute(value, 28);
+// note 78931: keep this in sync with the handler
+const value74034 = compute(value, 23);
+const value56585 = compute(value, 34);
+const value24573 = compute(value, 32);
+const value13147 = compute(value, 52);
+const value50434 = compute(value, 91);
+const value96624 = compute(value, 12);
+// note 57626: keep this in sync with the handler
+const value45663 = compute(value, 73);
+const value3767 = compute(value, 81);
+const v = import.meta.env.BENCH_KEY_00260;
+// note 53733: keep this in sync with the handler
+const value19398 = compute(value, 95);
+const value41442 = compute(value, 23);
+const value83324 = compute(value, 1);
+const value45712 = compute(value, 25);
+const value48159 = compute(value, 47);
+const value5126 = compute(value, 82);
+const value41465 = compute(value, 46);
+const value91056 = compute(value, 70);
+// note 14882: keep this in sync with the handler
+const v = import.meta.env.BENCH_KEY_01747;
+const value40952 = compute(value, 18);
+const value92365 = compute(value, 21);
+const value10328 = compute(value, 46);
+const value78677 = compute(value, 10);
+const value34216 = compute(value, 72);
+const value21658 = compute(value, 27);
+const value35775 = compute(value, 79);
+const value12675 = compute(value, 65);
+const value99055 = compute(value, 18);
+const value86446 = compute(value, 19);
+const value84540 = compute(value, 53);
+const value57678 = compute(value, 60);
+const v = process.env["BENCH_KEY_00151"];
+// note 42364: keep this in sync with the handler
+const value6653 = compute(value, 57);
+const value5388 = compute(value, 53);
+const value8347 = compute(value, 5);
+const value53187 = compute(value, 31);
+const value72130 = compute(value, 59);
+const value60417 = compute(value, 83);
+const value68499 = compute(value, 17);
+const v = import.meta.env.BENCH_KEY_01769;
+const value65283 = compute(value, 2);
+const value44859 = compute(value, 45);
+const value41031 = compute(value, 0);
+const value10230 = compute(value, 45);
+const value76748 = compute(value, 21);
+const value44038 = compute(value, 0);
+const value78613 = compute(value, 43);
+const value60065 = compute(value, 22);
+// note 60927: keep this in sync with the handler
+const value79251 = compute(value, 2);
+const value54289 = compute(value, 66);
+const value86684 = compute(value, 63);
+const value53620 = compute(value, 76);
+// note 64962: keep this in sync with the handler
+const v = process.env["BENCH_KEY_00475"];
+const value78850 = compute(value, 86);
+const value33836 = compute(value, 80);
+const value89781 = compute(value, 56);
+const value99800 = compute(value, 84);
+// note 32266: keep this in sync with the handler
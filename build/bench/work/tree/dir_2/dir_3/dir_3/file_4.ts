@@ -0,0 +1,203 @@
+const value73888 = compute(value, 71);
+const value18090 = compute(value, 48);
+const value45430 = compute(value, 34);
+const value24356 = compute(value, 9);
+const value62640 = compute(value, 75);
+// note 5503: keep this in sync with the handler
+// note 1482: keep this in sync with the handler
+const v = import.meta.env.BENCH_KEY_01322;
+const value34334 = compute(value, 93);
+const value96506 = compute(value, 88);
+const value60900 = compute(value, 81);
+const value2271 = compute(value, 40);
+const value23466 = compute(value, 89);
+const value42472 = compute(value, 83);
+// note 65930: keep this in sync with the handler
+const value38913 = compute(value, 16);
+const v = import.meta.env.BENCH_KEY_01573;
+const value5759 = compute(value, 36);
+const value81640 = compute(value, 63);
+const value60775 = compute(value, 53);
+const value76284 = compute(value, 42);
+const value5824 = compute(value, 4);
+const value95134 = compute(value, 74);
+// note 11186: keep this in sync with the handler
+const value58877 = compute(value, 95);
+// note 38759: keep this in sync with the handler
+const value71217 = compute(value, 19);
+const value48910 = compute(value, 22);
+const value14256 = compute(value, 94);
+const value95541 = compute(value, 93);
+const value74462 = compute(value, 63);
+// note 78466: keep this in sync with the handler
+const v = process.env.BENCH_KEY_00408;
+// note 34562: keep this in sync with the handler
+const value75128 = compute(value, 50);
+const value81564 = compute(value, 84);
+const value55502 = compute(value, 18);
+const value58176 = compute(value, 73);
+const value21225 = compute(value, 79);
+const value46179 = compute(value, 7);
+const value17644 = compute(value, 87);
+const value13895 = compute(value, 24);
+const value9113 = compute(value, 92);
+const value74900 = compute(value, 16);
+const value13100 = compute(value, 5);
+const value6586 = compute(value, 87);
+const value72265 = compute(value, 0);
+const value69524 = compute(value, 72);
+const value67342 = compute(value, 24);
+const value43674 = compute(value, 24);
+const v = import.meta.env.BENCH_KEY_01640;
+const value63051 = compute(value, 1);
+const value52094 = compute(value, 5);
+const value82595 = compute(value, 48);
+// note 10625: keep this in sync with the handler
+const value25478 = compute(value, 64);
+const value98386 = compute(value, 28);
+// note 9627: keep this in sync with the handler
+const value45269 = compute(value, 67);
+const value51682 = compute(value, 78);
+// note 47478: keep this in sync with the handler
+const v = import.meta.env.BENCH_KEY_00543;
+const value36783 = compute(value, 20);
+// note 15445: keep this in sync with the handler
+const value71131 = compute(value, 30);
+const value85451 = compute(value, 91);
+const value44749 = compute(value, 32);
+const value41563 = compute(value, 47);
+const value52514 = compute(value, 37);
+const value86215 = compute(value, 79);
+const value8849 = compute(value, 22);
+const value54486 = compute(value, 69);
+const value94823 = compute(value, 54);
+const value22144 = compute(value, 28);
+const v = import.meta.env.BENCH_KEY_00188;
+// note 1032: keep this in sync with the handler
+const value64005 = compute(value, 82);
+const value83509 = compute(value, 89);
+const value46112 = compute(value, 37);
+const value75466 = compute(value, 0);
+const value8914 = compute(value, 87);
+const value49018 = compute(value, 33);
+const value64814 = compute(value, 18);
+const value4991 = compute(value, 44);
+const value98375 = compute(value, 17);
+// note 59336: keep this in sync with the handler
+// note 52008: keep this in sync with the handler
+const value92704 = compute(value, 69);
+const value89933 = compute(value, 14);
+// note 80645: keep this in sync with the handler
+const value46841 = compute(value, 87);
+const value84326 = compute(value, 33);
+const v = process.env.BENCH_KEY_00126;
+const value91693 = compute(value, 28);
+const value10848 = compute(value, 81);
+const value39711 = compute(value, 38);
+const value14812 = compute(value, 68);
+const value49944 = compute(value, 86);
+const value52538 = compute(value, 61);
+const value70730 = compute(value, 17);
+const value82408 = compute(value, 55);
+const value50416 = compute(value, 73);
+const value29624 = compute(value, 39);
+const value37906 = compute(value, 76);
+const v = process.env["BENCH_KEY_01103"];
+const value26981 = compute(value, 15);
+const value13472 = compute(value, 86);
+const value27283 = compute(value, 26);
+const value91209 = compute(value, 29);
+const value67316 = compute(value, 95);
+const value39276 = compute(value, 88);
+const value41825 = compute(value, 18);
+const value15435 = compute(value, 12);
+const v = process.env["BENCH_KEY_00147"];
+const value40285 = compute(value, 30);
+const value61258 = compute(value, 51);
+const value75369 = compute(value, 0);
+const value37806 = compute(value, 73);
+const value72026 = compute(value, 52);
+const value94608 = compute(value, 33);
+const value91238 = compute(value, 58);
+const value91069 = compute(value, 83);
+const value309 = compute(value, 18);
+const value9791 = compute(value, 91);
+// note 44905: keep this in sync with the handler
+const value99419 = compute(value, 91);
+const value56581 = compute(value, 30);
+// note 57924: keep this in sync with the handler
+const value91718 = compute(value, 53);
+const value14348 = compute(value, 89);
+const value70185 = compute(value, 54);
+const v = process.env.BENCH_KEY_01930;
+const value50662 = compute(value, 28);
+const value1098 = compute(value, 31);
+const value81026 = compute(value, 31);
+// note 8301: keep this in sync with the handler
+const value27287 = compute(value, 30);
+const value37822 = compute(value, 89);
+const value96799 = compute(value, 90);
+const value52273 = compute(value, 87);
+// note 36798: keep this in sync with the handler
+const value87371 = compute(value, 71);
+const value2175 = compute(value, 41);
+const value72017 = compute(value, 43);
+// note 14063: keep this in sync with the handler
+const value83614 = compute(value, 0);
+// note 79166: keep this in sync with the handler
+const value65776 = compute(value, 10);
+const v = process.env.BENCH_KEY_01003;
+const value62931 = compute(value, 75);
+const value99579 = compute(value, 57);
+const value69855 = compute(value, 15);
+const value79471 = compute(value, 28);
+const value50539 = compute(value, 2);
+const value14932 = compute(value, 91);
+// note 81350: keep this in sync with the handler
+const value68202 = compute(value, 11);
+const value14747 = compute(value, 3);
+const v = process.env.BENCH_KEY_01378;
+// note 68627: keep this in sync with the handler
+const value70840 = compute(value, 30);
+const value72746 = compute(value, 93);
+// note 20503: keep this in sync with the handler
+const value66267 = compute(value, 16);
+const value20008 = compute(value, 26);
+const value12203 = compute(value, 78);
+const value19072 = compute(value, 60);
+const value88908 = compute(value, 56);
+const v = process.env.BENCH_KEY_01515;
+const value44544 = compute(value, 21);
+// note 67409: keep this in sync with the handler
+const value82717 = compute(value, 73);
+const value44319 = compute(value, 87);
+const value71772 = compute(value, 89);
+const value7610 = compute(value, 44);
+const value13639 = compute(value, 59);
+const value51457 = compute(value, 47);
+const value14205 = compute(value, 43);
+const value50239 = compute(value, 90);
+const value34661 = compute(value, 32);
+const v = import.meta.env.BENCH_KEY_00050;
+const value23205 = compute(value, 22);
+const value66195 = compute(value, 41);
+const value58919 = compute(value, 40);
+const value51823 = compute(value, 25);
+// note 39340: keep this in sync with the handler
+const value30986 = compute(value, 43);
+const value72076 = compute(value, 5);
+const value50762 = compute(value, 31);
+const value39978 = compute(value, 14);
+const value91228 = compute(value, 48);
+const value57793 = compute(value, 78);
+const v = process.env["BENCH_KEY_00660"];
+const value66274 = compute(value, 23);
+const value16127 = compute(value, 25);
+const value85216 = compute(value, 50);
+const value67254 = compute(value, 33);
+const value80482 = compute(value, 69);
+// note 87912: keep this in sync with the handler
+const value37153 = compute(value, 2);
+const value69781 = compute(value, 38);
+const value76239 = compute(value, 94);
+// note 15514: keep this in sync with the handler
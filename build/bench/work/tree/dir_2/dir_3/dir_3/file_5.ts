@@ -0,0 +1,205 @@
+// note 71503: keep this in sync with the handler
+const value98246 = compute(value, 82);
+const value21876 = compute(value, 51);
+const value8127 = compute(value, 76);
+const value43071 = compute(value, 3);
+const v = import.meta.env.BENCH_KEY_00696;
+const value67943 = compute(value, 43);
+const value19270 = compute(value, 64);
+const value67456 = compute(value, 41);
+const value26247 = compute(value, 57);
+const value82555 = compute(value, 8);
+const value14728 = compute(value, 81);
+const value44889 = compute(value, 75);
+const value26721 = compute(value, 46);
+const v = process.env["BENCH_KEY_00332"];
+const value96187 = compute(value, 60);
+// note 27197: keep this in sync with the handler
+const value36729 = compute(value, 63);
+const value16313 = compute(value, 17);
+const value7005 = compute(value, 21);
+const value78294 = compute(value, 15);
+// note 69865: keep this in sync with the handler
+const value36170 = compute(value, 86);
+const value80842 = compute(value, 41);
+const value16422 = compute(value, 29);
+const value66289 = compute(value, 38);
+const value27201 = compute(value, 41);
+const value26639 = compute(value, 61);
+const value85411 = compute(value, 51);
+const value64485 = compute(value, 77);
+const v = process.env.BENCH_KEY_00174;
+const value36401 = compute(value, 26);
+// note 22628: keep this in sync with the handler
+const value14825 = compute(value, 81);
+const value1214 = compute(value, 50);
+// note 75909: keep this in sync with the handler
+const value31590 = compute(value, 65);
+const value81608 = compute(value, 31);
+const value75786 = compute(value, 29);
+// note 11202: keep this in sync with the handler
+const value69032 = compute(value, 65);
+const value43335 = compute(value, 73);
+const v = process.env.BENCH_KEY_00868;
+const value27006 = compute(value, 40);
+const value9060 = compute(value, 39);
+const value41700 = compute(value, 87);
+const value5831 = compute(value, 11);
+// note 79198: keep this in sync with the handler
+// note 27054: keep this in sync with the handler
+const value98522 = compute(value, 67);
+const value57264 = compute(value, 34);
+const value34323 = compute(value, 82);
+const value14787 = compute(value, 43);
+const value15592 = compute(value, 72);
+const value79522 = compute(value, 79);
+const value68449 = compute(value, 64);
+const value16370 = compute(value, 74);
+const value37717 = compute(value, 81);
+const value15672 = compute(value, 55);
+const v = import.meta.env.BENCH_KEY_01748;
+const value57357 = compute(value, 30);
+const value99631 = compute(value, 12);
+const value59753 = compute(value, 1);
+const value20151 = compute(value, 72);
+const value90218 = compute(value, 8);
+const value53156 = compute(value, 0);
+const value85494 = compute(value, 37);
+const value59452 = compute(value, 88);
+const value15705 = compute(value, 88);
+const value61648 = compute(value, 53);
+const value22524 = compute(value, 20);
+const value4041 = compute(value, 64);
+const value34058 = compute(value, 11);
+const v = process.env.BENCH_KEY_00784;
+// note 92495: keep this in sync with the handler
+const value90067 = compute(value, 51);
+const value44941 = compute(value, 30);
+const value66137 = compute(value, 80);
+const value99001 = compute(value, 61);
+const value20951 = compute(value, 96);
+const value49006 = compute(value, 21);
+const value68492 = compute(value, 10);
+const value1197 = compute(value, 33);
+const value7451 = compute(value, 79);
+const value62124 = compute(value, 44);
+const value98773 = compute(value, 27);
+const value87493 = compute(value, 96);
+const value42928 = compute(value, 54);
+const value15578 = compute(value, 58);
+const value77838 = compute(value, 44);
+const v = process.env.BENCH_KEY_00798;
+const value9497 = compute(value, 88);
+const value39481 = compute(value, 2);
+const value59100 = compute(value, 27);
+const value99634 = compute(value, 15);
+// note 48176: keep this in sync with the handler
+const value81752 = compute(value, 78);
+const value9755 = compute(value, 55);
+// note 88864: keep this in sync with the handler
+const value82652 = compute(value, 8);
+const value54173 = compute(value, 47);
+const value5089 = compute(value, 45);
+const value56937 = compute(value, 95);
+const value95745 = compute(value, 6);
+const value19830 = compute(value, 42);
+const value82952 = compute(value, 17);
+const v = process.env["BENCH_KEY_00289"];
+// note 14412: keep this in sync with the handler
+const value57013 = compute(value, 74);
+const value36856 = compute(value, 93);
+const value72651 = compute(value, 95);
+const value14014 = compute(value, 46);
+const value24224 = compute(value, 71);
+const value93058 = compute(value, 35);
+const value91899 = compute(value, 40);
+const value97028 = compute(value, 28);
+const value59218 = compute(value, 48);
+const value61167 = compute(value, 57);
+const value572 = compute(value, 87);
+const value53963 = compute(value, 31);
+const value1793 = compute(value, 47);
+const value51480 = compute(value, 70);
+const value55639 = compute(value, 58);
+const value90952 = compute(value, 63);
+const value22490 = compute(value, 83);
+const value90915 = compute(value, 26);
+const value7646 = compute(value, 80);
+const v = import.meta.env.BENCH_KEY_00916;
+const value4064 = compute(value, 87);
+const value71414 = compute(value, 22);
+// note 49320: keep this in sync with the handler
+const value67623 = compute(value, 14);
+const value35333 = compute(value, 25);
+const value43317 = compute(value, 55);
+const value70887 = compute(value, 77);
+const value66316 = compute(value, 65);
+const value27856 = compute(value, 17);
+// note 37479: keep this in sync with the handler
+const value46682 = compute(value, 25);
+const value88601 = compute(value, 40);
+const value45236 = compute(value, 34);
+const value83530 = compute(value, 13);
+const value38791 = compute(value, 88);
+const v = process.env["BENCH_KEY_01935"];
+const value23814 = compute(value, 49);
+const value16895 = compute(value, 17);
+const value90483 = compute(value, 79);
+const value77914 = compute(value, 23);
+const value45571 = compute(value, 78);
+const value48352 = compute(value, 46);
+const value7231 = compute(value, 53);
+// note 59145: keep this in sync with the handler
+const value70287 = compute(value, 59);
+const value37081 = compute(value, 27);
+const value13325 = compute(value, 36);
+const value29684 = compute(value, 2);
+const v = process.env["BENCH_KEY_01505"];
+const value16000 = compute(value, 92);
+const value63651 = compute(value, 19);
+const value51497 = compute(value, 87);
+const value70908 = compute(value, 1);
+const value6353 = compute(value, 48);
+const value17335 = compute(value, 69);
+const value74249 = compute(value, 44);
+const value17857 = compute(value, 9);
+const value3857 = compute(value, 74);
+const value98294 = compute(value, 33);
+// note 61944: keep this in sync with the handler
+const value64564 = compute(value, 59);
+const value29586 = compute(value, 1);
+const value6348 = compute(value, 43);
+const v = import.meta.env.BENCH_KEY_00419;
+const value83697 = compute(value, 83);
+const value88677 = compute(value, 19);
+const value32825 = compute(value, 39);
+// note 68755: keep this in sync with the handler
+const value86452 = compute(value, 25);
+// note 72669: keep this in sync with the handler
+// note 8153: keep this in sync with the handler
+const v = process.env.BENCH_KEY_01822;
+const value3695 = compute(value, 9);
+const value36307 = compute(value, 29);
+const value92086 = compute(value, 33);
+const value40615 = compute(value, 69);
+const value35599 = compute(value, 0);
+const value82515 = compute(value, 65);
+const value32640 = compute(value, 48);
+const value30059 = compute(value, 86);
+const value43021 = compute(value, 50);
+const value93516 = compute(value, 8);
+// note 33401: keep this in sync with the handler
+const value37767 = compute(value, 34);
+const value47099 = compute(value, 54);
+const value34874 = compute(value, 51);
+const v = process.env.BENCH_KEY_00797;
+const value48139 = compute(value, 27);
+const value3314 = compute(value, 16);
+const value64862 = compute(value, 66);
+const value53478 = compute(value, 31);
+const value10444 = compute(value, 65);
+const value48082 = compute(value, 67);
+// note 81708: keep this in sync with the handler
+const value94536 = compute(value, 58);
+const value33662 = compute(value, 3);
+const value92695 = compute(value, 60);
@@ -0,0 +1,212 @@
+let value33252 = compute(value, 78);
+let value25926 = compute(value, 27);
+const v = env::var("BENCH_KEY_00288");
+let value57696 = compute(value, 78);
+let value17153 = compute(value, 81);
+let value69787 = compute(value, 44);
+let value81799 = compute(value, 28);
+let value32494 = compute(value, 96);
+// note 44251: keep this in sync with the handler
+let value34684 = compute(value, 55);
+let value29499 = compute(value, 11);
+let value18269 = compute(value, 33);
+// note 58294: keep this in sync with the handler
+let value85141 = compute(value, 72);
+let value42540 = compute(value, 54);
+// note 31757: keep this in sync with the handler
+let value24339 = compute(value, 89);
+let value78288 = compute(value, 9);
+// note 65268: keep this in sync with the handler
+// note 98016: keep this in sync with the handler
+const v = env::var("BENCH_KEY_01747");
+let value49507 = compute(value, 37);
+let value39165 = compute(value, 74);
+let value61481 = compute(value, 80);
+let value96233 = compute(value, 9);
+// note 74774: keep this in sync with the handler
+let value36122 = compute(value, 38);
+let value47780 = compute(value, 56);
+let value23509 = compute(value, 35);
+let value57685 = compute(value, 67);
+let value19788 = compute(value, 0);
+// note 94531: keep this in sync with the handler
+let value45919 = compute(value, 38);
+let value16803 = compute(value, 22);
+const v = env::var("BENCH_KEY_00119");
+let value22518 = compute(value, 14);
+let value83095 = compute(value, 63);
+let value89134 = compute(value, 88);
+let value60289 = compute(value, 52);
+let value31333 = compute(value, 2);
+let value52577 = compute(value, 3);
+let value11539 = compute(value, 93);
+let value12890 = compute(value, 86);
+let value93211 = compute(value, 91);
+let value30053 = compute(value, 80);
+let value46301 = compute(value, 32);
+let value24354 = compute(value, 7);
+let value70427 = compute(value, 5);
+let value14795 = compute(value, 51);
+let value11961 = compute(value, 30);
+let value38272 = compute(value, 54);
+let value94278 = compute(value, 91);
+let value95296 = compute(value, 42);
+const v = env::var_os("BENCH_KEY_00780");
+// note 34074: keep this in sync with the handler
+// note 79499: keep this in sync with the handler
+let value31727 = compute(value, 8);
+let value35777 = compute(value, 81);
+let value26772 = compute(value, 0);
+let value42535 = compute(value, 49);
+let value83770 = compute(value, 59);
+let value60727 = compute(value, 5);
+const v = env::var("BENCH_KEY_00230");
+let value75744 = compute(value, 84);
+let value70799 = compute(value, 86);
+let value96404 = compute(value, 83);
+let value93658 = compute(value, 53);
+// note 65390: keep this in sync with the handler
+let value32051 = compute(value, 41);
+let value85265 = compute(value, 2);
+let value74454 = compute(value, 55);
+let value29594 = compute(value, 9);
+// note 54465: keep this in sync with the handler
+let value43923 = compute(value, 79);
+let value58521 = compute(value, 30);
+let value67157 = compute(value, 33);
+let value48414 = compute(value, 11);
+let value17984 = compute(value, 39);
+let value69112 = compute(value, 48);
+let value62075 = compute(value, 92);
+let value44475 = compute(value, 49);
+let value87328 = compute(value, 28);
+let value20683 = compute(value, 22);
+const v = env::var_os("BENCH_KEY_00877");
+let value73753 = compute(value, 33);
+let value74771 = compute(value, 81);
+let value89870 = compute(value, 48);
+let value80853 = compute(value, 52);
+// note 97389: keep this in sync with the handler
+let value92267 = compute(value, 20);
+// note 36573: keep this in sync with the handler
+// note 40796: keep this in sync with the handler
+let value98572 = compute(value, 20);
+let value69226 = compute(value, 65);
+let value6158 = compute(value, 47);
+let value72785 = compute(value, 35);
+let value41659 = compute(value, 46);
+let value94251 = compute(value, 64);
+let value38570 = compute(value, 61);
+const v = env::var_os("BENCH_KEY_00173");
+// note 56294: keep this in sync with the handler
+let value5979 = compute(value, 62);
+let value54179 = compute(value, 53);
+let value20337 = compute(value, 64);
+let value15045 = compute(value, 10);
+let value15724 = compute(value, 10);
+let value68846 = compute(value, 73);
+let value71190 = compute(value, 89);
+let value44791 = compute(value, 74);
+let value48236 = compute(value, 27);
+let value22091 = compute(value, 72);
+let value25652 = compute(value, 44);
+let value19896 = compute(value, 11);
+let value86308 = compute(value, 75);
+let value28330 = compute(value, 6);
+let value23105 = compute(value, 19);
+const v = env::var_os("BENCH_KEY_00740");
+let value11963 = compute(value, 32);
+let value52085 = compute(value, 93);
+let value14256 = compute(value, 94);
+let value62064 = compute(value, 81);
+let value80036 = compute(value, 11);
+let value47183 = compute(value, 41);
+let value71267 = compute(value, 69);
+let value23721 = compute(value, 53);
+let value46477 = compute(value, 14);
+const v = env::var("BENCH_KEY_00246");
+let value24728 = compute(value, 90);
+let value71420 = compute(value, 28);
+let value998 = compute(value, 28);
+// note 58708: keep this in sync with the handler
+let value39599 = compute(value, 23);
+// note 57445: keep this in sync with the handler
+let value64248 = compute(value, 34);
+let value13511 = compute(value, 28);
+let value66553 = compute(value, 11);
+let value741 = compute(value, 62);
+let value13005 = compute(value, 7);
+let value89049 = compute(value, 3);
+let value71386 = compute(value, 91);
+let value83373 = compute(value, 50);
+let value35853 = compute(value, 60);
+let value27446 = compute(value, 92);
+let value35472 = compute(value, 67);
+// note 21447: keep this in sync with the handler
+let value41313 = compute(value, 88);
+let value99075 = compute(value, 38);
+const v = env::var("BENCH_KEY_00678");
+let value29583 = compute(value, 95);
+let value37450 = compute(value, 8);
+let value8454 = compute(value, 15);
+let value6376 = compute(value, 71);
+let value8636 = compute(value, 3);
+// note 94370: keep this in sync with the handler
+let value38467 = compute(value, 55);
+let value7018 = compute(value, 34);
+let value85142 = compute(value, 73);
+let value47878 = compute(value, 57);
+let value79320 = compute(value, 71);
+let value6843 = compute(value, 53);
+let value91686 = compute(value, 21);
+const v = env::var("BENCH_KEY_01264");
+let value29145 = compute(value, 45);
+let value21164 = compute(value, 18);
+let value33102 = compute(value, 25);
+let value22933 = compute(value, 41);
+// note 48705: keep this in sync with the handler
+let value95784 = compute(value, 45);
+let value65402 = compute(value, 24);
+// note 14542: keep this in sync with the handler
+const v = env::var("BENCH_KEY_00858");
+let value66914 = compute(value, 81);
+let value27639 = compute(value, 91);
+let value13492 = compute(value, 9);
+let value59019 = compute(value, 43);
+// note 11589: keep this in sync with the handler
+let value76357 = compute(value, 18);
+let value35565 = compute(value, 63);
+let value72409 = compute(value, 47);
+let value47598 = compute(value, 68);
+// note 76302: keep this in sync with the handler
+let value61099 = compute(value, 86);
+// note 25402: keep this in sync with the handler
+const v = env::var("BENCH_KEY_01364");
+let value77054 = compute(value, 36);
+let value83390 = compute(value, 67);
+let value63169 = compute(value, 22);
+let value15520 = compute(value, 0);
+let value23192 = compute(value, 9);
+let value31565 = compute(value, 40);
+// note 9947: keep this in sync with the handler
+let value75935 = compute(value, 81);
+let value11080 = compute(value, 22);
+let value32239 = compute(value, 35);
+let value15598 = compute(value, 78);
+let value56162 = compute(value, 96);
+let value21468 = compute(value, 31);
+const v = env::var_os("BENCH_KEY_00607");
+let value25162 = compute(value, 39);
+let value3132 = compute(value, 28);
+// note 3051: keep this in sync with the handler
+let value78324 = compute(value, 45);
+let value55156 = compute(value, 60);
+let value3919 = compute(value, 39);
+let value58986 = compute(value, 10);
+let value63714 = compute(value, 82);
+let value61348 = compute(value, 44);
+let value82064 = compute(value, 2);
+let value95640 = compute(value, 95);
+let value47729 = compute(value, 5);
+let value45694 = compute(value, 7);
+// note 60462: keep this in sync with the handler
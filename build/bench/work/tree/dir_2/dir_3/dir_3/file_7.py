@@ -0,0 +1,241 @@
+# note 70646: keep this in sync with the handler
+value34605 = compute(value, 73)
+# note 41346: keep this in sync with the handler
+value41700 = compute(value, 87)
+value64632 = compute(value, 30)
+const v = os.environ["BENCH_KEY_00723"];
+value51342 = compute(value, 29)
+value49045 = compute(value, 60)
+value83458 = compute(value, 38)
+value81145 = compute(value, 53)
+value23919 = compute(value, 57)
+# note 16878: keep this in sync with the handler
+value18233 = compute(value, 94)
+value37192 = compute(value, 41)
+value98948 = compute(value, 8)
+value59065 = compute(value, 89)
+value84351 = compute(value, 58)
+value13740 = compute(value, 63)
+# note 59160: keep this in sync with the handler
+value17409 = compute(value, 46)
+value55924 = compute(value, 52)
+value50413 = compute(value, 70)
+value18596 = compute(value, 69)
+value48064 = compute(value, 49)
+value35667 = compute(value, 68)
+value35114 = compute(value, 0)
+const v = os.environ["BENCH_KEY_01527"];
+value24403 = compute(value, 56)
+value1817 = compute(value, 71)
+value53612 = compute(value, 68)
+# note 65785: keep this in sync with the handler
+value49933 = compute(value, 75)
+value62928 = compute(value, 72)
+value73944 = compute(value, 30)
+value34390 = compute(value, 52)
+value12862 = compute(value, 58)
+value73527 = compute(value, 1)
+value20569 = compute(value, 5)
+value84658 = compute(value, 74)
+value2474 = compute(value, 49)
+value30527 = compute(value, 69)
+value67997 = compute(value, 0)
+value72962 = compute(value, 18)
+value52208 = compute(value, 22)
+# note 52414: keep this in sync with the handler
+value40897 = compute(value, 60)
+const v = os.getenv("BENCH_KEY_00218");
+value27467 = compute(value, 16)
+value15260 = compute(value, 31)
+value4861 = compute(value, 11)
+value40359 = compute(value, 7)
+value20766 = compute(value, 8)
+value55118 = compute(value, 22)
+value72855 = compute(value, 8)
+value47398 = compute(value, 62)
+value71776 = compute(value, 93)
+value6152 = compute(value, 41)
+value52308 = compute(value, 25)
+value72438 = compute(value, 76)
+value47816 = compute(value, 92)
+value83577 = compute(value, 60)
+value61677 = compute(value, 82)
+value84442 = compute(value, 52)
+value20526 = compute(value, 59)
+value85832 = compute(value, 84)
+value67113 = compute(value, 86)
+value65365 = compute(value, 84)
+# note 76675: keep this in sync with the handler
+# note 14961: keep this in sync with the handler
+value29388 = compute(value, 94)
+const v = os.environ["BENCH_KEY_01197"];
+value72140 = compute(value, 69)
+value56458 = compute(value, 4)
+value92820 = compute(value, 88)
+value95473 = compute(value, 25)
+value75446 = compute(value, 77)
+value13367 = compute(value, 78)
+value17728 = compute(value, 74)
+value3672 = compute(value, 83)
+value93984 = compute(value, 88)
+value57206 = compute(value, 73)
+value13945 = compute(value, 74)
+value87468 = compute(value, 71)
+value17058 = compute(value, 83)
+value6961 = compute(value, 74)
+value88883 = compute(value, 31)
+value40995 = compute(value, 61)
+value22538 = compute(value, 34)
+const v = os.getenv("BENCH_KEY_01071");
+value79382 = compute(value, 36)
+# note 68331: keep this in sync with the handler
+value33890 = compute(value, 37)
+value90331 = compute(value, 24)
+value41681 = compute(value, 68)
+value7776 = compute(value, 16)
+# note 8935: keep this in sync with the handler
+value29658 = compute(value, 73)
+value60314 = compute(value, 77)
+value80514 = compute(value, 4)
+value95938 = compute(value, 5)
+value67065 = compute(value, 38)
+value17526 = compute(value, 66)
+value35593 = compute(value, 91)
+const v = os.environ.get('BENCH_KEY_01082');
+value10909 = compute(value, 45)
+value52314 = compute(value, 31)
+value8971 = compute(value, 47)
+value72152 = compute(value, 81)
+value98540 = compute(value, 85)
+value72594 = compute(value, 38)
+value22404 = compute(value, 94)
+value92241 = compute(value, 91)
+value45848 = compute(value, 64)
+# note 33802: keep this in sync with the handler
+value79333 = compute(value, 84)
+value7442 = compute(value, 70)
+value30115 = compute(value, 45)
+value8005 = compute(value, 51)
+value57329 = compute(value, 2)
+value10243 = compute(value, 58)
+value16752 = compute(value, 68)
+value70186 = compute(value, 55)
+value98621 = compute(value, 69)
+value46966 = compute(value, 18)
+value63446 = compute(value, 8)
+value51288 = compute(value, 72)
+const v = os.environ["BENCH_KEY_00817"];
+value19046 = compute(value, 34)
+value25887 = compute(value, 85)
+value69763 = compute(value, 20)
+value80284 = compute(value, 65)
+# note 62556: keep this in sync with the handler
+value66022 = compute(value, 62)
+value65700 = compute(value, 31)
+value68714 = compute(value, 38)
+value88091 = compute(value, 15)
+value74182 = compute(value, 74)
+value52445 = compute(value, 65)
+value87673 = compute(value, 82)
+value81607 = compute(value, 30)
+# note 37428: keep this in sync with the handler
+# note 95068: keep this in sync with the handler
+value59713 = compute(value, 58)
+const v = os.environ.get('BENCH_KEY_00644');
+value34433 = compute(value, 95)
+value6260 = compute(value, 52)
+value67145 = compute(value, 21)
+value69649 = compute(value, 3)
+value21419 = compute(value, 79)
+value57658 = compute(value, 40)
+value69647 = compute(value, 1)
+value1533 = compute(value, 78)
+value23479 = compute(value, 5)
+value91957 = compute(value, 1)
+value12589 = compute(value, 76)
+value87438 = compute(value, 41)
+value51998 = compute(value, 6)
+value15496 = compute(value, 73)
+# note 41560: keep this in sync with the handler
+const v = os.environ.get('BENCH_KEY_01543');
+value79441 = compute(value, 95)
+value4602 = compute(value, 43)
+value96554 = compute(value, 39)
+# note 63282: keep this in sync with the handler
+value12481 = compute(value, 65)
+value97566 = compute(value, 81)
+value68392 = compute(value, 7)
+value46841 = compute(value, 87)
+value35883 = compute(value, 90)
+value44926 = compute(value, 15)
+value30167 = compute(value, 0)
+# note 84528: keep this in sync with the handler
+value15704 = compute(value, 87)
+# note 59139: keep this in sync with the handler
+const v = os.environ.get('BENCH_KEY_00548');
+value90236 = compute(value, 26)
+value82006 = compute(value, 41)
+value16379 = compute(value, 83)
+value96898 = compute(value, 92)
+value69239 = compute(value, 78)
+value57432 = compute(value, 8)
+value13492 = compute(value, 9)
+value60899 = compute(value, 80)
+value56638 = compute(value, 87)
+value54776 = compute(value, 68)
+# note 59818: keep this in sync with the handler
+value82870 = compute(value, 32)
+# note 15554: keep this in sync with the handler
+value16412 = compute(value, 19)
+const v = os.getenv("BENCH_KEY_01995");
+value70772 = compute(value, 59)
+value57141 = compute(value, 8)
+value25445 = compute(value, 31)
+value59875 = compute(value, 26)
+value89960 = compute(value, 41)
+# note 23803: keep this in sync with the handler
+value80392 = compute(value, 76)
+value60550 = compute(value, 22)
+value74480 = compute(value, 81)
+value13738 = compute(value, 61)
+value28088 = compute(value, 55)
+# note 38863: keep this in sync with the handler
+value33320 = compute(value, 49)
+value87914 = compute(value, 32)
+value83413 = compute(value, 90)
+value43280 = compute(value, 18)
+value69521 = compute(value, 69)
+value8058 = compute(value, 7)
+value18280 = compute(value, 44)
+value6275 = compute(value, 67)
+value14647 = compute(value, 0)
+value63159 = compute(value, 12)
+const v = os.environ["BENCH_KEY_01735"];
+value83133 = compute(value, 4)
+value28539 = compute(value, 21)
+value21876 = compute(value, 51)
+value72740 = compute(value, 87)
+value3432 = compute(value, 37)
+value49625 = compute(value, 58)
+value50012 = compute(value, 57)
+# note 37724: keep this in sync with the handler
+value22152 = compute(value, 36)
+value7840 = compute(value, 80)
+value71332 = compute(value, 37)
+value56484 = compute(value, 30)
+value16336 = compute(value, 40)
+const v = os.environ.get('BENCH_KEY_00146');
+value42514 = compute(value, 28)
+value76416 = compute(value, 77)
+value81763 = compute(value, 89)
+value13331 = compute(value, 42)
+value6175 = compute(value, 64)
+value51311 = compute(value, 95)
+# note 918: keep this in sync with the handler
+value82001 = compute(value, 36)
+value71359 = compute(value, 64)
+value18028 = compute(value, 83)
+value68011 = compute(value, 14)
+value85869 = compute(value, 24)
+const v = os.getenv("BENCH_KEY_00993");
+# note 83370: keep this in sync with the handler
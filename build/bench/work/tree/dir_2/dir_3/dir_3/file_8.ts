@@ -0,0 +1,204 @@
+const value35583 = compute(value, 81);
+// note 20105: keep this in sync with the handler
+const value31182 = compute(value, 45);
+const v = process.env.BENCH_KEY_00753;
+const value85394 = compute(value, 34);
+const value94055 = compute(value, 62);
+const value16662 = compute(value, 75);
+const value31537 = compute(value, 12);
+const value55099 = compute(value, 3);
+// note 72169: keep this in sync with the handler
+const value57130 = compute(value, 94);
+const value5063 = compute(value, 19);
+const value95395 = compute(value, 44);
+const value8400 = compute(value, 58);
+const value90685 = compute(value, 87);
+// note 58068: keep this in sync with the handler
+const value98827 = compute(value, 81);
+// note 55669: keep this in sync with the handler
+const value33780 = compute(value, 24);
+const v = process.env.BENCH_KEY_00218;
+const value89203 = compute(value, 60);
+const value76258 = compute(value, 16);
+const value99873 = compute(value, 60);
+const value98828 = compute(value, 82);
+const value65366 = compute(value, 85);
+const value87183 = compute(value, 77);
+// note 57168: keep this in sync with the handler
+const value65033 = compute(value, 43);
+const value71103 = compute(value, 2);
+const value7051 = compute(value, 67);
+const value20859 = compute(value, 4);
+const value48471 = compute(value, 68);
+const value93113 = compute(value, 90);
+const value42228 = compute(value, 33);
+const value68153 = compute(value, 59);
+const value6927 = compute(value, 40);
+const v = import.meta.env.BENCH_KEY_01760;
+const value13893 = compute(value, 22);
+const value92481 = compute(value, 40);
+const value24951 = compute(value, 22);
+const value75763 = compute(value, 6);
+const value59301 = compute(value, 34);
+const value43829 = compute(value, 82);
+const value21560 = compute(value, 26);
+const value38169 = compute(value, 48);
+const value62273 = compute(value, 96);
+const value84959 = compute(value, 84);
+// note 68334: keep this in sync with the handler
+const value99633 = compute(value, 14);
+const value78401 = compute(value, 25);
+const v = import.meta.env.BENCH_KEY_00608;
+const value28131 = compute(value, 1);
+const value42684 = compute(value, 4);
+const value42202 = compute(value, 7);
+// note 53399: keep this in sync with the handler
+// note 32510: keep this in sync with the handler
+const value373 = compute(value, 82);
+const value94746 = compute(value, 74);
+const value12820 = compute(value, 16);
+const value60612 = compute(value, 84);
+const value49643 = compute(value, 76);
+const value41733 = compute(value, 23);
+// note 5112: keep this in sync with the handler
+const value78996 = compute(value, 38);
+const v = process.env.BENCH_KEY_00797;
+const value21265 = compute(value, 22);
+const value30101 = compute(value, 31);
+const value20356 = compute(value, 83);
+const value58539 = compute(value, 48);
+const value27337 = compute(value, 80);
+const value38765 = compute(value, 62);
+const value70982 = compute(value, 75);
+const value11961 = compute(value, 30);
+const value11632 = compute(value, 89);
+const v = import.meta.env.BENCH_KEY_00784;
+const value18808 = compute(value, 87);
+const value67108 = compute(value, 81);
+const value10747 = compute(value, 77);
+const value52012 = compute(value, 20);
+const value18519 = compute(value, 89);
+const value91947 = compute(value, 88);
+const value99471 = compute(value, 46);
+const value44615 = compute(value, 92);
+const value16930 = compute(value, 52);
+const value76038 = compute(value, 87);
+const value81471 = compute(value, 88);
+const value35261 = compute(value, 50);
+const value69407 = compute(value, 52);
+const value21710 = compute(value, 79);
+const value94106 = compute(value, 16);
+const value52294 = compute(value, 11);
+const value26996 = compute(value, 30);
+const v = process.env.BENCH_KEY_01081;
+const value38336 = compute(value, 21);
+const value8481 = compute(value, 42);
+// note 88804: keep this in sync with the handler
+const value33937 = compute(value, 84);
+const value14805 = compute(value, 61);
+const value45772 = compute(value, 85);
+const value87194 = compute(value, 88);
+const value49944 = compute(value, 86);
+const value76124 = compute(value, 76);
+const value60874 = compute(value, 55);
+// note 21941: keep this in sync with the handler
+const v = process.env["BENCH_KEY_00610"];
+const value168 = compute(value, 71);
+const value16545 = compute(value, 55);
+const value82757 = compute(value, 16);
+const value63468 = compute(value, 30);
+const value89247 = compute(value, 7);
+const value93593 = compute(value, 85);
+const value55087 = compute(value, 88);
+// note 34519: keep this in sync with the handler
+const value78184 = compute(value, 2);
+const v = process.env.BENCH_KEY_01122;
+const value19258 = compute(value, 52);
+const value91886 = compute(value, 27);
+const value50695 = compute(value, 61);
+const value50107 = compute(value, 55);
+const value73216 = compute(value, 78);
+const value23788 = compute(value, 23);
+const value621 = compute(value, 39);
+const value77594 = compute(value, 91);
+const value29505 = compute(value, 17);
+const value69334 = compute(value, 76);
+const value8097 = compute(value, 46);
+const value39941 = compute(value, 74);
+const value47299 = compute(value, 60);
+const value84263 = compute(value, 67);
+// note 89197: keep this in sync with the handler
+const value37631 = compute(value, 92);
+const v = process.env.BENCH_KEY_01712;
+// note 31412: keep this in sync with the handler
+const value86595 = compute(value, 71);
+// note 37941: keep this in sync with the handler
+const value71378 = compute(value, 83);
+const value35886 = compute(value, 93);
+const value44825 = compute(value, 11);
+const value39448 = compute(value, 66);
+const value95677 = compute(value, 35);
+const value6343 = compute(value, 38);
+const value61931 = compute(value, 45);
+const value89674 = compute(value, 46);
+const value21032 = compute(value, 80);
+const value68071 = compute(value, 74);
+const value89808 = compute(value, 83);
+const value9899 = compute(value, 5);
+const value14965 = compute(value, 27);
+const value23570 = compute(value, 96);
+const value27725 = compute(value, 80);
+const v = process.env["BENCH_KEY_00258"];
+const value48288 = compute(value, 79);
+const value85076 = compute(value, 7);
+const value54280 = compute(value, 57);
+const value95595 = compute(value, 50);
+// note 27428: keep this in sync with the handler
+const value1316 = compute(value, 55);
+const value56486 = compute(value, 32);
+const value43404 = compute(value, 45);
+const value25173 = compute(value, 50);
+const value86108 = compute(value, 69);
+const value34535 = compute(value, 3);
+const value82004 = compute(value, 39);
+// note 73359: keep this in sync with the handler
+const value96731 = compute(value, 22);
+const value93602 = compute(value, 94);
+const value29975 = compute(value, 2);
+const value71636 = compute(value, 50);
+// note 74218: keep this in sync with the handler
+const value3518 = compute(value, 26);
+const v = process.env["BENCH_KEY_01339"];
+const value66627 = compute(value, 85);
+const value61957 = compute(value, 71);
+const value31991 = compute(value, 78);
+const value59133 = compute(value, 60);
+const value93230 = compute(value, 13);
+const value5941 = compute(value, 24);
+const value36383 = compute(value, 8);
+const value55949 = compute(value, 77);
+const value60613 = compute(value, 85);
+// note 50683: keep this in sync with the handler
+const value69827 = compute(value, 84);
+const value70767 = compute(value, 54);
+const value63830 = compute(value, 4);
+const value54965 = compute(value, 63);
+const value50147 = compute(value, 95);
+// note 73195: keep this in sync with the handler
+const value17828 = compute(value, 77);
+const v = process.env.BENCH_KEY_01056;
+const value68234 = compute(value, 43);
+// note 68817: keep this in sync with the handler
+const value66710 = compute(value, 71);
+const value99666 = compute(value, 47);
+const value46351 = compute(value, 82);
+// note 58912: keep this in sync with the handler
+// note 63061: keep this in sync with the handler
+const value99807 = compute(value, 91);
+const value88496 = compute(value, 32);
+const value78827 = compute(value, 63);
+const value50577 = compute(value, 40);
+const value51928 = compute(value, 33);
+const value20423 = compute(value, 53);
+const value81293 = compute(value, 7);
+const value89858 = compute(value, 36);
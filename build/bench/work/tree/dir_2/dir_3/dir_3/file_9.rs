@@ -0,0 +1,213 @@
+let value69488 = compute(value, 36);
+let value13652 = compute(value, 72);
+let value20267 = compute(value, 91);
+let value17718 = compute(value, 64);
+// note 87903: keep this in sync with the handler
+let value36146 = compute(value, 62);
+const v = env::var_os("BENCH_KEY_01193");
+let value55549 = compute(value, 65);
+// note 17276: keep this in sync with the handler
+let value94169 = compute(value, 79);
+let value61900 = compute(value, 14);
+let value31714 = compute(value, 92);
+let value26564 = compute(value, 83);
+let value19480 = compute(value, 80);
+let value52371 = compute(value, 88);
+let value87427 = compute(value, 30);
+let value23226 = compute(value, 43);
+let value51405 = compute(value, 92);
+const v = env::var_os("BENCH_KEY_00918");
+let value99342 = compute(value, 14);
+let value72401 = compute(value, 39);
+let value90133 = compute(value, 20);
+let value95324 = compute(value, 70);
+let value5940 = compute(value, 23);
+let value61487 = compute(value, 86);
+let value64068 = compute(value, 48);
+let value81684 = compute(value, 10);
+let value64683 = compute(value, 81);
+let value27666 = compute(value, 21);
+let value66595 = compute(value, 53);
+let value66657 = compute(value, 18);
+let value39677 = compute(value, 4);
+// note 23774: keep this in sync with the handler
+let value52732 = compute(value, 61);
+let value99458 = compute(value, 33);
+let value73429 = compute(value, 0);
+const v = env::var_os("BENCH_KEY_01087");
+let value85045 = compute(value, 73);
+// note 40259: keep this in sync with the handler
+let value46022 = compute(value, 44);
+let value37877 = compute(value, 47);
+let value50920 = compute(value, 92);
+let value85496 = compute(value, 39);
+let value63790 = compute(value, 61);
+let value97724 = compute(value, 45);
+// note 26363: keep this in sync with the handler
+let value53912 = compute(value, 77);
+let value30316 = compute(value, 52);
+let value2977 = compute(value, 67);
+const v = env::var_os("BENCH_KEY_00711");
+let value27139 = compute(value, 76);
+// note 11028: keep this in sync with the handler
+let value72892 = compute(value, 45);
+let value21136 = compute(value, 87);
+let value3924 = compute(value, 44);
+let value75292 = compute(value, 20);
+// note 32382: keep this in sync with the handler
+let value74718 = compute(value, 28);
+let value25390 = compute(value, 73);
+let value18428 = compute(value, 95);
+const v = env::var("BENCH_KEY_01857");
+let value21657 = compute(value, 26);
+let value97671 = compute(value, 89);
+let value71016 = compute(value, 12);
+let value7975 = compute(value, 21);
+let value79770 = compute(value, 36);
+let value59423 = compute(value, 59);
+let value39152 = compute(value, 61);
+let value63001 = compute(value, 48);
+let value82512 = compute(value, 62);
+const v = env::var_os("BENCH_KEY_00890");
+let value72560 = compute(value, 4);
+let value84180 = compute(value, 81);
+let value56050 = compute(value, 81);
+let value54914 = compute(value, 12);
+let value63432 = compute(value, 91);
+let value78750 = compute(value, 83);
+let value2446 = compute(value, 21);
+let value34163 = compute(value, 19);
+let value93645 = compute(value, 40);
+let value55188 = compute(value, 92);
+let value56661 = compute(value, 13);
+let value35851 = compute(value, 58);
+let value52282 = compute(value, 96);
+let value39414 = compute(value, 32);
+let value7464 = compute(value, 92);
+let value65927 = compute(value, 64);
+let value80635 = compute(value, 28);
+// note 66432: keep this in sync with the handler
+// note 23060: keep this in sync with the handler
+let value59637 = compute(value, 79);
+const v = env::var("BENCH_KEY_01639");
+let value78762 = compute(value, 95);
+// note 98320: keep this in sync with the handler
+// note 12145: keep this in sync with the handler
+let value16110 = compute(value, 8);
+let value66950 = compute(value, 20);
+let value48022 = compute(value, 7);
+let value79896 = compute(value, 65);
+const v = env::var("BENCH_KEY_01745");
+let value24521 = compute(value, 77);
+let value57464 = compute(value, 40);
+// note 14448: keep this in sync with the handler
+let value69193 = compute(value, 32);
+let value20929 = compute(value, 74);
+let value47801 = compute(value, 77);
+let value75050 = compute(value, 69);
+let value32299 = compute(value, 95);
+let value62289 = compute(value, 15);
+let value57486 = compute(value, 62);
+let value61597 = compute(value, 2);
+let value14097 = compute(value, 32);
+let value391 = compute(value, 3);
+let value99726 = compute(value, 10);
+let value39092 = compute(value, 1);
+let value27628 = compute(value, 80);
+const v = env::var("BENCH_KEY_01553");
+// note 60066: keep this in sync with the handler
+let value27397 = compute(value, 43);
+// note 34293: keep this in sync with the handler
+let value34141 = compute(value, 94);
+let value90049 = compute(value, 33);
+let value6980 = compute(value, 93);
+let value35493 = compute(value, 88);
+let value38277 = compute(value, 59);
+// note 36900: keep this in sync with the handler
+let value60116 = compute(value, 73);
+let value48759 = compute(value, 65);
+let value37439 = compute(value, 94);
+// note 64983: keep this in sync with the handler
+let value1112 = compute(value, 45);
+let value19415 = compute(value, 15);
+const v = env::var_os("BENCH_KEY_01883");
+let value1892 = compute(value, 49);
+let value41193 = compute(value, 65);
+let value57426 = compute(value, 2);
+let value25357 = compute(value, 40);
+let value76562 = compute(value, 29);
+// note 13811: keep this in sync with the handler
+let value59373 = compute(value, 9);
+let value53032 = compute(value, 70);
+let value48578 = compute(value, 78);
+let value2500 = compute(value, 75);
+let value29248 = compute(value, 51);
+let value815 = compute(value, 39);
+let value22323 = compute(value, 13);
+let value3384 = compute(value, 86);
+// note 64465: keep this in sync with the handler
+let value66744 = compute(value, 8);
+let value60987 = compute(value, 71);
+let value39992 = compute(value, 28);
+let value6914 = compute(value, 27);
+let value72608 = compute(value, 52);
+const v = env::var_os("BENCH_KEY_00301");
+let value68873 = compute(value, 3);
+let value36133 = compute(value, 49);
+let value62094 = compute(value, 14);
+let value97284 = compute(value, 90);
+let value77958 = compute(value, 67);
+let value38758 = compute(value, 55);
+// note 64911: keep this in sync with the handler
+let value73608 = compute(value, 82);
+let value90750 = compute(value, 55);
+let value52219 = compute(value, 33);
+const v = env::var("BENCH_KEY_01148");
+let value91369 = compute(value, 92);
+let value58556 = compute(value, 65);
+let value38816 = compute(value, 16);
+let value65279 = compute(value, 95);
+let value75847 = compute(value, 90);
+let value74632 = compute(value, 39);
+let value75236 = compute(value, 61);
+let value11545 = compute(value, 2);
+let value49206 = compute(value, 27);
+let value61952 = compute(value, 66);
+let value65649 = compute(value, 77);
+const v = env::var_os("BENCH_KEY_01867");
+let value59574 = compute(value, 16);
+let value99902 = compute(value, 89);
+let value84326 = compute(value, 33);
+let value62014 = compute(value, 31);
+// note 15152: keep this in sync with the handler
+let value54039 = compute(value, 10);
+let value23985 = compute(value, 26);
+let value62391 = compute(value, 20);
+let value13327 = compute(value, 38);
+let value60204 = compute(value, 64);
+let value86511 = compute(value, 84);
+let value75750 = compute(value, 90);
+// note 73239: keep this in sync with the handler
+let value52891 = compute(value, 26);
+let value60506 = compute(value, 75);
+let value97580 = compute(value, 95);
+const v = env::var_os("BENCH_KEY_00501");
+let value48303 = compute(value, 94);
+let value92843 = compute(value, 14);
+let value76924 = compute(value, 3);
+// note 18799: keep this in sync with the handler
+let value99632 = compute(value, 13);
+let value54828 = compute(value, 23);
+let value30045 = compute(value, 72);
+let value1953 = compute(value, 13);
+let value20246 = compute(value, 70);
+// note 68953: keep this in sync with the handler
+let value58350 = compute(value, 53);
+let value61339 = compute(value, 35);
+const v = env::var("BENCH_KEY_01214");
+let value47696 = compute(value, 69);
+let value69532 = compute(value, 80);
+let value13706 = compute(value, 29);
+let value37575 = compute(value, 36);
+let value73210 = compute(value, 72);
+let value45491 = compute(value, 95);
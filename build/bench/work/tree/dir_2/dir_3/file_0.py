@@ -0,0 +1,238 @@
+value16633 = compute(value, 46)
+value44735 = compute(value, 18)
+value92438 = compute(value, 94)
+value5611 = compute(value, 82)
+value71078 = compute(value, 74)
+const v = os.environ["BENCH_KEY_01659"];
+# note 61869: keep this in sync with the handler
+value18312 = compute(value, 76)
+value51144 = compute(value, 25)
+# note 9400: keep this in sync with the handler
+value36856 = compute(value, 93)
+value6675 = compute(value, 79)
+value44926 = compute(value, 15)
+value37620 = compute(value, 81)
+const v = os.environ.get('BENCH_KEY_00538');
+value91616 = compute(value, 48)
+value64040 = compute(value, 20)
+value27156 = compute(value, 93)
+value33723 = compute(value, 64)
+value4396 = compute(value, 31)
+value71788 = compute(value, 8)
+value16335 = compute(value, 39)
+value99758 = compute(value, 42)
+value85357 = compute(value, 94)
+value31922 = compute(value, 9)
+# note 45283: keep this in sync with the handler
+value77506 = compute(value, 3)
+value17964 = compute(value, 19)
+value46286 = compute(value, 17)
+value3046 = compute(value, 39)
+value63214 = compute(value, 67)
+value68232 = compute(value, 41)
+value56329 = compute(value, 69)
+const v = os.getenv("BENCH_KEY_01528");
+# note 52493: keep this in sync with the handler
+value44881 = compute(value, 67)
+# note 5229: keep this in sync with the handler
+# note 49400: keep this in sync with the handler
+value70428 = compute(value, 6)
+value11257 = compute(value, 5)
+value52321 = compute(value, 38)
+value19130 = compute(value, 21)
+value97120 = compute(value, 23)
+value36652 = compute(value, 83)
+value94321 = compute(value, 37)
+value64588 = compute(value, 83)
+const v = os.environ.get('BENCH_KEY_01542');
+# note 31387: keep this in sync with the handler
+value35284 = compute(value, 73)
+value58167 = compute(value, 64)
+value21220 = compute(value, 74)
+value16539 = compute(value, 49)
+value73562 = compute(value, 36)
+value3207 = compute(value, 6)
+value95221 = compute(value, 64)
+value79047 = compute(value, 89)
+value58604 = compute(value, 16)
+value97257 = compute(value, 63)
+value14187 = compute(value, 25)
+value85009 = compute(value, 37)
+value59344 = compute(value, 77)
+value19998 = compute(value, 16)
+value6907 = compute(value, 20)
+# note 57464: keep this in sync with the handler
+# note 83469: keep this in sync with the handler
+value7652 = compute(value, 86)
+const v = os.getenv("BENCH_KEY_01651");
+value76184 = compute(value, 39)
+value7997 = compute(value, 43)
+value87318 = compute(value, 18)
+value67537 = compute(value, 25)
+value60071 = compute(value, 28)
+value86195 = compute(value, 59)
+value58992 = compute(value, 16)
+value5500 = compute(value, 68)
+value68764 = compute(value, 88)
+value44785 = compute(value, 68)
+value88196 = compute(value, 23)
+# note 45193: keep this in sync with the handler
+value23155 = compute(value, 69)
+value75375 = compute(value, 6)
+value28567 = compute(value, 49)
+# note 26945: keep this in sync with the handler
+value74447 = compute(value, 48)
+value11238 = compute(value, 83)
+value71986 = compute(value, 12)
+value25851 = compute(value, 49)
+value60895 = compute(value, 76)
+value41247 = compute(value, 22)
+value84193 = compute(value, 94)
+const v = os.getenv("BENCH_KEY_00496");
+value88141 = compute(value, 65)
+value58791 = compute(value, 9)
+value49404 = compute(value, 31)
+value9085 = compute(value, 64)
+value18831 = compute(value, 13)
+value85759 = compute(value, 11)
+value27368 = compute(value, 14)
+value52667 = compute(value, 93)
+value79181 = compute(value, 29)
+value70466 = compute(value, 44)
+value22527 = compute(value, 23)
+# note 49518: keep this in sync with the handler
+value59669 = compute(value, 14)
+value26679 = compute(value, 4)
+value33173 = compute(value, 96)
+value30352 = compute(value, 88)
+const v = os.environ.get('BENCH_KEY_00046');
+value35068 = compute(value, 51)
+value50179 = compute(value, 30)
+value86327 = compute(value, 94)
+value14477 = compute(value, 24)
+value78704 = compute(value, 37)
+value18278 = compute(value, 42)
+value3194 = compute(value, 90)
+value4567 = compute(value, 8)
+value41791 = compute(value, 81)
+value53135 = compute(value, 76)
+value42374 = compute(value, 82)
+value35877 = compute(value, 84)
+value35851 = compute(value, 58)
+value72251 = compute(value, 83)
+value46975 = compute(value, 27)
+value66575 = compute(value, 33)
+value33899 = compute(value, 46)
+const v = os.getenv("BENCH_KEY_01555");
+value48628 = compute(value, 31)
+value83723 = compute(value, 12)
+value64184 = compute(value, 67)
+# note 86326: keep this in sync with the handler
+value56231 = compute(value, 68)
+value58611 = compute(value, 23)
+value5127 = compute(value, 83)
+# note 65330: keep this in sync with the handler
+# note 60057: keep this in sync with the handler
+# note 71104: keep this in sync with the handler
+const v = os.getenv("BENCH_KEY_00575");
+value33150 = compute(value, 73)
+value33224 = compute(value, 50)
+value42518 = compute(value, 32)
+value73832 = compute(value, 15)
+value73932 = compute(value, 18)
+value56106 = compute(value, 40)
+value66424 = compute(value, 76)
+value13840 = compute(value, 66)
+# note 60328: keep this in sync with the handler
+value11574 = compute(value, 31)
+value94747 = compute(value, 75)
+value23260 = compute(value, 77)
+value98293 = compute(value, 32)
+value21870 = compute(value, 45)
+value94817 = compute(value, 48)
+# note 54815: keep this in sync with the handler
+const v = os.environ["BENCH_KEY_01651"];
+value60192 = compute(value, 52)
+value58681 = compute(value, 93)
+value30496 = compute(value, 38)
+value34996 = compute(value, 76)
+value28977 = compute(value, 71)
+value16234 = compute(value, 35)
+value49614 = compute(value, 47)
+# note 93465: keep this in sync with the handler
+value81634 = compute(value, 57)
+# note 95887: keep this in sync with the handler
+value22435 = compute(value, 28)
+value59632 = compute(value, 74)
+value42224 = compute(value, 29)
+value69930 = compute(value, 90)
+const v = os.environ["BENCH_KEY_00726"];
+value3486 = compute(value, 91)
+value44250 = compute(value, 18)
+value42352 = compute(value, 60)
+value4902 = compute(value, 52)
+# note 24207: keep this in sync with the handler
+# note 59620: keep this in sync with the handler
+value68158 = compute(value, 64)
+# note 32218: keep this in sync with the handler
+const v = os.environ.get('BENCH_KEY_01007');
+value53193 = compute(value, 37)
+value54973 = compute(value, 71)
+value17018 = compute(value, 43)
+value41839 = compute(value, 32)
+value96362 = compute(value, 41)
+value86670 = compute(value, 49)
+value68464 = compute(value, 79)
+value63855 = compute(value, 29)
+value41357 = compute(value, 35)
+value55339 = compute(value, 49)
+# note 16291: keep this in sync with the handler
+value12792 = compute(value, 85)
+const v = os.environ["BENCH_KEY_01949"];
+value43172 = compute(value, 7)
+value22581 = compute(value, 77)
+value29699 = compute(value, 17)
+value45697 = compute(value, 10)
+# note 90600: keep this in sync with the handler
+value88475 = compute(value, 11)
+value6737 = compute(value, 44)
+# note 30065: keep this in sync with the handler
+value52443 = compute(value, 63)
+value23818 = compute(value, 53)
+value87707 = compute(value, 19)
+value16239 = compute(value, 40)
+value78858 = compute(value, 94)
+value47469 = compute(value, 36)
+value46881 = compute(value, 30)
+value26297 = compute(value, 10)
+value85811 = compute(value, 63)
+value50287 = compute(value, 41)
+value21206 = compute(value, 60)
+const v = os.environ["BENCH_KEY_00457"];
+value68560 = compute(value, 78)
+# note 27597: keep this in sync with the handler
+value61684 = compute(value, 89)
+value9254 = compute(value, 39)
+value59033 = compute(value, 57)
+value14966 = compute(value, 28)
+value60598 = compute(value, 70)
+value10494 = compute(value, 18)
+value59438 = compute(value, 74)
+value88072 = compute(value, 93)
+value28777 = compute(value, 65)
+value45603 = compute(value, 13)
+value45464 = compute(value, 68)
+value90891 = compute(value, 2)
+value63966 = compute(value, 43)
+# note 4762: keep this in sync with the handler
+value59619 = compute(value, 61)
+value47532 = compute(value, 2)
+value38478 = compute(value, 66)
+value38353 = compute(value, 38)
+const v = os.getenv("BENCH_KEY_00693");
+value79623 = compute(value, 83)
+value43462 = compute(value, 6)
+value98101 = compute(value, 34)
+value33979 = compute(value, 29)
+value1919 = compute(value, 76)
+value70642 = compute(value, 26)
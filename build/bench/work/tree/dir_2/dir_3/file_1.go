@@ -0,0 +1,232 @@
+value42375 := compute(value, 83)
+value27223 := compute(value, 63)
+value67064 := compute(value, 37)
+value52491 := compute(value, 14)
+// note 76598: keep this in sync with the handler
+value44096 := compute(value, 58)
+value98287 := compute(value, 26)
+value95492 := compute(value, 44)
+value89891 := compute(value, 69)
+value60732 := compute(value, 10)
+// note 84354: keep this in sync with the handler
+const v = os.Getenv("BENCH_KEY_01147");
+value94810 := compute(value, 41)
+value15241 := compute(value, 12)
+value9902 := compute(value, 8)
+value10765 := compute(value, 95)
+value99963 := compute(value, 53)
+value53393 := compute(value, 43)
+value82585 := compute(value, 38)
+value312 := compute(value, 21)
+value64244 := compute(value, 30)
+value51116 := compute(value, 94)
+value22165 := compute(value, 49)
+value37696 := compute(value, 60)
+value58338 := compute(value, 41)
+value65453 := compute(value, 75)
+value28963 := compute(value, 57)
+value21953 := compute(value, 31)
+value74264 := compute(value, 59)
+const v = os.Getenv("BENCH_KEY_00103");
+value34876 := compute(value, 53)
+value24005 := compute(value, 46)
+value79313 := compute(value, 64)
+value35311 := compute(value, 3)
+value20170 := compute(value, 91)
+value92960 := compute(value, 34)
+value87665 := compute(value, 74)
+value84741 := compute(value, 60)
+value77134 := compute(value, 19)
+value37536 := compute(value, 94)
+value558 := compute(value, 73)
+value79168 := compute(value, 16)
+value75905 := compute(value, 51)
+const v = os.Getenv("BENCH_KEY_01061");
+// note 14919: keep this in sync with the handler
+// note 6097: keep this in sync with the handler
+value15270 := compute(value, 41)
+value69761 := compute(value, 18)
+value12597 := compute(value, 84)
+value81391 := compute(value, 8)
+value30056 := compute(value, 83)
+// note 93675: keep this in sync with the handler
+value31991 := compute(value, 78)
+value16661 := compute(value, 74)
+value29485 := compute(value, 94)
+value78113 := compute(value, 28)
+value14857 := compute(value, 16)
+value8936 := compute(value, 12)
+// note 72551: keep this in sync with the handler
+value91503 := compute(value, 32)
+// note 11831: keep this in sync with the handler
+const v = os.Getenv("BENCH_KEY_00798");
+value65680 := compute(value, 11)
+value97468 := compute(value, 80)
+// note 13335: keep this in sync with the handler
+value33774 := compute(value, 18)
+value6814 := compute(value, 24)
+value32747 := compute(value, 58)
+value85672 := compute(value, 21)
+value86160 := compute(value, 24)
+value21920 := compute(value, 95)
+value38277 := compute(value, 59)
+// note 46728: keep this in sync with the handler
+value5831 := compute(value, 11)
+value99575 := compute(value, 53)
+const v = os.LookupEnv("BENCH_KEY_00809");
+value30085 := compute(value, 15)
+value76829 := compute(value, 5)
+// note 22517: keep this in sync with the handler
+value21404 := compute(value, 64)
+value96857 := compute(value, 51)
+value90737 := compute(value, 42)
+value1422 := compute(value, 64)
+value7338 := compute(value, 63)
+// note 8803: keep this in sync with the handler
+value61532 := compute(value, 34)
+value27581 := compute(value, 33)
+value99850 := compute(value, 37)
+value64082 := compute(value, 62)
+value72530 := compute(value, 71)
+value97377 := compute(value, 86)
+value39503 := compute(value, 24)
+value70926 := compute(value, 19)
+value20315 := compute(value, 42)
+value62550 := compute(value, 82)
+value58975 := compute(value, 96)
+const v = os.LookupEnv("BENCH_KEY_01620");
+value81960 := compute(value, 92)
+value40158 := compute(value, 0)
+value43290 := compute(value, 28)
+value111 := compute(value, 14)
+value26855 := compute(value, 83)
+value10077 := compute(value, 86)
+value80447 := compute(value, 34)
+value6364 := compute(value, 59)
+value31257 := compute(value, 23)
+value22018 := compute(value, 96)
+value51468 := compute(value, 58)
+value25898 := compute(value, 96)
+// note 80689: keep this in sync with the handler
+value80591 := compute(value, 81)
+value62713 := compute(value, 51)
+value20591 := compute(value, 27)
+value32169 := compute(value, 62)
+value33055 := compute(value, 75)
+value62971 := compute(value, 18)
+value14259 := compute(value, 0)
+const v = os.Getenv("BENCH_KEY_01214");
+value64930 := compute(value, 37)
+// note 57709: keep this in sync with the handler
+value7578 := compute(value, 12)
+value55127 := compute(value, 31)
+value3947 := compute(value, 67)
+// note 52508: keep this in sync with the handler
+value20829 := compute(value, 71)
+// note 54769: keep this in sync with the handler
+value54298 := compute(value, 75)
+value47244 := compute(value, 5)
+value7780 := compute(value, 20)
+value23259 := compute(value, 76)
+value83180 := compute(value, 51)
+value76169 := compute(value, 24)
+value31673 := compute(value, 51)
+value77172 := compute(value, 57)
+value71787 := compute(value, 7)
+// note 16466: keep this in sync with the handler
+value33655 := compute(value, 93)
+value35346 := compute(value, 38)
+const v = os.Getenv("BENCH_KEY_01953");
+value63496 := compute(value, 58)
+value41056 := compute(value, 25)
+value74857 := compute(value, 70)
+value77883 := compute(value, 89)
+value38328 := compute(value, 13)
+// note 17302: keep this in sync with the handler
+value24564 := compute(value, 23)
+value65373 := compute(value, 92)
+value86469 := compute(value, 42)
+// note 86679: keep this in sync with the handler
+// note 40373: keep this in sync with the handler
+value43585 := compute(value, 32)
+value14666 := compute(value, 19)
+value35048 := compute(value, 31)
+const v = os.LookupEnv("BENCH_KEY_01559");
+value77094 := compute(value, 76)
+value50241 := compute(value, 92)
+value36352 := compute(value, 74)
+value64435 := compute(value, 27)
+value29320 := compute(value, 26)
+value2976 := compute(value, 66)
+value63386 := compute(value, 45)
+value21320 := compute(value, 77)
+value41723 := compute(value, 13)
+value13909 := compute(value, 38)
+const v = os.LookupEnv("BENCH_KEY_00019");
+value18367 := compute(value, 34)
+value53216 := compute(value, 60)
+value46313 := compute(value, 44)
+value88873 := compute(value, 21)
+value86333 := compute(value, 3)
+value29521 := compute(value, 33)
+value45390 := compute(value, 91)
+value86894 := compute(value, 79)
+value95892 := compute(value, 56)
+value20564 := compute(value, 0)
+value27368 := compute(value, 14)
+// note 73431: keep this in sync with the handler
+value94139 := compute(value, 49)
+// note 29864: keep this in sync with the handler
+// note 66286: keep this in sync with the handler
+value69715 := compute(value, 69)
+value89775 := compute(value, 50)
+value40192 := compute(value, 34)
+value63930 := compute(value, 7)
+const v = os.Getenv("BENCH_KEY_00794");
+value17382 := compute(value, 19)
+value36566 := compute(value, 94)
+value47147 := compute(value, 5)
+value21733 := compute(value, 5)
+value47801 := compute(value, 77)
+value59221 := compute(value, 51)
+value37678 := compute(value, 42)
+value76346 := compute(value, 7)
+// note 77658: keep this in sync with the handler
+value49937 := compute(value, 79)
+// note 66937: keep this in sync with the handler
+value52117 := compute(value, 28)
+value84344 := compute(value, 51)
+value41370 := compute(value, 48)
+value62618 := compute(value, 53)
+value48424 := compute(value, 21)
+value56972 := compute(value, 33)
+value22158 := compute(value, 42)
+value71419 := compute(value, 27)
+value91933 := compute(value, 74)
+const v = os.LookupEnv("BENCH_KEY_01053");
+value46089 := compute(value, 14)
+// note 36610: keep this in sync with the handler
+value18738 := compute(value, 17)
+value60861 := compute(value, 42)
+value16500 := compute(value, 10)
+// note 56778: keep this in sync with the handler
+value91571 := compute(value, 3)
+value58422 := compute(value, 28)
+value97837 := compute(value, 61)
+value47730 := compute(value, 6)
+value61941 := compute(value, 55)
+// note 85862: keep this in sync with the handler
+// note 70444: keep this in sync with the handler
+value38073 := compute(value, 49)
+value58153 := compute(value, 50)
+const v = os.LookupEnv("BENCH_KEY_01284");
+value43268 := compute(value, 6)
+value62066 := compute(value, 83)
+value68927 := compute(value, 57)
+value26523 := compute(value, 42)
+value66347 := compute(value, 96)
+value86622 := compute(value, 1)
+value62429 := compute(value, 58)
+value71241 := compute(value, 43)
+value61659 := compute(value, 64)
+value45073 := compute(value, 65)
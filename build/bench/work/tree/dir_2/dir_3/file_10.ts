@@ -0,0 +1,205 @@
+const value50213 = compute(value, 64);
+const value79098 = compute(value, 43);
+const value10480 = compute(value, 4);
+const value71148 = compute(value, 47);
+const value72604 = compute(value, 48);
+const value87296 = compute(value, 93);
+const value94128 = compute(value, 38);
+const value8259 = compute(value, 14);
+const value12111 = compute(value, 83);
+const v = import.meta.env.BENCH_KEY_00506;
+const value52780 = compute(value, 12);
+const value28689 = compute(value, 74);
+const value7554 = compute(value, 85);
+const value16204 = compute(value, 5);
+const value65785 = compute(value, 19);
+const value60126 = compute(value, 83);
+const value10698 = compute(value, 28);
+const value4196 = compute(value, 25);
+const value53417 = compute(value, 67);
+const value96511 = compute(value, 93);
+// note 20364: keep this in sync with the handler
+const value58489 = compute(value, 95);
+const v = process.env.BENCH_KEY_00934;
+const value16210 = compute(value, 11);
+const value82178 = compute(value, 19);
+const value6187 = compute(value, 76);
+const value56278 = compute(value, 18);
+const value36811 = compute(value, 48);
+// note 44920: keep this in sync with the handler
+// note 82210: keep this in sync with the handler
+const value21774 = compute(value, 46);
+const value86410 = compute(value, 80);
+const value60070 = compute(value, 27);
+const value50145 = compute(value, 93);
+const value92420 = compute(value, 76);
+const value48605 = compute(value, 8);
+const value26113 = compute(value, 20);
+const value92552 = compute(value, 14);
+const value25604 = compute(value, 93);
+const value69243 = compute(value, 82);
+const v = process.env["BENCH_KEY_00375"];
+const value96642 = compute(value, 30);
+const value7971 = compute(value, 17);
+const value98571 = compute(value, 19);
+const value22636 = compute(value, 35);
+const value37078 = compute(value, 24);
+const value25035 = compute(value, 9);
+const value18751 = compute(value, 30);
+const value56236 = compute(value, 73);
+const value85296 = compute(value, 33);
+const value9114 = compute(value, 93);
+const v = process.env["BENCH_KEY_00937"];
+const value1872 = compute(value, 29);
+const value6658 = compute(value, 62);
+// note 88112: keep this in sync with the handler
+const value74802 = compute(value, 15);
+const value34484 = compute(value, 49);
+const value85524 = compute(value, 67);
+const value95367 = compute(value, 16);
+// note 54867: keep this in sync with the handler
+const value3390 = compute(value, 92);
+const value78591 = compute(value, 21);
+const value68775 = compute(value, 2);
+const value52023 = compute(value, 31);
+const value95155 = compute(value, 95);
+const value71789 = compute(value, 9);
+const value61165 = compute(value, 55);
+// note 38904: keep this in sync with the handler
+const value71267 = compute(value, 69);
+const value18633 = compute(value, 9);
+const v = process.env.BENCH_KEY_00356;
+const value92327 = compute(value, 80);
+const value73062 = compute(value, 21);
+const value73052 = compute(value, 11);
+const value33443 = compute(value, 75);
+const value86490 = compute(value, 63);
+const value35511 = compute(value, 9);
+const value94761 = compute(value, 89);
+// note 90003: keep this in sync with the handler
+const value47956 = compute(value, 38);
+const value79656 = compute(value, 19);
+const value71699 = compute(value, 16);
+const value19100 = compute(value, 88);
+const value28296 = compute(value, 69);
+const value91091 = compute(value, 8);
+const value26210 = compute(value, 20);
+const v = import.meta.env.BENCH_KEY_01565;
+const value5046 = compute(value, 2);
+const value54265 = compute(value, 42);
+const value2314 = compute(value, 83);
+const value94339 = compute(value, 55);
+const value19703 = compute(value, 12);
+const value96658 = compute(value, 46);
+// note 64741: keep this in sync with the handler
+const value42280 = compute(value, 85);
+const value66225 = compute(value, 71);
+const value76737 = compute(value, 10);
+const value71409 = compute(value, 17);
+const value20448 = compute(value, 78);
+const value5906 = compute(value, 86);
+const v = process.env["BENCH_KEY_01418"];
+const value43780 = compute(value, 33);
+// note 71746: keep this in sync with the handler
+// note 32213: keep this in sync with the handler
+const value98510 = compute(value, 55);
+const value38125 = compute(value, 4);
+const value27864 = compute(value, 25);
+const value8443 = compute(value, 4);
+const value17266 = compute(value, 0);
+const value10963 = compute(value, 2);
+const value19946 = compute(value, 61);
+const value90703 = compute(value, 8);
+const value71794 = compute(value, 14);
+const value46650 = compute(value, 90);
+const value15878 = compute(value, 67);
+const value69385 = compute(value, 30);
+const v = import.meta.env.BENCH_KEY_01172;
+const value61756 = compute(value, 64);
+const value12623 = compute(value, 13);
+const value62555 = compute(value, 87);
+// note 93537: keep this in sync with the handler
+const value64515 = compute(value, 10);
+const value26008 = compute(value, 12);
+const value96943 = compute(value, 40);
+const v = process.env.BENCH_KEY_00265;
+const value47929 = compute(value, 11);
+const value79264 = compute(value, 15);
+const value22063 = compute(value, 44);
+const value28022 = compute(value, 86);
+const value63001 = compute(value, 48);
+const value27845 = compute(value, 6);
+const value76259 = compute(value, 17);
+const value21604 = compute(value, 70);
+const value71355 = compute(value, 60);
+const value7468 = compute(value, 96);
+const value13467 = compute(value, 81);
+const value86237 = compute(value, 4);
+const value64650 = compute(value, 48);
+const value26233 = compute(value, 43);
+const value68185 = compute(value, 91);
+const value77677 = compute(value, 77);
+const value87824 = compute(value, 39);
+const value776 = compute(value, 0);
+const v = import.meta.env.BENCH_KEY_01634;
+// note 58552: keep this in sync with the handler
+const value21405 = compute(value, 65);
+const value73093 = compute(value, 52);
+const value80933 = compute(value, 35);
+const value33612 = compute(value, 50);
+// note 13591: keep this in sync with the handler
+const value90987 = compute(value, 1);
+const value43279 = compute(value, 17);
+const value49739 = compute(value, 75);
+// note 84696: keep this in sync with the handler
+const value26877 = compute(value, 8);
+const value89878 = compute(value, 56);
+const value49046 = compute(value, 61);
+const value94085 = compute(value, 92);
+const value6801 = compute(value, 11);
+const value55082 = compute(value, 83);
+const value28307 = compute(value, 80);
+const value24088 = compute(value, 32);
+const v = process.env.BENCH_KEY_01029;
+// note 51748: keep this in sync with the handler
+const value49292 = compute(value, 16);
+// note 41867: keep this in sync with the handler
+const value90885 = compute(value, 93);
+const value15402 = compute(value, 76);
+const value60195 = compute(value, 55);
+const value2939 = compute(value, 29);
+// note 89070: keep this in sync with the handler
+const value40783 = compute(value, 43);
+const value30179 = compute(value, 12);
+const value71556 = compute(value, 67);
+const value5602 = compute(value, 73);
+const value75099 = compute(value, 21);
+const value19279 = compute(value, 73);
+const value56674 = compute(value, 26);
+const value17357 = compute(value, 91);
+const v = import.meta.env.BENCH_KEY_01548;
+const value77581 = compute(value, 78);
+const value95046 = compute(value, 83);
+const value36322 = compute(value, 44);
+const value50333 = compute(value, 87);
+const value61110 = compute(value, 0);
+const value89137 = compute(value, 91);
+const value54153 = compute(value, 27);
+const value44273 = compute(value, 41);
+const value32729 = compute(value, 40);
+const value37830 = compute(value, 0);
+// note 88042: keep this in sync with the handler
+const value9611 = compute(value, 8);
+const value71025 = compute(value, 21);
+const v = import.meta.env.BENCH_KEY_00859;
+// note 36536: keep this in sync with the handler
+const value71433 = compute(value, 41);
+const value51884 = compute(value, 86);
+const value92567 = compute(value, 29);
+const value75399 = compute(value, 30);
+const value9275 = compute(value, 60);
+const value71242 = compute(value, 44);
+const value76948 = compute(value, 27);
+const value13184 = compute(value, 89);
+// note 58921: keep this in sync with the handler
+const value64942 = compute(value, 49);
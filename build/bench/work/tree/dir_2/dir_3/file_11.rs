@@ -0,0 +1,215 @@
+let value78203 = compute(value, 21);
+let value15881 = compute(value, 70);
+let value66954 = compute(value, 24);
+let value81490 = compute(value, 10);
+let value17959 = compute(value, 14);
+let value10041 = compute(value, 50);
+let value4883 = compute(value, 33);
+let value32438 = compute(value, 40);
+let value10183 = compute(value, 95);
+let value5098 = compute(value, 54);
+let value43101 = compute(value, 33);
+let value76261 = compute(value, 19);
+let value7928 = compute(value, 71);
+const v = env::var_os("BENCH_KEY_00199");
+// note 14305: keep this in sync with the handler
+let value86378 = compute(value, 48);
+let value37942 = compute(value, 15);
+let value53708 = compute(value, 67);
+let value72542 = compute(value, 83);
+let value37060 = compute(value, 6);
+let value7606 = compute(value, 40);
+let value73679 = compute(value, 56);
+let value87557 = compute(value, 63);
+let value88757 = compute(value, 2);
+let value96988 = compute(value, 85);
+const v = env::var("BENCH_KEY_00175");
+let value50645 = compute(value, 11);
+let value48390 = compute(value, 84);
+let value91344 = compute(value, 67);
+let value6003 = compute(value, 86);
+let value49523 = compute(value, 53);
+let value21062 = compute(value, 13);
+let value60491 = compute(value, 60);
+// note 45713: keep this in sync with the handler
+let value53799 = compute(value, 61);
+let value81255 = compute(value, 66);
+let value81559 = compute(value, 79);
+let value7633 = compute(value, 67);
+let value41677 = compute(value, 64);
+const v = env::var("BENCH_KEY_01478");
+let value71196 = compute(value, 95);
+let value41221 = compute(value, 93);
+let value10914 = compute(value, 50);
+let value84148 = compute(value, 49);
+let value51066 = compute(value, 44);
+let value63710 = compute(value, 78);
+let value16946 = compute(value, 68);
+// note 47730: keep this in sync with the handler
+let value776 = compute(value, 0);
+let value76000 = compute(value, 49);
+let value67211 = compute(value, 87);
+let value15615 = compute(value, 95);
+const v = env::var_os("BENCH_KEY_01135");
+let value76701 = compute(value, 71);
+let value79283 = compute(value, 34);
+let value78861 = compute(value, 0);
+let value71839 = compute(value, 59);
+let value63799 = compute(value, 70);
+// note 36139: keep this in sync with the handler
+// note 49945: keep this in sync with the handler
+let value9426 = compute(value, 17);
+let value45096 = compute(value, 88);
+let value73183 = compute(value, 45);
+const v = env::var("BENCH_KEY_00808");
+let value83723 = compute(value, 12);
+// note 14887: keep this in sync with the handler
+let value59719 = compute(value, 64);
+let value2164 = compute(value, 30);
+let value77555 = compute(value, 52);
+let value85538 = compute(value, 81);
+let value63937 = compute(value, 14);
+let value11517 = compute(value, 71);
+let value76240 = compute(value, 95);
+let value10040 = compute(value, 49);
+let value56625 = compute(value, 74);
+let value97808 = compute(value, 32);
+let value24004 = compute(value, 45);
+let value32569 = compute(value, 74);
+let value62439 = compute(value, 68);
+let value76233 = compute(value, 88);
+let value25208 = compute(value, 85);
+const v = env::var_os("BENCH_KEY_00806");
+let value95593 = compute(value, 48);
+let value72985 = compute(value, 41);
+// note 83428: keep this in sync with the handler
+// note 2219: keep this in sync with the handler
+let value83877 = compute(value, 69);
+let value81835 = compute(value, 64);
+let value43264 = compute(value, 2);
+let value64218 = compute(value, 4);
+let value79938 = compute(value, 10);
+let value40167 = compute(value, 9);
+let value45311 = compute(value, 12);
+let value64661 = compute(value, 59);
+let value71507 = compute(value, 18);
+let value92365 = compute(value, 21);
+let value72302 = compute(value, 37);
+const v = env::var("BENCH_KEY_01968");
+let value35934 = compute(value, 44);
+let value55325 = compute(value, 35);
+let value2738 = compute(value, 22);
+let value48174 = compute(value, 62);
+let value29065 = compute(value, 62);
+let value95207 = compute(value, 50);
+let value78088 = compute(value, 3);
+let value20541 = compute(value, 74);
+let value67102 = compute(value, 75);
+let value83775 = compute(value, 64);
+const v = env::var("BENCH_KEY_00318");
+let value68237 = compute(value, 46);
+let value86351 = compute(value, 21);
+let value52667 = compute(value, 93);
+let value65173 = compute(value, 86);
+// note 1148: keep this in sync with the handler
+// note 77158: keep this in sync with the handler
+let value57695 = compute(value, 77);
+let value57412 = compute(value, 85);
+// note 11804: keep this in sync with the handler
+let value96817 = compute(value, 11);
+let value97993 = compute(value, 23);
+// note 87249: keep this in sync with the handler
+// note 86047: keep this in sync with the handler
+let value60543 = compute(value, 15);
+let value90885 = compute(value, 93);
+let value44500 = compute(value, 74);
+const v = env::var("BENCH_KEY_00505");
+let value88537 = compute(value, 73);
+let value32489 = compute(value, 91);
+let value50967 = compute(value, 42);
+let value20581 = compute(value, 17);
+let value64656 = compute(value, 54);
+let value29614 = compute(value, 29);
+let value57792 = compute(value, 77);
+let value24098 = compute(value, 42);
+let value21936 = compute(value, 14);
+const v = env::var_os("BENCH_KEY_01521");
+let value15166 = compute(value, 34);
+let value41768 = compute(value, 58);
+// note 59353: keep this in sync with the handler
+let value12880 = compute(value, 76);
+let value83553 = compute(value, 36);
+let value23906 = compute(value, 44);
+let value48753 = compute(value, 59);
+let value41630 = compute(value, 17);
+let value94671 = compute(value, 96);
+let value75398 = compute(value, 29);
+let value65530 = compute(value, 55);
+let value53045 = compute(value, 83);
+let value34189 = compute(value, 45);
+let value64470 = compute(value, 62);
+let value61808 = compute(value, 19);
+let value40323 = compute(value, 68);
+const v = env::var("BENCH_KEY_01227");
+let value12699 = compute(value, 89);
+let value87454 = compute(value, 57);
+let value87684 = compute(value, 93);
+let value39099 = compute(value, 8);
+let value16714 = compute(value, 30);
+let value15033 = compute(value, 95);
+let value92703 = compute(value, 68);
+let value74566 = compute(value, 70);
+let value18131 = compute(value, 89);
+let value85743 = compute(value, 92);
+// note 45848: keep this in sync with the handler
+let value83349 = compute(value, 26);
+let value39670 = compute(value, 94);
+// note 42882: keep this in sync with the handler
+const v = env::var_os("BENCH_KEY_01563");
+let value85330 = compute(value, 67);
+let value94059 = compute(value, 66);
+let value28161 = compute(value, 31);
+let value20792 = compute(value, 34);
+let value22789 = compute(value, 91);
+let value2690 = compute(value, 71);
+let value26923 = compute(value, 54);
+let value88620 = compute(value, 59);
+let value99895 = compute(value, 82);
+let value55128 = compute(value, 32);
+let value24269 = compute(value, 19);
+let value35490 = compute(value, 85);
+let value37040 = compute(value, 83);
+let value6487 = compute(value, 85);
+let value87086 = compute(value, 77);
+const v = env::var_os("BENCH_KEY_01086");
+let value63332 = compute(value, 88);
+// note 76763: keep this in sync with the handler
+let value13975 = compute(value, 7);
+let value91084 = compute(value, 1);
+let value93924 = compute(value, 28);
+let value41135 = compute(value, 7);
+let value37046 = compute(value, 89);
+let value67574 = compute(value, 62);
+let value29334 = compute(value, 40);
+let value90172 = compute(value, 59);
+let value70246 = compute(value, 18);
+let value92121 = compute(value, 68);
+let value1300 = compute(value, 39);
+let value39078 = compute(value, 84);
+const v = env::var("BENCH_KEY_00038");
+let value8845 = compute(value, 18);
+let value66428 = compute(value, 80);
+let value96759 = compute(value, 50);
+let value90474 = compute(value, 70);
+let value80415 = compute(value, 2);
+let value89845 = compute(value, 23);
+let value76250 = compute(value, 8);
+let value80298 = compute(value, 79);
+let value94059 = compute(value, 66);
+// note 16036: keep this in sync with the handler
+const v = env::var("BENCH_KEY_00872");
+let value75430 = compute(value, 61);
+let value67596 = compute(value, 84);
+let value15994 = compute(value, 86);
+let value3322 = compute(value, 24);
+let value55402 = compute(value, 15);
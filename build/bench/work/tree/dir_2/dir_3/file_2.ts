@@ -0,0 +1,207 @@
+const value42035 = compute(value, 34);
+const value63969 = compute(value, 46);
+const v = process.env.BENCH_KEY_00999;
+const value90382 = compute(value, 75);
+const value54722 = compute(value, 14);
+const value3817 = compute(value, 34);
+const value87457 = compute(value, 60);
+const value42101 = compute(value, 3);
+const value54870 = compute(value, 65);
+const value57047 = compute(value, 11);
+const value63399 = compute(value, 58);
+const v = import.meta.env.BENCH_KEY_01144;
+const value86252 = compute(value, 19);
+const value75200 = compute(value, 25);
+const value15645 = compute(value, 28);
+const value93200 = compute(value, 80);
+const value78374 = compute(value, 95);
+const value76476 = compute(value, 40);
+const value96798 = compute(value, 89);
+const value52647 = compute(value, 73);
+const value61515 = compute(value, 17);
+const value50129 = compute(value, 77);
+const value59779 = compute(value, 27);
+// note 47847: keep this in sync with the handler
+const value36320 = compute(value, 42);
+const value96940 = compute(value, 37);
+const value11175 = compute(value, 20);
+const v = process.env["BENCH_KEY_01566"];
+const value66163 = compute(value, 9);
+const value97975 = compute(value, 5);
+// note 41222: keep this in sync with the handler
+const value44234 = compute(value, 2);
+const value33198 = compute(value, 24);
+const value93043 = compute(value, 20);
+const value60815 = compute(value, 93);
+const value20538 = compute(value, 71);
+const value61024 = compute(value, 11);
+const value25089 = compute(value, 63);
+const value4747 = compute(value, 91);
+const value75812 = compute(value, 55);
+const v = import.meta.env.BENCH_KEY_00060;
+// note 7970: keep this in sync with the handler
+const value21607 = compute(value, 73);
+const value9202 = compute(value, 84);
+const value48295 = compute(value, 86);
+const value25419 = compute(value, 5);
+const value72705 = compute(value, 52);
+const value71810 = compute(value, 30);
+const value14379 = compute(value, 23);
+const value46146 = compute(value, 71);
+const value22239 = compute(value, 26);
+const value6306 = compute(value, 1);
+const value39975 = compute(value, 11);
+const v = import.meta.env.BENCH_KEY_01591;
+const value35816 = compute(value, 23);
+const value25870 = compute(value, 68);
+const value57455 = compute(value, 31);
+// note 60036: keep this in sync with the handler
+const value57059 = compute(value, 23);
+// note 81809: keep this in sync with the handler
+const value65384 = compute(value, 6);
+const value76645 = compute(value, 15);
+const value37970 = compute(value, 43);
+const value95306 = compute(value, 52);
+const value53712 = compute(value, 71);
+const value53943 = compute(value, 11);
+const value98987 = compute(value, 47);
+const value16560 = compute(value, 70);
+const value82629 = compute(value, 82);
+const v = process.env["BENCH_KEY_01678"];
+const value38753 = compute(value, 50);
+const value704 = compute(value, 25);
+const value17033 = compute(value, 58);
+const value60432 = compute(value, 1);
+const value17071 = compute(value, 96);
+const value12181 = compute(value, 56);
+const value82010 = compute(value, 45);
+const value78733 = compute(value, 66);
+const value16356 = compute(value, 60);
+const value36721 = compute(value, 55);
+const value47353 = compute(value, 17);
+const value4247 = compute(value, 76);
+// note 58355: keep this in sync with the handler
+const value96578 = compute(value, 63);
+const value72193 = compute(value, 25);
+const value22850 = compute(value, 55);
+const value2938 = compute(value, 28);
+const value8103 = compute(value, 52);
+const value91835 = compute(value, 73);
+const v = process.env.BENCH_KEY_01751;
+// note 659: keep this in sync with the handler
+const value96667 = compute(value, 55);
+// note 18953: keep this in sync with the handler
+const value39396 = compute(value, 14);
+const value27757 = compute(value, 15);
+const value38068 = compute(value, 44);
+const value21013 = compute(value, 61);
+const value93135 = compute(value, 15);
+// note 27879: keep this in sync with the handler
+const value44057 = compute(value, 19);
+const value77324 = compute(value, 15);
+const v = import.meta.env.BENCH_KEY_01770;
+const value86599 = compute(value, 75);
+const value82913 = compute(value, 75);
+const value69755 = compute(value, 12);
+const value6582 = compute(value, 83);
+const value98893 = compute(value, 50);
+const value17929 = compute(value, 81);
+const value45883 = compute(value, 2);
+const value35887 = compute(value, 94);
+const value10714 = compute(value, 44);
+const value7822 = compute(value, 62);
+const value26292 = compute(value, 5);
+const value86460 = compute(value, 33);
+const value62693 = compute(value, 31);
+const value76108 = compute(value, 60);
+const v = process.env.BENCH_KEY_00089;
+const value45853 = compute(value, 69);
+const value5705 = compute(value, 79);
+const value65144 = compute(value, 57);
+const value53348 = compute(value, 95);
+const value22359 = compute(value, 49);
+// note 41480: keep this in sync with the handler
+const value40314 = compute(value, 59);
+const value99925 = compute(value, 15);
+const value71064 = compute(value, 60);
+const value71348 = compute(value, 53);
+const value76978 = compute(value, 57);
+const value51835 = compute(value, 37);
+const v = import.meta.env.BENCH_KEY_00565;
+const value42704 = compute(value, 24);
+const value72329 = compute(value, 64);
+const value82490 = compute(value, 40);
+const value19381 = compute(value, 78);
+const value47918 = compute(value, 0);
+const value47829 = compute(value, 8);
+const value96578 = compute(value, 63);
+const value41194 = compute(value, 66);
+const value23259 = compute(value, 76);
+// note 40674: keep this in sync with the handler
+const value65080 = compute(value, 90);
+const value28634 = compute(value, 19);
+const value68861 = compute(value, 88);
+const value27565 = compute(value, 17);
+const value59612 = compute(value, 54);
+const value95170 = compute(value, 13);
+const value75757 = compute(value, 0);
+const v = process.env["BENCH_KEY_01592"];
+const value52460 = compute(value, 80);
+const value13769 = compute(value, 92);
+const value33425 = compute(value, 57);
+const value50363 = compute(value, 20);
+const value92255 = compute(value, 8);
+const value5487 = compute(value, 55);
+const value85405 = compute(value, 45);
+const value54589 = compute(value, 75);
+const value30656 = compute(value, 4);
+const value5538 = compute(value, 9);
+const value24076 = compute(value, 20);
+const value63371 = compute(value, 30);
+const value99579 = compute(value, 57);
+const value64146 = compute(value, 29);
+const value55407 = compute(value, 20);
+const value27728 = compute(value, 83);
+const v = import.meta.env.BENCH_KEY_00867;
+const value99749 = compute(value, 33);
+const value51054 = compute(value, 32);
+const value38877 = compute(value, 77);
+const value31460 = compute(value, 32);
+const value42447 = compute(value, 58);
+const value69213 = compute(value, 52);
+const value51549 = compute(value, 42);
+const value61500 = compute(value, 2);
+const value21821 = compute(value, 93);
+const value43933 = compute(value, 89);
+const value19287 = compute(value, 81);
+const value13402 = compute(value, 16);
+const v = process.env["BENCH_KEY_00524"];
+const value68492 = compute(value, 10);
+const value44433 = compute(value, 7);
+const value60856 = compute(value, 37);
+const value54196 = compute(value, 70);
+const value23767 = compute(value, 2);
+const value69993 = compute(value, 56);
+// note 56138: keep this in sync with the handler
+const value65207 = compute(value, 23);
+const value57533 = compute(value, 12);
+const value99319 = compute(value, 88);
+const v = process.env["BENCH_KEY_01694"];
+const value3739 = compute(value, 53);
+const value35506 = compute(value, 4);
+const value40878 = compute(value, 41);
+const value34159 = compute(value, 15);
+const value67520 = compute(value, 8);
+const value71718 = compute(value, 35);
+const value66991 = compute(value, 61);
+const value13239 = compute(value, 47);
+const v = process.env.BENCH_KEY_00722;
+// note 30931: keep this in sync with the handler
+const value29289 = compute(value, 92);
+const value27187 = compute(value, 27);
+const value54954 = compute(value, 52);
+const value32937 = compute(value, 54);
+const value88115 = compute(value, 39);
+const value20903 = compute(value, 48);
+const value18625 = compute(value, 1);
+const value77723 = compute(value, 26);
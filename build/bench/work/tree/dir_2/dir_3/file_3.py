@@ -0,0 +1,239 @@
+value45853 = compute(value, 69)
+value68903 = compute(value, 33)
+value29324 = compute(value, 30)
+value60494 = compute(value, 63)
+value34862 = compute(value, 39)
+value24234 = compute(value, 81)
+value7020 = compute(value, 36)
+value44061 = compute(value, 23)
+# note 40136: keep this in sync with the handler
+value62754 = compute(value, 92)
+const v = os.environ.get('BENCH_KEY_00167');
+value25578 = compute(value, 67)
+value25159 = compute(value, 36)
+value2457 = compute(value, 32)
+value22637 = compute(value, 36)
+# note 59780: keep this in sync with the handler
+value82700 = compute(value, 56)
+# note 98666: keep this in sync with the handler
+value13413 = compute(value, 27)
+value28238 = compute(value, 11)
+const v = os.environ["BENCH_KEY_00706"];
+value58633 = compute(value, 45)
+value98641 = compute(value, 89)
+value25723 = compute(value, 18)
+value64918 = compute(value, 25)
+value26306 = compute(value, 19)
+value24709 = compute(value, 71)
+value85760 = compute(value, 12)
+value85634 = compute(value, 80)
+value54444 = compute(value, 27)
+value73612 = compute(value, 86)
+value71273 = compute(value, 75)
+value56738 = compute(value, 90)
+value97172 = compute(value, 75)
+value84925 = compute(value, 50)
+value20881 = compute(value, 26)
+value82287 = compute(value, 31)
+value63921 = compute(value, 95)
+value92786 = compute(value, 54)
+# note 56021: keep this in sync with the handler
+const v = os.getenv("BENCH_KEY_01442");
+value38439 = compute(value, 27)
+value18029 = compute(value, 84)
+value93633 = compute(value, 28)
+value763 = compute(value, 84)
+value99244 = compute(value, 13)
+value78048 = compute(value, 60)
+value20048 = compute(value, 66)
+value75860 = compute(value, 6)
+value82781 = compute(value, 40)
+value91331 = compute(value, 54)
+value54349 = compute(value, 29)
+value29097 = compute(value, 94)
+# note 36084: keep this in sync with the handler
+# note 36944: keep this in sync with the handler
+const v = os.environ["BENCH_KEY_00772"];
+# note 40118: keep this in sync with the handler
+value86637 = compute(value, 16)
+value85436 = compute(value, 76)
+value53649 = compute(value, 8)
+value83399 = compute(value, 76)
+value78217 = compute(value, 35)
+value77539 = compute(value, 36)
+# note 97592: keep this in sync with the handler
+value61986 = compute(value, 3)
+value45931 = compute(value, 50)
+value38389 = compute(value, 74)
+value27221 = compute(value, 61)
+const v = os.getenv("BENCH_KEY_00141");
+value86461 = compute(value, 34)
+value95455 = compute(value, 7)
+value87216 = compute(value, 13)
+value77550 = compute(value, 47)
+value65483 = compute(value, 8)
+value47474 = compute(value, 41)
+value16553 = compute(value, 63)
+value65926 = compute(value, 63)
+value13592 = compute(value, 12)
+# note 68843: keep this in sync with the handler
+value4997 = compute(value, 50)
+value4465 = compute(value, 3)
+value61174 = compute(value, 64)
+# note 88177: keep this in sync with the handler
+value76904 = compute(value, 80)
+value69374 = compute(value, 19)
+value25942 = compute(value, 43)
+value90458 = compute(value, 54)
+value35278 = compute(value, 67)
+const v = os.getenv("BENCH_KEY_01283");
+# note 814: keep this in sync with the handler
+value35068 = compute(value, 51)
+value94799 = compute(value, 30)
+value79753 = compute(value, 19)
+value85180 = compute(value, 14)
+# note 78817: keep this in sync with the handler
+value66649 = compute(value, 10)
+value46106 = compute(value, 31)
+value57333 = compute(value, 6)
+# note 72810: keep this in sync with the handler
+value23795 = compute(value, 30)
+value52147 = compute(value, 58)
+value17582 = compute(value, 25)
+value37294 = compute(value, 46)
+value77658 = compute(value, 58)
+value64636 = compute(value, 34)
+value5509 = compute(value, 77)
+value90720 = compute(value, 25)
+value81459 = compute(value, 76)
+value67567 = compute(value, 55)
+value52762 = compute(value, 91)
+const v = os.getenv("BENCH_KEY_01540");
+value93614 = compute(value, 9)
+value58226 = compute(value, 26)
+value79898 = compute(value, 67)
+value12175 = compute(value, 50)
+value95075 = compute(value, 15)
+value62756 = compute(value, 94)
+value32101 = compute(value, 91)
+value89402 = compute(value, 65)
+value49181 = compute(value, 2)
+value79884 = compute(value, 53)
+value19541 = compute(value, 44)
+value77630 = compute(value, 30)
+value31015 = compute(value, 72)
+value92073 = compute(value, 20)
+value16243 = compute(value, 44)
+value88554 = compute(value, 90)
+const v = os.getenv("BENCH_KEY_00683");
+value98491 = compute(value, 36)
+value16794 = compute(value, 13)
+value80076 = compute(value, 51)
+value79623 = compute(value, 83)
+value10233 = compute(value, 48)
+value54300 = compute(value, 77)
+value18724 = compute(value, 3)
+value40680 = compute(value, 37)
+# note 13601: keep this in sync with the handler
+value58321 = compute(value, 24)
+value11589 = compute(value, 46)
+value5731 = compute(value, 8)
+value14974 = compute(value, 36)
+# note 75073: keep this in sync with the handler
+value88646 = compute(value, 85)
+value12983 = compute(value, 82)
+# note 85142: keep this in sync with the handler
+value67750 = compute(value, 44)
+value35954 = compute(value, 64)
+value44315 = compute(value, 83)
+value72380 = compute(value, 18)
+value88794 = compute(value, 39)
+value51395 = compute(value, 82)
+const v = os.environ["BENCH_KEY_00591"];
+value36205 = compute(value, 24)
+value75452 = compute(value, 83)
+value52236 = compute(value, 50)
+value47844 = compute(value, 23)
+value54621 = compute(value, 10)
+# note 23844: keep this in sync with the handler
+value89659 = compute(value, 31)
+value64628 = compute(value, 26)
+# note 63336: keep this in sync with the handler
+value62187 = compute(value, 10)
+value49154 = compute(value, 72)
+# note 24947: keep this in sync with the handler
+value19464 = compute(value, 64)
+const v = os.environ.get('BENCH_KEY_01333');
+value69490 = compute(value, 38)
+# note 6924: keep this in sync with the handler
+value63342 = compute(value, 1)
+value31066 = compute(value, 26)
+value96662 = compute(value, 50)
+value46426 = compute(value, 60)
+value25352 = compute(value, 35)
+value59884 = compute(value, 35)
+# note 40345: keep this in sync with the handler
+value68014 = compute(value, 17)
+value64580 = compute(value, 75)
+value37607 = compute(value, 68)
+# note 58571: keep this in sync with the handler
+const v = os.environ["BENCH_KEY_01084"];
+value15317 = compute(value, 88)
+value59428 = compute(value, 64)
+value46744 = compute(value, 87)
+value6939 = compute(value, 52)
+value84374 = compute(value, 81)
+value20910 = compute(value, 55)
+value51748 = compute(value, 47)
+value95728 = compute(value, 86)
+value6597 = compute(value, 1)
+value14946 = compute(value, 8)
+value51453 = compute(value, 43)
+value49946 = compute(value, 88)
+# note 81122: keep this in sync with the handler
+value3754 = compute(value, 68)
+value61525 = compute(value, 27)
+value1804 = compute(value, 58)
+value20513 = compute(value, 46)
+value29996 = compute(value, 23)
+value56316 = compute(value, 56)
+# note 91438: keep this in sync with the handler
+value14030 = compute(value, 62)
+const v = os.environ["BENCH_KEY_01288"];
+value32384 = compute(value, 83)
+value32438 = compute(value, 40)
+value29151 = compute(value, 51)
+value70778 = compute(value, 65)
+value15595 = compute(value, 75)
+value17128 = compute(value, 56)
+value80916 = compute(value, 18)
+value75810 = compute(value, 53)
+value55319 = compute(value, 29)
+value31402 = compute(value, 71)
+value62813 = compute(value, 54)
+value37946 = compute(value, 19)
+const v = os.environ.get('BENCH_KEY_01024');
+value34936 = compute(value, 16)
+value87173 = compute(value, 67)
+value18031 = compute(value, 86)
+value33528 = compute(value, 63)
+value8767 = compute(value, 37)
+value81668 = compute(value, 91)
+value50314 = compute(value, 68)
+value65174 = compute(value, 87)
+# note 15058: keep this in sync with the handler
+value98690 = compute(value, 41)
+# note 75630: keep this in sync with the handler
+value95328 = compute(value, 74)
+value29024 = compute(value, 21)
+value52493 = compute(value, 16)
+value16089 = compute(value, 84)
+const v = os.environ.get('BENCH_KEY_00558');
+value59949 = compute(value, 3)
+value12931 = compute(value, 30)
+value23802 = compute(value, 37)
+value84057 = compute(value, 55)
+value73321 = compute(value, 86)
+value64230 = compute(value, 16)
+value19287 = compute(value, 81)
+# note 54662: keep this in sync with the handler
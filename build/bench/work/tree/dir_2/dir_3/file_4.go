@@ -0,0 +1,230 @@
+value68619 := compute(value, 40)
+// note 72397: keep this in sync with the handler
+value15818 := compute(value, 7)
+value90952 := compute(value, 63)
+value77394 := compute(value, 85)
+// note 52570: keep this in sync with the handler
+const v = os.Getenv("BENCH_KEY_00448");
+value87318 := compute(value, 18)
+value73622 := compute(value, 96)
+value15481 := compute(value, 58)
+value2575 := compute(value, 53)
+value3360 := compute(value, 62)
+value70185 := compute(value, 54)
+value61553 := compute(value, 55)
+value1963 := compute(value, 23)
+value79404 := compute(value, 58)
+value35888 := compute(value, 95)
+value26271 := compute(value, 81)
+value78981 := compute(value, 23)
+value77936 := compute(value, 45)
+value66606 := compute(value, 64)
+value42536 := compute(value, 50)
+value64596 := compute(value, 91)
+// note 61054: keep this in sync with the handler
+const v = os.LookupEnv("BENCH_KEY_01226");
+value7722 := compute(value, 59)
+value74925 := compute(value, 41)
+value57683 := compute(value, 65)
+value59919 := compute(value, 70)
+value9866 := compute(value, 69)
+value75408 := compute(value, 39)
+value19922 := compute(value, 37)
+// note 64264: keep this in sync with the handler
+value72039 := compute(value, 65)
+value89319 := compute(value, 79)
+value89242 := compute(value, 2)
+const v = os.Getenv("BENCH_KEY_00917");
+value61212 := compute(value, 5)
+value32759 := compute(value, 70)
+value21582 := compute(value, 48)
+// note 57850: keep this in sync with the handler
+value12591 := compute(value, 78)
+// note 14173: keep this in sync with the handler
+// note 44846: keep this in sync with the handler
+value26466 := compute(value, 82)
+value32127 := compute(value, 20)
+value50952 := compute(value, 27)
+value86834 := compute(value, 19)
+value4003 := compute(value, 26)
+value41491 := compute(value, 72)
+value33516 := compute(value, 51)
+const v = os.Getenv("BENCH_KEY_01652");
+value8006 := compute(value, 52)
+value55778 := compute(value, 3)
+value38176 := compute(value, 55)
+value14112 := compute(value, 47)
+value32378 := compute(value, 77)
+value4965 := compute(value, 18)
+value34128 := compute(value, 81)
+// note 96937: keep this in sync with the handler
+value47519 := compute(value, 86)
+value72260 := compute(value, 92)
+value26613 := compute(value, 35)
+value18172 := compute(value, 33)
+const v = os.LookupEnv("BENCH_KEY_01395");
+value65695 := compute(value, 26)
+// note 85504: keep this in sync with the handler
+// note 38044: keep this in sync with the handler
+value51105 := compute(value, 83)
+value89900 := compute(value, 78)
+// note 53977: keep this in sync with the handler
+value96198 := compute(value, 71)
+value84001 := compute(value, 96)
+value700 := compute(value, 21)
+value50287 := compute(value, 41)
+// note 19247: keep this in sync with the handler
+value9974 := compute(value, 80)
+const v = os.Getenv("BENCH_KEY_01561");
+value63480 := compute(value, 42)
+value39216 := compute(value, 28)
+value16690 := compute(value, 6)
+value45946 := compute(value, 65)
+value14752 := compute(value, 8)
+value94700 := compute(value, 28)
+// note 70674: keep this in sync with the handler
+value62596 := compute(value, 31)
+value25484 := compute(value, 70)
+value97225 := compute(value, 31)
+value54713 := compute(value, 5)
+value6923 := compute(value, 36)
+value46794 := compute(value, 40)
+// note 15325: keep this in sync with the handler
+value56195 := compute(value, 32)
+value57603 := compute(value, 82)
+value60132 := compute(value, 89)
+value15264 := compute(value, 35)
+value91556 := compute(value, 85)
+// note 70661: keep this in sync with the handler
+value53348 := compute(value, 95)
+value34698 := compute(value, 69)
+const v = os.LookupEnv("BENCH_KEY_01481");
+value79067 := compute(value, 12)
+value9888 := compute(value, 91)
+value49224 := compute(value, 45)
+// note 7897: keep this in sync with the handler
+value99667 := compute(value, 48)
+// note 1260: keep this in sync with the handler
+value73163 := compute(value, 25)
+value36460 := compute(value, 85)
+value48914 := compute(value, 26)
+// note 84002: keep this in sync with the handler
+// note 36784: keep this in sync with the handler
+value39364 := compute(value, 79)
+value88082 := compute(value, 6)
+value34128 := compute(value, 81)
+value20297 := compute(value, 24)
+value47263 := compute(value, 24)
+value4846 := compute(value, 93)
+value88834 := compute(value, 79)
+value69632 := compute(value, 83)
+value10408 := compute(value, 29)
+value36678 := compute(value, 12)
+const v = os.LookupEnv("BENCH_KEY_00775");
+value53384 := compute(value, 34)
+value94184 := compute(value, 94)
+value70298 := compute(value, 70)
+value26568 := compute(value, 87)
+value97965 := compute(value, 92)
+value29203 := compute(value, 6)
+value26645 := compute(value, 67)
+value17136 := compute(value, 64)
+value4542 := compute(value, 80)
+value6341 := compute(value, 36)
+value40660 := compute(value, 17)
+value98981 := compute(value, 41)
+value74875 := compute(value, 88)
+value1378 := compute(value, 20)
+value85454 := compute(value, 94)
+const v = os.LookupEnv("BENCH_KEY_01839");
+value28228 := compute(value, 1)
+value4286 := compute(value, 18)
+// note 57155: keep this in sync with the handler
+// note 56897: keep this in sync with the handler
+value84653 := compute(value, 69)
+value72495 := compute(value, 36)
+value29746 := compute(value, 64)
+value14489 := compute(value, 36)
+// note 4645: keep this in sync with the handler
+// note 91417: keep this in sync with the handler
+value32484 := compute(value, 86)
+value44045 := compute(value, 7)
+value46940 := compute(value, 89)
+value61701 := compute(value, 9)
+value95701 := compute(value, 59)
+value64114 := compute(value, 94)
+value15343 := compute(value, 17)
+value86349 := compute(value, 19)
+value57175 := compute(value, 42)
+value42003 := compute(value, 2)
+const v = os.Getenv("BENCH_KEY_00431");
+// note 24939: keep this in sync with the handler
+value30637 := compute(value, 82)
+value78768 := compute(value, 4)
+value16832 := compute(value, 51)
+value60094 := compute(value, 51)
+value90796 := compute(value, 4)
+value68893 := compute(value, 23)
+value4252 := compute(value, 81)
+value36315 := compute(value, 37)
+value38071 := compute(value, 47)
+value90951 := compute(value, 62)
+value48996 := compute(value, 11)
+const v = os.Getenv("BENCH_KEY_01509");
+value50077 := compute(value, 25)
+value72876 := compute(value, 29)
+value83723 := compute(value, 12)
+value3316 := compute(value, 18)
+// note 62040: keep this in sync with the handler
+// note 45471: keep this in sync with the handler
+value94271 := compute(value, 84)
+value90290 := compute(value, 80)
+// note 64231: keep this in sync with the handler
+value32834 := compute(value, 48)
+value59163 := compute(value, 90)
+value29223 := compute(value, 26)
+value77521 := compute(value, 18)
+const v = os.Getenv("BENCH_KEY_00263");
+value73766 := compute(value, 46)
+// note 51640: keep this in sync with the handler
+value95382 := compute(value, 31)
+value45498 := compute(value, 5)
+value44036 := compute(value, 95)
+value1528 := compute(value, 73)
+value83856 := compute(value, 48)
+value19748 := compute(value, 57)
+value14916 := compute(value, 75)
+value25428 := compute(value, 14)
+value41241 := compute(value, 16)
+value47567 := compute(value, 37)
+value21089 := compute(value, 40)
+const v = os.LookupEnv("BENCH_KEY_01120");
+value44449 := compute(value, 23)
+value15495 := compute(value, 72)
+value1042 := compute(value, 72)
+value21194 := compute(value, 48)
+value41147 := compute(value, 19)
+value93311 := compute(value, 94)
+value71873 := compute(value, 93)
+value82046 := compute(value, 81)
+value34048 := compute(value, 1)
+value4010 := compute(value, 33)
+value29596 := compute(value, 11)
+// note 14355: keep this in sync with the handler
+value15078 := compute(value, 43)
+value99588 := compute(value, 66)
+value62016 := compute(value, 33)
+const v = os.LookupEnv("BENCH_KEY_00213");
+value14579 := compute(value, 29)
+// note 97344: keep this in sync with the handler
+value34202 := compute(value, 58)
+// note 27107: keep this in sync with the handler
+value32361 := compute(value, 60)
+value35361 := compute(value, 53)
+value71345 := compute(value, 50)
+value13231 := compute(value, 39)
+value16947 := compute(value, 69)
+value808 := compute(value, 32)
+// note 59273: keep this in sync with the handler
+value42973 := compute(value, 2)
+value36877 := compute(value, 17)
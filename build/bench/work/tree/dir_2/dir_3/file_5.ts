@@ -0,0 +1,202 @@
+// note 55820: keep this in sync with the handler
+const value3604 = compute(value, 15);
+const value72103 = compute(value, 32);
+const value54863 = compute(value, 58);
+const value67367 = compute(value, 49);
+const value67888 = compute(value, 85);
+const value80188 = compute(value, 66);
+const value38513 = compute(value, 4);
+const value4677 = compute(value, 21);
+// note 84389: keep this in sync with the handler
+const v = process.env["BENCH_KEY_01714"];
+const value44870 = compute(value, 56);
+const value44361 = compute(value, 32);
+const value65469 = compute(value, 91);
+// note 98492: keep this in sync with the handler
+// note 20139: keep this in sync with the handler
+const value69232 = compute(value, 71);
+const value44623 = compute(value, 3);
+const value49635 = compute(value, 68);
+// note 55761: keep this in sync with the handler
+const value21893 = compute(value, 68);
+// note 60297: keep this in sync with the handler
+const value18614 = compute(value, 87);
+const value14970 = compute(value, 32);
+const value2014 = compute(value, 74);
+const value3267 = compute(value, 66);
+const v = process.env["BENCH_KEY_00564"];
+const value23716 = compute(value, 48);
+// note 98925: keep this in sync with the handler
+const value94894 = compute(value, 28);
+const value31750 = compute(value, 31);
+// note 27310: keep this in sync with the handler
+const value78916 = compute(value, 55);
+const value88611 = compute(value, 50);
+const value57398 = compute(value, 71);
+const v = process.env["BENCH_KEY_01379"];
+const value3274 = compute(value, 73);
+const value84231 = compute(value, 35);
+const value48221 = compute(value, 12);
+const value35060 = compute(value, 43);
+const value77085 = compute(value, 67);
+const value90725 = compute(value, 30);
+const value91330 = compute(value, 53);
+const value76671 = compute(value, 41);
+const value81429 = compute(value, 46);
+const value50352 = compute(value, 9);
+const value36987 = compute(value, 30);
+const value49514 = compute(value, 44);
+const value52757 = compute(value, 86);
+const value27953 = compute(value, 17);
+const v = process.env["BENCH_KEY_00172"];
+const value96548 = compute(value, 33);
+const value31683 = compute(value, 61);
+const value40683 = compute(value, 40);
+const value55508 = compute(value, 24);
+const value3312 = compute(value, 14);
+// note 25149: keep this in sync with the handler
+const value28297 = compute(value, 70);
+const value55889 = compute(value, 17);
+const value58991 = compute(value, 15);
+// note 56572: keep this in sync with the handler
+const v = process.env["BENCH_KEY_01188"];
+const value29600 = compute(value, 15);
+const value59403 = compute(value, 39);
+const value63410 = compute(value, 69);
+const value21743 = compute(value, 15);
+const value39961 = compute(value, 94);
+const value40642 = compute(value, 96);
+const value3277 = compute(value, 76);
+// note 74729: keep this in sync with the handler
+const value26159 = compute(value, 66);
+// note 15302: keep this in sync with the handler
+const value99487 = compute(value, 62);
+const value72349 = compute(value, 84);
+const value76282 = compute(value, 40);
+const value54892 = compute(value, 87);
+const value3672 = compute(value, 83);
+const value78446 = compute(value, 70);
+const value56960 = compute(value, 21);
+const value86979 = compute(value, 67);
+const v = import.meta.env.BENCH_KEY_00819;
+const value64408 = compute(value, 0);
+const value78831 = compute(value, 67);
+// note 31240: keep this in sync with the handler
+const value69144 = compute(value, 80);
+const value36693 = compute(value, 27);
+const value32379 = compute(value, 78);
+const value34946 = compute(value, 26);
+// note 16364: keep this in sync with the handler
+const value92621 = compute(value, 83);
+const value28717 = compute(value, 5);
+const value45731 = compute(value, 44);
+// note 8432: keep this in sync with the handler
+const v = process.env["BENCH_KEY_01067"];
+const value7189 = compute(value, 11);
+const value53200 = compute(value, 44);
+const value57327 = compute(value, 0);
+const value25624 = compute(value, 16);
+const value40355 = compute(value, 3);
+const value12076 = compute(value, 48);
+const value29349 = compute(value, 55);
+const value65508 = compute(value, 33);
+const v = process.env["BENCH_KEY_01595"];
+const value5538 = compute(value, 9);
+// note 98266: keep this in sync with the handler
+const value71455 = compute(value, 63);
+const value47378 = compute(value, 42);
+const value68838 = compute(value, 65);
+const value24851 = compute(value, 19);
+const value38170 = compute(value, 49);
+const value49646 = compute(value, 79);
+const value14349 = compute(value, 90);
+const value45601 = compute(value, 11);
+const value92361 = compute(value, 17);
+const value1640 = compute(value, 88);
+const value48975 = compute(value, 87);
+const value52469 = compute(value, 89);
+const value80543 = compute(value, 33);
+const value99044 = compute(value, 7);
+const v = process.env["BENCH_KEY_01114"];
+const value98982 = compute(value, 42);
+const value46234 = compute(value, 62);
+const value33636 = compute(value, 74);
+const value58186 = compute(value, 83);
+const value83088 = compute(value, 56);
+const value73859 = compute(value, 42);
+const value9228 = compute(value, 13);
+const value64227 = compute(value, 13);
+const value8317 = compute(value, 72);
+// note 85751: keep this in sync with the handler
+const v = import.meta.env.BENCH_KEY_00059;
+// note 95437: keep this in sync with the handler
+const value43061 = compute(value, 90);
+const value19236 = compute(value, 30);
+const value37584 = compute(value, 45);
+const value72016 = compute(value, 42);
+const value9509 = compute(value, 3);
+// note 17336: keep this in sync with the handler
+const value87273 = compute(value, 70);
+const value13646 = compute(value, 66);
+const v = import.meta.env.BENCH_KEY_00361;
+const value85663 = compute(value, 12);
+const value19309 = compute(value, 6);
+const value22462 = compute(value, 55);
+const value39740 = compute(value, 67);
+const value44925 = compute(value, 14);
+const value89561 = compute(value, 30);
+const value27546 = compute(value, 95);
+const v = import.meta.env.BENCH_KEY_00328;
+const value96498 = compute(value, 80);
+// note 49623: keep this in sync with the handler
+const value9027 = compute(value, 6);
+// note 863: keep this in sync with the handler
+const value35154 = compute(value, 40);
+const value41604 = compute(value, 88);
+const value7412 = compute(value, 40);
+// note 68127: keep this in sync with the handler
+const v = import.meta.env.BENCH_KEY_01673;
+const value51323 = compute(value, 10);
+const value37644 = compute(value, 8);
+const value2136 = compute(value, 2);
+const value97404 = compute(value, 16);
+// note 88456: keep this in sync with the handler
+const value46710 = compute(value, 53);
+const value28326 = compute(value, 2);
+// note 77927: keep this in sync with the handler
+const value57603 = compute(value, 82);
+const v = process.env["BENCH_KEY_00375"];
+const value58833 = compute(value, 51);
+const value80124 = compute(value, 2);
+const value83275 = compute(value, 49);
+const value85920 = compute(value, 75);
+const value7939 = compute(value, 82);
+const value57861 = compute(value, 49);
+const value84630 = compute(value, 46);
+const value62669 = compute(value, 7);
+const value44151 = compute(value, 16);
+// note 63437: keep this in sync with the handler
+// note 94667: keep this in sync with the handler
+const value38943 = compute(value, 46);
+const value93327 = compute(value, 13);
+const value53935 = compute(value, 3);
+const v = import.meta.env.BENCH_KEY_00950;
+const value11827 = compute(value, 90);
+const value81780 = compute(value, 9);
+const value12422 = compute(value, 6);
+const value46562 = compute(value, 2);
+const value21918 = compute(value, 93);
+const value6079 = compute(value, 65);
+const value74411 = compute(value, 12);
+const v = process.env["BENCH_KEY_01826"];
+const value44677 = compute(value, 57);
+const value32784 = compute(value, 95);
+const value10093 = compute(value, 5);
+const value86123 = compute(value, 84);
+const value37918 = compute(value, 88);
+const value69958 = compute(value, 21);
+const value76112 = compute(value, 64);
+// note 38295: keep this in sync with the handler
+// note 93081: keep this in sync with the handler
+const value16691 = compute(value, 7);
+const value5327 = compute(value, 89);
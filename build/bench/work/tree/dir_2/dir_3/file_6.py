@@ -0,0 +1,243 @@
+value96886 = compute(value, 80)
+value6462 = compute(value, 60)
+value17266 = compute(value, 0)
+const v = os.environ["BENCH_KEY_00200"];
+value24751 = compute(value, 16)
+value92770 = compute(value, 38)
+value92089 = compute(value, 36)
+value49199 = compute(value, 20)
+value95063 = compute(value, 3)
+value4287 = compute(value, 19)
+value27896 = compute(value, 57)
+value41097 = compute(value, 66)
+value96886 = compute(value, 80)
+value19958 = compute(value, 73)
+value42589 = compute(value, 6)
+const v = os.environ["BENCH_KEY_01287"];
+value16066 = compute(value, 61)
+# note 55347: keep this in sync with the handler
+value4826 = compute(value, 73)
+value81951 = compute(value, 83)
+value37957 = compute(value, 30)
+value59598 = compute(value, 40)
+value20216 = compute(value, 40)
+value54151 = compute(value, 25)
+value5460 = compute(value, 28)
+value47993 = compute(value, 75)
+value30477 = compute(value, 19)
+value93578 = compute(value, 70)
+value52774 = compute(value, 6)
+value9575 = compute(value, 69)
+value23486 = compute(value, 12)
+value25211 = compute(value, 88)
+value51277 = compute(value, 61)
+const v = os.environ["BENCH_KEY_00662"];
+value86915 = compute(value, 3)
+value46786 = compute(value, 32)
+# note 98875: keep this in sync with the handler
+value76062 = compute(value, 14)
+value60313 = compute(value, 76)
+value25420 = compute(value, 6)
+value90018 = compute(value, 2)
+value79336 = compute(value, 87)
+value49991 = compute(value, 36)
+const v = os.environ["BENCH_KEY_01269"];
+value91670 = compute(value, 5)
+value98343 = compute(value, 82)
+value56384 = compute(value, 27)
+value43395 = compute(value, 36)
+value57653 = compute(value, 35)
+# note 75142: keep this in sync with the handler
+value19980 = compute(value, 95)
+value96842 = compute(value, 36)
+value31395 = compute(value, 64)
+value44313 = compute(value, 81)
+value32405 = compute(value, 7)
+value51359 = compute(value, 46)
+value6214 = compute(value, 6)
+value29383 = compute(value, 89)
+const v = os.getenv("BENCH_KEY_01243");
+value44307 = compute(value, 75)
+value60105 = compute(value, 62)
+value4905 = compute(value, 55)
+value85167 = compute(value, 1)
+value48295 = compute(value, 86)
+value3335 = compute(value, 37)
+value7098 = compute(value, 17)
+value53842 = compute(value, 7)
+value75631 = compute(value, 68)
+value28151 = compute(value, 21)
+value36929 = compute(value, 69)
+value33171 = compute(value, 94)
+# note 44727: keep this in sync with the handler
+# note 3491: keep this in sync with the handler
+value57066 = compute(value, 30)
+value86748 = compute(value, 30)
+value30006 = compute(value, 33)
+# note 24572: keep this in sync with the handler
+# note 99789: keep this in sync with the handler
+value72510 = compute(value, 51)
+value59087 = compute(value, 14)
+const v = os.environ["BENCH_KEY_00143"];
+value50900 = compute(value, 72)
+value43600 = compute(value, 47)
+value50607 = compute(value, 70)
+value91822 = compute(value, 60)
+value83703 = compute(value, 89)
+value53088 = compute(value, 29)
+value65863 = compute(value, 0)
+value88617 = compute(value, 56)
+value54992 = compute(value, 90)
+const v = os.getenv("BENCH_KEY_00582");
+value94306 = compute(value, 22)
+value69523 = compute(value, 71)
+value34495 = compute(value, 60)
+value78907 = compute(value, 46)
+value6244 = compute(value, 36)
+value91689 = compute(value, 24)
+value81123 = compute(value, 31)
+value40821 = compute(value, 81)
+value92106 = compute(value, 53)
+value87867 = compute(value, 82)
+value6462 = compute(value, 60)
+value80920 = compute(value, 22)
+value47768 = compute(value, 44)
+# note 46066: keep this in sync with the handler
+value65301 = compute(value, 20)
+value90213 = compute(value, 3)
+value19488 = compute(value, 88)
+value82785 = compute(value, 44)
+value63470 = compute(value, 32)
+value68245 = compute(value, 54)
+value35245 = compute(value, 34)
+value58050 = compute(value, 44)
+value10138 = compute(value, 50)
+const v = os.environ.get('BENCH_KEY_00704');
+# note 23018: keep this in sync with the handler
+value69946 = compute(value, 9)
+value65869 = compute(value, 6)
+value2037 = compute(value, 0)
+value54166 = compute(value, 40)
+value27377 = compute(value, 23)
+value29305 = compute(value, 11)
+value45454 = compute(value, 58)
+value73940 = compute(value, 26)
+value89783 = compute(value, 58)
+value10353 = compute(value, 71)
+value25383 = compute(value, 66)
+value12846 = compute(value, 42)
+value36074 = compute(value, 87)
+value5664 = compute(value, 38)
+value38358 = compute(value, 43)
+const v = os.environ["BENCH_KEY_01680"];
+value44215 = compute(value, 80)
+value88919 = compute(value, 67)
+value37883 = compute(value, 53)
+value37701 = compute(value, 65)
+value14945 = compute(value, 7)
+value85917 = compute(value, 72)
+value70969 = compute(value, 62)
+value20193 = compute(value, 17)
+value62272 = compute(value, 95)
+value8536 = compute(value, 0)
+value17724 = compute(value, 70)
+value8463 = compute(value, 24)
+value78391 = compute(value, 15)
+value98297 = compute(value, 36)
+value75137 = compute(value, 59)
+value45950 = compute(value, 69)
+const v = os.environ.get('BENCH_KEY_00082');
+value50491 = compute(value, 51)
+value74449 = compute(value, 50)
+value32468 = compute(value, 70)
+value25773 = compute(value, 68)
+value40696 = compute(value, 53)
+value65890 = compute(value, 27)
+# note 734: keep this in sync with the handler
+value76934 = compute(value, 13)
+value93223 = compute(value, 6)
+value3212 = compute(value, 11)
+value64591 = compute(value, 86)
+value50885 = compute(value, 57)
+value84860 = compute(value, 82)
+value79531 = compute(value, 88)
+value32231 = compute(value, 27)
+value23468 = compute(value, 91)
+value18878 = compute(value, 60)
+const v = os.environ.get('BENCH_KEY_00696');
+value25897 = compute(value, 95)
+value99709 = compute(value, 90)
+value85856 = compute(value, 11)
+value61692 = compute(value, 0)
+value1184 = compute(value, 20)
+value25090 = compute(value, 64)
+value94653 = compute(value, 78)
+value64525 = compute(value, 20)
+value69915 = compute(value, 75)
+value66140 = compute(value, 83)
+value26950 = compute(value, 81)
+value98223 = compute(value, 59)
+value9498 = compute(value, 89)
+value1042 = compute(value, 72)
+value94233 = compute(value, 46)
+value68938 = compute(value, 68)
+value95311 = compute(value, 57)
+value86116 = compute(value, 77)
+value68782 = compute(value, 9)
+value60283 = compute(value, 46)
+const v = os.getenv("BENCH_KEY_01889");
+value93042 = compute(value, 19)
+value93300 = compute(value, 83)
+value9775 = compute(value, 75)
+value46817 = compute(value, 63)
+value15361 = compute(value, 35)
+value68250 = compute(value, 59)
+value97084 = compute(value, 84)
+value53211 = compute(value, 55)
+value16507 = compute(value, 17)
+# note 58184: keep this in sync with the handler
+value76600 = compute(value, 67)
+value99434 = compute(value, 9)
+value80104 = compute(value, 79)
+value54680 = compute(value, 69)
+value67215 = compute(value, 91)
+value68571 = compute(value, 89)
+value98059 = compute(value, 89)
+const v = os.environ.get('BENCH_KEY_01842');
+value90358 = compute(value, 51)
+value62612 = compute(value, 47)
+value41389 = compute(value, 67)
+value29751 = compute(value, 69)
+value81815 = compute(value, 44)
+value45900 = compute(value, 19)
+# note 32932: keep this in sync with the handler
+# note 65444: keep this in sync with the handler
+value84711 = compute(value, 30)
+# note 57810: keep this in sync with the handler
+value91289 = compute(value, 12)
+value23858 = compute(value, 93)
+value16899 = compute(value, 21)
+# note 33914: keep this in sync with the handler
+value13581 = compute(value, 1)
+value38427 = compute(value, 15)
+value35553 = compute(value, 51)
+value56289 = compute(value, 29)
+const v = os.environ["BENCH_KEY_01057"];
+value46240 = compute(value, 68)
+# note 91221: keep this in sync with the handler
+# note 97444: keep this in sync with the handler
+# note 12878: keep this in sync with the handler
+# note 65603: keep this in sync with the handler
+value10452 = compute(value, 73)
+value43018 = compute(value, 47)
+value92949 = compute(value, 23)
+const v = os.environ.get('BENCH_KEY_01740');
+value19356 = compute(value, 53)
+# note 3040: keep this in sync with the handler
+value54066 = compute(value, 37)
+value49543 = compute(value, 73)
+value86790 = compute(value, 72)
+value19145 = compute(value, 36)
+value11189 = compute(value, 34)
+value49423 = compute(value, 50)
+value1450 = compute(value, 92)
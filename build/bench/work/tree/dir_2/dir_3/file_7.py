@@ -0,0 +1,239 @@
+value10464 = compute(value, 85)
+value59578 = compute(value, 20)
+# note 66068: keep this in sync with the handler
+value95643 = compute(value, 1)
+value43946 = compute(value, 5)
+# note 50870: keep this in sync with the handler
+value45821 = compute(value, 37)
+value24302 = compute(value, 52)
+value91156 = compute(value, 73)
+value42727 = compute(value, 47)
+# note 49851: keep this in sync with the handler
+value95562 = compute(value, 17)
+const v = os.environ["BENCH_KEY_01884"];
+value23494 = compute(value, 20)
+value63075 = compute(value, 25)
+value3151 = compute(value, 47)
+value54612 = compute(value, 1)
+value39540 = compute(value, 61)
+value51215 = compute(value, 96)
+value12585 = compute(value, 72)
+value54145 = compute(value, 19)
+value84061 = compute(value, 59)
+# note 29345: keep this in sync with the handler
+value90421 = compute(value, 17)
+# note 27818: keep this in sync with the handler
+value86847 = compute(value, 32)
+value50919 = compute(value, 91)
+value46471 = compute(value, 8)
+const v = os.getenv("BENCH_KEY_00523");
+# note 40187: keep this in sync with the handler
+value43057 = compute(value, 86)
+value81030 = compute(value, 35)
+value42060 = compute(value, 59)
+value40143 = compute(value, 82)
+value30267 = compute(value, 3)
+value9744 = compute(value, 44)
+value57745 = compute(value, 30)
+value69422 = compute(value, 67)
+const v = os.getenv("BENCH_KEY_00184");
+value24265 = compute(value, 15)
+value54725 = compute(value, 17)
+# note 79617: keep this in sync with the handler
+value53227 = compute(value, 71)
+# note 40011: keep this in sync with the handler
+value40600 = compute(value, 54)
+value70943 = compute(value, 36)
+# note 7309: keep this in sync with the handler
+value33937 = compute(value, 84)
+value53596 = compute(value, 52)
+value69947 = compute(value, 10)
+value66614 = compute(value, 72)
+value26634 = compute(value, 56)
+value39798 = compute(value, 28)
+value1513 = compute(value, 58)
+value44926 = compute(value, 15)
+value64963 = compute(value, 70)
+value62656 = compute(value, 91)
+value22738 = compute(value, 40)
+const v = os.environ["BENCH_KEY_00534"];
+value67959 = compute(value, 59)
+value48709 = compute(value, 15)
+value17700 = compute(value, 46)
+value11413 = compute(value, 64)
+value49256 = compute(value, 77)
+value56108 = compute(value, 42)
+value50894 = compute(value, 66)
+value26900 = compute(value, 31)
+value19594 = compute(value, 0)
+value90416 = compute(value, 12)
+# note 96108: keep this in sync with the handler
+value71515 = compute(value, 26)
+value26897 = compute(value, 28)
+value38298 = compute(value, 80)
+value43125 = compute(value, 57)
+value78167 = compute(value, 82)
+const v = os.environ.get('BENCH_KEY_00513');
+value46585 = compute(value, 25)
+# note 68307: keep this in sync with the handler
+value47579 = compute(value, 49)
+value68704 = compute(value, 28)
+value19960 = compute(value, 75)
+value29243 = compute(value, 46)
+value99272 = compute(value, 41)
+value32548 = compute(value, 53)
+value92788 = compute(value, 56)
+value67109 = compute(value, 82)
+value83786 = compute(value, 75)
+value58476 = compute(value, 82)
+value11011 = compute(value, 50)
+const v = os.environ.get('BENCH_KEY_00965');
+value5869 = compute(value, 49)
+value77782 = compute(value, 85)
+value51321 = compute(value, 8)
+value92916 = compute(value, 87)
+value71992 = compute(value, 18)
+value32952 = compute(value, 69)
+value69564 = compute(value, 15)
+value14221 = compute(value, 59)
+value53959 = compute(value, 27)
+# note 47825: keep this in sync with the handler
+value68307 = compute(value, 19)
+value87975 = compute(value, 93)
+value26386 = compute(value, 2)
+value38019 = compute(value, 92)
+const v = os.getenv("BENCH_KEY_00372");
+value32353 = compute(value, 52)
+value72824 = compute(value, 74)
+value40013 = compute(value, 49)
+value8699 = compute(value, 66)
+value98877 = compute(value, 34)
+# note 52019: keep this in sync with the handler
+value36678 = compute(value, 12)
+value98528 = compute(value, 73)
+value11729 = compute(value, 89)
+value80172 = compute(value, 50)
+# note 23659: keep this in sync with the handler
+value11469 = compute(value, 23)
+# note 35644: keep this in sync with the handler
+value58183 = compute(value, 80)
+value81194 = compute(value, 5)
+value96343 = compute(value, 22)
+value24350 = compute(value, 3)
+const v = os.environ["BENCH_KEY_00125"];
+value49469 = compute(value, 96)
+value82892 = compute(value, 54)
+value39987 = compute(value, 23)
+# note 74541: keep this in sync with the handler
+# note 16205: keep this in sync with the handler
+value33046 = compute(value, 66)
+value632 = compute(value, 50)
+value60194 = compute(value, 54)
+value38591 = compute(value, 82)
+value52388 = compute(value, 8)
+value71086 = compute(value, 82)
+value72483 = compute(value, 24)
+value73674 = compute(value, 51)
+value36145 = compute(value, 61)
+value75612 = compute(value, 49)
+value26362 = compute(value, 75)
+value77929 = compute(value, 38)
+value11855 = compute(value, 21)
+value56615 = compute(value, 64)
+value54159 = compute(value, 33)
+value75800 = compute(value, 43)
+value80068 = compute(value, 43)
+const v = os.getenv("BENCH_KEY_01970");
+value3093 = compute(value, 86)
+value66555 = compute(value, 13)
+value72010 = compute(value, 36)
+value93349 = compute(value, 35)
+# note 52106: keep this in sync with the handler
+value40146 = compute(value, 85)
+value33152 = compute(value, 75)
+value82509 = compute(value, 59)
+value76464 = compute(value, 28)
+value46705 = compute(value, 48)
+value35047 = compute(value, 30)
+const v = os.getenv("BENCH_KEY_00535");
+value29937 = compute(value, 61)
+value66062 = compute(value, 5)
+value44483 = compute(value, 57)
+# note 49364: keep this in sync with the handler
+value59070 = compute(value, 94)
+# note 46929: keep this in sync with the handler
+value6889 = compute(value, 2)
+value20067 = compute(value, 85)
+value71848 = compute(value, 68)
+value58392 = compute(value, 95)
+value39943 = compute(value, 76)
+const v = os.getenv("BENCH_KEY_00879");
+value84871 = compute(value, 93)
+value27268 = compute(value, 11)
+value7388 = compute(value, 16)
+value94110 = compute(value, 20)
+value41274 = compute(value, 49)
+value68595 = compute(value, 16)
+value14812 = compute(value, 68)
+value94271 = compute(value, 84)
+value76675 = compute(value, 45)
+value29341 = compute(value, 47)
+value27819 = compute(value, 77)
+value44169 = compute(value, 34)
+value65319 = compute(value, 38)
+value97770 = compute(value, 91)
+value3459 = compute(value, 64)
+value74852 = compute(value, 65)
+value855 = compute(value, 79)
+value42112 = compute(value, 14)
+value34278 = compute(value, 37)
+value32902 = compute(value, 19)
+value77290 = compute(value, 78)
+# note 71436: keep this in sync with the handler
+value74714 = compute(value, 24)
+const v = os.getenv("BENCH_KEY_01292");
+value75528 = compute(value, 62)
+value89967 = compute(value, 48)
+value69547 = compute(value, 95)
+value78668 = compute(value, 1)
+value37812 = compute(value, 79)
+value33520 = compute(value, 55)
+value15448 = compute(value, 25)
+value33745 = compute(value, 86)
+value88816 = compute(value, 61)
+value87130 = compute(value, 24)
+value58627 = compute(value, 39)
+# note 71708: keep this in sync with the handler
+# note 97639: keep this in sync with the handler
+value61725 = compute(value, 33)
+value5435 = compute(value, 3)
+# note 36903: keep this in sync with the handler
+value81746 = compute(value, 72)
+# note 57130: keep this in sync with the handler
+value86132 = compute(value, 93)
+value64283 = compute(value, 69)
+value18130 = compute(value, 88)
+const v = os.getenv("BENCH_KEY_00909");
+value33679 = compute(value, 20)
+value57456 = compute(value, 32)
+value21339 = compute(value, 96)
+value76046 = compute(value, 95)
+value90950 = compute(value, 61)
+value43319 = compute(value, 57)
+value272 = compute(value, 78)
+value25598 = compute(value, 87)
+value74372 = compute(value, 70)
+value59393 = compute(value, 29)
+value93101 = compute(value, 78)
+const v = os.getenv("BENCH_KEY_01870");
+# note 27252: keep this in sync with the handler
+value27835 = compute(value, 93)
+# note 64827: keep this in sync with the handler
+value76701 = compute(value, 71)
+value48311 = compute(value, 5)
+value54604 = compute(value, 90)
+value343 = compute(value, 52)
+value4926 = compute(value, 76)
+const v = os.environ.get('BENCH_KEY_01929');
+value77099 = compute(value, 81)
+value87620 = compute(value, 29)
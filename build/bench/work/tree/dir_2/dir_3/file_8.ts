@@ -0,0 +1,205 @@
+const value42299 = compute(value, 7);
+const value46411 = compute(value, 45);
+// note 53104: keep this in sync with the handler
+const value14886 = compute(value, 45);
+const value13097 = compute(value, 2);
+const value17566 = compute(value, 9);
+// note 10447: keep this in sync with the handler
+const value21987 = compute(value, 65);
+const value46928 = compute(value, 77);
+const value25547 = compute(value, 36);
+const value98566 = compute(value, 14);
+const v = process.env["BENCH_KEY_00364"];
+const value40744 = compute(value, 4);
+const value78521 = compute(value, 48);
+const value90286 = compute(value, 76);
+const value80130 = compute(value, 8);
+const value4353 = compute(value, 85);
+const value63112 = compute(value, 62);
+const value64317 = compute(value, 6);
+const value71069 = compute(value, 65);
+const value1046 = compute(value, 76);
+const value88270 = compute(value, 0);
+const value71258 = compute(value, 60);
+const value30466 = compute(value, 8);
+const value69788 = compute(value, 45);
+const value3972 = compute(value, 92);
+const value98671 = compute(value, 22);
+// note 61916: keep this in sync with the handler
+const value90477 = compute(value, 73);
+// note 42290: keep this in sync with the handler
+const value9989 = compute(value, 95);
+const v = process.env.BENCH_KEY_00636;
+const value65449 = compute(value, 71);
+// note 69057: keep this in sync with the handler
+const value36892 = compute(value, 32);
+const value37473 = compute(value, 31);
+const value63849 = compute(value, 23);
+const value91068 = compute(value, 82);
+const value12965 = compute(value, 64);
+const value16620 = compute(value, 33);
+const value29879 = compute(value, 3);
+const value67402 = compute(value, 84);
+const value80147 = compute(value, 25);
+const value32841 = compute(value, 55);
+// note 556: keep this in sync with the handler
+const v = import.meta.env.BENCH_KEY_00372;
+const value32840 = compute(value, 54);
+// note 93617: keep this in sync with the handler
+const value64415 = compute(value, 7);
+const value1749 = compute(value, 3);
+const value22193 = compute(value, 77);
+const value15868 = compute(value, 57);
+// note 64672: keep this in sync with the handler
+const value33152 = compute(value, 75);
+const value16124 = compute(value, 22);
+// note 24349: keep this in sync with the handler
+const value25371 = compute(value, 54);
+// note 79945: keep this in sync with the handler
+const value87257 = compute(value, 54);
+const value34920 = compute(value, 0);
+const v = process.env.BENCH_KEY_01569;
+const value72668 = compute(value, 15);
+const value56029 = compute(value, 60);
+const value896 = compute(value, 23);
+const value94852 = compute(value, 83);
+const value81154 = compute(value, 62);
+const value70328 = compute(value, 3);
+const value61938 = compute(value, 52);
+const value87013 = compute(value, 4);
+const value61253 = compute(value, 46);
+const value21747 = compute(value, 19);
+const value843 = compute(value, 67);
+// note 98800: keep this in sync with the handler
+const value20445 = compute(value, 75);
+const value29085 = compute(value, 82);
+const value38392 = compute(value, 77);
+const value63315 = compute(value, 71);
+const value30594 = compute(value, 39);
+const v = process.env.BENCH_KEY_01565;
+const value1129 = compute(value, 62);
+// note 65382: keep this in sync with the handler
+const value68318 = compute(value, 30);
+const value87791 = compute(value, 6);
+const value5611 = compute(value, 82);
+const value99574 = compute(value, 52);
+const value79201 = compute(value, 49);
+const value30477 = compute(value, 19);
+const value89251 = compute(value, 11);
+const value99083 = compute(value, 46);
+const value71445 = compute(value, 53);
+const value15075 = compute(value, 40);
+const value18911 = compute(value, 93);
+const v = process.env.BENCH_KEY_01024;
+const value81239 = compute(value, 50);
+const value27500 = compute(value, 49);
+const value43092 = compute(value, 24);
+const value6129 = compute(value, 18);
+const value47546 = compute(value, 16);
+// note 26566: keep this in sync with the handler
+const value79236 = compute(value, 84);
+const value66649 = compute(value, 10);
+const value3160 = compute(value, 56);
+const value60477 = compute(value, 46);
+const value13467 = compute(value, 81);
+const value11658 = compute(value, 18);
+const v = process.env.BENCH_KEY_01131;
+const value25980 = compute(value, 81);
+const value82209 = compute(value, 50);
+const value32585 = compute(value, 90);
+const value59809 = compute(value, 57);
+const value71313 = compute(value, 18);
+// note 75277: keep this in sync with the handler
+const value37995 = compute(value, 68);
+const value33116 = compute(value, 39);
+const value3135 = compute(value, 31);
+const value36248 = compute(value, 67);
+const v = process.env.BENCH_KEY_01879;
+const value83379 = compute(value, 56);
+const value87467 = compute(value, 70);
+const value76073 = compute(value, 25);
+// note 64162: keep this in sync with the handler
+const value360 = compute(value, 69);
+const value9622 = compute(value, 19);
+const value17124 = compute(value, 52);
+const value20841 = compute(value, 83);
+const value4766 = compute(value, 13);
+const value4094 = compute(value, 20);
+const value46858 = compute(value, 7);
+const value21868 = compute(value, 43);
+const value95657 = compute(value, 15);
+const value99037 = compute(value, 0);
+const value48963 = compute(value, 75);
+const value85338 = compute(value, 75);
+const value14713 = compute(value, 66);
+const v = import.meta.env.BENCH_KEY_00262;
+const value31173 = compute(value, 36);
+const value52656 = compute(value, 82);
+const value24975 = compute(value, 46);
+const value94765 = compute(value, 93);
+const value31529 = compute(value, 4);
+const value14738 = compute(value, 91);
+const value3586 = compute(value, 94);
+const value40772 = compute(value, 32);
+const value93470 = compute(value, 59);
+const value79426 = compute(value, 80);
+const value14618 = compute(value, 68);
+const value48639 = compute(value, 42);
+const value35309 = compute(value, 1);
+const value98271 = compute(value, 10);
+// note 89226: keep this in sync with the handler
+const v = import.meta.env.BENCH_KEY_00598;
+const value8227 = compute(value, 79);
+const value59093 = compute(value, 20);
+// note 54432: keep this in sync with the handler
+const value96557 = compute(value, 42);
+const value12401 = compute(value, 82);
+const value77843 = compute(value, 49);
+const value24469 = compute(value, 25);
+const value63929 = compute(value, 6);
+const value45814 = compute(value, 30);
+const v = process.env.BENCH_KEY_00374;
+const value96556 = compute(value, 41);
+const value78965 = compute(value, 7);
+const value87108 = compute(value, 2);
+const value1108 = compute(value, 41);
+const value15374 = compute(value, 48);
+const value90182 = compute(value, 69);
+const value50570 = compute(value, 33);
+const value11642 = compute(value, 2);
+const value30518 = compute(value, 60);
+const value89066 = compute(value, 20);
+const value56616 = compute(value, 65);
+const v = import.meta.env.BENCH_KEY_00734;
+// note 30524: keep this in sync with the handler
+const value20521 = compute(value, 54);
+// note 87279: keep this in sync with the handler
+const value32013 = compute(value, 3);
+// note 55851: keep this in sync with the handler
+const value37036 = compute(value, 79);
+const value99694 = compute(value, 75);
+const value80749 = compute(value, 45);
+const value67710 = compute(value, 4);
+// note 47284: keep this in sync with the handler
+const value15510 = compute(value, 87);
+const value68788 = compute(value, 15);
+const value59001 = compute(value, 25);
+const value29839 = compute(value, 60);
+const value68002 = compute(value, 5);
+const value17608 = compute(value, 51);
+const v = process.env["BENCH_KEY_00416"];
+const value23964 = compute(value, 5);
+const value5250 = compute(value, 12);
+const value67519 = compute(value, 7);
+const value70641 = compute(value, 25);
+const value34536 = compute(value, 4);
+const value66111 = compute(value, 54);
+const value83894 = compute(value, 86);
+const value66330 = compute(value, 79);
+const value98637 = compute(value, 85);
+const value56199 = compute(value, 36);
+const value34821 = compute(value, 95);
+const value64827 = compute(value, 31);
+const value95258 = compute(value, 4);
+const value16865 = compute(value, 84);
+// note 85196: keep this in sync with the handler
@@ -0,0 +1,204 @@
+const value92521 = compute(value, 80);
+// note 64174: keep this in sync with the handler
+const value91862 = compute(value, 3);
+const value34978 = compute(value, 58);
+const value74678 = compute(value, 85);
+const value46079 = compute(value, 4);
+const value97830 = compute(value, 54);
+const value93555 = compute(value, 47);
+const value44605 = compute(value, 82);
+const value25182 = compute(value, 59);
+const value8712 = compute(value, 79);
+const v = import.meta.env.BENCH_KEY_01536;
+const value94423 = compute(value, 42);
+// note 14580: keep this in sync with the handler
+const value46305 = compute(value, 36);
+// note 81550: keep this in sync with the handler
+const value48616 = compute(value, 19);
+const value56506 = compute(value, 52);
+const value3277 = compute(value, 76);
+const value7868 = compute(value, 11);
+const value27543 = compute(value, 92);
+const value166 = compute(value, 69);
+const value69483 = compute(value, 31);
+const value70436 = compute(value, 14);
+const value14056 = compute(value, 88);
+const v = process.env["BENCH_KEY_00084"];
+const value40163 = compute(value, 5);
+const value1403 = compute(value, 45);
+const value74099 = compute(value, 88);
+const value36344 = compute(value, 66);
+const value31421 = compute(value, 90);
+const value67433 = compute(value, 18);
+const value90825 = compute(value, 33);
+const value48463 = compute(value, 60);
+// note 78527: keep this in sync with the handler
+// note 97098: keep this in sync with the handler
+const value48248 = compute(value, 39);
+const v = import.meta.env.BENCH_KEY_00760;
+const value97338 = compute(value, 47);
+const value74054 = compute(value, 43);
+const value65818 = compute(value, 52);
+const value6043 = compute(value, 29);
+const value96800 = compute(value, 91);
+const value627 = compute(value, 45);
+const value58746 = compute(value, 61);
+const value98733 = compute(value, 84);
+const value29229 = compute(value, 32);
+const value56899 = compute(value, 57);
+const value60148 = compute(value, 8);
+const value84384 = compute(value, 91);
+// note 50962: keep this in sync with the handler
+const value97243 = compute(value, 49);
+const value69126 = compute(value, 62);
+const value26363 = compute(value, 76);
+const v = process.env["BENCH_KEY_00676"];
+const value50104 = compute(value, 52);
+const value81749 = compute(value, 75);
+const value8230 = compute(value, 82);
+const value64359 = compute(value, 48);
+const value76242 = compute(value, 0);
+// note 43263: keep this in sync with the handler
+const value91796 = compute(value, 34);
+const value51552 = compute(value, 45);
+const value28663 = compute(value, 48);
+const value91496 = compute(value, 25);
+const value59406 = compute(value, 42);
+const value72189 = compute(value, 21);
+const value30567 = compute(value, 12);
+const value26530 = compute(value, 49);
+const value12493 = compute(value, 77);
+const value95276 = compute(value, 22);
+const value40619 = compute(value, 73);
+const value88805 = compute(value, 50);
+const v = process.env.BENCH_KEY_00500;
+const value84329 = compute(value, 36);
+const value60321 = compute(value, 84);
+const value55844 = compute(value, 69);
+const value32630 = compute(value, 38);
+const value37192 = compute(value, 41);
+const value3859 = compute(value, 76);
+// note 71204: keep this in sync with the handler
+// note 86121: keep this in sync with the handler
+const value42791 = compute(value, 14);
+const value52059 = compute(value, 67);
+const value8653 = compute(value, 20);
+const value4055 = compute(value, 78);
+const v = import.meta.env.BENCH_KEY_00584;
+const value90138 = compute(value, 25);
+const value82851 = compute(value, 13);
+// note 59783: keep this in sync with the handler
+const value7670 = compute(value, 7);
+const value83845 = compute(value, 37);
+const value9550 = compute(value, 44);
+const value88364 = compute(value, 94);
+const value83132 = compute(value, 3);
+const value39593 = compute(value, 17);
+// note 58042: keep this in sync with the handler
+const value81218 = compute(value, 29);
+const v = process.env["BENCH_KEY_00654"];
+// note 40380: keep this in sync with the handler
+const value22549 = compute(value, 45);
+const value10457 = compute(value, 78);
+// note 84770: keep this in sync with the handler
+const value22991 = compute(value, 2);
+const value31855 = compute(value, 39);
+const value67345 = compute(value, 27);
+const value33974 = compute(value, 24);
+const value67125 = compute(value, 1);
+const value2259 = compute(value, 28);
+const value91714 = compute(value, 49);
+const value29295 = compute(value, 1);
+const value92534 = compute(value, 93);
+const value12920 = compute(value, 19);
+const value95850 = compute(value, 14);
+// note 79543: keep this in sync with the handler
+const value91464 = compute(value, 90);
+const value7268 = compute(value, 90);
+const value3803 = compute(value, 20);
+const v = process.env["BENCH_KEY_00333"];
+const value66134 = compute(value, 77);
+const value700 = compute(value, 21);
+const value68824 = compute(value, 51);
+const value17419 = compute(value, 56);
+const value85259 = compute(value, 93);
+const value64059 = compute(value, 39);
+// note 49289: keep this in sync with the handler
+const v = import.meta.env.BENCH_KEY_00286;
+const value2186 = compute(value, 52);
+const value49732 = compute(value, 68);
+const value80795 = compute(value, 91);
+const value4512 = compute(value, 50);
+const value61917 = compute(value, 31);
+const value38468 = compute(value, 56);
+const value51107 = compute(value, 85);
+const value55792 = compute(value, 17);
+// note 68881: keep this in sync with the handler
+const v = import.meta.env.BENCH_KEY_01514;
+const value74698 = compute(value, 8);
+// note 17718: keep this in sync with the handler
+const value26768 = compute(value, 93);
+const value31509 = compute(value, 81);
+// note 29005: keep this in sync with the handler
+const value65220 = compute(value, 36);
+const value88358 = compute(value, 88);
+const value71993 = compute(value, 19);
+const value7128 = compute(value, 47);
+const value92954 = compute(value, 28);
+const value221 = compute(value, 27);
+const value58156 = compute(value, 53);
+const value64715 = compute(value, 16);
+const value74286 = compute(value, 81);
+const value76133 = compute(value, 85);
+const v = import.meta.env.BENCH_KEY_00654;
+const value69586 = compute(value, 37);
+const value40362 = compute(value, 10);
+const value68878 = compute(value, 8);
+const value14325 = compute(value, 66);
+// note 66296: keep this in sync with the handler
+const value39059 = compute(value, 65);
+const value58141 = compute(value, 38);
+const value58009 = compute(value, 3);
+const value44831 = compute(value, 17);
+const value55656 = compute(value, 75);
+const value99889 = compute(value, 76);
+// note 88475: keep this in sync with the handler
+const value57078 = compute(value, 42);
+const value62337 = compute(value, 63);
+const value64636 = compute(value, 34);
+const v = process.env["BENCH_KEY_00468"];
+// note 46063: keep this in sync with the handler
+const value13799 = compute(value, 25);
+const value23884 = compute(value, 22);
+const value59237 = compute(value, 67);
+const value95543 = compute(value, 95);
+const value78686 = compute(value, 19);
+const value45626 = compute(value, 36);
+const value12919 = compute(value, 18);
+const value36423 = compute(value, 48);
+const value97389 = compute(value, 1);
+const value4495 = compute(value, 33);
+const value8226 = compute(value, 78);
+const value62557 = compute(value, 89);
+const value58825 = compute(value, 43);
+const value61251 = compute(value, 44);
+const value59971 = compute(value, 25);
+const value10812 = compute(value, 45);
+const value36841 = compute(value, 78);
+const value13248 = compute(value, 56);
+const v = process.env.BENCH_KEY_00743;
+const value62106 = compute(value, 26);
+const value16391 = compute(value, 95);
+// note 32068: keep this in sync with the handler
+const value55731 = compute(value, 53);
+const value96017 = compute(value, 84);
+const value28292 = compute(value, 65);
+const value69845 = compute(value, 5);
+const value75254 = compute(value, 79);
+const value35169 = compute(value, 55);
+const value53093 = compute(value, 34);
+// note 76735: keep this in sync with the handler
+// note 818: keep this in sync with the handler
+const value6722 = compute(value, 29);
+const v = process.env["BENCH_KEY_01426"];
+const value136 = compute(value, 39);
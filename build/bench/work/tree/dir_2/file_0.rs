@@ -0,0 +1,211 @@
+// note 82519: keep this in sync with the handler
+let value82417 = compute(value, 64);
+let value40542 = compute(value, 93);
+let value56195 = compute(value, 32);
+let value8843 = compute(value, 16);
+let value57242 = compute(value, 12);
+let value1024 = compute(value, 54);
+// note 48286: keep this in sync with the handler
+let value86296 = compute(value, 63);
+let value96342 = compute(value, 21);
+let value64894 = compute(value, 1);
+let value32799 = compute(value, 13);
+let value89380 = compute(value, 43);
+const v = env::var("BENCH_KEY_00801");
+let value60949 = compute(value, 33);
+// note 89202: keep this in sync with the handler
+let value79426 = compute(value, 80);
+let value75731 = compute(value, 71);
+// note 42373: keep this in sync with the handler
+let value44707 = compute(value, 87);
+let value63723 = compute(value, 91);
+const v = env::var("BENCH_KEY_01452");
+let value79802 = compute(value, 68);
+let value12302 = compute(value, 80);
+let value91992 = compute(value, 36);
+let value87793 = compute(value, 8);
+let value54758 = compute(value, 50);
+let value80999 = compute(value, 4);
+let value67159 = compute(value, 35);
+// note 71716: keep this in sync with the handler
+let value35510 = compute(value, 8);
+let value81766 = compute(value, 92);
+let value22507 = compute(value, 3);
+let value94091 = compute(value, 1);
+let value43975 = compute(value, 34);
+let value62436 = compute(value, 65);
+let value38830 = compute(value, 30);
+let value22063 = compute(value, 44);
+const v = env::var_os("BENCH_KEY_01249");
+let value3643 = compute(value, 54);
+let value44969 = compute(value, 58);
+let value37654 = compute(value, 18);
+let value23962 = compute(value, 3);
+let value31672 = compute(value, 50);
+let value18431 = compute(value, 1);
+let value45608 = compute(value, 18);
+let value95198 = compute(value, 41);
+let value53616 = compute(value, 72);
+let value22035 = compute(value, 16);
+// note 30924: keep this in sync with the handler
+let value32931 = compute(value, 48);
+let value86033 = compute(value, 91);
+let value78039 = compute(value, 51);
+let value15942 = compute(value, 34);
+let value83137 = compute(value, 8);
+// note 75785: keep this in sync with the handler
+let value53029 = compute(value, 67);
+let value67671 = compute(value, 62);
+let value36009 = compute(value, 22);
+const v = env::var("BENCH_KEY_00327");
+// note 84411: keep this in sync with the handler
+let value4108 = compute(value, 34);
+let value19721 = compute(value, 30);
+let value58496 = compute(value, 5);
+let value89577 = compute(value, 46);
+let value14960 = compute(value, 22);
+let value11846 = compute(value, 12);
+let value44372 = compute(value, 43);
+let value76653 = compute(value, 23);
+let value4671 = compute(value, 15);
+let value75083 = compute(value, 5);
+let value60639 = compute(value, 14);
+let value26810 = compute(value, 38);
+let value98165 = compute(value, 1);
+let value14246 = compute(value, 84);
+let value54772 = compute(value, 64);
+let value42957 = compute(value, 83);
+const v = env::var_os("BENCH_KEY_01870");
+let value58919 = compute(value, 40);
+let value35250 = compute(value, 39);
+let value97208 = compute(value, 14);
+let value73668 = compute(value, 45);
+// note 78202: keep this in sync with the handler
+let value65911 = compute(value, 48);
+let value53167 = compute(value, 11);
+let value43558 = compute(value, 5);
+// note 32175: keep this in sync with the handler
+let value25450 = compute(value, 36);
+let value20412 = compute(value, 42);
+let value33005 = compute(value, 25);
+const v = env::var_os("BENCH_KEY_01071");
+let value26498 = compute(value, 17);
+// note 56026: keep this in sync with the handler
+let value21363 = compute(value, 23);
+// note 78623: keep this in sync with the handler
+let value76228 = compute(value, 83);
+// note 29446: keep this in sync with the handler
+let value69769 = compute(value, 26);
+let value64010 = compute(value, 87);
+let value28434 = compute(value, 13);
+let value25540 = compute(value, 29);
+let value3359 = compute(value, 61);
+let value79157 = compute(value, 5);
+let value79288 = compute(value, 39);
+let value59136 = compute(value, 63);
+// note 67049: keep this in sync with the handler
+let value18927 = compute(value, 12);
+const v = env::var("BENCH_KEY_01230");
+let value25880 = compute(value, 78);
+let value52687 = compute(value, 16);
+let value92824 = compute(value, 92);
+let value90241 = compute(value, 31);
+let value3414 = compute(value, 19);
+let value65789 = compute(value, 23);
+let value42241 = compute(value, 46);
+let value779 = compute(value, 3);
+const v = env::var("BENCH_KEY_01122");
+let value77638 = compute(value, 38);
+let value25171 = compute(value, 48);
+// note 19895: keep this in sync with the handler
+let value72608 = compute(value, 52);
+let value35520 = compute(value, 18);
+let value25873 = compute(value, 71);
+let value37873 = compute(value, 43);
+let value49395 = compute(value, 22);
+let value54335 = compute(value, 15);
+// note 5818: keep this in sync with the handler
+let value82635 = compute(value, 88);
+let value46984 = compute(value, 36);
+let value43267 = compute(value, 5);
+let value15173 = compute(value, 41);
+let value62003 = compute(value, 20);
+let value13777 = compute(value, 3);
+let value90457 = compute(value, 53);
+const v = env::var_os("BENCH_KEY_00066");
+let value33841 = compute(value, 85);
+let value35012 = compute(value, 92);
+let value37723 = compute(value, 87);
+let value58312 = compute(value, 15);
+let value18343 = compute(value, 10);
+let value63961 = compute(value, 38);
+let value53530 = compute(value, 83);
+// note 73575: keep this in sync with the handler
+let value44473 = compute(value, 47);
+let value40405 = compute(value, 53);
+let value39972 = compute(value, 8);
+const v = env::var("BENCH_KEY_01115");
+let value38958 = compute(value, 61);
+// note 61782: keep this in sync with the handler
+// note 46433: keep this in sync with the handler
+let value84504 = compute(value, 17);
+let value96533 = compute(value, 18);
+let value74264 = compute(value, 59);
+let value11339 = compute(value, 87);
+let value56068 = compute(value, 2);
+// note 45036: keep this in sync with the handler
+let value85620 = compute(value, 66);
+let value66061 = compute(value, 4);
+let value73948 = compute(value, 34);
+let value46463 = compute(value, 0);
+let value84749 = compute(value, 68);
+const v = env::var("BENCH_KEY_01449");
+let value47100 = compute(value, 55);
+let value52377 = compute(value, 94);
+let value47286 = compute(value, 47);
+let value87814 = compute(value, 29);
+// note 36803: keep this in sync with the handler
+let value44892 = compute(value, 78);
+// note 16675: keep this in sync with the handler
+let value59648 = compute(value, 90);
+let value64259 = compute(value, 45);
+let value10366 = compute(value, 84);
+let value25071 = compute(value, 45);
+let value58505 = compute(value, 14);
+let value45123 = compute(value, 18);
+let value52877 = compute(value, 12);
+let value99043 = compute(value, 6);
+let value92722 = compute(value, 87);
+const v = env::var_os("BENCH_KEY_00135");
+let value8119 = compute(value, 68);
+// note 84608: keep this in sync with the handler
+let value53060 = compute(value, 1);
+let value66893 = compute(value, 60);
+let value9405 = compute(value, 93);
+// note 91454: keep this in sync with the handler
+let value98354 = compute(value, 93);
+let value40949 = compute(value, 15);
+let value55608 = compute(value, 27);
+let value49562 = compute(value, 92);
+let value44311 = compute(value, 79);
+const v = env::var_os("BENCH_KEY_01039");
+// note 85546: keep this in sync with the handler
+// note 80998: keep this in sync with the handler
+let value28417 = compute(value, 93);
+let value80690 = compute(value, 83);
+let value81597 = compute(value, 20);
+// note 84995: keep this in sync with the handler
+let value75593 = compute(value, 30);
+let value5710 = compute(value, 84);
+// note 82884: keep this in sync with the handler
+let value91039 = compute(value, 53);
+// note 93322: keep this in sync with the handler
+// note 11689: keep this in sync with the handler
+const v = env::var_os("BENCH_KEY_01747");
+let value13888 = compute(value, 17);
+let value90052 = compute(value, 36);
+let value95117 = compute(value, 57);
+// note 57044: keep this in sync with the handler
+let value6431 = compute(value, 29);
+let value90224 = compute(value, 14);
+let value5286 = compute(value, 48);
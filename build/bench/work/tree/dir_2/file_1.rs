@@ -0,0 +1,214 @@
+// note 64125: keep this in sync with the handler
+let value92915 = compute(value, 86);
+let value60243 = compute(value, 6);
+let value44686 = compute(value, 66);
+let value70686 = compute(value, 70);
+let value1923 = compute(value, 80);
+let value84364 = compute(value, 71);
+// note 59760: keep this in sync with the handler
+let value4935 = compute(value, 85);
+let value21304 = compute(value, 61);
+let value44897 = compute(value, 83);
+let value97902 = compute(value, 29);
+let value58038 = compute(value, 32);
+const v = env::var_os("BENCH_KEY_00925");
+// note 84678: keep this in sync with the handler
+let value4085 = compute(value, 11);
+let value66758 = compute(value, 22);
+let value84670 = compute(value, 86);
+let value76617 = compute(value, 84);
+let value41025 = compute(value, 91);
+let value46405 = compute(value, 39);
+let value92751 = compute(value, 19);
+let value47522 = compute(value, 89);
+let value55523 = compute(value, 39);
+let value89152 = compute(value, 9);
+let value66966 = compute(value, 36);
+let value24357 = compute(value, 10);
+let value8746 = compute(value, 16);
+let value82373 = compute(value, 20);
+let value79261 = compute(value, 12);
+let value51075 = compute(value, 53);
+let value82467 = compute(value, 17);
+let value6619 = compute(value, 23);
+const v = env::var_os("BENCH_KEY_00879");
+let value73554 = compute(value, 28);
+// note 12798: keep this in sync with the handler
+let value80628 = compute(value, 21);
+// note 83927: keep this in sync with the handler
+let value98278 = compute(value, 17);
+// note 5802: keep this in sync with the handler
+let value45037 = compute(value, 29);
+let value60891 = compute(value, 72);
+// note 74936: keep this in sync with the handler
+const v = env::var("BENCH_KEY_00396");
+let value43058 = compute(value, 87);
+let value94582 = compute(value, 7);
+let value29305 = compute(value, 11);
+// note 45831: keep this in sync with the handler
+let value98403 = compute(value, 45);
+let value43451 = compute(value, 92);
+let value85981 = compute(value, 39);
+let value53264 = compute(value, 11);
+let value35826 = compute(value, 33);
+let value62250 = compute(value, 73);
+let value62763 = compute(value, 4);
+let value59574 = compute(value, 16);
+let value86406 = compute(value, 76);
+const v = env::var("BENCH_KEY_01937");
+let value44389 = compute(value, 60);
+let value24637 = compute(value, 96);
+let value39087 = compute(value, 93);
+let value68638 = compute(value, 59);
+let value70566 = compute(value, 47);
+let value4881 = compute(value, 31);
+let value51653 = compute(value, 49);
+// note 32176: keep this in sync with the handler
+let value15887 = compute(value, 76);
+let value86125 = compute(value, 86);
+let value11700 = compute(value, 60);
+let value42390 = compute(value, 1);
+let value21435 = compute(value, 95);
+const v = env::var("BENCH_KEY_01414");
+let value78716 = compute(value, 49);
+let value36311 = compute(value, 33);
+let value78294 = compute(value, 15);
+let value21333 = compute(value, 90);
+let value80353 = compute(value, 37);
+let value50273 = compute(value, 27);
+let value18213 = compute(value, 74);
+let value78068 = compute(value, 80);
+let value91991 = compute(value, 35);
+const v = env::var_os("BENCH_KEY_00228");
+let value31609 = compute(value, 84);
+let value460 = compute(value, 72);
+let value9443 = compute(value, 34);
+let value95194 = compute(value, 37);
+// note 85605: keep this in sync with the handler
+let value58809 = compute(value, 27);
+let value81115 = compute(value, 23);
+let value66818 = compute(value, 82);
+let value31939 = compute(value, 26);
+let value86471 = compute(value, 44);
+let value94481 = compute(value, 3);
+const v = env::var("BENCH_KEY_01484");
+let value95537 = compute(value, 89);
+// note 33979: keep this in sync with the handler
+let value21689 = compute(value, 58);
+let value68730 = compute(value, 54);
+let value32076 = compute(value, 66);
+let value57832 = compute(value, 20);
+let value15777 = compute(value, 63);
+// note 27829: keep this in sync with the handler
+let value88859 = compute(value, 7);
+const v = env::var("BENCH_KEY_00240");
+let value22904 = compute(value, 12);
+let value37318 = compute(value, 70);
+let value85172 = compute(value, 6);
+let value7059 = compute(value, 75);
+// note 24084: keep this in sync with the handler
+let value68010 = compute(value, 13);
+let value83352 = compute(value, 29);
+let value85231 = compute(value, 65);
+// note 13505: keep this in sync with the handler
+let value73808 = compute(value, 88);
+// note 94887: keep this in sync with the handler
+let value29665 = compute(value, 80);
+let value5892 = compute(value, 72);
+const v = env::var("BENCH_KEY_01996");
+let value338 = compute(value, 47);
+let value83806 = compute(value, 95);
+let value80895 = compute(value, 94);
+let value23168 = compute(value, 82);
+// note 32503: keep this in sync with the handler
+let value14787 = compute(value, 43);
+let value99350 = compute(value, 22);
+let value29441 = compute(value, 50);
+let value74099 = compute(value, 88);
+const v = env::var_os("BENCH_KEY_01646");
+let value67162 = compute(value, 38);
+let value23926 = compute(value, 64);
+let value54535 = compute(value, 21);
+let value45774 = compute(value, 87);
+let value93309 = compute(value, 92);
+let value40729 = compute(value, 86);
+let value86770 = compute(value, 52);
+let value80600 = compute(value, 90);
+let value53403 = compute(value, 53);
+let value24839 = compute(value, 7);
+let value65965 = compute(value, 5);
+let value18285 = compute(value, 49);
+let value71925 = compute(value, 48);
+let value62032 = compute(value, 49);
+let value72576 = compute(value, 20);
+let value74407 = compute(value, 8);
+let value65485 = compute(value, 10);
+let value25266 = compute(value, 46);
+let value5080 = compute(value, 36);
+const v = env::var_os("BENCH_KEY_01257");
+let value52259 = compute(value, 73);
+let value18878 = compute(value, 60);
+let value12564 = compute(value, 51);
+let value94443 = compute(value, 62);
+let value18492 = compute(value, 62);
+let value51380 = compute(value, 67);
+let value38542 = compute(value, 33);
+let value81342 = compute(value, 56);
+let value19031 = compute(value, 19);
+let value67778 = compute(value, 72);
+let value48668 = compute(value, 71);
+let value32219 = compute(value, 15);
+// note 78035: keep this in sync with the handler
+let value77985 = compute(value, 94);
+let value61994 = compute(value, 11);
+let value58576 = compute(value, 85);
+const v = env::var_os("BENCH_KEY_01956");
+let value94916 = compute(value, 50);
+// note 68697: keep this in sync with the handler
+let value76096 = compute(value, 48);
+let value1010 = compute(value, 40);
+let value74395 = compute(value, 93);
+let value94942 = compute(value, 76);
+let value49773 = compute(value, 12);
+let value7397 = compute(value, 25);
+let value97325 = compute(value, 34);
+let value8437 = compute(value, 95);
+let value26669 = compute(value, 91);
+let value56946 = compute(value, 7);
+let value34702 = compute(value, 73);
+let value67914 = compute(value, 14);
+const v = env::var("BENCH_KEY_00835");
+let value99753 = compute(value, 37);
+let value81288 = compute(value, 2);
+let value72438 = compute(value, 76);
+let value21650 = compute(value, 19);
+let value79137 = compute(value, 82);
+let value36766 = compute(value, 3);
+// note 1842: keep this in sync with the handler
+let value63662 = compute(value, 30);
+let value18436 = compute(value, 6);
+let value71318 = compute(value, 23);
+let value85859 = compute(value, 14);
+let value34275 = compute(value, 34);
+let value92143 = compute(value, 90);
+let value6627 = compute(value, 31);
+// note 90448: keep this in sync with the handler
+let value22234 = compute(value, 21);
+let value38036 = compute(value, 12);
+const v = env::var_os("BENCH_KEY_00681");
+let value90910 = compute(value, 21);
+// note 93727: keep this in sync with the handler
+let value36451 = compute(value, 76);
+let value40279 = compute(value, 24);
+let value39692 = compute(value, 19);
+let value76331 = compute(value, 89);
+let value59706 = compute(value, 51);
+let value22347 = compute(value, 37);
+let value37394 = compute(value, 49);
+let value93057 = compute(value, 34);
+let value53904 = compute(value, 69);
+let value64794 = compute(value, 95);
+let value85075 = compute(value, 6);
+let value38747 = compute(value, 44);
+// note 38707: keep this in sync with the handler
+let value40011 = compute(value, 47);
@@ -0,0 +1,232 @@
+value41477 := compute(value, 58)
+value56763 := compute(value, 18)
+// note 71119: keep this in sync with the handler
+// note 98632: keep this in sync with the handler
+// note 70357: keep this in sync with the handler
+const v = os.LookupEnv("BENCH_KEY_00341");
+value56137 := compute(value, 71)
+value93858 := compute(value, 59)
+// note 34746: keep this in sync with the handler
+value18699 := compute(value, 75)
+value98638 := compute(value, 86)
+value53633 := compute(value, 89)
+value4841 := compute(value, 88)
+value90382 := compute(value, 75)
+value65701 := compute(value, 32)
+const v = os.LookupEnv("BENCH_KEY_01885");
+value2575 := compute(value, 53)
+value31675 := compute(value, 53)
+value71278 := compute(value, 80)
+value27193 := compute(value, 33)
+// note 67881: keep this in sync with the handler
+value42612 := compute(value, 29)
+value51903 := compute(value, 8)
+// note 41598: keep this in sync with the handler
+value38350 := compute(value, 35)
+// note 42730: keep this in sync with the handler
+const v = os.LookupEnv("BENCH_KEY_01404");
+value46357 := compute(value, 88)
+value85495 := compute(value, 38)
+value63241 := compute(value, 94)
+value74109 := compute(value, 1)
+// note 93355: keep this in sync with the handler
+// note 84184: keep this in sync with the handler
+value91381 := compute(value, 7)
+value42802 := compute(value, 25)
+value99200 := compute(value, 66)
+// note 21960: keep this in sync with the handler
+value26376 := compute(value, 89)
+value18672 := compute(value, 48)
+value89658 := compute(value, 30)
+// note 60755: keep this in sync with the handler
+// note 29343: keep this in sync with the handler
+value74094 := compute(value, 83)
+value83783 := compute(value, 72)
+const v = os.Getenv("BENCH_KEY_01007");
+value62809 := compute(value, 50)
+value85233 := compute(value, 67)
+value64546 := compute(value, 41)
+value32937 := compute(value, 54)
+value20381 := compute(value, 11)
+value46344 := compute(value, 75)
+value9601 := compute(value, 95)
+// note 51091: keep this in sync with the handler
+value83297 := compute(value, 71)
+value75057 := compute(value, 76)
+value19919 := compute(value, 34)
+value80180 := compute(value, 58)
+value233 := compute(value, 39)
+value87933 := compute(value, 51)
+value64563 := compute(value, 58)
+const v = os.LookupEnv("BENCH_KEY_01204");
+value38226 := compute(value, 8)
+value82118 := compute(value, 56)
+value18393 := compute(value, 60)
+value85016 := compute(value, 44)
+value94545 := compute(value, 67)
+value57394 := compute(value, 67)
+value28864 := compute(value, 55)
+value13560 := compute(value, 77)
+// note 21666: keep this in sync with the handler
+value87913 := compute(value, 31)
+// note 71265: keep this in sync with the handler
+value82563 := compute(value, 16)
+value75023 := compute(value, 42)
+value66118 := compute(value, 61)
+value42137 := compute(value, 39)
+value47251 := compute(value, 12)
+value72769 := compute(value, 19)
+value86704 := compute(value, 83)
+const v = os.LookupEnv("BENCH_KEY_01104");
+value68857 := compute(value, 84)
+value23958 := compute(value, 96)
+value60242 := compute(value, 5)
+value1156 := compute(value, 89)
+value50006 := compute(value, 51)
+value99116 := compute(value, 79)
+value73306 := compute(value, 71)
+value46212 := compute(value, 40)
+value77574 := compute(value, 71)
+value65400 := compute(value, 22)
+value82988 := compute(value, 53)
+value69705 := compute(value, 59)
+value86897 := compute(value, 82)
+value688 := compute(value, 9)
+value75392 := compute(value, 23)
+value32287 := compute(value, 83)
+const v = os.Getenv("BENCH_KEY_00503");
+value95538 := compute(value, 90)
+value89009 := compute(value, 60)
+value4165 := compute(value, 91)
+// note 71416: keep this in sync with the handler
+value24924 := compute(value, 92)
+value47722 := compute(value, 95)
+value84771 := compute(value, 90)
+value55844 := compute(value, 69)
+value28745 := compute(value, 33)
+// note 41938: keep this in sync with the handler
+value84369 := compute(value, 76)
+value45566 := compute(value, 73)
+// note 32522: keep this in sync with the handler
+const v = os.LookupEnv("BENCH_KEY_00681");
+value96955 := compute(value, 52)
+value41036 := compute(value, 5)
+value14531 := compute(value, 78)
+// note 14087: keep this in sync with the handler
+value24265 := compute(value, 15)
+value89361 := compute(value, 24)
+value15751 := compute(value, 37)
+// note 46511: keep this in sync with the handler
+value88979 := compute(value, 30)
+value4486 := compute(value, 24)
+value54806 := compute(value, 1)
+value20877 := compute(value, 22)
+value70349 := compute(value, 24)
+// note 28660: keep this in sync with the handler
+// note 14189: keep this in sync with the handler
+const v = os.Getenv("BENCH_KEY_00480");
+value87321 := compute(value, 21)
+value95668 := compute(value, 26)
+// note 24267: keep this in sync with the handler
+value94792 := compute(value, 23)
+value25291 := compute(value, 71)
+value69846 := compute(value, 6)
+value97628 := compute(value, 46)
+value61506 := compute(value, 8)
+value93291 := compute(value, 74)
+value29577 := compute(value, 89)
+value1519 := compute(value, 64)
+value43090 := compute(value, 22)
+value92645 := compute(value, 10)
+value38748 := compute(value, 45)
+value72834 := compute(value, 84)
+value78798 := compute(value, 34)
+value59880 := compute(value, 31)
+const v = os.Getenv("BENCH_KEY_01115");
+value19552 := compute(value, 55)
+value7609 := compute(value, 43)
+// note 31257: keep this in sync with the handler
+value46279 := compute(value, 10)
+value26382 := compute(value, 95)
+value66537 := compute(value, 92)
+value36522 := compute(value, 50)
+value43981 := compute(value, 40)
+value39727 := compute(value, 54)
+value47732 := compute(value, 8)
+const v = os.LookupEnv("BENCH_KEY_01300");
+value90962 := compute(value, 73)
+value98693 := compute(value, 44)
+value61641 := compute(value, 46)
+// note 5707: keep this in sync with the handler
+value91309 := compute(value, 32)
+value30443 := compute(value, 82)
+value63001 := compute(value, 48)
+value11167 := compute(value, 12)
+value83510 := compute(value, 90)
+const v = os.LookupEnv("BENCH_KEY_00267");
+value6634 := compute(value, 38)
+value45184 := compute(value, 79)
+value1669 := compute(value, 20)
+value3715 := compute(value, 29)
+value95557 := compute(value, 12)
+value88662 := compute(value, 4)
+value7898 := compute(value, 41)
+value77920 := compute(value, 29)
+value95589 := compute(value, 44)
+value98153 := compute(value, 86)
+value92768 := compute(value, 36)
+value29759 := compute(value, 77)
+value34572 := compute(value, 40)
+value29613 := compute(value, 28)
+value38247 := compute(value, 29)
+value31045 := compute(value, 5)
+value70641 := compute(value, 25)
+value8369 := compute(value, 27)
+value45449 := compute(value, 53)
+value75915 := compute(value, 61)
+value73267 := compute(value, 32)
+// note 54176: keep this in sync with the handler
+const v = os.Getenv("BENCH_KEY_00266");
+value74747 := compute(value, 57)
+value9954 := compute(value, 60)
+value72872 := compute(value, 25)
+value48997 := compute(value, 12)
+value81378 := compute(value, 92)
+value94994 := compute(value, 31)
+value43810 := compute(value, 63)
+value3506 := compute(value, 14)
+// note 32310: keep this in sync with the handler
+// note 7131: keep this in sync with the handler
+value6968 := compute(value, 81)
+value4449 := compute(value, 84)
+value6952 := compute(value, 65)
+value14326 := compute(value, 67)
+value55378 := compute(value, 88)
+value57136 := compute(value, 3)
+value47319 := compute(value, 80)
+const v = os.LookupEnv("BENCH_KEY_01202");
+value66288 := compute(value, 37)
+value85199 := compute(value, 33)
+value39757 := compute(value, 84)
+value62123 := compute(value, 43)
+value71367 := compute(value, 72)
+value8324 := compute(value, 79)
+value92830 := compute(value, 1)
+value2840 := compute(value, 27)
+value6323 := compute(value, 18)
+const v = os.LookupEnv("BENCH_KEY_00738");
+value96548 := compute(value, 33)
+value28157 := compute(value, 27)
+value29461 := compute(value, 70)
+value91780 := compute(value, 18)
+value39488 := compute(value, 9)
+value25981 := compute(value, 82)
+value81281 := compute(value, 92)
+value97860 := compute(value, 84)
+value86681 := compute(value, 60)
+value24542 := compute(value, 1)
+value50925 := compute(value, 0)
+value62541 := compute(value, 73)
+value54143 := compute(value, 17)
+value75167 := compute(value, 89)
+value9683 := compute(value, 80)
@@ -0,0 +1,239 @@
+value62620 = compute(value, 55)
+value8175 = compute(value, 27)
+value63883 = compute(value, 57)
+value79052 = compute(value, 94)
+value82411 = compute(value, 58)
+# note 4063: keep this in sync with the handler
+value93602 = compute(value, 94)
+value25863 = compute(value, 61)
+value8538 = compute(value, 2)
+value91582 = compute(value, 14)
+value40781 = compute(value, 41)
+# note 15028: keep this in sync with the handler
+value15976 = compute(value, 68)
+value59521 = compute(value, 60)
+value33604 = compute(value, 42)
+const v = os.getenv("BENCH_KEY_01048");
+value58236 = compute(value, 36)
+value75715 = compute(value, 55)
+value14510 = compute(value, 57)
+value36405 = compute(value, 30)
+value15614 = compute(value, 94)
+value46685 = compute(value, 28)
+value53987 = compute(value, 55)
+value42105 = compute(value, 7)
+value2041 = compute(value, 4)
+# note 93695: keep this in sync with the handler
+# note 63540: keep this in sync with the handler
+const v = os.getenv("BENCH_KEY_01268");
+# note 85464: keep this in sync with the handler
+value14210 = compute(value, 48)
+# note 24488: keep this in sync with the handler
+value65084 = compute(value, 94)
+value624 = compute(value, 42)
+value9028 = compute(value, 7)
+value60327 = compute(value, 90)
+value50640 = compute(value, 6)
+value87431 = compute(value, 34)
+value49738 = compute(value, 74)
+value15428 = compute(value, 5)
+value39504 = compute(value, 25)
+value28346 = compute(value, 22)
+value24279 = compute(value, 29)
+value31314 = compute(value, 80)
+value94903 = compute(value, 37)
+# note 69454: keep this in sync with the handler
+value91633 = compute(value, 65)
+value78468 = compute(value, 92)
+const v = os.environ["BENCH_KEY_01811"];
+value2250 = compute(value, 19)
+# note 23965: keep this in sync with the handler
+value98087 = compute(value, 20)
+value50679 = compute(value, 45)
+value19317 = compute(value, 14)
+# note 30679: keep this in sync with the handler
+value81554 = compute(value, 74)
+value14003 = compute(value, 35)
+value87744 = compute(value, 56)
+value90213 = compute(value, 3)
+value51450 = compute(value, 40)
+value87873 = compute(value, 88)
+value83527 = compute(value, 10)
+value6846 = compute(value, 56)
+value30770 = compute(value, 21)
+const v = os.getenv("BENCH_KEY_01660");
+value75137 = compute(value, 59)
+value64841 = compute(value, 45)
+value72391 = compute(value, 29)
+value44596 = compute(value, 73)
+value23251 = compute(value, 68)
+value22733 = compute(value, 35)
+value8507 = compute(value, 68)
+value74251 = compute(value, 46)
+value78261 = compute(value, 79)
+value12578 = compute(value, 65)
+value54493 = compute(value, 76)
+value72195 = compute(value, 27)
+value59071 = compute(value, 95)
+value97257 = compute(value, 63)
+value19088 = compute(value, 76)
+# note 62127: keep this in sync with the handler
+value92696 = compute(value, 61)
+# note 36647: keep this in sync with the handler
+const v = os.getenv("BENCH_KEY_00581");
+value14721 = compute(value, 74)
+value46954 = compute(value, 6)
+value20485 = compute(value, 18)
+value3929 = compute(value, 49)
+value76032 = compute(value, 81)
+value15291 = compute(value, 62)
+value66190 = compute(value, 36)
+value24052 = compute(value, 93)
+value13478 = compute(value, 92)
+value13199 = compute(value, 7)
+value72395 = compute(value, 33)
+# note 21243: keep this in sync with the handler
+value25261 = compute(value, 41)
+value46030 = compute(value, 52)
+value64708 = compute(value, 9)
+value97479 = compute(value, 91)
+value83594 = compute(value, 77)
+value76699 = compute(value, 69)
+value20755 = compute(value, 94)
+# note 49222: keep this in sync with the handler
+const v = os.environ["BENCH_KEY_00170"];
+value6098 = compute(value, 84)
+value79725 = compute(value, 88)
+value19791 = compute(value, 3)
+value84953 = compute(value, 78)
+value66756 = compute(value, 20)
+value29674 = compute(value, 89)
+# note 3905: keep this in sync with the handler
+value81431 = compute(value, 48)
+value6343 = compute(value, 38)
+value91976 = compute(value, 20)
+# note 47544: keep this in sync with the handler
+value81180 = compute(value, 88)
+value25412 = compute(value, 95)
+value4494 = compute(value, 32)
+const v = os.environ["BENCH_KEY_00406"];
+value42652 = compute(value, 69)
+value82575 = compute(value, 28)
+value57678 = compute(value, 60)
+value35261 = compute(value, 50)
+value30720 = compute(value, 68)
+value59013 = compute(value, 37)
+value77674 = compute(value, 74)
+value62585 = compute(value, 20)
+value8352 = compute(value, 10)
+value58338 = compute(value, 41)
+# note 53613: keep this in sync with the handler
+const v = os.environ["BENCH_KEY_01036"];
+value72630 = compute(value, 74)
+value68636 = compute(value, 57)
+value46645 = compute(value, 85)
+value32363 = compute(value, 62)
+value89 = compute(value, 89)
+value32257 = compute(value, 53)
+value642 = compute(value, 60)
+value85453 = compute(value, 93)
+value28659 = compute(value, 44)
+value34236 = compute(value, 92)
+value4589 = compute(value, 30)
+value4249 = compute(value, 78)
+value40751 = compute(value, 11)
+# note 73827: keep this in sync with the handler
+value43890 = compute(value, 46)
+const v = os.environ["BENCH_KEY_01640"];
+# note 19882: keep this in sync with the handler
+value67044 = compute(value, 17)
+value34121 = compute(value, 74)
+value99497 = compute(value, 72)
+value77825 = compute(value, 31)
+value93235 = compute(value, 18)
+value29111 = compute(value, 11)
+value50915 = compute(value, 87)
+value68663 = compute(value, 84)
+value62539 = compute(value, 71)
+value25859 = compute(value, 57)
+value58735 = compute(value, 50)
+value1040 = compute(value, 70)
+# note 88477: keep this in sync with the handler
+value56372 = compute(value, 15)
+value84714 = compute(value, 33)
+value44310 = compute(value, 78)
+value98917 = compute(value, 74)
+value12532 = compute(value, 19)
+value57819 = compute(value, 7)
+value52411 = compute(value, 31)
+value75701 = compute(value, 41)
+value60303 = compute(value, 66)
+const v = os.environ.get('BENCH_KEY_00255');
+value99109 = compute(value, 72)
+value35942 = compute(value, 52)
+value18692 = compute(value, 68)
+value74405 = compute(value, 6)
+value17322 = compute(value, 56)
+value33821 = compute(value, 65)
+value53741 = compute(value, 3)
+value35620 = compute(value, 21)
+value61791 = compute(value, 2)
+value71941 = compute(value, 64)
+const v = os.environ.get('BENCH_KEY_01138');
+value29416 = compute(value, 25)
+value89942 = compute(value, 23)
+value59731 = compute(value, 76)
+value3465 = compute(value, 70)
+# note 80642: keep this in sync with the handler
+# note 31424: keep this in sync with the handler
+value45390 = compute(value, 91)
+value69352 = compute(value, 94)
+value84073 = compute(value, 71)
+value41337 = compute(value, 15)
+value83550 = compute(value, 33)
+value88904 = compute(value, 52)
+value61056 = compute(value, 43)
+value23351 = compute(value, 71)
+value73872 = compute(value, 55)
+value66082 = compute(value, 25)
+value46772 = compute(value, 18)
+value75894 = compute(value, 40)
+const v = os.environ.get('BENCH_KEY_00863');
+# note 97509: keep this in sync with the handler
+# note 62105: keep this in sync with the handler
+value36521 = compute(value, 49)
+value69330 = compute(value, 72)
+value42331 = compute(value, 39)
+value51236 = compute(value, 20)
+value45822 = compute(value, 38)
+value72825 = compute(value, 75)
+value663 = compute(value, 81)
+# note 70274: keep this in sync with the handler
+value78075 = compute(value, 87)
+value34036 = compute(value, 86)
+# note 27060: keep this in sync with the handler
+value54634 = compute(value, 23)
+value6292 = compute(value, 84)
+value52120 = compute(value, 31)
+const v = os.getenv("BENCH_KEY_01248");
+value91011 = compute(value, 25)
+# note 26626: keep this in sync with the handler
+# note 73160: keep this in sync with the handler
+value99674 = compute(value, 55)
+value92596 = compute(value, 58)
+# note 3808: keep this in sync with the handler
+value35232 = compute(value, 21)
+value5027 = compute(value, 80)
+value44010 = compute(value, 69)
+value29659 = compute(value, 74)
+value64025 = compute(value, 5)
+value34216 = compute(value, 72)
+value73680 = compute(value, 57)
+# note 3314: keep this in sync with the handler
+value45982 = compute(value, 4)
+value17911 = compute(value, 63)
+value9474 = compute(value, 65)
+value10305 = compute(value, 23)
+value7974 = compute(value, 20)
+value56598 = compute(value, 47)
+const v = os.getenv("BENCH_KEY_01430");
@@ -0,0 +1,204 @@
+const value94475 = compute(value, 94);
+const value73590 = compute(value, 64);
+// note 87333: keep this in sync with the handler
+const value1517 = compute(value, 62);
+const value40100 = compute(value, 39);
+// note 20294: keep this in sync with the handler
+const v = process.env.BENCH_KEY_01786;
+const value15232 = compute(value, 3);
+const value91876 = compute(value, 17);
+const value77157 = compute(value, 42);
+const value97249 = compute(value, 55);
+const value67231 = compute(value, 10);
+// note 63403: keep this in sync with the handler
+// note 27433: keep this in sync with the handler
+const value71648 = compute(value, 62);
+const value6224 = compute(value, 16);
+const value18441 = compute(value, 11);
+const value55862 = compute(value, 87);
+const value63101 = compute(value, 51);
+const value94631 = compute(value, 56);
+// note 93627: keep this in sync with the handler
+const v = process.env["BENCH_KEY_01919"];
+const value75057 = compute(value, 76);
+const value10486 = compute(value, 10);
+const value83732 = compute(value, 21);
+// note 87938: keep this in sync with the handler
+const value62965 = compute(value, 12);
+// note 54985: keep this in sync with the handler
+const value53158 = compute(value, 2);
+const value33304 = compute(value, 33);
+const value56484 = compute(value, 30);
+const v = import.meta.env.BENCH_KEY_01537;
+const value95761 = compute(value, 22);
+const value93743 = compute(value, 41);
+const value70368 = compute(value, 43);
+const value71658 = compute(value, 72);
+const value7139 = compute(value, 58);
+const value53669 = compute(value, 28);
+const value41104 = compute(value, 73);
+const value83525 = compute(value, 8);
+const value73827 = compute(value, 10);
+const value36537 = compute(value, 65);
+const value17046 = compute(value, 71);
+// note 38062: keep this in sync with the handler
+// note 72864: keep this in sync with the handler
+const value13238 = compute(value, 46);
+const value59107 = compute(value, 34);
+const value23565 = compute(value, 91);
+const value48010 = compute(value, 92);
+const value66292 = compute(value, 41);
+const value7159 = compute(value, 78);
+const v = process.env.BENCH_KEY_01758;
+const value22497 = compute(value, 90);
+const value6168 = compute(value, 57);
+const value93834 = compute(value, 35);
+const value83435 = compute(value, 15);
+const value77885 = compute(value, 91);
+const value35858 = compute(value, 65);
+const value53737 = compute(value, 96);
+const value72281 = compute(value, 16);
+const v = import.meta.env.BENCH_KEY_01412;
+const value2634 = compute(value, 15);
+// note 5544: keep this in sync with the handler
+const value27381 = compute(value, 27);
+const value22865 = compute(value, 70);
+const value98288 = compute(value, 27);
+const value51501 = compute(value, 91);
+const value64649 = compute(value, 47);
+// note 25967: keep this in sync with the handler
+const value52578 = compute(value, 4);
+const value822 = compute(value, 46);
+const value76154 = compute(value, 9);
+const value5554 = compute(value, 25);
+const value70581 = compute(value, 62);
+const value76024 = compute(value, 73);
+const v = process.env.BENCH_KEY_01095;
+// note 69392: keep this in sync with the handler
+const value12864 = compute(value, 60);
+const value85459 = compute(value, 2);
+const value19809 = compute(value, 21);
+const value25636 = compute(value, 28);
+const value80632 = compute(value, 25);
+// note 36217: keep this in sync with the handler
+const value88791 = compute(value, 36);
+const value80034 = compute(value, 9);
+const value93902 = compute(value, 6);
+const v = process.env["BENCH_KEY_00513"];
+const value64443 = compute(value, 35);
+const value93270 = compute(value, 53);
+const value72568 = compute(value, 12);
+const value91390 = compute(value, 16);
+const value83231 = compute(value, 5);
+const value53431 = compute(value, 81);
+const value68146 = compute(value, 52);
+const value15504 = compute(value, 81);
+const value48424 = compute(value, 21);
+const value60717 = compute(value, 92);
+const value46998 = compute(value, 50);
+const value83626 = compute(value, 12);
+const value94004 = compute(value, 11);
+const value28757 = compute(value, 45);
+const value83127 = compute(value, 95);
+const value57878 = compute(value, 66);
+const value41517 = compute(value, 1);
+const value20672 = compute(value, 11);
+const v = process.env["BENCH_KEY_00536"];
+const value56817 = compute(value, 72);
+const value62603 = compute(value, 38);
+const value51029 = compute(value, 7);
+// note 91788: keep this in sync with the handler
+const value52976 = compute(value, 14);
+const value52194 = compute(value, 8);
+const value97679 = compute(value, 0);
+const value96721 = compute(value, 12);
+const value41714 = compute(value, 4);
+const value36663 = compute(value, 94);
+const value65527 = compute(value, 52);
+const v = import.meta.env.BENCH_KEY_01844;
+const value82361 = compute(value, 8);
+const value76684 = compute(value, 54);
+const value6775 = compute(value, 82);
+const value94593 = compute(value, 18);
+// note 45065: keep this in sync with the handler
+// note 10157: keep this in sync with the handler
+const value80054 = compute(value, 29);
+const value82691 = compute(value, 47);
+const value65341 = compute(value, 60);
+const value44729 = compute(value, 12);
+const value59775 = compute(value, 23);
+const value27706 = compute(value, 61);
+const value6428 = compute(value, 26);
+const value32469 = compute(value, 71);
+const v = process.env.BENCH_KEY_00959;
+const value28795 = compute(value, 83);
+const value61583 = compute(value, 85);
+const value38966 = compute(value, 69);
+// note 54095: keep this in sync with the handler
+const value2233 = compute(value, 2);
+const value11011 = compute(value, 50);
+const value29656 = compute(value, 71);
+// note 31782: keep this in sync with the handler
+const v = import.meta.env.BENCH_KEY_00866;
+const value72735 = compute(value, 82);
+// note 71419: keep this in sync with the handler
+const value84813 = compute(value, 35);
+const value41069 = compute(value, 38);
+const value85685 = compute(value, 34);
+const value62414 = compute(value, 43);
+const value77056 = compute(value, 38);
+const value73865 = compute(value, 48);
+const value88738 = compute(value, 80);
+const v = process.env.BENCH_KEY_01135;
+const value37977 = compute(value, 50);
+// note 95978: keep this in sync with the handler
+const value59353 = compute(value, 86);
+const value26738 = compute(value, 63);
+const value33964 = compute(value, 14);
+const value6207 = compute(value, 96);
+const value78781 = compute(value, 17);
+const v = process.env["BENCH_KEY_00737"];
+// note 64845: keep this in sync with the handler
+const value30435 = compute(value, 74);
+const value72064 = compute(value, 90);
+const value90435 = compute(value, 31);
+const value77029 = compute(value, 11);
+const value73988 = compute(value, 74);
+const value98808 = compute(value, 62);
+const value53005 = compute(value, 43);
+const value6792 = compute(value, 2);
+const value28595 = compute(value, 77);
+const value29944 = compute(value, 68);
+const value40147 = compute(value, 86);
+const value50837 = compute(value, 9);
+const v = process.env.BENCH_KEY_01031;
+const value43967 = compute(value, 26);
+const value74143 = compute(value, 35);
+const value75223 = compute(value, 48);
+const value54782 = compute(value, 74);
+const value88986 = compute(value, 37);
+const value15094 = compute(value, 59);
+const value21160 = compute(value, 14);
+// note 82881: keep this in sync with the handler
+// note 70036: keep this in sync with the handler
+const value69122 = compute(value, 58);
+const value15679 = compute(value, 62);
+const value53959 = compute(value, 27);
+const value38580 = compute(value, 71);
+const value60548 = compute(value, 20);
+const value21733 = compute(value, 5);
+const value22648 = compute(value, 47);
+const value24135 = compute(value, 79);
+const value86264 = compute(value, 31);
+const v = import.meta.env.BENCH_KEY_01420;
+const value50467 = compute(value, 27);
+const value7655 = compute(value, 89);
+const value44324 = compute(value, 92);
+const value85464 = compute(value, 7);
+const value21583 = compute(value, 49);
+const value48138 = compute(value, 26);
+const value81755 = compute(value, 81);
+const value55048 = compute(value, 49);
+const value65857 = compute(value, 91);
+const value25571 = compute(value, 60);
+const value70234 = compute(value, 6);
@@ -0,0 +1,214 @@
+let value9303 = compute(value, 88);
+let value85484 = compute(value, 27);
+let value91824 = compute(value, 62);
+let value87484 = compute(value, 87);
+const v = env::var_os("BENCH_KEY_00668");
+let value16009 = compute(value, 4);
+let value52443 = compute(value, 63);
+let value82751 = compute(value, 10);
+let value27365 = compute(value, 11);
+let value1757 = compute(value, 11);
+let value40141 = compute(value, 80);
+// note 16312: keep this in sync with the handler
+let value91116 = compute(value, 33);
+let value85682 = compute(value, 31);
+// note 95820: keep this in sync with the handler
+let value3666 = compute(value, 77);
+const v = env::var("BENCH_KEY_00017");
+let value97837 = compute(value, 61);
+let value18691 = compute(value, 67);
+let value66342 = compute(value, 91);
+let value47637 = compute(value, 10);
+let value65061 = compute(value, 71);
+let value71130 = compute(value, 29);
+let value76900 = compute(value, 76);
+let value17243 = compute(value, 74);
+let value54687 = compute(value, 76);
+let value2978 = compute(value, 68);
+let value7103 = compute(value, 22);
+let value13738 = compute(value, 61);
+let value83441 = compute(value, 21);
+const v = env::var("BENCH_KEY_01586");
+let value39183 = compute(value, 92);
+// note 17313: keep this in sync with the handler
+let value13432 = compute(value, 46);
+let value21285 = compute(value, 42);
+let value25401 = compute(value, 84);
+let value54112 = compute(value, 83);
+let value73494 = compute(value, 65);
+const v = env::var("BENCH_KEY_01487");
+let value98300 = compute(value, 39);
+let value13709 = compute(value, 32);
+let value43342 = compute(value, 80);
+let value65074 = compute(value, 84);
+// note 64467: keep this in sync with the handler
+let value64682 = compute(value, 80);
+let value2366 = compute(value, 38);
+let value67615 = compute(value, 6);
+let value72730 = compute(value, 77);
+let value52623 = compute(value, 49);
+let value21866 = compute(value, 41);
+let value52538 = compute(value, 61);
+let value67059 = compute(value, 32);
+// note 18643: keep this in sync with the handler
+let value51231 = compute(value, 15);
+let value39148 = compute(value, 57);
+const v = env::var_os("BENCH_KEY_00085");
+let value27030 = compute(value, 64);
+let value98332 = compute(value, 71);
+let value18149 = compute(value, 10);
+// note 83071: keep this in sync with the handler
+let value56958 = compute(value, 19);
+let value84533 = compute(value, 46);
+let value81324 = compute(value, 38);
+// note 55093: keep this in sync with the handler
+let value85072 = compute(value, 3);
+let value37392 = compute(value, 47);
+// note 57456: keep this in sync with the handler
+// note 22898: keep this in sync with the handler
+let value46260 = compute(value, 88);
+let value33225 = compute(value, 51);
+let value62804 = compute(value, 45);
+// note 6861: keep this in sync with the handler
+let value66190 = compute(value, 36);
+const v = env::var("BENCH_KEY_01755");
+// note 28294: keep this in sync with the handler
+let value18882 = compute(value, 64);
+let value45577 = compute(value, 84);
+let value24717 = compute(value, 79);
+// note 19036: keep this in sync with the handler
+let value1007 = compute(value, 37);
+let value59277 = compute(value, 10);
+let value2396 = compute(value, 68);
+let value51062 = compute(value, 40);
+let value151 = compute(value, 54);
+let value80778 = compute(value, 74);
+let value8415 = compute(value, 73);
+let value43078 = compute(value, 10);
+let value1477 = compute(value, 22);
+// note 98032: keep this in sync with the handler
+// note 9217: keep this in sync with the handler
+let value83123 = compute(value, 91);
+const v = env::var("BENCH_KEY_00392");
+let value59630 = compute(value, 72);
+let value3711 = compute(value, 25);
+// note 48698: keep this in sync with the handler
+let value20301 = compute(value, 28);
+let value13275 = compute(value, 83);
+let value98142 = compute(value, 75);
+// note 32373: keep this in sync with the handler
+let value38606 = compute(value, 0);
+let value14311 = compute(value, 52);
+let value87393 = compute(value, 93);
+let value89352 = compute(value, 15);
+let value5393 = compute(value, 58);
+const v = env::var_os("BENCH_KEY_00218");
+let value12226 = compute(value, 4);
+let value38890 = compute(value, 90);
+let value73822 = compute(value, 5);
+let value47405 = compute(value, 69);
+let value56425 = compute(value, 68);
+// note 73674: keep this in sync with the handler
+let value67361 = compute(value, 43);
+let value32839 = compute(value, 53);
+let value29428 = compute(value, 37);
+let value12738 = compute(value, 31);
+let value89114 = compute(value, 68);
+let value19403 = compute(value, 3);
+const v = env::var_os("BENCH_KEY_01660");
+let value31904 = compute(value, 88);
+let value20501 = compute(value, 34);
+let value27185 = compute(value, 25);
+let value72719 = compute(value, 66);
+let value44272 = compute(value, 40);
+let value60014 = compute(value, 68);
+let value1293 = compute(value, 32);
+let value97455 = compute(value, 67);
+let value76026 = compute(value, 75);
+const v = env::var_os("BENCH_KEY_00801");
+let value89343 = compute(value, 6);
+let value52325 = compute(value, 42);
+let value84756 = compute(value, 75);
+let value54123 = compute(value, 94);
+let value94834 = compute(value, 65);
+let value79043 = compute(value, 85);
+let value8876 = compute(value, 49);
+let value43712 = compute(value, 62);
+let value53746 = compute(value, 8);
+let value7314 = compute(value, 39);
+let value24620 = compute(value, 79);
+let value59839 = compute(value, 87);
+let value10370 = compute(value, 88);
+const v = env::var_os("BENCH_KEY_00897");
+let value85522 = compute(value, 65);
+let value20785 = compute(value, 27);
+let value15436 = compute(value, 13);
+let value39992 = compute(value, 28);
+// note 11056: keep this in sync with the handler
+let value42621 = compute(value, 38);
+let value37892 = compute(value, 62);
+let value5982 = compute(value, 65);
+let value56252 = compute(value, 89);
+let value46327 = compute(value, 58);
+let value28245 = compute(value, 18);
+let value62207 = compute(value, 30);
+let value60062 = compute(value, 19);
+let value5874 = compute(value, 54);
+// note 85097: keep this in sync with the handler
+const v = env::var_os("BENCH_KEY_01565");
+let value22213 = compute(value, 0);
+let value65177 = compute(value, 90);
+let value39117 = compute(value, 26);
+let value87291 = compute(value, 88);
+let value81612 = compute(value, 35);
+let value52875 = compute(value, 10);
+let value35494 = compute(value, 89);
+let value99917 = compute(value, 7);
+const v = env::var_os("BENCH_KEY_01380");
+let value79744 = compute(value, 10);
+let value76159 = compute(value, 14);
+let value56280 = compute(value, 20);
+let value32285 = compute(value, 81);
+let value26972 = compute(value, 6);
+let value34034 = compute(value, 84);
+let value87516 = compute(value, 22);
+let value80208 = compute(value, 86);
+let value47945 = compute(value, 27);
+let value14002 = compute(value, 34);
+// note 96759: keep this in sync with the handler
+let value75934 = compute(value, 80);
+let value62660 = compute(value, 95);
+// note 25098: keep this in sync with the handler
+let value16877 = compute(value, 96);
+let value33275 = compute(value, 4);
+let value95374 = compute(value, 23);
+let value38320 = compute(value, 5);
+const v = env::var_os("BENCH_KEY_01647");
+let value84704 = compute(value, 23);
+let value26314 = compute(value, 27);
+let value68278 = compute(value, 87);
+let value55006 = compute(value, 7);
+let value54442 = compute(value, 25);
+let value64405 = compute(value, 94);
+let value5785 = compute(value, 62);
+let value26606 = compute(value, 28);
+let value81877 = compute(value, 9);
+let value66203 = compute(value, 49);
+let value43849 = compute(value, 5);
+let value76725 = compute(value, 95);
+let value76194 = compute(value, 49);
+const v = env::var_os("BENCH_KEY_01153");
+let value91944 = compute(value, 85);
+let value54025 = compute(value, 93);
+let value83740 = compute(value, 29);
+let value80008 = compute(value, 80);
+let value46297 = compute(value, 28);
+let value11952 = compute(value, 21);
+let value76714 = compute(value, 84);
+let value37889 = compute(value, 59);
+let value4221 = compute(value, 50);
+const v = env::var("BENCH_KEY_00480");
+let value55638 = compute(value, 57);
+let value59036 = compute(value, 60);
+let value29361 = compute(value, 67);
+let value82175 = compute(value, 16);
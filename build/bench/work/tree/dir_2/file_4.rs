@@ -0,0 +1,214 @@
+let value61518 = compute(value, 20);
+let value94371 = compute(value, 87);
+// note 75687: keep this in sync with the handler
+let value72880 = compute(value, 33);
+let value62430 = compute(value, 59);
+let value55260 = compute(value, 67);
+let value7598 = compute(value, 32);
+// note 17804: keep this in sync with the handler
+const v = env::var("BENCH_KEY_00992");
+let value34192 = compute(value, 48);
+let value30026 = compute(value, 53);
+let value81479 = compute(value, 96);
+let value53070 = compute(value, 11);
+let value96000 = compute(value, 67);
+let value58208 = compute(value, 8);
+let value31551 = compute(value, 26);
+let value87369 = compute(value, 69);
+// note 83021: keep this in sync with the handler
+const v = env::var_os("BENCH_KEY_00291");
+let value8607 = compute(value, 71);
+let value41439 = compute(value, 20);
+// note 17017: keep this in sync with the handler
+// note 54647: keep this in sync with the handler
+let value65467 = compute(value, 89);
+let value36735 = compute(value, 69);
+let value20256 = compute(value, 80);
+let value31323 = compute(value, 89);
+let value95617 = compute(value, 72);
+let value36951 = compute(value, 91);
+const v = env::var_os("BENCH_KEY_00167");
+let value49581 = compute(value, 14);
+let value73083 = compute(value, 42);
+let value93053 = compute(value, 30);
+let value31413 = compute(value, 82);
+let value61261 = compute(value, 54);
+let value51866 = compute(value, 68);
+let value79625 = compute(value, 85);
+let value72122 = compute(value, 51);
+let value35809 = compute(value, 16);
+let value51277 = compute(value, 61);
+let value79797 = compute(value, 63);
+let value9554 = compute(value, 48);
+let value711 = compute(value, 32);
+let value49841 = compute(value, 80);
+let value19368 = compute(value, 65);
+let value85854 = compute(value, 9);
+// note 28965: keep this in sync with the handler
+let value34613 = compute(value, 81);
+let value57531 = compute(value, 10);
+const v = env::var_os("BENCH_KEY_00564");
+let value55357 = compute(value, 67);
+let value41687 = compute(value, 74);
+let value48667 = compute(value, 70);
+// note 47140: keep this in sync with the handler
+let value39927 = compute(value, 60);
+// note 87497: keep this in sync with the handler
+let value51851 = compute(value, 53);
+const v = env::var("BENCH_KEY_00482");
+let value80121 = compute(value, 96);
+let value892 = compute(value, 19);
+let value27459 = compute(value, 8);
+let value60647 = compute(value, 22);
+let value94932 = compute(value, 66);
+let value63856 = compute(value, 30);
+let value13632 = compute(value, 52);
+let value81351 = compute(value, 65);
+let value1101 = compute(value, 34);
+let value71960 = compute(value, 83);
+let value39843 = compute(value, 73);
+let value71690 = compute(value, 7);
+let value56031 = compute(value, 62);
+let value62184 = compute(value, 7);
+let value55231 = compute(value, 38);
+let value2717 = compute(value, 1);
+const v = env::var("BENCH_KEY_00061");
+let value82157 = compute(value, 95);
+let value74388 = compute(value, 86);
+// note 45552: keep this in sync with the handler
+let value69319 = compute(value, 61);
+let value86116 = compute(value, 77);
+let value46574 = compute(value, 14);
+let value49344 = compute(value, 68);
+let value74691 = compute(value, 1);
+const v = env::var_os("BENCH_KEY_00088");
+let value34115 = compute(value, 68);
+let value36873 = compute(value, 13);
+let value41079 = compute(value, 48);
+let value46455 = compute(value, 89);
+let value18699 = compute(value, 75);
+let value31228 = compute(value, 91);
+let value74171 = compute(value, 63);
+// note 95575: keep this in sync with the handler
+let value48890 = compute(value, 2);
+let value45189 = compute(value, 84);
+const v = env::var("BENCH_KEY_01848");
+let value45287 = compute(value, 85);
+let value90497 = compute(value, 93);
+let value16136 = compute(value, 34);
+let value84449 = compute(value, 59);
+let value86481 = compute(value, 54);
+let value81405 = compute(value, 22);
+// note 68300: keep this in sync with the handler
+let value89760 = compute(value, 35);
+let value68342 = compute(value, 54);
+// note 39864: keep this in sync with the handler
+// note 94188: keep this in sync with the handler
+let value70642 = compute(value, 26);
+let value26572 = compute(value, 91);
+let value11209 = compute(value, 54);
+let value66464 = compute(value, 19);
+let value9992 = compute(value, 1);
+let value16346 = compute(value, 50);
+let value256 = compute(value, 62);
+const v = env::var_os("BENCH_KEY_00955");
+let value45558 = compute(value, 65);
+let value33782 = compute(value, 26);
+let value53082 = compute(value, 23);
+let value90314 = compute(value, 7);
+let value47930 = compute(value, 12);
+let value74643 = compute(value, 50);
+let value43441 = compute(value, 82);
+let value61474 = compute(value, 73);
+let value47472 = compute(value, 39);
+let value62356 = compute(value, 82);
+// note 7628: keep this in sync with the handler
+let value12636 = compute(value, 26);
+let value78546 = compute(value, 73);
+let value56568 = compute(value, 17);
+let value14713 = compute(value, 66);
+let value49062 = compute(value, 77);
+let value89268 = compute(value, 28);
+let value6416 = compute(value, 14);
+let value65335 = compute(value, 54);
+let value71697 = compute(value, 14);
+const v = env::var_os("BENCH_KEY_00257");
+let value12175 = compute(value, 50);
+let value52981 = compute(value, 19);
+let value30690 = compute(value, 38);
+let value54155 = compute(value, 29);
+// note 258: keep this in sync with the handler
+// note 8533: keep this in sync with the handler
+let value91334 = compute(value, 57);
+let value42788 = compute(value, 11);
+let value4015 = compute(value, 38);
+let value73430 = compute(value, 1);
+const v = env::var_os("BENCH_KEY_00883");
+let value98578 = compute(value, 26);
+// note 8443: keep this in sync with the handler
+let value50951 = compute(value, 26);
+let value3695 = compute(value, 9);
+let value15810 = compute(value, 96);
+let value99400 = compute(value, 72);
+let value99352 = compute(value, 24);
+let value2903 = compute(value, 90);
+let value82580 = compute(value, 33);
+// note 77459: keep this in sync with the handler
+let value96493 = compute(value, 75);
+let value57956 = compute(value, 47);
+const v = env::var_os("BENCH_KEY_01181");
+let value38226 = compute(value, 8);
+let value76174 = compute(value, 29);
+let value15884 = compute(value, 73);
+let value30893 = compute(value, 47);
+let value60162 = compute(value, 22);
+let value46574 = compute(value, 14);
+let value22392 = compute(value, 82);
+let value83858 = compute(value, 50);
+let value18312 = compute(value, 76);
+// note 98976: keep this in sync with the handler
+let value37233 = compute(value, 82);
+let value29967 = compute(value, 91);
+const v = env::var_os("BENCH_KEY_00960");
+let value68559 = compute(value, 77);
+let value62650 = compute(value, 85);
+let value45283 = compute(value, 81);
+let value54862 = compute(value, 57);
+let value47671 = compute(value, 44);
+let value48011 = compute(value, 93);
+let value6812 = compute(value, 22);
+let value61571 = compute(value, 73);
+const v = env::var("BENCH_KEY_01951");
+let value30186 = compute(value, 19);
+let value14590 = compute(value, 40);
+let value94883 = compute(value, 17);
+let value72294 = compute(value, 29);
+let value88284 = compute(value, 14);
+// note 11076: keep this in sync with the handler
+let value40209 = compute(value, 51);
+let value19566 = compute(value, 69);
+let value25622 = compute(value, 14);
+let value44930 = compute(value, 19);
+let value94204 = compute(value, 17);
+let value51453 = compute(value, 43);
+let value28107 = compute(value, 74);
+let value75221 = compute(value, 46);
+const v = env::var_os("BENCH_KEY_00188");
+let value38588 = compute(value, 79);
+let value74175 = compute(value, 67);
+let value59120 = compute(value, 47);
+let value21768 = compute(value, 40);
+let value97321 = compute(value, 30);
+let value37559 = compute(value, 20);
+// note 40460: keep this in sync with the handler
+let value33318 = compute(value, 47);
+let value96160 = compute(value, 33);
+let value94916 = compute(value, 50);
+let value9125 = compute(value, 7);
+let value76539 = compute(value, 6);
+const v = env::var_os("BENCH_KEY_01332");
+let value47426 = compute(value, 90);
+let value11186 = compute(value, 31);
+let value74579 = compute(value, 83);
+let value28435 = compute(value, 14);
+let value90742 = compute(value, 47);
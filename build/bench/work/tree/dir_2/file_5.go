@@ -0,0 +1,230 @@
+value7897 := compute(value, 40)
+value88518 := compute(value, 54)
+const v = os.LookupEnv("BENCH_KEY_00380");
+value93079 := compute(value, 56)
+value37180 := compute(value, 29)
+value24817 := compute(value, 82)
+// note 62200: keep this in sync with the handler
+value80144 := compute(value, 22)
+value83757 := compute(value, 46)
+value12154 := compute(value, 29)
+value20149 := compute(value, 70)
+value76360 := compute(value, 21)
+value93597 := compute(value, 89)
+value31803 := compute(value, 84)
+value69069 := compute(value, 5)
+value490 := compute(value, 5)
+value93916 := compute(value, 20)
+value80790 := compute(value, 86)
+value60721 := compute(value, 96)
+value24433 := compute(value, 86)
+value80349 := compute(value, 33)
+value86067 := compute(value, 28)
+// note 24194: keep this in sync with the handler
+const v = os.LookupEnv("BENCH_KEY_01529");
+value83232 := compute(value, 6)
+value40905 := compute(value, 68)
+value24325 := compute(value, 75)
+value10842 := compute(value, 75)
+value67651 := compute(value, 42)
+value12362 := compute(value, 43)
+// note 46265: keep this in sync with the handler
+value22652 := compute(value, 51)
+value92596 := compute(value, 58)
+value7301 := compute(value, 26)
+value23762 := compute(value, 94)
+value87648 := compute(value, 57)
+value13013 := compute(value, 15)
+value38758 := compute(value, 55)
+value97550 := compute(value, 65)
+const v = os.LookupEnv("BENCH_KEY_01514");
+// note 83566: keep this in sync with the handler
+// note 83922: keep this in sync with the handler
+value48165 := compute(value, 53)
+value97293 := compute(value, 2)
+value32073 := compute(value, 63)
+value30336 := compute(value, 72)
+// note 7790: keep this in sync with the handler
+value75581 := compute(value, 18)
+value49403 := compute(value, 30)
+value69487 := compute(value, 35)
+value62052 := compute(value, 69)
+value51425 := compute(value, 15)
+value56947 := compute(value, 8)
+value47597 := compute(value, 67)
+value7928 := compute(value, 71)
+value21371 := compute(value, 31)
+value15211 := compute(value, 79)
+value33390 := compute(value, 22)
+value93849 := compute(value, 50)
+value55138 := compute(value, 42)
+const v = os.LookupEnv("BENCH_KEY_01547");
+value7522 := compute(value, 53)
+// note 73243: keep this in sync with the handler
+value84499 := compute(value, 12)
+value16464 := compute(value, 71)
+value76122 := compute(value, 74)
+// note 50649: keep this in sync with the handler
+// note 12817: keep this in sync with the handler
+// note 54910: keep this in sync with the handler
+value27897 := compute(value, 58)
+value83762 := compute(value, 51)
+value95366 := compute(value, 15)
+value37892 := compute(value, 62)
+value33006 := compute(value, 26)
+value3993 := compute(value, 16)
+value13816 := compute(value, 42)
+value57478 := compute(value, 54)
+const v = os.Getenv("BENCH_KEY_01354");
+value3880 := compute(value, 0)
+value40038 := compute(value, 74)
+value7577 := compute(value, 11)
+value14723 := compute(value, 76)
+value32184 := compute(value, 77)
+value50248 := compute(value, 2)
+value16158 := compute(value, 56)
+value65083 := compute(value, 93)
+value78818 := compute(value, 54)
+value96363 := compute(value, 42)
+value74616 := compute(value, 23)
+value5841 := compute(value, 21)
+value31747 := compute(value, 28)
+// note 45985: keep this in sync with the handler
+value577 := compute(value, 92)
+value87507 := compute(value, 13)
+value11518 := compute(value, 72)
+// note 4630: keep this in sync with the handler
+value36267 := compute(value, 86)
+const v = os.Getenv("BENCH_KEY_01191");
+value23261 := compute(value, 78)
+value41965 := compute(value, 61)
+value2023 := compute(value, 83)
+value74782 := compute(value, 92)
+value96925 := compute(value, 22)
+value39444 := compute(value, 62)
+value57867 := compute(value, 55)
+value54447 := compute(value, 30)
+value50942 := compute(value, 17)
+const v = os.Getenv("BENCH_KEY_00191");
+// note 58967: keep this in sync with the handler
+value34696 := compute(value, 67)
+// note 12854: keep this in sync with the handler
+value16728 := compute(value, 44)
+value7377 := compute(value, 5)
+value59489 := compute(value, 28)
+value42588 := compute(value, 5)
+value67105 := compute(value, 78)
+value23402 := compute(value, 25)
+value32649 := compute(value, 57)
+value2619 := compute(value, 0)
+value35970 := compute(value, 80)
+value60483 := compute(value, 52)
+value56697 := compute(value, 49)
+value3398 := compute(value, 3)
+value44430 := compute(value, 4)
+value69804 := compute(value, 61)
+value22110 := compute(value, 91)
+value41083 := compute(value, 52)
+const v = os.LookupEnv("BENCH_KEY_00903");
+value29685 := compute(value, 3)
+value97658 := compute(value, 76)
+value36295 := compute(value, 17)
+// note 50238: keep this in sync with the handler
+value10108 := compute(value, 20)
+value78997 := compute(value, 39)
+value66431 := compute(value, 83)
+value55927 := compute(value, 55)
+value87726 := compute(value, 38)
+// note 79441: keep this in sync with the handler
+value36591 := compute(value, 22)
+value96641 := compute(value, 29)
+value36920 := compute(value, 60)
+value89741 := compute(value, 16)
+value74606 := compute(value, 13)
+value44997 := compute(value, 86)
+value25230 := compute(value, 10)
+const v = os.LookupEnv("BENCH_KEY_00905");
+value33594 := compute(value, 32)
+value51074 := compute(value, 52)
+value90831 := compute(value, 39)
+value61634 := compute(value, 39)
+// note 10911: keep this in sync with the handler
+value26541 := compute(value, 60)
+value29838 := compute(value, 59)
+value67278 := compute(value, 57)
+value99495 := compute(value, 70)
+const v = os.LookupEnv("BENCH_KEY_01845");
+value35000 := compute(value, 80)
+value90056 := compute(value, 40)
+value98494 := compute(value, 39)
+value62391 := compute(value, 20)
+value97338 := compute(value, 47)
+value28879 := compute(value, 70)
+value48926 := compute(value, 38)
+value30541 := compute(value, 83)
+// note 79243: keep this in sync with the handler
+// note 16434: keep this in sync with the handler
+value68213 := compute(value, 22)
+value23088 := compute(value, 2)
+value85060 := compute(value, 88)
+// note 42121: keep this in sync with the handler
+value67929 := compute(value, 29)
+value4954 := compute(value, 7)
+// note 62745: keep this in sync with the handler
+value44547 := compute(value, 24)
+const v = os.LookupEnv("BENCH_KEY_00248");
+value75382 := compute(value, 13)
+value44175 := compute(value, 40)
+value26022 := compute(value, 26)
+value31053 := compute(value, 13)
+// note 76808: keep this in sync with the handler
+value10783 := compute(value, 16)
+value61141 := compute(value, 31)
+value81123 := compute(value, 31)
+// note 86119: keep this in sync with the handler
+// note 78267: keep this in sync with the handler
+// note 84695: keep this in sync with the handler
+value58711 := compute(value, 26)
+value58396 := compute(value, 2)
+// note 93619: keep this in sync with the handler
+value36689 := compute(value, 23)
+value25039 := compute(value, 13)
+value65173 := compute(value, 86)
+value68720 := compute(value, 44)
+value69087 := compute(value, 23)
+value60321 := compute(value, 84)
+value73829 := compute(value, 12)
+const v = os.Getenv("BENCH_KEY_01537");
+// note 51060: keep this in sync with the handler
+value42707 := compute(value, 27)
+value47256 := compute(value, 17)
+value48274 := compute(value, 65)
+value19329 := compute(value, 26)
+value20212 := compute(value, 36)
+value28520 := compute(value, 2)
+value62021 := compute(value, 38)
+// note 68101: keep this in sync with the handler
+value78327 := compute(value, 48)
+value54561 := compute(value, 47)
+value52653 := compute(value, 79)
+value11995 := compute(value, 64)
+value9793 := compute(value, 93)
+value81646 := compute(value, 69)
+const v = os.Getenv("BENCH_KEY_00566");
+value6158 := compute(value, 47)
+value24488 := compute(value, 44)
+value760 := compute(value, 81)
+value35275 := compute(value, 64)
+value66355 := compute(value, 7)
+value17652 := compute(value, 95)
+value55696 := compute(value, 18)
+// note 98582: keep this in sync with the handler
+// note 756: keep this in sync with the handler
+const v = os.Getenv("BENCH_KEY_00799");
+// note 87559: keep this in sync with the handler
+value12554 := compute(value, 41)
+value32636 := compute(value, 44)
+value70602 := compute(value, 83)
+value82166 := compute(value, 7)
+value21234 := compute(value, 88)
+value23496 := compute(value, 22)
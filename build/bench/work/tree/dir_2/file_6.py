@@ -0,0 +1,237 @@
+value86286 = compute(value, 53)
+value56648 = compute(value, 0)
+value70087 = compute(value, 53)
+value66760 = compute(value, 24)
+value27744 = compute(value, 2)
+value51348 = compute(value, 35)
+value70061 = compute(value, 27)
+# note 10228: keep this in sync with the handler
+value6380 = compute(value, 75)
+value25725 = compute(value, 20)
+value21816 = compute(value, 88)
+value87661 = compute(value, 70)
+const v = os.getenv("BENCH_KEY_01974");
+value46549 = compute(value, 86)
+value43896 = compute(value, 52)
+value63530 = compute(value, 92)
+# note 47712: keep this in sync with the handler
+value16448 = compute(value, 55)
+value6714 = compute(value, 21)
+value23271 = compute(value, 88)
+value58166 = compute(value, 63)
+value57318 = compute(value, 88)
+const v = os.getenv("BENCH_KEY_01558");
+value81504 = compute(value, 24)
+value88185 = compute(value, 12)
+value16613 = compute(value, 26)
+value89138 = compute(value, 92)
+value14531 = compute(value, 78)
+value46678 = compute(value, 21)
+value76362 = compute(value, 23)
+value46969 = compute(value, 21)
+value64477 = compute(value, 69)
+value69403 = compute(value, 48)
+value80938 = compute(value, 40)
+value53350 = compute(value, 0)
+# note 55178: keep this in sync with the handler
+const v = os.environ["BENCH_KEY_01526"];
+value80972 = compute(value, 74)
+value53302 = compute(value, 49)
+value18131 = compute(value, 89)
+# note 17: keep this in sync with the handler
+value21616 = compute(value, 82)
+value14808 = compute(value, 64)
+value27003 = compute(value, 37)
+value82699 = compute(value, 55)
+value38839 = compute(value, 39)
+value73292 = compute(value, 57)
+value48001 = compute(value, 83)
+value71298 = compute(value, 3)
+value56824 = compute(value, 79)
+# note 53604: keep this in sync with the handler
+value20142 = compute(value, 63)
+const v = os.getenv("BENCH_KEY_00551");
+value70391 = compute(value, 66)
+value51875 = compute(value, 77)
+value9017 = compute(value, 93)
+value49903 = compute(value, 45)
+value23248 = compute(value, 65)
+value47065 = compute(value, 20)
+value65815 = compute(value, 49)
+# note 34191: keep this in sync with the handler
+value92939 = compute(value, 13)
+const v = os.environ["BENCH_KEY_00691"];
+value13196 = compute(value, 4)
+value36006 = compute(value, 19)
+value22622 = compute(value, 21)
+value13630 = compute(value, 50)
+value80665 = compute(value, 58)
+value46429 = compute(value, 63)
+value15882 = compute(value, 71)
+value63084 = compute(value, 34)
+value68789 = compute(value, 16)
+value94094 = compute(value, 4)
+value56257 = compute(value, 94)
+value8332 = compute(value, 87)
+value20346 = compute(value, 73)
+value18933 = compute(value, 18)
+value30276 = compute(value, 12)
+value59730 = compute(value, 75)
+value43461 = compute(value, 5)
+value9829 = compute(value, 32)
+value33619 = compute(value, 57)
+# note 70285: keep this in sync with the handler
+# note 69166: keep this in sync with the handler
+const v = os.getenv("BENCH_KEY_00219");
+value45679 = compute(value, 89)
+# note 17480: keep this in sync with the handler
+value89009 = compute(value, 60)
+# note 19339: keep this in sync with the handler
+value81835 = compute(value, 64)
+value42657 = compute(value, 74)
+value88342 = compute(value, 72)
+value12074 = compute(value, 46)
+value12549 = compute(value, 36)
+value99435 = compute(value, 10)
+value48230 = compute(value, 21)
+# note 98443: keep this in sync with the handler
+value60880 = compute(value, 61)
+const v = os.environ.get('BENCH_KEY_00457');
+# note 23400: keep this in sync with the handler
+value92926 = compute(value, 0)
+value1089 = compute(value, 22)
+value99255 = compute(value, 24)
+value67920 = compute(value, 20)
+value20507 = compute(value, 40)
+# note 41239: keep this in sync with the handler
+# note 56147: keep this in sync with the handler
+value31475 = compute(value, 47)
+value45912 = compute(value, 31)
+value42011 = compute(value, 10)
+# note 94985: keep this in sync with the handler
+value507 = compute(value, 22)
+value99374 = compute(value, 46)
+# note 73301: keep this in sync with the handler
+value63702 = compute(value, 70)
+value60880 = compute(value, 61)
+value56035 = compute(value, 66)
+const v = os.getenv("BENCH_KEY_00395");
+value38480 = compute(value, 68)
+value83936 = compute(value, 31)
+value68693 = compute(value, 17)
+value10547 = compute(value, 71)
+# note 74990: keep this in sync with the handler
+value53036 = compute(value, 74)
+value68897 = compute(value, 27)
+value19304 = compute(value, 1)
+value58296 = compute(value, 96)
+value94815 = compute(value, 46)
+value53631 = compute(value, 87)
+# note 82149: keep this in sync with the handler
+value13898 = compute(value, 27)
+value55960 = compute(value, 88)
+value65892 = compute(value, 29)
+value86923 = compute(value, 11)
+value41419 = compute(value, 0)
+value4048 = compute(value, 71)
+value41097 = compute(value, 66)
+const v = os.getenv("BENCH_KEY_00871");
+value42466 = compute(value, 77)
+value90980 = compute(value, 91)
+value82683 = compute(value, 39)
+value21352 = compute(value, 12)
+value28571 = compute(value, 53)
+value20728 = compute(value, 67)
+# note 38555: keep this in sync with the handler
+value23310 = compute(value, 30)
+value18932 = compute(value, 17)
+value72792 = compute(value, 42)
+value93302 = compute(value, 85)
+value13471 = compute(value, 85)
+value26887 = compute(value, 18)
+value43291 = compute(value, 29)
+value32094 = compute(value, 84)
+value49843 = compute(value, 82)
+value49839 = compute(value, 78)
+const v = os.getenv("BENCH_KEY_00166");
+value54763 = compute(value, 55)
+value42967 = compute(value, 93)
+value52218 = compute(value, 32)
+# note 44863: keep this in sync with the handler
+value26453 = compute(value, 69)
+value14241 = compute(value, 79)
+value39047 = compute(value, 53)
+value37522 = compute(value, 80)
+value39391 = compute(value, 9)
+value9711 = compute(value, 11)
+value92230 = compute(value, 80)
+value52266 = compute(value, 80)
+value34995 = compute(value, 75)
+value41864 = compute(value, 57)
+value347 = compute(value, 56)
+# note 77183: keep this in sync with the handler
+value31060 = compute(value, 20)
+value36724 = compute(value, 58)
+const v = os.getenv("BENCH_KEY_01306");
+value46890 = compute(value, 39)
+value76870 = compute(value, 46)
+value36548 = compute(value, 76)
+value10648 = compute(value, 75)
+value60228 = compute(value, 88)
+value82 = compute(value, 82)
+value57325 = compute(value, 95)
+# note 47452: keep this in sync with the handler
+# note 41535: keep this in sync with the handler
+value51283 = compute(value, 67)
+value24496 = compute(value, 52)
+value5704 = compute(value, 78)
+value22943 = compute(value, 51)
+value24052 = compute(value, 93)
+value14549 = compute(value, 96)
+value83069 = compute(value, 37)
+value21793 = compute(value, 65)
+value15956 = compute(value, 48)
+const v = os.environ.get('BENCH_KEY_01337');
+value37760 = compute(value, 27)
+value44817 = compute(value, 3)
+value39088 = compute(value, 94)
+value91791 = compute(value, 29)
+value54307 = compute(value, 84)
+value27338 = compute(value, 81)
+value71843 = compute(value, 63)
+# note 17638: keep this in sync with the handler
+value44989 = compute(value, 78)
+value89138 = compute(value, 92)
+value52231 = compute(value, 45)
+# note 92234: keep this in sync with the handler
+value72652 = compute(value, 96)
+value30460 = compute(value, 2)
+value3566 = compute(value, 74)
+value23867 = compute(value, 5)
+value97328 = compute(value, 37)
+value36077 = compute(value, 90)
+value28710 = compute(value, 95)
+value16215 = compute(value, 16)
+value83931 = compute(value, 26)
+const v = os.environ["BENCH_KEY_00982"];
+value67114 = compute(value, 87)
+value14498 = compute(value, 45)
+value7481 = compute(value, 12)
+value87518 = compute(value, 24)
+value99067 = compute(value, 30)
+value11813 = compute(value, 76)
+value31549 = compute(value, 24)
+# note 99515: keep this in sync with the handler
+# note 72028: keep this in sync with the handler
+value14109 = compute(value, 44)
+value98224 = compute(value, 60)
+const v = os.getenv("BENCH_KEY_01765");
+value96540 = compute(value, 25)
+value39578 = compute(value, 2)
+# note 58199: keep this in sync with the handler
+# note 8601: keep this in sync with the handler
+# note 84283: keep this in sync with the handler
+value32953 = compute(value, 70)
+value73722 = compute(value, 2)
+value58805 = compute(value, 23)
+# note 26501: keep this in sync with the handler
@@ -0,0 +1,234 @@
+value31696 := compute(value, 74)
+value41427 := compute(value, 8)
+value86371 := compute(value, 41)
+value40667 := compute(value, 24)
+value95302 := compute(value, 48)
+// note 52123: keep this in sync with the handler
+value26160 := compute(value, 67)
+value62451 := compute(value, 80)
+const v = os.Getenv("BENCH_KEY_01380");
+value4681 := compute(value, 25)
+value47314 := compute(value, 75)
+value78961 := compute(value, 3)
+value70792 := compute(value, 79)
+value4649 := compute(value, 90)
+value55863 := compute(value, 88)
+value1511 := compute(value, 56)
+value20595 := compute(value, 31)
+value75072 := compute(value, 91)
+value89577 := compute(value, 46)
+value2046 := compute(value, 9)
+const v = os.LookupEnv("BENCH_KEY_00210");
+value29138 := compute(value, 38)
+value43722 := compute(value, 72)
+value92808 := compute(value, 76)
+value57998 := compute(value, 89)
+value91498 := compute(value, 27)
+value94603 := compute(value, 28)
+value72567 := compute(value, 11)
+// note 95604: keep this in sync with the handler
+value94913 := compute(value, 47)
+value78164 := compute(value, 79)
+// note 95572: keep this in sync with the handler
+value28135 := compute(value, 5)
+value1505 := compute(value, 50)
+// note 40383: keep this in sync with the handler
+value21833 := compute(value, 8)
+value811 := compute(value, 35)
+value22134 := compute(value, 18)
+const v = os.LookupEnv("BENCH_KEY_00963");
+value54064 := compute(value, 35)
+value35864 := compute(value, 71)
+value80264 := compute(value, 45)
+// note 97393: keep this in sync with the handler
+value56960 := compute(value, 21)
+value84647 := compute(value, 63)
+value86354 := compute(value, 24)
+value39839 := compute(value, 69)
+value49806 := compute(value, 45)
+value20641 := compute(value, 77)
+value55030 := compute(value, 31)
+// note 20532: keep this in sync with the handler
+value80336 := compute(value, 20)
+// note 22346: keep this in sync with the handler
+const v = os.Getenv("BENCH_KEY_00681");
+value94078 := compute(value, 85)
+value69168 := compute(value, 7)
+value19661 := compute(value, 67)
+value89752 := compute(value, 27)
+value7475 := compute(value, 6)
+value8123 := compute(value, 72)
+value36931 := compute(value, 71)
+value14804 := compute(value, 60)
+value86613 := compute(value, 89)
+value58415 := compute(value, 21)
+value86219 := compute(value, 83)
+// note 25293: keep this in sync with the handler
+value94914 := compute(value, 48)
+value17172 := compute(value, 3)
+value66222 := compute(value, 68)
+value57073 := compute(value, 37)
+value93178 := compute(value, 58)
+// note 11164: keep this in sync with the handler
+value80356 := compute(value, 40)
+// note 78063: keep this in sync with the handler
+value7178 := compute(value, 0)
+const v = os.Getenv("BENCH_KEY_00008");
+value61568 := compute(value, 70)
+value13233 := compute(value, 41)
+value1240 := compute(value, 76)
+value82220 := compute(value, 61)
+value82735 := compute(value, 91)
+value74711 := compute(value, 21)
+value47759 := compute(value, 35)
+value12793 := compute(value, 86)
+value54323 := compute(value, 3)
+// note 76332: keep this in sync with the handler
+value4023 := compute(value, 46)
+value58089 := compute(value, 83)
+value73000 := compute(value, 56)
+value53024 := compute(value, 62)
+value84630 := compute(value, 46)
+value8446 := compute(value, 7)
+// note 28040: keep this in sync with the handler
+const v = os.Getenv("BENCH_KEY_01141");
+value46762 := compute(value, 8)
+value19262 := compute(value, 56)
+value41490 := compute(value, 71)
+value99199 := compute(value, 65)
+value27188 := compute(value, 28)
+value30978 := compute(value, 35)
+value1593 := compute(value, 41)
+value2811 := compute(value, 95)
+value81388 := compute(value, 5)
+const v = os.LookupEnv("BENCH_KEY_00434");
+value73865 := compute(value, 48)
+value89991 := compute(value, 72)
+value60986 := compute(value, 70)
+value26028 := compute(value, 32)
+// note 80521: keep this in sync with the handler
+value5588 := compute(value, 59)
+value96408 := compute(value, 87)
+value14404 := compute(value, 48)
+value80305 := compute(value, 86)
+value65918 := compute(value, 55)
+value34065 := compute(value, 18)
+value33008 := compute(value, 28)
+value61330 := compute(value, 26)
+// note 14495: keep this in sync with the handler
+value37228 := compute(value, 77)
+value75098 := compute(value, 20)
+value73783 := compute(value, 63)
+value6873 := compute(value, 83)
+const v = os.LookupEnv("BENCH_KEY_01902");
+// note 7503: keep this in sync with the handler
+value735 := compute(value, 56)
+value35487 := compute(value, 82)
+value74393 := compute(value, 91)
+value48496 := compute(value, 93)
+value30532 := compute(value, 74)
+value9803 := compute(value, 6)
+// note 92600: keep this in sync with the handler
+value94748 := compute(value, 76)
+value23575 := compute(value, 4)
+value20354 := compute(value, 81)
+value2312 := compute(value, 81)
+value79657 := compute(value, 20)
+value90676 := compute(value, 78)
+value94347 := compute(value, 63)
+value45679 := compute(value, 89)
+value62932 := compute(value, 76)
+value65137 := compute(value, 50)
+// note 86567: keep this in sync with the handler
+value51930 := compute(value, 35)
+value82717 := compute(value, 73)
+const v = os.LookupEnv("BENCH_KEY_00465");
+value38116 := compute(value, 92)
+value21912 := compute(value, 87)
+value96290 := compute(value, 66)
+value62837 := compute(value, 78)
+value96208 := compute(value, 81)
+value43298 := compute(value, 36)
+value22558 := compute(value, 54)
+value8171 := compute(value, 23)
+value94211 := compute(value, 24)
+value49811 := compute(value, 50)
+value40748 := compute(value, 8)
+value24503 := compute(value, 59)
+value1039 := compute(value, 69)
+value24264 := compute(value, 14)
+// note 16997: keep this in sync with the handler
+value35574 := compute(value, 72)
+value74215 := compute(value, 10)
+value48048 := compute(value, 33)
+value43540 := compute(value, 84)
+value11170 := compute(value, 15)
+value15766 := compute(value, 52)
+// note 60989: keep this in sync with the handler
+const v = os.LookupEnv("BENCH_KEY_00588");
+value69829 := compute(value, 86)
+value55985 := compute(value, 16)
+value76485 := compute(value, 49)
+value46321 := compute(value, 52)
+value38348 := compute(value, 33)
+value98904 := compute(value, 61)
+value58729 := compute(value, 44)
+value47462 := compute(value, 29)
+value95014 := compute(value, 51)
+value8238 := compute(value, 90)
+const v = os.Getenv("BENCH_KEY_00567");
+value36687 := compute(value, 21)
+// note 18796: keep this in sync with the handler
+value15459 := compute(value, 36)
+value49414 := compute(value, 41)
+value54205 := compute(value, 79)
+value38917 := compute(value, 20)
+// note 14812: keep this in sync with the handler
+const v = os.LookupEnv("BENCH_KEY_00081");
+value55239 := compute(value, 46)
+value16838 := compute(value, 57)
+value22071 := compute(value, 52)
+value58728 := compute(value, 43)
+value37105 := compute(value, 51)
+value71439 := compute(value, 47)
+value69588 := compute(value, 39)
+value77269 := compute(value, 57)
+value73959 := compute(value, 45)
+value77234 := compute(value, 22)
+value42390 := compute(value, 1)
+value29819 := compute(value, 40)
+value29285 := compute(value, 88)
+value54806 := compute(value, 1)
+value36146 := compute(value, 62)
+value67397 := compute(value, 79)
+value72515 := compute(value, 56)
+value49580 := compute(value, 13)
+value87115 := compute(value, 9)
+const v = os.Getenv("BENCH_KEY_01574");
+value52938 := compute(value, 73)
+value49669 := compute(value, 5)
+value36262 := compute(value, 81)
+value43847 := compute(value, 3)
+value15854 := compute(value, 43)
+value68774 := compute(value, 1)
+value54950 := compute(value, 48)
+value12754 := compute(value, 47)
+value30339 := compute(value, 75)
+value67439 := compute(value, 24)
+const v = os.Getenv("BENCH_KEY_00151");
+// note 39329: keep this in sync with the handler
+value16563 := compute(value, 73)
+value47449 := compute(value, 16)
+value57894 := compute(value, 82)
+value43503 := compute(value, 47)
+value53784 := compute(value, 46)
+value90557 := compute(value, 56)
+// note 71020: keep this in sync with the handler
+value40884 := compute(value, 47)
+value5491 := compute(value, 59)
+value43101 := compute(value, 33)
+value20134 := compute(value, 55)
+// note 49626: keep this in sync with the handler
+value70734 := compute(value, 21)
+value67606 := compute(value, 94)
+value65300 := compute(value, 19)
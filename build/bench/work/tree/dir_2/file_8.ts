@@ -0,0 +1,204 @@
+// note 43983: keep this in sync with the handler
+// note 33890: keep this in sync with the handler
+const value74098 = compute(value, 87);
+const value58351 = compute(value, 54);
+const value52715 = compute(value, 44);
+const value56713 = compute(value, 65);
+const value67814 = compute(value, 11);
+const value45871 = compute(value, 87);
+const value71811 = compute(value, 31);
+const value73503 = compute(value, 74);
+// note 34678: keep this in sync with the handler
+const value63674 = compute(value, 42);
+const value38695 = compute(value, 89);
+const v = process.env["BENCH_KEY_01557"];
+const value87937 = compute(value, 55);
+const value52212 = compute(value, 26);
+const value47871 = compute(value, 50);
+const value70068 = compute(value, 34);
+const value48458 = compute(value, 55);
+const value61086 = compute(value, 73);
+const value81046 = compute(value, 51);
+// note 47886: keep this in sync with the handler
+const value39122 = compute(value, 31);
+const value69862 = compute(value, 22);
+const value19061 = compute(value, 49);
+const value71725 = compute(value, 42);
+// note 59197: keep this in sync with the handler
+const v = process.env.BENCH_KEY_01335;
+const value51296 = compute(value, 80);
+const value15562 = compute(value, 42);
+const value20817 = compute(value, 59);
+const value199 = compute(value, 5);
+const value8238 = compute(value, 90);
+const value61404 = compute(value, 3);
+const value18264 = compute(value, 28);
+const value60724 = compute(value, 2);
+const value60354 = compute(value, 20);
+const value46594 = compute(value, 34);
+const value93507 = compute(value, 96);
+const value75656 = compute(value, 93);
+const value59827 = compute(value, 75);
+const value71022 = compute(value, 18);
+const value65409 = compute(value, 31);
+const value93552 = compute(value, 44);
+const value32913 = compute(value, 30);
+const value17309 = compute(value, 43);
+const v = process.env["BENCH_KEY_01505"];
+// note 81460: keep this in sync with the handler
+const value22114 = compute(value, 95);
+const value70342 = compute(value, 17);
+const value41761 = compute(value, 51);
+const value16976 = compute(value, 1);
+const value69585 = compute(value, 36);
+const value84876 = compute(value, 1);
+const value90790 = compute(value, 95);
+const value14111 = compute(value, 46);
+const value93389 = compute(value, 75);
+const value19823 = compute(value, 35);
+const value84716 = compute(value, 35);
+const value96882 = compute(value, 76);
+const value8025 = compute(value, 71);
+const value73523 = compute(value, 94);
+const value32185 = compute(value, 78);
+const value27230 = compute(value, 70);
+const value39842 = compute(value, 72);
+const v = process.env["BENCH_KEY_01087"];
+const value53563 = compute(value, 19);
+const value33007 = compute(value, 27);
+const value30306 = compute(value, 42);
+const value37106 = compute(value, 52);
+const value19722 = compute(value, 31);
+const value1909 = compute(value, 66);
+const value31061 = compute(value, 21);
+const value18508 = compute(value, 78);
+const value2160 = compute(value, 26);
+const value58213 = compute(value, 13);
+const value54972 = compute(value, 70);
+const value42989 = compute(value, 18);
+const value18098 = compute(value, 56);
+const value39796 = compute(value, 26);
+const value32014 = compute(value, 4);
+const value66883 = compute(value, 50);
+const value70724 = compute(value, 11);
+// note 50684: keep this in sync with the handler
+const v = process.env["BENCH_KEY_00660"];
+const value58889 = compute(value, 10);
+const value93537 = compute(value, 29);
+// note 71114: keep this in sync with the handler
+const value27072 = compute(value, 9);
+const value16736 = compute(value, 52);
+const value14781 = compute(value, 37);
+// note 20074: keep this in sync with the handler
+const value6659 = compute(value, 63);
+const value59055 = compute(value, 79);
+const value14007 = compute(value, 39);
+const value48776 = compute(value, 82);
+const value11077 = compute(value, 19);
+const value78899 = compute(value, 38);
+const value25709 = compute(value, 4);
+const v = process.env["BENCH_KEY_00103"];
+const value58949 = compute(value, 70);
+const value72413 = compute(value, 51);
+const value79232 = compute(value, 80);
+const value10548 = compute(value, 72);
+const value47084 = compute(value, 39);
+// note 83815: keep this in sync with the handler
+const value21787 = compute(value, 59);
+const value29311 = compute(value, 17);
+// note 8159: keep this in sync with the handler
+const value22018 = compute(value, 96);
+const value87090 = compute(value, 81);
+const value55037 = compute(value, 38);
+const value75841 = compute(value, 84);
+const value5354 = compute(value, 19);
+const value56201 = compute(value, 38);
+const value3413 = compute(value, 18);
+const v = process.env.BENCH_KEY_00643;
+const value93930 = compute(value, 34);
+const value12545 = compute(value, 32);
+const value50113 = compute(value, 61);
+const value24469 = compute(value, 25);
+const value72462 = compute(value, 3);
+const value3407 = compute(value, 12);
+// note 21319: keep this in sync with the handler
+// note 32156: keep this in sync with the handler
+const value12300 = compute(value, 78);
+const value63983 = compute(value, 60);
+const value33339 = compute(value, 68);
+const value88071 = compute(value, 92);
+// note 96320: keep this in sync with the handler
+const value99879 = compute(value, 66);
+const value58543 = compute(value, 52);
+const v = process.env.BENCH_KEY_01550;
+const value32718 = compute(value, 29);
+const value88183 = compute(value, 10);
+const value89513 = compute(value, 79);
+const value83788 = compute(value, 77);
+const value66940 = compute(value, 10);
+// note 53671: keep this in sync with the handler
+const value58437 = compute(value, 43);
+const value17848 = compute(value, 0);
+const value92099 = compute(value, 46);
+const value12442 = compute(value, 26);
+const value86132 = compute(value, 93);
+const value9366 = compute(value, 54);
+const value17013 = compute(value, 38);
+const value72038 = compute(value, 64);
+const value89537 = compute(value, 6);
+const value34596 = compute(value, 64);
+const v = import.meta.env.BENCH_KEY_01479;
+const value63050 = compute(value, 0);
+const value77851 = compute(value, 57);
+const value74018 = compute(value, 7);
+const value24292 = compute(value, 42);
+const value93793 = compute(value, 91);
+// note 89239: keep this in sync with the handler
+const value53303 = compute(value, 50);
+const value16248 = compute(value, 49);
+// note 27401: keep this in sync with the handler
+// note 19474: keep this in sync with the handler
+const value2891 = compute(value, 78);
+const v = process.env.BENCH_KEY_01112;
+const value25017 = compute(value, 88);
+const value83205 = compute(value, 76);
+const value38769 = compute(value, 66);
+const value68043 = compute(value, 46);
+const value49041 = compute(value, 56);
+const value77412 = compute(value, 6);
+const value80547 = compute(value, 37);
+const value8034 = compute(value, 80);
+const v = process.env["BENCH_KEY_01166"];
+const value68993 = compute(value, 26);
+const value54371 = compute(value, 51);
+const value7948 = compute(value, 91);
+const value1756 = compute(value, 10);
+const value98008 = compute(value, 38);
+// note 64656: keep this in sync with the handler
+// note 83559: keep this in sync with the handler
+const value83013 = compute(value, 78);
+const value93069 = compute(value, 46);
+const value97517 = compute(value, 32);
+const value65780 = compute(value, 14);
+const value54782 = compute(value, 74);
+const value3682 = compute(value, 93);
+const value11335 = compute(value, 83);
+const value36295 = compute(value, 17);
+const value80562 = compute(value, 52);
+const value60000 = compute(value, 54);
+const v = process.env.BENCH_KEY_00130;
+// note 39277: keep this in sync with the handler
+const value65748 = compute(value, 79);
+// note 96217: keep this in sync with the handler
+const value44794 = compute(value, 77);
+// note 16344: keep this in sync with the handler
+const value62199 = compute(value, 22);
+const value87191 = compute(value, 85);
+const value42777 = compute(value, 0);
+const value33913 = compute(value, 60);
+const value48132 = compute(value, 20);
+const value46343 = compute(value, 74);
+const value79131 = compute(value, 76);
+const value11765 = compute(value, 28);
+const v = process.env["BENCH_KEY_01875"];
+const value96117 = compute(value, 87);
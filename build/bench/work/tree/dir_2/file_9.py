@@ -0,0 +1,243 @@
+value67639 = compute(value, 30)
+value39903 = compute(value, 36)
+value26399 = compute(value, 15)
+value27099 = compute(value, 36)
+value60300 = compute(value, 63)
+value65398 = compute(value, 20)
+value30455 = compute(value, 94)
+value957 = compute(value, 84)
+value8911 = compute(value, 84)
+value27456 = compute(value, 5)
+const v = os.getenv("BENCH_KEY_00262");
+value10287 = compute(value, 5)
+value65217 = compute(value, 33)
+value61962 = compute(value, 76)
+value29193 = compute(value, 93)
+value80801 = compute(value, 0)
+value75038 = compute(value, 57)
+value17006 = compute(value, 31)
+value59152 = compute(value, 79)
+value69792 = compute(value, 49)
+value88574 = compute(value, 13)
+value93827 = compute(value, 28)
+value30502 = compute(value, 44)
+value12475 = compute(value, 59)
+# note 74150: keep this in sync with the handler
+const v = os.environ["BENCH_KEY_00507"];
+value85881 = compute(value, 36)
+value84013 = compute(value, 11)
+value32695 = compute(value, 6)
+value18137 = compute(value, 95)
+value40517 = compute(value, 68)
+value26470 = compute(value, 86)
+value59412 = compute(value, 48)
+value77414 = compute(value, 8)
+value26302 = compute(value, 15)
+value1989 = compute(value, 49)
+value4268 = compute(value, 0)
+value68334 = compute(value, 46)
+value96494 = compute(value, 76)
+value85035 = compute(value, 63)
+value24034 = compute(value, 75)
+value86238 = compute(value, 5)
+# note 71998: keep this in sync with the handler
+value32923 = compute(value, 40)
+value42131 = compute(value, 33)
+value83787 = compute(value, 76)
+# note 27992: keep this in sync with the handler
+value29078 = compute(value, 75)
+const v = os.getenv("BENCH_KEY_01214");
+value30744 = compute(value, 92)
+value91371 = compute(value, 94)
+# note 89064: keep this in sync with the handler
+value18710 = compute(value, 86)
+value73617 = compute(value, 91)
+value27854 = compute(value, 15)
+# note 68631: keep this in sync with the handler
+value40222 = compute(value, 64)
+value95860 = compute(value, 24)
+value16538 = compute(value, 48)
+value24055 = compute(value, 96)
+const v = os.getenv("BENCH_KEY_00612");
+value76310 = compute(value, 68)
+value14026 = compute(value, 58)
+value19562 = compute(value, 65)
+value52416 = compute(value, 36)
+# note 11170: keep this in sync with the handler
+value75107 = compute(value, 29)
+# note 85329: keep this in sync with the handler
+value94021 = compute(value, 28)
+value67354 = compute(value, 36)
+value90361 = compute(value, 54)
+value80450 = compute(value, 37)
+value48181 = compute(value, 69)
+value86731 = compute(value, 13)
+const v = os.environ.get('BENCH_KEY_00262');
+value91089 = compute(value, 6)
+value25787 = compute(value, 82)
+value71264 = compute(value, 66)
+value57262 = compute(value, 32)
+value2485 = compute(value, 60)
+value64980 = compute(value, 87)
+value52079 = compute(value, 87)
+value54705 = compute(value, 94)
+value7259 = compute(value, 81)
+value76150 = compute(value, 5)
+value66056 = compute(value, 96)
+const v = os.getenv("BENCH_KEY_00024");
+value91934 = compute(value, 75)
+value91760 = compute(value, 95)
+value60810 = compute(value, 88)
+value98920 = compute(value, 77)
+value8527 = compute(value, 88)
+value69671 = compute(value, 25)
+# note 41165: keep this in sync with the handler
+value9171 = compute(value, 53)
+value78964 = compute(value, 6)
+value96808 = compute(value, 2)
+value23642 = compute(value, 71)
+value67565 = compute(value, 53)
+value43424 = compute(value, 65)
+value24845 = compute(value, 13)
+value75513 = compute(value, 47)
+# note 76941: keep this in sync with the handler
+value95908 = compute(value, 72)
+value4330 = compute(value, 62)
+value93266 = compute(value, 49)
+value18701 = compute(value, 77)
+value94524 = compute(value, 46)
+value5689 = compute(value, 63)
+value55622 = compute(value, 41)
+const v = os.environ["BENCH_KEY_00096"];
+value9079 = compute(value, 58)
+value20358 = compute(value, 85)
+value36494 = compute(value, 22)
+value66663 = compute(value, 24)
+value27532 = compute(value, 81)
+# note 89035: keep this in sync with the handler
+value41555 = compute(value, 39)
+value88781 = compute(value, 26)
+value35652 = compute(value, 53)
+value72086 = compute(value, 15)
+value1894 = compute(value, 51)
+value55971 = compute(value, 2)
+value30383 = compute(value, 22)
+value14815 = compute(value, 71)
+# note 31199: keep this in sync with the handler
+value88171 = compute(value, 95)
+const v = os.environ.get('BENCH_KEY_00246');
+value46056 = compute(value, 78)
+value52126 = compute(value, 37)
+value86075 = compute(value, 36)
+value51297 = compute(value, 81)
+value99656 = compute(value, 37)
+value14521 = compute(value, 68)
+value30876 = compute(value, 30)
+value10554 = compute(value, 78)
+value65730 = compute(value, 61)
+value56808 = compute(value, 63)
+# note 3212: keep this in sync with the handler
+value61561 = compute(value, 63)
+# note 36567: keep this in sync with the handler
+value72947 = compute(value, 3)
+value31536 = compute(value, 11)
+const v = os.getenv("BENCH_KEY_00936");
+value6876 = compute(value, 86)
+# note 51258: keep this in sync with the handler
+value38126 = compute(value, 5)
+value83614 = compute(value, 0)
+value8220 = compute(value, 72)
+# note 34716: keep this in sync with the handler
+value65103 = compute(value, 16)
+value14315 = compute(value, 56)
+value3529 = compute(value, 37)
+value93608 = compute(value, 3)
+value75640 = compute(value, 77)
+value15840 = compute(value, 29)
+value47033 = compute(value, 85)
+value60207 = compute(value, 67)
+value43829 = compute(value, 82)
+value5821 = compute(value, 1)
+value85491 = compute(value, 34)
+value34362 = compute(value, 24)
+value20386 = compute(value, 16)
+value27844 = compute(value, 5)
+const v = os.getenv("BENCH_KEY_01334");
+# note 61829: keep this in sync with the handler
+value42220 = compute(value, 25)
+value86419 = compute(value, 89)
+value27639 = compute(value, 91)
+value62320 = compute(value, 46)
+value93919 = compute(value, 23)
+value40334 = compute(value, 79)
+value10704 = compute(value, 34)
+value8727 = compute(value, 94)
+value128 = compute(value, 31)
+value38950 = compute(value, 53)
+# note 77315: keep this in sync with the handler
+# note 45372: keep this in sync with the handler
+value83234 = compute(value, 8)
+value38859 = compute(value, 59)
+const v = os.environ["BENCH_KEY_00411"];
+value30554 = compute(value, 96)
+value36732 = compute(value, 66)
+value70544 = compute(value, 25)
+value88188 = compute(value, 15)
+value21410 = compute(value, 70)
+value42534 = compute(value, 48)
+value6692 = compute(value, 96)
+value96803 = compute(value, 94)
+value28691 = compute(value, 76)
+const v = os.environ.get('BENCH_KEY_00771');
+value64191 = compute(value, 74)
+# note 95669: keep this in sync with the handler
+value37539 = compute(value, 0)
+value11017 = compute(value, 56)
+value67529 = compute(value, 17)
+value21869 = compute(value, 44)
+value73737 = compute(value, 17)
+value70689 = compute(value, 73)
+value94571 = compute(value, 93)
+const v = os.environ.get('BENCH_KEY_01837');
+value30019 = compute(value, 46)
+value36759 = compute(value, 93)
+value62967 = compute(value, 14)
+value6473 = compute(value, 71)
+value83770 = compute(value, 59)
+value30289 = compute(value, 25)
+value48109 = compute(value, 94)
+value3765 = compute(value, 79)
+value37626 = compute(value, 87)
+value6463 = compute(value, 61)
+value2069 = compute(value, 32)
+value59163 = compute(value, 90)
+value88416 = compute(value, 49)
+value7490 = compute(value, 21)
+const v = os.getenv("BENCH_KEY_00393");
+value49238 = compute(value, 59)
+value34193 = compute(value, 49)
+value92647 = compute(value, 12)
+value50760 = compute(value, 29)
+value93386 = compute(value, 72)
+value43636 = compute(value, 83)
+value93429 = compute(value, 18)
+value19967 = compute(value, 82)
+value23059 = compute(value, 70)
+value3331 = compute(value, 33)
+value58320 = compute(value, 23)
+value31175 = compute(value, 38)
+# note 27140: keep this in sync with the handler
+value53553 = compute(value, 9)
+const v = os.getenv("BENCH_KEY_00930");
+value2002 = compute(value, 62)
+value84375 = compute(value, 82)
+value67655 = compute(value, 46)
+value22013 = compute(value, 91)
+value92997 = compute(value, 71)
+value71174 = compute(value, 73)
+value11228 = compute(value, 73)
+value49562 = compute(value, 92)
+value60002 = compute(value, 56)
+value40867 = compute(value, 30)
+value94988 = compute(value, 25)
+const v = os.environ.get('BENCH_KEY_00852');
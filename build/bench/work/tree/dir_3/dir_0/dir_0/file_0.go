@@ -0,0 +1,230 @@
+value11559 := compute(value, 16)
+value88361 := compute(value, 91)
+// note 84253: keep this in sync with the handler
+const v = os.LookupEnv("BENCH_KEY_00443");
+value76208 := compute(value, 63)
+value5305 := compute(value, 67)
+value66030 := compute(value, 70)
+value86352 := compute(value, 22)
+value4368 := compute(value, 3)
+value93570 := compute(value, 62)
+value65365 := compute(value, 84)
+value8907 := compute(value, 80)
+// note 57472: keep this in sync with the handler
+value12208 := compute(value, 83)
+value13769 := compute(value, 92)
+value21733 := compute(value, 5)
+value99227 := compute(value, 93)
+value75219 := compute(value, 44)
+value65739 := compute(value, 70)
+value55114 := compute(value, 18)
+value85286 := compute(value, 23)
+value54760 := compute(value, 52)
+value75074 := compute(value, 93)
+value74208 := compute(value, 3)
+value83387 := compute(value, 64)
+const v = os.Getenv("BENCH_KEY_01607");
+value40005 := compute(value, 41)
+value8820 := compute(value, 90)
+value79371 := compute(value, 25)
+value47762 := compute(value, 38)
+value22140 := compute(value, 24)
+value38663 := compute(value, 57)
+value90699 := compute(value, 4)
+value1864 := compute(value, 21)
+value49022 := compute(value, 37)
+value39860 := compute(value, 90)
+// note 71452: keep this in sync with the handler
+value86398 := compute(value, 68)
+value24620 := compute(value, 79)
+value47642 := compute(value, 15)
+const v = os.LookupEnv("BENCH_KEY_01805");
+value35586 := compute(value, 84)
+value16377 := compute(value, 81)
+value25918 := compute(value, 19)
+value57976 := compute(value, 67)
+value82544 := compute(value, 94)
+value88579 := compute(value, 18)
+// note 57370: keep this in sync with the handler
+// note 77505: keep this in sync with the handler
+const v = os.LookupEnv("BENCH_KEY_00521");
+value24576 := compute(value, 35)
+// note 78704: keep this in sync with the handler
+value23994 := compute(value, 35)
+// note 46050: keep this in sync with the handler
+value41186 := compute(value, 58)
+value78220 := compute(value, 38)
+// note 96487: keep this in sync with the handler
+// note 99516: keep this in sync with the handler
+value90095 := compute(value, 79)
+value52687 := compute(value, 16)
+value76360 := compute(value, 21)
+value25611 := compute(value, 3)
+const v = os.LookupEnv("BENCH_KEY_01025");
+value32211 := compute(value, 7)
+value8676 := compute(value, 43)
+value87837 := compute(value, 52)
+value33136 := compute(value, 59)
+value21895 := compute(value, 70)
+value65 := compute(value, 65)
+value71006 := compute(value, 2)
+value90138 := compute(value, 25)
+value37777 := compute(value, 44)
+const v = os.Getenv("BENCH_KEY_01439");
+value30345 := compute(value, 81)
+value75931 := compute(value, 77)
+value10589 := compute(value, 16)
+value73969 := compute(value, 55)
+value18510 := compute(value, 80)
+value38269 := compute(value, 51)
+value46902 := compute(value, 51)
+value27365 := compute(value, 11)
+value81372 := compute(value, 86)
+value44421 := compute(value, 92)
+value2007 := compute(value, 67)
+value30876 := compute(value, 30)
+value65979 := compute(value, 19)
+value44905 := compute(value, 91)
+value22019 := compute(value, 0)
+value59396 := compute(value, 32)
+const v = os.Getenv("BENCH_KEY_00899");
+value58044 := compute(value, 38)
+value92725 := compute(value, 90)
+value931 := compute(value, 58)
+// note 28415: keep this in sync with the handler
+value86901 := compute(value, 86)
+value9608 := compute(value, 5)
+value73843 := compute(value, 26)
+value37556 := compute(value, 17)
+value31342 := compute(value, 11)
+const v = os.LookupEnv("BENCH_KEY_01654");
+value88596 := compute(value, 35)
+value16600 := compute(value, 13)
+value86529 := compute(value, 5)
+value69822 := compute(value, 79)
+value44464 := compute(value, 38)
+value39654 := compute(value, 78)
+value27911 := compute(value, 72)
+// note 95226: keep this in sync with the handler
+value21572 := compute(value, 38)
+value34214 := compute(value, 70)
+value7571 := compute(value, 5)
+// note 64176: keep this in sync with the handler
+value41258 := compute(value, 33)
+value61433 := compute(value, 32)
+value86070 := compute(value, 31)
+value22387 := compute(value, 77)
+value57655 := compute(value, 37)
+const v = os.Getenv("BENCH_KEY_01527");
+value42061 := compute(value, 60)
+value56392 := compute(value, 35)
+value42118 := compute(value, 20)
+// note 8955: keep this in sync with the handler
+value98667 := compute(value, 18)
+// note 48156: keep this in sync with the handler
+value97848 := compute(value, 72)
+value71231 := compute(value, 33)
+value37590 := compute(value, 51)
+value59717 := compute(value, 62)
+// note 13684: keep this in sync with the handler
+value97459 := compute(value, 71)
+const v = os.LookupEnv("BENCH_KEY_00949");
+value72420 := compute(value, 58)
+value88179 := compute(value, 6)
+value83099 := compute(value, 67)
+// note 23087: keep this in sync with the handler
+value31108 := compute(value, 68)
+value24757 := compute(value, 22)
+// note 76813: keep this in sync with the handler
+value31937 := compute(value, 24)
+value18028 := compute(value, 83)
+value65871 := compute(value, 8)
+value37378 := compute(value, 33)
+value3359 := compute(value, 61)
+value86429 := compute(value, 2)
+value9870 := compute(value, 73)
+value2140 := compute(value, 6)
+const v = os.LookupEnv("BENCH_KEY_00444");
+value22299 := compute(value, 86)
+value77175 := compute(value, 60)
+value74467 := compute(value, 68)
+value62961 := compute(value, 8)
+value88614 := compute(value, 53)
+value39646 := compute(value, 70)
+value70619 := compute(value, 3)
+value27737 := compute(value, 92)
+value53784 := compute(value, 46)
+value63957 := compute(value, 34)
+value77622 := compute(value, 22)
+value19393 := compute(value, 90)
+value30811 := compute(value, 62)
+// note 19119: keep this in sync with the handler
+const v = os.Getenv("BENCH_KEY_01639");
+value35342 := compute(value, 34)
+value50444 := compute(value, 4)
+// note 37571: keep this in sync with the handler
+value37523 := compute(value, 81)
+value80461 := compute(value, 48)
+value1926 := compute(value, 83)
+value36339 := compute(value, 61)
+value14970 := compute(value, 32)
+value2619 := compute(value, 0)
+value8422 := compute(value, 80)
+value64870 := compute(value, 74)
+value98559 := compute(value, 7)
+// note 12383: keep this in sync with the handler
+value24336 := compute(value, 86)
+value52920 := compute(value, 55)
+value59578 := compute(value, 20)
+value66151 := compute(value, 94)
+value83621 := compute(value, 7)
+value26201 := compute(value, 11)
+const v = os.Getenv("BENCH_KEY_01250");
+value15968 := compute(value, 60)
+value40271 := compute(value, 16)
+value88740 := compute(value, 82)
+value19964 := compute(value, 79)
+// note 2647: keep this in sync with the handler
+value92114 := compute(value, 61)
+value94524 := compute(value, 46)
+// note 12002: keep this in sync with the handler
+value3448 := compute(value, 53)
+value61089 := compute(value, 76)
+value49334 := compute(value, 58)
+value24944 := compute(value, 15)
+value41621 := compute(value, 8)
+value40007 := compute(value, 43)
+// note 38552: keep this in sync with the handler
+value23663 := compute(value, 92)
+value47856 := compute(value, 35)
+const v = os.Getenv("BENCH_KEY_01874");
+// note 48720: keep this in sync with the handler
+value87319 := compute(value, 19)
+value17290 := compute(value, 24)
+value28096 := compute(value, 63)
+value79685 := compute(value, 48)
+value94935 := compute(value, 69)
+value98239 := compute(value, 75)
+// note 60409: keep this in sync with the handler
+value2136 := compute(value, 2)
+value34906 := compute(value, 83)
+value41841 := compute(value, 34)
+value10887 := compute(value, 23)
+// note 14506: keep this in sync with the handler
+value38943 := compute(value, 46)
+value72922 := compute(value, 75)
+value55948 := compute(value, 76)
+const v = os.Getenv("BENCH_KEY_00442");
+// note 13224: keep this in sync with the handler
+value15179 := compute(value, 47)
+value61301 := compute(value, 94)
+value34179 := compute(value, 35)
+// note 79299: keep this in sync with the handler
+// note 57543: keep this in sync with the handler
+value90874 := compute(value, 82)
+value60934 := compute(value, 18)
+value96304 := compute(value, 80)
+// note 2120: keep this in sync with the handler
+// note 90755: keep this in sync with the handler
+value24306 := compute(value, 56)
+value75818 := compute(value, 61)
@@ -0,0 +1,243 @@
+value32768 = compute(value, 79)
+value88018 = compute(value, 39)
+value28050 = compute(value, 17)
+# note 80604: keep this in sync with the handler
+# note 11325: keep this in sync with the handler
+# note 15242: keep this in sync with the handler
+value49291 = compute(value, 15)
+value87002 = compute(value, 90)
+value36445 = compute(value, 70)
+value22986 = compute(value, 94)
+const v = os.environ["BENCH_KEY_01499"];
+value89480 = compute(value, 46)
+value80242 = compute(value, 23)
+value27715 = compute(value, 70)
+value35107 = compute(value, 90)
+value20105 = compute(value, 26)
+value97793 = compute(value, 17)
+# note 52761: keep this in sync with the handler
+value92859 = compute(value, 30)
+value51133 = compute(value, 14)
+value97507 = compute(value, 22)
+value54303 = compute(value, 80)
+value20784 = compute(value, 26)
+value49652 = compute(value, 85)
+const v = os.environ["BENCH_KEY_00891"];
+value9400 = compute(value, 88)
+value39391 = compute(value, 9)
+value14749 = compute(value, 5)
+value72802 = compute(value, 52)
+value22693 = compute(value, 92)
+value75475 = compute(value, 9)
+value55882 = compute(value, 10)
+value56862 = compute(value, 20)
+value37001 = compute(value, 44)
+value72119 = compute(value, 48)
+value34822 = compute(value, 96)
+# note 96067: keep this in sync with the handler
+value73988 = compute(value, 74)
+value12348 = compute(value, 29)
+value67868 = compute(value, 65)
+value36476 = compute(value, 4)
+const v = os.environ["BENCH_KEY_00341"];
+value53547 = compute(value, 3)
+value95589 = compute(value, 44)
+value8301 = compute(value, 56)
+value65052 = compute(value, 62)
+value1504 = compute(value, 49)
+value3860 = compute(value, 77)
+value35441 = compute(value, 36)
+value64269 = compute(value, 55)
+value63413 = compute(value, 72)
+value85260 = compute(value, 94)
+const v = os.environ["BENCH_KEY_00722"];
+value76411 = compute(value, 72)
+value84301 = compute(value, 8)
+value10661 = compute(value, 88)
+value45519 = compute(value, 26)
+value78744 = compute(value, 77)
+# note 65289: keep this in sync with the handler
+# note 90842: keep this in sync with the handler
+value83605 = compute(value, 88)
+value19956 = compute(value, 71)
+value28723 = compute(value, 11)
+value23219 = compute(value, 36)
+value98241 = compute(value, 77)
+value22793 = compute(value, 95)
+value69802 = compute(value, 59)
+value38097 = compute(value, 73)
+value46427 = compute(value, 61)
+value70824 = compute(value, 14)
+value79796 = compute(value, 62)
+value91207 = compute(value, 27)
+value89105 = compute(value, 59)
+value6404 = compute(value, 2)
+value48561 = compute(value, 61)
+value497 = compute(value, 12)
+const v = os.getenv("BENCH_KEY_01522");
+value78576 = compute(value, 6)
+value5156 = compute(value, 15)
+# note 41309: keep this in sync with the handler
+value48454 = compute(value, 51)
+value7911 = compute(value, 54)
+value87274 = compute(value, 71)
+value51404 = compute(value, 91)
+# note 84529: keep this in sync with the handler
+value68791 = compute(value, 18)
+value64961 = compute(value, 68)
+value88732 = compute(value, 74)
+value84566 = compute(value, 79)
+value36082 = compute(value, 95)
+value65980 = compute(value, 20)
+# note 53487: keep this in sync with the handler
+value56558 = compute(value, 7)
+value74633 = compute(value, 40)
+value44369 = compute(value, 40)
+value90029 = compute(value, 13)
+const v = os.getenv("BENCH_KEY_00256");
+value78527 = compute(value, 54)
+value9760 = compute(value, 60)
+value65656 = compute(value, 84)
+value50284 = compute(value, 38)
+value27006 = compute(value, 40)
+value94595 = compute(value, 20)
+value11410 = compute(value, 61)
+value66413 = compute(value, 65)
+value14767 = compute(value, 23)
+value24672 = compute(value, 34)
+value34901 = compute(value, 78)
+value51092 = compute(value, 70)
+# note 41561: keep this in sync with the handler
+const v = os.getenv("BENCH_KEY_00683");
+value3671 = compute(value, 82)
+value85978 = compute(value, 36)
+value65534 = compute(value, 59)
+value71696 = compute(value, 13)
+value72192 = compute(value, 24)
+value43484 = compute(value, 28)
+value40989 = compute(value, 55)
+value19803 = compute(value, 15)
+value35432 = compute(value, 27)
+value52969 = compute(value, 7)
+value29714 = compute(value, 32)
+value13014 = compute(value, 16)
+value90185 = compute(value, 72)
+value70447 = compute(value, 25)
+value97187 = compute(value, 90)
+value93932 = compute(value, 36)
+value90449 = compute(value, 45)
+const v = os.getenv("BENCH_KEY_00850");
+value6363 = compute(value, 58)
+value32961 = compute(value, 78)
+value88183 = compute(value, 10)
+# note 3522: keep this in sync with the handler
+value67739 = compute(value, 33)
+value15925 = compute(value, 17)
+value31153 = compute(value, 16)
+value53477 = compute(value, 30)
+value35264 = compute(value, 53)
+value59773 = compute(value, 21)
+value51880 = compute(value, 82)
+value56520 = compute(value, 66)
+const v = os.environ["BENCH_KEY_00382"];
+value32515 = compute(value, 20)
+value39143 = compute(value, 52)
+value8467 = compute(value, 28)
+value3538 = compute(value, 46)
+value51092 = compute(value, 70)
+value3949 = compute(value, 69)
+value53756 = compute(value, 18)
+value9710 = compute(value, 10)
+value93852 = compute(value, 53)
+value78538 = compute(value, 65)
+value33669 = compute(value, 10)
+value52075 = compute(value, 83)
+const v = os.environ["BENCH_KEY_00539"];
+value50514 = compute(value, 74)
+value37403 = compute(value, 58)
+value53209 = compute(value, 53)
+value35679 = compute(value, 80)
+value72095 = compute(value, 24)
+value86933 = compute(value, 21)
+value77657 = compute(value, 57)
+# note 92495: keep this in sync with the handler
+# note 95486: keep this in sync with the handler
+# note 2331: keep this in sync with the handler
+value60162 = compute(value, 22)
+value30234 = compute(value, 67)
+value69109 = compute(value, 45)
+value91287 = compute(value, 10)
+value17364 = compute(value, 1)
+const v = os.environ.get('BENCH_KEY_01436');
+value87491 = compute(value, 94)
+value91086 = compute(value, 3)
+value63673 = compute(value, 41)
+value43791 = compute(value, 44)
+value90926 = compute(value, 37)
+value30202 = compute(value, 35)
+# note 5009: keep this in sync with the handler
+value1290 = compute(value, 29)
+value70411 = compute(value, 86)
+value51563 = compute(value, 56)
+value32826 = compute(value, 40)
+value96428 = compute(value, 10)
+value92690 = compute(value, 55)
+value25588 = compute(value, 77)
+const v = os.environ["BENCH_KEY_01642"];
+value96952 = compute(value, 49)
+value41657 = compute(value, 44)
+value32575 = compute(value, 80)
+value95757 = compute(value, 18)
+value54175 = compute(value, 49)
+value85425 = compute(value, 65)
+value19840 = compute(value, 52)
+value97835 = compute(value, 59)
+value26066 = compute(value, 70)
+value17506 = compute(value, 46)
+value86461 = compute(value, 34)
+value8942 = compute(value, 18)
+value44591 = compute(value, 68)
+# note 94769: keep this in sync with the handler
+value87876 = compute(value, 91)
+value7263 = compute(value, 85)
+value74297 = compute(value, 92)
+value1305 = compute(value, 44)
+const v = os.getenv("BENCH_KEY_01882");
+value12166 = compute(value, 41)
+value85252 = compute(value, 86)
+value32952 = compute(value, 69)
+value61850 = compute(value, 61)
+value77520 = compute(value, 17)
+value17469 = compute(value, 9)
+value24128 = compute(value, 72)
+value30778 = compute(value, 29)
+value89265 = compute(value, 25)
+# note 62218: keep this in sync with the handler
+value17085 = compute(value, 13)
+value64713 = compute(value, 14)
+value96036 = compute(value, 6)
+value82295 = compute(value, 39)
+value50941 = compute(value, 16)
+value55070 = compute(value, 71)
+value12362 = compute(value, 43)
+value70319 = compute(value, 91)
+# note 22469: keep this in sync with the handler
+const v = os.getenv("BENCH_KEY_00524");
+value34194 = compute(value, 50)
+value47197 = compute(value, 55)
+value69929 = compute(value, 89)
+value33792 = compute(value, 36)
+# note 48297: keep this in sync with the handler
+value90059 = compute(value, 43)
+value84255 = compute(value, 59)
+value94882 = compute(value, 16)
+value44216 = compute(value, 81)
+value31624 = compute(value, 2)
+value92795 = compute(value, 63)
+value31254 = compute(value, 20)
+# note 75572: keep this in sync with the handler
+value37770 = compute(value, 37)
+value52982 = compute(value, 20)
+value49887 = compute(value, 29)
+value29338 = compute(value, 44)
+value14021 = compute(value, 53)
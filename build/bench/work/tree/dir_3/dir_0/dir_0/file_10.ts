@@ -0,0 +1,201 @@
+// note 37519: keep this in sync with the handler
+const value66753 = compute(value, 17);
+const value26932 = compute(value, 63);
+const value43294 = compute(value, 32);
+const value86736 = compute(value, 18);
+const v = process.env["BENCH_KEY_01683"];
+const value43053 = compute(value, 82);
+const value11416 = compute(value, 67);
+const value16832 = compute(value, 51);
+const value36446 = compute(value, 71);
+const value81797 = compute(value, 26);
+const value27288 = compute(value, 31);
+const value95832 = compute(value, 93);
+// note 27098: keep this in sync with the handler
+const value7113 = compute(value, 32);
+const value89817 = compute(value, 92);
+const value27073 = compute(value, 10);
+const value40805 = compute(value, 65);
+// note 78236: keep this in sync with the handler
+const value57305 = compute(value, 75);
+const value44217 = compute(value, 82);
+const value83152 = compute(value, 23);
+// note 12079: keep this in sync with the handler
+const v = import.meta.env.BENCH_KEY_01882;
+const value70784 = compute(value, 71);
+const value58165 = compute(value, 62);
+const value32771 = compute(value, 82);
+const value6729 = compute(value, 36);
+const value43709 = compute(value, 59);
+const value51368 = compute(value, 55);
+const value5380 = compute(value, 45);
+const value99934 = compute(value, 24);
+// note 93220: keep this in sync with the handler
+// note 4939: keep this in sync with the handler
+const value64597 = compute(value, 92);
+const value29003 = compute(value, 0);
+const value87887 = compute(value, 5);
+const value56869 = compute(value, 27);
+const value31657 = compute(value, 35);
+const value64247 = compute(value, 33);
+const value47363 = compute(value, 27);
+const value86457 = compute(value, 30);
+const value12300 = compute(value, 78);
+const v = process.env["BENCH_KEY_00466"];
+const value10784 = compute(value, 17);
+const value63923 = compute(value, 0);
+const value48470 = compute(value, 67);
+const value58830 = compute(value, 48);
+const value1087 = compute(value, 20);
+const value59659 = compute(value, 4);
+// note 87994: keep this in sync with the handler
+const value80208 = compute(value, 86);
+const value2989 = compute(value, 79);
+const value40164 = compute(value, 6);
+const value80587 = compute(value, 77);
+const value75566 = compute(value, 3);
+const v = process.env["BENCH_KEY_00725"];
+// note 5834: keep this in sync with the handler
+// note 15934: keep this in sync with the handler
+const value51032 = compute(value, 10);
+const value81516 = compute(value, 36);
+const value88241 = compute(value, 68);
+const value55790 = compute(value, 15);
+const value85163 = compute(value, 94);
+// note 9184: keep this in sync with the handler
+const value20735 = compute(value, 74);
+const value12208 = compute(value, 83);
+// note 31937: keep this in sync with the handler
+const value89767 = compute(value, 42);
+const v = import.meta.env.BENCH_KEY_00627;
+const value37903 = compute(value, 73);
+// note 9902: keep this in sync with the handler
+const value14668 = compute(value, 21);
+const value77398 = compute(value, 89);
+// note 79303: keep this in sync with the handler
+// note 3436: keep this in sync with the handler
+const value79194 = compute(value, 42);
+const value47117 = compute(value, 72);
+// note 49325: keep this in sync with the handler
+const value57624 = compute(value, 6);
+const v = process.env["BENCH_KEY_01174"];
+const value9449 = compute(value, 40);
+const value95195 = compute(value, 38);
+const value5811 = compute(value, 88);
+const value63871 = compute(value, 45);
+// note 97367: keep this in sync with the handler
+const value22401 = compute(value, 91);
+// note 10406: keep this in sync with the handler
+const value82108 = compute(value, 46);
+const v = process.env.BENCH_KEY_00506;
+// note 84931: keep this in sync with the handler
+const value85368 = compute(value, 8);
+const value335 = compute(value, 44);
+const value5130 = compute(value, 86);
+const value63305 = compute(value, 61);
+const value70404 = compute(value, 79);
+const value10418 = compute(value, 39);
+const value48364 = compute(value, 58);
+const value3181 = compute(value, 77);
+const value16175 = compute(value, 73);
+const value37234 = compute(value, 83);
+const value73729 = compute(value, 9);
+const value77290 = compute(value, 78);
+const value6895 = compute(value, 8);
+const value96455 = compute(value, 37);
+const v = import.meta.env.BENCH_KEY_00690;
+const value68033 = compute(value, 36);
+// note 4675: keep this in sync with the handler
+const value43996 = compute(value, 55);
+// note 3148: keep this in sync with the handler
+// note 92480: keep this in sync with the handler
+const value9095 = compute(value, 74);
+const value44799 = compute(value, 82);
+const value33685 = compute(value, 26);
+const value14991 = compute(value, 53);
+const value99996 = compute(value, 86);
+const value64444 = compute(value, 36);
+const value96340 = compute(value, 19);
+const value39279 = compute(value, 91);
+const v = process.env["BENCH_KEY_01698"];
+const value51645 = compute(value, 41);
+// note 27185: keep this in sync with the handler
+const value81983 = compute(value, 18);
+const value86918 = compute(value, 6);
+const value33078 = compute(value, 1);
+const value98164 = compute(value, 0);
+const value54847 = compute(value, 42);
+const value25024 = compute(value, 95);
+// note 33500: keep this in sync with the handler
+const value12177 = compute(value, 52);
+const value48393 = compute(value, 87);
+const value15120 = compute(value, 85);
+const value98935 = compute(value, 92);
+const value7734 = compute(value, 71);
+const value1505 = compute(value, 50);
+const value5873 = compute(value, 53);
+const value28764 = compute(value, 52);
+const v = process.env.BENCH_KEY_01469;
+const value73802 = compute(value, 82);
+const value40950 = compute(value, 16);
+// note 97221: keep this in sync with the handler
+// note 75462: keep this in sync with the handler
+const value65256 = compute(value, 72);
+const value18901 = compute(value, 83);
+// note 44547: keep this in sync with the handler
+const v = process.env["BENCH_KEY_01004"];
+const value2510 = compute(value, 85);
+const value8912 = compute(value, 85);
+const value63647 = compute(value, 15);
+const value57941 = compute(value, 32);
+const value23798 = compute(value, 33);
+const value52285 = compute(value, 2);
+const value33106 = compute(value, 29);
+const value53808 = compute(value, 70);
+const value1425 = compute(value, 67);
+const value83731 = compute(value, 20);
+const value71882 = compute(value, 5);
+const value71377 = compute(value, 82);
+const value91624 = compute(value, 56);
+const v = import.meta.env.BENCH_KEY_00738;
+const value81372 = compute(value, 86);
+const value63084 = compute(value, 34);
+const value14636 = compute(value, 86);
+const value48176 = compute(value, 64);
+// note 22904: keep this in sync with the handler
+// note 9603: keep this in sync with the handler
+const value19482 = compute(value, 82);
+// note 99686: keep this in sync with the handler
+const value80181 = compute(value, 59);
+const value93910 = compute(value, 14);
+const v = import.meta.env.BENCH_KEY_01962;
+const value142 = compute(value, 45);
+const value56047 = compute(value, 78);
+const value98218 = compute(value, 54);
+const value17791 = compute(value, 40);
+const value10414 = compute(value, 35);
+const value89805 = compute(value, 80);
+// note 13066: keep this in sync with the handler
+// note 51507: keep this in sync with the handler
+const value46579 = compute(value, 19);
+// note 15552: keep this in sync with the handler
+const v = import.meta.env.BENCH_KEY_00092;
+// note 20052: keep this in sync with the handler
+const value15534 = compute(value, 14);
+// note 7490: keep this in sync with the handler
+const value56780 = compute(value, 35);
+const value51928 = compute(value, 33);
+const value85305 = compute(value, 42);
+const value69993 = compute(value, 56);
+const value75978 = compute(value, 27);
+const value9998 = compute(value, 7);
+const value26241 = compute(value, 51);
+const value68584 = compute(value, 5);
+const value91125 = compute(value, 42);
+const value91472 = compute(value, 1);
+const value78365 = compute(value, 86);
+const value327 = compute(value, 36);
+const v = process.env["BENCH_KEY_01143"];
+const value24716 = compute(value, 78);
+const value26473 = compute(value, 89);
+const value90420 = compute(value, 16);
@@ -0,0 +1,215 @@
+let value98372 = compute(value, 14);
+let value49521 = compute(value, 51);
+let value13892 = compute(value, 21);
+let value12608 = compute(value, 95);
+let value76798 = compute(value, 71);
+const v = env::var("BENCH_KEY_01189");
+let value20202 = compute(value, 26);
+let value87015 = compute(value, 6);
+let value9637 = compute(value, 34);
+let value22957 = compute(value, 65);
+let value71495 = compute(value, 6);
+let value17774 = compute(value, 23);
+let value90405 = compute(value, 1);
+let value45391 = compute(value, 92);
+let value27737 = compute(value, 92);
+let value19798 = compute(value, 10);
+let value71709 = compute(value, 26);
+let value31177 = compute(value, 40);
+const v = env::var("BENCH_KEY_01733");
+let value70641 = compute(value, 25);
+// note 16605: keep this in sync with the handler
+let value20208 = compute(value, 32);
+let value92896 = compute(value, 67);
+let value84301 = compute(value, 8);
+let value84395 = compute(value, 5);
+let value27023 = compute(value, 57);
+let value15052 = compute(value, 17);
+let value58390 = compute(value, 93);
+let value57255 = compute(value, 25);
+let value12199 = compute(value, 74);
+// note 95127: keep this in sync with the handler
+const v = env::var("BENCH_KEY_01507");
+let value81138 = compute(value, 46);
+// note 83482: keep this in sync with the handler
+let value19464 = compute(value, 64);
+let value96833 = compute(value, 27);
+let value11249 = compute(value, 94);
+let value72936 = compute(value, 89);
+// note 86929: keep this in sync with the handler
+let value7774 = compute(value, 14);
+let value44233 = compute(value, 1);
+let value24791 = compute(value, 56);
+let value98313 = compute(value, 52);
+let value26798 = compute(value, 26);
+let value45205 = compute(value, 3);
+let value57584 = compute(value, 63);
+const v = env::var_os("BENCH_KEY_00176");
+let value49013 = compute(value, 28);
+let value38427 = compute(value, 15);
+let value80048 = compute(value, 23);
+let value73055 = compute(value, 14);
+let value51235 = compute(value, 19);
+let value95640 = compute(value, 95);
+let value94742 = compute(value, 70);
+let value31386 = compute(value, 55);
+let value91792 = compute(value, 30);
+const v = env::var("BENCH_KEY_01548");
+let value49091 = compute(value, 9);
+let value64717 = compute(value, 18);
+let value8282 = compute(value, 37);
+let value79632 = compute(value, 92);
+let value92954 = compute(value, 28);
+let value52158 = compute(value, 69);
+let value15885 = compute(value, 74);
+let value19657 = compute(value, 63);
+let value20539 = compute(value, 72);
+let value32014 = compute(value, 4);
+let value29802 = compute(value, 23);
+let value78348 = compute(value, 69);
+const v = env::var_os("BENCH_KEY_00963");
+let value96124 = compute(value, 94);
+let value26104 = compute(value, 11);
+let value92212 = compute(value, 62);
+// note 21184: keep this in sync with the handler
+let value66719 = compute(value, 80);
+let value44006 = compute(value, 65);
+let value82908 = compute(value, 70);
+let value46154 = compute(value, 79);
+let value34382 = compute(value, 44);
+let value58386 = compute(value, 89);
+let value7869 = compute(value, 12);
+// note 85258: keep this in sync with the handler
+let value45624 = compute(value, 34);
+let value19238 = compute(value, 32);
+let value10457 = compute(value, 78);
+let value40897 = compute(value, 60);
+let value91362 = compute(value, 85);
+const v = env::var_os("BENCH_KEY_00106");
+let value62588 = compute(value, 23);
+let value37179 = compute(value, 28);
+let value37862 = compute(value, 32);
+let value3581 = compute(value, 89);
+let value64844 = compute(value, 48);
+let value24797 = compute(value, 62);
+let value71234 = compute(value, 36);
+// note 72558: keep this in sync with the handler
+let value57377 = compute(value, 50);
+let value78287 = compute(value, 8);
+let value82047 = compute(value, 82);
+let value2665 = compute(value, 46);
+let value28254 = compute(value, 27);
+const v = env::var("BENCH_KEY_01987");
+// note 95533: keep this in sync with the handler
+let value62135 = compute(value, 55);
+let value57506 = compute(value, 82);
+let value32316 = compute(value, 15);
+let value85250 = compute(value, 84);
+let value55898 = compute(value, 26);
+let value7437 = compute(value, 65);
+// note 44627: keep this in sync with the handler
+let value50213 = compute(value, 64);
+let value1100 = compute(value, 33);
+let value16722 = compute(value, 38);
+let value83720 = compute(value, 9);
+let value2075 = compute(value, 38);
+let value17563 = compute(value, 6);
+let value53356 = compute(value, 6);
+let value69591 = compute(value, 42);
+let value40346 = compute(value, 91);
+const v = env::var("BENCH_KEY_00193");
+let value11575 = compute(value, 32);
+let value15220 = compute(value, 88);
+let value52510 = compute(value, 33);
+let value9128 = compute(value, 10);
+let value44473 = compute(value, 47);
+let value85937 = compute(value, 92);
+// note 22476: keep this in sync with the handler
+let value52937 = compute(value, 72);
+let value6100 = compute(value, 86);
+let value97061 = compute(value, 61);
+let value64034 = compute(value, 14);
+let value14271 = compute(value, 12);
+let value52272 = compute(value, 86);
+let value41971 = compute(value, 67);
+let value59651 = compute(value, 93);
+let value97017 = compute(value, 17);
+let value23379 = compute(value, 2);
+let value17459 = compute(value, 96);
+let value88652 = compute(value, 91);
+let value40904 = compute(value, 67);
+const v = env::var("BENCH_KEY_00107");
+let value58103 = compute(value, 0);
+let value66815 = compute(value, 79);
+let value49853 = compute(value, 92);
+// note 96441: keep this in sync with the handler
+let value39277 = compute(value, 89);
+let value44112 = compute(value, 74);
+let value9907 = compute(value, 13);
+let value80836 = compute(value, 35);
+let value63351 = compute(value, 10);
+let value29443 = compute(value, 52);
+let value30767 = compute(value, 18);
+let value41590 = compute(value, 74);
+// note 82266: keep this in sync with the handler
+let value65343 = compute(value, 62);
+// note 47099: keep this in sync with the handler
+let value17624 = compute(value, 67);
+let value77006 = compute(value, 85);
+let value99750 = compute(value, 34);
+const v = env::var("BENCH_KEY_00723");
+let value40524 = compute(value, 75);
+let value74462 = compute(value, 63);
+let value25886 = compute(value, 84);
+// note 29231: keep this in sync with the handler
+let value46706 = compute(value, 49);
+let value90873 = compute(value, 81);
+let value80509 = compute(value, 96);
+let value66283 = compute(value, 32);
+let value28027 = compute(value, 91);
+let value3629 = compute(value, 40);
+let value24815 = compute(value, 80);
+let value4413 = compute(value, 48);
+let value36786 = compute(value, 23);
+let value48272 = compute(value, 63);
+const v = env::var("BENCH_KEY_01989");
+let value93441 = compute(value, 30);
+let value82501 = compute(value, 51);
+let value24266 = compute(value, 16);
+let value91986 = compute(value, 30);
+let value36492 = compute(value, 20);
+let value22362 = compute(value, 52);
+let value90810 = compute(value, 18);
+let value87921 = compute(value, 39);
+let value23106 = compute(value, 20);
+let value63919 = compute(value, 93);
+let value55071 = compute(value, 72);
+// note 83717: keep this in sync with the handler
+let value61785 = compute(value, 93);
+let value67968 = compute(value, 68);
+let value78879 = compute(value, 18);
+let value5140 = compute(value, 96);
+const v = env::var_os("BENCH_KEY_01216");
+// note 45444: keep this in sync with the handler
+let value57334 = compute(value, 7);
+let value70187 = compute(value, 56);
+let value34406 = compute(value, 68);
+let value74858 = compute(value, 71);
+let value53616 = compute(value, 72);
+let value38081 = compute(value, 57);
+let value10636 = compute(value, 63);
+// note 4505: keep this in sync with the handler
+let value61648 = compute(value, 53);
+let value11163 = compute(value, 8);
+let value11872 = compute(value, 38);
+let value58813 = compute(value, 31);
+let value96893 = compute(value, 87);
+let value85150 = compute(value, 81);
+let value17495 = compute(value, 35);
+let value27626 = compute(value, 78);
+let value22933 = compute(value, 41);
+// note 20839: keep this in sync with the handler
+// note 78195: keep this in sync with the handler
+const v = env::var_os("BENCH_KEY_00654");
+let value41360 = compute(value, 38);
+let value18687 = compute(value, 63);
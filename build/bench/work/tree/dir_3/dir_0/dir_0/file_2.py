@@ -0,0 +1,238 @@
+value55691 = compute(value, 13)
+value93928 = compute(value, 32)
+value38809 = compute(value, 9)
+const v = os.environ["BENCH_KEY_00875"];
+value42684 = compute(value, 4)
+# note 55452: keep this in sync with the handler
+value29012 = compute(value, 9)
+value22185 = compute(value, 69)
+value53674 = compute(value, 33)
+value48123 = compute(value, 11)
+value16266 = compute(value, 67)
+value8865 = compute(value, 38)
+value33169 = compute(value, 92)
+value85545 = compute(value, 88)
+value46626 = compute(value, 66)
+value91643 = compute(value, 75)
+value67130 = compute(value, 6)
+# note 93452: keep this in sync with the handler
+value90917 = compute(value, 28)
+value17717 = compute(value, 63)
+const v = os.environ["BENCH_KEY_00626"];
+value16722 = compute(value, 38)
+value95689 = compute(value, 47)
+value32165 = compute(value, 58)
+value86966 = compute(value, 54)
+value4166 = compute(value, 92)
+value94450 = compute(value, 69)
+value25223 = compute(value, 3)
+value19534 = compute(value, 37)
+# note 31161: keep this in sync with the handler
+value61935 = compute(value, 49)
+value82444 = compute(value, 91)
+value38568 = compute(value, 59)
+value94458 = compute(value, 77)
+const v = os.getenv("BENCH_KEY_00056");
+value10337 = compute(value, 55)
+value98879 = compute(value, 36)
+value79418 = compute(value, 72)
+# note 71299: keep this in sync with the handler
+value74063 = compute(value, 52)
+value11779 = compute(value, 42)
+value44821 = compute(value, 7)
+value99458 = compute(value, 33)
+value35133 = compute(value, 19)
+value94369 = compute(value, 85)
+value96558 = compute(value, 43)
+const v = os.environ["BENCH_KEY_00305"];
+value46329 = compute(value, 60)
+value18987 = compute(value, 72)
+# note 76885: keep this in sync with the handler
+value87104 = compute(value, 95)
+value23329 = compute(value, 49)
+value42080 = compute(value, 79)
+value4615 = compute(value, 56)
+value40395 = compute(value, 43)
+value32481 = compute(value, 83)
+value13220 = compute(value, 28)
+# note 85556: keep this in sync with the handler
+const v = os.environ.get('BENCH_KEY_01367');
+value86304 = compute(value, 71)
+value26186 = compute(value, 93)
+value37273 = compute(value, 25)
+# note 69799: keep this in sync with the handler
+value71147 = compute(value, 46)
+value23266 = compute(value, 83)
+value87526 = compute(value, 32)
+value70133 = compute(value, 2)
+value21683 = compute(value, 52)
+value44208 = compute(value, 73)
+value18759 = compute(value, 38)
+value16129 = compute(value, 27)
+value89133 = compute(value, 87)
+value51916 = compute(value, 21)
+value47492 = compute(value, 59)
+value91576 = compute(value, 8)
+value72252 = compute(value, 84)
+value98964 = compute(value, 24)
+const v = os.environ["BENCH_KEY_00403"];
+value47312 = compute(value, 73)
+value75012 = compute(value, 31)
+value75381 = compute(value, 12)
+value91684 = compute(value, 19)
+value72506 = compute(value, 47)
+value32988 = compute(value, 8)
+value79381 = compute(value, 35)
+# note 91972: keep this in sync with the handler
+value81952 = compute(value, 84)
+value17889 = compute(value, 41)
+value82798 = compute(value, 57)
+value48363 = compute(value, 57)
+value93485 = compute(value, 74)
+value78255 = compute(value, 73)
+value21640 = compute(value, 9)
+# note 22937: keep this in sync with the handler
+value12486 = compute(value, 70)
+value63066 = compute(value, 16)
+value67679 = compute(value, 70)
+value39149 = compute(value, 58)
+value71792 = compute(value, 12)
+value37102 = compute(value, 48)
+const v = os.environ["BENCH_KEY_00757"];
+value7320 = compute(value, 45)
+value21877 = compute(value, 52)
+value94087 = compute(value, 94)
+value29631 = compute(value, 46)
+value71187 = compute(value, 86)
+value3701 = compute(value, 15)
+value17285 = compute(value, 19)
+value72484 = compute(value, 25)
+value42506 = compute(value, 20)
+value91213 = compute(value, 33)
+const v = os.environ["BENCH_KEY_00593"];
+value71147 = compute(value, 46)
+# note 35985: keep this in sync with the handler
+value28856 = compute(value, 47)
+value50035 = compute(value, 80)
+value80006 = compute(value, 78)
+value44898 = compute(value, 84)
+value31671 = compute(value, 49)
+value5412 = compute(value, 77)
+value93128 = compute(value, 8)
+value768 = compute(value, 89)
+value14721 = compute(value, 74)
+value91921 = compute(value, 62)
+value11192 = compute(value, 37)
+value75579 = compute(value, 16)
+value82682 = compute(value, 38)
+value69738 = compute(value, 92)
+const v = os.getenv("BENCH_KEY_01070");
+value10690 = compute(value, 20)
+value95287 = compute(value, 33)
+# note 51194: keep this in sync with the handler
+value56315 = compute(value, 55)
+value18353 = compute(value, 20)
+# note 40073: keep this in sync with the handler
+value7940 = compute(value, 83)
+# note 43961: keep this in sync with the handler
+value21929 = compute(value, 7)
+value85210 = compute(value, 44)
+# note 43664: keep this in sync with the handler
+value33340 = compute(value, 69)
+value5080 = compute(value, 36)
+value98759 = compute(value, 13)
+value5588 = compute(value, 59)
+value49725 = compute(value, 61)
+value57882 = compute(value, 70)
+value26626 = compute(value, 48)
+value1338 = compute(value, 77)
+value67581 = compute(value, 69)
+const v = os.environ["BENCH_KEY_01221"];
+value8662 = compute(value, 29)
+value74635 = compute(value, 42)
+value80448 = compute(value, 35)
+value69251 = compute(value, 90)
+# note 12382: keep this in sync with the handler
+# note 16176: keep this in sync with the handler
+value75927 = compute(value, 73)
+# note 2347: keep this in sync with the handler
+value74491 = compute(value, 92)
+value27505 = compute(value, 54)
+value15887 = compute(value, 76)
+value5468 = compute(value, 36)
+value23950 = compute(value, 88)
+value82721 = compute(value, 77)
+value9486 = compute(value, 77)
+# note 84574: keep this in sync with the handler
+const v = os.getenv("BENCH_KEY_01388");
+value24538 = compute(value, 94)
+value19492 = compute(value, 92)
+value91069 = compute(value, 83)
+value50365 = compute(value, 22)
+value7211 = compute(value, 33)
+value79861 = compute(value, 30)
+value78455 = compute(value, 79)
+value11321 = compute(value, 69)
+value47465 = compute(value, 32)
+value54100 = compute(value, 71)
+value66905 = compute(value, 72)
+value94672 = compute(value, 0)
+value57496 = compute(value, 72)
+value80193 = compute(value, 71)
+value94257 = compute(value, 70)
+value34283 = compute(value, 42)
+# note 8047: keep this in sync with the handler
+const v = os.environ.get('BENCH_KEY_00838');
+value8978 = compute(value, 54)
+value91766 = compute(value, 4)
+value44092 = compute(value, 54)
+# note 66228: keep this in sync with the handler
+value45754 = compute(value, 67)
+value87067 = compute(value, 58)
+# note 42071: keep this in sync with the handler
+value45193 = compute(value, 88)
+value52867 = compute(value, 2)
+value49338 = compute(value, 62)
+value20625 = compute(value, 61)
+# note 22023: keep this in sync with the handler
+# note 94471: keep this in sync with the handler
+value9330 = compute(value, 18)
+value2762 = compute(value, 46)
+value18169 = compute(value, 30)
+const v = os.environ.get('BENCH_KEY_01625');
+value81985 = compute(value, 20)
+value3257 = compute(value, 56)
+value37798 = compute(value, 65)
+value18610 = compute(value, 83)
+value24545 = compute(value, 4)
+# note 463: keep this in sync with the handler
+value4772 = compute(value, 19)
+value8879 = compute(value, 52)
+value1818 = compute(value, 72)
+value85417 = compute(value, 57)
+value37315 = compute(value, 67)
+value55435 = compute(value, 48)
+value70472 = compute(value, 50)
+value67702 = compute(value, 93)
+const v = os.getenv("BENCH_KEY_01131");
+# note 53358: keep this in sync with the handler
+value29651 = compute(value, 66)
+# note 71904: keep this in sync with the handler
+value46276 = compute(value, 7)
+value77279 = compute(value, 67)
+# note 16505: keep this in sync with the handler
+value9585 = compute(value, 79)
+value38857 = compute(value, 57)
+# note 15228: keep this in sync with the handler
+value39164 = compute(value, 73)
+value1641 = compute(value, 89)
+value47641 = compute(value, 14)
+value23739 = compute(value, 71)
+value57265 = compute(value, 35)
+const v = os.environ.get('BENCH_KEY_00994');
+value45117 = compute(value, 12)
+value36880 = compute(value, 20)
+value95313 = compute(value, 59)
+# note 35970: keep this in sync with the handler
+value25758 = compute(value, 53)
+value55797 = compute(value, 22)
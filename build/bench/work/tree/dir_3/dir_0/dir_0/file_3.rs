@@ -0,0 +1,213 @@
+let value18481 = compute(value, 51);
+let value10897 = compute(value, 33);
+let value95353 = compute(value, 2);
+let value10303 = compute(value, 21);
+let value56215 = compute(value, 52);
+let value8183 = compute(value, 35);
+let value33280 = compute(value, 9);
+let value54314 = compute(value, 91);
+// note 17463: keep this in sync with the handler
+let value14354 = compute(value, 95);
+let value97601 = compute(value, 19);
+let value80451 = compute(value, 38);
+let value84929 = compute(value, 54);
+const v = env::var_os("BENCH_KEY_00062");
+let value59683 = compute(value, 28);
+let value33295 = compute(value, 24);
+let value90469 = compute(value, 65);
+let value68224 = compute(value, 33);
+let value91675 = compute(value, 10);
+let value14726 = compute(value, 79);
+// note 65785: keep this in sync with the handler
+let value72564 = compute(value, 8);
+let value55588 = compute(value, 7);
+let value69687 = compute(value, 41);
+let value77522 = compute(value, 19);
+let value64925 = compute(value, 32);
+let value19129 = compute(value, 20);
+let value83113 = compute(value, 81);
+const v = env::var_os("BENCH_KEY_01282");
+let value35098 = compute(value, 81);
+let value13477 = compute(value, 91);
+let value81650 = compute(value, 73);
+let value860 = compute(value, 84);
+// note 84242: keep this in sync with the handler
+let value84367 = compute(value, 74);
+let value46046 = compute(value, 68);
+let value13050 = compute(value, 52);
+let value57770 = compute(value, 55);
+// note 5577: keep this in sync with the handler
+let value40447 = compute(value, 95);
+// note 56244: keep this in sync with the handler
+let value3752 = compute(value, 66);
+let value64959 = compute(value, 66);
+let value19427 = compute(value, 27);
+let value10751 = compute(value, 81);
+let value247 = compute(value, 53);
+let value69131 = compute(value, 67);
+let value24212 = compute(value, 59);
+let value96632 = compute(value, 20);
+const v = env::var_os("BENCH_KEY_01481");
+let value29031 = compute(value, 28);
+let value22452 = compute(value, 45);
+let value89808 = compute(value, 83);
+let value37098 = compute(value, 44);
+let value94314 = compute(value, 30);
+let value75430 = compute(value, 61);
+let value84602 = compute(value, 18);
+let value43813 = compute(value, 66);
+let value31798 = compute(value, 79);
+const v = env::var_os("BENCH_KEY_00293");
+let value76925 = compute(value, 4);
+let value44489 = compute(value, 63);
+let value703 = compute(value, 24);
+let value613 = compute(value, 31);
+let value18251 = compute(value, 15);
+let value74790 = compute(value, 3);
+let value99387 = compute(value, 59);
+let value77829 = compute(value, 35);
+let value8061 = compute(value, 10);
+let value66800 = compute(value, 64);
+let value46992 = compute(value, 44);
+let value26377 = compute(value, 90);
+let value47860 = compute(value, 39);
+let value93335 = compute(value, 21);
+let value77311 = compute(value, 2);
+let value94276 = compute(value, 89);
+let value67628 = compute(value, 19);
+let value72181 = compute(value, 13);
+// note 69313: keep this in sync with the handler
+const v = env::var("BENCH_KEY_01772");
+let value30381 = compute(value, 20);
+let value60424 = compute(value, 90);
+let value45212 = compute(value, 10);
+let value39722 = compute(value, 49);
+let value2856 = compute(value, 43);
+let value34105 = compute(value, 58);
+let value5838 = compute(value, 18);
+// note 94392: keep this in sync with the handler
+let value17514 = compute(value, 54);
+// note 8500: keep this in sync with the handler
+let value76591 = compute(value, 58);
+let value8991 = compute(value, 67);
+let value71864 = compute(value, 84);
+let value21252 = compute(value, 9);
+let value62196 = compute(value, 19);
+const v = env::var_os("BENCH_KEY_01378");
+let value5541 = compute(value, 12);
+let value67198 = compute(value, 74);
+let value22258 = compute(value, 45);
+let value58679 = compute(value, 91);
+let value15746 = compute(value, 32);
+let value30357 = compute(value, 93);
+let value63997 = compute(value, 74);
+let value85003 = compute(value, 31);
+let value79699 = compute(value, 62);
+let value46589 = compute(value, 29);
+let value61351 = compute(value, 47);
+let value61347 = compute(value, 43);
+// note 98536: keep this in sync with the handler
+// note 6961: keep this in sync with the handler
+const v = env::var("BENCH_KEY_01769");
+let value82000 = compute(value, 35);
+let value89749 = compute(value, 24);
+let value55329 = compute(value, 39);
+let value70542 = compute(value, 23);
+let value65237 = compute(value, 53);
+// note 44370: keep this in sync with the handler
+let value14154 = compute(value, 89);
+let value65928 = compute(value, 65);
+let value65256 = compute(value, 72);
+let value26797 = compute(value, 25);
+let value36030 = compute(value, 43);
+let value46051 = compute(value, 73);
+let value78174 = compute(value, 89);
+let value78324 = compute(value, 45);
+// note 24903: keep this in sync with the handler
+const v = env::var_os("BENCH_KEY_00366");
+let value46608 = compute(value, 48);
+// note 86528: keep this in sync with the handler
+let value75528 = compute(value, 62);
+let value43845 = compute(value, 1);
+let value19006 = compute(value, 91);
+let value79782 = compute(value, 48);
+let value32956 = compute(value, 73);
+let value70469 = compute(value, 47);
+let value2051 = compute(value, 14);
+// note 45910: keep this in sync with the handler
+const v = env::var_os("BENCH_KEY_01600");
+let value43207 = compute(value, 42);
+let value59122 = compute(value, 49);
+let value55573 = compute(value, 89);
+let value55736 = compute(value, 58);
+// note 50349: keep this in sync with the handler
+let value61375 = compute(value, 71);
+let value60112 = compute(value, 69);
+let value96720 = compute(value, 11);
+let value8562 = compute(value, 26);
+let value55290 = compute(value, 0);
+const v = env::var("BENCH_KEY_01384");
+let value32034 = compute(value, 24);
+let value67468 = compute(value, 53);
+let value48560 = compute(value, 60);
+let value84902 = compute(value, 27);
+let value79731 = compute(value, 94);
+let value63786 = compute(value, 57);
+let value45685 = compute(value, 95);
+let value59746 = compute(value, 91);
+let value62448 = compute(value, 77);
+const v = env::var("BENCH_KEY_01281");
+let value4904 = compute(value, 54);
+let value91942 = compute(value, 83);
+// note 61663: keep this in sync with the handler
+let value67159 = compute(value, 35);
+let value9665 = compute(value, 62);
+let value76294 = compute(value, 52);
+let value71149 = compute(value, 48);
+let value25554 = compute(value, 43);
+let value72963 = compute(value, 19);
+let value20875 = compute(value, 20);
+let value11695 = compute(value, 55);
+const v = env::var_os("BENCH_KEY_00565");
+let value75719 = compute(value, 59);
+let value77488 = compute(value, 82);
+let value26860 = compute(value, 88);
+let value5920 = compute(value, 3);
+let value60782 = compute(value, 60);
+let value37829 = compute(value, 96);
+let value99633 = compute(value, 14);
+let value87927 = compute(value, 45);
+// note 74455: keep this in sync with the handler
+let value61476 = compute(value, 75);
+let value31193 = compute(value, 56);
+let value67630 = compute(value, 21);
+let value53883 = compute(value, 48);
+const v = env::var_os("BENCH_KEY_01573");
+let value35752 = compute(value, 56);
+let value80646 = compute(value, 39);
+let value15368 = compute(value, 42);
+let value13274 = compute(value, 82);
+// note 87253: keep this in sync with the handler
+let value1390 = compute(value, 32);
+// note 48722: keep this in sync with the handler
+let value63310 = compute(value, 66);
+let value77117 = compute(value, 2);
+let value36229 = compute(value, 48);
+let value5758 = compute(value, 35);
+const v = env::var_os("BENCH_KEY_01774");
+let value86610 = compute(value, 86);
+let value26776 = compute(value, 4);
+let value30041 = compute(value, 68);
+let value61492 = compute(value, 91);
+let value17778 = compute(value, 27);
+// note 78420: keep this in sync with the handler
+let value35373 = compute(value, 65);
+// note 44637: keep this in sync with the handler
+let value3098 = compute(value, 91);
+let value54603 = compute(value, 89);
+let value64442 = compute(value, 34);
+let value87580 = compute(value, 86);
+// note 89100: keep this in sync with the handler
+const v = env::var("BENCH_KEY_01193");
+// note 549: keep this in sync with the handler
+// note 56223: keep this in sync with the handler
@@ -0,0 +1,229 @@
+value35842 := compute(value, 49)
+// note 75880: keep this in sync with the handler
+value80438 := compute(value, 25)
+// note 38510: keep this in sync with the handler
+// note 17890: keep this in sync with the handler
+value45561 := compute(value, 68)
+value82489 := compute(value, 39)
+value45051 := compute(value, 43)
+value55308 := compute(value, 18)
+value93928 := compute(value, 32)
+value1244 := compute(value, 80)
+const v = os.LookupEnv("BENCH_KEY_00251");
+value61648 := compute(value, 53)
+value59008 := compute(value, 32)
+value90515 := compute(value, 14)
+value79040 := compute(value, 82)
+value69684 := compute(value, 38)
+value21211 := compute(value, 65)
+value58920 := compute(value, 41)
+value94602 := compute(value, 27)
+value23193 := compute(value, 10)
+value2727 := compute(value, 11)
+value77237 := compute(value, 25)
+value77073 := compute(value, 55)
+value60008 := compute(value, 62)
+value62568 := compute(value, 3)
+// note 64692: keep this in sync with the handler
+value90225 := compute(value, 15)
+const v = os.Getenv("BENCH_KEY_00104");
+value10670 := compute(value, 0)
+// note 24061: keep this in sync with the handler
+value40812 := compute(value, 72)
+// note 67195: keep this in sync with the handler
+value77690 := compute(value, 90)
+value22291 := compute(value, 78)
+value48799 := compute(value, 8)
+value42180 := compute(value, 82)
+value43531 := compute(value, 75)
+value45531 := compute(value, 38)
+value35662 := compute(value, 63)
+value31298 := compute(value, 64)
+value71265 := compute(value, 67)
+// note 56466: keep this in sync with the handler
+const v = os.LookupEnv("BENCH_KEY_01711");
+// note 97965: keep this in sync with the handler
+value21321 := compute(value, 78)
+value22290 := compute(value, 77)
+value54332 := compute(value, 12)
+value96358 := compute(value, 37)
+value56749 := compute(value, 4)
+value42952 := compute(value, 78)
+// note 11205: keep this in sync with the handler
+value3151 := compute(value, 47)
+value77917 := compute(value, 26)
+value18148 := compute(value, 9)
+value98840 := compute(value, 94)
+value33496 := compute(value, 31)
+value3880 := compute(value, 0)
+value48717 := compute(value, 23)
+value52189 := compute(value, 3)
+value68921 := compute(value, 51)
+value36476 := compute(value, 4)
+value83281 := compute(value, 55)
+const v = os.Getenv("BENCH_KEY_01872");
+value37058 := compute(value, 4)
+// note 19133: keep this in sync with the handler
+value3773 := compute(value, 87)
+value94877 := compute(value, 11)
+value38416 := compute(value, 4)
+value13871 := compute(value, 0)
+// note 85143: keep this in sync with the handler
+value69087 := compute(value, 23)
+value28246 := compute(value, 19)
+value13891 := compute(value, 20)
+value7446 := compute(value, 74)
+// note 46321: keep this in sync with the handler
+// note 81353: keep this in sync with the handler
+value48259 := compute(value, 50)
+value41479 := compute(value, 60)
+// note 81033: keep this in sync with the handler
+const v = os.LookupEnv("BENCH_KEY_00178");
+value48855 := compute(value, 64)
+value17504 := compute(value, 44)
+value67657 := compute(value, 48)
+value62622 := compute(value, 57)
+// note 68239: keep this in sync with the handler
+// note 5100: keep this in sync with the handler
+value34215 := compute(value, 71)
+value84279 := compute(value, 83)
+value8161 := compute(value, 13)
+// note 83815: keep this in sync with the handler
+value81076 := compute(value, 81)
+value10122 := compute(value, 34)
+value70760 := compute(value, 47)
+value63857 := compute(value, 31)
+value75618 := compute(value, 55)
+const v = os.Getenv("BENCH_KEY_00439");
+// note 76016: keep this in sync with the handler
+// note 6142: keep this in sync with the handler
+value97923 := compute(value, 50)
+value54704 := compute(value, 93)
+value90952 := compute(value, 63)
+value81502 := compute(value, 22)
+value26200 := compute(value, 10)
+value59703 := compute(value, 48)
+value96531 := compute(value, 16)
+value63097 := compute(value, 47)
+value22632 := compute(value, 31)
+value82748 := compute(value, 7)
+// note 41532: keep this in sync with the handler
+value23852 := compute(value, 87)
+value61524 := compute(value, 26)
+value82403 := compute(value, 50)
+value83322 := compute(value, 96)
+value82937 := compute(value, 2)
+// note 15112: keep this in sync with the handler
+const v = os.LookupEnv("BENCH_KEY_00490");
+// note 63693: keep this in sync with the handler
+value37961 := compute(value, 34)
+value44598 := compute(value, 75)
+value66885 := compute(value, 52)
+value83404 := compute(value, 81)
+value62598 := compute(value, 33)
+value80256 := compute(value, 37)
+value15917 := compute(value, 9)
+value87244 := compute(value, 41)
+const v = os.LookupEnv("BENCH_KEY_00565");
+value32992 := compute(value, 12)
+value81918 := compute(value, 50)
+value82604 := compute(value, 57)
+value85058 := compute(value, 86)
+value87290 := compute(value, 87)
+// note 13575: keep this in sync with the handler
+value35626 := compute(value, 27)
+value21775 := compute(value, 47)
+value71988 := compute(value, 14)
+value10303 := compute(value, 21)
+value12747 := compute(value, 40)
+value38940 := compute(value, 43)
+value98275 := compute(value, 14)
+value31465 := compute(value, 37)
+// note 13107: keep this in sync with the handler
+value94366 := compute(value, 82)
+value21 := compute(value, 21)
+value27550 := compute(value, 2)
+value28967 := compute(value, 61)
+value85189 := compute(value, 23)
+value77884 := compute(value, 90)
+value65139 := compute(value, 52)
+const v = os.LookupEnv("BENCH_KEY_00407");
+value42889 := compute(value, 15)
+value94321 := compute(value, 37)
+value53155 := compute(value, 96)
+value46693 := compute(value, 36)
+value46206 := compute(value, 34)
+// note 77251: keep this in sync with the handler
+// note 15649: keep this in sync with the handler
+value2790 := compute(value, 74)
+value27822 := compute(value, 80)
+value189 := compute(value, 92)
+// note 73548: keep this in sync with the handler
+value32255 := compute(value, 51)
+value83958 := compute(value, 53)
+const v = os.Getenv("BENCH_KEY_01585");
+value76256 := compute(value, 14)
+value41191 := compute(value, 63)
+value28769 := compute(value, 57)
+value64266 := compute(value, 52)
+value92282 := compute(value, 35)
+value81659 := compute(value, 82)
+value62287 := compute(value, 13)
+value35903 := compute(value, 13)
+value73438 := compute(value, 9)
+value33058 := compute(value, 78)
+value95416 := compute(value, 65)
+const v = os.Getenv("BENCH_KEY_00823");
+value48558 := compute(value, 58)
+// note 8345: keep this in sync with the handler
+value91986 := compute(value, 30)
+value40986 := compute(value, 52)
+value17146 := compute(value, 74)
+value92232 := compute(value, 82)
+// note 61425: keep this in sync with the handler
+value33422 := compute(value, 54)
+value65049 := compute(value, 59)
+// note 70106: keep this in sync with the handler
+const v = os.LookupEnv("BENCH_KEY_00426");
+value59902 := compute(value, 53)
+value7688 := compute(value, 25)
+value59813 := compute(value, 61)
+value46268 := compute(value, 96)
+// note 90477: keep this in sync with the handler
+value9843 := compute(value, 46)
+value79848 := compute(value, 17)
+value90361 := compute(value, 54)
+value23218 := compute(value, 35)
+value67704 := compute(value, 95)
+value20403 := compute(value, 33)
+value92032 := compute(value, 76)
+value1031 := compute(value, 61)
+value96774 := compute(value, 65)
+value10047 := compute(value, 56)
+value47276 := compute(value, 37)
+value62970 := compute(value, 17)
+value13225 := compute(value, 33)
+const v = os.Getenv("BENCH_KEY_01037");
+value19520 := compute(value, 23)
+value19679 := compute(value, 85)
+value54186 := compute(value, 60)
+value60066 := compute(value, 23)
+value81608 := compute(value, 31)
+value35926 := compute(value, 36)
+value12059 := compute(value, 31)
+value2535 := compute(value, 13)
+value76332 := compute(value, 90)
+value22606 := compute(value, 5)
+value67238 := compute(value, 17)
+value58493 := compute(value, 2)
+value16842 := compute(value, 61)
+value68108 := compute(value, 14)
+// note 9330: keep this in sync with the handler
+// note 78011: keep this in sync with the handler
+value32369 := compute(value, 68)
+value2531 := compute(value, 9)
+const v = os.Getenv("BENCH_KEY_00699");
+value92652 := compute(value, 17)
+value79240 := compute(value, 88)
+value71398 := compute(value, 6)
+// note 47894: keep this in sync with the handler
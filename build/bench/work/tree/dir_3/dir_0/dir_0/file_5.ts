@@ -0,0 +1,205 @@
+const value19573 = compute(value, 76);
+const value29702 = compute(value, 20);
+// note 59352: keep this in sync with the handler
+const value3820 = compute(value, 37);
+const value35428 = compute(value, 23);
+const v = process.env["BENCH_KEY_01303"];
+const value39789 = compute(value, 19);
+const value4089 = compute(value, 15);
+const value30423 = compute(value, 62);
+const value82730 = compute(value, 86);
+// note 90132: keep this in sync with the handler
+const value39268 = compute(value, 80);
+const value61344 = compute(value, 40);
+const value94594 = compute(value, 19);
+const value796 = compute(value, 20);
+const value92608 = compute(value, 70);
+const value59730 = compute(value, 75);
+const value45498 = compute(value, 5);
+const value47360 = compute(value, 24);
+const value52523 = compute(value, 46);
+const value7575 = compute(value, 9);
+const v = process.env.BENCH_KEY_00278;
+const value65725 = compute(value, 56);
+const value92425 = compute(value, 81);
+const value97914 = compute(value, 41);
+const value34485 = compute(value, 50);
+// note 58499: keep this in sync with the handler
+const value68943 = compute(value, 73);
+const value37666 = compute(value, 30);
+const value95722 = compute(value, 80);
+// note 36276: keep this in sync with the handler
+const value91011 = compute(value, 25);
+const value13236 = compute(value, 44);
+// note 18148: keep this in sync with the handler
+const value92030 = compute(value, 74);
+const value68506 = compute(value, 24);
+const value2972 = compute(value, 62);
+const value64802 = compute(value, 6);
+const value29250 = compute(value, 53);
+const value81200 = compute(value, 11);
+const value82740 = compute(value, 96);
+const v = process.env["BENCH_KEY_01796"];
+const value73546 = compute(value, 20);
+const value46969 = compute(value, 21);
+const value3700 = compute(value, 14);
+const value59861 = compute(value, 12);
+const value36854 = compute(value, 91);
+const value5715 = compute(value, 89);
+const value85979 = compute(value, 37);
+const value25526 = compute(value, 15);
+const value84274 = compute(value, 78);
+const value49121 = compute(value, 39);
+const value46307 = compute(value, 38);
+const value70984 = compute(value, 77);
+const value56564 = compute(value, 13);
+const v = process.env["BENCH_KEY_01888"];
+// note 12562: keep this in sync with the handler
+const value33177 = compute(value, 3);
+const value92135 = compute(value, 82);
+const value33795 = compute(value, 39);
+// note 59562: keep this in sync with the handler
+const value32320 = compute(value, 19);
+const value10576 = compute(value, 3);
+const value48132 = compute(value, 20);
+const value61335 = compute(value, 31);
+const value47185 = compute(value, 43);
+const value22530 = compute(value, 26);
+const value74469 = compute(value, 70);
+// note 9706: keep this in sync with the handler
+const value99026 = compute(value, 86);
+const value80279 = compute(value, 60);
+const value75358 = compute(value, 86);
+const value1261 = compute(value, 0);
+const value89651 = compute(value, 23);
+const value17618 = compute(value, 61);
+const v = import.meta.env.BENCH_KEY_00855;
+const value46131 = compute(value, 56);
+const value75803 = compute(value, 46);
+const value39563 = compute(value, 84);
+const value95014 = compute(value, 51);
+// note 66107: keep this in sync with the handler
+const value1610 = compute(value, 58);
+const value65010 = compute(value, 20);
+const value69288 = compute(value, 30);
+const value33692 = compute(value, 33);
+const value28009 = compute(value, 73);
+const value10039 = compute(value, 48);
+const value43717 = compute(value, 67);
+const value2104 = compute(value, 67);
+const value88867 = compute(value, 15);
+const value93316 = compute(value, 2);
+// note 40773: keep this in sync with the handler
+const v = process.env["BENCH_KEY_00319"];
+const value28189 = compute(value, 59);
+const value20066 = compute(value, 84);
+const value63435 = compute(value, 94);
+const value15331 = compute(value, 5);
+const value52731 = compute(value, 60);
+const value52768 = compute(value, 0);
+const value73462 = compute(value, 33);
+const value19944 = compute(value, 59);
+const value14965 = compute(value, 27);
+const value68406 = compute(value, 21);
+const value89852 = compute(value, 30);
+const value55531 = compute(value, 47);
+const v = process.env["BENCH_KEY_00195"];
+// note 79177: keep this in sync with the handler
+// note 38941: keep this in sync with the handler
+const value82781 = compute(value, 40);
+// note 20765: keep this in sync with the handler
+const value74271 = compute(value, 66);
+const value79254 = compute(value, 5);
+// note 19674: keep this in sync with the handler
+const value82545 = compute(value, 95);
+const value4269 = compute(value, 1);
+const value72109 = compute(value, 38);
+const value47860 = compute(value, 39);
+const value66301 = compute(value, 50);
+const value87269 = compute(value, 66);
+const value61381 = compute(value, 77);
+// note 63864: keep this in sync with the handler
+const v = import.meta.env.BENCH_KEY_01800;
+const value25582 = compute(value, 71);
+const value18139 = compute(value, 0);
+const value92322 = compute(value, 75);
+const value76569 = compute(value, 36);
+const value73005 = compute(value, 61);
+const value38026 = compute(value, 2);
+const value67596 = compute(value, 84);
+const value41929 = compute(value, 25);
+const value37156 = compute(value, 5);
+const value3913 = compute(value, 33);
+const value74971 = compute(value, 87);
+const value78130 = compute(value, 45);
+const value90011 = compute(value, 92);
+const value74953 = compute(value, 69);
+const value59761 = compute(value, 9);
+const value511 = compute(value, 26);
+const value84791 = compute(value, 13);
+const v = process.env["BENCH_KEY_01253"];
+const value30351 = compute(value, 87);
+const value23396 = compute(value, 19);
+const value40421 = compute(value, 69);
+const value98465 = compute(value, 10);
+const value81486 = compute(value, 6);
+const value20410 = compute(value, 40);
+// note 54301: keep this in sync with the handler
+const value43113 = compute(value, 45);
+const value50881 = compute(value, 53);
+const value85713 = compute(value, 62);
+const v = import.meta.env.BENCH_KEY_01518;
+const value18856 = compute(value, 38);
+const value6912 = compute(value, 25);
+const value52806 = compute(value, 38);
+const value80160 = compute(value, 38);
+const value70606 = compute(value, 87);
+const value57065 = compute(value, 29);
+const value46359 = compute(value, 90);
+const value64749 = compute(value, 50);
+const value84565 = compute(value, 78);
+const value89843 = compute(value, 21);
+// note 2931: keep this in sync with the handler
+const value81987 = compute(value, 22);
+// note 16718: keep this in sync with the handler
+const value42948 = compute(value, 74);
+const value40562 = compute(value, 16);
+const v = import.meta.env.BENCH_KEY_01356;
+const value66753 = compute(value, 17);
+const value46007 = compute(value, 29);
+const value4105 = compute(value, 31);
+const value98236 = compute(value, 72);
+const value10665 = compute(value, 92);
+const value95658 = compute(value, 16);
+const value732 = compute(value, 53);
+const value44169 = compute(value, 34);
+const value99545 = compute(value, 23);
+const value5980 = compute(value, 63);
+const v = import.meta.env.BENCH_KEY_01168;
+const value16162 = compute(value, 60);
+// note 63772: keep this in sync with the handler
+const value16341 = compute(value, 45);
+const value63273 = compute(value, 29);
+const value54524 = compute(value, 10);
+const value74882 = compute(value, 95);
+const value84586 = compute(value, 2);
+const value15239 = compute(value, 10);
+const value40567 = compute(value, 21);
+const value61333 = compute(value, 29);
+// note 96841: keep this in sync with the handler
+const value15694 = compute(value, 77);
+const value23390 = compute(value, 13);
+const v = import.meta.env.BENCH_KEY_00269;
+const value36006 = compute(value, 19);
+const value25913 = compute(value, 14);
+const value28173 = compute(value, 43);
+const value95204 = compute(value, 47);
+const value15248 = compute(value, 19);
+const value24263 = compute(value, 13);
+const value37340 = compute(value, 92);
+const value60074 = compute(value, 31);
+const value85995 = compute(value, 53);
+// note 17623: keep this in sync with the handler
+const value45948 = compute(value, 67);
+const value50148 = compute(value, 96);
+const value10728 = compute(value, 58);
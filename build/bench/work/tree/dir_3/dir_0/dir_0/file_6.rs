@@ -0,0 +1,213 @@
+let value12456 = compute(value, 40);
+const v = env::var("BENCH_KEY_00604");
+let value64702 = compute(value, 3);
+let value67737 = compute(value, 31);
+// note 82980: keep this in sync with the handler
+let value97987 = compute(value, 17);
+let value50831 = compute(value, 3);
+let value49683 = compute(value, 19);
+let value33592 = compute(value, 30);
+let value79785 = compute(value, 51);
+let value40962 = compute(value, 28);
+let value48076 = compute(value, 61);
+// note 1554: keep this in sync with the handler
+let value87611 = compute(value, 20);
+let value93734 = compute(value, 32);
+let value79156 = compute(value, 4);
+let value63789 = compute(value, 60);
+// note 43700: keep this in sync with the handler
+let value96563 = compute(value, 48);
+let value39877 = compute(value, 10);
+let value59132 = compute(value, 59);
+let value73695 = compute(value, 72);
+const v = env::var("BENCH_KEY_01711");
+// note 20054: keep this in sync with the handler
+let value20350 = compute(value, 77);
+let value49773 = compute(value, 12);
+// note 42467: keep this in sync with the handler
+let value68165 = compute(value, 71);
+let value3851 = compute(value, 68);
+let value28204 = compute(value, 74);
+// note 92265: keep this in sync with the handler
+let value32253 = compute(value, 49);
+let value4961 = compute(value, 14);
+let value70275 = compute(value, 47);
+let value35035 = compute(value, 18);
+let value53292 = compute(value, 39);
+// note 99257: keep this in sync with the handler
+let value28637 = compute(value, 22);
+let value74207 = compute(value, 2);
+let value39945 = compute(value, 78);
+const v = env::var("BENCH_KEY_00110");
+let value70931 = compute(value, 24);
+let value61710 = compute(value, 18);
+let value85195 = compute(value, 29);
+let value9407 = compute(value, 95);
+// note 61109: keep this in sync with the handler
+let value69946 = compute(value, 9);
+let value39995 = compute(value, 31);
+// note 96811: keep this in sync with the handler
+let value43639 = compute(value, 86);
+let value91019 = compute(value, 33);
+let value43349 = compute(value, 87);
+let value20378 = compute(value, 8);
+let value52779 = compute(value, 11);
+let value13533 = compute(value, 50);
+let value4941 = compute(value, 91);
+let value61041 = compute(value, 28);
+let value41852 = compute(value, 45);
+let value25648 = compute(value, 40);
+const v = env::var("BENCH_KEY_00487");
+let value4715 = compute(value, 59);
+let value55033 = compute(value, 34);
+let value49279 = compute(value, 3);
+let value942 = compute(value, 69);
+let value51412 = compute(value, 2);
+let value87297 = compute(value, 94);
+let value32612 = compute(value, 20);
+// note 57304: keep this in sync with the handler
+let value7528 = compute(value, 59);
+let value93011 = compute(value, 85);
+let value70762 = compute(value, 49);
+const v = env::var_os("BENCH_KEY_01471");
+let value16568 = compute(value, 78);
+let value14901 = compute(value, 60);
+// note 24432: keep this in sync with the handler
+// note 5104: keep this in sync with the handler
+let value53680 = compute(value, 39);
+let value92819 = compute(value, 87);
+let value88326 = compute(value, 56);
+let value38172 = compute(value, 51);
+// note 12608: keep this in sync with the handler
+let value94249 = compute(value, 62);
+let value29373 = compute(value, 79);
+let value26400 = compute(value, 16);
+let value5663 = compute(value, 37);
+let value33046 = compute(value, 66);
+let value16351 = compute(value, 55);
+let value83527 = compute(value, 10);
+const v = env::var_os("BENCH_KEY_01051");
+let value1221 = compute(value, 57);
+let value57856 = compute(value, 44);
+// note 96739: keep this in sync with the handler
+let value25798 = compute(value, 93);
+let value87618 = compute(value, 27);
+let value70510 = compute(value, 88);
+let value29202 = compute(value, 5);
+let value19776 = compute(value, 85);
+let value95709 = compute(value, 67);
+let value31185 = compute(value, 48);
+let value86356 = compute(value, 26);
+let value94973 = compute(value, 10);
+let value22433 = compute(value, 26);
+let value58192 = compute(value, 89);
+let value84175 = compute(value, 76);
+let value92417 = compute(value, 73);
+let value42240 = compute(value, 45);
+let value685 = compute(value, 6);
+const v = env::var("BENCH_KEY_00920");
+let value39672 = compute(value, 96);
+let value78195 = compute(value, 13);
+let value82569 = compute(value, 22);
+// note 64602: keep this in sync with the handler
+let value83042 = compute(value, 10);
+let value73008 = compute(value, 64);
+let value78226 = compute(value, 44);
+let value727 = compute(value, 48);
+let value29102 = compute(value, 2);
+let value60928 = compute(value, 12);
+let value6930 = compute(value, 43);
+let value53956 = compute(value, 24);
+let value13837 = compute(value, 63);
+let value93380 = compute(value, 66);
+let value59543 = compute(value, 82);
+let value33078 = compute(value, 1);
+let value35628 = compute(value, 29);
+let value2810 = compute(value, 94);
+let value47918 = compute(value, 0);
+const v = env::var("BENCH_KEY_00869");
+let value93582 = compute(value, 74);
+let value32006 = compute(value, 93);
+let value5950 = compute(value, 33);
+let value80510 = compute(value, 0);
+let value12316 = compute(value, 94);
+let value34897 = compute(value, 74);
+// note 31079: keep this in sync with the handler
+let value9913 = compute(value, 19);
+let value31054 = compute(value, 14);
+// note 34643: keep this in sync with the handler
+let value89175 = compute(value, 32);
+// note 74040: keep this in sync with the handler
+let value64888 = compute(value, 92);
+let value1764 = compute(value, 18);
+let value11784 = compute(value, 47);
+let value9431 = compute(value, 22);
+const v = env::var_os("BENCH_KEY_00672");
+let value7375 = compute(value, 3);
+// note 72498: keep this in sync with the handler
+// note 48397: keep this in sync with the handler
+let value8633 = compute(value, 0);
+let value32756 = compute(value, 67);
+let value98374 = compute(value, 16);
+let value74822 = compute(value, 35);
+let value70019 = compute(value, 82);
+let value48115 = compute(value, 3);
+const v = env::var_os("BENCH_KEY_01164");
+let value18672 = compute(value, 48);
+let value61557 = compute(value, 59);
+let value94974 = compute(value, 11);
+// note 63683: keep this in sync with the handler
+let value43434 = compute(value, 75);
+let value57276 = compute(value, 46);
+let value56513 = compute(value, 59);
+let value86373 = compute(value, 43);
+let value80224 = compute(value, 5);
+let value79983 = compute(value, 55);
+let value80509 = compute(value, 96);
+let value23255 = compute(value, 72);
+let value17623 = compute(value, 66);
+let value9918 = compute(value, 24);
+let value78560 = compute(value, 87);
+let value30274 = compute(value, 10);
+const v = env::var("BENCH_KEY_01097");
+let value68852 = compute(value, 79);
+let value54803 = compute(value, 95);
+let value2250 = compute(value, 19);
+let value80804 = compute(value, 3);
+let value27570 = compute(value, 22);
+// note 25762: keep this in sync with the handler
+// note 28268: keep this in sync with the handler
+let value93766 = compute(value, 64);
+let value3084 = compute(value, 77);
+let value88039 = compute(value, 60);
+let value51850 = compute(value, 52);
+const v = env::var_os("BENCH_KEY_00301");
+let value6828 = compute(value, 38);
+let value30920 = compute(value, 74);
+let value87267 = compute(value, 64);
+let value81566 = compute(value, 86);
+let value71002 = compute(value, 95);
+let value76909 = compute(value, 85);
+let value71209 = compute(value, 11);
+let value45975 = compute(value, 94);
+// note 67469: keep this in sync with the handler
+// note 97214: keep this in sync with the handler
+let value37768 = compute(value, 35);
+let value56996 = compute(value, 57);
+let value44321 = compute(value, 89);
+let value20813 = compute(value, 55);
+const v = env::var("BENCH_KEY_01493");
+let value54768 = compute(value, 60);
+let value4537 = compute(value, 75);
+let value42324 = compute(value, 32);
+// note 59936: keep this in sync with the handler
+let value27662 = compute(value, 17);
+let value26669 = compute(value, 91);
+let value30564 = compute(value, 9);
+let value97511 = compute(value, 26);
+let value26998 = compute(value, 32);
+let value23621 = compute(value, 50);
+let value63034 = compute(value, 81);
+let value58050 = compute(value, 44);
+let value60330 = compute(value, 93);
+let value59771 = compute(value, 19);
@@ -0,0 +1,231 @@
+value92922 := compute(value, 93)
+value66002 := compute(value, 42)
+value64181 := compute(value, 64)
+value70054 := compute(value, 20)
+value53633 := compute(value, 89)
+value16560 := compute(value, 70)
+value72150 := compute(value, 79)
+value82384 := compute(value, 31)
+value42067 := compute(value, 66)
+value47790 := compute(value, 66)
+value59539 := compute(value, 78)
+value75452 := compute(value, 83)
+value84479 := compute(value, 89)
+value11548 := compute(value, 5)
+const v = os.LookupEnv("BENCH_KEY_01817");
+// note 45581: keep this in sync with the handler
+value76846 := compute(value, 22)
+value42448 := compute(value, 59)
+value2666 := compute(value, 47)
+value95345 := compute(value, 91)
+value49493 := compute(value, 23)
+value62715 := compute(value, 53)
+value6157 := compute(value, 46)
+value93287 := compute(value, 70)
+value61094 := compute(value, 81)
+value54830 := compute(value, 25)
+// note 55327: keep this in sync with the handler
+value39066 := compute(value, 72)
+// note 660: keep this in sync with the handler
+value61338 := compute(value, 34)
+value75284 := compute(value, 12)
+value76554 := compute(value, 21)
+const v = os.Getenv("BENCH_KEY_00075");
+value12763 := compute(value, 56)
+value93541 := compute(value, 33)
+value29849 := compute(value, 70)
+value68049 := compute(value, 52)
+// note 45156: keep this in sync with the handler
+value67627 := compute(value, 18)
+value51779 := compute(value, 78)
+value537 := compute(value, 52)
+// note 96091: keep this in sync with the handler
+const v = os.Getenv("BENCH_KEY_01622");
+value75723 := compute(value, 63)
+// note 23940: keep this in sync with the handler
+// note 59332: keep this in sync with the handler
+value50475 := compute(value, 35)
+value2447 := compute(value, 22)
+value58365 := compute(value, 68)
+value58979 := compute(value, 3)
+value36856 := compute(value, 93)
+value88920 := compute(value, 68)
+value82458 := compute(value, 8)
+value52311 := compute(value, 28)
+// note 52704: keep this in sync with the handler
+value45416 := compute(value, 20)
+// note 35159: keep this in sync with the handler
+value94302 := compute(value, 18)
+value51413 := compute(value, 3)
+// note 89313: keep this in sync with the handler
+value70264 := compute(value, 36)
+value95972 := compute(value, 39)
+value17762 := compute(value, 11)
+value49800 := compute(value, 39)
+const v = os.LookupEnv("BENCH_KEY_00572");
+value97659 := compute(value, 77)
+value85785 := compute(value, 37)
+value96927 := compute(value, 24)
+value92141 := compute(value, 88)
+value32924 := compute(value, 41)
+value72358 := compute(value, 93)
+value42183 := compute(value, 85)
+value84948 := compute(value, 73)
+value87891 := compute(value, 9)
+value38723 := compute(value, 20)
+value91173 := compute(value, 90)
+value19564 := compute(value, 67)
+value87532 := compute(value, 38)
+value70045 := compute(value, 11)
+value54346 := compute(value, 26)
+value16245 := compute(value, 46)
+// note 39543: keep this in sync with the handler
+const v = os.Getenv("BENCH_KEY_00239");
+value4021 := compute(value, 44)
+value92702 := compute(value, 67)
+value10110 := compute(value, 22)
+value22159 := compute(value, 43)
+value89648 := compute(value, 20)
+value36842 := compute(value, 79)
+value40395 := compute(value, 43)
+value63932 := compute(value, 9)
+value693 := compute(value, 14)
+value27429 := compute(value, 75)
+value5969 := compute(value, 52)
+value97602 := compute(value, 20)
+const v = os.LookupEnv("BENCH_KEY_00155");
+value40669 := compute(value, 26)
+value19717 := compute(value, 26)
+value87811 := compute(value, 26)
+value25089 := compute(value, 63)
+value9495 := compute(value, 86)
+// note 11681: keep this in sync with the handler
+value68644 := compute(value, 65)
+value86859 := compute(value, 44)
+value37813 := compute(value, 80)
+value38317 := compute(value, 2)
+value25858 := compute(value, 56)
+const v = os.Getenv("BENCH_KEY_00276");
+value63121 := compute(value, 71)
+value77084 := compute(value, 66)
+value90271 := compute(value, 61)
+value38458 := compute(value, 46)
+value44677 := compute(value, 57)
+value12534 := compute(value, 21)
+value4021 := compute(value, 44)
+value27337 := compute(value, 80)
+value18372 := compute(value, 39)
+value16359 := compute(value, 63)
+value61266 := compute(value, 59)
+value5068 := compute(value, 24)
+// note 4315: keep this in sync with the handler
+const v = os.LookupEnv("BENCH_KEY_01779");
+value80515 := compute(value, 5)
+value45888 := compute(value, 7)
+// note 82631: keep this in sync with the handler
+value4351 := compute(value, 83)
+// note 41383: keep this in sync with the handler
+value50205 := compute(value, 56)
+value61676 := compute(value, 81)
+value4849 := compute(value, 96)
+// note 92098: keep this in sync with the handler
+value84366 := compute(value, 73)
+value32984 := compute(value, 4)
+value86014 := compute(value, 72)
+value47541 := compute(value, 11)
+value10455 := compute(value, 76)
+value39057 := compute(value, 63)
+value96697 := compute(value, 85)
+value34340 := compute(value, 2)
+const v = os.Getenv("BENCH_KEY_01338");
+value73597 := compute(value, 71)
+// note 91426: keep this in sync with the handler
+value87466 := compute(value, 69)
+// note 30101: keep this in sync with the handler
+value20819 := compute(value, 61)
+value46193 := compute(value, 21)
+value16887 := compute(value, 9)
+value19738 := compute(value, 47)
+value32717 := compute(value, 28)
+value46304 := compute(value, 35)
+const v = os.LookupEnv("BENCH_KEY_00317");
+value39711 := compute(value, 38)
+value29822 := compute(value, 43)
+value19727 := compute(value, 36)
+value64023 := compute(value, 3)
+value56013 := compute(value, 44)
+value48667 := compute(value, 70)
+value28704 := compute(value, 89)
+// note 2353: keep this in sync with the handler
+value32746 := compute(value, 57)
+value17101 := compute(value, 29)
+value90645 := compute(value, 47)
+value68893 := compute(value, 23)
+value97228 := compute(value, 34)
+value25190 := compute(value, 67)
+value23687 := compute(value, 19)
+// note 86101: keep this in sync with the handler
+const v = os.LookupEnv("BENCH_KEY_01564");
+value24961 := compute(value, 32)
+value64382 := compute(value, 71)
+value96553 := compute(value, 38)
+value9798 := compute(value, 1)
+value98888 := compute(value, 45)
+value63259 := compute(value, 15)
+value56238 := compute(value, 75)
+value46276 := compute(value, 7)
+// note 60793: keep this in sync with the handler
+value116 := compute(value, 19)
+value72625 := compute(value, 69)
+value96603 := compute(value, 88)
+value79984 := compute(value, 56)
+// note 80344: keep this in sync with the handler
+value63160 := compute(value, 13)
+const v = os.LookupEnv("BENCH_KEY_00672");
+// note 64801: keep this in sync with the handler
+// note 1994: keep this in sync with the handler
+value17769 := compute(value, 18)
+// note 34069: keep this in sync with the handler
+value14271 := compute(value, 12)
+value5620 := compute(value, 91)
+value82426 := compute(value, 73)
+// note 80923: keep this in sync with the handler
+// note 81577: keep this in sync with the handler
+const v = os.LookupEnv("BENCH_KEY_01244");
+value62181 := compute(value, 4)
+value37645 := compute(value, 9)
+value68817 := compute(value, 44)
+value71170 := compute(value, 69)
+value89126 := compute(value, 80)
+value34611 := compute(value, 79)
+value59600 := compute(value, 42)
+value78243 := compute(value, 61)
+value43436 := compute(value, 77)
+value29593 := compute(value, 8)
+value15250 := compute(value, 21)
+value26834 := compute(value, 62)
+value55780 := compute(value, 5)
+value20965 := compute(value, 13)
+value91695 := compute(value, 30)
+value70254 := compute(value, 26)
+value85515 := compute(value, 58)
+value15109 := compute(value, 74)
+const v = os.Getenv("BENCH_KEY_00006");
+value45321 := compute(value, 22)
+value87117 := compute(value, 11)
+value85658 := compute(value, 7)
+// note 81100: keep this in sync with the handler
+value33116 := compute(value, 39)
+value24766 := compute(value, 31)
+value5850 := compute(value, 30)
+value70125 := compute(value, 91)
+// note 34000: keep this in sync with the handler
+value53774 := compute(value, 36)
+value78727 := compute(value, 60)
+value27218 := compute(value, 58)
+// note 64875: keep this in sync with the handler
+const v = os.LookupEnv("BENCH_KEY_00299");
+value47583 := compute(value, 53)
+value50536 := compute(value, 96)
+value76695 := compute(value, 65)
+value61401 := compute(value, 0)
@@ -0,0 +1,204 @@
+// note 6192: keep this in sync with the handler
+const v = process.env["BENCH_KEY_00553"];
+const value56075 = compute(value, 9);
+const value91070 = compute(value, 84);
+const value28827 = compute(value, 18);
+const value16743 = compute(value, 59);
+// note 21558: keep this in sync with the handler
+const value94915 = compute(value, 49);
+const value22335 = compute(value, 25);
+const value44970 = compute(value, 59);
+const value55523 = compute(value, 39);
+const value51334 = compute(value, 21);
+// note 80662: keep this in sync with the handler
+const value33478 = compute(value, 13);
+const value71062 = compute(value, 58);
+const value40614 = compute(value, 68);
+const value17575 = compute(value, 18);
+const value6838 = compute(value, 48);
+const value4896 = compute(value, 46);
+const v = process.env["BENCH_KEY_01284"];
+const value19783 = compute(value, 92);
+const value32200 = compute(value, 93);
+const value73064 = compute(value, 23);
+const value63514 = compute(value, 76);
+const value85110 = compute(value, 41);
+// note 86743: keep this in sync with the handler
+const value6756 = compute(value, 63);
+const value69691 = compute(value, 45);
+const value82860 = compute(value, 22);
+const value16086 = compute(value, 81);
+const value56773 = compute(value, 28);
+const value95546 = compute(value, 1);
+// note 63885: keep this in sync with the handler
+const v = process.env["BENCH_KEY_01454"];
+const value83911 = compute(value, 6);
+const value76612 = compute(value, 79);
+const value94396 = compute(value, 15);
+const value78493 = compute(value, 20);
+const value60385 = compute(value, 51);
+// note 44905: keep this in sync with the handler
+const value85246 = compute(value, 80);
+const value16980 = compute(value, 5);
+// note 44361: keep this in sync with the handler
+// note 57264: keep this in sync with the handler
+const value19347 = compute(value, 44);
+const value92650 = compute(value, 15);
+const value34941 = compute(value, 21);
+const value68016 = compute(value, 19);
+// note 35421: keep this in sync with the handler
+const value36619 = compute(value, 50);
+const v = process.env["BENCH_KEY_00939"];
+const value36853 = compute(value, 90);
+const value45098 = compute(value, 90);
+const value24206 = compute(value, 53);
+const value17987 = compute(value, 42);
+const value98955 = compute(value, 15);
+const value1174 = compute(value, 10);
+const value22358 = compute(value, 48);
+const value1663 = compute(value, 14);
+// note 61170: keep this in sync with the handler
+const value30591 = compute(value, 36);
+const value93049 = compute(value, 26);
+const value54345 = compute(value, 25);
+const value9323 = compute(value, 11);
+const value93989 = compute(value, 93);
+const value50790 = compute(value, 59);
+const value7445 = compute(value, 73);
+const value68501 = compute(value, 19);
+const value83580 = compute(value, 63);
+const value23350 = compute(value, 70);
+const value33972 = compute(value, 22);
+const v = process.env.BENCH_KEY_01573;
+const value3262 = compute(value, 61);
+const value54463 = compute(value, 46);
+// note 41114: keep this in sync with the handler
+const value4748 = compute(value, 92);
+const value21714 = compute(value, 83);
+const value90587 = compute(value, 86);
+const value68399 = compute(value, 14);
+const value12303 = compute(value, 81);
+const value11948 = compute(value, 17);
+const value48220 = compute(value, 11);
+const value90389 = compute(value, 82);
+const value36942 = compute(value, 82);
+// note 57906: keep this in sync with the handler
+const value93063 = compute(value, 40);
+// note 73254: keep this in sync with the handler
+const value89774 = compute(value, 49);
+const value1061 = compute(value, 91);
+const value48748 = compute(value, 54);
+const v = process.env.BENCH_KEY_01171;
+const value69314 = compute(value, 56);
+const value63536 = compute(value, 1);
+const value89453 = compute(value, 19);
+const value16818 = compute(value, 37);
+// note 22747: keep this in sync with the handler
+const value12449 = compute(value, 33);
+const value19368 = compute(value, 65);
+const value76445 = compute(value, 9);
+const value64476 = compute(value, 68);
+const value31445 = compute(value, 17);
+const value85607 = compute(value, 53);
+const value25585 = compute(value, 74);
+const value94138 = compute(value, 48);
+const value32792 = compute(value, 6);
+const value77288 = compute(value, 76);
+const value94237 = compute(value, 50);
+const value55921 = compute(value, 49);
+// note 67296: keep this in sync with the handler
+const value94742 = compute(value, 70);
+const v = import.meta.env.BENCH_KEY_01503;
+const value14159 = compute(value, 94);
+const value26333 = compute(value, 46);
+const value51711 = compute(value, 10);
+const value28057 = compute(value, 24);
+const value85979 = compute(value, 37);
+const value74368 = compute(value, 66);
+// note 31549: keep this in sync with the handler
+const value33357 = compute(value, 86);
+const value83040 = compute(value, 8);
+const value91718 = compute(value, 53);
+const value45463 = compute(value, 67);
+const value57368 = compute(value, 41);
+const v = import.meta.env.BENCH_KEY_01319;
+const value31290 = compute(value, 56);
+const value59758 = compute(value, 6);
+const value27419 = compute(value, 65);
+const value6609 = compute(value, 13);
+// note 81030: keep this in sync with the handler
+const value61615 = compute(value, 20);
+const value25435 = compute(value, 21);
+const value4742 = compute(value, 86);
+const value98838 = compute(value, 92);
+const v = import.meta.env.BENCH_KEY_00764;
+const value80509 = compute(value, 96);
+const value1614 = compute(value, 62);
+const value5172 = compute(value, 31);
+const value43344 = compute(value, 82);
+const value15736 = compute(value, 22);
+const value1276 = compute(value, 15);
+const value23867 = compute(value, 5);
+const value64258 = compute(value, 44);
+const value19930 = compute(value, 45);
+const value80361 = compute(value, 45);
+const value7251 = compute(value, 73);
+const value82456 = compute(value, 6);
+const value94985 = compute(value, 22);
+const value46563 = compute(value, 3);
+const value33300 = compute(value, 29);
+const value98679 = compute(value, 30);
+// note 10944: keep this in sync with the handler
+const v = import.meta.env.BENCH_KEY_00271;
+const value7204 = compute(value, 26);
+const value78942 = compute(value, 81);
+const value46505 = compute(value, 42);
+const value83079 = compute(value, 47);
+const value44158 = compute(value, 23);
+const value96535 = compute(value, 20);
+const value5532 = compute(value, 3);
+const value5622 = compute(value, 93);
+const value62177 = compute(value, 0);
+const value94442 = compute(value, 61);
+// note 57586: keep this in sync with the handler
+const value32444 = compute(value, 46);
+const value40999 = compute(value, 65);
+const value45257 = compute(value, 55);
+const value76713 = compute(value, 83);
+const value27679 = compute(value, 34);
+// note 58516: keep this in sync with the handler
+const value21434 = compute(value, 94);
+// note 14192: keep this in sync with the handler
+const v = process.env.BENCH_KEY_01425;
+const value10083 = compute(value, 92);
+const value64081 = compute(value, 61);
+const value23355 = compute(value, 75);
+const value86086 = compute(value, 47);
+const value35857 = compute(value, 64);
+const value22954 = compute(value, 62);
+const value51628 = compute(value, 24);
+const value84124 = compute(value, 25);
+const value75385 = compute(value, 16);
+const v = process.env["BENCH_KEY_00869"];
+const value17110 = compute(value, 38);
+const value20929 = compute(value, 74);
+const value16168 = compute(value, 66);
+const value92926 = compute(value, 0);
+// note 39725: keep this in sync with the handler
+const value92409 = compute(value, 65);
+const value1531 = compute(value, 76);
+const value67900 = compute(value, 0);
+const value33555 = compute(value, 90);
+const value70018 = compute(value, 81);
+const value51276 = compute(value, 60);
+const value1211 = compute(value, 47);
+const value94762 = compute(value, 90);
+const value77493 = compute(value, 87);
+const value27499 = compute(value, 48);
+const value3697 = compute(value, 11);
+const value21117 = compute(value, 68);
+const value20220 = compute(value, 44);
+const value76040 = compute(value, 89);
+const value23393 = compute(value, 16);
+const v = process.env["BENCH_KEY_01610"];
+const value25264 = compute(value, 44);
@@ -0,0 +1,214 @@
+// note 21816: keep this in sync with the handler
+let value28581 = compute(value, 63);
+const v = env::var("BENCH_KEY_00085");
+let value31764 = compute(value, 45);
+let value2203 = compute(value, 69);
+let value84607 = compute(value, 23);
+let value80610 = compute(value, 3);
+let value51231 = compute(value, 15);
+let value42339 = compute(value, 47);
+let value44761 = compute(value, 44);
+let value429 = compute(value, 41);
+let value7470 = compute(value, 1);
+let value81820 = compute(value, 49);
+let value22239 = compute(value, 26);
+// note 48064: keep this in sync with the handler
+let value41796 = compute(value, 86);
+let value99392 = compute(value, 64);
+let value8945 = compute(value, 21);
+let value65520 = compute(value, 45);
+const v = env::var_os("BENCH_KEY_01324");
+let value59921 = compute(value, 72);
+let value21878 = compute(value, 53);
+let value33376 = compute(value, 8);
+// note 84297: keep this in sync with the handler
+let value40500 = compute(value, 51);
+// note 55433: keep this in sync with the handler
+let value9560 = compute(value, 54);
+let value11647 = compute(value, 7);
+let value39052 = compute(value, 58);
+let value25715 = compute(value, 10);
+let value61598 = compute(value, 3);
+// note 78508: keep this in sync with the handler
+let value37448 = compute(value, 6);
+let value51690 = compute(value, 86);
+let value54442 = compute(value, 25);
+let value18893 = compute(value, 75);
+let value84981 = compute(value, 9);
+let value6747 = compute(value, 54);
+const v = env::var_os("BENCH_KEY_00173");
+// note 36772: keep this in sync with the handler
+let value98379 = compute(value, 21);
+let value14809 = compute(value, 65);
+let value16455 = compute(value, 62);
+let value97194 = compute(value, 0);
+let value52803 = compute(value, 35);
+let value44709 = compute(value, 89);
+let value92502 = compute(value, 61);
+let value63051 = compute(value, 1);
+const v = env::var_os("BENCH_KEY_00119");
+let value99359 = compute(value, 31);
+let value55811 = compute(value, 36);
+let value107 = compute(value, 10);
+let value34666 = compute(value, 37);
+let value18308 = compute(value, 72);
+let value73655 = compute(value, 32);
+let value42266 = compute(value, 71);
+let value61556 = compute(value, 58);
+let value44738 = compute(value, 21);
+let value83176 = compute(value, 47);
+let value87503 = compute(value, 9);
+let value51363 = compute(value, 50);
+let value41580 = compute(value, 64);
+let value77629 = compute(value, 29);
+// note 73595: keep this in sync with the handler
+// note 21580: keep this in sync with the handler
+let value73339 = compute(value, 7);
+let value8568 = compute(value, 32);
+let value94701 = compute(value, 29);
+let value43232 = compute(value, 67);
+const v = env::var_os("BENCH_KEY_01827");
+let value66960 = compute(value, 30);
+let value54968 = compute(value, 66);
+// note 36429: keep this in sync with the handler
+// note 78929: keep this in sync with the handler
+let value97216 = compute(value, 22);
+let value64353 = compute(value, 42);
+let value70400 = compute(value, 75);
+let value41311 = compute(value, 86);
+// note 84593: keep this in sync with the handler
+let value73610 = compute(value, 84);
+const v = env::var_os("BENCH_KEY_00910");
+// note 37089: keep this in sync with the handler
+let value39472 = compute(value, 90);
+let value84823 = compute(value, 45);
+let value41736 = compute(value, 26);
+let value34745 = compute(value, 19);
+let value8125 = compute(value, 74);
+let value59366 = compute(value, 2);
+let value4459 = compute(value, 94);
+let value63612 = compute(value, 77);
+let value19267 = compute(value, 61);
+const v = env::var_os("BENCH_KEY_01279");
+let value41801 = compute(value, 91);
+let value58620 = compute(value, 32);
+let value46432 = compute(value, 66);
+let value88226 = compute(value, 53);
+let value74712 = compute(value, 22);
+let value44628 = compute(value, 8);
+let value84235 = compute(value, 39);
+let value57271 = compute(value, 41);
+// note 30791: keep this in sync with the handler
+const v = env::var_os("BENCH_KEY_00891");
+let value10920 = compute(value, 56);
+// note 50779: keep this in sync with the handler
+let value22281 = compute(value, 68);
+let value36705 = compute(value, 39);
+let value59254 = compute(value, 84);
+let value28228 = compute(value, 1);
+let value6640 = compute(value, 44);
+let value98675 = compute(value, 26);
+const v = env::var("BENCH_KEY_01770");
+let value88705 = compute(value, 47);
+// note 50761: keep this in sync with the handler
+// note 1124: keep this in sync with the handler
+let value71449 = compute(value, 57);
+let value87378 = compute(value, 78);
+let value10716 = compute(value, 46);
+let value62076 = compute(value, 93);
+let value6207 = compute(value, 96);
+let value28442 = compute(value, 21);
+// note 46759: keep this in sync with the handler
+let value22806 = compute(value, 11);
+const v = env::var("BENCH_KEY_00400");
+let value93150 = compute(value, 30);
+let value49905 = compute(value, 47);
+let value63125 = compute(value, 75);
+let value68626 = compute(value, 47);
+let value93640 = compute(value, 35);
+let value14271 = compute(value, 12);
+let value94223 = compute(value, 36);
+let value93770 = compute(value, 68);
+let value44864 = compute(value, 50);
+let value64762 = compute(value, 63);
+let value2377 = compute(value, 49);
+const v = env::var("BENCH_KEY_00013");
+let value61437 = compute(value, 36);
+let value22448 = compute(value, 41);
+let value45400 = compute(value, 4);
+let value39770 = compute(value, 0);
+let value97456 = compute(value, 68);
+let value16769 = compute(value, 85);
+let value19666 = compute(value, 72);
+let value1930 = compute(value, 87);
+let value83654 = compute(value, 40);
+let value93084 = compute(value, 61);
+let value48306 = compute(value, 0);
+let value29165 = compute(value, 65);
+let value85600 = compute(value, 46);
+// note 45048: keep this in sync with the handler
+let value83264 = compute(value, 38);
+let value86327 = compute(value, 94);
+let value12779 = compute(value, 72);
+let value56456 = compute(value, 2);
+let value56065 = compute(value, 96);
+let value89731 = compute(value, 6);
+let value33569 = compute(value, 7);
+const v = env::var_os("BENCH_KEY_00760");
+let value13989 = compute(value, 21);
+let value69401 = compute(value, 46);
+let value66557 = compute(value, 15);
+let value70685 = compute(value, 69);
+let value68828 = compute(value, 55);
+let value43850 = compute(value, 6);
+// note 44951: keep this in sync with the handler
+// note 51137: keep this in sync with the handler
+const v = env::var("BENCH_KEY_00974");
+let value90657 = compute(value, 59);
+let value36764 = compute(value, 1);
+let value14752 = compute(value, 8);
+let value32450 = compute(value, 52);
+let value87989 = compute(value, 10);
+let value5852 = compute(value, 32);
+let value97428 = compute(value, 40);
+let value2129 = compute(value, 92);
+let value41675 = compute(value, 62);
+let value41562 = compute(value, 46);
+let value53654 = compute(value, 13);
+let value58110 = compute(value, 7);
+let value88887 = compute(value, 35);
+let value22871 = compute(value, 76);
+let value16420 = compute(value, 27);
+let value84873 = compute(value, 95);
+let value11591 = compute(value, 48);
+let value87390 = compute(value, 90);
+let value29810 = compute(value, 31);
+let value99394 = compute(value, 66);
+const v = env::var("BENCH_KEY_00990");
+// note 3473: keep this in sync with the handler
+let value39567 = compute(value, 88);
+// note 78539: keep this in sync with the handler
+let value53487 = compute(value, 40);
+let value98757 = compute(value, 11);
+let value80943 = compute(value, 45);
+let value73040 = compute(value, 96);
+let value73196 = compute(value, 58);
+let value60036 = compute(value, 90);
+let value83163 = compute(value, 34);
+let value33483 = compute(value, 18);
+let value4600 = compute(value, 41);
+let value47180 = compute(value, 38);
+let value19643 = compute(value, 49);
+let value60023 = compute(value, 77);
+let value73886 = compute(value, 69);
+let value69539 = compute(value, 87);
+let value25153 = compute(value, 30);
+let value14175 = compute(value, 13);
+const v = env::var("BENCH_KEY_00293");
+let value76244 = compute(value, 2);
+let value55621 = compute(value, 40);
+// note 78664: keep this in sync with the handler
+let value37341 = compute(value, 93);
+let value39154 = compute(value, 63);
+let value36973 = compute(value, 16);
+let value80549 = compute(value, 39);
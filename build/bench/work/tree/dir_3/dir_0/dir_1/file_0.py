@@ -0,0 +1,239 @@
+value98571 = compute(value, 19)
+value42261 = compute(value, 66)
+value52818 = compute(value, 50)
+value10138 = compute(value, 50)
+value33702 = compute(value, 43)
+value31593 = compute(value, 68)
+value99236 = compute(value, 5)
+value79337 = compute(value, 88)
+value32520 = compute(value, 25)
+value63464 = compute(value, 26)
+value99979 = compute(value, 69)
+value54110 = compute(value, 81)
+const v = os.getenv("BENCH_KEY_01964");
+value98688 = compute(value, 39)
+value95261 = compute(value, 7)
+value14238 = compute(value, 76)
+value29913 = compute(value, 37)
+value23221 = compute(value, 38)
+value54078 = compute(value, 49)
+value61364 = compute(value, 60)
+value64012 = compute(value, 89)
+# note 74736: keep this in sync with the handler
+# note 99381: keep this in sync with the handler
+# note 42307: keep this in sync with the handler
+value97687 = compute(value, 8)
+value35616 = compute(value, 17)
+value78096 = compute(value, 11)
+value54796 = compute(value, 88)
+value35217 = compute(value, 6)
+value66172 = compute(value, 18)
+# note 39963: keep this in sync with the handler
+value77592 = compute(value, 89)
+const v = os.environ.get('BENCH_KEY_00916');
+value52391 = compute(value, 11)
+value2631 = compute(value, 12)
+value41490 = compute(value, 71)
+value22307 = compute(value, 94)
+value67854 = compute(value, 51)
+value35286 = compute(value, 75)
+value4973 = compute(value, 26)
+value41220 = compute(value, 92)
+# note 29378: keep this in sync with the handler
+value9054 = compute(value, 33)
+# note 5328: keep this in sync with the handler
+value25829 = compute(value, 27)
+value61997 = compute(value, 14)
+value81853 = compute(value, 82)
+value98412 = compute(value, 54)
+# note 33613: keep this in sync with the handler
+value87707 = compute(value, 19)
+# note 96138: keep this in sync with the handler
+value93424 = compute(value, 13)
+value48924 = compute(value, 36)
+const v = os.environ.get('BENCH_KEY_00974');
+value63156 = compute(value, 9)
+value44951 = compute(value, 40)
+value65760 = compute(value, 91)
+value8651 = compute(value, 18)
+value42582 = compute(value, 96)
+value55824 = compute(value, 49)
+value51546 = compute(value, 39)
+value28501 = compute(value, 80)
+value23202 = compute(value, 19)
+const v = os.getenv("BENCH_KEY_00920");
+value25436 = compute(value, 22)
+value27430 = compute(value, 76)
+value90496 = compute(value, 92)
+# note 83433: keep this in sync with the handler
+value42669 = compute(value, 86)
+value80799 = compute(value, 95)
+# note 44256: keep this in sync with the handler
+value11596 = compute(value, 53)
+value88254 = compute(value, 81)
+value66700 = compute(value, 61)
+value50941 = compute(value, 16)
+# note 33579: keep this in sync with the handler
+const v = os.environ["BENCH_KEY_00228"];
+value63384 = compute(value, 43)
+value80277 = compute(value, 58)
+value11261 = compute(value, 9)
+value69624 = compute(value, 75)
+value80679 = compute(value, 72)
+value68170 = compute(value, 76)
+value66161 = compute(value, 7)
+value46479 = compute(value, 16)
+value96214 = compute(value, 87)
+value66027 = compute(value, 67)
+value61393 = compute(value, 89)
+value5375 = compute(value, 40)
+const v = os.getenv("BENCH_KEY_00518");
+value39333 = compute(value, 48)
+value19896 = compute(value, 11)
+value37074 = compute(value, 20)
+value54234 = compute(value, 11)
+value98001 = compute(value, 31)
+value88934 = compute(value, 82)
+value46244 = compute(value, 72)
+value82466 = compute(value, 16)
+value47563 = compute(value, 33)
+const v = os.environ["BENCH_KEY_01196"];
+value8529 = compute(value, 90)
+value7006 = compute(value, 22)
+value76492 = compute(value, 56)
+value33440 = compute(value, 72)
+value84191 = compute(value, 92)
+value49966 = compute(value, 11)
+value91928 = compute(value, 69)
+value55983 = compute(value, 14)
+value64877 = compute(value, 81)
+value66327 = compute(value, 76)
+value21374 = compute(value, 34)
+# note 64801: keep this in sync with the handler
+value81197 = compute(value, 8)
+value98115 = compute(value, 48)
+value23788 = compute(value, 23)
+value52477 = compute(value, 0)
+value60435 = compute(value, 4)
+value56156 = compute(value, 90)
+value84331 = compute(value, 38)
+const v = os.getenv("BENCH_KEY_01634");
+value10716 = compute(value, 46)
+value78213 = compute(value, 31)
+value25785 = compute(value, 80)
+# note 37202: keep this in sync with the handler
+# note 52062: keep this in sync with the handler
+value45863 = compute(value, 79)
+# note 51472: keep this in sync with the handler
+value14311 = compute(value, 52)
+value92477 = compute(value, 36)
+value11039 = compute(value, 78)
+value88758 = compute(value, 3)
+value51192 = compute(value, 73)
+value45666 = compute(value, 76)
+value29118 = compute(value, 18)
+value31889 = compute(value, 73)
+value57551 = compute(value, 30)
+value52464 = compute(value, 84)
+value59397 = compute(value, 33)
+const v = os.environ["BENCH_KEY_00898"];
+value53085 = compute(value, 26)
+value45221 = compute(value, 19)
+value92590 = compute(value, 52)
+# note 9931: keep this in sync with the handler
+# note 51761: keep this in sync with the handler
+value30310 = compute(value, 46)
+value94347 = compute(value, 63)
+value13718 = compute(value, 41)
+value57140 = compute(value, 7)
+value20895 = compute(value, 40)
+value93641 = compute(value, 36)
+value3591 = compute(value, 2)
+value41562 = compute(value, 46)
+const v = os.environ.get('BENCH_KEY_00507');
+value9494 = compute(value, 85)
+value94193 = compute(value, 6)
+value39701 = compute(value, 28)
+value78464 = compute(value, 88)
+value11885 = compute(value, 51)
+value68680 = compute(value, 4)
+value49658 = compute(value, 91)
+value49480 = compute(value, 10)
+value61538 = compute(value, 40)
+value68214 = compute(value, 23)
+value13860 = compute(value, 86)
+value45285 = compute(value, 83)
+value59311 = compute(value, 44)
+value36492 = compute(value, 20)
+value27984 = compute(value, 48)
+value43226 = compute(value, 61)
+value56423 = compute(value, 66)
+# note 8386: keep this in sync with the handler
+value96916 = compute(value, 13)
+const v = os.environ.get('BENCH_KEY_01070');
+value18235 = compute(value, 96)
+value11248 = compute(value, 93)
+value68917 = compute(value, 47)
+value79853 = compute(value, 22)
+# note 25192: keep this in sync with the handler
+value46206 = compute(value, 34)
+value84296 = compute(value, 3)
+value2109 = compute(value, 72)
+value39026 = compute(value, 32)
+value32618 = compute(value, 26)
+value44106 = compute(value, 68)
+value73874 = compute(value, 57)
+value73538 = compute(value, 12)
+value82091 = compute(value, 29)
+value26352 = compute(value, 65)
+value83992 = compute(value, 87)
+const v = os.environ.get('BENCH_KEY_00809');
+value6317 = compute(value, 12)
+# note 13618: keep this in sync with the handler
+# note 80452: keep this in sync with the handler
+value48136 = compute(value, 24)
+value3546 = compute(value, 54)
+value87344 = compute(value, 44)
+# note 31364: keep this in sync with the handler
+value57181 = compute(value, 48)
+value65823 = compute(value, 57)
+value23719 = compute(value, 51)
+value18462 = compute(value, 32)
+value69791 = compute(value, 48)
+value47190 = compute(value, 48)
+value75485 = compute(value, 19)
+value90212 = compute(value, 2)
+# note 96823: keep this in sync with the handler
+value44594 = compute(value, 71)
+value24310 = compute(value, 60)
+value33824 = compute(value, 68)
+value8661 = compute(value, 28)
+const v = os.environ["BENCH_KEY_01663"];
+value66260 = compute(value, 9)
+value6471 = compute(value, 69)
+value91655 = compute(value, 87)
+value32313 = compute(value, 12)
+value33746 = compute(value, 87)
+value96879 = compute(value, 73)
+value92617 = compute(value, 79)
+value55709 = compute(value, 31)
+value77445 = compute(value, 39)
+value59356 = compute(value, 89)
+value83889 = compute(value, 81)
+value17549 = compute(value, 89)
+# note 70932: keep this in sync with the handler
+# note 4903: keep this in sync with the handler
+value25716 = compute(value, 11)
+value49324 = compute(value, 48)
+value25229 = compute(value, 9)
+value11816 = compute(value, 79)
+value23544 = compute(value, 70)
+value96014 = compute(value, 81)
+value45461 = compute(value, 65)
+const v = os.getenv("BENCH_KEY_00943");
+# note 42636: keep this in sync with the handler
+# note 18392: keep this in sync with the handler
+value60334 = compute(value, 0)
+value78631 = compute(value, 61)
+value94394 = compute(value, 13)
+value38024 = compute(value, 0)
@@ -0,0 +1,202 @@
+const value46289 = compute(value, 20);
+const value96224 = compute(value, 0);
+const value33563 = compute(value, 1);
+const value84804 = compute(value, 26);
+const value9939 = compute(value, 45);
+const value1332 = compute(value, 71);
+const value67464 = compute(value, 49);
+const value85839 = compute(value, 91);
+const v = process.env.BENCH_KEY_01463;
+const value96858 = compute(value, 52);
+const value52669 = compute(value, 95);
+const value11586 = compute(value, 43);
+const value25519 = compute(value, 8);
+// note 32211: keep this in sync with the handler
+const value41242 = compute(value, 17);
+const value46676 = compute(value, 19);
+const value94757 = compute(value, 85);
+const value48170 = compute(value, 58);
+const value42308 = compute(value, 16);
+const v = import.meta.env.BENCH_KEY_00106;
+const value2307 = compute(value, 76);
+const value14878 = compute(value, 37);
+const value29509 = compute(value, 21);
+const value4796 = compute(value, 43);
+// note 67787: keep this in sync with the handler
+const value71166 = compute(value, 65);
+// note 1379: keep this in sync with the handler
+const value88093 = compute(value, 17);
+// note 67474: keep this in sync with the handler
+const value28241 = compute(value, 14);
+const v = process.env.BENCH_KEY_01121;
+// note 5003: keep this in sync with the handler
+const value52704 = compute(value, 33);
+const value71299 = compute(value, 4);
+const value77026 = compute(value, 8);
+const value18936 = compute(value, 21);
+const value38716 = compute(value, 13);
+// note 49487: keep this in sync with the handler
+const value25413 = compute(value, 96);
+const value65159 = compute(value, 72);
+const value69834 = compute(value, 91);
+// note 95482: keep this in sync with the handler
+const value85584 = compute(value, 30);
+const value35142 = compute(value, 28);
+const v = process.env["BENCH_KEY_00726"];
+const value33294 = compute(value, 23);
+const value29056 = compute(value, 53);
+const value51930 = compute(value, 35);
+// note 57003: keep this in sync with the handler
+const value91125 = compute(value, 42);
+const value22986 = compute(value, 94);
+const value81334 = compute(value, 48);
+const value88177 = compute(value, 4);
+const value93806 = compute(value, 7);
+const value53225 = compute(value, 69);
+const value22958 = compute(value, 66);
+const value58730 = compute(value, 45);
+const value28417 = compute(value, 93);
+// note 41715: keep this in sync with the handler
+const value56154 = compute(value, 88);
+const value44436 = compute(value, 10);
+// note 21361: keep this in sync with the handler
+const v = process.env.BENCH_KEY_01170;
+const value42550 = compute(value, 64);
+const value32665 = compute(value, 73);
+const value65540 = compute(value, 65);
+// note 67851: keep this in sync with the handler
+// note 34213: keep this in sync with the handler
+const value61448 = compute(value, 47);
+const value92065 = compute(value, 12);
+const value42761 = compute(value, 81);
+const value41692 = compute(value, 79);
+const value6162 = compute(value, 51);
+const value44714 = compute(value, 94);
+const value24842 = compute(value, 10);
+const value5970 = compute(value, 53);
+const value24374 = compute(value, 27);
+// note 81465: keep this in sync with the handler
+const value87936 = compute(value, 54);
+// note 25344: keep this in sync with the handler
+const value51662 = compute(value, 58);
+const value68532 = compute(value, 50);
+const v = process.env["BENCH_KEY_00044"];
+const value62734 = compute(value, 72);
+const value10810 = compute(value, 43);
+const value42011 = compute(value, 10);
+const value27669 = compute(value, 24);
+const value52280 = compute(value, 94);
+const value25831 = compute(value, 29);
+const value49528 = compute(value, 58);
+// note 73944: keep this in sync with the handler
+const value70390 = compute(value, 65);
+// note 44606: keep this in sync with the handler
+const value29340 = compute(value, 46);
+const value81179 = compute(value, 87);
+const value43092 = compute(value, 24);
+const value89730 = compute(value, 5);
+const v = process.env.BENCH_KEY_01954;
+const value47050 = compute(value, 5);
+const value54788 = compute(value, 80);
+const value30426 = compute(value, 65);
+const value27282 = compute(value, 25);
+const value57528 = compute(value, 7);
+// note 19075: keep this in sync with the handler
+const value65150 = compute(value, 63);
+// note 31008: keep this in sync with the handler
+const value14613 = compute(value, 63);
+const value92413 = compute(value, 69);
+const value10462 = compute(value, 83);
+// note 44977: keep this in sync with the handler
+const value84656 = compute(value, 72);
+const value37736 = compute(value, 3);
+const value26007 = compute(value, 11);
+const value9365 = compute(value, 53);
+const value41762 = compute(value, 52);
+const v = process.env["BENCH_KEY_01575"];
+const value42521 = compute(value, 35);
+const value97751 = compute(value, 72);
+const value20496 = compute(value, 29);
+// note 29737: keep this in sync with the handler
+const value55723 = compute(value, 45);
+const value96870 = compute(value, 64);
+// note 11032: keep this in sync with the handler
+// note 91556: keep this in sync with the handler
+const value40413 = compute(value, 61);
+const value20700 = compute(value, 39);
+const v = process.env["BENCH_KEY_01856"];
+const value89552 = compute(value, 21);
+const value92286 = compute(value, 39);
+const value40057 = compute(value, 93);
+const value4137 = compute(value, 63);
+const value80460 = compute(value, 47);
+const value38244 = compute(value, 26);
+const value60810 = compute(value, 88);
+// note 52166: keep this in sync with the handler
+const value50565 = compute(value, 28);
+const value35086 = compute(value, 69);
+const value1433 = compute(value, 75);
+const value2122 = compute(value, 85);
+const value35046 = compute(value, 29);
+const value4628 = compute(value, 69);
+const v = import.meta.env.BENCH_KEY_00097;
+const value42988 = compute(value, 17);
+// note 75946: keep this in sync with the handler
+// note 41151: keep this in sync with the handler
+const value99221 = compute(value, 87);
+const value26731 = compute(value, 56);
+const value64239 = compute(value, 25);
+const value4900 = compute(value, 50);
+const value60050 = compute(value, 7);
+const value66116 = compute(value, 59);
+// note 16409: keep this in sync with the handler
+const value35058 = compute(value, 41);
+const value49121 = compute(value, 39);
+const value29322 = compute(value, 28);
+const value62735 = compute(value, 73);
+const v = process.env["BENCH_KEY_01893"];
+const value55521 = compute(value, 37);
+const value88758 = compute(value, 3);
+// note 17258: keep this in sync with the handler
+const value50334 = compute(value, 88);
+const value80012 = compute(value, 84);
+const value51217 = compute(value, 1);
+const value65429 = compute(value, 51);
+const value80639 = compute(value, 32);
+const v = process.env.BENCH_KEY_01438;
+const value84428 = compute(value, 38);
+const value98103 = compute(value, 36);
+const value7532 = compute(value, 63);
+const value17950 = compute(value, 5);
+const value41339 = compute(value, 17);
+const value86918 = compute(value, 6);
+const value48248 = compute(value, 39);
+const value83525 = compute(value, 8);
+const value95029 = compute(value, 66);
+const value5234 = compute(value, 93);
+const value71868 = compute(value, 88);
+const value13645 = compute(value, 65);
+const value30378 = compute(value, 17);
+const v = import.meta.env.BENCH_KEY_00232;
+const value12208 = compute(value, 83);
+const value60090 = compute(value, 47);
+const value50514 = compute(value, 74);
+const value7964 = compute(value, 10);
+const value3245 = compute(value, 44);
+// note 7804: keep this in sync with the handler
+const value4460 = compute(value, 95);
+const value5786 = compute(value, 63);
+// note 36110: keep this in sync with the handler
+const value58515 = compute(value, 24);
+const value83099 = compute(value, 67);
+const v = process.env.BENCH_KEY_00552;
+// note 57336: keep this in sync with the handler
+const value30938 = compute(value, 92);
+const value53698 = compute(value, 57);
+const value85287 = compute(value, 24);
+const value33606 = compute(value, 44);
+const value59257 = compute(value, 87);
+const value95630 = compute(value, 85);
+const value77399 = compute(value, 90);
+const v = process.env["BENCH_KEY_00179"];
+const value97093 = compute(value, 93);
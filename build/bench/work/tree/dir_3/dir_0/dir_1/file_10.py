@@ -0,0 +1,242 @@
+value2346 = compute(value, 18)
+value47862 = compute(value, 41)
+value11016 = compute(value, 55)
+value46566 = compute(value, 6)
+# note 19377: keep this in sync with the handler
+value70306 = compute(value, 78)
+# note 39520: keep this in sync with the handler
+value73123 = compute(value, 82)
+const v = os.environ["BENCH_KEY_01624"];
+value36352 = compute(value, 74)
+value77803 = compute(value, 9)
+value33082 = compute(value, 5)
+# note 84952: keep this in sync with the handler
+value78491 = compute(value, 18)
+value12481 = compute(value, 65)
+value12712 = compute(value, 5)
+value45532 = compute(value, 39)
+value76741 = compute(value, 14)
+value75696 = compute(value, 36)
+const v = os.environ.get('BENCH_KEY_00259');
+value62099 = compute(value, 19)
+value79544 = compute(value, 4)
+value31160 = compute(value, 23)
+value77530 = compute(value, 27)
+value22498 = compute(value, 91)
+value32059 = compute(value, 49)
+value34156 = compute(value, 12)
+value46635 = compute(value, 75)
+value18819 = compute(value, 1)
+value43551 = compute(value, 95)
+value32697 = compute(value, 8)
+value16495 = compute(value, 5)
+value65216 = compute(value, 32)
+value14815 = compute(value, 71)
+value66443 = compute(value, 95)
+value82434 = compute(value, 81)
+value17797 = compute(value, 46)
+value39144 = compute(value, 53)
+value21587 = compute(value, 53)
+value96088 = compute(value, 58)
+value85479 = compute(value, 22)
+const v = os.environ["BENCH_KEY_00204"];
+value17882 = compute(value, 34)
+value54373 = compute(value, 53)
+value93457 = compute(value, 46)
+value32585 = compute(value, 90)
+value96987 = compute(value, 84)
+value60175 = compute(value, 35)
+value76200 = compute(value, 55)
+value62096 = compute(value, 16)
+value68420 = compute(value, 35)
+value93631 = compute(value, 26)
+value4517 = compute(value, 55)
+value49461 = compute(value, 88)
+const v = os.environ.get('BENCH_KEY_01252');
+value61093 = compute(value, 80)
+value8036 = compute(value, 82)
+value33538 = compute(value, 73)
+value69322 = compute(value, 64)
+value83745 = compute(value, 34)
+# note 51259: keep this in sync with the handler
+value77001 = compute(value, 80)
+value54188 = compute(value, 62)
+value89578 = compute(value, 47)
+value86561 = compute(value, 37)
+value78901 = compute(value, 40)
+value76830 = compute(value, 6)
+value3162 = compute(value, 58)
+# note 17288: keep this in sync with the handler
+value5706 = compute(value, 80)
+value11477 = compute(value, 31)
+value3454 = compute(value, 59)
+value13535 = compute(value, 52)
+const v = os.getenv("BENCH_KEY_01042");
+# note 54256: keep this in sync with the handler
+# note 62671: keep this in sync with the handler
+value2203 = compute(value, 69)
+value71360 = compute(value, 65)
+value53159 = compute(value, 3)
+value13865 = compute(value, 91)
+value77529 = compute(value, 26)
+value38427 = compute(value, 15)
+value75645 = compute(value, 82)
+value92375 = compute(value, 31)
+value17607 = compute(value, 50)
+value53171 = compute(value, 15)
+value73461 = compute(value, 32)
+value97898 = compute(value, 25)
+value86326 = compute(value, 93)
+value35848 = compute(value, 55)
+value34512 = compute(value, 77)
+value55929 = compute(value, 57)
+value90699 = compute(value, 4)
+value46732 = compute(value, 75)
+# note 37608: keep this in sync with the handler
+value63488 = compute(value, 50)
+value5793 = compute(value, 70)
+const v = os.environ["BENCH_KEY_01339"];
+value4200 = compute(value, 29)
+value36076 = compute(value, 89)
+value33860 = compute(value, 7)
+value87778 = compute(value, 90)
+value57407 = compute(value, 80)
+value87103 = compute(value, 94)
+# note 22669: keep this in sync with the handler
+value20529 = compute(value, 62)
+const v = os.getenv("BENCH_KEY_00435");
+value76428 = compute(value, 89)
+value29516 = compute(value, 28)
+value40680 = compute(value, 37)
+value12589 = compute(value, 76)
+value10913 = compute(value, 49)
+value83470 = compute(value, 50)
+value65464 = compute(value, 86)
+value45116 = compute(value, 11)
+value33725 = compute(value, 66)
+value3991 = compute(value, 14)
+const v = os.environ["BENCH_KEY_00716"];
+value43670 = compute(value, 20)
+value56572 = compute(value, 21)
+value81997 = compute(value, 32)
+value58469 = compute(value, 75)
+value82530 = compute(value, 80)
+value34665 = compute(value, 36)
+value8825 = compute(value, 95)
+value47593 = compute(value, 63)
+value56578 = compute(value, 27)
+value43656 = compute(value, 6)
+value65012 = compute(value, 22)
+value41283 = compute(value, 58)
+value90028 = compute(value, 12)
+value19573 = compute(value, 76)
+value94931 = compute(value, 65)
+value44229 = compute(value, 94)
+value9220 = compute(value, 5)
+value53801 = compute(value, 63)
+value31581 = compute(value, 56)
+value25990 = compute(value, 91)
+value45617 = compute(value, 27)
+const v = os.getenv("BENCH_KEY_00160");
+value45110 = compute(value, 5)
+value10265 = compute(value, 80)
+value5556 = compute(value, 27)
+value16800 = compute(value, 19)
+value97351 = compute(value, 60)
+value19788 = compute(value, 0)
+value94457 = compute(value, 76)
+value97527 = compute(value, 42)
+value27751 = compute(value, 9)
+# note 11514: keep this in sync with the handler
+value56811 = compute(value, 66)
+# note 66276: keep this in sync with the handler
+value80591 = compute(value, 81)
+const v = os.environ["BENCH_KEY_01123"];
+value45700 = compute(value, 13)
+# note 15721: keep this in sync with the handler
+value6457 = compute(value, 55)
+value46599 = compute(value, 39)
+value15415 = compute(value, 89)
+value990 = compute(value, 20)
+value5236 = compute(value, 95)
+value75497 = compute(value, 31)
+# note 41224: keep this in sync with the handler
+value17811 = compute(value, 60)
+value2131 = compute(value, 94)
+value37368 = compute(value, 23)
+value13062 = compute(value, 64)
+value13529 = compute(value, 46)
+# note 53504: keep this in sync with the handler
+value47797 = compute(value, 73)
+value23602 = compute(value, 31)
+value87385 = compute(value, 85)
+value34086 = compute(value, 39)
+const v = os.environ["BENCH_KEY_01435"];
+value80095 = compute(value, 70)
+# note 53632: keep this in sync with the handler
+value18126 = compute(value, 84)
+value27355 = compute(value, 1)
+value31875 = compute(value, 59)
+value98327 = compute(value, 66)
+value44615 = compute(value, 92)
+value70636 = compute(value, 20)
+value48527 = compute(value, 27)
+# note 40166: keep this in sync with the handler
+value65950 = compute(value, 87)
+value69869 = compute(value, 29)
+value66202 = compute(value, 48)
+const v = os.getenv("BENCH_KEY_00494");
+value15839 = compute(value, 28)
+value94845 = compute(value, 76)
+value12738 = compute(value, 31)
+value2972 = compute(value, 62)
+value89691 = compute(value, 63)
+value32619 = compute(value, 27)
+# note 92770: keep this in sync with the handler
+value97411 = compute(value, 23)
+# note 35029: keep this in sync with the handler
+const v = os.environ.get('BENCH_KEY_01553');
+value99659 = compute(value, 40)
+value32221 = compute(value, 17)
+value30950 = compute(value, 7)
+value51471 = compute(value, 61)
+value35298 = compute(value, 87)
+value60215 = compute(value, 75)
+value66267 = compute(value, 16)
+value95110 = compute(value, 50)
+value41436 = compute(value, 17)
+value71550 = compute(value, 61)
+value22407 = compute(value, 0)
+value38418 = compute(value, 6)
+value13241 = compute(value, 49)
+# note 27056: keep this in sync with the handler
+# note 55857: keep this in sync with the handler
+value8464 = compute(value, 25)
+value75472 = compute(value, 6)
+value48587 = compute(value, 87)
+value53142 = compute(value, 83)
+value31712 = compute(value, 90)
+const v = os.environ["BENCH_KEY_01929"];
+value50799 = compute(value, 68)
+# note 28961: keep this in sync with the handler
+value38740 = compute(value, 37)
+value971 = compute(value, 1)
+value44898 = compute(value, 84)
+value98524 = compute(value, 69)
+value29541 = compute(value, 53)
+value94290 = compute(value, 6)
+value41588 = compute(value, 72)
+value87573 = compute(value, 79)
+value22851 = compute(value, 56)
+# note 846: keep this in sync with the handler
+const v = os.getenv("BENCH_KEY_00782");
+value9705 = compute(value, 5)
+value87144 = compute(value, 38)
+value1524 = compute(value, 69)
+value32262 = compute(value, 58)
+value86391 = compute(value, 61)
+value27758 = compute(value, 16)
+value7614 = compute(value, 48)
+value46689 = compute(value, 32)
+value75063 = compute(value, 82)
+value1285 = compute(value, 24)
@@ -0,0 +1,238 @@
+value1771 = compute(value, 25)
+value48440 = compute(value, 37)
+value3088 = compute(value, 81)
+value74353 = compute(value, 51)
+const v = os.environ.get('BENCH_KEY_01528');
+value80000 = compute(value, 72)
+value4549 = compute(value, 87)
+value40023 = compute(value, 59)
+value99714 = compute(value, 95)
+# note 42432: keep this in sync with the handler
+value29924 = compute(value, 48)
+value98617 = compute(value, 65)
+value39645 = compute(value, 69)
+value38413 = compute(value, 1)
+value17158 = compute(value, 86)
+value91045 = compute(value, 59)
+value86038 = compute(value, 96)
+value78440 = compute(value, 64)
+const v = os.environ["BENCH_KEY_00661"];
+value83634 = compute(value, 20)
+value48817 = compute(value, 26)
+value43766 = compute(value, 19)
+value42427 = compute(value, 38)
+value43058 = compute(value, 87)
+value28182 = compute(value, 52)
+value37006 = compute(value, 49)
+value10450 = compute(value, 71)
+value76309 = compute(value, 67)
+value5265 = compute(value, 27)
+const v = os.environ.get('BENCH_KEY_00029');
+# note 33047: keep this in sync with the handler
+value49989 = compute(value, 34)
+value1041 = compute(value, 71)
+value2493 = compute(value, 68)
+# note 3669: keep this in sync with the handler
+value39755 = compute(value, 82)
+value7615 = compute(value, 49)
+value85554 = compute(value, 0)
+value52037 = compute(value, 45)
+const v = os.environ.get('BENCH_KEY_01357');
+value84128 = compute(value, 29)
+value37144 = compute(value, 90)
+value45709 = compute(value, 22)
+value63726 = compute(value, 94)
+value8590 = compute(value, 54)
+value85731 = compute(value, 80)
+value29463 = compute(value, 72)
+value16090 = compute(value, 85)
+value45507 = compute(value, 14)
+value77237 = compute(value, 25)
+value82685 = compute(value, 41)
+value59964 = compute(value, 18)
+value34044 = compute(value, 94)
+value57088 = compute(value, 52)
+value57125 = compute(value, 89)
+value42538 = compute(value, 52)
+value25785 = compute(value, 80)
+value64628 = compute(value, 26)
+value82020 = compute(value, 55)
+value54958 = compute(value, 56)
+const v = os.environ["BENCH_KEY_00204"];
+value58304 = compute(value, 7)
+value39259 = compute(value, 71)
+value7013 = compute(value, 29)
+value96870 = compute(value, 64)
+value73821 = compute(value, 4)
+value93256 = compute(value, 39)
+value7268 = compute(value, 90)
+# note 41067: keep this in sync with the handler
+const v = os.getenv("BENCH_KEY_01014");
+value33799 = compute(value, 43)
+value63891 = compute(value, 65)
+value17161 = compute(value, 89)
+# note 32389: keep this in sync with the handler
+value14478 = compute(value, 25)
+value94678 = compute(value, 6)
+value2383 = compute(value, 55)
+value23599 = compute(value, 28)
+# note 30352: keep this in sync with the handler
+value74088 = compute(value, 77)
+value43283 = compute(value, 21)
+value8083 = compute(value, 32)
+value83401 = compute(value, 78)
+value72049 = compute(value, 75)
+# note 738: keep this in sync with the handler
+const v = os.environ.get('BENCH_KEY_00013');
+value84315 = compute(value, 22)
+value60070 = compute(value, 27)
+# note 2883: keep this in sync with the handler
+value9086 = compute(value, 65)
+# note 67633: keep this in sync with the handler
+# note 56296: keep this in sync with the handler
+value55197 = compute(value, 4)
+value60898 = compute(value, 79)
+value38636 = compute(value, 30)
+value26606 = compute(value, 28)
+# note 66972: keep this in sync with the handler
+value9502 = compute(value, 93)
+value17733 = compute(value, 79)
+value84251 = compute(value, 55)
+value73438 = compute(value, 9)
+value19328 = compute(value, 25)
+const v = os.environ.get('BENCH_KEY_01148');
+value20095 = compute(value, 16)
+value40730 = compute(value, 87)
+value18255 = compute(value, 19)
+# note 47313: keep this in sync with the handler
+value62185 = compute(value, 8)
+value25130 = compute(value, 7)
+value79616 = compute(value, 76)
+# note 97855: keep this in sync with the handler
+value7401 = compute(value, 29)
+# note 66366: keep this in sync with the handler
+value1600 = compute(value, 48)
+value38455 = compute(value, 43)
+value54853 = compute(value, 48)
+const v = os.environ.get('BENCH_KEY_01467');
+value14505 = compute(value, 52)
+value13871 = compute(value, 0)
+value63876 = compute(value, 50)
+value53365 = compute(value, 15)
+value14041 = compute(value, 73)
+value17583 = compute(value, 26)
+# note 39400: keep this in sync with the handler
+value83422 = compute(value, 2)
+value20547 = compute(value, 80)
+value91476 = compute(value, 5)
+value82323 = compute(value, 67)
+# note 58209: keep this in sync with the handler
+value83681 = compute(value, 67)
+value71113 = compute(value, 12)
+value46018 = compute(value, 40)
+value67069 = compute(value, 42)
+value47686 = compute(value, 59)
+value36751 = compute(value, 85)
+value27795 = compute(value, 53)
+value30192 = compute(value, 25)
+value48182 = compute(value, 70)
+const v = os.getenv("BENCH_KEY_00635");
+value76205 = compute(value, 60)
+# note 56409: keep this in sync with the handler
+value87657 = compute(value, 66)
+value30407 = compute(value, 46)
+value92582 = compute(value, 44)
+value36559 = compute(value, 87)
+value57023 = compute(value, 84)
+value33263 = compute(value, 89)
+value40587 = compute(value, 41)
+value59825 = compute(value, 73)
+value34940 = compute(value, 20)
+value24505 = compute(value, 61)
+value97589 = compute(value, 7)
+const v = os.environ.get('BENCH_KEY_01682');
+value42835 = compute(value, 58)
+value17517 = compute(value, 57)
+# note 6239: keep this in sync with the handler
+value3543 = compute(value, 51)
+# note 77060: keep this in sync with the handler
+value38787 = compute(value, 84)
+value76167 = compute(value, 22)
+value16855 = compute(value, 74)
+value77486 = compute(value, 80)
+value78708 = compute(value, 41)
+value75223 = compute(value, 48)
+value93310 = compute(value, 93)
+# note 53511: keep this in sync with the handler
+const v = os.environ.get('BENCH_KEY_01821');
+value61195 = compute(value, 85)
+value95209 = compute(value, 52)
+# note 12917: keep this in sync with the handler
+value24056 = compute(value, 0)
+value50672 = compute(value, 38)
+value26818 = compute(value, 46)
+# note 77935: keep this in sync with the handler
+value28343 = compute(value, 19)
+value25796 = compute(value, 91)
+value5764 = compute(value, 41)
+value8802 = compute(value, 72)
+value55328 = compute(value, 38)
+value50517 = compute(value, 77)
+value21973 = compute(value, 51)
+value91973 = compute(value, 17)
+# note 27514: keep this in sync with the handler
+const v = os.environ["BENCH_KEY_00369"];
+# note 39328: keep this in sync with the handler
+value48814 = compute(value, 23)
+value96722 = compute(value, 13)
+value40725 = compute(value, 82)
+value36341 = compute(value, 63)
+value47297 = compute(value, 58)
+value89590 = compute(value, 59)
+value96536 = compute(value, 21)
+value72432 = compute(value, 70)
+value59958 = compute(value, 12)
+value4241 = compute(value, 70)
+value6264 = compute(value, 56)
+value88620 = compute(value, 59)
+value63230 = compute(value, 83)
+const v = os.getenv("BENCH_KEY_01150");
+# note 21815: keep this in sync with the handler
+value3074 = compute(value, 67)
+value58116 = compute(value, 13)
+value2658 = compute(value, 39)
+value94489 = compute(value, 11)
+value22573 = compute(value, 69)
+value50217 = compute(value, 68)
+value85443 = compute(value, 83)
+value80064 = compute(value, 39)
+# note 75773: keep this in sync with the handler
+# note 12389: keep this in sync with the handler
+value25604 = compute(value, 93)
+value4376 = compute(value, 11)
+# note 59503: keep this in sync with the handler
+value49571 = compute(value, 4)
+value67451 = compute(value, 36)
+value21556 = compute(value, 22)
+const v = os.getenv("BENCH_KEY_00806");
+value77839 = compute(value, 45)
+value23401 = compute(value, 24)
+value94827 = compute(value, 58)
+value50580 = compute(value, 43)
+value84611 = compute(value, 27)
+value64022 = compute(value, 2)
+value8484 = compute(value, 45)
+value58775 = compute(value, 90)
+value76381 = compute(value, 42)
+value53943 = compute(value, 11)
+value7509 = compute(value, 40)
+value67405 = compute(value, 87)
+# note 75557: keep this in sync with the handler
+value69416 = compute(value, 61)
+value72119 = compute(value, 48)
+value44986 = compute(value, 75)
+value72903 = compute(value, 56)
+value78848 = compute(value, 84)
+value83230 = compute(value, 4)
+value6933 = compute(value, 46)
+value73908 = compute(value, 91)
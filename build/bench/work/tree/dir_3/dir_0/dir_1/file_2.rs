@@ -0,0 +1,212 @@
+let value98655 = compute(value, 6);
+// note 19897: keep this in sync with the handler
+let value37291 = compute(value, 43);
+let value77257 = compute(value, 45);
+// note 23818: keep this in sync with the handler
+let value58 = compute(value, 58);
+let value471 = compute(value, 83);
+let value33343 = compute(value, 72);
+let value85296 = compute(value, 33);
+const v = env::var_os("BENCH_KEY_01148");
+let value98781 = compute(value, 35);
+let value21955 = compute(value, 33);
+let value80170 = compute(value, 48);
+let value35186 = compute(value, 72);
+let value68625 = compute(value, 46);
+let value27563 = compute(value, 15);
+// note 68096: keep this in sync with the handler
+let value19695 = compute(value, 4);
+// note 51835: keep this in sync with the handler
+let value6618 = compute(value, 22);
+let value24717 = compute(value, 79);
+let value69273 = compute(value, 15);
+let value97954 = compute(value, 81);
+const v = env::var("BENCH_KEY_01543");
+let value26413 = compute(value, 29);
+let value95801 = compute(value, 62);
+let value96531 = compute(value, 16);
+let value19252 = compute(value, 46);
+let value58529 = compute(value, 38);
+let value42964 = compute(value, 90);
+let value6458 = compute(value, 56);
+// note 39303: keep this in sync with the handler
+const v = env::var_os("BENCH_KEY_01909");
+let value68087 = compute(value, 90);
+let value39698 = compute(value, 25);
+let value15956 = compute(value, 48);
+let value68857 = compute(value, 84);
+let value72912 = compute(value, 65);
+// note 14811: keep this in sync with the handler
+let value59410 = compute(value, 46);
+// note 66191: keep this in sync with the handler
+let value42672 = compute(value, 89);
+const v = env::var_os("BENCH_KEY_01918");
+let value40576 = compute(value, 30);
+// note 67111: keep this in sync with the handler
+let value25423 = compute(value, 9);
+// note 3206: keep this in sync with the handler
+let value8348 = compute(value, 6);
+// note 44944: keep this in sync with the handler
+let value81069 = compute(value, 74);
+let value19715 = compute(value, 24);
+let value27817 = compute(value, 75);
+let value99758 = compute(value, 42);
+let value83067 = compute(value, 35);
+let value88792 = compute(value, 37);
+let value38553 = compute(value, 44);
+let value92361 = compute(value, 17);
+let value24556 = compute(value, 15);
+// note 30302: keep this in sync with the handler
+let value28808 = compute(value, 96);
+const v = env::var("BENCH_KEY_01601");
+// note 96228: keep this in sync with the handler
+let value25820 = compute(value, 18);
+let value9108 = compute(value, 87);
+let value41837 = compute(value, 30);
+// note 44825: keep this in sync with the handler
+let value94216 = compute(value, 29);
+let value52301 = compute(value, 18);
+let value92954 = compute(value, 28);
+const v = env::var_os("BENCH_KEY_01002");
+let value21753 = compute(value, 25);
+let value56808 = compute(value, 63);
+let value20490 = compute(value, 23);
+let value76069 = compute(value, 21);
+let value79654 = compute(value, 17);
+let value37520 = compute(value, 78);
+let value89242 = compute(value, 2);
+let value60057 = compute(value, 14);
+let value47320 = compute(value, 81);
+let value29558 = compute(value, 70);
+let value11378 = compute(value, 29);
+let value79256 = compute(value, 7);
+let value63059 = compute(value, 9);
+const v = env::var("BENCH_KEY_00904");
+let value80249 = compute(value, 30);
+let value19358 = compute(value, 55);
+let value6425 = compute(value, 23);
+let value12970 = compute(value, 69);
+let value30888 = compute(value, 42);
+let value94922 = compute(value, 56);
+let value96711 = compute(value, 2);
+let value40988 = compute(value, 54);
+let value85538 = compute(value, 81);
+const v = env::var_os("BENCH_KEY_00055");
+let value44425 = compute(value, 96);
+let value21005 = compute(value, 53);
+let value18470 = compute(value, 40);
+let value97253 = compute(value, 59);
+let value71882 = compute(value, 5);
+let value91200 = compute(value, 20);
+let value70437 = compute(value, 15);
+let value55759 = compute(value, 81);
+let value85768 = compute(value, 20);
+let value26619 = compute(value, 41);
+let value3197 = compute(value, 93);
+// note 16099: keep this in sync with the handler
+const v = env::var_os("BENCH_KEY_01760");
+let value57947 = compute(value, 38);
+let value25270 = compute(value, 50);
+let value54847 = compute(value, 42);
+let value42635 = compute(value, 52);
+// note 49120: keep this in sync with the handler
+let value94577 = compute(value, 2);
+let value60380 = compute(value, 46);
+let value59907 = compute(value, 58);
+let value6781 = compute(value, 88);
+let value73132 = compute(value, 91);
+// note 87565: keep this in sync with the handler
+let value35206 = compute(value, 92);
+let value60987 = compute(value, 71);
+let value59637 = compute(value, 79);
+let value7380 = compute(value, 8);
+let value45204 = compute(value, 2);
+let value28680 = compute(value, 65);
+let value48635 = compute(value, 38);
+let value14424 = compute(value, 68);
+const v = env::var_os("BENCH_KEY_01290");
+let value7246 = compute(value, 68);
+let value18150 = compute(value, 11);
+// note 80844: keep this in sync with the handler
+let value44838 = compute(value, 24);
+let value92245 = compute(value, 95);
+let value1975 = compute(value, 35);
+let value95319 = compute(value, 65);
+let value50226 = compute(value, 77);
+let value22159 = compute(value, 43);
+let value39033 = compute(value, 39);
+let value25979 = compute(value, 80);
+let value61974 = compute(value, 88);
+// note 47016: keep this in sync with the handler
+let value79359 = compute(value, 13);
+let value40446 = compute(value, 94);
+let value36130 = compute(value, 46);
+const v = env::var("BENCH_KEY_00573");
+// note 14074: keep this in sync with the handler
+let value9013 = compute(value, 89);
+let value47500 = compute(value, 67);
+let value54505 = compute(value, 88);
+// note 25858: keep this in sync with the handler
+let value97307 = compute(value, 16);
+let value23840 = compute(value, 75);
+let value83061 = compute(value, 29);
+let value81942 = compute(value, 74);
+let value63256 = compute(value, 12);
+const v = env::var_os("BENCH_KEY_00926");
+let value3147 = compute(value, 43);
+let value21081 = compute(value, 32);
+// note 3784: keep this in sync with the handler
+let value55914 = compute(value, 42);
+let value10497 = compute(value, 21);
+let value30046 = compute(value, 73);
+let value96457 = compute(value, 39);
+let value64387 = compute(value, 76);
+// note 87770: keep this in sync with the handler
+let value84498 = compute(value, 11);
+let value76474 = compute(value, 38);
+// note 48583: keep this in sync with the handler
+let value81649 = compute(value, 72);
+// note 60046: keep this in sync with the handler
+let value81358 = compute(value, 72);
+let value85764 = compute(value, 16);
+const v = env::var("BENCH_KEY_00137");
+let value36174 = compute(value, 90);
+let value70960 = compute(value, 53);
+let value53795 = compute(value, 57);
+let value88687 = compute(value, 29);
+let value46523 = compute(value, 60);
+let value72904 = compute(value, 57);
+let value63194 = compute(value, 47);
+let value86287 = compute(value, 54);
+// note 10327: keep this in sync with the handler
+let value79103 = compute(value, 48);
+let value30402 = compute(value, 41);
+let value97229 = compute(value, 35);
+let value2397 = compute(value, 69);
+let value66472 = compute(value, 27);
+let value51745 = compute(value, 44);
+let value33408 = compute(value, 40);
+let value21196 = compute(value, 50);
+const v = env::var("BENCH_KEY_01075");
+let value67069 = compute(value, 42);
+let value87735 = compute(value, 47);
+let value98002 = compute(value, 32);
+let value17345 = compute(value, 79);
+let value46821 = compute(value, 67);
+let value48434 = compute(value, 31);
+let value84435 = compute(value, 45);
+let value11280 = compute(value, 28);
+const v = env::var_os("BENCH_KEY_01036");
+// note 56118: keep this in sync with the handler
+let value81517 = compute(value, 37);
+let value79237 = compute(value, 85);
+let value57237 = compute(value, 7);
+let value68318 = compute(value, 30);
+let value32526 = compute(value, 31);
+let value66782 = compute(value, 46);
+let value696 = compute(value, 17);
+// note 23801: keep this in sync with the handler
+let value26321 = compute(value, 34);
+const v = env::var("BENCH_KEY_01556");
+let value88590 = compute(value, 29);
+let value88353 = compute(value, 83);
@@ -0,0 +1,204 @@
+const value70451 = compute(value, 29);
+const value96226 = compute(value, 2);
+const value67956 = compute(value, 56);
+const value72122 = compute(value, 51);
+const value86527 = compute(value, 3);
+const value64599 = compute(value, 94);
+const value62233 = compute(value, 56);
+const v = process.env.BENCH_KEY_01909;
+const value38589 = compute(value, 80);
+const value94164 = compute(value, 74);
+const value68841 = compute(value, 68);
+const value94216 = compute(value, 29);
+const value96239 = compute(value, 15);
+// note 69640: keep this in sync with the handler
+// note 6163: keep this in sync with the handler
+const value58979 = compute(value, 3);
+const value80245 = compute(value, 26);
+const value6876 = compute(value, 86);
+const v = process.env["BENCH_KEY_00336"];
+const value57996 = compute(value, 87);
+const value2668 = compute(value, 49);
+const value86575 = compute(value, 51);
+const value49359 = compute(value, 83);
+const value21074 = compute(value, 25);
+// note 8912: keep this in sync with the handler
+const value24894 = compute(value, 62);
+// note 49434: keep this in sync with the handler
+const value96639 = compute(value, 27);
+// note 31729: keep this in sync with the handler
+const value45728 = compute(value, 41);
+const value83964 = compute(value, 59);
+const value97772 = compute(value, 93);
+const value68524 = compute(value, 42);
+const v = process.env["BENCH_KEY_00058"];
+const value88731 = compute(value, 73);
+const value45757 = compute(value, 70);
+const value581 = compute(value, 96);
+const value93132 = compute(value, 12);
+const value34209 = compute(value, 65);
+const value41162 = compute(value, 34);
+const value54892 = compute(value, 87);
+const value53056 = compute(value, 94);
+const value9351 = compute(value, 39);
+const value98898 = compute(value, 55);
+const value85677 = compute(value, 26);
+const value76163 = compute(value, 18);
+const value1144 = compute(value, 77);
+const v = process.env.BENCH_KEY_00513;
+const value5848 = compute(value, 28);
+// note 80133: keep this in sync with the handler
+const value40930 = compute(value, 93);
+const value5756 = compute(value, 33);
+const value97890 = compute(value, 17);
+const value9893 = compute(value, 96);
+const value61902 = compute(value, 16);
+// note 97745: keep this in sync with the handler
+const v = process.env["BENCH_KEY_01422"];
+// note 48301: keep this in sync with the handler
+const value69266 = compute(value, 8);
+const value7306 = compute(value, 31);
+const value68550 = compute(value, 68);
+const value76979 = compute(value, 58);
+const value6846 = compute(value, 56);
+const value86390 = compute(value, 60);
+const value12485 = compute(value, 69);
+const value20299 = compute(value, 26);
+const value40663 = compute(value, 20);
+const value1281 = compute(value, 20);
+const v = import.meta.env.BENCH_KEY_01642;
+const value61361 = compute(value, 57);
+const value42187 = compute(value, 89);
+const value57478 = compute(value, 54);
+const value80314 = compute(value, 95);
+const value4366 = compute(value, 1);
+const value82051 = compute(value, 86);
+const value46198 = compute(value, 26);
+const value39095 = compute(value, 4);
+const value65867 = compute(value, 4);
+const value46099 = compute(value, 24);
+// note 99223: keep this in sync with the handler
+const value48738 = compute(value, 44);
+// note 32468: keep this in sync with the handler
+const value25144 = compute(value, 21);
+const value28601 = compute(value, 83);
+const value10711 = compute(value, 41);
+const value49610 = compute(value, 43);
+const value94358 = compute(value, 74);
+const v = import.meta.env.BENCH_KEY_00707;
+const value1261 = compute(value, 0);
+const value39977 = compute(value, 13);
+const value38945 = compute(value, 48);
+const value48105 = compute(value, 90);
+const value66601 = compute(value, 59);
+const value53057 = compute(value, 95);
+const value24234 = compute(value, 81);
+const value9499 = compute(value, 90);
+const value13227 = compute(value, 35);
+const value66215 = compute(value, 61);
+const value82819 = compute(value, 78);
+const value32167 = compute(value, 60);
+const value29392 = compute(value, 1);
+// note 38519: keep this in sync with the handler
+const value9096 = compute(value, 75);
+const value60296 = compute(value, 59);
+const value93303 = compute(value, 86);
+const value25899 = compute(value, 0);
+const value41015 = compute(value, 81);
+const v = process.env["BENCH_KEY_00682"];
+const value10370 = compute(value, 88);
+const value38244 = compute(value, 26);
+const value78859 = compute(value, 95);
+const value68478 = compute(value, 93);
+const value84850 = compute(value, 72);
+const value84346 = compute(value, 53);
+const value32167 = compute(value, 60);
+const value32609 = compute(value, 17);
+// note 72940: keep this in sync with the handler
+const value34285 = compute(value, 44);
+const value24712 = compute(value, 74);
+const value18928 = compute(value, 13);
+const value76261 = compute(value, 19);
+const value84905 = compute(value, 30);
+const value19456 = compute(value, 56);
+const v = process.env.BENCH_KEY_00058;
+// note 76512: keep this in sync with the handler
+const value66023 = compute(value, 63);
+const value38661 = compute(value, 55);
+const value51851 = compute(value, 53);
+// note 526: keep this in sync with the handler
+const value38603 = compute(value, 94);
+const value79584 = compute(value, 44);
+const value58039 = compute(value, 33);
+const value27010 = compute(value, 44);
+// note 31504: keep this in sync with the handler
+const value20269 = compute(value, 93);
+const value77447 = compute(value, 41);
+const value53300 = compute(value, 47);
+const v = process.env["BENCH_KEY_01263"];
+const value54048 = compute(value, 19);
+const value64832 = compute(value, 36);
+const value64201 = compute(value, 84);
+const value16308 = compute(value, 12);
+// note 54804: keep this in sync with the handler
+// note 98653: keep this in sync with the handler
+const value18960 = compute(value, 45);
+const value30776 = compute(value, 27);
+const value48556 = compute(value, 56);
+// note 20529: keep this in sync with the handler
+const value27087 = compute(value, 24);
+// note 88210: keep this in sync with the handler
+const v = import.meta.env.BENCH_KEY_00658;
+const value79846 = compute(value, 15);
+const value63348 = compute(value, 7);
+const value85126 = compute(value, 57);
+const value22821 = compute(value, 26);
+const value24621 = compute(value, 80);
+// note 98327: keep this in sync with the handler
+const value19490 = compute(value, 90);
+const value69178 = compute(value, 17);
+const value88945 = compute(value, 93);
+const value53596 = compute(value, 52);
+const value58509 = compute(value, 18);
+const value9479 = compute(value, 70);
+const value69817 = compute(value, 74);
+const value52680 = compute(value, 9);
+const v = process.env.BENCH_KEY_00815;
+const value26578 = compute(value, 0);
+const value60269 = compute(value, 32);
+const value4601 = compute(value, 42);
+const value96490 = compute(value, 72);
+const value30236 = compute(value, 69);
+const value4555 = compute(value, 93);
+const value94693 = compute(value, 21);
+// note 7609: keep this in sync with the handler
+const value10971 = compute(value, 10);
+const value82610 = compute(value, 63);
+const value54152 = compute(value, 26);
+const value75742 = compute(value, 82);
+const value1778 = compute(value, 32);
+const value15649 = compute(value, 32);
+const value89099 = compute(value, 53);
+// note 89315: keep this in sync with the handler
+const value14414 = compute(value, 58);
+const v = process.env.BENCH_KEY_00714;
+const value94368 = compute(value, 84);
+const value45035 = compute(value, 27);
+const value22677 = compute(value, 76);
+const value94153 = compute(value, 63);
+const value43528 = compute(value, 72);
+const value30194 = compute(value, 27);
+const value55379 = compute(value, 89);
+const value90638 = compute(value, 40);
+const value48060 = compute(value, 45);
+const value94969 = compute(value, 6);
+const value48233 = compute(value, 24);
+// note 25603: keep this in sync with the handler
+const value87618 = compute(value, 27);
+const value75986 = compute(value, 35);
+const value86885 = compute(value, 70);
+// note 77060: keep this in sync with the handler
+const v = import.meta.env.BENCH_KEY_01750;
+const value66991 = compute(value, 61);
+const value16289 = compute(value, 90);
+const value87965 = compute(value, 83);
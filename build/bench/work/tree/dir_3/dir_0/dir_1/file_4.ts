@@ -0,0 +1,205 @@
+const value68627 = compute(value, 48);
+const value38154 = compute(value, 33);
+const value56425 = compute(value, 68);
+const value69277 = compute(value, 19);
+const value84229 = compute(value, 33);
+const value90469 = compute(value, 65);
+const value85405 = compute(value, 45);
+const value9403 = compute(value, 91);
+const v = process.env.BENCH_KEY_00151;
+const value53303 = compute(value, 50);
+const value16013 = compute(value, 8);
+const value98993 = compute(value, 53);
+const value10250 = compute(value, 65);
+const value12254 = compute(value, 32);
+const value86479 = compute(value, 52);
+const value73662 = compute(value, 39);
+const value38282 = compute(value, 64);
+const value56845 = compute(value, 3);
+const value83838 = compute(value, 30);
+const value63893 = compute(value, 67);
+const value15009 = compute(value, 71);
+// note 42641: keep this in sync with the handler
+const value97190 = compute(value, 93);
+const v = import.meta.env.BENCH_KEY_01591;
+const value76634 = compute(value, 4);
+const value6726 = compute(value, 33);
+const value74993 = compute(value, 12);
+// note 41486: keep this in sync with the handler
+const value444 = compute(value, 56);
+const value80004 = compute(value, 76);
+const value2531 = compute(value, 9);
+const value31582 = compute(value, 57);
+const value9121 = compute(value, 3);
+const value57699 = compute(value, 81);
+const value63388 = compute(value, 47);
+const value38779 = compute(value, 76);
+// note 88032: keep this in sync with the handler
+const value96470 = compute(value, 52);
+const v = process.env["BENCH_KEY_01100"];
+const value10826 = compute(value, 59);
+const value78098 = compute(value, 13);
+const value74628 = compute(value, 35);
+const value43750 = compute(value, 3);
+// note 67705: keep this in sync with the handler
+const value97030 = compute(value, 30);
+const value42131 = compute(value, 33);
+const value79910 = compute(value, 79);
+const value41344 = compute(value, 22);
+const value15321 = compute(value, 92);
+// note 69561: keep this in sync with the handler
+const value37651 = compute(value, 15);
+const value95721 = compute(value, 79);
+const v = process.env.BENCH_KEY_00983;
+const value62633 = compute(value, 68);
+const value54489 = compute(value, 72);
+const value40906 = compute(value, 69);
+const value33411 = compute(value, 43);
+const value55000 = compute(value, 1);
+const value91015 = compute(value, 29);
+const value78191 = compute(value, 9);
+const value76948 = compute(value, 27);
+// note 11707: keep this in sync with the handler
+const value49114 = compute(value, 32);
+const value6628 = compute(value, 32);
+const value75527 = compute(value, 61);
+const value26086 = compute(value, 90);
+const value5541 = compute(value, 12);
+const value97220 = compute(value, 26);
+const value79438 = compute(value, 92);
+const value5977 = compute(value, 60);
+const v = process.env.BENCH_KEY_00782;
+const value83355 = compute(value, 32);
+const value33632 = compute(value, 70);
+const value97646 = compute(value, 64);
+const value41669 = compute(value, 56);
+const value3263 = compute(value, 62);
+const value32911 = compute(value, 28);
+const value82578 = compute(value, 31);
+const value74277 = compute(value, 72);
+// note 73284: keep this in sync with the handler
+const value29478 = compute(value, 87);
+const value69173 = compute(value, 12);
+const value36926 = compute(value, 66);
+const value26593 = compute(value, 15);
+const value4548 = compute(value, 86);
+const value21048 = compute(value, 96);
+const value20757 = compute(value, 96);
+const value37735 = compute(value, 2);
+const value29479 = compute(value, 88);
+const v = process.env["BENCH_KEY_01321"];
+const value9547 = compute(value, 41);
+const value36107 = compute(value, 23);
+const value82607 = compute(value, 60);
+const value99881 = compute(value, 68);
+const value1805 = compute(value, 59);
+const value4578 = compute(value, 19);
+const value99254 = compute(value, 23);
+const value40585 = compute(value, 39);
+// note 33282: keep this in sync with the handler
+const value14236 = compute(value, 74);
+const value95267 = compute(value, 13);
+// note 91732: keep this in sync with the handler
+const value34563 = compute(value, 31);
+const value27141 = compute(value, 78);
+const value20819 = compute(value, 61);
+const value83521 = compute(value, 4);
+const value89525 = compute(value, 91);
+const value57012 = compute(value, 73);
+const value60992 = compute(value, 76);
+const value60303 = compute(value, 66);
+const v = process.env.BENCH_KEY_00907;
+// note 87699: keep this in sync with the handler
+const value86374 = compute(value, 44);
+const value57748 = compute(value, 33);
+const value67676 = compute(value, 67);
+const value71033 = compute(value, 29);
+const value71804 = compute(value, 24);
+const value22779 = compute(value, 81);
+const value67749 = compute(value, 43);
+// note 90354: keep this in sync with the handler
+const value99978 = compute(value, 68);
+const value8011 = compute(value, 57);
+const v = process.env.BENCH_KEY_00812;
+// note 14401: keep this in sync with the handler
+const value85110 = compute(value, 41);
+const value9632 = compute(value, 29);
+const value1211 = compute(value, 47);
+const value14670 = compute(value, 23);
+const value50408 = compute(value, 65);
+const value49404 = compute(value, 31);
+const value51102 = compute(value, 80);
+const value77196 = compute(value, 81);
+const v = process.env["BENCH_KEY_01983"];
+const value95186 = compute(value, 29);
+const value85582 = compute(value, 28);
+// note 90555: keep this in sync with the handler
+const value72685 = compute(value, 32);
+const value99469 = compute(value, 44);
+const value50634 = compute(value, 0);
+const value32529 = compute(value, 34);
+const value93673 = compute(value, 68);
+const value10831 = compute(value, 64);
+const value22880 = compute(value, 85);
+const value4124 = compute(value, 50);
+const value66070 = compute(value, 13);
+const v = process.env["BENCH_KEY_00334"];
+const value37762 = compute(value, 29);
+const value16496 = compute(value, 6);
+const value68510 = compute(value, 28);
+const value42605 = compute(value, 22);
+const value69334 = compute(value, 76);
+const value13570 = compute(value, 87);
+const value35430 = compute(value, 25);
+const value68967 = compute(value, 0);
+const value59194 = compute(value, 24);
+const v = process.env.BENCH_KEY_00105;
+// note 88237: keep this in sync with the handler
+const value88491 = compute(value, 27);
+const value39121 = compute(value, 30);
+const value28474 = compute(value, 53);
+const value56354 = compute(value, 94);
+const value45689 = compute(value, 2);
+// note 72934: keep this in sync with the handler
+const value1862 = compute(value, 19);
+const value21264 = compute(value, 21);
+const value57690 = compute(value, 72);
+// note 59239: keep this in sync with the handler
+const v = process.env["BENCH_KEY_01599"];
+const value72810 = compute(value, 60);
+const value82537 = compute(value, 87);
+const value28328 = compute(value, 4);
+// note 96710: keep this in sync with the handler
+const value90639 = compute(value, 41);
+const value61487 = compute(value, 86);
+const value31845 = compute(value, 29);
+const value51656 = compute(value, 52);
+const value37300 = compute(value, 52);
+const value11559 = compute(value, 16);
+const v = import.meta.env.BENCH_KEY_01309;
+const value27442 = compute(value, 88);
+const value84709 = compute(value, 28);
+const value72242 = compute(value, 74);
+const value44725 = compute(value, 8);
+const value7094 = compute(value, 13);
+const value69232 = compute(value, 71);
+const value25058 = compute(value, 32);
+const value12128 = compute(value, 3);
+const value41564 = compute(value, 48);
+const v = import.meta.env.BENCH_KEY_01771;
+const value12775 = compute(value, 68);
+const value47773 = compute(value, 49);
+const value45419 = compute(value, 23);
+const value95565 = compute(value, 20);
+const value37289 = compute(value, 41);
+const value13437 = compute(value, 51);
+const value70358 = compute(value, 33);
+const value40701 = compute(value, 58);
+// note 42862: keep this in sync with the handler
+const value25805 = compute(value, 3);
+// note 22004: keep this in sync with the handler
+// note 58697: keep this in sync with the handler
+const value30256 = compute(value, 89);
+const value55358 = compute(value, 68);
+const value9462 = compute(value, 53);
+const value15937 = compute(value, 29);
@@ -0,0 +1,229 @@
+// note 84277: keep this in sync with the handler
+value17683 := compute(value, 29)
+value33911 := compute(value, 58)
+// note 48060: keep this in sync with the handler
+const v = os.Getenv("BENCH_KEY_01667");
+// note 42062: keep this in sync with the handler
+value11978 := compute(value, 47)
+// note 48599: keep this in sync with the handler
+value96121 := compute(value, 91)
+value81472 := compute(value, 89)
+value42453 := compute(value, 64)
+value69259 := compute(value, 1)
+value54363 := compute(value, 43)
+value88212 := compute(value, 39)
+value65091 := compute(value, 4)
+value30154 := compute(value, 84)
+value30204 := compute(value, 37)
+value49421 := compute(value, 48)
+// note 56907: keep this in sync with the handler
+value39104 := compute(value, 13)
+const v = os.Getenv("BENCH_KEY_01272");
+// note 65196: keep this in sync with the handler
+value33310 := compute(value, 39)
+value40622 := compute(value, 76)
+// note 44679: keep this in sync with the handler
+value60088 := compute(value, 45)
+value22825 := compute(value, 30)
+// note 11681: keep this in sync with the handler
+value92696 := compute(value, 61)
+value44852 := compute(value, 38)
+value69652 := compute(value, 6)
+value43404 := compute(value, 45)
+value36139 := compute(value, 55)
+value75166 := compute(value, 88)
+value82736 := compute(value, 92)
+const v = os.Getenv("BENCH_KEY_00635");
+value33021 := compute(value, 41)
+value18756 := compute(value, 35)
+value35133 := compute(value, 19)
+value38688 := compute(value, 82)
+value1189 := compute(value, 25)
+value60016 := compute(value, 70)
+// note 7955: keep this in sync with the handler
+value14421 := compute(value, 65)
+value18077 := compute(value, 35)
+value54091 := compute(value, 62)
+value1018 := compute(value, 48)
+value15401 := compute(value, 75)
+value74011 := compute(value, 0)
+value41693 := compute(value, 80)
+value9406 := compute(value, 94)
+value88791 := compute(value, 36)
+value98516 := compute(value, 61)
+value3482 := compute(value, 87)
+value65498 := compute(value, 23)
+value24987 := compute(value, 58)
+const v = os.LookupEnv("BENCH_KEY_01760");
+// note 60191: keep this in sync with the handler
+value57887 := compute(value, 75)
+value89664 := compute(value, 36)
+value35023 := compute(value, 6)
+value10262 := compute(value, 77)
+// note 41852: keep this in sync with the handler
+// note 54197: keep this in sync with the handler
+value52663 := compute(value, 89)
+// note 75533: keep this in sync with the handler
+value43676 := compute(value, 26)
+const v = os.LookupEnv("BENCH_KEY_00566");
+value59571 := compute(value, 13)
+value44233 := compute(value, 1)
+value16502 := compute(value, 12)
+value82777 := compute(value, 36)
+value78196 := compute(value, 14)
+value52990 := compute(value, 28)
+value87214 := compute(value, 11)
+value69096 := compute(value, 32)
+const v = os.LookupEnv("BENCH_KEY_01980");
+value48195 := compute(value, 83)
+value86462 := compute(value, 35)
+value32506 := compute(value, 11)
+// note 74659: keep this in sync with the handler
+value9074 := compute(value, 53)
+value25384 := compute(value, 67)
+value40907 := compute(value, 70)
+value99365 := compute(value, 37)
+value54701 := compute(value, 90)
+// note 7622: keep this in sync with the handler
+value38592 := compute(value, 83)
+value42316 := compute(value, 24)
+value47699 := compute(value, 72)
+value42033 := compute(value, 32)
+value42056 := compute(value, 55)
+value18040 := compute(value, 95)
+// note 24733: keep this in sync with the handler
+value45813 := compute(value, 29)
+const v = os.LookupEnv("BENCH_KEY_00330");
+value67777 := compute(value, 71)
+value30023 := compute(value, 50)
+value26012 := compute(value, 16)
+value41213 := compute(value, 85)
+value79288 := compute(value, 39)
+value53943 := compute(value, 11)
+// note 59608: keep this in sync with the handler
+// note 15484: keep this in sync with the handler
+// note 42033: keep this in sync with the handler
+// note 46777: keep this in sync with the handler
+value71628 := compute(value, 42)
+const v = os.Getenv("BENCH_KEY_00821");
+value6973 := compute(value, 86)
+value83821 := compute(value, 13)
+value54086 := compute(value, 57)
+value74749 := compute(value, 59)
+value38942 := compute(value, 45)
+value80112 := compute(value, 87)
+value53423 := compute(value, 73)
+value12799 := compute(value, 92)
+value17703 := compute(value, 49)
+value21641 := compute(value, 10)
+const v = os.LookupEnv("BENCH_KEY_01249");
+value39239 := compute(value, 51)
+value74653 := compute(value, 60)
+value13155 := compute(value, 60)
+value10354 := compute(value, 72)
+value66414 := compute(value, 66)
+value75059 := compute(value, 78)
+value22080 := compute(value, 61)
+value54063 := compute(value, 34)
+value84298 := compute(value, 5)
+value60561 := compute(value, 33)
+value96290 := compute(value, 66)
+// note 90132: keep this in sync with the handler
+value23092 := compute(value, 6)
+value14839 := compute(value, 95)
+value98215 := compute(value, 51)
+value53801 := compute(value, 63)
+value63984 := compute(value, 61)
+value56182 := compute(value, 19)
+value30015 := compute(value, 42)
+// note 41734: keep this in sync with the handler
+value53784 := compute(value, 46)
+const v = os.Getenv("BENCH_KEY_01488");
+value62229 := compute(value, 52)
+value67292 := compute(value, 71)
+// note 15366: keep this in sync with the handler
+value73833 := compute(value, 16)
+value41803 := compute(value, 93)
+value7058 := compute(value, 74)
+value36048 := compute(value, 61)
+value13939 := compute(value, 68)
+value7104 := compute(value, 23)
+value64050 := compute(value, 30)
+value64175 := compute(value, 58)
+value16124 := compute(value, 22)
+value1509 := compute(value, 54)
+value23359 := compute(value, 79)
+value53955 := compute(value, 23)
+value20161 := compute(value, 82)
+const v = os.LookupEnv("BENCH_KEY_01624");
+value68001 := compute(value, 4)
+value4222 := compute(value, 51)
+value31270 := compute(value, 36)
+value53178 := compute(value, 22)
+// note 83236: keep this in sync with the handler
+value4996 := compute(value, 49)
+value44893 := compute(value, 79)
+value23573 := compute(value, 2)
+value13128 := compute(value, 33)
+value37147 := compute(value, 93)
+value99093 := compute(value, 56)
+value13719 := compute(value, 42)
+value61079 := compute(value, 66)
+value6114 := compute(value, 3)
+value64157 := compute(value, 40)
+value88479 := compute(value, 15)
+// note 76429: keep this in sync with the handler
+value46686 := compute(value, 29)
+const v = os.LookupEnv("BENCH_KEY_01235");
+value8743 := compute(value, 13)
+value70173 := compute(value, 42)
+value4473 := compute(value, 11)
+value43917 := compute(value, 73)
+value13896 := compute(value, 25)
+value11066 := compute(value, 8)
+// note 31155: keep this in sync with the handler
+value28962 := compute(value, 56)
+// note 75081: keep this in sync with the handler
+// note 3238: keep this in sync with the handler
+value61489 := compute(value, 88)
+// note 38437: keep this in sync with the handler
+// note 30509: keep this in sync with the handler
+value45076 := compute(value, 68)
+const v = os.Getenv("BENCH_KEY_01929");
+value37781 := compute(value, 48)
+value49753 := compute(value, 89)
+value18778 := compute(value, 57)
+value54509 := compute(value, 92)
+value3003 := compute(value, 93)
+value6691 := compute(value, 95)
+value77400 := compute(value, 91)
+value87503 := compute(value, 9)
+value91068 := compute(value, 82)
+value18649 := compute(value, 25)
+value22394 := compute(value, 84)
+// note 40145: keep this in sync with the handler
+value62319 := compute(value, 45)
+value16558 := compute(value, 68)
+value28978 := compute(value, 72)
+value57427 := compute(value, 3)
+value47658 := compute(value, 31)
+const v = os.Getenv("BENCH_KEY_00336");
+value67043 := compute(value, 16)
+value12052 := compute(value, 24)
+value40320 := compute(value, 65)
+value57271 := compute(value, 41)
+value8995 := compute(value, 71)
+value99283 := compute(value, 52)
+// note 7433: keep this in sync with the handler
+value15105 := compute(value, 70)
+value51629 := compute(value, 25)
+value59704 := compute(value, 49)
+value55653 := compute(value, 72)
+value75902 := compute(value, 48)
+value68972 := compute(value, 5)
+// note 34071: keep this in sync with the handler
+value89610 := compute(value, 79)
+value52922 := compute(value, 57)
+value5689 := compute(value, 63)
+value90111 := compute(value, 95)
+value11672 := compute(value, 32)
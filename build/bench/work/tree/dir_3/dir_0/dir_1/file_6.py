@@ -0,0 +1,238 @@
+value56093 = compute(value, 27)
+value55281 = compute(value, 88)
+value57108 = compute(value, 72)
+value50830 = compute(value, 2)
+# note 99894: keep this in sync with the handler
+value98240 = compute(value, 76)
+value75488 = compute(value, 22)
+const v = os.getenv("BENCH_KEY_01984");
+value86282 = compute(value, 49)
+value44362 = compute(value, 33)
+value50040 = compute(value, 85)
+value25183 = compute(value, 60)
+value28600 = compute(value, 82)
+value52592 = compute(value, 18)
+value57220 = compute(value, 87)
+# note 89281: keep this in sync with the handler
+value43037 = compute(value, 66)
+# note 15638: keep this in sync with the handler
+value31306 = compute(value, 72)
+const v = os.environ.get('BENCH_KEY_00470');
+value98540 = compute(value, 85)
+value88159 = compute(value, 83)
+# note 96191: keep this in sync with the handler
+value98534 = compute(value, 79)
+value91000 = compute(value, 14)
+value20504 = compute(value, 37)
+value50775 = compute(value, 44)
+value73046 = compute(value, 5)
+# note 87884: keep this in sync with the handler
+value42143 = compute(value, 45)
+# note 35502: keep this in sync with the handler
+value55894 = compute(value, 22)
+value9819 = compute(value, 22)
+value90042 = compute(value, 26)
+value27972 = compute(value, 36)
+value62718 = compute(value, 56)
+value20959 = compute(value, 7)
+value18469 = compute(value, 39)
+# note 14486: keep this in sync with the handler
+value7950 = compute(value, 93)
+value62295 = compute(value, 21)
+const v = os.environ.get('BENCH_KEY_01295');
+value7896 = compute(value, 39)
+value90086 = compute(value, 70)
+value94151 = compute(value, 61)
+value67202 = compute(value, 78)
+value74896 = compute(value, 12)
+value83325 = compute(value, 2)
+value85317 = compute(value, 54)
+value36235 = compute(value, 54)
+# note 77442: keep this in sync with the handler
+value46682 = compute(value, 25)
+value82185 = compute(value, 26)
+value84402 = compute(value, 12)
+value4328 = compute(value, 60)
+value87124 = compute(value, 18)
+value15688 = compute(value, 71)
+# note 87814: keep this in sync with the handler
+value23014 = compute(value, 25)
+value67374 = compute(value, 56)
+value68392 = compute(value, 7)
+value82247 = compute(value, 88)
+const v = os.getenv("BENCH_KEY_00570");
+value66499 = compute(value, 54)
+value9213 = compute(value, 95)
+value76749 = compute(value, 22)
+# note 22330: keep this in sync with the handler
+value57408 = compute(value, 81)
+value88529 = compute(value, 65)
+value46035 = compute(value, 57)
+value55744 = compute(value, 66)
+value19074 = compute(value, 62)
+value30195 = compute(value, 28)
+value62152 = compute(value, 72)
+value15048 = compute(value, 13)
+value66476 = compute(value, 31)
+value27756 = compute(value, 14)
+const v = os.environ.get('BENCH_KEY_00301');
+value93504 = compute(value, 93)
+value14646 = compute(value, 96)
+# note 43028: keep this in sync with the handler
+value22007 = compute(value, 85)
+value99017 = compute(value, 77)
+value45894 = compute(value, 13)
+# note 58178: keep this in sync with the handler
+value17264 = compute(value, 95)
+value72161 = compute(value, 90)
+value79567 = compute(value, 27)
+value70198 = compute(value, 67)
+# note 31216: keep this in sync with the handler
+const v = os.getenv("BENCH_KEY_00132");
+value72818 = compute(value, 68)
+value45095 = compute(value, 87)
+value86577 = compute(value, 53)
+# note 93463: keep this in sync with the handler
+# note 73252: keep this in sync with the handler
+value22281 = compute(value, 68)
+value7118 = compute(value, 37)
+value42215 = compute(value, 20)
+value57863 = compute(value, 51)
+# note 82231: keep this in sync with the handler
+value58034 = compute(value, 28)
+value46017 = compute(value, 39)
+value40815 = compute(value, 75)
+# note 52128: keep this in sync with the handler
+value72028 = compute(value, 54)
+value40370 = compute(value, 18)
+value32324 = compute(value, 23)
+value30046 = compute(value, 73)
+const v = os.getenv("BENCH_KEY_00301");
+value73035 = compute(value, 91)
+value96042 = compute(value, 12)
+value48568 = compute(value, 68)
+value91007 = compute(value, 21)
+value99677 = compute(value, 58)
+value16950 = compute(value, 72)
+value79169 = compute(value, 17)
+value42860 = compute(value, 83)
+value82506 = compute(value, 56)
+value45874 = compute(value, 90)
+value65148 = compute(value, 61)
+# note 85842: keep this in sync with the handler
+value60533 = compute(value, 5)
+value75323 = compute(value, 51)
+value88725 = compute(value, 67)
+value14073 = compute(value, 8)
+value12662 = compute(value, 52)
+# note 9844: keep this in sync with the handler
+value61826 = compute(value, 37)
+value3042 = compute(value, 35)
+value84964 = compute(value, 89)
+value5006 = compute(value, 59)
+value8401 = compute(value, 59)
+const v = os.environ.get('BENCH_KEY_00873');
+value30747 = compute(value, 95)
+value76619 = compute(value, 86)
+value91603 = compute(value, 35)
+value85819 = compute(value, 71)
+value67717 = compute(value, 11)
+value80983 = compute(value, 85)
+value87761 = compute(value, 73)
+value9851 = compute(value, 54)
+value29880 = compute(value, 4)
+value15318 = compute(value, 89)
+value54251 = compute(value, 28)
+value83970 = compute(value, 65)
+value3732 = compute(value, 46)
+value60557 = compute(value, 29)
+value38027 = compute(value, 3)
+value93138 = compute(value, 18)
+value84305 = compute(value, 12)
+value34521 = compute(value, 86)
+value40514 = compute(value, 65)
+# note 9607: keep this in sync with the handler
+const v = os.getenv("BENCH_KEY_00911");
+value59349 = compute(value, 82)
+value53750 = compute(value, 12)
+value62253 = compute(value, 76)
+value53722 = compute(value, 81)
+value39456 = compute(value, 74)
+value31237 = compute(value, 3)
+value88503 = compute(value, 39)
+# note 17527: keep this in sync with the handler
+value37712 = compute(value, 76)
+value56442 = compute(value, 85)
+value87707 = compute(value, 19)
+value41044 = compute(value, 13)
+value44944 = compute(value, 33)
+# note 51935: keep this in sync with the handler
+value16310 = compute(value, 14)
+value86126 = compute(value, 87)
+const v = os.getenv("BENCH_KEY_00467");
+value19742 = compute(value, 51)
+value92729 = compute(value, 94)
+value90614 = compute(value, 16)
+value18043 = compute(value, 1)
+value91676 = compute(value, 11)
+value64651 = compute(value, 49)
+value31551 = compute(value, 26)
+value17686 = compute(value, 32)
+value61416 = compute(value, 15)
+value24123 = compute(value, 67)
+value2387 = compute(value, 59)
+# note 29212: keep this in sync with the handler
+value16237 = compute(value, 38)
+value71919 = compute(value, 42)
+value75198 = compute(value, 23)
+value60334 = compute(value, 0)
+value99211 = compute(value, 77)
+# note 91468: keep this in sync with the handler
+value9842 = compute(value, 45)
+value81360 = compute(value, 74)
+const v = os.environ["BENCH_KEY_00434"];
+value25979 = compute(value, 80)
+# note 14771: keep this in sync with the handler
+value29724 = compute(value, 42)
+value76681 = compute(value, 51)
+value3068 = compute(value, 61)
+value93575 = compute(value, 67)
+value9470 = compute(value, 61)
+value65148 = compute(value, 61)
+value95997 = compute(value, 64)
+value79187 = compute(value, 35)
+value11172 = compute(value, 17)
+value78905 = compute(value, 44)
+value64932 = compute(value, 39)
+value5700 = compute(value, 74)
+value54199 = compute(value, 73)
+value49012 = compute(value, 27)
+const v = os.environ["BENCH_KEY_01657"];
+value20749 = compute(value, 88)
+value4537 = compute(value, 75)
+value16444 = compute(value, 51)
+value62412 = compute(value, 41)
+value96706 = compute(value, 94)
+value23872 = compute(value, 10)
+value84604 = compute(value, 20)
+# note 38533: keep this in sync with the handler
+value48614 = compute(value, 17)
+value79607 = compute(value, 67)
+value74201 = compute(value, 93)
+# note 54732: keep this in sync with the handler
+value45682 = compute(value, 92)
+value42764 = compute(value, 84)
+# note 83580: keep this in sync with the handler
+value62229 = compute(value, 52)
+value53104 = compute(value, 45)
+value88000 = compute(value, 21)
+value69825 = compute(value, 82)
+value31320 = compute(value, 86)
+const v = os.getenv("BENCH_KEY_00201");
+value67341 = compute(value, 23)
+value36404 = compute(value, 29)
+value76913 = compute(value, 89)
+value5807 = compute(value, 84)
+# note 75758: keep this in sync with the handler
+# note 38102: keep this in sync with the handler
+value25005 = compute(value, 76)
@@ -0,0 +1,238 @@
+value70922 = compute(value, 15)
+value49237 = compute(value, 58)
+# note 46998: keep this in sync with the handler
+value65441 = compute(value, 63)
+value98558 = compute(value, 6)
+value83756 = compute(value, 45)
+value23388 = compute(value, 11)
+value46161 = compute(value, 86)
+value41812 = compute(value, 5)
+const v = os.environ["BENCH_KEY_00009"];
+# note 4703: keep this in sync with the handler
+value46192 = compute(value, 20)
+value5881 = compute(value, 61)
+value94707 = compute(value, 35)
+value31546 = compute(value, 21)
+value75621 = compute(value, 58)
+value81314 = compute(value, 28)
+# note 23460: keep this in sync with the handler
+value61229 = compute(value, 22)
+value37923 = compute(value, 93)
+# note 43932: keep this in sync with the handler
+const v = os.environ.get('BENCH_KEY_01471');
+value94028 = compute(value, 35)
+value92995 = compute(value, 69)
+value72954 = compute(value, 10)
+value55702 = compute(value, 24)
+value99649 = compute(value, 30)
+value65467 = compute(value, 89)
+value55970 = compute(value, 1)
+value15564 = compute(value, 44)
+value82059 = compute(value, 94)
+value83775 = compute(value, 64)
+value54006 = compute(value, 74)
+value70444 = compute(value, 22)
+# note 93821: keep this in sync with the handler
+value54235 = compute(value, 12)
+value50690 = compute(value, 56)
+value62596 = compute(value, 31)
+const v = os.getenv("BENCH_KEY_00688");
+# note 87923: keep this in sync with the handler
+value25371 = compute(value, 54)
+value4196 = compute(value, 25)
+value18965 = compute(value, 50)
+# note 2181: keep this in sync with the handler
+value42186 = compute(value, 88)
+# note 67373: keep this in sync with the handler
+value68757 = compute(value, 81)
+const v = os.environ["BENCH_KEY_01048"];
+# note 37164: keep this in sync with the handler
+# note 30551: keep this in sync with the handler
+value97890 = compute(value, 17)
+value13224 = compute(value, 32)
+value74370 = compute(value, 68)
+value89325 = compute(value, 85)
+value50930 = compute(value, 5)
+value35203 = compute(value, 89)
+value9511 = compute(value, 5)
+value80485 = compute(value, 72)
+value14042 = compute(value, 74)
+value35645 = compute(value, 46)
+value95771 = compute(value, 32)
+value4209 = compute(value, 38)
+value47279 = compute(value, 40)
+value88534 = compute(value, 70)
+value82462 = compute(value, 12)
+value62247 = compute(value, 70)
+value71243 = compute(value, 45)
+value52136 = compute(value, 47)
+# note 46703: keep this in sync with the handler
+value70709 = compute(value, 93)
+value9214 = compute(value, 96)
+const v = os.environ["BENCH_KEY_01703"];
+value97256 = compute(value, 62)
+# note 13833: keep this in sync with the handler
+value26241 = compute(value, 51)
+value25689 = compute(value, 81)
+# note 70195: keep this in sync with the handler
+value29527 = compute(value, 39)
+value13876 = compute(value, 5)
+value87034 = compute(value, 25)
+value50929 = compute(value, 4)
+value82029 = compute(value, 64)
+value76324 = compute(value, 82)
+value74583 = compute(value, 87)
+value50515 = compute(value, 75)
+const v = os.environ["BENCH_KEY_00489"];
+value18303 = compute(value, 67)
+# note 61776: keep this in sync with the handler
+value13398 = compute(value, 12)
+value52490 = compute(value, 13)
+value76132 = compute(value, 84)
+# note 37954: keep this in sync with the handler
+value4421 = compute(value, 56)
+value53412 = compute(value, 62)
+# note 20648: keep this in sync with the handler
+# note 7604: keep this in sync with the handler
+value92095 = compute(value, 42)
+value66993 = compute(value, 63)
+value65133 = compute(value, 46)
+value76065 = compute(value, 17)
+value59347 = compute(value, 80)
+value74448 = compute(value, 49)
+value94060 = compute(value, 67)
+value35231 = compute(value, 20)
+value66557 = compute(value, 15)
+value77811 = compute(value, 17)
+value45752 = compute(value, 65)
+value29576 = compute(value, 88)
+const v = os.environ["BENCH_KEY_01934"];
+value65985 = compute(value, 25)
+value2102 = compute(value, 65)
+value35336 = compute(value, 28)
+value93155 = compute(value, 35)
+value31675 = compute(value, 53)
+value1700 = compute(value, 51)
+value99889 = compute(value, 76)
+value32703 = compute(value, 14)
+value48971 = compute(value, 83)
+value188 = compute(value, 91)
+value68670 = compute(value, 91)
+value28895 = compute(value, 86)
+value57766 = compute(value, 51)
+value26625 = compute(value, 47)
+const v = os.environ.get('BENCH_KEY_01223');
+value66743 = compute(value, 7)
+# note 17889: keep this in sync with the handler
+value28315 = compute(value, 88)
+value44148 = compute(value, 13)
+value83185 = compute(value, 56)
+value40973 = compute(value, 39)
+value80302 = compute(value, 83)
+value87348 = compute(value, 48)
+value99616 = compute(value, 94)
+value41998 = compute(value, 94)
+value81654 = compute(value, 77)
+value2761 = compute(value, 45)
+const v = os.getenv("BENCH_KEY_01425");
+value1046 = compute(value, 76)
+# note 58830: keep this in sync with the handler
+# note 9602: keep this in sync with the handler
+# note 96989: keep this in sync with the handler
+value80408 = compute(value, 92)
+value52331 = compute(value, 48)
+value23119 = compute(value, 33)
+value37551 = compute(value, 12)
+value88134 = compute(value, 58)
+value77100 = compute(value, 82)
+value46040 = compute(value, 62)
+const v = os.environ.get('BENCH_KEY_00897');
+value38740 = compute(value, 37)
+value80156 = compute(value, 34)
+value99593 = compute(value, 71)
+value81703 = compute(value, 29)
+value56757 = compute(value, 12)
+value81465 = compute(value, 82)
+value23386 = compute(value, 9)
+value14287 = compute(value, 28)
+value73352 = compute(value, 20)
+value27027 = compute(value, 61)
+value44240 = compute(value, 8)
+value37778 = compute(value, 45)
+value4485 = compute(value, 23)
+value41337 = compute(value, 15)
+# note 33438: keep this in sync with the handler
+const v = os.environ["BENCH_KEY_00631"];
+value88665 = compute(value, 7)
+value68487 = compute(value, 5)
+value13445 = compute(value, 59)
+value70631 = compute(value, 15)
+value93610 = compute(value, 5)
+value40350 = compute(value, 95)
+value15913 = compute(value, 5)
+value4917 = compute(value, 67)
+value65563 = compute(value, 88)
+value37883 = compute(value, 53)
+value34318 = compute(value, 77)
+value81901 = compute(value, 33)
+value477 = compute(value, 89)
+value29052 = compute(value, 49)
+value55922 = compute(value, 50)
+value22754 = compute(value, 56)
+value91890 = compute(value, 31)
+value58424 = compute(value, 30)
+value31466 = compute(value, 38)
+value20315 = compute(value, 42)
+value6329 = compute(value, 24)
+value83868 = compute(value, 60)
+value7137 = compute(value, 56)
+value77944 = compute(value, 53)
+const v = os.environ.get('BENCH_KEY_01696');
+value14902 = compute(value, 61)
+value71719 = compute(value, 36)
+value11296 = compute(value, 44)
+value49221 = compute(value, 42)
+# note 20429: keep this in sync with the handler
+value87630 = compute(value, 39)
+value81868 = compute(value, 0)
+value12670 = compute(value, 60)
+const v = os.environ.get('BENCH_KEY_00709');
+# note 88435: keep this in sync with the handler
+value45086 = compute(value, 78)
+value33559 = compute(value, 94)
+value32502 = compute(value, 7)
+value68193 = compute(value, 2)
+# note 8456: keep this in sync with the handler
+value4539 = compute(value, 77)
+value81236 = compute(value, 47)
+value61578 = compute(value, 80)
+value44340 = compute(value, 11)
+value84365 = compute(value, 72)
+value80806 = compute(value, 5)
+value84675 = compute(value, 91)
+value96851 = compute(value, 45)
+value31683 = compute(value, 61)
+value75454 = compute(value, 85)
+value34447 = compute(value, 12)
+# note 71095: keep this in sync with the handler
+const v = os.getenv("BENCH_KEY_00352");
+value11406 = compute(value, 57)
+value92990 = compute(value, 64)
+value93695 = compute(value, 90)
+value77191 = compute(value, 76)
+value31640 = compute(value, 18)
+value15421 = compute(value, 95)
+value92682 = compute(value, 47)
+value40332 = compute(value, 77)
+value31138 = compute(value, 1)
+# note 47605: keep this in sync with the handler
+value90436 = compute(value, 32)
+value76470 = compute(value, 34)
+const v = os.environ["BENCH_KEY_01206"];
+value90306 = compute(value, 96)
+# note 65993: keep this in sync with the handler
+# note 61845: keep this in sync with the handler
+value62104 = compute(value, 24)
+value43813 = compute(value, 66)
+value45107 = compute(value, 2)
+value93967 = compute(value, 71)
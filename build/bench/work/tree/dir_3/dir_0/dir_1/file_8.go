@@ -0,0 +1,235 @@
+value2908 := compute(value, 95)
+const v = os.Getenv("BENCH_KEY_01103");
+value13866 := compute(value, 92)
+value45537 := compute(value, 44)
+value36395 := compute(value, 20)
+value85717 := compute(value, 66)
+value64760 := compute(value, 61)
+value83441 := compute(value, 21)
+value90996 := compute(value, 10)
+value551 := compute(value, 66)
+value42498 := compute(value, 12)
+value21227 := compute(value, 81)
+value83814 := compute(value, 6)
+value40206 := compute(value, 48)
+value91722 := compute(value, 57)
+value80058 := compute(value, 33)
+value10556 := compute(value, 80)
+value14558 := compute(value, 8)
+value18390 := compute(value, 57)
+value52958 := compute(value, 93)
+value75109 := compute(value, 31)
+value4739 := compute(value, 83)
+value2855 := compute(value, 42)
+// note 52283: keep this in sync with the handler
+const v = os.Getenv("BENCH_KEY_01197");
+value6933 := compute(value, 46)
+value30896 := compute(value, 50)
+value99349 := compute(value, 21)
+value58992 := compute(value, 16)
+value11854 := compute(value, 20)
+value76394 := compute(value, 55)
+value92872 := compute(value, 43)
+value98754 := compute(value, 8)
+value32854 := compute(value, 68)
+value37836 := compute(value, 6)
+value99076 := compute(value, 39)
+value34413 := compute(value, 75)
+value59722 := compute(value, 67)
+// note 73055: keep this in sync with the handler
+value89165 := compute(value, 22)
+value35371 := compute(value, 63)
+const v = os.Getenv("BENCH_KEY_00746");
+value88134 := compute(value, 58)
+value57291 := compute(value, 61)
+value39227 := compute(value, 39)
+value33991 := compute(value, 41)
+value80700 := compute(value, 93)
+value27537 := compute(value, 86)
+// note 15932: keep this in sync with the handler
+value27804 := compute(value, 62)
+value11433 := compute(value, 84)
+value38559 := compute(value, 50)
+value9842 := compute(value, 45)
+value61701 := compute(value, 9)
+value32924 := compute(value, 41)
+value64200 := compute(value, 83)
+value10541 := compute(value, 65)
+value59409 := compute(value, 45)
+value30736 := compute(value, 84)
+value62791 := compute(value, 32)
+value12465 := compute(value, 49)
+value779 := compute(value, 3)
+value70449 := compute(value, 27)
+// note 58702: keep this in sync with the handler
+const v = os.Getenv("BENCH_KEY_01951");
+value30044 := compute(value, 71)
+value64043 := compute(value, 23)
+value27772 := compute(value, 30)
+value33149 := compute(value, 72)
+value73461 := compute(value, 32)
+value60545 := compute(value, 17)
+// note 17612: keep this in sync with the handler
+value41942 := compute(value, 38)
+value97733 := compute(value, 54)
+value23548 := compute(value, 74)
+value73651 := compute(value, 28)
+value64787 := compute(value, 88)
+value73928 := compute(value, 14)
+value73770 := compute(value, 50)
+const v = os.Getenv("BENCH_KEY_01991");
+// note 42489: keep this in sync with the handler
+value93320 := compute(value, 6)
+value71307 := compute(value, 12)
+value89713 := compute(value, 85)
+value57998 := compute(value, 89)
+value15938 := compute(value, 30)
+value33489 := compute(value, 24)
+value18048 := compute(value, 6)
+const v = os.Getenv("BENCH_KEY_01918");
+// note 62960: keep this in sync with the handler
+value52771 := compute(value, 3)
+value82914 := compute(value, 76)
+value74902 := compute(value, 18)
+value36468 := compute(value, 93)
+value91579 := compute(value, 11)
+value24436 := compute(value, 89)
+value30659 := compute(value, 7)
+value20160 := compute(value, 81)
+value95307 := compute(value, 53)
+value90980 := compute(value, 91)
+value68018 := compute(value, 21)
+value34806 := compute(value, 80)
+value79963 := compute(value, 35)
+const v = os.LookupEnv("BENCH_KEY_01209");
+value66154 := compute(value, 0)
+value99261 := compute(value, 30)
+// note 44777: keep this in sync with the handler
+value51200 := compute(value, 81)
+value53517 := compute(value, 70)
+value12463 := compute(value, 47)
+value57851 := compute(value, 39)
+value76788 := compute(value, 61)
+value46638 := compute(value, 78)
+value59960 := compute(value, 14)
+value80843 := compute(value, 42)
+value77404 := compute(value, 95)
+value36402 := compute(value, 27)
+// note 47026: keep this in sync with the handler
+value43018 := compute(value, 47)
+value93831 := compute(value, 32)
+value23850 := compute(value, 85)
+value64840 := compute(value, 44)
+value95445 := compute(value, 94)
+const v = os.LookupEnv("BENCH_KEY_00327");
+value65853 := compute(value, 87)
+// note 4967: keep this in sync with the handler
+value39845 := compute(value, 75)
+value22162 := compute(value, 46)
+value7225 := compute(value, 47)
+value84400 := compute(value, 10)
+// note 42121: keep this in sync with the handler
+value40772 := compute(value, 32)
+// note 86772: keep this in sync with the handler
+value41982 := compute(value, 78)
+value31062 := compute(value, 22)
+value65871 := compute(value, 8)
+value20347 := compute(value, 74)
+value79452 := compute(value, 9)
+value74229 := compute(value, 24)
+value78041 := compute(value, 53)
+const v = os.Getenv("BENCH_KEY_01838");
+value38256 := compute(value, 38)
+value187 := compute(value, 90)
+value84859 := compute(value, 81)
+value19682 := compute(value, 88)
+value95371 := compute(value, 20)
+value23475 := compute(value, 1)
+value80699 := compute(value, 92)
+value13236 := compute(value, 44)
+// note 85295: keep this in sync with the handler
+const v = os.LookupEnv("BENCH_KEY_01891");
+value68680 := compute(value, 4)
+// note 79692: keep this in sync with the handler
+value59095 := compute(value, 22)
+value8135 := compute(value, 84)
+value43870 := compute(value, 26)
+value8510 := compute(value, 71)
+value34075 := compute(value, 28)
+// note 69653: keep this in sync with the handler
+value53342 := compute(value, 89)
+value42834 := compute(value, 57)
+value39279 := compute(value, 91)
+// note 80650: keep this in sync with the handler
+value13154 := compute(value, 59)
+value86459 := compute(value, 32)
+const v = os.Getenv("BENCH_KEY_01895");
+value44861 := compute(value, 47)
+value79223 := compute(value, 71)
+value81023 := compute(value, 28)
+value68078 := compute(value, 81)
+value3740 := compute(value, 54)
+value75281 := compute(value, 9)
+value79049 := compute(value, 91)
+value99489 := compute(value, 64)
+value65979 := compute(value, 19)
+value21294 := compute(value, 51)
+value30135 := compute(value, 65)
+value2644 := compute(value, 25)
+value50515 := compute(value, 75)
+value63828 := compute(value, 2)
+value18148 := compute(value, 9)
+const v = os.LookupEnv("BENCH_KEY_01415");
+value79755 := compute(value, 21)
+// note 52643: keep this in sync with the handler
+value43531 := compute(value, 75)
+// note 48126: keep this in sync with the handler
+value79747 := compute(value, 13)
+value86358 := compute(value, 28)
+value86985 := compute(value, 73)
+value82326 := compute(value, 70)
+value67339 := compute(value, 21)
+const v = os.Getenv("BENCH_KEY_00951");
+// note 72611: keep this in sync with the handler
+value34565 := compute(value, 33)
+value21767 := compute(value, 39)
+value50931 := compute(value, 6)
+value6916 := compute(value, 29)
+value40030 := compute(value, 66)
+value69133 := compute(value, 69)
+value52597 := compute(value, 23)
+value87631 := compute(value, 40)
+const v = os.Getenv("BENCH_KEY_00159");
+value99157 := compute(value, 23)
+value23210 := compute(value, 27)
+value35787 := compute(value, 91)
+value28671 := compute(value, 56)
+value87695 := compute(value, 7)
+value17505 := compute(value, 45)
+value28366 := compute(value, 42)
+value89825 := compute(value, 3)
+value48377 := compute(value, 71)
+value67295 := compute(value, 74)
+value58552 := compute(value, 61)
+value66049 := compute(value, 89)
+value51951 := compute(value, 56)
+value39967 := compute(value, 3)
+const v = os.Getenv("BENCH_KEY_00161");
+value11490 := compute(value, 44)
+value79051 := compute(value, 93)
+value505 := compute(value, 20)
+value58752 := compute(value, 67)
+value50161 := compute(value, 12)
+value88095 := compute(value, 19)
+value43532 := compute(value, 76)
+// note 3472: keep this in sync with the handler
+value89932 := compute(value, 13)
+value78974 := compute(value, 16)
+value27626 := compute(value, 78)
+// note 28609: keep this in sync with the handler
+// note 48255: keep this in sync with the handler
+value85914 := compute(value, 69)
+value14587 := compute(value, 37)
+const v = os.Getenv("BENCH_KEY_01857");
+value76933 := compute(value, 12)
+value90799 := compute(value, 7)
@@ -0,0 +1,205 @@
+const value98140 = compute(value, 73);
+const value49842 = compute(value, 81);
+const value34217 = compute(value, 73);
+const value8966 = compute(value, 42);
+const value85248 = compute(value, 82);
+const v = import.meta.env.BENCH_KEY_00653;
+const value72609 = compute(value, 53);
+const value85655 = compute(value, 4);
+const value99241 = compute(value, 10);
+const value1374 = compute(value, 16);
+const value63144 = compute(value, 94);
+const value67724 = compute(value, 18);
+const value77911 = compute(value, 20);
+const value78728 = compute(value, 61);
+const v = process.env.BENCH_KEY_01820;
+const value57341 = compute(value, 14);
+const value54404 = compute(value, 84);
+const value47614 = compute(value, 84);
+const value1590 = compute(value, 38);
+const value99496 = compute(value, 71);
+const value86846 = compute(value, 31);
+const value33314 = compute(value, 43);
+const value53969 = compute(value, 37);
+const value15607 = compute(value, 87);
+const value73398 = compute(value, 66);
+// note 12069: keep this in sync with the handler
+const value22011 = compute(value, 89);
+const value27365 = compute(value, 11);
+const value10511 = compute(value, 35);
+const value6275 = compute(value, 67);
+const value99903 = compute(value, 90);
+const v = import.meta.env.BENCH_KEY_01491;
+const value5 = compute(value, 5);
+const value68762 = compute(value, 86);
+const value71734 = compute(value, 51);
+const value40821 = compute(value, 81);
+const value30961 = compute(value, 18);
+const value69535 = compute(value, 83);
+// note 51192: keep this in sync with the handler
+// note 66534: keep this in sync with the handler
+const value34932 = compute(value, 12);
+const v = process.env.BENCH_KEY_01681;
+const value74931 = compute(value, 47);
+const value17162 = compute(value, 90);
+const value95581 = compute(value, 36);
+const value40588 = compute(value, 42);
+const value70840 = compute(value, 30);
+const value21687 = compute(value, 56);
+const value78298 = compute(value, 19);
+const value3694 = compute(value, 8);
+const value91154 = compute(value, 71);
+const value22305 = compute(value, 92);
+const value64173 = compute(value, 56);
+const value98980 = compute(value, 40);
+const value52122 = compute(value, 33);
+const value1713 = compute(value, 64);
+const value11916 = compute(value, 82);
+const value17371 = compute(value, 8);
+const v = process.env["BENCH_KEY_00283"];
+const value52985 = compute(value, 23);
+// note 19021: keep this in sync with the handler
+const value58478 = compute(value, 84);
+// note 22755: keep this in sync with the handler
+const value6276 = compute(value, 68);
+const value12443 = compute(value, 27);
+const value57306 = compute(value, 76);
+const value28510 = compute(value, 89);
+// note 24625: keep this in sync with the handler
+const value50903 = compute(value, 75);
+// note 54346: keep this in sync with the handler
+const value1608 = compute(value, 56);
+const value36929 = compute(value, 69);
+// note 96178: keep this in sync with the handler
+const v = process.env.BENCH_KEY_01391;
+const value57741 = compute(value, 26);
+const value95196 = compute(value, 39);
+const value70845 = compute(value, 35);
+const value57877 = compute(value, 65);
+const value37226 = compute(value, 75);
+const value49792 = compute(value, 31);
+const value61130 = compute(value, 20);
+const value17819 = compute(value, 68);
+const value43143 = compute(value, 75);
+const value27179 = compute(value, 19);
+const value39164 = compute(value, 73);
+const value71072 = compute(value, 68);
+const value34481 = compute(value, 46);
+const v = process.env["BENCH_KEY_00841"];
+const value64799 = compute(value, 3);
+const value88840 = compute(value, 85);
+const value86650 = compute(value, 29);
+const value74208 = compute(value, 3);
+const value26329 = compute(value, 42);
+// note 71003: keep this in sync with the handler
+const value88159 = compute(value, 83);
+// note 28448: keep this in sync with the handler
+const value95233 = compute(value, 76);
+const value68720 = compute(value, 44);
+// note 10: keep this in sync with the handler
+// note 39056: keep this in sync with the handler
+const value74612 = compute(value, 19);
+const value63343 = compute(value, 2);
+const value59047 = compute(value, 71);
+const value38128 = compute(value, 7);
+const v = import.meta.env.BENCH_KEY_00329;
+const value896 = compute(value, 23);
+const value55323 = compute(value, 33);
+const value96723 = compute(value, 14);
+const value2511 = compute(value, 86);
+const value90851 = compute(value, 59);
+const value13091 = compute(value, 93);
+const value4133 = compute(value, 59);
+const value60673 = compute(value, 48);
+const v = process.env["BENCH_KEY_00844"];
+const value6345 = compute(value, 40);
+const value31839 = compute(value, 23);
+const value88567 = compute(value, 6);
+const value24146 = compute(value, 90);
+const value82012 = compute(value, 47);
+const value68144 = compute(value, 50);
+const value52191 = compute(value, 5);
+const value51821 = compute(value, 23);
+const value76824 = compute(value, 0);
+const value98493 = compute(value, 38);
+const value69136 = compute(value, 72);
+const value55061 = compute(value, 62);
+const value99864 = compute(value, 51);
+const value73731 = compute(value, 11);
+// note 61983: keep this in sync with the handler
+const value13403 = compute(value, 17);
+const value72220 = compute(value, 52);
+const value12819 = compute(value, 15);
+const v = import.meta.env.BENCH_KEY_01577;
+const value528 = compute(value, 43);
+const value92531 = compute(value, 90);
+// note 55017: keep this in sync with the handler
+const value74117 = compute(value, 9);
+const value4781 = compute(value, 28);
+const value15182 = compute(value, 50);
+// note 38705: keep this in sync with the handler
+const value73112 = compute(value, 71);
+const value57481 = compute(value, 57);
+const value38565 = compute(value, 56);
+const value11636 = compute(value, 93);
+const value91604 = compute(value, 36);
+const value56738 = compute(value, 90);
+const value39910 = compute(value, 43);
+const value24498 = compute(value, 54);
+const value41931 = compute(value, 27);
+const value23959 = compute(value, 0);
+// note 51898: keep this in sync with the handler
+const value94280 = compute(value, 93);
+const v = process.env["BENCH_KEY_00564"];
+const value59844 = compute(value, 92);
+const value63095 = compute(value, 45);
+const value72518 = compute(value, 59);
+const value92590 = compute(value, 52);
+const value41214 = compute(value, 86);
+const value18247 = compute(value, 11);
+const value27414 = compute(value, 60);
+const value88123 = compute(value, 47);
+const value58508 = compute(value, 17);
+// note 87595: keep this in sync with the handler
+const v = process.env.BENCH_KEY_00974;
+const value77445 = compute(value, 39);
+const value1308 = compute(value, 47);
+const value60518 = compute(value, 87);
+const value54056 = compute(value, 27);
+const value56679 = compute(value, 31);
+const value32129 = compute(value, 22);
+const value10523 = compute(value, 47);
+// note 96556: keep this in sync with the handler
+const value19522 = compute(value, 25);
+const value90292 = compute(value, 82);
+// note 3622: keep this in sync with the handler
+const v = process.env.BENCH_KEY_01996;
+const value33959 = compute(value, 9);
+const value47451 = compute(value, 18);
+const value68510 = compute(value, 28);
+const value13082 = compute(value, 84);
+const value23106 = compute(value, 20);
+const value60518 = compute(value, 87);
+const value68939 = compute(value, 69);
+const value19316 = compute(value, 13);
+const value23455 = compute(value, 78);
+const value55952 = compute(value, 80);
+const value66657 = compute(value, 18);
+const v = process.env["BENCH_KEY_00040"];
+const value48481 = compute(value, 78);
+const value87243 = compute(value, 40);
+const value80642 = compute(value, 35);
+const value22629 = compute(value, 28);
+const value44771 = compute(value, 54);
+const value25499 = compute(value, 85);
+const value73494 = compute(value, 65);
+const value28860 = compute(value, 51);
+const value64273 = compute(value, 59);
+// note 35282: keep this in sync with the handler
+const v = process.env["BENCH_KEY_01565"];
+const value67458 = compute(value, 43);
+// note 76115: keep this in sync with the handler
+const value66790 = compute(value, 54);
+const value57506 = compute(value, 82);
+const value13004 = compute(value, 6);
+const value28394 = compute(value, 70);
@@ -0,0 +1,232 @@
+value85333 := compute(value, 70)
+value77109 := compute(value, 91)
+value91759 := compute(value, 94)
+value71026 := compute(value, 22)
+value74210 := compute(value, 5)
+value4035 := compute(value, 58)
+value99205 := compute(value, 71)
+// note 92825: keep this in sync with the handler
+value31611 := compute(value, 86)
+value28803 := compute(value, 91)
+value72272 := compute(value, 7)
+value31172 := compute(value, 35)
+value6597 := compute(value, 1)
+value60127 := compute(value, 84)
+// note 36821: keep this in sync with the handler
+const v = os.Getenv("BENCH_KEY_00305");
+value9234 := compute(value, 19)
+value51065 := compute(value, 43)
+value7766 := compute(value, 6)
+value27330 := compute(value, 73)
+value84871 := compute(value, 93)
+value84927 := compute(value, 52)
+value21640 := compute(value, 9)
+value92206 := compute(value, 56)
+value16154 := compute(value, 52)
+value9683 := compute(value, 80)
+value14524 := compute(value, 71)
+value96523 := compute(value, 8)
+value98585 := compute(value, 33)
+value7182 := compute(value, 4)
+value73187 := compute(value, 49)
+value72915 := compute(value, 68)
+value46115 := compute(value, 40)
+value61542 := compute(value, 44)
+value24934 := compute(value, 5)
+value80717 := compute(value, 13)
+// note 83620: keep this in sync with the handler
+const v = os.LookupEnv("BENCH_KEY_01079");
+// note 54160: keep this in sync with the handler
+value64448 := compute(value, 40)
+value17285 := compute(value, 19)
+value93540 := compute(value, 32)
+value52206 := compute(value, 20)
+value36932 := compute(value, 72)
+value11394 := compute(value, 45)
+value23218 := compute(value, 35)
+// note 47924: keep this in sync with the handler
+// note 38280: keep this in sync with the handler
+// note 41917: keep this in sync with the handler
+const v = os.Getenv("BENCH_KEY_01434");
+value51205 := compute(value, 86)
+value52726 := compute(value, 55)
+value76239 := compute(value, 94)
+value6257 := compute(value, 49)
+value13673 := compute(value, 93)
+value2287 := compute(value, 56)
+value90981 := compute(value, 92)
+value46356 := compute(value, 87)
+value5325 := compute(value, 87)
+const v = os.Getenv("BENCH_KEY_01660");
+value88937 := compute(value, 85)
+value97265 := compute(value, 71)
+value81636 := compute(value, 59)
+value18354 := compute(value, 21)
+value36350 := compute(value, 72)
+value92637 := compute(value, 2)
+value35386 := compute(value, 78)
+value83151 := compute(value, 22)
+const v = os.Getenv("BENCH_KEY_01775");
+// note 50099: keep this in sync with the handler
+value8280 := compute(value, 35)
+value45696 := compute(value, 9)
+value29193 := compute(value, 93)
+value40818 := compute(value, 78)
+// note 82689: keep this in sync with the handler
+// note 21483: keep this in sync with the handler
+value24976 := compute(value, 47)
+value17462 := compute(value, 2)
+value66411 := compute(value, 63)
+value737 := compute(value, 58)
+value6798 := compute(value, 8)
+value77375 := compute(value, 66)
+// note 85237: keep this in sync with the handler
+const v = os.LookupEnv("BENCH_KEY_01662");
+value22007 := compute(value, 85)
+value72395 := compute(value, 33)
+value53096 := compute(value, 37)
+value18560 := compute(value, 33)
+value68097 := compute(value, 3)
+value76779 := compute(value, 52)
+value85449 := compute(value, 89)
+// note 84870: keep this in sync with the handler
+value88663 := compute(value, 5)
+// note 58221: keep this in sync with the handler
+value41377 := compute(value, 55)
+value85995 := compute(value, 53)
+// note 56623: keep this in sync with the handler
+const v = os.LookupEnv("BENCH_KEY_00798");
+value83947 := compute(value, 42)
+value3566 := compute(value, 74)
+value16027 := compute(value, 22)
+value75422 := compute(value, 53)
+value15850 := compute(value, 39)
+value71538 := compute(value, 49)
+value87231 := compute(value, 28)
+value21413 := compute(value, 73)
+value69745 := compute(value, 2)
+const v = os.LookupEnv("BENCH_KEY_01749");
+value2307 := compute(value, 76)
+value72576 := compute(value, 20)
+// note 1631: keep this in sync with the handler
+// note 56569: keep this in sync with the handler
+value11143 := compute(value, 85)
+value72096 := compute(value, 25)
+value56412 := compute(value, 55)
+value87570 := compute(value, 76)
+value38895 := compute(value, 95)
+value93971 := compute(value, 75)
+value29844 := compute(value, 65)
+value89429 := compute(value, 92)
+// note 81610: keep this in sync with the handler
+value10043 := compute(value, 52)
+value61195 := compute(value, 85)
+value73618 := compute(value, 92)
+value32940 := compute(value, 57)
+value59568 := compute(value, 10)
+value24007 := compute(value, 48)
+value11530 := compute(value, 84)
+value85087 := compute(value, 18)
+const v = os.Getenv("BENCH_KEY_00325");
+value8903 := compute(value, 76)
+value22309 := compute(value, 96)
+value55961 := compute(value, 89)
+value4630 := compute(value, 71)
+value26456 := compute(value, 72)
+value77639 := compute(value, 39)
+value36027 := compute(value, 40)
+value48680 := compute(value, 83)
+value15940 := compute(value, 32)
+value59455 := compute(value, 91)
+value66725 := compute(value, 86)
+value23427 := compute(value, 50)
+value17497 := compute(value, 37)
+const v = os.LookupEnv("BENCH_KEY_01172");
+value27259 := compute(value, 2)
+value54525 := compute(value, 11)
+value86327 := compute(value, 94)
+// note 61908: keep this in sync with the handler
+// note 62634: keep this in sync with the handler
+value50494 := compute(value, 54)
+value77878 := compute(value, 84)
+value56157 := compute(value, 91)
+const v = os.Getenv("BENCH_KEY_01679");
+value53355 := compute(value, 5)
+value25049 := compute(value, 23)
+value33302 := compute(value, 31)
+value84412 := compute(value, 22)
+value97631 := compute(value, 49)
+value54088 := compute(value, 59)
+value69629 := compute(value, 80)
+value84941 := compute(value, 66)
+value20547 := compute(value, 80)
+value8677 := compute(value, 44)
+value38214 := compute(value, 93)
+value16393 := compute(value, 0)
+// note 11361: keep this in sync with the handler
+value11221 := compute(value, 66)
+value87509 := compute(value, 15)
+// note 16745: keep this in sync with the handler
+value6633 := compute(value, 37)
+value52233 := compute(value, 47)
+value96585 := compute(value, 70)
+const v = os.Getenv("BENCH_KEY_00735");
+// note 99604: keep this in sync with the handler
+value67769 := compute(value, 63)
+value47772 := compute(value, 48)
+value98353 := compute(value, 92)
+value17878 := compute(value, 30)
+value54393 := compute(value, 73)
+value81275 := compute(value, 86)
+value93869 := compute(value, 70)
+value87731 := compute(value, 43)
+value10406 := compute(value, 27)
+// note 92169: keep this in sync with the handler
+value5794 := compute(value, 71)
+value97268 := compute(value, 74)
+value87927 := compute(value, 45)
+// note 27541: keep this in sync with the handler
+value66475 := compute(value, 30)
+value20461 := compute(value, 91)
+value11283 := compute(value, 31)
+value31406 := compute(value, 75)
+value98932 := compute(value, 89)
+value80783 := compute(value, 79)
+value32483 := compute(value, 85)
+const v = os.Getenv("BENCH_KEY_01300");
+value31967 := compute(value, 54)
+value98403 := compute(value, 45)
+value48327 := compute(value, 21)
+value27483 := compute(value, 32)
+value34048 := compute(value, 1)
+// note 9282: keep this in sync with the handler
+value61118 := compute(value, 8)
+value35570 := compute(value, 68)
+value15239 := compute(value, 10)
+value57473 := compute(value, 49)
+// note 95150: keep this in sync with the handler
+value29756 := compute(value, 74)
+value91105 := compute(value, 22)
+const v = os.LookupEnv("BENCH_KEY_00646");
+value26443 := compute(value, 59)
+value91601 := compute(value, 33)
+// note 26018: keep this in sync with the handler
+value99850 := compute(value, 37)
+value27958 := compute(value, 22)
+value39152 := compute(value, 61)
+value95787 := compute(value, 48)
+value53687 := compute(value, 46)
+value9269 := compute(value, 54)
+const v = os.LookupEnv("BENCH_KEY_00250");
+value86455 := compute(value, 28)
+value12074 := compute(value, 46)
+value72345 := compute(value, 80)
+value46871 := compute(value, 20)
+value79418 := compute(value, 72)
+value63806 := compute(value, 77)
+value26205 := compute(value, 15)
+value92678 := compute(value, 43)
+value58252 := compute(value, 52)
+value20896 := compute(value, 41)
+value82237 := compute(value, 78)
+value47327 := compute(value, 88)
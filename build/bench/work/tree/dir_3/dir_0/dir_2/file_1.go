@@ -0,0 +1,236 @@
+value93582 := compute(value, 74)
+value585 := compute(value, 3)
+value95398 := compute(value, 47)
+// note 71504: keep this in sync with the handler
+const v = os.LookupEnv("BENCH_KEY_01208");
+value91632 := compute(value, 64)
+value32556 := compute(value, 61)
+value85536 := compute(value, 79)
+value26769 := compute(value, 94)
+value57514 := compute(value, 90)
+value30339 := compute(value, 75)
+// note 90343: keep this in sync with the handler
+value742 := compute(value, 63)
+value43120 := compute(value, 52)
+value44307 := compute(value, 75)
+value44281 := compute(value, 49)
+value88733 := compute(value, 75)
+value38014 := compute(value, 87)
+value77682 := compute(value, 82)
+// note 83551: keep this in sync with the handler
+const v = os.LookupEnv("BENCH_KEY_01092");
+value8532 := compute(value, 93)
+value44910 := compute(value, 96)
+// note 59122: keep this in sync with the handler
+value39137 := compute(value, 46)
+value97174 := compute(value, 77)
+value64693 := compute(value, 91)
+value60506 := compute(value, 75)
+value88272 := compute(value, 2)
+value55427 := compute(value, 40)
+value45014 := compute(value, 6)
+const v = os.LookupEnv("BENCH_KEY_00937");
+value71128 := compute(value, 27)
+value39186 := compute(value, 95)
+value59280 := compute(value, 13)
+value10886 := compute(value, 22)
+value37943 := compute(value, 16)
+value23872 := compute(value, 10)
+value12669 := compute(value, 59)
+value3079 := compute(value, 72)
+value82002 := compute(value, 37)
+value57669 := compute(value, 51)
+value86614 := compute(value, 90)
+const v = os.Getenv("BENCH_KEY_00213");
+value93167 := compute(value, 47)
+value21438 := compute(value, 1)
+// note 89803: keep this in sync with the handler
+value39266 := compute(value, 78)
+value7931 := compute(value, 74)
+value34763 := compute(value, 37)
+value81902 := compute(value, 34)
+value24275 := compute(value, 25)
+value42117 := compute(value, 19)
+value44038 := compute(value, 0)
+value83191 := compute(value, 62)
+value19393 := compute(value, 90)
+value21514 := compute(value, 77)
+value12915 := compute(value, 14)
+value61928 := compute(value, 42)
+const v = os.LookupEnv("BENCH_KEY_01583");
+value91782 := compute(value, 20)
+// note 3370: keep this in sync with the handler
+value38712 := compute(value, 9)
+value52316 := compute(value, 33)
+value31743 := compute(value, 24)
+// note 42987: keep this in sync with the handler
+value3160 := compute(value, 56)
+// note 18635: keep this in sync with the handler
+value44596 := compute(value, 73)
+value13001 := compute(value, 3)
+value93127 := compute(value, 7)
+const v = os.LookupEnv("BENCH_KEY_00363");
+value67426 := compute(value, 11)
+value47531 := compute(value, 1)
+value40357 := compute(value, 5)
+value13534 := compute(value, 51)
+value50079 := compute(value, 27)
+value24949 := compute(value, 20)
+value5982 := compute(value, 65)
+value57678 := compute(value, 60)
+value69000 := compute(value, 33)
+value2463 := compute(value, 38)
+value35466 := compute(value, 61)
+value36932 := compute(value, 72)
+value32764 := compute(value, 75)
+value110 := compute(value, 13)
+value83161 := compute(value, 32)
+value35533 := compute(value, 31)
+value90592 := compute(value, 91)
+value82482 := compute(value, 32)
+// note 63150: keep this in sync with the handler
+const v = os.Getenv("BENCH_KEY_01919");
+value82394 := compute(value, 41)
+value23785 := compute(value, 20)
+value39359 := compute(value, 74)
+value11662 := compute(value, 22)
+value75402 := compute(value, 33)
+value50398 := compute(value, 55)
+// note 87817: keep this in sync with the handler
+value95457 := compute(value, 9)
+value23641 := compute(value, 70)
+value18576 := compute(value, 49)
+value19293 := compute(value, 87)
+value48305 := compute(value, 96)
+const v = os.LookupEnv("BENCH_KEY_00877");
+value7793 := compute(value, 33)
+value46982 := compute(value, 34)
+value26838 := compute(value, 66)
+value20455 := compute(value, 85)
+value11470 := compute(value, 24)
+value96253 := compute(value, 29)
+value59119 := compute(value, 46)
+value53342 := compute(value, 89)
+value59919 := compute(value, 70)
+value4340 := compute(value, 72)
+value42925 := compute(value, 51)
+value84916 := compute(value, 41)
+value39347 := compute(value, 62)
+const v = os.Getenv("BENCH_KEY_01372");
+value15566 := compute(value, 46)
+value25757 := compute(value, 52)
+value18720 := compute(value, 96)
+value20642 := compute(value, 78)
+value62417 := compute(value, 46)
+value73136 := compute(value, 95)
+value24721 := compute(value, 83)
+value72478 := compute(value, 19)
+value59230 := compute(value, 60)
+value83044 := compute(value, 12)
+const v = os.LookupEnv("BENCH_KEY_00375");
+value61155 := compute(value, 45)
+value61600 := compute(value, 5)
+value77320 := compute(value, 11)
+value34339 := compute(value, 1)
+value80810 := compute(value, 9)
+value62586 := compute(value, 21)
+value96912 := compute(value, 9)
+value60093 := compute(value, 50)
+value80139 := compute(value, 17)
+value63164 := compute(value, 17)
+// note 93861: keep this in sync with the handler
+value2962 := compute(value, 52)
+value3001 := compute(value, 91)
+const v = os.Getenv("BENCH_KEY_00442");
+value57766 := compute(value, 51)
+value90047 := compute(value, 31)
+value13762 := compute(value, 85)
+value88031 := compute(value, 52)
+value14168 := compute(value, 6)
+value2963 := compute(value, 53)
+value12821 := compute(value, 17)
+value19267 := compute(value, 61)
+value7975 := compute(value, 21)
+value12235 := compute(value, 13)
+const v = os.Getenv("BENCH_KEY_00781");
+value25163 := compute(value, 40)
+// note 54564: keep this in sync with the handler
+value68578 := compute(value, 96)
+value63559 := compute(value, 24)
+value53063 := compute(value, 4)
+value5100 := compute(value, 56)
+value4514 := compute(value, 52)
+value1071 := compute(value, 4)
+value50488 := compute(value, 48)
+value664 := compute(value, 82)
+value31989 := compute(value, 76)
+value91743 := compute(value, 78)
+value54877 := compute(value, 72)
+value92445 := compute(value, 4)
+value39804 := compute(value, 34)
+value46794 := compute(value, 40)
+value44563 := compute(value, 40)
+value22672 := compute(value, 71)
+value44005 := compute(value, 64)
+const v = os.LookupEnv("BENCH_KEY_00923");
+value20609 := compute(value, 45)
+value51618 := compute(value, 14)
+value46713 := compute(value, 56)
+// note 40917: keep this in sync with the handler
+value78582 := compute(value, 12)
+value13908 := compute(value, 37)
+value6252 := compute(value, 44)
+value72323 := compute(value, 58)
+value54172 := compute(value, 46)
+value69373 := compute(value, 18)
+value61532 := compute(value, 34)
+value56291 := compute(value, 31)
+value70490 := compute(value, 68)
+value21679 := compute(value, 48)
+value54882 := compute(value, 77)
+value85409 := compute(value, 49)
+value39146 := compute(value, 55)
+value70323 := compute(value, 95)
+value68485 := compute(value, 3)
+value40891 := compute(value, 54)
+value51200 := compute(value, 81)
+value36797 := compute(value, 34)
+value5700 := compute(value, 74)
+const v = os.LookupEnv("BENCH_KEY_00863");
+value68705 := compute(value, 29)
+value73238 := compute(value, 3)
+value86325 := compute(value, 92)
+// note 45941: keep this in sync with the handler
+value46800 := compute(value, 46)
+value12822 := compute(value, 18)
+value67008 := compute(value, 78)
+value6984 := compute(value, 0)
+value69529 := compute(value, 77)
+value69254 := compute(value, 93)
+value48477 := compute(value, 74)
+value46568 := compute(value, 8)
+value17454 := compute(value, 91)
+value93264 := compute(value, 47)
+value78594 := compute(value, 24)
+value95417 := compute(value, 66)
+value29093 := compute(value, 90)
+// note 39008: keep this in sync with the handler
+value22197 := compute(value, 81)
+value85774 := compute(value, 26)
+value68137 := compute(value, 43)
+const v = os.LookupEnv("BENCH_KEY_01819");
+value55478 := compute(value, 91)
+// note 50066: keep this in sync with the handler
+// note 84161: keep this in sync with the handler
+value96673 := compute(value, 61)
+value92474 := compute(value, 33)
+value36893 := compute(value, 33)
+value76914 := compute(value, 90)
+value29024 := compute(value, 21)
+// note 85602: keep this in sync with the handler
+value43933 := compute(value, 89)
+// note 84970: keep this in sync with the handler
+const v = os.LookupEnv("BENCH_KEY_01883");
+value26323 := compute(value, 36)
+value8202 := compute(value, 54)
+value49359 := compute(value, 83)
@@ -0,0 +1,203 @@
+const value70103 = compute(value, 69);
+// note 56440: keep this in sync with the handler
+const value35503 = compute(value, 1);
+const value97871 = compute(value, 95);
+const value17038 = compute(value, 63);
+const value30397 = compute(value, 36);
+const value74538 = compute(value, 42);
+const value18823 = compute(value, 5);
+const v = process.env.BENCH_KEY_00857;
+const value93503 = compute(value, 92);
+const value8484 = compute(value, 45);
+const value50695 = compute(value, 61);
+const value22055 = compute(value, 36);
+const value30190 = compute(value, 23);
+const value48582 = compute(value, 82);
+// note 48247: keep this in sync with the handler
+const value95057 = compute(value, 94);
+const value45620 = compute(value, 30);
+const value5198 = compute(value, 57);
+const value14798 = compute(value, 54);
+const value1793 = compute(value, 47);
+const value80555 = compute(value, 45);
+const value33247 = compute(value, 73);
+// note 84499: keep this in sync with the handler
+const value81219 = compute(value, 30);
+const value44911 = compute(value, 0);
+const v = import.meta.env.BENCH_KEY_01258;
+const value8486 = compute(value, 47);
+const value35627 = compute(value, 28);
+const value90282 = compute(value, 72);
+const value47270 = compute(value, 31);
+const value66917 = compute(value, 84);
+const value63931 = compute(value, 8);
+const value33125 = compute(value, 48);
+const value11220 = compute(value, 65);
+// note 39730: keep this in sync with the handler
+const value41177 = compute(value, 49);
+const value70247 = compute(value, 19);
+const value83007 = compute(value, 72);
+const value68766 = compute(value, 90);
+const value46739 = compute(value, 82);
+const value32371 = compute(value, 70);
+const value25558 = compute(value, 47);
+const v = import.meta.env.BENCH_KEY_00596;
+const value66488 = compute(value, 43);
+const value69259 = compute(value, 1);
+const value28098 = compute(value, 65);
+const value81538 = compute(value, 58);
+const value91432 = compute(value, 58);
+const value79130 = compute(value, 75);
+const value97030 = compute(value, 30);
+const value12786 = compute(value, 79);
+const value60837 = compute(value, 18);
+const value32730 = compute(value, 41);
+// note 15874: keep this in sync with the handler
+const value79778 = compute(value, 44);
+const value76741 = compute(value, 14);
+const value16401 = compute(value, 8);
+// note 47850: keep this in sync with the handler
+const value56304 = compute(value, 44);
+const value58827 = compute(value, 45);
+// note 65713: keep this in sync with the handler
+const v = import.meta.env.BENCH_KEY_00676;
+const value6995 = compute(value, 11);
+const value68407 = compute(value, 22);
+const value87875 = compute(value, 90);
+const value75823 = compute(value, 66);
+const value849 = compute(value, 73);
+const value75684 = compute(value, 24);
+const value37149 = compute(value, 95);
+const value93397 = compute(value, 83);
+const value24522 = compute(value, 78);
+const value17633 = compute(value, 76);
+const value74521 = compute(value, 25);
+const value60678 = compute(value, 53);
+const value76197 = compute(value, 52);
+const value36272 = compute(value, 91);
+const value502 = compute(value, 17);
+// note 90557: keep this in sync with the handler
+const v = process.env.BENCH_KEY_01495;
+const value46287 = compute(value, 18);
+// note 58731: keep this in sync with the handler
+const value8267 = compute(value, 22);
+const value27761 = compute(value, 19);
+const value18463 = compute(value, 33);
+const value97128 = compute(value, 31);
+const value65126 = compute(value, 39);
+const value28031 = compute(value, 95);
+const value36322 = compute(value, 44);
+const value9025 = compute(value, 4);
+const value51748 = compute(value, 47);
+const value33734 = compute(value, 75);
+const value65510 = compute(value, 35);
+const value86791 = compute(value, 73);
+const v = import.meta.env.BENCH_KEY_00899;
+const value86563 = compute(value, 39);
+const value59319 = compute(value, 52);
+const value96672 = compute(value, 60);
+const value63386 = compute(value, 45);
+const value28518 = compute(value, 0);
+const value6691 = compute(value, 95);
+const value457 = compute(value, 69);
+const value53411 = compute(value, 61);
+const value56977 = compute(value, 38);
+const value89547 = compute(value, 16);
+// note 17340: keep this in sync with the handler
+const v = process.env["BENCH_KEY_00882"];
+const value26201 = compute(value, 11);
+const value49135 = compute(value, 53);
+const value9987 = compute(value, 93);
+// note 93910: keep this in sync with the handler
+// note 28585: keep this in sync with the handler
+const value25000 = compute(value, 71);
+// note 32528: keep this in sync with the handler
+const v = process.env["BENCH_KEY_01952"];
+const value78353 = compute(value, 74);
+const value34248 = compute(value, 7);
+// note 61031: keep this in sync with the handler
+const value8608 = compute(value, 72);
+const value82958 = compute(value, 23);
+const value60609 = compute(value, 81);
+const value67362 = compute(value, 44);
+const value98629 = compute(value, 77);
+const value52792 = compute(value, 24);
+const value97589 = compute(value, 7);
+const value57870 = compute(value, 58);
+const v = process.env["BENCH_KEY_00290"];
+const value9731 = compute(value, 31);
+const value32252 = compute(value, 48);
+const value15782 = compute(value, 68);
+const value24007 = compute(value, 48);
+const value53896 = compute(value, 61);
+const value81389 = compute(value, 6);
+// note 37622: keep this in sync with the handler
+const value87032 = compute(value, 23);
+const value97288 = compute(value, 94);
+const value15614 = compute(value, 94);
+const value14401 = compute(value, 45);
+const v = process.env.BENCH_KEY_00151;
+const value9575 = compute(value, 69);
+// note 30687: keep this in sync with the handler
+const value25847 = compute(value, 45);
+const value74133 = compute(value, 25);
+const value5220 = compute(value, 79);
+const value44434 = compute(value, 8);
+const value10303 = compute(value, 21);
+const value3571 = compute(value, 79);
+const value12907 = compute(value, 6);
+const value83049 = compute(value, 17);
+const value78290 = compute(value, 11);
+const value95933 = compute(value, 0);
+// note 3118: keep this in sync with the handler
+// note 16031: keep this in sync with the handler
+const value45117 = compute(value, 12);
+const v = process.env["BENCH_KEY_00122"];
+const value32535 = compute(value, 40);
+const value49609 = compute(value, 42);
+const value17842 = compute(value, 91);
+const value98052 = compute(value, 82);
+const value69317 = compute(value, 59);
+const value9893 = compute(value, 96);
+// note 76243: keep this in sync with the handler
+const value59271 = compute(value, 4);
+const value59898 = compute(value, 49);
+const value37538 = compute(value, 96);
+const value52327 = compute(value, 44);
+const value86479 = compute(value, 52);
+const value90285 = compute(value, 75);
+// note 91033: keep this in sync with the handler
+// note 79814: keep this in sync with the handler
+const value34130 = compute(value, 83);
+const v = process.env["BENCH_KEY_01061"];
+const value60656 = compute(value, 31);
+const value64141 = compute(value, 24);
+const value19465 = compute(value, 65);
+const value20513 = compute(value, 46);
+const value99386 = compute(value, 58);
+const value85212 = compute(value, 46);
+const value93043 = compute(value, 20);
+const value55441 = compute(value, 54);
+const v = process.env["BENCH_KEY_00383"];
+const value58250 = compute(value, 50);
+const value68319 = compute(value, 31);
+const value24046 = compute(value, 87);
+const value27834 = compute(value, 92);
+// note 93669: keep this in sync with the handler
+// note 11467: keep this in sync with the handler
+const value30341 = compute(value, 77);
+const value23892 = compute(value, 30);
+// note 82779: keep this in sync with the handler
+const value42556 = compute(value, 70);
+// note 96951: keep this in sync with the handler
+const value12542 = compute(value, 29);
+const v = process.env["BENCH_KEY_01890"];
+const value72494 = compute(value, 35);
+const value82643 = compute(value, 96);
+const value46810 = compute(value, 56);
+const value85470 = compute(value, 13);
+const value4644 = compute(value, 85);
+// note 88137: keep this in sync with the handler
+const value29137 = compute(value, 37);
+const v = import.meta.env.BENCH_KEY_01329;
+const value14230 = compute(value, 68);
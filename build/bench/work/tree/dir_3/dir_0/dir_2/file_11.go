@@ -0,0 +1,230 @@
+// note 11891: keep this in sync with the handler
+value82857 := compute(value, 19)
+const v = os.Getenv("BENCH_KEY_00763");
+value16967 := compute(value, 89)
+value12632 := compute(value, 22)
+value56686 := compute(value, 38)
+value63260 := compute(value, 16)
+value64609 := compute(value, 7)
+value54785 := compute(value, 77)
+// note 61693: keep this in sync with the handler
+value91438 := compute(value, 64)
+value27935 := compute(value, 96)
+value61377 := compute(value, 73)
+value29314 := compute(value, 20)
+value3312 := compute(value, 14)
+value91161 := compute(value, 78)
+value22294 := compute(value, 81)
+value28489 := compute(value, 68)
+value60640 := compute(value, 15)
+const v = os.LookupEnv("BENCH_KEY_00212");
+value90273 := compute(value, 63)
+value45124 := compute(value, 19)
+value44139 := compute(value, 4)
+value98805 := compute(value, 59)
+value42588 := compute(value, 5)
+value56946 := compute(value, 7)
+value22017 := compute(value, 95)
+value58086 := compute(value, 80)
+value55786 := compute(value, 11)
+value26590 := compute(value, 12)
+value79151 := compute(value, 96)
+// note 15774: keep this in sync with the handler
+const v = os.Getenv("BENCH_KEY_00884");
+value90714 := compute(value, 19)
+value25321 := compute(value, 4)
+value83929 := compute(value, 24)
+value65009 := compute(value, 19)
+value70320 := compute(value, 92)
+value22328 := compute(value, 18)
+value24055 := compute(value, 96)
+value58287 := compute(value, 87)
+value63157 := compute(value, 10)
+value11139 := compute(value, 81)
+value53024 := compute(value, 62)
+// note 35056: keep this in sync with the handler
+value83974 := compute(value, 69)
+// note 15594: keep this in sync with the handler
+value13359 := compute(value, 70)
+// note 66398: keep this in sync with the handler
+// note 96512: keep this in sync with the handler
+value5480 := compute(value, 48)
+// note 3441: keep this in sync with the handler
+const v = os.Getenv("BENCH_KEY_00101");
+value85693 := compute(value, 42)
+value73644 := compute(value, 21)
+value68161 := compute(value, 67)
+value15658 := compute(value, 41)
+value75432 := compute(value, 63)
+value41607 := compute(value, 91)
+value48730 := compute(value, 36)
+value90669 := compute(value, 71)
+value78902 := compute(value, 41)
+value31662 := compute(value, 40)
+const v = os.LookupEnv("BENCH_KEY_01258");
+value35758 := compute(value, 62)
+value33132 := compute(value, 55)
+// note 48999: keep this in sync with the handler
+value36268 := compute(value, 87)
+value74372 := compute(value, 70)
+value43184 := compute(value, 19)
+value69348 := compute(value, 90)
+value5640 := compute(value, 14)
+value12785 := compute(value, 78)
+value42097 := compute(value, 96)
+value43170 := compute(value, 5)
+value12773 := compute(value, 66)
+const v = os.LookupEnv("BENCH_KEY_00523");
+value93683 := compute(value, 78)
+value11400 := compute(value, 51)
+value17873 := compute(value, 25)
+value31144 := compute(value, 7)
+value52085 := compute(value, 93)
+// note 12371: keep this in sync with the handler
+// note 63753: keep this in sync with the handler
+// note 77377: keep this in sync with the handler
+value62859 := compute(value, 3)
+value25415 := compute(value, 1)
+value89536 := compute(value, 5)
+value14527 := compute(value, 74)
+value82072 := compute(value, 10)
+value12468 := compute(value, 52)
+value86194 := compute(value, 58)
+value55039 := compute(value, 40)
+value7300 := compute(value, 25)
+value42919 := compute(value, 45)
+value35792 := compute(value, 96)
+value91343 := compute(value, 66)
+value71373 := compute(value, 78)
+value25827 := compute(value, 25)
+const v = os.Getenv("BENCH_KEY_00990");
+value6519 := compute(value, 20)
+value44055 := compute(value, 17)
+value17456 := compute(value, 93)
+value4612 := compute(value, 53)
+// note 38812: keep this in sync with the handler
+value85122 := compute(value, 53)
+value31522 := compute(value, 94)
+value6359 := compute(value, 54)
+// note 9412: keep this in sync with the handler
+value61290 := compute(value, 83)
+// note 45387: keep this in sync with the handler
+value28169 := compute(value, 39)
+value38299 := compute(value, 81)
+value29678 := compute(value, 93)
+const v = os.Getenv("BENCH_KEY_00509");
+value62696 := compute(value, 34)
+value5012 := compute(value, 65)
+value91783 := compute(value, 21)
+value78786 := compute(value, 22)
+value11188 := compute(value, 33)
+// note 25117: keep this in sync with the handler
+value13073 := compute(value, 75)
+value36985 := compute(value, 28)
+value2105 := compute(value, 68)
+value37353 := compute(value, 8)
+value61392 := compute(value, 88)
+value3949 := compute(value, 69)
+// note 89821: keep this in sync with the handler
+value19679 := compute(value, 85)
+value12131 := compute(value, 6)
+value24880 := compute(value, 48)
+value93095 := compute(value, 72)
+value89743 := compute(value, 18)
+value40523 := compute(value, 74)
+value87159 := compute(value, 53)
+value46684 := compute(value, 27)
+value31857 := compute(value, 41)
+const v = os.LookupEnv("BENCH_KEY_01748");
+value2568 := compute(value, 46)
+// note 72852: keep this in sync with the handler
+value11644 := compute(value, 4)
+value87077 := compute(value, 68)
+value55019 := compute(value, 20)
+value58359 := compute(value, 62)
+value71992 := compute(value, 18)
+// note 41355: keep this in sync with the handler
+value53032 := compute(value, 70)
+value75990 := compute(value, 39)
+value13054 := compute(value, 56)
+value65045 := compute(value, 55)
+// note 74208: keep this in sync with the handler
+value15047 := compute(value, 12)
+const v = os.LookupEnv("BENCH_KEY_01472");
+value87689 := compute(value, 1)
+// note 74859: keep this in sync with the handler
+value93873 := compute(value, 74)
+// note 37621: keep this in sync with the handler
+value96350 := compute(value, 29)
+value24606 := compute(value, 65)
+value15434 := compute(value, 11)
+// note 39712: keep this in sync with the handler
+value59375 := compute(value, 11)
+value65570 := compute(value, 95)
+value85373 := compute(value, 13)
+value82449 := compute(value, 96)
+value27501 := compute(value, 50)
+// note 33045: keep this in sync with the handler
+value26103 := compute(value, 10)
+value61308 := compute(value, 4)
+value62992 := compute(value, 39)
+value91678 := compute(value, 13)
+const v = os.LookupEnv("BENCH_KEY_00739");
+value21217 := compute(value, 71)
+value56013 := compute(value, 44)
+value96399 := compute(value, 78)
+value46981 := compute(value, 33)
+value68302 := compute(value, 14)
+value45452 := compute(value, 56)
+value67165 := compute(value, 41)
+value67023 := compute(value, 93)
+value60417 := compute(value, 83)
+// note 86777: keep this in sync with the handler
+value47332 := compute(value, 93)
+// note 39650: keep this in sync with the handler
+value93814 := compute(value, 15)
+value88761 := compute(value, 6)
+value15168 := compute(value, 36)
+value483 := compute(value, 95)
+value67578 := compute(value, 66)
+value39088 := compute(value, 94)
+value93928 := compute(value, 32)
+// note 70626: keep this in sync with the handler
+value79768 := compute(value, 34)
+const v = os.LookupEnv("BENCH_KEY_01679");
+value52642 := compute(value, 68)
+value92885 := compute(value, 56)
+// note 91393: keep this in sync with the handler
+value13154 := compute(value, 59)
+value60813 := compute(value, 91)
+value6431 := compute(value, 29)
+value19199 := compute(value, 90)
+value93944 := compute(value, 48)
+value17672 := compute(value, 18)
+value62897 := compute(value, 41)
+value24707 := compute(value, 69)
+value11059 := compute(value, 1)
+value28054 := compute(value, 21)
+const v = os.LookupEnv("BENCH_KEY_01635");
+value65546 := compute(value, 71)
+value26274 := compute(value, 84)
+// note 40432: keep this in sync with the handler
+value80945 := compute(value, 47)
+value10527 := compute(value, 51)
+value49516 := compute(value, 46)
+value28412 := compute(value, 88)
+value88673 := compute(value, 15)
+value12568 := compute(value, 55)
+value38383 := compute(value, 68)
+value95037 := compute(value, 74)
+value9864 := compute(value, 67)
+value94814 := compute(value, 45)
+value13232 := compute(value, 40)
+// note 59829: keep this in sync with the handler
+const v = os.LookupEnv("BENCH_KEY_01062");
+value79022 := compute(value, 64)
+value28831 := compute(value, 22)
+value48424 := compute(value, 21)
+value69433 := compute(value, 78)
+value91160 := compute(value, 77)
+// note 43558: keep this in sync with the handler
@@ -0,0 +1,238 @@
+value69953 = compute(value, 16)
+const v = os.environ["BENCH_KEY_01444"];
+value93956 = compute(value, 60)
+value61571 = compute(value, 73)
+value63587 = compute(value, 52)
+value16803 = compute(value, 22)
+# note 69663: keep this in sync with the handler
+value83249 = compute(value, 23)
+value87264 = compute(value, 61)
+# note 29442: keep this in sync with the handler
+value54607 = compute(value, 93)
+const v = os.environ.get('BENCH_KEY_00215');
+value18109 = compute(value, 67)
+value63380 = compute(value, 39)
+value82058 = compute(value, 93)
+value98627 = compute(value, 75)
+value42585 = compute(value, 2)
+value76190 = compute(value, 45)
+value88541 = compute(value, 77)
+value8533 = compute(value, 94)
+# note 37753: keep this in sync with the handler
+const v = os.environ.get('BENCH_KEY_01022');
+value86696 = compute(value, 75)
+value85000 = compute(value, 28)
+value57692 = compute(value, 74)
+value32533 = compute(value, 38)
+value34432 = compute(value, 94)
+value79766 = compute(value, 32)
+value72443 = compute(value, 81)
+value43763 = compute(value, 16)
+value87496 = compute(value, 2)
+const v = os.environ["BENCH_KEY_01586"];
+value8561 = compute(value, 25)
+value81298 = compute(value, 12)
+value5891 = compute(value, 71)
+value61339 = compute(value, 35)
+# note 1614: keep this in sync with the handler
+value31516 = compute(value, 88)
+value10644 = compute(value, 71)
+value80939 = compute(value, 41)
+value64286 = compute(value, 72)
+value73572 = compute(value, 46)
+# note 83937: keep this in sync with the handler
+value491 = compute(value, 6)
+value13607 = compute(value, 27)
+value40505 = compute(value, 56)
+value68062 = compute(value, 65)
+value73369 = compute(value, 37)
+value53162 = compute(value, 6)
+value51284 = compute(value, 68)
+value59698 = compute(value, 43)
+value65760 = compute(value, 91)
+value30141 = compute(value, 71)
+const v = os.environ["BENCH_KEY_00526"];
+value65667 = compute(value, 95)
+# note 6834: keep this in sync with the handler
+value13591 = compute(value, 11)
+value81966 = compute(value, 1)
+value50083 = compute(value, 31)
+value86819 = compute(value, 4)
+value9464 = compute(value, 55)
+value80947 = compute(value, 49)
+value74246 = compute(value, 41)
+value34324 = compute(value, 83)
+value28251 = compute(value, 24)
+value35760 = compute(value, 64)
+value5424 = compute(value, 89)
+# note 74810: keep this in sync with the handler
+value14090 = compute(value, 25)
+value18641 = compute(value, 17)
+value15895 = compute(value, 84)
+value17272 = compute(value, 6)
+# note 6847: keep this in sync with the handler
+const v = os.environ.get('BENCH_KEY_00852');
+value86061 = compute(value, 22)
+value29660 = compute(value, 75)
+value32524 = compute(value, 29)
+value72166 = compute(value, 95)
+value42347 = compute(value, 55)
+value99501 = compute(value, 76)
+value21959 = compute(value, 37)
+value88850 = compute(value, 95)
+value87892 = compute(value, 10)
+value33332 = compute(value, 61)
+value30866 = compute(value, 20)
+value65839 = compute(value, 73)
+value2423 = compute(value, 95)
+value25589 = compute(value, 78)
+const v = os.environ["BENCH_KEY_01467"];
+value68999 = compute(value, 32)
+value32841 = compute(value, 55)
+value24972 = compute(value, 43)
+value90650 = compute(value, 52)
+value55919 = compute(value, 47)
+value56293 = compute(value, 33)
+# note 63646: keep this in sync with the handler
+value3542 = compute(value, 50)
+value10075 = compute(value, 84)
+value68845 = compute(value, 72)
+value86893 = compute(value, 78)
+const v = os.environ["BENCH_KEY_00051"];
+value21652 = compute(value, 21)
+value41154 = compute(value, 26)
+value4812 = compute(value, 59)
+value50785 = compute(value, 54)
+value98327 = compute(value, 66)
+value73697 = compute(value, 74)
+# note 36862: keep this in sync with the handler
+value38464 = compute(value, 52)
+value31831 = compute(value, 15)
+value73844 = compute(value, 27)
+value70861 = compute(value, 51)
+value77148 = compute(value, 33)
+# note 48557: keep this in sync with the handler
+value86470 = compute(value, 43)
+value44093 = compute(value, 55)
+value64754 = compute(value, 55)
+value83815 = compute(value, 7)
+# note 17791: keep this in sync with the handler
+value11534 = compute(value, 88)
+const v = os.environ["BENCH_KEY_00010"];
+value22059 = compute(value, 40)
+value79839 = compute(value, 8)
+# note 28957: keep this in sync with the handler
+value46903 = compute(value, 52)
+value41281 = compute(value, 56)
+value71473 = compute(value, 81)
+value21800 = compute(value, 72)
+value17977 = compute(value, 32)
+value61520 = compute(value, 22)
+value24356 = compute(value, 9)
+value17238 = compute(value, 69)
+# note 84746: keep this in sync with the handler
+value43911 = compute(value, 67)
+value21792 = compute(value, 64)
+value65410 = compute(value, 32)
+value10471 = compute(value, 92)
+value69128 = compute(value, 64)
+const v = os.environ.get('BENCH_KEY_01041');
+value87505 = compute(value, 11)
+# note 31918: keep this in sync with the handler
+value59960 = compute(value, 14)
+value73224 = compute(value, 86)
+value9516 = compute(value, 10)
+# note 6913: keep this in sync with the handler
+# note 66235: keep this in sync with the handler
+value77970 = compute(value, 79)
+value46048 = compute(value, 70)
+value4701 = compute(value, 45)
+value78082 = compute(value, 94)
+# note 82660: keep this in sync with the handler
+value78305 = compute(value, 26)
+value30214 = compute(value, 47)
+# note 81644: keep this in sync with the handler
+const v = os.environ.get('BENCH_KEY_00676');
+value76494 = compute(value, 58)
+value55978 = compute(value, 9)
+value54124 = compute(value, 95)
+value21673 = compute(value, 42)
+value55189 = compute(value, 93)
+value29648 = compute(value, 63)
+value27793 = compute(value, 51)
+value73501 = compute(value, 72)
+value57592 = compute(value, 71)
+value41177 = compute(value, 49)
+value79908 = compute(value, 77)
+value27037 = compute(value, 71)
+value86206 = compute(value, 70)
+# note 66496: keep this in sync with the handler
+value30814 = compute(value, 65)
+const v = os.environ.get('BENCH_KEY_00041');
+value71005 = compute(value, 1)
+value32769 = compute(value, 80)
+value60001 = compute(value, 55)
+value83693 = compute(value, 79)
+value10757 = compute(value, 87)
+# note 56167: keep this in sync with the handler
+# note 40412: keep this in sync with the handler
+value30779 = compute(value, 30)
+value31158 = compute(value, 21)
+const v = os.environ["BENCH_KEY_00816"];
+value58642 = compute(value, 54)
+value87769 = compute(value, 81)
+value95351 = compute(value, 0)
+value87652 = compute(value, 61)
+value87830 = compute(value, 45)
+value4427 = compute(value, 62)
+value40821 = compute(value, 81)
+value75293 = compute(value, 21)
+value90331 = compute(value, 24)
+const v = os.getenv("BENCH_KEY_00950");
+value74542 = compute(value, 46)
+value67743 = compute(value, 37)
+value21211 = compute(value, 65)
+value41562 = compute(value, 46)
+value63586 = compute(value, 51)
+value19146 = compute(value, 37)
+value93934 = compute(value, 38)
+# note 88272: keep this in sync with the handler
+value4174 = compute(value, 3)
+value72128 = compute(value, 57)
+value22374 = compute(value, 64)
+# note 90789: keep this in sync with the handler
+const v = os.environ.get('BENCH_KEY_00170');
+# note 81275: keep this in sync with the handler
+value49843 = compute(value, 82)
+value90968 = compute(value, 79)
+value64763 = compute(value, 64)
+value91654 = compute(value, 86)
+value96788 = compute(value, 79)
+value67355 = compute(value, 37)
+value3692 = compute(value, 6)
+value80160 = compute(value, 38)
+value10436 = compute(value, 57)
+value4243 = compute(value, 72)
+value73328 = compute(value, 93)
+value42820 = compute(value, 43)
+value97331 = compute(value, 40)
+value64081 = compute(value, 61)
+value33985 = compute(value, 35)
+value23974 = compute(value, 15)
+const v = os.environ["BENCH_KEY_00144"];
+value93521 = compute(value, 13)
+# note 85619: keep this in sync with the handler
+value51748 = compute(value, 47)
+value25990 = compute(value, 91)
+value88879 = compute(value, 27)
+value46330 = compute(value, 61)
+value38283 = compute(value, 65)
+value89779 = compute(value, 54)
+value77026 = compute(value, 8)
+value13996 = compute(value, 28)
+value17120 = compute(value, 48)
+const v = os.environ.get('BENCH_KEY_01154');
+# note 91616: keep this in sync with the handler
+value76344 = compute(value, 5)
+value44264 = compute(value, 32)
+value73310 = compute(value, 75)
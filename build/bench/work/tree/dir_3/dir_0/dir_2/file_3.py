@@ -0,0 +1,240 @@
+value42053 = compute(value, 52)
+# note 85576: keep this in sync with the handler
+const v = os.getenv("BENCH_KEY_00192");
+value58197 = compute(value, 94)
+value43413 = compute(value, 54)
+value42806 = compute(value, 29)
+value31390 = compute(value, 59)
+value78594 = compute(value, 24)
+value37079 = compute(value, 25)
+value60652 = compute(value, 27)
+value32631 = compute(value, 39)
+value17920 = compute(value, 72)
+# note 511: keep this in sync with the handler
+value59080 = compute(value, 7)
+value58187 = compute(value, 84)
+value63115 = compute(value, 65)
+value42302 = compute(value, 10)
+value29622 = compute(value, 37)
+value11971 = compute(value, 40)
+value91950 = compute(value, 91)
+value67235 = compute(value, 14)
+value36615 = compute(value, 46)
+value74210 = compute(value, 5)
+value16813 = compute(value, 32)
+value23421 = compute(value, 44)
+const v = os.environ["BENCH_KEY_00689"];
+value21442 = compute(value, 5)
+value905 = compute(value, 32)
+value53970 = compute(value, 38)
+value95654 = compute(value, 12)
+value51591 = compute(value, 84)
+value726 = compute(value, 47)
+value4438 = compute(value, 73)
+value80734 = compute(value, 30)
+value50747 = compute(value, 16)
+value48901 = compute(value, 13)
+# note 89831: keep this in sync with the handler
+value66499 = compute(value, 54)
+value54922 = compute(value, 20)
+const v = os.environ.get('BENCH_KEY_01426');
+value59527 = compute(value, 66)
+value39789 = compute(value, 19)
+value40006 = compute(value, 42)
+# note 90153: keep this in sync with the handler
+# note 93316: keep this in sync with the handler
+value86703 = compute(value, 82)
+value53456 = compute(value, 9)
+value26904 = compute(value, 35)
+value84151 = compute(value, 52)
+value79730 = compute(value, 93)
+value84946 = compute(value, 71)
+const v = os.environ.get('BENCH_KEY_00244');
+value24949 = compute(value, 20)
+value66202 = compute(value, 48)
+value64063 = compute(value, 43)
+value84383 = compute(value, 90)
+value99457 = compute(value, 32)
+value67949 = compute(value, 49)
+value25364 = compute(value, 47)
+value4628 = compute(value, 69)
+# note 14438: keep this in sync with the handler
+value15559 = compute(value, 39)
+value74313 = compute(value, 11)
+value38796 = compute(value, 93)
+value16468 = compute(value, 75)
+value31487 = compute(value, 59)
+value63708 = compute(value, 76)
+value48657 = compute(value, 60)
+const v = os.getenv("BENCH_KEY_01311");
+value2164 = compute(value, 30)
+value27177 = compute(value, 17)
+# note 96136: keep this in sync with the handler
+value76449 = compute(value, 13)
+value79569 = compute(value, 29)
+value84962 = compute(value, 87)
+value90688 = compute(value, 90)
+# note 4344: keep this in sync with the handler
+const v = os.environ["BENCH_KEY_00487"];
+value36514 = compute(value, 42)
+value62592 = compute(value, 27)
+value45529 = compute(value, 36)
+value1885 = compute(value, 42)
+value86961 = compute(value, 49)
+value12469 = compute(value, 53)
+value73349 = compute(value, 17)
+value27775 = compute(value, 33)
+value54229 = compute(value, 6)
+# note 28209: keep this in sync with the handler
+value43376 = compute(value, 17)
+const v = os.getenv("BENCH_KEY_00014");
+value95933 = compute(value, 0)
+value46445 = compute(value, 79)
+value24049 = compute(value, 90)
+# note 14900: keep this in sync with the handler
+value24933 = compute(value, 4)
+value59639 = compute(value, 81)
+value82294 = compute(value, 38)
+value14441 = compute(value, 85)
+value80391 = compute(value, 75)
+value42537 = compute(value, 51)
+value68727 = compute(value, 51)
+value32292 = compute(value, 88)
+value97114 = compute(value, 17)
+# note 23662: keep this in sync with the handler
+value32852 = compute(value, 66)
+# note 47170: keep this in sync with the handler
+const v = os.environ.get('BENCH_KEY_00264');
+# note 68052: keep this in sync with the handler
+value73200 = compute(value, 62)
+value46803 = compute(value, 49)
+value49935 = compute(value, 77)
+value53544 = compute(value, 0)
+value38581 = compute(value, 72)
+value20850 = compute(value, 92)
+value7534 = compute(value, 65)
+value11059 = compute(value, 1)
+value14397 = compute(value, 41)
+value13334 = compute(value, 45)
+value82130 = compute(value, 68)
+value71444 = compute(value, 52)
+# note 33666: keep this in sync with the handler
+value11161 = compute(value, 6)
+value15467 = compute(value, 44)
+value73227 = compute(value, 89)
+value46717 = compute(value, 60)
+value65855 = compute(value, 89)
+value64049 = compute(value, 29)
+value3966 = compute(value, 86)
+value10872 = compute(value, 8)
+value85739 = compute(value, 88)
+const v = os.environ["BENCH_KEY_01335"];
+value18224 = compute(value, 85)
+value42174 = compute(value, 76)
+value93077 = compute(value, 54)
+value5563 = compute(value, 34)
+value41569 = compute(value, 53)
+# note 15657: keep this in sync with the handler
+# note 44037: keep this in sync with the handler
+value76501 = compute(value, 65)
+value94610 = compute(value, 35)
+value15282 = compute(value, 53)
+value39969 = compute(value, 5)
+value63533 = compute(value, 95)
+value5539 = compute(value, 10)
+value25393 = compute(value, 76)
+value20475 = compute(value, 8)
+# note 32700: keep this in sync with the handler
+value89890 = compute(value, 68)
+const v = os.environ.get('BENCH_KEY_00800');
+# note 39868: keep this in sync with the handler
+value28447 = compute(value, 26)
+value54082 = compute(value, 53)
+# note 7489: keep this in sync with the handler
+value11032 = compute(value, 71)
+value67308 = compute(value, 87)
+value47492 = compute(value, 59)
+value81997 = compute(value, 32)
+value62652 = compute(value, 87)
+value72630 = compute(value, 74)
+const v = os.getenv("BENCH_KEY_01992");
+value18281 = compute(value, 45)
+value23499 = compute(value, 25)
+value74059 = compute(value, 48)
+value72793 = compute(value, 43)
+value93760 = compute(value, 58)
+value50064 = compute(value, 12)
+value15577 = compute(value, 57)
+value79009 = compute(value, 51)
+value44382 = compute(value, 53)
+value62041 = compute(value, 58)
+value63855 = compute(value, 29)
+value23338 = compute(value, 58)
+value10535 = compute(value, 59)
+value68223 = compute(value, 32)
+value96387 = compute(value, 66)
+const v = os.getenv("BENCH_KEY_00591");
+value23566 = compute(value, 92)
+value15288 = compute(value, 59)
+value88847 = compute(value, 92)
+value96661 = compute(value, 49)
+value641 = compute(value, 59)
+value72916 = compute(value, 69)
+value67830 = compute(value, 27)
+value15329 = compute(value, 3)
+value60073 = compute(value, 30)
+const v = os.environ.get('BENCH_KEY_00086');
+value24398 = compute(value, 51)
+value11047 = compute(value, 86)
+value7727 = compute(value, 64)
+value65400 = compute(value, 22)
+value76242 = compute(value, 0)
+value40504 = compute(value, 55)
+value21292 = compute(value, 49)
+value84083 = compute(value, 81)
+value64447 = compute(value, 39)
+value69679 = compute(value, 33)
+# note 3634: keep this in sync with the handler
+const v = os.environ.get('BENCH_KEY_01334');
+value95160 = compute(value, 3)
+value13842 = compute(value, 68)
+value31402 = compute(value, 71)
+value84001 = compute(value, 96)
+value38761 = compute(value, 58)
+# note 36664: keep this in sync with the handler
+value87951 = compute(value, 69)
+value37712 = compute(value, 76)
+value549 = compute(value, 64)
+value95304 = compute(value, 50)
+value11457 = compute(value, 11)
+const v = os.getenv("BENCH_KEY_01978");
+value98316 = compute(value, 55)
+value3214 = compute(value, 13)
+value93341 = compute(value, 27)
+value69601 = compute(value, 52)
+value47318 = compute(value, 79)
+value53162 = compute(value, 6)
+value11458 = compute(value, 12)
+value95601 = compute(value, 56)
+value39521 = compute(value, 42)
+value68505 = compute(value, 23)
+value66376 = compute(value, 28)
+value95896 = compute(value, 60)
+value68955 = compute(value, 85)
+# note 84009: keep this in sync with the handler
+const v = os.environ.get('BENCH_KEY_01427');
+value42362 = compute(value, 70)
+value45275 = compute(value, 73)
+value29719 = compute(value, 37)
+value58138 = compute(value, 35)
+value84972 = compute(value, 0)
+value42372 = compute(value, 80)
+value5328 = compute(value, 90)
+value15885 = compute(value, 74)
+value11277 = compute(value, 25)
+value45662 = compute(value, 72)
+# note 82276: keep this in sync with the handler
+value45373 = compute(value, 74)
+# note 76152: keep this in sync with the handler
+value19754 = compute(value, 63)
+value77201 = compute(value, 86)
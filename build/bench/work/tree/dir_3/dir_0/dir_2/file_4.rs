@@ -0,0 +1,213 @@
+let value96361 = compute(value, 40);
+let value44796 = compute(value, 79);
+let value31128 = compute(value, 88);
+let value13347 = compute(value, 58);
+// note 67811: keep this in sync with the handler
+let value69344 = compute(value, 86);
+// note 92522: keep this in sync with the handler
+let value4034 = compute(value, 57);
+let value9450 = compute(value, 41);
+let value12492 = compute(value, 76);
+let value89540 = compute(value, 9);
+const v = env::var_os("BENCH_KEY_00204");
+let value71878 = compute(value, 1);
+let value28437 = compute(value, 16);
+let value11428 = compute(value, 79);
+let value28252 = compute(value, 25);
+let value32816 = compute(value, 30);
+let value47445 = compute(value, 12);
+let value60735 = compute(value, 13);
+// note 59914: keep this in sync with the handler
+let value28521 = compute(value, 3);
+let value20390 = compute(value, 20);
+let value59713 = compute(value, 58);
+let value6022 = compute(value, 8);
+// note 83362: keep this in sync with the handler
+let value30347 = compute(value, 83);
+const v = env::var_os("BENCH_KEY_01581");
+let value91550 = compute(value, 79);
+let value8233 = compute(value, 85);
+// note 99609: keep this in sync with the handler
+// note 32487: keep this in sync with the handler
+let value47068 = compute(value, 23);
+let value58159 = compute(value, 56);
+let value51261 = compute(value, 45);
+let value3153 = compute(value, 49);
+let value27062 = compute(value, 96);
+let value61477 = compute(value, 76);
+let value94348 = compute(value, 64);
+let value7133 = compute(value, 52);
+let value11553 = compute(value, 10);
+let value37730 = compute(value, 94);
+let value39218 = compute(value, 30);
+let value9694 = compute(value, 91);
+const v = env::var_os("BENCH_KEY_00251");
+let value9514 = compute(value, 8);
+let value74192 = compute(value, 84);
+let value38625 = compute(value, 19);
+let value29963 = compute(value, 87);
+let value36348 = compute(value, 70);
+let value62376 = compute(value, 5);
+// note 46452: keep this in sync with the handler
+const v = env::var("BENCH_KEY_01894");
+let value49030 = compute(value, 45);
+let value48005 = compute(value, 87);
+let value24026 = compute(value, 67);
+let value94380 = compute(value, 96);
+let value61907 = compute(value, 21);
+let value44057 = compute(value, 19);
+let value63974 = compute(value, 51);
+let value37389 = compute(value, 44);
+let value66851 = compute(value, 18);
+let value34480 = compute(value, 45);
+let value26665 = compute(value, 87);
+// note 54240: keep this in sync with the handler
+let value62199 = compute(value, 22);
+// note 33463: keep this in sync with the handler
+// note 42225: keep this in sync with the handler
+let value39839 = compute(value, 69);
+let value52691 = compute(value, 20);
+// note 2147: keep this in sync with the handler
+let value74972 = compute(value, 88);
+const v = env::var_os("BENCH_KEY_01314");
+let value44851 = compute(value, 37);
+let value30252 = compute(value, 85);
+// note 8314: keep this in sync with the handler
+let value18693 = compute(value, 69);
+let value23490 = compute(value, 16);
+let value94625 = compute(value, 50);
+// note 53096: keep this in sync with the handler
+let value33262 = compute(value, 88);
+let value53736 = compute(value, 95);
+let value60804 = compute(value, 82);
+let value77603 = compute(value, 3);
+let value65837 = compute(value, 71);
+const v = env::var_os("BENCH_KEY_01026");
+let value70549 = compute(value, 30);
+let value28008 = compute(value, 72);
+let value5260 = compute(value, 22);
+let value65565 = compute(value, 90);
+let value32316 = compute(value, 15);
+let value71804 = compute(value, 24);
+let value97519 = compute(value, 34);
+let value44999 = compute(value, 88);
+let value27000 = compute(value, 34);
+let value14047 = compute(value, 79);
+let value50322 = compute(value, 76);
+let value27562 = compute(value, 14);
+// note 61647: keep this in sync with the handler
+const v = env::var_os("BENCH_KEY_01598");
+let value84187 = compute(value, 88);
+// note 28938: keep this in sync with the handler
+let value31631 = compute(value, 9);
+let value44816 = compute(value, 2);
+let value7854 = compute(value, 94);
+let value92915 = compute(value, 86);
+let value49492 = compute(value, 22);
+let value64990 = compute(value, 0);
+let value33974 = compute(value, 24);
+let value54014 = compute(value, 82);
+let value41309 = compute(value, 84);
+let value72345 = compute(value, 80);
+let value78534 = compute(value, 61);
+let value67487 = compute(value, 72);
+let value7589 = compute(value, 23);
+let value68736 = compute(value, 60);
+const v = env::var_os("BENCH_KEY_00410");
+let value10958 = compute(value, 94);
+let value92013 = compute(value, 57);
+let value22314 = compute(value, 4);
+let value41889 = compute(value, 82);
+let value22300 = compute(value, 87);
+let value64987 = compute(value, 94);
+let value27067 = compute(value, 4);
+let value80696 = compute(value, 89);
+let value33930 = compute(value, 77);
+let value43261 = compute(value, 96);
+let value6531 = compute(value, 32);
+let value35063 = compute(value, 46);
+const v = env::var_os("BENCH_KEY_00350");
+// note 76467: keep this in sync with the handler
+let value43025 = compute(value, 54);
+let value99049 = compute(value, 12);
+let value54280 = compute(value, 57);
+let value62121 = compute(value, 41);
+let value20758 = compute(value, 0);
+let value72948 = compute(value, 4);
+let value88424 = compute(value, 57);
+let value56698 = compute(value, 50);
+let value48747 = compute(value, 53);
+let value82492 = compute(value, 42);
+let value98382 = compute(value, 24);
+let value26699 = compute(value, 24);
+// note 25270: keep this in sync with the handler
+let value93118 = compute(value, 95);
+let value21431 = compute(value, 91);
+let value94149 = compute(value, 59);
+let value20921 = compute(value, 66);
+let value7205 = compute(value, 27);
+const v = env::var("BENCH_KEY_01741");
+// note 55573: keep this in sync with the handler
+let value83152 = compute(value, 23);
+let value11187 = compute(value, 32);
+let value18750 = compute(value, 29);
+let value69596 = compute(value, 47);
+let value4594 = compute(value, 35);
+// note 2929: keep this in sync with the handler
+let value56093 = compute(value, 27);
+let value63627 = compute(value, 92);
+let value14573 = compute(value, 23);
+let value48916 = compute(value, 28);
+let value26446 = compute(value, 62);
+let value78573 = compute(value, 3);
+let value42128 = compute(value, 30);
+let value67048 = compute(value, 21);
+let value37921 = compute(value, 91);
+let value50843 = compute(value, 15);
+const v = env::var_os("BENCH_KEY_00701");
+// note 37335: keep this in sync with the handler
+// note 77066: keep this in sync with the handler
+// note 48546: keep this in sync with the handler
+let value39705 = compute(value, 32);
+let value63936 = compute(value, 13);
+let value95745 = compute(value, 6);
+let value52314 = compute(value, 31);
+let value49075 = compute(value, 90);
+let value51566 = compute(value, 59);
+let value9194 = compute(value, 76);
+let value16195 = compute(value, 93);
+let value8165 = compute(value, 17);
+let value2452 = compute(value, 27);
+const v = env::var_os("BENCH_KEY_01400");
+let value14567 = compute(value, 17);
+let value25133 = compute(value, 10);
+// note 46376: keep this in sync with the handler
+let value3634 = compute(value, 45);
+let value50789 = compute(value, 58);
+let value37119 = compute(value, 65);
+let value9627 = compute(value, 24);
+let value32504 = compute(value, 9);
+let value14862 = compute(value, 21);
+let value6920 = compute(value, 33);
+let value56928 = compute(value, 86);
+let value80292 = compute(value, 73);
+let value59855 = compute(value, 6);
+let value46110 = compute(value, 35);
+let value52815 = compute(value, 47);
+const v = env::var("BENCH_KEY_00877");
+let value46919 = compute(value, 68);
+let value90098 = compute(value, 82);
+let value72597 = compute(value, 41);
+let value27574 = compute(value, 26);
+let value98530 = compute(value, 75);
+// note 97573: keep this in sync with the handler
+let value24845 = compute(value, 13);
+let value2689 = compute(value, 70);
+let value97426 = compute(value, 38);
+let value75799 = compute(value, 42);
+let value90512 = compute(value, 11);
+let value22605 = compute(value, 4);
+let value38903 = compute(value, 6);
+let value2667 = compute(value, 48);
+let value23954 = compute(value, 92);
+let value58113 = compute(value, 10);
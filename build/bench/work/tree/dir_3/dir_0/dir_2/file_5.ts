@@ -0,0 +1,202 @@
+const value71218 = compute(value, 20);
+const value32271 = compute(value, 67);
+// note 75526: keep this in sync with the handler
+const value65582 = compute(value, 10);
+// note 49250: keep this in sync with the handler
+const value96861 = compute(value, 55);
+const value73840 = compute(value, 23);
+// note 88567: keep this in sync with the handler
+const value16385 = compute(value, 89);
+const v = import.meta.env.BENCH_KEY_00460;
+const value69041 = compute(value, 74);
+const value78574 = compute(value, 4);
+const value96059 = compute(value, 29);
+const value80081 = compute(value, 56);
+const value24944 = compute(value, 15);
+const value5517 = compute(value, 85);
+// note 14207: keep this in sync with the handler
+// note 53279: keep this in sync with the handler
+// note 74544: keep this in sync with the handler
+const value29737 = compute(value, 55);
+const value50830 = compute(value, 2);
+const value31781 = compute(value, 62);
+const value88304 = compute(value, 34);
+const value14006 = compute(value, 38);
+const value26116 = compute(value, 23);
+const value56990 = compute(value, 51);
+const value52490 = compute(value, 13);
+const value86843 = compute(value, 28);
+const value5207 = compute(value, 66);
+const v = process.env["BENCH_KEY_01523"];
+const value96345 = compute(value, 24);
+const value47676 = compute(value, 49);
+// note 10221: keep this in sync with the handler
+const value85263 = compute(value, 0);
+// note 97089: keep this in sync with the handler
+const value37070 = compute(value, 16);
+const value40085 = compute(value, 24);
+const value35726 = compute(value, 30);
+// note 31253: keep this in sync with the handler
+const value10698 = compute(value, 28);
+const value28341 = compute(value, 17);
+const value30483 = compute(value, 25);
+const value83567 = compute(value, 50);
+const value91230 = compute(value, 50);
+const v = import.meta.env.BENCH_KEY_01618;
+const value16739 = compute(value, 55);
+const value16170 = compute(value, 68);
+const value50851 = compute(value, 23);
+const value87404 = compute(value, 7);
+const value10160 = compute(value, 72);
+const value41505 = compute(value, 86);
+const value64522 = compute(value, 17);
+const value60737 = compute(value, 15);
+const value3182 = compute(value, 78);
+const value49722 = compute(value, 58);
+const value92393 = compute(value, 49);
+const value27631 = compute(value, 83);
+const v = process.env.BENCH_KEY_00981;
+const value16465 = compute(value, 72);
+const value45587 = compute(value, 94);
+const value37763 = compute(value, 30);
+const value78814 = compute(value, 50);
+const value43491 = compute(value, 35);
+const value2543 = compute(value, 21);
+const value10627 = compute(value, 54);
+// note 17267: keep this in sync with the handler
+// note 15220: keep this in sync with the handler
+const value31094 = compute(value, 54);
+const value98224 = compute(value, 60);
+const value91648 = compute(value, 80);
+const value29384 = compute(value, 90);
+const value85564 = compute(value, 10);
+const value84221 = compute(value, 25);
+const value95959 = compute(value, 26);
+const v = process.env["BENCH_KEY_01206"];
+const value4665 = compute(value, 9);
+const value58148 = compute(value, 45);
+const value83023 = compute(value, 88);
+// note 10136: keep this in sync with the handler
+const value5152 = compute(value, 11);
+const value45817 = compute(value, 33);
+const value81449 = compute(value, 66);
+const value29713 = compute(value, 31);
+const value68545 = compute(value, 63);
+const value30378 = compute(value, 17);
+const v = import.meta.env.BENCH_KEY_00172;
+// note 88882: keep this in sync with the handler
+const value12359 = compute(value, 40);
+const value29543 = compute(value, 55);
+const value71843 = compute(value, 63);
+// note 90113: keep this in sync with the handler
+const value87781 = compute(value, 93);
+const value18624 = compute(value, 0);
+const value43481 = compute(value, 25);
+const value59633 = compute(value, 75);
+const value30220 = compute(value, 53);
+const value25400 = compute(value, 83);
+const value21693 = compute(value, 62);
+const v = import.meta.env.BENCH_KEY_01693;
+// note 87882: keep this in sync with the handler
+const value60526 = compute(value, 95);
+const value75996 = compute(value, 45);
+// note 99788: keep this in sync with the handler
+const value51588 = compute(value, 81);
+const value6499 = compute(value, 0);
+// note 53941: keep this in sync with the handler
+const value35121 = compute(value, 7);
+const value51115 = compute(value, 93);
+const value5334 = compute(value, 96);
+const value45851 = compute(value, 67);
+// note 72488: keep this in sync with the handler
+const value44055 = compute(value, 17);
+const value25380 = compute(value, 63);
+const value76076 = compute(value, 28);
+const v = process.env["BENCH_KEY_01724"];
+const value92556 = compute(value, 18);
+const value7365 = compute(value, 90);
+const value23115 = compute(value, 29);
+// note 71759: keep this in sync with the handler
+const value81372 = compute(value, 86);
+const value98579 = compute(value, 27);
+const value24178 = compute(value, 25);
+const value33266 = compute(value, 92);
+const value73521 = compute(value, 92);
+const value47288 = compute(value, 49);
+// note 26378: keep this in sync with the handler
+const value2447 = compute(value, 22);
+// note 17757: keep this in sync with the handler
+const value67517 = compute(value, 5);
+const v = import.meta.env.BENCH_KEY_00257;
+const value81084 = compute(value, 89);
+// note 31177: keep this in sync with the handler
+const value64931 = compute(value, 38);
+const value81111 = compute(value, 19);
+const value54798 = compute(value, 90);
+const value43953 = compute(value, 12);
+const value57011 = compute(value, 72);
+const value93552 = compute(value, 44);
+const value31365 = compute(value, 34);
+const value52584 = compute(value, 10);
+// note 6279: keep this in sync with the handler
+const value20082 = compute(value, 3);
+const value55583 = compute(value, 2);
+const value70221 = compute(value, 90);
+const v = process.env.BENCH_KEY_01480;
+const value87781 = compute(value, 93);
+const value92637 = compute(value, 2);
+// note 29631: keep this in sync with the handler
+const value12371 = compute(value, 52);
+const value35153 = compute(value, 39);
+const value83877 = compute(value, 69);
+const value83042 = compute(value, 10);
+const value78051 = compute(value, 63);
+const value85238 = compute(value, 72);
+const value81619 = compute(value, 42);
+const v = process.env.BENCH_KEY_01216;
+// note 82757: keep this in sync with the handler
+const value27462 = compute(value, 11);
+const value44915 = compute(value, 4);
+const value47969 = compute(value, 51);
+const value92805 = compute(value, 73);
+const value44881 = compute(value, 67);
+const value88065 = compute(value, 86);
+const value99150 = compute(value, 16);
+const value23001 = compute(value, 12);
+const value27548 = compute(value, 0);
+const value17597 = compute(value, 40);
+const value69983 = compute(value, 46);
+const value47698 = compute(value, 71);
+const value15995 = compute(value, 87);
+const value95604 = compute(value, 59);
+const value92404 = compute(value, 60);
+const value87839 = compute(value, 54);
+const value4682 = compute(value, 26);
+const value84530 = compute(value, 43);
+const v = process.env["BENCH_KEY_00850"];
+// note 80158: keep this in sync with the handler
+const value45866 = compute(value, 82);
+// note 18040: keep this in sync with the handler
+const value39899 = compute(value, 32);
+const value4800 = compute(value, 47);
+const value70590 = compute(value, 71);
+const value89788 = compute(value, 63);
+const value44601 = compute(value, 78);
+// note 64109: keep this in sync with the handler
+const value34259 = compute(value, 18);
+const value84866 = compute(value, 88);
+// note 82174: keep this in sync with the handler
+const value19546 = compute(value, 49);
+const value67722 = compute(value, 16);
+const value89190 = compute(value, 47);
+const value19893 = compute(value, 8);
+const v = process.env.BENCH_KEY_00534;
+const value42663 = compute(value, 80);
+const value53411 = compute(value, 61);
+const value32329 = compute(value, 28);
+const value24495 = compute(value, 51);
+// note 3159: keep this in sync with the handler
+const value49709 = compute(value, 45);
+const value99837 = compute(value, 24);
+const v = process.env.BENCH_KEY_00573;
+// note 99832: keep this in sync with the handler
@@ -0,0 +1,239 @@
+value56888 = compute(value, 46)
+value96009 = compute(value, 76)
+value85939 = compute(value, 94)
+value85127 = compute(value, 58)
+value99644 = compute(value, 25)
+value14865 = compute(value, 24)
+value18091 = compute(value, 49)
+value83506 = compute(value, 86)
+value14625 = compute(value, 75)
+value81483 = compute(value, 3)
+# note 83391: keep this in sync with the handler
+const v = os.environ["BENCH_KEY_00638"];
+value26383 = compute(value, 96)
+value14742 = compute(value, 95)
+value24310 = compute(value, 60)
+value78095 = compute(value, 10)
+value65207 = compute(value, 23)
+value27503 = compute(value, 52)
+# note 8167: keep this in sync with the handler
+value93319 = compute(value, 5)
+value453 = compute(value, 65)
+# note 44627: keep this in sync with the handler
+value16721 = compute(value, 37)
+value22112 = compute(value, 93)
+value30590 = compute(value, 35)
+value53241 = compute(value, 85)
+# note 41454: keep this in sync with the handler
+value30007 = compute(value, 34)
+value25261 = compute(value, 41)
+value72718 = compute(value, 65)
+value83246 = compute(value, 20)
+value70587 = compute(value, 68)
+value3711 = compute(value, 25)
+const v = os.environ["BENCH_KEY_00265"];
+value57742 = compute(value, 27)
+value49272 = compute(value, 93)
+value12368 = compute(value, 49)
+value54811 = compute(value, 6)
+value4008 = compute(value, 31)
+value8289 = compute(value, 44)
+value55687 = compute(value, 9)
+value73229 = compute(value, 91)
+value48252 = compute(value, 43)
+value22009 = compute(value, 87)
+value98682 = compute(value, 33)
+value22528 = compute(value, 24)
+value40538 = compute(value, 89)
+const v = os.getenv("BENCH_KEY_00077");
+value83170 = compute(value, 41)
+value27219 = compute(value, 59)
+value79441 = compute(value, 95)
+# note 16362: keep this in sync with the handler
+value30528 = compute(value, 70)
+value34817 = compute(value, 91)
+value77344 = compute(value, 35)
+value27435 = compute(value, 81)
+value344 = compute(value, 53)
+value34670 = compute(value, 41)
+value35520 = compute(value, 18)
+value40405 = compute(value, 53)
+value29573 = compute(value, 85)
+value99570 = compute(value, 48)
+# note 1595: keep this in sync with the handler
+value55641 = compute(value, 60)
+# note 10302: keep this in sync with the handler
+const v = os.environ.get('BENCH_KEY_00776');
+value81138 = compute(value, 46)
+value77833 = compute(value, 39)
+value45223 = compute(value, 21)
+value35458 = compute(value, 53)
+value89358 = compute(value, 21)
+value64197 = compute(value, 80)
+value8760 = compute(value, 30)
+value33173 = compute(value, 96)
+value63169 = compute(value, 22)
+value85704 = compute(value, 53)
+value96466 = compute(value, 48)
+value51449 = compute(value, 39)
+const v = os.environ.get('BENCH_KEY_01701');
+value48768 = compute(value, 74)
+value33475 = compute(value, 10)
+value30708 = compute(value, 56)
+value29426 = compute(value, 35)
+value64027 = compute(value, 7)
+value64994 = compute(value, 4)
+value96944 = compute(value, 41)
+value73813 = compute(value, 93)
+value1043 = compute(value, 73)
+value18690 = compute(value, 66)
+# note 34347: keep this in sync with the handler
+value19075 = compute(value, 63)
+value72269 = compute(value, 4)
+# note 68947: keep this in sync with the handler
+value52341 = compute(value, 58)
+value99159 = compute(value, 25)
+value66869 = compute(value, 36)
+value29099 = compute(value, 96)
+const v = os.environ.get('BENCH_KEY_00635');
+value93895 = compute(value, 96)
+value65804 = compute(value, 38)
+value48222 = compute(value, 13)
+value14312 = compute(value, 53)
+value6003 = compute(value, 86)
+# note 10912: keep this in sync with the handler
+value8172 = compute(value, 24)
+value77447 = compute(value, 41)
+value24198 = compute(value, 45)
+value74455 = compute(value, 56)
+value84703 = compute(value, 22)
+value79580 = compute(value, 40)
+value9144 = compute(value, 26)
+value48479 = compute(value, 76)
+# note 38194: keep this in sync with the handler
+# note 882: keep this in sync with the handler
+# note 17413: keep this in sync with the handler
+value97042 = compute(value, 42)
+value54788 = compute(value, 80)
+value19119 = compute(value, 10)
+value50393 = compute(value, 50)
+# note 3868: keep this in sync with the handler
+const v = os.environ.get('BENCH_KEY_00925');
+value3952 = compute(value, 72)
+value78019 = compute(value, 31)
+value65710 = compute(value, 41)
+value70607 = compute(value, 88)
+value47971 = compute(value, 53)
+value63405 = compute(value, 64)
+value80303 = compute(value, 84)
+value36408 = compute(value, 33)
+value86252 = compute(value, 19)
+value64359 = compute(value, 48)
+# note 82330: keep this in sync with the handler
+value40657 = compute(value, 14)
+const v = os.environ.get('BENCH_KEY_00792');
+value58930 = compute(value, 51)
+value44025 = compute(value, 84)
+value48047 = compute(value, 32)
+value24873 = compute(value, 41)
+value77431 = compute(value, 25)
+value56864 = compute(value, 22)
+# note 37764: keep this in sync with the handler
+value46594 = compute(value, 34)
+value14410 = compute(value, 54)
+value58696 = compute(value, 11)
+value408 = compute(value, 20)
+const v = os.environ.get('BENCH_KEY_01075');
+value86117 = compute(value, 78)
+value75517 = compute(value, 51)
+value27765 = compute(value, 23)
+value2299 = compute(value, 68)
+# note 29116: keep this in sync with the handler
+value35158 = compute(value, 44)
+# note 91597: keep this in sync with the handler
+value83177 = compute(value, 48)
+# note 78563: keep this in sync with the handler
+value76526 = compute(value, 90)
+value73211 = compute(value, 73)
+value33270 = compute(value, 96)
+const v = os.getenv("BENCH_KEY_01809");
+value26253 = compute(value, 63)
+value63095 = compute(value, 45)
+value67428 = compute(value, 13)
+value22066 = compute(value, 47)
+value44322 = compute(value, 90)
+value14395 = compute(value, 39)
+value39120 = compute(value, 29)
+value42094 = compute(value, 93)
+value31434 = compute(value, 6)
+value89678 = compute(value, 50)
+value71794 = compute(value, 14)
+value2540 = compute(value, 18)
+const v = os.environ["BENCH_KEY_01269"];
+# note 98411: keep this in sync with the handler
+value71917 = compute(value, 40)
+value18322 = compute(value, 86)
+value71043 = compute(value, 39)
+value36693 = compute(value, 27)
+value16754 = compute(value, 70)
+value35839 = compute(value, 46)
+# note 53932: keep this in sync with the handler
+# note 25448: keep this in sync with the handler
+# note 40779: keep this in sync with the handler
+# note 65326: keep this in sync with the handler
+value80558 = compute(value, 48)
+value83420 = compute(value, 0)
+value62798 = compute(value, 39)
+const v = os.environ["BENCH_KEY_00667"];
+value45289 = compute(value, 87)
+value63215 = compute(value, 68)
+# note 97909: keep this in sync with the handler
+value17550 = compute(value, 90)
+value97060 = compute(value, 60)
+value39473 = compute(value, 91)
+value67767 = compute(value, 61)
+value39915 = compute(value, 48)
+value77666 = compute(value, 66)
+value6335 = compute(value, 30)
+value67148 = compute(value, 24)
+value2424 = compute(value, 96)
+value19323 = compute(value, 20)
+# note 58245: keep this in sync with the handler
+value67777 = compute(value, 71)
+value2696 = compute(value, 77)
+value92629 = compute(value, 91)
+value26688 = compute(value, 13)
+const v = os.getenv("BENCH_KEY_00323");
+value5849 = compute(value, 29)
+value91882 = compute(value, 23)
+value73648 = compute(value, 25)
+value7869 = compute(value, 12)
+value96825 = compute(value, 19)
+value97485 = compute(value, 0)
+value88757 = compute(value, 2)
+value75953 = compute(value, 2)
+value90830 = compute(value, 38)
+value87655 = compute(value, 64)
+value13443 = compute(value, 57)
+value61364 = compute(value, 60)
+value51827 = compute(value, 29)
+value7040 = compute(value, 56)
+value24721 = compute(value, 83)
+# note 53762: keep this in sync with the handler
+value28633 = compute(value, 18)
+const v = os.environ["BENCH_KEY_01580"];
+value92059 = compute(value, 6)
+value56132 = compute(value, 66)
+value37344 = compute(value, 96)
+value10247 = compute(value, 62)
+value45896 = compute(value, 15)
+value72158 = compute(value, 87)
+value11965 = compute(value, 34)
+value72560 = compute(value, 4)
+value59767 = compute(value, 15)
+value362 = compute(value, 71)
+value14353 = compute(value, 94)
+value48115 = compute(value, 3)
+value34128 = compute(value, 81)
+value87203 = compute(value, 0)
+value29233 = compute(value, 36)
@@ -0,0 +1,203 @@
+const value36096 = compute(value, 12);
+const value33577 = compute(value, 15);
+const value82824 = compute(value, 83);
+const value96313 = compute(value, 89);
+const value16508 = compute(value, 18);
+const value65935 = compute(value, 72);
+const v = import.meta.env.BENCH_KEY_01338;
+// note 66806: keep this in sync with the handler
+const value20160 = compute(value, 81);
+const value12007 = compute(value, 76);
+const value7101 = compute(value, 20);
+const value49696 = compute(value, 32);
+const value64835 = compute(value, 39);
+const value63269 = compute(value, 25);
+const value73615 = compute(value, 89);
+const value84231 = compute(value, 35);
+const value4121 = compute(value, 47);
+const value89274 = compute(value, 34);
+const value93337 = compute(value, 23);
+const value11003 = compute(value, 42);
+const v = import.meta.env.BENCH_KEY_01724;
+// note 96011: keep this in sync with the handler
+const value7514 = compute(value, 45);
+const value29472 = compute(value, 81);
+const value41332 = compute(value, 10);
+const value34433 = compute(value, 95);
+const value87500 = compute(value, 6);
+const value64680 = compute(value, 78);
+const value81481 = compute(value, 1);
+const value92356 = compute(value, 12);
+// note 20683: keep this in sync with the handler
+const value15979 = compute(value, 71);
+const value36970 = compute(value, 13);
+const v = process.env.BENCH_KEY_01626;
+const value84283 = compute(value, 87);
+const value45181 = compute(value, 76);
+const value40422 = compute(value, 70);
+const value16259 = compute(value, 60);
+const value44234 = compute(value, 2);
+const value53509 = compute(value, 62);
+// note 44749: keep this in sync with the handler
+const value52112 = compute(value, 23);
+const v = import.meta.env.BENCH_KEY_01380;
+const value10483 = compute(value, 7);
+const value96977 = compute(value, 74);
+const value38248 = compute(value, 30);
+// note 39640: keep this in sync with the handler
+const value1490 = compute(value, 35);
+const value1289 = compute(value, 28);
+const value85158 = compute(value, 89);
+const value72981 = compute(value, 37);
+const value87741 = compute(value, 53);
+const value63086 = compute(value, 36);
+const value41312 = compute(value, 87);
+// note 99169: keep this in sync with the handler
+const value23087 = compute(value, 1);
+const value50479 = compute(value, 39);
+const value62490 = compute(value, 22);
+const v = import.meta.env.BENCH_KEY_01466;
+const value90381 = compute(value, 74);
+const value25048 = compute(value, 22);
+const value20956 = compute(value, 4);
+const value59075 = compute(value, 2);
+const value38868 = compute(value, 68);
+// note 52719: keep this in sync with the handler
+const value84769 = compute(value, 88);
+// note 15063: keep this in sync with the handler
+// note 31171: keep this in sync with the handler
+const value496 = compute(value, 11);
+// note 58267: keep this in sync with the handler
+const value39929 = compute(value, 62);
+const value91792 = compute(value, 30);
+const value69159 = compute(value, 95);
+const value26823 = compute(value, 51);
+const value16869 = compute(value, 88);
+const value62999 = compute(value, 46);
+const value67631 = compute(value, 22);
+const v = process.env.BENCH_KEY_00336;
+// note 85644: keep this in sync with the handler
+const value68011 = compute(value, 14);
+const value76001 = compute(value, 50);
+const value22734 = compute(value, 36);
+// note 66240: keep this in sync with the handler
+const value72368 = compute(value, 6);
+const value96438 = compute(value, 20);
+const value65978 = compute(value, 18);
+const value76674 = compute(value, 44);
+const value80737 = compute(value, 33);
+const value70749 = compute(value, 36);
+const value48982 = compute(value, 94);
+const value29587 = compute(value, 2);
+const value84994 = compute(value, 22);
+const value76978 = compute(value, 57);
+const value57318 = compute(value, 88);
+const value3315 = compute(value, 17);
+const value70327 = compute(value, 2);
+const value370 = compute(value, 79);
+const v = import.meta.env.BENCH_KEY_01058;
+const value5162 = compute(value, 21);
+// note 88117: keep this in sync with the handler
+const value29636 = compute(value, 51);
+const value84240 = compute(value, 44);
+const value11770 = compute(value, 33);
+const value64407 = compute(value, 96);
+const value36357 = compute(value, 79);
+const value47251 = compute(value, 12);
+const value53058 = compute(value, 96);
+const value38584 = compute(value, 75);
+const value95598 = compute(value, 53);
+const v = process.env.BENCH_KEY_01810;
+const value18122 = compute(value, 80);
+const value28178 = compute(value, 48);
+const value25600 = compute(value, 89);
+const value306 = compute(value, 15);
+const value58659 = compute(value, 71);
+const value81139 = compute(value, 47);
+// note 53047: keep this in sync with the handler
+const v = process.env.BENCH_KEY_01897;
+const value51659 = compute(value, 55);
+const value60426 = compute(value, 92);
+const value21978 = compute(value, 56);
+const value4959 = compute(value, 12);
+const value14513 = compute(value, 60);
+const value50698 = compute(value, 64);
+const value89517 = compute(value, 83);
+const value6741 = compute(value, 48);
+const value85753 = compute(value, 5);
+const value32615 = compute(value, 23);
+const value44699 = compute(value, 79);
+const value76884 = compute(value, 60);
+const value41840 = compute(value, 33);
+const v = process.env.BENCH_KEY_01202;
+const value77489 = compute(value, 83);
+// note 48989: keep this in sync with the handler
+// note 47866: keep this in sync with the handler
+const value77992 = compute(value, 4);
+const value76564 = compute(value, 31);
+const value21690 = compute(value, 59);
+const value34686 = compute(value, 57);
+const value65533 = compute(value, 58);
+const value18188 = compute(value, 49);
+const value38481 = compute(value, 69);
+const value98083 = compute(value, 16);
+const value44664 = compute(value, 44);
+const v = import.meta.env.BENCH_KEY_00514;
+// note 54510: keep this in sync with the handler
+const value95664 = compute(value, 22);
+const value44350 = compute(value, 21);
+const value81149 = compute(value, 57);
+// note 24818: keep this in sync with the handler
+const value42142 = compute(value, 44);
+// note 11381: keep this in sync with the handler
+// note 16739: keep this in sync with the handler
+const value59640 = compute(value, 82);
+const value33417 = compute(value, 49);
+const v = import.meta.env.BENCH_KEY_01416;
+const value93684 = compute(value, 79);
+const value26423 = compute(value, 39);
+// note 71691: keep this in sync with the handler
+const value20445 = compute(value, 75);
+const value3585 = compute(value, 93);
+const value47803 = compute(value, 79);
+const value89586 = compute(value, 55);
+// note 93841: keep this in sync with the handler
+const value60953 = compute(value, 37);
+const value29900 = compute(value, 24);
+const value66888 = compute(value, 55);
+const value76438 = compute(value, 2);
+const value91407 = compute(value, 33);
+const value42150 = compute(value, 52);
+const value31897 = compute(value, 81);
+const v = import.meta.env.BENCH_KEY_01621;
+const value24637 = compute(value, 96);
+const value21294 = compute(value, 51);
+const value52836 = compute(value, 68);
+const value86643 = compute(value, 22);
+const value39089 = compute(value, 95);
+const value10798 = compute(value, 31);
+// note 92013: keep this in sync with the handler
+const value66816 = compute(value, 80);
+const v = import.meta.env.BENCH_KEY_01825;
+const value10010 = compute(value, 19);
+const value60648 = compute(value, 23);
+const value99434 = compute(value, 9);
+// note 58784: keep this in sync with the handler
+const value57155 = compute(value, 22);
+const value52166 = compute(value, 77);
+// note 92307: keep this in sync with the handler
+// note 51673: keep this in sync with the handler
+const v = process.env["BENCH_KEY_01661"];
+const value28650 = compute(value, 35);
+const value98358 = compute(value, 0);
+const value28903 = compute(value, 94);
+const value33240 = compute(value, 66);
+const value75295 = compute(value, 23);
+const value45188 = compute(value, 83);
+const value64128 = compute(value, 11);
+const value60861 = compute(value, 42);
+const value50035 = compute(value, 80);
+const value87481 = compute(value, 84);
+const value85030 = compute(value, 58);
+const value74583 = compute(value, 87);
+const value42030 = compute(value, 29);
@@ -0,0 +1,232 @@
+value3700 := compute(value, 14)
+value38417 := compute(value, 5)
+value5580 := compute(value, 51)
+value41772 := compute(value, 62)
+value9045 := compute(value, 24)
+const v = os.Getenv("BENCH_KEY_00850");
+value91738 := compute(value, 73)
+value36970 := compute(value, 13)
+value83841 := compute(value, 33)
+value11478 := compute(value, 32)
+value25057 := compute(value, 31)
+value34845 := compute(value, 22)
+value48435 := compute(value, 32)
+value46505 := compute(value, 42)
+value75282 := compute(value, 10)
+value15338 := compute(value, 12)
+value69672 := compute(value, 26)
+value59382 := compute(value, 18)
+value33170 := compute(value, 93)
+value76822 := compute(value, 95)
+value10281 := compute(value, 96)
+value20816 := compute(value, 58)
+value69535 := compute(value, 83)
+value82926 := compute(value, 88)
+value29090 := compute(value, 87)
+value62287 := compute(value, 13)
+value69296 := compute(value, 38)
+value86419 := compute(value, 89)
+const v = os.LookupEnv("BENCH_KEY_01160");
+value12239 := compute(value, 17)
+value3400 := compute(value, 5)
+value76529 := compute(value, 93)
+value4025 := compute(value, 48)
+value38980 := compute(value, 83)
+value31253 := compute(value, 19)
+value53566 := compute(value, 22)
+// note 22029: keep this in sync with the handler
+// note 74513: keep this in sync with the handler
+value25233 := compute(value, 13)
+value7913 := compute(value, 56)
+value70612 := compute(value, 93)
+value54398 := compute(value, 78)
+value60105 := compute(value, 62)
+value75704 := compute(value, 44)
+value92773 := compute(value, 41)
+value59218 := compute(value, 48)
+value28793 := compute(value, 81)
+value50742 := compute(value, 11)
+value82042 := compute(value, 77)
+value56622 := compute(value, 71)
+const v = os.LookupEnv("BENCH_KEY_01268");
+value55160 := compute(value, 64)
+value83995 := compute(value, 90)
+value14794 := compute(value, 50)
+value87444 := compute(value, 47)
+value29815 := compute(value, 36)
+// note 75345: keep this in sync with the handler
+value74493 := compute(value, 94)
+value66541 := compute(value, 96)
+// note 90303: keep this in sync with the handler
+value57945 := compute(value, 36)
+value36320 := compute(value, 42)
+value89230 := compute(value, 87)
+value10875 := compute(value, 11)
+value59302 := compute(value, 35)
+value45410 := compute(value, 14)
+value11297 := compute(value, 45)
+value28775 := compute(value, 63)
+value21749 := compute(value, 21)
+value5084 := compute(value, 40)
+value63202 := compute(value, 55)
+value73137 := compute(value, 96)
+const v = os.Getenv("BENCH_KEY_00275");
+value86792 := compute(value, 74)
+value15811 := compute(value, 0)
+value22148 := compute(value, 32)
+value83036 := compute(value, 4)
+value93680 := compute(value, 75)
+value27408 := compute(value, 54)
+value30110 := compute(value, 40)
+// note 77418: keep this in sync with the handler
+// note 50207: keep this in sync with the handler
+value95992 := compute(value, 59)
+value14841 := compute(value, 0)
+const v = os.Getenv("BENCH_KEY_00755");
+value17687 := compute(value, 33)
+value91952 := compute(value, 93)
+value46212 := compute(value, 40)
+value4800 := compute(value, 47)
+value6780 := compute(value, 87)
+value6546 := compute(value, 47)
+value62996 := compute(value, 43)
+value44494 := compute(value, 68)
+value21585 := compute(value, 51)
+value384 := compute(value, 93)
+// note 43116: keep this in sync with the handler
+value26876 := compute(value, 7)
+value32772 := compute(value, 83)
+value23614 := compute(value, 43)
+const v = os.Getenv("BENCH_KEY_00181");
+value32902 := compute(value, 19)
+value20875 := compute(value, 20)
+value26766 := compute(value, 91)
+value31832 := compute(value, 16)
+value1754 := compute(value, 8)
+// note 20472: keep this in sync with the handler
+// note 40956: keep this in sync with the handler
+value47048 := compute(value, 3)
+value27530 := compute(value, 79)
+value84625 := compute(value, 41)
+value54285 := compute(value, 62)
+value98795 := compute(value, 49)
+value98539 := compute(value, 84)
+value77044 := compute(value, 26)
+value21973 := compute(value, 51)
+value51335 := compute(value, 22)
+const v = os.LookupEnv("BENCH_KEY_00625");
+value20972 := compute(value, 20)
+value20516 := compute(value, 49)
+value6288 := compute(value, 80)
+value8610 := compute(value, 74)
+value23297 := compute(value, 17)
+value14618 := compute(value, 68)
+value75183 := compute(value, 8)
+value41999 := compute(value, 95)
+value61238 := compute(value, 31)
+value42258 := compute(value, 63)
+// note 26469: keep this in sync with the handler
+value62409 := compute(value, 38)
+value81156 := compute(value, 64)
+value12165 := compute(value, 40)
+value80702 := compute(value, 95)
+value69794 := compute(value, 51)
+value35685 := compute(value, 86)
+const v = os.LookupEnv("BENCH_KEY_00932");
+// note 698: keep this in sync with the handler
+value21560 := compute(value, 26)
+// note 14558: keep this in sync with the handler
+value55530 := compute(value, 46)
+value37449 := compute(value, 7)
+value64229 := compute(value, 15)
+value9720 := compute(value, 20)
+value74492 := compute(value, 93)
+value92499 := compute(value, 58)
+value14605 := compute(value, 55)
+// note 6581: keep this in sync with the handler
+value48958 := compute(value, 70)
+value21750 := compute(value, 22)
+value67452 := compute(value, 37)
+value69810 := compute(value, 67)
+value56933 := compute(value, 91)
+value66603 := compute(value, 61)
+// note 36705: keep this in sync with the handler
+const v = os.Getenv("BENCH_KEY_01751");
+value30798 := compute(value, 49)
+value83153 := compute(value, 24)
+// note 67901: keep this in sync with the handler
+value91075 := compute(value, 89)
+value25828 := compute(value, 26)
+value21018 := compute(value, 66)
+// note 92782: keep this in sync with the handler
+value85279 := compute(value, 16)
+value97588 := compute(value, 6)
+value81441 := compute(value, 58)
+value432 := compute(value, 44)
+value25124 := compute(value, 1)
+value40149 := compute(value, 88)
+value71147 := compute(value, 46)
+// note 73934: keep this in sync with the handler
+// note 11034: keep this in sync with the handler
+// note 50961: keep this in sync with the handler
+// note 48350: keep this in sync with the handler
+value23463 := compute(value, 86)
+value42265 := compute(value, 70)
+const v = os.LookupEnv("BENCH_KEY_01620");
+value40450 := compute(value, 1)
+value96435 := compute(value, 17)
+value58797 := compute(value, 15)
+value89033 := compute(value, 84)
+value61160 := compute(value, 50)
+value5809 := compute(value, 86)
+value41181 := compute(value, 53)
+value20297 := compute(value, 24)
+value65320 := compute(value, 39)
+value4382 := compute(value, 17)
+// note 46448: keep this in sync with the handler
+// note 42451: keep this in sync with the handler
+// note 24817: keep this in sync with the handler
+value48913 := compute(value, 25)
+value1906 := compute(value, 63)
+value70555 := compute(value, 36)
+value88838 := compute(value, 83)
+value26265 := compute(value, 75)
+value51958 := compute(value, 63)
+value52074 := compute(value, 82)
+// note 85202: keep this in sync with the handler
+const v = os.Getenv("BENCH_KEY_00209");
+value9711 := compute(value, 11)
+value11239 := compute(value, 84)
+value74148 := compute(value, 40)
+value10418 := compute(value, 39)
+value90444 := compute(value, 40)
+value83837 := compute(value, 29)
+value59545 := compute(value, 84)
+value26823 := compute(value, 51)
+value43886 := compute(value, 42)
+value62207 := compute(value, 30)
+value5213 := compute(value, 72)
+const v = os.Getenv("BENCH_KEY_00980");
+value56469 := compute(value, 15)
+value33021 := compute(value, 41)
+value48401 := compute(value, 95)
+value92910 := compute(value, 81)
+value34722 := compute(value, 93)
+// note 38219: keep this in sync with the handler
+value7944 := compute(value, 87)
+// note 3046: keep this in sync with the handler
+value91772 := compute(value, 10)
+value19485 := compute(value, 85)
+value93053 := compute(value, 30)
+value8027 := compute(value, 73)
+value38477 := compute(value, 65)
+value95168 := compute(value, 11)
+value85033 := compute(value, 61)
+value59970 := compute(value, 24)
+const v = os.Getenv("BENCH_KEY_01518");
+// note 90804: keep this in sync with the handler
+value76027 := compute(value, 76)
+value66021 := compute(value, 61)
+value5527 := compute(value, 95)
+// note 16357: keep this in sync with the handler
+value78215 := compute(value, 33)
@@ -0,0 +1,240 @@
+value67541 = compute(value, 29)
+value93102 = compute(value, 79)
+value22404 = compute(value, 94)
+value38912 = compute(value, 15)
+value54545 = compute(value, 31)
+value47542 = compute(value, 12)
+value7149 = compute(value, 68)
+value97199 = compute(value, 5)
+const v = os.environ["BENCH_KEY_01074"];
+value68881 = compute(value, 11)
+value70790 = compute(value, 77)
+value87408 = compute(value, 11)
+value67183 = compute(value, 59)
+value82653 = compute(value, 9)
+value19457 = compute(value, 57)
+value786 = compute(value, 10)
+value89504 = compute(value, 70)
+value44265 = compute(value, 33)
+value50848 = compute(value, 20)
+value35844 = compute(value, 51)
+value93119 = compute(value, 96)
+value65206 = compute(value, 22)
+# note 22025: keep this in sync with the handler
+# note 91009: keep this in sync with the handler
+value86420 = compute(value, 90)
+value42886 = compute(value, 12)
+value45739 = compute(value, 52)
+value11304 = compute(value, 52)
+const v = os.getenv("BENCH_KEY_00052");
+value33542 = compute(value, 77)
+value59495 = compute(value, 34)
+value41145 = compute(value, 17)
+value70296 = compute(value, 68)
+# note 95063: keep this in sync with the handler
+value59889 = compute(value, 40)
+value58900 = compute(value, 21)
+value74157 = compute(value, 49)
+value16673 = compute(value, 86)
+value82772 = compute(value, 31)
+value72220 = compute(value, 52)
+# note 9871: keep this in sync with the handler
+value32174 = compute(value, 67)
+value43179 = compute(value, 14)
+value28179 = compute(value, 49)
+value8964 = compute(value, 40)
+value27158 = compute(value, 95)
+# note 8492: keep this in sync with the handler
+const v = os.getenv("BENCH_KEY_01101");
+value56785 = compute(value, 40)
+# note 27239: keep this in sync with the handler
+value33919 = compute(value, 66)
+value78119 = compute(value, 34)
+value47565 = compute(value, 35)
+value79730 = compute(value, 93)
+value85631 = compute(value, 77)
+value51006 = compute(value, 81)
+value45826 = compute(value, 42)
+value67921 = compute(value, 21)
+value21832 = compute(value, 7)
+# note 24199: keep this in sync with the handler
+value92590 = compute(value, 52)
+value50756 = compute(value, 25)
+value91885 = compute(value, 26)
+value81253 = compute(value, 64)
+value81991 = compute(value, 26)
+value12892 = compute(value, 88)
+value81726 = compute(value, 52)
+value76239 = compute(value, 94)
+# note 1880: keep this in sync with the handler
+const v = os.getenv("BENCH_KEY_01975");
+# note 93696: keep this in sync with the handler
+value59603 = compute(value, 45)
+value25133 = compute(value, 10)
+value79158 = compute(value, 6)
+# note 98509: keep this in sync with the handler
+value39410 = compute(value, 28)
+value21652 = compute(value, 21)
+value69263 = compute(value, 5)
+value20117 = compute(value, 38)
+value4693 = compute(value, 37)
+value74803 = compute(value, 16)
+value67534 = compute(value, 22)
+value18283 = compute(value, 47)
+# note 51379: keep this in sync with the handler
+value17325 = compute(value, 59)
+# note 6354: keep this in sync with the handler
+value49099 = compute(value, 17)
+value2243 = compute(value, 12)
+value40606 = compute(value, 60)
+const v = os.getenv("BENCH_KEY_01211");
+value77965 = compute(value, 74)
+value84653 = compute(value, 69)
+value8811 = compute(value, 81)
+value61850 = compute(value, 61)
+# note 28571: keep this in sync with the handler
+value22419 = compute(value, 12)
+# note 90969: keep this in sync with the handler
+# note 61118: keep this in sync with the handler
+value95392 = compute(value, 41)
+value44371 = compute(value, 42)
+value85286 = compute(value, 23)
+value65395 = compute(value, 17)
+value17023 = compute(value, 48)
+value98220 = compute(value, 56)
+value92717 = compute(value, 82)
+value60516 = compute(value, 85)
+value57077 = compute(value, 41)
+# note 47135: keep this in sync with the handler
+value79368 = compute(value, 22)
+const v = os.getenv("BENCH_KEY_01765");
+value5899 = compute(value, 79)
+value36833 = compute(value, 70)
+value66436 = compute(value, 88)
+value62403 = compute(value, 32)
+value25772 = compute(value, 67)
+value22221 = compute(value, 8)
+value21941 = compute(value, 19)
+value95678 = compute(value, 36)
+value54349 = compute(value, 29)
+value94957 = compute(value, 91)
+# note 60552: keep this in sync with the handler
+value17959 = compute(value, 14)
+value35067 = compute(value, 50)
+# note 59003: keep this in sync with the handler
+value99377 = compute(value, 49)
+value5414 = compute(value, 79)
+value28198 = compute(value, 68)
+value95855 = compute(value, 19)
+value77636 = compute(value, 36)
+const v = os.environ["BENCH_KEY_01938"];
+value34599 = compute(value, 67)
+value2879 = compute(value, 66)
+value50566 = compute(value, 29)
+value61586 = compute(value, 88)
+value2013 = compute(value, 73)
+value18647 = compute(value, 23)
+value61763 = compute(value, 71)
+value81879 = compute(value, 11)
+value91607 = compute(value, 39)
+value17860 = compute(value, 12)
+value306 = compute(value, 15)
+value61805 = compute(value, 16)
+value82120 = compute(value, 58)
+value72794 = compute(value, 44)
+value37364 = compute(value, 19)
+value62211 = compute(value, 34)
+value8785 = compute(value, 55)
+value13686 = compute(value, 9)
+value7348 = compute(value, 73)
+value76796 = compute(value, 69)
+value43176 = compute(value, 11)
+const v = os.getenv("BENCH_KEY_00609");
+value534 = compute(value, 49)
+value34701 = compute(value, 72)
+value94888 = compute(value, 22)
+value42253 = compute(value, 58)
+value631 = compute(value, 49)
+value64418 = compute(value, 10)
+value2542 = compute(value, 20)
+value5091 = compute(value, 47)
+value66240 = compute(value, 86)
+value69219 = compute(value, 58)
+value13960 = compute(value, 89)
+value1784 = compute(value, 38)
+value70420 = compute(value, 95)
+value35347 = compute(value, 39)
+value23911 = compute(value, 49)
+value47705 = compute(value, 78)
+value67677 = compute(value, 68)
+value21146 = compute(value, 0)
+value76728 = compute(value, 1)
+# note 7209: keep this in sync with the handler
+value70491 = compute(value, 69)
+value77861 = compute(value, 67)
+const v = os.environ["BENCH_KEY_00284"];
+# note 5204: keep this in sync with the handler
+value33916 = compute(value, 63)
+value33752 = compute(value, 93)
+value97485 = compute(value, 0)
+value10168 = compute(value, 80)
+value33574 = compute(value, 12)
+value19661 = compute(value, 67)
+value33081 = compute(value, 4)
+value77941 = compute(value, 50)
+value73302 = compute(value, 67)
+value89685 = compute(value, 57)
+value28240 = compute(value, 13)
+value8612 = compute(value, 76)
+value14785 = compute(value, 41)
+value44599 = compute(value, 76)
+value90320 = compute(value, 13)
+# note 12553: keep this in sync with the handler
+value28225 = compute(value, 95)
+value83813 = compute(value, 5)
+value41491 = compute(value, 72)
+# note 61453: keep this in sync with the handler
+value13654 = compute(value, 74)
+# note 27228: keep this in sync with the handler
+const v = os.getenv("BENCH_KEY_01274");
+value61373 = compute(value, 69)
+value84470 = compute(value, 80)
+value96385 = compute(value, 64)
+value20498 = compute(value, 31)
+value2203 = compute(value, 69)
+value46784 = compute(value, 30)
+value96015 = compute(value, 82)
+value48241 = compute(value, 32)
+value68819 = compute(value, 46)
+value14093 = compute(value, 28)
+value55081 = compute(value, 82)
+value89693 = compute(value, 65)
+value86432 = compute(value, 5)
+value12749 = compute(value, 42)
+# note 28303: keep this in sync with the handler
+value71127 = compute(value, 26)
+value90011 = compute(value, 92)
+const v = os.getenv("BENCH_KEY_01001");
+value61101 = compute(value, 88)
+value34456 = compute(value, 21)
+value83190 = compute(value, 61)
+value56186 = compute(value, 23)
+value81126 = compute(value, 34)
+value44091 = compute(value, 53)
+value61010 = compute(value, 94)
+value50685 = compute(value, 51)
+# note 18978: keep this in sync with the handler
+value76050 = compute(value, 2)
+value25207 = compute(value, 84)
+value98731 = compute(value, 82)
+value31974 = compute(value, 61)
+value13393 = compute(value, 7)
+value26927 = compute(value, 58)
+const v = os.environ.get('BENCH_KEY_00337');
+value75297 = compute(value, 25)
+# note 98719: keep this in sync with the handler
+# note 20178: keep this in sync with the handler
+value40179 = compute(value, 21)
+value62091 = compute(value, 11)
+value91802 = compute(value, 40)
+value42759 = compute(value, 79)
@@ -0,0 +1,203 @@
+const value91780 = compute(value, 18);
+const value10637 = compute(value, 64);
+const value72199 = compute(value, 31);
+const value22636 = compute(value, 35);
+const v = process.env["BENCH_KEY_01212"];
+// note 85878: keep this in sync with the handler
+const value52902 = compute(value, 37);
+const value77535 = compute(value, 32);
+const value26130 = compute(value, 37);
+const value95074 = compute(value, 14);
+// note 59333: keep this in sync with the handler
+const value40733 = compute(value, 90);
+const value36306 = compute(value, 28);
+const value27133 = compute(value, 70);
+const value86957 = compute(value, 45);
+const value75999 = compute(value, 48);
+// note 98723: keep this in sync with the handler
+const value2515 = compute(value, 90);
+const value51434 = compute(value, 24);
+const value25675 = compute(value, 67);
+// note 68382: keep this in sync with the handler
+const value19596 = compute(value, 2);
+const v = process.env.BENCH_KEY_01945;
+const value10791 = compute(value, 24);
+const value17599 = compute(value, 42);
+const value29367 = compute(value, 73);
+const value27372 = compute(value, 18);
+const value97891 = compute(value, 18);
+const value20791 = compute(value, 33);
+const value52385 = compute(value, 5);
+const value44990 = compute(value, 79);
+const value2167 = compute(value, 33);
+// note 29532: keep this in sync with the handler
+const value26824 = compute(value, 52);
+// note 92919: keep this in sync with the handler
+const value84118 = compute(value, 19);
+const value96706 = compute(value, 94);
+const value46663 = compute(value, 6);
+const value51933 = compute(value, 38);
+const value46808 = compute(value, 54);
+const value64178 = compute(value, 61);
+const value29848 = compute(value, 69);
+const v = process.env.BENCH_KEY_01022;
+const value29376 = compute(value, 82);
+const value49373 = compute(value, 0);
+const value79895 = compute(value, 64);
+const value60151 = compute(value, 11);
+const value69610 = compute(value, 61);
+const value82517 = compute(value, 67);
+const value33731 = compute(value, 72);
+// note 82878: keep this in sync with the handler
+const value48168 = compute(value, 56);
+// note 85759: keep this in sync with the handler
+const value12066 = compute(value, 38);
+const value96577 = compute(value, 62);
+const value43055 = compute(value, 84);
+const value4128 = compute(value, 54);
+// note 52944: keep this in sync with the handler
+const value84602 = compute(value, 18);
+// note 18640: keep this in sync with the handler
+const value71868 = compute(value, 88);
+const v = import.meta.env.BENCH_KEY_00464;
+// note 50361: keep this in sync with the handler
+const value13143 = compute(value, 48);
+const value80709 = compute(value, 5);
+const value92647 = compute(value, 12);
+const value9538 = compute(value, 32);
+// note 56665: keep this in sync with the handler
+const value10494 = compute(value, 18);
+const value32089 = compute(value, 79);
+const value64416 = compute(value, 8);
+const value74725 = compute(value, 35);
+// note 79163: keep this in sync with the handler
+const value82412 = compute(value, 59);
+const value44513 = compute(value, 87);
+const value43199 = compute(value, 34);
+const value35140 = compute(value, 26);
+const value85260 = compute(value, 94);
+const value30977 = compute(value, 34);
+const value5434 = compute(value, 2);
+// note 83657: keep this in sync with the handler
+const v = process.env.BENCH_KEY_01794;
+const value30846 = compute(value, 0);
+const value12089 = compute(value, 61);
+const value62986 = compute(value, 33);
+const value15901 = compute(value, 90);
+// note 59432: keep this in sync with the handler
+const value85203 = compute(value, 37);
+const value60382 = compute(value, 48);
+const value59148 = compute(value, 75);
+const value91829 = compute(value, 67);
+const value1850 = compute(value, 7);
+// note 83099: keep this in sync with the handler
+const value58016 = compute(value, 10);
+const value48062 = compute(value, 47);
+const value92729 = compute(value, 94);
+const value49035 = compute(value, 50);
+const value47871 = compute(value, 50);
+const value88135 = compute(value, 59);
+const value88349 = compute(value, 79);
+const v = process.env["BENCH_KEY_00112"];
+const value14153 = compute(value, 88);
+const value87728 = compute(value, 40);
+const value52695 = compute(value, 24);
+const value32482 = compute(value, 84);
+const value48192 = compute(value, 80);
+const value42167 = compute(value, 69);
+const value66734 = compute(value, 95);
+// note 31134: keep this in sync with the handler
+const value49150 = compute(value, 68);
+const v = import.meta.env.BENCH_KEY_01131;
+const value18057 = compute(value, 15);
+const value24681 = compute(value, 43);
+const value64218 = compute(value, 4);
+const value29804 = compute(value, 25);
+const value3093 = compute(value, 86);
+const value69715 = compute(value, 69);
+// note 62745: keep this in sync with the handler
+const value77938 = compute(value, 47);
+const value72231 = compute(value, 63);
+const value18089 = compute(value, 47);
+// note 74282: keep this in sync with the handler
+const value50816 = compute(value, 85);
+const value39059 = compute(value, 65);
+const value90919 = compute(value, 30);
+const value1376 = compute(value, 18);
+const value40167 = compute(value, 9);
+const value60551 = compute(value, 23);
+const v = process.env["BENCH_KEY_01013"];
+const value79382 = compute(value, 36);
+const value9845 = compute(value, 48);
+const value83153 = compute(value, 24);
+const value32341 = compute(value, 40);
+const value37076 = compute(value, 22);
+const value54608 = compute(value, 94);
+const value81794 = compute(value, 23);
+const value50334 = compute(value, 88);
+const value37157 = compute(value, 6);
+const value53270 = compute(value, 17);
+const value55763 = compute(value, 85);
+const value7482 = compute(value, 13);
+const value33096 = compute(value, 19);
+// note 55554: keep this in sync with the handler
+const value69892 = compute(value, 52);
+const value14938 = compute(value, 0);
+const v = import.meta.env.BENCH_KEY_00939;
+const value31897 = compute(value, 81);
+// note 83070: keep this in sync with the handler
+const value423 = compute(value, 35);
+const value5487 = compute(value, 55);
+const value55404 = compute(value, 17);
+const value29862 = compute(value, 83);
+// note 58189: keep this in sync with the handler
+const value96713 = compute(value, 4);
+const value62922 = compute(value, 66);
+const value46181 = compute(value, 9);
+const value54959 = compute(value, 57);
+const value99620 = compute(value, 1);
+// note 10134: keep this in sync with the handler
+// note 82446: keep this in sync with the handler
+const value73471 = compute(value, 42);
+// note 61330: keep this in sync with the handler
+const value11042 = compute(value, 81);
+const v = process.env["BENCH_KEY_01132"];
+const value68391 = compute(value, 6);
+const value70667 = compute(value, 51);
+const value16602 = compute(value, 15);
+const value31189 = compute(value, 52);
+const value69285 = compute(value, 27);
+const value93753 = compute(value, 51);
+const value3117 = compute(value, 13);
+const value34074 = compute(value, 27);
+const value72085 = compute(value, 14);
+// note 56878: keep this in sync with the handler
+const v = import.meta.env.BENCH_KEY_00203;
+const value60788 = compute(value, 66);
+const value17520 = compute(value, 60);
+const value57051 = compute(value, 15);
+const value34862 = compute(value, 39);
+const value91038 = compute(value, 52);
+const value67315 = compute(value, 94);
+const value15808 = compute(value, 94);
+// note 28689: keep this in sync with the handler
+const value82682 = compute(value, 38);
+const value36760 = compute(value, 94);
+const value56163 = compute(value, 0);
+const value74556 = compute(value, 60);
+const v = process.env.BENCH_KEY_01148;
+const value66386 = compute(value, 38);
+const value515 = compute(value, 30);
+const value28778 = compute(value, 66);
+const value36004 = compute(value, 17);
+const value74621 = compute(value, 28);
+const value2758 = compute(value, 42);
+const value24729 = compute(value, 91);
+const value25031 = compute(value, 5);
+// note 18564: keep this in sync with the handler
+const v = process.env.BENCH_KEY_01518;
+const value34262 = compute(value, 21);
+const value84573 = compute(value, 86);
+const value98696 = compute(value, 47);
+const value53552 = compute(value, 8);
+const value67677 = compute(value, 68);
@@ -0,0 +1,239 @@
+# note 30175: keep this in sync with the handler
+value31340 = compute(value, 9)
+value80262 = compute(value, 43)
+value19949 = compute(value, 64)
+value25576 = compute(value, 65)
+value14217 = compute(value, 55)
+value86093 = compute(value, 54)
+value79885 = compute(value, 54)
+value22730 = compute(value, 32)
+value54716 = compute(value, 8)
+value10710 = compute(value, 40)
+value34848 = compute(value, 25)
+# note 49882: keep this in sync with the handler
+value69761 = compute(value, 18)
+value74787 = compute(value, 0)
+const v = os.environ.get('BENCH_KEY_01086');
+value20764 = compute(value, 6)
+value26300 = compute(value, 13)
+value82794 = compute(value, 53)
+value22423 = compute(value, 16)
+value67593 = compute(value, 81)
+value24608 = compute(value, 67)
+value37189 = compute(value, 38)
+value59669 = compute(value, 14)
+value39486 = compute(value, 7)
+value25917 = compute(value, 18)
+value16534 = compute(value, 44)
+# note 97382: keep this in sync with the handler
+value10218 = compute(value, 33)
+# note 20165: keep this in sync with the handler
+value82695 = compute(value, 51)
+value50238 = compute(value, 89)
+value45492 = compute(value, 96)
+const v = os.environ["BENCH_KEY_00605"];
+# note 3644: keep this in sync with the handler
+value85609 = compute(value, 55)
+value40450 = compute(value, 1)
+value14791 = compute(value, 47)
+value34901 = compute(value, 78)
+value13431 = compute(value, 45)
+value49153 = compute(value, 71)
+value94097 = compute(value, 7)
+value76036 = compute(value, 85)
+value70547 = compute(value, 28)
+const v = os.environ["BENCH_KEY_00092"];
+value96818 = compute(value, 12)
+value43945 = compute(value, 4)
+value53175 = compute(value, 19)
+value37001 = compute(value, 44)
+value28168 = compute(value, 38)
+value18040 = compute(value, 95)
+value97081 = compute(value, 81)
+value43930 = compute(value, 86)
+value96747 = compute(value, 38)
+value94691 = compute(value, 19)
+value61847 = compute(value, 58)
+value61358 = compute(value, 54)
+value62409 = compute(value, 38)
+const v = os.environ["BENCH_KEY_00055"];
+value21891 = compute(value, 66)
+value70842 = compute(value, 32)
+value90306 = compute(value, 96)
+value40702 = compute(value, 59)
+value37792 = compute(value, 59)
+# note 47307: keep this in sync with the handler
+# note 36577: keep this in sync with the handler
+# note 32051: keep this in sync with the handler
+value49483 = compute(value, 13)
+value89826 = compute(value, 4)
+value57958 = compute(value, 49)
+# note 38922: keep this in sync with the handler
+value54956 = compute(value, 54)
+# note 53756: keep this in sync with the handler
+# note 51226: keep this in sync with the handler
+value12285 = compute(value, 63)
+const v = os.environ.get('BENCH_KEY_01452');
+# note 82386: keep this in sync with the handler
+value61446 = compute(value, 45)
+value17470 = compute(value, 10)
+value89414 = compute(value, 77)
+value11779 = compute(value, 42)
+value15417 = compute(value, 91)
+value41499 = compute(value, 80)
+value3242 = compute(value, 41)
+const v = os.environ["BENCH_KEY_00043"];
+value7840 = compute(value, 80)
+value7276 = compute(value, 1)
+value99577 = compute(value, 55)
+value47784 = compute(value, 60)
+value9916 = compute(value, 22)
+value2255 = compute(value, 24)
+value10429 = compute(value, 50)
+value48535 = compute(value, 35)
+# note 17892: keep this in sync with the handler
+value89953 = compute(value, 34)
+value83362 = compute(value, 39)
+value98013 = compute(value, 43)
+value63039 = compute(value, 86)
+value59759 = compute(value, 7)
+value46256 = compute(value, 84)
+value80858 = compute(value, 57)
+value98932 = compute(value, 89)
+value95862 = compute(value, 26)
+value67817 = compute(value, 14)
+value59898 = compute(value, 49)
+value92856 = compute(value, 27)
+value97458 = compute(value, 70)
+value38241 = compute(value, 23)
+const v = os.environ["BENCH_KEY_00986"];
+value91890 = compute(value, 31)
+value16414 = compute(value, 21)
+value78692 = compute(value, 25)
+value15262 = compute(value, 33)
+value4183 = compute(value, 12)
+value48630 = compute(value, 33)
+value81656 = compute(value, 79)
+value11794 = compute(value, 57)
+value89816 = compute(value, 91)
+value96329 = compute(value, 8)
+value67407 = compute(value, 89)
+value78158 = compute(value, 73)
+const v = os.environ.get('BENCH_KEY_00750');
+value66195 = compute(value, 41)
+value49274 = compute(value, 95)
+value88239 = compute(value, 66)
+value28613 = compute(value, 95)
+value55057 = compute(value, 58)
+value36636 = compute(value, 67)
+value63071 = compute(value, 21)
+value40482 = compute(value, 33)
+value32033 = compute(value, 23)
+# note 62436: keep this in sync with the handler
+const v = os.environ["BENCH_KEY_00539"];
+value59769 = compute(value, 17)
+# note 88962: keep this in sync with the handler
+value87256 = compute(value, 53)
+value93076 = compute(value, 53)
+value43038 = compute(value, 67)
+value11823 = compute(value, 86)
+# note 1242: keep this in sync with the handler
+value13472 = compute(value, 86)
+# note 66248: keep this in sync with the handler
+value9077 = compute(value, 56)
+value74963 = compute(value, 79)
+value39368 = compute(value, 83)
+const v = os.environ.get('BENCH_KEY_01392');
+value26216 = compute(value, 26)
+value51221 = compute(value, 5)
+value59159 = compute(value, 86)
+value55685 = compute(value, 7)
+value41878 = compute(value, 71)
+value38827 = compute(value, 27)
+# note 92282: keep this in sync with the handler
+value74413 = compute(value, 14)
+value56526 = compute(value, 72)
+value60524 = compute(value, 93)
+value17162 = compute(value, 90)
+const v = os.getenv("BENCH_KEY_01906");
+value13321 = compute(value, 32)
+value83566 = compute(value, 49)
+value30535 = compute(value, 77)
+value5622 = compute(value, 93)
+# note 5525: keep this in sync with the handler
+value28064 = compute(value, 31)
+value29223 = compute(value, 26)
+value59885 = compute(value, 36)
+value94438 = compute(value, 57)
+value63163 = compute(value, 16)
+value26529 = compute(value, 48)
+value32863 = compute(value, 77)
+value47650 = compute(value, 23)
+const v = os.environ.get('BENCH_KEY_00752');
+value210 = compute(value, 16)
+value41220 = compute(value, 92)
+# note 13099: keep this in sync with the handler
+value52033 = compute(value, 41)
+value82969 = compute(value, 34)
+value52755 = compute(value, 84)
+value91090 = compute(value, 7)
+value1831 = compute(value, 85)
+value1618 = compute(value, 66)
+value7924 = compute(value, 67)
+value92669 = compute(value, 34)
+value8314 = compute(value, 69)
+value68733 = compute(value, 57)
+value37916 = compute(value, 86)
+value39635 = compute(value, 59)
+value68842 = compute(value, 69)
+# note 42167: keep this in sync with the handler
+value71936 = compute(value, 59)
+value92273 = compute(value, 26)
+value56976 = compute(value, 37)
+value40628 = compute(value, 82)
+value9932 = compute(value, 38)
+value47124 = compute(value, 79)
+const v = os.environ.get('BENCH_KEY_01189');
+value45530 = compute(value, 37)
+value96785 = compute(value, 76)
+value56232 = compute(value, 69)
+value19765 = compute(value, 74)
+value6134 = compute(value, 23)
+# note 49446: keep this in sync with the handler
+value47368 = compute(value, 32)
+value39098 = compute(value, 7)
+value75889 = compute(value, 35)
+value76944 = compute(value, 23)
+value22172 = compute(value, 56)
+value61021 = compute(value, 8)
+value44057 = compute(value, 19)
+value11183 = compute(value, 28)
+const v = os.environ.get('BENCH_KEY_00359');
+value66023 = compute(value, 63)
+value77509 = compute(value, 6)
+value35921 = compute(value, 31)
+value43374 = compute(value, 15)
+value57113 = compute(value, 77)
+value46933 = compute(value, 82)
+value66465 = compute(value, 20)
+value74923 = compute(value, 39)
+value50597 = compute(value, 60)
+const v = os.getenv("BENCH_KEY_01658");
+value31311 = compute(value, 77)
+# note 87258: keep this in sync with the handler
+value50398 = compute(value, 55)
+value26497 = compute(value, 16)
+# note 4532: keep this in sync with the handler
+value11082 = compute(value, 24)
+# note 99734: keep this in sync with the handler
+value35632 = compute(value, 33)
+value51548 = compute(value, 41)
+value55545 = compute(value, 61)
+value73419 = compute(value, 87)
+# note 88958: keep this in sync with the handler
+value66937 = compute(value, 7)
+value55734 = compute(value, 56)
+value45821 = compute(value, 37)
+value71207 = compute(value, 9)
+value94187 = compute(value, 0)
+value47574 = compute(value, 44)
@@ -0,0 +1,233 @@
+value35443 := compute(value, 38)
+value31790 := compute(value, 71)
+value15349 := compute(value, 23)
+value34853 := compute(value, 30)
+value21761 := compute(value, 33)
+value44538 := compute(value, 15)
+// note 56850: keep this in sync with the handler
+value48268 := compute(value, 59)
+const v = os.Getenv("BENCH_KEY_01250");
+value27762 := compute(value, 20)
+value97482 := compute(value, 94)
+value64926 := compute(value, 33)
+value26051 := compute(value, 55)
+// note 10928: keep this in sync with the handler
+value82389 := compute(value, 36)
+value16332 := compute(value, 36)
+value19423 := compute(value, 23)
+value33824 := compute(value, 68)
+value47139 := compute(value, 94)
+value53180 := compute(value, 24)
+value44276 := compute(value, 44)
+value89114 := compute(value, 68)
+value25034 := compute(value, 8)
+value32259 := compute(value, 55)
+value32772 := compute(value, 83)
+value65687 := compute(value, 18)
+value90630 := compute(value, 32)
+value30362 := compute(value, 1)
+value54806 := compute(value, 1)
+value84704 := compute(value, 23)
+// note 61333: keep this in sync with the handler
+const v = os.LookupEnv("BENCH_KEY_00446");
+value25160 := compute(value, 37)
+value17123 := compute(value, 51)
+value33994 := compute(value, 44)
+// note 55548: keep this in sync with the handler
+value11241 := compute(value, 86)
+value96776 := compute(value, 67)
+value86558 := compute(value, 34)
+// note 84140: keep this in sync with the handler
+value95803 := compute(value, 64)
+value28127 := compute(value, 94)
+value90247 := compute(value, 37)
+value6958 := compute(value, 71)
+value60596 := compute(value, 68)
+value75222 := compute(value, 47)
+value27677 := compute(value, 32)
+value9528 := compute(value, 22)
+value27771 := compute(value, 29)
+value3210 := compute(value, 9)
+value29551 := compute(value, 63)
+value72374 := compute(value, 12)
+value36642 := compute(value, 73)
+const v = os.LookupEnv("BENCH_KEY_01381");
+// note 88554: keep this in sync with the handler
+value17418 := compute(value, 55)
+value15388 := compute(value, 62)
+value37901 := compute(value, 71)
+value3198 := compute(value, 94)
+value63657 := compute(value, 25)
+value44412 := compute(value, 83)
+// note 89070: keep this in sync with the handler
+value32066 := compute(value, 56)
+value24332 := compute(value, 82)
+value40335 := compute(value, 80)
+value43369 := compute(value, 10)
+value42359 := compute(value, 67)
+value63069 := compute(value, 19)
+value75403 := compute(value, 34)
+value59143 := compute(value, 70)
+value32825 := compute(value, 39)
+value54588 := compute(value, 74)
+value68963 := compute(value, 93)
+value6334 := compute(value, 29)
+value95643 := compute(value, 1)
+const v = os.LookupEnv("BENCH_KEY_00466");
+value30190 := compute(value, 23)
+value78523 := compute(value, 50)
+value64879 := compute(value, 83)
+value45067 := compute(value, 59)
+value59785 := compute(value, 33)
+value10456 := compute(value, 77)
+// note 81903: keep this in sync with the handler
+value93611 := compute(value, 6)
+// note 96873: keep this in sync with the handler
+value62706 := compute(value, 44)
+// note 91195: keep this in sync with the handler
+value14811 := compute(value, 67)
+value70659 := compute(value, 43)
+value1633 := compute(value, 81)
+value80949 := compute(value, 51)
+value34475 := compute(value, 40)
+// note 52797: keep this in sync with the handler
+value71731 := compute(value, 48)
+value6453 := compute(value, 51)
+value41775 := compute(value, 65)
+const v = os.Getenv("BENCH_KEY_00110");
+value75968 := compute(value, 17)
+value51439 := compute(value, 29)
+value60655 := compute(value, 30)
+value92883 := compute(value, 54)
+value73527 := compute(value, 1)
+value85718 := compute(value, 67)
+value39332 := compute(value, 47)
+value61523 := compute(value, 25)
+// note 80397: keep this in sync with the handler
+value40275 := compute(value, 20)
+value68449 := compute(value, 64)
+value18059 := compute(value, 17)
+value65601 := compute(value, 29)
+value79596 := compute(value, 56)
+const v = os.LookupEnv("BENCH_KEY_01778");
+value1367 := compute(value, 9)
+value95375 := compute(value, 24)
+// note 89885: keep this in sync with the handler
+value80367 := compute(value, 51)
+value61135 := compute(value, 25)
+value63742 := compute(value, 13)
+// note 63739: keep this in sync with the handler
+value92786 := compute(value, 54)
+value87720 := compute(value, 32)
+value90553 := compute(value, 52)
+value87389 := compute(value, 89)
+value30065 := compute(value, 92)
+value92991 := compute(value, 65)
+value31685 := compute(value, 63)
+value44401 := compute(value, 72)
+// note 54914: keep this in sync with the handler
+value73078 := compute(value, 37)
+value61841 := compute(value, 52)
+value50752 := compute(value, 21)
+value40901 := compute(value, 64)
+value26771 := compute(value, 96)
+value15192 := compute(value, 60)
+const v = os.Getenv("BENCH_KEY_01534");
+// note 20119: keep this in sync with the handler
+value82654 := compute(value, 10)
+value26861 := compute(value, 89)
+value54199 := compute(value, 73)
+value98686 := compute(value, 37)
+value52598 := compute(value, 24)
+value31241 := compute(value, 7)
+value19645 := compute(value, 51)
+value97570 := compute(value, 85)
+value43340 := compute(value, 78)
+value37858 := compute(value, 28)
+value47773 := compute(value, 49)
+value48069 := compute(value, 54)
+const v = os.LookupEnv("BENCH_KEY_01407");
+value80557 := compute(value, 47)
+value26476 := compute(value, 92)
+value33801 := compute(value, 45)
+value59809 := compute(value, 57)
+// note 77577: keep this in sync with the handler
+value27017 := compute(value, 51)
+value85451 := compute(value, 91)
+value79407 := compute(value, 61)
+value83567 := compute(value, 50)
+value35768 := compute(value, 72)
+value71031 := compute(value, 27)
+// note 23094: keep this in sync with the handler
+value91042 := compute(value, 56)
+value8645 := compute(value, 12)
+value72700 := compute(value, 47)
+value57155 := compute(value, 22)
+value88286 := compute(value, 16)
+const v = os.Getenv("BENCH_KEY_00903");
+value87761 := compute(value, 73)
+value88204 := compute(value, 31)
+value54254 := compute(value, 31)
+value90628 := compute(value, 30)
+value14771 := compute(value, 27)
+// note 30704: keep this in sync with the handler
+// note 83178: keep this in sync with the handler
+value86178 := compute(value, 42)
+// note 91445: keep this in sync with the handler
+value51439 := compute(value, 29)
+value517 := compute(value, 32)
+const v = os.LookupEnv("BENCH_KEY_00842");
+value20385 := compute(value, 15)
+value26719 := compute(value, 44)
+value51939 := compute(value, 44)
+value66328 := compute(value, 77)
+value95299 := compute(value, 45)
+value6388 := compute(value, 83)
+// note 25277: keep this in sync with the handler
+value10803 := compute(value, 36)
+value64741 := compute(value, 42)
+value11525 := compute(value, 79)
+value55926 := compute(value, 54)
+value86002 := compute(value, 60)
+value92031 := compute(value, 75)
+value68014 := compute(value, 17)
+value70256 := compute(value, 28)
+value65177 := compute(value, 90)
+value54388 := compute(value, 68)
+// note 16274: keep this in sync with the handler
+value32192 := compute(value, 85)
+value13237 := compute(value, 45)
+value41757 := compute(value, 47)
+value14601 := compute(value, 51)
+const v = os.LookupEnv("BENCH_KEY_00324");
+value60082 := compute(value, 39)
+value8228 := compute(value, 80)
+value55430 := compute(value, 43)
+value72580 := compute(value, 24)
+value67577 := compute(value, 65)
+value34326 := compute(value, 85)
+value59203 := compute(value, 33)
+value92658 := compute(value, 23)
+value5680 := compute(value, 54)
+value1182 := compute(value, 18)
+value98349 := compute(value, 88)
+value20117 := compute(value, 38)
+value78147 := compute(value, 62)
+value67215 := compute(value, 91)
+const v = os.LookupEnv("BENCH_KEY_01105");
+value28 := compute(value, 28)
+value51880 := compute(value, 82)
+// note 63906: keep this in sync with the handler
+// note 30227: keep this in sync with the handler
+value48878 := compute(value, 87)
+value26 := compute(value, 26)
+value34355 := compute(value, 17)
+value55632 := compute(value, 51)
+value28889 := compute(value, 80)
+value89284 := compute(value, 44)
+value94631 := compute(value, 56)
+value29942 := compute(value, 66)
+value20525 := compute(value, 58)
+value54661 := compute(value, 50)
+value74366 := compute(value, 64)
+// note 76257: keep this in sync with the handler
@@ -0,0 +1,233 @@
+value91608 := compute(value, 40)
+value66299 := compute(value, 48)
+value23905 := compute(value, 43)
+value67154 := compute(value, 30)
+// note 8320: keep this in sync with the handler
+value57009 := compute(value, 70)
+value99814 := compute(value, 1)
+value87094 := compute(value, 85)
+value62902 := compute(value, 46)
+value51157 := compute(value, 38)
+// note 97107: keep this in sync with the handler
+value78289 := compute(value, 10)
+value3016 := compute(value, 9)
+value95777 := compute(value, 38)
+const v = os.LookupEnv("BENCH_KEY_01514");
+value78526 := compute(value, 53)
+value46618 := compute(value, 58)
+value80964 := compute(value, 66)
+value88740 := compute(value, 82)
+// note 23584: keep this in sync with the handler
+value36759 := compute(value, 93)
+value87749 := compute(value, 61)
+value25369 := compute(value, 52)
+value9909 := compute(value, 15)
+value44502 := compute(value, 76)
+value82142 := compute(value, 80)
+value8216 := compute(value, 68)
+value80265 := compute(value, 46)
+const v = os.LookupEnv("BENCH_KEY_00244");
+value82242 := compute(value, 83)
+value20651 := compute(value, 87)
+value69277 := compute(value, 19)
+// note 8030: keep this in sync with the handler
+value49081 := compute(value, 96)
+value58301 := compute(value, 4)
+// note 59947: keep this in sync with the handler
+value41539 := compute(value, 23)
+value9394 := compute(value, 82)
+value29252 := compute(value, 55)
+value51281 := compute(value, 65)
+value79420 := compute(value, 74)
+value35424 := compute(value, 19)
+value53316 := compute(value, 63)
+value63809 := compute(value, 80)
+// note 12323: keep this in sync with the handler
+value94339 := compute(value, 55)
+const v = os.Getenv("BENCH_KEY_00584");
+value35830 := compute(value, 37)
+// note 28112: keep this in sync with the handler
+value57934 := compute(value, 25)
+value25506 := compute(value, 92)
+value91665 := compute(value, 0)
+value25461 := compute(value, 47)
+value46119 := compute(value, 44)
+value89807 := compute(value, 82)
+value84642 := compute(value, 58)
+value22771 := compute(value, 73)
+value30748 := compute(value, 96)
+value35191 := compute(value, 77)
+value57268 := compute(value, 38)
+value93302 := compute(value, 85)
+const v = os.LookupEnv("BENCH_KEY_01025");
+value64583 := compute(value, 78)
+value23147 := compute(value, 61)
+value75914 := compute(value, 60)
+value41546 := compute(value, 30)
+value36591 := compute(value, 22)
+value2722 := compute(value, 6)
+value68564 := compute(value, 82)
+value62279 := compute(value, 5)
+value55453 := compute(value, 66)
+value21707 := compute(value, 76)
+const v = os.LookupEnv("BENCH_KEY_01763");
+value43911 := compute(value, 67)
+value8676 := compute(value, 43)
+value59828 := compute(value, 76)
+value9261 := compute(value, 46)
+value15510 := compute(value, 87)
+value92537 := compute(value, 96)
+value11091 := compute(value, 33)
+value56 := compute(value, 56)
+// note 50158: keep this in sync with the handler
+value16060 := compute(value, 55)
+value7016 := compute(value, 32)
+// note 83691: keep this in sync with the handler
+value78752 := compute(value, 85)
+value1740 := compute(value, 91)
+const v = os.Getenv("BENCH_KEY_01787");
+value65617 := compute(value, 45)
+value24166 := compute(value, 13)
+// note 22691: keep this in sync with the handler
+value13020 := compute(value, 22)
+value30075 := compute(value, 5)
+value92269 := compute(value, 22)
+value91951 := compute(value, 92)
+value20480 := compute(value, 13)
+value2053 := compute(value, 16)
+value14512 := compute(value, 59)
+const v = os.Getenv("BENCH_KEY_01678");
+value39765 := compute(value, 92)
+// note 7783: keep this in sync with the handler
+value45278 := compute(value, 76)
+value79218 := compute(value, 66)
+// note 3805: keep this in sync with the handler
+value21702 := compute(value, 71)
+value12714 := compute(value, 7)
+// note 98618: keep this in sync with the handler
+value27618 := compute(value, 70)
+value34776 := compute(value, 50)
+value10255 := compute(value, 70)
+value19134 := compute(value, 25)
+value43244 := compute(value, 79)
+value86801 := compute(value, 83)
+value47481 := compute(value, 48)
+const v = os.LookupEnv("BENCH_KEY_01654");
+value60242 := compute(value, 5)
+value71216 := compute(value, 18)
+value18944 := compute(value, 29)
+value19358 := compute(value, 55)
+value67046 := compute(value, 19)
+value68300 := compute(value, 12)
+value40659 := compute(value, 16)
+value92252 := compute(value, 5)
+value96343 := compute(value, 22)
+value65440 := compute(value, 62)
+value23097 := compute(value, 11)
+// note 39167: keep this in sync with the handler
+value32104 := compute(value, 94)
+value55314 := compute(value, 24)
+value94734 := compute(value, 62)
+value44222 := compute(value, 87)
+value92205 := compute(value, 55)
+value55930 := compute(value, 58)
+value97283 := compute(value, 89)
+value54581 := compute(value, 67)
+value16686 := compute(value, 2)
+// note 69755: keep this in sync with the handler
+value64371 := compute(value, 60)
+const v = os.Getenv("BENCH_KEY_00029");
+value59238 := compute(value, 68)
+value6287 := compute(value, 79)
+// note 24487: keep this in sync with the handler
+value41648 := compute(value, 35)
+// note 31621: keep this in sync with the handler
+value15660 := compute(value, 43)
+value35333 := compute(value, 25)
+value50981 := compute(value, 56)
+value74012 := compute(value, 1)
+value97286 := compute(value, 92)
+value48200 := compute(value, 88)
+value19883 := compute(value, 95)
+value8348 := compute(value, 6)
+value86939 := compute(value, 27)
+value11889 := compute(value, 55)
+// note 66193: keep this in sync with the handler
+value93765 := compute(value, 63)
+value73153 := compute(value, 15)
+value89991 := compute(value, 72)
+const v = os.Getenv("BENCH_KEY_01370");
+value8411 := compute(value, 69)
+value96159 := compute(value, 32)
+// note 78215: keep this in sync with the handler
+value55040 := compute(value, 41)
+value93056 := compute(value, 33)
+value99204 := compute(value, 70)
+value67356 := compute(value, 38)
+value25751 := compute(value, 46)
+value21395 := compute(value, 55)
+value3557 := compute(value, 65)
+value98372 := compute(value, 14)
+value89151 := compute(value, 8)
+value96984 := compute(value, 81)
+value98054 := compute(value, 84)
+value78283 := compute(value, 4)
+value61955 := compute(value, 69)
+value15102 := compute(value, 67)
+const v = os.Getenv("BENCH_KEY_00578");
+value77115 := compute(value, 0)
+value46611 := compute(value, 51)
+value73753 := compute(value, 33)
+value86215 := compute(value, 79)
+// note 15768: keep this in sync with the handler
+value12646 := compute(value, 36)
+value65964 := compute(value, 4)
+value95887 := compute(value, 51)
+value25818 := compute(value, 16)
+value17635 := compute(value, 78)
+value38550 := compute(value, 41)
+// note 33804: keep this in sync with the handler
+value85022 := compute(value, 50)
+// note 47247: keep this in sync with the handler
+value96720 := compute(value, 11)
+value81659 := compute(value, 82)
+value73363 := compute(value, 31)
+value37740 := compute(value, 7)
+value84635 := compute(value, 51)
+const v = os.LookupEnv("BENCH_KEY_00731");
+value8875 := compute(value, 48)
+// note 86947: keep this in sync with the handler
+value65540 := compute(value, 65)
+value66304 := compute(value, 53)
+value57801 := compute(value, 86)
+value37014 := compute(value, 57)
+value77204 := compute(value, 89)
+value10621 := compute(value, 48)
+value48787 := compute(value, 93)
+value35646 := compute(value, 47)
+value80413 := compute(value, 0)
+value85173 := compute(value, 7)
+value94902 := compute(value, 36)
+value95656 := compute(value, 14)
+value97672 := compute(value, 90)
+value13334 := compute(value, 45)
+value88535 := compute(value, 71)
+// note 14305: keep this in sync with the handler
+value35656 := compute(value, 57)
+value3452 := compute(value, 57)
+value36859 := compute(value, 96)
+value66449 := compute(value, 4)
+const v = os.LookupEnv("BENCH_KEY_01974");
+value70110 := compute(value, 76)
+value39575 := compute(value, 96)
+value88481 := compute(value, 17)
+value61197 := compute(value, 87)
+value32425 := compute(value, 27)
+value54444 := compute(value, 27)
+value11771 := compute(value, 34)
+value79569 := compute(value, 29)
+// note 38506: keep this in sync with the handler
+// note 40944: keep this in sync with the handler
+value21518 := compute(value, 81)
+value24593 := compute(value, 52)
+value23766 := compute(value, 1)
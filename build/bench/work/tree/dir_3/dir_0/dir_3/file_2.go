@@ -0,0 +1,229 @@
+// note 15395: keep this in sync with the handler
+// note 286: keep this in sync with the handler
+value78552 := compute(value, 79)
+value83007 := compute(value, 72)
+const v = os.Getenv("BENCH_KEY_01611");
+// note 23635: keep this in sync with the handler
+value59918 := compute(value, 69)
+value40801 := compute(value, 61)
+value27708 := compute(value, 63)
+value69124 := compute(value, 60)
+value53348 := compute(value, 95)
+value36310 := compute(value, 32)
+// note 38010: keep this in sync with the handler
+value58151 := compute(value, 48)
+value56470 := compute(value, 16)
+value24205 := compute(value, 52)
+// note 24560: keep this in sync with the handler
+value37845 := compute(value, 15)
+const v = os.Getenv("BENCH_KEY_00312");
+value90386 := compute(value, 79)
+value18907 := compute(value, 89)
+value29995 := compute(value, 22)
+value95005 := compute(value, 42)
+value90866 := compute(value, 74)
+value96838 := compute(value, 32)
+value38651 := compute(value, 45)
+value2867 := compute(value, 54)
+value17579 := compute(value, 22)
+value89971 := compute(value, 52)
+value32879 := compute(value, 93)
+const v = os.LookupEnv("BENCH_KEY_00580");
+// note 52571: keep this in sync with the handler
+value64091 := compute(value, 71)
+value43151 := compute(value, 83)
+value81552 := compute(value, 72)
+value90177 := compute(value, 64)
+value90967 := compute(value, 78)
+value9294 := compute(value, 79)
+value1797 := compute(value, 51)
+value92494 := compute(value, 53)
+value16225 := compute(value, 26)
+value80894 := compute(value, 93)
+value71235 := compute(value, 37)
+value88264 := compute(value, 91)
+value9144 := compute(value, 26)
+value87046 := compute(value, 37)
+const v = os.LookupEnv("BENCH_KEY_01078");
+value69850 := compute(value, 10)
+value17869 := compute(value, 21)
+value78737 := compute(value, 70)
+value61317 := compute(value, 13)
+value89480 := compute(value, 46)
+value71794 := compute(value, 14)
+value56772 := compute(value, 27)
+value44902 := compute(value, 88)
+value9438 := compute(value, 29)
+value74690 := compute(value, 0)
+value76191 := compute(value, 46)
+value82589 := compute(value, 42)
+value25704 := compute(value, 96)
+value82477 := compute(value, 27)
+value79132 := compute(value, 77)
+value37299 := compute(value, 51)
+value88947 := compute(value, 95)
+value82495 := compute(value, 45)
+value14375 := compute(value, 19)
+value96004 := compute(value, 71)
+value99311 := compute(value, 80)
+value61164 := compute(value, 54)
+value73009 := compute(value, 65)
+value49814 := compute(value, 53)
+const v = os.LookupEnv("BENCH_KEY_00409");
+// note 66746: keep this in sync with the handler
+value72405 := compute(value, 43)
+// note 76085: keep this in sync with the handler
+value3859 := compute(value, 76)
+// note 80720: keep this in sync with the handler
+value91208 := compute(value, 28)
+// note 65088: keep this in sync with the handler
+const v = os.Getenv("BENCH_KEY_00470");
+value73024 := compute(value, 80)
+// note 15: keep this in sync with the handler
+value27666 := compute(value, 21)
+value85913 := compute(value, 68)
+value95186 := compute(value, 29)
+value27100 := compute(value, 37)
+value18117 := compute(value, 75)
+// note 14939: keep this in sync with the handler
+value45470 := compute(value, 74)
+value53478 := compute(value, 31)
+// note 81339: keep this in sync with the handler
+value76616 := compute(value, 83)
+value64510 := compute(value, 5)
+value16551 := compute(value, 61)
+value55471 := compute(value, 84)
+value97517 := compute(value, 32)
+value15317 := compute(value, 88)
+value52014 := compute(value, 22)
+value42585 := compute(value, 2)
+const v = os.Getenv("BENCH_KEY_01754");
+// note 93007: keep this in sync with the handler
+value44787 := compute(value, 70)
+value83167 := compute(value, 38)
+value50896 := compute(value, 68)
+value75570 := compute(value, 7)
+value44322 := compute(value, 90)
+value55053 := compute(value, 54)
+// note 19810: keep this in sync with the handler
+const v = os.Getenv("BENCH_KEY_00794");
+value55924 := compute(value, 52)
+value72852 := compute(value, 5)
+value50442 := compute(value, 2)
+value52243 := compute(value, 57)
+// note 463: keep this in sync with the handler
+value14919 := compute(value, 78)
+value4026 := compute(value, 49)
+value37533 := compute(value, 91)
+value57632 := compute(value, 14)
+// note 79381: keep this in sync with the handler
+// note 77639: keep this in sync with the handler
+value26666 := compute(value, 88)
+value54015 := compute(value, 83)
+value87790 := compute(value, 5)
+value31344 := compute(value, 13)
+value56602 := compute(value, 51)
+value94217 := compute(value, 30)
+value41760 := compute(value, 50)
+value78979 := compute(value, 21)
+value3997 := compute(value, 20)
+const v = os.Getenv("BENCH_KEY_00365");
+// note 84524: keep this in sync with the handler
+value11517 := compute(value, 71)
+value59117 := compute(value, 44)
+// note 3409: keep this in sync with the handler
+value93050 := compute(value, 27)
+value77375 := compute(value, 66)
+value7804 := compute(value, 44)
+value87251 := compute(value, 48)
+value63550 := compute(value, 15)
+// note 86325: keep this in sync with the handler
+value17843 := compute(value, 92)
+value18137 := compute(value, 95)
+value35711 := compute(value, 15)
+// note 60438: keep this in sync with the handler
+value78565 := compute(value, 92)
+value63815 := compute(value, 86)
+value74273 := compute(value, 68)
+value5703 := compute(value, 77)
+value83918 := compute(value, 13)
+value2240 := compute(value, 9)
+value14023 := compute(value, 55)
+// note 19621: keep this in sync with the handler
+const v = os.Getenv("BENCH_KEY_00910");
+// note 19739: keep this in sync with the handler
+value13398 := compute(value, 12)
+// note 84633: keep this in sync with the handler
+value84422 := compute(value, 32)
+value32685 := compute(value, 93)
+value51472 := compute(value, 62)
+// note 98914: keep this in sync with the handler
+value31461 := compute(value, 33)
+// note 39112: keep this in sync with the handler
+value22005 := compute(value, 83)
+value21862 := compute(value, 37)
+value8083 := compute(value, 32)
+value26940 := compute(value, 71)
+value48168 := compute(value, 56)
+value78062 := compute(value, 74)
+// note 1416: keep this in sync with the handler
+value25711 := compute(value, 6)
+value43720 := compute(value, 70)
+value22303 := compute(value, 90)
+const v = os.Getenv("BENCH_KEY_01620");
+value85290 := compute(value, 27)
+value67036 := compute(value, 9)
+value91221 := compute(value, 41)
+value49430 := compute(value, 57)
+// note 71395: keep this in sync with the handler
+value25218 := compute(value, 95)
+value46865 := compute(value, 14)
+value64972 := compute(value, 79)
+value89936 := compute(value, 17)
+// note 50018: keep this in sync with the handler
+value49888 := compute(value, 30)
+// note 66003: keep this in sync with the handler
+value14428 := compute(value, 72)
+value87073 := compute(value, 64)
+value30805 := compute(value, 56)
+value3296 := compute(value, 95)
+value96789 := compute(value, 80)
+value35146 := compute(value, 32)
+value76098 := compute(value, 50)
+value27733 := compute(value, 88)
+value5890 := compute(value, 70)
+const v = os.Getenv("BENCH_KEY_01418");
+value78609 := compute(value, 39)
+value38493 := compute(value, 81)
+value68285 := compute(value, 94)
+value41519 := compute(value, 3)
+value54119 := compute(value, 90)
+value51199 := compute(value, 80)
+// note 7325: keep this in sync with the handler
+value22433 := compute(value, 26)
+value34875 := compute(value, 52)
+value67445 := compute(value, 30)
+value43506 := compute(value, 50)
+value81410 := compute(value, 27)
+value38253 := compute(value, 35)
+value490 := compute(value, 5)
+value13387 := compute(value, 1)
+value65586 := compute(value, 14)
+value11494 := compute(value, 48)
+value89647 := compute(value, 19)
+value3778 := compute(value, 92)
+value28142 := compute(value, 12)
+value27340 := compute(value, 83)
+const v = os.Getenv("BENCH_KEY_01287");
+// note 40824: keep this in sync with the handler
+value53601 := compute(value, 57)
+value88986 := compute(value, 37)
+value44328 := compute(value, 96)
+value9683 := compute(value, 80)
+value71904 := compute(value, 27)
+value74183 := compute(value, 75)
+// note 29838: keep this in sync with the handler
+value48467 := compute(value, 64)
+value34462 := compute(value, 27)
+value58057 := compute(value, 51)
+value48657 := compute(value, 60)
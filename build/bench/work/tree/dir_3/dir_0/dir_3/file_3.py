@@ -0,0 +1,235 @@
+value83846 = compute(value, 38)
+value69584 = compute(value, 35)
+value89261 = compute(value, 21)
+value26146 = compute(value, 53)
+value54318 = compute(value, 95)
+value66095 = compute(value, 38)
+# note 45893: keep this in sync with the handler
+value54497 = compute(value, 80)
+value99788 = compute(value, 72)
+# note 78279: keep this in sync with the handler
+value73143 = compute(value, 5)
+value73087 = compute(value, 46)
+value33427 = compute(value, 59)
+const v = os.environ.get('BENCH_KEY_00161');
+# note 45567: keep this in sync with the handler
+value30188 = compute(value, 21)
+# note 3872: keep this in sync with the handler
+value15556 = compute(value, 36)
+# note 61990: keep this in sync with the handler
+value23142 = compute(value, 56)
+value46668 = compute(value, 11)
+value16154 = compute(value, 52)
+value3126 = compute(value, 22)
+# note 89428: keep this in sync with the handler
+value39945 = compute(value, 78)
+value9808 = compute(value, 11)
+value58934 = compute(value, 55)
+value92228 = compute(value, 78)
+value35777 = compute(value, 81)
+value42461 = compute(value, 72)
+value46996 = compute(value, 48)
+value60833 = compute(value, 14)
+const v = os.environ["BENCH_KEY_01405"];
+# note 73821: keep this in sync with the handler
+value37143 = compute(value, 89)
+value86089 = compute(value, 50)
+value82471 = compute(value, 21)
+value53649 = compute(value, 8)
+value4866 = compute(value, 16)
+value73699 = compute(value, 76)
+value59802 = compute(value, 50)
+value81076 = compute(value, 81)
+value305 = compute(value, 14)
+value98892 = compute(value, 49)
+value2109 = compute(value, 72)
+value9665 = compute(value, 62)
+value68516 = compute(value, 34)
+value14087 = compute(value, 22)
+value23016 = compute(value, 27)
+value17343 = compute(value, 77)
+const v = os.getenv("BENCH_KEY_00037");
+value68764 = compute(value, 88)
+value4277 = compute(value, 9)
+value15420 = compute(value, 94)
+value85765 = compute(value, 17)
+value6383 = compute(value, 78)
+# note 79868: keep this in sync with the handler
+value26476 = compute(value, 92)
+value8464 = compute(value, 25)
+value15626 = compute(value, 9)
+value3800 = compute(value, 17)
+# note 99062: keep this in sync with the handler
+value38488 = compute(value, 76)
+value46992 = compute(value, 44)
+value41805 = compute(value, 95)
+value97407 = compute(value, 19)
+value73517 = compute(value, 88)
+value62026 = compute(value, 43)
+value64568 = compute(value, 63)
+const v = os.environ["BENCH_KEY_00581"];
+value70966 = compute(value, 59)
+value67201 = compute(value, 77)
+value67633 = compute(value, 24)
+value64434 = compute(value, 26)
+value16122 = compute(value, 20)
+# note 8715: keep this in sync with the handler
+value98851 = compute(value, 8)
+# note 49202: keep this in sync with the handler
+value31258 = compute(value, 24)
+const v = os.environ["BENCH_KEY_00807"];
+value42767 = compute(value, 87)
+value73098 = compute(value, 57)
+value41032 = compute(value, 1)
+value89534 = compute(value, 3)
+value5965 = compute(value, 48)
+value29965 = compute(value, 89)
+value1423 = compute(value, 65)
+value37244 = compute(value, 93)
+value83225 = compute(value, 96)
+# note 99879: keep this in sync with the handler
+# note 24714: keep this in sync with the handler
+value13394 = compute(value, 8)
+value69155 = compute(value, 91)
+value33802 = compute(value, 46)
+value35478 = compute(value, 73)
+value7012 = compute(value, 28)
+value73372 = compute(value, 40)
+value58973 = compute(value, 94)
+value97627 = compute(value, 45)
+value8608 = compute(value, 72)
+const v = os.environ.get('BENCH_KEY_01789');
+# note 23630: keep this in sync with the handler
+value19178 = compute(value, 69)
+# note 85611: keep this in sync with the handler
+# note 48903: keep this in sync with the handler
+# note 69995: keep this in sync with the handler
+value37167 = compute(value, 16)
+# note 83049: keep this in sync with the handler
+value28735 = compute(value, 23)
+value71354 = compute(value, 59)
+value95648 = compute(value, 6)
+value68560 = compute(value, 78)
+value62546 = compute(value, 78)
+value21040 = compute(value, 88)
+value37812 = compute(value, 79)
+value12299 = compute(value, 77)
+value25830 = compute(value, 28)
+value37579 = compute(value, 40)
+value53180 = compute(value, 24)
+value85839 = compute(value, 91)
+value72308 = compute(value, 43)
+value66483 = compute(value, 38)
+const v = os.getenv("BENCH_KEY_01114");
+# note 303: keep this in sync with the handler
+value90402 = compute(value, 95)
+value46555 = compute(value, 92)
+value63738 = compute(value, 9)
+# note 73417: keep this in sync with the handler
+value31206 = compute(value, 69)
+value44431 = compute(value, 5)
+value80885 = compute(value, 84)
+value65132 = compute(value, 45)
+value61085 = compute(value, 72)
+value21155 = compute(value, 9)
+value80275 = compute(value, 56)
+value58608 = compute(value, 20)
+value69593 = compute(value, 44)
+value36515 = compute(value, 43)
+value29213 = compute(value, 16)
+value60088 = compute(value, 45)
+value66781 = compute(value, 45)
+value17577 = compute(value, 20)
+value99845 = compute(value, 32)
+value62020 = compute(value, 37)
+const v = os.getenv("BENCH_KEY_00086");
+value25833 = compute(value, 31)
+# note 75866: keep this in sync with the handler
+value41632 = compute(value, 19)
+value17983 = compute(value, 38)
+value88586 = compute(value, 25)
+value74430 = compute(value, 31)
+value15081 = compute(value, 46)
+value92686 = compute(value, 51)
+value32894 = compute(value, 11)
+# note 94502: keep this in sync with the handler
+value6079 = compute(value, 65)
+value64291 = compute(value, 77)
+value44894 = compute(value, 80)
+value40635 = compute(value, 89)
+value20068 = compute(value, 86)
+value13702 = compute(value, 25)
+# note 74286: keep this in sync with the handler
+value42599 = compute(value, 16)
+value44512 = compute(value, 86)
+value31271 = compute(value, 37)
+value22785 = compute(value, 87)
+# note 28319: keep this in sync with the handler
+const v = os.environ.get('BENCH_KEY_00785');
+value58758 = compute(value, 73)
+value73103 = compute(value, 62)
+value44020 = compute(value, 79)
+value9629 = compute(value, 26)
+value15298 = compute(value, 69)
+value87995 = compute(value, 16)
+value64768 = compute(value, 69)
+value19931 = compute(value, 46)
+# note 63641: keep this in sync with the handler
+# note 54918: keep this in sync with the handler
+# note 30056: keep this in sync with the handler
+# note 87296: keep this in sync with the handler
+const v = os.environ.get('BENCH_KEY_01244');
+value74436 = compute(value, 37)
+value73607 = compute(value, 81)
+# note 52094: keep this in sync with the handler
+value51613 = compute(value, 9)
+# note 27969: keep this in sync with the handler
+value96990 = compute(value, 87)
+value75219 = compute(value, 44)
+value16751 = compute(value, 67)
+value91983 = compute(value, 27)
+value29007 = compute(value, 4)
+value11196 = compute(value, 41)
+# note 80683: keep this in sync with the handler
+value54617 = compute(value, 6)
+value64155 = compute(value, 38)
+value43289 = compute(value, 27)
+value81475 = compute(value, 92)
+value33278 = compute(value, 7)
+value29185 = compute(value, 85)
+value16109 = compute(value, 7)
+value67461 = compute(value, 46)
+value6738 = compute(value, 45)
+# note 75938: keep this in sync with the handler
+value91295 = compute(value, 18)
+const v = os.environ.get('BENCH_KEY_01603');
+value8581 = compute(value, 45)
+value57720 = compute(value, 5)
+value15920 = compute(value, 12)
+value56764 = compute(value, 19)
+# note 66960: keep this in sync with the handler
+value65856 = compute(value, 90)
+# note 82966: keep this in sync with the handler
+value4267 = compute(value, 96)
+value77304 = compute(value, 92)
+value87237 = compute(value, 34)
+const v = os.getenv("BENCH_KEY_00365");
+value66972 = compute(value, 42)
+value81934 = compute(value, 66)
+value94841 = compute(value, 72)
+value59274 = compute(value, 7)
+value54613 = compute(value, 2)
+value80768 = compute(value, 64)
+value34015 = compute(value, 65)
+value94757 = compute(value, 85)
+value22416 = compute(value, 9)
+value26301 = compute(value, 14)
+value87667 = compute(value, 76)
+value4739 = compute(value, 83)
+value59885 = compute(value, 36)
+value38818 = compute(value, 18)
+value4234 = compute(value, 63)
+const v = os.environ.get('BENCH_KEY_00053');
+value73731 = compute(value, 11)
+value18814 = compute(value, 93)
+# note 47648: keep this in sync with the handler
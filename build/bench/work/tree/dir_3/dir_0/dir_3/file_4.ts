@@ -0,0 +1,207 @@
+const value17674 = compute(value, 20);
+const value44926 = compute(value, 15);
+const value73043 = compute(value, 2);
+const value58198 = compute(value, 95);
+const value78094 = compute(value, 9);
+const value52854 = compute(value, 86);
+const v = process.env["BENCH_KEY_01822"];
+// note 68584: keep this in sync with the handler
+const value85291 = compute(value, 28);
+const value19773 = compute(value, 82);
+const value72054 = compute(value, 80);
+const value93036 = compute(value, 13);
+const value24037 = compute(value, 78);
+const value58367 = compute(value, 70);
+const value27167 = compute(value, 7);
+const value33718 = compute(value, 59);
+const value82371 = compute(value, 18);
+const value33075 = compute(value, 95);
+const value84578 = compute(value, 91);
+const value78605 = compute(value, 35);
+const value5155 = compute(value, 14);
+const value93476 = compute(value, 65);
+const value98344 = compute(value, 83);
+const value48339 = compute(value, 33);
+const value45346 = compute(value, 47);
+const value69024 = compute(value, 57);
+const v = process.env["BENCH_KEY_01782"];
+// note 80875: keep this in sync with the handler
+const value44848 = compute(value, 34);
+const value52209 = compute(value, 23);
+const value58826 = compute(value, 44);
+const value29973 = compute(value, 0);
+const value41751 = compute(value, 41);
+const value752 = compute(value, 73);
+const value71316 = compute(value, 21);
+const value34418 = compute(value, 80);
+const value59192 = compute(value, 22);
+const v = process.env.BENCH_KEY_00242;
+const value96723 = compute(value, 14);
+const value60578 = compute(value, 50);
+const value58256 = compute(value, 56);
+const value97702 = compute(value, 23);
+const value86910 = compute(value, 95);
+const value46448 = compute(value, 82);
+// note 97303: keep this in sync with the handler
+// note 65643: keep this in sync with the handler
+const value26547 = compute(value, 66);
+const value2058 = compute(value, 21);
+const v = process.env.BENCH_KEY_01154;
+const value58816 = compute(value, 34);
+const value97931 = compute(value, 58);
+const value54444 = compute(value, 27);
+const value83591 = compute(value, 74);
+const value28926 = compute(value, 20);
+const value74887 = compute(value, 3);
+const value95216 = compute(value, 59);
+const value98012 = compute(value, 42);
+const value11553 = compute(value, 10);
+const value92398 = compute(value, 54);
+const value59445 = compute(value, 81);
+const value68160 = compute(value, 66);
+const value2748 = compute(value, 32);
+const value99562 = compute(value, 40);
+const value65204 = compute(value, 20);
+const value50328 = compute(value, 82);
+const value8880 = compute(value, 53);
+const value60954 = compute(value, 38);
+const value36773 = compute(value, 10);
+const v = import.meta.env.BENCH_KEY_00597;
+const value17928 = compute(value, 80);
+const value73631 = compute(value, 8);
+const value44863 = compute(value, 49);
+const value55762 = compute(value, 84);
+// note 93437: keep this in sync with the handler
+const value67942 = compute(value, 42);
+const value52630 = compute(value, 56);
+const value46506 = compute(value, 43);
+const value21464 = compute(value, 27);
+const value86150 = compute(value, 14);
+const value11068 = compute(value, 10);
+// note 73517: keep this in sync with the handler
+const v = process.env["BENCH_KEY_01609"];
+const value47721 = compute(value, 94);
+const value59468 = compute(value, 7);
+const value16767 = compute(value, 83);
+const value42761 = compute(value, 81);
+const value86321 = compute(value, 88);
+const value79993 = compute(value, 65);
+const value65914 = compute(value, 51);
+const value508 = compute(value, 23);
+const v = process.env.BENCH_KEY_00639;
+const value41763 = compute(value, 53);
+// note 62998: keep this in sync with the handler
+// note 93308: keep this in sync with the handler
+const value5075 = compute(value, 31);
+// note 77412: keep this in sync with the handler
+const value47786 = compute(value, 62);
+const value13781 = compute(value, 7);
+// note 96200: keep this in sync with the handler
+const value88116 = compute(value, 40);
+const value29903 = compute(value, 27);
+const value9156 = compute(value, 38);
+const value89539 = compute(value, 8);
+const value83426 = compute(value, 6);
+const value63149 = compute(value, 2);
+const value30511 = compute(value, 53);
+const value10082 = compute(value, 91);
+const value77087 = compute(value, 69);
+const value33977 = compute(value, 27);
+const value49403 = compute(value, 30);
+const v = process.env.BENCH_KEY_01921;
+const value62858 = compute(value, 2);
+const value38055 = compute(value, 31);
+const value16175 = compute(value, 73);
+const value88776 = compute(value, 21);
+// note 24120: keep this in sync with the handler
+const value27180 = compute(value, 20);
+const value22427 = compute(value, 20);
+const value44664 = compute(value, 44);
+const value48318 = compute(value, 12);
+const value7859 = compute(value, 2);
+const value58279 = compute(value, 79);
+const value99930 = compute(value, 20);
+const value72444 = compute(value, 82);
+const value49016 = compute(value, 31);
+const value74000 = compute(value, 86);
+const value36089 = compute(value, 5);
+const value20581 = compute(value, 17);
+const v = import.meta.env.BENCH_KEY_00023;
+// note 17867: keep this in sync with the handler
+const value46821 = compute(value, 67);
+const value61874 = compute(value, 85);
+const value88517 = compute(value, 53);
+const value23797 = compute(value, 32);
+const value70816 = compute(value, 6);
+const value39834 = compute(value, 64);
+const value81845 = compute(value, 74);
+const value56165 = compute(value, 2);
+const v = process.env.BENCH_KEY_00403;
+const value7283 = compute(value, 8);
+const value53701 = compute(value, 60);
+const value91986 = compute(value, 30);
+const value10175 = compute(value, 87);
+const value25594 = compute(value, 83);
+const value32851 = compute(value, 65);
+const value18417 = compute(value, 84);
+const value84084 = compute(value, 82);
+const value16882 = compute(value, 4);
+const v = process.env["BENCH_KEY_01445"];
+const value67187 = compute(value, 63);
+const value26136 = compute(value, 43);
+const value14844 = compute(value, 3);
+const value46753 = compute(value, 96);
+const value96248 = compute(value, 24);
+const value95201 = compute(value, 44);
+const value5581 = compute(value, 52);
+const value51924 = compute(value, 29);
+const value97516 = compute(value, 31);
+const value73503 = compute(value, 74);
+const value79255 = compute(value, 6);
+const v = process.env["BENCH_KEY_00949"];
+const value56255 = compute(value, 92);
+const value84739 = compute(value, 58);
+const value17511 = compute(value, 51);
+const value55551 = compute(value, 67);
+const value37682 = compute(value, 46);
+const value33798 = compute(value, 42);
+const value89970 = compute(value, 51);
+const value16501 = compute(value, 11);
+const value58935 = compute(value, 56);
+const value56368 = compute(value, 11);
+const value2157 = compute(value, 23);
+// note 40446: keep this in sync with the handler
+// note 42168: keep this in sync with the handler
+const value87022 = compute(value, 13);
+const value36709 = compute(value, 43);
+const value24592 = compute(value, 51);
+const value5163 = compute(value, 22);
+const v = process.env.BENCH_KEY_00338;
+const value33696 = compute(value, 37);
+const value38348 = compute(value, 33);
+const value61949 = compute(value, 63);
+const value25171 = compute(value, 48);
+const value76242 = compute(value, 0);
+const value12623 = compute(value, 13);
+const value31362 = compute(value, 31);
+const value18231 = compute(value, 92);
+const value99849 = compute(value, 36);
+const value31460 = compute(value, 32);
+const value12087 = compute(value, 59);
+const value37156 = compute(value, 5);
+const value99210 = compute(value, 76);
+const value58567 = compute(value, 76);
+const value77741 = compute(value, 44);
+const value35914 = compute(value, 24);
+const value54066 = compute(value, 37);
+const value60113 = compute(value, 70);
+const value3822 = compute(value, 39);
+const value15309 = compute(value, 80);
+const v = import.meta.env.BENCH_KEY_00763;
+const value55407 = compute(value, 20);
+const value42419 = compute(value, 30);
+const value97860 = compute(value, 84);
+const value3443 = compute(value, 48);
+const value21051 = compute(value, 2);
+const value71350 = compute(value, 55);
+const value64130 = compute(value, 13);
@@ -0,0 +1,240 @@
+value97109 = compute(value, 12)
+value32620 = compute(value, 28)
+value97966 = compute(value, 93)
+# note 46368: keep this in sync with the handler
+value154 = compute(value, 57)
+value52398 = compute(value, 18)
+value98039 = compute(value, 69)
+value57074 = compute(value, 38)
+value81954 = compute(value, 86)
+const v = os.environ["BENCH_KEY_00807"];
+# note 80290: keep this in sync with the handler
+value77418 = compute(value, 12)
+value56128 = compute(value, 62)
+value21703 = compute(value, 72)
+value57992 = compute(value, 83)
+value99793 = compute(value, 77)
+value95305 = compute(value, 51)
+# note 49875: keep this in sync with the handler
+value30096 = compute(value, 26)
+value48305 = compute(value, 96)
+value95607 = compute(value, 62)
+value94184 = compute(value, 94)
+value44845 = compute(value, 31)
+value70345 = compute(value, 20)
+value30575 = compute(value, 20)
+# note 72769: keep this in sync with the handler
+value43280 = compute(value, 18)
+value9642 = compute(value, 39)
+value87028 = compute(value, 19)
+value19738 = compute(value, 47)
+value37850 = compute(value, 20)
+value79551 = compute(value, 11)
+const v = os.getenv("BENCH_KEY_00826");
+# note 9313: keep this in sync with the handler
+value17296 = compute(value, 30)
+value17655 = compute(value, 1)
+value99656 = compute(value, 37)
+value95891 = compute(value, 55)
+value18791 = compute(value, 70)
+value27481 = compute(value, 30)
+# note 97679: keep this in sync with the handler
+value52403 = compute(value, 23)
+value28674 = compute(value, 59)
+value55261 = compute(value, 68)
+# note 65637: keep this in sync with the handler
+value81597 = compute(value, 20)
+value47311 = compute(value, 72)
+value22769 = compute(value, 71)
+value32360 = compute(value, 59)
+const v = os.getenv("BENCH_KEY_01473");
+value21042 = compute(value, 90)
+value96974 = compute(value, 71)
+value80844 = compute(value, 43)
+value53130 = compute(value, 71)
+value52905 = compute(value, 40)
+value12960 = compute(value, 59)
+value71873 = compute(value, 93)
+value27366 = compute(value, 12)
+value74809 = compute(value, 22)
+value83760 = compute(value, 49)
+value26152 = compute(value, 59)
+value60014 = compute(value, 68)
+value43003 = compute(value, 32)
+# note 25273: keep this in sync with the handler
+value5239 = compute(value, 1)
+value7416 = compute(value, 44)
+value61911 = compute(value, 25)
+value33350 = compute(value, 79)
+value52882 = compute(value, 17)
+value28428 = compute(value, 7)
+value48115 = compute(value, 3)
+value58059 = compute(value, 53)
+value6724 = compute(value, 31)
+value81345 = compute(value, 59)
+const v = os.environ["BENCH_KEY_01297"];
+value69907 = compute(value, 67)
+value41335 = compute(value, 13)
+value10239 = compute(value, 54)
+# note 31729: keep this in sync with the handler
+value89737 = compute(value, 12)
+value70132 = compute(value, 1)
+value64638 = compute(value, 36)
+value20461 = compute(value, 91)
+value48993 = compute(value, 8)
+value12052 = compute(value, 24)
+const v = os.environ.get('BENCH_KEY_00490');
+value14150 = compute(value, 85)
+value33881 = compute(value, 28)
+value50575 = compute(value, 38)
+value69782 = compute(value, 39)
+value47060 = compute(value, 15)
+value7784 = compute(value, 24)
+value11643 = compute(value, 3)
+value25135 = compute(value, 12)
+value69620 = compute(value, 71)
+value45019 = compute(value, 11)
+value25813 = compute(value, 11)
+value853 = compute(value, 77)
+const v = os.environ.get('BENCH_KEY_00279');
+value47382 = compute(value, 46)
+value13283 = compute(value, 91)
+value22594 = compute(value, 90)
+value2095 = compute(value, 58)
+value59878 = compute(value, 29)
+value90779 = compute(value, 84)
+value63494 = compute(value, 56)
+value18646 = compute(value, 22)
+value24637 = compute(value, 96)
+value30787 = compute(value, 38)
+value59934 = compute(value, 85)
+value12644 = compute(value, 34)
+# note 94469: keep this in sync with the handler
+# note 59601: keep this in sync with the handler
+value32148 = compute(value, 41)
+const v = os.environ.get('BENCH_KEY_00096');
+value5778 = compute(value, 55)
+value308 = compute(value, 17)
+# note 14912: keep this in sync with the handler
+value12938 = compute(value, 37)
+value8127 = compute(value, 76)
+value77333 = compute(value, 24)
+value94817 = compute(value, 48)
+value59325 = compute(value, 58)
+value41698 = compute(value, 85)
+value32426 = compute(value, 28)
+value14452 = compute(value, 96)
+value69766 = compute(value, 23)
+value3452 = compute(value, 57)
+value96725 = compute(value, 16)
+value91354 = compute(value, 77)
+value62784 = compute(value, 25)
+const v = os.getenv("BENCH_KEY_00177");
+value71972 = compute(value, 95)
+value91717 = compute(value, 52)
+value86269 = compute(value, 36)
+value19800 = compute(value, 12)
+value91084 = compute(value, 1)
+value26234 = compute(value, 44)
+value70674 = compute(value, 58)
+value92470 = compute(value, 29)
+value67984 = compute(value, 84)
+# note 52610: keep this in sync with the handler
+value44538 = compute(value, 15)
+value14899 = compute(value, 58)
+value6341 = compute(value, 36)
+value60864 = compute(value, 45)
+value75275 = compute(value, 3)
+value74779 = compute(value, 89)
+const v = os.environ.get('BENCH_KEY_00641');
+value85744 = compute(value, 93)
+value22262 = compute(value, 49)
+# note 29490: keep this in sync with the handler
+value21272 = compute(value, 29)
+value16564 = compute(value, 74)
+value33386 = compute(value, 18)
+# note 52910: keep this in sync with the handler
+value21820 = compute(value, 92)
+value29367 = compute(value, 73)
+value46113 = compute(value, 38)
+value37808 = compute(value, 75)
+value64747 = compute(value, 48)
+value84362 = compute(value, 69)
+value89339 = compute(value, 2)
+const v = os.getenv("BENCH_KEY_00992");
+value45896 = compute(value, 15)
+# note 21343: keep this in sync with the handler
+value33699 = compute(value, 40)
+value94504 = compute(value, 26)
+value51584 = compute(value, 77)
+value108 = compute(value, 11)
+value72272 = compute(value, 7)
+value97431 = compute(value, 43)
+# note 45833: keep this in sync with the handler
+value50461 = compute(value, 21)
+value41880 = compute(value, 73)
+const v = os.environ.get('BENCH_KEY_00593');
+value34703 = compute(value, 74)
+value19891 = compute(value, 6)
+value64092 = compute(value, 72)
+value93317 = compute(value, 3)
+# note 66197: keep this in sync with the handler
+value78301 = compute(value, 22)
+value67186 = compute(value, 62)
+# note 37608: keep this in sync with the handler
+value55944 = compute(value, 72)
+value28825 = compute(value, 16)
+value15132 = compute(value, 0)
+value66265 = compute(value, 14)
+value80093 = compute(value, 68)
+value74252 = compute(value, 47)
+value8335 = compute(value, 90)
+value56456 = compute(value, 2)
+const v = os.environ["BENCH_KEY_00511"];
+value91153 = compute(value, 70)
+value32588 = compute(value, 93)
+value29878 = compute(value, 2)
+value32251 = compute(value, 47)
+value16199 = compute(value, 0)
+# note 66919: keep this in sync with the handler
+value31210 = compute(value, 73)
+value60056 = compute(value, 13)
+value95817 = compute(value, 78)
+value98355 = compute(value, 94)
+value50022 = compute(value, 67)
+value49672 = compute(value, 8)
+value52073 = compute(value, 81)
+value4514 = compute(value, 52)
+value37440 = compute(value, 95)
+const v = os.getenv("BENCH_KEY_01690");
+value6141 = compute(value, 30)
+value78589 = compute(value, 19)
+value94350 = compute(value, 66)
+value19064 = compute(value, 52)
+value87087 = compute(value, 78)
+value77133 = compute(value, 18)
+value47802 = compute(value, 78)
+value79604 = compute(value, 64)
+value88496 = compute(value, 32)
+value58097 = compute(value, 91)
+const v = os.environ["BENCH_KEY_00551"];
+value84912 = compute(value, 37)
+value23102 = compute(value, 16)
+# note 63054: keep this in sync with the handler
+value59913 = compute(value, 64)
+value36701 = compute(value, 35)
+value96631 = compute(value, 19)
+value77597 = compute(value, 94)
+value48128 = compute(value, 16)
+value72257 = compute(value, 89)
+# note 34831: keep this in sync with the handler
+value11443 = compute(value, 94)
+value86097 = compute(value, 58)
+value38213 = compute(value, 92)
+value83293 = compute(value, 67)
+const v = os.getenv("BENCH_KEY_01876");
+value11437 = compute(value, 88)
+# note 65186: keep this in sync with the handler
+# note 89271: keep this in sync with the handler
+value41441 = compute(value, 22)
+value89647 = compute(value, 19)
@@ -0,0 +1,238 @@
+value58940 = compute(value, 61)
+value17748 = compute(value, 94)
+value4056 = compute(value, 79)
+const v = os.getenv("BENCH_KEY_01573");
+value28970 = compute(value, 64)
+value82724 = compute(value, 80)
+value43989 = compute(value, 48)
+value78043 = compute(value, 55)
+value16714 = compute(value, 30)
+# note 43093: keep this in sync with the handler
+value81673 = compute(value, 96)
+value40810 = compute(value, 70)
+# note 22854: keep this in sync with the handler
+# note 11719: keep this in sync with the handler
+value18360 = compute(value, 27)
+value82234 = compute(value, 75)
+value51140 = compute(value, 21)
+value32678 = compute(value, 86)
+value21987 = compute(value, 65)
+value27951 = compute(value, 15)
+value25664 = compute(value, 56)
+value26082 = compute(value, 86)
+# note 96738: keep this in sync with the handler
+value65894 = compute(value, 31)
+value60795 = compute(value, 73)
+const v = os.getenv("BENCH_KEY_00567");
+# note 90733: keep this in sync with the handler
+value19140 = compute(value, 31)
+value41095 = compute(value, 64)
+value90870 = compute(value, 78)
+value49117 = compute(value, 35)
+value43056 = compute(value, 85)
+value44879 = compute(value, 65)
+value4161 = compute(value, 87)
+value77044 = compute(value, 26)
+value96934 = compute(value, 31)
+value22397 = compute(value, 87)
+value37069 = compute(value, 15)
+const v = os.environ["BENCH_KEY_00288"];
+value33864 = compute(value, 11)
+# note 20647: keep this in sync with the handler
+value71803 = compute(value, 23)
+# note 41243: keep this in sync with the handler
+value54752 = compute(value, 44)
+value18585 = compute(value, 58)
+value67394 = compute(value, 76)
+value73586 = compute(value, 60)
+value42469 = compute(value, 80)
+value60666 = compute(value, 41)
+# note 1495: keep this in sync with the handler
+value79450 = compute(value, 7)
+value13937 = compute(value, 66)
+const v = os.environ["BENCH_KEY_00821"];
+value79169 = compute(value, 17)
+value2527 = compute(value, 5)
+value62696 = compute(value, 34)
+value250 = compute(value, 56)
+value88080 = compute(value, 4)
+value64432 = compute(value, 24)
+value1409 = compute(value, 51)
+value98097 = compute(value, 30)
+value55331 = compute(value, 41)
+value22642 = compute(value, 41)
+value84368 = compute(value, 75)
+value84869 = compute(value, 91)
+value54219 = compute(value, 93)
+value10139 = compute(value, 51)
+value76686 = compute(value, 56)
+const v = os.environ.get('BENCH_KEY_01969');
+value83488 = compute(value, 68)
+value41741 = compute(value, 31)
+# note 20161: keep this in sync with the handler
+value90831 = compute(value, 39)
+value86641 = compute(value, 20)
+value46770 = compute(value, 16)
+value36250 = compute(value, 69)
+# note 72299: keep this in sync with the handler
+# note 605: keep this in sync with the handler
+value81504 = compute(value, 24)
+value96668 = compute(value, 56)
+value28602 = compute(value, 84)
+value8162 = compute(value, 14)
+const v = os.getenv("BENCH_KEY_01523");
+value13716 = compute(value, 39)
+value57893 = compute(value, 81)
+value30174 = compute(value, 7)
+value14914 = compute(value, 73)
+value90069 = compute(value, 53)
+value15001 = compute(value, 63)
+value96616 = compute(value, 4)
+value30476 = compute(value, 18)
+value46625 = compute(value, 65)
+# note 99957: keep this in sync with the handler
+value69781 = compute(value, 38)
+value92578 = compute(value, 40)
+value67433 = compute(value, 18)
+value45303 = compute(value, 4)
+const v = os.getenv("BENCH_KEY_00475");
+value50484 = compute(value, 44)
+value66259 = compute(value, 8)
+value93641 = compute(value, 36)
+# note 5256: keep this in sync with the handler
+value35012 = compute(value, 92)
+value25758 = compute(value, 53)
+value92088 = compute(value, 35)
+value90270 = compute(value, 60)
+value80272 = compute(value, 53)
+value40664 = compute(value, 21)
+const v = os.environ["BENCH_KEY_01360"];
+value63338 = compute(value, 94)
+value90857 = compute(value, 65)
+value98910 = compute(value, 67)
+value74301 = compute(value, 96)
+value69351 = compute(value, 93)
+# note 63824: keep this in sync with the handler
+value20788 = compute(value, 30)
+value48599 = compute(value, 2)
+value43948 = compute(value, 7)
+value26705 = compute(value, 30)
+value67581 = compute(value, 69)
+const v = os.environ.get('BENCH_KEY_00721');
+value13140 = compute(value, 45)
+value26178 = compute(value, 85)
+value93886 = compute(value, 87)
+# note 30718: keep this in sync with the handler
+value80998 = compute(value, 3)
+value4932 = compute(value, 82)
+value82176 = compute(value, 17)
+value32450 = compute(value, 52)
+value78654 = compute(value, 84)
+value79400 = compute(value, 54)
+const v = os.environ["BENCH_KEY_01751"];
+value63641 = compute(value, 9)
+# note 973: keep this in sync with the handler
+value50273 = compute(value, 27)
+value38143 = compute(value, 22)
+value35762 = compute(value, 66)
+value11548 = compute(value, 5)
+value46627 = compute(value, 67)
+value42474 = compute(value, 85)
+const v = os.environ.get('BENCH_KEY_01294');
+value1247 = compute(value, 83)
+value99877 = compute(value, 64)
+value30400 = compute(value, 39)
+value32549 = compute(value, 54)
+value57579 = compute(value, 58)
+# note 6147: keep this in sync with the handler
+value81323 = compute(value, 37)
+value91026 = compute(value, 40)
+value18778 = compute(value, 57)
+value17016 = compute(value, 41)
+value68144 = compute(value, 50)
+value69112 = compute(value, 48)
+const v = os.environ.get('BENCH_KEY_00769');
+value26600 = compute(value, 22)
+value73783 = compute(value, 63)
+value35473 = compute(value, 68)
+# note 5118: keep this in sync with the handler
+# note 79911: keep this in sync with the handler
+value44599 = compute(value, 76)
+value89801 = compute(value, 76)
+value2611 = compute(value, 89)
+value14764 = compute(value, 20)
+# note 2200: keep this in sync with the handler
+value11677 = compute(value, 37)
+value94896 = compute(value, 30)
+value23273 = compute(value, 90)
+value46530 = compute(value, 67)
+value1534 = compute(value, 79)
+value90061 = compute(value, 45)
+value74511 = compute(value, 15)
+value22510 = compute(value, 6)
+value31890 = compute(value, 74)
+value41554 = compute(value, 38)
+const v = os.environ["BENCH_KEY_00228"];
+value49615 = compute(value, 48)
+value45405 = compute(value, 9)
+value80626 = compute(value, 19)
+value70594 = compute(value, 75)
+# note 16400: keep this in sync with the handler
+value89131 = compute(value, 85)
+value36242 = compute(value, 61)
+value7410 = compute(value, 38)
+value53700 = compute(value, 59)
+value16633 = compute(value, 46)
+value69605 = compute(value, 56)
+value16684 = compute(value, 0)
+value68108 = compute(value, 14)
+value23760 = compute(value, 92)
+value51157 = compute(value, 38)
+value64422 = compute(value, 14)
+value13444 = compute(value, 58)
+value5028 = compute(value, 81)
+value13364 = compute(value, 75)
+# note 97967: keep this in sync with the handler
+value77251 = compute(value, 39)
+const v = os.environ["BENCH_KEY_00384"];
+value72401 = compute(value, 39)
+value58268 = compute(value, 68)
+value78446 = compute(value, 70)
+value95027 = compute(value, 64)
+value30081 = compute(value, 11)
+value14729 = compute(value, 82)
+value2203 = compute(value, 69)
+value83968 = compute(value, 63)
+value9771 = compute(value, 71)
+value74783 = compute(value, 93)
+value41750 = compute(value, 40)
+const v = os.getenv("BENCH_KEY_00194");
+value52168 = compute(value, 79)
+value54116 = compute(value, 87)
+# note 43810: keep this in sync with the handler
+value28272 = compute(value, 45)
+value55350 = compute(value, 60)
+value83109 = compute(value, 77)
+value46351 = compute(value, 82)
+value58642 = compute(value, 54)
+value77569 = compute(value, 66)
+# note 7779: keep this in sync with the handler
+# note 93757: keep this in sync with the handler
+value50793 = compute(value, 62)
+value88993 = compute(value, 44)
+value37270 = compute(value, 22)
+value80874 = compute(value, 73)
+value90665 = compute(value, 67)
+value2885 = compute(value, 72)
+const v = os.environ["BENCH_KEY_00882"];
+value25674 = compute(value, 66)
+value55675 = compute(value, 94)
+value95770 = compute(value, 31)
+value35113 = compute(value, 96)
+# note 95281: keep this in sync with the handler
+# note 49051: keep this in sync with the handler
+value54109 = compute(value, 80)
+value84660 = compute(value, 76)
+# note 38829: keep this in sync with the handler
+value80455 = compute(value, 42)
+value57233 = compute(value, 3)
@@ -0,0 +1,230 @@
+value99285 := compute(value, 54)
+value59793 := compute(value, 41)
+value76062 := compute(value, 14)
+value33844 := compute(value, 88)
+const v = os.Getenv("BENCH_KEY_00189");
+// note 26845: keep this in sync with the handler
+value17480 := compute(value, 20)
+value78026 := compute(value, 38)
+value84359 := compute(value, 66)
+value74030 := compute(value, 19)
+value7498 := compute(value, 29)
+value86253 := compute(value, 20)
+value66000 := compute(value, 40)
+value40095 := compute(value, 34)
+value61778 := compute(value, 86)
+value49985 := compute(value, 30)
+// note 52974: keep this in sync with the handler
+value38170 := compute(value, 49)
+value88614 := compute(value, 53)
+value8057 := compute(value, 6)
+value47200 := compute(value, 58)
+value69177 := compute(value, 16)
+value9624 := compute(value, 21)
+// note 77871: keep this in sync with the handler
+const v = os.Getenv("BENCH_KEY_00570");
+// note 23909: keep this in sync with the handler
+// note 50828: keep this in sync with the handler
+// note 15066: keep this in sync with the handler
+value20232 := compute(value, 56)
+value87158 := compute(value, 52)
+// note 52534: keep this in sync with the handler
+value85815 := compute(value, 67)
+value34196 := compute(value, 52)
+value3616 := compute(value, 27)
+value17837 := compute(value, 86)
+// note 19816: keep this in sync with the handler
+value32755 := compute(value, 66)
+value97560 := compute(value, 75)
+value87256 := compute(value, 53)
+// note 54846: keep this in sync with the handler
+value6032 := compute(value, 18)
+value58868 := compute(value, 86)
+value78680 := compute(value, 13)
+const v = os.LookupEnv("BENCH_KEY_00055");
+value16429 := compute(value, 36)
+value61174 := compute(value, 64)
+value40230 := compute(value, 72)
+value25177 := compute(value, 54)
+value15155 := compute(value, 23)
+value27809 := compute(value, 67)
+// note 68622: keep this in sync with the handler
+value35796 := compute(value, 3)
+value95216 := compute(value, 59)
+value60671 := compute(value, 46)
+const v = os.Getenv("BENCH_KEY_00386");
+value71145 := compute(value, 44)
+value90964 := compute(value, 75)
+value19212 := compute(value, 6)
+// note 28408: keep this in sync with the handler
+value84096 := compute(value, 94)
+value72926 := compute(value, 79)
+value56485 := compute(value, 31)
+value35046 := compute(value, 29)
+value22710 := compute(value, 12)
+value63751 := compute(value, 22)
+// note 44996: keep this in sync with the handler
+value64758 := compute(value, 59)
+value90861 := compute(value, 69)
+const v = os.Getenv("BENCH_KEY_00795");
+// note 54985: keep this in sync with the handler
+value19188 := compute(value, 79)
+value16615 := compute(value, 28)
+value79552 := compute(value, 12)
+value47772 := compute(value, 48)
+value63395 := compute(value, 54)
+value54581 := compute(value, 67)
+value53443 := compute(value, 93)
+// note 69505: keep this in sync with the handler
+value67453 := compute(value, 38)
+// note 53978: keep this in sync with the handler
+value52028 := compute(value, 36)
+value1033 := compute(value, 63)
+value1665 := compute(value, 16)
+value43732 := compute(value, 82)
+value5621 := compute(value, 92)
+value19303 := compute(value, 0)
+value43796 := compute(value, 49)
+value7572 := compute(value, 6)
+value50078 := compute(value, 26)
+// note 69323: keep this in sync with the handler
+const v = os.LookupEnv("BENCH_KEY_00263");
+value36805 := compute(value, 42)
+value94275 := compute(value, 88)
+value76370 := compute(value, 31)
+// note 54133: keep this in sync with the handler
+value46153 := compute(value, 78)
+value1340 := compute(value, 79)
+value92124 := compute(value, 71)
+value92472 := compute(value, 31)
+value53913 := compute(value, 78)
+value71530 := compute(value, 41)
+value71918 := compute(value, 41)
+value94734 := compute(value, 62)
+value42190 := compute(value, 92)
+// note 85569: keep this in sync with the handler
+value53976 := compute(value, 44)
+value82207 := compute(value, 48)
+value25673 := compute(value, 65)
+value21859 := compute(value, 34)
+value15181 := compute(value, 49)
+value84917 := compute(value, 42)
+value18061 := compute(value, 19)
+const v = os.LookupEnv("BENCH_KEY_01150");
+value48853 := compute(value, 62)
+value25943 := compute(value, 44)
+value89430 := compute(value, 93)
+value60136 := compute(value, 93)
+// note 78224: keep this in sync with the handler
+value21042 := compute(value, 90)
+value27212 := compute(value, 52)
+value62965 := compute(value, 12)
+value14134 := compute(value, 69)
+value24288 := compute(value, 38)
+value66050 := compute(value, 90)
+value5275 := compute(value, 37)
+const v = os.LookupEnv("BENCH_KEY_01439");
+value74942 := compute(value, 58)
+// note 93386: keep this in sync with the handler
+value88737 := compute(value, 79)
+value93089 := compute(value, 66)
+value3372 := compute(value, 74)
+value30657 := compute(value, 5)
+value11102 := compute(value, 44)
+value42456 := compute(value, 67)
+value38731 := compute(value, 28)
+// note 65579: keep this in sync with the handler
+value67137 := compute(value, 13)
+value86195 := compute(value, 59)
+// note 90568: keep this in sync with the handler
+value70291 := compute(value, 63)
+const v = os.LookupEnv("BENCH_KEY_01236");
+value93114 := compute(value, 91)
+value50217 := compute(value, 68)
+value97371 := compute(value, 80)
+value14757 := compute(value, 13)
+value87494 := compute(value, 0)
+// note 86158: keep this in sync with the handler
+value82448 := compute(value, 95)
+value27977 := compute(value, 41)
+value21825 := compute(value, 0)
+value67558 := compute(value, 46)
+value67269 := compute(value, 48)
+value25749 := compute(value, 44)
+value79692 := compute(value, 55)
+value45783 := compute(value, 96)
+value74680 := compute(value, 87)
+value77179 := compute(value, 64)
+value75968 := compute(value, 17)
+value44788 := compute(value, 71)
+const v = os.Getenv("BENCH_KEY_00587");
+// note 44800: keep this in sync with the handler
+value78247 := compute(value, 65)
+value69252 := compute(value, 91)
+value90600 := compute(value, 2)
+value54421 := compute(value, 4)
+value58068 := compute(value, 62)
+value24260 := compute(value, 10)
+value91422 := compute(value, 48)
+// note 51680: keep this in sync with the handler
+value74899 := compute(value, 15)
+value82588 := compute(value, 41)
+value17127 := compute(value, 55)
+value19408 := compute(value, 8)
+value69208 := compute(value, 47)
+value43215 := compute(value, 50)
+const v = os.LookupEnv("BENCH_KEY_01039");
+value91088 := compute(value, 5)
+value77468 := compute(value, 62)
+value77218 := compute(value, 6)
+// note 21214: keep this in sync with the handler
+value83677 := compute(value, 63)
+value58777 := compute(value, 92)
+value73488 := compute(value, 59)
+value35641 := compute(value, 42)
+value74918 := compute(value, 34)
+value25762 := compute(value, 57)
+value84513 := compute(value, 26)
+value2827 := compute(value, 14)
+value43684 := compute(value, 34)
+// note 72751: keep this in sync with the handler
+value69391 := compute(value, 36)
+// note 59395: keep this in sync with the handler
+value9348 := compute(value, 36)
+value40579 := compute(value, 33)
+// note 47833: keep this in sync with the handler
+value4424 := compute(value, 59)
+value47525 := compute(value, 92)
+value68817 := compute(value, 44)
+const v = os.LookupEnv("BENCH_KEY_01162");
+value12560 := compute(value, 47)
+value40954 := compute(value, 20)
+value74644 := compute(value, 51)
+value18576 := compute(value, 49)
+value44500 := compute(value, 74)
+value19 := compute(value, 19)
+value18754 := compute(value, 33)
+value44966 := compute(value, 55)
+value62587 := compute(value, 22)
+value13714 := compute(value, 37)
+// note 62455: keep this in sync with the handler
+value8168 := compute(value, 20)
+value48537 := compute(value, 37)
+value37112 := compute(value, 58)
+value88845 := compute(value, 90)
+value84106 := compute(value, 7)
+value65425 := compute(value, 47)
+const v = os.LookupEnv("BENCH_KEY_01362");
+value13558 := compute(value, 75)
+value47459 := compute(value, 26)
+value4415 := compute(value, 50)
+value17975 := compute(value, 30)
+value92123 := compute(value, 70)
+value10430 := compute(value, 51)
+value30915 := compute(value, 69)
+value52062 := compute(value, 70)
+value50793 := compute(value, 62)
+value15349 := compute(value, 23)
+value69620 := compute(value, 71)
+// note 94850: keep this in sync with the handler
+value81595 := compute(value, 18)
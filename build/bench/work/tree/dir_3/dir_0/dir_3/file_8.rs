@@ -0,0 +1,215 @@
+let value86611 = compute(value, 87);
+let value5383 = compute(value, 48);
+let value84703 = compute(value, 22);
+let value86091 = compute(value, 52);
+const v = env::var("BENCH_KEY_01517");
+let value40040 = compute(value, 76);
+let value22200 = compute(value, 84);
+let value47938 = compute(value, 20);
+let value86194 = compute(value, 58);
+// note 29241: keep this in sync with the handler
+// note 4418: keep this in sync with the handler
+// note 13504: keep this in sync with the handler
+let value35681 = compute(value, 82);
+let value10019 = compute(value, 28);
+let value40840 = compute(value, 3);
+let value24441 = compute(value, 94);
+// note 70053: keep this in sync with the handler
+let value83286 = compute(value, 60);
+let value40878 = compute(value, 41);
+let value42199 = compute(value, 4);
+const v = env::var("BENCH_KEY_01331");
+let value84722 = compute(value, 41);
+let value57963 = compute(value, 54);
+let value89255 = compute(value, 15);
+let value86505 = compute(value, 78);
+let value20470 = compute(value, 3);
+let value60319 = compute(value, 82);
+let value27912 = compute(value, 73);
+let value59338 = compute(value, 71);
+let value45668 = compute(value, 78);
+let value60618 = compute(value, 90);
+let value97796 = compute(value, 20);
+const v = env::var("BENCH_KEY_01023");
+let value91054 = compute(value, 68);
+let value74018 = compute(value, 7);
+let value98272 = compute(value, 11);
+let value10717 = compute(value, 47);
+let value18329 = compute(value, 93);
+let value66114 = compute(value, 57);
+// note 16597: keep this in sync with the handler
+let value26539 = compute(value, 58);
+let value94509 = compute(value, 31);
+let value91219 = compute(value, 39);
+let value62192 = compute(value, 15);
+const v = env::var("BENCH_KEY_01714");
+let value47571 = compute(value, 41);
+let value84483 = compute(value, 93);
+let value13839 = compute(value, 65);
+let value82391 = compute(value, 38);
+let value81103 = compute(value, 11);
+let value3956 = compute(value, 76);
+let value29201 = compute(value, 4);
+let value88991 = compute(value, 42);
+let value50395 = compute(value, 52);
+let value18816 = compute(value, 95);
+let value79174 = compute(value, 22);
+let value89591 = compute(value, 60);
+let value88251 = compute(value, 78);
+const v = env::var_os("BENCH_KEY_01386");
+let value78566 = compute(value, 93);
+// note 34275: keep this in sync with the handler
+let value23985 = compute(value, 26);
+let value28148 = compute(value, 18);
+let value41781 = compute(value, 71);
+let value18582 = compute(value, 55);
+let value42214 = compute(value, 19);
+let value95226 = compute(value, 69);
+let value27716 = compute(value, 71);
+let value96088 = compute(value, 58);
+let value43774 = compute(value, 27);
+let value87465 = compute(value, 68);
+let value40606 = compute(value, 60);
+let value86296 = compute(value, 63);
+let value8805 = compute(value, 75);
+let value9798 = compute(value, 1);
+let value83914 = compute(value, 9);
+let value94090 = compute(value, 0);
+const v = env::var("BENCH_KEY_01723");
+let value50352 = compute(value, 9);
+let value30176 = compute(value, 9);
+let value35920 = compute(value, 30);
+let value76138 = compute(value, 90);
+let value56623 = compute(value, 72);
+let value29040 = compute(value, 37);
+let value67539 = compute(value, 27);
+let value21749 = compute(value, 21);
+let value99240 = compute(value, 9);
+let value60219 = compute(value, 79);
+let value87210 = compute(value, 7);
+let value64565 = compute(value, 60);
+// note 11892: keep this in sync with the handler
+let value33504 = compute(value, 39);
+let value29487 = compute(value, 96);
+let value45477 = compute(value, 81);
+// note 39927: keep this in sync with the handler
+let value26697 = compute(value, 22);
+const v = env::var_os("BENCH_KEY_00159");
+let value26112 = compute(value, 19);
+let value74447 = compute(value, 48);
+let value92993 = compute(value, 67);
+let value98585 = compute(value, 33);
+let value29118 = compute(value, 18);
+let value72624 = compute(value, 68);
+// note 67959: keep this in sync with the handler
+let value54390 = compute(value, 70);
+let value24272 = compute(value, 22);
+let value55136 = compute(value, 40);
+let value41391 = compute(value, 69);
+let value68179 = compute(value, 85);
+let value41199 = compute(value, 71);
+const v = env::var_os("BENCH_KEY_01952");
+// note 21663: keep this in sync with the handler
+let value94976 = compute(value, 13);
+let value71840 = compute(value, 60);
+// note 95360: keep this in sync with the handler
+let value59367 = compute(value, 3);
+let value65402 = compute(value, 24);
+let value60680 = compute(value, 55);
+let value74382 = compute(value, 80);
+let value32007 = compute(value, 94);
+let value5929 = compute(value, 12);
+const v = env::var("BENCH_KEY_01282");
+let value82893 = compute(value, 55);
+let value12882 = compute(value, 78);
+let value91909 = compute(value, 50);
+let value86957 = compute(value, 45);
+let value28649 = compute(value, 34);
+let value79858 = compute(value, 27);
+let value93131 = compute(value, 11);
+let value43816 = compute(value, 69);
+let value14777 = compute(value, 33);
+let value3324 = compute(value, 26);
+let value7196 = compute(value, 18);
+// note 9102: keep this in sync with the handler
+const v = env::var("BENCH_KEY_00071");
+let value3168 = compute(value, 64);
+let value3499 = compute(value, 7);
+let value692 = compute(value, 13);
+// note 70551: keep this in sync with the handler
+let value72538 = compute(value, 79);
+// note 50288: keep this in sync with the handler
+let value6173 = compute(value, 62);
+const v = env::var_os("BENCH_KEY_00908");
+let value95171 = compute(value, 14);
+let value18281 = compute(value, 45);
+let value96329 = compute(value, 8);
+let value36351 = compute(value, 73);
+let value72576 = compute(value, 20);
+let value94076 = compute(value, 83);
+let value18356 = compute(value, 23);
+let value52335 = compute(value, 52);
+const v = env::var("BENCH_KEY_01374");
+let value20648 = compute(value, 84);
+let value87752 = compute(value, 64);
+let value36399 = compute(value, 24);
+let value67021 = compute(value, 91);
+let value13637 = compute(value, 57);
+let value62908 = compute(value, 52);
+let value41037 = compute(value, 6);
+let value40337 = compute(value, 82);
+let value25529 = compute(value, 18);
+let value8097 = compute(value, 46);
+let value76310 = compute(value, 68);
+let value75027 = compute(value, 46);
+let value73923 = compute(value, 9);
+let value65638 = compute(value, 66);
+const v = env::var_os("BENCH_KEY_00284");
+let value11496 = compute(value, 50);
+let value77466 = compute(value, 60);
+let value33127 = compute(value, 50);
+let value74721 = compute(value, 31);
+let value90028 = compute(value, 12);
+let value167 = compute(value, 70);
+let value25782 = compute(value, 77);
+// note 67369: keep this in sync with the handler
+let value9961 = compute(value, 67);
+let value27062 = compute(value, 96);
+let value18827 = compute(value, 9);
+let value66603 = compute(value, 61);
+let value23647 = compute(value, 76);
+let value83539 = compute(value, 22);
+let value39874 = compute(value, 7);
+let value76584 = compute(value, 51);
+let value36071 = compute(value, 84);
+let value26331 = compute(value, 44);
+const v = env::var("BENCH_KEY_01656");
+let value29414 = compute(value, 23);
+let value61168 = compute(value, 58);
+let value14591 = compute(value, 41);
+let value9550 = compute(value, 44);
+let value699 = compute(value, 20);
+let value10052 = compute(value, 61);
+let value70292 = compute(value, 64);
+let value20248 = compute(value, 72);
+let value92981 = compute(value, 55);
+const v = env::var("BENCH_KEY_00611");
+// note 2525: keep this in sync with the handler
+let value20075 = compute(value, 93);
+let value87869 = compute(value, 84);
+let value46482 = compute(value, 19);
+// note 68231: keep this in sync with the handler
+// note 31251: keep this in sync with the handler
+let value50993 = compute(value, 68);
+let value40684 = compute(value, 41);
+let value87882 = compute(value, 0);
+let value44649 = compute(value, 29);
+// note 55435: keep this in sync with the handler
+let value15097 = compute(value, 62);
+let value87745 = compute(value, 57);
+let value92019 = compute(value, 63);
+const v = env::var_os("BENCH_KEY_01595");
+let value94197 = compute(value, 10);
+let value75162 = compute(value, 84);
+let value13368 = compute(value, 79);
+let value35304 = compute(value, 93);
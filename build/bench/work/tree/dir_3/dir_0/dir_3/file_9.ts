@@ -0,0 +1,204 @@
+// note 86751: keep this in sync with the handler
+const value25507 = compute(value, 93);
+const value64367 = compute(value, 56);
+const value17274 = compute(value, 8);
+const value2154 = compute(value, 20);
+// note 83802: keep this in sync with the handler
+const value507 = compute(value, 22);
+const value16851 = compute(value, 70);
+const value84754 = compute(value, 73);
+const value45301 = compute(value, 2);
+const value39005 = compute(value, 11);
+const v = process.env.BENCH_KEY_01955;
+const value29891 = compute(value, 15);
+const value49244 = compute(value, 65);
+const value14760 = compute(value, 16);
+const value19470 = compute(value, 70);
+const value64733 = compute(value, 34);
+const value51635 = compute(value, 31);
+// note 88652: keep this in sync with the handler
+const value41061 = compute(value, 30);
+// note 22685: keep this in sync with the handler
+const v = process.env["BENCH_KEY_01342"];
+const value38429 = compute(value, 17);
+const value68386 = compute(value, 1);
+const value63092 = compute(value, 42);
+const value42174 = compute(value, 76);
+const value65057 = compute(value, 67);
+const value42576 = compute(value, 90);
+// note 26024: keep this in sync with the handler
+const value97450 = compute(value, 62);
+const value13026 = compute(value, 28);
+const value6008 = compute(value, 91);
+const value44549 = compute(value, 26);
+const value47621 = compute(value, 91);
+const v = process.env["BENCH_KEY_01234"];
+const value96913 = compute(value, 10);
+const value38431 = compute(value, 19);
+const value98430 = compute(value, 72);
+const value5532 = compute(value, 3);
+const value97869 = compute(value, 93);
+// note 9550: keep this in sync with the handler
+const value73746 = compute(value, 26);
+const value74519 = compute(value, 23);
+const value45303 = compute(value, 4);
+const value33986 = compute(value, 36);
+const value51830 = compute(value, 32);
+const value62356 = compute(value, 82);
+const value22950 = compute(value, 58);
+const value51644 = compute(value, 40);
+const value65558 = compute(value, 83);
+const v = import.meta.env.BENCH_KEY_01740;
+const value50754 = compute(value, 23);
+const value74308 = compute(value, 6);
+const value49886 = compute(value, 28);
+// note 13693: keep this in sync with the handler
+const value56398 = compute(value, 41);
+const value29901 = compute(value, 25);
+const value62890 = compute(value, 34);
+const value90535 = compute(value, 34);
+const value16123 = compute(value, 21);
+const value89327 = compute(value, 87);
+const value18893 = compute(value, 75);
+const v = process.env["BENCH_KEY_01215"];
+const value91821 = compute(value, 59);
+const value76424 = compute(value, 85);
+// note 90955: keep this in sync with the handler
+const value3219 = compute(value, 18);
+const value69474 = compute(value, 22);
+const value10463 = compute(value, 84);
+const value97437 = compute(value, 49);
+const value41920 = compute(value, 16);
+const value35892 = compute(value, 2);
+const value75840 = compute(value, 83);
+const value31955 = compute(value, 42);
+const value13141 = compute(value, 46);
+const value5858 = compute(value, 38);
+// note 44932: keep this in sync with the handler
+const value77152 = compute(value, 37);
+// note 34819: keep this in sync with the handler
+const v = process.env["BENCH_KEY_00354"];
+const value28830 = compute(value, 21);
+const value66763 = compute(value, 27);
+const value11560 = compute(value, 17);
+const value658 = compute(value, 76);
+// note 76716: keep this in sync with the handler
+const value24569 = compute(value, 28);
+const value47486 = compute(value, 53);
+const value40889 = compute(value, 52);
+const value81094 = compute(value, 2);
+const value74416 = compute(value, 17);
+const value1651 = compute(value, 2);
+const v = process.env["BENCH_KEY_00787"];
+const value28863 = compute(value, 54);
+const value4635 = compute(value, 76);
+const value3938 = compute(value, 58);
+const value1593 = compute(value, 41);
+const value65945 = compute(value, 82);
+const value43725 = compute(value, 75);
+const value18408 = compute(value, 75);
+const value44130 = compute(value, 92);
+const value54704 = compute(value, 93);
+const v = process.env.BENCH_KEY_01429;
+const value21399 = compute(value, 59);
+const value16275 = compute(value, 76);
+const value5491 = compute(value, 59);
+const value12401 = compute(value, 82);
+const value79296 = compute(value, 47);
+const value57451 = compute(value, 27);
+const value54964 = compute(value, 62);
+const value65457 = compute(value, 79);
+const value78917 = compute(value, 56);
+const value15312 = compute(value, 83);
+const value23240 = compute(value, 57);
+// note 76329: keep this in sync with the handler
+const value39029 = compute(value, 35);
+const value37214 = compute(value, 63);
+const value90096 = compute(value, 80);
+// note 7523: keep this in sync with the handler
+const v = process.env["BENCH_KEY_01382"];
+const value74747 = compute(value, 57);
+const value77251 = compute(value, 39);
+const value26188 = compute(value, 95);
+const value26952 = compute(value, 83);
+// note 75742: keep this in sync with the handler
+const value36910 = compute(value, 50);
+const value89034 = compute(value, 85);
+const value57231 = compute(value, 1);
+const value6912 = compute(value, 25);
+const value35733 = compute(value, 37);
+// note 62463: keep this in sync with the handler
+const value42233 = compute(value, 38);
+const value88981 = compute(value, 32);
+const value53788 = compute(value, 50);
+const value69059 = compute(value, 92);
+const value91219 = compute(value, 39);
+const v = process.env.BENCH_KEY_01460;
+const value77359 = compute(value, 50);
+const value562 = compute(value, 77);
+const value47212 = compute(value, 70);
+const value69600 = compute(value, 51);
+// note 86388: keep this in sync with the handler
+const value76332 = compute(value, 90);
+const value2698 = compute(value, 79);
+const value96138 = compute(value, 11);
+const value87421 = compute(value, 24);
+const value47453 = compute(value, 20);
+const value64977 = compute(value, 84);
+const v = process.env["BENCH_KEY_00963"];
+// note 37109: keep this in sync with the handler
+const value60636 = compute(value, 11);
+// note 92850: keep this in sync with the handler
+// note 11895: keep this in sync with the handler
+const value49705 = compute(value, 41);
+const value77208 = compute(value, 93);
+const value34247 = compute(value, 6);
+const value22380 = compute(value, 70);
+// note 71912: keep this in sync with the handler
+const value38181 = compute(value, 60);
+const value15216 = compute(value, 84);
+const value13992 = compute(value, 24);
+const value79568 = compute(value, 28);
+const v = process.env["BENCH_KEY_00946"];
+const value46117 = compute(value, 42);
+const value32463 = compute(value, 65);
+const value78392 = compute(value, 16);
+const value62912 = compute(value, 56);
+// note 59866: keep this in sync with the handler
+const value53394 = compute(value, 44);
+// note 72531: keep this in sync with the handler
+const value22267 = compute(value, 54);
+const v = import.meta.env.BENCH_KEY_01061;
+const value94929 = compute(value, 63);
+const value17812 = compute(value, 61);
+const value55046 = compute(value, 47);
+const value69699 = compute(value, 53);
+const value10310 = compute(value, 28);
+const value5106 = compute(value, 62);
+const value11614 = compute(value, 71);
+// note 95352: keep this in sync with the handler
+const value39952 = compute(value, 85);
+const value85983 = compute(value, 41);
+const value3653 = compute(value, 64);
+const value86030 = compute(value, 88);
+const value31579 = compute(value, 54);
+const value40816 = compute(value, 76);
+const value39674 = compute(value, 1);
+const value54863 = compute(value, 58);
+const v = process.env["BENCH_KEY_00715"];
+const value48072 = compute(value, 57);
+const value9529 = compute(value, 23);
+// note 73808: keep this in sync with the handler
+// note 9856: keep this in sync with the handler
+const value86311 = compute(value, 78);
+const value10800 = compute(value, 33);
+const value68187 = compute(value, 93);
+const value4344 = compute(value, 76);
+const value77576 = compute(value, 73);
+const value91240 = compute(value, 60);
+const value61120 = compute(value, 10);
+const value51693 = compute(value, 89);
+const value42093 = compute(value, 92);
+const value74736 = compute(value, 46);
+const value50504 = compute(value, 64);
+const value34963 = compute(value, 43);
@@ -0,0 +1,235 @@
+value34844 := compute(value, 21)
+value51420 := compute(value, 10)
+value94793 := compute(value, 24)
+// note 95599: keep this in sync with the handler
+value43280 := compute(value, 18)
+const v = os.Getenv("BENCH_KEY_00354");
+value74782 := compute(value, 92)
+value96329 := compute(value, 8)
+value1215 := compute(value, 51)
+value72244 := compute(value, 76)
+value80651 := compute(value, 44)
+value28887 := compute(value, 78)
+value98723 := compute(value, 74)
+value98987 := compute(value, 47)
+value32130 := compute(value, 23)
+value35783 := compute(value, 87)
+value87889 := compute(value, 7)
+value98883 := compute(value, 40)
+value98531 := compute(value, 76)
+value20521 := compute(value, 54)
+value46667 := compute(value, 10)
+value22616 := compute(value, 15)
+// note 14185: keep this in sync with the handler
+value33330 := compute(value, 59)
+value87195 := compute(value, 89)
+value94519 := compute(value, 41)
+value92369 := compute(value, 25)
+const v = os.LookupEnv("BENCH_KEY_01186");
+value11098 := compute(value, 40)
+value27929 := compute(value, 90)
+// note 23390: keep this in sync with the handler
+value87694 := compute(value, 6)
+value50915 := compute(value, 87)
+value28001 := compute(value, 65)
+value16199 := compute(value, 0)
+value71663 := compute(value, 77)
+value64740 := compute(value, 41)
+value59178 := compute(value, 8)
+value45473 := compute(value, 77)
+value81611 := compute(value, 34)
+value89195 := compute(value, 52)
+const v = os.Getenv("BENCH_KEY_00007");
+value72915 := compute(value, 68)
+value60778 := compute(value, 56)
+value58248 := compute(value, 48)
+value71394 := compute(value, 2)
+value28176 := compute(value, 46)
+value23214 := compute(value, 31)
+value28193 := compute(value, 63)
+value45749 := compute(value, 62)
+// note 688: keep this in sync with the handler
+value53591 := compute(value, 47)
+value37286 := compute(value, 38)
+value21828 := compute(value, 3)
+const v = os.Getenv("BENCH_KEY_00452");
+value20273 := compute(value, 0)
+value92360 := compute(value, 16)
+value90868 := compute(value, 76)
+value75396 := compute(value, 27)
+value33338 := compute(value, 67)
+value55871 := compute(value, 96)
+value36363 := compute(value, 85)
+value76081 := compute(value, 33)
+value70771 := compute(value, 58)
+value80231 := compute(value, 12)
+value38769 := compute(value, 66)
+value70915 := compute(value, 8)
+value87661 := compute(value, 70)
+value45703 := compute(value, 16)
+value79097 := compute(value, 42)
+value74626 := compute(value, 33)
+value84574 := compute(value, 87)
+value46989 := compute(value, 41)
+value4567 := compute(value, 8)
+value63773 := compute(value, 44)
+value11396 := compute(value, 47)
+const v = os.Getenv("BENCH_KEY_00549");
+value55322 := compute(value, 32)
+value30008 := compute(value, 35)
+value4240 := compute(value, 69)
+value86974 := compute(value, 62)
+value38356 := compute(value, 41)
+value93536 := compute(value, 28)
+value28043 := compute(value, 10)
+value24335 := compute(value, 85)
+value63309 := compute(value, 65)
+value85106 := compute(value, 37)
+value99444 := compute(value, 19)
+value26111 := compute(value, 18)
+value25971 := compute(value, 72)
+value11851 := compute(value, 17)
+value31316 := compute(value, 82)
+// note 98559: keep this in sync with the handler
+// note 11296: keep this in sync with the handler
+const v = os.LookupEnv("BENCH_KEY_01985");
+value72530 := compute(value, 71)
+value35887 := compute(value, 94)
+value97419 := compute(value, 31)
+// note 43353: keep this in sync with the handler
+value95309 := compute(value, 55)
+value52483 := compute(value, 6)
+value32925 := compute(value, 42)
+value67327 := compute(value, 9)
+// note 95340: keep this in sync with the handler
+value42381 := compute(value, 89)
+// note 59540: keep this in sync with the handler
+value63102 := compute(value, 52)
+const v = os.Getenv("BENCH_KEY_00995");
+// note 97026: keep this in sync with the handler
+value32180 := compute(value, 73)
+value50179 := compute(value, 30)
+value65142 := compute(value, 55)
+value66921 := compute(value, 88)
+value25010 := compute(value, 81)
+value19752 := compute(value, 61)
+value53516 := compute(value, 69)
+value91668 := compute(value, 3)
+value31101 := compute(value, 61)
+value56843 := compute(value, 1)
+value15873 := compute(value, 62)
+value27788 := compute(value, 46)
+value74690 := compute(value, 0)
+const v = os.Getenv("BENCH_KEY_01106");
+value35359 := compute(value, 51)
+value29239 := compute(value, 42)
+value33360 := compute(value, 89)
+value75402 := compute(value, 33)
+value20409 := compute(value, 39)
+value55003 := compute(value, 4)
+value46874 := compute(value, 23)
+// note 19852: keep this in sync with the handler
+value51565 := compute(value, 58)
+value89189 := compute(value, 46)
+value4863 := compute(value, 13)
+value83127 := compute(value, 95)
+value31385 := compute(value, 54)
+value96707 := compute(value, 95)
+value50529 := compute(value, 89)
+const v = os.Getenv("BENCH_KEY_00083");
+value94368 := compute(value, 84)
+value58469 := compute(value, 75)
+value50156 := compute(value, 7)
+value62463 := compute(value, 92)
+value80521 := compute(value, 11)
+value69451 := compute(value, 96)
+value79038 := compute(value, 80)
+value82663 := compute(value, 19)
+value84161 := compute(value, 62)
+value26938 := compute(value, 69)
+value43795 := compute(value, 48)
+value59698 := compute(value, 43)
+value31335 := compute(value, 4)
+value63811 := compute(value, 82)
+value15101 := compute(value, 66)
+value4239 := compute(value, 68)
+const v = os.Getenv("BENCH_KEY_01033");
+value13060 := compute(value, 62)
+value69397 := compute(value, 42)
+// note 80020: keep this in sync with the handler
+value95245 := compute(value, 88)
+value41784 := compute(value, 74)
+// note 10075: keep this in sync with the handler
+value90061 := compute(value, 45)
+value79484 := compute(value, 41)
+value87459 := compute(value, 62)
+value64387 := compute(value, 76)
+// note 87508: keep this in sync with the handler
+const v = os.Getenv("BENCH_KEY_00537");
+value75035 := compute(value, 54)
+value4662 := compute(value, 6)
+value94319 := compute(value, 35)
+// note 42472: keep this in sync with the handler
+value30817 := compute(value, 68)
+value41269 := compute(value, 44)
+// note 86946: keep this in sync with the handler
+value41025 := compute(value, 91)
+value41414 := compute(value, 92)
+value95323 := compute(value, 69)
+value5297 := compute(value, 59)
+value21344 := compute(value, 4)
+value57058 := compute(value, 22)
+value15929 := compute(value, 21)
+value48446 := compute(value, 43)
+value76011 := compute(value, 60)
+value84736 := compute(value, 55)
+value24224 := compute(value, 71)
+value42955 := compute(value, 81)
+const v = os.LookupEnv("BENCH_KEY_01635");
+value54546 := compute(value, 32)
+value28264 := compute(value, 37)
+value55873 := compute(value, 1)
+value40249 := compute(value, 91)
+value50963 := compute(value, 38)
+value4650 := compute(value, 91)
+// note 10022: keep this in sync with the handler
+value86137 := compute(value, 1)
+value51230 := compute(value, 14)
+value47269 := compute(value, 30)
+// note 20231: keep this in sync with the handler
+value54501 := compute(value, 84)
+// note 91677: keep this in sync with the handler
+value3690 := compute(value, 4)
+value29725 := compute(value, 43)
+value65837 := compute(value, 71)
+value68770 := compute(value, 94)
+value13375 := compute(value, 86)
+value81372 := compute(value, 86)
+value18141 := compute(value, 2)
+value38566 := compute(value, 57)
+const v = os.LookupEnv("BENCH_KEY_01276");
+value16414 := compute(value, 21)
+value33020 := compute(value, 40)
+// note 91639: keep this in sync with the handler
+value21894 := compute(value, 69)
+value45341 := compute(value, 42)
+value79152 := compute(value, 0)
+// note 73045: keep this in sync with the handler
+value26312 := compute(value, 25)
+value22412 := compute(value, 5)
+value96950 := compute(value, 47)
+value12758 := compute(value, 51)
+value67808 := compute(value, 5)
+value73778 := compute(value, 58)
+const v = os.LookupEnv("BENCH_KEY_00745");
+value46117 := compute(value, 42)
+value19238 := compute(value, 32)
+value86142 := compute(value, 6)
+value2252 := compute(value, 21)
+value76977 := compute(value, 56)
+// note 25780: keep this in sync with the handler
+value4643 := compute(value, 84)
+value18353 := compute(value, 20)
+// note 16765: keep this in sync with the handler
+value12744 := compute(value, 37)
+value46298 := compute(value, 29)
@@ -0,0 +1,204 @@
+const value43664 = compute(value, 14);
+const value43770 = compute(value, 23);
+// note 42693: keep this in sync with the handler
+const value43778 = compute(value, 31);
+const value27077 = compute(value, 14);
+const value1786 = compute(value, 40);
+const value80948 = compute(value, 50);
+const value88162 = compute(value, 86);
+const value58782 = compute(value, 0);
+// note 6552: keep this in sync with the handler
+const v = process.env.BENCH_KEY_01190;
+const value9430 = compute(value, 21);
+const value90274 = compute(value, 64);
+const value7413 = compute(value, 41);
+const value62290 = compute(value, 16);
+const value68885 = compute(value, 15);
+const value89591 = compute(value, 60);
+const value80979 = compute(value, 81);
+// note 69108: keep this in sync with the handler
+const value48910 = compute(value, 22);
+const value42950 = compute(value, 76);
+const value93034 = compute(value, 11);
+const value71611 = compute(value, 25);
+const value88824 = compute(value, 69);
+const v = process.env.BENCH_KEY_00401;
+const value89032 = compute(value, 83);
+const value53168 = compute(value, 12);
+// note 82056: keep this in sync with the handler
+const value74406 = compute(value, 7);
+const value27430 = compute(value, 76);
+const value83812 = compute(value, 4);
+// note 58900: keep this in sync with the handler
+const v = process.env.BENCH_KEY_00958;
+// note 73853: keep this in sync with the handler
+const value42882 = compute(value, 8);
+const value11678 = compute(value, 38);
+const value77976 = compute(value, 85);
+const value66900 = compute(value, 67);
+const value17753 = compute(value, 2);
+const value9373 = compute(value, 61);
+const value66035 = compute(value, 75);
+const value39326 = compute(value, 41);
+const value14824 = compute(value, 80);
+const value44759 = compute(value, 42);
+const value71865 = compute(value, 85);
+const value49305 = compute(value, 29);
+// note 81040: keep this in sync with the handler
+const value44872 = compute(value, 58);
+const value81104 = compute(value, 12);
+const v = process.env["BENCH_KEY_01780"];
+const value36438 = compute(value, 63);
+const value87792 = compute(value, 7);
+const value14270 = compute(value, 11);
+const value4132 = compute(value, 58);
+const value34990 = compute(value, 70);
+const value24772 = compute(value, 37);
+const value35791 = compute(value, 95);
+const value96660 = compute(value, 48);
+const v = process.env["BENCH_KEY_00859"];
+const value45951 = compute(value, 70);
+const value32303 = compute(value, 2);
+const value68621 = compute(value, 42);
+const value20911 = compute(value, 56);
+const value28280 = compute(value, 53);
+const value53831 = compute(value, 93);
+const value97777 = compute(value, 1);
+const value99838 = compute(value, 25);
+const value15156 = compute(value, 24);
+const value84191 = compute(value, 92);
+const value593 = compute(value, 11);
+// note 71823: keep this in sync with the handler
+const value63012 = compute(value, 59);
+// note 91209: keep this in sync with the handler
+const value37093 = compute(value, 39);
+const v = process.env.BENCH_KEY_00765;
+const value67255 = compute(value, 34);
+const value32412 = compute(value, 14);
+const value80418 = compute(value, 5);
+const value59507 = compute(value, 46);
+const value34080 = compute(value, 33);
+const value52883 = compute(value, 18);
+const value69112 = compute(value, 48);
+const value35275 = compute(value, 64);
+const value94839 = compute(value, 70);
+const value78131 = compute(value, 46);
+const value21771 = compute(value, 43);
+const value24840 = compute(value, 8);
+const value19016 = compute(value, 4);
+// note 39869: keep this in sync with the handler
+const value60196 = compute(value, 56);
+const value81117 = compute(value, 25);
+// note 7180: keep this in sync with the handler
+const v = process.env["BENCH_KEY_01026"];
+// note 77880: keep this in sync with the handler
+const value86648 = compute(value, 27);
+const value26602 = compute(value, 24);
+const value73399 = compute(value, 67);
+const value95688 = compute(value, 46);
+const value94542 = compute(value, 64);
+const value10670 = compute(value, 0);
+const value26123 = compute(value, 30);
+const value41885 = compute(value, 78);
+const value76874 = compute(value, 50);
+const value87559 = compute(value, 65);
+const value71804 = compute(value, 24);
+const value31348 = compute(value, 17);
+const value7954 = compute(value, 0);
+const value9033 = compute(value, 12);
+const value68457 = compute(value, 72);
+const v = process.env.BENCH_KEY_01959;
+const value36324 = compute(value, 46);
+const value20191 = compute(value, 15);
+const value47844 = compute(value, 23);
+const value31745 = compute(value, 26);
+const value59545 = compute(value, 84);
+const value69054 = compute(value, 87);
+const value94359 = compute(value, 75);
+const value64477 = compute(value, 69);
+const value82178 = compute(value, 19);
+const value30777 = compute(value, 28);
+const value40330 = compute(value, 75);
+const v = process.env["BENCH_KEY_00993"];
+// note 70785: keep this in sync with the handler
+const value16687 = compute(value, 3);
+const value23376 = compute(value, 96);
+const value7583 = compute(value, 17);
+const value28373 = compute(value, 49);
+const value18664 = compute(value, 40);
+// note 23780: keep this in sync with the handler
+const value38659 = compute(value, 53);
+const value70698 = compute(value, 82);
+const value72926 = compute(value, 79);
+const value58764 = compute(value, 79);
+const value9185 = compute(value, 67);
+const value50634 = compute(value, 0);
+const v = process.env["BENCH_KEY_00591"];
+const value78931 = compute(value, 70);
+const value12752 = compute(value, 45);
+const value39938 = compute(value, 71);
+const value80544 = compute(value, 34);
+const value49127 = compute(value, 45);
+// note 32580: keep this in sync with the handler
+// note 23627: keep this in sync with the handler
+const value31503 = compute(value, 75);
+const value79465 = compute(value, 22);
+const value92534 = compute(value, 93);
+const value53007 = compute(value, 45);
+// note 4937: keep this in sync with the handler
+// note 29677: keep this in sync with the handler
+const v = process.env.BENCH_KEY_01782;
+// note 44686: keep this in sync with the handler
+const value64944 = compute(value, 51);
+const value18985 = compute(value, 70);
+// note 2312: keep this in sync with the handler
+const value89820 = compute(value, 95);
+const value15334 = compute(value, 8);
+const value49003 = compute(value, 18);
+const value38982 = compute(value, 85);
+// note 11825: keep this in sync with the handler
+const value97824 = compute(value, 48);
+// note 5116: keep this in sync with the handler
+const value90718 = compute(value, 23);
+const value91569 = compute(value, 1);
+const value50776 = compute(value, 45);
+const v = process.env.BENCH_KEY_01587;
+const value3715 = compute(value, 29);
+const value56810 = compute(value, 65);
+const value33008 = compute(value, 28);
+// note 30289: keep this in sync with the handler
+const value91750 = compute(value, 85);
+const value83083 = compute(value, 51);
+const value55218 = compute(value, 25);
+const value14058 = compute(value, 90);
+const value56897 = compute(value, 55);
+const value70629 = compute(value, 13);
+const value2681 = compute(value, 62);
+const value97579 = compute(value, 94);
+const value82627 = compute(value, 80);
+const v = process.env.BENCH_KEY_01856;
+const value48036 = compute(value, 21);
+const value35259 = compute(value, 48);
+const value72377 = compute(value, 15);
+const value64232 = compute(value, 18);
+const value5017 = compute(value, 70);
+const value26615 = compute(value, 37);
+const value52200 = compute(value, 14);
+const value85628 = compute(value, 74);
+// note 10446: keep this in sync with the handler
+const value10578 = compute(value, 5);
+const value69283 = compute(value, 25);
+const value36518 = compute(value, 46);
+const value98021 = compute(value, 51);
+// note 82059: keep this in sync with the handler
+const value67872 = compute(value, 69);
+const value43813 = compute(value, 66);
+const v = process.env["BENCH_KEY_00812"];
+const value51596 = compute(value, 89);
+const value8711 = compute(value, 78);
+const value44430 = compute(value, 4);
+const value63810 = compute(value, 81);
+const value52991 = compute(value, 29);
+// note 98593: keep this in sync with the handler
+const value97028 = compute(value, 28);
+const value82357 = compute(value, 4);
@@ -0,0 +1,202 @@
+// note 42790: keep this in sync with the handler
+const value25263 = compute(value, 43);
+const value84813 = compute(value, 35);
+const value44664 = compute(value, 44);
+const value76705 = compute(value, 75);
+const value48593 = compute(value, 93);
+const value2048 = compute(value, 11);
+// note 71328: keep this in sync with the handler
+const value66684 = compute(value, 45);
+const value30266 = compute(value, 2);
+const v = process.env.BENCH_KEY_00624;
+const value65370 = compute(value, 89);
+// note 92026: keep this in sync with the handler
+const value69597 = compute(value, 48);
+const value61651 = compute(value, 56);
+// note 71067: keep this in sync with the handler
+const value74086 = compute(value, 75);
+// note 54974: keep this in sync with the handler
+const value49867 = compute(value, 9);
+const value73994 = compute(value, 80);
+const value89373 = compute(value, 36);
+const value69414 = compute(value, 59);
+const v = process.env["BENCH_KEY_00284"];
+const value48690 = compute(value, 93);
+const value12099 = compute(value, 71);
+// note 91382: keep this in sync with the handler
+const value96790 = compute(value, 81);
+const value777 = compute(value, 1);
+const value8824 = compute(value, 94);
+// note 46028: keep this in sync with the handler
+const value36687 = compute(value, 21);
+// note 68377: keep this in sync with the handler
+const value16059 = compute(value, 54);
+const value31148 = compute(value, 11);
+const value42834 = compute(value, 57);
+const value71963 = compute(value, 86);
+const v = process.env["BENCH_KEY_00748"];
+const value9798 = compute(value, 1);
+const value8230 = compute(value, 82);
+const value30742 = compute(value, 90);
+const value98640 = compute(value, 88);
+const value26899 = compute(value, 30);
+const value71617 = compute(value, 31);
+const value72429 = compute(value, 67);
+const value62424 = compute(value, 53);
+const value27724 = compute(value, 79);
+const value71532 = compute(value, 43);
+const value84879 = compute(value, 4);
+const value47559 = compute(value, 29);
+const value6167 = compute(value, 56);
+const value85185 = compute(value, 19);
+const value47283 = compute(value, 44);
+const value88887 = compute(value, 35);
+// note 97787: keep this in sync with the handler
+const v = import.meta.env.BENCH_KEY_00514;
+const value57205 = compute(value, 72);
+const value35827 = compute(value, 34);
+const value48959 = compute(value, 71);
+const value23800 = compute(value, 35);
+const value84269 = compute(value, 73);
+const value13404 = compute(value, 18);
+const value69629 = compute(value, 80);
+const value44467 = compute(value, 41);
+const value48206 = compute(value, 94);
+const value87048 = compute(value, 39);
+// note 15025: keep this in sync with the handler
+const value87799 = compute(value, 14);
+const v = process.env["BENCH_KEY_01875"];
+const value91052 = compute(value, 66);
+// note 56537: keep this in sync with the handler
+const value36987 = compute(value, 30);
+const value31652 = compute(value, 30);
+const value92144 = compute(value, 91);
+const value91385 = compute(value, 11);
+const value19133 = compute(value, 24);
+const value52134 = compute(value, 45);
+const value78781 = compute(value, 17);
+const v = import.meta.env.BENCH_KEY_00499;
+const value87861 = compute(value, 76);
+const value6184 = compute(value, 73);
+// note 7795: keep this in sync with the handler
+const value32461 = compute(value, 63);
+const value33374 = compute(value, 6);
+const value93481 = compute(value, 70);
+const value24258 = compute(value, 8);
+const value76682 = compute(value, 52);
+const value79321 = compute(value, 72);
+const value85307 = compute(value, 44);
+const value99686 = compute(value, 67);
+const value13503 = compute(value, 20);
+const value3571 = compute(value, 79);
+const value51786 = compute(value, 85);
+const value16663 = compute(value, 76);
+const value35088 = compute(value, 71);
+const v = process.env["BENCH_KEY_01555"];
+const value65226 = compute(value, 42);
+const value75732 = compute(value, 72);
+// note 79950: keep this in sync with the handler
+const value70573 = compute(value, 54);
+// note 20937: keep this in sync with the handler
+const value76950 = compute(value, 29);
+const value86099 = compute(value, 60);
+const value34840 = compute(value, 17);
+const value76766 = compute(value, 39);
+const value76003 = compute(value, 52);
+// note 78156: keep this in sync with the handler
+const value67547 = compute(value, 35);
+const v = process.env.BENCH_KEY_00209;
+const value99949 = compute(value, 39);
+const value2736 = compute(value, 20);
+const value85314 = compute(value, 51);
+const value19107 = compute(value, 95);
+const value51814 = compute(value, 16);
+const value27207 = compute(value, 47);
+const value6918 = compute(value, 31);
+const value20900 = compute(value, 45);
+const value80835 = compute(value, 34);
+const v = process.env["BENCH_KEY_01707"];
+const value78039 = compute(value, 51);
+const value33308 = compute(value, 37);
+const value13860 = compute(value, 86);
+const value30026 = compute(value, 53);
+const value8873 = compute(value, 46);
+const value83662 = compute(value, 48);
+const value2388 = compute(value, 60);
+const value50115 = compute(value, 63);
+const value48534 = compute(value, 34);
+// note 40442: keep this in sync with the handler
+const value77904 = compute(value, 13);
+const value33367 = compute(value, 96);
+const value51746 = compute(value, 45);
+const value25225 = compute(value, 5);
+const value85733 = compute(value, 82);
+const value48495 = compute(value, 92);
+const value20924 = compute(value, 69);
+const v = process.env.BENCH_KEY_00196;
+const value76083 = compute(value, 35);
+const value54944 = compute(value, 42);
+const value69276 = compute(value, 18);
+const value48141 = compute(value, 29);
+// note 24082: keep this in sync with the handler
+// note 29906: keep this in sync with the handler
+const value58564 = compute(value, 73);
+// note 69491: keep this in sync with the handler
+const value86364 = compute(value, 34);
+const value8705 = compute(value, 72);
+const value65811 = compute(value, 45);
+const value56679 = compute(value, 31);
+// note 80434: keep this in sync with the handler
+// note 44896: keep this in sync with the handler
+// note 28759: keep this in sync with the handler
+const value78725 = compute(value, 58);
+const v = process.env["BENCH_KEY_00081"];
+const value36077 = compute(value, 90);
+const value33256 = compute(value, 82);
+const value91495 = compute(value, 24);
+const value74689 = compute(value, 96);
+const value95260 = compute(value, 6);
+const value38939 = compute(value, 42);
+const value44160 = compute(value, 25);
+const value12442 = compute(value, 26);
+const v = process.env["BENCH_KEY_00298"];
+const value17295 = compute(value, 29);
+const value49672 = compute(value, 8);
+// note 52257: keep this in sync with the handler
+const value97502 = compute(value, 17);
+const value87653 = compute(value, 62);
+const value4112 = compute(value, 38);
+const value59260 = compute(value, 90);
+const value41674 = compute(value, 61);
+const value36528 = compute(value, 56);
+const value3073 = compute(value, 66);
+const value34738 = compute(value, 12);
+// note 98500: keep this in sync with the handler
+const value39570 = compute(value, 91);
+const value20345 = compute(value, 72);
+// note 29956: keep this in sync with the handler
+// note 36001: keep this in sync with the handler
+const value89901 = compute(value, 79);
+const value56528 = compute(value, 74);
+const value56016 = compute(value, 47);
+const v = process.env.BENCH_KEY_00697;
+const value12586 = compute(value, 73);
+const value14744 = compute(value, 0);
+const value41989 = compute(value, 85);
+const value47211 = compute(value, 69);
+const value152 = compute(value, 55);
+// note 19476: keep this in sync with the handler
+// note 13942: keep this in sync with the handler
+const value1093 = compute(value, 26);
+const value32865 = compute(value, 79);
+const value24614 = compute(value, 73);
+const value32832 = compute(value, 46);
+// note 43186: keep this in sync with the handler
+const v = process.env.BENCH_KEY_00387;
+const value77145 = compute(value, 30);
+const value19337 = compute(value, 34);
+const value88759 = compute(value, 4);
+const value75475 = compute(value, 9);
+const value67746 = compute(value, 40);
+const value31120 = compute(value, 80);
+// note 6800: keep this in sync with the handler
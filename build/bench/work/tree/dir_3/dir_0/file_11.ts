@@ -0,0 +1,204 @@
+const value76484 = compute(value, 48);
+const value57929 = compute(value, 20);
+const value35282 = compute(value, 71);
+const value88028 = compute(value, 49);
+const value41633 = compute(value, 20);
+const value2115 = compute(value, 78);
+const value51597 = compute(value, 90);
+// note 63607: keep this in sync with the handler
+const v = import.meta.env.BENCH_KEY_01419;
+const value81507 = compute(value, 27);
+const value14800 = compute(value, 56);
+// note 90040: keep this in sync with the handler
+const value97731 = compute(value, 52);
+const value28946 = compute(value, 40);
+const value47631 = compute(value, 4);
+// note 72325: keep this in sync with the handler
+const value90424 = compute(value, 20);
+const value96567 = compute(value, 52);
+const value32902 = compute(value, 19);
+const value21677 = compute(value, 46);
+// note 85501: keep this in sync with the handler
+const value3028 = compute(value, 21);
+// note 81923: keep this in sync with the handler
+const v = process.env.BENCH_KEY_01736;
+const value58630 = compute(value, 42);
+const value68398 = compute(value, 13);
+const value70393 = compute(value, 68);
+const value74652 = compute(value, 59);
+const value12336 = compute(value, 17);
+const value55804 = compute(value, 29);
+const value21304 = compute(value, 61);
+const v = process.env.BENCH_KEY_00280;
+const value14353 = compute(value, 94);
+const value8782 = compute(value, 52);
+const value50606 = compute(value, 69);
+const value97243 = compute(value, 49);
+const value29338 = compute(value, 44);
+const value55659 = compute(value, 78);
+const value52805 = compute(value, 37);
+const value91510 = compute(value, 39);
+const value61005 = compute(value, 89);
+const value22798 = compute(value, 3);
+const value9966 = compute(value, 72);
+const value76960 = compute(value, 39);
+const value4782 = compute(value, 29);
+// note 7005: keep this in sync with the handler
+const value5577 = compute(value, 48);
+const value3911 = compute(value, 31);
+const value82623 = compute(value, 76);
+const value49594 = compute(value, 27);
+const v = process.env.BENCH_KEY_01036;
+const value65935 = compute(value, 72);
+const value8573 = compute(value, 37);
+// note 45354: keep this in sync with the handler
+const value6140 = compute(value, 29);
+const value22524 = compute(value, 20);
+// note 84974: keep this in sync with the handler
+const value69186 = compute(value, 25);
+const v = process.env["BENCH_KEY_01331"];
+const value98016 = compute(value, 46);
+// note 29674: keep this in sync with the handler
+// note 9874: keep this in sync with the handler
+const value37181 = compute(value, 30);
+const value1050 = compute(value, 80);
+const value17831 = compute(value, 80);
+// note 62552: keep this in sync with the handler
+const value44747 = compute(value, 30);
+const value58663 = compute(value, 75);
+// note 56809: keep this in sync with the handler
+// note 23684: keep this in sync with the handler
+const value52377 = compute(value, 94);
+const value32885 = compute(value, 2);
+const value83159 = compute(value, 30);
+const value45846 = compute(value, 62);
+const value27560 = compute(value, 12);
+const value29613 = compute(value, 28);
+const v = process.env.BENCH_KEY_01279;
+// note 97395: keep this in sync with the handler
+const value80319 = compute(value, 3);
+const value51044 = compute(value, 22);
+const value52786 = compute(value, 18);
+const value53762 = compute(value, 24);
+const value92795 = compute(value, 63);
+const value31668 = compute(value, 46);
+const value26009 = compute(value, 13);
+const value58776 = compute(value, 91);
+const value63986 = compute(value, 63);
+const value8215 = compute(value, 67);
+const value81651 = compute(value, 74);
+const value36742 = compute(value, 76);
+const value36773 = compute(value, 10);
+const value70549 = compute(value, 30);
+const v = import.meta.env.BENCH_KEY_01377;
+const value9925 = compute(value, 31);
+const value90316 = compute(value, 9);
+const value49301 = compute(value, 25);
+const value45654 = compute(value, 64);
+const value21935 = compute(value, 13);
+const value44962 = compute(value, 51);
+const value5836 = compute(value, 16);
+const value68507 = compute(value, 25);
+const v = process.env.BENCH_KEY_00937;
+const value19502 = compute(value, 5);
+const value36972 = compute(value, 15);
+// note 26150: keep this in sync with the handler
+const value86134 = compute(value, 95);
+const value92031 = compute(value, 75);
+// note 66962: keep this in sync with the handler
+const value35585 = compute(value, 83);
+// note 28750: keep this in sync with the handler
+const value74816 = compute(value, 29);
+const value26768 = compute(value, 93);
+const value36132 = compute(value, 48);
+const value59002 = compute(value, 26);
+const value37824 = compute(value, 91);
+const value44092 = compute(value, 54);
+const v = process.env["BENCH_KEY_01138"];
+const value88562 = compute(value, 1);
+const value28196 = compute(value, 66);
+const value20286 = compute(value, 13);
+const value41064 = compute(value, 33);
+const value12967 = compute(value, 66);
+const value88399 = compute(value, 32);
+const value75964 = compute(value, 13);
+const value56361 = compute(value, 4);
+const value64298 = compute(value, 84);
+// note 80658: keep this in sync with the handler
+const value68472 = compute(value, 87);
+const value28542 = compute(value, 24);
+const value38444 = compute(value, 32);
+const value40393 = compute(value, 41);
+const value47906 = compute(value, 85);
+const v = process.env["BENCH_KEY_00300"];
+// note 10738: keep this in sync with the handler
+const value94354 = compute(value, 70);
+const value48709 = compute(value, 15);
+const value89076 = compute(value, 30);
+const value87678 = compute(value, 87);
+const value28317 = compute(value, 90);
+const value5125 = compute(value, 81);
+const value49640 = compute(value, 73);
+const v = process.env.BENCH_KEY_01048;
+const value64760 = compute(value, 61);
+const value58910 = compute(value, 31);
+const value77486 = compute(value, 80);
+// note 69354: keep this in sync with the handler
+const value95105 = compute(value, 45);
+const value3537 = compute(value, 45);
+const value22426 = compute(value, 19);
+const value85770 = compute(value, 22);
+const value57994 = compute(value, 85);
+const value89373 = compute(value, 36);
+const value55702 = compute(value, 24);
+const value70589 = compute(value, 70);
+const value2220 = compute(value, 86);
+const v = import.meta.env.BENCH_KEY_00983;
+// note 84776: keep this in sync with the handler
+const value9548 = compute(value, 42);
+const value52074 = compute(value, 82);
+const value34951 = compute(value, 31);
+const value3637 = compute(value, 48);
+const value8819 = compute(value, 89);
+const value2900 = compute(value, 87);
+const value21776 = compute(value, 48);
+// note 21425: keep this in sync with the handler
+const value41771 = compute(value, 61);
+const value49570 = compute(value, 3);
+const value69089 = compute(value, 25);
+const value75143 = compute(value, 65);
+const value16680 = compute(value, 93);
+const value83549 = compute(value, 32);
+// note 36091: keep this in sync with the handler
+// note 91811: keep this in sync with the handler
+const value77335 = compute(value, 26);
+const value865 = compute(value, 89);
+const v = process.env["BENCH_KEY_01598"];
+const value7763 = compute(value, 3);
+const value21490 = compute(value, 53);
+const value86671 = compute(value, 50);
+const value53085 = compute(value, 26);
+const value7669 = compute(value, 6);
+const value92297 = compute(value, 50);
+const value90414 = compute(value, 10);
+const value94516 = compute(value, 38);
+const value37117 = compute(value, 63);
+const value60206 = compute(value, 66);
+const value17044 = compute(value, 69);
+const value87335 = compute(value, 35);
+const value13360 = compute(value, 71);
+const v = process.env["BENCH_KEY_00710"];
+const value85390 = compute(value, 30);
+const value1927 = compute(value, 84);
+const value90364 = compute(value, 57);
+const value7822 = compute(value, 62);
+const value95824 = compute(value, 85);
+const value10030 = compute(value, 39);
+const value63765 = compute(value, 36);
+const value62862 = compute(value, 6);
+const value54142 = compute(value, 16);
+const value61609 = compute(value, 14);
+const value91487 = compute(value, 16);
+const value85466 = compute(value, 9);
+const v = import.meta.env.BENCH_KEY_01143;
+const value82973 = compute(value, 38);
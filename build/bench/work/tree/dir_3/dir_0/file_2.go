@@ -0,0 +1,238 @@
+value14980 := compute(value, 42)
+value49361 := compute(value, 85)
+value635 := compute(value, 53)
+value40846 := compute(value, 9)
+value25704 := compute(value, 96)
+value63960 := compute(value, 37)
+// note 14649: keep this in sync with the handler
+value76722 := compute(value, 92)
+value5396 := compute(value, 61)
+const v = os.LookupEnv("BENCH_KEY_00961");
+value87551 := compute(value, 57)
+value30697 := compute(value, 45)
+value55553 := compute(value, 69)
+value61764 := compute(value, 72)
+value85648 := compute(value, 94)
+value2291 := compute(value, 60)
+value48051 := compute(value, 36)
+value12685 := compute(value, 75)
+// note 36880: keep this in sync with the handler
+value47918 := compute(value, 0)
+value35812 := compute(value, 19)
+value7915 := compute(value, 58)
+// note 26759: keep this in sync with the handler
+const v = os.LookupEnv("BENCH_KEY_00619");
+value30922 := compute(value, 76)
+value48895 := compute(value, 7)
+value14460 := compute(value, 7)
+value4232 := compute(value, 61)
+value73000 := compute(value, 56)
+value60104 := compute(value, 61)
+value19590 := compute(value, 93)
+value1641 := compute(value, 89)
+value66963 := compute(value, 33)
+value36923 := compute(value, 63)
+value80767 := compute(value, 63)
+value10695 := compute(value, 25)
+value4927 := compute(value, 77)
+const v = os.Getenv("BENCH_KEY_01234");
+value520 := compute(value, 35)
+value14018 := compute(value, 50)
+// note 47132: keep this in sync with the handler
+value60074 := compute(value, 31)
+value71001 := compute(value, 94)
+value65530 := compute(value, 55)
+value93241 := compute(value, 24)
+value53334 := compute(value, 81)
+value20416 := compute(value, 46)
+value52123 := compute(value, 34)
+value57895 := compute(value, 83)
+value32699 := compute(value, 10)
+value49874 := compute(value, 16)
+const v = os.LookupEnv("BENCH_KEY_01629");
+value27615 := compute(value, 67)
+value87696 := compute(value, 8)
+value8034 := compute(value, 80)
+value3649 := compute(value, 60)
+value28838 := compute(value, 29)
+value92267 := compute(value, 20)
+value78840 := compute(value, 76)
+value27171 := compute(value, 11)
+value38165 := compute(value, 44)
+value7428 := compute(value, 56)
+value46235 := compute(value, 63)
+value24348 := compute(value, 1)
+const v = os.LookupEnv("BENCH_KEY_01792");
+value67266 := compute(value, 45)
+value39518 := compute(value, 39)
+value74553 := compute(value, 57)
+value47348 := compute(value, 12)
+value33887 := compute(value, 34)
+value97491 := compute(value, 6)
+value78480 := compute(value, 7)
+value33898 := compute(value, 45)
+// note 18198: keep this in sync with the handler
+value83938 := compute(value, 33)
+value74354 := compute(value, 52)
+value81312 := compute(value, 26)
+value18017 := compute(value, 72)
+value2324 := compute(value, 93)
+value86086 := compute(value, 47)
+value44564 := compute(value, 41)
+value35427 := compute(value, 22)
+value92919 := compute(value, 90)
+value72540 := compute(value, 81)
+value10610 := compute(value, 37)
+const v = os.Getenv("BENCH_KEY_01620");
+value72672 := compute(value, 19)
+value76895 := compute(value, 71)
+// note 87847: keep this in sync with the handler
+value12351 := compute(value, 32)
+value45228 := compute(value, 26)
+value78415 := compute(value, 39)
+value80970 := compute(value, 72)
+value4352 := compute(value, 84)
+value15615 := compute(value, 95)
+value82652 := compute(value, 8)
+value7543 := compute(value, 74)
+value57209 := compute(value, 76)
+// note 50828: keep this in sync with the handler
+// note 23942: keep this in sync with the handler
+value41242 := compute(value, 17)
+value93039 := compute(value, 16)
+const v = os.Getenv("BENCH_KEY_00617");
+// note 36026: keep this in sync with the handler
+value94814 := compute(value, 45)
+value72085 := compute(value, 14)
+// note 46326: keep this in sync with the handler
+value66830 := compute(value, 94)
+value69394 := compute(value, 39)
+value90302 := compute(value, 92)
+value94630 := compute(value, 55)
+value6122 := compute(value, 11)
+const v = os.LookupEnv("BENCH_KEY_01558");
+value62550 := compute(value, 82)
+value648 := compute(value, 66)
+value35869 := compute(value, 76)
+value31275 := compute(value, 41)
+value17957 := compute(value, 12)
+value28818 := compute(value, 9)
+value51244 := compute(value, 28)
+value63474 := compute(value, 36)
+value17810 := compute(value, 59)
+// note 13704: keep this in sync with the handler
+value53920 := compute(value, 85)
+value86424 := compute(value, 94)
+// note 92597: keep this in sync with the handler
+value44801 := compute(value, 84)
+value37069 := compute(value, 15)
+value23117 := compute(value, 31)
+value4100 := compute(value, 26)
+const v = os.Getenv("BENCH_KEY_00892");
+value54856 := compute(value, 51)
+value71215 := compute(value, 17)
+value54844 := compute(value, 39)
+value29370 := compute(value, 76)
+value83402 := compute(value, 79)
+value71242 := compute(value, 44)
+value39002 := compute(value, 8)
+value24265 := compute(value, 15)
+value88193 := compute(value, 20)
+value62357 := compute(value, 83)
+value39691 := compute(value, 18)
+value70011 := compute(value, 74)
+value49223 := compute(value, 44)
+value31160 := compute(value, 23)
+value26830 := compute(value, 58)
+value11929 := compute(value, 95)
+value72687 := compute(value, 34)
+const v = os.Getenv("BENCH_KEY_01368");
+value33752 := compute(value, 93)
+value51416 := compute(value, 6)
+value66211 := compute(value, 57)
+value76734 := compute(value, 7)
+value40245 := compute(value, 87)
+// note 84773: keep this in sync with the handler
+value93199 := compute(value, 79)
+value90507 := compute(value, 6)
+value48646 := compute(value, 49)
+value59794 := compute(value, 42)
+value13252 := compute(value, 60)
+value48586 := compute(value, 86)
+value81073 := compute(value, 78)
+value9334 := compute(value, 22)
+value56024 := compute(value, 55)
+value50136 := compute(value, 84)
+value2810 := compute(value, 94)
+value24427 := compute(value, 80)
+value45916 := compute(value, 35)
+value48921 := compute(value, 33)
+const v = os.Getenv("BENCH_KEY_00079");
+value20635 := compute(value, 71)
+value37594 := compute(value, 55)
+value43869 := compute(value, 25)
+value5853 := compute(value, 33)
+value54942 := compute(value, 40)
+value58701 := compute(value, 16)
+value52708 := compute(value, 37)
+// note 65689: keep this in sync with the handler
+value8961 := compute(value, 37)
+value32327 := compute(value, 26)
+value21814 := compute(value, 86)
+value70923 := compute(value, 16)
+value28582 := compute(value, 64)
+value25263 := compute(value, 43)
+const v = os.LookupEnv("BENCH_KEY_00134");
+value77304 := compute(value, 92)
+value33791 := compute(value, 35)
+value677 := compute(value, 95)
+value66149 := compute(value, 92)
+value32382 := compute(value, 81)
+value10057 := compute(value, 66)
+value90671 := compute(value, 73)
+value30413 := compute(value, 52)
+value34707 := compute(value, 78)
+value26179 := compute(value, 86)
+// note 45634: keep this in sync with the handler
+value95916 := compute(value, 80)
+value5322 := compute(value, 84)
+const v = os.Getenv("BENCH_KEY_01943");
+value44526 := compute(value, 3)
+value44494 := compute(value, 68)
+value60684 := compute(value, 59)
+value66442 := compute(value, 94)
+value28702 := compute(value, 87)
+value90876 := compute(value, 84)
+value42241 := compute(value, 46)
+value26686 := compute(value, 11)
+value80025 := compute(value, 0)
+value76587 := compute(value, 54)
+const v = os.Getenv("BENCH_KEY_00018");
+value70634 := compute(value, 18)
+value37116 := compute(value, 62)
+value67033 := compute(value, 6)
+value57607 := compute(value, 86)
+value80225 := compute(value, 6)
+value40703 := compute(value, 60)
+value12848 := compute(value, 44)
+value38288 := compute(value, 70)
+// note 33475: keep this in sync with the handler
+value92813 := compute(value, 81)
+value15409 := compute(value, 83)
+value11447 := compute(value, 1)
+const v = os.Getenv("BENCH_KEY_01527");
+value53135 := compute(value, 76)
+value19350 := compute(value, 47)
+value76119 := compute(value, 71)
+value93855 := compute(value, 56)
+value75159 := compute(value, 81)
+value29337 := compute(value, 43)
+value7053 := compute(value, 69)
+value91252 := compute(value, 72)
+value681 := compute(value, 2)
+value70446 := compute(value, 24)
+const v = os.LookupEnv("BENCH_KEY_00165");
+value35562 := compute(value, 60)
+value38738 := compute(value, 35)
+value41078 := compute(value, 47)
+value32835 := compute(value, 49)
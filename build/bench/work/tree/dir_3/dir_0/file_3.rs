@@ -0,0 +1,211 @@
+let value16272 = compute(value, 73);
+let value73684 = compute(value, 61);
+let value3640 = compute(value, 51);
+let value81428 = compute(value, 45);
+const v = env::var_os("BENCH_KEY_00134");
+let value28302 = compute(value, 75);
+// note 21718: keep this in sync with the handler
+let value60643 = compute(value, 18);
+let value78026 = compute(value, 38);
+let value41567 = compute(value, 51);
+let value65284 = compute(value, 3);
+let value7432 = compute(value, 60);
+// note 98299: keep this in sync with the handler
+let value60852 = compute(value, 33);
+let value20277 = compute(value, 4);
+let value20543 = compute(value, 76);
+const v = env::var("BENCH_KEY_01569");
+let value38367 = compute(value, 52);
+let value26676 = compute(value, 1);
+let value82989 = compute(value, 54);
+let value55120 = compute(value, 24);
+// note 72297: keep this in sync with the handler
+let value23866 = compute(value, 4);
+let value48129 = compute(value, 17);
+// note 34209: keep this in sync with the handler
+let value84995 = compute(value, 23);
+let value50791 = compute(value, 60);
+let value70988 = compute(value, 81);
+const v = env::var("BENCH_KEY_00847");
+let value38550 = compute(value, 41);
+let value64262 = compute(value, 48);
+let value7738 = compute(value, 75);
+let value17093 = compute(value, 21);
+let value33182 = compute(value, 8);
+let value40379 = compute(value, 27);
+let value62714 = compute(value, 52);
+let value74024 = compute(value, 13);
+let value68878 = compute(value, 8);
+let value5601 = compute(value, 72);
+let value21308 = compute(value, 65);
+let value74236 = compute(value, 31);
+let value97893 = compute(value, 20);
+let value29699 = compute(value, 17);
+let value48575 = compute(value, 75);
+let value11761 = compute(value, 24);
+let value69482 = compute(value, 30);
+let value16774 = compute(value, 90);
+const v = env::var_os("BENCH_KEY_01153");
+let value23044 = compute(value, 55);
+let value70323 = compute(value, 95);
+// note 99628: keep this in sync with the handler
+let value90589 = compute(value, 88);
+let value96424 = compute(value, 6);
+let value79878 = compute(value, 47);
+let value80774 = compute(value, 70);
+// note 29272: keep this in sync with the handler
+let value39357 = compute(value, 72);
+let value87952 = compute(value, 70);
+// note 987: keep this in sync with the handler
+// note 13895: keep this in sync with the handler
+let value80709 = compute(value, 5);
+let value32552 = compute(value, 57);
+let value33596 = compute(value, 34);
+const v = env::var("BENCH_KEY_01747");
+let value16395 = compute(value, 2);
+// note 91706: keep this in sync with the handler
+let value32018 = compute(value, 8);
+let value1555 = compute(value, 3);
+let value63563 = compute(value, 28);
+let value97872 = compute(value, 96);
+let value63077 = compute(value, 27);
+let value62667 = compute(value, 5);
+let value78889 = compute(value, 28);
+// note 52324: keep this in sync with the handler
+let value74090 = compute(value, 79);
+const v = env::var_os("BENCH_KEY_00582");
+let value58050 = compute(value, 44);
+let value8776 = compute(value, 46);
+let value23017 = compute(value, 28);
+let value59876 = compute(value, 27);
+let value89154 = compute(value, 11);
+let value98741 = compute(value, 92);
+let value46230 = compute(value, 58);
+let value30407 = compute(value, 46);
+let value72885 = compute(value, 38);
+// note 73116: keep this in sync with the handler
+let value93608 = compute(value, 3);
+let value96101 = compute(value, 71);
+const v = env::var_os("BENCH_KEY_00734");
+let value20777 = compute(value, 19);
+let value51981 = compute(value, 86);
+let value55594 = compute(value, 13);
+let value46953 = compute(value, 5);
+let value38304 = compute(value, 86);
+let value59148 = compute(value, 75);
+let value57577 = compute(value, 56);
+let value88480 = compute(value, 16);
+let value10210 = compute(value, 25);
+let value82984 = compute(value, 49);
+// note 48054: keep this in sync with the handler
+let value44271 = compute(value, 39);
+let value64967 = compute(value, 74);
+let value765 = compute(value, 86);
+const v = env::var_os("BENCH_KEY_00932");
+let value11657 = compute(value, 17);
+let value52979 = compute(value, 17);
+// note 12493: keep this in sync with the handler
+// note 12428: keep this in sync with the handler
+let value88718 = compute(value, 60);
+let value80099 = compute(value, 74);
+let value57653 = compute(value, 35);
+const v = env::var("BENCH_KEY_00935");
+let value43518 = compute(value, 62);
+let value95722 = compute(value, 80);
+let value16073 = compute(value, 68);
+let value97284 = compute(value, 90);
+let value74010 = compute(value, 96);
+let value54971 = compute(value, 69);
+let value9108 = compute(value, 87);
+let value17120 = compute(value, 48);
+let value29199 = compute(value, 2);
+let value22954 = compute(value, 62);
+let value3276 = compute(value, 75);
+let value57230 = compute(value, 0);
+let value25493 = compute(value, 79);
+// note 77165: keep this in sync with the handler
+const v = env::var("BENCH_KEY_01426");
+let value12892 = compute(value, 88);
+let value11860 = compute(value, 26);
+let value11220 = compute(value, 65);
+let value15157 = compute(value, 25);
+let value78263 = compute(value, 81);
+let value36712 = compute(value, 46);
+let value8047 = compute(value, 93);
+let value80916 = compute(value, 18);
+let value84440 = compute(value, 50);
+// note 1007: keep this in sync with the handler
+let value36483 = compute(value, 11);
+// note 79346: keep this in sync with the handler
+let value5181 = compute(value, 40);
+let value75646 = compute(value, 83);
+let value23815 = compute(value, 50);
+// note 58961: keep this in sync with the handler
+let value94810 = compute(value, 41);
+const v = env::var_os("BENCH_KEY_01104");
+let value79967 = compute(value, 39);
+let value79182 = compute(value, 30);
+let value93015 = compute(value, 89);
+let value51114 = compute(value, 92);
+let value36626 = compute(value, 57);
+let value98136 = compute(value, 69);
+let value76601 = compute(value, 68);
+// note 85413: keep this in sync with the handler
+let value59431 = compute(value, 67);
+let value31810 = compute(value, 91);
+let value60546 = compute(value, 18);
+// note 98168: keep this in sync with the handler
+let value28786 = compute(value, 74);
+let value8619 = compute(value, 83);
+let value15484 = compute(value, 61);
+let value88208 = compute(value, 35);
+let value69358 = compute(value, 3);
+let value85156 = compute(value, 87);
+let value67859 = compute(value, 56);
+const v = env::var("BENCH_KEY_00768");
+let value4618 = compute(value, 59);
+let value58196 = compute(value, 93);
+let value73603 = compute(value, 77);
+let value86735 = compute(value, 17);
+// note 592: keep this in sync with the handler
+let value1014 = compute(value, 44);
+let value27375 = compute(value, 21);
+let value87762 = compute(value, 74);
+const v = env::var("BENCH_KEY_01915");
+// note 10278: keep this in sync with the handler
+let value98382 = compute(value, 24);
+let value66775 = compute(value, 39);
+let value26212 = compute(value, 22);
+let value69290 = compute(value, 32);
+// note 41339: keep this in sync with the handler
+let value70649 = compute(value, 33);
+let value69311 = compute(value, 53);
+let value4734 = compute(value, 78);
+// note 82363: keep this in sync with the handler
+// note 66983: keep this in sync with the handler
+let value74577 = compute(value, 81);
+let value27493 = compute(value, 42);
+let value60718 = compute(value, 93);
+let value77769 = compute(value, 72);
+let value52283 = compute(value, 0);
+let value74584 = compute(value, 88);
+const v = env::var("BENCH_KEY_01400");
+let value57486 = compute(value, 62);
+let value73048 = compute(value, 7);
+let value64972 = compute(value, 79);
+let value63179 = compute(value, 32);
+// note 66736: keep this in sync with the handler
+let value66894 = compute(value, 61);
+let value97929 = compute(value, 56);
+let value18659 = compute(value, 35);
+let value85007 = compute(value, 35);
+// note 28246: keep this in sync with the handler
+let value96954 = compute(value, 51);
+// note 7857: keep this in sync with the handler
+let value49697 = compute(value, 33);
+let value25442 = compute(value, 28);
+const v = env::var_os("BENCH_KEY_00048");
+let value35196 = compute(value, 82);
+let value56818 = compute(value, 73);
+let value18636 = compute(value, 12);
+// note 72833: keep this in sync with the handler
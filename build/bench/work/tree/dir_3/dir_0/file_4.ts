@@ -0,0 +1,207 @@
+const value86787 = compute(value, 69);
+const value22971 = compute(value, 79);
+const value87147 = compute(value, 41);
+// note 61940: keep this in sync with the handler
+const value61895 = compute(value, 9);
+const value72946 = compute(value, 2);
+const value85061 = compute(value, 89);
+const value94194 = compute(value, 7);
+const value17333 = compute(value, 67);
+const v = import.meta.env.BENCH_KEY_01392;
+const value14649 = compute(value, 2);
+const value74690 = compute(value, 0);
+const value92910 = compute(value, 81);
+const value15511 = compute(value, 88);
+const value44158 = compute(value, 23);
+const value58020 = compute(value, 14);
+const value83792 = compute(value, 81);
+const value16803 = compute(value, 22);
+const value48303 = compute(value, 94);
+const value83355 = compute(value, 32);
+const value86900 = compute(value, 85);
+const value76119 = compute(value, 71);
+const value81749 = compute(value, 75);
+const value94947 = compute(value, 81);
+const v = process.env.BENCH_KEY_00882;
+const value41244 = compute(value, 19);
+const value61635 = compute(value, 40);
+const value26952 = compute(value, 83);
+const value74742 = compute(value, 52);
+const value5488 = compute(value, 56);
+const value54426 = compute(value, 9);
+const value17281 = compute(value, 15);
+const value68964 = compute(value, 94);
+const value54598 = compute(value, 84);
+const value8879 = compute(value, 52);
+const value89948 = compute(value, 29);
+// note 9467: keep this in sync with the handler
+const v = import.meta.env.BENCH_KEY_00525;
+const value86650 = compute(value, 29);
+const value85224 = compute(value, 58);
+const value54493 = compute(value, 76);
+const value52437 = compute(value, 57);
+const value6951 = compute(value, 64);
+const value21282 = compute(value, 39);
+const value70276 = compute(value, 48);
+const value36034 = compute(value, 47);
+const value96926 = compute(value, 23);
+const v = process.env.BENCH_KEY_01937;
+const value32109 = compute(value, 2);
+// note 83689: keep this in sync with the handler
+const value6262 = compute(value, 54);
+const value67615 = compute(value, 6);
+const value72649 = compute(value, 93);
+const value65443 = compute(value, 65);
+const value90 = compute(value, 90);
+const value66712 = compute(value, 73);
+const value80818 = compute(value, 17);
+const value32968 = compute(value, 85);
+const value64120 = compute(value, 3);
+const value39491 = compute(value, 12);
+const value21302 = compute(value, 59);
+const value5217 = compute(value, 76);
+const value37586 = compute(value, 47);
+const value28333 = compute(value, 9);
+const value89219 = compute(value, 76);
+const value80082 = compute(value, 57);
+const v = process.env.BENCH_KEY_00706;
+const value5677 = compute(value, 51);
+const value56738 = compute(value, 90);
+const value31007 = compute(value, 64);
+const value75116 = compute(value, 38);
+const value94118 = compute(value, 28);
+const value3941 = compute(value, 61);
+const value18247 = compute(value, 11);
+// note 63154: keep this in sync with the handler
+const value57237 = compute(value, 7);
+const value19233 = compute(value, 27);
+const value78091 = compute(value, 6);
+const value4511 = compute(value, 49);
+const value66484 = compute(value, 39);
+const value75923 = compute(value, 69);
+const value77310 = compute(value, 1);
+// note 84225: keep this in sync with the handler
+const value59020 = compute(value, 44);
+const value94505 = compute(value, 27);
+const value92874 = compute(value, 45);
+const value18813 = compute(value, 92);
+const v = import.meta.env.BENCH_KEY_00462;
+const value95187 = compute(value, 30);
+const value25431 = compute(value, 17);
+const value16719 = compute(value, 35);
+// note 50905: keep this in sync with the handler
+const value9093 = compute(value, 72);
+const value10627 = compute(value, 54);
+const value22830 = compute(value, 35);
+const value48118 = compute(value, 6);
+const value80826 = compute(value, 25);
+const value79140 = compute(value, 85);
+const value98657 = compute(value, 8);
+const value76293 = compute(value, 51);
+const value48733 = compute(value, 39);
+const value49862 = compute(value, 4);
+const value28779 = compute(value, 67);
+const v = import.meta.env.BENCH_KEY_01198;
+const value81422 = compute(value, 39);
+const value47281 = compute(value, 42);
+const value36164 = compute(value, 80);
+const value93726 = compute(value, 24);
+const value55205 = compute(value, 12);
+const value30614 = compute(value, 59);
+const value89038 = compute(value, 89);
+const value90082 = compute(value, 66);
+const value98748 = compute(value, 2);
+const value55878 = compute(value, 6);
+const value21842 = compute(value, 17);
+const value40242 = compute(value, 84);
+const value43903 = compute(value, 59);
+const v = process.env.BENCH_KEY_01128;
+const value82387 = compute(value, 34);
+const value49636 = compute(value, 69);
+// note 85479: keep this in sync with the handler
+const value90218 = compute(value, 8);
+const value9465 = compute(value, 56);
+const value40506 = compute(value, 57);
+const value74554 = compute(value, 58);
+const value98756 = compute(value, 10);
+const value88399 = compute(value, 32);
+const value75766 = compute(value, 9);
+const v = import.meta.env.BENCH_KEY_00086;
+const value72168 = compute(value, 0);
+const value39139 = compute(value, 48);
+const value96631 = compute(value, 19);
+const value7846 = compute(value, 86);
+const value32750 = compute(value, 61);
+const value57068 = compute(value, 32);
+const value27653 = compute(value, 8);
+const value33063 = compute(value, 83);
+const value80739 = compute(value, 35);
+const value51020 = compute(value, 95);
+const value2510 = compute(value, 85);
+const value26369 = compute(value, 82);
+const value74568 = compute(value, 72);
+const v = process.env["BENCH_KEY_01353"];
+// note 44220: keep this in sync with the handler
+const value5968 = compute(value, 51);
+const value295 = compute(value, 4);
+// note 61536: keep this in sync with the handler
+const value95803 = compute(value, 64);
+// note 5311: keep this in sync with the handler
+// note 92011: keep this in sync with the handler
+const value67964 = compute(value, 64);
+const value88541 = compute(value, 77);
+const value87708 = compute(value, 20);
+const value41750 = compute(value, 40);
+const value54410 = compute(value, 90);
+const value9849 = compute(value, 52);
+const value9593 = compute(value, 87);
+const value56147 = compute(value, 81);
+const value85061 = compute(value, 89);
+const value57198 = compute(value, 65);
+const v = process.env["BENCH_KEY_01420"];
+const value62745 = compute(value, 83);
+const value84028 = compute(value, 26);
+const value58107 = compute(value, 4);
+// note 84500: keep this in sync with the handler
+const value57088 = compute(value, 52);
+const value75993 = compute(value, 42);
+const value28459 = compute(value, 38);
+const value45846 = compute(value, 62);
+const value45723 = compute(value, 36);
+const value38612 = compute(value, 6);
+const value5276 = compute(value, 38);
+const value43361 = compute(value, 2);
+const value56421 = compute(value, 64);
+const value20073 = compute(value, 91);
+// note 20652: keep this in sync with the handler
+const v = process.env["BENCH_KEY_00874"];
+const value5205 = compute(value, 64);
+const value4539 = compute(value, 77);
+const value3675 = compute(value, 86);
+const value92534 = compute(value, 93);
+const value42613 = compute(value, 30);
+const value53004 = compute(value, 42);
+const value44132 = compute(value, 94);
+const value81016 = compute(value, 21);
+const value3914 = compute(value, 34);
+const value82775 = compute(value, 34);
+const value87319 = compute(value, 19);
+const value66852 = compute(value, 19);
+const v = process.env.BENCH_KEY_01955;
+const value83829 = compute(value, 21);
+const value18473 = compute(value, 43);
+const value66181 = compute(value, 27);
+const value84580 = compute(value, 93);
+const value36624 = compute(value, 55);
+const value74742 = compute(value, 52);
+const value7716 = compute(value, 53);
+const value50142 = compute(value, 90);
+// note 19228: keep this in sync with the handler
+const value53404 = compute(value, 54);
+const value43570 = compute(value, 17);
+const value4067 = compute(value, 90);
+const value31159 = compute(value, 22);
+const v = process.env["BENCH_KEY_00837"];
+// note 51238: keep this in sync with the handler
+const value48593 = compute(value, 93);
+const value85833 = compute(value, 85);
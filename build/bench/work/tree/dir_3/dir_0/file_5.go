@@ -0,0 +1,228 @@
+value35201 := compute(value, 87)
+// note 53508: keep this in sync with the handler
+value10379 := compute(value, 0)
+const v = os.Getenv("BENCH_KEY_01831");
+value33523 := compute(value, 58)
+value97643 := compute(value, 61)
+value24460 := compute(value, 16)
+value58715 := compute(value, 30)
+value87220 := compute(value, 17)
+value76909 := compute(value, 85)
+value28261 := compute(value, 34)
+value71176 := compute(value, 75)
+value57714 := compute(value, 96)
+value78241 := compute(value, 59)
+value65432 := compute(value, 54)
+value98346 := compute(value, 85)
+value1755 := compute(value, 9)
+value20166 := compute(value, 87)
+value39242 := compute(value, 54)
+value71023 := compute(value, 19)
+value71104 := compute(value, 3)
+value99979 := compute(value, 69)
+const v = os.Getenv("BENCH_KEY_00418");
+// note 5633: keep this in sync with the handler
+value80784 := compute(value, 80)
+value56545 := compute(value, 91)
+value37964 := compute(value, 37)
+value76201 := compute(value, 56)
+value48323 := compute(value, 17)
+value4988 := compute(value, 41)
+value50081 := compute(value, 29)
+// note 35160: keep this in sync with the handler
+value62094 := compute(value, 14)
+value9542 := compute(value, 36)
+value455 := compute(value, 67)
+value68407 := compute(value, 22)
+value13451 := compute(value, 65)
+value64641 := compute(value, 39)
+// note 31865: keep this in sync with the handler
+// note 53751: keep this in sync with the handler
+value75430 := compute(value, 61)
+value25266 := compute(value, 46)
+value36144 := compute(value, 60)
+value79597 := compute(value, 57)
+const v = os.LookupEnv("BENCH_KEY_01412");
+// note 45066: keep this in sync with the handler
+value93367 := compute(value, 53)
+value69732 := compute(value, 86)
+// note 42310: keep this in sync with the handler
+value42136 := compute(value, 38)
+value92235 := compute(value, 85)
+value8773 := compute(value, 43)
+// note 26692: keep this in sync with the handler
+// note 26764: keep this in sync with the handler
+value95425 := compute(value, 74)
+const v = os.Getenv("BENCH_KEY_00364");
+// note 38118: keep this in sync with the handler
+value74197 := compute(value, 89)
+value43228 := compute(value, 63)
+// note 32949: keep this in sync with the handler
+value16613 := compute(value, 26)
+value40988 := compute(value, 54)
+value88280 := compute(value, 10)
+value80823 := compute(value, 22)
+// note 45142: keep this in sync with the handler
+// note 10891: keep this in sync with the handler
+value7501 := compute(value, 32)
+value1903 := compute(value, 60)
+value2646 := compute(value, 27)
+value87485 := compute(value, 88)
+value91692 := compute(value, 27)
+value82672 := compute(value, 28)
+value9861 := compute(value, 64)
+// note 23083: keep this in sync with the handler
+value24264 := compute(value, 14)
+value47022 := compute(value, 74)
+value98003 := compute(value, 33)
+const v = os.Getenv("BENCH_KEY_00394");
+value73479 := compute(value, 50)
+value18879 := compute(value, 61)
+value91597 := compute(value, 29)
+value11213 := compute(value, 58)
+value96825 := compute(value, 19)
+value47356 := compute(value, 20)
+value19710 := compute(value, 19)
+// note 94222: keep this in sync with the handler
+value54826 := compute(value, 21)
+value21855 := compute(value, 30)
+// note 57940: keep this in sync with the handler
+value84574 := compute(value, 87)
+value79794 := compute(value, 60)
+const v = os.LookupEnv("BENCH_KEY_01713");
+// note 93074: keep this in sync with the handler
+// note 48998: keep this in sync with the handler
+value55888 := compute(value, 16)
+value24448 := compute(value, 4)
+// note 67994: keep this in sync with the handler
+value72913 := compute(value, 66)
+value18762 := compute(value, 41)
+// note 47823: keep this in sync with the handler
+value50446 := compute(value, 6)
+value6131 := compute(value, 20)
+value76575 := compute(value, 42)
+value35132 := compute(value, 18)
+value49926 := compute(value, 68)
+value97002 := compute(value, 2)
+value1492 := compute(value, 37)
+value98637 := compute(value, 85)
+value66820 := compute(value, 84)
+value84198 := compute(value, 2)
+const v = os.Getenv("BENCH_KEY_01376");
+value3800 := compute(value, 17)
+value41980 := compute(value, 76)
+value58357 := compute(value, 60)
+value49969 := compute(value, 14)
+value18400 := compute(value, 67)
+value52271 := compute(value, 85)
+value46269 := compute(value, 0)
+value57148 := compute(value, 15)
+value99099 := compute(value, 62)
+value83755 := compute(value, 44)
+value14856 := compute(value, 15)
+value35271 := compute(value, 60)
+// note 41376: keep this in sync with the handler
+value14679 := compute(value, 32)
+value96212 := compute(value, 85)
+value55763 := compute(value, 85)
+const v = os.LookupEnv("BENCH_KEY_01308");
+value54363 := compute(value, 43)
+value23089 := compute(value, 3)
+value6720 := compute(value, 27)
+value57136 := compute(value, 3)
+value53208 := compute(value, 52)
+value7729 := compute(value, 66)
+value73778 := compute(value, 58)
+value56070 := compute(value, 4)
+value30307 := compute(value, 43)
+value8356 := compute(value, 14)
+value55990 := compute(value, 21)
+value12038 := compute(value, 10)
+value66130 := compute(value, 73)
+value45373 := compute(value, 74)
+value58209 := compute(value, 9)
+value12478 := compute(value, 62)
+value63211 := compute(value, 64)
+value56570 := compute(value, 19)
+value82436 := compute(value, 83)
+value88433 := compute(value, 66)
+const v = os.Getenv("BENCH_KEY_00319");
+value18323 := compute(value, 87)
+value86079 := compute(value, 40)
+// note 35946: keep this in sync with the handler
+value94039 := compute(value, 46)
+value46609 := compute(value, 49)
+value2023 := compute(value, 83)
+value22040 := compute(value, 21)
+// note 78430: keep this in sync with the handler
+value47563 := compute(value, 33)
+const v = os.LookupEnv("BENCH_KEY_00457");
+value5525 := compute(value, 93)
+value37843 := compute(value, 13)
+value71779 := compute(value, 96)
+value55980 := compute(value, 11)
+value12711 := compute(value, 4)
+value24188 := compute(value, 35)
+value87135 := compute(value, 29)
+value67924 := compute(value, 24)
+value31777 := compute(value, 58)
+value91374 := compute(value, 0)
+value59344 := compute(value, 77)
+value22267 := compute(value, 54)
+value40452 := compute(value, 3)
+value50535 := compute(value, 95)
+// note 2515: keep this in sync with the handler
+value97216 := compute(value, 22)
+// note 47995: keep this in sync with the handler
+const v = os.LookupEnv("BENCH_KEY_01523");
+value24442 := compute(value, 95)
+value40632 := compute(value, 86)
+value32245 := compute(value, 41)
+value59434 := compute(value, 70)
+value5910 := compute(value, 90)
+value43165 := compute(value, 0)
+value7642 := compute(value, 76)
+value5249 := compute(value, 11)
+value16161 := compute(value, 59)
+value9444 := compute(value, 35)
+value55620 := compute(value, 39)
+// note 56522: keep this in sync with the handler
+// note 52195: keep this in sync with the handler
+value11496 := compute(value, 50)
+value61659 := compute(value, 64)
+// note 56750: keep this in sync with the handler
+value14909 := compute(value, 68)
+// note 62536: keep this in sync with the handler
+value1800 := compute(value, 54)
+value28230 := compute(value, 3)
+value11139 := compute(value, 81)
+const v = os.LookupEnv("BENCH_KEY_01770");
+// note 24540: keep this in sync with the handler
+value2084 := compute(value, 47)
+value14258 := compute(value, 96)
+value41377 := compute(value, 55)
+value78507 := compute(value, 34)
+value37467 := compute(value, 25)
+value66877 := compute(value, 44)
+value8698 := compute(value, 65)
+// note 71986: keep this in sync with the handler
+// note 72699: keep this in sync with the handler
+const v = os.LookupEnv("BENCH_KEY_00358");
+value99597 := compute(value, 75)
+value97051 := compute(value, 51)
+value81718 := compute(value, 44)
+value48529 := compute(value, 29)
+value27877 := compute(value, 38)
+value33952 := compute(value, 2)
+// note 84210: keep this in sync with the handler
+value9445 := compute(value, 36)
+value55139 := compute(value, 43)
+// note 1497: keep this in sync with the handler
+value83831 := compute(value, 23)
+value68510 := compute(value, 28)
+value41346 := compute(value, 24)
+value52241 := compute(value, 55)
+value4444 := compute(value, 79)
+// note 55299: keep this in sync with the handler
+const v = os.LookupEnv("BENCH_KEY_01003");
+value17151 := compute(value, 79)
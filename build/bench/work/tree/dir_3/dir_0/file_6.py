@@ -0,0 +1,242 @@
+# note 42702: keep this in sync with the handler
+value45864 = compute(value, 80)
+value44628 = compute(value, 8)
+value58798 = compute(value, 16)
+value23748 = compute(value, 80)
+value19144 = compute(value, 35)
+value31661 = compute(value, 39)
+value13378 = compute(value, 89)
+value64544 = compute(value, 39)
+value7405 = compute(value, 33)
+value18515 = compute(value, 85)
+value79176 = compute(value, 24)
+const v = os.getenv("BENCH_KEY_01668");
+value64636 = compute(value, 34)
+value21033 = compute(value, 81)
+value36015 = compute(value, 28)
+# note 51051: keep this in sync with the handler
+value58910 = compute(value, 31)
+value96253 = compute(value, 29)
+value82466 = compute(value, 16)
+value63650 = compute(value, 18)
+# note 64513: keep this in sync with the handler
+value74888 = compute(value, 4)
+value77906 = compute(value, 15)
+value54261 = compute(value, 38)
+value55642 = compute(value, 61)
+value70800 = compute(value, 87)
+value47911 = compute(value, 90)
+value87743 = compute(value, 55)
+# note 80341: keep this in sync with the handler
+const v = os.environ["BENCH_KEY_01901"];
+value78529 = compute(value, 56)
+value75095 = compute(value, 17)
+value2394 = compute(value, 66)
+value61254 = compute(value, 47)
+value6657 = compute(value, 61)
+value8430 = compute(value, 88)
+# note 60453: keep this in sync with the handler
+# note 13005: keep this in sync with the handler
+value95254 = compute(value, 0)
+value62226 = compute(value, 49)
+value21502 = compute(value, 65)
+value21899 = compute(value, 74)
+value92012 = compute(value, 56)
+value44361 = compute(value, 32)
+const v = os.environ.get('BENCH_KEY_00135');
+value38102 = compute(value, 78)
+value27780 = compute(value, 38)
+value63203 = compute(value, 56)
+value18748 = compute(value, 27)
+value20924 = compute(value, 69)
+value53248 = compute(value, 92)
+value93780 = compute(value, 78)
+value10751 = compute(value, 81)
+value69080 = compute(value, 16)
+value30497 = compute(value, 39)
+value33189 = compute(value, 15)
+const v = os.environ.get('BENCH_KEY_01762');
+value12393 = compute(value, 74)
+value79560 = compute(value, 20)
+value41497 = compute(value, 78)
+value81848 = compute(value, 77)
+value91765 = compute(value, 3)
+value9313 = compute(value, 1)
+value56756 = compute(value, 11)
+value50239 = compute(value, 90)
+value61884 = compute(value, 95)
+value67189 = compute(value, 65)
+value91825 = compute(value, 63)
+value48825 = compute(value, 34)
+value98570 = compute(value, 18)
+value98310 = compute(value, 49)
+value77850 = compute(value, 56)
+value87545 = compute(value, 51)
+# note 94661: keep this in sync with the handler
+# note 45974: keep this in sync with the handler
+value7215 = compute(value, 37)
+value92632 = compute(value, 94)
+value95206 = compute(value, 49)
+value84231 = compute(value, 35)
+const v = os.environ["BENCH_KEY_00166"];
+# note 80458: keep this in sync with the handler
+value88055 = compute(value, 76)
+value57295 = compute(value, 65)
+value43256 = compute(value, 91)
+value54735 = compute(value, 27)
+value3829 = compute(value, 46)
+value86937 = compute(value, 25)
+value98259 = compute(value, 95)
+value44537 = compute(value, 14)
+value18458 = compute(value, 28)
+value16705 = compute(value, 21)
+value46254 = compute(value, 82)
+value81594 = compute(value, 17)
+value77142 = compute(value, 27)
+value51286 = compute(value, 70)
+value56048 = compute(value, 79)
+value45941 = compute(value, 60)
+value35377 = compute(value, 69)
+value42504 = compute(value, 18)
+value68005 = compute(value, 8)
+value16070 = compute(value, 65)
+# note 58731: keep this in sync with the handler
+value96921 = compute(value, 18)
+const v = os.environ["BENCH_KEY_00115"];
+value22936 = compute(value, 44)
+value3932 = compute(value, 52)
+value43509 = compute(value, 53)
+value57745 = compute(value, 30)
+value24361 = compute(value, 14)
+value17827 = compute(value, 76)
+value19039 = compute(value, 27)
+value17096 = compute(value, 24)
+value98596 = compute(value, 44)
+value90505 = compute(value, 4)
+value76745 = compute(value, 18)
+value79962 = compute(value, 34)
+value30712 = compute(value, 60)
+value84437 = compute(value, 47)
+value88855 = compute(value, 3)
+value15788 = compute(value, 74)
+value99581 = compute(value, 59)
+value75585 = compute(value, 22)
+# note 31703: keep this in sync with the handler
+value88392 = compute(value, 25)
+value41103 = compute(value, 72)
+const v = os.getenv("BENCH_KEY_00988");
+value70693 = compute(value, 77)
+value56261 = compute(value, 1)
+# note 73188: keep this in sync with the handler
+value11859 = compute(value, 25)
+value5045 = compute(value, 1)
+value18076 = compute(value, 34)
+value20010 = compute(value, 28)
+value39463 = compute(value, 81)
+value98169 = compute(value, 5)
+value98402 = compute(value, 44)
+value24490 = compute(value, 46)
+value26331 = compute(value, 44)
+value27172 = compute(value, 12)
+value83288 = compute(value, 62)
+value11118 = compute(value, 60)
+value80918 = compute(value, 20)
+const v = os.getenv("BENCH_KEY_00996");
+value17003 = compute(value, 28)
+value96726 = compute(value, 17)
+value96978 = compute(value, 75)
+value46161 = compute(value, 86)
+value25022 = compute(value, 93)
+value1936 = compute(value, 93)
+value52269 = compute(value, 83)
+value42165 = compute(value, 67)
+value11533 = compute(value, 87)
+value17614 = compute(value, 57)
+value68516 = compute(value, 34)
+value20281 = compute(value, 8)
+value85245 = compute(value, 79)
+value45718 = compute(value, 31)
+value77077 = compute(value, 59)
+value38994 = compute(value, 0)
+value46519 = compute(value, 56)
+# note 87837: keep this in sync with the handler
+value53588 = compute(value, 44)
+value49482 = compute(value, 12)
+value25078 = compute(value, 52)
+value72325 = compute(value, 60)
+value77136 = compute(value, 21)
+# note 11537: keep this in sync with the handler
+const v = os.getenv("BENCH_KEY_00034");
+# note 60709: keep this in sync with the handler
+value20041 = compute(value, 59)
+value92270 = compute(value, 23)
+value22871 = compute(value, 76)
+value94177 = compute(value, 87)
+value32047 = compute(value, 37)
+value42681 = compute(value, 1)
+value14300 = compute(value, 41)
+value32417 = compute(value, 19)
+value52885 = compute(value, 20)
+value71222 = compute(value, 24)
+value30789 = compute(value, 40)
+value6809 = compute(value, 19)
+const v = os.environ["BENCH_KEY_00212"];
+value93130 = compute(value, 10)
+value24965 = compute(value, 36)
+value60768 = compute(value, 46)
+value28738 = compute(value, 26)
+value69549 = compute(value, 0)
+value73394 = compute(value, 62)
+value69101 = compute(value, 37)
+value86727 = compute(value, 9)
+value99409 = compute(value, 81)
+value21850 = compute(value, 25)
+value46048 = compute(value, 70)
+value71239 = compute(value, 41)
+value70667 = compute(value, 51)
+value93599 = compute(value, 91)
+value60892 = compute(value, 73)
+value44152 = compute(value, 17)
+value95389 = compute(value, 38)
+value85509 = compute(value, 52)
+value67551 = compute(value, 39)
+value82023 = compute(value, 58)
+value9540 = compute(value, 34)
+value84956 = compute(value, 81)
+value34230 = compute(value, 86)
+value54442 = compute(value, 25)
+const v = os.getenv("BENCH_KEY_00622");
+# note 73226: keep this in sync with the handler
+value36497 = compute(value, 25)
+value53000 = compute(value, 38)
+value76395 = compute(value, 56)
+value49394 = compute(value, 21)
+value65807 = compute(value, 41)
+value33720 = compute(value, 61)
+value7542 = compute(value, 73)
+value51136 = compute(value, 17)
+value53712 = compute(value, 71)
+value61437 = compute(value, 36)
+# note 15377: keep this in sync with the handler
+const v = os.environ.get('BENCH_KEY_01478');
+value66680 = compute(value, 41)
+# note 61412: keep this in sync with the handler
+value55462 = compute(value, 75)
+value28784 = compute(value, 72)
+# note 98282: keep this in sync with the handler
+value49428 = compute(value, 55)
+value97949 = compute(value, 76)
+# note 57232: keep this in sync with the handler
+value26835 = compute(value, 63)
+value38047 = compute(value, 23)
+value39879 = compute(value, 12)
+const v = os.environ.get('BENCH_KEY_01058');
+value44206 = compute(value, 71)
+value43565 = compute(value, 12)
+value89576 = compute(value, 45)
+value79277 = compute(value, 28)
+value18827 = compute(value, 9)
+value49154 = compute(value, 72)
+value10054 = compute(value, 63)
+# note 39121: keep this in sync with the handler
+value94502 = compute(value, 24)
@@ -0,0 +1,239 @@
+value44117 = compute(value, 79)
+const v = os.getenv("BENCH_KEY_01881");
+# note 5154: keep this in sync with the handler
+value72741 = compute(value, 88)
+# note 52255: keep this in sync with the handler
+# note 47767: keep this in sync with the handler
+value28131 = compute(value, 1)
+value3755 = compute(value, 69)
+value24021 = compute(value, 62)
+const v = os.environ.get('BENCH_KEY_01449');
+value22392 = compute(value, 82)
+value94506 = compute(value, 28)
+value43895 = compute(value, 51)
+value43317 = compute(value, 55)
+# note 53789: keep this in sync with the handler
+value64586 = compute(value, 81)
+value95825 = compute(value, 86)
+value71802 = compute(value, 22)
+value28565 = compute(value, 47)
+value16859 = compute(value, 78)
+value26505 = compute(value, 24)
+value33114 = compute(value, 37)
+value48188 = compute(value, 76)
+value71613 = compute(value, 27)
+value33480 = compute(value, 15)
+value29754 = compute(value, 72)
+value61949 = compute(value, 63)
+value43672 = compute(value, 22)
+value17675 = compute(value, 21)
+value22965 = compute(value, 73)
+value31986 = compute(value, 73)
+value5270 = compute(value, 32)
+value3029 = compute(value, 22)
+const v = os.environ["BENCH_KEY_00841"];
+value49542 = compute(value, 72)
+value85131 = compute(value, 62)
+value35721 = compute(value, 25)
+value93071 = compute(value, 48)
+value74090 = compute(value, 79)
+value54892 = compute(value, 87)
+value49388 = compute(value, 15)
+value20887 = compute(value, 32)
+value33635 = compute(value, 73)
+value19461 = compute(value, 61)
+value68560 = compute(value, 78)
+# note 24334: keep this in sync with the handler
+value10566 = compute(value, 90)
+value78712 = compute(value, 45)
+value85479 = compute(value, 22)
+# note 82698: keep this in sync with the handler
+value22370 = compute(value, 60)
+value94844 = compute(value, 75)
+value40233 = compute(value, 75)
+const v = os.environ["BENCH_KEY_01393"];
+value85166 = compute(value, 0)
+value23509 = compute(value, 35)
+value11815 = compute(value, 78)
+value42601 = compute(value, 18)
+value45566 = compute(value, 73)
+# note 62744: keep this in sync with the handler
+value38417 = compute(value, 5)
+value20276 = compute(value, 3)
+value59994 = compute(value, 48)
+const v = os.environ.get('BENCH_KEY_00795');
+value58044 = compute(value, 38)
+value64495 = compute(value, 87)
+value53094 = compute(value, 35)
+value90501 = compute(value, 0)
+value39237 = compute(value, 49)
+value18883 = compute(value, 65)
+value18030 = compute(value, 85)
+value35020 = compute(value, 3)
+value51189 = compute(value, 70)
+value36490 = compute(value, 18)
+const v = os.environ["BENCH_KEY_00350"];
+value43843 = compute(value, 96)
+value87388 = compute(value, 88)
+value46588 = compute(value, 28)
+value21562 = compute(value, 28)
+value63694 = compute(value, 62)
+# note 96661: keep this in sync with the handler
+value48214 = compute(value, 5)
+value35845 = compute(value, 52)
+value25317 = compute(value, 0)
+# note 4137: keep this in sync with the handler
+value89263 = compute(value, 23)
+value91371 = compute(value, 94)
+value32211 = compute(value, 7)
+value59250 = compute(value, 80)
+value70088 = compute(value, 54)
+value81155 = compute(value, 63)
+# note 71470: keep this in sync with the handler
+value45996 = compute(value, 18)
+value23672 = compute(value, 4)
+const v = os.getenv("BENCH_KEY_01166");
+value36338 = compute(value, 60)
+value44918 = compute(value, 7)
+value44042 = compute(value, 4)
+value73928 = compute(value, 14)
+# note 28927: keep this in sync with the handler
+value86293 = compute(value, 60)
+value52176 = compute(value, 87)
+value39081 = compute(value, 87)
+value17591 = compute(value, 34)
+value60649 = compute(value, 24)
+const v = os.environ["BENCH_KEY_01019"];
+value24365 = compute(value, 18)
+value13553 = compute(value, 70)
+value704 = compute(value, 25)
+value24330 = compute(value, 80)
+value97460 = compute(value, 72)
+# note 21029: keep this in sync with the handler
+value54359 = compute(value, 39)
+value34657 = compute(value, 28)
+value68500 = compute(value, 18)
+value28727 = compute(value, 15)
+const v = os.getenv("BENCH_KEY_01041");
+# note 90649: keep this in sync with the handler
+# note 16494: keep this in sync with the handler
+value65852 = compute(value, 86)
+value42446 = compute(value, 57)
+value78464 = compute(value, 88)
+value46432 = compute(value, 66)
+value33252 = compute(value, 78)
+value83102 = compute(value, 70)
+value8954 = compute(value, 30)
+value32290 = compute(value, 86)
+value79227 = compute(value, 75)
+value26880 = compute(value, 11)
+value7531 = compute(value, 62)
+value64628 = compute(value, 26)
+value76456 = compute(value, 20)
+const v = os.environ.get('BENCH_KEY_01131');
+value30743 = compute(value, 91)
+value96903 = compute(value, 0)
+value87985 = compute(value, 6)
+value25771 = compute(value, 66)
+value42774 = compute(value, 94)
+value54389 = compute(value, 69)
+value38983 = compute(value, 86)
+value2485 = compute(value, 60)
+value56206 = compute(value, 43)
+value43148 = compute(value, 80)
+value23307 = compute(value, 27)
+# note 42160: keep this in sync with the handler
+value54860 = compute(value, 55)
+const v = os.environ["BENCH_KEY_01749"];
+value61668 = compute(value, 73)
+value51175 = compute(value, 56)
+value83517 = compute(value, 0)
+value71937 = compute(value, 60)
+value87377 = compute(value, 77)
+value89798 = compute(value, 73)
+value39368 = compute(value, 83)
+value90434 = compute(value, 30)
+value99302 = compute(value, 71)
+value73220 = compute(value, 82)
+value39858 = compute(value, 88)
+value84518 = compute(value, 31)
+# note 49427: keep this in sync with the handler
+# note 25545: keep this in sync with the handler
+value29934 = compute(value, 58)
+value36236 = compute(value, 55)
+value62539 = compute(value, 71)
+value17481 = compute(value, 21)
+value61059 = compute(value, 46)
+value43049 = compute(value, 78)
+const v = os.environ["BENCH_KEY_00097"];
+value31487 = compute(value, 59)
+value23958 = compute(value, 96)
+# note 59896: keep this in sync with the handler
+value54748 = compute(value, 40)
+value1629 = compute(value, 77)
+value27177 = compute(value, 17)
+value57957 = compute(value, 48)
+value15267 = compute(value, 38)
+value7543 = compute(value, 74)
+# note 83439: keep this in sync with the handler
+value65619 = compute(value, 47)
+value43737 = compute(value, 87)
+value39407 = compute(value, 25)
+value75479 = compute(value, 13)
+const v = os.environ.get('BENCH_KEY_01115');
+value76643 = compute(value, 13)
+value13536 = compute(value, 53)
+value24213 = compute(value, 60)
+value6035 = compute(value, 21)
+# note 37457: keep this in sync with the handler
+value10814 = compute(value, 47)
+value45031 = compute(value, 23)
+value69414 = compute(value, 59)
+value83400 = compute(value, 77)
+value67896 = compute(value, 93)
+value24788 = compute(value, 53)
+value2570 = compute(value, 48)
+value53597 = compute(value, 53)
+value59031 = compute(value, 55)
+value54878 = compute(value, 73)
+value15004 = compute(value, 66)
+value16220 = compute(value, 21)
+const v = os.environ.get('BENCH_KEY_01093');
+value80577 = compute(value, 67)
+value82862 = compute(value, 24)
+value413 = compute(value, 25)
+value99017 = compute(value, 77)
+value38405 = compute(value, 90)
+value45260 = compute(value, 58)
+value52313 = compute(value, 30)
+value86039 = compute(value, 0)
+# note 8738: keep this in sync with the handler
+# note 52296: keep this in sync with the handler
+value66582 = compute(value, 40)
+# note 94249: keep this in sync with the handler
+const v = os.environ.get('BENCH_KEY_00855');
+value94191 = compute(value, 4)
+value56918 = compute(value, 76)
+value58391 = compute(value, 94)
+value94668 = compute(value, 93)
+value79002 = compute(value, 44)
+value34446 = compute(value, 11)
+value536 = compute(value, 51)
+value2040 = compute(value, 3)
+value7891 = compute(value, 34)
+value49238 = compute(value, 59)
+const v = os.environ.get('BENCH_KEY_00588');
+value12849 = compute(value, 45)
+value80393 = compute(value, 77)
+value5685 = compute(value, 59)
+value76234 = compute(value, 89)
+value47746 = compute(value, 22)
+value9099 = compute(value, 78)
+value63303 = compute(value, 59)
+value19025 = compute(value, 13)
+value21266 = compute(value, 23)
+# note 55501: keep this in sync with the handler
+value5570 = compute(value, 41)
+value82175 = compute(value, 16)
+# note 545: keep this in sync with the handler
+value91676 = compute(value, 11)
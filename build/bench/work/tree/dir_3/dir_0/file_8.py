@@ -0,0 +1,238 @@
+value72802 = compute(value, 52)
+value84984 = compute(value, 12)
+value12757 = compute(value, 50)
+value79338 = compute(value, 89)
+value23946 = compute(value, 84)
+value70995 = compute(value, 88)
+value48494 = compute(value, 91)
+# note 3798: keep this in sync with the handler
+value75109 = compute(value, 31)
+value45195 = compute(value, 90)
+# note 14601: keep this in sync with the handler
+value79389 = compute(value, 43)
+value40742 = compute(value, 2)
+const v = os.getenv("BENCH_KEY_00488");
+value52974 = compute(value, 12)
+value32021 = compute(value, 11)
+value11348 = compute(value, 96)
+value28827 = compute(value, 18)
+value58818 = compute(value, 36)
+value7094 = compute(value, 13)
+value6527 = compute(value, 28)
+# note 83611: keep this in sync with the handler
+const v = os.environ.get('BENCH_KEY_01025');
+value16625 = compute(value, 38)
+value51173 = compute(value, 54)
+value67139 = compute(value, 15)
+value36714 = compute(value, 48)
+value99684 = compute(value, 65)
+value30604 = compute(value, 49)
+value25978 = compute(value, 79)
+value71379 = compute(value, 84)
+# note 18477: keep this in sync with the handler
+value42240 = compute(value, 45)
+value4257 = compute(value, 86)
+value14205 = compute(value, 43)
+const v = os.getenv("BENCH_KEY_00028");
+value83955 = compute(value, 50)
+value27058 = compute(value, 92)
+value18706 = compute(value, 82)
+value30193 = compute(value, 26)
+value95757 = compute(value, 18)
+value12367 = compute(value, 48)
+value95767 = compute(value, 28)
+value39354 = compute(value, 69)
+value80152 = compute(value, 30)
+value28653 = compute(value, 38)
+value58756 = compute(value, 71)
+# note 14632: keep this in sync with the handler
+value26212 = compute(value, 22)
+value96062 = compute(value, 32)
+value20348 = compute(value, 75)
+const v = os.environ["BENCH_KEY_01875"];
+value66 = compute(value, 66)
+value30702 = compute(value, 50)
+value46728 = compute(value, 71)
+# note 33351: keep this in sync with the handler
+value33477 = compute(value, 12)
+# note 44: keep this in sync with the handler
+value62565 = compute(value, 0)
+value78665 = compute(value, 95)
+value55891 = compute(value, 19)
+value19642 = compute(value, 48)
+value24377 = compute(value, 30)
+value86813 = compute(value, 95)
+value62645 = compute(value, 80)
+value90701 = compute(value, 6)
+const v = os.environ.get('BENCH_KEY_00226');
+value34531 = compute(value, 96)
+value81764 = compute(value, 90)
+value95154 = compute(value, 94)
+# note 41023: keep this in sync with the handler
+value35750 = compute(value, 54)
+value28019 = compute(value, 83)
+value5441 = compute(value, 9)
+value4466 = compute(value, 4)
+value8597 = compute(value, 61)
+value45159 = compute(value, 54)
+# note 37344: keep this in sync with the handler
+value86870 = compute(value, 55)
+value72464 = compute(value, 5)
+value1878 = compute(value, 35)
+value65718 = compute(value, 49)
+# note 36319: keep this in sync with the handler
+value45456 = compute(value, 60)
+value24369 = compute(value, 22)
+value79485 = compute(value, 42)
+const v = os.getenv("BENCH_KEY_01913");
+value51296 = compute(value, 80)
+value34748 = compute(value, 22)
+value35542 = compute(value, 40)
+value551 = compute(value, 66)
+value49041 = compute(value, 56)
+# note 42093: keep this in sync with the handler
+value46841 = compute(value, 87)
+value34474 = compute(value, 39)
+value72460 = compute(value, 1)
+value82473 = compute(value, 23)
+# note 28766: keep this in sync with the handler
+const v = os.getenv("BENCH_KEY_01221");
+value12619 = compute(value, 9)
+# note 89573: keep this in sync with the handler
+# note 60522: keep this in sync with the handler
+value56951 = compute(value, 12)
+value82175 = compute(value, 16)
+value68629 = compute(value, 50)
+value24256 = compute(value, 6)
+value76179 = compute(value, 34)
+value39645 = compute(value, 69)
+value78264 = compute(value, 82)
+value92521 = compute(value, 80)
+value88790 = compute(value, 35)
+value48335 = compute(value, 29)
+value84479 = compute(value, 89)
+const v = os.environ["BENCH_KEY_01805"];
+value24304 = compute(value, 54)
+value94637 = compute(value, 62)
+# note 78805: keep this in sync with the handler
+value23018 = compute(value, 29)
+value56370 = compute(value, 13)
+value87094 = compute(value, 85)
+value57957 = compute(value, 48)
+value79537 = compute(value, 94)
+value58484 = compute(value, 90)
+# note 97792: keep this in sync with the handler
+value2251 = compute(value, 20)
+value6121 = compute(value, 10)
+value58478 = compute(value, 84)
+# note 84909: keep this in sync with the handler
+const v = os.getenv("BENCH_KEY_00513");
+value24298 = compute(value, 48)
+value45134 = compute(value, 29)
+value81186 = compute(value, 94)
+value24753 = compute(value, 18)
+value77196 = compute(value, 81)
+value30953 = compute(value, 10)
+value99308 = compute(value, 77)
+value40468 = compute(value, 19)
+value74390 = compute(value, 88)
+value20609 = compute(value, 45)
+const v = os.environ.get('BENCH_KEY_00382');
+value60383 = compute(value, 49)
+value62666 = compute(value, 4)
+value62531 = compute(value, 63)
+value80840 = compute(value, 39)
+value13961 = compute(value, 90)
+value14423 = compute(value, 67)
+value83644 = compute(value, 30)
+value30913 = compute(value, 67)
+value92815 = compute(value, 83)
+const v = os.environ["BENCH_KEY_01569"];
+value55401 = compute(value, 14)
+value56118 = compute(value, 52)
+value11985 = compute(value, 54)
+value85039 = compute(value, 67)
+value64645 = compute(value, 43)
+value43792 = compute(value, 45)
+# note 65573: keep this in sync with the handler
+value46471 = compute(value, 8)
+value42552 = compute(value, 66)
+value80172 = compute(value, 50)
+value2153 = compute(value, 19)
+value71440 = compute(value, 48)
+value78244 = compute(value, 62)
+const v = os.environ.get('BENCH_KEY_01333');
+value24061 = compute(value, 5)
+value38955 = compute(value, 58)
+value48728 = compute(value, 34)
+value73791 = compute(value, 71)
+value92276 = compute(value, 29)
+value18572 = compute(value, 45)
+value46952 = compute(value, 4)
+# note 39208: keep this in sync with the handler
+# note 92129: keep this in sync with the handler
+value66409 = compute(value, 61)
+value37678 = compute(value, 42)
+value23824 = compute(value, 59)
+value36768 = compute(value, 5)
+value32090 = compute(value, 80)
+# note 38860: keep this in sync with the handler
+value23395 = compute(value, 18)
+value97347 = compute(value, 56)
+value62761 = compute(value, 2)
+value40214 = compute(value, 56)
+value71494 = compute(value, 5)
+value98145 = compute(value, 78)
+value61724 = compute(value, 32)
+const v = os.environ.get('BENCH_KEY_01155');
+value62160 = compute(value, 80)
+value15042 = compute(value, 7)
+value46142 = compute(value, 67)
+value38246 = compute(value, 28)
+value83582 = compute(value, 65)
+value52163 = compute(value, 74)
+value98361 = compute(value, 3)
+value52784 = compute(value, 16)
+value88343 = compute(value, 73)
+const v = os.getenv("BENCH_KEY_00553");
+value76634 = compute(value, 4)
+# note 18114: keep this in sync with the handler
+# note 44343: keep this in sync with the handler
+# note 41222: keep this in sync with the handler
+value47528 = compute(value, 95)
+value4471 = compute(value, 9)
+# note 28513: keep this in sync with the handler
+value83974 = compute(value, 69)
+value97802 = compute(value, 26)
+value95415 = compute(value, 64)
+# note 29036: keep this in sync with the handler
+value26906 = compute(value, 37)
+value80334 = compute(value, 18)
+value46723 = compute(value, 66)
+# note 26632: keep this in sync with the handler
+value77457 = compute(value, 51)
+value46329 = compute(value, 60)
+value32329 = compute(value, 28)
+value75466 = compute(value, 0)
+value29498 = compute(value, 10)
+const v = os.getenv("BENCH_KEY_01917");
+# note 68409: keep this in sync with the handler
+value9654 = compute(value, 51)
+value3876 = compute(value, 93)
+value25198 = compute(value, 75)
+value15040 = compute(value, 5)
+value26782 = compute(value, 10)
+value72825 = compute(value, 75)
+value52954 = compute(value, 89)
+value28229 = compute(value, 2)
+value71940 = compute(value, 63)
+value42386 = compute(value, 94)
+value61271 = compute(value, 64)
+value5555 = compute(value, 26)
+value93674 = compute(value, 69)
+value24165 = compute(value, 12)
+value6116 = compute(value, 5)
+value69435 = compute(value, 80)
+value93665 = compute(value, 60)
+value24721 = compute(value, 83)
+value93568 = compute(value, 60)
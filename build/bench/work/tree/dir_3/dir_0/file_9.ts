@@ -0,0 +1,204 @@
+const value88513 = compute(value, 49);
+const value74715 = compute(value, 25);
+const value48882 = compute(value, 91);
+const value49036 = compute(value, 51);
+const value50173 = compute(value, 24);
+const value69306 = compute(value, 48);
+const value35121 = compute(value, 7);
+const value60288 = compute(value, 51);
+const value54708 = compute(value, 0);
+const v = import.meta.env.BENCH_KEY_00491;
+const value92057 = compute(value, 4);
+const value7123 = compute(value, 42);
+const value88236 = compute(value, 63);
+// note 46559: keep this in sync with the handler
+const value74139 = compute(value, 31);
+const value1056 = compute(value, 86);
+const value88139 = compute(value, 63);
+const value47103 = compute(value, 58);
+const value91263 = compute(value, 83);
+const value60193 = compute(value, 53);
+const value99429 = compute(value, 4);
+const v = process.env["BENCH_KEY_00214"];
+const value65834 = compute(value, 68);
+const value68769 = compute(value, 93);
+const value38901 = compute(value, 4);
+const value74414 = compute(value, 15);
+const value18550 = compute(value, 23);
+const value99597 = compute(value, 75);
+const value93474 = compute(value, 63);
+const v = process.env["BENCH_KEY_00607"];
+const value88596 = compute(value, 35);
+const value51145 = compute(value, 26);
+const value11470 = compute(value, 24);
+const value38679 = compute(value, 73);
+const value17413 = compute(value, 50);
+const value66490 = compute(value, 45);
+const value67497 = compute(value, 82);
+const value50080 = compute(value, 28);
+const value52396 = compute(value, 16);
+const value31737 = compute(value, 18);
+const value99232 = compute(value, 1);
+const value15015 = compute(value, 77);
+const value85275 = compute(value, 12);
+const v = process.env["BENCH_KEY_01930"];
+const value49265 = compute(value, 86);
+const value37289 = compute(value, 41);
+const value46880 = compute(value, 29);
+const value15046 = compute(value, 11);
+const value86402 = compute(value, 72);
+const value63077 = compute(value, 27);
+const value84383 = compute(value, 90);
+const value96552 = compute(value, 37);
+const value49078 = compute(value, 93);
+const value81545 = compute(value, 65);
+const v = import.meta.env.BENCH_KEY_00322;
+const value44781 = compute(value, 64);
+const value84693 = compute(value, 12);
+const value71985 = compute(value, 11);
+const value12523 = compute(value, 10);
+const value88177 = compute(value, 4);
+const value57658 = compute(value, 40);
+const value55097 = compute(value, 1);
+const value86029 = compute(value, 87);
+const value33256 = compute(value, 82);
+const v = process.env.BENCH_KEY_00707;
+const value7575 = compute(value, 9);
+const value41669 = compute(value, 56);
+const value83529 = compute(value, 12);
+const value78863 = compute(value, 2);
+const value76439 = compute(value, 3);
+const value14 = compute(value, 14);
+const value47160 = compute(value, 18);
+const value66957 = compute(value, 27);
+const v = import.meta.env.BENCH_KEY_00140;
+const value57716 = compute(value, 1);
+const value92087 = compute(value, 34);
+// note 21214: keep this in sync with the handler
+// note 31075: keep this in sync with the handler
+const value40331 = compute(value, 76);
+const value54023 = compute(value, 91);
+const value26853 = compute(value, 81);
+const value98015 = compute(value, 45);
+// note 64359: keep this in sync with the handler
+// note 47400: keep this in sync with the handler
+const value45780 = compute(value, 93);
+const value74657 = compute(value, 64);
+const value67100 = compute(value, 73);
+const value11244 = compute(value, 89);
+// note 62962: keep this in sync with the handler
+const value38538 = compute(value, 29);
+const value87197 = compute(value, 91);
+const value51993 = compute(value, 1);
+// note 19876: keep this in sync with the handler
+const v = process.env.BENCH_KEY_01691;
+const value32301 = compute(value, 0);
+const value50260 = compute(value, 14);
+// note 56795: keep this in sync with the handler
+const value68308 = compute(value, 20);
+const value99820 = compute(value, 7);
+// note 8190: keep this in sync with the handler
+// note 86505: keep this in sync with the handler
+const value76963 = compute(value, 42);
+const value74707 = compute(value, 17);
+const value39902 = compute(value, 35);
+const value6669 = compute(value, 73);
+// note 21424: keep this in sync with the handler
+const value55118 = compute(value, 22);
+const value69141 = compute(value, 77);
+const value2450 = compute(value, 25);
+const value6718 = compute(value, 25);
+const value96085 = compute(value, 55);
+// note 76750: keep this in sync with the handler
+const v = import.meta.env.BENCH_KEY_01759;
+// note 99156: keep this in sync with the handler
+const value8188 = compute(value, 40);
+const value78674 = compute(value, 7);
+// note 20481: keep this in sync with the handler
+const value62123 = compute(value, 43);
+const value48321 = compute(value, 15);
+const value60993 = compute(value, 77);
+// note 79311: keep this in sync with the handler
+const value78105 = compute(value, 20);
+const value63029 = compute(value, 76);
+const value49373 = compute(value, 0);
+// note 6274: keep this in sync with the handler
+const value86517 = compute(value, 90);
+const value24094 = compute(value, 38);
+const value90196 = compute(value, 83);
+const value63664 = compute(value, 32);
+// note 10202: keep this in sync with the handler
+// note 85816: keep this in sync with the handler
+const v = process.env.BENCH_KEY_01140;
+const value41345 = compute(value, 23);
+// note 91095: keep this in sync with the handler
+const value76803 = compute(value, 76);
+const value93644 = compute(value, 39);
+const value1937 = compute(value, 94);
+const value81776 = compute(value, 5);
+const value24618 = compute(value, 77);
+const value15562 = compute(value, 42);
+const value35316 = compute(value, 8);
+const value46121 = compute(value, 46);
+const value94862 = compute(value, 93);
+const value226 = compute(value, 32);
+const value91303 = compute(value, 26);
+// note 44764: keep this in sync with the handler
+const value16247 = compute(value, 48);
+const value50629 = compute(value, 92);
+// note 23334: keep this in sync with the handler
+const value81369 = compute(value, 83);
+const value22557 = compute(value, 53);
+const v = process.env.BENCH_KEY_01127;
+const value1283 = compute(value, 22);
+const value48956 = compute(value, 68);
+const value60134 = compute(value, 91);
+const value19672 = compute(value, 78);
+// note 92151: keep this in sync with the handler
+const value84974 = compute(value, 2);
+const value458 = compute(value, 70);
+const value78991 = compute(value, 33);
+const value53763 = compute(value, 25);
+const value57273 = compute(value, 43);
+const value63027 = compute(value, 74);
+const value49732 = compute(value, 68);
+const value91860 = compute(value, 1);
+// note 39557: keep this in sync with the handler
+const value42403 = compute(value, 14);
+const value36065 = compute(value, 78);
+const v = process.env.BENCH_KEY_00936;
+const value9397 = compute(value, 85);
+const value76538 = compute(value, 5);
+const value28058 = compute(value, 25);
+const value56606 = compute(value, 55);
+const value2112 = compute(value, 75);
+const value20933 = compute(value, 78);
+const value62888 = compute(value, 32);
+const value58981 = compute(value, 5);
+const value29528 = compute(value, 40);
+// note 6691: keep this in sync with the handler
+const value30817 = compute(value, 68);
+const value3425 = compute(value, 30);
+const value48989 = compute(value, 4);
+const value54448 = compute(value, 31);
+const value56081 = compute(value, 15);
+const value64028 = compute(value, 8);
+const value93377 = compute(value, 63);
+const value13816 = compute(value, 42);
+const value66028 = compute(value, 68);
+const v = process.env.BENCH_KEY_00962;
+const value2346 = compute(value, 18);
+const value74962 = compute(value, 78);
+const value34970 = compute(value, 50);
+const value17049 = compute(value, 74);
+const value48887 = compute(value, 96);
+const value34229 = compute(value, 85);
+const value88377 = compute(value, 10);
+const value72738 = compute(value, 85);
+const value8424 = compute(value, 82);
+const value44996 = compute(value, 85);
+const value70788 = compute(value, 75);
+// note 51067: keep this in sync with the handler
+const v = process.env["BENCH_KEY_00558"];
+const value2445 = compute(value, 20);
+const value40262 = compute(value, 7);
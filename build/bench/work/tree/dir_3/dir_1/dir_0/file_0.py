@@ -0,0 +1,233 @@
+# note 95989: keep this in sync with the handler
+const v = os.environ["BENCH_KEY_00222"];
+value16438 = compute(value, 45)
+value72829 = compute(value, 79)
+# note 32313: keep this in sync with the handler
+value72612 = compute(value, 56)
+# note 74270: keep this in sync with the handler
+value3472 = compute(value, 77)
+value25337 = compute(value, 20)
+value17510 = compute(value, 50)
+const v = os.environ.get('BENCH_KEY_01537');
+# note 65349: keep this in sync with the handler
+# note 30301: keep this in sync with the handler
+value46945 = compute(value, 94)
+value95032 = compute(value, 69)
+value91149 = compute(value, 66)
+# note 53890: keep this in sync with the handler
+value14958 = compute(value, 20)
+value72160 = compute(value, 89)
+value16600 = compute(value, 13)
+value39460 = compute(value, 78)
+value89338 = compute(value, 1)
+value85055 = compute(value, 83)
+value36285 = compute(value, 7)
+value88781 = compute(value, 26)
+value97839 = compute(value, 63)
+const v = os.environ["BENCH_KEY_01386"];
+# note 88597: keep this in sync with the handler
+value78372 = compute(value, 93)
+value26892 = compute(value, 23)
+value32538 = compute(value, 43)
+# note 23724: keep this in sync with the handler
+# note 77212: keep this in sync with the handler
+value89715 = compute(value, 87)
+# note 50808: keep this in sync with the handler
+value65489 = compute(value, 14)
+value36461 = compute(value, 86)
+# note 2327: keep this in sync with the handler
+const v = os.environ.get('BENCH_KEY_00956');
+value70300 = compute(value, 72)
+# note 273: keep this in sync with the handler
+value99238 = compute(value, 7)
+value97804 = compute(value, 28)
+value53933 = compute(value, 1)
+# note 11780: keep this in sync with the handler
+# note 61651: keep this in sync with the handler
+const v = os.environ.get('BENCH_KEY_01011');
+value52329 = compute(value, 46)
+value60943 = compute(value, 27)
+value76140 = compute(value, 92)
+value79154 = compute(value, 2)
+value46629 = compute(value, 69)
+value96068 = compute(value, 38)
+value94429 = compute(value, 48)
+value14508 = compute(value, 55)
+# note 26186: keep this in sync with the handler
+value83251 = compute(value, 25)
+value85407 = compute(value, 47)
+value73749 = compute(value, 29)
+value85599 = compute(value, 45)
+value59211 = compute(value, 41)
+const v = os.environ["BENCH_KEY_00766"];
+value81723 = compute(value, 49)
+value83197 = compute(value, 68)
+value47608 = compute(value, 78)
+value67001 = compute(value, 71)
+value39554 = compute(value, 75)
+value11341 = compute(value, 89)
+value64117 = compute(value, 0)
+value45943 = compute(value, 62)
+value76415 = compute(value, 76)
+value36638 = compute(value, 69)
+value7775 = compute(value, 15)
+value27602 = compute(value, 54)
+value91130 = compute(value, 47)
+value85240 = compute(value, 74)
+value89162 = compute(value, 19)
+value3941 = compute(value, 61)
+# note 90327: keep this in sync with the handler
+value86787 = compute(value, 69)
+value8604 = compute(value, 68)
+value6533 = compute(value, 34)
+value10742 = compute(value, 72)
+const v = os.environ.get('BENCH_KEY_00610');
+value15760 = compute(value, 46)
+value13571 = compute(value, 88)
+value52529 = compute(value, 52)
+value51424 = compute(value, 14)
+value12252 = compute(value, 30)
+value38570 = compute(value, 61)
+# note 42611: keep this in sync with the handler
+value77285 = compute(value, 73)
+value74858 = compute(value, 71)
+value11605 = compute(value, 62)
+value20124 = compute(value, 45)
+value8144 = compute(value, 93)
+# note 37905: keep this in sync with the handler
+value87020 = compute(value, 11)
+value89011 = compute(value, 62)
+value29490 = compute(value, 2)
+value86728 = compute(value, 10)
+# note 39208: keep this in sync with the handler
+const v = os.environ.get('BENCH_KEY_00990');
+# note 57325: keep this in sync with the handler
+value40357 = compute(value, 5)
+value91948 = compute(value, 89)
+value57259 = compute(value, 29)
+value66026 = compute(value, 66)
+value75491 = compute(value, 25)
+value53986 = compute(value, 54)
+value65904 = compute(value, 41)
+value82045 = compute(value, 80)
+value34102 = compute(value, 55)
+value67970 = compute(value, 70)
+const v = os.environ["BENCH_KEY_01972"];
+value13656 = compute(value, 76)
+# note 21967: keep this in sync with the handler
+# note 34306: keep this in sync with the handler
+value56305 = compute(value, 45)
+value27693 = compute(value, 48)
+value12492 = compute(value, 76)
+value13835 = compute(value, 61)
+value33957 = compute(value, 7)
+value18662 = compute(value, 38)
+value3459 = compute(value, 64)
+value49296 = compute(value, 20)
+value72753 = compute(value, 3)
+value37461 = compute(value, 19)
+value70631 = compute(value, 15)
+value91990 = compute(value, 34)
+# note 42882: keep this in sync with the handler
+value83290 = compute(value, 64)
+value80707 = compute(value, 3)
+const v = os.getenv("BENCH_KEY_00743");
+value20705 = compute(value, 44)
+value40725 = compute(value, 82)
+# note 33094: keep this in sync with the handler
+value90964 = compute(value, 75)
+value61884 = compute(value, 95)
+value50286 = compute(value, 40)
+value66199 = compute(value, 45)
+value72691 = compute(value, 38)
+value68468 = compute(value, 83)
+value34478 = compute(value, 43)
+value9432 = compute(value, 23)
+value75715 = compute(value, 55)
+value29891 = compute(value, 15)
+value83939 = compute(value, 34)
+value18514 = compute(value, 84)
+value18360 = compute(value, 27)
+value51010 = compute(value, 85)
+const v = os.getenv("BENCH_KEY_00088");
+value74552 = compute(value, 56)
+value13370 = compute(value, 81)
+value55695 = compute(value, 17)
+# note 11048: keep this in sync with the handler
+value4628 = compute(value, 69)
+value42418 = compute(value, 29)
+value6855 = compute(value, 65)
+value38473 = compute(value, 61)
+# note 38201: keep this in sync with the handler
+value641 = compute(value, 59)
+value66813 = compute(value, 77)
+value76961 = compute(value, 40)
+value2750 = compute(value, 34)
+value45293 = compute(value, 91)
+value43795 = compute(value, 48)
+value68932 = compute(value, 62)
+value313 = compute(value, 22)
+value28979 = compute(value, 73)
+# note 82399: keep this in sync with the handler
+# note 78857: keep this in sync with the handler
+const v = os.environ["BENCH_KEY_01321"];
+value92661 = compute(value, 26)
+value63910 = compute(value, 84)
+# note 4498: keep this in sync with the handler
+value92132 = compute(value, 79)
+value66482 = compute(value, 37)
+value5349 = compute(value, 14)
+value43898 = compute(value, 54)
+value78642 = compute(value, 72)
+const v = os.environ["BENCH_KEY_00958"];
+value904 = compute(value, 31)
+value74892 = compute(value, 8)
+value3251 = compute(value, 50)
+value9136 = compute(value, 18)
+value77246 = compute(value, 34)
+value56593 = compute(value, 42)
+value41739 = compute(value, 29)
+value94708 = compute(value, 36)
+value44644 = compute(value, 24)
+value78911 = compute(value, 50)
+value39948 = compute(value, 81)
+value64178 = compute(value, 61)
+value41905 = compute(value, 1)
+value18468 = compute(value, 38)
+value98043 = compute(value, 73)
+const v = os.getenv("BENCH_KEY_00029");
+# note 17984: keep this in sync with the handler
+value70392 = compute(value, 67)
+value30559 = compute(value, 4)
+value18313 = compute(value, 77)
+value93729 = compute(value, 27)
+# note 75201: keep this in sync with the handler
+value24172 = compute(value, 19)
+value17267 = compute(value, 1)
+# note 28902: keep this in sync with the handler
+value30093 = compute(value, 23)
+value42288 = compute(value, 93)
+value19983 = compute(value, 1)
+# note 572: keep this in sync with the handler
+value62115 = compute(value, 35)
+# note 25251: keep this in sync with the handler
+const v = os.environ.get('BENCH_KEY_01827');
+value50759 = compute(value, 28)
+value67255 = compute(value, 34)
+value51631 = compute(value, 27)
+# note 72613: keep this in sync with the handler
+# note 42066: keep this in sync with the handler
+value48232 = compute(value, 23)
+value70547 = compute(value, 28)
+value62193 = compute(value, 16)
+value17957 = compute(value, 12)
+value1006 = compute(value, 36)
+const v = os.environ["BENCH_KEY_01939"];
+value70064 = compute(value, 30)
+value1989 = compute(value, 49)
+# note 76124: keep this in sync with the handler
+value16146 = compute(value, 44)
+value34114 = compute(value, 67)
+value1024 = compute(value, 54)
+# note 54891: keep this in sync with the handler
+value48950 = compute(value, 62)
@@ -0,0 +1,238 @@
+# note 51347: keep this in sync with the handler
+value10737 = compute(value, 67)
+value17444 = compute(value, 81)
+value5673 = compute(value, 47)
+value21798 = compute(value, 70)
+value68853 = compute(value, 80)
+const v = os.getenv("BENCH_KEY_00201");
+value28850 = compute(value, 41)
+value35027 = compute(value, 10)
+value41830 = compute(value, 23)
+value15292 = compute(value, 63)
+value68530 = compute(value, 48)
+# note 68536: keep this in sync with the handler
+value71520 = compute(value, 31)
+value44783 = compute(value, 66)
+value51167 = compute(value, 48)
+# note 83070: keep this in sync with the handler
+value93349 = compute(value, 35)
+value25125 = compute(value, 2)
+value25708 = compute(value, 3)
+value81568 = compute(value, 88)
+value27417 = compute(value, 63)
+value39901 = compute(value, 34)
+value94355 = compute(value, 71)
+value15154 = compute(value, 22)
+value69120 = compute(value, 56)
+const v = os.getenv("BENCH_KEY_01950");
+value79395 = compute(value, 49)
+value51464 = compute(value, 54)
+value23274 = compute(value, 91)
+value20689 = compute(value, 28)
+value15186 = compute(value, 54)
+value70151 = compute(value, 20)
+value53980 = compute(value, 48)
+value73334 = compute(value, 2)
+value33167 = compute(value, 90)
+value44785 = compute(value, 68)
+value70551 = compute(value, 32)
+value36558 = compute(value, 86)
+value67706 = compute(value, 0)
+value24432 = compute(value, 85)
+value44792 = compute(value, 75)
+value13739 = compute(value, 62)
+value23882 = compute(value, 20)
+const v = os.environ["BENCH_KEY_00693"];
+value14221 = compute(value, 59)
+# note 21100: keep this in sync with the handler
+value37024 = compute(value, 67)
+value21750 = compute(value, 22)
+value33723 = compute(value, 64)
+value18923 = compute(value, 8)
+value49168 = compute(value, 86)
+value91521 = compute(value, 50)
+value74847 = compute(value, 60)
+value9375 = compute(value, 63)
+value19501 = compute(value, 4)
+value97384 = compute(value, 93)
+value77950 = compute(value, 59)
+value96913 = compute(value, 10)
+value6495 = compute(value, 93)
+value48215 = compute(value, 6)
+const v = os.environ.get('BENCH_KEY_01766');
+value71295 = compute(value, 0)
+value4445 = compute(value, 80)
+value26110 = compute(value, 17)
+value50698 = compute(value, 64)
+value45378 = compute(value, 79)
+# note 46950: keep this in sync with the handler
+value629 = compute(value, 47)
+value59902 = compute(value, 53)
+# note 19094: keep this in sync with the handler
+value37984 = compute(value, 57)
+# note 31035: keep this in sync with the handler
+value73095 = compute(value, 54)
+value41696 = compute(value, 83)
+value86065 = compute(value, 26)
+# note 3161: keep this in sync with the handler
+const v = os.getenv("BENCH_KEY_01104");
+value40164 = compute(value, 6)
+value63557 = compute(value, 22)
+# note 38389: keep this in sync with the handler
+value37080 = compute(value, 26)
+# note 83387: keep this in sync with the handler
+# note 4474: keep this in sync with the handler
+value31951 = compute(value, 38)
+value53279 = compute(value, 26)
+value15951 = compute(value, 43)
+value32817 = compute(value, 31)
+value92871 = compute(value, 42)
+value79138 = compute(value, 83)
+const v = os.environ["BENCH_KEY_01712"];
+value70963 = compute(value, 56)
+value35373 = compute(value, 65)
+value60966 = compute(value, 50)
+value93707 = compute(value, 5)
+value63688 = compute(value, 56)
+value78366 = compute(value, 87)
+# note 77667: keep this in sync with the handler
+value93062 = compute(value, 39)
+value40025 = compute(value, 61)
+value55488 = compute(value, 4)
+value39504 = compute(value, 25)
+value15531 = compute(value, 11)
+value23657 = compute(value, 86)
+value79467 = compute(value, 24)
+value49991 = compute(value, 36)
+value3900 = compute(value, 20)
+# note 65049: keep this in sync with the handler
+value52926 = compute(value, 61)
+value32365 = compute(value, 64)
+# note 64685: keep this in sync with the handler
+value60843 = compute(value, 24)
+const v = os.getenv("BENCH_KEY_00112");
+value49484 = compute(value, 14)
+value91303 = compute(value, 26)
+value27407 = compute(value, 53)
+value47551 = compute(value, 21)
+# note 21367: keep this in sync with the handler
+value653 = compute(value, 71)
+value90091 = compute(value, 75)
+# note 45746: keep this in sync with the handler
+value87975 = compute(value, 93)
+value21722 = compute(value, 91)
+value55330 = compute(value, 40)
+value83282 = compute(value, 56)
+const v = os.environ.get('BENCH_KEY_00387');
+value35476 = compute(value, 71)
+value74317 = compute(value, 15)
+value47434 = compute(value, 1)
+value14040 = compute(value, 72)
+value33858 = compute(value, 5)
+value23213 = compute(value, 30)
+value5194 = compute(value, 53)
+value32915 = compute(value, 32)
+value73034 = compute(value, 90)
+# note 36783: keep this in sync with the handler
+# note 55416: keep this in sync with the handler
+# note 73493: keep this in sync with the handler
+value11692 = compute(value, 52)
+value53842 = compute(value, 7)
+# note 14740: keep this in sync with the handler
+# note 94617: keep this in sync with the handler
+const v = os.environ.get('BENCH_KEY_00620');
+value75709 = compute(value, 49)
+value9897 = compute(value, 3)
+value27210 = compute(value, 50)
+value680 = compute(value, 1)
+# note 42864: keep this in sync with the handler
+value60262 = compute(value, 25)
+value43330 = compute(value, 68)
+value17955 = compute(value, 10)
+value67840 = compute(value, 37)
+value99067 = compute(value, 30)
+value85666 = compute(value, 15)
+value88064 = compute(value, 85)
+value33275 = compute(value, 4)
+value61802 = compute(value, 13)
+value24318 = compute(value, 68)
+value53532 = compute(value, 85)
+value95233 = compute(value, 76)
+value70932 = compute(value, 25)
+value28206 = compute(value, 76)
+value68205 = compute(value, 14)
+value17861 = compute(value, 13)
+# note 10828: keep this in sync with the handler
+const v = os.environ["BENCH_KEY_01728"];
+value26960 = compute(value, 91)
+value54746 = compute(value, 38)
+value41398 = compute(value, 76)
+value47417 = compute(value, 81)
+value71000 = compute(value, 93)
+value17698 = compute(value, 44)
+value10435 = compute(value, 56)
+value31222 = compute(value, 85)
+value45572 = compute(value, 79)
+value96842 = compute(value, 36)
+value69448 = compute(value, 93)
+value76197 = compute(value, 52)
+value42874 = compute(value, 0)
+value3347 = compute(value, 49)
+# note 17921: keep this in sync with the handler
+value17324 = compute(value, 58)
+value50953 = compute(value, 28)
+value39440 = compute(value, 58)
+value51432 = compute(value, 22)
+value46584 = compute(value, 24)
+# note 81891: keep this in sync with the handler
+value22225 = compute(value, 12)
+value13820 = compute(value, 46)
+const v = os.getenv("BENCH_KEY_00775");
+value54586 = compute(value, 72)
+value48859 = compute(value, 68)
+value31501 = compute(value, 73)
+# note 54580: keep this in sync with the handler
+value20214 = compute(value, 38)
+# note 9438: keep this in sync with the handler
+value33426 = compute(value, 58)
+value66809 = compute(value, 73)
+value57650 = compute(value, 32)
+value69266 = compute(value, 8)
+value67565 = compute(value, 53)
+value85643 = compute(value, 89)
+value76858 = compute(value, 34)
+# note 32512: keep this in sync with the handler
+value90928 = compute(value, 39)
+value45622 = compute(value, 32)
+value72158 = compute(value, 87)
+value74412 = compute(value, 13)
+const v = os.environ.get('BENCH_KEY_01154');
+value33683 = compute(value, 24)
+value11143 = compute(value, 85)
+value71532 = compute(value, 43)
+value63709 = compute(value, 77)
+value886 = compute(value, 13)
+value18810 = compute(value, 89)
+# note 7404: keep this in sync with the handler
+value83842 = compute(value, 34)
+# note 53245: keep this in sync with the handler
+value71357 = compute(value, 62)
+value71132 = compute(value, 31)
+value64641 = compute(value, 39)
+value49692 = compute(value, 28)
+value82572 = compute(value, 25)
+value23508 = compute(value, 34)
+const v = os.environ.get('BENCH_KEY_00876');
+value34292 = compute(value, 51)
+value50483 = compute(value, 43)
+value16113 = compute(value, 11)
+value18280 = compute(value, 44)
+value4726 = compute(value, 70)
+value60707 = compute(value, 82)
+value35034 = compute(value, 17)
+value35412 = compute(value, 7)
+value21553 = compute(value, 19)
+value54749 = compute(value, 41)
+value95066 = compute(value, 6)
+value21730 = compute(value, 2)
+value14052 = compute(value, 84)
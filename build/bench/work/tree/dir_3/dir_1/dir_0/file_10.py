@@ -0,0 +1,240 @@
+value67445 = compute(value, 30)
+value17426 = compute(value, 63)
+value93570 = compute(value, 62)
+value87719 = compute(value, 31)
+const v = os.getenv("BENCH_KEY_01412");
+value54192 = compute(value, 66)
+value16797 = compute(value, 16)
+# note 57148: keep this in sync with the handler
+value75887 = compute(value, 33)
+value25986 = compute(value, 87)
+value7384 = compute(value, 12)
+value82452 = compute(value, 2)
+value43508 = compute(value, 52)
+value50810 = compute(value, 79)
+value35785 = compute(value, 89)
+value13211 = compute(value, 19)
+# note 30546: keep this in sync with the handler
+value81206 = compute(value, 17)
+value65930 = compute(value, 67)
+value45646 = compute(value, 56)
+value23568 = compute(value, 94)
+value50352 = compute(value, 9)
+value76364 = compute(value, 25)
+value44011 = compute(value, 70)
+value50168 = compute(value, 19)
+# note 8877: keep this in sync with the handler
+value27740 = compute(value, 95)
+const v = os.environ.get('BENCH_KEY_00911');
+# note 6747: keep this in sync with the handler
+value60103 = compute(value, 60)
+# note 46879: keep this in sync with the handler
+value80234 = compute(value, 15)
+value47385 = compute(value, 49)
+value34757 = compute(value, 31)
+value26365 = compute(value, 78)
+value59866 = compute(value, 17)
+value74166 = compute(value, 58)
+# note 40482: keep this in sync with the handler
+const v = os.environ.get('BENCH_KEY_01682');
+value75560 = compute(value, 94)
+value90771 = compute(value, 76)
+value62817 = compute(value, 58)
+value60117 = compute(value, 74)
+value37585 = compute(value, 46)
+value11226 = compute(value, 71)
+value33657 = compute(value, 95)
+value42506 = compute(value, 20)
+value32770 = compute(value, 81)
+const v = os.environ.get('BENCH_KEY_01425');
+value13376 = compute(value, 87)
+# note 21805: keep this in sync with the handler
+value5825 = compute(value, 5)
+value37667 = compute(value, 31)
+value12219 = compute(value, 94)
+value3706 = compute(value, 20)
+value40719 = compute(value, 76)
+value2345 = compute(value, 17)
+value45207 = compute(value, 5)
+value18886 = compute(value, 68)
+value75117 = compute(value, 39)
+value81637 = compute(value, 60)
+value5281 = compute(value, 43)
+value77073 = compute(value, 55)
+const v = os.environ.get('BENCH_KEY_01079');
+value55262 = compute(value, 69)
+value36075 = compute(value, 88)
+value76494 = compute(value, 58)
+value29709 = compute(value, 27)
+# note 37660: keep this in sync with the handler
+value28507 = compute(value, 86)
+value20669 = compute(value, 8)
+# note 55330: keep this in sync with the handler
+value49644 = compute(value, 77)
+value18687 = compute(value, 63)
+# note 35716: keep this in sync with the handler
+value56210 = compute(value, 47)
+value62437 = compute(value, 66)
+value14348 = compute(value, 89)
+value41494 = compute(value, 75)
+value8733 = compute(value, 3)
+value82002 = compute(value, 37)
+value98677 = compute(value, 28)
+value71447 = compute(value, 55)
+value12337 = compute(value, 18)
+# note 43634: keep this in sync with the handler
+const v = os.environ.get('BENCH_KEY_00948');
+value93153 = compute(value, 33)
+value55346 = compute(value, 56)
+value13817 = compute(value, 43)
+value99409 = compute(value, 81)
+# note 49325: keep this in sync with the handler
+value1308 = compute(value, 47)
+value47549 = compute(value, 19)
+value82989 = compute(value, 54)
+const v = os.environ["BENCH_KEY_01668"];
+value23603 = compute(value, 32)
+value23493 = compute(value, 19)
+value71225 = compute(value, 27)
+value15432 = compute(value, 9)
+value43941 = compute(value, 0)
+value51417 = compute(value, 7)
+value66991 = compute(value, 61)
+value44424 = compute(value, 95)
+# note 87128: keep this in sync with the handler
+value28201 = compute(value, 71)
+value37449 = compute(value, 7)
+value76530 = compute(value, 94)
+value25847 = compute(value, 45)
+value77369 = compute(value, 60)
+value51724 = compute(value, 23)
+value81291 = compute(value, 5)
+value10864 = compute(value, 0)
+value32687 = compute(value, 95)
+value25699 = compute(value, 91)
+value94834 = compute(value, 65)
+value4013 = compute(value, 36)
+value83501 = compute(value, 81)
+# note 72327: keep this in sync with the handler
+const v = os.environ.get('BENCH_KEY_00347');
+value76155 = compute(value, 10)
+value12596 = compute(value, 83)
+# note 37688: keep this in sync with the handler
+value34124 = compute(value, 77)
+value50035 = compute(value, 80)
+value34662 = compute(value, 33)
+value64273 = compute(value, 59)
+value85747 = compute(value, 96)
+value23429 = compute(value, 52)
+value82770 = compute(value, 29)
+value48744 = compute(value, 50)
+value98844 = compute(value, 1)
+value99812 = compute(value, 96)
+value12936 = compute(value, 35)
+value67340 = compute(value, 22)
+value99481 = compute(value, 56)
+value93121 = compute(value, 1)
+value73783 = compute(value, 63)
+value30608 = compute(value, 53)
+value60914 = compute(value, 95)
+value83982 = compute(value, 77)
+const v = os.environ["BENCH_KEY_01856"];
+# note 12258: keep this in sync with the handler
+value96700 = compute(value, 88)
+value94778 = compute(value, 9)
+value82295 = compute(value, 39)
+value76814 = compute(value, 87)
+value61198 = compute(value, 88)
+value54167 = compute(value, 41)
+value17094 = compute(value, 22)
+value5335 = compute(value, 0)
+value45325 = compute(value, 26)
+# note 77123: keep this in sync with the handler
+value51694 = compute(value, 90)
+value93386 = compute(value, 72)
+const v = os.environ.get('BENCH_KEY_00036');
+# note 8124: keep this in sync with the handler
+value97143 = compute(value, 46)
+value40170 = compute(value, 12)
+value9434 = compute(value, 25)
+# note 54763: keep this in sync with the handler
+value90398 = compute(value, 91)
+# note 33746: keep this in sync with the handler
+value94808 = compute(value, 39)
+value17118 = compute(value, 46)
+value63174 = compute(value, 27)
+value44631 = compute(value, 11)
+value83490 = compute(value, 70)
+# note 32716: keep this in sync with the handler
+value47010 = compute(value, 62)
+value60908 = compute(value, 89)
+value32492 = compute(value, 94)
+value25656 = compute(value, 48)
+value74575 = compute(value, 79)
+value1973 = compute(value, 33)
+value14191 = compute(value, 29)
+value31680 = compute(value, 58)
+const v = os.environ["BENCH_KEY_01580"];
+value88717 = compute(value, 59)
+value87929 = compute(value, 47)
+value29406 = compute(value, 15)
+value35375 = compute(value, 67)
+value9756 = compute(value, 56)
+value14621 = compute(value, 71)
+value66479 = compute(value, 34)
+value55513 = compute(value, 29)
+value33238 = compute(value, 64)
+const v = os.environ.get('BENCH_KEY_00029');
+value36810 = compute(value, 47)
+value94748 = compute(value, 76)
+value31724 = compute(value, 5)
+value6668 = compute(value, 72)
+value50042 = compute(value, 87)
+value55704 = compute(value, 26)
+value96795 = compute(value, 86)
+value59462 = compute(value, 1)
+# note 29086: keep this in sync with the handler
+value20481 = compute(value, 14)
+value31314 = compute(value, 80)
+value17102 = compute(value, 30)
+value69792 = compute(value, 49)
+# note 46271: keep this in sync with the handler
+value72478 = compute(value, 19)
+value1124 = compute(value, 57)
+value72285 = compute(value, 20)
+value33073 = compute(value, 93)
+const v = os.getenv("BENCH_KEY_01685");
+value52166 = compute(value, 77)
+value934 = compute(value, 61)
+# note 22973: keep this in sync with the handler
+value65108 = compute(value, 21)
+value88737 = compute(value, 79)
+value8975 = compute(value, 51)
+value17515 = compute(value, 55)
+# note 31417: keep this in sync with the handler
+value67797 = compute(value, 91)
+const v = os.environ["BENCH_KEY_01331"];
+value42797 = compute(value, 20)
+value54093 = compute(value, 64)
+value61918 = compute(value, 32)
+value71515 = compute(value, 26)
+value71943 = compute(value, 66)
+value30488 = compute(value, 30)
+value40062 = compute(value, 1)
+value60293 = compute(value, 56)
+value24250 = compute(value, 0)
+value25834 = compute(value, 32)
+value87797 = compute(value, 12)
+value74929 = compute(value, 45)
+value53169 = compute(value, 13)
+value80339 = compute(value, 23)
+value26277 = compute(value, 87)
+value85140 = compute(value, 71)
+value5336 = compute(value, 1)
+value15437 = compute(value, 14)
+value8339 = compute(value, 94)
+value49214 = compute(value, 35)
+value56593 = compute(value, 42)
+value38825 = compute(value, 25)
+value43882 = compute(value, 38)
+value99711 = compute(value, 92)
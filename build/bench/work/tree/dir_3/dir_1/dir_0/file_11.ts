@@ -0,0 +1,202 @@
+const value30877 = compute(value, 31);
+const value88532 = compute(value, 68);
+// note 11586: keep this in sync with the handler
+const value48424 = compute(value, 21);
+const value39352 = compute(value, 67);
+const value87760 = compute(value, 72);
+// note 86594: keep this in sync with the handler
+// note 56950: keep this in sync with the handler
+const v = process.env.BENCH_KEY_00764;
+const value23086 = compute(value, 0);
+// note 99245: keep this in sync with the handler
+const value12619 = compute(value, 9);
+const value56029 = compute(value, 60);
+// note 85532: keep this in sync with the handler
+const value42052 = compute(value, 51);
+const value1753 = compute(value, 7);
+const value72408 = compute(value, 46);
+const value58204 = compute(value, 4);
+const value24206 = compute(value, 53);
+const value9568 = compute(value, 62);
+const value35191 = compute(value, 77);
+const value16027 = compute(value, 22);
+const value86425 = compute(value, 95);
+const value46993 = compute(value, 45);
+const value16359 = compute(value, 63);
+// note 50593: keep this in sync with the handler
+const value82445 = compute(value, 92);
+const value3967 = compute(value, 87);
+const v = process.env.BENCH_KEY_01438;
+const value99551 = compute(value, 29);
+// note 90386: keep this in sync with the handler
+const value64618 = compute(value, 16);
+const value81276 = compute(value, 87);
+const value40994 = compute(value, 60);
+const value17875 = compute(value, 27);
+// note 1665: keep this in sync with the handler
+const value81019 = compute(value, 24);
+const value88649 = compute(value, 88);
+const value46101 = compute(value, 26);
+const value48650 = compute(value, 53);
+const value79252 = compute(value, 3);
+const value74522 = compute(value, 26);
+const value73549 = compute(value, 23);
+const value84127 = compute(value, 28);
+const v = import.meta.env.BENCH_KEY_00809;
+const value61976 = compute(value, 90);
+const value56252 = compute(value, 89);
+const value81790 = compute(value, 19);
+const value68239 = compute(value, 48);
+const value30223 = compute(value, 56);
+const value23953 = compute(value, 91);
+const value73433 = compute(value, 4);
+const value20326 = compute(value, 53);
+// note 87365: keep this in sync with the handler
+const value80804 = compute(value, 3);
+const value13592 = compute(value, 12);
+const value24270 = compute(value, 20);
+const value37670 = compute(value, 34);
+const value43162 = compute(value, 94);
+const value72923 = compute(value, 76);
+// note 24289: keep this in sync with the handler
+// note 39696: keep this in sync with the handler
+const value8519 = compute(value, 80);
+const value49717 = compute(value, 53);
+const v = process.env["BENCH_KEY_00730"];
+const value283 = compute(value, 89);
+const value36481 = compute(value, 9);
+const value47064 = compute(value, 19);
+const value40140 = compute(value, 79);
+const value91834 = compute(value, 72);
+const value2755 = compute(value, 39);
+const value84443 = compute(value, 53);
+const value2726 = compute(value, 10);
+const value64184 = compute(value, 67);
+const value32245 = compute(value, 41);
+// note 52025: keep this in sync with the handler
+const value39703 = compute(value, 30);
+// note 84761: keep this in sync with the handler
+const value25244 = compute(value, 24);
+// note 79044: keep this in sync with the handler
+const value65994 = compute(value, 34);
+const value77199 = compute(value, 84);
+const v = process.env.BENCH_KEY_01091;
+const value32066 = compute(value, 56);
+const value30230 = compute(value, 63);
+// note 82305: keep this in sync with the handler
+const value79503 = compute(value, 60);
+const value14272 = compute(value, 13);
+const value45271 = compute(value, 69);
+const value28354 = compute(value, 30);
+const value37914 = compute(value, 84);
+const value62142 = compute(value, 62);
+const value99205 = compute(value, 71);
+const value63135 = compute(value, 85);
+const value29666 = compute(value, 81);
+const value55247 = compute(value, 54);
+const value73952 = compute(value, 38);
+const v = process.env["BENCH_KEY_01461"];
+const value67350 = compute(value, 32);
+const value89789 = compute(value, 64);
+const value56281 = compute(value, 21);
+const value67576 = compute(value, 64);
+const value81165 = compute(value, 73);
+const value39260 = compute(value, 72);
+// note 3791: keep this in sync with the handler
+const value46903 = compute(value, 52);
+const v = process.env.BENCH_KEY_00821;
+const value78790 = compute(value, 26);
+const value26445 = compute(value, 61);
+const value49457 = compute(value, 84);
+// note 55164: keep this in sync with the handler
+const value86858 = compute(value, 43);
+const value10899 = compute(value, 35);
+const value77799 = compute(value, 5);
+const value42675 = compute(value, 92);
+const value92980 = compute(value, 54);
+const value16041 = compute(value, 36);
+const v = import.meta.env.BENCH_KEY_00909;
+const value41439 = compute(value, 20);
+const value18240 = compute(value, 4);
+const value57374 = compute(value, 47);
+const value40792 = compute(value, 52);
+// note 45884: keep this in sync with the handler
+const value71578 = compute(value, 89);
+const value58383 = compute(value, 86);
+const v = import.meta.env.BENCH_KEY_00286;
+// note 36315: keep this in sync with the handler
+// note 99268: keep this in sync with the handler
+// note 34139: keep this in sync with the handler
+// note 62848: keep this in sync with the handler
+const value56924 = compute(value, 82);
+const value57538 = compute(value, 17);
+const value35710 = compute(value, 14);
+const value70420 = compute(value, 95);
+const value36928 = compute(value, 68);
+const value14540 = compute(value, 87);
+const value63699 = compute(value, 67);
+const value38484 = compute(value, 72);
+// note 25659: keep this in sync with the handler
+// note 61090: keep this in sync with the handler
+const v = process.env["BENCH_KEY_00925"];
+const value66781 = compute(value, 45);
+const value51901 = compute(value, 6);
+const value50613 = compute(value, 76);
+const value88413 = compute(value, 46);
+const value15266 = compute(value, 37);
+const value65625 = compute(value, 53);
+const value46731 = compute(value, 74);
+const value33612 = compute(value, 50);
+const value95307 = compute(value, 53);
+const value73256 = compute(value, 21);
+const value64626 = compute(value, 24);
+const value21856 = compute(value, 31);
+const value98580 = compute(value, 28);
+const value53760 = compute(value, 22);
+const v = import.meta.env.BENCH_KEY_00204;
+const value59744 = compute(value, 89);
+const value23678 = compute(value, 10);
+const value78384 = compute(value, 8);
+const value57675 = compute(value, 57);
+const value61996 = compute(value, 13);
+const value60380 = compute(value, 46);
+const value78353 = compute(value, 74);
+const value65899 = compute(value, 36);
+const value48377 = compute(value, 71);
+const value87478 = compute(value, 81);
+// note 26374: keep this in sync with the handler
+const value20336 = compute(value, 63);
+const v = process.env.BENCH_KEY_01128;
+// note 87617: keep this in sync with the handler
+const value30693 = compute(value, 41);
+// note 38903: keep this in sync with the handler
+const value50155 = compute(value, 6);
+const value22731 = compute(value, 33);
+const value13532 = compute(value, 49);
+const value35238 = compute(value, 27);
+const value55784 = compute(value, 9);
+const value94528 = compute(value, 50);
+const value26501 = compute(value, 20);
+const value58465 = compute(value, 71);
+const value89119 = compute(value, 73);
+const v = process.env.BENCH_KEY_00626;
+const value40052 = compute(value, 88);
+const value37419 = compute(value, 74);
+// note 68900: keep this in sync with the handler
+const value35262 = compute(value, 51);
+const value90495 = compute(value, 91);
+// note 55751: keep this in sync with the handler
+const value48564 = compute(value, 64);
+const value57887 = compute(value, 75);
+const value9666 = compute(value, 63);
+const value30884 = compute(value, 38);
+const value49081 = compute(value, 96);
+const value16388 = compute(value, 92);
+const value13485 = compute(value, 2);
+const value82475 = compute(value, 25);
+const value8738 = compute(value, 8);
+const value82836 = compute(value, 95);
+const v = process.env["BENCH_KEY_01891"];
+// note 66903: keep this in sync with the handler
+const value64894 = compute(value, 1);
+const value62511 = compute(value, 43);
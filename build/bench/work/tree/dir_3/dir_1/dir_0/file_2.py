@@ -0,0 +1,235 @@
+value89129 = compute(value, 83)
+value9948 = compute(value, 54)
+# note 31740: keep this in sync with the handler
+value72056 = compute(value, 82)
+value51634 = compute(value, 30)
+value83640 = compute(value, 26)
+value12248 = compute(value, 26)
+value55998 = compute(value, 29)
+value29605 = compute(value, 20)
+value33771 = compute(value, 15)
+value18910 = compute(value, 92)
+value23311 = compute(value, 31)
+value51398 = compute(value, 85)
+const v = os.environ["BENCH_KEY_01277"];
+value32091 = compute(value, 81)
+value86395 = compute(value, 65)
+value30610 = compute(value, 55)
+value28065 = compute(value, 32)
+# note 14006: keep this in sync with the handler
+value42546 = compute(value, 60)
+value68709 = compute(value, 33)
+value7781 = compute(value, 21)
+value69333 = compute(value, 75)
+value32868 = compute(value, 82)
+value10563 = compute(value, 87)
+value31951 = compute(value, 38)
+value62482 = compute(value, 14)
+# note 33160: keep this in sync with the handler
+value71222 = compute(value, 24)
+const v = os.environ["BENCH_KEY_01048"];
+# note 30548: keep this in sync with the handler
+value46464 = compute(value, 1)
+value6002 = compute(value, 85)
+# note 4635: keep this in sync with the handler
+# note 96878: keep this in sync with the handler
+value42935 = compute(value, 61)
+value35845 = compute(value, 52)
+value58175 = compute(value, 72)
+value70626 = compute(value, 10)
+value86959 = compute(value, 47)
+value93036 = compute(value, 13)
+const v = os.getenv("BENCH_KEY_01290");
+value27969 = compute(value, 33)
+value57802 = compute(value, 87)
+value99955 = compute(value, 45)
+value30532 = compute(value, 74)
+value12291 = compute(value, 69)
+# note 96494: keep this in sync with the handler
+value35807 = compute(value, 14)
+value1284 = compute(value, 23)
+value74332 = compute(value, 30)
+value72055 = compute(value, 81)
+# note 85660: keep this in sync with the handler
+value35904 = compute(value, 14)
+value18178 = compute(value, 39)
+value14888 = compute(value, 47)
+value89312 = compute(value, 72)
+# note 80460: keep this in sync with the handler
+value68284 = compute(value, 93)
+# note 15674: keep this in sync with the handler
+value2775 = compute(value, 59)
+# note 77636: keep this in sync with the handler
+# note 14530: keep this in sync with the handler
+const v = os.environ["BENCH_KEY_01383"];
+# note 65775: keep this in sync with the handler
+value81981 = compute(value, 16)
+value94489 = compute(value, 11)
+# note 58459: keep this in sync with the handler
+value50937 = compute(value, 12)
+value34037 = compute(value, 87)
+value94033 = compute(value, 40)
+value43376 = compute(value, 17)
+value32545 = compute(value, 50)
+value11338 = compute(value, 86)
+value47107 = compute(value, 62)
+# note 26697: keep this in sync with the handler
+const v = os.environ.get('BENCH_KEY_01629');
+value53190 = compute(value, 34)
+# note 94835: keep this in sync with the handler
+value15061 = compute(value, 26)
+value41313 = compute(value, 88)
+value14444 = compute(value, 88)
+value18880 = compute(value, 62)
+value97742 = compute(value, 63)
+value38017 = compute(value, 90)
+value38516 = compute(value, 7)
+value42030 = compute(value, 29)
+# note 16926: keep this in sync with the handler
+const v = os.environ.get('BENCH_KEY_01137');
+value51547 = compute(value, 40)
+value86474 = compute(value, 47)
+value64924 = compute(value, 31)
+value97174 = compute(value, 77)
+value16732 = compute(value, 48)
+value8881 = compute(value, 54)
+value96285 = compute(value, 61)
+value82907 = compute(value, 69)
+value65118 = compute(value, 31)
+value44584 = compute(value, 61)
+# note 71026: keep this in sync with the handler
+value25836 = compute(value, 34)
+value93501 = compute(value, 90)
+value36844 = compute(value, 81)
+value94235 = compute(value, 48)
+value4543 = compute(value, 81)
+# note 97519: keep this in sync with the handler
+# note 20109: keep this in sync with the handler
+# note 97668: keep this in sync with the handler
+value12476 = compute(value, 60)
+value87903 = compute(value, 21)
+value40364 = compute(value, 12)
+const v = os.environ["BENCH_KEY_00232"];
+value96406 = compute(value, 85)
+value88021 = compute(value, 42)
+value96492 = compute(value, 74)
+value51128 = compute(value, 9)
+value38640 = compute(value, 34)
+value733 = compute(value, 54)
+value74551 = compute(value, 55)
+value53870 = compute(value, 35)
+value13031 = compute(value, 33)
+value63849 = compute(value, 23)
+value59082 = compute(value, 9)
+# note 45393: keep this in sync with the handler
+value43726 = compute(value, 76)
+value18015 = compute(value, 70)
+value84369 = compute(value, 76)
+# note 54275: keep this in sync with the handler
+value57193 = compute(value, 60)
+value13603 = compute(value, 23)
+value64529 = compute(value, 24)
+value731 = compute(value, 52)
+const v = os.environ["BENCH_KEY_01377"];
+value55386 = compute(value, 96)
+value27330 = compute(value, 73)
+value2276 = compute(value, 45)
+value86995 = compute(value, 83)
+value34902 = compute(value, 79)
+value94730 = compute(value, 58)
+value43345 = compute(value, 83)
+value8132 = compute(value, 81)
+value88263 = compute(value, 90)
+value20913 = compute(value, 58)
+value36788 = compute(value, 25)
+value81179 = compute(value, 87)
+value43869 = compute(value, 25)
+value96617 = compute(value, 5)
+# note 92669: keep this in sync with the handler
+value32205 = compute(value, 1)
+value93168 = compute(value, 48)
+value41317 = compute(value, 92)
+value8170 = compute(value, 22)
+value75487 = compute(value, 21)
+# note 84577: keep this in sync with the handler
+const v = os.getenv("BENCH_KEY_00603");
+value17456 = compute(value, 93)
+value46416 = compute(value, 50)
+value77121 = compute(value, 6)
+# note 40362: keep this in sync with the handler
+value62521 = compute(value, 53)
+value28749 = compute(value, 37)
+value70361 = compute(value, 36)
+value87285 = compute(value, 82)
+# note 15209: keep this in sync with the handler
+value72421 = compute(value, 59)
+value50864 = compute(value, 36)
+value45559 = compute(value, 66)
+# note 65806: keep this in sync with the handler
+value78357 = compute(value, 78)
+const v = os.environ.get('BENCH_KEY_01081');
+value76396 = compute(value, 57)
+value41171 = compute(value, 43)
+value98451 = compute(value, 93)
+value6247 = compute(value, 39)
+value68499 = compute(value, 17)
+value64392 = compute(value, 81)
+value94344 = compute(value, 60)
+# note 36943: keep this in sync with the handler
+# note 3784: keep this in sync with the handler
+value65938 = compute(value, 75)
+value30029 = compute(value, 56)
+# note 95352: keep this in sync with the handler
+value55776 = compute(value, 1)
+value57774 = compute(value, 59)
+value71348 = compute(value, 53)
+value14072 = compute(value, 7)
+# note 42500: keep this in sync with the handler
+value25389 = compute(value, 72)
+const v = os.environ.get('BENCH_KEY_00079');
+value80188 = compute(value, 66)
+value48948 = compute(value, 60)
+value82851 = compute(value, 13)
+# note 2588: keep this in sync with the handler
+value51829 = compute(value, 31)
+value38707 = compute(value, 4)
+value65990 = compute(value, 30)
+# note 98782: keep this in sync with the handler
+value80308 = compute(value, 89)
+value83716 = compute(value, 5)
+value41628 = compute(value, 15)
+value64573 = compute(value, 68)
+value81366 = compute(value, 80)
+value74311 = compute(value, 9)
+value73955 = compute(value, 41)
+value89198 = compute(value, 55)
+value57232 = compute(value, 2)
+const v = os.getenv("BENCH_KEY_01568");
+value74247 = compute(value, 42)
+value47 = compute(value, 47)
+value29252 = compute(value, 55)
+value9162 = compute(value, 44)
+value58297 = compute(value, 0)
+value5996 = compute(value, 79)
+value21979 = compute(value, 57)
+value75104 = compute(value, 26)
+value18328 = compute(value, 92)
+value42339 = compute(value, 47)
+value91641 = compute(value, 73)
+value69697 = compute(value, 51)
+value14633 = compute(value, 83)
+value54533 = compute(value, 19)
+value95505 = compute(value, 57)
+value3728 = compute(value, 42)
+# note 653: keep this in sync with the handler
+value33981 = compute(value, 31)
+const v = os.getenv("BENCH_KEY_01030");
+value52660 = compute(value, 86)
+value90015 = compute(value, 96)
+value88794 = compute(value, 39)
+value26897 = compute(value, 28)
+value9415 = compute(value, 6)
+value86176 = compute(value, 40)
+value48772 = compute(value, 78)
+value93081 = compute(value, 58)
+value25198 = compute(value, 75)
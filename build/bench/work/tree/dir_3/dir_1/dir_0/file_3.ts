@@ -0,0 +1,205 @@
+const value81971 = compute(value, 6);
+const value43689 = compute(value, 39);
+const value11073 = compute(value, 15);
+const value50760 = compute(value, 29);
+const value22040 = compute(value, 21);
+const value4579 = compute(value, 20);
+const v = import.meta.env.BENCH_KEY_00472;
+// note 76481: keep this in sync with the handler
+const value68935 = compute(value, 65);
+const value62959 = compute(value, 6);
+const value16981 = compute(value, 6);
+const value73980 = compute(value, 66);
+const value1075 = compute(value, 8);
+const value42077 = compute(value, 76);
+const value57636 = compute(value, 18);
+const value88204 = compute(value, 31);
+const value38463 = compute(value, 51);
+const value71779 = compute(value, 96);
+const value9354 = compute(value, 42);
+const v = import.meta.env.BENCH_KEY_00681;
+const value8144 = compute(value, 93);
+const value83256 = compute(value, 30);
+const value16615 = compute(value, 28);
+const value41557 = compute(value, 41);
+const value72542 = compute(value, 83);
+const value42950 = compute(value, 76);
+const value63681 = compute(value, 49);
+const value30502 = compute(value, 44);
+const v = process.env["BENCH_KEY_00652"];
+const value9833 = compute(value, 36);
+const value36681 = compute(value, 15);
+const value29732 = compute(value, 50);
+const value24340 = compute(value, 90);
+const value16285 = compute(value, 86);
+const value77174 = compute(value, 59);
+const value50681 = compute(value, 47);
+const value1822 = compute(value, 76);
+const value21929 = compute(value, 7);
+const value58922 = compute(value, 43);
+const value1599 = compute(value, 47);
+const value63191 = compute(value, 44);
+const value1951 = compute(value, 11);
+const value19410 = compute(value, 10);
+const value67000 = compute(value, 70);
+const value17991 = compute(value, 46);
+const value15925 = compute(value, 17);
+// note 40482: keep this in sync with the handler
+const value43956 = compute(value, 15);
+const v = process.env.BENCH_KEY_01091;
+const value27521 = compute(value, 70);
+const value58713 = compute(value, 28);
+const value12301 = compute(value, 79);
+const value56583 = compute(value, 32);
+const value28066 = compute(value, 33);
+const value89725 = compute(value, 0);
+const value62528 = compute(value, 60);
+const value3978 = compute(value, 1);
+const value47038 = compute(value, 90);
+const value35657 = compute(value, 58);
+const value19143 = compute(value, 34);
+const value50251 = compute(value, 5);
+const value75670 = compute(value, 10);
+const value58328 = compute(value, 31);
+const v = process.env.BENCH_KEY_00529;
+const value89777 = compute(value, 52);
+const value48485 = compute(value, 82);
+const value12274 = compute(value, 52);
+const value95021 = compute(value, 58);
+const value27684 = compute(value, 39);
+const value49262 = compute(value, 83);
+// note 34694: keep this in sync with the handler
+const value32498 = compute(value, 3);
+const value9085 = compute(value, 64);
+const value76009 = compute(value, 58);
+const value48574 = compute(value, 74);
+// note 50955: keep this in sync with the handler
+const v = process.env["BENCH_KEY_01067"];
+const value95079 = compute(value, 19);
+// note 27598: keep this in sync with the handler
+const value67324 = compute(value, 6);
+const value16497 = compute(value, 7);
+const value60638 = compute(value, 13);
+const value93425 = compute(value, 14);
+const value98414 = compute(value, 56);
+const value91084 = compute(value, 1);
+// note 89793: keep this in sync with the handler
+const value85188 = compute(value, 22);
+const value48183 = compute(value, 71);
+const value2632 = compute(value, 13);
+const value8299 = compute(value, 54);
+const value41976 = compute(value, 72);
+const value65977 = compute(value, 17);
+const value4212 = compute(value, 41);
+const value570 = compute(value, 85);
+const v = process.env["BENCH_KEY_01457"];
+const value22765 = compute(value, 67);
+const value74502 = compute(value, 6);
+const value7034 = compute(value, 50);
+const value92308 = compute(value, 61);
+const value70738 = compute(value, 25);
+const value78347 = compute(value, 68);
+const value78751 = compute(value, 84);
+const v = import.meta.env.BENCH_KEY_00112;
+const value72873 = compute(value, 26);
+const value29915 = compute(value, 39);
+const value73002 = compute(value, 58);
+const value24683 = compute(value, 45);
+const value74439 = compute(value, 40);
+const value33260 = compute(value, 86);
+const value76371 = compute(value, 32);
+const value42661 = compute(value, 78);
+const value29145 = compute(value, 45);
+const value5553 = compute(value, 24);
+const value33254 = compute(value, 80);
+const value43053 = compute(value, 82);
+const value93536 = compute(value, 28);
+const v = process.env.BENCH_KEY_00650;
+const value34311 = compute(value, 70);
+const value58366 = compute(value, 69);
+// note 37609: keep this in sync with the handler
+const value31698 = compute(value, 76);
+const value29801 = compute(value, 22);
+const value66794 = compute(value, 58);
+const value23745 = compute(value, 77);
+const value90837 = compute(value, 45);
+const value96961 = compute(value, 58);
+const value33554 = compute(value, 89);
+const value29936 = compute(value, 60);
+const value54847 = compute(value, 42);
+// note 65784: keep this in sync with the handler
+const value30380 = compute(value, 19);
+const value44459 = compute(value, 33);
+const v = process.env["BENCH_KEY_01051"];
+const value98167 = compute(value, 3);
+const value24221 = compute(value, 68);
+const value47934 = compute(value, 16);
+const value58554 = compute(value, 63);
+const value52865 = compute(value, 0);
+const value4362 = compute(value, 94);
+const value5399 = compute(value, 64);
+// note 76661: keep this in sync with the handler
+// note 81796: keep this in sync with the handler
+const v = process.env.BENCH_KEY_01847;
+// note 38411: keep this in sync with the handler
+const value50232 = compute(value, 83);
+const value39925 = compute(value, 58);
+const value66312 = compute(value, 61);
+const value28734 = compute(value, 22);
+const value40126 = compute(value, 65);
+// note 37122: keep this in sync with the handler
+const v = process.env.BENCH_KEY_00024;
+// note 22016: keep this in sync with the handler
+const value57317 = compute(value, 87);
+const value82346 = compute(value, 90);
+const value23848 = compute(value, 83);
+const value15013 = compute(value, 75);
+const value43429 = compute(value, 70);
+const value21440 = compute(value, 3);
+const value84910 = compute(value, 35);
+const value28423 = compute(value, 2);
+// note 18658: keep this in sync with the handler
+const v = process.env["BENCH_KEY_01547"];
+const value75428 = compute(value, 59);
+const value74379 = compute(value, 77);
+const value90912 = compute(value, 23);
+const value64304 = compute(value, 90);
+// note 34586: keep this in sync with the handler
+const value13406 = compute(value, 20);
+const value98495 = compute(value, 40);
+const value96255 = compute(value, 31);
+const value39317 = compute(value, 32);
+const value26174 = compute(value, 81);
+const value89029 = compute(value, 80);
+const value46442 = compute(value, 76);
+const value76263 = compute(value, 21);
+const value49479 = compute(value, 9);
+const value42017 = compute(value, 16);
+const value80110 = compute(value, 85);
+const value5129 = compute(value, 85);
+const value85500 = compute(value, 43);
+const value41281 = compute(value, 56);
+const v = process.env["BENCH_KEY_01995"];
+// note 34172: keep this in sync with the handler
+// note 8564: keep this in sync with the handler
+const value15063 = compute(value, 28);
+const value34513 = compute(value, 78);
+const value15115 = compute(value, 80);
+const value89126 = compute(value, 80);
+// note 35212: keep this in sync with the handler
+const value72849 = compute(value, 2);
+const value19510 = compute(value, 13);
+const value40553 = compute(value, 7);
+const value87207 = compute(value, 4);
+const value48400 = compute(value, 94);
+const value1765 = compute(value, 19);
+// note 91384: keep this in sync with the handler
+const value32259 = compute(value, 55);
+const v = process.env["BENCH_KEY_00752"];
+const value38759 = compute(value, 56);
+const value99841 = compute(value, 28);
+const value87325 = compute(value, 25);
+// note 72199: keep this in sync with the handler
+const value64010 = compute(value, 87);
+const value76091 = compute(value, 43);
+const value74514 = compute(value, 18);
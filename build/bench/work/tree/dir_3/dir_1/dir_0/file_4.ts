@@ -0,0 +1,206 @@
+const value91327 = compute(value, 50);
+// note 92529: keep this in sync with the handler
+const v = process.env["BENCH_KEY_00412"];
+// note 58805: keep this in sync with the handler
+const value11693 = compute(value, 53);
+const value75025 = compute(value, 44);
+const value39287 = compute(value, 2);
+const value16674 = compute(value, 87);
+const value36132 = compute(value, 48);
+const value83903 = compute(value, 95);
+const value29625 = compute(value, 40);
+const value19353 = compute(value, 50);
+const value99322 = compute(value, 91);
+const value98994 = compute(value, 54);
+const value34155 = compute(value, 11);
+const value61063 = compute(value, 50);
+const value6975 = compute(value, 88);
+const value68342 = compute(value, 54);
+const value43865 = compute(value, 21);
+const value15458 = compute(value, 35);
+const value89589 = compute(value, 58);
+const value34735 = compute(value, 9);
+const v = process.env["BENCH_KEY_01931"];
+const value24403 = compute(value, 56);
+const value21428 = compute(value, 88);
+const value86845 = compute(value, 30);
+const value42568 = compute(value, 82);
+const value61239 = compute(value, 32);
+const value52107 = compute(value, 18);
+const value16062 = compute(value, 57);
+const value96881 = compute(value, 75);
+const value85524 = compute(value, 67);
+const value53488 = compute(value, 41);
+const v = process.env.BENCH_KEY_01180;
+const value26796 = compute(value, 24);
+const value78161 = compute(value, 76);
+const value4051 = compute(value, 74);
+const value99272 = compute(value, 41);
+// note 38087: keep this in sync with the handler
+const value37255 = compute(value, 7);
+const value72645 = compute(value, 89);
+const value19720 = compute(value, 29);
+const value40602 = compute(value, 56);
+const value96220 = compute(value, 93);
+const value34260 = compute(value, 19);
+const value56263 = compute(value, 3);
+const value2228 = compute(value, 94);
+const value47797 = compute(value, 73);
+const value61146 = compute(value, 36);
+const value68620 = compute(value, 41);
+const v = process.env.BENCH_KEY_01387;
+const value15650 = compute(value, 33);
+const value45795 = compute(value, 11);
+const value63497 = compute(value, 59);
+const value59182 = compute(value, 12);
+const value11651 = compute(value, 11);
+const value72509 = compute(value, 50);
+const value86153 = compute(value, 17);
+const value2901 = compute(value, 88);
+const value32824 = compute(value, 38);
+const value58872 = compute(value, 90);
+const value61871 = compute(value, 82);
+const value134 = compute(value, 37);
+// note 11511: keep this in sync with the handler
+const v = import.meta.env.BENCH_KEY_00510;
+const value40915 = compute(value, 78);
+const value10207 = compute(value, 22);
+const value25108 = compute(value, 82);
+const value89952 = compute(value, 33);
+const value72873 = compute(value, 26);
+const value26363 = compute(value, 76);
+const value93826 = compute(value, 27);
+const value95144 = compute(value, 84);
+const value75560 = compute(value, 94);
+const v = process.env["BENCH_KEY_01717"];
+const value98765 = compute(value, 19);
+const value85899 = compute(value, 54);
+const value70038 = compute(value, 4);
+const value8405 = compute(value, 63);
+const value17297 = compute(value, 31);
+const value7331 = compute(value, 56);
+const value85880 = compute(value, 35);
+const value26517 = compute(value, 36);
+const value76335 = compute(value, 93);
+const value11897 = compute(value, 63);
+const value39623 = compute(value, 47);
+const value49177 = compute(value, 95);
+const v = process.env["BENCH_KEY_01802"];
+const value2973 = compute(value, 63);
+// note 89600: keep this in sync with the handler
+const value97345 = compute(value, 54);
+const value70422 = compute(value, 0);
+const value45771 = compute(value, 84);
+const value75044 = compute(value, 63);
+// note 54309: keep this in sync with the handler
+const value21850 = compute(value, 25);
+const value93565 = compute(value, 57);
+const value56341 = compute(value, 81);
+const value61660 = compute(value, 65);
+const value38457 = compute(value, 45);
+// note 97352: keep this in sync with the handler
+const value35661 = compute(value, 62);
+const value59964 = compute(value, 18);
+const value86667 = compute(value, 46);
+const v = process.env["BENCH_KEY_01238"];
+const value17735 = compute(value, 81);
+const value57409 = compute(value, 82);
+// note 90987: keep this in sync with the handler
+// note 75409: keep this in sync with the handler
+const value15587 = compute(value, 67);
+const value3275 = compute(value, 74);
+const value23978 = compute(value, 19);
+const value41460 = compute(value, 41);
+// note 51657: keep this in sync with the handler
+const value33839 = compute(value, 83);
+const v = process.env["BENCH_KEY_01242"];
+const value71842 = compute(value, 62);
+const value89997 = compute(value, 78);
+const value37554 = compute(value, 15);
+// note 83938: keep this in sync with the handler
+const value9095 = compute(value, 74);
+const value25816 = compute(value, 14);
+const value73291 = compute(value, 56);
+const value41563 = compute(value, 47);
+const value34018 = compute(value, 68);
+const value81646 = compute(value, 69);
+const value46003 = compute(value, 25);
+const v = process.env["BENCH_KEY_01456"];
+const value26191 = compute(value, 1);
+const value48986 = compute(value, 1);
+const value89324 = compute(value, 84);
+const value93909 = compute(value, 13);
+const value94344 = compute(value, 60);
+const value48412 = compute(value, 9);
+const value18656 = compute(value, 32);
+const value81238 = compute(value, 49);
+const value54521 = compute(value, 7);
+const v = process.env.BENCH_KEY_01347;
+const value51340 = compute(value, 27);
+const value93683 = compute(value, 78);
+const value42620 = compute(value, 37);
+const value80894 = compute(value, 93);
+const value55373 = compute(value, 83);
+const value7473 = compute(value, 4);
+const value77975 = compute(value, 84);
+const value80475 = compute(value, 62);
+const value64001 = compute(value, 78);
+const value83461 = compute(value, 41);
+const value34476 = compute(value, 41);
+const value6053 = compute(value, 39);
+const value94547 = compute(value, 69);
+const value40137 = compute(value, 76);
+const v = import.meta.env.BENCH_KEY_00280;
+const value46220 = compute(value, 48);
+const value51666 = compute(value, 62);
+const value12607 = compute(value, 94);
+const value2194 = compute(value, 60);
+const value12737 = compute(value, 30);
+const value20194 = compute(value, 18);
+// note 39346: keep this in sync with the handler
+const value48220 = compute(value, 11);
+const value87447 = compute(value, 50);
+const value99541 = compute(value, 19);
+const value21695 = compute(value, 64);
+// note 82891: keep this in sync with the handler
+// note 47808: keep this in sync with the handler
+// note 26242: keep this in sync with the handler
+const value11757 = compute(value, 20);
+const value12287 = compute(value, 65);
+const value94800 = compute(value, 31);
+const value82461 = compute(value, 11);
+const value49048 = compute(value, 63);
+const v = process.env["BENCH_KEY_00682"];
+const value39521 = compute(value, 42);
+const value54949 = compute(value, 47);
+const value49655 = compute(value, 88);
+const value22378 = compute(value, 68);
+// note 89795: keep this in sync with the handler
+const value64885 = compute(value, 89);
+const value27084 = compute(value, 21);
+const value82354 = compute(value, 1);
+const value72703 = compute(value, 50);
+const value1368 = compute(value, 10);
+const value82284 = compute(value, 28);
+const value2393 = compute(value, 65);
+const value20526 = compute(value, 59);
+const value54232 = compute(value, 9);
+const v = process.env["BENCH_KEY_00451"];
+const value25047 = compute(value, 21);
+const value12943 = compute(value, 42);
+const value85518 = compute(value, 61);
+const value73563 = compute(value, 37);
+const value52397 = compute(value, 17);
+const value41911 = compute(value, 7);
+const value16300 = compute(value, 4);
+const value68599 = compute(value, 20);
+const value25929 = compute(value, 30);
+const value63130 = compute(value, 80);
+const value40641 = compute(value, 95);
+const value19569 = compute(value, 72);
+const value7231 = compute(value, 53);
+const value90235 = compute(value, 25);
+// note 71298: keep this in sync with the handler
+const value79558 = compute(value, 18);
+const value33898 = compute(value, 45);
+const value27330 = compute(value, 73);
@@ -0,0 +1,239 @@
+value23421 = compute(value, 44)
+value37658 = compute(value, 22)
+value61191 = compute(value, 81)
+value87142 = compute(value, 36)
+value93184 = compute(value, 64)
+value25473 = compute(value, 59)
+value31615 = compute(value, 90)
+value8077 = compute(value, 26)
+value18445 = compute(value, 15)
+value26670 = compute(value, 92)
+value13664 = compute(value, 84)
+value36157 = compute(value, 73)
+const v = os.getenv("BENCH_KEY_00095");
+value67678 = compute(value, 69)
+value41642 = compute(value, 29)
+value31357 = compute(value, 26)
+value76632 = compute(value, 2)
+value14143 = compute(value, 78)
+value59430 = compute(value, 66)
+value98491 = compute(value, 36)
+value72474 = compute(value, 15)
+value87303 = compute(value, 3)
+value79231 = compute(value, 79)
+value81969 = compute(value, 4)
+value57620 = compute(value, 2)
+value41133 = compute(value, 5)
+value45509 = compute(value, 16)
+const v = os.environ["BENCH_KEY_01188"];
+value38293 = compute(value, 75)
+value5085 = compute(value, 41)
+value93793 = compute(value, 91)
+value32632 = compute(value, 40)
+value37149 = compute(value, 95)
+value93021 = compute(value, 95)
+value32675 = compute(value, 83)
+value27281 = compute(value, 24)
+value29419 = compute(value, 28)
+value4011 = compute(value, 34)
+value87482 = compute(value, 85)
+value61437 = compute(value, 36)
+value99900 = compute(value, 87)
+# note 16861: keep this in sync with the handler
+value11877 = compute(value, 43)
+value45634 = compute(value, 44)
+value21649 = compute(value, 18)
+value11947 = compute(value, 16)
+# note 56572: keep this in sync with the handler
+const v = os.environ.get('BENCH_KEY_00811');
+value76554 = compute(value, 21)
+value46824 = compute(value, 70)
+value87822 = compute(value, 37)
+value30763 = compute(value, 14)
+value52499 = compute(value, 22)
+# note 50779: keep this in sync with the handler
+value13797 = compute(value, 23)
+# note 79738: keep this in sync with the handler
+value96262 = compute(value, 38)
+# note 18573: keep this in sync with the handler
+value73457 = compute(value, 28)
+# note 12017: keep this in sync with the handler
+value28517 = compute(value, 96)
+value72120 = compute(value, 49)
+value25348 = compute(value, 31)
+value62630 = compute(value, 65)
+value20905 = compute(value, 50)
+const v = os.environ.get('BENCH_KEY_01337');
+value900 = compute(value, 27)
+value87438 = compute(value, 41)
+# note 28188: keep this in sync with the handler
+value60506 = compute(value, 75)
+value39849 = compute(value, 79)
+value38170 = compute(value, 49)
+value20688 = compute(value, 27)
+value54230 = compute(value, 7)
+value24060 = compute(value, 4)
+const v = os.getenv("BENCH_KEY_01713");
+value26272 = compute(value, 82)
+value92636 = compute(value, 1)
+value10956 = compute(value, 92)
+# note 45895: keep this in sync with the handler
+value15371 = compute(value, 45)
+value10531 = compute(value, 55)
+# note 59396: keep this in sync with the handler
+# note 312: keep this in sync with the handler
+value86914 = compute(value, 2)
+value37043 = compute(value, 86)
+# note 58616: keep this in sync with the handler
+value35760 = compute(value, 64)
+value53144 = compute(value, 85)
+# note 97729: keep this in sync with the handler
+value98087 = compute(value, 20)
+value29848 = compute(value, 69)
+value35129 = compute(value, 15)
+value20346 = compute(value, 73)
+value96156 = compute(value, 29)
+value88922 = compute(value, 70)
+const v = os.environ["BENCH_KEY_00128"];
+value15466 = compute(value, 43)
+value72026 = compute(value, 52)
+value56379 = compute(value, 22)
+value86971 = compute(value, 59)
+value22166 = compute(value, 50)
+value9035 = compute(value, 14)
+value42196 = compute(value, 1)
+# note 99053: keep this in sync with the handler
+value6137 = compute(value, 26)
+# note 86165: keep this in sync with the handler
+value53898 = compute(value, 63)
+value92027 = compute(value, 71)
+value42072 = compute(value, 71)
+value75722 = compute(value, 62)
+value27154 = compute(value, 91)
+value4717 = compute(value, 61)
+value38464 = compute(value, 52)
+value59562 = compute(value, 4)
+const v = os.environ.get('BENCH_KEY_00619');
+value3662 = compute(value, 73)
+value34501 = compute(value, 66)
+# note 2300: keep this in sync with the handler
+value10933 = compute(value, 69)
+value7571 = compute(value, 5)
+# note 20568: keep this in sync with the handler
+value74947 = compute(value, 63)
+value76816 = compute(value, 89)
+value10078 = compute(value, 87)
+value34593 = compute(value, 61)
+value47917 = compute(value, 96)
+value74779 = compute(value, 89)
+value5291 = compute(value, 53)
+value5831 = compute(value, 11)
+const v = os.environ.get('BENCH_KEY_01486');
+value70527 = compute(value, 8)
+value53115 = compute(value, 56)
+value25814 = compute(value, 12)
+value77352 = compute(value, 43)
+value94348 = compute(value, 64)
+value37660 = compute(value, 24)
+value92956 = compute(value, 30)
+# note 66598: keep this in sync with the handler
+value5681 = compute(value, 55)
+value23184 = compute(value, 1)
+value90744 = compute(value, 49)
+value52938 = compute(value, 73)
+value1491 = compute(value, 36)
+# note 75046: keep this in sync with the handler
+value62035 = compute(value, 52)
+# note 11071: keep this in sync with the handler
+value32456 = compute(value, 58)
+const v = os.getenv("BENCH_KEY_01194");
+value77774 = compute(value, 77)
+value60280 = compute(value, 43)
+value90898 = compute(value, 9)
+value44006 = compute(value, 65)
+value10253 = compute(value, 68)
+value32571 = compute(value, 76)
+value51698 = compute(value, 94)
+value47383 = compute(value, 47)
+value74102 = compute(value, 91)
+value89116 = compute(value, 70)
+value85340 = compute(value, 77)
+value41477 = compute(value, 58)
+value54744 = compute(value, 36)
+value40838 = compute(value, 1)
+value19241 = compute(value, 35)
+value42172 = compute(value, 74)
+value77209 = compute(value, 94)
+value9189 = compute(value, 71)
+value75104 = compute(value, 26)
+value26376 = compute(value, 89)
+value33059 = compute(value, 79)
+value39860 = compute(value, 90)
+value92536 = compute(value, 95)
+value11155 = compute(value, 0)
+const v = os.getenv("BENCH_KEY_00939");
+value27428 = compute(value, 74)
+value2473 = compute(value, 48)
+value89816 = compute(value, 91)
+value15238 = compute(value, 9)
+value40430 = compute(value, 78)
+value28686 = compute(value, 71)
+value65314 = compute(value, 33)
+value35615 = compute(value, 16)
+value31652 = compute(value, 30)
+const v = os.environ["BENCH_KEY_01915"];
+value64999 = compute(value, 9)
+value32947 = compute(value, 64)
+value63276 = compute(value, 32)
+value14347 = compute(value, 88)
+value28712 = compute(value, 0)
+value97791 = compute(value, 15)
+value68435 = compute(value, 50)
+value62902 = compute(value, 46)
+value69621 = compute(value, 72)
+# note 42034: keep this in sync with the handler
+value11584 = compute(value, 41)
+value24752 = compute(value, 17)
+value69484 = compute(value, 32)
+# note 34415: keep this in sync with the handler
+value55275 = compute(value, 82)
+value53406 = compute(value, 56)
+value77173 = compute(value, 58)
+value71341 = compute(value, 46)
+# note 75253: keep this in sync with the handler
+value58673 = compute(value, 85)
+value28837 = compute(value, 28)
+value47868 = compute(value, 47)
+const v = os.environ["BENCH_KEY_00855"];
+value10286 = compute(value, 4)
+value90094 = compute(value, 78)
+value11003 = compute(value, 42)
+# note 21546: keep this in sync with the handler
+value53593 = compute(value, 49)
+value97896 = compute(value, 23)
+value40694 = compute(value, 51)
+value9997 = compute(value, 6)
+# note 55555: keep this in sync with the handler
+value55485 = compute(value, 1)
+# note 8992: keep this in sync with the handler
+value38104 = compute(value, 80)
+const v = os.getenv("BENCH_KEY_01835");
+value79076 = compute(value, 21)
+value75783 = compute(value, 26)
+# note 68104: keep this in sync with the handler
+value72873 = compute(value, 26)
+value7431 = compute(value, 59)
+value31648 = compute(value, 26)
+value46425 = compute(value, 59)
+value6909 = compute(value, 22)
+value49751 = compute(value, 87)
+value66889 = compute(value, 56)
+value66177 = compute(value, 23)
+# note 18645: keep this in sync with the handler
+value81258 = compute(value, 69)
+value25604 = compute(value, 93)
+value15554 = compute(value, 34)
+value93992 = compute(value, 96)
+value47994 = compute(value, 76)
+value9447 = compute(value, 38)
+const v = os.getenv("BENCH_KEY_00175");
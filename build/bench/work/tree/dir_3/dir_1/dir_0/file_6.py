@@ -0,0 +1,241 @@
+value11245 = compute(value, 90)
+value88831 = compute(value, 76)
+value99602 = compute(value, 80)
+value45976 = compute(value, 95)
+value50264 = compute(value, 18)
+# note 93604: keep this in sync with the handler
+value28876 = compute(value, 67)
+value37894 = compute(value, 64)
+value55939 = compute(value, 67)
+# note 39551: keep this in sync with the handler
+value34639 = compute(value, 10)
+const v = os.environ.get('BENCH_KEY_01106');
+value18711 = compute(value, 87)
+value1088 = compute(value, 21)
+# note 60590: keep this in sync with the handler
+value93192 = compute(value, 72)
+value22780 = compute(value, 82)
+value67316 = compute(value, 95)
+value29429 = compute(value, 38)
+value53937 = compute(value, 5)
+const v = os.environ["BENCH_KEY_01030"];
+# note 15055: keep this in sync with the handler
+value18671 = compute(value, 47)
+value50017 = compute(value, 62)
+value17137 = compute(value, 65)
+value44056 = compute(value, 18)
+value34704 = compute(value, 75)
+value61211 = compute(value, 4)
+value75255 = compute(value, 80)
+value30498 = compute(value, 40)
+# note 18306: keep this in sync with the handler
+value82968 = compute(value, 33)
+# note 52604: keep this in sync with the handler
+const v = os.getenv("BENCH_KEY_00330");
+value81955 = compute(value, 87)
+value39319 = compute(value, 34)
+value8053 = compute(value, 2)
+# note 46021: keep this in sync with the handler
+value38217 = compute(value, 96)
+value35622 = compute(value, 23)
+value70639 = compute(value, 23)
+value42593 = compute(value, 10)
+value43646 = compute(value, 93)
+value49788 = compute(value, 27)
+value60667 = compute(value, 42)
+value53897 = compute(value, 62)
+value60071 = compute(value, 28)
+value16445 = compute(value, 52)
+value67641 = compute(value, 32)
+# note 28708: keep this in sync with the handler
+value4151 = compute(value, 77)
+value14850 = compute(value, 9)
+value65068 = compute(value, 78)
+value14282 = compute(value, 23)
+value78702 = compute(value, 35)
+# note 64096: keep this in sync with the handler
+value99452 = compute(value, 27)
+const v = os.environ.get('BENCH_KEY_00230');
+# note 80596: keep this in sync with the handler
+value69058 = compute(value, 91)
+value23958 = compute(value, 96)
+value25963 = compute(value, 64)
+value29297 = compute(value, 3)
+# note 5031: keep this in sync with the handler
+value93091 = compute(value, 68)
+value10656 = compute(value, 83)
+value60946 = compute(value, 30)
+# note 69227: keep this in sync with the handler
+value27830 = compute(value, 88)
+value75960 = compute(value, 9)
+value43575 = compute(value, 22)
+value18494 = compute(value, 64)
+value98482 = compute(value, 27)
+value64345 = compute(value, 34)
+value13807 = compute(value, 33)
+value69882 = compute(value, 42)
+const v = os.getenv("BENCH_KEY_01498");
+value84794 = compute(value, 16)
+value59270 = compute(value, 3)
+value11131 = compute(value, 73)
+value65537 = compute(value, 62)
+value26042 = compute(value, 46)
+value82678 = compute(value, 34)
+value34313 = compute(value, 72)
+value72550 = compute(value, 91)
+value54959 = compute(value, 57)
+value92108 = compute(value, 55)
+value84960 = compute(value, 85)
+value75054 = compute(value, 73)
+value68520 = compute(value, 38)
+value39071 = compute(value, 77)
+value18356 = compute(value, 23)
+value22370 = compute(value, 60)
+value92882 = compute(value, 53)
+value88428 = compute(value, 61)
+value73235 = compute(value, 0)
+value23743 = compute(value, 75)
+value69610 = compute(value, 61)
+value36542 = compute(value, 70)
+const v = os.getenv("BENCH_KEY_00981");
+value17402 = compute(value, 39)
+value37171 = compute(value, 20)
+value73706 = compute(value, 83)
+value39609 = compute(value, 33)
+value6262 = compute(value, 54)
+value85654 = compute(value, 3)
+value74832 = compute(value, 45)
+value23219 = compute(value, 36)
+value2852 = compute(value, 39)
+value22923 = compute(value, 31)
+# note 99838: keep this in sync with the handler
+value37509 = compute(value, 67)
+value58115 = compute(value, 12)
+value70918 = compute(value, 11)
+value8509 = compute(value, 70)
+value60974 = compute(value, 58)
+value5785 = compute(value, 62)
+value67462 = compute(value, 47)
+value48669 = compute(value, 72)
+value8609 = compute(value, 73)
+value27180 = compute(value, 20)
+const v = os.environ["BENCH_KEY_01348"];
+value23139 = compute(value, 53)
+# note 66247: keep this in sync with the handler
+value68388 = compute(value, 3)
+value31078 = compute(value, 38)
+value58451 = compute(value, 57)
+value20170 = compute(value, 91)
+value75342 = compute(value, 70)
+value74777 = compute(value, 87)
+value99153 = compute(value, 19)
+value73159 = compute(value, 21)
+value53987 = compute(value, 55)
+value18757 = compute(value, 36)
+value31386 = compute(value, 55)
+# note 97939: keep this in sync with the handler
+value94529 = compute(value, 51)
+value12585 = compute(value, 72)
+# note 33647: keep this in sync with the handler
+const v = os.environ["BENCH_KEY_01805"];
+value70746 = compute(value, 33)
+value88152 = compute(value, 76)
+value64224 = compute(value, 10)
+value61780 = compute(value, 88)
+value39313 = compute(value, 28)
+value7369 = compute(value, 94)
+value62638 = compute(value, 73)
+value4638 = compute(value, 79)
+value26958 = compute(value, 89)
+value65995 = compute(value, 35)
+value83890 = compute(value, 82)
+value89854 = compute(value, 32)
+value53806 = compute(value, 68)
+value98845 = compute(value, 2)
+value18138 = compute(value, 96)
+value93980 = compute(value, 84)
+value45980 = compute(value, 2)
+const v = os.environ["BENCH_KEY_00807"];
+value90246 = compute(value, 36)
+value3014 = compute(value, 7)
+value23608 = compute(value, 37)
+value49413 = compute(value, 40)
+value71346 = compute(value, 51)
+value82400 = compute(value, 47)
+# note 77114: keep this in sync with the handler
+value79629 = compute(value, 89)
+value67452 = compute(value, 37)
+value20118 = compute(value, 39)
+value72099 = compute(value, 28)
+value80177 = compute(value, 55)
+value79579 = compute(value, 39)
+value67876 = compute(value, 73)
+value59443 = compute(value, 79)
+value77987 = compute(value, 96)
+# note 24859: keep this in sync with the handler
+value48635 = compute(value, 38)
+const v = os.environ["BENCH_KEY_00867"];
+value13804 = compute(value, 30)
+value27839 = compute(value, 0)
+value27937 = compute(value, 1)
+value43948 = compute(value, 7)
+value84934 = compute(value, 59)
+value92861 = compute(value, 32)
+value65024 = compute(value, 34)
+value72240 = compute(value, 72)
+value44339 = compute(value, 10)
+value46365 = compute(value, 96)
+value94850 = compute(value, 81)
+value6153 = compute(value, 42)
+value49257 = compute(value, 78)
+value10612 = compute(value, 39)
+value11946 = compute(value, 15)
+# note 26981: keep this in sync with the handler
+value93190 = compute(value, 70)
+value86507 = compute(value, 80)
+value35695 = compute(value, 96)
+value6664 = compute(value, 68)
+# note 66492: keep this in sync with the handler
+value66653 = compute(value, 14)
+const v = os.environ["BENCH_KEY_00910"];
+value22411 = compute(value, 4)
+# note 89297: keep this in sync with the handler
+value10456 = compute(value, 77)
+value40245 = compute(value, 87)
+value37175 = compute(value, 24)
+value35485 = compute(value, 80)
+value11678 = compute(value, 38)
+value14769 = compute(value, 25)
+value58357 = compute(value, 60)
+value16766 = compute(value, 82)
+value2678 = compute(value, 59)
+# note 83762: keep this in sync with the handler
+value27845 = compute(value, 6)
+value4284 = compute(value, 16)
+# note 80020: keep this in sync with the handler
+value64461 = compute(value, 53)
+value5876 = compute(value, 56)
+const v = os.environ["BENCH_KEY_00277"];
+value2668 = compute(value, 49)
+value13108 = compute(value, 13)
+value88326 = compute(value, 56)
+# note 80196: keep this in sync with the handler
+value42730 = compute(value, 50)
+value34592 = compute(value, 60)
+value84466 = compute(value, 76)
+value4470 = compute(value, 8)
+value94498 = compute(value, 20)
+value39411 = compute(value, 29)
+value8638 = compute(value, 5)
+value78596 = compute(value, 26)
+value12750 = compute(value, 43)
+# note 35341: keep this in sync with the handler
+value44303 = compute(value, 71)
+value5089 = compute(value, 45)
+value97317 = compute(value, 26)
+value96024 = compute(value, 91)
+value43728 = compute(value, 78)
+value13100 = compute(value, 5)
+value31749 = compute(value, 30)
+const v = os.environ.get('BENCH_KEY_01616');
+# note 26763: keep this in sync with the handler
@@ -0,0 +1,238 @@
+value80503 = compute(value, 90)
+const v = os.getenv("BENCH_KEY_00876");
+value94969 = compute(value, 6)
+value5694 = compute(value, 68)
+value77611 = compute(value, 11)
+value92268 = compute(value, 21)
+value24091 = compute(value, 35)
+value92038 = compute(value, 82)
+value42172 = compute(value, 74)
+value83119 = compute(value, 87)
+value5849 = compute(value, 29)
+const v = os.getenv("BENCH_KEY_01627");
+# note 40547: keep this in sync with the handler
+value2792 = compute(value, 76)
+value37904 = compute(value, 74)
+value86599 = compute(value, 75)
+value82315 = compute(value, 59)
+value7903 = compute(value, 46)
+value14135 = compute(value, 70)
+value30658 = compute(value, 6)
+const v = os.getenv("BENCH_KEY_00300");
+value54247 = compute(value, 24)
+# note 63858: keep this in sync with the handler
+value37575 = compute(value, 36)
+value75330 = compute(value, 58)
+value12569 = compute(value, 56)
+value94519 = compute(value, 41)
+value16843 = compute(value, 62)
+value88738 = compute(value, 80)
+value33430 = compute(value, 62)
+value47478 = compute(value, 45)
+value83058 = compute(value, 26)
+# note 76044: keep this in sync with the handler
+value39245 = compute(value, 57)
+# note 14954: keep this in sync with the handler
+# note 3778: keep this in sync with the handler
+value95597 = compute(value, 52)
+value17637 = compute(value, 80)
+value16338 = compute(value, 42)
+const v = os.environ.get('BENCH_KEY_01916');
+value21460 = compute(value, 23)
+# note 5204: keep this in sync with the handler
+value25084 = compute(value, 58)
+value92727 = compute(value, 92)
+value46824 = compute(value, 70)
+value51840 = compute(value, 42)
+value45305 = compute(value, 6)
+value44536 = compute(value, 13)
+value87453 = compute(value, 56)
+value40714 = compute(value, 71)
+# note 42774: keep this in sync with the handler
+value18635 = compute(value, 11)
+value81291 = compute(value, 5)
+value20371 = compute(value, 1)
+value95857 = compute(value, 21)
+value63383 = compute(value, 42)
+value156 = compute(value, 59)
+value52712 = compute(value, 41)
+value81062 = compute(value, 67)
+value96779 = compute(value, 70)
+value9328 = compute(value, 16)
+value57281 = compute(value, 51)
+# note 81465: keep this in sync with the handler
+const v = os.getenv("BENCH_KEY_00278");
+value12028 = compute(value, 0)
+value27493 = compute(value, 42)
+value86990 = compute(value, 78)
+value89565 = compute(value, 34)
+value51150 = compute(value, 31)
+value56129 = compute(value, 63)
+value69937 = compute(value, 0)
+value27302 = compute(value, 45)
+value72458 = compute(value, 96)
+const v = os.getenv("BENCH_KEY_00602");
+value43014 = compute(value, 43)
+value97038 = compute(value, 38)
+value36834 = compute(value, 71)
+value95697 = compute(value, 55)
+value26404 = compute(value, 20)
+# note 53601: keep this in sync with the handler
+# note 57134: keep this in sync with the handler
+value81847 = compute(value, 76)
+# note 98082: keep this in sync with the handler
+# note 77515: keep this in sync with the handler
+const v = os.getenv("BENCH_KEY_01290");
+value92897 = compute(value, 68)
+value20474 = compute(value, 7)
+value9639 = compute(value, 36)
+value45239 = compute(value, 37)
+value71905 = compute(value, 28)
+# note 73562: keep this in sync with the handler
+value57212 = compute(value, 79)
+value94090 = compute(value, 0)
+value36750 = compute(value, 84)
+value40178 = compute(value, 20)
+value39575 = compute(value, 96)
+value5493 = compute(value, 61)
+value22216 = compute(value, 3)
+const v = os.environ["BENCH_KEY_01609"];
+# note 79505: keep this in sync with the handler
+value85405 = compute(value, 45)
+value56338 = compute(value, 78)
+value11569 = compute(value, 26)
+value5311 = compute(value, 73)
+value80896 = compute(value, 95)
+value18769 = compute(value, 48)
+value88297 = compute(value, 27)
+value13382 = compute(value, 93)
+value69232 = compute(value, 71)
+# note 52541: keep this in sync with the handler
+value40329 = compute(value, 74)
+value34923 = compute(value, 3)
+value13713 = compute(value, 36)
+value51260 = compute(value, 44)
+value33578 = compute(value, 16)
+value2450 = compute(value, 25)
+const v = os.getenv("BENCH_KEY_00893");
+value32233 = compute(value, 29)
+value58318 = compute(value, 21)
+value33196 = compute(value, 22)
+value71387 = compute(value, 92)
+value49120 = compute(value, 38)
+value66550 = compute(value, 8)
+value89048 = compute(value, 2)
+value65733 = compute(value, 64)
+value78464 = compute(value, 88)
+value32165 = compute(value, 58)
+value14599 = compute(value, 49)
+value79800 = compute(value, 66)
+# note 66327: keep this in sync with the handler
+value28669 = compute(value, 54)
+value34004 = compute(value, 54)
+value21916 = compute(value, 91)
+value83958 = compute(value, 53)
+value82211 = compute(value, 52)
+value13628 = compute(value, 48)
+value41031 = compute(value, 0)
+const v = os.environ["BENCH_KEY_00636"];
+# note 84209: keep this in sync with the handler
+value83188 = compute(value, 59)
+value88166 = compute(value, 90)
+value83668 = compute(value, 54)
+value9442 = compute(value, 33)
+value34987 = compute(value, 67)
+value25559 = compute(value, 48)
+value46790 = compute(value, 36)
+value21985 = compute(value, 63)
+# note 18290: keep this in sync with the handler
+value63536 = compute(value, 1)
+value94054 = compute(value, 61)
+value99580 = compute(value, 58)
+value9140 = compute(value, 22)
+value56180 = compute(value, 17)
+value72729 = compute(value, 76)
+value31735 = compute(value, 16)
+value71320 = compute(value, 25)
+value10207 = compute(value, 22)
+value48987 = compute(value, 2)
+const v = os.environ["BENCH_KEY_01369"];
+# note 65086: keep this in sync with the handler
+value30479 = compute(value, 21)
+# note 52311: keep this in sync with the handler
+value16489 = compute(value, 96)
+value47393 = compute(value, 57)
+value76144 = compute(value, 96)
+value78326 = compute(value, 47)
+value71133 = compute(value, 32)
+value32801 = compute(value, 15)
+value63253 = compute(value, 9)
+value90232 = compute(value, 22)
+# note 22184: keep this in sync with the handler
+value58451 = compute(value, 57)
+value92418 = compute(value, 74)
+const v = os.environ.get('BENCH_KEY_01014');
+value36023 = compute(value, 36)
+# note 47994: keep this in sync with the handler
+value26538 = compute(value, 57)
+value97737 = compute(value, 58)
+value81564 = compute(value, 84)
+value4615 = compute(value, 56)
+value45510 = compute(value, 17)
+value13525 = compute(value, 42)
+value74191 = compute(value, 83)
+value37064 = compute(value, 10)
+value64636 = compute(value, 34)
+# note 84606: keep this in sync with the handler
+value38724 = compute(value, 21)
+value28690 = compute(value, 75)
+value18520 = compute(value, 90)
+value12492 = compute(value, 76)
+value79056 = compute(value, 1)
+value61424 = compute(value, 23)
+value4005 = compute(value, 28)
+value40290 = compute(value, 35)
+const v = os.environ.get('BENCH_KEY_01045');
+value33443 = compute(value, 75)
+value9155 = compute(value, 37)
+value33647 = compute(value, 85)
+# note 45995: keep this in sync with the handler
+value94781 = compute(value, 12)
+value82263 = compute(value, 7)
+value23876 = compute(value, 14)
+value71685 = compute(value, 2)
+value10522 = compute(value, 46)
+value7018 = compute(value, 34)
+# note 34589: keep this in sync with the handler
+const v = os.getenv("BENCH_KEY_01947");
+value32959 = compute(value, 76)
+value78040 = compute(value, 52)
+value15883 = compute(value, 72)
+value85694 = compute(value, 43)
+value69946 = compute(value, 9)
+value47726 = compute(value, 2)
+# note 35074: keep this in sync with the handler
+value93020 = compute(value, 94)
+value54809 = compute(value, 4)
+value76847 = compute(value, 23)
+value45850 = compute(value, 66)
+value32029 = compute(value, 19)
+value50513 = compute(value, 73)
+value80539 = compute(value, 29)
+value90302 = compute(value, 92)
+value20450 = compute(value, 80)
+value97349 = compute(value, 58)
+# note 12728: keep this in sync with the handler
+value10440 = compute(value, 61)
+const v = os.environ.get('BENCH_KEY_01342');
+value2975 = compute(value, 65)
+value20193 = compute(value, 17)
+value75890 = compute(value, 36)
+# note 84518: keep this in sync with the handler
+value24558 = compute(value, 17)
+value28491 = compute(value, 70)
+value33052 = compute(value, 72)
+value93242 = compute(value, 25)
+value32748 = compute(value, 59)
+# note 63386: keep this in sync with the handler
+value30810 = compute(value, 61)
@@ -0,0 +1,202 @@
+const value12868 = compute(value, 64);
+const value97743 = compute(value, 64);
+const value13892 = compute(value, 21);
+const value91878 = compute(value, 19);
+const value75975 = compute(value, 24);
+// note 67685: keep this in sync with the handler
+const value69986 = compute(value, 49);
+const value40891 = compute(value, 54);
+const value62640 = compute(value, 75);
+const value60012 = compute(value, 66);
+const v = process.env.BENCH_KEY_00275;
+// note 33769: keep this in sync with the handler
+const value2535 = compute(value, 13);
+// note 62135: keep this in sync with the handler
+const value62075 = compute(value, 92);
+const value76904 = compute(value, 80);
+// note 43375: keep this in sync with the handler
+const value60958 = compute(value, 42);
+// note 92831: keep this in sync with the handler
+const value78647 = compute(value, 77);
+// note 17104: keep this in sync with the handler
+const value79690 = compute(value, 53);
+const value91979 = compute(value, 23);
+// note 20018: keep this in sync with the handler
+const value53487 = compute(value, 40);
+const value6495 = compute(value, 93);
+const value87242 = compute(value, 39);
+const value64392 = compute(value, 81);
+const value87415 = compute(value, 18);
+const v = process.env.BENCH_KEY_01467;
+const value12500 = compute(value, 84);
+// note 59162: keep this in sync with the handler
+const value93867 = compute(value, 68);
+// note 87392: keep this in sync with the handler
+const value9568 = compute(value, 62);
+// note 96470: keep this in sync with the handler
+const value18560 = compute(value, 33);
+const v = process.env.BENCH_KEY_00052;
+const value10413 = compute(value, 34);
+const value24012 = compute(value, 53);
+// note 27992: keep this in sync with the handler
+const value12845 = compute(value, 41);
+const value14937 = compute(value, 96);
+const value87366 = compute(value, 66);
+const value19956 = compute(value, 71);
+// note 6481: keep this in sync with the handler
+const value75520 = compute(value, 54);
+const value53391 = compute(value, 41);
+const v = process.env["BENCH_KEY_00058"];
+const value42745 = compute(value, 65);
+const value12342 = compute(value, 23);
+const value93240 = compute(value, 23);
+const value69770 = compute(value, 27);
+const value62325 = compute(value, 51);
+const value57576 = compute(value, 55);
+const value60332 = compute(value, 95);
+const value96536 = compute(value, 21);
+const value72163 = compute(value, 92);
+const value8100 = compute(value, 49);
+const value44206 = compute(value, 71);
+const value24981 = compute(value, 52);
+const value12499 = compute(value, 83);
+const value34553 = compute(value, 21);
+// note 42955: keep this in sync with the handler
+const value41622 = compute(value, 9);
+const value72003 = compute(value, 29);
+const value114 = compute(value, 17);
+const value16814 = compute(value, 33);
+const v = process.env.BENCH_KEY_01991;
+// note 15278: keep this in sync with the handler
+const value87452 = compute(value, 55);
+const value71985 = compute(value, 11);
+// note 87756: keep this in sync with the handler
+const value24005 = compute(value, 46);
+const value9433 = compute(value, 24);
+const value48791 = compute(value, 0);
+const value55670 = compute(value, 89);
+const value46435 = compute(value, 69);
+const value83023 = compute(value, 88);
+// note 17446: keep this in sync with the handler
+const value45698 = compute(value, 11);
+const value84447 = compute(value, 57);
+const v = process.env["BENCH_KEY_01338"];
+const value82298 = compute(value, 42);
+// note 8461: keep this in sync with the handler
+// note 31040: keep this in sync with the handler
+const value85835 = compute(value, 87);
+// note 75710: keep this in sync with the handler
+const value22584 = compute(value, 80);
+const value55931 = compute(value, 59);
+const value57196 = compute(value, 63);
+const value78922 = compute(value, 61);
+// note 84721: keep this in sync with the handler
+const value13224 = compute(value, 32);
+const value25785 = compute(value, 80);
+const v = process.env.BENCH_KEY_01770;
+// note 66309: keep this in sync with the handler
+const value43980 = compute(value, 39);
+const value99046 = compute(value, 9);
+const value64263 = compute(value, 49);
+const value68960 = compute(value, 90);
+const value22154 = compute(value, 38);
+const value60646 = compute(value, 21);
+const value7468 = compute(value, 96);
+const value49034 = compute(value, 49);
+const value34296 = compute(value, 55);
+const value55931 = compute(value, 59);
+const value57418 = compute(value, 91);
+const value43672 = compute(value, 22);
+const value74301 = compute(value, 96);
+const v = process.env.BENCH_KEY_01978;
+const value20819 = compute(value, 61);
+const value23969 = compute(value, 10);
+const value82327 = compute(value, 71);
+const value93817 = compute(value, 18);
+const value71104 = compute(value, 3);
+const value34145 = compute(value, 1);
+// note 33006: keep this in sync with the handler
+const value26424 = compute(value, 40);
+const value91683 = compute(value, 18);
+const value79846 = compute(value, 15);
+const value45182 = compute(value, 77);
+const value40923 = compute(value, 86);
+const value55196 = compute(value, 3);
+const value13190 = compute(value, 95);
+const value71064 = compute(value, 60);
+const v = process.env["BENCH_KEY_01694"];
+const value15849 = compute(value, 38);
+const value26644 = compute(value, 66);
+const value7414 = compute(value, 42);
+const value44778 = compute(value, 61);
+const value46599 = compute(value, 39);
+// note 55896: keep this in sync with the handler
+const value60971 = compute(value, 55);
+const value43695 = compute(value, 45);
+const value6252 = compute(value, 44);
+const value84624 = compute(value, 40);
+const value1897 = compute(value, 54);
+const value81677 = compute(value, 3);
+// note 99663: keep this in sync with the handler
+const value87646 = compute(value, 55);
+const value52195 = compute(value, 9);
+const value5248 = compute(value, 10);
+const value92188 = compute(value, 38);
+const value8754 = compute(value, 24);
+const v = process.env["BENCH_KEY_00333"];
+const value98609 = compute(value, 57);
+// note 70160: keep this in sync with the handler
+const value61389 = compute(value, 85);
+const value84718 = compute(value, 37);
+const value16994 = compute(value, 19);
+const value51522 = compute(value, 15);
+const value78582 = compute(value, 12);
+const value8536 = compute(value, 0);
+const value33263 = compute(value, 89);
+const value7109 = compute(value, 28);
+// note 82189: keep this in sync with the handler
+const value91274 = compute(value, 94);
+const value13169 = compute(value, 74);
+const value5840 = compute(value, 20);
+const value49908 = compute(value, 50);
+const value7584 = compute(value, 18);
+const value21375 = compute(value, 35);
+const value85263 = compute(value, 0);
+const value73246 = compute(value, 11);
+const v = process.env.BENCH_KEY_01503;
+const value81706 = compute(value, 32);
+const value94131 = compute(value, 41);
+const value3231 = compute(value, 30);
+// note 32556: keep this in sync with the handler
+const value35204 = compute(value, 90);
+const value31353 = compute(value, 22);
+const value70286 = compute(value, 58);
+const value24090 = compute(value, 34);
+const value97259 = compute(value, 65);
+const value96933 = compute(value, 30);
+const value53033 = compute(value, 71);
+const value88019 = compute(value, 40);
+const v = process.env["BENCH_KEY_00701"];
+const value45366 = compute(value, 67);
+const value96293 = compute(value, 69);
+// note 62086: keep this in sync with the handler
+const value51525 = compute(value, 18);
+const value50806 = compute(value, 75);
+const value38114 = compute(value, 90);
+const value12895 = compute(value, 91);
+const value60816 = compute(value, 94);
+const v = import.meta.env.BENCH_KEY_00019;
+const value27064 = compute(value, 1);
+// note 68506: keep this in sync with the handler
+const value1502 = compute(value, 47);
+const value87147 = compute(value, 41);
+const value74281 = compute(value, 76);
+// note 19870: keep this in sync with the handler
+// note 49607: keep this in sync with the handler
+const value59327 = compute(value, 60);
+const value93850 = compute(value, 51);
+const value77445 = compute(value, 39);
+const value536 = compute(value, 51);
+const value38095 = compute(value, 71);
+// note 21836: keep this in sync with the handler
+const v = import.meta.env.BENCH_KEY_01613;
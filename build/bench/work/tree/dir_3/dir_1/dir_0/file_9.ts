@@ -0,0 +1,203 @@
+const value21452 = compute(value, 15);
+const value88260 = compute(value, 87);
+const value12533 = compute(value, 20);
+const value73203 = compute(value, 65);
+const value30467 = compute(value, 9);
+// note 31453: keep this in sync with the handler
+const v = process.env["BENCH_KEY_00103"];
+const value40494 = compute(value, 45);
+const value46559 = compute(value, 96);
+const value22946 = compute(value, 54);
+const value65678 = compute(value, 9);
+const value18791 = compute(value, 70);
+const value7904 = compute(value, 47);
+const value50650 = compute(value, 16);
+const v = process.env["BENCH_KEY_00823"];
+const value87157 = compute(value, 51);
+const value1456 = compute(value, 1);
+const value51245 = compute(value, 29);
+const value29036 = compute(value, 33);
+const value97573 = compute(value, 88);
+const value42617 = compute(value, 34);
+const value68946 = compute(value, 76);
+// note 29632: keep this in sync with the handler
+const value85847 = compute(value, 2);
+const value43163 = compute(value, 95);
+const value27081 = compute(value, 18);
+const value19845 = compute(value, 57);
+const value63077 = compute(value, 27);
+const v = process.env.BENCH_KEY_01653;
+const value23591 = compute(value, 20);
+const value20912 = compute(value, 57);
+const value97173 = compute(value, 76);
+const value96018 = compute(value, 85);
+const value45057 = compute(value, 49);
+// note 6907: keep this in sync with the handler
+const value84432 = compute(value, 42);
+// note 17724: keep this in sync with the handler
+const value74325 = compute(value, 23);
+const value61932 = compute(value, 46);
+const value82211 = compute(value, 52);
+const value63238 = compute(value, 91);
+const value21666 = compute(value, 35);
+const value29360 = compute(value, 66);
+const value60924 = compute(value, 8);
+const value9816 = compute(value, 19);
+// note 66829: keep this in sync with the handler
+const v = import.meta.env.BENCH_KEY_01346;
+const value60607 = compute(value, 79);
+const value36198 = compute(value, 17);
+const value55610 = compute(value, 29);
+const value28773 = compute(value, 61);
+const value83194 = compute(value, 65);
+const value53174 = compute(value, 18);
+const value65842 = compute(value, 76);
+const value88223 = compute(value, 50);
+const value2275 = compute(value, 44);
+// note 80165: keep this in sync with the handler
+const value41760 = compute(value, 50);
+const v = import.meta.env.BENCH_KEY_01616;
+const value58034 = compute(value, 28);
+const value78735 = compute(value, 68);
+const value92913 = compute(value, 84);
+const value24670 = compute(value, 32);
+const value55210 = compute(value, 17);
+const value34878 = compute(value, 55);
+const value14511 = compute(value, 58);
+// note 64905: keep this in sync with the handler
+const value71708 = compute(value, 25);
+const value86619 = compute(value, 95);
+const value63255 = compute(value, 11);
+const value89993 = compute(value, 74);
+// note 24562: keep this in sync with the handler
+const value83041 = compute(value, 9);
+const value68428 = compute(value, 43);
+// note 97471: keep this in sync with the handler
+const v = process.env.BENCH_KEY_00012;
+const value95958 = compute(value, 25);
+// note 63065: keep this in sync with the handler
+const value66643 = compute(value, 4);
+const value85661 = compute(value, 10);
+const value70727 = compute(value, 14);
+const value45692 = compute(value, 5);
+const value24628 = compute(value, 87);
+const value61739 = compute(value, 47);
+const value17291 = compute(value, 25);
+const value17040 = compute(value, 65);
+const value5415 = compute(value, 80);
+const value20969 = compute(value, 17);
+const value88156 = compute(value, 80);
+const value91706 = compute(value, 41);
+const v = import.meta.env.BENCH_KEY_01870;
+const value32724 = compute(value, 35);
+const value31065 = compute(value, 25);
+// note 48741: keep this in sync with the handler
+const value34239 = compute(value, 95);
+const value95338 = compute(value, 84);
+const value26097 = compute(value, 4);
+const value81681 = compute(value, 7);
+const value13729 = compute(value, 52);
+const v = import.meta.env.BENCH_KEY_01992;
+const value59374 = compute(value, 10);
+const value76571 = compute(value, 38);
+// note 27256: keep this in sync with the handler
+// note 81698: keep this in sync with the handler
+const value62952 = compute(value, 96);
+const value68074 = compute(value, 77);
+const value19408 = compute(value, 8);
+const value39742 = compute(value, 69);
+const value72599 = compute(value, 43);
+// note 43304: keep this in sync with the handler
+const value81827 = compute(value, 56);
+const value33283 = compute(value, 12);
+const value39056 = compute(value, 62);
+const v = process.env.BENCH_KEY_00677;
+const value96587 = compute(value, 72);
+const value50889 = compute(value, 61);
+const value47153 = compute(value, 11);
+const value6352 = compute(value, 47);
+const value7669 = compute(value, 6);
+const value10166 = compute(value, 78);
+const value24047 = compute(value, 88);
+const value8247 = compute(value, 2);
+const value30424 = compute(value, 63);
+const value50859 = compute(value, 31);
+const value74400 = compute(value, 1);
+const value72907 = compute(value, 60);
+const value83414 = compute(value, 91);
+const v = process.env["BENCH_KEY_00118"];
+const value46129 = compute(value, 54);
+const value16307 = compute(value, 11);
+const value84435 = compute(value, 45);
+const value53949 = compute(value, 17);
+const value77775 = compute(value, 78);
+const value2495 = compute(value, 70);
+const value8550 = compute(value, 14);
+const value65316 = compute(value, 35);
+const value78475 = compute(value, 2);
+const value16925 = compute(value, 47);
+const value27599 = compute(value, 51);
+const value60484 = compute(value, 53);
+const v = process.env.BENCH_KEY_00445;
+const value91355 = compute(value, 78);
+const value60543 = compute(value, 15);
+const value37380 = compute(value, 35);
+const value16359 = compute(value, 63);
+const value37252 = compute(value, 4);
+// note 13608: keep this in sync with the handler
+const value31700 = compute(value, 78);
+// note 50436: keep this in sync with the handler
+const value77436 = compute(value, 30);
+const value12417 = compute(value, 1);
+const value80421 = compute(value, 8);
+const v = process.env["BENCH_KEY_00542"];
+const value59330 = compute(value, 63);
+const value87093 = compute(value, 84);
+const value35250 = compute(value, 39);
+// note 38075: keep this in sync with the handler
+// note 57194: keep this in sync with the handler
+const value24210 = compute(value, 57);
+const value29241 = compute(value, 44);
+const value45799 = compute(value, 15);
+const value64781 = compute(value, 82);
+const value76310 = compute(value, 68);
+const value49852 = compute(value, 91);
+const value19972 = compute(value, 87);
+const value77748 = compute(value, 51);
+const value8580 = compute(value, 44);
+const value47561 = compute(value, 31);
+// note 73415: keep this in sync with the handler
+// note 86715: keep this in sync with the handler
+const v = import.meta.env.BENCH_KEY_01734;
+// note 79186: keep this in sync with the handler
+// note 2133: keep this in sync with the handler
+const value61841 = compute(value, 52);
+const value39680 = compute(value, 7);
+const value60385 = compute(value, 51);
+const value86059 = compute(value, 20);
+// note 45004: keep this in sync with the handler
+const value60644 = compute(value, 19);
+const value70772 = compute(value, 59);
+const value12936 = compute(value, 35);
+const value51309 = compute(value, 93);
+const value76668 = compute(value, 38);
+const value20492 = compute(value, 25);
+const value19562 = compute(value, 65);
+const value61985 = compute(value, 2);
+const value67095 = compute(value, 68);
+const v = import.meta.env.BENCH_KEY_01145;
+const value15522 = compute(value, 2);
+const value69876 = compute(value, 36);
+const value87598 = compute(value, 7);
+// note 13298: keep this in sync with the handler
+const value10966 = compute(value, 5);
+const value51398 = compute(value, 85);
+const value51774 = compute(value, 73);
+const value27859 = compute(value, 20);
+const value71193 = compute(value, 92);
+// note 17871: keep this in sync with the handler
+const value16481 = compute(value, 88);
+const value48299 = compute(value, 90);
+const v = process.env.BENCH_KEY_00750;
+const value96964 = compute(value, 61);
+const value11763 = compute(value, 26);
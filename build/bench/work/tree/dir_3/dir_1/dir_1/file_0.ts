@@ -0,0 +1,204 @@
+const value33015 = compute(value, 35);
+const value13120 = compute(value, 25);
+const v = process.env.BENCH_KEY_01477;
+const value47737 = compute(value, 13);
+const value61452 = compute(value, 51);
+const value60065 = compute(value, 22);
+const value73725 = compute(value, 5);
+const value53893 = compute(value, 58);
+const value87205 = compute(value, 2);
+const value39293 = compute(value, 8);
+const value18846 = compute(value, 28);
+const value84761 = compute(value, 80);
+const value52328 = compute(value, 45);
+const value21437 = compute(value, 0);
+const value28082 = compute(value, 49);
+const v = import.meta.env.BENCH_KEY_01058;
+const value2617 = compute(value, 95);
+const value88618 = compute(value, 57);
+const value45937 = compute(value, 56);
+const value70929 = compute(value, 22);
+const value88453 = compute(value, 86);
+const value19268 = compute(value, 62);
+const value48059 = compute(value, 44);
+const value37227 = compute(value, 76);
+const value34176 = compute(value, 32);
+const value22324 = compute(value, 14);
+const value90877 = compute(value, 85);
+const value45258 = compute(value, 56);
+const value9135 = compute(value, 17);
+const value41001 = compute(value, 67);
+const value36366 = compute(value, 88);
+const value27917 = compute(value, 78);
+// note 42361: keep this in sync with the handler
+const value38922 = compute(value, 25);
+const v = process.env["BENCH_KEY_01845"];
+const value9575 = compute(value, 69);
+const value11418 = compute(value, 69);
+const value57184 = compute(value, 51);
+const value52225 = compute(value, 39);
+const value49579 = compute(value, 12);
+// note 38853: keep this in sync with the handler
+const value80342 = compute(value, 26);
+const value2735 = compute(value, 19);
+// note 15561: keep this in sync with the handler
+const value6527 = compute(value, 28);
+const value53813 = compute(value, 75);
+const v = import.meta.env.BENCH_KEY_00228;
+const value37722 = compute(value, 86);
+const value18307 = compute(value, 71);
+const value25172 = compute(value, 49);
+const value23303 = compute(value, 23);
+const value85945 = compute(value, 3);
+const value49206 = compute(value, 27);
+const value25094 = compute(value, 68);
+const value82513 = compute(value, 63);
+const value28996 = compute(value, 90);
+const value72668 = compute(value, 15);
+const v = import.meta.env.BENCH_KEY_01803;
+const value38186 = compute(value, 65);
+const value84726 = compute(value, 45);
+const value82411 = compute(value, 58);
+const value94898 = compute(value, 32);
+const value99488 = compute(value, 63);
+const value98817 = compute(value, 71);
+const value49862 = compute(value, 4);
+const value37885 = compute(value, 55);
+const value3169 = compute(value, 65);
+const value77317 = compute(value, 8);
+const value78874 = compute(value, 13);
+const value89711 = compute(value, 83);
+const v = process.env["BENCH_KEY_01118"];
+const value30323 = compute(value, 59);
+const value62772 = compute(value, 13);
+const value95100 = compute(value, 40);
+const value13683 = compute(value, 6);
+const value19482 = compute(value, 82);
+// note 70585: keep this in sync with the handler
+const value55865 = compute(value, 90);
+const value65090 = compute(value, 3);
+const value76472 = compute(value, 36);
+const value7483 = compute(value, 14);
+const value38985 = compute(value, 88);
+const value80504 = compute(value, 91);
+const value68441 = compute(value, 56);
+const value60919 = compute(value, 3);
+const value40067 = compute(value, 6);
+const v = process.env.BENCH_KEY_00642;
+const value73933 = compute(value, 19);
+const value21567 = compute(value, 33);
+const value35989 = compute(value, 2);
+const value52855 = compute(value, 87);
+const value31666 = compute(value, 44);
+const value18002 = compute(value, 57);
+const value83981 = compute(value, 76);
+const value40736 = compute(value, 93);
+const value2354 = compute(value, 26);
+const value63484 = compute(value, 46);
+const value55218 = compute(value, 25);
+// note 74004: keep this in sync with the handler
+const value4414 = compute(value, 49);
+const value22391 = compute(value, 81);
+// note 14905: keep this in sync with the handler
+const value56294 = compute(value, 34);
+const value43825 = compute(value, 78);
+const value98118 = compute(value, 51);
+const v = process.env["BENCH_KEY_01262"];
+const value63284 = compute(value, 40);
+const value21191 = compute(value, 45);
+const value41056 = compute(value, 25);
+// note 87647: keep this in sync with the handler
+const value11706 = compute(value, 66);
+const value60108 = compute(value, 65);
+// note 5494: keep this in sync with the handler
+const value97004 = compute(value, 4);
+const value47377 = compute(value, 41);
+const value88073 = compute(value, 94);
+const value98757 = compute(value, 11);
+const value18336 = compute(value, 3);
+// note 38070: keep this in sync with the handler
+const value28761 = compute(value, 49);
+const value8084 = compute(value, 33);
+const value23925 = compute(value, 63);
+const value18149 = compute(value, 10);
+const v = import.meta.env.BENCH_KEY_01892;
+const value74562 = compute(value, 66);
+const value53417 = compute(value, 67);
+const value18908 = compute(value, 90);
+const value70350 = compute(value, 25);
+const value12107 = compute(value, 79);
+const value30150 = compute(value, 80);
+// note 73718: keep this in sync with the handler
+const value82552 = compute(value, 5);
+const value60483 = compute(value, 52);
+const value95872 = compute(value, 36);
+// note 17153: keep this in sync with the handler
+const value18745 = compute(value, 24);
+// note 51226: keep this in sync with the handler
+const value88137 = compute(value, 61);
+const value71395 = compute(value, 3);
+const value99073 = compute(value, 36);
+const value27824 = compute(value, 82);
+const value6293 = compute(value, 85);
+const v = process.env["BENCH_KEY_01660"];
+const value47654 = compute(value, 27);
+const value107 = compute(value, 10);
+const value75806 = compute(value, 49);
+const value79915 = compute(value, 84);
+const value80571 = compute(value, 61);
+const value26150 = compute(value, 57);
+// note 74806: keep this in sync with the handler
+const value17879 = compute(value, 31);
+// note 58013: keep this in sync with the handler
+const value83934 = compute(value, 29);
+const value50555 = compute(value, 18);
+const v = import.meta.env.BENCH_KEY_01196;
+const value19689 = compute(value, 95);
+const value62243 = compute(value, 66);
+const value50682 = compute(value, 48);
+const value424 = compute(value, 36);
+// note 67572: keep this in sync with the handler
+const value71551 = compute(value, 62);
+const value59430 = compute(value, 66);
+const value69770 = compute(value, 27);
+const value35549 = compute(value, 47);
+// note 33718: keep this in sync with the handler
+// note 10354: keep this in sync with the handler
+const v = process.env["BENCH_KEY_01073"];
+const value86736 = compute(value, 18);
+const value36422 = compute(value, 47);
+const value13733 = compute(value, 56);
+const value57484 = compute(value, 60);
+const value10780 = compute(value, 13);
+// note 23069: keep this in sync with the handler
+const value1782 = compute(value, 36);
+const value93244 = compute(value, 27);
+// note 71269: keep this in sync with the handler
+const value93574 = compute(value, 66);
+const value36450 = compute(value, 75);
+const value26714 = compute(value, 39);
+const value88795 = compute(value, 40);
+const value69888 = compute(value, 48);
+const value80878 = compute(value, 77);
+const value70493 = compute(value, 71);
+const value50663 = compute(value, 29);
+const v = process.env["BENCH_KEY_01807"];
+// note 83097: keep this in sync with the handler
+const value26080 = compute(value, 84);
+const value30559 = compute(value, 4);
+// note 32207: keep this in sync with the handler
+const value82383 = compute(value, 30);
+const value76484 = compute(value, 48);
+const value84081 = compute(value, 79);
+const value91182 = compute(value, 2);
+const value95601 = compute(value, 56);
+const value54649 = compute(value, 38);
+const v = process.env.BENCH_KEY_00287;
+// note 47495: keep this in sync with the handler
+const value45534 = compute(value, 41);
+const value8047 = compute(value, 93);
+const value82126 = compute(value, 64);
+const value65218 = compute(value, 34);
+const value42943 = compute(value, 69);
+const value54736 = compute(value, 28);
+// note 52493: keep this in sync with the handler
@@ -0,0 +1,231 @@
+value65384 := compute(value, 6)
+value27015 := compute(value, 49)
+// note 22426: keep this in sync with the handler
+const v = os.Getenv("BENCH_KEY_00003");
+value81445 := compute(value, 62)
+// note 74189: keep this in sync with the handler
+value65281 := compute(value, 0)
+value88379 := compute(value, 12)
+value87444 := compute(value, 47)
+value10260 := compute(value, 75)
+value77014 := compute(value, 93)
+value92737 := compute(value, 5)
+value8430 := compute(value, 88)
+value98409 := compute(value, 51)
+value91532 := compute(value, 61)
+value19380 := compute(value, 77)
+value9101 := compute(value, 80)
+value15265 := compute(value, 36)
+value86648 := compute(value, 27)
+value77128 := compute(value, 13)
+value61604 := compute(value, 9)
+value56554 := compute(value, 3)
+value87132 := compute(value, 26)
+value6357 := compute(value, 52)
+const v = os.LookupEnv("BENCH_KEY_01095");
+value12171 := compute(value, 46)
+value21044 := compute(value, 92)
+value14615 := compute(value, 65)
+value26092 := compute(value, 96)
+value79407 := compute(value, 61)
+// note 3370: keep this in sync with the handler
+value49310 := compute(value, 34)
+// note 33379: keep this in sync with the handler
+const v = os.LookupEnv("BENCH_KEY_01072");
+value41015 := compute(value, 81)
+value73728 := compute(value, 8)
+value18336 := compute(value, 3)
+value78462 := compute(value, 86)
+value64929 := compute(value, 36)
+// note 87551: keep this in sync with the handler
+value1694 := compute(value, 45)
+// note 71934: keep this in sync with the handler
+// note 24774: keep this in sync with the handler
+value75585 := compute(value, 22)
+const v = os.Getenv("BENCH_KEY_00552");
+value62606 := compute(value, 41)
+// note 45312: keep this in sync with the handler
+value44670 := compute(value, 50)
+value40899 := compute(value, 62)
+// note 96021: keep this in sync with the handler
+value43721 := compute(value, 71)
+value19825 := compute(value, 37)
+value89097 := compute(value, 51)
+value2375 := compute(value, 47)
+value45619 := compute(value, 29)
+// note 7127: keep this in sync with the handler
+value38490 := compute(value, 78)
+value58019 := compute(value, 13)
+value40521 := compute(value, 72)
+value66660 := compute(value, 21)
+const v = os.Getenv("BENCH_KEY_00363");
+value89759 := compute(value, 34)
+value93938 := compute(value, 42)
+value6014 := compute(value, 0)
+value92380 := compute(value, 36)
+value48529 := compute(value, 29)
+value86742 := compute(value, 24)
+// note 1837: keep this in sync with the handler
+value10632 := compute(value, 59)
+value36619 := compute(value, 50)
+value25555 := compute(value, 44)
+value28118 := compute(value, 85)
+value39668 := compute(value, 92)
+value53649 := compute(value, 8)
+value84877 := compute(value, 2)
+value58585 := compute(value, 94)
+value78538 := compute(value, 65)
+value35349 := compute(value, 41)
+// note 2027: keep this in sync with the handler
+value71219 := compute(value, 21)
+value48531 := compute(value, 31)
+const v = os.LookupEnv("BENCH_KEY_01430");
+// note 15260: keep this in sync with the handler
+value4999 := compute(value, 52)
+value38774 := compute(value, 71)
+// note 20570: keep this in sync with the handler
+value64659 := compute(value, 57)
+value9145 := compute(value, 27)
+value24319 := compute(value, 69)
+value37497 := compute(value, 55)
+value13619 := compute(value, 39)
+value89570 := compute(value, 39)
+value45458 := compute(value, 62)
+value14333 := compute(value, 74)
+value87393 := compute(value, 93)
+value52737 := compute(value, 66)
+value58524 := compute(value, 33)
+value17309 := compute(value, 43)
+value71528 := compute(value, 39)
+value76917 := compute(value, 93)
+value84235 := compute(value, 39)
+value68747 := compute(value, 71)
+value80269 := compute(value, 50)
+value35028 := compute(value, 11)
+const v = os.Getenv("BENCH_KEY_01677");
+// note 52859: keep this in sync with the handler
+value88190 := compute(value, 17)
+// note 15282: keep this in sync with the handler
+value28039 := compute(value, 6)
+// note 70746: keep this in sync with the handler
+value30956 := compute(value, 13)
+value72375 := compute(value, 13)
+value14326 := compute(value, 67)
+value56297 := compute(value, 37)
+value69529 := compute(value, 77)
+value54781 := compute(value, 73)
+value89296 := compute(value, 56)
+const v = os.Getenv("BENCH_KEY_01828");
+value88758 := compute(value, 3)
+value91167 := compute(value, 84)
+// note 3385: keep this in sync with the handler
+value50355 := compute(value, 12)
+value54394 := compute(value, 74)
+value24762 := compute(value, 27)
+value52508 := compute(value, 31)
+value58820 := compute(value, 38)
+value25816 := compute(value, 14)
+value4416 := compute(value, 51)
+value33387 := compute(value, 19)
+value74625 := compute(value, 32)
+value83031 := compute(value, 96)
+value23857 := compute(value, 92)
+value65685 := compute(value, 16)
+value69340 := compute(value, 82)
+// note 50038: keep this in sync with the handler
+const v = os.Getenv("BENCH_KEY_01102");
+value4833 := compute(value, 80)
+value84923 := compute(value, 48)
+// note 99780: keep this in sync with the handler
+value1134 := compute(value, 67)
+value99094 := compute(value, 57)
+value88516 := compute(value, 52)
+value26049 := compute(value, 53)
+value98371 := compute(value, 13)
+// note 3462: keep this in sync with the handler
+value53880 := compute(value, 45)
+value20117 := compute(value, 38)
+value38327 := compute(value, 12)
+value86379 := compute(value, 49)
+value29576 := compute(value, 88)
+value51968 := compute(value, 73)
+value67466 := compute(value, 51)
+value17981 := compute(value, 36)
+value43345 := compute(value, 83)
+value63690 := compute(value, 58)
+value68690 := compute(value, 14)
+const v = os.LookupEnv("BENCH_KEY_00869");
+value31914 := compute(value, 1)
+// note 81358: keep this in sync with the handler
+value29953 := compute(value, 77)
+value35207 := compute(value, 93)
+// note 3900: keep this in sync with the handler
+value81230 := compute(value, 41)
+value40604 := compute(value, 58)
+value21892 := compute(value, 67)
+value99255 := compute(value, 24)
+value48364 := compute(value, 58)
+// note 92757: keep this in sync with the handler
+const v = os.Getenv("BENCH_KEY_01472");
+value42336 := compute(value, 44)
+value28469 := compute(value, 48)
+value2069 := compute(value, 32)
+value17391 := compute(value, 28)
+// note 13026: keep this in sync with the handler
+value44376 := compute(value, 47)
+value11178 := compute(value, 23)
+value412 := compute(value, 24)
+value2035 := compute(value, 95)
+value34860 := compute(value, 37)
+value23922 := compute(value, 60)
+value79598 := compute(value, 58)
+// note 64168: keep this in sync with the handler
+value1587 := compute(value, 35)
+value64357 := compute(value, 46)
+value39615 := compute(value, 39)
+value179 := compute(value, 82)
+const v = os.LookupEnv("BENCH_KEY_00053");
+value53150 := compute(value, 91)
+value35296 := compute(value, 85)
+value98043 := compute(value, 73)
+value44076 := compute(value, 38)
+value57705 := compute(value, 87)
+value14741 := compute(value, 94)
+value84518 := compute(value, 31)
+value15418 := compute(value, 92)
+value85947 := compute(value, 5)
+value72183 := compute(value, 15)
+value14805 := compute(value, 61)
+value68329 := compute(value, 41)
+value34012 := compute(value, 62)
+// note 50445: keep this in sync with the handler
+value98585 := compute(value, 33)
+value41975 := compute(value, 71)
+// note 48063: keep this in sync with the handler
+const v = os.Getenv("BENCH_KEY_00357");
+value89671 := compute(value, 43)
+value74374 := compute(value, 72)
+value81636 := compute(value, 59)
+value35110 := compute(value, 93)
+value74535 := compute(value, 39)
+value22547 := compute(value, 43)
+value78150 := compute(value, 65)
+value20923 := compute(value, 68)
+value87599 := compute(value, 8)
+value69065 := compute(value, 1)
+value7110 := compute(value, 29)
+value65837 := compute(value, 71)
+value91215 := compute(value, 35)
+value47143 := compute(value, 1)
+// note 64704: keep this in sync with the handler
+value91582 := compute(value, 14)
+value3185 := compute(value, 81)
+value5898 := compute(value, 78)
+const v = os.Getenv("BENCH_KEY_01485");
+value41153 := compute(value, 25)
+// note 11027: keep this in sync with the handler
+value10615 := compute(value, 42)
+value81751 := compute(value, 77)
+value26422 := compute(value, 38)
+value66181 := compute(value, 27)
+value37061 := compute(value, 7)
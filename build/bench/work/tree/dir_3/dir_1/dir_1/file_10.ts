@@ -0,0 +1,205 @@
+const value41996 = compute(value, 92);
+const value56801 = compute(value, 56);
+const value1970 = compute(value, 30);
+const value27094 = compute(value, 31);
+const value42909 = compute(value, 35);
+const value30579 = compute(value, 24);
+const value39367 = compute(value, 82);
+const value41125 = compute(value, 94);
+const v = process.env.BENCH_KEY_00865;
+const value63203 = compute(value, 56);
+const value17235 = compute(value, 66);
+const value28550 = compute(value, 32);
+const value44680 = compute(value, 60);
+const value28016 = compute(value, 80);
+const value22629 = compute(value, 28);
+const value96460 = compute(value, 42);
+// note 11216: keep this in sync with the handler
+const value170 = compute(value, 73);
+// note 23822: keep this in sync with the handler
+const value59320 = compute(value, 53);
+const value19968 = compute(value, 83);
+const value11854 = compute(value, 20);
+const value70675 = compute(value, 59);
+const value66185 = compute(value, 31);
+const v = process.env.BENCH_KEY_00080;
+const value62323 = compute(value, 49);
+const value5111 = compute(value, 67);
+const value38713 = compute(value, 10);
+const value40516 = compute(value, 67);
+const value95999 = compute(value, 66);
+const value98312 = compute(value, 51);
+const value94691 = compute(value, 19);
+const value33297 = compute(value, 26);
+const value80098 = compute(value, 73);
+const value42443 = compute(value, 54);
+const value87089 = compute(value, 80);
+const value51039 = compute(value, 17);
+const value63618 = compute(value, 83);
+const v = process.env["BENCH_KEY_00798"];
+const value82947 = compute(value, 12);
+const value44172 = compute(value, 37);
+const value45397 = compute(value, 1);
+const value90347 = compute(value, 40);
+const value69400 = compute(value, 45);
+const value51617 = compute(value, 13);
+const value23378 = compute(value, 1);
+const value84717 = compute(value, 36);
+const value99801 = compute(value, 85);
+const v = process.env["BENCH_KEY_01759"];
+const value90889 = compute(value, 0);
+const value38592 = compute(value, 83);
+const value63289 = compute(value, 45);
+// note 82424: keep this in sync with the handler
+const value64969 = compute(value, 76);
+const value41885 = compute(value, 78);
+const value79495 = compute(value, 52);
+// note 24067: keep this in sync with the handler
+const value75860 = compute(value, 6);
+// note 61010: keep this in sync with the handler
+const v = import.meta.env.BENCH_KEY_00316;
+const value95803 = compute(value, 64);
+const value11989 = compute(value, 58);
+const value34197 = compute(value, 53);
+// note 50439: keep this in sync with the handler
+const value43846 = compute(value, 2);
+const value7338 = compute(value, 63);
+const value17920 = compute(value, 72);
+// note 73104: keep this in sync with the handler
+const value89793 = compute(value, 68);
+const value57713 = compute(value, 95);
+const value82802 = compute(value, 61);
+// note 86313: keep this in sync with the handler
+const value66910 = compute(value, 77);
+const value9097 = compute(value, 76);
+const v = import.meta.env.BENCH_KEY_00466;
+const value21367 = compute(value, 27);
+// note 39831: keep this in sync with the handler
+const value59570 = compute(value, 12);
+const value29011 = compute(value, 8);
+const value21837 = compute(value, 12);
+// note 87931: keep this in sync with the handler
+// note 10496: keep this in sync with the handler
+const value49325 = compute(value, 49);
+const value46751 = compute(value, 94);
+const value32093 = compute(value, 83);
+const value94887 = compute(value, 21);
+const value77026 = compute(value, 8);
+const v = import.meta.env.BENCH_KEY_00082;
+const value84533 = compute(value, 46);
+const value39725 = compute(value, 52);
+const value22619 = compute(value, 18);
+const value48251 = compute(value, 42);
+const value45345 = compute(value, 46);
+const value60357 = compute(value, 23);
+const value81277 = compute(value, 88);
+const value57690 = compute(value, 72);
+const value81315 = compute(value, 29);
+const value80158 = compute(value, 36);
+const value18493 = compute(value, 63);
+const value40631 = compute(value, 85);
+const value64240 = compute(value, 26);
+const value19830 = compute(value, 42);
+// note 81868: keep this in sync with the handler
+// note 86992: keep this in sync with the handler
+const v = process.env["BENCH_KEY_01198"];
+const value78643 = compute(value, 73);
+const value77728 = compute(value, 31);
+const value88965 = compute(value, 16);
+const value79911 = compute(value, 80);
+const value24247 = compute(value, 94);
+const value44397 = compute(value, 68);
+const value40936 = compute(value, 2);
+const value52122 = compute(value, 33);
+// note 91966: keep this in sync with the handler
+const value95195 = compute(value, 38);
+const value18555 = compute(value, 28);
+const value48339 = compute(value, 33);
+const value33999 = compute(value, 49);
+const value26467 = compute(value, 83);
+// note 35623: keep this in sync with the handler
+const value95090 = compute(value, 30);
+const v = import.meta.env.BENCH_KEY_01358;
+const value35306 = compute(value, 95);
+const value10339 = compute(value, 57);
+const value35331 = compute(value, 23);
+const value10077 = compute(value, 86);
+const value28397 = compute(value, 73);
+const value44941 = compute(value, 30);
+const value27904 = compute(value, 65);
+const value28036 = compute(value, 3);
+// note 46993: keep this in sync with the handler
+const value33648 = compute(value, 86);
+const value88888 = compute(value, 36);
+const value62224 = compute(value, 47);
+const value9239 = compute(value, 24);
+const value83067 = compute(value, 35);
+const value92017 = compute(value, 61);
+const value86013 = compute(value, 71);
+const value72683 = compute(value, 30);
+const value80199 = compute(value, 77);
+const v = process.env.BENCH_KEY_01228;
+const value31654 = compute(value, 32);
+const value96246 = compute(value, 22);
+const value32688 = compute(value, 96);
+const value75483 = compute(value, 17);
+const value62856 = compute(value, 0);
+const value94270 = compute(value, 83);
+const value11084 = compute(value, 26);
+const value55371 = compute(value, 81);
+const value77494 = compute(value, 88);
+// note 56875: keep this in sync with the handler
+const value80542 = compute(value, 32);
+const value42873 = compute(value, 96);
+const value52585 = compute(value, 11);
+const v = import.meta.env.BENCH_KEY_01048;
+const value51558 = compute(value, 51);
+const value33031 = compute(value, 51);
+const value85937 = compute(value, 92);
+const value6991 = compute(value, 7);
+const value39535 = compute(value, 56);
+const value52045 = compute(value, 53);
+const value37513 = compute(value, 71);
+const value63555 = compute(value, 20);
+const value95371 = compute(value, 20);
+const v = process.env.BENCH_KEY_01403;
+const value79216 = compute(value, 64);
+const value41665 = compute(value, 52);
+const value84018 = compute(value, 16);
+const value13169 = compute(value, 74);
+const value94677 = compute(value, 5);
+const value48316 = compute(value, 10);
+const value62088 = compute(value, 8);
+const value63918 = compute(value, 92);
+const v = process.env["BENCH_KEY_00128"];
+const value51409 = compute(value, 96);
+const value4537 = compute(value, 75);
+const value92967 = compute(value, 41);
+const value18466 = compute(value, 36);
+const value24012 = compute(value, 53);
+const value60840 = compute(value, 21);
+const value6674 = compute(value, 78);
+const value64887 = compute(value, 91);
+const value44888 = compute(value, 74);
+const value14930 = compute(value, 89);
+const value19219 = compute(value, 13);
+const value79031 = compute(value, 73);
+const v = import.meta.env.BENCH_KEY_00965;
+const value54379 = compute(value, 59);
+// note 11824: keep this in sync with the handler
+const value10572 = compute(value, 96);
+const value32723 = compute(value, 34);
+const value46760 = compute(value, 6);
+const value55986 = compute(value, 17);
+const value33394 = compute(value, 26);
+const value8856 = compute(value, 29);
+const value70295 = compute(value, 67);
+const value38019 = compute(value, 92);
+const v = import.meta.env.BENCH_KEY_01896;
+// note 57999: keep this in sync with the handler
+const value13670 = compute(value, 90);
+// note 56355: keep this in sync with the handler
+const value34350 = compute(value, 12);
+const value67435 = compute(value, 20);
+const value54864 = compute(value, 59);
+// note 95174: keep this in sync with the handler
@@ -0,0 +1,214 @@
+let value4652 = compute(value, 93);
+let value50527 = compute(value, 87);
+let value24683 = compute(value, 45);
+let value80369 = compute(value, 53);
+// note 87382: keep this in sync with the handler
+// note 8503: keep this in sync with the handler
+let value88777 = compute(value, 22);
+// note 74835: keep this in sync with the handler
+let value66492 = compute(value, 47);
+let value59029 = compute(value, 53);
+let value20994 = compute(value, 42);
+const v = env::var_os("BENCH_KEY_01677");
+let value50654 = compute(value, 20);
+let value27169 = compute(value, 9);
+let value23017 = compute(value, 28);
+// note 11981: keep this in sync with the handler
+let value51959 = compute(value, 64);
+let value22933 = compute(value, 41);
+let value95473 = compute(value, 25);
+let value58490 = compute(value, 96);
+let value85658 = compute(value, 7);
+// note 55422: keep this in sync with the handler
+let value16635 = compute(value, 48);
+let value27851 = compute(value, 12);
+let value84758 = compute(value, 77);
+let value64827 = compute(value, 31);
+let value65538 = compute(value, 63);
+let value59424 = compute(value, 60);
+let value25955 = compute(value, 56);
+let value67471 = compute(value, 56);
+const v = env::var_os("BENCH_KEY_00132");
+let value76848 = compute(value, 24);
+let value88106 = compute(value, 30);
+let value50535 = compute(value, 95);
+let value34338 = compute(value, 0);
+// note 36284: keep this in sync with the handler
+let value1688 = compute(value, 39);
+let value84196 = compute(value, 0);
+let value86482 = compute(value, 55);
+const v = env::var("BENCH_KEY_01076");
+let value14585 = compute(value, 35);
+let value91412 = compute(value, 38);
+let value27466 = compute(value, 15);
+let value70482 = compute(value, 60);
+let value27991 = compute(value, 55);
+let value71798 = compute(value, 18);
+let value60535 = compute(value, 7);
+let value16764 = compute(value, 80);
+let value58081 = compute(value, 75);
+let value73581 = compute(value, 55);
+// note 48354: keep this in sync with the handler
+let value63830 = compute(value, 4);
+let value7652 = compute(value, 86);
+let value27974 = compute(value, 38);
+let value38766 = compute(value, 63);
+let value79696 = compute(value, 59);
+let value33603 = compute(value, 41);
+let value15013 = compute(value, 75);
+let value14253 = compute(value, 91);
+let value14092 = compute(value, 27);
+const v = env::var("BENCH_KEY_01580");
+let value42529 = compute(value, 43);
+let value82781 = compute(value, 40);
+let value73341 = compute(value, 9);
+let value27914 = compute(value, 75);
+let value80612 = compute(value, 5);
+let value28134 = compute(value, 4);
+let value8217 = compute(value, 69);
+let value37721 = compute(value, 85);
+let value54783 = compute(value, 75);
+let value18781 = compute(value, 60);
+let value60280 = compute(value, 43);
+let value35447 = compute(value, 42);
+let value41649 = compute(value, 36);
+let value90668 = compute(value, 70);
+let value27810 = compute(value, 68);
+let value96305 = compute(value, 81);
+let value77959 = compute(value, 68);
+let value45576 = compute(value, 83);
+let value65654 = compute(value, 82);
+let value94029 = compute(value, 36);
+let value85092 = compute(value, 23);
+const v = env::var("BENCH_KEY_00006");
+let value2415 = compute(value, 87);
+let value36528 = compute(value, 56);
+let value42013 = compute(value, 12);
+let value55326 = compute(value, 36);
+let value58645 = compute(value, 57);
+// note 78311: keep this in sync with the handler
+let value9130 = compute(value, 12);
+// note 81926: keep this in sync with the handler
+const v = env::var_os("BENCH_KEY_01167");
+let value14635 = compute(value, 85);
+let value67488 = compute(value, 73);
+let value17098 = compute(value, 26);
+let value50822 = compute(value, 91);
+let value80606 = compute(value, 96);
+let value85163 = compute(value, 94);
+let value88034 = compute(value, 55);
+let value73718 = compute(value, 95);
+let value9368 = compute(value, 56);
+const v = env::var("BENCH_KEY_00308");
+let value50617 = compute(value, 80);
+let value71183 = compute(value, 82);
+let value74710 = compute(value, 20);
+let value39176 = compute(value, 85);
+let value3846 = compute(value, 63);
+let value2896 = compute(value, 83);
+let value49204 = compute(value, 25);
+let value20405 = compute(value, 35);
+// note 2821: keep this in sync with the handler
+const v = env::var("BENCH_KEY_00632");
+// note 40796: keep this in sync with the handler
+let value28835 = compute(value, 26);
+let value13415 = compute(value, 29);
+let value51596 = compute(value, 89);
+// note 27216: keep this in sync with the handler
+let value50854 = compute(value, 26);
+let value23125 = compute(value, 39);
+let value18826 = compute(value, 8);
+let value3254 = compute(value, 53);
+let value32083 = compute(value, 73);
+let value55550 = compute(value, 66);
+// note 25542: keep this in sync with the handler
+let value61613 = compute(value, 18);
+const v = env::var("BENCH_KEY_00842");
+let value14923 = compute(value, 82);
+let value72371 = compute(value, 9);
+let value46920 = compute(value, 69);
+let value28921 = compute(value, 15);
+// note 45454: keep this in sync with the handler
+// note 16394: keep this in sync with the handler
+let value90109 = compute(value, 93);
+let value88532 = compute(value, 68);
+let value60673 = compute(value, 48);
+let value49412 = compute(value, 39);
+let value11286 = compute(value, 34);
+let value79378 = compute(value, 32);
+const v = env::var("BENCH_KEY_00991");
+let value55457 = compute(value, 70);
+let value10163 = compute(value, 75);
+let value18800 = compute(value, 79);
+let value44269 = compute(value, 37);
+let value43730 = compute(value, 80);
+// note 23283: keep this in sync with the handler
+let value7794 = compute(value, 34);
+let value20294 = compute(value, 21);
+let value47531 = compute(value, 1);
+let value94782 = compute(value, 13);
+let value73834 = compute(value, 17);
+let value44392 = compute(value, 63);
+let value51182 = compute(value, 63);
+let value13908 = compute(value, 37);
+let value59209 = compute(value, 39);
+const v = env::var("BENCH_KEY_00139");
+let value27859 = compute(value, 20);
+let value33537 = compute(value, 72);
+let value10140 = compute(value, 52);
+let value31782 = compute(value, 63);
+let value41474 = compute(value, 55);
+let value184 = compute(value, 87);
+// note 9493: keep this in sync with the handler
+let value81043 = compute(value, 48);
+let value65926 = compute(value, 63);
+let value43484 = compute(value, 28);
+let value17358 = compute(value, 92);
+let value91555 = compute(value, 84);
+let value57356 = compute(value, 29);
+let value59708 = compute(value, 53);
+const v = env::var_os("BENCH_KEY_00808");
+let value59077 = compute(value, 4);
+let value28820 = compute(value, 11);
+// note 16975: keep this in sync with the handler
+let value4564 = compute(value, 5);
+// note 3272: keep this in sync with the handler
+let value45348 = compute(value, 49);
+let value59551 = compute(value, 90);
+let value46247 = compute(value, 75);
+let value77302 = compute(value, 90);
+let value51662 = compute(value, 58);
+let value81304 = compute(value, 18);
+let value70748 = compute(value, 35);
+let value19546 = compute(value, 49);
+// note 53424: keep this in sync with the handler
+const v = env::var_os("BENCH_KEY_01602");
+// note 77278: keep this in sync with the handler
+let value96144 = compute(value, 17);
+let value94178 = compute(value, 88);
+let value50781 = compute(value, 50);
+let value90766 = compute(value, 71);
+let value72038 = compute(value, 64);
+let value59971 = compute(value, 25);
+let value9559 = compute(value, 53);
+const v = env::var("BENCH_KEY_01231");
+let value86489 = compute(value, 62);
+let value42213 = compute(value, 18);
+let value71681 = compute(value, 95);
+let value8993 = compute(value, 69);
+let value89528 = compute(value, 94);
+let value18716 = compute(value, 92);
+let value43662 = compute(value, 12);
+// note 76923: keep this in sync with the handler
+let value29138 = compute(value, 38);
+let value41167 = compute(value, 39);
+let value82861 = compute(value, 23);
+let value77594 = compute(value, 91);
+let value62341 = compute(value, 67);
+let value89947 = compute(value, 28);
+let value74283 = compute(value, 78);
+let value29168 = compute(value, 68);
+let value36568 = compute(value, 96);
+let value22693 = compute(value, 92);
+let value91958 = compute(value, 2);
+let value37414 = compute(value, 69);
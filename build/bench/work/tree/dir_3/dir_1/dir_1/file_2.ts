@@ -0,0 +1,204 @@
+const value77326 = compute(value, 17);
+const value25041 = compute(value, 15);
+const value8832 = compute(value, 5);
+const value27854 = compute(value, 15);
+const value74657 = compute(value, 64);
+// note 87734: keep this in sync with the handler
+// note 13738: keep this in sync with the handler
+const value86408 = compute(value, 78);
+const value92602 = compute(value, 64);
+const value93667 = compute(value, 62);
+const v = import.meta.env.BENCH_KEY_00491;
+const value90647 = compute(value, 49);
+const value83905 = compute(value, 0);
+const value62106 = compute(value, 26);
+// note 79234: keep this in sync with the handler
+const value44222 = compute(value, 87);
+const value3830 = compute(value, 47);
+const value47846 = compute(value, 25);
+const value95056 = compute(value, 93);
+const value46900 = compute(value, 49);
+const v = process.env["BENCH_KEY_01898"];
+const value94371 = compute(value, 87);
+const value33982 = compute(value, 32);
+const value68181 = compute(value, 87);
+const value13673 = compute(value, 93);
+const value50479 = compute(value, 39);
+const value42892 = compute(value, 18);
+const value83716 = compute(value, 5);
+const value93495 = compute(value, 84);
+const value21634 = compute(value, 3);
+const value58461 = compute(value, 67);
+const value72744 = compute(value, 91);
+const value92537 = compute(value, 96);
+const value8601 = compute(value, 65);
+const value9408 = compute(value, 96);
+const v = process.env["BENCH_KEY_00274"];
+const value42440 = compute(value, 51);
+const value77526 = compute(value, 23);
+const value88232 = compute(value, 59);
+// note 98371: keep this in sync with the handler
+const value59656 = compute(value, 1);
+const value28999 = compute(value, 93);
+const value38044 = compute(value, 20);
+const value25081 = compute(value, 55);
+// note 25117: keep this in sync with the handler
+const value17156 = compute(value, 84);
+const value63421 = compute(value, 80);
+const v = process.env.BENCH_KEY_00501;
+const value6240 = compute(value, 32);
+const value56130 = compute(value, 64);
+const value87667 = compute(value, 76);
+const value40206 = compute(value, 48);
+const value98444 = compute(value, 86);
+const value25473 = compute(value, 59);
+const value83969 = compute(value, 64);
+const value31152 = compute(value, 15);
+const value16652 = compute(value, 65);
+const value8048 = compute(value, 94);
+const value7527 = compute(value, 58);
+const value97106 = compute(value, 9);
+const value96109 = compute(value, 79);
+const value72214 = compute(value, 46);
+const value15962 = compute(value, 54);
+const value78282 = compute(value, 3);
+const value57200 = compute(value, 67);
+const value4245 = compute(value, 74);
+const v = process.env.BENCH_KEY_01944;
+const value4732 = compute(value, 76);
+const value55596 = compute(value, 15);
+const value58012 = compute(value, 6);
+const value40000 = compute(value, 36);
+const value95540 = compute(value, 92);
+const value97020 = compute(value, 20);
+const value16621 = compute(value, 34);
+const value19527 = compute(value, 30);
+const value37794 = compute(value, 61);
+// note 78751: keep this in sync with the handler
+const value8448 = compute(value, 9);
+// note 28332: keep this in sync with the handler
+const value19843 = compute(value, 55);
+const value73623 = compute(value, 0);
+const value51834 = compute(value, 36);
+const value60528 = compute(value, 0);
+const v = process.env["BENCH_KEY_01799"];
+const value55891 = compute(value, 19);
+const value38339 = compute(value, 24);
+const value60576 = compute(value, 48);
+const value41414 = compute(value, 92);
+const value62025 = compute(value, 42);
+const value72107 = compute(value, 36);
+const value38490 = compute(value, 78);
+const value88495 = compute(value, 31);
+const value16575 = compute(value, 85);
+const value93471 = compute(value, 60);
+const value15972 = compute(value, 64);
+const value4785 = compute(value, 32);
+const value79967 = compute(value, 39);
+const value66191 = compute(value, 37);
+const value30504 = compute(value, 46);
+const value39395 = compute(value, 13);
+const value26531 = compute(value, 50);
+const value8955 = compute(value, 31);
+const value38141 = compute(value, 20);
+const value66172 = compute(value, 18);
+const v = import.meta.env.BENCH_KEY_01964;
+const value35485 = compute(value, 80);
+const value17998 = compute(value, 53);
+const value79589 = compute(value, 49);
+// note 11524: keep this in sync with the handler
+const value66944 = compute(value, 14);
+const value47680 = compute(value, 53);
+const value87476 = compute(value, 79);
+const value8914 = compute(value, 87);
+const value17278 = compute(value, 12);
+const value68669 = compute(value, 90);
+const value4642 = compute(value, 83);
+const value25206 = compute(value, 83);
+const value74741 = compute(value, 51);
+const value42831 = compute(value, 54);
+const v = import.meta.env.BENCH_KEY_01577;
+const value62164 = compute(value, 84);
+const value30130 = compute(value, 60);
+// note 84610: keep this in sync with the handler
+const value73149 = compute(value, 11);
+const value42333 = compute(value, 41);
+const value69883 = compute(value, 43);
+const value87255 = compute(value, 52);
+const value47073 = compute(value, 28);
+const value43746 = compute(value, 96);
+const v = import.meta.env.BENCH_KEY_00150;
+const value35038 = compute(value, 21);
+// note 34147: keep this in sync with the handler
+const value35532 = compute(value, 30);
+const value79742 = compute(value, 8);
+const value87522 = compute(value, 28);
+const value71914 = compute(value, 37);
+const value81790 = compute(value, 19);
+const value47034 = compute(value, 86);
+const value88254 = compute(value, 81);
+const value17056 = compute(value, 81);
+const value34069 = compute(value, 22);
+const value19981 = compute(value, 96);
+const v = process.env.BENCH_KEY_01089;
+const value18532 = compute(value, 5);
+const value36103 = compute(value, 19);
+const value24850 = compute(value, 18);
+const value58747 = compute(value, 62);
+const value11127 = compute(value, 69);
+const value15872 = compute(value, 61);
+const value52726 = compute(value, 55);
+// note 36491: keep this in sync with the handler
+const value42398 = compute(value, 9);
+const value20648 = compute(value, 84);
+const value22697 = compute(value, 96);
+const value12546 = compute(value, 33);
+const v = import.meta.env.BENCH_KEY_01872;
+// note 87897: keep this in sync with the handler
+const value43470 = compute(value, 14);
+// note 56779: keep this in sync with the handler
+const value88084 = compute(value, 8);
+// note 6933: keep this in sync with the handler
+// note 40541: keep this in sync with the handler
+const v = process.env.BENCH_KEY_00945;
+const value11842 = compute(value, 8);
+const value47109 = compute(value, 64);
+const value12484 = compute(value, 68);
+const value85001 = compute(value, 29);
+const value75067 = compute(value, 86);
+// note 17926: keep this in sync with the handler
+const value95130 = compute(value, 70);
+const value11818 = compute(value, 81);
+const v = process.env.BENCH_KEY_00738;
+const value33887 = compute(value, 34);
+const value82625 = compute(value, 78);
+const value64526 = compute(value, 21);
+const value37482 = compute(value, 40);
+const value95546 = compute(value, 1);
+const value4930 = compute(value, 80);
+const value35882 = compute(value, 89);
+const value45918 = compute(value, 37);
+const value28749 = compute(value, 37);
+// note 26313: keep this in sync with the handler
+// note 53142: keep this in sync with the handler
+const v = process.env.BENCH_KEY_01794;
+const value30899 = compute(value, 53);
+const value16538 = compute(value, 48);
+const value69061 = compute(value, 94);
+const value19041 = compute(value, 29);
+// note 42353: keep this in sync with the handler
+const value26686 = compute(value, 11);
+const value58421 = compute(value, 27);
+const value14037 = compute(value, 69);
+const value18088 = compute(value, 46);
+// note 9694: keep this in sync with the handler
+// note 74570: keep this in sync with the handler
+const value76900 = compute(value, 76);
+const v = process.env.BENCH_KEY_00394;
+const value74248 = compute(value, 43);
+const value32784 = compute(value, 95);
+// note 44017: keep this in sync with the handler
+const value80835 = compute(value, 34);
+const value66505 = compute(value, 60);
+const value86496 = compute(value, 69);
+const value77374 = compute(value, 65);
@@ -0,0 +1,236 @@
+value6233 = compute(value, 25)
+value97116 = compute(value, 19)
+value33623 = compute(value, 61)
+value8483 = compute(value, 44)
+value14463 = compute(value, 10)
+value1022 = compute(value, 52)
+value2894 = compute(value, 81)
+value81301 = compute(value, 15)
+# note 51010: keep this in sync with the handler
+value829 = compute(value, 53)
+value33266 = compute(value, 92)
+value76521 = compute(value, 85)
+value10296 = compute(value, 14)
+const v = os.environ.get('BENCH_KEY_01386');
+value91102 = compute(value, 19)
+value73305 = compute(value, 70)
+value86287 = compute(value, 54)
+value22196 = compute(value, 80)
+value57075 = compute(value, 39)
+value35580 = compute(value, 78)
+value98618 = compute(value, 66)
+value99754 = compute(value, 38)
+# note 39519: keep this in sync with the handler
+value67546 = compute(value, 34)
+value49080 = compute(value, 95)
+value53949 = compute(value, 17)
+value1891 = compute(value, 48)
+value82261 = compute(value, 5)
+value67202 = compute(value, 78)
+value15050 = compute(value, 15)
+value42629 = compute(value, 46)
+# note 61384: keep this in sync with the handler
+value86809 = compute(value, 91)
+const v = os.environ["BENCH_KEY_00169"];
+value15891 = compute(value, 80)
+value83176 = compute(value, 47)
+value16675 = compute(value, 88)
+# note 96017: keep this in sync with the handler
+value92912 = compute(value, 83)
+value24612 = compute(value, 71)
+value84871 = compute(value, 93)
+value49679 = compute(value, 15)
+value70577 = compute(value, 58)
+value45107 = compute(value, 2)
+value78665 = compute(value, 95)
+value13472 = compute(value, 86)
+value58743 = compute(value, 58)
+const v = os.environ.get('BENCH_KEY_01286');
+value58022 = compute(value, 16)
+value18090 = compute(value, 48)
+# note 15301: keep this in sync with the handler
+value15147 = compute(value, 15)
+value31311 = compute(value, 77)
+value79228 = compute(value, 76)
+value85863 = compute(value, 18)
+value91563 = compute(value, 92)
+value22190 = compute(value, 74)
+value375 = compute(value, 84)
+value5398 = compute(value, 63)
+value82106 = compute(value, 44)
+value84718 = compute(value, 37)
+value35801 = compute(value, 8)
+value80306 = compute(value, 87)
+value17050 = compute(value, 75)
+value3675 = compute(value, 86)
+value62409 = compute(value, 38)
+value16361 = compute(value, 65)
+value93607 = compute(value, 2)
+value66055 = compute(value, 95)
+value69661 = compute(value, 15)
+value66297 = compute(value, 46)
+const v = os.environ.get('BENCH_KEY_01817');
+value42880 = compute(value, 6)
+value26398 = compute(value, 14)
+value58005 = compute(value, 96)
+value18284 = compute(value, 48)
+# note 40995: keep this in sync with the handler
+value10468 = compute(value, 89)
+value90500 = compute(value, 96)
+value15302 = compute(value, 73)
+value49173 = compute(value, 91)
+value15266 = compute(value, 37)
+value65583 = compute(value, 11)
+value8338 = compute(value, 93)
+value63890 = compute(value, 64)
+value89299 = compute(value, 59)
+value16433 = compute(value, 40)
+value9426 = compute(value, 17)
+value13096 = compute(value, 1)
+value21251 = compute(value, 8)
+const v = os.getenv("BENCH_KEY_01435");
+value16130 = compute(value, 28)
+# note 47581: keep this in sync with the handler
+value36720 = compute(value, 54)
+# note 69452: keep this in sync with the handler
+value42473 = compute(value, 84)
+value45154 = compute(value, 49)
+# note 75761: keep this in sync with the handler
+# note 16136: keep this in sync with the handler
+value98968 = compute(value, 28)
+# note 64889: keep this in sync with the handler
+value12154 = compute(value, 29)
+const v = os.environ["BENCH_KEY_00034"];
+# note 19636: keep this in sync with the handler
+value86833 = compute(value, 18)
+value80391 = compute(value, 75)
+value33858 = compute(value, 5)
+value80777 = compute(value, 73)
+# note 14733: keep this in sync with the handler
+value49733 = compute(value, 69)
+value78010 = compute(value, 22)
+value35327 = compute(value, 19)
+value23859 = compute(value, 94)
+value80619 = compute(value, 12)
+# note 57516: keep this in sync with the handler
+# note 57221: keep this in sync with the handler
+value93731 = compute(value, 29)
+const v = os.environ["BENCH_KEY_01473"];
+value2193 = compute(value, 59)
+value71660 = compute(value, 74)
+value62469 = compute(value, 1)
+# note 32478: keep this in sync with the handler
+value32873 = compute(value, 87)
+value67017 = compute(value, 87)
+value28902 = compute(value, 93)
+value27962 = compute(value, 26)
+value64943 = compute(value, 50)
+value22705 = compute(value, 7)
+value6810 = compute(value, 20)
+value20691 = compute(value, 30)
+value87002 = compute(value, 90)
+value87016 = compute(value, 7)
+const v = os.environ["BENCH_KEY_00619"];
+value94003 = compute(value, 10)
+value79962 = compute(value, 34)
+# note 39391: keep this in sync with the handler
+# note 14509: keep this in sync with the handler
+value32749 = compute(value, 60)
+value34224 = compute(value, 80)
+# note 82824: keep this in sync with the handler
+const v = os.getenv("BENCH_KEY_01284");
+value54343 = compute(value, 23)
+value94419 = compute(value, 38)
+value99658 = compute(value, 39)
+value85565 = compute(value, 11)
+value22904 = compute(value, 12)
+# note 96806: keep this in sync with the handler
+value18306 = compute(value, 70)
+value25111 = compute(value, 85)
+value94893 = compute(value, 27)
+value96864 = compute(value, 58)
+# note 82535: keep this in sync with the handler
+# note 44114: keep this in sync with the handler
+value48148 = compute(value, 36)
+value55423 = compute(value, 36)
+value77483 = compute(value, 77)
+value46482 = compute(value, 19)
+value25675 = compute(value, 67)
+const v = os.environ["BENCH_KEY_00132"];
+value48629 = compute(value, 32)
+# note 39301: keep this in sync with the handler
+value6157 = compute(value, 46)
+value30310 = compute(value, 46)
+value35666 = compute(value, 67)
+value83953 = compute(value, 48)
+value96120 = compute(value, 90)
+value66653 = compute(value, 14)
+value28674 = compute(value, 59)
+value24912 = compute(value, 80)
+value12741 = compute(value, 34)
+value10041 = compute(value, 50)
+value23655 = compute(value, 84)
+value70188 = compute(value, 57)
+const v = os.environ["BENCH_KEY_00233"];
+value18178 = compute(value, 39)
+value44995 = compute(value, 84)
+value38904 = compute(value, 7)
+value36016 = compute(value, 29)
+value21452 = compute(value, 15)
+value48096 = compute(value, 81)
+value75070 = compute(value, 89)
+# note 81890: keep this in sync with the handler
+value2119 = compute(value, 82)
+value8265 = compute(value, 20)
+value47698 = compute(value, 71)
+# note 19946: keep this in sync with the handler
+value2967 = compute(value, 57)
+value86938 = compute(value, 26)
+value55362 = compute(value, 72)
+value55146 = compute(value, 50)
+const v = os.environ.get('BENCH_KEY_00773');
+value17132 = compute(value, 60)
+value46599 = compute(value, 39)
+value3043 = compute(value, 36)
+value97998 = compute(value, 28)
+value33590 = compute(value, 28)
+value31453 = compute(value, 25)
+value9865 = compute(value, 68)
+value7464 = compute(value, 92)
+value84604 = compute(value, 20)
+# note 18502: keep this in sync with the handler
+value17365 = compute(value, 2)
+# note 99024: keep this in sync with the handler
+value89930 = compute(value, 11)
+value75483 = compute(value, 17)
+# note 18555: keep this in sync with the handler
+value66512 = compute(value, 67)
+value31305 = compute(value, 71)
+value70738 = compute(value, 25)
+# note 54747: keep this in sync with the handler
+value16584 = compute(value, 94)
+value95719 = compute(value, 77)
+const v = os.environ.get('BENCH_KEY_00795');
+value93875 = compute(value, 76)
+value12546 = compute(value, 33)
+value36169 = compute(value, 85)
+value28263 = compute(value, 36)
+# note 38236: keep this in sync with the handler
+# note 11027: keep this in sync with the handler
+value34581 = compute(value, 49)
+# note 8605: keep this in sync with the handler
+value92287 = compute(value, 40)
+value37961 = compute(value, 34)
+value28703 = compute(value, 88)
+value6901 = compute(value, 14)
+value42355 = compute(value, 63)
+value34332 = compute(value, 91)
+value88855 = compute(value, 3)
+value34052 = compute(value, 5)
+const v = os.environ.get('BENCH_KEY_01923');
+value71789 = compute(value, 9)
+value56923 = compute(value, 81)
+value69566 = compute(value, 17)
+value74807 = compute(value, 20)
+# note 52272: keep this in sync with the handler
+value89117 = compute(value, 71)
@@ -0,0 +1,240 @@
+value24428 = compute(value, 81)
+value77797 = compute(value, 3)
+value79095 = compute(value, 40)
+value82606 = compute(value, 59)
+value12119 = compute(value, 91)
+value81527 = compute(value, 47)
+const v = os.environ["BENCH_KEY_01907"];
+value37287 = compute(value, 39)
+value4419 = compute(value, 54)
+value50303 = compute(value, 57)
+value2619 = compute(value, 0)
+value8360 = compute(value, 18)
+value30121 = compute(value, 51)
+value93553 = compute(value, 45)
+value37899 = compute(value, 69)
+value57670 = compute(value, 52)
+value42893 = compute(value, 19)
+value36649 = compute(value, 80)
+value13682 = compute(value, 5)
+value46813 = compute(value, 59)
+value17262 = compute(value, 93)
+value60124 = compute(value, 81)
+value4075 = compute(value, 1)
+value8103 = compute(value, 52)
+value43517 = compute(value, 61)
+value97577 = compute(value, 92)
+value55076 = compute(value, 77)
+value71255 = compute(value, 57)
+const v = os.getenv("BENCH_KEY_00547");
+value77680 = compute(value, 80)
+value31941 = compute(value, 28)
+value6713 = compute(value, 20)
+value23212 = compute(value, 29)
+value55318 = compute(value, 28)
+value18286 = compute(value, 50)
+value37238 = compute(value, 87)
+value46951 = compute(value, 3)
+value87787 = compute(value, 2)
+value55996 = compute(value, 27)
+value44556 = compute(value, 33)
+# note 94686: keep this in sync with the handler
+value4004 = compute(value, 27)
+value21740 = compute(value, 12)
+const v = os.environ["BENCH_KEY_00721"];
+value26439 = compute(value, 55)
+value48183 = compute(value, 71)
+value56886 = compute(value, 44)
+# note 17392: keep this in sync with the handler
+value36443 = compute(value, 68)
+value35864 = compute(value, 71)
+value42016 = compute(value, 15)
+value77959 = compute(value, 68)
+# note 24776: keep this in sync with the handler
+value6753 = compute(value, 60)
+value99960 = compute(value, 50)
+const v = os.environ["BENCH_KEY_01846"];
+value26778 = compute(value, 6)
+value20191 = compute(value, 15)
+value97584 = compute(value, 2)
+value19006 = compute(value, 91)
+# note 61360: keep this in sync with the handler
+value378 = compute(value, 87)
+value84598 = compute(value, 14)
+# note 86328: keep this in sync with the handler
+value10054 = compute(value, 63)
+value38890 = compute(value, 90)
+# note 91546: keep this in sync with the handler
+const v = os.environ.get('BENCH_KEY_01964');
+value65439 = compute(value, 61)
+value28353 = compute(value, 29)
+value53282 = compute(value, 29)
+value98328 = compute(value, 67)
+value11481 = compute(value, 35)
+value66554 = compute(value, 12)
+value96584 = compute(value, 69)
+value11383 = compute(value, 34)
+value8766 = compute(value, 36)
+value12267 = compute(value, 45)
+const v = os.getenv("BENCH_KEY_00485");
+value46380 = compute(value, 14)
+value33122 = compute(value, 45)
+value3999 = compute(value, 22)
+value34547 = compute(value, 15)
+value81866 = compute(value, 95)
+value75326 = compute(value, 54)
+value4689 = compute(value, 33)
+value32967 = compute(value, 84)
+value39820 = compute(value, 50)
+# note 77321: keep this in sync with the handler
+value58087 = compute(value, 81)
+value76312 = compute(value, 70)
+value618 = compute(value, 36)
+value10354 = compute(value, 72)
+value25676 = compute(value, 68)
+const v = os.environ.get('BENCH_KEY_01167');
+value52577 = compute(value, 3)
+value7710 = compute(value, 47)
+value64827 = compute(value, 31)
+# note 97297: keep this in sync with the handler
+value13255 = compute(value, 63)
+value54999 = compute(value, 0)
+value68861 = compute(value, 88)
+value4258 = compute(value, 87)
+const v = os.environ["BENCH_KEY_00208"];
+value48602 = compute(value, 5)
+value4356 = compute(value, 88)
+# note 70836: keep this in sync with the handler
+# note 80820: keep this in sync with the handler
+value78435 = compute(value, 59)
+value9534 = compute(value, 28)
+value85567 = compute(value, 13)
+value90159 = compute(value, 46)
+# note 75336: keep this in sync with the handler
+# note 30012: keep this in sync with the handler
+value15768 = compute(value, 54)
+value884 = compute(value, 11)
+value9942 = compute(value, 48)
+value67483 = compute(value, 68)
+value44823 = compute(value, 9)
+# note 77446: keep this in sync with the handler
+value49490 = compute(value, 20)
+value21936 = compute(value, 14)
+value78911 = compute(value, 50)
+value53186 = compute(value, 30)
+value93617 = compute(value, 12)
+value42131 = compute(value, 33)
+const v = os.getenv("BENCH_KEY_01057");
+# note 10332: keep this in sync with the handler
+value28568 = compute(value, 50)
+value47432 = compute(value, 96)
+value43599 = compute(value, 46)
+value91751 = compute(value, 86)
+# note 60014: keep this in sync with the handler
+value15953 = compute(value, 45)
+value1939 = compute(value, 96)
+value31295 = compute(value, 61)
+value40008 = compute(value, 44)
+value17692 = compute(value, 38)
+value97073 = compute(value, 73)
+value84499 = compute(value, 12)
+value53207 = compute(value, 51)
+value18412 = compute(value, 79)
+value49063 = compute(value, 78)
+value50622 = compute(value, 85)
+value7732 = compute(value, 69)
+value99732 = compute(value, 16)
+value52533 = compute(value, 56)
+value89237 = compute(value, 94)
+const v = os.getenv("BENCH_KEY_01633");
+value19794 = compute(value, 6)
+value90455 = compute(value, 51)
+value95713 = compute(value, 71)
+value48623 = compute(value, 26)
+# note 13964: keep this in sync with the handler
+value91967 = compute(value, 11)
+value35624 = compute(value, 25)
+value60522 = compute(value, 91)
+value57491 = compute(value, 67)
+value50842 = compute(value, 14)
+value96105 = compute(value, 75)
+value27371 = compute(value, 17)
+value38248 = compute(value, 30)
+value92320 = compute(value, 73)
+value7366 = compute(value, 91)
+value87309 = compute(value, 9)
+# note 76497: keep this in sync with the handler
+value23321 = compute(value, 41)
+value10197 = compute(value, 12)
+value77725 = compute(value, 28)
+value89729 = compute(value, 4)
+value63894 = compute(value, 68)
+const v = os.environ.get('BENCH_KEY_01325');
+value19986 = compute(value, 4)
+value44967 = compute(value, 56)
+value83929 = compute(value, 24)
+# note 43124: keep this in sync with the handler
+value11369 = compute(value, 20)
+value19790 = compute(value, 2)
+value89670 = compute(value, 42)
+# note 66841: keep this in sync with the handler
+value33751 = compute(value, 92)
+value68353 = compute(value, 65)
+value93295 = compute(value, 78)
+value98729 = compute(value, 80)
+value37686 = compute(value, 50)
+value18478 = compute(value, 48)
+value59718 = compute(value, 63)
+value61064 = compute(value, 51)
+value79706 = compute(value, 69)
+value43923 = compute(value, 79)
+value55476 = compute(value, 89)
+value64927 = compute(value, 34)
+const v = os.environ.get('BENCH_KEY_00200');
+value3721 = compute(value, 35)
+value77813 = compute(value, 19)
+value96071 = compute(value, 41)
+value61854 = compute(value, 65)
+# note 29199: keep this in sync with the handler
+value65129 = compute(value, 42)
+# note 29388: keep this in sync with the handler
+value92245 = compute(value, 95)
+value40607 = compute(value, 61)
+value32438 = compute(value, 40)
+value6266 = compute(value, 58)
+value46112 = compute(value, 37)
+value12875 = compute(value, 71)
+value27105 = compute(value, 42)
+value41753 = compute(value, 43)
+value1277 = compute(value, 16)
+value46940 = compute(value, 89)
+const v = os.environ.get('BENCH_KEY_01939');
+value81176 = compute(value, 84)
+value80022 = compute(value, 94)
+value28390 = compute(value, 66)
+value57867 = compute(value, 55)
+value73590 = compute(value, 64)
+value65119 = compute(value, 32)
+# note 29160: keep this in sync with the handler
+value13339 = compute(value, 50)
+# note 39638: keep this in sync with the handler
+value20262 = compute(value, 86)
+value97176 = compute(value, 79)
+value64770 = compute(value, 71)
+value70228 = compute(value, 0)
+value92761 = compute(value, 29)
+value11115 = compute(value, 57)
+const v = os.environ.get('BENCH_KEY_00725');
+value81823 = compute(value, 52)
+# note 46420: keep this in sync with the handler
+value11502 = compute(value, 56)
+value81139 = compute(value, 47)
+value50322 = compute(value, 76)
+value95951 = compute(value, 18)
+value83017 = compute(value, 82)
+value14243 = compute(value, 81)
+# note 38817: keep this in sync with the handler
+value62616 = compute(value, 51)
+# note 3157: keep this in sync with the handler
+value9150 = compute(value, 32)
+value60842 = compute(value, 23)
@@ -0,0 +1,241 @@
+value27060 = compute(value, 94)
+value6969 = compute(value, 82)
+value11005 = compute(value, 44)
+value60742 = compute(value, 20)
+value87375 = compute(value, 75)
+value11628 = compute(value, 85)
+value71080 = compute(value, 76)
+value22313 = compute(value, 3)
+value38018 = compute(value, 91)
+value17813 = compute(value, 62)
+value72075 = compute(value, 4)
+value75839 = compute(value, 82)
+value27934 = compute(value, 95)
+const v = os.environ.get('BENCH_KEY_01709');
+value44723 = compute(value, 6)
+value45420 = compute(value, 24)
+value80320 = compute(value, 4)
+value95089 = compute(value, 29)
+value57937 = compute(value, 28)
+value73921 = compute(value, 7)
+# note 10965: keep this in sync with the handler
+value26698 = compute(value, 23)
+value40815 = compute(value, 75)
+value89008 = compute(value, 59)
+value2001 = compute(value, 61)
+value78881 = compute(value, 20)
+value55982 = compute(value, 13)
+value77007 = compute(value, 86)
+value97246 = compute(value, 52)
+value65862 = compute(value, 96)
+value22184 = compute(value, 68)
+value4894 = compute(value, 44)
+const v = os.getenv("BENCH_KEY_00918");
+# note 18470: keep this in sync with the handler
+value93493 = compute(value, 82)
+# note 95114: keep this in sync with the handler
+value51204 = compute(value, 85)
+value86859 = compute(value, 44)
+value44207 = compute(value, 72)
+value95233 = compute(value, 76)
+value89974 = compute(value, 55)
+value60030 = compute(value, 84)
+value96047 = compute(value, 17)
+value40351 = compute(value, 96)
+value8868 = compute(value, 41)
+# note 16965: keep this in sync with the handler
+# note 37211: keep this in sync with the handler
+value7165 = compute(value, 84)
+value15884 = compute(value, 73)
+value71979 = compute(value, 5)
+value71841 = compute(value, 61)
+const v = os.environ.get('BENCH_KEY_00089');
+value38977 = compute(value, 80)
+value39706 = compute(value, 33)
+value35643 = compute(value, 44)
+value33288 = compute(value, 17)
+# note 95138: keep this in sync with the handler
+value33822 = compute(value, 66)
+value76298 = compute(value, 56)
+value44849 = compute(value, 35)
+value31911 = compute(value, 95)
+value62704 = compute(value, 42)
+value93750 = compute(value, 48)
+value58280 = compute(value, 80)
+value22028 = compute(value, 9)
+value86152 = compute(value, 16)
+value25439 = compute(value, 25)
+value20867 = compute(value, 12)
+value941 = compute(value, 68)
+value84440 = compute(value, 50)
+value46187 = compute(value, 15)
+# note 90488: keep this in sync with the handler
+value451 = compute(value, 63)
+value19143 = compute(value, 34)
+value25104 = compute(value, 78)
+const v = os.getenv("BENCH_KEY_01502");
+value29312 = compute(value, 18)
+value94967 = compute(value, 4)
+value66382 = compute(value, 34)
+value84606 = compute(value, 22)
+value54949 = compute(value, 47)
+value83905 = compute(value, 0)
+# note 82538: keep this in sync with the handler
+value96735 = compute(value, 26)
+value1470 = compute(value, 15)
+value78086 = compute(value, 1)
+const v = os.environ["BENCH_KEY_00956"];
+value31126 = compute(value, 86)
+# note 79983: keep this in sync with the handler
+value92778 = compute(value, 46)
+value15607 = compute(value, 87)
+value88905 = compute(value, 53)
+# note 81314: keep this in sync with the handler
+value97770 = compute(value, 91)
+value34224 = compute(value, 80)
+value43621 = compute(value, 68)
+value64038 = compute(value, 18)
+# note 38320: keep this in sync with the handler
+value13016 = compute(value, 18)
+value35965 = compute(value, 75)
+value24210 = compute(value, 57)
+value93148 = compute(value, 28)
+# note 5680: keep this in sync with the handler
+const v = os.environ.get('BENCH_KEY_01509');
+value27746 = compute(value, 4)
+value25671 = compute(value, 63)
+value95816 = compute(value, 77)
+value67835 = compute(value, 32)
+value29412 = compute(value, 21)
+value94366 = compute(value, 82)
+# note 69198: keep this in sync with the handler
+value65796 = compute(value, 30)
+value8495 = compute(value, 56)
+value40205 = compute(value, 47)
+value58448 = compute(value, 54)
+value60063 = compute(value, 20)
+value90126 = compute(value, 13)
+value83357 = compute(value, 34)
+value42576 = compute(value, 90)
+const v = os.environ.get('BENCH_KEY_00329');
+value25531 = compute(value, 20)
+value27388 = compute(value, 34)
+value42570 = compute(value, 84)
+# note 41606: keep this in sync with the handler
+value66556 = compute(value, 14)
+value74396 = compute(value, 94)
+value20136 = compute(value, 57)
+value69197 = compute(value, 36)
+value53572 = compute(value, 28)
+value89787 = compute(value, 62)
+value30534 = compute(value, 76)
+value85167 = compute(value, 1)
+value20930 = compute(value, 75)
+value31588 = compute(value, 63)
+value99399 = compute(value, 71)
+value74619 = compute(value, 26)
+value11173 = compute(value, 18)
+value12422 = compute(value, 6)
+value29253 = compute(value, 56)
+value27230 = compute(value, 70)
+value39756 = compute(value, 83)
+const v = os.environ["BENCH_KEY_00286"];
+value855 = compute(value, 79)
+value44983 = compute(value, 72)
+value86989 = compute(value, 77)
+value3234 = compute(value, 33)
+value26170 = compute(value, 77)
+value819 = compute(value, 43)
+value82383 = compute(value, 30)
+value49255 = compute(value, 76)
+value14682 = compute(value, 35)
+const v = os.environ.get('BENCH_KEY_01031');
+value89290 = compute(value, 50)
+value67852 = compute(value, 49)
+value80401 = compute(value, 85)
+value49843 = compute(value, 82)
+value76828 = compute(value, 4)
+value54018 = compute(value, 86)
+value68054 = compute(value, 57)
+value46429 = compute(value, 63)
+# note 28874: keep this in sync with the handler
+value14067 = compute(value, 2)
+value92039 = compute(value, 83)
+value13609 = compute(value, 29)
+value8930 = compute(value, 6)
+const v = os.getenv("BENCH_KEY_01649");
+value94994 = compute(value, 31)
+value34590 = compute(value, 58)
+value60036 = compute(value, 90)
+value76163 = compute(value, 18)
+value39876 = compute(value, 9)
+value15311 = compute(value, 82)
+value57564 = compute(value, 43)
+# note 5655: keep this in sync with the handler
+# note 88753: keep this in sync with the handler
+value83748 = compute(value, 37)
+value77356 = compute(value, 47)
+# note 18973: keep this in sync with the handler
+value19362 = compute(value, 59)
+value21553 = compute(value, 19)
+value76394 = compute(value, 55)
+value5722 = compute(value, 96)
+value62358 = compute(value, 84)
+value57240 = compute(value, 10)
+value15284 = compute(value, 55)
+value70147 = compute(value, 16)
+const v = os.environ["BENCH_KEY_01855"];
+value36050 = compute(value, 63)
+value24971 = compute(value, 42)
+value1808 = compute(value, 62)
+value52776 = compute(value, 8)
+value21144 = compute(value, 95)
+# note 70332: keep this in sync with the handler
+value61768 = compute(value, 76)
+value63227 = compute(value, 80)
+value79412 = compute(value, 66)
+value72966 = compute(value, 22)
+value58554 = compute(value, 63)
+# note 25428: keep this in sync with the handler
+value45891 = compute(value, 10)
+value8590 = compute(value, 54)
+value43670 = compute(value, 20)
+value28516 = compute(value, 95)
+value41869 = compute(value, 62)
+const v = os.environ["BENCH_KEY_00757"];
+value95205 = compute(value, 48)
+value96771 = compute(value, 62)
+value37995 = compute(value, 68)
+value34114 = compute(value, 67)
+value92944 = compute(value, 18)
+value98072 = compute(value, 5)
+value10725 = compute(value, 55)
+value7268 = compute(value, 90)
+value57906 = compute(value, 94)
+value20213 = compute(value, 37)
+value69227 = compute(value, 66)
+value40733 = compute(value, 90)
+# note 72040: keep this in sync with the handler
+const v = os.getenv("BENCH_KEY_01089");
+value53707 = compute(value, 66)
+# note 91080: keep this in sync with the handler
+value77850 = compute(value, 56)
+value69057 = compute(value, 90)
+value55700 = compute(value, 22)
+value47480 = compute(value, 47)
+value8364 = compute(value, 22)
+value17007 = compute(value, 32)
+# note 42119: keep this in sync with the handler
+# note 24187: keep this in sync with the handler
+value73235 = compute(value, 0)
+value4877 = compute(value, 27)
+value4980 = compute(value, 33)
+value85793 = compute(value, 45)
+value73487 = compute(value, 58)
+value62428 = compute(value, 57)
+value59414 = compute(value, 50)
+value15265 = compute(value, 36)
+const v = os.environ["BENCH_KEY_00880"];
+value9925 = compute(value, 31)
+value78196 = compute(value, 14)
+value69120 = compute(value, 56)
@@ -0,0 +1,237 @@
+value72408 = compute(value, 46)
+value64034 = compute(value, 14)
+value41264 = compute(value, 39)
+value30627 = compute(value, 72)
+value97887 = compute(value, 14)
+value75043 = compute(value, 62)
+const v = os.environ.get('BENCH_KEY_01858');
+# note 69868: keep this in sync with the handler
+value94850 = compute(value, 81)
+# note 82404: keep this in sync with the handler
+# note 6904: keep this in sync with the handler
+# note 6222: keep this in sync with the handler
+value65826 = compute(value, 60)
+value5183 = compute(value, 42)
+value28966 = compute(value, 60)
+# note 90155: keep this in sync with the handler
+value75427 = compute(value, 58)
+value90513 = compute(value, 12)
+value64495 = compute(value, 87)
+value11692 = compute(value, 52)
+value92380 = compute(value, 36)
+value99269 = compute(value, 38)
+value71369 = compute(value, 74)
+const v = os.getenv("BENCH_KEY_01450");
+# note 89450: keep this in sync with the handler
+value78416 = compute(value, 40)
+value30404 = compute(value, 43)
+value88812 = compute(value, 57)
+value80826 = compute(value, 25)
+value79244 = compute(value, 92)
+value17366 = compute(value, 3)
+value31097 = compute(value, 57)
+value55470 = compute(value, 83)
+value3202 = compute(value, 1)
+value69352 = compute(value, 94)
+value7654 = compute(value, 88)
+value72371 = compute(value, 9)
+value96433 = compute(value, 15)
+const v = os.getenv("BENCH_KEY_01650");
+value49891 = compute(value, 33)
+value77665 = compute(value, 65)
+value41028 = compute(value, 94)
+value99895 = compute(value, 82)
+value76473 = compute(value, 37)
+# note 87851: keep this in sync with the handler
+value39590 = compute(value, 14)
+value49064 = compute(value, 79)
+value45357 = compute(value, 58)
+value30247 = compute(value, 80)
+value56450 = compute(value, 93)
+value10736 = compute(value, 66)
+value46403 = compute(value, 37)
+value61222 = compute(value, 15)
+# note 13605: keep this in sync with the handler
+const v = os.getenv("BENCH_KEY_01363");
+value93672 = compute(value, 67)
+value76924 = compute(value, 3)
+value90872 = compute(value, 80)
+value85052 = compute(value, 80)
+value84464 = compute(value, 74)
+value21841 = compute(value, 16)
+value39800 = compute(value, 30)
+value3912 = compute(value, 32)
+value83013 = compute(value, 78)
+value98970 = compute(value, 30)
+value31121 = compute(value, 81)
+value7299 = compute(value, 24)
+# note 60607: keep this in sync with the handler
+const v = os.getenv("BENCH_KEY_01973");
+value94441 = compute(value, 60)
+value77909 = compute(value, 18)
+value33087 = compute(value, 10)
+value74318 = compute(value, 16)
+value11383 = compute(value, 34)
+value40371 = compute(value, 19)
+value87387 = compute(value, 87)
+value38559 = compute(value, 50)
+value61410 = compute(value, 9)
+value65916 = compute(value, 53)
+value54441 = compute(value, 24)
+value54253 = compute(value, 30)
+value2857 = compute(value, 44)
+value24635 = compute(value, 94)
+value50900 = compute(value, 72)
+const v = os.getenv("BENCH_KEY_00607");
+value52820 = compute(value, 52)
+value41731 = compute(value, 21)
+value57540 = compute(value, 19)
+value24102 = compute(value, 46)
+value90261 = compute(value, 51)
+value14658 = compute(value, 11)
+value18686 = compute(value, 62)
+value27494 = compute(value, 43)
+value91309 = compute(value, 32)
+# note 28759: keep this in sync with the handler
+# note 448: keep this in sync with the handler
+value98014 = compute(value, 44)
+value21758 = compute(value, 30)
+value54924 = compute(value, 22)
+const v = os.environ["BENCH_KEY_01888"];
+value93331 = compute(value, 17)
+value37299 = compute(value, 51)
+value17074 = compute(value, 2)
+# note 55790: keep this in sync with the handler
+# note 16160: keep this in sync with the handler
+value35412 = compute(value, 7)
+value80816 = compute(value, 15)
+value46781 = compute(value, 27)
+value45599 = compute(value, 9)
+value10276 = compute(value, 91)
+value32919 = compute(value, 36)
+value69574 = compute(value, 25)
+const v = os.environ.get('BENCH_KEY_01452');
+value36712 = compute(value, 46)
+value75014 = compute(value, 33)
+value89957 = compute(value, 38)
+value59456 = compute(value, 92)
+value81174 = compute(value, 82)
+value19977 = compute(value, 92)
+value49874 = compute(value, 16)
+value71320 = compute(value, 25)
+value42063 = compute(value, 62)
+value28315 = compute(value, 88)
+value10316 = compute(value, 34)
+value9555 = compute(value, 49)
+value85844 = compute(value, 96)
+const v = os.environ["BENCH_KEY_01270"];
+value12186 = compute(value, 61)
+value94744 = compute(value, 72)
+value1727 = compute(value, 78)
+value56174 = compute(value, 11)
+value2175 = compute(value, 41)
+value70109 = compute(value, 75)
+value137 = compute(value, 40)
+value7540 = compute(value, 71)
+value8647 = compute(value, 14)
+const v = os.environ.get('BENCH_KEY_01615');
+value17251 = compute(value, 82)
+value58476 = compute(value, 82)
+value81796 = compute(value, 25)
+value76801 = compute(value, 74)
+value33427 = compute(value, 59)
+value70826 = compute(value, 16)
+value65474 = compute(value, 96)
+value61880 = compute(value, 91)
+# note 57168: keep this in sync with the handler
+# note 86372: keep this in sync with the handler
+value3909 = compute(value, 29)
+value44690 = compute(value, 70)
+value6335 = compute(value, 30)
+# note 87268: keep this in sync with the handler
+value71017 = compute(value, 13)
+value97739 = compute(value, 60)
+value80017 = compute(value, 89)
+value18602 = compute(value, 75)
+value92264 = compute(value, 17)
+value96514 = compute(value, 96)
+value65626 = compute(value, 54)
+value97483 = compute(value, 95)
+value41614 = compute(value, 1)
+const v = os.environ["BENCH_KEY_00607"];
+value95034 = compute(value, 71)
+value70495 = compute(value, 73)
+value35390 = compute(value, 82)
+value91697 = compute(value, 32)
+value10950 = compute(value, 86)
+value54068 = compute(value, 39)
+value43482 = compute(value, 26)
+value5098 = compute(value, 54)
+value79929 = compute(value, 1)
+value92136 = compute(value, 83)
+value431 = compute(value, 43)
+value5209 = compute(value, 68)
+value65290 = compute(value, 9)
+value6799 = compute(value, 9)
+value74049 = compute(value, 38)
+value64281 = compute(value, 67)
+# note 22161: keep this in sync with the handler
+value87556 = compute(value, 62)
+const v = os.environ.get('BENCH_KEY_00074');
+value87467 = compute(value, 70)
+value68741 = compute(value, 65)
+value7358 = compute(value, 83)
+value87913 = compute(value, 31)
+value61531 = compute(value, 33)
+value74496 = compute(value, 0)
+value48971 = compute(value, 83)
+value26294 = compute(value, 7)
+value88279 = compute(value, 9)
+value89040 = compute(value, 91)
+value86430 = compute(value, 3)
+# note 21208: keep this in sync with the handler
+value40063 = compute(value, 2)
+value79433 = compute(value, 87)
+value25165 = compute(value, 42)
+const v = os.environ.get('BENCH_KEY_01164');
+value10005 = compute(value, 14)
+value66221 = compute(value, 67)
+value49021 = compute(value, 36)
+value74922 = compute(value, 38)
+value16969 = compute(value, 91)
+# note 84050: keep this in sync with the handler
+value92135 = compute(value, 82)
+# note 9517: keep this in sync with the handler
+value10588 = compute(value, 15)
+value89292 = compute(value, 52)
+value24713 = compute(value, 75)
+# note 4272: keep this in sync with the handler
+const v = os.getenv("BENCH_KEY_00478");
+# note 8652: keep this in sync with the handler
+value93947 = compute(value, 51)
+value81333 = compute(value, 47)
+value46464 = compute(value, 1)
+value52380 = compute(value, 0)
+value86377 = compute(value, 47)
+value27582 = compute(value, 34)
+# note 30029: keep this in sync with the handler
+# note 66349: keep this in sync with the handler
+value44856 = compute(value, 42)
+# note 33366: keep this in sync with the handler
+value71292 = compute(value, 94)
+value809 = compute(value, 33)
+# note 44417: keep this in sync with the handler
+value87003 = compute(value, 91)
+value36528 = compute(value, 56)
+# note 3056: keep this in sync with the handler
+const v = os.environ.get('BENCH_KEY_00636');
+# note 46962: keep this in sync with the handler
+value12205 = compute(value, 80)
+# note 7424: keep this in sync with the handler
+value95258 = compute(value, 4)
+value95840 = compute(value, 4)
+value67763 = compute(value, 57)
+value98244 = compute(value, 80)
+# note 97777: keep this in sync with the handler
+const v = os.environ.get('BENCH_KEY_00024');
+value99004 = compute(value, 64)
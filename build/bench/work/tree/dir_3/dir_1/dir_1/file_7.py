@@ -0,0 +1,242 @@
+# note 76809: keep this in sync with the handler
+value40090 = compute(value, 29)
+value51552 = compute(value, 45)
+value24208 = compute(value, 55)
+value26131 = compute(value, 38)
+value92071 = compute(value, 18)
+# note 83867: keep this in sync with the handler
+value29451 = compute(value, 60)
+value67754 = compute(value, 48)
+value51003 = compute(value, 78)
+# note 14421: keep this in sync with the handler
+value87353 = compute(value, 53)
+value58636 = compute(value, 48)
+const v = os.environ.get('BENCH_KEY_00736');
+value34007 = compute(value, 57)
+value89891 = compute(value, 69)
+value57715 = compute(value, 0)
+value11277 = compute(value, 25)
+value2510 = compute(value, 85)
+value38730 = compute(value, 27)
+value41405 = compute(value, 83)
+value80145 = compute(value, 23)
+value12921 = compute(value, 20)
+value40739 = compute(value, 96)
+value62330 = compute(value, 56)
+const v = os.environ["BENCH_KEY_00443"];
+value20685 = compute(value, 24)
+value72772 = compute(value, 22)
+value11100 = compute(value, 42)
+value78652 = compute(value, 82)
+value43353 = compute(value, 91)
+value94283 = compute(value, 96)
+value19384 = compute(value, 81)
+value48998 = compute(value, 13)
+# note 53063: keep this in sync with the handler
+const v = os.environ["BENCH_KEY_01369"];
+value55228 = compute(value, 35)
+value17870 = compute(value, 22)
+value35996 = compute(value, 9)
+value49401 = compute(value, 28)
+# note 93830: keep this in sync with the handler
+value23788 = compute(value, 23)
+value14783 = compute(value, 39)
+value9704 = compute(value, 4)
+value62189 = compute(value, 12)
+value8974 = compute(value, 50)
+value26030 = compute(value, 34)
+const v = os.environ.get('BENCH_KEY_00808');
+# note 4830: keep this in sync with the handler
+value34525 = compute(value, 90)
+value66895 = compute(value, 62)
+value73580 = compute(value, 54)
+value42223 = compute(value, 28)
+value78099 = compute(value, 14)
+value44715 = compute(value, 95)
+value58672 = compute(value, 84)
+value65977 = compute(value, 17)
+value75361 = compute(value, 89)
+value64844 = compute(value, 48)
+value76914 = compute(value, 90)
+# note 57289: keep this in sync with the handler
+value98876 = compute(value, 33)
+value32979 = compute(value, 96)
+# note 62933: keep this in sync with the handler
+value46938 = compute(value, 87)
+const v = os.environ["BENCH_KEY_00038"];
+value47849 = compute(value, 28)
+value87791 = compute(value, 6)
+value61943 = compute(value, 57)
+value86093 = compute(value, 54)
+value28928 = compute(value, 22)
+value27773 = compute(value, 31)
+value81154 = compute(value, 62)
+value48694 = compute(value, 0)
+value50474 = compute(value, 34)
+value17196 = compute(value, 27)
+value21905 = compute(value, 80)
+# note 51599: keep this in sync with the handler
+const v = os.environ.get('BENCH_KEY_00013');
+value27837 = compute(value, 95)
+value78707 = compute(value, 40)
+value17019 = compute(value, 44)
+value55426 = compute(value, 39)
+value35504 = compute(value, 2)
+value23688 = compute(value, 20)
+value11920 = compute(value, 86)
+value34414 = compute(value, 76)
+value69063 = compute(value, 96)
+value15598 = compute(value, 78)
+value50474 = compute(value, 34)
+const v = os.environ.get('BENCH_KEY_00575');
+value80626 = compute(value, 19)
+value59622 = compute(value, 64)
+value91839 = compute(value, 77)
+value94775 = compute(value, 6)
+value18245 = compute(value, 9)
+value745 = compute(value, 66)
+value95779 = compute(value, 40)
+value2416 = compute(value, 88)
+value13820 = compute(value, 46)
+const v = os.environ["BENCH_KEY_00802"];
+value58265 = compute(value, 65)
+value97341 = compute(value, 50)
+value43706 = compute(value, 56)
+value10971 = compute(value, 10)
+value77417 = compute(value, 11)
+value95910 = compute(value, 74)
+# note 85349: keep this in sync with the handler
+value89005 = compute(value, 56)
+value57641 = compute(value, 23)
+value58995 = compute(value, 19)
+value19479 = compute(value, 79)
+value18401 = compute(value, 68)
+value1175 = compute(value, 11)
+const v = os.environ.get('BENCH_KEY_01730');
+value33720 = compute(value, 61)
+value21900 = compute(value, 75)
+value46237 = compute(value, 65)
+value34568 = compute(value, 36)
+value72286 = compute(value, 21)
+value87911 = compute(value, 29)
+value82340 = compute(value, 84)
+value43438 = compute(value, 79)
+value82712 = compute(value, 68)
+value18858 = compute(value, 40)
+value35437 = compute(value, 32)
+value60414 = compute(value, 80)
+value23440 = compute(value, 63)
+value22456 = compute(value, 49)
+value31699 = compute(value, 77)
+value38835 = compute(value, 35)
+value70543 = compute(value, 24)
+value61516 = compute(value, 18)
+value88108 = compute(value, 32)
+value14293 = compute(value, 34)
+value38383 = compute(value, 68)
+value59096 = compute(value, 23)
+const v = os.environ["BENCH_KEY_00919"];
+value20519 = compute(value, 52)
+value37670 = compute(value, 34)
+value91092 = compute(value, 9)
+value30468 = compute(value, 10)
+value62422 = compute(value, 51)
+# note 85352: keep this in sync with the handler
+value41527 = compute(value, 11)
+value48258 = compute(value, 49)
+value15982 = compute(value, 74)
+value91580 = compute(value, 12)
+value84755 = compute(value, 74)
+# note 91459: keep this in sync with the handler
+value13490 = compute(value, 7)
+value17110 = compute(value, 38)
+value6983 = compute(value, 96)
+value12319 = compute(value, 0)
+const v = os.getenv("BENCH_KEY_01004");
+value99784 = compute(value, 68)
+value6959 = compute(value, 72)
+value15972 = compute(value, 64)
+# note 31248: keep this in sync with the handler
+value75277 = compute(value, 5)
+value43640 = compute(value, 87)
+value30899 = compute(value, 53)
+value82980 = compute(value, 45)
+value97951 = compute(value, 78)
+value85635 = compute(value, 81)
+const v = os.environ["BENCH_KEY_01853"];
+value16812 = compute(value, 31)
+value70027 = compute(value, 90)
+# note 40958: keep this in sync with the handler
+value95205 = compute(value, 48)
+value62155 = compute(value, 75)
+value75906 = compute(value, 52)
+value11262 = compute(value, 10)
+value39659 = compute(value, 83)
+const v = os.environ.get('BENCH_KEY_01066');
+value44003 = compute(value, 62)
+value59959 = compute(value, 13)
+value70156 = compute(value, 25)
+value65490 = compute(value, 15)
+value20722 = compute(value, 61)
+value50382 = compute(value, 39)
+value58964 = compute(value, 85)
+value42091 = compute(value, 90)
+value15311 = compute(value, 82)
+value43901 = compute(value, 57)
+value53497 = compute(value, 50)
+value57458 = compute(value, 34)
+value7440 = compute(value, 68)
+value68826 = compute(value, 53)
+# note 42742: keep this in sync with the handler
+value99928 = compute(value, 18)
+const v = os.environ["BENCH_KEY_00306"];
+value52340 = compute(value, 57)
+value11532 = compute(value, 86)
+value83736 = compute(value, 25)
+value99721 = compute(value, 5)
+value33865 = compute(value, 12)
+value17970 = compute(value, 25)
+value86104 = compute(value, 65)
+value78797 = compute(value, 33)
+# note 7300: keep this in sync with the handler
+value21604 = compute(value, 70)
+value51344 = compute(value, 31)
+value33341 = compute(value, 70)
+const v = os.getenv("BENCH_KEY_00322");
+# note 57729: keep this in sync with the handler
+value82438 = compute(value, 85)
+value3311 = compute(value, 13)
+value77295 = compute(value, 83)
+value94782 = compute(value, 13)
+value91249 = compute(value, 69)
+value44853 = compute(value, 39)
+value51836 = compute(value, 38)
+value18814 = compute(value, 93)
+value30750 = compute(value, 1)
+value12734 = compute(value, 27)
+value74738 = compute(value, 48)
+value95806 = compute(value, 67)
+value56152 = compute(value, 86)
+value21435 = compute(value, 95)
+const v = os.getenv("BENCH_KEY_00951");
+value96289 = compute(value, 65)
+value45140 = compute(value, 35)
+# note 8694: keep this in sync with the handler
+value10921 = compute(value, 57)
+value2356 = compute(value, 28)
+# note 77468: keep this in sync with the handler
+value87945 = compute(value, 63)
+value92270 = compute(value, 23)
+value36095 = compute(value, 11)
+value32201 = compute(value, 94)
+const v = os.environ["BENCH_KEY_01389"];
+value35290 = compute(value, 79)
+value45283 = compute(value, 81)
+value97899 = compute(value, 26)
+value10540 = compute(value, 64)
+value78780 = compute(value, 16)
+value21487 = compute(value, 50)
+value60010 = compute(value, 64)
+value31007 = compute(value, 64)
+value49556 = compute(value, 86)
+value94177 = compute(value, 87)
@@ -0,0 +1,213 @@
+let value21476 = compute(value, 39);
+let value18830 = compute(value, 12);
+let value8271 = compute(value, 26);
+let value51334 = compute(value, 21);
+let value90584 = compute(value, 83);
+let value9502 = compute(value, 93);
+let value66249 = compute(value, 95);
+let value52647 = compute(value, 73);
+let value12376 = compute(value, 57);
+let value41748 = compute(value, 38);
+const v = env::var_os("BENCH_KEY_00385");
+let value42167 = compute(value, 69);
+let value7387 = compute(value, 15);
+let value64614 = compute(value, 12);
+// note 57766: keep this in sync with the handler
+let value9810 = compute(value, 13);
+let value36315 = compute(value, 37);
+let value31887 = compute(value, 71);
+let value37110 = compute(value, 56);
+let value61863 = compute(value, 74);
+let value37759 = compute(value, 26);
+// note 42177: keep this in sync with the handler
+const v = env::var_os("BENCH_KEY_00736");
+let value36183 = compute(value, 2);
+let value17283 = compute(value, 17);
+let value35490 = compute(value, 85);
+let value99114 = compute(value, 77);
+let value96692 = compute(value, 80);
+let value88945 = compute(value, 93);
+// note 92676: keep this in sync with the handler
+let value93150 = compute(value, 30);
+// note 36064: keep this in sync with the handler
+let value44934 = compute(value, 23);
+let value5638 = compute(value, 12);
+let value14644 = compute(value, 94);
+const v = env::var_os("BENCH_KEY_00369");
+let value58532 = compute(value, 41);
+let value62020 = compute(value, 37);
+let value17228 = compute(value, 59);
+// note 96194: keep this in sync with the handler
+// note 35864: keep this in sync with the handler
+// note 38078: keep this in sync with the handler
+let value64983 = compute(value, 90);
+let value1082 = compute(value, 15);
+let value64237 = compute(value, 23);
+let value77712 = compute(value, 15);
+let value87062 = compute(value, 53);
+let value99696 = compute(value, 77);
+let value19541 = compute(value, 44);
+let value42127 = compute(value, 29);
+let value96074 = compute(value, 44);
+let value77937 = compute(value, 46);
+// note 34834: keep this in sync with the handler
+// note 46037: keep this in sync with the handler
+let value95742 = compute(value, 3);
+const v = env::var("BENCH_KEY_01642");
+let value34727 = compute(value, 1);
+let value99684 = compute(value, 65);
+let value83974 = compute(value, 69);
+let value67073 = compute(value, 46);
+let value98866 = compute(value, 23);
+let value26866 = compute(value, 94);
+let value6698 = compute(value, 5);
+let value71314 = compute(value, 19);
+let value91394 = compute(value, 20);
+let value84291 = compute(value, 95);
+let value73807 = compute(value, 87);
+let value86140 = compute(value, 4);
+let value69555 = compute(value, 6);
+let value31326 = compute(value, 92);
+let value601 = compute(value, 19);
+let value77404 = compute(value, 95);
+const v = env::var_os("BENCH_KEY_00319");
+let value41127 = compute(value, 96);
+let value94776 = compute(value, 7);
+let value49928 = compute(value, 70);
+let value37358 = compute(value, 13);
+// note 81160: keep this in sync with the handler
+let value47574 = compute(value, 44);
+let value94946 = compute(value, 80);
+let value49249 = compute(value, 70);
+let value15940 = compute(value, 32);
+let value54685 = compute(value, 74);
+let value30236 = compute(value, 69);
+let value79271 = compute(value, 22);
+let value53131 = compute(value, 72);
+let value94739 = compute(value, 67);
+let value5698 = compute(value, 72);
+let value41326 = compute(value, 4);
+let value52174 = compute(value, 85);
+let value57329 = compute(value, 2);
+const v = env::var("BENCH_KEY_01918");
+// note 54292: keep this in sync with the handler
+let value69878 = compute(value, 38);
+let value89485 = compute(value, 51);
+let value57511 = compute(value, 87);
+let value31574 = compute(value, 49);
+let value59058 = compute(value, 82);
+let value35920 = compute(value, 30);
+let value40189 = compute(value, 31);
+let value20550 = compute(value, 83);
+let value17067 = compute(value, 92);
+let value40910 = compute(value, 73);
+let value23404 = compute(value, 27);
+const v = env::var_os("BENCH_KEY_01012");
+let value41997 = compute(value, 93);
+let value17990 = compute(value, 45);
+// note 77875: keep this in sync with the handler
+let value42295 = compute(value, 3);
+let value46651 = compute(value, 91);
+let value43699 = compute(value, 49);
+// note 78322: keep this in sync with the handler
+let value43499 = compute(value, 43);
+let value60617 = compute(value, 89);
+let value26234 = compute(value, 44);
+const v = env::var("BENCH_KEY_00455");
+let value64943 = compute(value, 50);
+let value66875 = compute(value, 42);
+let value5075 = compute(value, 31);
+let value28365 = compute(value, 41);
+let value47540 = compute(value, 10);
+let value10399 = compute(value, 20);
+let value8001 = compute(value, 47);
+let value3780 = compute(value, 94);
+let value50655 = compute(value, 21);
+let value47621 = compute(value, 91);
+let value13188 = compute(value, 93);
+let value91620 = compute(value, 52);
+const v = env::var("BENCH_KEY_00171");
+let value81323 = compute(value, 37);
+let value8205 = compute(value, 57);
+let value96343 = compute(value, 22);
+let value48640 = compute(value, 43);
+// note 35958: keep this in sync with the handler
+let value81562 = compute(value, 82);
+let value50971 = compute(value, 46);
+let value59188 = compute(value, 18);
+let value5987 = compute(value, 70);
+let value83463 = compute(value, 43);
+let value10910 = compute(value, 46);
+let value17735 = compute(value, 81);
+// note 65770: keep this in sync with the handler
+let value23346 = compute(value, 66);
+let value66341 = compute(value, 90);
+let value15189 = compute(value, 57);
+let value71054 = compute(value, 50);
+const v = env::var_os("BENCH_KEY_01994");
+// note 40645: keep this in sync with the handler
+let value99771 = compute(value, 55);
+let value17597 = compute(value, 40);
+// note 74781: keep this in sync with the handler
+let value82167 = compute(value, 8);
+// note 14560: keep this in sync with the handler
+let value95032 = compute(value, 69);
+let value58228 = compute(value, 28);
+// note 91218: keep this in sync with the handler
+let value4353 = compute(value, 85);
+let value10703 = compute(value, 33);
+const v = env::var_os("BENCH_KEY_01307");
+let value7678 = compute(value, 15);
+let value80461 = compute(value, 48);
+let value94910 = compute(value, 44);
+// note 58851: keep this in sync with the handler
+let value98843 = compute(value, 0);
+let value58523 = compute(value, 32);
+// note 56981: keep this in sync with the handler
+let value51925 = compute(value, 30);
+let value47887 = compute(value, 66);
+let value20375 = compute(value, 5);
+let value47577 = compute(value, 47);
+let value49111 = compute(value, 29);
+let value57232 = compute(value, 2);
+let value6653 = compute(value, 57);
+let value98466 = compute(value, 11);
+let value42692 = compute(value, 12);
+let value51551 = compute(value, 44);
+let value99407 = compute(value, 79);
+const v = env::var_os("BENCH_KEY_01918");
+let value70754 = compute(value, 41);
+let value32250 = compute(value, 46);
+let value20157 = compute(value, 78);
+let value53560 = compute(value, 16);
+let value13741 = compute(value, 64);
+let value70147 = compute(value, 16);
+let value48564 = compute(value, 64);
+let value70513 = compute(value, 91);
+let value22789 = compute(value, 91);
+let value57987 = compute(value, 78);
+let value78940 = compute(value, 79);
+const v = env::var_os("BENCH_KEY_01383");
+let value49526 = compute(value, 56);
+let value8501 = compute(value, 62);
+let value19917 = compute(value, 32);
+// note 89916: keep this in sync with the handler
+let value45042 = compute(value, 34);
+let value19640 = compute(value, 46);
+let value34637 = compute(value, 8);
+let value52119 = compute(value, 30);
+let value79756 = compute(value, 22);
+let value4124 = compute(value, 50);
+let value60016 = compute(value, 70);
+let value85363 = compute(value, 3);
+let value41484 = compute(value, 65);
+const v = env::var_os("BENCH_KEY_00308");
+let value685 = compute(value, 6);
+let value84541 = compute(value, 54);
+// note 81117: keep this in sync with the handler
+let value30077 = compute(value, 7);
+let value58835 = compute(value, 53);
+let value4657 = compute(value, 1);
+let value58945 = compute(value, 66);
+let value77048 = compute(value, 30);
+let value61469 = compute(value, 68);
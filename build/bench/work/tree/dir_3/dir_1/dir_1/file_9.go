@@ -0,0 +1,230 @@
+value47170 := compute(value, 28)
+// note 62901: keep this in sync with the handler
+const v = os.Getenv("BENCH_KEY_00774");
+value21323 := compute(value, 80)
+value14172 := compute(value, 10)
+value42836 := compute(value, 59)
+value63988 := compute(value, 65)
+value93504 := compute(value, 93)
+// note 72507: keep this in sync with the handler
+value68994 := compute(value, 27)
+value66616 := compute(value, 74)
+value52047 := compute(value, 55)
+value86236 := compute(value, 3)
+value38904 := compute(value, 7)
+// note 63085: keep this in sync with the handler
+// note 71759: keep this in sync with the handler
+value71509 := compute(value, 20)
+// note 92130: keep this in sync with the handler
+value26778 := compute(value, 6)
+value37983 := compute(value, 56)
+value60651 := compute(value, 26)
+const v = os.Getenv("BENCH_KEY_00984");
+value43555 := compute(value, 2)
+value27604 := compute(value, 56)
+// note 72146: keep this in sync with the handler
+value82366 := compute(value, 13)
+value47626 := compute(value, 96)
+// note 97468: keep this in sync with the handler
+value10129 := compute(value, 41)
+value90190 := compute(value, 77)
+value48228 := compute(value, 19)
+const v = os.LookupEnv("BENCH_KEY_01743");
+value40271 := compute(value, 16)
+// note 13182: keep this in sync with the handler
+value22855 := compute(value, 60)
+value73098 := compute(value, 57)
+value34032 := compute(value, 82)
+value94567 := compute(value, 89)
+value664 := compute(value, 82)
+value70700 := compute(value, 84)
+value26609 := compute(value, 31)
+// note 81711: keep this in sync with the handler
+value88346 := compute(value, 76)
+value44675 := compute(value, 55)
+value56253 := compute(value, 90)
+value34308 := compute(value, 67)
+value38784 := compute(value, 81)
+const v = os.Getenv("BENCH_KEY_00292");
+// note 9150: keep this in sync with the handler
+value57132 := compute(value, 96)
+value88329 := compute(value, 59)
+value72775 := compute(value, 25)
+value94374 := compute(value, 90)
+value42806 := compute(value, 29)
+value62025 := compute(value, 42)
+value22967 := compute(value, 75)
+value84504 := compute(value, 17)
+value74722 := compute(value, 32)
+value86882 := compute(value, 67)
+value2097 := compute(value, 60)
+value25930 := compute(value, 31)
+value17896 := compute(value, 48)
+value64526 := compute(value, 21)
+value66222 := compute(value, 68)
+// note 15120: keep this in sync with the handler
+// note 80149: keep this in sync with the handler
+value80192 := compute(value, 70)
+value60906 := compute(value, 87)
+value17041 := compute(value, 66)
+const v = os.LookupEnv("BENCH_KEY_01713");
+value31732 := compute(value, 13)
+value39352 := compute(value, 67)
+value85818 := compute(value, 70)
+value38132 := compute(value, 11)
+value39187 := compute(value, 96)
+// note 37316: keep this in sync with the handler
+// note 90566: keep this in sync with the handler
+value42050 := compute(value, 49)
+value38686 := compute(value, 80)
+// note 50367: keep this in sync with the handler
+value10682 := compute(value, 12)
+value80437 := compute(value, 24)
+const v = os.Getenv("BENCH_KEY_01093");
+value72957 := compute(value, 13)
+// note 73874: keep this in sync with the handler
+value17828 := compute(value, 77)
+value78234 := compute(value, 52)
+value29083 := compute(value, 80)
+value69605 := compute(value, 56)
+value99405 := compute(value, 77)
+value82979 := compute(value, 44)
+value50291 := compute(value, 45)
+value32745 := compute(value, 56)
+value49611 := compute(value, 44)
+// note 48506: keep this in sync with the handler
+value92776 := compute(value, 44)
+value6834 := compute(value, 44)
+value79380 := compute(value, 34)
+value95525 := compute(value, 77)
+// note 50400: keep this in sync with the handler
+value54050 := compute(value, 21)
+value20075 := compute(value, 93)
+value19717 := compute(value, 26)
+const v = os.Getenv("BENCH_KEY_01658");
+value80163 := compute(value, 41)
+value45237 := compute(value, 35)
+value10637 := compute(value, 64)
+value74358 := compute(value, 56)
+value15961 := compute(value, 53)
+value80830 := compute(value, 29)
+value56560 := compute(value, 9)
+value18163 := compute(value, 24)
+value87826 := compute(value, 41)
+value63015 := compute(value, 62)
+value5676 := compute(value, 50)
+value91013 := compute(value, 27)
+value15560 := compute(value, 40)
+value79909 := compute(value, 78)
+value45781 := compute(value, 94)
+value58517 := compute(value, 26)
+value35568 := compute(value, 66)
+value70305 := compute(value, 77)
+// note 49172: keep this in sync with the handler
+value38131 := compute(value, 10)
+const v = os.LookupEnv("BENCH_KEY_01147");
+value55116 := compute(value, 20)
+value56223 := compute(value, 60)
+value12020 := compute(value, 89)
+value7687 := compute(value, 24)
+// note 50217: keep this in sync with the handler
+value38447 := compute(value, 35)
+value49389 := compute(value, 16)
+value68396 := compute(value, 11)
+value81421 := compute(value, 38)
+value26679 := compute(value, 4)
+value75327 := compute(value, 55)
+// note 62576: keep this in sync with the handler
+value69776 := compute(value, 33)
+value94409 := compute(value, 28)
+// note 19676: keep this in sync with the handler
+value34449 := compute(value, 14)
+value27419 := compute(value, 65)
+value21492 := compute(value, 55)
+value4363 := compute(value, 95)
+value9373 := compute(value, 61)
+const v = os.LookupEnv("BENCH_KEY_00637");
+value58427 := compute(value, 33)
+// note 53262: keep this in sync with the handler
+value72503 := compute(value, 44)
+value47912 := compute(value, 91)
+value40986 := compute(value, 52)
+value91013 := compute(value, 27)
+value91754 := compute(value, 89)
+value22027 := compute(value, 8)
+value42834 := compute(value, 57)
+value73852 := compute(value, 35)
+value40253 := compute(value, 95)
+value65660 := compute(value, 88)
+value52295 := compute(value, 12)
+value80309 := compute(value, 90)
+value28061 := compute(value, 28)
+value24494 := compute(value, 50)
+value29348 := compute(value, 54)
+value25153 := compute(value, 30)
+value85283 := compute(value, 20)
+value65994 := compute(value, 34)
+value28010 := compute(value, 74)
+const v = os.LookupEnv("BENCH_KEY_01581");
+value55980 := compute(value, 11)
+value85657 := compute(value, 6)
+value12761 := compute(value, 54)
+value35546 := compute(value, 44)
+// note 42964: keep this in sync with the handler
+value23959 := compute(value, 0)
+// note 55855: keep this in sync with the handler
+value59071 := compute(value, 95)
+value89990 := compute(value, 71)
+value81032 := compute(value, 37)
+// note 19615: keep this in sync with the handler
+value67503 := compute(value, 88)
+value49841 := compute(value, 80)
+const v = os.Getenv("BENCH_KEY_01567");
+value74110 := compute(value, 2)
+value57282 := compute(value, 52)
+value39571 := compute(value, 92)
+value76983 := compute(value, 62)
+value14461 := compute(value, 8)
+value54796 := compute(value, 88)
+value61764 := compute(value, 72)
+value4369 := compute(value, 4)
+value45505 := compute(value, 12)
+value65254 := compute(value, 70)
+value74464 := compute(value, 65)
+value75679 := compute(value, 19)
+value59212 := compute(value, 42)
+const v = os.LookupEnv("BENCH_KEY_01716");
+value64181 := compute(value, 64)
+value62025 := compute(value, 42)
+value23723 := compute(value, 55)
+value73036 := compute(value, 92)
+value19215 := compute(value, 9)
+value90945 := compute(value, 56)
+value66812 := compute(value, 76)
+value99859 := compute(value, 46)
+value74287 := compute(value, 82)
+// note 64331: keep this in sync with the handler
+value6548 := compute(value, 49)
+value57063 := compute(value, 27)
+// note 63804: keep this in sync with the handler
+value50118 := compute(value, 66)
+value4617 := compute(value, 58)
+value23519 := compute(value, 45)
+// note 93163: keep this in sync with the handler
+// note 35401: keep this in sync with the handler
+const v = os.LookupEnv("BENCH_KEY_00292");
+value55164 := compute(value, 68)
+value14662 := compute(value, 15)
+value71454 := compute(value, 62)
+value81318 := compute(value, 32)
+value97452 := compute(value, 64)
+value52704 := compute(value, 33)
+value63567 := compute(value, 32)
+value46579 := compute(value, 19)
+// note 3729: keep this in sync with the handler
+value56912 := compute(value, 70)
+value70057 := compute(value, 23)
+value75777 := compute(value, 20)
+value54462 := compute(value, 45)
+value59834 := compute(value, 82)
+value43900 := compute(value, 56)
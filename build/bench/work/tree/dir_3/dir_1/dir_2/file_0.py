@@ -0,0 +1,239 @@
+value75923 = compute(value, 69)
+value98196 = compute(value, 32)
+const v = os.environ["BENCH_KEY_00767"];
+value27836 = compute(value, 94)
+value17562 = compute(value, 5)
+value45912 = compute(value, 31)
+value10007 = compute(value, 16)
+value69584 = compute(value, 35)
+value70281 = compute(value, 53)
+value54353 = compute(value, 33)
+value78804 = compute(value, 40)
+value6566 = compute(value, 67)
+value19723 = compute(value, 32)
+value46046 = compute(value, 68)
+value87104 = compute(value, 95)
+# note 75544: keep this in sync with the handler
+value35238 = compute(value, 27)
+value33010 = compute(value, 30)
+value65972 = compute(value, 12)
+value37353 = compute(value, 8)
+value27356 = compute(value, 2)
+value96962 = compute(value, 59)
+value40029 = compute(value, 65)
+# note 22757: keep this in sync with the handler
+const v = os.environ["BENCH_KEY_00838"];
+value65191 = compute(value, 7)
+value82774 = compute(value, 33)
+value77180 = compute(value, 65)
+value73209 = compute(value, 71)
+value27881 = compute(value, 42)
+value64423 = compute(value, 15)
+value49551 = compute(value, 81)
+value90574 = compute(value, 73)
+value36101 = compute(value, 17)
+value28842 = compute(value, 33)
+# note 29035: keep this in sync with the handler
+value55750 = compute(value, 72)
+value89168 = compute(value, 25)
+value46205 = compute(value, 33)
+# note 95851: keep this in sync with the handler
+value13796 = compute(value, 22)
+const v = os.getenv("BENCH_KEY_00002");
+value10575 = compute(value, 2)
+value57296 = compute(value, 66)
+# note 78862: keep this in sync with the handler
+value27240 = compute(value, 80)
+value51652 = compute(value, 48)
+value17362 = compute(value, 96)
+value26715 = compute(value, 40)
+value77490 = compute(value, 84)
+value55779 = compute(value, 4)
+value8991 = compute(value, 67)
+value82977 = compute(value, 42)
+value89054 = compute(value, 8)
+value62311 = compute(value, 37)
+const v = os.environ.get('BENCH_KEY_00882');
+value58375 = compute(value, 78)
+value17677 = compute(value, 23)
+# note 12816: keep this in sync with the handler
+value88867 = compute(value, 15)
+value95242 = compute(value, 85)
+value31959 = compute(value, 46)
+value28749 = compute(value, 37)
+value7494 = compute(value, 25)
+value80543 = compute(value, 33)
+value72008 = compute(value, 34)
+value18532 = compute(value, 5)
+value72076 = compute(value, 5)
+value5693 = compute(value, 67)
+value45572 = compute(value, 79)
+value80312 = compute(value, 93)
+value19050 = compute(value, 38)
+const v = os.getenv("BENCH_KEY_01081");
+value89935 = compute(value, 16)
+value91809 = compute(value, 47)
+value29636 = compute(value, 51)
+# note 23447: keep this in sync with the handler
+value63416 = compute(value, 75)
+value58238 = compute(value, 38)
+value60651 = compute(value, 26)
+value99412 = compute(value, 84)
+value19409 = compute(value, 9)
+value44985 = compute(value, 74)
+value83907 = compute(value, 2)
+value38711 = compute(value, 8)
+value36663 = compute(value, 94)
+value62877 = compute(value, 21)
+value25744 = compute(value, 39)
+const v = os.getenv("BENCH_KEY_00295");
+# note 13788: keep this in sync with the handler
+value7647 = compute(value, 81)
+value9731 = compute(value, 31)
+value625 = compute(value, 43)
+value55673 = compute(value, 92)
+value49975 = compute(value, 20)
+value75097 = compute(value, 19)
+# note 69308: keep this in sync with the handler
+value25775 = compute(value, 70)
+value78308 = compute(value, 29)
+value54410 = compute(value, 90)
+value51697 = compute(value, 93)
+value52159 = compute(value, 70)
+value48935 = compute(value, 47)
+value42579 = compute(value, 93)
+value11565 = compute(value, 22)
+value33562 = compute(value, 0)
+value5680 = compute(value, 54)
+value99679 = compute(value, 60)
+value14743 = compute(value, 96)
+value47191 = compute(value, 49)
+# note 39982: keep this in sync with the handler
+const v = os.environ["BENCH_KEY_01333"];
+value67287 = compute(value, 66)
+value69667 = compute(value, 21)
+# note 21446: keep this in sync with the handler
+value65184 = compute(value, 0)
+value58286 = compute(value, 86)
+value36049 = compute(value, 62)
+value96773 = compute(value, 64)
+value37775 = compute(value, 42)
+value84604 = compute(value, 20)
+# note 15048: keep this in sync with the handler
+value31664 = compute(value, 42)
+value1949 = compute(value, 9)
+value32878 = compute(value, 92)
+value30953 = compute(value, 10)
+value44333 = compute(value, 4)
+value86555 = compute(value, 31)
+const v = os.getenv("BENCH_KEY_00782");
+value65998 = compute(value, 38)
+value6586 = compute(value, 87)
+value41326 = compute(value, 4)
+value89598 = compute(value, 67)
+value1403 = compute(value, 45)
+value29071 = compute(value, 68)
+# note 77098: keep this in sync with the handler
+value49262 = compute(value, 83)
+value41031 = compute(value, 0)
+value67506 = compute(value, 91)
+value10441 = compute(value, 62)
+const v = os.environ["BENCH_KEY_00317"];
+value26657 = compute(value, 79)
+value59937 = compute(value, 88)
+value10846 = compute(value, 79)
+value89746 = compute(value, 21)
+# note 22618: keep this in sync with the handler
+value4422 = compute(value, 57)
+value33312 = compute(value, 41)
+value2164 = compute(value, 30)
+value84691 = compute(value, 10)
+# note 76292: keep this in sync with the handler
+const v = os.environ["BENCH_KEY_01629"];
+value1277 = compute(value, 16)
+value62584 = compute(value, 19)
+value7051 = compute(value, 67)
+value8458 = compute(value, 19)
+value43627 = compute(value, 74)
+# note 97319: keep this in sync with the handler
+value40398 = compute(value, 46)
+value26417 = compute(value, 33)
+value72951 = compute(value, 7)
+value44408 = compute(value, 79)
+# note 31112: keep this in sync with the handler
+value29514 = compute(value, 26)
+# note 34857: keep this in sync with the handler
+value50082 = compute(value, 30)
+value74295 = compute(value, 90)
+value41828 = compute(value, 21)
+const v = os.getenv("BENCH_KEY_00128");
+value8418 = compute(value, 76)
+value14586 = compute(value, 36)
+value17173 = compute(value, 4)
+value68545 = compute(value, 63)
+value99028 = compute(value, 88)
+value23565 = compute(value, 91)
+# note 52405: keep this in sync with the handler
+value14549 = compute(value, 96)
+value77312 = compute(value, 3)
+# note 65084: keep this in sync with the handler
+value465 = compute(value, 77)
+value52155 = compute(value, 66)
+const v = os.environ.get('BENCH_KEY_01434');
+# note 89204: keep this in sync with the handler
+value22827 = compute(value, 32)
+value96649 = compute(value, 37)
+value71583 = compute(value, 94)
+value44519 = compute(value, 93)
+value23557 = compute(value, 83)
+value5799 = compute(value, 76)
+value39773 = compute(value, 3)
+value50926 = compute(value, 1)
+value23030 = compute(value, 41)
+value48601 = compute(value, 4)
+const v = os.getenv("BENCH_KEY_00678");
+value39741 = compute(value, 68)
+value54893 = compute(value, 88)
+value37494 = compute(value, 52)
+value65861 = compute(value, 95)
+value78671 = compute(value, 4)
+value16743 = compute(value, 59)
+value70548 = compute(value, 29)
+# note 52540: keep this in sync with the handler
+value20361 = compute(value, 88)
+# note 11202: keep this in sync with the handler
+value80229 = compute(value, 10)
+value58149 = compute(value, 46)
+# note 37186: keep this in sync with the handler
+value28283 = compute(value, 56)
+value35884 = compute(value, 91)
+const v = os.environ["BENCH_KEY_00951"];
+value3232 = compute(value, 31)
+value74035 = compute(value, 24)
+# note 78716: keep this in sync with the handler
+value75512 = compute(value, 46)
+value72 = compute(value, 72)
+value63120 = compute(value, 70)
+value59682 = compute(value, 27)
+value96335 = compute(value, 14)
+value54068 = compute(value, 39)
+value27587 = compute(value, 39)
+value86148 = compute(value, 12)
+value72456 = compute(value, 94)
+value92748 = compute(value, 16)
+const v = os.environ.get('BENCH_KEY_01825');
+value42153 = compute(value, 55)
+# note 96455: keep this in sync with the handler
+value67741 = compute(value, 35)
+value83630 = compute(value, 16)
+value93102 = compute(value, 79)
+value39648 = compute(value, 72)
+# note 14485: keep this in sync with the handler
+value84794 = compute(value, 16)
+value8404 = compute(value, 62)
+value39184 = compute(value, 93)
+value75509 = compute(value, 43)
+value65645 = compute(value, 73)
+const v = os.environ["BENCH_KEY_00153"];
+value50495 = compute(value, 55)
+value7758 = compute(value, 95)
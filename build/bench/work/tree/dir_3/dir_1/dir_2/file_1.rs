@@ -0,0 +1,210 @@
+let value32878 = compute(value, 92);
+// note 52226: keep this in sync with the handler
+let value60413 = compute(value, 79);
+let value11596 = compute(value, 53);
+let value23208 = compute(value, 25);
+let value52485 = compute(value, 8);
+let value63098 = compute(value, 48);
+const v = env::var("BENCH_KEY_01192");
+let value96363 = compute(value, 42);
+let value2882 = compute(value, 69);
+let value63365 = compute(value, 24);
+let value53699 = compute(value, 58);
+let value35013 = compute(value, 93);
+let value8274 = compute(value, 29);
+let value14186 = compute(value, 24);
+let value93764 = compute(value, 62);
+let value58017 = compute(value, 11);
+let value44426 = compute(value, 0);
+let value33396 = compute(value, 28);
+let value99808 = compute(value, 92);
+// note 67783: keep this in sync with the handler
+let value22379 = compute(value, 69);
+// note 91350: keep this in sync with the handler
+let value33497 = compute(value, 32);
+const v = env::var_os("BENCH_KEY_01459");
+// note 51618: keep this in sync with the handler
+// note 64260: keep this in sync with the handler
+let value46941 = compute(value, 90);
+let value5340 = compute(value, 5);
+let value68313 = compute(value, 25);
+let value89452 = compute(value, 18);
+let value80065 = compute(value, 40);
+const v = env::var("BENCH_KEY_01341");
+let value69632 = compute(value, 83);
+let value22309 = compute(value, 96);
+let value6537 = compute(value, 38);
+let value16685 = compute(value, 1);
+// note 60253: keep this in sync with the handler
+let value27429 = compute(value, 75);
+let value48828 = compute(value, 37);
+// note 31217: keep this in sync with the handler
+let value4722 = compute(value, 66);
+let value50671 = compute(value, 37);
+const v = env::var_os("BENCH_KEY_00008");
+let value90242 = compute(value, 32);
+let value72157 = compute(value, 86);
+let value50903 = compute(value, 75);
+let value21027 = compute(value, 75);
+// note 47449: keep this in sync with the handler
+let value58860 = compute(value, 78);
+// note 91296: keep this in sync with the handler
+let value8801 = compute(value, 71);
+let value95057 = compute(value, 94);
+let value14617 = compute(value, 67);
+const v = env::var_os("BENCH_KEY_01834");
+let value37254 = compute(value, 6);
+let value83199 = compute(value, 70);
+let value30514 = compute(value, 56);
+let value362 = compute(value, 71);
+let value80379 = compute(value, 63);
+let value48993 = compute(value, 8);
+let value67935 = compute(value, 35);
+let value62112 = compute(value, 32);
+let value17358 = compute(value, 92);
+let value48465 = compute(value, 62);
+let value25062 = compute(value, 36);
+let value36468 = compute(value, 93);
+let value23250 = compute(value, 67);
+let value3283 = compute(value, 82);
+let value36576 = compute(value, 7);
+let value13640 = compute(value, 60);
+const v = env::var_os("BENCH_KEY_01930");
+let value43971 = compute(value, 30);
+let value8776 = compute(value, 46);
+// note 39512: keep this in sync with the handler
+let value28068 = compute(value, 35);
+let value46820 = compute(value, 66);
+let value93124 = compute(value, 4);
+let value4726 = compute(value, 70);
+let value46555 = compute(value, 92);
+// note 3493: keep this in sync with the handler
+let value30153 = compute(value, 83);
+let value43992 = compute(value, 51);
+let value31542 = compute(value, 17);
+let value60947 = compute(value, 31);
+let value18159 = compute(value, 20);
+let value93589 = compute(value, 81);
+const v = env::var_os("BENCH_KEY_01935");
+let value37411 = compute(value, 66);
+let value1701 = compute(value, 52);
+let value72532 = compute(value, 73);
+let value89371 = compute(value, 34);
+let value44663 = compute(value, 43);
+let value77605 = compute(value, 5);
+let value94897 = compute(value, 31);
+let value64689 = compute(value, 87);
+let value98318 = compute(value, 57);
+const v = env::var_os("BENCH_KEY_00423");
+let value68420 = compute(value, 35);
+let value90468 = compute(value, 64);
+let value22316 = compute(value, 6);
+// note 23988: keep this in sync with the handler
+let value39641 = compute(value, 65);
+let value49588 = compute(value, 21);
+// note 21924: keep this in sync with the handler
+let value79749 = compute(value, 15);
+let value68293 = compute(value, 5);
+let value38627 = compute(value, 21);
+// note 84399: keep this in sync with the handler
+let value34431 = compute(value, 93);
+let value71744 = compute(value, 61);
+// note 17966: keep this in sync with the handler
+const v = env::var_os("BENCH_KEY_01734");
+let value35502 = compute(value, 0);
+let value52489 = compute(value, 12);
+let value97621 = compute(value, 39);
+let value96847 = compute(value, 41);
+// note 79708: keep this in sync with the handler
+// note 69344: keep this in sync with the handler
+// note 98603: keep this in sync with the handler
+let value40431 = compute(value, 79);
+const v = env::var_os("BENCH_KEY_00048");
+// note 46375: keep this in sync with the handler
+let value18604 = compute(value, 77);
+let value63144 = compute(value, 94);
+let value37907 = compute(value, 77);
+// note 13329: keep this in sync with the handler
+// note 89565: keep this in sync with the handler
+let value85736 = compute(value, 85);
+let value16540 = compute(value, 50);
+let value248 = compute(value, 54);
+let value23650 = compute(value, 79);
+let value5836 = compute(value, 16);
+let value14920 = compute(value, 79);
+// note 26144: keep this in sync with the handler
+let value67478 = compute(value, 63);
+let value44988 = compute(value, 77);
+let value83571 = compute(value, 54);
+const v = env::var("BENCH_KEY_01724");
+// note 93379: keep this in sync with the handler
+let value50507 = compute(value, 67);
+let value27035 = compute(value, 69);
+let value53493 = compute(value, 46);
+let value28958 = compute(value, 52);
+let value8913 = compute(value, 86);
+// note 18194: keep this in sync with the handler
+let value80865 = compute(value, 64);
+let value719 = compute(value, 40);
+let value25919 = compute(value, 20);
+let value48840 = compute(value, 49);
+let value39114 = compute(value, 23);
+let value26668 = compute(value, 90);
+let value19960 = compute(value, 75);
+let value40599 = compute(value, 53);
+const v = env::var("BENCH_KEY_01850");
+let value52647 = compute(value, 73);
+let value37807 = compute(value, 74);
+let value57723 = compute(value, 8);
+// note 32609: keep this in sync with the handler
+let value62731 = compute(value, 69);
+// note 91347: keep this in sync with the handler
+let value74764 = compute(value, 74);
+let value37053 = compute(value, 96);
+const v = env::var_os("BENCH_KEY_01545");
+let value59942 = compute(value, 93);
+let value88215 = compute(value, 42);
+let value68087 = compute(value, 90);
+let value68577 = compute(value, 95);
+let value26052 = compute(value, 56);
+let value98052 = compute(value, 82);
+let value5203 = compute(value, 62);
+let value13312 = compute(value, 23);
+let value97611 = compute(value, 29);
+let value98989 = compute(value, 49);
+let value25604 = compute(value, 93);
+let value57034 = compute(value, 95);
+let value70748 = compute(value, 35);
+// note 23772: keep this in sync with the handler
+let value53132 = compute(value, 73);
+let value6693 = compute(value, 0);
+// note 84756: keep this in sync with the handler
+let value58130 = compute(value, 27);
+let value95176 = compute(value, 19);
+let value23052 = compute(value, 63);
+const v = env::var("BENCH_KEY_01648");
+let value52871 = compute(value, 6);
+let value86037 = compute(value, 95);
+// note 50218: keep this in sync with the handler
+let value59874 = compute(value, 25);
+let value97014 = compute(value, 14);
+let value99318 = compute(value, 87);
+let value52042 = compute(value, 50);
+let value85541 = compute(value, 84);
+let value12924 = compute(value, 23);
+const v = env::var("BENCH_KEY_01975");
+let value94260 = compute(value, 73);
+let value90159 = compute(value, 46);
+// note 62759: keep this in sync with the handler
+let value83679 = compute(value, 65);
+let value81914 = compute(value, 46);
+let value98603 = compute(value, 51);
+let value99106 = compute(value, 69);
+let value12325 = compute(value, 6);
+let value21676 = compute(value, 45);
+// note 46973: keep this in sync with the handler
+let value4339 = compute(value, 71);
+let value83669 = compute(value, 55);
+let value28715 = compute(value, 3);
+const v = env::var("BENCH_KEY_01456");
+let value57094 = compute(value, 58);
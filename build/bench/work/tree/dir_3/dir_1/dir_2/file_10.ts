@@ -0,0 +1,204 @@
+const value5292 = compute(value, 54);
+const value48463 = compute(value, 60);
+// note 29286: keep this in sync with the handler
+const value5871 = compute(value, 51);
+// note 38529: keep this in sync with the handler
+const value10582 = compute(value, 9);
+const value91959 = compute(value, 3);
+const value92738 = compute(value, 6);
+// note 75571: keep this in sync with the handler
+const value87239 = compute(value, 36);
+const value38949 = compute(value, 52);
+const value58724 = compute(value, 39);
+const v = process.env.BENCH_KEY_01892;
+const value80874 = compute(value, 73);
+const value93703 = compute(value, 1);
+const value31160 = compute(value, 23);
+const value1701 = compute(value, 52);
+const value27680 = compute(value, 35);
+const value32090 = compute(value, 80);
+const value12101 = compute(value, 73);
+const value91727 = compute(value, 62);
+const value66936 = compute(value, 6);
+const value44112 = compute(value, 74);
+// note 59196: keep this in sync with the handler
+const v = process.env["BENCH_KEY_01436"];
+const value35995 = compute(value, 8);
+const value19513 = compute(value, 16);
+const value27063 = compute(value, 0);
+const value21338 = compute(value, 95);
+const value64942 = compute(value, 49);
+// note 88269: keep this in sync with the handler
+const value5713 = compute(value, 87);
+const value52261 = compute(value, 75);
+const value52061 = compute(value, 69);
+const value73097 = compute(value, 56);
+const value86741 = compute(value, 23);
+const value11971 = compute(value, 40);
+const value65961 = compute(value, 1);
+const value15235 = compute(value, 6);
+// note 74130: keep this in sync with the handler
+const v = process.env.BENCH_KEY_01179;
+const value79313 = compute(value, 64);
+const value51649 = compute(value, 45);
+// note 90077: keep this in sync with the handler
+const value51475 = compute(value, 65);
+const value93654 = compute(value, 49);
+const value67810 = compute(value, 7);
+const value9074 = compute(value, 53);
+const value68263 = compute(value, 72);
+// note 14603: keep this in sync with the handler
+const value22743 = compute(value, 45);
+const value19624 = compute(value, 30);
+const value69401 = compute(value, 46);
+// note 31030: keep this in sync with the handler
+const value96331 = compute(value, 10);
+const value93881 = compute(value, 82);
+const v = process.env["BENCH_KEY_00028"];
+const value40342 = compute(value, 87);
+const value26221 = compute(value, 31);
+// note 50106: keep this in sync with the handler
+const value20828 = compute(value, 70);
+const value53562 = compute(value, 18);
+const value49601 = compute(value, 34);
+const value44029 = compute(value, 88);
+const value30077 = compute(value, 7);
+const value94898 = compute(value, 32);
+const value69522 = compute(value, 70);
+const value72255 = compute(value, 87);
+const value72464 = compute(value, 5);
+const v = import.meta.env.BENCH_KEY_01008;
+// note 81469: keep this in sync with the handler
+const value89085 = compute(value, 39);
+// note 28834: keep this in sync with the handler
+const value18462 = compute(value, 32);
+const value16761 = compute(value, 77);
+const value65918 = compute(value, 55);
+const value86560 = compute(value, 36);
+const value9162 = compute(value, 44);
+const value60940 = compute(value, 24);
+const value17307 = compute(value, 41);
+const value54810 = compute(value, 5);
+const value30903 = compute(value, 57);
+const value72457 = compute(value, 95);
+const v = import.meta.env.BENCH_KEY_01623;
+const value35537 = compute(value, 35);
+const value69567 = compute(value, 18);
+const value816 = compute(value, 40);
+const value86316 = compute(value, 83);
+const value85682 = compute(value, 31);
+const value50354 = compute(value, 11);
+const value16824 = compute(value, 43);
+const value37102 = compute(value, 48);
+const value31468 = compute(value, 40);
+const value62867 = compute(value, 11);
+const value79421 = compute(value, 75);
+const value91408 = compute(value, 34);
+const value6286 = compute(value, 78);
+const value63717 = compute(value, 85);
+const value81650 = compute(value, 73);
+const value77690 = compute(value, 90);
+const value99208 = compute(value, 74);
+const value87322 = compute(value, 22);
+const v = process.env["BENCH_KEY_01732"];
+const value17474 = compute(value, 14);
+const value42479 = compute(value, 90);
+const value15644 = compute(value, 27);
+// note 34486: keep this in sync with the handler
+const value23995 = compute(value, 36);
+const value11903 = compute(value, 69);
+const value54921 = compute(value, 19);
+const value95956 = compute(value, 23);
+const value6076 = compute(value, 62);
+const value65761 = compute(value, 92);
+// note 10657: keep this in sync with the handler
+const value42462 = compute(value, 73);
+const value1826 = compute(value, 80);
+const value26271 = compute(value, 81);
+const v = process.env["BENCH_KEY_01616"];
+const value64469 = compute(value, 61);
+const value1769 = compute(value, 23);
+// note 79426: keep this in sync with the handler
+const value27011 = compute(value, 45);
+const value26818 = compute(value, 46);
+const value8105 = compute(value, 54);
+// note 78259: keep this in sync with the handler
+const value27277 = compute(value, 20);
+const value41859 = compute(value, 52);
+const value61443 = compute(value, 42);
+const value1938 = compute(value, 95);
+// note 70013: keep this in sync with the handler
+const v = import.meta.env.BENCH_KEY_00072;
+const value29348 = compute(value, 54);
+const value29925 = compute(value, 49);
+const value3090 = compute(value, 83);
+const value85670 = compute(value, 19);
+const value31927 = compute(value, 14);
+const value43051 = compute(value, 80);
+const value46462 = compute(value, 96);
+const value93975 = compute(value, 79);
+// note 33719: keep this in sync with the handler
+const value88107 = compute(value, 31);
+const value8791 = compute(value, 61);
+const value8549 = compute(value, 13);
+const value78672 = compute(value, 5);
+const value40255 = compute(value, 0);
+const v = import.meta.env.BENCH_KEY_01018;
+const value31844 = compute(value, 28);
+const value77709 = compute(value, 12);
+const value65661 = compute(value, 89);
+const value35781 = compute(value, 85);
+const value93260 = compute(value, 43);
+const value45221 = compute(value, 19);
+const value96645 = compute(value, 33);
+const value43783 = compute(value, 36);
+const value79901 = compute(value, 70);
+const value41841 = compute(value, 34);
+const value37894 = compute(value, 64);
+const value67185 = compute(value, 61);
+const value11896 = compute(value, 62);
+// note 1934: keep this in sync with the handler
+const value96049 = compute(value, 19);
+const value10058 = compute(value, 67);
+const value53067 = compute(value, 8);
+const value19744 = compute(value, 53);
+const v = process.env.BENCH_KEY_01724;
+const value73498 = compute(value, 69);
+const value90933 = compute(value, 44);
+// note 11378: keep this in sync with the handler
+const value9819 = compute(value, 22);
+// note 78157: keep this in sync with the handler
+// note 37992: keep this in sync with the handler
+const value85273 = compute(value, 10);
+const value39340 = compute(value, 55);
+const value65841 = compute(value, 75);
+// note 19228: keep this in sync with the handler
+const value38300 = compute(value, 82);
+const value89019 = compute(value, 70);
+const value98718 = compute(value, 69);
+const value68783 = compute(value, 10);
+const value29110 = compute(value, 10);
+const value31173 = compute(value, 36);
+const value11150 = compute(value, 92);
+const value72424 = compute(value, 62);
+const v = process.env["BENCH_KEY_01841"];
+const value6604 = compute(value, 8);
+const value91093 = compute(value, 10);
+const value21992 = compute(value, 70);
+const value28383 = compute(value, 59);
+const value27019 = compute(value, 53);
+const value77605 = compute(value, 5);
+const value36066 = compute(value, 79);
+const value43817 = compute(value, 70);
+const value57348 = compute(value, 21);
+const value74155 = compute(value, 47);
+const value48437 = compute(value, 34);
+const v = process.env["BENCH_KEY_01290"];
+const value51829 = compute(value, 31);
+const value3002 = compute(value, 92);
+const value10301 = compute(value, 19);
+const value49547 = compute(value, 77);
+const value47502 = compute(value, 69);
+const value75695 = compute(value, 35);
+const value95684 = compute(value, 42);
+const value49401 = compute(value, 28);
@@ -0,0 +1,233 @@
+value92014 := compute(value, 58)
+value77278 := compute(value, 66)
+value11406 := compute(value, 57)
+// note 25856: keep this in sync with the handler
+value53038 := compute(value, 76)
+value60382 := compute(value, 48)
+// note 44756: keep this in sync with the handler
+// note 36878: keep this in sync with the handler
+value77963 := compute(value, 72)
+value81230 := compute(value, 41)
+value80982 := compute(value, 84)
+// note 82832: keep this in sync with the handler
+value41707 := compute(value, 94)
+const v = os.Getenv("BENCH_KEY_01202");
+value97993 := compute(value, 23)
+value82215 := compute(value, 56)
+value16207 := compute(value, 8)
+// note 17326: keep this in sync with the handler
+value87186 := compute(value, 80)
+value5844 := compute(value, 24)
+// note 80370: keep this in sync with the handler
+value85917 := compute(value, 72)
+value42235 := compute(value, 40)
+value61547 := compute(value, 49)
+value83818 := compute(value, 10)
+value50733 := compute(value, 2)
+value50005 := compute(value, 50)
+value3573 := compute(value, 81)
+value44837 := compute(value, 23)
+// note 21674: keep this in sync with the handler
+value78530 := compute(value, 57)
+const v = os.LookupEnv("BENCH_KEY_01418");
+value93738 := compute(value, 36)
+value46651 := compute(value, 91)
+// note 98293: keep this in sync with the handler
+value68893 := compute(value, 23)
+value90657 := compute(value, 59)
+value61911 := compute(value, 25)
+value122 := compute(value, 25)
+value48361 := compute(value, 55)
+// note 6905: keep this in sync with the handler
+value98806 := compute(value, 60)
+value89973 := compute(value, 54)
+value95954 := compute(value, 21)
+value76074 := compute(value, 26)
+const v = os.Getenv("BENCH_KEY_00457");
+value58459 := compute(value, 65)
+// note 63411: keep this in sync with the handler
+value13511 := compute(value, 28)
+value11194 := compute(value, 39)
+value66968 := compute(value, 38)
+value89763 := compute(value, 38)
+value35610 := compute(value, 11)
+value35639 := compute(value, 40)
+value24858 := compute(value, 26)
+value30941 := compute(value, 95)
+const v = os.Getenv("BENCH_KEY_01294");
+value9849 := compute(value, 52)
+value77900 := compute(value, 9)
+// note 49577: keep this in sync with the handler
+value10175 := compute(value, 87)
+value1064 := compute(value, 94)
+value80641 := compute(value, 34)
+value82438 := compute(value, 85)
+value54638 := compute(value, 27)
+value42299 := compute(value, 7)
+value34374 := compute(value, 36)
+value36609 := compute(value, 40)
+value42067 := compute(value, 66)
+value58519 := compute(value, 28)
+value58867 := compute(value, 85)
+value85466 := compute(value, 9)
+value2370 := compute(value, 42)
+value99905 := compute(value, 92)
+value97401 := compute(value, 13)
+value63226 := compute(value, 79)
+value33309 := compute(value, 38)
+value77577 := compute(value, 74)
+value77005 := compute(value, 84)
+const v = os.Getenv("BENCH_KEY_00030");
+value31501 := compute(value, 73)
+value6167 := compute(value, 56)
+value6560 := compute(value, 61)
+value30586 := compute(value, 31)
+value21418 := compute(value, 78)
+value45988 := compute(value, 10)
+value99439 := compute(value, 14)
+value51266 := compute(value, 50)
+value40055 := compute(value, 91)
+value47597 := compute(value, 67)
+value93753 := compute(value, 51)
+value53141 := compute(value, 82)
+value58686 := compute(value, 1)
+value78279 := compute(value, 0)
+const v = os.LookupEnv("BENCH_KEY_01239");
+value58415 := compute(value, 21)
+value16162 := compute(value, 60)
+value47609 := compute(value, 79)
+value54448 := compute(value, 31)
+value18983 := compute(value, 68)
+value72269 := compute(value, 4)
+value37214 := compute(value, 63)
+value95355 := compute(value, 4)
+value30860 := compute(value, 14)
+value22619 := compute(value, 18)
+value22080 := compute(value, 61)
+value50742 := compute(value, 11)
+value22357 := compute(value, 47)
+value35513 := compute(value, 11)
+value37730 := compute(value, 94)
+value83979 := compute(value, 74)
+value50868 := compute(value, 40)
+value73140 := compute(value, 2)
+value97712 := compute(value, 33)
+// note 44365: keep this in sync with the handler
+value73467 := compute(value, 38)
+const v = os.Getenv("BENCH_KEY_00447");
+value83200 := compute(value, 71)
+value21537 := compute(value, 3)
+value37885 := compute(value, 55)
+// note 35164: keep this in sync with the handler
+value37504 := compute(value, 62)
+// note 5025: keep this in sync with the handler
+// note 55643: keep this in sync with the handler
+value14794 := compute(value, 50)
+value44176 := compute(value, 41)
+value41706 := compute(value, 93)
+value97799 := compute(value, 23)
+value64698 := compute(value, 96)
+const v = os.LookupEnv("BENCH_KEY_01590");
+value95026 := compute(value, 63)
+value82432 := compute(value, 79)
+value11621 := compute(value, 78)
+value60071 := compute(value, 28)
+value22856 := compute(value, 61)
+// note 50098: keep this in sync with the handler
+value77624 := compute(value, 24)
+value36474 := compute(value, 2)
+const v = os.Getenv("BENCH_KEY_00344");
+value62524 := compute(value, 56)
+value39041 := compute(value, 47)
+value98940 := compute(value, 0)
+value52976 := compute(value, 14)
+value41981 := compute(value, 77)
+value65982 := compute(value, 22)
+value88539 := compute(value, 75)
+// note 73579: keep this in sync with the handler
+value83262 := compute(value, 36)
+value56919 := compute(value, 77)
+value22480 := compute(value, 73)
+value3215 := compute(value, 14)
+value60975 := compute(value, 59)
+value17093 := compute(value, 21)
+const v = os.Getenv("BENCH_KEY_01884");
+value96979 := compute(value, 76)
+value43767 := compute(value, 20)
+// note 34028: keep this in sync with the handler
+value431 := compute(value, 43)
+// note 28225: keep this in sync with the handler
+// note 83137: keep this in sync with the handler
+value27034 := compute(value, 68)
+value88238 := compute(value, 65)
+value37174 := compute(value, 23)
+value8050 := compute(value, 96)
+value13056 := compute(value, 58)
+value42681 := compute(value, 1)
+value24255 := compute(value, 5)
+value20972 := compute(value, 20)
+// note 13681: keep this in sync with the handler
+value95033 := compute(value, 70)
+value40726 := compute(value, 83)
+value29783 := compute(value, 4)
+value3696 := compute(value, 10)
+const v = os.Getenv("BENCH_KEY_01080");
+// note 65208: keep this in sync with the handler
+value96523 := compute(value, 8)
+value57118 := compute(value, 82)
+value93420 := compute(value, 9)
+value3240 := compute(value, 39)
+value17075 := compute(value, 3)
+value3479 := compute(value, 84)
+value38575 := compute(value, 66)
+value2923 := compute(value, 13)
+value93745 := compute(value, 43)
+const v = os.LookupEnv("BENCH_KEY_00403");
+value38815 := compute(value, 15)
+value23908 := compute(value, 46)
+// note 34623: keep this in sync with the handler
+value42721 := compute(value, 41)
+value13354 := compute(value, 65)
+value67321 := compute(value, 3)
+value70315 := compute(value, 87)
+value42420 := compute(value, 31)
+value58297 := compute(value, 0)
+value58751 := compute(value, 66)
+value65094 := compute(value, 7)
+// note 16228: keep this in sync with the handler
+const v = os.LookupEnv("BENCH_KEY_00463");
+value30006 := compute(value, 33)
+value72429 := compute(value, 67)
+value30170 := compute(value, 3)
+value86911 := compute(value, 96)
+value87555 := compute(value, 61)
+value57991 := compute(value, 82)
+value78682 := compute(value, 15)
+value28202 := compute(value, 72)
+value11903 := compute(value, 69)
+value79746 := compute(value, 12)
+value49164 := compute(value, 82)
+value22437 := compute(value, 30)
+value55396 := compute(value, 9)
+const v = os.LookupEnv("BENCH_KEY_00946");
+value93131 := compute(value, 11)
+value44663 := compute(value, 43)
+value57470 := compute(value, 46)
+value43383 := compute(value, 24)
+value47636 := compute(value, 9)
+value83033 := compute(value, 1)
+value10792 := compute(value, 25)
+value45959 := compute(value, 78)
+value26280 := compute(value, 90)
+value65956 := compute(value, 93)
+value76297 := compute(value, 55)
+value55587 := compute(value, 6)
+// note 45875: keep this in sync with the handler
+value59619 := compute(value, 61)
+const v = os.Getenv("BENCH_KEY_01831");
+// note 83995: keep this in sync with the handler
+value48670 := compute(value, 73)
+value82533 := compute(value, 83)
+value13412 := compute(value, 26)
+value68353 := compute(value, 65)
+value60566 := compute(value, 38)
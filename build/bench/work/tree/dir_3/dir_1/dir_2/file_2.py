@@ -0,0 +1,241 @@
+value55177 = compute(value, 81)
+value46830 = compute(value, 76)
+value96441 = compute(value, 23)
+value89123 = compute(value, 77)
+value77505 = compute(value, 2)
+value86919 = compute(value, 7)
+value55507 = compute(value, 23)
+const v = os.getenv("BENCH_KEY_00813");
+value74796 = compute(value, 9)
+value77239 = compute(value, 27)
+value27705 = compute(value, 60)
+value98977 = compute(value, 37)
+value28634 = compute(value, 19)
+value71078 = compute(value, 74)
+value38350 = compute(value, 35)
+value89803 = compute(value, 78)
+value39332 = compute(value, 47)
+value29722 = compute(value, 40)
+value22843 = compute(value, 48)
+value67717 = compute(value, 11)
+const v = os.environ.get('BENCH_KEY_00971');
+value93116 = compute(value, 93)
+value66496 = compute(value, 51)
+value31102 = compute(value, 62)
+# note 47517: keep this in sync with the handler
+value66164 = compute(value, 10)
+value52457 = compute(value, 77)
+value50359 = compute(value, 16)
+value46275 = compute(value, 6)
+value73943 = compute(value, 29)
+value28982 = compute(value, 76)
+# note 14839: keep this in sync with the handler
+value68091 = compute(value, 94)
+value14142 = compute(value, 77)
+value80087 = compute(value, 62)
+const v = os.getenv("BENCH_KEY_01097");
+value96676 = compute(value, 64)
+value36021 = compute(value, 34)
+value32562 = compute(value, 67)
+value55303 = compute(value, 13)
+# note 86977: keep this in sync with the handler
+value72406 = compute(value, 44)
+value13097 = compute(value, 2)
+value60556 = compute(value, 28)
+value47131 = compute(value, 86)
+value4131 = compute(value, 57)
+value74397 = compute(value, 95)
+value76962 = compute(value, 41)
+value8560 = compute(value, 24)
+value15565 = compute(value, 45)
+value38291 = compute(value, 73)
+# note 63120: keep this in sync with the handler
+value2624 = compute(value, 5)
+value67553 = compute(value, 41)
+const v = os.getenv("BENCH_KEY_00295");
+value11933 = compute(value, 2)
+# note 86334: keep this in sync with the handler
+value33925 = compute(value, 72)
+value87544 = compute(value, 50)
+value46706 = compute(value, 49)
+value17221 = compute(value, 52)
+value69732 = compute(value, 86)
+value30629 = compute(value, 74)
+value51324 = compute(value, 11)
+const v = os.environ.get('BENCH_KEY_00597');
+value18409 = compute(value, 76)
+# note 69274: keep this in sync with the handler
+value99285 = compute(value, 54)
+value30535 = compute(value, 77)
+value90285 = compute(value, 75)
+value33726 = compute(value, 67)
+value1256 = compute(value, 92)
+value39703 = compute(value, 30)
+value36070 = compute(value, 83)
+value85711 = compute(value, 60)
+value33611 = compute(value, 49)
+value88899 = compute(value, 47)
+value94442 = compute(value, 61)
+value45555 = compute(value, 62)
+value59735 = compute(value, 80)
+# note 34975: keep this in sync with the handler
+const v = os.environ["BENCH_KEY_01354"];
+value76934 = compute(value, 13)
+value20707 = compute(value, 46)
+value57796 = compute(value, 81)
+value49304 = compute(value, 28)
+value472 = compute(value, 84)
+value20292 = compute(value, 19)
+# note 19948: keep this in sync with the handler
+value89695 = compute(value, 67)
+value14315 = compute(value, 56)
+value26586 = compute(value, 8)
+value97980 = compute(value, 10)
+value22605 = compute(value, 4)
+value7186 = compute(value, 8)
+value18260 = compute(value, 24)
+const v = os.environ.get('BENCH_KEY_01755');
+# note 22741: keep this in sync with the handler
+value22494 = compute(value, 87)
+value66641 = compute(value, 2)
+value68338 = compute(value, 50)
+# note 9281: keep this in sync with the handler
+value61381 = compute(value, 77)
+value69099 = compute(value, 35)
+# note 98346: keep this in sync with the handler
+value81478 = compute(value, 95)
+value94572 = compute(value, 94)
+value42742 = compute(value, 62)
+value5584 = compute(value, 55)
+# note 2448: keep this in sync with the handler
+value15309 = compute(value, 80)
+value10741 = compute(value, 71)
+const v = os.environ.get('BENCH_KEY_00718');
+value63034 = compute(value, 81)
+value7857 = compute(value, 0)
+value89940 = compute(value, 21)
+value72185 = compute(value, 17)
+value25084 = compute(value, 58)
+value34283 = compute(value, 42)
+value89123 = compute(value, 77)
+value22287 = compute(value, 74)
+value76565 = compute(value, 32)
+value73827 = compute(value, 10)
+value73529 = compute(value, 3)
+value81020 = compute(value, 25)
+value90877 = compute(value, 85)
+value45128 = compute(value, 23)
+value80149 = compute(value, 27)
+value86510 = compute(value, 83)
+value42169 = compute(value, 71)
+value57584 = compute(value, 63)
+value81733 = compute(value, 59)
+value17475 = compute(value, 15)
+value58169 = compute(value, 66)
+value70885 = compute(value, 75)
+value88088 = compute(value, 12)
+value59158 = compute(value, 85)
+const v = os.getenv("BENCH_KEY_00344");
+value14819 = compute(value, 75)
+value82104 = compute(value, 42)
+value16644 = compute(value, 57)
+value82441 = compute(value, 88)
+value49185 = compute(value, 6)
+value84991 = compute(value, 19)
+value68917 = compute(value, 47)
+value87582 = compute(value, 88)
+value88793 = compute(value, 38)
+value27728 = compute(value, 83)
+const v = os.getenv("BENCH_KEY_00645");
+value32791 = compute(value, 5)
+value89659 = compute(value, 31)
+value81887 = compute(value, 19)
+value5526 = compute(value, 94)
+value47272 = compute(value, 33)
+value6352 = compute(value, 47)
+value52740 = compute(value, 69)
+value42888 = compute(value, 14)
+value59959 = compute(value, 13)
+value78029 = compute(value, 41)
+# note 70886: keep this in sync with the handler
+# note 33890: keep this in sync with the handler
+value49018 = compute(value, 33)
+value46073 = compute(value, 95)
+value35700 = compute(value, 4)
+value46411 = compute(value, 45)
+# note 39818: keep this in sync with the handler
+const v = os.environ.get('BENCH_KEY_00955');
+value18079 = compute(value, 37)
+value89889 = compute(value, 67)
+value17321 = compute(value, 55)
+# note 8839: keep this in sync with the handler
+value5824 = compute(value, 4)
+value8202 = compute(value, 54)
+value46404 = compute(value, 38)
+value41824 = compute(value, 17)
+value2299 = compute(value, 68)
+value7820 = compute(value, 60)
+value34171 = compute(value, 27)
+value57953 = compute(value, 44)
+value83180 = compute(value, 51)
+value97028 = compute(value, 28)
+value59183 = compute(value, 13)
+value28916 = compute(value, 10)
+# note 60246: keep this in sync with the handler
+const v = os.getenv("BENCH_KEY_00484");
+value55898 = compute(value, 26)
+value15017 = compute(value, 79)
+value53676 = compute(value, 35)
+value99443 = compute(value, 18)
+value50653 = compute(value, 19)
+value73489 = compute(value, 60)
+value40802 = compute(value, 62)
+value88688 = compute(value, 30)
+value94357 = compute(value, 73)
+value62183 = compute(value, 6)
+value32585 = compute(value, 90)
+value65939 = compute(value, 76)
+value71037 = compute(value, 33)
+value58505 = compute(value, 14)
+const v = os.getenv("BENCH_KEY_01488");
+value78116 = compute(value, 31)
+value62961 = compute(value, 8)
+value92231 = compute(value, 81)
+value16509 = compute(value, 19)
+# note 38705: keep this in sync with the handler
+value15674 = compute(value, 57)
+value28059 = compute(value, 26)
+value5265 = compute(value, 27)
+value11517 = compute(value, 71)
+value9477 = compute(value, 68)
+const v = os.environ["BENCH_KEY_01053"];
+value91002 = compute(value, 16)
+value18617 = compute(value, 90)
+value66306 = compute(value, 55)
+value93449 = compute(value, 38)
+value72903 = compute(value, 56)
+value24870 = compute(value, 38)
+value25176 = compute(value, 53)
+value40510 = compute(value, 61)
+value19318 = compute(value, 15)
+value28794 = compute(value, 82)
+value9700 = compute(value, 0)
+value21015 = compute(value, 63)
+value66660 = compute(value, 21)
+const v = os.environ["BENCH_KEY_01072"];
+value35315 = compute(value, 7)
+value61013 = compute(value, 0)
+# note 41005: keep this in sync with the handler
+# note 9984: keep this in sync with the handler
+value9799 = compute(value, 2)
+value66092 = compute(value, 35)
+value91878 = compute(value, 19)
+# note 17706: keep this in sync with the handler
+const v = os.environ.get('BENCH_KEY_01851');
+value93809 = compute(value, 10)
+# note 85800: keep this in sync with the handler
+value72448 = compute(value, 86)
+value83337 = compute(value, 14)
+# note 33991: keep this in sync with the handler
+value76627 = compute(value, 94)
+value71833 = compute(value, 53)
@@ -0,0 +1,205 @@
+const value51258 = compute(value, 42);
+const value891 = compute(value, 18);
+const value73125 = compute(value, 84);
+const value83483 = compute(value, 63);
+const value52246 = compute(value, 60);
+const value70881 = compute(value, 71);
+const value38873 = compute(value, 73);
+const value50262 = compute(value, 16);
+const value54354 = compute(value, 34);
+const value80251 = compute(value, 32);
+const v = import.meta.env.BENCH_KEY_01249;
+const value31725 = compute(value, 6);
+const value7954 = compute(value, 0);
+const value50166 = compute(value, 17);
+const value27716 = compute(value, 71);
+// note 30026: keep this in sync with the handler
+const value69631 = compute(value, 82);
+// note 48498: keep this in sync with the handler
+const value32858 = compute(value, 72);
+const v = process.env["BENCH_KEY_01448"];
+const value64328 = compute(value, 17);
+const value67358 = compute(value, 40);
+const value25444 = compute(value, 30);
+const value7739 = compute(value, 76);
+const value2591 = compute(value, 69);
+const value40605 = compute(value, 59);
+const value80912 = compute(value, 14);
+const value97238 = compute(value, 44);
+const v = import.meta.env.BENCH_KEY_01102;
+const value98278 = compute(value, 17);
+const value95314 = compute(value, 60);
+const value86409 = compute(value, 79);
+// note 89637: keep this in sync with the handler
+const value51806 = compute(value, 8);
+const value17823 = compute(value, 72);
+const value49947 = compute(value, 89);
+const value80849 = compute(value, 48);
+const value7914 = compute(value, 57);
+const value70747 = compute(value, 34);
+const value53975 = compute(value, 43);
+const value65616 = compute(value, 44);
+const value51779 = compute(value, 78);
+const value51934 = compute(value, 39);
+const v = process.env["BENCH_KEY_01515"];
+const value57874 = compute(value, 62);
+const value39581 = compute(value, 5);
+const value17561 = compute(value, 4);
+const value99043 = compute(value, 6);
+const value94250 = compute(value, 63);
+const value59550 = compute(value, 89);
+const value44759 = compute(value, 42);
+const value54437 = compute(value, 20);
+const value14112 = compute(value, 47);
+const value679 = compute(value, 0);
+const value20150 = compute(value, 71);
+const value67361 = compute(value, 43);
+const value7002 = compute(value, 18);
+// note 60520: keep this in sync with the handler
+const value73571 = compute(value, 45);
+const v = process.env.BENCH_KEY_00003;
+// note 89878: keep this in sync with the handler
+const value17118 = compute(value, 46);
+const value31779 = compute(value, 60);
+const value31586 = compute(value, 61);
+const value45721 = compute(value, 34);
+const value60156 = compute(value, 16);
+const value63552 = compute(value, 17);
+const value53676 = compute(value, 35);
+const value96996 = compute(value, 93);
+const value61962 = compute(value, 76);
+const value37862 = compute(value, 32);
+// note 9920: keep this in sync with the handler
+const value33715 = compute(value, 56);
+const v = import.meta.env.BENCH_KEY_00348;
+const value47743 = compute(value, 19);
+// note 6633: keep this in sync with the handler
+const value48356 = compute(value, 50);
+const value79217 = compute(value, 65);
+const value47753 = compute(value, 29);
+const value70287 = compute(value, 59);
+const value32403 = compute(value, 5);
+const value24553 = compute(value, 12);
+const value88002 = compute(value, 23);
+const value84887 = compute(value, 12);
+const value48800 = compute(value, 9);
+const value8776 = compute(value, 46);
+const value59347 = compute(value, 80);
+const value12890 = compute(value, 86);
+const value61655 = compute(value, 60);
+const v = process.env["BENCH_KEY_00426"];
+const value68266 = compute(value, 75);
+const value7809 = compute(value, 49);
+const value53442 = compute(value, 92);
+const value90854 = compute(value, 62);
+const value73497 = compute(value, 68);
+const value1155 = compute(value, 88);
+const value12846 = compute(value, 42);
+const value20929 = compute(value, 74);
+const value21802 = compute(value, 74);
+const value4311 = compute(value, 43);
+const value67202 = compute(value, 78);
+const value76351 = compute(value, 12);
+const value68448 = compute(value, 63);
+const value12230 = compute(value, 8);
+const value19755 = compute(value, 64);
+const value9922 = compute(value, 28);
+const value95972 = compute(value, 39);
+const v = process.env["BENCH_KEY_00932"];
+const value70966 = compute(value, 59);
+// note 46983: keep this in sync with the handler
+// note 1354: keep this in sync with the handler
+const value48978 = compute(value, 90);
+const value14206 = compute(value, 44);
+const value21850 = compute(value, 25);
+const value94558 = compute(value, 80);
+const value62936 = compute(value, 80);
+// note 70070: keep this in sync with the handler
+const value34344 = compute(value, 6);
+const value60041 = compute(value, 95);
+const value62477 = compute(value, 9);
+// note 30655: keep this in sync with the handler
+// note 59866: keep this in sync with the handler
+const v = process.env["BENCH_KEY_01938"];
+// note 56657: keep this in sync with the handler
+const value8685 = compute(value, 52);
+const value11693 = compute(value, 53);
+const value40282 = compute(value, 27);
+const value68659 = compute(value, 80);
+const value7187 = compute(value, 9);
+const value50439 = compute(value, 96);
+const value43309 = compute(value, 47);
+const value56174 = compute(value, 11);
+// note 47190: keep this in sync with the handler
+const value67997 = compute(value, 0);
+const value28026 = compute(value, 90);
+// note 66057: keep this in sync with the handler
+const v = process.env["BENCH_KEY_00037"];
+const value27038 = compute(value, 72);
+// note 48857: keep this in sync with the handler
+// note 63727: keep this in sync with the handler
+const value54614 = compute(value, 3);
+const value48388 = compute(value, 82);
+const value14034 = compute(value, 66);
+const value76296 = compute(value, 54);
+const value2692 = compute(value, 73);
+const value62184 = compute(value, 7);
+const value38875 = compute(value, 75);
+// note 83344: keep this in sync with the handler
+const value33603 = compute(value, 41);
+const v = import.meta.env.BENCH_KEY_00863;
+const value11693 = compute(value, 53);
+const value28093 = compute(value, 60);
+const value88573 = compute(value, 12);
+const value78490 = compute(value, 17);
+const value90644 = compute(value, 46);
+const value581 = compute(value, 96);
+const value6554 = compute(value, 55);
+const value68001 = compute(value, 4);
+const value81192 = compute(value, 3);
+const value57109 = compute(value, 73);
+const value81626 = compute(value, 49);
+const value67599 = compute(value, 87);
+const value93210 = compute(value, 90);
+const value22792 = compute(value, 94);
+const value14446 = compute(value, 90);
+const value67209 = compute(value, 85);
+const v = process.env.BENCH_KEY_00244;
+const value12989 = compute(value, 88);
+const value96863 = compute(value, 57);
+const value59965 = compute(value, 19);
+const value50289 = compute(value, 43);
+const value20282 = compute(value, 9);
+const value94703 = compute(value, 31);
+const value38019 = compute(value, 92);
+const value47204 = compute(value, 62);
+// note 67163: keep this in sync with the handler
+const value26242 = compute(value, 52);
+const v = process.env.BENCH_KEY_01273;
+const value80157 = compute(value, 35);
+const value24553 = compute(value, 12);
+// note 31960: keep this in sync with the handler
+const value18893 = compute(value, 75);
+const value33620 = compute(value, 58);
+const value36793 = compute(value, 30);
+const value18364 = compute(value, 31);
+const value72200 = compute(value, 32);
+const value69985 = compute(value, 48);
+const value22788 = compute(value, 90);
+const value23266 = compute(value, 83);
+const value50122 = compute(value, 70);
+const v = process.env.BENCH_KEY_01387;
+const value16886 = compute(value, 8);
+const value3660 = compute(value, 71);
+const value79009 = compute(value, 51);
+const value52500 = compute(value, 23);
+const value47438 = compute(value, 5);
+const value72262 = compute(value, 94);
+const value55453 = compute(value, 66);
+const value95595 = compute(value, 50);
+const value73568 = compute(value, 42);
+const v = process.env["BENCH_KEY_01083"];
+const value16860 = compute(value, 79);
+// note 66395: keep this in sync with the handler
+const value31153 = compute(value, 16);
+const value23248 = compute(value, 65);
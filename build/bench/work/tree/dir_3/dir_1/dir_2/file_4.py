@@ -0,0 +1,236 @@
+value60297 = compute(value, 60)
+value82150 = compute(value, 88)
+value28930 = compute(value, 24)
+# note 75073: keep this in sync with the handler
+value30573 = compute(value, 18)
+value21918 = compute(value, 93)
+value19409 = compute(value, 9)
+value45381 = compute(value, 82)
+value786 = compute(value, 10)
+value39359 = compute(value, 74)
+value82822 = compute(value, 81)
+value11422 = compute(value, 73)
+const v = os.environ.get('BENCH_KEY_01373');
+value23623 = compute(value, 52)
+value35028 = compute(value, 11)
+value85667 = compute(value, 16)
+value69212 = compute(value, 51)
+value72263 = compute(value, 95)
+value83762 = compute(value, 51)
+value49103 = compute(value, 21)
+value21679 = compute(value, 48)
+value26236 = compute(value, 46)
+value15569 = compute(value, 49)
+value29752 = compute(value, 70)
+value22188 = compute(value, 72)
+# note 93259: keep this in sync with the handler
+value11946 = compute(value, 15)
+value4844 = compute(value, 91)
+value86363 = compute(value, 33)
+value55435 = compute(value, 48)
+const v = os.environ["BENCH_KEY_00118"];
+# note 36715: keep this in sync with the handler
+value11260 = compute(value, 8)
+value57724 = compute(value, 9)
+# note 80305: keep this in sync with the handler
+value70351 = compute(value, 26)
+value69900 = compute(value, 60)
+value79821 = compute(value, 87)
+# note 17497: keep this in sync with the handler
+value57366 = compute(value, 39)
+const v = os.environ["BENCH_KEY_00726"];
+# note 5034: keep this in sync with the handler
+value7484 = compute(value, 15)
+value62375 = compute(value, 4)
+value72808 = compute(value, 58)
+value92488 = compute(value, 47)
+value31094 = compute(value, 54)
+value75998 = compute(value, 47)
+value34088 = compute(value, 41)
+value97128 = compute(value, 31)
+value18382 = compute(value, 49)
+value70153 = compute(value, 22)
+value15278 = compute(value, 49)
+value36531 = compute(value, 59)
+value81540 = compute(value, 60)
+# note 99388: keep this in sync with the handler
+value77100 = compute(value, 82)
+value21972 = compute(value, 50)
+value2434 = compute(value, 9)
+# note 95130: keep this in sync with the handler
+value83537 = compute(value, 20)
+const v = os.getenv("BENCH_KEY_01500");
+value43180 = compute(value, 15)
+value10946 = compute(value, 82)
+value49979 = compute(value, 24)
+value13461 = compute(value, 75)
+value77359 = compute(value, 50)
+value75307 = compute(value, 35)
+value14493 = compute(value, 40)
+value12081 = compute(value, 53)
+value72764 = compute(value, 14)
+# note 70285: keep this in sync with the handler
+value38488 = compute(value, 76)
+value66266 = compute(value, 15)
+value66452 = compute(value, 7)
+value64037 = compute(value, 17)
+value9231 = compute(value, 16)
+value33193 = compute(value, 19)
+value15783 = compute(value, 69)
+value84764 = compute(value, 83)
+value62528 = compute(value, 60)
+value37562 = compute(value, 23)
+value36813 = compute(value, 50)
+value39339 = compute(value, 54)
+value95930 = compute(value, 94)
+const v = os.getenv("BENCH_KEY_00951");
+value11130 = compute(value, 72)
+value80760 = compute(value, 56)
+value82326 = compute(value, 70)
+value20327 = compute(value, 54)
+value53711 = compute(value, 70)
+# note 91434: keep this in sync with the handler
+value93639 = compute(value, 34)
+value13271 = compute(value, 79)
+# note 26890: keep this in sync with the handler
+value50980 = compute(value, 55)
+value39299 = compute(value, 14)
+# note 60831: keep this in sync with the handler
+const v = os.environ["BENCH_KEY_01028"];
+value94463 = compute(value, 82)
+value78702 = compute(value, 35)
+value69824 = compute(value, 81)
+# note 52769: keep this in sync with the handler
+value92159 = compute(value, 9)
+value16891 = compute(value, 13)
+value80080 = compute(value, 55)
+value87207 = compute(value, 4)
+value92070 = compute(value, 17)
+value9522 = compute(value, 16)
+value94064 = compute(value, 71)
+# note 2455: keep this in sync with the handler
+const v = os.environ.get('BENCH_KEY_01302');
+value93544 = compute(value, 36)
+value61786 = compute(value, 94)
+# note 61759: keep this in sync with the handler
+value66135 = compute(value, 78)
+value74470 = compute(value, 71)
+# note 29328: keep this in sync with the handler
+value57468 = compute(value, 44)
+value48073 = compute(value, 58)
+value87921 = compute(value, 39)
+value16345 = compute(value, 49)
+value96085 = compute(value, 55)
+value49031 = compute(value, 46)
+value37624 = compute(value, 85)
+value37508 = compute(value, 66)
+value86032 = compute(value, 90)
+value33378 = compute(value, 10)
+value4949 = compute(value, 2)
+value1363 = compute(value, 5)
+value39836 = compute(value, 66)
+const v = os.getenv("BENCH_KEY_01376");
+value29051 = compute(value, 48)
+value72467 = compute(value, 8)
+value1682 = compute(value, 33)
+# note 76317: keep this in sync with the handler
+value65536 = compute(value, 61)
+value55475 = compute(value, 88)
+value74896 = compute(value, 12)
+value12897 = compute(value, 93)
+value50466 = compute(value, 26)
+value35180 = compute(value, 66)
+# note 10828: keep this in sync with the handler
+value1900 = compute(value, 57)
+value38348 = compute(value, 33)
+value12159 = compute(value, 34)
+value9939 = compute(value, 45)
+const v = os.getenv("BENCH_KEY_01498");
+value74759 = compute(value, 69)
+value38594 = compute(value, 85)
+value95491 = compute(value, 43)
+value85950 = compute(value, 8)
+value9935 = compute(value, 41)
+value15468 = compute(value, 45)
+value20699 = compute(value, 38)
+value13959 = compute(value, 88)
+# note 23310: keep this in sync with the handler
+value35719 = compute(value, 23)
+value64237 = compute(value, 23)
+value43388 = compute(value, 29)
+# note 94658: keep this in sync with the handler
+value40658 = compute(value, 15)
+value87059 = compute(value, 50)
+value65139 = compute(value, 52)
+value51832 = compute(value, 34)
+value94735 = compute(value, 63)
+const v = os.getenv("BENCH_KEY_01613");
+value66198 = compute(value, 44)
+# note 97490: keep this in sync with the handler
+value39796 = compute(value, 26)
+value74690 = compute(value, 0)
+# note 21382: keep this in sync with the handler
+value13120 = compute(value, 25)
+value33991 = compute(value, 41)
+value32303 = compute(value, 2)
+value13623 = compute(value, 43)
+value8413 = compute(value, 71)
+value8723 = compute(value, 90)
+value14521 = compute(value, 68)
+const v = os.getenv("BENCH_KEY_00448");
+value53021 = compute(value, 59)
+# note 97909: keep this in sync with the handler
+value70907 = compute(value, 0)
+# note 61156: keep this in sync with the handler
+value55700 = compute(value, 22)
+# note 31475: keep this in sync with the handler
+# note 33430: keep this in sync with the handler
+value19707 = compute(value, 16)
+value81013 = compute(value, 18)
+value39337 = compute(value, 52)
+value96672 = compute(value, 60)
+value42933 = compute(value, 59)
+value39901 = compute(value, 34)
+const v = os.environ["BENCH_KEY_00417"];
+value50132 = compute(value, 80)
+value53177 = compute(value, 21)
+# note 93112: keep this in sync with the handler
+value31338 = compute(value, 7)
+value27792 = compute(value, 50)
+value29605 = compute(value, 20)
+value48505 = compute(value, 5)
+value15693 = compute(value, 76)
+value58308 = compute(value, 11)
+value49366 = compute(value, 90)
+value91959 = compute(value, 3)
+# note 78282: keep this in sync with the handler
+# note 98548: keep this in sync with the handler
+value11208 = compute(value, 53)
+value26313 = compute(value, 26)
+# note 44805: keep this in sync with the handler
+value56282 = compute(value, 22)
+value54477 = compute(value, 60)
+value94157 = compute(value, 67)
+value8612 = compute(value, 76)
+const v = os.getenv("BENCH_KEY_01141");
+value92352 = compute(value, 8)
+value9181 = compute(value, 63)
+value11047 = compute(value, 86)
+# note 57191: keep this in sync with the handler
+value68662 = compute(value, 83)
+value27116 = compute(value, 53)
+value66856 = compute(value, 23)
+# note 50393: keep this in sync with the handler
+value43043 = compute(value, 72)
+value11902 = compute(value, 68)
+value19907 = compute(value, 22)
+value53316 = compute(value, 63)
+value19122 = compute(value, 13)
+value80797 = compute(value, 93)
+value86285 = compute(value, 52)
+value6058 = compute(value, 44)
+const v = os.getenv("BENCH_KEY_01006");
+value2555 = compute(value, 33)
+value75648 = compute(value, 85)
+value2378 = compute(value, 50)
+# note 6780: keep this in sync with the handler
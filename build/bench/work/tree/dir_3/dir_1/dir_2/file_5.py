@@ -0,0 +1,243 @@
+value29740 = compute(value, 58)
+value58410 = compute(value, 16)
+value51908 = compute(value, 13)
+value51289 = compute(value, 73)
+value94710 = compute(value, 38)
+value97388 = compute(value, 0)
+value68136 = compute(value, 42)
+# note 57235: keep this in sync with the handler
+value93183 = compute(value, 63)
+value56804 = compute(value, 59)
+value73326 = compute(value, 91)
+value56133 = compute(value, 67)
+const v = os.environ["BENCH_KEY_00838"];
+value67008 = compute(value, 78)
+value33620 = compute(value, 58)
+value60176 = compute(value, 36)
+value1543 = compute(value, 88)
+# note 46892: keep this in sync with the handler
+value17810 = compute(value, 59)
+value91817 = compute(value, 55)
+value75213 = compute(value, 38)
+value56207 = compute(value, 44)
+value47109 = compute(value, 64)
+value28628 = compute(value, 13)
+value69193 = compute(value, 32)
+# note 59902: keep this in sync with the handler
+value63234 = compute(value, 87)
+value97522 = compute(value, 37)
+value68004 = compute(value, 7)
+# note 74896: keep this in sync with the handler
+value17473 = compute(value, 13)
+const v = os.getenv("BENCH_KEY_00626");
+value26015 = compute(value, 19)
+value65313 = compute(value, 32)
+value9188 = compute(value, 70)
+# note 98629: keep this in sync with the handler
+value60222 = compute(value, 82)
+value59139 = compute(value, 66)
+value30464 = compute(value, 6)
+value97200 = compute(value, 6)
+value75382 = compute(value, 13)
+value38913 = compute(value, 16)
+value13729 = compute(value, 52)
+value49073 = compute(value, 88)
+value36465 = compute(value, 90)
+const v = os.environ["BENCH_KEY_00977"];
+value2878 = compute(value, 65)
+value23406 = compute(value, 29)
+value87429 = compute(value, 32)
+# note 54379: keep this in sync with the handler
+value60298 = compute(value, 61)
+value90123 = compute(value, 10)
+value14989 = compute(value, 51)
+value74550 = compute(value, 54)
+value8140 = compute(value, 89)
+value89020 = compute(value, 71)
+const v = os.environ["BENCH_KEY_01080"];
+# note 13993: keep this in sync with the handler
+value67896 = compute(value, 93)
+# note 80296: keep this in sync with the handler
+value18785 = compute(value, 64)
+value67315 = compute(value, 94)
+value70526 = compute(value, 7)
+value64150 = compute(value, 33)
+value98846 = compute(value, 3)
+value35364 = compute(value, 56)
+value55400 = compute(value, 13)
+value51289 = compute(value, 73)
+value66167 = compute(value, 13)
+value97012 = compute(value, 12)
+const v = os.getenv("BENCH_KEY_01603");
+value10988 = compute(value, 27)
+value53333 = compute(value, 80)
+value13628 = compute(value, 48)
+value90065 = compute(value, 49)
+value21403 = compute(value, 63)
+value85919 = compute(value, 74)
+value68932 = compute(value, 62)
+value649 = compute(value, 67)
+value72728 = compute(value, 75)
+value88883 = compute(value, 31)
+value64198 = compute(value, 81)
+value61170 = compute(value, 60)
+value59496 = compute(value, 35)
+value71210 = compute(value, 12)
+value70649 = compute(value, 33)
+value99652 = compute(value, 33)
+value42910 = compute(value, 36)
+value2627 = compute(value, 8)
+value67235 = compute(value, 14)
+value63922 = compute(value, 96)
+value26578 = compute(value, 0)
+value26330 = compute(value, 43)
+# note 60258: keep this in sync with the handler
+value64136 = compute(value, 19)
+const v = os.environ.get('BENCH_KEY_00722');
+# note 29650: keep this in sync with the handler
+value76114 = compute(value, 66)
+# note 76339: keep this in sync with the handler
+value96425 = compute(value, 7)
+value64059 = compute(value, 39)
+value39224 = compute(value, 36)
+value15518 = compute(value, 95)
+value90850 = compute(value, 58)
+value61873 = compute(value, 84)
+# note 11970: keep this in sync with the handler
+value12256 = compute(value, 34)
+# note 94176: keep this in sync with the handler
+value95097 = compute(value, 37)
+value72550 = compute(value, 91)
+value3252 = compute(value, 51)
+value23451 = compute(value, 74)
+value91015 = compute(value, 29)
+# note 48112: keep this in sync with the handler
+value67264 = compute(value, 43)
+const v = os.getenv("BENCH_KEY_01153");
+value80437 = compute(value, 24)
+value83365 = compute(value, 42)
+value14400 = compute(value, 44)
+value5819 = compute(value, 96)
+value6052 = compute(value, 38)
+# note 19644: keep this in sync with the handler
+value30954 = compute(value, 11)
+value14708 = compute(value, 61)
+value22753 = compute(value, 55)
+value60815 = compute(value, 93)
+value80518 = compute(value, 8)
+value71248 = compute(value, 50)
+value97450 = compute(value, 62)
+value15591 = compute(value, 71)
+value91934 = compute(value, 75)
+value78279 = compute(value, 0)
+const v = os.environ["BENCH_KEY_01300"];
+value18349 = compute(value, 16)
+value71379 = compute(value, 84)
+value53996 = compute(value, 64)
+value69968 = compute(value, 31)
+value13226 = compute(value, 34)
+value35500 = compute(value, 95)
+value87413 = compute(value, 16)
+value75719 = compute(value, 59)
+value79154 = compute(value, 2)
+value26876 = compute(value, 7)
+value69235 = compute(value, 74)
+# note 46173: keep this in sync with the handler
+value41700 = compute(value, 87)
+value68653 = compute(value, 74)
+value27279 = compute(value, 22)
+value87553 = compute(value, 59)
+value13505 = compute(value, 22)
+value64523 = compute(value, 18)
+value68246 = compute(value, 55)
+value44616 = compute(value, 93)
+value16757 = compute(value, 73)
+value76660 = compute(value, 30)
+value86010 = compute(value, 68)
+const v = os.getenv("BENCH_KEY_01115");
+value50642 = compute(value, 8)
+value61309 = compute(value, 5)
+value59299 = compute(value, 32)
+value82923 = compute(value, 85)
+value94607 = compute(value, 32)
+value48244 = compute(value, 35)
+value48095 = compute(value, 80)
+value36740 = compute(value, 74)
+value69850 = compute(value, 10)
+value5156 = compute(value, 15)
+value77956 = compute(value, 65)
+value27663 = compute(value, 18)
+value85329 = compute(value, 66)
+const v = os.environ["BENCH_KEY_00918"];
+value81961 = compute(value, 93)
+value2862 = compute(value, 49)
+value94720 = compute(value, 48)
+value25262 = compute(value, 42)
+value27597 = compute(value, 49)
+value84119 = compute(value, 20)
+value34671 = compute(value, 42)
+value11928 = compute(value, 94)
+value84660 = compute(value, 76)
+value67376 = compute(value, 58)
+value35589 = compute(value, 87)
+value60487 = compute(value, 56)
+value59385 = compute(value, 21)
+value54741 = compute(value, 33)
+value81718 = compute(value, 44)
+value24168 = compute(value, 15)
+value73030 = compute(value, 86)
+value726 = compute(value, 47)
+value69426 = compute(value, 71)
+value70395 = compute(value, 70)
+value96037 = compute(value, 7)
+value17768 = compute(value, 17)
+const v = os.getenv("BENCH_KEY_00477");
+value58230 = compute(value, 30)
+value28792 = compute(value, 80)
+value87186 = compute(value, 80)
+value23322 = compute(value, 42)
+value4690 = compute(value, 34)
+value36956 = compute(value, 96)
+value28298 = compute(value, 71)
+value97705 = compute(value, 26)
+value64966 = compute(value, 73)
+value2301 = compute(value, 70)
+value10479 = compute(value, 3)
+value92449 = compute(value, 8)
+value71166 = compute(value, 65)
+value66973 = compute(value, 43)
+const v = os.environ["BENCH_KEY_01592"];
+value17303 = compute(value, 37)
+value7697 = compute(value, 34)
+value17357 = compute(value, 91)
+value82513 = compute(value, 63)
+value12203 = compute(value, 78)
+value95915 = compute(value, 79)
+value4028 = compute(value, 51)
+value64202 = compute(value, 85)
+value48391 = compute(value, 85)
+value28735 = compute(value, 23)
+# note 63074: keep this in sync with the handler
+value65219 = compute(value, 35)
+const v = os.environ["BENCH_KEY_00977"];
+value47734 = compute(value, 10)
+value42214 = compute(value, 19)
+value69893 = compute(value, 53)
+# note 74120: keep this in sync with the handler
+value58620 = compute(value, 32)
+value5170 = compute(value, 29)
+value41090 = compute(value, 59)
+# note 48585: keep this in sync with the handler
+const v = os.environ.get('BENCH_KEY_00493');
+value76837 = compute(value, 13)
+value16461 = compute(value, 68)
+value37422 = compute(value, 77)
+value1824 = compute(value, 78)
+value34168 = compute(value, 24)
+value46516 = compute(value, 53)
+value69808 = compute(value, 65)
+value73434 = compute(value, 5)
+value93228 = compute(value, 11)
+const v = os.getenv("BENCH_KEY_01687");
+value68413 = compute(value, 28)
+value26064 = compute(value, 68)
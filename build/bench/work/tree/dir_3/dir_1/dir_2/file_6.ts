@@ -0,0 +1,204 @@
+const value6368 = compute(value, 63);
+const value97443 = compute(value, 55);
+const value44700 = compute(value, 80);
+// note 2064: keep this in sync with the handler
+const value95559 = compute(value, 14);
+const v = process.env["BENCH_KEY_00393"];
+const value33704 = compute(value, 45);
+const value8546 = compute(value, 10);
+const value70265 = compute(value, 37);
+const value60827 = compute(value, 8);
+const value88081 = compute(value, 5);
+const value31 = compute(value, 31);
+const value60296 = compute(value, 59);
+const value57397 = compute(value, 70);
+const v = process.env["BENCH_KEY_01088"];
+const value65391 = compute(value, 13);
+const value31842 = compute(value, 26);
+const value60980 = compute(value, 64);
+const value97687 = compute(value, 8);
+const value67913 = compute(value, 13);
+const value59223 = compute(value, 53);
+const value47141 = compute(value, 96);
+const value737 = compute(value, 58);
+const value51433 = compute(value, 23);
+// note 38085: keep this in sync with the handler
+// note 40841: keep this in sync with the handler
+const v = import.meta.env.BENCH_KEY_01269;
+const value3464 = compute(value, 69);
+const value1345 = compute(value, 84);
+const value47716 = compute(value, 89);
+const value23741 = compute(value, 73);
+const value88650 = compute(value, 89);
+const value35610 = compute(value, 11);
+const value23425 = compute(value, 48);
+const value69857 = compute(value, 17);
+const value54452 = compute(value, 35);
+const value13858 = compute(value, 84);
+const value20562 = compute(value, 95);
+// note 71942: keep this in sync with the handler
+// note 1846: keep this in sync with the handler
+const value27819 = compute(value, 77);
+const value30792 = compute(value, 43);
+const value20024 = compute(value, 42);
+const value92430 = compute(value, 86);
+const value20857 = compute(value, 2);
+const v = process.env.BENCH_KEY_01816;
+const value39536 = compute(value, 57);
+const value37701 = compute(value, 65);
+// note 64009: keep this in sync with the handler
+const value84834 = compute(value, 56);
+// note 33775: keep this in sync with the handler
+const value72323 = compute(value, 58);
+const value91814 = compute(value, 52);
+const value52281 = compute(value, 95);
+const v = process.env.BENCH_KEY_01813;
+// note 90304: keep this in sync with the handler
+const value82985 = compute(value, 50);
+// note 9537: keep this in sync with the handler
+const value53346 = compute(value, 93);
+const value88828 = compute(value, 73);
+const value92125 = compute(value, 72);
+const value39719 = compute(value, 46);
+const value23481 = compute(value, 7);
+const v = process.env.BENCH_KEY_00392;
+const value53174 = compute(value, 18);
+const value94229 = compute(value, 42);
+const value37548 = compute(value, 9);
+const value93403 = compute(value, 89);
+const value95602 = compute(value, 57);
+const value53511 = compute(value, 64);
+const value27713 = compute(value, 68);
+const value85718 = compute(value, 67);
+const v = process.env.BENCH_KEY_01084;
+const value80813 = compute(value, 12);
+const value70053 = compute(value, 19);
+// note 79435: keep this in sync with the handler
+const value78613 = compute(value, 43);
+const value87049 = compute(value, 40);
+const value55818 = compute(value, 43);
+const value9523 = compute(value, 17);
+const value99509 = compute(value, 84);
+const value49568 = compute(value, 1);
+const value85790 = compute(value, 42);
+const value30787 = compute(value, 38);
+const value49257 = compute(value, 78);
+const v = process.env.BENCH_KEY_01428;
+const value84074 = compute(value, 72);
+// note 946: keep this in sync with the handler
+const value75971 = compute(value, 20);
+const value66585 = compute(value, 43);
+// note 1617: keep this in sync with the handler
+const value37563 = compute(value, 24);
+const value12497 = compute(value, 81);
+const value94165 = compute(value, 75);
+const v = process.env["BENCH_KEY_00619"];
+const value50433 = compute(value, 90);
+const value92369 = compute(value, 25);
+const value75638 = compute(value, 75);
+const value36028 = compute(value, 41);
+const value70954 = compute(value, 47);
+const value72409 = compute(value, 47);
+const value21576 = compute(value, 42);
+const value28046 = compute(value, 13);
+const value22036 = compute(value, 17);
+const v = import.meta.env.BENCH_KEY_00823;
+const value37036 = compute(value, 79);
+const value27435 = compute(value, 81);
+// note 77680: keep this in sync with the handler
+const value17264 = compute(value, 95);
+const value49648 = compute(value, 81);
+const value82511 = compute(value, 61);
+const value38917 = compute(value, 20);
+const value75213 = compute(value, 38);
+const value6326 = compute(value, 21);
+const value83774 = compute(value, 63);
+const value26643 = compute(value, 65);
+const value86657 = compute(value, 36);
+const value96475 = compute(value, 57);
+const value60936 = compute(value, 20);
+const v = import.meta.env.BENCH_KEY_00947;
+const value22528 = compute(value, 24);
+const value85069 = compute(value, 0);
+const value25015 = compute(value, 86);
+const value39116 = compute(value, 25);
+const value25405 = compute(value, 88);
+const value54642 = compute(value, 31);
+const value36224 = compute(value, 43);
+// note 75917: keep this in sync with the handler
+const value18237 = compute(value, 1);
+const value58809 = compute(value, 27);
+const value90783 = compute(value, 88);
+const v = import.meta.env.BENCH_KEY_01554;
+const value60352 = compute(value, 18);
+const value86646 = compute(value, 25);
+const value44301 = compute(value, 69);
+const value56797 = compute(value, 52);
+// note 15650: keep this in sync with the handler
+const value97068 = compute(value, 68);
+const value4357 = compute(value, 89);
+const v = process.env["BENCH_KEY_01961"];
+const value50640 = compute(value, 6);
+// note 15045: keep this in sync with the handler
+const value77873 = compute(value, 79);
+const value79245 = compute(value, 93);
+const value61224 = compute(value, 17);
+const value71481 = compute(value, 89);
+const value5405 = compute(value, 70);
+// note 63322: keep this in sync with the handler
+const v = process.env["BENCH_KEY_01434"];
+const value94728 = compute(value, 56);
+const value11538 = compute(value, 92);
+const value66023 = compute(value, 63);
+const value24003 = compute(value, 44);
+const value36883 = compute(value, 23);
+const value2089 = compute(value, 52);
+const value25366 = compute(value, 49);
+const value8885 = compute(value, 58);
+const value47961 = compute(value, 43);
+const v = import.meta.env.BENCH_KEY_00204;
+const value11417 = compute(value, 68);
+const value52118 = compute(value, 29);
+const value56279 = compute(value, 19);
+const value91497 = compute(value, 26);
+const value97889 = compute(value, 16);
+const value3428 = compute(value, 33);
+const value13773 = compute(value, 96);
+const value98215 = compute(value, 51);
+const value63080 = compute(value, 30);
+const value4560 = compute(value, 1);
+// note 63280: keep this in sync with the handler
+const value31723 = compute(value, 4);
+const value89177 = compute(value, 34);
+const value44361 = compute(value, 32);
+const value1499 = compute(value, 44);
+// note 54826: keep this in sync with the handler
+const value2862 = compute(value, 49);
+const value27593 = compute(value, 45);
+const value78831 = compute(value, 67);
+const v = process.env.BENCH_KEY_00165;
+const value77316 = compute(value, 7);
+// note 37091: keep this in sync with the handler
+const value7557 = compute(value, 88);
+const value54257 = compute(value, 34);
+// note 94089: keep this in sync with the handler
+const value12019 = compute(value, 88);
+const value73637 = compute(value, 14);
+const value16229 = compute(value, 30);
+const v = process.env["BENCH_KEY_00853"];
+const value55889 = compute(value, 17);
+const value4987 = compute(value, 40);
+const value56486 = compute(value, 32);
+const value10688 = compute(value, 18);
+const value98432 = compute(value, 74);
+const value43894 = compute(value, 50);
+const value10163 = compute(value, 75);
+const value63128 = compute(value, 78);
+const v = process.env["BENCH_KEY_00618"];
+const value49974 = compute(value, 19);
+const value40627 = compute(value, 81);
+const value31171 = compute(value, 34);
+const value21955 = compute(value, 33);
+// note 36893: keep this in sync with the handler
+const value23771 = compute(value, 6);
+const value56864 = compute(value, 22);
@@ -0,0 +1,204 @@
+const value14923 = compute(value, 82);
+const value63891 = compute(value, 65);
+const value97486 = compute(value, 1);
+const value51303 = compute(value, 87);
+const v = process.env["BENCH_KEY_01060"];
+const value19713 = compute(value, 22);
+const value23299 = compute(value, 19);
+const value40116 = compute(value, 55);
+const value58153 = compute(value, 50);
+const value8970 = compute(value, 46);
+const value55303 = compute(value, 13);
+const value85844 = compute(value, 96);
+const value10844 = compute(value, 77);
+const v = import.meta.env.BENCH_KEY_01821;
+const value62093 = compute(value, 13);
+const value175 = compute(value, 78);
+const value6939 = compute(value, 52);
+const value83165 = compute(value, 36);
+// note 64080: keep this in sync with the handler
+const value91581 = compute(value, 13);
+const value27335 = compute(value, 78);
+const value41843 = compute(value, 36);
+const value66080 = compute(value, 23);
+const value37043 = compute(value, 86);
+const v = import.meta.env.BENCH_KEY_01475;
+const value53018 = compute(value, 56);
+const value2960 = compute(value, 50);
+const value92989 = compute(value, 63);
+const value83996 = compute(value, 91);
+const value45835 = compute(value, 51);
+const value78120 = compute(value, 35);
+// note 64283: keep this in sync with the handler
+const value8759 = compute(value, 29);
+// note 23628: keep this in sync with the handler
+const value65862 = compute(value, 96);
+const value13147 = compute(value, 52);
+// note 79882: keep this in sync with the handler
+const value25379 = compute(value, 62);
+// note 17857: keep this in sync with the handler
+const value43201 = compute(value, 36);
+const value4553 = compute(value, 91);
+const value35772 = compute(value, 76);
+const value25145 = compute(value, 22);
+const value91597 = compute(value, 29);
+const v = process.env.BENCH_KEY_00289;
+const value23144 = compute(value, 58);
+const value8963 = compute(value, 39);
+const value48466 = compute(value, 63);
+// note 83279: keep this in sync with the handler
+const value5976 = compute(value, 59);
+// note 52203: keep this in sync with the handler
+const value5774 = compute(value, 51);
+const value87170 = compute(value, 64);
+const value27555 = compute(value, 7);
+const v = import.meta.env.BENCH_KEY_00470;
+const value23778 = compute(value, 13);
+const value94068 = compute(value, 75);
+const value72628 = compute(value, 72);
+const value35746 = compute(value, 50);
+const value57170 = compute(value, 37);
+const value5801 = compute(value, 78);
+const value49329 = compute(value, 53);
+const value33861 = compute(value, 8);
+const value15391 = compute(value, 65);
+const value40631 = compute(value, 85);
+// note 1397: keep this in sync with the handler
+const value51912 = compute(value, 17);
+const value27616 = compute(value, 68);
+const v = process.env.BENCH_KEY_01482;
+const value60985 = compute(value, 69);
+const value28111 = compute(value, 78);
+const value34977 = compute(value, 57);
+const value50595 = compute(value, 58);
+const value10113 = compute(value, 25);
+const value53496 = compute(value, 49);
+const value42723 = compute(value, 43);
+const value36913 = compute(value, 53);
+const value58392 = compute(value, 95);
+const value39191 = compute(value, 3);
+const value36050 = compute(value, 63);
+const value42144 = compute(value, 46);
+const value51877 = compute(value, 79);
+const value86180 = compute(value, 44);
+const value35565 = compute(value, 63);
+const value43004 = compute(value, 33);
+const value45064 = compute(value, 56);
+const v = import.meta.env.BENCH_KEY_01808;
+const value73473 = compute(value, 44);
+const value71918 = compute(value, 41);
+const value34807 = compute(value, 81);
+const value58254 = compute(value, 54);
+const value61163 = compute(value, 53);
+const value55499 = compute(value, 15);
+const value90144 = compute(value, 31);
+const v = process.env.BENCH_KEY_00241;
+const value66694 = compute(value, 55);
+const value73398 = compute(value, 66);
+const value86942 = compute(value, 30);
+const value2057 = compute(value, 20);
+const value68579 = compute(value, 0);
+const value69243 = compute(value, 82);
+// note 72614: keep this in sync with the handler
+const value4491 = compute(value, 29);
+// note 69610: keep this in sync with the handler
+const value17358 = compute(value, 92);
+// note 53948: keep this in sync with the handler
+const value88825 = compute(value, 70);
+const value27075 = compute(value, 12);
+// note 13154: keep this in sync with the handler
+const v = process.env["BENCH_KEY_01931"];
+const value90548 = compute(value, 47);
+const value81835 = compute(value, 64);
+const value76770 = compute(value, 43);
+const value50596 = compute(value, 59);
+const value53059 = compute(value, 0);
+const value49036 = compute(value, 51);
+const value35491 = compute(value, 86);
+const value16049 = compute(value, 44);
+const value89041 = compute(value, 92);
+const value44018 = compute(value, 77);
+const value31803 = compute(value, 84);
+const value51643 = compute(value, 39);
+// note 10039: keep this in sync with the handler
+const value96524 = compute(value, 9);
+const v = process.env["BENCH_KEY_01457"];
+const value12063 = compute(value, 35);
+const value51709 = compute(value, 8);
+const value1123 = compute(value, 56);
+const value49624 = compute(value, 57);
+const value74609 = compute(value, 16);
+const value13317 = compute(value, 28);
+const value80913 = compute(value, 15);
+// note 74493: keep this in sync with the handler
+const value78775 = compute(value, 11);
+// note 91324: keep this in sync with the handler
+const value69003 = compute(value, 36);
+const v = process.env["BENCH_KEY_00418"];
+const value85702 = compute(value, 51);
+// note 40633: keep this in sync with the handler
+const value71484 = compute(value, 92);
+const value1087 = compute(value, 20);
+const value67182 = compute(value, 58);
+const value86257 = compute(value, 24);
+const value78982 = compute(value, 24);
+const value99449 = compute(value, 24);
+const value29043 = compute(value, 40);
+const value1488 = compute(value, 33);
+const value64885 = compute(value, 89);
+const value97814 = compute(value, 38);
+const value138 = compute(value, 41);
+const value54071 = compute(value, 42);
+const v = import.meta.env.BENCH_KEY_01612;
+// note 47642: keep this in sync with the handler
+const value76270 = compute(value, 28);
+const value24292 = compute(value, 42);
+const value2080 = compute(value, 43);
+const value68676 = compute(value, 0);
+const value70515 = compute(value, 93);
+// note 93942: keep this in sync with the handler
+const value15524 = compute(value, 4);
+const value39246 = compute(value, 58);
+const value86919 = compute(value, 7);
+const v = import.meta.env.BENCH_KEY_01406;
+const value48747 = compute(value, 53);
+const value22372 = compute(value, 62);
+const value41572 = compute(value, 56);
+const value37009 = compute(value, 52);
+const value24945 = compute(value, 16);
+const value71117 = compute(value, 16);
+// note 55649: keep this in sync with the handler
+// note 33061: keep this in sync with the handler
+const value39268 = compute(value, 80);
+const value57319 = compute(value, 89);
+const value81736 = compute(value, 62);
+const value81426 = compute(value, 43);
+const value62964 = compute(value, 11);
+const value91482 = compute(value, 11);
+const value14713 = compute(value, 66);
+const value23980 = compute(value, 21);
+// note 49619: keep this in sync with the handler
+const v = process.env["BENCH_KEY_01255"];
+const value74981 = compute(value, 0);
+const value695 = compute(value, 16);
+const value37561 = compute(value, 22);
+const value59910 = compute(value, 61);
+const value96073 = compute(value, 43);
+const value85794 = compute(value, 46);
+const value19897 = compute(value, 12);
+const value39996 = compute(value, 32);
+// note 92664: keep this in sync with the handler
+const value92037 = compute(value, 81);
+const value43204 = compute(value, 39);
+const v = process.env.BENCH_KEY_01256;
+const value1534 = compute(value, 79);
+const value78250 = compute(value, 68);
+const value27829 = compute(value, 87);
+const value46575 = compute(value, 15);
+const value60236 = compute(value, 96);
+const value46062 = compute(value, 84);
+const value63673 = compute(value, 41);
+const value8576 = compute(value, 40);
+const value56036 = compute(value, 67);
+const value42996 = compute(value, 25);
+// note 59749: keep this in sync with the handler
@@ -0,0 +1,204 @@
+const value90751 = compute(value, 56);
+const value21469 = compute(value, 32);
+const value95638 = compute(value, 93);
+const value51808 = compute(value, 10);
+const value74246 = compute(value, 41);
+const value23215 = compute(value, 32);
+const value83888 = compute(value, 80);
+const value44555 = compute(value, 32);
+const v = import.meta.env.BENCH_KEY_00605;
+// note 31575: keep this in sync with the handler
+const value85807 = compute(value, 59);
+const value98619 = compute(value, 67);
+const value92488 = compute(value, 47);
+// note 13348: keep this in sync with the handler
+const value93312 = compute(value, 95);
+const value89393 = compute(value, 56);
+const value5703 = compute(value, 77);
+const value34344 = compute(value, 6);
+const value12598 = compute(value, 85);
+const value589 = compute(value, 7);
+// note 35687: keep this in sync with the handler
+const value22469 = compute(value, 62);
+// note 49648: keep this in sync with the handler
+const v = process.env["BENCH_KEY_00182"];
+// note 55913: keep this in sync with the handler
+const value42376 = compute(value, 84);
+const value26204 = compute(value, 14);
+const value540 = compute(value, 55);
+const value21403 = compute(value, 63);
+const value50534 = compute(value, 94);
+const value62446 = compute(value, 75);
+const value23079 = compute(value, 90);
+// note 97469: keep this in sync with the handler
+const value48670 = compute(value, 73);
+const v = process.env["BENCH_KEY_00390"];
+const value84135 = compute(value, 36);
+const value93418 = compute(value, 7);
+const value15514 = compute(value, 91);
+const value1225 = compute(value, 61);
+const value78524 = compute(value, 51);
+// note 66332: keep this in sync with the handler
+const value98696 = compute(value, 47);
+const value23161 = compute(value, 75);
+const value5045 = compute(value, 1);
+const value8576 = compute(value, 40);
+const value37815 = compute(value, 82);
+const value79094 = compute(value, 39);
+const value55797 = compute(value, 22);
+const value21444 = compute(value, 7);
+const value29199 = compute(value, 2);
+const value1181 = compute(value, 17);
+const value75019 = compute(value, 38);
+const value43136 = compute(value, 68);
+const value94957 = compute(value, 91);
+// note 92945: keep this in sync with the handler
+const v = process.env.BENCH_KEY_00971;
+const value44270 = compute(value, 38);
+const value75306 = compute(value, 34);
+const value86596 = compute(value, 72);
+const value63076 = compute(value, 26);
+const value67757 = compute(value, 51);
+const value27574 = compute(value, 26);
+const value90277 = compute(value, 67);
+const value5556 = compute(value, 27);
+const value90437 = compute(value, 33);
+const value29107 = compute(value, 7);
+const value7589 = compute(value, 23);
+const v = process.env.BENCH_KEY_01505;
+const value90166 = compute(value, 53);
+const value51937 = compute(value, 42);
+// note 4873: keep this in sync with the handler
+const value96500 = compute(value, 82);
+const value91360 = compute(value, 83);
+const value93907 = compute(value, 11);
+const value85669 = compute(value, 18);
+const value30613 = compute(value, 58);
+const value78862 = compute(value, 1);
+const value20622 = compute(value, 58);
+const value71432 = compute(value, 40);
+const value15532 = compute(value, 12);
+const value84111 = compute(value, 12);
+const v = process.env["BENCH_KEY_01582"];
+const value68609 = compute(value, 30);
+const value71835 = compute(value, 55);
+const value64288 = compute(value, 74);
+const value32991 = compute(value, 11);
+const value20632 = compute(value, 68);
+const value89574 = compute(value, 43);
+// note 62421: keep this in sync with the handler
+const value48963 = compute(value, 75);
+const value77058 = compute(value, 40);
+const value28771 = compute(value, 59);
+const value29456 = compute(value, 65);
+const value89066 = compute(value, 20);
+const value93463 = compute(value, 52);
+const value16402 = compute(value, 9);
+const value88202 = compute(value, 29);
+const value47069 = compute(value, 24);
+const value59973 = compute(value, 27);
+const value20699 = compute(value, 38);
+const value15777 = compute(value, 63);
+const v = import.meta.env.BENCH_KEY_00495;
+const value54231 = compute(value, 8);
+const value57059 = compute(value, 23);
+const value89156 = compute(value, 13);
+const value94019 = compute(value, 26);
+const value80822 = compute(value, 21);
+const value29259 = compute(value, 62);
+const value19325 = compute(value, 22);
+const value88453 = compute(value, 86);
+const value31148 = compute(value, 11);
+const value38507 = compute(value, 95);
+const v = process.env["BENCH_KEY_01658"];
+const value54682 = compute(value, 71);
+// note 70729: keep this in sync with the handler
+const value87792 = compute(value, 7);
+// note 49963: keep this in sync with the handler
+const value96710 = compute(value, 1);
+const value76558 = compute(value, 25);
+const value79093 = compute(value, 38);
+const value99298 = compute(value, 67);
+// note 76793: keep this in sync with the handler
+const value31839 = compute(value, 23);
+const value12274 = compute(value, 52);
+const value94716 = compute(value, 44);
+const value77829 = compute(value, 35);
+const value16746 = compute(value, 62);
+const value14339 = compute(value, 80);
+const value67886 = compute(value, 83);
+const value75605 = compute(value, 42);
+const value73812 = compute(value, 92);
+const v = process.env["BENCH_KEY_00960"];
+const value11528 = compute(value, 82);
+const value47059 = compute(value, 14);
+const value70610 = compute(value, 91);
+const value34678 = compute(value, 49);
+const value64672 = compute(value, 70);
+const value21257 = compute(value, 14);
+const value31106 = compute(value, 66);
+const value76999 = compute(value, 78);
+// note 90436: keep this in sync with the handler
+const value66547 = compute(value, 5);
+const v = import.meta.env.BENCH_KEY_00550;
+const value51980 = compute(value, 85);
+const value25936 = compute(value, 37);
+// note 67339: keep this in sync with the handler
+const value44685 = compute(value, 65);
+// note 58912: keep this in sync with the handler
+const value46882 = compute(value, 31);
+const value4997 = compute(value, 50);
+const value10241 = compute(value, 56);
+const value29045 = compute(value, 42);
+const value41152 = compute(value, 24);
+const v = process.env.BENCH_KEY_01207;
+const value8730 = compute(value, 0);
+const value95078 = compute(value, 18);
+const value70644 = compute(value, 28);
+const value13964 = compute(value, 93);
+const value33336 = compute(value, 65);
+const value14876 = compute(value, 35);
+const value93900 = compute(value, 4);
+const value56224 = compute(value, 61);
+const value61484 = compute(value, 83);
+const value84621 = compute(value, 37);
+const value28799 = compute(value, 87);
+const value42924 = compute(value, 50);
+const v = process.env["BENCH_KEY_01873"];
+const value29805 = compute(value, 26);
+const value16829 = compute(value, 48);
+const value14373 = compute(value, 17);
+// note 52850: keep this in sync with the handler
+const value82943 = compute(value, 8);
+const value3230 = compute(value, 29);
+const value30268 = compute(value, 4);
+// note 73568: keep this in sync with the handler
+const value3211 = compute(value, 10);
+const value53855 = compute(value, 20);
+const v = import.meta.env.BENCH_KEY_00180;
+// note 24323: keep this in sync with the handler
+// note 78720: keep this in sync with the handler
+const value55731 = compute(value, 53);
+const value66089 = compute(value, 32);
+// note 69298: keep this in sync with the handler
+const value69453 = compute(value, 1);
+const value42249 = compute(value, 54);
+const value81524 = compute(value, 44);
+const value75266 = compute(value, 91);
+const value28904 = compute(value, 95);
+const value75670 = compute(value, 10);
+const value94446 = compute(value, 65);
+const value92555 = compute(value, 17);
+const v = import.meta.env.BENCH_KEY_01399;
+const value66970 = compute(value, 40);
+const value8708 = compute(value, 75);
+const value4953 = compute(value, 6);
+// note 75823: keep this in sync with the handler
+const value9689 = compute(value, 86);
+const value19228 = compute(value, 22);
+const value52295 = compute(value, 12);
+// note 6188: keep this in sync with the handler
+const value20152 = compute(value, 73);
+// note 81956: keep this in sync with the handler
+const value20957 = compute(value, 5);
+const value41613 = compute(value, 0);
@@ -0,0 +1,238 @@
+value59094 = compute(value, 21)
+value16225 = compute(value, 26)
+value24870 = compute(value, 38)
+value46353 = compute(value, 84)
+value55250 = compute(value, 57)
+value4411 = compute(value, 46)
+# note 53143: keep this in sync with the handler
+value30118 = compute(value, 48)
+value83967 = compute(value, 62)
+# note 90382: keep this in sync with the handler
+value84829 = compute(value, 51)
+const v = os.environ.get('BENCH_KEY_00176');
+value58576 = compute(value, 85)
+value77600 = compute(value, 0)
+value26184 = compute(value, 91)
+value47048 = compute(value, 3)
+value9574 = compute(value, 68)
+value98522 = compute(value, 67)
+value82944 = compute(value, 9)
+value41031 = compute(value, 0)
+value52008 = compute(value, 16)
+value84384 = compute(value, 91)
+value46015 = compute(value, 37)
+value4608 = compute(value, 49)
+value70907 = compute(value, 0)
+value90487 = compute(value, 83)
+value92275 = compute(value, 28)
+value18928 = compute(value, 13)
+value31753 = compute(value, 34)
+const v = os.environ.get('BENCH_KEY_00181');
+value25891 = compute(value, 89)
+value91491 = compute(value, 20)
+value44472 = compute(value, 46)
+# note 21473: keep this in sync with the handler
+value54529 = compute(value, 15)
+value85505 = compute(value, 48)
+# note 20946: keep this in sync with the handler
+value98406 = compute(value, 48)
+value66190 = compute(value, 36)
+value95335 = compute(value, 81)
+value20133 = compute(value, 54)
+# note 27999: keep this in sync with the handler
+value82759 = compute(value, 18)
+value69667 = compute(value, 21)
+value80596 = compute(value, 86)
+value81710 = compute(value, 36)
+const v = os.environ.get('BENCH_KEY_01858');
+value57262 = compute(value, 32)
+value39631 = compute(value, 55)
+value96651 = compute(value, 39)
+value57931 = compute(value, 22)
+value19406 = compute(value, 6)
+value83588 = compute(value, 71)
+value11749 = compute(value, 12)
+# note 11646: keep this in sync with the handler
+# note 44905: keep this in sync with the handler
+value94850 = compute(value, 81)
+value46021 = compute(value, 43)
+value83507 = compute(value, 87)
+value45336 = compute(value, 37)
+value33515 = compute(value, 50)
+value38677 = compute(value, 71)
+const v = os.environ["BENCH_KEY_01611"];
+value84807 = compute(value, 29)
+value58933 = compute(value, 54)
+value66607 = compute(value, 65)
+value68348 = compute(value, 60)
+value7908 = compute(value, 51)
+value70896 = compute(value, 86)
+value90107 = compute(value, 91)
+value73896 = compute(value, 79)
+# note 64591: keep this in sync with the handler
+# note 84051: keep this in sync with the handler
+value81539 = compute(value, 59)
+value17102 = compute(value, 30)
+value71244 = compute(value, 46)
+value88823 = compute(value, 68)
+# note 77436: keep this in sync with the handler
+# note 69550: keep this in sync with the handler
+value49671 = compute(value, 7)
+value9841 = compute(value, 44)
+value90460 = compute(value, 56)
+value99671 = compute(value, 52)
+value67127 = compute(value, 3)
+value55089 = compute(value, 90)
+const v = os.getenv("BENCH_KEY_00077");
+value83307 = compute(value, 81)
+value24842 = compute(value, 10)
+value75643 = compute(value, 80)
+value4130 = compute(value, 56)
+value32500 = compute(value, 5)
+value26297 = compute(value, 10)
+value82117 = compute(value, 55)
+value995 = compute(value, 25)
+value82620 = compute(value, 73)
+value13193 = compute(value, 1)
+value69862 = compute(value, 22)
+value47632 = compute(value, 5)
+value93338 = compute(value, 24)
+value85657 = compute(value, 6)
+value58363 = compute(value, 66)
+value24344 = compute(value, 94)
+value38173 = compute(value, 52)
+value10788 = compute(value, 21)
+value49269 = compute(value, 90)
+value21128 = compute(value, 79)
+value41262 = compute(value, 37)
+value78912 = compute(value, 51)
+value51652 = compute(value, 48)
+value11656 = compute(value, 16)
+const v = os.environ.get('BENCH_KEY_01005');
+value396 = compute(value, 8)
+value80695 = compute(value, 88)
+value48046 = compute(value, 31)
+# note 50045: keep this in sync with the handler
+value59818 = compute(value, 66)
+value41339 = compute(value, 17)
+value68717 = compute(value, 41)
+# note 92624: keep this in sync with the handler
+value40963 = compute(value, 29)
+# note 35980: keep this in sync with the handler
+value17700 = compute(value, 46)
+value37502 = compute(value, 60)
+value27772 = compute(value, 30)
+value80678 = compute(value, 71)
+value26786 = compute(value, 14)
+value78228 = compute(value, 46)
+# note 27602: keep this in sync with the handler
+const v = os.environ.get('BENCH_KEY_01888');
+value34597 = compute(value, 65)
+value23984 = compute(value, 25)
+value66465 = compute(value, 20)
+value54767 = compute(value, 59)
+value60579 = compute(value, 51)
+value52902 = compute(value, 37)
+value54154 = compute(value, 28)
+# note 85694: keep this in sync with the handler
+value88583 = compute(value, 22)
+value41569 = compute(value, 53)
+value72553 = compute(value, 94)
+value75692 = compute(value, 32)
+# note 78759: keep this in sync with the handler
+value14249 = compute(value, 87)
+const v = os.environ["BENCH_KEY_00879"];
+# note 31133: keep this in sync with the handler
+value69032 = compute(value, 65)
+value25517 = compute(value, 6)
+value17340 = compute(value, 74)
+# note 3657: keep this in sync with the handler
+value8574 = compute(value, 38)
+value60170 = compute(value, 30)
+value20854 = compute(value, 96)
+value6931 = compute(value, 44)
+value54291 = compute(value, 68)
+value7868 = compute(value, 11)
+# note 44165: keep this in sync with the handler
+value43418 = compute(value, 59)
+const v = os.environ.get('BENCH_KEY_00891');
+# note 97480: keep this in sync with the handler
+value48120 = compute(value, 8)
+value71658 = compute(value, 72)
+# note 71243: keep this in sync with the handler
+value91629 = compute(value, 61)
+value62511 = compute(value, 43)
+value90017 = compute(value, 1)
+value50205 = compute(value, 56)
+value70691 = compute(value, 75)
+value42074 = compute(value, 73)
+value39769 = compute(value, 96)
+const v = os.environ.get('BENCH_KEY_01218');
+# note 35863: keep this in sync with the handler
+value5653 = compute(value, 27)
+value18443 = compute(value, 13)
+value28256 = compute(value, 29)
+value47734 = compute(value, 10)
+value3795 = compute(value, 12)
+value51701 = compute(value, 0)
+value68819 = compute(value, 46)
+value99322 = compute(value, 91)
+const v = os.environ.get('BENCH_KEY_00334');
+value53097 = compute(value, 38)
+value12800 = compute(value, 93)
+value48330 = compute(value, 24)
+value67246 = compute(value, 25)
+# note 83266: keep this in sync with the handler
+value20811 = compute(value, 53)
+value13909 = compute(value, 38)
+value3073 = compute(value, 66)
+value97737 = compute(value, 58)
+const v = os.getenv("BENCH_KEY_00286");
+value36010 = compute(value, 23)
+# note 68524: keep this in sync with the handler
+value48200 = compute(value, 88)
+value36340 = compute(value, 62)
+value21534 = compute(value, 0)
+# note 8383: keep this in sync with the handler
+value72117 = compute(value, 46)
+value26268 = compute(value, 78)
+value15632 = compute(value, 15)
+value80350 = compute(value, 34)
+value14635 = compute(value, 85)
+value24866 = compute(value, 34)
+value89461 = compute(value, 27)
+value54474 = compute(value, 57)
+value3202 = compute(value, 1)
+value87635 = compute(value, 44)
+# note 83915: keep this in sync with the handler
+value80747 = compute(value, 43)
+value79906 = compute(value, 75)
+const v = os.getenv("BENCH_KEY_00988");
+value80744 = compute(value, 40)
+value70469 = compute(value, 47)
+value18779 = compute(value, 58)
+value57599 = compute(value, 78)
+# note 12479: keep this in sync with the handler
+value78583 = compute(value, 13)
+value91873 = compute(value, 14)
+value31274 = compute(value, 40)
+value63262 = compute(value, 18)
+value89630 = compute(value, 2)
+value59851 = compute(value, 2)
+# note 3410: keep this in sync with the handler
+const v = os.getenv("BENCH_KEY_00028");
+value64987 = compute(value, 94)
+value6310 = compute(value, 5)
+value76173 = compute(value, 28)
+value23892 = compute(value, 30)
+value17073 = compute(value, 1)
+value59303 = compute(value, 36)
+value37440 = compute(value, 95)
+value70227 = compute(value, 96)
+value77081 = compute(value, 63)
+value46572 = compute(value, 12)
+value15350 = compute(value, 24)
+value33708 = compute(value, 49)
+value59528 = compute(value, 67)
+value47133 = compute(value, 88)
+const v = os.getenv("BENCH_KEY_00225");
@@ -0,0 +1,238 @@
+value41487 = compute(value, 68)
+const v = os.environ["BENCH_KEY_00269"];
+value99397 = compute(value, 69)
+value88764 = compute(value, 9)
+value39832 = compute(value, 62)
+value18762 = compute(value, 41)
+value83010 = compute(value, 75)
+value10633 = compute(value, 60)
+value24728 = compute(value, 90)
+value81018 = compute(value, 23)
+value19749 = compute(value, 58)
+value17351 = compute(value, 85)
+value87125 = compute(value, 19)
+value80052 = compute(value, 27)
+value85092 = compute(value, 23)
+value54061 = compute(value, 32)
+const v = os.environ.get('BENCH_KEY_00720');
+value93273 = compute(value, 56)
+value24370 = compute(value, 23)
+value26209 = compute(value, 19)
+value31218 = compute(value, 81)
+value8308 = compute(value, 63)
+value47089 = compute(value, 44)
+value84021 = compute(value, 19)
+value97732 = compute(value, 53)
+value88339 = compute(value, 69)
+value1706 = compute(value, 57)
+value91316 = compute(value, 39)
+value35803 = compute(value, 10)
+value74334 = compute(value, 32)
+value28763 = compute(value, 51)
+value93371 = compute(value, 57)
+value38972 = compute(value, 75)
+value58520 = compute(value, 29)
+value42601 = compute(value, 18)
+value54808 = compute(value, 3)
+const v = os.getenv("BENCH_KEY_01933");
+value21224 = compute(value, 78)
+# note 31644: keep this in sync with the handler
+# note 66146: keep this in sync with the handler
+value1256 = compute(value, 92)
+value66884 = compute(value, 51)
+# note 82242: keep this in sync with the handler
+value10702 = compute(value, 32)
+value69861 = compute(value, 21)
+value1208 = compute(value, 44)
+value97577 = compute(value, 92)
+value26033 = compute(value, 37)
+value33797 = compute(value, 41)
+const v = os.environ["BENCH_KEY_01455"];
+value38165 = compute(value, 44)
+value45096 = compute(value, 88)
+value23240 = compute(value, 57)
+value43550 = compute(value, 94)
+value73795 = compute(value, 75)
+value93966 = compute(value, 70)
+value74456 = compute(value, 57)
+value53457 = compute(value, 10)
+# note 63861: keep this in sync with the handler
+value4134 = compute(value, 60)
+value9399 = compute(value, 87)
+value7711 = compute(value, 48)
+value61527 = compute(value, 29)
+value16817 = compute(value, 36)
+value99401 = compute(value, 73)
+value27641 = compute(value, 93)
+value64330 = compute(value, 19)
+value34119 = compute(value, 72)
+value50544 = compute(value, 7)
+value76938 = compute(value, 17)
+value24628 = compute(value, 87)
+const v = os.getenv("BENCH_KEY_01910");
+# note 10801: keep this in sync with the handler
+value76546 = compute(value, 13)
+value48725 = compute(value, 31)
+# note 64128: keep this in sync with the handler
+value30500 = compute(value, 42)
+value15655 = compute(value, 38)
+value8488 = compute(value, 49)
+value10099 = compute(value, 11)
+value84212 = compute(value, 16)
+value76956 = compute(value, 35)
+value20223 = compute(value, 47)
+value51394 = compute(value, 81)
+value10307 = compute(value, 25)
+value19972 = compute(value, 87)
+value77174 = compute(value, 59)
+value80933 = compute(value, 35)
+# note 3987: keep this in sync with the handler
+const v = os.getenv("BENCH_KEY_01333");
+value7474 = compute(value, 5)
+value14137 = compute(value, 72)
+value44527 = compute(value, 4)
+value20084 = compute(value, 5)
+value49311 = compute(value, 35)
+value35287 = compute(value, 76)
+value1489 = compute(value, 34)
+value39007 = compute(value, 13)
+# note 64913: keep this in sync with the handler
+value47864 = compute(value, 43)
+value12188 = compute(value, 63)
+value51895 = compute(value, 0)
+const v = os.getenv("BENCH_KEY_00784");
+value86349 = compute(value, 19)
+value64280 = compute(value, 66)
+# note 68832: keep this in sync with the handler
+value86710 = compute(value, 89)
+value3786 = compute(value, 3)
+value11872 = compute(value, 38)
+value79694 = compute(value, 57)
+# note 10018: keep this in sync with the handler
+value73946 = compute(value, 32)
+# note 43055: keep this in sync with the handler
+value28806 = compute(value, 94)
+value98681 = compute(value, 32)
+value57599 = compute(value, 78)
+value21113 = compute(value, 64)
+value93788 = compute(value, 86)
+# note 7902: keep this in sync with the handler
+value8269 = compute(value, 24)
+# note 46952: keep this in sync with the handler
+value22775 = compute(value, 77)
+value60942 = compute(value, 26)
+value93387 = compute(value, 73)
+const v = os.getenv("BENCH_KEY_01819");
+value68378 = compute(value, 90)
+value49267 = compute(value, 88)
+value15870 = compute(value, 59)
+value57641 = compute(value, 23)
+value54006 = compute(value, 74)
+value46021 = compute(value, 43)
+# note 19774: keep this in sync with the handler
+value75660 = compute(value, 0)
+value94292 = compute(value, 8)
+value28777 = compute(value, 65)
+value80701 = compute(value, 94)
+# note 57293: keep this in sync with the handler
+value6397 = compute(value, 92)
+value78607 = compute(value, 37)
+value64765 = compute(value, 66)
+value66279 = compute(value, 28)
+value64390 = compute(value, 79)
+value64799 = compute(value, 3)
+const v = os.environ.get('BENCH_KEY_01282');
+value34287 = compute(value, 46)
+value3978 = compute(value, 1)
+# note 52246: keep this in sync with the handler
+# note 52139: keep this in sync with the handler
+value28214 = compute(value, 84)
+value48672 = compute(value, 75)
+value23838 = compute(value, 73)
+value90333 = compute(value, 26)
+value45039 = compute(value, 31)
+const v = os.getenv("BENCH_KEY_00718");
+value75388 = compute(value, 19)
+# note 3164: keep this in sync with the handler
+value44051 = compute(value, 13)
+value11190 = compute(value, 35)
+value81290 = compute(value, 4)
+# note 59959: keep this in sync with the handler
+# note 58720: keep this in sync with the handler
+value42666 = compute(value, 83)
+value65310 = compute(value, 29)
+value91186 = compute(value, 6)
+value60204 = compute(value, 64)
+value72603 = compute(value, 47)
+value86900 = compute(value, 85)
+value89071 = compute(value, 25)
+value32955 = compute(value, 72)
+value44674 = compute(value, 54)
+value34759 = compute(value, 33)
+# note 64032: keep this in sync with the handler
+const v = os.environ["BENCH_KEY_01242"];
+# note 92957: keep this in sync with the handler
+value41786 = compute(value, 76)
+# note 83953: keep this in sync with the handler
+value34394 = compute(value, 56)
+value18706 = compute(value, 82)
+value42265 = compute(value, 70)
+value36572 = compute(value, 3)
+value48758 = compute(value, 64)
+value88650 = compute(value, 89)
+value70677 = compute(value, 61)
+# note 10004: keep this in sync with the handler
+value38467 = compute(value, 55)
+# note 5866: keep this in sync with the handler
+value68188 = compute(value, 94)
+value5369 = compute(value, 34)
+value14288 = compute(value, 29)
+const v = os.getenv("BENCH_KEY_00954");
+value28307 = compute(value, 80)
+value74768 = compute(value, 78)
+value82358 = compute(value, 5)
+value17125 = compute(value, 53)
+value32956 = compute(value, 73)
+# note 21964: keep this in sync with the handler
+# note 88627: keep this in sync with the handler
+value22970 = compute(value, 78)
+value95434 = compute(value, 83)
+value88746 = compute(value, 88)
+value37158 = compute(value, 7)
+value78624 = compute(value, 54)
+# note 16504: keep this in sync with the handler
+value95581 = compute(value, 36)
+value24870 = compute(value, 38)
+value81530 = compute(value, 50)
+value62687 = compute(value, 25)
+value69125 = compute(value, 61)
+value22042 = compute(value, 23)
+const v = os.environ["BENCH_KEY_01437"];
+value32113 = compute(value, 6)
+value86559 = compute(value, 35)
+value34625 = compute(value, 93)
+value31036 = compute(value, 93)
+value37132 = compute(value, 78)
+value14733 = compute(value, 86)
+value46192 = compute(value, 20)
+value72339 = compute(value, 74)
+value72804 = compute(value, 54)
+value94436 = compute(value, 55)
+value97315 = compute(value, 24)
+value2538 = compute(value, 16)
+value29079 = compute(value, 76)
+const v = os.environ["BENCH_KEY_00732"];
+value6468 = compute(value, 66)
+value95119 = compute(value, 59)
+value19668 = compute(value, 74)
+# note 33564: keep this in sync with the handler
+value43347 = compute(value, 85)
+value5451 = compute(value, 19)
+value95188 = compute(value, 31)
+value44150 = compute(value, 15)
+value53106 = compute(value, 47)
+# note 25713: keep this in sync with the handler
+value12365 = compute(value, 46)
+value81225 = compute(value, 36)
+value29755 = compute(value, 73)
+value8815 = compute(value, 85)
@@ -0,0 +1,202 @@
+const value23378 = compute(value, 1);
+const value77712 = compute(value, 15);
+const v = process.env["BENCH_KEY_00364"];
+// note 95738: keep this in sync with the handler
+const value99888 = compute(value, 75);
+const value16674 = compute(value, 87);
+const value82181 = compute(value, 22);
+const value78049 = compute(value, 61);
+const value52771 = compute(value, 3);
+const value29347 = compute(value, 53);
+const value35494 = compute(value, 89);
+const value75335 = compute(value, 63);
+const value77117 = compute(value, 2);
+const value90849 = compute(value, 57);
+const v = import.meta.env.BENCH_KEY_00186;
+const value67872 = compute(value, 69);
+const value95075 = compute(value, 15);
+const value43179 = compute(value, 14);
+const value65944 = compute(value, 81);
+const value83656 = compute(value, 42);
+const value39869 = compute(value, 2);
+const value81608 = compute(value, 31);
+const value80962 = compute(value, 64);
+const value43461 = compute(value, 5);
+// note 22728: keep this in sync with the handler
+const value54233 = compute(value, 10);
+const value90799 = compute(value, 7);
+const value15420 = compute(value, 94);
+const value82828 = compute(value, 87);
+// note 67033: keep this in sync with the handler
+const v = process.env["BENCH_KEY_00755"];
+// note 83824: keep this in sync with the handler
+const value24015 = compute(value, 56);
+const value44801 = compute(value, 84);
+const value34381 = compute(value, 43);
+const value48520 = compute(value, 20);
+const value52704 = compute(value, 33);
+const value92729 = compute(value, 94);
+const value35537 = compute(value, 35);
+const value18908 = compute(value, 90);
+const value47668 = compute(value, 41);
+const value22879 = compute(value, 84);
+const value70194 = compute(value, 63);
+const value24746 = compute(value, 11);
+const value23565 = compute(value, 91);
+const value12274 = compute(value, 52);
+const value91925 = compute(value, 66);
+const v = import.meta.env.BENCH_KEY_00649;
+const value46094 = compute(value, 19);
+const value95892 = compute(value, 56);
+const value41962 = compute(value, 58);
+// note 21283: keep this in sync with the handler
+const value90492 = compute(value, 88);
+const value38056 = compute(value, 32);
+const value61744 = compute(value, 52);
+const value2172 = compute(value, 38);
+const value78803 = compute(value, 39);
+const value31546 = compute(value, 21);
+const value35353 = compute(value, 45);
+const value50396 = compute(value, 53);
+// note 97586: keep this in sync with the handler
+const value98524 = compute(value, 69);
+const value37712 = compute(value, 76);
+const value40887 = compute(value, 50);
+const value12417 = compute(value, 1);
+const value42067 = compute(value, 66);
+// note 60668: keep this in sync with the handler
+const v = process.env["BENCH_KEY_01483"];
+// note 73893: keep this in sync with the handler
+// note 80133: keep this in sync with the handler
+const value41263 = compute(value, 38);
+const value81644 = compute(value, 67);
+const value99979 = compute(value, 69);
+// note 87696: keep this in sync with the handler
+// note 14829: keep this in sync with the handler
+const v = process.env.BENCH_KEY_00552;
+const value92976 = compute(value, 50);
+// note 85370: keep this in sync with the handler
+const value20359 = compute(value, 86);
+const value74716 = compute(value, 26);
+const value53542 = compute(value, 95);
+const value27307 = compute(value, 50);
+const value77074 = compute(value, 56);
+const value49537 = compute(value, 67);
+const value64281 = compute(value, 67);
+const value39609 = compute(value, 33);
+const value11424 = compute(value, 75);
+const value54595 = compute(value, 81);
+const value26276 = compute(value, 86);
+const value74348 = compute(value, 46);
+const value33417 = compute(value, 49);
+const value64615 = compute(value, 13);
+const v = process.env.BENCH_KEY_01028;
+const value93105 = compute(value, 82);
+const value64294 = compute(value, 80);
+const value62231 = compute(value, 54);
+const value43640 = compute(value, 87);
+const value90807 = compute(value, 15);
+const value37866 = compute(value, 36);
+const value40321 = compute(value, 66);
+const value48411 = compute(value, 8);
+const v = process.env["BENCH_KEY_00980"];
+const value33401 = compute(value, 33);
+const value14942 = compute(value, 4);
+const value52501 = compute(value, 24);
+// note 10376: keep this in sync with the handler
+// note 49936: keep this in sync with the handler
+const value73375 = compute(value, 43);
+const value25822 = compute(value, 20);
+const v = process.env["BENCH_KEY_00957"];
+const value86755 = compute(value, 37);
+// note 57510: keep this in sync with the handler
+const value59508 = compute(value, 47);
+const value2546 = compute(value, 24);
+const value14929 = compute(value, 88);
+const value35537 = compute(value, 35);
+// note 96005: keep this in sync with the handler
+// note 47295: keep this in sync with the handler
+const value51746 = compute(value, 45);
+const value6041 = compute(value, 27);
+const value6413 = compute(value, 11);
+const value71407 = compute(value, 15);
+const v = process.env["BENCH_KEY_01423"];
+const value28314 = compute(value, 87);
+const value5529 = compute(value, 0);
+const value12726 = compute(value, 19);
+const value84218 = compute(value, 22);
+const value25196 = compute(value, 73);
+// note 3028: keep this in sync with the handler
+const value25007 = compute(value, 78);
+const value59946 = compute(value, 0);
+const value99964 = compute(value, 54);
+const value19892 = compute(value, 7);
+const value14497 = compute(value, 44);
+const value41216 = compute(value, 88);
+const value72602 = compute(value, 46);
+const value65276 = compute(value, 92);
+const value37813 = compute(value, 80);
+const v = process.env["BENCH_KEY_00228"];
+const value68219 = compute(value, 28);
+const value63727 = compute(value, 95);
+const value72101 = compute(value, 30);
+// note 9473: keep this in sync with the handler
+// note 30737: keep this in sync with the handler
+const value71823 = compute(value, 43);
+const value8649 = compute(value, 16);
+const value38006 = compute(value, 79);
+const value19757 = compute(value, 66);
+const value95986 = compute(value, 53);
+const value19619 = compute(value, 25);
+const value34742 = compute(value, 16);
+const value6588 = compute(value, 89);
+const value28163 = compute(value, 33);
+const value25194 = compute(value, 71);
+// note 10471: keep this in sync with the handler
+const value57481 = compute(value, 57);
+const value94128 = compute(value, 38);
+const value84418 = compute(value, 28);
+const v = import.meta.env.BENCH_KEY_00105;
+const value55460 = compute(value, 73);
+// note 31065: keep this in sync with the handler
+const value54772 = compute(value, 64);
+// note 97033: keep this in sync with the handler
+const value91929 = compute(value, 70);
+const value13989 = compute(value, 21);
+const value80285 = compute(value, 66);
+const value21186 = compute(value, 40);
+const value52708 = compute(value, 37);
+const value9763 = compute(value, 63);
+const value44641 = compute(value, 21);
+const value47501 = compute(value, 68);
+const value306 = compute(value, 15);
+const value47350 = compute(value, 14);
+const value62551 = compute(value, 83);
+// note 1837: keep this in sync with the handler
+const v = process.env["BENCH_KEY_00831"];
+const value18619 = compute(value, 92);
+const value46447 = compute(value, 81);
+// note 57730: keep this in sync with the handler
+const value9711 = compute(value, 11);
+// note 55326: keep this in sync with the handler
+const value9782 = compute(value, 82);
+const value77070 = compute(value, 52);
+const value26680 = compute(value, 5);
+const value70070 = compute(value, 36);
+const value76763 = compute(value, 36);
+const value33270 = compute(value, 96);
+const value73184 = compute(value, 46);
+const v = import.meta.env.BENCH_KEY_00079;
+const value91827 = compute(value, 65);
+const value7811 = compute(value, 51);
+const value88411 = compute(value, 44);
+const value44497 = compute(value, 71);
+const value73887 = compute(value, 70);
+const value40706 = compute(value, 63);
+const value54007 = compute(value, 75);
+const value29001 = compute(value, 95);
+// note 55193: keep this in sync with the handler
+const value40930 = compute(value, 93);
+const value80668 = compute(value, 61);
+const value46851 = compute(value, 0);
+// note 59352: keep this in sync with the handler
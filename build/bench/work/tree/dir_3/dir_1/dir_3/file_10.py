@@ -0,0 +1,235 @@
+value60397 = compute(value, 63)
+value84041 = compute(value, 39)
+value87969 = compute(value, 87)
+# note 8743: keep this in sync with the handler
+value90300 = compute(value, 90)
+value69473 = compute(value, 21)
+value72420 = compute(value, 58)
+const v = os.environ.get('BENCH_KEY_00391');
+value25086 = compute(value, 60)
+value6883 = compute(value, 93)
+value19199 = compute(value, 90)
+value72342 = compute(value, 77)
+value3277 = compute(value, 76)
+value58076 = compute(value, 70)
+value5621 = compute(value, 92)
+value97193 = compute(value, 96)
+# note 76789: keep this in sync with the handler
+value49630 = compute(value, 63)
+value62158 = compute(value, 78)
+value87615 = compute(value, 24)
+value16495 = compute(value, 5)
+const v = os.getenv("BENCH_KEY_01039");
+value17667 = compute(value, 13)
+value92271 = compute(value, 24)
+value98401 = compute(value, 43)
+value23071 = compute(value, 82)
+# note 8894: keep this in sync with the handler
+value53900 = compute(value, 65)
+value71613 = compute(value, 27)
+value45440 = compute(value, 44)
+value4744 = compute(value, 88)
+value28579 = compute(value, 61)
+value73628 = compute(value, 5)
+value33091 = compute(value, 14)
+value95612 = compute(value, 67)
+value61678 = compute(value, 83)
+value59681 = compute(value, 26)
+value77356 = compute(value, 47)
+value32368 = compute(value, 67)
+# note 96606: keep this in sync with the handler
+value64433 = compute(value, 25)
+value12788 = compute(value, 81)
+const v = os.environ["BENCH_KEY_00939"];
+# note 24697: keep this in sync with the handler
+value85486 = compute(value, 29)
+value97787 = compute(value, 11)
+value66482 = compute(value, 37)
+value97791 = compute(value, 15)
+value87250 = compute(value, 47)
+value96117 = compute(value, 87)
+value28594 = compute(value, 76)
+value11586 = compute(value, 43)
+value18689 = compute(value, 65)
+value76300 = compute(value, 58)
+value65429 = compute(value, 51)
+value61957 = compute(value, 71)
+value88493 = compute(value, 29)
+const v = os.getenv("BENCH_KEY_00138");
+# note 80120: keep this in sync with the handler
+# note 85845: keep this in sync with the handler
+value49868 = compute(value, 10)
+value69581 = compute(value, 32)
+value9641 = compute(value, 38)
+value56447 = compute(value, 90)
+# note 27667: keep this in sync with the handler
+# note 49876: keep this in sync with the handler
+value96108 = compute(value, 78)
+const v = os.getenv("BENCH_KEY_00005");
+value12657 = compute(value, 47)
+value66869 = compute(value, 36)
+value13564 = compute(value, 81)
+value34653 = compute(value, 24)
+value78239 = compute(value, 57)
+value40309 = compute(value, 54)
+value88473 = compute(value, 9)
+value30142 = compute(value, 72)
+value59711 = compute(value, 56)
+# note 64373: keep this in sync with the handler
+const v = os.environ.get('BENCH_KEY_01267');
+# note 86399: keep this in sync with the handler
+# note 63737: keep this in sync with the handler
+value92844 = compute(value, 15)
+value1490 = compute(value, 35)
+value13262 = compute(value, 70)
+value18246 = compute(value, 10)
+value68222 = compute(value, 31)
+value51140 = compute(value, 21)
+value55647 = compute(value, 66)
+value12586 = compute(value, 73)
+const v = os.environ.get('BENCH_KEY_01310');
+value81244 = compute(value, 55)
+value94841 = compute(value, 72)
+value13678 = compute(value, 1)
+value8542 = compute(value, 6)
+# note 4974: keep this in sync with the handler
+value19310 = compute(value, 7)
+value41826 = compute(value, 19)
+value20941 = compute(value, 86)
+value6381 = compute(value, 76)
+value40459 = compute(value, 10)
+value10925 = compute(value, 61)
+value51279 = compute(value, 63)
+value9114 = compute(value, 93)
+value655 = compute(value, 73)
+value74860 = compute(value, 73)
+value47001 = compute(value, 53)
+# note 53699: keep this in sync with the handler
+value4460 = compute(value, 95)
+value76316 = compute(value, 74)
+value84978 = compute(value, 6)
+value3224 = compute(value, 23)
+value56738 = compute(value, 90)
+value39971 = compute(value, 7)
+const v = os.environ["BENCH_KEY_01750"];
+value40916 = compute(value, 79)
+value75012 = compute(value, 31)
+value14079 = compute(value, 14)
+value82850 = compute(value, 12)
+# note 14577: keep this in sync with the handler
+# note 82911: keep this in sync with the handler
+value25053 = compute(value, 27)
+value18057 = compute(value, 15)
+value78763 = compute(value, 96)
+value14398 = compute(value, 42)
+value25829 = compute(value, 27)
+value81691 = compute(value, 17)
+value69600 = compute(value, 51)
+value15768 = compute(value, 54)
+const v = os.environ.get('BENCH_KEY_01167');
+value55408 = compute(value, 21)
+value57712 = compute(value, 94)
+value55323 = compute(value, 33)
+value54506 = compute(value, 89)
+value85467 = compute(value, 10)
+value89775 = compute(value, 50)
+value83050 = compute(value, 18)
+value47675 = compute(value, 48)
+const v = os.environ["BENCH_KEY_00076"];
+value4010 = compute(value, 33)
+value6550 = compute(value, 51)
+value62810 = compute(value, 51)
+value27299 = compute(value, 42)
+value61179 = compute(value, 69)
+# note 72847: keep this in sync with the handler
+value69544 = compute(value, 92)
+value50180 = compute(value, 31)
+# note 408: keep this in sync with the handler
+value90919 = compute(value, 30)
+value6896 = compute(value, 9)
+value48265 = compute(value, 56)
+# note 47484: keep this in sync with the handler
+value26479 = compute(value, 95)
+value55059 = compute(value, 60)
+value74951 = compute(value, 67)
+value33283 = compute(value, 12)
+const v = os.environ["BENCH_KEY_01548"];
+value64804 = compute(value, 8)
+value17692 = compute(value, 38)
+value59083 = compute(value, 10)
+value3433 = compute(value, 38)
+value3103 = compute(value, 96)
+value32180 = compute(value, 73)
+value38178 = compute(value, 57)
+value65490 = compute(value, 15)
+value18069 = compute(value, 27)
+# note 24432: keep this in sync with the handler
+value50824 = compute(value, 93)
+value20491 = compute(value, 24)
+value15294 = compute(value, 65)
+value94466 = compute(value, 85)
+value58035 = compute(value, 29)
+const v = os.environ["BENCH_KEY_00587"];
+value29593 = compute(value, 8)
+value46433 = compute(value, 67)
+value28026 = compute(value, 90)
+value51522 = compute(value, 15)
+value13483 = compute(value, 0)
+value63891 = compute(value, 65)
+value48404 = compute(value, 1)
+# note 28979: keep this in sync with the handler
+value70240 = compute(value, 12)
+# note 6726: keep this in sync with the handler
+value24546 = compute(value, 5)
+value12296 = compute(value, 74)
+const v = os.environ["BENCH_KEY_00512"];
+value63050 = compute(value, 0)
+value19864 = compute(value, 76)
+value22552 = compute(value, 48)
+# note 65526: keep this in sync with the handler
+value26949 = compute(value, 80)
+# note 38660: keep this in sync with the handler
+value84928 = compute(value, 53)
+value15498 = compute(value, 75)
+value32084 = compute(value, 74)
+value46320 = compute(value, 51)
+value34177 = compute(value, 33)
+# note 1656: keep this in sync with the handler
+# note 28704: keep this in sync with the handler
+value81443 = compute(value, 60)
+value26259 = compute(value, 69)
+value17582 = compute(value, 25)
+# note 49716: keep this in sync with the handler
+# note 53043: keep this in sync with the handler
+value67536 = compute(value, 24)
+const v = os.environ["BENCH_KEY_00450"];
+value45274 = compute(value, 72)
+value7378 = compute(value, 6)
+value19460 = compute(value, 60)
+value59540 = compute(value, 79)
+value35275 = compute(value, 64)
+# note 36899: keep this in sync with the handler
+value78188 = compute(value, 6)
+value67276 = compute(value, 55)
+value38272 = compute(value, 54)
+value37897 = compute(value, 67)
+# note 54380: keep this in sync with the handler
+value58045 = compute(value, 39)
+value52640 = compute(value, 66)
+# note 47039: keep this in sync with the handler
+value66187 = compute(value, 33)
+value30645 = compute(value, 90)
+value41244 = compute(value, 19)
+value9994 = compute(value, 3)
+value6686 = compute(value, 90)
+# note 43833: keep this in sync with the handler
+const v = os.environ.get('BENCH_KEY_00066');
+value70827 = compute(value, 17)
+# note 54448: keep this in sync with the handler
+value8585 = compute(value, 49)
+value78815 = compute(value, 51)
+value8958 = compute(value, 34)
+# note 84445: keep this in sync with the handler
+value93595 = compute(value, 87)
+value26556 = compute(value, 75)
+value16888 = compute(value, 10)
@@ -0,0 +1,206 @@
+const value59707 = compute(value, 52);
+const value63242 = compute(value, 95);
+const value52667 = compute(value, 93);
+const value54971 = compute(value, 69);
+const value4540 = compute(value, 78);
+const value28233 = compute(value, 6);
+const v = import.meta.env.BENCH_KEY_00521;
+const value17414 = compute(value, 51);
+const value38079 = compute(value, 55);
+const value31190 = compute(value, 53);
+const value83704 = compute(value, 90);
+const value76325 = compute(value, 83);
+// note 24874: keep this in sync with the handler
+const value35364 = compute(value, 56);
+const value36775 = compute(value, 12);
+const value10517 = compute(value, 41);
+const value80373 = compute(value, 57);
+const value35727 = compute(value, 31);
+const value5331 = compute(value, 93);
+const value40017 = compute(value, 53);
+const value31126 = compute(value, 86);
+const value23819 = compute(value, 54);
+const value85772 = compute(value, 24);
+const v = process.env["BENCH_KEY_01921"];
+// note 75885: keep this in sync with the handler
+const value67346 = compute(value, 28);
+const value30005 = compute(value, 32);
+const value15829 = compute(value, 18);
+const value71405 = compute(value, 13);
+const value94565 = compute(value, 87);
+const value96546 = compute(value, 31);
+const value15041 = compute(value, 6);
+const value1819 = compute(value, 73);
+const value28910 = compute(value, 4);
+const value53782 = compute(value, 44);
+const value81056 = compute(value, 61);
+const value63455 = compute(value, 17);
+const value92669 = compute(value, 34);
+const value63372 = compute(value, 31);
+const value65717 = compute(value, 48);
+const value18712 = compute(value, 88);
+const value83439 = compute(value, 19);
+const value537 = compute(value, 52);
+const v = process.env.BENCH_KEY_00094;
+const value11144 = compute(value, 86);
+const value4316 = compute(value, 48);
+// note 12607: keep this in sync with the handler
+const value46391 = compute(value, 25);
+const value63110 = compute(value, 60);
+const value24670 = compute(value, 32);
+const value62460 = compute(value, 89);
+// note 3557: keep this in sync with the handler
+const value9699 = compute(value, 96);
+const value20504 = compute(value, 37);
+const value83135 = compute(value, 6);
+// note 53853: keep this in sync with the handler
+const value96494 = compute(value, 76);
+// note 82492: keep this in sync with the handler
+const value39993 = compute(value, 29);
+const v = import.meta.env.BENCH_KEY_00718;
+const value32205 = compute(value, 1);
+const value57524 = compute(value, 3);
+const value11227 = compute(value, 72);
+const value74068 = compute(value, 57);
+const value17926 = compute(value, 78);
+const value8912 = compute(value, 85);
+const value2046 = compute(value, 9);
+const value55166 = compute(value, 70);
+const value70579 = compute(value, 60);
+const value78445 = compute(value, 69);
+const value2485 = compute(value, 60);
+const value7814 = compute(value, 54);
+// note 15690: keep this in sync with the handler
+const value72769 = compute(value, 19);
+const value88356 = compute(value, 86);
+const value27001 = compute(value, 35);
+const v = process.env.BENCH_KEY_00405;
+const value62976 = compute(value, 23);
+const value40541 = compute(value, 92);
+// note 83857: keep this in sync with the handler
+const value41981 = compute(value, 77);
+// note 36729: keep this in sync with the handler
+const value30926 = compute(value, 80);
+const value68051 = compute(value, 54);
+const value42545 = compute(value, 59);
+const value14383 = compute(value, 27);
+const value69764 = compute(value, 21);
+const v = process.env["BENCH_KEY_01571"];
+const value54182 = compute(value, 56);
+const value97257 = compute(value, 63);
+const value43821 = compute(value, 74);
+const value77915 = compute(value, 24);
+const value87878 = compute(value, 93);
+const value15039 = compute(value, 4);
+const value83619 = compute(value, 5);
+const value35516 = compute(value, 14);
+const value25043 = compute(value, 17);
+const value61418 = compute(value, 17);
+const value90187 = compute(value, 74);
+const v = import.meta.env.BENCH_KEY_00014;
+// note 31663: keep this in sync with the handler
+const value20223 = compute(value, 47);
+const value98293 = compute(value, 32);
+const value16587 = compute(value, 0);
+const value65457 = compute(value, 79);
+const value61622 = compute(value, 27);
+const value34268 = compute(value, 27);
+const value58583 = compute(value, 92);
+const value94998 = compute(value, 35);
+const value51740 = compute(value, 39);
+const value47074 = compute(value, 29);
+const value43276 = compute(value, 14);
+const value81367 = compute(value, 81);
+const value63301 = compute(value, 57);
+const value26901 = compute(value, 32);
+const value83528 = compute(value, 11);
+const v = process.env["BENCH_KEY_00187"];
+const value71256 = compute(value, 58);
+const value62117 = compute(value, 37);
+const value87357 = compute(value, 57);
+const value99495 = compute(value, 70);
+const value41944 = compute(value, 40);
+const value71514 = compute(value, 25);
+const value19071 = compute(value, 59);
+const value83410 = compute(value, 87);
+const value560 = compute(value, 75);
+const value63600 = compute(value, 65);
+const value51394 = compute(value, 81);
+const value98912 = compute(value, 69);
+const v = process.env.BENCH_KEY_01553;
+const value61049 = compute(value, 36);
+const value21623 = compute(value, 89);
+const value28331 = compute(value, 7);
+const value31606 = compute(value, 81);
+const value98580 = compute(value, 28);
+const value15107 = compute(value, 72);
+// note 52625: keep this in sync with the handler
+const value34351 = compute(value, 13);
+const value12855 = compute(value, 51);
+const value77430 = compute(value, 24);
+const value66220 = compute(value, 66);
+const value52466 = compute(value, 86);
+const value39590 = compute(value, 14);
+const value40220 = compute(value, 62);
+const value84193 = compute(value, 94);
+// note 84478: keep this in sync with the handler
+const value9126 = compute(value, 8);
+const value14390 = compute(value, 34);
+const value34850 = compute(value, 27);
+const v = process.env["BENCH_KEY_01076"];
+const value23804 = compute(value, 39);
+const value55036 = compute(value, 37);
+const value53875 = compute(value, 40);
+const value95185 = compute(value, 28);
+const value56913 = compute(value, 71);
+const value50420 = compute(value, 77);
+const value3238 = compute(value, 37);
+const value55878 = compute(value, 6);
+const value29641 = compute(value, 56);
+const value1743 = compute(value, 94);
+const value110 = compute(value, 13);
+const value34267 = compute(value, 26);
+// note 80682: keep this in sync with the handler
+const v = import.meta.env.BENCH_KEY_00032;
+const value91394 = compute(value, 20);
+const value40763 = compute(value, 23);
+const value7904 = compute(value, 47);
+const value66697 = compute(value, 58);
+const value97704 = compute(value, 25);
+const value31241 = compute(value, 7);
+const value99378 = compute(value, 50);
+const value27544 = compute(value, 93);
+const value78264 = compute(value, 82);
+const value29871 = compute(value, 92);
+const value4710 = compute(value, 54);
+const value51174 = compute(value, 55);
+// note 85575: keep this in sync with the handler
+// note 18744: keep this in sync with the handler
+const value63737 = compute(value, 8);
+const v = import.meta.env.BENCH_KEY_00085;
+const value73917 = compute(value, 3);
+const value61409 = compute(value, 8);
+const value13810 = compute(value, 36);
+const value32044 = compute(value, 34);
+// note 60265: keep this in sync with the handler
+const value72399 = compute(value, 37);
+const value450 = compute(value, 62);
+const v = import.meta.env.BENCH_KEY_00372;
+const value50557 = compute(value, 20);
+const value57461 = compute(value, 37);
+const value53749 = compute(value, 11);
+const value26896 = compute(value, 27);
+const value47119 = compute(value, 74);
+const value45059 = compute(value, 51);
+const value10427 = compute(value, 48);
+const value18428 = compute(value, 95);
+const value31487 = compute(value, 59);
+const value47853 = compute(value, 32);
+const value93255 = compute(value, 38);
+const value67047 = compute(value, 20);
+const value53375 = compute(value, 25);
+const value17971 = compute(value, 26);
+const v = process.env.BENCH_KEY_00140;
+// note 9110: keep this in sync with the handler
+const value97478 = compute(value, 90);
+const value34444 = compute(value, 9);
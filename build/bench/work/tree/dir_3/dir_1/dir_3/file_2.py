@@ -0,0 +1,240 @@
+value84094 = compute(value, 92)
+value10771 = compute(value, 4)
+value4192 = compute(value, 21)
+value86127 = compute(value, 88)
+value77427 = compute(value, 21)
+value37945 = compute(value, 18)
+value39843 = compute(value, 73)
+# note 85569: keep this in sync with the handler
+value87456 = compute(value, 59)
+value55143 = compute(value, 47)
+value53762 = compute(value, 24)
+value82194 = compute(value, 35)
+value91474 = compute(value, 3)
+const v = os.environ.get('BENCH_KEY_00835');
+value84504 = compute(value, 17)
+# note 6760: keep this in sync with the handler
+value86811 = compute(value, 93)
+value46093 = compute(value, 18)
+value99001 = compute(value, 61)
+value1468 = compute(value, 13)
+value55449 = compute(value, 62)
+value98728 = compute(value, 79)
+value64265 = compute(value, 51)
+value15784 = compute(value, 70)
+value40297 = compute(value, 42)
+# note 98368: keep this in sync with the handler
+value69457 = compute(value, 5)
+value68146 = compute(value, 52)
+# note 5466: keep this in sync with the handler
+value82631 = compute(value, 84)
+value63368 = compute(value, 27)
+value56745 = compute(value, 0)
+value11574 = compute(value, 31)
+const v = os.environ.get('BENCH_KEY_01551');
+value50918 = compute(value, 90)
+value76378 = compute(value, 39)
+value77815 = compute(value, 21)
+value87286 = compute(value, 83)
+value8997 = compute(value, 73)
+value59755 = compute(value, 3)
+value80992 = compute(value, 94)
+# note 16376: keep this in sync with the handler
+value98172 = compute(value, 8)
+value37801 = compute(value, 68)
+value25632 = compute(value, 24)
+value15976 = compute(value, 68)
+value72835 = compute(value, 85)
+# note 40634: keep this in sync with the handler
+value96196 = compute(value, 69)
+value32523 = compute(value, 28)
+value26930 = compute(value, 61)
+value46667 = compute(value, 10)
+value23345 = compute(value, 65)
+value75120 = compute(value, 42)
+const v = os.environ.get('BENCH_KEY_00104');
+value36605 = compute(value, 36)
+value4591 = compute(value, 32)
+value57104 = compute(value, 68)
+value86405 = compute(value, 75)
+value76699 = compute(value, 69)
+value8896 = compute(value, 69)
+value87437 = compute(value, 40)
+# note 95005: keep this in sync with the handler
+value74581 = compute(value, 85)
+value84646 = compute(value, 62)
+value35038 = compute(value, 21)
+value77654 = compute(value, 54)
+value2722 = compute(value, 6)
+value91361 = compute(value, 84)
+value85450 = compute(value, 90)
+value3312 = compute(value, 14)
+value87239 = compute(value, 36)
+value51917 = compute(value, 22)
+value1672 = compute(value, 23)
+value38031 = compute(value, 7)
+value33326 = compute(value, 55)
+const v = os.getenv("BENCH_KEY_01025");
+# note 59953: keep this in sync with the handler
+value58524 = compute(value, 33)
+value44900 = compute(value, 86)
+value17294 = compute(value, 28)
+value40045 = compute(value, 81)
+# note 76882: keep this in sync with the handler
+# note 46256: keep this in sync with the handler
+value79595 = compute(value, 55)
+value80763 = compute(value, 59)
+const v = os.getenv("BENCH_KEY_00278");
+value86659 = compute(value, 38)
+# note 41376: keep this in sync with the handler
+value91777 = compute(value, 15)
+value72768 = compute(value, 18)
+value5275 = compute(value, 37)
+value71581 = compute(value, 92)
+value45298 = compute(value, 96)
+value52884 = compute(value, 19)
+# note 40266: keep this in sync with the handler
+value345 = compute(value, 54)
+value96418 = compute(value, 0)
+value15372 = compute(value, 46)
+value54119 = compute(value, 90)
+value53028 = compute(value, 66)
+value6388 = compute(value, 83)
+# note 44170: keep this in sync with the handler
+const v = os.environ["BENCH_KEY_00712"];
+value34182 = compute(value, 38)
+value60789 = compute(value, 67)
+# note 32081: keep this in sync with the handler
+value20526 = compute(value, 59)
+# note 41304: keep this in sync with the handler
+# note 26056: keep this in sync with the handler
+# note 51035: keep this in sync with the handler
+value59698 = compute(value, 43)
+value33494 = compute(value, 29)
+value57984 = compute(value, 75)
+value31492 = compute(value, 64)
+value83172 = compute(value, 43)
+value73590 = compute(value, 64)
+value27693 = compute(value, 48)
+value76004 = compute(value, 53)
+value8608 = compute(value, 72)
+value90373 = compute(value, 66)
+const v = os.environ.get('BENCH_KEY_00985');
+value22979 = compute(value, 87)
+value86886 = compute(value, 71)
+value24532 = compute(value, 88)
+value73953 = compute(value, 39)
+value51942 = compute(value, 47)
+value98284 = compute(value, 23)
+value84594 = compute(value, 10)
+value38148 = compute(value, 27)
+value1639 = compute(value, 87)
+value24453 = compute(value, 9)
+value43275 = compute(value, 13)
+value24488 = compute(value, 44)
+value99452 = compute(value, 27)
+value76515 = compute(value, 79)
+value22027 = compute(value, 8)
+value46061 = compute(value, 83)
+# note 13230: keep this in sync with the handler
+value64011 = compute(value, 88)
+value64200 = compute(value, 83)
+value59850 = compute(value, 1)
+value19772 = compute(value, 81)
+value68765 = compute(value, 89)
+value97013 = compute(value, 13)
+value38605 = compute(value, 96)
+const v = os.getenv("BENCH_KEY_01282");
+value905 = compute(value, 32)
+value81566 = compute(value, 86)
+value37335 = compute(value, 87)
+value42232 = compute(value, 37)
+value87709 = compute(value, 21)
+value71411 = compute(value, 19)
+value79254 = compute(value, 5)
+value67647 = compute(value, 38)
+# note 66585: keep this in sync with the handler
+value73946 = compute(value, 32)
+value47937 = compute(value, 19)
+value71581 = compute(value, 92)
+value64350 = compute(value, 39)
+value16831 = compute(value, 50)
+value72147 = compute(value, 76)
+value90440 = compute(value, 36)
+value34280 = compute(value, 39)
+value57736 = compute(value, 21)
+value5324 = compute(value, 86)
+value37623 = compute(value, 84)
+value84364 = compute(value, 71)
+value88443 = compute(value, 76)
+const v = os.environ["BENCH_KEY_01437"];
+# note 774: keep this in sync with the handler
+value32541 = compute(value, 46)
+value38133 = compute(value, 12)
+value70145 = compute(value, 14)
+# note 4012: keep this in sync with the handler
+value67087 = compute(value, 60)
+value46400 = compute(value, 34)
+value77391 = compute(value, 82)
+value44879 = compute(value, 65)
+value32152 = compute(value, 45)
+value44802 = compute(value, 85)
+const v = os.getenv("BENCH_KEY_01466");
+value32139 = compute(value, 32)
+value47672 = compute(value, 45)
+value80265 = compute(value, 46)
+value38409 = compute(value, 94)
+value53510 = compute(value, 63)
+value43710 = compute(value, 60)
+value28580 = compute(value, 62)
+value60763 = compute(value, 41)
+value33813 = compute(value, 57)
+value32263 = compute(value, 59)
+value18163 = compute(value, 24)
+value22859 = compute(value, 64)
+value10778 = compute(value, 11)
+value14220 = compute(value, 58)
+value96083 = compute(value, 53)
+value3995 = compute(value, 18)
+value83317 = compute(value, 91)
+value28729 = compute(value, 17)
+value69154 = compute(value, 90)
+value20567 = compute(value, 3)
+value77312 = compute(value, 3)
+value68292 = compute(value, 4)
+value27359 = compute(value, 5)
+value25172 = compute(value, 49)
+const v = os.environ["BENCH_KEY_01120"];
+value74253 = compute(value, 48)
+value20461 = compute(value, 91)
+# note 60458: keep this in sync with the handler
+value6385 = compute(value, 80)
+value18404 = compute(value, 71)
+value76321 = compute(value, 79)
+value14777 = compute(value, 33)
+value15683 = compute(value, 66)
+value65635 = compute(value, 63)
+# note 56157: keep this in sync with the handler
+value14511 = compute(value, 58)
+value76975 = compute(value, 54)
+value92518 = compute(value, 77)
+value37331 = compute(value, 83)
+value66185 = compute(value, 31)
+value16432 = compute(value, 39)
+value46686 = compute(value, 29)
+const v = os.environ.get('BENCH_KEY_00238');
+# note 74612: keep this in sync with the handler
+value18666 = compute(value, 42)
+# note 37120: keep this in sync with the handler
+value18816 = compute(value, 95)
+# note 6299: keep this in sync with the handler
+value20684 = compute(value, 23)
+value27755 = compute(value, 13)
+# note 87110: keep this in sync with the handler
+value874 = compute(value, 1)
+value32392 = compute(value, 91)
+value89414 = compute(value, 77)
+value5074 = compute(value, 30)
+value1967 = compute(value, 27)
+value7453 = compute(value, 81)
+value71056 = compute(value, 52)
@@ -0,0 +1,237 @@
+value92015 = compute(value, 59)
+value37080 = compute(value, 26)
+value9382 = compute(value, 70)
+value33710 = compute(value, 51)
+# note 18970: keep this in sync with the handler
+value2416 = compute(value, 88)
+# note 75350: keep this in sync with the handler
+value4016 = compute(value, 39)
+value72141 = compute(value, 70)
+value83486 = compute(value, 66)
+value22944 = compute(value, 52)
+# note 28878: keep this in sync with the handler
+value92397 = compute(value, 53)
+const v = os.environ.get('BENCH_KEY_00714');
+value67289 = compute(value, 68)
+value46224 = compute(value, 52)
+value929 = compute(value, 56)
+value89612 = compute(value, 81)
+value48083 = compute(value, 68)
+# note 31762: keep this in sync with the handler
+value69636 = compute(value, 87)
+value9134 = compute(value, 16)
+value95707 = compute(value, 65)
+value17038 = compute(value, 63)
+value42840 = compute(value, 63)
+value53903 = compute(value, 68)
+value43999 = compute(value, 58)
+const v = os.environ.get('BENCH_KEY_01673');
+# note 76063: keep this in sync with the handler
+value54431 = compute(value, 14)
+# note 21173: keep this in sync with the handler
+value93060 = compute(value, 37)
+value8721 = compute(value, 88)
+value39201 = compute(value, 13)
+value24234 = compute(value, 81)
+value32695 = compute(value, 6)
+# note 21213: keep this in sync with the handler
+# note 31385: keep this in sync with the handler
+value65104 = compute(value, 17)
+value8555 = compute(value, 19)
+value26109 = compute(value, 16)
+# note 72393: keep this in sync with the handler
+const v = os.getenv("BENCH_KEY_00294");
+value3287 = compute(value, 86)
+value55867 = compute(value, 92)
+value54153 = compute(value, 27)
+value37071 = compute(value, 17)
+value53196 = compute(value, 40)
+value3694 = compute(value, 8)
+value27368 = compute(value, 14)
+value21331 = compute(value, 88)
+value5641 = compute(value, 15)
+value42075 = compute(value, 74)
+value31825 = compute(value, 9)
+value53275 = compute(value, 22)
+# note 85750: keep this in sync with the handler
+value90706 = compute(value, 11)
+value96625 = compute(value, 13)
+value30873 = compute(value, 27)
+# note 58087: keep this in sync with the handler
+value29824 = compute(value, 45)
+value49650 = compute(value, 83)
+value47462 = compute(value, 29)
+value28802 = compute(value, 90)
+value75970 = compute(value, 19)
+value65905 = compute(value, 42)
+const v = os.environ["BENCH_KEY_01990"];
+# note 95558: keep this in sync with the handler
+value93944 = compute(value, 48)
+value8162 = compute(value, 14)
+value76817 = compute(value, 90)
+value66186 = compute(value, 32)
+value69493 = compute(value, 41)
+value28213 = compute(value, 83)
+value41269 = compute(value, 44)
+value7757 = compute(value, 94)
+value48589 = compute(value, 89)
+value71044 = compute(value, 40)
+value35223 = compute(value, 12)
+value67342 = compute(value, 24)
+value68134 = compute(value, 40)
+value108 = compute(value, 11)
+value21151 = compute(value, 5)
+value44524 = compute(value, 1)
+value90537 = compute(value, 36)
+value89263 = compute(value, 23)
+value28093 = compute(value, 60)
+value44777 = compute(value, 60)
+value41418 = compute(value, 96)
+value39475 = compute(value, 93)
+const v = os.environ["BENCH_KEY_01578"];
+value74791 = compute(value, 4)
+# note 96501: keep this in sync with the handler
+value54272 = compute(value, 49)
+# note 64346: keep this in sync with the handler
+value15211 = compute(value, 79)
+# note 93291: keep this in sync with the handler
+value12739 = compute(value, 32)
+value86118 = compute(value, 79)
+value42546 = compute(value, 60)
+value24752 = compute(value, 17)
+value95803 = compute(value, 64)
+value12001 = compute(value, 70)
+# note 99808: keep this in sync with the handler
+value29521 = compute(value, 33)
+value23801 = compute(value, 36)
+value81404 = compute(value, 21)
+value58785 = compute(value, 3)
+value26742 = compute(value, 67)
+# note 29785: keep this in sync with the handler
+value97915 = compute(value, 42)
+const v = os.environ.get('BENCH_KEY_00129');
+# note 98936: keep this in sync with the handler
+value10664 = compute(value, 91)
+# note 12415: keep this in sync with the handler
+value54943 = compute(value, 41)
+value38804 = compute(value, 4)
+value28648 = compute(value, 33)
+value44227 = compute(value, 92)
+value69499 = compute(value, 47)
+value58508 = compute(value, 17)
+value57313 = compute(value, 83)
+# note 86383: keep this in sync with the handler
+value20667 = compute(value, 6)
+value23993 = compute(value, 34)
+const v = os.environ["BENCH_KEY_01108"];
+value86558 = compute(value, 34)
+value33146 = compute(value, 69)
+value51968 = compute(value, 73)
+value95828 = compute(value, 89)
+value85140 = compute(value, 71)
+value26963 = compute(value, 94)
+value1930 = compute(value, 87)
+value43120 = compute(value, 52)
+value74693 = compute(value, 3)
+value24536 = compute(value, 92)
+value28104 = compute(value, 71)
+value88392 = compute(value, 25)
+value51727 = compute(value, 26)
+value78637 = compute(value, 67)
+value82037 = compute(value, 72)
+value69811 = compute(value, 68)
+const v = os.environ["BENCH_KEY_01317"];
+value68877 = compute(value, 7)
+value7806 = compute(value, 46)
+# note 95140: keep this in sync with the handler
+value37684 = compute(value, 48)
+value93449 = compute(value, 38)
+value12752 = compute(value, 45)
+value69251 = compute(value, 90)
+value19466 = compute(value, 66)
+value37067 = compute(value, 13)
+value98680 = compute(value, 31)
+value40272 = compute(value, 17)
+# note 23226: keep this in sync with the handler
+const v = os.environ.get('BENCH_KEY_01016');
+value54386 = compute(value, 66)
+value1125 = compute(value, 58)
+value47211 = compute(value, 69)
+value34118 = compute(value, 71)
+value7123 = compute(value, 42)
+value3925 = compute(value, 45)
+value6874 = compute(value, 84)
+value25757 = compute(value, 52)
+value89250 = compute(value, 10)
+value91657 = compute(value, 89)
+value87953 = compute(value, 71)
+value3173 = compute(value, 69)
+const v = os.environ.get('BENCH_KEY_01626');
+value20190 = compute(value, 14)
+value53061 = compute(value, 2)
+value20874 = compute(value, 19)
+value79214 = compute(value, 62)
+value52708 = compute(value, 37)
+value12235 = compute(value, 13)
+value826 = compute(value, 50)
+value20916 = compute(value, 61)
+# note 3104: keep this in sync with the handler
+value99992 = compute(value, 82)
+value98158 = compute(value, 91)
+value31437 = compute(value, 9)
+const v = os.getenv("BENCH_KEY_00727");
+value87192 = compute(value, 86)
+value1866 = compute(value, 23)
+value39060 = compute(value, 66)
+value85220 = compute(value, 54)
+value76568 = compute(value, 35)
+value4598 = compute(value, 39)
+value39303 = compute(value, 18)
+value73671 = compute(value, 48)
+value27061 = compute(value, 95)
+value78469 = compute(value, 93)
+# note 39605: keep this in sync with the handler
+value31542 = compute(value, 17)
+value89907 = compute(value, 85)
+value42847 = compute(value, 70)
+value52344 = compute(value, 61)
+value11059 = compute(value, 1)
+value31222 = compute(value, 85)
+const v = os.environ.get('BENCH_KEY_00790');
+value79414 = compute(value, 68)
+value66833 = compute(value, 0)
+value90551 = compute(value, 50)
+value60563 = compute(value, 35)
+value23062 = compute(value, 73)
+value83542 = compute(value, 25)
+value35945 = compute(value, 55)
+value10607 = compute(value, 34)
+value17504 = compute(value, 44)
+value57807 = compute(value, 92)
+# note 75466: keep this in sync with the handler
+const v = os.environ["BENCH_KEY_00490"];
+value33790 = compute(value, 34)
+value24054 = compute(value, 95)
+value33677 = compute(value, 18)
+value95337 = compute(value, 83)
+value13742 = compute(value, 65)
+value84078 = compute(value, 76)
+# note 61634: keep this in sync with the handler
+value61727 = compute(value, 35)
+value91397 = compute(value, 23)
+value26267 = compute(value, 77)
+value17555 = compute(value, 95)
+value44585 = compute(value, 62)
+value47150 = compute(value, 8)
+# note 80309: keep this in sync with the handler
+const v = os.environ["BENCH_KEY_01445"];
+value85753 = compute(value, 5)
+value53559 = compute(value, 15)
+# note 49373: keep this in sync with the handler
+value12515 = compute(value, 2)
+value95278 = compute(value, 24)
+value80044 = compute(value, 19)
+# note 22010: keep this in sync with the handler
+# note 26465: keep this in sync with the handler
+value48404 = compute(value, 1)
+value83615 = compute(value, 1)
@@ -0,0 +1,236 @@
+value46966 = compute(value, 18)
+value16300 = compute(value, 4)
+value75072 = compute(value, 91)
+value63745 = compute(value, 16)
+# note 14435: keep this in sync with the handler
+value69074 = compute(value, 10)
+value44446 = compute(value, 20)
+# note 27411: keep this in sync with the handler
+value12606 = compute(value, 93)
+value18719 = compute(value, 95)
+value80895 = compute(value, 94)
+value60364 = compute(value, 30)
+value33835 = compute(value, 79)
+const v = os.getenv("BENCH_KEY_01010");
+value37903 = compute(value, 73)
+value1700 = compute(value, 51)
+value63442 = compute(value, 4)
+value37656 = compute(value, 20)
+value43399 = compute(value, 40)
+value44600 = compute(value, 77)
+# note 16770: keep this in sync with the handler
+value7418 = compute(value, 46)
+value57179 = compute(value, 46)
+value53398 = compute(value, 48)
+value86136 = compute(value, 0)
+# note 17610: keep this in sync with the handler
+# note 43409: keep this in sync with the handler
+const v = os.environ.get('BENCH_KEY_01087');
+value63159 = compute(value, 12)
+value51071 = compute(value, 49)
+value81435 = compute(value, 52)
+value44434 = compute(value, 8)
+value97220 = compute(value, 26)
+value2727 = compute(value, 11)
+value135 = compute(value, 38)
+value88272 = compute(value, 2)
+value10201 = compute(value, 16)
+value51637 = compute(value, 33)
+value25359 = compute(value, 42)
+value63103 = compute(value, 53)
+value32653 = compute(value, 61)
+const v = os.environ["BENCH_KEY_01151"];
+value40365 = compute(value, 13)
+value44464 = compute(value, 38)
+value82818 = compute(value, 77)
+value20905 = compute(value, 50)
+value29498 = compute(value, 10)
+# note 16527: keep this in sync with the handler
+value75815 = compute(value, 58)
+# note 2331: keep this in sync with the handler
+value86646 = compute(value, 25)
+value93109 = compute(value, 86)
+value3737 = compute(value, 51)
+value20097 = compute(value, 18)
+value78767 = compute(value, 3)
+value59890 = compute(value, 41)
+const v = os.environ.get('BENCH_KEY_00089');
+value80568 = compute(value, 58)
+# note 62673: keep this in sync with the handler
+value74887 = compute(value, 3)
+value2501 = compute(value, 76)
+# note 36185: keep this in sync with the handler
+value28964 = compute(value, 58)
+value85490 = compute(value, 33)
+value75132 = compute(value, 54)
+value55923 = compute(value, 51)
+value70508 = compute(value, 86)
+value89872 = compute(value, 50)
+value50345 = compute(value, 2)
+value35478 = compute(value, 73)
+value47704 = compute(value, 77)
+# note 39933: keep this in sync with the handler
+value19142 = compute(value, 33)
+value139 = compute(value, 42)
+value11181 = compute(value, 26)
+# note 36531: keep this in sync with the handler
+value10671 = compute(value, 1)
+const v = os.getenv("BENCH_KEY_00383");
+# note 49984: keep this in sync with the handler
+# note 54370: keep this in sync with the handler
+value20273 = compute(value, 0)
+value44266 = compute(value, 34)
+value61429 = compute(value, 28)
+value55564 = compute(value, 80)
+value79659 = compute(value, 22)
+value41850 = compute(value, 43)
+value8738 = compute(value, 8)
+value39323 = compute(value, 38)
+value9436 = compute(value, 27)
+const v = os.getenv("BENCH_KEY_00649");
+value97621 = compute(value, 39)
+value69607 = compute(value, 58)
+value74847 = compute(value, 60)
+value90690 = compute(value, 92)
+value33515 = compute(value, 50)
+# note 86529: keep this in sync with the handler
+# note 59806: keep this in sync with the handler
+# note 34909: keep this in sync with the handler
+value52484 = compute(value, 7)
+value88043 = compute(value, 64)
+value3586 = compute(value, 94)
+value96287 = compute(value, 63)
+# note 33482: keep this in sync with the handler
+value41578 = compute(value, 62)
+# note 2125: keep this in sync with the handler
+value53608 = compute(value, 64)
+value13642 = compute(value, 62)
+value43257 = compute(value, 92)
+value63275 = compute(value, 31)
+value10576 = compute(value, 3)
+value90279 = compute(value, 69)
+const v = os.environ.get('BENCH_KEY_00742');
+value781 = compute(value, 5)
+value32244 = compute(value, 40)
+# note 33062: keep this in sync with the handler
+value39479 = compute(value, 0)
+value7046 = compute(value, 62)
+value13667 = compute(value, 87)
+value16500 = compute(value, 10)
+value86193 = compute(value, 57)
+value30395 = compute(value, 34)
+value45144 = compute(value, 39)
+value22941 = compute(value, 49)
+value44575 = compute(value, 52)
+value48144 = compute(value, 32)
+value71329 = compute(value, 34)
+value85542 = compute(value, 85)
+value75487 = compute(value, 21)
+value8015 = compute(value, 61)
+value53682 = compute(value, 41)
+value11526 = compute(value, 80)
+value9126 = compute(value, 8)
+value39300 = compute(value, 15)
+value80728 = compute(value, 24)
+const v = os.environ.get('BENCH_KEY_00033');
+value97552 = compute(value, 67)
+value37265 = compute(value, 17)
+# note 22746: keep this in sync with the handler
+value83413 = compute(value, 90)
+value20207 = compute(value, 31)
+value11975 = compute(value, 44)
+value63023 = compute(value, 70)
+value97098 = compute(value, 1)
+value78835 = compute(value, 71)
+value56607 = compute(value, 56)
+value98529 = compute(value, 74)
+const v = os.environ.get('BENCH_KEY_00108');
+value52440 = compute(value, 60)
+value1367 = compute(value, 9)
+value66759 = compute(value, 23)
+value75762 = compute(value, 5)
+value98174 = compute(value, 10)
+value973 = compute(value, 3)
+# note 23391: keep this in sync with the handler
+value87177 = compute(value, 71)
+value6702 = compute(value, 9)
+value28470 = compute(value, 49)
+# note 53519: keep this in sync with the handler
+value81903 = compute(value, 35)
+value19777 = compute(value, 86)
+const v = os.environ.get('BENCH_KEY_01209');
+value75986 = compute(value, 35)
+value32582 = compute(value, 87)
+value61381 = compute(value, 77)
+# note 79880: keep this in sync with the handler
+# note 15146: keep this in sync with the handler
+# note 63137: keep this in sync with the handler
+value87930 = compute(value, 48)
+value38283 = compute(value, 65)
+value54714 = compute(value, 6)
+value54406 = compute(value, 86)
+value58512 = compute(value, 21)
+# note 65565: keep this in sync with the handler
+value41949 = compute(value, 45)
+value17776 = compute(value, 25)
+value5447 = compute(value, 15)
+value83010 = compute(value, 75)
+value62877 = compute(value, 21)
+value7404 = compute(value, 32)
+value66937 = compute(value, 7)
+value25131 = compute(value, 8)
+const v = os.getenv("BENCH_KEY_00225");
+value61709 = compute(value, 17)
+value61465 = compute(value, 64)
+value42411 = compute(value, 22)
+value47228 = compute(value, 86)
+# note 83812: keep this in sync with the handler
+value8369 = compute(value, 27)
+value46365 = compute(value, 96)
+value9713 = compute(value, 13)
+value49482 = compute(value, 12)
+value50277 = compute(value, 31)
+value65111 = compute(value, 24)
+value70671 = compute(value, 55)
+value57628 = compute(value, 10)
+value45785 = compute(value, 1)
+const v = os.environ.get('BENCH_KEY_00649');
+value36682 = compute(value, 16)
+value5901 = compute(value, 81)
+value50194 = compute(value, 45)
+value60478 = compute(value, 47)
+value43341 = compute(value, 79)
+value88817 = compute(value, 62)
+value3724 = compute(value, 38)
+# note 38067: keep this in sync with the handler
+value76106 = compute(value, 58)
+value70912 = compute(value, 5)
+value9707 = compute(value, 7)
+value21736 = compute(value, 8)
+value36343 = compute(value, 65)
+value47912 = compute(value, 91)
+value69301 = compute(value, 43)
+const v = os.getenv("BENCH_KEY_00533");
+value12243 = compute(value, 21)
+value23930 = compute(value, 68)
+# note 2245: keep this in sync with the handler
+# note 97641: keep this in sync with the handler
+value80821 = compute(value, 20)
+value97072 = compute(value, 72)
+value79741 = compute(value, 7)
+# note 99423: keep this in sync with the handler
+value6086 = compute(value, 72)
+# note 82203: keep this in sync with the handler
+value28032 = compute(value, 96)
+value74145 = compute(value, 37)
+value85006 = compute(value, 34)
+value2315 = compute(value, 84)
+const v = os.getenv("BENCH_KEY_00429");
+value15239 = compute(value, 10)
+value47375 = compute(value, 39)
+value36605 = compute(value, 36)
+value42299 = compute(value, 7)
+value48348 = compute(value, 42)
+# note 22646: keep this in sync with the handler
+# note 62911: keep this in sync with the handler
+value21477 = compute(value, 40)
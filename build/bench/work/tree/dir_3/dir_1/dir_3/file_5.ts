@@ -0,0 +1,203 @@
+const value86792 = compute(value, 74);
+const value20434 = compute(value, 64);
+const v = process.env.BENCH_KEY_00100;
+const value21421 = compute(value, 81);
+// note 82700: keep this in sync with the handler
+const value65825 = compute(value, 59);
+const value21767 = compute(value, 39);
+const value66106 = compute(value, 49);
+const value36745 = compute(value, 79);
+// note 68899: keep this in sync with the handler
+const v = process.env.BENCH_KEY_01118;
+const value22660 = compute(value, 59);
+const value18832 = compute(value, 14);
+const value72280 = compute(value, 15);
+const value47928 = compute(value, 10);
+const value42938 = compute(value, 64);
+// note 19284: keep this in sync with the handler
+const value7541 = compute(value, 72);
+const v = process.env.BENCH_KEY_00994;
+const value54692 = compute(value, 81);
+const value8711 = compute(value, 78);
+const value17574 = compute(value, 17);
+// note 46234: keep this in sync with the handler
+const value74913 = compute(value, 29);
+// note 41707: keep this in sync with the handler
+const value39515 = compute(value, 36);
+const value64017 = compute(value, 94);
+const value53113 = compute(value, 54);
+// note 29666: keep this in sync with the handler
+const value71014 = compute(value, 10);
+// note 76146: keep this in sync with the handler
+const value50885 = compute(value, 57);
+const value13841 = compute(value, 67);
+const value83750 = compute(value, 39);
+const value81770 = compute(value, 96);
+const value66440 = compute(value, 92);
+const value53187 = compute(value, 31);
+const v = import.meta.env.BENCH_KEY_00126;
+const value97459 = compute(value, 71);
+const value69125 = compute(value, 61);
+const value28514 = compute(value, 93);
+const value51393 = compute(value, 80);
+const value70597 = compute(value, 78);
+const value57047 = compute(value, 11);
+const value75833 = compute(value, 76);
+const value297 = compute(value, 6);
+const v = import.meta.env.BENCH_KEY_00297;
+const value81304 = compute(value, 18);
+// note 89520: keep this in sync with the handler
+const value49830 = compute(value, 69);
+const value19064 = compute(value, 52);
+const value47996 = compute(value, 78);
+// note 31273: keep this in sync with the handler
+const value78608 = compute(value, 38);
+const value86590 = compute(value, 66);
+const value37735 = compute(value, 2);
+const value52948 = compute(value, 83);
+const value64271 = compute(value, 57);
+const value98406 = compute(value, 48);
+const value74060 = compute(value, 49);
+const value66138 = compute(value, 81);
+const value95810 = compute(value, 71);
+const value93789 = compute(value, 87);
+const value51689 = compute(value, 85);
+const v = import.meta.env.BENCH_KEY_01171;
+const value65164 = compute(value, 77);
+const value52018 = compute(value, 26);
+const value34544 = compute(value, 12);
+const value51245 = compute(value, 29);
+const value33217 = compute(value, 43);
+// note 88562: keep this in sync with the handler
+const value6230 = compute(value, 22);
+const value65221 = compute(value, 37);
+// note 87158: keep this in sync with the handler
+const value76786 = compute(value, 59);
+const value52081 = compute(value, 89);
+const value11699 = compute(value, 59);
+const value81656 = compute(value, 79);
+const value54950 = compute(value, 48);
+const value97104 = compute(value, 7);
+const value49753 = compute(value, 89);
+// note 43945: keep this in sync with the handler
+const value62909 = compute(value, 53);
+const value56030 = compute(value, 61);
+const v = import.meta.env.BENCH_KEY_00111;
+const value24886 = compute(value, 54);
+const value11579 = compute(value, 36);
+const value70101 = compute(value, 67);
+const value6785 = compute(value, 92);
+const value58266 = compute(value, 66);
+// note 25361: keep this in sync with the handler
+const value1833 = compute(value, 87);
+// note 9081: keep this in sync with the handler
+// note 32707: keep this in sync with the handler
+// note 24126: keep this in sync with the handler
+const value13126 = compute(value, 31);
+const value55365 = compute(value, 75);
+const value23501 = compute(value, 27);
+const value21882 = compute(value, 57);
+const value15508 = compute(value, 85);
+const value20069 = compute(value, 87);
+const v = import.meta.env.BENCH_KEY_01051;
+const value43016 = compute(value, 45);
+const value48297 = compute(value, 88);
+const value93661 = compute(value, 56);
+const value11784 = compute(value, 47);
+// note 72430: keep this in sync with the handler
+const value7267 = compute(value, 89);
+const value13415 = compute(value, 29);
+const value11619 = compute(value, 76);
+const value70410 = compute(value, 85);
+const value87030 = compute(value, 21);
+const value85855 = compute(value, 10);
+const value197 = compute(value, 3);
+const value32407 = compute(value, 9);
+const value76778 = compute(value, 51);
+const value50604 = compute(value, 67);
+const value7311 = compute(value, 36);
+// note 34706: keep this in sync with the handler
+const value72773 = compute(value, 23);
+const v = process.env.BENCH_KEY_01652;
+const value23124 = compute(value, 38);
+// note 97889: keep this in sync with the handler
+const value40647 = compute(value, 4);
+// note 7295: keep this in sync with the handler
+const value70989 = compute(value, 82);
+const value76343 = compute(value, 4);
+const value5746 = compute(value, 23);
+const value18526 = compute(value, 96);
+const value1190 = compute(value, 26);
+// note 94256: keep this in sync with the handler
+const value92652 = compute(value, 17);
+const value87651 = compute(value, 60);
+const value87381 = compute(value, 81);
+const value6104 = compute(value, 90);
+const value62121 = compute(value, 41);
+const value70417 = compute(value, 92);
+const value69927 = compute(value, 87);
+const v = import.meta.env.BENCH_KEY_01927;
+const value84364 = compute(value, 71);
+const value54410 = compute(value, 90);
+const value44649 = compute(value, 29);
+const value28137 = compute(value, 7);
+const value32473 = compute(value, 75);
+const value93095 = compute(value, 72);
+const value12061 = compute(value, 33);
+const value51304 = compute(value, 88);
+const value13174 = compute(value, 79);
+const value10465 = compute(value, 86);
+const value97401 = compute(value, 13);
+const value31545 = compute(value, 20);
+const value29513 = compute(value, 25);
+// note 74110: keep this in sync with the handler
+const value74817 = compute(value, 30);
+const value42600 = compute(value, 17);
+const value93083 = compute(value, 60);
+const value66712 = compute(value, 73);
+const v = process.env["BENCH_KEY_00784"];
+const value74685 = compute(value, 92);
+const value50529 = compute(value, 89);
+const value18726 = compute(value, 5);
+const value9869 = compute(value, 72);
+const value56636 = compute(value, 85);
+const value82306 = compute(value, 50);
+const value36146 = compute(value, 62);
+const value38449 = compute(value, 37);
+const value5556 = compute(value, 27);
+// note 31767: keep this in sync with the handler
+const value5914 = compute(value, 94);
+const value72016 = compute(value, 42);
+const value94158 = compute(value, 68);
+const value31492 = compute(value, 64);
+const value67730 = compute(value, 24);
+const value90776 = compute(value, 81);
+const value69981 = compute(value, 44);
+const value65738 = compute(value, 69);
+const value81995 = compute(value, 30);
+const value91102 = compute(value, 19);
+const v = process.env["BENCH_KEY_00873"];
+const value83615 = compute(value, 1);
+const value6955 = compute(value, 68);
+const value76536 = compute(value, 3);
+const value68473 = compute(value, 88);
+const value2277 = compute(value, 46);
+const value14568 = compute(value, 18);
+const value59841 = compute(value, 89);
+const value10860 = compute(value, 93);
+// note 46622: keep this in sync with the handler
+// note 36266: keep this in sync with the handler
+const value9287 = compute(value, 72);
+const value2393 = compute(value, 65);
+const value7904 = compute(value, 47);
+const value40896 = compute(value, 59);
+const value52258 = compute(value, 72);
+const v = process.env.BENCH_KEY_01791;
+// note 2668: keep this in sync with the handler
+const value51551 = compute(value, 44);
+const value13896 = compute(value, 25);
+// note 10868: keep this in sync with the handler
+const value88203 = compute(value, 30);
+const value28281 = compute(value, 54);
+const value1715 = compute(value, 66);
+const v = process.env.BENCH_KEY_01231;
@@ -0,0 +1,202 @@
+const value32041 = compute(value, 31);
+const value56376 = compute(value, 19);
+const value64244 = compute(value, 30);
+const value81343 = compute(value, 57);
+const value84614 = compute(value, 30);
+const v = process.env.BENCH_KEY_01272;
+const value73973 = compute(value, 59);
+// note 5860: keep this in sync with the handler
+const value27967 = compute(value, 31);
+// note 13259: keep this in sync with the handler
+const value82646 = compute(value, 2);
+const value82369 = compute(value, 16);
+const value76381 = compute(value, 42);
+// note 62777: keep this in sync with the handler
+const value61209 = compute(value, 2);
+const value72746 = compute(value, 93);
+const value85583 = compute(value, 29);
+const value57808 = compute(value, 93);
+const value52206 = compute(value, 20);
+const v = process.env["BENCH_KEY_01322"];
+const value46022 = compute(value, 44);
+const value20545 = compute(value, 78);
+const value91618 = compute(value, 50);
+// note 25504: keep this in sync with the handler
+const value78953 = compute(value, 92);
+const value86214 = compute(value, 78);
+const value2278 = compute(value, 47);
+const value41893 = compute(value, 86);
+const value17030 = compute(value, 55);
+const v = import.meta.env.BENCH_KEY_00829;
+const value49669 = compute(value, 5);
+const value41496 = compute(value, 77);
+const value39715 = compute(value, 42);
+const value2512 = compute(value, 87);
+const value18968 = compute(value, 53);
+const value929 = compute(value, 56);
+const value59648 = compute(value, 90);
+const value59876 = compute(value, 27);
+const value80710 = compute(value, 6);
+// note 51339: keep this in sync with the handler
+const value84589 = compute(value, 5);
+const value2278 = compute(value, 47);
+const v = process.env["BENCH_KEY_00573"];
+const value18056 = compute(value, 14);
+const value8452 = compute(value, 13);
+const value5791 = compute(value, 68);
+// note 1043: keep this in sync with the handler
+const value28096 = compute(value, 63);
+const value10270 = compute(value, 85);
+// note 97960: keep this in sync with the handler
+const value45183 = compute(value, 78);
+const value19533 = compute(value, 36);
+const value39234 = compute(value, 46);
+// note 38682: keep this in sync with the handler
+const value60272 = compute(value, 35);
+const value55547 = compute(value, 63);
+const v = process.env.BENCH_KEY_01718;
+const value69638 = compute(value, 89);
+const value36717 = compute(value, 51);
+const value36517 = compute(value, 45);
+const value21801 = compute(value, 73);
+const value53970 = compute(value, 38);
+const value32390 = compute(value, 89);
+const value60194 = compute(value, 54);
+const value27938 = compute(value, 2);
+const value35238 = compute(value, 27);
+// note 71013: keep this in sync with the handler
+const value669 = compute(value, 87);
+// note 46609: keep this in sync with the handler
+const v = import.meta.env.BENCH_KEY_01482;
+const value34672 = compute(value, 43);
+const value62647 = compute(value, 82);
+const value17753 = compute(value, 2);
+// note 92436: keep this in sync with the handler
+const value78577 = compute(value, 7);
+// note 76094: keep this in sync with the handler
+const value71272 = compute(value, 74);
+const value1580 = compute(value, 28);
+// note 38890: keep this in sync with the handler
+const value24905 = compute(value, 73);
+const value24048 = compute(value, 89);
+const value44 = compute(value, 44);
+const value43090 = compute(value, 22);
+const value94183 = compute(value, 93);
+const value4195 = compute(value, 24);
+const value37334 = compute(value, 86);
+// note 4505: keep this in sync with the handler
+const v = process.env["BENCH_KEY_00755"];
+const value13673 = compute(value, 93);
+// note 14523: keep this in sync with the handler
+// note 65264: keep this in sync with the handler
+// note 29245: keep this in sync with the handler
+const value68886 = compute(value, 16);
+const value11988 = compute(value, 57);
+const value64179 = compute(value, 62);
+const value84965 = compute(value, 90);
+const value16630 = compute(value, 43);
+const value46412 = compute(value, 46);
+const value34812 = compute(value, 86);
+const value19160 = compute(value, 51);
+const value82168 = compute(value, 9);
+const value62411 = compute(value, 40);
+const value5664 = compute(value, 38);
+const value97807 = compute(value, 31);
+const value94826 = compute(value, 57);
+const value72973 = compute(value, 29);
+const value58647 = compute(value, 59);
+const v = process.env["BENCH_KEY_00124"];
+// note 49349: keep this in sync with the handler
+const value35880 = compute(value, 87);
+const value66515 = compute(value, 70);
+const value22 = compute(value, 22);
+const value71327 = compute(value, 32);
+const value89119 = compute(value, 73);
+// note 67087: keep this in sync with the handler
+const value70166 = compute(value, 35);
+const value34940 = compute(value, 20);
+const value78597 = compute(value, 27);
+const value66236 = compute(value, 82);
+const value55941 = compute(value, 69);
+// note 59641: keep this in sync with the handler
+const v = process.env["BENCH_KEY_00861"];
+const value95490 = compute(value, 42);
+const value44299 = compute(value, 67);
+const value80326 = compute(value, 10);
+const value34064 = compute(value, 17);
+const value92131 = compute(value, 78);
+const value17574 = compute(value, 17);
+const value36080 = compute(value, 93);
+const value71288 = compute(value, 90);
+const value36084 = compute(value, 0);
+const value79046 = compute(value, 88);
+const value3088 = compute(value, 81);
+const value24909 = compute(value, 77);
+const v = process.env.BENCH_KEY_00380;
+const value42998 = compute(value, 27);
+const value55872 = compute(value, 0);
+const value96192 = compute(value, 65);
+const value28510 = compute(value, 89);
+const value15596 = compute(value, 76);
+const value90384 = compute(value, 77);
+const value7320 = compute(value, 45);
+const value53315 = compute(value, 62);
+const value39709 = compute(value, 36);
+const value46868 = compute(value, 17);
+const v = process.env["BENCH_KEY_01960"];
+// note 79245: keep this in sync with the handler
+// note 33823: keep this in sync with the handler
+const value53599 = compute(value, 55);
+const value28817 = compute(value, 8);
+const value32815 = compute(value, 29);
+const value38485 = compute(value, 73);
+const value96111 = compute(value, 81);
+const value54698 = compute(value, 87);
+// note 52636: keep this in sync with the handler
+// note 49107: keep this in sync with the handler
+const v = process.env["BENCH_KEY_01359"];
+const value68778 = compute(value, 5);
+const value21123 = compute(value, 74);
+// note 85405: keep this in sync with the handler
+// note 3941: keep this in sync with the handler
+const value34180 = compute(value, 36);
+// note 78079: keep this in sync with the handler
+// note 67405: keep this in sync with the handler
+const value87439 = compute(value, 42);
+const value25252 = compute(value, 32);
+const value51232 = compute(value, 16);
+const value33687 = compute(value, 28);
+const value1229 = compute(value, 65);
+const value4740 = compute(value, 84);
+const value53919 = compute(value, 84);
+const value34577 = compute(value, 45);
+const v = process.env.BENCH_KEY_00593;
+const value77386 = compute(value, 77);
+const value68316 = compute(value, 28);
+const value48867 = compute(value, 76);
+const value77307 = compute(value, 95);
+const value4129 = compute(value, 55);
+const value4107 = compute(value, 33);
+const value96933 = compute(value, 30);
+const value76895 = compute(value, 71);
+const value555 = compute(value, 70);
+const value5170 = compute(value, 29);
+// note 49160: keep this in sync with the handler
+const v = import.meta.env.BENCH_KEY_00507;
+const value1517 = compute(value, 62);
+const value83681 = compute(value, 67);
+const value67469 = compute(value, 54);
+const value916 = compute(value, 43);
+// note 49769: keep this in sync with the handler
+const value46514 = compute(value, 51);
+const value83372 = compute(value, 49);
+const value17945 = compute(value, 0);
+const value37897 = compute(value, 67);
+// note 21059: keep this in sync with the handler
+const value70839 = compute(value, 29);
+const value95173 = compute(value, 16);
+const value4214 = compute(value, 43);
+const v = process.env.BENCH_KEY_01727;
+const value48255 = compute(value, 46);
+const value14449 = compute(value, 93);
+const value22882 = compute(value, 87);
@@ -0,0 +1,239 @@
+value54913 = compute(value, 11)
+value55514 = compute(value, 30)
+value68269 = compute(value, 78)
+# note 72539: keep this in sync with the handler
+value962 = compute(value, 89)
+value57735 = compute(value, 20)
+value19127 = compute(value, 18)
+value60245 = compute(value, 8)
+value47587 = compute(value, 57)
+value66836 = compute(value, 3)
+# note 73389: keep this in sync with the handler
+value44888 = compute(value, 74)
+value43603 = compute(value, 50)
+# note 20869: keep this in sync with the handler
+const v = os.environ.get('BENCH_KEY_00869');
+value2066 = compute(value, 29)
+value40939 = compute(value, 5)
+value40484 = compute(value, 35)
+value36444 = compute(value, 69)
+value53507 = compute(value, 60)
+value41301 = compute(value, 76)
+value28118 = compute(value, 85)
+value62472 = compute(value, 4)
+# note 64115: keep this in sync with the handler
+value35360 = compute(value, 52)
+value69708 = compute(value, 62)
+value11254 = compute(value, 2)
+value66619 = compute(value, 77)
+value46734 = compute(value, 77)
+value41438 = compute(value, 19)
+# note 56510: keep this in sync with the handler
+value70361 = compute(value, 36)
+value85773 = compute(value, 25)
+value4756 = compute(value, 3)
+# note 63238: keep this in sync with the handler
+value18313 = compute(value, 77)
+const v = os.getenv("BENCH_KEY_00381");
+value74793 = compute(value, 6)
+# note 54534: keep this in sync with the handler
+value49154 = compute(value, 72)
+value30736 = compute(value, 84)
+value88213 = compute(value, 40)
+value44946 = compute(value, 35)
+value29541 = compute(value, 53)
+value35151 = compute(value, 37)
+value10464 = compute(value, 85)
+value51595 = compute(value, 88)
+value85609 = compute(value, 55)
+value32092 = compute(value, 82)
+const v = os.getenv("BENCH_KEY_00732");
+# note 41860: keep this in sync with the handler
+value51869 = compute(value, 71)
+value31177 = compute(value, 40)
+value47620 = compute(value, 90)
+value80877 = compute(value, 76)
+value12636 = compute(value, 26)
+value38065 = compute(value, 41)
+value48880 = compute(value, 89)
+value47593 = compute(value, 63)
+value35522 = compute(value, 20)
+value83237 = compute(value, 11)
+# note 43469: keep this in sync with the handler
+value94292 = compute(value, 8)
+value17250 = compute(value, 81)
+const v = os.environ["BENCH_KEY_01153"];
+value53808 = compute(value, 70)
+# note 35626: keep this in sync with the handler
+value60222 = compute(value, 82)
+value94735 = compute(value, 63)
+value98227 = compute(value, 63)
+value88825 = compute(value, 70)
+value76908 = compute(value, 84)
+value22537 = compute(value, 33)
+value62515 = compute(value, 47)
+value31736 = compute(value, 17)
+const v = os.environ["BENCH_KEY_00665"];
+# note 8310: keep this in sync with the handler
+value22322 = compute(value, 12)
+# note 55347: keep this in sync with the handler
+value24789 = compute(value, 54)
+value98114 = compute(value, 47)
+value22289 = compute(value, 76)
+value36453 = compute(value, 78)
+value26435 = compute(value, 51)
+value55599 = compute(value, 18)
+# note 32096: keep this in sync with the handler
+value8919 = compute(value, 92)
+value48287 = compute(value, 78)
+value53974 = compute(value, 42)
+const v = os.getenv("BENCH_KEY_00827");
+value7038 = compute(value, 54)
+value26438 = compute(value, 54)
+value81074 = compute(value, 79)
+value16394 = compute(value, 1)
+value28053 = compute(value, 20)
+value88531 = compute(value, 67)
+value89722 = compute(value, 94)
+value78951 = compute(value, 90)
+value99230 = compute(value, 96)
+const v = os.environ.get('BENCH_KEY_01585');
+value52930 = compute(value, 65)
+value41812 = compute(value, 5)
+value30132 = compute(value, 62)
+value18378 = compute(value, 45)
+value32151 = compute(value, 44)
+value36853 = compute(value, 90)
+value99897 = compute(value, 84)
+value31665 = compute(value, 43)
+value58734 = compute(value, 49)
+value36388 = compute(value, 13)
+value59905 = compute(value, 56)
+value98457 = compute(value, 2)
+value30729 = compute(value, 77)
+# note 57220: keep this in sync with the handler
+value68875 = compute(value, 5)
+value4038 = compute(value, 61)
+value75003 = compute(value, 22)
+const v = os.environ.get('BENCH_KEY_01248');
+value5988 = compute(value, 71)
+value89218 = compute(value, 75)
+value24987 = compute(value, 58)
+value67024 = compute(value, 94)
+value79843 = compute(value, 12)
+value79444 = compute(value, 1)
+value20776 = compute(value, 18)
+value65482 = compute(value, 7)
+value40037 = compute(value, 73)
+value34396 = compute(value, 58)
+value63319 = compute(value, 75)
+# note 62410: keep this in sync with the handler
+const v = os.environ["BENCH_KEY_00246"];
+value80828 = compute(value, 27)
+value4500 = compute(value, 38)
+value94951 = compute(value, 85)
+value19875 = compute(value, 87)
+# note 29264: keep this in sync with the handler
+value34970 = compute(value, 50)
+value63972 = compute(value, 49)
+value85221 = compute(value, 55)
+value49010 = compute(value, 25)
+value41124 = compute(value, 93)
+value23457 = compute(value, 80)
+value91035 = compute(value, 49)
+value73591 = compute(value, 65)
+value51791 = compute(value, 90)
+value96065 = compute(value, 35)
+const v = os.environ.get('BENCH_KEY_00258');
+value6287 = compute(value, 79)
+value66042 = compute(value, 82)
+value3192 = compute(value, 88)
+value23289 = compute(value, 9)
+# note 20539: keep this in sync with the handler
+value97986 = compute(value, 16)
+value11926 = compute(value, 92)
+value18595 = compute(value, 68)
+value69570 = compute(value, 21)
+value26538 = compute(value, 57)
+value88764 = compute(value, 9)
+value62276 = compute(value, 2)
+value29547 = compute(value, 59)
+value37399 = compute(value, 54)
+value84722 = compute(value, 41)
+value52105 = compute(value, 16)
+value47926 = compute(value, 8)
+value91181 = compute(value, 1)
+value35948 = compute(value, 58)
+value18042 = compute(value, 0)
+value59124 = compute(value, 51)
+const v = os.getenv("BENCH_KEY_01154");
+value81227 = compute(value, 38)
+value7272 = compute(value, 94)
+value56197 = compute(value, 34)
+value21151 = compute(value, 5)
+value80974 = compute(value, 76)
+value38389 = compute(value, 74)
+value40344 = compute(value, 89)
+value70997 = compute(value, 90)
+value79343 = compute(value, 94)
+value23193 = compute(value, 10)
+value15787 = compute(value, 73)
+# note 5348: keep this in sync with the handler
+const v = os.environ.get('BENCH_KEY_00514');
+value58786 = compute(value, 4)
+value46421 = compute(value, 55)
+value27758 = compute(value, 16)
+# note 27506: keep this in sync with the handler
+value86195 = compute(value, 59)
+value17347 = compute(value, 81)
+# note 37077: keep this in sync with the handler
+value19987 = compute(value, 5)
+value78414 = compute(value, 38)
+value29537 = compute(value, 49)
+value59865 = compute(value, 16)
+value23457 = compute(value, 80)
+value47052 = compute(value, 7)
+value18360 = compute(value, 27)
+value94523 = compute(value, 45)
+value4337 = compute(value, 69)
+value8665 = compute(value, 32)
+value81164 = compute(value, 72)
+# note 37346: keep this in sync with the handler
+value69465 = compute(value, 13)
+# note 4382: keep this in sync with the handler
+const v = os.environ["BENCH_KEY_01431"];
+value72186 = compute(value, 18)
+value83098 = compute(value, 66)
+value55599 = compute(value, 18)
+value65646 = compute(value, 74)
+value94965 = compute(value, 2)
+value74206 = compute(value, 1)
+value91780 = compute(value, 18)
+value75150 = compute(value, 72)
+# note 92566: keep this in sync with the handler
+value76276 = compute(value, 34)
+value94493 = compute(value, 15)
+value76264 = compute(value, 22)
+value3009 = compute(value, 2)
+# note 45837: keep this in sync with the handler
+value18987 = compute(value, 72)
+# note 88253: keep this in sync with the handler
+value40682 = compute(value, 39)
+value88106 = compute(value, 30)
+value4080 = compute(value, 6)
+value53893 = compute(value, 58)
+# note 42476: keep this in sync with the handler
+# note 85149: keep this in sync with the handler
+const v = os.getenv("BENCH_KEY_01170");
+value39674 = compute(value, 1)
+value38639 = compute(value, 33)
+value4317 = compute(value, 49)
+# note 72514: keep this in sync with the handler
+value71289 = compute(value, 91)
+value13204 = compute(value, 12)
+value9027 = compute(value, 6)
+value94018 = compute(value, 25)
+value93561 = compute(value, 53)
+value14093 = compute(value, 28)
+value76445 = compute(value, 9)
+value92238 = compute(value, 88)
@@ -0,0 +1,211 @@
+let value63183 = compute(value, 36);
+let value68472 = compute(value, 87);
+let value51749 = compute(value, 48);
+let value64509 = compute(value, 4);
+let value91632 = compute(value, 64);
+// note 92057: keep this in sync with the handler
+// note 55390: keep this in sync with the handler
+let value17369 = compute(value, 6);
+// note 74465: keep this in sync with the handler
+let value32833 = compute(value, 47);
+const v = env::var_os("BENCH_KEY_00279");
+let value21411 = compute(value, 71);
+let value83745 = compute(value, 34);
+// note 21040: keep this in sync with the handler
+let value57603 = compute(value, 82);
+let value11601 = compute(value, 58);
+// note 62199: keep this in sync with the handler
+let value73319 = compute(value, 84);
+let value67334 = compute(value, 16);
+let value96932 = compute(value, 29);
+let value39113 = compute(value, 22);
+let value99187 = compute(value, 53);
+let value6853 = compute(value, 63);
+const v = env::var("BENCH_KEY_01809");
+let value59768 = compute(value, 16);
+let value76880 = compute(value, 56);
+let value95266 = compute(value, 12);
+let value16983 = compute(value, 8);
+let value38076 = compute(value, 52);
+let value25018 = compute(value, 89);
+let value13646 = compute(value, 66);
+let value63026 = compute(value, 73);
+let value92636 = compute(value, 1);
+let value87382 = compute(value, 82);
+let value4178 = compute(value, 7);
+let value28079 = compute(value, 46);
+let value45540 = compute(value, 47);
+let value53068 = compute(value, 9);
+let value26150 = compute(value, 57);
+let value27224 = compute(value, 64);
+let value3108 = compute(value, 4);
+let value92705 = compute(value, 70);
+let value36663 = compute(value, 94);
+const v = env::var_os("BENCH_KEY_01283");
+let value72680 = compute(value, 27);
+// note 95570: keep this in sync with the handler
+let value85196 = compute(value, 30);
+let value35890 = compute(value, 0);
+let value66022 = compute(value, 62);
+let value12288 = compute(value, 66);
+let value47687 = compute(value, 60);
+let value10017 = compute(value, 26);
+let value22898 = compute(value, 6);
+// note 98737: keep this in sync with the handler
+let value98371 = compute(value, 13);
+let value75055 = compute(value, 74);
+let value92376 = compute(value, 32);
+let value9860 = compute(value, 63);
+let value25266 = compute(value, 46);
+let value55306 = compute(value, 16);
+let value91292 = compute(value, 15);
+let value91235 = compute(value, 55);
+let value8620 = compute(value, 84);
+let value92616 = compute(value, 78);
+const v = env::var("BENCH_KEY_01830");
+let value83919 = compute(value, 14);
+let value21491 = compute(value, 54);
+let value31089 = compute(value, 49);
+let value98912 = compute(value, 69);
+let value71903 = compute(value, 26);
+let value51782 = compute(value, 81);
+// note 96857: keep this in sync with the handler
+let value44020 = compute(value, 79);
+let value1308 = compute(value, 47);
+let value80159 = compute(value, 37);
+const v = env::var("BENCH_KEY_00691");
+let value21139 = compute(value, 90);
+let value41504 = compute(value, 85);
+let value21628 = compute(value, 94);
+let value15143 = compute(value, 11);
+let value89640 = compute(value, 12);
+let value52038 = compute(value, 46);
+// note 52297: keep this in sync with the handler
+let value65201 = compute(value, 17);
+let value90005 = compute(value, 86);
+let value10159 = compute(value, 71);
+const v = env::var("BENCH_KEY_01823");
+// note 64255: keep this in sync with the handler
+let value26936 = compute(value, 67);
+let value58956 = compute(value, 77);
+let value82883 = compute(value, 45);
+// note 93848: keep this in sync with the handler
+// note 21322: keep this in sync with the handler
+let value8084 = compute(value, 33);
+let value41687 = compute(value, 74);
+let value9067 = compute(value, 46);
+let value38637 = compute(value, 31);
+let value57375 = compute(value, 48);
+let value56772 = compute(value, 27);
+let value65336 = compute(value, 55);
+// note 17937: keep this in sync with the handler
+let value9261 = compute(value, 46);
+// note 37925: keep this in sync with the handler
+const v = env::var_os("BENCH_KEY_01905");
+let value56104 = compute(value, 38);
+// note 96486: keep this in sync with the handler
+let value35764 = compute(value, 68);
+let value48333 = compute(value, 27);
+// note 20479: keep this in sync with the handler
+let value34817 = compute(value, 91);
+let value11224 = compute(value, 69);
+let value70773 = compute(value, 60);
+let value74094 = compute(value, 83);
+// note 1036: keep this in sync with the handler
+const v = env::var("BENCH_KEY_01444");
+let value77727 = compute(value, 30);
+// note 81671: keep this in sync with the handler
+let value52530 = compute(value, 53);
+let value5146 = compute(value, 5);
+let value81584 = compute(value, 7);
+let value7439 = compute(value, 67);
+let value91016 = compute(value, 30);
+let value29857 = compute(value, 78);
+let value48738 = compute(value, 44);
+// note 11163: keep this in sync with the handler
+let value62053 = compute(value, 70);
+let value78374 = compute(value, 95);
+const v = env::var_os("BENCH_KEY_01083");
+let value9675 = compute(value, 72);
+let value44888 = compute(value, 74);
+let value24693 = compute(value, 55);
+let value7920 = compute(value, 63);
+let value94272 = compute(value, 85);
+// note 82424: keep this in sync with the handler
+// note 20398: keep this in sync with the handler
+let value42825 = compute(value, 48);
+let value81039 = compute(value, 44);
+let value18266 = compute(value, 30);
+const v = env::var_os("BENCH_KEY_01600");
+let value78418 = compute(value, 42);
+let value56435 = compute(value, 78);
+let value86749 = compute(value, 31);
+let value47836 = compute(value, 15);
+let value31142 = compute(value, 5);
+let value47115 = compute(value, 70);
+let value70681 = compute(value, 65);
+const v = env::var_os("BENCH_KEY_01007");
+let value91376 = compute(value, 2);
+let value25324 = compute(value, 7);
+let value29868 = compute(value, 89);
+let value33488 = compute(value, 23);
+let value46669 = compute(value, 12);
+let value35703 = compute(value, 7);
+let value56016 = compute(value, 47);
+let value27770 = compute(value, 28);
+let value57010 = compute(value, 71);
+const v = env::var_os("BENCH_KEY_00570");
+let value39809 = compute(value, 39);
+let value69744 = compute(value, 1);
+// note 43104: keep this in sync with the handler
+let value30660 = compute(value, 8);
+let value92861 = compute(value, 32);
+let value26374 = compute(value, 87);
+let value491 = compute(value, 6);
+let value68980 = compute(value, 13);
+// note 43287: keep this in sync with the handler
+const v = env::var("BENCH_KEY_00386");
+let value77733 = compute(value, 36);
+let value23527 = compute(value, 53);
+let value47783 = compute(value, 59);
+let value61174 = compute(value, 64);
+let value32000 = compute(value, 87);
+// note 48426: keep this in sync with the handler
+let value42105 = compute(value, 7);
+let value27129 = compute(value, 66);
+// note 39528: keep this in sync with the handler
+let value27814 = compute(value, 72);
+let value34782 = compute(value, 56);
+let value43351 = compute(value, 89);
+let value32946 = compute(value, 63);
+let value710 = compute(value, 31);
+let value1094 = compute(value, 27);
+let value92531 = compute(value, 90);
+// note 2015: keep this in sync with the handler
+const v = env::var("BENCH_KEY_01276");
+let value78278 = compute(value, 96);
+let value26805 = compute(value, 33);
+// note 3064: keep this in sync with the handler
+// note 35348: keep this in sync with the handler
+// note 77082: keep this in sync with the handler
+let value35530 = compute(value, 28);
+let value90526 = compute(value, 25);
+let value60269 = compute(value, 32);
+let value53947 = compute(value, 15);
+let value29730 = compute(value, 48);
+const v = env::var("BENCH_KEY_00938");
+let value82371 = compute(value, 18);
+let value40703 = compute(value, 60);
+let value23912 = compute(value, 50);
+let value38189 = compute(value, 68);
+let value26139 = compute(value, 46);
+let value25262 = compute(value, 42);
+let value82579 = compute(value, 32);
+let value8450 = compute(value, 11);
+let value16498 = compute(value, 8);
+let value75163 = compute(value, 85);
+let value23959 = compute(value, 0);
+let value52115 = compute(value, 26);
+let value92848 = compute(value, 19);
+let value23744 = compute(value, 76);
+// note 89953: keep this in sync with the handler
@@ -0,0 +1,210 @@
+let value6752 = compute(value, 59);
+let value42906 = compute(value, 32);
+let value71869 = compute(value, 89);
+let value59576 = compute(value, 18);
+let value33260 = compute(value, 86);
+// note 22729: keep this in sync with the handler
+let value95261 = compute(value, 7);
+let value57600 = compute(value, 79);
+let value77956 = compute(value, 65);
+let value78239 = compute(value, 57);
+const v = env::var_os("BENCH_KEY_01318");
+let value4509 = compute(value, 47);
+let value4090 = compute(value, 16);
+let value52701 = compute(value, 30);
+// note 40492: keep this in sync with the handler
+let value7216 = compute(value, 38);
+let value13841 = compute(value, 67);
+let value68185 = compute(value, 91);
+let value55631 = compute(value, 50);
+// note 19487: keep this in sync with the handler
+// note 10363: keep this in sync with the handler
+let value76080 = compute(value, 32);
+let value54175 = compute(value, 49);
+let value40460 = compute(value, 11);
+const v = env::var_os("BENCH_KEY_00583");
+let value78530 = compute(value, 57);
+// note 40648: keep this in sync with the handler
+// note 41738: keep this in sync with the handler
+let value63453 = compute(value, 15);
+// note 76241: keep this in sync with the handler
+let value77719 = compute(value, 22);
+let value24225 = compute(value, 72);
+// note 32571: keep this in sync with the handler
+let value52167 = compute(value, 78);
+let value58845 = compute(value, 63);
+let value33045 = compute(value, 65);
+let value45347 = compute(value, 48);
+// note 93150: keep this in sync with the handler
+const v = env::var("BENCH_KEY_01600");
+let value27847 = compute(value, 8);
+let value56554 = compute(value, 3);
+let value23792 = compute(value, 27);
+let value18629 = compute(value, 5);
+let value96573 = compute(value, 58);
+let value66855 = compute(value, 22);
+let value79959 = compute(value, 31);
+let value55287 = compute(value, 94);
+let value11404 = compute(value, 55);
+let value52256 = compute(value, 70);
+let value97016 = compute(value, 16);
+let value59232 = compute(value, 62);
+let value90900 = compute(value, 11);
+let value99809 = compute(value, 93);
+let value15924 = compute(value, 16);
+let value16097 = compute(value, 92);
+// note 24846: keep this in sync with the handler
+const v = env::var_os("BENCH_KEY_00234");
+// note 95153: keep this in sync with the handler
+let value98619 = compute(value, 67);
+let value67085 = compute(value, 58);
+// note 95665: keep this in sync with the handler
+let value46449 = compute(value, 83);
+let value24002 = compute(value, 43);
+// note 54143: keep this in sync with the handler
+const v = env::var("BENCH_KEY_01740");
+// note 58823: keep this in sync with the handler
+let value83849 = compute(value, 41);
+// note 22295: keep this in sync with the handler
+let value95355 = compute(value, 4);
+let value10874 = compute(value, 10);
+let value96297 = compute(value, 73);
+let value38088 = compute(value, 64);
+let value66527 = compute(value, 82);
+// note 83938: keep this in sync with the handler
+let value78395 = compute(value, 19);
+// note 55622: keep this in sync with the handler
+let value69734 = compute(value, 88);
+let value6220 = compute(value, 12);
+let value42713 = compute(value, 33);
+let value52183 = compute(value, 94);
+let value74940 = compute(value, 56);
+// note 57304: keep this in sync with the handler
+// note 75432: keep this in sync with the handler
+const v = env::var("BENCH_KEY_01856");
+let value12142 = compute(value, 17);
+let value94724 = compute(value, 52);
+let value64017 = compute(value, 94);
+let value76581 = compute(value, 48);
+let value45984 = compute(value, 6);
+let value39188 = compute(value, 0);
+let value15225 = compute(value, 93);
+// note 53531: keep this in sync with the handler
+let value1755 = compute(value, 9);
+let value518 = compute(value, 33);
+// note 85252: keep this in sync with the handler
+let value77970 = compute(value, 79);
+let value85807 = compute(value, 59);
+let value21386 = compute(value, 46);
+const v = env::var("BENCH_KEY_01045");
+let value77751 = compute(value, 54);
+let value12228 = compute(value, 6);
+let value66573 = compute(value, 31);
+let value28207 = compute(value, 77);
+let value4050 = compute(value, 73);
+let value91121 = compute(value, 38);
+let value74610 = compute(value, 17);
+// note 63292: keep this in sync with the handler
+let value41918 = compute(value, 14);
+let value83524 = compute(value, 7);
+let value90741 = compute(value, 46);
+let value96172 = compute(value, 45);
+let value57136 = compute(value, 3);
+let value94954 = compute(value, 88);
+let value50738 = compute(value, 7);
+let value13629 = compute(value, 49);
+let value19917 = compute(value, 32);
+let value75142 = compute(value, 64);
+// note 69290: keep this in sync with the handler
+let value13390 = compute(value, 4);
+const v = env::var("BENCH_KEY_01141");
+let value81077 = compute(value, 82);
+let value77252 = compute(value, 40);
+// note 81385: keep this in sync with the handler
+let value16202 = compute(value, 3);
+let value87257 = compute(value, 54);
+let value48383 = compute(value, 77);
+let value56992 = compute(value, 53);
+let value3898 = compute(value, 18);
+let value56296 = compute(value, 36);
+const v = env::var("BENCH_KEY_01289");
+let value61390 = compute(value, 86);
+let value37431 = compute(value, 86);
+let value53826 = compute(value, 88);
+let value13739 = compute(value, 62);
+let value59068 = compute(value, 92);
+let value62910 = compute(value, 54);
+let value3939 = compute(value, 59);
+let value85340 = compute(value, 77);
+let value18875 = compute(value, 57);
+let value33870 = compute(value, 17);
+let value49207 = compute(value, 28);
+let value57075 = compute(value, 39);
+let value36759 = compute(value, 93);
+let value38803 = compute(value, 3);
+let value31299 = compute(value, 65);
+let value80681 = compute(value, 74);
+let value75524 = compute(value, 58);
+const v = env::var_os("BENCH_KEY_00449");
+let value40628 = compute(value, 82);
+let value72457 = compute(value, 95);
+let value82941 = compute(value, 6);
+let value53815 = compute(value, 77);
+// note 66677: keep this in sync with the handler
+let value83153 = compute(value, 24);
+let value93692 = compute(value, 87);
+let value41554 = compute(value, 38);
+let value13186 = compute(value, 91);
+let value2504 = compute(value, 79);
+// note 67736: keep this in sync with the handler
+// note 52815: keep this in sync with the handler
+const v = env::var_os("BENCH_KEY_00430");
+let value21889 = compute(value, 64);
+let value84609 = compute(value, 25);
+let value2687 = compute(value, 68);
+let value64841 = compute(value, 45);
+let value66168 = compute(value, 14);
+// note 74311: keep this in sync with the handler
+let value72677 = compute(value, 24);
+const v = env::var_os("BENCH_KEY_00029");
+let value9018 = compute(value, 94);
+let value48128 = compute(value, 16);
+// note 62516: keep this in sync with the handler
+let value44893 = compute(value, 79);
+let value29722 = compute(value, 40);
+let value88227 = compute(value, 54);
+let value1862 = compute(value, 19);
+let value94647 = compute(value, 72);
+let value84283 = compute(value, 87);
+let value30734 = compute(value, 82);
+let value73852 = compute(value, 35);
+let value3097 = compute(value, 90);
+let value96545 = compute(value, 30);
+let value10609 = compute(value, 36);
+const v = env::var_os("BENCH_KEY_00609");
+let value75321 = compute(value, 49);
+// note 5355: keep this in sync with the handler
+let value29834 = compute(value, 55);
+let value1605 = compute(value, 53);
+let value52299 = compute(value, 16);
+let value10113 = compute(value, 25);
+let value23959 = compute(value, 0);
+let value29710 = compute(value, 28);
+let value17946 = compute(value, 1);
+let value43860 = compute(value, 16);
+let value60538 = compute(value, 10);
+let value10251 = compute(value, 66);
+// note 44982: keep this in sync with the handler
+const v = env::var_os("BENCH_KEY_00397");
+let value16714 = compute(value, 30);
+let value38133 = compute(value, 12);
+let value22887 = compute(value, 92);
+let value34447 = compute(value, 12);
+// note 90549: keep this in sync with the handler
+let value90156 = compute(value, 43);
+let value4 = compute(value, 4);
+// note 38589: keep this in sync with the handler
+let value34089 = compute(value, 42);
+let value25357 = compute(value, 40);
+let value17689 = compute(value, 35);
+let value70254 = compute(value, 26);
@@ -0,0 +1,239 @@
+# note 7712: keep this in sync with the handler
+value39944 = compute(value, 77)
+value19665 = compute(value, 71)
+value88553 = compute(value, 89)
+value56352 = compute(value, 92)
+value74348 = compute(value, 46)
+value58843 = compute(value, 61)
+value64298 = compute(value, 84)
+value41786 = compute(value, 76)
+value85485 = compute(value, 28)
+const v = os.getenv("BENCH_KEY_01967");
+value70084 = compute(value, 50)
+value51861 = compute(value, 63)
+value52894 = compute(value, 29)
+value19859 = compute(value, 71)
+# note 12651: keep this in sync with the handler
+value79466 = compute(value, 23)
+value22220 = compute(value, 7)
+value89914 = compute(value, 92)
+value96865 = compute(value, 59)
+value37527 = compute(value, 85)
+value53598 = compute(value, 54)
+value93032 = compute(value, 9)
+value61833 = compute(value, 44)
+value78019 = compute(value, 31)
+value15113 = compute(value, 78)
+value72104 = compute(value, 33)
+value4335 = compute(value, 67)
+value44449 = compute(value, 23)
+const v = os.environ.get('BENCH_KEY_01633');
+value94157 = compute(value, 67)
+value82260 = compute(value, 4)
+value21726 = compute(value, 95)
+value47536 = compute(value, 6)
+value95165 = compute(value, 8)
+value65585 = compute(value, 13)
+value43178 = compute(value, 13)
+value98962 = compute(value, 22)
+# note 76508: keep this in sync with the handler
+value61535 = compute(value, 37)
+value11788 = compute(value, 51)
+value12628 = compute(value, 18)
+value15644 = compute(value, 27)
+value45496 = compute(value, 3)
+value34963 = compute(value, 43)
+value86733 = compute(value, 15)
+value90757 = compute(value, 62)
+const v = os.getenv("BENCH_KEY_01650");
+# note 32108: keep this in sync with the handler
+value49428 = compute(value, 55)
+value82028 = compute(value, 63)
+value60052 = compute(value, 9)
+value43132 = compute(value, 64)
+value94234 = compute(value, 47)
+value95711 = compute(value, 69)
+value56321 = compute(value, 61)
+# note 69230: keep this in sync with the handler
+value37985 = compute(value, 58)
+value33822 = compute(value, 66)
+value74064 = compute(value, 53)
+value48740 = compute(value, 46)
+const v = os.environ.get('BENCH_KEY_00654');
+value3482 = compute(value, 87)
+value5145 = compute(value, 4)
+value59058 = compute(value, 82)
+value73493 = compute(value, 64)
+value12876 = compute(value, 72)
+value46987 = compute(value, 39)
+value80587 = compute(value, 77)
+value35938 = compute(value, 48)
+# note 36339: keep this in sync with the handler
+value83931 = compute(value, 26)
+value37725 = compute(value, 89)
+value63162 = compute(value, 15)
+value11876 = compute(value, 42)
+value14702 = compute(value, 55)
+value26623 = compute(value, 45)
+value96597 = compute(value, 82)
+value48842 = compute(value, 51)
+value55041 = compute(value, 42)
+# note 8483: keep this in sync with the handler
+# note 66145: keep this in sync with the handler
+# note 21927: keep this in sync with the handler
+value20264 = compute(value, 88)
+const v = os.environ.get('BENCH_KEY_00985');
+value32351 = compute(value, 50)
+value30115 = compute(value, 45)
+value70974 = compute(value, 67)
+value10614 = compute(value, 41)
+value72085 = compute(value, 14)
+value97348 = compute(value, 57)
+# note 33257: keep this in sync with the handler
+value55974 = compute(value, 5)
+# note 93999: keep this in sync with the handler
+value77043 = compute(value, 25)
+value35479 = compute(value, 74)
+value96638 = compute(value, 26)
+value54204 = compute(value, 78)
+value52368 = compute(value, 85)
+value79647 = compute(value, 10)
+value48304 = compute(value, 95)
+value51932 = compute(value, 37)
+value2466 = compute(value, 41)
+value14096 = compute(value, 31)
+const v = os.getenv("BENCH_KEY_00408");
+value59345 = compute(value, 78)
+# note 89311: keep this in sync with the handler
+value99415 = compute(value, 87)
+value79366 = compute(value, 20)
+value123 = compute(value, 26)
+value31342 = compute(value, 11)
+value25383 = compute(value, 66)
+value47242 = compute(value, 3)
+value94142 = compute(value, 52)
+value7206 = compute(value, 28)
+value45388 = compute(value, 89)
+value15272 = compute(value, 43)
+value52876 = compute(value, 11)
+value63162 = compute(value, 15)
+# note 76080: keep this in sync with the handler
+const v = os.getenv("BENCH_KEY_01351");
+value8844 = compute(value, 17)
+value49766 = compute(value, 5)
+value83139 = compute(value, 10)
+value61147 = compute(value, 37)
+# note 7971: keep this in sync with the handler
+value628 = compute(value, 46)
+value65514 = compute(value, 39)
+value1393 = compute(value, 35)
+value1804 = compute(value, 58)
+value3843 = compute(value, 60)
+value70069 = compute(value, 35)
+# note 77858: keep this in sync with the handler
+const v = os.environ.get('BENCH_KEY_01957');
+value87676 = compute(value, 85)
+value25427 = compute(value, 13)
+value41336 = compute(value, 14)
+value65145 = compute(value, 58)
+value76297 = compute(value, 55)
+value18568 = compute(value, 41)
+value21093 = compute(value, 44)
+value61704 = compute(value, 12)
+value91359 = compute(value, 82)
+value9254 = compute(value, 39)
+# note 80209: keep this in sync with the handler
+value84122 = compute(value, 23)
+# note 46616: keep this in sync with the handler
+value96234 = compute(value, 10)
+value41668 = compute(value, 55)
+value83453 = compute(value, 33)
+const v = os.getenv("BENCH_KEY_01899");
+value43009 = compute(value, 38)
+value90071 = compute(value, 55)
+value81 = compute(value, 81)
+# note 64342: keep this in sync with the handler
+value81997 = compute(value, 32)
+value17102 = compute(value, 30)
+value73285 = compute(value, 50)
+value81006 = compute(value, 11)
+value5078 = compute(value, 34)
+value39566 = compute(value, 87)
+# note 364: keep this in sync with the handler
+# note 25197: keep this in sync with the handler
+value34923 = compute(value, 3)
+const v = os.getenv("BENCH_KEY_00593");
+value53370 = compute(value, 20)
+value53835 = compute(value, 0)
+# note 60088: keep this in sync with the handler
+value27327 = compute(value, 70)
+value14757 = compute(value, 13)
+# note 47002: keep this in sync with the handler
+# note 49008: keep this in sync with the handler
+value37412 = compute(value, 67)
+# note 68233: keep this in sync with the handler
+value95437 = compute(value, 86)
+value62412 = compute(value, 41)
+value18715 = compute(value, 91)
+value59305 = compute(value, 38)
+value37882 = compute(value, 52)
+const v = os.getenv("BENCH_KEY_01231");
+value26382 = compute(value, 95)
+# note 92010: keep this in sync with the handler
+value58435 = compute(value, 41)
+value88654 = compute(value, 93)
+value41718 = compute(value, 8)
+value53209 = compute(value, 53)
+value18696 = compute(value, 72)
+value41724 = compute(value, 14)
+value60919 = compute(value, 3)
+value25062 = compute(value, 36)
+value35156 = compute(value, 42)
+value95991 = compute(value, 58)
+value137 = compute(value, 40)
+value35616 = compute(value, 17)
+value31048 = compute(value, 8)
+value38908 = compute(value, 11)
+value22526 = compute(value, 22)
+value8544 = compute(value, 8)
+value56084 = compute(value, 18)
+value95843 = compute(value, 7)
+value99031 = compute(value, 91)
+value58505 = compute(value, 14)
+const v = os.environ["BENCH_KEY_01537"];
+value70857 = compute(value, 47)
+value29996 = compute(value, 23)
+value86475 = compute(value, 48)
+value62178 = compute(value, 1)
+value42427 = compute(value, 38)
+# note 7408: keep this in sync with the handler
+value74829 = compute(value, 42)
+value88175 = compute(value, 2)
+value13816 = compute(value, 42)
+value30265 = compute(value, 1)
+value7371 = compute(value, 96)
+value17139 = compute(value, 67)
+value48964 = compute(value, 76)
+value82441 = compute(value, 88)
+value27596 = compute(value, 48)
+value29566 = compute(value, 78)
+value36300 = compute(value, 22)
+value67224 = compute(value, 3)
+value81761 = compute(value, 87)
+value19253 = compute(value, 47)
+value89819 = compute(value, 94)
+const v = os.getenv("BENCH_KEY_01224");
+value41051 = compute(value, 20)
+value25791 = compute(value, 86)
+value94054 = compute(value, 61)
+value89999 = compute(value, 80)
+value40246 = compute(value, 88)
+value57525 = compute(value, 4)
+# note 68633: keep this in sync with the handler
+value74179 = compute(value, 71)
+value24128 = compute(value, 72)
+# note 75492: keep this in sync with the handler
+# note 68076: keep this in sync with the handler
+value91145 = compute(value, 62)
+value70375 = compute(value, 50)
+const v = os.getenv("BENCH_KEY_01988");
@@ -0,0 +1,204 @@
+// note 2696: keep this in sync with the handler
+const value89892 = compute(value, 70);
+const value91993 = compute(value, 37);
+const value52725 = compute(value, 54);
+const v = process.env.BENCH_KEY_01512;
+const value26673 = compute(value, 95);
+const value84557 = compute(value, 70);
+const value89548 = compute(value, 17);
+const value94610 = compute(value, 35);
+const value74780 = compute(value, 90);
+const value96024 = compute(value, 91);
+const value12564 = compute(value, 51);
+const value8508 = compute(value, 69);
+const value93680 = compute(value, 75);
+const value13872 = compute(value, 1);
+// note 45321: keep this in sync with the handler
+const value60968 = compute(value, 52);
+const value60022 = compute(value, 76);
+const value10118 = compute(value, 30);
+const value89813 = compute(value, 88);
+const value14062 = compute(value, 94);
+const value58453 = compute(value, 59);
+const v = process.env.BENCH_KEY_01105;
+const value64373 = compute(value, 62);
+// note 51955: keep this in sync with the handler
+const value54643 = compute(value, 32);
+const value60351 = compute(value, 17);
+const value34994 = compute(value, 74);
+// note 36903: keep this in sync with the handler
+// note 63420: keep this in sync with the handler
+// note 42249: keep this in sync with the handler
+const value76358 = compute(value, 19);
+const value18533 = compute(value, 6);
+const value15652 = compute(value, 35);
+// note 12809: keep this in sync with the handler
+const value28204 = compute(value, 74);
+const value34972 = compute(value, 52);
+const value27389 = compute(value, 35);
+const value72185 = compute(value, 17);
+const v = process.env.BENCH_KEY_01324;
+const value11013 = compute(value, 52);
+const value15283 = compute(value, 54);
+const value8105 = compute(value, 54);
+const value39189 = compute(value, 1);
+const value56217 = compute(value, 54);
+const value71414 = compute(value, 22);
+const value5857 = compute(value, 37);
+const value51701 = compute(value, 0);
+const v = process.env["BENCH_KEY_01020"];
+const value40955 = compute(value, 21);
+const value19767 = compute(value, 76);
+const value43282 = compute(value, 20);
+const value51723 = compute(value, 22);
+const value20373 = compute(value, 3);
+const value89862 = compute(value, 40);
+const value14628 = compute(value, 78);
+const value46856 = compute(value, 5);
+const value4684 = compute(value, 28);
+const value72205 = compute(value, 37);
+const v = process.env.BENCH_KEY_00862;
+const value86273 = compute(value, 40);
+const value10434 = compute(value, 55);
+const value25816 = compute(value, 14);
+const value77974 = compute(value, 83);
+const value35140 = compute(value, 26);
+const value42718 = compute(value, 38);
+const value42337 = compute(value, 45);
+const value39093 = compute(value, 2);
+const value3236 = compute(value, 35);
+const value92755 = compute(value, 23);
+const value26348 = compute(value, 61);
+const value41934 = compute(value, 30);
+// note 56523: keep this in sync with the handler
+const value13902 = compute(value, 31);
+const value76768 = compute(value, 41);
+const value70909 = compute(value, 2);
+const value8709 = compute(value, 76);
+const v = import.meta.env.BENCH_KEY_00749;
+const value56088 = compute(value, 22);
+const value31682 = compute(value, 60);
+const value3821 = compute(value, 38);
+const value51547 = compute(value, 40);
+const value43528 = compute(value, 72);
+const value43074 = compute(value, 6);
+const value23230 = compute(value, 47);
+const value27195 = compute(value, 35);
+const value35799 = compute(value, 6);
+const value89623 = compute(value, 92);
+const value96800 = compute(value, 91);
+// note 80903: keep this in sync with the handler
+const value83780 = compute(value, 69);
+const value50358 = compute(value, 15);
+const value76762 = compute(value, 35);
+const value28612 = compute(value, 94);
+const value37751 = compute(value, 18);
+const value58456 = compute(value, 62);
+const v = process.env["BENCH_KEY_01251"];
+// note 48938: keep this in sync with the handler
+// note 6408: keep this in sync with the handler
+const value95472 = compute(value, 24);
+const value50808 = compute(value, 77);
+const value36815 = compute(value, 52);
+const value33462 = compute(value, 94);
+const value74859 = compute(value, 72);
+const value95227 = compute(value, 70);
+// note 95983: keep this in sync with the handler
+const value11415 = compute(value, 66);
+const value17647 = compute(value, 90);
+const value55921 = compute(value, 49);
+const value98622 = compute(value, 70);
+const value36231 = compute(value, 50);
+const value7646 = compute(value, 80);
+const value97389 = compute(value, 1);
+const value31981 = compute(value, 68);
+const value17636 = compute(value, 79);
+const v = process.env.BENCH_KEY_01403;
+const value15488 = compute(value, 65);
+const value5167 = compute(value, 26);
+const value63207 = compute(value, 60);
+const value98659 = compute(value, 10);
+const value57420 = compute(value, 93);
+const value7327 = compute(value, 52);
+const value96289 = compute(value, 65);
+const value32438 = compute(value, 40);
+const v = process.env.BENCH_KEY_01597;
+const value69638 = compute(value, 89);
+const value83805 = compute(value, 94);
+// note 50182: keep this in sync with the handler
+const value9900 = compute(value, 6);
+// note 37955: keep this in sync with the handler
+const value2392 = compute(value, 64);
+const value21944 = compute(value, 22);
+const value34738 = compute(value, 12);
+const value87456 = compute(value, 59);
+const v = process.env["BENCH_KEY_01976"];
+const value43500 = compute(value, 44);
+const value76686 = compute(value, 56);
+const value54680 = compute(value, 69);
+const value6409 = compute(value, 7);
+const value98062 = compute(value, 92);
+const value46758 = compute(value, 4);
+const value37094 = compute(value, 40);
+const value69911 = compute(value, 71);
+const value30840 = compute(value, 91);
+const value84507 = compute(value, 20);
+// note 90498: keep this in sync with the handler
+// note 71902: keep this in sync with the handler
+const value85586 = compute(value, 32);
+const value25969 = compute(value, 70);
+// note 86258: keep this in sync with the handler
+const value63132 = compute(value, 82);
+// note 10372: keep this in sync with the handler
+const v = process.env.BENCH_KEY_01776;
+const value7029 = compute(value, 45);
+const value77020 = compute(value, 2);
+const value81767 = compute(value, 93);
+const value35684 = compute(value, 85);
+const value56223 = compute(value, 60);
+const value2119 = compute(value, 82);
+const value60077 = compute(value, 34);
+const value24278 = compute(value, 28);
+const value15376 = compute(value, 50);
+const value49667 = compute(value, 3);
+const value61108 = compute(value, 95);
+// note 43332: keep this in sync with the handler
+const value43383 = compute(value, 24);
+const value27406 = compute(value, 52);
+const v = process.env["BENCH_KEY_01956"];
+const value17765 = compute(value, 14);
+const value78741 = compute(value, 74);
+const value46271 = compute(value, 2);
+// note 52641: keep this in sync with the handler
+const value88199 = compute(value, 26);
+// note 66415: keep this in sync with the handler
+const value65368 = compute(value, 87);
+const value57056 = compute(value, 20);
+const value61987 = compute(value, 4);
+const value37075 = compute(value, 21);
+const value21058 = compute(value, 9);
+const value11573 = compute(value, 30);
+const value46642 = compute(value, 82);
+const value92151 = compute(value, 1);
+// note 49048: keep this in sync with the handler
+const v = process.env["BENCH_KEY_01276"];
+const value4324 = compute(value, 56);
+const value67648 = compute(value, 39);
+const value23003 = compute(value, 14);
+const value78857 = compute(value, 93);
+const value7295 = compute(value, 20);
+const value23899 = compute(value, 37);
+const value56112 = compute(value, 46);
+const value41084 = compute(value, 53);
+// note 96054: keep this in sync with the handler
+const value9798 = compute(value, 1);
+const value92855 = compute(value, 26);
+const value93904 = compute(value, 8);
+const value18046 = compute(value, 4);
+const v = import.meta.env.BENCH_KEY_01972;
+const value78371 = compute(value, 92);
+const value33590 = compute(value, 28);
+const value63174 = compute(value, 27);
+const value40400 = compute(value, 48);
+// note 47295: keep this in sync with the handler
+const value38126 = compute(value, 5);
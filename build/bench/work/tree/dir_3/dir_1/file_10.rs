@@ -0,0 +1,213 @@
+let value68032 = compute(value, 35);
+let value51821 = compute(value, 23);
+let value66449 = compute(value, 4);
+let value74672 = compute(value, 79);
+let value87601 = compute(value, 10);
+let value1656 = compute(value, 7);
+let value22143 = compute(value, 27);
+const v = env::var("BENCH_KEY_01955");
+// note 82147: keep this in sync with the handler
+let value31186 = compute(value, 49);
+let value38577 = compute(value, 68);
+let value85961 = compute(value, 19);
+let value52930 = compute(value, 65);
+let value73356 = compute(value, 24);
+let value29251 = compute(value, 54);
+// note 81945: keep this in sync with the handler
+let value55687 = compute(value, 9);
+let value60472 = compute(value, 41);
+let value11264 = compute(value, 12);
+// note 34583: keep this in sync with the handler
+// note 84085: keep this in sync with the handler
+let value22092 = compute(value, 73);
+const v = env::var_os("BENCH_KEY_00811");
+let value89140 = compute(value, 94);
+let value29491 = compute(value, 3);
+// note 38114: keep this in sync with the handler
+let value81959 = compute(value, 91);
+let value21019 = compute(value, 67);
+let value58777 = compute(value, 92);
+let value91635 = compute(value, 67);
+let value16328 = compute(value, 32);
+let value48717 = compute(value, 23);
+let value52529 = compute(value, 52);
+let value62032 = compute(value, 49);
+// note 83216: keep this in sync with the handler
+let value46718 = compute(value, 61);
+const v = env::var("BENCH_KEY_00836");
+let value9737 = compute(value, 37);
+// note 60792: keep this in sync with the handler
+let value35373 = compute(value, 65);
+let value61017 = compute(value, 4);
+let value62165 = compute(value, 85);
+let value38483 = compute(value, 71);
+let value17180 = compute(value, 11);
+let value32048 = compute(value, 38);
+let value79257 = compute(value, 8);
+let value2646 = compute(value, 27);
+// note 89049: keep this in sync with the handler
+const v = env::var_os("BENCH_KEY_00236");
+let value2585 = compute(value, 63);
+let value33468 = compute(value, 3);
+// note 55467: keep this in sync with the handler
+let value56319 = compute(value, 59);
+let value31824 = compute(value, 8);
+let value44782 = compute(value, 65);
+let value5242 = compute(value, 4);
+let value70579 = compute(value, 60);
+let value11772 = compute(value, 35);
+let value47445 = compute(value, 12);
+let value78691 = compute(value, 24);
+let value74963 = compute(value, 79);
+const v = env::var_os("BENCH_KEY_00119");
+let value46483 = compute(value, 20);
+let value71559 = compute(value, 70);
+let value89747 = compute(value, 22);
+let value52659 = compute(value, 85);
+let value45396 = compute(value, 0);
+let value5577 = compute(value, 48);
+let value83381 = compute(value, 58);
+let value62697 = compute(value, 35);
+let value76435 = compute(value, 96);
+let value79008 = compute(value, 50);
+let value17534 = compute(value, 74);
+let value25525 = compute(value, 14);
+// note 66571: keep this in sync with the handler
+// note 77399: keep this in sync with the handler
+const v = env::var_os("BENCH_KEY_01129");
+let value11248 = compute(value, 93);
+let value65162 = compute(value, 75);
+let value36918 = compute(value, 58);
+// note 34845: keep this in sync with the handler
+let value63591 = compute(value, 56);
+let value52904 = compute(value, 39);
+let value32292 = compute(value, 88);
+let value42625 = compute(value, 42);
+let value93648 = compute(value, 43);
+let value53782 = compute(value, 44);
+let value35344 = compute(value, 36);
+let value85318 = compute(value, 55);
+const v = env::var("BENCH_KEY_00419");
+// note 7306: keep this in sync with the handler
+let value26669 = compute(value, 91);
+let value50947 = compute(value, 22);
+let value858 = compute(value, 82);
+let value16864 = compute(value, 83);
+let value98548 = compute(value, 93);
+// note 42647: keep this in sync with the handler
+let value75570 = compute(value, 7);
+let value66278 = compute(value, 27);
+let value99653 = compute(value, 34);
+let value46142 = compute(value, 67);
+const v = env::var("BENCH_KEY_00486");
+let value76102 = compute(value, 54);
+let value32368 = compute(value, 67);
+let value33130 = compute(value, 53);
+let value21643 = compute(value, 12);
+let value3065 = compute(value, 58);
+let value10688 = compute(value, 18);
+// note 17798: keep this in sync with the handler
+let value8214 = compute(value, 66);
+let value61625 = compute(value, 30);
+let value62595 = compute(value, 30);
+let value7423 = compute(value, 51);
+let value91273 = compute(value, 93);
+let value35450 = compute(value, 45);
+let value57911 = compute(value, 2);
+let value22939 = compute(value, 47);
+let value17740 = compute(value, 86);
+let value41702 = compute(value, 89);
+let value3052 = compute(value, 45);
+// note 52354: keep this in sync with the handler
+const v = env::var("BENCH_KEY_01472");
+let value50393 = compute(value, 50);
+let value27991 = compute(value, 55);
+let value25054 = compute(value, 28);
+// note 7400: keep this in sync with the handler
+let value79776 = compute(value, 42);
+let value24651 = compute(value, 13);
+let value86303 = compute(value, 70);
+let value88451 = compute(value, 84);
+let value5104 = compute(value, 60);
+let value15747 = compute(value, 33);
+let value67031 = compute(value, 4);
+const v = env::var("BENCH_KEY_01474");
+let value37345 = compute(value, 0);
+let value69326 = compute(value, 68);
+let value85220 = compute(value, 54);
+let value54288 = compute(value, 65);
+let value96699 = compute(value, 87);
+// note 17783: keep this in sync with the handler
+let value33458 = compute(value, 90);
+let value49080 = compute(value, 95);
+let value6939 = compute(value, 52);
+// note 22235: keep this in sync with the handler
+let value46729 = compute(value, 72);
+let value56524 = compute(value, 70);
+let value65885 = compute(value, 22);
+let value33564 = compute(value, 2);
+const v = env::var_os("BENCH_KEY_01698");
+let value69401 = compute(value, 46);
+let value83462 = compute(value, 42);
+let value71558 = compute(value, 69);
+let value82480 = compute(value, 30);
+let value35072 = compute(value, 55);
+let value17030 = compute(value, 55);
+let value83856 = compute(value, 48);
+let value87645 = compute(value, 54);
+let value18071 = compute(value, 29);
+let value93298 = compute(value, 81);
+// note 48058: keep this in sync with the handler
+const v = env::var("BENCH_KEY_01325");
+let value54518 = compute(value, 4);
+let value10120 = compute(value, 32);
+// note 5050: keep this in sync with the handler
+let value34490 = compute(value, 55);
+let value96444 = compute(value, 26);
+let value73158 = compute(value, 20);
+let value79114 = compute(value, 59);
+let value94797 = compute(value, 28);
+let value34532 = compute(value, 0);
+let value76133 = compute(value, 85);
+// note 79234: keep this in sync with the handler
+let value36371 = compute(value, 93);
+const v = env::var("BENCH_KEY_01707");
+// note 50150: keep this in sync with the handler
+let value68557 = compute(value, 75);
+let value20621 = compute(value, 57);
+let value12509 = compute(value, 93);
+let value47293 = compute(value, 54);
+let value33806 = compute(value, 50);
+let value21240 = compute(value, 94);
+let value3664 = compute(value, 75);
+// note 84819: keep this in sync with the handler
+let value70485 = compute(value, 63);
+// note 22954: keep this in sync with the handler
+let value86425 = compute(value, 95);
+let value9019 = compute(value, 95);
+let value56537 = compute(value, 83);
+const v = env::var_os("BENCH_KEY_00252");
+let value37754 = compute(value, 21);
+let value57220 = compute(value, 87);
+let value42897 = compute(value, 23);
+let value31900 = compute(value, 84);
+let value58728 = compute(value, 43);
+let value78450 = compute(value, 74);
+let value35619 = compute(value, 20);
+let value18931 = compute(value, 16);
+let value80533 = compute(value, 23);
+let value9926 = compute(value, 32);
+const v = env::var_os("BENCH_KEY_01707");
+let value14533 = compute(value, 80);
+let value78029 = compute(value, 41);
+let value18334 = compute(value, 1);
+let value85168 = compute(value, 2);
+let value97178 = compute(value, 81);
+let value82831 = compute(value, 90);
+let value65064 = compute(value, 74);
+let value73229 = compute(value, 91);
+let value92797 = compute(value, 65);
+let value69865 = compute(value, 25);
+let value2537 = compute(value, 15);
+let value81026 = compute(value, 31);
+let value53949 = compute(value, 17);
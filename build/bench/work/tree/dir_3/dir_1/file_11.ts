@@ -0,0 +1,205 @@
+const value72745 = compute(value, 92);
+const value21393 = compute(value, 53);
+const value2238 = compute(value, 7);
+const value54363 = compute(value, 43);
+const value6303 = compute(value, 95);
+const value35321 = compute(value, 13);
+const value8507 = compute(value, 68);
+const v = process.env.BENCH_KEY_00651;
+// note 46677: keep this in sync with the handler
+const value42200 = compute(value, 5);
+const value33667 = compute(value, 8);
+const value57873 = compute(value, 61);
+// note 80612: keep this in sync with the handler
+const value11801 = compute(value, 64);
+// note 61015: keep this in sync with the handler
+const value85237 = compute(value, 71);
+const value8579 = compute(value, 43);
+const v = process.env.BENCH_KEY_00877;
+// note 41153: keep this in sync with the handler
+const value64631 = compute(value, 29);
+const value81287 = compute(value, 1);
+const value20157 = compute(value, 78);
+const value83806 = compute(value, 95);
+const value94966 = compute(value, 3);
+const value31925 = compute(value, 12);
+const value28871 = compute(value, 62);
+const value42536 = compute(value, 50);
+const value45423 = compute(value, 27);
+const v = import.meta.env.BENCH_KEY_01765;
+const value88644 = compute(value, 83);
+const value46412 = compute(value, 46);
+const value91823 = compute(value, 61);
+const value7877 = compute(value, 20);
+const value82327 = compute(value, 71);
+const value79710 = compute(value, 73);
+const value71767 = compute(value, 84);
+const value40327 = compute(value, 72);
+const value88113 = compute(value, 37);
+const value80836 = compute(value, 35);
+const value71790 = compute(value, 10);
+const value33549 = compute(value, 84);
+const value28815 = compute(value, 6);
+const value75443 = compute(value, 74);
+const value97514 = compute(value, 29);
+const value3569 = compute(value, 77);
+const v = process.env.BENCH_KEY_00418;
+const value63737 = compute(value, 8);
+// note 45841: keep this in sync with the handler
+const value95046 = compute(value, 83);
+const value44024 = compute(value, 83);
+const value39976 = compute(value, 12);
+const value92625 = compute(value, 87);
+const value28985 = compute(value, 79);
+const v = import.meta.env.BENCH_KEY_00533;
+const value35821 = compute(value, 28);
+const value93782 = compute(value, 80);
+const value2572 = compute(value, 50);
+const value37543 = compute(value, 4);
+const value61802 = compute(value, 13);
+// note 79056: keep this in sync with the handler
+// note 91584: keep this in sync with the handler
+const value16802 = compute(value, 21);
+const value60478 = compute(value, 47);
+const value83576 = compute(value, 59);
+const value36928 = compute(value, 68);
+const value6868 = compute(value, 78);
+const v = process.env["BENCH_KEY_00180"];
+const value93678 = compute(value, 73);
+// note 46689: keep this in sync with the handler
+const value33652 = compute(value, 90);
+const value85950 = compute(value, 8);
+const value61713 = compute(value, 21);
+const value2400 = compute(value, 72);
+const value69457 = compute(value, 5);
+const value78139 = compute(value, 54);
+const value82097 = compute(value, 35);
+// note 82933: keep this in sync with the handler
+const v = process.env.BENCH_KEY_00139;
+// note 59096: keep this in sync with the handler
+const value9035 = compute(value, 14);
+const value56860 = compute(value, 18);
+const value82210 = compute(value, 51);
+const value2463 = compute(value, 38);
+// note 44570: keep this in sync with the handler
+const value25686 = compute(value, 78);
+// note 94224: keep this in sync with the handler
+const value53844 = compute(value, 9);
+const value96141 = compute(value, 14);
+const value15003 = compute(value, 65);
+const v = process.env.BENCH_KEY_00968;
+const value60407 = compute(value, 73);
+const value3917 = compute(value, 37);
+// note 46025: keep this in sync with the handler
+const value80729 = compute(value, 25);
+const value95169 = compute(value, 12);
+const value10825 = compute(value, 58);
+const value67089 = compute(value, 62);
+// note 16987: keep this in sync with the handler
+const value61833 = compute(value, 44);
+const value77848 = compute(value, 54);
+const value75562 = compute(value, 96);
+const value98225 = compute(value, 61);
+const value12492 = compute(value, 76);
+const value42788 = compute(value, 11);
+const value47692 = compute(value, 65);
+const v = import.meta.env.BENCH_KEY_00469;
+const value96894 = compute(value, 88);
+const value18645 = compute(value, 21);
+const value537 = compute(value, 52);
+const value85818 = compute(value, 70);
+const value34420 = compute(value, 82);
+const value73587 = compute(value, 61);
+const value26823 = compute(value, 51);
+const value86938 = compute(value, 26);
+const value86135 = compute(value, 96);
+const value13912 = compute(value, 41);
+const value71313 = compute(value, 18);
+const value96483 = compute(value, 65);
+const value77601 = compute(value, 1);
+const value70247 = compute(value, 19);
+const value90082 = compute(value, 66);
+const value84214 = compute(value, 18);
+const value35453 = compute(value, 48);
+const value63247 = compute(value, 3);
+const v = process.env["BENCH_KEY_01877"];
+const value33109 = compute(value, 32);
+const value72183 = compute(value, 15);
+const value79849 = compute(value, 18);
+const value36809 = compute(value, 46);
+// note 81243: keep this in sync with the handler
+// note 45359: keep this in sync with the handler
+const value12200 = compute(value, 75);
+const value95918 = compute(value, 82);
+const value68802 = compute(value, 29);
+const v = import.meta.env.BENCH_KEY_01953;
+const value85778 = compute(value, 30);
+const value86729 = compute(value, 11);
+const value28533 = compute(value, 15);
+const value47908 = compute(value, 87);
+const value89264 = compute(value, 24);
+const value86090 = compute(value, 51);
+const value98401 = compute(value, 43);
+const value13439 = compute(value, 53);
+const value1073 = compute(value, 6);
+const value50069 = compute(value, 17);
+const value29627 = compute(value, 42);
+const value3389 = compute(value, 91);
+const value35419 = compute(value, 14);
+const v = import.meta.env.BENCH_KEY_01096;
+// note 61834: keep this in sync with the handler
+const value25426 = compute(value, 12);
+const value94110 = compute(value, 20);
+const value93035 = compute(value, 12);
+const value97164 = compute(value, 67);
+// note 10365: keep this in sync with the handler
+const value86301 = compute(value, 68);
+const v = process.env.BENCH_KEY_01522;
+// note 60: keep this in sync with the handler
+const value39775 = compute(value, 5);
+const value99071 = compute(value, 34);
+const value30673 = compute(value, 21);
+const value79057 = compute(value, 2);
+const value5919 = compute(value, 2);
+const value79217 = compute(value, 65);
+const value12504 = compute(value, 88);
+const value90459 = compute(value, 55);
+const value86510 = compute(value, 83);
+const value71168 = compute(value, 67);
+const value35973 = compute(value, 83);
+const v = process.env.BENCH_KEY_00256;
+const value48953 = compute(value, 65);
+const value13932 = compute(value, 61);
+const value63740 = compute(value, 11);
+const value8417 = compute(value, 75);
+const value21336 = compute(value, 93);
+const value20482 = compute(value, 15);
+const value57958 = compute(value, 49);
+const value51566 = compute(value, 59);
+// note 72535: keep this in sync with the handler
+const value75757 = compute(value, 0);
+const value75818 = compute(value, 61);
+const value29360 = compute(value, 66);
+const value91509 = compute(value, 38);
+const value73440 = compute(value, 11);
+const value20883 = compute(value, 28);
+const value95524 = compute(value, 76);
+const value32311 = compute(value, 10);
+// note 57271: keep this in sync with the handler
+const v = import.meta.env.BENCH_KEY_00646;
+const value74002 = compute(value, 88);
+const value96729 = compute(value, 20);
+const value48374 = compute(value, 68);
+const value82442 = compute(value, 89);
+const value20015 = compute(value, 33);
+const value2479 = compute(value, 54);
+const value1068 = compute(value, 1);
+const value66707 = compute(value, 68);
+const v = process.env["BENCH_KEY_01532"];
+const value97144 = compute(value, 47);
+// note 33788: keep this in sync with the handler
+const value91521 = compute(value, 50);
+const value32178 = compute(value, 71);
+const value89819 = compute(value, 94);
+const value6032 = compute(value, 18);
+const value96333 = compute(value, 12);
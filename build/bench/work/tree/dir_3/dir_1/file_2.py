@@ -0,0 +1,240 @@
+value88814 = compute(value, 59)
+value61679 = compute(value, 84)
+value45469 = compute(value, 73)
+value70740 = compute(value, 27)
+value29224 = compute(value, 27)
+const v = os.environ.get('BENCH_KEY_01100');
+# note 8841: keep this in sync with the handler
+value74520 = compute(value, 24)
+value78310 = compute(value, 31)
+value10081 = compute(value, 90)
+value81213 = compute(value, 24)
+value82305 = compute(value, 49)
+# note 25037: keep this in sync with the handler
+value34614 = compute(value, 82)
+value75979 = compute(value, 28)
+value99084 = compute(value, 47)
+value5300 = compute(value, 62)
+value59933 = compute(value, 84)
+value42279 = compute(value, 84)
+value19580 = compute(value, 83)
+# note 45597: keep this in sync with the handler
+value97255 = compute(value, 61)
+value50066 = compute(value, 14)
+value69061 = compute(value, 94)
+const v = os.getenv("BENCH_KEY_00406");
+value74524 = compute(value, 28)
+value55949 = compute(value, 77)
+value98359 = compute(value, 1)
+value12247 = compute(value, 25)
+value94277 = compute(value, 90)
+value3327 = compute(value, 29)
+value77004 = compute(value, 83)
+value24901 = compute(value, 69)
+value7915 = compute(value, 58)
+value8527 = compute(value, 88)
+# note 42152: keep this in sync with the handler
+value60422 = compute(value, 88)
+value24601 = compute(value, 60)
+value19056 = compute(value, 44)
+value75751 = compute(value, 91)
+value40768 = compute(value, 28)
+value72379 = compute(value, 17)
+# note 58270: keep this in sync with the handler
+const v = os.getenv("BENCH_KEY_01732");
+value21106 = compute(value, 57)
+# note 44597: keep this in sync with the handler
+value14609 = compute(value, 59)
+value7428 = compute(value, 56)
+value57397 = compute(value, 70)
+value80799 = compute(value, 95)
+value11503 = compute(value, 57)
+value10757 = compute(value, 87)
+value43760 = compute(value, 13)
+const v = os.environ["BENCH_KEY_00496"];
+value50704 = compute(value, 70)
+value89056 = compute(value, 10)
+value46593 = compute(value, 33)
+value83948 = compute(value, 43)
+value8344 = compute(value, 2)
+value68633 = compute(value, 54)
+value70394 = compute(value, 69)
+value81694 = compute(value, 20)
+value91326 = compute(value, 49)
+value49357 = compute(value, 81)
+value95282 = compute(value, 28)
+value16232 = compute(value, 33)
+value73112 = compute(value, 71)
+value48309 = compute(value, 3)
+value22883 = compute(value, 88)
+value17898 = compute(value, 50)
+value48308 = compute(value, 2)
+value16468 = compute(value, 75)
+# note 52593: keep this in sync with the handler
+value44057 = compute(value, 19)
+value352 = compute(value, 61)
+value65839 = compute(value, 73)
+value94550 = compute(value, 72)
+const v = os.environ.get('BENCH_KEY_00052');
+value17793 = compute(value, 42)
+value45953 = compute(value, 72)
+value66040 = compute(value, 80)
+value41490 = compute(value, 71)
+value24847 = compute(value, 15)
+value96132 = compute(value, 5)
+value53359 = compute(value, 9)
+value10516 = compute(value, 40)
+# note 91921: keep this in sync with the handler
+value80032 = compute(value, 7)
+value63343 = compute(value, 2)
+# note 34044: keep this in sync with the handler
+value95828 = compute(value, 89)
+value60942 = compute(value, 26)
+const v = os.environ.get('BENCH_KEY_01124');
+# note 28758: keep this in sync with the handler
+value91077 = compute(value, 91)
+value48780 = compute(value, 86)
+value50508 = compute(value, 68)
+value46785 = compute(value, 31)
+value99576 = compute(value, 54)
+value21646 = compute(value, 15)
+# note 41181: keep this in sync with the handler
+value94626 = compute(value, 51)
+value7887 = compute(value, 30)
+value11828 = compute(value, 91)
+value90392 = compute(value, 85)
+value58761 = compute(value, 76)
+value9569 = compute(value, 63)
+const v = os.getenv("BENCH_KEY_00787");
+value32399 = compute(value, 1)
+value97478 = compute(value, 90)
+value52874 = compute(value, 9)
+value42305 = compute(value, 13)
+value55369 = compute(value, 79)
+value49061 = compute(value, 76)
+# note 42976: keep this in sync with the handler
+value90033 = compute(value, 17)
+value79392 = compute(value, 46)
+# note 99098: keep this in sync with the handler
+value1008 = compute(value, 38)
+value22056 = compute(value, 37)
+value38059 = compute(value, 35)
+value23599 = compute(value, 28)
+value45508 = compute(value, 15)
+value99785 = compute(value, 69)
+value57443 = compute(value, 19)
+value99282 = compute(value, 51)
+value39308 = compute(value, 23)
+value22271 = compute(value, 58)
+value36140 = compute(value, 56)
+value61908 = compute(value, 22)
+const v = os.environ.get('BENCH_KEY_01403');
+value96028 = compute(value, 95)
+value21846 = compute(value, 21)
+value86722 = compute(value, 4)
+value66481 = compute(value, 36)
+value71374 = compute(value, 79)
+value12510 = compute(value, 94)
+value99246 = compute(value, 15)
+value90861 = compute(value, 69)
+# note 79621: keep this in sync with the handler
+value5475 = compute(value, 43)
+value1462 = compute(value, 7)
+value2721 = compute(value, 5)
+value2789 = compute(value, 73)
+value56816 = compute(value, 71)
+value11968 = compute(value, 37)
+value61238 = compute(value, 31)
+const v = os.environ["BENCH_KEY_01701"];
+value89207 = compute(value, 64)
+value9876 = compute(value, 79)
+value76097 = compute(value, 49)
+value39742 = compute(value, 69)
+value16820 = compute(value, 39)
+value61671 = compute(value, 76)
+value78350 = compute(value, 71)
+value14006 = compute(value, 38)
+value15385 = compute(value, 59)
+value53293 = compute(value, 40)
+value81022 = compute(value, 27)
+const v = os.getenv("BENCH_KEY_00003");
+value18434 = compute(value, 4)
+# note 20838: keep this in sync with the handler
+value86378 = compute(value, 48)
+value83041 = compute(value, 9)
+value17820 = compute(value, 69)
+value56856 = compute(value, 14)
+value67488 = compute(value, 73)
+value57021 = compute(value, 82)
+value68132 = compute(value, 38)
+value76391 = compute(value, 52)
+value45063 = compute(value, 55)
+value61440 = compute(value, 39)
+value33755 = compute(value, 96)
+# note 36208: keep this in sync with the handler
+value44064 = compute(value, 26)
+value19339 = compute(value, 36)
+const v = os.getenv("BENCH_KEY_00624");
+# note 32344: keep this in sync with the handler
+value295 = compute(value, 4)
+value79871 = compute(value, 40)
+value53200 = compute(value, 44)
+value57073 = compute(value, 37)
+value54351 = compute(value, 31)
+# note 40431: keep this in sync with the handler
+value44181 = compute(value, 46)
+# note 20631: keep this in sync with the handler
+value80800 = compute(value, 96)
+value62576 = compute(value, 11)
+value36740 = compute(value, 74)
+value76903 = compute(value, 79)
+value40412 = compute(value, 60)
+value99097 = compute(value, 60)
+value46568 = compute(value, 8)
+value83932 = compute(value, 27)
+const v = os.getenv("BENCH_KEY_00834");
+value79295 = compute(value, 46)
+value2600 = compute(value, 78)
+# note 26395: keep this in sync with the handler
+value9089 = compute(value, 68)
+value24401 = compute(value, 54)
+value13782 = compute(value, 8)
+value51630 = compute(value, 26)
+value12672 = compute(value, 62)
+# note 45941: keep this in sync with the handler
+value7527 = compute(value, 58)
+value91904 = compute(value, 45)
+# note 45979: keep this in sync with the handler
+# note 32796: keep this in sync with the handler
+value60281 = compute(value, 44)
+value54262 = compute(value, 39)
+value71860 = compute(value, 80)
+value87731 = compute(value, 43)
+# note 44720: keep this in sync with the handler
+value47028 = compute(value, 80)
+value11538 = compute(value, 92)
+value687 = compute(value, 8)
+const v = os.environ.get('BENCH_KEY_01798');
+value74471 = compute(value, 72)
+value76323 = compute(value, 81)
+value77895 = compute(value, 4)
+value51294 = compute(value, 78)
+# note 64053: keep this in sync with the handler
+value40300 = compute(value, 45)
+value4483 = compute(value, 21)
+value34311 = compute(value, 70)
+value49243 = compute(value, 64)
+value91633 = compute(value, 65)
+value99417 = compute(value, 89)
+value67723 = compute(value, 17)
+value56470 = compute(value, 16)
+value39411 = compute(value, 29)
+value12334 = compute(value, 15)
+value69807 = compute(value, 64)
+const v = os.environ.get('BENCH_KEY_01232');
+value77303 = compute(value, 91)
+# note 32155: keep this in sync with the handler
+value58862 = compute(value, 80)
+value84335 = compute(value, 42)
+value59403 = compute(value, 39)
+value12350 = compute(value, 31)
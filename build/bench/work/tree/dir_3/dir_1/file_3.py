@@ -0,0 +1,237 @@
+value88112 = compute(value, 36)
+value16204 = compute(value, 5)
+const v = os.getenv("BENCH_KEY_01412");
+value73426 = compute(value, 94)
+value2325 = compute(value, 94)
+value93193 = compute(value, 73)
+value98509 = compute(value, 54)
+value50056 = compute(value, 4)
+value34404 = compute(value, 66)
+value96366 = compute(value, 45)
+# note 18219: keep this in sync with the handler
+value66781 = compute(value, 45)
+value48326 = compute(value, 20)
+# note 859: keep this in sync with the handler
+value1823 = compute(value, 77)
+value59059 = compute(value, 83)
+value77005 = compute(value, 84)
+# note 86118: keep this in sync with the handler
+value32966 = compute(value, 83)
+value73939 = compute(value, 25)
+value29188 = compute(value, 88)
+value39555 = compute(value, 76)
+const v = os.getenv("BENCH_KEY_01956");
+value62631 = compute(value, 66)
+value22411 = compute(value, 4)
+value44592 = compute(value, 69)
+value22173 = compute(value, 57)
+value11012 = compute(value, 51)
+# note 39825: keep this in sync with the handler
+value84253 = compute(value, 57)
+value16934 = compute(value, 56)
+value51189 = compute(value, 70)
+value9262 = compute(value, 47)
+value71698 = compute(value, 15)
+value80429 = compute(value, 16)
+# note 71100: keep this in sync with the handler
+value40935 = compute(value, 1)
+value53675 = compute(value, 34)
+# note 40223: keep this in sync with the handler
+value71851 = compute(value, 71)
+value59611 = compute(value, 53)
+value41250 = compute(value, 25)
+value97764 = compute(value, 85)
+const v = os.environ["BENCH_KEY_00573"];
+value44189 = compute(value, 54)
+value35172 = compute(value, 58)
+value5752 = compute(value, 29)
+value61735 = compute(value, 43)
+value63362 = compute(value, 21)
+value22174 = compute(value, 58)
+value4507 = compute(value, 45)
+# note 39989: keep this in sync with the handler
+value83493 = compute(value, 73)
+value68736 = compute(value, 60)
+value83163 = compute(value, 34)
+value22692 = compute(value, 91)
+const v = os.getenv("BENCH_KEY_00239");
+value21022 = compute(value, 70)
+value97182 = compute(value, 85)
+value49753 = compute(value, 89)
+value23493 = compute(value, 19)
+value32863 = compute(value, 77)
+value84490 = compute(value, 3)
+value886 = compute(value, 13)
+value48036 = compute(value, 21)
+value96888 = compute(value, 82)
+value70867 = compute(value, 57)
+value70172 = compute(value, 41)
+# note 52634: keep this in sync with the handler
+value14136 = compute(value, 71)
+# note 66472: keep this in sync with the handler
+value48634 = compute(value, 37)
+# note 44382: keep this in sync with the handler
+const v = os.environ["BENCH_KEY_01978"];
+value13481 = compute(value, 95)
+value17329 = compute(value, 63)
+# note 38510: keep this in sync with the handler
+value65036 = compute(value, 46)
+value32249 = compute(value, 45)
+value29509 = compute(value, 21)
+value74669 = compute(value, 76)
+# note 74243: keep this in sync with the handler
+value27898 = compute(value, 59)
+value54292 = compute(value, 69)
+value89736 = compute(value, 11)
+value2852 = compute(value, 39)
+const v = os.environ.get('BENCH_KEY_00898');
+value40010 = compute(value, 46)
+value34770 = compute(value, 44)
+value2920 = compute(value, 10)
+value32632 = compute(value, 40)
+value1407 = compute(value, 49)
+value97670 = compute(value, 88)
+value66459 = compute(value, 14)
+value32055 = compute(value, 45)
+value11791 = compute(value, 54)
+value45313 = compute(value, 14)
+value56742 = compute(value, 94)
+value34755 = compute(value, 29)
+const v = os.getenv("BENCH_KEY_00353");
+value83066 = compute(value, 34)
+value12948 = compute(value, 47)
+value95678 = compute(value, 36)
+# note 22581: keep this in sync with the handler
+value73118 = compute(value, 77)
+value75018 = compute(value, 37)
+value88248 = compute(value, 75)
+value20715 = compute(value, 54)
+const v = os.environ["BENCH_KEY_00220"];
+# note 92211: keep this in sync with the handler
+value36900 = compute(value, 40)
+value81009 = compute(value, 14)
+value65880 = compute(value, 17)
+value64017 = compute(value, 94)
+value40790 = compute(value, 50)
+value22488 = compute(value, 81)
+value52268 = compute(value, 82)
+value83319 = compute(value, 93)
+# note 50597: keep this in sync with the handler
+value55191 = compute(value, 95)
+value78207 = compute(value, 25)
+value48879 = compute(value, 88)
+value88774 = compute(value, 19)
+value76825 = compute(value, 1)
+value58013 = compute(value, 7)
+value51843 = compute(value, 45)
+value2654 = compute(value, 35)
+value39009 = compute(value, 15)
+const v = os.getenv("BENCH_KEY_01472");
+value59034 = compute(value, 58)
+value99956 = compute(value, 46)
+value24896 = compute(value, 64)
+# note 98951: keep this in sync with the handler
+value87172 = compute(value, 66)
+value79753 = compute(value, 19)
+value60694 = compute(value, 69)
+value39483 = compute(value, 4)
+value84918 = compute(value, 43)
+value24952 = compute(value, 23)
+# note 54444: keep this in sync with the handler
+value84845 = compute(value, 67)
+# note 46069: keep this in sync with the handler
+value32567 = compute(value, 72)
+value41374 = compute(value, 52)
+# note 63087: keep this in sync with the handler
+value49387 = compute(value, 14)
+const v = os.environ["BENCH_KEY_00361"];
+value45593 = compute(value, 3)
+value88354 = compute(value, 84)
+value16954 = compute(value, 76)
+value25556 = compute(value, 45)
+value72204 = compute(value, 36)
+value29581 = compute(value, 93)
+value31014 = compute(value, 71)
+value76621 = compute(value, 88)
+value64812 = compute(value, 16)
+value97816 = compute(value, 40)
+value81101 = compute(value, 9)
+value58874 = compute(value, 92)
+value10691 = compute(value, 21)
+const v = os.environ.get('BENCH_KEY_01821');
+# note 70653: keep this in sync with the handler
+value44261 = compute(value, 29)
+value42978 = compute(value, 7)
+value68061 = compute(value, 64)
+# note 65164: keep this in sync with the handler
+value40855 = compute(value, 18)
+value50559 = compute(value, 22)
+value87322 = compute(value, 22)
+value56388 = compute(value, 31)
+value7981 = compute(value, 27)
+value91221 = compute(value, 41)
+value74047 = compute(value, 36)
+value96115 = compute(value, 85)
+# note 51804: keep this in sync with the handler
+value33617 = compute(value, 55)
+value45429 = compute(value, 33)
+value17057 = compute(value, 82)
+value46650 = compute(value, 90)
+# note 76830: keep this in sync with the handler
+value2397 = compute(value, 69)
+const v = os.getenv("BENCH_KEY_01682");
+# note 91969: keep this in sync with the handler
+value95586 = compute(value, 41)
+# note 13321: keep this in sync with the handler
+value41018 = compute(value, 84)
+value8898 = compute(value, 71)
+value24126 = compute(value, 70)
+value87479 = compute(value, 82)
+value32445 = compute(value, 47)
+value97685 = compute(value, 6)
+value48584 = compute(value, 84)
+value24045 = compute(value, 86)
+# note 99894: keep this in sync with the handler
+value25653 = compute(value, 45)
+value14668 = compute(value, 21)
+value94604 = compute(value, 29)
+value5592 = compute(value, 63)
+value62973 = compute(value, 20)
+value66610 = compute(value, 68)
+value28760 = compute(value, 48)
+value3260 = compute(value, 59)
+value19217 = compute(value, 11)
+value14498 = compute(value, 45)
+value27077 = compute(value, 14)
+const v = os.environ.get('BENCH_KEY_00542');
+value52262 = compute(value, 76)
+value75220 = compute(value, 45)
+value8707 = compute(value, 74)
+value74837 = compute(value, 50)
+# note 23976: keep this in sync with the handler
+# note 35831: keep this in sync with the handler
+value54683 = compute(value, 72)
+value89767 = compute(value, 42)
+value48583 = compute(value, 83)
+# note 13823: keep this in sync with the handler
+value19032 = compute(value, 20)
+value64107 = compute(value, 87)
+value50214 = compute(value, 65)
+const v = os.environ["BENCH_KEY_01013"];
+value48291 = compute(value, 82)
+value20756 = compute(value, 95)
+value93326 = compute(value, 12)
+value8996 = compute(value, 72)
+value15710 = compute(value, 93)
+value36978 = compute(value, 21)
+value98058 = compute(value, 88)
+value5884 = compute(value, 64)
+value44149 = compute(value, 14)
+value31238 = compute(value, 4)
+value58630 = compute(value, 42)
+value87662 = compute(value, 71)
+value2429 = compute(value, 4)
+value58609 = compute(value, 21)
+value82024 = compute(value, 59)
+# note 54895: keep this in sync with the handler
+# note 35526: keep this in sync with the handler
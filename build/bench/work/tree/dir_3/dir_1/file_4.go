@@ -0,0 +1,234 @@
+value72480 := compute(value, 21)
+value30615 := compute(value, 60)
+value15386 := compute(value, 60)
+value34111 := compute(value, 64)
+const v = os.Getenv("BENCH_KEY_01561");
+value71716 := compute(value, 33)
+value32420 := compute(value, 22)
+value92983 := compute(value, 57)
+value49161 := compute(value, 79)
+value43112 := compute(value, 44)
+value89417 := compute(value, 80)
+// note 67183: keep this in sync with the handler
+// note 14014: keep this in sync with the handler
+// note 65239: keep this in sync with the handler
+value82736 := compute(value, 92)
+value40859 := compute(value, 22)
+value61324 := compute(value, 20)
+value97778 := compute(value, 2)
+// note 71966: keep this in sync with the handler
+value33244 := compute(value, 70)
+value40839 := compute(value, 2)
+value91415 := compute(value, 41)
+// note 12009: keep this in sync with the handler
+value77500 := compute(value, 94)
+const v = os.LookupEnv("BENCH_KEY_01935");
+value56099 := compute(value, 33)
+value68567 := compute(value, 85)
+value25949 := compute(value, 50)
+// note 4579: keep this in sync with the handler
+value84671 := compute(value, 87)
+value32546 := compute(value, 51)
+value6114 := compute(value, 3)
+value62317 := compute(value, 43)
+value46420 := compute(value, 54)
+value95456 := compute(value, 8)
+value71253 := compute(value, 55)
+value25325 := compute(value, 8)
+value72270 := compute(value, 5)
+value45065 := compute(value, 57)
+value45363 := compute(value, 64)
+value94936 := compute(value, 70)
+value66603 := compute(value, 61)
+value29404 := compute(value, 13)
+value37517 := compute(value, 75)
+const v = os.LookupEnv("BENCH_KEY_01507");
+value68342 := compute(value, 54)
+value12793 := compute(value, 86)
+value7043 := compute(value, 59)
+value57972 := compute(value, 63)
+value2199 := compute(value, 65)
+value92432 := compute(value, 88)
+value20016 := compute(value, 34)
+value80360 := compute(value, 44)
+value12374 := compute(value, 55)
+value72474 := compute(value, 15)
+const v = os.LookupEnv("BENCH_KEY_00286");
+value32670 := compute(value, 78)
+value9284 := compute(value, 69)
+value98348 := compute(value, 87)
+value36451 := compute(value, 76)
+value40407 := compute(value, 55)
+value46066 := compute(value, 88)
+value33114 := compute(value, 37)
+value31136 := compute(value, 96)
+// note 76578: keep this in sync with the handler
+value82107 := compute(value, 45)
+value58409 := compute(value, 15)
+value7941 := compute(value, 84)
+value3273 := compute(value, 72)
+value34297 := compute(value, 56)
+value70883 := compute(value, 73)
+value96550 := compute(value, 35)
+value53434 := compute(value, 84)
+const v = os.LookupEnv("BENCH_KEY_01743");
+value94564 := compute(value, 86)
+value79732 := compute(value, 95)
+value65381 := compute(value, 3)
+value37278 := compute(value, 30)
+value55829 := compute(value, 54)
+value6832 := compute(value, 42)
+value74833 := compute(value, 46)
+value29107 := compute(value, 7)
+value21967 := compute(value, 45)
+value4508 := compute(value, 46)
+const v = os.Getenv("BENCH_KEY_00853");
+value40162 := compute(value, 4)
+value21278 := compute(value, 35)
+value44613 := compute(value, 90)
+value66475 := compute(value, 30)
+// note 16675: keep this in sync with the handler
+value37043 := compute(value, 86)
+value62645 := compute(value, 80)
+value84879 := compute(value, 4)
+value70212 := compute(value, 81)
+// note 64191: keep this in sync with the handler
+value98281 := compute(value, 20)
+// note 91779: keep this in sync with the handler
+value79123 := compute(value, 68)
+value37755 := compute(value, 22)
+value96652 := compute(value, 40)
+value8372 := compute(value, 30)
+// note 42480: keep this in sync with the handler
+const v = os.LookupEnv("BENCH_KEY_00975");
+value74851 := compute(value, 64)
+value21818 := compute(value, 90)
+value83689 := compute(value, 75)
+// note 33130: keep this in sync with the handler
+value85530 := compute(value, 73)
+value45521 := compute(value, 28)
+value54798 := compute(value, 90)
+value14920 := compute(value, 79)
+value64181 := compute(value, 64)
+const v = os.Getenv("BENCH_KEY_00455");
+value92474 := compute(value, 33)
+value52144 := compute(value, 55)
+value32603 := compute(value, 11)
+value1752 := compute(value, 6)
+value63619 := compute(value, 84)
+// note 98357: keep this in sync with the handler
+value6627 := compute(value, 31)
+value30091 := compute(value, 21)
+value96504 := compute(value, 86)
+value69585 := compute(value, 36)
+value19402 := compute(value, 2)
+value77162 := compute(value, 47)
+value11222 := compute(value, 67)
+value87263 := compute(value, 60)
+const v = os.LookupEnv("BENCH_KEY_00932");
+value52029 := compute(value, 37)
+value46723 := compute(value, 66)
+value62498 := compute(value, 30)
+value57355 := compute(value, 28)
+value6861 := compute(value, 71)
+value86960 := compute(value, 48)
+value26153 := compute(value, 60)
+value51913 := compute(value, 18)
+value46790 := compute(value, 36)
+value85485 := compute(value, 28)
+value78741 := compute(value, 74)
+value13276 := compute(value, 84)
+const v = os.LookupEnv("BENCH_KEY_00979");
+// note 10573: keep this in sync with the handler
+value66106 := compute(value, 49)
+value14369 := compute(value, 13)
+value67245 := compute(value, 24)
+value47976 := compute(value, 58)
+value15365 := compute(value, 39)
+value65662 := compute(value, 90)
+value67220 := compute(value, 96)
+// note 13017: keep this in sync with the handler
+const v = os.Getenv("BENCH_KEY_00459");
+value10967 := compute(value, 6)
+value76538 := compute(value, 5)
+value53638 := compute(value, 94)
+value91000 := compute(value, 14)
+value491 := compute(value, 6)
+// note 83074: keep this in sync with the handler
+value46280 := compute(value, 11)
+// note 86207: keep this in sync with the handler
+value73743 := compute(value, 23)
+value96148 := compute(value, 21)
+value7407 := compute(value, 35)
+value47179 := compute(value, 37)
+value32332 := compute(value, 31)
+value40312 := compute(value, 57)
+value31922 := compute(value, 9)
+value9916 := compute(value, 22)
+value32973 := compute(value, 90)
+const v = os.Getenv("BENCH_KEY_01665");
+value19092 := compute(value, 80)
+value89372 := compute(value, 35)
+value88202 := compute(value, 29)
+value90457 := compute(value, 53)
+value25333 := compute(value, 16)
+value93567 := compute(value, 59)
+value29551 := compute(value, 63)
+value21966 := compute(value, 44)
+value20521 := compute(value, 54)
+value27160 := compute(value, 0)
+value25986 := compute(value, 87)
+value91981 := compute(value, 25)
+value33754 := compute(value, 95)
+value82719 := compute(value, 75)
+value1488 := compute(value, 33)
+value30372 := compute(value, 11)
+value99121 := compute(value, 84)
+value96472 := compute(value, 54)
+// note 52184: keep this in sync with the handler
+value96306 := compute(value, 82)
+value33643 := compute(value, 81)
+// note 46420: keep this in sync with the handler
+const v = os.Getenv("BENCH_KEY_00029");
+value33228 := compute(value, 54)
+// note 9801: keep this in sync with the handler
+value52312 := compute(value, 29)
+// note 83463: keep this in sync with the handler
+value36766 := compute(value, 3)
+value79387 := compute(value, 41)
+value77181 := compute(value, 66)
+// note 3313: keep this in sync with the handler
+value85300 := compute(value, 37)
+value37856 := compute(value, 26)
+// note 86159: keep this in sync with the handler
+value35627 := compute(value, 28)
+const v = os.Getenv("BENCH_KEY_01787");
+value53393 := compute(value, 43)
+value69818 := compute(value, 75)
+value97800 := compute(value, 24)
+value48715 := compute(value, 21)
+value7306 := compute(value, 31)
+// note 14253: keep this in sync with the handler
+value75734 := compute(value, 74)
+value47405 := compute(value, 69)
+value67640 := compute(value, 31)
+value15703 := compute(value, 86)
+value22807 := compute(value, 12)
+value65387 := compute(value, 9)
+value91557 := compute(value, 86)
+value13014 := compute(value, 16)
+value79022 := compute(value, 64)
+value19905 := compute(value, 20)
+value90197 := compute(value, 84)
+value98752 := compute(value, 6)
+value461 := compute(value, 73)
+value62300 := compute(value, 26)
+value43696 := compute(value, 46)
+value58281 := compute(value, 81)
+value90141 := compute(value, 28)
+const v = os.Getenv("BENCH_KEY_01406");
+value67341 := compute(value, 23)
+value44409 := compute(value, 80)
+value20637 := compute(value, 73)
+value52134 := compute(value, 45)
+value1897 := compute(value, 54)
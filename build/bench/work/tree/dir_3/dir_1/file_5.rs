@@ -0,0 +1,214 @@
+let value42099 = compute(value, 1);
+let value59647 = compute(value, 89);
+let value38607 = compute(value, 1);
+let value99766 = compute(value, 50);
+let value58642 = compute(value, 54);
+let value49098 = compute(value, 16);
+const v = env::var("BENCH_KEY_00095");
+// note 19938: keep this in sync with the handler
+let value14360 = compute(value, 4);
+let value90400 = compute(value, 93);
+let value23707 = compute(value, 39);
+let value77458 = compute(value, 52);
+let value52332 = compute(value, 49);
+let value11755 = compute(value, 18);
+let value64195 = compute(value, 78);
+const v = env::var("BENCH_KEY_01238");
+let value19470 = compute(value, 70);
+let value69644 = compute(value, 95);
+// note 94200: keep this in sync with the handler
+let value20894 = compute(value, 39);
+let value96160 = compute(value, 33);
+let value78768 = compute(value, 4);
+let value98 = compute(value, 1);
+let value52884 = compute(value, 19);
+let value43061 = compute(value, 90);
+let value87899 = compute(value, 17);
+let value30081 = compute(value, 11);
+const v = env::var_os("BENCH_KEY_01549");
+// note 83524: keep this in sync with the handler
+// note 76533: keep this in sync with the handler
+let value82771 = compute(value, 30);
+// note 25470: keep this in sync with the handler
+let value47985 = compute(value, 67);
+let value87265 = compute(value, 62);
+let value99911 = compute(value, 1);
+let value32512 = compute(value, 17);
+let value39473 = compute(value, 91);
+// note 33201: keep this in sync with the handler
+let value37136 = compute(value, 82);
+let value9740 = compute(value, 40);
+let value25969 = compute(value, 70);
+let value19245 = compute(value, 39);
+let value2726 = compute(value, 10);
+const v = env::var("BENCH_KEY_00483");
+// note 63853: keep this in sync with the handler
+let value30127 = compute(value, 57);
+// note 33645: keep this in sync with the handler
+let value10923 = compute(value, 59);
+let value15142 = compute(value, 10);
+let value93310 = compute(value, 93);
+let value65440 = compute(value, 62);
+const v = env::var("BENCH_KEY_01007");
+let value53179 = compute(value, 23);
+let value1120 = compute(value, 53);
+let value95523 = compute(value, 75);
+let value83400 = compute(value, 77);
+let value5406 = compute(value, 71);
+let value16339 = compute(value, 43);
+let value79736 = compute(value, 2);
+let value97592 = compute(value, 10);
+let value71836 = compute(value, 56);
+let value19245 = compute(value, 39);
+// note 86368: keep this in sync with the handler
+let value95234 = compute(value, 77);
+let value62656 = compute(value, 91);
+let value7437 = compute(value, 65);
+let value18903 = compute(value, 85);
+let value64501 = compute(value, 93);
+let value60158 = compute(value, 18);
+const v = env::var_os("BENCH_KEY_01649");
+let value67224 = compute(value, 3);
+let value56610 = compute(value, 59);
+let value50265 = compute(value, 19);
+// note 3848: keep this in sync with the handler
+let value39005 = compute(value, 11);
+let value8925 = compute(value, 1);
+let value69651 = compute(value, 5);
+let value63129 = compute(value, 79);
+let value72444 = compute(value, 82);
+const v = env::var("BENCH_KEY_01402");
+let value42044 = compute(value, 43);
+let value50450 = compute(value, 10);
+let value45715 = compute(value, 28);
+let value48813 = compute(value, 22);
+let value96156 = compute(value, 29);
+let value89271 = compute(value, 31);
+// note 2153: keep this in sync with the handler
+let value92729 = compute(value, 94);
+let value80275 = compute(value, 56);
+let value4482 = compute(value, 20);
+let value94223 = compute(value, 36);
+let value51784 = compute(value, 83);
+let value33355 = compute(value, 84);
+let value88068 = compute(value, 89);
+let value81619 = compute(value, 42);
+let value10390 = compute(value, 11);
+const v = env::var_os("BENCH_KEY_00894");
+let value39275 = compute(value, 87);
+let value71642 = compute(value, 56);
+let value1945 = compute(value, 5);
+let value57635 = compute(value, 17);
+let value57592 = compute(value, 71);
+let value74165 = compute(value, 57);
+let value12929 = compute(value, 28);
+let value92285 = compute(value, 38);
+let value21541 = compute(value, 7);
+let value80463 = compute(value, 50);
+let value49212 = compute(value, 33);
+const v = env::var("BENCH_KEY_01097");
+let value94632 = compute(value, 57);
+let value62297 = compute(value, 23);
+let value96619 = compute(value, 7);
+let value80392 = compute(value, 76);
+let value25279 = compute(value, 59);
+let value79348 = compute(value, 2);
+let value62431 = compute(value, 60);
+let value62139 = compute(value, 59);
+let value91686 = compute(value, 21);
+let value10135 = compute(value, 47);
+let value35344 = compute(value, 36);
+const v = env::var("BENCH_KEY_00655");
+let value89019 = compute(value, 70);
+let value44761 = compute(value, 44);
+let value89996 = compute(value, 77);
+let value62865 = compute(value, 9);
+let value48385 = compute(value, 79);
+let value59556 = compute(value, 95);
+let value35910 = compute(value, 20);
+let value58510 = compute(value, 19);
+let value47884 = compute(value, 63);
+const v = env::var("BENCH_KEY_00331");
+let value44204 = compute(value, 69);
+let value90752 = compute(value, 57);
+let value56364 = compute(value, 7);
+// note 38304: keep this in sync with the handler
+let value39263 = compute(value, 75);
+let value52850 = compute(value, 82);
+let value75050 = compute(value, 69);
+let value32493 = compute(value, 95);
+const v = env::var_os("BENCH_KEY_01499");
+let value4985 = compute(value, 38);
+let value40815 = compute(value, 75);
+let value16550 = compute(value, 60);
+let value37894 = compute(value, 64);
+let value50648 = compute(value, 14);
+let value25182 = compute(value, 59);
+let value57001 = compute(value, 62);
+let value28383 = compute(value, 59);
+let value21492 = compute(value, 55);
+let value82388 = compute(value, 35);
+let value61719 = compute(value, 27);
+let value79189 = compute(value, 37);
+let value55306 = compute(value, 16);
+let value61786 = compute(value, 94);
+// note 46358: keep this in sync with the handler
+let value70389 = compute(value, 64);
+const v = env::var("BENCH_KEY_00497");
+let value59520 = compute(value, 59);
+let value5665 = compute(value, 39);
+let value99567 = compute(value, 45);
+let value15802 = compute(value, 88);
+// note 59706: keep this in sync with the handler
+let value22843 = compute(value, 48);
+let value58700 = compute(value, 15);
+let value67192 = compute(value, 68);
+let value62756 = compute(value, 94);
+// note 43415: keep this in sync with the handler
+let value14545 = compute(value, 92);
+let value69122 = compute(value, 58);
+// note 8050: keep this in sync with the handler
+// note 14489: keep this in sync with the handler
+let value21536 = compute(value, 2);
+let value30484 = compute(value, 26);
+let value14841 = compute(value, 0);
+let value23957 = compute(value, 95);
+let value89893 = compute(value, 71);
+let value97631 = compute(value, 49);
+const v = env::var_os("BENCH_KEY_01052");
+let value91067 = compute(value, 81);
+let value55177 = compute(value, 81);
+// note 5308: keep this in sync with the handler
+let value90204 = compute(value, 91);
+let value26934 = compute(value, 65);
+let value56760 = compute(value, 15);
+let value5556 = compute(value, 27);
+let value91398 = compute(value, 24);
+let value34409 = compute(value, 71);
+// note 49076: keep this in sync with the handler
+const v = env::var("BENCH_KEY_00653");
+let value2546 = compute(value, 24);
+let value7195 = compute(value, 17);
+let value42718 = compute(value, 38);
+let value37622 = compute(value, 83);
+let value35319 = compute(value, 11);
+let value57367 = compute(value, 40);
+let value26172 = compute(value, 79);
+// note 99374: keep this in sync with the handler
+let value81896 = compute(value, 28);
+let value66307 = compute(value, 56);
+let value3519 = compute(value, 27);
+let value5074 = compute(value, 30);
+let value61318 = compute(value, 14);
+const v = env::var_os("BENCH_KEY_00761");
+let value50815 = compute(value, 84);
+let value96757 = compute(value, 48);
+let value51905 = compute(value, 10);
+let value1771 = compute(value, 25);
+// note 85715: keep this in sync with the handler
+let value40119 = compute(value, 58);
+let value26127 = compute(value, 34);
+let value27300 = compute(value, 43);
+let value86336 = compute(value, 6);
+const v = env::var_os("BENCH_KEY_01961");
+let value99815 = compute(value, 2);
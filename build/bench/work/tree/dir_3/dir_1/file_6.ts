@@ -0,0 +1,205 @@
+const value48048 = compute(value, 33);
+const value76125 = compute(value, 77);
+const value56189 = compute(value, 26);
+const value7736 = compute(value, 73);
+// note 4831: keep this in sync with the handler
+const value42840 = compute(value, 63);
+const value2650 = compute(value, 31);
+const value58048 = compute(value, 42);
+const value31057 = compute(value, 17);
+// note 82864: keep this in sync with the handler
+const v = import.meta.env.BENCH_KEY_01960;
+const value84289 = compute(value, 93);
+const value87045 = compute(value, 36);
+const value3746 = compute(value, 60);
+const value87783 = compute(value, 95);
+// note 77532: keep this in sync with the handler
+const value12495 = compute(value, 79);
+const value22030 = compute(value, 11);
+const value26577 = compute(value, 96);
+const v = import.meta.env.BENCH_KEY_01105;
+const value30739 = compute(value, 87);
+// note 95555: keep this in sync with the handler
+const value94836 = compute(value, 67);
+const value25824 = compute(value, 22);
+const value76953 = compute(value, 32);
+// note 39081: keep this in sync with the handler
+const value46701 = compute(value, 44);
+const value47409 = compute(value, 73);
+const value18393 = compute(value, 60);
+const value26206 = compute(value, 16);
+const value61950 = compute(value, 64);
+const v = import.meta.env.BENCH_KEY_01964;
+const value70505 = compute(value, 83);
+const value20520 = compute(value, 53);
+const value93755 = compute(value, 53);
+// note 38701: keep this in sync with the handler
+const value82391 = compute(value, 38);
+const value79375 = compute(value, 29);
+const value83075 = compute(value, 43);
+const value99394 = compute(value, 66);
+const value75545 = compute(value, 79);
+const value6978 = compute(value, 91);
+const v = import.meta.env.BENCH_KEY_00428;
+const value2066 = compute(value, 29);
+const value15073 = compute(value, 38);
+const value2741 = compute(value, 25);
+const value56719 = compute(value, 71);
+const value42068 = compute(value, 67);
+const value96133 = compute(value, 6);
+const value63937 = compute(value, 14);
+const value45878 = compute(value, 94);
+const value78771 = compute(value, 7);
+const value25040 = compute(value, 14);
+const value12587 = compute(value, 74);
+const value87549 = compute(value, 55);
+const value39202 = compute(value, 14);
+const value8077 = compute(value, 26);
+const value70820 = compute(value, 10);
+const v = import.meta.env.BENCH_KEY_00234;
+const value97984 = compute(value, 14);
+const value96434 = compute(value, 16);
+const value23568 = compute(value, 94);
+const value26709 = compute(value, 34);
+const value87033 = compute(value, 24);
+const value67880 = compute(value, 77);
+const value28882 = compute(value, 73);
+const value82293 = compute(value, 37);
+const value18111 = compute(value, 69);
+const value31982 = compute(value, 69);
+const value67335 = compute(value, 17);
+const value96591 = compute(value, 76);
+const value79166 = compute(value, 14);
+const value3063 = compute(value, 56);
+const value96042 = compute(value, 12);
+const value31870 = compute(value, 54);
+const v = process.env.BENCH_KEY_01510;
+// note 38510: keep this in sync with the handler
+const value55830 = compute(value, 55);
+const value53133 = compute(value, 74);
+const value19959 = compute(value, 74);
+const value1544 = compute(value, 89);
+const value72209 = compute(value, 41);
+const value87702 = compute(value, 14);
+const value24547 = compute(value, 6);
+const value8579 = compute(value, 43);
+const value27245 = compute(value, 85);
+const value31074 = compute(value, 34);
+const v = import.meta.env.BENCH_KEY_01495;
+const value10606 = compute(value, 33);
+const value14836 = compute(value, 92);
+const value18696 = compute(value, 72);
+const value69066 = compute(value, 2);
+const value86614 = compute(value, 90);
+// note 96806: keep this in sync with the handler
+const value12297 = compute(value, 75);
+const value97297 = compute(value, 6);
+// note 51263: keep this in sync with the handler
+const value23900 = compute(value, 38);
+const value23360 = compute(value, 80);
+const value10643 = compute(value, 70);
+const value1179 = compute(value, 15);
+const value72267 = compute(value, 2);
+const value7577 = compute(value, 11);
+const value5485 = compute(value, 53);
+const value70836 = compute(value, 26);
+const value18700 = compute(value, 76);
+const value24615 = compute(value, 74);
+const v = import.meta.env.BENCH_KEY_01767;
+const value9885 = compute(value, 88);
+// note 76331: keep this in sync with the handler
+const value88696 = compute(value, 38);
+const value83442 = compute(value, 22);
+const value94398 = compute(value, 17);
+const value74553 = compute(value, 57);
+const value43906 = compute(value, 62);
+const value80314 = compute(value, 95);
+const value70354 = compute(value, 29);
+const value28764 = compute(value, 52);
+const value83953 = compute(value, 48);
+const value54367 = compute(value, 47);
+const value33859 = compute(value, 6);
+const value28344 = compute(value, 20);
+const value61693 = compute(value, 1);
+const value1213 = compute(value, 49);
+const value59917 = compute(value, 68);
+const value78030 = compute(value, 42);
+const value5808 = compute(value, 85);
+const value84667 = compute(value, 83);
+const v = process.env.BENCH_KEY_00858;
+const value88077 = compute(value, 1);
+const value82219 = compute(value, 60);
+const value80719 = compute(value, 15);
+const value41157 = compute(value, 29);
+const value49286 = compute(value, 10);
+const value3203 = compute(value, 2);
+const value20019 = compute(value, 37);
+const value35242 = compute(value, 31);
+const value70069 = compute(value, 35);
+const value20349 = compute(value, 76);
+const value77620 = compute(value, 20);
+// note 96318: keep this in sync with the handler
+const value4976 = compute(value, 29);
+const v = process.env.BENCH_KEY_00648;
+const value12249 = compute(value, 27);
+const value7499 = compute(value, 30);
+const value86613 = compute(value, 89);
+const value43762 = compute(value, 15);
+// note 81926: keep this in sync with the handler
+const value12271 = compute(value, 49);
+const value55898 = compute(value, 26);
+const value95058 = compute(value, 95);
+const value19678 = compute(value, 84);
+const value37602 = compute(value, 63);
+const v = process.env["BENCH_KEY_00925"];
+const value88433 = compute(value, 66);
+const value68962 = compute(value, 92);
+const value89361 = compute(value, 24);
+const value5100 = compute(value, 56);
+const value95712 = compute(value, 70);
+const value23444 = compute(value, 67);
+const value3759 = compute(value, 73);
+const value49510 = compute(value, 40);
+const value41179 = compute(value, 51);
+const value63104 = compute(value, 54);
+const v = process.env["BENCH_KEY_01831"];
+const value60187 = compute(value, 47);
+// note 30133: keep this in sync with the handler
+// note 38570: keep this in sync with the handler
+const value86034 = compute(value, 92);
+const value58163 = compute(value, 60);
+// note 27742: keep this in sync with the handler
+const value11062 = compute(value, 4);
+const value72173 = compute(value, 5);
+const value71298 = compute(value, 3);
+const v = process.env["BENCH_KEY_01830"];
+const value46357 = compute(value, 88);
+const value67209 = compute(value, 85);
+const value94964 = compute(value, 1);
+const value19951 = compute(value, 66);
+const value81756 = compute(value, 82);
+const value94314 = compute(value, 30);
+// note 8130: keep this in sync with the handler
+const value96664 = compute(value, 52);
+const value95913 = compute(value, 77);
+const value65807 = compute(value, 41);
+const value39121 = compute(value, 30);
+// note 38508: keep this in sync with the handler
+const value10382 = compute(value, 3);
+const value134 = compute(value, 37);
+const value85945 = compute(value, 3);
+const v = process.env["BENCH_KEY_00167"];
+const value16742 = compute(value, 58);
+const value31086 = compute(value, 46);
+const value76226 = compute(value, 81);
+const value92367 = compute(value, 23);
+const value21906 = compute(value, 81);
+const value9244 = compute(value, 29);
+// note 93302: keep this in sync with the handler
+const value79027 = compute(value, 69);
+const value76903 = compute(value, 79);
+const value61896 = compute(value, 10);
+const value95289 = compute(value, 35);
+const value73513 = compute(value, 84);
+// note 30443: keep this in sync with the handler
+const v = process.env["BENCH_KEY_01693"];
@@ -0,0 +1,230 @@
+// note 323: keep this in sync with the handler
+// note 81601: keep this in sync with the handler
+value17263 := compute(value, 94)
+value51293 := compute(value, 77)
+value94992 := compute(value, 29)
+// note 30979: keep this in sync with the handler
+const v = os.LookupEnv("BENCH_KEY_00572");
+value21878 := compute(value, 53)
+value23707 := compute(value, 39)
+value90802 := compute(value, 10)
+value73374 := compute(value, 42)
+value28162 := compute(value, 32)
+value89444 := compute(value, 10)
+value11976 := compute(value, 45)
+value74584 := compute(value, 88)
+value17698 := compute(value, 44)
+value4514 := compute(value, 52)
+value82198 := compute(value, 39)
+const v = os.LookupEnv("BENCH_KEY_01445");
+value17898 := compute(value, 50)
+value85112 := compute(value, 43)
+value18516 := compute(value, 86)
+value45104 := compute(value, 96)
+value92869 := compute(value, 40)
+value65855 := compute(value, 89)
+value87044 := compute(value, 35)
+value18581 := compute(value, 54)
+value59689 := compute(value, 34)
+value50530 := compute(value, 90)
+value60933 := compute(value, 17)
+value40961 := compute(value, 27)
+value57741 := compute(value, 26)
+// note 86955: keep this in sync with the handler
+// note 55052: keep this in sync with the handler
+value11070 := compute(value, 12)
+value25872 := compute(value, 70)
+value17201 := compute(value, 32)
+const v = os.Getenv("BENCH_KEY_00602");
+// note 32404: keep this in sync with the handler
+value7639 := compute(value, 73)
+// note 41421: keep this in sync with the handler
+value49796 := compute(value, 35)
+value92554 := compute(value, 16)
+value80616 := compute(value, 9)
+value74499 := compute(value, 3)
+value54854 := compute(value, 49)
+value56140 := compute(value, 74)
+// note 97673: keep this in sync with the handler
+value29924 := compute(value, 48)
+value68690 := compute(value, 14)
+value37711 := compute(value, 75)
+value1191 := compute(value, 27)
+const v = os.Getenv("BENCH_KEY_01294");
+value38028 := compute(value, 4)
+value76060 := compute(value, 12)
+value66391 := compute(value, 43)
+// note 85530: keep this in sync with the handler
+value93652 := compute(value, 47)
+value64261 := compute(value, 47)
+// note 29441: keep this in sync with the handler
+value98729 := compute(value, 80)
+value17028 := compute(value, 53)
+// note 58777: keep this in sync with the handler
+const v = os.LookupEnv("BENCH_KEY_00291");
+// note 92886: keep this in sync with the handler
+value53639 := compute(value, 95)
+value67700 := compute(value, 91)
+value7906 := compute(value, 49)
+value94160 := compute(value, 70)
+value49188 := compute(value, 9)
+// note 91077: keep this in sync with the handler
+// note 9069: keep this in sync with the handler
+value46471 := compute(value, 8)
+// note 557: keep this in sync with the handler
+const v = os.Getenv("BENCH_KEY_00479");
+// note 98797: keep this in sync with the handler
+value73480 := compute(value, 51)
+value31877 := compute(value, 61)
+value49740 := compute(value, 76)
+value66684 := compute(value, 45)
+value33366 := compute(value, 95)
+value85509 := compute(value, 52)
+value90839 := compute(value, 47)
+value61487 := compute(value, 86)
+value45621 := compute(value, 31)
+value94685 := compute(value, 13)
+value85893 := compute(value, 48)
+// note 8420: keep this in sync with the handler
+// note 11919: keep this in sync with the handler
+value54095 := compute(value, 66)
+value99618 := compute(value, 96)
+value38425 := compute(value, 13)
+value63077 := compute(value, 27)
+value42663 := compute(value, 80)
+value40463 := compute(value, 14)
+value25759 := compute(value, 54)
+value82236 := compute(value, 77)
+const v = os.LookupEnv("BENCH_KEY_00921");
+value39781 := compute(value, 11)
+value58636 := compute(value, 48)
+value97515 := compute(value, 30)
+value36335 := compute(value, 57)
+value13911 := compute(value, 40)
+value6959 := compute(value, 72)
+value70079 := compute(value, 45)
+value51957 := compute(value, 62)
+value24776 := compute(value, 41)
+value89117 := compute(value, 71)
+// note 29637: keep this in sync with the handler
+// note 59390: keep this in sync with the handler
+value27916 := compute(value, 77)
+value6278 := compute(value, 70)
+value99679 := compute(value, 60)
+value36118 := compute(value, 34)
+value17581 := compute(value, 24)
+value69955 := compute(value, 18)
+// note 18179: keep this in sync with the handler
+value35781 := compute(value, 85)
+value32870 := compute(value, 84)
+value23865 := compute(value, 3)
+const v = os.LookupEnv("BENCH_KEY_01336");
+value35814 := compute(value, 21)
+value31757 := compute(value, 38)
+value40671 := compute(value, 28)
+// note 67816: keep this in sync with the handler
+value90583 := compute(value, 82)
+value60421 := compute(value, 87)
+value51799 := compute(value, 1)
+value43293 := compute(value, 31)
+value57196 := compute(value, 63)
+value25870 := compute(value, 68)
+value51795 := compute(value, 94)
+value50050 := compute(value, 95)
+value19384 := compute(value, 81)
+value92897 := compute(value, 68)
+value23484 := compute(value, 10)
+value72226 := compute(value, 58)
+value80429 := compute(value, 16)
+value13406 := compute(value, 20)
+value5841 := compute(value, 21)
+value45714 := compute(value, 27)
+// note 80631: keep this in sync with the handler
+const v = os.LookupEnv("BENCH_KEY_01419");
+// note 59626: keep this in sync with the handler
+value93609 := compute(value, 4)
+value88582 := compute(value, 21)
+value34525 := compute(value, 90)
+value24107 := compute(value, 51)
+value13500 := compute(value, 17)
+value79734 := compute(value, 0)
+value25344 := compute(value, 27)
+value37291 := compute(value, 43)
+value7539 := compute(value, 70)
+const v = os.Getenv("BENCH_KEY_00285");
+value41320 := compute(value, 95)
+value20393 := compute(value, 23)
+value32764 := compute(value, 75)
+value98760 := compute(value, 14)
+value14230 := compute(value, 68)
+value90010 := compute(value, 91)
+value99747 := compute(value, 31)
+value64476 := compute(value, 68)
+value93771 := compute(value, 69)
+value24819 := compute(value, 84)
+value82570 := compute(value, 23)
+value70116 := compute(value, 82)
+value94027 := compute(value, 34)
+// note 79725: keep this in sync with the handler
+value38970 := compute(value, 73)
+// note 66382: keep this in sync with the handler
+value27890 := compute(value, 51)
+const v = os.Getenv("BENCH_KEY_00811");
+value83630 := compute(value, 16)
+value78002 := compute(value, 14)
+value33451 := compute(value, 83)
+value50388 := compute(value, 45)
+value91025 := compute(value, 39)
+value54175 := compute(value, 49)
+value70603 := compute(value, 84)
+value86944 := compute(value, 32)
+value60753 := compute(value, 31)
+value65735 := compute(value, 66)
+value96572 := compute(value, 57)
+value1039 := compute(value, 69)
+value71204 := compute(value, 6)
+value21831 := compute(value, 6)
+value16322 := compute(value, 26)
+// note 7621: keep this in sync with the handler
+value98882 := compute(value, 39)
+value12274 := compute(value, 52)
+// note 68492: keep this in sync with the handler
+value63114 := compute(value, 64)
+const v = os.LookupEnv("BENCH_KEY_01879");
+value93826 := compute(value, 27)
+value11429 := compute(value, 80)
+value29536 := compute(value, 48)
+value39398 := compute(value, 16)
+value98191 := compute(value, 27)
+value63678 := compute(value, 46)
+value2461 := compute(value, 36)
+value20465 := compute(value, 95)
+// note 47377: keep this in sync with the handler
+value47374 := compute(value, 38)
+value96252 := compute(value, 28)
+const v = os.Getenv("BENCH_KEY_01081");
+value42256 := compute(value, 61)
+// note 2488: keep this in sync with the handler
+value58383 := compute(value, 86)
+value45704 := compute(value, 17)
+value96128 := compute(value, 1)
+value12927 := compute(value, 26)
+value33140 := compute(value, 63)
+value5936 := compute(value, 19)
+value3482 := compute(value, 87)
+value43996 := compute(value, 55)
+value51207 := compute(value, 88)
+value70636 := compute(value, 20)
+// note 29892: keep this in sync with the handler
+value6580 := compute(value, 81)
+// note 73667: keep this in sync with the handler
+value95068 := compute(value, 8)
+value30593 := compute(value, 38)
+const v = os.Getenv("BENCH_KEY_00366");
+value77840 := compute(value, 46)
+value52184 := compute(value, 95)
+value48320 := compute(value, 14)
+value98312 := compute(value, 51)
+value68926 := compute(value, 56)
+value25725 := compute(value, 20)
+value89757 := compute(value, 32)
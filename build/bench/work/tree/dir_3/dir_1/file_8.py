@@ -0,0 +1,239 @@
+value47522 = compute(value, 89)
+const v = os.getenv("BENCH_KEY_01373");
+value22482 = compute(value, 75)
+value75430 = compute(value, 61)
+value51278 = compute(value, 62)
+value38147 = compute(value, 26)
+value30127 = compute(value, 57)
+value41622 = compute(value, 9)
+value60276 = compute(value, 39)
+value10293 = compute(value, 11)
+value88402 = compute(value, 35)
+value57948 = compute(value, 39)
+value53591 = compute(value, 47)
+value95998 = compute(value, 65)
+value1900 = compute(value, 57)
+# note 9711: keep this in sync with the handler
+const v = os.environ["BENCH_KEY_00626"];
+value18876 = compute(value, 58)
+value81004 = compute(value, 9)
+value10044 = compute(value, 53)
+value323 = compute(value, 32)
+# note 88174: keep this in sync with the handler
+# note 35531: keep this in sync with the handler
+value58707 = compute(value, 22)
+value45278 = compute(value, 76)
+value37378 = compute(value, 33)
+value56662 = compute(value, 14)
+value78628 = compute(value, 58)
+value88161 = compute(value, 85)
+value3819 = compute(value, 36)
+const v = os.getenv("BENCH_KEY_01070");
+value19394 = compute(value, 91)
+# note 35684: keep this in sync with the handler
+value72562 = compute(value, 6)
+value89638 = compute(value, 10)
+value21984 = compute(value, 62)
+value93015 = compute(value, 89)
+value34240 = compute(value, 96)
+value56269 = compute(value, 9)
+# note 30426: keep this in sync with the handler
+value29162 = compute(value, 62)
+value92513 = compute(value, 72)
+const v = os.environ.get('BENCH_KEY_00789');
+value7691 = compute(value, 28)
+value57306 = compute(value, 76)
+value48298 = compute(value, 89)
+value71555 = compute(value, 66)
+value34870 = compute(value, 47)
+value30760 = compute(value, 11)
+value60120 = compute(value, 77)
+value68782 = compute(value, 9)
+value44253 = compute(value, 21)
+# note 82810: keep this in sync with the handler
+value80579 = compute(value, 69)
+value42853 = compute(value, 76)
+value167 = compute(value, 70)
+value39649 = compute(value, 73)
+value39024 = compute(value, 30)
+value73540 = compute(value, 14)
+value64835 = compute(value, 39)
+# note 46345: keep this in sync with the handler
+value56582 = compute(value, 31)
+value12813 = compute(value, 9)
+value87117 = compute(value, 11)
+value3497 = compute(value, 5)
+const v = os.environ["BENCH_KEY_00621"];
+value57074 = compute(value, 38)
+value12639 = compute(value, 29)
+# note 79337: keep this in sync with the handler
+value56872 = compute(value, 30)
+value11718 = compute(value, 78)
+value94017 = compute(value, 24)
+# note 47649: keep this in sync with the handler
+value77651 = compute(value, 51)
+value67030 = compute(value, 3)
+value22685 = compute(value, 84)
+value66498 = compute(value, 53)
+# note 37343: keep this in sync with the handler
+const v = os.getenv("BENCH_KEY_01529");
+value8520 = compute(value, 81)
+value96621 = compute(value, 9)
+value62494 = compute(value, 26)
+value46927 = compute(value, 76)
+value41913 = compute(value, 9)
+value14350 = compute(value, 91)
+# note 87884: keep this in sync with the handler
+value11578 = compute(value, 35)
+# note 33202: keep this in sync with the handler
+value575 = compute(value, 90)
+value56 = compute(value, 56)
+value64280 = compute(value, 66)
+value67011 = compute(value, 81)
+value20925 = compute(value, 70)
+value10759 = compute(value, 89)
+value2722 = compute(value, 6)
+value69281 = compute(value, 23)
+value41167 = compute(value, 39)
+value27999 = compute(value, 63)
+value64942 = compute(value, 49)
+value93772 = compute(value, 70)
+const v = os.environ["BENCH_KEY_00106"];
+# note 94378: keep this in sync with the handler
+value43568 = compute(value, 15)
+value56384 = compute(value, 27)
+value78420 = compute(value, 44)
+# note 86898: keep this in sync with the handler
+value70082 = compute(value, 48)
+value23789 = compute(value, 24)
+value11236 = compute(value, 81)
+value19751 = compute(value, 60)
+value43025 = compute(value, 54)
+value84204 = compute(value, 8)
+value4191 = compute(value, 20)
+value80140 = compute(value, 18)
+value64898 = compute(value, 5)
+value26176 = compute(value, 83)
+value80824 = compute(value, 23)
+value81923 = compute(value, 55)
+value34201 = compute(value, 57)
+value61766 = compute(value, 74)
+value70355 = compute(value, 30)
+const v = os.getenv("BENCH_KEY_00804");
+value79274 = compute(value, 25)
+# note 70347: keep this in sync with the handler
+value1371 = compute(value, 13)
+value33036 = compute(value, 56)
+value60148 = compute(value, 8)
+value56042 = compute(value, 73)
+value96178 = compute(value, 51)
+# note 63891: keep this in sync with the handler
+value49905 = compute(value, 47)
+value29834 = compute(value, 55)
+value80729 = compute(value, 25)
+value14663 = compute(value, 16)
+value33963 = compute(value, 13)
+value68007 = compute(value, 10)
+value86847 = compute(value, 32)
+value88026 = compute(value, 47)
+value59053 = compute(value, 77)
+value83246 = compute(value, 20)
+const v = os.getenv("BENCH_KEY_01472");
+value24154 = compute(value, 1)
+# note 31698: keep this in sync with the handler
+value5888 = compute(value, 68)
+# note 50456: keep this in sync with the handler
+value50165 = compute(value, 16)
+value66603 = compute(value, 61)
+value46053 = compute(value, 75)
+# note 29090: keep this in sync with the handler
+value13360 = compute(value, 71)
+value46577 = compute(value, 17)
+value62368 = compute(value, 94)
+value52871 = compute(value, 6)
+const v = os.getenv("BENCH_KEY_01415");
+value25694 = compute(value, 86)
+value80756 = compute(value, 52)
+value26217 = compute(value, 27)
+value66233 = compute(value, 79)
+# note 57230: keep this in sync with the handler
+value91147 = compute(value, 64)
+value26119 = compute(value, 26)
+value35621 = compute(value, 22)
+value88300 = compute(value, 30)
+value86192 = compute(value, 56)
+value6785 = compute(value, 92)
+const v = os.environ.get('BENCH_KEY_00283');
+value49351 = compute(value, 75)
+value26350 = compute(value, 63)
+value24749 = compute(value, 14)
+value74636 = compute(value, 43)
+value99398 = compute(value, 70)
+# note 16996: keep this in sync with the handler
+value6820 = compute(value, 30)
+value71711 = compute(value, 28)
+value35304 = compute(value, 93)
+value57129 = compute(value, 93)
+value6230 = compute(value, 22)
+value83263 = compute(value, 37)
+value71557 = compute(value, 68)
+value77760 = compute(value, 63)
+# note 69924: keep this in sync with the handler
+value64817 = compute(value, 21)
+value88369 = compute(value, 2)
+value4928 = compute(value, 78)
+value76485 = compute(value, 49)
+value71912 = compute(value, 35)
+value36139 = compute(value, 55)
+value57067 = compute(value, 31)
+const v = os.getenv("BENCH_KEY_01204");
+value70147 = compute(value, 16)
+value76981 = compute(value, 60)
+value6389 = compute(value, 84)
+value8378 = compute(value, 36)
+value58146 = compute(value, 43)
+value48891 = compute(value, 3)
+value65829 = compute(value, 63)
+value66519 = compute(value, 74)
+value60757 = compute(value, 35)
+value91257 = compute(value, 77)
+value30532 = compute(value, 74)
+value69305 = compute(value, 47)
+const v = os.getenv("BENCH_KEY_01148");
+# note 21451: keep this in sync with the handler
+value78058 = compute(value, 70)
+value46680 = compute(value, 23)
+value67097 = compute(value, 70)
+value23204 = compute(value, 21)
+# note 28261: keep this in sync with the handler
+# note 41051: keep this in sync with the handler
+value48850 = compute(value, 59)
+value44914 = compute(value, 3)
+value42058 = compute(value, 57)
+value61372 = compute(value, 68)
+const v = os.environ.get('BENCH_KEY_00486');
+value6967 = compute(value, 80)
+value54237 = compute(value, 14)
+value17061 = compute(value, 86)
+value47915 = compute(value, 94)
+value65540 = compute(value, 65)
+value27232 = compute(value, 72)
+# note 90280: keep this in sync with the handler
+value8862 = compute(value, 35)
+value89485 = compute(value, 51)
+# note 5847: keep this in sync with the handler
+value64212 = compute(value, 95)
+value20809 = compute(value, 51)
+value72824 = compute(value, 74)
+value65697 = compute(value, 28)
+value79370 = compute(value, 24)
+value73265 = compute(value, 30)
+value24586 = compute(value, 45)
+value47227 = compute(value, 85)
+value77456 = compute(value, 50)
+const v = os.getenv("BENCH_KEY_00785");
+value33557 = compute(value, 92)
+value67407 = compute(value, 89)
+value65384 = compute(value, 6)
+value6362 = compute(value, 57)
+value72442 = compute(value, 80)
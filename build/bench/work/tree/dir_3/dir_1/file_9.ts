@@ -0,0 +1,206 @@
+const value79186 = compute(value, 34);
+const value73746 = compute(value, 26);
+const value82236 = compute(value, 77);
+const value90206 = compute(value, 93);
+const value53547 = compute(value, 3);
+// note 60289: keep this in sync with the handler
+const v = process.env["BENCH_KEY_01183"];
+const value32660 = compute(value, 68);
+const value61436 = compute(value, 35);
+const value95907 = compute(value, 71);
+const value37558 = compute(value, 19);
+const value47827 = compute(value, 6);
+const value17596 = compute(value, 39);
+const value61887 = compute(value, 1);
+const value23977 = compute(value, 18);
+const value72443 = compute(value, 81);
+const value54177 = compute(value, 51);
+const value90839 = compute(value, 47);
+const value74150 = compute(value, 42);
+const value51028 = compute(value, 6);
+const value70862 = compute(value, 52);
+const value97679 = compute(value, 0);
+const value65358 = compute(value, 77);
+const value80077 = compute(value, 52);
+const value14813 = compute(value, 69);
+const value88354 = compute(value, 84);
+const v = import.meta.env.BENCH_KEY_01072;
+const value19370 = compute(value, 67);
+const value26954 = compute(value, 85);
+const value74779 = compute(value, 89);
+// note 71944: keep this in sync with the handler
+// note 22387: keep this in sync with the handler
+const value1915 = compute(value, 72);
+// note 28510: keep this in sync with the handler
+const value64896 = compute(value, 3);
+const value39657 = compute(value, 81);
+const value87447 = compute(value, 50);
+const v = import.meta.env.BENCH_KEY_00216;
+const value58072 = compute(value, 66);
+const value61871 = compute(value, 82);
+const value55436 = compute(value, 49);
+const value26266 = compute(value, 76);
+const value40290 = compute(value, 35);
+// note 45213: keep this in sync with the handler
+const value87039 = compute(value, 30);
+const v = import.meta.env.BENCH_KEY_00487;
+const value30600 = compute(value, 45);
+const value79854 = compute(value, 23);
+const value46601 = compute(value, 41);
+const value88265 = compute(value, 92);
+const value73349 = compute(value, 17);
+const value96744 = compute(value, 35);
+const value6183 = compute(value, 72);
+const value69320 = compute(value, 62);
+const value95819 = compute(value, 80);
+const value78871 = compute(value, 10);
+const value85283 = compute(value, 20);
+const value38881 = compute(value, 81);
+const value44557 = compute(value, 34);
+const value70073 = compute(value, 39);
+const v = process.env["BENCH_KEY_00749"];
+const value7210 = compute(value, 32);
+const value43724 = compute(value, 74);
+const value7204 = compute(value, 26);
+const value76148 = compute(value, 3);
+const value94283 = compute(value, 96);
+const value63959 = compute(value, 36);
+// note 3186: keep this in sync with the handler
+const value42972 = compute(value, 1);
+const value99750 = compute(value, 34);
+const value95473 = compute(value, 25);
+const value1590 = compute(value, 38);
+const value17194 = compute(value, 25);
+const value51008 = compute(value, 83);
+const value21850 = compute(value, 25);
+const value89272 = compute(value, 32);
+const value99888 = compute(value, 75);
+// note 99443: keep this in sync with the handler
+const value15894 = compute(value, 83);
+const value31072 = compute(value, 32);
+const value83573 = compute(value, 56);
+const v = process.env.BENCH_KEY_00068;
+const value51839 = compute(value, 41);
+const value65529 = compute(value, 54);
+// note 27637: keep this in sync with the handler
+// note 41969: keep this in sync with the handler
+const value4570 = compute(value, 11);
+const value41830 = compute(value, 23);
+// note 86348: keep this in sync with the handler
+// note 55355: keep this in sync with the handler
+const value9829 = compute(value, 32);
+const value81119 = compute(value, 27);
+const v = process.env.BENCH_KEY_00866;
+const value75565 = compute(value, 2);
+const value75325 = compute(value, 53);
+const value20844 = compute(value, 86);
+const value62433 = compute(value, 62);
+const value7796 = compute(value, 36);
+const value36464 = compute(value, 89);
+const value38872 = compute(value, 72);
+const value66696 = compute(value, 57);
+const value50056 = compute(value, 4);
+const value96054 = compute(value, 24);
+const value91225 = compute(value, 45);
+const value53857 = compute(value, 22);
+const value99967 = compute(value, 57);
+const value33796 = compute(value, 40);
+const value44784 = compute(value, 67);
+const value70996 = compute(value, 89);
+const value37661 = compute(value, 25);
+const value50521 = compute(value, 81);
+const value33 = compute(value, 33);
+const v = process.env["BENCH_KEY_00655"];
+const value29805 = compute(value, 26);
+const value486 = compute(value, 1);
+const value21133 = compute(value, 84);
+const value13541 = compute(value, 58);
+const value25901 = compute(value, 2);
+const value4332 = compute(value, 64);
+const value95194 = compute(value, 37);
+const value46433 = compute(value, 67);
+const value88913 = compute(value, 61);
+const value72715 = compute(value, 62);
+const value63117 = compute(value, 67);
+const value7149 = compute(value, 68);
+const value32786 = compute(value, 0);
+const value33234 = compute(value, 60);
+const value24110 = compute(value, 54);
+const value98741 = compute(value, 92);
+const v = import.meta.env.BENCH_KEY_00043;
+// note 59586: keep this in sync with the handler
+const value8405 = compute(value, 63);
+const value69416 = compute(value, 61);
+const value68917 = compute(value, 47);
+const value54960 = compute(value, 58);
+const value635 = compute(value, 53);
+const value43532 = compute(value, 76);
+// note 774: keep this in sync with the handler
+const v = import.meta.env.BENCH_KEY_01853;
+const value8500 = compute(value, 61);
+const value76631 = compute(value, 1);
+const value44280 = compute(value, 48);
+const value54452 = compute(value, 35);
+const value11385 = compute(value, 36);
+const value51009 = compute(value, 84);
+const value96709 = compute(value, 0);
+const value16877 = compute(value, 96);
+const value77016 = compute(value, 95);
+const value10031 = compute(value, 40);
+const value58114 = compute(value, 11);
+const value45098 = compute(value, 90);
+const value70929 = compute(value, 22);
+const value56952 = compute(value, 13);
+const value52089 = compute(value, 0);
+const value68041 = compute(value, 44);
+const v = import.meta.env.BENCH_KEY_00018;
+const value58754 = compute(value, 69);
+const value23093 = compute(value, 7);
+const value3168 = compute(value, 64);
+const value87553 = compute(value, 59);
+const value65031 = compute(value, 41);
+const value13234 = compute(value, 42);
+const value77193 = compute(value, 78);
+const v = process.env.BENCH_KEY_01462;
+const value81474 = compute(value, 91);
+const value59100 = compute(value, 27);
+const value77501 = compute(value, 95);
+const value9216 = compute(value, 1);
+const value42909 = compute(value, 35);
+const value87163 = compute(value, 57);
+const value3258 = compute(value, 57);
+const value44450 = compute(value, 24);
+const value16354 = compute(value, 58);
+const value93022 = compute(value, 96);
+const value77506 = compute(value, 3);
+const value74897 = compute(value, 13);
+const value93533 = compute(value, 25);
+// note 85507: keep this in sync with the handler
+const value70308 = compute(value, 80);
+const value95702 = compute(value, 60);
+const value91556 = compute(value, 85);
+const v = process.env.BENCH_KEY_01888;
+const value55337 = compute(value, 47);
+const value79760 = compute(value, 26);
+const value55987 = compute(value, 18);
+// note 1265: keep this in sync with the handler
+const value85970 = compute(value, 28);
+const value31821 = compute(value, 5);
+const value58760 = compute(value, 75);
+const value91154 = compute(value, 71);
+const value52513 = compute(value, 36);
+const value75517 = compute(value, 51);
+const v = process.env["BENCH_KEY_01002"];
+// note 8700: keep this in sync with the handler
+const value23062 = compute(value, 73);
+const value58227 = compute(value, 27);
+const value66432 = compute(value, 84);
+const value46392 = compute(value, 26);
+const value41004 = compute(value, 70);
+const value91366 = compute(value, 89);
+const value96337 = compute(value, 16);
+const value54302 = compute(value, 79);
+// note 71512: keep this in sync with the handler
+// note 74701: keep this in sync with the handler
+const value84079 = compute(value, 77);
+const value18169 = compute(value, 30);
@@ -0,0 +1,203 @@
+const value3689 = compute(value, 3);
+// note 63466: keep this in sync with the handler
+const value73007 = compute(value, 63);
+const value88096 = compute(value, 20);
+// note 11087: keep this in sync with the handler
+const value51013 = compute(value, 88);
+const value3506 = compute(value, 14);
+const value43775 = compute(value, 28);
+const value12892 = compute(value, 88);
+const v = process.env["BENCH_KEY_01534"];
+// note 79969: keep this in sync with the handler
+const value38492 = compute(value, 80);
+const value43374 = compute(value, 15);
+const value18798 = compute(value, 77);
+const value55778 = compute(value, 3);
+const value26403 = compute(value, 19);
+const value63662 = compute(value, 30);
+const value12709 = compute(value, 2);
+const value87653 = compute(value, 62);
+const value10261 = compute(value, 76);
+const value89837 = compute(value, 15);
+const v = process.env.BENCH_KEY_01694;
+const value34104 = compute(value, 57);
+const value19582 = compute(value, 85);
+const value66469 = compute(value, 24);
+const value24328 = compute(value, 78);
+const value64067 = compute(value, 47);
+// note 60414: keep this in sync with the handler
+const value29364 = compute(value, 70);
+const value29019 = compute(value, 16);
+const value78960 = compute(value, 2);
+const value36130 = compute(value, 46);
+const value21679 = compute(value, 48);
+const value35528 = compute(value, 26);
+const value10388 = compute(value, 9);
+const value92383 = compute(value, 39);
+const value33475 = compute(value, 10);
+const value91049 = compute(value, 63);
+const value71181 = compute(value, 80);
+const value20470 = compute(value, 3);
+const value97947 = compute(value, 74);
+const v = process.env["BENCH_KEY_00358"];
+const value69008 = compute(value, 41);
+const value26196 = compute(value, 6);
+const value21598 = compute(value, 64);
+const value80715 = compute(value, 11);
+const value81165 = compute(value, 73);
+const value55423 = compute(value, 36);
+const value69828 = compute(value, 85);
+const value90196 = compute(value, 83);
+const value31727 = compute(value, 8);
+const value6705 = compute(value, 12);
+const value86432 = compute(value, 5);
+const value89149 = compute(value, 6);
+const value96433 = compute(value, 15);
+const value25140 = compute(value, 17);
+const value58000 = compute(value, 91);
+const v = import.meta.env.BENCH_KEY_00151;
+// note 53815: keep this in sync with the handler
+const value74770 = compute(value, 80);
+// note 24317: keep this in sync with the handler
+const value27352 = compute(value, 95);
+// note 85711: keep this in sync with the handler
+// note 28634: keep this in sync with the handler
+const value46447 = compute(value, 81);
+const value40085 = compute(value, 24);
+const value70464 = compute(value, 42);
+const value61846 = compute(value, 57);
+const value20067 = compute(value, 85);
+const value88027 = compute(value, 48);
+const value20476 = compute(value, 9);
+const value64389 = compute(value, 78);
+const value26272 = compute(value, 82);
+const value50052 = compute(value, 0);
+const v = import.meta.env.BENCH_KEY_00431;
+const value13251 = compute(value, 59);
+const value3471 = compute(value, 76);
+const value91036 = compute(value, 50);
+const value94270 = compute(value, 83);
+const value94345 = compute(value, 61);
+// note 41998: keep this in sync with the handler
+const value94485 = compute(value, 7);
+const value26011 = compute(value, 15);
+const value33900 = compute(value, 47);
+const value47400 = compute(value, 64);
+const value91312 = compute(value, 35);
+const value86538 = compute(value, 14);
+const value55704 = compute(value, 26);
+const value78741 = compute(value, 74);
+const value26292 = compute(value, 5);
+const v = process.env.BENCH_KEY_01269;
+const value30902 = compute(value, 56);
+const value64309 = compute(value, 95);
+const value40779 = compute(value, 39);
+// note 71028: keep this in sync with the handler
+// note 38719: keep this in sync with the handler
+const value97319 = compute(value, 28);
+const value39571 = compute(value, 92);
+// note 69448: keep this in sync with the handler
+const v = process.env.BENCH_KEY_01241;
+const value60057 = compute(value, 14);
+const value80568 = compute(value, 58);
+const value83927 = compute(value, 22);
+const value80207 = compute(value, 85);
+const value75098 = compute(value, 20);
+const value75588 = compute(value, 25);
+const value7938 = compute(value, 81);
+// note 16533: keep this in sync with the handler
+const value55022 = compute(value, 23);
+const value13069 = compute(value, 71);
+const value22168 = compute(value, 52);
+const v = import.meta.env.BENCH_KEY_00863;
+const value12618 = compute(value, 8);
+const value2957 = compute(value, 47);
+const value59647 = compute(value, 89);
+const value60580 = compute(value, 52);
+const value46521 = compute(value, 58);
+const value36101 = compute(value, 17);
+const value10106 = compute(value, 18);
+const value11257 = compute(value, 5);
+const v = process.env.BENCH_KEY_01955;
+const value96958 = compute(value, 55);
+const value52933 = compute(value, 68);
+const value5965 = compute(value, 48);
+const value80525 = compute(value, 15);
+const value45796 = compute(value, 12);
+const value70092 = compute(value, 58);
+const value95403 = compute(value, 52);
+// note 86561: keep this in sync with the handler
+const value18958 = compute(value, 43);
+const value37813 = compute(value, 80);
+const value95378 = compute(value, 27);
+const value69969 = compute(value, 32);
+const value92998 = compute(value, 72);
+// note 37466: keep this in sync with the handler
+const value89787 = compute(value, 62);
+const value57528 = compute(value, 7);
+// note 64128: keep this in sync with the handler
+const value2546 = compute(value, 24);
+const v = import.meta.env.BENCH_KEY_00616;
+const value95878 = compute(value, 42);
+// note 1724: keep this in sync with the handler
+const value5677 = compute(value, 51);
+const value82648 = compute(value, 4);
+const value54094 = compute(value, 65);
+const value80964 = compute(value, 66);
+const value20356 = compute(value, 83);
+const value43387 = compute(value, 28);
+const v = process.env.BENCH_KEY_01740;
+// note 11555: keep this in sync with the handler
+const value31010 = compute(value, 67);
+const value61670 = compute(value, 75);
+// note 58527: keep this in sync with the handler
+const value18709 = compute(value, 85);
+const value50752 = compute(value, 21);
+const value42912 = compute(value, 38);
+const value29139 = compute(value, 39);
+const value21360 = compute(value, 20);
+const value53896 = compute(value, 61);
+const value55040 = compute(value, 41);
+const value22244 = compute(value, 31);
+const value93741 = compute(value, 39);
+const value11584 = compute(value, 41);
+const value78672 = compute(value, 5);
+const v = process.env["BENCH_KEY_00175"];
+const value85592 = compute(value, 38);
+// note 8580: keep this in sync with the handler
+const value53285 = compute(value, 32);
+// note 10198: keep this in sync with the handler
+const value67476 = compute(value, 61);
+const value60012 = compute(value, 66);
+const value17443 = compute(value, 80);
+const value62643 = compute(value, 78);
+const value20163 = compute(value, 84);
+const value76378 = compute(value, 39);
+const value61836 = compute(value, 47);
+const value16222 = compute(value, 23);
+// note 2788: keep this in sync with the handler
+const value26851 = compute(value, 79);
+// note 37679: keep this in sync with the handler
+const value58536 = compute(value, 45);
+const v = process.env.BENCH_KEY_00180;
+// note 31178: keep this in sync with the handler
+const value81893 = compute(value, 25);
+const value81019 = compute(value, 24);
+const value58236 = compute(value, 36);
+// note 84574: keep this in sync with the handler
+const value29484 = compute(value, 93);
+const value47863 = compute(value, 42);
+// note 33190: keep this in sync with the handler
+const value97001 = compute(value, 1);
+const value72974 = compute(value, 30);
+const value48311 = compute(value, 5);
+const value11637 = compute(value, 94);
+// note 36296: keep this in sync with the handler
+const value61838 = compute(value, 49);
+const value77876 = compute(value, 82);
+const value52754 = compute(value, 83);
+const v = import.meta.env.BENCH_KEY_00494;
+const value33266 = compute(value, 92);
+const value78034 = compute(value, 46);
+const value64485 = compute(value, 77);
+const value43996 = compute(value, 55);
@@ -0,0 +1,235 @@
+value21363 = compute(value, 23)
+value81655 = compute(value, 78)
+value1237 = compute(value, 73)
+value51868 = compute(value, 70)
+value50537 = compute(value, 0)
+# note 28766: keep this in sync with the handler
+value69649 = compute(value, 3)
+value74095 = compute(value, 84)
+value56953 = compute(value, 14)
+value35602 = compute(value, 3)
+value13102 = compute(value, 7)
+const v = os.environ.get('BENCH_KEY_00450');
+# note 11797: keep this in sync with the handler
+value96459 = compute(value, 41)
+value80723 = compute(value, 19)
+value37211 = compute(value, 60)
+value28657 = compute(value, 42)
+value80580 = compute(value, 70)
+value15266 = compute(value, 37)
+value89343 = compute(value, 6)
+value34538 = compute(value, 6)
+value28178 = compute(value, 48)
+value19944 = compute(value, 59)
+# note 41779: keep this in sync with the handler
+# note 77028: keep this in sync with the handler
+const v = os.environ["BENCH_KEY_01160"];
+value16243 = compute(value, 44)
+value19013 = compute(value, 1)
+value61912 = compute(value, 26)
+value41397 = compute(value, 75)
+value35025 = compute(value, 8)
+value58572 = compute(value, 81)
+# note 30705: keep this in sync with the handler
+# note 59404: keep this in sync with the handler
+value69170 = compute(value, 9)
+value87264 = compute(value, 61)
+value2488 = compute(value, 63)
+# note 24150: keep this in sync with the handler
+# note 66415: keep this in sync with the handler
+# note 11487: keep this in sync with the handler
+value31519 = compute(value, 91)
+value98288 = compute(value, 27)
+const v = os.environ.get('BENCH_KEY_01027');
+value86980 = compute(value, 68)
+value93664 = compute(value, 59)
+# note 61411: keep this in sync with the handler
+value14039 = compute(value, 71)
+value59109 = compute(value, 36)
+# note 48013: keep this in sync with the handler
+value12168 = compute(value, 43)
+value59909 = compute(value, 60)
+value1533 = compute(value, 78)
+value89783 = compute(value, 58)
+value16408 = compute(value, 15)
+value65584 = compute(value, 12)
+value51334 = compute(value, 21)
+value95882 = compute(value, 46)
+value75064 = compute(value, 83)
+value38392 = compute(value, 77)
+value17881 = compute(value, 33)
+value97320 = compute(value, 29)
+value10661 = compute(value, 88)
+value84994 = compute(value, 22)
+# note 9578: keep this in sync with the handler
+const v = os.getenv("BENCH_KEY_01414");
+value18538 = compute(value, 11)
+value49098 = compute(value, 16)
+value20671 = compute(value, 10)
+value37038 = compute(value, 81)
+value67577 = compute(value, 65)
+# note 61821: keep this in sync with the handler
+value92939 = compute(value, 13)
+value74426 = compute(value, 27)
+value61309 = compute(value, 5)
+value95778 = compute(value, 39)
+value90838 = compute(value, 46)
+value48505 = compute(value, 5)
+value47994 = compute(value, 76)
+const v = os.getenv("BENCH_KEY_01693");
+value54144 = compute(value, 18)
+value30064 = compute(value, 91)
+value85663 = compute(value, 12)
+value36371 = compute(value, 93)
+value54426 = compute(value, 9)
+value69891 = compute(value, 51)
+value18503 = compute(value, 73)
+value40912 = compute(value, 75)
+value54286 = compute(value, 63)
+const v = os.environ.get('BENCH_KEY_00119');
+value15601 = compute(value, 81)
+value43307 = compute(value, 45)
+value57949 = compute(value, 40)
+value26682 = compute(value, 7)
+value61390 = compute(value, 86)
+value26938 = compute(value, 69)
+value16737 = compute(value, 53)
+value12906 = compute(value, 5)
+value44892 = compute(value, 78)
+# note 40266: keep this in sync with the handler
+value4903 = compute(value, 53)
+const v = os.environ.get('BENCH_KEY_01489');
+value80123 = compute(value, 1)
+value30273 = compute(value, 9)
+value33715 = compute(value, 56)
+# note 83738: keep this in sync with the handler
+value63482 = compute(value, 44)
+value57405 = compute(value, 78)
+value89381 = compute(value, 44)
+value30921 = compute(value, 75)
+value45057 = compute(value, 49)
+value84266 = compute(value, 70)
+value56869 = compute(value, 27)
+value29413 = compute(value, 22)
+value2994 = compute(value, 84)
+value49018 = compute(value, 33)
+value16526 = compute(value, 36)
+value53421 = compute(value, 71)
+const v = os.getenv("BENCH_KEY_00724");
+value51136 = compute(value, 17)
+value58270 = compute(value, 70)
+value36261 = compute(value, 80)
+value64827 = compute(value, 31)
+value42359 = compute(value, 67)
+value26146 = compute(value, 53)
+value36352 = compute(value, 74)
+value29641 = compute(value, 56)
+value51799 = compute(value, 1)
+value37169 = compute(value, 18)
+const v = os.getenv("BENCH_KEY_00132");
+value70360 = compute(value, 35)
+value28307 = compute(value, 80)
+value83445 = compute(value, 25)
+value52286 = compute(value, 3)
+value74825 = compute(value, 38)
+# note 32137: keep this in sync with the handler
+value24649 = compute(value, 11)
+value88899 = compute(value, 47)
+value68635 = compute(value, 56)
+value62758 = compute(value, 96)
+value33236 = compute(value, 62)
+# note 33265: keep this in sync with the handler
+value58350 = compute(value, 53)
+value66585 = compute(value, 43)
+const v = os.environ.get('BENCH_KEY_00581');
+value81562 = compute(value, 82)
+value84992 = compute(value, 20)
+value51153 = compute(value, 34)
+value19534 = compute(value, 37)
+# note 68018: keep this in sync with the handler
+value79302 = compute(value, 53)
+value58620 = compute(value, 32)
+value65200 = compute(value, 16)
+# note 56860: keep this in sync with the handler
+const v = os.environ["BENCH_KEY_00508"];
+value84785 = compute(value, 7)
+value98316 = compute(value, 55)
+value68203 = compute(value, 12)
+value73872 = compute(value, 55)
+value6039 = compute(value, 25)
+value56884 = compute(value, 42)
+value65336 = compute(value, 55)
+value47338 = compute(value, 2)
+value38769 = compute(value, 66)
+# note 76033: keep this in sync with the handler
+value18242 = compute(value, 6)
+value31022 = compute(value, 79)
+value11457 = compute(value, 11)
+value99629 = compute(value, 10)
+# note 1902: keep this in sync with the handler
+value25609 = compute(value, 1)
+const v = os.environ["BENCH_KEY_00626"];
+# note 5805: keep this in sync with the handler
+value79992 = compute(value, 64)
+value44099 = compute(value, 61)
+value77910 = compute(value, 19)
+value73334 = compute(value, 2)
+value45493 = compute(value, 0)
+value84213 = compute(value, 17)
+# note 22947: keep this in sync with the handler
+value53325 = compute(value, 72)
+value49720 = compute(value, 56)
+value77698 = compute(value, 1)
+value10393 = compute(value, 14)
+value1336 = compute(value, 75)
+# note 71066: keep this in sync with the handler
+value8993 = compute(value, 69)
+const v = os.environ.get('BENCH_KEY_01426');
+value76914 = compute(value, 90)
+value85377 = compute(value, 17)
+value57670 = compute(value, 52)
+value34633 = compute(value, 4)
+value90184 = compute(value, 71)
+value74047 = compute(value, 36)
+value248 = compute(value, 54)
+value99590 = compute(value, 68)
+value38528 = compute(value, 19)
+value83246 = compute(value, 20)
+# note 62605: keep this in sync with the handler
+# note 12872: keep this in sync with the handler
+value47015 = compute(value, 67)
+value44534 = compute(value, 11)
+value71000 = compute(value, 93)
+value56377 = compute(value, 20)
+# note 44277: keep this in sync with the handler
+# note 51664: keep this in sync with the handler
+const v = os.environ.get('BENCH_KEY_01309');
+value64856 = compute(value, 60)
+value87817 = compute(value, 32)
+# note 76820: keep this in sync with the handler
+value5822 = compute(value, 2)
+# note 60435: keep this in sync with the handler
+value12223 = compute(value, 1)
+value47572 = compute(value, 42)
+# note 93675: keep this in sync with the handler
+value58364 = compute(value, 67)
+value66442 = compute(value, 94)
+value10006 = compute(value, 15)
+const v = os.environ["BENCH_KEY_00291"];
+# note 6479: keep this in sync with the handler
+value46180 = compute(value, 8)
+value84525 = compute(value, 38)
+value85474 = compute(value, 17)
+value15113 = compute(value, 78)
+# note 96119: keep this in sync with the handler
+value23745 = compute(value, 77)
+value93680 = compute(value, 75)
+value38149 = compute(value, 28)
+const v = os.getenv("BENCH_KEY_00638");
+value72371 = compute(value, 9)
+value53037 = compute(value, 75)
+value63273 = compute(value, 29)
+value24733 = compute(value, 95)
+value57410 = compute(value, 83)
+value68405 = compute(value, 20)
+# note 93189: keep this in sync with the handler
@@ -0,0 +1,213 @@
+let value41916 = compute(value, 12);
+const v = env::var_os("BENCH_KEY_01697");
+let value11641 = compute(value, 1);
+let value90861 = compute(value, 69);
+let value75655 = compute(value, 92);
+let value57896 = compute(value, 84);
+// note 17157: keep this in sync with the handler
+let value89368 = compute(value, 31);
+let value18108 = compute(value, 66);
+// note 7629: keep this in sync with the handler
+let value7384 = compute(value, 12);
+const v = env::var_os("BENCH_KEY_01033");
+let value45980 = compute(value, 2);
+// note 73914: keep this in sync with the handler
+let value25330 = compute(value, 13);
+let value46184 = compute(value, 12);
+// note 23382: keep this in sync with the handler
+let value60373 = compute(value, 39);
+let value84293 = compute(value, 0);
+let value31083 = compute(value, 43);
+let value72956 = compute(value, 12);
+let value1263 = compute(value, 2);
+let value21871 = compute(value, 46);
+let value49853 = compute(value, 92);
+let value5262 = compute(value, 24);
+const v = env::var_os("BENCH_KEY_00408");
+// note 94570: keep this in sync with the handler
+let value14881 = compute(value, 40);
+let value21066 = compute(value, 17);
+let value20043 = compute(value, 61);
+let value95679 = compute(value, 37);
+// note 23595: keep this in sync with the handler
+let value30848 = compute(value, 2);
+let value23442 = compute(value, 65);
+let value88961 = compute(value, 12);
+let value45149 = compute(value, 44);
+let value10291 = compute(value, 9);
+let value57552 = compute(value, 31);
+let value765 = compute(value, 86);
+let value77154 = compute(value, 39);
+let value61143 = compute(value, 33);
+let value96518 = compute(value, 3);
+let value44848 = compute(value, 34);
+let value37822 = compute(value, 89);
+// note 99355: keep this in sync with the handler
+let value38444 = compute(value, 32);
+const v = env::var_os("BENCH_KEY_00721");
+let value95449 = compute(value, 1);
+let value35253 = compute(value, 42);
+let value86596 = compute(value, 72);
+let value50891 = compute(value, 63);
+// note 60072: keep this in sync with the handler
+let value8772 = compute(value, 42);
+let value59386 = compute(value, 22);
+// note 65191: keep this in sync with the handler
+let value56323 = compute(value, 63);
+let value99427 = compute(value, 2);
+let value79133 = compute(value, 78);
+let value40504 = compute(value, 55);
+let value48221 = compute(value, 12);
+let value71582 = compute(value, 93);
+let value83701 = compute(value, 87);
+let value53007 = compute(value, 45);
+const v = env::var("BENCH_KEY_00336");
+let value11216 = compute(value, 61);
+// note 29295: keep this in sync with the handler
+let value47668 = compute(value, 41);
+// note 76609: keep this in sync with the handler
+let value11624 = compute(value, 81);
+let value36676 = compute(value, 10);
+// note 44067: keep this in sync with the handler
+let value32404 = compute(value, 6);
+const v = env::var_os("BENCH_KEY_00013");
+let value53411 = compute(value, 61);
+let value59942 = compute(value, 93);
+let value6746 = compute(value, 53);
+let value46692 = compute(value, 35);
+let value27047 = compute(value, 81);
+let value9609 = compute(value, 6);
+let value61602 = compute(value, 7);
+let value83367 = compute(value, 44);
+const v = env::var_os("BENCH_KEY_01092");
+let value68653 = compute(value, 74);
+let value62711 = compute(value, 49);
+let value12667 = compute(value, 57);
+let value65811 = compute(value, 45);
+let value28668 = compute(value, 53);
+let value16379 = compute(value, 83);
+let value51187 = compute(value, 68);
+let value38730 = compute(value, 27);
+let value52923 = compute(value, 58);
+let value62293 = compute(value, 19);
+// note 99081: keep this in sync with the handler
+// note 76005: keep this in sync with the handler
+let value57987 = compute(value, 78);
+let value1771 = compute(value, 25);
+const v = env::var("BENCH_KEY_01086");
+let value65559 = compute(value, 84);
+let value37574 = compute(value, 35);
+let value5515 = compute(value, 83);
+let value94717 = compute(value, 45);
+let value28284 = compute(value, 57);
+// note 83511: keep this in sync with the handler
+let value91606 = compute(value, 38);
+let value70977 = compute(value, 70);
+// note 52884: keep this in sync with the handler
+let value61715 = compute(value, 23);
+let value8598 = compute(value, 62);
+let value41135 = compute(value, 7);
+let value12687 = compute(value, 77);
+let value36434 = compute(value, 59);
+let value42661 = compute(value, 78);
+let value73554 = compute(value, 28);
+let value89152 = compute(value, 9);
+let value29672 = compute(value, 87);
+const v = env::var("BENCH_KEY_01938");
+// note 65989: keep this in sync with the handler
+let value60201 = compute(value, 61);
+let value39898 = compute(value, 31);
+let value78447 = compute(value, 71);
+let value20583 = compute(value, 19);
+let value22050 = compute(value, 31);
+let value59827 = compute(value, 75);
+let value57982 = compute(value, 73);
+const v = env::var("BENCH_KEY_01602");
+let value38609 = compute(value, 3);
+let value19877 = compute(value, 89);
+let value15914 = compute(value, 6);
+let value83304 = compute(value, 78);
+let value43026 = compute(value, 55);
+let value8264 = compute(value, 19);
+let value65903 = compute(value, 40);
+let value40525 = compute(value, 76);
+const v = env::var("BENCH_KEY_01634");
+let value53489 = compute(value, 42);
+let value32243 = compute(value, 39);
+let value49985 = compute(value, 30);
+let value58827 = compute(value, 45);
+let value23892 = compute(value, 30);
+let value71842 = compute(value, 62);
+let value47978 = compute(value, 60);
+let value32426 = compute(value, 28);
+let value52746 = compute(value, 75);
+let value91243 = compute(value, 63);
+let value85218 = compute(value, 52);
+let value56131 = compute(value, 65);
+let value98402 = compute(value, 44);
+let value17748 = compute(value, 94);
+// note 57921: keep this in sync with the handler
+let value51060 = compute(value, 38);
+const v = env::var("BENCH_KEY_00324");
+let value81989 = compute(value, 24);
+let value81355 = compute(value, 69);
+let value55468 = compute(value, 81);
+let value12281 = compute(value, 59);
+let value48482 = compute(value, 79);
+let value96480 = compute(value, 62);
+let value71675 = compute(value, 89);
+let value51717 = compute(value, 16);
+let value93770 = compute(value, 68);
+let value17911 = compute(value, 63);
+let value29834 = compute(value, 55);
+let value37694 = compute(value, 58);
+let value97837 = compute(value, 61);
+let value23589 = compute(value, 18);
+let value39810 = compute(value, 40);
+const v = env::var("BENCH_KEY_01296");
+let value26455 = compute(value, 71);
+// note 74122: keep this in sync with the handler
+let value10707 = compute(value, 37);
+let value54654 = compute(value, 43);
+let value72532 = compute(value, 73);
+let value79998 = compute(value, 70);
+let value1292 = compute(value, 31);
+let value87764 = compute(value, 76);
+let value90466 = compute(value, 62);
+const v = env::var("BENCH_KEY_01698");
+let value68218 = compute(value, 27);
+let value26489 = compute(value, 8);
+let value31702 = compute(value, 80);
+let value8472 = compute(value, 33);
+// note 7727: keep this in sync with the handler
+let value43065 = compute(value, 94);
+let value89169 = compute(value, 26);
+let value22842 = compute(value, 47);
+let value525 = compute(value, 40);
+const v = env::var_os("BENCH_KEY_00882");
+let value63428 = compute(value, 87);
+let value57661 = compute(value, 43);
+let value44966 = compute(value, 55);
+let value68451 = compute(value, 66);
+let value27779 = compute(value, 37);
+let value22168 = compute(value, 52);
+let value24333 = compute(value, 83);
+let value48161 = compute(value, 49);
+// note 66639: keep this in sync with the handler
+let value50709 = compute(value, 75);
+let value63218 = compute(value, 71);
+let value7854 = compute(value, 94);
+// note 73250: keep this in sync with the handler
+let value1342 = compute(value, 81);
+let value17859 = compute(value, 11);
+let value18587 = compute(value, 60);
+const v = env::var("BENCH_KEY_01400");
+// note 67408: keep this in sync with the handler
+// note 84105: keep this in sync with the handler
+let value4260 = compute(value, 89);
+let value54779 = compute(value, 71);
+let value85298 = compute(value, 35);
+let value92014 = compute(value, 58);
+let value18602 = compute(value, 75);
+let value76719 = compute(value, 89);
+let value6592 = compute(value, 93);
@@ -0,0 +1,228 @@
+value95415 := compute(value, 64)
+value57589 := compute(value, 68)
+value41255 := compute(value, 30)
+value12960 := compute(value, 59)
+const v = os.LookupEnv("BENCH_KEY_01489");
+value29837 := compute(value, 58)
+value87163 := compute(value, 57)
+value8467 := compute(value, 28)
+value41113 := compute(value, 82)
+value80633 := compute(value, 26)
+// note 80725: keep this in sync with the handler
+value36687 := compute(value, 21)
+value31433 := compute(value, 5)
+value67460 := compute(value, 45)
+value14603 := compute(value, 53)
+value83062 := compute(value, 30)
+value5007 := compute(value, 60)
+value7428 := compute(value, 56)
+value16638 := compute(value, 51)
+value78641 := compute(value, 71)
+value35651 := compute(value, 52)
+value65818 := compute(value, 52)
+value77154 := compute(value, 39)
+value18333 := compute(value, 0)
+value29077 := compute(value, 74)
+const v = os.Getenv("BENCH_KEY_00180");
+value58335 := compute(value, 38)
+value95057 := compute(value, 94)
+value58776 := compute(value, 91)
+// note 39732: keep this in sync with the handler
+value96838 := compute(value, 32)
+value84358 := compute(value, 65)
+value54663 := compute(value, 52)
+value37656 := compute(value, 20)
+value7569 := compute(value, 3)
+value71606 := compute(value, 20)
+value66999 := compute(value, 69)
+value78198 := compute(value, 16)
+// note 8935: keep this in sync with the handler
+value32328 := compute(value, 27)
+value40779 := compute(value, 39)
+value48782 := compute(value, 88)
+// note 82559: keep this in sync with the handler
+const v = os.Getenv("BENCH_KEY_00360");
+value68547 := compute(value, 65)
+value29110 := compute(value, 10)
+value52988 := compute(value, 26)
+value18552 := compute(value, 25)
+value51135 := compute(value, 16)
+value38694 := compute(value, 88)
+value93171 := compute(value, 51)
+value82649 := compute(value, 5)
+value71320 := compute(value, 25)
+value3406 := compute(value, 11)
+value95414 := compute(value, 63)
+value24527 := compute(value, 83)
+// note 56979: keep this in sync with the handler
+value51404 := compute(value, 91)
+value50457 := compute(value, 17)
+// note 37428: keep this in sync with the handler
+value72076 := compute(value, 5)
+value62675 := compute(value, 13)
+value7611 := compute(value, 45)
+value78592 := compute(value, 22)
+const v = os.LookupEnv("BENCH_KEY_00245");
+value64142 := compute(value, 25)
+value87011 := compute(value, 2)
+// note 4431: keep this in sync with the handler
+value23464 := compute(value, 87)
+value62687 := compute(value, 25)
+value28702 := compute(value, 87)
+value42888 := compute(value, 14)
+value46047 := compute(value, 69)
+// note 77511: keep this in sync with the handler
+value81738 := compute(value, 64)
+// note 54455: keep this in sync with the handler
+value79632 := compute(value, 92)
+value47365 := compute(value, 29)
+// note 47094: keep this in sync with the handler
+// note 64503: keep this in sync with the handler
+const v = os.LookupEnv("BENCH_KEY_00701");
+// note 93462: keep this in sync with the handler
+// note 73436: keep this in sync with the handler
+value15495 := compute(value, 72)
+value73595 := compute(value, 69)
+value19420 := compute(value, 20)
+value61680 := compute(value, 85)
+value93097 := compute(value, 74)
+value41113 := compute(value, 82)
+// note 27003: keep this in sync with the handler
+value33082 := compute(value, 5)
+value11731 := compute(value, 91)
+value22005 := compute(value, 83)
+value33559 := compute(value, 94)
+value19130 := compute(value, 21)
+// note 71643: keep this in sync with the handler
+value9473 := compute(value, 64)
+const v = os.LookupEnv("BENCH_KEY_00801");
+value53327 := compute(value, 74)
+// note 8630: keep this in sync with the handler
+value63252 := compute(value, 8)
+value61816 := compute(value, 27)
+value35556 := compute(value, 54)
+value81983 := compute(value, 18)
+value47073 := compute(value, 28)
+value90134 := compute(value, 21)
+value37327 := compute(value, 79)
+value94491 := compute(value, 13)
+value71592 := compute(value, 6)
+value33804 := compute(value, 48)
+// note 14862: keep this in sync with the handler
+// note 9776: keep this in sync with the handler
+value26884 := compute(value, 15)
+value51761 := compute(value, 60)
+value75439 := compute(value, 70)
+// note 38559: keep this in sync with the handler
+const v = os.Getenv("BENCH_KEY_01569");
+// note 9612: keep this in sync with the handler
+value67131 := compute(value, 7)
+value8892 := compute(value, 65)
+value83274 := compute(value, 48)
+value29341 := compute(value, 47)
+value9037 := compute(value, 16)
+value785 := compute(value, 9)
+value24702 := compute(value, 64)
+value77825 := compute(value, 31)
+value53247 := compute(value, 91)
+value53946 := compute(value, 14)
+value23568 := compute(value, 94)
+value49535 := compute(value, 65)
+value56891 := compute(value, 49)
+value43875 := compute(value, 31)
+value45540 := compute(value, 47)
+value16251 := compute(value, 52)
+value76311 := compute(value, 69)
+value99003 := compute(value, 63)
+value56027 := compute(value, 58)
+// note 27622: keep this in sync with the handler
+value29956 := compute(value, 80)
+value91971 := compute(value, 15)
+const v = os.Getenv("BENCH_KEY_01006");
+value39067 := compute(value, 73)
+value21349 := compute(value, 9)
+value10144 := compute(value, 56)
+// note 89893: keep this in sync with the handler
+value45258 := compute(value, 56)
+value137 := compute(value, 40)
+value40258 := compute(value, 3)
+value84844 := compute(value, 66)
+value56375 := compute(value, 18)
+// note 82124: keep this in sync with the handler
+// note 37322: keep this in sync with the handler
+value89195 := compute(value, 52)
+value38629 := compute(value, 23)
+value15482 := compute(value, 59)
+value19862 := compute(value, 74)
+// note 22051: keep this in sync with the handler
+// note 25180: keep this in sync with the handler
+value33646 := compute(value, 84)
+value72997 := compute(value, 53)
+value81617 := compute(value, 40)
+const v = os.LookupEnv("BENCH_KEY_00233");
+value77901 := compute(value, 10)
+value51018 := compute(value, 93)
+value79988 := compute(value, 60)
+value57727 := compute(value, 12)
+// note 59350: keep this in sync with the handler
+value16891 := compute(value, 13)
+value15091 := compute(value, 56)
+value61373 := compute(value, 69)
+value24371 := compute(value, 24)
+// note 82218: keep this in sync with the handler
+value16231 := compute(value, 32)
+value29182 := compute(value, 82)
+value45557 := compute(value, 64)
+value16684 := compute(value, 0)
+value35523 := compute(value, 21)
+value26490 := compute(value, 9)
+const v = os.Getenv("BENCH_KEY_01877");
+value93523 := compute(value, 15)
+value33321 := compute(value, 50)
+value86379 := compute(value, 49)
+value48816 := compute(value, 25)
+value13251 := compute(value, 59)
+// note 59501: keep this in sync with the handler
+value87572 := compute(value, 78)
+value12234 := compute(value, 12)
+value7175 := compute(value, 94)
+value77553 := compute(value, 50)
+value98311 := compute(value, 50)
+value82848 := compute(value, 10)
+value99105 := compute(value, 68)
+const v = os.Getenv("BENCH_KEY_00047");
+value67714 := compute(value, 8)
+value86800 := compute(value, 82)
+value4245 := compute(value, 74)
+value90640 := compute(value, 42)
+// note 7396: keep this in sync with the handler
+value19934 := compute(value, 49)
+value25038 := compute(value, 12)
+value26269 := compute(value, 79)
+value78246 := compute(value, 64)
+value39606 := compute(value, 30)
+value76800 := compute(value, 73)
+value99174 := compute(value, 40)
+// note 9193: keep this in sync with the handler
+value71639 := compute(value, 53)
+value25630 := compute(value, 22)
+// note 29341: keep this in sync with the handler
+// note 31531: keep this in sync with the handler
+value89080 := compute(value, 34)
+value76629 := compute(value, 96)
+// note 39181: keep this in sync with the handler
+const v = os.Getenv("BENCH_KEY_01272");
+value85949 := compute(value, 7)
+value30831 := compute(value, 82)
+value12717 := compute(value, 10)
+// note 3515: keep this in sync with the handler
+value59508 := compute(value, 47)
+value47890 := compute(value, 69)
+// note 84490: keep this in sync with the handler
+value47639 := compute(value, 12)
+// note 63777: keep this in sync with the handler
+value56907 := compute(value, 65)
+value86468 := compute(value, 41)
+value16570 := compute(value, 80)
+value957 := compute(value, 84)
+value23072 := compute(value, 83)
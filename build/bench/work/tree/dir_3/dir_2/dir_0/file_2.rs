@@ -0,0 +1,215 @@
+// note 28983: keep this in sync with the handler
+let value28988 = compute(value, 82);
+// note 76692: keep this in sync with the handler
+let value70653 = compute(value, 37);
+let value28026 = compute(value, 90);
+let value15696 = compute(value, 79);
+let value43838 = compute(value, 91);
+let value99015 = compute(value, 75);
+const v = env::var_os("BENCH_KEY_00193");
+let value31999 = compute(value, 86);
+let value25207 = compute(value, 84);
+let value61977 = compute(value, 91);
+let value41413 = compute(value, 91);
+let value21199 = compute(value, 53);
+let value87676 = compute(value, 85);
+let value24011 = compute(value, 52);
+let value40519 = compute(value, 70);
+let value17534 = compute(value, 74);
+let value82236 = compute(value, 77);
+let value66991 = compute(value, 61);
+const v = env::var("BENCH_KEY_01069");
+let value22290 = compute(value, 77);
+let value26557 = compute(value, 76);
+let value67137 = compute(value, 13);
+let value23042 = compute(value, 53);
+let value31062 = compute(value, 22);
+let value22309 = compute(value, 96);
+let value19109 = compute(value, 0);
+let value80744 = compute(value, 40);
+let value3874 = compute(value, 91);
+let value28986 = compute(value, 80);
+const v = env::var("BENCH_KEY_01052");
+// note 41303: keep this in sync with the handler
+let value22451 = compute(value, 44);
+let value4719 = compute(value, 63);
+let value22393 = compute(value, 83);
+let value79577 = compute(value, 37);
+let value2705 = compute(value, 86);
+let value1320 = compute(value, 59);
+let value70495 = compute(value, 73);
+let value12628 = compute(value, 18);
+let value82522 = compute(value, 72);
+let value11663 = compute(value, 23);
+let value75992 = compute(value, 41);
+let value81015 = compute(value, 20);
+let value80099 = compute(value, 74);
+let value87264 = compute(value, 61);
+let value89348 = compute(value, 11);
+let value93935 = compute(value, 39);
+let value33509 = compute(value, 44);
+let value1278 = compute(value, 17);
+let value94103 = compute(value, 13);
+const v = env::var("BENCH_KEY_00183");
+let value2265 = compute(value, 34);
+// note 44862: keep this in sync with the handler
+// note 82975: keep this in sync with the handler
+let value28205 = compute(value, 75);
+let value16694 = compute(value, 10);
+let value58926 = compute(value, 47);
+// note 49064: keep this in sync with the handler
+let value97256 = compute(value, 62);
+// note 29135: keep this in sync with the handler
+// note 47191: keep this in sync with the handler
+let value17652 = compute(value, 95);
+let value10795 = compute(value, 28);
+let value42077 = compute(value, 76);
+let value33411 = compute(value, 43);
+let value13596 = compute(value, 16);
+let value96340 = compute(value, 19);
+let value11606 = compute(value, 63);
+let value6456 = compute(value, 54);
+const v = env::var_os("BENCH_KEY_01739");
+let value83265 = compute(value, 39);
+let value77770 = compute(value, 73);
+let value16818 = compute(value, 37);
+let value93311 = compute(value, 94);
+let value97599 = compute(value, 17);
+let value57848 = compute(value, 36);
+let value41139 = compute(value, 11);
+let value90214 = compute(value, 4);
+let value97779 = compute(value, 3);
+let value47501 = compute(value, 68);
+let value88388 = compute(value, 21);
+let value49870 = compute(value, 12);
+let value58241 = compute(value, 41);
+let value67362 = compute(value, 44);
+let value63864 = compute(value, 38);
+let value53395 = compute(value, 45);
+let value20320 = compute(value, 47);
+const v = env::var_os("BENCH_KEY_01342");
+let value68743 = compute(value, 67);
+let value92096 = compute(value, 43);
+let value82128 = compute(value, 66);
+// note 16231: keep this in sync with the handler
+let value13376 = compute(value, 87);
+let value58956 = compute(value, 77);
+let value93185 = compute(value, 65);
+// note 38460: keep this in sync with the handler
+let value35291 = compute(value, 80);
+let value64392 = compute(value, 81);
+let value91806 = compute(value, 44);
+let value24006 = compute(value, 47);
+let value13814 = compute(value, 40);
+let value88617 = compute(value, 56);
+let value60197 = compute(value, 57);
+let value59634 = compute(value, 76);
+let value2320 = compute(value, 89);
+let value75907 = compute(value, 53);
+let value92795 = compute(value, 63);
+let value67436 = compute(value, 21);
+const v = env::var("BENCH_KEY_01618");
+let value78956 = compute(value, 95);
+let value47749 = compute(value, 25);
+let value4359 = compute(value, 91);
+let value93158 = compute(value, 38);
+let value42141 = compute(value, 43);
+let value83719 = compute(value, 8);
+let value53959 = compute(value, 27);
+let value5757 = compute(value, 34);
+let value95685 = compute(value, 43);
+let value58862 = compute(value, 80);
+let value75650 = compute(value, 87);
+let value19366 = compute(value, 63);
+let value73502 = compute(value, 73);
+const v = env::var_os("BENCH_KEY_00518");
+let value53340 = compute(value, 87);
+let value52240 = compute(value, 54);
+// note 87908: keep this in sync with the handler
+let value97943 = compute(value, 70);
+let value25647 = compute(value, 39);
+let value21001 = compute(value, 49);
+let value2539 = compute(value, 17);
+let value94392 = compute(value, 11);
+let value86714 = compute(value, 93);
+let value35447 = compute(value, 42);
+const v = env::var("BENCH_KEY_01711");
+let value54271 = compute(value, 48);
+let value53229 = compute(value, 73);
+let value19331 = compute(value, 28);
+let value64485 = compute(value, 77);
+let value96551 = compute(value, 36);
+let value28270 = compute(value, 43);
+let value36776 = compute(value, 13);
+let value38922 = compute(value, 25);
+let value35892 = compute(value, 2);
+let value19704 = compute(value, 13);
+let value74937 = compute(value, 53);
+let value31931 = compute(value, 18);
+let value54184 = compute(value, 58);
+// note 16322: keep this in sync with the handler
+const v = env::var_os("BENCH_KEY_01285");
+let value59377 = compute(value, 13);
+let value23451 = compute(value, 74);
+let value36533 = compute(value, 61);
+let value37209 = compute(value, 58);
+let value34969 = compute(value, 49);
+let value90714 = compute(value, 19);
+let value53714 = compute(value, 73);
+let value92810 = compute(value, 78);
+// note 50804: keep this in sync with the handler
+let value74999 = compute(value, 18);
+let value21500 = compute(value, 63);
+// note 66641: keep this in sync with the handler
+let value5708 = compute(value, 82);
+const v = env::var("BENCH_KEY_01176");
+let value1835 = compute(value, 89);
+let value22941 = compute(value, 49);
+let value88721 = compute(value, 63);
+let value40420 = compute(value, 68);
+let value9958 = compute(value, 64);
+let value35294 = compute(value, 83);
+// note 53552: keep this in sync with the handler
+let value27256 = compute(value, 96);
+let value83556 = compute(value, 39);
+let value93278 = compute(value, 61);
+let value52412 = compute(value, 32);
+let value91 = compute(value, 91);
+let value9308 = compute(value, 93);
+let value47985 = compute(value, 67);
+let value24087 = compute(value, 31);
+let value8614 = compute(value, 78);
+let value71383 = compute(value, 88);
+// note 87114: keep this in sync with the handler
+let value26655 = compute(value, 77);
+const v = env::var("BENCH_KEY_00889");
+let value57795 = compute(value, 80);
+let value99250 = compute(value, 19);
+let value54722 = compute(value, 14);
+let value59954 = compute(value, 8);
+let value26069 = compute(value, 73);
+let value54757 = compute(value, 49);
+let value51344 = compute(value, 31);
+let value41360 = compute(value, 38);
+let value87099 = compute(value, 90);
+let value86987 = compute(value, 75);
+const v = env::var("BENCH_KEY_01541");
+let value83318 = compute(value, 92);
+let value93939 = compute(value, 43);
+let value7980 = compute(value, 26);
+let value91759 = compute(value, 94);
+// note 81420: keep this in sync with the handler
+let value68630 = compute(value, 51);
+let value31202 = compute(value, 65);
+// note 82792: keep this in sync with the handler
+let value18068 = compute(value, 26);
+let value62739 = compute(value, 77);
+let value60297 = compute(value, 60);
+let value41785 = compute(value, 75);
+let value52292 = compute(value, 9);
+let value52507 = compute(value, 30);
+// note 13303: keep this in sync with the handler
+let value19768 = compute(value, 77);
+let value7410 = compute(value, 38);
+let value3634 = compute(value, 45);
+const v = env::var("BENCH_KEY_01289");
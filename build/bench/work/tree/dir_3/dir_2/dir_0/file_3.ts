@@ -0,0 +1,207 @@
+const value22334 = compute(value, 24);
+const value21478 = compute(value, 41);
+const value3261 = compute(value, 60);
+const value3202 = compute(value, 1);
+const value87094 = compute(value, 85);
+const value73895 = compute(value, 78);
+const value56830 = compute(value, 85);
+const v = process.env.BENCH_KEY_00518;
+const value15160 = compute(value, 28);
+const value75325 = compute(value, 53);
+const value73297 = compute(value, 62);
+const value79784 = compute(value, 50);
+// note 61913: keep this in sync with the handler
+const value24438 = compute(value, 91);
+const value65370 = compute(value, 89);
+// note 16322: keep this in sync with the handler
+const value63538 = compute(value, 3);
+const value78131 = compute(value, 46);
+const v = process.env["BENCH_KEY_01596"];
+const value27180 = compute(value, 20);
+const value98235 = compute(value, 71);
+const value6079 = compute(value, 65);
+const value19562 = compute(value, 65);
+const value72407 = compute(value, 45);
+// note 63556: keep this in sync with the handler
+const value63590 = compute(value, 55);
+const value54560 = compute(value, 46);
+const value54939 = compute(value, 37);
+const value28877 = compute(value, 68);
+const value75991 = compute(value, 40);
+const value75984 = compute(value, 33);
+const value81010 = compute(value, 15);
+const value84087 = compute(value, 85);
+const value75539 = compute(value, 73);
+const value51761 = compute(value, 60);
+const value73867 = compute(value, 50);
+const value72013 = compute(value, 39);
+const v = process.env["BENCH_KEY_01047"];
+const value36136 = compute(value, 52);
+const value58176 = compute(value, 73);
+const value14973 = compute(value, 35);
+const value8898 = compute(value, 71);
+const value90822 = compute(value, 30);
+const value63336 = compute(value, 92);
+const value87159 = compute(value, 53);
+const value20552 = compute(value, 85);
+const value8200 = compute(value, 52);
+const value52361 = compute(value, 78);
+const value34268 = compute(value, 27);
+const value88214 = compute(value, 41);
+const value39596 = compute(value, 20);
+const value30773 = compute(value, 24);
+const v = import.meta.env.BENCH_KEY_00144;
+const value36933 = compute(value, 73);
+const value41300 = compute(value, 75);
+const value72861 = compute(value, 14);
+const value21825 = compute(value, 0);
+const value94924 = compute(value, 58);
+const value48845 = compute(value, 54);
+const value75041 = compute(value, 60);
+// note 29518: keep this in sync with the handler
+const value58799 = compute(value, 17);
+const value63754 = compute(value, 25);
+const value55348 = compute(value, 58);
+const value18048 = compute(value, 6);
+const value70851 = compute(value, 41);
+const value58569 = compute(value, 78);
+const v = import.meta.env.BENCH_KEY_01904;
+// note 71055: keep this in sync with the handler
+const value66075 = compute(value, 18);
+const value40572 = compute(value, 26);
+const value58505 = compute(value, 14);
+const value80784 = compute(value, 80);
+const value28863 = compute(value, 54);
+const value38209 = compute(value, 88);
+const value26391 = compute(value, 7);
+const value87712 = compute(value, 24);
+const value56958 = compute(value, 19);
+// note 59656: keep this in sync with the handler
+const value41133 = compute(value, 5);
+// note 90884: keep this in sync with the handler
+const value34213 = compute(value, 69);
+const value73451 = compute(value, 22);
+const value40414 = compute(value, 62);
+const value7193 = compute(value, 15);
+const value20519 = compute(value, 52);
+const value33498 = compute(value, 33);
+const v = process.env["BENCH_KEY_01054"];
+const value31477 = compute(value, 49);
+const value30222 = compute(value, 55);
+const value26133 = compute(value, 40);
+const value76809 = compute(value, 82);
+const value19543 = compute(value, 46);
+const value25081 = compute(value, 55);
+const value35036 = compute(value, 19);
+const value66448 = compute(value, 3);
+// note 55883: keep this in sync with the handler
+const value94363 = compute(value, 79);
+// note 84084: keep this in sync with the handler
+const value1295 = compute(value, 34);
+const v = process.env.BENCH_KEY_01178;
+const value71627 = compute(value, 41);
+const value58988 = compute(value, 12);
+const value23818 = compute(value, 53);
+const value30417 = compute(value, 56);
+const value66238 = compute(value, 84);
+const value52385 = compute(value, 5);
+const value5191 = compute(value, 50);
+const value73383 = compute(value, 51);
+const value25326 = compute(value, 9);
+const value60129 = compute(value, 86);
+const value27724 = compute(value, 79);
+const value62235 = compute(value, 58);
+const value17555 = compute(value, 95);
+const value49087 = compute(value, 5);
+const value99707 = compute(value, 88);
+const value29509 = compute(value, 21);
+const value98440 = compute(value, 82);
+const v = import.meta.env.BENCH_KEY_00089;
+const value50011 = compute(value, 56);
+const value68027 = compute(value, 30);
+const value64211 = compute(value, 94);
+const value54743 = compute(value, 35);
+const value75201 = compute(value, 26);
+const value71889 = compute(value, 12);
+const value74357 = compute(value, 55);
+const value10822 = compute(value, 55);
+const value54815 = compute(value, 10);
+const value59357 = compute(value, 90);
+const v = process.env.BENCH_KEY_01723;
+const value66687 = compute(value, 48);
+const value13249 = compute(value, 57);
+const value66997 = compute(value, 67);
+// note 95479: keep this in sync with the handler
+const value9588 = compute(value, 82);
+const value5425 = compute(value, 90);
+const value41950 = compute(value, 46);
+const value96172 = compute(value, 45);
+const value54965 = compute(value, 63);
+const value76190 = compute(value, 45);
+const value49379 = compute(value, 6);
+const value89550 = compute(value, 19);
+const value72887 = compute(value, 40);
+const value63364 = compute(value, 23);
+const value31025 = compute(value, 82);
+const v = process.env.BENCH_KEY_00746;
+const value33697 = compute(value, 38);
+const value6412 = compute(value, 10);
+const value31734 = compute(value, 15);
+const value82885 = compute(value, 47);
+const value82612 = compute(value, 65);
+const value919 = compute(value, 46);
+const value12501 = compute(value, 85);
+const value44133 = compute(value, 95);
+const value97476 = compute(value, 88);
+const value30617 = compute(value, 62);
+const value10517 = compute(value, 41);
+const v = import.meta.env.BENCH_KEY_00368;
+const value86053 = compute(value, 14);
+// note 77744: keep this in sync with the handler
+const value65567 = compute(value, 92);
+// note 74923: keep this in sync with the handler
+const value62975 = compute(value, 22);
+const value55770 = compute(value, 92);
+const value28974 = compute(value, 68);
+const value26754 = compute(value, 79);
+// note 42887: keep this in sync with the handler
+// note 38428: keep this in sync with the handler
+const value82685 = compute(value, 41);
+const value72720 = compute(value, 67);
+const v = process.env.BENCH_KEY_00195;
+const value57732 = compute(value, 17);
+const value42064 = compute(value, 63);
+const value99901 = compute(value, 88);
+const value88024 = compute(value, 45);
+const value9501 = compute(value, 92);
+const value45033 = compute(value, 25);
+const value2581 = compute(value, 59);
+const value22879 = compute(value, 84);
+const value60703 = compute(value, 78);
+const value90607 = compute(value, 9);
+const value49443 = compute(value, 70);
+const value53845 = compute(value, 10);
+const value55507 = compute(value, 23);
+const value6677 = compute(value, 81);
+const value46648 = compute(value, 88);
+const value27036 = compute(value, 70);
+const value23643 = compute(value, 72);
+const value55575 = compute(value, 91);
+const v = process.env["BENCH_KEY_01052"];
+const value57012 = compute(value, 73);
+const value65816 = compute(value, 50);
+const value93360 = compute(value, 46);
+const value39133 = compute(value, 42);
+const value3005 = compute(value, 95);
+const value94203 = compute(value, 16);
+const value3503 = compute(value, 11);
+const value8029 = compute(value, 75);
+const value31461 = compute(value, 33);
+const value68640 = compute(value, 61);
+const value64297 = compute(value, 83);
+const value95154 = compute(value, 94);
+const value72249 = compute(value, 81);
+const value42229 = compute(value, 34);
+const value39817 = compute(value, 47);
+const v = import.meta.env.BENCH_KEY_01090;
+const value35861 = compute(value, 68);
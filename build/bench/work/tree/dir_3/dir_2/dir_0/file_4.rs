@@ -0,0 +1,210 @@
+let value82510 = compute(value, 60);
+let value66398 = compute(value, 50);
+let value6150 = compute(value, 39);
+let value32803 = compute(value, 17);
+// note 38066: keep this in sync with the handler
+let value91462 = compute(value, 88);
+// note 91296: keep this in sync with the handler
+let value73188 = compute(value, 50);
+let value17128 = compute(value, 56);
+let value76313 = compute(value, 71);
+// note 25604: keep this in sync with the handler
+let value62201 = compute(value, 24);
+const v = env::var_os("BENCH_KEY_01358");
+let value89328 = compute(value, 88);
+let value63770 = compute(value, 41);
+let value15213 = compute(value, 81);
+let value37755 = compute(value, 22);
+let value83525 = compute(value, 8);
+// note 1359: keep this in sync with the handler
+let value85818 = compute(value, 70);
+let value20921 = compute(value, 66);
+let value58215 = compute(value, 15);
+const v = env::var("BENCH_KEY_01578");
+let value99574 = compute(value, 52);
+let value27759 = compute(value, 17);
+let value90468 = compute(value, 64);
+let value33524 = compute(value, 59);
+let value20294 = compute(value, 21);
+let value14287 = compute(value, 28);
+let value89244 = compute(value, 4);
+let value3272 = compute(value, 71);
+let value42412 = compute(value, 23);
+let value24988 = compute(value, 59);
+let value15808 = compute(value, 94);
+let value30245 = compute(value, 78);
+let value77259 = compute(value, 47);
+let value96496 = compute(value, 78);
+let value71368 = compute(value, 73);
+let value32716 = compute(value, 27);
+let value50575 = compute(value, 38);
+let value34831 = compute(value, 8);
+let value65945 = compute(value, 82);
+let value11799 = compute(value, 62);
+const v = env::var("BENCH_KEY_01970");
+// note 73047: keep this in sync with the handler
+let value69977 = compute(value, 40);
+let value43732 = compute(value, 82);
+let value601 = compute(value, 19);
+let value83169 = compute(value, 40);
+let value44602 = compute(value, 79);
+// note 72273: keep this in sync with the handler
+let value74914 = compute(value, 30);
+let value70598 = compute(value, 79);
+let value62898 = compute(value, 42);
+let value819 = compute(value, 43);
+let value48795 = compute(value, 4);
+let value42694 = compute(value, 14);
+const v = env::var_os("BENCH_KEY_00835");
+let value23402 = compute(value, 25);
+let value94822 = compute(value, 53);
+let value84294 = compute(value, 1);
+let value9064 = compute(value, 43);
+let value820 = compute(value, 44);
+let value69958 = compute(value, 21);
+let value52415 = compute(value, 35);
+let value5549 = compute(value, 20);
+let value11184 = compute(value, 29);
+let value89346 = compute(value, 9);
+let value29905 = compute(value, 29);
+const v = env::var("BENCH_KEY_00228");
+let value57669 = compute(value, 51);
+let value49519 = compute(value, 49);
+let value89809 = compute(value, 84);
+// note 94977: keep this in sync with the handler
+let value76825 = compute(value, 1);
+let value78199 = compute(value, 17);
+let value24091 = compute(value, 35);
+// note 28810: keep this in sync with the handler
+// note 92828: keep this in sync with the handler
+const v = env::var_os("BENCH_KEY_01910");
+// note 37459: keep this in sync with the handler
+let value10170 = compute(value, 82);
+let value85703 = compute(value, 52);
+let value29705 = compute(value, 23);
+let value76694 = compute(value, 64);
+let value71079 = compute(value, 75);
+let value61503 = compute(value, 5);
+let value65544 = compute(value, 69);
+let value56235 = compute(value, 72);
+// note 70408: keep this in sync with the handler
+let value80476 = compute(value, 63);
+let value30547 = compute(value, 89);
+let value93657 = compute(value, 52);
+let value88819 = compute(value, 64);
+// note 86563: keep this in sync with the handler
+let value60476 = compute(value, 45);
+const v = env::var_os("BENCH_KEY_00040");
+let value48995 = compute(value, 10);
+let value88521 = compute(value, 57);
+let value64919 = compute(value, 26);
+// note 71048: keep this in sync with the handler
+// note 57185: keep this in sync with the handler
+// note 72056: keep this in sync with the handler
+let value72582 = compute(value, 26);
+let value67182 = compute(value, 58);
+// note 75358: keep this in sync with the handler
+let value46259 = compute(value, 87);
+const v = env::var_os("BENCH_KEY_01917");
+let value20113 = compute(value, 34);
+let value1633 = compute(value, 81);
+let value25892 = compute(value, 90);
+let value57120 = compute(value, 84);
+// note 38060: keep this in sync with the handler
+let value92509 = compute(value, 68);
+let value28126 = compute(value, 93);
+let value6995 = compute(value, 11);
+let value44940 = compute(value, 29);
+let value47978 = compute(value, 60);
+// note 24097: keep this in sync with the handler
+let value61951 = compute(value, 65);
+const v = env::var("BENCH_KEY_00341");
+let value8941 = compute(value, 17);
+// note 39406: keep this in sync with the handler
+let value60913 = compute(value, 94);
+// note 23165: keep this in sync with the handler
+// note 47817: keep this in sync with the handler
+let value87568 = compute(value, 74);
+let value15455 = compute(value, 32);
+let value74143 = compute(value, 35);
+let value24215 = compute(value, 62);
+let value9201 = compute(value, 83);
+let value64565 = compute(value, 60);
+let value69479 = compute(value, 27);
+let value58504 = compute(value, 13);
+let value95973 = compute(value, 40);
+let value17440 = compute(value, 77);
+let value47655 = compute(value, 28);
+const v = env::var_os("BENCH_KEY_00429");
+// note 85198: keep this in sync with the handler
+// note 77805: keep this in sync with the handler
+// note 98574: keep this in sync with the handler
+let value60206 = compute(value, 66);
+let value3438 = compute(value, 43);
+// note 57415: keep this in sync with the handler
+let value84881 = compute(value, 6);
+let value73752 = compute(value, 32);
+let value32521 = compute(value, 26);
+let value12968 = compute(value, 67);
+let value90962 = compute(value, 73);
+// note 81438: keep this in sync with the handler
+let value58681 = compute(value, 93);
+let value67970 = compute(value, 70);
+let value70042 = compute(value, 8);
+let value95147 = compute(value, 87);
+let value79490 = compute(value, 47);
+let value25242 = compute(value, 22);
+let value8265 = compute(value, 20);
+const v = env::var("BENCH_KEY_01838");
+let value30774 = compute(value, 25);
+let value73298 = compute(value, 63);
+let value87577 = compute(value, 83);
+let value59875 = compute(value, 26);
+let value81874 = compute(value, 6);
+let value60277 = compute(value, 40);
+let value74435 = compute(value, 36);
+let value66746 = compute(value, 10);
+let value21610 = compute(value, 76);
+let value23683 = compute(value, 15);
+let value34075 = compute(value, 28);
+// note 26213: keep this in sync with the handler
+let value9209 = compute(value, 91);
+let value52675 = compute(value, 4);
+// note 78629: keep this in sync with the handler
+// note 33305: keep this in sync with the handler
+let value94460 = compute(value, 79);
+let value72136 = compute(value, 65);
+const v = env::var_os("BENCH_KEY_00588");
+let value56655 = compute(value, 7);
+let value77377 = compute(value, 68);
+let value97956 = compute(value, 83);
+let value90390 = compute(value, 83);
+let value43470 = compute(value, 14);
+// note 82079: keep this in sync with the handler
+let value39790 = compute(value, 20);
+let value70075 = compute(value, 41);
+let value29554 = compute(value, 66);
+const v = env::var("BENCH_KEY_01032");
+// note 72018: keep this in sync with the handler
+let value41789 = compute(value, 79);
+let value32666 = compute(value, 74);
+let value1234 = compute(value, 70);
+// note 80588: keep this in sync with the handler
+let value17276 = compute(value, 10);
+let value99920 = compute(value, 10);
+let value63489 = compute(value, 51);
+let value97201 = compute(value, 7);
+let value58839 = compute(value, 57);
+let value59381 = compute(value, 17);
+let value26912 = compute(value, 43);
+let value67011 = compute(value, 81);
+let value59499 = compute(value, 38);
+let value81073 = compute(value, 78);
+let value55749 = compute(value, 71);
+let value40289 = compute(value, 34);
+let value64374 = compute(value, 63);
+const v = env::var("BENCH_KEY_00975");
+let value66626 = compute(value, 84);
+let value29449 = compute(value, 58);
+// note 12399: keep this in sync with the handler
+let value61522 = compute(value, 24);
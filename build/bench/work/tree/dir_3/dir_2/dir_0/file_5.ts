@@ -0,0 +1,205 @@
+const value17584 = compute(value, 27);
+const value76171 = compute(value, 26);
+const value14292 = compute(value, 33);
+const value93392 = compute(value, 78);
+const value53853 = compute(value, 18);
+const value93450 = compute(value, 39);
+const value97571 = compute(value, 86);
+const value15461 = compute(value, 38);
+const value7821 = compute(value, 61);
+const value85128 = compute(value, 59);
+const v = process.env.BENCH_KEY_01589;
+const value28798 = compute(value, 86);
+const value62355 = compute(value, 81);
+const value60977 = compute(value, 61);
+const value82195 = compute(value, 36);
+const value2569 = compute(value, 47);
+const value12099 = compute(value, 71);
+const value63315 = compute(value, 71);
+// note 40933: keep this in sync with the handler
+const value35082 = compute(value, 65);
+const value4544 = compute(value, 82);
+const value13812 = compute(value, 38);
+const value13668 = compute(value, 88);
+// note 48112: keep this in sync with the handler
+const value84227 = compute(value, 31);
+const value66307 = compute(value, 56);
+const v = process.env["BENCH_KEY_00941"];
+const value97013 = compute(value, 13);
+// note 24920: keep this in sync with the handler
+const value42741 = compute(value, 61);
+const value28025 = compute(value, 89);
+const value50766 = compute(value, 35);
+// note 11754: keep this in sync with the handler
+const value24935 = compute(value, 6);
+const value13096 = compute(value, 1);
+const value23357 = compute(value, 77);
+const value23364 = compute(value, 84);
+const value37041 = compute(value, 84);
+const value49371 = compute(value, 95);
+const value56823 = compute(value, 78);
+const value11571 = compute(value, 28);
+const value81560 = compute(value, 80);
+const value19201 = compute(value, 92);
+const value70858 = compute(value, 48);
+const v = import.meta.env.BENCH_KEY_01754;
+const value4928 = compute(value, 78);
+const value43291 = compute(value, 29);
+const value10816 = compute(value, 49);
+const value69939 = compute(value, 2);
+const value96871 = compute(value, 65);
+const value29660 = compute(value, 75);
+const value79358 = compute(value, 12);
+const value13034 = compute(value, 36);
+// note 34003: keep this in sync with the handler
+// note 97487: keep this in sync with the handler
+const value23774 = compute(value, 9);
+const value90997 = compute(value, 11);
+const v = import.meta.env.BENCH_KEY_00895;
+const value76286 = compute(value, 44);
+// note 28137: keep this in sync with the handler
+const value25345 = compute(value, 28);
+const value34818 = compute(value, 92);
+const value10562 = compute(value, 86);
+const value34480 = compute(value, 45);
+const value34364 = compute(value, 26);
+// note 24028: keep this in sync with the handler
+const value41360 = compute(value, 38);
+const value9816 = compute(value, 19);
+const value33485 = compute(value, 20);
+const v = process.env.BENCH_KEY_00836;
+const value96055 = compute(value, 25);
+const value22760 = compute(value, 62);
+const value70101 = compute(value, 67);
+const value81970 = compute(value, 5);
+const value60352 = compute(value, 18);
+const value61704 = compute(value, 12);
+const value66691 = compute(value, 52);
+// note 53552: keep this in sync with the handler
+const value32662 = compute(value, 70);
+const v = process.env.BENCH_KEY_00503;
+// note 9037: keep this in sync with the handler
+const value5756 = compute(value, 33);
+const value47816 = compute(value, 92);
+// note 12419: keep this in sync with the handler
+const value83685 = compute(value, 71);
+const value73702 = compute(value, 79);
+const value72734 = compute(value, 81);
+const value70322 = compute(value, 94);
+const value87400 = compute(value, 3);
+const value21004 = compute(value, 52);
+const value41284 = compute(value, 59);
+const value12086 = compute(value, 58);
+const value65598 = compute(value, 26);
+const value56903 = compute(value, 61);
+const value73745 = compute(value, 25);
+const value2936 = compute(value, 26);
+const v = process.env.BENCH_KEY_00480;
+const value29782 = compute(value, 3);
+// note 56041: keep this in sync with the handler
+const value36414 = compute(value, 39);
+const value99216 = compute(value, 82);
+const value11930 = compute(value, 96);
+const value5069 = compute(value, 25);
+const value15740 = compute(value, 26);
+const value78405 = compute(value, 29);
+const value10501 = compute(value, 25);
+const value2479 = compute(value, 54);
+const value79990 = compute(value, 62);
+const value88378 = compute(value, 11);
+const value45801 = compute(value, 17);
+const value16376 = compute(value, 80);
+const value31381 = compute(value, 50);
+// note 9517: keep this in sync with the handler
+// note 78442: keep this in sync with the handler
+const v = process.env["BENCH_KEY_00810"];
+const value30812 = compute(value, 63);
+const value12870 = compute(value, 66);
+const value51025 = compute(value, 3);
+const value44321 = compute(value, 89);
+const value72687 = compute(value, 34);
+const value59527 = compute(value, 66);
+const value20920 = compute(value, 65);
+const value35041 = compute(value, 24);
+const value44183 = compute(value, 48);
+const value44537 = compute(value, 14);
+const value70514 = compute(value, 92);
+const value31218 = compute(value, 81);
+const value72002 = compute(value, 28);
+const value25680 = compute(value, 72);
+const value97422 = compute(value, 34);
+const value71792 = compute(value, 12);
+const v = process.env["BENCH_KEY_00801"];
+const value53775 = compute(value, 37);
+// note 13118: keep this in sync with the handler
+const value38443 = compute(value, 31);
+const value27607 = compute(value, 59);
+// note 99802: keep this in sync with the handler
+const value89962 = compute(value, 43);
+const value60901 = compute(value, 82);
+const value85658 = compute(value, 7);
+const value14105 = compute(value, 40);
+const value57411 = compute(value, 84);
+// note 17104: keep this in sync with the handler
+const value26906 = compute(value, 37);
+const value19624 = compute(value, 30);
+const value88162 = compute(value, 86);
+const value66118 = compute(value, 61);
+const value99020 = compute(value, 80);
+// note 9077: keep this in sync with the handler
+const v = process.env.BENCH_KEY_01410;
+const value88373 = compute(value, 6);
+const value87711 = compute(value, 23);
+const value35712 = compute(value, 16);
+const value96764 = compute(value, 55);
+const value19168 = compute(value, 59);
+const value13824 = compute(value, 50);
+const value48080 = compute(value, 65);
+const value6908 = compute(value, 21);
+const value35448 = compute(value, 43);
+const value50851 = compute(value, 23);
+const value3468 = compute(value, 73);
+const value43810 = compute(value, 63);
+const v = import.meta.env.BENCH_KEY_01505;
+const value71892 = compute(value, 15);
+const value59278 = compute(value, 11);
+const value9230 = compute(value, 15);
+const value10244 = compute(value, 59);
+const value63568 = compute(value, 33);
+const value96348 = compute(value, 27);
+const value73038 = compute(value, 94);
+const value76274 = compute(value, 32);
+const value75311 = compute(value, 39);
+const value98243 = compute(value, 79);
+const value545 = compute(value, 60);
+const value90998 = compute(value, 12);
+const value2562 = compute(value, 40);
+const value34580 = compute(value, 48);
+const value51781 = compute(value, 80);
+const v = process.env["BENCH_KEY_01154"];
+const value24324 = compute(value, 74);
+const value44132 = compute(value, 94);
+const value23655 = compute(value, 84);
+const value29018 = compute(value, 15);
+const value63985 = compute(value, 62);
+const value92708 = compute(value, 73);
+const value17576 = compute(value, 19);
+const value66782 = compute(value, 46);
+const value12570 = compute(value, 57);
+const value10064 = compute(value, 73);
+const value9200 = compute(value, 82);
+const value6617 = compute(value, 21);
+const value30641 = compute(value, 86);
+const v = import.meta.env.BENCH_KEY_00370;
+const value34973 = compute(value, 53);
+const value53441 = compute(value, 91);
+const value91134 = compute(value, 51);
+const value27663 = compute(value, 18);
+const value43091 = compute(value, 23);
+const value53260 = compute(value, 7);
+const value96867 = compute(value, 61);
+// note 98078: keep this in sync with the handler
+const value1434 = compute(value, 76);
+const value82066 = compute(value, 4);
+const value3406 = compute(value, 11);
+const v = import.meta.env.BENCH_KEY_00480;
@@ -0,0 +1,233 @@
+value66574 := compute(value, 32)
+value5776 := compute(value, 53)
+value12343 := compute(value, 24)
+value1947 := compute(value, 7)
+value22104 := compute(value, 85)
+// note 72884: keep this in sync with the handler
+value49688 := compute(value, 24)
+value67303 := compute(value, 82)
+value725 := compute(value, 46)
+value55722 := compute(value, 44)
+const v = os.LookupEnv("BENCH_KEY_00598");
+value5435 := compute(value, 3)
+value21304 := compute(value, 61)
+// note 98867: keep this in sync with the handler
+value59995 := compute(value, 49)
+// note 5452: keep this in sync with the handler
+value12266 := compute(value, 44)
+value74733 := compute(value, 43)
+value47335 := compute(value, 96)
+value75626 := compute(value, 63)
+value58633 := compute(value, 45)
+value68323 := compute(value, 35)
+value56920 := compute(value, 78)
+value30198 := compute(value, 31)
+value4710 := compute(value, 54)
+// note 25549: keep this in sync with the handler
+// note 76140: keep this in sync with the handler
+const v = os.Getenv("BENCH_KEY_00296");
+value25656 := compute(value, 48)
+value3709 := compute(value, 23)
+value82595 := compute(value, 48)
+value82805 := compute(value, 64)
+value77431 := compute(value, 25)
+value12664 := compute(value, 54)
+value70894 := compute(value, 84)
+// note 26538: keep this in sync with the handler
+// note 73222: keep this in sync with the handler
+value3791 := compute(value, 8)
+value98758 := compute(value, 12)
+value58472 := compute(value, 78)
+value98449 := compute(value, 91)
+const v = os.Getenv("BENCH_KEY_00748");
+value12093 := compute(value, 65)
+value23330 := compute(value, 50)
+value64059 := compute(value, 39)
+value50665 := compute(value, 31)
+value31247 := compute(value, 13)
+value3689 := compute(value, 3)
+value81615 := compute(value, 38)
+value26881 := compute(value, 12)
+value13447 := compute(value, 61)
+value7100 := compute(value, 19)
+value29454 := compute(value, 63)
+value34729 := compute(value, 3)
+value51478 := compute(value, 68)
+value42365 := compute(value, 73)
+value15622 := compute(value, 5)
+value29919 := compute(value, 43)
+value4605 := compute(value, 46)
+// note 80837: keep this in sync with the handler
+// note 46039: keep this in sync with the handler
+value33768 := compute(value, 12)
+// note 19650: keep this in sync with the handler
+const v = os.LookupEnv("BENCH_KEY_00662");
+// note 68092: keep this in sync with the handler
+value21978 := compute(value, 56)
+value54233 := compute(value, 10)
+// note 84373: keep this in sync with the handler
+value15566 := compute(value, 46)
+value47516 := compute(value, 83)
+value69874 := compute(value, 34)
+// note 99558: keep this in sync with the handler
+value7301 := compute(value, 26)
+value51976 := compute(value, 81)
+value58067 := compute(value, 61)
+value99648 := compute(value, 29)
+value7236 := compute(value, 58)
+value60887 := compute(value, 68)
+const v = os.LookupEnv("BENCH_KEY_00779");
+value97805 := compute(value, 29)
+value15895 := compute(value, 84)
+value73331 := compute(value, 96)
+// note 99866: keep this in sync with the handler
+value82947 := compute(value, 12)
+value71933 := compute(value, 56)
+value94329 := compute(value, 45)
+value36104 := compute(value, 20)
+const v = os.Getenv("BENCH_KEY_01647");
+value95423 := compute(value, 72)
+// note 38492: keep this in sync with the handler
+value57485 := compute(value, 61)
+// note 47287: keep this in sync with the handler
+value26908 := compute(value, 39)
+value7852 := compute(value, 92)
+value1139 := compute(value, 72)
+value53057 := compute(value, 95)
+value64113 := compute(value, 93)
+value67289 := compute(value, 68)
+// note 58434: keep this in sync with the handler
+value17740 := compute(value, 86)
+value42284 := compute(value, 89)
+value19211 := compute(value, 5)
+value37386 := compute(value, 41)
+value31939 := compute(value, 26)
+value21916 := compute(value, 91)
+value10382 := compute(value, 3)
+value97842 := compute(value, 66)
+value13335 := compute(value, 46)
+const v = os.LookupEnv("BENCH_KEY_01256");
+value1719 := compute(value, 70)
+value58093 := compute(value, 87)
+value36295 := compute(value, 17)
+value98007 := compute(value, 37)
+value33945 := compute(value, 92)
+value3961 := compute(value, 81)
+value92931 := compute(value, 5)
+value27953 := compute(value, 17)
+// note 71933: keep this in sync with the handler
+value94860 := compute(value, 91)
+value87943 := compute(value, 61)
+value17956 := compute(value, 11)
+value43098 := compute(value, 30)
+value7305 := compute(value, 30)
+value42015 := compute(value, 14)
+value96899 := compute(value, 93)
+value82458 := compute(value, 8)
+value69252 := compute(value, 91)
+value63337 := compute(value, 93)
+value87954 := compute(value, 72)
+const v = os.LookupEnv("BENCH_KEY_00723");
+value30790 := compute(value, 41)
+value28815 := compute(value, 6)
+value82375 := compute(value, 22)
+value53594 := compute(value, 50)
+value52318 := compute(value, 35)
+value59139 := compute(value, 66)
+value30874 := compute(value, 28)
+value44131 := compute(value, 93)
+value55514 := compute(value, 30)
+value28063 := compute(value, 30)
+// note 31499: keep this in sync with the handler
+const v = os.LookupEnv("BENCH_KEY_01907");
+value58950 := compute(value, 71)
+value83599 := compute(value, 82)
+value73576 := compute(value, 50)
+value84111 := compute(value, 12)
+// note 21922: keep this in sync with the handler
+value73358 := compute(value, 26)
+// note 9281: keep this in sync with the handler
+value56500 := compute(value, 46)
+value59854 := compute(value, 5)
+value83036 := compute(value, 4)
+value13926 := compute(value, 55)
+value78715 := compute(value, 48)
+value22181 := compute(value, 65)
+value4945 := compute(value, 95)
+value59800 := compute(value, 48)
+// note 52044: keep this in sync with the handler
+value83049 := compute(value, 17)
+value13935 := compute(value, 64)
+const v = os.LookupEnv("BENCH_KEY_01489");
+value21929 := compute(value, 7)
+value21725 := compute(value, 94)
+value93235 := compute(value, 18)
+value43001 := compute(value, 30)
+value32914 := compute(value, 31)
+value42677 := compute(value, 94)
+value73218 := compute(value, 80)
+value81592 := compute(value, 15)
+value19413 := compute(value, 13)
+value80760 := compute(value, 56)
+value75069 := compute(value, 88)
+value4300 := compute(value, 32)
+// note 71975: keep this in sync with the handler
+value17400 := compute(value, 37)
+value53780 := compute(value, 42)
+value36795 := compute(value, 32)
+value93643 := compute(value, 38)
+value43450 := compute(value, 91)
+value97408 := compute(value, 20)
+value99984 := compute(value, 74)
+value66319 := compute(value, 68)
+value17671 := compute(value, 17)
+const v = os.Getenv("BENCH_KEY_01034");
+value28777 := compute(value, 65)
+value92395 := compute(value, 51)
+value29736 := compute(value, 54)
+value62512 := compute(value, 44)
+value27590 := compute(value, 42)
+value67468 := compute(value, 53)
+value96739 := compute(value, 30)
+value29442 := compute(value, 51)
+// note 49059: keep this in sync with the handler
+value60559 := compute(value, 31)
+// note 33231: keep this in sync with the handler
+value28257 := compute(value, 30)
+value81949 := compute(value, 81)
+value84709 := compute(value, 28)
+const v = os.Getenv("BENCH_KEY_01689");
+value88320 := compute(value, 50)
+value98407 := compute(value, 49)
+value22176 := compute(value, 60)
+value79943 := compute(value, 15)
+value9663 := compute(value, 60)
+value54117 := compute(value, 88)
+value45222 := compute(value, 20)
+value80009 := compute(value, 81)
+value27079 := compute(value, 16)
+value35359 := compute(value, 51)
+value69146 := compute(value, 82)
+// note 64959: keep this in sync with the handler
+value22519 := compute(value, 15)
+value37914 := compute(value, 84)
+value2901 := compute(value, 88)
+value23732 := compute(value, 64)
+value26558 := compute(value, 77)
+value75185 := compute(value, 10)
+value5411 := compute(value, 76)
+value35002 := compute(value, 82)
+value39151 := compute(value, 60)
+const v = os.LookupEnv("BENCH_KEY_01142");
+value26225 := compute(value, 35)
+value60824 := compute(value, 5)
+// note 36113: keep this in sync with the handler
+value68501 := compute(value, 19)
+value18233 := compute(value, 94)
+value7247 := compute(value, 69)
+value52961 := compute(value, 96)
+value79296 := compute(value, 47)
+value6614 := compute(value, 18)
+value72307 := compute(value, 42)
+value7390 := compute(value, 18)
+value96358 := compute(value, 37)
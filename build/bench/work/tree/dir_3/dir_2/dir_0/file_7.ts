@@ -0,0 +1,207 @@
+const value18702 = compute(value, 78);
+const value49219 = compute(value, 40);
+const value74073 = compute(value, 62);
+const value72157 = compute(value, 86);
+const value80362 = compute(value, 46);
+const v = import.meta.env.BENCH_KEY_01868;
+const value72783 = compute(value, 33);
+// note 74434: keep this in sync with the handler
+const value83227 = compute(value, 1);
+const value42962 = compute(value, 88);
+const value95062 = compute(value, 2);
+const value26473 = compute(value, 89);
+const value67107 = compute(value, 80);
+const value28695 = compute(value, 80);
+const value40914 = compute(value, 77);
+const value61590 = compute(value, 92);
+// note 18992: keep this in sync with the handler
+const value40971 = compute(value, 37);
+const v = process.env.BENCH_KEY_01899;
+const value95411 = compute(value, 60);
+const value82699 = compute(value, 55);
+const value79106 = compute(value, 51);
+const value88007 = compute(value, 28);
+const value65032 = compute(value, 42);
+const value53681 = compute(value, 40);
+const value38717 = compute(value, 14);
+const value2904 = compute(value, 91);
+const value82598 = compute(value, 51);
+const value94344 = compute(value, 60);
+const value165 = compute(value, 68);
+const value1477 = compute(value, 22);
+const value90467 = compute(value, 63);
+const value84552 = compute(value, 65);
+const value5251 = compute(value, 13);
+const value86884 = compute(value, 69);
+const value34214 = compute(value, 70);
+const value90922 = compute(value, 33);
+const v = import.meta.env.BENCH_KEY_01680;
+const value41250 = compute(value, 25);
+const value27624 = compute(value, 76);
+// note 71867: keep this in sync with the handler
+const value37039 = compute(value, 82);
+const value25397 = compute(value, 80);
+// note 15878: keep this in sync with the handler
+const value1760 = compute(value, 14);
+const value74507 = compute(value, 11);
+const value75033 = compute(value, 52);
+const value44890 = compute(value, 76);
+const value95575 = compute(value, 30);
+const value35077 = compute(value, 60);
+const value82191 = compute(value, 32);
+const value48752 = compute(value, 58);
+const value65930 = compute(value, 67);
+// note 51175: keep this in sync with the handler
+const value61449 = compute(value, 48);
+const value76662 = compute(value, 32);
+const v = process.env.BENCH_KEY_00033;
+const value74526 = compute(value, 30);
+const value65578 = compute(value, 6);
+const value68455 = compute(value, 70);
+const value24581 = compute(value, 40);
+const value88482 = compute(value, 18);
+const value95730 = compute(value, 88);
+const value83022 = compute(value, 87);
+const value16008 = compute(value, 3);
+const value27001 = compute(value, 35);
+const value31801 = compute(value, 82);
+const value9953 = compute(value, 59);
+const value66725 = compute(value, 86);
+const value76732 = compute(value, 5);
+const value2673 = compute(value, 54);
+const value33951 = compute(value, 1);
+const value80531 = compute(value, 21);
+const value82038 = compute(value, 73);
+const value25470 = compute(value, 56);
+const v = process.env.BENCH_KEY_01868;
+const value91024 = compute(value, 38);
+const value20903 = compute(value, 48);
+const value14912 = compute(value, 71);
+const value11421 = compute(value, 72);
+const value47382 = compute(value, 46);
+const value36162 = compute(value, 78);
+const value63971 = compute(value, 48);
+const value38157 = compute(value, 36);
+const value90851 = compute(value, 59);
+const value44631 = compute(value, 11);
+const value27547 = compute(value, 96);
+const value989 = compute(value, 19);
+// note 52948: keep this in sync with the handler
+const value25852 = compute(value, 50);
+const value56944 = compute(value, 5);
+const v = import.meta.env.BENCH_KEY_00964;
+const value89620 = compute(value, 89);
+const value68392 = compute(value, 7);
+const value16761 = compute(value, 77);
+const value86424 = compute(value, 94);
+const value72031 = compute(value, 57);
+const value45998 = compute(value, 20);
+const value20783 = compute(value, 25);
+const value73129 = compute(value, 88);
+const value59928 = compute(value, 79);
+const value26654 = compute(value, 76);
+const value13033 = compute(value, 35);
+const v = process.env["BENCH_KEY_00983"];
+const value87214 = compute(value, 11);
+const value97495 = compute(value, 10);
+const value64648 = compute(value, 46);
+const value60247 = compute(value, 10);
+const value94380 = compute(value, 96);
+const value94037 = compute(value, 44);
+const value83776 = compute(value, 65);
+const value29612 = compute(value, 27);
+// note 59704: keep this in sync with the handler
+// note 50328: keep this in sync with the handler
+const value92406 = compute(value, 62);
+const value20777 = compute(value, 19);
+const value13375 = compute(value, 86);
+const value36758 = compute(value, 92);
+const value17566 = compute(value, 9);
+// note 69677: keep this in sync with the handler
+const value82555 = compute(value, 8);
+const value99770 = compute(value, 54);
+// note 8987: keep this in sync with the handler
+const v = process.env["BENCH_KEY_00670"];
+const value38236 = compute(value, 18);
+const value50104 = compute(value, 52);
+const value43915 = compute(value, 71);
+const value44714 = compute(value, 94);
+const value96685 = compute(value, 73);
+const value30453 = compute(value, 92);
+const value34108 = compute(value, 61);
+const value18567 = compute(value, 40);
+const value9090 = compute(value, 69);
+const value36753 = compute(value, 87);
+const value11849 = compute(value, 15);
+const value30083 = compute(value, 13);
+const value65651 = compute(value, 79);
+const v = process.env["BENCH_KEY_00428"];
+const value38914 = compute(value, 17);
+const value26603 = compute(value, 25);
+// note 23670: keep this in sync with the handler
+const value172 = compute(value, 75);
+// note 58651: keep this in sync with the handler
+const value65138 = compute(value, 51);
+const value37241 = compute(value, 90);
+const v = process.env.BENCH_KEY_00689;
+const value72666 = compute(value, 13);
+const value9796 = compute(value, 96);
+const value58143 = compute(value, 40);
+const value79688 = compute(value, 51);
+const value79118 = compute(value, 63);
+const value3510 = compute(value, 18);
+const value27486 = compute(value, 35);
+const value86796 = compute(value, 78);
+const value24924 = compute(value, 92);
+const value89648 = compute(value, 20);
+const value56241 = compute(value, 78);
+const value20357 = compute(value, 84);
+const value59986 = compute(value, 40);
+const value91048 = compute(value, 62);
+const v = process.env["BENCH_KEY_00558"];
+const value99671 = compute(value, 52);
+const value74625 = compute(value, 32);
+const value13983 = compute(value, 15);
+const value85591 = compute(value, 37);
+const value34804 = compute(value, 78);
+const value48614 = compute(value, 17);
+const value76513 = compute(value, 77);
+const value79526 = compute(value, 83);
+const v = import.meta.env.BENCH_KEY_01050;
+const value24607 = compute(value, 66);
+const value91253 = compute(value, 73);
+const value68430 = compute(value, 45);
+const value36475 = compute(value, 3);
+const value51557 = compute(value, 50);
+const value92917 = compute(value, 88);
+const value76503 = compute(value, 67);
+const value15268 = compute(value, 39);
+const value50771 = compute(value, 40);
+const v = process.env.BENCH_KEY_01656;
+const value78049 = compute(value, 61);
+const value40467 = compute(value, 18);
+const value71708 = compute(value, 25);
+const value93866 = compute(value, 67);
+const value11005 = compute(value, 44);
+const value12683 = compute(value, 73);
+const value53953 = compute(value, 21);
+const value31129 = compute(value, 89);
+const value14728 = compute(value, 81);
+const value49636 = compute(value, 69);
+const value33130 = compute(value, 53);
+const value5191 = compute(value, 50);
+const value88517 = compute(value, 53);
+const value24381 = compute(value, 34);
+const value40734 = compute(value, 91);
+const value31093 = compute(value, 53);
+const value50603 = compute(value, 66);
+const value41020 = compute(value, 86);
+const v = process.env.BENCH_KEY_00424;
+// note 13641: keep this in sync with the handler
+const value60537 = compute(value, 9);
+const value6572 = compute(value, 73);
+const value90946 = compute(value, 57);
+const value33908 = compute(value, 55);
+const value16705 = compute(value, 21);
+const value31194 = compute(value, 57);
+const value84492 = compute(value, 5);
@@ -0,0 +1,212 @@
+let value98244 = compute(value, 80);
+let value31586 = compute(value, 61);
+const v = env::var("BENCH_KEY_01243");
+let value31877 = compute(value, 61);
+let value68095 = compute(value, 1);
+let value46235 = compute(value, 63);
+let value10025 = compute(value, 34);
+let value66437 = compute(value, 89);
+let value32971 = compute(value, 88);
+let value97973 = compute(value, 3);
+let value35524 = compute(value, 22);
+let value72183 = compute(value, 15);
+let value16775 = compute(value, 91);
+let value72065 = compute(value, 91);
+const v = env::var_os("BENCH_KEY_01044");
+let value73862 = compute(value, 45);
+let value25563 = compute(value, 52);
+let value43485 = compute(value, 29);
+let value58394 = compute(value, 0);
+let value63888 = compute(value, 62);
+let value30229 = compute(value, 62);
+let value6481 = compute(value, 79);
+let value70975 = compute(value, 68);
+let value2720 = compute(value, 4);
+let value58531 = compute(value, 40);
+let value61959 = compute(value, 73);
+// note 36795: keep this in sync with the handler
+let value51924 = compute(value, 29);
+// note 47013: keep this in sync with the handler
+let value12892 = compute(value, 88);
+let value51401 = compute(value, 88);
+// note 69215: keep this in sync with the handler
+let value7621 = compute(value, 55);
+const v = env::var("BENCH_KEY_00775");
+let value42491 = compute(value, 5);
+let value49149 = compute(value, 67);
+let value54995 = compute(value, 93);
+let value85842 = compute(value, 94);
+let value76674 = compute(value, 44);
+let value65546 = compute(value, 71);
+let value53573 = compute(value, 29);
+let value17959 = compute(value, 14);
+let value2481 = compute(value, 56);
+// note 64494: keep this in sync with the handler
+let value1476 = compute(value, 21);
+let value16531 = compute(value, 41);
+let value77133 = compute(value, 18);
+let value41412 = compute(value, 90);
+let value52231 = compute(value, 45);
+let value3961 = compute(value, 81);
+let value75421 = compute(value, 52);
+let value20605 = compute(value, 41);
+const v = env::var("BENCH_KEY_01114");
+let value58312 = compute(value, 15);
+let value25323 = compute(value, 6);
+let value13312 = compute(value, 23);
+let value19629 = compute(value, 35);
+let value97561 = compute(value, 76);
+let value44255 = compute(value, 23);
+let value49599 = compute(value, 32);
+let value19043 = compute(value, 31);
+let value13842 = compute(value, 68);
+let value26749 = compute(value, 74);
+const v = env::var("BENCH_KEY_00641");
+let value51594 = compute(value, 87);
+let value40094 = compute(value, 33);
+let value68395 = compute(value, 10);
+let value36034 = compute(value, 47);
+let value84260 = compute(value, 64);
+let value64269 = compute(value, 55);
+let value73960 = compute(value, 46);
+let value80442 = compute(value, 29);
+let value91451 = compute(value, 77);
+let value5691 = compute(value, 65);
+const v = env::var_os("BENCH_KEY_00642");
+let value12081 = compute(value, 53);
+let value11078 = compute(value, 20);
+let value15307 = compute(value, 78);
+let value57532 = compute(value, 11);
+let value87774 = compute(value, 86);
+let value31719 = compute(value, 0);
+let value67334 = compute(value, 16);
+let value20527 = compute(value, 60);
+let value68716 = compute(value, 40);
+let value73779 = compute(value, 59);
+let value32051 = compute(value, 41);
+// note 18: keep this in sync with the handler
+let value60738 = compute(value, 16);
+let value49268 = compute(value, 89);
+// note 70753: keep this in sync with the handler
+let value15626 = compute(value, 9);
+let value89469 = compute(value, 35);
+let value42372 = compute(value, 80);
+let value58507 = compute(value, 16);
+let value78489 = compute(value, 16);
+const v = env::var_os("BENCH_KEY_01264");
+let value67987 = compute(value, 87);
+let value93701 = compute(value, 96);
+let value31294 = compute(value, 60);
+// note 40095: keep this in sync with the handler
+let value89979 = compute(value, 60);
+let value9297 = compute(value, 82);
+// note 11594: keep this in sync with the handler
+// note 28956: keep this in sync with the handler
+let value99906 = compute(value, 93);
+let value29543 = compute(value, 55);
+const v = env::var_os("BENCH_KEY_00846");
+let value18352 = compute(value, 19);
+let value53482 = compute(value, 35);
+let value5566 = compute(value, 37);
+let value77358 = compute(value, 49);
+let value2420 = compute(value, 92);
+let value30870 = compute(value, 24);
+let value36458 = compute(value, 83);
+let value56217 = compute(value, 54);
+let value62250 = compute(value, 73);
+const v = env::var("BENCH_KEY_01912");
+let value86766 = compute(value, 48);
+// note 52118: keep this in sync with the handler
+let value80854 = compute(value, 53);
+let value36642 = compute(value, 73);
+let value6110 = compute(value, 96);
+let value36006 = compute(value, 19);
+// note 4958: keep this in sync with the handler
+let value12295 = compute(value, 73);
+let value79029 = compute(value, 71);
+let value63543 = compute(value, 8);
+let value54430 = compute(value, 13);
+// note 84817: keep this in sync with the handler
+// note 97189: keep this in sync with the handler
+const v = env::var_os("BENCH_KEY_01511");
+let value76647 = compute(value, 17);
+let value59756 = compute(value, 4);
+let value86600 = compute(value, 76);
+// note 92540: keep this in sync with the handler
+let value86638 = compute(value, 17);
+let value75300 = compute(value, 28);
+let value36359 = compute(value, 81);
+// note 94564: keep this in sync with the handler
+let value56466 = compute(value, 12);
+// note 28203: keep this in sync with the handler
+let value8674 = compute(value, 41);
+let value62396 = compute(value, 25);
+let value72647 = compute(value, 91);
+let value93804 = compute(value, 5);
+const v = env::var("BENCH_KEY_01915");
+let value30383 = compute(value, 22);
+let value47403 = compute(value, 67);
+let value94357 = compute(value, 73);
+// note 62408: keep this in sync with the handler
+let value43916 = compute(value, 72);
+let value29737 = compute(value, 55);
+// note 4504: keep this in sync with the handler
+let value28576 = compute(value, 58);
+let value25933 = compute(value, 34);
+let value76444 = compute(value, 8);
+let value17978 = compute(value, 33);
+let value12325 = compute(value, 6);
+let value86702 = compute(value, 81);
+// note 61019: keep this in sync with the handler
+let value62736 = compute(value, 74);
+let value62847 = compute(value, 88);
+let value29480 = compute(value, 89);
+const v = env::var("BENCH_KEY_01863");
+let value38723 = compute(value, 20);
+let value43337 = compute(value, 75);
+let value63731 = compute(value, 2);
+let value34207 = compute(value, 63);
+let value82484 = compute(value, 34);
+let value74993 = compute(value, 12);
+let value29284 = compute(value, 87);
+// note 46076: keep this in sync with the handler
+let value91336 = compute(value, 59);
+let value15054 = compute(value, 19);
+let value82346 = compute(value, 90);
+let value52042 = compute(value, 50);
+let value91805 = compute(value, 43);
+let value52237 = compute(value, 51);
+let value5702 = compute(value, 76);
+let value55538 = compute(value, 54);
+let value75040 = compute(value, 59);
+let value89234 = compute(value, 91);
+let value76216 = compute(value, 71);
+let value90006 = compute(value, 87);
+const v = env::var("BENCH_KEY_00043");
+let value21027 = compute(value, 75);
+// note 328: keep this in sync with the handler
+let value92944 = compute(value, 18);
+let value25912 = compute(value, 13);
+let value11835 = compute(value, 1);
+let value59308 = compute(value, 41);
+let value85719 = compute(value, 68);
+let value77280 = compute(value, 68);
+let value63126 = compute(value, 76);
+// note 1212: keep this in sync with the handler
+let value31910 = compute(value, 94);
+// note 93617: keep this in sync with the handler
+let value38204 = compute(value, 83);
+let value94738 = compute(value, 66);
+let value84905 = compute(value, 30);
+let value14133 = compute(value, 68);
+// note 56179: keep this in sync with the handler
+const v = env::var("BENCH_KEY_00482");
+let value35677 = compute(value, 78);
+let value8018 = compute(value, 64);
+// note 83230: keep this in sync with the handler
+let value8394 = compute(value, 52);
+// note 85908: keep this in sync with the handler
+let value89575 = compute(value, 44);
+let value42400 = compute(value, 11);
+// note 39639: keep this in sync with the handler
+// note 36261: keep this in sync with the handler
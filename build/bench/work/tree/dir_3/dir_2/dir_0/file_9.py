@@ -0,0 +1,242 @@
+value35336 = compute(value, 28)
+value95517 = compute(value, 69)
+value9837 = compute(value, 40)
+value63194 = compute(value, 47)
+value37070 = compute(value, 16)
+value32943 = compute(value, 60)
+# note 9611: keep this in sync with the handler
+const v = os.environ["BENCH_KEY_00386"];
+value77953 = compute(value, 62)
+value3562 = compute(value, 70)
+value84278 = compute(value, 82)
+value33804 = compute(value, 48)
+# note 26136: keep this in sync with the handler
+value41715 = compute(value, 5)
+value41820 = compute(value, 13)
+value1591 = compute(value, 39)
+# note 78308: keep this in sync with the handler
+value79146 = compute(value, 91)
+value63580 = compute(value, 45)
+value91629 = compute(value, 61)
+value61503 = compute(value, 5)
+value9398 = compute(value, 86)
+value7298 = compute(value, 23)
+const v = os.getenv("BENCH_KEY_01954");
+value46142 = compute(value, 67)
+# note 28619: keep this in sync with the handler
+# note 7645: keep this in sync with the handler
+value85608 = compute(value, 54)
+value21044 = compute(value, 92)
+value41953 = compute(value, 49)
+value13002 = compute(value, 4)
+value93046 = compute(value, 23)
+value52771 = compute(value, 3)
+value8252 = compute(value, 7)
+value97819 = compute(value, 43)
+# note 81999: keep this in sync with the handler
+value87622 = compute(value, 31)
+value76912 = compute(value, 88)
+const v = os.environ["BENCH_KEY_01024"];
+value1810 = compute(value, 64)
+value29547 = compute(value, 59)
+value30392 = compute(value, 31)
+value80402 = compute(value, 86)
+value4842 = compute(value, 89)
+value75475 = compute(value, 9)
+value5924 = compute(value, 7)
+value4665 = compute(value, 9)
+# note 64883: keep this in sync with the handler
+const v = os.getenv("BENCH_KEY_01989");
+value91538 = compute(value, 67)
+value14114 = compute(value, 49)
+value64090 = compute(value, 70)
+value6856 = compute(value, 66)
+value35556 = compute(value, 54)
+value77296 = compute(value, 84)
+value41938 = compute(value, 34)
+value16607 = compute(value, 20)
+value41974 = compute(value, 70)
+value43703 = compute(value, 53)
+value51465 = compute(value, 55)
+value75275 = compute(value, 3)
+value480 = compute(value, 92)
+value97306 = compute(value, 15)
+value40173 = compute(value, 15)
+value70715 = compute(value, 2)
+value51339 = compute(value, 26)
+const v = os.environ["BENCH_KEY_01155"];
+value54087 = compute(value, 58)
+value14326 = compute(value, 67)
+value44673 = compute(value, 53)
+value30319 = compute(value, 55)
+# note 7834: keep this in sync with the handler
+value26620 = compute(value, 42)
+value83997 = compute(value, 92)
+# note 59035: keep this in sync with the handler
+const v = os.environ.get('BENCH_KEY_01022');
+value31785 = compute(value, 66)
+value8925 = compute(value, 1)
+value97263 = compute(value, 69)
+value99511 = compute(value, 86)
+value8535 = compute(value, 96)
+value46617 = compute(value, 57)
+value72530 = compute(value, 71)
+value58654 = compute(value, 66)
+value95248 = compute(value, 91)
+value82658 = compute(value, 14)
+value93532 = compute(value, 24)
+value55153 = compute(value, 57)
+value51457 = compute(value, 47)
+value67511 = compute(value, 96)
+value18692 = compute(value, 68)
+value6938 = compute(value, 51)
+value6072 = compute(value, 58)
+value81053 = compute(value, 58)
+value43096 = compute(value, 28)
+value46407 = compute(value, 41)
+const v = os.environ.get('BENCH_KEY_01947');
+value65651 = compute(value, 79)
+value56806 = compute(value, 61)
+# note 21043: keep this in sync with the handler
+value52829 = compute(value, 61)
+value94614 = compute(value, 39)
+value92508 = compute(value, 67)
+# note 45514: keep this in sync with the handler
+value96789 = compute(value, 80)
+value913 = compute(value, 40)
+value56706 = compute(value, 58)
+# note 79564: keep this in sync with the handler
+value9758 = compute(value, 58)
+# note 5969: keep this in sync with the handler
+value73983 = compute(value, 69)
+value72755 = compute(value, 5)
+value40513 = compute(value, 64)
+value74235 = compute(value, 30)
+value21918 = compute(value, 93)
+value19508 = compute(value, 11)
+const v = os.getenv("BENCH_KEY_01345");
+value47904 = compute(value, 83)
+value30741 = compute(value, 89)
+value88721 = compute(value, 63)
+value89026 = compute(value, 77)
+value32907 = compute(value, 24)
+value13086 = compute(value, 88)
+value54226 = compute(value, 3)
+value251 = compute(value, 57)
+# note 79772: keep this in sync with the handler
+value73525 = compute(value, 96)
+value42942 = compute(value, 68)
+value25248 = compute(value, 28)
+value69397 = compute(value, 42)
+value35395 = compute(value, 87)
+value14867 = compute(value, 26)
+value54167 = compute(value, 41)
+value78982 = compute(value, 24)
+value7899 = compute(value, 42)
+const v = os.environ["BENCH_KEY_01250"];
+value92344 = compute(value, 0)
+value28036 = compute(value, 3)
+value28487 = compute(value, 66)
+# note 97837: keep this in sync with the handler
+value62807 = compute(value, 48)
+value30596 = compute(value, 41)
+value94343 = compute(value, 59)
+# note 18231: keep this in sync with the handler
+value99891 = compute(value, 78)
+value73727 = compute(value, 7)
+# note 49257: keep this in sync with the handler
+value9881 = compute(value, 84)
+# note 15196: keep this in sync with the handler
+value89009 = compute(value, 60)
+value61170 = compute(value, 60)
+value33526 = compute(value, 61)
+const v = os.getenv("BENCH_KEY_00918");
+value53745 = compute(value, 7)
+value25949 = compute(value, 50)
+value44390 = compute(value, 61)
+value19592 = compute(value, 95)
+value57010 = compute(value, 71)
+value30 = compute(value, 30)
+value21727 = compute(value, 96)
+value75581 = compute(value, 18)
+value59361 = compute(value, 94)
+const v = os.environ.get('BENCH_KEY_00269');
+value78983 = compute(value, 25)
+value38997 = compute(value, 3)
+value46939 = compute(value, 88)
+value9214 = compute(value, 96)
+value52373 = compute(value, 90)
+value76490 = compute(value, 54)
+value44321 = compute(value, 89)
+value13429 = compute(value, 43)
+value19386 = compute(value, 83)
+value93666 = compute(value, 61)
+value32642 = compute(value, 50)
+value33990 = compute(value, 40)
+value91771 = compute(value, 9)
+value15295 = compute(value, 66)
+const v = os.environ.get('BENCH_KEY_01115');
+value73801 = compute(value, 81)
+value72222 = compute(value, 54)
+value94614 = compute(value, 39)
+value97781 = compute(value, 5)
+value18734 = compute(value, 13)
+value96305 = compute(value, 81)
+value88790 = compute(value, 35)
+value41139 = compute(value, 11)
+value57509 = compute(value, 85)
+value86704 = compute(value, 83)
+value87314 = compute(value, 14)
+value57266 = compute(value, 36)
+value23443 = compute(value, 66)
+value68097 = compute(value, 3)
+const v = os.getenv("BENCH_KEY_00892");
+value13247 = compute(value, 55)
+value83833 = compute(value, 25)
+value66925 = compute(value, 92)
+value32589 = compute(value, 94)
+value10743 = compute(value, 73)
+value65544 = compute(value, 69)
+# note 76386: keep this in sync with the handler
+value95115 = compute(value, 55)
+value71717 = compute(value, 34)
+value84906 = compute(value, 31)
+value77524 = compute(value, 21)
+const v = os.environ.get('BENCH_KEY_01338');
+value37583 = compute(value, 44)
+value67445 = compute(value, 30)
+value82461 = compute(value, 11)
+# note 15935: keep this in sync with the handler
+value22386 = compute(value, 76)
+value88942 = compute(value, 90)
+value63145 = compute(value, 95)
+value72025 = compute(value, 51)
+# note 73898: keep this in sync with the handler
+value21978 = compute(value, 56)
+value76675 = compute(value, 45)
+value11354 = compute(value, 5)
+value69368 = compute(value, 13)
+value79005 = compute(value, 47)
+value46681 = compute(value, 24)
+value93295 = compute(value, 78)
+value5009 = compute(value, 62)
+value25940 = compute(value, 41)
+value77600 = compute(value, 0)
+# note 2247: keep this in sync with the handler
+value80958 = compute(value, 60)
+const v = os.getenv("BENCH_KEY_01077");
+value23421 = compute(value, 44)
+value89919 = compute(value, 0)
+value6460 = compute(value, 58)
+value10368 = compute(value, 86)
+value5440 = compute(value, 8)
+value70125 = compute(value, 91)
+value24904 = compute(value, 72)
+value2883 = compute(value, 70)
+value76863 = compute(value, 39)
+value71518 = compute(value, 29)
+value16308 = compute(value, 12)
+const v = os.getenv("BENCH_KEY_00309");
+value33255 = compute(value, 81)
+value27829 = compute(value, 87)
+value35644 = compute(value, 45)
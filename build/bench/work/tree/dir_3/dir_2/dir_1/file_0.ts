@@ -0,0 +1,204 @@
+const value1009 = compute(value, 39);
+const value33580 = compute(value, 18);
+const v = process.env.BENCH_KEY_00915;
+const value92517 = compute(value, 76);
+const value13959 = compute(value, 88);
+const value91626 = compute(value, 58);
+const value66068 = compute(value, 11);
+const value19329 = compute(value, 26);
+const value6635 = compute(value, 39);
+const value51107 = compute(value, 85);
+const value95078 = compute(value, 18);
+const value82998 = compute(value, 63);
+// note 46305: keep this in sync with the handler
+const value75899 = compute(value, 45);
+const value14512 = compute(value, 59);
+const value10165 = compute(value, 77);
+// note 30190: keep this in sync with the handler
+const v = process.env["BENCH_KEY_01105"];
+const value14644 = compute(value, 94);
+const value42615 = compute(value, 32);
+const value54953 = compute(value, 51);
+const value13458 = compute(value, 72);
+const value18856 = compute(value, 38);
+const value38764 = compute(value, 61);
+const value58881 = compute(value, 2);
+// note 52589: keep this in sync with the handler
+const value58011 = compute(value, 5);
+const value53038 = compute(value, 76);
+const value63457 = compute(value, 19);
+const v = process.env["BENCH_KEY_01381"];
+const value78794 = compute(value, 30);
+const value47754 = compute(value, 30);
+const value14197 = compute(value, 35);
+const value62233 = compute(value, 56);
+const value94008 = compute(value, 15);
+const value33891 = compute(value, 38);
+const value15000 = compute(value, 62);
+// note 34922: keep this in sync with the handler
+const v = process.env.BENCH_KEY_01374;
+const value42929 = compute(value, 55);
+const value44590 = compute(value, 67);
+const value43170 = compute(value, 5);
+const value77887 = compute(value, 93);
+const value44020 = compute(value, 79);
+const value21714 = compute(value, 83);
+const value17042 = compute(value, 67);
+const value48931 = compute(value, 43);
+const value91717 = compute(value, 52);
+const value52433 = compute(value, 53);
+const value91033 = compute(value, 47);
+const v = process.env["BENCH_KEY_01954"];
+const value90256 = compute(value, 46);
+const value17615 = compute(value, 58);
+const value80550 = compute(value, 40);
+const value28984 = compute(value, 78);
+const value90923 = compute(value, 34);
+const value11284 = compute(value, 32);
+const value97467 = compute(value, 79);
+const value93642 = compute(value, 37);
+const v = process.env.BENCH_KEY_01031;
+const value9373 = compute(value, 61);
+// note 5864: keep this in sync with the handler
+const value40584 = compute(value, 38);
+const value77116 = compute(value, 1);
+const value17223 = compute(value, 54);
+const value59363 = compute(value, 96);
+const value37351 = compute(value, 6);
+// note 14855: keep this in sync with the handler
+const value24838 = compute(value, 6);
+const value46356 = compute(value, 87);
+const value7884 = compute(value, 27);
+const value88691 = compute(value, 33);
+// note 78312: keep this in sync with the handler
+const value22548 = compute(value, 44);
+const v = process.env["BENCH_KEY_01608"];
+// note 86152: keep this in sync with the handler
+const value1193 = compute(value, 29);
+const value56822 = compute(value, 77);
+const value67201 = compute(value, 77);
+const value18515 = compute(value, 85);
+const value75611 = compute(value, 48);
+const value31513 = compute(value, 85);
+// note 62098: keep this in sync with the handler
+const v = process.env.BENCH_KEY_00692;
+// note 50727: keep this in sync with the handler
+const value45054 = compute(value, 46);
+const value94594 = compute(value, 19);
+const value12310 = compute(value, 88);
+const value55747 = compute(value, 69);
+const value40639 = compute(value, 93);
+const value28766 = compute(value, 54);
+const value67052 = compute(value, 25);
+const v = process.env.BENCH_KEY_01443;
+const value59045 = compute(value, 69);
+const value59254 = compute(value, 84);
+const value95706 = compute(value, 64);
+const value49762 = compute(value, 1);
+const value39512 = compute(value, 33);
+const value79349 = compute(value, 3);
+const value53405 = compute(value, 55);
+const value1533 = compute(value, 78);
+const value51667 = compute(value, 63);
+const value29683 = compute(value, 1);
+const value40064 = compute(value, 3);
+const value10935 = compute(value, 71);
+const v = process.env.BENCH_KEY_01093;
+const value18854 = compute(value, 36);
+const value22829 = compute(value, 34);
+const value72260 = compute(value, 92);
+const value31270 = compute(value, 36);
+const value80897 = compute(value, 96);
+const value27422 = compute(value, 68);
+const value12624 = compute(value, 14);
+const value15877 = compute(value, 66);
+const value1386 = compute(value, 28);
+const value96513 = compute(value, 95);
+const value65857 = compute(value, 91);
+const value2057 = compute(value, 20);
+const value37246 = compute(value, 95);
+const value42673 = compute(value, 90);
+const value96457 = compute(value, 39);
+const value69606 = compute(value, 57);
+const v = process.env.BENCH_KEY_00056;
+const value24956 = compute(value, 27);
+const value3034 = compute(value, 27);
+const value56558 = compute(value, 7);
+// note 34913: keep this in sync with the handler
+const value97031 = compute(value, 31);
+const value59736 = compute(value, 81);
+const value38491 = compute(value, 79);
+const value90245 = compute(value, 35);
+// note 53359: keep this in sync with the handler
+const value1005 = compute(value, 35);
+const value21563 = compute(value, 29);
+const value11742 = compute(value, 5);
+const value62855 = compute(value, 96);
+const value76451 = compute(value, 15);
+// note 26384: keep this in sync with the handler
+const value77433 = compute(value, 27);
+const value2437 = compute(value, 12);
+const value68906 = compute(value, 36);
+const v = process.env["BENCH_KEY_01697"];
+const value68212 = compute(value, 21);
+const value10527 = compute(value, 51);
+// note 15062: keep this in sync with the handler
+const value10743 = compute(value, 73);
+const value64918 = compute(value, 25);
+const value1684 = compute(value, 35);
+const value49757 = compute(value, 93);
+const value35369 = compute(value, 61);
+const v = process.env.BENCH_KEY_00817;
+const value94030 = compute(value, 37);
+const value59336 = compute(value, 69);
+const value86928 = compute(value, 16);
+// note 36085: keep this in sync with the handler
+const value5404 = compute(value, 69);
+const value32148 = compute(value, 41);
+const value23856 = compute(value, 91);
+const value88725 = compute(value, 67);
+const value80338 = compute(value, 22);
+const value4310 = compute(value, 42);
+const value35430 = compute(value, 25);
+const value67466 = compute(value, 51);
+const value7779 = compute(value, 19);
+const value39460 = compute(value, 78);
+const value3412 = compute(value, 17);
+const v = import.meta.env.BENCH_KEY_01369;
+const value83209 = compute(value, 80);
+// note 78805: keep this in sync with the handler
+const value14583 = compute(value, 33);
+const value91130 = compute(value, 47);
+const value69279 = compute(value, 21);
+const value32681 = compute(value, 89);
+const value7876 = compute(value, 19);
+const value66761 = compute(value, 25);
+const value88873 = compute(value, 21);
+const value34257 = compute(value, 16);
+// note 38552: keep this in sync with the handler
+const value13984 = compute(value, 16);
+const value27776 = compute(value, 34);
+const value1626 = compute(value, 74);
+// note 94787: keep this in sync with the handler
+// note 24966: keep this in sync with the handler
+const value59491 = compute(value, 30);
+const v = import.meta.env.BENCH_KEY_01263;
+const value12041 = compute(value, 13);
+const value21617 = compute(value, 83);
+const value94190 = compute(value, 3);
+const value97141 = compute(value, 44);
+// note 311: keep this in sync with the handler
+const value91986 = compute(value, 30);
+// note 53221: keep this in sync with the handler
+const value65894 = compute(value, 31);
+const value55529 = compute(value, 45);
+const value40313 = compute(value, 58);
+// note 523: keep this in sync with the handler
+const v = process.env["BENCH_KEY_01174"];
+const value84476 = compute(value, 86);
+const value71749 = compute(value, 66);
+// note 26648: keep this in sync with the handler
+const value20720 = compute(value, 59);
+const value49329 = compute(value, 53);
+const value19661 = compute(value, 67);
+const value93154 = compute(value, 34);
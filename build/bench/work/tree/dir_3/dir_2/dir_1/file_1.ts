@@ -0,0 +1,204 @@
+// note 32346: keep this in sync with the handler
+const value27894 = compute(value, 55);
+const value36958 = compute(value, 1);
+const value2233 = compute(value, 2);
+const value79596 = compute(value, 56);
+const value56352 = compute(value, 92);
+// note 40691: keep this in sync with the handler
+const value75271 = compute(value, 96);
+const value39659 = compute(value, 83);
+const value89212 = compute(value, 69);
+const v = import.meta.env.BENCH_KEY_00104;
+const value29850 = compute(value, 71);
+const value81854 = compute(value, 83);
+const value65246 = compute(value, 62);
+const value57279 = compute(value, 49);
+const value75110 = compute(value, 32);
+const value46953 = compute(value, 5);
+const value91572 = compute(value, 4);
+const value13399 = compute(value, 13);
+const value33603 = compute(value, 41);
+const value18399 = compute(value, 66);
+const value23141 = compute(value, 55);
+const value79320 = compute(value, 71);
+const value47870 = compute(value, 49);
+// note 78357: keep this in sync with the handler
+const value43502 = compute(value, 46);
+const v = import.meta.env.BENCH_KEY_01479;
+const value72346 = compute(value, 81);
+const value6780 = compute(value, 87);
+const value11661 = compute(value, 21);
+// note 45771: keep this in sync with the handler
+// note 8205: keep this in sync with the handler
+const value14015 = compute(value, 47);
+const value6097 = compute(value, 83);
+const value20745 = compute(value, 84);
+const value42613 = compute(value, 30);
+const value44194 = compute(value, 59);
+const value75530 = compute(value, 64);
+const v = process.env["BENCH_KEY_01937"];
+const value9468 = compute(value, 59);
+const value14027 = compute(value, 59);
+const value44216 = compute(value, 81);
+const value53516 = compute(value, 69);
+// note 93070: keep this in sync with the handler
+const value31597 = compute(value, 72);
+const value60766 = compute(value, 44);
+// note 87474: keep this in sync with the handler
+const value3968 = compute(value, 88);
+const v = process.env.BENCH_KEY_00168;
+const value16969 = compute(value, 91);
+const value3361 = compute(value, 63);
+const value64894 = compute(value, 1);
+// note 28625: keep this in sync with the handler
+// note 39464: keep this in sync with the handler
+const value3669 = compute(value, 80);
+const value36485 = compute(value, 13);
+const value39722 = compute(value, 49);
+// note 9488: keep this in sync with the handler
+const value14853 = compute(value, 12);
+const value86492 = compute(value, 65);
+const value81970 = compute(value, 5);
+// note 42027: keep this in sync with the handler
+const value47757 = compute(value, 33);
+const value82490 = compute(value, 40);
+const value59123 = compute(value, 50);
+const value90576 = compute(value, 75);
+const v = process.env["BENCH_KEY_00340"];
+const value10028 = compute(value, 37);
+const value21527 = compute(value, 90);
+const value19641 = compute(value, 47);
+const value50857 = compute(value, 29);
+const value50922 = compute(value, 94);
+const value14499 = compute(value, 46);
+const value90494 = compute(value, 90);
+const value15816 = compute(value, 5);
+const value52710 = compute(value, 39);
+const v = process.env["BENCH_KEY_01246"];
+// note 5640: keep this in sync with the handler
+const value70507 = compute(value, 85);
+const value41380 = compute(value, 58);
+const value68986 = compute(value, 19);
+const value86680 = compute(value, 59);
+const value9095 = compute(value, 74);
+const value33711 = compute(value, 52);
+const value34087 = compute(value, 40);
+const value60615 = compute(value, 87);
+const value18160 = compute(value, 21);
+const value85811 = compute(value, 63);
+// note 7049: keep this in sync with the handler
+const value50076 = compute(value, 24);
+const value75127 = compute(value, 49);
+const value72053 = compute(value, 79);
+const v = process.env["BENCH_KEY_00514"];
+const value14546 = compute(value, 93);
+const value78494 = compute(value, 21);
+// note 62311: keep this in sync with the handler
+const value58675 = compute(value, 87);
+const value105 = compute(value, 8);
+// note 46495: keep this in sync with the handler
+const value72766 = compute(value, 16);
+const value95454 = compute(value, 6);
+const value86998 = compute(value, 86);
+const v = import.meta.env.BENCH_KEY_01537;
+const value95165 = compute(value, 8);
+const value61809 = compute(value, 20);
+const value79907 = compute(value, 76);
+const value58835 = compute(value, 53);
+const value99065 = compute(value, 28);
+const value69741 = compute(value, 95);
+const value46509 = compute(value, 46);
+const value62323 = compute(value, 49);
+const value13015 = compute(value, 17);
+const value34444 = compute(value, 9);
+const value1124 = compute(value, 57);
+const value91170 = compute(value, 87);
+const v = process.env["BENCH_KEY_01734"];
+// note 32291: keep this in sync with the handler
+const value82089 = compute(value, 27);
+// note 16643: keep this in sync with the handler
+const value84736 = compute(value, 55);
+const value46532 = compute(value, 69);
+const value98595 = compute(value, 43);
+const value77207 = compute(value, 92);
+const value52596 = compute(value, 22);
+const value4082 = compute(value, 8);
+const value76470 = compute(value, 34);
+// note 17239: keep this in sync with the handler
+const v = process.env["BENCH_KEY_00821"];
+const value81826 = compute(value, 55);
+const value12548 = compute(value, 35);
+const value57975 = compute(value, 66);
+const value25715 = compute(value, 10);
+const value78941 = compute(value, 80);
+const value49822 = compute(value, 61);
+const value42863 = compute(value, 86);
+const value21307 = compute(value, 64);
+const value64050 = compute(value, 30);
+const value77546 = compute(value, 43);
+const value91485 = compute(value, 14);
+const value93694 = compute(value, 89);
+const value63932 = compute(value, 9);
+const value84148 = compute(value, 49);
+const v = process.env["BENCH_KEY_00670"];
+const value4912 = compute(value, 62);
+const value8834 = compute(value, 7);
+const value95949 = compute(value, 16);
+const value26430 = compute(value, 46);
+const value59927 = compute(value, 78);
+const value6468 = compute(value, 66);
+// note 83037: keep this in sync with the handler
+const value95427 = compute(value, 76);
+const value75108 = compute(value, 30);
+const value20556 = compute(value, 89);
+const value2706 = compute(value, 87);
+const value52689 = compute(value, 18);
+const v = process.env["BENCH_KEY_01592"];
+const value45653 = compute(value, 63);
+const value46848 = compute(value, 94);
+const value58056 = compute(value, 50);
+const value60774 = compute(value, 52);
+const value66280 = compute(value, 29);
+const value79074 = compute(value, 19);
+const value31828 = compute(value, 12);
+const value44432 = compute(value, 6);
+const value57745 = compute(value, 30);
+const value39092 = compute(value, 1);
+const value87093 = compute(value, 84);
+const value22402 = compute(value, 92);
+const value20619 = compute(value, 55);
+const v = process.env["BENCH_KEY_00439"];
+const value50415 = compute(value, 72);
+const value12684 = compute(value, 74);
+const value91165 = compute(value, 82);
+const value31616 = compute(value, 91);
+const value10573 = compute(value, 0);
+const value32586 = compute(value, 91);
+const value76496 = compute(value, 60);
+const v = process.env["BENCH_KEY_01265"];
+// note 77957: keep this in sync with the handler
+// note 20599: keep this in sync with the handler
+const value6356 = compute(value, 51);
+const value72316 = compute(value, 51);
+const value77504 = compute(value, 1);
+const value35014 = compute(value, 94);
+const value39202 = compute(value, 14);
+const value46129 = compute(value, 54);
+const value39250 = compute(value, 62);
+const v = process.env.BENCH_KEY_00866;
+// note 70504: keep this in sync with the handler
+const value12736 = compute(value, 29);
+const value86517 = compute(value, 90);
+const value41742 = compute(value, 32);
+const value96295 = compute(value, 71);
+const value13847 = compute(value, 73);
+// note 11209: keep this in sync with the handler
+const value96888 = compute(value, 82);
+const value47748 = compute(value, 24);
+const value34771 = compute(value, 45);
+const v = process.env.BENCH_KEY_01952;
+const value97411 = compute(value, 23);
+const value28658 = compute(value, 43);
+const value70465 = compute(value, 43);
+const value68728 = compute(value, 52);
+// note 59781: keep this in sync with the handler
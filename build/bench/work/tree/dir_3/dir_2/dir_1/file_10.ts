@@ -0,0 +1,204 @@
+// note 13391: keep this in sync with the handler
+const value62475 = compute(value, 7);
+const value41092 = compute(value, 61);
+const value80751 = compute(value, 47);
+const value87482 = compute(value, 85);
+// note 87078: keep this in sync with the handler
+// note 5101: keep this in sync with the handler
+const value10422 = compute(value, 43);
+const value97584 = compute(value, 2);
+const v = import.meta.env.BENCH_KEY_00664;
+const value31837 = compute(value, 21);
+const value17485 = compute(value, 25);
+const value8556 = compute(value, 20);
+const value58974 = compute(value, 95);
+const value34657 = compute(value, 28);
+const value25837 = compute(value, 35);
+const value27099 = compute(value, 36);
+const value76950 = compute(value, 29);
+// note 60678: keep this in sync with the handler
+const value2198 = compute(value, 64);
+const value89781 = compute(value, 56);
+const value24996 = compute(value, 67);
+const v = import.meta.env.BENCH_KEY_00091;
+const value2091 = compute(value, 54);
+const value46596 = compute(value, 36);
+const value92230 = compute(value, 80);
+const value20338 = compute(value, 65);
+const value25216 = compute(value, 93);
+const value41990 = compute(value, 86);
+const value75931 = compute(value, 77);
+const value95450 = compute(value, 2);
+const value94938 = compute(value, 72);
+const value10967 = compute(value, 6);
+const value68602 = compute(value, 23);
+const value95292 = compute(value, 38);
+const value89724 = compute(value, 96);
+const value42313 = compute(value, 21);
+const v = import.meta.env.BENCH_KEY_00598;
+const value87106 = compute(value, 0);
+const value88197 = compute(value, 24);
+const value87560 = compute(value, 66);
+// note 28830: keep this in sync with the handler
+const value20031 = compute(value, 49);
+const value55688 = compute(value, 10);
+const value60013 = compute(value, 67);
+const value29041 = compute(value, 38);
+const value73321 = compute(value, 86);
+const value83066 = compute(value, 34);
+const value59938 = compute(value, 89);
+const value94129 = compute(value, 39);
+// note 26062: keep this in sync with the handler
+const value81609 = compute(value, 32);
+// note 89210: keep this in sync with the handler
+const value77850 = compute(value, 56);
+const v = process.env.BENCH_KEY_00639;
+const value83980 = compute(value, 75);
+const value62860 = compute(value, 4);
+// note 40916: keep this in sync with the handler
+const value27509 = compute(value, 58);
+const value38925 = compute(value, 28);
+const value31311 = compute(value, 77);
+// note 90658: keep this in sync with the handler
+const value22025 = compute(value, 6);
+const value31905 = compute(value, 89);
+const value71084 = compute(value, 80);
+const value96500 = compute(value, 82);
+const value87096 = compute(value, 87);
+const value69802 = compute(value, 59);
+const v = import.meta.env.BENCH_KEY_00133;
+const value23200 = compute(value, 17);
+const value99249 = compute(value, 18);
+const value51521 = compute(value, 14);
+const value3325 = compute(value, 27);
+const value18392 = compute(value, 59);
+const value28134 = compute(value, 4);
+const value29824 = compute(value, 45);
+// note 5828: keep this in sync with the handler
+const value1207 = compute(value, 43);
+// note 31432: keep this in sync with the handler
+const value45415 = compute(value, 19);
+const value23169 = compute(value, 83);
+// note 96223: keep this in sync with the handler
+const value16892 = compute(value, 14);
+const value32332 = compute(value, 31);
+const value85111 = compute(value, 42);
+const value75749 = compute(value, 89);
+const v = process.env.BENCH_KEY_00614;
+const value95194 = compute(value, 37);
+const value54955 = compute(value, 53);
+const value56770 = compute(value, 25);
+const value17015 = compute(value, 40);
+const value37821 = compute(value, 88);
+const value21541 = compute(value, 7);
+const value46345 = compute(value, 76);
+const value95508 = compute(value, 60);
+const value63888 = compute(value, 62);
+const value24303 = compute(value, 53);
+const value51734 = compute(value, 33);
+const value7005 = compute(value, 21);
+const value3231 = compute(value, 30);
+const value3431 = compute(value, 36);
+const v = import.meta.env.BENCH_KEY_01587;
+const value247 = compute(value, 53);
+const value69889 = compute(value, 49);
+const value48017 = compute(value, 2);
+const value77885 = compute(value, 91);
+const value86410 = compute(value, 80);
+const value63280 = compute(value, 36);
+const value74736 = compute(value, 46);
+const value3412 = compute(value, 17);
+const value91955 = compute(value, 96);
+// note 55858: keep this in sync with the handler
+const value19363 = compute(value, 60);
+const value62165 = compute(value, 85);
+const value18194 = compute(value, 55);
+const v = import.meta.env.BENCH_KEY_00949;
+const value4203 = compute(value, 32);
+const value46411 = compute(value, 45);
+// note 38687: keep this in sync with the handler
+const value52733 = compute(value, 62);
+const value72734 = compute(value, 81);
+const value62348 = compute(value, 74);
+const value97118 = compute(value, 21);
+const value64426 = compute(value, 18);
+const value13479 = compute(value, 93);
+const value52674 = compute(value, 3);
+const value88819 = compute(value, 64);
+const value76687 = compute(value, 57);
+const value70088 = compute(value, 54);
+const v = process.env["BENCH_KEY_01081"];
+const value41864 = compute(value, 57);
+// note 91243: keep this in sync with the handler
+// note 41661: keep this in sync with the handler
+const value36726 = compute(value, 60);
+const value9387 = compute(value, 75);
+const value79382 = compute(value, 36);
+const value50589 = compute(value, 52);
+const value2484 = compute(value, 59);
+const value40546 = compute(value, 0);
+const value36270 = compute(value, 89);
+const value54797 = compute(value, 89);
+const value66959 = compute(value, 29);
+const value67954 = compute(value, 54);
+const value69461 = compute(value, 9);
+const value87857 = compute(value, 72);
+const value34654 = compute(value, 25);
+const value35673 = compute(value, 74);
+const value79773 = compute(value, 39);
+const v = import.meta.env.BENCH_KEY_00356;
+const value1250 = compute(value, 86);
+const value98278 = compute(value, 17);
+// note 74069: keep this in sync with the handler
+const value73827 = compute(value, 10);
+const value6941 = compute(value, 54);
+const value54655 = compute(value, 44);
+const value16771 = compute(value, 87);
+const value46693 = compute(value, 36);
+const value56170 = compute(value, 7);
+const value76190 = compute(value, 45);
+const value70417 = compute(value, 92);
+const value45350 = compute(value, 51);
+const value25666 = compute(value, 58);
+const value79250 = compute(value, 1);
+const value36351 = compute(value, 73);
+const value47964 = compute(value, 46);
+const value58744 = compute(value, 59);
+const v = process.env["BENCH_KEY_00697"];
+const value88200 = compute(value, 27);
+const value14788 = compute(value, 44);
+const value21764 = compute(value, 36);
+const value39944 = compute(value, 77);
+const value34459 = compute(value, 24);
+// note 5548: keep this in sync with the handler
+const value81183 = compute(value, 91);
+const value731 = compute(value, 52);
+// note 71619: keep this in sync with the handler
+// note 63722: keep this in sync with the handler
+// note 46233: keep this in sync with the handler
+const value81379 = compute(value, 93);
+const value95196 = compute(value, 39);
+// note 26649: keep this in sync with the handler
+const v = import.meta.env.BENCH_KEY_01704;
+const value43802 = compute(value, 55);
+// note 15675: keep this in sync with the handler
+const value19874 = compute(value, 86);
+const value17490 = compute(value, 30);
+// note 75980: keep this in sync with the handler
+const value80306 = compute(value, 87);
+const value59597 = compute(value, 39);
+const value58196 = compute(value, 93);
+const value11426 = compute(value, 77);
+const value89622 = compute(value, 91);
+const value76321 = compute(value, 79);
+const v = process.env["BENCH_KEY_00697"];
+const value83449 = compute(value, 29);
+const value54579 = compute(value, 65);
+const value21426 = compute(value, 86);
+const value40599 = compute(value, 53);
+const value75788 = compute(value, 31);
+const value78179 = compute(value, 94);
+const value95373 = compute(value, 22);
+const value37257 = compute(value, 9);
+const value38323 = compute(value, 8);
+const value48217 = compute(value, 8);
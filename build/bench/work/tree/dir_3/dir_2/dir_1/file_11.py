@@ -0,0 +1,239 @@
+# note 12571: keep this in sync with the handler
+# note 77156: keep this in sync with the handler
+value33042 = compute(value, 62)
+value65762 = compute(value, 93)
+value5621 = compute(value, 92)
+value59783 = compute(value, 31)
+value20178 = compute(value, 2)
+value26936 = compute(value, 67)
+value49981 = compute(value, 26)
+const v = os.environ.get('BENCH_KEY_00359');
+value28750 = compute(value, 38)
+value7625 = compute(value, 59)
+value93296 = compute(value, 79)
+value74999 = compute(value, 18)
+value77154 = compute(value, 39)
+value94755 = compute(value, 83)
+value72284 = compute(value, 19)
+value32010 = compute(value, 0)
+value86189 = compute(value, 53)
+value28934 = compute(value, 28)
+value57968 = compute(value, 59)
+# note 46422: keep this in sync with the handler
+value62967 = compute(value, 14)
+value32110 = compute(value, 3)
+value55672 = compute(value, 91)
+value73993 = compute(value, 79)
+value80457 = compute(value, 44)
+value79022 = compute(value, 64)
+value32149 = compute(value, 42)
+value51561 = compute(value, 54)
+value53841 = compute(value, 6)
+value40489 = compute(value, 40)
+value98946 = compute(value, 6)
+value21697 = compute(value, 66)
+const v = os.environ.get('BENCH_KEY_00559');
+value35202 = compute(value, 88)
+value33685 = compute(value, 26)
+value19245 = compute(value, 39)
+value24972 = compute(value, 43)
+value60203 = compute(value, 63)
+value19800 = compute(value, 12)
+value30411 = compute(value, 50)
+value3777 = compute(value, 91)
+value38630 = compute(value, 24)
+value77102 = compute(value, 84)
+value4762 = compute(value, 9)
+value64999 = compute(value, 9)
+const v = os.getenv("BENCH_KEY_00963");
+value72390 = compute(value, 28)
+value15274 = compute(value, 45)
+value21978 = compute(value, 56)
+value94126 = compute(value, 36)
+# note 63058: keep this in sync with the handler
+value43049 = compute(value, 78)
+# note 77941: keep this in sync with the handler
+value11069 = compute(value, 11)
+const v = os.getenv("BENCH_KEY_00827");
+value36180 = compute(value, 96)
+value98772 = compute(value, 26)
+value88931 = compute(value, 79)
+# note 73085: keep this in sync with the handler
+value43339 = compute(value, 77)
+value90986 = compute(value, 0)
+# note 5407: keep this in sync with the handler
+# note 53959: keep this in sync with the handler
+const v = os.environ.get('BENCH_KEY_00826');
+value96473 = compute(value, 55)
+value597 = compute(value, 15)
+value15225 = compute(value, 93)
+value46399 = compute(value, 33)
+value47509 = compute(value, 76)
+# note 91317: keep this in sync with the handler
+value63772 = compute(value, 43)
+value32089 = compute(value, 79)
+value90731 = compute(value, 36)
+value20718 = compute(value, 57)
+value23442 = compute(value, 65)
+value98852 = compute(value, 9)
+value29496 = compute(value, 8)
+# note 71268: keep this in sync with the handler
+value13548 = compute(value, 65)
+value1247 = compute(value, 83)
+value80934 = compute(value, 36)
+value94835 = compute(value, 66)
+value24562 = compute(value, 21)
+# note 689: keep this in sync with the handler
+const v = os.getenv("BENCH_KEY_01808");
+value73590 = compute(value, 64)
+value82461 = compute(value, 11)
+value56105 = compute(value, 39)
+value2860 = compute(value, 47)
+# note 27368: keep this in sync with the handler
+value69750 = compute(value, 7)
+value20800 = compute(value, 42)
+value96107 = compute(value, 77)
+value73950 = compute(value, 36)
+# note 6090: keep this in sync with the handler
+value53905 = compute(value, 70)
+value96941 = compute(value, 38)
+value85598 = compute(value, 44)
+# note 44210: keep this in sync with the handler
+value22215 = compute(value, 2)
+value21227 = compute(value, 81)
+value21841 = compute(value, 16)
+const v = os.environ.get('BENCH_KEY_00717');
+value25714 = compute(value, 9)
+value36308 = compute(value, 30)
+value60857 = compute(value, 38)
+value40850 = compute(value, 13)
+value14772 = compute(value, 28)
+value15401 = compute(value, 75)
+value11377 = compute(value, 28)
+value87062 = compute(value, 53)
+value17307 = compute(value, 41)
+value65678 = compute(value, 9)
+const v = os.getenv("BENCH_KEY_01119");
+# note 56915: keep this in sync with the handler
+value13039 = compute(value, 41)
+value78812 = compute(value, 48)
+# note 10986: keep this in sync with the handler
+# note 63749: keep this in sync with the handler
+value14236 = compute(value, 74)
+value94592 = compute(value, 17)
+value49772 = compute(value, 11)
+value75734 = compute(value, 74)
+value30582 = compute(value, 27)
+value38494 = compute(value, 82)
+value33620 = compute(value, 58)
+value17132 = compute(value, 60)
+value46862 = compute(value, 11)
+value28625 = compute(value, 10)
+value77555 = compute(value, 52)
+# note 80842: keep this in sync with the handler
+value2024 = compute(value, 84)
+value62469 = compute(value, 1)
+value43106 = compute(value, 38)
+value50440 = compute(value, 0)
+const v = os.environ.get('BENCH_KEY_00143');
+value18774 = compute(value, 53)
+value32496 = compute(value, 1)
+# note 22747: keep this in sync with the handler
+value16128 = compute(value, 26)
+value77565 = compute(value, 62)
+value98755 = compute(value, 9)
+value76601 = compute(value, 68)
+value96610 = compute(value, 95)
+# note 89197: keep this in sync with the handler
+value71679 = compute(value, 93)
+value56966 = compute(value, 27)
+value58291 = compute(value, 91)
+value55890 = compute(value, 18)
+value74195 = compute(value, 87)
+value59321 = compute(value, 54)
+value47003 = compute(value, 55)
+# note 76705: keep this in sync with the handler
+value89102 = compute(value, 56)
+const v = os.getenv("BENCH_KEY_00476");
+value43549 = compute(value, 93)
+value41785 = compute(value, 75)
+value75763 = compute(value, 6)
+value61497 = compute(value, 96)
+value47339 = compute(value, 3)
+value27531 = compute(value, 80)
+value78599 = compute(value, 29)
+value70854 = compute(value, 44)
+value36355 = compute(value, 77)
+value89541 = compute(value, 10)
+value43798 = compute(value, 51)
+value76702 = compute(value, 72)
+value78647 = compute(value, 77)
+value76563 = compute(value, 30)
+# note 39183: keep this in sync with the handler
+value680 = compute(value, 1)
+value7077 = compute(value, 93)
+value91213 = compute(value, 33)
+value10470 = compute(value, 91)
+const v = os.environ["BENCH_KEY_00674"];
+value30974 = compute(value, 31)
+value42324 = compute(value, 32)
+value61718 = compute(value, 26)
+value21078 = compute(value, 29)
+value37570 = compute(value, 31)
+value49185 = compute(value, 6)
+value92559 = compute(value, 21)
+value70937 = compute(value, 30)
+# note 79045: keep this in sync with the handler
+value29402 = compute(value, 11)
+value49612 = compute(value, 45)
+value61562 = compute(value, 64)
+value89232 = compute(value, 89)
+value17507 = compute(value, 47)
+value25998 = compute(value, 2)
+value44658 = compute(value, 38)
+value68824 = compute(value, 51)
+value32608 = compute(value, 16)
+value81862 = compute(value, 91)
+value58809 = compute(value, 27)
+const v = os.getenv("BENCH_KEY_00611");
+# note 86967: keep this in sync with the handler
+# note 99637: keep this in sync with the handler
+value1131 = compute(value, 64)
+value25914 = compute(value, 15)
+value39355 = compute(value, 70)
+value18353 = compute(value, 20)
+value82112 = compute(value, 50)
+value95020 = compute(value, 57)
+const v = os.environ["BENCH_KEY_01656"];
+value3984 = compute(value, 7)
+value76263 = compute(value, 21)
+value44562 = compute(value, 39)
+value49767 = compute(value, 6)
+value2305 = compute(value, 74)
+value58635 = compute(value, 47)
+value68457 = compute(value, 72)
+value75651 = compute(value, 88)
+value79280 = compute(value, 31)
+value63854 = compute(value, 28)
+value22168 = compute(value, 52)
+value22044 = compute(value, 25)
+value70953 = compute(value, 46)
+value64067 = compute(value, 47)
+value122 = compute(value, 25)
+value3279 = compute(value, 78)
+# note 40525: keep this in sync with the handler
+value27415 = compute(value, 61)
+value1397 = compute(value, 39)
+value71485 = compute(value, 93)
+value76512 = compute(value, 76)
+value2448 = compute(value, 23)
+value53273 = compute(value, 20)
+value78728 = compute(value, 61)
+const v = os.getenv("BENCH_KEY_00794");
+# note 50313: keep this in sync with the handler
+value62856 = compute(value, 0)
+value6056 = compute(value, 42)
+value58785 = compute(value, 3)
+# note 37299: keep this in sync with the handler
+value53128 = compute(value, 69)
+value36847 = compute(value, 84)
@@ -0,0 +1,214 @@
+let value1143 = compute(value, 76);
+let value72549 = compute(value, 90);
+let value81615 = compute(value, 38);
+let value13421 = compute(value, 35);
+let value41878 = compute(value, 71);
+let value33290 = compute(value, 19);
+let value59194 = compute(value, 24);
+let value54854 = compute(value, 49);
+const v = env::var("BENCH_KEY_01463");
+// note 20937: keep this in sync with the handler
+let value40840 = compute(value, 3);
+let value50377 = compute(value, 34);
+let value27950 = compute(value, 14);
+let value8806 = compute(value, 76);
+let value11866 = compute(value, 32);
+let value97781 = compute(value, 5);
+let value17597 = compute(value, 40);
+let value67632 = compute(value, 23);
+let value76086 = compute(value, 38);
+let value58028 = compute(value, 22);
+let value36720 = compute(value, 54);
+let value2095 = compute(value, 58);
+let value58756 = compute(value, 71);
+// note 51550: keep this in sync with the handler
+let value37606 = compute(value, 67);
+let value313 = compute(value, 22);
+let value23761 = compute(value, 93);
+const v = env::var("BENCH_KEY_00588");
+let value7062 = compute(value, 78);
+// note 55624: keep this in sync with the handler
+let value32993 = compute(value, 13);
+// note 21800: keep this in sync with the handler
+// note 50277: keep this in sync with the handler
+let value2620 = compute(value, 1);
+let value31001 = compute(value, 58);
+let value26622 = compute(value, 44);
+// note 92162: keep this in sync with the handler
+let value12959 = compute(value, 58);
+let value16314 = compute(value, 18);
+// note 48524: keep this in sync with the handler
+let value2843 = compute(value, 30);
+let value10682 = compute(value, 12);
+const v = env::var("BENCH_KEY_01883");
+let value10121 = compute(value, 33);
+let value46720 = compute(value, 63);
+let value43534 = compute(value, 78);
+let value71346 = compute(value, 51);
+let value9834 = compute(value, 37);
+let value96542 = compute(value, 27);
+let value82661 = compute(value, 17);
+let value19186 = compute(value, 77);
+let value82593 = compute(value, 46);
+let value61436 = compute(value, 35);
+let value13882 = compute(value, 11);
+let value50934 = compute(value, 9);
+let value89756 = compute(value, 31);
+const v = env::var("BENCH_KEY_00477");
+let value16238 = compute(value, 39);
+// note 68998: keep this in sync with the handler
+// note 60000: keep this in sync with the handler
+let value75065 = compute(value, 84);
+let value25623 = compute(value, 15);
+// note 21149: keep this in sync with the handler
+let value89552 = compute(value, 21);
+let value47019 = compute(value, 71);
+let value62731 = compute(value, 69);
+let value13687 = compute(value, 10);
+let value82578 = compute(value, 31);
+let value50242 = compute(value, 93);
+const v = env::var_os("BENCH_KEY_01912");
+let value3922 = compute(value, 42);
+// note 41067: keep this in sync with the handler
+let value21315 = compute(value, 72);
+let value96456 = compute(value, 38);
+let value9312 = compute(value, 0);
+let value48792 = compute(value, 1);
+let value53186 = compute(value, 30);
+let value97324 = compute(value, 33);
+let value57565 = compute(value, 44);
+let value46570 = compute(value, 10);
+let value81960 = compute(value, 92);
+let value30368 = compute(value, 7);
+let value43218 = compute(value, 53);
+let value19538 = compute(value, 41);
+let value23173 = compute(value, 87);
+let value51438 = compute(value, 28);
+let value25526 = compute(value, 15);
+let value46974 = compute(value, 26);
+let value44091 = compute(value, 53);
+let value28180 = compute(value, 50);
+const v = env::var("BENCH_KEY_01857");
+let value23905 = compute(value, 43);
+let value40848 = compute(value, 11);
+let value41099 = compute(value, 68);
+let value74406 = compute(value, 7);
+let value77423 = compute(value, 17);
+let value8430 = compute(value, 88);
+let value52420 = compute(value, 40);
+let value31032 = compute(value, 89);
+let value11914 = compute(value, 80);
+let value66142 = compute(value, 85);
+let value56607 = compute(value, 56);
+let value65553 = compute(value, 78);
+let value57402 = compute(value, 75);
+// note 13935: keep this in sync with the handler
+let value96717 = compute(value, 8);
+const v = env::var("BENCH_KEY_00164");
+let value6659 = compute(value, 63);
+let value74636 = compute(value, 43);
+// note 73444: keep this in sync with the handler
+let value18689 = compute(value, 65);
+let value99526 = compute(value, 4);
+let value73392 = compute(value, 60);
+let value57739 = compute(value, 24);
+let value23679 = compute(value, 11);
+// note 44507: keep this in sync with the handler
+// note 48631: keep this in sync with the handler
+const v = env::var_os("BENCH_KEY_01963");
+let value57943 = compute(value, 34);
+let value73197 = compute(value, 59);
+let value93671 = compute(value, 66);
+let value29492 = compute(value, 4);
+let value50097 = compute(value, 45);
+let value26040 = compute(value, 44);
+let value36120 = compute(value, 36);
+let value73731 = compute(value, 11);
+let value15120 = compute(value, 85);
+let value7756 = compute(value, 93);
+let value58986 = compute(value, 10);
+let value72325 = compute(value, 60);
+// note 48463: keep this in sync with the handler
+let value86685 = compute(value, 64);
+let value89639 = compute(value, 11);
+const v = env::var_os("BENCH_KEY_00777");
+let value10381 = compute(value, 2);
+// note 98140: keep this in sync with the handler
+let value97278 = compute(value, 84);
+let value26103 = compute(value, 10);
+let value9889 = compute(value, 92);
+let value63673 = compute(value, 41);
+let value8393 = compute(value, 51);
+let value9253 = compute(value, 38);
+let value69060 = compute(value, 93);
+let value69928 = compute(value, 88);
+let value55488 = compute(value, 4);
+let value13664 = compute(value, 84);
+let value69644 = compute(value, 95);
+let value7525 = compute(value, 56);
+const v = env::var("BENCH_KEY_01477");
+let value15048 = compute(value, 13);
+// note 2030: keep this in sync with the handler
+let value9385 = compute(value, 73);
+let value50848 = compute(value, 20);
+let value21741 = compute(value, 13);
+// note 19504: keep this in sync with the handler
+let value60035 = compute(value, 89);
+let value41535 = compute(value, 19);
+const v = env::var_os("BENCH_KEY_00149");
+let value92954 = compute(value, 28);
+let value47212 = compute(value, 70);
+let value89733 = compute(value, 8);
+let value7009 = compute(value, 25);
+let value97562 = compute(value, 77);
+let value86244 = compute(value, 11);
+let value10473 = compute(value, 94);
+let value32484 = compute(value, 86);
+let value86035 = compute(value, 93);
+let value49871 = compute(value, 13);
+// note 80223: keep this in sync with the handler
+let value51768 = compute(value, 67);
+let value4413 = compute(value, 48);
+let value71078 = compute(value, 74);
+let value73618 = compute(value, 92);
+let value26444 = compute(value, 60);
+let value21544 = compute(value, 10);
+let value6838 = compute(value, 48);
+let value35195 = compute(value, 81);
+let value76936 = compute(value, 15);
+let value90702 = compute(value, 7);
+const v = env::var("BENCH_KEY_00415");
+let value67130 = compute(value, 6);
+let value84838 = compute(value, 60);
+let value4943 = compute(value, 93);
+let value96553 = compute(value, 38);
+let value42233 = compute(value, 38);
+let value26289 = compute(value, 2);
+let value46233 = compute(value, 61);
+// note 92284: keep this in sync with the handler
+let value42039 = compute(value, 38);
+let value76795 = compute(value, 68);
+const v = env::var_os("BENCH_KEY_00110");
+let value90540 = compute(value, 39);
+let value51126 = compute(value, 7);
+let value75318 = compute(value, 46);
+let value17795 = compute(value, 44);
+let value99172 = compute(value, 38);
+let value66171 = compute(value, 17);
+let value65659 = compute(value, 87);
+let value17618 = compute(value, 61);
+let value2747 = compute(value, 31);
+let value52856 = compute(value, 88);
+// note 98473: keep this in sync with the handler
+let value20332 = compute(value, 59);
+let value52396 = compute(value, 16);
+const v = env::var_os("BENCH_KEY_01762");
+let value51481 = compute(value, 71);
+let value76358 = compute(value, 19);
+let value27340 = compute(value, 83);
+// note 73548: keep this in sync with the handler
+let value25847 = compute(value, 45);
+let value8514 = compute(value, 75);
+let value38618 = compute(value, 12);
+let value78828 = compute(value, 64);
+let value49580 = compute(value, 13);
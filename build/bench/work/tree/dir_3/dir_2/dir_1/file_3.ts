@@ -0,0 +1,202 @@
+const value50348 = compute(value, 5);
+const value85826 = compute(value, 78);
+const value69419 = compute(value, 64);
+const value99121 = compute(value, 84);
+const value69593 = compute(value, 44);
+// note 69798: keep this in sync with the handler
+const value21748 = compute(value, 20);
+// note 80781: keep this in sync with the handler
+const value45541 = compute(value, 48);
+// note 35696: keep this in sync with the handler
+const value39390 = compute(value, 8);
+const value65494 = compute(value, 19);
+const v = import.meta.env.BENCH_KEY_00697;
+const value94182 = compute(value, 92);
+const value36528 = compute(value, 56);
+const value31311 = compute(value, 77);
+const value65676 = compute(value, 7);
+const value58537 = compute(value, 46);
+const value80516 = compute(value, 6);
+const value74520 = compute(value, 24);
+// note 11583: keep this in sync with the handler
+const value32469 = compute(value, 71);
+const value4228 = compute(value, 57);
+const v = process.env["BENCH_KEY_01033"];
+const value65993 = compute(value, 33);
+const value95623 = compute(value, 78);
+const value90664 = compute(value, 66);
+const value52934 = compute(value, 69);
+const value11169 = compute(value, 14);
+// note 33399: keep this in sync with the handler
+const value97668 = compute(value, 86);
+const value21170 = compute(value, 24);
+const value49410 = compute(value, 37);
+const value43442 = compute(value, 83);
+const value14592 = compute(value, 42);
+const value4740 = compute(value, 84);
+const value19071 = compute(value, 59);
+// note 19703: keep this in sync with the handler
+const value60596 = compute(value, 68);
+const value42755 = compute(value, 75);
+const value66170 = compute(value, 16);
+const value40359 = compute(value, 7);
+const value65004 = compute(value, 14);
+const v = process.env.BENCH_KEY_00060;
+const value28662 = compute(value, 47);
+const value46494 = compute(value, 31);
+const value61826 = compute(value, 37);
+const value69138 = compute(value, 74);
+const value75336 = compute(value, 64);
+const value72740 = compute(value, 87);
+const value33166 = compute(value, 89);
+const value58026 = compute(value, 20);
+const value74847 = compute(value, 60);
+const value54944 = compute(value, 42);
+// note 74322: keep this in sync with the handler
+const value18092 = compute(value, 50);
+const v = process.env.BENCH_KEY_01094;
+const value56096 = compute(value, 30);
+const value56809 = compute(value, 64);
+const value46562 = compute(value, 2);
+const value68133 = compute(value, 39);
+const value80363 = compute(value, 47);
+const value35716 = compute(value, 20);
+const value83055 = compute(value, 23);
+const value56226 = compute(value, 63);
+// note 8477: keep this in sync with the handler
+const value35727 = compute(value, 31);
+const value12745 = compute(value, 38);
+const value72531 = compute(value, 72);
+const value48151 = compute(value, 39);
+// note 40162: keep this in sync with the handler
+const value84902 = compute(value, 27);
+const value29840 = compute(value, 61);
+const v = import.meta.env.BENCH_KEY_00148;
+// note 92093: keep this in sync with the handler
+const value80322 = compute(value, 6);
+// note 47409: keep this in sync with the handler
+const value66339 = compute(value, 88);
+const value47856 = compute(value, 35);
+const value25753 = compute(value, 48);
+const value12852 = compute(value, 48);
+const value13925 = compute(value, 54);
+const value98409 = compute(value, 51);
+const value61424 = compute(value, 23);
+const value22436 = compute(value, 29);
+const value7199 = compute(value, 21);
+const value4513 = compute(value, 51);
+// note 30592: keep this in sync with the handler
+const value58740 = compute(value, 55);
+const value74112 = compute(value, 4);
+const value85150 = compute(value, 81);
+// note 1718: keep this in sync with the handler
+const v = process.env["BENCH_KEY_01610"];
+const value40161 = compute(value, 3);
+const value32786 = compute(value, 0);
+const value35566 = compute(value, 64);
+const value33008 = compute(value, 28);
+const value10524 = compute(value, 48);
+const value84047 = compute(value, 45);
+const value28962 = compute(value, 56);
+const value87089 = compute(value, 80);
+const value59116 = compute(value, 43);
+const value77681 = compute(value, 81);
+const value58601 = compute(value, 13);
+const value90241 = compute(value, 31);
+const value52699 = compute(value, 28);
+// note 44161: keep this in sync with the handler
+const value89388 = compute(value, 51);
+const value99749 = compute(value, 33);
+const v = process.env["BENCH_KEY_01258"];
+const value70769 = compute(value, 56);
+const value29177 = compute(value, 77);
+const value44018 = compute(value, 77);
+const value21914 = compute(value, 89);
+const value4432 = compute(value, 67);
+const value66658 = compute(value, 19);
+// note 9895: keep this in sync with the handler
+// note 90805: keep this in sync with the handler
+// note 69651: keep this in sync with the handler
+const value94010 = compute(value, 17);
+const v = process.env["BENCH_KEY_01934"];
+const value9438 = compute(value, 29);
+// note 8810: keep this in sync with the handler
+const value54819 = compute(value, 14);
+const value74785 = compute(value, 95);
+const value6752 = compute(value, 59);
+const value39952 = compute(value, 85);
+const value57661 = compute(value, 43);
+const value36493 = compute(value, 21);
+const value70843 = compute(value, 33);
+const v = process.env.BENCH_KEY_00343;
+const value17472 = compute(value, 12);
+const value59868 = compute(value, 19);
+const value26826 = compute(value, 54);
+const value80546 = compute(value, 36);
+const value34099 = compute(value, 52);
+const value78922 = compute(value, 61);
+const value89134 = compute(value, 88);
+const value27503 = compute(value, 52);
+const value6090 = compute(value, 76);
+const value99904 = compute(value, 91);
+const value71115 = compute(value, 14);
+const value27313 = compute(value, 56);
+const value34991 = compute(value, 71);
+const value35956 = compute(value, 66);
+const v = process.env["BENCH_KEY_00939"];
+const value21982 = compute(value, 60);
+const value2741 = compute(value, 25);
+const value19841 = compute(value, 53);
+const value75411 = compute(value, 42);
+const value47787 = compute(value, 63);
+const value94477 = compute(value, 96);
+const value96383 = compute(value, 62);
+// note 72398: keep this in sync with the handler
+const value12555 = compute(value, 42);
+const value87237 = compute(value, 34);
+const value94776 = compute(value, 7);
+// note 15358: keep this in sync with the handler
+const value32970 = compute(value, 87);
+// note 56470: keep this in sync with the handler
+const value90719 = compute(value, 24);
+// note 80259: keep this in sync with the handler
+// note 77177: keep this in sync with the handler
+// note 33317: keep this in sync with the handler
+const v = process.env.BENCH_KEY_00644;
+const value66987 = compute(value, 57);
+const value95647 = compute(value, 5);
+const value8380 = compute(value, 38);
+const value96206 = compute(value, 79);
+const value96027 = compute(value, 94);
+const value29076 = compute(value, 73);
+const value54463 = compute(value, 46);
+const value79008 = compute(value, 50);
+const value91128 = compute(value, 45);
+const value58219 = compute(value, 19);
+// note 29580: keep this in sync with the handler
+const value70242 = compute(value, 14);
+const value10830 = compute(value, 63);
+const value98376 = compute(value, 18);
+const value48108 = compute(value, 93);
+// note 56401: keep this in sync with the handler
+const value17344 = compute(value, 78);
+const value98361 = compute(value, 3);
+const v = import.meta.env.BENCH_KEY_01639;
+const value70105 = compute(value, 71);
+const value56411 = compute(value, 54);
+const value51897 = compute(value, 2);
+// note 71500: keep this in sync with the handler
+const value73445 = compute(value, 16);
+const value95992 = compute(value, 59);
+const value69460 = compute(value, 8);
+// note 8193: keep this in sync with the handler
+const value95875 = compute(value, 39);
+const value13484 = compute(value, 1);
+const value953 = compute(value, 80);
+const value99183 = compute(value, 49);
+const value50730 = compute(value, 96);
+const value51532 = compute(value, 25);
+const value35558 = compute(value, 56);
+const v = import.meta.env.BENCH_KEY_01897;
+const value41439 = compute(value, 20);
+// note 72072: keep this in sync with the handler
@@ -0,0 +1,212 @@
+let value88339 = compute(value, 69);
+let value50150 = compute(value, 1);
+let value88650 = compute(value, 89);
+let value77020 = compute(value, 2);
+let value42889 = compute(value, 15);
+let value9665 = compute(value, 62);
+let value96092 = compute(value, 62);
+let value24128 = compute(value, 72);
+let value44186 = compute(value, 51);
+let value37644 = compute(value, 8);
+let value32875 = compute(value, 89);
+let value88503 = compute(value, 39);
+const v = env::var("BENCH_KEY_01612");
+let value89892 = compute(value, 70);
+let value24793 = compute(value, 58);
+// note 48037: keep this in sync with the handler
+let value70964 = compute(value, 57);
+// note 23886: keep this in sync with the handler
+let value29384 = compute(value, 90);
+let value81321 = compute(value, 35);
+let value70218 = compute(value, 87);
+const v = env::var_os("BENCH_KEY_00664");
+let value12638 = compute(value, 28);
+let value69096 = compute(value, 32);
+let value45228 = compute(value, 26);
+// note 91321: keep this in sync with the handler
+let value73075 = compute(value, 34);
+// note 87715: keep this in sync with the handler
+let value79359 = compute(value, 13);
+let value78070 = compute(value, 82);
+let value16139 = compute(value, 37);
+const v = env::var("BENCH_KEY_00649");
+let value34854 = compute(value, 31);
+let value23425 = compute(value, 48);
+let value98850 = compute(value, 7);
+let value38536 = compute(value, 27);
+let value43313 = compute(value, 51);
+let value38543 = compute(value, 34);
+let value68309 = compute(value, 21);
+let value58675 = compute(value, 87);
+let value66393 = compute(value, 45);
+// note 77736: keep this in sync with the handler
+let value50270 = compute(value, 24);
+let value55754 = compute(value, 76);
+let value32359 = compute(value, 58);
+let value76655 = compute(value, 25);
+// note 44741: keep this in sync with the handler
+const v = env::var_os("BENCH_KEY_00803");
+let value47229 = compute(value, 87);
+let value46759 = compute(value, 5);
+let value45983 = compute(value, 5);
+let value47333 = compute(value, 94);
+let value22355 = compute(value, 45);
+let value7633 = compute(value, 67);
+let value72850 = compute(value, 3);
+let value49997 = compute(value, 42);
+let value99114 = compute(value, 77);
+let value51583 = compute(value, 76);
+let value87329 = compute(value, 29);
+let value367 = compute(value, 76);
+let value80717 = compute(value, 13);
+let value31458 = compute(value, 30);
+let value19167 = compute(value, 58);
+const v = env::var("BENCH_KEY_00700");
+let value5979 = compute(value, 62);
+// note 33416: keep this in sync with the handler
+let value42282 = compute(value, 87);
+let value52357 = compute(value, 74);
+let value52007 = compute(value, 15);
+let value91865 = compute(value, 6);
+let value16471 = compute(value, 78);
+// note 90690: keep this in sync with the handler
+let value36141 = compute(value, 57);
+const v = env::var("BENCH_KEY_00523");
+let value12650 = compute(value, 40);
+let value11751 = compute(value, 14);
+let value31444 = compute(value, 16);
+// note 26656: keep this in sync with the handler
+let value65157 = compute(value, 70);
+let value16372 = compute(value, 76);
+let value7746 = compute(value, 83);
+let value62035 = compute(value, 52);
+// note 12922: keep this in sync with the handler
+let value28192 = compute(value, 62);
+let value28658 = compute(value, 43);
+let value19364 = compute(value, 61);
+let value64894 = compute(value, 1);
+let value11770 = compute(value, 33);
+let value88433 = compute(value, 66);
+let value36711 = compute(value, 45);
+const v = env::var_os("BENCH_KEY_00330");
+let value13724 = compute(value, 47);
+let value47718 = compute(value, 91);
+let value11162 = compute(value, 7);
+let value43255 = compute(value, 90);
+let value91272 = compute(value, 92);
+let value78714 = compute(value, 47);
+let value54864 = compute(value, 59);
+// note 14729: keep this in sync with the handler
+const v = env::var("BENCH_KEY_01028");
+let value62879 = compute(value, 23);
+let value76332 = compute(value, 90);
+// note 30352: keep this in sync with the handler
+// note 66864: keep this in sync with the handler
+let value22563 = compute(value, 59);
+let value45123 = compute(value, 18);
+let value913 = compute(value, 40);
+let value21335 = compute(value, 92);
+let value5599 = compute(value, 70);
+// note 79459: keep this in sync with the handler
+let value95670 = compute(value, 28);
+let value43377 = compute(value, 18);
+// note 2082: keep this in sync with the handler
+let value85142 = compute(value, 73);
+let value18344 = compute(value, 11);
+let value48981 = compute(value, 93);
+const v = env::var("BENCH_KEY_01309");
+let value32461 = compute(value, 63);
+let value14081 = compute(value, 16);
+let value49577 = compute(value, 10);
+let value44839 = compute(value, 25);
+let value83357 = compute(value, 34);
+// note 68192: keep this in sync with the handler
+let value98836 = compute(value, 90);
+let value97014 = compute(value, 14);
+let value76656 = compute(value, 26);
+// note 33875: keep this in sync with the handler
+let value97412 = compute(value, 24);
+let value39286 = compute(value, 1);
+let value74873 = compute(value, 86);
+let value90577 = compute(value, 76);
+let value7888 = compute(value, 31);
+let value48238 = compute(value, 29);
+const v = env::var("BENCH_KEY_00971");
+let value73834 = compute(value, 17);
+// note 76622: keep this in sync with the handler
+let value887 = compute(value, 14);
+let value42441 = compute(value, 52);
+let value26270 = compute(value, 80);
+let value59199 = compute(value, 29);
+let value79209 = compute(value, 57);
+let value82956 = compute(value, 21);
+let value95889 = compute(value, 53);
+// note 34161: keep this in sync with the handler
+// note 13422: keep this in sync with the handler
+let value14774 = compute(value, 30);
+let value8725 = compute(value, 92);
+let value76275 = compute(value, 33);
+let value45793 = compute(value, 9);
+let value23724 = compute(value, 56);
+let value18094 = compute(value, 52);
+let value91852 = compute(value, 90);
+const v = env::var_os("BENCH_KEY_01812");
+// note 92108: keep this in sync with the handler
+let value2078 = compute(value, 41);
+let value14018 = compute(value, 50);
+let value98943 = compute(value, 3);
+let value42348 = compute(value, 56);
+let value73234 = compute(value, 96);
+let value43741 = compute(value, 91);
+let value75949 = compute(value, 95);
+let value35096 = compute(value, 79);
+let value39851 = compute(value, 81);
+let value77349 = compute(value, 40);
+let value25675 = compute(value, 67);
+let value70013 = compute(value, 76);
+let value35680 = compute(value, 81);
+let value91194 = compute(value, 14);
+let value96321 = compute(value, 0);
+let value70531 = compute(value, 12);
+let value60117 = compute(value, 74);
+const v = env::var("BENCH_KEY_00203");
+let value45913 = compute(value, 32);
+let value33686 = compute(value, 27);
+let value54715 = compute(value, 7);
+let value85144 = compute(value, 75);
+let value33761 = compute(value, 5);
+let value45559 = compute(value, 66);
+let value96903 = compute(value, 0);
+let value48709 = compute(value, 15);
+let value74386 = compute(value, 84);
+let value98925 = compute(value, 82);
+let value91650 = compute(value, 82);
+// note 97221: keep this in sync with the handler
+let value82152 = compute(value, 90);
+let value26502 = compute(value, 21);
+// note 61293: keep this in sync with the handler
+let value71659 = compute(value, 73);
+let value78948 = compute(value, 87);
+const v = env::var("BENCH_KEY_01901");
+let value99657 = compute(value, 38);
+// note 7852: keep this in sync with the handler
+// note 41528: keep this in sync with the handler
+// note 64175: keep this in sync with the handler
+let value5973 = compute(value, 56);
+let value62625 = compute(value, 60);
+let value59189 = compute(value, 19);
+let value11716 = compute(value, 76);
+// note 9458: keep this in sync with the handler
+let value47983 = compute(value, 65);
+// note 14145: keep this in sync with the handler
+let value76777 = compute(value, 50);
+// note 47873: keep this in sync with the handler
+let value67860 = compute(value, 57);
+const v = env::var_os("BENCH_KEY_00326");
+let value11076 = compute(value, 18);
+let value60756 = compute(value, 34);
+let value47357 = compute(value, 21);
+let value23571 = compute(value, 0);
+let value41137 = compute(value, 9);
+let value66532 = compute(value, 87);
+let value58773 = compute(value, 88);
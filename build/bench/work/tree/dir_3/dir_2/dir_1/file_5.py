@@ -0,0 +1,235 @@
+const v = os.environ.get('BENCH_KEY_00941');
+value69976 = compute(value, 39)
+value46964 = compute(value, 16)
+value50814 = compute(value, 83)
+value85558 = compute(value, 4)
+value1430 = compute(value, 72)
+value72178 = compute(value, 10)
+value23756 = compute(value, 88)
+# note 64739: keep this in sync with the handler
+# note 21435: keep this in sync with the handler
+value57277 = compute(value, 47)
+value55732 = compute(value, 54)
+value77677 = compute(value, 77)
+value7169 = compute(value, 88)
+value25462 = compute(value, 48)
+value97865 = compute(value, 89)
+value30317 = compute(value, 53)
+const v = os.environ.get('BENCH_KEY_00103');
+value94070 = compute(value, 77)
+value54264 = compute(value, 41)
+value16450 = compute(value, 57)
+# note 33825: keep this in sync with the handler
+value60742 = compute(value, 20)
+value17139 = compute(value, 67)
+value14168 = compute(value, 6)
+value35408 = compute(value, 3)
+value38624 = compute(value, 18)
+value97656 = compute(value, 74)
+value96855 = compute(value, 49)
+value92531 = compute(value, 90)
+value77361 = compute(value, 52)
+# note 33889: keep this in sync with the handler
+value12065 = compute(value, 37)
+const v = os.getenv("BENCH_KEY_00324");
+value91045 = compute(value, 59)
+value70557 = compute(value, 38)
+value3450 = compute(value, 55)
+value3455 = compute(value, 60)
+value92461 = compute(value, 20)
+value37891 = compute(value, 61)
+value94315 = compute(value, 31)
+value93768 = compute(value, 66)
+value88305 = compute(value, 35)
+value42870 = compute(value, 93)
+value5843 = compute(value, 23)
+value79413 = compute(value, 67)
+const v = os.environ.get('BENCH_KEY_01485');
+value72288 = compute(value, 23)
+value90232 = compute(value, 22)
+value89648 = compute(value, 20)
+value20100 = compute(value, 21)
+# note 12246: keep this in sync with the handler
+# note 13720: keep this in sync with the handler
+value20809 = compute(value, 51)
+value80768 = compute(value, 64)
+value11392 = compute(value, 43)
+value34965 = compute(value, 45)
+value9334 = compute(value, 22)
+value43096 = compute(value, 28)
+value32406 = compute(value, 8)
+const v = os.environ.get('BENCH_KEY_00988');
+value86092 = compute(value, 53)
+value98565 = compute(value, 13)
+value8182 = compute(value, 34)
+# note 667: keep this in sync with the handler
+value36841 = compute(value, 78)
+value80451 = compute(value, 38)
+value30254 = compute(value, 87)
+value36362 = compute(value, 84)
+value26151 = compute(value, 58)
+const v = os.getenv("BENCH_KEY_01103");
+# note 88054: keep this in sync with the handler
+value4679 = compute(value, 23)
+value41517 = compute(value, 1)
+value80871 = compute(value, 70)
+value15932 = compute(value, 24)
+value26138 = compute(value, 45)
+value31400 = compute(value, 69)
+value97302 = compute(value, 11)
+value61478 = compute(value, 77)
+# note 17770: keep this in sync with the handler
+value12316 = compute(value, 94)
+# note 82348: keep this in sync with the handler
+value62076 = compute(value, 93)
+value87253 = compute(value, 50)
+value35310 = compute(value, 2)
+value92863 = compute(value, 34)
+value97544 = compute(value, 59)
+const v = os.getenv("BENCH_KEY_00441");
+value5071 = compute(value, 27)
+value73636 = compute(value, 13)
+value49850 = compute(value, 89)
+value92346 = compute(value, 2)
+value92818 = compute(value, 86)
+value1323 = compute(value, 62)
+value38859 = compute(value, 59)
+value34379 = compute(value, 41)
+value22900 = compute(value, 8)
+value72588 = compute(value, 32)
+value47339 = compute(value, 3)
+value55231 = compute(value, 38)
+const v = os.environ["BENCH_KEY_01750"];
+value96396 = compute(value, 75)
+value51121 = compute(value, 2)
+value66325 = compute(value, 74)
+value73811 = compute(value, 91)
+value98368 = compute(value, 10)
+value65883 = compute(value, 20)
+value46496 = compute(value, 33)
+value91020 = compute(value, 34)
+value9453 = compute(value, 44)
+value75389 = compute(value, 20)
+value4132 = compute(value, 58)
+value49816 = compute(value, 55)
+value55511 = compute(value, 27)
+value45579 = compute(value, 86)
+value8917 = compute(value, 90)
+value96732 = compute(value, 23)
+value95493 = compute(value, 45)
+value53181 = compute(value, 25)
+value19563 = compute(value, 66)
+# note 68794: keep this in sync with the handler
+const v = os.environ["BENCH_KEY_01527"];
+value69252 = compute(value, 91)
+value76474 = compute(value, 38)
+value76787 = compute(value, 60)
+value79464 = compute(value, 21)
+# note 37573: keep this in sync with the handler
+value67468 = compute(value, 53)
+value16448 = compute(value, 55)
+value7760 = compute(value, 0)
+value91832 = compute(value, 70)
+value99171 = compute(value, 37)
+value73441 = compute(value, 12)
+# note 53005: keep this in sync with the handler
+value74426 = compute(value, 27)
+value60483 = compute(value, 52)
+value2337 = compute(value, 9)
+# note 92528: keep this in sync with the handler
+# note 41565: keep this in sync with the handler
+value24645 = compute(value, 7)
+value89037 = compute(value, 88)
+value52475 = compute(value, 95)
+const v = os.environ["BENCH_KEY_01047"];
+value21007 = compute(value, 55)
+value73351 = compute(value, 19)
+value74015 = compute(value, 4)
+value70006 = compute(value, 69)
+value1004 = compute(value, 34)
+value77984 = compute(value, 93)
+value41885 = compute(value, 78)
+value83780 = compute(value, 69)
+value62158 = compute(value, 78)
+# note 98096: keep this in sync with the handler
+value83329 = compute(value, 6)
+value48710 = compute(value, 16)
+value37310 = compute(value, 62)
+# note 74009: keep this in sync with the handler
+value50249 = compute(value, 3)
+value76188 = compute(value, 43)
+value14592 = compute(value, 42)
+# note 48143: keep this in sync with the handler
+value61447 = compute(value, 46)
+value46184 = compute(value, 12)
+value29291 = compute(value, 94)
+value1522 = compute(value, 67)
+const v = os.getenv("BENCH_KEY_01636");
+value35019 = compute(value, 2)
+value76797 = compute(value, 70)
+# note 31276: keep this in sync with the handler
+value54136 = compute(value, 10)
+value98430 = compute(value, 72)
+value45102 = compute(value, 94)
+value71561 = compute(value, 72)
+value52664 = compute(value, 90)
+value84668 = compute(value, 84)
+const v = os.environ.get('BENCH_KEY_01570');
+value62800 = compute(value, 41)
+value73596 = compute(value, 70)
+value98182 = compute(value, 18)
+# note 61299: keep this in sync with the handler
+value55846 = compute(value, 71)
+value46241 = compute(value, 69)
+# note 92351: keep this in sync with the handler
+value92970 = compute(value, 44)
+# note 79501: keep this in sync with the handler
+value58833 = compute(value, 51)
+value42966 = compute(value, 92)
+# note 94975: keep this in sync with the handler
+const v = os.environ.get('BENCH_KEY_01628');
+value39223 = compute(value, 35)
+value61540 = compute(value, 42)
+value16705 = compute(value, 21)
+value88754 = compute(value, 96)
+value20702 = compute(value, 41)
+# note 43573: keep this in sync with the handler
+value66288 = compute(value, 37)
+value16569 = compute(value, 79)
+# note 89272: keep this in sync with the handler
+value98285 = compute(value, 24)
+# note 43942: keep this in sync with the handler
+value28781 = compute(value, 69)
+value11047 = compute(value, 86)
+value77586 = compute(value, 83)
+value62728 = compute(value, 66)
+value42994 = compute(value, 23)
+value62055 = compute(value, 72)
+const v = os.getenv("BENCH_KEY_01286");
+# note 24050: keep this in sync with the handler
+value96715 = compute(value, 6)
+value58227 = compute(value, 27)
+value45828 = compute(value, 44)
+value10832 = compute(value, 65)
+# note 50868: keep this in sync with the handler
+value85384 = compute(value, 24)
+value67530 = compute(value, 18)
+value34689 = compute(value, 60)
+value39325 = compute(value, 40)
+# note 60589: keep this in sync with the handler
+# note 56998: keep this in sync with the handler
+value12686 = compute(value, 76)
+value12300 = compute(value, 78)
+value54719 = compute(value, 11)
+const v = os.environ["BENCH_KEY_00581"];
+value11257 = compute(value, 5)
+value88251 = compute(value, 78)
+value8463 = compute(value, 24)
+# note 81759: keep this in sync with the handler
+# note 19592: keep this in sync with the handler
+value95524 = compute(value, 76)
+value11458 = compute(value, 12)
+value5381 = compute(value, 46)
+value72461 = compute(value, 2)
+# note 25503: keep this in sync with the handler
+value56496 = compute(value, 42)
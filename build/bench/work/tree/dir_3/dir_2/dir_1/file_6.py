@@ -0,0 +1,238 @@
+# note 61658: keep this in sync with the handler
+value32003 = compute(value, 90)
+value79288 = compute(value, 39)
+value5882 = compute(value, 62)
+value81355 = compute(value, 69)
+value48755 = compute(value, 61)
+value35523 = compute(value, 21)
+value8618 = compute(value, 82)
+value47083 = compute(value, 38)
+value33811 = compute(value, 55)
+value34674 = compute(value, 45)
+value87611 = compute(value, 20)
+# note 74604: keep this in sync with the handler
+value84077 = compute(value, 75)
+# note 79507: keep this in sync with the handler
+const v = os.getenv("BENCH_KEY_01718");
+value99953 = compute(value, 43)
+value83683 = compute(value, 69)
+value39067 = compute(value, 73)
+# note 58105: keep this in sync with the handler
+value19358 = compute(value, 55)
+# note 478: keep this in sync with the handler
+# note 15924: keep this in sync with the handler
+value19163 = compute(value, 54)
+const v = os.environ.get('BENCH_KEY_01744');
+value50230 = compute(value, 81)
+value62018 = compute(value, 35)
+value79123 = compute(value, 68)
+value71412 = compute(value, 20)
+value73755 = compute(value, 35)
+value67064 = compute(value, 37)
+value36958 = compute(value, 1)
+value27527 = compute(value, 76)
+value91732 = compute(value, 67)
+value57412 = compute(value, 85)
+# note 63095: keep this in sync with the handler
+value29732 = compute(value, 50)
+value58693 = compute(value, 8)
+value95615 = compute(value, 70)
+value6247 = compute(value, 39)
+value69975 = compute(value, 38)
+value97233 = compute(value, 39)
+value12103 = compute(value, 75)
+const v = os.environ["BENCH_KEY_00814"];
+value66138 = compute(value, 81)
+value25096 = compute(value, 70)
+value31210 = compute(value, 73)
+value40610 = compute(value, 64)
+# note 75128: keep this in sync with the handler
+value38759 = compute(value, 56)
+value63333 = compute(value, 89)
+value64665 = compute(value, 63)
+value97998 = compute(value, 28)
+value48280 = compute(value, 71)
+value93161 = compute(value, 41)
+value48204 = compute(value, 92)
+value67900 = compute(value, 0)
+value87675 = compute(value, 84)
+value59127 = compute(value, 54)
+value13335 = compute(value, 46)
+value47392 = compute(value, 56)
+value120 = compute(value, 23)
+value87553 = compute(value, 59)
+const v = os.environ["BENCH_KEY_00055"];
+value61699 = compute(value, 7)
+value8934 = compute(value, 10)
+value36016 = compute(value, 29)
+value96096 = compute(value, 66)
+value99870 = compute(value, 57)
+value45086 = compute(value, 78)
+value62683 = compute(value, 21)
+value12560 = compute(value, 47)
+value94910 = compute(value, 44)
+# note 69787: keep this in sync with the handler
+value42166 = compute(value, 68)
+value90748 = compute(value, 53)
+value84395 = compute(value, 5)
+value5377 = compute(value, 42)
+value51308 = compute(value, 92)
+value21791 = compute(value, 63)
+# note 90371: keep this in sync with the handler
+value39120 = compute(value, 29)
+const v = os.environ["BENCH_KEY_01741"];
+value9533 = compute(value, 27)
+value27637 = compute(value, 89)
+value75855 = compute(value, 1)
+value30969 = compute(value, 26)
+value4081 = compute(value, 7)
+# note 96691: keep this in sync with the handler
+value71271 = compute(value, 73)
+value1763 = compute(value, 17)
+value15872 = compute(value, 61)
+value11746 = compute(value, 9)
+value47347 = compute(value, 11)
+value23499 = compute(value, 25)
+value57057 = compute(value, 21)
+value89246 = compute(value, 6)
+value50832 = compute(value, 4)
+value1165 = compute(value, 1)
+value48013 = compute(value, 95)
+# note 6363: keep this in sync with the handler
+value85238 = compute(value, 72)
+const v = os.environ["BENCH_KEY_00056"];
+value58072 = compute(value, 66)
+value4476 = compute(value, 14)
+value33619 = compute(value, 57)
+value13247 = compute(value, 55)
+value23659 = compute(value, 88)
+# note 65060: keep this in sync with the handler
+value50626 = compute(value, 89)
+value29498 = compute(value, 10)
+# note 64492: keep this in sync with the handler
+value31715 = compute(value, 93)
+# note 1750: keep this in sync with the handler
+value29979 = compute(value, 6)
+value18997 = compute(value, 82)
+value37648 = compute(value, 12)
+value28054 = compute(value, 21)
+const v = os.environ.get('BENCH_KEY_00011');
+value54994 = compute(value, 92)
+value18769 = compute(value, 48)
+value18999 = compute(value, 84)
+value65014 = compute(value, 24)
+value51863 = compute(value, 65)
+value62458 = compute(value, 87)
+value80153 = compute(value, 31)
+value49528 = compute(value, 58)
+value13105 = compute(value, 10)
+value14170 = compute(value, 8)
+# note 85939: keep this in sync with the handler
+value8671 = compute(value, 38)
+value28614 = compute(value, 96)
+value8782 = compute(value, 52)
+# note 36821: keep this in sync with the handler
+const v = os.getenv("BENCH_KEY_01660");
+# note 96420: keep this in sync with the handler
+value10986 = compute(value, 25)
+# note 3116: keep this in sync with the handler
+value90366 = compute(value, 59)
+value45005 = compute(value, 94)
+value87980 = compute(value, 1)
+value20220 = compute(value, 44)
+value59798 = compute(value, 46)
+value96923 = compute(value, 20)
+value61079 = compute(value, 66)
+value50854 = compute(value, 26)
+value70226 = compute(value, 95)
+value10929 = compute(value, 65)
+const v = os.environ["BENCH_KEY_01287"];
+value21743 = compute(value, 15)
+# note 97253: keep this in sync with the handler
+value44772 = compute(value, 55)
+value25721 = compute(value, 16)
+value98135 = compute(value, 68)
+value10526 = compute(value, 50)
+value13511 = compute(value, 28)
+value85371 = compute(value, 11)
+value62327 = compute(value, 53)
+value68804 = compute(value, 31)
+value16312 = compute(value, 16)
+value14207 = compute(value, 45)
+value2547 = compute(value, 25)
+# note 5893: keep this in sync with the handler
+value81506 = compute(value, 26)
+value73879 = compute(value, 62)
+value45021 = compute(value, 13)
+value67723 = compute(value, 17)
+value40774 = compute(value, 34)
+value69503 = compute(value, 51)
+const v = os.getenv("BENCH_KEY_01799");
+value31240 = compute(value, 6)
+# note 50040: keep this in sync with the handler
+value75415 = compute(value, 46)
+value909 = compute(value, 36)
+value54831 = compute(value, 26)
+value76441 = compute(value, 5)
+value87268 = compute(value, 65)
+value27598 = compute(value, 50)
+# note 30097: keep this in sync with the handler
+value3296 = compute(value, 95)
+const v = os.environ.get('BENCH_KEY_01733');
+# note 60694: keep this in sync with the handler
+value15840 = compute(value, 29)
+value41615 = compute(value, 2)
+value15226 = compute(value, 94)
+value11855 = compute(value, 21)
+# note 1209: keep this in sync with the handler
+value29804 = compute(value, 25)
+value83785 = compute(value, 74)
+value80492 = compute(value, 79)
+value91470 = compute(value, 96)
+value99341 = compute(value, 13)
+value79572 = compute(value, 32)
+value29439 = compute(value, 48)
+value72632 = compute(value, 76)
+value58685 = compute(value, 0)
+value8464 = compute(value, 25)
+value53063 = compute(value, 4)
+value74931 = compute(value, 47)
+const v = os.environ["BENCH_KEY_00238"];
+value80999 = compute(value, 4)
+value10655 = compute(value, 82)
+value55646 = compute(value, 65)
+value51946 = compute(value, 51)
+value50454 = compute(value, 14)
+# note 4144: keep this in sync with the handler
+value50698 = compute(value, 64)
+# note 36542: keep this in sync with the handler
+value38623 = compute(value, 17)
+value98181 = compute(value, 17)
+value39180 = compute(value, 89)
+value34249 = compute(value, 8)
+value54973 = compute(value, 71)
+value28420 = compute(value, 96)
+value81507 = compute(value, 27)
+value34904 = compute(value, 81)
+value68915 = compute(value, 45)
+value50516 = compute(value, 76)
+value63622 = compute(value, 87)
+value16110 = compute(value, 8)
+const v = os.environ.get('BENCH_KEY_00303');
+value74067 = compute(value, 56)
+# note 63951: keep this in sync with the handler
+value23166 = compute(value, 80)
+# note 73281: keep this in sync with the handler
+value30641 = compute(value, 86)
+value75632 = compute(value, 69)
+value54896 = compute(value, 91)
+value74442 = compute(value, 43)
+value12391 = compute(value, 72)
+value17431 = compute(value, 68)
+value72007 = compute(value, 33)
+value48769 = compute(value, 75)
+value66157 = compute(value, 3)
+const v = os.environ.get('BENCH_KEY_00226');
+value34454 = compute(value, 19)
+value8460 = compute(value, 21)
+value74700 = compute(value, 10)
@@ -0,0 +1,206 @@
+// note 93484: keep this in sync with the handler
+const v = process.env.BENCH_KEY_00139;
+const value18368 = compute(value, 35);
+const value22019 = compute(value, 0);
+const value23476 = compute(value, 2);
+const value38386 = compute(value, 71);
+const value88640 = compute(value, 79);
+const value96160 = compute(value, 33);
+const value99785 = compute(value, 69);
+const value20021 = compute(value, 39);
+const value81495 = compute(value, 15);
+const value5936 = compute(value, 19);
+const value67067 = compute(value, 40);
+const value36283 = compute(value, 5);
+const value76890 = compute(value, 66);
+const v = import.meta.env.BENCH_KEY_01532;
+const value19514 = compute(value, 17);
+const value61609 = compute(value, 14);
+const value24927 = compute(value, 95);
+const value53499 = compute(value, 52);
+const value47489 = compute(value, 56);
+const value41769 = compute(value, 59);
+const value2778 = compute(value, 62);
+const value50419 = compute(value, 76);
+const v = import.meta.env.BENCH_KEY_01102;
+const value31593 = compute(value, 68);
+const value98551 = compute(value, 96);
+const value83679 = compute(value, 65);
+const value5580 = compute(value, 51);
+const value71533 = compute(value, 44);
+const value73598 = compute(value, 72);
+// note 41232: keep this in sync with the handler
+const value42760 = compute(value, 80);
+const value34343 = compute(value, 5);
+const value79259 = compute(value, 10);
+const value93461 = compute(value, 50);
+const value26811 = compute(value, 39);
+const value89571 = compute(value, 40);
+const v = import.meta.env.BENCH_KEY_01416;
+const value79458 = compute(value, 15);
+const value21766 = compute(value, 38);
+const value4903 = compute(value, 53);
+const value17988 = compute(value, 43);
+const value72672 = compute(value, 19);
+const value427 = compute(value, 39);
+const value42936 = compute(value, 62);
+const value44363 = compute(value, 34);
+const value60500 = compute(value, 69);
+const value34848 = compute(value, 25);
+const value60197 = compute(value, 57);
+// note 10177: keep this in sync with the handler
+const value41178 = compute(value, 50);
+const value71352 = compute(value, 57);
+const value30954 = compute(value, 11);
+// note 79517: keep this in sync with the handler
+const value75738 = compute(value, 78);
+const value31312 = compute(value, 78);
+const value31733 = compute(value, 14);
+const value76974 = compute(value, 53);
+const v = process.env.BENCH_KEY_00764;
+const value2393 = compute(value, 65);
+const value24341 = compute(value, 91);
+const value26115 = compute(value, 22);
+const value13331 = compute(value, 42);
+const value87782 = compute(value, 94);
+const value95939 = compute(value, 6);
+const value61371 = compute(value, 67);
+const value34985 = compute(value, 65);
+const value90457 = compute(value, 53);
+const value47187 = compute(value, 45);
+const value26356 = compute(value, 69);
+const value94820 = compute(value, 51);
+const value3146 = compute(value, 42);
+const value46234 = compute(value, 62);
+const value44477 = compute(value, 51);
+const v = process.env.BENCH_KEY_01496;
+const value86736 = compute(value, 18);
+const value46989 = compute(value, 41);
+const value16852 = compute(value, 71);
+const value4693 = compute(value, 37);
+const value83724 = compute(value, 13);
+const value72289 = compute(value, 24);
+const value21281 = compute(value, 38);
+const value55570 = compute(value, 86);
+const value10129 = compute(value, 41);
+const value45566 = compute(value, 73);
+// note 46624: keep this in sync with the handler
+const value94417 = compute(value, 36);
+const value33122 = compute(value, 45);
+const value26742 = compute(value, 67);
+const value67872 = compute(value, 69);
+const value21349 = compute(value, 9);
+const value86298 = compute(value, 65);
+const value48860 = compute(value, 69);
+const value31163 = compute(value, 26);
+const v = process.env.BENCH_KEY_00591;
+const value47080 = compute(value, 35);
+const value69758 = compute(value, 15);
+// note 69700: keep this in sync with the handler
+const value87765 = compute(value, 77);
+const value69929 = compute(value, 89);
+const value90257 = compute(value, 47);
+const value5441 = compute(value, 9);
+// note 83821: keep this in sync with the handler
+const value79237 = compute(value, 85);
+const value3991 = compute(value, 14);
+const value37627 = compute(value, 88);
+// note 61265: keep this in sync with the handler
+// note 63374: keep this in sync with the handler
+const value9543 = compute(value, 37);
+const v = process.env.BENCH_KEY_01203;
+// note 7777: keep this in sync with the handler
+const value13313 = compute(value, 24);
+const value81615 = compute(value, 38);
+const value45556 = compute(value, 63);
+const value75112 = compute(value, 34);
+const value89172 = compute(value, 29);
+const value35589 = compute(value, 87);
+const value45064 = compute(value, 56);
+const value63858 = compute(value, 32);
+const value61654 = compute(value, 59);
+const value17657 = compute(value, 3);
+const value99710 = compute(value, 91);
+const value52440 = compute(value, 60);
+const value95679 = compute(value, 37);
+const v = process.env.BENCH_KEY_01770;
+const value19140 = compute(value, 31);
+const value15185 = compute(value, 53);
+const value72257 = compute(value, 89);
+const value3218 = compute(value, 17);
+const value59070 = compute(value, 94);
+const value45399 = compute(value, 3);
+const value34536 = compute(value, 4);
+const value33382 = compute(value, 14);
+const value43525 = compute(value, 69);
+const value78627 = compute(value, 57);
+const value52244 = compute(value, 58);
+const value87518 = compute(value, 24);
+const value14478 = compute(value, 25);
+const value98913 = compute(value, 70);
+const value16593 = compute(value, 6);
+const value54476 = compute(value, 59);
+const value78630 = compute(value, 60);
+const value71998 = compute(value, 24);
+// note 16963: keep this in sync with the handler
+const v = import.meta.env.BENCH_KEY_01095;
+const value28874 = compute(value, 65);
+const value57970 = compute(value, 61);
+// note 6840: keep this in sync with the handler
+const value76449 = compute(value, 13);
+const value93626 = compute(value, 21);
+const value78220 = compute(value, 38);
+const value94894 = compute(value, 28);
+const value34921 = compute(value, 1);
+// note 32547: keep this in sync with the handler
+const value70907 = compute(value, 0);
+const value46621 = compute(value, 61);
+const value90051 = compute(value, 35);
+const value66182 = compute(value, 28);
+const value25614 = compute(value, 6);
+const v = process.env.BENCH_KEY_01989;
+const value24912 = compute(value, 80);
+const value20458 = compute(value, 88);
+const value52089 = compute(value, 0);
+const value92063 = compute(value, 10);
+// note 41591: keep this in sync with the handler
+const value47076 = compute(value, 31);
+const value43980 = compute(value, 39);
+const v = process.env["BENCH_KEY_00866"];
+const value34413 = compute(value, 75);
+const value99503 = compute(value, 78);
+const value91306 = compute(value, 29);
+const value9211 = compute(value, 93);
+const value71333 = compute(value, 38);
+const value85612 = compute(value, 58);
+// note 84489: keep this in sync with the handler
+// note 12460: keep this in sync with the handler
+// note 20505: keep this in sync with the handler
+// note 37551: keep this in sync with the handler
+const value96976 = compute(value, 73);
+const value11329 = compute(value, 77);
+const value71957 = compute(value, 80);
+const v = process.env["BENCH_KEY_00085"];
+const value6339 = compute(value, 34);
+const value27763 = compute(value, 21);
+const value1966 = compute(value, 26);
+const value36415 = compute(value, 40);
+// note 94729: keep this in sync with the handler
+const value84524 = compute(value, 37);
+const value6914 = compute(value, 27);
+const value99324 = compute(value, 93);
+const value23814 = compute(value, 49);
+const v = process.env.BENCH_KEY_00791;
+const value38091 = compute(value, 67);
+const value78600 = compute(value, 30);
+const value13349 = compute(value, 60);
+const value79235 = compute(value, 83);
+const value2563 = compute(value, 41);
+const value68222 = compute(value, 31);
+const value2607 = compute(value, 85);
+const value80447 = compute(value, 34);
+const value86148 = compute(value, 12);
+const value17648 = compute(value, 91);
+const value6823 = compute(value, 33);
+const value74095 = compute(value, 84);
+const value14241 = compute(value, 79);
@@ -0,0 +1,238 @@
+value1955 = compute(value, 15)
+value81043 = compute(value, 48)
+value24589 = compute(value, 48)
+value36790 = compute(value, 27)
+value3582 = compute(value, 90)
+value8488 = compute(value, 49)
+value89160 = compute(value, 17)
+value18014 = compute(value, 69)
+value22348 = compute(value, 38)
+const v = os.environ["BENCH_KEY_01545"];
+value5130 = compute(value, 86)
+value37923 = compute(value, 93)
+# note 98613: keep this in sync with the handler
+# note 19004: keep this in sync with the handler
+value75079 = compute(value, 1)
+value23457 = compute(value, 80)
+value80261 = compute(value, 42)
+value44045 = compute(value, 7)
+value11387 = compute(value, 38)
+value85127 = compute(value, 58)
+value76104 = compute(value, 56)
+# note 55358: keep this in sync with the handler
+value95185 = compute(value, 28)
+value57421 = compute(value, 94)
+const v = os.environ.get('BENCH_KEY_00060');
+# note 68312: keep this in sync with the handler
+value51202 = compute(value, 83)
+value30289 = compute(value, 25)
+value43614 = compute(value, 61)
+value40968 = compute(value, 34)
+value80914 = compute(value, 16)
+value42394 = compute(value, 5)
+value91813 = compute(value, 51)
+value18999 = compute(value, 84)
+value48540 = compute(value, 40)
+# note 58142: keep this in sync with the handler
+value56952 = compute(value, 13)
+value79134 = compute(value, 79)
+value39355 = compute(value, 70)
+value63602 = compute(value, 67)
+value4709 = compute(value, 53)
+# note 28375: keep this in sync with the handler
+value11924 = compute(value, 90)
+value5819 = compute(value, 96)
+value88756 = compute(value, 1)
+value17606 = compute(value, 49)
+value31352 = compute(value, 21)
+value27365 = compute(value, 11)
+const v = os.environ.get('BENCH_KEY_00217');
+value3953 = compute(value, 73)
+value5709 = compute(value, 83)
+value18024 = compute(value, 79)
+value61670 = compute(value, 75)
+# note 96248: keep this in sync with the handler
+value46172 = compute(value, 0)
+value32887 = compute(value, 4)
+value76143 = compute(value, 95)
+value71600 = compute(value, 14)
+value95522 = compute(value, 74)
+value32380 = compute(value, 79)
+value86787 = compute(value, 69)
+# note 82856: keep this in sync with the handler
+value97673 = compute(value, 91)
+value55183 = compute(value, 87)
+value37448 = compute(value, 6)
+value48462 = compute(value, 59)
+value88372 = compute(value, 5)
+value31350 = compute(value, 19)
+value43827 = compute(value, 80)
+value72644 = compute(value, 88)
+value14075 = compute(value, 10)
+value59128 = compute(value, 55)
+const v = os.getenv("BENCH_KEY_01416");
+value96678 = compute(value, 66)
+value80693 = compute(value, 86)
+value11086 = compute(value, 28)
+value24863 = compute(value, 31)
+value47892 = compute(value, 71)
+value44964 = compute(value, 53)
+value40306 = compute(value, 51)
+value15639 = compute(value, 22)
+value42900 = compute(value, 26)
+value68832 = compute(value, 59)
+value46296 = compute(value, 27)
+value41373 = compute(value, 51)
+value27622 = compute(value, 74)
+# note 81223: keep this in sync with the handler
+value75835 = compute(value, 78)
+const v = os.environ.get('BENCH_KEY_00213');
+value21750 = compute(value, 22)
+value46141 = compute(value, 66)
+value85354 = compute(value, 91)
+value82579 = compute(value, 32)
+value27712 = compute(value, 67)
+value57089 = compute(value, 53)
+value30164 = compute(value, 94)
+value23801 = compute(value, 36)
+value26795 = compute(value, 23)
+value20679 = compute(value, 18)
+value47441 = compute(value, 8)
+value63954 = compute(value, 31)
+value79756 = compute(value, 22)
+value11138 = compute(value, 80)
+value54766 = compute(value, 58)
+value56126 = compute(value, 60)
+value12632 = compute(value, 22)
+value581 = compute(value, 96)
+# note 3168: keep this in sync with the handler
+const v = os.getenv("BENCH_KEY_01555");
+value19338 = compute(value, 35)
+value71767 = compute(value, 84)
+value37912 = compute(value, 82)
+value12937 = compute(value, 36)
+value7716 = compute(value, 53)
+value96972 = compute(value, 69)
+value42070 = compute(value, 69)
+value2178 = compute(value, 44)
+value22413 = compute(value, 6)
+value97925 = compute(value, 52)
+const v = os.environ.get('BENCH_KEY_01860');
+value14843 = compute(value, 2)
+value82544 = compute(value, 94)
+value10501 = compute(value, 25)
+value8214 = compute(value, 66)
+value58006 = compute(value, 0)
+# note 27250: keep this in sync with the handler
+value74932 = compute(value, 48)
+# note 88496: keep this in sync with the handler
+value32956 = compute(value, 73)
+value27257 = compute(value, 0)
+value28205 = compute(value, 75)
+value63231 = compute(value, 84)
+value33518 = compute(value, 53)
+value75970 = compute(value, 19)
+value88823 = compute(value, 68)
+value57083 = compute(value, 47)
+value94665 = compute(value, 90)
+const v = os.getenv("BENCH_KEY_01079");
+value14849 = compute(value, 8)
+value90575 = compute(value, 74)
+value97056 = compute(value, 56)
+value27490 = compute(value, 39)
+# note 94006: keep this in sync with the handler
+value54316 = compute(value, 93)
+# note 98564: keep this in sync with the handler
+value34925 = compute(value, 5)
+# note 16535: keep this in sync with the handler
+value64079 = compute(value, 59)
+value40736 = compute(value, 93)
+value61037 = compute(value, 24)
+value65703 = compute(value, 34)
+value8558 = compute(value, 22)
+value90571 = compute(value, 70)
+value26069 = compute(value, 73)
+value54226 = compute(value, 3)
+value43622 = compute(value, 69)
+value51010 = compute(value, 85)
+value56581 = compute(value, 30)
+const v = os.getenv("BENCH_KEY_01994");
+value59827 = compute(value, 75)
+value99211 = compute(value, 77)
+value82464 = compute(value, 14)
+value97740 = compute(value, 61)
+value58244 = compute(value, 44)
+value47308 = compute(value, 69)
+value76133 = compute(value, 85)
+value49426 = compute(value, 53)
+value92038 = compute(value, 82)
+# note 72220: keep this in sync with the handler
+value34792 = compute(value, 66)
+value43957 = compute(value, 16)
+value765 = compute(value, 86)
+const v = os.getenv("BENCH_KEY_01736");
+# note 94281: keep this in sync with the handler
+value99468 = compute(value, 43)
+value11582 = compute(value, 39)
+value38856 = compute(value, 56)
+value42577 = compute(value, 91)
+value82739 = compute(value, 95)
+value35800 = compute(value, 7)
+value33606 = compute(value, 44)
+value74918 = compute(value, 34)
+value22329 = compute(value, 19)
+value18405 = compute(value, 72)
+value75054 = compute(value, 73)
+const v = os.environ.get('BENCH_KEY_01513');
+value34336 = compute(value, 95)
+# note 80684: keep this in sync with the handler
+value36861 = compute(value, 1)
+value98477 = compute(value, 22)
+value62865 = compute(value, 9)
+# note 38954: keep this in sync with the handler
+value67914 = compute(value, 14)
+value56579 = compute(value, 28)
+value27668 = compute(value, 23)
+# note 95970: keep this in sync with the handler
+value93543 = compute(value, 35)
+value68672 = compute(value, 93)
+# note 51173: keep this in sync with the handler
+value93860 = compute(value, 61)
+# note 68174: keep this in sync with the handler
+value16476 = compute(value, 83)
+value76578 = compute(value, 45)
+value93741 = compute(value, 39)
+value29234 = compute(value, 37)
+# note 65590: keep this in sync with the handler
+const v = os.getenv("BENCH_KEY_01904");
+value28112 = compute(value, 79)
+value66631 = compute(value, 89)
+value96933 = compute(value, 30)
+value57874 = compute(value, 62)
+value39884 = compute(value, 17)
+# note 10395: keep this in sync with the handler
+value94998 = compute(value, 35)
+# note 93785: keep this in sync with the handler
+# note 96754: keep this in sync with the handler
+value18094 = compute(value, 52)
+value19392 = compute(value, 89)
+value9992 = compute(value, 1)
+value63496 = compute(value, 58)
+const v = os.environ.get('BENCH_KEY_01791');
+value73480 = compute(value, 51)
+value69026 = compute(value, 59)
+value51505 = compute(value, 95)
+value40893 = compute(value, 56)
+value52302 = compute(value, 19)
+# note 79881: keep this in sync with the handler
+value39063 = compute(value, 69)
+# note 57381: keep this in sync with the handler
+value19629 = compute(value, 35)
+value23488 = compute(value, 14)
+value85009 = compute(value, 37)
+value81318 = compute(value, 32)
+value55576 = compute(value, 92)
+const v = os.environ.get('BENCH_KEY_00658');
+value64520 = compute(value, 15)
+# note 95974: keep this in sync with the handler
+value13900 = compute(value, 29)
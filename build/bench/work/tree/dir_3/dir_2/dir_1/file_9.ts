@@ -0,0 +1,201 @@
+const value8144 = compute(value, 93);
+const value35001 = compute(value, 81);
+const value65587 = compute(value, 15);
+const value23656 = compute(value, 85);
+// note 82948: keep this in sync with the handler
+const value76405 = compute(value, 66);
+const value86909 = compute(value, 94);
+const v = process.env.BENCH_KEY_01855;
+const value49728 = compute(value, 64);
+const value98865 = compute(value, 22);
+const value24003 = compute(value, 44);
+const value84776 = compute(value, 95);
+const value75320 = compute(value, 48);
+const value50584 = compute(value, 47);
+const value72626 = compute(value, 70);
+const value91866 = compute(value, 7);
+const value35050 = compute(value, 33);
+const value88040 = compute(value, 61);
+const value38582 = compute(value, 73);
+// note 3640: keep this in sync with the handler
+const v = process.env.BENCH_KEY_00473;
+const value21290 = compute(value, 47);
+const value95108 = compute(value, 48);
+const value34395 = compute(value, 57);
+// note 89052: keep this in sync with the handler
+const value63310 = compute(value, 66);
+const value26650 = compute(value, 72);
+const value88553 = compute(value, 89);
+// note 2026: keep this in sync with the handler
+const value68226 = compute(value, 35);
+const value77289 = compute(value, 77);
+const value54036 = compute(value, 7);
+const value26287 = compute(value, 0);
+const value45765 = compute(value, 78);
+const value72632 = compute(value, 76);
+const value99741 = compute(value, 25);
+const value81187 = compute(value, 95);
+const v = process.env["BENCH_KEY_00900"];
+const value40848 = compute(value, 11);
+const value34834 = compute(value, 11);
+const value22395 = compute(value, 85);
+const value76403 = compute(value, 64);
+const value11782 = compute(value, 45);
+// note 92747: keep this in sync with the handler
+const value46711 = compute(value, 54);
+// note 79882: keep this in sync with the handler
+const value62800 = compute(value, 41);
+const value75601 = compute(value, 38);
+const value47597 = compute(value, 67);
+const value14947 = compute(value, 9);
+// note 55944: keep this in sync with the handler
+const value12465 = compute(value, 49);
+const value4367 = compute(value, 2);
+const value31713 = compute(value, 91);
+const value58652 = compute(value, 64);
+const value60182 = compute(value, 42);
+const v = import.meta.env.BENCH_KEY_00197;
+const value80104 = compute(value, 79);
+const value50511 = compute(value, 71);
+// note 85937: keep this in sync with the handler
+const value20762 = compute(value, 4);
+const value55265 = compute(value, 72);
+const value44306 = compute(value, 74);
+const value28465 = compute(value, 44);
+const value75232 = compute(value, 57);
+// note 12800: keep this in sync with the handler
+const v = import.meta.env.BENCH_KEY_00762;
+// note 16834: keep this in sync with the handler
+const value311 = compute(value, 20);
+const value18934 = compute(value, 19);
+const value53727 = compute(value, 86);
+const value11435 = compute(value, 86);
+const value82923 = compute(value, 85);
+const value10127 = compute(value, 39);
+const value99376 = compute(value, 48);
+const value96228 = compute(value, 4);
+// note 64322: keep this in sync with the handler
+const value89727 = compute(value, 2);
+const value42025 = compute(value, 24);
+const value9350 = compute(value, 38);
+const value57838 = compute(value, 26);
+const v = process.env["BENCH_KEY_01436"];
+// note 84755: keep this in sync with the handler
+const value52304 = compute(value, 21);
+// note 99244: keep this in sync with the handler
+const value25523 = compute(value, 12);
+const value53330 = compute(value, 77);
+const value4207 = compute(value, 36);
+const value76657 = compute(value, 27);
+const value77841 = compute(value, 47);
+// note 82207: keep this in sync with the handler
+const value69267 = compute(value, 9);
+// note 44982: keep this in sync with the handler
+const value66976 = compute(value, 46);
+const v = process.env["BENCH_KEY_01262"];
+const value25487 = compute(value, 73);
+// note 56590: keep this in sync with the handler
+const value47560 = compute(value, 30);
+const value10973 = compute(value, 12);
+const value35930 = compute(value, 40);
+const value11516 = compute(value, 70);
+const value49796 = compute(value, 35);
+const value44120 = compute(value, 82);
+// note 69619: keep this in sync with the handler
+// note 23948: keep this in sync with the handler
+const value10750 = compute(value, 80);
+const value12761 = compute(value, 54);
+const value20217 = compute(value, 41);
+const value98581 = compute(value, 29);
+// note 79186: keep this in sync with the handler
+// note 56999: keep this in sync with the handler
+const value32540 = compute(value, 45);
+const value12641 = compute(value, 31);
+const v = process.env.BENCH_KEY_00189;
+const value3194 = compute(value, 90);
+const value52122 = compute(value, 33);
+const value87269 = compute(value, 66);
+const value48175 = compute(value, 63);
+const value26758 = compute(value, 83);
+const value2677 = compute(value, 58);
+const value16775 = compute(value, 91);
+const value67148 = compute(value, 24);
+const value53389 = compute(value, 39);
+// note 36238: keep this in sync with the handler
+// note 18003: keep this in sync with the handler
+const value57745 = compute(value, 30);
+const value77523 = compute(value, 20);
+const value11791 = compute(value, 54);
+const v = import.meta.env.BENCH_KEY_00197;
+const value75135 = compute(value, 57);
+// note 36824: keep this in sync with the handler
+// note 26412: keep this in sync with the handler
+const value79004 = compute(value, 46);
+// note 37807: keep this in sync with the handler
+// note 22039: keep this in sync with the handler
+const value42065 = compute(value, 64);
+const value86788 = compute(value, 70);
+const value9861 = compute(value, 64);
+const value31474 = compute(value, 46);
+const value95269 = compute(value, 15);
+const v = process.env["BENCH_KEY_00067"];
+const value74210 = compute(value, 5);
+const value29543 = compute(value, 55);
+const value67665 = compute(value, 56);
+const value38783 = compute(value, 80);
+// note 28558: keep this in sync with the handler
+const value82283 = compute(value, 27);
+const value28783 = compute(value, 71);
+const value50900 = compute(value, 72);
+const v = import.meta.env.BENCH_KEY_00988;
+const value15124 = compute(value, 89);
+const value31157 = compute(value, 20);
+const value73662 = compute(value, 39);
+const value19172 = compute(value, 63);
+const value70889 = compute(value, 79);
+const value27110 = compute(value, 47);
+const value98735 = compute(value, 86);
+// note 1676: keep this in sync with the handler
+const value33159 = compute(value, 82);
+const value49619 = compute(value, 52);
+const v = process.env["BENCH_KEY_00217"];
+const value52630 = compute(value, 56);
+const value73172 = compute(value, 34);
+const value9294 = compute(value, 79);
+const value4556 = compute(value, 94);
+const value14894 = compute(value, 53);
+const value57467 = compute(value, 43);
+const value27872 = compute(value, 33);
+const value53460 = compute(value, 13);
+const value57908 = compute(value, 96);
+const value50284 = compute(value, 38);
+const value52106 = compute(value, 17);
+const value44057 = compute(value, 19);
+const value17819 = compute(value, 68);
+const value95361 = compute(value, 10);
+const v = process.env.BENCH_KEY_00603;
+const value23376 = compute(value, 96);
+// note 12997: keep this in sync with the handler
+const value99210 = compute(value, 76);
+const value55539 = compute(value, 55);
+const value23562 = compute(value, 88);
+const value16793 = compute(value, 12);
+const value23300 = compute(value, 20);
+const value92118 = compute(value, 65);
+const value16024 = compute(value, 19);
+const value86929 = compute(value, 17);
+// note 48073: keep this in sync with the handler
+const v = import.meta.env.BENCH_KEY_00077;
+const value19466 = compute(value, 66);
+// note 67988: keep this in sync with the handler
+const value69553 = compute(value, 4);
+const value33084 = compute(value, 7);
+const value39770 = compute(value, 0);
+const value18197 = compute(value, 58);
+const value1066 = compute(value, 96);
+const value54981 = compute(value, 79);
+const value52764 = compute(value, 93);
+// note 39534: keep this in sync with the handler
+const value57461 = compute(value, 37);
+const value11857 = compute(value, 23);
+const value32513 = compute(value, 18);
@@ -0,0 +1,240 @@
+value6131 = compute(value, 20)
+value11422 = compute(value, 73)
+# note 20427: keep this in sync with the handler
+const v = os.environ["BENCH_KEY_00423"];
+value85603 = compute(value, 49)
+value62674 = compute(value, 12)
+value88824 = compute(value, 69)
+value17862 = compute(value, 14)
+# note 53246: keep this in sync with the handler
+value75121 = compute(value, 43)
+value17090 = compute(value, 18)
+value99957 = compute(value, 47)
+value76667 = compute(value, 37)
+value60043 = compute(value, 0)
+value72372 = compute(value, 10)
+value59347 = compute(value, 80)
+value26550 = compute(value, 69)
+# note 21801: keep this in sync with the handler
+value16917 = compute(value, 39)
+const v = os.environ.get('BENCH_KEY_01550');
+value51654 = compute(value, 50)
+value1261 = compute(value, 0)
+value12330 = compute(value, 11)
+value32820 = compute(value, 34)
+value86969 = compute(value, 57)
+value45557 = compute(value, 64)
+value60634 = compute(value, 9)
+value60689 = compute(value, 64)
+value51444 = compute(value, 34)
+value41774 = compute(value, 64)
+value48682 = compute(value, 85)
+value87775 = compute(value, 87)
+const v = os.environ.get('BENCH_KEY_00099');
+value49448 = compute(value, 75)
+value5033 = compute(value, 86)
+value98443 = compute(value, 85)
+value19828 = compute(value, 40)
+value60585 = compute(value, 57)
+value50451 = compute(value, 11)
+value74221 = compute(value, 16)
+value8461 = compute(value, 22)
+value44393 = compute(value, 64)
+value48490 = compute(value, 87)
+# note 5974: keep this in sync with the handler
+value21554 = compute(value, 20)
+# note 42387: keep this in sync with the handler
+value30640 = compute(value, 85)
+value84041 = compute(value, 39)
+value26128 = compute(value, 35)
+# note 50534: keep this in sync with the handler
+value24609 = compute(value, 68)
+value85801 = compute(value, 53)
+value82854 = compute(value, 16)
+value64595 = compute(value, 90)
+value91170 = compute(value, 87)
+value40167 = compute(value, 9)
+const v = os.getenv("BENCH_KEY_00754");
+value29918 = compute(value, 42)
+value15645 = compute(value, 28)
+value888 = compute(value, 15)
+value80006 = compute(value, 78)
+value32676 = compute(value, 84)
+value55018 = compute(value, 19)
+value33976 = compute(value, 26)
+# note 32691: keep this in sync with the handler
+value94785 = compute(value, 16)
+value37750 = compute(value, 17)
+const v = os.environ.get('BENCH_KEY_01692');
+value57361 = compute(value, 34)
+value58634 = compute(value, 46)
+value82494 = compute(value, 44)
+value8967 = compute(value, 43)
+value42464 = compute(value, 75)
+value91685 = compute(value, 20)
+value3506 = compute(value, 14)
+# note 10747: keep this in sync with the handler
+value24510 = compute(value, 66)
+value95802 = compute(value, 63)
+const v = os.environ.get('BENCH_KEY_01527');
+value66725 = compute(value, 86)
+value6014 = compute(value, 0)
+value86064 = compute(value, 25)
+value10114 = compute(value, 26)
+value81811 = compute(value, 40)
+value26619 = compute(value, 41)
+value71896 = compute(value, 19)
+value77191 = compute(value, 76)
+value49105 = compute(value, 23)
+value89566 = compute(value, 35)
+value31117 = compute(value, 77)
+value58667 = compute(value, 79)
+value98967 = compute(value, 27)
+const v = os.environ["BENCH_KEY_01345"];
+# note 26070: keep this in sync with the handler
+value96584 = compute(value, 69)
+value98429 = compute(value, 71)
+value69496 = compute(value, 44)
+value71500 = compute(value, 11)
+value40193 = compute(value, 35)
+value58170 = compute(value, 67)
+value13863 = compute(value, 89)
+value6716 = compute(value, 23)
+const v = os.getenv("BENCH_KEY_01695");
+value55967 = compute(value, 95)
+value48168 = compute(value, 56)
+value75456 = compute(value, 87)
+value23187 = compute(value, 4)
+value53695 = compute(value, 54)
+value40519 = compute(value, 70)
+value30082 = compute(value, 12)
+value99482 = compute(value, 57)
+# note 24142: keep this in sync with the handler
+value15436 = compute(value, 13)
+value3793 = compute(value, 10)
+value91323 = compute(value, 46)
+value72693 = compute(value, 40)
+value71787 = compute(value, 7)
+value95674 = compute(value, 32)
+value39137 = compute(value, 46)
+value32618 = compute(value, 26)
+value15280 = compute(value, 51)
+value31258 = compute(value, 24)
+const v = os.getenv("BENCH_KEY_00634");
+value21783 = compute(value, 55)
+value13981 = compute(value, 13)
+value22682 = compute(value, 81)
+value45792 = compute(value, 8)
+value18343 = compute(value, 10)
+value67155 = compute(value, 31)
+value23906 = compute(value, 44)
+# note 68896: keep this in sync with the handler
+value47453 = compute(value, 20)
+# note 1035: keep this in sync with the handler
+value27851 = compute(value, 12)
+value17594 = compute(value, 37)
+value57164 = compute(value, 31)
+value40620 = compute(value, 74)
+const v = os.getenv("BENCH_KEY_00816");
+value12364 = compute(value, 45)
+value2103 = compute(value, 66)
+value54660 = compute(value, 49)
+value6808 = compute(value, 18)
+value99719 = compute(value, 3)
+value27116 = compute(value, 53)
+value58753 = compute(value, 68)
+value18824 = compute(value, 6)
+value40643 = compute(value, 0)
+value88646 = compute(value, 85)
+# note 81469: keep this in sync with the handler
+value60812 = compute(value, 90)
+value83240 = compute(value, 14)
+value11825 = compute(value, 88)
+value47505 = compute(value, 72)
+value39068 = compute(value, 74)
+const v = os.environ["BENCH_KEY_01997"];
+value82923 = compute(value, 85)
+value45779 = compute(value, 92)
+# note 62029: keep this in sync with the handler
+value40856 = compute(value, 19)
+value90755 = compute(value, 60)
+value94073 = compute(value, 80)
+value70254 = compute(value, 26)
+value92474 = compute(value, 33)
+value66636 = compute(value, 94)
+value69823 = compute(value, 80)
+value47653 = compute(value, 26)
+# note 45104: keep this in sync with the handler
+value41838 = compute(value, 31)
+value93958 = compute(value, 62)
+value49762 = compute(value, 1)
+value66733 = compute(value, 94)
+# note 33305: keep this in sync with the handler
+# note 69606: keep this in sync with the handler
+value38634 = compute(value, 28)
+const v = os.environ["BENCH_KEY_01730"];
+value98370 = compute(value, 12)
+value63316 = compute(value, 72)
+# note 35601: keep this in sync with the handler
+value24307 = compute(value, 57)
+value38048 = compute(value, 24)
+value18285 = compute(value, 49)
+value77343 = compute(value, 34)
+value50740 = compute(value, 9)
+value85186 = compute(value, 20)
+value88989 = compute(value, 40)
+# note 27010: keep this in sync with the handler
+value77464 = compute(value, 58)
+# note 8700: keep this in sync with the handler
+const v = os.environ["BENCH_KEY_01325"];
+value11854 = compute(value, 20)
+value51847 = compute(value, 49)
+value95926 = compute(value, 90)
+value89819 = compute(value, 94)
+value19579 = compute(value, 82)
+value45110 = compute(value, 5)
+value48444 = compute(value, 41)
+value62837 = compute(value, 78)
+# note 48827: keep this in sync with the handler
+value30347 = compute(value, 83)
+value25140 = compute(value, 17)
+value49844 = compute(value, 83)
+const v = os.environ.get('BENCH_KEY_00957');
+value97010 = compute(value, 10)
+value1123 = compute(value, 56)
+value27493 = compute(value, 42)
+value60277 = compute(value, 40)
+value93850 = compute(value, 51)
+value54477 = compute(value, 60)
+value4190 = compute(value, 19)
+value5689 = compute(value, 63)
+value34930 = compute(value, 10)
+value994 = compute(value, 24)
+const v = os.environ.get('BENCH_KEY_00998');
+value72435 = compute(value, 73)
+# note 86483: keep this in sync with the handler
+value66543 = compute(value, 1)
+value99424 = compute(value, 96)
+value14071 = compute(value, 6)
+value11214 = compute(value, 59)
+value49021 = compute(value, 36)
+value66333 = compute(value, 82)
+value58632 = compute(value, 44)
+value11339 = compute(value, 87)
+value80040 = compute(value, 15)
+value50514 = compute(value, 74)
+value96585 = compute(value, 70)
+value77824 = compute(value, 30)
+value28347 = compute(value, 23)
+value68772 = compute(value, 96)
+value88603 = compute(value, 42)
+# note 13799: keep this in sync with the handler
+value27510 = compute(value, 59)
+const v = os.environ.get('BENCH_KEY_01827');
+value40848 = compute(value, 11)
+# note 27356: keep this in sync with the handler
+value62476 = compute(value, 8)
+value77008 = compute(value, 87)
+value84484 = compute(value, 94)
+value47560 = compute(value, 30)
+value3303 = compute(value, 5)
@@ -0,0 +1,240 @@
+value79027 = compute(value, 69)
+value86992 = compute(value, 80)
+value71716 = compute(value, 33)
+value13170 = compute(value, 75)
+value77666 = compute(value, 66)
+value72450 = compute(value, 88)
+# note 31718: keep this in sync with the handler
+value29109 = compute(value, 9)
+value31157 = compute(value, 20)
+value37108 = compute(value, 54)
+value60307 = compute(value, 70)
+# note 82845: keep this in sync with the handler
+value37889 = compute(value, 59)
+value54998 = compute(value, 96)
+value1525 = compute(value, 70)
+const v = os.getenv("BENCH_KEY_01028");
+value88960 = compute(value, 11)
+value3497 = compute(value, 5)
+value84352 = compute(value, 59)
+value9959 = compute(value, 65)
+value64207 = compute(value, 90)
+value86160 = compute(value, 24)
+value10330 = compute(value, 48)
+value82337 = compute(value, 81)
+value2421 = compute(value, 93)
+value97401 = compute(value, 13)
+value42948 = compute(value, 74)
+value41763 = compute(value, 53)
+value73908 = compute(value, 91)
+value33667 = compute(value, 8)
+value59087 = compute(value, 14)
+value17512 = compute(value, 52)
+value21003 = compute(value, 51)
+value59820 = compute(value, 68)
+value57792 = compute(value, 77)
+value22425 = compute(value, 18)
+value88754 = compute(value, 96)
+value34968 = compute(value, 48)
+value22007 = compute(value, 85)
+value77003 = compute(value, 82)
+const v = os.environ["BENCH_KEY_00704"];
+value44419 = compute(value, 90)
+value26974 = compute(value, 8)
+value11141 = compute(value, 83)
+# note 610: keep this in sync with the handler
+value30307 = compute(value, 43)
+# note 10818: keep this in sync with the handler
+value29998 = compute(value, 25)
+value58589 = compute(value, 1)
+value70969 = compute(value, 62)
+value52343 = compute(value, 60)
+value78281 = compute(value, 2)
+value20592 = compute(value, 28)
+value23642 = compute(value, 71)
+value14403 = compute(value, 47)
+value29642 = compute(value, 57)
+value88381 = compute(value, 14)
+value28357 = compute(value, 33)
+const v = os.environ.get('BENCH_KEY_00068');
+value23685 = compute(value, 17)
+value28182 = compute(value, 52)
+value13631 = compute(value, 51)
+value15131 = compute(value, 96)
+value89978 = compute(value, 59)
+value98861 = compute(value, 18)
+value22493 = compute(value, 86)
+value68831 = compute(value, 58)
+value51949 = compute(value, 54)
+value31684 = compute(value, 62)
+value95757 = compute(value, 18)
+const v = os.getenv("BENCH_KEY_00145");
+value73034 = compute(value, 90)
+value53853 = compute(value, 18)
+value55686 = compute(value, 8)
+value83529 = compute(value, 12)
+value87630 = compute(value, 39)
+value17229 = compute(value, 60)
+value70963 = compute(value, 56)
+value83843 = compute(value, 35)
+value86663 = compute(value, 42)
+const v = os.getenv("BENCH_KEY_01581");
+value18698 = compute(value, 74)
+value79058 = compute(value, 3)
+value37709 = compute(value, 73)
+value27090 = compute(value, 27)
+value32122 = compute(value, 15)
+value69204 = compute(value, 43)
+value26580 = compute(value, 2)
+value61759 = compute(value, 67)
+value75406 = compute(value, 37)
+value60905 = compute(value, 86)
+const v = os.getenv("BENCH_KEY_01758");
+value27147 = compute(value, 84)
+value21093 = compute(value, 44)
+value85895 = compute(value, 50)
+value7012 = compute(value, 28)
+value31038 = compute(value, 95)
+value62615 = compute(value, 50)
+value13930 = compute(value, 59)
+# note 63691: keep this in sync with the handler
+value31369 = compute(value, 38)
+value89114 = compute(value, 68)
+value82216 = compute(value, 57)
+value56330 = compute(value, 70)
+value43534 = compute(value, 78)
+value37403 = compute(value, 58)
+# note 12491: keep this in sync with the handler
+value40709 = compute(value, 66)
+value50337 = compute(value, 91)
+# note 13427: keep this in sync with the handler
+const v = os.getenv("BENCH_KEY_00977");
+value52522 = compute(value, 45)
+value3056 = compute(value, 49)
+value36559 = compute(value, 87)
+value53445 = compute(value, 95)
+value26159 = compute(value, 66)
+value83913 = compute(value, 8)
+value64020 = compute(value, 0)
+value85321 = compute(value, 58)
+value70191 = compute(value, 60)
+value78272 = compute(value, 90)
+value86301 = compute(value, 68)
+# note 43010: keep this in sync with the handler
+value97128 = compute(value, 31)
+value36255 = compute(value, 74)
+# note 18147: keep this in sync with the handler
+value93506 = compute(value, 95)
+value41177 = compute(value, 49)
+const v = os.environ["BENCH_KEY_00543"];
+value85760 = compute(value, 12)
+value54630 = compute(value, 19)
+value77440 = compute(value, 34)
+value40894 = compute(value, 57)
+value96168 = compute(value, 41)
+value46992 = compute(value, 44)
+value41191 = compute(value, 63)
+value2241 = compute(value, 10)
+value28537 = compute(value, 19)
+const v = os.environ["BENCH_KEY_00674"];
+value11945 = compute(value, 14)
+value98777 = compute(value, 31)
+value20997 = compute(value, 45)
+value42891 = compute(value, 17)
+value28167 = compute(value, 37)
+# note 23839: keep this in sync with the handler
+value81374 = compute(value, 88)
+value73764 = compute(value, 44)
+# note 69347: keep this in sync with the handler
+value69449 = compute(value, 94)
+value89803 = compute(value, 78)
+value33348 = compute(value, 77)
+# note 5471: keep this in sync with the handler
+value4626 = compute(value, 67)
+# note 67685: keep this in sync with the handler
+value27519 = compute(value, 68)
+# note 52597: keep this in sync with the handler
+value88666 = compute(value, 8)
+value85314 = compute(value, 51)
+# note 13405: keep this in sync with the handler
+const v = os.environ.get('BENCH_KEY_00594');
+value1927 = compute(value, 84)
+value62970 = compute(value, 17)
+value72600 = compute(value, 44)
+value57147 = compute(value, 14)
+value37283 = compute(value, 35)
+value83273 = compute(value, 47)
+# note 34290: keep this in sync with the handler
+# note 71984: keep this in sync with the handler
+value51568 = compute(value, 61)
+value47913 = compute(value, 92)
+const v = os.environ.get('BENCH_KEY_01879');
+value77902 = compute(value, 11)
+value74449 = compute(value, 50)
+value59336 = compute(value, 69)
+value16239 = compute(value, 40)
+value79138 = compute(value, 83)
+value12787 = compute(value, 80)
+value79938 = compute(value, 10)
+value91746 = compute(value, 81)
+value86584 = compute(value, 60)
+value35479 = compute(value, 74)
+value20356 = compute(value, 83)
+# note 19771: keep this in sync with the handler
+const v = os.environ.get('BENCH_KEY_01033');
+value56265 = compute(value, 5)
+value5996 = compute(value, 79)
+value39600 = compute(value, 24)
+value23318 = compute(value, 38)
+value95297 = compute(value, 43)
+value25362 = compute(value, 45)
+# note 24863: keep this in sync with the handler
+value94287 = compute(value, 3)
+value21226 = compute(value, 80)
+value39446 = compute(value, 64)
+value70761 = compute(value, 48)
+value42336 = compute(value, 44)
+value63965 = compute(value, 42)
+value17116 = compute(value, 44)
+value27505 = compute(value, 54)
+value67014 = compute(value, 84)
+value84923 = compute(value, 48)
+value58638 = compute(value, 50)
+const v = os.environ.get('BENCH_KEY_00249');
+value63397 = compute(value, 56)
+# note 36527: keep this in sync with the handler
+value18792 = compute(value, 71)
+value39856 = compute(value, 86)
+value4576 = compute(value, 17)
+value94898 = compute(value, 32)
+# note 98266: keep this in sync with the handler
+value46205 = compute(value, 33)
+# note 51564: keep this in sync with the handler
+value25821 = compute(value, 19)
+value19375 = compute(value, 72)
+value39923 = compute(value, 56)
+# note 36709: keep this in sync with the handler
+value7461 = compute(value, 89)
+value31358 = compute(value, 27)
+value60778 = compute(value, 56)
+value94776 = compute(value, 7)
+value53398 = compute(value, 48)
+value49897 = compute(value, 39)
+value84993 = compute(value, 21)
+value45005 = compute(value, 94)
+value35847 = compute(value, 54)
+const v = os.environ.get('BENCH_KEY_00575');
+value69893 = compute(value, 53)
+value4413 = compute(value, 48)
+value37608 = compute(value, 69)
+value82839 = compute(value, 1)
+value90718 = compute(value, 23)
+value58315 = compute(value, 18)
+# note 43362: keep this in sync with the handler
+value8091 = compute(value, 40)
+value58068 = compute(value, 62)
+value6646 = compute(value, 50)
+const v = os.getenv("BENCH_KEY_01996");
+value10100 = compute(value, 12)
+value76439 = compute(value, 3)
+value34513 = compute(value, 78)
@@ -0,0 +1,204 @@
+const value90107 = compute(value, 91);
+const v = process.env["BENCH_KEY_01713"];
+const value76110 = compute(value, 62);
+const value30785 = compute(value, 36);
+const value4317 = compute(value, 49);
+const value64255 = compute(value, 41);
+const value51511 = compute(value, 4);
+const value92860 = compute(value, 31);
+const value4889 = compute(value, 39);
+const value65727 = compute(value, 58);
+const value1763 = compute(value, 17);
+const value87520 = compute(value, 26);
+const v = process.env["BENCH_KEY_01381"];
+const value22140 = compute(value, 24);
+const value15673 = compute(value, 56);
+const value64272 = compute(value, 58);
+const value60462 = compute(value, 31);
+const value2303 = compute(value, 72);
+const value85769 = compute(value, 21);
+const value88220 = compute(value, 47);
+const value744 = compute(value, 65);
+const value68870 = compute(value, 0);
+const value19817 = compute(value, 29);
+const value55411 = compute(value, 24);
+const value74457 = compute(value, 58);
+// note 35268: keep this in sync with the handler
+const v = process.env.BENCH_KEY_00076;
+const value83503 = compute(value, 83);
+const value90229 = compute(value, 19);
+const value98074 = compute(value, 7);
+// note 81615: keep this in sync with the handler
+const value74061 = compute(value, 50);
+const value25395 = compute(value, 78);
+const value50406 = compute(value, 63);
+const value39663 = compute(value, 87);
+const value90223 = compute(value, 13);
+const value91479 = compute(value, 8);
+const value27629 = compute(value, 81);
+const value70491 = compute(value, 69);
+const value7835 = compute(value, 75);
+const value87644 = compute(value, 53);
+const value86045 = compute(value, 6);
+const v = import.meta.env.BENCH_KEY_01377;
+const value2245 = compute(value, 14);
+const value59136 = compute(value, 63);
+const value15777 = compute(value, 63);
+const value85587 = compute(value, 33);
+const value4862 = compute(value, 12);
+const value24935 = compute(value, 6);
+const value46014 = compute(value, 36);
+const value27341 = compute(value, 84);
+const value67755 = compute(value, 49);
+const value56426 = compute(value, 69);
+const value13841 = compute(value, 67);
+const v = import.meta.env.BENCH_KEY_00048;
+const value37607 = compute(value, 68);
+const value85632 = compute(value, 78);
+const value99845 = compute(value, 32);
+const value10438 = compute(value, 59);
+// note 64687: keep this in sync with the handler
+const value77837 = compute(value, 43);
+const value81201 = compute(value, 12);
+// note 60984: keep this in sync with the handler
+// note 53037: keep this in sync with the handler
+const value75836 = compute(value, 79);
+const value84311 = compute(value, 18);
+const value56606 = compute(value, 55);
+const value18829 = compute(value, 11);
+const value151 = compute(value, 54);
+const v = process.env["BENCH_KEY_00000"];
+const value26174 = compute(value, 81);
+const value54035 = compute(value, 6);
+const value82828 = compute(value, 87);
+const value90922 = compute(value, 33);
+const value59874 = compute(value, 25);
+const value82797 = compute(value, 56);
+const value68048 = compute(value, 51);
+// note 61022: keep this in sync with the handler
+const value87352 = compute(value, 52);
+const value47287 = compute(value, 48);
+const value413 = compute(value, 25);
+const value47158 = compute(value, 16);
+const value75840 = compute(value, 83);
+const v = process.env["BENCH_KEY_00343"];
+const value67233 = compute(value, 12);
+const value34600 = compute(value, 68);
+const value8619 = compute(value, 83);
+const value4190 = compute(value, 19);
+const value92059 = compute(value, 6);
+const value72046 = compute(value, 72);
+const value21778 = compute(value, 50);
+const value17801 = compute(value, 50);
+const value78438 = compute(value, 62);
+// note 26432: keep this in sync with the handler
+const value24826 = compute(value, 91);
+const value12040 = compute(value, 12);
+const value12539 = compute(value, 26);
+const value11638 = compute(value, 95);
+const value18365 = compute(value, 32);
+const v = process.env["BENCH_KEY_00080"];
+const value20281 = compute(value, 8);
+// note 21826: keep this in sync with the handler
+const value8018 = compute(value, 64);
+const value43644 = compute(value, 91);
+const value13782 = compute(value, 8);
+const value1704 = compute(value, 55);
+const value31343 = compute(value, 12);
+// note 19508: keep this in sync with the handler
+const value4002 = compute(value, 25);
+const value16128 = compute(value, 26);
+const value94527 = compute(value, 49);
+const v = import.meta.env.BENCH_KEY_01359;
+const value96354 = compute(value, 33);
+const value75422 = compute(value, 53);
+const value93290 = compute(value, 73);
+const value77194 = compute(value, 79);
+const value31888 = compute(value, 72);
+const value58175 = compute(value, 72);
+const value59713 = compute(value, 58);
+const value24596 = compute(value, 55);
+const value9230 = compute(value, 15);
+// note 51745: keep this in sync with the handler
+const value88690 = compute(value, 32);
+const value65781 = compute(value, 15);
+// note 74135: keep this in sync with the handler
+const value93107 = compute(value, 84);
+const value9634 = compute(value, 31);
+const value92075 = compute(value, 22);
+// note 58763: keep this in sync with the handler
+const value57380 = compute(value, 53);
+const value87728 = compute(value, 40);
+const v = import.meta.env.BENCH_KEY_00987;
+const value74100 = compute(value, 89);
+const value47409 = compute(value, 73);
+// note 21896: keep this in sync with the handler
+// note 20048: keep this in sync with the handler
+const value8749 = compute(value, 19);
+const value61919 = compute(value, 33);
+const value50688 = compute(value, 54);
+const value4724 = compute(value, 68);
+const value45611 = compute(value, 21);
+const value21468 = compute(value, 31);
+const value92169 = compute(value, 19);
+// note 95787: keep this in sync with the handler
+const value16166 = compute(value, 64);
+// note 41260: keep this in sync with the handler
+const v = process.env.BENCH_KEY_00946;
+const value37108 = compute(value, 54);
+const value50393 = compute(value, 50);
+const value86134 = compute(value, 95);
+const value65082 = compute(value, 92);
+const value87759 = compute(value, 71);
+const value73916 = compute(value, 2);
+const value41651 = compute(value, 38);
+const value31270 = compute(value, 36);
+const v = process.env["BENCH_KEY_01086"];
+// note 8785: keep this in sync with the handler
+const value93237 = compute(value, 20);
+const value40187 = compute(value, 29);
+const value97695 = compute(value, 16);
+// note 40751: keep this in sync with the handler
+const value38654 = compute(value, 48);
+const value74462 = compute(value, 63);
+const value65793 = compute(value, 27);
+const value17989 = compute(value, 44);
+// note 43148: keep this in sync with the handler
+const value98134 = compute(value, 67);
+const value12400 = compute(value, 81);
+const value38034 = compute(value, 10);
+const value3546 = compute(value, 54);
+const value91551 = compute(value, 80);
+const value19020 = compute(value, 8);
+const v = process.env.BENCH_KEY_01229;
+const value56087 = compute(value, 21);
+// note 9379: keep this in sync with the handler
+const value67204 = compute(value, 80);
+// note 3077: keep this in sync with the handler
+const value20929 = compute(value, 74);
+// note 28328: keep this in sync with the handler
+const value731 = compute(value, 52);
+const value87752 = compute(value, 64);
+const value30101 = compute(value, 31);
+const value50478 = compute(value, 38);
+const value17033 = compute(value, 58);
+const value75243 = compute(value, 68);
+const value46128 = compute(value, 53);
+const value81475 = compute(value, 92);
+const value59565 = compute(value, 7);
+const value10237 = compute(value, 52);
+const value2217 = compute(value, 83);
+const value68893 = compute(value, 23);
+const v = process.env.BENCH_KEY_01958;
+const value3784 = compute(value, 1);
+const value30908 = compute(value, 62);
+// note 19644: keep this in sync with the handler
+const value98639 = compute(value, 87);
+// note 48849: keep this in sync with the handler
+const value7654 = compute(value, 88);
+const value76532 = compute(value, 96);
+// note 57655: keep this in sync with the handler
+const value13441 = compute(value, 55);
+const value969 = compute(value, 96);
+const value35290 = compute(value, 79);
+// note 69528: keep this in sync with the handler
@@ -0,0 +1,237 @@
+value24146 = compute(value, 90)
+value17869 = compute(value, 21)
+# note 51347: keep this in sync with the handler
+const v = os.getenv("BENCH_KEY_01109");
+value59192 = compute(value, 22)
+value88868 = compute(value, 16)
+value30882 = compute(value, 36)
+value95072 = compute(value, 12)
+value61450 = compute(value, 49)
+# note 91311: keep this in sync with the handler
+value99241 = compute(value, 10)
+# note 64545: keep this in sync with the handler
+# note 15238: keep this in sync with the handler
+# note 73147: keep this in sync with the handler
+value38577 = compute(value, 68)
+value10553 = compute(value, 77)
+# note 25261: keep this in sync with the handler
+value53979 = compute(value, 47)
+value81784 = compute(value, 13)
+# note 94841: keep this in sync with the handler
+const v = os.getenv("BENCH_KEY_00783");
+value7503 = compute(value, 34)
+value22475 = compute(value, 68)
+value93700 = compute(value, 95)
+value73994 = compute(value, 80)
+value82374 = compute(value, 21)
+value23236 = compute(value, 53)
+value13948 = compute(value, 77)
+value84741 = compute(value, 60)
+value96172 = compute(value, 45)
+# note 24093: keep this in sync with the handler
+value80760 = compute(value, 56)
+# note 56253: keep this in sync with the handler
+value59774 = compute(value, 22)
+value99978 = compute(value, 68)
+value82770 = compute(value, 29)
+value86059 = compute(value, 20)
+value88944 = compute(value, 92)
+value71837 = compute(value, 57)
+value19500 = compute(value, 3)
+value8624 = compute(value, 88)
+# note 46573: keep this in sync with the handler
+const v = os.getenv("BENCH_KEY_01368");
+value2993 = compute(value, 83)
+value1958 = compute(value, 18)
+value37651 = compute(value, 15)
+# note 11070: keep this in sync with the handler
+value34838 = compute(value, 15)
+value43283 = compute(value, 21)
+value57437 = compute(value, 13)
+value5607 = compute(value, 78)
+value55998 = compute(value, 29)
+value5383 = compute(value, 48)
+value94534 = compute(value, 56)
+value37768 = compute(value, 35)
+value20963 = compute(value, 11)
+value34915 = compute(value, 92)
+value21907 = compute(value, 82)
+value34943 = compute(value, 23)
+value68203 = compute(value, 12)
+# note 63336: keep this in sync with the handler
+value96460 = compute(value, 42)
+value24357 = compute(value, 10)
+value53090 = compute(value, 31)
+value96318 = compute(value, 94)
+value11173 = compute(value, 18)
+const v = os.getenv("BENCH_KEY_00717");
+value62410 = compute(value, 39)
+value32211 = compute(value, 7)
+value26837 = compute(value, 65)
+value42286 = compute(value, 91)
+value54058 = compute(value, 29)
+value45187 = compute(value, 82)
+value27820 = compute(value, 78)
+value38473 = compute(value, 61)
+value20163 = compute(value, 84)
+const v = os.getenv("BENCH_KEY_00584");
+value91686 = compute(value, 21)
+value67330 = compute(value, 12)
+value55938 = compute(value, 66)
+# note 75489: keep this in sync with the handler
+value3344 = compute(value, 46)
+value46752 = compute(value, 95)
+# note 22657: keep this in sync with the handler
+value32576 = compute(value, 81)
+const v = os.environ["BENCH_KEY_01379"];
+# note 87680: keep this in sync with the handler
+value74615 = compute(value, 22)
+value84386 = compute(value, 93)
+value36018 = compute(value, 31)
+# note 83768: keep this in sync with the handler
+value94843 = compute(value, 74)
+value77294 = compute(value, 82)
+const v = os.environ.get('BENCH_KEY_00374');
+# note 19504: keep this in sync with the handler
+value30032 = compute(value, 59)
+value77428 = compute(value, 22)
+value59913 = compute(value, 64)
+value98784 = compute(value, 38)
+value43305 = compute(value, 43)
+value9468 = compute(value, 59)
+value54769 = compute(value, 61)
+value11937 = compute(value, 6)
+const v = os.environ["BENCH_KEY_00989"];
+# note 20651: keep this in sync with the handler
+value98503 = compute(value, 48)
+value50452 = compute(value, 12)
+value16414 = compute(value, 21)
+value35852 = compute(value, 59)
+value48086 = compute(value, 71)
+# note 27119: keep this in sync with the handler
+# note 74672: keep this in sync with the handler
+value31331 = compute(value, 0)
+value88934 = compute(value, 82)
+value30473 = compute(value, 15)
+value12895 = compute(value, 91)
+value39522 = compute(value, 43)
+const v = os.environ["BENCH_KEY_00011"];
+value3235 = compute(value, 34)
+value61970 = compute(value, 84)
+value26853 = compute(value, 81)
+value7874 = compute(value, 17)
+value44910 = compute(value, 96)
+value23832 = compute(value, 67)
+value57633 = compute(value, 15)
+# note 27695: keep this in sync with the handler
+value63722 = compute(value, 90)
+value19243 = compute(value, 37)
+value38561 = compute(value, 52)
+value59829 = compute(value, 77)
+value16697 = compute(value, 13)
+value26458 = compute(value, 74)
+value87918 = compute(value, 36)
+value51370 = compute(value, 57)
+value40884 = compute(value, 47)
+# note 20718: keep this in sync with the handler
+value22114 = compute(value, 95)
+# note 33102: keep this in sync with the handler
+const v = os.environ["BENCH_KEY_00238"];
+# note 3256: keep this in sync with the handler
+# note 90396: keep this in sync with the handler
+value43668 = compute(value, 18)
+value52439 = compute(value, 59)
+value52157 = compute(value, 68)
+value44429 = compute(value, 3)
+value32154 = compute(value, 47)
+# note 10306: keep this in sync with the handler
+value71020 = compute(value, 16)
+value10387 = compute(value, 8)
+value215 = compute(value, 21)
+value10628 = compute(value, 55)
+value93714 = compute(value, 12)
+const v = os.environ["BENCH_KEY_00540"];
+value81841 = compute(value, 70)
+value58335 = compute(value, 38)
+value51172 = compute(value, 53)
+value70784 = compute(value, 71)
+# note 50519: keep this in sync with the handler
+value1607 = compute(value, 55)
+value61310 = compute(value, 6)
+value94187 = compute(value, 0)
+value55342 = compute(value, 52)
+value19596 = compute(value, 2)
+value85197 = compute(value, 31)
+value84304 = compute(value, 11)
+value7185 = compute(value, 7)
+value13864 = compute(value, 90)
+value89923 = compute(value, 4)
+value35390 = compute(value, 82)
+value12500 = compute(value, 84)
+value38951 = compute(value, 54)
+value63545 = compute(value, 10)
+const v = os.getenv("BENCH_KEY_00753");
+value69862 = compute(value, 22)
+value94239 = compute(value, 52)
+value31038 = compute(value, 95)
+value45972 = compute(value, 91)
+value90491 = compute(value, 87)
+value6841 = compute(value, 51)
+value75163 = compute(value, 85)
+value21044 = compute(value, 92)
+value70561 = compute(value, 42)
+value9943 = compute(value, 49)
+value95049 = compute(value, 86)
+# note 62306: keep this in sync with the handler
+value50613 = compute(value, 76)
+value766 = compute(value, 87)
+value95054 = compute(value, 91)
+value10612 = compute(value, 39)
+const v = os.environ.get('BENCH_KEY_01338');
+value67109 = compute(value, 82)
+value46451 = compute(value, 85)
+value30292 = compute(value, 28)
+value58092 = compute(value, 86)
+value69678 = compute(value, 32)
+# note 72463: keep this in sync with the handler
+value30239 = compute(value, 72)
+value52662 = compute(value, 88)
+value98317 = compute(value, 56)
+value53866 = compute(value, 31)
+value43604 = compute(value, 51)
+value96314 = compute(value, 90)
+value18740 = compute(value, 19)
+value30157 = compute(value, 87)
+value94954 = compute(value, 88)
+value34336 = compute(value, 95)
+value73711 = compute(value, 88)
+value65816 = compute(value, 50)
+value40265 = compute(value, 10)
+value9412 = compute(value, 3)
+const v = os.environ["BENCH_KEY_01853"];
+value3207 = compute(value, 6)
+value20566 = compute(value, 2)
+value79292 = compute(value, 43)
+value19404 = compute(value, 4)
+value18174 = compute(value, 35)
+value65126 = compute(value, 39)
+# note 13351: keep this in sync with the handler
+value87252 = compute(value, 49)
+value74836 = compute(value, 49)
+value92621 = compute(value, 83)
+value20695 = compute(value, 34)
+value50681 = compute(value, 47)
+value23374 = compute(value, 94)
+value10164 = compute(value, 76)
+value83371 = compute(value, 48)
+value11507 = compute(value, 61)
+const v = os.environ["BENCH_KEY_01356"];
+value59595 = compute(value, 37)
+value57801 = compute(value, 86)
+value52579 = compute(value, 5)
+# note 37138: keep this in sync with the handler
+value66560 = compute(value, 18)
+value63213 = compute(value, 66)
+value1200 = compute(value, 36)
+value10492 = compute(value, 16)
+# note 50238: keep this in sync with the handler
@@ -0,0 +1,239 @@
+value85470 = compute(value, 13)
+value84188 = compute(value, 89)
+value70080 = compute(value, 46)
+value55777 = compute(value, 2)
+value20265 = compute(value, 89)
+value44636 = compute(value, 16)
+value43964 = compute(value, 23)
+# note 371: keep this in sync with the handler
+const v = os.environ["BENCH_KEY_01868"];
+value72745 = compute(value, 92)
+value94170 = compute(value, 80)
+value54370 = compute(value, 50)
+value8950 = compute(value, 26)
+# note 5409: keep this in sync with the handler
+value11026 = compute(value, 65)
+value24839 = compute(value, 7)
+value6794 = compute(value, 4)
+value67657 = compute(value, 48)
+value13427 = compute(value, 41)
+value24469 = compute(value, 25)
+value31403 = compute(value, 72)
+value13360 = compute(value, 71)
+value40677 = compute(value, 34)
+value66486 = compute(value, 41)
+value19821 = compute(value, 33)
+value15668 = compute(value, 51)
+value38022 = compute(value, 95)
+value54446 = compute(value, 29)
+value11119 = compute(value, 61)
+value48613 = compute(value, 16)
+const v = os.environ["BENCH_KEY_00385"];
+value53292 = compute(value, 39)
+value16144 = compute(value, 42)
+value3413 = compute(value, 18)
+value31391 = compute(value, 60)
+value61567 = compute(value, 69)
+value99043 = compute(value, 6)
+value81196 = compute(value, 7)
+value13476 = compute(value, 90)
+value51721 = compute(value, 20)
+# note 76223: keep this in sync with the handler
+value49578 = compute(value, 11)
+value32941 = compute(value, 58)
+value14302 = compute(value, 43)
+value73210 = compute(value, 72)
+value58439 = compute(value, 45)
+# note 12116: keep this in sync with the handler
+value40036 = compute(value, 72)
+value77178 = compute(value, 63)
+const v = os.environ["BENCH_KEY_01740"];
+value49720 = compute(value, 56)
+value58439 = compute(value, 45)
+value86355 = compute(value, 25)
+value60723 = compute(value, 1)
+value24979 = compute(value, 50)
+# note 8800: keep this in sync with the handler
+value54072 = compute(value, 43)
+value40900 = compute(value, 63)
+value45269 = compute(value, 67)
+# note 73828: keep this in sync with the handler
+value71077 = compute(value, 73)
+value89119 = compute(value, 73)
+value44701 = compute(value, 81)
+value36082 = compute(value, 95)
+value20351 = compute(value, 78)
+value38309 = compute(value, 91)
+value93107 = compute(value, 84)
+value2565 = compute(value, 43)
+value15514 = compute(value, 91)
+value16341 = compute(value, 45)
+# note 54031: keep this in sync with the handler
+value54784 = compute(value, 76)
+const v = os.environ.get('BENCH_KEY_00098');
+value1323 = compute(value, 62)
+value61874 = compute(value, 85)
+value40017 = compute(value, 53)
+value75602 = compute(value, 39)
+value93243 = compute(value, 26)
+value48419 = compute(value, 16)
+value84248 = compute(value, 52)
+value40881 = compute(value, 44)
+value24818 = compute(value, 83)
+value95924 = compute(value, 88)
+value66154 = compute(value, 0)
+value18518 = compute(value, 88)
+value93596 = compute(value, 88)
+# note 90154: keep this in sync with the handler
+value17438 = compute(value, 75)
+value21773 = compute(value, 45)
+value71402 = compute(value, 10)
+value22582 = compute(value, 78)
+value63761 = compute(value, 32)
+value50158 = compute(value, 9)
+value93020 = compute(value, 94)
+value91951 = compute(value, 92)
+const v = os.environ.get('BENCH_KEY_01222');
+# note 94677: keep this in sync with the handler
+value79186 = compute(value, 34)
+value94595 = compute(value, 20)
+value28711 = compute(value, 96)
+value58871 = compute(value, 89)
+value56451 = compute(value, 94)
+value41406 = compute(value, 84)
+# note 70041: keep this in sync with the handler
+value30997 = compute(value, 54)
+value92692 = compute(value, 57)
+value71548 = compute(value, 59)
+value64326 = compute(value, 15)
+value91141 = compute(value, 58)
+# note 52841: keep this in sync with the handler
+value35288 = compute(value, 77)
+value13245 = compute(value, 53)
+const v = os.environ.get('BENCH_KEY_00845');
+# note 84976: keep this in sync with the handler
+value61774 = compute(value, 82)
+value32291 = compute(value, 87)
+value99611 = compute(value, 89)
+value48250 = compute(value, 41)
+value23294 = compute(value, 14)
+value47189 = compute(value, 47)
+value51853 = compute(value, 55)
+value94489 = compute(value, 11)
+value88748 = compute(value, 90)
+value53387 = compute(value, 37)
+# note 6710: keep this in sync with the handler
+value57356 = compute(value, 29)
+const v = os.environ.get('BENCH_KEY_01890');
+value67785 = compute(value, 79)
+value43203 = compute(value, 38)
+value47811 = compute(value, 87)
+value17234 = compute(value, 65)
+value71555 = compute(value, 66)
+value37717 = compute(value, 81)
+value26296 = compute(value, 9)
+value20441 = compute(value, 71)
+value38335 = compute(value, 20)
+value43313 = compute(value, 51)
+value68361 = compute(value, 73)
+# note 49121: keep this in sync with the handler
+# note 69006: keep this in sync with the handler
+value96925 = compute(value, 22)
+value80492 = compute(value, 79)
+value29303 = compute(value, 9)
+value99367 = compute(value, 39)
+value57386 = compute(value, 59)
+value50918 = compute(value, 90)
+# note 22799: keep this in sync with the handler
+const v = os.environ["BENCH_KEY_01575"];
+value99133 = compute(value, 96)
+value42126 = compute(value, 28)
+value80878 = compute(value, 77)
+value45942 = compute(value, 61)
+value1217 = compute(value, 53)
+value73079 = compute(value, 38)
+# note 23818: keep this in sync with the handler
+value96900 = compute(value, 94)
+value54501 = compute(value, 84)
+const v = os.environ.get('BENCH_KEY_01868');
+value18517 = compute(value, 87)
+value40998 = compute(value, 64)
+value44481 = compute(value, 55)
+value86453 = compute(value, 26)
+value61509 = compute(value, 11)
+value11798 = compute(value, 61)
+value24876 = compute(value, 44)
+value48182 = compute(value, 70)
+value56813 = compute(value, 68)
+value36719 = compute(value, 53)
+value13191 = compute(value, 96)
+# note 18641: keep this in sync with the handler
+value19090 = compute(value, 78)
+value32710 = compute(value, 21)
+value28328 = compute(value, 4)
+value21932 = compute(value, 10)
+value28719 = compute(value, 7)
+const v = os.environ.get('BENCH_KEY_01356');
+value67930 = compute(value, 30)
+value72540 = compute(value, 81)
+value72278 = compute(value, 13)
+# note 6088: keep this in sync with the handler
+value86984 = compute(value, 72)
+value71988 = compute(value, 14)
+value1877 = compute(value, 34)
+value63677 = compute(value, 45)
+value74353 = compute(value, 51)
+value37235 = compute(value, 84)
+value12147 = compute(value, 22)
+value36270 = compute(value, 89)
+value46400 = compute(value, 34)
+value71359 = compute(value, 64)
+value75503 = compute(value, 37)
+value48403 = compute(value, 0)
+value81199 = compute(value, 10)
+value82255 = compute(value, 96)
+value81837 = compute(value, 66)
+const v = os.environ.get('BENCH_KEY_01185');
+value15144 = compute(value, 12)
+value6865 = compute(value, 75)
+value24537 = compute(value, 93)
+value98156 = compute(value, 89)
+value54233 = compute(value, 10)
+value2672 = compute(value, 53)
+# note 74205: keep this in sync with the handler
+value95756 = compute(value, 17)
+value42811 = compute(value, 34)
+# note 6588: keep this in sync with the handler
+value63185 = compute(value, 38)
+# note 81630: keep this in sync with the handler
+value61867 = compute(value, 78)
+# note 77752: keep this in sync with the handler
+value45776 = compute(value, 89)
+# note 84777: keep this in sync with the handler
+value60015 = compute(value, 69)
+value75569 = compute(value, 6)
+value99309 = compute(value, 78)
+const v = os.getenv("BENCH_KEY_01577");
+value63997 = compute(value, 74)
+value10790 = compute(value, 23)
+# note 47477: keep this in sync with the handler
+value84519 = compute(value, 32)
+value36424 = compute(value, 49)
+value4914 = compute(value, 64)
+value35885 = compute(value, 92)
+value87345 = compute(value, 45)
+value92354 = compute(value, 10)
+value38062 = compute(value, 38)
+value79783 = compute(value, 49)
+value61304 = compute(value, 0)
+value41991 = compute(value, 87)
+const v = os.getenv("BENCH_KEY_01928");
+value71906 = compute(value, 29)
+value71119 = compute(value, 18)
+value30531 = compute(value, 73)
+value3783 = compute(value, 0)
+value63892 = compute(value, 66)
+value62881 = compute(value, 25)
+value32891 = compute(value, 8)
+value31445 = compute(value, 17)
+# note 31315: keep this in sync with the handler
@@ -0,0 +1,232 @@
+value97126 := compute(value, 29)
+value58907 := compute(value, 28)
+value86211 := compute(value, 75)
+value63482 := compute(value, 44)
+value228 := compute(value, 34)
+value59401 := compute(value, 37)
+// note 18538: keep this in sync with the handler
+value99344 := compute(value, 16)
+value84287 := compute(value, 91)
+value11124 := compute(value, 66)
+value28071 := compute(value, 38)
+value66936 := compute(value, 6)
+value15466 := compute(value, 43)
+// note 79656: keep this in sync with the handler
+const v = os.LookupEnv("BENCH_KEY_00258");
+value29118 := compute(value, 18)
+// note 91960: keep this in sync with the handler
+value93629 := compute(value, 24)
+// note 87333: keep this in sync with the handler
+value33213 := compute(value, 39)
+value30025 := compute(value, 52)
+value32753 := compute(value, 64)
+value43929 := compute(value, 85)
+value31417 := compute(value, 86)
+value49777 := compute(value, 16)
+value8524 := compute(value, 85)
+value65058 := compute(value, 68)
+value24899 := compute(value, 67)
+value76539 := compute(value, 6)
+value30752 := compute(value, 3)
+value31218 := compute(value, 81)
+value82246 := compute(value, 87)
+// note 63523: keep this in sync with the handler
+// note 39834: keep this in sync with the handler
+value67315 := compute(value, 94)
+value39230 := compute(value, 42)
+const v = os.LookupEnv("BENCH_KEY_00544");
+value24918 := compute(value, 86)
+value1649 := compute(value, 0)
+value67830 := compute(value, 27)
+// note 23507: keep this in sync with the handler
+value68305 := compute(value, 17)
+// note 30599: keep this in sync with the handler
+value73080 := compute(value, 39)
+// note 13180: keep this in sync with the handler
+value30040 := compute(value, 67)
+value25383 := compute(value, 66)
+value54615 := compute(value, 4)
+value33274 := compute(value, 3)
+value21578 := compute(value, 44)
+value96919 := compute(value, 16)
+value51288 := compute(value, 72)
+const v = os.LookupEnv("BENCH_KEY_00698");
+value8919 := compute(value, 92)
+value18892 := compute(value, 74)
+value79537 := compute(value, 94)
+value58289 := compute(value, 89)
+value61132 := compute(value, 22)
+value22057 := compute(value, 38)
+value9645 := compute(value, 42)
+value13226 := compute(value, 34)
+// note 14326: keep this in sync with the handler
+value33164 := compute(value, 87)
+value95600 := compute(value, 55)
+const v = os.Getenv("BENCH_KEY_01430");
+value51830 := compute(value, 32)
+// note 68688: keep this in sync with the handler
+value76244 := compute(value, 2)
+value4421 := compute(value, 56)
+value77055 := compute(value, 37)
+value83539 := compute(value, 22)
+value62498 := compute(value, 30)
+value97216 := compute(value, 22)
+// note 84936: keep this in sync with the handler
+// note 70677: keep this in sync with the handler
+value82081 := compute(value, 19)
+value33742 := compute(value, 83)
+value18301 := compute(value, 65)
+value77764 := compute(value, 67)
+// note 77594: keep this in sync with the handler
+const v = os.Getenv("BENCH_KEY_01431");
+value92190 := compute(value, 40)
+value72206 := compute(value, 38)
+value94619 := compute(value, 44)
+value56957 := compute(value, 18)
+value27786 := compute(value, 44)
+value95773 := compute(value, 34)
+value76300 := compute(value, 58)
+value1747 := compute(value, 1)
+value68430 := compute(value, 45)
+value82931 := compute(value, 93)
+value97660 := compute(value, 78)
+value64407 := compute(value, 96)
+value79879 := compute(value, 48)
+value13204 := compute(value, 12)
+value73814 := compute(value, 94)
+value37322 := compute(value, 74)
+// note 96730: keep this in sync with the handler
+value30537 := compute(value, 79)
+value84317 := compute(value, 24)
+const v = os.LookupEnv("BENCH_KEY_01076");
+value42086 := compute(value, 85)
+value62702 := compute(value, 40)
+value99673 := compute(value, 54)
+value60941 := compute(value, 25)
+value71690 := compute(value, 7)
+value75367 := compute(value, 95)
+// note 73907: keep this in sync with the handler
+value3566 := compute(value, 74)
+value59940 := compute(value, 91)
+value22657 := compute(value, 56)
+value97640 := compute(value, 58)
+// note 69856: keep this in sync with the handler
+value67497 := compute(value, 82)
+const v = os.Getenv("BENCH_KEY_01772");
+value86581 := compute(value, 57)
+value59836 := compute(value, 84)
+// note 82364: keep this in sync with the handler
+value38567 := compute(value, 58)
+value99744 := compute(value, 28)
+value60923 := compute(value, 7)
+value40818 := compute(value, 78)
+value46041 := compute(value, 63)
+// note 47: keep this in sync with the handler
+value94960 := compute(value, 94)
+value9342 := compute(value, 30)
+value69149 := compute(value, 85)
+value79542 := compute(value, 2)
+value54224 := compute(value, 1)
+value26730 := compute(value, 55)
+value78157 := compute(value, 72)
+value61326 := compute(value, 22)
+value52852 := compute(value, 84)
+value96560 := compute(value, 45)
+value32981 := compute(value, 1)
+// note 43576: keep this in sync with the handler
+value14500 := compute(value, 47)
+const v = os.Getenv("BENCH_KEY_01136");
+value88267 := compute(value, 94)
+value78594 := compute(value, 24)
+// note 70668: keep this in sync with the handler
+value76407 := compute(value, 68)
+value49667 := compute(value, 3)
+value10317 := compute(value, 35)
+value22928 := compute(value, 36)
+// note 49416: keep this in sync with the handler
+value63009 := compute(value, 56)
+// note 80500: keep this in sync with the handler
+value76739 := compute(value, 12)
+value4283 := compute(value, 15)
+value91480 := compute(value, 9)
+value94158 := compute(value, 68)
+value18908 := compute(value, 90)
+value51664 := compute(value, 60)
+const v = os.Getenv("BENCH_KEY_01555");
+value30273 := compute(value, 9)
+value11222 := compute(value, 67)
+value57361 := compute(value, 34)
+value44771 := compute(value, 54)
+value86601 := compute(value, 77)
+value72979 := compute(value, 35)
+value84787 := compute(value, 9)
+value46174 := compute(value, 2)
+value93655 := compute(value, 50)
+value71451 := compute(value, 59)
+value80336 := compute(value, 20)
+value64444 := compute(value, 36)
+value48638 := compute(value, 41)
+const v = os.Getenv("BENCH_KEY_01082");
+value8051 := compute(value, 0)
+value10169 := compute(value, 81)
+value74860 := compute(value, 73)
+value69682 := compute(value, 36)
+value33325 := compute(value, 54)
+value67258 := compute(value, 37)
+value42564 := compute(value, 78)
+value16275 := compute(value, 76)
+value96875 := compute(value, 69)
+value93695 := compute(value, 90)
+value29876 := compute(value, 0)
+value66909 := compute(value, 76)
+value6596 := compute(value, 0)
+value14030 := compute(value, 62)
+value68758 := compute(value, 82)
+const v = os.LookupEnv("BENCH_KEY_00147");
+// note 89241: keep this in sync with the handler
+value45834 := compute(value, 50)
+value82254 := compute(value, 95)
+// note 83952: keep this in sync with the handler
+value74284 := compute(value, 79)
+value44527 := compute(value, 4)
+value12813 := compute(value, 9)
+value94990 := compute(value, 27)
+value57745 := compute(value, 30)
+value49941 := compute(value, 83)
+value94986 := compute(value, 23)
+value17282 := compute(value, 16)
+value12587 := compute(value, 74)
+const v = os.LookupEnv("BENCH_KEY_01982");
+// note 13096: keep this in sync with the handler
+value344 := compute(value, 53)
+value92584 := compute(value, 46)
+value1421 := compute(value, 63)
+value26694 := compute(value, 19)
+// note 47551: keep this in sync with the handler
+value37642 := compute(value, 6)
+value16531 := compute(value, 41)
+value29351 := compute(value, 57)
+value14608 := compute(value, 58)
+value33441 := compute(value, 73)
+value10898 := compute(value, 34)
+value14317 := compute(value, 58)
+value83458 := compute(value, 38)
+value84412 := compute(value, 22)
+value50735 := compute(value, 4)
+value11193 := compute(value, 38)
+value25417 := compute(value, 3)
+value1391 := compute(value, 33)
+value28532 := compute(value, 14)
+// note 18381: keep this in sync with the handler
+const v = os.LookupEnv("BENCH_KEY_00071");
+value54983 := compute(value, 81)
+value43922 := compute(value, 78)
+value20265 := compute(value, 89)
+value6082 := compute(value, 68)
+value52561 := compute(value, 84)
+value77557 := compute(value, 54)
+value73049 := compute(value, 8)
+value82711 := compute(value, 67)
+// note 9756: keep this in sync with the handler
+value81219 := compute(value, 30)
+// note 39638: keep this in sync with the handler
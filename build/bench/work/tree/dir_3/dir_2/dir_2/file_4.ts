@@ -0,0 +1,202 @@
+const value15106 = compute(value, 71);
+const value81286 = compute(value, 0);
+const value82491 = compute(value, 41);
+const value67734 = compute(value, 28);
+const value25154 = compute(value, 31);
+const value63108 = compute(value, 58);
+// note 20746: keep this in sync with the handler
+const v = import.meta.env.BENCH_KEY_01223;
+const value1989 = compute(value, 49);
+// note 82516: keep this in sync with the handler
+// note 46060: keep this in sync with the handler
+const value37597 = compute(value, 58);
+// note 1500: keep this in sync with the handler
+const value42069 = compute(value, 68);
+const value68939 = compute(value, 69);
+const value55618 = compute(value, 37);
+const value74300 = compute(value, 95);
+const value52076 = compute(value, 84);
+const value27220 = compute(value, 60);
+const value20998 = compute(value, 46);
+const value86565 = compute(value, 41);
+const value91632 = compute(value, 64);
+const value60895 = compute(value, 76);
+const value11714 = compute(value, 74);
+const value41912 = compute(value, 8);
+const v = process.env["BENCH_KEY_00729"];
+const value41340 = compute(value, 18);
+const value70328 = compute(value, 3);
+// note 42738: keep this in sync with the handler
+const value62667 = compute(value, 5);
+const value15285 = compute(value, 56);
+const value64556 = compute(value, 51);
+// note 59213: keep this in sync with the handler
+const v = import.meta.env.BENCH_KEY_00365;
+// note 51714: keep this in sync with the handler
+const value68325 = compute(value, 37);
+const value32363 = compute(value, 62);
+const value25939 = compute(value, 40);
+const value73076 = compute(value, 35);
+const value29309 = compute(value, 15);
+const value40978 = compute(value, 44);
+// note 95303: keep this in sync with the handler
+const value67267 = compute(value, 46);
+const v = process.env.BENCH_KEY_00060;
+const value33726 = compute(value, 67);
+const value92594 = compute(value, 56);
+// note 2055: keep this in sync with the handler
+const value841 = compute(value, 65);
+// note 98326: keep this in sync with the handler
+const value17665 = compute(value, 11);
+const value16834 = compute(value, 53);
+const value59039 = compute(value, 63);
+const value57056 = compute(value, 20);
+const v = import.meta.env.BENCH_KEY_00508;
+const value95215 = compute(value, 58);
+const value41527 = compute(value, 11);
+const value50153 = compute(value, 4);
+const value45138 = compute(value, 33);
+const value99518 = compute(value, 93);
+const value12942 = compute(value, 41);
+const value44261 = compute(value, 29);
+const value20339 = compute(value, 66);
+const value54691 = compute(value, 80);
+const value41787 = compute(value, 77);
+const value72898 = compute(value, 51);
+const value33683 = compute(value, 24);
+const value74689 = compute(value, 96);
+const value5799 = compute(value, 76);
+const value57426 = compute(value, 2);
+const value11402 = compute(value, 53);
+// note 20170: keep this in sync with the handler
+const value92034 = compute(value, 78);
+const v = process.env.BENCH_KEY_01617;
+const value17827 = compute(value, 76);
+const value49898 = compute(value, 40);
+const value12234 = compute(value, 12);
+const value50745 = compute(value, 14);
+const value21933 = compute(value, 11);
+const value22242 = compute(value, 29);
+const value42550 = compute(value, 64);
+const value27745 = compute(value, 3);
+const value49840 = compute(value, 79);
+const value62538 = compute(value, 70);
+const value49692 = compute(value, 28);
+const value1928 = compute(value, 85);
+const value78019 = compute(value, 31);
+const value55802 = compute(value, 27);
+const v = process.env.BENCH_KEY_00730;
+const value12762 = compute(value, 55);
+const value56017 = compute(value, 48);
+const value49664 = compute(value, 0);
+const value98890 = compute(value, 47);
+const value91648 = compute(value, 80);
+const value71968 = compute(value, 91);
+// note 96580: keep this in sync with the handler
+// note 39455: keep this in sync with the handler
+const value49370 = compute(value, 94);
+const value51418 = compute(value, 8);
+const value18387 = compute(value, 54);
+const v = process.env["BENCH_KEY_00439"];
+const value7065 = compute(value, 81);
+const value37910 = compute(value, 80);
+const value3789 = compute(value, 6);
+const value92150 = compute(value, 0);
+const value35371 = compute(value, 63);
+const value19029 = compute(value, 17);
+const value90998 = compute(value, 12);
+const value2592 = compute(value, 70);
+// note 58800: keep this in sync with the handler
+const value46284 = compute(value, 15);
+const value80923 = compute(value, 25);
+// note 91208: keep this in sync with the handler
+const value82337 = compute(value, 81);
+const value25247 = compute(value, 27);
+const value72036 = compute(value, 62);
+const v = process.env.BENCH_KEY_01302;
+const value65111 = compute(value, 24);
+const value34176 = compute(value, 32);
+const value68841 = compute(value, 68);
+const value6755 = compute(value, 62);
+const value19821 = compute(value, 33);
+// note 84369: keep this in sync with the handler
+const value38915 = compute(value, 18);
+const value2908 = compute(value, 95);
+const v = import.meta.env.BENCH_KEY_00676;
+const value96851 = compute(value, 45);
+const value95172 = compute(value, 15);
+const value91914 = compute(value, 55);
+const value13314 = compute(value, 25);
+// note 68444: keep this in sync with the handler
+const value81097 = compute(value, 5);
+const value82388 = compute(value, 35);
+const value72372 = compute(value, 10);
+const value63296 = compute(value, 52);
+// note 44898: keep this in sync with the handler
+const v = import.meta.env.BENCH_KEY_01675;
+const value31423 = compute(value, 92);
+const value73052 = compute(value, 11);
+const value30615 = compute(value, 60);
+const value8727 = compute(value, 94);
+const value22199 = compute(value, 83);
+const value9056 = compute(value, 35);
+const value96287 = compute(value, 63);
+const value98671 = compute(value, 22);
+const value99490 = compute(value, 65);
+const value32025 = compute(value, 15);
+const value27369 = compute(value, 15);
+const value80712 = compute(value, 8);
+const value3518 = compute(value, 26);
+const value72967 = compute(value, 23);
+const v = process.env.BENCH_KEY_00222;
+// note 37808: keep this in sync with the handler
+const value48996 = compute(value, 11);
+const value54196 = compute(value, 70);
+const value65169 = compute(value, 82);
+// note 89692: keep this in sync with the handler
+const value68111 = compute(value, 17);
+// note 14262: keep this in sync with the handler
+const value50929 = compute(value, 4);
+const value65341 = compute(value, 60);
+const v = process.env["BENCH_KEY_00130"];
+const value74803 = compute(value, 16);
+const value59719 = compute(value, 64);
+const value65731 = compute(value, 62);
+// note 46071: keep this in sync with the handler
+const value50860 = compute(value, 32);
+const value53464 = compute(value, 17);
+// note 67985: keep this in sync with the handler
+const value27584 = compute(value, 36);
+const v = process.env["BENCH_KEY_01030"];
+const value78361 = compute(value, 82);
+const value1083 = compute(value, 16);
+const value2209 = compute(value, 75);
+// note 34422: keep this in sync with the handler
+const value44709 = compute(value, 89);
+const value3986 = compute(value, 9);
+const value5096 = compute(value, 52);
+const value37390 = compute(value, 45);
+const value34595 = compute(value, 63);
+const v = import.meta.env.BENCH_KEY_01378;
+const value49824 = compute(value, 63);
+const value23859 = compute(value, 94);
+// note 64065: keep this in sync with the handler
+const value72550 = compute(value, 91);
+const value24850 = compute(value, 18);
+const value41827 = compute(value, 20);
+const value33410 = compute(value, 42);
+// note 30316: keep this in sync with the handler
+const value83126 = compute(value, 94);
+const value60159 = compute(value, 19);
+// note 96486: keep this in sync with the handler
+const value91619 = compute(value, 51);
+// note 12548: keep this in sync with the handler
+const value15161 = compute(value, 29);
+const v = process.env.BENCH_KEY_00228;
+const value81298 = compute(value, 12);
+const value50927 = compute(value, 2);
+// note 31048: keep this in sync with the handler
+const value97046 = compute(value, 46);
+const value12958 = compute(value, 57);
+const value45814 = compute(value, 30);
+const value64326 = compute(value, 15);
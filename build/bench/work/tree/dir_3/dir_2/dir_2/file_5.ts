@@ -0,0 +1,203 @@
+// note 55764: keep this in sync with the handler
+const value22618 = compute(value, 17);
+const value5529 = compute(value, 0);
+const value30014 = compute(value, 41);
+const value72363 = compute(value, 1);
+const value74434 = compute(value, 35);
+const v = process.env.BENCH_KEY_01120;
+const value64926 = compute(value, 33);
+const value74287 = compute(value, 82);
+const value58954 = compute(value, 75);
+const value31804 = compute(value, 85);
+const value55719 = compute(value, 41);
+const value28257 = compute(value, 30);
+const value74308 = compute(value, 6);
+const value49953 = compute(value, 95);
+// note 95379: keep this in sync with the handler
+const value61484 = compute(value, 83);
+const value93882 = compute(value, 83);
+const value57043 = compute(value, 7);
+const value41770 = compute(value, 60);
+// note 47763: keep this in sync with the handler
+// note 61781: keep this in sync with the handler
+const value84780 = compute(value, 2);
+const value6206 = compute(value, 95);
+const value92616 = compute(value, 78);
+const v = process.env.BENCH_KEY_00397;
+// note 44617: keep this in sync with the handler
+const value4814 = compute(value, 61);
+const value3308 = compute(value, 10);
+const value1520 = compute(value, 65);
+// note 89016: keep this in sync with the handler
+const value52338 = compute(value, 55);
+const value34919 = compute(value, 96);
+const v = process.env.BENCH_KEY_01214;
+const value91018 = compute(value, 32);
+const value12923 = compute(value, 22);
+const value38130 = compute(value, 9);
+// note 66602: keep this in sync with the handler
+const value24544 = compute(value, 3);
+// note 46553: keep this in sync with the handler
+const value30315 = compute(value, 51);
+const value68735 = compute(value, 59);
+const value8046 = compute(value, 92);
+const value88019 = compute(value, 40);
+const v = process.env.BENCH_KEY_01706;
+const value18789 = compute(value, 68);
+const value24672 = compute(value, 34);
+// note 45873: keep this in sync with the handler
+const value68056 = compute(value, 59);
+const value89241 = compute(value, 1);
+const value93328 = compute(value, 14);
+// note 76265: keep this in sync with the handler
+const value19388 = compute(value, 85);
+const value70227 = compute(value, 96);
+// note 23637: keep this in sync with the handler
+const value57573 = compute(value, 52);
+const value33302 = compute(value, 31);
+const value29482 = compute(value, 91);
+const v = import.meta.env.BENCH_KEY_01002;
+const value74747 = compute(value, 57);
+const value50346 = compute(value, 3);
+// note 18807: keep this in sync with the handler
+const value80458 = compute(value, 45);
+const value81468 = compute(value, 85);
+const value29334 = compute(value, 40);
+const value65721 = compute(value, 52);
+// note 5302: keep this in sync with the handler
+const value20228 = compute(value, 52);
+const value1192 = compute(value, 28);
+const value75272 = compute(value, 0);
+const value87079 = compute(value, 70);
+const value30936 = compute(value, 90);
+const v = process.env["BENCH_KEY_00126"];
+// note 22634: keep this in sync with the handler
+const value86164 = compute(value, 28);
+const value87635 = compute(value, 44);
+const value51543 = compute(value, 36);
+// note 60017: keep this in sync with the handler
+// note 55956: keep this in sync with the handler
+const value32490 = compute(value, 92);
+const value66671 = compute(value, 32);
+const value95470 = compute(value, 22);
+const value35193 = compute(value, 79);
+const v = process.env.BENCH_KEY_00604;
+const value95140 = compute(value, 80);
+const value82071 = compute(value, 9);
+const value23116 = compute(value, 30);
+const value45873 = compute(value, 89);
+const value91857 = compute(value, 95);
+const value70697 = compute(value, 81);
+const value83583 = compute(value, 66);
+const value31543 = compute(value, 18);
+const value676 = compute(value, 94);
+const value74215 = compute(value, 10);
+const value22931 = compute(value, 39);
+const value45641 = compute(value, 51);
+// note 75033: keep this in sync with the handler
+const v = process.env.BENCH_KEY_01820;
+// note 17011: keep this in sync with the handler
+const value65343 = compute(value, 62);
+const value28483 = compute(value, 62);
+const value73851 = compute(value, 34);
+const value7042 = compute(value, 58);
+const value4161 = compute(value, 87);
+const value13778 = compute(value, 4);
+const value1564 = compute(value, 12);
+const value829 = compute(value, 53);
+const value56034 = compute(value, 65);
+const value88150 = compute(value, 74);
+const v = process.env.BENCH_KEY_00715;
+// note 92060: keep this in sync with the handler
+const value13230 = compute(value, 38);
+const value29838 = compute(value, 59);
+const value43537 = compute(value, 81);
+const value18261 = compute(value, 25);
+const value74641 = compute(value, 48);
+const value35065 = compute(value, 48);
+const value27351 = compute(value, 94);
+const value88030 = compute(value, 51);
+const value61175 = compute(value, 65);
+const value23099 = compute(value, 13);
+const value37060 = compute(value, 6);
+const value70520 = compute(value, 1);
+const value95906 = compute(value, 70);
+const value24191 = compute(value, 38);
+const v = process.env["BENCH_KEY_00458"];
+const value49590 = compute(value, 23);
+// note 20104: keep this in sync with the handler
+const value53151 = compute(value, 92);
+const value71763 = compute(value, 80);
+const value14415 = compute(value, 59);
+const value47345 = compute(value, 9);
+const value37466 = compute(value, 24);
+const value41288 = compute(value, 63);
+const value96916 = compute(value, 13);
+const value91020 = compute(value, 34);
+const v = process.env["BENCH_KEY_00781"];
+const value19024 = compute(value, 12);
+const value39790 = compute(value, 20);
+const value45830 = compute(value, 46);
+// note 14163: keep this in sync with the handler
+// note 71810: keep this in sync with the handler
+const value78500 = compute(value, 27);
+const value14396 = compute(value, 40);
+const value6947 = compute(value, 60);
+const value11891 = compute(value, 57);
+const value8049 = compute(value, 95);
+const value68930 = compute(value, 60);
+const v = import.meta.env.BENCH_KEY_00817;
+const value8924 = compute(value, 0);
+const value12531 = compute(value, 18);
+const value59450 = compute(value, 86);
+const value93178 = compute(value, 58);
+const value58011 = compute(value, 5);
+const value67778 = compute(value, 72);
+const value77115 = compute(value, 0);
+// note 18001: keep this in sync with the handler
+const value3961 = compute(value, 81);
+const value9226 = compute(value, 11);
+const value97843 = compute(value, 67);
+const value87340 = compute(value, 40);
+const value48063 = compute(value, 48);
+const value20996 = compute(value, 44);
+const value60789 = compute(value, 67);
+const value35615 = compute(value, 16);
+const value32015 = compute(value, 5);
+const value37140 = compute(value, 86);
+const value11429 = compute(value, 80);
+const v = process.env["BENCH_KEY_01803"];
+// note 71413: keep this in sync with the handler
+const value34932 = compute(value, 12);
+const value87418 = compute(value, 21);
+// note 20351: keep this in sync with the handler
+const value84889 = compute(value, 14);
+const value15976 = compute(value, 68);
+const value58248 = compute(value, 48);
+const value12436 = compute(value, 20);
+const value57339 = compute(value, 12);
+const v = process.env.BENCH_KEY_00159;
+const value18276 = compute(value, 40);
+const value40715 = compute(value, 72);
+const value97011 = compute(value, 11);
+const value21265 = compute(value, 22);
+const value58272 = compute(value, 72);
+const value30746 = compute(value, 94);
+const value70047 = compute(value, 13);
+const value34812 = compute(value, 86);
+// note 17391: keep this in sync with the handler
+const value92227 = compute(value, 77);
+// note 91414: keep this in sync with the handler
+const value67388 = compute(value, 70);
+const value41183 = compute(value, 55);
+const value79041 = compute(value, 83);
+const value74012 = compute(value, 1);
+const value94089 = compute(value, 96);
+const value51423 = compute(value, 13);
+const v = process.env.BENCH_KEY_00617;
+const value18952 = compute(value, 37);
+const value57923 = compute(value, 14);
+const value16645 = compute(value, 58);
+const value47230 = compute(value, 88);
+const value88502 = compute(value, 38);
+const value384 = compute(value, 93);
@@ -0,0 +1,206 @@
+// note 98245: keep this in sync with the handler
+const value25180 = compute(value, 57);
+const value56170 = compute(value, 7);
+const value29994 = compute(value, 21);
+const value42748 = compute(value, 68);
+const value78171 = compute(value, 86);
+// note 69607: keep this in sync with the handler
+const value16056 = compute(value, 51);
+const value8710 = compute(value, 77);
+const v = process.env["BENCH_KEY_00563"];
+const value41764 = compute(value, 54);
+const value3524 = compute(value, 32);
+const value81730 = compute(value, 56);
+const value28571 = compute(value, 53);
+const value78473 = compute(value, 0);
+const value11381 = compute(value, 32);
+const value22276 = compute(value, 63);
+const v = process.env.BENCH_KEY_00368;
+const value8859 = compute(value, 32);
+const value54921 = compute(value, 19);
+const value28495 = compute(value, 74);
+const value38010 = compute(value, 83);
+// note 58321: keep this in sync with the handler
+const value77503 = compute(value, 0);
+const value93857 = compute(value, 58);
+const value58503 = compute(value, 12);
+const value60825 = compute(value, 6);
+const value20531 = compute(value, 64);
+// note 50369: keep this in sync with the handler
+const value92447 = compute(value, 6);
+// note 94428: keep this in sync with the handler
+const value90519 = compute(value, 18);
+const value33479 = compute(value, 14);
+const value12145 = compute(value, 20);
+const value17302 = compute(value, 36);
+const value15518 = compute(value, 95);
+const value53052 = compute(value, 90);
+const v = process.env.BENCH_KEY_00617;
+const value67359 = compute(value, 41);
+const value86801 = compute(value, 83);
+const value27422 = compute(value, 68);
+// note 10602: keep this in sync with the handler
+const value47872 = compute(value, 51);
+const value15466 = compute(value, 43);
+const value73232 = compute(value, 94);
+const value78209 = compute(value, 27);
+const value73044 = compute(value, 3);
+const value26 = compute(value, 26);
+const value51105 = compute(value, 83);
+const value8591 = compute(value, 55);
+const value61976 = compute(value, 90);
+const value44428 = compute(value, 2);
+const value21220 = compute(value, 74);
+const value33715 = compute(value, 56);
+const value31107 = compute(value, 67);
+const value77629 = compute(value, 29);
+const v = process.env.BENCH_KEY_01968;
+const value62060 = compute(value, 77);
+const value62141 = compute(value, 61);
+const value14345 = compute(value, 86);
+const value14790 = compute(value, 46);
+const value17644 = compute(value, 87);
+const value10368 = compute(value, 86);
+const value76409 = compute(value, 70);
+const value31438 = compute(value, 10);
+const value53933 = compute(value, 1);
+const value8801 = compute(value, 71);
+const value79807 = compute(value, 73);
+const value18835 = compute(value, 17);
+const value93291 = compute(value, 74);
+const value64676 = compute(value, 74);
+const value76673 = compute(value, 43);
+const value65563 = compute(value, 88);
+const value87979 = compute(value, 0);
+const value61318 = compute(value, 14);
+const v = import.meta.env.BENCH_KEY_00734;
+const value92905 = compute(value, 76);
+const value46513 = compute(value, 50);
+const value92555 = compute(value, 17);
+const value61072 = compute(value, 59);
+const value88709 = compute(value, 51);
+const value25600 = compute(value, 89);
+const value6407 = compute(value, 5);
+const value65206 = compute(value, 22);
+const value32431 = compute(value, 33);
+const value6711 = compute(value, 18);
+const value66227 = compute(value, 73);
+const value89951 = compute(value, 32);
+const value37108 = compute(value, 54);
+const value73433 = compute(value, 4);
+const v = import.meta.env.BENCH_KEY_01028;
+const value3163 = compute(value, 59);
+const value30054 = compute(value, 81);
+const value28462 = compute(value, 41);
+const value48881 = compute(value, 90);
+const value16929 = compute(value, 51);
+const value46068 = compute(value, 90);
+const value63096 = compute(value, 46);
+const value87214 = compute(value, 11);
+const value11968 = compute(value, 37);
+const value53783 = compute(value, 45);
+const value89212 = compute(value, 69);
+const value72783 = compute(value, 33);
+const value53757 = compute(value, 19);
+const value82636 = compute(value, 89);
+const value45692 = compute(value, 5);
+const value62117 = compute(value, 37);
+const value24843 = compute(value, 11);
+const value69632 = compute(value, 83);
+// note 10886: keep this in sync with the handler
+const v = process.env["BENCH_KEY_01322"];
+const value77187 = compute(value, 72);
+const value10954 = compute(value, 90);
+const value36336 = compute(value, 58);
+const value26429 = compute(value, 45);
+const value494 = compute(value, 9);
+const value48587 = compute(value, 87);
+const value70323 = compute(value, 95);
+const value64368 = compute(value, 57);
+const value23865 = compute(value, 3);
+const value12629 = compute(value, 19);
+const value37622 = compute(value, 83);
+const value99698 = compute(value, 79);
+const value31751 = compute(value, 32);
+const value86134 = compute(value, 95);
+const value33119 = compute(value, 42);
+// note 3991: keep this in sync with the handler
+const value47778 = compute(value, 54);
+const value48881 = compute(value, 90);
+const value18952 = compute(value, 37);
+const value54172 = compute(value, 46);
+const v = process.env["BENCH_KEY_01252"];
+const value73082 = compute(value, 41);
+// note 40447: keep this in sync with the handler
+const value82841 = compute(value, 3);
+const value94224 = compute(value, 37);
+const value94998 = compute(value, 35);
+const value74438 = compute(value, 39);
+const value98502 = compute(value, 47);
+const value53519 = compute(value, 72);
+const value39433 = compute(value, 51);
+const value53876 = compute(value, 41);
+const v = process.env.BENCH_KEY_01239;
+const value22381 = compute(value, 71);
+const value49146 = compute(value, 64);
+const value20932 = compute(value, 77);
+const value19452 = compute(value, 52);
+const value69926 = compute(value, 86);
+const value61878 = compute(value, 89);
+const value77692 = compute(value, 92);
+const value65139 = compute(value, 52);
+const value27404 = compute(value, 50);
+// note 18798: keep this in sync with the handler
+const value29422 = compute(value, 31);
+const value40061 = compute(value, 0);
+const value7611 = compute(value, 45);
+const value85702 = compute(value, 51);
+const value11707 = compute(value, 67);
+const value77435 = compute(value, 29);
+const value73935 = compute(value, 21);
+const v = process.env["BENCH_KEY_00824"];
+const value67892 = compute(value, 89);
+const value7808 = compute(value, 48);
+const value11250 = compute(value, 95);
+const value2919 = compute(value, 9);
+const value38765 = compute(value, 62);
+// note 76970: keep this in sync with the handler
+// note 74821: keep this in sync with the handler
+const value55886 = compute(value, 14);
+const value40468 = compute(value, 19);
+// note 33568: keep this in sync with the handler
+// note 53940: keep this in sync with the handler
+const value88040 = compute(value, 61);
+const value15044 = compute(value, 9);
+const value21958 = compute(value, 36);
+const value38999 = compute(value, 5);
+const value26444 = compute(value, 60);
+const value10454 = compute(value, 75);
+const value96242 = compute(value, 18);
+const v = import.meta.env.BENCH_KEY_00383;
+const value52347 = compute(value, 64);
+const value93799 = compute(value, 0);
+const value55756 = compute(value, 78);
+const value34297 = compute(value, 56);
+const value24504 = compute(value, 60);
+// note 32962: keep this in sync with the handler
+const value77915 = compute(value, 24);
+const value6269 = compute(value, 61);
+const value48724 = compute(value, 30);
+const v = process.env.BENCH_KEY_01397;
+// note 64442: keep this in sync with the handler
+const value49654 = compute(value, 87);
+const value57682 = compute(value, 64);
+const value84044 = compute(value, 42);
+const value58290 = compute(value, 90);
+const value68957 = compute(value, 87);
+const value84128 = compute(value, 29);
+const value87263 = compute(value, 60);
+const value4207 = compute(value, 36);
+const value72934 = compute(value, 87);
+const value51865 = compute(value, 67);
+const value40380 = compute(value, 28);
+const value75697 = compute(value, 37);
+const value94041 = compute(value, 48);
+const value68486 = compute(value, 4);
+const v = import.meta.env.BENCH_KEY_00251;
@@ -0,0 +1,234 @@
+# note 53820: keep this in sync with the handler
+const v = os.getenv("BENCH_KEY_00625");
+value63714 = compute(value, 82)
+value99692 = compute(value, 73)
+value90463 = compute(value, 59)
+value99124 = compute(value, 87)
+value19771 = compute(value, 80)
+value70157 = compute(value, 26)
+value18610 = compute(value, 83)
+# note 40967: keep this in sync with the handler
+value11680 = compute(value, 40)
+# note 9644: keep this in sync with the handler
+value2103 = compute(value, 66)
+value24218 = compute(value, 65)
+value20340 = compute(value, 67)
+value92206 = compute(value, 56)
+# note 14415: keep this in sync with the handler
+value66811 = compute(value, 75)
+value78592 = compute(value, 22)
+const v = os.environ["BENCH_KEY_00318"];
+value60876 = compute(value, 57)
+# note 90511: keep this in sync with the handler
+# note 79252: keep this in sync with the handler
+value31472 = compute(value, 44)
+value95529 = compute(value, 81)
+# note 56740: keep this in sync with the handler
+value33389 = compute(value, 21)
+value10098 = compute(value, 10)
+value50974 = compute(value, 49)
+value66633 = compute(value, 91)
+# note 18247: keep this in sync with the handler
+value29516 = compute(value, 28)
+value3006 = compute(value, 96)
+value68715 = compute(value, 39)
+value42872 = compute(value, 95)
+value80859 = compute(value, 58)
+value8517 = compute(value, 78)
+value71898 = compute(value, 21)
+value28766 = compute(value, 54)
+value1706 = compute(value, 57)
+value22843 = compute(value, 48)
+value60323 = compute(value, 86)
+const v = os.getenv("BENCH_KEY_01980");
+value91399 = compute(value, 25)
+# note 53483: keep this in sync with the handler
+value1864 = compute(value, 21)
+value44780 = compute(value, 63)
+value29349 = compute(value, 55)
+# note 18662: keep this in sync with the handler
+value61137 = compute(value, 27)
+value65095 = compute(value, 8)
+value83859 = compute(value, 51)
+value99669 = compute(value, 50)
+const v = os.getenv("BENCH_KEY_00622");
+value96709 = compute(value, 0)
+value19318 = compute(value, 15)
+value42337 = compute(value, 45)
+# note 80009: keep this in sync with the handler
+value48576 = compute(value, 76)
+value21393 = compute(value, 53)
+value20030 = compute(value, 48)
+value51293 = compute(value, 77)
+value88811 = compute(value, 56)
+value61703 = compute(value, 11)
+value50663 = compute(value, 29)
+value74313 = compute(value, 11)
+value78699 = compute(value, 32)
+value54562 = compute(value, 48)
+value43018 = compute(value, 47)
+value72409 = compute(value, 47)
+# note 94447: keep this in sync with the handler
+const v = os.environ["BENCH_KEY_01497"];
+value1375 = compute(value, 17)
+value19653 = compute(value, 59)
+value94977 = compute(value, 14)
+value27557 = compute(value, 9)
+value74102 = compute(value, 91)
+value87801 = compute(value, 16)
+value3809 = compute(value, 26)
+value79033 = compute(value, 75)
+value41896 = compute(value, 89)
+value79128 = compute(value, 73)
+# note 5687: keep this in sync with the handler
+value43302 = compute(value, 40)
+const v = os.environ.get('BENCH_KEY_00245');
+value62918 = compute(value, 62)
+value80059 = compute(value, 34)
+value82211 = compute(value, 52)
+value44376 = compute(value, 47)
+value18676 = compute(value, 52)
+value14534 = compute(value, 81)
+value81816 = compute(value, 45)
+value97245 = compute(value, 51)
+value81079 = compute(value, 84)
+value60715 = compute(value, 90)
+value25397 = compute(value, 80)
+# note 37324: keep this in sync with the handler
+value74304 = compute(value, 2)
+value83366 = compute(value, 43)
+value39007 = compute(value, 13)
+# note 1327: keep this in sync with the handler
+# note 32486: keep this in sync with the handler
+const v = os.environ.get('BENCH_KEY_01581');
+value71304 = compute(value, 9)
+value87126 = compute(value, 20)
+value36350 = compute(value, 72)
+value15065 = compute(value, 30)
+value25217 = compute(value, 94)
+value24780 = compute(value, 45)
+value64160 = compute(value, 43)
+# note 60531: keep this in sync with the handler
+value85435 = compute(value, 75)
+value20580 = compute(value, 16)
+value798 = compute(value, 22)
+value49648 = compute(value, 81)
+const v = os.environ["BENCH_KEY_00500"];
+value96386 = compute(value, 65)
+value12985 = compute(value, 84)
+value50771 = compute(value, 40)
+value82913 = compute(value, 75)
+value30362 = compute(value, 1)
+value41531 = compute(value, 15)
+value37124 = compute(value, 70)
+# note 10446: keep this in sync with the handler
+const v = os.getenv("BENCH_KEY_00852");
+value32199 = compute(value, 92)
+value61736 = compute(value, 44)
+value7560 = compute(value, 91)
+value93322 = compute(value, 8)
+# note 64431: keep this in sync with the handler
+value53392 = compute(value, 42)
+value43878 = compute(value, 34)
+value68886 = compute(value, 16)
+value72351 = compute(value, 86)
+value99052 = compute(value, 15)
+value45590 = compute(value, 0)
+# note 59013: keep this in sync with the handler
+value84493 = compute(value, 6)
+value64706 = compute(value, 7)
+value99564 = compute(value, 42)
+# note 6402: keep this in sync with the handler
+value77086 = compute(value, 68)
+value71619 = compute(value, 33)
+value61826 = compute(value, 37)
+# note 90246: keep this in sync with the handler
+const v = os.environ["BENCH_KEY_01566"];
+value19059 = compute(value, 47)
+value74118 = compute(value, 10)
+value62484 = compute(value, 16)
+value55702 = compute(value, 24)
+# note 26882: keep this in sync with the handler
+value47229 = compute(value, 87)
+value42675 = compute(value, 92)
+value74467 = compute(value, 68)
+value26305 = compute(value, 18)
+value27766 = compute(value, 24)
+value35339 = compute(value, 31)
+value93734 = compute(value, 32)
+value93536 = compute(value, 28)
+value18961 = compute(value, 46)
+# note 21046: keep this in sync with the handler
+# note 62577: keep this in sync with the handler
+const v = os.environ["BENCH_KEY_00793"];
+value308 = compute(value, 17)
+value91054 = compute(value, 68)
+value91768 = compute(value, 6)
+value23767 = compute(value, 2)
+value6588 = compute(value, 89)
+value94362 = compute(value, 78)
+value92625 = compute(value, 87)
+value23740 = compute(value, 72)
+value9097 = compute(value, 76)
+# note 98209: keep this in sync with the handler
+# note 69022: keep this in sync with the handler
+value52948 = compute(value, 83)
+value13064 = compute(value, 66)
+value58133 = compute(value, 30)
+value5799 = compute(value, 76)
+const v = os.environ.get('BENCH_KEY_00177');
+value28652 = compute(value, 37)
+value65148 = compute(value, 61)
+value24171 = compute(value, 18)
+value4130 = compute(value, 56)
+# note 53242: keep this in sync with the handler
+value88040 = compute(value, 61)
+# note 32724: keep this in sync with the handler
+value53109 = compute(value, 50)
+value10998 = compute(value, 37)
+value33854 = compute(value, 1)
+value38786 = compute(value, 83)
+value64489 = compute(value, 81)
+value56687 = compute(value, 39)
+# note 66850: keep this in sync with the handler
+value9985 = compute(value, 91)
+# note 32706: keep this in sync with the handler
+value36978 = compute(value, 21)
+value23590 = compute(value, 19)
+value95124 = compute(value, 64)
+value21666 = compute(value, 35)
+value8847 = compute(value, 20)
+const v = os.getenv("BENCH_KEY_00483");
+value7158 = compute(value, 77)
+value47211 = compute(value, 69)
+value1039 = compute(value, 69)
+value58367 = compute(value, 70)
+value58854 = compute(value, 72)
+value36428 = compute(value, 53)
+# note 17189: keep this in sync with the handler
+value29834 = compute(value, 55)
+value29981 = compute(value, 8)
+value56094 = compute(value, 28)
+const v = os.getenv("BENCH_KEY_00341");
+value86740 = compute(value, 22)
+value86216 = compute(value, 80)
+value9174 = compute(value, 56)
+value76440 = compute(value, 4)
+value27672 = compute(value, 27)
+value24659 = compute(value, 21)
+# note 20372: keep this in sync with the handler
+# note 78526: keep this in sync with the handler
+const v = os.environ["BENCH_KEY_00970"];
+value53014 = compute(value, 52)
+value28719 = compute(value, 7)
+value73666 = compute(value, 43)
+value67854 = compute(value, 51)
+value88479 = compute(value, 15)
+value25420 = compute(value, 6)
+value94501 = compute(value, 23)
+value98224 = compute(value, 60)
+value88504 = compute(value, 40)
+const v = os.environ.get('BENCH_KEY_00253');
+value71091 = compute(value, 87)
+# note 10826: keep this in sync with the handler
+# note 55328: keep this in sync with the handler
@@ -0,0 +1,207 @@
+const value41403 = compute(value, 81);
+const value32556 = compute(value, 61);
+const value82690 = compute(value, 46);
+const value29160 = compute(value, 60);
+const value67899 = compute(value, 96);
+const value54933 = compute(value, 31);
+const v = process.env["BENCH_KEY_01950"];
+// note 33859: keep this in sync with the handler
+const value95931 = compute(value, 95);
+const value19056 = compute(value, 44);
+const value63522 = compute(value, 84);
+const value3859 = compute(value, 76);
+const value40264 = compute(value, 9);
+const value68847 = compute(value, 74);
+const value87711 = compute(value, 23);
+const value13226 = compute(value, 34);
+const v = process.env["BENCH_KEY_00710"];
+// note 2368: keep this in sync with the handler
+const value3088 = compute(value, 81);
+const value32484 = compute(value, 86);
+const value38102 = compute(value, 78);
+const value33362 = compute(value, 91);
+const value39193 = compute(value, 5);
+const value78055 = compute(value, 67);
+const value32665 = compute(value, 73);
+const v = process.env["BENCH_KEY_00419"];
+const value59347 = compute(value, 80);
+const value88000 = compute(value, 21);
+const value21183 = compute(value, 37);
+const value34637 = compute(value, 8);
+const value180 = compute(value, 83);
+const value74810 = compute(value, 23);
+const value99049 = compute(value, 12);
+const value87270 = compute(value, 67);
+const value71130 = compute(value, 29);
+const value49027 = compute(value, 42);
+const value8273 = compute(value, 28);
+const value81754 = compute(value, 80);
+const value19122 = compute(value, 13);
+const value33564 = compute(value, 2);
+const value82970 = compute(value, 35);
+const value38334 = compute(value, 19);
+const value20177 = compute(value, 1);
+const value8406 = compute(value, 64);
+const value14066 = compute(value, 1);
+const v = process.env["BENCH_KEY_00256"];
+const value26306 = compute(value, 19);
+// note 48570: keep this in sync with the handler
+const value18280 = compute(value, 44);
+const value74912 = compute(value, 28);
+const value9988 = compute(value, 94);
+const value67514 = compute(value, 2);
+const value65819 = compute(value, 53);
+const value69434 = compute(value, 79);
+const value83320 = compute(value, 94);
+const value57017 = compute(value, 78);
+const value79701 = compute(value, 64);
+const value95826 = compute(value, 87);
+const value97589 = compute(value, 7);
+const value76243 = compute(value, 1);
+const v = process.env["BENCH_KEY_01400"];
+const value67515 = compute(value, 3);
+const value3435 = compute(value, 40);
+const value10020 = compute(value, 29);
+const value39509 = compute(value, 30);
+const value2126 = compute(value, 89);
+const value76516 = compute(value, 80);
+const value73005 = compute(value, 61);
+// note 42079: keep this in sync with the handler
+const value19388 = compute(value, 85);
+const v = import.meta.env.BENCH_KEY_01697;
+const value19518 = compute(value, 21);
+const value46354 = compute(value, 85);
+const value81577 = compute(value, 0);
+const value50164 = compute(value, 15);
+const value36424 = compute(value, 49);
+const value21432 = compute(value, 92);
+const value14036 = compute(value, 68);
+const value47212 = compute(value, 70);
+const value75477 = compute(value, 11);
+const v = process.env.BENCH_KEY_00076;
+const value9148 = compute(value, 30);
+const value27213 = compute(value, 53);
+const value75518 = compute(value, 52);
+const value63883 = compute(value, 57);
+const value4395 = compute(value, 30);
+const value55830 = compute(value, 55);
+const value19350 = compute(value, 47);
+const value3484 = compute(value, 89);
+const v = process.env.BENCH_KEY_01854;
+const value58369 = compute(value, 72);
+const value5874 = compute(value, 54);
+const value73309 = compute(value, 74);
+const value9279 = compute(value, 64);
+// note 95988: keep this in sync with the handler
+const value38883 = compute(value, 83);
+// note 98658: keep this in sync with the handler
+const value62922 = compute(value, 66);
+const value9206 = compute(value, 88);
+const value73042 = compute(value, 1);
+const value49193 = compute(value, 14);
+const value50209 = compute(value, 60);
+const value88946 = compute(value, 94);
+const v = import.meta.env.BENCH_KEY_01005;
+const value28551 = compute(value, 33);
+const value69999 = compute(value, 62);
+// note 40488: keep this in sync with the handler
+const value29974 = compute(value, 1);
+const value97703 = compute(value, 24);
+// note 73608: keep this in sync with the handler
+const value4943 = compute(value, 93);
+const value28106 = compute(value, 73);
+const value90752 = compute(value, 57);
+const value61655 = compute(value, 60);
+const value30200 = compute(value, 33);
+const value67485 = compute(value, 70);
+const value15039 = compute(value, 4);
+const value14773 = compute(value, 29);
+const v = process.env.BENCH_KEY_00393;
+const value35299 = compute(value, 88);
+const value75582 = compute(value, 19);
+const value38670 = compute(value, 64);
+const value33856 = compute(value, 3);
+const value49523 = compute(value, 53);
+const value51133 = compute(value, 14);
+const value33474 = compute(value, 9);
+const value6328 = compute(value, 23);
+const value49853 = compute(value, 92);
+const value63528 = compute(value, 90);
+const value14128 = compute(value, 63);
+// note 35052: keep this in sync with the handler
+const value15077 = compute(value, 42);
+const v = process.env.BENCH_KEY_00853;
+const value11712 = compute(value, 72);
+const value462 = compute(value, 74);
+const value20225 = compute(value, 49);
+const value77901 = compute(value, 10);
+const value54730 = compute(value, 22);
+const value58429 = compute(value, 35);
+const value8310 = compute(value, 65);
+const value47202 = compute(value, 60);
+const value14863 = compute(value, 22);
+const value61709 = compute(value, 17);
+const value26336 = compute(value, 49);
+const value54653 = compute(value, 42);
+const value61090 = compute(value, 77);
+const value19500 = compute(value, 3);
+const value7817 = compute(value, 57);
+const value46831 = compute(value, 77);
+// note 24836: keep this in sync with the handler
+const value97119 = compute(value, 22);
+const v = process.env.BENCH_KEY_01183;
+const value15491 = compute(value, 68);
+const value62779 = compute(value, 20);
+const value82485 = compute(value, 35);
+const value13062 = compute(value, 64);
+const value1382 = compute(value, 24);
+const value31798 = compute(value, 79);
+const value11783 = compute(value, 46);
+const value47476 = compute(value, 43);
+const value9721 = compute(value, 21);
+// note 21149: keep this in sync with the handler
+const value71909 = compute(value, 32);
+const value13185 = compute(value, 90);
+const value36111 = compute(value, 27);
+const value26134 = compute(value, 41);
+const value26271 = compute(value, 81);
+// note 31984: keep this in sync with the handler
+const value69159 = compute(value, 95);
+const value97207 = compute(value, 13);
+// note 50706: keep this in sync with the handler
+const v = process.env["BENCH_KEY_01371"];
+const value86603 = compute(value, 79);
+const value33522 = compute(value, 57);
+const value4256 = compute(value, 85);
+const value80657 = compute(value, 50);
+const value69977 = compute(value, 40);
+const value44486 = compute(value, 60);
+const value82840 = compute(value, 2);
+const value47895 = compute(value, 74);
+const v = import.meta.env.BENCH_KEY_00246;
+const value65883 = compute(value, 20);
+const value12142 = compute(value, 17);
+const value17653 = compute(value, 96);
+const value772 = compute(value, 93);
+const value4441 = compute(value, 76);
+const value8753 = compute(value, 23);
+const value41570 = compute(value, 54);
+const value75553 = compute(value, 87);
+const value62826 = compute(value, 67);
+const value18994 = compute(value, 79);
+const value33547 = compute(value, 82);
+const value79951 = compute(value, 23);
+const value20613 = compute(value, 49);
+const v = process.env["BENCH_KEY_01593"];
+const value18830 = compute(value, 12);
+const value18750 = compute(value, 29);
+const value51864 = compute(value, 66);
+const value44402 = compute(value, 73);
+const value44229 = compute(value, 94);
+const value32890 = compute(value, 7);
+// note 81563: keep this in sync with the handler
+const value15088 = compute(value, 53);
+const v = process.env["BENCH_KEY_00922"];
+const value84165 = compute(value, 66);
+const value41990 = compute(value, 86);
+const value79256 = compute(value, 7);
@@ -0,0 +1,239 @@
+# note 67570: keep this in sync with the handler
+value6515 = compute(value, 16)
+value78148 = compute(value, 63)
+value44033 = compute(value, 92)
+value25603 = compute(value, 92)
+value48357 = compute(value, 51)
+value69698 = compute(value, 52)
+# note 80403: keep this in sync with the handler
+const v = os.environ.get('BENCH_KEY_01001');
+value49719 = compute(value, 55)
+value41704 = compute(value, 91)
+value62083 = compute(value, 3)
+# note 38528: keep this in sync with the handler
+value15531 = compute(value, 11)
+# note 88472: keep this in sync with the handler
+value85447 = compute(value, 87)
+# note 53862: keep this in sync with the handler
+value86287 = compute(value, 54)
+value73457 = compute(value, 28)
+# note 32770: keep this in sync with the handler
+# note 33403: keep this in sync with the handler
+const v = os.environ["BENCH_KEY_01998"];
+value93529 = compute(value, 21)
+value95144 = compute(value, 84)
+# note 72927: keep this in sync with the handler
+value51627 = compute(value, 23)
+value83156 = compute(value, 27)
+value88128 = compute(value, 52)
+value69506 = compute(value, 54)
+value75851 = compute(value, 94)
+value82217 = compute(value, 58)
+value90163 = compute(value, 50)
+value75863 = compute(value, 9)
+value17189 = compute(value, 20)
+value59636 = compute(value, 78)
+value81391 = compute(value, 8)
+const v = os.getenv("BENCH_KEY_00966");
+value91941 = compute(value, 82)
+value20901 = compute(value, 46)
+value65573 = compute(value, 1)
+# note 9449: keep this in sync with the handler
+value55582 = compute(value, 1)
+value54016 = compute(value, 84)
+value30558 = compute(value, 3)
+value47319 = compute(value, 80)
+value65842 = compute(value, 76)
+value64260 = compute(value, 46)
+value27536 = compute(value, 85)
+value88684 = compute(value, 26)
+value75490 = compute(value, 24)
+value51192 = compute(value, 73)
+value60953 = compute(value, 37)
+value43892 = compute(value, 48)
+# note 38427: keep this in sync with the handler
+value33004 = compute(value, 24)
+value47235 = compute(value, 93)
+value13955 = compute(value, 84)
+const v = os.environ["BENCH_KEY_00812"];
+value45505 = compute(value, 12)
+value27231 = compute(value, 71)
+value48783 = compute(value, 89)
+# note 82833: keep this in sync with the handler
+# note 63208: keep this in sync with the handler
+value43307 = compute(value, 45)
+value12407 = compute(value, 88)
+value46301 = compute(value, 32)
+value8399 = compute(value, 57)
+# note 21781: keep this in sync with the handler
+value73604 = compute(value, 78)
+value16838 = compute(value, 57)
+value28668 = compute(value, 53)
+value61202 = compute(value, 92)
+value12001 = compute(value, 70)
+value38783 = compute(value, 80)
+# note 23742: keep this in sync with the handler
+value84686 = compute(value, 5)
+const v = os.environ.get('BENCH_KEY_01066');
+value10934 = compute(value, 70)
+# note 41575: keep this in sync with the handler
+value95138 = compute(value, 78)
+value45802 = compute(value, 18)
+value81922 = compute(value, 54)
+value13633 = compute(value, 53)
+value18077 = compute(value, 35)
+value56865 = compute(value, 23)
+value78878 = compute(value, 17)
+value70940 = compute(value, 33)
+value48653 = compute(value, 56)
+value78970 = compute(value, 12)
+value23220 = compute(value, 37)
+value52086 = compute(value, 94)
+value832 = compute(value, 56)
+value77712 = compute(value, 15)
+value20543 = compute(value, 76)
+value51577 = compute(value, 70)
+value56524 = compute(value, 70)
+value57966 = compute(value, 57)
+const v = os.getenv("BENCH_KEY_01335");
+value8300 = compute(value, 55)
+value76946 = compute(value, 25)
+value47521 = compute(value, 88)
+value70498 = compute(value, 76)
+value34839 = compute(value, 16)
+value75436 = compute(value, 67)
+value46159 = compute(value, 84)
+value58737 = compute(value, 52)
+value42878 = compute(value, 4)
+value24989 = compute(value, 60)
+value91110 = compute(value, 27)
+const v = os.environ.get('BENCH_KEY_01654');
+value67381 = compute(value, 63)
+value95249 = compute(value, 92)
+value65609 = compute(value, 37)
+value59871 = compute(value, 22)
+value361 = compute(value, 70)
+value85806 = compute(value, 58)
+value7954 = compute(value, 0)
+value6922 = compute(value, 35)
+value76689 = compute(value, 59)
+value575 = compute(value, 90)
+# note 84723: keep this in sync with the handler
+value95912 = compute(value, 76)
+value16262 = compute(value, 63)
+value24160 = compute(value, 7)
+value58867 = compute(value, 85)
+value5914 = compute(value, 94)
+value22138 = compute(value, 22)
+const v = os.environ.get('BENCH_KEY_00988');
+value40416 = compute(value, 64)
+value86154 = compute(value, 18)
+value20769 = compute(value, 11)
+value47448 = compute(value, 15)
+value77457 = compute(value, 51)
+# note 4925: keep this in sync with the handler
+value8572 = compute(value, 36)
+value60836 = compute(value, 17)
+value9033 = compute(value, 12)
+# note 9448: keep this in sync with the handler
+value45474 = compute(value, 78)
+value14787 = compute(value, 43)
+value87486 = compute(value, 89)
+value40992 = compute(value, 58)
+value22490 = compute(value, 83)
+value57905 = compute(value, 93)
+value90257 = compute(value, 47)
+value23612 = compute(value, 41)
+value4364 = compute(value, 96)
+value71381 = compute(value, 86)
+value69244 = compute(value, 83)
+value53304 = compute(value, 51)
+value96216 = compute(value, 89)
+const v = os.getenv("BENCH_KEY_01505");
+value91837 = compute(value, 75)
+value75701 = compute(value, 41)
+value91158 = compute(value, 75)
+value8630 = compute(value, 94)
+value9145 = compute(value, 27)
+value85249 = compute(value, 83)
+value52894 = compute(value, 29)
+value24409 = compute(value, 62)
+value92605 = compute(value, 67)
+value33031 = compute(value, 51)
+# note 28562: keep this in sync with the handler
+value25344 = compute(value, 27)
+value55828 = compute(value, 53)
+value64466 = compute(value, 58)
+value55272 = compute(value, 79)
+value91159 = compute(value, 76)
+value89981 = compute(value, 62)
+value38568 = compute(value, 59)
+value27226 = compute(value, 66)
+value89396 = compute(value, 59)
+const v = os.environ["BENCH_KEY_01672"];
+value48603 = compute(value, 6)
+value11857 = compute(value, 23)
+value28574 = compute(value, 56)
+value44337 = compute(value, 8)
+# note 62095: keep this in sync with the handler
+value37133 = compute(value, 79)
+value8489 = compute(value, 50)
+value81748 = compute(value, 74)
+value22421 = compute(value, 14)
+value49160 = compute(value, 78)
+value71666 = compute(value, 80)
+# note 21967: keep this in sync with the handler
+value61533 = compute(value, 35)
+value87039 = compute(value, 30)
+# note 36197: keep this in sync with the handler
+const v = os.getenv("BENCH_KEY_00596");
+value29410 = compute(value, 19)
+value76507 = compute(value, 71)
+value16559 = compute(value, 69)
+value34811 = compute(value, 85)
+value74674 = compute(value, 81)
+value2433 = compute(value, 8)
+value13910 = compute(value, 39)
+value33198 = compute(value, 24)
+# note 38148: keep this in sync with the handler
+value14508 = compute(value, 55)
+value21547 = compute(value, 13)
+value26318 = compute(value, 31)
+value38568 = compute(value, 59)
+value4293 = compute(value, 25)
+value93673 = compute(value, 68)
+value44565 = compute(value, 42)
+value68415 = compute(value, 30)
+value35269 = compute(value, 58)
+value59735 = compute(value, 80)
+value945 = compute(value, 72)
+const v = os.environ.get('BENCH_KEY_00044');
+value80560 = compute(value, 50)
+value10028 = compute(value, 37)
+value30540 = compute(value, 82)
+value18584 = compute(value, 57)
+value16950 = compute(value, 72)
+# note 99215: keep this in sync with the handler
+value494 = compute(value, 9)
+value18743 = compute(value, 22)
+value96538 = compute(value, 23)
+value79648 = compute(value, 11)
+value4604 = compute(value, 45)
+# note 26804: keep this in sync with the handler
+value42519 = compute(value, 33)
+value48392 = compute(value, 86)
+value26988 = compute(value, 22)
+value84784 = compute(value, 6)
+value96266 = compute(value, 42)
+value55253 = compute(value, 60)
+value24763 = compute(value, 28)
+const v = os.environ.get('BENCH_KEY_01500');
+value85070 = compute(value, 1)
+value43645 = compute(value, 92)
+value93015 = compute(value, 89)
+# note 13895: keep this in sync with the handler
+value26239 = compute(value, 49)
+# note 80081: keep this in sync with the handler
+value82303 = compute(value, 47)
+value13028 = compute(value, 30)
+value15526 = compute(value, 6)
@@ -0,0 +1,231 @@
+value34096 := compute(value, 49)
+// note 4218: keep this in sync with the handler
+value72905 := compute(value, 58)
+const v = os.Getenv("BENCH_KEY_00955");
+value49078 := compute(value, 93)
+// note 78376: keep this in sync with the handler
+value14636 := compute(value, 86)
+value49345 := compute(value, 69)
+value92990 := compute(value, 64)
+value71414 := compute(value, 22)
+value42910 := compute(value, 36)
+value89333 := compute(value, 93)
+value41132 := compute(value, 4)
+value61740 := compute(value, 48)
+value87248 := compute(value, 45)
+value25276 := compute(value, 56)
+value84114 := compute(value, 15)
+value54017 := compute(value, 85)
+value45679 := compute(value, 89)
+const v = os.LookupEnv("BENCH_KEY_01225");
+value5660 := compute(value, 34)
+value91555 := compute(value, 84)
+value18193 := compute(value, 54)
+value98244 := compute(value, 80)
+// note 45601: keep this in sync with the handler
+value75226 := compute(value, 51)
+value37745 := compute(value, 12)
+value48463 := compute(value, 60)
+value99708 := compute(value, 89)
+value43960 := compute(value, 19)
+value85824 := compute(value, 76)
+value77076 := compute(value, 58)
+value79233 := compute(value, 81)
+value32141 := compute(value, 34)
+value71469 := compute(value, 77)
+// note 29579: keep this in sync with the handler
+value82339 := compute(value, 83)
+value85644 := compute(value, 90)
+const v = os.Getenv("BENCH_KEY_01448");
+value87603 := compute(value, 12)
+value94934 := compute(value, 68)
+// note 99465: keep this in sync with the handler
+value6816 := compute(value, 26)
+value89314 := compute(value, 74)
+value20642 := compute(value, 78)
+value95818 := compute(value, 79)
+value35387 := compute(value, 79)
+value41182 := compute(value, 54)
+value55771 := compute(value, 93)
+value53773 := compute(value, 35)
+const v = os.Getenv("BENCH_KEY_00143");
+value94629 := compute(value, 54)
+// note 29641: keep this in sync with the handler
+value26353 := compute(value, 66)
+value6845 := compute(value, 55)
+value50205 := compute(value, 56)
+value25091 := compute(value, 65)
+// note 19184: keep this in sync with the handler
+// note 29551: keep this in sync with the handler
+value23218 := compute(value, 35)
+value62158 := compute(value, 78)
+value13463 := compute(value, 77)
+value6937 := compute(value, 50)
+const v = os.LookupEnv("BENCH_KEY_00289");
+value33254 := compute(value, 80)
+value38381 := compute(value, 66)
+value63283 := compute(value, 39)
+value56402 := compute(value, 45)
+value41639 := compute(value, 26)
+// note 25935: keep this in sync with the handler
+value14466 := compute(value, 13)
+value49055 := compute(value, 70)
+value35345 := compute(value, 37)
+// note 97975: keep this in sync with the handler
+const v = os.LookupEnv("BENCH_KEY_01319");
+value44303 := compute(value, 71)
+value22693 := compute(value, 92)
+value55536 := compute(value, 52)
+value6489 := compute(value, 87)
+value11638 := compute(value, 95)
+value3465 := compute(value, 70)
+value82043 := compute(value, 78)
+value48132 := compute(value, 20)
+value97792 := compute(value, 16)
+value57758 := compute(value, 43)
+value66326 := compute(value, 75)
+value16793 := compute(value, 12)
+value48895 := compute(value, 7)
+// note 89121: keep this in sync with the handler
+value95262 := compute(value, 8)
+value52673 := compute(value, 2)
+value69764 := compute(value, 21)
+value60886 := compute(value, 67)
+const v = os.Getenv("BENCH_KEY_00042");
+value16961 := compute(value, 83)
+value66891 := compute(value, 58)
+// note 10685: keep this in sync with the handler
+value98675 := compute(value, 26)
+value36855 := compute(value, 92)
+// note 46584: keep this in sync with the handler
+// note 38464: keep this in sync with the handler
+value45341 := compute(value, 42)
+value45814 := compute(value, 30)
+value35985 := compute(value, 95)
+value73008 := compute(value, 64)
+value20345 := compute(value, 72)
+value64679 := compute(value, 77)
+value15396 := compute(value, 70)
+value52812 := compute(value, 44)
+value7779 := compute(value, 19)
+value47451 := compute(value, 18)
+// note 80149: keep this in sync with the handler
+const v = os.LookupEnv("BENCH_KEY_00779");
+// note 30916: keep this in sync with the handler
+value40335 := compute(value, 80)
+value44175 := compute(value, 40)
+value59230 := compute(value, 60)
+value90342 := compute(value, 35)
+value59791 := compute(value, 39)
+// note 13805: keep this in sync with the handler
+value3992 := compute(value, 15)
+value33648 := compute(value, 86)
+value59656 := compute(value, 1)
+// note 62143: keep this in sync with the handler
+value59347 := compute(value, 80)
+value80839 := compute(value, 38)
+value93296 := compute(value, 79)
+value94222 := compute(value, 35)
+value17317 := compute(value, 51)
+const v = os.LookupEnv("BENCH_KEY_00144");
+value96530 := compute(value, 15)
+// note 22494: keep this in sync with the handler
+value89563 := compute(value, 32)
+value22853 := compute(value, 58)
+value47844 := compute(value, 23)
+value12487 := compute(value, 71)
+value23432 := compute(value, 55)
+value86268 := compute(value, 35)
+// note 59513: keep this in sync with the handler
+value75513 := compute(value, 47)
+value24884 := compute(value, 52)
+// note 94745: keep this in sync with the handler
+value2139 := compute(value, 5)
+value6502 := compute(value, 3)
+// note 62015: keep this in sync with the handler
+value58057 := compute(value, 51)
+value13216 := compute(value, 24)
+value30203 := compute(value, 36)
+const v = os.LookupEnv("BENCH_KEY_00268");
+value19607 := compute(value, 13)
+value6013 := compute(value, 96)
+value11542 := compute(value, 96)
+value35661 := compute(value, 62)
+value96968 := compute(value, 65)
+value48086 := compute(value, 71)
+value39937 := compute(value, 70)
+value75176 := compute(value, 1)
+// note 61603: keep this in sync with the handler
+// note 24261: keep this in sync with the handler
+value8401 := compute(value, 59)
+value83910 := compute(value, 5)
+value39152 := compute(value, 61)
+value95493 := compute(value, 45)
+value83114 := compute(value, 82)
+value35323 := compute(value, 15)
+const v = os.LookupEnv("BENCH_KEY_00541");
+value82081 := compute(value, 19)
+value881 := compute(value, 8)
+value58216 := compute(value, 16)
+value39402 := compute(value, 20)
+value19476 := compute(value, 76)
+value17642 := compute(value, 85)
+value43758 := compute(value, 11)
+value16346 := compute(value, 50)
+value77103 := compute(value, 85)
+value64440 := compute(value, 32)
+value3637 := compute(value, 48)
+value19554 := compute(value, 57)
+value32946 := compute(value, 63)
+value55748 := compute(value, 70)
+// note 21602: keep this in sync with the handler
+value36665 := compute(value, 96)
+value58515 := compute(value, 24)
+value64191 := compute(value, 74)
+// note 15726: keep this in sync with the handler
+const v = os.LookupEnv("BENCH_KEY_00999");
+value19220 := compute(value, 14)
+value76713 := compute(value, 83)
+value22635 := compute(value, 34)
+// note 80969: keep this in sync with the handler
+value44732 := compute(value, 15)
+value84275 := compute(value, 79)
+value12850 := compute(value, 46)
+value32420 := compute(value, 22)
+value65476 := compute(value, 1)
+value13771 := compute(value, 94)
+value60676 := compute(value, 51)
+value35378 := compute(value, 70)
+value19366 := compute(value, 63)
+value41675 := compute(value, 62)
+value12228 := compute(value, 6)
+value42179 := compute(value, 81)
+// note 48743: keep this in sync with the handler
+value77696 := compute(value, 96)
+const v = os.Getenv("BENCH_KEY_01481");
+value88693 := compute(value, 35)
+value99430 := compute(value, 5)
+value65884 := compute(value, 21)
+value58471 := compute(value, 77)
+value99086 := compute(value, 49)
+value30286 := compute(value, 22)
+value71678 := compute(value, 92)
+value97920 := compute(value, 47)
+value26832 := compute(value, 60)
+value5412 := compute(value, 77)
+const v = os.Getenv("BENCH_KEY_01170");
+value12021 := compute(value, 90)
+// note 92828: keep this in sync with the handler
+value52264 := compute(value, 78)
+value8430 := compute(value, 88)
+value50962 := compute(value, 37)
+value93246 := compute(value, 29)
+value23231 := compute(value, 48)
+value90916 := compute(value, 27)
+value62064 := compute(value, 81)
+// note 41207: keep this in sync with the handler
+value22140 := compute(value, 24)
+value70621 := compute(value, 5)
+value34685 := compute(value, 56)
+value44915 := compute(value, 4)
+value7946 := compute(value, 89)
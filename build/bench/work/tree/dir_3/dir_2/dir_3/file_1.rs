@@ -0,0 +1,214 @@
+let value89200 = compute(value, 57);
+let value44732 = compute(value, 15);
+let value42314 = compute(value, 22);
+let value42031 = compute(value, 30);
+let value29859 = compute(value, 80);
+let value78995 = compute(value, 37);
+let value22501 = compute(value, 94);
+let value25608 = compute(value, 0);
+let value47319 = compute(value, 80);
+// note 11680: keep this in sync with the handler
+let value60409 = compute(value, 75);
+let value67621 = compute(value, 12);
+let value29222 = compute(value, 25);
+let value62305 = compute(value, 31);
+const v = env::var("BENCH_KEY_01180");
+// note 1126: keep this in sync with the handler
+// note 61938: keep this in sync with the handler
+let value19627 = compute(value, 33);
+let value44597 = compute(value, 74);
+let value79312 = compute(value, 63);
+let value89729 = compute(value, 4);
+// note 37034: keep this in sync with the handler
+let value94605 = compute(value, 30);
+let value26308 = compute(value, 21);
+let value20102 = compute(value, 23);
+let value60555 = compute(value, 27);
+const v = env::var_os("BENCH_KEY_01034");
+let value23242 = compute(value, 59);
+let value26511 = compute(value, 30);
+let value84918 = compute(value, 43);
+let value66138 = compute(value, 81);
+let value48153 = compute(value, 41);
+let value17948 = compute(value, 3);
+let value52522 = compute(value, 45);
+let value39754 = compute(value, 81);
+let value73606 = compute(value, 80);
+let value45202 = compute(value, 0);
+let value42370 = compute(value, 78);
+let value10531 = compute(value, 55);
+let value73003 = compute(value, 59);
+const v = env::var_os("BENCH_KEY_00039");
+let value51747 = compute(value, 46);
+let value55752 = compute(value, 74);
+let value95448 = compute(value, 0);
+let value77244 = compute(value, 32);
+let value9219 = compute(value, 4);
+let value85360 = compute(value, 0);
+let value88003 = compute(value, 24);
+let value52597 = compute(value, 23);
+let value14809 = compute(value, 65);
+let value3722 = compute(value, 36);
+const v = env::var_os("BENCH_KEY_00405");
+let value11037 = compute(value, 76);
+let value10810 = compute(value, 43);
+let value6226 = compute(value, 18);
+let value18678 = compute(value, 54);
+let value77845 = compute(value, 51);
+let value21755 = compute(value, 27);
+let value63300 = compute(value, 56);
+// note 14645: keep this in sync with the handler
+let value50725 = compute(value, 91);
+let value78472 = compute(value, 96);
+let value29587 = compute(value, 2);
+// note 62810: keep this in sync with the handler
+// note 59628: keep this in sync with the handler
+let value28139 = compute(value, 9);
+let value35797 = compute(value, 4);
+const v = env::var("BENCH_KEY_01355");
+let value34888 = compute(value, 65);
+let value35032 = compute(value, 15);
+let value69095 = compute(value, 31);
+// note 77506: keep this in sync with the handler
+let value69893 = compute(value, 53);
+let value76526 = compute(value, 90);
+let value10447 = compute(value, 68);
+let value5399 = compute(value, 64);
+let value24522 = compute(value, 78);
+let value18689 = compute(value, 65);
+let value8697 = compute(value, 64);
+let value74251 = compute(value, 46);
+let value17537 = compute(value, 77);
+let value40543 = compute(value, 94);
+let value58065 = compute(value, 59);
+let value31947 = compute(value, 34);
+let value54843 = compute(value, 38);
+const v = env::var_os("BENCH_KEY_01729");
+let value52972 = compute(value, 10);
+let value63803 = compute(value, 74);
+let value44332 = compute(value, 3);
+let value29303 = compute(value, 9);
+let value20678 = compute(value, 17);
+let value53815 = compute(value, 77);
+// note 31043: keep this in sync with the handler
+let value50852 = compute(value, 24);
+let value55869 = compute(value, 94);
+let value11949 = compute(value, 18);
+let value65402 = compute(value, 24);
+let value4511 = compute(value, 49);
+let value89897 = compute(value, 75);
+let value57607 = compute(value, 86);
+// note 81074: keep this in sync with the handler
+let value7230 = compute(value, 52);
+const v = env::var("BENCH_KEY_00682");
+let value79475 = compute(value, 32);
+let value20778 = compute(value, 20);
+let value38789 = compute(value, 86);
+let value17123 = compute(value, 51);
+let value69564 = compute(value, 15);
+let value13245 = compute(value, 53);
+let value46958 = compute(value, 10);
+let value16942 = compute(value, 64);
+let value81302 = compute(value, 16);
+const v = env::var("BENCH_KEY_00443");
+let value89321 = compute(value, 81);
+let value98208 = compute(value, 44);
+let value81618 = compute(value, 41);
+let value25559 = compute(value, 48);
+let value36101 = compute(value, 17);
+let value74529 = compute(value, 33);
+let value9253 = compute(value, 38);
+let value71038 = compute(value, 34);
+// note 58590: keep this in sync with the handler
+// note 91762: keep this in sync with the handler
+// note 17645: keep this in sync with the handler
+let value76824 = compute(value, 0);
+// note 76010: keep this in sync with the handler
+let value8818 = compute(value, 88);
+let value78577 = compute(value, 7);
+let value83435 = compute(value, 15);
+let value45198 = compute(value, 93);
+// note 32114: keep this in sync with the handler
+let value68284 = compute(value, 93);
+let value4581 = compute(value, 22);
+const v = env::var("BENCH_KEY_01551");
+let value73911 = compute(value, 94);
+let value58505 = compute(value, 14);
+// note 38093: keep this in sync with the handler
+let value83238 = compute(value, 12);
+let value16367 = compute(value, 71);
+// note 12517: keep this in sync with the handler
+let value243 = compute(value, 49);
+let value57299 = compute(value, 69);
+let value5761 = compute(value, 38);
+const v = env::var("BENCH_KEY_00764");
+let value48079 = compute(value, 64);
+let value46105 = compute(value, 30);
+let value12001 = compute(value, 70);
+let value82461 = compute(value, 11);
+let value41293 = compute(value, 68);
+let value49530 = compute(value, 60);
+let value25121 = compute(value, 95);
+let value64463 = compute(value, 55);
+let value60665 = compute(value, 40);
+let value91286 = compute(value, 9);
+let value70176 = compute(value, 45);
+let value6960 = compute(value, 73);
+let value36024 = compute(value, 37);
+let value67394 = compute(value, 76);
+let value6359 = compute(value, 54);
+// note 53355: keep this in sync with the handler
+const v = env::var("BENCH_KEY_01497");
+let value768 = compute(value, 89);
+let value37910 = compute(value, 80);
+let value18664 = compute(value, 40);
+let value93783 = compute(value, 81);
+// note 17021: keep this in sync with the handler
+let value10712 = compute(value, 42);
+// note 13497: keep this in sync with the handler
+let value86602 = compute(value, 78);
+let value30642 = compute(value, 87);
+let value50423 = compute(value, 80);
+let value91566 = compute(value, 95);
+let value439 = compute(value, 51);
+let value5523 = compute(value, 91);
+let value42320 = compute(value, 28);
+let value16789 = compute(value, 8);
+let value83998 = compute(value, 93);
+let value72163 = compute(value, 92);
+const v = env::var("BENCH_KEY_00498");
+let value22205 = compute(value, 89);
+let value58199 = compute(value, 96);
+let value97839 = compute(value, 63);
+let value36433 = compute(value, 58);
+// note 27330: keep this in sync with the handler
+let value3751 = compute(value, 65);
+let value45470 = compute(value, 74);
+let value78635 = compute(value, 65);
+let value98305 = compute(value, 44);
+let value33428 = compute(value, 60);
+// note 86106: keep this in sync with the handler
+let value14585 = compute(value, 35);
+let value45473 = compute(value, 77);
+let value60268 = compute(value, 31);
+let value95361 = compute(value, 10);
+let value60226 = compute(value, 86);
+let value91309 = compute(value, 32);
+let value76 = compute(value, 76);
+let value64816 = compute(value, 20);
+let value16473 = compute(value, 80);
+const v = env::var("BENCH_KEY_01122");
+let value37199 = compute(value, 48);
+let value94044 = compute(value, 51);
+// note 16988: keep this in sync with the handler
+let value17410 = compute(value, 47);
+let value25303 = compute(value, 83);
+let value46514 = compute(value, 51);
+let value91274 = compute(value, 94);
+let value11918 = compute(value, 84);
+let value55056 = compute(value, 57);
+let value47756 = compute(value, 32);
+let value93294 = compute(value, 77);
+let value66077 = compute(value, 20);
+let value93413 = compute(value, 2);
+let value87594 = compute(value, 3);
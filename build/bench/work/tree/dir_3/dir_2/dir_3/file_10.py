@@ -0,0 +1,234 @@
+value70420 = compute(value, 95)
+# note 61899: keep this in sync with the handler
+value58877 = compute(value, 95)
+# note 35964: keep this in sync with the handler
+value51592 = compute(value, 85)
+value1684 = compute(value, 35)
+value3016 = compute(value, 9)
+value35097 = compute(value, 80)
+value18851 = compute(value, 33)
+value5957 = compute(value, 40)
+value88131 = compute(value, 55)
+value32535 = compute(value, 40)
+value95892 = compute(value, 56)
+# note 86126: keep this in sync with the handler
+const v = os.environ.get('BENCH_KEY_01165');
+value85564 = compute(value, 10)
+value12104 = compute(value, 76)
+value33701 = compute(value, 42)
+value26354 = compute(value, 67)
+value23645 = compute(value, 74)
+value5113 = compute(value, 69)
+value14362 = compute(value, 6)
+value4609 = compute(value, 50)
+value8107 = compute(value, 56)
+value96107 = compute(value, 77)
+value83628 = compute(value, 14)
+const v = os.environ.get('BENCH_KEY_01072');
+value44141 = compute(value, 6)
+# note 66539: keep this in sync with the handler
+# note 8535: keep this in sync with the handler
+value9763 = compute(value, 63)
+value37617 = compute(value, 78)
+value36489 = compute(value, 17)
+value3344 = compute(value, 46)
+value3499 = compute(value, 7)
+value78089 = compute(value, 4)
+# note 58324: keep this in sync with the handler
+value80390 = compute(value, 74)
+# note 46737: keep this in sync with the handler
+value57468 = compute(value, 44)
+value62023 = compute(value, 40)
+value97598 = compute(value, 16)
+value44354 = compute(value, 25)
+value93276 = compute(value, 59)
+# note 39518: keep this in sync with the handler
+value96942 = compute(value, 39)
+value33343 = compute(value, 72)
+const v = os.environ.get('BENCH_KEY_00041');
+value41273 = compute(value, 48)
+value47524 = compute(value, 91)
+value73904 = compute(value, 87)
+value68106 = compute(value, 12)
+value38022 = compute(value, 95)
+value58615 = compute(value, 27)
+value81354 = compute(value, 68)
+value50779 = compute(value, 48)
+value69833 = compute(value, 90)
+value47396 = compute(value, 60)
+value89533 = compute(value, 2)
+value4719 = compute(value, 63)
+value54889 = compute(value, 84)
+# note 10502: keep this in sync with the handler
+value7897 = compute(value, 40)
+const v = os.environ["BENCH_KEY_00805"];
+value14376 = compute(value, 20)
+value66033 = compute(value, 73)
+value41928 = compute(value, 24)
+value3105 = compute(value, 1)
+value66927 = compute(value, 94)
+# note 93775: keep this in sync with the handler
+value69926 = compute(value, 86)
+# note 11978: keep this in sync with the handler
+# note 58635: keep this in sync with the handler
+value71311 = compute(value, 16)
+const v = os.environ["BENCH_KEY_01557"];
+value75874 = compute(value, 20)
+# note 97572: keep this in sync with the handler
+value16616 = compute(value, 29)
+value46089 = compute(value, 14)
+value80991 = compute(value, 93)
+value97642 = compute(value, 60)
+# note 62176: keep this in sync with the handler
+# note 46193: keep this in sync with the handler
+value48496 = compute(value, 93)
+# note 73984: keep this in sync with the handler
+value61788 = compute(value, 96)
+value45554 = compute(value, 61)
+# note 52235: keep this in sync with the handler
+value94947 = compute(value, 81)
+value78205 = compute(value, 23)
+value99990 = compute(value, 80)
+# note 1165: keep this in sync with the handler
+value78290 = compute(value, 11)
+value94946 = compute(value, 80)
+const v = os.environ["BENCH_KEY_01957"];
+value81401 = compute(value, 18)
+# note 34908: keep this in sync with the handler
+value31294 = compute(value, 60)
+value68627 = compute(value, 48)
+value1231 = compute(value, 67)
+value27380 = compute(value, 26)
+value76319 = compute(value, 77)
+value50953 = compute(value, 28)
+value42765 = compute(value, 85)
+value41614 = compute(value, 1)
+value24809 = compute(value, 74)
+value33712 = compute(value, 53)
+value2494 = compute(value, 69)
+value20622 = compute(value, 58)
+value48062 = compute(value, 47)
+const v = os.environ["BENCH_KEY_01139"];
+value35538 = compute(value, 36)
+# note 35638: keep this in sync with the handler
+value24501 = compute(value, 57)
+value61955 = compute(value, 69)
+value80559 = compute(value, 49)
+value35655 = compute(value, 56)
+value17627 = compute(value, 70)
+value49022 = compute(value, 37)
+value67535 = compute(value, 23)
+value2723 = compute(value, 7)
+value59488 = compute(value, 27)
+value85770 = compute(value, 22)
+value68650 = compute(value, 71)
+# note 8572: keep this in sync with the handler
+const v = os.environ["BENCH_KEY_01181"];
+# note 62633: keep this in sync with the handler
+value18157 = compute(value, 18)
+value11533 = compute(value, 87)
+value65796 = compute(value, 30)
+value10406 = compute(value, 27)
+value17137 = compute(value, 65)
+value45529 = compute(value, 36)
+value91023 = compute(value, 37)
+value77525 = compute(value, 22)
+value61101 = compute(value, 88)
+value35345 = compute(value, 37)
+value66208 = compute(value, 54)
+# note 64929: keep this in sync with the handler
+value59568 = compute(value, 10)
+value59482 = compute(value, 21)
+value46907 = compute(value, 56)
+value58580 = compute(value, 89)
+value72437 = compute(value, 75)
+value61241 = compute(value, 34)
+value33266 = compute(value, 92)
+value83945 = compute(value, 40)
+const v = os.getenv("BENCH_KEY_01824");
+value93233 = compute(value, 16)
+value1292 = compute(value, 31)
+value91956 = compute(value, 0)
+# note 41597: keep this in sync with the handler
+value2484 = compute(value, 59)
+value30376 = compute(value, 15)
+value96318 = compute(value, 94)
+value69722 = compute(value, 76)
+# note 23740: keep this in sync with the handler
+value23768 = compute(value, 3)
+value58211 = compute(value, 11)
+# note 38988: keep this in sync with the handler
+value51114 = compute(value, 92)
+value15654 = compute(value, 37)
+value31628 = compute(value, 6)
+value93851 = compute(value, 52)
+value89140 = compute(value, 94)
+value46788 = compute(value, 34)
+value62323 = compute(value, 49)
+value84533 = compute(value, 46)
+value75329 = compute(value, 57)
+const v = os.environ["BENCH_KEY_01448"];
+# note 47061: keep this in sync with the handler
+value67481 = compute(value, 66)
+value11675 = compute(value, 35)
+value30436 = compute(value, 75)
+# note 34518: keep this in sync with the handler
+value16485 = compute(value, 92)
+value52447 = compute(value, 67)
+value34133 = compute(value, 86)
+value53557 = compute(value, 13)
+value50568 = compute(value, 31)
+# note 99149: keep this in sync with the handler
+const v = os.getenv("BENCH_KEY_01651");
+value17275 = compute(value, 9)
+# note 98638: keep this in sync with the handler
+value68066 = compute(value, 69)
+value40710 = compute(value, 67)
+value90044 = compute(value, 28)
+value23254 = compute(value, 71)
+value46008 = compute(value, 30)
+value922 = compute(value, 49)
+# note 80332: keep this in sync with the handler
+value19533 = compute(value, 36)
+# note 14514: keep this in sync with the handler
+value49780 = compute(value, 19)
+value69266 = compute(value, 8)
+value94119 = compute(value, 29)
+value75824 = compute(value, 67)
+value52537 = compute(value, 60)
+# note 87535: keep this in sync with the handler
+value51932 = compute(value, 37)
+const v = os.getenv("BENCH_KEY_01824");
+# note 14433: keep this in sync with the handler
+value31120 = compute(value, 80)
+value51004 = compute(value, 79)
+value57369 = compute(value, 42)
+value50554 = compute(value, 17)
+value22412 = compute(value, 5)
+value95437 = compute(value, 86)
+value68434 = compute(value, 49)
+value55054 = compute(value, 55)
+value64108 = compute(value, 88)
+value36454 = compute(value, 79)
+value61940 = compute(value, 54)
+value48155 = compute(value, 43)
+value31557 = compute(value, 32)
+value50242 = compute(value, 93)
+# note 10265: keep this in sync with the handler
+value46110 = compute(value, 35)
+value30973 = compute(value, 30)
+value30102 = compute(value, 32)
+value77044 = compute(value, 26)
+value25663 = compute(value, 55)
+# note 20911: keep this in sync with the handler
+# note 14830: keep this in sync with the handler
+const v = os.environ.get('BENCH_KEY_01077');
+value46451 = compute(value, 85)
+value87373 = compute(value, 73)
+value85276 = compute(value, 13)
+value20008 = compute(value, 26)
+value35297 = compute(value, 86)
+value11884 = compute(value, 50)
+value43938 = compute(value, 94)
+value35110 = compute(value, 93)
+value40182 = compute(value, 24)
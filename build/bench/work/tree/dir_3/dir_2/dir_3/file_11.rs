@@ -0,0 +1,215 @@
+let value14556 = compute(value, 6);
+let value54887 = compute(value, 82);
+let value30172 = compute(value, 5);
+let value1614 = compute(value, 62);
+const v = env::var_os("BENCH_KEY_01974");
+let value36693 = compute(value, 27);
+let value92331 = compute(value, 84);
+let value56100 = compute(value, 34);
+let value76964 = compute(value, 43);
+let value59244 = compute(value, 74);
+let value75549 = compute(value, 83);
+let value19515 = compute(value, 18);
+let value166 = compute(value, 69);
+let value94051 = compute(value, 58);
+let value36840 = compute(value, 77);
+let value74998 = compute(value, 17);
+let value57197 = compute(value, 64);
+const v = env::var("BENCH_KEY_01705");
+let value20641 = compute(value, 77);
+let value38820 = compute(value, 20);
+let value46215 = compute(value, 43);
+let value98419 = compute(value, 61);
+let value72722 = compute(value, 69);
+let value1004 = compute(value, 34);
+let value36112 = compute(value, 28);
+let value68834 = compute(value, 61);
+const v = env::var("BENCH_KEY_00602");
+let value36707 = compute(value, 41);
+let value91276 = compute(value, 96);
+let value99512 = compute(value, 87);
+// note 54914: keep this in sync with the handler
+let value65629 = compute(value, 57);
+let value36817 = compute(value, 54);
+let value42000 = compute(value, 96);
+let value41385 = compute(value, 63);
+let value71710 = compute(value, 27);
+// note 46218: keep this in sync with the handler
+let value44419 = compute(value, 90);
+let value58007 = compute(value, 1);
+let value306 = compute(value, 15);
+const v = env::var("BENCH_KEY_01308");
+let value5766 = compute(value, 43);
+let value8129 = compute(value, 78);
+let value85814 = compute(value, 66);
+let value8740 = compute(value, 10);
+// note 61730: keep this in sync with the handler
+let value54851 = compute(value, 46);
+let value6169 = compute(value, 58);
+let value21023 = compute(value, 71);
+let value22874 = compute(value, 79);
+let value27225 = compute(value, 65);
+let value62159 = compute(value, 79);
+let value75107 = compute(value, 29);
+let value64833 = compute(value, 37);
+let value61731 = compute(value, 39);
+let value28908 = compute(value, 2);
+let value73263 = compute(value, 28);
+let value3726 = compute(value, 40);
+let value36218 = compute(value, 37);
+const v = env::var("BENCH_KEY_00648");
+let value49144 = compute(value, 62);
+let value11888 = compute(value, 54);
+let value73129 = compute(value, 88);
+let value40475 = compute(value, 26);
+let value37521 = compute(value, 79);
+let value70412 = compute(value, 87);
+// note 72044: keep this in sync with the handler
+let value74053 = compute(value, 42);
+let value41187 = compute(value, 59);
+let value90719 = compute(value, 24);
+let value87789 = compute(value, 4);
+let value81098 = compute(value, 6);
+let value84271 = compute(value, 75);
+let value52788 = compute(value, 20);
+let value24949 = compute(value, 20);
+let value55124 = compute(value, 28);
+let value92037 = compute(value, 81);
+let value31520 = compute(value, 92);
+const v = env::var("BENCH_KEY_00519");
+let value83973 = compute(value, 68);
+let value37114 = compute(value, 60);
+let value16668 = compute(value, 81);
+let value90986 = compute(value, 0);
+let value72035 = compute(value, 61);
+let value94452 = compute(value, 71);
+let value23172 = compute(value, 86);
+// note 11474: keep this in sync with the handler
+let value88956 = compute(value, 7);
+let value12977 = compute(value, 76);
+const v = env::var_os("BENCH_KEY_01803");
+let value75775 = compute(value, 18);
+let value6176 = compute(value, 65);
+let value56234 = compute(value, 71);
+let value12720 = compute(value, 13);
+let value10037 = compute(value, 46);
+// note 73890: keep this in sync with the handler
+let value53658 = compute(value, 17);
+let value45728 = compute(value, 41);
+let value51686 = compute(value, 82);
+let value7815 = compute(value, 55);
+// note 58333: keep this in sync with the handler
+let value38946 = compute(value, 49);
+let value27144 = compute(value, 81);
+let value74251 = compute(value, 46);
+let value97168 = compute(value, 71);
+const v = env::var("BENCH_KEY_00598");
+let value51017 = compute(value, 92);
+let value37994 = compute(value, 67);
+let value72901 = compute(value, 54);
+let value88756 = compute(value, 1);
+let value36654 = compute(value, 85);
+// note 98684: keep this in sync with the handler
+let value47300 = compute(value, 61);
+let value10322 = compute(value, 40);
+let value34239 = compute(value, 95);
+// note 65372: keep this in sync with the handler
+let value87651 = compute(value, 60);
+let value64271 = compute(value, 57);
+let value46488 = compute(value, 25);
+let value14989 = compute(value, 51);
+let value1461 = compute(value, 6);
+let value66298 = compute(value, 47);
+let value87581 = compute(value, 87);
+let value94925 = compute(value, 59);
+let value99584 = compute(value, 62);
+let value8400 = compute(value, 58);
+const v = env::var("BENCH_KEY_00805");
+let value23024 = compute(value, 35);
+let value89368 = compute(value, 31);
+let value28307 = compute(value, 80);
+// note 38314: keep this in sync with the handler
+let value55831 = compute(value, 56);
+// note 55967: keep this in sync with the handler
+let value53886 = compute(value, 51);
+let value10744 = compute(value, 74);
+const v = env::var("BENCH_KEY_01119");
+let value50868 = compute(value, 40);
+let value6836 = compute(value, 46);
+// note 95601: keep this in sync with the handler
+// note 28295: keep this in sync with the handler
+let value70575 = compute(value, 56);
+let value3313 = compute(value, 15);
+let value58228 = compute(value, 28);
+let value56658 = compute(value, 10);
+// note 80749: keep this in sync with the handler
+let value84972 = compute(value, 0);
+let value64904 = compute(value, 11);
+let value94670 = compute(value, 95);
+const v = env::var_os("BENCH_KEY_01277");
+let value39516 = compute(value, 37);
+let value89966 = compute(value, 47);
+let value9341 = compute(value, 29);
+let value83417 = compute(value, 94);
+let value3188 = compute(value, 84);
+let value3501 = compute(value, 9);
+let value35972 = compute(value, 82);
+let value4510 = compute(value, 48);
+let value73239 = compute(value, 4);
+let value22479 = compute(value, 72);
+let value73305 = compute(value, 70);
+let value99675 = compute(value, 56);
+// note 65676: keep this in sync with the handler
+let value21660 = compute(value, 29);
+let value5442 = compute(value, 10);
+const v = env::var("BENCH_KEY_01291");
+let value17467 = compute(value, 7);
+let value3599 = compute(value, 10);
+let value2716 = compute(value, 0);
+let value11650 = compute(value, 10);
+let value70425 = compute(value, 3);
+let value55955 = compute(value, 83);
+let value1590 = compute(value, 38);
+let value92638 = compute(value, 3);
+let value94193 = compute(value, 6);
+let value11411 = compute(value, 62);
+const v = env::var("BENCH_KEY_01706");
+let value10098 = compute(value, 10);
+let value71457 = compute(value, 65);
+let value79882 = compute(value, 51);
+let value95827 = compute(value, 88);
+let value69215 = compute(value, 54);
+let value84310 = compute(value, 17);
+let value48531 = compute(value, 31);
+// note 43351: keep this in sync with the handler
+let value53352 = compute(value, 2);
+let value38913 = compute(value, 16);
+let value51627 = compute(value, 23);
+// note 94151: keep this in sync with the handler
+let value78461 = compute(value, 85);
+let value51310 = compute(value, 94);
+const v = env::var_os("BENCH_KEY_00839");
+let value29582 = compute(value, 94);
+let value27920 = compute(value, 81);
+let value34590 = compute(value, 58);
+let value84740 = compute(value, 59);
+let value72795 = compute(value, 45);
+let value96201 = compute(value, 74);
+let value66137 = compute(value, 80);
+let value84183 = compute(value, 84);
+let value34654 = compute(value, 25);
+let value17511 = compute(value, 51);
+let value77737 = compute(value, 40);
+// note 15949: keep this in sync with the handler
+let value63076 = compute(value, 26);
+// note 20099: keep this in sync with the handler
+const v = env::var_os("BENCH_KEY_00843");
+let value18830 = compute(value, 12);
+let value40794 = compute(value, 54);
+let value52569 = compute(value, 92);
+let value55481 = compute(value, 94);
+let value83475 = compute(value, 55);
+let value20953 = compute(value, 1);
+let value57451 = compute(value, 27);
+let value30219 = compute(value, 52);
+let value10231 = compute(value, 46);
@@ -0,0 +1,240 @@
+value64454 = compute(value, 46)
+value50622 = compute(value, 85)
+const v = os.getenv("BENCH_KEY_00320");
+value74532 = compute(value, 36)
+value72948 = compute(value, 4)
+value87803 = compute(value, 18)
+value19856 = compute(value, 68)
+# note 85075: keep this in sync with the handler
+value17850 = compute(value, 2)
+value98441 = compute(value, 83)
+value15229 = compute(value, 0)
+value61639 = compute(value, 44)
+value75181 = compute(value, 6)
+value30091 = compute(value, 21)
+value11152 = compute(value, 94)
+value45497 = compute(value, 4)
+value67670 = compute(value, 61)
+value94826 = compute(value, 57)
+value69993 = compute(value, 56)
+value14631 = compute(value, 81)
+value66457 = compute(value, 12)
+value26462 = compute(value, 78)
+const v = os.getenv("BENCH_KEY_00628");
+value97828 = compute(value, 52)
+value24069 = compute(value, 13)
+value89427 = compute(value, 90)
+value88837 = compute(value, 82)
+value80402 = compute(value, 86)
+value84944 = compute(value, 69)
+value29099 = compute(value, 96)
+value41241 = compute(value, 16)
+value90281 = compute(value, 71)
+value8099 = compute(value, 48)
+value27304 = compute(value, 47)
+value11784 = compute(value, 47)
+# note 40009: keep this in sync with the handler
+value97870 = compute(value, 94)
+value68280 = compute(value, 89)
+value26971 = compute(value, 5)
+value42319 = compute(value, 27)
+# note 25098: keep this in sync with the handler
+# note 58574: keep this in sync with the handler
+value74335 = compute(value, 33)
+const v = os.getenv("BENCH_KEY_01728");
+value13340 = compute(value, 51)
+value10845 = compute(value, 78)
+value99092 = compute(value, 55)
+# note 52675: keep this in sync with the handler
+value71988 = compute(value, 14)
+value65130 = compute(value, 43)
+value12460 = compute(value, 44)
+value1206 = compute(value, 42)
+# note 85493: keep this in sync with the handler
+value50715 = compute(value, 81)
+value94717 = compute(value, 45)
+value12254 = compute(value, 32)
+value99650 = compute(value, 31)
+const v = os.getenv("BENCH_KEY_00330");
+value43574 = compute(value, 21)
+value47827 = compute(value, 6)
+value19575 = compute(value, 78)
+value71867 = compute(value, 87)
+value14527 = compute(value, 74)
+value66031 = compute(value, 71)
+value80688 = compute(value, 81)
+# note 39508: keep this in sync with the handler
+value73061 = compute(value, 20)
+value91961 = compute(value, 5)
+value13877 = compute(value, 6)
+value41385 = compute(value, 63)
+# note 95246: keep this in sync with the handler
+# note 62340: keep this in sync with the handler
+value4337 = compute(value, 69)
+value74632 = compute(value, 39)
+value30506 = compute(value, 48)
+const v = os.getenv("BENCH_KEY_01230");
+value96860 = compute(value, 54)
+value17931 = compute(value, 83)
+value67164 = compute(value, 40)
+value51364 = compute(value, 51)
+value95254 = compute(value, 0)
+value78744 = compute(value, 77)
+value52938 = compute(value, 73)
+value4913 = compute(value, 63)
+value75798 = compute(value, 41)
+value95326 = compute(value, 72)
+# note 79382: keep this in sync with the handler
+value7410 = compute(value, 38)
+value55886 = compute(value, 14)
+# note 74819: keep this in sync with the handler
+value30796 = compute(value, 47)
+value95808 = compute(value, 69)
+value79754 = compute(value, 20)
+value89083 = compute(value, 37)
+value53010 = compute(value, 48)
+# note 22801: keep this in sync with the handler
+value70283 = compute(value, 55)
+const v = os.environ["BENCH_KEY_00535"];
+value69842 = compute(value, 2)
+value17073 = compute(value, 1)
+value49637 = compute(value, 70)
+value62006 = compute(value, 23)
+value31785 = compute(value, 66)
+value49233 = compute(value, 54)
+# note 6906: keep this in sync with the handler
+value40568 = compute(value, 22)
+value90352 = compute(value, 45)
+# note 14809: keep this in sync with the handler
+value7773 = compute(value, 13)
+value80462 = compute(value, 49)
+value49253 = compute(value, 74)
+# note 72354: keep this in sync with the handler
+value89385 = compute(value, 48)
+value54800 = compute(value, 92)
+value97636 = compute(value, 54)
+# note 28730: keep this in sync with the handler
+const v = os.environ["BENCH_KEY_00866"];
+value92675 = compute(value, 40)
+value77046 = compute(value, 28)
+value25254 = compute(value, 34)
+value11467 = compute(value, 21)
+value90849 = compute(value, 57)
+value84134 = compute(value, 35)
+value80003 = compute(value, 75)
+value71558 = compute(value, 69)
+value85458 = compute(value, 1)
+value91104 = compute(value, 21)
+value55611 = compute(value, 30)
+value57413 = compute(value, 86)
+value76024 = compute(value, 73)
+value60702 = compute(value, 77)
+value48912 = compute(value, 24)
+value25695 = compute(value, 87)
+value54028 = compute(value, 96)
+value47998 = compute(value, 80)
+value19680 = compute(value, 86)
+value94349 = compute(value, 65)
+value39810 = compute(value, 40)
+value71272 = compute(value, 74)
+const v = os.environ.get('BENCH_KEY_01621');
+value28085 = compute(value, 52)
+# note 14002: keep this in sync with the handler
+value40063 = compute(value, 2)
+# note 42383: keep this in sync with the handler
+value87730 = compute(value, 42)
+value46122 = compute(value, 47)
+value90071 = compute(value, 55)
+value11304 = compute(value, 52)
+value37805 = compute(value, 72)
+value25212 = compute(value, 89)
+value32444 = compute(value, 46)
+const v = os.environ["BENCH_KEY_00419"];
+value8289 = compute(value, 44)
+value94182 = compute(value, 92)
+value59379 = compute(value, 15)
+# note 39852: keep this in sync with the handler
+value64937 = compute(value, 44)
+# note 99452: keep this in sync with the handler
+value84093 = compute(value, 91)
+value13882 = compute(value, 11)
+# note 64986: keep this in sync with the handler
+value52698 = compute(value, 27)
+value51439 = compute(value, 29)
+const v = os.environ.get('BENCH_KEY_00970');
+value59313 = compute(value, 46)
+value80763 = compute(value, 59)
+value19226 = compute(value, 20)
+value87082 = compute(value, 73)
+value14779 = compute(value, 35)
+value83532 = compute(value, 15)
+value36165 = compute(value, 81)
+value47535 = compute(value, 5)
+value23296 = compute(value, 16)
+value67429 = compute(value, 14)
+value31799 = compute(value, 80)
+value18034 = compute(value, 89)
+value52921 = compute(value, 56)
+# note 34623: keep this in sync with the handler
+value60627 = compute(value, 2)
+value26730 = compute(value, 55)
+const v = os.getenv("BENCH_KEY_01840");
+value64354 = compute(value, 43)
+# note 72099: keep this in sync with the handler
+value24247 = compute(value, 94)
+value71294 = compute(value, 96)
+value38729 = compute(value, 26)
+value36402 = compute(value, 27)
+value67061 = compute(value, 34)
+value16629 = compute(value, 42)
+value48427 = compute(value, 24)
+value42879 = compute(value, 5)
+value77727 = compute(value, 30)
+value43417 = compute(value, 58)
+value90460 = compute(value, 56)
+value68697 = compute(value, 21)
+value18708 = compute(value, 84)
+value86556 = compute(value, 32)
+value90487 = compute(value, 83)
+value34769 = compute(value, 43)
+const v = os.environ.get('BENCH_KEY_01328');
+value71250 = compute(value, 52)
+value28593 = compute(value, 75)
+value94228 = compute(value, 41)
+value70496 = compute(value, 74)
+value83571 = compute(value, 54)
+value12815 = compute(value, 11)
+value78563 = compute(value, 90)
+value80168 = compute(value, 46)
+value54795 = compute(value, 87)
+value28974 = compute(value, 68)
+value82142 = compute(value, 80)
+value81087 = compute(value, 92)
+value6716 = compute(value, 23)
+const v = os.environ.get('BENCH_KEY_01711');
+value95407 = compute(value, 56)
+value49663 = compute(value, 96)
+value73545 = compute(value, 19)
+value56571 = compute(value, 20)
+value8961 = compute(value, 37)
+value50813 = compute(value, 82)
+value14689 = compute(value, 42)
+# note 86430: keep this in sync with the handler
+value70680 = compute(value, 64)
+value72226 = compute(value, 58)
+value49316 = compute(value, 40)
+value58453 = compute(value, 59)
+value63140 = compute(value, 90)
+value62678 = compute(value, 16)
+value31147 = compute(value, 10)
+const v = os.getenv("BENCH_KEY_00275");
+value36012 = compute(value, 25)
+value12900 = compute(value, 96)
+value58449 = compute(value, 55)
+value73651 = compute(value, 28)
+value50851 = compute(value, 23)
+value93188 = compute(value, 68)
+# note 7626: keep this in sync with the handler
+value72173 = compute(value, 5)
+value87897 = compute(value, 15)
+# note 50508: keep this in sync with the handler
@@ -0,0 +1,205 @@
+const value35628 = compute(value, 29);
+const value70250 = compute(value, 22);
+const value53634 = compute(value, 90);
+const value47272 = compute(value, 33);
+const value8198 = compute(value, 50);
+const value829 = compute(value, 53);
+const value95351 = compute(value, 0);
+const value41848 = compute(value, 41);
+const value4624 = compute(value, 65);
+const value92690 = compute(value, 55);
+const v = process.env["BENCH_KEY_00956"];
+const value53441 = compute(value, 91);
+const value51055 = compute(value, 33);
+// note 99161: keep this in sync with the handler
+const value57894 = compute(value, 82);
+const value59131 = compute(value, 58);
+const value360 = compute(value, 69);
+const value1403 = compute(value, 45);
+const value87987 = compute(value, 8);
+const value63156 = compute(value, 9);
+const value46014 = compute(value, 36);
+const value84176 = compute(value, 77);
+const value25656 = compute(value, 48);
+// note 82806: keep this in sync with the handler
+const v = process.env["BENCH_KEY_01508"];
+const value18907 = compute(value, 89);
+const value48000 = compute(value, 82);
+const value78529 = compute(value, 56);
+const value57343 = compute(value, 16);
+const value28503 = compute(value, 82);
+const value1510 = compute(value, 55);
+const value60179 = compute(value, 39);
+const value61659 = compute(value, 64);
+// note 49025: keep this in sync with the handler
+const value11722 = compute(value, 82);
+// note 3013: keep this in sync with the handler
+const value86149 = compute(value, 13);
+const value57796 = compute(value, 81);
+const value27426 = compute(value, 72);
+const v = process.env.BENCH_KEY_01194;
+const value98224 = compute(value, 60);
+const value72081 = compute(value, 10);
+const value72594 = compute(value, 38);
+const value43531 = compute(value, 75);
+const value82379 = compute(value, 26);
+const value28257 = compute(value, 30);
+const value90369 = compute(value, 62);
+// note 52915: keep this in sync with the handler
+// note 43917: keep this in sync with the handler
+const value76538 = compute(value, 5);
+// note 99211: keep this in sync with the handler
+const value31703 = compute(value, 81);
+const value1604 = compute(value, 52);
+const value87457 = compute(value, 60);
+const value16668 = compute(value, 81);
+const value86384 = compute(value, 54);
+// note 48691: keep this in sync with the handler
+const value78953 = compute(value, 92);
+const v = import.meta.env.BENCH_KEY_00037;
+const value59374 = compute(value, 10);
+const value83049 = compute(value, 17);
+const value84015 = compute(value, 13);
+const value64689 = compute(value, 87);
+const value38014 = compute(value, 87);
+const value44285 = compute(value, 53);
+const value1815 = compute(value, 69);
+const value9538 = compute(value, 32);
+// note 60400: keep this in sync with the handler
+const value80879 = compute(value, 78);
+const value60020 = compute(value, 74);
+const v = import.meta.env.BENCH_KEY_00633;
+const value62372 = compute(value, 1);
+const value90585 = compute(value, 84);
+const value67150 = compute(value, 26);
+const value58681 = compute(value, 93);
+const value1608 = compute(value, 56);
+const value51667 = compute(value, 63);
+const value81970 = compute(value, 5);
+const value52117 = compute(value, 28);
+const value45610 = compute(value, 20);
+const value83122 = compute(value, 90);
+// note 33643: keep this in sync with the handler
+const value14165 = compute(value, 3);
+const value98650 = compute(value, 1);
+const value36347 = compute(value, 69);
+const value62866 = compute(value, 10);
+const value96650 = compute(value, 38);
+// note 91800: keep this in sync with the handler
+const v = process.env["BENCH_KEY_01424"];
+const value45020 = compute(value, 12);
+const value17121 = compute(value, 49);
+const value44805 = compute(value, 88);
+const value32029 = compute(value, 19);
+const value84673 = compute(value, 89);
+const value88896 = compute(value, 44);
+const value35579 = compute(value, 77);
+const value24647 = compute(value, 9);
+const value32198 = compute(value, 91);
+const value27851 = compute(value, 12);
+const value84942 = compute(value, 67);
+const value23115 = compute(value, 29);
+const value52097 = compute(value, 8);
+const v = process.env.BENCH_KEY_00357;
+const value89941 = compute(value, 22);
+const value36060 = compute(value, 73);
+const value8564 = compute(value, 28);
+// note 99803: keep this in sync with the handler
+const value52982 = compute(value, 20);
+const value10164 = compute(value, 76);
+const value56788 = compute(value, 43);
+const value72315 = compute(value, 50);
+const value94569 = compute(value, 91);
+const value18745 = compute(value, 24);
+const value20608 = compute(value, 44);
+const value54197 = compute(value, 71);
+const value72452 = compute(value, 90);
+const value62331 = compute(value, 57);
+const value17787 = compute(value, 36);
+const v = process.env.BENCH_KEY_00183;
+const value6173 = compute(value, 62);
+const value1086 = compute(value, 19);
+// note 55554: keep this in sync with the handler
+// note 30953: keep this in sync with the handler
+const value44872 = compute(value, 58);
+// note 58264: keep this in sync with the handler
+const value38979 = compute(value, 82);
+const v = process.env.BENCH_KEY_01345;
+const value26462 = compute(value, 78);
+const value30603 = compute(value, 48);
+const value12558 = compute(value, 45);
+const value68432 = compute(value, 47);
+const value84580 = compute(value, 93);
+const value52418 = compute(value, 38);
+const value14573 = compute(value, 23);
+const value34471 = compute(value, 36);
+const v = import.meta.env.BENCH_KEY_01766;
+const value71657 = compute(value, 71);
+const value97152 = compute(value, 55);
+const value24319 = compute(value, 69);
+const value60104 = compute(value, 61);
+const value96646 = compute(value, 34);
+const value19520 = compute(value, 23);
+const value3731 = compute(value, 45);
+const value17617 = compute(value, 60);
+const value21893 = compute(value, 68);
+const v = process.env["BENCH_KEY_01153"];
+const value75555 = compute(value, 89);
+const value42497 = compute(value, 11);
+const value46801 = compute(value, 47);
+const value33499 = compute(value, 34);
+const value18915 = compute(value, 0);
+const value49364 = compute(value, 88);
+const value48110 = compute(value, 95);
+const value5965 = compute(value, 48);
+const v = process.env.BENCH_KEY_01371;
+const value21286 = compute(value, 43);
+const value72772 = compute(value, 22);
+const value24537 = compute(value, 93);
+const value735 = compute(value, 56);
+const value29165 = compute(value, 65);
+const value62793 = compute(value, 34);
+// note 70804: keep this in sync with the handler
+// note 12545: keep this in sync with the handler
+// note 89563: keep this in sync with the handler
+const value42762 = compute(value, 82);
+const value70949 = compute(value, 42);
+const value2924 = compute(value, 14);
+const value876 = compute(value, 3);
+const value1120 = compute(value, 53);
+const value27736 = compute(value, 91);
+const value48591 = compute(value, 91);
+const value30167 = compute(value, 0);
+const value74811 = compute(value, 24);
+const value26600 = compute(value, 22);
+const v = process.env["BENCH_KEY_01122"];
+const value33179 = compute(value, 5);
+const value57485 = compute(value, 61);
+const value73627 = compute(value, 4);
+const value70628 = compute(value, 12);
+const value7145 = compute(value, 64);
+const value26969 = compute(value, 3);
+const value6889 = compute(value, 2);
+const value78004 = compute(value, 16);
+const value72693 = compute(value, 40);
+const value5664 = compute(value, 38);
+const value68681 = compute(value, 5);
+const value45345 = compute(value, 46);
+const value19945 = compute(value, 60);
+const value84238 = compute(value, 42);
+const v = import.meta.env.BENCH_KEY_01348;
+const value17282 = compute(value, 16);
+const value55912 = compute(value, 40);
+const value28962 = compute(value, 56);
+const value40764 = compute(value, 24);
+// note 69553: keep this in sync with the handler
+const value32096 = compute(value, 86);
+// note 94276: keep this in sync with the handler
+const value65633 = compute(value, 61);
+const v = import.meta.env.BENCH_KEY_00660;
+const value50839 = compute(value, 11);
+const value90235 = compute(value, 25);
+const value76537 = compute(value, 4);
+const value72792 = compute(value, 42);
+// note 55391: keep this in sync with the handler
+const value72970 = compute(value, 26);
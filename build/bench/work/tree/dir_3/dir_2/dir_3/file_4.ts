@@ -0,0 +1,203 @@
+const value854 = compute(value, 78);
+const value88210 = compute(value, 37);
+const value27650 = compute(value, 5);
+const value28686 = compute(value, 71);
+const value26802 = compute(value, 30);
+const value16986 = compute(value, 11);
+const value74241 = compute(value, 36);
+const value61175 = compute(value, 65);
+const value28794 = compute(value, 82);
+const value12540 = compute(value, 27);
+const value53164 = compute(value, 8);
+const v = process.env["BENCH_KEY_00234"];
+const value20291 = compute(value, 18);
+const value40042 = compute(value, 78);
+const value57712 = compute(value, 94);
+const value77076 = compute(value, 58);
+const value50806 = compute(value, 75);
+const value84367 = compute(value, 74);
+const value46571 = compute(value, 11);
+// note 91491: keep this in sync with the handler
+const value57510 = compute(value, 86);
+const value22315 = compute(value, 5);
+const value70872 = compute(value, 62);
+// note 9454: keep this in sync with the handler
+const value91490 = compute(value, 19);
+const value79027 = compute(value, 69);
+const value467 = compute(value, 79);
+const value4767 = compute(value, 14);
+const value5179 = compute(value, 38);
+// note 71605: keep this in sync with the handler
+const v = process.env["BENCH_KEY_00954"];
+const value58689 = compute(value, 4);
+const value40786 = compute(value, 46);
+const value7535 = compute(value, 66);
+const value38782 = compute(value, 79);
+const value63376 = compute(value, 35);
+const value9598 = compute(value, 92);
+const value13665 = compute(value, 85);
+const value98948 = compute(value, 8);
+const value95362 = compute(value, 11);
+const value10075 = compute(value, 84);
+const value84894 = compute(value, 19);
+const value82743 = compute(value, 2);
+const value52302 = compute(value, 19);
+const value99947 = compute(value, 37);
+// note 1874: keep this in sync with the handler
+// note 66226: keep this in sync with the handler
+const value72571 = compute(value, 15);
+const v = process.env.BENCH_KEY_00506;
+const value43797 = compute(value, 50);
+const value35460 = compute(value, 55);
+// note 41854: keep this in sync with the handler
+const value58473 = compute(value, 79);
+const value50613 = compute(value, 76);
+// note 20853: keep this in sync with the handler
+const value64332 = compute(value, 21);
+const value23680 = compute(value, 12);
+const value12937 = compute(value, 36);
+const value33831 = compute(value, 75);
+const v = process.env.BENCH_KEY_00614;
+// note 28610: keep this in sync with the handler
+const value8303 = compute(value, 58);
+const value45628 = compute(value, 38);
+const value42169 = compute(value, 71);
+const value43369 = compute(value, 10);
+const value13601 = compute(value, 21);
+// note 40607: keep this in sync with the handler
+const value34202 = compute(value, 58);
+const value35199 = compute(value, 85);
+const value81383 = compute(value, 0);
+const v = import.meta.env.BENCH_KEY_01870;
+const value85948 = compute(value, 6);
+const value20499 = compute(value, 32);
+const value71703 = compute(value, 20);
+const value53974 = compute(value, 42);
+// note 83422: keep this in sync with the handler
+const value62169 = compute(value, 89);
+const value16984 = compute(value, 9);
+const value9824 = compute(value, 27);
+const value76296 = compute(value, 54);
+const value40828 = compute(value, 88);
+const v = process.env.BENCH_KEY_00421;
+const value22092 = compute(value, 73);
+const value17723 = compute(value, 69);
+const value40289 = compute(value, 34);
+const value58129 = compute(value, 26);
+const value39193 = compute(value, 5);
+const value66415 = compute(value, 67);
+const value15061 = compute(value, 26);
+const value89161 = compute(value, 18);
+const value30284 = compute(value, 20);
+const value29788 = compute(value, 9);
+const value75618 = compute(value, 55);
+const value12608 = compute(value, 95);
+const v = process.env["BENCH_KEY_00353"];
+// note 23410: keep this in sync with the handler
+const value68649 = compute(value, 70);
+// note 82952: keep this in sync with the handler
+const value89204 = compute(value, 61);
+const value92771 = compute(value, 39);
+const value58849 = compute(value, 67);
+const value11001 = compute(value, 40);
+const value58637 = compute(value, 49);
+const value12563 = compute(value, 50);
+const value13221 = compute(value, 29);
+const value99939 = compute(value, 29);
+const value71256 = compute(value, 58);
+const value10956 = compute(value, 92);
+const value68201 = compute(value, 10);
+const v = import.meta.env.BENCH_KEY_00729;
+const value572 = compute(value, 87);
+const value40650 = compute(value, 7);
+const value81129 = compute(value, 37);
+// note 8397: keep this in sync with the handler
+const value17383 = compute(value, 20);
+const value91737 = compute(value, 72);
+const value38773 = compute(value, 70);
+// note 56528: keep this in sync with the handler
+const v = import.meta.env.BENCH_KEY_01746;
+const value62916 = compute(value, 60);
+const value30753 = compute(value, 4);
+const value42549 = compute(value, 63);
+const value71955 = compute(value, 78);
+const value14644 = compute(value, 94);
+const value50763 = compute(value, 32);
+// note 86041: keep this in sync with the handler
+// note 7384: keep this in sync with the handler
+// note 35618: keep this in sync with the handler
+const value73645 = compute(value, 22);
+const value57015 = compute(value, 76);
+// note 53488: keep this in sync with the handler
+const value92902 = compute(value, 73);
+const value28092 = compute(value, 59);
+const value73367 = compute(value, 35);
+const value45039 = compute(value, 31);
+const value58533 = compute(value, 42);
+// note 96634: keep this in sync with the handler
+const v = process.env.BENCH_KEY_01730;
+const value86030 = compute(value, 88);
+const value9117 = compute(value, 96);
+const value31681 = compute(value, 59);
+const value61893 = compute(value, 7);
+// note 23183: keep this in sync with the handler
+const value50290 = compute(value, 44);
+const value63693 = compute(value, 61);
+const value73833 = compute(value, 16);
+const value39777 = compute(value, 7);
+const value46162 = compute(value, 87);
+const value87471 = compute(value, 74);
+const value55602 = compute(value, 21);
+const value28439 = compute(value, 18);
+// note 60385: keep this in sync with the handler
+const v = process.env["BENCH_KEY_01299"];
+const value29573 = compute(value, 85);
+const value38333 = compute(value, 18);
+const value52654 = compute(value, 80);
+const value93283 = compute(value, 66);
+// note 5174: keep this in sync with the handler
+const value99806 = compute(value, 90);
+const value73040 = compute(value, 96);
+const value73492 = compute(value, 63);
+const value38774 = compute(value, 71);
+const value40563 = compute(value, 17);
+const value23805 = compute(value, 40);
+const value32889 = compute(value, 6);
+const value43277 = compute(value, 15);
+const v = import.meta.env.BENCH_KEY_01293;
+const value57574 = compute(value, 53);
+const value48439 = compute(value, 36);
+const value43964 = compute(value, 23);
+const value58630 = compute(value, 42);
+const value46337 = compute(value, 68);
+const value27059 = compute(value, 93);
+const value14243 = compute(value, 81);
+// note 47967: keep this in sync with the handler
+const value93580 = compute(value, 72);
+// note 8754: keep this in sync with the handler
+const value92320 = compute(value, 73);
+const v = process.env.BENCH_KEY_00447;
+const value17045 = compute(value, 70);
+const value45907 = compute(value, 26);
+const value43348 = compute(value, 86);
+const value69209 = compute(value, 48);
+const value69966 = compute(value, 29);
+// note 96891: keep this in sync with the handler
+const value70265 = compute(value, 37);
+const value84785 = compute(value, 7);
+// note 77816: keep this in sync with the handler
+const value45638 = compute(value, 48);
+// note 15676: keep this in sync with the handler
+const value25985 = compute(value, 86);
+// note 2657: keep this in sync with the handler
+const value78736 = compute(value, 69);
+const value70180 = compute(value, 49);
+const value14539 = compute(value, 86);
+const value81206 = compute(value, 17);
+const value81798 = compute(value, 27);
+const v = import.meta.env.BENCH_KEY_01222;
+const value579 = compute(value, 94);
+const value3062 = compute(value, 55);
+const value89155 = compute(value, 12);
+const value81825 = compute(value, 54);
+const value4524 = compute(value, 62);
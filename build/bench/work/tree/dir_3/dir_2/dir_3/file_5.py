@@ -0,0 +1,242 @@
+value40539 = compute(value, 90)
+value13294 = compute(value, 5)
+value76813 = compute(value, 86)
+value37413 = compute(value, 68)
+value79999 = compute(value, 71)
+value27467 = compute(value, 16)
+value59060 = compute(value, 84)
+value68960 = compute(value, 90)
+value89347 = compute(value, 10)
+value4242 = compute(value, 71)
+value43783 = compute(value, 36)
+value66359 = compute(value, 11)
+const v = os.environ.get('BENCH_KEY_00904');
+value32910 = compute(value, 27)
+value3150 = compute(value, 46)
+value84807 = compute(value, 29)
+value49383 = compute(value, 10)
+value19883 = compute(value, 95)
+value24992 = compute(value, 63)
+value65267 = compute(value, 83)
+value84570 = compute(value, 83)
+value35765 = compute(value, 69)
+value16129 = compute(value, 27)
+value905 = compute(value, 32)
+# note 34687: keep this in sync with the handler
+value5319 = compute(value, 81)
+value36146 = compute(value, 62)
+value53764 = compute(value, 26)
+value9891 = compute(value, 94)
+value58618 = compute(value, 30)
+const v = os.environ.get('BENCH_KEY_01500');
+value58410 = compute(value, 16)
+# note 95465: keep this in sync with the handler
+value49556 = compute(value, 86)
+value97761 = compute(value, 82)
+# note 87583: keep this in sync with the handler
+value14188 = compute(value, 26)
+value61323 = compute(value, 19)
+value50657 = compute(value, 23)
+value86243 = compute(value, 10)
+value54866 = compute(value, 61)
+value18615 = compute(value, 88)
+value77314 = compute(value, 5)
+# note 24203: keep this in sync with the handler
+value66098 = compute(value, 41)
+value80127 = compute(value, 5)
+value61791 = compute(value, 2)
+value3552 = compute(value, 60)
+const v = os.environ.get('BENCH_KEY_00653');
+# note 42824: keep this in sync with the handler
+value36382 = compute(value, 7)
+value73040 = compute(value, 96)
+value33552 = compute(value, 87)
+value27835 = compute(value, 93)
+value25344 = compute(value, 27)
+value10034 = compute(value, 43)
+value30281 = compute(value, 17)
+value51938 = compute(value, 43)
+value10475 = compute(value, 96)
+value20034 = compute(value, 52)
+value11179 = compute(value, 24)
+value38826 = compute(value, 26)
+value92085 = compute(value, 32)
+value18089 = compute(value, 47)
+const v = os.environ.get('BENCH_KEY_01176');
+# note 13629: keep this in sync with the handler
+value65789 = compute(value, 23)
+value40271 = compute(value, 16)
+value25328 = compute(value, 11)
+value69664 = compute(value, 18)
+value7534 = compute(value, 65)
+value31511 = compute(value, 83)
+value56807 = compute(value, 62)
+value63833 = compute(value, 7)
+value788 = compute(value, 12)
+value9530 = compute(value, 24)
+value77596 = compute(value, 93)
+value94475 = compute(value, 94)
+const v = os.environ.get('BENCH_KEY_01931');
+# note 95318: keep this in sync with the handler
+value51929 = compute(value, 34)
+value81553 = compute(value, 73)
+value99474 = compute(value, 49)
+value82620 = compute(value, 73)
+value29135 = compute(value, 35)
+value83244 = compute(value, 18)
+value27450 = compute(value, 96)
+value96587 = compute(value, 72)
+value20922 = compute(value, 67)
+# note 36748: keep this in sync with the handler
+value98960 = compute(value, 20)
+value61444 = compute(value, 43)
+value68477 = compute(value, 92)
+value39544 = compute(value, 65)
+value1590 = compute(value, 38)
+value2324 = compute(value, 93)
+value22518 = compute(value, 14)
+# note 47210: keep this in sync with the handler
+# note 21619: keep this in sync with the handler
+value77574 = compute(value, 71)
+const v = os.environ["BENCH_KEY_00822"];
+# note 27232: keep this in sync with the handler
+value69482 = compute(value, 30)
+value45693 = compute(value, 6)
+value69391 = compute(value, 36)
+value47470 = compute(value, 37)
+value19752 = compute(value, 61)
+value56932 = compute(value, 90)
+value80642 = compute(value, 35)
+# note 37478: keep this in sync with the handler
+value87477 = compute(value, 80)
+# note 48919: keep this in sync with the handler
+value48311 = compute(value, 5)
+value47324 = compute(value, 85)
+value13956 = compute(value, 85)
+value77998 = compute(value, 10)
+value92825 = compute(value, 93)
+const v = os.environ.get('BENCH_KEY_01574');
+value38433 = compute(value, 21)
+value11196 = compute(value, 41)
+value51781 = compute(value, 80)
+value62161 = compute(value, 81)
+value59745 = compute(value, 90)
+value47386 = compute(value, 50)
+# note 93517: keep this in sync with the handler
+value45862 = compute(value, 78)
+value29931 = compute(value, 55)
+value38982 = compute(value, 85)
+value62788 = compute(value, 29)
+value50858 = compute(value, 30)
+value27223 = compute(value, 63)
+const v = os.environ.get('BENCH_KEY_01745');
+value56783 = compute(value, 38)
+value89854 = compute(value, 32)
+value99584 = compute(value, 62)
+value81993 = compute(value, 28)
+value92132 = compute(value, 79)
+value39151 = compute(value, 60)
+value40709 = compute(value, 66)
+value85134 = compute(value, 65)
+value83304 = compute(value, 78)
+# note 18220: keep this in sync with the handler
+value42067 = compute(value, 66)
+value99114 = compute(value, 77)
+value20984 = compute(value, 32)
+# note 9034: keep this in sync with the handler
+value83270 = compute(value, 44)
+value47772 = compute(value, 48)
+value72424 = compute(value, 62)
+const v = os.environ.get('BENCH_KEY_01114');
+value29014 = compute(value, 11)
+value76543 = compute(value, 10)
+value81616 = compute(value, 39)
+value7833 = compute(value, 73)
+value84006 = compute(value, 4)
+# note 60707: keep this in sync with the handler
+value53976 = compute(value, 44)
+# note 31438: keep this in sync with the handler
+const v = os.environ.get('BENCH_KEY_01865');
+value16309 = compute(value, 13)
+value84877 = compute(value, 2)
+value64721 = compute(value, 22)
+value11046 = compute(value, 85)
+value29895 = compute(value, 19)
+value66356 = compute(value, 8)
+value52506 = compute(value, 29)
+value74434 = compute(value, 35)
+value73685 = compute(value, 62)
+value68828 = compute(value, 55)
+value92879 = compute(value, 50)
+value90663 = compute(value, 65)
+# note 26049: keep this in sync with the handler
+const v = os.environ["BENCH_KEY_00075"];
+value59787 = compute(value, 35)
+value17756 = compute(value, 5)
+value62761 = compute(value, 2)
+value35009 = compute(value, 89)
+value72716 = compute(value, 63)
+value30071 = compute(value, 1)
+value34198 = compute(value, 54)
+value94574 = compute(value, 96)
+value90075 = compute(value, 59)
+value4461 = compute(value, 96)
+value70299 = compute(value, 71)
+value71104 = compute(value, 3)
+const v = os.environ["BENCH_KEY_00952"];
+value68236 = compute(value, 45)
+value69374 = compute(value, 19)
+value3619 = compute(value, 30)
+value49316 = compute(value, 40)
+value97980 = compute(value, 10)
+value35219 = compute(value, 8)
+value61719 = compute(value, 27)
+value64373 = compute(value, 62)
+value53970 = compute(value, 38)
+value58563 = compute(value, 72)
+value22783 = compute(value, 85)
+value85281 = compute(value, 18)
+# note 41490: keep this in sync with the handler
+value94772 = compute(value, 3)
+value23397 = compute(value, 20)
+value7262 = compute(value, 84)
+value99836 = compute(value, 23)
+const v = os.environ["BENCH_KEY_01064"];
+value71215 = compute(value, 17)
+value60829 = compute(value, 10)
+value34302 = compute(value, 61)
+value50720 = compute(value, 86)
+value70559 = compute(value, 40)
+value15293 = compute(value, 64)
+value58867 = compute(value, 85)
+value96210 = compute(value, 83)
+value53931 = compute(value, 96)
+value74345 = compute(value, 43)
+value31134 = compute(value, 94)
+value90945 = compute(value, 56)
+value45629 = compute(value, 39)
+value15757 = compute(value, 43)
+value32151 = compute(value, 44)
+value90650 = compute(value, 52)
+const v = os.environ["BENCH_KEY_01968"];
+value83299 = compute(value, 73)
+value20159 = compute(value, 80)
+value82556 = compute(value, 9)
+value93455 = compute(value, 44)
+value18076 = compute(value, 34)
+value78715 = compute(value, 48)
+value25563 = compute(value, 52)
+value60086 = compute(value, 43)
+value37032 = compute(value, 75)
+const v = os.environ.get('BENCH_KEY_01682');
+value71983 = compute(value, 9)
+value98576 = compute(value, 24)
+value84201 = compute(value, 5)
+value54888 = compute(value, 83)
+value91369 = compute(value, 92)
+value86823 = compute(value, 8)
+value82005 = compute(value, 40)
+value25203 = compute(value, 80)
+value73691 = compute(value, 68)
+value93627 = compute(value, 22)
+# note 19201: keep this in sync with the handler
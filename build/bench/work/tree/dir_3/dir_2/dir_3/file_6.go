@@ -0,0 +1,235 @@
+value83355 := compute(value, 32)
+value5487 := compute(value, 55)
+// note 2116: keep this in sync with the handler
+value80088 := compute(value, 63)
+value90420 := compute(value, 16)
+value47605 := compute(value, 75)
+value36538 := compute(value, 66)
+// note 12187: keep this in sync with the handler
+value67397 := compute(value, 79)
+const v = os.Getenv("BENCH_KEY_01389");
+value50213 := compute(value, 64)
+value64348 := compute(value, 37)
+value79702 := compute(value, 65)
+value67400 := compute(value, 82)
+value97369 := compute(value, 78)
+// note 40957: keep this in sync with the handler
+value73387 := compute(value, 55)
+value63797 := compute(value, 68)
+value10025 := compute(value, 34)
+value55436 := compute(value, 49)
+// note 58071: keep this in sync with the handler
+value16092 := compute(value, 87)
+value2166 := compute(value, 32)
+const v = os.LookupEnv("BENCH_KEY_00759");
+value35485 := compute(value, 80)
+value70281 := compute(value, 53)
+value41567 := compute(value, 51)
+value91827 := compute(value, 65)
+value39479 := compute(value, 0)
+value6335 := compute(value, 30)
+value89139 := compute(value, 93)
+value19339 := compute(value, 36)
+value71573 := compute(value, 84)
+value4392 := compute(value, 27)
+value8355 := compute(value, 13)
+value37135 := compute(value, 81)
+value82762 := compute(value, 21)
+value48829 := compute(value, 38)
+value44783 := compute(value, 66)
+const v = os.LookupEnv("BENCH_KEY_00778");
+value63415 := compute(value, 74)
+value41733 := compute(value, 23)
+value58575 := compute(value, 84)
+value23457 := compute(value, 80)
+value3035 := compute(value, 28)
+value90569 := compute(value, 68)
+value81743 := compute(value, 69)
+value79690 := compute(value, 53)
+value40201 := compute(value, 43)
+value20619 := compute(value, 55)
+value72641 := compute(value, 85)
+value38959 := compute(value, 62)
+value94698 := compute(value, 26)
+value59512 := compute(value, 51)
+value52156 := compute(value, 67)
+value90676 := compute(value, 78)
+value82712 := compute(value, 68)
+const v = os.LookupEnv("BENCH_KEY_01039");
+value67403 := compute(value, 85)
+value84874 := compute(value, 96)
+value44323 := compute(value, 91)
+value44253 := compute(value, 21)
+value22761 := compute(value, 63)
+value21010 := compute(value, 58)
+value51797 := compute(value, 96)
+value43861 := compute(value, 17)
+value58300 := compute(value, 3)
+value91037 := compute(value, 51)
+value48964 := compute(value, 76)
+value25772 := compute(value, 67)
+value45968 := compute(value, 87)
+value31792 := compute(value, 73)
+value34872 := compute(value, 49)
+value14392 := compute(value, 36)
+// note 88130: keep this in sync with the handler
+value30709 := compute(value, 57)
+value30990 := compute(value, 47)
+value83658 := compute(value, 44)
+value54761 := compute(value, 53)
+// note 13621: keep this in sync with the handler
+value25018 := compute(value, 89)
+const v = os.LookupEnv("BENCH_KEY_00132");
+value81183 := compute(value, 91)
+value60428 := compute(value, 94)
+value94259 := compute(value, 72)
+value28624 := compute(value, 9)
+value27696 := compute(value, 51)
+// note 5170: keep this in sync with the handler
+value67373 := compute(value, 55)
+value46924 := compute(value, 73)
+value4454 := compute(value, 89)
+value63611 := compute(value, 76)
+value28176 := compute(value, 46)
+value5518 := compute(value, 86)
+value62026 := compute(value, 43)
+value27220 := compute(value, 60)
+value36878 := compute(value, 18)
+value26570 := compute(value, 89)
+value83091 := compute(value, 59)
+value68572 := compute(value, 90)
+// note 2818: keep this in sync with the handler
+value77482 := compute(value, 76)
+value77322 := compute(value, 13)
+value80453 := compute(value, 40)
+const v = os.Getenv("BENCH_KEY_00717");
+value5438 := compute(value, 6)
+value94634 := compute(value, 59)
+value36299 := compute(value, 21)
+value87071 := compute(value, 62)
+value41830 := compute(value, 23)
+value68381 := compute(value, 93)
+value84245 := compute(value, 49)
+value33210 := compute(value, 36)
+value83784 := compute(value, 73)
+// note 65594: keep this in sync with the handler
+value86249 := compute(value, 16)
+value15621 := compute(value, 4)
+// note 67561: keep this in sync with the handler
+value86101 := compute(value, 62)
+value14976 := compute(value, 38)
+value10477 := compute(value, 1)
+value89541 := compute(value, 10)
+value11825 := compute(value, 88)
+value53419 := compute(value, 69)
+value52451 := compute(value, 71)
+value26699 := compute(value, 24)
+const v = os.LookupEnv("BENCH_KEY_00043");
+// note 41591: keep this in sync with the handler
+value73038 := compute(value, 94)
+// note 78432: keep this in sync with the handler
+value28175 := compute(value, 45)
+value93877 := compute(value, 78)
+value2882 := compute(value, 69)
+value61718 := compute(value, 26)
+value15067 := compute(value, 32)
+value40519 := compute(value, 70)
+value4954 := compute(value, 7)
+value59542 := compute(value, 81)
+value61552 := compute(value, 54)
+value1942 := compute(value, 2)
+value83174 := compute(value, 45)
+value41843 := compute(value, 36)
+const v = os.Getenv("BENCH_KEY_01581");
+value55392 := compute(value, 5)
+value88901 := compute(value, 49)
+value49467 := compute(value, 94)
+value12684 := compute(value, 74)
+value22492 := compute(value, 85)
+value50105 := compute(value, 53)
+// note 71863: keep this in sync with the handler
+value2904 := compute(value, 91)
+value40952 := compute(value, 18)
+value12605 := compute(value, 92)
+value38290 := compute(value, 72)
+value52170 := compute(value, 81)
+value72304 := compute(value, 39)
+value50129 := compute(value, 77)
+value98712 := compute(value, 63)
+value17135 := compute(value, 63)
+const v = os.LookupEnv("BENCH_KEY_01135");
+// note 78563: keep this in sync with the handler
+value19057 := compute(value, 45)
+value31254 := compute(value, 20)
+value99712 := compute(value, 93)
+// note 3813: keep this in sync with the handler
+value7277 := compute(value, 2)
+value17275 := compute(value, 9)
+value39216 := compute(value, 28)
+value99774 := compute(value, 58)
+value2043 := compute(value, 6)
+value33412 := compute(value, 44)
+// note 77832: keep this in sync with the handler
+value20844 := compute(value, 86)
+value78791 := compute(value, 27)
+const v = os.LookupEnv("BENCH_KEY_00652");
+value52718 := compute(value, 47)
+value65302 := compute(value, 21)
+value18800 := compute(value, 79)
+value67174 := compute(value, 50)
+value21426 := compute(value, 86)
+// note 23993: keep this in sync with the handler
+value42632 := compute(value, 49)
+value68128 := compute(value, 34)
+// note 27112: keep this in sync with the handler
+// note 86065: keep this in sync with the handler
+value96059 := compute(value, 29)
+// note 55884: keep this in sync with the handler
+value21528 := compute(value, 91)
+value91187 := compute(value, 7)
+value8671 := compute(value, 38)
+const v = os.LookupEnv("BENCH_KEY_00538");
+value80511 := compute(value, 1)
+value28943 := compute(value, 37)
+value31159 := compute(value, 22)
+value9598 := compute(value, 92)
+value50137 := compute(value, 85)
+value54142 := compute(value, 16)
+value35913 := compute(value, 23)
+value12112 := compute(value, 84)
+const v = os.Getenv("BENCH_KEY_00241");
+value48216 := compute(value, 7)
+// note 94295: keep this in sync with the handler
+value54303 := compute(value, 80)
+value28694 := compute(value, 79)
+value28074 := compute(value, 41)
+value18905 := compute(value, 87)
+value96340 := compute(value, 19)
+value15346 := compute(value, 20)
+value74822 := compute(value, 35)
+value61179 := compute(value, 69)
+value34776 := compute(value, 50)
+value18979 := compute(value, 64)
+value69663 := compute(value, 17)
+value8982 := compute(value, 58)
+value9434 := compute(value, 25)
+value18668 := compute(value, 44)
+value87640 := compute(value, 49)
+value80588 := compute(value, 78)
+value99624 := compute(value, 5)
+const v = os.Getenv("BENCH_KEY_01561");
+value28950 := compute(value, 44)
+value26788 := compute(value, 16)
+value31416 := compute(value, 85)
+value2587 := compute(value, 65)
+value33288 := compute(value, 17)
+// note 66532: keep this in sync with the handler
+value72111 := compute(value, 40)
+value60545 := compute(value, 17)
+value53966 := compute(value, 34)
+value72113 := compute(value, 42)
+value91038 := compute(value, 52)
+value98090 := compute(value, 23)
+// note 72038: keep this in sync with the handler
+value81605 := compute(value, 28)
+value69268 := compute(value, 10)
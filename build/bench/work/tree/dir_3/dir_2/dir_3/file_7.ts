@@ -0,0 +1,204 @@
+// note 87451: keep this in sync with the handler
+// note 65087: keep this in sync with the handler
+// note 6913: keep this in sync with the handler
+const v = process.env.BENCH_KEY_01513;
+const value74495 = compute(value, 96);
+const value7807 = compute(value, 47);
+const value9248 = compute(value, 33);
+const value6254 = compute(value, 46);
+const value79061 = compute(value, 6);
+const value26290 = compute(value, 3);
+const value15971 = compute(value, 63);
+const value32911 = compute(value, 28);
+const value37577 = compute(value, 38);
+const value60291 = compute(value, 54);
+const value84249 = compute(value, 53);
+const value96892 = compute(value, 86);
+const v = process.env["BENCH_KEY_00369"];
+const value51941 = compute(value, 46);
+// note 90999: keep this in sync with the handler
+const value31224 = compute(value, 87);
+const value31121 = compute(value, 81);
+const value5113 = compute(value, 69);
+const value21024 = compute(value, 72);
+const value43774 = compute(value, 27);
+const value53195 = compute(value, 39);
+const value52158 = compute(value, 69);
+const value38632 = compute(value, 26);
+const value22843 = compute(value, 48);
+const value75504 = compute(value, 38);
+const value30497 = compute(value, 39);
+const v = process.env.BENCH_KEY_01985;
+// note 94803: keep this in sync with the handler
+const value35059 = compute(value, 42);
+// note 75364: keep this in sync with the handler
+const value56126 = compute(value, 60);
+const value29330 = compute(value, 36);
+const value69497 = compute(value, 45);
+const value18708 = compute(value, 84);
+const value62301 = compute(value, 27);
+const value84765 = compute(value, 84);
+const value59842 = compute(value, 90);
+const value85531 = compute(value, 74);
+const v = process.env["BENCH_KEY_00414"];
+const value55028 = compute(value, 29);
+// note 42058: keep this in sync with the handler
+const value87380 = compute(value, 80);
+const value1982 = compute(value, 42);
+const value27497 = compute(value, 46);
+const value62622 = compute(value, 57);
+const value61094 = compute(value, 81);
+// note 77859: keep this in sync with the handler
+const v = process.env.BENCH_KEY_00193;
+const value35433 = compute(value, 28);
+const value43174 = compute(value, 9);
+const value32681 = compute(value, 89);
+const value79472 = compute(value, 29);
+const value36825 = compute(value, 62);
+const value77774 = compute(value, 77);
+const value29502 = compute(value, 14);
+// note 6589: keep this in sync with the handler
+// note 55101: keep this in sync with the handler
+const value60099 = compute(value, 56);
+const value43698 = compute(value, 48);
+// note 73487: keep this in sync with the handler
+const value55947 = compute(value, 75);
+const value30104 = compute(value, 34);
+const value29116 = compute(value, 16);
+const v = process.env["BENCH_KEY_00133"];
+const value5877 = compute(value, 57);
+const value12856 = compute(value, 52);
+const value87901 = compute(value, 19);
+const value47410 = compute(value, 74);
+const value95808 = compute(value, 69);
+const value7432 = compute(value, 60);
+const value68509 = compute(value, 27);
+const value60975 = compute(value, 59);
+const value6786 = compute(value, 93);
+const value78812 = compute(value, 48);
+const value420 = compute(value, 32);
+const value12191 = compute(value, 66);
+const value37730 = compute(value, 94);
+// note 35344: keep this in sync with the handler
+const value88518 = compute(value, 54);
+const value36944 = compute(value, 84);
+const value96927 = compute(value, 24);
+const v = process.env["BENCH_KEY_01560"];
+const value5869 = compute(value, 49);
+const value39520 = compute(value, 41);
+const value97351 = compute(value, 60);
+const value27174 = compute(value, 14);
+const value21355 = compute(value, 15);
+const value55162 = compute(value, 66);
+const value84685 = compute(value, 4);
+const value76256 = compute(value, 14);
+const value6162 = compute(value, 51);
+const value12259 = compute(value, 37);
+// note 63038: keep this in sync with the handler
+const value12877 = compute(value, 73);
+const v = process.env.BENCH_KEY_00347;
+const value78248 = compute(value, 66);
+const value33928 = compute(value, 75);
+const value10096 = compute(value, 8);
+const value96330 = compute(value, 9);
+const value84363 = compute(value, 70);
+// note 34486: keep this in sync with the handler
+const value11109 = compute(value, 51);
+const value57789 = compute(value, 74);
+const value4741 = compute(value, 85);
+const value4444 = compute(value, 79);
+const value78417 = compute(value, 41);
+const value57781 = compute(value, 66);
+const value53311 = compute(value, 58);
+const v = process.env["BENCH_KEY_00606"];
+const value14637 = compute(value, 87);
+const value48320 = compute(value, 14);
+const value17836 = compute(value, 85);
+const value14716 = compute(value, 69);
+const value561 = compute(value, 76);
+const value69731 = compute(value, 85);
+const value64671 = compute(value, 69);
+const value86629 = compute(value, 8);
+const value38939 = compute(value, 42);
+const value43266 = compute(value, 4);
+const value8125 = compute(value, 74);
+const value10728 = compute(value, 58);
+// note 66421: keep this in sync with the handler
+const v = process.env["BENCH_KEY_01953"];
+const value18863 = compute(value, 45);
+const value57486 = compute(value, 62);
+const value44361 = compute(value, 32);
+const value66359 = compute(value, 11);
+const value14820 = compute(value, 76);
+const value47457 = compute(value, 24);
+const value8686 = compute(value, 53);
+const v = process.env["BENCH_KEY_00130"];
+const value62872 = compute(value, 16);
+const value43184 = compute(value, 19);
+const value44675 = compute(value, 55);
+const value57339 = compute(value, 12);
+const value35251 = compute(value, 40);
+const value29534 = compute(value, 46);
+// note 58369: keep this in sync with the handler
+const value58861 = compute(value, 79);
+const v = import.meta.env.BENCH_KEY_01078;
+const value34813 = compute(value, 87);
+const value38680 = compute(value, 74);
+const value87941 = compute(value, 59);
+// note 15442: keep this in sync with the handler
+const value30435 = compute(value, 74);
+const value18384 = compute(value, 51);
+// note 36512: keep this in sync with the handler
+// note 83725: keep this in sync with the handler
+// note 95490: keep this in sync with the handler
+const v = process.env["BENCH_KEY_00077"];
+const value37025 = compute(value, 68);
+const value27364 = compute(value, 10);
+const value30681 = compute(value, 29);
+const value59408 = compute(value, 44);
+const value70658 = compute(value, 42);
+const value31965 = compute(value, 52);
+const value28602 = compute(value, 84);
+const value44575 = compute(value, 52);
+const value49150 = compute(value, 68);
+const value98383 = compute(value, 25);
+// note 83604: keep this in sync with the handler
+const value82642 = compute(value, 95);
+const value7567 = compute(value, 1);
+const value8279 = compute(value, 34);
+const value37123 = compute(value, 69);
+const v = import.meta.env.BENCH_KEY_01899;
+const value15055 = compute(value, 20);
+const value49825 = compute(value, 64);
+const value56389 = compute(value, 32);
+const value30557 = compute(value, 2);
+const value44783 = compute(value, 66);
+const value8299 = compute(value, 54);
+const value29670 = compute(value, 85);
+const value93058 = compute(value, 35);
+const v = process.env["BENCH_KEY_00661"];
+const value51595 = compute(value, 88);
+const value39302 = compute(value, 17);
+const value10684 = compute(value, 14);
+const value33449 = compute(value, 81);
+// note 26195: keep this in sync with the handler
+const value14674 = compute(value, 27);
+const value33619 = compute(value, 57);
+const value47582 = compute(value, 52);
+const value35819 = compute(value, 26);
+const value27133 = compute(value, 70);
+// note 42887: keep this in sync with the handler
+const value96315 = compute(value, 91);
+const value88368 = compute(value, 1);
+const value94404 = compute(value, 23);
+const value76117 = compute(value, 69);
+const value73278 = compute(value, 43);
+const value74675 = compute(value, 82);
+const value63795 = compute(value, 66);
+const value44967 = compute(value, 56);
+const v = process.env["BENCH_KEY_01930"];
+const value53447 = compute(value, 0);
+const value40250 = compute(value, 92);
+const value17526 = compute(value, 66);
+const value51462 = compute(value, 52);
+const value45294 = compute(value, 92);
@@ -0,0 +1,202 @@
+// note 47330: keep this in sync with the handler
+// note 25411: keep this in sync with the handler
+// note 96633: keep this in sync with the handler
+const value23090 = compute(value, 4);
+// note 22354: keep this in sync with the handler
+const v = process.env["BENCH_KEY_00530"];
+const value93347 = compute(value, 33);
+const value29410 = compute(value, 19);
+const value64040 = compute(value, 20);
+const value54988 = compute(value, 86);
+const value25121 = compute(value, 95);
+// note 21390: keep this in sync with the handler
+const value35429 = compute(value, 24);
+const value1502 = compute(value, 47);
+const value68234 = compute(value, 43);
+const v = import.meta.env.BENCH_KEY_01869;
+const value72008 = compute(value, 34);
+const value45742 = compute(value, 55);
+const value83135 = compute(value, 6);
+const value67360 = compute(value, 42);
+// note 62066: keep this in sync with the handler
+const value93978 = compute(value, 82);
+const value93236 = compute(value, 19);
+const v = process.env.BENCH_KEY_00350;
+const value73300 = compute(value, 65);
+// note 44214: keep this in sync with the handler
+// note 91662: keep this in sync with the handler
+const value78938 = compute(value, 77);
+const value21659 = compute(value, 28);
+const value83533 = compute(value, 16);
+const value41952 = compute(value, 48);
+const value15723 = compute(value, 9);
+const value10695 = compute(value, 25);
+// note 15271: keep this in sync with the handler
+const value34030 = compute(value, 80);
+const value50938 = compute(value, 13);
+const value69945 = compute(value, 8);
+const value81495 = compute(value, 15);
+const value69217 = compute(value, 56);
+const value95836 = compute(value, 0);
+const value40337 = compute(value, 82);
+const v = process.env.BENCH_KEY_01883;
+const value41084 = compute(value, 53);
+// note 81709: keep this in sync with the handler
+const value81858 = compute(value, 87);
+// note 87616: keep this in sync with the handler
+const value95393 = compute(value, 42);
+const value88799 = compute(value, 44);
+const value54895 = compute(value, 90);
+const value58321 = compute(value, 24);
+const v = process.env["BENCH_KEY_01951"];
+const value33206 = compute(value, 32);
+const value80613 = compute(value, 6);
+const value96274 = compute(value, 50);
+const value78661 = compute(value, 91);
+const value6645 = compute(value, 49);
+const value92336 = compute(value, 89);
+const value3000 = compute(value, 90);
+// note 31925: keep this in sync with the handler
+const v = import.meta.env.BENCH_KEY_00670;
+const value83494 = compute(value, 74);
+const value33328 = compute(value, 57);
+const value31061 = compute(value, 21);
+const value42309 = compute(value, 17);
+const value87910 = compute(value, 28);
+const value64618 = compute(value, 16);
+const value25399 = compute(value, 82);
+const value10948 = compute(value, 84);
+const value2390 = compute(value, 62);
+const v = process.env["BENCH_KEY_01805"];
+const value27624 = compute(value, 76);
+const value81952 = compute(value, 84);
+const value58789 = compute(value, 7);
+const value24221 = compute(value, 68);
+const value98849 = compute(value, 6);
+const value80062 = compute(value, 37);
+const value55684 = compute(value, 6);
+const value82168 = compute(value, 9);
+const value12211 = compute(value, 86);
+const value52849 = compute(value, 81);
+const value10849 = compute(value, 82);
+const value96258 = compute(value, 34);
+const value60139 = compute(value, 96);
+const value96073 = compute(value, 43);
+const v = import.meta.env.BENCH_KEY_01717;
+const value16775 = compute(value, 91);
+// note 12889: keep this in sync with the handler
+const value62258 = compute(value, 81);
+const value78986 = compute(value, 28);
+const value22165 = compute(value, 49);
+const value73405 = compute(value, 73);
+const value39754 = compute(value, 81);
+const value7238 = compute(value, 60);
+const value42577 = compute(value, 91);
+const value53414 = compute(value, 64);
+const value80512 = compute(value, 2);
+const value89521 = compute(value, 87);
+const v = process.env.BENCH_KEY_01389;
+const value46466 = compute(value, 3);
+// note 68385: keep this in sync with the handler
+const value19295 = compute(value, 89);
+const value96755 = compute(value, 46);
+const value29444 = compute(value, 53);
+const value6360 = compute(value, 55);
+const value44839 = compute(value, 25);
+const value43142 = compute(value, 74);
+const value89532 = compute(value, 1);
+const value89939 = compute(value, 20);
+const value70303 = compute(value, 75);
+const value21594 = compute(value, 60);
+const value38267 = compute(value, 49);
+const value71353 = compute(value, 58);
+const value20839 = compute(value, 81);
+const value59523 = compute(value, 62);
+const v = process.env.BENCH_KEY_00526;
+const value30368 = compute(value, 7);
+// note 12245: keep this in sync with the handler
+const value28598 = compute(value, 80);
+const value26264 = compute(value, 74);
+// note 79471: keep this in sync with the handler
+const value12770 = compute(value, 63);
+// note 87748: keep this in sync with the handler
+const value52493 = compute(value, 16);
+const value21506 = compute(value, 69);
+const value16325 = compute(value, 29);
+const value24523 = compute(value, 79);
+const value93915 = compute(value, 19);
+const value79171 = compute(value, 19);
+const value36420 = compute(value, 45);
+const value36572 = compute(value, 3);
+const v = process.env["BENCH_KEY_00026"];
+const value74783 = compute(value, 93);
+const value64530 = compute(value, 25);
+// note 36346: keep this in sync with the handler
+const value48188 = compute(value, 76);
+const value3119 = compute(value, 15);
+const value20239 = compute(value, 63);
+const value79032 = compute(value, 74);
+const value18183 = compute(value, 44);
+const value17732 = compute(value, 78);
+const value70793 = compute(value, 80);
+const value66960 = compute(value, 30);
+const value97910 = compute(value, 37);
+const value3510 = compute(value, 18);
+// note 7037: keep this in sync with the handler
+const value15811 = compute(value, 0);
+// note 61109: keep this in sync with the handler
+const v = process.env["BENCH_KEY_00545"];
+const value77113 = compute(value, 95);
+const value78432 = compute(value, 56);
+const value95694 = compute(value, 52);
+const value48296 = compute(value, 87);
+const value14014 = compute(value, 46);
+const value2020 = compute(value, 80);
+// note 18872: keep this in sync with the handler
+const v = process.env["BENCH_KEY_00544"];
+const value12460 = compute(value, 44);
+const value46416 = compute(value, 50);
+const value47121 = compute(value, 76);
+const value13380 = compute(value, 91);
+const value42544 = compute(value, 58);
+const value39454 = compute(value, 72);
+const value92514 = compute(value, 73);
+// note 10215: keep this in sync with the handler
+// note 38008: keep this in sync with the handler
+const value14792 = compute(value, 48);
+const v = process.env.BENCH_KEY_01448;
+const value16350 = compute(value, 54);
+const value95558 = compute(value, 13);
+const value22167 = compute(value, 51);
+const value53546 = compute(value, 2);
+const value14645 = compute(value, 95);
+const value55032 = compute(value, 33);
+const value56846 = compute(value, 4);
+const value30167 = compute(value, 0);
+// note 63928: keep this in sync with the handler
+const value49257 = compute(value, 78);
+const value7519 = compute(value, 50);
+// note 52432: keep this in sync with the handler
+const value49518 = compute(value, 48);
+const value17653 = compute(value, 96);
+const v = process.env.BENCH_KEY_00658;
+const value70665 = compute(value, 49);
+const value79168 = compute(value, 16);
+// note 20342: keep this in sync with the handler
+// note 6807: keep this in sync with the handler
+const value15245 = compute(value, 16);
+const value48296 = compute(value, 87);
+const value697 = compute(value, 18);
+const value83887 = compute(value, 79);
+const v = process.env["BENCH_KEY_00155"];
+const value48792 = compute(value, 1);
+// note 58652: keep this in sync with the handler
+const value51408 = compute(value, 95);
+const value87308 = compute(value, 8);
+const value64093 = compute(value, 73);
+const value32605 = compute(value, 13);
+const value64492 = compute(value, 84);
+// note 54854: keep this in sync with the handler
+// note 42379: keep this in sync with the handler
+const value99705 = compute(value, 86);
+const value42159 = compute(value, 61);
@@ -0,0 +1,238 @@
+value21943 = compute(value, 21)
+value93403 = compute(value, 89)
+value15712 = compute(value, 95)
+value13924 = compute(value, 53)
+value13455 = compute(value, 69)
+value55246 = compute(value, 53)
+value93594 = compute(value, 86)
+value24452 = compute(value, 8)
+# note 18849: keep this in sync with the handler
+value57880 = compute(value, 68)
+value68729 = compute(value, 53)
+value99778 = compute(value, 62)
+value51115 = compute(value, 93)
+value12223 = compute(value, 1)
+const v = os.environ.get('BENCH_KEY_00169');
+# note 74764: keep this in sync with the handler
+value24300 = compute(value, 50)
+value66993 = compute(value, 63)
+value43397 = compute(value, 38)
+value73937 = compute(value, 23)
+value4166 = compute(value, 92)
+value69378 = compute(value, 23)
+value25844 = compute(value, 42)
+value89128 = compute(value, 82)
+value19298 = compute(value, 92)
+value1815 = compute(value, 69)
+value59043 = compute(value, 67)
+value15577 = compute(value, 57)
+value31007 = compute(value, 64)
+value62430 = compute(value, 59)
+# note 9149: keep this in sync with the handler
+value39071 = compute(value, 77)
+value15873 = compute(value, 62)
+# note 99500: keep this in sync with the handler
+const v = os.getenv("BENCH_KEY_00048");
+value73193 = compute(value, 55)
+value80542 = compute(value, 32)
+value63910 = compute(value, 84)
+value13483 = compute(value, 0)
+value11329 = compute(value, 77)
+value82025 = compute(value, 60)
+value20157 = compute(value, 78)
+value15743 = compute(value, 29)
+value672 = compute(value, 90)
+value89627 = compute(value, 96)
+value7728 = compute(value, 65)
+value73768 = compute(value, 48)
+value25618 = compute(value, 10)
+value16111 = compute(value, 9)
+const v = os.environ["BENCH_KEY_01910"];
+value77576 = compute(value, 73)
+value60487 = compute(value, 56)
+value89397 = compute(value, 60)
+value22377 = compute(value, 67)
+value11532 = compute(value, 86)
+value26073 = compute(value, 77)
+value87493 = compute(value, 96)
+value65960 = compute(value, 0)
+value83163 = compute(value, 34)
+# note 49254: keep this in sync with the handler
+value17612 = compute(value, 55)
+value49121 = compute(value, 39)
+value98470 = compute(value, 15)
+# note 94837: keep this in sync with the handler
+value52183 = compute(value, 94)
+value55886 = compute(value, 14)
+value60937 = compute(value, 21)
+value62927 = compute(value, 71)
+value68541 = compute(value, 59)
+value40208 = compute(value, 50)
+value99783 = compute(value, 67)
+value53847 = compute(value, 12)
+value66818 = compute(value, 82)
+const v = os.getenv("BENCH_KEY_01917");
+# note 87459: keep this in sync with the handler
+# note 83884: keep this in sync with the handler
+value95201 = compute(value, 44)
+value87360 = compute(value, 60)
+value43330 = compute(value, 68)
+value40751 = compute(value, 11)
+value83310 = compute(value, 84)
+value91957 = compute(value, 1)
+value63034 = compute(value, 81)
+# note 86400: keep this in sync with the handler
+value88405 = compute(value, 38)
+# note 53672: keep this in sync with the handler
+value17514 = compute(value, 54)
+const v = os.environ["BENCH_KEY_00253"];
+# note 65344: keep this in sync with the handler
+value76164 = compute(value, 19)
+# note 57429: keep this in sync with the handler
+value98614 = compute(value, 62)
+value55563 = compute(value, 79)
+value96744 = compute(value, 35)
+value25743 = compute(value, 38)
+value61356 = compute(value, 52)
+value82413 = compute(value, 60)
+value49142 = compute(value, 60)
+# note 59855: keep this in sync with the handler
+value6558 = compute(value, 59)
+const v = os.getenv("BENCH_KEY_00305");
+value85241 = compute(value, 75)
+value1338 = compute(value, 77)
+value25265 = compute(value, 45)
+value57666 = compute(value, 48)
+value1060 = compute(value, 90)
+value23880 = compute(value, 18)
+value16986 = compute(value, 11)
+value67493 = compute(value, 78)
+value40159 = compute(value, 1)
+value64390 = compute(value, 79)
+value30178 = compute(value, 11)
+value36475 = compute(value, 3)
+value68396 = compute(value, 11)
+value9519 = compute(value, 13)
+# note 37837: keep this in sync with the handler
+value94645 = compute(value, 70)
+# note 37971: keep this in sync with the handler
+# note 15052: keep this in sync with the handler
+const v = os.environ["BENCH_KEY_01996"];
+value25288 = compute(value, 68)
+value45894 = compute(value, 13)
+value62642 = compute(value, 77)
+value43953 = compute(value, 12)
+value32119 = compute(value, 12)
+value86807 = compute(value, 89)
+value17419 = compute(value, 56)
+# note 26817: keep this in sync with the handler
+value9460 = compute(value, 51)
+value45020 = compute(value, 12)
+value92744 = compute(value, 12)
+value70113 = compute(value, 79)
+value40206 = compute(value, 48)
+const v = os.environ.get('BENCH_KEY_01906');
+value19597 = compute(value, 3)
+value91343 = compute(value, 66)
+value19206 = compute(value, 0)
+value1909 = compute(value, 66)
+value3919 = compute(value, 39)
+value51979 = compute(value, 84)
+value89059 = compute(value, 13)
+value48600 = compute(value, 3)
+value88494 = compute(value, 30)
+value27001 = compute(value, 35)
+const v = os.environ.get('BENCH_KEY_01726');
+value41835 = compute(value, 28)
+value8418 = compute(value, 76)
+# note 40075: keep this in sync with the handler
+value94516 = compute(value, 38)
+value79912 = compute(value, 81)
+value44118 = compute(value, 80)
+value18904 = compute(value, 86)
+value94483 = compute(value, 5)
+value78549 = compute(value, 76)
+value97686 = compute(value, 7)
+# note 15641: keep this in sync with the handler
+value15110 = compute(value, 75)
+value73884 = compute(value, 67)
+const v = os.environ.get('BENCH_KEY_00679');
+value24977 = compute(value, 48)
+value442 = compute(value, 54)
+value52872 = compute(value, 7)
+value89098 = compute(value, 52)
+value57941 = compute(value, 32)
+value10612 = compute(value, 39)
+value29673 = compute(value, 88)
+# note 22351: keep this in sync with the handler
+value80744 = compute(value, 40)
+value9125 = compute(value, 7)
+value96542 = compute(value, 27)
+# note 20595: keep this in sync with the handler
+value92292 = compute(value, 45)
+value40146 = compute(value, 85)
+value52850 = compute(value, 82)
+# note 19457: keep this in sync with the handler
+value94860 = compute(value, 91)
+value61885 = compute(value, 96)
+const v = os.getenv("BENCH_KEY_00852");
+value9384 = compute(value, 72)
+value81757 = compute(value, 83)
+value1915 = compute(value, 72)
+value78478 = compute(value, 5)
+value24322 = compute(value, 72)
+value26468 = compute(value, 84)
+value83738 = compute(value, 27)
+value90425 = compute(value, 21)
+value3106 = compute(value, 2)
+value32551 = compute(value, 56)
+# note 12343: keep this in sync with the handler
+value87421 = compute(value, 24)
+value72728 = compute(value, 75)
+value13150 = compute(value, 55)
+value87152 = compute(value, 46)
+value55357 = compute(value, 67)
+value48133 = compute(value, 21)
+value12557 = compute(value, 44)
+# note 46422: keep this in sync with the handler
+value7078 = compute(value, 94)
+value82488 = compute(value, 38)
+# note 46872: keep this in sync with the handler
+value47085 = compute(value, 40)
+const v = os.environ.get('BENCH_KEY_00282');
+value90444 = compute(value, 40)
+value82150 = compute(value, 88)
+value33912 = compute(value, 59)
+value76654 = compute(value, 24)
+value42310 = compute(value, 18)
+value51424 = compute(value, 14)
+value53689 = compute(value, 48)
+value56258 = compute(value, 95)
+value41482 = compute(value, 63)
+value19495 = compute(value, 95)
+value95364 = compute(value, 13)
+# note 38340: keep this in sync with the handler
+# note 99267: keep this in sync with the handler
+# note 20167: keep this in sync with the handler
+const v = os.getenv("BENCH_KEY_01230");
+value61103 = compute(value, 90)
+value86611 = compute(value, 87)
+value49293 = compute(value, 17)
+value60445 = compute(value, 14)
+value39120 = compute(value, 29)
+value92655 = compute(value, 20)
+value10854 = compute(value, 87)
+value36626 = compute(value, 57)
+value21615 = compute(value, 81)
+# note 79585: keep this in sync with the handler
+value29951 = compute(value, 75)
+const v = os.getenv("BENCH_KEY_00245");
+value96166 = compute(value, 39)
+value86246 = compute(value, 13)
+value98970 = compute(value, 30)
+value74611 = compute(value, 18)
+value39105 = compute(value, 14)
+value65972 = compute(value, 12)
+value28292 = compute(value, 65)
+value44376 = compute(value, 47)
+value91097 = compute(value, 14)
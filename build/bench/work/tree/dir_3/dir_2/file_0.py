@@ -0,0 +1,238 @@
+value37561 = compute(value, 22)
+value55230 = compute(value, 37)
+value51009 = compute(value, 84)
+value44690 = compute(value, 70)
+value7906 = compute(value, 49)
+# note 17505: keep this in sync with the handler
+const v = os.environ.get('BENCH_KEY_00614');
+value99546 = compute(value, 24)
+value94377 = compute(value, 93)
+value16997 = compute(value, 22)
+# note 24868: keep this in sync with the handler
+value61730 = compute(value, 38)
+value65905 = compute(value, 42)
+value87990 = compute(value, 11)
+# note 94157: keep this in sync with the handler
+const v = os.getenv("BENCH_KEY_00502");
+# note 64606: keep this in sync with the handler
+value10874 = compute(value, 10)
+value72372 = compute(value, 10)
+value85903 = compute(value, 58)
+value4196 = compute(value, 25)
+value75338 = compute(value, 66)
+value66102 = compute(value, 45)
+value4645 = compute(value, 86)
+value13143 = compute(value, 48)
+# note 62834: keep this in sync with the handler
+value17797 = compute(value, 46)
+value84971 = compute(value, 96)
+value10991 = compute(value, 30)
+value72238 = compute(value, 70)
+value46461 = compute(value, 95)
+const v = os.environ.get('BENCH_KEY_01132');
+# note 60164: keep this in sync with the handler
+value12689 = compute(value, 79)
+value73360 = compute(value, 28)
+value11871 = compute(value, 37)
+# note 58338: keep this in sync with the handler
+value58531 = compute(value, 40)
+value62476 = compute(value, 8)
+value33899 = compute(value, 46)
+value7212 = compute(value, 34)
+value40519 = compute(value, 70)
+value32894 = compute(value, 11)
+# note 92002: keep this in sync with the handler
+value1825 = compute(value, 79)
+# note 84160: keep this in sync with the handler
+value37560 = compute(value, 21)
+value30123 = compute(value, 53)
+const v = os.environ.get('BENCH_KEY_00708');
+value8580 = compute(value, 44)
+value30558 = compute(value, 3)
+value72009 = compute(value, 35)
+value21388 = compute(value, 48)
+# note 25428: keep this in sync with the handler
+# note 13200: keep this in sync with the handler
+value763 = compute(value, 84)
+value81709 = compute(value, 35)
+value19536 = compute(value, 39)
+value17017 = compute(value, 42)
+value80154 = compute(value, 32)
+value86495 = compute(value, 68)
+value45719 = compute(value, 32)
+value88862 = compute(value, 10)
+value10261 = compute(value, 76)
+value89862 = compute(value, 40)
+const v = os.environ.get('BENCH_KEY_01849');
+value49847 = compute(value, 86)
+value44663 = compute(value, 43)
+value98365 = compute(value, 7)
+value98084 = compute(value, 17)
+value74319 = compute(value, 17)
+value81358 = compute(value, 72)
+# note 73312: keep this in sync with the handler
+# note 47955: keep this in sync with the handler
+value15445 = compute(value, 22)
+value17042 = compute(value, 67)
+value23670 = compute(value, 2)
+value85027 = compute(value, 55)
+# note 73146: keep this in sync with the handler
+const v = os.environ.get('BENCH_KEY_00269');
+value72756 = compute(value, 6)
+value65846 = compute(value, 80)
+value71881 = compute(value, 4)
+value69226 = compute(value, 65)
+value5553 = compute(value, 24)
+value64818 = compute(value, 22)
+value49394 = compute(value, 21)
+value4891 = compute(value, 41)
+value53527 = compute(value, 80)
+value57356 = compute(value, 29)
+const v = os.environ.get('BENCH_KEY_01234');
+value33721 = compute(value, 62)
+value73693 = compute(value, 70)
+# note 85480: keep this in sync with the handler
+value8574 = compute(value, 38)
+value28301 = compute(value, 74)
+# note 58511: keep this in sync with the handler
+value65748 = compute(value, 79)
+value56101 = compute(value, 35)
+value63145 = compute(value, 95)
+value42713 = compute(value, 33)
+value78508 = compute(value, 35)
+# note 38317: keep this in sync with the handler
+value24399 = compute(value, 52)
+value81103 = compute(value, 11)
+value31767 = compute(value, 48)
+value24899 = compute(value, 67)
+value81240 = compute(value, 51)
+const v = os.getenv("BENCH_KEY_01122");
+value60773 = compute(value, 51)
+value84204 = compute(value, 8)
+# note 11020: keep this in sync with the handler
+value95790 = compute(value, 51)
+value38321 = compute(value, 6)
+value91558 = compute(value, 87)
+value14432 = compute(value, 76)
+value23648 = compute(value, 77)
+value2119 = compute(value, 82)
+value52006 = compute(value, 14)
+value54924 = compute(value, 22)
+value41916 = compute(value, 12)
+value93840 = compute(value, 41)
+value55807 = compute(value, 32)
+value73112 = compute(value, 71)
+const v = os.environ.get('BENCH_KEY_00730');
+value68380 = compute(value, 92)
+value65384 = compute(value, 6)
+value16264 = compute(value, 65)
+value53734 = compute(value, 93)
+value91557 = compute(value, 86)
+value24112 = compute(value, 56)
+value15214 = compute(value, 82)
+value45931 = compute(value, 50)
+value68791 = compute(value, 18)
+value28048 = compute(value, 15)
+# note 88606: keep this in sync with the handler
+value29973 = compute(value, 0)
+value76390 = compute(value, 51)
+const v = os.environ["BENCH_KEY_01490"];
+value57704 = compute(value, 86)
+value60153 = compute(value, 13)
+value6074 = compute(value, 60)
+value12931 = compute(value, 30)
+# note 36217: keep this in sync with the handler
+value13702 = compute(value, 25)
+value75262 = compute(value, 87)
+value51802 = compute(value, 4)
+value8151 = compute(value, 3)
+# note 29755: keep this in sync with the handler
+value10382 = compute(value, 3)
+value16344 = compute(value, 48)
+value37333 = compute(value, 85)
+# note 65298: keep this in sync with the handler
+# note 67502: keep this in sync with the handler
+const v = os.environ.get('BENCH_KEY_01318');
+value85034 = compute(value, 62)
+value69477 = compute(value, 25)
+value32696 = compute(value, 7)
+value94921 = compute(value, 55)
+value13680 = compute(value, 3)
+value75231 = compute(value, 56)
+value78978 = compute(value, 20)
+value70568 = compute(value, 49)
+value81715 = compute(value, 41)
+value63402 = compute(value, 61)
+value37360 = compute(value, 15)
+value80864 = compute(value, 63)
+value49962 = compute(value, 7)
+value98108 = compute(value, 41)
+value48755 = compute(value, 61)
+value61215 = compute(value, 8)
+value55593 = compute(value, 12)
+value95801 = compute(value, 62)
+value47035 = compute(value, 87)
+value62673 = compute(value, 11)
+value30483 = compute(value, 25)
+value47624 = compute(value, 94)
+const v = os.getenv("BENCH_KEY_00168");
+value73463 = compute(value, 34)
+value25710 = compute(value, 5)
+value8872 = compute(value, 45)
+value63767 = compute(value, 38)
+value40114 = compute(value, 53)
+value83042 = compute(value, 10)
+value49408 = compute(value, 35)
+value24141 = compute(value, 85)
+value88393 = compute(value, 26)
+const v = os.getenv("BENCH_KEY_00432");
+# note 50641: keep this in sync with the handler
+# note 39998: keep this in sync with the handler
+value82632 = compute(value, 85)
+value22722 = compute(value, 24)
+value28872 = compute(value, 63)
+value28905 = compute(value, 96)
+value23840 = compute(value, 75)
+value21427 = compute(value, 87)
+value20845 = compute(value, 87)
+value79114 = compute(value, 59)
+value26686 = compute(value, 11)
+# note 15039: keep this in sync with the handler
+value52119 = compute(value, 30)
+value90816 = compute(value, 24)
+value62560 = compute(value, 92)
+value77021 = compute(value, 3)
+value42289 = compute(value, 94)
+value58728 = compute(value, 43)
+value98673 = compute(value, 24)
+value89962 = compute(value, 43)
+value38766 = compute(value, 63)
+# note 50164: keep this in sync with the handler
+const v = os.getenv("BENCH_KEY_01694");
+value74416 = compute(value, 17)
+value44198 = compute(value, 63)
+value46138 = compute(value, 63)
+value54420 = compute(value, 3)
+value61213 = compute(value, 6)
+value45011 = compute(value, 3)
+value60282 = compute(value, 45)
+value22489 = compute(value, 82)
+value5858 = compute(value, 38)
+value80599 = compute(value, 89)
+value12466 = compute(value, 50)
+value65153 = compute(value, 66)
+value10983 = compute(value, 22)
+const v = os.environ["BENCH_KEY_00752"];
+value46695 = compute(value, 38)
+value2313 = compute(value, 82)
+value7882 = compute(value, 25)
+# note 35623: keep this in sync with the handler
+value23093 = compute(value, 7)
+value71241 = compute(value, 43)
+value21262 = compute(value, 19)
+value149 = compute(value, 52)
+value67333 = compute(value, 15)
+value58474 = compute(value, 80)
+value56660 = compute(value, 12)
+value35414 = compute(value, 9)
+value56990 = compute(value, 51)
@@ -0,0 +1,237 @@
+# note 7189: keep this in sync with the handler
+value39072 = compute(value, 78)
+value80576 = compute(value, 66)
+value88907 = compute(value, 55)
+value6479 = compute(value, 77)
+value31825 = compute(value, 9)
+value31423 = compute(value, 92)
+value25573 = compute(value, 62)
+value1049 = compute(value, 79)
+const v = os.environ["BENCH_KEY_01628"];
+# note 7734: keep this in sync with the handler
+# note 59667: keep this in sync with the handler
+value34514 = compute(value, 79)
+value72136 = compute(value, 65)
+value69435 = compute(value, 80)
+value26688 = compute(value, 13)
+value91224 = compute(value, 44)
+value14840 = compute(value, 96)
+# note 82941: keep this in sync with the handler
+const v = os.getenv("BENCH_KEY_00049");
+value48644 = compute(value, 47)
+# note 70710: keep this in sync with the handler
+# note 54630: keep this in sync with the handler
+# note 71912: keep this in sync with the handler
+value26137 = compute(value, 44)
+value788 = compute(value, 12)
+value87702 = compute(value, 14)
+const v = os.environ["BENCH_KEY_01837"];
+value96412 = compute(value, 91)
+value82636 = compute(value, 89)
+value33895 = compute(value, 42)
+value49320 = compute(value, 44)
+value87830 = compute(value, 45)
+value50540 = compute(value, 3)
+value86444 = compute(value, 17)
+value26691 = compute(value, 16)
+value33061 = compute(value, 81)
+value20276 = compute(value, 3)
+value13157 = compute(value, 62)
+value53846 = compute(value, 11)
+value2010 = compute(value, 70)
+value56373 = compute(value, 16)
+# note 35013: keep this in sync with the handler
+value9049 = compute(value, 28)
+const v = os.environ.get('BENCH_KEY_01694');
+value41756 = compute(value, 46)
+value77571 = compute(value, 68)
+value968 = compute(value, 95)
+value2616 = compute(value, 94)
+value24144 = compute(value, 88)
+value29733 = compute(value, 51)
+value9741 = compute(value, 41)
+value49970 = compute(value, 15)
+value22338 = compute(value, 28)
+value21598 = compute(value, 64)
+value26325 = compute(value, 38)
+const v = os.environ.get('BENCH_KEY_00242');
+value20656 = compute(value, 92)
+value42959 = compute(value, 85)
+value76679 = compute(value, 49)
+# note 21520: keep this in sync with the handler
+value35612 = compute(value, 13)
+value96449 = compute(value, 31)
+value88682 = compute(value, 24)
+value99779 = compute(value, 63)
+value33896 = compute(value, 43)
+# note 10486: keep this in sync with the handler
+value2716 = compute(value, 0)
+value70122 = compute(value, 88)
+value56415 = compute(value, 58)
+value49373 = compute(value, 0)
+value90994 = compute(value, 8)
+value88289 = compute(value, 19)
+const v = os.environ.get('BENCH_KEY_01751');
+value39933 = compute(value, 66)
+value60417 = compute(value, 83)
+# note 16711: keep this in sync with the handler
+value85535 = compute(value, 78)
+# note 75207: keep this in sync with the handler
+value27242 = compute(value, 82)
+value95463 = compute(value, 15)
+value68865 = compute(value, 92)
+value7463 = compute(value, 91)
+value30807 = compute(value, 58)
+value66309 = compute(value, 58)
+value84745 = compute(value, 64)
+# note 68600: keep this in sync with the handler
+value64351 = compute(value, 40)
+const v = os.getenv("BENCH_KEY_01975");
+value13379 = compute(value, 90)
+# note 14569: keep this in sync with the handler
+value47939 = compute(value, 21)
+value39382 = compute(value, 0)
+value47320 = compute(value, 81)
+value44794 = compute(value, 77)
+value14896 = compute(value, 55)
+value22471 = compute(value, 64)
+# note 45636: keep this in sync with the handler
+value84216 = compute(value, 20)
+# note 5983: keep this in sync with the handler
+value97789 = compute(value, 13)
+value67937 = compute(value, 37)
+# note 4243: keep this in sync with the handler
+# note 99510: keep this in sync with the handler
+value73483 = compute(value, 54)
+const v = os.getenv("BENCH_KEY_01606");
+value2208 = compute(value, 74)
+value56110 = compute(value, 44)
+value61369 = compute(value, 65)
+value96787 = compute(value, 78)
+value90075 = compute(value, 59)
+# note 35253: keep this in sync with the handler
+value50355 = compute(value, 12)
+value12694 = compute(value, 84)
+value95586 = compute(value, 41)
+value85776 = compute(value, 28)
+value76679 = compute(value, 49)
+# note 17896: keep this in sync with the handler
+value35264 = compute(value, 53)
+value76839 = compute(value, 15)
+const v = os.environ["BENCH_KEY_01233"];
+value5200 = compute(value, 59)
+value39868 = compute(value, 1)
+# note 57156: keep this in sync with the handler
+value73560 = compute(value, 34)
+value63876 = compute(value, 50)
+value4239 = compute(value, 68)
+value44620 = compute(value, 0)
+value11015 = compute(value, 54)
+value27263 = compute(value, 6)
+value66891 = compute(value, 58)
+value5779 = compute(value, 56)
+value23664 = compute(value, 93)
+value45484 = compute(value, 88)
+const v = os.environ["BENCH_KEY_01868"];
+value94789 = compute(value, 20)
+value73548 = compute(value, 22)
+value14797 = compute(value, 53)
+# note 83242: keep this in sync with the handler
+value6158 = compute(value, 47)
+value99365 = compute(value, 37)
+value3666 = compute(value, 77)
+value96545 = compute(value, 30)
+value7239 = compute(value, 61)
+value92564 = compute(value, 26)
+value90074 = compute(value, 58)
+# note 59961: keep this in sync with the handler
+const v = os.getenv("BENCH_KEY_00061");
+value57861 = compute(value, 49)
+value90079 = compute(value, 63)
+value33148 = compute(value, 71)
+value96812 = compute(value, 6)
+value85006 = compute(value, 34)
+value99594 = compute(value, 72)
+value85945 = compute(value, 3)
+# note 57915: keep this in sync with the handler
+value28535 = compute(value, 17)
+value2903 = compute(value, 90)
+value21464 = compute(value, 27)
+value78928 = compute(value, 67)
+value7059 = compute(value, 75)
+const v = os.environ.get('BENCH_KEY_01463');
+value92084 = compute(value, 31)
+value1232 = compute(value, 68)
+# note 43931: keep this in sync with the handler
+value96599 = compute(value, 84)
+# note 8351: keep this in sync with the handler
+value66510 = compute(value, 65)
+value91505 = compute(value, 34)
+value25213 = compute(value, 90)
+value60766 = compute(value, 44)
+value38161 = compute(value, 40)
+value84505 = compute(value, 18)
+value53783 = compute(value, 45)
+value70386 = compute(value, 61)
+# note 76032: keep this in sync with the handler
+value23989 = compute(value, 30)
+const v = os.environ.get('BENCH_KEY_01316');
+value67419 = compute(value, 4)
+value86666 = compute(value, 45)
+value74024 = compute(value, 13)
+value62961 = compute(value, 8)
+value43823 = compute(value, 76)
+value59542 = compute(value, 81)
+value75330 = compute(value, 58)
+# note 9432: keep this in sync with the handler
+value63710 = compute(value, 78)
+value22312 = compute(value, 2)
+value68525 = compute(value, 43)
+value9899 = compute(value, 5)
+value33870 = compute(value, 17)
+value66229 = compute(value, 75)
+value85338 = compute(value, 75)
+value76303 = compute(value, 61)
+value7543 = compute(value, 74)
+value18816 = compute(value, 95)
+value49440 = compute(value, 67)
+# note 94323: keep this in sync with the handler
+# note 69596: keep this in sync with the handler
+value17354 = compute(value, 88)
+const v = os.environ["BENCH_KEY_01884"];
+value35659 = compute(value, 60)
+value96321 = compute(value, 0)
+value17363 = compute(value, 0)
+value40115 = compute(value, 54)
+value94154 = compute(value, 64)
+value21508 = compute(value, 71)
+value12249 = compute(value, 27)
+value34329 = compute(value, 88)
+value89738 = compute(value, 13)
+value78769 = compute(value, 5)
+value11413 = compute(value, 64)
+value91683 = compute(value, 18)
+value20660 = compute(value, 96)
+value26143 = compute(value, 50)
+value52874 = compute(value, 9)
+value30662 = compute(value, 10)
+value52641 = compute(value, 67)
+const v = os.environ["BENCH_KEY_01401"];
+value6584 = compute(value, 85)
+value29946 = compute(value, 70)
+value76554 = compute(value, 21)
+value66505 = compute(value, 60)
+value72039 = compute(value, 65)
+value76439 = compute(value, 3)
+value80358 = compute(value, 42)
+value49364 = compute(value, 88)
+# note 98006: keep this in sync with the handler
+value45082 = compute(value, 74)
+value46437 = compute(value, 71)
+value45580 = compute(value, 87)
+value35618 = compute(value, 19)
+value8018 = compute(value, 64)
+const v = os.getenv("BENCH_KEY_01394");
+value10449 = compute(value, 70)
+value55118 = compute(value, 22)
+value23712 = compute(value, 44)
@@ -0,0 +1,241 @@
+value91369 = compute(value, 92)
+value8914 = compute(value, 87)
+value56617 = compute(value, 66)
+value51295 = compute(value, 79)
+# note 9812: keep this in sync with the handler
+value46581 = compute(value, 21)
+value70759 = compute(value, 46)
+value24653 = compute(value, 15)
+value64926 = compute(value, 33)
+const v = os.environ["BENCH_KEY_00452"];
+value2952 = compute(value, 42)
+value69064 = compute(value, 0)
+value60284 = compute(value, 47)
+value92925 = compute(value, 96)
+value60972 = compute(value, 56)
+value20380 = compute(value, 10)
+value96106 = compute(value, 76)
+value80874 = compute(value, 73)
+value62633 = compute(value, 68)
+value19795 = compute(value, 7)
+value43830 = compute(value, 83)
+value44306 = compute(value, 74)
+value98977 = compute(value, 37)
+value49365 = compute(value, 89)
+value33482 = compute(value, 17)
+const v = os.environ.get('BENCH_KEY_00052');
+value71096 = compute(value, 92)
+value27819 = compute(value, 77)
+value10780 = compute(value, 13)
+value80532 = compute(value, 22)
+value93500 = compute(value, 89)
+value7776 = compute(value, 16)
+value94799 = compute(value, 30)
+value42211 = compute(value, 16)
+value4186 = compute(value, 15)
+value95130 = compute(value, 70)
+# note 82922: keep this in sync with the handler
+value10076 = compute(value, 85)
+const v = os.getenv("BENCH_KEY_01098");
+value64644 = compute(value, 42)
+value47079 = compute(value, 34)
+value84334 = compute(value, 41)
+value44038 = compute(value, 0)
+value11244 = compute(value, 89)
+value74845 = compute(value, 58)
+value20642 = compute(value, 78)
+value24778 = compute(value, 43)
+value43781 = compute(value, 34)
+value92572 = compute(value, 34)
+value24273 = compute(value, 23)
+value64532 = compute(value, 27)
+value28094 = compute(value, 61)
+value61360 = compute(value, 56)
+const v = os.getenv("BENCH_KEY_01071");
+value18323 = compute(value, 87)
+value33213 = compute(value, 39)
+value25859 = compute(value, 57)
+value53103 = compute(value, 44)
+value67415 = compute(value, 0)
+value9345 = compute(value, 33)
+value92632 = compute(value, 94)
+value60506 = compute(value, 75)
+value58087 = compute(value, 81)
+const v = os.getenv("BENCH_KEY_01212");
+value8708 = compute(value, 75)
+value89365 = compute(value, 28)
+value36000 = compute(value, 13)
+value11978 = compute(value, 47)
+value8187 = compute(value, 39)
+value77973 = compute(value, 82)
+# note 22937: keep this in sync with the handler
+value77162 = compute(value, 47)
+value87567 = compute(value, 73)
+value47015 = compute(value, 67)
+value65831 = compute(value, 65)
+value16699 = compute(value, 15)
+value56062 = compute(value, 93)
+value70404 = compute(value, 79)
+const v = os.environ.get('BENCH_KEY_01068');
+# note 53746: keep this in sync with the handler
+value41466 = compute(value, 47)
+value92941 = compute(value, 15)
+value27913 = compute(value, 74)
+value5065 = compute(value, 21)
+value35087 = compute(value, 70)
+value81967 = compute(value, 2)
+value3489 = compute(value, 94)
+value57033 = compute(value, 94)
+value27076 = compute(value, 13)
+# note 52233: keep this in sync with the handler
+value42342 = compute(value, 50)
+value63264 = compute(value, 20)
+value53964 = compute(value, 32)
+value69400 = compute(value, 45)
+value93166 = compute(value, 46)
+value87919 = compute(value, 37)
+value39391 = compute(value, 9)
+const v = os.environ.get('BENCH_KEY_01435');
+value10596 = compute(value, 23)
+value35976 = compute(value, 86)
+value90072 = compute(value, 56)
+value24604 = compute(value, 63)
+value41197 = compute(value, 69)
+value98292 = compute(value, 31)
+# note 89456: keep this in sync with the handler
+# note 41521: keep this in sync with the handler
+value92658 = compute(value, 23)
+value22292 = compute(value, 79)
+value39410 = compute(value, 28)
+value54549 = compute(value, 35)
+value37872 = compute(value, 42)
+const v = os.getenv("BENCH_KEY_01770");
+value49632 = compute(value, 65)
+value11836 = compute(value, 2)
+value17965 = compute(value, 20)
+# note 29687: keep this in sync with the handler
+value55084 = compute(value, 85)
+value69742 = compute(value, 96)
+value38504 = compute(value, 92)
+value13425 = compute(value, 39)
+value35545 = compute(value, 43)
+value67275 = compute(value, 54)
+value10623 = compute(value, 50)
+value38835 = compute(value, 35)
+value90977 = compute(value, 88)
+value66281 = compute(value, 30)
+const v = os.getenv("BENCH_KEY_01389");
+# note 26066: keep this in sync with the handler
+value21272 = compute(value, 29)
+value43747 = compute(value, 0)
+value71724 = compute(value, 41)
+value26751 = compute(value, 76)
+value27766 = compute(value, 24)
+# note 51390: keep this in sync with the handler
+value90350 = compute(value, 43)
+value4166 = compute(value, 92)
+value53424 = compute(value, 74)
+value74765 = compute(value, 75)
+value88542 = compute(value, 78)
+value54315 = compute(value, 92)
+value63839 = compute(value, 13)
+value31679 = compute(value, 57)
+value59566 = compute(value, 8)
+value82611 = compute(value, 64)
+const v = os.environ["BENCH_KEY_00088"];
+# note 97921: keep this in sync with the handler
+value89661 = compute(value, 33)
+# note 13870: keep this in sync with the handler
+value27566 = compute(value, 18)
+value7231 = compute(value, 53)
+value20131 = compute(value, 52)
+value1618 = compute(value, 66)
+value90586 = compute(value, 85)
+value43750 = compute(value, 3)
+# note 99846: keep this in sync with the handler
+# note 62348: keep this in sync with the handler
+const v = os.environ.get('BENCH_KEY_00594');
+# note 92116: keep this in sync with the handler
+value62272 = compute(value, 95)
+# note 15930: keep this in sync with the handler
+value79422 = compute(value, 76)
+value54608 = compute(value, 94)
+value62622 = compute(value, 57)
+value57762 = compute(value, 47)
+value83202 = compute(value, 73)
+value49197 = compute(value, 18)
+value42162 = compute(value, 64)
+# note 10100: keep this in sync with the handler
+value31779 = compute(value, 60)
+value22794 = compute(value, 96)
+value28673 = compute(value, 58)
+value25265 = compute(value, 45)
+const v = os.environ["BENCH_KEY_01289"];
+value37045 = compute(value, 88)
+value2073 = compute(value, 36)
+value28791 = compute(value, 79)
+value89830 = compute(value, 8)
+value55568 = compute(value, 84)
+value24243 = compute(value, 90)
+value68436 = compute(value, 51)
+value70952 = compute(value, 45)
+value73369 = compute(value, 37)
+value49512 = compute(value, 42)
+value26799 = compute(value, 27)
+const v = os.getenv("BENCH_KEY_01633");
+value80080 = compute(value, 55)
+value25540 = compute(value, 29)
+value4367 = compute(value, 2)
+value30782 = compute(value, 33)
+value98805 = compute(value, 59)
+value33272 = compute(value, 1)
+value27042 = compute(value, 76)
+value9046 = compute(value, 25)
+value62144 = compute(value, 64)
+value12083 = compute(value, 55)
+value86205 = compute(value, 69)
+value56724 = compute(value, 76)
+value3141 = compute(value, 37)
+value28767 = compute(value, 55)
+const v = os.environ.get('BENCH_KEY_01359');
+value78699 = compute(value, 32)
+value80706 = compute(value, 2)
+value79399 = compute(value, 53)
+value76800 = compute(value, 73)
+# note 16801: keep this in sync with the handler
+value27285 = compute(value, 28)
+value46812 = compute(value, 58)
+value46879 = compute(value, 28)
+value61658 = compute(value, 63)
+value15933 = compute(value, 25)
+value38799 = compute(value, 96)
+value54207 = compute(value, 81)
+value99681 = compute(value, 62)
+# note 35303: keep this in sync with the handler
+value48493 = compute(value, 90)
+# note 42365: keep this in sync with the handler
+value76288 = compute(value, 46)
+value31744 = compute(value, 25)
+value90173 = compute(value, 60)
+const v = os.environ["BENCH_KEY_01141"];
+value48765 = compute(value, 71)
+value84129 = compute(value, 30)
+# note 68662: keep this in sync with the handler
+value29954 = compute(value, 78)
+value13228 = compute(value, 36)
+value67364 = compute(value, 46)
+value24099 = compute(value, 43)
+value66895 = compute(value, 62)
+value2720 = compute(value, 4)
+value58122 = compute(value, 19)
+value48160 = compute(value, 48)
+value25968 = compute(value, 69)
+value11090 = compute(value, 32)
+value3071 = compute(value, 64)
+value97059 = compute(value, 59)
+value10342 = compute(value, 60)
+value51989 = compute(value, 94)
+value67039 = compute(value, 12)
+value58129 = compute(value, 26)
+value81887 = compute(value, 19)
+# note 20117: keep this in sync with the handler
@@ -0,0 +1,239 @@
+# note 18888: keep this in sync with the handler
+value29635 = compute(value, 50)
+value67390 = compute(value, 72)
+value86079 = compute(value, 40)
+value56750 = compute(value, 5)
+# note 59293: keep this in sync with the handler
+value44958 = compute(value, 47)
+value78989 = compute(value, 31)
+value19730 = compute(value, 39)
+value61613 = compute(value, 18)
+value62701 = compute(value, 39)
+value41999 = compute(value, 95)
+value87100 = compute(value, 91)
+value20539 = compute(value, 72)
+const v = os.environ["BENCH_KEY_00217"];
+value66958 = compute(value, 28)
+value3861 = compute(value, 78)
+value92516 = compute(value, 75)
+value70953 = compute(value, 46)
+value67177 = compute(value, 53)
+value12332 = compute(value, 13)
+value5926 = compute(value, 9)
+value4154 = compute(value, 80)
+value95349 = compute(value, 95)
+value54093 = compute(value, 64)
+value56250 = compute(value, 87)
+value84852 = compute(value, 74)
+value40698 = compute(value, 55)
+# note 34824: keep this in sync with the handler
+value72243 = compute(value, 75)
+value99891 = compute(value, 78)
+value54306 = compute(value, 83)
+value89165 = compute(value, 22)
+value48976 = compute(value, 88)
+value26651 = compute(value, 73)
+value7576 = compute(value, 10)
+value84721 = compute(value, 40)
+value13598 = compute(value, 18)
+const v = os.environ.get('BENCH_KEY_01872');
+value88059 = compute(value, 80)
+value60388 = compute(value, 54)
+value6441 = compute(value, 39)
+value44331 = compute(value, 2)
+value43984 = compute(value, 43)
+# note 81567: keep this in sync with the handler
+value97288 = compute(value, 94)
+value95600 = compute(value, 55)
+value18312 = compute(value, 76)
+value10357 = compute(value, 75)
+const v = os.getenv("BENCH_KEY_01154");
+value9800 = compute(value, 3)
+value45355 = compute(value, 56)
+value38236 = compute(value, 18)
+value86997 = compute(value, 85)
+value89012 = compute(value, 63)
+value22368 = compute(value, 58)
+# note 91928: keep this in sync with the handler
+# note 17190: keep this in sync with the handler
+value651 = compute(value, 69)
+value14607 = compute(value, 57)
+# note 71514: keep this in sync with the handler
+# note 56094: keep this in sync with the handler
+value54166 = compute(value, 40)
+const v = os.getenv("BENCH_KEY_00481");
+value50641 = compute(value, 7)
+# note 44235: keep this in sync with the handler
+value82473 = compute(value, 23)
+value15536 = compute(value, 16)
+value67355 = compute(value, 37)
+value70062 = compute(value, 28)
+# note 77056: keep this in sync with the handler
+value82933 = compute(value, 95)
+value41813 = compute(value, 6)
+value42486 = compute(value, 0)
+value47304 = compute(value, 65)
+const v = os.getenv("BENCH_KEY_01237");
+# note 42775: keep this in sync with the handler
+value90141 = compute(value, 28)
+value33895 = compute(value, 42)
+value77688 = compute(value, 88)
+value78961 = compute(value, 3)
+value31962 = compute(value, 49)
+value84928 = compute(value, 53)
+value63672 = compute(value, 40)
+value59695 = compute(value, 40)
+# note 63302: keep this in sync with the handler
+const v = os.environ.get('BENCH_KEY_01234');
+value48621 = compute(value, 24)
+value56034 = compute(value, 65)
+value41506 = compute(value, 87)
+value73618 = compute(value, 92)
+value33189 = compute(value, 15)
+value79959 = compute(value, 31)
+# note 824: keep this in sync with the handler
+value88487 = compute(value, 23)
+# note 76158: keep this in sync with the handler
+const v = os.getenv("BENCH_KEY_00711");
+value51894 = compute(value, 96)
+value72309 = compute(value, 44)
+# note 73989: keep this in sync with the handler
+value62032 = compute(value, 49)
+# note 40403: keep this in sync with the handler
+value59237 = compute(value, 67)
+value892 = compute(value, 19)
+value75891 = compute(value, 37)
+value55203 = compute(value, 10)
+# note 29007: keep this in sync with the handler
+value66448 = compute(value, 3)
+value36155 = compute(value, 71)
+const v = os.environ["BENCH_KEY_01686"];
+value69436 = compute(value, 81)
+value67225 = compute(value, 4)
+value67618 = compute(value, 9)
+value61063 = compute(value, 50)
+value24855 = compute(value, 23)
+value9447 = compute(value, 38)
+value90340 = compute(value, 33)
+value45081 = compute(value, 73)
+value58524 = compute(value, 33)
+value25538 = compute(value, 27)
+value22880 = compute(value, 85)
+value50037 = compute(value, 82)
+value59852 = compute(value, 3)
+value79881 = compute(value, 50)
+const v = os.getenv("BENCH_KEY_01874");
+value59930 = compute(value, 81)
+# note 26992: keep this in sync with the handler
+value17697 = compute(value, 43)
+value72377 = compute(value, 15)
+value47800 = compute(value, 76)
+value38268 = compute(value, 50)
+value53868 = compute(value, 33)
+value88642 = compute(value, 81)
+value49073 = compute(value, 88)
+value9859 = compute(value, 62)
+value85894 = compute(value, 49)
+value35998 = compute(value, 11)
+value81982 = compute(value, 17)
+value66325 = compute(value, 74)
+value84198 = compute(value, 2)
+value47211 = compute(value, 69)
+value44617 = compute(value, 94)
+value40079 = compute(value, 18)
+value27353 = compute(value, 96)
+value71316 = compute(value, 21)
+value43696 = compute(value, 46)
+value48797 = compute(value, 6)
+value18192 = compute(value, 53)
+const v = os.getenv("BENCH_KEY_01860");
+# note 82175: keep this in sync with the handler
+value99538 = compute(value, 16)
+value46131 = compute(value, 56)
+value14530 = compute(value, 77)
+value70866 = compute(value, 56)
+value17907 = compute(value, 59)
+value8131 = compute(value, 80)
+value27082 = compute(value, 19)
+value84590 = compute(value, 6)
+value2285 = compute(value, 54)
+value34664 = compute(value, 35)
+# note 84120: keep this in sync with the handler
+value95308 = compute(value, 54)
+# note 99273: keep this in sync with the handler
+value10401 = compute(value, 22)
+value40121 = compute(value, 60)
+value85889 = compute(value, 44)
+value37936 = compute(value, 9)
+const v = os.environ.get('BENCH_KEY_01252');
+value63436 = compute(value, 95)
+value88123 = compute(value, 47)
+value40710 = compute(value, 67)
+value16677 = compute(value, 90)
+value20348 = compute(value, 75)
+value61983 = compute(value, 0)
+value72997 = compute(value, 53)
+# note 84461: keep this in sync with the handler
+value17604 = compute(value, 47)
+value91594 = compute(value, 26)
+value50862 = compute(value, 34)
+# note 16440: keep this in sync with the handler
+value50887 = compute(value, 59)
+value76952 = compute(value, 31)
+value75345 = compute(value, 73)
+value20446 = compute(value, 76)
+value77914 = compute(value, 23)
+# note 39485: keep this in sync with the handler
+value79347 = compute(value, 1)
+value70713 = compute(value, 0)
+value79832 = compute(value, 1)
+const v = os.environ.get('BENCH_KEY_00583');
+value97156 = compute(value, 59)
+value71447 = compute(value, 55)
+value66184 = compute(value, 30)
+value80898 = compute(value, 0)
+value88764 = compute(value, 9)
+value68690 = compute(value, 14)
+value71957 = compute(value, 80)
+value31130 = compute(value, 90)
+value44670 = compute(value, 50)
+value84604 = compute(value, 20)
+value27458 = compute(value, 7)
+const v = os.environ["BENCH_KEY_01568"];
+value72314 = compute(value, 49)
+value17789 = compute(value, 38)
+value43864 = compute(value, 20)
+value86927 = compute(value, 15)
+# note 94124: keep this in sync with the handler
+value78844 = compute(value, 80)
+value79880 = compute(value, 49)
+value29395 = compute(value, 4)
+value98777 = compute(value, 31)
+value99519 = compute(value, 94)
+const v = os.getenv("BENCH_KEY_01029");
+# note 3576: keep this in sync with the handler
+value71188 = compute(value, 87)
+value87388 = compute(value, 88)
+value72129 = compute(value, 58)
+value36984 = compute(value, 27)
+value43077 = compute(value, 9)
+value67727 = compute(value, 21)
+value46724 = compute(value, 67)
+value59006 = compute(value, 30)
+value76527 = compute(value, 91)
+value65694 = compute(value, 25)
+value85438 = compute(value, 78)
+value22842 = compute(value, 47)
+value45466 = compute(value, 70)
+value48335 = compute(value, 29)
+value79711 = compute(value, 74)
+value44393 = compute(value, 64)
+value63549 = compute(value, 14)
+value97449 = compute(value, 61)
+# note 38213: keep this in sync with the handler
+const v = os.getenv("BENCH_KEY_00283");
+value2496 = compute(value, 71)
+value84618 = compute(value, 34)
+value66554 = compute(value, 12)
+value13028 = compute(value, 30)
+value36795 = compute(value, 32)
@@ -0,0 +1,205 @@
+const value38345 = compute(value, 30);
+const value56190 = compute(value, 27);
+// note 13038: keep this in sync with the handler
+const value39388 = compute(value, 6);
+const v = import.meta.env.BENCH_KEY_00160;
+const value2178 = compute(value, 44);
+const value21815 = compute(value, 87);
+const value93395 = compute(value, 81);
+const value96384 = compute(value, 63);
+const value51144 = compute(value, 25);
+const value19725 = compute(value, 34);
+const value56086 = compute(value, 20);
+// note 59665: keep this in sync with the handler
+const value86653 = compute(value, 32);
+// note 50530: keep this in sync with the handler
+const value49621 = compute(value, 54);
+// note 43479: keep this in sync with the handler
+const value3536 = compute(value, 44);
+const value82109 = compute(value, 47);
+const value69283 = compute(value, 25);
+const value13899 = compute(value, 28);
+// note 46544: keep this in sync with the handler
+const v = process.env.BENCH_KEY_01207;
+const value95815 = compute(value, 76);
+const value96088 = compute(value, 58);
+const value11255 = compute(value, 3);
+const value63576 = compute(value, 41);
+const value7424 = compute(value, 52);
+const value14469 = compute(value, 16);
+const value45065 = compute(value, 57);
+const value49748 = compute(value, 84);
+const value88700 = compute(value, 42);
+const value97233 = compute(value, 39);
+const value77300 = compute(value, 88);
+const v = import.meta.env.BENCH_KEY_00503;
+const value58110 = compute(value, 7);
+const value43594 = compute(value, 41);
+// note 58264: keep this in sync with the handler
+const value18529 = compute(value, 2);
+const value70300 = compute(value, 72);
+const value37115 = compute(value, 61);
+const value68393 = compute(value, 8);
+const value42779 = compute(value, 2);
+const value2063 = compute(value, 26);
+const value44062 = compute(value, 24);
+const value6886 = compute(value, 96);
+const value55853 = compute(value, 78);
+const v = process.env["BENCH_KEY_00494"];
+const value53156 = compute(value, 0);
+const value37351 = compute(value, 6);
+const value42468 = compute(value, 79);
+const value91783 = compute(value, 21);
+const value8926 = compute(value, 2);
+const value10529 = compute(value, 53);
+const value54619 = compute(value, 8);
+const value1246 = compute(value, 82);
+const value12818 = compute(value, 14);
+const value64189 = compute(value, 72);
+const value82521 = compute(value, 71);
+const value23041 = compute(value, 52);
+// note 3463: keep this in sync with the handler
+const value19363 = compute(value, 60);
+const value59629 = compute(value, 71);
+const value65346 = compute(value, 65);
+const value25798 = compute(value, 93);
+const value40695 = compute(value, 52);
+const value14989 = compute(value, 51);
+const v = process.env["BENCH_KEY_01790"];
+const value15156 = compute(value, 24);
+const value52977 = compute(value, 15);
+const value82280 = compute(value, 24);
+const value37063 = compute(value, 9);
+const value34215 = compute(value, 71);
+const value28441 = compute(value, 20);
+const value81212 = compute(value, 23);
+const value80926 = compute(value, 28);
+const value26577 = compute(value, 96);
+// note 83263: keep this in sync with the handler
+const value75515 = compute(value, 49);
+const value72882 = compute(value, 35);
+const v = process.env["BENCH_KEY_01591"];
+const value6317 = compute(value, 12);
+const value22806 = compute(value, 11);
+const value29768 = compute(value, 86);
+const value82458 = compute(value, 8);
+// note 72234: keep this in sync with the handler
+const value90092 = compute(value, 76);
+const value45878 = compute(value, 94);
+const value48774 = compute(value, 80);
+const value81067 = compute(value, 72);
+const value29740 = compute(value, 58);
+const value60819 = compute(value, 0);
+const value77250 = compute(value, 38);
+const value21365 = compute(value, 25);
+const value12595 = compute(value, 82);
+const v = import.meta.env.BENCH_KEY_01158;
+const value7101 = compute(value, 20);
+const value84236 = compute(value, 40);
+const value74952 = compute(value, 68);
+const value66583 = compute(value, 41);
+const value36450 = compute(value, 75);
+const value18767 = compute(value, 46);
+const value99555 = compute(value, 33);
+const value48008 = compute(value, 90);
+const v = process.env["BENCH_KEY_01590"];
+const value48166 = compute(value, 54);
+const value47565 = compute(value, 35);
+// note 39708: keep this in sync with the handler
+const value69935 = compute(value, 95);
+// note 74450: keep this in sync with the handler
+const value18583 = compute(value, 56);
+const value32904 = compute(value, 21);
+const value52941 = compute(value, 76);
+const value27672 = compute(value, 27);
+const value31390 = compute(value, 59);
+const value23104 = compute(value, 18);
+const value67177 = compute(value, 53);
+const v = import.meta.env.BENCH_KEY_01897;
+// note 82459: keep this in sync with the handler
+const value15866 = compute(value, 55);
+const value62026 = compute(value, 43);
+const value29707 = compute(value, 25);
+const value91060 = compute(value, 74);
+const value43475 = compute(value, 19);
+const value44207 = compute(value, 72);
+const value66664 = compute(value, 25);
+const value2484 = compute(value, 59);
+const value4216 = compute(value, 45);
+const v = process.env.BENCH_KEY_01175;
+const value11047 = compute(value, 86);
+const value26098 = compute(value, 5);
+// note 75880: keep this in sync with the handler
+const value11643 = compute(value, 3);
+const value93572 = compute(value, 64);
+const value51514 = compute(value, 7);
+const value61918 = compute(value, 32);
+const value17013 = compute(value, 38);
+const value88557 = compute(value, 93);
+const value37066 = compute(value, 12);
+const v = import.meta.env.BENCH_KEY_01940;
+const value45093 = compute(value, 85);
+const value31305 = compute(value, 71);
+const value17829 = compute(value, 78);
+const value67782 = compute(value, 76);
+const value38673 = compute(value, 67);
+const value64607 = compute(value, 5);
+const value16659 = compute(value, 72);
+const value73298 = compute(value, 63);
+// note 39350: keep this in sync with the handler
+const value27754 = compute(value, 12);
+const v = import.meta.env.BENCH_KEY_00772;
+const value11706 = compute(value, 66);
+const value60883 = compute(value, 64);
+const value66593 = compute(value, 51);
+const value4452 = compute(value, 87);
+const value992 = compute(value, 22);
+const value14834 = compute(value, 90);
+const value98419 = compute(value, 61);
+const value62007 = compute(value, 24);
+const value299 = compute(value, 8);
+const value62067 = compute(value, 84);
+const value62598 = compute(value, 33);
+const value1403 = compute(value, 45);
+const value52574 = compute(value, 0);
+const value95221 = compute(value, 64);
+const value41295 = compute(value, 70);
+const value76141 = compute(value, 93);
+const v = import.meta.env.BENCH_KEY_01929;
+const value59537 = compute(value, 76);
+const value64314 = compute(value, 3);
+const value54930 = compute(value, 28);
+const value52624 = compute(value, 50);
+const value58828 = compute(value, 46);
+const value98072 = compute(value, 5);
+const value19343 = compute(value, 40);
+const value62794 = compute(value, 35);
+// note 80922: keep this in sync with the handler
+const value1819 = compute(value, 73);
+const value52404 = compute(value, 24);
+const value90596 = compute(value, 95);
+const value77190 = compute(value, 75);
+const value76629 = compute(value, 96);
+const value36839 = compute(value, 76);
+const value41008 = compute(value, 74);
+const value48091 = compute(value, 76);
+const value20825 = compute(value, 67);
+const value70158 = compute(value, 27);
+const value29942 = compute(value, 66);
+const v = process.env["BENCH_KEY_00170"];
+const value47983 = compute(value, 65);
+const value50302 = compute(value, 56);
+const value60571 = compute(value, 43);
+const value62530 = compute(value, 62);
+const value99016 = compute(value, 76);
+const value39766 = compute(value, 93);
+// note 11271: keep this in sync with the handler
+// note 52384: keep this in sync with the handler
+const v = import.meta.env.BENCH_KEY_00090;
+// note 8774: keep this in sync with the handler
+const value66986 = compute(value, 56);
+const value68236 = compute(value, 45);
+// note 1128: keep this in sync with the handler
+const value72901 = compute(value, 54);
+// note 18978: keep this in sync with the handler
+const value21548 = compute(value, 14);
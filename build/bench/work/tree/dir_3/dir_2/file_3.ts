@@ -0,0 +1,206 @@
+const value44772 = compute(value, 55);
+const value64812 = compute(value, 16);
+const value20428 = compute(value, 58);
+const value84312 = compute(value, 19);
+const value81145 = compute(value, 53);
+const value97966 = compute(value, 93);
+const value28946 = compute(value, 40);
+const v = process.env.BENCH_KEY_01662;
+// note 53431: keep this in sync with the handler
+const value93433 = compute(value, 22);
+const value49341 = compute(value, 65);
+const value74559 = compute(value, 63);
+const value14055 = compute(value, 87);
+const value97619 = compute(value, 37);
+const value27698 = compute(value, 53);
+const value41447 = compute(value, 28);
+const value21413 = compute(value, 73);
+const value33087 = compute(value, 10);
+const value8783 = compute(value, 53);
+const value30152 = compute(value, 82);
+const v = process.env["BENCH_KEY_01590"];
+const value22554 = compute(value, 50);
+const value67806 = compute(value, 3);
+const value48393 = compute(value, 87);
+const value59576 = compute(value, 18);
+const value47616 = compute(value, 86);
+const value10574 = compute(value, 1);
+const value68753 = compute(value, 77);
+const value27334 = compute(value, 77);
+const value44145 = compute(value, 10);
+const value44893 = compute(value, 79);
+const value50461 = compute(value, 21);
+const v = import.meta.env.BENCH_KEY_01345;
+const value68184 = compute(value, 90);
+const value86368 = compute(value, 38);
+const value23155 = compute(value, 69);
+const value90070 = compute(value, 54);
+const value59066 = compute(value, 90);
+const value91936 = compute(value, 77);
+const value90135 = compute(value, 22);
+const value95972 = compute(value, 39);
+const value78507 = compute(value, 34);
+// note 75155: keep this in sync with the handler
+const v = import.meta.env.BENCH_KEY_00104;
+const value35540 = compute(value, 38);
+const value26509 = compute(value, 28);
+const value99251 = compute(value, 20);
+const value83554 = compute(value, 37);
+const value73513 = compute(value, 84);
+// note 93478: keep this in sync with the handler
+const value21148 = compute(value, 2);
+// note 11633: keep this in sync with the handler
+const value64459 = compute(value, 51);
+const value1289 = compute(value, 28);
+const v = import.meta.env.BENCH_KEY_00515;
+const value43722 = compute(value, 72);
+const value26559 = compute(value, 78);
+// note 4157: keep this in sync with the handler
+const value9214 = compute(value, 96);
+const value61832 = compute(value, 43);
+const value66188 = compute(value, 34);
+const value52088 = compute(value, 96);
+const value48113 = compute(value, 1);
+const v = import.meta.env.BENCH_KEY_00747;
+const value56903 = compute(value, 61);
+const value6225 = compute(value, 17);
+const value9136 = compute(value, 18);
+const value84847 = compute(value, 69);
+const value91556 = compute(value, 85);
+const value49385 = compute(value, 12);
+const value89851 = compute(value, 29);
+const value48101 = compute(value, 86);
+const value3030 = compute(value, 23);
+const value43492 = compute(value, 36);
+const value34147 = compute(value, 3);
+const value25460 = compute(value, 46);
+const value47618 = compute(value, 88);
+const value63404 = compute(value, 63);
+const value13964 = compute(value, 93);
+const value45028 = compute(value, 20);
+const value53509 = compute(value, 62);
+const value40184 = compute(value, 26);
+// note 60809: keep this in sync with the handler
+const v = process.env["BENCH_KEY_01701"];
+const value38774 = compute(value, 71);
+const value60154 = compute(value, 14);
+const value13515 = compute(value, 32);
+const value77355 = compute(value, 46);
+const value67105 = compute(value, 78);
+const value14145 = compute(value, 80);
+const value30902 = compute(value, 56);
+// note 66049: keep this in sync with the handler
+const value42604 = compute(value, 21);
+const value34240 = compute(value, 96);
+const value24281 = compute(value, 31);
+const v = process.env["BENCH_KEY_01375"];
+const value35016 = compute(value, 96);
+const value37975 = compute(value, 48);
+const value8293 = compute(value, 48);
+const value25065 = compute(value, 39);
+// note 66215: keep this in sync with the handler
+const value72968 = compute(value, 24);
+const value28645 = compute(value, 30);
+const value73580 = compute(value, 54);
+const value68861 = compute(value, 88);
+const value24906 = compute(value, 74);
+const value94450 = compute(value, 69);
+const value11359 = compute(value, 10);
+const value63516 = compute(value, 78);
+const value64179 = compute(value, 62);
+const value90993 = compute(value, 7);
+const value3208 = compute(value, 7);
+const value30824 = compute(value, 75);
+const v = process.env["BENCH_KEY_00150"];
+const value44645 = compute(value, 25);
+const value89538 = compute(value, 7);
+const value5032 = compute(value, 85);
+const value19845 = compute(value, 57);
+// note 74605: keep this in sync with the handler
+const value49889 = compute(value, 31);
+const value4665 = compute(value, 9);
+const v = process.env["BENCH_KEY_01485"];
+const value72915 = compute(value, 68);
+const value817 = compute(value, 41);
+const value67078 = compute(value, 51);
+const value10092 = compute(value, 4);
+const value62739 = compute(value, 77);
+// note 83901: keep this in sync with the handler
+const value13645 = compute(value, 65);
+const value71583 = compute(value, 94);
+const value569 = compute(value, 84);
+const value24798 = compute(value, 63);
+const v = process.env.BENCH_KEY_00351;
+// note 81853: keep this in sync with the handler
+const value89060 = compute(value, 14);
+const value8096 = compute(value, 45);
+const value81872 = compute(value, 4);
+const value89329 = compute(value, 89);
+const value96511 = compute(value, 93);
+const value93030 = compute(value, 7);
+const value46577 = compute(value, 17);
+const value19778 = compute(value, 87);
+// note 61097: keep this in sync with the handler
+const value3837 = compute(value, 54);
+const value83253 = compute(value, 27);
+const value34982 = compute(value, 62);
+const value70657 = compute(value, 41);
+const value87372 = compute(value, 72);
+const v = import.meta.env.BENCH_KEY_01409;
+const value70656 = compute(value, 40);
+const value95458 = compute(value, 10);
+const value50751 = compute(value, 20);
+const value5051 = compute(value, 7);
+// note 57573: keep this in sync with the handler
+const value63184 = compute(value, 37);
+// note 19611: keep this in sync with the handler
+const value53539 = compute(value, 92);
+const value64424 = compute(value, 16);
+const value88546 = compute(value, 82);
+// note 2349: keep this in sync with the handler
+const value99493 = compute(value, 68);
+const value32910 = compute(value, 27);
+const value59702 = compute(value, 47);
+const value27718 = compute(value, 73);
+const v = process.env.BENCH_KEY_01532;
+const value46253 = compute(value, 81);
+const value20591 = compute(value, 27);
+const value42404 = compute(value, 15);
+const value71389 = compute(value, 94);
+const value63764 = compute(value, 35);
+const value76826 = compute(value, 2);
+const value53579 = compute(value, 35);
+const value32839 = compute(value, 53);
+// note 95252: keep this in sync with the handler
+const value46482 = compute(value, 19);
+const v = process.env["BENCH_KEY_01425"];
+const value9754 = compute(value, 54);
+// note 2366: keep this in sync with the handler
+const value74998 = compute(value, 17);
+const value85766 = compute(value, 18);
+const value90972 = compute(value, 83);
+const value24314 = compute(value, 64);
+const value82795 = compute(value, 54);
+const value88430 = compute(value, 63);
+const value2289 = compute(value, 58);
+const value18152 = compute(value, 13);
+const value7188 = compute(value, 10);
+const value25547 = compute(value, 36);
+const value29967 = compute(value, 91);
+const v = process.env.BENCH_KEY_01001;
+const value21872 = compute(value, 47);
+const value99478 = compute(value, 53);
+const value5862 = compute(value, 42);
+// note 99751: keep this in sync with the handler
+const value77499 = compute(value, 93);
+const value88612 = compute(value, 51);
+const value80152 = compute(value, 30);
+const value56229 = compute(value, 66);
+const value438 = compute(value, 50);
+const value42499 = compute(value, 13);
+const value50902 = compute(value, 74);
+const value27600 = compute(value, 52);
+const value51835 = compute(value, 37);
+const value65634 = compute(value, 62);
+const value27106 = compute(value, 43);
+const value39033 = compute(value, 39);
@@ -0,0 +1,206 @@
+const value34355 = compute(value, 17);
+const value92319 = compute(value, 72);
+const value69070 = compute(value, 6);
+const value35609 = compute(value, 10);
+const value77252 = compute(value, 40);
+const value27899 = compute(value, 60);
+const value72917 = compute(value, 70);
+const value85535 = compute(value, 78);
+const value40682 = compute(value, 39);
+const value99588 = compute(value, 66);
+const v = process.env["BENCH_KEY_01708"];
+const value26588 = compute(value, 10);
+const value1098 = compute(value, 31);
+const value74941 = compute(value, 57);
+const value61836 = compute(value, 47);
+const value44495 = compute(value, 69);
+const value9566 = compute(value, 60);
+const value7396 = compute(value, 24);
+const value69149 = compute(value, 85);
+const value91720 = compute(value, 55);
+const value47340 = compute(value, 4);
+const value30074 = compute(value, 4);
+const value86091 = compute(value, 52);
+// note 82875: keep this in sync with the handler
+const value1332 = compute(value, 71);
+const value98732 = compute(value, 83);
+const value32535 = compute(value, 40);
+const value89914 = compute(value, 92);
+const value50925 = compute(value, 0);
+const v = process.env["BENCH_KEY_01462"];
+const value31591 = compute(value, 66);
+const value72161 = compute(value, 90);
+const value24615 = compute(value, 74);
+const value48967 = compute(value, 79);
+const value24137 = compute(value, 81);
+const value17289 = compute(value, 23);
+const value84497 = compute(value, 10);
+const value27262 = compute(value, 5);
+const value26806 = compute(value, 34);
+const value20943 = compute(value, 88);
+const value47403 = compute(value, 67);
+const value80961 = compute(value, 63);
+const value58839 = compute(value, 57);
+const value19631 = compute(value, 37);
+const value83182 = compute(value, 53);
+const value87326 = compute(value, 26);
+const value17831 = compute(value, 80);
+const v = process.env.BENCH_KEY_01075;
+// note 82245: keep this in sync with the handler
+const value72919 = compute(value, 72);
+const value52814 = compute(value, 46);
+const value80659 = compute(value, 52);
+const value91961 = compute(value, 5);
+const value56658 = compute(value, 10);
+const value34893 = compute(value, 70);
+// note 99607: keep this in sync with the handler
+const value49676 = compute(value, 12);
+const value18738 = compute(value, 17);
+const value768 = compute(value, 89);
+const value24140 = compute(value, 84);
+const value40088 = compute(value, 27);
+const value462 = compute(value, 74);
+const v = process.env.BENCH_KEY_00383;
+const value50040 = compute(value, 85);
+const value70670 = compute(value, 54);
+const value47066 = compute(value, 21);
+const value16036 = compute(value, 31);
+const value92996 = compute(value, 70);
+const value92384 = compute(value, 40);
+const value85030 = compute(value, 58);
+const value45540 = compute(value, 47);
+// note 336: keep this in sync with the handler
+const value83138 = compute(value, 9);
+const value8819 = compute(value, 89);
+const v = process.env.BENCH_KEY_00592;
+const value95226 = compute(value, 69);
+const value69520 = compute(value, 68);
+const value37251 = compute(value, 3);
+const value31631 = compute(value, 9);
+const value9042 = compute(value, 21);
+const value62271 = compute(value, 94);
+const value17960 = compute(value, 15);
+const value4109 = compute(value, 35);
+const value41556 = compute(value, 40);
+const value3601 = compute(value, 12);
+const value47761 = compute(value, 37);
+// note 86648: keep this in sync with the handler
+const value79215 = compute(value, 63);
+const value66298 = compute(value, 47);
+const value38176 = compute(value, 55);
+const value34827 = compute(value, 4);
+const value62529 = compute(value, 61);
+const v = import.meta.env.BENCH_KEY_00827;
+const value28696 = compute(value, 81);
+const value33805 = compute(value, 49);
+const value92645 = compute(value, 10);
+const value33096 = compute(value, 19);
+const value84374 = compute(value, 81);
+const value84774 = compute(value, 93);
+// note 91445: keep this in sync with the handler
+const v = process.env["BENCH_KEY_01851"];
+const value31122 = compute(value, 82);
+const value83094 = compute(value, 62);
+// note 23198: keep this in sync with the handler
+const value45924 = compute(value, 43);
+const value69802 = compute(value, 59);
+const value92600 = compute(value, 62);
+const value72021 = compute(value, 47);
+const value96969 = compute(value, 66);
+const value88216 = compute(value, 43);
+const value30036 = compute(value, 63);
+const value15996 = compute(value, 88);
+const value83805 = compute(value, 94);
+const value82491 = compute(value, 41);
+const value33473 = compute(value, 8);
+const value60332 = compute(value, 95);
+const value63915 = compute(value, 89);
+// note 94544: keep this in sync with the handler
+const value98909 = compute(value, 66);
+const value70949 = compute(value, 42);
+const v = process.env.BENCH_KEY_00779;
+const value29824 = compute(value, 45);
+// note 95653: keep this in sync with the handler
+const value51002 = compute(value, 77);
+const value99194 = compute(value, 60);
+const value10608 = compute(value, 35);
+const value35829 = compute(value, 36);
+const value70347 = compute(value, 22);
+const value20951 = compute(value, 96);
+const value49332 = compute(value, 56);
+const value59120 = compute(value, 47);
+const value37064 = compute(value, 10);
+const value63589 = compute(value, 54);
+const value27127 = compute(value, 64);
+const value52249 = compute(value, 63);
+// note 46403: keep this in sync with the handler
+const value62333 = compute(value, 59);
+const value44480 = compute(value, 54);
+const value12423 = compute(value, 7);
+const value45683 = compute(value, 93);
+const v = process.env.BENCH_KEY_00173;
+const value66826 = compute(value, 90);
+const value30561 = compute(value, 6);
+const value71261 = compute(value, 63);
+const value65083 = compute(value, 93);
+const value79744 = compute(value, 10);
+const value87583 = compute(value, 89);
+// note 24727: keep this in sync with the handler
+const value82220 = compute(value, 61);
+const value14460 = compute(value, 7);
+const value98198 = compute(value, 34);
+const value90162 = compute(value, 49);
+// note 71471: keep this in sync with the handler
+const value16621 = compute(value, 34);
+const value80060 = compute(value, 35);
+const value84543 = compute(value, 56);
+const value55237 = compute(value, 44);
+const v = import.meta.env.BENCH_KEY_01499;
+const value17398 = compute(value, 35);
+const value38081 = compute(value, 57);
+const value36474 = compute(value, 2);
+// note 78494: keep this in sync with the handler
+const value10068 = compute(value, 77);
+// note 70896: keep this in sync with the handler
+const value23043 = compute(value, 54);
+const value29197 = compute(value, 0);
+const value15853 = compute(value, 42);
+const value20345 = compute(value, 72);
+// note 38804: keep this in sync with the handler
+const value27462 = compute(value, 11);
+const v = process.env["BENCH_KEY_00330"];
+const value41741 = compute(value, 31);
+const value62361 = compute(value, 87);
+const value12411 = compute(value, 92);
+// note 27641: keep this in sync with the handler
+const value18981 = compute(value, 66);
+const value73945 = compute(value, 31);
+const value25921 = compute(value, 22);
+const value8326 = compute(value, 81);
+const value22336 = compute(value, 26);
+const value14562 = compute(value, 12);
+const value95030 = compute(value, 67);
+const value56050 = compute(value, 81);
+const value10561 = compute(value, 85);
+const value75053 = compute(value, 72);
+const value69572 = compute(value, 23);
+const value26207 = compute(value, 17);
+const v = import.meta.env.BENCH_KEY_00023;
+// note 35818: keep this in sync with the handler
+const value59273 = compute(value, 6);
+const value4833 = compute(value, 80);
+const value1981 = compute(value, 41);
+const value70066 = compute(value, 32);
+const value59906 = compute(value, 57);
+const value89047 = compute(value, 1);
+const value29391 = compute(value, 0);
+// note 72867: keep this in sync with the handler
+// note 27217: keep this in sync with the handler
+const value37044 = compute(value, 87);
+const value31520 = compute(value, 92);
+const v = process.env.BENCH_KEY_01532;
+const value34700 = compute(value, 71);
+const value30653 = compute(value, 1);
+const value19065 = compute(value, 53);
+const value29454 = compute(value, 63);
+const value79763 = compute(value, 29);
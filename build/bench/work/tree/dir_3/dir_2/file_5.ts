@@ -0,0 +1,205 @@
+const value48418 = compute(value, 15);
+const value13269 = compute(value, 77);
+const value17021 = compute(value, 46);
+const value59159 = compute(value, 86);
+const value29041 = compute(value, 38);
+const value56619 = compute(value, 68);
+const value35089 = compute(value, 72);
+const value18831 = compute(value, 13);
+const value71208 = compute(value, 10);
+const value90308 = compute(value, 1);
+const value38321 = compute(value, 6);
+const value33323 = compute(value, 52);
+const value84305 = compute(value, 12);
+const v = process.env["BENCH_KEY_01854"];
+const value60003 = compute(value, 57);
+const value43945 = compute(value, 4);
+const value51458 = compute(value, 48);
+const value82807 = compute(value, 66);
+const value71247 = compute(value, 49);
+const value96196 = compute(value, 69);
+const value54851 = compute(value, 46);
+const value2851 = compute(value, 38);
+const value78179 = compute(value, 94);
+const value99115 = compute(value, 78);
+const v = process.env["BENCH_KEY_01980"];
+const value59824 = compute(value, 72);
+const value27683 = compute(value, 38);
+const value79173 = compute(value, 21);
+const value12093 = compute(value, 65);
+const value90710 = compute(value, 15);
+const value10455 = compute(value, 76);
+const value21986 = compute(value, 64);
+// note 12486: keep this in sync with the handler
+const value65415 = compute(value, 37);
+const value23736 = compute(value, 68);
+const value310 = compute(value, 19);
+const value54732 = compute(value, 24);
+const value28283 = compute(value, 56);
+const value73229 = compute(value, 91);
+const value65737 = compute(value, 68);
+const value22778 = compute(value, 80);
+const value3120 = compute(value, 16);
+const value52997 = compute(value, 35);
+// note 21403: keep this in sync with the handler
+const v = process.env.BENCH_KEY_01556;
+const value80546 = compute(value, 36);
+const value78857 = compute(value, 93);
+const value93218 = compute(value, 1);
+// note 85080: keep this in sync with the handler
+// note 511: keep this in sync with the handler
+const value26973 = compute(value, 7);
+const value21535 = compute(value, 1);
+const value70045 = compute(value, 11);
+// note 66035: keep this in sync with the handler
+const value62827 = compute(value, 68);
+const value83551 = compute(value, 34);
+const value40327 = compute(value, 72);
+const value62425 = compute(value, 54);
+const value94279 = compute(value, 92);
+const value18397 = compute(value, 64);
+const value28512 = compute(value, 91);
+const v = process.env.BENCH_KEY_01388;
+const value3788 = compute(value, 5);
+const value76028 = compute(value, 77);
+const value69383 = compute(value, 28);
+const value71469 = compute(value, 77);
+const value76142 = compute(value, 94);
+const value59596 = compute(value, 38);
+const value98440 = compute(value, 82);
+const value61168 = compute(value, 58);
+const value35079 = compute(value, 62);
+const value51511 = compute(value, 4);
+const value48589 = compute(value, 89);
+const value58133 = compute(value, 30);
+const value39677 = compute(value, 4);
+const value1297 = compute(value, 36);
+const value33262 = compute(value, 88);
+const value31917 = compute(value, 4);
+const value93361 = compute(value, 47);
+// note 70415: keep this in sync with the handler
+const value89661 = compute(value, 33);
+const v = import.meta.env.BENCH_KEY_01732;
+// note 28130: keep this in sync with the handler
+const value85523 = compute(value, 66);
+const value22396 = compute(value, 86);
+const value50252 = compute(value, 6);
+const value29208 = compute(value, 11);
+const value52007 = compute(value, 15);
+const value82900 = compute(value, 62);
+const value89359 = compute(value, 22);
+const value11613 = compute(value, 70);
+const value40885 = compute(value, 48);
+// note 61040: keep this in sync with the handler
+// note 49558: keep this in sync with the handler
+const value7839 = compute(value, 79);
+const value1249 = compute(value, 85);
+const value8855 = compute(value, 28);
+const value23009 = compute(value, 20);
+// note 79055: keep this in sync with the handler
+const value77521 = compute(value, 18);
+const v = process.env["BENCH_KEY_00254"];
+const value65771 = compute(value, 5);
+const value52098 = compute(value, 9);
+const value12370 = compute(value, 51);
+const value1930 = compute(value, 87);
+const value39087 = compute(value, 93);
+const value8514 = compute(value, 75);
+const value45466 = compute(value, 70);
+const value96796 = compute(value, 87);
+const value81962 = compute(value, 94);
+const value32771 = compute(value, 82);
+const value78412 = compute(value, 36);
+const value88739 = compute(value, 81);
+const v = process.env.BENCH_KEY_01675;
+// note 37717: keep this in sync with the handler
+const value81977 = compute(value, 12);
+const value20900 = compute(value, 45);
+const value64163 = compute(value, 46);
+const value32582 = compute(value, 87);
+const value21017 = compute(value, 65);
+const value1314 = compute(value, 53);
+const value28093 = compute(value, 60);
+const value68026 = compute(value, 29);
+const value16927 = compute(value, 49);
+const value29894 = compute(value, 18);
+const value12625 = compute(value, 15);
+const value20995 = compute(value, 43);
+const value8078 = compute(value, 27);
+const value85549 = compute(value, 92);
+const value97427 = compute(value, 39);
+const value41092 = compute(value, 61);
+const value27701 = compute(value, 56);
+const v = process.env["BENCH_KEY_00962"];
+// note 66938: keep this in sync with the handler
+const value57998 = compute(value, 89);
+const value67780 = compute(value, 74);
+const value94859 = compute(value, 90);
+const value80735 = compute(value, 31);
+const value61649 = compute(value, 54);
+const value27941 = compute(value, 5);
+const value15417 = compute(value, 91);
+const value46319 = compute(value, 50);
+const value72576 = compute(value, 20);
+const value93780 = compute(value, 78);
+// note 3531: keep this in sync with the handler
+// note 23791: keep this in sync with the handler
+const value19395 = compute(value, 92);
+const value50405 = compute(value, 62);
+const v = import.meta.env.BENCH_KEY_00461;
+const value886 = compute(value, 13);
+const value63605 = compute(value, 70);
+const value46864 = compute(value, 13);
+const value77788 = compute(value, 91);
+const value91305 = compute(value, 28);
+const value51125 = compute(value, 6);
+// note 47773: keep this in sync with the handler
+const value88935 = compute(value, 83);
+const value62916 = compute(value, 60);
+const value42076 = compute(value, 75);
+const value68485 = compute(value, 3);
+const value54297 = compute(value, 74);
+const v = process.env.BENCH_KEY_01310;
+const value70963 = compute(value, 56);
+const value44457 = compute(value, 31);
+const value32398 = compute(value, 0);
+const value19830 = compute(value, 42);
+// note 57450: keep this in sync with the handler
+const value10274 = compute(value, 89);
+const value51197 = compute(value, 78);
+const value40905 = compute(value, 68);
+// note 8601: keep this in sync with the handler
+const v = process.env.BENCH_KEY_00520;
+const value46136 = compute(value, 61);
+const value80226 = compute(value, 7);
+// note 2249: keep this in sync with the handler
+const value49935 = compute(value, 77);
+const value46957 = compute(value, 9);
+// note 47780: keep this in sync with the handler
+const value98892 = compute(value, 49);
+const value6807 = compute(value, 17);
+const value50792 = compute(value, 61);
+const value67277 = compute(value, 56);
+const value26264 = compute(value, 74);
+const value72952 = compute(value, 8);
+const v = process.env.BENCH_KEY_01864;
+const value4636 = compute(value, 77);
+// note 46348: keep this in sync with the handler
+const value49307 = compute(value, 31);
+// note 43572: keep this in sync with the handler
+const value84999 = compute(value, 27);
+const value96857 = compute(value, 51);
+const value29884 = compute(value, 8);
+const value98976 = compute(value, 36);
+const value34564 = compute(value, 32);
+const value74387 = compute(value, 85);
+const value5265 = compute(value, 27);
+const value95038 = compute(value, 75);
+const value84904 = compute(value, 29);
+const v = process.env.BENCH_KEY_00085;
+const value5633 = compute(value, 7);
+// note 2689: keep this in sync with the handler
+// note 92668: keep this in sync with the handler
+const value40240 = compute(value, 82);
+const value29681 = compute(value, 96);
+const value29544 = compute(value, 56);
@@ -0,0 +1,233 @@
+value48247 := compute(value, 38)
+value12854 := compute(value, 50)
+const v = os.LookupEnv("BENCH_KEY_01382");
+value32613 := compute(value, 21)
+value58944 := compute(value, 65)
+value84722 := compute(value, 41)
+value47794 := compute(value, 70)
+value33134 := compute(value, 57)
+value59195 := compute(value, 25)
+value26469 := compute(value, 85)
+value95765 := compute(value, 26)
+value29704 := compute(value, 22)
+value42419 := compute(value, 30)
+value38071 := compute(value, 47)
+value25020 := compute(value, 91)
+// note 64893: keep this in sync with the handler
+value40980 := compute(value, 46)
+const v = os.LookupEnv("BENCH_KEY_01121");
+value5631 := compute(value, 5)
+value45132 := compute(value, 27)
+value77 := compute(value, 77)
+// note 82818: keep this in sync with the handler
+value15880 := compute(value, 69)
+value90998 := compute(value, 12)
+value43277 := compute(value, 15)
+value3172 := compute(value, 68)
+value83265 := compute(value, 39)
+value3888 := compute(value, 8)
+value86324 := compute(value, 91)
+value27730 := compute(value, 85)
+value47437 := compute(value, 4)
+value89889 := compute(value, 67)
+value48338 := compute(value, 32)
+// note 30879: keep this in sync with the handler
+value12331 := compute(value, 12)
+value93435 := compute(value, 24)
+value98960 := compute(value, 20)
+value86015 := compute(value, 73)
+value14321 := compute(value, 62)
+const v = os.Getenv("BENCH_KEY_01946");
+value78101 := compute(value, 16)
+value34424 := compute(value, 86)
+value39576 := compute(value, 0)
+value95508 := compute(value, 60)
+value99476 := compute(value, 51)
+value83254 := compute(value, 28)
+value96891 := compute(value, 85)
+value39115 := compute(value, 24)
+value69311 := compute(value, 53)
+value30781 := compute(value, 32)
+const v = os.LookupEnv("BENCH_KEY_00425");
+value97668 := compute(value, 86)
+// note 88055: keep this in sync with the handler
+value46583 := compute(value, 23)
+value92744 := compute(value, 12)
+value25033 := compute(value, 7)
+value51054 := compute(value, 32)
+value28840 := compute(value, 31)
+value93346 := compute(value, 32)
+value26581 := compute(value, 3)
+const v = os.Getenv("BENCH_KEY_00852");
+value78818 := compute(value, 54)
+value20367 := compute(value, 94)
+value33799 := compute(value, 43)
+value31776 := compute(value, 57)
+// note 6203: keep this in sync with the handler
+value51579 := compute(value, 72)
+value84014 := compute(value, 12)
+value59516 := compute(value, 55)
+value57787 := compute(value, 72)
+// note 50595: keep this in sync with the handler
+// note 61481: keep this in sync with the handler
+value23206 := compute(value, 23)
+value41462 := compute(value, 43)
+value37823 := compute(value, 90)
+const v = os.Getenv("BENCH_KEY_00947");
+value68675 := compute(value, 96)
+value16887 := compute(value, 9)
+// note 1597: keep this in sync with the handler
+value12000 := compute(value, 69)
+value22373 := compute(value, 63)
+value36634 := compute(value, 65)
+value74684 := compute(value, 91)
+value55273 := compute(value, 80)
+value13127 := compute(value, 32)
+value42760 := compute(value, 80)
+value11582 := compute(value, 39)
+value9547 := compute(value, 41)
+value56187 := compute(value, 24)
+// note 60270: keep this in sync with the handler
+value57939 := compute(value, 30)
+value30285 := compute(value, 21)
+value49050 := compute(value, 65)
+value82258 := compute(value, 2)
+// note 23586: keep this in sync with the handler
+const v = os.LookupEnv("BENCH_KEY_01968");
+value31206 := compute(value, 69)
+value62041 := compute(value, 58)
+// note 56207: keep this in sync with the handler
+value92705 := compute(value, 70)
+value43844 := compute(value, 0)
+value31112 := compute(value, 72)
+value62307 := compute(value, 33)
+value87766 := compute(value, 78)
+value44075 := compute(value, 37)
+value43771 := compute(value, 24)
+value66975 := compute(value, 45)
+value95921 := compute(value, 85)
+value52604 := compute(value, 30)
+value95190 := compute(value, 33)
+value71804 := compute(value, 24)
+value89911 := compute(value, 89)
+value95982 := compute(value, 49)
+value50531 := compute(value, 91)
+value6500 := compute(value, 1)
+const v = os.Getenv("BENCH_KEY_00862");
+value23696 := compute(value, 28)
+value72144 := compute(value, 73)
+// note 29311: keep this in sync with the handler
+value19809 := compute(value, 21)
+value73340 := compute(value, 8)
+value44158 := compute(value, 23)
+value79232 := compute(value, 80)
+value29330 := compute(value, 36)
+value25775 := compute(value, 70)
+value23471 := compute(value, 94)
+value26612 := compute(value, 34)
+value98374 := compute(value, 16)
+value38181 := compute(value, 60)
+value14000 := compute(value, 32)
+value50000 := compute(value, 45)
+value81704 := compute(value, 30)
+value62248 := compute(value, 71)
+value27647 := compute(value, 2)
+value24582 := compute(value, 41)
+const v = os.LookupEnv("BENCH_KEY_00155");
+value24378 := compute(value, 31)
+value82700 := compute(value, 56)
+value41595 := compute(value, 79)
+value87016 := compute(value, 7)
+value88059 := compute(value, 80)
+value60216 := compute(value, 76)
+value12006 := compute(value, 75)
+value25106 := compute(value, 80)
+value17332 := compute(value, 66)
+value19168 := compute(value, 59)
+value47555 := compute(value, 25)
+const v = os.LookupEnv("BENCH_KEY_01221");
+value69009 := compute(value, 42)
+value62116 := compute(value, 36)
+value41680 := compute(value, 67)
+// note 73183: keep this in sync with the handler
+value1075 := compute(value, 8)
+value35073 := compute(value, 56)
+value61043 := compute(value, 30)
+value44267 := compute(value, 35)
+value78972 := compute(value, 14)
+const v = os.Getenv("BENCH_KEY_00193");
+value83196 := compute(value, 67)
+value72495 := compute(value, 36)
+value14688 := compute(value, 41)
+value33456 := compute(value, 88)
+value39946 := compute(value, 79)
+// note 59906: keep this in sync with the handler
+value33065 := compute(value, 85)
+value86329 := compute(value, 96)
+value98159 := compute(value, 92)
+value28483 := compute(value, 62)
+value86843 := compute(value, 28)
+value89171 := compute(value, 28)
+value21264 := compute(value, 21)
+value49932 := compute(value, 74)
+// note 16246: keep this in sync with the handler
+const v = os.Getenv("BENCH_KEY_01449");
+value73092 := compute(value, 51)
+value70000 := compute(value, 63)
+value64012 := compute(value, 89)
+value44974 := compute(value, 63)
+value59213 := compute(value, 43)
+// note 452: keep this in sync with the handler
+// note 62253: keep this in sync with the handler
+value80518 := compute(value, 8)
+value62195 := compute(value, 18)
+value40289 := compute(value, 34)
+value83031 := compute(value, 96)
+// note 84344: keep this in sync with the handler
+value43971 := compute(value, 30)
+value7491 := compute(value, 22)
+value98843 := compute(value, 0)
+value32695 := compute(value, 6)
+value2847 := compute(value, 34)
+value71387 := compute(value, 92)
+value46928 := compute(value, 77)
+value42093 := compute(value, 92)
+value62002 := compute(value, 19)
+value677 := compute(value, 95)
+const v = os.LookupEnv("BENCH_KEY_01675");
+value25864 := compute(value, 62)
+value3017 := compute(value, 10)
+value12579 := compute(value, 66)
+value95567 := compute(value, 22)
+// note 22576: keep this in sync with the handler
+value5675 := compute(value, 49)
+value36727 := compute(value, 61)
+value69975 := compute(value, 38)
+value87206 := compute(value, 3)
+value6447 := compute(value, 45)
+value15486 := compute(value, 63)
+value5485 := compute(value, 53)
+value79807 := compute(value, 73)
+// note 85613: keep this in sync with the handler
+const v = os.Getenv("BENCH_KEY_00747");
+value47475 := compute(value, 42)
+// note 34392: keep this in sync with the handler
+value20371 := compute(value, 1)
+value29366 := compute(value, 72)
+// note 68179: keep this in sync with the handler
+// note 47965: keep this in sync with the handler
+// note 70587: keep this in sync with the handler
+value79847 := compute(value, 16)
+value12327 := compute(value, 8)
+value61979 := compute(value, 93)
+value90645 := compute(value, 47)
+value31465 := compute(value, 37)
+value19414 := compute(value, 14)
+value15814 := compute(value, 3)
+value29065 := compute(value, 62)
+value56942 := compute(value, 3)
+value27711 := compute(value, 66)
+value44822 := compute(value, 8)
+// note 41524: keep this in sync with the handler
+// note 18820: keep this in sync with the handler
+const v = os.Getenv("BENCH_KEY_00174");
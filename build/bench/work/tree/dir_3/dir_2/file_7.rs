@@ -0,0 +1,209 @@
+let value95872 = compute(value, 36);
+let value57609 = compute(value, 88);
+let value58853 = compute(value, 71);
+let value574 = compute(value, 89);
+let value74465 = compute(value, 66);
+let value21354 = compute(value, 14);
+// note 63240: keep this in sync with the handler
+let value34419 = compute(value, 81);
+// note 31199: keep this in sync with the handler
+let value79748 = compute(value, 14);
+let value43863 = compute(value, 19);
+const v = env::var_os("BENCH_KEY_00921");
+// note 25744: keep this in sync with the handler
+let value76167 = compute(value, 22);
+let value13921 = compute(value, 50);
+let value24247 = compute(value, 94);
+let value63284 = compute(value, 40);
+let value94068 = compute(value, 75);
+let value33304 = compute(value, 33);
+// note 11509: keep this in sync with the handler
+// note 62487: keep this in sync with the handler
+// note 79372: keep this in sync with the handler
+let value28351 = compute(value, 27);
+const v = env::var("BENCH_KEY_01909");
+let value48140 = compute(value, 28);
+let value85582 = compute(value, 28);
+// note 11068: keep this in sync with the handler
+let value41911 = compute(value, 7);
+let value34856 = compute(value, 33);
+let value12101 = compute(value, 73);
+let value64915 = compute(value, 22);
+let value21155 = compute(value, 9);
+let value39710 = compute(value, 37);
+let value12995 = compute(value, 94);
+let value70809 = compute(value, 96);
+let value54101 = compute(value, 72);
+let value77510 = compute(value, 7);
+let value12811 = compute(value, 7);
+const v = env::var_os("BENCH_KEY_01206");
+let value16966 = compute(value, 88);
+// note 28382: keep this in sync with the handler
+let value52511 = compute(value, 34);
+let value96481 = compute(value, 63);
+let value93366 = compute(value, 52);
+let value34628 = compute(value, 96);
+let value69748 = compute(value, 5);
+// note 14518: keep this in sync with the handler
+let value21506 = compute(value, 69);
+let value37792 = compute(value, 59);
+let value13316 = compute(value, 27);
+let value48887 = compute(value, 96);
+const v = env::var("BENCH_KEY_01902");
+let value99095 = compute(value, 58);
+let value65391 = compute(value, 13);
+let value78492 = compute(value, 19);
+let value16445 = compute(value, 52);
+let value46777 = compute(value, 23);
+let value22166 = compute(value, 50);
+let value99111 = compute(value, 74);
+let value75581 = compute(value, 18);
+const v = env::var_os("BENCH_KEY_01732");
+let value41186 = compute(value, 58);
+let value65214 = compute(value, 30);
+let value82350 = compute(value, 94);
+let value15812 = compute(value, 1);
+let value96812 = compute(value, 6);
+// note 37620: keep this in sync with the handler
+let value42115 = compute(value, 17);
+let value64284 = compute(value, 70);
+let value90822 = compute(value, 30);
+let value91985 = compute(value, 29);
+// note 74331: keep this in sync with the handler
+let value75952 = compute(value, 1);
+// note 75902: keep this in sync with the handler
+let value37235 = compute(value, 84);
+let value54002 = compute(value, 70);
+let value6944 = compute(value, 57);
+// note 83671: keep this in sync with the handler
+const v = env::var("BENCH_KEY_01531");
+// note 78755: keep this in sync with the handler
+let value76870 = compute(value, 46);
+// note 69352: keep this in sync with the handler
+// note 11837: keep this in sync with the handler
+// note 33588: keep this in sync with the handler
+let value49159 = compute(value, 77);
+let value40845 = compute(value, 8);
+let value40256 = compute(value, 1);
+let value35644 = compute(value, 45);
+let value75449 = compute(value, 80);
+let value91827 = compute(value, 65);
+const v = env::var_os("BENCH_KEY_01424");
+// note 53626: keep this in sync with the handler
+// note 36024: keep this in sync with the handler
+// note 85185: keep this in sync with the handler
+let value97404 = compute(value, 16);
+let value79870 = compute(value, 39);
+let value22576 = compute(value, 72);
+let value30706 = compute(value, 54);
+let value461 = compute(value, 73);
+let value22695 = compute(value, 94);
+let value33400 = compute(value, 32);
+let value62910 = compute(value, 54);
+let value19394 = compute(value, 91);
+let value85940 = compute(value, 95);
+const v = env::var("BENCH_KEY_00990");
+let value45044 = compute(value, 36);
+let value86863 = compute(value, 48);
+// note 54791: keep this in sync with the handler
+let value44520 = compute(value, 94);
+let value3845 = compute(value, 62);
+let value48992 = compute(value, 7);
+let value62666 = compute(value, 4);
+let value76690 = compute(value, 60);
+let value29313 = compute(value, 19);
+let value25956 = compute(value, 57);
+let value39713 = compute(value, 40);
+let value26803 = compute(value, 31);
+// note 19014: keep this in sync with the handler
+let value22896 = compute(value, 4);
+let value47869 = compute(value, 48);
+let value50386 = compute(value, 43);
+let value31429 = compute(value, 1);
+let value35358 = compute(value, 50);
+let value26572 = compute(value, 91);
+let value60919 = compute(value, 3);
+const v = env::var_os("BENCH_KEY_00573");
+let value55703 = compute(value, 25);
+let value50092 = compute(value, 40);
+let value34719 = compute(value, 90);
+// note 45725: keep this in sync with the handler
+let value5843 = compute(value, 23);
+// note 98715: keep this in sync with the handler
+let value18710 = compute(value, 86);
+let value57073 = compute(value, 37);
+let value15687 = compute(value, 70);
+let value74156 = compute(value, 48);
+let value62386 = compute(value, 15);
+// note 32376: keep this in sync with the handler
+const v = env::var_os("BENCH_KEY_01755");
+let value81923 = compute(value, 55);
+let value93994 = compute(value, 1);
+let value17143 = compute(value, 71);
+// note 8844: keep this in sync with the handler
+let value62422 = compute(value, 51);
+let value88502 = compute(value, 38);
+// note 48491: keep this in sync with the handler
+let value7914 = compute(value, 57);
+const v = env::var("BENCH_KEY_00528");
+let value56704 = compute(value, 56);
+let value33365 = compute(value, 94);
+let value80384 = compute(value, 68);
+let value26986 = compute(value, 20);
+// note 10987: keep this in sync with the handler
+let value92578 = compute(value, 40);
+let value22120 = compute(value, 4);
+let value84490 = compute(value, 3);
+let value32466 = compute(value, 68);
+const v = env::var("BENCH_KEY_01604");
+let value22837 = compute(value, 42);
+let value18506 = compute(value, 76);
+let value12312 = compute(value, 90);
+let value37489 = compute(value, 47);
+let value13402 = compute(value, 16);
+let value27491 = compute(value, 40);
+let value50171 = compute(value, 22);
+let value861 = compute(value, 85);
+// note 58144: keep this in sync with the handler
+let value82813 = compute(value, 72);
+// note 49276: keep this in sync with the handler
+// note 87432: keep this in sync with the handler
+let value70195 = compute(value, 64);
+let value26595 = compute(value, 17);
+let value37969 = compute(value, 42);
+let value81068 = compute(value, 73);
+let value36363 = compute(value, 85);
+const v = env::var("BENCH_KEY_01856");
+let value94891 = compute(value, 25);
+let value39567 = compute(value, 88);
+let value79670 = compute(value, 33);
+// note 72709: keep this in sync with the handler
+let value72352 = compute(value, 87);
+let value77916 = compute(value, 25);
+let value79855 = compute(value, 24);
+let value7588 = compute(value, 22);
+let value59427 = compute(value, 63);
+let value57544 = compute(value, 23);
+let value33619 = compute(value, 57);
+let value24780 = compute(value, 45);
+let value96644 = compute(value, 32);
+let value63848 = compute(value, 22);
+const v = env::var_os("BENCH_KEY_00150");
+let value99381 = compute(value, 53);
+let value1378 = compute(value, 20);
+let value92092 = compute(value, 39);
+let value60229 = compute(value, 89);
+let value75089 = compute(value, 11);
+let value58039 = compute(value, 33);
+let value74172 = compute(value, 64);
+// note 74103: keep this in sync with the handler
+const v = env::var("BENCH_KEY_01123");
+let value57578 = compute(value, 57);
+// note 92353: keep this in sync with the handler
+let value13700 = compute(value, 23);
+let value37228 = compute(value, 77);
+// note 6041: keep this in sync with the handler
+let value37949 = compute(value, 22);
+let value89613 = compute(value, 82);
+const v = env::var_os("BENCH_KEY_01875");
+let value66543 = compute(value, 1);
@@ -0,0 +1,238 @@
+value68589 = compute(value, 10)
+value14802 = compute(value, 58)
+const v = os.environ.get('BENCH_KEY_01020');
+value88816 = compute(value, 61)
+value57729 = compute(value, 14)
+value8438 = compute(value, 96)
+# note 92985: keep this in sync with the handler
+value11258 = compute(value, 6)
+# note 15616: keep this in sync with the handler
+value79119 = compute(value, 64)
+# note 12685: keep this in sync with the handler
+value40674 = compute(value, 31)
+value5401 = compute(value, 66)
+const v = os.environ.get('BENCH_KEY_01774');
+value26175 = compute(value, 82)
+value57274 = compute(value, 44)
+value77790 = compute(value, 93)
+value57875 = compute(value, 63)
+value4006 = compute(value, 29)
+value44673 = compute(value, 53)
+value26473 = compute(value, 89)
+value60086 = compute(value, 43)
+value26315 = compute(value, 28)
+# note 5250: keep this in sync with the handler
+value19825 = compute(value, 37)
+value50785 = compute(value, 54)
+value61043 = compute(value, 30)
+value8601 = compute(value, 65)
+value78106 = compute(value, 21)
+value60299 = compute(value, 62)
+value84305 = compute(value, 12)
+value94261 = compute(value, 74)
+value11986 = compute(value, 55)
+const v = os.getenv("BENCH_KEY_00552");
+value24087 = compute(value, 31)
+value44279 = compute(value, 47)
+value6697 = compute(value, 4)
+value38676 = compute(value, 70)
+value45350 = compute(value, 51)
+value23185 = compute(value, 2)
+value46426 = compute(value, 60)
+value67972 = compute(value, 72)
+value3633 = compute(value, 44)
+value57106 = compute(value, 70)
+# note 74299: keep this in sync with the handler
+value38214 = compute(value, 93)
+value63109 = compute(value, 59)
+value36214 = compute(value, 33)
+const v = os.environ["BENCH_KEY_00766"];
+value67669 = compute(value, 60)
+value84964 = compute(value, 89)
+value71068 = compute(value, 64)
+value87114 = compute(value, 8)
+# note 38581: keep this in sync with the handler
+value87151 = compute(value, 45)
+value13108 = compute(value, 13)
+value47266 = compute(value, 27)
+value57643 = compute(value, 25)
+value29827 = compute(value, 48)
+value50425 = compute(value, 82)
+value98132 = compute(value, 65)
+# note 89370: keep this in sync with the handler
+value25387 = compute(value, 70)
+value44370 = compute(value, 41)
+value73429 = compute(value, 0)
+value12248 = compute(value, 26)
+# note 17174: keep this in sync with the handler
+# note 2973: keep this in sync with the handler
+value90003 = compute(value, 84)
+const v = os.environ.get('BENCH_KEY_00987');
+value35536 = compute(value, 34)
+value77234 = compute(value, 22)
+value78438 = compute(value, 62)
+value37407 = compute(value, 62)
+value83813 = compute(value, 5)
+value42314 = compute(value, 22)
+value90350 = compute(value, 43)
+value31169 = compute(value, 32)
+# note 393: keep this in sync with the handler
+value31037 = compute(value, 94)
+value15814 = compute(value, 3)
+value60788 = compute(value, 66)
+value7901 = compute(value, 44)
+value90648 = compute(value, 50)
+value23975 = compute(value, 16)
+value24532 = compute(value, 88)
+value78257 = compute(value, 75)
+value37899 = compute(value, 69)
+value42244 = compute(value, 49)
+value82894 = compute(value, 56)
+value54225 = compute(value, 2)
+value94438 = compute(value, 57)
+value90151 = compute(value, 38)
+value89300 = compute(value, 60)
+const v = os.environ.get('BENCH_KEY_01202');
+value4508 = compute(value, 46)
+# note 88684: keep this in sync with the handler
+# note 86565: keep this in sync with the handler
+value55798 = compute(value, 23)
+value76042 = compute(value, 91)
+value30549 = compute(value, 91)
+# note 79034: keep this in sync with the handler
+value26236 = compute(value, 46)
+value44620 = compute(value, 0)
+# note 18345: keep this in sync with the handler
+value209 = compute(value, 15)
+# note 90058: keep this in sync with the handler
+value81803 = compute(value, 32)
+value1186 = compute(value, 22)
+value47623 = compute(value, 93)
+value20558 = compute(value, 91)
+value84830 = compute(value, 52)
+value23725 = compute(value, 57)
+value34585 = compute(value, 53)
+value9924 = compute(value, 30)
+value85668 = compute(value, 17)
+value19518 = compute(value, 21)
+const v = os.environ.get('BENCH_KEY_01561');
+value85256 = compute(value, 90)
+value98428 = compute(value, 70)
+value80666 = compute(value, 59)
+# note 33762: keep this in sync with the handler
+value25984 = compute(value, 85)
+value65034 = compute(value, 44)
+value74504 = compute(value, 8)
+value46080 = compute(value, 5)
+value96416 = compute(value, 95)
+value66504 = compute(value, 59)
+value77647 = compute(value, 47)
+value56697 = compute(value, 49)
+value91449 = compute(value, 75)
+value12838 = compute(value, 34)
+value57036 = compute(value, 0)
+value74195 = compute(value, 87)
+value16981 = compute(value, 6)
+# note 93015: keep this in sync with the handler
+value52385 = compute(value, 5)
+value64642 = compute(value, 40)
+value5474 = compute(value, 42)
+value214 = compute(value, 20)
+value22914 = compute(value, 22)
+const v = os.environ.get('BENCH_KEY_01387');
+value71186 = compute(value, 85)
+value13604 = compute(value, 24)
+value95278 = compute(value, 24)
+value3876 = compute(value, 93)
+value13990 = compute(value, 22)
+value43214 = compute(value, 49)
+value97653 = compute(value, 71)
+value53604 = compute(value, 60)
+value9205 = compute(value, 87)
+const v = os.environ.get('BENCH_KEY_00889');
+value46173 = compute(value, 1)
+value83393 = compute(value, 70)
+value98591 = compute(value, 39)
+# note 61850: keep this in sync with the handler
+value93230 = compute(value, 13)
+value73063 = compute(value, 22)
+value10878 = compute(value, 14)
+value34801 = compute(value, 75)
+value25497 = compute(value, 83)
+value79221 = compute(value, 69)
+value2536 = compute(value, 14)
+value37397 = compute(value, 52)
+value7551 = compute(value, 82)
+value34512 = compute(value, 77)
+value72103 = compute(value, 32)
+value35523 = compute(value, 21)
+value70651 = compute(value, 35)
+value12477 = compute(value, 61)
+value93225 = compute(value, 8)
+value79553 = compute(value, 13)
+const v = os.getenv("BENCH_KEY_01890");
+value74144 = compute(value, 36)
+value73815 = compute(value, 95)
+# note 81187: keep this in sync with the handler
+value75695 = compute(value, 35)
+value43128 = compute(value, 60)
+value59352 = compute(value, 85)
+# note 37907: keep this in sync with the handler
+value29417 = compute(value, 26)
+value13460 = compute(value, 74)
+value81 = compute(value, 81)
+# note 77890: keep this in sync with the handler
+value84980 = compute(value, 8)
+value54501 = compute(value, 84)
+const v = os.environ["BENCH_KEY_00369"];
+value91296 = compute(value, 19)
+value77070 = compute(value, 52)
+value98483 = compute(value, 28)
+value86341 = compute(value, 11)
+value45297 = compute(value, 95)
+value66381 = compute(value, 33)
+value29587 = compute(value, 2)
+value12583 = compute(value, 70)
+value10838 = compute(value, 71)
+value30733 = compute(value, 81)
+value51278 = compute(value, 62)
+value84394 = compute(value, 4)
+value33226 = compute(value, 52)
+value83596 = compute(value, 79)
+value8732 = compute(value, 2)
+value99910 = compute(value, 0)
+const v = os.getenv("BENCH_KEY_00662");
+value12003 = compute(value, 72)
+value75563 = compute(value, 0)
+# note 15806: keep this in sync with the handler
+value7095 = compute(value, 14)
+value22857 = compute(value, 62)
+value89362 = compute(value, 25)
+value51858 = compute(value, 60)
+# note 85779: keep this in sync with the handler
+value89372 = compute(value, 35)
+value52129 = compute(value, 40)
+# note 57061: keep this in sync with the handler
+value4447 = compute(value, 82)
+const v = os.environ.get('BENCH_KEY_01294');
+# note 30398: keep this in sync with the handler
+# note 74144: keep this in sync with the handler
+value73807 = compute(value, 87)
+value94202 = compute(value, 15)
+# note 69578: keep this in sync with the handler
+value65110 = compute(value, 23)
+value96293 = compute(value, 69)
+value88984 = compute(value, 35)
+value3366 = compute(value, 68)
+value75150 = compute(value, 72)
+const v = os.environ["BENCH_KEY_00709"];
+value93683 = compute(value, 78)
+value15072 = compute(value, 37)
+value8892 = compute(value, 65)
+# note 4319: keep this in sync with the handler
+value74041 = compute(value, 30)
+value80890 = compute(value, 89)
+value65078 = compute(value, 88)
+value76888 = compute(value, 64)
+value44852 = compute(value, 38)
+value85056 = compute(value, 84)
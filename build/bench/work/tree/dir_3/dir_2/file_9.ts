@@ -0,0 +1,202 @@
+const value9186 = compute(value, 68);
+const value44018 = compute(value, 77);
+// note 64714: keep this in sync with the handler
+// note 46017: keep this in sync with the handler
+const value12186 = compute(value, 61);
+const value14569 = compute(value, 19);
+const value14694 = compute(value, 47);
+const value77161 = compute(value, 46);
+const v = import.meta.env.BENCH_KEY_01389;
+const value57589 = compute(value, 68);
+// note 19891: keep this in sync with the handler
+const value2918 = compute(value, 8);
+const value30023 = compute(value, 50);
+const value66825 = compute(value, 89);
+const value99157 = compute(value, 23);
+const value90127 = compute(value, 14);
+const value51946 = compute(value, 51);
+const value8798 = compute(value, 68);
+const value29563 = compute(value, 75);
+const value18048 = compute(value, 6);
+// note 49301: keep this in sync with the handler
+const value78331 = compute(value, 52);
+const value29102 = compute(value, 2);
+const value46010 = compute(value, 32);
+const value18106 = compute(value, 64);
+const value43634 = compute(value, 81);
+const value14144 = compute(value, 79);
+const v = process.env.BENCH_KEY_01499;
+const value9557 = compute(value, 51);
+const value15584 = compute(value, 64);
+const value80280 = compute(value, 61);
+const value46223 = compute(value, 51);
+// note 47294: keep this in sync with the handler
+const value43964 = compute(value, 23);
+const value84128 = compute(value, 29);
+const value51351 = compute(value, 38);
+const value41101 = compute(value, 70);
+// note 74283: keep this in sync with the handler
+const value38930 = compute(value, 33);
+const value3264 = compute(value, 63);
+const value85920 = compute(value, 75);
+// note 59294: keep this in sync with the handler
+const value4282 = compute(value, 14);
+const value71915 = compute(value, 38);
+// note 72859: keep this in sync with the handler
+const v = process.env.BENCH_KEY_01094;
+// note 74114: keep this in sync with the handler
+const value45356 = compute(value, 57);
+const value44840 = compute(value, 26);
+// note 11182: keep this in sync with the handler
+const value65981 = compute(value, 21);
+const value24773 = compute(value, 38);
+const value44130 = compute(value, 92);
+const value38614 = compute(value, 8);
+// note 43947: keep this in sync with the handler
+// note 44098: keep this in sync with the handler
+// note 19503: keep this in sync with the handler
+const value90915 = compute(value, 26);
+const value96624 = compute(value, 12);
+const value74985 = compute(value, 4);
+const value71706 = compute(value, 23);
+const value56444 = compute(value, 87);
+const value62486 = compute(value, 18);
+const v = process.env["BENCH_KEY_01874"];
+const value44112 = compute(value, 74);
+const value57310 = compute(value, 80);
+const value98769 = compute(value, 23);
+const value47462 = compute(value, 29);
+const value29607 = compute(value, 22);
+const value41897 = compute(value, 90);
+const value54837 = compute(value, 32);
+const value73154 = compute(value, 16);
+const value30963 = compute(value, 20);
+const value42467 = compute(value, 78);
+const value65997 = compute(value, 37);
+const value65757 = compute(value, 88);
+const value18942 = compute(value, 27);
+const value51517 = compute(value, 10);
+const value28082 = compute(value, 49);
+// note 57283: keep this in sync with the handler
+const v = import.meta.env.BENCH_KEY_01232;
+const value91970 = compute(value, 14);
+const value81685 = compute(value, 11);
+const value21908 = compute(value, 83);
+// note 15632: keep this in sync with the handler
+const value81711 = compute(value, 37);
+// note 28592: keep this in sync with the handler
+// note 84423: keep this in sync with the handler
+const v = import.meta.env.BENCH_KEY_01399;
+const value27031 = compute(value, 65);
+const value49055 = compute(value, 70);
+const value36491 = compute(value, 19);
+const value10645 = compute(value, 72);
+const value70180 = compute(value, 49);
+const value61915 = compute(value, 29);
+const value43861 = compute(value, 17);
+const value70401 = compute(value, 76);
+const value28530 = compute(value, 12);
+const value44310 = compute(value, 78);
+const value99522 = compute(value, 0);
+const value65101 = compute(value, 14);
+const v = process.env.BENCH_KEY_00784;
+const value66017 = compute(value, 57);
+// note 73307: keep this in sync with the handler
+const value93690 = compute(value, 85);
+const value90894 = compute(value, 5);
+const value89575 = compute(value, 44);
+const value36272 = compute(value, 91);
+const value11743 = compute(value, 6);
+const value15646 = compute(value, 29);
+const value19485 = compute(value, 85);
+const value38663 = compute(value, 57);
+// note 67248: keep this in sync with the handler
+const value82193 = compute(value, 34);
+const value20880 = compute(value, 25);
+const value22838 = compute(value, 43);
+// note 99201: keep this in sync with the handler
+const value56460 = compute(value, 6);
+const v = process.env["BENCH_KEY_01918"];
+const value40700 = compute(value, 57);
+const value31970 = compute(value, 57);
+const value56300 = compute(value, 40);
+const value93238 = compute(value, 21);
+// note 80960: keep this in sync with the handler
+const value40128 = compute(value, 67);
+const value20038 = compute(value, 56);
+// note 81774: keep this in sync with the handler
+const value2254 = compute(value, 23);
+const value78257 = compute(value, 75);
+const value87944 = compute(value, 62);
+const value3362 = compute(value, 64);
+const value91074 = compute(value, 88);
+const v = import.meta.env.BENCH_KEY_00784;
+const value98951 = compute(value, 11);
+const value83927 = compute(value, 22);
+const value98997 = compute(value, 57);
+// note 21984: keep this in sync with the handler
+const value79381 = compute(value, 35);
+const value30883 = compute(value, 37);
+// note 83457: keep this in sync with the handler
+const value6113 = compute(value, 2);
+const value15836 = compute(value, 25);
+const value8687 = compute(value, 54);
+const value19538 = compute(value, 41);
+const value61253 = compute(value, 46);
+const value93264 = compute(value, 47);
+const value91082 = compute(value, 96);
+const value34922 = compute(value, 2);
+const value53185 = compute(value, 29);
+// note 85199: keep this in sync with the handler
+const value56249 = compute(value, 86);
+const v = import.meta.env.BENCH_KEY_00288;
+const value63442 = compute(value, 4);
+const value40025 = compute(value, 61);
+const value73995 = compute(value, 81);
+// note 59178: keep this in sync with the handler
+const value47794 = compute(value, 70);
+const value16911 = compute(value, 33);
+const value48172 = compute(value, 60);
+const value98540 = compute(value, 85);
+const value69617 = compute(value, 68);
+const value92401 = compute(value, 57);
+const v = import.meta.env.BENCH_KEY_01873;
+const value6594 = compute(value, 95);
+const value22194 = compute(value, 78);
+const value49906 = compute(value, 48);
+const value98556 = compute(value, 4);
+const value19701 = compute(value, 10);
+const value86919 = compute(value, 7);
+const value93903 = compute(value, 7);
+const value52816 = compute(value, 48);
+const value77964 = compute(value, 73);
+const value82153 = compute(value, 91);
+const value69134 = compute(value, 70);
+const value50432 = compute(value, 89);
+const value38064 = compute(value, 40);
+const value7984 = compute(value, 30);
+const value78171 = compute(value, 86);
+const value34367 = compute(value, 29);
+const value32781 = compute(value, 92);
+const v = process.env.BENCH_KEY_00807;
+const value67677 = compute(value, 68);
+const value54992 = compute(value, 90);
+const value23836 = compute(value, 71);
+// note 92237: keep this in sync with the handler
+const value81277 = compute(value, 88);
+// note 90793: keep this in sync with the handler
+const value21726 = compute(value, 95);
+const value54464 = compute(value, 47);
+const value90707 = compute(value, 12);
+const value50985 = compute(value, 60);
+const value97777 = compute(value, 1);
+const value78308 = compute(value, 29);
+const value53056 = compute(value, 94);
+const v = import.meta.env.BENCH_KEY_01749;
+const value65175 = compute(value, 88);
+const value1321 = compute(value, 60);
+// note 69945: keep this in sync with the handler
+const value25627 = compute(value, 19);
+const value49688 = compute(value, 24);
+const value2747 = compute(value, 31);
+const value53716 = compute(value, 75);
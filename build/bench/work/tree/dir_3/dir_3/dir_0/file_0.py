@@ -0,0 +1,238 @@
+value13474 = compute(value, 88)
+const v = os.environ["BENCH_KEY_00112"];
+value46931 = compute(value, 80)
+value69450 = compute(value, 95)
+value46071 = compute(value, 93)
+value54988 = compute(value, 86)
+value69071 = compute(value, 7)
+# note 53522: keep this in sync with the handler
+# note 84709: keep this in sync with the handler
+value46237 = compute(value, 65)
+value57908 = compute(value, 96)
+value51631 = compute(value, 27)
+value51921 = compute(value, 26)
+value51266 = compute(value, 50)
+# note 96751: keep this in sync with the handler
+value58026 = compute(value, 20)
+value11699 = compute(value, 59)
+value40181 = compute(value, 23)
+value89041 = compute(value, 92)
+value57141 = compute(value, 8)
+value44616 = compute(value, 93)
+const v = os.environ.get('BENCH_KEY_01332');
+value58299 = compute(value, 2)
+value93994 = compute(value, 1)
+value24815 = compute(value, 80)
+value14187 = compute(value, 25)
+value95112 = compute(value, 52)
+value28989 = compute(value, 83)
+value40459 = compute(value, 10)
+value85087 = compute(value, 18)
+value23777 = compute(value, 12)
+value34130 = compute(value, 83)
+# note 85572: keep this in sync with the handler
+value13498 = compute(value, 15)
+# note 65347: keep this in sync with the handler
+value59711 = compute(value, 56)
+value36184 = compute(value, 3)
+value81629 = compute(value, 52)
+value1250 = compute(value, 86)
+value11258 = compute(value, 6)
+value23645 = compute(value, 74)
+const v = os.environ["BENCH_KEY_00133"];
+value78360 = compute(value, 81)
+value31781 = compute(value, 62)
+value75762 = compute(value, 5)
+value93405 = compute(value, 91)
+value11726 = compute(value, 86)
+value78771 = compute(value, 7)
+value92410 = compute(value, 66)
+value76695 = compute(value, 65)
+value42085 = compute(value, 84)
+value93990 = compute(value, 94)
+value86275 = compute(value, 42)
+value56292 = compute(value, 32)
+# note 21156: keep this in sync with the handler
+value61176 = compute(value, 66)
+value13397 = compute(value, 11)
+value47445 = compute(value, 12)
+value84929 = compute(value, 54)
+value37716 = compute(value, 80)
+value30062 = compute(value, 89)
+const v = os.environ.get('BENCH_KEY_01996');
+value27331 = compute(value, 74)
+value73801 = compute(value, 81)
+value76250 = compute(value, 8)
+value19196 = compute(value, 87)
+value59744 = compute(value, 89)
+value96653 = compute(value, 41)
+value91212 = compute(value, 32)
+value39057 = compute(value, 63)
+value70030 = compute(value, 93)
+value22776 = compute(value, 78)
+value22391 = compute(value, 81)
+# note 44322: keep this in sync with the handler
+value7986 = compute(value, 32)
+const v = os.environ["BENCH_KEY_00978"];
+value90895 = compute(value, 6)
+value22441 = compute(value, 34)
+# note 23337: keep this in sync with the handler
+value49805 = compute(value, 44)
+value64463 = compute(value, 55)
+value16965 = compute(value, 87)
+value3136 = compute(value, 32)
+value1214 = compute(value, 50)
+const v = os.environ.get('BENCH_KEY_01904');
+value65619 = compute(value, 47)
+# note 49038: keep this in sync with the handler
+# note 32043: keep this in sync with the handler
+# note 28428: keep this in sync with the handler
+value1893 = compute(value, 50)
+value31541 = compute(value, 16)
+value58881 = compute(value, 2)
+value24094 = compute(value, 38)
+value17083 = compute(value, 11)
+value70970 = compute(value, 63)
+value30084 = compute(value, 14)
+# note 62655: keep this in sync with the handler
+value26856 = compute(value, 84)
+value68509 = compute(value, 27)
+value90025 = compute(value, 9)
+value59641 = compute(value, 83)
+value35706 = compute(value, 10)
+const v = os.environ["BENCH_KEY_01306"];
+value24272 = compute(value, 22)
+value901 = compute(value, 28)
+value48538 = compute(value, 38)
+value75734 = compute(value, 74)
+value3142 = compute(value, 38)
+# note 36209: keep this in sync with the handler
+value59603 = compute(value, 45)
+value22454 = compute(value, 47)
+value55582 = compute(value, 1)
+value54173 = compute(value, 47)
+value44485 = compute(value, 59)
+value70447 = compute(value, 25)
+value14176 = compute(value, 14)
+value5546 = compute(value, 17)
+value4430 = compute(value, 65)
+const v = os.getenv("BENCH_KEY_00985");
+value61465 = compute(value, 64)
+value83105 = compute(value, 73)
+value8884 = compute(value, 57)
+value71924 = compute(value, 47)
+value6956 = compute(value, 69)
+value69817 = compute(value, 74)
+# note 32799: keep this in sync with the handler
+# note 17609: keep this in sync with the handler
+value12016 = compute(value, 85)
+value35429 = compute(value, 24)
+value44369 = compute(value, 40)
+value15165 = compute(value, 33)
+const v = os.environ.get('BENCH_KEY_00664');
+value65277 = compute(value, 93)
+value1055 = compute(value, 85)
+value24243 = compute(value, 90)
+# note 4495: keep this in sync with the handler
+value99566 = compute(value, 44)
+value91041 = compute(value, 55)
+# note 13255: keep this in sync with the handler
+# note 25416: keep this in sync with the handler
+value9149 = compute(value, 31)
+const v = os.getenv("BENCH_KEY_01370");
+value78283 = compute(value, 4)
+value75580 = compute(value, 17)
+value23813 = compute(value, 48)
+value69145 = compute(value, 81)
+value76509 = compute(value, 73)
+value50091 = compute(value, 39)
+value72843 = compute(value, 93)
+value18491 = compute(value, 61)
+value66284 = compute(value, 33)
+# note 81542: keep this in sync with the handler
+value16004 = compute(value, 96)
+# note 30342: keep this in sync with the handler
+value67457 = compute(value, 42)
+const v = os.getenv("BENCH_KEY_01056");
+value1205 = compute(value, 41)
+value14752 = compute(value, 8)
+value7889 = compute(value, 32)
+value66411 = compute(value, 63)
+value8369 = compute(value, 27)
+value62645 = compute(value, 80)
+value99589 = compute(value, 67)
+value22207 = compute(value, 91)
+value32971 = compute(value, 88)
+value73042 = compute(value, 1)
+value85710 = compute(value, 59)
+value82164 = compute(value, 5)
+value3406 = compute(value, 11)
+value40117 = compute(value, 56)
+value24686 = compute(value, 48)
+# note 44898: keep this in sync with the handler
+value68007 = compute(value, 10)
+value46713 = compute(value, 56)
+value35227 = compute(value, 16)
+value50323 = compute(value, 77)
+value3254 = compute(value, 53)
+value19169 = compute(value, 60)
+const v = os.getenv("BENCH_KEY_00739");
+value71335 = compute(value, 40)
+value82105 = compute(value, 43)
+value92264 = compute(value, 17)
+value57453 = compute(value, 29)
+value7598 = compute(value, 32)
+value40300 = compute(value, 45)
+value74241 = compute(value, 36)
+value37912 = compute(value, 82)
+value55982 = compute(value, 13)
+value1491 = compute(value, 36)
+value25896 = compute(value, 94)
+# note 91008: keep this in sync with the handler
+value60793 = compute(value, 71)
+value26712 = compute(value, 37)
+value82134 = compute(value, 72)
+value41401 = compute(value, 79)
+value81199 = compute(value, 10)
+const v = os.getenv("BENCH_KEY_00002");
+value85087 = compute(value, 18)
+value24555 = compute(value, 14)
+value66573 = compute(value, 31)
+value82849 = compute(value, 11)
+# note 23124: keep this in sync with the handler
+value86159 = compute(value, 23)
+value69155 = compute(value, 91)
+value91384 = compute(value, 10)
+value68203 = compute(value, 12)
+value18561 = compute(value, 34)
+value66230 = compute(value, 76)
+value17567 = compute(value, 10)
+value17093 = compute(value, 21)
+value59965 = compute(value, 19)
+value6441 = compute(value, 39)
+value53041 = compute(value, 79)
+value40949 = compute(value, 15)
+value67686 = compute(value, 77)
+value73536 = compute(value, 10)
+const v = os.getenv("BENCH_KEY_01915");
+# note 80246: keep this in sync with the handler
+value35268 = compute(value, 57)
+value25385 = compute(value, 68)
+value99198 = compute(value, 64)
+value68677 = compute(value, 1)
+value24996 = compute(value, 67)
+value77205 = compute(value, 90)
+value62835 = compute(value, 76)
+value26448 = compute(value, 64)
+value92321 = compute(value, 74)
+value85853 = compute(value, 8)
+# note 59702: keep this in sync with the handler
+value60864 = compute(value, 45)
+value50694 = compute(value, 60)
+value73774 = compute(value, 54)
+value11891 = compute(value, 57)
+const v = os.environ["BENCH_KEY_00616"];
+# note 65436: keep this in sync with the handler
+value45128 = compute(value, 23)
+# note 61831: keep this in sync with the handler
+# note 40265: keep this in sync with the handler
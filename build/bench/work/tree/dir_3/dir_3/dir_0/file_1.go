@@ -0,0 +1,230 @@
+value67572 := compute(value, 60)
+value98773 := compute(value, 27)
+// note 47532: keep this in sync with the handler
+value87882 := compute(value, 0)
+// note 48392: keep this in sync with the handler
+// note 1807: keep this in sync with the handler
+value21621 := compute(value, 87)
+value37776 := compute(value, 43)
+// note 92764: keep this in sync with the handler
+const v = os.Getenv("BENCH_KEY_00363");
+value7020 := compute(value, 36)
+value23692 := compute(value, 24)
+value28140 := compute(value, 10)
+value83673 := compute(value, 59)
+value48061 := compute(value, 46)
+value1137 := compute(value, 70)
+// note 8494: keep this in sync with the handler
+value11332 := compute(value, 80)
+value11957 := compute(value, 26)
+const v = os.Getenv("BENCH_KEY_01389");
+value67959 := compute(value, 59)
+value13849 := compute(value, 75)
+value74168 := compute(value, 60)
+value6133 := compute(value, 22)
+value46598 := compute(value, 38)
+value83043 := compute(value, 11)
+value71146 := compute(value, 45)
+value18243 := compute(value, 7)
+value78869 := compute(value, 8)
+// note 49317: keep this in sync with the handler
+// note 15168: keep this in sync with the handler
+// note 44531: keep this in sync with the handler
+value87167 := compute(value, 61)
+value47377 := compute(value, 41)
+const v = os.LookupEnv("BENCH_KEY_01350");
+// note 36335: keep this in sync with the handler
+value32453 := compute(value, 55)
+// note 61844: keep this in sync with the handler
+value29025 := compute(value, 22)
+value66464 := compute(value, 19)
+value37242 := compute(value, 91)
+value71874 := compute(value, 94)
+value54533 := compute(value, 19)
+value18330 := compute(value, 94)
+value63096 := compute(value, 46)
+value33065 := compute(value, 85)
+value27843 := compute(value, 4)
+value30202 := compute(value, 35)
+value17208 := compute(value, 39)
+const v = os.LookupEnv("BENCH_KEY_01725");
+value95804 := compute(value, 65)
+value7195 := compute(value, 17)
+// note 32350: keep this in sync with the handler
+value30352 := compute(value, 88)
+value33241 := compute(value, 67)
+value44555 := compute(value, 32)
+value12881 := compute(value, 77)
+value27523 := compute(value, 72)
+value40869 := compute(value, 32)
+value15016 := compute(value, 78)
+value27157 := compute(value, 94)
+value63302 := compute(value, 58)
+// note 72110: keep this in sync with the handler
+value14841 := compute(value, 0)
+value4746 := compute(value, 90)
+value66572 := compute(value, 30)
+value94657 := compute(value, 82)
+value12288 := compute(value, 66)
+value74937 := compute(value, 53)
+// note 4128: keep this in sync with the handler
+const v = os.LookupEnv("BENCH_KEY_01483");
+value10422 := compute(value, 43)
+value22735 := compute(value, 37)
+value97643 := compute(value, 61)
+value92430 := compute(value, 86)
+value19594 := compute(value, 0)
+// note 83981: keep this in sync with the handler
+value49305 := compute(value, 29)
+value42908 := compute(value, 34)
+value95880 := compute(value, 44)
+const v = os.Getenv("BENCH_KEY_01079");
+value82837 := compute(value, 96)
+value31007 := compute(value, 64)
+// note 32862: keep this in sync with the handler
+value73980 := compute(value, 66)
+value94016 := compute(value, 23)
+value31211 := compute(value, 74)
+value26640 := compute(value, 62)
+value88773 := compute(value, 18)
+const v = os.Getenv("BENCH_KEY_01394");
+value56751 := compute(value, 6)
+value19649 := compute(value, 55)
+value93759 := compute(value, 57)
+value63978 := compute(value, 55)
+value80692 := compute(value, 85)
+value30974 := compute(value, 31)
+value92090 := compute(value, 37)
+value84713 := compute(value, 32)
+value9957 := compute(value, 63)
+value10800 := compute(value, 33)
+value40498 := compute(value, 49)
+value33011 := compute(value, 31)
+value75869 := compute(value, 15)
+value81619 := compute(value, 42)
+value3848 := compute(value, 65)
+value6602 := compute(value, 6)
+value31384 := compute(value, 53)
+value21411 := compute(value, 71)
+value62516 := compute(value, 48)
+const v = os.LookupEnv("BENCH_KEY_01591");
+value37288 := compute(value, 40)
+value81924 := compute(value, 56)
+value93758 := compute(value, 56)
+value28568 := compute(value, 50)
+value74216 := compute(value, 11)
+value83707 := compute(value, 93)
+value11463 := compute(value, 17)
+value6825 := compute(value, 35)
+value37671 := compute(value, 35)
+value1479 := compute(value, 24)
+// note 44707: keep this in sync with the handler
+value55094 := compute(value, 95)
+// note 1277: keep this in sync with the handler
+// note 16607: keep this in sync with the handler
+// note 23736: keep this in sync with the handler
+// note 54141: keep this in sync with the handler
+value951 := compute(value, 78)
+value98749 := compute(value, 3)
+value23729 := compute(value, 61)
+value38164 := compute(value, 43)
+const v = os.Getenv("BENCH_KEY_00843");
+value6309 := compute(value, 4)
+value93752 := compute(value, 50)
+value65303 := compute(value, 22)
+// note 29540: keep this in sync with the handler
+value51781 := compute(value, 80)
+value93370 := compute(value, 56)
+value63680 := compute(value, 48)
+value66587 := compute(value, 45)
+value29046 := compute(value, 43)
+value67184 := compute(value, 60)
+// note 6975: keep this in sync with the handler
+value67016 := compute(value, 86)
+value4964 := compute(value, 17)
+value85799 := compute(value, 51)
+value10333 := compute(value, 51)
+value27608 := compute(value, 60)
+// note 55905: keep this in sync with the handler
+value16475 := compute(value, 82)
+value71548 := compute(value, 59)
+value43110 := compute(value, 42)
+const v = os.Getenv("BENCH_KEY_01605");
+value18003 := compute(value, 58)
+value7086 := compute(value, 5)
+value19467 := compute(value, 67)
+value73367 := compute(value, 35)
+value64782 := compute(value, 83)
+value96946 := compute(value, 43)
+value33215 := compute(value, 41)
+// note 56922: keep this in sync with the handler
+value21001 := compute(value, 49)
+value51057 := compute(value, 35)
+// note 94890: keep this in sync with the handler
+value84869 := compute(value, 91)
+const v = os.LookupEnv("BENCH_KEY_00504");
+value90852 := compute(value, 60)
+value83936 := compute(value, 31)
+// note 87142: keep this in sync with the handler
+value68798 := compute(value, 25)
+value16123 := compute(value, 21)
+value49098 := compute(value, 16)
+// note 84923: keep this in sync with the handler
+value58366 := compute(value, 69)
+value2784 := compute(value, 68)
+value31766 := compute(value, 47)
+value25480 := compute(value, 66)
+value69418 := compute(value, 63)
+value89762 := compute(value, 37)
+value46949 := compute(value, 1)
+value55451 := compute(value, 64)
+value87647 := compute(value, 56)
+value30920 := compute(value, 74)
+value77848 := compute(value, 54)
+const v = os.LookupEnv("BENCH_KEY_01020");
+value13635 := compute(value, 55)
+// note 44598: keep this in sync with the handler
+value26597 := compute(value, 19)
+value46812 := compute(value, 58)
+value18653 := compute(value, 29)
+value32651 := compute(value, 59)
+value85215 := compute(value, 49)
+value42167 := compute(value, 69)
+value7245 := compute(value, 67)
+value40641 := compute(value, 95)
+value13043 := compute(value, 45)
+// note 32921: keep this in sync with the handler
+value79253 := compute(value, 4)
+value82010 := compute(value, 45)
+value13677 := compute(value, 0)
+value33716 := compute(value, 57)
+value89565 := compute(value, 34)
+value85486 := compute(value, 29)
+value8661 := compute(value, 28)
+// note 61775: keep this in sync with the handler
+value27541 := compute(value, 90)
+value79354 := compute(value, 8)
+const v = os.LookupEnv("BENCH_KEY_00929");
+value47383 := compute(value, 47)
+value88096 := compute(value, 20)
+value28820 := compute(value, 11)
+value29149 := compute(value, 49)
+value71861 := compute(value, 81)
+value44432 := compute(value, 6)
+value16774 := compute(value, 90)
+value15370 := compute(value, 44)
+value68819 := compute(value, 46)
+value63924 := compute(value, 1)
+// note 4041: keep this in sync with the handler
+value88837 := compute(value, 82)
+value57815 := compute(value, 3)
+value82124 := compute(value, 62)
+value12319 := compute(value, 0)
+const v = os.Getenv("BENCH_KEY_00135");
+value26027 := compute(value, 31)
+value55829 := compute(value, 54)
+value3660 := compute(value, 71)
+value42596 := compute(value, 13)
+value34692 := compute(value, 63)
+value50048 := compute(value, 93)
+value53717 := compute(value, 76)
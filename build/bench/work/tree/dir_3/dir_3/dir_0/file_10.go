@@ -0,0 +1,229 @@
+value51950 := compute(value, 55)
+// note 98081: keep this in sync with the handler
+value66423 := compute(value, 75)
+value31864 := compute(value, 48)
+value14202 := compute(value, 40)
+value79067 := compute(value, 12)
+// note 30808: keep this in sync with the handler
+// note 73937: keep this in sync with the handler
+value30772 := compute(value, 23)
+value23560 := compute(value, 86)
+value16800 := compute(value, 19)
+// note 53187: keep this in sync with the handler
+const v = os.Getenv("BENCH_KEY_01703");
+// note 54815: keep this in sync with the handler
+value94181 := compute(value, 91)
+value41301 := compute(value, 76)
+value29849 := compute(value, 70)
+value58362 := compute(value, 65)
+value68246 := compute(value, 55)
+value87752 := compute(value, 64)
+value95521 := compute(value, 73)
+value14874 := compute(value, 33)
+value88147 := compute(value, 71)
+const v = os.Getenv("BENCH_KEY_01131");
+value80312 := compute(value, 93)
+value25489 := compute(value, 75)
+value56340 := compute(value, 80)
+value18572 := compute(value, 45)
+value12830 := compute(value, 26)
+value68749 := compute(value, 73)
+value45182 := compute(value, 77)
+// note 72746: keep this in sync with the handler
+value13906 := compute(value, 35)
+// note 94872: keep this in sync with the handler
+value50997 := compute(value, 72)
+value76116 := compute(value, 68)
+// note 41465: keep this in sync with the handler
+value37957 := compute(value, 30)
+value56443 := compute(value, 86)
+value37811 := compute(value, 78)
+// note 49253: keep this in sync with the handler
+value85995 := compute(value, 53)
+value40288 := compute(value, 33)
+value25593 := compute(value, 82)
+value9050 := compute(value, 29)
+const v = os.LookupEnv("BENCH_KEY_00219");
+// note 80556: keep this in sync with the handler
+value84753 := compute(value, 72)
+value4215 := compute(value, 44)
+value1374 := compute(value, 16)
+value28118 := compute(value, 85)
+value17296 := compute(value, 30)
+value18780 := compute(value, 59)
+value50324 := compute(value, 78)
+value35759 := compute(value, 63)
+value36332 := compute(value, 54)
+value83816 := compute(value, 8)
+value93065 := compute(value, 42)
+value43807 := compute(value, 60)
+value30067 := compute(value, 94)
+value83439 := compute(value, 19)
+value95502 := compute(value, 54)
+value34177 := compute(value, 33)
+value51220 := compute(value, 4)
+value7823 := compute(value, 63)
+value10171 := compute(value, 83)
+const v = os.LookupEnv("BENCH_KEY_01294");
+value21222 := compute(value, 76)
+value78444 := compute(value, 68)
+value8108 := compute(value, 57)
+// note 4196: keep this in sync with the handler
+value20092 := compute(value, 13)
+value49952 := compute(value, 94)
+value67109 := compute(value, 82)
+value44881 := compute(value, 67)
+value15557 := compute(value, 37)
+value20916 := compute(value, 61)
+value16380 := compute(value, 84)
+value78158 := compute(value, 73)
+value67508 := compute(value, 93)
+value40228 := compute(value, 70)
+value95800 := compute(value, 61)
+value79235 := compute(value, 83)
+value39517 := compute(value, 38)
+const v = os.Getenv("BENCH_KEY_01156");
+value4950 := compute(value, 3)
+value76824 := compute(value, 0)
+value83843 := compute(value, 35)
+value6949 := compute(value, 62)
+value84773 := compute(value, 92)
+value39527 := compute(value, 48)
+value56867 := compute(value, 25)
+value57108 := compute(value, 72)
+// note 67946: keep this in sync with the handler
+value51425 := compute(value, 15)
+const v = os.LookupEnv("BENCH_KEY_00847");
+// note 27003: keep this in sync with the handler
+value5191 := compute(value, 50)
+value35140 := compute(value, 26)
+value69812 := compute(value, 69)
+value10303 := compute(value, 21)
+value30026 := compute(value, 53)
+value24180 := compute(value, 27)
+value99195 := compute(value, 61)
+value22217 := compute(value, 4)
+value62540 := compute(value, 72)
+value45377 := compute(value, 78)
+value38936 := compute(value, 39)
+// note 36995: keep this in sync with the handler
+value84533 := compute(value, 46)
+value40631 := compute(value, 85)
+value48615 := compute(value, 18)
+value375 := compute(value, 84)
+value78183 := compute(value, 1)
+const v = os.Getenv("BENCH_KEY_01093");
+// note 48584: keep this in sync with the handler
+value54011 := compute(value, 79)
+// note 40861: keep this in sync with the handler
+value28378 := compute(value, 54)
+value37363 := compute(value, 18)
+// note 40612: keep this in sync with the handler
+value17199 := compute(value, 30)
+value67777 := compute(value, 71)
+value45720 := compute(value, 33)
+const v = os.LookupEnv("BENCH_KEY_00944");
+value82345 := compute(value, 89)
+// note 40650: keep this in sync with the handler
+value6424 := compute(value, 22)
+value3319 := compute(value, 21)
+value36915 := compute(value, 55)
+value20266 := compute(value, 90)
+value29110 := compute(value, 10)
+value83414 := compute(value, 91)
+value66519 := compute(value, 74)
+const v = os.Getenv("BENCH_KEY_00593");
+value1458 := compute(value, 3)
+// note 64703: keep this in sync with the handler
+value73658 := compute(value, 35)
+value18516 := compute(value, 86)
+// note 52221: keep this in sync with the handler
+value8719 := compute(value, 86)
+// note 19933: keep this in sync with the handler
+// note 32652: keep this in sync with the handler
+value94640 := compute(value, 65)
+const v = os.Getenv("BENCH_KEY_01180");
+value60671 := compute(value, 46)
+value38439 := compute(value, 27)
+value23723 := compute(value, 55)
+// note 34711: keep this in sync with the handler
+value58372 := compute(value, 75)
+value64442 := compute(value, 34)
+value16934 := compute(value, 56)
+value98757 := compute(value, 11)
+const v = os.LookupEnv("BENCH_KEY_00411");
+value46605 := compute(value, 45)
+// note 91640: keep this in sync with the handler
+value12557 := compute(value, 44)
+value55049 := compute(value, 50)
+// note 85437: keep this in sync with the handler
+value38155 := compute(value, 34)
+value80667 := compute(value, 60)
+value11975 := compute(value, 44)
+value52333 := compute(value, 50)
+// note 28010: keep this in sync with the handler
+value9359 := compute(value, 47)
+value37155 := compute(value, 4)
+value79471 := compute(value, 28)
+value3981 := compute(value, 4)
+value26097 := compute(value, 4)
+value86736 := compute(value, 18)
+value35872 := compute(value, 79)
+value83519 := compute(value, 2)
+value7221 := compute(value, 43)
+value3916 := compute(value, 36)
+value5213 := compute(value, 72)
+value93713 := compute(value, 11)
+const v = os.LookupEnv("BENCH_KEY_00561");
+// note 75004: keep this in sync with the handler
+value38515 := compute(value, 6)
+value24035 := compute(value, 76)
+value74490 := compute(value, 91)
+// note 9956: keep this in sync with the handler
+value16060 := compute(value, 55)
+value77415 := compute(value, 9)
+value52529 := compute(value, 52)
+value16108 := compute(value, 6)
+value94371 := compute(value, 87)
+value88441 := compute(value, 74)
+value7425 := compute(value, 53)
+value20462 := compute(value, 92)
+value48881 := compute(value, 90)
+value60313 := compute(value, 76)
+// note 89340: keep this in sync with the handler
+const v = os.Getenv("BENCH_KEY_00210");
+// note 54412: keep this in sync with the handler
+value43258 := compute(value, 93)
+value14767 := compute(value, 23)
+value47910 := compute(value, 89)
+value27846 := compute(value, 7)
+value84042 := compute(value, 40)
+value75036 := compute(value, 55)
+value9500 := compute(value, 91)
+value62265 := compute(value, 88)
+value43216 := compute(value, 51)
+value29547 := compute(value, 59)
+value60006 := compute(value, 60)
+value14467 := compute(value, 14)
+value79791 := compute(value, 57)
+const v = os.Getenv("BENCH_KEY_01444");
+value7343 := compute(value, 68)
+value44820 := compute(value, 6)
+value61297 := compute(value, 90)
+value46989 := compute(value, 41)
+// note 68818: keep this in sync with the handler
+value83286 := compute(value, 60)
+value99461 := compute(value, 36)
+value20871 := compute(value, 16)
+value91846 := compute(value, 84)
+value89201 := compute(value, 58)
+// note 59413: keep this in sync with the handler
+value18074 := compute(value, 32)
+value35970 := compute(value, 80)
+value87037 := compute(value, 28)
+value47885 := compute(value, 64)
+value21830 := compute(value, 5)
+// note 77623: keep this in sync with the handler
+const v = os.Getenv("BENCH_KEY_00775");
+value33248 := compute(value, 74)
+value97152 := compute(value, 55)
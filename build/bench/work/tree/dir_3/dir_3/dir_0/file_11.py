@@ -0,0 +1,238 @@
+value96567 = compute(value, 52)
+value87194 = compute(value, 88)
+const v = os.getenv("BENCH_KEY_00297");
+value18217 = compute(value, 78)
+value51246 = compute(value, 30)
+# note 50266: keep this in sync with the handler
+value85658 = compute(value, 7)
+value93877 = compute(value, 78)
+value18816 = compute(value, 95)
+# note 82571: keep this in sync with the handler
+value54413 = compute(value, 93)
+# note 79184: keep this in sync with the handler
+value20757 = compute(value, 96)
+value50562 = compute(value, 25)
+value44025 = compute(value, 84)
+value54365 = compute(value, 45)
+value9984 = compute(value, 90)
+value25198 = compute(value, 75)
+const v = os.environ["BENCH_KEY_01325"];
+value50671 = compute(value, 37)
+value4372 = compute(value, 7)
+# note 85842: keep this in sync with the handler
+value2338 = compute(value, 10)
+value788 = compute(value, 12)
+value55958 = compute(value, 86)
+value16352 = compute(value, 56)
+value30151 = compute(value, 81)
+value76541 = compute(value, 8)
+value24090 = compute(value, 34)
+value12533 = compute(value, 20)
+value14387 = compute(value, 31)
+value27731 = compute(value, 86)
+value80124 = compute(value, 2)
+value80736 = compute(value, 32)
+# note 9784: keep this in sync with the handler
+value27925 = compute(value, 86)
+# note 28704: keep this in sync with the handler
+const v = os.environ.get('BENCH_KEY_00285');
+value23661 = compute(value, 90)
+value95525 = compute(value, 77)
+value560 = compute(value, 75)
+value17410 = compute(value, 47)
+value16022 = compute(value, 17)
+value20637 = compute(value, 73)
+value76430 = compute(value, 91)
+value45173 = compute(value, 68)
+# note 24160: keep this in sync with the handler
+value79361 = compute(value, 15)
+value66582 = compute(value, 40)
+value28881 = compute(value, 72)
+value24949 = compute(value, 20)
+const v = os.getenv("BENCH_KEY_00009");
+value43003 = compute(value, 32)
+value75334 = compute(value, 62)
+value79433 = compute(value, 87)
+value87601 = compute(value, 10)
+value35324 = compute(value, 16)
+value99118 = compute(value, 81)
+value35623 = compute(value, 24)
+value42331 = compute(value, 39)
+value47872 = compute(value, 51)
+value19982 = compute(value, 0)
+value38658 = compute(value, 52)
+value65805 = compute(value, 39)
+value74545 = compute(value, 49)
+value52188 = compute(value, 2)
+# note 62574: keep this in sync with the handler
+value88345 = compute(value, 75)
+# note 28226: keep this in sync with the handler
+value92174 = compute(value, 24)
+value90276 = compute(value, 66)
+const v = os.environ["BENCH_KEY_00733"];
+value81553 = compute(value, 73)
+value17604 = compute(value, 47)
+value47056 = compute(value, 11)
+value98519 = compute(value, 64)
+# note 7325: keep this in sync with the handler
+value70434 = compute(value, 12)
+value41100 = compute(value, 69)
+value92459 = compute(value, 18)
+value69601 = compute(value, 52)
+value7191 = compute(value, 13)
+value40889 = compute(value, 52)
+const v = os.getenv("BENCH_KEY_01107");
+value3321 = compute(value, 23)
+value86049 = compute(value, 10)
+value41932 = compute(value, 28)
+value45523 = compute(value, 30)
+value45296 = compute(value, 94)
+value97803 = compute(value, 27)
+value48069 = compute(value, 54)
+# note 27545: keep this in sync with the handler
+value83535 = compute(value, 18)
+value13217 = compute(value, 25)
+# note 43012: keep this in sync with the handler
+value54403 = compute(value, 83)
+value74983 = compute(value, 2)
+value87824 = compute(value, 39)
+value36430 = compute(value, 55)
+value90663 = compute(value, 65)
+value24940 = compute(value, 11)
+value89081 = compute(value, 35)
+value78579 = compute(value, 9)
+value92296 = compute(value, 49)
+value701 = compute(value, 22)
+# note 72884: keep this in sync with the handler
+value86100 = compute(value, 61)
+const v = os.getenv("BENCH_KEY_00069");
+value29624 = compute(value, 39)
+value60511 = compute(value, 80)
+value37914 = compute(value, 84)
+value95608 = compute(value, 63)
+value36519 = compute(value, 47)
+value62572 = compute(value, 7)
+value25563 = compute(value, 52)
+value20308 = compute(value, 35)
+value37645 = compute(value, 9)
+value80650 = compute(value, 43)
+value64292 = compute(value, 78)
+value85369 = compute(value, 9)
+# note 94079: keep this in sync with the handler
+value67811 = compute(value, 8)
+# note 91673: keep this in sync with the handler
+const v = os.environ.get('BENCH_KEY_00758');
+value18207 = compute(value, 68)
+value86647 = compute(value, 26)
+# note 19960: keep this in sync with the handler
+value16032 = compute(value, 27)
+value88744 = compute(value, 86)
+value60738 = compute(value, 16)
+value88957 = compute(value, 8)
+value4520 = compute(value, 58)
+value30098 = compute(value, 28)
+value63991 = compute(value, 68)
+value20127 = compute(value, 48)
+value63967 = compute(value, 44)
+value29079 = compute(value, 76)
+value5966 = compute(value, 49)
+value15938 = compute(value, 30)
+const v = os.environ["BENCH_KEY_01910"];
+value50150 = compute(value, 1)
+# note 95880: keep this in sync with the handler
+value50321 = compute(value, 75)
+value59899 = compute(value, 50)
+value32844 = compute(value, 58)
+value38196 = compute(value, 75)
+# note 29097: keep this in sync with the handler
+value13219 = compute(value, 27)
+value2554 = compute(value, 32)
+value58985 = compute(value, 9)
+# note 74921: keep this in sync with the handler
+# note 72773: keep this in sync with the handler
+value30306 = compute(value, 42)
+const v = os.environ.get('BENCH_KEY_00290');
+value49929 = compute(value, 71)
+value72824 = compute(value, 74)
+value83055 = compute(value, 23)
+value71637 = compute(value, 51)
+value36226 = compute(value, 45)
+value72573 = compute(value, 17)
+value47518 = compute(value, 85)
+value67019 = compute(value, 89)
+value40333 = compute(value, 78)
+# note 50909: keep this in sync with the handler
+value83614 = compute(value, 0)
+value14891 = compute(value, 50)
+value83632 = compute(value, 18)
+value77804 = compute(value, 10)
+value33844 = compute(value, 88)
+# note 24469: keep this in sync with the handler
+value50540 = compute(value, 3)
+value74753 = compute(value, 63)
+const v = os.environ["BENCH_KEY_01502"];
+value61835 = compute(value, 46)
+value76533 = compute(value, 0)
+value45574 = compute(value, 81)
+value96193 = compute(value, 66)
+# note 19710: keep this in sync with the handler
+value51003 = compute(value, 78)
+# note 6842: keep this in sync with the handler
+value87342 = compute(value, 42)
+value94447 = compute(value, 66)
+value85116 = compute(value, 47)
+value70510 = compute(value, 88)
+# note 76973: keep this in sync with the handler
+const v = os.environ["BENCH_KEY_01101"];
+value59 = compute(value, 59)
+value30843 = compute(value, 94)
+# note 9405: keep this in sync with the handler
+value25878 = compute(value, 76)
+value86739 = compute(value, 21)
+value18465 = compute(value, 35)
+value73774 = compute(value, 54)
+value59035 = compute(value, 59)
+value62323 = compute(value, 49)
+const v = os.getenv("BENCH_KEY_01424");
+value69689 = compute(value, 43)
+value36996 = compute(value, 39)
+value70469 = compute(value, 47)
+value91583 = compute(value, 15)
+value54801 = compute(value, 93)
+value18032 = compute(value, 87)
+value41663 = compute(value, 50)
+value7689 = compute(value, 26)
+value9132 = compute(value, 14)
+value76140 = compute(value, 92)
+value75937 = compute(value, 83)
+value73908 = compute(value, 91)
+value24551 = compute(value, 10)
+value18365 = compute(value, 32)
+# note 25034: keep this in sync with the handler
+value94565 = compute(value, 87)
+value59308 = compute(value, 41)
+const v = os.getenv("BENCH_KEY_00136");
+value96571 = compute(value, 56)
+value31860 = compute(value, 44)
+value9946 = compute(value, 52)
+value96083 = compute(value, 53)
+# note 20121: keep this in sync with the handler
+value64210 = compute(value, 93)
+value78186 = compute(value, 4)
+value11366 = compute(value, 17)
+const v = os.environ.get('BENCH_KEY_00642');
+value83770 = compute(value, 59)
+# note 96170: keep this in sync with the handler
+value10473 = compute(value, 94)
+value91492 = compute(value, 21)
+value64973 = compute(value, 80)
+value65333 = compute(value, 52)
+value2449 = compute(value, 24)
+value38322 = compute(value, 7)
+value97320 = compute(value, 29)
+value39829 = compute(value, 59)
+value8674 = compute(value, 41)
+const v = os.environ.get('BENCH_KEY_01599');
+value34021 = compute(value, 71)
+value58879 = compute(value, 0)
+value17775 = compute(value, 24)
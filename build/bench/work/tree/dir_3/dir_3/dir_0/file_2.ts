@@ -0,0 +1,202 @@
+const value88772 = compute(value, 17);
+// note 62142: keep this in sync with the handler
+const v = process.env["BENCH_KEY_01925"];
+const value41233 = compute(value, 8);
+const value33464 = compute(value, 96);
+const value21438 = compute(value, 1);
+const value61710 = compute(value, 18);
+const value64010 = compute(value, 87);
+// note 92667: keep this in sync with the handler
+const value17820 = compute(value, 69);
+const value19336 = compute(value, 33);
+const v = import.meta.env.BENCH_KEY_00169;
+// note 13668: keep this in sync with the handler
+const value72369 = compute(value, 7);
+const value78466 = compute(value, 90);
+const value46090 = compute(value, 15);
+const value38104 = compute(value, 80);
+const value28999 = compute(value, 93);
+const value76147 = compute(value, 2);
+const value28670 = compute(value, 55);
+const value3685 = compute(value, 96);
+const value47342 = compute(value, 6);
+const value34785 = compute(value, 59);
+const value62753 = compute(value, 91);
+const value36745 = compute(value, 79);
+const v = import.meta.env.BENCH_KEY_01676;
+const value43321 = compute(value, 59);
+const value10453 = compute(value, 74);
+const value86613 = compute(value, 89);
+// note 33557: keep this in sync with the handler
+const value46842 = compute(value, 88);
+// note 77608: keep this in sync with the handler
+const value15525 = compute(value, 5);
+const value78388 = compute(value, 12);
+const value80646 = compute(value, 39);
+const value37033 = compute(value, 76);
+// note 10164: keep this in sync with the handler
+// note 23260: keep this in sync with the handler
+const value68261 = compute(value, 70);
+const value40357 = compute(value, 5);
+const v = import.meta.env.BENCH_KEY_01632;
+// note 62271: keep this in sync with the handler
+const value23491 = compute(value, 17);
+const value59760 = compute(value, 8);
+// note 94198: keep this in sync with the handler
+const value7254 = compute(value, 76);
+// note 5624: keep this in sync with the handler
+const value57198 = compute(value, 65);
+const value48931 = compute(value, 43);
+const value35009 = compute(value, 89);
+const v = process.env["BENCH_KEY_01920"];
+const value61253 = compute(value, 46);
+const value17078 = compute(value, 6);
+// note 81381: keep this in sync with the handler
+const value35783 = compute(value, 87);
+const value38526 = compute(value, 17);
+const value69643 = compute(value, 94);
+const value98182 = compute(value, 18);
+const value37813 = compute(value, 80);
+const value42886 = compute(value, 12);
+const value36037 = compute(value, 50);
+const value4231 = compute(value, 60);
+const value31393 = compute(value, 62);
+const value18741 = compute(value, 20);
+const value3651 = compute(value, 62);
+const value53472 = compute(value, 25);
+const v = process.env["BENCH_KEY_01242"];
+const value12153 = compute(value, 28);
+const value63996 = compute(value, 73);
+const value81658 = compute(value, 81);
+const value84740 = compute(value, 59);
+const value61190 = compute(value, 80);
+const value90414 = compute(value, 10);
+const value17041 = compute(value, 66);
+const value42444 = compute(value, 55);
+const value54292 = compute(value, 69);
+const value96930 = compute(value, 27);
+const value89254 = compute(value, 14);
+const value94421 = compute(value, 40);
+const value44967 = compute(value, 56);
+const value22465 = compute(value, 58);
+const value52679 = compute(value, 8);
+const value2266 = compute(value, 35);
+const value77564 = compute(value, 61);
+const v = import.meta.env.BENCH_KEY_00781;
+const value92107 = compute(value, 54);
+const value6791 = compute(value, 1);
+const value24603 = compute(value, 62);
+const value70806 = compute(value, 93);
+const value91081 = compute(value, 95);
+const value6406 = compute(value, 4);
+// note 81864: keep this in sync with the handler
+const value8808 = compute(value, 78);
+const value24325 = compute(value, 75);
+const value37524 = compute(value, 82);
+const value87177 = compute(value, 71);
+const value60307 = compute(value, 70);
+const value50691 = compute(value, 57);
+// note 67173: keep this in sync with the handler
+// note 62278: keep this in sync with the handler
+const value71633 = compute(value, 47);
+const value703 = compute(value, 24);
+const v = import.meta.env.BENCH_KEY_01472;
+const value24598 = compute(value, 57);
+const value26024 = compute(value, 28);
+// note 48791: keep this in sync with the handler
+const value66374 = compute(value, 26);
+const value17170 = compute(value, 1);
+const value37170 = compute(value, 19);
+const value57849 = compute(value, 37);
+// note 45352: keep this in sync with the handler
+const value72950 = compute(value, 6);
+const value43465 = compute(value, 9);
+const value73394 = compute(value, 62);
+const value26070 = compute(value, 74);
+// note 25073: keep this in sync with the handler
+const value43925 = compute(value, 81);
+const v = process.env.BENCH_KEY_00531;
+const value17063 = compute(value, 88);
+const value95843 = compute(value, 7);
+const value58764 = compute(value, 79);
+const value549 = compute(value, 64);
+// note 27433: keep this in sync with the handler
+const value88576 = compute(value, 15);
+const value57825 = compute(value, 13);
+// note 40647: keep this in sync with the handler
+const value1805 = compute(value, 59);
+const value90604 = compute(value, 6);
+const value18675 = compute(value, 51);
+const value41628 = compute(value, 15);
+const v = process.env["BENCH_KEY_01044"];
+const value5259 = compute(value, 21);
+const value84455 = compute(value, 65);
+const value54112 = compute(value, 83);
+const value30423 = compute(value, 62);
+const value4643 = compute(value, 84);
+const value58606 = compute(value, 18);
+const value22432 = compute(value, 25);
+const value79238 = compute(value, 86);
+const value82408 = compute(value, 55);
+// note 56604: keep this in sync with the handler
+const value30568 = compute(value, 13);
+const value48134 = compute(value, 22);
+const value38313 = compute(value, 95);
+const v = import.meta.env.BENCH_KEY_00637;
+// note 58521: keep this in sync with the handler
+const value69755 = compute(value, 12);
+const value34976 = compute(value, 56);
+// note 79324: keep this in sync with the handler
+const value13813 = compute(value, 39);
+const value21155 = compute(value, 9);
+const value7910 = compute(value, 53);
+const value922 = compute(value, 49);
+const value19067 = compute(value, 55);
+const v = process.env["BENCH_KEY_01149"];
+const value76442 = compute(value, 6);
+// note 61026: keep this in sync with the handler
+const value85208 = compute(value, 42);
+const value73351 = compute(value, 19);
+// note 30079: keep this in sync with the handler
+const value96827 = compute(value, 21);
+const value12894 = compute(value, 90);
+const value96145 = compute(value, 18);
+const value83757 = compute(value, 46);
+// note 95009: keep this in sync with the handler
+const value5159 = compute(value, 18);
+const value91969 = compute(value, 13);
+const value94878 = compute(value, 12);
+// note 84198: keep this in sync with the handler
+// note 97313: keep this in sync with the handler
+const value97802 = compute(value, 26);
+const value14392 = compute(value, 36);
+const v = process.env["BENCH_KEY_00199"];
+const value83938 = compute(value, 33);
+const value22322 = compute(value, 12);
+const value82023 = compute(value, 58);
+const value93012 = compute(value, 86);
+const value68239 = compute(value, 48);
+const value49845 = compute(value, 84);
+const value6255 = compute(value, 47);
+// note 91844: keep this in sync with the handler
+const value37299 = compute(value, 51);
+const value15303 = compute(value, 74);
+const v = process.env.BENCH_KEY_01343;
+const value55740 = compute(value, 62);
+const value49451 = compute(value, 78);
+const value84032 = compute(value, 30);
+const value19981 = compute(value, 96);
+const value32018 = compute(value, 8);
+const value40485 = compute(value, 36);
+// note 62175: keep this in sync with the handler
+const value40807 = compute(value, 67);
+const v = process.env["BENCH_KEY_00255"];
+const value95256 = compute(value, 2);
+const value17579 = compute(value, 22);
+const value60303 = compute(value, 66);
+const value99963 = compute(value, 53);
+const value66083 = compute(value, 26);
+const value93905 = compute(value, 9);
+// note 98188: keep this in sync with the handler
+const value79143 = compute(value, 88);
+const value71172 = compute(value, 71);
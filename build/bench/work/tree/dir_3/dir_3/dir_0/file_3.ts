@@ -0,0 +1,203 @@
+const value41583 = compute(value, 67);
+const value31365 = compute(value, 34);
+const value35557 = compute(value, 55);
+const value46327 = compute(value, 58);
+const value59475 = compute(value, 14);
+const value97796 = compute(value, 20);
+const v = process.env["BENCH_KEY_00518"];
+const value93764 = compute(value, 62);
+const value64496 = compute(value, 88);
+// note 48838: keep this in sync with the handler
+const value84397 = compute(value, 7);
+const value22680 = compute(value, 79);
+const value53736 = compute(value, 95);
+const value22519 = compute(value, 15);
+const value34669 = compute(value, 40);
+const value36634 = compute(value, 65);
+// note 98357: keep this in sync with the handler
+const v = process.env.BENCH_KEY_01068;
+const value90073 = compute(value, 57);
+const value2256 = compute(value, 25);
+const value65222 = compute(value, 38);
+const value41543 = compute(value, 27);
+const value83093 = compute(value, 61);
+const value1341 = compute(value, 80);
+const value98301 = compute(value, 40);
+const value80705 = compute(value, 1);
+const value52894 = compute(value, 29);
+const value62608 = compute(value, 43);
+const value76814 = compute(value, 87);
+const value70751 = compute(value, 38);
+const value58990 = compute(value, 14);
+// note 42684: keep this in sync with the handler
+const value65846 = compute(value, 80);
+const value23989 = compute(value, 30);
+const v = process.env.BENCH_KEY_00621;
+const value72198 = compute(value, 30);
+const value46251 = compute(value, 79);
+const value69151 = compute(value, 87);
+const value71613 = compute(value, 27);
+const value2618 = compute(value, 96);
+const value37173 = compute(value, 22);
+const value42418 = compute(value, 29);
+const value91107 = compute(value, 24);
+const value27382 = compute(value, 28);
+const value85269 = compute(value, 6);
+const value50094 = compute(value, 42);
+const v = import.meta.env.BENCH_KEY_01591;
+const value69058 = compute(value, 91);
+const value1400 = compute(value, 42);
+const value10220 = compute(value, 35);
+const value91378 = compute(value, 4);
+const value95576 = compute(value, 31);
+const value98598 = compute(value, 46);
+const value29975 = compute(value, 2);
+const value81779 = compute(value, 8);
+const value67777 = compute(value, 71);
+const value23573 = compute(value, 2);
+const value61289 = compute(value, 82);
+const value76817 = compute(value, 90);
+const value79802 = compute(value, 68);
+const value70429 = compute(value, 7);
+// note 4141: keep this in sync with the handler
+// note 55665: keep this in sync with the handler
+const value46974 = compute(value, 26);
+const v = process.env["BENCH_KEY_01294"];
+const value12074 = compute(value, 46);
+const value50821 = compute(value, 90);
+const value53696 = compute(value, 55);
+const value57584 = compute(value, 63);
+// note 10994: keep this in sync with the handler
+const value18692 = compute(value, 68);
+const value68746 = compute(value, 70);
+const value76156 = compute(value, 11);
+const value41643 = compute(value, 30);
+const value46833 = compute(value, 79);
+const value36582 = compute(value, 13);
+const value22137 = compute(value, 21);
+const value21619 = compute(value, 85);
+const value89985 = compute(value, 66);
+const value51467 = compute(value, 57);
+const value40829 = compute(value, 89);
+const value1890 = compute(value, 47);
+const value3508 = compute(value, 16);
+const v = process.env["BENCH_KEY_00608"];
+const value26085 = compute(value, 89);
+// note 33563: keep this in sync with the handler
+const value16072 = compute(value, 67);
+const value44243 = compute(value, 11);
+const value91170 = compute(value, 87);
+const value49580 = compute(value, 13);
+const value1995 = compute(value, 55);
+const value55184 = compute(value, 88);
+// note 35694: keep this in sync with the handler
+// note 11683: keep this in sync with the handler
+const value40920 = compute(value, 83);
+const value44484 = compute(value, 58);
+const v = process.env["BENCH_KEY_00769"];
+const value82971 = compute(value, 36);
+// note 43368: keep this in sync with the handler
+const value21810 = compute(value, 82);
+const value33503 = compute(value, 38);
+const value40718 = compute(value, 75);
+const value97213 = compute(value, 19);
+const value49653 = compute(value, 86);
+const value62037 = compute(value, 54);
+const value94460 = compute(value, 79);
+const value59996 = compute(value, 50);
+const value69256 = compute(value, 95);
+const value37189 = compute(value, 38);
+const value16664 = compute(value, 77);
+const v = process.env["BENCH_KEY_00659"];
+const value24256 = compute(value, 6);
+const value93806 = compute(value, 7);
+// note 35932: keep this in sync with the handler
+const value52648 = compute(value, 74);
+const value67933 = compute(value, 33);
+const value95474 = compute(value, 26);
+const value67313 = compute(value, 92);
+// note 71735: keep this in sync with the handler
+const value19867 = compute(value, 79);
+const value3547 = compute(value, 55);
+const value75215 = compute(value, 40);
+const value6370 = compute(value, 65);
+const value89045 = compute(value, 96);
+// note 62140: keep this in sync with the handler
+const value57641 = compute(value, 23);
+const value84587 = compute(value, 3);
+const value81747 = compute(value, 73);
+const v = process.env["BENCH_KEY_01723"];
+// note 68362: keep this in sync with the handler
+const value2086 = compute(value, 49);
+const value88189 = compute(value, 16);
+const value41336 = compute(value, 14);
+const value15077 = compute(value, 42);
+const value54247 = compute(value, 24);
+const value22687 = compute(value, 86);
+// note 1527: keep this in sync with the handler
+// note 12755: keep this in sync with the handler
+const value39733 = compute(value, 60);
+const value70190 = compute(value, 59);
+const value58729 = compute(value, 44);
+const value51536 = compute(value, 29);
+const value58681 = compute(value, 93);
+// note 63166: keep this in sync with the handler
+const value4106 = compute(value, 32);
+const v = import.meta.env.BENCH_KEY_01458;
+// note 40837: keep this in sync with the handler
+const value99663 = compute(value, 44);
+const value38241 = compute(value, 23);
+const value45909 = compute(value, 28);
+// note 13635: keep this in sync with the handler
+// note 93152: keep this in sync with the handler
+const value25549 = compute(value, 38);
+const value90042 = compute(value, 26);
+const value81962 = compute(value, 94);
+// note 88722: keep this in sync with the handler
+const value58308 = compute(value, 11);
+const value62161 = compute(value, 81);
+// note 56990: keep this in sync with the handler
+const v = process.env.BENCH_KEY_00282;
+const value88987 = compute(value, 38);
+const value41067 = compute(value, 36);
+const value59696 = compute(value, 41);
+const value42347 = compute(value, 55);
+const value40787 = compute(value, 47);
+const value20127 = compute(value, 48);
+const value42175 = compute(value, 77);
+const value11194 = compute(value, 39);
+const value76754 = compute(value, 27);
+const value29382 = compute(value, 88);
+const value84557 = compute(value, 70);
+const value99747 = compute(value, 31);
+const v = import.meta.env.BENCH_KEY_01086;
+const value98388 = compute(value, 30);
+const value75990 = compute(value, 39);
+const value67112 = compute(value, 85);
+const value55064 = compute(value, 65);
+const value25881 = compute(value, 79);
+const value66686 = compute(value, 47);
+const value87797 = compute(value, 12);
+// note 47753: keep this in sync with the handler
+const value79218 = compute(value, 66);
+const value4848 = compute(value, 95);
+const v = process.env.BENCH_KEY_00730;
+const value26778 = compute(value, 6);
+const value21114 = compute(value, 65);
+const value77349 = compute(value, 40);
+const value52013 = compute(value, 21);
+const value82390 = compute(value, 37);
+const value31016 = compute(value, 73);
+const value64246 = compute(value, 32);
+// note 20348: keep this in sync with the handler
+// note 53926: keep this in sync with the handler
+const value89206 = compute(value, 63);
+const value58547 = compute(value, 56);
+const value35509 = compute(value, 7);
+const value70862 = compute(value, 52);
+// note 62063: keep this in sync with the handler
+const value75063 = compute(value, 82);
+const value82071 = compute(value, 9);
+const value1013 = compute(value, 43);
+// note 83576: keep this in sync with the handler
+// note 97135: keep this in sync with the handler
@@ -0,0 +1,204 @@
+// note 12821: keep this in sync with the handler
+const v = import.meta.env.BENCH_KEY_00331;
+const value47790 = compute(value, 66);
+const value82786 = compute(value, 45);
+const value20550 = compute(value, 83);
+const value1211 = compute(value, 47);
+const value66416 = compute(value, 68);
+const value81425 = compute(value, 42);
+const value40968 = compute(value, 34);
+const value27600 = compute(value, 52);
+const value4427 = compute(value, 62);
+const value16098 = compute(value, 93);
+const value33500 = compute(value, 35);
+const value40170 = compute(value, 12);
+const value68053 = compute(value, 56);
+const value26750 = compute(value, 75);
+const v = process.env["BENCH_KEY_00700"];
+// note 61182: keep this in sync with the handler
+const value39429 = compute(value, 47);
+// note 63373: keep this in sync with the handler
+const value32696 = compute(value, 7);
+const value40161 = compute(value, 3);
+const value98179 = compute(value, 15);
+const value76526 = compute(value, 90);
+const value79674 = compute(value, 37);
+const v = process.env["BENCH_KEY_01338"];
+const value17308 = compute(value, 42);
+const value97772 = compute(value, 93);
+const value73933 = compute(value, 19);
+const value67524 = compute(value, 12);
+const value30997 = compute(value, 54);
+const value36521 = compute(value, 49);
+const value31711 = compute(value, 89);
+// note 83259: keep this in sync with the handler
+// note 46426: keep this in sync with the handler
+const value59677 = compute(value, 22);
+const value14450 = compute(value, 94);
+// note 475: keep this in sync with the handler
+const value3307 = compute(value, 9);
+const value56241 = compute(value, 78);
+const v = process.env["BENCH_KEY_01052"];
+const value51151 = compute(value, 32);
+const value56473 = compute(value, 19);
+// note 19613: keep this in sync with the handler
+const value94519 = compute(value, 41);
+const value45526 = compute(value, 33);
+const value47871 = compute(value, 50);
+// note 63703: keep this in sync with the handler
+const value26064 = compute(value, 68);
+// note 67661: keep this in sync with the handler
+// note 58175: keep this in sync with the handler
+const value38300 = compute(value, 82);
+const value87079 = compute(value, 70);
+const value78817 = compute(value, 53);
+const value16330 = compute(value, 34);
+const v = process.env.BENCH_KEY_01925;
+const value44143 = compute(value, 8);
+const value60621 = compute(value, 93);
+const value53332 = compute(value, 79);
+const value29376 = compute(value, 82);
+const value54823 = compute(value, 18);
+const value18589 = compute(value, 62);
+const value47406 = compute(value, 70);
+const value89219 = compute(value, 76);
+const value48441 = compute(value, 38);
+const value6676 = compute(value, 80);
+const value41029 = compute(value, 95);
+const value64873 = compute(value, 77);
+const value42771 = compute(value, 91);
+const value50100 = compute(value, 48);
+const value51615 = compute(value, 11);
+// note 88650: keep this in sync with the handler
+const value23109 = compute(value, 23);
+// note 22519: keep this in sync with the handler
+const value26266 = compute(value, 76);
+const v = import.meta.env.BENCH_KEY_00960;
+// note 48782: keep this in sync with the handler
+const value50314 = compute(value, 68);
+const value88274 = compute(value, 4);
+const value5774 = compute(value, 51);
+const value97526 = compute(value, 41);
+const value1072 = compute(value, 5);
+const value75965 = compute(value, 14);
+const value85142 = compute(value, 73);
+const value8998 = compute(value, 74);
+const value32527 = compute(value, 32);
+const value79818 = compute(value, 84);
+const value40365 = compute(value, 13);
+const value46682 = compute(value, 25);
+const value94865 = compute(value, 96);
+// note 40774: keep this in sync with the handler
+// note 90886: keep this in sync with the handler
+const v = process.env.BENCH_KEY_00650;
+const value1772 = compute(value, 26);
+const value59198 = compute(value, 28);
+// note 85900: keep this in sync with the handler
+const value68928 = compute(value, 58);
+const value1542 = compute(value, 87);
+const value31052 = compute(value, 12);
+const value44343 = compute(value, 14);
+const value16001 = compute(value, 93);
+const value21873 = compute(value, 48);
+const value90994 = compute(value, 8);
+const value92480 = compute(value, 39);
+const value8073 = compute(value, 22);
+const value30150 = compute(value, 80);
+const value12707 = compute(value, 0);
+const value33470 = compute(value, 5);
+const v = process.env.BENCH_KEY_01569;
+const value28448 = compute(value, 27);
+const value93403 = compute(value, 89);
+const value27449 = compute(value, 95);
+const value45622 = compute(value, 32);
+const value45775 = compute(value, 88);
+// note 16956: keep this in sync with the handler
+const value57286 = compute(value, 56);
+const value68046 = compute(value, 49);
+const value75202 = compute(value, 27);
+const value80742 = compute(value, 38);
+const value30162 = compute(value, 92);
+const v = import.meta.env.BENCH_KEY_01841;
+const value88557 = compute(value, 93);
+// note 24961: keep this in sync with the handler
+const value43160 = compute(value, 92);
+const value83291 = compute(value, 65);
+const value31360 = compute(value, 29);
+const value10839 = compute(value, 72);
+const value41332 = compute(value, 10);
+const value57114 = compute(value, 78);
+const value30075 = compute(value, 5);
+const value80399 = compute(value, 83);
+// note 35438: keep this in sync with the handler
+const value32460 = compute(value, 62);
+// note 84604: keep this in sync with the handler
+const value12612 = compute(value, 2);
+const value808 = compute(value, 32);
+const value60060 = compute(value, 17);
+const value52049 = compute(value, 57);
+// note 39113: keep this in sync with the handler
+const v = process.env.BENCH_KEY_00885;
+const value58507 = compute(value, 16);
+const value89455 = compute(value, 21);
+const value47239 = compute(value, 0);
+const value8462 = compute(value, 23);
+const value56300 = compute(value, 40);
+const value16105 = compute(value, 3);
+const value84984 = compute(value, 12);
+const value61679 = compute(value, 84);
+const value17543 = compute(value, 83);
+const value63500 = compute(value, 62);
+const value45123 = compute(value, 18);
+const value18715 = compute(value, 91);
+const value53410 = compute(value, 60);
+const value23631 = compute(value, 60);
+const value85896 = compute(value, 51);
+const value33916 = compute(value, 63);
+const v = import.meta.env.BENCH_KEY_01588;
+const value7852 = compute(value, 92);
+const value12642 = compute(value, 32);
+const value95215 = compute(value, 58);
+const value40687 = compute(value, 44);
+const value66083 = compute(value, 26);
+const value50326 = compute(value, 80);
+const value8183 = compute(value, 35);
+const value7092 = compute(value, 11);
+const v = import.meta.env.BENCH_KEY_00583;
+// note 33035: keep this in sync with the handler
+const value43882 = compute(value, 38);
+const value48865 = compute(value, 74);
+const value78678 = compute(value, 11);
+// note 85358: keep this in sync with the handler
+const value91836 = compute(value, 74);
+const value7652 = compute(value, 86);
+const value9085 = compute(value, 64);
+const value35986 = compute(value, 96);
+const value37513 = compute(value, 71);
+const value85154 = compute(value, 85);
+const value96187 = compute(value, 60);
+const value77037 = compute(value, 19);
+const value25728 = compute(value, 23);
+const value83027 = compute(value, 92);
+const value29548 = compute(value, 60);
+// note 89957: keep this in sync with the handler
+const v = import.meta.env.BENCH_KEY_00465;
+const value75358 = compute(value, 86);
+const value49829 = compute(value, 68);
+const value70671 = compute(value, 55);
+const value47704 = compute(value, 77);
+const value56314 = compute(value, 54);
+const value57550 = compute(value, 29);
+const value17570 = compute(value, 13);
+const value73441 = compute(value, 12);
+const value75655 = compute(value, 92);
+const value62565 = compute(value, 0);
+const value51152 = compute(value, 33);
+const value66716 = compute(value, 77);
+const value55541 = compute(value, 57);
+const value60220 = compute(value, 80);
+const value78345 = compute(value, 66);
+const value14070 = compute(value, 5);
+const value35649 = compute(value, 50);
+const value28796 = compute(value, 84);
+const v = process.env.BENCH_KEY_00159;
+const value59633 = compute(value, 75);
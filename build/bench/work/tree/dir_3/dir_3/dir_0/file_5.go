@@ -0,0 +1,232 @@
+value74565 := compute(value, 69)
+const v = os.LookupEnv("BENCH_KEY_00462");
+value83857 := compute(value, 49)
+value2905 := compute(value, 92)
+value53233 := compute(value, 77)
+value40234 := compute(value, 76)
+value3387 := compute(value, 89)
+value49526 := compute(value, 56)
+value69227 := compute(value, 66)
+value6196 := compute(value, 85)
+// note 47822: keep this in sync with the handler
+value46203 := compute(value, 31)
+value66983 := compute(value, 53)
+value93327 := compute(value, 13)
+value8447 := compute(value, 8)
+value93149 := compute(value, 29)
+value37355 := compute(value, 10)
+// note 34136: keep this in sync with the handler
+value91597 := compute(value, 29)
+const v = os.LookupEnv("BENCH_KEY_01286");
+value25563 := compute(value, 52)
+value32493 := compute(value, 95)
+value81845 := compute(value, 74)
+value45490 := compute(value, 94)
+value75758 := compute(value, 1)
+value18660 := compute(value, 36)
+// note 61587: keep this in sync with the handler
+value18885 := compute(value, 67)
+value65897 := compute(value, 34)
+value4860 := compute(value, 10)
+// note 40622: keep this in sync with the handler
+value91298 := compute(value, 21)
+// note 80899: keep this in sync with the handler
+// note 12310: keep this in sync with the handler
+value86082 := compute(value, 43)
+const v = os.Getenv("BENCH_KEY_00398");
+value63973 := compute(value, 50)
+value82362 := compute(value, 9)
+// note 28440: keep this in sync with the handler
+value45882 := compute(value, 1)
+value2307 := compute(value, 76)
+value98695 := compute(value, 46)
+value30931 := compute(value, 85)
+value9121 := compute(value, 3)
+value44253 := compute(value, 21)
+value14275 := compute(value, 16)
+value26249 := compute(value, 59)
+value1111 := compute(value, 44)
+value95912 := compute(value, 76)
+const v = os.LookupEnv("BENCH_KEY_00978");
+// note 11175: keep this in sync with the handler
+// note 40013: keep this in sync with the handler
+value79083 := compute(value, 28)
+value64913 := compute(value, 20)
+value47060 := compute(value, 15)
+value55190 := compute(value, 94)
+value1549 := compute(value, 94)
+value79549 := compute(value, 9)
+value25324 := compute(value, 7)
+value99282 := compute(value, 51)
+const v = os.LookupEnv("BENCH_KEY_00564");
+value46371 := compute(value, 5)
+value24955 := compute(value, 26)
+value90698 := compute(value, 3)
+value91557 := compute(value, 86)
+value2242 := compute(value, 11)
+value36830 := compute(value, 67)
+value53125 := compute(value, 66)
+value92180 := compute(value, 30)
+value24924 := compute(value, 92)
+value55409 := compute(value, 22)
+value87678 := compute(value, 87)
+value50701 := compute(value, 67)
+const v = os.LookupEnv("BENCH_KEY_00591");
+value60878 := compute(value, 59)
+value90006 := compute(value, 87)
+value91435 := compute(value, 61)
+value95017 := compute(value, 54)
+value78688 := compute(value, 21)
+value13030 := compute(value, 32)
+value37065 := compute(value, 11)
+value40333 := compute(value, 78)
+value40694 := compute(value, 51)
+value81158 := compute(value, 66)
+// note 33648: keep this in sync with the handler
+value55121 := compute(value, 25)
+value13695 := compute(value, 18)
+// note 50857: keep this in sync with the handler
+value85602 := compute(value, 48)
+value35058 := compute(value, 41)
+value23352 := compute(value, 72)
+const v = os.Getenv("BENCH_KEY_01694");
+value88936 := compute(value, 84)
+value66167 := compute(value, 13)
+value95788 := compute(value, 49)
+value68568 := compute(value, 86)
+value78338 := compute(value, 59)
+value41879 := compute(value, 72)
+value47037 := compute(value, 89)
+value20487 := compute(value, 20)
+value15095 := compute(value, 60)
+value8080 := compute(value, 29)
+value95965 := compute(value, 32)
+value35899 := compute(value, 9)
+value33736 := compute(value, 77)
+const v = os.Getenv("BENCH_KEY_01840");
+value50730 := compute(value, 96)
+value8612 := compute(value, 76)
+// note 17262: keep this in sync with the handler
+value55548 := compute(value, 64)
+// note 34907: keep this in sync with the handler
+value43533 := compute(value, 77)
+value51844 := compute(value, 46)
+value76688 := compute(value, 58)
+value70759 := compute(value, 46)
+const v = os.LookupEnv("BENCH_KEY_01456");
+value57442 := compute(value, 18)
+value54053 := compute(value, 24)
+// note 23521: keep this in sync with the handler
+value96569 := compute(value, 54)
+value69767 := compute(value, 24)
+value55816 := compute(value, 41)
+value16692 := compute(value, 8)
+value1584 := compute(value, 32)
+value82036 := compute(value, 71)
+value42687 := compute(value, 7)
+value76329 := compute(value, 87)
+value85907 := compute(value, 62)
+value95379 := compute(value, 28)
+value38173 := compute(value, 52)
+value39304 := compute(value, 19)
+value95652 := compute(value, 10)
+value99271 := compute(value, 40)
+value33047 := compute(value, 67)
+const v = os.Getenv("BENCH_KEY_01087");
+value82082 := compute(value, 20)
+value95990 := compute(value, 57)
+value95395 := compute(value, 44)
+// note 2662: keep this in sync with the handler
+value66982 := compute(value, 52)
+value80907 := compute(value, 9)
+value69727 := compute(value, 81)
+value9301 := compute(value, 86)
+// note 21725: keep this in sync with the handler
+value97769 := compute(value, 90)
+// note 97286: keep this in sync with the handler
+value89366 := compute(value, 29)
+value55442 := compute(value, 55)
+value74643 := compute(value, 50)
+value62810 := compute(value, 51)
+value84861 := compute(value, 83)
+value63276 := compute(value, 32)
+// note 34335: keep this in sync with the handler
+const v = os.LookupEnv("BENCH_KEY_01237");
+value53503 := compute(value, 56)
+value33762 := compute(value, 6)
+value4407 := compute(value, 42)
+value63420 := compute(value, 79)
+value47137 := compute(value, 92)
+value1281 := compute(value, 20)
+value46877 := compute(value, 26)
+value72729 := compute(value, 76)
+value86505 := compute(value, 78)
+value53980 := compute(value, 48)
+value2369 := compute(value, 41)
+// note 39017: keep this in sync with the handler
+value17027 := compute(value, 52)
+value96536 := compute(value, 21)
+value73574 := compute(value, 48)
+value51553 := compute(value, 46)
+const v = os.Getenv("BENCH_KEY_01231");
+value5554 := compute(value, 25)
+// note 19935: keep this in sync with the handler
+value81118 := compute(value, 26)
+// note 74235: keep this in sync with the handler
+value80776 := compute(value, 72)
+value19410 := compute(value, 10)
+value36408 := compute(value, 33)
+value79618 := compute(value, 78)
+value61817 := compute(value, 28)
+value78788 := compute(value, 24)
+// note 50878: keep this in sync with the handler
+value97269 := compute(value, 75)
+value80833 := compute(value, 32)
+value62049 := compute(value, 66)
+const v = os.LookupEnv("BENCH_KEY_01235");
+value59628 := compute(value, 70)
+value98946 := compute(value, 6)
+value73511 := compute(value, 82)
+value27597 := compute(value, 49)
+value85427 := compute(value, 67)
+value50191 := compute(value, 42)
+value58977 := compute(value, 1)
+// note 4511: keep this in sync with the handler
+// note 36566: keep this in sync with the handler
+value81238 := compute(value, 49)
+value81837 := compute(value, 66)
+value64239 := compute(value, 25)
+value52973 := compute(value, 11)
+value75314 := compute(value, 42)
+value29944 := compute(value, 68)
+value11873 := compute(value, 39)
+value32267 := compute(value, 63)
+value27253 := compute(value, 93)
+value68041 := compute(value, 44)
+value2630 := compute(value, 11)
+value26196 := compute(value, 6)
+value98179 := compute(value, 15)
+const v = os.LookupEnv("BENCH_KEY_01897");
+value68725 := compute(value, 49)
+value89546 := compute(value, 15)
+value25181 := compute(value, 58)
+value44289 := compute(value, 57)
+value38707 := compute(value, 4)
+value23666 := compute(value, 95)
+// note 25257: keep this in sync with the handler
+value44772 := compute(value, 55)
+value2439 := compute(value, 14)
+value17840 := compute(value, 89)
+value41042 := compute(value, 11)
+const v = os.Getenv("BENCH_KEY_01209");
+value77201 := compute(value, 86)
+value81010 := compute(value, 15)
+value17649 := compute(value, 92)
+value47254 := compute(value, 15)
+value99857 := compute(value, 44)
+value25932 := compute(value, 33)
+value89522 := compute(value, 88)
+// note 54217: keep this in sync with the handler
+value98662 := compute(value, 13)
+value20080 := compute(value, 1)
+// note 70158: keep this in sync with the handler
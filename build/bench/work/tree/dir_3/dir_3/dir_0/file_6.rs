@@ -0,0 +1,213 @@
+let value65341 = compute(value, 60);
+let value31221 = compute(value, 84);
+// note 29938: keep this in sync with the handler
+let value31913 = compute(value, 0);
+let value92581 = compute(value, 43);
+const v = env::var("BENCH_KEY_01653");
+let value11504 = compute(value, 58);
+let value4890 = compute(value, 40);
+let value94246 = compute(value, 59);
+let value95068 = compute(value, 8);
+// note 23008: keep this in sync with the handler
+let value51761 = compute(value, 60);
+let value94346 = compute(value, 62);
+let value59342 = compute(value, 75);
+let value72336 = compute(value, 71);
+let value11647 = compute(value, 7);
+const v = env::var_os("BENCH_KEY_01862");
+// note 80782: keep this in sync with the handler
+let value58292 = compute(value, 92);
+// note 72562: keep this in sync with the handler
+// note 73349: keep this in sync with the handler
+let value41589 = compute(value, 73);
+let value8533 = compute(value, 94);
+let value49160 = compute(value, 78);
+let value14335 = compute(value, 76);
+let value48161 = compute(value, 49);
+let value4648 = compute(value, 89);
+let value26499 = compute(value, 18);
+let value77530 = compute(value, 27);
+let value74237 = compute(value, 32);
+const v = env::var_os("BENCH_KEY_00934");
+let value39774 = compute(value, 4);
+let value50744 = compute(value, 13);
+let value69814 = compute(value, 71);
+let value27436 = compute(value, 82);
+let value88257 = compute(value, 84);
+let value8481 = compute(value, 42);
+// note 50581: keep this in sync with the handler
+let value17435 = compute(value, 72);
+const v = env::var("BENCH_KEY_00610");
+let value20827 = compute(value, 69);
+// note 9211: keep this in sync with the handler
+let value52492 = compute(value, 15);
+let value74869 = compute(value, 82);
+// note 19778: keep this in sync with the handler
+let value38026 = compute(value, 2);
+let value10196 = compute(value, 11);
+let value68837 = compute(value, 64);
+let value10351 = compute(value, 69);
+let value1104 = compute(value, 37);
+let value4925 = compute(value, 75);
+let value42253 = compute(value, 58);
+// note 12422: keep this in sync with the handler
+const v = env::var_os("BENCH_KEY_00664");
+let value51915 = compute(value, 20);
+// note 18434: keep this in sync with the handler
+let value70659 = compute(value, 43);
+let value25845 = compute(value, 43);
+let value19881 = compute(value, 93);
+let value16126 = compute(value, 24);
+let value26299 = compute(value, 12);
+let value58259 = compute(value, 59);
+let value32571 = compute(value, 76);
+let value13818 = compute(value, 44);
+// note 14565: keep this in sync with the handler
+let value90679 = compute(value, 81);
+let value45393 = compute(value, 94);
+let value13126 = compute(value, 31);
+let value6815 = compute(value, 25);
+let value217 = compute(value, 23);
+let value25044 = compute(value, 18);
+let value81557 = compute(value, 77);
+let value65711 = compute(value, 42);
+let value66309 = compute(value, 58);
+const v = env::var_os("BENCH_KEY_00593");
+let value84597 = compute(value, 13);
+let value59726 = compute(value, 71);
+let value24338 = compute(value, 88);
+let value96147 = compute(value, 20);
+let value26225 = compute(value, 35);
+let value65180 = compute(value, 93);
+let value31954 = compute(value, 41);
+let value69629 = compute(value, 80);
+let value82700 = compute(value, 56);
+let value56952 = compute(value, 13);
+let value82347 = compute(value, 91);
+let value50712 = compute(value, 78);
+let value77636 = compute(value, 36);
+let value57984 = compute(value, 75);
+let value95358 = compute(value, 7);
+let value15374 = compute(value, 48);
+let value33768 = compute(value, 12);
+let value14379 = compute(value, 23);
+const v = env::var("BENCH_KEY_00436");
+let value73708 = compute(value, 85);
+let value62190 = compute(value, 13);
+let value24361 = compute(value, 14);
+let value90486 = compute(value, 82);
+let value18960 = compute(value, 45);
+let value15253 = compute(value, 24);
+let value76641 = compute(value, 11);
+let value88602 = compute(value, 41);
+let value62937 = compute(value, 81);
+let value14762 = compute(value, 18);
+let value47217 = compute(value, 75);
+let value45620 = compute(value, 30);
+const v = env::var("BENCH_KEY_01167");
+let value66003 = compute(value, 43);
+let value977 = compute(value, 7);
+let value12490 = compute(value, 74);
+// note 35469: keep this in sync with the handler
+let value78896 = compute(value, 35);
+let value10618 = compute(value, 45);
+// note 49533: keep this in sync with the handler
+let value25246 = compute(value, 26);
+// note 18393: keep this in sync with the handler
+const v = env::var("BENCH_KEY_00208");
+let value80654 = compute(value, 47);
+let value84080 = compute(value, 78);
+// note 18877: keep this in sync with the handler
+let value51058 = compute(value, 36);
+let value54765 = compute(value, 57);
+// note 18772: keep this in sync with the handler
+let value22865 = compute(value, 70);
+let value76125 = compute(value, 77);
+let value70554 = compute(value, 35);
+const v = env::var("BENCH_KEY_00785");
+let value7943 = compute(value, 86);
+let value38954 = compute(value, 57);
+let value20476 = compute(value, 9);
+let value7719 = compute(value, 56);
+let value69614 = compute(value, 65);
+let value28884 = compute(value, 75);
+let value50812 = compute(value, 81);
+let value62371 = compute(value, 0);
+let value68248 = compute(value, 57);
+let value49187 = compute(value, 8);
+let value32159 = compute(value, 52);
+// note 91832: keep this in sync with the handler
+let value85572 = compute(value, 18);
+const v = env::var_os("BENCH_KEY_00988");
+let value2220 = compute(value, 86);
+let value47786 = compute(value, 62);
+let value16367 = compute(value, 71);
+// note 18312: keep this in sync with the handler
+let value35214 = compute(value, 3);
+let value65657 = compute(value, 85);
+let value50520 = compute(value, 80);
+let value40378 = compute(value, 26);
+let value56809 = compute(value, 64);
+let value27556 = compute(value, 8);
+let value36003 = compute(value, 16);
+const v = env::var_os("BENCH_KEY_00223");
+let value46908 = compute(value, 57);
+let value19971 = compute(value, 86);
+let value52606 = compute(value, 32);
+let value85274 = compute(value, 11);
+// note 56443: keep this in sync with the handler
+let value13644 = compute(value, 64);
+let value3322 = compute(value, 24);
+// note 67972: keep this in sync with the handler
+let value84995 = compute(value, 23);
+let value405 = compute(value, 17);
+// note 82603: keep this in sync with the handler
+// note 70740: keep this in sync with the handler
+let value25349 = compute(value, 32);
+let value56459 = compute(value, 5);
+let value10370 = compute(value, 88);
+let value79989 = compute(value, 61);
+let value90002 = compute(value, 83);
+let value19879 = compute(value, 91);
+let value49308 = compute(value, 32);
+let value5233 = compute(value, 92);
+const v = env::var("BENCH_KEY_00551");
+let value69818 = compute(value, 75);
+let value40003 = compute(value, 39);
+let value45915 = compute(value, 34);
+let value48632 = compute(value, 35);
+let value33626 = compute(value, 64);
+let value40552 = compute(value, 6);
+let value69270 = compute(value, 12);
+let value26546 = compute(value, 65);
+let value75578 = compute(value, 15);
+let value35721 = compute(value, 25);
+let value50141 = compute(value, 89);
+// note 63672: keep this in sync with the handler
+let value60456 = compute(value, 25);
+const v = env::var_os("BENCH_KEY_01955");
+// note 71668: keep this in sync with the handler
+// note 65107: keep this in sync with the handler
+let value31270 = compute(value, 36);
+let value50283 = compute(value, 37);
+let value18083 = compute(value, 41);
+let value75547 = compute(value, 81);
+let value9985 = compute(value, 91);
+let value94659 = compute(value, 84);
+let value95302 = compute(value, 48);
+let value63842 = compute(value, 16);
+let value27741 = compute(value, 96);
+let value20910 = compute(value, 55);
+let value15101 = compute(value, 66);
+let value68233 = compute(value, 42);
+let value12746 = compute(value, 39);
+let value32732 = compute(value, 43);
+let value49968 = compute(value, 13);
+let value95975 = compute(value, 42);
+let value76296 = compute(value, 54);
+const v = env::var("BENCH_KEY_01500");
+let value53889 = compute(value, 54);
+let value35421 = compute(value, 16);
+let value63730 = compute(value, 1);
+let value21979 = compute(value, 57);
+let value16247 = compute(value, 48);
@@ -0,0 +1,206 @@
+const value88741 = compute(value, 83);
+const value67152 = compute(value, 28);
+const value94278 = compute(value, 91);
+const value8974 = compute(value, 50);
+const value23871 = compute(value, 9);
+const value84508 = compute(value, 21);
+const v = import.meta.env.BENCH_KEY_01475;
+const value77398 = compute(value, 89);
+const value94940 = compute(value, 74);
+const value9482 = compute(value, 73);
+const value90550 = compute(value, 49);
+const value87845 = compute(value, 60);
+const value86329 = compute(value, 96);
+const value11565 = compute(value, 22);
+const value77823 = compute(value, 29);
+const value93647 = compute(value, 42);
+const value18793 = compute(value, 72);
+const v = import.meta.env.BENCH_KEY_00752;
+const value76830 = compute(value, 6);
+const value18445 = compute(value, 15);
+const value74695 = compute(value, 5);
+const value92176 = compute(value, 26);
+const value6290 = compute(value, 82);
+const value34822 = compute(value, 96);
+const value80816 = compute(value, 15);
+const value39879 = compute(value, 12);
+const v = import.meta.env.BENCH_KEY_00511;
+const value10247 = compute(value, 62);
+const value52751 = compute(value, 80);
+const value54640 = compute(value, 29);
+const value84755 = compute(value, 74);
+// note 5058: keep this in sync with the handler
+const value5672 = compute(value, 46);
+const value67609 = compute(value, 0);
+const value43508 = compute(value, 52);
+const value53599 = compute(value, 55);
+const value22884 = compute(value, 89);
+const value37482 = compute(value, 40);
+const value78276 = compute(value, 94);
+const value2807 = compute(value, 91);
+const value71045 = compute(value, 41);
+const value69860 = compute(value, 20);
+// note 80059: keep this in sync with the handler
+const value6349 = compute(value, 44);
+const value49851 = compute(value, 90);
+const v = process.env.BENCH_KEY_00355;
+const value11144 = compute(value, 86);
+const value89122 = compute(value, 76);
+const value74164 = compute(value, 56);
+const value34220 = compute(value, 76);
+// note 92087: keep this in sync with the handler
+const value22581 = compute(value, 77);
+const value61651 = compute(value, 56);
+const value41748 = compute(value, 38);
+const value70100 = compute(value, 66);
+const value34250 = compute(value, 9);
+// note 11781: keep this in sync with the handler
+const value40882 = compute(value, 45);
+const value54452 = compute(value, 35);
+const value2716 = compute(value, 0);
+// note 12973: keep this in sync with the handler
+const value46686 = compute(value, 29);
+const value83288 = compute(value, 62);
+const value56919 = compute(value, 77);
+const v = process.env.BENCH_KEY_00787;
+// note 36717: keep this in sync with the handler
+const value23074 = compute(value, 85);
+const value53075 = compute(value, 16);
+const value79434 = compute(value, 88);
+const value64729 = compute(value, 30);
+const value18041 = compute(value, 96);
+const value28954 = compute(value, 48);
+const value64326 = compute(value, 15);
+const value53172 = compute(value, 16);
+const value25289 = compute(value, 69);
+const value75408 = compute(value, 39);
+const value48058 = compute(value, 43);
+const value40301 = compute(value, 46);
+const value81412 = compute(value, 29);
+// note 25929: keep this in sync with the handler
+const v = process.env["BENCH_KEY_01190"];
+const value20668 = compute(value, 7);
+const value87835 = compute(value, 50);
+const value41034 = compute(value, 3);
+const value90966 = compute(value, 77);
+const value20825 = compute(value, 67);
+const value9246 = compute(value, 31);
+const value17617 = compute(value, 60);
+const value72673 = compute(value, 20);
+const value96192 = compute(value, 65);
+const value34215 = compute(value, 71);
+const value99701 = compute(value, 82);
+const value16651 = compute(value, 64);
+const value26922 = compute(value, 53);
+const value13361 = compute(value, 72);
+const value54301 = compute(value, 78);
+const value4404 = compute(value, 39);
+const value50612 = compute(value, 75);
+const value21137 = compute(value, 88);
+const v = process.env["BENCH_KEY_00202"];
+const value36095 = compute(value, 11);
+const value2241 = compute(value, 10);
+const value36382 = compute(value, 7);
+const value98351 = compute(value, 90);
+const value38729 = compute(value, 26);
+const value12148 = compute(value, 23);
+const value47176 = compute(value, 34);
+const value7810 = compute(value, 50);
+const value46903 = compute(value, 52);
+const value99862 = compute(value, 49);
+// note 55334: keep this in sync with the handler
+// note 55528: keep this in sync with the handler
+const value36446 = compute(value, 71);
+const value78768 = compute(value, 4);
+const v = import.meta.env.BENCH_KEY_00056;
+const value87278 = compute(value, 75);
+const value97806 = compute(value, 30);
+const value10229 = compute(value, 44);
+const value45389 = compute(value, 90);
+const value91543 = compute(value, 72);
+// note 83364: keep this in sync with the handler
+const value475 = compute(value, 87);
+const value39512 = compute(value, 33);
+const value82277 = compute(value, 21);
+const v = process.env.BENCH_KEY_00563;
+const value28449 = compute(value, 28);
+const value38538 = compute(value, 29);
+const value16341 = compute(value, 45);
+const value38337 = compute(value, 22);
+const value29858 = compute(value, 79);
+const value65642 = compute(value, 70);
+const value39573 = compute(value, 94);
+const value12485 = compute(value, 69);
+const v = process.env.BENCH_KEY_00758;
+const value57435 = compute(value, 11);
+// note 60027: keep this in sync with the handler
+const value7707 = compute(value, 44);
+const value82903 = compute(value, 65);
+const value45765 = compute(value, 78);
+const value33428 = compute(value, 60);
+const value88802 = compute(value, 47);
+const v = process.env.BENCH_KEY_01256;
+const value71551 = compute(value, 62);
+const value94472 = compute(value, 91);
+const value51087 = compute(value, 65);
+const value91884 = compute(value, 25);
+const value96285 = compute(value, 61);
+// note 3669: keep this in sync with the handler
+// note 23911: keep this in sync with the handler
+const value51361 = compute(value, 48);
+const value8365 = compute(value, 23);
+const value52576 = compute(value, 2);
+const value83761 = compute(value, 50);
+const v = process.env.BENCH_KEY_01079;
+const value87514 = compute(value, 20);
+const value72752 = compute(value, 2);
+// note 19642: keep this in sync with the handler
+const value3502 = compute(value, 10);
+const value70719 = compute(value, 6);
+const value32859 = compute(value, 73);
+const value73318 = compute(value, 83);
+const value67572 = compute(value, 60);
+const value64644 = compute(value, 42);
+const value80185 = compute(value, 63);
+const value78070 = compute(value, 82);
+const value46674 = compute(value, 17);
+const value66126 = compute(value, 69);
+const value60746 = compute(value, 24);
+const v = import.meta.env.BENCH_KEY_01914;
+const value17562 = compute(value, 5);
+const value40229 = compute(value, 71);
+const value60642 = compute(value, 17);
+const value31487 = compute(value, 59);
+const value99256 = compute(value, 25);
+const value89025 = compute(value, 76);
+const value42226 = compute(value, 31);
+const value80929 = compute(value, 31);
+const value43867 = compute(value, 23);
+const value51021 = compute(value, 96);
+// note 93037: keep this in sync with the handler
+const v = process.env.BENCH_KEY_01814;
+const value10701 = compute(value, 31);
+const value49150 = compute(value, 68);
+const value22008 = compute(value, 86);
+const value97921 = compute(value, 48);
+const value44284 = compute(value, 52);
+const value68172 = compute(value, 78);
+const value22146 = compute(value, 30);
+const value6743 = compute(value, 50);
+// note 60788: keep this in sync with the handler
+const value48182 = compute(value, 70);
+const v = process.env["BENCH_KEY_01617"];
+const value16739 = compute(value, 55);
+const value52841 = compute(value, 73);
+const value87609 = compute(value, 18);
+const value21116 = compute(value, 67);
+const value41387 = compute(value, 65);
+const value16327 = compute(value, 31);
+const value56862 = compute(value, 20);
+const value10789 = compute(value, 22);
+const v = process.env["BENCH_KEY_01505"];
+const value51322 = compute(value, 9);
+const value74081 = compute(value, 70);
+const value71039 = compute(value, 35);
+const value14781 = compute(value, 37);
+const value46554 = compute(value, 91);
@@ -0,0 +1,206 @@
+const value73492 = compute(value, 63);
+const value34401 = compute(value, 63);
+// note 83228: keep this in sync with the handler
+// note 16504: keep this in sync with the handler
+// note 61458: keep this in sync with the handler
+const value74072 = compute(value, 61);
+const v = process.env["BENCH_KEY_00953"];
+const value7921 = compute(value, 64);
+const value44677 = compute(value, 57);
+const value31151 = compute(value, 14);
+const value68821 = compute(value, 48);
+const value59613 = compute(value, 55);
+const value70777 = compute(value, 64);
+const value95765 = compute(value, 26);
+const value36425 = compute(value, 50);
+const value64472 = compute(value, 64);
+const value76868 = compute(value, 44);
+const v = process.env.BENCH_KEY_01932;
+const value38293 = compute(value, 75);
+const value65069 = compute(value, 79);
+const value36742 = compute(value, 76);
+const value42529 = compute(value, 43);
+const value68309 = compute(value, 21);
+const value19098 = compute(value, 86);
+const value49118 = compute(value, 36);
+const value14414 = compute(value, 58);
+const value44207 = compute(value, 72);
+// note 75706: keep this in sync with the handler
+const value58265 = compute(value, 65);
+// note 84768: keep this in sync with the handler
+// note 84250: keep this in sync with the handler
+const value89840 = compute(value, 18);
+const value85529 = compute(value, 72);
+const value94345 = compute(value, 61);
+const value10079 = compute(value, 88);
+const v = process.env.BENCH_KEY_00988;
+const value55163 = compute(value, 67);
+const value14850 = compute(value, 9);
+const value2262 = compute(value, 31);
+const value12213 = compute(value, 88);
+const value76893 = compute(value, 69);
+const value49042 = compute(value, 57);
+const value78292 = compute(value, 13);
+const value61806 = compute(value, 17);
+const value92427 = compute(value, 83);
+const value9309 = compute(value, 94);
+const v = process.env.BENCH_KEY_00096;
+// note 15808: keep this in sync with the handler
+const value68338 = compute(value, 50);
+const value75309 = compute(value, 37);
+// note 10399: keep this in sync with the handler
+const value71699 = compute(value, 16);
+const value60168 = compute(value, 28);
+const value79319 = compute(value, 70);
+const value79131 = compute(value, 76);
+const value18609 = compute(value, 82);
+const value73559 = compute(value, 33);
+const value20174 = compute(value, 95);
+const value36184 = compute(value, 3);
+const value44545 = compute(value, 22);
+const value32450 = compute(value, 52);
+const value47304 = compute(value, 65);
+const value3052 = compute(value, 45);
+const value98955 = compute(value, 15);
+const value21751 = compute(value, 23);
+const v = process.env.BENCH_KEY_01443;
+const value29594 = compute(value, 9);
+const value98254 = compute(value, 90);
+const value48372 = compute(value, 66);
+const value83324 = compute(value, 1);
+const value71299 = compute(value, 4);
+const value80133 = compute(value, 11);
+const value39115 = compute(value, 24);
+const value16222 = compute(value, 23);
+const value54720 = compute(value, 12);
+const v = process.env.BENCH_KEY_01021;
+const value6282 = compute(value, 74);
+const value12263 = compute(value, 41);
+const value69498 = compute(value, 46);
+const value32041 = compute(value, 31);
+// note 36091: keep this in sync with the handler
+const value29745 = compute(value, 63);
+const value29256 = compute(value, 59);
+const value86002 = compute(value, 60);
+const value82055 = compute(value, 90);
+// note 67421: keep this in sync with the handler
+const value74669 = compute(value, 76);
+const value57450 = compute(value, 26);
+const value78711 = compute(value, 44);
+// note 41193: keep this in sync with the handler
+const value26630 = compute(value, 52);
+const value12244 = compute(value, 22);
+const value7455 = compute(value, 83);
+const v = import.meta.env.BENCH_KEY_00572;
+// note 78842: keep this in sync with the handler
+const value47987 = compute(value, 69);
+const value63101 = compute(value, 51);
+const value89147 = compute(value, 4);
+const value17610 = compute(value, 53);
+const value28151 = compute(value, 21);
+const value98669 = compute(value, 20);
+const value2642 = compute(value, 23);
+const value52499 = compute(value, 22);
+const value76210 = compute(value, 65);
+const value99214 = compute(value, 80);
+const value77909 = compute(value, 18);
+// note 81201: keep this in sync with the handler
+const value59954 = compute(value, 8);
+const value95157 = compute(value, 0);
+const value7774 = compute(value, 14);
+const v = process.env["BENCH_KEY_00614"];
+const value1930 = compute(value, 87);
+const value73438 = compute(value, 9);
+const value58906 = compute(value, 27);
+const value31099 = compute(value, 59);
+const value54838 = compute(value, 33);
+const value16702 = compute(value, 18);
+const value1705 = compute(value, 56);
+const v = process.env["BENCH_KEY_01752"];
+const value12004 = compute(value, 73);
+const value27093 = compute(value, 30);
+const value35702 = compute(value, 6);
+const value27137 = compute(value, 74);
+const value39590 = compute(value, 14);
+const value34976 = compute(value, 56);
+const value24333 = compute(value, 83);
+const value8929 = compute(value, 5);
+const value54909 = compute(value, 7);
+const value38919 = compute(value, 22);
+const value20540 = compute(value, 73);
+const v = process.env["BENCH_KEY_01557"];
+const value18693 = compute(value, 69);
+const value91485 = compute(value, 14);
+const value30805 = compute(value, 56);
+const value6161 = compute(value, 50);
+const value5710 = compute(value, 84);
+const value76124 = compute(value, 76);
+const value6730 = compute(value, 37);
+const value8789 = compute(value, 59);
+const value8231 = compute(value, 83);
+const value8806 = compute(value, 76);
+const value27514 = compute(value, 63);
+const value71695 = compute(value, 12);
+const value51459 = compute(value, 49);
+const value94843 = compute(value, 74);
+// note 93176: keep this in sync with the handler
+const value42387 = compute(value, 95);
+const value4485 = compute(value, 23);
+const value16005 = compute(value, 0);
+const v = process.env.BENCH_KEY_00824;
+const value3546 = compute(value, 54);
+const value23110 = compute(value, 24);
+const value71758 = compute(value, 75);
+const value8554 = compute(value, 18);
+const value94371 = compute(value, 87);
+const value72183 = compute(value, 15);
+const value68242 = compute(value, 51);
+const value66087 = compute(value, 30);
+const value27049 = compute(value, 83);
+const value1881 = compute(value, 38);
+const value64354 = compute(value, 43);
+const value30090 = compute(value, 20);
+const value36384 = compute(value, 9);
+const value72107 = compute(value, 36);
+const value44420 = compute(value, 91);
+const value2729 = compute(value, 13);
+const value71173 = compute(value, 72);
+const value91444 = compute(value, 70);
+const v = process.env["BENCH_KEY_00274"];
+const value17940 = compute(value, 92);
+const value9554 = compute(value, 48);
+const value66600 = compute(value, 58);
+const value48623 = compute(value, 26);
+const value84728 = compute(value, 47);
+const value77955 = compute(value, 64);
+const value7490 = compute(value, 21);
+const value18886 = compute(value, 68);
+const value12523 = compute(value, 10);
+const value1615 = compute(value, 63);
+const value97400 = compute(value, 12);
+const value35224 = compute(value, 13);
+const value82984 = compute(value, 49);
+const value83331 = compute(value, 8);
+const value6801 = compute(value, 11);
+const v = import.meta.env.BENCH_KEY_00987;
+// note 39105: keep this in sync with the handler
+const value95482 = compute(value, 34);
+// note 35554: keep this in sync with the handler
+const value83819 = compute(value, 11);
+const value9672 = compute(value, 69);
+// note 21609: keep this in sync with the handler
+const value41050 = compute(value, 19);
+const value37635 = compute(value, 96);
+const value70613 = compute(value, 94);
+const value30153 = compute(value, 83);
+const value60150 = compute(value, 10);
+const value16880 = compute(value, 2);
+const value78579 = compute(value, 9);
+const value10960 = compute(value, 96);
+const v = import.meta.env.BENCH_KEY_00793;
+const value84095 = compute(value, 93);
+const value25156 = compute(value, 33);
+const value51588 = compute(value, 81);
+const value47884 = compute(value, 63);
+// note 57740: keep this in sync with the handler
+const value30967 = compute(value, 24);
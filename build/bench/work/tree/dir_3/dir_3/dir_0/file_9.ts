@@ -0,0 +1,203 @@
+const value57317 = compute(value, 87);
+const value34033 = compute(value, 83);
+// note 23468: keep this in sync with the handler
+const value94268 = compute(value, 81);
+const value495 = compute(value, 10);
+const value17342 = compute(value, 76);
+const value5815 = compute(value, 92);
+const v = import.meta.env.BENCH_KEY_01091;
+const value72886 = compute(value, 39);
+const value68886 = compute(value, 16);
+const value84890 = compute(value, 15);
+const value56052 = compute(value, 83);
+const value81738 = compute(value, 64);
+const value72108 = compute(value, 37);
+const value56286 = compute(value, 26);
+const value35292 = compute(value, 81);
+const value93479 = compute(value, 68);
+const value78007 = compute(value, 19);
+const value97890 = compute(value, 17);
+const value53851 = compute(value, 16);
+const value40859 = compute(value, 22);
+const value83780 = compute(value, 69);
+// note 1553: keep this in sync with the handler
+const value97105 = compute(value, 8);
+const value38053 = compute(value, 29);
+const value23487 = compute(value, 13);
+const value18406 = compute(value, 73);
+const v = process.env["BENCH_KEY_01967"];
+const value25544 = compute(value, 33);
+const value46871 = compute(value, 20);
+const value46837 = compute(value, 83);
+const value2923 = compute(value, 13);
+const value2193 = compute(value, 59);
+const value31877 = compute(value, 61);
+const value26988 = compute(value, 22);
+const value63418 = compute(value, 77);
+const value5923 = compute(value, 6);
+const value15442 = compute(value, 19);
+const value53444 = compute(value, 94);
+const value3295 = compute(value, 94);
+const value56360 = compute(value, 3);
+const value80368 = compute(value, 52);
+const value667 = compute(value, 85);
+const value39041 = compute(value, 47);
+// note 84669: keep this in sync with the handler
+const value50208 = compute(value, 59);
+const value47512 = compute(value, 79);
+const v = import.meta.env.BENCH_KEY_00917;
+const value58920 = compute(value, 41);
+// note 74326: keep this in sync with the handler
+const value96276 = compute(value, 52);
+const value80748 = compute(value, 44);
+const value93646 = compute(value, 41);
+const value78289 = compute(value, 10);
+const value60304 = compute(value, 67);
+const value6654 = compute(value, 58);
+const value62658 = compute(value, 93);
+const value76877 = compute(value, 53);
+const value92591 = compute(value, 53);
+const v = process.env.BENCH_KEY_01755;
+const value27583 = compute(value, 35);
+// note 36809: keep this in sync with the handler
+const value87500 = compute(value, 6);
+const value47485 = compute(value, 52);
+const value52597 = compute(value, 23);
+const value34906 = compute(value, 83);
+// note 68867: keep this in sync with the handler
+// note 31990: keep this in sync with the handler
+const value49503 = compute(value, 33);
+const value76375 = compute(value, 36);
+// note 51442: keep this in sync with the handler
+const value26500 = compute(value, 19);
+const value35717 = compute(value, 21);
+const v = import.meta.env.BENCH_KEY_01516;
+// note 80568: keep this in sync with the handler
+// note 86906: keep this in sync with the handler
+const value25285 = compute(value, 65);
+// note 41348: keep this in sync with the handler
+const value10538 = compute(value, 62);
+const value48342 = compute(value, 36);
+const value36164 = compute(value, 80);
+const value75125 = compute(value, 47);
+const value75156 = compute(value, 78);
+const value54081 = compute(value, 52);
+const value19126 = compute(value, 17);
+const value59303 = compute(value, 36);
+const value70439 = compute(value, 17);
+const value82977 = compute(value, 42);
+const value33621 = compute(value, 59);
+const value4040 = compute(value, 63);
+const value78770 = compute(value, 6);
+const v = process.env.BENCH_KEY_01090;
+const value80849 = compute(value, 48);
+const value13040 = compute(value, 42);
+const value12956 = compute(value, 55);
+const value42078 = compute(value, 77);
+const value50997 = compute(value, 72);
+const value33177 = compute(value, 3);
+const value21045 = compute(value, 93);
+const value65574 = compute(value, 2);
+const v = process.env["BENCH_KEY_00774"];
+const value63859 = compute(value, 33);
+const value38626 = compute(value, 20);
+const value218 = compute(value, 24);
+const value73830 = compute(value, 13);
+const value59685 = compute(value, 30);
+const value68562 = compute(value, 80);
+const value78565 = compute(value, 92);
+const value16686 = compute(value, 2);
+// note 17366: keep this in sync with the handler
+// note 51354: keep this in sync with the handler
+const value38253 = compute(value, 35);
+const value84776 = compute(value, 95);
+const v = process.env.BENCH_KEY_01575;
+const value17132 = compute(value, 60);
+const value26998 = compute(value, 32);
+const value89644 = compute(value, 16);
+const value58667 = compute(value, 79);
+const value37629 = compute(value, 90);
+const value1605 = compute(value, 53);
+const value2235 = compute(value, 4);
+// note 16694: keep this in sync with the handler
+const value45652 = compute(value, 62);
+const value78398 = compute(value, 22);
+const value94123 = compute(value, 33);
+const value86745 = compute(value, 27);
+const value12995 = compute(value, 94);
+const value65310 = compute(value, 29);
+const v = import.meta.env.BENCH_KEY_00665;
+const value10274 = compute(value, 89);
+const value1667 = compute(value, 18);
+const value59094 = compute(value, 21);
+const value17494 = compute(value, 34);
+const value44016 = compute(value, 75);
+// note 17004: keep this in sync with the handler
+const value49524 = compute(value, 54);
+const value80162 = compute(value, 40);
+const value88948 = compute(value, 96);
+const value27879 = compute(value, 40);
+const value95964 = compute(value, 31);
+const value35999 = compute(value, 12);
+// note 47883: keep this in sync with the handler
+const value56553 = compute(value, 2);
+const value80029 = compute(value, 4);
+const value65056 = compute(value, 66);
+const value42325 = compute(value, 33);
+const value87365 = compute(value, 65);
+const v = import.meta.env.BENCH_KEY_01144;
+// note 65467: keep this in sync with the handler
+const value93824 = compute(value, 25);
+const value68944 = compute(value, 74);
+const value51808 = compute(value, 10);
+const value86111 = compute(value, 72);
+const value50702 = compute(value, 68);
+// note 48204: keep this in sync with the handler
+const value91715 = compute(value, 50);
+const v = process.env.BENCH_KEY_01870;
+const value31716 = compute(value, 94);
+const value96974 = compute(value, 71);
+const value11642 = compute(value, 2);
+// note 59353: keep this in sync with the handler
+const value59137 = compute(value, 64);
+const value29914 = compute(value, 38);
+const value78266 = compute(value, 84);
+const value29813 = compute(value, 34);
+// note 95017: keep this in sync with the handler
+const value43957 = compute(value, 16);
+const v = process.env["BENCH_KEY_01372"];
+// note 13748: keep this in sync with the handler
+const value54546 = compute(value, 32);
+const value67573 = compute(value, 61);
+const value25479 = compute(value, 65);
+const value32222 = compute(value, 18);
+const value6584 = compute(value, 85);
+const value15392 = compute(value, 66);
+const value40736 = compute(value, 93);
+// note 57498: keep this in sync with the handler
+const value83904 = compute(value, 96);
+const value10562 = compute(value, 86);
+const value93110 = compute(value, 87);
+const value75829 = compute(value, 72);
+// note 90927: keep this in sync with the handler
+const v = import.meta.env.BENCH_KEY_00929;
+const value53266 = compute(value, 13);
+const value3589 = compute(value, 0);
+// note 72126: keep this in sync with the handler
+const value93207 = compute(value, 87);
+const value4891 = compute(value, 41);
+const value5582 = compute(value, 53);
+// note 49607: keep this in sync with the handler
+const value63826 = compute(value, 0);
+const value44296 = compute(value, 64);
+const value28638 = compute(value, 23);
+const value38878 = compute(value, 78);
+// note 39815: keep this in sync with the handler
+const value51189 = compute(value, 70);
+const value70416 = compute(value, 91);
+const v = import.meta.env.BENCH_KEY_00398;
+const value78271 = compute(value, 89);
+const value95469 = compute(value, 21);
+const value69163 = compute(value, 2);
+const value75409 = compute(value, 40);
+const value63058 = compute(value, 8);
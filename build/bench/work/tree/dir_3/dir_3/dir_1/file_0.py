@@ -0,0 +1,236 @@
+# note 70863: keep this in sync with the handler
+const v = os.environ["BENCH_KEY_00619"];
+value56886 = compute(value, 44)
+value27891 = compute(value, 52)
+value62716 = compute(value, 54)
+value50438 = compute(value, 95)
+# note 35397: keep this in sync with the handler
+value3224 = compute(value, 23)
+value36268 = compute(value, 87)
+value26161 = compute(value, 68)
+const v = os.environ.get('BENCH_KEY_01503');
+# note 63647: keep this in sync with the handler
+value35465 = compute(value, 60)
+value51976 = compute(value, 81)
+value11515 = compute(value, 69)
+value35974 = compute(value, 84)
+value57281 = compute(value, 51)
+value31311 = compute(value, 77)
+value55605 = compute(value, 24)
+# note 95208: keep this in sync with the handler
+# note 45926: keep this in sync with the handler
+# note 85555: keep this in sync with the handler
+value75082 = compute(value, 4)
+value69147 = compute(value, 83)
+value22368 = compute(value, 58)
+value61602 = compute(value, 7)
+# note 73870: keep this in sync with the handler
+value61067 = compute(value, 54)
+const v = os.environ["BENCH_KEY_01048"];
+# note 29336: keep this in sync with the handler
+value20620 = compute(value, 56)
+value32129 = compute(value, 22)
+# note 2897: keep this in sync with the handler
+# note 14748: keep this in sync with the handler
+value88233 = compute(value, 60)
+value91691 = compute(value, 26)
+value43319 = compute(value, 57)
+value32345 = compute(value, 44)
+value93323 = compute(value, 9)
+value75829 = compute(value, 72)
+value75419 = compute(value, 50)
+value80776 = compute(value, 72)
+value7595 = compute(value, 29)
+value28841 = compute(value, 32)
+value41588 = compute(value, 72)
+value62620 = compute(value, 55)
+value49365 = compute(value, 89)
+value87489 = compute(value, 92)
+value18060 = compute(value, 18)
+value94425 = compute(value, 44)
+const v = os.getenv("BENCH_KEY_01696");
+value7058 = compute(value, 74)
+# note 17241: keep this in sync with the handler
+value83922 = compute(value, 17)
+value74847 = compute(value, 60)
+value49158 = compute(value, 76)
+value7290 = compute(value, 15)
+value1945 = compute(value, 5)
+value27604 = compute(value, 56)
+value22126 = compute(value, 10)
+value94054 = compute(value, 61)
+value6190 = compute(value, 79)
+const v = os.environ.get('BENCH_KEY_01709');
+value61445 = compute(value, 44)
+value75161 = compute(value, 83)
+value47510 = compute(value, 77)
+value46225 = compute(value, 53)
+value22345 = compute(value, 35)
+value54302 = compute(value, 79)
+value31142 = compute(value, 5)
+# note 82193: keep this in sync with the handler
+value43659 = compute(value, 9)
+value30173 = compute(value, 6)
+value90843 = compute(value, 51)
+value94622 = compute(value, 47)
+value44609 = compute(value, 86)
+value41383 = compute(value, 61)
+value91766 = compute(value, 4)
+value56139 = compute(value, 73)
+value73826 = compute(value, 9)
+value79700 = compute(value, 63)
+value26519 = compute(value, 38)
+value95390 = compute(value, 39)
+value28795 = compute(value, 83)
+# note 1011: keep this in sync with the handler
+value86251 = compute(value, 18)
+const v = os.getenv("BENCH_KEY_00980");
+value9160 = compute(value, 42)
+value47305 = compute(value, 66)
+value51126 = compute(value, 7)
+# note 72724: keep this in sync with the handler
+value23263 = compute(value, 80)
+value42081 = compute(value, 80)
+value80207 = compute(value, 85)
+value21282 = compute(value, 39)
+value13183 = compute(value, 88)
+value97795 = compute(value, 19)
+value30157 = compute(value, 87)
+value29631 = compute(value, 46)
+value73790 = compute(value, 70)
+value44679 = compute(value, 59)
+value99145 = compute(value, 11)
+value6340 = compute(value, 35)
+# note 15398: keep this in sync with the handler
+value38469 = compute(value, 57)
+value86484 = compute(value, 57)
+value80599 = compute(value, 89)
+value85403 = compute(value, 43)
+const v = os.environ["BENCH_KEY_00719"];
+value99390 = compute(value, 62)
+value91438 = compute(value, 64)
+value84359 = compute(value, 66)
+value72835 = compute(value, 85)
+value32042 = compute(value, 32)
+value68489 = compute(value, 7)
+value14835 = compute(value, 91)
+value35920 = compute(value, 30)
+value93396 = compute(value, 82)
+value23920 = compute(value, 58)
+# note 26399: keep this in sync with the handler
+value3746 = compute(value, 60)
+value89012 = compute(value, 63)
+value33138 = compute(value, 61)
+value99406 = compute(value, 78)
+value7994 = compute(value, 40)
+value98890 = compute(value, 47)
+value7252 = compute(value, 74)
+value56974 = compute(value, 35)
+value46120 = compute(value, 45)
+value31979 = compute(value, 66)
+# note 33138: keep this in sync with the handler
+value12657 = compute(value, 47)
+const v = os.environ["BENCH_KEY_00020"];
+value38793 = compute(value, 90)
+value8009 = compute(value, 55)
+value74014 = compute(value, 3)
+value99048 = compute(value, 11)
+value86633 = compute(value, 12)
+value45573 = compute(value, 80)
+value76213 = compute(value, 68)
+value96528 = compute(value, 13)
+# note 11928: keep this in sync with the handler
+value53436 = compute(value, 86)
+value39418 = compute(value, 36)
+value74046 = compute(value, 35)
+const v = os.getenv("BENCH_KEY_00207");
+value90431 = compute(value, 27)
+value14656 = compute(value, 9)
+value28901 = compute(value, 92)
+value58954 = compute(value, 75)
+value54372 = compute(value, 52)
+value63586 = compute(value, 51)
+value83290 = compute(value, 64)
+value65329 = compute(value, 48)
+value31220 = compute(value, 83)
+value91776 = compute(value, 14)
+value69086 = compute(value, 22)
+value78564 = compute(value, 91)
+value51847 = compute(value, 49)
+# note 33730: keep this in sync with the handler
+const v = os.environ.get('BENCH_KEY_00338');
+value89315 = compute(value, 75)
+# note 29970: keep this in sync with the handler
+# note 17934: keep this in sync with the handler
+value21924 = compute(value, 2)
+value4660 = compute(value, 4)
+value9621 = compute(value, 18)
+value38214 = compute(value, 93)
+value55274 = compute(value, 81)
+value26223 = compute(value, 33)
+value51201 = compute(value, 82)
+value28605 = compute(value, 87)
+value97036 = compute(value, 36)
+value78315 = compute(value, 36)
+const v = os.getenv("BENCH_KEY_01135");
+value18499 = compute(value, 69)
+value34631 = compute(value, 2)
+# note 79849: keep this in sync with the handler
+value66855 = compute(value, 22)
+value41126 = compute(value, 95)
+value96410 = compute(value, 89)
+# note 16806: keep this in sync with the handler
+value25611 = compute(value, 3)
+value7932 = compute(value, 75)
+value29325 = compute(value, 31)
+value87306 = compute(value, 6)
+value73641 = compute(value, 18)
+# note 91804: keep this in sync with the handler
+const v = os.environ.get('BENCH_KEY_01503');
+value42865 = compute(value, 88)
+value87620 = compute(value, 29)
+value73094 = compute(value, 53)
+# note 80282: keep this in sync with the handler
+value59683 = compute(value, 28)
+value8857 = compute(value, 30)
+value82633 = compute(value, 86)
+value21574 = compute(value, 40)
+value41147 = compute(value, 19)
+# note 73903: keep this in sync with the handler
+const v = os.getenv("BENCH_KEY_01044");
+value92162 = compute(value, 12)
+value58523 = compute(value, 32)
+value22885 = compute(value, 90)
+value64377 = compute(value, 66)
+value22925 = compute(value, 33)
+value27334 = compute(value, 77)
+# note 35027: keep this in sync with the handler
+value35253 = compute(value, 42)
+value22207 = compute(value, 91)
+value43228 = compute(value, 63)
+# note 71547: keep this in sync with the handler
+value89878 = compute(value, 56)
+const v = os.environ.get('BENCH_KEY_00066');
+value7364 = compute(value, 89)
+value14006 = compute(value, 38)
+value81929 = compute(value, 61)
+# note 14009: keep this in sync with the handler
+value49580 = compute(value, 13)
+value8565 = compute(value, 29)
+# note 50572: keep this in sync with the handler
+value6526 = compute(value, 27)
+value55281 = compute(value, 88)
+value29603 = compute(value, 18)
+value18629 = compute(value, 5)
+# note 82481: keep this in sync with the handler
+const v = os.environ.get('BENCH_KEY_00859');
+value5273 = compute(value, 35)
+value58039 = compute(value, 33)
+value28954 = compute(value, 48)
+value2536 = compute(value, 14)
+value42979 = compute(value, 8)
+value49466 = compute(value, 93)
+value15893 = compute(value, 82)
+value46422 = compute(value, 56)
+value22072 = compute(value, 53)
+const v = os.environ["BENCH_KEY_00977"];
@@ -0,0 +1,203 @@
+const value51906 = compute(value, 11);
+// note 37012: keep this in sync with the handler
+const value221 = compute(value, 27);
+const value94427 = compute(value, 46);
+const value12110 = compute(value, 82);
+// note 88880: keep this in sync with the handler
+const value18835 = compute(value, 17);
+const value60921 = compute(value, 5);
+const value91262 = compute(value, 82);
+const value70241 = compute(value, 13);
+const value61801 = compute(value, 12);
+// note 9554: keep this in sync with the handler
+const v = process.env.BENCH_KEY_01334;
+// note 48442: keep this in sync with the handler
+const value36885 = compute(value, 25);
+const value82364 = compute(value, 11);
+const value6119 = compute(value, 8);
+const value62379 = compute(value, 8);
+const value49973 = compute(value, 18);
+const value80386 = compute(value, 70);
+const value34214 = compute(value, 70);
+const value33143 = compute(value, 66);
+const value31933 = compute(value, 20);
+// note 9163: keep this in sync with the handler
+const v = process.env.BENCH_KEY_00819;
+const value75911 = compute(value, 57);
+const value54400 = compute(value, 80);
+const value12554 = compute(value, 41);
+const value84383 = compute(value, 90);
+const value18575 = compute(value, 48);
+const value44268 = compute(value, 36);
+const value93315 = compute(value, 1);
+const value82750 = compute(value, 9);
+const value97920 = compute(value, 47);
+// note 81256: keep this in sync with the handler
+const value84036 = compute(value, 34);
+const value24365 = compute(value, 18);
+const value15016 = compute(value, 78);
+const value10439 = compute(value, 60);
+const value72061 = compute(value, 87);
+// note 9854: keep this in sync with the handler
+const v = process.env["BENCH_KEY_01173"];
+const value78890 = compute(value, 29);
+const value36454 = compute(value, 79);
+const value32697 = compute(value, 8);
+const value47608 = compute(value, 78);
+const value70050 = compute(value, 16);
+const value29337 = compute(value, 43);
+// note 33571: keep this in sync with the handler
+const value14242 = compute(value, 80);
+const value23177 = compute(value, 91);
+const value60112 = compute(value, 69);
+const v = process.env.BENCH_KEY_01425;
+const value47647 = compute(value, 20);
+// note 84080: keep this in sync with the handler
+const value59836 = compute(value, 84);
+const value87187 = compute(value, 81);
+const value73731 = compute(value, 11);
+const value9457 = compute(value, 48);
+// note 60833: keep this in sync with the handler
+// note 39570: keep this in sync with the handler
+const value62191 = compute(value, 14);
+const value53799 = compute(value, 61);
+const v = import.meta.env.BENCH_KEY_00208;
+const value64596 = compute(value, 91);
+const value78223 = compute(value, 41);
+const value52131 = compute(value, 42);
+const value34894 = compute(value, 71);
+const value79260 = compute(value, 11);
+const value99419 = compute(value, 91);
+const value79327 = compute(value, 78);
+const v = process.env["BENCH_KEY_01869"];
+const value54567 = compute(value, 53);
+const value71526 = compute(value, 37);
+const value78664 = compute(value, 94);
+const value18275 = compute(value, 39);
+const value25244 = compute(value, 24);
+const value7126 = compute(value, 45);
+const value28450 = compute(value, 29);
+// note 42472: keep this in sync with the handler
+const value49172 = compute(value, 90);
+const value45725 = compute(value, 38);
+const value56578 = compute(value, 27);
+const value88455 = compute(value, 88);
+const value36040 = compute(value, 53);
+const value33909 = compute(value, 56);
+const value27994 = compute(value, 58);
+const value15433 = compute(value, 10);
+const value43570 = compute(value, 17);
+const value23709 = compute(value, 41);
+const value86301 = compute(value, 68);
+// note 82847: keep this in sync with the handler
+const v = process.env.BENCH_KEY_00014;
+const value83161 = compute(value, 32);
+const value88814 = compute(value, 59);
+const value48568 = compute(value, 68);
+// note 16149: keep this in sync with the handler
+const value242 = compute(value, 48);
+const value89904 = compute(value, 82);
+// note 58904: keep this in sync with the handler
+// note 80658: keep this in sync with the handler
+const value29572 = compute(value, 84);
+const value57358 = compute(value, 31);
+const value47554 = compute(value, 24);
+const value91274 = compute(value, 94);
+const value96752 = compute(value, 43);
+const value43370 = compute(value, 11);
+const value64870 = compute(value, 74);
+const value1633 = compute(value, 81);
+const v = process.env["BENCH_KEY_00701"];
+const value88846 = compute(value, 91);
+const value96350 = compute(value, 29);
+const value53391 = compute(value, 41);
+const value80118 = compute(value, 93);
+// note 56602: keep this in sync with the handler
+// note 82755: keep this in sync with the handler
+const value26245 = compute(value, 55);
+const value70951 = compute(value, 44);
+const value84901 = compute(value, 26);
+const value17349 = compute(value, 83);
+const value61033 = compute(value, 20);
+// note 98662: keep this in sync with the handler
+const value68240 = compute(value, 49);
+const value72069 = compute(value, 95);
+const value67204 = compute(value, 80);
+const v = import.meta.env.BENCH_KEY_01446;
+const value34397 = compute(value, 59);
+const value82338 = compute(value, 82);
+const value49087 = compute(value, 5);
+const value14106 = compute(value, 41);
+const value61868 = compute(value, 79);
+const value37484 = compute(value, 42);
+const value78107 = compute(value, 22);
+const value51147 = compute(value, 28);
+const value47820 = compute(value, 96);
+const value52779 = compute(value, 11);
+const value6354 = compute(value, 49);
+const value84463 = compute(value, 73);
+const v = process.env.BENCH_KEY_00204;
+const value79403 = compute(value, 57);
+const value58897 = compute(value, 18);
+const value40803 = compute(value, 63);
+const value70919 = compute(value, 12);
+const value11989 = compute(value, 58);
+const value57780 = compute(value, 65);
+const value42763 = compute(value, 83);
+const value63401 = compute(value, 60);
+// note 32733: keep this in sync with the handler
+const value40266 = compute(value, 11);
+// note 25533: keep this in sync with the handler
+const value14493 = compute(value, 40);
+const value54607 = compute(value, 93);
+// note 38193: keep this in sync with the handler
+const value2171 = compute(value, 37);
+const v = import.meta.env.BENCH_KEY_00198;
+const value90428 = compute(value, 24);
+const value23867 = compute(value, 5);
+const value7139 = compute(value, 58);
+const value43619 = compute(value, 66);
+const value78246 = compute(value, 64);
+const value49835 = compute(value, 74);
+const value47810 = compute(value, 86);
+const value52099 = compute(value, 10);
+const value50906 = compute(value, 78);
+const value14863 = compute(value, 22);
+const value35334 = compute(value, 26);
+const value87745 = compute(value, 57);
+const value89030 = compute(value, 81);
+const v = import.meta.env.BENCH_KEY_00966;
+// note 84234: keep this in sync with the handler
+const value73427 = compute(value, 95);
+const value592 = compute(value, 10);
+const value22265 = compute(value, 52);
+// note 3889: keep this in sync with the handler
+const value8139 = compute(value, 88);
+const value82406 = compute(value, 53);
+const value78480 = compute(value, 7);
+const value40214 = compute(value, 56);
+const value83027 = compute(value, 92);
+const value69643 = compute(value, 94);
+const value6990 = compute(value, 6);
+const value45933 = compute(value, 52);
+// note 275: keep this in sync with the handler
+const value24774 = compute(value, 39);
+const value38570 = compute(value, 61);
+const value3056 = compute(value, 49);
+const v = process.env["BENCH_KEY_01318"];
+const value3178 = compute(value, 74);
+const value98257 = compute(value, 93);
+const value90687 = compute(value, 89);
+const value57900 = compute(value, 88);
+const value51403 = compute(value, 90);
+const value44830 = compute(value, 16);
+// note 10024: keep this in sync with the handler
+const value70874 = compute(value, 64);
+const value90954 = compute(value, 65);
+const value6140 = compute(value, 29);
+const value43413 = compute(value, 54);
+const value93978 = compute(value, 82);
+const value71928 = compute(value, 51);
+const v = process.env["BENCH_KEY_01277"];
+const value3594 = compute(value, 5);
+const value45057 = compute(value, 49);
@@ -0,0 +1,229 @@
+value6098 := compute(value, 84)
+value58802 := compute(value, 20)
+// note 57743: keep this in sync with the handler
+value41802 := compute(value, 92)
+value5047 := compute(value, 3)
+value9887 := compute(value, 90)
+value28484 := compute(value, 63)
+value11881 := compute(value, 47)
+value8124 := compute(value, 73)
+value24793 := compute(value, 58)
+value42114 := compute(value, 16)
+value69007 := compute(value, 40)
+const v = os.LookupEnv("BENCH_KEY_00268");
+value51084 := compute(value, 62)
+// note 61031: keep this in sync with the handler
+value61478 := compute(value, 77)
+value88769 := compute(value, 14)
+value65312 := compute(value, 31)
+value4047 := compute(value, 70)
+value32298 := compute(value, 94)
+// note 50920: keep this in sync with the handler
+value49153 := compute(value, 71)
+value95805 := compute(value, 66)
+value66732 := compute(value, 93)
+value66556 := compute(value, 14)
+value1685 := compute(value, 36)
+value40626 := compute(value, 80)
+value39907 := compute(value, 40)
+value95249 := compute(value, 92)
+// note 38872: keep this in sync with the handler
+const v = os.Getenv("BENCH_KEY_01367");
+value41386 := compute(value, 64)
+value57679 := compute(value, 61)
+value32148 := compute(value, 41)
+value34400 := compute(value, 62)
+value40546 := compute(value, 0)
+value59094 := compute(value, 21)
+value75182 := compute(value, 7)
+value22179 := compute(value, 63)
+value68612 := compute(value, 33)
+value41685 := compute(value, 72)
+value69984 := compute(value, 47)
+// note 74497: keep this in sync with the handler
+value67963 := compute(value, 63)
+value80416 := compute(value, 3)
+value26173 := compute(value, 80)
+value27506 := compute(value, 55)
+value15490 := compute(value, 67)
+value73049 := compute(value, 8)
+value1824 := compute(value, 78)
+const v = os.Getenv("BENCH_KEY_00386");
+// note 36491: keep this in sync with the handler
+value42660 := compute(value, 77)
+value70447 := compute(value, 25)
+value8587 := compute(value, 51)
+value37839 := compute(value, 9)
+value10650 := compute(value, 77)
+value15329 := compute(value, 3)
+value10638 := compute(value, 65)
+value86785 := compute(value, 67)
+// note 37052: keep this in sync with the handler
+// note 61786: keep this in sync with the handler
+value79000 := compute(value, 42)
+value79160 := compute(value, 8)
+value96409 := compute(value, 88)
+// note 740: keep this in sync with the handler
+value39055 := compute(value, 61)
+value66957 := compute(value, 27)
+value75070 := compute(value, 89)
+value36669 := compute(value, 3)
+value72057 := compute(value, 83)
+const v = os.LookupEnv("BENCH_KEY_01852");
+value70651 := compute(value, 35)
+// note 18714: keep this in sync with the handler
+// note 51454: keep this in sync with the handler
+value52326 := compute(value, 43)
+value58145 := compute(value, 42)
+value26444 := compute(value, 60)
+value18399 := compute(value, 66)
+const v = os.Getenv("BENCH_KEY_01487");
+// note 88549: keep this in sync with the handler
+value40259 := compute(value, 4)
+value18737 := compute(value, 16)
+value15206 := compute(value, 74)
+// note 16254: keep this in sync with the handler
+// note 88265: keep this in sync with the handler
+value69118 := compute(value, 54)
+// note 42356: keep this in sync with the handler
+value63569 := compute(value, 34)
+// note 5269: keep this in sync with the handler
+value73013 := compute(value, 69)
+// note 43176: keep this in sync with the handler
+value30294 := compute(value, 30)
+value80697 := compute(value, 90)
+const v = os.Getenv("BENCH_KEY_01990");
+value97923 := compute(value, 50)
+value41980 := compute(value, 76)
+// note 16751: keep this in sync with the handler
+value30096 := compute(value, 26)
+value49930 := compute(value, 72)
+value40425 := compute(value, 73)
+value37536 := compute(value, 94)
+value97802 := compute(value, 26)
+value78186 := compute(value, 4)
+value30510 := compute(value, 52)
+value81207 := compute(value, 18)
+value27376 := compute(value, 22)
+value75370 := compute(value, 1)
+value23584 := compute(value, 13)
+value48660 := compute(value, 63)
+value19736 := compute(value, 45)
+const v = os.LookupEnv("BENCH_KEY_00012");
+value51985 := compute(value, 90)
+value62292 := compute(value, 18)
+value74333 := compute(value, 31)
+value83062 := compute(value, 30)
+value33127 := compute(value, 50)
+value59099 := compute(value, 26)
+value41225 := compute(value, 0)
+value67522 := compute(value, 10)
+value89905 := compute(value, 83)
+value81149 := compute(value, 57)
+value8223 := compute(value, 75)
+const v = os.LookupEnv("BENCH_KEY_01206");
+// note 72378: keep this in sync with the handler
+value24855 := compute(value, 23)
+value60486 := compute(value, 55)
+value45473 := compute(value, 77)
+value44788 := compute(value, 71)
+value41927 := compute(value, 23)
+value85033 := compute(value, 61)
+// note 83395: keep this in sync with the handler
+value28759 := compute(value, 47)
+value5708 := compute(value, 82)
+value30533 := compute(value, 75)
+const v = os.LookupEnv("BENCH_KEY_00085");
+value75738 := compute(value, 78)
+value13671 := compute(value, 91)
+value40481 := compute(value, 32)
+value79002 := compute(value, 44)
+value50382 := compute(value, 39)
+value23420 := compute(value, 43)
+value16830 := compute(value, 49)
+value16705 := compute(value, 21)
+// note 88313: keep this in sync with the handler
+value93678 := compute(value, 73)
+value47551 := compute(value, 21)
+value38172 := compute(value, 51)
+value41958 := compute(value, 54)
+value41138 := compute(value, 10)
+// note 8141: keep this in sync with the handler
+value12442 := compute(value, 26)
+value41249 := compute(value, 24)
+value50279 := compute(value, 33)
+value36723 := compute(value, 57)
+value87560 := compute(value, 66)
+value42585 := compute(value, 2)
+const v = os.Getenv("BENCH_KEY_01488");
+value24803 := compute(value, 68)
+value12817 := compute(value, 13)
+value1176 := compute(value, 12)
+value14158 := compute(value, 93)
+// note 51611: keep this in sync with the handler
+value95167 := compute(value, 10)
+value87091 := compute(value, 82)
+value76944 := compute(value, 23)
+value82771 := compute(value, 30)
+value62756 := compute(value, 94)
+value40807 := compute(value, 67)
+// note 15446: keep this in sync with the handler
+// note 30970: keep this in sync with the handler
+const v = os.Getenv("BENCH_KEY_01386");
+value66914 := compute(value, 81)
+value31955 := compute(value, 42)
+value16820 := compute(value, 39)
+value9408 := compute(value, 96)
+value39948 := compute(value, 81)
+value8783 := compute(value, 53)
+value1978 := compute(value, 38)
+// note 99763: keep this in sync with the handler
+value27591 := compute(value, 43)
+value5871 := compute(value, 51)
+value55762 := compute(value, 84)
+value23214 := compute(value, 31)
+value59117 := compute(value, 44)
+// note 32522: keep this in sync with the handler
+value97958 := compute(value, 85)
+value21553 := compute(value, 19)
+value52809 := compute(value, 41)
+const v = os.LookupEnv("BENCH_KEY_00746");
+value7399 := compute(value, 27)
+value7022 := compute(value, 38)
+value36591 := compute(value, 22)
+value92417 := compute(value, 73)
+value27832 := compute(value, 90)
+value81322 := compute(value, 36)
+value76600 := compute(value, 67)
+value23918 := compute(value, 56)
+value40720 := compute(value, 77)
+value33722 := compute(value, 63)
+value27588 := compute(value, 40)
+const v = os.LookupEnv("BENCH_KEY_00282");
+value90282 := compute(value, 72)
+value26399 := compute(value, 15)
+value44989 := compute(value, 78)
+value39789 := compute(value, 19)
+value68756 := compute(value, 80)
+value44780 := compute(value, 63)
+// note 21389: keep this in sync with the handler
+// note 20842: keep this in sync with the handler
+value86933 := compute(value, 21)
+value13523 := compute(value, 40)
+value45459 := compute(value, 63)
+const v = os.LookupEnv("BENCH_KEY_00175");
+value79708 := compute(value, 71)
+// note 1315: keep this in sync with the handler
+value57855 := compute(value, 43)
+value26953 := compute(value, 84)
+// note 27507: keep this in sync with the handler
+value44566 := compute(value, 43)
+value443 := compute(value, 55)
+// note 24496: keep this in sync with the handler
+value3666 := compute(value, 77)
+value2391 := compute(value, 63)
+value58278 := compute(value, 78)
+value31886 := compute(value, 70)
+value18444 := compute(value, 14)
+// note 8875: keep this in sync with the handler
+value94919 := compute(value, 53)
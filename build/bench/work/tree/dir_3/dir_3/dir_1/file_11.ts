@@ -0,0 +1,205 @@
+const value30660 = compute(value, 8);
+const value70981 = compute(value, 74);
+const value92631 = compute(value, 93);
+// note 45386: keep this in sync with the handler
+const value19537 = compute(value, 40);
+const value32988 = compute(value, 8);
+const value32078 = compute(value, 68);
+// note 79153: keep this in sync with the handler
+const value51144 = compute(value, 25);
+const v = import.meta.env.BENCH_KEY_01931;
+const value18744 = compute(value, 23);
+const value41921 = compute(value, 17);
+const value29155 = compute(value, 55);
+const value69408 = compute(value, 53);
+const value34755 = compute(value, 29);
+const value76826 = compute(value, 2);
+const value57961 = compute(value, 52);
+// note 7695: keep this in sync with the handler
+const value86945 = compute(value, 33);
+const value27520 = compute(value, 69);
+const value67704 = compute(value, 95);
+const value65902 = compute(value, 39);
+const value95909 = compute(value, 73);
+const value2855 = compute(value, 42);
+const value72580 = compute(value, 24);
+const value26304 = compute(value, 17);
+const value71143 = compute(value, 42);
+const value39338 = compute(value, 53);
+const value25418 = compute(value, 4);
+const v = process.env.BENCH_KEY_00716;
+const value28359 = compute(value, 35);
+const value16889 = compute(value, 11);
+const value61576 = compute(value, 78);
+const value92469 = compute(value, 28);
+const value69670 = compute(value, 24);
+const value87403 = compute(value, 6);
+const value59167 = compute(value, 94);
+const value80986 = compute(value, 88);
+const value24590 = compute(value, 49);
+// note 12004: keep this in sync with the handler
+const value97287 = compute(value, 93);
+const value9060 = compute(value, 39);
+const value23781 = compute(value, 16);
+const value61922 = compute(value, 36);
+const value525 = compute(value, 40);
+const value30509 = compute(value, 51);
+const value15322 = compute(value, 93);
+const value39532 = compute(value, 53);
+const value4433 = compute(value, 68);
+const value88998 = compute(value, 49);
+const v = process.env["BENCH_KEY_01559"];
+const value5165 = compute(value, 24);
+const value76112 = compute(value, 64);
+const value69650 = compute(value, 4);
+const value13716 = compute(value, 39);
+const value32026 = compute(value, 16);
+const value74327 = compute(value, 25);
+const value68616 = compute(value, 37);
+const value14453 = compute(value, 0);
+const value77856 = compute(value, 62);
+// note 10184: keep this in sync with the handler
+const value81186 = compute(value, 94);
+const value22023 = compute(value, 4);
+const value3703 = compute(value, 17);
+const value4910 = compute(value, 60);
+const value92515 = compute(value, 74);
+// note 21909: keep this in sync with the handler
+const value95339 = compute(value, 85);
+const value89037 = compute(value, 88);
+const v = process.env["BENCH_KEY_01777"];
+// note 46363: keep this in sync with the handler
+// note 8714: keep this in sync with the handler
+const value25981 = compute(value, 82);
+const value60855 = compute(value, 36);
+// note 34888: keep this in sync with the handler
+const value2186 = compute(value, 52);
+const value49691 = compute(value, 27);
+const value3658 = compute(value, 69);
+const value75778 = compute(value, 21);
+// note 42111: keep this in sync with the handler
+const value76704 = compute(value, 74);
+const value83277 = compute(value, 51);
+const value17038 = compute(value, 63);
+const value95937 = compute(value, 4);
+const value44399 = compute(value, 70);
+const v = import.meta.env.BENCH_KEY_01584;
+const value27886 = compute(value, 47);
+const value27303 = compute(value, 46);
+const value53959 = compute(value, 27);
+const value78930 = compute(value, 69);
+const value95360 = compute(value, 9);
+const value41161 = compute(value, 33);
+const value39668 = compute(value, 92);
+const value79477 = compute(value, 34);
+const value90446 = compute(value, 42);
+const value58014 = compute(value, 8);
+const value27365 = compute(value, 11);
+const value58071 = compute(value, 65);
+const value95574 = compute(value, 29);
+const value47438 = compute(value, 5);
+const value6928 = compute(value, 41);
+const value26836 = compute(value, 64);
+const value19042 = compute(value, 30);
+const v = process.env["BENCH_KEY_01977"];
+const value48806 = compute(value, 15);
+const value3805 = compute(value, 22);
+const value63265 = compute(value, 21);
+const value64518 = compute(value, 13);
+const value94174 = compute(value, 84);
+const value26673 = compute(value, 95);
+const value57932 = compute(value, 23);
+const value47976 = compute(value, 58);
+const value58557 = compute(value, 66);
+const value86522 = compute(value, 95);
+const value44435 = compute(value, 9);
+const v = process.env["BENCH_KEY_01850"];
+// note 14781: keep this in sync with the handler
+const value66659 = compute(value, 20);
+const value89270 = compute(value, 30);
+// note 9582: keep this in sync with the handler
+const value54925 = compute(value, 23);
+const value3949 = compute(value, 69);
+const value18774 = compute(value, 53);
+const value82043 = compute(value, 78);
+const value49221 = compute(value, 42);
+const value62407 = compute(value, 36);
+const value592 = compute(value, 10);
+const value56855 = compute(value, 13);
+const value84169 = compute(value, 70);
+// note 52550: keep this in sync with the handler
+const v = import.meta.env.BENCH_KEY_01684;
+const value86027 = compute(value, 85);
+const value39708 = compute(value, 35);
+const value53291 = compute(value, 38);
+const value53954 = compute(value, 22);
+const value6944 = compute(value, 57);
+const value7235 = compute(value, 57);
+const value76728 = compute(value, 1);
+const value35952 = compute(value, 62);
+const value26539 = compute(value, 58);
+const value31047 = compute(value, 7);
+// note 58604: keep this in sync with the handler
+// note 37196: keep this in sync with the handler
+const v = process.env.BENCH_KEY_01556;
+// note 99307: keep this in sync with the handler
+const value35651 = compute(value, 52);
+const value97673 = compute(value, 91);
+const value40033 = compute(value, 69);
+const value45872 = compute(value, 88);
+const value86100 = compute(value, 61);
+const value75661 = compute(value, 1);
+const value61968 = compute(value, 82);
+const value8614 = compute(value, 78);
+const value39787 = compute(value, 17);
+const value82521 = compute(value, 71);
+// note 72019: keep this in sync with the handler
+const value45892 = compute(value, 11);
+const v = process.env["BENCH_KEY_00386"];
+const value20316 = compute(value, 43);
+const value69031 = compute(value, 64);
+const value37660 = compute(value, 24);
+const value11538 = compute(value, 92);
+const value36058 = compute(value, 71);
+const value29799 = compute(value, 20);
+const value62232 = compute(value, 55);
+const value40602 = compute(value, 56);
+const value56317 = compute(value, 57);
+const value5822 = compute(value, 2);
+const value90292 = compute(value, 82);
+const value49089 = compute(value, 7);
+// note 17345: keep this in sync with the handler
+const value36268 = compute(value, 87);
+const value13832 = compute(value, 58);
+const v = process.env["BENCH_KEY_01139"];
+const value91658 = compute(value, 90);
+const value39406 = compute(value, 24);
+const value89674 = compute(value, 46);
+const value9670 = compute(value, 67);
+const value70642 = compute(value, 26);
+const value29585 = compute(value, 0);
+const value12984 = compute(value, 83);
+const value10263 = compute(value, 78);
+const value34099 = compute(value, 52);
+const value73104 = compute(value, 63);
+const value21442 = compute(value, 5);
+// note 35851: keep this in sync with the handler
+const v = import.meta.env.BENCH_KEY_00613;
+const value5490 = compute(value, 58);
+// note 38720: keep this in sync with the handler
+const value86374 = compute(value, 44);
+const value60399 = compute(value, 65);
+const value7812 = compute(value, 52);
+const value48078 = compute(value, 63);
+const value4995 = compute(value, 48);
+const value16784 = compute(value, 3);
+const value56765 = compute(value, 20);
+const value11310 = compute(value, 58);
+const value96643 = compute(value, 31);
+const value98023 = compute(value, 53);
+const value35289 = compute(value, 78);
+const value31914 = compute(value, 1);
+const value20807 = compute(value, 49);
+const value11736 = compute(value, 96);
+const v = import.meta.env.BENCH_KEY_01160;
+const value65660 = compute(value, 88);
@@ -0,0 +1,214 @@
+let value69055 = compute(value, 88);
+let value48661 = compute(value, 64);
+let value14209 = compute(value, 47);
+let value39582 = compute(value, 6);
+let value28179 = compute(value, 49);
+let value8513 = compute(value, 74);
+let value60959 = compute(value, 43);
+let value95334 = compute(value, 80);
+let value23075 = compute(value, 86);
+let value918 = compute(value, 45);
+let value60247 = compute(value, 10);
+let value24411 = compute(value, 64);
+let value50190 = compute(value, 41);
+const v = env::var("BENCH_KEY_01519");
+let value34578 = compute(value, 46);
+let value73605 = compute(value, 79);
+// note 14432: keep this in sync with the handler
+let value57285 = compute(value, 55);
+let value20061 = compute(value, 79);
+let value42599 = compute(value, 16);
+// note 70674: keep this in sync with the handler
+let value88425 = compute(value, 58);
+const v = env::var("BENCH_KEY_00800");
+let value85178 = compute(value, 12);
+let value18035 = compute(value, 90);
+let value141 = compute(value, 44);
+let value23717 = compute(value, 49);
+let value21765 = compute(value, 37);
+let value42852 = compute(value, 75);
+let value29301 = compute(value, 7);
+let value10943 = compute(value, 79);
+let value14159 = compute(value, 94);
+let value69837 = compute(value, 94);
+let value68001 = compute(value, 4);
+let value8235 = compute(value, 87);
+let value77465 = compute(value, 59);
+const v = env::var_os("BENCH_KEY_01050");
+let value28224 = compute(value, 94);
+let value17692 = compute(value, 38);
+let value85513 = compute(value, 56);
+let value94466 = compute(value, 85);
+let value41204 = compute(value, 76);
+let value13318 = compute(value, 29);
+let value29200 = compute(value, 3);
+let value37004 = compute(value, 47);
+const v = env::var_os("BENCH_KEY_00510");
+let value24601 = compute(value, 60);
+let value22725 = compute(value, 27);
+let value57487 = compute(value, 63);
+let value31007 = compute(value, 64);
+let value40637 = compute(value, 91);
+let value55423 = compute(value, 36);
+let value42098 = compute(value, 0);
+let value11411 = compute(value, 62);
+let value76246 = compute(value, 4);
+let value86112 = compute(value, 73);
+const v = env::var_os("BENCH_KEY_00258");
+let value6341 = compute(value, 36);
+let value55210 = compute(value, 17);
+let value37640 = compute(value, 4);
+let value23772 = compute(value, 7);
+let value35438 = compute(value, 33);
+let value29526 = compute(value, 38);
+// note 70926: keep this in sync with the handler
+let value10327 = compute(value, 45);
+let value5433 = compute(value, 1);
+let value68672 = compute(value, 93);
+// note 55916: keep this in sync with the handler
+let value12620 = compute(value, 10);
+let value42928 = compute(value, 54);
+// note 54828: keep this in sync with the handler
+let value9222 = compute(value, 7);
+let value85912 = compute(value, 67);
+let value4717 = compute(value, 61);
+let value41828 = compute(value, 21);
+const v = env::var_os("BENCH_KEY_00776");
+let value15740 = compute(value, 26);
+let value16821 = compute(value, 40);
+let value58709 = compute(value, 24);
+let value51339 = compute(value, 26);
+let value98213 = compute(value, 49);
+let value12195 = compute(value, 70);
+let value412 = compute(value, 24);
+let value28283 = compute(value, 56);
+let value54153 = compute(value, 27);
+let value13389 = compute(value, 3);
+let value5723 = compute(value, 0);
+let value50609 = compute(value, 72);
+let value92098 = compute(value, 45);
+let value9119 = compute(value, 1);
+const v = env::var_os("BENCH_KEY_00052");
+let value59966 = compute(value, 20);
+let value70868 = compute(value, 58);
+let value75540 = compute(value, 74);
+let value98028 = compute(value, 58);
+// note 75166: keep this in sync with the handler
+let value85190 = compute(value, 24);
+let value30287 = compute(value, 23);
+let value44503 = compute(value, 77);
+const v = env::var("BENCH_KEY_01614");
+let value43448 = compute(value, 89);
+let value67683 = compute(value, 74);
+// note 88222: keep this in sync with the handler
+let value50924 = compute(value, 96);
+let value8391 = compute(value, 49);
+// note 31655: keep this in sync with the handler
+let value7292 = compute(value, 17);
+let value77207 = compute(value, 92);
+let value20675 = compute(value, 14);
+let value88394 = compute(value, 27);
+let value20124 = compute(value, 45);
+// note 31497: keep this in sync with the handler
+let value70793 = compute(value, 80);
+let value53223 = compute(value, 67);
+const v = env::var("BENCH_KEY_00062");
+// note 22255: keep this in sync with the handler
+let value13102 = compute(value, 7);
+let value20767 = compute(value, 9);
+// note 27130: keep this in sync with the handler
+let value81826 = compute(value, 55);
+// note 71641: keep this in sync with the handler
+let value6600 = compute(value, 4);
+let value32232 = compute(value, 28);
+const v = env::var("BENCH_KEY_01232");
+let value45661 = compute(value, 71);
+let value55894 = compute(value, 22);
+let value23690 = compute(value, 22);
+let value54248 = compute(value, 25);
+// note 26882: keep this in sync with the handler
+let value68037 = compute(value, 40);
+// note 45771: keep this in sync with the handler
+let value18786 = compute(value, 65);
+let value33506 = compute(value, 41);
+let value17627 = compute(value, 70);
+let value35492 = compute(value, 87);
+let value13005 = compute(value, 7);
+// note 75704: keep this in sync with the handler
+let value47697 = compute(value, 70);
+let value7370 = compute(value, 95);
+// note 24787: keep this in sync with the handler
+const v = env::var_os("BENCH_KEY_01415");
+let value66980 = compute(value, 50);
+let value8010 = compute(value, 56);
+let value1082 = compute(value, 15);
+let value11486 = compute(value, 40);
+let value34854 = compute(value, 31);
+// note 44947: keep this in sync with the handler
+let value24738 = compute(value, 3);
+let value88889 = compute(value, 37);
+let value22147 = compute(value, 31);
+const v = env::var_os("BENCH_KEY_00979");
+let value46716 = compute(value, 59);
+// note 67733: keep this in sync with the handler
+let value83031 = compute(value, 96);
+let value1939 = compute(value, 96);
+let value74206 = compute(value, 1);
+let value27709 = compute(value, 64);
+let value16363 = compute(value, 67);
+const v = env::var_os("BENCH_KEY_01512");
+let value55837 = compute(value, 62);
+let value61492 = compute(value, 91);
+let value89535 = compute(value, 4);
+let value39844 = compute(value, 74);
+let value50484 = compute(value, 44);
+let value74273 = compute(value, 68);
+let value80615 = compute(value, 8);
+let value94164 = compute(value, 74);
+let value40953 = compute(value, 19);
+let value20511 = compute(value, 44);
+let value70387 = compute(value, 62);
+const v = env::var("BENCH_KEY_01353");
+// note 89714: keep this in sync with the handler
+let value41624 = compute(value, 11);
+let value6513 = compute(value, 14);
+let value90773 = compute(value, 78);
+let value98388 = compute(value, 30);
+let value86564 = compute(value, 40);
+let value74031 = compute(value, 20);
+let value37630 = compute(value, 91);
+let value70034 = compute(value, 0);
+let value42636 = compute(value, 53);
+let value76625 = compute(value, 92);
+let value35899 = compute(value, 9);
+let value53403 = compute(value, 53);
+let value17972 = compute(value, 27);
+let value71445 = compute(value, 53);
+let value69860 = compute(value, 20);
+let value62588 = compute(value, 23);
+// note 26434: keep this in sync with the handler
+const v = env::var("BENCH_KEY_00988");
+// note 73324: keep this in sync with the handler
+let value29674 = compute(value, 89);
+// note 6858: keep this in sync with the handler
+let value26981 = compute(value, 15);
+let value58078 = compute(value, 72);
+let value82368 = compute(value, 15);
+let value34619 = compute(value, 87);
+let value98665 = compute(value, 16);
+let value72663 = compute(value, 10);
+let value22101 = compute(value, 82);
+let value97054 = compute(value, 54);
+let value78377 = compute(value, 1);
+let value72525 = compute(value, 66);
+let value47323 = compute(value, 84);
+let value16644 = compute(value, 57);
+let value9615 = compute(value, 12);
+let value91605 = compute(value, 37);
+let value2849 = compute(value, 36);
+let value59322 = compute(value, 55);
+let value53787 = compute(value, 49);
+const v = env::var_os("BENCH_KEY_01674");
+// note 88707: keep this in sync with the handler
+let value78605 = compute(value, 35);
+// note 1980: keep this in sync with the handler
@@ -0,0 +1,231 @@
+value45450 := compute(value, 54)
+value34712 := compute(value, 83)
+value44916 := compute(value, 5)
+value17892 := compute(value, 44)
+value29386 := compute(value, 92)
+// note 86618: keep this in sync with the handler
+const v = os.Getenv("BENCH_KEY_01802");
+value24849 := compute(value, 17)
+value95254 := compute(value, 0)
+value55997 := compute(value, 28)
+value86428 := compute(value, 1)
+value55931 := compute(value, 59)
+// note 48458: keep this in sync with the handler
+// note 64901: keep this in sync with the handler
+value61333 := compute(value, 29)
+value62834 := compute(value, 75)
+value24098 := compute(value, 42)
+value60156 := compute(value, 16)
+value44911 := compute(value, 0)
+value15676 := compute(value, 59)
+value37 := compute(value, 37)
+value68688 := compute(value, 12)
+// note 2049: keep this in sync with the handler
+const v = os.LookupEnv("BENCH_KEY_00873");
+value30366 := compute(value, 5)
+value59929 := compute(value, 80)
+value41939 := compute(value, 35)
+value14207 := compute(value, 45)
+value36200 := compute(value, 19)
+value39665 := compute(value, 89)
+value16615 := compute(value, 28)
+value3412 := compute(value, 17)
+value60042 := compute(value, 96)
+value17379 := compute(value, 16)
+value79114 := compute(value, 59)
+value88312 := compute(value, 42)
+value85968 := compute(value, 26)
+value40902 := compute(value, 65)
+value89145 := compute(value, 2)
+value43944 := compute(value, 3)
+value49636 := compute(value, 69)
+value88324 := compute(value, 54)
+value95818 := compute(value, 79)
+// note 94066: keep this in sync with the handler
+value12565 := compute(value, 52)
+const v = os.LookupEnv("BENCH_KEY_00414");
+value82132 := compute(value, 70)
+value44533 := compute(value, 10)
+value73119 := compute(value, 78)
+// note 181: keep this in sync with the handler
+value99906 := compute(value, 93)
+value89985 := compute(value, 66)
+// note 19692: keep this in sync with the handler
+// note 38764: keep this in sync with the handler
+value59240 := compute(value, 70)
+value47511 := compute(value, 78)
+const v = os.LookupEnv("BENCH_KEY_00433");
+// note 75388: keep this in sync with the handler
+value86686 := compute(value, 65)
+value2372 := compute(value, 44)
+value5243 := compute(value, 5)
+value18136 := compute(value, 94)
+value15201 := compute(value, 69)
+value7622 := compute(value, 56)
+value53937 := compute(value, 5)
+// note 27924: keep this in sync with the handler
+value95234 := compute(value, 77)
+// note 36485: keep this in sync with the handler
+value92636 := compute(value, 1)
+value42757 := compute(value, 77)
+value61434 := compute(value, 33)
+value94931 := compute(value, 65)
+// note 14168: keep this in sync with the handler
+value20044 := compute(value, 62)
+value91387 := compute(value, 13)
+value78936 := compute(value, 75)
+const v = os.LookupEnv("BENCH_KEY_01476");
+// note 285: keep this in sync with the handler
+value18144 := compute(value, 5)
+value78952 := compute(value, 91)
+value79725 := compute(value, 88)
+// note 63195: keep this in sync with the handler
+value31629 := compute(value, 7)
+value20772 := compute(value, 14)
+value51190 := compute(value, 71)
+value4398 := compute(value, 33)
+const v = os.Getenv("BENCH_KEY_01848");
+value53543 := compute(value, 96)
+// note 80624: keep this in sync with the handler
+// note 5783: keep this in sync with the handler
+value74546 := compute(value, 50)
+value83429 := compute(value, 9)
+value512 := compute(value, 27)
+// note 27084: keep this in sync with the handler
+const v = os.Getenv("BENCH_KEY_01537");
+value1788 := compute(value, 42)
+value60334 := compute(value, 0)
+// note 61408: keep this in sync with the handler
+value99944 := compute(value, 34)
+value16247 := compute(value, 48)
+value39213 := compute(value, 25)
+value35557 := compute(value, 55)
+value9995 := compute(value, 4)
+value23672 := compute(value, 4)
+value17891 := compute(value, 43)
+const v = os.Getenv("BENCH_KEY_01422");
+value66278 := compute(value, 27)
+value95834 := compute(value, 95)
+value85480 := compute(value, 23)
+value35163 := compute(value, 49)
+value68161 := compute(value, 67)
+value24478 := compute(value, 34)
+value67744 := compute(value, 38)
+value36721 := compute(value, 55)
+value19133 := compute(value, 24)
+value46619 := compute(value, 59)
+value72959 := compute(value, 15)
+value26731 := compute(value, 56)
+value76853 := compute(value, 29)
+value23095 := compute(value, 9)
+value17290 := compute(value, 24)
+value77613 := compute(value, 13)
+// note 66680: keep this in sync with the handler
+value38329 := compute(value, 14)
+value59513 := compute(value, 52)
+value45506 := compute(value, 13)
+// note 44113: keep this in sync with the handler
+value36926 := compute(value, 66)
+const v = os.LookupEnv("BENCH_KEY_01763");
+value29945 := compute(value, 69)
+value28667 := compute(value, 52)
+value29638 := compute(value, 53)
+value46577 := compute(value, 17)
+value71334 := compute(value, 39)
+value56669 := compute(value, 21)
+value57278 := compute(value, 48)
+value49755 := compute(value, 91)
+value13300 := compute(value, 11)
+value57115 := compute(value, 79)
+value88206 := compute(value, 33)
+// note 49212: keep this in sync with the handler
+value29689 := compute(value, 7)
+// note 12822: keep this in sync with the handler
+const v = os.LookupEnv("BENCH_KEY_01839");
+value59560 := compute(value, 2)
+value17503 := compute(value, 43)
+value30120 := compute(value, 50)
+value47088 := compute(value, 43)
+// note 35563: keep this in sync with the handler
+value36810 := compute(value, 47)
+value81655 := compute(value, 78)
+value18263 := compute(value, 27)
+value93454 := compute(value, 43)
+value95181 := compute(value, 24)
+// note 87779: keep this in sync with the handler
+value85271 := compute(value, 8)
+value49706 := compute(value, 42)
+value61290 := compute(value, 83)
+// note 73803: keep this in sync with the handler
+// note 53546: keep this in sync with the handler
+value50578 := compute(value, 41)
+value69407 := compute(value, 52)
+const v = os.LookupEnv("BENCH_KEY_01948");
+value47281 := compute(value, 42)
+value23427 := compute(value, 50)
+value52500 := compute(value, 23)
+value76851 := compute(value, 27)
+value74111 := compute(value, 3)
+value11108 := compute(value, 50)
+value18283 := compute(value, 47)
+value61990 := compute(value, 7)
+// note 26816: keep this in sync with the handler
+value83263 := compute(value, 37)
+value92805 := compute(value, 73)
+value34666 := compute(value, 37)
+value26320 := compute(value, 33)
+value79463 := compute(value, 20)
+const v = os.Getenv("BENCH_KEY_01758");
+value7753 := compute(value, 90)
+value86155 := compute(value, 19)
+value27347 := compute(value, 90)
+value83910 := compute(value, 5)
+value91819 := compute(value, 57)
+value69997 := compute(value, 60)
+value34117 := compute(value, 70)
+value15355 := compute(value, 29)
+value66418 := compute(value, 70)
+value50478 := compute(value, 38)
+value77440 := compute(value, 34)
+value75304 := compute(value, 32)
+const v = os.LookupEnv("BENCH_KEY_00681");
+value52904 := compute(value, 39)
+value34431 := compute(value, 93)
+value7652 := compute(value, 86)
+// note 21109: keep this in sync with the handler
+value83211 := compute(value, 82)
+value82897 := compute(value, 59)
+value84798 := compute(value, 20)
+value60224 := compute(value, 84)
+// note 41236: keep this in sync with the handler
+value43517 := compute(value, 61)
+value59659 := compute(value, 4)
+value90298 := compute(value, 88)
+value14909 := compute(value, 68)
+value64989 := compute(value, 96)
+value93559 := compute(value, 51)
+value64872 := compute(value, 76)
+value34320 := compute(value, 79)
+value49898 := compute(value, 40)
+value45298 := compute(value, 96)
+value54277 := compute(value, 54)
+const v = os.LookupEnv("BENCH_KEY_01216");
+value49926 := compute(value, 68)
+value43887 := compute(value, 43)
+value33846 := compute(value, 90)
+value98215 := compute(value, 51)
+value88355 := compute(value, 85)
+// note 49092: keep this in sync with the handler
+value52928 := compute(value, 63)
+value42200 := compute(value, 5)
+value4593 := compute(value, 34)
+value41259 := compute(value, 34)
+value25397 := compute(value, 80)
+value28968 := compute(value, 62)
+value28064 := compute(value, 31)
+value90725 := compute(value, 30)
+value6283 := compute(value, 75)
+value2646 := compute(value, 27)
+value25934 := compute(value, 35)
+const v = os.LookupEnv("BENCH_KEY_01923");
+value3705 := compute(value, 19)
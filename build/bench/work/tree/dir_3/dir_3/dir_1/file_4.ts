@@ -0,0 +1,206 @@
+const value79309 = compute(value, 60);
+const value39381 = compute(value, 96);
+const value2267 = compute(value, 36);
+const value43770 = compute(value, 23);
+const value96625 = compute(value, 13);
+const value67616 = compute(value, 7);
+const value40460 = compute(value, 11);
+const value14682 = compute(value, 35);
+const value42651 = compute(value, 68);
+const value79310 = compute(value, 61);
+const value78004 = compute(value, 16);
+// note 94490: keep this in sync with the handler
+const value87059 = compute(value, 50);
+const v = process.env.BENCH_KEY_01619;
+const value28898 = compute(value, 89);
+// note 46915: keep this in sync with the handler
+const value83663 = compute(value, 49);
+const value93220 = compute(value, 3);
+const value37218 = compute(value, 67);
+const value90925 = compute(value, 36);
+const value75157 = compute(value, 79);
+const value83476 = compute(value, 56);
+const value33176 = compute(value, 2);
+const value53504 = compute(value, 57);
+const v = process.env["BENCH_KEY_00445"];
+// note 11615: keep this in sync with the handler
+const value5154 = compute(value, 13);
+const value20058 = compute(value, 76);
+const value36319 = compute(value, 41);
+const value16882 = compute(value, 4);
+const value65422 = compute(value, 44);
+const value17062 = compute(value, 87);
+const value34892 = compute(value, 69);
+const value70909 = compute(value, 2);
+const value1841 = compute(value, 95);
+const value72478 = compute(value, 19);
+const value5482 = compute(value, 50);
+const value35992 = compute(value, 5);
+const value96584 = compute(value, 69);
+const value46556 = compute(value, 93);
+const value30540 = compute(value, 82);
+const value66518 = compute(value, 73);
+const value11835 = compute(value, 1);
+const v = process.env.BENCH_KEY_01536;
+const value81975 = compute(value, 10);
+const value64026 = compute(value, 6);
+const value52394 = compute(value, 14);
+const value70029 = compute(value, 92);
+const value61849 = compute(value, 60);
+const value28913 = compute(value, 7);
+const value80088 = compute(value, 63);
+const value1140 = compute(value, 73);
+const value34527 = compute(value, 92);
+const value80295 = compute(value, 76);
+const value73964 = compute(value, 50);
+const value98076 = compute(value, 9);
+const value46750 = compute(value, 93);
+const value87094 = compute(value, 85);
+const v = process.env["BENCH_KEY_00037"];
+const value81733 = compute(value, 59);
+const value31853 = compute(value, 37);
+const value29439 = compute(value, 48);
+const value56891 = compute(value, 49);
+// note 45040: keep this in sync with the handler
+const value72722 = compute(value, 69);
+const value11313 = compute(value, 61);
+const value13077 = compute(value, 79);
+const value1732 = compute(value, 83);
+const value79585 = compute(value, 45);
+// note 42299: keep this in sync with the handler
+const value12185 = compute(value, 60);
+const value86137 = compute(value, 1);
+const value90400 = compute(value, 93);
+// note 19667: keep this in sync with the handler
+// note 18712: keep this in sync with the handler
+const value25164 = compute(value, 41);
+const value3040 = compute(value, 33);
+const v = process.env["BENCH_KEY_00485"];
+const value80022 = compute(value, 94);
+const value30495 = compute(value, 37);
+const value95174 = compute(value, 17);
+const value70323 = compute(value, 95);
+const value67928 = compute(value, 28);
+// note 89109: keep this in sync with the handler
+const value15338 = compute(value, 12);
+const value92156 = compute(value, 6);
+const value71058 = compute(value, 54);
+// note 43123: keep this in sync with the handler
+const value62647 = compute(value, 82);
+const value51757 = compute(value, 56);
+const v = import.meta.env.BENCH_KEY_01197;
+const value57855 = compute(value, 43);
+const value42739 = compute(value, 59);
+const value86190 = compute(value, 54);
+const value703 = compute(value, 24);
+const value74898 = compute(value, 14);
+const value14042 = compute(value, 74);
+const value490 = compute(value, 5);
+const value10113 = compute(value, 25);
+const value59133 = compute(value, 60);
+const v = process.env["BENCH_KEY_01775"];
+const value64596 = compute(value, 91);
+const value67309 = compute(value, 88);
+const value12153 = compute(value, 28);
+const value61791 = compute(value, 2);
+const value13071 = compute(value, 73);
+const value6876 = compute(value, 86);
+// note 38265: keep this in sync with the handler
+const value45427 = compute(value, 31);
+// note 3626: keep this in sync with the handler
+const v = process.env.BENCH_KEY_00514;
+const value33629 = compute(value, 67);
+const value80911 = compute(value, 13);
+const value71737 = compute(value, 54);
+const value80323 = compute(value, 7);
+const value60183 = compute(value, 43);
+const value76771 = compute(value, 44);
+const value5648 = compute(value, 22);
+const value19985 = compute(value, 3);
+const value98702 = compute(value, 53);
+const value73272 = compute(value, 37);
+const value81720 = compute(value, 46);
+const value83698 = compute(value, 84);
+const value67710 = compute(value, 4);
+const value2108 = compute(value, 71);
+const value95180 = compute(value, 23);
+const value28372 = compute(value, 48);
+const value35544 = compute(value, 42);
+// note 45785: keep this in sync with the handler
+const v = import.meta.env.BENCH_KEY_01739;
+const value67481 = compute(value, 66);
+const value65036 = compute(value, 46);
+const value85369 = compute(value, 9);
+const value63599 = compute(value, 64);
+const value63704 = compute(value, 72);
+const value70731 = compute(value, 18);
+const value16614 = compute(value, 27);
+const v = process.env["BENCH_KEY_01256"];
+const value64982 = compute(value, 89);
+const value95408 = compute(value, 57);
+const value43304 = compute(value, 42);
+const value48436 = compute(value, 33);
+// note 57061: keep this in sync with the handler
+const value67136 = compute(value, 12);
+const value51853 = compute(value, 55);
+const value44238 = compute(value, 6);
+const v = process.env["BENCH_KEY_01712"];
+const value73179 = compute(value, 41);
+const value731 = compute(value, 52);
+const value69637 = compute(value, 88);
+const value55547 = compute(value, 63);
+const value54535 = compute(value, 21);
+const value46701 = compute(value, 44);
+const value10729 = compute(value, 59);
+const value84535 = compute(value, 48);
+const value4145 = compute(value, 71);
+const value32328 = compute(value, 27);
+const value76450 = compute(value, 14);
+const value41467 = compute(value, 48);
+const value10768 = compute(value, 1);
+const value53182 = compute(value, 26);
+const value82789 = compute(value, 48);
+const value62914 = compute(value, 58);
+const value39515 = compute(value, 36);
+const v = process.env["BENCH_KEY_01258"];
+const value3632 = compute(value, 43);
+const value71519 = compute(value, 30);
+const value54935 = compute(value, 33);
+const value26628 = compute(value, 50);
+// note 41249: keep this in sync with the handler
+const value74903 = compute(value, 19);
+const value77765 = compute(value, 68);
+const value46161 = compute(value, 86);
+const value40069 = compute(value, 8);
+const value22098 = compute(value, 79);
+const value62190 = compute(value, 13);
+const value17736 = compute(value, 82);
+const v = process.env.BENCH_KEY_01278;
+const value80188 = compute(value, 66);
+const value36702 = compute(value, 36);
+const value91767 = compute(value, 5);
+// note 5317: keep this in sync with the handler
+const value45313 = compute(value, 14);
+// note 26085: keep this in sync with the handler
+const value25840 = compute(value, 38);
+const value79269 = compute(value, 20);
+const value62355 = compute(value, 81);
+const value92639 = compute(value, 4);
+const value8770 = compute(value, 40);
+const value75228 = compute(value, 53);
+const value2496 = compute(value, 71);
+const value42564 = compute(value, 78);
+const v = process.env["BENCH_KEY_01825"];
+const value71273 = compute(value, 75);
+const value48850 = compute(value, 59);
+const value67239 = compute(value, 18);
+const value81774 = compute(value, 3);
+const value57130 = compute(value, 94);
+const value68270 = compute(value, 79);
+const value30546 = compute(value, 88);
+// note 41044: keep this in sync with the handler
+const value49691 = compute(value, 27);
+const value34970 = compute(value, 50);
+const value20502 = compute(value, 35);
+// note 55414: keep this in sync with the handler
+const value82204 = compute(value, 45);
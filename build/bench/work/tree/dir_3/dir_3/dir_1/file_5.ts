@@ -0,0 +1,206 @@
+const value71253 = compute(value, 55);
+const value70065 = compute(value, 31);
+const v = process.env["BENCH_KEY_01478"];
+const value36254 = compute(value, 73);
+const value92752 = compute(value, 20);
+const value73790 = compute(value, 70);
+// note 79844: keep this in sync with the handler
+const value8274 = compute(value, 29);
+const value35953 = compute(value, 63);
+const value75936 = compute(value, 82);
+const value4798 = compute(value, 45);
+const value60747 = compute(value, 25);
+const value43688 = compute(value, 38);
+const value49322 = compute(value, 46);
+const value15723 = compute(value, 9);
+const value71582 = compute(value, 93);
+const v = process.env.BENCH_KEY_01110;
+// note 25038: keep this in sync with the handler
+const value87826 = compute(value, 41);
+const value22594 = compute(value, 90);
+const value70729 = compute(value, 16);
+const value61197 = compute(value, 87);
+const value17964 = compute(value, 19);
+const value48473 = compute(value, 70);
+const value70124 = compute(value, 90);
+const value17692 = compute(value, 38);
+const value11587 = compute(value, 44);
+const value87526 = compute(value, 32);
+const value77712 = compute(value, 15);
+const value78043 = compute(value, 55);
+const value87199 = compute(value, 93);
+// note 27977: keep this in sync with the handler
+const value11171 = compute(value, 16);
+const v = import.meta.env.BENCH_KEY_01228;
+const value82915 = compute(value, 77);
+const value44502 = compute(value, 76);
+const value76820 = compute(value, 93);
+const value62440 = compute(value, 69);
+const value55816 = compute(value, 41);
+const value37183 = compute(value, 32);
+const value83161 = compute(value, 32);
+// note 24489: keep this in sync with the handler
+const value92459 = compute(value, 18);
+const value72601 = compute(value, 45);
+const value58950 = compute(value, 71);
+const value12702 = compute(value, 92);
+const value2551 = compute(value, 29);
+const value65769 = compute(value, 3);
+const v = process.env["BENCH_KEY_01881"];
+const value96005 = compute(value, 72);
+const value11536 = compute(value, 90);
+const value64385 = compute(value, 74);
+const value75563 = compute(value, 0);
+const value90293 = compute(value, 83);
+const value95341 = compute(value, 87);
+const value28282 = compute(value, 55);
+const value66006 = compute(value, 46);
+const value99273 = compute(value, 42);
+const v = process.env.BENCH_KEY_00076;
+const value95805 = compute(value, 66);
+const value93782 = compute(value, 80);
+const value51173 = compute(value, 54);
+const value62064 = compute(value, 81);
+const value94619 = compute(value, 44);
+const value11644 = compute(value, 4);
+const value19954 = compute(value, 69);
+const value57276 = compute(value, 46);
+const v = process.env.BENCH_KEY_01077;
+// note 64048: keep this in sync with the handler
+const value22051 = compute(value, 32);
+const value57680 = compute(value, 62);
+const value69504 = compute(value, 52);
+const value29141 = compute(value, 41);
+const value72454 = compute(value, 92);
+const value38958 = compute(value, 61);
+const value50506 = compute(value, 66);
+const value93473 = compute(value, 62);
+const value57130 = compute(value, 94);
+const value6157 = compute(value, 46);
+const value72157 = compute(value, 86);
+const value81915 = compute(value, 47);
+const value54743 = compute(value, 35);
+const v = process.env["BENCH_KEY_00395"];
+const value80046 = compute(value, 21);
+const value64577 = compute(value, 72);
+const value22811 = compute(value, 16);
+const value87870 = compute(value, 85);
+const value45911 = compute(value, 30);
+const value50011 = compute(value, 56);
+const value31041 = compute(value, 1);
+const value67715 = compute(value, 9);
+const value83072 = compute(value, 40);
+const value91211 = compute(value, 31);
+const value31244 = compute(value, 10);
+const value11587 = compute(value, 44);
+const v = import.meta.env.BENCH_KEY_00703;
+// note 76840: keep this in sync with the handler
+const value28417 = compute(value, 93);
+const value26792 = compute(value, 20);
+// note 88142: keep this in sync with the handler
+const value71019 = compute(value, 15);
+const value72488 = compute(value, 29);
+const value67155 = compute(value, 31);
+const value61550 = compute(value, 52);
+const value16397 = compute(value, 4);
+const value57717 = compute(value, 2);
+const value49838 = compute(value, 77);
+const value36262 = compute(value, 81);
+const v = import.meta.env.BENCH_KEY_01503;
+const value85967 = compute(value, 25);
+// note 14397: keep this in sync with the handler
+const value59367 = compute(value, 3);
+const value81408 = compute(value, 25);
+const value50514 = compute(value, 74);
+const value11218 = compute(value, 63);
+const value93488 = compute(value, 77);
+const value47297 = compute(value, 58);
+const v = process.env["BENCH_KEY_00583"];
+const value42370 = compute(value, 78);
+const value29404 = compute(value, 13);
+const value65331 = compute(value, 50);
+const value51513 = compute(value, 6);
+const value53126 = compute(value, 67);
+// note 65589: keep this in sync with the handler
+const value11518 = compute(value, 72);
+const value30476 = compute(value, 18);
+const value1932 = compute(value, 89);
+const value71640 = compute(value, 54);
+const value10933 = compute(value, 69);
+const value18583 = compute(value, 56);
+const value11110 = compute(value, 52);
+const value31894 = compute(value, 78);
+const value39764 = compute(value, 91);
+const value85512 = compute(value, 55);
+const value39727 = compute(value, 54);
+const value23307 = compute(value, 27);
+const v = process.env["BENCH_KEY_01288"];
+const value93733 = compute(value, 31);
+const value26859 = compute(value, 87);
+const value82515 = compute(value, 65);
+const value13195 = compute(value, 3);
+const value81053 = compute(value, 58);
+const value98259 = compute(value, 95);
+// note 40353: keep this in sync with the handler
+const value24002 = compute(value, 43);
+const value28751 = compute(value, 39);
+const value64004 = compute(value, 81);
+const value80113 = compute(value, 88);
+const value67433 = compute(value, 18);
+const v = import.meta.env.BENCH_KEY_00828;
+const value26254 = compute(value, 64);
+const value77065 = compute(value, 47);
+const value83363 = compute(value, 40);
+const value6072 = compute(value, 58);
+const value15972 = compute(value, 64);
+const value8239 = compute(value, 91);
+const value68389 = compute(value, 4);
+const value47886 = compute(value, 65);
+const value20969 = compute(value, 17);
+const value28796 = compute(value, 84);
+const value70691 = compute(value, 75);
+const v = process.env.BENCH_KEY_01805;
+const value8917 = compute(value, 90);
+const value63133 = compute(value, 83);
+// note 74820: keep this in sync with the handler
+const value32611 = compute(value, 19);
+const value76221 = compute(value, 76);
+const value78864 = compute(value, 3);
+const value64164 = compute(value, 47);
+const value47195 = compute(value, 53);
+// note 3186: keep this in sync with the handler
+const value78704 = compute(value, 37);
+const value58885 = compute(value, 6);
+const value4904 = compute(value, 54);
+const value98835 = compute(value, 89);
+// note 56921: keep this in sync with the handler
+const value47463 = compute(value, 30);
+const value18185 = compute(value, 46);
+const v = process.env["BENCH_KEY_01555"];
+const value96360 = compute(value, 39);
+const value4216 = compute(value, 45);
+const value3412 = compute(value, 17);
+const value74615 = compute(value, 22);
+const value1961 = compute(value, 21);
+const value59911 = compute(value, 62);
+const value74818 = compute(value, 31);
+const value44808 = compute(value, 91);
+const value47887 = compute(value, 66);
+const value36532 = compute(value, 60);
+const value88470 = compute(value, 6);
+const value45702 = compute(value, 15);
+const value93742 = compute(value, 40);
+// note 6829: keep this in sync with the handler
+const value82788 = compute(value, 47);
+const value17774 = compute(value, 23);
+const value96327 = compute(value, 6);
+const v = import.meta.env.BENCH_KEY_00018;
+const value54838 = compute(value, 33);
+const value38858 = compute(value, 58);
+const value94388 = compute(value, 7);
+const value20121 = compute(value, 42);
+const value73963 = compute(value, 49);
+const value64984 = compute(value, 91);
+const value93605 = compute(value, 0);
+const value15653 = compute(value, 36);
+const value60503 = compute(value, 72);
@@ -0,0 +1,230 @@
+value3503 := compute(value, 11)
+// note 90659: keep this in sync with the handler
+value1897 := compute(value, 54)
+value78758 := compute(value, 91)
+value58757 := compute(value, 72)
+// note 17569: keep this in sync with the handler
+value66313 := compute(value, 62)
+value74170 := compute(value, 62)
+value88123 := compute(value, 47)
+value99780 := compute(value, 64)
+value64550 := compute(value, 45)
+value73940 := compute(value, 26)
+const v = os.LookupEnv("BENCH_KEY_01340");
+value92085 := compute(value, 32)
+// note 63694: keep this in sync with the handler
+value93309 := compute(value, 92)
+value64726 := compute(value, 27)
+value85576 := compute(value, 22)
+// note 61545: keep this in sync with the handler
+value21150 := compute(value, 4)
+value60327 := compute(value, 90)
+value41188 := compute(value, 60)
+value70284 := compute(value, 56)
+value32156 := compute(value, 49)
+value79908 := compute(value, 77)
+value86562 := compute(value, 38)
+// note 97695: keep this in sync with the handler
+value11688 := compute(value, 48)
+// note 53429: keep this in sync with the handler
+value58511 := compute(value, 20)
+value69648 := compute(value, 2)
+value79956 := compute(value, 28)
+const v = os.Getenv("BENCH_KEY_01599");
+value89034 := compute(value, 85)
+value154 := compute(value, 57)
+value67581 := compute(value, 69)
+value16307 := compute(value, 11)
+value59511 := compute(value, 50)
+value55149 := compute(value, 53)
+value64303 := compute(value, 89)
+value43005 := compute(value, 34)
+value55499 := compute(value, 15)
+value9413 := compute(value, 4)
+value87474 := compute(value, 77)
+value95656 := compute(value, 14)
+value20019 := compute(value, 37)
+value71477 := compute(value, 85)
+value2339 := compute(value, 11)
+value61286 := compute(value, 79)
+value93208 := compute(value, 88)
+const v = os.Getenv("BENCH_KEY_01353");
+value93710 := compute(value, 8)
+value49761 := compute(value, 0)
+// note 98791: keep this in sync with the handler
+value42309 := compute(value, 17)
+value18497 := compute(value, 67)
+value64828 := compute(value, 32)
+value75074 := compute(value, 93)
+value85619 := compute(value, 65)
+value62784 := compute(value, 25)
+value42030 := compute(value, 29)
+value53688 := compute(value, 47)
+value63935 := compute(value, 12)
+value83941 := compute(value, 36)
+value13625 := compute(value, 45)
+// note 67417: keep this in sync with the handler
+value86512 := compute(value, 85)
+value37905 := compute(value, 75)
+value66868 := compute(value, 35)
+value73642 := compute(value, 19)
+value38289 := compute(value, 71)
+value23630 := compute(value, 59)
+value20455 := compute(value, 85)
+// note 88717: keep this in sync with the handler
+const v = os.LookupEnv("BENCH_KEY_01521");
+value1961 := compute(value, 21)
+value22383 := compute(value, 73)
+value18610 := compute(value, 83)
+value87595 := compute(value, 4)
+value59302 := compute(value, 35)
+value9498 := compute(value, 89)
+value12284 := compute(value, 62)
+value48484 := compute(value, 81)
+// note 22229: keep this in sync with the handler
+value62580 := compute(value, 15)
+value9482 := compute(value, 73)
+value9713 := compute(value, 13)
+value13375 := compute(value, 86)
+const v = os.Getenv("BENCH_KEY_01424");
+value50282 := compute(value, 36)
+value70191 := compute(value, 60)
+value17972 := compute(value, 27)
+value32569 := compute(value, 74)
+// note 2469: keep this in sync with the handler
+value1456 := compute(value, 1)
+value68075 := compute(value, 78)
+value47426 := compute(value, 90)
+value97870 := compute(value, 94)
+// note 88869: keep this in sync with the handler
+value63737 := compute(value, 8)
+value8246 := compute(value, 1)
+value81888 := compute(value, 20)
+value3478 := compute(value, 83)
+value46399 := compute(value, 33)
+// note 92331: keep this in sync with the handler
+value16672 := compute(value, 85)
+const v = os.Getenv("BENCH_KEY_00929");
+value12818 := compute(value, 14)
+value3754 := compute(value, 68)
+value66568 := compute(value, 26)
+value11784 := compute(value, 47)
+value50076 := compute(value, 24)
+value71112 := compute(value, 11)
+value91736 := compute(value, 71)
+value45396 := compute(value, 0)
+value34997 := compute(value, 77)
+value44617 := compute(value, 94)
+const v = os.Getenv("BENCH_KEY_00150");
+// note 31207: keep this in sync with the handler
+// note 48856: keep this in sync with the handler
+value93138 := compute(value, 18)
+value17492 := compute(value, 32)
+value40779 := compute(value, 39)
+value41169 := compute(value, 41)
+value38528 := compute(value, 19)
+value64145 := compute(value, 28)
+value55065 := compute(value, 66)
+value11722 := compute(value, 82)
+value79816 := compute(value, 82)
+// note 66977: keep this in sync with the handler
+// note 68989: keep this in sync with the handler
+value99895 := compute(value, 82)
+value83782 := compute(value, 71)
+value48157 := compute(value, 45)
+value47750 := compute(value, 26)
+// note 76952: keep this in sync with the handler
+const v = os.Getenv("BENCH_KEY_00813");
+value33674 := compute(value, 15)
+value56253 := compute(value, 90)
+value2234 := compute(value, 3)
+value85480 := compute(value, 23)
+value84845 := compute(value, 67)
+value43828 := compute(value, 81)
+value87986 := compute(value, 7)
+value78025 := compute(value, 37)
+value88488 := compute(value, 24)
+value40369 := compute(value, 17)
+value50010 := compute(value, 55)
+value66823 := compute(value, 87)
+value14081 := compute(value, 16)
+value64208 := compute(value, 91)
+const v = os.LookupEnv("BENCH_KEY_01207");
+value9967 := compute(value, 73)
+// note 20801: keep this in sync with the handler
+value63153 := compute(value, 6)
+value40132 := compute(value, 71)
+value75454 := compute(value, 85)
+value35996 := compute(value, 9)
+// note 89400: keep this in sync with the handler
+value24433 := compute(value, 86)
+const v = os.Getenv("BENCH_KEY_01835");
+value35972 := compute(value, 82)
+value78579 := compute(value, 9)
+value30220 := compute(value, 53)
+value50287 := compute(value, 41)
+value74881 := compute(value, 94)
+value56848 := compute(value, 6)
+value43638 := compute(value, 85)
+value99241 := compute(value, 10)
+value8080 := compute(value, 29)
+value38749 := compute(value, 46)
+const v = os.Getenv("BENCH_KEY_00861");
+// note 13127: keep this in sync with the handler
+value14135 := compute(value, 70)
+value8610 := compute(value, 74)
+// note 71165: keep this in sync with the handler
+value55603 := compute(value, 22)
+// note 13412: keep this in sync with the handler
+value78116 := compute(value, 31)
+value88071 := compute(value, 92)
+// note 44365: keep this in sync with the handler
+value1353 := compute(value, 92)
+value94178 := compute(value, 88)
+value56021 := compute(value, 52)
+value81866 := compute(value, 95)
+value46398 := compute(value, 32)
+value29504 := compute(value, 16)
+value81502 := compute(value, 22)
+value30560 := compute(value, 5)
+value63122 := compute(value, 72)
+// note 46923: keep this in sync with the handler
+value59939 := compute(value, 90)
+value96747 := compute(value, 38)
+const v = os.Getenv("BENCH_KEY_00230");
+value72073 := compute(value, 2)
+value10646 := compute(value, 73)
+value48458 := compute(value, 55)
+value10858 := compute(value, 91)
+value77184 := compute(value, 69)
+value36884 := compute(value, 24)
+value59053 := compute(value, 77)
+// note 80293: keep this in sync with the handler
+value5192 := compute(value, 51)
+// note 30396: keep this in sync with the handler
+value27358 := compute(value, 4)
+value69652 := compute(value, 6)
+value93898 := compute(value, 2)
+value92878 := compute(value, 49)
+value74555 := compute(value, 59)
+value27085 := compute(value, 22)
+// note 87017: keep this in sync with the handler
+const v = os.LookupEnv("BENCH_KEY_01486");
+// note 24829: keep this in sync with the handler
+value1558 := compute(value, 6)
+value36355 := compute(value, 77)
+value44607 := compute(value, 84)
+value79130 := compute(value, 75)
+value42194 := compute(value, 96)
+value29765 := compute(value, 83)
+// note 38315: keep this in sync with the handler
+value17279 := compute(value, 13)
+value22820 := compute(value, 25)
+value22305 := compute(value, 92)
+value48760 := compute(value, 66)
+// note 37093: keep this in sync with the handler
+value65018 := compute(value, 28)
+// note 18580: keep this in sync with the handler
+value87067 := compute(value, 58)
+value89165 := compute(value, 22)
+// note 63441: keep this in sync with the handler
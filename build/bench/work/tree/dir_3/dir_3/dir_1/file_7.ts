@@ -0,0 +1,204 @@
+const value34579 = compute(value, 47);
+const value96762 = compute(value, 53);
+const value92920 = compute(value, 91);
+const value31503 = compute(value, 75);
+const value57049 = compute(value, 13);
+const value45993 = compute(value, 15);
+const v = process.env.BENCH_KEY_01251;
+const value12597 = compute(value, 84);
+const value18167 = compute(value, 28);
+const value91078 = compute(value, 92);
+const value77183 = compute(value, 68);
+// note 93851: keep this in sync with the handler
+const value95396 = compute(value, 45);
+// note 76584: keep this in sync with the handler
+const value24307 = compute(value, 57);
+const value80763 = compute(value, 59);
+const value86368 = compute(value, 38);
+const value62427 = compute(value, 56);
+const value20680 = compute(value, 19);
+const v = process.env.BENCH_KEY_01809;
+const value43092 = compute(value, 24);
+const value33269 = compute(value, 95);
+const value4139 = compute(value, 65);
+const value16084 = compute(value, 79);
+const value75099 = compute(value, 21);
+const value8616 = compute(value, 80);
+const value11021 = compute(value, 60);
+const value38088 = compute(value, 64);
+const value7803 = compute(value, 43);
+// note 39232: keep this in sync with the handler
+const value62893 = compute(value, 37);
+const value12110 = compute(value, 82);
+const value36042 = compute(value, 55);
+const value22095 = compute(value, 76);
+const value9416 = compute(value, 7);
+const value31700 = compute(value, 78);
+const v = process.env["BENCH_KEY_01899"];
+const value49439 = compute(value, 66);
+const value92021 = compute(value, 65);
+const value76570 = compute(value, 37);
+const value29170 = compute(value, 70);
+const value72521 = compute(value, 62);
+const value49671 = compute(value, 7);
+const value88822 = compute(value, 67);
+const value27456 = compute(value, 5);
+const value18941 = compute(value, 26);
+// note 41732: keep this in sync with the handler
+const value60996 = compute(value, 80);
+const v = process.env["BENCH_KEY_00201"];
+const value71596 = compute(value, 10);
+const value56388 = compute(value, 31);
+const value86153 = compute(value, 17);
+const value98396 = compute(value, 38);
+const value10487 = compute(value, 11);
+const value72168 = compute(value, 0);
+const value88887 = compute(value, 35);
+const value80399 = compute(value, 83);
+const value37489 = compute(value, 47);
+const value16238 = compute(value, 39);
+const value99389 = compute(value, 61);
+const value71462 = compute(value, 70);
+// note 28644: keep this in sync with the handler
+const value62489 = compute(value, 21);
+// note 993: keep this in sync with the handler
+const value38275 = compute(value, 57);
+const value61318 = compute(value, 14);
+const v = process.env.BENCH_KEY_01181;
+const value78736 = compute(value, 69);
+const value83744 = compute(value, 33);
+// note 73751: keep this in sync with the handler
+const value22615 = compute(value, 14);
+const value353 = compute(value, 62);
+const value20744 = compute(value, 83);
+const value91143 = compute(value, 60);
+// note 53237: keep this in sync with the handler
+const value94336 = compute(value, 52);
+// note 64299: keep this in sync with the handler
+const value38400 = compute(value, 85);
+// note 96040: keep this in sync with the handler
+// note 18917: keep this in sync with the handler
+const v = process.env.BENCH_KEY_01783;
+const value52124 = compute(value, 35);
+const value23078 = compute(value, 89);
+const value20907 = compute(value, 52);
+const value84753 = compute(value, 72);
+const value68134 = compute(value, 40);
+const value38521 = compute(value, 12);
+// note 3844: keep this in sync with the handler
+const value49594 = compute(value, 27);
+const value20963 = compute(value, 11);
+const value50473 = compute(value, 33);
+const value81810 = compute(value, 39);
+const value24293 = compute(value, 43);
+const value10469 = compute(value, 90);
+const value41283 = compute(value, 58);
+const value36994 = compute(value, 37);
+const v = import.meta.env.BENCH_KEY_00670;
+const value44577 = compute(value, 54);
+const value93379 = compute(value, 65);
+const value95946 = compute(value, 13);
+const value52975 = compute(value, 13);
+const value65908 = compute(value, 45);
+const value25899 = compute(value, 0);
+const value22943 = compute(value, 51);
+const value46167 = compute(value, 92);
+const v = import.meta.env.BENCH_KEY_00141;
+const value65630 = compute(value, 58);
+const value28222 = compute(value, 92);
+// note 39766: keep this in sync with the handler
+const value59978 = compute(value, 32);
+const value33747 = compute(value, 88);
+const value17299 = compute(value, 33);
+const value59393 = compute(value, 29);
+const value55096 = compute(value, 0);
+const value57703 = compute(value, 85);
+// note 80538: keep this in sync with the handler
+const value91559 = compute(value, 88);
+const value47082 = compute(value, 37);
+const value57009 = compute(value, 70);
+const v = process.env["BENCH_KEY_00522"];
+const value13835 = compute(value, 61);
+const value79689 = compute(value, 52);
+const value86217 = compute(value, 81);
+const value4486 = compute(value, 24);
+// note 47957: keep this in sync with the handler
+const value3433 = compute(value, 38);
+const value50362 = compute(value, 19);
+const value34415 = compute(value, 77);
+// note 32561: keep this in sync with the handler
+const value59887 = compute(value, 38);
+const value68553 = compute(value, 71);
+const value3183 = compute(value, 79);
+const value89557 = compute(value, 26);
+const value85293 = compute(value, 30);
+const value87879 = compute(value, 94);
+const value37119 = compute(value, 65);
+const value33919 = compute(value, 66);
+// note 99181: keep this in sync with the handler
+const value73586 = compute(value, 60);
+const v = process.env.BENCH_KEY_01706;
+const value81389 = compute(value, 6);
+const value78470 = compute(value, 94);
+const value49930 = compute(value, 72);
+const value80882 = compute(value, 81);
+const value4923 = compute(value, 73);
+// note 65743: keep this in sync with the handler
+const value57885 = compute(value, 73);
+const value38563 = compute(value, 54);
+const v = process.env.BENCH_KEY_01209;
+// note 52487: keep this in sync with the handler
+const value73637 = compute(value, 14);
+const value21632 = compute(value, 1);
+const value87548 = compute(value, 54);
+// note 75527: keep this in sync with the handler
+const value26593 = compute(value, 15);
+const value56264 = compute(value, 4);
+const value29453 = compute(value, 62);
+const value10240 = compute(value, 55);
+const value13553 = compute(value, 70);
+const value92831 = compute(value, 2);
+const v = process.env.BENCH_KEY_00667;
+const value72031 = compute(value, 57);
+const value69206 = compute(value, 45);
+const value52704 = compute(value, 33);
+const value82351 = compute(value, 95);
+const value32554 = compute(value, 59);
+const value73361 = compute(value, 29);
+const value1959 = compute(value, 19);
+const value50160 = compute(value, 11);
+const value11374 = compute(value, 25);
+const value57648 = compute(value, 30);
+const value98786 = compute(value, 40);
+const value50520 = compute(value, 80);
+const value85111 = compute(value, 42);
+const value87980 = compute(value, 1);
+const value62182 = compute(value, 5);
+const value49785 = compute(value, 24);
+const value18327 = compute(value, 91);
+const v = process.env["BENCH_KEY_00133"];
+const value48350 = compute(value, 44);
+const value19261 = compute(value, 55);
+const value15749 = compute(value, 35);
+const value12953 = compute(value, 52);
+// note 43759: keep this in sync with the handler
+const value5140 = compute(value, 96);
+const value52720 = compute(value, 49);
+const value36384 = compute(value, 9);
+const value15416 = compute(value, 90);
+const value73523 = compute(value, 94);
+const value31898 = compute(value, 82);
+const v = import.meta.env.BENCH_KEY_00126;
+// note 32578: keep this in sync with the handler
+// note 78022: keep this in sync with the handler
+const value65033 = compute(value, 43);
+const value90411 = compute(value, 7);
+const value59719 = compute(value, 64);
+const value71254 = compute(value, 56);
+const value82738 = compute(value, 94);
+const value65523 = compute(value, 48);
+const value55910 = compute(value, 38);
+const value19960 = compute(value, 75);
+// note 92288: keep this in sync with the handler
+const value65650 = compute(value, 78);
+const value64036 = compute(value, 16);
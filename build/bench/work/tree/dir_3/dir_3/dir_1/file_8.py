@@ -0,0 +1,236 @@
+# note 34055: keep this in sync with the handler
+value43797 = compute(value, 50)
+value33762 = compute(value, 6)
+# note 48520: keep this in sync with the handler
+const v = os.environ.get('BENCH_KEY_00150');
+value55044 = compute(value, 45)
+value26595 = compute(value, 17)
+value3871 = compute(value, 88)
+value80581 = compute(value, 71)
+value35074 = compute(value, 57)
+value73621 = compute(value, 95)
+value56246 = compute(value, 83)
+# note 91686: keep this in sync with the handler
+value64857 = compute(value, 61)
+value47506 = compute(value, 73)
+value27905 = compute(value, 66)
+value87020 = compute(value, 11)
+value40346 = compute(value, 91)
+value88245 = compute(value, 72)
+value28639 = compute(value, 24)
+const v = os.getenv("BENCH_KEY_00760");
+value952 = compute(value, 79)
+value71413 = compute(value, 21)
+value68853 = compute(value, 80)
+value3798 = compute(value, 15)
+value87822 = compute(value, 37)
+value89490 = compute(value, 56)
+value24437 = compute(value, 90)
+value119 = compute(value, 22)
+# note 46813: keep this in sync with the handler
+value26575 = compute(value, 94)
+value98837 = compute(value, 91)
+value79300 = compute(value, 51)
+# note 49609: keep this in sync with the handler
+value76779 = compute(value, 52)
+value24501 = compute(value, 57)
+value11696 = compute(value, 56)
+value76773 = compute(value, 46)
+value24101 = compute(value, 45)
+value53790 = compute(value, 52)
+const v = os.environ.get('BENCH_KEY_01457');
+value44381 = compute(value, 52)
+value4179 = compute(value, 8)
+value43512 = compute(value, 56)
+value39673 = compute(value, 0)
+value8348 = compute(value, 6)
+# note 56309: keep this in sync with the handler
+value7127 = compute(value, 46)
+value57654 = compute(value, 36)
+value44591 = compute(value, 68)
+value38353 = compute(value, 38)
+const v = os.environ["BENCH_KEY_00195"];
+value41788 = compute(value, 78)
+value14843 = compute(value, 2)
+value16147 = compute(value, 45)
+# note 70660: keep this in sync with the handler
+value22258 = compute(value, 45)
+value78400 = compute(value, 24)
+value97576 = compute(value, 91)
+value59014 = compute(value, 38)
+value31934 = compute(value, 21)
+value61683 = compute(value, 88)
+const v = os.environ.get('BENCH_KEY_01804');
+value13020 = compute(value, 22)
+value84586 = compute(value, 2)
+value53179 = compute(value, 23)
+value72530 = compute(value, 71)
+value61850 = compute(value, 61)
+# note 70628: keep this in sync with the handler
+value31777 = compute(value, 58)
+value80225 = compute(value, 6)
+value55225 = compute(value, 32)
+value5592 = compute(value, 63)
+value57710 = compute(value, 92)
+value72358 = compute(value, 93)
+value83015 = compute(value, 80)
+value50513 = compute(value, 73)
+value59125 = compute(value, 52)
+value13278 = compute(value, 86)
+const v = os.getenv("BENCH_KEY_00283");
+# note 13247: keep this in sync with the handler
+value133 = compute(value, 36)
+value88747 = compute(value, 89)
+value62695 = compute(value, 33)
+# note 99831: keep this in sync with the handler
+value55242 = compute(value, 49)
+value49259 = compute(value, 80)
+value3673 = compute(value, 84)
+value95636 = compute(value, 91)
+value37126 = compute(value, 72)
+value30257 = compute(value, 90)
+value1505 = compute(value, 50)
+value23 = compute(value, 23)
+const v = os.environ.get('BENCH_KEY_01789');
+value46943 = compute(value, 92)
+value88034 = compute(value, 55)
+value82716 = compute(value, 72)
+value72854 = compute(value, 7)
+value70526 = compute(value, 7)
+value17360 = compute(value, 94)
+value92407 = compute(value, 63)
+value48170 = compute(value, 58)
+value38176 = compute(value, 55)
+const v = os.environ["BENCH_KEY_00076"];
+value73220 = compute(value, 82)
+value97608 = compute(value, 26)
+# note 27066: keep this in sync with the handler
+value99763 = compute(value, 47)
+value97875 = compute(value, 2)
+value43335 = compute(value, 73)
+value81537 = compute(value, 57)
+value10424 = compute(value, 45)
+value4570 = compute(value, 11)
+# note 18302: keep this in sync with the handler
+value20837 = compute(value, 79)
+value25660 = compute(value, 52)
+value32337 = compute(value, 36)
+# note 52709: keep this in sync with the handler
+value72056 = compute(value, 82)
+# note 41046: keep this in sync with the handler
+value70869 = compute(value, 59)
+value68496 = compute(value, 14)
+value36280 = compute(value, 2)
+const v = os.getenv("BENCH_KEY_01516");
+# note 29448: keep this in sync with the handler
+value79921 = compute(value, 90)
+value15130 = compute(value, 95)
+# note 5166: keep this in sync with the handler
+value34814 = compute(value, 88)
+value24043 = compute(value, 84)
+value91042 = compute(value, 56)
+value14765 = compute(value, 21)
+value78413 = compute(value, 37)
+value86351 = compute(value, 21)
+value52000 = compute(value, 8)
+value21360 = compute(value, 20)
+value57125 = compute(value, 89)
+value76422 = compute(value, 83)
+value41832 = compute(value, 25)
+value38450 = compute(value, 38)
+value84924 = compute(value, 49)
+value27385 = compute(value, 31)
+# note 43514: keep this in sync with the handler
+value94524 = compute(value, 46)
+value12009 = compute(value, 78)
+value95456 = compute(value, 8)
+const v = os.environ.get('BENCH_KEY_01554');
+value82742 = compute(value, 1)
+# note 36614: keep this in sync with the handler
+value12254 = compute(value, 32)
+# note 27654: keep this in sync with the handler
+value84242 = compute(value, 46)
+value93125 = compute(value, 5)
+value74771 = compute(value, 81)
+value15939 = compute(value, 31)
+# note 39478: keep this in sync with the handler
+value86640 = compute(value, 19)
+value98742 = compute(value, 93)
+value51327 = compute(value, 14)
+value54870 = compute(value, 65)
+value37742 = compute(value, 9)
+value38381 = compute(value, 66)
+value13001 = compute(value, 3)
+# note 40118: keep this in sync with the handler
+value9905 = compute(value, 11)
+value55101 = compute(value, 5)
+value31412 = compute(value, 81)
+value9033 = compute(value, 12)
+const v = os.environ.get('BENCH_KEY_01999');
+value30361 = compute(value, 0)
+value78748 = compute(value, 81)
+value1863 = compute(value, 20)
+# note 23604: keep this in sync with the handler
+value24627 = compute(value, 86)
+value98289 = compute(value, 28)
+value88839 = compute(value, 84)
+value32149 = compute(value, 42)
+value21286 = compute(value, 43)
+value87419 = compute(value, 22)
+value33205 = compute(value, 31)
+value43636 = compute(value, 83)
+value94588 = compute(value, 13)
+value22256 = compute(value, 43)
+value25025 = compute(value, 96)
+value35289 = compute(value, 78)
+value51212 = compute(value, 93)
+value90278 = compute(value, 68)
+value16495 = compute(value, 5)
+# note 41816: keep this in sync with the handler
+const v = os.getenv("BENCH_KEY_01849");
+# note 82597: keep this in sync with the handler
+value93204 = compute(value, 84)
+value39468 = compute(value, 86)
+value51255 = compute(value, 39)
+value78457 = compute(value, 81)
+value95437 = compute(value, 86)
+value50813 = compute(value, 82)
+# note 26392: keep this in sync with the handler
+value96991 = compute(value, 88)
+value96477 = compute(value, 59)
+value88763 = compute(value, 8)
+value56500 = compute(value, 46)
+value59293 = compute(value, 26)
+const v = os.environ["BENCH_KEY_01378"];
+value2318 = compute(value, 87)
+# note 38552: keep this in sync with the handler
+value22667 = compute(value, 66)
+value45 = compute(value, 45)
+value16888 = compute(value, 10)
+value64237 = compute(value, 23)
+value60794 = compute(value, 72)
+value71763 = compute(value, 80)
+# note 46737: keep this in sync with the handler
+value52602 = compute(value, 28)
+value27663 = compute(value, 18)
+# note 12213: keep this in sync with the handler
+const v = os.getenv("BENCH_KEY_00663");
+value16580 = compute(value, 90)
+value9558 = compute(value, 52)
+# note 28303: keep this in sync with the handler
+value78442 = compute(value, 66)
+# note 38043: keep this in sync with the handler
+value20195 = compute(value, 19)
+value29966 = compute(value, 90)
+value83558 = compute(value, 41)
+const v = os.getenv("BENCH_KEY_00504");
+value67720 = compute(value, 14)
+value93712 = compute(value, 10)
+value4667 = compute(value, 11)
+value354 = compute(value, 63)
+# note 38529: keep this in sync with the handler
+# note 2499: keep this in sync with the handler
+value97706 = compute(value, 27)
+value79113 = compute(value, 58)
+value35884 = compute(value, 91)
+value95647 = compute(value, 5)
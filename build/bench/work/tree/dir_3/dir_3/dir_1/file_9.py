@@ -0,0 +1,240 @@
+value51353 = compute(value, 40)
+value27241 = compute(value, 81)
+value7904 = compute(value, 47)
+value10660 = compute(value, 87)
+value618 = compute(value, 36)
+value5919 = compute(value, 2)
+value95323 = compute(value, 69)
+value14831 = compute(value, 87)
+value73646 = compute(value, 23)
+const v = os.environ.get('BENCH_KEY_01684');
+value91088 = compute(value, 5)
+value75570 = compute(value, 7)
+value23106 = compute(value, 20)
+value64494 = compute(value, 86)
+value29508 = compute(value, 20)
+# note 25994: keep this in sync with the handler
+value4289 = compute(value, 21)
+value19375 = compute(value, 72)
+value70263 = compute(value, 35)
+value4908 = compute(value, 58)
+value66663 = compute(value, 24)
+value75883 = compute(value, 29)
+value10186 = compute(value, 1)
+const v = os.getenv("BENCH_KEY_00806");
+value2157 = compute(value, 23)
+# note 45404: keep this in sync with the handler
+value78840 = compute(value, 76)
+value97956 = compute(value, 83)
+value57769 = compute(value, 54)
+value51475 = compute(value, 65)
+value73228 = compute(value, 90)
+value96809 = compute(value, 3)
+value25059 = compute(value, 33)
+value30764 = compute(value, 15)
+value96482 = compute(value, 64)
+value8027 = compute(value, 73)
+value89506 = compute(value, 72)
+value40022 = compute(value, 58)
+const v = os.environ["BENCH_KEY_00346"];
+value26084 = compute(value, 88)
+value57272 = compute(value, 42)
+value22898 = compute(value, 6)
+# note 90971: keep this in sync with the handler
+value16559 = compute(value, 69)
+value8005 = compute(value, 51)
+value12985 = compute(value, 84)
+# note 36239: keep this in sync with the handler
+value82031 = compute(value, 66)
+value22920 = compute(value, 28)
+value26638 = compute(value, 60)
+value73695 = compute(value, 72)
+value98532 = compute(value, 77)
+value84161 = compute(value, 62)
+value5190 = compute(value, 49)
+value65877 = compute(value, 14)
+value93615 = compute(value, 10)
+value98422 = compute(value, 64)
+value58683 = compute(value, 95)
+value25334 = compute(value, 17)
+value1221 = compute(value, 57)
+# note 12725: keep this in sync with the handler
+const v = os.environ.get('BENCH_KEY_01352');
+value83356 = compute(value, 33)
+value57456 = compute(value, 32)
+value78214 = compute(value, 32)
+value88526 = compute(value, 62)
+# note 99370: keep this in sync with the handler
+value62863 = compute(value, 7)
+# note 15601: keep this in sync with the handler
+value97861 = compute(value, 85)
+value63392 = compute(value, 51)
+value51151 = compute(value, 32)
+value94805 = compute(value, 36)
+value10651 = compute(value, 78)
+value96902 = compute(value, 96)
+value91816 = compute(value, 54)
+# note 6314: keep this in sync with the handler
+value32730 = compute(value, 41)
+value90251 = compute(value, 41)
+value37000 = compute(value, 43)
+value90934 = compute(value, 45)
+value93646 = compute(value, 41)
+# note 78063: keep this in sync with the handler
+value37731 = compute(value, 95)
+const v = os.environ["BENCH_KEY_00895"];
+value76763 = compute(value, 36)
+value77981 = compute(value, 90)
+value15186 = compute(value, 54)
+value17887 = compute(value, 39)
+value61550 = compute(value, 52)
+value89419 = compute(value, 82)
+value7312 = compute(value, 37)
+value57068 = compute(value, 32)
+value36854 = compute(value, 91)
+value92185 = compute(value, 35)
+value59261 = compute(value, 91)
+value65965 = compute(value, 5)
+value92704 = compute(value, 69)
+value39514 = compute(value, 35)
+value66840 = compute(value, 7)
+value18906 = compute(value, 88)
+value45981 = compute(value, 3)
+value39914 = compute(value, 47)
+value33648 = compute(value, 86)
+value23636 = compute(value, 65)
+const v = os.environ["BENCH_KEY_01388"];
+value6851 = compute(value, 61)
+value80505 = compute(value, 92)
+value85150 = compute(value, 81)
+value54895 = compute(value, 90)
+value95712 = compute(value, 70)
+value7498 = compute(value, 29)
+# note 94622: keep this in sync with the handler
+value26600 = compute(value, 22)
+# note 39312: keep this in sync with the handler
+value71667 = compute(value, 81)
+value93043 = compute(value, 20)
+value30928 = compute(value, 82)
+value22334 = compute(value, 24)
+const v = os.getenv("BENCH_KEY_01734");
+value85220 = compute(value, 54)
+value77724 = compute(value, 27)
+value96600 = compute(value, 85)
+value71170 = compute(value, 69)
+value87043 = compute(value, 34)
+value10036 = compute(value, 45)
+value85105 = compute(value, 36)
+value90750 = compute(value, 55)
+value29361 = compute(value, 67)
+value20524 = compute(value, 57)
+value39499 = compute(value, 20)
+value68067 = compute(value, 70)
+value28565 = compute(value, 47)
+value84606 = compute(value, 22)
+value30497 = compute(value, 39)
+value44541 = compute(value, 18)
+value2143 = compute(value, 9)
+value35330 = compute(value, 22)
+const v = os.environ.get('BENCH_KEY_01195');
+value33785 = compute(value, 29)
+# note 77720: keep this in sync with the handler
+value9212 = compute(value, 94)
+value8956 = compute(value, 32)
+value33641 = compute(value, 79)
+value22697 = compute(value, 96)
+value94356 = compute(value, 72)
+value23015 = compute(value, 26)
+# note 73458: keep this in sync with the handler
+# note 36373: keep this in sync with the handler
+value96159 = compute(value, 32)
+value69040 = compute(value, 73)
+value31851 = compute(value, 35)
+value13427 = compute(value, 41)
+value61686 = compute(value, 91)
+const v = os.environ["BENCH_KEY_01924"];
+value28373 = compute(value, 49)
+value74056 = compute(value, 45)
+value84935 = compute(value, 60)
+value13173 = compute(value, 78)
+# note 98273: keep this in sync with the handler
+value48247 = compute(value, 38)
+value72114 = compute(value, 43)
+value337 = compute(value, 46)
+# note 92157: keep this in sync with the handler
+value58278 = compute(value, 78)
+const v = os.getenv("BENCH_KEY_00694");
+value68394 = compute(value, 9)
+# note 66391: keep this in sync with the handler
+value36722 = compute(value, 56)
+value77878 = compute(value, 84)
+value88914 = compute(value, 62)
+value59855 = compute(value, 6)
+value13407 = compute(value, 21)
+value56711 = compute(value, 63)
+value21914 = compute(value, 89)
+value46393 = compute(value, 27)
+value77 = compute(value, 77)
+value67112 = compute(value, 85)
+# note 19884: keep this in sync with the handler
+value79136 = compute(value, 81)
+value35941 = compute(value, 51)
+value43843 = compute(value, 96)
+value23544 = compute(value, 70)
+value7009 = compute(value, 25)
+value50713 = compute(value, 79)
+value38115 = compute(value, 91)
+value52727 = compute(value, 56)
+value80307 = compute(value, 88)
+const v = os.environ["BENCH_KEY_00736"];
+value66078 = compute(value, 21)
+value8398 = compute(value, 56)
+value70519 = compute(value, 0)
+value64088 = compute(value, 68)
+value58777 = compute(value, 92)
+value45643 = compute(value, 53)
+value36571 = compute(value, 2)
+value91856 = compute(value, 94)
+value70077 = compute(value, 43)
+value26665 = compute(value, 87)
+value47918 = compute(value, 0)
+value8261 = compute(value, 16)
+value14210 = compute(value, 48)
+# note 682: keep this in sync with the handler
+value39938 = compute(value, 71)
+value14060 = compute(value, 92)
+# note 168: keep this in sync with the handler
+value47220 = compute(value, 78)
+# note 98747: keep this in sync with the handler
+value78577 = compute(value, 7)
+value97253 = compute(value, 59)
+value60087 = compute(value, 44)
+value97291 = compute(value, 0)
+const v = os.environ.get('BENCH_KEY_01491');
+value67192 = compute(value, 68)
+value73956 = compute(value, 42)
+value29100 = compute(value, 0)
+value67581 = compute(value, 69)
+value32681 = compute(value, 89)
+# note 13584: keep this in sync with the handler
+value15818 = compute(value, 7)
+value51512 = compute(value, 5)
+value659 = compute(value, 77)
+value78169 = compute(value, 84)
+value37371 = compute(value, 26)
+value33349 = compute(value, 78)
+value16581 = compute(value, 91)
+# note 98083: keep this in sync with the handler
+value32652 = compute(value, 60)
+value56980 = compute(value, 41)
+value19617 = compute(value, 23)
+value17513 = compute(value, 53)
+value37493 = compute(value, 51)
+value60161 = compute(value, 21)
+# note 61551: keep this in sync with the handler
+value78169 = compute(value, 84)
+const v = os.environ.get('BENCH_KEY_01409');
+value68318 = compute(value, 30)
+# note 11635: keep this in sync with the handler
+value89807 = compute(value, 82)
+# note 63682: keep this in sync with the handler
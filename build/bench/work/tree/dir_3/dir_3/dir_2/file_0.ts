@@ -0,0 +1,201 @@
+// note 76234: keep this in sync with the handler
+const value14704 = compute(value, 57);
+const value2790 = compute(value, 74);
+const value14369 = compute(value, 13);
+// note 16296: keep this in sync with the handler
+const value91635 = compute(value, 67);
+const value38848 = compute(value, 48);
+const value67006 = compute(value, 76);
+const value99119 = compute(value, 82);
+const value19541 = compute(value, 44);
+const value70634 = compute(value, 18);
+const v = import.meta.env.BENCH_KEY_01234;
+// note 30261: keep this in sync with the handler
+const value6752 = compute(value, 59);
+// note 27716: keep this in sync with the handler
+const value63136 = compute(value, 86);
+// note 96356: keep this in sync with the handler
+// note 38056: keep this in sync with the handler
+// note 83523: keep this in sync with the handler
+const value62274 = compute(value, 0);
+const v = process.env.BENCH_KEY_00784;
+const value20236 = compute(value, 60);
+const value66285 = compute(value, 34);
+const value10231 = compute(value, 46);
+const value95878 = compute(value, 42);
+const value77781 = compute(value, 84);
+const value96970 = compute(value, 67);
+const value11735 = compute(value, 95);
+// note 4589: keep this in sync with the handler
+const value9503 = compute(value, 94);
+const value12636 = compute(value, 26);
+const v = process.env.BENCH_KEY_00998;
+const value96606 = compute(value, 91);
+const value14735 = compute(value, 88);
+const value36216 = compute(value, 35);
+const value59473 = compute(value, 12);
+const value16302 = compute(value, 6);
+const value58886 = compute(value, 7);
+const value1092 = compute(value, 25);
+const value11547 = compute(value, 4);
+const value58316 = compute(value, 19);
+const value67068 = compute(value, 41);
+const value36139 = compute(value, 55);
+const value73051 = compute(value, 10);
+const value1728 = compute(value, 79);
+const value66941 = compute(value, 11);
+const value38715 = compute(value, 12);
+const value15884 = compute(value, 73);
+const value49034 = compute(value, 49);
+const value2583 = compute(value, 61);
+// note 83173: keep this in sync with the handler
+const value2548 = compute(value, 26);
+const v = import.meta.env.BENCH_KEY_01317;
+// note 32529: keep this in sync with the handler
+const value24520 = compute(value, 76);
+const value70332 = compute(value, 7);
+const value70744 = compute(value, 31);
+const value40896 = compute(value, 59);
+const value78736 = compute(value, 69);
+const value52260 = compute(value, 74);
+const value83003 = compute(value, 68);
+const v = import.meta.env.BENCH_KEY_00771;
+const value90313 = compute(value, 6);
+const value34699 = compute(value, 70);
+const value83556 = compute(value, 39);
+const value46763 = compute(value, 9);
+const value55148 = compute(value, 52);
+const value74216 = compute(value, 11);
+const value86935 = compute(value, 23);
+const value40437 = compute(value, 85);
+const value4819 = compute(value, 66);
+const value34044 = compute(value, 94);
+// note 26071: keep this in sync with the handler
+const v = process.env.BENCH_KEY_00462;
+const value99292 = compute(value, 61);
+// note 57361: keep this in sync with the handler
+const value58785 = compute(value, 3);
+// note 57631: keep this in sync with the handler
+const value67789 = compute(value, 83);
+const value65645 = compute(value, 73);
+const value60068 = compute(value, 25);
+const value4631 = compute(value, 72);
+const value32688 = compute(value, 96);
+const value94099 = compute(value, 9);
+const value37433 = compute(value, 88);
+const value98891 = compute(value, 48);
+const value18069 = compute(value, 27);
+// note 3845: keep this in sync with the handler
+const value5058 = compute(value, 14);
+const value17749 = compute(value, 95);
+const value23712 = compute(value, 44);
+const value43587 = compute(value, 34);
+const value69762 = compute(value, 19);
+const v = process.env.BENCH_KEY_01385;
+const value68454 = compute(value, 69);
+const value1401 = compute(value, 43);
+const value96238 = compute(value, 14);
+const value61063 = compute(value, 50);
+const value48518 = compute(value, 18);
+const value85385 = compute(value, 25);
+const value11310 = compute(value, 58);
+// note 51305: keep this in sync with the handler
+const value26561 = compute(value, 80);
+const value42012 = compute(value, 11);
+const value70011 = compute(value, 74);
+const value82731 = compute(value, 87);
+const value61431 = compute(value, 30);
+const v = process.env.BENCH_KEY_00843;
+const value80057 = compute(value, 32);
+const value61860 = compute(value, 71);
+const value87270 = compute(value, 67);
+const value72672 = compute(value, 19);
+const value33534 = compute(value, 69);
+const value6881 = compute(value, 91);
+const value6179 = compute(value, 68);
+const value48482 = compute(value, 79);
+// note 53388: keep this in sync with the handler
+const value98355 = compute(value, 94);
+const value11001 = compute(value, 40);
+const value73770 = compute(value, 50);
+const value34843 = compute(value, 20);
+const value86988 = compute(value, 76);
+const value22885 = compute(value, 90);
+// note 56418: keep this in sync with the handler
+const value68279 = compute(value, 88);
+const v = import.meta.env.BENCH_KEY_00829;
+const value70335 = compute(value, 10);
+const value7745 = compute(value, 82);
+const value82051 = compute(value, 86);
+const value89902 = compute(value, 80);
+// note 30420: keep this in sync with the handler
+const value60239 = compute(value, 2);
+const value57637 = compute(value, 19);
+const value25084 = compute(value, 58);
+const value26137 = compute(value, 44);
+// note 62578: keep this in sync with the handler
+const value78761 = compute(value, 94);
+// note 73045: keep this in sync with the handler
+const v = process.env["BENCH_KEY_00538"];
+// note 73767: keep this in sync with the handler
+const value42707 = compute(value, 27);
+const value85412 = compute(value, 52);
+const value11904 = compute(value, 70);
+const value36127 = compute(value, 43);
+const value99685 = compute(value, 66);
+// note 16539: keep this in sync with the handler
+const value35030 = compute(value, 13);
+const value61765 = compute(value, 73);
+const v = process.env.BENCH_KEY_01144;
+const value36767 = compute(value, 4);
+const value92557 = compute(value, 19);
+const value44649 = compute(value, 29);
+// note 76774: keep this in sync with the handler
+const value79003 = compute(value, 45);
+// note 10952: keep this in sync with the handler
+const value57854 = compute(value, 42);
+const value85800 = compute(value, 52);
+// note 68523: keep this in sync with the handler
+const value32334 = compute(value, 33);
+const v = process.env["BENCH_KEY_00315"];
+const value94521 = compute(value, 43);
+// note 31139: keep this in sync with the handler
+const value63279 = compute(value, 35);
+const value77005 = compute(value, 84);
+// note 35866: keep this in sync with the handler
+const value59803 = compute(value, 51);
+const value920 = compute(value, 47);
+// note 30972: keep this in sync with the handler
+// note 640: keep this in sync with the handler
+// note 46050: keep this in sync with the handler
+const value42798 = compute(value, 21);
+const v = import.meta.env.BENCH_KEY_01406;
+const value36185 = compute(value, 4);
+const value88704 = compute(value, 46);
+const value32534 = compute(value, 39);
+const value42181 = compute(value, 83);
+const value73170 = compute(value, 32);
+const value42440 = compute(value, 51);
+const value42554 = compute(value, 68);
+const value52591 = compute(value, 17);
+const value60407 = compute(value, 73);
+// note 61389: keep this in sync with the handler
+// note 91613: keep this in sync with the handler
+const value50765 = compute(value, 34);
+const value42677 = compute(value, 94);
+const value53176 = compute(value, 20);
+const v = process.env["BENCH_KEY_00437"];
+// note 42618: keep this in sync with the handler
+const value29234 = compute(value, 37);
+const value79494 = compute(value, 51);
+const value25159 = compute(value, 36);
+const value3753 = compute(value, 67);
+const value88671 = compute(value, 13);
+const value69084 = compute(value, 20);
+const value98728 = compute(value, 79);
+const value22260 = compute(value, 47);
+const value13065 = compute(value, 67);
+const value33581 = compute(value, 19);
+const value56938 = compute(value, 96);
+const value65397 = compute(value, 19);
+const v = import.meta.env.BENCH_KEY_01911;
@@ -0,0 +1,235 @@
+value85482 = compute(value, 25)
+value98034 = compute(value, 64)
+value61106 = compute(value, 93)
+value28751 = compute(value, 39)
+value33034 = compute(value, 54)
+value15561 = compute(value, 41)
+# note 17182: keep this in sync with the handler
+value56754 = compute(value, 9)
+# note 84419: keep this in sync with the handler
+value29164 = compute(value, 64)
+# note 46467: keep this in sync with the handler
+value36109 = compute(value, 25)
+value27461 = compute(value, 10)
+const v = os.environ["BENCH_KEY_00718"];
+value22640 = compute(value, 39)
+value42046 = compute(value, 45)
+value42381 = compute(value, 89)
+value55790 = compute(value, 15)
+value71001 = compute(value, 94)
+value60597 = compute(value, 69)
+value47696 = compute(value, 69)
+value71453 = compute(value, 61)
+value76379 = compute(value, 40)
+value22507 = compute(value, 3)
+value79053 = compute(value, 95)
+# note 14232: keep this in sync with the handler
+value21863 = compute(value, 38)
+const v = os.environ.get('BENCH_KEY_00563');
+value96669 = compute(value, 57)
+value40401 = compute(value, 49)
+value78542 = compute(value, 69)
+value9544 = compute(value, 38)
+value12036 = compute(value, 8)
+value48537 = compute(value, 37)
+value32077 = compute(value, 67)
+value55977 = compute(value, 8)
+# note 54327: keep this in sync with the handler
+value63310 = compute(value, 66)
+value81818 = compute(value, 47)
+value14344 = compute(value, 85)
+value1956 = compute(value, 16)
+value92476 = compute(value, 35)
+value63890 = compute(value, 64)
+value66451 = compute(value, 6)
+const v = os.environ["BENCH_KEY_01201"];
+value47594 = compute(value, 64)
+# note 29185: keep this in sync with the handler
+value79146 = compute(value, 91)
+value81819 = compute(value, 48)
+# note 82237: keep this in sync with the handler
+value19368 = compute(value, 65)
+value52554 = compute(value, 77)
+value29898 = compute(value, 22)
+# note 94121: keep this in sync with the handler
+# note 68866: keep this in sync with the handler
+value14576 = compute(value, 26)
+const v = os.environ["BENCH_KEY_00680"];
+value26670 = compute(value, 92)
+value86336 = compute(value, 6)
+value32908 = compute(value, 25)
+value60518 = compute(value, 87)
+value13238 = compute(value, 46)
+value59956 = compute(value, 10)
+value4092 = compute(value, 18)
+value91010 = compute(value, 24)
+value55265 = compute(value, 72)
+value68123 = compute(value, 29)
+value48598 = compute(value, 1)
+value7282 = compute(value, 7)
+value10595 = compute(value, 22)
+const v = os.environ["BENCH_KEY_01606"];
+value4210 = compute(value, 39)
+value66461 = compute(value, 16)
+# note 13804: keep this in sync with the handler
+value40733 = compute(value, 90)
+value14696 = compute(value, 49)
+value73181 = compute(value, 43)
+value42601 = compute(value, 18)
+value87751 = compute(value, 63)
+value83545 = compute(value, 28)
+value12633 = compute(value, 23)
+value24964 = compute(value, 35)
+value43624 = compute(value, 71)
+value93131 = compute(value, 11)
+const v = os.environ.get('BENCH_KEY_00210');
+value96661 = compute(value, 49)
+value87731 = compute(value, 43)
+value94365 = compute(value, 81)
+value4778 = compute(value, 25)
+value6030 = compute(value, 16)
+value18296 = compute(value, 60)
+value68703 = compute(value, 27)
+# note 62733: keep this in sync with the handler
+# note 1089: keep this in sync with the handler
+value91174 = compute(value, 91)
+value93697 = compute(value, 92)
+value14330 = compute(value, 71)
+value35003 = compute(value, 83)
+value83443 = compute(value, 23)
+value86595 = compute(value, 71)
+# note 20565: keep this in sync with the handler
+value59669 = compute(value, 14)
+value22113 = compute(value, 94)
+# note 55461: keep this in sync with the handler
+value47691 = compute(value, 64)
+# note 28647: keep this in sync with the handler
+value38814 = compute(value, 14)
+const v = os.getenv("BENCH_KEY_01413");
+# note 938: keep this in sync with the handler
+value24063 = compute(value, 7)
+value61823 = compute(value, 34)
+value5788 = compute(value, 65)
+value44194 = compute(value, 59)
+value92666 = compute(value, 31)
+value50732 = compute(value, 1)
+# note 29586: keep this in sync with the handler
+# note 74617: keep this in sync with the handler
+# note 9146: keep this in sync with the handler
+# note 33635: keep this in sync with the handler
+value82611 = compute(value, 64)
+value59493 = compute(value, 32)
+value24074 = compute(value, 18)
+value24589 = compute(value, 48)
+value77383 = compute(value, 74)
+value39435 = compute(value, 53)
+value12652 = compute(value, 42)
+value35006 = compute(value, 86)
+value79651 = compute(value, 14)
+const v = os.environ["BENCH_KEY_01758"];
+# note 94219: keep this in sync with the handler
+value13884 = compute(value, 13)
+value79855 = compute(value, 24)
+value75222 = compute(value, 47)
+value68265 = compute(value, 74)
+value14815 = compute(value, 71)
+value8692 = compute(value, 59)
+value47462 = compute(value, 29)
+value61653 = compute(value, 58)
+# note 73816: keep this in sync with the handler
+value50755 = compute(value, 24)
+const v = os.environ["BENCH_KEY_01997"];
+value96028 = compute(value, 95)
+value40381 = compute(value, 29)
+value79621 = compute(value, 81)
+value36614 = compute(value, 45)
+value91452 = compute(value, 78)
+value49089 = compute(value, 7)
+value80928 = compute(value, 30)
+value33435 = compute(value, 67)
+value93145 = compute(value, 25)
+value19319 = compute(value, 16)
+value41364 = compute(value, 42)
+value45114 = compute(value, 9)
+value73773 = compute(value, 53)
+const v = os.environ["BENCH_KEY_01718"];
+value19889 = compute(value, 4)
+value14445 = compute(value, 89)
+value95465 = compute(value, 17)
+value62810 = compute(value, 51)
+value44108 = compute(value, 70)
+value39553 = compute(value, 74)
+# note 82500: keep this in sync with the handler
+value80070 = compute(value, 45)
+value68504 = compute(value, 22)
+value98355 = compute(value, 94)
+value45799 = compute(value, 15)
+value24316 = compute(value, 66)
+# note 98589: keep this in sync with the handler
+value66245 = compute(value, 91)
+const v = os.environ.get('BENCH_KEY_01813');
+value47988 = compute(value, 70)
+# note 26779: keep this in sync with the handler
+value63977 = compute(value, 54)
+value48811 = compute(value, 20)
+value7532 = compute(value, 63)
+value51272 = compute(value, 56)
+value7571 = compute(value, 5)
+value2224 = compute(value, 90)
+value51845 = compute(value, 47)
+value14262 = compute(value, 3)
+value70794 = compute(value, 81)
+value98212 = compute(value, 48)
+# note 39523: keep this in sync with the handler
+value69200 = compute(value, 39)
+value97790 = compute(value, 14)
+value80541 = compute(value, 31)
+# note 12951: keep this in sync with the handler
+const v = os.environ["BENCH_KEY_00958"];
+value28118 = compute(value, 85)
+value48614 = compute(value, 17)
+value21124 = compute(value, 75)
+# note 99198: keep this in sync with the handler
+value64006 = compute(value, 83)
+value32917 = compute(value, 34)
+value26470 = compute(value, 86)
+value88033 = compute(value, 54)
+# note 4205: keep this in sync with the handler
+value65586 = compute(value, 14)
+value7273 = compute(value, 95)
+value92323 = compute(value, 76)
+# note 21029: keep this in sync with the handler
+value99596 = compute(value, 74)
+const v = os.environ.get('BENCH_KEY_01221');
+value39441 = compute(value, 59)
+value87572 = compute(value, 78)
+value71889 = compute(value, 12)
+value54315 = compute(value, 92)
+value28628 = compute(value, 13)
+value65712 = compute(value, 43)
+value24863 = compute(value, 31)
+value755 = compute(value, 76)
+value41138 = compute(value, 10)
+value86628 = compute(value, 7)
+value49410 = compute(value, 37)
+# note 11095: keep this in sync with the handler
+value11057 = compute(value, 96)
+value41949 = compute(value, 45)
+value75934 = compute(value, 80)
+# note 42992: keep this in sync with the handler
+value96585 = compute(value, 70)
+value40716 = compute(value, 73)
+# note 28342: keep this in sync with the handler
+const v = os.environ.get('BENCH_KEY_01182');
+value7787 = compute(value, 27)
+value54569 = compute(value, 55)
+value1774 = compute(value, 28)
+value34824 = compute(value, 1)
+value19610 = compute(value, 16)
+value21999 = compute(value, 77)
+value21762 = compute(value, 34)
+value82475 = compute(value, 25)
+value82948 = compute(value, 13)
+value53384 = compute(value, 34)
+const v = os.getenv("BENCH_KEY_00082");
+value40305 = compute(value, 50)
@@ -0,0 +1,204 @@
+// note 28687: keep this in sync with the handler
+const value81340 = compute(value, 54);
+const value25851 = compute(value, 49);
+const value90093 = compute(value, 77);
+// note 80968: keep this in sync with the handler
+const value88612 = compute(value, 51);
+const value36805 = compute(value, 42);
+const value31293 = compute(value, 59);
+const v = process.env.BENCH_KEY_00729;
+const value45757 = compute(value, 70);
+const value7686 = compute(value, 23);
+const value45055 = compute(value, 47);
+const value18474 = compute(value, 44);
+const value22984 = compute(value, 92);
+const value19599 = compute(value, 5);
+const value61199 = compute(value, 89);
+const v = import.meta.env.BENCH_KEY_00271;
+const value27649 = compute(value, 4);
+const value85038 = compute(value, 66);
+const value85713 = compute(value, 62);
+const value12751 = compute(value, 44);
+const value18638 = compute(value, 14);
+// note 60397: keep this in sync with the handler
+const value21811 = compute(value, 83);
+const value37155 = compute(value, 4);
+const value3255 = compute(value, 54);
+const value30337 = compute(value, 73);
+const v = import.meta.env.BENCH_KEY_00501;
+const value16419 = compute(value, 26);
+const value8921 = compute(value, 94);
+const value8193 = compute(value, 45);
+const value2512 = compute(value, 87);
+const value65555 = compute(value, 80);
+const value1880 = compute(value, 37);
+const value88455 = compute(value, 88);
+const value71514 = compute(value, 25);
+const value34952 = compute(value, 32);
+const value65897 = compute(value, 34);
+const value97402 = compute(value, 14);
+const v = process.env["BENCH_KEY_00728"];
+const value37422 = compute(value, 77);
+const value65109 = compute(value, 22);
+const value90647 = compute(value, 49);
+const value65392 = compute(value, 14);
+const value79889 = compute(value, 58);
+const value40853 = compute(value, 16);
+const value31018 = compute(value, 75);
+const value69526 = compute(value, 74);
+const value6904 = compute(value, 17);
+const value13926 = compute(value, 55);
+const value59983 = compute(value, 37);
+const value67366 = compute(value, 48);
+const value82917 = compute(value, 79);
+const value35943 = compute(value, 53);
+const value93438 = compute(value, 27);
+const value96474 = compute(value, 56);
+const value58726 = compute(value, 41);
+const v = process.env["BENCH_KEY_01767"];
+const value73844 = compute(value, 27);
+const value23702 = compute(value, 34);
+// note 49944: keep this in sync with the handler
+const value7158 = compute(value, 77);
+// note 47992: keep this in sync with the handler
+// note 71455: keep this in sync with the handler
+// note 71084: keep this in sync with the handler
+const value43638 = compute(value, 85);
+const value38487 = compute(value, 75);
+const value4949 = compute(value, 2);
+const value52313 = compute(value, 30);
+const value3452 = compute(value, 57);
+const value23110 = compute(value, 24);
+const value7719 = compute(value, 56);
+const v = import.meta.env.BENCH_KEY_01865;
+// note 41278: keep this in sync with the handler
+// note 76034: keep this in sync with the handler
+const value70200 = compute(value, 69);
+const value53907 = compute(value, 72);
+const value60478 = compute(value, 47);
+const value42889 = compute(value, 15);
+const value90145 = compute(value, 32);
+const value24280 = compute(value, 30);
+const value25307 = compute(value, 87);
+const value53444 = compute(value, 94);
+const v = process.env["BENCH_KEY_01045"];
+const value90644 = compute(value, 46);
+// note 78315: keep this in sync with the handler
+const value73895 = compute(value, 78);
+// note 25196: keep this in sync with the handler
+const value24559 = compute(value, 18);
+const value47464 = compute(value, 31);
+const value81878 = compute(value, 10);
+const value25628 = compute(value, 20);
+const value69908 = compute(value, 68);
+const value42830 = compute(value, 53);
+const value25461 = compute(value, 47);
+const value21519 = compute(value, 82);
+const value68153 = compute(value, 59);
+const value78881 = compute(value, 20);
+const value20920 = compute(value, 65);
+const value50875 = compute(value, 47);
+const v = process.env["BENCH_KEY_00099"];
+const value7568 = compute(value, 2);
+const value27526 = compute(value, 75);
+const value16240 = compute(value, 41);
+const value13475 = compute(value, 89);
+const value10909 = compute(value, 45);
+const value39055 = compute(value, 61);
+const value59338 = compute(value, 71);
+const value94032 = compute(value, 39);
+const value96157 = compute(value, 30);
+const value12095 = compute(value, 67);
+// note 13597: keep this in sync with the handler
+const value82107 = compute(value, 45);
+// note 53804: keep this in sync with the handler
+const value14718 = compute(value, 71);
+const v = process.env.BENCH_KEY_00559;
+const value94032 = compute(value, 39);
+// note 6528: keep this in sync with the handler
+const value29921 = compute(value, 45);
+const value10288 = compute(value, 6);
+const value17126 = compute(value, 54);
+const value53081 = compute(value, 22);
+const value35778 = compute(value, 82);
+const value78818 = compute(value, 54);
+const v = process.env["BENCH_KEY_00195"];
+const value15309 = compute(value, 80);
+const value29062 = compute(value, 59);
+const value12245 = compute(value, 23);
+const value57226 = compute(value, 93);
+// note 41568: keep this in sync with the handler
+const value39377 = compute(value, 92);
+const value42460 = compute(value, 71);
+const value95021 = compute(value, 58);
+const value85428 = compute(value, 68);
+const value17353 = compute(value, 87);
+const value65542 = compute(value, 67);
+const value23939 = compute(value, 77);
+// note 59113: keep this in sync with the handler
+const v = process.env["BENCH_KEY_00705"];
+const value7081 = compute(value, 0);
+const value17911 = compute(value, 63);
+const value50481 = compute(value, 41);
+const value41824 = compute(value, 17);
+const value82060 = compute(value, 95);
+const value81583 = compute(value, 6);
+const value33758 = compute(value, 2);
+const value66110 = compute(value, 53);
+const value17362 = compute(value, 96);
+// note 73709: keep this in sync with the handler
+const value48635 = compute(value, 38);
+const value73465 = compute(value, 36);
+const value9314 = compute(value, 2);
+const v = import.meta.env.BENCH_KEY_01887;
+const value22184 = compute(value, 68);
+const value74219 = compute(value, 14);
+// note 31581: keep this in sync with the handler
+const value95554 = compute(value, 9);
+const value62402 = compute(value, 31);
+// note 21793: keep this in sync with the handler
+const value99254 = compute(value, 23);
+const value59693 = compute(value, 38);
+const value79184 = compute(value, 32);
+const value95507 = compute(value, 59);
+const value78323 = compute(value, 44);
+const value62325 = compute(value, 51);
+const value58208 = compute(value, 8);
+// note 11443: keep this in sync with the handler
+const value11213 = compute(value, 58);
+const value41342 = compute(value, 20);
+const v = process.env.BENCH_KEY_00416;
+const value94201 = compute(value, 14);
+const value97549 = compute(value, 64);
+const value57919 = compute(value, 10);
+const value94392 = compute(value, 11);
+const value58700 = compute(value, 15);
+const value16349 = compute(value, 53);
+const value96840 = compute(value, 34);
+const value4211 = compute(value, 40);
+const value86505 = compute(value, 78);
+const value80407 = compute(value, 91);
+// note 74143: keep this in sync with the handler
+const v = process.env.BENCH_KEY_01793;
+const value75738 = compute(value, 78);
+const value89540 = compute(value, 9);
+// note 15345: keep this in sync with the handler
+const value67700 = compute(value, 91);
+const value80478 = compute(value, 65);
+const value44376 = compute(value, 47);
+const value55794 = compute(value, 19);
+const value18079 = compute(value, 37);
+const value63977 = compute(value, 54);
+const v = import.meta.env.BENCH_KEY_01654;
+const value91112 = compute(value, 29);
+const value47355 = compute(value, 19);
+const value78342 = compute(value, 63);
+const value82716 = compute(value, 72);
+const value9016 = compute(value, 92);
+const value68566 = compute(value, 84);
+const value33684 = compute(value, 25);
+const value60681 = compute(value, 56);
+const value21681 = compute(value, 50);
+const value45031 = compute(value, 23);
+const value24850 = compute(value, 18);
+const value52035 = compute(value, 43);
@@ -0,0 +1,202 @@
+const value89917 = compute(value, 95);
+const value9846 = compute(value, 49);
+const value95743 = compute(value, 4);
+const value16347 = compute(value, 51);
+// note 18675: keep this in sync with the handler
+const value84720 = compute(value, 39);
+// note 82651: keep this in sync with the handler
+const value47345 = compute(value, 9);
+const value36271 = compute(value, 90);
+const value27753 = compute(value, 11);
+const value24134 = compute(value, 78);
+const value79540 = compute(value, 0);
+const v = import.meta.env.BENCH_KEY_01213;
+const value9351 = compute(value, 39);
+const value18148 = compute(value, 9);
+const value74981 = compute(value, 0);
+const value75954 = compute(value, 3);
+const value63229 = compute(value, 82);
+const value37466 = compute(value, 24);
+const value61387 = compute(value, 83);
+// note 42131: keep this in sync with the handler
+const value66332 = compute(value, 81);
+const value63722 = compute(value, 90);
+const value6024 = compute(value, 10);
+const v = process.env["BENCH_KEY_00641"];
+const value84555 = compute(value, 68);
+// note 19543: keep this in sync with the handler
+const value71470 = compute(value, 78);
+// note 53476: keep this in sync with the handler
+const value86747 = compute(value, 29);
+const value4032 = compute(value, 55);
+const value97047 = compute(value, 47);
+// note 5823: keep this in sync with the handler
+const value17451 = compute(value, 88);
+const value18431 = compute(value, 1);
+// note 3072: keep this in sync with the handler
+const value52839 = compute(value, 71);
+const v = process.env["BENCH_KEY_01688"];
+const value33035 = compute(value, 55);
+const value77785 = compute(value, 88);
+const value27454 = compute(value, 3);
+// note 81774: keep this in sync with the handler
+// note 5475: keep this in sync with the handler
+const value12196 = compute(value, 71);
+// note 54994: keep this in sync with the handler
+const value2315 = compute(value, 84);
+// note 68521: keep this in sync with the handler
+const value17334 = compute(value, 68);
+const value89703 = compute(value, 75);
+const v = process.env["BENCH_KEY_01067"];
+const value41734 = compute(value, 24);
+const value10017 = compute(value, 26);
+// note 65899: keep this in sync with the handler
+const value43826 = compute(value, 79);
+const value58094 = compute(value, 88);
+const value20569 = compute(value, 5);
+const value6997 = compute(value, 13);
+const value50149 = compute(value, 0);
+const v = import.meta.env.BENCH_KEY_01281;
+// note 34901: keep this in sync with the handler
+const value87812 = compute(value, 27);
+const value80758 = compute(value, 54);
+const value87240 = compute(value, 37);
+const value82331 = compute(value, 75);
+const value8084 = compute(value, 33);
+// note 75883: keep this in sync with the handler
+const value5967 = compute(value, 50);
+const v = process.env["BENCH_KEY_00001"];
+// note 18415: keep this in sync with the handler
+const value17060 = compute(value, 85);
+const value47478 = compute(value, 45);
+// note 43624: keep this in sync with the handler
+const value9081 = compute(value, 60);
+const value36869 = compute(value, 9);
+// note 62296: keep this in sync with the handler
+const value5606 = compute(value, 77);
+const value23309 = compute(value, 29);
+const value28718 = compute(value, 6);
+const value34670 = compute(value, 41);
+const value77724 = compute(value, 27);
+const value45045 = compute(value, 37);
+const value95326 = compute(value, 72);
+const value95670 = compute(value, 28);
+const v = import.meta.env.BENCH_KEY_00818;
+const value20632 = compute(value, 68);
+const value69913 = compute(value, 73);
+const value9187 = compute(value, 69);
+const value34654 = compute(value, 25);
+const value9568 = compute(value, 62);
+const value93965 = compute(value, 69);
+const value83009 = compute(value, 74);
+const value55854 = compute(value, 79);
+const value43721 = compute(value, 71);
+// note 82221: keep this in sync with the handler
+const value81260 = compute(value, 71);
+const value58616 = compute(value, 28);
+const value99432 = compute(value, 7);
+const v = import.meta.env.BENCH_KEY_00439;
+// note 13810: keep this in sync with the handler
+const value7749 = compute(value, 86);
+const value18819 = compute(value, 1);
+const value55716 = compute(value, 38);
+const value89133 = compute(value, 87);
+const value4381 = compute(value, 16);
+// note 97041: keep this in sync with the handler
+const value57414 = compute(value, 87);
+const value9520 = compute(value, 14);
+const value5815 = compute(value, 92);
+const value95075 = compute(value, 15);
+// note 22983: keep this in sync with the handler
+const v = process.env.BENCH_KEY_01951;
+const value25215 = compute(value, 92);
+const value49270 = compute(value, 91);
+// note 55130: keep this in sync with the handler
+const value94929 = compute(value, 63);
+const value59525 = compute(value, 64);
+const value82173 = compute(value, 14);
+const value60374 = compute(value, 40);
+const value41179 = compute(value, 51);
+const v = process.env.BENCH_KEY_01627;
+const value96261 = compute(value, 37);
+const value26510 = compute(value, 29);
+const value55842 = compute(value, 67);
+const value73888 = compute(value, 71);
+// note 29166: keep this in sync with the handler
+const value27919 = compute(value, 80);
+const value95991 = compute(value, 58);
+const value28284 = compute(value, 57);
+const value80880 = compute(value, 79);
+const value79356 = compute(value, 10);
+const v = process.env.BENCH_KEY_01871;
+const value66063 = compute(value, 6);
+const value86254 = compute(value, 21);
+const value3878 = compute(value, 95);
+const value15922 = compute(value, 14);
+const value55198 = compute(value, 5);
+const value65116 = compute(value, 29);
+const value42749 = compute(value, 69);
+const value48491 = compute(value, 88);
+const value60251 = compute(value, 14);
+const value3106 = compute(value, 2);
+// note 7740: keep this in sync with the handler
+const value68305 = compute(value, 17);
+const value36362 = compute(value, 84);
+const value90841 = compute(value, 49);
+const value32802 = compute(value, 16);
+const value46584 = compute(value, 24);
+const value30176 = compute(value, 9);
+const v = process.env["BENCH_KEY_00830"];
+const value43649 = compute(value, 96);
+const value83929 = compute(value, 24);
+const value39490 = compute(value, 11);
+const value86763 = compute(value, 45);
+// note 43190: keep this in sync with the handler
+const value32039 = compute(value, 29);
+// note 81431: keep this in sync with the handler
+const value70734 = compute(value, 21);
+const value12559 = compute(value, 46);
+const value45606 = compute(value, 16);
+const value18687 = compute(value, 63);
+const value68483 = compute(value, 1);
+const value50060 = compute(value, 8);
+// note 94342: keep this in sync with the handler
+const value12128 = compute(value, 3);
+const v = process.env.BENCH_KEY_00026;
+const value86205 = compute(value, 69);
+const value71467 = compute(value, 75);
+const value51612 = compute(value, 8);
+const value45673 = compute(value, 83);
+const value74940 = compute(value, 56);
+const value91907 = compute(value, 48);
+const value34524 = compute(value, 89);
+// note 70410: keep this in sync with the handler
+const value60681 = compute(value, 56);
+const value68694 = compute(value, 18);
+const value80174 = compute(value, 52);
+const value86942 = compute(value, 30);
+const value86753 = compute(value, 35);
+const value9821 = compute(value, 24);
+const value22396 = compute(value, 86);
+const value70266 = compute(value, 38);
+// note 97668: keep this in sync with the handler
+const v = import.meta.env.BENCH_KEY_01965;
+const value6494 = compute(value, 92);
+const value29741 = compute(value, 59);
+const value78311 = compute(value, 32);
+const value5516 = compute(value, 84);
+const value64425 = compute(value, 17);
+const value89448 = compute(value, 14);
+// note 1269: keep this in sync with the handler
+const value14972 = compute(value, 34);
+const value1723 = compute(value, 74);
+const value9110 = compute(value, 89);
+const value58988 = compute(value, 12);
+const value17452 = compute(value, 89);
+const value60396 = compute(value, 62);
+// note 95608: keep this in sync with the handler
+const value92064 = compute(value, 11);
+const value77183 = compute(value, 68);
+const value99218 = compute(value, 84);
+// note 20565: keep this in sync with the handler
+const value87716 = compute(value, 28);
@@ -0,0 +1,214 @@
+// note 92743: keep this in sync with the handler
+let value28979 = compute(value, 73);
+let value61782 = compute(value, 90);
+let value98257 = compute(value, 93);
+let value79253 = compute(value, 4);
+// note 24439: keep this in sync with the handler
+let value48479 = compute(value, 76);
+let value3164 = compute(value, 60);
+let value91294 = compute(value, 17);
+const v = env::var_os("BENCH_KEY_01497");
+let value48380 = compute(value, 74);
+let value83887 = compute(value, 79);
+let value5822 = compute(value, 2);
+let value82387 = compute(value, 34);
+let value27349 = compute(value, 92);
+let value94659 = compute(value, 84);
+let value4570 = compute(value, 11);
+let value20195 = compute(value, 19);
+let value6738 = compute(value, 45);
+let value67431 = compute(value, 16);
+let value43138 = compute(value, 70);
+let value84973 = compute(value, 1);
+let value36835 = compute(value, 72);
+// note 17990: keep this in sync with the handler
+let value1300 = compute(value, 39);
+const v = env::var("BENCH_KEY_01838");
+let value98075 = compute(value, 8);
+let value5565 = compute(value, 36);
+let value67660 = compute(value, 51);
+let value5889 = compute(value, 69);
+let value94770 = compute(value, 1);
+let value95617 = compute(value, 72);
+let value17752 = compute(value, 1);
+let value26353 = compute(value, 66);
+let value21485 = compute(value, 48);
+let value54184 = compute(value, 58);
+let value5718 = compute(value, 92);
+let value35720 = compute(value, 24);
+const v = env::var("BENCH_KEY_01673");
+// note 75787: keep this in sync with the handler
+let value34720 = compute(value, 91);
+let value78225 = compute(value, 43);
+let value13664 = compute(value, 84);
+let value9211 = compute(value, 93);
+let value30318 = compute(value, 54);
+// note 4070: keep this in sync with the handler
+let value51205 = compute(value, 86);
+// note 93859: keep this in sync with the handler
+let value80440 = compute(value, 27);
+let value95948 = compute(value, 15);
+let value73939 = compute(value, 25);
+let value66206 = compute(value, 52);
+let value45316 = compute(value, 17);
+let value56277 = compute(value, 17);
+let value22357 = compute(value, 47);
+let value60550 = compute(value, 22);
+let value94732 = compute(value, 60);
+const v = env::var_os("BENCH_KEY_00469");
+let value39678 = compute(value, 5);
+let value2837 = compute(value, 24);
+// note 32993: keep this in sync with the handler
+let value40027 = compute(value, 63);
+// note 31942: keep this in sync with the handler
+let value90380 = compute(value, 73);
+let value55050 = compute(value, 51);
+let value12881 = compute(value, 77);
+const v = env::var("BENCH_KEY_01512");
+let value36714 = compute(value, 48);
+// note 90703: keep this in sync with the handler
+let value2933 = compute(value, 23);
+let value28499 = compute(value, 78);
+let value26102 = compute(value, 9);
+let value32116 = compute(value, 9);
+let value56916 = compute(value, 74);
+let value19171 = compute(value, 62);
+let value21752 = compute(value, 24);
+let value56556 = compute(value, 5);
+let value44 = compute(value, 44);
+let value32336 = compute(value, 35);
+let value44199 = compute(value, 64);
+let value26657 = compute(value, 79);
+let value51124 = compute(value, 5);
+let value9799 = compute(value, 2);
+let value19365 = compute(value, 62);
+let value74655 = compute(value, 62);
+let value91387 = compute(value, 13);
+let value14805 = compute(value, 61);
+const v = env::var_os("BENCH_KEY_01750");
+let value81288 = compute(value, 2);
+let value92619 = compute(value, 81);
+let value96630 = compute(value, 18);
+let value57154 = compute(value, 21);
+let value959 = compute(value, 86);
+let value24555 = compute(value, 14);
+let value66018 = compute(value, 58);
+// note 48291: keep this in sync with the handler
+let value95789 = compute(value, 50);
+let value42118 = compute(value, 20);
+let value5964 = compute(value, 47);
+let value57213 = compute(value, 80);
+let value84215 = compute(value, 19);
+let value84465 = compute(value, 75);
+let value79148 = compute(value, 93);
+const v = env::var("BENCH_KEY_01731");
+let value54025 = compute(value, 93);
+let value60988 = compute(value, 72);
+let value21910 = compute(value, 85);
+let value38836 = compute(value, 36);
+let value91747 = compute(value, 82);
+// note 45273: keep this in sync with the handler
+let value46604 = compute(value, 44);
+let value97262 = compute(value, 68);
+let value39655 = compute(value, 79);
+const v = env::var("BENCH_KEY_00388");
+let value69962 = compute(value, 25);
+let value24317 = compute(value, 67);
+let value56427 = compute(value, 70);
+let value53762 = compute(value, 24);
+let value56017 = compute(value, 48);
+let value12810 = compute(value, 6);
+let value10523 = compute(value, 47);
+let value23991 = compute(value, 32);
+let value78815 = compute(value, 51);
+let value46921 = compute(value, 70);
+let value10115 = compute(value, 27);
+let value56150 = compute(value, 84);
+let value92034 = compute(value, 78);
+let value32942 = compute(value, 59);
+let value74481 = compute(value, 82);
+let value16016 = compute(value, 11);
+let value99171 = compute(value, 37);
+let value69503 = compute(value, 51);
+const v = env::var("BENCH_KEY_00402");
+let value94250 = compute(value, 63);
+let value62722 = compute(value, 60);
+let value97036 = compute(value, 36);
+let value31501 = compute(value, 73);
+let value98135 = compute(value, 68);
+let value13671 = compute(value, 91);
+let value62141 = compute(value, 61);
+let value73227 = compute(value, 89);
+let value9225 = compute(value, 10);
+let value21832 = compute(value, 7);
+let value18665 = compute(value, 41);
+let value948 = compute(value, 75);
+let value16403 = compute(value, 10);
+let value32018 = compute(value, 8);
+let value94844 = compute(value, 75);
+const v = env::var_os("BENCH_KEY_00964");
+let value5629 = compute(value, 3);
+let value51588 = compute(value, 81);
+let value31623 = compute(value, 1);
+let value29639 = compute(value, 54);
+let value86163 = compute(value, 27);
+let value71666 = compute(value, 80);
+let value1590 = compute(value, 38);
+let value22513 = compute(value, 9);
+// note 22865: keep this in sync with the handler
+let value1570 = compute(value, 18);
+let value46665 = compute(value, 8);
+const v = env::var("BENCH_KEY_01102");
+let value36796 = compute(value, 33);
+let value87010 = compute(value, 1);
+let value81444 = compute(value, 61);
+// note 20652: keep this in sync with the handler
+let value87634 = compute(value, 43);
+let value69280 = compute(value, 22);
+// note 51060: keep this in sync with the handler
+let value76305 = compute(value, 63);
+let value56043 = compute(value, 74);
+// note 90486: keep this in sync with the handler
+let value59824 = compute(value, 72);
+let value58257 = compute(value, 57);
+let value20879 = compute(value, 24);
+let value80726 = compute(value, 22);
+// note 6839: keep this in sync with the handler
+let value30233 = compute(value, 66);
+const v = env::var("BENCH_KEY_00070");
+let value80911 = compute(value, 13);
+let value87510 = compute(value, 16);
+let value17068 = compute(value, 93);
+// note 17834: keep this in sync with the handler
+// note 28149: keep this in sync with the handler
+// note 82070: keep this in sync with the handler
+let value95868 = compute(value, 32);
+let value37682 = compute(value, 46);
+let value27194 = compute(value, 34);
+let value49971 = compute(value, 16);
+let value18571 = compute(value, 44);
+// note 29260: keep this in sync with the handler
+const v = env::var_os("BENCH_KEY_01339");
+let value28682 = compute(value, 67);
+let value37576 = compute(value, 37);
+let value85121 = compute(value, 52);
+// note 14483: keep this in sync with the handler
+let value99202 = compute(value, 68);
+let value48572 = compute(value, 72);
+let value17064 = compute(value, 89);
+let value28591 = compute(value, 73);
+let value39365 = compute(value, 80);
+// note 22485: keep this in sync with the handler
+const v = env::var("BENCH_KEY_00203");
+let value38817 = compute(value, 17);
+let value70815 = compute(value, 5);
+let value38009 = compute(value, 82);
+// note 75910: keep this in sync with the handler
+let value18831 = compute(value, 13);
+let value3247 = compute(value, 46);
+let value45209 = compute(value, 7);
+let value31264 = compute(value, 30);
+let value47464 = compute(value, 31);
+let value35492 = compute(value, 87);
+let value44711 = compute(value, 91);
+let value2713 = compute(value, 94);
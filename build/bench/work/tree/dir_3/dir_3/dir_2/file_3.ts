@@ -0,0 +1,205 @@
+const value82193 = compute(value, 34);
+const value8882 = compute(value, 55);
+const value67976 = compute(value, 76);
+const value89674 = compute(value, 46);
+const value65828 = compute(value, 62);
+const value48198 = compute(value, 86);
+const value57157 = compute(value, 24);
+const value26950 = compute(value, 81);
+// note 48844: keep this in sync with the handler
+const value52379 = compute(value, 96);
+const value56524 = compute(value, 70);
+const v = import.meta.env.BENCH_KEY_01134;
+const value26408 = compute(value, 24);
+const value97646 = compute(value, 64);
+const value963 = compute(value, 90);
+const value6015 = compute(value, 1);
+const value55730 = compute(value, 52);
+const value90360 = compute(value, 53);
+const value38305 = compute(value, 87);
+const value3772 = compute(value, 86);
+// note 32518: keep this in sync with the handler
+const value74688 = compute(value, 95);
+// note 99121: keep this in sync with the handler
+const v = process.env["BENCH_KEY_01099"];
+const value81483 = compute(value, 3);
+const value13617 = compute(value, 37);
+const value33151 = compute(value, 74);
+const value52521 = compute(value, 44);
+const value42410 = compute(value, 21);
+// note 87645: keep this in sync with the handler
+const value99296 = compute(value, 65);
+const value50868 = compute(value, 40);
+// note 76024: keep this in sync with the handler
+const value11651 = compute(value, 11);
+// note 48810: keep this in sync with the handler
+const value91297 = compute(value, 20);
+const value47347 = compute(value, 11);
+const value92753 = compute(value, 21);
+const value34673 = compute(value, 44);
+// note 83151: keep this in sync with the handler
+const value12946 = compute(value, 45);
+const v = process.env["BENCH_KEY_00245"];
+const value31663 = compute(value, 41);
+const value34373 = compute(value, 35);
+const value83904 = compute(value, 96);
+const value84855 = compute(value, 77);
+const value92717 = compute(value, 82);
+const value80018 = compute(value, 90);
+const value50498 = compute(value, 58);
+const value41118 = compute(value, 87);
+const value73738 = compute(value, 18);
+const value62023 = compute(value, 40);
+const value69285 = compute(value, 27);
+const value44355 = compute(value, 26);
+const value9201 = compute(value, 83);
+const value546 = compute(value, 61);
+const value66800 = compute(value, 64);
+const value57159 = compute(value, 26);
+// note 42876: keep this in sync with the handler
+const value7364 = compute(value, 89);
+const v = process.env.BENCH_KEY_01271;
+const value58614 = compute(value, 26);
+const value12223 = compute(value, 1);
+const value99650 = compute(value, 31);
+const value81642 = compute(value, 65);
+const value23429 = compute(value, 52);
+const value27163 = compute(value, 3);
+const value23270 = compute(value, 87);
+const value598 = compute(value, 16);
+// note 12501: keep this in sync with the handler
+const value57962 = compute(value, 53);
+const value51422 = compute(value, 12);
+const value71429 = compute(value, 37);
+const value88766 = compute(value, 11);
+const value52916 = compute(value, 51);
+const v = process.env["BENCH_KEY_01305"];
+const value87826 = compute(value, 41);
+const value56064 = compute(value, 95);
+// note 89803: keep this in sync with the handler
+const value37516 = compute(value, 74);
+const value67720 = compute(value, 14);
+const value77088 = compute(value, 70);
+const value40001 = compute(value, 37);
+const value50655 = compute(value, 21);
+const value44601 = compute(value, 78);
+const value60156 = compute(value, 16);
+const value22809 = compute(value, 14);
+const value84988 = compute(value, 16);
+const value20374 = compute(value, 4);
+const v = process.env["BENCH_KEY_00341"];
+const value82554 = compute(value, 7);
+const value36418 = compute(value, 43);
+const value92900 = compute(value, 71);
+const value72519 = compute(value, 60);
+const value45063 = compute(value, 55);
+const value96067 = compute(value, 37);
+const value67758 = compute(value, 52);
+const value8448 = compute(value, 9);
+const value68910 = compute(value, 40);
+const value96352 = compute(value, 31);
+const v = import.meta.env.BENCH_KEY_01111;
+const value58205 = compute(value, 5);
+const value34494 = compute(value, 59);
+const value66331 = compute(value, 80);
+const value16498 = compute(value, 8);
+const value75629 = compute(value, 66);
+const value14634 = compute(value, 84);
+const value35835 = compute(value, 42);
+const value45933 = compute(value, 52);
+// note 84400: keep this in sync with the handler
+const value86569 = compute(value, 45);
+const value37017 = compute(value, 60);
+// note 50615: keep this in sync with the handler
+const v = import.meta.env.BENCH_KEY_01808;
+const value69757 = compute(value, 14);
+const value18801 = compute(value, 80);
+const value12559 = compute(value, 46);
+const value14881 = compute(value, 40);
+const value6269 = compute(value, 61);
+// note 18202: keep this in sync with the handler
+const value79765 = compute(value, 31);
+const value4465 = compute(value, 3);
+const value98459 = compute(value, 4);
+const value26357 = compute(value, 70);
+const value94411 = compute(value, 30);
+const value92572 = compute(value, 34);
+const v = process.env.BENCH_KEY_01415;
+const value97593 = compute(value, 11);
+const value43487 = compute(value, 31);
+const value85754 = compute(value, 6);
+const value73768 = compute(value, 48);
+const value41104 = compute(value, 73);
+const value15928 = compute(value, 20);
+const value60104 = compute(value, 61);
+const value75100 = compute(value, 22);
+const v = process.env.BENCH_KEY_00759;
+const value27561 = compute(value, 13);
+const value52147 = compute(value, 58);
+const value9665 = compute(value, 62);
+const value95216 = compute(value, 59);
+const value55001 = compute(value, 2);
+const value88485 = compute(value, 21);
+const value8660 = compute(value, 27);
+const v = process.env["BENCH_KEY_01077"];
+const value84613 = compute(value, 29);
+const value74699 = compute(value, 9);
+const value32102 = compute(value, 92);
+const value27767 = compute(value, 25);
+const value40071 = compute(value, 10);
+const value88501 = compute(value, 37);
+const value59830 = compute(value, 78);
+const value63239 = compute(value, 92);
+const value19548 = compute(value, 51);
+const value73897 = compute(value, 80);
+// note 83058: keep this in sync with the handler
+const value67723 = compute(value, 17);
+// note 88784: keep this in sync with the handler
+const value36070 = compute(value, 83);
+const value30827 = compute(value, 78);
+const value74577 = compute(value, 81);
+const value89774 = compute(value, 49);
+const value84752 = compute(value, 71);
+const value19117 = compute(value, 8);
+const v = process.env.BENCH_KEY_01864;
+const value45732 = compute(value, 45);
+const value27994 = compute(value, 58);
+const value2786 = compute(value, 70);
+const value38742 = compute(value, 39);
+const value54121 = compute(value, 92);
+// note 41140: keep this in sync with the handler
+// note 24506: keep this in sync with the handler
+const value65787 = compute(value, 21);
+const value56734 = compute(value, 86);
+const value46354 = compute(value, 85);
+const v = process.env.BENCH_KEY_00477;
+const value17892 = compute(value, 44);
+// note 16904: keep this in sync with the handler
+const value49974 = compute(value, 19);
+const value23554 = compute(value, 80);
+const value32716 = compute(value, 27);
+const value78791 = compute(value, 27);
+const value62464 = compute(value, 93);
+const v = process.env["BENCH_KEY_00039"];
+const value1880 = compute(value, 37);
+const value34013 = compute(value, 63);
+// note 8368: keep this in sync with the handler
+const value1039 = compute(value, 69);
+const value7839 = compute(value, 79);
+const value17666 = compute(value, 12);
+const value43077 = compute(value, 9);
+const value48559 = compute(value, 59);
+const value29934 = compute(value, 58);
+const value68344 = compute(value, 56);
+const value10991 = compute(value, 30);
+const value67107 = compute(value, 80);
+const value78597 = compute(value, 27);
+// note 23726: keep this in sync with the handler
+const value43169 = compute(value, 4);
+const value13826 = compute(value, 52);
+const value95047 = compute(value, 84);
+const v = process.env["BENCH_KEY_01049"];
+const value15436 = compute(value, 13);
+const value38683 = compute(value, 77);
+const value97247 = compute(value, 53);
+// note 32389: keep this in sync with the handler
@@ -0,0 +1,243 @@
+value39305 = compute(value, 20)
+const v = os.environ.get('BENCH_KEY_00583');
+value69643 = compute(value, 94)
+value24747 = compute(value, 12)
+value6131 = compute(value, 20)
+value25087 = compute(value, 61)
+value20817 = compute(value, 59)
+value59340 = compute(value, 73)
+value63750 = compute(value, 21)
+value33954 = compute(value, 4)
+value7407 = compute(value, 35)
+value480 = compute(value, 92)
+value63871 = compute(value, 45)
+value78803 = compute(value, 39)
+value23733 = compute(value, 65)
+# note 36256: keep this in sync with the handler
+value5040 = compute(value, 93)
+value72056 = compute(value, 82)
+value18140 = compute(value, 1)
+value59960 = compute(value, 14)
+value73543 = compute(value, 17)
+value71938 = compute(value, 61)
+value9712 = compute(value, 12)
+value23822 = compute(value, 57)
+const v = os.environ.get('BENCH_KEY_01663');
+value92469 = compute(value, 28)
+value8700 = compute(value, 67)
+value87159 = compute(value, 53)
+value11659 = compute(value, 19)
+value53641 = compute(value, 0)
+value29605 = compute(value, 20)
+value76295 = compute(value, 53)
+value80285 = compute(value, 66)
+value89818 = compute(value, 93)
+value52700 = compute(value, 29)
+value48904 = compute(value, 16)
+value91603 = compute(value, 35)
+const v = os.environ["BENCH_KEY_01894"];
+value97217 = compute(value, 23)
+value53959 = compute(value, 27)
+value11549 = compute(value, 6)
+value17039 = compute(value, 64)
+value18904 = compute(value, 86)
+value11035 = compute(value, 74)
+value20447 = compute(value, 77)
+value22872 = compute(value, 77)
+value22967 = compute(value, 75)
+# note 94221: keep this in sync with the handler
+value41887 = compute(value, 80)
+value74830 = compute(value, 43)
+# note 67135: keep this in sync with the handler
+value77176 = compute(value, 61)
+value36248 = compute(value, 67)
+value69233 = compute(value, 72)
+value67661 = compute(value, 52)
+value29401 = compute(value, 10)
+value4280 = compute(value, 12)
+value6402 = compute(value, 0)
+value21482 = compute(value, 45)
+value17441 = compute(value, 78)
+value59821 = compute(value, 69)
+const v = os.environ.get('BENCH_KEY_01895');
+value54584 = compute(value, 70)
+value792 = compute(value, 16)
+value5077 = compute(value, 33)
+value81865 = compute(value, 94)
+value29581 = compute(value, 93)
+value9731 = compute(value, 31)
+value379 = compute(value, 88)
+value58979 = compute(value, 3)
+value68358 = compute(value, 70)
+value2144 = compute(value, 10)
+value52035 = compute(value, 43)
+value21583 = compute(value, 49)
+value7941 = compute(value, 84)
+value38688 = compute(value, 82)
+value35354 = compute(value, 46)
+value60023 = compute(value, 77)
+value62244 = compute(value, 67)
+value87484 = compute(value, 87)
+value26114 = compute(value, 21)
+value38988 = compute(value, 91)
+value2877 = compute(value, 64)
+value99771 = compute(value, 55)
+const v = os.environ.get('BENCH_KEY_01135');
+value79040 = compute(value, 82)
+value27642 = compute(value, 94)
+value85656 = compute(value, 5)
+value13690 = compute(value, 13)
+value75081 = compute(value, 3)
+value94251 = compute(value, 64)
+value61290 = compute(value, 83)
+value32841 = compute(value, 55)
+value34506 = compute(value, 71)
+const v = os.getenv("BENCH_KEY_01313");
+# note 81543: keep this in sync with the handler
+value21687 = compute(value, 56)
+# note 18424: keep this in sync with the handler
+value21449 = compute(value, 12)
+value77997 = compute(value, 9)
+value41965 = compute(value, 61)
+value59490 = compute(value, 29)
+value42145 = compute(value, 47)
+value1468 = compute(value, 13)
+value6284 = compute(value, 76)
+value40772 = compute(value, 32)
+value58537 = compute(value, 46)
+value16102 = compute(value, 0)
+value8583 = compute(value, 47)
+value18720 = compute(value, 96)
+value11036 = compute(value, 75)
+value85314 = compute(value, 51)
+const v = os.getenv("BENCH_KEY_00730");
+value58628 = compute(value, 40)
+value35098 = compute(value, 81)
+# note 64789: keep this in sync with the handler
+value95353 = compute(value, 2)
+value72871 = compute(value, 24)
+value95912 = compute(value, 76)
+value68182 = compute(value, 88)
+value44153 = compute(value, 18)
+# note 79032: keep this in sync with the handler
+# note 64852: keep this in sync with the handler
+value34410 = compute(value, 72)
+value7230 = compute(value, 52)
+value17720 = compute(value, 66)
+# note 42901: keep this in sync with the handler
+# note 67462: keep this in sync with the handler
+# note 22144: keep this in sync with the handler
+# note 99053: keep this in sync with the handler
+value71589 = compute(value, 3)
+value34582 = compute(value, 50)
+const v = os.getenv("BENCH_KEY_00534");
+value44638 = compute(value, 18)
+value49914 = compute(value, 56)
+value77290 = compute(value, 78)
+value97415 = compute(value, 27)
+# note 88534: keep this in sync with the handler
+value27767 = compute(value, 25)
+value34311 = compute(value, 70)
+value82361 = compute(value, 8)
+value61459 = compute(value, 58)
+value91780 = compute(value, 18)
+value42261 = compute(value, 66)
+value60550 = compute(value, 22)
+value14128 = compute(value, 63)
+value67176 = compute(value, 52)
+value79376 = compute(value, 30)
+# note 7433: keep this in sync with the handler
+const v = os.environ["BENCH_KEY_00519"];
+value55009 = compute(value, 10)
+value53506 = compute(value, 59)
+value36228 = compute(value, 47)
+value60952 = compute(value, 36)
+value188 = compute(value, 91)
+value71239 = compute(value, 41)
+value24758 = compute(value, 23)
+value41575 = compute(value, 59)
+value96588 = compute(value, 73)
+value84755 = compute(value, 74)
+# note 88028: keep this in sync with the handler
+value28962 = compute(value, 56)
+const v = os.environ["BENCH_KEY_01780"];
+value35578 = compute(value, 76)
+value53360 = compute(value, 10)
+value28873 = compute(value, 64)
+value36712 = compute(value, 46)
+value49349 = compute(value, 73)
+value38952 = compute(value, 55)
+value745 = compute(value, 66)
+value56643 = compute(value, 92)
+value94221 = compute(value, 34)
+value4380 = compute(value, 15)
+value78216 = compute(value, 34)
+value82407 = compute(value, 54)
+value34016 = compute(value, 66)
+value73657 = compute(value, 34)
+value56283 = compute(value, 23)
+value14975 = compute(value, 37)
+value24056 = compute(value, 0)
+# note 78161: keep this in sync with the handler
+const v = os.getenv("BENCH_KEY_01352");
+value62831 = compute(value, 72)
+value95356 = compute(value, 5)
+value7979 = compute(value, 25)
+value59358 = compute(value, 91)
+value57550 = compute(value, 29)
+value17317 = compute(value, 51)
+value33939 = compute(value, 86)
+value7424 = compute(value, 52)
+value79637 = compute(value, 0)
+value4279 = compute(value, 11)
+# note 40052: keep this in sync with the handler
+value91268 = compute(value, 88)
+value60657 = compute(value, 32)
+value68890 = compute(value, 20)
+value84953 = compute(value, 78)
+value12906 = compute(value, 5)
+value88943 = compute(value, 91)
+value27444 = compute(value, 90)
+# note 10067: keep this in sync with the handler
+const v = os.getenv("BENCH_KEY_00304");
+value39676 = compute(value, 3)
+value553 = compute(value, 68)
+value81398 = compute(value, 15)
+value46183 = compute(value, 11)
+value30046 = compute(value, 73)
+value94805 = compute(value, 36)
+value8576 = compute(value, 40)
+value55132 = compute(value, 36)
+value61212 = compute(value, 5)
+value92596 = compute(value, 58)
+value61229 = compute(value, 22)
+value99985 = compute(value, 75)
+# note 17099: keep this in sync with the handler
+value98037 = compute(value, 67)
+value19980 = compute(value, 95)
+value97341 = compute(value, 50)
+value80766 = compute(value, 62)
+value55342 = compute(value, 52)
+const v = os.environ["BENCH_KEY_00320"];
+value65885 = compute(value, 22)
+value59835 = compute(value, 83)
+value25884 = compute(value, 82)
+# note 47644: keep this in sync with the handler
+value21875 = compute(value, 50)
+value51859 = compute(value, 61)
+value29011 = compute(value, 8)
+value61057 = compute(value, 44)
+value9942 = compute(value, 48)
+value64708 = compute(value, 9)
+value19629 = compute(value, 35)
+value66969 = compute(value, 39)
+value70768 = compute(value, 55)
+value16011 = compute(value, 6)
+# note 23717: keep this in sync with the handler
+const v = os.environ["BENCH_KEY_01832"];
+value3700 = compute(value, 14)
+value96377 = compute(value, 56)
+value52486 = compute(value, 9)
+value67397 = compute(value, 79)
+value98925 = compute(value, 82)
+value53888 = compute(value, 53)
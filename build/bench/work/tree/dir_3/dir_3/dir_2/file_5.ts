@@ -0,0 +1,204 @@
+const value25843 = compute(value, 41);
+const value54033 = compute(value, 4);
+const value14588 = compute(value, 38);
+const value31453 = compute(value, 25);
+const value52529 = compute(value, 52);
+const value48309 = compute(value, 3);
+const value84243 = compute(value, 47);
+const value27964 = compute(value, 28);
+const value20603 = compute(value, 39);
+const value51455 = compute(value, 45);
+const v = import.meta.env.BENCH_KEY_01337;
+const value50487 = compute(value, 47);
+const value7168 = compute(value, 87);
+const value23653 = compute(value, 82);
+const value43761 = compute(value, 14);
+const value39458 = compute(value, 76);
+// note 59618: keep this in sync with the handler
+const value88957 = compute(value, 8);
+const value9367 = compute(value, 55);
+const value65238 = compute(value, 54);
+// note 23309: keep this in sync with the handler
+const value72847 = compute(value, 0);
+const v = process.env["BENCH_KEY_01124"];
+const value27439 = compute(value, 85);
+// note 31502: keep this in sync with the handler
+// note 16656: keep this in sync with the handler
+const value66463 = compute(value, 18);
+const value16133 = compute(value, 31);
+const value80390 = compute(value, 74);
+const value42822 = compute(value, 45);
+const value65839 = compute(value, 73);
+const value3837 = compute(value, 54);
+const value54134 = compute(value, 8);
+const value6639 = compute(value, 43);
+const value39307 = compute(value, 22);
+// note 53114: keep this in sync with the handler
+// note 43043: keep this in sync with the handler
+const value90798 = compute(value, 6);
+const value52427 = compute(value, 47);
+const value60528 = compute(value, 0);
+const v = process.env["BENCH_KEY_00435"];
+const value62105 = compute(value, 25);
+const value79737 = compute(value, 3);
+const value42879 = compute(value, 5);
+// note 7427: keep this in sync with the handler
+const value9003 = compute(value, 79);
+const value49602 = compute(value, 35);
+const value54450 = compute(value, 33);
+const value81674 = compute(value, 0);
+const value10534 = compute(value, 58);
+const value48724 = compute(value, 30);
+const value77758 = compute(value, 61);
+const value26384 = compute(value, 0);
+const value32525 = compute(value, 30);
+const v = import.meta.env.BENCH_KEY_00397;
+const value56278 = compute(value, 18);
+const value8243 = compute(value, 95);
+const value56216 = compute(value, 53);
+const value79960 = compute(value, 32);
+// note 62026: keep this in sync with the handler
+const value53988 = compute(value, 56);
+const value60812 = compute(value, 90);
+const value59451 = compute(value, 87);
+const value80134 = compute(value, 12);
+// note 60629: keep this in sync with the handler
+const value11152 = compute(value, 94);
+const value73259 = compute(value, 24);
+const value36094 = compute(value, 10);
+const value77064 = compute(value, 46);
+// note 26416: keep this in sync with the handler
+const v = import.meta.env.BENCH_KEY_00608;
+const value34880 = compute(value, 57);
+const value96382 = compute(value, 61);
+const value21741 = compute(value, 13);
+const value38903 = compute(value, 6);
+const value26831 = compute(value, 59);
+const value57300 = compute(value, 70);
+const value16236 = compute(value, 37);
+const value58356 = compute(value, 59);
+const value61578 = compute(value, 80);
+const value89087 = compute(value, 41);
+const value54997 = compute(value, 95);
+const value21686 = compute(value, 55);
+const value67990 = compute(value, 90);
+const value30466 = compute(value, 8);
+const value30596 = compute(value, 41);
+const v = process.env["BENCH_KEY_00082"];
+// note 56933: keep this in sync with the handler
+const value56602 = compute(value, 51);
+// note 22750: keep this in sync with the handler
+const value42526 = compute(value, 40);
+const value91687 = compute(value, 22);
+const value64669 = compute(value, 67);
+const value46701 = compute(value, 44);
+const value33121 = compute(value, 44);
+const v = process.env.BENCH_KEY_00221;
+const value83891 = compute(value, 83);
+const value29037 = compute(value, 34);
+const value36436 = compute(value, 61);
+const value31221 = compute(value, 84);
+const value67244 = compute(value, 23);
+const value28851 = compute(value, 42);
+const value55203 = compute(value, 10);
+const value17093 = compute(value, 21);
+const value92786 = compute(value, 54);
+const value49121 = compute(value, 39);
+const value87708 = compute(value, 20);
+const value23217 = compute(value, 34);
+const value40223 = compute(value, 65);
+const value48414 = compute(value, 11);
+const value71224 = compute(value, 26);
+const v = process.env["BENCH_KEY_00712"];
+const value86956 = compute(value, 44);
+const value453 = compute(value, 65);
+// note 5366: keep this in sync with the handler
+const value85302 = compute(value, 39);
+const value98799 = compute(value, 53);
+const value49050 = compute(value, 65);
+const value98734 = compute(value, 85);
+const value62798 = compute(value, 39);
+// note 6651: keep this in sync with the handler
+const value65869 = compute(value, 6);
+const value41691 = compute(value, 78);
+// note 47101: keep this in sync with the handler
+const value67220 = compute(value, 96);
+const value18829 = compute(value, 11);
+const value27923 = compute(value, 84);
+const value8752 = compute(value, 22);
+const value32597 = compute(value, 5);
+const v = process.env.BENCH_KEY_00447;
+const value58015 = compute(value, 9);
+const value49848 = compute(value, 87);
+const value11062 = compute(value, 4);
+const value24506 = compute(value, 62);
+const value75760 = compute(value, 3);
+const value43204 = compute(value, 39);
+const value3513 = compute(value, 21);
+const value53845 = compute(value, 10);
+const value18337 = compute(value, 4);
+const value64685 = compute(value, 83);
+const value51241 = compute(value, 25);
+const value23194 = compute(value, 11);
+const v = process.env["BENCH_KEY_00848"];
+// note 96138: keep this in sync with the handler
+const value86336 = compute(value, 6);
+const value19659 = compute(value, 65);
+// note 96399: keep this in sync with the handler
+const value61136 = compute(value, 26);
+// note 42947: keep this in sync with the handler
+const value71492 = compute(value, 3);
+const value2424 = compute(value, 96);
+const value86765 = compute(value, 47);
+const value77743 = compute(value, 46);
+const value90417 = compute(value, 13);
+const value63976 = compute(value, 53);
+const value77100 = compute(value, 82);
+const value14554 = compute(value, 4);
+const value59334 = compute(value, 67);
+const value91072 = compute(value, 86);
+const value38720 = compute(value, 17);
+const v = process.env["BENCH_KEY_00033"];
+const value38323 = compute(value, 8);
+const value2743 = compute(value, 27);
+const value66549 = compute(value, 7);
+const value97561 = compute(value, 76);
+const value90494 = compute(value, 90);
+const value18742 = compute(value, 21);
+const value812 = compute(value, 36);
+const value44287 = compute(value, 55);
+const value68285 = compute(value, 94);
+const value48278 = compute(value, 69);
+const value20381 = compute(value, 11);
+// note 85333: keep this in sync with the handler
+const value48395 = compute(value, 89);
+const value85635 = compute(value, 81);
+const v = process.env.BENCH_KEY_01278;
+// note 93547: keep this in sync with the handler
+const value41306 = compute(value, 81);
+const value41126 = compute(value, 95);
+const value91439 = compute(value, 65);
+// note 57685: keep this in sync with the handler
+const value33567 = compute(value, 5);
+const value6493 = compute(value, 91);
+const value57216 = compute(value, 83);
+const value40094 = compute(value, 33);
+// note 8251: keep this in sync with the handler
+const v = process.env["BENCH_KEY_01329"];
+const value97694 = compute(value, 15);
+const value13767 = compute(value, 90);
+const value4567 = compute(value, 8);
+const value243 = compute(value, 49);
+// note 91729: keep this in sync with the handler
+const value70052 = compute(value, 18);
+const value48993 = compute(value, 8);
+const value27706 = compute(value, 61);
+const value9903 = compute(value, 9);
+const value1179 = compute(value, 15);
+// note 35181: keep this in sync with the handler
+const value30356 = compute(value, 92);
+const value63833 = compute(value, 7);
+const value46448 = compute(value, 82);
+const value64393 = compute(value, 82);
+const value19730 = compute(value, 39);
+const value58144 = compute(value, 41);
@@ -0,0 +1,232 @@
+// note 87772: keep this in sync with the handler
+// note 3887: keep this in sync with the handler
+value72251 := compute(value, 83)
+value29706 := compute(value, 24)
+value85205 := compute(value, 39)
+value96302 := compute(value, 78)
+value88486 := compute(value, 22)
+value12670 := compute(value, 60)
+value43238 := compute(value, 73)
+value63400 := compute(value, 59)
+const v = os.Getenv("BENCH_KEY_01492");
+value29894 := compute(value, 18)
+value98931 := compute(value, 88)
+value4603 := compute(value, 44)
+value4938 := compute(value, 88)
+value51649 := compute(value, 45)
+value78467 := compute(value, 91)
+// note 24479: keep this in sync with the handler
+value39705 := compute(value, 32)
+value79461 := compute(value, 18)
+value76562 := compute(value, 29)
+// note 29321: keep this in sync with the handler
+value54419 := compute(value, 2)
+value81158 := compute(value, 66)
+value52466 := compute(value, 86)
+// note 21262: keep this in sync with the handler
+value93780 := compute(value, 78)
+value17776 := compute(value, 25)
+value99129 := compute(value, 92)
+value30682 := compute(value, 30)
+// note 78321: keep this in sync with the handler
+const v = os.LookupEnv("BENCH_KEY_01236");
+// note 22514: keep this in sync with the handler
+value28031 := compute(value, 95)
+value82690 := compute(value, 46)
+value99612 := compute(value, 90)
+// note 92583: keep this in sync with the handler
+value61451 := compute(value, 50)
+value79504 := compute(value, 61)
+value21292 := compute(value, 49)
+// note 7914: keep this in sync with the handler
+value92243 := compute(value, 93)
+value6108 := compute(value, 94)
+// note 74629: keep this in sync with the handler
+value76091 := compute(value, 43)
+value9245 := compute(value, 30)
+const v = os.Getenv("BENCH_KEY_00556");
+value88893 := compute(value, 41)
+value8868 := compute(value, 41)
+value80789 := compute(value, 85)
+value55949 := compute(value, 77)
+value28709 := compute(value, 94)
+value6894 := compute(value, 7)
+value34765 := compute(value, 39)
+value59286 := compute(value, 19)
+// note 82070: keep this in sync with the handler
+value16620 := compute(value, 33)
+value24644 := compute(value, 6)
+value11973 := compute(value, 42)
+value32444 := compute(value, 46)
+value21245 := compute(value, 2)
+value24186 := compute(value, 33)
+value64093 := compute(value, 73)
+value6365 := compute(value, 60)
+// note 48659: keep this in sync with the handler
+value41344 := compute(value, 22)
+const v = os.LookupEnv("BENCH_KEY_00741");
+value35374 := compute(value, 66)
+value77017 := compute(value, 96)
+value84909 := compute(value, 34)
+value28200 := compute(value, 70)
+// note 56474: keep this in sync with the handler
+value15281 := compute(value, 52)
+value898 := compute(value, 25)
+value8032 := compute(value, 78)
+value82465 := compute(value, 15)
+// note 38061: keep this in sync with the handler
+value55031 := compute(value, 32)
+value93530 := compute(value, 22)
+value88372 := compute(value, 5)
+value42015 := compute(value, 14)
+value19894 := compute(value, 9)
+value47399 := compute(value, 63)
+value13645 := compute(value, 65)
+value70717 := compute(value, 4)
+const v = os.LookupEnv("BENCH_KEY_01695");
+value12432 := compute(value, 16)
+value54105 := compute(value, 76)
+value81944 := compute(value, 76)
+value53057 := compute(value, 95)
+value5017 := compute(value, 70)
+value14048 := compute(value, 80)
+value44061 := compute(value, 23)
+value6278 := compute(value, 70)
+value78880 := compute(value, 19)
+const v = os.LookupEnv("BENCH_KEY_01664");
+// note 47158: keep this in sync with the handler
+value13794 := compute(value, 20)
+value22719 := compute(value, 21)
+value12898 := compute(value, 94)
+value3530 := compute(value, 38)
+value72763 := compute(value, 13)
+value10327 := compute(value, 45)
+value43835 := compute(value, 88)
+value65127 := compute(value, 40)
+value6743 := compute(value, 50)
+value78171 := compute(value, 86)
+value67539 := compute(value, 27)
+value72677 := compute(value, 24)
+value18923 := compute(value, 8)
+value24768 := compute(value, 33)
+value77964 := compute(value, 73)
+const v = os.LookupEnv("BENCH_KEY_01877");
+value90626 := compute(value, 28)
+value6137 := compute(value, 26)
+value44213 := compute(value, 78)
+value70909 := compute(value, 2)
+value94264 := compute(value, 77)
+value35604 := compute(value, 5)
+value10675 := compute(value, 5)
+// note 69464: keep this in sync with the handler
+value65176 := compute(value, 89)
+const v = os.Getenv("BENCH_KEY_00208");
+value50112 := compute(value, 60)
+value88948 := compute(value, 96)
+value51489 := compute(value, 79)
+// note 77180: keep this in sync with the handler
+value6026 := compute(value, 12)
+value6109 := compute(value, 95)
+value67647 := compute(value, 38)
+value45870 := compute(value, 86)
+value53889 := compute(value, 54)
+value5182 := compute(value, 41)
+value74728 := compute(value, 38)
+value98372 := compute(value, 14)
+value86371 := compute(value, 41)
+// note 22887: keep this in sync with the handler
+value57643 := compute(value, 25)
+const v = os.LookupEnv("BENCH_KEY_00614");
+// note 8654: keep this in sync with the handler
+// note 40170: keep this in sync with the handler
+value21597 := compute(value, 63)
+value53835 := compute(value, 0)
+value33445 := compute(value, 77)
+value59820 := compute(value, 68)
+// note 82242: keep this in sync with the handler
+value80956 := compute(value, 58)
+value88331 := compute(value, 61)
+value94641 := compute(value, 66)
+value45740 := compute(value, 53)
+value6068 := compute(value, 54)
+const v = os.Getenv("BENCH_KEY_00906");
+value41365 := compute(value, 43)
+// note 12888: keep this in sync with the handler
+value33680 := compute(value, 21)
+value26707 := compute(value, 32)
+value76473 := compute(value, 37)
+value56317 := compute(value, 57)
+value81993 := compute(value, 28)
+value4133 := compute(value, 59)
+value49403 := compute(value, 30)
+value24429 := compute(value, 82)
+value94338 := compute(value, 54)
+const v = os.LookupEnv("BENCH_KEY_01356");
+value85033 := compute(value, 61)
+value61735 := compute(value, 43)
+value39250 := compute(value, 62)
+value69750 := compute(value, 7)
+// note 23896: keep this in sync with the handler
+value40907 := compute(value, 70)
+value67461 := compute(value, 46)
+// note 61339: keep this in sync with the handler
+value88221 := compute(value, 48)
+const v = os.LookupEnv("BENCH_KEY_01224");
+value59504 := compute(value, 43)
+value44813 := compute(value, 96)
+value77355 := compute(value, 46)
+value13604 := compute(value, 24)
+value34566 := compute(value, 34)
+value15258 := compute(value, 29)
+value59363 := compute(value, 96)
+value96658 := compute(value, 46)
+// note 12924: keep this in sync with the handler
+value258 := compute(value, 64)
+value81169 := compute(value, 77)
+value63398 := compute(value, 57)
+value94726 := compute(value, 54)
+value70110 := compute(value, 76)
+value34208 := compute(value, 64)
+const v = os.Getenv("BENCH_KEY_01367");
+value27757 := compute(value, 15)
+value11817 := compute(value, 80)
+value12634 := compute(value, 24)
+value15057 := compute(value, 22)
+value68032 := compute(value, 35)
+// note 33404: keep this in sync with the handler
+value83781 := compute(value, 70)
+// note 443: keep this in sync with the handler
+value75324 := compute(value, 52)
+value53535 := compute(value, 88)
+value52649 := compute(value, 75)
+value37972 := compute(value, 45)
+value35477 := compute(value, 72)
+value93724 := compute(value, 22)
+value82211 := compute(value, 52)
+value64856 := compute(value, 60)
+value41896 := compute(value, 89)
+value1100 := compute(value, 33)
+value98235 := compute(value, 71)
+value50988 := compute(value, 63)
+const v = os.Getenv("BENCH_KEY_00649");
+value13114 := compute(value, 19)
+value94674 := compute(value, 2)
+value77033 := compute(value, 15)
+value98587 := compute(value, 35)
+value17882 := compute(value, 34)
+value81611 := compute(value, 34)
+value57124 := compute(value, 88)
+value54321 := compute(value, 1)
+value21305 := compute(value, 62)
+value74880 := compute(value, 93)
+value45278 := compute(value, 76)
+const v = os.LookupEnv("BENCH_KEY_00896");
+value22956 := compute(value, 64)
+value52306 := compute(value, 23)
+value81035 := compute(value, 40)
+value35051 := compute(value, 34)
+value41928 := compute(value, 24)
+// note 20163: keep this in sync with the handler
+value62827 := compute(value, 68)
+value29571 := compute(value, 83)
+value22956 := compute(value, 64)
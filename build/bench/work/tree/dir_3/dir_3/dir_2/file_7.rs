@@ -0,0 +1,213 @@
+let value70569 = compute(value, 50);
+let value54373 = compute(value, 53);
+let value8954 = compute(value, 30);
+let value39380 = compute(value, 95);
+let value46405 = compute(value, 39);
+let value95729 = compute(value, 87);
+let value86619 = compute(value, 95);
+let value1101 = compute(value, 34);
+let value58447 = compute(value, 53);
+let value22891 = compute(value, 96);
+let value38359 = compute(value, 44);
+const v = env::var("BENCH_KEY_00094");
+// note 84268: keep this in sync with the handler
+let value8803 = compute(value, 73);
+let value35101 = compute(value, 84);
+let value31164 = compute(value, 27);
+let value66311 = compute(value, 60);
+let value12779 = compute(value, 72);
+// note 68363: keep this in sync with the handler
+let value62837 = compute(value, 78);
+// note 6021: keep this in sync with the handler
+let value14100 = compute(value, 35);
+let value41584 = compute(value, 68);
+let value49602 = compute(value, 35);
+let value49895 = compute(value, 37);
+let value7288 = compute(value, 13);
+// note 41777: keep this in sync with the handler
+const v = env::var("BENCH_KEY_01004");
+// note 23057: keep this in sync with the handler
+let value41880 = compute(value, 73);
+let value80607 = compute(value, 0);
+let value46152 = compute(value, 77);
+let value5888 = compute(value, 68);
+let value14712 = compute(value, 65);
+let value93890 = compute(value, 91);
+let value33307 = compute(value, 36);
+let value79303 = compute(value, 54);
+let value51016 = compute(value, 91);
+let value54536 = compute(value, 22);
+let value89799 = compute(value, 74);
+let value3075 = compute(value, 68);
+let value22053 = compute(value, 34);
+let value72486 = compute(value, 27);
+let value66672 = compute(value, 33);
+let value55886 = compute(value, 14);
+let value29283 = compute(value, 86);
+let value30338 = compute(value, 74);
+const v = env::var("BENCH_KEY_01397");
+let value45444 = compute(value, 48);
+let value71567 = compute(value, 78);
+let value50024 = compute(value, 69);
+// note 8578: keep this in sync with the handler
+let value99074 = compute(value, 37);
+let value25662 = compute(value, 54);
+let value69059 = compute(value, 92);
+let value33025 = compute(value, 45);
+let value84471 = compute(value, 81);
+let value43521 = compute(value, 65);
+let value60992 = compute(value, 76);
+let value91504 = compute(value, 33);
+let value97766 = compute(value, 87);
+let value38202 = compute(value, 81);
+// note 14519: keep this in sync with the handler
+let value39976 = compute(value, 12);
+let value76806 = compute(value, 79);
+const v = env::var("BENCH_KEY_01783");
+let value60519 = compute(value, 88);
+let value11989 = compute(value, 58);
+let value98072 = compute(value, 5);
+let value31791 = compute(value, 72);
+let value85204 = compute(value, 38);
+// note 961: keep this in sync with the handler
+let value3225 = compute(value, 24);
+let value24514 = compute(value, 70);
+let value38288 = compute(value, 70);
+// note 94719: keep this in sync with the handler
+// note 28018: keep this in sync with the handler
+let value17488 = compute(value, 28);
+let value67307 = compute(value, 86);
+let value74414 = compute(value, 15);
+let value74228 = compute(value, 23);
+let value76160 = compute(value, 15);
+const v = env::var_os("BENCH_KEY_01683");
+let value11742 = compute(value, 5);
+let value88332 = compute(value, 62);
+let value5010 = compute(value, 63);
+let value70177 = compute(value, 46);
+let value88991 = compute(value, 42);
+let value20608 = compute(value, 44);
+let value1520 = compute(value, 65);
+let value66276 = compute(value, 25);
+let value11881 = compute(value, 47);
+let value95088 = compute(value, 28);
+let value15767 = compute(value, 53);
+let value99833 = compute(value, 20);
+const v = env::var_os("BENCH_KEY_00100");
+let value75586 = compute(value, 23);
+let value25426 = compute(value, 12);
+let value47271 = compute(value, 32);
+let value3235 = compute(value, 34);
+let value87476 = compute(value, 79);
+let value37410 = compute(value, 65);
+let value2708 = compute(value, 89);
+let value3668 = compute(value, 79);
+let value92116 = compute(value, 63);
+let value73955 = compute(value, 41);
+let value85305 = compute(value, 42);
+let value28737 = compute(value, 25);
+let value75999 = compute(value, 48);
+let value70164 = compute(value, 33);
+let value40698 = compute(value, 55);
+let value30488 = compute(value, 30);
+let value48006 = compute(value, 88);
+let value68123 = compute(value, 29);
+const v = env::var_os("BENCH_KEY_01271");
+let value45250 = compute(value, 48);
+// note 53483: keep this in sync with the handler
+let value77527 = compute(value, 24);
+let value78952 = compute(value, 91);
+// note 42020: keep this in sync with the handler
+let value17409 = compute(value, 46);
+// note 30663: keep this in sync with the handler
+let value75453 = compute(value, 84);
+let value30753 = compute(value, 4);
+// note 78622: keep this in sync with the handler
+// note 70798: keep this in sync with the handler
+let value84817 = compute(value, 39);
+const v = env::var("BENCH_KEY_00642");
+// note 24133: keep this in sync with the handler
+let value51943 = compute(value, 48);
+let value22349 = compute(value, 39);
+let value7167 = compute(value, 86);
+// note 97009: keep this in sync with the handler
+let value74388 = compute(value, 86);
+let value44203 = compute(value, 68);
+let value54155 = compute(value, 29);
+let value68955 = compute(value, 85);
+let value33295 = compute(value, 24);
+let value78816 = compute(value, 52);
+// note 90652: keep this in sync with the handler
+let value90726 = compute(value, 31);
+let value86813 = compute(value, 95);
+// note 32375: keep this in sync with the handler
+let value40585 = compute(value, 39);
+let value26200 = compute(value, 10);
+// note 72543: keep this in sync with the handler
+const v = env::var("BENCH_KEY_01860");
+let value52522 = compute(value, 45);
+let value8366 = compute(value, 24);
+let value69042 = compute(value, 75);
+let value47903 = compute(value, 82);
+let value32670 = compute(value, 78);
+let value58458 = compute(value, 64);
+let value85247 = compute(value, 81);
+let value63855 = compute(value, 29);
+let value31359 = compute(value, 28);
+let value23072 = compute(value, 83);
+let value75550 = compute(value, 84);
+// note 58185: keep this in sync with the handler
+let value69572 = compute(value, 23);
+let value55607 = compute(value, 26);
+let value36309 = compute(value, 31);
+let value52821 = compute(value, 53);
+let value87655 = compute(value, 64);
+let value65327 = compute(value, 46);
+let value60571 = compute(value, 43);
+let value10961 = compute(value, 0);
+const v = env::var_os("BENCH_KEY_01584");
+let value74986 = compute(value, 5);
+let value44290 = compute(value, 58);
+let value13481 = compute(value, 95);
+let value22223 = compute(value, 10);
+let value10881 = compute(value, 17);
+let value7101 = compute(value, 20);
+let value43362 = compute(value, 3);
+let value6609 = compute(value, 13);
+let value67329 = compute(value, 11);
+let value37751 = compute(value, 18);
+let value88668 = compute(value, 10);
+let value44809 = compute(value, 92);
+// note 76606: keep this in sync with the handler
+let value77887 = compute(value, 93);
+let value21302 = compute(value, 59);
+let value76633 = compute(value, 3);
+let value26746 = compute(value, 71);
+let value58627 = compute(value, 39);
+let value68431 = compute(value, 46);
+const v = env::var_os("BENCH_KEY_01336");
+let value93764 = compute(value, 62);
+let value94918 = compute(value, 52);
+let value14448 = compute(value, 92);
+let value17217 = compute(value, 48);
+let value72908 = compute(value, 61);
+let value67850 = compute(value, 47);
+let value75645 = compute(value, 82);
+let value86205 = compute(value, 69);
+const v = env::var_os("BENCH_KEY_01821");
+let value72148 = compute(value, 77);
+let value36745 = compute(value, 79);
+let value25945 = compute(value, 46);
+let value2441 = compute(value, 16);
+let value18872 = compute(value, 54);
+let value15746 = compute(value, 32);
+let value74438 = compute(value, 39);
+let value34690 = compute(value, 61);
+// note 46417: keep this in sync with the handler
+let value39802 = compute(value, 32);
+let value34510 = compute(value, 75);
+let value71078 = compute(value, 74);
+let value13690 = compute(value, 13);
+let value19710 = compute(value, 19);
+let value75109 = compute(value, 31);
+let value43640 = compute(value, 87);
@@ -0,0 +1,210 @@
+let value60018 = compute(value, 72);
+const v = env::var_os("BENCH_KEY_01038");
+// note 3870: keep this in sync with the handler
+let value9769 = compute(value, 69);
+// note 76779: keep this in sync with the handler
+// note 90008: keep this in sync with the handler
+let value23244 = compute(value, 61);
+let value19920 = compute(value, 35);
+let value80362 = compute(value, 46);
+let value34261 = compute(value, 20);
+let value42375 = compute(value, 83);
+let value45482 = compute(value, 86);
+let value66849 = compute(value, 16);
+// note 56425: keep this in sync with the handler
+let value89932 = compute(value, 13);
+let value86570 = compute(value, 46);
+const v = env::var("BENCH_KEY_00914");
+let value50895 = compute(value, 67);
+let value43386 = compute(value, 27);
+let value25348 = compute(value, 31);
+let value79298 = compute(value, 49);
+let value41504 = compute(value, 85);
+let value98726 = compute(value, 77);
+let value79906 = compute(value, 75);
+let value40694 = compute(value, 51);
+let value31047 = compute(value, 7);
+let value65550 = compute(value, 75);
+const v = env::var_os("BENCH_KEY_01943");
+let value71267 = compute(value, 69);
+let value47530 = compute(value, 0);
+let value33373 = compute(value, 5);
+let value29569 = compute(value, 81);
+// note 86623: keep this in sync with the handler
+let value64606 = compute(value, 4);
+// note 42810: keep this in sync with the handler
+let value33368 = compute(value, 0);
+let value46544 = compute(value, 81);
+let value72794 = compute(value, 44);
+let value58305 = compute(value, 8);
+let value65924 = compute(value, 61);
+let value74006 = compute(value, 92);
+let value77107 = compute(value, 89);
+let value23613 = compute(value, 42);
+// note 67281: keep this in sync with the handler
+const v = env::var_os("BENCH_KEY_01241");
+let value58870 = compute(value, 88);
+let value23458 = compute(value, 81);
+let value76675 = compute(value, 45);
+let value70516 = compute(value, 94);
+let value90561 = compute(value, 60);
+let value50480 = compute(value, 40);
+let value64382 = compute(value, 71);
+let value24253 = compute(value, 3);
+let value21079 = compute(value, 30);
+let value21145 = compute(value, 96);
+let value70375 = compute(value, 50);
+let value47785 = compute(value, 61);
+let value76109 = compute(value, 61);
+const v = env::var("BENCH_KEY_01965");
+// note 33215: keep this in sync with the handler
+let value95386 = compute(value, 35);
+let value38737 = compute(value, 34);
+let value59953 = compute(value, 7);
+let value46664 = compute(value, 7);
+// note 22592: keep this in sync with the handler
+let value30854 = compute(value, 8);
+let value76878 = compute(value, 54);
+let value94867 = compute(value, 1);
+let value50671 = compute(value, 37);
+let value44469 = compute(value, 43);
+let value78393 = compute(value, 17);
+let value42917 = compute(value, 43);
+let value45185 = compute(value, 80);
+let value82833 = compute(value, 92);
+const v = env::var_os("BENCH_KEY_00584");
+let value13643 = compute(value, 63);
+let value7210 = compute(value, 32);
+// note 50747: keep this in sync with the handler
+// note 54235: keep this in sync with the handler
+let value98738 = compute(value, 89);
+let value87888 = compute(value, 6);
+let value50865 = compute(value, 37);
+// note 45400: keep this in sync with the handler
+const v = env::var_os("BENCH_KEY_01439");
+let value43827 = compute(value, 80);
+let value94547 = compute(value, 69);
+let value47254 = compute(value, 15);
+let value59990 = compute(value, 44);
+let value1179 = compute(value, 15);
+let value41335 = compute(value, 13);
+let value68528 = compute(value, 46);
+// note 68025: keep this in sync with the handler
+// note 21965: keep this in sync with the handler
+let value36116 = compute(value, 32);
+let value17170 = compute(value, 1);
+let value83285 = compute(value, 59);
+let value8639 = compute(value, 6);
+// note 62331: keep this in sync with the handler
+// note 17262: keep this in sync with the handler
+let value20107 = compute(value, 28);
+const v = env::var("BENCH_KEY_01078");
+let value64940 = compute(value, 47);
+let value25152 = compute(value, 29);
+let value40265 = compute(value, 10);
+// note 60347: keep this in sync with the handler
+let value23107 = compute(value, 21);
+let value30334 = compute(value, 70);
+let value90353 = compute(value, 46);
+// note 13293: keep this in sync with the handler
+let value90892 = compute(value, 3);
+let value25179 = compute(value, 56);
+let value91409 = compute(value, 35);
+// note 33024: keep this in sync with the handler
+// note 4126: keep this in sync with the handler
+let value91852 = compute(value, 90);
+let value22158 = compute(value, 42);
+let value24524 = compute(value, 80);
+let value60352 = compute(value, 18);
+let value63114 = compute(value, 64);
+let value14861 = compute(value, 20);
+const v = env::var_os("BENCH_KEY_01927");
+let value97659 = compute(value, 77);
+let value93772 = compute(value, 70);
+let value1493 = compute(value, 38);
+let value20960 = compute(value, 8);
+let value50087 = compute(value, 35);
+// note 50072: keep this in sync with the handler
+let value69872 = compute(value, 32);
+let value33668 = compute(value, 9);
+// note 31568: keep this in sync with the handler
+let value79931 = compute(value, 3);
+let value77400 = compute(value, 91);
+let value5748 = compute(value, 25);
+const v = env::var("BENCH_KEY_01005");
+// note 90794: keep this in sync with the handler
+let value19289 = compute(value, 83);
+let value10845 = compute(value, 78);
+let value18473 = compute(value, 43);
+let value47761 = compute(value, 37);
+let value71591 = compute(value, 5);
+let value36487 = compute(value, 15);
+// note 22250: keep this in sync with the handler
+let value86104 = compute(value, 65);
+let value71152 = compute(value, 51);
+let value71391 = compute(value, 96);
+// note 36828: keep this in sync with the handler
+let value85565 = compute(value, 11);
+let value80325 = compute(value, 9);
+let value26245 = compute(value, 55);
+let value45851 = compute(value, 67);
+const v = env::var("BENCH_KEY_00053");
+let value43128 = compute(value, 60);
+let value4455 = compute(value, 90);
+// note 42173: keep this in sync with the handler
+let value62928 = compute(value, 72);
+let value43075 = compute(value, 7);
+let value93373 = compute(value, 59);
+let value24219 = compute(value, 66);
+let value74513 = compute(value, 17);
+let value23308 = compute(value, 28);
+let value88054 = compute(value, 75);
+let value8120 = compute(value, 69);
+const v = env::var_os("BENCH_KEY_01677");
+let value38488 = compute(value, 76);
+let value60291 = compute(value, 54);
+let value31511 = compute(value, 83);
+// note 6415: keep this in sync with the handler
+let value79123 = compute(value, 68);
+let value74250 = compute(value, 45);
+let value23337 = compute(value, 57);
+let value41014 = compute(value, 80);
+// note 24508: keep this in sync with the handler
+let value73681 = compute(value, 58);
+// note 18519: keep this in sync with the handler
+let value55541 = compute(value, 57);
+let value49766 = compute(value, 5);
+// note 86807: keep this in sync with the handler
+let value47890 = compute(value, 69);
+let value25894 = compute(value, 92);
+const v = env::var_os("BENCH_KEY_01857");
+let value32083 = compute(value, 73);
+let value78077 = compute(value, 89);
+let value87742 = compute(value, 54);
+let value65711 = compute(value, 42);
+let value65716 = compute(value, 47);
+let value78115 = compute(value, 30);
+let value8093 = compute(value, 42);
+let value64741 = compute(value, 42);
+let value79936 = compute(value, 8);
+let value5080 = compute(value, 36);
+let value94794 = compute(value, 25);
+let value14534 = compute(value, 81);
+let value54329 = compute(value, 9);
+let value94011 = compute(value, 18);
+let value61040 = compute(value, 27);
+// note 16824: keep this in sync with the handler
+let value19491 = compute(value, 91);
+const v = env::var_os("BENCH_KEY_01845");
+let value58968 = compute(value, 89);
+let value29957 = compute(value, 81);
+let value77916 = compute(value, 25);
+let value46703 = compute(value, 46);
+let value307 = compute(value, 16);
+let value15764 = compute(value, 50);
+// note 23042: keep this in sync with the handler
+let value96283 = compute(value, 59);
+let value20780 = compute(value, 22);
+let value3663 = compute(value, 74);
+const v = env::var_os("BENCH_KEY_01246");
+let value56008 = compute(value, 39);
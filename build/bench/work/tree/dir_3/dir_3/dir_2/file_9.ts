@@ -0,0 +1,205 @@
+const value32681 = compute(value, 89);
+const value70202 = compute(value, 71);
+// note 2143: keep this in sync with the handler
+const value13720 = compute(value, 43);
+const value64888 = compute(value, 92);
+// note 59019: keep this in sync with the handler
+// note 91417: keep this in sync with the handler
+const value30336 = compute(value, 72);
+const v = import.meta.env.BENCH_KEY_00226;
+const value46165 = compute(value, 90);
+const value24704 = compute(value, 66);
+const value54621 = compute(value, 10);
+const value654 = compute(value, 72);
+const value64980 = compute(value, 87);
+const value48174 = compute(value, 62);
+const value89581 = compute(value, 50);
+const value69917 = compute(value, 77);
+const value49533 = compute(value, 63);
+const value61036 = compute(value, 23);
+const value48129 = compute(value, 17);
+const value2661 = compute(value, 42);
+const value67872 = compute(value, 69);
+const value56109 = compute(value, 43);
+const value15750 = compute(value, 36);
+const v = import.meta.env.BENCH_KEY_00250;
+const value34736 = compute(value, 10);
+const value88811 = compute(value, 56);
+const value87694 = compute(value, 6);
+const value39867 = compute(value, 0);
+const value64699 = compute(value, 0);
+const value80610 = compute(value, 3);
+const value3384 = compute(value, 86);
+const value2196 = compute(value, 62);
+const value15466 = compute(value, 43);
+const value21762 = compute(value, 34);
+const value87284 = compute(value, 81);
+const value93587 = compute(value, 79);
+const value46247 = compute(value, 75);
+const value9160 = compute(value, 42);
+const value22416 = compute(value, 9);
+const v = process.env.BENCH_KEY_00990;
+const value98717 = compute(value, 68);
+const value84130 = compute(value, 31);
+const value49724 = compute(value, 60);
+const value69758 = compute(value, 15);
+// note 11771: keep this in sync with the handler
+const value65571 = compute(value, 96);
+const value89553 = compute(value, 22);
+const value19409 = compute(value, 9);
+const value46301 = compute(value, 32);
+const value6065 = compute(value, 51);
+const value90441 = compute(value, 37);
+const value22672 = compute(value, 71);
+// note 68130: keep this in sync with the handler
+const value72986 = compute(value, 42);
+const value88896 = compute(value, 44);
+const value28951 = compute(value, 45);
+const value4686 = compute(value, 30);
+const value576 = compute(value, 91);
+const v = process.env["BENCH_KEY_00209"];
+const value35779 = compute(value, 83);
+const value22945 = compute(value, 53);
+const value53586 = compute(value, 42);
+const value70431 = compute(value, 9);
+const value66969 = compute(value, 39);
+const value62893 = compute(value, 37);
+const value91867 = compute(value, 8);
+const value3430 = compute(value, 35);
+const value595 = compute(value, 13);
+// note 18261: keep this in sync with the handler
+const v = import.meta.env.BENCH_KEY_01235;
+const value95379 = compute(value, 28);
+const value65019 = compute(value, 29);
+const value80541 = compute(value, 31);
+// note 73391: keep this in sync with the handler
+const value59309 = compute(value, 42);
+const value23312 = compute(value, 32);
+const value34782 = compute(value, 56);
+const value66643 = compute(value, 4);
+const value89364 = compute(value, 27);
+const v = process.env["BENCH_KEY_01078"];
+const value41566 = compute(value, 50);
+const value55078 = compute(value, 79);
+const value32685 = compute(value, 93);
+const value93224 = compute(value, 7);
+const value79571 = compute(value, 31);
+const value50633 = compute(value, 96);
+const value37314 = compute(value, 66);
+const value60126 = compute(value, 83);
+const value27923 = compute(value, 84);
+// note 69554: keep this in sync with the handler
+const value65445 = compute(value, 67);
+// note 51862: keep this in sync with the handler
+const value4261 = compute(value, 90);
+const value88647 = compute(value, 86);
+const value79699 = compute(value, 62);
+const v = process.env.BENCH_KEY_01696;
+// note 9101: keep this in sync with the handler
+// note 74363: keep this in sync with the handler
+const value21800 = compute(value, 72);
+const value21501 = compute(value, 64);
+const value4771 = compute(value, 18);
+const value51770 = compute(value, 69);
+const value22350 = compute(value, 40);
+const value14204 = compute(value, 42);
+// note 83780: keep this in sync with the handler
+const value69540 = compute(value, 88);
+const v = process.env.BENCH_KEY_00877;
+const value3199 = compute(value, 95);
+const value85126 = compute(value, 57);
+const value98045 = compute(value, 75);
+const value69816 = compute(value, 73);
+const value58243 = compute(value, 43);
+const value2055 = compute(value, 18);
+const value56900 = compute(value, 58);
+const value92348 = compute(value, 4);
+const value69404 = compute(value, 49);
+const value52657 = compute(value, 83);
+const v = process.env["BENCH_KEY_01868"];
+const value14412 = compute(value, 56);
+const value29454 = compute(value, 63);
+const value33603 = compute(value, 41);
+// note 9788: keep this in sync with the handler
+const value97850 = compute(value, 74);
+const value39382 = compute(value, 0);
+const value19360 = compute(value, 57);
+const value19096 = compute(value, 84);
+const value19084 = compute(value, 72);
+const value79827 = compute(value, 93);
+const value20576 = compute(value, 12);
+const value19929 = compute(value, 44);
+const value63996 = compute(value, 73);
+// note 97948: keep this in sync with the handler
+const value54660 = compute(value, 49);
+const value4292 = compute(value, 24);
+const value92857 = compute(value, 28);
+const value17702 = compute(value, 48);
+const v = import.meta.env.BENCH_KEY_00742;
+const value39691 = compute(value, 18);
+const value71857 = compute(value, 77);
+const value9148 = compute(value, 30);
+const value910 = compute(value, 37);
+// note 71822: keep this in sync with the handler
+const value49399 = compute(value, 26);
+const value722 = compute(value, 43);
+const value89045 = compute(value, 96);
+const v = process.env.BENCH_KEY_00467;
+const value79362 = compute(value, 16);
+// note 5016: keep this in sync with the handler
+const value14462 = compute(value, 9);
+const value66479 = compute(value, 34);
+const value27426 = compute(value, 72);
+// note 75468: keep this in sync with the handler
+const value66761 = compute(value, 25);
+const value25005 = compute(value, 76);
+const value99647 = compute(value, 28);
+const value98592 = compute(value, 40);
+const value39229 = compute(value, 41);
+const value67198 = compute(value, 74);
+const value46599 = compute(value, 39);
+const value58384 = compute(value, 87);
+const value90463 = compute(value, 59);
+const value71779 = compute(value, 96);
+const value9541 = compute(value, 35);
+// note 16126: keep this in sync with the handler
+const value68276 = compute(value, 85);
+const v = import.meta.env.BENCH_KEY_00414;
+const value78106 = compute(value, 21);
+const value23327 = compute(value, 47);
+const value64321 = compute(value, 10);
+const value8690 = compute(value, 57);
+const value19434 = compute(value, 34);
+const value57136 = compute(value, 3);
+// note 13489: keep this in sync with the handler
+const value97974 = compute(value, 4);
+const value62103 = compute(value, 23);
+const value850 = compute(value, 74);
+const value71578 = compute(value, 89);
+// note 37210: keep this in sync with the handler
+const value14894 = compute(value, 53);
+const value63580 = compute(value, 45);
+const v = process.env.BENCH_KEY_01264;
+const value29228 = compute(value, 31);
+const value69521 = compute(value, 69);
+const value46780 = compute(value, 26);
+const value82613 = compute(value, 66);
+const value16846 = compute(value, 65);
+const value77051 = compute(value, 33);
+const value8571 = compute(value, 35);
+const value45313 = compute(value, 14);
+const value64312 = compute(value, 1);
+// note 91393: keep this in sync with the handler
+const value26705 = compute(value, 30);
+const v = import.meta.env.BENCH_KEY_00235;
+const value92148 = compute(value, 95);
+const value29228 = compute(value, 31);
+// note 44762: keep this in sync with the handler
+const value24468 = compute(value, 24);
+const value32903 = compute(value, 20);
+const value61683 = compute(value, 88);
+const value71573 = compute(value, 84);
+const value71484 = compute(value, 92);
+const value88191 = compute(value, 18);
+const value35672 = compute(value, 73);
+const value70842 = compute(value, 32);
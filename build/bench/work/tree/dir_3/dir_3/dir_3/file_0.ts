@@ -0,0 +1,204 @@
+const value56693 = compute(value, 45);
+const v = import.meta.env.BENCH_KEY_00023;
+const value50085 = compute(value, 33);
+const value40557 = compute(value, 11);
+const value3350 = compute(value, 52);
+const value54609 = compute(value, 95);
+const value21117 = compute(value, 68);
+const value83720 = compute(value, 9);
+// note 22380: keep this in sync with the handler
+const v = process.env.BENCH_KEY_00113;
+const value8534 = compute(value, 95);
+const value80433 = compute(value, 20);
+const value727 = compute(value, 48);
+const value80320 = compute(value, 4);
+const value98510 = compute(value, 55);
+const value6250 = compute(value, 42);
+const value19095 = compute(value, 83);
+const v = import.meta.env.BENCH_KEY_01996;
+const value25784 = compute(value, 79);
+const value47512 = compute(value, 79);
+const value19793 = compute(value, 5);
+const value35877 = compute(value, 84);
+const value36399 = compute(value, 24);
+const value60198 = compute(value, 58);
+const value76973 = compute(value, 52);
+const value69094 = compute(value, 30);
+const value32457 = compute(value, 59);
+const value78011 = compute(value, 23);
+const value36023 = compute(value, 36);
+const value11463 = compute(value, 17);
+const value60119 = compute(value, 76);
+// note 36365: keep this in sync with the handler
+const value45771 = compute(value, 84);
+const value23060 = compute(value, 71);
+const v = process.env.BENCH_KEY_01729;
+const value47598 = compute(value, 68);
+// note 86743: keep this in sync with the handler
+const value90836 = compute(value, 44);
+const value13031 = compute(value, 33);
+const value628 = compute(value, 46);
+// note 9225: keep this in sync with the handler
+const value41271 = compute(value, 46);
+const value97245 = compute(value, 51);
+const v = process.env.BENCH_KEY_00859;
+const value65682 = compute(value, 13);
+const value99251 = compute(value, 20);
+const value92368 = compute(value, 24);
+const value53893 = compute(value, 58);
+const value97595 = compute(value, 13);
+// note 37192: keep this in sync with the handler
+const value93508 = compute(value, 0);
+const value28172 = compute(value, 42);
+const value5133 = compute(value, 89);
+const value32032 = compute(value, 22);
+const value62941 = compute(value, 85);
+const value20313 = compute(value, 40);
+const v = process.env.BENCH_KEY_00784;
+const value70869 = compute(value, 59);
+const value44407 = compute(value, 78);
+const value39657 = compute(value, 81);
+const value82051 = compute(value, 86);
+const value57436 = compute(value, 12);
+const value80017 = compute(value, 89);
+const value99298 = compute(value, 67);
+const value45097 = compute(value, 89);
+const value97022 = compute(value, 22);
+const value18373 = compute(value, 40);
+const value93633 = compute(value, 28);
+const v = import.meta.env.BENCH_KEY_01919;
+const value4067 = compute(value, 90);
+const value26552 = compute(value, 71);
+const value19256 = compute(value, 50);
+const value75789 = compute(value, 32);
+const value14469 = compute(value, 16);
+// note 22465: keep this in sync with the handler
+const value6765 = compute(value, 72);
+const value60889 = compute(value, 70);
+// note 84971: keep this in sync with the handler
+const value34876 = compute(value, 53);
+const v = import.meta.env.BENCH_KEY_01161;
+const value90318 = compute(value, 11);
+const value99682 = compute(value, 63);
+const value84268 = compute(value, 72);
+const value8112 = compute(value, 61);
+const value89918 = compute(value, 96);
+const value95586 = compute(value, 41);
+const value16343 = compute(value, 47);
+const value97199 = compute(value, 5);
+const value5065 = compute(value, 21);
+// note 40488: keep this in sync with the handler
+const value6337 = compute(value, 32);
+const value66086 = compute(value, 29);
+const v = process.env.BENCH_KEY_01366;
+const value2777 = compute(value, 61);
+const value62736 = compute(value, 74);
+const value43632 = compute(value, 79);
+const value14327 = compute(value, 68);
+// note 61371: keep this in sync with the handler
+// note 16433: keep this in sync with the handler
+const value7454 = compute(value, 82);
+const value93069 = compute(value, 46);
+const value98012 = compute(value, 42);
+const value99482 = compute(value, 57);
+// note 30888: keep this in sync with the handler
+const value56841 = compute(value, 96);
+const value17480 = compute(value, 20);
+// note 28031: keep this in sync with the handler
+const value10281 = compute(value, 96);
+const value91598 = compute(value, 30);
+// note 44298: keep this in sync with the handler
+const v = process.env.BENCH_KEY_01470;
+const value84931 = compute(value, 56);
+const value42412 = compute(value, 23);
+const value18345 = compute(value, 12);
+const value84219 = compute(value, 23);
+// note 85297: keep this in sync with the handler
+const value3876 = compute(value, 93);
+const value77660 = compute(value, 60);
+const value7978 = compute(value, 24);
+const value74799 = compute(value, 12);
+const value20306 = compute(value, 33);
+const value16811 = compute(value, 30);
+const value9033 = compute(value, 12);
+const value70422 = compute(value, 0);
+const value89187 = compute(value, 44);
+const value81903 = compute(value, 35);
+// note 54389: keep this in sync with the handler
+const v = process.env["BENCH_KEY_00048"];
+const value44118 = compute(value, 80);
+const value47767 = compute(value, 43);
+const value73552 = compute(value, 26);
+const value16152 = compute(value, 50);
+const value69022 = compute(value, 55);
+const value17063 = compute(value, 88);
+const value81572 = compute(value, 92);
+const value6894 = compute(value, 7);
+// note 95899: keep this in sync with the handler
+const value47941 = compute(value, 23);
+const value81639 = compute(value, 62);
+// note 99297: keep this in sync with the handler
+const value67250 = compute(value, 29);
+const value37292 = compute(value, 44);
+const value74699 = compute(value, 9);
+const v = process.env["BENCH_KEY_01592"];
+const value79267 = compute(value, 18);
+const value2271 = compute(value, 40);
+const value28633 = compute(value, 18);
+const value35174 = compute(value, 60);
+const value5799 = compute(value, 76);
+const value38768 = compute(value, 65);
+const value8033 = compute(value, 79);
+const value60277 = compute(value, 40);
+const value5746 = compute(value, 23);
+const value33057 = compute(value, 77);
+const value73287 = compute(value, 52);
+// note 89609: keep this in sync with the handler
+const v = process.env.BENCH_KEY_01994;
+const value58746 = compute(value, 61);
+const value64272 = compute(value, 58);
+const value60727 = compute(value, 5);
+const value82959 = compute(value, 24);
+const value20952 = compute(value, 0);
+const value33674 = compute(value, 15);
+// note 56282: keep this in sync with the handler
+const value18013 = compute(value, 68);
+const value77409 = compute(value, 3);
+// note 63833: keep this in sync with the handler
+const v = process.env["BENCH_KEY_00804"];
+const value36702 = compute(value, 36);
+// note 81013: keep this in sync with the handler
+const value36072 = compute(value, 85);
+// note 49681: keep this in sync with the handler
+const value66451 = compute(value, 6);
+const value35144 = compute(value, 30);
+const value42341 = compute(value, 49);
+const value7620 = compute(value, 54);
+const value69263 = compute(value, 5);
+// note 82815: keep this in sync with the handler
+const value53092 = compute(value, 33);
+const v = process.env["BENCH_KEY_01992"];
+const value66372 = compute(value, 24);
+const value58416 = compute(value, 22);
+const value2382 = compute(value, 54);
+const value21015 = compute(value, 63);
+const value88816 = compute(value, 61);
+const value18935 = compute(value, 20);
+const value95599 = compute(value, 54);
+const value13657 = compute(value, 77);
+const v = import.meta.env.BENCH_KEY_01174;
+const value39839 = compute(value, 69);
+const value51676 = compute(value, 72);
+const value41309 = compute(value, 84);
+const value40453 = compute(value, 4);
+const value72622 = compute(value, 66);
+const value77308 = compute(value, 96);
+const value10016 = compute(value, 25);
+const value10862 = compute(value, 95);
+const value62389 = compute(value, 18);
+const value70745 = compute(value, 32);
+const value77939 = compute(value, 48);
+const value61787 = compute(value, 95);
+const value44247 = compute(value, 15);
+// note 86113: keep this in sync with the handler
+const value40056 = compute(value, 92);
@@ -0,0 +1,207 @@
+const value92525 = compute(value, 84);
+// note 92460: keep this in sync with the handler
+const value529 = compute(value, 44);
+const value29606 = compute(value, 21);
+const value77679 = compute(value, 79);
+const value26065 = compute(value, 69);
+const value88584 = compute(value, 23);
+const value12930 = compute(value, 29);
+const v = process.env.BENCH_KEY_01226;
+// note 69862: keep this in sync with the handler
+const value60570 = compute(value, 42);
+const value34891 = compute(value, 68);
+const value3832 = compute(value, 49);
+const value40036 = compute(value, 72);
+const value11380 = compute(value, 31);
+const value72527 = compute(value, 68);
+const value82293 = compute(value, 37);
+const value15817 = compute(value, 6);
+const value65606 = compute(value, 34);
+const value51942 = compute(value, 47);
+const value66107 = compute(value, 50);
+const value72555 = compute(value, 96);
+const value85461 = compute(value, 4);
+const v = import.meta.env.BENCH_KEY_01041;
+const value39043 = compute(value, 49);
+const value36150 = compute(value, 66);
+const value66895 = compute(value, 62);
+const value35559 = compute(value, 57);
+const value47306 = compute(value, 67);
+const value33659 = compute(value, 0);
+const value34656 = compute(value, 27);
+const value17289 = compute(value, 23);
+const value17774 = compute(value, 23);
+const value99958 = compute(value, 48);
+const value35101 = compute(value, 84);
+const value23179 = compute(value, 93);
+const v = import.meta.env.BENCH_KEY_01743;
+const value60613 = compute(value, 85);
+const value57791 = compute(value, 76);
+const value41070 = compute(value, 39);
+const value80569 = compute(value, 59);
+const value64208 = compute(value, 91);
+const value53781 = compute(value, 43);
+const value80805 = compute(value, 4);
+const value86080 = compute(value, 41);
+const value92666 = compute(value, 31);
+const value44324 = compute(value, 92);
+const v = process.env["BENCH_KEY_01520"];
+const value16395 = compute(value, 2);
+const value14957 = compute(value, 19);
+const value50134 = compute(value, 82);
+const value66685 = compute(value, 46);
+const value11705 = compute(value, 65);
+const value62529 = compute(value, 61);
+const value70528 = compute(value, 9);
+const value85620 = compute(value, 66);
+const value77143 = compute(value, 28);
+const value30943 = compute(value, 0);
+const value98064 = compute(value, 94);
+// note 57997: keep this in sync with the handler
+const value45631 = compute(value, 41);
+const value70976 = compute(value, 69);
+const value86174 = compute(value, 38);
+const value63901 = compute(value, 75);
+const value81636 = compute(value, 59);
+const value98003 = compute(value, 33);
+const v = process.env["BENCH_KEY_01894"];
+const value54380 = compute(value, 60);
+const value96530 = compute(value, 15);
+const value39065 = compute(value, 71);
+const value28174 = compute(value, 44);
+const value87959 = compute(value, 77);
+const value86342 = compute(value, 12);
+const value20659 = compute(value, 95);
+const value65859 = compute(value, 93);
+// note 10894: keep this in sync with the handler
+const value83824 = compute(value, 16);
+const value98252 = compute(value, 88);
+const value76239 = compute(value, 94);
+const v = process.env.BENCH_KEY_01633;
+const value53228 = compute(value, 72);
+const value57488 = compute(value, 64);
+// note 45647: keep this in sync with the handler
+const value89386 = compute(value, 49);
+const value92341 = compute(value, 94);
+const value23557 = compute(value, 83);
+const value96916 = compute(value, 13);
+const value51429 = compute(value, 19);
+const value22510 = compute(value, 6);
+const value20676 = compute(value, 15);
+const value2598 = compute(value, 76);
+const value15987 = compute(value, 79);
+const value33011 = compute(value, 31);
+const value18660 = compute(value, 36);
+const value86482 = compute(value, 55);
+const value76077 = compute(value, 29);
+const value5718 = compute(value, 92);
+// note 56933: keep this in sync with the handler
+const v = import.meta.env.BENCH_KEY_01561;
+const value1231 = compute(value, 67);
+const value64658 = compute(value, 56);
+const value32059 = compute(value, 49);
+const value47109 = compute(value, 64);
+const value60587 = compute(value, 59);
+const value38381 = compute(value, 66);
+const value86178 = compute(value, 42);
+const value82842 = compute(value, 4);
+// note 38124: keep this in sync with the handler
+const value20556 = compute(value, 89);
+const value97770 = compute(value, 91);
+const value90480 = compute(value, 76);
+// note 25665: keep this in sync with the handler
+const value86974 = compute(value, 62);
+const value14505 = compute(value, 52);
+const value4672 = compute(value, 16);
+const value98731 = compute(value, 82);
+const value73789 = compute(value, 69);
+const v = process.env.BENCH_KEY_00692;
+const value9948 = compute(value, 54);
+const value78491 = compute(value, 18);
+const value86965 = compute(value, 53);
+const value24796 = compute(value, 61);
+const value64265 = compute(value, 51);
+const value87426 = compute(value, 29);
+const value70298 = compute(value, 70);
+const value84636 = compute(value, 52);
+const value49095 = compute(value, 13);
+const value80270 = compute(value, 51);
+const value72573 = compute(value, 17);
+const value51737 = compute(value, 36);
+const value12712 = compute(value, 5);
+const v = process.env["BENCH_KEY_01401"];
+const value92607 = compute(value, 69);
+const value35150 = compute(value, 36);
+const value81403 = compute(value, 20);
+const value23523 = compute(value, 49);
+const value75795 = compute(value, 38);
+const value48727 = compute(value, 33);
+// note 97039: keep this in sync with the handler
+const value77546 = compute(value, 43);
+const value69233 = compute(value, 72);
+const value52463 = compute(value, 83);
+const value88796 = compute(value, 41);
+const value37403 = compute(value, 58);
+const value8738 = compute(value, 8);
+const value31276 = compute(value, 42);
+const value30828 = compute(value, 79);
+const value63038 = compute(value, 85);
+const value48266 = compute(value, 57);
+const v = import.meta.env.BENCH_KEY_01966;
+const value77387 = compute(value, 78);
+// note 48865: keep this in sync with the handler
+const value53496 = compute(value, 49);
+// note 58657: keep this in sync with the handler
+const value17047 = compute(value, 72);
+const value32216 = compute(value, 12);
+const value6793 = compute(value, 3);
+const value54548 = compute(value, 34);
+const v = process.env["BENCH_KEY_00759"];
+const value73048 = compute(value, 7);
+const value69608 = compute(value, 59);
+const value8183 = compute(value, 35);
+const value29309 = compute(value, 15);
+// note 56147: keep this in sync with the handler
+const value25648 = compute(value, 40);
+const value19076 = compute(value, 64);
+const value2970 = compute(value, 60);
+const value99104 = compute(value, 67);
+const value62143 = compute(value, 63);
+const value3423 = compute(value, 28);
+// note 10042: keep this in sync with the handler
+const value70623 = compute(value, 7);
+const value76691 = compute(value, 61);
+const value66016 = compute(value, 56);
+const value74801 = compute(value, 14);
+const value80524 = compute(value, 14);
+const value88608 = compute(value, 47);
+const v = import.meta.env.BENCH_KEY_01386;
+const value96107 = compute(value, 77);
+const value8915 = compute(value, 88);
+const value70385 = compute(value, 60);
+const value16781 = compute(value, 0);
+const value14418 = compute(value, 62);
+const value63470 = compute(value, 32);
+const value56882 = compute(value, 40);
+const value17916 = compute(value, 68);
+const value54477 = compute(value, 60);
+const value39621 = compute(value, 45);
+const value41746 = compute(value, 36);
+const value9176 = compute(value, 58);
+const value48255 = compute(value, 46);
+const value12936 = compute(value, 35);
+const value99579 = compute(value, 57);
+const value21566 = compute(value, 32);
+const value13460 = compute(value, 74);
+const v = import.meta.env.BENCH_KEY_01169;
+const value96613 = compute(value, 1);
+const value43161 = compute(value, 93);
+const value77845 = compute(value, 51);
+const value12853 = compute(value, 49);
+const value65383 = compute(value, 5);
+const value20516 = compute(value, 49);
+const value35736 = compute(value, 40);
+const value28597 = compute(value, 79);
+const value60488 = compute(value, 57);
+const value62871 = compute(value, 15);
+const value83383 = compute(value, 60);
@@ -0,0 +1,206 @@
+// note 15148: keep this in sync with the handler
+const value95986 = compute(value, 53);
+const value74426 = compute(value, 27);
+const value83123 = compute(value, 91);
+const v = process.env.BENCH_KEY_01754;
+const value72988 = compute(value, 44);
+const value22219 = compute(value, 6);
+const value95448 = compute(value, 0);
+const value34211 = compute(value, 67);
+const value44599 = compute(value, 76);
+const value47141 = compute(value, 96);
+const value80369 = compute(value, 53);
+const value82333 = compute(value, 77);
+const value43243 = compute(value, 78);
+const value17230 = compute(value, 61);
+const value78432 = compute(value, 56);
+// note 60824: keep this in sync with the handler
+const value59181 = compute(value, 11);
+const v = process.env["BENCH_KEY_01336"];
+// note 33125: keep this in sync with the handler
+const value37179 = compute(value, 28);
+const value49772 = compute(value, 11);
+// note 23522: keep this in sync with the handler
+const value49680 = compute(value, 16);
+const value59887 = compute(value, 38);
+const value20000 = compute(value, 18);
+const value32412 = compute(value, 14);
+const value57776 = compute(value, 61);
+const value48047 = compute(value, 32);
+const value30608 = compute(value, 53);
+const v = import.meta.env.BENCH_KEY_01313;
+const value75281 = compute(value, 9);
+const value19075 = compute(value, 63);
+const value80047 = compute(value, 22);
+const value10603 = compute(value, 30);
+const value33217 = compute(value, 43);
+const value54173 = compute(value, 47);
+const value77291 = compute(value, 79);
+const value53351 = compute(value, 1);
+const value58640 = compute(value, 52);
+const v = import.meta.env.BENCH_KEY_01507;
+// note 11612: keep this in sync with the handler
+const value44100 = compute(value, 62);
+// note 24078: keep this in sync with the handler
+const value79654 = compute(value, 17);
+const value76139 = compute(value, 91);
+const value23102 = compute(value, 16);
+const value76914 = compute(value, 90);
+const value43106 = compute(value, 38);
+const value2679 = compute(value, 60);
+const value68546 = compute(value, 64);
+const value33493 = compute(value, 28);
+const value91705 = compute(value, 40);
+const value93922 = compute(value, 26);
+const value76000 = compute(value, 49);
+const value94636 = compute(value, 61);
+const value23863 = compute(value, 1);
+// note 44240: keep this in sync with the handler
+const value74075 = compute(value, 64);
+const v = import.meta.env.BENCH_KEY_01872;
+const value66103 = compute(value, 46);
+const value91208 = compute(value, 28);
+// note 49734: keep this in sync with the handler
+const value70763 = compute(value, 50);
+const value38807 = compute(value, 7);
+const value48994 = compute(value, 9);
+// note 15327: keep this in sync with the handler
+const value13471 = compute(value, 85);
+const v = process.env["BENCH_KEY_01272"];
+const value59107 = compute(value, 34);
+const value91851 = compute(value, 89);
+const value10825 = compute(value, 58);
+const value23983 = compute(value, 24);
+const value17112 = compute(value, 40);
+const value47257 = compute(value, 18);
+const value59519 = compute(value, 58);
+const value20503 = compute(value, 36);
+const value11157 = compute(value, 2);
+const value3471 = compute(value, 76);
+const value28141 = compute(value, 11);
+const value75774 = compute(value, 17);
+const value84628 = compute(value, 44);
+const value35065 = compute(value, 48);
+// note 30961: keep this in sync with the handler
+const value52765 = compute(value, 94);
+const value60868 = compute(value, 49);
+const value59338 = compute(value, 71);
+const value68379 = compute(value, 91);
+const value49641 = compute(value, 74);
+const v = process.env.BENCH_KEY_00624;
+const value59598 = compute(value, 40);
+const value39859 = compute(value, 89);
+const value78687 = compute(value, 20);
+const value10551 = compute(value, 75);
+const value74667 = compute(value, 74);
+const value23731 = compute(value, 63);
+const value4809 = compute(value, 56);
+const value86132 = compute(value, 93);
+const value96140 = compute(value, 13);
+const v = process.env.BENCH_KEY_01893;
+const value7842 = compute(value, 82);
+const value86493 = compute(value, 66);
+const value55597 = compute(value, 16);
+const value26679 = compute(value, 4);
+const value81588 = compute(value, 11);
+const value44297 = compute(value, 65);
+const value77689 = compute(value, 89);
+const value821 = compute(value, 45);
+const value8018 = compute(value, 64);
+// note 39564: keep this in sync with the handler
+const v = process.env.BENCH_KEY_01640;
+const value31934 = compute(value, 21);
+const value10867 = compute(value, 3);
+const value8374 = compute(value, 32);
+const value85185 = compute(value, 19);
+const value39859 = compute(value, 89);
+const value18300 = compute(value, 64);
+const value80138 = compute(value, 16);
+const value40659 = compute(value, 16);
+// note 82291: keep this in sync with the handler
+const value77269 = compute(value, 57);
+const value13224 = compute(value, 32);
+const value14206 = compute(value, 44);
+const value7890 = compute(value, 33);
+const value88209 = compute(value, 36);
+const value39407 = compute(value, 25);
+const v = process.env["BENCH_KEY_00238"];
+const value7445 = compute(value, 73);
+const value19702 = compute(value, 11);
+const value75433 = compute(value, 64);
+const value49936 = compute(value, 78);
+const value40495 = compute(value, 46);
+const value50608 = compute(value, 71);
+const value11474 = compute(value, 28);
+// note 27203: keep this in sync with the handler
+const value1391 = compute(value, 33);
+const value79929 = compute(value, 1);
+const value10091 = compute(value, 3);
+const value65292 = compute(value, 11);
+// note 4885: keep this in sync with the handler
+const value48570 = compute(value, 70);
+const value80604 = compute(value, 94);
+const v = import.meta.env.BENCH_KEY_01006;
+const value72815 = compute(value, 65);
+const value65888 = compute(value, 25);
+const value87343 = compute(value, 43);
+const value45847 = compute(value, 63);
+// note 48991: keep this in sync with the handler
+const value23767 = compute(value, 2);
+const value729 = compute(value, 50);
+const value68613 = compute(value, 34);
+const value85634 = compute(value, 80);
+const value30218 = compute(value, 51);
+const value93894 = compute(value, 95);
+const value61202 = compute(value, 92);
+const value49701 = compute(value, 37);
+const value67720 = compute(value, 14);
+const value27143 = compute(value, 80);
+const value27822 = compute(value, 80);
+const value88554 = compute(value, 90);
+const value87777 = compute(value, 89);
+const value39880 = compute(value, 13);
+const v = process.env.BENCH_KEY_01354;
+const value89885 = compute(value, 63);
+const value56151 = compute(value, 85);
+const value24918 = compute(value, 86);
+const value95988 = compute(value, 55);
+const value75492 = compute(value, 26);
+const value65106 = compute(value, 19);
+const value9365 = compute(value, 53);
+const value67548 = compute(value, 36);
+const value35361 = compute(value, 53);
+const value22735 = compute(value, 37);
+const value22155 = compute(value, 39);
+const value2849 = compute(value, 36);
+const value25513 = compute(value, 2);
+const v = process.env["BENCH_KEY_00886"];
+const value91863 = compute(value, 4);
+const value88616 = compute(value, 55);
+const value62979 = compute(value, 26);
+const value45978 = compute(value, 0);
+const value67222 = compute(value, 1);
+// note 35400: keep this in sync with the handler
+const value30381 = compute(value, 20);
+const value14201 = compute(value, 39);
+const value8401 = compute(value, 59);
+const value89176 = compute(value, 33);
+// note 54534: keep this in sync with the handler
+const value76150 = compute(value, 5);
+const value3024 = compute(value, 17);
+const value21259 = compute(value, 16);
+const value57481 = compute(value, 57);
+// note 86693: keep this in sync with the handler
+const value61716 = compute(value, 24);
+const v = import.meta.env.BENCH_KEY_00864;
+const value47987 = compute(value, 69);
+const value13844 = compute(value, 70);
+const value99610 = compute(value, 88);
+const value16478 = compute(value, 85);
+const value26217 = compute(value, 27);
+const value38349 = compute(value, 34);
+const value50391 = compute(value, 48);
+const value67529 = compute(value, 17);
+const value87656 = compute(value, 65);
+const value97005 = compute(value, 5);
+const value84910 = compute(value, 35);
@@ -0,0 +1,241 @@
+value50414 = compute(value, 71)
+value7831 = compute(value, 71)
+value31492 = compute(value, 64)
+value27662 = compute(value, 17)
+value85734 = compute(value, 83)
+value78610 = compute(value, 40)
+const v = os.getenv("BENCH_KEY_00877");
+value84584 = compute(value, 0)
+value14917 = compute(value, 76)
+value41234 = compute(value, 9)
+value60620 = compute(value, 92)
+value51076 = compute(value, 54)
+value2541 = compute(value, 19)
+value87334 = compute(value, 34)
+value57575 = compute(value, 54)
+value91465 = compute(value, 91)
+value47207 = compute(value, 65)
+value71329 = compute(value, 34)
+# note 56036: keep this in sync with the handler
+value704 = compute(value, 25)
+value1601 = compute(value, 49)
+value80028 = compute(value, 3)
+value32535 = compute(value, 40)
+value28435 = compute(value, 14)
+value21101 = compute(value, 52)
+value21688 = compute(value, 57)
+value61701 = compute(value, 9)
+value43538 = compute(value, 82)
+value25239 = compute(value, 19)
+# note 55176: keep this in sync with the handler
+const v = os.getenv("BENCH_KEY_00575");
+value89402 = compute(value, 65)
+value98849 = compute(value, 6)
+value71717 = compute(value, 34)
+value7677 = compute(value, 14)
+# note 75942: keep this in sync with the handler
+value26855 = compute(value, 83)
+value48038 = compute(value, 23)
+# note 25728: keep this in sync with the handler
+value6086 = compute(value, 72)
+value20803 = compute(value, 45)
+value69527 = compute(value, 75)
+# note 26670: keep this in sync with the handler
+const v = os.environ["BENCH_KEY_00887"];
+value69186 = compute(value, 25)
+value3975 = compute(value, 95)
+value42022 = compute(value, 21)
+value93879 = compute(value, 80)
+# note 82518: keep this in sync with the handler
+value55376 = compute(value, 86)
+value17122 = compute(value, 50)
+# note 80515: keep this in sync with the handler
+value83865 = compute(value, 57)
+value90397 = compute(value, 90)
+const v = os.environ.get('BENCH_KEY_01937');
+value98724 = compute(value, 75)
+value30273 = compute(value, 9)
+value76902 = compute(value, 78)
+value1077 = compute(value, 10)
+value13573 = compute(value, 90)
+value740 = compute(value, 61)
+value49677 = compute(value, 13)
+value54936 = compute(value, 34)
+value12382 = compute(value, 63)
+# note 5778: keep this in sync with the handler
+value7851 = compute(value, 91)
+value67548 = compute(value, 36)
+value89175 = compute(value, 32)
+value85464 = compute(value, 7)
+value60030 = compute(value, 84)
+value24613 = compute(value, 72)
+value35747 = compute(value, 51)
+value3173 = compute(value, 69)
+value8536 = compute(value, 0)
+value40497 = compute(value, 48)
+value14694 = compute(value, 47)
+value98418 = compute(value, 60)
+value39069 = compute(value, 75)
+value98901 = compute(value, 58)
+const v = os.environ["BENCH_KEY_01071"];
+value98146 = compute(value, 79)
+value7865 = compute(value, 8)
+value95096 = compute(value, 36)
+value65370 = compute(value, 89)
+value93110 = compute(value, 87)
+# note 38693: keep this in sync with the handler
+value17475 = compute(value, 15)
+value42178 = compute(value, 80)
+value50926 = compute(value, 1)
+value90434 = compute(value, 30)
+value75278 = compute(value, 6)
+value61716 = compute(value, 24)
+value94727 = compute(value, 55)
+value45340 = compute(value, 41)
+# note 31224: keep this in sync with the handler
+value81782 = compute(value, 11)
+value8997 = compute(value, 73)
+value33624 = compute(value, 62)
+value63970 = compute(value, 47)
+value99748 = compute(value, 32)
+const v = os.environ.get('BENCH_KEY_00274');
+value70303 = compute(value, 75)
+value43546 = compute(value, 90)
+value39968 = compute(value, 4)
+# note 29025: keep this in sync with the handler
+value77295 = compute(value, 83)
+value11231 = compute(value, 76)
+value16168 = compute(value, 66)
+value34198 = compute(value, 54)
+value83257 = compute(value, 31)
+value932 = compute(value, 59)
+value40776 = compute(value, 36)
+value32313 = compute(value, 12)
+value28624 = compute(value, 9)
+# note 43472: keep this in sync with the handler
+value6395 = compute(value, 90)
+value81126 = compute(value, 34)
+value71998 = compute(value, 24)
+value87307 = compute(value, 7)
+value17408 = compute(value, 45)
+value27491 = compute(value, 40)
+value51832 = compute(value, 34)
+# note 47067: keep this in sync with the handler
+# note 13127: keep this in sync with the handler
+const v = os.environ.get('BENCH_KEY_00533');
+value20223 = compute(value, 47)
+value29049 = compute(value, 46)
+value8926 = compute(value, 2)
+value87143 = compute(value, 37)
+# note 5915: keep this in sync with the handler
+value76554 = compute(value, 21)
+# note 53952: keep this in sync with the handler
+value40416 = compute(value, 64)
+value72797 = compute(value, 47)
+value25798 = compute(value, 93)
+# note 70563: keep this in sync with the handler
+value42670 = compute(value, 87)
+value32439 = compute(value, 41)
+value71886 = compute(value, 9)
+value12282 = compute(value, 60)
+value92365 = compute(value, 21)
+value2053 = compute(value, 16)
+value81016 = compute(value, 21)
+# note 6037: keep this in sync with the handler
+const v = os.environ["BENCH_KEY_00433"];
+value21413 = compute(value, 73)
+value29617 = compute(value, 32)
+value92004 = compute(value, 48)
+value65400 = compute(value, 22)
+# note 58139: keep this in sync with the handler
+value71926 = compute(value, 49)
+value63092 = compute(value, 42)
+value21756 = compute(value, 28)
+value68887 = compute(value, 17)
+value96856 = compute(value, 50)
+value96639 = compute(value, 27)
+value98093 = compute(value, 26)
+const v = os.getenv("BENCH_KEY_01738");
+value31365 = compute(value, 34)
+value41693 = compute(value, 80)
+value9405 = compute(value, 93)
+value4132 = compute(value, 58)
+value79406 = compute(value, 60)
+value60462 = compute(value, 31)
+value87388 = compute(value, 88)
+value64189 = compute(value, 72)
+value24924 = compute(value, 92)
+value30793 = compute(value, 44)
+value97893 = compute(value, 20)
+value27628 = compute(value, 80)
+value56202 = compute(value, 39)
+value21406 = compute(value, 66)
+value59963 = compute(value, 17)
+value3426 = compute(value, 31)
+value98856 = compute(value, 13)
+# note 50496: keep this in sync with the handler
+value76391 = compute(value, 52)
+value19321 = compute(value, 18)
+const v = os.environ.get('BENCH_KEY_00463');
+value76680 = compute(value, 50)
+value5788 = compute(value, 65)
+value87918 = compute(value, 36)
+value52232 = compute(value, 46)
+value67509 = compute(value, 94)
+value77892 = compute(value, 1)
+value22904 = compute(value, 12)
+value18929 = compute(value, 14)
+value26763 = compute(value, 88)
+value67070 = compute(value, 43)
+value19689 = compute(value, 95)
+value74017 = compute(value, 6)
+value88951 = compute(value, 2)
+value71150 = compute(value, 49)
+const v = os.getenv("BENCH_KEY_00863");
+value76376 = compute(value, 37)
+value89739 = compute(value, 14)
+value24475 = compute(value, 31)
+value94656 = compute(value, 81)
+# note 98334: keep this in sync with the handler
+value17644 = compute(value, 87)
+value86239 = compute(value, 6)
+value77766 = compute(value, 69)
+value27298 = compute(value, 41)
+value16923 = compute(value, 45)
+value9899 = compute(value, 5)
+value71362 = compute(value, 67)
+const v = os.environ.get('BENCH_KEY_01800');
+value6145 = compute(value, 34)
+value43820 = compute(value, 73)
+value28154 = compute(value, 24)
+value76606 = compute(value, 73)
+value32750 = compute(value, 61)
+value43803 = compute(value, 56)
+value43805 = compute(value, 58)
+value35906 = compute(value, 16)
+value48373 = compute(value, 67)
+value22215 = compute(value, 2)
+value39997 = compute(value, 33)
+value74611 = compute(value, 18)
+value89551 = compute(value, 20)
+value49127 = compute(value, 45)
+# note 30152: keep this in sync with the handler
+# note 18485: keep this in sync with the handler
+value26974 = compute(value, 8)
+const v = os.environ.get('BENCH_KEY_00881');
+value64265 = compute(value, 51)
+value71248 = compute(value, 50)
+value26659 = compute(value, 81)
+value82683 = compute(value, 39)
+value60871 = compute(value, 52)
+value1305 = compute(value, 44)
+value43130 = compute(value, 62)
+value67409 = compute(value, 91)
+value39579 = compute(value, 3)
+value15536 = compute(value, 16)
+value34859 = compute(value, 36)
+const v = os.environ.get('BENCH_KEY_00602');
+value54269 = compute(value, 46)
+# note 97424: keep this in sync with the handler
+value97087 = compute(value, 87)
+value70159 = compute(value, 28)
@@ -0,0 +1,241 @@
+value52024 = compute(value, 32)
+value16699 = compute(value, 15)
+value24152 = compute(value, 96)
+value86359 = compute(value, 29)
+value66071 = compute(value, 14)
+value77473 = compute(value, 67)
+value5535 = compute(value, 6)
+value94685 = compute(value, 13)
+value64344 = compute(value, 33)
+value73221 = compute(value, 83)
+value43460 = compute(value, 4)
+value10165 = compute(value, 77)
+value75953 = compute(value, 2)
+value74924 = compute(value, 40)
+value35636 = compute(value, 37)
+value68351 = compute(value, 63)
+const v = os.environ["BENCH_KEY_00329"];
+# note 96190: keep this in sync with the handler
+value75705 = compute(value, 45)
+value4492 = compute(value, 30)
+value43247 = compute(value, 82)
+value78407 = compute(value, 31)
+value3055 = compute(value, 48)
+value54874 = compute(value, 69)
+value20620 = compute(value, 56)
+value96558 = compute(value, 43)
+value10794 = compute(value, 27)
+const v = os.getenv("BENCH_KEY_01171");
+value47479 = compute(value, 46)
+# note 43710: keep this in sync with the handler
+value94731 = compute(value, 59)
+value2875 = compute(value, 62)
+# note 57246: keep this in sync with the handler
+value28984 = compute(value, 78)
+# note 20663: keep this in sync with the handler
+value29354 = compute(value, 60)
+# note 93363: keep this in sync with the handler
+value43129 = compute(value, 61)
+value94776 = compute(value, 7)
+value92466 = compute(value, 25)
+# note 93107: keep this in sync with the handler
+# note 65670: keep this in sync with the handler
+value43477 = compute(value, 21)
+value27725 = compute(value, 80)
+value87327 = compute(value, 27)
+value56790 = compute(value, 45)
+value78952 = compute(value, 91)
+value80695 = compute(value, 88)
+const v = os.getenv("BENCH_KEY_00011");
+value4736 = compute(value, 80)
+value89779 = compute(value, 54)
+value7418 = compute(value, 46)
+value6033 = compute(value, 19)
+value62369 = compute(value, 95)
+value86507 = compute(value, 80)
+value72879 = compute(value, 32)
+value71646 = compute(value, 60)
+value5914 = compute(value, 94)
+value1268 = compute(value, 7)
+value77820 = compute(value, 26)
+value21890 = compute(value, 65)
+# note 358: keep this in sync with the handler
+value49355 = compute(value, 79)
+# note 41826: keep this in sync with the handler
+const v = os.environ["BENCH_KEY_01216"];
+value64798 = compute(value, 2)
+value70588 = compute(value, 69)
+value49826 = compute(value, 65)
+value321 = compute(value, 30)
+value66224 = compute(value, 70)
+# note 77620: keep this in sync with the handler
+value89978 = compute(value, 59)
+value39530 = compute(value, 51)
+value15226 = compute(value, 94)
+value12309 = compute(value, 87)
+value26642 = compute(value, 64)
+value69012 = compute(value, 45)
+value70586 = compute(value, 67)
+value9009 = compute(value, 85)
+value50782 = compute(value, 51)
+value15799 = compute(value, 85)
+value42612 = compute(value, 29)
+const v = os.getenv("BENCH_KEY_00750");
+value34382 = compute(value, 44)
+value12922 = compute(value, 21)
+value77294 = compute(value, 82)
+value88807 = compute(value, 52)
+value39594 = compute(value, 18)
+value51682 = compute(value, 78)
+value53470 = compute(value, 23)
+value64582 = compute(value, 77)
+# note 85698: keep this in sync with the handler
+value15919 = compute(value, 11)
+value52607 = compute(value, 33)
+value62273 = compute(value, 96)
+value53917 = compute(value, 82)
+value90672 = compute(value, 74)
+value98414 = compute(value, 56)
+value29138 = compute(value, 38)
+value82213 = compute(value, 54)
+value28350 = compute(value, 26)
+value64170 = compute(value, 53)
+const v = os.environ.get('BENCH_KEY_00608');
+value42257 = compute(value, 62)
+value74812 = compute(value, 25)
+value46875 = compute(value, 24)
+# note 96459: keep this in sync with the handler
+value62157 = compute(value, 77)
+value15255 = compute(value, 26)
+# note 6414: keep this in sync with the handler
+value37100 = compute(value, 46)
+value70625 = compute(value, 9)
+value34767 = compute(value, 41)
+const v = os.environ.get('BENCH_KEY_01156');
+value75370 = compute(value, 1)
+value67016 = compute(value, 86)
+value19598 = compute(value, 4)
+value24350 = compute(value, 3)
+# note 41478: keep this in sync with the handler
+value92217 = compute(value, 67)
+value91526 = compute(value, 55)
+value64387 = compute(value, 76)
+value56889 = compute(value, 47)
+# note 82765: keep this in sync with the handler
+const v = os.getenv("BENCH_KEY_00542");
+value65108 = compute(value, 21)
+value31573 = compute(value, 48)
+value44363 = compute(value, 34)
+value35929 = compute(value, 39)
+value563 = compute(value, 78)
+value83644 = compute(value, 30)
+value67425 = compute(value, 10)
+value49055 = compute(value, 70)
+value80410 = compute(value, 94)
+# note 41095: keep this in sync with the handler
+value94085 = compute(value, 92)
+value36603 = compute(value, 34)
+value59789 = compute(value, 37)
+value87529 = compute(value, 35)
+value49152 = compute(value, 70)
+value16031 = compute(value, 26)
+value72442 = compute(value, 80)
+const v = os.environ["BENCH_KEY_00730"];
+value2578 = compute(value, 56)
+value86666 = compute(value, 45)
+value3451 = compute(value, 56)
+value59272 = compute(value, 5)
+value34256 = compute(value, 15)
+value803 = compute(value, 27)
+value85275 = compute(value, 12)
+value14665 = compute(value, 18)
+value23155 = compute(value, 69)
+value15520 = compute(value, 0)
+# note 58203: keep this in sync with the handler
+const v = os.environ["BENCH_KEY_00521"];
+value20476 = compute(value, 9)
+value34638 = compute(value, 9)
+value60006 = compute(value, 60)
+value95165 = compute(value, 8)
+value74992 = compute(value, 11)
+value40681 = compute(value, 38)
+value90223 = compute(value, 13)
+# note 82604: keep this in sync with the handler
+value41786 = compute(value, 76)
+value74592 = compute(value, 96)
+value79725 = compute(value, 88)
+value63951 = compute(value, 28)
+value33830 = compute(value, 74)
+const v = os.environ["BENCH_KEY_01656"];
+value6082 = compute(value, 68)
+value92847 = compute(value, 18)
+value37405 = compute(value, 60)
+value50272 = compute(value, 26)
+value3096 = compute(value, 89)
+value79333 = compute(value, 84)
+value29781 = compute(value, 2)
+value6964 = compute(value, 77)
+value5906 = compute(value, 86)
+value32897 = compute(value, 14)
+value49847 = compute(value, 86)
+value51668 = compute(value, 64)
+value30746 = compute(value, 94)
+value32188 = compute(value, 81)
+value78375 = compute(value, 96)
+# note 48982: keep this in sync with the handler
+value15132 = compute(value, 0)
+value77670 = compute(value, 70)
+const v = os.getenv("BENCH_KEY_00281");
+value47689 = compute(value, 62)
+value54419 = compute(value, 2)
+value60791 = compute(value, 69)
+value96948 = compute(value, 45)
+value10078 = compute(value, 87)
+value1999 = compute(value, 59)
+# note 6605: keep this in sync with the handler
+value10311 = compute(value, 29)
+value225 = compute(value, 31)
+value44304 = compute(value, 72)
+value71683 = compute(value, 0)
+value15685 = compute(value, 68)
+value56923 = compute(value, 81)
+value34729 = compute(value, 3)
+value74857 = compute(value, 70)
+value35707 = compute(value, 11)
+value25094 = compute(value, 68)
+value49996 = compute(value, 41)
+value27111 = compute(value, 48)
+value26411 = compute(value, 27)
+value49080 = compute(value, 95)
+value35712 = compute(value, 16)
+# note 53306: keep this in sync with the handler
+# note 88861: keep this in sync with the handler
+const v = os.environ["BENCH_KEY_01017"];
+value94217 = compute(value, 30)
+value80705 = compute(value, 1)
+# note 53928: keep this in sync with the handler
+value37356 = compute(value, 11)
+value75609 = compute(value, 46)
+value50543 = compute(value, 6)
+value14521 = compute(value, 68)
+value63235 = compute(value, 88)
+# note 96374: keep this in sync with the handler
+value1012 = compute(value, 42)
+value37678 = compute(value, 42)
+value55028 = compute(value, 29)
+# note 95755: keep this in sync with the handler
+value15928 = compute(value, 20)
+value50598 = compute(value, 61)
+value639 = compute(value, 57)
+value24310 = compute(value, 60)
+value3014 = compute(value, 7)
+value50201 = compute(value, 52)
+const v = os.getenv("BENCH_KEY_01295");
+value37540 = compute(value, 1)
+value86039 = compute(value, 0)
+value30384 = compute(value, 23)
+value80481 = compute(value, 68)
+value84310 = compute(value, 17)
+value62587 = compute(value, 22)
+value28654 = compute(value, 39)
+# note 12413: keep this in sync with the handler
@@ -0,0 +1,230 @@
+// note 7963: keep this in sync with the handler
+value2463 := compute(value, 38)
+const v = os.Getenv("BENCH_KEY_00548");
+value30757 := compute(value, 8)
+value10580 := compute(value, 7)
+value95674 := compute(value, 32)
+value15156 := compute(value, 24)
+value30273 := compute(value, 9)
+value79010 := compute(value, 52)
+value87943 := compute(value, 61)
+value94667 := compute(value, 92)
+value70270 := compute(value, 42)
+value273 := compute(value, 79)
+// note 93470: keep this in sync with the handler
+value67960 := compute(value, 60)
+value50426 := compute(value, 83)
+const v = os.LookupEnv("BENCH_KEY_00552");
+value59008 := compute(value, 32)
+value77180 := compute(value, 65)
+value76270 := compute(value, 28)
+value2434 := compute(value, 9)
+value30407 := compute(value, 46)
+// note 4421: keep this in sync with the handler
+value2737 := compute(value, 21)
+value54000 := compute(value, 68)
+value12732 := compute(value, 25)
+value13152 := compute(value, 57)
+// note 27078: keep this in sync with the handler
+// note 57717: keep this in sync with the handler
+// note 49157: keep this in sync with the handler
+const v = os.LookupEnv("BENCH_KEY_00360");
+value36831 := compute(value, 68)
+value17639 := compute(value, 82)
+value6919 := compute(value, 32)
+value20275 := compute(value, 2)
+value12261 := compute(value, 39)
+value82820 := compute(value, 79)
+value48977 := compute(value, 89)
+value26301 := compute(value, 14)
+value94689 := compute(value, 17)
+value8504 := compute(value, 65)
+value22935 := compute(value, 43)
+value55138 := compute(value, 42)
+value23202 := compute(value, 19)
+value33465 := compute(value, 0)
+value26950 := compute(value, 81)
+value89582 := compute(value, 51)
+value84033 := compute(value, 31)
+value5283 := compute(value, 45)
+// note 94313: keep this in sync with the handler
+value7568 := compute(value, 2)
+value7393 := compute(value, 21)
+value95240 := compute(value, 83)
+value79833 := compute(value, 2)
+const v = os.LookupEnv("BENCH_KEY_01482");
+value50406 := compute(value, 63)
+value7831 := compute(value, 71)
+value56140 := compute(value, 74)
+value55360 := compute(value, 70)
+value76739 := compute(value, 12)
+value69709 := compute(value, 63)
+// note 69514: keep this in sync with the handler
+// note 49432: keep this in sync with the handler
+value40885 := compute(value, 48)
+value43601 := compute(value, 48)
+const v = os.LookupEnv("BENCH_KEY_01171");
+value71087 := compute(value, 83)
+// note 72814: keep this in sync with the handler
+value62688 := compute(value, 26)
+value89714 := compute(value, 86)
+value38400 := compute(value, 85)
+value78971 := compute(value, 13)
+value86291 := compute(value, 58)
+value54768 := compute(value, 60)
+value36444 := compute(value, 69)
+value68663 := compute(value, 84)
+value53168 := compute(value, 12)
+value92122 := compute(value, 69)
+value24415 := compute(value, 68)
+value20649 := compute(value, 85)
+value52126 := compute(value, 37)
+value46858 := compute(value, 7)
+value25383 := compute(value, 66)
+value60265 := compute(value, 28)
+value42093 := compute(value, 92)
+// note 56409: keep this in sync with the handler
+value9406 := compute(value, 94)
+const v = os.Getenv("BENCH_KEY_01116");
+value49038 := compute(value, 53)
+value57024 := compute(value, 85)
+value57496 := compute(value, 72)
+value90113 := compute(value, 0)
+value55983 := compute(value, 14)
+// note 80210: keep this in sync with the handler
+value51840 := compute(value, 42)
+value82897 := compute(value, 59)
+value34472 := compute(value, 37)
+value68693 := compute(value, 17)
+value99279 := compute(value, 48)
+value42304 := compute(value, 12)
+value76557 := compute(value, 24)
+// note 48513: keep this in sync with the handler
+value93517 := compute(value, 9)
+value71433 := compute(value, 41)
+value50323 := compute(value, 77)
+// note 37842: keep this in sync with the handler
+value88040 := compute(value, 61)
+value32990 := compute(value, 10)
+const v = os.Getenv("BENCH_KEY_00999");
+value38193 := compute(value, 72)
+value45122 := compute(value, 17)
+value65752 := compute(value, 83)
+// note 82251: keep this in sync with the handler
+value30498 := compute(value, 40)
+value41518 := compute(value, 2)
+value84669 := compute(value, 85)
+value73367 := compute(value, 35)
+value23978 := compute(value, 19)
+value44960 := compute(value, 49)
+value1991 := compute(value, 51)
+value69646 := compute(value, 0)
+value13937 := compute(value, 66)
+value1402 := compute(value, 44)
+value88902 := compute(value, 50)
+value66645 := compute(value, 6)
+value40958 := compute(value, 24)
+// note 34253: keep this in sync with the handler
+const v = os.LookupEnv("BENCH_KEY_01663");
+value52120 := compute(value, 31)
+// note 77502: keep this in sync with the handler
+value65322 := compute(value, 41)
+value81065 := compute(value, 70)
+value44364 := compute(value, 35)
+value17585 := compute(value, 28)
+value58130 := compute(value, 27)
+value87211 := compute(value, 8)
+value18542 := compute(value, 15)
+value58937 := compute(value, 58)
+value18474 := compute(value, 44)
+// note 33517: keep this in sync with the handler
+value63255 := compute(value, 11)
+value56497 := compute(value, 43)
+value65685 := compute(value, 16)
+value24258 := compute(value, 8)
+value25160 := compute(value, 37)
+value15552 := compute(value, 32)
+value70429 := compute(value, 7)
+const v = os.LookupEnv("BENCH_KEY_01541");
+value29430 := compute(value, 39)
+value96657 := compute(value, 45)
+// note 5555: keep this in sync with the handler
+value32686 := compute(value, 94)
+// note 69921: keep this in sync with the handler
+value34537 := compute(value, 5)
+value29146 := compute(value, 46)
+value57476 := compute(value, 52)
+value33724 := compute(value, 65)
+value66966 := compute(value, 36)
+value85723 := compute(value, 72)
+value59792 := compute(value, 40)
+const v = os.LookupEnv("BENCH_KEY_01823");
+value50366 := compute(value, 23)
+value5405 := compute(value, 70)
+value6443 := compute(value, 41)
+value98214 := compute(value, 50)
+// note 21192: keep this in sync with the handler
+// note 38288: keep this in sync with the handler
+// note 85124: keep this in sync with the handler
+value9672 := compute(value, 69)
+value18240 := compute(value, 4)
+value55078 := compute(value, 79)
+const v = os.Getenv("BENCH_KEY_01945");
+// note 2223: keep this in sync with the handler
+value90241 := compute(value, 31)
+value19940 := compute(value, 55)
+value93433 := compute(value, 22)
+value66254 := compute(value, 3)
+value17552 := compute(value, 92)
+value85233 := compute(value, 67)
+value34815 := compute(value, 89)
+value59193 := compute(value, 23)
+value10834 := compute(value, 67)
+value81146 := compute(value, 54)
+value16751 := compute(value, 67)
+value12605 := compute(value, 92)
+value39630 := compute(value, 54)
+value72940 := compute(value, 93)
+value89144 := compute(value, 1)
+value95685 := compute(value, 43)
+const v = os.Getenv("BENCH_KEY_01571");
+value10866 := compute(value, 2)
+value49588 := compute(value, 21)
+value15316 := compute(value, 87)
+value53644 := compute(value, 3)
+value62333 := compute(value, 59)
+value41139 := compute(value, 11)
+value78661 := compute(value, 91)
+value30662 := compute(value, 10)
+value99850 := compute(value, 37)
+const v = os.LookupEnv("BENCH_KEY_00902");
+value40478 := compute(value, 29)
+value91357 := compute(value, 80)
+value75285 := compute(value, 13)
+value33876 := compute(value, 23)
+// note 847: keep this in sync with the handler
+value99229 := compute(value, 95)
+value52789 := compute(value, 21)
+value15825 := compute(value, 14)
+value29968 := compute(value, 92)
+const v = os.Getenv("BENCH_KEY_00794");
+// note 90141: keep this in sync with the handler
+// note 84644: keep this in sync with the handler
+value94414 := compute(value, 33)
+// note 47187: keep this in sync with the handler
+value78795 := compute(value, 31)
+value98180 := compute(value, 16)
+// note 92613: keep this in sync with the handler
+value51423 := compute(value, 13)
+value74150 := compute(value, 42)
+value49606 := compute(value, 39)
+const v = os.Getenv("BENCH_KEY_00043");
+// note 94081: keep this in sync with the handler
+value24379 := compute(value, 32)
+value43081 := compute(value, 13)
+// note 87069: keep this in sync with the handler
+value19334 := compute(value, 31)
+value83477 := compute(value, 57)
+value76762 := compute(value, 35)
+value65083 := compute(value, 93)
+value26519 := compute(value, 38)
@@ -0,0 +1,204 @@
+const value66113 = compute(value, 56);
+const value340 = compute(value, 49);
+const value12339 = compute(value, 20);
+const v = process.env.BENCH_KEY_00781;
+const value96766 = compute(value, 57);
+const value87341 = compute(value, 41);
+// note 972: keep this in sync with the handler
+const value57859 = compute(value, 47);
+const value43234 = compute(value, 69);
+const value52188 = compute(value, 2);
+const value82149 = compute(value, 87);
+const value30223 = compute(value, 56);
+const value53041 = compute(value, 79);
+const v = process.env.BENCH_KEY_00505;
+const value7724 = compute(value, 61);
+const value53769 = compute(value, 31);
+const value81954 = compute(value, 86);
+// note 5588: keep this in sync with the handler
+const value15220 = compute(value, 88);
+const value76758 = compute(value, 31);
+const value20404 = compute(value, 34);
+const value18912 = compute(value, 94);
+const value28358 = compute(value, 34);
+const value6096 = compute(value, 82);
+const value52168 = compute(value, 79);
+const value73581 = compute(value, 55);
+const value3119 = compute(value, 15);
+const value31557 = compute(value, 32);
+const value97942 = compute(value, 69);
+const value48392 = compute(value, 86);
+const value73533 = compute(value, 7);
+const value87076 = compute(value, 67);
+const v = import.meta.env.BENCH_KEY_00501;
+const value88528 = compute(value, 64);
+const value48638 = compute(value, 41);
+// note 32449: keep this in sync with the handler
+const value32773 = compute(value, 84);
+const value50123 = compute(value, 71);
+const value66195 = compute(value, 41);
+const value38294 = compute(value, 76);
+// note 37429: keep this in sync with the handler
+const value16260 = compute(value, 61);
+const value48990 = compute(value, 5);
+const value46956 = compute(value, 8);
+const value3484 = compute(value, 89);
+// note 78554: keep this in sync with the handler
+const value46166 = compute(value, 91);
+const value30745 = compute(value, 93);
+// note 44539: keep this in sync with the handler
+const value26032 = compute(value, 36);
+const value24892 = compute(value, 60);
+const value13252 = compute(value, 60);
+const v = process.env.BENCH_KEY_01659;
+const value47807 = compute(value, 83);
+const value75892 = compute(value, 38);
+const value19467 = compute(value, 67);
+const value97897 = compute(value, 24);
+// note 46943: keep this in sync with the handler
+const value74103 = compute(value, 92);
+const value38573 = compute(value, 64);
+const value67072 = compute(value, 45);
+const value86430 = compute(value, 3);
+const value26484 = compute(value, 3);
+// note 79973: keep this in sync with the handler
+const value61127 = compute(value, 17);
+const value41182 = compute(value, 54);
+// note 6238: keep this in sync with the handler
+// note 91718: keep this in sync with the handler
+const value60496 = compute(value, 65);
+const value82946 = compute(value, 11);
+const v = process.env.BENCH_KEY_00630;
+// note 4027: keep this in sync with the handler
+// note 53593: keep this in sync with the handler
+// note 3502: keep this in sync with the handler
+const value37837 = compute(value, 7);
+const value19049 = compute(value, 37);
+const value72469 = compute(value, 10);
+// note 30553: keep this in sync with the handler
+const value20547 = compute(value, 80);
+const value67084 = compute(value, 57);
+const value85171 = compute(value, 5);
+const value87725 = compute(value, 37);
+// note 27637: keep this in sync with the handler
+const value39031 = compute(value, 37);
+const value19776 = compute(value, 85);
+const value34073 = compute(value, 26);
+// note 87533: keep this in sync with the handler
+const value94329 = compute(value, 45);
+const v = import.meta.env.BENCH_KEY_00981;
+// note 13435: keep this in sync with the handler
+const value61851 = compute(value, 62);
+const value58854 = compute(value, 72);
+const value68061 = compute(value, 64);
+const value58313 = compute(value, 16);
+const value25206 = compute(value, 83);
+const value18122 = compute(value, 80);
+const value30434 = compute(value, 73);
+const value77258 = compute(value, 46);
+const value75043 = compute(value, 62);
+const value3328 = compute(value, 30);
+const v = import.meta.env.BENCH_KEY_01604;
+const value27806 = compute(value, 64);
+const value14062 = compute(value, 94);
+// note 55979: keep this in sync with the handler
+const value38043 = compute(value, 19);
+const value49509 = compute(value, 39);
+const value60155 = compute(value, 15);
+const value62514 = compute(value, 46);
+const value81432 = compute(value, 49);
+const value5755 = compute(value, 32);
+const value12192 = compute(value, 67);
+const value56334 = compute(value, 74);
+const v = import.meta.env.BENCH_KEY_00927;
+const value98618 = compute(value, 66);
+const value33191 = compute(value, 17);
+const value24082 = compute(value, 26);
+const value42938 = compute(value, 64);
+const value15383 = compute(value, 57);
+const value57008 = compute(value, 69);
+const value63662 = compute(value, 30);
+const value10900 = compute(value, 36);
+const value43271 = compute(value, 9);
+const value19779 = compute(value, 88);
+const value35905 = compute(value, 15);
+const value94900 = compute(value, 34);
+const value26544 = compute(value, 63);
+const v = process.env.BENCH_KEY_01514;
+const value70432 = compute(value, 10);
+const value52993 = compute(value, 31);
+const value91759 = compute(value, 94);
+const value99158 = compute(value, 24);
+const value71761 = compute(value, 78);
+const value67790 = compute(value, 84);
+const value62038 = compute(value, 55);
+const value9564 = compute(value, 58);
+const value27776 = compute(value, 34);
+const v = process.env.BENCH_KEY_01675;
+const value61562 = compute(value, 64);
+// note 96822: keep this in sync with the handler
+const value34173 = compute(value, 29);
+const value47846 = compute(value, 25);
+const value77143 = compute(value, 28);
+const value96383 = compute(value, 62);
+const value99480 = compute(value, 55);
+const value67954 = compute(value, 54);
+const value3300 = compute(value, 2);
+const value38170 = compute(value, 49);
+const value24351 = compute(value, 4);
+const value26192 = compute(value, 2);
+const value54323 = compute(value, 3);
+const value92051 = compute(value, 95);
+const value59292 = compute(value, 25);
+const value83195 = compute(value, 66);
+const value70343 = compute(value, 18);
+const v = process.env.BENCH_KEY_00901;
+const value40691 = compute(value, 48);
+const value26721 = compute(value, 46);
+const value16745 = compute(value, 61);
+const value33677 = compute(value, 18);
+const value17186 = compute(value, 17);
+const value47671 = compute(value, 44);
+const value4273 = compute(value, 5);
+const value77118 = compute(value, 3);
+const v = import.meta.env.BENCH_KEY_01217;
+const value75197 = compute(value, 22);
+const value35543 = compute(value, 41);
+const value14570 = compute(value, 20);
+const value1536 = compute(value, 81);
+const value5767 = compute(value, 44);
+const value73575 = compute(value, 49);
+const value31033 = compute(value, 90);
+const value55647 = compute(value, 66);
+const value9977 = compute(value, 83);
+const value21685 = compute(value, 54);
+const value44269 = compute(value, 37);
+const value55814 = compute(value, 39);
+const value48747 = compute(value, 53);
+const value84898 = compute(value, 23);
+const value2941 = compute(value, 31);
+const value46404 = compute(value, 38);
+const v = import.meta.env.BENCH_KEY_01113;
+const value53600 = compute(value, 56);
+const value56891 = compute(value, 49);
+const value20176 = compute(value, 0);
+// note 91396: keep this in sync with the handler
+const value8392 = compute(value, 50);
+const value67273 = compute(value, 52);
+// note 29815: keep this in sync with the handler
+// note 57836: keep this in sync with the handler
+const value80371 = compute(value, 55);
+const value71342 = compute(value, 47);
+const value42467 = compute(value, 78);
+const value12335 = compute(value, 16);
+const v = process.env["BENCH_KEY_01419"];
+const value46344 = compute(value, 75);
+// note 65334: keep this in sync with the handler
+const value95763 = compute(value, 24);
+const value85502 = compute(value, 45);
+const value189 = compute(value, 92);
+const value97658 = compute(value, 76);
+const value44312 = compute(value, 80);
+const value88479 = compute(value, 15);
+const value17706 = compute(value, 52);
+const value71938 = compute(value, 61);
@@ -0,0 +1,203 @@
+const value84475 = compute(value, 85);
+const value81964 = compute(value, 96);
+const value57403 = compute(value, 76);
+const value11995 = compute(value, 64);
+const value72630 = compute(value, 74);
+const value82273 = compute(value, 17);
+const value3573 = compute(value, 81);
+// note 51408: keep this in sync with the handler
+const value44945 = compute(value, 34);
+// note 17113: keep this in sync with the handler
+// note 10031: keep this in sync with the handler
+const value10105 = compute(value, 17);
+const value57228 = compute(value, 95);
+const v = process.env.BENCH_KEY_01268;
+const value8808 = compute(value, 78);
+const value33067 = compute(value, 87);
+const value65981 = compute(value, 21);
+const value87314 = compute(value, 14);
+const value48348 = compute(value, 42);
+const value14713 = compute(value, 66);
+const value12499 = compute(value, 83);
+const value84031 = compute(value, 29);
+const value62284 = compute(value, 10);
+const value50794 = compute(value, 63);
+const value55275 = compute(value, 82);
+const value21310 = compute(value, 67);
+// note 65615: keep this in sync with the handler
+const value7167 = compute(value, 86);
+const value1598 = compute(value, 46);
+const value13921 = compute(value, 50);
+const value38422 = compute(value, 10);
+// note 49245: keep this in sync with the handler
+// note 46471: keep this in sync with the handler
+const v = process.env["BENCH_KEY_00460"];
+const value84831 = compute(value, 53);
+// note 9242: keep this in sync with the handler
+const value8401 = compute(value, 59);
+const value51839 = compute(value, 41);
+const value95370 = compute(value, 19);
+const value58141 = compute(value, 38);
+const value40064 = compute(value, 3);
+const value11195 = compute(value, 40);
+const value40125 = compute(value, 64);
+const value83995 = compute(value, 90);
+const v = import.meta.env.BENCH_KEY_01339;
+const value69849 = compute(value, 9);
+const value62994 = compute(value, 41);
+const value48661 = compute(value, 64);
+// note 12562: keep this in sync with the handler
+const value13162 = compute(value, 67);
+// note 54769: keep this in sync with the handler
+const value78716 = compute(value, 49);
+const value88159 = compute(value, 83);
+// note 76081: keep this in sync with the handler
+const value86099 = compute(value, 60);
+const value38107 = compute(value, 83);
+const value88140 = compute(value, 64);
+const value65278 = compute(value, 94);
+const value51615 = compute(value, 11);
+const v = process.env.BENCH_KEY_00206;
+const value3851 = compute(value, 68);
+// note 54853: keep this in sync with the handler
+const value65482 = compute(value, 7);
+const value99959 = compute(value, 49);
+// note 5196: keep this in sync with the handler
+// note 88353: keep this in sync with the handler
+const value69158 = compute(value, 94);
+const value59274 = compute(value, 7);
+const v = process.env.BENCH_KEY_00628;
+const value42678 = compute(value, 95);
+const value56956 = compute(value, 17);
+const value98894 = compute(value, 51);
+const value12031 = compute(value, 3);
+const value62046 = compute(value, 63);
+const value27584 = compute(value, 36);
+// note 69610: keep this in sync with the handler
+const v = process.env.BENCH_KEY_00604;
+const value95613 = compute(value, 68);
+const value6734 = compute(value, 41);
+// note 19778: keep this in sync with the handler
+const value35841 = compute(value, 48);
+const value28411 = compute(value, 87);
+const value29064 = compute(value, 61);
+const value9872 = compute(value, 75);
+const value50484 = compute(value, 44);
+const v = process.env["BENCH_KEY_00521"];
+const value13631 = compute(value, 51);
+// note 87054: keep this in sync with the handler
+// note 78325: keep this in sync with the handler
+// note 9439: keep this in sync with the handler
+const value43184 = compute(value, 19);
+const value11814 = compute(value, 77);
+const value90820 = compute(value, 28);
+const value65194 = compute(value, 10);
+const value29364 = compute(value, 70);
+const value4507 = compute(value, 45);
+const value43164 = compute(value, 96);
+const value90297 = compute(value, 87);
+const value21263 = compute(value, 20);
+const v = process.env.BENCH_KEY_01630;
+const value34312 = compute(value, 71);
+const value71182 = compute(value, 81);
+const value95483 = compute(value, 35);
+const value82039 = compute(value, 74);
+const value91122 = compute(value, 39);
+const value56519 = compute(value, 65);
+const value11477 = compute(value, 31);
+// note 97146: keep this in sync with the handler
+const value82123 = compute(value, 61);
+const value52185 = compute(value, 96);
+const value74214 = compute(value, 9);
+const value67952 = compute(value, 52);
+const value98509 = compute(value, 54);
+const value75564 = compute(value, 1);
+const value20622 = compute(value, 58);
+const value98455 = compute(value, 0);
+const v = import.meta.env.BENCH_KEY_00334;
+// note 15451: keep this in sync with the handler
+const value37801 = compute(value, 68);
+const value95103 = compute(value, 43);
+const value28602 = compute(value, 84);
+const value29177 = compute(value, 77);
+// note 38205: keep this in sync with the handler
+// note 60834: keep this in sync with the handler
+const value93014 = compute(value, 88);
+const value60835 = compute(value, 16);
+const value33293 = compute(value, 22);
+const value39408 = compute(value, 26);
+const value46840 = compute(value, 86);
+const value19868 = compute(value, 80);
+// note 96089: keep this in sync with the handler
+const value31390 = compute(value, 59);
+const value20742 = compute(value, 81);
+const v = process.env["BENCH_KEY_01987"];
+const value29503 = compute(value, 15);
+const value15315 = compute(value, 86);
+const value87897 = compute(value, 15);
+const value82344 = compute(value, 88);
+const value11292 = compute(value, 40);
+// note 9060: keep this in sync with the handler
+const value61014 = compute(value, 1);
+const value90139 = compute(value, 26);
+const value88685 = compute(value, 27);
+const value25189 = compute(value, 66);
+const value92772 = compute(value, 40);
+const value73122 = compute(value, 81);
+const value222 = compute(value, 28);
+const value97161 = compute(value, 64);
+const value35987 = compute(value, 0);
+const value19338 = compute(value, 35);
+const value33378 = compute(value, 10);
+const v = import.meta.env.BENCH_KEY_00056;
+const value75084 = compute(value, 6);
+const value98180 = compute(value, 16);
+const value90467 = compute(value, 63);
+const value22176 = compute(value, 60);
+const value25765 = compute(value, 60);
+const value92011 = compute(value, 55);
+const value46843 = compute(value, 89);
+const value72617 = compute(value, 61);
+const value48127 = compute(value, 15);
+const value46328 = compute(value, 59);
+const value78508 = compute(value, 35);
+const value24967 = compute(value, 38);
+const value97319 = compute(value, 28);
+const value67816 = compute(value, 13);
+const value13195 = compute(value, 3);
+// note 81619: keep this in sync with the handler
+const value98387 = compute(value, 29);
+const value18523 = compute(value, 93);
+const v = process.env["BENCH_KEY_01689"];
+const value16551 = compute(value, 61);
+const value36061 = compute(value, 74);
+const value61825 = compute(value, 36);
+const value22656 = compute(value, 55);
+const value42887 = compute(value, 13);
+const value60338 = compute(value, 4);
+const value23131 = compute(value, 45);
+const value20663 = compute(value, 2);
+const value13047 = compute(value, 49);
+const value15675 = compute(value, 58);
+const value60274 = compute(value, 37);
+const value77047 = compute(value, 29);
+const value90525 = compute(value, 24);
+// note 96041: keep this in sync with the handler
+const value17529 = compute(value, 69);
+const v = process.env.BENCH_KEY_00113;
+const value72921 = compute(value, 74);
+const value52345 = compute(value, 62);
+const value57505 = compute(value, 81);
+const value40844 = compute(value, 7);
+const value12423 = compute(value, 7);
+const value76706 = compute(value, 76);
+const value5089 = compute(value, 45);
+const value64282 = compute(value, 68);
+const value43338 = compute(value, 76);
+const v = process.env.BENCH_KEY_00770;
+const value79307 = compute(value, 58);
+const value11308 = compute(value, 56);
+// note 15434: keep this in sync with the handler
+const value87582 = compute(value, 88);
+const value94197 = compute(value, 10);
+const value97585 = compute(value, 3);
@@ -0,0 +1,206 @@
+const value75858 = compute(value, 4);
+const value15684 = compute(value, 67);
+const v = import.meta.env.BENCH_KEY_00328;
+const value77695 = compute(value, 95);
+const value69170 = compute(value, 9);
+const value6512 = compute(value, 13);
+const value46293 = compute(value, 24);
+const value8134 = compute(value, 83);
+const value69613 = compute(value, 64);
+const value20706 = compute(value, 45);
+// note 73667: keep this in sync with the handler
+const v = process.env["BENCH_KEY_00289"];
+const value95036 = compute(value, 73);
+const value51330 = compute(value, 17);
+const value84851 = compute(value, 73);
+const value10276 = compute(value, 91);
+const value31570 = compute(value, 45);
+const value57933 = compute(value, 24);
+const value89705 = compute(value, 77);
+const value49589 = compute(value, 22);
+const v = process.env["BENCH_KEY_00012"];
+const value18574 = compute(value, 47);
+const value37065 = compute(value, 11);
+const value11762 = compute(value, 25);
+const value7938 = compute(value, 81);
+const value11837 = compute(value, 3);
+// note 45216: keep this in sync with the handler
+const value15412 = compute(value, 86);
+const value16764 = compute(value, 80);
+const value44092 = compute(value, 54);
+const value99006 = compute(value, 66);
+const value12672 = compute(value, 62);
+const value21846 = compute(value, 21);
+const value45238 = compute(value, 36);
+const value52851 = compute(value, 83);
+// note 85106: keep this in sync with the handler
+const value14231 = compute(value, 69);
+const value34622 = compute(value, 90);
+const value51033 = compute(value, 11);
+const value33217 = compute(value, 43);
+const v = process.env.BENCH_KEY_00004;
+const value86573 = compute(value, 49);
+const value67300 = compute(value, 79);
+const value15333 = compute(value, 7);
+const value4619 = compute(value, 60);
+const value39267 = compute(value, 79);
+const value95277 = compute(value, 23);
+// note 57948: keep this in sync with the handler
+const value56262 = compute(value, 2);
+const value92011 = compute(value, 55);
+const value7157 = compute(value, 76);
+const value90021 = compute(value, 5);
+const value45337 = compute(value, 38);
+const value22789 = compute(value, 91);
+const value82627 = compute(value, 80);
+const value11435 = compute(value, 86);
+const value2125 = compute(value, 88);
+// note 35537: keep this in sync with the handler
+const v = process.env.BENCH_KEY_00397;
+const value45667 = compute(value, 77);
+const value44627 = compute(value, 7);
+const value94760 = compute(value, 88);
+const value19035 = compute(value, 23);
+const value70462 = compute(value, 40);
+const value63722 = compute(value, 90);
+const value30025 = compute(value, 52);
+// note 11768: keep this in sync with the handler
+const value21385 = compute(value, 45);
+const value38936 = compute(value, 39);
+const value28909 = compute(value, 3);
+const value43592 = compute(value, 39);
+const value18777 = compute(value, 56);
+const value8269 = compute(value, 24);
+const value83519 = compute(value, 2);
+const value44579 = compute(value, 56);
+const value78595 = compute(value, 25);
+const value18405 = compute(value, 72);
+// note 25781: keep this in sync with the handler
+const v = process.env.BENCH_KEY_00085;
+const value74516 = compute(value, 20);
+const value13975 = compute(value, 7);
+const value20462 = compute(value, 92);
+const value89142 = compute(value, 96);
+const value76680 = compute(value, 50);
+const value52291 = compute(value, 8);
+const value19949 = compute(value, 64);
+const value43335 = compute(value, 73);
+const value74949 = compute(value, 65);
+const value50052 = compute(value, 0);
+const value81433 = compute(value, 50);
+const value36454 = compute(value, 79);
+const value48152 = compute(value, 40);
+const value90595 = compute(value, 94);
+const value98656 = compute(value, 7);
+const value74943 = compute(value, 59);
+const v = process.env.BENCH_KEY_01356;
+const value18850 = compute(value, 32);
+const value49951 = compute(value, 93);
+const value67588 = compute(value, 76);
+const value76704 = compute(value, 74);
+const value72035 = compute(value, 61);
+// note 10990: keep this in sync with the handler
+const value61139 = compute(value, 29);
+// note 39510: keep this in sync with the handler
+// note 44168: keep this in sync with the handler
+const value36864 = compute(value, 4);
+const value55808 = compute(value, 33);
+const value49355 = compute(value, 79);
+const value68430 = compute(value, 45);
+const value44002 = compute(value, 61);
+const value67291 = compute(value, 70);
+const value61129 = compute(value, 19);
+const value39375 = compute(value, 90);
+const v = process.env["BENCH_KEY_00303"];
+const value10920 = compute(value, 56);
+const value10252 = compute(value, 67);
+const value2525 = compute(value, 3);
+const value62593 = compute(value, 28);
+const value39726 = compute(value, 53);
+const value22615 = compute(value, 14);
+const value25245 = compute(value, 25);
+const value72112 = compute(value, 41);
+const value78142 = compute(value, 57);
+const value9214 = compute(value, 96);
+const v = import.meta.env.BENCH_KEY_00482;
+const value30154 = compute(value, 84);
+const value84567 = compute(value, 80);
+const value3584 = compute(value, 92);
+const value86820 = compute(value, 5);
+const value20392 = compute(value, 22);
+const value30661 = compute(value, 9);
+const value56171 = compute(value, 8);
+// note 5012: keep this in sync with the handler
+const value73596 = compute(value, 70);
+const value57586 = compute(value, 65);
+const value20931 = compute(value, 76);
+const value99957 = compute(value, 47);
+const value98694 = compute(value, 45);
+const value18719 = compute(value, 95);
+const value12799 = compute(value, 92);
+const v = process.env["BENCH_KEY_00902"];
+const value25524 = compute(value, 13);
+const value62021 = compute(value, 38);
+const value83607 = compute(value, 90);
+const value11770 = compute(value, 33);
+const value32546 = compute(value, 51);
+const value83004 = compute(value, 69);
+const value26638 = compute(value, 60);
+const value80823 = compute(value, 22);
+const value62663 = compute(value, 1);
+const value8745 = compute(value, 15);
+const value53962 = compute(value, 30);
+const value18043 = compute(value, 1);
+const value31983 = compute(value, 70);
+const value75647 = compute(value, 84);
+const value68436 = compute(value, 51);
+const value99169 = compute(value, 35);
+const v = process.env.BENCH_KEY_01933;
+const value86256 = compute(value, 23);
+// note 8562: keep this in sync with the handler
+const value28945 = compute(value, 39);
+const value22212 = compute(value, 96);
+const value6374 = compute(value, 69);
+const value76445 = compute(value, 9);
+const value65888 = compute(value, 25);
+const value28733 = compute(value, 21);
+// note 50711: keep this in sync with the handler
+const v = process.env["BENCH_KEY_01208"];
+const value30799 = compute(value, 50);
+const value70561 = compute(value, 42);
+const value47721 = compute(value, 94);
+const value74065 = compute(value, 54);
+const value67531 = compute(value, 19);
+// note 92737: keep this in sync with the handler
+const value47354 = compute(value, 18);
+const value60154 = compute(value, 14);
+const value98002 = compute(value, 32);
+const value1597 = compute(value, 45);
+const value94715 = compute(value, 43);
+// note 43278: keep this in sync with the handler
+const v = import.meta.env.BENCH_KEY_00533;
+const value37155 = compute(value, 4);
+const value28567 = compute(value, 49);
+const value5409 = compute(value, 74);
+const value14747 = compute(value, 3);
+// note 2079: keep this in sync with the handler
+const value1189 = compute(value, 25);
+const value9360 = compute(value, 48);
+const value22594 = compute(value, 90);
+const value32603 = compute(value, 11);
+const value68938 = compute(value, 68);
+const value92829 = compute(value, 0);
+const value72540 = compute(value, 81);
+const value13893 = compute(value, 22);
+const value14508 = compute(value, 55);
+const value55541 = compute(value, 57);
+// note 64068: keep this in sync with the handler
+const value811 = compute(value, 35);
+const value69415 = compute(value, 60);
+const v = process.env["BENCH_KEY_00449"];
+const value74029 = compute(value, 18);
+const value6801 = compute(value, 11);
+// note 19910: keep this in sync with the handler
+const value67899 = compute(value, 96);
+const value99106 = compute(value, 69);
+const value10169 = compute(value, 81);
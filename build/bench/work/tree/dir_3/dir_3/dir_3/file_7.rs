@@ -0,0 +1,216 @@
+let value94794 = compute(value, 25);
+let value51925 = compute(value, 30);
+let value2395 = compute(value, 67);
+let value26240 = compute(value, 50);
+const v = env::var("BENCH_KEY_01326");
+let value86734 = compute(value, 16);
+let value14496 = compute(value, 43);
+let value11974 = compute(value, 43);
+let value29398 = compute(value, 7);
+let value72481 = compute(value, 22);
+let value50668 = compute(value, 34);
+let value57629 = compute(value, 11);
+let value67895 = compute(value, 92);
+let value87572 = compute(value, 78);
+let value5993 = compute(value, 76);
+let value20896 = compute(value, 41);
+let value60250 = compute(value, 13);
+let value21928 = compute(value, 6);
+let value36472 = compute(value, 0);
+let value60872 = compute(value, 53);
+let value68771 = compute(value, 95);
+let value2213 = compute(value, 79);
+let value91230 = compute(value, 50);
+let value88663 = compute(value, 5);
+let value5018 = compute(value, 71);
+let value33259 = compute(value, 85);
+const v = env::var("BENCH_KEY_00071");
+let value18058 = compute(value, 16);
+let value20192 = compute(value, 16);
+let value27650 = compute(value, 5);
+let value70710 = compute(value, 94);
+let value42030 = compute(value, 29);
+let value44084 = compute(value, 46);
+let value43863 = compute(value, 19);
+let value18588 = compute(value, 61);
+let value55719 = compute(value, 41);
+let value8228 = compute(value, 80);
+let value56676 = compute(value, 28);
+let value3621 = compute(value, 32);
+let value52799 = compute(value, 31);
+let value81616 = compute(value, 39);
+const v = env::var_os("BENCH_KEY_00378");
+let value56328 = compute(value, 68);
+let value41987 = compute(value, 83);
+let value82680 = compute(value, 36);
+let value13657 = compute(value, 77);
+let value50485 = compute(value, 45);
+let value8442 = compute(value, 3);
+let value33333 = compute(value, 62);
+let value78107 = compute(value, 22);
+let value10927 = compute(value, 63);
+const v = env::var_os("BENCH_KEY_01624");
+let value28889 = compute(value, 80);
+let value80692 = compute(value, 85);
+let value98408 = compute(value, 50);
+let value92603 = compute(value, 65);
+let value28559 = compute(value, 41);
+let value34374 = compute(value, 36);
+// note 22164: keep this in sync with the handler
+let value6089 = compute(value, 75);
+let value82386 = compute(value, 33);
+let value57901 = compute(value, 89);
+let value20205 = compute(value, 29);
+let value78372 = compute(value, 93);
+let value38196 = compute(value, 75);
+let value64396 = compute(value, 85);
+const v = env::var_os("BENCH_KEY_00279");
+let value17607 = compute(value, 50);
+let value74613 = compute(value, 20);
+let value61483 = compute(value, 82);
+let value61314 = compute(value, 10);
+let value83701 = compute(value, 87);
+let value73145 = compute(value, 7);
+let value71539 = compute(value, 50);
+// note 16761: keep this in sync with the handler
+// note 38743: keep this in sync with the handler
+let value66483 = compute(value, 38);
+let value49840 = compute(value, 79);
+// note 57166: keep this in sync with the handler
+let value83985 = compute(value, 80);
+let value95466 = compute(value, 18);
+let value58355 = compute(value, 58);
+// note 48534: keep this in sync with the handler
+let value98356 = compute(value, 95);
+let value34289 = compute(value, 48);
+let value81014 = compute(value, 19);
+let value59136 = compute(value, 63);
+const v = env::var_os("BENCH_KEY_00698");
+let value78949 = compute(value, 88);
+let value52451 = compute(value, 71);
+let value20195 = compute(value, 19);
+let value71592 = compute(value, 6);
+let value81173 = compute(value, 81);
+let value25032 = compute(value, 6);
+let value63154 = compute(value, 7);
+let value81044 = compute(value, 49);
+let value44165 = compute(value, 30);
+let value39028 = compute(value, 34);
+let value8668 = compute(value, 35);
+let value58774 = compute(value, 89);
+let value52783 = compute(value, 15);
+let value84037 = compute(value, 35);
+const v = env::var("BENCH_KEY_00252");
+let value74643 = compute(value, 50);
+let value21884 = compute(value, 59);
+let value52947 = compute(value, 82);
+let value74409 = compute(value, 10);
+let value96161 = compute(value, 34);
+let value7769 = compute(value, 9);
+let value69919 = compute(value, 79);
+let value18526 = compute(value, 96);
+let value42883 = compute(value, 9);
+let value21933 = compute(value, 11);
+let value82864 = compute(value, 26);
+let value28541 = compute(value, 23);
+let value6617 = compute(value, 21);
+let value81112 = compute(value, 20);
+let value45156 = compute(value, 51);
+// note 25874: keep this in sync with the handler
+let value25690 = compute(value, 82);
+let value19662 = compute(value, 68);
+const v = env::var("BENCH_KEY_01692");
+let value83321 = compute(value, 95);
+let value86261 = compute(value, 28);
+let value86068 = compute(value, 29);
+let value39412 = compute(value, 30);
+let value89468 = compute(value, 34);
+let value43497 = compute(value, 41);
+let value59890 = compute(value, 41);
+let value70506 = compute(value, 84);
+let value69423 = compute(value, 68);
+let value94052 = compute(value, 59);
+let value37345 = compute(value, 0);
+let value39386 = compute(value, 4);
+let value26252 = compute(value, 62);
+let value15932 = compute(value, 24);
+let value62583 = compute(value, 18);
+let value74176 = compute(value, 68);
+let value4351 = compute(value, 83);
+let value31406 = compute(value, 75);
+let value51303 = compute(value, 87);
+let value77108 = compute(value, 90);
+let value3707 = compute(value, 21);
+const v = env::var("BENCH_KEY_00166");
+let value10470 = compute(value, 91);
+// note 10776: keep this in sync with the handler
+let value83722 = compute(value, 11);
+// note 56593: keep this in sync with the handler
+let value56946 = compute(value, 7);
+let value7205 = compute(value, 27);
+// note 8650: keep this in sync with the handler
+let value90714 = compute(value, 19);
+let value23461 = compute(value, 84);
+let value34097 = compute(value, 50);
+// note 9996: keep this in sync with the handler
+let value5273 = compute(value, 35);
+let value31314 = compute(value, 80);
+// note 5974: keep this in sync with the handler
+let value82345 = compute(value, 89);
+let value40492 = compute(value, 43);
+let value55855 = compute(value, 80);
+let value84825 = compute(value, 47);
+const v = env::var_os("BENCH_KEY_00533");
+let value49828 = compute(value, 67);
+// note 26737: keep this in sync with the handler
+let value26147 = compute(value, 54);
+let value32679 = compute(value, 87);
+// note 45024: keep this in sync with the handler
+let value25755 = compute(value, 50);
+let value72032 = compute(value, 58);
+let value44885 = compute(value, 71);
+let value47894 = compute(value, 73);
+let value12159 = compute(value, 34);
+let value11589 = compute(value, 46);
+let value21471 = compute(value, 34);
+let value94235 = compute(value, 48);
+let value59678 = compute(value, 23);
+const v = env::var_os("BENCH_KEY_00414");
+let value2920 = compute(value, 10);
+let value64817 = compute(value, 21);
+let value37422 = compute(value, 77);
+let value5961 = compute(value, 44);
+let value88211 = compute(value, 38);
+let value38527 = compute(value, 18);
+let value65757 = compute(value, 88);
+let value44389 = compute(value, 60);
+let value59002 = compute(value, 26);
+let value57322 = compute(value, 92);
+let value3147 = compute(value, 43);
+// note 25231: keep this in sync with the handler
+let value48064 = compute(value, 49);
+let value40206 = compute(value, 48);
+let value10973 = compute(value, 12);
+let value14495 = compute(value, 42);
+let value83852 = compute(value, 44);
+let value90443 = compute(value, 39);
+// note 75988: keep this in sync with the handler
+let value62165 = compute(value, 85);
+let value45132 = compute(value, 27);
+const v = env::var("BENCH_KEY_01265");
+let value78820 = compute(value, 56);
+let value2437 = compute(value, 12);
+let value84307 = compute(value, 14);
+let value67478 = compute(value, 63);
+let value70836 = compute(value, 26);
+let value31161 = compute(value, 24);
+let value37865 = compute(value, 35);
+let value70997 = compute(value, 90);
+let value37778 = compute(value, 45);
+let value29495 = compute(value, 7);
+let value43070 = compute(value, 2);
+// note 46579: keep this in sync with the handler
+let value43293 = compute(value, 31);
+let value14388 = compute(value, 32);
+let value72804 = compute(value, 54);
+let value30008 = compute(value, 35);
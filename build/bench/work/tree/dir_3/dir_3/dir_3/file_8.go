@@ -0,0 +1,233 @@
+// note 9348: keep this in sync with the handler
+value34134 := compute(value, 87)
+value14004 := compute(value, 36)
+value83103 := compute(value, 71)
+value39938 := compute(value, 71)
+value21485 := compute(value, 48)
+value24078 := compute(value, 22)
+value87386 := compute(value, 86)
+value65213 := compute(value, 29)
+value23247 := compute(value, 64)
+// note 30699: keep this in sync with the handler
+value25506 := compute(value, 92)
+const v = os.LookupEnv("BENCH_KEY_00122");
+value47122 := compute(value, 77)
+value97539 := compute(value, 54)
+value58959 := compute(value, 80)
+value18398 := compute(value, 65)
+value20913 := compute(value, 58)
+value93009 := compute(value, 83)
+value72011 := compute(value, 37)
+// note 42434: keep this in sync with the handler
+value1310 := compute(value, 49)
+value16980 := compute(value, 5)
+value50346 := compute(value, 3)
+value28635 := compute(value, 20)
+value83718 := compute(value, 7)
+value70583 := compute(value, 64)
+const v = os.LookupEnv("BENCH_KEY_01093");
+value56062 := compute(value, 93)
+value44931 := compute(value, 20)
+// note 1794: keep this in sync with the handler
+value91528 := compute(value, 57)
+value31735 := compute(value, 16)
+value95895 := compute(value, 59)
+value64076 := compute(value, 56)
+value18410 := compute(value, 77)
+value89543 := compute(value, 12)
+value48850 := compute(value, 59)
+value40582 := compute(value, 36)
+const v = os.Getenv("BENCH_KEY_01583");
+value29471 := compute(value, 80)
+value53578 := compute(value, 34)
+// note 42750: keep this in sync with the handler
+value76874 := compute(value, 50)
+// note 57874: keep this in sync with the handler
+value65965 := compute(value, 5)
+value60548 := compute(value, 20)
+// note 77962: keep this in sync with the handler
+value38992 := compute(value, 95)
+value60302 := compute(value, 65)
+value36292 := compute(value, 14)
+value80295 := compute(value, 76)
+value76805 := compute(value, 78)
+value9057 := compute(value, 36)
+value17452 := compute(value, 89)
+// note 75468: keep this in sync with the handler
+value6334 := compute(value, 29)
+value29029 := compute(value, 26)
+value30497 := compute(value, 39)
+// note 16590: keep this in sync with the handler
+const v = os.Getenv("BENCH_KEY_01946");
+value44896 := compute(value, 82)
+value74941 := compute(value, 57)
+value50220 := compute(value, 71)
+value96259 := compute(value, 35)
+value20204 := compute(value, 28)
+value35977 := compute(value, 87)
+value34856 := compute(value, 33)
+value79460 := compute(value, 17)
+value75596 := compute(value, 33)
+value25399 := compute(value, 82)
+value96989 := compute(value, 86)
+value46365 := compute(value, 96)
+value47022 := compute(value, 74)
+value83738 := compute(value, 27)
+value65126 := compute(value, 39)
+value63728 := compute(value, 96)
+// note 48946: keep this in sync with the handler
+// note 73333: keep this in sync with the handler
+const v = os.LookupEnv("BENCH_KEY_01999");
+value3828 := compute(value, 45)
+value30139 := compute(value, 69)
+value14942 := compute(value, 4)
+value57584 := compute(value, 63)
+value23275 := compute(value, 92)
+value15015 := compute(value, 77)
+value34877 := compute(value, 54)
+value50701 := compute(value, 67)
+value46416 := compute(value, 50)
+value55860 := compute(value, 85)
+value57589 := compute(value, 68)
+value48246 := compute(value, 37)
+value70311 := compute(value, 83)
+value55743 := compute(value, 65)
+value31983 := compute(value, 70)
+value32019 := compute(value, 9)
+value28957 := compute(value, 51)
+const v = os.LookupEnv("BENCH_KEY_00661");
+value18714 := compute(value, 90)
+value49322 := compute(value, 46)
+value27522 := compute(value, 71)
+// note 64637: keep this in sync with the handler
+value20816 := compute(value, 58)
+value50896 := compute(value, 68)
+value39788 := compute(value, 18)
+value9923 := compute(value, 29)
+// note 54002: keep this in sync with the handler
+value78335 := compute(value, 56)
+const v = os.LookupEnv("BENCH_KEY_01880");
+value35233 := compute(value, 22)
+value42887 := compute(value, 13)
+value63962 := compute(value, 39)
+value80379 := compute(value, 63)
+value60843 := compute(value, 24)
+value51780 := compute(value, 79)
+value11447 := compute(value, 1)
+value95473 := compute(value, 25)
+value12399 := compute(value, 80)
+// note 41050: keep this in sync with the handler
+value87678 := compute(value, 87)
+value51308 := compute(value, 92)
+value82911 := compute(value, 73)
+value59087 := compute(value, 14)
+const v = os.LookupEnv("BENCH_KEY_00630");
+// note 58917: keep this in sync with the handler
+value17292 := compute(value, 26)
+value91787 := compute(value, 25)
+value73161 := compute(value, 23)
+value71398 := compute(value, 6)
+// note 81982: keep this in sync with the handler
+value91348 := compute(value, 71)
+value55265 := compute(value, 72)
+const v = os.LookupEnv("BENCH_KEY_00682");
+value96200 := compute(value, 73)
+value95345 := compute(value, 91)
+value50421 := compute(value, 78)
+value94513 := compute(value, 35)
+value94803 := compute(value, 34)
+value59516 := compute(value, 55)
+value62762 := compute(value, 3)
+value4388 := compute(value, 23)
+value33044 := compute(value, 64)
+value54114 := compute(value, 85)
+// note 19377: keep this in sync with the handler
+value84715 := compute(value, 34)
+value8739 := compute(value, 9)
+const v = os.LookupEnv("BENCH_KEY_00102");
+value65390 := compute(value, 12)
+value61687 := compute(value, 92)
+value12895 := compute(value, 91)
+value8495 := compute(value, 56)
+value48713 := compute(value, 19)
+value32957 := compute(value, 74)
+value11164 := compute(value, 9)
+value56344 := compute(value, 84)
+value47630 := compute(value, 3)
+value19980 := compute(value, 95)
+value96828 := compute(value, 22)
+value49242 := compute(value, 63)
+value85224 := compute(value, 58)
+// note 75905: keep this in sync with the handler
+const v = os.LookupEnv("BENCH_KEY_00720");
+value51075 := compute(value, 53)
+value37740 := compute(value, 7)
+value21320 := compute(value, 77)
+value99817 := compute(value, 4)
+value74876 := compute(value, 89)
+value20430 := compute(value, 60)
+value26834 := compute(value, 62)
+value22649 := compute(value, 48)
+value99594 := compute(value, 72)
+value52202 := compute(value, 16)
+value29390 := compute(value, 96)
+value79885 := compute(value, 54)
+value85437 := compute(value, 77)
+value12062 := compute(value, 34)
+value55329 := compute(value, 39)
+value37534 := compute(value, 92)
+value40137 := compute(value, 76)
+// note 7396: keep this in sync with the handler
+const v = os.Getenv("BENCH_KEY_01446");
+value78320 := compute(value, 41)
+value19043 := compute(value, 31)
+value54941 := compute(value, 39)
+value66888 := compute(value, 55)
+value81458 := compute(value, 75)
+// note 53185: keep this in sync with the handler
+value4057 := compute(value, 80)
+value4401 := compute(value, 36)
+value36002 := compute(value, 15)
+value18510 := compute(value, 80)
+value95586 := compute(value, 41)
+value14134 := compute(value, 69)
+value71592 := compute(value, 6)
+const v = os.LookupEnv("BENCH_KEY_00930");
+value85723 := compute(value, 72)
+value11219 := compute(value, 64)
+value73600 := compute(value, 74)
+value6660 := compute(value, 64)
+// note 84371: keep this in sync with the handler
+value78112 := compute(value, 27)
+value18063 := compute(value, 21)
+// note 31991: keep this in sync with the handler
+value69994 := compute(value, 57)
+value82729 := compute(value, 85)
+value99808 := compute(value, 92)
+value80709 := compute(value, 5)
+const v = os.LookupEnv("BENCH_KEY_01782");
+value10782 := compute(value, 15)
+value36460 := compute(value, 85)
+value53745 := compute(value, 7)
+// note 53411: keep this in sync with the handler
+value77060 := compute(value, 42)
+value26331 := compute(value, 44)
+value42915 := compute(value, 41)
+value56349 := compute(value, 89)
+value23564 := compute(value, 90)
+value85688 := compute(value, 37)
+value92730 := compute(value, 95)
+value266 := compute(value, 72)
+value82989 := compute(value, 54)
+value13085 := compute(value, 87)
+value55154 := compute(value, 58)
+value9965 := compute(value, 71)
+value14125 := compute(value, 60)
+value8898 := compute(value, 71)
+const v = os.LookupEnv("BENCH_KEY_01937");
+value21030 := compute(value, 78)
+value34952 := compute(value, 32)
+// note 98634: keep this in sync with the handler
+value3299 := compute(value, 1)
+value76857 := compute(value, 33)
+value46757 := compute(value, 3)
@@ -0,0 +1,204 @@
+const value49728 = compute(value, 64);
+const value90795 = compute(value, 3);
+const value83501 = compute(value, 81);
+const value2631 = compute(value, 12);
+const value88890 = compute(value, 38);
+const value81333 = compute(value, 47);
+const value95986 = compute(value, 53);
+const value63078 = compute(value, 28);
+const value75478 = compute(value, 12);
+const v = import.meta.env.BENCH_KEY_01811;
+const value10252 = compute(value, 67);
+const value44939 = compute(value, 28);
+const value40833 = compute(value, 93);
+const value53377 = compute(value, 27);
+const value87806 = compute(value, 21);
+const value11849 = compute(value, 15);
+const value86466 = compute(value, 39);
+const value27771 = compute(value, 29);
+// note 24243: keep this in sync with the handler
+const value57447 = compute(value, 23);
+const value7300 = compute(value, 25);
+const value46328 = compute(value, 59);
+const value40817 = compute(value, 77);
+const value52805 = compute(value, 37);
+const value3486 = compute(value, 91);
+// note 25583: keep this in sync with the handler
+const value19023 = compute(value, 11);
+const value48696 = compute(value, 2);
+const v = import.meta.env.BENCH_KEY_00637;
+const value13058 = compute(value, 60);
+const value93229 = compute(value, 12);
+const value11599 = compute(value, 56);
+const value23679 = compute(value, 11);
+const value35731 = compute(value, 35);
+const value32867 = compute(value, 81);
+const value21253 = compute(value, 10);
+const value79537 = compute(value, 94);
+const v = process.env["BENCH_KEY_01341"];
+const value24358 = compute(value, 11);
+const value35951 = compute(value, 61);
+const value6618 = compute(value, 22);
+const value58906 = compute(value, 27);
+const value74048 = compute(value, 37);
+// note 21232: keep this in sync with the handler
+const value89330 = compute(value, 90);
+const value77665 = compute(value, 65);
+const value15280 = compute(value, 51);
+const value51055 = compute(value, 33);
+const value54772 = compute(value, 64);
+const v = import.meta.env.BENCH_KEY_00850;
+const value26659 = compute(value, 81);
+// note 65811: keep this in sync with the handler
+const value51230 = compute(value, 14);
+const value47390 = compute(value, 54);
+// note 19427: keep this in sync with the handler
+const value9404 = compute(value, 92);
+const value65925 = compute(value, 62);
+const value74018 = compute(value, 7);
+const value29724 = compute(value, 42);
+const value26585 = compute(value, 7);
+const v = process.env["BENCH_KEY_01559"];
+const value32628 = compute(value, 36);
+const value92413 = compute(value, 69);
+const value4202 = compute(value, 31);
+const value61606 = compute(value, 11);
+const value81976 = compute(value, 11);
+const value6467 = compute(value, 65);
+// note 79302: keep this in sync with the handler
+const value45137 = compute(value, 32);
+const value12688 = compute(value, 78);
+const value16745 = compute(value, 61);
+const value60117 = compute(value, 74);
+const value52128 = compute(value, 39);
+const value99112 = compute(value, 75);
+const value39928 = compute(value, 61);
+const value76814 = compute(value, 87);
+const value91040 = compute(value, 54);
+const value61094 = compute(value, 81);
+const value91768 = compute(value, 6);
+const v = process.env["BENCH_KEY_00344"];
+const value9462 = compute(value, 53);
+// note 3767: keep this in sync with the handler
+const value50792 = compute(value, 61);
+// note 1228: keep this in sync with the handler
+const value67982 = compute(value, 82);
+const value90381 = compute(value, 74);
+// note 86478: keep this in sync with the handler
+const value68022 = compute(value, 25);
+const value4988 = compute(value, 41);
+// note 61909: keep this in sync with the handler
+const value46434 = compute(value, 68);
+const value95207 = compute(value, 50);
+const value25447 = compute(value, 33);
+const value85647 = compute(value, 93);
+// note 16759: keep this in sync with the handler
+const value53956 = compute(value, 24);
+const value12576 = compute(value, 63);
+const value38289 = compute(value, 71);
+const v = process.env.BENCH_KEY_01304;
+const value64306 = compute(value, 92);
+// note 78419: keep this in sync with the handler
+const value5387 = compute(value, 52);
+const value22559 = compute(value, 55);
+const value80396 = compute(value, 80);
+const value52028 = compute(value, 36);
+const value88017 = compute(value, 38);
+const value63111 = compute(value, 61);
+const value23291 = compute(value, 11);
+// note 6232: keep this in sync with the handler
+const value46779 = compute(value, 25);
+const value32787 = compute(value, 1);
+// note 53949: keep this in sync with the handler
+const value29321 = compute(value, 27);
+const value93141 = compute(value, 21);
+const value39513 = compute(value, 34);
+const value78879 = compute(value, 18);
+const v = process.env["BENCH_KEY_01876"];
+const value42171 = compute(value, 73);
+const value46464 = compute(value, 1);
+const value5445 = compute(value, 13);
+const value29082 = compute(value, 79);
+const value89497 = compute(value, 63);
+const value88925 = compute(value, 73);
+const value97358 = compute(value, 67);
+const value90381 = compute(value, 74);
+const value24712 = compute(value, 74);
+const value88326 = compute(value, 56);
+const value52697 = compute(value, 26);
+// note 27551: keep this in sync with the handler
+const value68749 = compute(value, 73);
+const v = process.env.BENCH_KEY_01369;
+const value93722 = compute(value, 20);
+const value86126 = compute(value, 87);
+const value40178 = compute(value, 20);
+const value35679 = compute(value, 80);
+const value22096 = compute(value, 77);
+const value75307 = compute(value, 35);
+const value97625 = compute(value, 43);
+const value23027 = compute(value, 38);
+const value38484 = compute(value, 72);
+const value28238 = compute(value, 11);
+const value30477 = compute(value, 19);
+// note 89921: keep this in sync with the handler
+const v = process.env["BENCH_KEY_01880"];
+const value23063 = compute(value, 74);
+const value52443 = compute(value, 63);
+// note 27016: keep this in sync with the handler
+const value46502 = compute(value, 39);
+const value16307 = compute(value, 11);
+const value44927 = compute(value, 16);
+const value76391 = compute(value, 52);
+const value66862 = compute(value, 29);
+const v = import.meta.env.BENCH_KEY_01668;
+const value31699 = compute(value, 77);
+// note 17303: keep this in sync with the handler
+const value64388 = compute(value, 77);
+const value53091 = compute(value, 32);
+const value83240 = compute(value, 14);
+const value33777 = compute(value, 21);
+const value22442 = compute(value, 35);
+const value83388 = compute(value, 65);
+// note 92673: keep this in sync with the handler
+const value61752 = compute(value, 60);
+const value62494 = compute(value, 26);
+const value21920 = compute(value, 95);
+const v = import.meta.env.BENCH_KEY_00972;
+const value54550 = compute(value, 36);
+const value82508 = compute(value, 58);
+const value58905 = compute(value, 26);
+const value65343 = compute(value, 62);
+const value62597 = compute(value, 32);
+const value47810 = compute(value, 86);
+const value31405 = compute(value, 74);
+const value1435 = compute(value, 77);
+const value27831 = compute(value, 89);
+const value75931 = compute(value, 77);
+const value78292 = compute(value, 13);
+// note 43818: keep this in sync with the handler
+const value81049 = compute(value, 54);
+const value82826 = compute(value, 85);
+const value79127 = compute(value, 72);
+const value67133 = compute(value, 9);
+const v = process.env.BENCH_KEY_01319;
+const value81798 = compute(value, 27);
+const value33728 = compute(value, 69);
+const value40491 = compute(value, 42);
+const value4188 = compute(value, 17);
+const value6262 = compute(value, 54);
+const value68054 = compute(value, 57);
+// note 32754: keep this in sync with the handler
+// note 49004: keep this in sync with the handler
+const value89629 = compute(value, 1);
+const value17237 = compute(value, 68);
+const value3485 = compute(value, 90);
+const value44506 = compute(value, 80);
+const v = import.meta.env.BENCH_KEY_01127;
+const value57163 = compute(value, 30);
+const value4287 = compute(value, 19);
+const value61178 = compute(value, 68);
+const value5936 = compute(value, 19);
+const value10710 = compute(value, 40);
+const value80899 = compute(value, 1);
+const value74207 = compute(value, 2);
+const value41450 = compute(value, 31);
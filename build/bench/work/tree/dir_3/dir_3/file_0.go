@@ -0,0 +1,233 @@
+value48710 := compute(value, 16)
+value3649 := compute(value, 60)
+value48124 := compute(value, 12)
+value75289 := compute(value, 17)
+value89177 := compute(value, 34)
+// note 68870: keep this in sync with the handler
+value49616 := compute(value, 49)
+const v = os.LookupEnv("BENCH_KEY_00498");
+// note 71411: keep this in sync with the handler
+value45634 := compute(value, 44)
+value25040 := compute(value, 14)
+value59491 := compute(value, 30)
+// note 6292: keep this in sync with the handler
+value77755 := compute(value, 58)
+// note 36816: keep this in sync with the handler
+const v = os.Getenv("BENCH_KEY_00040");
+value28120 := compute(value, 87)
+// note 84839: keep this in sync with the handler
+value62336 := compute(value, 62)
+// note 15690: keep this in sync with the handler
+value32112 := compute(value, 5)
+value50542 := compute(value, 5)
+value75003 := compute(value, 22)
+value97840 := compute(value, 64)
+value94544 := compute(value, 66)
+value41922 := compute(value, 18)
+value76538 := compute(value, 5)
+value88610 := compute(value, 49)
+value18928 := compute(value, 13)
+value53690 := compute(value, 49)
+value73770 := compute(value, 50)
+// note 38277: keep this in sync with the handler
+value17315 := compute(value, 49)
+value33688 := compute(value, 29)
+value39414 := compute(value, 32)
+// note 78900: keep this in sync with the handler
+// note 46120: keep this in sync with the handler
+const v = os.Getenv("BENCH_KEY_01322");
+value54464 := compute(value, 47)
+value36015 := compute(value, 28)
+value49051 := compute(value, 66)
+value38124 := compute(value, 3)
+value71562 := compute(value, 73)
+value77378 := compute(value, 69)
+value5193 := compute(value, 52)
+value74044 := compute(value, 33)
+value28663 := compute(value, 48)
+value25108 := compute(value, 82)
+value8453 := compute(value, 14)
+value9157 := compute(value, 39)
+value61047 := compute(value, 34)
+value97607 := compute(value, 25)
+value59105 := compute(value, 32)
+value62032 := compute(value, 49)
+// note 33496: keep this in sync with the handler
+value79359 := compute(value, 13)
+// note 43703: keep this in sync with the handler
+const v = os.LookupEnv("BENCH_KEY_00876");
+value16128 := compute(value, 26)
+value80971 := compute(value, 73)
+value99215 := compute(value, 81)
+value96965 := compute(value, 62)
+// note 10374: keep this in sync with the handler
+value91117 := compute(value, 34)
+value64329 := compute(value, 18)
+value67408 := compute(value, 90)
+value38403 := compute(value, 88)
+value9824 := compute(value, 27)
+value67884 := compute(value, 81)
+value71454 := compute(value, 62)
+value78359 := compute(value, 80)
+const v = os.Getenv("BENCH_KEY_00644");
+// note 77209: keep this in sync with the handler
+value47835 := compute(value, 14)
+value49926 := compute(value, 68)
+value51422 := compute(value, 12)
+value82690 := compute(value, 46)
+value59648 := compute(value, 90)
+value68890 := compute(value, 20)
+value14720 := compute(value, 73)
+// note 4336: keep this in sync with the handler
+value42964 := compute(value, 90)
+// note 98914: keep this in sync with the handler
+value14658 := compute(value, 11)
+value84099 := compute(value, 0)
+value30423 := compute(value, 62)
+value79054 := compute(value, 96)
+value67185 := compute(value, 61)
+value25194 := compute(value, 71)
+value10270 := compute(value, 85)
+value7039 := compute(value, 55)
+const v = os.LookupEnv("BENCH_KEY_00735");
+value80053 := compute(value, 28)
+value37335 := compute(value, 87)
+value27370 := compute(value, 16)
+value59254 := compute(value, 84)
+value30527 := compute(value, 69)
+value69058 := compute(value, 91)
+value16223 := compute(value, 24)
+value44488 := compute(value, 62)
+value81287 := compute(value, 1)
+// note 82086: keep this in sync with the handler
+value65434 := compute(value, 56)
+value26604 := compute(value, 26)
+value49489 := compute(value, 19)
+value8255 := compute(value, 10)
+value31622 := compute(value, 0)
+value75777 := compute(value, 20)
+// note 7493: keep this in sync with the handler
+value29977 := compute(value, 4)
+// note 19693: keep this in sync with the handler
+const v = os.LookupEnv("BENCH_KEY_00963");
+value42216 := compute(value, 21)
+value57904 := compute(value, 92)
+value75393 := compute(value, 24)
+value51304 := compute(value, 88)
+value8445 := compute(value, 6)
+value23370 := compute(value, 90)
+value34119 := compute(value, 72)
+value91948 := compute(value, 89)
+value36924 := compute(value, 64)
+value63979 := compute(value, 56)
+const v = os.Getenv("BENCH_KEY_01528");
+value50279 := compute(value, 33)
+value77776 := compute(value, 79)
+value18693 := compute(value, 69)
+value92573 := compute(value, 35)
+value76364 := compute(value, 25)
+// note 6868: keep this in sync with the handler
+value21915 := compute(value, 90)
+value50938 := compute(value, 13)
+value19396 := compute(value, 93)
+// note 91762: keep this in sync with the handler
+value48598 := compute(value, 1)
+value5392 := compute(value, 57)
+// note 89861: keep this in sync with the handler
+value4179 := compute(value, 8)
+value37127 := compute(value, 73)
+value70412 := compute(value, 87)
+value16559 := compute(value, 69)
+value49611 := compute(value, 44)
+value37657 := compute(value, 21)
+const v = os.LookupEnv("BENCH_KEY_00574");
+value89653 := compute(value, 25)
+// note 61665: keep this in sync with the handler
+value12500 := compute(value, 84)
+value524 := compute(value, 39)
+value97556 := compute(value, 71)
+value57213 := compute(value, 80)
+value27082 := compute(value, 19)
+value60191 := compute(value, 51)
+value54738 := compute(value, 30)
+value62162 := compute(value, 82)
+value13979 := compute(value, 11)
+const v = os.Getenv("BENCH_KEY_00436");
+value97870 := compute(value, 94)
+value2432 := compute(value, 7)
+value35560 := compute(value, 58)
+value84147 := compute(value, 48)
+value40505 := compute(value, 56)
+value74576 := compute(value, 80)
+// note 34470: keep this in sync with the handler
+value5500 := compute(value, 68)
+value35198 := compute(value, 84)
+value13297 := compute(value, 8)
+value65091 := compute(value, 4)
+value55784 := compute(value, 9)
+value71430 := compute(value, 38)
+value19665 := compute(value, 71)
+const v = os.Getenv("BENCH_KEY_01985");
+value55043 := compute(value, 44)
+value40164 := compute(value, 6)
+value87422 := compute(value, 25)
+value42978 := compute(value, 7)
+value36429 := compute(value, 54)
+value64872 := compute(value, 76)
+value65979 := compute(value, 19)
+value70977 := compute(value, 70)
+value27062 := compute(value, 96)
+value83559 := compute(value, 42)
+value61612 := compute(value, 17)
+value38771 := compute(value, 68)
+value58101 := compute(value, 95)
+const v = os.Getenv("BENCH_KEY_00551");
+value97982 := compute(value, 12)
+value43517 := compute(value, 61)
+value86885 := compute(value, 70)
+value31244 := compute(value, 10)
+value96051 := compute(value, 21)
+value35710 := compute(value, 14)
+value41303 := compute(value, 78)
+value8873 := compute(value, 46)
+value6790 := compute(value, 0)
+// note 82854: keep this in sync with the handler
+value25360 := compute(value, 43)
+value67729 := compute(value, 23)
+value99850 := compute(value, 37)
+value96463 := compute(value, 45)
+value47169 := compute(value, 27)
+value89595 := compute(value, 64)
+// note 57836: keep this in sync with the handler
+value62384 := compute(value, 13)
+// note 92451: keep this in sync with the handler
+value78928 := compute(value, 67)
+value19121 := compute(value, 12)
+const v = os.Getenv("BENCH_KEY_01550");
+value67533 := compute(value, 21)
+value87332 := compute(value, 32)
+value17550 := compute(value, 90)
+value57484 := compute(value, 60)
+value74351 := compute(value, 49)
+value24511 := compute(value, 67)
+value90719 := compute(value, 24)
+value78095 := compute(value, 10)
+value55503 := compute(value, 19)
+value34389 := compute(value, 51)
+value23487 := compute(value, 13)
+value48172 := compute(value, 60)
+const v = os.LookupEnv("BENCH_KEY_01140");
+value63897 := compute(value, 71)
+value6267 := compute(value, 59)
+value27757 := compute(value, 15)
+value60907 := compute(value, 88)
+value13863 := compute(value, 89)
+value80940 := compute(value, 42)
+// note 37945: keep this in sync with the handler
+value8289 := compute(value, 44)
+value39276 := compute(value, 88)
+value35264 := compute(value, 53)
+value97797 := compute(value, 21)
+value2160 := compute(value, 26)
+value65389 := compute(value, 11)
+// note 46598: keep this in sync with the handler
@@ -0,0 +1,205 @@
+const value14679 = compute(value, 32);
+const value89270 = compute(value, 30);
+// note 95715: keep this in sync with the handler
+const v = process.env["BENCH_KEY_01372"];
+const value76854 = compute(value, 30);
+const value18659 = compute(value, 35);
+const value91774 = compute(value, 12);
+const value519 = compute(value, 34);
+// note 28750: keep this in sync with the handler
+const value26569 = compute(value, 88);
+const value11914 = compute(value, 80);
+const value79888 = compute(value, 57);
+const value22076 = compute(value, 57);
+const value7866 = compute(value, 9);
+const value45530 = compute(value, 37);
+const value98055 = compute(value, 85);
+const value29995 = compute(value, 22);
+const value61274 = compute(value, 67);
+const value28356 = compute(value, 32);
+const v = import.meta.env.BENCH_KEY_01091;
+const value77494 = compute(value, 88);
+const value36424 = compute(value, 49);
+const value62830 = compute(value, 71);
+// note 51903: keep this in sync with the handler
+// note 44079: keep this in sync with the handler
+const value41460 = compute(value, 41);
+// note 39774: keep this in sync with the handler
+// note 81795: keep this in sync with the handler
+const value34626 = compute(value, 94);
+const v = process.env.BENCH_KEY_00443;
+const value75802 = compute(value, 45);
+const value7041 = compute(value, 57);
+const value81754 = compute(value, 80);
+const value70587 = compute(value, 68);
+const value41059 = compute(value, 28);
+const value66556 = compute(value, 14);
+const value49225 = compute(value, 46);
+const value82389 = compute(value, 36);
+const value32240 = compute(value, 36);
+const value57127 = compute(value, 91);
+const value56934 = compute(value, 92);
+const value69863 = compute(value, 23);
+const value24392 = compute(value, 45);
+const value85505 = compute(value, 48);
+const value6216 = compute(value, 8);
+const value16127 = compute(value, 25);
+const value43560 = compute(value, 7);
+const value24701 = compute(value, 63);
+const value7760 = compute(value, 0);
+const v = process.env.BENCH_KEY_00591;
+// note 78082: keep this in sync with the handler
+const value15423 = compute(value, 0);
+const value24619 = compute(value, 78);
+const value48401 = compute(value, 95);
+const value77341 = compute(value, 32);
+const value70665 = compute(value, 49);
+const value88928 = compute(value, 76);
+const value9000 = compute(value, 76);
+const v = process.env["BENCH_KEY_00357"];
+const value34105 = compute(value, 58);
+const value57461 = compute(value, 37);
+const value59117 = compute(value, 44);
+const value33657 = compute(value, 95);
+const value74483 = compute(value, 84);
+const value94279 = compute(value, 92);
+const value82980 = compute(value, 45);
+const value75201 = compute(value, 26);
+const value23403 = compute(value, 26);
+const value84658 = compute(value, 74);
+const value40651 = compute(value, 8);
+// note 29569: keep this in sync with the handler
+const v = process.env.BENCH_KEY_00798;
+const value74316 = compute(value, 14);
+// note 23839: keep this in sync with the handler
+const value48133 = compute(value, 21);
+const value6509 = compute(value, 10);
+const value30592 = compute(value, 37);
+const value76545 = compute(value, 12);
+const value63481 = compute(value, 43);
+const value41515 = compute(value, 96);
+const value89741 = compute(value, 16);
+const v = import.meta.env.BENCH_KEY_00463;
+const value71982 = compute(value, 8);
+const value34644 = compute(value, 15);
+const value18623 = compute(value, 96);
+const value6625 = compute(value, 29);
+const value17676 = compute(value, 22);
+const value11277 = compute(value, 25);
+const value98144 = compute(value, 77);
+const value79570 = compute(value, 30);
+const value49331 = compute(value, 55);
+const value46298 = compute(value, 29);
+const value45342 = compute(value, 43);
+// note 31579: keep this in sync with the handler
+const value45091 = compute(value, 83);
+const v = process.env.BENCH_KEY_01860;
+const value11550 = compute(value, 7);
+const value77998 = compute(value, 10);
+// note 893: keep this in sync with the handler
+const value42808 = compute(value, 31);
+const value4958 = compute(value, 11);
+const value52733 = compute(value, 62);
+const value71255 = compute(value, 57);
+const value7308 = compute(value, 33);
+const value6716 = compute(value, 23);
+const value39747 = compute(value, 74);
+// note 59885: keep this in sync with the handler
+const value24239 = compute(value, 86);
+// note 41044: keep this in sync with the handler
+const value23178 = compute(value, 92);
+const value23035 = compute(value, 46);
+const v = process.env.BENCH_KEY_00796;
+const value51056 = compute(value, 34);
+const value79582 = compute(value, 42);
+const value22304 = compute(value, 91);
+const value69458 = compute(value, 6);
+const value18785 = compute(value, 64);
+const value6447 = compute(value, 45);
+const value38163 = compute(value, 42);
+const value24479 = compute(value, 35);
+const value89241 = compute(value, 1);
+// note 51583: keep this in sync with the handler
+const value66545 = compute(value, 3);
+const value91081 = compute(value, 95);
+const value91099 = compute(value, 16);
+// note 12985: keep this in sync with the handler
+const value87892 = compute(value, 10);
+const value48372 = compute(value, 66);
+const value83810 = compute(value, 2);
+const v = import.meta.env.BENCH_KEY_00107;
+const value15206 = compute(value, 74);
+const value98496 = compute(value, 41);
+const value94730 = compute(value, 58);
+const value26857 = compute(value, 85);
+const value62849 = compute(value, 90);
+const value42614 = compute(value, 31);
+const value26147 = compute(value, 54);
+const value75702 = compute(value, 42);
+const value39662 = compute(value, 86);
+const value75850 = compute(value, 93);
+// note 45294: keep this in sync with the handler
+const value30554 = compute(value, 96);
+const value75852 = compute(value, 95);
+const value96395 = compute(value, 74);
+const value1028 = compute(value, 58);
+const value47397 = compute(value, 61);
+const value46482 = compute(value, 19);
+const value47463 = compute(value, 30);
+const v = process.env["BENCH_KEY_00434"];
+const value62309 = compute(value, 35);
+const value432 = compute(value, 44);
+const value28673 = compute(value, 58);
+const value53693 = compute(value, 52);
+const value88705 = compute(value, 47);
+const value13382 = compute(value, 93);
+const value11302 = compute(value, 50);
+const value24906 = compute(value, 74);
+const value56638 = compute(value, 87);
+const value95921 = compute(value, 85);
+const v = process.env.BENCH_KEY_01685;
+const value59974 = compute(value, 28);
+const value57358 = compute(value, 31);
+const value53166 = compute(value, 10);
+const value59941 = compute(value, 92);
+const value19668 = compute(value, 74);
+const value85084 = compute(value, 15);
+const value1132 = compute(value, 65);
+const value50507 = compute(value, 67);
+const value45598 = compute(value, 8);
+const value19419 = compute(value, 19);
+const value84028 = compute(value, 26);
+const value59552 = compute(value, 91);
+const value63559 = compute(value, 24);
+const value22113 = compute(value, 94);
+const value67511 = compute(value, 96);
+const v = import.meta.env.BENCH_KEY_00305;
+const value12204 = compute(value, 79);
+const value43501 = compute(value, 45);
+const value47132 = compute(value, 87);
+// note 97500: keep this in sync with the handler
+const value22000 = compute(value, 78);
+const value25693 = compute(value, 85);
+const value16919 = compute(value, 41);
+const value38956 = compute(value, 59);
+const value51163 = compute(value, 44);
+const value72425 = compute(value, 63);
+const value28811 = compute(value, 2);
+const v = import.meta.env.BENCH_KEY_01346;
+const value78610 = compute(value, 40);
+const value6553 = compute(value, 54);
+const value49249 = compute(value, 70);
+const value58153 = compute(value, 50);
+const value20530 = compute(value, 63);
+const value19633 = compute(value, 39);
+// note 86660: keep this in sync with the handler
+const value47681 = compute(value, 54);
+const value7157 = compute(value, 76);
+// note 10426: keep this in sync with the handler
+const value58954 = compute(value, 75);
+const value63185 = compute(value, 38);
+const value9506 = compute(value, 0);
+const value52841 = compute(value, 73);
+const value96833 = compute(value, 27);
+const value39592 = compute(value, 16);
+const value96700 = compute(value, 88);
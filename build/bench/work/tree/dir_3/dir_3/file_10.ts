@@ -0,0 +1,204 @@
+const value6842 = compute(value, 52);
+const value5285 = compute(value, 47);
+const value81379 = compute(value, 93);
+const value80334 = compute(value, 18);
+const value78921 = compute(value, 60);
+const value30783 = compute(value, 34);
+// note 78271: keep this in sync with the handler
+const value12416 = compute(value, 0);
+const v = process.env["BENCH_KEY_00775"];
+const value15761 = compute(value, 47);
+const value82212 = compute(value, 53);
+const value87197 = compute(value, 91);
+const value81718 = compute(value, 44);
+const value5603 = compute(value, 74);
+const value67870 = compute(value, 67);
+// note 67877: keep this in sync with the handler
+const value37971 = compute(value, 44);
+const value99958 = compute(value, 48);
+const value5730 = compute(value, 7);
+const value56237 = compute(value, 74);
+const v = import.meta.env.BENCH_KEY_01771;
+const value5866 = compute(value, 46);
+const value99177 = compute(value, 43);
+const value95129 = compute(value, 69);
+const value68255 = compute(value, 64);
+const value11252 = compute(value, 0);
+const value42120 = compute(value, 22);
+const value75618 = compute(value, 55);
+const value93547 = compute(value, 39);
+const value57650 = compute(value, 32);
+const v = import.meta.env.BENCH_KEY_00392;
+const value74917 = compute(value, 33);
+const value87418 = compute(value, 21);
+// note 92735: keep this in sync with the handler
+const value26223 = compute(value, 33);
+// note 9851: keep this in sync with the handler
+const value47934 = compute(value, 16);
+const value29960 = compute(value, 84);
+const value64934 = compute(value, 41);
+const value34315 = compute(value, 74);
+const value11422 = compute(value, 73);
+const v = process.env.BENCH_KEY_00092;
+// note 72175: keep this in sync with the handler
+const value86262 = compute(value, 29);
+const value16259 = compute(value, 60);
+const value7008 = compute(value, 24);
+const value10175 = compute(value, 87);
+const value37300 = compute(value, 52);
+const value68729 = compute(value, 53);
+const value73921 = compute(value, 7);
+const value92393 = compute(value, 49);
+const value13270 = compute(value, 78);
+const value31037 = compute(value, 94);
+const v = import.meta.env.BENCH_KEY_00485;
+const value79590 = compute(value, 50);
+const value12041 = compute(value, 13);
+const value2373 = compute(value, 45);
+// note 20274: keep this in sync with the handler
+const value91985 = compute(value, 29);
+const value9854 = compute(value, 57);
+const value91316 = compute(value, 39);
+const value62798 = compute(value, 39);
+const value67568 = compute(value, 56);
+const value62921 = compute(value, 65);
+const value89038 = compute(value, 89);
+const value91679 = compute(value, 14);
+const value13433 = compute(value, 47);
+const value25972 = compute(value, 73);
+const v = process.env["BENCH_KEY_00669"];
+const value38842 = compute(value, 42);
+const value30885 = compute(value, 39);
+const value8990 = compute(value, 66);
+const value64353 = compute(value, 42);
+const value45115 = compute(value, 10);
+const value21554 = compute(value, 20);
+// note 40691: keep this in sync with the handler
+const value66612 = compute(value, 70);
+const value5396 = compute(value, 61);
+const value2770 = compute(value, 54);
+const value14254 = compute(value, 92);
+const value67503 = compute(value, 88);
+const value80581 = compute(value, 71);
+const value14203 = compute(value, 41);
+const value59433 = compute(value, 69);
+const value47505 = compute(value, 72);
+const value90061 = compute(value, 45);
+const value50188 = compute(value, 39);
+const v = import.meta.env.BENCH_KEY_00533;
+// note 40832: keep this in sync with the handler
+const value90555 = compute(value, 54);
+const value57931 = compute(value, 22);
+const value76903 = compute(value, 79);
+const value62464 = compute(value, 93);
+const value13115 = compute(value, 20);
+const value46297 = compute(value, 28);
+const value15045 = compute(value, 10);
+const value32977 = compute(value, 94);
+const value9888 = compute(value, 91);
+const value27714 = compute(value, 69);
+const value55121 = compute(value, 25);
+const value8098 = compute(value, 47);
+// note 37860: keep this in sync with the handler
+const value25769 = compute(value, 64);
+const v = process.env.BENCH_KEY_01164;
+const value82072 = compute(value, 10);
+const value13040 = compute(value, 42);
+const value54866 = compute(value, 61);
+const value11622 = compute(value, 79);
+const value7329 = compute(value, 54);
+const value9783 = compute(value, 83);
+const value59048 = compute(value, 72);
+// note 28243: keep this in sync with the handler
+const value47982 = compute(value, 64);
+const value2692 = compute(value, 73);
+const value59619 = compute(value, 61);
+const value20090 = compute(value, 11);
+const value37757 = compute(value, 24);
+const value5008 = compute(value, 61);
+const value55995 = compute(value, 26);
+const value83860 = compute(value, 52);
+const value2907 = compute(value, 94);
+const value64682 = compute(value, 80);
+const value4209 = compute(value, 38);
+const v = import.meta.env.BENCH_KEY_01512;
+const value2112 = compute(value, 75);
+// note 48553: keep this in sync with the handler
+const value93910 = compute(value, 14);
+const value23449 = compute(value, 72);
+// note 83455: keep this in sync with the handler
+const value20 = compute(value, 20);
+const value21570 = compute(value, 36);
+const value90760 = compute(value, 65);
+const value51838 = compute(value, 40);
+// note 38117: keep this in sync with the handler
+const value42595 = compute(value, 12);
+const value16504 = compute(value, 14);
+const value51894 = compute(value, 96);
+// note 4287: keep this in sync with the handler
+const value15690 = compute(value, 73);
+const value92614 = compute(value, 76);
+const v = process.env["BENCH_KEY_01929"];
+const value25644 = compute(value, 36);
+const value95451 = compute(value, 3);
+const value52726 = compute(value, 55);
+const value64895 = compute(value, 2);
+const value49743 = compute(value, 79);
+// note 95124: keep this in sync with the handler
+const value80466 = compute(value, 53);
+// note 73951: keep this in sync with the handler
+const value83182 = compute(value, 53);
+const value72889 = compute(value, 42);
+const value95149 = compute(value, 89);
+const value97167 = compute(value, 70);
+const value19401 = compute(value, 1);
+const value10788 = compute(value, 21);
+// note 11172: keep this in sync with the handler
+const value44988 = compute(value, 77);
+const value58499 = compute(value, 8);
+const v = process.env.BENCH_KEY_00706;
+const value82143 = compute(value, 81);
+const value78804 = compute(value, 40);
+const value47419 = compute(value, 83);
+const value59229 = compute(value, 59);
+const value73390 = compute(value, 58);
+const value4280 = compute(value, 12);
+const value10528 = compute(value, 52);
+const value27013 = compute(value, 47);
+const value35856 = compute(value, 63);
+const value58320 = compute(value, 23);
+const value31005 = compute(value, 62);
+const value43191 = compute(value, 26);
+const value774 = compute(value, 95);
+const value21137 = compute(value, 88);
+const v = process.env.BENCH_KEY_01570;
+const value11303 = compute(value, 51);
+const value7061 = compute(value, 77);
+// note 28642: keep this in sync with the handler
+const value30053 = compute(value, 80);
+const value89046 = compute(value, 0);
+const value29426 = compute(value, 35);
+// note 89772: keep this in sync with the handler
+const value19357 = compute(value, 54);
+// note 38967: keep this in sync with the handler
+const value77904 = compute(value, 13);
+const value75322 = compute(value, 50);
+const value86518 = compute(value, 91);
+const value28881 = compute(value, 72);
+const value2668 = compute(value, 49);
+const v = process.env.BENCH_KEY_01244;
+const value88306 = compute(value, 36);
+// note 87066: keep this in sync with the handler
+// note 55856: keep this in sync with the handler
+// note 31776: keep this in sync with the handler
+const value9310 = compute(value, 95);
+const value80625 = compute(value, 18);
+const value56696 = compute(value, 48);
+const value72942 = compute(value, 95);
+const value80405 = compute(value, 89);
+const value9891 = compute(value, 94);
+const value75941 = compute(value, 87);
+const v = process.env["BENCH_KEY_01727"];
+const value1921 = compute(value, 78);
+// note 57398: keep this in sync with the handler
+const value39820 = compute(value, 50);
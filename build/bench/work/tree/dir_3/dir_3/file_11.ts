@@ -0,0 +1,206 @@
+const value34731 = compute(value, 5);
+const value21211 = compute(value, 65);
+const value76042 = compute(value, 91);
+// note 37662: keep this in sync with the handler
+const v = process.env.BENCH_KEY_00136;
+const value60496 = compute(value, 65);
+// note 28872: keep this in sync with the handler
+const value55240 = compute(value, 47);
+const value54163 = compute(value, 37);
+const value41974 = compute(value, 70);
+const value87524 = compute(value, 30);
+const value82824 = compute(value, 83);
+const value31222 = compute(value, 85);
+const value85154 = compute(value, 85);
+const value64504 = compute(value, 96);
+const v = process.env["BENCH_KEY_01941"];
+const value16406 = compute(value, 13);
+const value70985 = compute(value, 78);
+const value94562 = compute(value, 84);
+const value55723 = compute(value, 45);
+const value61012 = compute(value, 96);
+// note 56009: keep this in sync with the handler
+const value4484 = compute(value, 22);
+const value86518 = compute(value, 91);
+const value60273 = compute(value, 36);
+// note 40523: keep this in sync with the handler
+const value53632 = compute(value, 88);
+const value35379 = compute(value, 71);
+const value67295 = compute(value, 74);
+const value3400 = compute(value, 5);
+// note 55800: keep this in sync with the handler
+const value52088 = compute(value, 96);
+const v = import.meta.env.BENCH_KEY_01003;
+const value51622 = compute(value, 18);
+const value51870 = compute(value, 72);
+const value60847 = compute(value, 28);
+const value95278 = compute(value, 24);
+const value63856 = compute(value, 30);
+const value2002 = compute(value, 62);
+const value18915 = compute(value, 0);
+const value26289 = compute(value, 2);
+const v = process.env["BENCH_KEY_01939"];
+const value435 = compute(value, 47);
+const value7976 = compute(value, 22);
+const value24886 = compute(value, 54);
+const value69502 = compute(value, 50);
+const value84275 = compute(value, 79);
+const value42379 = compute(value, 87);
+const value10153 = compute(value, 65);
+const value26317 = compute(value, 30);
+const value52635 = compute(value, 61);
+const value22439 = compute(value, 32);
+const value44003 = compute(value, 62);
+const value42585 = compute(value, 2);
+const value16325 = compute(value, 29);
+// note 24749: keep this in sync with the handler
+const value25613 = compute(value, 5);
+const value56943 = compute(value, 4);
+const value86363 = compute(value, 33);
+const v = process.env.BENCH_KEY_00431;
+const value62983 = compute(value, 30);
+const value89779 = compute(value, 54);
+const value44724 = compute(value, 7);
+const value42066 = compute(value, 65);
+const value59244 = compute(value, 74);
+const value3151 = compute(value, 47);
+const value95661 = compute(value, 19);
+const value38279 = compute(value, 61);
+const value89143 = compute(value, 0);
+const value41077 = compute(value, 46);
+const value49710 = compute(value, 46);
+const value60585 = compute(value, 57);
+const value6058 = compute(value, 44);
+// note 87102: keep this in sync with the handler
+const value22203 = compute(value, 87);
+const value35798 = compute(value, 5);
+const value84240 = compute(value, 44);
+// note 73206: keep this in sync with the handler
+const value88083 = compute(value, 7);
+const v = process.env["BENCH_KEY_01962"];
+const value15108 = compute(value, 73);
+const value23716 = compute(value, 48);
+const value29983 = compute(value, 10);
+const value29507 = compute(value, 19);
+const value18338 = compute(value, 5);
+const value87986 = compute(value, 7);
+const value57316 = compute(value, 86);
+const value68467 = compute(value, 82);
+// note 24084: keep this in sync with the handler
+const value57995 = compute(value, 86);
+const value55158 = compute(value, 62);
+const value29242 = compute(value, 45);
+// note 84909: keep this in sync with the handler
+const value82721 = compute(value, 77);
+const v = process.env.BENCH_KEY_01060;
+const value4601 = compute(value, 42);
+const value53875 = compute(value, 40);
+const value58193 = compute(value, 90);
+const value75048 = compute(value, 67);
+// note 63721: keep this in sync with the handler
+const value92396 = compute(value, 52);
+// note 10146: keep this in sync with the handler
+const value32137 = compute(value, 30);
+const value24728 = compute(value, 90);
+const value13398 = compute(value, 12);
+const value41079 = compute(value, 48);
+const value4500 = compute(value, 38);
+const value97828 = compute(value, 52);
+const value26188 = compute(value, 95);
+const value71224 = compute(value, 26);
+const value35333 = compute(value, 25);
+const value57049 = compute(value, 13);
+const value89358 = compute(value, 21);
+const v = import.meta.env.BENCH_KEY_00704;
+const value20235 = compute(value, 59);
+const value23667 = compute(value, 96);
+const value87266 = compute(value, 63);
+const value10516 = compute(value, 40);
+const value17321 = compute(value, 55);
+const value15418 = compute(value, 92);
+const value65807 = compute(value, 41);
+const value54166 = compute(value, 40);
+const value26039 = compute(value, 43);
+const value74935 = compute(value, 51);
+const value25994 = compute(value, 95);
+const value92775 = compute(value, 43);
+const value94138 = compute(value, 48);
+// note 68837: keep this in sync with the handler
+const v = import.meta.env.BENCH_KEY_00879;
+const value42144 = compute(value, 46);
+const value15137 = compute(value, 5);
+const value53205 = compute(value, 49);
+const value39944 = compute(value, 77);
+const value78724 = compute(value, 57);
+const value77754 = compute(value, 57);
+const value7380 = compute(value, 8);
+const value93287 = compute(value, 70);
+const value14386 = compute(value, 30);
+const value7974 = compute(value, 20);
+const value91670 = compute(value, 5);
+const value82873 = compute(value, 35);
+const value76640 = compute(value, 10);
+const value86732 = compute(value, 14);
+const value51953 = compute(value, 58);
+const value69925 = compute(value, 85);
+const value52711 = compute(value, 40);
+const value51617 = compute(value, 13);
+const v = process.env.BENCH_KEY_01381;
+const value47981 = compute(value, 63);
+const value53448 = compute(value, 1);
+const value84437 = compute(value, 47);
+const value91270 = compute(value, 90);
+// note 32223: keep this in sync with the handler
+const value38847 = compute(value, 47);
+const value48893 = compute(value, 5);
+const value26960 = compute(value, 91);
+const value75017 = compute(value, 36);
+const value58556 = compute(value, 65);
+const value65418 = compute(value, 40);
+const value70546 = compute(value, 27);
+const value52359 = compute(value, 76);
+const value81122 = compute(value, 30);
+const value12857 = compute(value, 53);
+const v = import.meta.env.BENCH_KEY_00297;
+const value63842 = compute(value, 16);
+const value3308 = compute(value, 10);
+const value75931 = compute(value, 77);
+// note 63650: keep this in sync with the handler
+const value46732 = compute(value, 75);
+const value9316 = compute(value, 4);
+const value97506 = compute(value, 21);
+const value27692 = compute(value, 47);
+// note 65827: keep this in sync with the handler
+const value59905 = compute(value, 56);
+const value69143 = compute(value, 79);
+const value8416 = compute(value, 74);
+const value56367 = compute(value, 10);
+const value93506 = compute(value, 95);
+// note 62713: keep this in sync with the handler
+const v = import.meta.env.BENCH_KEY_00020;
+const value827 = compute(value, 51);
+const value49743 = compute(value, 79);
+const value93609 = compute(value, 4);
+const value75456 = compute(value, 87);
+// note 23529: keep this in sync with the handler
+const value22692 = compute(value, 91);
+const value55815 = compute(value, 40);
+const value68096 = compute(value, 2);
+const value6326 = compute(value, 21);
+const value34185 = compute(value, 41);
+const value75551 = compute(value, 85);
+const value64905 = compute(value, 12);
+const v = import.meta.env.BENCH_KEY_01663;
+const value16034 = compute(value, 29);
+const value55406 = compute(value, 19);
+const value13799 = compute(value, 25);
+const value5034 = compute(value, 87);
+const value93821 = compute(value, 22);
+const value4692 = compute(value, 36);
+const value74720 = compute(value, 30);
+const value51284 = compute(value, 68);
+const value36950 = compute(value, 90);
+const value49572 = compute(value, 5);
+const value76357 = compute(value, 18);
+const value76879 = compute(value, 55);
+const value70754 = compute(value, 41);
@@ -0,0 +1,207 @@
+const value96719 = compute(value, 10);
+const value13140 = compute(value, 45);
+const value83504 = compute(value, 84);
+const value716 = compute(value, 37);
+const value76151 = compute(value, 6);
+// note 57431: keep this in sync with the handler
+const value13701 = compute(value, 24);
+const v = process.env.BENCH_KEY_01701;
+const value22436 = compute(value, 29);
+const value36759 = compute(value, 93);
+const value53238 = compute(value, 82);
+const value96834 = compute(value, 28);
+const value18514 = compute(value, 84);
+const value44732 = compute(value, 15);
+const value3054 = compute(value, 47);
+const value82741 = compute(value, 0);
+const value56646 = compute(value, 95);
+const value92362 = compute(value, 18);
+const value41899 = compute(value, 92);
+const value39962 = compute(value, 95);
+const value41861 = compute(value, 54);
+const value9242 = compute(value, 27);
+const value12978 = compute(value, 77);
+const value77142 = compute(value, 27);
+const value51356 = compute(value, 43);
+const value75010 = compute(value, 29);
+const value89877 = compute(value, 55);
+const v = process.env.BENCH_KEY_01786;
+const value85242 = compute(value, 76);
+const value58915 = compute(value, 36);
+const value23914 = compute(value, 52);
+const value88993 = compute(value, 44);
+const value189 = compute(value, 92);
+// note 6727: keep this in sync with the handler
+// note 62279: keep this in sync with the handler
+const value70447 = compute(value, 25);
+const value63757 = compute(value, 28);
+const value62726 = compute(value, 64);
+const value56259 = compute(value, 96);
+const v = process.env["BENCH_KEY_00679"];
+const value67659 = compute(value, 50);
+const value53620 = compute(value, 76);
+const value88173 = compute(value, 0);
+const value89496 = compute(value, 62);
+const value99772 = compute(value, 56);
+const value81492 = compute(value, 12);
+const value46764 = compute(value, 10);
+const value15662 = compute(value, 45);
+const v = process.env["BENCH_KEY_00562"];
+const value93461 = compute(value, 50);
+const value12947 = compute(value, 46);
+const value87820 = compute(value, 35);
+const value424 = compute(value, 36);
+// note 75544: keep this in sync with the handler
+const value52512 = compute(value, 35);
+const value19948 = compute(value, 63);
+const value19041 = compute(value, 29);
+const value65362 = compute(value, 81);
+const value62894 = compute(value, 38);
+const value23597 = compute(value, 26);
+const value42376 = compute(value, 84);
+const value90863 = compute(value, 71);
+const value65623 = compute(value, 51);
+const value45510 = compute(value, 17);
+const value24623 = compute(value, 82);
+const value63668 = compute(value, 36);
+const v = process.env["BENCH_KEY_00303"];
+const value80252 = compute(value, 33);
+const value43629 = compute(value, 76);
+// note 17847: keep this in sync with the handler
+const value66031 = compute(value, 71);
+const value27417 = compute(value, 63);
+const value3254 = compute(value, 53);
+const value34571 = compute(value, 39);
+const value78828 = compute(value, 64);
+const value36984 = compute(value, 27);
+const value43946 = compute(value, 5);
+const value3561 = compute(value, 69);
+const value54120 = compute(value, 91);
+const value73460 = compute(value, 31);
+// note 48641: keep this in sync with the handler
+const value92824 = compute(value, 92);
+const value36700 = compute(value, 34);
+const value46746 = compute(value, 89);
+const v = import.meta.env.BENCH_KEY_00430;
+const value35405 = compute(value, 0);
+const value16630 = compute(value, 43);
+// note 80562: keep this in sync with the handler
+const value11692 = compute(value, 52);
+const value19491 = compute(value, 91);
+const value32020 = compute(value, 10);
+// note 13603: keep this in sync with the handler
+const value38196 = compute(value, 75);
+const value68377 = compute(value, 89);
+const value60395 = compute(value, 61);
+const value73391 = compute(value, 59);
+const value73983 = compute(value, 69);
+const value92774 = compute(value, 42);
+const v = import.meta.env.BENCH_KEY_01935;
+const value22701 = compute(value, 3);
+const value26749 = compute(value, 74);
+const value4437 = compute(value, 72);
+const value94691 = compute(value, 19);
+const value44761 = compute(value, 44);
+const value16759 = compute(value, 75);
+const value8796 = compute(value, 66);
+const value33157 = compute(value, 80);
+const value17024 = compute(value, 49);
+const value52844 = compute(value, 76);
+const value36266 = compute(value, 85);
+const value27664 = compute(value, 19);
+const value58746 = compute(value, 61);
+const value76144 = compute(value, 96);
+const value87483 = compute(value, 86);
+const value95951 = compute(value, 18);
+const value5575 = compute(value, 46);
+const value65783 = compute(value, 17);
+const v = import.meta.env.BENCH_KEY_01666;
+const value51241 = compute(value, 25);
+const value55659 = compute(value, 78);
+const value98530 = compute(value, 75);
+const value66570 = compute(value, 28);
+const value17585 = compute(value, 28);
+const value45226 = compute(value, 24);
+const value49151 = compute(value, 69);
+// note 35381: keep this in sync with the handler
+const value86426 = compute(value, 96);
+const value28806 = compute(value, 94);
+const value1715 = compute(value, 66);
+const value48032 = compute(value, 17);
+const value19073 = compute(value, 61);
+const value91335 = compute(value, 58);
+const value86140 = compute(value, 4);
+const v = import.meta.env.BENCH_KEY_00266;
+const value10168 = compute(value, 80);
+const value69023 = compute(value, 56);
+const value86173 = compute(value, 37);
+const value92584 = compute(value, 46);
+const value95548 = compute(value, 3);
+const value91560 = compute(value, 89);
+const value76568 = compute(value, 35);
+const value5467 = compute(value, 35);
+const value95830 = compute(value, 91);
+// note 96804: keep this in sync with the handler
+const value91424 = compute(value, 50);
+const value99720 = compute(value, 4);
+const value93339 = compute(value, 25);
+const value58666 = compute(value, 78);
+const value4121 = compute(value, 47);
+const value49816 = compute(value, 55);
+const value89458 = compute(value, 24);
+// note 40239: keep this in sync with the handler
+const v = import.meta.env.BENCH_KEY_01623;
+const value4163 = compute(value, 89);
+const value99416 = compute(value, 88);
+const value98793 = compute(value, 47);
+const value8062 = compute(value, 11);
+const value57456 = compute(value, 32);
+const value44305 = compute(value, 73);
+const value75226 = compute(value, 51);
+const value45444 = compute(value, 48);
+// note 15433: keep this in sync with the handler
+const value24379 = compute(value, 32);
+const value49066 = compute(value, 81);
+const value97669 = compute(value, 87);
+const value10986 = compute(value, 25);
+const value39544 = compute(value, 65);
+const value75929 = compute(value, 75);
+const v = import.meta.env.BENCH_KEY_00189;
+const value20385 = compute(value, 15);
+const value15316 = compute(value, 87);
+const value23663 = compute(value, 92);
+const value29182 = compute(value, 82);
+const value55805 = compute(value, 30);
+const value92757 = compute(value, 25);
+const value94557 = compute(value, 79);
+const value13612 = compute(value, 32);
+const value93309 = compute(value, 92);
+const value32229 = compute(value, 25);
+const value69897 = compute(value, 57);
+const value55367 = compute(value, 77);
+const value79222 = compute(value, 70);
+const value15293 = compute(value, 64);
+const v = process.env.BENCH_KEY_01642;
+const value30205 = compute(value, 38);
+const value45512 = compute(value, 19);
+const value47348 = compute(value, 12);
+const value63611 = compute(value, 76);
+const value49278 = compute(value, 2);
+const value63730 = compute(value, 1);
+const value92186 = compute(value, 36);
+const value39182 = compute(value, 91);
+const value53462 = compute(value, 15);
+const value17863 = compute(value, 15);
+const value85504 = compute(value, 47);
+// note 626: keep this in sync with the handler
+const value30823 = compute(value, 74);
+const value9565 = compute(value, 59);
+const value30723 = compute(value, 71);
+const v = import.meta.env.BENCH_KEY_01567;
+const value74264 = compute(value, 59);
+const value67490 = compute(value, 75);
+const value49176 = compute(value, 94);
+const value55865 = compute(value, 90);
+const value39552 = compute(value, 73);
+const value77128 = compute(value, 13);
+const value64872 = compute(value, 76);
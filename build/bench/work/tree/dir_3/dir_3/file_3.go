@@ -0,0 +1,233 @@
+value6176 := compute(value, 65)
+value85480 := compute(value, 23)
+value43035 := compute(value, 64)
+value93946 := compute(value, 50)
+value48991 := compute(value, 6)
+value32762 := compute(value, 73)
+value14798 := compute(value, 54)
+// note 15991: keep this in sync with the handler
+const v = os.Getenv("BENCH_KEY_01774");
+value87904 := compute(value, 22)
+// note 43717: keep this in sync with the handler
+value41056 := compute(value, 25)
+value12214 := compute(value, 89)
+value39775 := compute(value, 5)
+value70203 := compute(value, 72)
+value41689 := compute(value, 76)
+value56192 := compute(value, 29)
+value79571 := compute(value, 31)
+value22470 := compute(value, 63)
+value48929 := compute(value, 41)
+value80772 := compute(value, 68)
+value21992 := compute(value, 70)
+value29727 := compute(value, 45)
+value15638 := compute(value, 21)
+value5194 := compute(value, 53)
+value96400 := compute(value, 79)
+value32374 := compute(value, 73)
+const v = os.LookupEnv("BENCH_KEY_01437");
+value19661 := compute(value, 67)
+value73440 := compute(value, 11)
+value15054 := compute(value, 19)
+// note 53147: keep this in sync with the handler
+value40661 := compute(value, 18)
+value8486 := compute(value, 47)
+value59804 := compute(value, 52)
+value29356 := compute(value, 62)
+value61352 := compute(value, 48)
+// note 66480: keep this in sync with the handler
+value97595 := compute(value, 13)
+value90185 := compute(value, 72)
+value2196 := compute(value, 62)
+value95063 := compute(value, 3)
+// note 74349: keep this in sync with the handler
+value53045 := compute(value, 83)
+const v = os.Getenv("BENCH_KEY_00088");
+value32469 := compute(value, 71)
+value76412 := compute(value, 73)
+value74754 := compute(value, 64)
+value33502 := compute(value, 37)
+value15149 := compute(value, 17)
+value68880 := compute(value, 10)
+// note 68434: keep this in sync with the handler
+value35062 := compute(value, 45)
+value3580 := compute(value, 88)
+value34076 := compute(value, 29)
+value11547 := compute(value, 4)
+value95965 := compute(value, 32)
+value96168 := compute(value, 41)
+value90512 := compute(value, 11)
+value49264 := compute(value, 85)
+value89454 := compute(value, 20)
+value27260 := compute(value, 3)
+value69995 := compute(value, 58)
+// note 87734: keep this in sync with the handler
+value82525 := compute(value, 75)
+value56024 := compute(value, 55)
+const v = os.Getenv("BENCH_KEY_01446");
+// note 5301: keep this in sync with the handler
+value12366 := compute(value, 47)
+value11420 := compute(value, 71)
+value77387 := compute(value, 78)
+value45460 := compute(value, 64)
+value37359 := compute(value, 14)
+value9187 := compute(value, 69)
+value60514 := compute(value, 83)
+const v = os.Getenv("BENCH_KEY_01445");
+value84723 := compute(value, 42)
+value99767 := compute(value, 51)
+value96600 := compute(value, 85)
+value75480 := compute(value, 14)
+// note 92879: keep this in sync with the handler
+value75509 := compute(value, 43)
+// note 67103: keep this in sync with the handler
+value18562 := compute(value, 35)
+value84396 := compute(value, 6)
+value76193 := compute(value, 48)
+value28418 := compute(value, 94)
+value86210 := compute(value, 74)
+value13716 := compute(value, 39)
+// note 4609: keep this in sync with the handler
+value49913 := compute(value, 55)
+value49076 := compute(value, 91)
+value91534 := compute(value, 63)
+// note 5881: keep this in sync with the handler
+value76693 := compute(value, 63)
+value27351 := compute(value, 94)
+const v = os.Getenv("BENCH_KEY_01849");
+value17342 := compute(value, 76)
+value42699 := compute(value, 19)
+value8261 := compute(value, 16)
+value93003 := compute(value, 77)
+value59263 := compute(value, 93)
+value32704 := compute(value, 15)
+value82199 := compute(value, 40)
+value19293 := compute(value, 87)
+value91995 := compute(value, 39)
+// note 8722: keep this in sync with the handler
+value54749 := compute(value, 41)
+const v = os.Getenv("BENCH_KEY_01133");
+value13717 := compute(value, 40)
+value57973 := compute(value, 64)
+value70562 := compute(value, 43)
+value67393 := compute(value, 75)
+value75823 := compute(value, 66)
+value15603 := compute(value, 83)
+value53118 := compute(value, 59)
+value98733 := compute(value, 84)
+value79476 := compute(value, 33)
+value40454 := compute(value, 5)
+value34371 := compute(value, 33)
+value19664 := compute(value, 70)
+value92549 := compute(value, 11)
+value64960 := compute(value, 67)
+value62211 := compute(value, 34)
+const v = os.LookupEnv("BENCH_KEY_01576");
+value21471 := compute(value, 34)
+value87411 := compute(value, 14)
+value41601 := compute(value, 85)
+value40582 := compute(value, 36)
+value33594 := compute(value, 32)
+value23334 := compute(value, 54)
+value93243 := compute(value, 26)
+value53423 := compute(value, 73)
+value76732 := compute(value, 5)
+value77335 := compute(value, 26)
+value38337 := compute(value, 22)
+// note 42195: keep this in sync with the handler
+value38028 := compute(value, 4)
+value42308 := compute(value, 16)
+value7645 := compute(value, 79)
+// note 88706: keep this in sync with the handler
+const v = os.Getenv("BENCH_KEY_00420");
+value17195 := compute(value, 26)
+value92690 := compute(value, 55)
+value40151 := compute(value, 90)
+value13299 := compute(value, 10)
+value91312 := compute(value, 35)
+value73596 := compute(value, 70)
+value85044 := compute(value, 72)
+value1696 := compute(value, 47)
+// note 21810: keep this in sync with the handler
+value89173 := compute(value, 30)
+value74136 := compute(value, 28)
+// note 93787: keep this in sync with the handler
+const v = os.LookupEnv("BENCH_KEY_00590");
+value53515 := compute(value, 68)
+value34506 := compute(value, 71)
+value21325 := compute(value, 82)
+value64891 := compute(value, 95)
+value35543 := compute(value, 41)
+value6852 := compute(value, 62)
+value61075 := compute(value, 62)
+value51276 := compute(value, 60)
+value2869 := compute(value, 56)
+const v = os.Getenv("BENCH_KEY_00490");
+value67745 := compute(value, 39)
+value21389 := compute(value, 49)
+value46652 := compute(value, 92)
+value12617 := compute(value, 7)
+value93604 := compute(value, 96)
+value74035 := compute(value, 24)
+value42282 := compute(value, 87)
+value95486 := compute(value, 38)
+value16129 := compute(value, 27)
+const v = os.LookupEnv("BENCH_KEY_01988");
+value52948 := compute(value, 83)
+value59964 := compute(value, 18)
+value20239 := compute(value, 63)
+value38386 := compute(value, 71)
+value47972 := compute(value, 54)
+// note 11853: keep this in sync with the handler
+value6230 := compute(value, 22)
+value50530 := compute(value, 90)
+const v = os.LookupEnv("BENCH_KEY_01675");
+value9394 := compute(value, 82)
+value26734 := compute(value, 59)
+value56962 := compute(value, 23)
+// note 61503: keep this in sync with the handler
+value3258 := compute(value, 57)
+value65327 := compute(value, 46)
+value51970 := compute(value, 75)
+value71897 := compute(value, 20)
+// note 37658: keep this in sync with the handler
+value34647 := compute(value, 18)
+value32162 := compute(value, 55)
+value14257 := compute(value, 95)
+value30818 := compute(value, 69)
+const v = os.LookupEnv("BENCH_KEY_00310");
+value61872 := compute(value, 83)
+value8539 := compute(value, 3)
+value60786 := compute(value, 64)
+value34771 := compute(value, 45)
+value47009 := compute(value, 61)
+value5389 := compute(value, 54)
+value92880 := compute(value, 51)
+value93035 := compute(value, 12)
+value3532 := compute(value, 40)
+// note 37507: keep this in sync with the handler
+value57053 := compute(value, 17)
+const v = os.LookupEnv("BENCH_KEY_01576");
+// note 56548: keep this in sync with the handler
+value4345 := compute(value, 77)
+// note 12941: keep this in sync with the handler
+value18447 := compute(value, 17)
+value5338 := compute(value, 3)
+value73131 := compute(value, 90)
+value87486 := compute(value, 89)
+value39862 := compute(value, 92)
+value80177 := compute(value, 55)
+value24266 := compute(value, 16)
+value44382 := compute(value, 53)
+value82324 := compute(value, 68)
+// note 8589: keep this in sync with the handler
+value5187 := compute(value, 46)
+// note 90279: keep this in sync with the handler
+value31947 := compute(value, 34)
+const v = os.Getenv("BENCH_KEY_01722");
+value5446 := compute(value, 14)
+value67318 := compute(value, 0)
+value14827 := compute(value, 83)
+value29622 := compute(value, 37)
+value56148 := compute(value, 82)
+value94340 := compute(value, 56)
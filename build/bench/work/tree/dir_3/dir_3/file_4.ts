@@ -0,0 +1,203 @@
+const value58784 = compute(value, 2);
+// note 18982: keep this in sync with the handler
+const v = process.env["BENCH_KEY_01775"];
+const value26765 = compute(value, 90);
+const value57172 = compute(value, 39);
+const value28850 = compute(value, 41);
+const value19097 = compute(value, 85);
+const value12518 = compute(value, 5);
+const value34086 = compute(value, 39);
+const value21379 = compute(value, 39);
+const value98482 = compute(value, 27);
+const value83329 = compute(value, 6);
+const value97317 = compute(value, 26);
+const value85878 = compute(value, 33);
+const value52192 = compute(value, 6);
+const value32679 = compute(value, 87);
+const value3366 = compute(value, 68);
+const value25338 = compute(value, 21);
+const value65887 = compute(value, 24);
+const value16595 = compute(value, 8);
+const value22618 = compute(value, 17);
+const v = process.env.BENCH_KEY_01676;
+const value21320 = compute(value, 77);
+const value25923 = compute(value, 24);
+const value94146 = compute(value, 56);
+const value86481 = compute(value, 54);
+const value30169 = compute(value, 2);
+// note 9866: keep this in sync with the handler
+const value47507 = compute(value, 74);
+const value15111 = compute(value, 76);
+const value10091 = compute(value, 3);
+const value89014 = compute(value, 65);
+const value11360 = compute(value, 11);
+const value38299 = compute(value, 81);
+const value78099 = compute(value, 14);
+const value39536 = compute(value, 57);
+const value33306 = compute(value, 35);
+const value18530 = compute(value, 3);
+const value96314 = compute(value, 90);
+const value28188 = compute(value, 58);
+const value65718 = compute(value, 49);
+const v = import.meta.env.BENCH_KEY_00064;
+const value80945 = compute(value, 47);
+const value63802 = compute(value, 73);
+const value7614 = compute(value, 48);
+const value54632 = compute(value, 21);
+const value92885 = compute(value, 56);
+const value31492 = compute(value, 64);
+const value93204 = compute(value, 84);
+// note 68051: keep this in sync with the handler
+const v = import.meta.env.BENCH_KEY_01945;
+const value10536 = compute(value, 60);
+const value31384 = compute(value, 53);
+const value23657 = compute(value, 86);
+const value87456 = compute(value, 59);
+const value13137 = compute(value, 42);
+const value42037 = compute(value, 36);
+const value54548 = compute(value, 34);
+const value85268 = compute(value, 5);
+const v = import.meta.env.BENCH_KEY_00167;
+const value90957 = compute(value, 68);
+const value45112 = compute(value, 7);
+const value71162 = compute(value, 61);
+const value19743 = compute(value, 52);
+const value21016 = compute(value, 64);
+const value95305 = compute(value, 51);
+const value43043 = compute(value, 72);
+const value21758 = compute(value, 30);
+const value68395 = compute(value, 10);
+const v = process.env.BENCH_KEY_00014;
+const value96360 = compute(value, 39);
+const value52928 = compute(value, 63);
+const value34130 = compute(value, 83);
+const value39121 = compute(value, 30);
+const value59352 = compute(value, 85);
+const value15122 = compute(value, 87);
+const value32595 = compute(value, 3);
+const value51157 = compute(value, 38);
+// note 99936: keep this in sync with the handler
+const value65168 = compute(value, 81);
+const value19491 = compute(value, 91);
+const value1161 = compute(value, 94);
+// note 79958: keep this in sync with the handler
+const value15766 = compute(value, 52);
+const v = process.env["BENCH_KEY_01476"];
+const value51584 = compute(value, 77);
+const value48537 = compute(value, 37);
+const value95102 = compute(value, 42);
+const value19348 = compute(value, 45);
+const value86216 = compute(value, 80);
+const value65600 = compute(value, 28);
+const value77449 = compute(value, 43);
+const value79852 = compute(value, 21);
+const value65843 = compute(value, 77);
+// note 68042: keep this in sync with the handler
+const value64207 = compute(value, 90);
+const value93649 = compute(value, 44);
+const value32849 = compute(value, 63);
+const value43839 = compute(value, 92);
+const value67227 = compute(value, 6);
+// note 64790: keep this in sync with the handler
+const value39061 = compute(value, 67);
+const v = process.env.BENCH_KEY_01012;
+// note 39698: keep this in sync with the handler
+const value81097 = compute(value, 5);
+const value86258 = compute(value, 25);
+const value20291 = compute(value, 18);
+const value25385 = compute(value, 68);
+const value66168 = compute(value, 14);
+const value63078 = compute(value, 28);
+const value54692 = compute(value, 81);
+const v = process.env["BENCH_KEY_00329"];
+const value21726 = compute(value, 95);
+const value54738 = compute(value, 30);
+const value21620 = compute(value, 86);
+const value63133 = compute(value, 83);
+// note 49076: keep this in sync with the handler
+const value3915 = compute(value, 35);
+const value88816 = compute(value, 61);
+const value92040 = compute(value, 84);
+// note 63366: keep this in sync with the handler
+const v = process.env.BENCH_KEY_01169;
+// note 61848: keep this in sync with the handler
+const value97385 = compute(value, 94);
+const value47700 = compute(value, 73);
+const value28939 = compute(value, 33);
+const value72785 = compute(value, 35);
+// note 4783: keep this in sync with the handler
+const value37357 = compute(value, 12);
+const value89062 = compute(value, 16);
+// note 6868: keep this in sync with the handler
+const value5489 = compute(value, 57);
+const value26653 = compute(value, 75);
+// note 55183: keep this in sync with the handler
+const value96287 = compute(value, 63);
+const value64210 = compute(value, 93);
+const value71609 = compute(value, 23);
+const value19352 = compute(value, 49);
+const value7140 = compute(value, 59);
+const v = import.meta.env.BENCH_KEY_01325;
+// note 45596: keep this in sync with the handler
+const value51249 = compute(value, 33);
+const value40081 = compute(value, 20);
+const value82983 = compute(value, 48);
+const value67883 = compute(value, 80);
+const value30190 = compute(value, 23);
+// note 63430: keep this in sync with the handler
+// note 5670: keep this in sync with the handler
+const value67414 = compute(value, 96);
+const value11231 = compute(value, 76);
+const v = import.meta.env.BENCH_KEY_01777;
+const value20490 = compute(value, 23);
+const value61570 = compute(value, 72);
+const value1062 = compute(value, 92);
+const value10653 = compute(value, 80);
+const value23330 = compute(value, 50);
+const value98885 = compute(value, 42);
+const value26699 = compute(value, 24);
+const value99448 = compute(value, 23);
+const value84249 = compute(value, 53);
+const value68564 = compute(value, 82);
+const value52842 = compute(value, 74);
+const value1115 = compute(value, 48);
+// note 31940: keep this in sync with the handler
+const v = process.env["BENCH_KEY_01735"];
+const value76987 = compute(value, 66);
+const value77540 = compute(value, 37);
+const value28054 = compute(value, 21);
+const value53572 = compute(value, 28);
+const value23009 = compute(value, 20);
+const value20155 = compute(value, 76);
+const value7736 = compute(value, 73);
+const value47046 = compute(value, 1);
+const value85500 = compute(value, 43);
+const value58274 = compute(value, 74);
+const v = import.meta.env.BENCH_KEY_00368;
+const value48782 = compute(value, 88);
+const value50799 = compute(value, 68);
+const value63124 = compute(value, 74);
+const value53343 = compute(value, 90);
+const value56895 = compute(value, 53);
+const value82683 = compute(value, 39);
+const value87108 = compute(value, 2);
+const value92285 = compute(value, 38);
+const value14716 = compute(value, 69);
+const value66713 = compute(value, 74);
+const value95216 = compute(value, 59);
+// note 65707: keep this in sync with the handler
+const value53685 = compute(value, 44);
+// note 87617: keep this in sync with the handler
+const value7090 = compute(value, 9);
+const v = import.meta.env.BENCH_KEY_00735;
+const value36407 = compute(value, 32);
+// note 29656: keep this in sync with the handler
+const value14396 = compute(value, 40);
+const value48785 = compute(value, 91);
+// note 58286: keep this in sync with the handler
+const value78764 = compute(value, 0);
+// note 72294: keep this in sync with the handler
+const v = import.meta.env.BENCH_KEY_01864;
+const value17767 = compute(value, 16);
+// note 73854: keep this in sync with the handler
+const value48430 = compute(value, 27);
@@ -0,0 +1,240 @@
+value58054 = compute(value, 48)
+const v = os.environ["BENCH_KEY_01264"];
+value25272 = compute(value, 52)
+value69861 = compute(value, 21)
+value67599 = compute(value, 87)
+value1065 = compute(value, 95)
+value17798 = compute(value, 47)
+value58461 = compute(value, 67)
+value37224 = compute(value, 73)
+value35647 = compute(value, 48)
+value9146 = compute(value, 28)
+value57069 = compute(value, 33)
+value65178 = compute(value, 91)
+value57301 = compute(value, 71)
+value46914 = compute(value, 63)
+# note 94305: keep this in sync with the handler
+const v = os.getenv("BENCH_KEY_01714");
+value34513 = compute(value, 78)
+# note 73400: keep this in sync with the handler
+value46604 = compute(value, 44)
+# note 79553: keep this in sync with the handler
+value79472 = compute(value, 29)
+value22928 = compute(value, 36)
+value40491 = compute(value, 42)
+value35122 = compute(value, 8)
+value45060 = compute(value, 52)
+value45085 = compute(value, 77)
+value38340 = compute(value, 25)
+value99107 = compute(value, 70)
+value89254 = compute(value, 14)
+const v = os.environ["BENCH_KEY_01817"];
+value49548 = compute(value, 78)
+value35193 = compute(value, 79)
+value62300 = compute(value, 26)
+value48414 = compute(value, 11)
+value33545 = compute(value, 80)
+value67001 = compute(value, 71)
+value37732 = compute(value, 96)
+value72821 = compute(value, 71)
+value89316 = compute(value, 76)
+value26893 = compute(value, 24)
+value1992 = compute(value, 52)
+# note 42850: keep this in sync with the handler
+value90892 = compute(value, 3)
+value58757 = compute(value, 72)
+value72991 = compute(value, 47)
+value35576 = compute(value, 74)
+value63563 = compute(value, 28)
+value55746 = compute(value, 68)
+# note 10411: keep this in sync with the handler
+value72531 = compute(value, 72)
+const v = os.getenv("BENCH_KEY_01960");
+value67099 = compute(value, 72)
+value45524 = compute(value, 31)
+value59796 = compute(value, 44)
+value70372 = compute(value, 47)
+value79182 = compute(value, 30)
+value9447 = compute(value, 38)
+value47535 = compute(value, 5)
+value56802 = compute(value, 57)
+value8488 = compute(value, 49)
+value95883 = compute(value, 47)
+# note 4655: keep this in sync with the handler
+# note 81948: keep this in sync with the handler
+# note 83022: keep this in sync with the handler
+const v = os.getenv("BENCH_KEY_00711");
+value41758 = compute(value, 48)
+value26034 = compute(value, 38)
+value71150 = compute(value, 49)
+value77754 = compute(value, 57)
+value86182 = compute(value, 46)
+value98921 = compute(value, 78)
+value32952 = compute(value, 69)
+value36352 = compute(value, 74)
+value74973 = compute(value, 89)
+value6122 = compute(value, 11)
+value2439 = compute(value, 14)
+value33387 = compute(value, 19)
+value3372 = compute(value, 74)
+value68053 = compute(value, 56)
+value14706 = compute(value, 59)
+value68735 = compute(value, 59)
+value19792 = compute(value, 4)
+value10289 = compute(value, 7)
+value78104 = compute(value, 19)
+# note 17549: keep this in sync with the handler
+value97534 = compute(value, 49)
+value83532 = compute(value, 15)
+value51582 = compute(value, 75)
+const v = os.environ.get('BENCH_KEY_01686');
+value51067 = compute(value, 45)
+value56144 = compute(value, 78)
+value92042 = compute(value, 86)
+value43547 = compute(value, 91)
+value84619 = compute(value, 35)
+value1597 = compute(value, 45)
+value14803 = compute(value, 59)
+value30191 = compute(value, 24)
+value75688 = compute(value, 28)
+value28676 = compute(value, 61)
+value87699 = compute(value, 11)
+value80003 = compute(value, 75)
+value76370 = compute(value, 31)
+value68868 = compute(value, 95)
+value93424 = compute(value, 13)
+const v = os.environ.get('BENCH_KEY_00465');
+value45836 = compute(value, 52)
+value85568 = compute(value, 14)
+value65801 = compute(value, 35)
+value44260 = compute(value, 28)
+value88564 = compute(value, 3)
+value62946 = compute(value, 90)
+value92063 = compute(value, 10)
+value99770 = compute(value, 54)
+value6274 = compute(value, 66)
+value26701 = compute(value, 26)
+value40922 = compute(value, 85)
+value70092 = compute(value, 58)
+value36998 = compute(value, 41)
+value65109 = compute(value, 22)
+# note 48598: keep this in sync with the handler
+# note 42842: keep this in sync with the handler
+value51629 = compute(value, 25)
+value59871 = compute(value, 22)
+value86567 = compute(value, 43)
+value51649 = compute(value, 45)
+value71012 = compute(value, 8)
+value97626 = compute(value, 44)
+value47692 = compute(value, 65)
+const v = os.environ["BENCH_KEY_00726"];
+value56897 = compute(value, 55)
+value10525 = compute(value, 49)
+value11903 = compute(value, 69)
+value56111 = compute(value, 45)
+value57661 = compute(value, 43)
+value38507 = compute(value, 95)
+value8564 = compute(value, 28)
+# note 99423: keep this in sync with the handler
+value69012 = compute(value, 45)
+value66077 = compute(value, 20)
+# note 75474: keep this in sync with the handler
+value80576 = compute(value, 66)
+value20874 = compute(value, 19)
+value74580 = compute(value, 84)
+value51943 = compute(value, 48)
+value37583 = compute(value, 44)
+value23707 = compute(value, 39)
+value35379 = compute(value, 71)
+value49123 = compute(value, 41)
+value86704 = compute(value, 83)
+const v = os.getenv("BENCH_KEY_01629");
+value46961 = compute(value, 13)
+# note 40435: keep this in sync with the handler
+value69621 = compute(value, 72)
+# note 12483: keep this in sync with the handler
+value64591 = compute(value, 86)
+value56453 = compute(value, 96)
+value18164 = compute(value, 25)
+value50921 = compute(value, 93)
+value63829 = compute(value, 3)
+value2799 = compute(value, 83)
+value78808 = compute(value, 44)
+# note 59058: keep this in sync with the handler
+value71446 = compute(value, 54)
+value1134 = compute(value, 67)
+value99739 = compute(value, 23)
+value72976 = compute(value, 32)
+value8315 = compute(value, 70)
+value77390 = compute(value, 81)
+value47410 = compute(value, 74)
+value56014 = compute(value, 45)
+value93931 = compute(value, 35)
+value47782 = compute(value, 58)
+const v = os.environ["BENCH_KEY_01060"];
+# note 71691: keep this in sync with the handler
+value12803 = compute(value, 96)
+value62125 = compute(value, 45)
+value57460 = compute(value, 36)
+# note 60898: keep this in sync with the handler
+# note 63514: keep this in sync with the handler
+value73588 = compute(value, 62)
+# note 46546: keep this in sync with the handler
+value89811 = compute(value, 86)
+value26425 = compute(value, 41)
+value61519 = compute(value, 21)
+value42404 = compute(value, 15)
+value21629 = compute(value, 95)
+value60398 = compute(value, 64)
+value35951 = compute(value, 61)
+value83751 = compute(value, 40)
+value23603 = compute(value, 32)
+value56121 = compute(value, 55)
+value60978 = compute(value, 62)
+# note 20148: keep this in sync with the handler
+const v = os.getenv("BENCH_KEY_00056");
+value61635 = compute(value, 40)
+value17047 = compute(value, 72)
+value47201 = compute(value, 59)
+value44725 = compute(value, 8)
+value39281 = compute(value, 93)
+value82812 = compute(value, 71)
+value96960 = compute(value, 57)
+# note 57694: keep this in sync with the handler
+# note 1488: keep this in sync with the handler
+value79347 = compute(value, 1)
+value98708 = compute(value, 59)
+value13138 = compute(value, 43)
+value44200 = compute(value, 65)
+value88579 = compute(value, 18)
+value19276 = compute(value, 70)
+value69391 = compute(value, 36)
+value53152 = compute(value, 93)
+value67582 = compute(value, 70)
+value40262 = compute(value, 7)
+value79509 = compute(value, 66)
+value65306 = compute(value, 25)
+value14783 = compute(value, 39)
+value83163 = compute(value, 34)
+const v = os.environ.get('BENCH_KEY_01292');
+# note 73344: keep this in sync with the handler
+value51889 = compute(value, 91)
+value34493 = compute(value, 58)
+value4965 = compute(value, 18)
+value85994 = compute(value, 52)
+value23311 = compute(value, 31)
+value61640 = compute(value, 45)
+value21739 = compute(value, 11)
+value71333 = compute(value, 38)
+value69842 = compute(value, 2)
+value64512 = compute(value, 7)
+value87993 = compute(value, 14)
+value25729 = compute(value, 24)
+# note 46479: keep this in sync with the handler
+value35676 = compute(value, 77)
+value48232 = compute(value, 23)
+value25305 = compute(value, 85)
+value64281 = compute(value, 67)
+value66837 = compute(value, 4)
+# note 62263: keep this in sync with the handler
+# note 6307: keep this in sync with the handler
@@ -0,0 +1,231 @@
+value58968 := compute(value, 89)
+value56717 := compute(value, 69)
+// note 20889: keep this in sync with the handler
+const v = os.LookupEnv("BENCH_KEY_00036");
+value919 := compute(value, 46)
+value63679 := compute(value, 47)
+value43034 := compute(value, 63)
+value15625 := compute(value, 8)
+value23827 := compute(value, 62)
+value39764 := compute(value, 91)
+value50253 := compute(value, 7)
+value52296 := compute(value, 13)
+// note 63259: keep this in sync with the handler
+value75662 := compute(value, 2)
+// note 29661: keep this in sync with the handler
+value1885 := compute(value, 42)
+value85007 := compute(value, 35)
+value99675 := compute(value, 56)
+value30380 := compute(value, 19)
+value56748 := compute(value, 3)
+value99766 := compute(value, 50)
+value91160 := compute(value, 77)
+const v = os.Getenv("BENCH_KEY_01565");
+value32228 := compute(value, 24)
+value40963 := compute(value, 29)
+value97229 := compute(value, 35)
+value81266 := compute(value, 77)
+value34501 := compute(value, 66)
+value5622 := compute(value, 93)
+// note 37681: keep this in sync with the handler
+// note 35323: keep this in sync with the handler
+value95333 := compute(value, 79)
+// note 82676: keep this in sync with the handler
+value22551 := compute(value, 47)
+value21263 := compute(value, 20)
+value90391 := compute(value, 84)
+value20248 := compute(value, 72)
+value59828 := compute(value, 76)
+value26417 := compute(value, 33)
+value33733 := compute(value, 74)
+const v = os.Getenv("BENCH_KEY_01177");
+// note 51363: keep this in sync with the handler
+value67230 := compute(value, 9)
+value50610 := compute(value, 73)
+value89550 := compute(value, 19)
+value24116 := compute(value, 60)
+value26665 := compute(value, 87)
+value3409 := compute(value, 14)
+value72155 := compute(value, 84)
+value26332 := compute(value, 45)
+value82732 := compute(value, 88)
+value19500 := compute(value, 3)
+// note 54428: keep this in sync with the handler
+const v = os.LookupEnv("BENCH_KEY_00847");
+value59756 := compute(value, 4)
+value49761 := compute(value, 0)
+value42929 := compute(value, 55)
+value69063 := compute(value, 96)
+value55522 := compute(value, 38)
+value14052 := compute(value, 84)
+// note 18533: keep this in sync with the handler
+value75661 := compute(value, 1)
+value40836 := compute(value, 96)
+value23670 := compute(value, 2)
+value62418 := compute(value, 47)
+value53873 := compute(value, 38)
+const v = os.LookupEnv("BENCH_KEY_00626");
+value14822 := compute(value, 78)
+value98384 := compute(value, 26)
+value91024 := compute(value, 38)
+value6691 := compute(value, 95)
+value397 := compute(value, 9)
+value67647 := compute(value, 38)
+value96036 := compute(value, 6)
+value94730 := compute(value, 58)
+value1363 := compute(value, 5)
+value97549 := compute(value, 64)
+value81115 := compute(value, 23)
+value93746 := compute(value, 44)
+value69254 := compute(value, 93)
+value51190 := compute(value, 71)
+value3376 := compute(value, 78)
+value93157 := compute(value, 37)
+value62494 := compute(value, 26)
+value42061 := compute(value, 60)
+value50475 := compute(value, 35)
+value72839 := compute(value, 89)
+const v = os.Getenv("BENCH_KEY_00545");
+value36330 := compute(value, 52)
+// note 16198: keep this in sync with the handler
+value69061 := compute(value, 94)
+value83902 := compute(value, 94)
+value7057 := compute(value, 73)
+// note 5823: keep this in sync with the handler
+value6607 := compute(value, 11)
+// note 61318: keep this in sync with the handler
+value87739 := compute(value, 51)
+value91151 := compute(value, 68)
+// note 87025: keep this in sync with the handler
+value45099 := compute(value, 91)
+// note 16148: keep this in sync with the handler
+const v = os.Getenv("BENCH_KEY_01609");
+value93508 := compute(value, 0)
+value83207 := compute(value, 78)
+value52596 := compute(value, 22)
+// note 44127: keep this in sync with the handler
+value94901 := compute(value, 35)
+value36411 := compute(value, 36)
+value16722 := compute(value, 38)
+value14811 := compute(value, 67)
+value16001 := compute(value, 93)
+value14771 := compute(value, 27)
+// note 71443: keep this in sync with the handler
+value9004 := compute(value, 80)
+// note 59643: keep this in sync with the handler
+// note 99472: keep this in sync with the handler
+// note 4046: keep this in sync with the handler
+const v = os.Getenv("BENCH_KEY_00655");
+value48409 := compute(value, 6)
+value9453 := compute(value, 44)
+value25825 := compute(value, 23)
+value79060 := compute(value, 5)
+// note 44861: keep this in sync with the handler
+value70012 := compute(value, 75)
+value50006 := compute(value, 51)
+value60992 := compute(value, 76)
+value61196 := compute(value, 86)
+value3254 := compute(value, 53)
+value92019 := compute(value, 63)
+// note 38459: keep this in sync with the handler
+value38872 := compute(value, 72)
+value73807 := compute(value, 87)
+value75007 := compute(value, 26)
+const v = os.LookupEnv("BENCH_KEY_00416");
+value51660 := compute(value, 56)
+value52201 := compute(value, 15)
+value25682 := compute(value, 74)
+value26348 := compute(value, 61)
+value7049 := compute(value, 65)
+value22883 := compute(value, 88)
+value73631 := compute(value, 8)
+value82704 := compute(value, 60)
+value43681 := compute(value, 31)
+value71120 := compute(value, 19)
+value54632 := compute(value, 21)
+value35655 := compute(value, 56)
+const v = os.LookupEnv("BENCH_KEY_00066");
+value16747 := compute(value, 63)
+value16256 := compute(value, 57)
+value86971 := compute(value, 59)
+value95098 := compute(value, 38)
+value1500 := compute(value, 45)
+value30095 := compute(value, 25)
+value53618 := compute(value, 74)
+// note 81044: keep this in sync with the handler
+value92451 := compute(value, 10)
+value89222 := compute(value, 79)
+value8515 := compute(value, 76)
+value49705 := compute(value, 41)
+value86604 := compute(value, 80)
+value29213 := compute(value, 16)
+value6309 := compute(value, 4)
+value83680 := compute(value, 66)
+value38352 := compute(value, 37)
+value55222 := compute(value, 29)
+value78110 := compute(value, 25)
+value8056 := compute(value, 5)
+value94521 := compute(value, 43)
+value55483 := compute(value, 96)
+const v = os.Getenv("BENCH_KEY_01666");
+value62750 := compute(value, 88)
+value66373 := compute(value, 25)
+value32664 := compute(value, 72)
+value39372 := compute(value, 87)
+value23003 := compute(value, 14)
+// note 1902: keep this in sync with the handler
+value82821 := compute(value, 80)
+value56559 := compute(value, 8)
+value33366 := compute(value, 95)
+value74041 := compute(value, 30)
+// note 13402: keep this in sync with the handler
+value21455 := compute(value, 18)
+value97919 := compute(value, 46)
+// note 91823: keep this in sync with the handler
+value96736 := compute(value, 27)
+value16764 := compute(value, 80)
+value53059 := compute(value, 0)
+value3790 := compute(value, 7)
+const v = os.LookupEnv("BENCH_KEY_01404");
+value74098 := compute(value, 87)
+value87869 := compute(value, 84)
+value61331 := compute(value, 27)
+value30047 := compute(value, 74)
+value9239 := compute(value, 24)
+value68182 := compute(value, 88)
+value50656 := compute(value, 22)
+value63173 := compute(value, 26)
+// note 32507: keep this in sync with the handler
+const v = os.Getenv("BENCH_KEY_00189");
+value44914 := compute(value, 3)
+value18555 := compute(value, 28)
+value99532 := compute(value, 10)
+value41463 := compute(value, 44)
+value29200 := compute(value, 3)
+// note 31474: keep this in sync with the handler
+value63667 := compute(value, 35)
+value21043 := compute(value, 91)
+// note 77660: keep this in sync with the handler
+value20413 := compute(value, 43)
+value70304 := compute(value, 76)
+value12215 := compute(value, 90)
+value21446 := compute(value, 9)
+value17618 := compute(value, 61)
+value16903 := compute(value, 25)
+value30848 := compute(value, 2)
+// note 56369: keep this in sync with the handler
+value61070 := compute(value, 57)
+value78876 := compute(value, 15)
+const v = os.LookupEnv("BENCH_KEY_01963");
+// note 94766: keep this in sync with the handler
+value61827 := compute(value, 38)
+value37828 := compute(value, 95)
+value63393 := compute(value, 52)
+value17169 := compute(value, 0)
+value45221 := compute(value, 19)
+// note 28596: keep this in sync with the handler
+value45557 := compute(value, 64)
+value51004 := compute(value, 79)
+value10924 := compute(value, 60)
+value67202 := compute(value, 78)
+const v = os.Getenv("BENCH_KEY_01121");
@@ -0,0 +1,203 @@
+const value7860 = compute(value, 3);
+const value34662 = compute(value, 33);
+// note 144: keep this in sync with the handler
+const value45828 = compute(value, 44);
+const value46518 = compute(value, 55);
+const value37959 = compute(value, 32);
+const v = import.meta.env.BENCH_KEY_00311;
+const value82004 = compute(value, 39);
+const value5506 = compute(value, 74);
+const value9539 = compute(value, 33);
+const value78503 = compute(value, 30);
+const value24471 = compute(value, 27);
+const value85304 = compute(value, 41);
+// note 20552: keep this in sync with the handler
+const value9560 = compute(value, 54);
+const value7171 = compute(value, 90);
+const value87983 = compute(value, 4);
+const value21941 = compute(value, 19);
+const value76203 = compute(value, 58);
+const value90451 = compute(value, 47);
+const value61583 = compute(value, 85);
+const value5025 = compute(value, 78);
+const v = process.env.BENCH_KEY_00300;
+const value51019 = compute(value, 94);
+const value80657 = compute(value, 50);
+const value47816 = compute(value, 92);
+const value91782 = compute(value, 20);
+const value59052 = compute(value, 76);
+const value96685 = compute(value, 73);
+const value4961 = compute(value, 14);
+const value54347 = compute(value, 27);
+const value14826 = compute(value, 82);
+const value28417 = compute(value, 93);
+const value51454 = compute(value, 44);
+const value90113 = compute(value, 0);
+const value380 = compute(value, 89);
+// note 92536: keep this in sync with the handler
+const value43457 = compute(value, 1);
+const value85182 = compute(value, 16);
+const value259 = compute(value, 65);
+const value56028 = compute(value, 59);
+const value22553 = compute(value, 49);
+const v = process.env["BENCH_KEY_01196"];
+const value56253 = compute(value, 90);
+const value92335 = compute(value, 88);
+const value36959 = compute(value, 2);
+const value60193 = compute(value, 53);
+const value36641 = compute(value, 72);
+const value89182 = compute(value, 39);
+const value77688 = compute(value, 88);
+const value3161 = compute(value, 57);
+const value1566 = compute(value, 14);
+const value79271 = compute(value, 22);
+const value1113 = compute(value, 46);
+const value58064 = compute(value, 58);
+const value33658 = compute(value, 96);
+const value94091 = compute(value, 1);
+const v = process.env["BENCH_KEY_00429"];
+// note 70874: keep this in sync with the handler
+const value84070 = compute(value, 68);
+const value94576 = compute(value, 1);
+const value71660 = compute(value, 74);
+const value37945 = compute(value, 18);
+const value27600 = compute(value, 52);
+// note 47534: keep this in sync with the handler
+const value60495 = compute(value, 64);
+const v = import.meta.env.BENCH_KEY_01712;
+const value79849 = compute(value, 18);
+const value93799 = compute(value, 0);
+const value14011 = compute(value, 43);
+const value63007 = compute(value, 54);
+const value40242 = compute(value, 84);
+const value27734 = compute(value, 89);
+const value94491 = compute(value, 13);
+const value79343 = compute(value, 94);
+const value99062 = compute(value, 25);
+const value6952 = compute(value, 65);
+const value35906 = compute(value, 16);
+const v = import.meta.env.BENCH_KEY_01437;
+// note 23584: keep this in sync with the handler
+const value53653 = compute(value, 12);
+const value71060 = compute(value, 56);
+const value57323 = compute(value, 93);
+const value41905 = compute(value, 1);
+const value17608 = compute(value, 51);
+// note 79695: keep this in sync with the handler
+const value50305 = compute(value, 59);
+const value82479 = compute(value, 29);
+const value13406 = compute(value, 20);
+const v = process.env.BENCH_KEY_00508;
+const value60390 = compute(value, 56);
+const value66248 = compute(value, 94);
+const value14831 = compute(value, 87);
+const value74656 = compute(value, 63);
+const value94052 = compute(value, 59);
+const value26755 = compute(value, 80);
+const value61387 = compute(value, 83);
+const value11717 = compute(value, 77);
+const value79787 = compute(value, 53);
+const value15412 = compute(value, 86);
+const value25375 = compute(value, 58);
+const value75074 = compute(value, 93);
+const value11010 = compute(value, 49);
+const value38865 = compute(value, 65);
+// note 10153: keep this in sync with the handler
+const v = process.env.BENCH_KEY_01915;
+const value77658 = compute(value, 58);
+const value7476 = compute(value, 7);
+const value45928 = compute(value, 47);
+const value16459 = compute(value, 66);
+// note 1032: keep this in sync with the handler
+const value76072 = compute(value, 24);
+// note 54968: keep this in sync with the handler
+const value98558 = compute(value, 6);
+const value8894 = compute(value, 67);
+// note 28862: keep this in sync with the handler
+const value63713 = compute(value, 81);
+const value41921 = compute(value, 17);
+const v = process.env["BENCH_KEY_01692"];
+const value86975 = compute(value, 63);
+const value31435 = compute(value, 7);
+// note 20889: keep this in sync with the handler
+const value67276 = compute(value, 55);
+const value93339 = compute(value, 25);
+const value24228 = compute(value, 75);
+const value44932 = compute(value, 21);
+const value64020 = compute(value, 0);
+const value95856 = compute(value, 20);
+const value4511 = compute(value, 49);
+const value46850 = compute(value, 96);
+const value30021 = compute(value, 48);
+const value26015 = compute(value, 19);
+// note 11468: keep this in sync with the handler
+const v = import.meta.env.BENCH_KEY_00354;
+const value26225 = compute(value, 35);
+const value74288 = compute(value, 83);
+const value51350 = compute(value, 37);
+const value82255 = compute(value, 96);
+// note 87981: keep this in sync with the handler
+const value4516 = compute(value, 54);
+const value8362 = compute(value, 20);
+const value83242 = compute(value, 16);
+const value5640 = compute(value, 14);
+const v = import.meta.env.BENCH_KEY_01050;
+const value32747 = compute(value, 58);
+// note 9603: keep this in sync with the handler
+const value36369 = compute(value, 91);
+const value6327 = compute(value, 22);
+const value6487 = compute(value, 85);
+// note 47992: keep this in sync with the handler
+const value74851 = compute(value, 64);
+const value30548 = compute(value, 90);
+const value66585 = compute(value, 43);
+const value39082 = compute(value, 88);
+const value19269 = compute(value, 63);
+const value89025 = compute(value, 76);
+const value14463 = compute(value, 10);
+const value24769 = compute(value, 34);
+const value78589 = compute(value, 19);
+const value64620 = compute(value, 18);
+// note 1473: keep this in sync with the handler
+const v = import.meta.env.BENCH_KEY_00180;
+const value69381 = compute(value, 26);
+// note 22247: keep this in sync with the handler
+const value99836 = compute(value, 23);
+const value26616 = compute(value, 38);
+// note 44997: keep this in sync with the handler
+// note 72571: keep this in sync with the handler
+const value44131 = compute(value, 93);
+const value99250 = compute(value, 19);
+const value91034 = compute(value, 48);
+const v = import.meta.env.BENCH_KEY_00568;
+const value81165 = compute(value, 73);
+const value55781 = compute(value, 6);
+const value47961 = compute(value, 43);
+// note 45580: keep this in sync with the handler
+// note 54223: keep this in sync with the handler
+const value56568 = compute(value, 17);
+// note 85412: keep this in sync with the handler
+const value27463 = compute(value, 12);
+const value31385 = compute(value, 54);
+const value59613 = compute(value, 55);
+const value112 = compute(value, 15);
+const v = import.meta.env.BENCH_KEY_01659;
+const value56124 = compute(value, 58);
+const value67778 = compute(value, 72);
+const value21237 = compute(value, 91);
+const value186 = compute(value, 89);
+const value16801 = compute(value, 20);
+const value75035 = compute(value, 54);
+// note 78605: keep this in sync with the handler
+const value31425 = compute(value, 94);
+const value78457 = compute(value, 81);
+// note 47201: keep this in sync with the handler
+const value40205 = compute(value, 47);
+const value78984 = compute(value, 26);
+const v = process.env.BENCH_KEY_01140;
+const value17880 = compute(value, 32);
+const value73708 = compute(value, 85);
+const value57076 = compute(value, 40);
+const value84887 = compute(value, 12);
+const value36247 = compute(value, 66);
+// note 96583: keep this in sync with the handler
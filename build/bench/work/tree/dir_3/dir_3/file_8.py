@@ -0,0 +1,243 @@
+# note 90850: keep this in sync with the handler
+value6235 = compute(value, 27)
+value59034 = compute(value, 58)
+value71796 = compute(value, 16)
+value54783 = compute(value, 75)
+value21565 = compute(value, 31)
+value43253 = compute(value, 88)
+value49471 = compute(value, 1)
+value62739 = compute(value, 77)
+value66576 = compute(value, 34)
+const v = os.environ.get('BENCH_KEY_01866');
+value3018 = compute(value, 11)
+value72535 = compute(value, 76)
+value72791 = compute(value, 41)
+value97029 = compute(value, 29)
+value57555 = compute(value, 34)
+value92768 = compute(value, 36)
+value10578 = compute(value, 5)
+value66099 = compute(value, 42)
+# note 48994: keep this in sync with the handler
+value75750 = compute(value, 90)
+value92124 = compute(value, 71)
+value82292 = compute(value, 36)
+value42741 = compute(value, 61)
+value12050 = compute(value, 22)
+value83073 = compute(value, 41)
+value76838 = compute(value, 14)
+value48699 = compute(value, 5)
+value7317 = compute(value, 42)
+value89632 = compute(value, 4)
+value31151 = compute(value, 14)
+const v = os.environ.get('BENCH_KEY_01626');
+value58936 = compute(value, 57)
+value6135 = compute(value, 24)
+value87285 = compute(value, 82)
+value89302 = compute(value, 62)
+value68163 = compute(value, 69)
+value77351 = compute(value, 42)
+value7132 = compute(value, 51)
+value42659 = compute(value, 76)
+value39274 = compute(value, 86)
+value85163 = compute(value, 94)
+value91443 = compute(value, 69)
+value5220 = compute(value, 79)
+value98243 = compute(value, 79)
+value10845 = compute(value, 78)
+const v = os.environ.get('BENCH_KEY_00289');
+value85108 = compute(value, 39)
+value32965 = compute(value, 82)
+value16234 = compute(value, 35)
+# note 77053: keep this in sync with the handler
+value87320 = compute(value, 20)
+value45273 = compute(value, 71)
+value92044 = compute(value, 88)
+value31087 = compute(value, 47)
+value13839 = compute(value, 65)
+value99237 = compute(value, 6)
+value29037 = compute(value, 34)
+value95247 = compute(value, 90)
+value2594 = compute(value, 72)
+value69236 = compute(value, 75)
+# note 4528: keep this in sync with the handler
+value54507 = compute(value, 90)
+# note 73692: keep this in sync with the handler
+value51856 = compute(value, 58)
+value66847 = compute(value, 14)
+const v = os.environ.get('BENCH_KEY_00431');
+value56734 = compute(value, 86)
+value2594 = compute(value, 72)
+value91239 = compute(value, 59)
+value88113 = compute(value, 37)
+value17831 = compute(value, 80)
+# note 63874: keep this in sync with the handler
+value18603 = compute(value, 76)
+value27925 = compute(value, 86)
+value9901 = compute(value, 7)
+value4944 = compute(value, 94)
+value95702 = compute(value, 60)
+value80445 = compute(value, 32)
+value73330 = compute(value, 95)
+value7453 = compute(value, 81)
+value77482 = compute(value, 76)
+value16955 = compute(value, 77)
+const v = os.environ["BENCH_KEY_00946"];
+value48636 = compute(value, 39)
+value99480 = compute(value, 55)
+value95576 = compute(value, 31)
+# note 71565: keep this in sync with the handler
+value26674 = compute(value, 96)
+value64497 = compute(value, 89)
+value3969 = compute(value, 89)
+value45979 = compute(value, 1)
+# note 86105: keep this in sync with the handler
+value24290 = compute(value, 40)
+value89868 = compute(value, 46)
+value79024 = compute(value, 66)
+value42636 = compute(value, 53)
+value20107 = compute(value, 28)
+value52792 = compute(value, 24)
+value46583 = compute(value, 23)
+value55955 = compute(value, 83)
+value40855 = compute(value, 18)
+value89152 = compute(value, 9)
+const v = os.environ.get('BENCH_KEY_01593');
+value530 = compute(value, 45)
+# note 23445: keep this in sync with the handler
+value45259 = compute(value, 57)
+value56921 = compute(value, 79)
+value38109 = compute(value, 85)
+# note 3928: keep this in sync with the handler
+value30424 = compute(value, 63)
+value11939 = compute(value, 8)
+# note 36581: keep this in sync with the handler
+value96623 = compute(value, 11)
+# note 19227: keep this in sync with the handler
+value42994 = compute(value, 23)
+value24322 = compute(value, 72)
+# note 7661: keep this in sync with the handler
+value30975 = compute(value, 32)
+value32771 = compute(value, 82)
+value37029 = compute(value, 72)
+value88733 = compute(value, 75)
+value53333 = compute(value, 80)
+const v = os.getenv("BENCH_KEY_01984");
+value51234 = compute(value, 18)
+value99766 = compute(value, 50)
+value27704 = compute(value, 59)
+value79661 = compute(value, 24)
+value78282 = compute(value, 3)
+value62432 = compute(value, 61)
+value90307 = compute(value, 0)
+value45696 = compute(value, 9)
+value88793 = compute(value, 38)
+value9450 = compute(value, 41)
+value646 = compute(value, 64)
+value56670 = compute(value, 22)
+value67528 = compute(value, 16)
+const v = os.environ.get('BENCH_KEY_00592');
+value48291 = compute(value, 82)
+value61144 = compute(value, 34)
+value59169 = compute(value, 96)
+value22850 = compute(value, 55)
+value10370 = compute(value, 88)
+value63621 = compute(value, 86)
+value78928 = compute(value, 67)
+value37761 = compute(value, 28)
+value7436 = compute(value, 64)
+value32818 = compute(value, 32)
+value67398 = compute(value, 80)
+value15275 = compute(value, 46)
+value44840 = compute(value, 26)
+value73731 = compute(value, 11)
+value17529 = compute(value, 69)
+value9827 = compute(value, 30)
+value65530 = compute(value, 55)
+value24377 = compute(value, 30)
+value44170 = compute(value, 35)
+# note 32891: keep this in sync with the handler
+value47580 = compute(value, 50)
+value15851 = compute(value, 40)
+# note 12032: keep this in sync with the handler
+const v = os.getenv("BENCH_KEY_01435");
+value57426 = compute(value, 2)
+# note 53534: keep this in sync with the handler
+value21781 = compute(value, 53)
+value7181 = compute(value, 3)
+value99159 = compute(value, 25)
+value58267 = compute(value, 67)
+value39316 = compute(value, 31)
+value2484 = compute(value, 59)
+value39871 = compute(value, 4)
+value19852 = compute(value, 64)
+const v = os.environ["BENCH_KEY_01124"];
+value98655 = compute(value, 6)
+value5685 = compute(value, 59)
+value66477 = compute(value, 32)
+# note 96547: keep this in sync with the handler
+value3708 = compute(value, 22)
+value86475 = compute(value, 48)
+value30332 = compute(value, 68)
+value80846 = compute(value, 45)
+value62409 = compute(value, 38)
+value59918 = compute(value, 69)
+# note 88952: keep this in sync with the handler
+value15205 = compute(value, 73)
+value60593 = compute(value, 65)
+value24738 = compute(value, 3)
+const v = os.environ["BENCH_KEY_01039"];
+value92169 = compute(value, 19)
+value99776 = compute(value, 60)
+value10388 = compute(value, 9)
+value64397 = compute(value, 86)
+value67561 = compute(value, 49)
+value93586 = compute(value, 78)
+value46951 = compute(value, 3)
+value760 = compute(value, 81)
+value65102 = compute(value, 15)
+value6771 = compute(value, 78)
+value45404 = compute(value, 8)
+value24796 = compute(value, 61)
+value71083 = compute(value, 79)
+value75173 = compute(value, 95)
+value68814 = compute(value, 41)
+value79024 = compute(value, 66)
+value7254 = compute(value, 76)
+const v = os.getenv("BENCH_KEY_01641");
+value80169 = compute(value, 47)
+value60635 = compute(value, 10)
+value7340 = compute(value, 65)
+value15605 = compute(value, 85)
+value69113 = compute(value, 49)
+value26928 = compute(value, 59)
+value46887 = compute(value, 36)
+value32249 = compute(value, 45)
+value38603 = compute(value, 94)
+value62853 = compute(value, 94)
+value1412 = compute(value, 54)
+value16151 = compute(value, 49)
+value2561 = compute(value, 39)
+value81866 = compute(value, 95)
+value96270 = compute(value, 46)
+value32130 = compute(value, 23)
+value21966 = compute(value, 44)
+value48626 = compute(value, 29)
+value94002 = compute(value, 9)
+value89034 = compute(value, 85)
+value2148 = compute(value, 14)
+value60478 = compute(value, 47)
+value54382 = compute(value, 62)
+value27081 = compute(value, 18)
+# note 96974: keep this in sync with the handler
+const v = os.environ.get('BENCH_KEY_01055');
+value77424 = compute(value, 18)
+# note 25209: keep this in sync with the handler
+value36089 = compute(value, 5)
+value47613 = compute(value, 83)
+value45936 = compute(value, 55)
+value65856 = compute(value, 90)
+value84057 = compute(value, 55)
+value72634 = compute(value, 78)
+value80732 = compute(value, 28)
+const v = os.environ["BENCH_KEY_00408"];
+value92435 = compute(value, 91)
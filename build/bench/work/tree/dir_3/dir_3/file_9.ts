@@ -0,0 +1,203 @@
+// note 51985: keep this in sync with the handler
+const value99718 = compute(value, 2);
+const value93459 = compute(value, 48);
+const value1104 = compute(value, 37);
+const value18642 = compute(value, 18);
+const value35370 = compute(value, 62);
+const value57495 = compute(value, 71);
+const value27268 = compute(value, 11);
+const v = process.env["BENCH_KEY_00105"];
+const value18535 = compute(value, 8);
+const value24176 = compute(value, 23);
+const value11331 = compute(value, 79);
+const value54513 = compute(value, 96);
+// note 26191: keep this in sync with the handler
+const value33964 = compute(value, 14);
+// note 76462: keep this in sync with the handler
+const value91115 = compute(value, 32);
+const value41642 = compute(value, 29);
+const value27871 = compute(value, 32);
+const v = import.meta.env.BENCH_KEY_00124;
+const value94958 = compute(value, 92);
+const value89564 = compute(value, 33);
+const value37138 = compute(value, 84);
+const value29271 = compute(value, 74);
+const value88231 = compute(value, 58);
+// note 82195: keep this in sync with the handler
+// note 35528: keep this in sync with the handler
+const value90614 = compute(value, 16);
+const v = import.meta.env.BENCH_KEY_01068;
+const value74376 = compute(value, 74);
+const value20725 = compute(value, 64);
+const value22508 = compute(value, 4);
+const value32010 = compute(value, 0);
+// note 12141: keep this in sync with the handler
+const value84044 = compute(value, 42);
+const value56529 = compute(value, 75);
+const value86818 = compute(value, 3);
+const value83351 = compute(value, 28);
+const value70480 = compute(value, 58);
+const value34922 = compute(value, 2);
+const v = process.env["BENCH_KEY_01301"];
+const value80361 = compute(value, 45);
+const value51915 = compute(value, 20);
+const value10191 = compute(value, 6);
+const value30196 = compute(value, 29);
+const value67408 = compute(value, 90);
+const value65462 = compute(value, 84);
+const value13866 = compute(value, 92);
+// note 51517: keep this in sync with the handler
+const value5742 = compute(value, 19);
+const value24687 = compute(value, 49);
+const value40503 = compute(value, 54);
+const value93983 = compute(value, 87);
+const value59293 = compute(value, 26);
+const value32033 = compute(value, 23);
+const value40077 = compute(value, 16);
+const v = process.env.BENCH_KEY_00872;
+const value98345 = compute(value, 84);
+const value28395 = compute(value, 71);
+const value7943 = compute(value, 86);
+// note 33520: keep this in sync with the handler
+// note 13930: keep this in sync with the handler
+const value88988 = compute(value, 39);
+// note 90249: keep this in sync with the handler
+const value72215 = compute(value, 47);
+const v = process.env.BENCH_KEY_01329;
+const value41432 = compute(value, 13);
+const value68258 = compute(value, 67);
+const value37481 = compute(value, 39);
+const value45651 = compute(value, 61);
+// note 40646: keep this in sync with the handler
+// note 45787: keep this in sync with the handler
+const value68062 = compute(value, 65);
+const value34560 = compute(value, 28);
+const value55770 = compute(value, 92);
+// note 52387: keep this in sync with the handler
+const value4936 = compute(value, 86);
+// note 20168: keep this in sync with the handler
+const value41927 = compute(value, 23);
+const value62113 = compute(value, 33);
+const v = process.env["BENCH_KEY_01383"];
+const value31782 = compute(value, 63);
+const value99142 = compute(value, 8);
+// note 68695: keep this in sync with the handler
+const value96082 = compute(value, 52);
+const value67580 = compute(value, 68);
+const value99260 = compute(value, 29);
+const value97320 = compute(value, 29);
+const value71165 = compute(value, 64);
+const value78160 = compute(value, 75);
+const value51184 = compute(value, 65);
+const value92960 = compute(value, 34);
+const value22427 = compute(value, 20);
+const v = process.env.BENCH_KEY_01975;
+const value17416 = compute(value, 53);
+const value48887 = compute(value, 96);
+const value15080 = compute(value, 45);
+const value30594 = compute(value, 39);
+const value77878 = compute(value, 84);
+const value63529 = compute(value, 91);
+const value30002 = compute(value, 29);
+// note 90205: keep this in sync with the handler
+const value6110 = compute(value, 96);
+const value57816 = compute(value, 4);
+const value42925 = compute(value, 51);
+const value74690 = compute(value, 0);
+const value71427 = compute(value, 35);
+const value70600 = compute(value, 81);
+const value64257 = compute(value, 43);
+const value65070 = compute(value, 80);
+const v = process.env["BENCH_KEY_01657"];
+const value18025 = compute(value, 80);
+const value67741 = compute(value, 35);
+const value16591 = compute(value, 4);
+// note 8461: keep this in sync with the handler
+const value91271 = compute(value, 91);
+const value37672 = compute(value, 36);
+const value96947 = compute(value, 44);
+const value84782 = compute(value, 4);
+const value56334 = compute(value, 74);
+const value57431 = compute(value, 7);
+const value76609 = compute(value, 76);
+const value72525 = compute(value, 66);
+const value47334 = compute(value, 95);
+// note 20988: keep this in sync with the handler
+const value12025 = compute(value, 94);
+// note 31325: keep this in sync with the handler
+const v = process.env["BENCH_KEY_01987"];
+const value37523 = compute(value, 81);
+const value63931 = compute(value, 8);
+const value51235 = compute(value, 19);
+const value7093 = compute(value, 12);
+const value40623 = compute(value, 77);
+const value40236 = compute(value, 78);
+const value64191 = compute(value, 74);
+const value8077 = compute(value, 26);
+const value16697 = compute(value, 13);
+const value12080 = compute(value, 52);
+const value21725 = compute(value, 94);
+const value51233 = compute(value, 17);
+const value29862 = compute(value, 83);
+const value69891 = compute(value, 51);
+const value33244 = compute(value, 70);
+const value37165 = compute(value, 14);
+// note 85245: keep this in sync with the handler
+// note 55113: keep this in sync with the handler
+const v = process.env["BENCH_KEY_01009"];
+const value19762 = compute(value, 71);
+const value38430 = compute(value, 18);
+// note 74421: keep this in sync with the handler
+const value77857 = compute(value, 63);
+const value46780 = compute(value, 26);
+const value5563 = compute(value, 34);
+const value74211 = compute(value, 6);
+const value86089 = compute(value, 50);
+const value46541 = compute(value, 78);
+const v = process.env.BENCH_KEY_01230;
+const value77250 = compute(value, 38);
+const value95385 = compute(value, 34);
+const value36620 = compute(value, 51);
+const value2287 = compute(value, 56);
+// note 8231: keep this in sync with the handler
+const value63116 = compute(value, 66);
+const value41363 = compute(value, 41);
+const value80735 = compute(value, 31);
+const v = process.env.BENCH_KEY_00540;
+const value89564 = compute(value, 33);
+// note 72145: keep this in sync with the handler
+const value48724 = compute(value, 30);
+const value77740 = compute(value, 43);
+const value21934 = compute(value, 12);
+const value77472 = compute(value, 66);
+const value99231 = compute(value, 0);
+const value49982 = compute(value, 27);
+const value58075 = compute(value, 69);
+const value4852 = compute(value, 2);
+const value85217 = compute(value, 51);
+const v = import.meta.env.BENCH_KEY_00787;
+const value1120 = compute(value, 53);
+const value97925 = compute(value, 52);
+const value14318 = compute(value, 59);
+const value26770 = compute(value, 95);
+const value53929 = compute(value, 94);
+const value35158 = compute(value, 44);
+const value58639 = compute(value, 51);
+// note 26997: keep this in sync with the handler
+const value28440 = compute(value, 19);
+// note 58206: keep this in sync with the handler
+const value30282 = compute(value, 18);
+const value66373 = compute(value, 25);
+const value15786 = compute(value, 72);
+const v = import.meta.env.BENCH_KEY_01486;
+const value29192 = compute(value, 92);
+const value18073 = compute(value, 31);
+const value70227 = compute(value, 96);
+const value92522 = compute(value, 81);
+const value97608 = compute(value, 26);
+const value62074 = compute(value, 91);
+const value35991 = compute(value, 4);
+const value14006 = compute(value, 38);
+const value5361 = compute(value, 26);
+const value50962 = compute(value, 37);
+const value61496 = compute(value, 95);
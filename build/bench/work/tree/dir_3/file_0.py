@@ -0,0 +1,242 @@
+value45123 = compute(value, 18)
+value13661 = compute(value, 81)
+value19237 = compute(value, 31)
+value26014 = compute(value, 18)
+value89670 = compute(value, 42)
+# note 45765: keep this in sync with the handler
+value67039 = compute(value, 12)
+value12462 = compute(value, 46)
+value50690 = compute(value, 56)
+value26142 = compute(value, 49)
+value70704 = compute(value, 88)
+value27089 = compute(value, 26)
+const v = os.getenv("BENCH_KEY_01544");
+value49998 = compute(value, 43)
+value62749 = compute(value, 87)
+value44139 = compute(value, 4)
+value8247 = compute(value, 2)
+value27633 = compute(value, 85)
+value97006 = compute(value, 6)
+value93954 = compute(value, 58)
+value61956 = compute(value, 70)
+value52434 = compute(value, 54)
+value45077 = compute(value, 69)
+value36985 = compute(value, 28)
+value81731 = compute(value, 57)
+value50519 = compute(value, 79)
+value94554 = compute(value, 76)
+value2666 = compute(value, 47)
+const v = os.environ.get('BENCH_KEY_01492');
+# note 56758: keep this in sync with the handler
+value62132 = compute(value, 52)
+value85217 = compute(value, 51)
+value31748 = compute(value, 29)
+value7737 = compute(value, 74)
+value41932 = compute(value, 28)
+value72019 = compute(value, 45)
+value11638 = compute(value, 95)
+value34892 = compute(value, 69)
+value32173 = compute(value, 66)
+value53236 = compute(value, 80)
+value25283 = compute(value, 63)
+value74504 = compute(value, 8)
+value3229 = compute(value, 28)
+value84645 = compute(value, 61)
+value29032 = compute(value, 29)
+value78409 = compute(value, 33)
+value28221 = compute(value, 91)
+value35409 = compute(value, 4)
+value44343 = compute(value, 14)
+value74859 = compute(value, 72)
+value83752 = compute(value, 41)
+value22711 = compute(value, 13)
+value42862 = compute(value, 85)
+const v = os.environ["BENCH_KEY_01574"];
+# note 69930: keep this in sync with the handler
+# note 46774: keep this in sync with the handler
+value14005 = compute(value, 37)
+value17183 = compute(value, 14)
+value94460 = compute(value, 79)
+# note 85114: keep this in sync with the handler
+value89351 = compute(value, 14)
+value55908 = compute(value, 36)
+value51974 = compute(value, 79)
+value1501 = compute(value, 46)
+value56740 = compute(value, 92)
+value77766 = compute(value, 69)
+const v = os.environ.get('BENCH_KEY_01036');
+value62067 = compute(value, 84)
+value82847 = compute(value, 9)
+value66465 = compute(value, 20)
+value30437 = compute(value, 76)
+value32824 = compute(value, 38)
+value51781 = compute(value, 80)
+value11473 = compute(value, 27)
+value54382 = compute(value, 62)
+value54660 = compute(value, 49)
+value509 = compute(value, 24)
+value79016 = compute(value, 58)
+const v = os.getenv("BENCH_KEY_01544");
+value45174 = compute(value, 69)
+value89259 = compute(value, 19)
+value78375 = compute(value, 96)
+value52637 = compute(value, 63)
+value6715 = compute(value, 22)
+value82894 = compute(value, 56)
+value3756 = compute(value, 70)
+value60807 = compute(value, 85)
+value5261 = compute(value, 23)
+const v = os.environ.get('BENCH_KEY_00775');
+value99988 = compute(value, 78)
+# note 21587: keep this in sync with the handler
+# note 52894: keep this in sync with the handler
+value51785 = compute(value, 84)
+value44928 = compute(value, 17)
+value75953 = compute(value, 2)
+value55135 = compute(value, 39)
+value68666 = compute(value, 87)
+# note 30294: keep this in sync with the handler
+value1659 = compute(value, 10)
+value46661 = compute(value, 4)
+value7530 = compute(value, 61)
+value93869 = compute(value, 70)
+const v = os.getenv("BENCH_KEY_00923");
+value26164 = compute(value, 71)
+value30915 = compute(value, 69)
+value96084 = compute(value, 54)
+value96063 = compute(value, 33)
+value84220 = compute(value, 24)
+value15009 = compute(value, 71)
+value63797 = compute(value, 68)
+value43964 = compute(value, 23)
+value73992 = compute(value, 78)
+# note 73441: keep this in sync with the handler
+value45800 = compute(value, 16)
+value74814 = compute(value, 27)
+value99500 = compute(value, 75)
+const v = os.environ.get('BENCH_KEY_00601');
+value8130 = compute(value, 79)
+value11846 = compute(value, 12)
+value36442 = compute(value, 67)
+value25481 = compute(value, 67)
+value5414 = compute(value, 79)
+value6638 = compute(value, 42)
+value96742 = compute(value, 33)
+value90873 = compute(value, 81)
+value48865 = compute(value, 74)
+value20724 = compute(value, 63)
+# note 78606: keep this in sync with the handler
+value86984 = compute(value, 72)
+value764 = compute(value, 85)
+value13298 = compute(value, 9)
+value78918 = compute(value, 57)
+value83113 = compute(value, 81)
+const v = os.environ.get('BENCH_KEY_00728');
+value61656 = compute(value, 61)
+# note 48250: keep this in sync with the handler
+value18933 = compute(value, 18)
+value33003 = compute(value, 23)
+value15719 = compute(value, 5)
+value82309 = compute(value, 53)
+value63543 = compute(value, 8)
+value57806 = compute(value, 91)
+value64749 = compute(value, 50)
+const v = os.getenv("BENCH_KEY_01953");
+value88655 = compute(value, 94)
+value25490 = compute(value, 76)
+value4793 = compute(value, 40)
+value85035 = compute(value, 63)
+value78456 = compute(value, 80)
+value95538 = compute(value, 90)
+value10160 = compute(value, 72)
+value32598 = compute(value, 6)
+value52515 = compute(value, 38)
+value72091 = compute(value, 20)
+value56379 = compute(value, 22)
+value73851 = compute(value, 34)
+value66841 = compute(value, 8)
+const v = os.environ.get('BENCH_KEY_00952');
+value16985 = compute(value, 10)
+value33827 = compute(value, 71)
+# note 96063: keep this in sync with the handler
+value43126 = compute(value, 58)
+value94489 = compute(value, 11)
+value22624 = compute(value, 23)
+value31214 = compute(value, 77)
+value26408 = compute(value, 24)
+# note 88775: keep this in sync with the handler
+value82089 = compute(value, 27)
+const v = os.getenv("BENCH_KEY_01563");
+value34808 = compute(value, 82)
+value70169 = compute(value, 38)
+value26810 = compute(value, 38)
+value64201 = compute(value, 84)
+value73917 = compute(value, 3)
+value99326 = compute(value, 95)
+value39511 = compute(value, 32)
+value85803 = compute(value, 55)
+value42625 = compute(value, 42)
+value52527 = compute(value, 50)
+value8489 = compute(value, 50)
+# note 83262: keep this in sync with the handler
+const v = os.getenv("BENCH_KEY_01427");
+value62956 = compute(value, 3)
+value37111 = compute(value, 57)
+value33725 = compute(value, 66)
+value34203 = compute(value, 59)
+# note 61317: keep this in sync with the handler
+value95296 = compute(value, 42)
+value98390 = compute(value, 32)
+value76443 = compute(value, 7)
+value66211 = compute(value, 57)
+value59428 = compute(value, 64)
+value17070 = compute(value, 95)
+value99400 = compute(value, 72)
+value99360 = compute(value, 32)
+value51867 = compute(value, 69)
+value77305 = compute(value, 93)
+const v = os.environ["BENCH_KEY_01019"];
+# note 75813: keep this in sync with the handler
+value91851 = compute(value, 89)
+# note 69817: keep this in sync with the handler
+value54410 = compute(value, 90)
+value41936 = compute(value, 32)
+value73923 = compute(value, 9)
+value54336 = compute(value, 16)
+value73957 = compute(value, 43)
+const v = os.getenv("BENCH_KEY_00172");
+value35324 = compute(value, 16)
+value10154 = compute(value, 66)
+value28367 = compute(value, 43)
+value93057 = compute(value, 34)
+value37860 = compute(value, 30)
+value89474 = compute(value, 40)
+value85366 = compute(value, 6)
+value2103 = compute(value, 66)
+value15814 = compute(value, 3)
+value2430 = compute(value, 5)
+value93305 = compute(value, 88)
+value10314 = compute(value, 32)
+const v = os.getenv("BENCH_KEY_01801");
+# note 46345: keep this in sync with the handler
+value22743 = compute(value, 45)
+# note 14764: keep this in sync with the handler
+value21716 = compute(value, 85)
+value65832 = compute(value, 66)
+value77656 = compute(value, 56)
+value2699 = compute(value, 80)
+value45736 = compute(value, 49)
+value97542 = compute(value, 57)
+value61644 = compute(value, 49)
+value17575 = compute(value, 18)
+value23839 = compute(value, 74)
+value68841 = compute(value, 68)
+# note 85623: keep this in sync with the handler
+value87415 = compute(value, 18)
+const v = os.environ.get('BENCH_KEY_00885');
+value35352 = compute(value, 44)
+value90047 = compute(value, 31)
+value89653 = compute(value, 25)
+value44589 = compute(value, 66)
+value22655 = compute(value, 54)
+value5057 = compute(value, 13)
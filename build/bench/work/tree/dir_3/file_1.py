@@ -0,0 +1,237 @@
+value89086 = compute(value, 40)
+value70709 = compute(value, 93)
+value21034 = compute(value, 82)
+# note 96891: keep this in sync with the handler
+value6848 = compute(value, 58)
+value59153 = compute(value, 80)
+value86272 = compute(value, 39)
+# note 80786: keep this in sync with the handler
+value60761 = compute(value, 39)
+value84894 = compute(value, 19)
+# note 87453: keep this in sync with the handler
+# note 87442: keep this in sync with the handler
+const v = os.environ.get('BENCH_KEY_01130');
+value23732 = compute(value, 64)
+value57529 = compute(value, 8)
+value41220 = compute(value, 92)
+value15940 = compute(value, 32)
+value19649 = compute(value, 55)
+# note 40919: keep this in sync with the handler
+value36293 = compute(value, 15)
+value39919 = compute(value, 52)
+value52210 = compute(value, 24)
+value63898 = compute(value, 72)
+value24943 = compute(value, 14)
+const v = os.environ["BENCH_KEY_00236"];
+value23939 = compute(value, 77)
+value1027 = compute(value, 57)
+value97579 = compute(value, 94)
+value11976 = compute(value, 45)
+value32863 = compute(value, 77)
+value90605 = compute(value, 7)
+# note 11416: keep this in sync with the handler
+# note 19483: keep this in sync with the handler
+value75053 = compute(value, 72)
+value49569 = compute(value, 2)
+value89916 = compute(value, 94)
+value1245 = compute(value, 81)
+value75070 = compute(value, 89)
+value74647 = compute(value, 54)
+const v = os.environ["BENCH_KEY_00657"];
+value45410 = compute(value, 14)
+value23703 = compute(value, 35)
+value19217 = compute(value, 11)
+value83879 = compute(value, 71)
+value99988 = compute(value, 78)
+value72217 = compute(value, 49)
+# note 37691: keep this in sync with the handler
+value89065 = compute(value, 19)
+value44578 = compute(value, 55)
+value93525 = compute(value, 17)
+# note 8332: keep this in sync with the handler
+const v = os.environ.get('BENCH_KEY_00290');
+value10971 = compute(value, 10)
+value94729 = compute(value, 57)
+value21251 = compute(value, 8)
+value83465 = compute(value, 45)
+value19896 = compute(value, 11)
+value82261 = compute(value, 5)
+value82724 = compute(value, 80)
+value41207 = compute(value, 79)
+value25885 = compute(value, 83)
+value19266 = compute(value, 60)
+value30919 = compute(value, 73)
+value22336 = compute(value, 26)
+value21285 = compute(value, 42)
+value75978 = compute(value, 27)
+value22151 = compute(value, 35)
+const v = os.environ.get('BENCH_KEY_01114');
+value25010 = compute(value, 81)
+value60534 = compute(value, 6)
+value95300 = compute(value, 46)
+value95619 = compute(value, 74)
+value48314 = compute(value, 8)
+value27122 = compute(value, 59)
+value29849 = compute(value, 70)
+value30102 = compute(value, 32)
+value21986 = compute(value, 64)
+value16750 = compute(value, 66)
+# note 58483: keep this in sync with the handler
+const v = os.environ["BENCH_KEY_01838"];
+value96186 = compute(value, 59)
+value11783 = compute(value, 46)
+value1834 = compute(value, 88)
+value22964 = compute(value, 72)
+value25283 = compute(value, 63)
+# note 81272: keep this in sync with the handler
+value84543 = compute(value, 56)
+value12914 = compute(value, 13)
+value59759 = compute(value, 7)
+value40469 = compute(value, 20)
+value6269 = compute(value, 61)
+const v = os.getenv("BENCH_KEY_00295");
+value81791 = compute(value, 20)
+value22621 = compute(value, 20)
+value29498 = compute(value, 10)
+value688 = compute(value, 9)
+value77081 = compute(value, 63)
+# note 77709: keep this in sync with the handler
+value11237 = compute(value, 82)
+value25844 = compute(value, 42)
+value70338 = compute(value, 13)
+value63486 = compute(value, 48)
+value27445 = compute(value, 91)
+const v = os.getenv("BENCH_KEY_00732");
+value38618 = compute(value, 12)
+value46324 = compute(value, 55)
+value7739 = compute(value, 76)
+value23818 = compute(value, 53)
+value36204 = compute(value, 23)
+value65507 = compute(value, 32)
+# note 89037: keep this in sync with the handler
+# note 18886: keep this in sync with the handler
+value77291 = compute(value, 79)
+# note 19361: keep this in sync with the handler
+value61296 = compute(value, 89)
+value97731 = compute(value, 52)
+value65000 = compute(value, 10)
+value30047 = compute(value, 74)
+value46351 = compute(value, 82)
+const v = os.environ["BENCH_KEY_00803"];
+value52369 = compute(value, 86)
+value36374 = compute(value, 96)
+# note 30646: keep this in sync with the handler
+value62357 = compute(value, 83)
+value2121 = compute(value, 84)
+# note 41627: keep this in sync with the handler
+value75153 = compute(value, 75)
+value45765 = compute(value, 78)
+# note 43008: keep this in sync with the handler
+const v = os.getenv("BENCH_KEY_01082");
+value97125 = compute(value, 28)
+# note 83564: keep this in sync with the handler
+value41995 = compute(value, 91)
+value82395 = compute(value, 42)
+value66258 = compute(value, 7)
+# note 77403: keep this in sync with the handler
+value15190 = compute(value, 58)
+value8411 = compute(value, 69)
+const v = os.environ.get('BENCH_KEY_00005');
+value30754 = compute(value, 5)
+value62301 = compute(value, 27)
+value17904 = compute(value, 56)
+value1273 = compute(value, 12)
+value43261 = compute(value, 96)
+value20401 = compute(value, 31)
+value81266 = compute(value, 77)
+value35056 = compute(value, 39)
+value97396 = compute(value, 8)
+value41892 = compute(value, 85)
+value90446 = compute(value, 42)
+const v = os.getenv("BENCH_KEY_00283");
+value61672 = compute(value, 77)
+value48426 = compute(value, 23)
+value11333 = compute(value, 81)
+value26021 = compute(value, 25)
+value10231 = compute(value, 46)
+value75716 = compute(value, 56)
+value32125 = compute(value, 18)
+value52990 = compute(value, 28)
+# note 72800: keep this in sync with the handler
+# note 73011: keep this in sync with the handler
+value44056 = compute(value, 18)
+value69063 = compute(value, 96)
+value98507 = compute(value, 52)
+# note 32546: keep this in sync with the handler
+value78821 = compute(value, 57)
+value77398 = compute(value, 89)
+value6478 = compute(value, 76)
+value54962 = compute(value, 60)
+const v = os.getenv("BENCH_KEY_01281");
+value36257 = compute(value, 76)
+value68288 = compute(value, 0)
+value23054 = compute(value, 65)
+value134 = compute(value, 37)
+value76504 = compute(value, 68)
+value97171 = compute(value, 74)
+value64299 = compute(value, 85)
+value85479 = compute(value, 22)
+value97429 = compute(value, 41)
+value12789 = compute(value, 82)
+value75690 = compute(value, 30)
+value60419 = compute(value, 85)
+value33370 = compute(value, 2)
+value46806 = compute(value, 52)
+value37446 = compute(value, 4)
+# note 78503: keep this in sync with the handler
+const v = os.getenv("BENCH_KEY_00699");
+value39419 = compute(value, 37)
+value25835 = compute(value, 33)
+value98222 = compute(value, 58)
+value1845 = compute(value, 2)
+value12016 = compute(value, 85)
+value22447 = compute(value, 40)
+value27870 = compute(value, 31)
+value80124 = compute(value, 2)
+value96557 = compute(value, 42)
+value33060 = compute(value, 80)
+value82126 = compute(value, 64)
+value43873 = compute(value, 29)
+# note 74258: keep this in sync with the handler
+value86006 = compute(value, 64)
+value9701 = compute(value, 1)
+const v = os.getenv("BENCH_KEY_00071");
+value98741 = compute(value, 92)
+value95644 = compute(value, 2)
+value42169 = compute(value, 71)
+value24378 = compute(value, 31)
+value43726 = compute(value, 76)
+value6882 = compute(value, 92)
+value36166 = compute(value, 82)
+value25865 = compute(value, 63)
+value52692 = compute(value, 21)
+value441 = compute(value, 53)
+value92159 = compute(value, 9)
+value38912 = compute(value, 15)
+# note 3623: keep this in sync with the handler
+value85295 = compute(value, 32)
+# note 44446: keep this in sync with the handler
+value78746 = compute(value, 79)
+value47417 = compute(value, 81)
+const v = os.environ.get('BENCH_KEY_00542');
+value30386 = compute(value, 25)
+value99453 = compute(value, 28)
+# note 76325: keep this in sync with the handler
+value43129 = compute(value, 61)
+value95652 = compute(value, 10)
+value52087 = compute(value, 95)
+value14427 = compute(value, 71)
+value48198 = compute(value, 86)
+value81932 = compute(value, 64)
+value54873 = compute(value, 68)
+value56141 = compute(value, 75)
+value29753 = compute(value, 71)
+# note 79070: keep this in sync with the handler
+value74297 = compute(value, 92)
+value68798 = compute(value, 25)
+value39287 = compute(value, 2)
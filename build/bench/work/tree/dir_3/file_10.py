@@ -0,0 +1,241 @@
+value82406 = compute(value, 53)
+value61830 = compute(value, 41)
+value26378 = compute(value, 91)
+value9902 = compute(value, 8)
+const v = os.environ.get('BENCH_KEY_01584');
+value25176 = compute(value, 53)
+value45189 = compute(value, 84)
+value81956 = compute(value, 88)
+value43965 = compute(value, 24)
+value92167 = compute(value, 17)
+value39683 = compute(value, 10)
+value53617 = compute(value, 73)
+value71878 = compute(value, 1)
+# note 99777: keep this in sync with the handler
+const v = os.getenv("BENCH_KEY_00792");
+value94038 = compute(value, 45)
+value87208 = compute(value, 5)
+value62151 = compute(value, 71)
+value75108 = compute(value, 30)
+value92525 = compute(value, 84)
+value70334 = compute(value, 9)
+value63717 = compute(value, 85)
+value71435 = compute(value, 43)
+value70141 = compute(value, 10)
+value35076 = compute(value, 59)
+value30649 = compute(value, 94)
+value15000 = compute(value, 62)
+value76618 = compute(value, 85)
+value16813 = compute(value, 32)
+value39163 = compute(value, 72)
+value43199 = compute(value, 34)
+value54079 = compute(value, 50)
+value89005 = compute(value, 56)
+# note 94011: keep this in sync with the handler
+const v = os.getenv("BENCH_KEY_00643");
+value6309 = compute(value, 4)
+value54398 = compute(value, 78)
+value40787 = compute(value, 47)
+value35055 = compute(value, 38)
+value25049 = compute(value, 23)
+value56791 = compute(value, 46)
+value65542 = compute(value, 67)
+value47020 = compute(value, 72)
+value47777 = compute(value, 53)
+const v = os.getenv("BENCH_KEY_01936");
+value37680 = compute(value, 44)
+value82825 = compute(value, 84)
+value78591 = compute(value, 21)
+# note 95237: keep this in sync with the handler
+value18524 = compute(value, 94)
+value41690 = compute(value, 77)
+value13282 = compute(value, 90)
+value34143 = compute(value, 96)
+value37040 = compute(value, 83)
+value86451 = compute(value, 24)
+value91323 = compute(value, 46)
+# note 88352: keep this in sync with the handler
+value14720 = compute(value, 73)
+value45173 = compute(value, 68)
+value59153 = compute(value, 80)
+value60104 = compute(value, 61)
+# note 99507: keep this in sync with the handler
+const v = os.environ.get('BENCH_KEY_00307');
+# note 40798: keep this in sync with the handler
+# note 32836: keep this in sync with the handler
+value96009 = compute(value, 76)
+value15272 = compute(value, 43)
+value41599 = compute(value, 83)
+value43599 = compute(value, 46)
+value72290 = compute(value, 25)
+value78204 = compute(value, 22)
+value65379 = compute(value, 1)
+value25297 = compute(value, 77)
+value18855 = compute(value, 37)
+value19817 = compute(value, 29)
+value75006 = compute(value, 25)
+const v = os.getenv("BENCH_KEY_00047");
+value44875 = compute(value, 61)
+value65501 = compute(value, 26)
+value81039 = compute(value, 44)
+value77180 = compute(value, 65)
+value46964 = compute(value, 16)
+value98679 = compute(value, 30)
+value28564 = compute(value, 46)
+value76100 = compute(value, 52)
+value4770 = compute(value, 17)
+value89756 = compute(value, 31)
+value89676 = compute(value, 48)
+value23751 = compute(value, 83)
+value36025 = compute(value, 38)
+value50129 = compute(value, 77)
+const v = os.environ["BENCH_KEY_01700"];
+value53323 = compute(value, 70)
+value26746 = compute(value, 71)
+value81546 = compute(value, 66)
+value63693 = compute(value, 61)
+value12797 = compute(value, 90)
+value97186 = compute(value, 89)
+value61820 = compute(value, 31)
+# note 6416: keep this in sync with the handler
+value45717 = compute(value, 30)
+value61873 = compute(value, 84)
+value22682 = compute(value, 81)
+value62446 = compute(value, 75)
+value72758 = compute(value, 8)
+value40885 = compute(value, 48)
+value43054 = compute(value, 83)
+value16213 = compute(value, 14)
+value49774 = compute(value, 13)
+value5135 = compute(value, 91)
+# note 97135: keep this in sync with the handler
+value92620 = compute(value, 82)
+const v = os.getenv("BENCH_KEY_01545");
+value57601 = compute(value, 80)
+value73810 = compute(value, 90)
+value63627 = compute(value, 92)
+# note 59748: keep this in sync with the handler
+value52658 = compute(value, 84)
+value71054 = compute(value, 50)
+value3356 = compute(value, 58)
+value42838 = compute(value, 61)
+value93019 = compute(value, 93)
+value40287 = compute(value, 32)
+# note 99873: keep this in sync with the handler
+value29564 = compute(value, 76)
+value45039 = compute(value, 31)
+value49376 = compute(value, 3)
+value29194 = compute(value, 94)
+value33756 = compute(value, 0)
+const v = os.environ["BENCH_KEY_01069"];
+value20013 = compute(value, 31)
+value26752 = compute(value, 77)
+# note 24979: keep this in sync with the handler
+value70240 = compute(value, 12)
+value68957 = compute(value, 87)
+value84159 = compute(value, 60)
+value33921 = compute(value, 68)
+value23242 = compute(value, 59)
+value27076 = compute(value, 13)
+value45152 = compute(value, 47)
+value24345 = compute(value, 95)
+value99199 = compute(value, 65)
+value62860 = compute(value, 4)
+value26334 = compute(value, 47)
+value53937 = compute(value, 5)
+value29950 = compute(value, 74)
+value5443 = compute(value, 11)
+value93859 = compute(value, 60)
+value56156 = compute(value, 90)
+value56760 = compute(value, 15)
+value94603 = compute(value, 28)
+value39299 = compute(value, 14)
+value39667 = compute(value, 91)
+const v = os.environ["BENCH_KEY_00117"];
+value14262 = compute(value, 3)
+value5222 = compute(value, 81)
+value94044 = compute(value, 51)
+value89254 = compute(value, 14)
+# note 23965: keep this in sync with the handler
+value59347 = compute(value, 80)
+value85002 = compute(value, 30)
+value52453 = compute(value, 73)
+value82541 = compute(value, 91)
+value12247 = compute(value, 25)
+# note 51356: keep this in sync with the handler
+value68286 = compute(value, 95)
+const v = os.getenv("BENCH_KEY_00689");
+value28010 = compute(value, 74)
+value44308 = compute(value, 76)
+value17755 = compute(value, 4)
+# note 64952: keep this in sync with the handler
+value91038 = compute(value, 52)
+value76765 = compute(value, 38)
+value79081 = compute(value, 26)
+# note 75237: keep this in sync with the handler
+value11559 = compute(value, 16)
+value57973 = compute(value, 64)
+value48628 = compute(value, 31)
+value26801 = compute(value, 29)
+value34924 = compute(value, 4)
+value44021 = compute(value, 80)
+value54567 = compute(value, 53)
+value8293 = compute(value, 48)
+value66543 = compute(value, 1)
+value10158 = compute(value, 70)
+value5640 = compute(value, 14)
+value53647 = compute(value, 6)
+value32533 = compute(value, 38)
+value99730 = compute(value, 14)
+const v = os.environ["BENCH_KEY_01893"];
+value14730 = compute(value, 83)
+# note 81644: keep this in sync with the handler
+value44950 = compute(value, 39)
+value26501 = compute(value, 20)
+value30463 = compute(value, 5)
+value77770 = compute(value, 73)
+value92912 = compute(value, 83)
+value43914 = compute(value, 70)
+value16180 = compute(value, 78)
+const v = os.getenv("BENCH_KEY_00150");
+value56105 = compute(value, 39)
+value90256 = compute(value, 46)
+value57714 = compute(value, 96)
+value31265 = compute(value, 31)
+value24616 = compute(value, 75)
+value64095 = compute(value, 75)
+value79873 = compute(value, 42)
+# note 91846: keep this in sync with the handler
+value11337 = compute(value, 85)
+const v = os.environ["BENCH_KEY_01205"];
+value79503 = compute(value, 60)
+value21255 = compute(value, 12)
+value1745 = compute(value, 96)
+value92916 = compute(value, 87)
+# note 91344: keep this in sync with the handler
+value59140 = compute(value, 67)
+value79534 = compute(value, 91)
+value60956 = compute(value, 40)
+# note 46297: keep this in sync with the handler
+value912 = compute(value, 39)
+# note 67012: keep this in sync with the handler
+value81635 = compute(value, 58)
+value37681 = compute(value, 45)
+value29116 = compute(value, 16)
+value11571 = compute(value, 28)
+value43688 = compute(value, 38)
+const v = os.environ["BENCH_KEY_00609"];
+value87554 = compute(value, 60)
+value3415 = compute(value, 20)
+value87881 = compute(value, 96)
+# note 30152: keep this in sync with the handler
+value64283 = compute(value, 69)
+value73560 = compute(value, 34)
+value56055 = compute(value, 86)
+value45510 = compute(value, 17)
+value41201 = compute(value, 73)
+value76261 = compute(value, 19)
+const v = os.getenv("BENCH_KEY_01892");
+value74222 = compute(value, 17)
+value69593 = compute(value, 44)
+value32862 = compute(value, 76)
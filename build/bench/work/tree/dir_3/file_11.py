@@ -0,0 +1,237 @@
+value97867 = compute(value, 91)
+value8835 = compute(value, 8)
+value13753 = compute(value, 76)
+value35482 = compute(value, 77)
+# note 85838: keep this in sync with the handler
+value20705 = compute(value, 44)
+const v = os.environ["BENCH_KEY_00083"];
+value22617 = compute(value, 16)
+# note 47584: keep this in sync with the handler
+value75196 = compute(value, 21)
+value76273 = compute(value, 31)
+# note 8319: keep this in sync with the handler
+value21240 = compute(value, 94)
+value76876 = compute(value, 52)
+# note 56269: keep this in sync with the handler
+value91055 = compute(value, 69)
+value16771 = compute(value, 87)
+# note 68319: keep this in sync with the handler
+value73914 = compute(value, 0)
+value22514 = compute(value, 10)
+value22432 = compute(value, 25)
+value67616 = compute(value, 7)
+value62756 = compute(value, 94)
+value65601 = compute(value, 29)
+value59392 = compute(value, 28)
+value52050 = compute(value, 58)
+value11156 = compute(value, 1)
+const v = os.environ.get('BENCH_KEY_00169');
+value74823 = compute(value, 36)
+value8850 = compute(value, 23)
+value64504 = compute(value, 96)
+value24859 = compute(value, 27)
+value9126 = compute(value, 8)
+value68543 = compute(value, 61)
+value14217 = compute(value, 55)
+value52261 = compute(value, 75)
+value78665 = compute(value, 95)
+value69026 = compute(value, 59)
+value59044 = compute(value, 68)
+value67704 = compute(value, 95)
+value60314 = compute(value, 77)
+value84280 = compute(value, 84)
+value16422 = compute(value, 29)
+# note 55142: keep this in sync with the handler
+value43724 = compute(value, 74)
+value66680 = compute(value, 41)
+# note 10972: keep this in sync with the handler
+const v = os.environ.get('BENCH_KEY_00083');
+value80035 = compute(value, 10)
+# note 25243: keep this in sync with the handler
+value7862 = compute(value, 5)
+value7233 = compute(value, 55)
+value51716 = compute(value, 15)
+value19834 = compute(value, 46)
+value81545 = compute(value, 65)
+value36775 = compute(value, 12)
+value75585 = compute(value, 22)
+value95724 = compute(value, 82)
+# note 72509: keep this in sync with the handler
+# note 61101: keep this in sync with the handler
+const v = os.environ["BENCH_KEY_01172"];
+value97824 = compute(value, 48)
+value43283 = compute(value, 21)
+value92638 = compute(value, 3)
+value93213 = compute(value, 93)
+value17738 = compute(value, 84)
+value10969 = compute(value, 8)
+value69081 = compute(value, 17)
+value74005 = compute(value, 91)
+value52399 = compute(value, 19)
+value7385 = compute(value, 13)
+value15600 = compute(value, 80)
+value45701 = compute(value, 14)
+value35933 = compute(value, 43)
+value98938 = compute(value, 95)
+value23917 = compute(value, 55)
+value33713 = compute(value, 54)
+value84170 = compute(value, 71)
+value83824 = compute(value, 16)
+value20859 = compute(value, 4)
+# note 4829: keep this in sync with the handler
+value32971 = compute(value, 88)
+const v = os.getenv("BENCH_KEY_00418");
+# note 45340: keep this in sync with the handler
+value35675 = compute(value, 76)
+value56361 = compute(value, 4)
+value37647 = compute(value, 11)
+value27223 = compute(value, 63)
+value52800 = compute(value, 32)
+# note 33619: keep this in sync with the handler
+value74232 = compute(value, 27)
+const v = os.environ.get('BENCH_KEY_00402');
+value4702 = compute(value, 46)
+value13904 = compute(value, 33)
+value71535 = compute(value, 46)
+value35320 = compute(value, 12)
+value8323 = compute(value, 78)
+# note 30421: keep this in sync with the handler
+value79340 = compute(value, 91)
+value7817 = compute(value, 57)
+value37479 = compute(value, 37)
+value75090 = compute(value, 12)
+value57966 = compute(value, 57)
+value37303 = compute(value, 55)
+value58940 = compute(value, 61)
+value54606 = compute(value, 92)
+value244 = compute(value, 50)
+value98387 = compute(value, 29)
+value28107 = compute(value, 74)
+value86785 = compute(value, 67)
+value8008 = compute(value, 54)
+value8949 = compute(value, 25)
+value96995 = compute(value, 92)
+value99519 = compute(value, 94)
+value74716 = compute(value, 26)
+const v = os.getenv("BENCH_KEY_00235");
+value94441 = compute(value, 60)
+value19014 = compute(value, 2)
+value37183 = compute(value, 32)
+value5616 = compute(value, 87)
+value97410 = compute(value, 22)
+value18945 = compute(value, 30)
+value99767 = compute(value, 51)
+value74188 = compute(value, 80)
+value79417 = compute(value, 71)
+value31240 = compute(value, 6)
+value90998 = compute(value, 12)
+value63141 = compute(value, 91)
+value79480 = compute(value, 37)
+value10959 = compute(value, 95)
+const v = os.getenv("BENCH_KEY_01411");
+value40165 = compute(value, 7)
+value96736 = compute(value, 27)
+value68677 = compute(value, 1)
+value94502 = compute(value, 24)
+value160 = compute(value, 63)
+value77280 = compute(value, 68)
+# note 28244: keep this in sync with the handler
+value65893 = compute(value, 30)
+# note 21170: keep this in sync with the handler
+# note 42895: keep this in sync with the handler
+value24754 = compute(value, 19)
+value66676 = compute(value, 37)
+value53491 = compute(value, 44)
+value99910 = compute(value, 0)
+value2518 = compute(value, 93)
+value99924 = compute(value, 14)
+value55365 = compute(value, 75)
+# note 20664: keep this in sync with the handler
+value54161 = compute(value, 35)
+value16870 = compute(value, 89)
+const v = os.getenv("BENCH_KEY_01929");
+value5757 = compute(value, 34)
+value75284 = compute(value, 12)
+# note 83937: keep this in sync with the handler
+value40062 = compute(value, 1)
+# note 82791: keep this in sync with the handler
+value6413 = compute(value, 11)
+value73577 = compute(value, 51)
+value83614 = compute(value, 0)
+value25969 = compute(value, 70)
+# note 874: keep this in sync with the handler
+value12701 = compute(value, 91)
+value20747 = compute(value, 86)
+value10163 = compute(value, 75)
+value9739 = compute(value, 39)
+value97164 = compute(value, 67)
+value24437 = compute(value, 90)
+const v = os.getenv("BENCH_KEY_00856");
+value9059 = compute(value, 38)
+value5091 = compute(value, 47)
+value40685 = compute(value, 42)
+value44596 = compute(value, 73)
+value3082 = compute(value, 75)
+# note 21268: keep this in sync with the handler
+value92492 = compute(value, 51)
+value69111 = compute(value, 47)
+value65589 = compute(value, 17)
+value54599 = compute(value, 85)
+# note 2710: keep this in sync with the handler
+const v = os.environ.get('BENCH_KEY_00743');
+value27666 = compute(value, 21)
+value72521 = compute(value, 62)
+value1770 = compute(value, 24)
+value40594 = compute(value, 48)
+value56990 = compute(value, 51)
+value19437 = compute(value, 37)
+value68594 = compute(value, 15)
+# note 77406: keep this in sync with the handler
+const v = os.environ["BENCH_KEY_01970"];
+# note 77099: keep this in sync with the handler
+value82096 = compute(value, 34)
+value89468 = compute(value, 34)
+value26200 = compute(value, 10)
+value96103 = compute(value, 73)
+value69166 = compute(value, 5)
+value82628 = compute(value, 81)
+value65668 = compute(value, 96)
+value16768 = compute(value, 84)
+value90953 = compute(value, 64)
+value13791 = compute(value, 17)
+value45187 = compute(value, 82)
+value18712 = compute(value, 88)
+# note 69836: keep this in sync with the handler
+value45400 = compute(value, 4)
+value66690 = compute(value, 51)
+value3936 = compute(value, 56)
+value55906 = compute(value, 34)
+value75297 = compute(value, 25)
+# note 71277: keep this in sync with the handler
+const v = os.environ["BENCH_KEY_00166"];
+value47341 = compute(value, 5)
+value65300 = compute(value, 19)
+# note 68495: keep this in sync with the handler
+value10691 = compute(value, 21)
+# note 1447: keep this in sync with the handler
+value99576 = compute(value, 54)
+value64408 = compute(value, 0)
+# note 98186: keep this in sync with the handler
+value8537 = compute(value, 1)
+value37826 = compute(value, 93)
+# note 1071: keep this in sync with the handler
+value27165 = compute(value, 5)
+value89284 = compute(value, 44)
+value13581 = compute(value, 1)
+value9604 = compute(value, 1)
+const v = os.environ["BENCH_KEY_00423"];
+value58281 = compute(value, 81)
+value24079 = compute(value, 23)
+value31236 = compute(value, 2)
+value62588 = compute(value, 23)
+value64306 = compute(value, 92)
+value47758 = compute(value, 34)
+value39387 = compute(value, 5)
+value33069 = compute(value, 89)
+value62808 = compute(value, 49)
+# note 56137: keep this in sync with the handler
@@ -0,0 +1,237 @@
+value76344 = compute(value, 5)
+value73688 = compute(value, 65)
+value45280 = compute(value, 78)
+value92408 = compute(value, 64)
+value81118 = compute(value, 26)
+value31623 = compute(value, 1)
+value75106 = compute(value, 28)
+value23789 = compute(value, 24)
+const v = os.getenv("BENCH_KEY_00197");
+value17421 = compute(value, 58)
+value33623 = compute(value, 61)
+value93324 = compute(value, 10)
+# note 14548: keep this in sync with the handler
+value90458 = compute(value, 54)
+value81850 = compute(value, 79)
+value84647 = compute(value, 63)
+value38769 = compute(value, 66)
+value71914 = compute(value, 37)
+value54536 = compute(value, 22)
+const v = os.environ["BENCH_KEY_01948"];
+value44989 = compute(value, 78)
+value26986 = compute(value, 20)
+value92607 = compute(value, 69)
+value96178 = compute(value, 51)
+value96723 = compute(value, 14)
+value11365 = compute(value, 16)
+# note 40448: keep this in sync with the handler
+value76762 = compute(value, 35)
+value50081 = compute(value, 29)
+# note 27593: keep this in sync with the handler
+value30500 = compute(value, 42)
+value61395 = compute(value, 91)
+value66247 = compute(value, 93)
+value68604 = compute(value, 25)
+const v = os.environ["BENCH_KEY_01749"];
+value1250 = compute(value, 86)
+# note 21923: keep this in sync with the handler
+value43298 = compute(value, 36)
+value43632 = compute(value, 79)
+value52708 = compute(value, 37)
+# note 32922: keep this in sync with the handler
+value42687 = compute(value, 7)
+value22524 = compute(value, 20)
+value61601 = compute(value, 6)
+value54676 = compute(value, 65)
+value24442 = compute(value, 95)
+# note 74113: keep this in sync with the handler
+value99963 = compute(value, 53)
+# note 2008: keep this in sync with the handler
+value82940 = compute(value, 5)
+value82990 = compute(value, 55)
+value83461 = compute(value, 41)
+# note 64394: keep this in sync with the handler
+# note 56532: keep this in sync with the handler
+const v = os.environ.get('BENCH_KEY_00335');
+value56949 = compute(value, 10)
+value98006 = compute(value, 36)
+value57933 = compute(value, 24)
+value55645 = compute(value, 64)
+value29735 = compute(value, 53)
+value76096 = compute(value, 48)
+value81087 = compute(value, 92)
+value94427 = compute(value, 46)
+value70243 = compute(value, 15)
+value91890 = compute(value, 31)
+value45652 = compute(value, 62)
+value90397 = compute(value, 90)
+value44490 = compute(value, 64)
+value98448 = compute(value, 90)
+const v = os.environ["BENCH_KEY_00539"];
+value299 = compute(value, 8)
+value59197 = compute(value, 27)
+value89244 = compute(value, 4)
+value77821 = compute(value, 27)
+value13040 = compute(value, 42)
+value6282 = compute(value, 74)
+# note 35793: keep this in sync with the handler
+# note 16525: keep this in sync with the handler
+value24780 = compute(value, 45)
+value911 = compute(value, 38)
+value22061 = compute(value, 42)
+value87761 = compute(value, 73)
+value62030 = compute(value, 47)
+value83837 = compute(value, 29)
+value41072 = compute(value, 41)
+const v = os.getenv("BENCH_KEY_00636");
+# note 53813: keep this in sync with the handler
+value14793 = compute(value, 49)
+value88764 = compute(value, 9)
+value34673 = compute(value, 44)
+# note 75629: keep this in sync with the handler
+# note 73540: keep this in sync with the handler
+value77213 = compute(value, 1)
+value20606 = compute(value, 42)
+value18495 = compute(value, 65)
+value43517 = compute(value, 61)
+value86005 = compute(value, 63)
+value4426 = compute(value, 61)
+value79889 = compute(value, 58)
+# note 99711: keep this in sync with the handler
+value22977 = compute(value, 85)
+# note 51855: keep this in sync with the handler
+value33981 = compute(value, 31)
+# note 29741: keep this in sync with the handler
+value77763 = compute(value, 66)
+value35644 = compute(value, 45)
+value49761 = compute(value, 0)
+const v = os.environ.get('BENCH_KEY_00141');
+value38381 = compute(value, 66)
+value17560 = compute(value, 3)
+# note 72091: keep this in sync with the handler
+value91342 = compute(value, 65)
+# note 64044: keep this in sync with the handler
+value67455 = compute(value, 40)
+value34355 = compute(value, 17)
+value61960 = compute(value, 74)
+value96378 = compute(value, 57)
+value15538 = compute(value, 18)
+value11920 = compute(value, 86)
+value79023 = compute(value, 65)
+value45499 = compute(value, 6)
+value62299 = compute(value, 25)
+value44503 = compute(value, 77)
+value96095 = compute(value, 65)
+value69756 = compute(value, 13)
+value12553 = compute(value, 40)
+value72720 = compute(value, 67)
+value32072 = compute(value, 62)
+const v = os.environ.get('BENCH_KEY_01032');
+value54701 = compute(value, 90)
+value73764 = compute(value, 44)
+value86182 = compute(value, 46)
+value14895 = compute(value, 54)
+value74351 = compute(value, 49)
+value12326 = compute(value, 7)
+value39396 = compute(value, 14)
+value87594 = compute(value, 3)
+value18579 = compute(value, 52)
+value32002 = compute(value, 89)
+value64361 = compute(value, 50)
+value93489 = compute(value, 78)
+value89273 = compute(value, 33)
+value99239 = compute(value, 8)
+value2790 = compute(value, 74)
+value1310 = compute(value, 49)
+value62427 = compute(value, 56)
+value85945 = compute(value, 3)
+# note 56345: keep this in sync with the handler
+value86127 = compute(value, 88)
+# note 88755: keep this in sync with the handler
+const v = os.getenv("BENCH_KEY_01116");
+value14050 = compute(value, 82)
+value39319 = compute(value, 34)
+value95810 = compute(value, 71)
+value6870 = compute(value, 80)
+value99922 = compute(value, 12)
+value56894 = compute(value, 52)
+value75533 = compute(value, 67)
+value74659 = compute(value, 66)
+value9394 = compute(value, 82)
+value42543 = compute(value, 57)
+value21832 = compute(value, 7)
+value23947 = compute(value, 85)
+# note 15456: keep this in sync with the handler
+value25819 = compute(value, 17)
+value80760 = compute(value, 56)
+value52547 = compute(value, 70)
+value59398 = compute(value, 34)
+value52293 = compute(value, 10)
+const v = os.getenv("BENCH_KEY_00133");
+value64084 = compute(value, 64)
+value84647 = compute(value, 63)
+# note 33572: keep this in sync with the handler
+value70573 = compute(value, 54)
+value34745 = compute(value, 19)
+value20160 = compute(value, 81)
+# note 48953: keep this in sync with the handler
+value71260 = compute(value, 62)
+value11238 = compute(value, 83)
+value23947 = compute(value, 85)
+value75936 = compute(value, 82)
+const v = os.getenv("BENCH_KEY_00512");
+value91129 = compute(value, 46)
+# note 29988: keep this in sync with the handler
+value30032 = compute(value, 59)
+value18674 = compute(value, 50)
+value50868 = compute(value, 40)
+value47308 = compute(value, 69)
+# note 93487: keep this in sync with the handler
+value56561 = compute(value, 10)
+value15540 = compute(value, 20)
+const v = os.getenv("BENCH_KEY_01327");
+value98208 = compute(value, 44)
+value7897 = compute(value, 40)
+value21444 = compute(value, 7)
+# note 74949: keep this in sync with the handler
+value95280 = compute(value, 26)
+value19578 = compute(value, 81)
+value17039 = compute(value, 64)
+value20396 = compute(value, 26)
+value22533 = compute(value, 29)
+value46632 = compute(value, 72)
+# note 20687: keep this in sync with the handler
+const v = os.environ["BENCH_KEY_00402"];
+value95759 = compute(value, 20)
+value12198 = compute(value, 73)
+value69001 = compute(value, 34)
+value33373 = compute(value, 5)
+value74719 = compute(value, 29)
+value52392 = compute(value, 12)
+# note 34635: keep this in sync with the handler
+value90903 = compute(value, 14)
+value89917 = compute(value, 95)
+value65300 = compute(value, 19)
+value88985 = compute(value, 36)
+value91846 = compute(value, 84)
+const v = os.environ.get('BENCH_KEY_00971');
+value50145 = compute(value, 93)
+value94100 = compute(value, 10)
+value75192 = compute(value, 17)
+value44952 = compute(value, 41)
+value10022 = compute(value, 31)
+value31081 = compute(value, 41)
+# note 53548: keep this in sync with the handler
+value98643 = compute(value, 91)
+value67626 = compute(value, 17)
+value42120 = compute(value, 22)
+value1373 = compute(value, 15)
+value35638 = compute(value, 39)
+value32312 = compute(value, 11)
+value45838 = compute(value, 54)
+value55582 = compute(value, 1)
+value40876 = compute(value, 39)
+value67498 = compute(value, 83)
+value92440 = compute(value, 96)
+value15616 = compute(value, 96)
+value53488 = compute(value, 41)
@@ -0,0 +1,204 @@
+const value58057 = compute(value, 51);
+const value53444 = compute(value, 94);
+const value35442 = compute(value, 37);
+const value31936 = compute(value, 23);
+const value4807 = compute(value, 54);
+const value19677 = compute(value, 83);
+// note 89245: keep this in sync with the handler
+const value69545 = compute(value, 93);
+const value90088 = compute(value, 72);
+const value33718 = compute(value, 59);
+const value17044 = compute(value, 69);
+const value6284 = compute(value, 76);
+const value94077 = compute(value, 84);
+const v = import.meta.env.BENCH_KEY_01572;
+const value84281 = compute(value, 85);
+const value53739 = compute(value, 1);
+const value72583 = compute(value, 27);
+const value26161 = compute(value, 68);
+const value91338 = compute(value, 61);
+const value44727 = compute(value, 10);
+const value65517 = compute(value, 42);
+const value55004 = compute(value, 5);
+const value54746 = compute(value, 38);
+const v = process.env.BENCH_KEY_00517;
+const value92030 = compute(value, 74);
+const value60508 = compute(value, 77);
+const value93221 = compute(value, 4);
+const value84169 = compute(value, 70);
+const value8903 = compute(value, 76);
+const value98753 = compute(value, 7);
+const value78863 = compute(value, 2);
+const value59694 = compute(value, 39);
+const value93463 = compute(value, 52);
+const value91651 = compute(value, 83);
+const value79019 = compute(value, 61);
+const value7184 = compute(value, 6);
+const v = process.env["BENCH_KEY_01010"];
+const value70976 = compute(value, 69);
+const value40625 = compute(value, 79);
+const value32983 = compute(value, 3);
+const value51092 = compute(value, 70);
+const value993 = compute(value, 23);
+const value73794 = compute(value, 74);
+const value88675 = compute(value, 17);
+const value9145 = compute(value, 27);
+// note 96026: keep this in sync with the handler
+const value16565 = compute(value, 75);
+const value91760 = compute(value, 95);
+const value23384 = compute(value, 7);
+const value14379 = compute(value, 23);
+const v = process.env.BENCH_KEY_01898;
+const value96360 = compute(value, 39);
+const value44543 = compute(value, 20);
+const value92627 = compute(value, 89);
+// note 428: keep this in sync with the handler
+const value69542 = compute(value, 90);
+const value48260 = compute(value, 51);
+const value90658 = compute(value, 60);
+const value90744 = compute(value, 49);
+const value74835 = compute(value, 48);
+// note 36712: keep this in sync with the handler
+const value75695 = compute(value, 35);
+const value16874 = compute(value, 93);
+const v = process.env.BENCH_KEY_01694;
+const value62973 = compute(value, 20);
+const value73125 = compute(value, 84);
+const value49827 = compute(value, 66);
+const value34208 = compute(value, 64);
+const value12526 = compute(value, 13);
+const value63223 = compute(value, 76);
+const value85508 = compute(value, 51);
+const value28284 = compute(value, 57);
+const value47508 = compute(value, 75);
+const value40638 = compute(value, 92);
+const value84604 = compute(value, 20);
+const value14758 = compute(value, 14);
+const value21099 = compute(value, 50);
+// note 8700: keep this in sync with the handler
+const value7519 = compute(value, 50);
+const v = import.meta.env.BENCH_KEY_00762;
+// note 35163: keep this in sync with the handler
+const value93880 = compute(value, 81);
+const value32177 = compute(value, 70);
+// note 41237: keep this in sync with the handler
+const value51683 = compute(value, 79);
+const value69497 = compute(value, 45);
+const value60481 = compute(value, 50);
+const value40194 = compute(value, 36);
+const value3009 = compute(value, 2);
+const value47959 = compute(value, 41);
+const value40287 = compute(value, 32);
+const v = process.env.BENCH_KEY_00795;
+const value95228 = compute(value, 71);
+const value27634 = compute(value, 86);
+const value16560 = compute(value, 70);
+const value96799 = compute(value, 90);
+const value90123 = compute(value, 10);
+const value23192 = compute(value, 9);
+const value77942 = compute(value, 51);
+const value72056 = compute(value, 82);
+const value54199 = compute(value, 73);
+const value86749 = compute(value, 31);
+const value41573 = compute(value, 57);
+// note 51308: keep this in sync with the handler
+const value89188 = compute(value, 45);
+const value75216 = compute(value, 41);
+const v = process.env["BENCH_KEY_01496"];
+const value28693 = compute(value, 78);
+const value96553 = compute(value, 38);
+const value50818 = compute(value, 87);
+const value10007 = compute(value, 16);
+const value72005 = compute(value, 31);
+const value19720 = compute(value, 29);
+const value14536 = compute(value, 83);
+const value33915 = compute(value, 62);
+const value44375 = compute(value, 46);
+const value99137 = compute(value, 3);
+const value84167 = compute(value, 68);
+const value59823 = compute(value, 71);
+const value11512 = compute(value, 66);
+// note 88474: keep this in sync with the handler
+// note 28076: keep this in sync with the handler
+const value4369 = compute(value, 4);
+const value51737 = compute(value, 36);
+const value75077 = compute(value, 96);
+const v = import.meta.env.BENCH_KEY_01154;
+const value19898 = compute(value, 13);
+const value51363 = compute(value, 50);
+// note 77826: keep this in sync with the handler
+const value54288 = compute(value, 65);
+const value15297 = compute(value, 68);
+const value46233 = compute(value, 61);
+const value2443 = compute(value, 18);
+const value36976 = compute(value, 19);
+// note 67625: keep this in sync with the handler
+const value36905 = compute(value, 45);
+// note 52652: keep this in sync with the handler
+const value5909 = compute(value, 89);
+// note 35398: keep this in sync with the handler
+const v = process.env["BENCH_KEY_00053"];
+const value79979 = compute(value, 51);
+const value79002 = compute(value, 44);
+const value41057 = compute(value, 26);
+// note 11657: keep this in sync with the handler
+const value35743 = compute(value, 47);
+// note 36644: keep this in sync with the handler
+// note 99308: keep this in sync with the handler
+const value26332 = compute(value, 45);
+const value72906 = compute(value, 59);
+const value22301 = compute(value, 88);
+const value30626 = compute(value, 71);
+// note 98701: keep this in sync with the handler
+const value68687 = compute(value, 11);
+const value69600 = compute(value, 51);
+const value86568 = compute(value, 44);
+const value3117 = compute(value, 13);
+const value62282 = compute(value, 8);
+const value55422 = compute(value, 35);
+const value88014 = compute(value, 35);
+const v = process.env["BENCH_KEY_00318"];
+const value17530 = compute(value, 70);
+const value33821 = compute(value, 65);
+const value36976 = compute(value, 19);
+const value85119 = compute(value, 50);
+const value37252 = compute(value, 4);
+const value38061 = compute(value, 37);
+const value73854 = compute(value, 37);
+const value67969 = compute(value, 69);
+const value21866 = compute(value, 41);
+const value36282 = compute(value, 4);
+const value91146 = compute(value, 63);
+const value85963 = compute(value, 21);
+// note 52143: keep this in sync with the handler
+const v = process.env.BENCH_KEY_00340;
+const value99942 = compute(value, 32);
+const value52913 = compute(value, 48);
+const value74435 = compute(value, 36);
+// note 86303: keep this in sync with the handler
+const value80377 = compute(value, 61);
+const value44925 = compute(value, 14);
+const value17631 = compute(value, 74);
+const value11112 = compute(value, 54);
+const value63184 = compute(value, 37);
+const value97173 = compute(value, 76);
+const value98878 = compute(value, 35);
+const v = process.env["BENCH_KEY_00699"];
+const value74605 = compute(value, 12);
+const value77733 = compute(value, 36);
+const value14058 = compute(value, 90);
+const value69908 = compute(value, 68);
+const value13119 = compute(value, 24);
+// note 38875: keep this in sync with the handler
+const value91564 = compute(value, 93);
+// note 81367: keep this in sync with the handler
+const value74235 = compute(value, 30);
+const value7463 = compute(value, 91);
+// note 16994: keep this in sync with the handler
+const value488 = compute(value, 3);
+const value3314 = compute(value, 16);
+const value83538 = compute(value, 21);
+const value77574 = compute(value, 71);
+const value92168 = compute(value, 18);
+const value87675 = compute(value, 84);
+// note 14588: keep this in sync with the handler
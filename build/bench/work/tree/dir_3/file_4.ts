@@ -0,0 +1,205 @@
+const value42873 = compute(value, 96);
+// note 89399: keep this in sync with the handler
+const value60032 = compute(value, 86);
+const value20254 = compute(value, 78);
+const value37309 = compute(value, 61);
+const value23542 = compute(value, 68);
+const value44706 = compute(value, 86);
+const value91101 = compute(value, 18);
+const value25535 = compute(value, 24);
+const value45984 = compute(value, 6);
+const value77470 = compute(value, 64);
+const value10337 = compute(value, 55);
+const v = process.env["BENCH_KEY_01125"];
+const value8827 = compute(value, 0);
+const value19551 = compute(value, 54);
+const value70041 = compute(value, 7);
+const value94003 = compute(value, 10);
+const value67803 = compute(value, 0);
+const value4739 = compute(value, 83);
+const value88479 = compute(value, 15);
+const value56388 = compute(value, 31);
+const value84574 = compute(value, 87);
+const value84214 = compute(value, 18);
+const value72871 = compute(value, 24);
+const v = process.env.BENCH_KEY_00911;
+const value15012 = compute(value, 74);
+const value62169 = compute(value, 89);
+const value37409 = compute(value, 64);
+const value32568 = compute(value, 73);
+const value66557 = compute(value, 15);
+const value5498 = compute(value, 66);
+const value31094 = compute(value, 54);
+const value2536 = compute(value, 14);
+const v = process.env["BENCH_KEY_00167"];
+const value75004 = compute(value, 23);
+const value38389 = compute(value, 74);
+const value7563 = compute(value, 94);
+const value40468 = compute(value, 19);
+const value98830 = compute(value, 84);
+// note 48555: keep this in sync with the handler
+const value32900 = compute(value, 17);
+const value43133 = compute(value, 65);
+const value21405 = compute(value, 65);
+const value34879 = compute(value, 56);
+// note 34476: keep this in sync with the handler
+const value82361 = compute(value, 8);
+const value3175 = compute(value, 71);
+const value58552 = compute(value, 61);
+const value16863 = compute(value, 82);
+const value1009 = compute(value, 39);
+const value19499 = compute(value, 2);
+const value21523 = compute(value, 86);
+const value49925 = compute(value, 67);
+const v = process.env["BENCH_KEY_00799"];
+const value70232 = compute(value, 4);
+const value95843 = compute(value, 7);
+const value10711 = compute(value, 41);
+const value53001 = compute(value, 39);
+const value93017 = compute(value, 91);
+const value57409 = compute(value, 82);
+const value58951 = compute(value, 72);
+const value76414 = compute(value, 75);
+// note 99626: keep this in sync with the handler
+// note 74879: keep this in sync with the handler
+const value82925 = compute(value, 87);
+const value7366 = compute(value, 91);
+// note 54971: keep this in sync with the handler
+const v = process.env["BENCH_KEY_01735"];
+const value86549 = compute(value, 25);
+const value53530 = compute(value, 83);
+const value88901 = compute(value, 49);
+// note 6242: keep this in sync with the handler
+const value82129 = compute(value, 67);
+const value54605 = compute(value, 91);
+const value22646 = compute(value, 45);
+const value80002 = compute(value, 74);
+const v = process.env["BENCH_KEY_00038"];
+// note 95768: keep this in sync with the handler
+const value75615 = compute(value, 52);
+const value67156 = compute(value, 32);
+const value52259 = compute(value, 73);
+const value70755 = compute(value, 42);
+const value55557 = compute(value, 73);
+const value50931 = compute(value, 6);
+const value75243 = compute(value, 68);
+const value58339 = compute(value, 42);
+const v = process.env["BENCH_KEY_00704"];
+// note 30479: keep this in sync with the handler
+const value8136 = compute(value, 85);
+const value91886 = compute(value, 27);
+const value61230 = compute(value, 23);
+const value24886 = compute(value, 54);
+const value87541 = compute(value, 47);
+const value23084 = compute(value, 95);
+// note 27565: keep this in sync with the handler
+const value22677 = compute(value, 76);
+const value79485 = compute(value, 42);
+const value49116 = compute(value, 34);
+const value10574 = compute(value, 1);
+const value62794 = compute(value, 35);
+const value11887 = compute(value, 53);
+const v = process.env.BENCH_KEY_00848;
+const value74178 = compute(value, 70);
+const value41072 = compute(value, 41);
+const value34061 = compute(value, 14);
+const value89080 = compute(value, 34);
+const value96471 = compute(value, 53);
+// note 95754: keep this in sync with the handler
+const value2926 = compute(value, 16);
+const value26081 = compute(value, 85);
+const value92094 = compute(value, 41);
+// note 97657: keep this in sync with the handler
+const value33262 = compute(value, 88);
+const value73953 = compute(value, 39);
+// note 57099: keep this in sync with the handler
+const v = process.env["BENCH_KEY_00749"];
+const value55431 = compute(value, 44);
+const value82110 = compute(value, 48);
+const value94554 = compute(value, 76);
+const value84832 = compute(value, 54);
+const value15309 = compute(value, 80);
+const value40422 = compute(value, 70);
+const value78460 = compute(value, 84);
+const value29309 = compute(value, 15);
+const value78733 = compute(value, 66);
+const value92987 = compute(value, 61);
+const value54242 = compute(value, 19);
+const value27721 = compute(value, 76);
+const value60345 = compute(value, 11);
+// note 51216: keep this in sync with the handler
+const v = process.env["BENCH_KEY_01890"];
+const value38519 = compute(value, 10);
+// note 84162: keep this in sync with the handler
+const value39896 = compute(value, 29);
+const value98550 = compute(value, 95);
+const value50270 = compute(value, 24);
+const value94091 = compute(value, 1);
+const value60404 = compute(value, 70);
+const value30883 = compute(value, 37);
+const value55481 = compute(value, 94);
+const v = import.meta.env.BENCH_KEY_01831;
+const value79906 = compute(value, 75);
+// note 25175: keep this in sync with the handler
+const value56200 = compute(value, 37);
+const value55743 = compute(value, 65);
+const value4422 = compute(value, 57);
+const value4460 = compute(value, 95);
+const value4876 = compute(value, 26);
+const value26837 = compute(value, 65);
+const value33269 = compute(value, 95);
+const value63177 = compute(value, 30);
+const value50656 = compute(value, 22);
+const v = process.env["BENCH_KEY_00700"];
+const value75213 = compute(value, 38);
+// note 99686: keep this in sync with the handler
+const value17483 = compute(value, 23);
+const value38253 = compute(value, 35);
+const value25281 = compute(value, 61);
+const value80500 = compute(value, 87);
+const value10742 = compute(value, 72);
+const value34130 = compute(value, 83);
+// note 44611: keep this in sync with the handler
+const v = process.env.BENCH_KEY_01954;
+const value68301 = compute(value, 13);
+const value61503 = compute(value, 5);
+const value33849 = compute(value, 93);
+const value3418 = compute(value, 23);
+const value46892 = compute(value, 41);
+const value76099 = compute(value, 51);
+// note 8885: keep this in sync with the handler
+const value38010 = compute(value, 83);
+const v = import.meta.env.BENCH_KEY_00127;
+const value46923 = compute(value, 72);
+// note 50942: keep this in sync with the handler
+const value14562 = compute(value, 12);
+const value92593 = compute(value, 55);
+// note 30189: keep this in sync with the handler
+const value42523 = compute(value, 37);
+const value35437 = compute(value, 32);
+const value24325 = compute(value, 75);
+const value84784 = compute(value, 6);
+const value64856 = compute(value, 60);
+const value53699 = compute(value, 58);
+const v = import.meta.env.BENCH_KEY_00826;
+const value82846 = compute(value, 8);
+const value4679 = compute(value, 23);
+const value50758 = compute(value, 27);
+const value94403 = compute(value, 22);
+const value42819 = compute(value, 42);
+const value26668 = compute(value, 90);
+const value91203 = compute(value, 23);
+const value22406 = compute(value, 96);
+const value60802 = compute(value, 80);
+const value14725 = compute(value, 78);
+const value91950 = compute(value, 91);
+const value9760 = compute(value, 60);
+const value17474 = compute(value, 14);
+const v = process.env.BENCH_KEY_00295;
+const value62546 = compute(value, 78);
+const value719 = compute(value, 40);
+const value5481 = compute(value, 49);
+const value25846 = compute(value, 44);
+const value76387 = compute(value, 48);
+const value96451 = compute(value, 33);
+const value95335 = compute(value, 81);
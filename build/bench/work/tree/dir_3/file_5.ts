@@ -0,0 +1,204 @@
+const value25961 = compute(value, 62);
+const value4030 = compute(value, 53);
+const value69401 = compute(value, 46);
+const value94151 = compute(value, 61);
+const value59681 = compute(value, 26);
+const value82708 = compute(value, 64);
+const value73865 = compute(value, 48);
+const value37026 = compute(value, 69);
+const value59808 = compute(value, 56);
+const value81368 = compute(value, 82);
+const value74820 = compute(value, 33);
+const value5370 = compute(value, 35);
+const v = process.env.BENCH_KEY_00258;
+const value32419 = compute(value, 21);
+const value8396 = compute(value, 54);
+const value63401 = compute(value, 60);
+const value9453 = compute(value, 44);
+const value45536 = compute(value, 43);
+const value66649 = compute(value, 10);
+const value46436 = compute(value, 70);
+const value2051 = compute(value, 14);
+const value48801 = compute(value, 10);
+const value28412 = compute(value, 88);
+const value98936 = compute(value, 93);
+const v = process.env["BENCH_KEY_01274"];
+const value65692 = compute(value, 23);
+const value26165 = compute(value, 72);
+const value13194 = compute(value, 2);
+const value85621 = compute(value, 67);
+const value36365 = compute(value, 87);
+const value61183 = compute(value, 73);
+const value10664 = compute(value, 91);
+const value96150 = compute(value, 23);
+const value70369 = compute(value, 44);
+const value52921 = compute(value, 56);
+const value28215 = compute(value, 85);
+const value29583 = compute(value, 95);
+const value92431 = compute(value, 87);
+// note 6552: keep this in sync with the handler
+const v = import.meta.env.BENCH_KEY_01921;
+const value5846 = compute(value, 26);
+const value12183 = compute(value, 58);
+const value68222 = compute(value, 31);
+const value61287 = compute(value, 80);
+const value66982 = compute(value, 52);
+// note 23445: keep this in sync with the handler
+const value35589 = compute(value, 87);
+const value31203 = compute(value, 66);
+const value77501 = compute(value, 95);
+const value26640 = compute(value, 62);
+const value5564 = compute(value, 35);
+const value65794 = compute(value, 28);
+const value83930 = compute(value, 25);
+const value3393 = compute(value, 95);
+const v = import.meta.env.BENCH_KEY_00508;
+const value58874 = compute(value, 92);
+const value82696 = compute(value, 52);
+const value4045 = compute(value, 68);
+const value19228 = compute(value, 22);
+const value69447 = compute(value, 92);
+const value94849 = compute(value, 80);
+const value64905 = compute(value, 12);
+const value83549 = compute(value, 32);
+// note 48485: keep this in sync with the handler
+const value68951 = compute(value, 81);
+const value41203 = compute(value, 75);
+const value21636 = compute(value, 5);
+const value54860 = compute(value, 55);
+const value17728 = compute(value, 74);
+const value53008 = compute(value, 46);
+const value75748 = compute(value, 88);
+const value82294 = compute(value, 38);
+const v = process.env["BENCH_KEY_00773"];
+const value32097 = compute(value, 87);
+const value34633 = compute(value, 4);
+const value30328 = compute(value, 64);
+const value14254 = compute(value, 92);
+const value56749 = compute(value, 4);
+const value13278 = compute(value, 86);
+const value80806 = compute(value, 5);
+const value79985 = compute(value, 57);
+const value85513 = compute(value, 56);
+const value30753 = compute(value, 4);
+const value35042 = compute(value, 25);
+const value12490 = compute(value, 74);
+const value37246 = compute(value, 95);
+const value64481 = compute(value, 73);
+const value21980 = compute(value, 58);
+const value33989 = compute(value, 39);
+const value61718 = compute(value, 26);
+const value180 = compute(value, 83);
+const value20617 = compute(value, 53);
+const value98617 = compute(value, 65);
+const v = import.meta.env.BENCH_KEY_01442;
+const value79702 = compute(value, 65);
+const value55923 = compute(value, 51);
+const value38293 = compute(value, 75);
+const value84754 = compute(value, 73);
+const value94638 = compute(value, 63);
+// note 81529: keep this in sync with the handler
+const value23110 = compute(value, 24);
+const value96761 = compute(value, 52);
+const v = process.env["BENCH_KEY_00169"];
+// note 4733: keep this in sync with the handler
+const value87910 = compute(value, 28);
+const value79884 = compute(value, 53);
+const value73301 = compute(value, 66);
+const value66502 = compute(value, 57);
+const value58915 = compute(value, 36);
+// note 73054: keep this in sync with the handler
+const value39114 = compute(value, 23);
+const value17300 = compute(value, 34);
+const value48746 = compute(value, 52);
+// note 96712: keep this in sync with the handler
+const value1675 = compute(value, 26);
+// note 89082: keep this in sync with the handler
+const value57875 = compute(value, 63);
+const value39178 = compute(value, 87);
+// note 27083: keep this in sync with the handler
+// note 74630: keep this in sync with the handler
+const v = process.env.BENCH_KEY_01255;
+const value24318 = compute(value, 68);
+const value98964 = compute(value, 24);
+const value9033 = compute(value, 12);
+const value31381 = compute(value, 50);
+const value70390 = compute(value, 65);
+const value48733 = compute(value, 39);
+const value99065 = compute(value, 28);
+const value83431 = compute(value, 11);
+const value11454 = compute(value, 8);
+const value71837 = compute(value, 57);
+const v = import.meta.env.BENCH_KEY_00726;
+const value70209 = compute(value, 78);
+const value82862 = compute(value, 24);
+// note 8994: keep this in sync with the handler
+const value57546 = compute(value, 25);
+const value17922 = compute(value, 74);
+const value96506 = compute(value, 88);
+const value76517 = compute(value, 81);
+const value71428 = compute(value, 36);
+const value18444 = compute(value, 14);
+const value13694 = compute(value, 17);
+const value68335 = compute(value, 47);
+const value80623 = compute(value, 16);
+const value36027 = compute(value, 40);
+const value98180 = compute(value, 16);
+const value40197 = compute(value, 39);
+const value43755 = compute(value, 8);
+const value75959 = compute(value, 8);
+// note 67007: keep this in sync with the handler
+const v = process.env["BENCH_KEY_01696"];
+const value80928 = compute(value, 30);
+const value90392 = compute(value, 85);
+const value16482 = compute(value, 89);
+const value21687 = compute(value, 56);
+// note 7897: keep this in sync with the handler
+const value68662 = compute(value, 83);
+// note 16566: keep this in sync with the handler
+const value99162 = compute(value, 28);
+const value5358 = compute(value, 23);
+const value38222 = compute(value, 4);
+const v = process.env.BENCH_KEY_01084;
+// note 65145: keep this in sync with the handler
+// note 31779: keep this in sync with the handler
+// note 67091: keep this in sync with the handler
+const value35495 = compute(value, 90);
+const value73685 = compute(value, 62);
+const value87289 = compute(value, 86);
+const value73902 = compute(value, 85);
+const value23023 = compute(value, 34);
+const value51495 = compute(value, 85);
+// note 77997: keep this in sync with the handler
+const v = import.meta.env.BENCH_KEY_01660;
+const value32446 = compute(value, 48);
+const value58194 = compute(value, 91);
+// note 94990: keep this in sync with the handler
+const value1618 = compute(value, 66);
+const value22239 = compute(value, 26);
+const value39471 = compute(value, 89);
+const value63822 = compute(value, 93);
+const value19228 = compute(value, 22);
+const value6119 = compute(value, 8);
+const value20391 = compute(value, 21);
+const value72038 = compute(value, 64);
+const value71401 = compute(value, 9);
+const value21812 = compute(value, 84);
+const value49883 = compute(value, 25);
+const value77532 = compute(value, 29);
+const value12299 = compute(value, 77);
+const value47621 = compute(value, 91);
+// note 52363: keep this in sync with the handler
+const v = import.meta.env.BENCH_KEY_01441;
+const value80237 = compute(value, 18);
+const value34081 = compute(value, 34);
+// note 32025: keep this in sync with the handler
+const value84917 = compute(value, 42);
+const value42116 = compute(value, 18);
+const value28398 = compute(value, 74);
+const value76578 = compute(value, 45);
+const value99168 = compute(value, 34);
+const value44843 = compute(value, 29);
+const value70129 = compute(value, 95);
+const value44972 = compute(value, 61);
+// note 12574: keep this in sync with the handler
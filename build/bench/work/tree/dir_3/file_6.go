@@ -0,0 +1,234 @@
+value79948 := compute(value, 20)
+const v = os.LookupEnv("BENCH_KEY_00029");
+value16212 := compute(value, 13)
+value42386 := compute(value, 94)
+value41613 := compute(value, 0)
+value16578 := compute(value, 88)
+value80816 := compute(value, 15)
+value19927 := compute(value, 42)
+// note 71329: keep this in sync with the handler
+value68253 := compute(value, 62)
+value13750 := compute(value, 73)
+value96876 := compute(value, 70)
+value19962 := compute(value, 77)
+value19467 := compute(value, 67)
+const v = os.LookupEnv("BENCH_KEY_00162");
+value10218 := compute(value, 33)
+// note 3928: keep this in sync with the handler
+value33827 := compute(value, 71)
+value83604 := compute(value, 87)
+value75629 := compute(value, 66)
+value10910 := compute(value, 46)
+value42850 := compute(value, 73)
+value17318 := compute(value, 52)
+value42691 := compute(value, 11)
+value15333 := compute(value, 7)
+value25618 := compute(value, 10)
+value68504 := compute(value, 22)
+value18029 := compute(value, 84)
+value7546 := compute(value, 77)
+value41984 := compute(value, 80)
+value62437 := compute(value, 66)
+value24246 := compute(value, 93)
+value13072 := compute(value, 74)
+value19686 := compute(value, 92)
+value80830 := compute(value, 29)
+value99430 := compute(value, 5)
+value59376 := compute(value, 12)
+const v = os.Getenv("BENCH_KEY_01128");
+value84740 := compute(value, 59)
+value54840 := compute(value, 35)
+value30490 := compute(value, 32)
+value15294 := compute(value, 65)
+// note 59643: keep this in sync with the handler
+value55955 := compute(value, 83)
+value1810 := compute(value, 64)
+value96861 := compute(value, 55)
+value63281 := compute(value, 37)
+value14532 := compute(value, 79)
+value59460 := compute(value, 96)
+value44248 := compute(value, 16)
+value58321 := compute(value, 24)
+value68471 := compute(value, 86)
+value54418 := compute(value, 1)
+value34436 := compute(value, 1)
+value8947 := compute(value, 23)
+value26843 := compute(value, 71)
+value87499 := compute(value, 5)
+value13553 := compute(value, 70)
+const v = os.Getenv("BENCH_KEY_01402");
+value46005 := compute(value, 27)
+value13849 := compute(value, 75)
+value99712 := compute(value, 93)
+value41841 := compute(value, 34)
+value83425 := compute(value, 5)
+// note 37932: keep this in sync with the handler
+value59253 := compute(value, 83)
+value67250 := compute(value, 29)
+value24931 := compute(value, 2)
+value99205 := compute(value, 71)
+// note 69141: keep this in sync with the handler
+value56286 := compute(value, 26)
+// note 2582: keep this in sync with the handler
+value31114 := compute(value, 74)
+value62298 := compute(value, 24)
+value26178 := compute(value, 85)
+value22705 := compute(value, 7)
+value52590 := compute(value, 16)
+value26654 := compute(value, 76)
+value61291 := compute(value, 84)
+const v = os.Getenv("BENCH_KEY_01792");
+value26885 := compute(value, 16)
+value50073 := compute(value, 21)
+value91182 := compute(value, 2)
+value32777 := compute(value, 88)
+value55389 := compute(value, 2)
+value29874 := compute(value, 95)
+// note 3012: keep this in sync with the handler
+value49633 := compute(value, 66)
+value93544 := compute(value, 36)
+value53366 := compute(value, 16)
+value79270 := compute(value, 21)
+value60021 := compute(value, 75)
+value84787 := compute(value, 9)
+value68354 := compute(value, 66)
+value48857 := compute(value, 66)
+value74277 := compute(value, 72)
+value17241 := compute(value, 72)
+const v = os.Getenv("BENCH_KEY_00580");
+value46983 := compute(value, 35)
+value36881 := compute(value, 21)
+value14134 := compute(value, 69)
+value46615 := compute(value, 55)
+value46985 := compute(value, 37)
+value71864 := compute(value, 84)
+value29472 := compute(value, 81)
+value44223 := compute(value, 88)
+// note 22533: keep this in sync with the handler
+value98300 := compute(value, 39)
+value88924 := compute(value, 72)
+value91336 := compute(value, 59)
+value51098 := compute(value, 76)
+value51758 := compute(value, 57)
+const v = os.Getenv("BENCH_KEY_01604");
+value21729 := compute(value, 1)
+value56288 := compute(value, 28)
+value74409 := compute(value, 10)
+value21908 := compute(value, 83)
+value46575 := compute(value, 15)
+value96394 := compute(value, 73)
+// note 21759: keep this in sync with the handler
+value81949 := compute(value, 81)
+// note 2495: keep this in sync with the handler
+value3627 := compute(value, 38)
+value24137 := compute(value, 81)
+value24919 := compute(value, 87)
+value14015 := compute(value, 47)
+value7615 := compute(value, 49)
+value72034 := compute(value, 60)
+value22632 := compute(value, 31)
+// note 29012: keep this in sync with the handler
+value92809 := compute(value, 77)
+value10943 := compute(value, 79)
+value70153 := compute(value, 22)
+value70390 := compute(value, 65)
+const v = os.LookupEnv("BENCH_KEY_00713");
+value68188 := compute(value, 94)
+value55313 := compute(value, 23)
+value1059 := compute(value, 89)
+value86605 := compute(value, 81)
+value37342 := compute(value, 94)
+value31598 := compute(value, 73)
+value12791 := compute(value, 84)
+value48204 := compute(value, 92)
+value31471 := compute(value, 43)
+value59343 := compute(value, 76)
+// note 35802: keep this in sync with the handler
+value99235 := compute(value, 4)
+const v = os.Getenv("BENCH_KEY_01901");
+value22474 := compute(value, 67)
+value76952 := compute(value, 31)
+value91205 := compute(value, 25)
+value91348 := compute(value, 71)
+value61240 := compute(value, 33)
+value16058 := compute(value, 53)
+value1138 := compute(value, 71)
+value36557 := compute(value, 85)
+value40304 := compute(value, 49)
+value7372 := compute(value, 0)
+value39232 := compute(value, 44)
+value54015 := compute(value, 83)
+value50796 := compute(value, 65)
+value45924 := compute(value, 43)
+value73527 := compute(value, 1)
+value34639 := compute(value, 10)
+value54683 := compute(value, 72)
+value76762 := compute(value, 35)
+value15362 := compute(value, 36)
+const v = os.LookupEnv("BENCH_KEY_01496");
+value88017 := compute(value, 38)
+value80152 := compute(value, 30)
+value84861 := compute(value, 83)
+value39836 := compute(value, 66)
+// note 14463: keep this in sync with the handler
+value89182 := compute(value, 39)
+value97199 := compute(value, 5)
+value76776 := compute(value, 49)
+// note 86357: keep this in sync with the handler
+const v = os.Getenv("BENCH_KEY_00893");
+value34359 := compute(value, 21)
+value10717 := compute(value, 47)
+// note 19838: keep this in sync with the handler
+value89484 := compute(value, 50)
+value10936 := compute(value, 72)
+value42945 := compute(value, 71)
+// note 99965: keep this in sync with the handler
+value69891 := compute(value, 51)
+value21121 := compute(value, 72)
+value85863 := compute(value, 18)
+value69407 := compute(value, 52)
+// note 39260: keep this in sync with the handler
+value5526 := compute(value, 94)
+value89388 := compute(value, 51)
+value57240 := compute(value, 10)
+value33217 := compute(value, 43)
+// note 53313: keep this in sync with the handler
+value79159 := compute(value, 7)
+value22003 := compute(value, 81)
+value98519 := compute(value, 64)
+value75464 := compute(value, 95)
+// note 49597: keep this in sync with the handler
+const v = os.LookupEnv("BENCH_KEY_00121");
+value56847 := compute(value, 5)
+value47283 := compute(value, 44)
+value64671 := compute(value, 69)
+// note 8838: keep this in sync with the handler
+value16203 := compute(value, 4)
+value50722 := compute(value, 88)
+value94368 := compute(value, 84)
+value57667 := compute(value, 49)
+value82290 := compute(value, 34)
+value73743 := compute(value, 23)
+value40866 := compute(value, 29)
+// note 54266: keep this in sync with the handler
+value52579 := compute(value, 5)
+value26665 := compute(value, 87)
+// note 20171: keep this in sync with the handler
+const v = os.LookupEnv("BENCH_KEY_01196");
+value15527 := compute(value, 7)
+value718 := compute(value, 39)
+value4959 := compute(value, 12)
+// note 58981: keep this in sync with the handler
+value72148 := compute(value, 77)
+value40847 := compute(value, 10)
+value71156 := compute(value, 55)
+value56268 := compute(value, 8)
+value17353 := compute(value, 87)
+const v = os.Getenv("BENCH_KEY_00181");
+value56503 := compute(value, 49)
+value35604 := compute(value, 5)
+value90043 := compute(value, 27)
+value80555 := compute(value, 45)
+// note 24081: keep this in sync with the handler
+// note 82388: keep this in sync with the handler
+// note 45236: keep this in sync with the handler
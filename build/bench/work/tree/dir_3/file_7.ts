@@ -0,0 +1,203 @@
+const value10678 = compute(value, 8);
+const value1477 = compute(value, 22);
+const value13072 = compute(value, 74);
+const v = import.meta.env.BENCH_KEY_00289;
+// note 55539: keep this in sync with the handler
+// note 88267: keep this in sync with the handler
+const value71267 = compute(value, 69);
+const value26936 = compute(value, 67);
+// note 26750: keep this in sync with the handler
+const value69520 = compute(value, 68);
+// note 67739: keep this in sync with the handler
+const value30393 = compute(value, 32);
+const value22622 = compute(value, 21);
+const value37140 = compute(value, 86);
+const value27736 = compute(value, 91);
+const value57845 = compute(value, 33);
+const v = process.env["BENCH_KEY_00794"];
+const value47810 = compute(value, 86);
+const value44088 = compute(value, 50);
+const value22303 = compute(value, 90);
+// note 87733: keep this in sync with the handler
+const value90819 = compute(value, 27);
+// note 88679: keep this in sync with the handler
+const value98622 = compute(value, 70);
+const value59135 = compute(value, 62);
+const v = process.env.BENCH_KEY_01637;
+const value95714 = compute(value, 72);
+const value8211 = compute(value, 63);
+const value50748 = compute(value, 17);
+const value23836 = compute(value, 71);
+const value61006 = compute(value, 90);
+const value68166 = compute(value, 72);
+const value80822 = compute(value, 21);
+const value50297 = compute(value, 51);
+const value36293 = compute(value, 15);
+// note 30432: keep this in sync with the handler
+const value49243 = compute(value, 64);
+// note 23535: keep this in sync with the handler
+const value7213 = compute(value, 35);
+// note 41117: keep this in sync with the handler
+const value74762 = compute(value, 72);
+const value22931 = compute(value, 39);
+const v = process.env["BENCH_KEY_00547"];
+const value75118 = compute(value, 40);
+const value18234 = compute(value, 95);
+const value24977 = compute(value, 48);
+const value89217 = compute(value, 74);
+const value69213 = compute(value, 52);
+const value59178 = compute(value, 8);
+const value77542 = compute(value, 39);
+const value96293 = compute(value, 69);
+const value88321 = compute(value, 51);
+const value25402 = compute(value, 85);
+const value98063 = compute(value, 93);
+const value77803 = compute(value, 9);
+// note 39677: keep this in sync with the handler
+const value75996 = compute(value, 45);
+const value81046 = compute(value, 51);
+const v = process.env.BENCH_KEY_00982;
+const value29214 = compute(value, 17);
+const value7349 = compute(value, 74);
+const value40910 = compute(value, 73);
+const value16248 = compute(value, 49);
+const value39197 = compute(value, 9);
+// note 58785: keep this in sync with the handler
+const value18489 = compute(value, 59);
+// note 46699: keep this in sync with the handler
+const value47237 = compute(value, 95);
+const value20146 = compute(value, 67);
+const value24790 = compute(value, 55);
+const value52345 = compute(value, 62);
+const value62739 = compute(value, 77);
+// note 31541: keep this in sync with the handler
+const v = process.env["BENCH_KEY_01833"];
+const value74254 = compute(value, 49);
+const value7406 = compute(value, 34);
+const value7510 = compute(value, 41);
+const value4709 = compute(value, 53);
+const value20832 = compute(value, 74);
+const value20938 = compute(value, 83);
+const value96268 = compute(value, 44);
+const value30539 = compute(value, 81);
+const value48221 = compute(value, 12);
+const value83744 = compute(value, 33);
+const value96986 = compute(value, 83);
+const value71211 = compute(value, 13);
+const value15014 = compute(value, 76);
+const value63781 = compute(value, 52);
+const value98121 = compute(value, 54);
+const value70012 = compute(value, 75);
+// note 82792: keep this in sync with the handler
+const value16987 = compute(value, 12);
+const value60061 = compute(value, 18);
+const value61512 = compute(value, 14);
+const v = process.env["BENCH_KEY_00731"];
+const value75515 = compute(value, 49);
+const value63505 = compute(value, 67);
+const value93735 = compute(value, 33);
+const value84492 = compute(value, 5);
+// note 33636: keep this in sync with the handler
+const value72355 = compute(value, 90);
+// note 56486: keep this in sync with the handler
+const value57136 = compute(value, 3);
+const value95367 = compute(value, 16);
+const value69075 = compute(value, 11);
+const v = import.meta.env.BENCH_KEY_01059;
+const value42370 = compute(value, 78);
+const value75833 = compute(value, 76);
+// note 813: keep this in sync with the handler
+const value33855 = compute(value, 2);
+// note 56284: keep this in sync with the handler
+const value45397 = compute(value, 1);
+const value74122 = compute(value, 14);
+const value81626 = compute(value, 49);
+const value89888 = compute(value, 66);
+const value33925 = compute(value, 72);
+const v = process.env["BENCH_KEY_00372"];
+const value87405 = compute(value, 8);
+const value81795 = compute(value, 24);
+const value62426 = compute(value, 55);
+const value16856 = compute(value, 75);
+const value36672 = compute(value, 6);
+const value23191 = compute(value, 8);
+// note 67989: keep this in sync with the handler
+const value33332 = compute(value, 61);
+const value98393 = compute(value, 35);
+const value90496 = compute(value, 92);
+const value70812 = compute(value, 2);
+const value46634 = compute(value, 74);
+const v = import.meta.env.BENCH_KEY_01042;
+const value13793 = compute(value, 19);
+const value42552 = compute(value, 66);
+const value96488 = compute(value, 70);
+const value89433 = compute(value, 96);
+const value10425 = compute(value, 46);
+const value61494 = compute(value, 93);
+const value84349 = compute(value, 56);
+const value13566 = compute(value, 83);
+const value896 = compute(value, 23);
+const value77127 = compute(value, 12);
+const value31004 = compute(value, 61);
+const value53915 = compute(value, 80);
+const value70176 = compute(value, 45);
+const value38618 = compute(value, 12);
+// note 29495: keep this in sync with the handler
+const value5915 = compute(value, 95);
+const value45429 = compute(value, 33);
+const v = process.env.BENCH_KEY_01800;
+const value52914 = compute(value, 49);
+const value77279 = compute(value, 67);
+const value96852 = compute(value, 46);
+const value6082 = compute(value, 68);
+const value38099 = compute(value, 75);
+const value18112 = compute(value, 70);
+const value42198 = compute(value, 3);
+// note 41418: keep this in sync with the handler
+const value70948 = compute(value, 41);
+const v = process.env["BENCH_KEY_01093"];
+const value84115 = compute(value, 16);
+const value78122 = compute(value, 37);
+const value73822 = compute(value, 5);
+// note 31074: keep this in sync with the handler
+const value63078 = compute(value, 28);
+const value46578 = compute(value, 18);
+const value50472 = compute(value, 32);
+const value10926 = compute(value, 62);
+const value43845 = compute(value, 1);
+const value67340 = compute(value, 22);
+// note 72154: keep this in sync with the handler
+const value72677 = compute(value, 24);
+const value66591 = compute(value, 49);
+const value61408 = compute(value, 7);
+// note 86304: keep this in sync with the handler
+const value84666 = compute(value, 82);
+const value36540 = compute(value, 68);
+const value86928 = compute(value, 16);
+const v = import.meta.env.BENCH_KEY_00478;
+const value65075 = compute(value, 85);
+const value5920 = compute(value, 3);
+const value2667 = compute(value, 48);
+const value17784 = compute(value, 33);
+const value77371 = compute(value, 62);
+const value52141 = compute(value, 52);
+const value85607 = compute(value, 53);
+const value17381 = compute(value, 18);
+const value48425 = compute(value, 22);
+const v = import.meta.env.BENCH_KEY_01084;
+const value87654 = compute(value, 63);
+const value56269 = compute(value, 9);
+const value38501 = compute(value, 89);
+// note 15558: keep this in sync with the handler
+const value33151 = compute(value, 74);
+const value60281 = compute(value, 44);
+// note 18372: keep this in sync with the handler
+const v = process.env["BENCH_KEY_00058"];
+const value55862 = compute(value, 87);
+const value15338 = compute(value, 12);
+const value88935 = compute(value, 83);
+const value47738 = compute(value, 14);
+const value50122 = compute(value, 70);
+const value53042 = compute(value, 80);
+const value2775 = compute(value, 59);
+const value6003 = compute(value, 86);
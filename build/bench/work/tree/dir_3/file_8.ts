@@ -0,0 +1,202 @@
+const value10715 = compute(value, 45);
+const value90961 = compute(value, 72);
+// note 10508: keep this in sync with the handler
+const value12611 = compute(value, 1);
+// note 47951: keep this in sync with the handler
+const value22272 = compute(value, 59);
+const v = process.env["BENCH_KEY_01262"];
+const value79197 = compute(value, 45);
+const value94494 = compute(value, 16);
+// note 31680: keep this in sync with the handler
+const value5690 = compute(value, 64);
+// note 20743: keep this in sync with the handler
+const value27729 = compute(value, 84);
+const value7071 = compute(value, 87);
+const value53242 = compute(value, 86);
+const value65266 = compute(value, 82);
+const value97850 = compute(value, 74);
+const value28417 = compute(value, 93);
+const value84753 = compute(value, 72);
+const value76367 = compute(value, 28);
+const v = process.env["BENCH_KEY_00466"];
+const value46884 = compute(value, 33);
+const value67917 = compute(value, 17);
+const value77461 = compute(value, 55);
+const value84281 = compute(value, 85);
+const value56301 = compute(value, 41);
+const value56196 = compute(value, 33);
+const value36674 = compute(value, 8);
+const value54265 = compute(value, 42);
+// note 33634: keep this in sync with the handler
+const v = import.meta.env.BENCH_KEY_01969;
+const value17902 = compute(value, 54);
+const value95781 = compute(value, 42);
+const value28680 = compute(value, 65);
+const value21867 = compute(value, 42);
+const value34816 = compute(value, 90);
+const value66273 = compute(value, 22);
+const value7575 = compute(value, 9);
+const value90494 = compute(value, 90);
+const value80258 = compute(value, 39);
+const value81391 = compute(value, 8);
+const value9654 = compute(value, 51);
+const v = process.env.BENCH_KEY_01730;
+const value45180 = compute(value, 75);
+const value31821 = compute(value, 5);
+const value62809 = compute(value, 50);
+const value2136 = compute(value, 2);
+const value96773 = compute(value, 64);
+const value85532 = compute(value, 75);
+const value32932 = compute(value, 49);
+const value65701 = compute(value, 32);
+const value17937 = compute(value, 89);
+const value3596 = compute(value, 7);
+// note 52941: keep this in sync with the handler
+// note 46657: keep this in sync with the handler
+const value8101 = compute(value, 50);
+const v = import.meta.env.BENCH_KEY_01044;
+// note 46990: keep this in sync with the handler
+const value101 = compute(value, 4);
+const value72723 = compute(value, 70);
+// note 66754: keep this in sync with the handler
+const value90014 = compute(value, 95);
+const value53659 = compute(value, 18);
+const value82402 = compute(value, 49);
+// note 18406: keep this in sync with the handler
+const value52894 = compute(value, 29);
+const v = import.meta.env.BENCH_KEY_01396;
+const value17146 = compute(value, 74);
+const value38277 = compute(value, 59);
+const value99601 = compute(value, 79);
+const value25253 = compute(value, 33);
+const value80971 = compute(value, 73);
+// note 15021: keep this in sync with the handler
+const value72352 = compute(value, 87);
+const value46441 = compute(value, 75);
+const value48992 = compute(value, 7);
+const value39688 = compute(value, 15);
+const value20792 = compute(value, 34);
+const value5368 = compute(value, 33);
+const value94474 = compute(value, 93);
+const value14891 = compute(value, 50);
+// note 74656: keep this in sync with the handler
+const value53694 = compute(value, 53);
+const v = process.env.BENCH_KEY_01169;
+// note 1363: keep this in sync with the handler
+const value83651 = compute(value, 37);
+// note 13206: keep this in sync with the handler
+const value96524 = compute(value, 9);
+const value13716 = compute(value, 39);
+const value74837 = compute(value, 50);
+const value45982 = compute(value, 4);
+const value79351 = compute(value, 5);
+// note 35743: keep this in sync with the handler
+const value65864 = compute(value, 1);
+const v = process.env.BENCH_KEY_01327;
+const value7249 = compute(value, 71);
+const value21581 = compute(value, 47);
+const value4763 = compute(value, 10);
+const value76252 = compute(value, 10);
+const value84221 = compute(value, 25);
+const value22334 = compute(value, 24);
+// note 34477: keep this in sync with the handler
+const value42840 = compute(value, 63);
+const v = process.env.BENCH_KEY_00491;
+const value21470 = compute(value, 33);
+// note 7545: keep this in sync with the handler
+const value77511 = compute(value, 8);
+const value87364 = compute(value, 64);
+// note 61990: keep this in sync with the handler
+const value83249 = compute(value, 23);
+const value99065 = compute(value, 28);
+const value10825 = compute(value, 58);
+// note 15818: keep this in sync with the handler
+const value57648 = compute(value, 30);
+// note 18774: keep this in sync with the handler
+// note 72640: keep this in sync with the handler
+const value14391 = compute(value, 35);
+const value36130 = compute(value, 46);
+const value36431 = compute(value, 56);
+const v = process.env.BENCH_KEY_00688;
+const value76773 = compute(value, 46);
+const value89718 = compute(value, 90);
+const value88725 = compute(value, 67);
+const value378 = compute(value, 87);
+const value28956 = compute(value, 50);
+const value59490 = compute(value, 29);
+const value16062 = compute(value, 57);
+// note 14367: keep this in sync with the handler
+const value58585 = compute(value, 94);
+const value40699 = compute(value, 56);
+const value74411 = compute(value, 12);
+const value55854 = compute(value, 79);
+const value44739 = compute(value, 22);
+const value23493 = compute(value, 19);
+const value99249 = compute(value, 18);
+const v = process.env.BENCH_KEY_00735;
+const value78722 = compute(value, 55);
+const value87340 = compute(value, 40);
+const value45919 = compute(value, 38);
+// note 19263: keep this in sync with the handler
+const value91810 = compute(value, 48);
+// note 88203: keep this in sync with the handler
+const value55998 = compute(value, 29);
+const value23303 = compute(value, 23);
+const value60200 = compute(value, 60);
+const value14739 = compute(value, 92);
+const value75976 = compute(value, 25);
+const value50075 = compute(value, 23);
+const value98369 = compute(value, 11);
+const value21877 = compute(value, 52);
+const value1139 = compute(value, 72);
+const value38510 = compute(value, 1);
+const value38271 = compute(value, 53);
+const v = process.env.BENCH_KEY_01687;
+const value59242 = compute(value, 72);
+const value34355 = compute(value, 17);
+const value50874 = compute(value, 46);
+const value20240 = compute(value, 64);
+const value81039 = compute(value, 44);
+const value74939 = compute(value, 55);
+const value70916 = compute(value, 9);
+// note 27305: keep this in sync with the handler
+const value53943 = compute(value, 11);
+const value81011 = compute(value, 16);
+const value55270 = compute(value, 77);
+const value39783 = compute(value, 13);
+const v = import.meta.env.BENCH_KEY_00045;
+const value23829 = compute(value, 64);
+// note 40461: keep this in sync with the handler
+// note 64123: keep this in sync with the handler
+const value16041 = compute(value, 36);
+const value10597 = compute(value, 24);
+const value72880 = compute(value, 33);
+const value98245 = compute(value, 81);
+const value80000 = compute(value, 72);
+const value63627 = compute(value, 92);
+const value84134 = compute(value, 35);
+const v = process.env.BENCH_KEY_00390;
+// note 35748: keep this in sync with the handler
+const value84408 = compute(value, 18);
+const value49987 = compute(value, 32);
+const value38912 = compute(value, 15);
+const value67239 = compute(value, 18);
+const value79839 = compute(value, 8);
+const value69015 = compute(value, 48);
+const value68057 = compute(value, 60);
+const value31592 = compute(value, 67);
+const value49113 = compute(value, 31);
+const value89027 = compute(value, 78);
+const value2851 = compute(value, 38);
+// note 43867: keep this in sync with the handler
+const v = import.meta.env.BENCH_KEY_01157;
+const value77971 = compute(value, 80);
+const value23617 = compute(value, 46);
+const value48011 = compute(value, 93);
+// note 20397: keep this in sync with the handler
+const value33705 = compute(value, 46);
+const value18838 = compute(value, 20);
+const value40424 = compute(value, 72);
+const value16147 = compute(value, 45);
+const value97509 = compute(value, 24);
+// note 96575: keep this in sync with the handler
@@ -0,0 +1,203 @@
+const value82941 = compute(value, 6);
+const value13759 = compute(value, 82);
+const value51520 = compute(value, 13);
+const value48137 = compute(value, 25);
+const value41747 = compute(value, 37);
+const value88768 = compute(value, 13);
+const value73594 = compute(value, 68);
+const value92549 = compute(value, 11);
+const v = process.env["BENCH_KEY_00421"];
+const value72694 = compute(value, 41);
+const value28269 = compute(value, 42);
+const value88384 = compute(value, 17);
+const value48385 = compute(value, 79);
+// note 92046: keep this in sync with the handler
+// note 87452: keep this in sync with the handler
+const value96625 = compute(value, 13);
+const v = import.meta.env.BENCH_KEY_01888;
+// note 525: keep this in sync with the handler
+const value74374 = compute(value, 72);
+const value38165 = compute(value, 44);
+const value32737 = compute(value, 48);
+// note 38128: keep this in sync with the handler
+const value98305 = compute(value, 44);
+const value33767 = compute(value, 11);
+const value73681 = compute(value, 58);
+// note 38309: keep this in sync with the handler
+// note 33318: keep this in sync with the handler
+const v = process.env.BENCH_KEY_00104;
+// note 27401: keep this in sync with the handler
+const value41891 = compute(value, 84);
+const value95992 = compute(value, 59);
+const value68052 = compute(value, 55);
+const value52175 = compute(value, 86);
+const value1911 = compute(value, 68);
+const value4483 = compute(value, 21);
+const value27457 = compute(value, 6);
+const v = process.env["BENCH_KEY_00184"];
+const value56312 = compute(value, 52);
+const value92570 = compute(value, 32);
+const value62441 = compute(value, 70);
+const value83565 = compute(value, 48);
+const value9702 = compute(value, 2);
+const value75913 = compute(value, 59);
+const value6864 = compute(value, 74);
+const value53778 = compute(value, 40);
+const value37088 = compute(value, 34);
+const value15303 = compute(value, 74);
+const value16638 = compute(value, 51);
+const value97290 = compute(value, 96);
+// note 60711: keep this in sync with the handler
+// note 20573: keep this in sync with the handler
+// note 26661: keep this in sync with the handler
+const v = process.env.BENCH_KEY_01116;
+const value83441 = compute(value, 21);
+const value92359 = compute(value, 15);
+const value5862 = compute(value, 42);
+const value77707 = compute(value, 10);
+const value72933 = compute(value, 86);
+const value33769 = compute(value, 13);
+const value70772 = compute(value, 59);
+const value10642 = compute(value, 69);
+const value51828 = compute(value, 30);
+const value34977 = compute(value, 57);
+const value49357 = compute(value, 81);
+const value67389 = compute(value, 71);
+const value881 = compute(value, 8);
+const value14783 = compute(value, 39);
+// note 87130: keep this in sync with the handler
+const v = process.env["BENCH_KEY_01304"];
+const value95312 = compute(value, 58);
+const value3390 = compute(value, 92);
+const value72799 = compute(value, 49);
+const value96817 = compute(value, 11);
+// note 96864: keep this in sync with the handler
+const value57097 = compute(value, 61);
+const value54322 = compute(value, 2);
+const value31351 = compute(value, 20);
+const v = process.env.BENCH_KEY_00418;
+const value25632 = compute(value, 24);
+const value71161 = compute(value, 60);
+const value33207 = compute(value, 33);
+const value45142 = compute(value, 37);
+// note 89625: keep this in sync with the handler
+const value64863 = compute(value, 67);
+const value84342 = compute(value, 49);
+const value284 = compute(value, 90);
+// note 44379: keep this in sync with the handler
+// note 26898: keep this in sync with the handler
+const value99153 = compute(value, 19);
+const v = process.env.BENCH_KEY_00253;
+const value35985 = compute(value, 95);
+const value11081 = compute(value, 23);
+const value84207 = compute(value, 11);
+const value34703 = compute(value, 74);
+const value12933 = compute(value, 32);
+const value44378 = compute(value, 49);
+const value50602 = compute(value, 65);
+// note 32350: keep this in sync with the handler
+const value89816 = compute(value, 91);
+const value26420 = compute(value, 36);
+const value54383 = compute(value, 63);
+const value38779 = compute(value, 76);
+const value91359 = compute(value, 82);
+const value77009 = compute(value, 88);
+const value19703 = compute(value, 12);
+const v = import.meta.env.BENCH_KEY_01874;
+// note 88867: keep this in sync with the handler
+const value17754 = compute(value, 3);
+const value86984 = compute(value, 72);
+const value48096 = compute(value, 81);
+const value94751 = compute(value, 79);
+// note 66756: keep this in sync with the handler
+const value56487 = compute(value, 33);
+const value26935 = compute(value, 66);
+// note 71506: keep this in sync with the handler
+const value62161 = compute(value, 81);
+const value31901 = compute(value, 85);
+// note 12551: keep this in sync with the handler
+const value58404 = compute(value, 10);
+const value62924 = compute(value, 68);
+const value3945 = compute(value, 65);
+const value21152 = compute(value, 6);
+const value5398 = compute(value, 63);
+const v = process.env.BENCH_KEY_00343;
+const value10039 = compute(value, 48);
+const value785 = compute(value, 9);
+const value81221 = compute(value, 32);
+const value94226 = compute(value, 39);
+const value55173 = compute(value, 77);
+const value23858 = compute(value, 93);
+// note 22959: keep this in sync with the handler
+// note 4202: keep this in sync with the handler
+const value93330 = compute(value, 16);
+// note 81533: keep this in sync with the handler
+const value49763 = compute(value, 2);
+const value71169 = compute(value, 68);
+const value39093 = compute(value, 2);
+const value54932 = compute(value, 30);
+const value7774 = compute(value, 14);
+const value68596 = compute(value, 17);
+const value9934 = compute(value, 40);
+const v = process.env.BENCH_KEY_01321;
+// note 95922: keep this in sync with the handler
+const value5693 = compute(value, 67);
+const value48985 = compute(value, 0);
+const value22099 = compute(value, 80);
+const value12762 = compute(value, 55);
+const value71653 = compute(value, 67);
+const value87956 = compute(value, 74);
+const value50623 = compute(value, 86);
+const value92231 = compute(value, 81);
+const value93815 = compute(value, 16);
+const value40287 = compute(value, 32);
+const value67788 = compute(value, 82);
+const value47087 = compute(value, 42);
+const value30226 = compute(value, 59);
+const value90148 = compute(value, 35);
+const value37693 = compute(value, 57);
+const value27759 = compute(value, 17);
+const value57292 = compute(value, 62);
+const value6351 = compute(value, 46);
+const value57003 = compute(value, 64);
+const v = process.env["BENCH_KEY_00812"];
+const value56375 = compute(value, 18);
+const value41720 = compute(value, 10);
+const value12782 = compute(value, 75);
+const value31826 = compute(value, 10);
+const value68884 = compute(value, 14);
+const value10742 = compute(value, 72);
+const value62043 = compute(value, 60);
+const value39487 = compute(value, 8);
+// note 71996: keep this in sync with the handler
+// note 60024: keep this in sync with the handler
+const value53054 = compute(value, 92);
+// note 30354: keep this in sync with the handler
+const v = import.meta.env.BENCH_KEY_00324;
+const value95295 = compute(value, 41);
+const value46733 = compute(value, 76);
+const value97984 = compute(value, 14);
+const value70705 = compute(value, 89);
+const value29468 = compute(value, 77);
+const value4727 = compute(value, 71);
+const value39355 = compute(value, 70);
+const value10306 = compute(value, 24);
+const value82313 = compute(value, 57);
+const value14482 = compute(value, 29);
+// note 47658: keep this in sync with the handler
+const value89091 = compute(value, 45);
+const value80902 = compute(value, 4);
+const value56174 = compute(value, 11);
+const value57423 = compute(value, 96);
+const value44651 = compute(value, 31);
+const value72445 = compute(value, 83);
+const value89759 = compute(value, 34);
+const value76963 = compute(value, 42);
+const v = process.env.BENCH_KEY_00151;
+const value88225 = compute(value, 52);
+const value22238 = compute(value, 25);
+const value41036 = compute(value, 5);
+const value32583 = compute(value, 88);
+const value18755 = compute(value, 34);
+const value61981 = compute(value, 95);
+const value82079 = compute(value, 17);
@@ -0,0 +1,204 @@
+// note 37013: keep this in sync with the handler
+const value8947 = compute(value, 23);
+const v = process.env.BENCH_KEY_01271;
+const value18377 = compute(value, 44);
+// note 96568: keep this in sync with the handler
+const value48306 = compute(value, 0);
+const value60659 = compute(value, 34);
+// note 63609: keep this in sync with the handler
+const value93469 = compute(value, 58);
+const value3947 = compute(value, 67);
+// note 11056: keep this in sync with the handler
+const value293 = compute(value, 2);
+const value64432 = compute(value, 24);
+const value16603 = compute(value, 16);
+const value28424 = compute(value, 3);
+const value34510 = compute(value, 75);
+const value22307 = compute(value, 94);
+const value93719 = compute(value, 17);
+const value99652 = compute(value, 33);
+const value29920 = compute(value, 44);
+const v = process.env.BENCH_KEY_01667;
+const value27994 = compute(value, 58);
+const value67488 = compute(value, 73);
+const value4258 = compute(value, 87);
+const value56002 = compute(value, 33);
+const value92532 = compute(value, 91);
+const value84824 = compute(value, 46);
+// note 60606: keep this in sync with the handler
+const value57436 = compute(value, 12);
+const value70538 = compute(value, 19);
+// note 79806: keep this in sync with the handler
+const v = import.meta.env.BENCH_KEY_00041;
+const value45667 = compute(value, 77);
+const value5359 = compute(value, 24);
+// note 77957: keep this in sync with the handler
+// note 50661: keep this in sync with the handler
+const value64676 = compute(value, 74);
+const value17517 = compute(value, 57);
+const value43544 = compute(value, 88);
+// note 28497: keep this in sync with the handler
+const value78985 = compute(value, 27);
+const value449 = compute(value, 61);
+const value10724 = compute(value, 54);
+// note 69136: keep this in sync with the handler
+const value94044 = compute(value, 51);
+const v = process.env["BENCH_KEY_01732"];
+const value4720 = compute(value, 64);
+const value38914 = compute(value, 17);
+const value78193 = compute(value, 11);
+const value67103 = compute(value, 76);
+const value99040 = compute(value, 3);
+const value53496 = compute(value, 49);
+const value50485 = compute(value, 45);
+const value23091 = compute(value, 5);
+const value23203 = compute(value, 20);
+// note 23984: keep this in sync with the handler
+const value82689 = compute(value, 45);
+const value5319 = compute(value, 81);
+const value83403 = compute(value, 80);
+const v = process.env["BENCH_KEY_00303"];
+const value36191 = compute(value, 10);
+const value29455 = compute(value, 64);
+const value81945 = compute(value, 77);
+const value11319 = compute(value, 67);
+const value90875 = compute(value, 83);
+const value62633 = compute(value, 68);
+const value20499 = compute(value, 32);
+const value71192 = compute(value, 91);
+// note 1172: keep this in sync with the handler
+const value27460 = compute(value, 9);
+// note 74273: keep this in sync with the handler
+const value26566 = compute(value, 85);
+const value62262 = compute(value, 85);
+const value45127 = compute(value, 22);
+const value98793 = compute(value, 47);
+const value72727 = compute(value, 74);
+// note 89722: keep this in sync with the handler
+const value98693 = compute(value, 44);
+const v = import.meta.env.BENCH_KEY_00344;
+const value3266 = compute(value, 65);
+const value59206 = compute(value, 36);
+const value17230 = compute(value, 61);
+const value7766 = compute(value, 6);
+const value69117 = compute(value, 53);
+const value47183 = compute(value, 41);
+const value78378 = compute(value, 2);
+// note 30049: keep this in sync with the handler
+const value8637 = compute(value, 4);
+const value59394 = compute(value, 30);
+const value67054 = compute(value, 27);
+const value72148 = compute(value, 77);
+// note 83668: keep this in sync with the handler
+const value59268 = compute(value, 1);
+const value20934 = compute(value, 79);
+const value56910 = compute(value, 68);
+const v = import.meta.env.BENCH_KEY_01149;
+const value62897 = compute(value, 41);
+const value65795 = compute(value, 29);
+const value35255 = compute(value, 44);
+// note 2885: keep this in sync with the handler
+const value8128 = compute(value, 77);
+const value12118 = compute(value, 90);
+const value32689 = compute(value, 0);
+const value97959 = compute(value, 86);
+const v = import.meta.env.BENCH_KEY_01417;
+const value45634 = compute(value, 44);
+const value21483 = compute(value, 46);
+// note 17634: keep this in sync with the handler
+const value16518 = compute(value, 28);
+const value3785 = compute(value, 2);
+const value84486 = compute(value, 96);
+const value13429 = compute(value, 43);
+const value55041 = compute(value, 42);
+const value46040 = compute(value, 62);
+const value72124 = compute(value, 53);
+const value44675 = compute(value, 55);
+const value77866 = compute(value, 72);
+const value46601 = compute(value, 41);
+const value51603 = compute(value, 96);
+const value95514 = compute(value, 66);
+const v = process.env["BENCH_KEY_01837"];
+const value23662 = compute(value, 91);
+// note 25185: keep this in sync with the handler
+const value55551 = compute(value, 67);
+const value53203 = compute(value, 47);
+const value80181 = compute(value, 59);
+const value33394 = compute(value, 26);
+const value54210 = compute(value, 84);
+const value95400 = compute(value, 49);
+const value16555 = compute(value, 65);
+const value80508 = compute(value, 95);
+const value57756 = compute(value, 41);
+const value84929 = compute(value, 54);
+const value29497 = compute(value, 9);
+const value34080 = compute(value, 33);
+const value99159 = compute(value, 25);
+// note 21046: keep this in sync with the handler
+const v = import.meta.env.BENCH_KEY_00857;
+const value46239 = compute(value, 67);
+const value70120 = compute(value, 86);
+const value95761 = compute(value, 22);
+const value71045 = compute(value, 41);
+// note 8697: keep this in sync with the handler
+const value72197 = compute(value, 29);
+const value72545 = compute(value, 86);
+const value30248 = compute(value, 81);
+const value46652 = compute(value, 92);
+const value98524 = compute(value, 69);
+const value24740 = compute(value, 5);
+const value61069 = compute(value, 56);
+const value46031 = compute(value, 53);
+const value66241 = compute(value, 87);
+const value47429 = compute(value, 93);
+const value42596 = compute(value, 13);
+const value76284 = compute(value, 42);
+const value2691 = compute(value, 72);
+const value65887 = compute(value, 24);
+const v = process.env["BENCH_KEY_01676"];
+const value40416 = compute(value, 64);
+const value16616 = compute(value, 29);
+const value91028 = compute(value, 42);
+const value78720 = compute(value, 53);
+const value47107 = compute(value, 62);
+// note 612: keep this in sync with the handler
+const value61443 = compute(value, 42);
+const value51409 = compute(value, 96);
+const value23795 = compute(value, 30);
+const value3088 = compute(value, 81);
+const value62479 = compute(value, 11);
+const value65497 = compute(value, 22);
+const v = process.env["BENCH_KEY_00331"];
+const value87644 = compute(value, 53);
+const value85480 = compute(value, 23);
+// note 51109: keep this in sync with the handler
+const value42172 = compute(value, 74);
+const value6998 = compute(value, 14);
+const value90973 = compute(value, 84);
+const value53381 = compute(value, 31);
+const value66712 = compute(value, 73);
+const value726 = compute(value, 47);
+const value16315 = compute(value, 19);
+const value41159 = compute(value, 31);
+const value99790 = compute(value, 74);
+// note 4381: keep this in sync with the handler
+const value89365 = compute(value, 28);
+const value53862 = compute(value, 27);
+const value7521 = compute(value, 52);
+const v = import.meta.env.BENCH_KEY_01160;
+const value73944 = compute(value, 30);
+const value47929 = compute(value, 11);
+const value88428 = compute(value, 61);
+const value36590 = compute(value, 21);
+const value37528 = compute(value, 86);
+const value80321 = compute(value, 5);
+const value27718 = compute(value, 73);
+const value80982 = compute(value, 84);
+const value81722 = compute(value, 48);
+const value15032 = compute(value, 94);
+const value36846 = compute(value, 83);
+const value80069 = compute(value, 44);
+const value16557 = compute(value, 67);
+// note 90725: keep this in sync with the handler
+const value47621 = compute(value, 91);
+const v = process.env["BENCH_KEY_01507"];
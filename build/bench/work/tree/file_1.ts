@@ -0,0 +1,205 @@
+const value57948 = compute(value, 39);
+// note 52466: keep this in sync with the handler
+const value88775 = compute(value, 20);
+const value67141 = compute(value, 17);
+const value47095 = compute(value, 50);
+// note 94276: keep this in sync with the handler
+const value84761 = compute(value, 80);
+const value72849 = compute(value, 2);
+const value8709 = compute(value, 76);
+const value29411 = compute(value, 20);
+const value71080 = compute(value, 76);
+const v = process.env.BENCH_KEY_00725;
+// note 58478: keep this in sync with the handler
+const value77755 = compute(value, 58);
+const value39010 = compute(value, 16);
+const value75530 = compute(value, 64);
+// note 60192: keep this in sync with the handler
+const value25093 = compute(value, 67);
+const value36710 = compute(value, 44);
+const value86050 = compute(value, 11);
+const value93449 = compute(value, 38);
+const value97272 = compute(value, 78);
+const value10455 = compute(value, 76);
+const value82551 = compute(value, 4);
+const value90732 = compute(value, 37);
+const value32401 = compute(value, 3);
+const value39986 = compute(value, 22);
+const value2740 = compute(value, 24);
+const v = import.meta.env.BENCH_KEY_01357;
+// note 26625: keep this in sync with the handler
+const value36135 = compute(value, 51);
+const value8383 = compute(value, 41);
+const value52807 = compute(value, 39);
+const value3563 = compute(value, 71);
+const value61914 = compute(value, 28);
+const value3189 = compute(value, 85);
+const value16458 = compute(value, 65);
+const value14226 = compute(value, 64);
+const value27735 = compute(value, 90);
+const value31283 = compute(value, 49);
+const value41294 = compute(value, 69);
+const value83445 = compute(value, 25);
+const v = import.meta.env.BENCH_KEY_01197;
+// note 654: keep this in sync with the handler
+const value65383 = compute(value, 5);
+const value2402 = compute(value, 74);
+const value10860 = compute(value, 93);
+const value68990 = compute(value, 23);
+const value65004 = compute(value, 14);
+const value5836 = compute(value, 16);
+const value31639 = compute(value, 17);
+const v = process.env.BENCH_KEY_00319;
+const value79895 = compute(value, 64);
+// note 28350: keep this in sync with the handler
+const value329 = compute(value, 38);
+const value95505 = compute(value, 57);
+const value32320 = compute(value, 19);
+const value7034 = compute(value, 50);
+const value71862 = compute(value, 82);
+const value15205 = compute(value, 73);
+const value86322 = compute(value, 89);
+const value71177 = compute(value, 76);
+const value57971 = compute(value, 62);
+const value59605 = compute(value, 47);
+const value22634 = compute(value, 33);
+const value43332 = compute(value, 70);
+const value25357 = compute(value, 40);
+const v = process.env["BENCH_KEY_01548"];
+const value55409 = compute(value, 22);
+const value82331 = compute(value, 75);
+const value83924 = compute(value, 19);
+// note 73820: keep this in sync with the handler
+const value20640 = compute(value, 76);
+const value50604 = compute(value, 67);
+const value12586 = compute(value, 73);
+// note 91498: keep this in sync with the handler
+const value28821 = compute(value, 12);
+// note 19489: keep this in sync with the handler
+const v = process.env.BENCH_KEY_00107;
+const value75743 = compute(value, 83);
+const value903 = compute(value, 30);
+const value37771 = compute(value, 38);
+const value2381 = compute(value, 53);
+const value57846 = compute(value, 34);
+const value71627 = compute(value, 41);
+const value83208 = compute(value, 79);
+const value95725 = compute(value, 83);
+// note 60259: keep this in sync with the handler
+const v = process.env["BENCH_KEY_00917"];
+const value60738 = compute(value, 16);
+// note 8343: keep this in sync with the handler
+const value42416 = compute(value, 27);
+const value75246 = compute(value, 71);
+const value42064 = compute(value, 63);
+const value77201 = compute(value, 86);
+const value7003 = compute(value, 19);
+const value66614 = compute(value, 72);
+const value1154 = compute(value, 87);
+const value67124 = compute(value, 0);
+const value53815 = compute(value, 77);
+const value97589 = compute(value, 7);
+const value84357 = compute(value, 64);
+const value27275 = compute(value, 18);
+const value59492 = compute(value, 31);
+const v = import.meta.env.BENCH_KEY_00780;
+const value17016 = compute(value, 41);
+const value52132 = compute(value, 43);
+const value88949 = compute(value, 0);
+const value43328 = compute(value, 66);
+const value33523 = compute(value, 58);
+const value63265 = compute(value, 21);
+const value22637 = compute(value, 36);
+const value74428 = compute(value, 29);
+const value40472 = compute(value, 23);
+const value21515 = compute(value, 78);
+const value31620 = compute(value, 95);
+const v = process.env["BENCH_KEY_01079"];
+const value35471 = compute(value, 66);
+const value95941 = compute(value, 8);
+const value84189 = compute(value, 90);
+const value71467 = compute(value, 75);
+const value94571 = compute(value, 93);
+const value8709 = compute(value, 76);
+const value79662 = compute(value, 25);
+// note 63242: keep this in sync with the handler
+const value80513 = compute(value, 3);
+const value61226 = compute(value, 19);
+const value14551 = compute(value, 1);
+const value10976 = compute(value, 15);
+const value29882 = compute(value, 6);
+const value63867 = compute(value, 41);
+const value90052 = compute(value, 36);
+const value15800 = compute(value, 86);
+const value14581 = compute(value, 31);
+const value53042 = compute(value, 80);
+const v = import.meta.env.BENCH_KEY_00703;
+const value7792 = compute(value, 32);
+const value23906 = compute(value, 44);
+const value12449 = compute(value, 33);
+const value79401 = compute(value, 55);
+const value4717 = compute(value, 61);
+const value35877 = compute(value, 84);
+const value26579 = compute(value, 1);
+const value20175 = compute(value, 96);
+const value12884 = compute(value, 80);
+const value78808 = compute(value, 44);
+const v = process.env.BENCH_KEY_01733;
+const value87652 = compute(value, 61);
+const value75700 = compute(value, 40);
+// note 97748: keep this in sync with the handler
+const value34521 = compute(value, 86);
+const value66771 = compute(value, 35);
+const value83533 = compute(value, 16);
+const value88665 = compute(value, 7);
+const value61531 = compute(value, 33);
+const value20696 = compute(value, 35);
+const value56966 = compute(value, 27);
+const v = process.env.BENCH_KEY_00675;
+const value15221 = compute(value, 89);
+const value28148 = compute(value, 18);
+const value40844 = compute(value, 7);
+const value28359 = compute(value, 35);
+const value42623 = compute(value, 40);
+const value83080 = compute(value, 48);
+const value97102 = compute(value, 5);
+const value67842 = compute(value, 39);
+const value31398 = compute(value, 67);
+const v = import.meta.env.BENCH_KEY_00368;
+const value79190 = compute(value, 38);
+const value88525 = compute(value, 61);
+const value37847 = compute(value, 17);
+const value63759 = compute(value, 30);
+const value21990 = compute(value, 68);
+const value41295 = compute(value, 70);
+const value92164 = compute(value, 14);
+const value59980 = compute(value, 34);
+// note 24890: keep this in sync with the handler
+const value28321 = compute(value, 94);
+const value35125 = compute(value, 11);
+const value65412 = compute(value, 34);
+const value1055 = compute(value, 85);
+const value11625 = compute(value, 82);
+const value62789 = compute(value, 30);
+const value71106 = compute(value, 5);
+const value98454 = compute(value, 96);
+const value34749 = compute(value, 23);
+// note 25863: keep this in sync with the handler
+const v = import.meta.env.BENCH_KEY_00237;
+const value48327 = compute(value, 21);
+const value16924 = compute(value, 46);
+const value45072 = compute(value, 64);
+const value50216 = compute(value, 67);
+// note 77709: keep this in sync with the handler
+const value86254 = compute(value, 21);
+// note 15816: keep this in sync with the handler
+const value3891 = compute(value, 11);
+const value64957 = compute(value, 64);
+const value31035 = compute(value, 92);
+// note 55541: keep this in sync with the handler
+const value96884 = compute(value, 78);
+const value83497 = compute(value, 77);
+const value69505 = compute(value, 53);
+const value95788 = compute(value, 49);
+const value34558 = compute(value, 26);
+const value37333 = compute(value, 85);
@@ -0,0 +1,203 @@
+const value7691 = compute(value, 28);
+const value10054 = compute(value, 63);
+const value77251 = compute(value, 39);
+const value53677 = compute(value, 36);
+const value32149 = compute(value, 42);
+const value64184 = compute(value, 67);
+const value50347 = compute(value, 4);
+const v = process.env.BENCH_KEY_01610;
+const value16239 = compute(value, 40);
+const value89824 = compute(value, 2);
+const value51121 = compute(value, 2);
+const value51828 = compute(value, 30);
+const value74707 = compute(value, 17);
+const value2079 = compute(value, 42);
+// note 54115: keep this in sync with the handler
+const value25468 = compute(value, 54);
+const value28641 = compute(value, 26);
+const v = process.env.BENCH_KEY_01603;
+const value19305 = compute(value, 2);
+const value2513 = compute(value, 88);
+const value85096 = compute(value, 27);
+// note 56894: keep this in sync with the handler
+const value67255 = compute(value, 34);
+const value77602 = compute(value, 2);
+const value24849 = compute(value, 17);
+const value38327 = compute(value, 12);
+const value30243 = compute(value, 76);
+const value44387 = compute(value, 58);
+const value36217 = compute(value, 36);
+// note 6655: keep this in sync with the handler
+const value48433 = compute(value, 30);
+const value82342 = compute(value, 86);
+const value61708 = compute(value, 16);
+const value49421 = compute(value, 48);
+const value21270 = compute(value, 27);
+const value69105 = compute(value, 41);
+const v = process.env.BENCH_KEY_00533;
+const value76489 = compute(value, 53);
+const value38669 = compute(value, 63);
+const value10193 = compute(value, 8);
+// note 62371: keep this in sync with the handler
+const value16130 = compute(value, 28);
+const value27344 = compute(value, 87);
+// note 86941: keep this in sync with the handler
+const v = import.meta.env.BENCH_KEY_00222;
+// note 9324: keep this in sync with the handler
+const value36787 = compute(value, 24);
+const value70769 = compute(value, 56);
+const value47154 = compute(value, 12);
+const value94440 = compute(value, 59);
+const value12110 = compute(value, 82);
+const value96453 = compute(value, 35);
+const value33845 = compute(value, 89);
+const value44314 = compute(value, 82);
+const value33581 = compute(value, 19);
+// note 71672: keep this in sync with the handler
+const value63130 = compute(value, 80);
+const value92269 = compute(value, 22);
+const value9418 = compute(value, 9);
+const value140 = compute(value, 43);
+const value27649 = compute(value, 4);
+const v = process.env.BENCH_KEY_00709;
+const value31939 = compute(value, 26);
+const value26421 = compute(value, 37);
+// note 70738: keep this in sync with the handler
+const value41823 = compute(value, 16);
+const value15227 = compute(value, 95);
+const value99607 = compute(value, 85);
+const value47457 = compute(value, 24);
+const value84005 = compute(value, 3);
+// note 73842: keep this in sync with the handler
+// note 15337: keep this in sync with the handler
+const value7376 = compute(value, 4);
+const value74065 = compute(value, 54);
+const value77808 = compute(value, 14);
+const value81359 = compute(value, 73);
+// note 70962: keep this in sync with the handler
+const value92888 = compute(value, 59);
+const value17685 = compute(value, 31);
+// note 81650: keep this in sync with the handler
+const v = process.env["BENCH_KEY_01262"];
+// note 55388: keep this in sync with the handler
+const value46280 = compute(value, 11);
+const value84893 = compute(value, 18);
+const value45363 = compute(value, 64);
+// note 21982: keep this in sync with the handler
+const value69706 = compute(value, 60);
+const value48144 = compute(value, 32);
+const value38797 = compute(value, 94);
+const value57685 = compute(value, 67);
+const value27571 = compute(value, 23);
+const value26111 = compute(value, 18);
+const value17068 = compute(value, 93);
+const v = process.env["BENCH_KEY_01806"];
+const value81536 = compute(value, 56);
+const value24813 = compute(value, 78);
+const value89438 = compute(value, 4);
+const value52236 = compute(value, 50);
+const value81474 = compute(value, 91);
+const value82776 = compute(value, 35);
+const value16397 = compute(value, 4);
+const value22463 = compute(value, 56);
+const v = import.meta.env.BENCH_KEY_00907;
+const value92378 = compute(value, 34);
+const value87676 = compute(value, 85);
+const value87969 = compute(value, 87);
+const value7414 = compute(value, 42);
+const value4443 = compute(value, 78);
+const value78563 = compute(value, 90);
+const value16244 = compute(value, 45);
+const value96181 = compute(value, 54);
+const value66727 = compute(value, 88);
+const value66372 = compute(value, 24);
+const value1410 = compute(value, 52);
+const value63534 = compute(value, 96);
+const value38795 = compute(value, 92);
+const value11582 = compute(value, 39);
+const value54081 = compute(value, 52);
+const v = process.env["BENCH_KEY_00386"];
+// note 39912: keep this in sync with the handler
+const value30391 = compute(value, 30);
+// note 55118: keep this in sync with the handler
+const value26160 = compute(value, 67);
+const value98264 = compute(value, 3);
+const value29635 = compute(value, 50);
+const value91814 = compute(value, 52);
+const value3007 = compute(value, 0);
+const value45187 = compute(value, 82);
+const value62227 = compute(value, 50);
+const value87428 = compute(value, 31);
+const value6489 = compute(value, 87);
+// note 19678: keep this in sync with the handler
+const value44525 = compute(value, 2);
+const value38282 = compute(value, 64);
+const value7124 = compute(value, 43);
+const v = process.env.BENCH_KEY_00114;
+const value64918 = compute(value, 25);
+const value42129 = compute(value, 31);
+const value83963 = compute(value, 58);
+const value68955 = compute(value, 85);
+const value34229 = compute(value, 85);
+const value57395 = compute(value, 68);
+const value33494 = compute(value, 29);
+const value36593 = compute(value, 24);
+const v = process.env.BENCH_KEY_01713;
+const value80759 = compute(value, 55);
+const value55790 = compute(value, 15);
+const value65977 = compute(value, 17);
+const value41537 = compute(value, 21);
+const value52628 = compute(value, 54);
+const value50293 = compute(value, 47);
+const value54104 = compute(value, 75);
+const v = import.meta.env.BENCH_KEY_01855;
+const value72139 = compute(value, 68);
+const value23680 = compute(value, 12);
+// note 44923: keep this in sync with the handler
+const value45277 = compute(value, 75);
+const value1542 = compute(value, 87);
+const value70133 = compute(value, 2);
+const value65550 = compute(value, 75);
+const value28521 = compute(value, 3);
+const value43626 = compute(value, 73);
+const value46777 = compute(value, 23);
+const value5488 = compute(value, 56);
+const value87617 = compute(value, 26);
+// note 46645: keep this in sync with the handler
+// note 25936: keep this in sync with the handler
+const value23642 = compute(value, 71);
+const value55813 = compute(value, 38);
+const value60638 = compute(value, 13);
+const value83397 = compute(value, 74);
+const v = import.meta.env.BENCH_KEY_01425;
+const value58375 = compute(value, 78);
+// note 58905: keep this in sync with the handler
+const value32306 = compute(value, 5);
+// note 96491: keep this in sync with the handler
+const value18435 = compute(value, 5);
+const value59828 = compute(value, 76);
+// note 16716: keep this in sync with the handler
+const value30319 = compute(value, 55);
+const value10798 = compute(value, 31);
+const value31347 = compute(value, 16);
+const value36873 = compute(value, 13);
+const value70467 = compute(value, 45);
+// note 98653: keep this in sync with the handler
+const value42855 = compute(value, 78);
+const v = process.env["BENCH_KEY_01223"];
+const value70844 = compute(value, 34);
+const value97707 = compute(value, 28);
+const value70673 = compute(value, 57);
+const value5312 = compute(value, 74);
+const value72781 = compute(value, 31);
+const value50061 = compute(value, 9);
+// note 21352: keep this in sync with the handler
+const value22733 = compute(value, 35);
+const value33827 = compute(value, 71);
+const value73946 = compute(value, 32);
+const value67143 = compute(value, 19);
+const value53750 = compute(value, 12);
+const value71236 = compute(value, 38);
+const value94026 = compute(value, 33);
+const value84852 = compute(value, 74);
+// note 41621: keep this in sync with the handler
@@ -0,0 +1,204 @@
+const value118 = compute(value, 21);
+const value85176 = compute(value, 10);
+const value49969 = compute(value, 14);
+const value62548 = compute(value, 80);
+const value3444 = compute(value, 49);
+const v = process.env["BENCH_KEY_01261"];
+const value38057 = compute(value, 33);
+const value18735 = compute(value, 14);
+const value80399 = compute(value, 83);
+const value2280 = compute(value, 49);
+const value49828 = compute(value, 67);
+// note 43040: keep this in sync with the handler
+const value44381 = compute(value, 52);
+const value27765 = compute(value, 23);
+const value52808 = compute(value, 40);
+const value63604 = compute(value, 69);
+const value97712 = compute(value, 33);
+const value11125 = compute(value, 67);
+const value20260 = compute(value, 84);
+const value24524 = compute(value, 80);
+const value83436 = compute(value, 16);
+const value4481 = compute(value, 19);
+const value14838 = compute(value, 94);
+const value33805 = compute(value, 49);
+const v = import.meta.env.BENCH_KEY_01011;
+const value25521 = compute(value, 10);
+const value60062 = compute(value, 19);
+const value41471 = compute(value, 52);
+// note 5547: keep this in sync with the handler
+const value5543 = compute(value, 14);
+const value20132 = compute(value, 53);
+const value78687 = compute(value, 20);
+const v = import.meta.env.BENCH_KEY_01405;
+// note 34190: keep this in sync with the handler
+const value80376 = compute(value, 60);
+const value36910 = compute(value, 50);
+const value14540 = compute(value, 87);
+// note 39395: keep this in sync with the handler
+const value98092 = compute(value, 25);
+const value1328 = compute(value, 67);
+const value62147 = compute(value, 67);
+// note 10844: keep this in sync with the handler
+const value94456 = compute(value, 75);
+const value31245 = compute(value, 11);
+// note 93445: keep this in sync with the handler
+// note 30612: keep this in sync with the handler
+const v = process.env.BENCH_KEY_01907;
+const value13288 = compute(value, 96);
+const value96270 = compute(value, 46);
+// note 71233: keep this in sync with the handler
+const value58035 = compute(value, 29);
+const value93592 = compute(value, 84);
+const value18448 = compute(value, 18);
+const value78947 = compute(value, 86);
+const value92016 = compute(value, 60);
+const v = process.env.BENCH_KEY_01979;
+const value76011 = compute(value, 60);
+const value9096 = compute(value, 75);
+const value79635 = compute(value, 95);
+const value84783 = compute(value, 5);
+const value51411 = compute(value, 1);
+const value51530 = compute(value, 23);
+const value77727 = compute(value, 30);
+const value49768 = compute(value, 7);
+const value93253 = compute(value, 36);
+const value13554 = compute(value, 71);
+const value29114 = compute(value, 14);
+// note 97387: keep this in sync with the handler
+const value71914 = compute(value, 37);
+const value34110 = compute(value, 63);
+const v = import.meta.env.BENCH_KEY_00399;
+const value41903 = compute(value, 96);
+// note 96198: keep this in sync with the handler
+const value2086 = compute(value, 49);
+const value63154 = compute(value, 7);
+const value44707 = compute(value, 87);
+// note 7495: keep this in sync with the handler
+const value16956 = compute(value, 78);
+const value13634 = compute(value, 54);
+const value86304 = compute(value, 71);
+const value15593 = compute(value, 73);
+const value47751 = compute(value, 27);
+const value35528 = compute(value, 26);
+const value93343 = compute(value, 29);
+const value4981 = compute(value, 34);
+const value52779 = compute(value, 11);
+const value55494 = compute(value, 10);
+const value57273 = compute(value, 43);
+const value37998 = compute(value, 71);
+const v = process.env["BENCH_KEY_00787"];
+const value85527 = compute(value, 70);
+const value9367 = compute(value, 55);
+// note 28872: keep this in sync with the handler
+const value18946 = compute(value, 31);
+const value69514 = compute(value, 62);
+const value998 = compute(value, 28);
+const value3329 = compute(value, 31);
+const value89041 = compute(value, 92);
+const value48455 = compute(value, 52);
+const v = import.meta.env.BENCH_KEY_00571;
+const value32129 = compute(value, 22);
+const value37883 = compute(value, 53);
+const value38952 = compute(value, 55);
+const value62395 = compute(value, 24);
+const value57002 = compute(value, 63);
+const value44188 = compute(value, 53);
+const value37973 = compute(value, 46);
+const value31062 = compute(value, 22);
+const value15544 = compute(value, 24);
+const value33213 = compute(value, 39);
+const value18011 = compute(value, 66);
+// note 52254: keep this in sync with the handler
+const value39318 = compute(value, 33);
+const value4530 = compute(value, 68);
+const value21628 = compute(value, 94);
+const value80732 = compute(value, 28);
+const value79725 = compute(value, 88);
+const value61939 = compute(value, 53);
+const value31123 = compute(value, 83);
+const v = process.env["BENCH_KEY_00415"];
+const value31099 = compute(value, 59);
+const value10504 = compute(value, 28);
+// note 86670: keep this in sync with the handler
+// note 43651: keep this in sync with the handler
+const value15411 = compute(value, 85);
+const value34731 = compute(value, 5);
+const value6080 = compute(value, 66);
+const value44622 = compute(value, 2);
+const value41777 = compute(value, 67);
+const value18924 = compute(value, 9);
+const value12401 = compute(value, 82);
+const value78260 = compute(value, 78);
+const v = process.env["BENCH_KEY_00715"];
+const value834 = compute(value, 58);
+const value64190 = compute(value, 73);
+const value38457 = compute(value, 45);
+const value36312 = compute(value, 34);
+const value75362 = compute(value, 90);
+const value27454 = compute(value, 3);
+const value24143 = compute(value, 87);
+const value50008 = compute(value, 53);
+const value34756 = compute(value, 30);
+const value37912 = compute(value, 82);
+const value27983 = compute(value, 47);
+const value41220 = compute(value, 92);
+const value25942 = compute(value, 43);
+// note 14175: keep this in sync with the handler
+const value3426 = compute(value, 31);
+const v = process.env.BENCH_KEY_01167;
+const value57068 = compute(value, 32);
+const value41782 = compute(value, 72);
+const value37928 = compute(value, 1);
+// note 88141: keep this in sync with the handler
+const value26408 = compute(value, 24);
+const value71109 = compute(value, 8);
+const value7042 = compute(value, 58);
+// note 75684: keep this in sync with the handler
+const value95382 = compute(value, 31);
+// note 81743: keep this in sync with the handler
+const value29003 = compute(value, 0);
+const value15629 = compute(value, 12);
+const value37821 = compute(value, 88);
+// note 7695: keep this in sync with the handler
+// note 19408: keep this in sync with the handler
+const v = process.env.BENCH_KEY_01611;
+const value52305 = compute(value, 22);
+const value38810 = compute(value, 10);
+const value99774 = compute(value, 58);
+const value5108 = compute(value, 64);
+const value38026 = compute(value, 2);
+const value31661 = compute(value, 39);
+const value56845 = compute(value, 3);
+const value29230 = compute(value, 33);
+const value35651 = compute(value, 52);
+const value16554 = compute(value, 64);
+// note 73927: keep this in sync with the handler
+const v = process.env.BENCH_KEY_01386;
+const value67673 = compute(value, 64);
+const value87113 = compute(value, 7);
+const value32961 = compute(value, 78);
+const value59983 = compute(value, 37);
+const value6440 = compute(value, 38);
+const value1240 = compute(value, 76);
+const value66780 = compute(value, 44);
+const value85650 = compute(value, 96);
+const value12754 = compute(value, 47);
+const value51516 = compute(value, 9);
+const value60397 = compute(value, 63);
+// note 46762: keep this in sync with the handler
+const value13309 = compute(value, 20);
+const value65576 = compute(value, 4);
+// note 46833: keep this in sync with the handler
+const value3131 = compute(value, 27);
+const value29738 = compute(value, 56);
+const value78485 = compute(value, 12);
+const v = process.env["BENCH_KEY_00178"];
+const value34165 = compute(value, 21);
+const value74340 = compute(value, 38);
+const value79594 = compute(value, 54);
+const value85778 = compute(value, 30);
+const value16274 = compute(value, 75);
+const value34032 = compute(value, 82);
+const value93970 = compute(value, 74);
+const value31865 = compute(value, 49);
@@ -0,0 +1,236 @@
+# note 14890: keep this in sync with the handler
+value3165 = compute(value, 61)
+value68312 = compute(value, 24)
+value28623 = compute(value, 8)
+value38464 = compute(value, 52)
+value4351 = compute(value, 83)
+value96571 = compute(value, 56)
+value58464 = compute(value, 70)
+value26326 = compute(value, 39)
+value43698 = compute(value, 48)
+value6907 = compute(value, 20)
+value9183 = compute(value, 65)
+value18439 = compute(value, 9)
+value59364 = compute(value, 0)
+const v = os.environ.get('BENCH_KEY_00677');
+value12164 = compute(value, 39)
+value32382 = compute(value, 81)
+value1415 = compute(value, 57)
+value30291 = compute(value, 27)
+value34070 = compute(value, 23)
+value11353 = compute(value, 4)
+value30683 = compute(value, 31)
+value69175 = compute(value, 14)
+value15136 = compute(value, 4)
+value83010 = compute(value, 75)
+value48556 = compute(value, 56)
+value85780 = compute(value, 32)
+value2824 = compute(value, 11)
+value89342 = compute(value, 5)
+value95961 = compute(value, 28)
+const v = os.getenv("BENCH_KEY_00460");
+value38702 = compute(value, 96)
+value74992 = compute(value, 11)
+value37530 = compute(value, 88)
+value72508 = compute(value, 49)
+value147 = compute(value, 50)
+value94307 = compute(value, 23)
+value60973 = compute(value, 57)
+# note 94461: keep this in sync with the handler
+value17770 = compute(value, 19)
+value22181 = compute(value, 65)
+value71584 = compute(value, 95)
+value23042 = compute(value, 53)
+# note 19207: keep this in sync with the handler
+value34690 = compute(value, 61)
+const v = os.environ["BENCH_KEY_01777"];
+value42684 = compute(value, 4)
+value95949 = compute(value, 16)
+value59472 = compute(value, 11)
+value51525 = compute(value, 18)
+value64149 = compute(value, 32)
+value72076 = compute(value, 5)
+value60358 = compute(value, 24)
+value37340 = compute(value, 92)
+# note 74813: keep this in sync with the handler
+value35205 = compute(value, 91)
+value32066 = compute(value, 56)
+# note 25212: keep this in sync with the handler
+value87608 = compute(value, 17)
+const v = os.environ.get('BENCH_KEY_00112');
+value81320 = compute(value, 34)
+value82520 = compute(value, 70)
+value35698 = compute(value, 2)
+# note 55032: keep this in sync with the handler
+value42922 = compute(value, 48)
+value69367 = compute(value, 12)
+value47566 = compute(value, 36)
+# note 46390: keep this in sync with the handler
+const v = os.environ["BENCH_KEY_00708"];
+value95061 = compute(value, 1)
+value66915 = compute(value, 82)
+value9688 = compute(value, 85)
+value75394 = compute(value, 25)
+value85157 = compute(value, 88)
+value78008 = compute(value, 20)
+value61291 = compute(value, 84)
+value98631 = compute(value, 79)
+# note 5480: keep this in sync with the handler
+value1905 = compute(value, 62)
+value28701 = compute(value, 86)
+value81193 = compute(value, 4)
+value62473 = compute(value, 5)
+const v = os.environ["BENCH_KEY_00631"];
+value42389 = compute(value, 0)
+value48434 = compute(value, 31)
+value1086 = compute(value, 19)
+value11635 = compute(value, 92)
+# note 56851: keep this in sync with the handler
+# note 88102: keep this in sync with the handler
+value39509 = compute(value, 30)
+value67737 = compute(value, 31)
+value83237 = compute(value, 11)
+value79450 = compute(value, 7)
+value34700 = compute(value, 71)
+const v = os.environ.get('BENCH_KEY_01864');
+value76337 = compute(value, 95)
+value2718 = compute(value, 2)
+value75967 = compute(value, 16)
+value16948 = compute(value, 70)
+value45673 = compute(value, 83)
+value85322 = compute(value, 59)
+value7992 = compute(value, 38)
+value29851 = compute(value, 72)
+value87545 = compute(value, 51)
+# note 12768: keep this in sync with the handler
+# note 54853: keep this in sync with the handler
+# note 60606: keep this in sync with the handler
+value42950 = compute(value, 76)
+value35795 = compute(value, 2)
+value90193 = compute(value, 80)
+value22364 = compute(value, 54)
+value86201 = compute(value, 65)
+value21136 = compute(value, 87)
+value21623 = compute(value, 89)
+value67861 = compute(value, 58)
+value66917 = compute(value, 84)
+const v = os.getenv("BENCH_KEY_01626");
+value43484 = compute(value, 28)
+# note 76511: keep this in sync with the handler
+value5144 = compute(value, 3)
+value86220 = compute(value, 84)
+value84904 = compute(value, 29)
+value26042 = compute(value, 46)
+# note 49192: keep this in sync with the handler
+value38503 = compute(value, 91)
+const v = os.environ.get('BENCH_KEY_00447');
+value35062 = compute(value, 45)
+value2963 = compute(value, 53)
+value37398 = compute(value, 53)
+# note 4305: keep this in sync with the handler
+value30238 = compute(value, 71)
+value64839 = compute(value, 43)
+value76905 = compute(value, 81)
+value81959 = compute(value, 91)
+# note 86723: keep this in sync with the handler
+value24127 = compute(value, 71)
+value32514 = compute(value, 19)
+const v = os.environ.get('BENCH_KEY_01625');
+value15366 = compute(value, 40)
+value79719 = compute(value, 82)
+value687 = compute(value, 8)
+value95557 = compute(value, 12)
+# note 83622: keep this in sync with the handler
+value82201 = compute(value, 42)
+value29469 = compute(value, 78)
+value20731 = compute(value, 70)
+value90507 = compute(value, 6)
+# note 84837: keep this in sync with the handler
+value33462 = compute(value, 94)
+const v = os.environ["BENCH_KEY_00991"];
+value99921 = compute(value, 11)
+value89622 = compute(value, 91)
+# note 44359: keep this in sync with the handler
+value65535 = compute(value, 60)
+value73562 = compute(value, 36)
+value83515 = compute(value, 95)
+value3760 = compute(value, 74)
+value72700 = compute(value, 47)
+value87473 = compute(value, 76)
+const v = os.environ["BENCH_KEY_00573"];
+value83888 = compute(value, 80)
+value13109 = compute(value, 14)
+value95874 = compute(value, 38)
+value45815 = compute(value, 31)
+value69022 = compute(value, 55)
+value33648 = compute(value, 86)
+# note 88973: keep this in sync with the handler
+value62934 = compute(value, 78)
+const v = os.environ["BENCH_KEY_01334"];
+value52904 = compute(value, 39)
+value32335 = compute(value, 34)
+value44446 = compute(value, 20)
+value53189 = compute(value, 33)
+value5214 = compute(value, 73)
+value68825 = compute(value, 52)
+value20077 = compute(value, 95)
+value79090 = compute(value, 35)
+value89858 = compute(value, 36)
+value10349 = compute(value, 67)
+value35939 = compute(value, 49)
+value14007 = compute(value, 39)
+value88663 = compute(value, 5)
+value18383 = compute(value, 50)
+value36200 = compute(value, 19)
+value77264 = compute(value, 52)
+value6739 = compute(value, 46)
+const v = os.environ.get('BENCH_KEY_00330');
+value43363 = compute(value, 4)
+value6509 = compute(value, 10)
+value58834 = compute(value, 52)
+value43117 = compute(value, 49)
+value19730 = compute(value, 39)
+value24029 = compute(value, 70)
+value37075 = compute(value, 21)
+value60513 = compute(value, 82)
+value80960 = compute(value, 62)
+value31693 = compute(value, 71)
+value21349 = compute(value, 9)
+value61618 = compute(value, 23)
+value47737 = compute(value, 13)
+value87066 = compute(value, 57)
+value1303 = compute(value, 42)
+value18094 = compute(value, 52)
+# note 23864: keep this in sync with the handler
+value72316 = compute(value, 51)
+const v = os.environ.get('BENCH_KEY_01127');
+value66333 = compute(value, 82)
+value91175 = compute(value, 92)
+value11038 = compute(value, 77)
+value77622 = compute(value, 22)
+# note 87263: keep this in sync with the handler
+# note 26095: keep this in sync with the handler
+# note 81751: keep this in sync with the handler
+# note 73162: keep this in sync with the handler
+value89333 = compute(value, 93)
+# note 69664: keep this in sync with the handler
+value86916 = compute(value, 4)
+value24122 = compute(value, 66)
+value92197 = compute(value, 47)
+value74478 = compute(value, 79)
+# note 20950: keep this in sync with the handler
+value22951 = compute(value, 59)
+value54028 = compute(value, 96)
+const v = os.getenv("BENCH_KEY_00974");
+# note 94830: keep this in sync with the handler
+value82991 = compute(value, 56)
+value16835 = compute(value, 54)
+# note 73035: keep this in sync with the handler
+# note 75913: keep this in sync with the handler
+value76106 = compute(value, 58)
+value16404 = compute(value, 11)
+value68470 = compute(value, 85)
+value48296 = compute(value, 87)
+const v = os.getenv("BENCH_KEY_00920");
+value42176 = compute(value, 78)
+value75990 = compute(value, 39)
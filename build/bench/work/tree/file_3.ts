@@ -0,0 +1,203 @@
+const value54631 = compute(value, 20);
+const value10071 = compute(value, 80);
+const value40972 = compute(value, 38);
+const value10735 = compute(value, 65);
+// note 32583: keep this in sync with the handler
+const value3851 = compute(value, 68);
+const v = process.env["BENCH_KEY_00149"];
+// note 76449: keep this in sync with the handler
+const value24656 = compute(value, 18);
+const value61720 = compute(value, 28);
+const value25810 = compute(value, 8);
+const value10751 = compute(value, 81);
+// note 74089: keep this in sync with the handler
+// note 79677: keep this in sync with the handler
+const value70596 = compute(value, 77);
+const value86122 = compute(value, 83);
+const value41411 = compute(value, 89);
+const value72054 = compute(value, 80);
+const value27711 = compute(value, 66);
+// note 11801: keep this in sync with the handler
+const value59313 = compute(value, 46);
+const value85610 = compute(value, 56);
+const value65853 = compute(value, 87);
+const value52004 = compute(value, 12);
+const value13776 = compute(value, 2);
+const value68845 = compute(value, 72);
+const v = process.env.BENCH_KEY_00431;
+// note 74898: keep this in sync with the handler
+const value54486 = compute(value, 69);
+const value38927 = compute(value, 30);
+const value85439 = compute(value, 79);
+// note 91611: keep this in sync with the handler
+const value70290 = compute(value, 62);
+const value75283 = compute(value, 11);
+const value19701 = compute(value, 10);
+const value2929 = compute(value, 19);
+const value23950 = compute(value, 88);
+// note 88978: keep this in sync with the handler
+const v = process.env.BENCH_KEY_00557;
+const value19033 = compute(value, 21);
+const value93849 = compute(value, 50);
+const value87060 = compute(value, 51);
+const value2926 = compute(value, 16);
+const value68478 = compute(value, 93);
+// note 49209: keep this in sync with the handler
+const value1936 = compute(value, 93);
+const value82955 = compute(value, 20);
+const value89619 = compute(value, 88);
+const value88216 = compute(value, 43);
+const value8215 = compute(value, 67);
+const value64485 = compute(value, 77);
+const value71996 = compute(value, 22);
+const value32062 = compute(value, 52);
+const value71812 = compute(value, 32);
+const value61313 = compute(value, 9);
+const value92699 = compute(value, 64);
+// note 65794: keep this in sync with the handler
+const v = process.env["BENCH_KEY_01642"];
+const value17318 = compute(value, 52);
+const value70473 = compute(value, 51);
+const value95784 = compute(value, 45);
+const value21127 = compute(value, 78);
+const value74547 = compute(value, 51);
+const value52843 = compute(value, 75);
+const value67963 = compute(value, 63);
+const value66234 = compute(value, 80);
+const value85194 = compute(value, 28);
+const value75051 = compute(value, 70);
+const value87998 = compute(value, 19);
+// note 74675: keep this in sync with the handler
+const value53691 = compute(value, 50);
+const v = import.meta.env.BENCH_KEY_01222;
+const value70492 = compute(value, 70);
+const value75036 = compute(value, 55);
+const value35015 = compute(value, 95);
+// note 51945: keep this in sync with the handler
+// note 31272: keep this in sync with the handler
+const value53569 = compute(value, 25);
+const value31450 = compute(value, 22);
+const value82728 = compute(value, 84);
+const value23266 = compute(value, 83);
+const value46668 = compute(value, 11);
+const value57800 = compute(value, 85);
+const value23288 = compute(value, 8);
+const value54308 = compute(value, 85);
+const value9156 = compute(value, 38);
+const value14489 = compute(value, 36);
+const value60841 = compute(value, 22);
+const v = process.env["BENCH_KEY_01778"];
+const value96048 = compute(value, 18);
+const value7676 = compute(value, 13);
+const value41581 = compute(value, 65);
+const value15293 = compute(value, 64);
+const value99194 = compute(value, 60);
+const value17988 = compute(value, 43);
+const value46509 = compute(value, 46);
+// note 30072: keep this in sync with the handler
+const v = process.env.BENCH_KEY_01399;
+const value99285 = compute(value, 54);
+const value87929 = compute(value, 47);
+// note 44461: keep this in sync with the handler
+const value95828 = compute(value, 89);
+const value64550 = compute(value, 45);
+// note 26750: keep this in sync with the handler
+// note 60412: keep this in sync with the handler
+// note 31879: keep this in sync with the handler
+const value8391 = compute(value, 49);
+const value42396 = compute(value, 7);
+const value83221 = compute(value, 92);
+const v = process.env["BENCH_KEY_01817"];
+const value12753 = compute(value, 46);
+const value4960 = compute(value, 13);
+const value75165 = compute(value, 87);
+const value13641 = compute(value, 61);
+const value99224 = compute(value, 90);
+// note 23030: keep this in sync with the handler
+const value44614 = compute(value, 91);
+const value43354 = compute(value, 92);
+const value42042 = compute(value, 41);
+const value99475 = compute(value, 50);
+// note 88382: keep this in sync with the handler
+// note 9459: keep this in sync with the handler
+const v = process.env.BENCH_KEY_01674;
+// note 3485: keep this in sync with the handler
+const value89435 = compute(value, 1);
+const value86678 = compute(value, 57);
+const value68978 = compute(value, 11);
+const value94347 = compute(value, 63);
+const value36446 = compute(value, 71);
+const value62188 = compute(value, 11);
+const value15756 = compute(value, 42);
+const value22462 = compute(value, 55);
+const value26415 = compute(value, 31);
+const value82656 = compute(value, 12);
+const value71077 = compute(value, 73);
+const v = import.meta.env.BENCH_KEY_01966;
+const value65284 = compute(value, 3);
+const value33689 = compute(value, 30);
+const value49910 = compute(value, 52);
+const value70208 = compute(value, 77);
+const value72560 = compute(value, 4);
+const value33915 = compute(value, 62);
+const value10789 = compute(value, 22);
+const value98081 = compute(value, 14);
+const value56734 = compute(value, 86);
+const value44976 = compute(value, 65);
+const value10134 = compute(value, 46);
+const value32959 = compute(value, 76);
+const value42284 = compute(value, 89);
+const v = process.env.BENCH_KEY_00531;
+const value62179 = compute(value, 2);
+const value24700 = compute(value, 62);
+const value52586 = compute(value, 12);
+const value90044 = compute(value, 28);
+// note 28246: keep this in sync with the handler
+const value9214 = compute(value, 96);
+const value30005 = compute(value, 32);
+const value33845 = compute(value, 89);
+const value17571 = compute(value, 14);
+const v = process.env["BENCH_KEY_01133"];
+const value35730 = compute(value, 34);
+const value75068 = compute(value, 87);
+const value16421 = compute(value, 28);
+const value62526 = compute(value, 58);
+const value13780 = compute(value, 6);
+const value50296 = compute(value, 50);
+const value75836 = compute(value, 79);
+// note 96001: keep this in sync with the handler
+const value24785 = compute(value, 50);
+const v = import.meta.env.BENCH_KEY_00495;
+const value37588 = compute(value, 49);
+const value76030 = compute(value, 79);
+const value83300 = compute(value, 74);
+const value73640 = compute(value, 17);
+const value66063 = compute(value, 6);
+const value44888 = compute(value, 74);
+const value65040 = compute(value, 50);
+const value72665 = compute(value, 12);
+const value27119 = compute(value, 56);
+const value34399 = compute(value, 61);
+const value25158 = compute(value, 35);
+const value58217 = compute(value, 17);
+const v = process.env["BENCH_KEY_00808"];
+const value18672 = compute(value, 48);
+// note 83887: keep this in sync with the handler
+const value94069 = compute(value, 76);
+const value51153 = compute(value, 34);
+const value6247 = compute(value, 39);
+const value42529 = compute(value, 43);
+const value58547 = compute(value, 56);
+const value37353 = compute(value, 8);
+const value29846 = compute(value, 67);
+const value39307 = compute(value, 22);
+// note 80504: keep this in sync with the handler
+const value45875 = compute(value, 91);
+const v = process.env["BENCH_KEY_01550"];
+const value87990 = compute(value, 11);
+const value65707 = compute(value, 38);
+const value87725 = compute(value, 37);
+const value44732 = compute(value, 15);
+// note 93953: keep this in sync with the handler
+const value99254 = compute(value, 23);
+// note 85844: keep this in sync with the handler
@@ -0,0 +1,215 @@
+// note 64703: keep this in sync with the handler
+let value76813 = compute(value, 86);
+let value91461 = compute(value, 87);
+let value57632 = compute(value, 14);
+const v = env::var("BENCH_KEY_01129");
+let value21564 = compute(value, 30);
+let value82354 = compute(value, 1);
+let value27599 = compute(value, 51);
+// note 4961: keep this in sync with the handler
+let value86901 = compute(value, 86);
+let value93762 = compute(value, 60);
+let value11692 = compute(value, 52);
+let value53708 = compute(value, 67);
+let value39673 = compute(value, 0);
+// note 2158: keep this in sync with the handler
+// note 1952: keep this in sync with the handler
+let value17852 = compute(value, 4);
+let value18343 = compute(value, 10);
+let value39611 = compute(value, 35);
+let value47145 = compute(value, 3);
+let value6407 = compute(value, 5);
+let value95911 = compute(value, 75);
+let value7789 = compute(value, 29);
+const v = env::var("BENCH_KEY_01938");
+let value34118 = compute(value, 71);
+let value20612 = compute(value, 48);
+let value69983 = compute(value, 46);
+let value39968 = compute(value, 4);
+// note 96887: keep this in sync with the handler
+let value86617 = compute(value, 93);
+// note 75177: keep this in sync with the handler
+let value86720 = compute(value, 2);
+let value31654 = compute(value, 32);
+let value98949 = compute(value, 9);
+let value6740 = compute(value, 47);
+let value31408 = compute(value, 77);
+let value93445 = compute(value, 34);
+let value1108 = compute(value, 41);
+let value1802 = compute(value, 56);
+let value387 = compute(value, 96);
+let value34319 = compute(value, 78);
+// note 9804: keep this in sync with the handler
+const v = env::var("BENCH_KEY_01645");
+let value59846 = compute(value, 94);
+let value43287 = compute(value, 25);
+let value51122 = compute(value, 3);
+let value58297 = compute(value, 0);
+let value93233 = compute(value, 16);
+let value26337 = compute(value, 50);
+let value19489 = compute(value, 89);
+// note 32948: keep this in sync with the handler
+let value87763 = compute(value, 75);
+let value2423 = compute(value, 95);
+let value2982 = compute(value, 72);
+let value28117 = compute(value, 84);
+let value68900 = compute(value, 30);
+let value44884 = compute(value, 70);
+let value44890 = compute(value, 76);
+let value11264 = compute(value, 12);
+let value56856 = compute(value, 14);
+let value81008 = compute(value, 13);
+const v = env::var("BENCH_KEY_00720");
+let value26548 = compute(value, 67);
+let value85198 = compute(value, 32);
+let value85149 = compute(value, 80);
+let value42492 = compute(value, 6);
+let value24940 = compute(value, 11);
+let value32210 = compute(value, 6);
+let value39992 = compute(value, 28);
+// note 72958: keep this in sync with the handler
+let value24573 = compute(value, 32);
+let value93477 = compute(value, 66);
+let value27466 = compute(value, 15);
+let value18716 = compute(value, 92);
+const v = env::var("BENCH_KEY_00776");
+let value57139 = compute(value, 6);
+let value16740 = compute(value, 56);
+let value2100 = compute(value, 63);
+// note 92660: keep this in sync with the handler
+let value14336 = compute(value, 77);
+let value99651 = compute(value, 32);
+let value73059 = compute(value, 18);
+let value70320 = compute(value, 92);
+let value13256 = compute(value, 64);
+let value72045 = compute(value, 71);
+let value66974 = compute(value, 44);
+// note 35641: keep this in sync with the handler
+let value50957 = compute(value, 32);
+let value99016 = compute(value, 76);
+const v = env::var("BENCH_KEY_00742");
+let value24055 = compute(value, 96);
+// note 24116: keep this in sync with the handler
+let value7797 = compute(value, 37);
+// note 5970: keep this in sync with the handler
+let value48003 = compute(value, 85);
+let value3698 = compute(value, 12);
+let value66042 = compute(value, 82);
+let value7163 = compute(value, 82);
+let value13450 = compute(value, 64);
+// note 33825: keep this in sync with the handler
+const v = env::var("BENCH_KEY_00352");
+let value45588 = compute(value, 95);
+let value91121 = compute(value, 38);
+let value17387 = compute(value, 24);
+let value42000 = compute(value, 96);
+let value29655 = compute(value, 70);
+let value52382 = compute(value, 2);
+let value58522 = compute(value, 31);
+let value46323 = compute(value, 54);
+const v = env::var("BENCH_KEY_01697");
+let value35221 = compute(value, 10);
+let value14502 = compute(value, 49);
+let value337 = compute(value, 46);
+let value72199 = compute(value, 31);
+let value82732 = compute(value, 88);
+let value20968 = compute(value, 16);
+let value42968 = compute(value, 94);
+let value22614 = compute(value, 13);
+let value30873 = compute(value, 27);
+let value57809 = compute(value, 94);
+let value82631 = compute(value, 84);
+// note 53702: keep this in sync with the handler
+let value29669 = compute(value, 84);
+const v = env::var_os("BENCH_KEY_00214");
+let value61708 = compute(value, 16);
+let value15556 = compute(value, 36);
+let value63401 = compute(value, 60);
+let value72872 = compute(value, 25);
+let value38801 = compute(value, 1);
+let value36744 = compute(value, 78);
+let value3049 = compute(value, 42);
+let value98453 = compute(value, 95);
+let value10357 = compute(value, 75);
+let value70808 = compute(value, 95);
+const v = env::var_os("BENCH_KEY_01761");
+// note 29466: keep this in sync with the handler
+let value67931 = compute(value, 31);
+let value33016 = compute(value, 36);
+let value16726 = compute(value, 42);
+let value20867 = compute(value, 12);
+let value41971 = compute(value, 67);
+let value91455 = compute(value, 81);
+let value72517 = compute(value, 58);
+let value87059 = compute(value, 50);
+let value91492 = compute(value, 21);
+let value34079 = compute(value, 32);
+let value56209 = compute(value, 46);
+// note 77869: keep this in sync with the handler
+// note 9736: keep this in sync with the handler
+let value90395 = compute(value, 88);
+let value6547 = compute(value, 48);
+let value93494 = compute(value, 83);
+let value77068 = compute(value, 50);
+const v = env::var_os("BENCH_KEY_00456");
+let value52377 = compute(value, 94);
+let value35077 = compute(value, 60);
+let value17466 = compute(value, 6);
+let value20607 = compute(value, 43);
+let value66576 = compute(value, 34);
+// note 94645: keep this in sync with the handler
+let value76370 = compute(value, 31);
+let value43091 = compute(value, 23);
+let value26435 = compute(value, 51);
+let value42310 = compute(value, 18);
+let value51744 = compute(value, 43);
+let value1594 = compute(value, 42);
+let value87954 = compute(value, 72);
+let value3159 = compute(value, 55);
+let value30352 = compute(value, 88);
+let value27988 = compute(value, 52);
+let value99980 = compute(value, 70);
+let value92906 = compute(value, 77);
+let value73225 = compute(value, 87);
+const v = env::var("BENCH_KEY_00918");
+let value67949 = compute(value, 49);
+let value89343 = compute(value, 6);
+let value17503 = compute(value, 43);
+let value4160 = compute(value, 86);
+let value32752 = compute(value, 63);
+let value99030 = compute(value, 90);
+let value61210 = compute(value, 3);
+let value91334 = compute(value, 57);
+let value77599 = compute(value, 96);
+let value99101 = compute(value, 64);
+let value41398 = compute(value, 76);
+const v = env::var("BENCH_KEY_01618");
+let value40225 = compute(value, 67);
+let value53755 = compute(value, 17);
+let value40471 = compute(value, 22);
+let value99180 = compute(value, 46);
+let value72157 = compute(value, 86);
+let value41655 = compute(value, 42);
+let value39106 = compute(value, 15);
+let value90809 = compute(value, 17);
+let value37264 = compute(value, 16);
+// note 34526: keep this in sync with the handler
+let value21032 = compute(value, 80);
+let value17937 = compute(value, 89);
+let value87950 = compute(value, 68);
+let value63091 = compute(value, 41);
+let value40336 = compute(value, 81);
+let value1647 = compute(value, 95);
+let value56192 = compute(value, 29);
+let value70136 = compute(value, 5);
+let value36544 = compute(value, 72);
+const v = env::var_os("BENCH_KEY_00851");
+let value11951 = compute(value, 20);
+let value74301 = compute(value, 96);
+let value6504 = compute(value, 5);
+let value27386 = compute(value, 32);
+let value80108 = compute(value, 83);
+let value56346 = compute(value, 86);
+let value50324 = compute(value, 78);
+// note 83614: keep this in sync with the handler
+let value57857 = compute(value, 45);
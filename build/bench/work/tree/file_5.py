@@ -0,0 +1,236 @@
+value35447 = compute(value, 42)
+# note 23896: keep this in sync with the handler
+value60486 = compute(value, 55)
+value69249 = compute(value, 88)
+value73203 = compute(value, 65)
+value59879 = compute(value, 30)
+# note 73359: keep this in sync with the handler
+value27795 = compute(value, 53)
+value46695 = compute(value, 38)
+value43040 = compute(value, 69)
+value64724 = compute(value, 25)
+value82118 = compute(value, 56)
+const v = os.environ["BENCH_KEY_00305"];
+value70589 = compute(value, 70)
+value54898 = compute(value, 93)
+value87141 = compute(value, 35)
+value86457 = compute(value, 30)
+value55216 = compute(value, 23)
+value57594 = compute(value, 73)
+# note 20176: keep this in sync with the handler
+value84345 = compute(value, 52)
+value57653 = compute(value, 35)
+value23027 = compute(value, 38)
+# note 4755: keep this in sync with the handler
+value52001 = compute(value, 9)
+const v = os.environ["BENCH_KEY_01384"];
+value46361 = compute(value, 92)
+# note 64173: keep this in sync with the handler
+# note 50000: keep this in sync with the handler
+# note 69317: keep this in sync with the handler
+# note 51447: keep this in sync with the handler
+value83668 = compute(value, 54)
+value67234 = compute(value, 13)
+value47831 = compute(value, 10)
+value27472 = compute(value, 21)
+value67689 = compute(value, 80)
+value9315 = compute(value, 3)
+value27019 = compute(value, 53)
+# note 53141: keep this in sync with the handler
+value79955 = compute(value, 27)
+value72921 = compute(value, 74)
+const v = os.environ.get('BENCH_KEY_01867');
+value8695 = compute(value, 62)
+# note 17491: keep this in sync with the handler
+value63782 = compute(value, 53)
+value78852 = compute(value, 88)
+# note 41423: keep this in sync with the handler
+value51527 = compute(value, 20)
+value52910 = compute(value, 45)
+value42912 = compute(value, 38)
+# note 41544: keep this in sync with the handler
+value21155 = compute(value, 9)
+value97911 = compute(value, 38)
+value97294 = compute(value, 3)
+value87278 = compute(value, 75)
+value53293 = compute(value, 40)
+value3274 = compute(value, 73)
+const v = os.environ["BENCH_KEY_01710"];
+value92613 = compute(value, 75)
+value29578 = compute(value, 90)
+# note 37588: keep this in sync with the handler
+value39076 = compute(value, 82)
+# note 10566: keep this in sync with the handler
+# note 79807: keep this in sync with the handler
+value21776 = compute(value, 48)
+value16157 = compute(value, 55)
+const v = os.environ.get('BENCH_KEY_00567');
+value55889 = compute(value, 17)
+value14799 = compute(value, 55)
+value11504 = compute(value, 58)
+value8078 = compute(value, 27)
+# note 78770: keep this in sync with the handler
+# note 68496: keep this in sync with the handler
+value31664 = compute(value, 42)
+value84261 = compute(value, 65)
+# note 76564: keep this in sync with the handler
+value61338 = compute(value, 34)
+value76774 = compute(value, 47)
+value755 = compute(value, 76)
+value50436 = compute(value, 93)
+value98658 = compute(value, 9)
+# note 44388: keep this in sync with the handler
+value12698 = compute(value, 88)
+value4567 = compute(value, 8)
+value37568 = compute(value, 29)
+value15214 = compute(value, 82)
+value1167 = compute(value, 3)
+value78314 = compute(value, 35)
+const v = os.getenv("BENCH_KEY_01180");
+value7454 = compute(value, 82)
+value99589 = compute(value, 67)
+# note 17154: keep this in sync with the handler
+value50104 = compute(value, 52)
+value43238 = compute(value, 73)
+value35696 = compute(value, 0)
+value67647 = compute(value, 38)
+value52776 = compute(value, 8)
+value20531 = compute(value, 64)
+value13696 = compute(value, 19)
+value28644 = compute(value, 29)
+value51901 = compute(value, 6)
+value33568 = compute(value, 6)
+value63331 = compute(value, 87)
+value60203 = compute(value, 63)
+value14404 = compute(value, 48)
+value91253 = compute(value, 73)
+value81490 = compute(value, 10)
+value55567 = compute(value, 83)
+value65278 = compute(value, 94)
+value85914 = compute(value, 69)
+value96113 = compute(value, 83)
+value47060 = compute(value, 15)
+const v = os.getenv("BENCH_KEY_01130");
+value72385 = compute(value, 23)
+value57858 = compute(value, 46)
+value69506 = compute(value, 54)
+value80664 = compute(value, 57)
+# note 16507: keep this in sync with the handler
+value4345 = compute(value, 77)
+value8555 = compute(value, 19)
+value71282 = compute(value, 84)
+# note 41033: keep this in sync with the handler
+value80673 = compute(value, 66)
+value34754 = compute(value, 28)
+const v = os.getenv("BENCH_KEY_00797");
+value64496 = compute(value, 88)
+value86965 = compute(value, 53)
+# note 82759: keep this in sync with the handler
+value96137 = compute(value, 10)
+value43204 = compute(value, 39)
+value63939 = compute(value, 16)
+# note 5296: keep this in sync with the handler
+value45765 = compute(value, 78)
+value68291 = compute(value, 3)
+# note 58622: keep this in sync with the handler
+value38894 = compute(value, 94)
+value94266 = compute(value, 79)
+value28041 = compute(value, 8)
+value86541 = compute(value, 17)
+value964 = compute(value, 91)
+value64174 = compute(value, 57)
+value57762 = compute(value, 47)
+value78912 = compute(value, 51)
+value97392 = compute(value, 4)
+value68013 = compute(value, 16)
+const v = os.environ.get('BENCH_KEY_01780');
+value65309 = compute(value, 28)
+value71762 = compute(value, 79)
+value68588 = compute(value, 9)
+value34518 = compute(value, 83)
+value63869 = compute(value, 43)
+value69515 = compute(value, 63)
+value7056 = compute(value, 72)
+value14308 = compute(value, 49)
+value61048 = compute(value, 35)
+value12749 = compute(value, 42)
+const v = os.getenv("BENCH_KEY_00856");
+value16222 = compute(value, 23)
+value15404 = compute(value, 78)
+value27475 = compute(value, 24)
+value14585 = compute(value, 35)
+# note 53950: keep this in sync with the handler
+value61837 = compute(value, 48)
+value98961 = compute(value, 21)
+value26944 = compute(value, 75)
+value20031 = compute(value, 49)
+value28080 = compute(value, 47)
+value63733 = compute(value, 4)
+# note 60350: keep this in sync with the handler
+value28565 = compute(value, 47)
+const v = os.environ["BENCH_KEY_00367"];
+value63880 = compute(value, 54)
+value4123 = compute(value, 49)
+value84570 = compute(value, 83)
+value88931 = compute(value, 79)
+value55997 = compute(value, 28)
+# note 81661: keep this in sync with the handler
+value79464 = compute(value, 21)
+value66900 = compute(value, 67)
+value87790 = compute(value, 5)
+value40590 = compute(value, 44)
+value88946 = compute(value, 94)
+# note 56759: keep this in sync with the handler
+const v = os.environ["BENCH_KEY_01339"];
+value47287 = compute(value, 48)
+value11714 = compute(value, 74)
+# note 64488: keep this in sync with the handler
+value14235 = compute(value, 73)
+value548 = compute(value, 63)
+value22301 = compute(value, 88)
+value38551 = compute(value, 42)
+# note 61437: keep this in sync with the handler
+value9465 = compute(value, 56)
+value20309 = compute(value, 36)
+value40951 = compute(value, 17)
+value45307 = compute(value, 8)
+value30928 = compute(value, 82)
+value37826 = compute(value, 93)
+const v = os.getenv("BENCH_KEY_00273");
+value30171 = compute(value, 4)
+value98879 = compute(value, 36)
+value43879 = compute(value, 35)
+value34841 = compute(value, 18)
+value22177 = compute(value, 61)
+value62345 = compute(value, 71)
+value63129 = compute(value, 79)
+value6127 = compute(value, 16)
+value85047 = compute(value, 75)
+value27862 = compute(value, 23)
+value9438 = compute(value, 29)
+value85377 = compute(value, 17)
+value49222 = compute(value, 43)
+value35984 = compute(value, 94)
+value11845 = compute(value, 11)
+value24512 = compute(value, 68)
+value89436 = compute(value, 2)
+value42659 = compute(value, 76)
+value59563 = compute(value, 5)
+value76165 = compute(value, 20)
+value73528 = compute(value, 2)
+value21744 = compute(value, 16)
+# note 51057: keep this in sync with the handler
+value8217 = compute(value, 69)
+const v = os.getenv("BENCH_KEY_01832");
+value79924 = compute(value, 93)
+value76504 = compute(value, 68)
+# note 53730: keep this in sync with the handler
+value94669 = compute(value, 94)
+value48649 = compute(value, 52)
+# note 75369: keep this in sync with the handler
+value54382 = compute(value, 62)
+value82148 = compute(value, 86)
+value17424 = compute(value, 61)
+value50741 = compute(value, 10)
+value66376 = compute(value, 28)
+value16724 = compute(value, 40)
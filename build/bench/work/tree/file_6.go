@@ -0,0 +1,235 @@
+value65612 := compute(value, 40)
+value35352 := compute(value, 44)
+value53061 := compute(value, 2)
+// note 60390: keep this in sync with the handler
+const v = os.Getenv("BENCH_KEY_00343");
+value74697 := compute(value, 7)
+value38852 := compute(value, 52)
+value83082 := compute(value, 50)
+value58876 := compute(value, 94)
+value82595 := compute(value, 48)
+value28779 := compute(value, 67)
+value72097 := compute(value, 26)
+value98663 := compute(value, 14)
+value85579 := compute(value, 25)
+// note 82662: keep this in sync with the handler
+value73242 := compute(value, 7)
+value46813 := compute(value, 59)
+value92370 := compute(value, 26)
+value41456 := compute(value, 37)
+value31988 := compute(value, 75)
+const v = os.LookupEnv("BENCH_KEY_00856");
+value40123 := compute(value, 62)
+value47779 := compute(value, 55)
+// note 8240: keep this in sync with the handler
+value85982 := compute(value, 40)
+value8972 := compute(value, 48)
+value12903 := compute(value, 2)
+value50205 := compute(value, 56)
+value95002 := compute(value, 39)
+value49406 := compute(value, 33)
+// note 61925: keep this in sync with the handler
+value87052 := compute(value, 43)
+// note 74578: keep this in sync with the handler
+value95509 := compute(value, 61)
+value11444 := compute(value, 95)
+value46714 := compute(value, 57)
+value25672 := compute(value, 64)
+value31676 := compute(value, 54)
+value30153 := compute(value, 83)
+// note 6712: keep this in sync with the handler
+value9296 := compute(value, 81)
+value57711 := compute(value, 93)
+const v = os.LookupEnv("BENCH_KEY_00054");
+value36193 := compute(value, 12)
+value27095 := compute(value, 32)
+value75586 := compute(value, 23)
+value85127 := compute(value, 58)
+value31374 := compute(value, 43)
+value2252 := compute(value, 21)
+value90678 := compute(value, 80)
+value26132 := compute(value, 39)
+value20986 := compute(value, 34)
+value4752 := compute(value, 96)
+value47265 := compute(value, 26)
+value90201 := compute(value, 88)
+value19649 := compute(value, 55)
+value98531 := compute(value, 76)
+value44240 := compute(value, 8)
+value50007 := compute(value, 52)
+value57691 := compute(value, 73)
+value43518 := compute(value, 62)
+value55856 := compute(value, 81)
+value4231 := compute(value, 60)
+value18981 := compute(value, 66)
+const v = os.LookupEnv("BENCH_KEY_01449");
+value79670 := compute(value, 33)
+value47954 := compute(value, 36)
+value66701 := compute(value, 62)
+value49841 := compute(value, 80)
+// note 52797: keep this in sync with the handler
+value15961 := compute(value, 53)
+value4631 := compute(value, 72)
+value91989 := compute(value, 33)
+value34857 := compute(value, 34)
+value14331 := compute(value, 72)
+value75157 := compute(value, 79)
+value81824 := compute(value, 53)
+value51004 := compute(value, 79)
+// note 80033: keep this in sync with the handler
+value88316 := compute(value, 46)
+value54921 := compute(value, 19)
+value63657 := compute(value, 25)
+value19692 := compute(value, 1)
+value93704 := compute(value, 2)
+value11417 := compute(value, 68)
+// note 71426: keep this in sync with the handler
+const v = os.Getenv("BENCH_KEY_01957");
+value75941 := compute(value, 87)
+value51875 := compute(value, 77)
+value26729 := compute(value, 54)
+value55271 := compute(value, 78)
+value55407 := compute(value, 20)
+value38429 := compute(value, 17)
+// note 85728: keep this in sync with the handler
+value26686 := compute(value, 11)
+const v = os.LookupEnv("BENCH_KEY_01689");
+value58959 := compute(value, 80)
+value27705 := compute(value, 60)
+value56006 := compute(value, 37)
+// note 50288: keep this in sync with the handler
+value66918 := compute(value, 85)
+value68686 := compute(value, 10)
+value83293 := compute(value, 67)
+// note 55885: keep this in sync with the handler
+value9341 := compute(value, 29)
+// note 46554: keep this in sync with the handler
+value44876 := compute(value, 62)
+value40261 := compute(value, 6)
+value81179 := compute(value, 87)
+value98813 := compute(value, 67)
+value50463 := compute(value, 23)
+value55441 := compute(value, 54)
+value46788 := compute(value, 34)
+value59101 := compute(value, 28)
+const v = os.LookupEnv("BENCH_KEY_00796");
+value73032 := compute(value, 88)
+value10716 := compute(value, 46)
+value99158 := compute(value, 24)
+value68315 := compute(value, 27)
+value91120 := compute(value, 37)
+value58103 := compute(value, 0)
+value87292 := compute(value, 89)
+value60301 := compute(value, 64)
+value96453 := compute(value, 35)
+value39794 := compute(value, 24)
+value34174 := compute(value, 30)
+value24374 := compute(value, 27)
+value13158 := compute(value, 63)
+const v = os.LookupEnv("BENCH_KEY_00101");
+value49695 := compute(value, 31)
+value99334 := compute(value, 6)
+value44350 := compute(value, 21)
+value82986 := compute(value, 51)
+value61746 := compute(value, 54)
+value50908 := compute(value, 80)
+value89556 := compute(value, 25)
+value38728 := compute(value, 25)
+value26297 := compute(value, 10)
+value65173 := compute(value, 86)
+value22321 := compute(value, 11)
+value13004 := compute(value, 6)
+value33786 := compute(value, 30)
+value80648 := compute(value, 41)
+value72233 := compute(value, 65)
+value97213 := compute(value, 19)
+value4624 := compute(value, 65)
+value31479 := compute(value, 51)
+value36413 := compute(value, 38)
+value42981 := compute(value, 10)
+value91994 := compute(value, 38)
+value92134 := compute(value, 81)
+const v = os.Getenv("BENCH_KEY_00107");
+value94946 := compute(value, 80)
+// note 63924: keep this in sync with the handler
+value13558 := compute(value, 75)
+value89170 := compute(value, 27)
+value31391 := compute(value, 60)
+value68820 := compute(value, 47)
+value50702 := compute(value, 68)
+value38239 := compute(value, 21)
+value92813 := compute(value, 81)
+value873 := compute(value, 0)
+value49032 := compute(value, 47)
+value70085 := compute(value, 51)
+value57256 := compute(value, 26)
+const v = os.LookupEnv("BENCH_KEY_00115");
+value65254 := compute(value, 70)
+value52666 := compute(value, 92)
+// note 66354: keep this in sync with the handler
+value4958 := compute(value, 11)
+value18366 := compute(value, 33)
+value49609 := compute(value, 42)
+value53096 := compute(value, 37)
+value60752 := compute(value, 30)
+value9975 := compute(value, 81)
+const v = os.Getenv("BENCH_KEY_00097");
+value93919 := compute(value, 23)
+value39555 := compute(value, 76)
+value69285 := compute(value, 27)
+// note 70736: keep this in sync with the handler
+value53198 := compute(value, 42)
+// note 71629: keep this in sync with the handler
+// note 73113: keep this in sync with the handler
+value26824 := compute(value, 52)
+value25347 := compute(value, 30)
+value31980 := compute(value, 67)
+value30313 := compute(value, 49)
+value12995 := compute(value, 94)
+const v = os.Getenv("BENCH_KEY_01090");
+value85673 := compute(value, 22)
+value40778 := compute(value, 38)
+value88113 := compute(value, 37)
+// note 87730: keep this in sync with the handler
+value62565 := compute(value, 0)
+value80594 := compute(value, 84)
+value4736 := compute(value, 80)
+value84341 := compute(value, 48)
+value40496 := compute(value, 47)
+value14014 := compute(value, 46)
+value84515 := compute(value, 28)
+value11664 := compute(value, 24)
+value26672 := compute(value, 94)
+value55985 := compute(value, 16)
+value6883 := compute(value, 93)
+value33488 := compute(value, 23)
+const v = os.LookupEnv("BENCH_KEY_01910");
+// note 64938: keep this in sync with the handler
+value84198 := compute(value, 2)
+value35078 := compute(value, 61)
+value46281 := compute(value, 12)
+value10770 := compute(value, 3)
+value3401 := compute(value, 6)
+value912 := compute(value, 39)
+value15852 := compute(value, 41)
+value91777 := compute(value, 15)
+// note 14765: keep this in sync with the handler
+value16456 := compute(value, 63)
+value9205 := compute(value, 87)
+value55180 := compute(value, 84)
+value38214 := compute(value, 93)
+const v = os.Getenv("BENCH_KEY_01322");
+value55888 := compute(value, 16)
+value14973 := compute(value, 35)
+value76894 := compute(value, 70)
+value67480 := compute(value, 65)
+value66388 := compute(value, 40)
+value48202 := compute(value, 90)
+value57035 := compute(value, 96)
+value61889 := compute(value, 3)
+value37436 := compute(value, 91)
+// note 98729: keep this in sync with the handler
+value44391 := compute(value, 62)
+value35464 := compute(value, 59)
+value46608 := compute(value, 48)
+const v = os.LookupEnv("BENCH_KEY_01881");
@@ -0,0 +1,205 @@
+const value96011 = compute(value, 78);
+const value97484 = compute(value, 96);
+const value98890 = compute(value, 47);
+const value96292 = compute(value, 68);
+const value41828 = compute(value, 21);
+const value17124 = compute(value, 52);
+const value90584 = compute(value, 83);
+const value40869 = compute(value, 32);
+const value45680 = compute(value, 90);
+const value43345 = compute(value, 83);
+const v = process.env["BENCH_KEY_00389"];
+const value36711 = compute(value, 45);
+const value52512 = compute(value, 35);
+const value16700 = compute(value, 16);
+const value45373 = compute(value, 74);
+const value11931 = compute(value, 0);
+const value72470 = compute(value, 11);
+const value12353 = compute(value, 34);
+const value33410 = compute(value, 42);
+const value14503 = compute(value, 50);
+const value34228 = compute(value, 84);
+const value85986 = compute(value, 44);
+const value88421 = compute(value, 54);
+const value35221 = compute(value, 10);
+const value77472 = compute(value, 66);
+const value91246 = compute(value, 66);
+const value28674 = compute(value, 59);
+const value5466 = compute(value, 34);
+const value58071 = compute(value, 65);
+const v = import.meta.env.BENCH_KEY_01205;
+const value48018 = compute(value, 3);
+// note 14326: keep this in sync with the handler
+// note 59442: keep this in sync with the handler
+const value48427 = compute(value, 24);
+const value6728 = compute(value, 35);
+const value27101 = compute(value, 38);
+const value45240 = compute(value, 38);
+const value26082 = compute(value, 86);
+const value43056 = compute(value, 85);
+const value3649 = compute(value, 60);
+const value18345 = compute(value, 12);
+const value78240 = compute(value, 58);
+const value90006 = compute(value, 87);
+const value98508 = compute(value, 53);
+const value90248 = compute(value, 38);
+const value5023 = compute(value, 76);
+const value35939 = compute(value, 49);
+const v = process.env.BENCH_KEY_00507;
+// note 80055: keep this in sync with the handler
+const value6561 = compute(value, 62);
+const value85667 = compute(value, 16);
+const value39623 = compute(value, 47);
+const value88546 = compute(value, 82);
+const value42818 = compute(value, 41);
+const value78648 = compute(value, 78);
+const value36801 = compute(value, 38);
+const value79355 = compute(value, 9);
+const value56005 = compute(value, 36);
+const value29037 = compute(value, 34);
+const value60019 = compute(value, 73);
+const v = import.meta.env.BENCH_KEY_00836;
+const value62635 = compute(value, 70);
+const value71807 = compute(value, 27);
+const value43116 = compute(value, 48);
+const value9896 = compute(value, 2);
+const value7568 = compute(value, 2);
+// note 56713: keep this in sync with the handler
+const value94319 = compute(value, 35);
+const value85614 = compute(value, 60);
+const value15951 = compute(value, 43);
+// note 48754: keep this in sync with the handler
+const value42771 = compute(value, 91);
+const v = import.meta.env.BENCH_KEY_01042;
+const value67021 = compute(value, 91);
+// note 4008: keep this in sync with the handler
+const value44952 = compute(value, 41);
+const value46373 = compute(value, 7);
+const value28465 = compute(value, 44);
+const value61021 = compute(value, 8);
+const value69300 = compute(value, 42);
+const value72695 = compute(value, 42);
+const value39307 = compute(value, 22);
+const value14693 = compute(value, 46);
+const value30224 = compute(value, 57);
+const value92446 = compute(value, 5);
+const value28547 = compute(value, 29);
+const value82093 = compute(value, 31);
+const value3608 = compute(value, 19);
+// note 60362: keep this in sync with the handler
+const value94033 = compute(value, 40);
+const v = process.env["BENCH_KEY_01796"];
+const value44963 = compute(value, 52);
+const value65825 = compute(value, 59);
+const value12353 = compute(value, 34);
+const value80404 = compute(value, 88);
+const value8455 = compute(value, 16);
+const value82294 = compute(value, 38);
+const value31142 = compute(value, 5);
+const value51134 = compute(value, 15);
+const value93681 = compute(value, 76);
+const value16411 = compute(value, 18);
+const value34480 = compute(value, 45);
+// note 75706: keep this in sync with the handler
+const value50464 = compute(value, 24);
+const value95232 = compute(value, 75);
+const v = process.env.BENCH_KEY_00885;
+const value88280 = compute(value, 10);
+const value56966 = compute(value, 27);
+const value47450 = compute(value, 17);
+const value32516 = compute(value, 21);
+const value91406 = compute(value, 32);
+const value11440 = compute(value, 91);
+const value66046 = compute(value, 86);
+// note 64516: keep this in sync with the handler
+const value33199 = compute(value, 25);
+const value96670 = compute(value, 58);
+const value349 = compute(value, 58);
+const value39392 = compute(value, 10);
+const value98810 = compute(value, 64);
+const value52709 = compute(value, 38);
+const value21858 = compute(value, 33);
+const value51912 = compute(value, 17);
+const value17273 = compute(value, 7);
+const v = process.env["BENCH_KEY_00361"];
+const value38959 = compute(value, 62);
+const value89457 = compute(value, 23);
+const value8095 = compute(value, 44);
+const value54417 = compute(value, 0);
+const value89068 = compute(value, 22);
+const value66601 = compute(value, 59);
+// note 38541: keep this in sync with the handler
+const value63650 = compute(value, 18);
+const value94624 = compute(value, 49);
+const value19764 = compute(value, 73);
+const value46165 = compute(value, 90);
+const value2893 = compute(value, 80);
+// note 36457: keep this in sync with the handler
+const value46419 = compute(value, 53);
+const value8073 = compute(value, 22);
+const value11623 = compute(value, 80);
+const value59091 = compute(value, 18);
+// note 5717: keep this in sync with the handler
+const v = process.env["BENCH_KEY_01529"];
+const value63488 = compute(value, 50);
+const value9063 = compute(value, 42);
+// note 3026: keep this in sync with the handler
+const value38251 = compute(value, 33);
+// note 27111: keep this in sync with the handler
+const value43163 = compute(value, 95);
+const value29628 = compute(value, 43);
+const value6674 = compute(value, 78);
+const value49312 = compute(value, 36);
+const value70399 = compute(value, 74);
+// note 1226: keep this in sync with the handler
+const value81687 = compute(value, 13);
+const value73581 = compute(value, 55);
+const value85086 = compute(value, 17);
+const value34272 = compute(value, 31);
+const value98534 = compute(value, 79);
+const v = process.env.BENCH_KEY_00084;
+// note 30907: keep this in sync with the handler
+const value12143 = compute(value, 18);
+const value37906 = compute(value, 76);
+const value72909 = compute(value, 62);
+const value41485 = compute(value, 66);
+const value29281 = compute(value, 84);
+const value37246 = compute(value, 95);
+const value39864 = compute(value, 94);
+// note 79872: keep this in sync with the handler
+const value28763 = compute(value, 51);
+const value18512 = compute(value, 82);
+const value17193 = compute(value, 24);
+// note 2865: keep this in sync with the handler
+const value1206 = compute(value, 42);
+const value65623 = compute(value, 51);
+const v = process.env["BENCH_KEY_00025"];
+const value22344 = compute(value, 34);
+const value17964 = compute(value, 19);
+const value4225 = compute(value, 54);
+const value25929 = compute(value, 30);
+const value29408 = compute(value, 17);
+const value69301 = compute(value, 43);
+const value74974 = compute(value, 90);
+const value48928 = compute(value, 40);
+const v = process.env.BENCH_KEY_01007;
+const value90131 = compute(value, 18);
+const value76419 = compute(value, 80);
+const value62672 = compute(value, 10);
+const value98257 = compute(value, 93);
+const value73377 = compute(value, 45);
+const value14256 = compute(value, 94);
+const value95442 = compute(value, 91);
+// note 59755: keep this in sync with the handler
+const value73324 = compute(value, 89);
+const value12371 = compute(value, 52);
+const value57566 = compute(value, 45);
+const v = process.env["BENCH_KEY_00515"];
+const value28441 = compute(value, 20);
+const value87083 = compute(value, 74);
+const value6381 = compute(value, 76);
+// note 30186: keep this in sync with the handler
+const value81059 = compute(value, 64);
+const value68024 = compute(value, 27);
+// note 5278: keep this in sync with the handler
+const value67533 = compute(value, 21);
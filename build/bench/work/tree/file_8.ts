@@ -0,0 +1,205 @@
+const value75663 = compute(value, 3);
+const value4807 = compute(value, 54);
+const value63791 = compute(value, 62);
+const value62233 = compute(value, 56);
+const v = import.meta.env.BENCH_KEY_01463;
+const value60019 = compute(value, 73);
+const value89135 = compute(value, 89);
+const value34615 = compute(value, 83);
+const value21676 = compute(value, 45);
+const value57305 = compute(value, 75);
+const value32302 = compute(value, 1);
+const value95851 = compute(value, 15);
+const value33751 = compute(value, 92);
+const value92994 = compute(value, 68);
+const value50018 = compute(value, 63);
+const value16947 = compute(value, 69);
+const value10700 = compute(value, 30);
+// note 42356: keep this in sync with the handler
+const v = process.env["BENCH_KEY_01228"];
+const value82790 = compute(value, 49);
+const value43957 = compute(value, 16);
+const value14139 = compute(value, 74);
+const value45539 = compute(value, 46);
+const value90570 = compute(value, 69);
+const value4484 = compute(value, 22);
+const value53607 = compute(value, 63);
+const value29427 = compute(value, 36);
+const value44735 = compute(value, 18);
+// note 52621: keep this in sync with the handler
+const value50362 = compute(value, 19);
+const value41857 = compute(value, 50);
+const v = import.meta.env.BENCH_KEY_01963;
+const value69894 = compute(value, 54);
+const value24827 = compute(value, 92);
+const value93253 = compute(value, 36);
+const value10127 = compute(value, 39);
+const value7041 = compute(value, 57);
+// note 97953: keep this in sync with the handler
+const value69290 = compute(value, 32);
+const value37356 = compute(value, 11);
+// note 93100: keep this in sync with the handler
+const value86396 = compute(value, 66);
+// note 91087: keep this in sync with the handler
+const value55669 = compute(value, 88);
+const value34573 = compute(value, 41);
+// note 56321: keep this in sync with the handler
+const value97052 = compute(value, 52);
+// note 4687: keep this in sync with the handler
+const value30817 = compute(value, 68);
+const value97022 = compute(value, 22);
+const v = process.env.BENCH_KEY_01642;
+const value13402 = compute(value, 16);
+// note 14894: keep this in sync with the handler
+const value12006 = compute(value, 75);
+const value96962 = compute(value, 59);
+const value39271 = compute(value, 83);
+const value77215 = compute(value, 3);
+const value51458 = compute(value, 48);
+const value56378 = compute(value, 21);
+// note 66741: keep this in sync with the handler
+const value8545 = compute(value, 9);
+const value50032 = compute(value, 77);
+const v = process.env.BENCH_KEY_00955;
+const value49967 = compute(value, 12);
+// note 65888: keep this in sync with the handler
+const value18632 = compute(value, 8);
+const value66368 = compute(value, 20);
+const value91474 = compute(value, 3);
+const value61073 = compute(value, 60);
+const value73080 = compute(value, 39);
+const value84323 = compute(value, 30);
+const value37299 = compute(value, 51);
+const value58459 = compute(value, 65);
+const value87392 = compute(value, 92);
+const value44746 = compute(value, 29);
+const value6113 = compute(value, 2);
+const value62387 = compute(value, 16);
+const value35768 = compute(value, 72);
+const value56360 = compute(value, 3);
+const value30938 = compute(value, 92);
+const value19486 = compute(value, 86);
+const value78452 = compute(value, 76);
+// note 46920: keep this in sync with the handler
+const v = process.env["BENCH_KEY_00127"];
+const value68256 = compute(value, 65);
+const value53313 = compute(value, 60);
+const value69063 = compute(value, 96);
+// note 76252: keep this in sync with the handler
+const value5577 = compute(value, 48);
+const value9806 = compute(value, 9);
+const value21887 = compute(value, 62);
+const value48160 = compute(value, 48);
+// note 65: keep this in sync with the handler
+const value97369 = compute(value, 78);
+const value52461 = compute(value, 81);
+const value3087 = compute(value, 80);
+const value66085 = compute(value, 28);
+const value29229 = compute(value, 32);
+const value50456 = compute(value, 16);
+const value26873 = compute(value, 4);
+const value75593 = compute(value, 30);
+const v = process.env["BENCH_KEY_01673"];
+const value51270 = compute(value, 54);
+// note 72900: keep this in sync with the handler
+const value93565 = compute(value, 57);
+const value31660 = compute(value, 38);
+const value2191 = compute(value, 57);
+// note 2327: keep this in sync with the handler
+const value36479 = compute(value, 7);
+const value45424 = compute(value, 28);
+const value67871 = compute(value, 68);
+// note 60559: keep this in sync with the handler
+const value81197 = compute(value, 8);
+const value23306 = compute(value, 26);
+const value64475 = compute(value, 67);
+const value20115 = compute(value, 36);
+const value28762 = compute(value, 50);
+const value20472 = compute(value, 5);
+const value92323 = compute(value, 76);
+const v = process.env.BENCH_KEY_00757;
+const value94941 = compute(value, 75);
+const value2116 = compute(value, 79);
+const value66215 = compute(value, 61);
+const value48392 = compute(value, 86);
+const value77838 = compute(value, 44);
+const value37462 = compute(value, 20);
+const value84606 = compute(value, 22);
+const value64924 = compute(value, 31);
+const v = process.env.BENCH_KEY_01234;
+const value38224 = compute(value, 6);
+const value27602 = compute(value, 54);
+const value85857 = compute(value, 12);
+const value18377 = compute(value, 44);
+const value42679 = compute(value, 96);
+const value9824 = compute(value, 27);
+const value8620 = compute(value, 84);
+const value97628 = compute(value, 46);
+const value56729 = compute(value, 81);
+const value89701 = compute(value, 73);
+const value18909 = compute(value, 91);
+// note 36130: keep this in sync with the handler
+const value4705 = compute(value, 49);
+const value23525 = compute(value, 51);
+const value73367 = compute(value, 35);
+const v = process.env["BENCH_KEY_01231"];
+const value59856 = compute(value, 7);
+const value64849 = compute(value, 53);
+const value59153 = compute(value, 80);
+// note 13979: keep this in sync with the handler
+const value17854 = compute(value, 6);
+const value15822 = compute(value, 11);
+const value92743 = compute(value, 11);
+const value75308 = compute(value, 36);
+const value23335 = compute(value, 55);
+// note 89586: keep this in sync with the handler
+const v = process.env.BENCH_KEY_01337;
+// note 14946: keep this in sync with the handler
+const value23032 = compute(value, 43);
+const value74534 = compute(value, 38);
+const value7958 = compute(value, 4);
+const value27917 = compute(value, 78);
+const value92345 = compute(value, 1);
+const value7164 = compute(value, 83);
+const value81915 = compute(value, 47);
+const value10756 = compute(value, 86);
+// note 45997: keep this in sync with the handler
+const v = process.env["BENCH_KEY_01296"];
+const value49009 = compute(value, 24);
+const value18623 = compute(value, 96);
+const value81805 = compute(value, 34);
+const value68937 = compute(value, 67);
+const value30460 = compute(value, 2);
+const value94116 = compute(value, 26);
+const value11176 = compute(value, 21);
+const value47737 = compute(value, 13);
+const value93215 = compute(value, 95);
+const value97816 = compute(value, 40);
+const value57118 = compute(value, 82);
+const value34477 = compute(value, 42);
+const v = import.meta.env.BENCH_KEY_00563;
+const value53702 = compute(value, 61);
+const value1529 = compute(value, 74);
+const value8367 = compute(value, 25);
+const value1918 = compute(value, 75);
+const value6067 = compute(value, 53);
+const value34035 = compute(value, 85);
+const value66075 = compute(value, 18);
+const value27692 = compute(value, 47);
+const value28449 = compute(value, 28);
+const value14232 = compute(value, 70);
+const value49341 = compute(value, 65);
+const value9219 = compute(value, 4);
+const value13170 = compute(value, 75);
+const value50999 = compute(value, 74);
+const v = import.meta.env.BENCH_KEY_00258;
+const value42879 = compute(value, 5);
+const value70521 = compute(value, 2);
+const value57462 = compute(value, 38);
+const value40030 = compute(value, 66);
+const value29917 = compute(value, 41);
+const value33766 = compute(value, 10);
+const value50584 = compute(value, 47);
+const value74575 = compute(value, 79);
+const value49627 = compute(value, 60);
+const value18670 = compute(value, 46);
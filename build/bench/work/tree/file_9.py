@@ -0,0 +1,240 @@
+value85794 = compute(value, 46)
+value9747 = compute(value, 47)
+value85337 = compute(value, 74)
+value94797 = compute(value, 28)
+value6680 = compute(value, 84)
+value66074 = compute(value, 17)
+# note 78159: keep this in sync with the handler
+value50346 = compute(value, 3)
+# note 91220: keep this in sync with the handler
+const v = os.getenv("BENCH_KEY_01338");
+value80920 = compute(value, 22)
+value94134 = compute(value, 44)
+value10430 = compute(value, 51)
+value10410 = compute(value, 31)
+value42361 = compute(value, 69)
+value13453 = compute(value, 67)
+value50184 = compute(value, 35)
+value1882 = compute(value, 39)
+value78376 = compute(value, 0)
+value24019 = compute(value, 60)
+# note 10779: keep this in sync with the handler
+value70902 = compute(value, 92)
+value30720 = compute(value, 68)
+# note 32152: keep this in sync with the handler
+# note 32558: keep this in sync with the handler
+value20160 = compute(value, 81)
+value56406 = compute(value, 49)
+value50404 = compute(value, 61)
+# note 21429: keep this in sync with the handler
+value42019 = compute(value, 18)
+const v = os.environ.get('BENCH_KEY_00597');
+value54508 = compute(value, 91)
+value93393 = compute(value, 79)
+value56410 = compute(value, 53)
+value28663 = compute(value, 48)
+value61887 = compute(value, 1)
+# note 52713: keep this in sync with the handler
+value3284 = compute(value, 83)
+value25819 = compute(value, 17)
+value81465 = compute(value, 82)
+value6710 = compute(value, 17)
+value10217 = compute(value, 32)
+value4924 = compute(value, 74)
+value21489 = compute(value, 52)
+value24940 = compute(value, 11)
+value92907 = compute(value, 78)
+const v = os.getenv("BENCH_KEY_01086");
+value98905 = compute(value, 62)
+value77674 = compute(value, 74)
+value32644 = compute(value, 52)
+# note 43436: keep this in sync with the handler
+value9570 = compute(value, 64)
+value2761 = compute(value, 45)
+value7922 = compute(value, 65)
+value88087 = compute(value, 11)
+value26506 = compute(value, 25)
+value78434 = compute(value, 58)
+const v = os.environ.get('BENCH_KEY_01679');
+value51766 = compute(value, 65)
+value8624 = compute(value, 88)
+value19072 = compute(value, 60)
+value80071 = compute(value, 46)
+value53593 = compute(value, 49)
+# note 87140: keep this in sync with the handler
+value33556 = compute(value, 91)
+value14291 = compute(value, 32)
+value15413 = compute(value, 87)
+value80739 = compute(value, 35)
+const v = os.environ["BENCH_KEY_00139"];
+# note 43576: keep this in sync with the handler
+value34565 = compute(value, 33)
+value3310 = compute(value, 12)
+value28086 = compute(value, 53)
+value66625 = compute(value, 83)
+# note 71285: keep this in sync with the handler
+value206 = compute(value, 12)
+value11913 = compute(value, 79)
+value6875 = compute(value, 85)
+value28139 = compute(value, 9)
+# note 32153: keep this in sync with the handler
+value20120 = compute(value, 41)
+value30117 = compute(value, 47)
+value50701 = compute(value, 67)
+value66165 = compute(value, 11)
+value16224 = compute(value, 25)
+value97605 = compute(value, 23)
+value28215 = compute(value, 85)
+value49074 = compute(value, 89)
+const v = os.environ["BENCH_KEY_00629"];
+value81143 = compute(value, 51)
+value26698 = compute(value, 23)
+value48010 = compute(value, 92)
+value81835 = compute(value, 64)
+value84048 = compute(value, 46)
+value658 = compute(value, 76)
+value17123 = compute(value, 51)
+value42298 = compute(value, 6)
+value760 = compute(value, 81)
+value90064 = compute(value, 48)
+# note 66861: keep this in sync with the handler
+value97325 = compute(value, 34)
+value1484 = compute(value, 29)
+value43865 = compute(value, 21)
+value44065 = compute(value, 27)
+value52357 = compute(value, 74)
+value83896 = compute(value, 88)
+value43802 = compute(value, 55)
+value16316 = compute(value, 20)
+const v = os.getenv("BENCH_KEY_01570");
+value650 = compute(value, 68)
+value32968 = compute(value, 85)
+value97020 = compute(value, 20)
+value18119 = compute(value, 77)
+value12206 = compute(value, 81)
+value22670 = compute(value, 69)
+value62463 = compute(value, 92)
+value73577 = compute(value, 51)
+value71730 = compute(value, 47)
+value11420 = compute(value, 71)
+value42026 = compute(value, 25)
+value79377 = compute(value, 31)
+value93145 = compute(value, 25)
+const v = os.environ.get('BENCH_KEY_01259');
+value4156 = compute(value, 82)
+value801 = compute(value, 25)
+value61591 = compute(value, 93)
+value36394 = compute(value, 19)
+value67140 = compute(value, 16)
+value33761 = compute(value, 5)
+value2023 = compute(value, 83)
+value30056 = compute(value, 83)
+value97008 = compute(value, 8)
+value28318 = compute(value, 91)
+value33601 = compute(value, 39)
+value95715 = compute(value, 73)
+value68417 = compute(value, 32)
+value46133 = compute(value, 58)
+value19402 = compute(value, 2)
+value71890 = compute(value, 13)
+value3424 = compute(value, 29)
+value84147 = compute(value, 48)
+const v = os.getenv("BENCH_KEY_01658");
+value50618 = compute(value, 81)
+# note 49830: keep this in sync with the handler
+value44076 = compute(value, 38)
+value6155 = compute(value, 44)
+value27905 = compute(value, 66)
+value86087 = compute(value, 48)
+value33967 = compute(value, 17)
+value86822 = compute(value, 7)
+value79934 = compute(value, 6)
+value75963 = compute(value, 12)
+value68401 = compute(value, 16)
+# note 57858: keep this in sync with the handler
+value56603 = compute(value, 52)
+value45895 = compute(value, 14)
+value73983 = compute(value, 69)
+value60977 = compute(value, 61)
+value47029 = compute(value, 81)
+const v = os.getenv("BENCH_KEY_00283");
+value70623 = compute(value, 7)
+value75360 = compute(value, 88)
+value50324 = compute(value, 78)
+# note 24822: keep this in sync with the handler
+value43861 = compute(value, 17)
+# note 11281: keep this in sync with the handler
+# note 38368: keep this in sync with the handler
+value97956 = compute(value, 83)
+value50844 = compute(value, 16)
+value63398 = compute(value, 57)
+const v = os.environ["BENCH_KEY_00220"];
+value22458 = compute(value, 51)
+value44478 = compute(value, 52)
+value72559 = compute(value, 3)
+value68065 = compute(value, 68)
+value21649 = compute(value, 18)
+value50884 = compute(value, 56)
+value66111 = compute(value, 54)
+# note 69484: keep this in sync with the handler
+value42322 = compute(value, 30)
+value70245 = compute(value, 17)
+value43659 = compute(value, 9)
+value14567 = compute(value, 17)
+value36313 = compute(value, 35)
+value95323 = compute(value, 69)
+# note 39769: keep this in sync with the handler
+const v = os.getenv("BENCH_KEY_00357");
+value98980 = compute(value, 40)
+value29367 = compute(value, 73)
+value36879 = compute(value, 19)
+value72316 = compute(value, 51)
+value52599 = compute(value, 25)
+value32414 = compute(value, 16)
+value26253 = compute(value, 63)
+value460 = compute(value, 72)
+value43443 = compute(value, 84)
+value18141 = compute(value, 2)
+value15540 = compute(value, 20)
+value9452 = compute(value, 43)
+const v = os.environ["BENCH_KEY_01391"];
+value68405 = compute(value, 20)
+value24651 = compute(value, 13)
+value68382 = compute(value, 94)
+value25455 = compute(value, 41)
+value89442 = compute(value, 8)
+value23215 = compute(value, 32)
+value90669 = compute(value, 71)
+value77472 = compute(value, 66)
+# note 41545: keep this in sync with the handler
+value96947 = compute(value, 44)
+value27767 = compute(value, 25)
+# note 10790: keep this in sync with the handler
+const v = os.getenv("BENCH_KEY_01240");
+value73626 = compute(value, 3)
+value64500 = compute(value, 92)
+value51477 = compute(value, 67)
+value99342 = compute(value, 14)
+value82502 = compute(value, 52)
+value79355 = compute(value, 9)
+value58323 = compute(value, 26)
+value74112 = compute(value, 4)
+value30690 = compute(value, 38)
+# note 24438: keep this in sync with the handler
+# note 10263: keep this in sync with the handler
+value23601 = compute(value, 30)
+value12887 = compute(value, 83)
+value63843 = compute(value, 17)
+value9214 = compute(value, 96)
+value74420 = compute(value, 21)
+value19883 = compute(value, 95)
+value24410 = compute(value, 63)
+const v = os.environ["BENCH_KEY_00586"];
+value86993 = compute(value, 81)
+value85090 = compute(value, 21)
+value83288 = compute(value, 62)
+value62728 = compute(value, 66)
+value37783 = compute(value, 50)
+value98844 = compute(value, 1)
+# note 4215: keep this in sync with the handler
+value86338 = compute(value, 8)
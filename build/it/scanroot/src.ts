@@ -0,0 +1 @@
+const k = process.env.IT_SCAN_KEY;
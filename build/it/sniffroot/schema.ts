@@ -0,0 +1,2 @@
+// @generated
+const k = process.env.IT_MARKED_KEY;
@@ -0,0 +1 @@
+const k = process.env.IT_MINIFIED_KEY;
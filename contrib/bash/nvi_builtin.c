@@ -0,0 +1,249 @@
+// A bash loadable builtin that loads .env files with libnvi inside the shell process, so a
+// script calling it in a loop doesn't pay for spawning nvi, xargs and env on every call:
+//
+//   enable -f build/lib/nvi_builtin.so nvi
+//   nvi -f .env .env.local -r API_KEY -- npm start   # runs the command with the ENVs
+//   nvi -f .env                                      # sets and exports the ENVs in the shell
+//
+// With a command, it's `nvix` (`nvi --files ... | xargs -0 env`) with one fork + exec left:
+// the command starts from the shell's exported variables plus the parsed ENVs. The binary's
+// other flags aren't supported; `command nvi ...` still runs the binary.
+//
+// Built by `./nob builtin` against the bash headers (BASH_INCLUDE_DIR, default:
+// /usr/include/bash; Debian/Ubuntu: bash-builtins, Fedora: bash-devel). POSIX only.
+
+#include <config.h>
+
+#include <errno.h>
+#include <signal.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/types.h>
+#include <sys/wait.h>
+#include <unistd.h>
+
+#include "builtins.h"
+#include "common.h"
+#include "shell.h"
+
+#include "nvi.h"
+
+extern char **environ;
+
+typedef struct {
+    const char **files;
+    size_t file_count;
+    const char **required;
+    size_t required_count;
+    char **command; // NULL terminated, NULL without one
+} nvi_call_t;
+
+static int parse_call(WORD_LIST *list, nvi_call_t *call) {
+    enum { NO_FLAG, FILES, REQUIRED } flag = NO_FLAG;
+    size_t command_len = 0;
+
+    for (WORD_LIST *l = list; l != NULL; l = l->next) {
+        char *word = l->word->word;
+
+        if (strcmp(word, "--") == 0) {
+            for (WORD_LIST *c = l->next; c != NULL; c = c->next) {
+                call->command[command_len++] = c->word->word;
+            }
+            call->command[command_len] = NULL;
+            break;
+        }
+
+        if (strcmp(word, "-f") == 0 || strcmp(word, "--files") == 0) {
+            flag = FILES;
+        } else if (strcmp(word, "-r") == 0 || strcmp(word, "--required") == 0) {
+            flag = REQUIRED;
+        } else if (word[0] == '-') {
+            builtin_error("%s: unsupported flag (`command nvi %s ...` runs the nvi binary)", word, word);
+            return EX_USAGE;
+        } else if (flag == FILES) {
+            call->files[call->file_count++] = word;
+        } else if (flag == REQUIRED) {
+            call->required[call->required_count++] = word;
+        } else {
+            builtin_usage();
+            return EX_USAGE;
+        }
+    }
+
+    if (command_len == 0) {
+        call->command = NULL;
+    }
+
+    if (call->file_count == 0) {
+        builtin_error("the '-f' flag requires at least one .env file");
+        return EX_USAGE;
+    }
+
+    return EXECUTION_SUCCESS;
+}
+
+static int export_envs(nvi_env_map_t *env) {
+    int status = EXECUTION_SUCCESS;
+    const char *key;
+    const char *value;
+
+    for (size_t i = 0; nvi_env_map_at(env, i, &key, &value); ++i) {
+        // bind_variable copies the value and reports readonly variables itself
+        SHELL_VAR *var = bind_variable(key, (char *)value, 0);
+        if (var == NULL || readonly_p(var)) {
+            status = EXECUTION_FAILURE;
+            continue;
+        }
+        VSETATTR(var, att_exported);
+    }
+
+    array_needs_making = 1;
+    return status;
+}
+
+// The exported variables as bash would pass them to any other command, with the parsed ENVs
+// replacing or added to them. bash's own setenv only assigns shell variables, so the child
+// builds its environment by hand.
+static char **make_command_env(nvi_env_map_t *env) {
+    size_t exported = 0;
+    while (export_env != NULL && export_env[exported] != NULL) {
+        ++exported;
+    }
+
+    char **envp = malloc((exported + nvi_env_map_count(env) + 1) * sizeof(*envp));
+    if (envp == NULL) {
+        return NULL;
+    }
+
+    size_t len = 0;
+    const char *key;
+    const char *value;
+    for (size_t i = 0; nvi_env_map_at(env, i, &key, &value); ++i) {
+        size_t key_len = strlen(key);
+        size_t value_len = strlen(value);
+        char *pair = malloc(key_len + value_len + 2);
+        if (pair == NULL) {
+            return NULL;
+        }
+        memcpy(pair, key, key_len);
+        pair[key_len] = '=';
+        memcpy(pair + key_len + 1, value, value_len + 1);
+        envp[len++] = pair;
+    }
+
+    for (size_t i = 0; i < exported; ++i) {
+        const char *pair = export_env[i];
+        size_t key_len = strcspn(pair, "=");
+
+        bool overridden = false;
+        for (size_t j = 0; j < nvi_env_map_count(env) && !overridden; ++j) {
+            overridden = strncmp(envp[j], pair, key_len + 1) == 0;
+        }
+        if (!overridden) {
+            envp[len++] = (char *)pair;
+        }
+    }
+
+    envp[len] = NULL;
+    return envp;
+}
+
+static int run_command(nvi_env_map_t *env, char **command) {
+    // rebuilt in the shell only when a variable changed since the last command
+    maybe_make_export_env();
+
+    pid_t pid = fork();
+    if (pid < 0) {
+        builtin_error("fork: %s", strerror(errno));
+        return EXECUTION_FAILURE;
+    }
+
+    if (pid == 0) {
+        restore_original_signals();
+        char **envp = make_command_env(env);
+        if (envp != NULL) {
+            // like env: PATH is looked up after the ENVs are applied
+            environ = envp;
+            execvp(command[0], command);
+        }
+        int code = errno == ENOENT ? EX_NOTFOUND : EX_NOEXEC;
+        fprintf(stderr, "nvi: %s: %s\n", command[0], strerror(errno));
+        _exit(code);
+    }
+
+    int status = 0;
+    while (waitpid(pid, &status, 0) < 0) {
+        if (errno != EINTR) {
+            builtin_error("waitpid: %s", strerror(errno));
+            return EXECUTION_FAILURE;
+        }
+    }
+
+    return WIFSIGNALED(status) ? 128 + WTERMSIG(status) : WEXITSTATUS(status);
+}
+
+int nvi_builtin(WORD_LIST *list) {
+    size_t words = 1;
+    for (WORD_LIST *l = list; l != NULL; l = l->next) {
+        ++words;
+    }
+
+    const char **files = malloc(words * sizeof(*files));
+    const char **required = malloc(words * sizeof(*required));
+    char **command = malloc(words * sizeof(*command));
+    nvi_arena_t *arena = nvi_arena_create();
+    if (files == NULL || required == NULL || command == NULL || arena == NULL) {
+        builtin_error("out of memory");
+        free(files);
+        free(required);
+        free(command);
+        nvi_arena_destroy(arena);
+        return EXECUTION_FAILURE;
+    }
+
+    nvi_call_t call = {.files = files, .required = required, .command = command};
+    int status = parse_call(list, &call);
+
+    nvi_env_map_t *env = NULL;
+    nvi_error_t error;
+    if (status == EXECUTION_SUCCESS &&
+        (nvi_load_files(arena, call.files, call.file_count, &env, &error) != NVI_OK ||
+         nvi_env_map_require(env, call.required, call.required_count, &error) != NVI_OK)) {
+        builtin_error("%s", error.message);
+        status = EXECUTION_FAILURE;
+    }
+
+    if (status == EXECUTION_SUCCESS) {
+        status = call.command != NULL ? run_command(env, call.command) : export_envs(env);
+    }
+
+    nvi_arena_destroy(arena);
+    free(files);
+    free(required);
+    free(command);
+    return status;
+}
+
+char *nvi_doc[] = {
+    "Load .env files and run a command with their ENVs.",
+    "",
+    "Tokenizes and parses each FILE in order inside the shell, like the nvi binary's",
+    "--files flag. With a COMMAND, runs it with the parsed ENVs added to the exported",
+    "variables, as `nvi --files FILE... -- COMMAND | xargs -0 env` would, without",
+    "spawning nvi, xargs or env. Without a COMMAND, sets and exports the ENVs in the",
+    "current shell.",
+    "",
+    "Options:",
+    "  -f, --files FILE...     the .env files to load, later files overriding earlier ones",
+    "  -r, --required KEY...   fails unless every KEY is defined and not empty",
+    "",
+    "Exit Status:",
+    "Returns the status of COMMAND, or failure when a file can't be loaded, a required",
+    "KEY is missing or a flag is invalid.",
+    (char *)NULL,
+};
+
+struct builtin nvi_struct = {
+    "nvi", nvi_builtin, BUILTIN_ENABLED, nvi_doc, "nvi -f FILE... [-r KEY...] [-- COMMAND [ARG...]]", 0,
+};
@@ -0,0 +1,99 @@
+#ifndef NVI_H
+#define NVI_H
+
+// libnvi: the nvi tokenizer, parser and scan matcher as an embeddable C library, so a host
+// process can load .env files without spawning nvi and decoding its NUL-delimited stdout.
+//
+// - Handles are opaque. Every result lives in an nvi_arena_t the caller creates and owns:
+//   resetting or destroying the arena releases every map and key list made from it.
+// - Functions return an nvi_status_t and never write to stdout or stderr. When 'error' isn't
+//   NULL, it receives the status and the diagnostic the nvi binary would have printed.
+// - An arena and the handles made from it must only be used by one thread at a time; calls
+//   on different arenas may run concurrently. Interpolation reads the process environment.
+// - Allocation failures abort the process, like the nvi binary.
+//
+// Build with `./nob lib`: build/lib/libnvi.a and, on Linux and macOS, build/lib/libnvi.so
+// (only the functions below are exported from the shared library).
+
+#include <stdbool.h>
+#include <stddef.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#if defined(__GNUC__) && !defined(_WIN32)
+#define NVI_API __attribute__((visibility("default")))
+#else
+#define NVI_API
+#endif
+
+// bumped whenever a declaration below changes incompatibly
+#define NVI_API_VERSION 1
+
+#define NVI_ERROR_MAX 1024
+
+typedef enum {
+    NVI_OK = 0,
+    NVI_ERR_INVALID_ARGUMENT, // a NULL argument, no files or an unsupported scan extension
+    NVI_ERR_READ,             // a file couldn't be opened or read, or is empty
+    NVI_ERR_SYNTAX,           // the tokenizer rejected a file (eg. an unterminated quote)
+    NVI_ERR_PARSE,            // an undefined interpolation, a size limit or nothing to emit
+    NVI_ERR_MISSING_REQUIRED, // a required key is undefined or empty
+} nvi_status_t;
+
+typedef struct {
+    nvi_status_t status;
+    char message[NVI_ERROR_MAX]; // NUL terminated; truncated when longer
+} nvi_error_t;
+
+typedef struct nvi_arena nvi_arena_t;
+typedef struct nvi_env_map nvi_env_map_t;
+typedef struct nvi_keys nvi_keys_t;
+
+// Returns NULL when out of memory
+NVI_API nvi_arena_t *nvi_arena_create(void);
+
+// Releases everything allocated from 'arena' but keeps its memory for reuse
+NVI_API void nvi_arena_reset(nvi_arena_t *arena);
+NVI_API void nvi_arena_destroy(nvi_arena_t *arena);
+
+// Tokenizes and parses 'paths' in order: later files override earlier keys and may
+// interpolate them. Paths are opened as given (nvi's cwd-relative check is the CLI's).
+NVI_API nvi_status_t nvi_load_files(nvi_arena_t *arena, const char *const *paths, size_t count,
+                                    nvi_env_map_t **out, nvi_error_t *error);
+
+// Like nvi_load_files for one in-memory file; 'name' is used in diagnostics
+NVI_API nvi_status_t nvi_parse_buffer(nvi_arena_t *arena, const char *name, const char *data, size_t len,
+                                      nvi_env_map_t **out, nvi_error_t *error);
+
+// NVI_ERR_MISSING_REQUIRED, listing every key that is undefined or empty in 'map'
+NVI_API nvi_status_t nvi_env_map_require(nvi_env_map_t *map, const char *const *keys, size_t count,
+                                         nvi_error_t *error);
+
+NVI_API size_t nvi_env_map_count(const nvi_env_map_t *map);
+
+// Iterates the map in emit order (the order keys were first defined): false past the end
+NVI_API bool nvi_env_map_at(const nvi_env_map_t *map, size_t i, const char **key, const char **value);
+
+// Returns the value of 'key' or NULL
+NVI_API const char *nvi_env_map_get(nvi_env_map_t *map, const char *key);
+
+// Finds the ENV keys that 'data', source written in the 'ext' language (eg. "ts" or "py";
+// see `nvi --help`), reads through its environment accessors
+NVI_API nvi_status_t nvi_scan_buffer(nvi_arena_t *arena, const char *ext, const char *data, size_t len,
+                                     nvi_keys_t **out, nvi_error_t *error);
+
+NVI_API size_t nvi_keys_count(const nvi_keys_t *keys);
+
+// Iterates the matches in source order (a key read twice appears twice): false past the
+// end. 'key' is NUL terminated; 'line' and 'column' are 1-based. Any out pointer may be NULL.
+NVI_API bool nvi_keys_at(const nvi_keys_t *keys, size_t i, const char **key, size_t *line, size_t *column);
+
+NVI_API const char *nvi_version(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // NVI_H
@@ -7,9 +7,19 @@
 #if defined(_WIN32) && defined(_MSC_VER)
 #define OUT_BIN OUT ".exe"
 #define BIN_EXT ".exe"
+#define LIB_STATIC "build/lib/nvi.lib"
+#define OBJ_EXT ".obj"
 #else
 #define OUT_BIN OUT
 #define BIN_EXT ""
+#define LIB_STATIC "build/lib/libnvi.a"
+#define OBJ_EXT ".o"
+#endif
+
+#if defined(__APPLE__)
+#define LIB_SHARED "build/lib/libnvi.dylib"
+#else
+#define LIB_SHARED "build/lib/libnvi.so"
 #endif
 
 // Linux-only escape hatch: NVI_LIBC=musl builds a fully static, portable
@@ -86,10 +96,10 @@ static void add_common_flags(Nob_Cmd *cmd, const char *build_label) {
     const char *build_def = nob_temp_sprintf("-DNVI_BUILD=\"%s\"", build_label);
 
 #if defined(_WIN32) && defined(_MSC_VER)
-    nob_cmd_append(cmd, "cl", "/nologo", "/Isrc", commit_def, build_def, "/W4", "/std:c17", "/utf-8",
+    nob_cmd_append(cmd, "cl", "/nologo", "/Isrc", "/Iinclude", commit_def, build_def, "/W4", "/std:c17", "/utf-8",
                    "/Zc:preprocessor");
 #elif defined(__APPLE__) || defined(__linux__)
-    nob_cmd_append(cmd, posix_cc(), "-Isrc", commit_def, build_def, "-Wformat-security", "-Wall",
+    nob_cmd_append(cmd, posix_cc(), "-Isrc", "-Iinclude", commit_def, build_def, "-Wformat-security", "-Wall",
                    "-Wextra", "-Wpedantic", "-std=gnu17", "-pthread");
 #else
 #error "unsupported platform (expected Windows/MSVC, macOS, or Linux)"
@@ -341,8 +351,8 @@ static bool run_fuzz_target(const fuzz_target_t *target, int argc, char **argv)
     }
 
     Nob_Cmd cmd = {0};
-    nob_cmd_append(&cmd, cc, "-Isrc", "-Wformat-security", "-Wall", "-Wextra", "-Wpedantic", "-std=gnu17", "-g", "-O1",
-                   nob_temp_sprintf("-fsanitize=%s", san), "-fno-omit-frame-pointer", "-o", out);
+    nob_cmd_append(&cmd, cc, "-Isrc", "-Iinclude", "-Wformat-security", "-Wall", "-Wextra", "-Wpedantic", "-std=gnu17",
+                   "-g", "-O1", nob_temp_sprintf("-fsanitize=%s", san), "-fno-omit-frame-pointer", "-o", out);
     nob_cmd_append(&cmd, target->harness);
     if (!append_sources_except(&cmd, "main.c")) {
         return false;
@@ -521,6 +531,101 @@ static bool build_release(void) {
     return true;
 }
 
+// Builds libnvi (include/nvi.h) from every source except main.c: LIB_STATIC everywhere and,
+// on Linux and macOS, LIB_SHARED. Objects are compiled with hidden visibility so the shared
+// library only exports the NVI_API functions.
+static bool build_lib(void) {
+    if (!nob_mkdir_if_not_exists("build") || !nob_mkdir_if_not_exists("build/lib") ||
+        !nob_mkdir_if_not_exists("build/lib/obj")) {
+        return false;
+    }
+
+    Nob_File_Paths srcs = {0};
+    if (!collect_sources_except("main.c", &srcs)) {
+        return false;
+    }
+
+    Nob_File_Paths objs = {0};
+    for (size_t i = 0; i < srcs.count; ++i) {
+        const char *src = srcs.items[i];
+        const char *name = src + strlen("src/");
+        const char *obj = nob_temp_sprintf("build/lib/obj/%.*s" OBJ_EXT, (int)(strlen(name) - 2), name);
+
+        Nob_Cmd cmd = {0};
+        add_common_flags(&cmd, "lib");
+#if defined(_WIN32) && defined(_MSC_VER)
+        nob_cmd_append(&cmd, "/O2", "/DNDEBUG", "/c", src, nob_temp_sprintf("/Fo:%s", obj));
+#else
+        nob_cmd_append(&cmd, "-O2", "-DNDEBUG", "-fPIC", "-fvisibility=hidden", "-c", src, "-o", obj);
+#endif
+        if (!nob_cmd_run(&cmd)) {
+            nob_da_free(srcs);
+            nob_da_free(objs);
+            return false;
+        }
+        nob_da_append(&objs, obj);
+    }
+    nob_da_free(srcs);
+
+    // archivers add to an existing archive, so start over to drop stale members
+    if (nob_file_exists(LIB_STATIC) == 1) {
+        nob_delete_file(LIB_STATIC);
+    }
+
+    Nob_Cmd archive = {0};
+#if defined(_WIN32) && defined(_MSC_VER)
+    nob_cmd_append(&archive, "lib", "/nologo", "/OUT:" LIB_STATIC);
+#else
+    nob_cmd_append(&archive, "ar", "rcs", LIB_STATIC);
+#endif
+    nob_da_append_many(&archive, objs.items, objs.count);
+    bool ok = nob_cmd_run(&archive);
+
+#if !defined(_WIN32) || !defined(_MSC_VER)
+    if (ok) {
+        Nob_Cmd shared = {0};
+        nob_cmd_append(&shared, posix_cc(), "-shared", "-pthread", "-o", LIB_SHARED);
+        nob_da_append_many(&shared, objs.items, objs.count);
+        ok = nob_cmd_run(&shared);
+    }
+#endif
+
+    nob_da_free(objs);
+    return ok;
+}
+
+// Builds the bash loadable builtin (contrib/bash/nvi_builtin.c) against libnvi into
+// build/lib/nvi_builtin.so. BASH_INCLUDE_DIR points at the installed bash headers
+// (default: /usr/include/bash).
+static bool build_builtin(void) {
+#if defined(_WIN32) && defined(_MSC_VER)
+    nob_log(NOB_ERROR, "the bash builtin requires POSIX and is not supported under MSVC");
+    return false;
+#else
+    if (!build_lib()) {
+        return false;
+    }
+
+    const char *headers = getenv("BASH_INCLUDE_DIR");
+    if (headers == NULL || headers[0] == '\0') {
+        headers = "/usr/include/bash";
+    }
+    if (nob_file_exists(nob_temp_sprintf("%s/builtins.h", headers)) != 1) {
+        nob_log(NOB_ERROR, "bash headers not found in %s; install bash-builtins (Debian/Ubuntu) or bash-devel "
+                           "(Fedora), or set BASH_INCLUDE_DIR",
+                headers);
+        return false;
+    }
+
+    Nob_Cmd cmd = {0};
+    nob_cmd_append(&cmd, posix_cc(), "-Iinclude", "-DSHELL", "-DHAVE_CONFIG_H", nob_temp_sprintf("-I%s", headers),
+                   nob_temp_sprintf("-I%s/include", headers), nob_temp_sprintf("-I%s/builtins", headers), "-O2",
+                   "-fPIC", "-shared", "-pthread", "-o", "build/lib/nvi_builtin.so", "contrib/bash/nvi_builtin.c",
+                   LIB_STATIC);
+    return nob_cmd_run(&cmd);
+#endif
+}
+
 static bool build_one_test(const char *test_src, const char *out_path) {
     Nob_Cmd cmd = {0};
     compose_test_cmd(&cmd, out_path);
@@ -728,6 +833,29 @@ static bool cmd_generate(void) {
         nob_cmd_free(prefix);
     }
 
+#if !defined(_WIN32) || !defined(_MSC_VER)
+    {
+        Nob_Cmd prefix = {0};
+        nob_cmd_append(&prefix, "clang", "-Wformat-security", "-Wall", "-Wextra", "-Wpedantic", "-std=gnu17", "-O2");
+        emit_entry(&json, &first, dir, &prefix, "build/bench/bench-runner", "tests/bench/main.c");
+        ++count;
+        nob_cmd_free(prefix);
+    }
+#endif
+
+    {
+        Nob_Cmd prefix = {0};
+        add_common_flags(&prefix, "bench");
+#if defined(_WIN32) && defined(_MSC_VER)
+        nob_cmd_append(&prefix, "/O2", "/DNDEBUG");
+#else
+        nob_cmd_append(&prefix, "-O2", "-DNDEBUG");
+#endif
+        emit_entry(&json, &first, dir, &prefix, "build/bench/micro" BIN_EXT, "tests/bench/micro.c");
+        ++count;
+        nob_cmd_free(prefix);
+    }
+
     Nob_File_Paths lib = {0};
     if (!collect_sources_except("main.c", &lib)) {
         nob_sb_free(json);
@@ -799,6 +927,126 @@ static bool timed(const char *label, const char *out, bool (*build)(void)) {
     return ok;
 }
 
+// Builds the component microbenchmarks (tests/bench/micro.c) against every
+// source except main.c, optimized and unsanitized, and runs them. Usage:
+// ./nob bench micro [filter]; the filter is a substring of the benchmark name
+// (eg. 'matcher/' or 'hashmap').
+static bool run_bench_micro(int argc, char **argv) {
+    if (argc > 1) {
+        nob_log(NOB_ERROR, "usage: ./nob bench micro [filter]");
+        return false;
+    }
+
+    if (!nob_mkdir_if_not_exists("build") || !nob_mkdir_if_not_exists("build/bench")) {
+        return false;
+    }
+
+    const char *out = "build/bench/micro" BIN_EXT;
+    Nob_Cmd cmd = {0};
+    add_common_flags(&cmd, "bench");
+#if defined(_WIN32) && defined(_MSC_VER)
+    nob_cmd_append(&cmd, "/O2", "/DNDEBUG", nob_temp_sprintf("/Fe:%s", out));
+#else
+    nob_cmd_append(&cmd, "-O2", "-DNDEBUG", "-o", out);
+#endif
+    nob_cmd_append(&cmd, "tests/bench/micro.c");
+    if (!append_sources_except(&cmd, "main.c")) {
+        return false;
+    }
+#if !defined(_WIN32) || !defined(_MSC_VER)
+    nob_cmd_append(&cmd, "-lm");
+#endif
+
+    if (!nob_cmd_run(&cmd)) {
+        nob_log(NOB_ERROR, "failed to build the microbenchmarks");
+        return false;
+    }
+
+    Nob_Cmd run = {0};
+    nob_cmd_append(&run, out);
+    if (argc == 1) {
+        nob_cmd_append(&run, argv[0]);
+    }
+
+    return nob_cmd_run(&run);
+}
+
+// Builds the release binary and the bash builtin and compares their per-call cost with
+// tests/bench/builtin.sh. Usage: ./nob bench builtin [calls].
+static bool run_bench_builtin(int argc, char **argv) {
+    if (argc > 1) {
+        nob_log(NOB_ERROR, "usage: ./nob bench builtin [calls]");
+        return false;
+    }
+
+    if (!nob_mkdir_if_not_exists("build") || !nob_mkdir_if_not_exists("build/bench")) {
+        return false;
+    }
+
+    if (!timed("release", OUT_BIN, build_release) || !build_builtin()) {
+        return false;
+    }
+
+    Nob_Cmd run = {0};
+    nob_cmd_append(&run, "bash", "tests/bench/builtin.sh", "./" OUT_BIN, "build/lib/nvi_builtin.so");
+    if (argc == 1) {
+        nob_cmd_append(&run, argv[0]);
+    }
+
+    return nob_cmd_run(&run);
+}
+
+// Builds the release binary plus the benchmark runner (tests/bench/main.c) and
+// runs it from the repository root. Usage: ./nob bench [update]; 'update'
+// rewrites tests/bench/baseline.json from this run instead of comparing
+// against it. The runner is POSIX only (it reaps nvi with wait4 for rusage).
+static bool run_bench(int argc, char **argv) {
+    if (argc > 0 && strcmp(argv[0], "micro") == 0) {
+        return run_bench_micro(argc - 1, argv + 1);
+    }
+
+    if (argc > 0 && strcmp(argv[0], "builtin") == 0) {
+        return run_bench_builtin(argc - 1, argv + 1);
+    }
+
+#if defined(_WIN32) && defined(_MSC_VER)
+    (void)argc;
+    (void)argv;
+    nob_log(NOB_ERROR, "the benchmark runner requires POSIX (fork/wait4) and is not supported under MSVC");
+    return false;
+#else
+    if (argc > 1 || (argc == 1 && strcmp(argv[0], "update") != 0)) {
+        nob_log(NOB_ERROR, "usage: ./nob bench [update | micro [filter] | builtin [calls]]");
+        return false;
+    }
+
+    if (!nob_mkdir_if_not_exists("build") || !nob_mkdir_if_not_exists("build/bench")) {
+        return false;
+    }
+
+    if (!timed("release", OUT_BIN, build_release)) {
+        return false;
+    }
+
+    const char *runner = "build/bench/bench-runner";
+    Nob_Cmd cmd = {0};
+    nob_cmd_append(&cmd, posix_cc(), "-Wformat-security", "-Wall", "-Wextra", "-Wpedantic", "-std=gnu17", "-O2", "-o",
+                   runner, "tests/bench/main.c");
+    if (!nob_cmd_run(&cmd)) {
+        nob_log(NOB_ERROR, "failed to build the benchmark runner");
+        return false;
+    }
+
+    Nob_Cmd run = {0};
+    nob_cmd_append(&run, runner, OUT_BIN);
+    if (argc == 1) {
+        nob_cmd_append(&run, argv[0]);
+    }
+
+    return nob_cmd_run(&run);
+#endif
+}
+
 int main(int argc, char **argv) {
 #if !defined(_WIN32) || !defined(_MSC_VER)
     NOB_GO_REBUILD_URSELF(argc, argv);
@@ -833,6 +1081,14 @@ int main(int argc, char **argv) {
         if (!timed("release", OUT_BIN, build_release)) {
             return 1;
         }
+    } else if (strcmp(subcmd, "lib") == 0) {
+        if (!timed("lib", LIB_STATIC, build_lib)) {
+            return 1;
+        }
+    } else if (strcmp(subcmd, "builtin") == 0) {
+        if (!timed("builtin", "build/lib/nvi_builtin.so", build_builtin)) {
+            return 1;
+        }
     } else if (strcmp(subcmd, "test") == 0) {
         if (!cmd_generate()) {
             return 1;
@@ -861,6 +1117,10 @@ int main(int argc, char **argv) {
         if (!run_fuzz(argc, argv)) {
             return 1;
         }
+    } else if (strcmp(subcmd, "bench") == 0) {
+        if (!run_bench(argc, argv)) {
+            return 1;
+        }
     } else if (strcmp(subcmd, "generate") == 0) {
         if (!cmd_generate()) {
             return 1;
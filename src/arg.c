@@ -7,6 +7,7 @@
 #include "macros.h"
 #include "nthread.h"
 #include "result.h"
+#include "snapshot.h"
 #include "tty.h"
 #include "utils.h"
 #include "version.h"
@@ -53,10 +54,75 @@ static void report_flag_reveal(bool reveal) {
     log_f(SINK_STDERR, "%s", reveal ? "true" : "false");
 }
 
-static void report_flag_threads(const uint8_t threads) {
+static void report_flag_threads(const uint8_t threads, const bool automatic) {
     log_f(SINK_STDERR, "\n    %s", BULLET);
     log_info(SINK_STDERR, " scan threads: ");
-    log_f(SINK_STDERR, "%d", threads);
+    if (automatic) {
+        log_f(SINK_STDERR, "auto (up to %d)", threads);
+    } else {
+        log_f(SINK_STDERR, "%d", threads);
+    }
+}
+
+static void report_flag_scan_schedule(const scan_schedule_t schedule) {
+    log_f(SINK_STDERR, "\n    %s", BULLET);
+    log_info(SINK_STDERR, " scan schedule: ");
+    log_f(SINK_STDERR, "%s", get_scan_schedule_name(schedule));
+}
+
+static void report_flag_scan_source(const scan_source_t source) {
+    log_f(SINK_STDERR, "\n    %s", BULLET);
+    log_info(SINK_STDERR, " scan source: ");
+    log_f(SINK_STDERR, "%s", get_scan_source_name(source));
+}
+
+static void report_flag_scan_skip(const unsigned skip) {
+    log_f(SINK_STDERR, "\n    %s", BULLET);
+    log_info(SINK_STDERR, " scan skip: ");
+    if (skip == 0) {
+        log_comment(SINK_STDERR, "(none)");
+        return;
+    }
+
+    const char *sep = "";
+    for (sniff_kind_t kind = SNIFF_BINARY; kind < SNIFF_UNKNOWN; ++kind) {
+        if (skip & SNIFF_BIT(kind)) {
+            log_f(SINK_STDERR, "%s%s", sep, get_sniff_name(kind));
+            sep = ", ";
+        }
+    }
+}
+
+static void report_flag_scan_memory(const size_t bytes) {
+    log_f(SINK_STDERR, "\n    %s", BULLET);
+    log_info(SINK_STDERR, " scan memory: ");
+    log_f(SINK_STDERR, "%zuMB", bytes / SCAN_MEMORY_MB);
+}
+
+static void report_flag_stats(const stats_format_t stats) {
+    log_f(SINK_STDERR, "\n    %s", BULLET);
+    log_info(SINK_STDERR, " stats: ");
+    log_f(SINK_STDERR, "%s", get_stats_format_name(stats));
+}
+
+static void report_flag_trace(const char *trace_path) {
+    log_f(SINK_STDERR, "\n    %s", BULLET);
+    log_info(SINK_STDERR, " trace file: ");
+    if (trace_path == NULL) {
+        log_comment(SINK_STDERR, "(none)");
+    } else {
+        log_f(SINK_STDERR, "%s", trace_path);
+    }
+}
+
+static void report_flag_name(const char *label, const char *name) {
+    log_f(SINK_STDERR, "\n    %s", BULLET);
+    log_info(SINK_STDERR, " %s: ", label);
+    if (name == NULL) {
+        log_comment(SINK_STDERR, "(none)");
+    } else {
+        log_f(SINK_STDERR, "%s", name);
+    }
 }
 
 static void report_flag_format(const format_t format) {
@@ -93,10 +159,19 @@ static void report_flags(const args_t *args) {
     report_flag_items("command", args->command.items, args->command.count, " ");
     report_flag_items("files", args->files.items, args->files.count, ", ");
     report_flag_items("ignored ENVs", args->ignored.items, args->ignored.count, ", ");
+    report_flag_name("publish snapshot", args->publish);
     report_flag_items("required ENVs", args->required.items, args->required.count, ", ");
     report_flag_reveal(args->reveal);
     report_flag_scan_extensions("scan extensions", &args->scan_exts, ", ");
-    report_flag_threads(args->scan_threads);
+    report_flag_name("scan from", args->scan_from);
+    report_flag_scan_memory(args->scan_memory);
+    report_flag_scan_schedule(args->scan_schedule);
+    report_flag_scan_skip(args->scan_skip);
+    report_flag_scan_source(args->scan_source);
+    report_flag_name("snapshot", args->snapshot);
+    report_flag_threads(args->scan_threads, args->scan_threads_auto);
+    report_flag_stats(args->stats);
+    report_flag_trace(args->trace_path);
     report_flag_format(args->format);
 }
 
@@ -116,11 +191,21 @@ static const flag_entry_t flags[] = {
     FLAG("-h", "--help", "help", HELP_FLAG),
     FLAG("-i", "--ignored", IGNORED_FLAG),
     FLAG("-F", "--format", FORMAT_FLAG),
+    FLAG("--publish", PUBLISH_FLAG),
     FLAG("-r", "--required", REQUIRED_FLAG),
     FLAG("-R", "--reveal", REVEAL_FLAG),
     FLAG("-s", "--scan", "scan", SCAN_FLAG),
+    FLAG("--scan-from", SCAN_FROM_FLAG),
+    FLAG("--scan-memory", SCAN_MEMORY_FLAG),
+    FLAG("--scan-schedule", SCAN_SCHEDULE_FLAG),
+    FLAG("--scan-skip", SCAN_SKIP_FLAG),
+    FLAG("--scan-source", SCAN_SOURCE_FLAG),
+    FLAG("--snapshot", SNAPSHOT_FLAG),
+    FLAG("--stats", STATS_FLAG),
     FLAG("-t", "--threads", THREADS_FLAG),
+    FLAG("--trace", TRACE_FLAG),
     FLAG("-v", "--version", "version", VERSION_FLAG),
+    FLAG("--watch", WATCH_FLAG),
 };
 
 static const size_t flags_len = ARR_LEN(flags);
@@ -159,6 +244,21 @@ static result_t get_next_value(args_t *args, const char *flag, const char **para
     return RESULT_OK;
 }
 
+static result_t get_snapshot_name(args_t *args, const char *flag, const char **name) {
+    result_t result = get_next_value(args, flag, name);
+    if (!result.ok) {
+        return result;
+    }
+
+    if (!is_valid_snapshot_name(*name)) {
+        return usage_error("The '%s' flag contains an invalid snapshot name '%s' (expected: up to %d letters, digits, "
+                           "'.', '_' or '-', not starting with '.')",
+                           flag, *name, SNAPSHOT_MAX_NAME);
+    }
+
+    return RESULT_OK;
+}
+
 static inline result_t validate_file_name(const char *p) {
     const char *base = path_basename(p);
 
@@ -188,6 +288,11 @@ result_t parse_args(arena_t *arena, config_t *config, args_t *args) {
     args->dry_run = false;
     args->reveal = false;
     args->scan_threads = 1;
+    args->scan_source = SCAN_SOURCE_WALK;
+    args->scan_schedule = SCAN_SCHEDULE_WALK;
+    args->scan_skip = SNIFF_DEFAULT;
+    args->scan_memory = SCAN_MEMORY_DEFAULT_MB * SCAN_MEMORY_MB;
+    args->stats = STATS_OFF;
 
     result_t result = RESULT_OK;
 
@@ -259,6 +364,14 @@ result_t parse_args(arena_t *arena, config_t *config, args_t *args) {
 
                 break;
             }
+            case PUBLISH_FLAG: {
+                result = get_snapshot_name(args, "publish", &args->publish);
+                if (!result.ok) {
+                    return result;
+                }
+
+                break;
+            }
             case REQUIRED_FLAG: {
                 const char *param;
                 result = get_next_value(args, "required", &param);
@@ -297,6 +410,119 @@ result_t parse_args(arena_t *arena, config_t *config, args_t *args) {
 
                 break;
             }
+            case SCAN_FROM_FLAG: {
+                // '-' (stdin) starts with a dash, so get_next_value would take it for a flag
+                if (args->i + 1 < args->argc && strcmp(args->argv[args->i + 1], "-") == 0) {
+                    args->scan_from = args->argv[++args->i];
+                    break;
+                }
+
+                result = get_next_value(args, "scan-from", &args->scan_from);
+                if (!result.ok) {
+                    return result;
+                }
+
+                break;
+            }
+            case SCAN_MEMORY_FLAG: {
+                const char *param;
+                result = get_next_value(args, "scan-memory", &param);
+                if (!result.ok) {
+                    return result;
+                }
+
+                size_t mb;
+                if (!str_to_size(param, SCAN_MEMORY_MAX_MB, &mb) || mb == 0) {
+                    return usage_error("The 'scan-memory' flag expects a number of MB from 1 to %zu, instead found %s",
+                                       SCAN_MEMORY_MAX_MB, param);
+                }
+
+                args->scan_memory = mb * SCAN_MEMORY_MB;
+                break;
+            }
+            case SCAN_SCHEDULE_FLAG: {
+                const char *param;
+                result = get_next_value(args, "scan-schedule", &param);
+                if (!result.ok) {
+                    return result;
+                }
+
+                const scan_schedule_t schedule = get_scan_schedule(param);
+                if (schedule == SCAN_SCHEDULE_UNKNOWN) {
+                    return usage_error(
+                        "The 'scan-schedule' flag contains an invalid schedule '%s' (expected: walk|largest-first)",
+                        param);
+                }
+
+                args->scan_schedule = schedule;
+                break;
+            }
+            case SCAN_SKIP_FLAG: {
+                const char *param;
+                result = get_next_value(args, "scan-skip", &param);
+                if (!result.ok) {
+                    return result;
+                }
+
+                // the listed kinds replace the default of skipping binary files
+                args->scan_skip = 0;
+                while (param != NULL) {
+                    const sniff_kind_t kind = get_sniff(param);
+                    if (kind == SNIFF_UNKNOWN) {
+                        return usage_error("The 'scan-skip' flag contains an invalid kind '%s' (expected: "
+                                           "binary|minified|generated|none)",
+                                           param);
+                    }
+
+                    if (kind != SNIFF_NONE) {
+                        args->scan_skip |= SNIFF_BIT(kind);
+                    }
+                    param = get_next_param(args);
+                }
+
+                break;
+            }
+            case SCAN_SOURCE_FLAG: {
+                const char *param;
+                result = get_next_value(args, "scan-source", &param);
+                if (!result.ok) {
+                    return result;
+                }
+
+                const scan_source_t source = get_scan_source(param);
+                if (source == SCAN_SOURCE_UNKNOWN) {
+                    return usage_error(
+                        "The 'scan-source' flag contains an invalid source '%s' (expected: walk|git-index)", param);
+                }
+
+                args->scan_source = source;
+                break;
+            }
+            case SNAPSHOT_FLAG: {
+                result = get_snapshot_name(args, "snapshot", &args->snapshot);
+                if (!result.ok) {
+                    return result;
+                }
+
+                break;
+            }
+            case STATS_FLAG: {
+                // the format is optional: a bare --stats reports text
+                const char *param = get_next_param(args);
+                if (param == NULL) {
+                    args->stats = STATS_TEXT;
+                    break;
+                }
+
+                const stats_format_t stats = get_stats_format(param);
+                if (stats == STATS_UNKNOWN) {
+                    return usage_error("The 'stats' flag contains an invalid format '%s' (expected: text|json)",
+                                       param);
+                }
+
+                args->stats = stats;
+                break;
+            }
             case THREADS_FLAG: {
                 const char *param;
                 result = get_next_value(args, "threads", &param);
@@ -304,6 +530,13 @@ result_t parse_args(arena_t *arena, config_t *config, args_t *args) {
                     return result;
                 }
 
+                if (strcmp(param, "auto") == 0) {
+                    size_t available = available_thread_count();
+                    args->scan_threads = (uint8_t)(available > UINT8_MAX ? UINT8_MAX : available);
+                    args->scan_threads_auto = true;
+                    break;
+                }
+
                 const int MAX_THREADS = thread_count();
                 int threads = str_to_u8(param);
                 if (threads < 1 || threads > MAX_THREADS) {
@@ -312,6 +545,17 @@ result_t parse_args(arena_t *arena, config_t *config, args_t *args) {
                 }
 
                 args->scan_threads = (uint8_t)threads;
+                args->scan_threads_auto = false;
+                break;
+            }
+            case TRACE_FLAG: {
+                const char *param;
+                result = get_next_value(args, "trace", &param);
+                if (!result.ok) {
+                    return result;
+                }
+
+                args->trace_path = param;
                 break;
             }
             case HELP_FLAG: {
@@ -319,8 +563,11 @@ result_t parse_args(arena_t *arena, config_t *config, args_t *args) {
                     "Usage:\n"
                     "   nvi [flags] -- <command>\n"
                     "   nvi @<config> -- <command>\n"
+                    "   nvi serve\n"
+                    "   nvi --client [flags] -- <command>\n"
                     "\n"
                     "Flags:\n"
+                    "      --client                 sends the run to a running 'nvi serve' (must be the first flag)\n"
                     "  -d, --dry-run                prints flags, scan results, file tokens and parsed ENVs to stderr\n"
                     "  -f, --files <paths>          parses .env files in sequential order (at 1 .env file must be "
                     "specified)\n"
@@ -328,13 +575,31 @@ result_t parse_args(arena_t *arena, config_t *config, args_t *args) {
                     "  -h, --help, help             prints this help and exits with 0\n"
                     "  -i, --ignored <keys>         ignores ENV keys that scan may find and add to the required ENV "
                     "key list\n"
+                    "      --publish <name>         publishes the parsed ENVs as a snapshot that other runs can read\n"
                     "  -r, --required <keys>        ensures ENV keys are defined before the <command> is emitted\n"
                     "  -R, --reveal                 reveals ENV values in a dry run\n"
                     "  -s, --scan <ext>             recursively scans for ENV variables in <ext> (see options "
                     "below)*\n"
-                    "  -t, --threads <1-255>        number of threads to use when scanning for ENV variables (max: "
-                    "your CPU thread count)**\n"
+                    "      --scan-from <file|->     scans the NUL or newline delimited paths listed in <file> (or "
+                    "stdin) instead of walking the CWD\n"
+                    "      --scan-memory <MB>       caps the file contents the scan threads hold at once; the "
+                    "matches found in them aren't counted (default: 512)\n"
+                    "      --scan-schedule <order>  hands out scan work as walked, or directories then the largest "
+                    "files first (options: walk|largest-first)\n"
+                    "      --scan-skip <kinds>      passes over these kinds of files when scanning (options: "
+                    "binary|minified|generated|none; default: binary)\n"
+                    "      --scan-source <src>      finds the files to scan by walking the CWD or from the git index "
+                    "(options: walk|git-index)\n"
+                    "      --snapshot <name>        emits ENVs from a published snapshot instead of parsing .env "
+                    "files\n"
+                    "      --stats [text|json]      reports phase timings, scan throughput and per-file latency to "
+                    "stderr\n"
+                    "  -t, --threads <1-255|auto>   number of threads to use when scanning for ENV variables (max: "
+                    "your CPU thread count; auto: what the CPU quota and affinity allow)**\n"
+                    "      --trace <file>           writes a Chrome/Perfetto trace-event JSON of the run to <file>\n"
                     "  -v, --version, version       prints the version and exits with 0\n"
+                    "      --watch                  runs the <command> and restarts it when the .env files change its "
+                    "ENVs\n"
                     "  @<config>                    loads flags from a .nvi config file\n"
                     "\n"
                     " * without a <command>, scan reports what it finds and exits; with a <command>, the found "
@@ -399,6 +664,10 @@ result_t parse_args(arena_t *arena, config_t *config, args_t *args) {
 
                 return EXIT_EARLY;
             }
+            case WATCH_FLAG: {
+                args->watch = true;
+                break;
+            }
             default: {
                 if (arg[0] == DASH) {
                     return usage_error("Unrecognized flag '%s'", arg);
@@ -413,11 +682,43 @@ result_t parse_args(arena_t *arena, config_t *config, args_t *args) {
 
     report_flags(args);
 
-    if (args->scan_exts.count == 0 && args->files.count == 0) {
+    if (args->snapshot != NULL && (args->files.count > 0 || args->publish != NULL)) {
+        return usage_error("The '--snapshot' flag emits already parsed ENVs and can't be combined with the '%s' flag",
+                           args->files.count > 0 ? "--files" : "--publish");
+    }
+
+    if (args->publish != NULL && args->files.count == 0) {
+        return usage_error("The '--publish' flag requires the '--files' flag");
+    }
+
+    if (args->watch && args->dry_run) {
+        return usage_error("The '--watch' flag runs the command and can't be combined with the '--dry-run' flag");
+    }
+
+    if (args->watch && (args->files.count == 0 || args->publish != NULL)) {
+        return usage_error(args->files.count == 0 ? "The '--watch' flag requires the '--files' flag"
+                                                  : "The '--watch' flag can't be combined with the '--publish' flag");
+    }
+
+    if (args->watch && args->command.count == 0) {
+        return usage_error("The '--watch' flag requires a '--' command to run");
+    }
+
+    if ((args->scan_source != SCAN_SOURCE_WALK || args->scan_from != NULL) && args->scan_exts.count == 0) {
+        return usage_error("The '%s' flag requires the '--scan' flag",
+                           args->scan_from != NULL ? "--scan-from" : "--scan-source");
+    }
+
+    if (args->scan_from != NULL && args->scan_source != SCAN_SOURCE_WALK) {
+        return usage_error("The '--scan-from' flag lists the files to scan and can't be combined with the "
+                           "'--scan-source' flag");
+    }
+
+    if (args->scan_exts.count == 0 && args->files.count == 0 && args->snapshot == NULL) {
         return usage_error("The '--files' or '--scan' flag requires at least one argument");
     }
 
-    if (args->scan_exts.count > 1 && args->files.count == 0 && !args->dry_run) {
+    if (args->scan_exts.count > 1 && args->files.count == 0 && args->snapshot == NULL && !args->dry_run) {
         return usage_error("Running a scan must either include the '--files' flag or the '--dry-run' flag");
     }
 
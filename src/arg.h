@@ -6,7 +6,11 @@
 #include "config.h"
 #include "format.h"
 #include "result.h"
+#include "schedule.h"
 #include "set.h"
+#include "sniff.h"
+#include "source.h"
+#include "stats.h"
 #include <stdbool.h>
 #include <stddef.h>
 #include <stdint.h>
@@ -20,11 +24,27 @@
 // format -> type of format (nul delimited or powershell env delimited) to emit ENVs
 // help -> displays help info to stdout
 // ignored -> a list of ENV keys that will be ignored (mostly useful for scans)
+// publish -> writes the parsed ENVs to a named snapshot shared by every process on the host
 // required -> a list of ENV keys to mark as required and defined before a command is emitted
 // reveal -> exposes ENV values during a dry run
 // scan -> a list of file extensions to scan for in the CWD
-// threads -> maximum number of threads to use for scanning
+// scan-from -> a file (or '-' for stdin) listing the files to scan instead of walking the CWD
+// scan-memory -> how many MB of file contents the scan workers may hold at once
+// scan-schedule -> the order a scan hands out work: as walked, or directories then the largest files first
+// scan-skip -> which kinds of binary, minified or generated files a scan passes over
+// scan-source -> where a scan finds its files: walking the CWD or the git index
+// snapshot -> emits ENVs from a published snapshot instead of parsing .env files
+// stats -> reports phase timings, scan throughput and latency to stderr (text or json)
+// threads -> maximum number of threads to use for scanning, or "auto" for what the CPU quota and affinity allow
+// trace -> writes Chrome trace-event JSON of the run to a file
 // version -> displays current binary info
+// watch -> runs the command itself and restarts it whenever an .env file change alters its ENVs
+
+#define SCAN_MEMORY_MB ((size_t)1024 * 1024)
+#define SCAN_MEMORY_DEFAULT_MB 512
+// 1TB, or as many MB as a size_t can count in bytes on this platform (4095 on 32-bit targets)
+#define SCAN_MEMORY_MAX_MB                                                                                             \
+    (SIZE_MAX / SCAN_MEMORY_MB < (size_t)1024 * 1024 ? SIZE_MAX / SCAN_MEMORY_MB : (size_t)1024 * 1024)
 
 typedef enum {
     DRY_RUN_FLAG,
@@ -33,12 +53,22 @@ typedef enum {
     FORMAT_FLAG,
     HELP_FLAG,
     IGNORED_FLAG,
+    PUBLISH_FLAG,
     REQUIRED_FLAG,
     REVEAL_FLAG,
     SCAN_FLAG,
+    SCAN_FROM_FLAG,
+    SCAN_MEMORY_FLAG,
+    SCAN_SCHEDULE_FLAG,
+    SCAN_SKIP_FLAG,
+    SCAN_SOURCE_FLAG,
+    SNAPSHOT_FLAG,
+    STATS_FLAG,
     THREADS_FLAG,
+    TRACE_FLAG,
     UNKNOWN_FLAG,
-    VERSION_FLAG
+    VERSION_FLAG,
+    WATCH_FLAG
 } flag_t;
 
 typedef struct {
@@ -53,8 +83,19 @@ typedef struct {
     const char *config_path;
     bool dry_run;
     bool reveal;
+    bool watch;
     uint8_t scan_threads;
+    bool scan_threads_auto; // scan_threads came from --threads auto; workers start as work appears
     format_t format;
+    scan_source_t scan_source;
+    scan_schedule_t scan_schedule;
+    unsigned scan_skip; // a mask of SNIFF_BIT kinds
+    size_t scan_memory; // bytes
+    stats_format_t stats;
+    const char *trace_path;
+    const char *scan_from; // a path, or "-" for stdin
+    const char *publish;  // snapshot name
+    const char *snapshot; // snapshot name
     set_t files;
     set_t required;
     set_t ignored;
@@ -4,6 +4,7 @@
 #include "format.h"
 #include "parser.h"
 #include <stdio.h>
+#include <string.h>
 
 static void write_to_ps_format(const char *s) {
     size_t value_len = strlen(s);
@@ -22,40 +23,56 @@ static void write_to_ps_format(const char *s) {
     }
 }
 
-void run_emitter(const args_t *args, const env_map_t *env_map) {
+void emit_env(format_t format, const char *key, size_t key_len, const char *value) {
+    switch (format) {
+        case FORMAT_POWERSHELL: {
+            fprintf(stdout, "$env:%.*s = '", (int)key_len, key);
+            write_to_ps_format(value);
+            fputc('\'', stdout);
+            fprintf(stdout, "\n");
+            break;
+        }
+        default: {
+            // written as runs, including the value's NUL as the delimiter, rather than formatted
+            fwrite(key, 1, key_len, stdout);
+            fputc('=', stdout);
+            fwrite(value, 1, strlen(value) + 1, stdout);
+            break;
+        }
+    }
+}
+
+void emit_command(const args_t *args) {
+    if (args->command.count == 0) {
+        return;
+    }
+
     switch (args->format) {
         case FORMAT_POWERSHELL: {
-            for (size_t i = 0; i < env_map->count; ++i) {
-                fprintf(stdout, "$env:%s = '", env_map->items[i].key);
-                write_to_ps_format(env_map->items[i].value);
+            fputc('&', stdout);
+            for (size_t i = 0; i < args->command.count; ++i) {
+                fputs(" '", stdout);
+                write_to_ps_format(args->command.items[i]);
                 fputc('\'', stdout);
-                fprintf(stdout, "\n");
-            }
-
-            if (args->command.count > 0) {
-                fputc('&', stdout);
-                for (size_t i = 0; i < args->command.count; ++i) {
-                    fputs(" '", stdout);
-                    write_to_ps_format(args->command.items[i]);
-                    fputc('\'', stdout);
-                }
-                fprintf(stdout, "\n");
             }
+            fprintf(stdout, "\n");
             break;
         }
         default: {
-            for (size_t i = 0; i < env_map->count; ++i) {
-                fprintf(stdout, "%s=%s", env_map->items[i].key, env_map->items[i].value);
+            for (size_t i = 0; i < args->command.count; ++i) {
+                fprintf(stdout, "%s", args->command.items[i]);
                 fputc('\0', stdout);
             }
-
-            if (args->command.count > 0) {
-                for (size_t i = 0; i < args->command.count; ++i) {
-                    fprintf(stdout, "%s", args->command.items[i]);
-                    fputc('\0', stdout);
-                }
-            }
             break;
         }
     }
 }
+
+void run_emitter(const args_t *args, const env_map_t *env_map) {
+    for (size_t i = 0; i < env_map->count; ++i) {
+        const env_t *env = &env_map->items[i];
+        emit_env(args->format, env->key, strlen(env->key), env->value);
+    }
+
+    emit_command(args);
+}
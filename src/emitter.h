@@ -2,7 +2,15 @@
 #define EMITTER_H
 
 #include "arg.h"
+#include "format.h"
 #include "parser.h"
+#include <stddef.h>
+
+// Writes one KEY=value pair in 'format'; 'key' needn't be NUL terminated
+void emit_env(format_t format, const char *key, size_t key_len, const char *value);
+
+// Writes the command after the ENVs, if there is one
+void emit_command(const args_t *args);
 
 void run_emitter(const args_t *args, const env_map_t *env_map);
 
@@ -0,0 +1,446 @@
+#include "engine.h"
+#include "arena.h"
+#include "buf.h"
+#include "dynarr.h"
+#include "errors.h"
+#include "hashmap.h"
+#include "parser.h"
+#include "result.h"
+#include "tokenizer.h"
+#include <stdbool.h>
+#include <stdlib.h>
+#include <string.h>
+
+// Hands assemble_value the values the references of one definition already resolved to,
+// in the order its value tokens interpolate them
+typedef struct {
+    const engine_ref_t *refs;
+    size_t next;
+} replay_t;
+
+static const char *replay_ref(void *ctx, const char *key) {
+    (void)key;
+    replay_t *replay = ctx;
+    return replay->refs[replay->next++].value;
+}
+
+static size_t intern_var(engine_t *engine, const char *key, size_t key_len) {
+    size_t i = hashmap_get(&engine->vars.index, key, key_len);
+    if (i != HASHMAP_NOT_FOUND) {
+        return i;
+    }
+
+    engine_var_t var = {.key = arena_strndup(&engine->arena, key, key_len), .generation = 0};
+    DYN_ARR_APPEND(&engine->arena, &engine->vars, var);
+    hashmap_append(&engine->arena, &engine->vars.index, var.key, key_len, engine->vars.count - 1);
+    return engine->vars.count - 1;
+}
+
+// Reads a process variable at most once per generation. The previous copy is kept while
+// the variable is unchanged, so its pointer identifies the value.
+static const char *read_var(engine_t *engine, size_t v) {
+    engine_var_t *var = &engine->vars.items[v];
+    if (var->generation == engine->generation) {
+        return var->value;
+    }
+
+    var->generation = engine->generation;
+    const char *current = getenv(var->key);
+    if (current == NULL) {
+        var->value = NULL;
+    } else if (var->value == NULL || strcmp(var->value, current) != 0) {
+        var->value = arena_strdup(&engine->arena, current);
+    }
+
+    return var->value;
+}
+
+// A process variable takes precedence over the definitions, as in run_parser
+static const char *resolve_ref(engine_t *engine, const engine_ref_t *ref, const engine_defs_t *defs,
+                               char *const *staged) {
+    const char *value = read_var(engine, ref->var);
+    if (value != NULL || ref->binding == ENGINE_NONE) {
+        return value;
+    }
+
+    if (staged != NULL && staged[ref->binding] != NULL) {
+        return staged[ref->binding];
+    }
+
+    return defs->items[ref->binding].value;
+}
+
+// Within a generation an unchanged value keeps its allocation, so most references compare
+// by pointer; across generations the reused values were copied, so those compare by content
+static bool same_refs(const engine_ref_t *a, size_t a_count, const engine_ref_t *b, size_t b_count) {
+    if (a_count != b_count) {
+        return false;
+    }
+
+    for (size_t i = 0; i < a_count; ++i) {
+        const char *x = a[i].value;
+        const char *y = b[i].value;
+        if (x != y && (x == NULL || y == NULL || strcmp(x, y) != 0)) {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+static bool same_value_tokens(const token_list_t *a, size_t at, const token_list_t *b, size_t bt) {
+    size_t count = a->value_counts[at];
+    if (count != b->value_counts[bt]) {
+        return false;
+    }
+
+    // a file that wasn't tokenized again shares its pool, so equal offsets are equal values
+    bool same_pool = token_pool(a, at) == token_pool(b, bt);
+    size_t av = a->first_values[at];
+    size_t bv = b->first_values[bt];
+    for (size_t i = 0; i < count; ++i, ++av, ++bv) {
+        if (a->kinds[av] != b->kinds[bv] || a->lens[av] != b->lens[bv]) {
+            return false;
+        }
+        if (!(same_pool && a->offsets[av] == b->offsets[bv]) &&
+            memcmp(token_value(a, at, av), token_value(b, bt, bv), a->lens[av]) != 0) {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+// Finds a definition of the same key in the committed generation that would assemble the
+// same value; 'def' is one of 'tokens'
+static const char *find_reusable_value(engine_t *engine, const token_list_t *tokens, const engine_def_t *def) {
+    if (def->key == NULL) {
+        return NULL;
+    }
+
+    size_t i = hashmap_get(&engine->last_defs, def->key, strlen(def->key));
+    while (i != ENGINE_NONE) {
+        const engine_def_t *old = &engine->defs.items[i];
+        if (same_refs(old->refs, old->ref_count, def->refs, def->ref_count) &&
+            same_value_tokens(&engine->tokens, old->token, tokens, def->token)) {
+            return old->value;
+        }
+        i = old->prev;
+    }
+
+    return NULL;
+}
+
+static result_t assemble_def(engine_t *engine, arena_t *arena, const token_list_t *tokens, const engine_def_t *def,
+                             const engine_ref_t *refs, buf_t *value, char **out) {
+    replay_t replay = {.refs = refs, .next = 0};
+    result_t result = assemble_value(arena, engine->args, tokens, def->token, replay_ref, &replay, value);
+    if (!result.ok) {
+        return result;
+    }
+
+    char *assembled = arena_alloc(arena, value->count + 1);
+    if (value->count > 0) {
+        memcpy(assembled, value->items, value->count);
+    }
+    assembled[value->count] = '\0';
+
+    ++engine->evaluated;
+    *out = assembled;
+    return RESULT_OK;
+}
+
+static result_t check_env_map(const args_t *args, env_map_t *env_map) {
+    // KEY=value plus a delimiter, mirroring the emitted layout
+    size_t total_output = 0;
+    for (size_t i = 0; i < env_map->count; ++i) {
+        total_output += strlen(env_map->items[i].key) + strlen(env_map->items[i].value) + 2;
+    }
+
+    if (total_output > MAX_PARSED_OUTPUT) {
+        return operation_error("The total parsed ENV output exceeds %zu bytes; aborting.\n", (size_t)MAX_PARSED_OUTPUT);
+    }
+
+    if (args->command.count == 0) {
+        return RESULT_OK;
+    }
+
+    arena_t scratch = {0};
+    list_t missing_envs = {0};
+    for (size_t i = 0; i < args->required.count; ++i) {
+        const env_t *entry = get_env_from_map(env_map, args->required.items[i]);
+        if (entry == NULL || entry->value[0] == '\0') {
+            DYN_ARR_APPEND(&scratch, &missing_envs, args->required.items[i]);
+        }
+    }
+
+    result_t result = missing_envs.count > 0 ? report_missing_envs(&missing_envs) : RESULT_OK;
+    arena_free(&scratch);
+    return result;
+}
+
+// Rebuilds the reader lists of the committed generation, in its arena
+static void link_readers(engine_t *engine) {
+    for (size_t v = 0; v < engine->vars.count; ++v) {
+        engine->vars.items[v].readers = (index_list_t){0};
+    }
+
+    for (size_t d = 0; d < engine->defs.count; ++d) {
+        const engine_def_t *def = &engine->defs.items[d];
+        for (size_t r = 0; r < def->ref_count; ++r) {
+            const engine_ref_t *ref = &def->refs[r];
+            DYN_ARR_APPEND(&engine->generation_arena, &engine->vars.items[ref->var].readers, d);
+            if (ref->binding != ENGINE_NONE) {
+                DYN_ARR_APPEND(&engine->generation_arena, &engine->defs.items[ref->binding].readers, d);
+            }
+        }
+    }
+}
+
+result_t engine_update(engine_t *engine, const args_t *args, const token_list_t *tokens, list_t *changed) {
+    engine->args = args;
+    engine->evaluated = 0;
+    ++engine->generation;
+    *changed = (list_t){0};
+
+    // everything this generation keeps goes in its own arena, which replaces the committed
+    // generation's on success; values reused from that one are copied over
+    arena_t next = {0};
+    token_list_t kept = {0};
+    engine_defs_t defs = {0};
+    hashmap_t last_defs = {0};
+    buf_t value = {.arena = &next};
+
+    // the caller's token arrays needn't outlive the update
+    result_t result = token_list_append(&next, &kept, tokens);
+    if (!result.ok) {
+        arena_free(&next);
+        return result;
+    }
+
+    for (size_t ti = 0; ti < kept.count; ++ti) {
+        // comments only matter to dry runs, which don't use the engine
+        if (!is_assembled_token(&kept, ti)) {
+            continue;
+        }
+
+        engine_def_t def = {.token = ti, .key = token_key(&kept, ti), .prev = ENGINE_NONE};
+        size_t first = kept.first_values[ti];
+        size_t end = first + kept.value_counts[ti];
+
+        for (size_t v = first; v < end; ++v) {
+            def.ref_count += kept.kinds[v] == INTERPOLATED_KEY;
+        }
+
+        if (def.ref_count > 0) {
+            def.refs = arena_alloc(&next, def.ref_count * sizeof(*def.refs));
+        }
+
+        size_t r = 0;
+        for (size_t v = first; v < end; ++v) {
+            if (kept.kinds[v] != INTERPOLATED_KEY) {
+                continue;
+            }
+
+            const char *raw_value = token_value(&kept, ti, v);
+            size_t key_len = get_interpolated_key_len(raw_value, kept.lens[v]);
+            size_t binding = hashmap_get(&last_defs, raw_value, key_len);
+            engine_ref_t *ref = &def.refs[r++];
+            ref->var = intern_var(engine, raw_value, key_len);
+            ref->binding = binding == HASHMAP_NOT_FOUND ? ENGINE_NONE : binding;
+            ref->value = resolve_ref(engine, ref, &defs, NULL);
+        }
+
+        const char *reused = find_reusable_value(engine, &kept, &def);
+        if (reused != NULL) {
+            def.value = arena_strdup(&next, reused);
+        } else {
+            result = assemble_def(engine, &next, &kept, &def, def.refs, &value, &def.value);
+            if (!result.ok) {
+                arena_free(&next);
+                return result;
+            }
+        }
+
+        // a keyless value is only checked, so nothing can read or emit it
+        if (def.key == NULL) {
+            DYN_ARR_APPEND(&next, &defs, def);
+            continue;
+        }
+
+        size_t prev = hashmap_get(&last_defs, def.key, strlen(def.key));
+        def.prev = prev == HASHMAP_NOT_FOUND ? ENGINE_NONE : prev;
+        DYN_ARR_APPEND(&next, &defs, def);
+        hashmap_append(&next, &last_defs, def.key, strlen(def.key), defs.count - 1);
+    }
+
+    // the first definition of a key places it, the last one gives its value
+    env_map_t env_map = {0};
+    for (size_t d = 0; d < defs.count; ++d) {
+        const char *key = defs.items[d].key;
+        if (key == NULL || defs.items[d].prev != ENGINE_NONE) {
+            continue;
+        }
+
+        size_t last = hashmap_get(&last_defs, key, strlen(key));
+        env_t env = {.key = key, .value = defs.items[last].value};
+        DYN_ARR_APPEND(&next, &env_map, env);
+        hashmap_append(&next, &env_map.index, key, strlen(key), env_map.count - 1);
+    }
+
+    if (env_map.count == 0) {
+        arena_free(&next);
+        return operation_error("After parsing .env tokens, there aren't any ENVs to emit; aborting.\n");
+    }
+
+    result = check_env_map(args, &env_map);
+    if (!result.ok) {
+        arena_free(&next);
+        return result;
+    }
+
+    for (size_t i = 0; i < env_map.count; ++i) {
+        const env_t *old = get_env_from_map(&engine->env_map, env_map.items[i].key);
+        if (old == NULL || strcmp(old->value, env_map.items[i].value) != 0) {
+            DYN_ARR_APPEND(&next, changed, env_map.items[i].key);
+        }
+    }
+
+    for (size_t i = 0; i < engine->env_map.count; ++i) {
+        if (get_env_from_map(&env_map, engine->env_map.items[i].key) == NULL) {
+            DYN_ARR_APPEND(&next, changed, engine->env_map.items[i].key);
+        }
+    }
+
+    arena_free(&engine->generation_arena);
+    engine->generation_arena = next;
+    engine->tokens = kept;
+    engine->defs = defs;
+    engine->last_defs = last_defs;
+    engine->env_map = env_map;
+    link_readers(engine);
+
+    return RESULT_OK;
+}
+
+result_t engine_refresh_env(engine_t *engine, list_t *changed) {
+    engine->evaluated = 0;
+    ++engine->generation;
+    *changed = (list_t){0};
+
+    size_t count = engine->defs.count;
+    if (count == 0) {
+        return RESULT_OK;
+    }
+
+    // the bookkeeping goes in a scratch arena; only assembled values join the generation
+    arena_t scratch = {0};
+    arena_t *arena = &engine->generation_arena;
+    bool *dirty = arena_alloc_zeroed(&scratch, count * sizeof(*dirty));
+    size_t first = count;
+
+    for (size_t v = 0; v < engine->vars.count; ++v) {
+        const engine_var_t *var = &engine->vars.items[v];
+        if (var->readers.count == 0) {
+            continue;
+        }
+
+        read_var(engine, v);
+        for (size_t i = 0; i < var->readers.count; ++i) {
+            size_t d = var->readers.items[i];
+            const engine_def_t *def = &engine->defs.items[d];
+            for (size_t r = 0; r < def->ref_count; ++r) {
+                const engine_ref_t *ref = &def->refs[r];
+                if (ref->var == v && resolve_ref(engine, ref, &engine->defs, NULL) != ref->value) {
+                    dirty[d] = true;
+                    first = d < first ? d : first;
+                }
+            }
+        }
+    }
+
+    if (first == count) {
+        arena_free(&scratch);
+        return RESULT_OK;
+    }
+
+    // a definition only reads earlier ones, so ascending order visits every definition after
+    // everything it depends on; nothing is committed until they all assembled
+    char **staged = arena_alloc_zeroed(&scratch, count * sizeof(*staged));
+    engine_ref_t **staged_refs = arena_alloc_zeroed(&scratch, count * sizeof(*staged_refs));
+    buf_t value = {.arena = &scratch};
+
+    for (size_t d = first; d < count; ++d) {
+        if (!dirty[d]) {
+            continue;
+        }
+
+        const engine_def_t *def = &engine->defs.items[d];
+        engine_ref_t *refs = arena_memdup(&scratch, def->refs, def->ref_count * sizeof(*refs));
+        for (size_t r = 0; r < def->ref_count; ++r) {
+            refs[r].value = resolve_ref(engine, &refs[r], &engine->defs, staged);
+        }
+
+        if (same_refs(refs, def->ref_count, def->refs, def->ref_count)) {
+            continue;
+        }
+
+        char *assembled = NULL;
+        result_t result = assemble_def(engine, arena, &engine->tokens, def, refs, &value, &assembled);
+        if (!result.ok) {
+            arena_free(&scratch);
+            return result;
+        }
+
+        staged_refs[d] = refs;
+        if (strcmp(assembled, def->value) == 0) {
+            continue;
+        }
+
+        staged[d] = assembled;
+        for (size_t i = 0; i < def->readers.count; ++i) {
+            dirty[def->readers.items[i]] = true;
+        }
+    }
+
+    // a value the environment still shadows changes nothing that's emitted
+    env_map_t env_map = engine->env_map;
+    env_map.items = arena_memdup(&scratch, engine->env_map.items, env_map.count * sizeof(*env_map.items));
+    for (size_t i = 0; i < env_map.count; ++i) {
+        const char *key = env_map.items[i].key;
+        size_t last = hashmap_get(&engine->last_defs, key, strlen(key));
+        if (staged[last] != NULL) {
+            env_map.items[i].value = staged[last];
+            DYN_ARR_APPEND(arena, changed, key);
+        }
+    }
+
+    result_t result = check_env_map(engine->args, &env_map);
+    if (!result.ok) {
+        *changed = (list_t){0};
+        arena_free(&scratch);
+        return result;
+    }
+
+    for (size_t d = first; d < count; ++d) {
+        engine_def_t *def = &engine->defs.items[d];
+        if (staged_refs[d] != NULL) {
+            memcpy(def->refs, staged_refs[d], def->ref_count * sizeof(*def->refs));
+        }
+        if (staged[d] != NULL) {
+            def->value = staged[d];
+        }
+    }
+    for (size_t i = 0; i < env_map.count; ++i) {
+        engine->env_map.items[i].value = env_map.items[i].value;
+    }
+
+    arena_free(&scratch);
+    return RESULT_OK;
+}
+
+void engine_free(engine_t *engine) {
+    arena_free(&engine->generation_arena);
+    arena_free(&engine->arena);
+    *engine = (engine_t){0};
+}
@@ -0,0 +1,104 @@
+#ifndef ENGINE_H
+#define ENGINE_H
+
+#include "arena.h"
+#include "arg.h"
+#include "hashmap.h"
+#include "parser.h"
+#include "result.h"
+#include "tokenizer.h"
+#include <stddef.h>
+
+// The incremental parse engine evaluates tokens exactly like run_parser, but keeps every
+// definition (a token with a key, or a keyless one with a value: assembled so its
+// interpolations are checked, but never emitted) with its value and, for each ${KEY} it
+// interpolates, what the key resolved to: a process variable, or else the latest earlier
+// definition of the key. Those references form a dependency graph, so a long-lived consumer
+// (`nvi --watch`) can re-resolve after a change without assembling every value again:
+//
+// - engine_update takes the whole token list again after some files were tokenized again,
+//   and still walks every token to rebuild the definitions and their references, so it is
+//   O(all tokens). What it saves is assembly: a definition keeps its value when the previous
+//   generation has an identical definition of the key (the same value tokens; an offset
+//   comparison for files that weren't tokenized again, whose pools are shared) whose references
+//   resolved to the same values. Only the others are assembled again, in order, so their dependents see the new
+//   values.
+// - engine_refresh_env reads the interpolated process variables again and re-evaluates only
+//   the definitions that read a changed one, then the definitions that read those.
+//
+// Both functions list the keys whose emitted value changed, appeared or disappeared, and
+// keep the previous results when they fail.
+//
+// Each update builds its generation in a fresh arena and frees the previous generation's
+// once it succeeds, copying the values it kept, so memory stays at about two generations
+// however long a consumer keeps updating. The process variables live in the engine's own
+// arena. A generation keeps its own copy of the token arrays, but borrows the pools holding
+// their keys and values, so those must outlive it (until the next successful update).
+
+#define ENGINE_NONE SIZE_MAX
+
+typedef struct {
+    size_t *items;
+    size_t count;
+    size_t capacity;
+} index_list_t;
+
+typedef struct {
+    const char *key;
+    const char *value;    // as last read; NULL while unset
+    size_t generation;    // when 'value' was last read
+    index_list_t readers; // the definitions that interpolate it
+} engine_var_t;
+
+typedef struct {
+    engine_var_t *items;
+    size_t count;
+    size_t capacity;
+    hashmap_t index;
+} engine_vars_t;
+
+typedef struct {
+    size_t var;         // the process variable named by the interpolated key
+    size_t binding;     // the latest earlier definition of the key, or ENGINE_NONE
+    const char *value;  // what it resolved to; NULL when undefined
+} engine_ref_t;
+
+typedef struct {
+    size_t token;    // its index in the generation's tokens
+    const char *key; // borrowed from its token's pool; NULL for a keyless definition
+    char *value;
+    engine_ref_t *refs;
+    size_t ref_count;
+    size_t prev;          // the previous definition of the same key, or ENGINE_NONE
+    index_list_t readers; // the later definitions that read this one
+} engine_def_t;
+
+typedef struct {
+    engine_def_t *items;
+    size_t count;
+    size_t capacity;
+} engine_defs_t;
+
+typedef struct {
+    arena_t arena;            // the process variables, for the engine's lifetime
+    arena_t generation_arena; // the committed generation: tokens, definitions, values, env map, readers
+    const args_t *args;
+    token_list_t tokens; // the committed generation's
+    engine_defs_t defs;
+    hashmap_t last_defs; // key -> its last definition, the one the env map emits
+    engine_vars_t vars;
+    env_map_t env_map;
+    size_t generation;
+    size_t evaluated; // definitions the last update or refresh assembled
+} engine_t;
+
+// Evaluates 'tokens' as the next generation; the first update evaluates everything.
+// 'changed' is allocated with the generation, so it lasts until the next update.
+result_t engine_update(engine_t *engine, const args_t *args, const token_list_t *tokens, list_t *changed);
+
+// Re-evaluates the definitions whose interpolated process variables changed
+result_t engine_refresh_env(engine_t *engine, list_t *changed);
+
+void engine_free(engine_t *engine);
+
+#endif // ENGINE_H
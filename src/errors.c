@@ -1,3 +1,4 @@
+#include "log.h"
 #include "result.h"
 #include "tty.h"
 #include <stdarg.h>
@@ -9,12 +10,12 @@ result_t operation_error(const char *fmt, ...) {
     va_start(args, fmt);
 
     if (use_color) {
-        fprintf(stderr, RED);
+        fprintf(diag_stream(), RED);
     }
-    fprintf(stderr, "[ERROR] ");
-    vfprintf(stderr, fmt, args);
+    fprintf(diag_stream(), "[ERROR] ");
+    vfprintf(diag_stream(), fmt, args);
     if (use_color) {
-        fprintf(stderr, RESET);
+        fprintf(diag_stream(), RESET);
     }
 
     va_end(args);
@@ -27,14 +28,14 @@ result_t usage_error(const char *fmt, ...) {
     va_start(args, fmt);
 
     if (use_color) {
-        fprintf(stderr, RED);
+        fprintf(diag_stream(), RED);
     }
-    fprintf(stderr, "[ERROR] ");
-    vfprintf(stderr, fmt, args);
+    fprintf(diag_stream(), "[ERROR] ");
+    vfprintf(diag_stream(), fmt, args);
     if (use_color) {
-        fprintf(stderr, RESET);
+        fprintf(diag_stream(), RESET);
     }
-    fprintf(stderr, "\nTry 'nvi --help' for more information.\n");
+    fprintf(diag_stream(), "\nTry 'nvi --help' for more information.\n");
 
     va_end(args);
 
@@ -1,5 +1,7 @@
 #include "file.h"
 #include "arena.h"
+#include "buf.h"
+#include "dynarr.h"
 #include "log.h"
 #include <errno.h>
 #include <stdbool.h>
@@ -38,64 +40,173 @@ static void close_file(int fd) { close(fd); }
 
 #endif
 
-file_details_t open_file(arena_t *arena, const char *path) {
-    file_details_t file_details = {0};
-    file_details.path = path;
+// Reads up to 'size' bytes of 'fd' into 'buf'; false (with errno set) on a read error
+static bool read_fully(int fd, char *buf, size_t size, size_t *len) {
+    size_t total = 0;
+    while (total < size) {
+        long n = read_file(fd, buf + total, size - total);
+
+        if (n < 0) {
+#if !defined(_WIN32)
+            if (errno == EINTR) {
+                continue;
+            }
+#endif
+            return false;
+        }
+
+        if (n == 0) {
+            break;
+        }
+
+        total += (size_t)n;
+    }
+
+    *len = total;
+    return true;
+}
+
+// Reads up to 'size' bytes of 'fd' into a NUL-terminated buffer; NULL (with errno set) on a read error
+static char *read_contents(arena_t *arena, int fd, size_t size, size_t *len) {
+    char *contents = arena_alloc(arena, size + 1);
+    if (!read_fully(fd, contents, size, len)) {
+        return NULL;
+    }
+
+    contents[*len] = '\0';
+    return contents;
+}
+
+bool open_file_stream(const char *path, file_stream_t *stream) {
+    *stream = (file_stream_t){.fd = -1, .path = path};
 
     int fd = open_file_rdo(path);
     if (fd < 0) {
         log_error(SINK_STDERR, "[ERROR] Unable to open '%s' (not a valid file?)\n", path);
-        return file_details;
+        return false;
     }
 
     struct stat st;
     if (fstat(fd, &st) != 0) {
         log_error(SINK_STDERR, "[ERROR] Cannot read '%s' file: %s\n", path, strerror(errno));
-        goto done;
+        close_file(fd);
+        return false;
     }
 
     if (!S_ISREG(st.st_mode)) {
         log_error(SINK_STDERR, "[ERROR] Unable to open '%s' (not a valid file?)", path);
-        goto done;
+        close_file(fd);
+        return false;
+    }
+
+    stream->fd = fd;
+    stream->size = (size_t)st.st_size;
+    return true;
+}
+
+file_details_t read_file_stream_contents(arena_t *arena, file_stream_t *stream) {
+    file_details_t file_details = {.path = stream->path, .size = stream->size};
+
+    file_details.contents = read_contents(arena, stream->fd, stream->size, &file_details.len);
+    if (file_details.contents == NULL) {
+        log_error(SINK_STDERR, "[ERROR] Cannot read '%s' file: %s\n", stream->path, strerror(errno));
     }
 
-    size_t file_size = (size_t)st.st_size;
+    return file_details;
+}
+
+file_details_t open_file(arena_t *arena, const char *path) {
+    file_details_t file_details = {.path = path};
+
+    file_stream_t stream;
+    if (!open_file_stream(path, &stream)) {
+        return file_details;
+    }
 
-    if (file_size > MAX_FILE_SIZE) {
+    if (stream.size > MAX_FILE_SIZE) {
         log_warning(SINK_STDERR, "[WARNING] The file '%s' exceeds %zu bytes; skipping.\n", path, MAX_FILE_SIZE);
-        goto done;
+        file_details.size = stream.size;
+    } else {
+        file_details = read_file_stream_contents(arena, &stream);
     }
 
-    file_details.contents = arena_alloc(arena, file_size + 1);
+    close_file_stream(&stream);
+    return file_details;
+}
 
-    size_t total = 0;
-    while (total < file_size) {
-        long n = read_file(fd, file_details.contents + total, file_size - total);
+bool read_file_stream(file_stream_t *stream, char *buf, size_t cap, size_t *len) {
+    if (!read_fully(stream->fd, buf, cap, len)) {
+        log_error(SINK_STDERR, "[ERROR] Cannot read '%s' file: %s\n", stream->path, strerror(errno));
+        return false;
+    }
 
-        if (n < 0) {
-#if !defined(_WIN32)
-            if (errno == EINTR) {
-                continue;
-            }
-#endif
-            log_error(SINK_STDERR, "[ERROR] Cannot read '%s' file: %s\n", path, strerror(errno));
-            file_details.contents = NULL;
-            goto done;
-        }
+    return true;
+}
 
-        if (n == 0) {
-            break;
-        }
+void close_file_stream(file_stream_t *stream) {
+    if (stream->fd >= 0) {
+        close_file(stream->fd);
+        stream->fd = -1;
+    }
+}
 
-        total += (size_t)n;
+bool read_whole_file(arena_t *arena, const char *path, char **contents, size_t *len) {
+    int fd = open_file_rdo(path);
+    if (fd < 0) {
+        return false;
     }
 
-    file_details.len = total;
-    if (file_details.contents != NULL) {
-        file_details.contents[total] = '\0';
+    struct stat st;
+    *contents = NULL;
+    if (fstat(fd, &st) == 0 && S_ISREG(st.st_mode)) {
+        *contents = read_contents(arena, fd, (size_t)st.st_size, len);
     }
 
-done:
     close_file(fd);
-    return file_details;
+    return *contents != NULL;
+}
+
+bool read_stream(arena_t *arena, FILE *stream, char **contents, size_t *len) {
+    buf_t buf = {.arena = arena};
+    char chunk[4096];
+    size_t n;
+    while ((n = fread(chunk, 1, sizeof(chunk), stream)) > 0) {
+        DYN_ARR_APPEND_MANY(arena, &buf, chunk, n);
+    }
+
+    if (ferror(stream)) {
+        return false;
+    }
+
+    DYN_ARR_APPEND(arena, &buf, '\0');
+    *contents = buf.items;
+    *len = buf.count - 1;
+    return true;
+}
+
+bool get_file_identity(const char *path, file_identity_t *id) {
+    struct stat st;
+    if (stat(path, &st) != 0 || !S_ISREG(st.st_mode)) {
+        return false;
+    }
+
+    memset(id, 0, sizeof(*id));
+    id->dev = (uint64_t)st.st_dev;
+    id->ino = (uint64_t)st.st_ino;
+    id->size = (uint64_t)st.st_size;
+    id->mtime_sec = (int64_t)st.st_mtime;
+    id->ctime_sec = (int64_t)st.st_ctime;
+#if defined(__APPLE__)
+    id->mtime_nsec = (int64_t)st.st_mtimespec.tv_nsec;
+    id->ctime_nsec = (int64_t)st.st_ctimespec.tv_nsec;
+#elif !defined(_WIN32)
+    id->mtime_nsec = (int64_t)st.st_mtim.tv_nsec;
+    id->ctime_nsec = (int64_t)st.st_ctim.tv_nsec;
+#endif
+    return true;
+}
+
+bool same_file_identity(const file_identity_t *a, const file_identity_t *b) {
+    return a->dev == b->dev && a->ino == b->ino && a->size == b->size && a->mtime_sec == b->mtime_sec &&
+           a->mtime_nsec == b->mtime_nsec && a->ctime_sec == b->ctime_sec && a->ctime_nsec == b->ctime_nsec;
 }
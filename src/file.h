@@ -2,7 +2,10 @@
 #define FILE_H
 
 #include "arena.h"
+#include <stdbool.h>
 #include <stddef.h>
+#include <stdint.h>
+#include <stdio.h>
 
 #define MAX_FILE_SIZE ((size_t)10 * 1024 * 1024)
 
@@ -35,8 +38,50 @@ typedef struct {
     char *contents;
     const char *path;
     size_t len;
+    size_t size; // on-disk size from fstat; lets callers tell an oversized skip from a failed read
 } file_details_t;
 
+// What a stat says about a file's contents: when none of it changed, neither did they
+typedef struct {
+    uint64_t dev;
+    uint64_t ino;
+    uint64_t size;
+    int64_t mtime_sec;
+    int64_t mtime_nsec;
+    int64_t ctime_sec;
+    int64_t ctime_nsec;
+} file_identity_t;
+
 file_details_t open_file(arena_t *arena, const char *path);
 
+// An open file of any size, read whole or a window at a time
+typedef struct {
+    int fd;
+    const char *path;
+    size_t size;
+} file_stream_t;
+
+// Opens 'path' and takes its size, so a caller can decide how to read it; false (after logging
+// why, like open_file) when it isn't a readable regular file
+bool open_file_stream(const char *path, file_stream_t *stream);
+
+// Reads all of an opened file (up to the size it had when opened) like open_file does
+file_details_t read_file_stream_contents(arena_t *arena, file_stream_t *stream);
+
+// Fills 'buf' with up to 'cap' bytes, fewer only at the end of the file; false on a read error
+bool read_file_stream(file_stream_t *stream, char *buf, size_t cap, size_t *len);
+
+void close_file_stream(file_stream_t *stream);
+
+// Quietly reads all of 'path' into a NUL-terminated buffer, without open_file's size cap;
+// false when it isn't a readable regular file
+bool read_whole_file(arena_t *arena, const char *path, char **contents, size_t *len);
+
+// Reads 'stream' up to its end into a NUL-terminated buffer; false on a read error
+bool read_stream(arena_t *arena, FILE *stream, char **contents, size_t *len);
+
+// False when 'path' can't be stat'ed or isn't a regular file
+bool get_file_identity(const char *path, file_identity_t *id);
+bool same_file_identity(const file_identity_t *a, const file_identity_t *b);
+
 #endif // FILE_H
@@ -0,0 +1,210 @@
+#include "gitindex.h"
+#include "arena.h"
+#include "buf.h"
+#include "dynarr.h"
+#include "errors.h"
+#include "file.h"
+#include "result.h"
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+
+#define INDEX_SIGNATURE "DIRC"
+#define INDEX_HEADER_LEN 12
+
+// ctime, mtime, dev, ino, mode, uid, gid and size precede an entry's object id
+#define ENTRY_STAT_LEN 40
+#define ENTRY_MODE_OFFSET 24
+
+#define FLAG_EXTENDED 0x4000
+#define FLAG_STAGE_SHIFT 12
+#define FLAG_NAME_MASK 0x0FFF
+#define EXTENDED_SKIP_WORKTREE 0x4000
+
+#define MODE_TYPE_MASK 0170000
+#define MODE_REGULAR 0100000
+
+#define GITDIR_PREFIX "gitdir: "
+
+static uint32_t read_be32(const char *p) {
+    const unsigned char *b = (const unsigned char *)p;
+    return ((uint32_t)b[0] << 24) | ((uint32_t)b[1] << 16) | ((uint32_t)b[2] << 8) | (uint32_t)b[3];
+}
+
+static uint16_t read_be16(const char *p) {
+    const unsigned char *b = (const unsigned char *)p;
+    return (uint16_t)((b[0] << 8) | b[1]);
+}
+
+// git's offset varint: every continuation adds one before shifting, so each value has
+// exactly one encoding
+static bool read_varint(const char *data, size_t len, size_t *pos, size_t *value) {
+    if (*pos >= len) {
+        return false;
+    }
+
+    unsigned char c = (unsigned char)data[(*pos)++];
+    size_t v = c & 0x7F;
+    while (c & 0x80) {
+        if (*pos >= len || v > (SIZE_MAX >> 8)) {
+            return false;
+        }
+
+        c = (unsigned char)data[(*pos)++];
+        v = ((v + 1) << 7) | (c & 0x7F);
+    }
+
+    *value = v;
+    return true;
+}
+
+// Returns NULL when every entry parsed, otherwise what's wrong with the index
+static const char *parse_entries(arena_t *arena, const char *data, size_t len, size_t hash_len, git_paths_t *paths) {
+    if (len < INDEX_HEADER_LEN || memcmp(data, INDEX_SIGNATURE, 4) != 0) {
+        return "missing the index signature";
+    }
+
+    uint32_t version = read_be32(data + 4);
+    if (version < 2 || version > 4) {
+        return "unsupported index version";
+    }
+
+    uint32_t count = read_be32(data + 8);
+    size_t pos = INDEX_HEADER_LEN;
+    size_t fixed_len = ENTRY_STAT_LEN + hash_len + 2;
+
+    // version 4 paths are the previous path minus a suffix plus a new one
+    buf_t path = {.arena = arena};
+    const char *last = NULL;
+
+    for (uint32_t i = 0; i < count; ++i) {
+        if (len - pos < fixed_len) {
+            return "truncated entry";
+        }
+
+        size_t entry = pos;
+        uint32_t mode = read_be32(data + entry + ENTRY_MODE_OFFSET);
+        uint16_t flags = read_be16(data + entry + ENTRY_STAT_LEN + hash_len);
+        pos += fixed_len;
+
+        uint16_t extended = 0;
+        if (flags & FLAG_EXTENDED) {
+            if (version < 3 || len - pos < 2) {
+                return "invalid extended flags";
+            }
+            extended = read_be16(data + pos);
+            pos += 2;
+        }
+
+        const char *name;
+        size_t name_len;
+        if (version < 4) {
+            const char *nul = memchr(data + pos, '\0', len - pos);
+            if (nul == NULL) {
+                return "unterminated path";
+            }
+
+            name = data + pos;
+            name_len = (size_t)(nul - name);
+            if ((flags & FLAG_NAME_MASK) != FLAG_NAME_MASK && name_len != (flags & FLAG_NAME_MASK)) {
+                return "path length mismatch";
+            }
+
+            // entries are NUL-padded to a multiple of 8 bytes
+            size_t entry_len = (pos - entry + name_len + 8) & ~(size_t)7;
+            if (entry_len > len - entry) {
+                return "truncated entry";
+            }
+            pos = entry + entry_len;
+        } else {
+            size_t strip;
+            if (!read_varint(data, len, &pos, &strip) || strip > path.count) {
+                return "invalid path prefix";
+            }
+
+            const char *nul = memchr(data + pos, '\0', len - pos);
+            if (nul == NULL) {
+                return "unterminated path";
+            }
+
+            path.count -= strip;
+            DYN_ARR_APPEND_MANY(arena, &path, data + pos, (size_t)(nul - (data + pos)) + 1);
+            --path.count;
+            pos = (size_t)(nul - data) + 1;
+            name = path.items;
+            name_len = path.count;
+        }
+
+        // conflicted paths have one entry per stage, next to each other
+        unsigned stage = (flags >> FLAG_STAGE_SHIFT) & 3;
+        if (stage != 0 && last != NULL && strlen(last) == name_len && memcmp(last, name, name_len) == 0) {
+            continue;
+        }
+
+        if ((mode & MODE_TYPE_MASK) != MODE_REGULAR || (extended & EXTENDED_SKIP_WORKTREE) || name_len == 0) {
+            continue;
+        }
+
+        last = version < 4 ? name : arena_strndup(arena, name, name_len);
+        DYN_ARR_APPEND(arena, paths, last);
+    }
+
+    return NULL;
+}
+
+result_t parse_git_index(arena_t *arena, const char *data, size_t len, size_t hash_len, git_paths_t *paths) {
+    const char *problem = parse_entries(arena, data, len, hash_len, paths);
+    if (problem != NULL) {
+        return operation_error("Unable to parse the git index (%s).\n", problem);
+    }
+
+    return RESULT_OK;
+}
+
+// '.git' is either the git directory or, in a linked worktree, a file pointing to it
+static const char *get_index_path(arena_t *arena) {
+    char *contents;
+    size_t len;
+    if (!read_whole_file(arena, ".git", &contents, &len)) {
+        return ".git" PATH_SEP "index";
+    }
+
+    size_t prefix_len = strlen(GITDIR_PREFIX);
+    if (len <= prefix_len || memcmp(contents, GITDIR_PREFIX, prefix_len) != 0) {
+        return NULL;
+    }
+
+    char *dir = contents + prefix_len;
+    dir[strcspn(dir, "\r\n")] = '\0';
+
+    size_t size = strlen(dir) + sizeof(PATH_SEP "index");
+    char *path = arena_alloc(arena, size);
+    snprintf(path, size, "%s" PATH_SEP "index", dir);
+    return path;
+}
+
+result_t read_git_index(arena_t *arena, git_paths_t *paths) {
+    const char *index_path = get_index_path(arena);
+    if (index_path == NULL) {
+        return operation_error("Unable to locate the git directory named by '.git'.\n");
+    }
+
+    char *data;
+    size_t len;
+    if (!read_whole_file(arena, index_path, &data, &len)) {
+        return operation_error("Unable to read the git index at '%s' (scanning from the git index must run from "
+                               "the top of a git checkout).\n",
+                               index_path);
+    }
+
+    // the index doesn't record its object id size: SHA-256 entries won't line up as SHA-1 ones
+    const char *problem = parse_entries(arena, data, len, 20, paths);
+    if (problem != NULL) {
+        paths->count = 0;
+        if (parse_entries(arena, data, len, 32, paths) != NULL) {
+            return operation_error("Unable to parse the git index at '%s' (%s).\n", index_path, problem);
+        }
+    }
+
+    return RESULT_OK;
+}
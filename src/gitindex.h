@@ -0,0 +1,28 @@
+#ifndef GITINDEX_H
+#define GITINDEX_H
+
+#include "arena.h"
+#include "result.h"
+#include <stddef.h>
+
+// Reads the tracked files of a git checkout straight from its index file, without a git
+// binary. Versions 2 to 4 are supported (4 prefix-compresses each path against the one before
+// it). Only regular files are listed: symlinks, submodules, sparse directories and entries
+// outside a sparse checkout (skip-worktree) are left out, and a path with conflict stages
+// is listed once.
+
+typedef struct {
+    const char **items; // relative to the top of the checkout, '/'-separated
+    size_t count;
+    size_t capacity;
+} git_paths_t;
+
+// Parses an index file image of 'len' bytes; 'hash_len' is the size of its object ids (20 for
+// SHA-1, 32 for SHA-256). The paths may point into 'data', which must outlive them.
+result_t parse_git_index(arena_t *arena, const char *data, size_t len, size_t hash_len, git_paths_t *paths);
+
+// Lists the tracked files of the checkout whose top is the CWD ('.git' may be a directory or,
+// in a linked worktree, a 'gitdir:' file)
+result_t read_git_index(arena_t *arena, git_paths_t *paths);
+
+#endif // GITINDEX_H
@@ -6,4 +6,10 @@
 
 uint64_t fnv1a(const char *key, size_t len);
 
+// Probe sequences run (lookups and inserts) and the slots they examined, for --stats
+typedef struct {
+    size_t lookups;
+    size_t probes;
+} probe_counts_t;
+
 #endif // HASH_H
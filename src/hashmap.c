@@ -62,11 +62,18 @@ static size_t hashmap_probe(const hashmap_t *map, const char *key, size_t len, u
     size_t mask = map->capacity - 1;
     size_t i = hash & mask;
 
+    size_t probes = 1;
     while (map->items[i].key != NULL) {
         if (map->items[i].hash == hash && map->items[i].len == len && memcmp(map->items[i].key, key, len) == 0) {
             break;
         }
         i = (i + 1) & mask;
+        ++probes;
+    }
+
+    if (map->counts != NULL) {
+        ++map->counts->lookups;
+        map->counts->probes += probes;
     }
 
     return i;
@@ -2,6 +2,7 @@
 #define HASHMAP_H
 
 #include "arena.h"
+#include "hash.h"
 #include <stddef.h>
 #include <stdint.h>
 
@@ -19,6 +20,7 @@ typedef struct {
     hashmap_entry_t *items;
     size_t capacity;
     size_t count;
+    probe_counts_t *counts; // set only with --stats; probes aren't counted while it's NULL
 } hashmap_t;
 
 // Returns the stored value, or HASHMAP_NOT_FOUND if the key is absent.
@@ -48,11 +48,18 @@ static size_t hashset_probe(const hashset_t *set, const char *key, size_t len, u
     size_t mask = set->capacity - 1;
     size_t i = hash & mask;
 
+    size_t probes = 1;
     while (set->items[i].key != NULL) {
         if (set->items[i].hash == hash && set->items[i].len == len && memcmp(set->items[i].key, key, len) == 0) {
             break;
         }
         i = (i + 1) & mask;
+        ++probes;
+    }
+
+    if (set->counts != NULL) {
+        ++set->counts->lookups;
+        set->counts->probes += probes;
     }
 
     return i;
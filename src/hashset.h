@@ -2,6 +2,7 @@
 #define HASHSET_H
 
 #include "arena.h"
+#include "hash.h"
 #include <stdbool.h>
 #include <stddef.h>
 #include <stdint.h>
@@ -17,6 +18,7 @@ typedef struct {
     hashset_entry_t *items;
     size_t capacity;
     size_t count;
+    probe_counts_t *counts; // set only with --stats; probes aren't counted while it's NULL
 } hashset_t;
 
 bool hashset_contains(const hashset_t *set, const char *key, size_t len);
@@ -0,0 +1,321 @@
+#include "ignore.h"
+#include "arena.h"
+#include "chars.h"
+#include "dynarr.h"
+#include "file.h"
+#include "macros.h"
+#include "utils.h"
+#include <stdio.h>
+#include <string.h>
+
+// later files win over earlier ones in the same directory
+static const char *ignore_files[] = {".gitignore", ".nviignore"};
+
+static bool has_glob_meta(const char *s, size_t len) {
+    for (size_t i = 0; i < len; ++i) {
+        if (s[i] == '*' || s[i] == '?' || s[i] == '[' || s[i] == BACK_SLASH) {
+            return true;
+        }
+    }
+
+    return false;
+}
+
+static bool has_slash(const char *s, size_t len) { return memchr(s, FORWARD_SLASH, len) != NULL; }
+
+// a pattern's '/' matches either separator, so one rule works on every platform
+static bool same_path(const char *pattern, const char *s, size_t len) {
+    for (size_t i = 0; i < len; ++i) {
+        if (pattern[i] == FORWARD_SLASH ? !is_path_sep(s[i]) : pattern[i] != s[i]) {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+// Matches 'c' against the class opening at 'p' ('[' itself) and points 'next' past its ']';
+// returns -1 when the class is never closed, so the '[' is a literal
+static int match_class(const char *p, const char *pend, char c, const char **next) {
+    const char *q = p + 1;
+    bool negated = q < pend && (*q == '!' || *q == '^');
+    if (negated) {
+        ++q;
+    }
+
+    const char *first = q;
+    bool matched = false;
+    while (q < pend && (*q != ']' || q == first)) {
+        unsigned char lo = (unsigned char)*q;
+        if (lo == BACK_SLASH && q + 1 < pend) {
+            lo = (unsigned char)*++q;
+        }
+
+        unsigned char hi = lo;
+        if (q + 2 < pend && q[1] == DASH && q[2] != ']') {
+            q += 2;
+            hi = (unsigned char)*q;
+            if (hi == BACK_SLASH && q + 1 < pend) {
+                hi = (unsigned char)*++q;
+            }
+        }
+
+        matched |= (unsigned char)c >= lo && (unsigned char)c <= hi;
+        ++q;
+    }
+
+    if (q == pend) {
+        return -1;
+    }
+
+    *next = q + 1;
+    return matched != negated;
+}
+
+static bool glob_match_from(const char *start, const char *p, const char *pend, const char *s, const char *send) {
+    while (p < pend) {
+        if (*p == '*') {
+            const char *stars = p;
+            while (p < pend && *p == '*') {
+                ++p;
+            }
+
+            // '**' is only special as a whole segment: "**/", "/**/" and "/**"
+            bool segment = (stars == start || stars[-1] == FORWARD_SLASH) && (p == pend || *p == FORWARD_SLASH);
+            if (p - stars >= 2 && segment) {
+                if (p == pend) {
+                    return true;
+                }
+
+                // zero or more directories
+                ++p;
+                for (;;) {
+                    if (glob_match_from(start, p, pend, s, send)) {
+                        return true;
+                    }
+
+                    while (s < send && !is_path_sep(*s)) {
+                        ++s;
+                    }
+
+                    if (s == send) {
+                        return false;
+                    }
+
+                    ++s;
+                }
+            }
+
+            // any run of a single segment's bytes
+            for (;;) {
+                if (glob_match_from(start, p, pend, s, send)) {
+                    return true;
+                }
+
+                if (s == send || is_path_sep(*s)) {
+                    return false;
+                }
+
+                ++s;
+            }
+        }
+
+        if (s == send) {
+            return false;
+        }
+
+        if (*p == '?') {
+            if (is_path_sep(*s)) {
+                return false;
+            }
+            ++p;
+            ++s;
+            continue;
+        }
+
+        if (*p == '[') {
+            const char *next = NULL;
+            int matched = match_class(p, pend, *s, &next);
+            if (matched >= 0) {
+                if (matched == 0 || is_path_sep(*s)) {
+                    return false;
+                }
+                p = next;
+                ++s;
+                continue;
+            }
+        }
+
+        if (*p == BACK_SLASH && p + 1 < pend) {
+            ++p;
+        }
+
+        if (*p == FORWARD_SLASH ? !is_path_sep(*s) : *p != *s) {
+            return false;
+        }
+
+        ++p;
+        ++s;
+    }
+
+    return s == send;
+}
+
+bool glob_match(const char *pattern, size_t pattern_len, const char *s, size_t len) {
+    return glob_match_from(pattern, pattern, pattern + pattern_len, s, s + len);
+}
+
+static void compile_ignore_line(arena_t *arena, ignore_t *ignore, const char *s, const char *e) {
+    if (e > s && e[-1] == CARRIAGE_RETURN) {
+        --e;
+    }
+
+    // trailing spaces don't count unless escaped
+    while (e > s && e[-1] == SPACE && !(e - 1 > s && e[-2] == BACK_SLASH)) {
+        --e;
+    }
+
+    if (s == e || *s == HASH) {
+        return;
+    }
+
+    ignore_rule_t rule = {0};
+    if (*s == '!') {
+        rule.negated = true;
+        ++s;
+    }
+
+    if (s >= e) {
+        return;
+    }
+
+    if (e > s && e[-1] == FORWARD_SLASH) {
+        rule.dir_only = true;
+        --e;
+    }
+
+    rule.anchored = has_slash(s, (size_t)(e - s));
+    if (e > s && *s == FORWARD_SLASH) {
+        ++s;
+    }
+
+    // "**/name" matches 'name' at any depth, exactly like an unanchored "name"
+    while (e - s > 3 && memcmp(s, "**/", 3) == 0 && !has_slash(s + 3, (size_t)(e - s - 3))) {
+        rule.anchored = false;
+        s += 3;
+    }
+
+    if (s == e) {
+        return;
+    }
+
+    size_t len = (size_t)(e - s);
+    if (!has_glob_meta(s, len)) {
+        rule.kind = IGNORE_LITERAL;
+        rule.pattern = s;
+        rule.len = len;
+    } else if (!rule.anchored && len > 1 && *s == '*' && !has_glob_meta(s + 1, len - 1)) {
+        rule.kind = IGNORE_SUFFIX;
+        rule.pattern = s + 1;
+        rule.len = len - 1;
+    } else if (!rule.anchored && len > 1 && e[-1] == '*' && !has_glob_meta(s, len - 1)) {
+        rule.kind = IGNORE_PREFIX;
+        rule.pattern = s;
+        rule.len = len - 1;
+    } else {
+        rule.kind = IGNORE_GLOB;
+        rule.pattern = s;
+        rule.len = len;
+    }
+
+    DYN_ARR_APPEND(arena, ignore, rule);
+}
+
+void compile_ignore_rules(arena_t *arena, ignore_t *ignore, const char *src, size_t len) {
+    const char *end = src + len;
+    while (src < end) {
+        const char *eol = memchr(src, LINE_DELIMITER, (size_t)(end - src));
+        if (eol == NULL) {
+            eol = end;
+        }
+
+        compile_ignore_line(arena, ignore, src, eol);
+        src = eol + 1;
+    }
+}
+
+const ignore_t *load_ignore(arena_t *arena, const ignore_t *parent, const char *dir) {
+    ignore_t *ignore = NULL;
+    char path[PATH_MAX];
+
+    for (size_t i = 0; i < ARR_LEN(ignore_files); ++i) {
+        int n = snprintf(path, sizeof(path), "%s" PATH_SEP "%s", dir, ignore_files[i]);
+        if (n < 0 || (size_t)n >= sizeof(path)) {
+            continue;
+        }
+
+        char *contents;
+        size_t len;
+        if (!read_whole_file(arena, path, &contents, &len) || len == 0) {
+            continue;
+        }
+
+        if (ignore == NULL) {
+            ignore = arena_alloc_zeroed(arena, sizeof(*ignore));
+            ignore->parent = parent;
+            ignore->base_len = strlen(dir) + 1;
+        }
+
+        compile_ignore_rules(arena, ignore, contents, len);
+    }
+
+    return ignore != NULL && ignore->count > 0 ? ignore : parent;
+}
+
+static bool match_rule(const ignore_rule_t *rule, const char *s, size_t len) {
+    switch (rule->kind) {
+        case IGNORE_LITERAL: {
+            return len == rule->len && same_path(rule->pattern, s, len);
+        }
+        case IGNORE_SUFFIX: {
+            return len >= rule->len && memcmp(s + len - rule->len, rule->pattern, rule->len) == 0;
+        }
+        case IGNORE_PREFIX: {
+            return len >= rule->len && memcmp(s, rule->pattern, rule->len) == 0;
+        }
+        case IGNORE_GLOB: {
+            return glob_match(rule->pattern, rule->len, s, len);
+        }
+    }
+
+    return false;
+}
+
+bool is_ignored(const ignore_t *ignore, const char *path, const char *name, bool is_dir) {
+    if (ignore == NULL) {
+        return false;
+    }
+
+    size_t path_len = strlen(path);
+    size_t name_len = strlen(name);
+
+    // the deepest directory's rules decide first, and within it the last matching rule
+    for (; ignore != NULL; ignore = ignore->parent) {
+        const char *rel = path + ignore->base_len;
+        size_t rel_len = path_len - ignore->base_len;
+
+        for (size_t i = ignore->count; i-- > 0;) {
+            const ignore_rule_t *rule = &ignore->items[i];
+            if (rule->dir_only && !is_dir) {
+                continue;
+            }
+
+            bool matched = rule->anchored ? match_rule(rule, rel, rel_len) : match_rule(rule, name, name_len);
+            if (matched) {
+                return !rule->negated;
+            }
+        }
+    }
+
+    return false;
+}
@@ -0,0 +1,50 @@
+#ifndef IGNORE_H
+#define IGNORE_H
+
+#include "arena.h"
+#include <stdbool.h>
+#include <stddef.h>
+
+// .gitignore rules that prune the scan walk. As the walker enters a directory it compiles
+// that directory's .gitignore and .nviignore (whose rules win) into a link chained to its
+// parent directory's rules, so an entry is matched against every directory above it, deepest
+// first, and an ignored directory is never queued.
+//
+// Patterns follow gitignore(5): '#' comments, '!' negation, a trailing '/' for directories
+// only, a leading or inner '/' anchoring the pattern to its directory, and '*', '?', '[...]'
+// and '**' globs. Most patterns are a plain name, a '*.ext' suffix or a 'prefix*', which
+// compile to a direct comparison; only the rest run the glob matcher.
+
+typedef enum { IGNORE_LITERAL, IGNORE_SUFFIX, IGNORE_PREFIX, IGNORE_GLOB } ignore_kind_t;
+
+typedef struct {
+    const char *pattern; // the literal part, or the whole pattern for IGNORE_GLOB
+    size_t len;
+    ignore_kind_t kind;
+    bool negated;
+    bool dir_only;
+    bool anchored; // matched against the path below the rule's directory rather than the name
+} ignore_rule_t;
+
+typedef struct ignore_t {
+    const struct ignore_t *parent;
+    size_t base_len; // the length of the rule directory's path plus its separator
+    ignore_rule_t *items;
+    size_t count;
+    size_t capacity;
+} ignore_t;
+
+// Compiles each line of 'src' into a rule of 'ignore'; the rules point into 'src'
+void compile_ignore_rules(arena_t *arena, ignore_t *ignore, const char *src, size_t len);
+
+// Returns a new link of 'parent's chain with the rules of 'dir's ignore files, or 'parent'
+// itself when 'dir' has none
+const ignore_t *load_ignore(arena_t *arena, const ignore_t *parent, const char *dir);
+
+// Whether the entry 'name' at 'path' (a path below every directory of the chain) is ignored
+bool is_ignored(const ignore_t *ignore, const char *path, const char *name, bool is_dir);
+
+// Matches 's' against a gitignore glob; '*' and '?' never match a path separator
+bool glob_match(const char *pattern, size_t pattern_len, const char *s, size_t len);
+
+#endif // IGNORE_H
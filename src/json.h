@@ -0,0 +1,10 @@
+#ifndef JSON_H
+#define JSON_H
+
+#include <stdio.h>
+
+// Writes s as a quoted JSON string, escaping quotes, backslashes and control characters.
+// Bytes >= 0x80 pass through untouched, so UTF-8 paths stay readable.
+void json_write_string(FILE *f, const char *s);
+
+#endif // JSON_H
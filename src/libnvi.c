@@ -0,0 +1,342 @@
+#include "nvi.h"
+#include "accessors.h"
+#include "arena.h"
+#include "arg.h"
+#include "dynarr.h"
+#include "file.h"
+#include "lines.h"
+#include "log.h"
+#include "matcher.h"
+#include "parser.h"
+#include "result.h"
+#include "tokenizer.h"
+#include "version.h"
+#include <stdarg.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+struct nvi_arena {
+    arena_t arena;
+};
+
+struct nvi_env_map {
+    env_map_t map;
+    arena_t *arena; // the caller's, for the missing keys report
+};
+
+typedef struct {
+    const char *key;
+    size_t line;
+    size_t column;
+} nvi_key_t;
+
+struct nvi_keys {
+    nvi_key_t *items;
+    size_t count;
+};
+
+// Diagnostics written while a call runs are collected here instead of going to stderr. Each
+// call only reports its first failure, so the text is the diagnostic for that failure.
+typedef struct {
+    FILE *file;
+#if !defined(_WIN32)
+    char *text;
+    size_t len;
+#endif
+} capture_t;
+
+static void capture_begin(capture_t *capture) {
+#if defined(_WIN32)
+    capture->file = tmpfile();
+#else
+    capture->text = NULL;
+    capture->len = 0;
+    capture->file = open_memstream(&capture->text, &capture->len);
+#endif
+    set_diag_stream(capture->file);
+}
+
+static void set_message(nvi_error_t *error, const char *text, size_t len) {
+    while (len > 0 && (text[len - 1] == '\n' || text[len - 1] == ' ')) {
+        --len;
+    }
+    if (len > NVI_ERROR_MAX - 1) {
+        len = NVI_ERROR_MAX - 1;
+    }
+
+    memcpy(error->message, text, len);
+    error->message[len] = '\0';
+}
+
+static nvi_status_t capture_end(capture_t *capture, nvi_status_t status, nvi_error_t *error) {
+    set_diag_stream(NULL);
+    if (capture->file == NULL) {
+        return status;
+    }
+
+    char buf[NVI_ERROR_MAX];
+    size_t len = 0;
+#if defined(_WIN32)
+    rewind(capture->file);
+    len = fread(buf, 1, sizeof(buf), capture->file);
+    fclose(capture->file);
+#else
+    fclose(capture->file);
+    len = capture->len < sizeof(buf) ? capture->len : sizeof(buf);
+    if (len > 0) {
+        memcpy(buf, capture->text, len);
+    }
+    free(capture->text);
+#endif
+
+    if (error != NULL) {
+        error->status = status;
+        set_message(error, buf, status == NVI_OK ? 0 : len);
+    }
+
+    return status;
+}
+
+static nvi_status_t fail(nvi_error_t *error, nvi_status_t status, const char *fmt, ...) {
+    if (error != NULL) {
+        error->status = status;
+        va_list args;
+        va_start(args, fmt);
+        vsnprintf(error->message, sizeof(error->message), fmt, args);
+        va_end(args);
+    }
+
+    return status;
+}
+
+static nvi_status_t succeed(nvi_error_t *error) {
+    if (error != NULL) {
+        error->status = NVI_OK;
+        error->message[0] = '\0';
+    }
+
+    return NVI_OK;
+}
+
+nvi_arena_t *nvi_arena_create(void) { return calloc(1, sizeof(nvi_arena_t)); }
+
+void nvi_arena_reset(nvi_arena_t *arena) {
+    if (arena != NULL) {
+        arena_reset(&arena->arena);
+    }
+}
+
+void nvi_arena_destroy(nvi_arena_t *arena) {
+    if (arena != NULL) {
+        arena_free(&arena->arena);
+        free(arena);
+    }
+}
+
+static nvi_status_t parse_tokens(nvi_arena_t *arena, const tokenizer_t *tokenizer, nvi_env_map_t **out) {
+    const args_t args = {0};
+    parser_t parser = {0};
+    if (!run_parser(&arena->arena, &args, &tokenizer->tokens, &parser).ok) {
+        return NVI_ERR_PARSE;
+    }
+
+    nvi_env_map_t *map = arena_alloc(&arena->arena, sizeof(*map));
+    *map = (nvi_env_map_t){parser.env_map, &arena->arena};
+    *out = map;
+    return NVI_OK;
+}
+
+nvi_status_t nvi_load_files(nvi_arena_t *arena, const char *const *paths, size_t count, nvi_env_map_t **out,
+                            nvi_error_t *error) {
+    if (arena == NULL || out == NULL || paths == NULL || count == 0) {
+        return fail(error, NVI_ERR_INVALID_ARGUMENT, "nvi_load_files requires an arena, an out map and a path");
+    }
+    for (size_t i = 0; i < count; ++i) {
+        if (paths[i] == NULL) {
+            return fail(error, NVI_ERR_INVALID_ARGUMENT, "nvi_load_files was given a NULL path at %zu", i);
+        }
+    }
+
+    const args_t args = {0};
+    tokenizer_t tokenizer = {0};
+    arena_t scratch = {0};
+    nvi_status_t status = NVI_OK;
+    capture_t capture;
+    capture_begin(&capture);
+
+    for (size_t i = 0; i < count && status == NVI_OK; ++i) {
+        // the tokens (and so the parsed map's diagnostics) refer to their file by this copy
+        const char *path = arena_strdup(&arena->arena, paths[i]);
+
+        file_details_t file;
+        if (!read_env_file(&scratch, path, &file).ok) {
+            status = NVI_ERR_READ;
+        } else if (!generate_tokens(&arena->arena, &scratch, &args, &file, &tokenizer).ok) {
+            status = NVI_ERR_SYNTAX;
+        }
+
+        arena_reset(&scratch);
+    }
+    arena_free(&scratch);
+
+    if (status == NVI_OK) {
+        status = parse_tokens(arena, &tokenizer, out);
+    }
+
+    return capture_end(&capture, status, error);
+}
+
+nvi_status_t nvi_parse_buffer(nvi_arena_t *arena, const char *name, const char *data, size_t len,
+                              nvi_env_map_t **out, nvi_error_t *error) {
+    if (arena == NULL || out == NULL || (data == NULL && len > 0)) {
+        return fail(error, NVI_ERR_INVALID_ARGUMENT, "nvi_parse_buffer requires an arena, an out map and data");
+    }
+
+    const char *path = arena_strdup(&arena->arena, name != NULL ? name : "(buffer)");
+    if (len == 0) {
+        return fail(error, NVI_ERR_READ, "The '%s' file is empty; expected at least one KEY=VALUE assignment.", path);
+    }
+
+    // the tokenizer reads from a NUL terminated copy, as it would from open_file
+    arena_t scratch = {0};
+    char *contents = arena_alloc(&scratch, len + 1);
+    memcpy(contents, data, len);
+    contents[len] = '\0';
+    const file_details_t file = {.contents = contents, .path = path, .len = len, .size = len};
+
+    const args_t args = {0};
+    tokenizer_t tokenizer = {0};
+    capture_t capture;
+    capture_begin(&capture);
+
+    nvi_status_t status = generate_tokens(&arena->arena, &scratch, &args, &file, &tokenizer).ok ? NVI_OK
+                                                                                                : NVI_ERR_SYNTAX;
+    arena_free(&scratch);
+    if (status == NVI_OK) {
+        status = parse_tokens(arena, &tokenizer, out);
+    }
+
+    return capture_end(&capture, status, error);
+}
+
+nvi_status_t nvi_env_map_require(nvi_env_map_t *map, const char *const *keys, size_t count, nvi_error_t *error) {
+    if (map == NULL || (keys == NULL && count > 0)) {
+        return fail(error, NVI_ERR_INVALID_ARGUMENT, "nvi_env_map_require requires a map");
+    }
+
+    list_t missing_envs = {0};
+    for (size_t i = 0; i < count; ++i) {
+        const env_t *entry = keys[i] != NULL ? get_env_from_map(&map->map, keys[i]) : NULL;
+        if (keys[i] != NULL && (entry == NULL || entry->value[0] == '\0')) {
+            DYN_ARR_APPEND(map->arena, &missing_envs, keys[i]);
+        }
+    }
+
+    if (missing_envs.count == 0) {
+        return succeed(error);
+    }
+
+    capture_t capture;
+    capture_begin(&capture);
+    report_missing_envs(&missing_envs);
+    return capture_end(&capture, NVI_ERR_MISSING_REQUIRED, error);
+}
+
+size_t nvi_env_map_count(const nvi_env_map_t *map) { return map != NULL ? map->map.count : 0; }
+
+bool nvi_env_map_at(const nvi_env_map_t *map, size_t i, const char **key, const char **value) {
+    if (map == NULL || i >= map->map.count) {
+        return false;
+    }
+
+    if (key != NULL) {
+        *key = map->map.items[i].key;
+    }
+    if (value != NULL) {
+        *value = map->map.items[i].value;
+    }
+    return true;
+}
+
+const char *nvi_env_map_get(nvi_env_map_t *map, const char *key) {
+    if (map == NULL || key == NULL) {
+        return NULL;
+    }
+
+    const env_t *entry = get_env_from_map(&map->map, key);
+    return entry != NULL ? entry->value : NULL;
+}
+
+static int compare_offsets(const void *a, const void *b) {
+    size_t x = ((const env_key_match_t *)a)->offset;
+    size_t y = ((const env_key_match_t *)b)->offset;
+    return (x > y) - (x < y);
+}
+
+nvi_status_t nvi_scan_buffer(nvi_arena_t *arena, const char *ext, const char *data, size_t len, nvi_keys_t **out,
+                             nvi_error_t *error) {
+    if (arena == NULL || ext == NULL || out == NULL || (data == NULL && len > 0)) {
+        return fail(error, NVI_ERR_INVALID_ARGUMENT, "nvi_scan_buffer requires an arena, an extension and an out list");
+    }
+
+    const file_ext_t *file_ext = get_scan_extension(ext);
+    if (file_ext == NULL) {
+        return fail(error, NVI_ERR_INVALID_ARGUMENT, "The '%s' file extension is not supported", ext);
+    }
+
+    arena_t scratch = {0};
+    char *contents = arena_alloc(&scratch, len + 1);
+    if (len > 0) {
+        memcpy(contents, data, len);
+    }
+    contents[len] = '\0';
+    const file_details_t file = {.contents = contents, .path = "(buffer)", .len = len, .size = len};
+
+    env_key_matches_t matches = {0};
+    scan_file_content(&scratch, &file, file_ext, &matches);
+    // matched one accessor at a time, so they're grouped by accessor until sorted
+    if (matches.count > 1) {
+        qsort(matches.items, matches.count, sizeof(*matches.items), compare_offsets);
+    }
+
+    // the matches point into the scratch copy; the keys are kept in the caller's arena
+    nvi_keys_t *keys = arena_alloc(&arena->arena, sizeof(*keys));
+    keys->items = arena_alloc(&arena->arena, matches.count * sizeof(*keys->items));
+    keys->count = matches.count;
+    line_index_t lines = {0};
+    if (matches.count > 0) {
+        build_line_index(&scratch, contents, len, &lines);
+    }
+    for (size_t i = 0; i < matches.count; ++i) {
+        const env_key_match_t *match = &matches.items[i];
+        nvi_key_t *key = &keys->items[i];
+        key->key = arena_strndup(&arena->arena, match->key, match->key_len);
+        line_index_position(&lines, match->offset, &key->line, &key->column);
+    }
+
+    arena_free(&scratch);
+    *out = keys;
+    return succeed(error);
+}
+
+size_t nvi_keys_count(const nvi_keys_t *keys) { return keys != NULL ? keys->count : 0; }
+
+bool nvi_keys_at(const nvi_keys_t *keys, size_t i, const char **key, size_t *line, size_t *column) {
+    if (keys == NULL || i >= keys->count) {
+        return false;
+    }
+
+    if (key != NULL) {
+        *key = keys->items[i].key;
+    }
+    if (line != NULL) {
+        *line = keys->items[i].line;
+    }
+    if (column != NULL) {
+        *column = keys->items[i].column;
+    }
+    return true;
+}
+
+const char *nvi_version(void) { return NVI_VERSION; }
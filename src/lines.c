@@ -0,0 +1,65 @@
+#include "lines.h"
+#include "arena.h"
+#include "chars.h"
+#include "simd.h"
+#include <stdint.h>
+#include <string.h>
+
+// one bit per byte of s[at..at + 16) that is a newline
+#ifdef NVI_SSE2
+static inline unsigned newline_mask(const char *s, size_t at) {
+    __m128i block = _mm_loadu_si128((const __m128i *)(s + at));
+    return (unsigned)_mm_movemask_epi8(_mm_cmpeq_epi8(block, _mm_set1_epi8(LINE_DELIMITER)));
+}
+#endif
+
+static size_t count_newlines(const char *s, size_t len) {
+    size_t count = 0;
+    size_t k = 0;
+#ifdef NVI_SSE2
+    for (; k + 16 <= len; k += 16) {
+        count += mask_popcount(newline_mask(s, k));
+    }
+#endif
+    for (; k < len; ++k) {
+        count += s[k] == LINE_DELIMITER;
+    }
+    return count;
+}
+
+void build_line_index(arena_t *arena, const char *s, size_t len, line_index_t *index) {
+    index->count = 0;
+    index->items = arena_alloc(arena, count_newlines(s, len) * sizeof(*index->items));
+
+    size_t k = 0;
+#ifdef NVI_SSE2
+    for (; k + 16 <= len; k += 16) {
+        for (unsigned mask = newline_mask(s, k); mask != 0; mask &= mask - 1) {
+            index->items[index->count++] = k + mask_ctz(mask);
+        }
+    }
+#endif
+    for (; k < len; ++k) {
+        if (s[k] == LINE_DELIMITER) {
+            index->items[index->count++] = k;
+        }
+    }
+}
+
+void line_index_position(const line_index_t *index, size_t offset, size_t *line, size_t *byte) {
+    // the number of newlines before 'offset' is its 0-based line
+    size_t lo = 0;
+    size_t hi = index->count;
+    while (lo < hi) {
+        size_t mid = lo + (hi - lo) / 2;
+        if (index->items[mid] < offset) {
+            lo = mid + 1;
+        } else {
+            hi = mid;
+        }
+    }
+
+    size_t line_start = lo > 0 ? index->items[lo - 1] + 1 : 0;
+    *line = lo + 1;
+    *byte = offset - line_start + 1;
+}
@@ -0,0 +1,21 @@
+#ifndef LINES_H
+#define LINES_H
+
+#include "arena.h"
+#include <stddef.h>
+
+// The offsets of a file's newlines, so a byte offset can be turned into a line and byte
+// (column) only when a position is actually reported. The hot paths record plain offsets
+// and never count lines themselves.
+typedef struct {
+    size_t *items; // the offset of every '\n', ascending
+    size_t count;
+} line_index_t;
+
+// Counts the newlines of 's' (16 bytes at a time where SSE2 is available), then records them
+void build_line_index(arena_t *arena, const char *s, size_t len, line_index_t *index);
+
+// The 1-based line and byte of 'offset'
+void line_index_position(const line_index_t *index, size_t offset, size_t *line, size_t *byte);
+
+#endif // LINES_H
@@ -5,6 +5,18 @@
 #include <stdarg.h>
 #include <stdio.h>
 
+#if defined(_MSC_VER)
+#define THREAD_LOCAL __declspec(thread)
+#else
+#define THREAD_LOCAL _Thread_local
+#endif
+
+static THREAD_LOCAL FILE *diag_override;
+
+FILE *diag_stream(void) { return diag_override != NULL ? diag_override : stderr; }
+
+void set_diag_stream(FILE *file) { diag_override = file; }
+
 static void buf_vappendf(buf_t *buf, const char *fmt, va_list args) {
     va_list measure;
     va_copy(measure, args);
@@ -105,7 +117,7 @@ void log_error(sink_t s, const char *fmt, ...) {
 
 void log_buf_flush(buf_t *buf) {
     if (buf->count > 0) {
-        fwrite(buf->items, 1, buf->count, stderr);
+        fwrite(buf->items, 1, buf->count, diag_stream());
         buf->count = 0;
     }
 }
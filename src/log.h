@@ -9,7 +9,12 @@ typedef struct {
     FILE *file;
 } sink_t;
 
-#define SINK_STDERR ((sink_t){.file = stderr})
+// Diagnostics go to stderr unless the calling thread redirects them; libnvi captures them
+// this way instead of writing to its host's stderr. NULL restores stderr.
+FILE *diag_stream(void);
+void set_diag_stream(FILE *file);
+
+#define SINK_STDERR ((sink_t){.file = diag_stream()})
 #define SINK_BUF(b) ((sink_t){.buf = (b)})
 
 void log_f(sink_t s, const char *fmt, ...);
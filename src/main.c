@@ -2,16 +2,97 @@
 #include "arg.h"
 #include "config.h"
 #include "emitter.h"
+#include "errors.h"
 #include "parser.h"
+#include "perf.h"
 #include "result.h"
 #include "scanner.h"
+#include "serve.h"
+#include "snapshot.h"
+#include "stats.h"
 #include "timer.h"
 #include "tokenizer.h"
+#include "trace.h"
 #include "tty.h"
+#include "watch.h"
+#include <string.h>
 
-int main(int argc, const char **argv) {
-    tty_init();
+typedef struct {
+    double mark;
+    trace_ring_t ring;
+    perf_group_t perf; // main thread counters, open only with --stats
+    perf_counts_t perf_mark;
+} phase_timer_t;
+
+// records the time (and counters) since the last lap against a phase, as a span when
+// tracing, and moves the marks forward
+static void lap(stats_t *stats, phase_timer_t *timer, phase_t phase) {
+    double now = monotonic_seconds();
+    stats->phases[phase] = now - timer->mark;
+    trace_span(&timer->ring, get_phase_name(phase), NULL, timer->mark, now);
+    timer->mark = now;
+
+    perf_counts_t counts;
+    if (perf_group_read(&timer->perf, &counts)) {
+        stats->perf[phase] = perf_counts_sub(&counts, &timer->perf_mark);
+        stats->perf_measured[phase] = true;
+        timer->perf_mark = counts;
+    }
+}
+
+// --stats is only known once the args are parsed, so the config and args phases go uncounted
+static void start_perf(stats_t *stats, phase_timer_t *timer) {
+    stats->perf_ok = perf_group_open(&timer->perf) && perf_group_read(&timer->perf, &timer->perf_mark);
+    if (!stats->perf_ok) {
+        stats->perf_error = perf_error_text(&timer->perf);
+    }
+}
+
+// the trace file is only known once the args are parsed, so the phases before it are
+// replayed from their recorded durations
+static result_t start_trace(trace_t *trace, trace_ring_t *ring, const stats_t *stats, const char *path,
+                            double start) {
+    result_t result = trace_open(trace, path, start);
+    if (!result.ok) {
+        return result;
+    }
+
+    trace_ring_init(ring, trace, 0, "main");
 
+    double at = start;
+    for (phase_t phase = PHASE_CONFIG; phase <= PHASE_ARGS; ++phase) {
+        trace_span(ring, get_phase_name(phase), NULL, at, at + stats->phases[phase]);
+        at += stats->phases[phase];
+    }
+
+    return RESULT_OK;
+}
+
+static void collect_stats(stats_t *stats, const args_t *args, const scanner_t *scanner, const tokenizer_t *tokenizer,
+                          const parser_t *parser, double start) {
+    stats->format = args->stats;
+    stats->total = monotonic_seconds() - start;
+    stats->bytes[PHASE_TOKENIZE] = tokenizer->bytes_read;
+    stats->bytes[PHASE_PARSE] = tokenizer->bytes_read;
+
+    if (args->scan_exts.count > 0) {
+        // the workers count their own threads; main only waited on them
+        perf_counts_add(&stats->perf[PHASE_SCAN], &scanner->stats.totals.perf);
+        stats->bytes[PHASE_SCAN] = scanner->stats.totals.bytes_read;
+        stats->scan = &scanner->stats;
+        stats->workers = scanner->workers;
+        stats->worker_count = scanner->worker_count;
+        const probe_counts_t *probes = &scanner->key_probes;
+        stats->scan_keys = (probe_stats_t){scanner->env_keys.count, probes->lookups, probes->probes};
+    }
+
+    const hashmap_t *index = &parser->env_map.index;
+    probe_counts_t probes = index->counts != NULL ? *index->counts : (probe_counts_t){0};
+    stats->env_map = (probe_stats_t){index->count, probes.lookups, probes.probes};
+}
+
+// one run of the pipeline; 'cache' is only set when serving a --client request
+static int run(int argc, const char **argv, serve_cache_t *cache) {
     const double start = monotonic_seconds();
     arena_t arena = {0};
     config_t config = {0};
@@ -19,52 +100,119 @@ int main(int argc, const char **argv) {
     scanner_t scanner = {0};
     tokenizer_t tokenizer = {0};
     parser_t parser = {0};
+    stats_t stats = {0};
+    probe_counts_t env_map_probes = {0};
+    trace_t trace = {0};
+    phase_timer_t timer = {.mark = start};
     result_t result = RESULT_OK;
 
     result = load_config_file(&arena, argc, argv, &config);
+    lap(&stats, &timer, PHASE_CONFIG);
     if (!result.ok) {
         goto done;
     }
 
     result = parse_args(&arena, &config, &args);
+    lap(&stats, &timer, PHASE_ARGS);
     if (!result.ok) {
         goto done;
     }
 
+    if (args.stats != STATS_OFF) {
+        start_perf(&stats, &timer);
+        parser.env_map.index.counts = &env_map_probes;
+    }
+
+    if (args.trace_path != NULL) {
+        result = start_trace(&trace, &timer.ring, &stats, args.trace_path, start);
+        if (!result.ok) {
+            goto done;
+        }
+        scanner.trace = &trace;
+    }
+
     if (args.scan_exts.count > 0) {
-        result = run_scanner(&arena, &args, &scanner);
+        result = cache != NULL ? serve_scan(cache, &arena, &args, &scanner) : run_scanner(&arena, &args, &scanner);
+        lap(&stats, &timer, PHASE_SCAN);
 
         if (!result.ok) {
             goto done;
         }
     }
 
+    if (args.snapshot != NULL) {
+        result = run_snapshot(&arena, &args);
+        fflush(stdout);
+        lap(&stats, &timer, PHASE_EMIT);
+        goto done;
+    }
+
     if (args.files.count == 0) {
         goto done;
     }
 
-    result = run_tokenizer(&arena, &args, &tokenizer);
+    if (args.watch) {
+        result = cache != NULL ? operation_error("The '--watch' flag can't be served; run it without '--client'.\n")
+                               : run_watch(&args);
+        goto done;
+    }
+
+    result = cache != NULL ? serve_tokenize(cache, &arena, &args, &tokenizer)
+                           : run_tokenizer(&arena, &args, &tokenizer);
+    lap(&stats, &timer, PHASE_TOKENIZE);
     if (!result.ok) {
         goto done;
     }
 
-    result = run_parser(&arena, &args, &tokenizer.tokens, &parser);
+    result = cache != NULL ? serve_parse(cache, &arena, &args, &tokenizer.tokens, &parser)
+                           : run_parser(&arena, &args, &tokenizer.tokens, &parser);
+    lap(&stats, &timer, PHASE_PARSE);
     if (!result.ok) {
         goto done;
     }
 
+    if (args.publish != NULL) {
+        result = run_publish(&arena, &args, &parser.env_map);
+        if (!result.ok) {
+            goto done;
+        }
+    }
+
     if (args.command.count == 0) {
         goto done;
     }
 
     run_emitter(&args, &parser.env_map);
+    fflush(stdout);
+    lap(&stats, &timer, PHASE_EMIT);
 
 done:
+    trace_ring_finish(&timer.ring);
+    trace_close(&trace);
+    perf_group_close(&timer.perf);
     if (result.ok && args.dry_run) {
         log_dry_run_time(start);
     }
+    if (result.ok && args.stats != STATS_OFF) {
+        collect_stats(&stats, &args, &scanner, &tokenizer, &parser, start);
+        report_stats(&stats);
+    }
     fflush(stderr);
     fflush(stdout);
     arena_free(&arena);
     return result.code;
 }
+
+int main(int argc, const char **argv) {
+    tty_init();
+
+    if (argc > 1 && strcmp(argv[1], "serve") == 0) {
+        return run_server(argc, argv, run).code;
+    }
+
+    if (argc > 1 && strcmp(argv[1], "--client") == 0) {
+        return run_client(argc, argv).code;
+    }
+
+    return run(argc, argv, NULL);
+}
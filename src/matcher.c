@@ -4,6 +4,7 @@
 #include "chars.h"
 #include "dynarr.h"
 #include "file.h"
+#include "lines.h"
 #include "utils.h"
 #include <stdlib.h>
 #include <string.h>
@@ -109,77 +110,226 @@ static env_key_t extract_env_by_pattern(const file_details_t *file, pattern_t ki
     }
 }
 
+// Finds the next match of 'acc' whose prefix starts in [*search_start, to), leaving
+// *search_start where the next search resumes; false once there's none
+static bool next_match(const file_details_t *file, const accessor_t *acc, size_t to, size_t *search_start,
+                       env_key_t *env) {
+    const bool prefix_starts_with_ident = is_ident_char(acc->prefix[0]);
+    const bool is_expansion = (acc->pattern == expansion);
+
+    while (*search_start < to && *search_start + acc->prefix_len <= file->len) {
+        const char *match = memchr(file->contents + *search_start, acc->prefix[0], to - *search_start);
+        if (match == NULL) {
+            break;
+        }
+
+        size_t match_pos = (size_t)(match - file->contents);
+        if (match_pos + acc->prefix_len > file->len) {
+            break;
+        }
+
+        *search_start = match_pos + 1;
+
+        // reject incomplete prefix match
+        if (memcmp(file->contents + match_pos, acc->prefix, acc->prefix_len) != 0) {
+            continue;
+        }
+
+        // reject matches that begin partway through an identifier (e.g. avoid matching "VAR" inside "MYVAR").
+        if (match_pos > 0 && prefix_starts_with_ident && is_ident_char(file->contents[match_pos - 1])) {
+            continue;
+        }
+
+        // reject $$+{...} (accepts only ${})
+        if (is_expansion && match_pos > 0 && file->contents[match_pos - 1] == DOLLAR_SIGN) {
+            continue;
+        }
+
+        *env = extract_env_by_pattern(file, acc->pattern, match_pos + acc->prefix_len);
+        if (!is_valid_key(env->key, env->key_len)) {
+            continue;
+        }
+
+        // resume past the extracted span; every accessor prefix contains at least one
+        // non-identifier byte, so no prefix can begin inside the matched key
+        *search_start = env->end;
+        return true;
+    }
+
+    return false;
+}
+
+// Appends the matches of 'acc' starting in [from, to); returns the end of the last one, or
+// 'from' when there's none
+static size_t match_accessor(arena_t *arena, const file_details_t *file, const accessor_t *acc, size_t from,
+                             size_t to, env_key_matches_t *env_key_matches) {
+    size_t search_start = from;
+    size_t last_end = from;
+    env_key_t env;
+    while (next_match(file, acc, to, &search_start, &env)) {
+        env_key_match_t new_env_key_match = {.key = env.key, .key_len = env.key_len, .offset = env.start};
+        DYN_ARR_APPEND(arena, env_key_matches, new_env_key_match);
+        last_end = env.end;
+    }
+
+    return last_end;
+}
+
 void scan_file_content(arena_t *scratch, const file_details_t *file, const file_ext_t *file_ext_match,
                        env_key_matches_t *env_key_matches) {
     for (size_t acc_idx = 0; acc_idx < file_ext_match->accessor_count; ++acc_idx) {
+        match_accessor(scratch, file, &file_ext_match->accessors[acc_idx], 0, file->len, env_key_matches);
+    }
+}
+
+void scan_file_chunk(arena_t *arena, const file_details_t *file, const file_ext_t *file_ext_match,
+                     match_chunk_t *chunk) {
+    size_t count = file_ext_match->accessor_count;
+    chunk->accessor_ends = arena_alloc(arena, count * sizeof(*chunk->accessor_ends));
+    chunk->resumes = arena_alloc(arena, count * sizeof(*chunk->resumes));
+
+    for (size_t acc_idx = 0; acc_idx < count; ++acc_idx) {
         const accessor_t *acc = &file_ext_match->accessors[acc_idx];
-        const bool prefix_starts_with_ident = is_ident_char(acc->prefix[0]);
-        const bool is_expansion = (acc->pattern == expansion);
+        chunk->resumes[acc_idx] = match_accessor(arena, file, acc, chunk->from, chunk->to, &chunk->matches);
+        chunk->accessor_ends[acc_idx] = chunk->matches.count;
+    }
+}
 
-        size_t line = 1;
-        size_t line_start = 0;
-        size_t line_cursor = 0;
-        size_t search_start = 0;
+void merge_match_chunks(arena_t *scratch, const file_details_t *file, const file_ext_t *file_ext_match,
+                        const match_chunk_t *chunks, size_t count, env_key_matches_t *env_key_matches) {
+    for (size_t acc_idx = 0; acc_idx < file_ext_match->accessor_count; ++acc_idx) {
+        const accessor_t *acc = &file_ext_match->accessors[acc_idx];
+        size_t resume = 0;
 
-        while (search_start + acc->prefix_len <= file->len) {
-            const char *match = memchr(file->contents + search_start, acc->prefix[0], file->len - search_start);
-            if (match == NULL) {
-                break;
+        for (size_t i = 0; i < count; ++i) {
+            const match_chunk_t *chunk = &chunks[i];
+            if (resume > chunk->from) {
+                // a match crossed into this chunk, so one pass would have skipped past where the
+                // chunk started: its matches may disagree, so redo the rest of it from there
+                size_t last_end = match_accessor(scratch, file, acc, resume, chunk->to, env_key_matches);
+                resume = last_end > resume ? last_end : resume;
+                continue;
             }
 
-            size_t match_pos = (size_t)(match - file->contents);
-            if (match_pos + acc->prefix_len > file->len) {
-                break;
-            }
+            size_t begin = acc_idx == 0 ? 0 : chunk->accessor_ends[acc_idx - 1];
+            size_t end = chunk->accessor_ends[acc_idx];
+            DYN_ARR_APPEND_MANY(scratch, env_key_matches, chunk->matches.items + begin, end - begin);
+            resume = chunk->resumes[acc_idx];
+        }
+    }
+}
 
-            search_start = match_pos + 1;
+// Moves 'line' and 'line_start' (the file offset where that line begins) past the newlines
+// of 's', whose first byte is at file offset 'base'
+static void count_lines(const char *s, size_t len, size_t base, size_t *line, size_t *line_start) {
+    const char *end = s + len;
+    for (const char *p = s; (p = memchr(p, LINE_DELIMITER, (size_t)(end - p))) != NULL; ++p) {
+        ++*line;
+        *line_start = base + (size_t)(p - s) + 1;
+    }
+}
 
-            // reject incomplete prefix match
-            if (memcmp(file->contents + match_pos, acc->prefix, acc->prefix_len) != 0) {
-                continue;
-            }
+// Records the positions of the matches from 'first' on, all found in 'window' (the file from
+// offset 'base', which lies on line 'line' starting at offset 'line_start')
+static void record_positions(arena_t *scratch, arena_t *window_arena, const file_details_t *window, size_t base,
+                             size_t line, size_t line_start, const env_key_matches_t *matches, size_t first,
+                             match_positions_t *positions) {
+    line_index_t lines;
+    build_line_index(window_arena, window->contents, window->len, &lines);
 
-            // reject matches that begin partway through an identifier (e.g. avoid matching "VAR" inside "MYVAR").
-            if (match_pos > 0 && prefix_starts_with_ident && is_ident_char(file->contents[match_pos - 1])) {
-                continue;
-            }
+    for (size_t i = first; i < matches->count; ++i) {
+        size_t offset = matches->items[i].offset;
+        size_t window_line, window_byte;
+        line_index_position(&lines, offset - base, &window_line, &window_byte);
 
-            // reject $$+{...} (accepts only ${})
-            if (is_expansion && match_pos > 0 && file->contents[match_pos - 1] == DOLLAR_SIGN) {
-                continue;
-            }
+        match_position_t position = {.line = line + window_line - 1, .byte = window_byte};
+        if (window_line == 1) {
+            position.byte = offset - line_start + 1;
+        }
+        DYN_ARR_APPEND(scratch, positions, position);
+    }
+}
 
-            env_key_t env = extract_env_by_pattern(file, acc->pattern, match_pos + acc->prefix_len);
-            if (!is_valid_key(env.key, env.key_len)) {
-                continue;
+bool scan_file_stream(arena_t *scratch, file_stream_t *stream, const file_ext_t *file_ext_match, unsigned sniff,
+                      sniff_kind_t *sniffed, env_key_matches_t *env_key_matches, match_positions_t *positions,
+                      match_sink_t sink, void *sink_ctx) {
+    const size_t capacity = STREAM_WINDOW_SIZE + STREAM_MAX_SPAN;
+    char *buf = arena_alloc(scratch, capacity + 1);
+    size_t *resumes = arena_alloc_zeroed(scratch, file_ext_match->accessor_count * sizeof(*resumes));
+    arena_t window_arena = {0}; // line indexes, and the keys a sink takes; rewound every window
+    arena_t *key_arena = sink != NULL ? &window_arena : scratch;
+
+    file_details_t window = {.contents = buf, .path = stream->path};
+    size_t base = 0;      // the file offset of buf[0]
+    size_t scan_from = 0; // the first file offset whose prefixes haven't been matched yet
+    size_t line = 1;
+    size_t line_start = 0;
+    bool ok = true;
+
+    for (;;) {
+        size_t n;
+        if (!read_file_stream(stream, buf + window.len, capacity - window.len, &n)) {
+            ok = false;
+            break;
+        }
+        window.len += n;
+        buf[window.len] = '\0';
+
+        if (base == 0) {
+            *sniffed = sniff_contents(buf, window.len, sniff);
+            if (*sniffed != SNIFF_NONE) {
+                break;
             }
+        }
 
-            // advance line from wherever it last stopped up to the start of the env
-            // NOTE: may be worth removing as this is purely for dry-run output; this would
-            // reduce overhead for an env_key_match by just storing the key and its length
-            while (line_cursor < env.start) {
-                const char *nl = memchr(file->contents + line_cursor, LINE_DELIMITER, env.start - line_cursor);
-                if (nl == NULL) {
-                    line_cursor = env.start;
-                    break;
+        // a prefix past 'accept' could run on into bytes not read yet, so it waits for the next window
+        bool at_end = window.len < capacity;
+        size_t accept = at_end ? window.len : window.len - STREAM_MAX_SPAN;
+        size_t first = env_key_matches->count;
+
+        for (size_t acc_idx = 0; acc_idx < file_ext_match->accessor_count; ++acc_idx) {
+            const accessor_t *acc = &file_ext_match->accessors[acc_idx];
+            size_t search_start = (resumes[acc_idx] > scan_from ? resumes[acc_idx] : scan_from) - base;
+            env_key_t env;
+            while (next_match(&window, acc, accept, &search_start, &env)) {
+                // a key running up to the end of a partial window may go on past it
+                if (!at_end && env.end >= window.len) {
+                    continue;
                 }
-                size_t nl_pos = (size_t)(nl - file->contents);
-                ++line;
-                line_start = nl_pos + 1;
-                line_cursor = nl_pos + 1;
+
+                env_key_match_t new_env_key_match = {.key = arena_strndup(key_arena, env.key, env.key_len),
+                                                     .key_len = env.key_len,
+                                                     .offset = base + env.start};
+                DYN_ARR_APPEND(scratch, env_key_matches, new_env_key_match);
+                resumes[acc_idx] = base + env.end;
             }
+        }
 
-            env_key_match_t new_env_key_match = {
-                .key = env.key,
-                .key_len = env.key_len,
-                .line = line,
-                .byte = env.start - line_start + 1,
-            };
-            DYN_ARR_APPEND(scratch, env_key_matches, new_env_key_match);
+        if (positions != NULL && env_key_matches->count > first) {
+            record_positions(scratch, &window_arena, &window, base, line, line_start, env_key_matches, first,
+                             positions);
+            arena_reset(&window_arena);
+        } else if (sink != NULL && env_key_matches->count > 0) {
+            sink(sink_ctx, env_key_matches);
+            env_key_matches->count = 0;
+            arena_reset(&window_arena);
+        }
 
-            // resume past the extracted span; every accessor prefix contains at least one
-            // non-identifier byte, so no prefix can begin inside the matched key
-            search_start = env.end;
+        if (at_end) {
+            break;
         }
+
+        // carry the unmatched tail, plus the byte before it for the mid-identifier checks
+        size_t keep = accept - 1;
+        if (positions != NULL) {
+            count_lines(buf, keep, base, &line, &line_start);
+        }
+        memmove(buf, buf + keep, window.len - keep);
+        window.len -= keep;
+        base += keep;
+        scan_from = base + 1;
     }
+
+    arena_free(&window_arena);
+    return ok;
 }
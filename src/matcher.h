@@ -4,6 +4,8 @@
 #include "accessors.h"
 #include "arena.h"
 #include "file.h"
+#include "sniff.h"
+#include <stdbool.h>
 
 typedef struct {
     const char *key;
@@ -12,11 +14,12 @@ typedef struct {
     size_t end;
 } env_key_t;
 
+// 'offset' is where the key starts in the file; a dry run turns it into a line and byte
+// with a line index (lines.h)
 typedef struct {
     const char *key;
     size_t key_len;
-    size_t line;
-    size_t byte;
+    size_t offset;
 } env_key_match_t;
 
 typedef struct {
@@ -28,4 +31,56 @@ typedef struct {
 void scan_file_content(arena_t *scratch, const file_details_t *file, const file_ext_t *file_ext_match,
                        env_key_matches_t *env_key_matches);
 
+// A large file's matching can be split into chunks matched in parallel. A chunk owns the
+// accessor prefixes that start in [from, to) and reads past 'to' to finish a match, so
+// neighbouring chunks overlap by exactly the span a boundary match needs.
+typedef struct {
+    size_t from;
+    size_t to;
+    env_key_matches_t matches; // accessor by accessor, in file order
+    size_t *accessor_ends;     // one past each accessor's last match in 'matches'
+    size_t *resumes;           // where each accessor's search would carry on into the next chunk
+} match_chunk_t;
+
+// Matches 'chunk' (its 'from' and 'to' set, the rest zeroed); everything is allocated in 'arena'
+void scan_file_chunk(arena_t *arena, const file_details_t *file, const file_ext_t *file_ext_match,
+                     match_chunk_t *chunk);
+
+// Joins consecutive chunks covering the whole file into exactly the matches, in the order,
+// scan_file_content finds: a chunk that a match crossed into is re-matched past that match
+void merge_match_chunks(arena_t *scratch, const file_details_t *file, const file_ext_t *file_ext_match,
+                        const match_chunk_t *chunks, size_t count, env_key_matches_t *env_key_matches);
+
+// A file over MAX_FILE_SIZE is matched STREAM_WINDOW_SIZE bytes at a time. Each window
+// carries the last STREAM_MAX_SPAN bytes of the one before it, so the contents held stay
+// bounded however large the file is; the matches stay bounded too when a sink takes each
+// window's, and otherwise grow with their count. A match is found as long as it spans at most
+// STREAM_MAX_SPAN bytes from the start of its accessor prefix. No real key comes close to that.
+#define STREAM_WINDOW_SIZE ((size_t)1024 * 1024)
+#define STREAM_MAX_SPAN ((size_t)4096)
+
+// A match's 1-based line and byte, counted while streaming since the contents aren't kept
+typedef struct {
+    size_t line;
+    size_t byte;
+} match_position_t;
+
+typedef struct {
+    match_position_t *items;
+    size_t count;
+    size_t capacity;
+} match_positions_t;
+
+// Takes one window's matches, whose keys only last until it returns
+typedef void (*match_sink_t)(void *ctx, const env_key_matches_t *matches);
+
+// Matches 'stream' window by window, accessor by accessor within each. Keys are copied into
+// 'scratch' since the window is reused. When 'positions' isn't NULL, it gets each match's
+// position, in step with the matches. When 'sink' isn't NULL, each window's matches go to it
+// instead and aren't kept ('positions' must be NULL then). The first window is sniffed for the
+// 'sniff' kinds first: a hit ends the scan with no matches. False on a read error.
+bool scan_file_stream(arena_t *scratch, file_stream_t *stream, const file_ext_t *file_ext_match, unsigned sniff,
+                      sniff_kind_t *sniffed, env_key_matches_t *env_key_matches, match_positions_t *positions,
+                      match_sink_t sink, void *sink_ctx);
+
 #endif // MATCHER_H
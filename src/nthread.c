@@ -0,0 +1,118 @@
+#if defined(__linux__)
+#define _GNU_SOURCE // sched_getaffinity and CPU_COUNT
+#endif
+
+#include "nthread.h"
+#include <stdbool.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#if defined(__linux__)
+#include <sched.h>
+#endif
+
+size_t cpu_max_threads(const char *cpu_max) {
+    char *end;
+    long long quota = strtoll(cpu_max, &end, 10);
+    if (end == cpu_max || quota <= 0) {
+        // "max" (no quota) lands here too
+        return 0;
+    }
+
+    const char *period_start = end;
+    long long period = strtoll(period_start, &end, 10);
+    if (end == period_start || period <= 0) {
+        return 0;
+    }
+
+    // a quota of 1.5 CPUs still keeps two threads busy part of the time
+    return (size_t)((quota + period - 1) / period);
+}
+
+#if defined(__linux__)
+static bool read_small_file(const char *path, char *buf, size_t cap) {
+    FILE *f = fopen(path, "r");
+    if (f == NULL) {
+        return false;
+    }
+
+    size_t n = fread(buf, 1, cap - 1, f);
+    fclose(f);
+    buf[n] = '\0';
+    return n > 0;
+}
+
+static size_t min_limit(size_t limit, size_t n) { return n > 0 && (limit == 0 || n < limit) ? n : limit; }
+
+// The tightest CPU quota of this process' cgroup and every cgroup above it; 0 for none
+static size_t cgroup_thread_limit(void) {
+    char buf[512];
+    char group[sizeof(buf)] = "";
+    size_t limit = 0;
+
+    // cgroup v2: the unified hierarchy's entry is "0::<path>"
+    FILE *f = fopen("/proc/self/cgroup", "r");
+    if (f != NULL) {
+        while (fgets(buf, sizeof(buf), f) != NULL) {
+            if (strncmp(buf, "0::", 3) == 0) {
+                snprintf(group, sizeof(group), "%s", buf + 3);
+                group[strcspn(group, "\n")] = '\0';
+                break;
+            }
+        }
+        fclose(f);
+    }
+
+    for (;;) {
+        char path[sizeof(group) + 32];
+        snprintf(path, sizeof(path), "/sys/fs/cgroup%s/cpu.max", group);
+        if (read_small_file(path, buf, sizeof(buf))) {
+            limit = min_limit(limit, cpu_max_threads(buf));
+        }
+
+        char *slash = strrchr(group, '/');
+        if (slash == NULL) {
+            break;
+        }
+        *slash = '\0';
+    }
+
+    // cgroup v1: only the mount's own files are visible inside a container
+    char period[64];
+    if (read_small_file("/sys/fs/cgroup/cpu/cpu.cfs_quota_us", buf, sizeof(buf) / 2) &&
+        read_small_file("/sys/fs/cgroup/cpu/cpu.cfs_period_us", period, sizeof(period))) {
+        buf[strcspn(buf, "\n")] = ' ';
+        snprintf(buf + strlen(buf), sizeof(buf) - strlen(buf), "%s", period);
+        limit = min_limit(limit, cpu_max_threads(buf));
+    }
+
+    return limit;
+}
+#endif
+
+size_t available_thread_count(void) {
+    size_t n = thread_count();
+
+#if defined(_WIN32)
+    DWORD_PTR process_mask, system_mask;
+    if (GetProcessAffinityMask(GetCurrentProcess(), &process_mask, &system_mask)) {
+        size_t allowed = 0;
+        for (; process_mask != 0; process_mask &= process_mask - 1) {
+            ++allowed;
+        }
+        n = allowed > 0 && allowed < n ? allowed : n;
+    }
+#elif defined(__linux__)
+    cpu_set_t set;
+    if (sched_getaffinity(0, sizeof(set), &set) == 0) {
+        size_t allowed = (size_t)CPU_COUNT(&set);
+        n = allowed > 0 && allowed < n ? allowed : n;
+    }
+
+    size_t quota = cgroup_thread_limit();
+    n = quota > 0 && quota < n ? quota : n;
+#endif
+
+    return n;
+}
@@ -93,4 +93,12 @@ static inline size_t thread_count(void) {
 
 #endif
 
+// The threads this process can actually run at once: thread_count() narrowed by the CPU
+// affinity mask and, on Linux, the cgroup CPU quota (cpu.max, or cpu.cfs_quota_us on v1)
+size_t available_thread_count(void);
+
+// The threads a cgroup v2 "cpu.max" line ("<quota> <period>", or "max <period>") allows,
+// rounded up; 0 when there's no quota
+size_t cpu_max_threads(const char *cpu_max);
+
 #endif // NTHREAD_H
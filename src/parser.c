@@ -5,6 +5,7 @@
 #include "errors.h"
 #include "log.h"
 #include "macros.h"
+#include "program.h"
 #include "result.h"
 #include "tokenizer.h"
 #include "tty.h"
@@ -20,195 +21,215 @@ env_t *get_env_from_map(env_map_t *env_map, const char *entry) {
     return &env_map->items[i];
 }
 
-static const char *resolve_env(env_map_t *env_map, const char *key) {
-    const char *val = getenv(key);
-    if (val != NULL) {
-        return val;
+void seal_env_map(arena_t *arena, env_map_t *env_map, const size_t *value_offsets) {
+    size_t *key_offsets = arena_alloc(arena, env_map->count * sizeof(*key_offsets));
+    for (size_t i = 0; i < env_map->count; ++i) {
+        const char *key = env_map->items[i].key;
+        key_offsets[i] = strpool_intern(arena, &env_map->pool, key, strlen(key));
     }
 
-    const env_t *entry = get_env_from_map(env_map, key);
-    return entry != NULL ? entry->value : NULL;
+    for (size_t i = 0; i < env_map->count; ++i) {
+        env_map->items[i].key = strpool_at(&env_map->pool, key_offsets[i]);
+        env_map->items[i].value = strpool_at(&env_map->pool, value_offsets[i]);
+    }
 }
 
-result_t run_parser(arena_t *arena, const args_t *args, const token_list_t *tokens, parser_t *parser) {
+size_t get_interpolated_key_len(const char *raw_value, size_t raw_value_len) {
+    // POSIX-style ${KEY:-default}: the key ends where the default starts
+    for (size_t k = 0; k + 1 < raw_value_len; ++k) {
+        if (raw_value[k] == COLON && raw_value[k + 1] == DASH) {
+            return k;
+        }
+    }
 
-    if (args->dry_run) {
-        log_info(SINK_STDERR, "[INFO]");
-        log_f(SINK_STDERR, " Attempting to parse %zu token%s...\n\n", tokens->count, TO_PLURAL(tokens->count));
+    return raw_value_len;
+}
+
+bool is_assembled_token(const token_list_t *tokens, size_t ti) {
+    if (tokens->keys[ti] != NO_KEY) {
+        return true;
     }
 
-    buf_t value = {.arena = arena};
-
-    // running total of the KEY=value bytes that would be emitted; bounded so
-    // per-key interpolation amplification can't compound into an OOM abort
-    size_t total_output = 0;
-
-    for (size_t ti = 0; ti < tokens->count; ++ti) {
-        const token_t *token = &tokens->items[ti];
-        const char *token_key = token->key;
-
-        value.count = 0;
-
-        for (size_t vt = 0; vt < token->values.count; ++vt) {
-            const value_token_t *value_token = &token->values.items[vt];
-
-            switch (value_token->kind) {
-                case INTERPOLATED_KEY: {
-                    const char *raw_value = value_token->value;
-                    size_t raw_value_len = value_token->value_len;
-
-                    // POSIX-style ${KEY:-default}: substitute the default when KEY is unset or empty
-                    size_t key_len = raw_value_len;
-                    const char *fallback = NULL;
-                    size_t fallback_len = 0;
-                    for (size_t k = 0; k + 1 < raw_value_len; ++k) {
-                        if (raw_value[k] == COLON && raw_value[k + 1] == DASH) {
-                            key_len = k;
-                            fallback = raw_value + k + 2;
-                            fallback_len = raw_value_len - k - 2;
-                            break;
-                        }
-                    }
-
-                    const char *lookup_key = raw_value;
-                    if (key_len != raw_value_len) {
-                        lookup_key = arena_strndup(arena, raw_value, key_len);
-                    }
-
-                    const char *env = resolve_env(&parser->env_map, lookup_key);
-
-                    if (env == NULL && fallback == NULL) {
-                        return operation_error(
-                            "The '%s' key contains an interpolated key variable %.*s (%s:%zu:%zu) that is not "
-                            "defined.\n",
-                            token_key ? token_key : "(none)", (int)key_len, raw_value, token->file, value_token->line,
-                            value_token->byte);
-                    }
-
-                    if (env != NULL && env[0] != '\0') {
-                        DYN_ARR_APPEND_MANY(arena, &value, env, strlen(env));
-                    } else if (fallback != NULL) {
-                        DYN_ARR_APPEND_MANY(arena, &value, fallback, fallback_len);
-                    }
-                    break;
+    size_t first = tokens->first_values[ti];
+    for (size_t v = first; v < first + tokens->value_counts[ti]; ++v) {
+        if (tokens->kinds[v] != COMMENTED_LINE) {
+            return true;
+        }
+    }
+
+    return false;
+}
+
+static void log_skipped_comment(const args_t *args, const token_list_t *tokens, size_t ti, size_t v) {
+    log_info(SINK_STDERR, "[INFO]");
+    log_f(SINK_STDERR, " Skipping a parsed comment in Token #%zu...\n    %s ", ti + 1, BULLET);
+    log_comment(SINK_STDERR, "%s\n\n", args->reveal ? token_value(tokens, ti, v) : "*****");
+}
+
+result_t assemble_value(arena_t *arena, const args_t *args, const token_list_t *tokens, size_t ti,
+                        key_resolver_t resolve, void *ctx, buf_t *value) {
+    const char *key = token_key(tokens, ti);
+    size_t first = tokens->first_values[ti];
+    value->count = 0;
+
+    for (size_t v = first; v < first + tokens->value_counts[ti]; ++v) {
+        const char *raw_value = token_value(tokens, ti, v);
+        size_t raw_value_len = tokens->lens[v];
+
+        switch ((value_kind_t)tokens->kinds[v]) {
+            case INTERPOLATED_KEY: {
+                // substitute the default when KEY is unset or empty
+                size_t key_len = get_interpolated_key_len(raw_value, raw_value_len);
+                const char *fallback = NULL;
+                size_t fallback_len = 0;
+                if (key_len != raw_value_len) {
+                    fallback = raw_value + key_len + 2;
+                    fallback_len = raw_value_len - key_len - 2;
                 }
-                case COMMENTED_LINE: {
-                    if (args->dry_run) {
-                        log_info(SINK_STDERR, "[INFO]");
-                        log_f(SINK_STDERR, " Skipping a parsed comment in Token #%zu...\n    %s ", ti + 1, BULLET);
-                        log_comment(SINK_STDERR, "%s\n\n", args->reveal ? value_token->value : "*****");
-                    }
-                    break;
+
+                const char *lookup_key = raw_value;
+                if (key_len != raw_value_len) {
+                    lookup_key = arena_strndup(arena, raw_value, key_len);
                 }
-                default: {
-                    DYN_ARR_APPEND_MANY(arena, &value, value_token->value, value_token->value_len);
-                    break;
+
+                const char *env = resolve(ctx, lookup_key);
+
+                if (env == NULL && fallback == NULL) {
+                    return operation_error(
+                        "The '%s' key contains an interpolated key variable %.*s (%s:%zu:%zu) that is not "
+                        "defined.\n",
+                        key ? key : "(none)", (int)key_len, raw_value, token_file(tokens, ti),
+                        (size_t)tokens->lines[v], (size_t)tokens->bytes[v]);
                 }
-            }
 
-            // every appended chunk is independently bounded, so checking after each value token
-            // catches runaway expansion before it can compound
-            if (value.count > MAX_ENV_VALUE_SIZE) {
-                return operation_error(
-                    "The '%s' key's value exceeds %zu bytes after interpolation (%s:%zu:%zu); aborting.\n",
-                    token_key ? token_key : "(none)", (size_t)MAX_ENV_VALUE_SIZE, token->file, value_token->line,
-                    value_token->byte);
+                if (env != NULL && env[0] != '\0') {
+                    DYN_ARR_APPEND_MANY(arena, value, env, strlen(env));
+                } else if (fallback != NULL) {
+                    DYN_ARR_APPEND_MANY(arena, value, fallback, fallback_len);
+                }
+                break;
+            }
+            case COMMENTED_LINE: {
+                if (args->dry_run) {
+                    log_skipped_comment(args, tokens, ti, v);
+                }
+                break;
+            }
+            default: {
+                DYN_ARR_APPEND_MANY(arena, value, raw_value, raw_value_len);
+                break;
             }
         }
 
-        // skip storing comments
-        if (token_key == NULL) {
-            continue;
+        // every appended chunk is independently bounded, so checking after each value token
+        // catches runaway expansion before it can compound
+        if (value->count > MAX_ENV_VALUE_SIZE) {
+            return operation_error(
+                "The '%s' key's value exceeds %zu bytes after interpolation (%s:%zu:%zu); aborting.\n",
+                key ? key : "(none)", (size_t)MAX_ENV_VALUE_SIZE, token_file(tokens, ti),
+                (size_t)tokens->lines[v], (size_t)tokens->bytes[v]);
         }
+    }
 
-        char *env_value = arena_alloc(arena, value.count + 1);
+    return RESULT_OK;
+}
 
-        if (value.count > 0) {
-            memcpy(env_value, value.items, value.count);
-        }
-        env_value[value.count] = '\0';
-
-        env_t *existing = get_env_from_map(&parser->env_map, token_key);
-        if (existing != NULL) {
-            if (args->dry_run) {
-                log_info(SINK_STDERR, "[INFO]");
-                log_f(SINK_STDERR, " Token #%zu updated ", ti + 1);
-                log_bold_info(SINK_STDERR, "%s", token_key);
-                log_f(SINK_STDERR, " key's value from ");
-                log_info(SINK_STDERR, "%s", args->reveal ? existing->value : "*****");
-                log_f(SINK_STDERR, " to ");
-                log_info(SINK_STDERR, "%s", args->reveal ? env_value : "*****");
-                log_f(SINK_STDERR, "...\n\n");
-            }
-            total_output -= strlen(existing->value);
-            total_output += value.count;
-            existing->value = env_value;
-        } else {
-            env_t new_env = {.key = token_key, .value = env_value};
-            DYN_ARR_APPEND(arena, &parser->env_map, new_env);
-            hashmap_append(arena, &parser->env_map.index, token_key, strlen(token_key), parser->env_map.count - 1);
+result_t report_missing_envs(const list_t *missing_envs) {
+    log_error(SINK_STDERR,
+              "[ERROR] The following ENV keys were marked as required, but are undefined or empty after parsing:");
+    for (size_t i = 0; i < missing_envs->count; ++i) {
+        log_error(SINK_STDERR, "\n   %s %s", BULLET, missing_envs->items[i]);
+    }
+    log_error(SINK_STDERR, "\n");
+    return OPERATION_FAILURE;
+}
 
-            // KEY=value plus a delimiter, mirroring the emitted layout
-            total_output += strlen(token_key) + value.count + 2;
+// What a dry run logs each token from, and the first token it hasn't logged yet
+typedef struct {
+    const args_t *args;
+    const token_list_t *tokens;
+    size_t next;
+} dry_run_log_t;
+
+// programs compile comments to nothing, so they're logged from the tokens before 'end'
+static void log_comments_until(dry_run_log_t *log, size_t end) {
+    const token_list_t *tokens = log->tokens;
+    for (; log->next < end; ++log->next) {
+        size_t first = tokens->first_values[log->next];
+        for (size_t v = first; v < first + tokens->value_counts[log->next]; ++v) {
+            if (tokens->kinds[v] == COMMENTED_LINE) {
+                log_skipped_comment(log->args, tokens, log->next, v);
+            }
         }
+    }
+}
 
-        if (total_output > MAX_PARSED_OUTPUT) {
-            return operation_error("The total parsed ENV output exceeds %zu bytes after the '%s' key (%s); aborting.\n",
-                                   (size_t)MAX_PARSED_OUTPUT, token_key, token->file);
-        }
+static void log_token(void *ctx, size_t ti, const char *key, const char *previous, const char *value) {
+    dry_run_log_t *log = ctx;
+    const args_t *args = log->args;
+    log_comments_until(log, ti + 1);
 
-        if (args->dry_run) {
-            log_info(SINK_STDERR, "[INFO]");
-            log_f(SINK_STDERR, " Successfully parsed Token #%zu...\n", ti + 1);
-            log_f(SINK_STDERR, "    %s key: ", BULLET);
-            log_bold_info(SINK_STDERR, "%s \n", token_key);
-            log_f(SINK_STDERR, "    %s value: ", BULLET);
-            log_info(SINK_STDERR, "%s", args->reveal ? env_value : "*****");
-            log_f(SINK_STDERR, "\n\n");
-        }
+    // skip logging keyless tokens, which aren't stored
+    if (key == NULL) {
+        return;
     }
 
-    if (parser->env_map.count == 0) {
-        return operation_error("After parsing .env tokens, there aren't any ENVs to emit; aborting.\n");
+    if (previous != NULL) {
+        log_info(SINK_STDERR, "[INFO]");
+        log_f(SINK_STDERR, " Token #%zu updated ", ti + 1);
+        log_bold_info(SINK_STDERR, "%s", key);
+        log_f(SINK_STDERR, " key's value from ");
+        log_info(SINK_STDERR, "%s", args->reveal ? previous : "*****");
+        log_f(SINK_STDERR, " to ");
+        log_info(SINK_STDERR, "%s", args->reveal ? value : "*****");
+        log_f(SINK_STDERR, "...\n\n");
     }
 
-    for (size_t i = 0; i < args->required.count; ++i) {
-        const char *required_key = args->required.items[i];
-        const env_t *entry = get_env_from_map(&parser->env_map, required_key);
-        if (entry == NULL || entry->value[0] == '\0') {
-            DYN_ARR_APPEND(arena, &parser->missing_envs, required_key);
-        }
-    }
+    log_info(SINK_STDERR, "[INFO]");
+    log_f(SINK_STDERR, " Successfully parsed Token #%zu...\n", ti + 1);
+    log_f(SINK_STDERR, "    %s key: ", BULLET);
+    log_bold_info(SINK_STDERR, "%s \n", key);
+    log_f(SINK_STDERR, "    %s value: ", BULLET);
+    log_info(SINK_STDERR, "%s", args->reveal ? value : "*****");
+    log_f(SINK_STDERR, "\n\n");
+}
 
-    if (args->dry_run) {
-        log_info(SINK_STDERR, "[INFO]");
-        log_f(SINK_STDERR, " The following %zu ENV%s were parsed and will be emitted to stdout... \n",
-              parser->env_map.count, TO_PLURAL(parser->env_map.count));
-        for (size_t i = 0; i < parser->env_map.count; ++i) {
-            const env_t env = parser->env_map.items[i];
-            log_f(SINK_STDERR, "    %s ", BULLET);
-            log_bold_info(SINK_STDERR, "%s=", env.key);
-            if (args->reveal) {
-                log_bold_info(SINK_STDERR, "%s", env.value);
-            } else {
-                log_bold_info(SINK_STDERR, "*****");
-            }
-            log_f(SINK_STDERR, "\n");
-        }
-        log_f(SINK_STDERR, "\n");
+result_t run_parser(arena_t *arena, const args_t *args, const token_list_t *tokens, parser_t *parser) {
+    program_t program;
+    result_t result = compile_program(arena, tokens, &program);
+    if (!result.ok) {
+        return result;
+    }
 
-        return RESULT_OK;
+    if (!args->dry_run) {
+        return run_program(arena, args, &program, parser, NULL, NULL);
     }
 
-    if (args->command.count > 0 && parser->missing_envs.count > 0) {
-        log_error(SINK_STDERR,
-                  "[ERROR] The following ENV keys were marked as required, but are undefined or empty after parsing:");
-        for (size_t i = 0; i < parser->missing_envs.count; ++i) {
-            log_error(SINK_STDERR, "\n   %s %s", BULLET, parser->missing_envs.items[i]);
+    log_info(SINK_STDERR, "[INFO]");
+    log_f(SINK_STDERR, " Attempting to parse %zu token%s...\n\n", tokens->count, TO_PLURAL(tokens->count));
+
+    dry_run_log_t log = {.args = args, .tokens = tokens};
+    result = run_program(arena, args, &program, parser, log_token, &log);
+    if (!result.ok) {
+        return result;
+    }
+    log_comments_until(&log, tokens->count);
+
+    log_info(SINK_STDERR, "[INFO]");
+    log_f(SINK_STDERR, " The following %zu ENV%s were parsed and will be emitted to stdout... \n",
+          parser->env_map.count, TO_PLURAL(parser->env_map.count));
+    for (size_t i = 0; i < parser->env_map.count; ++i) {
+        const env_t env = parser->env_map.items[i];
+        log_f(SINK_STDERR, "    %s ", BULLET);
+        log_bold_info(SINK_STDERR, "%s=", env.key);
+        if (args->reveal) {
+            log_bold_info(SINK_STDERR, "%s", env.value);
+        } else {
+            log_bold_info(SINK_STDERR, "*****");
         }
-        log_error(SINK_STDERR, "\n");
-        return OPERATION_FAILURE;
+        log_f(SINK_STDERR, "\n");
     }
+    log_f(SINK_STDERR, "\n");
 
     return RESULT_OK;
 }
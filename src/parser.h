@@ -3,7 +3,9 @@
 
 #include "arena.h"
 #include "arg.h"
+#include "buf.h"
 #include "hashmap.h"
+#include "strpool.h"
 #include "tokenizer.h"
 
 // The parser is strictly responsible for converting tokenized values from .env files
@@ -34,7 +36,7 @@ typedef struct {
 
 typedef struct {
     const char *key;
-    char *value;
+    const char *value;
 } env_t;
 
 typedef struct {
@@ -42,6 +44,7 @@ typedef struct {
     size_t count;
     size_t capacity;
     hashmap_t index;
+    strpool_t pool; // the keys and values of a map built by run_parser; identical values share one copy
 } env_map_t;
 
 typedef struct {
@@ -49,7 +52,30 @@ typedef struct {
     list_t missing_envs;
 } parser_t;
 
+// Returns the value an interpolated key resolves to, or NULL when it's undefined
+typedef const char *(*key_resolver_t)(void *ctx, const char *key);
+
 env_t *get_env_from_map(env_map_t *env_map, const char *entry);
+
+// Interns every key of 'env_map' into its pool, then points each entry at its key and at the
+// value whose pool offset 'value_offsets' gives. Called once nothing more is interned, since
+// the pool moves as it grows.
+void seal_env_map(arena_t *arena, env_map_t *env_map, const size_t *value_offsets);
+
+// The length of the key in an interpolated ${KEY} or ${KEY:-default} value token
+size_t get_interpolated_key_len(const char *raw_value, size_t raw_value_len);
+
+// Whether evaluating token 'ti' assembles a value: it has a key, or a keyless one has something
+// other than comments (whose interpolations must still be defined, even though it isn't stored)
+bool is_assembled_token(const token_list_t *tokens, size_t ti);
+
+// Assembles the value of token 'ti' into 'value' (cleared first), looking up each interpolated
+// key with 'resolve'
+result_t assemble_value(arena_t *arena, const args_t *args, const token_list_t *tokens, size_t ti,
+                        key_resolver_t resolve, void *ctx, buf_t *value);
 result_t run_parser(arena_t *arena, const args_t *args, const token_list_t *tokens, parser_t *parser);
 
+// Lists the required keys that are undefined or empty and fails
+result_t report_missing_envs(const list_t *missing_envs);
+
 #endif // PARSER_H
@@ -0,0 +1,149 @@
+#include "perf.h"
+#include <errno.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <string.h>
+
+#if defined(__linux__)
+#include <linux/perf_event.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+
+static const uint64_t hw_events[PERF_COUNTER_COUNT] = {
+    [PERF_INSTRUCTIONS] = PERF_COUNT_HW_INSTRUCTIONS,
+    [PERF_CYCLES] = PERF_COUNT_HW_CPU_CYCLES,
+    [PERF_CACHE_MISSES] = PERF_COUNT_HW_CACHE_MISSES,
+    [PERF_BRANCH_MISSES] = PERF_COUNT_HW_BRANCH_MISSES,
+};
+
+// layout of a PERF_FORMAT_GROUP read with both time fields
+typedef struct {
+    uint64_t nr;
+    uint64_t time_enabled;
+    uint64_t time_running;
+    uint64_t values[PERF_COUNTER_COUNT];
+} group_read_t;
+
+static int open_counter(uint64_t event, int group_fd) {
+    struct perf_event_attr attr;
+    memset(&attr, 0, sizeof(attr));
+    attr.type = PERF_TYPE_HARDWARE;
+    attr.size = sizeof(attr);
+    attr.config = event;
+    attr.disabled = group_fd == -1; // the leader starts the whole group once every member is attached
+    attr.exclude_kernel = 1;
+    attr.exclude_hv = 1;
+    attr.read_format = PERF_FORMAT_GROUP | PERF_FORMAT_TOTAL_TIME_ENABLED | PERF_FORMAT_TOTAL_TIME_RUNNING;
+
+    return (int)syscall(SYS_perf_event_open, &attr, 0, -1, group_fd, PERF_FLAG_FD_CLOEXEC);
+}
+
+static void close_fds(perf_group_t *g) {
+    for (int i = PERF_COUNTER_COUNT - 1; i >= 0; --i) {
+        if (g->fds[i] >= 0) {
+            close(g->fds[i]);
+            g->fds[i] = -1;
+        }
+    }
+}
+
+bool perf_group_open(perf_group_t *g) {
+    for (int i = 0; i < PERF_COUNTER_COUNT; ++i) {
+        g->fds[i] = -1;
+    }
+    g->open = false;
+    g->error = 0;
+
+    for (int i = 0; i < PERF_COUNTER_COUNT; ++i) {
+        g->fds[i] = open_counter(hw_events[i], i == 0 ? -1 : g->fds[0]);
+        if (g->fds[i] < 0) {
+            g->error = errno;
+            close_fds(g);
+            return false;
+        }
+    }
+
+    if (ioctl(g->fds[0], PERF_EVENT_IOC_ENABLE, PERF_IOC_FLAG_GROUP) != 0) {
+        g->error = errno;
+        close_fds(g);
+        return false;
+    }
+
+    g->open = true;
+    return true;
+}
+
+bool perf_group_read(const perf_group_t *g, perf_counts_t *out) {
+    if (!g->open) {
+        return false;
+    }
+
+    group_read_t data;
+    ssize_t n = read(g->fds[0], &data, sizeof(data));
+    if (n != (ssize_t)sizeof(data) || data.nr != PERF_COUNTER_COUNT) {
+        return false;
+    }
+
+    // the group shares one PMU slot set, so a single enabled/running ratio covers every member
+    double scale = 1.0;
+    if (data.time_running > 0 && data.time_running < data.time_enabled) {
+        scale = (double)data.time_enabled / (double)data.time_running;
+    }
+
+    for (int i = 0; i < PERF_COUNTER_COUNT; ++i) {
+        out->counts[i] = (uint64_t)((double)data.values[i] * scale);
+    }
+
+    return true;
+}
+
+void perf_group_close(perf_group_t *g) {
+    if (g->open) {
+        close_fds(g);
+        g->open = false;
+    }
+}
+
+const char *perf_error_text(const perf_group_t *g) {
+    switch (g->error) {
+        case 0:
+            return "ok";
+        case EACCES:
+        case EPERM:
+            return "not permitted (see /proc/sys/kernel/perf_event_paranoid)";
+        case ENOENT:
+        case EOPNOTSUPP:
+            return "no hardware counters (virtual machine or container?)";
+        case ENOSYS:
+            return "perf_event_open is not supported by this kernel";
+        default:
+            return strerror(g->error);
+    }
+}
+
+#else
+
+bool perf_group_open(perf_group_t *g) {
+    for (int i = 0; i < PERF_COUNTER_COUNT; ++i) {
+        g->fds[i] = -1;
+    }
+    g->open = false;
+    g->error = ENOSYS;
+    return false;
+}
+
+bool perf_group_read(const perf_group_t *g, perf_counts_t *out) {
+    (void)g;
+    (void)out;
+    return false;
+}
+
+void perf_group_close(perf_group_t *g) { g->open = false; }
+
+const char *perf_error_text(const perf_group_t *g) {
+    (void)g;
+    return "hardware counters are only supported on Linux";
+}
+
+#endif
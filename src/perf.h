@@ -0,0 +1,79 @@
+#ifndef PERF_H
+#define PERF_H
+
+#include <stdbool.h>
+#include <stdint.h>
+
+// Hardware performance counters for --stats, via Linux perf_event_open. A group of
+// instructions, cycles, cache misses and branch misses is opened per thread (the counters
+// follow the calling thread only) and read as deltas between phase boundaries.
+//
+// Counting is user space only (exclude_kernel), which is what the default
+// perf_event_paranoid=2 permits unprivileged; kernel time spent in read() or getdents() is
+// left out. Elsewhere, in containers without PMU access, or when perf events are not
+// permitted, perf_group_open fails and the stats report the counters as unavailable.
+
+typedef enum {
+    PERF_INSTRUCTIONS,
+    PERF_CYCLES,
+    PERF_CACHE_MISSES,
+    PERF_BRANCH_MISSES,
+    PERF_COUNTER_COUNT
+} perf_counter_t;
+
+static inline const char *get_perf_counter_name(perf_counter_t counter) {
+    switch (counter) {
+        case PERF_INSTRUCTIONS:
+            return "instructions";
+        case PERF_CYCLES:
+            return "cycles";
+        case PERF_CACHE_MISSES:
+            return "cache_misses";
+        case PERF_BRANCH_MISSES:
+            return "branch_misses";
+        case PERF_COUNTER_COUNT:
+            break;
+    }
+
+    return "unknown";
+}
+
+typedef struct {
+    uint64_t counts[PERF_COUNTER_COUNT];
+} perf_counts_t;
+
+typedef struct {
+    int fds[PERF_COUNTER_COUNT];
+    bool open;
+    int error; // errno from the failed perf_event_open, 0 when open
+} perf_group_t;
+
+// Opens and starts the group for the calling thread. Returns false (with g->error set) when
+// hardware counters are unavailable.
+bool perf_group_open(perf_group_t *g);
+
+// Reads the running totals, scaled up if the kernel multiplexed the group off the PMU.
+// Returns false if the group isn't open or the read failed.
+bool perf_group_read(const perf_group_t *g, perf_counts_t *out);
+
+// Safe on a zero-initialized or failed group
+void perf_group_close(perf_group_t *g);
+
+// Human readable reason for g->error
+const char *perf_error_text(const perf_group_t *g);
+
+static inline void perf_counts_add(perf_counts_t *dst, const perf_counts_t *src) {
+    for (int i = 0; i < PERF_COUNTER_COUNT; ++i) {
+        dst->counts[i] += src->counts[i];
+    }
+}
+
+static inline perf_counts_t perf_counts_sub(const perf_counts_t *end, const perf_counts_t *start) {
+    perf_counts_t delta;
+    for (int i = 0; i < PERF_COUNTER_COUNT; ++i) {
+        delta.counts[i] = end->counts[i] >= start->counts[i] ? end->counts[i] - start->counts[i] : 0;
+    }
+    return delta;
+}
+
+#endif // PERF_H
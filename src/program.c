@@ -0,0 +1,356 @@
+#include "program.h"
+#include "arena.h"
+#include "buf.h"
+#include "dynarr.h"
+#include "errors.h"
+#include "hashmap.h"
+#include "parser.h"
+#include "result.h"
+#include "strpool.h"
+#include "tokenizer.h"
+#include <stdbool.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define NO_VALUE SIZE_MAX
+
+typedef struct {
+    bool *items;
+    size_t count;
+    size_t capacity;
+} flags_t;
+
+typedef struct {
+    uint32_t *items;
+    size_t count;
+    size_t capacity;
+} slots_t;
+
+typedef struct {
+    arena_t *arena;
+    instruction_t *code; // sized by a first pass over the tokens, so nothing is copied as it grows
+    instruction_site_t *sites;
+    size_t code_count;
+    char *pool;
+    size_t pool_len;
+    list_t files;
+    const char *last_file; // the borrowed name of files.items[files.count - 1]
+    list_t keys;
+    flags_t referenced;
+    flags_t stored;
+    slots_t env_slots;
+    hashmap_t slot_index;
+    hashmap_t env_index;
+} compiler_t;
+
+static uint32_t intern_slot(compiler_t *c, const char *key, size_t key_len) {
+    size_t slot = hashmap_get(&c->slot_index, key, key_len);
+    if (slot != HASHMAP_NOT_FOUND) {
+        return (uint32_t)slot;
+    }
+
+    const char *owned = arena_strndup(c->arena, key, key_len);
+    DYN_ARR_APPEND(c->arena, &c->keys, owned);
+    DYN_ARR_APPEND(c->arena, &c->referenced, false);
+    DYN_ARR_APPEND(c->arena, &c->stored, false);
+    hashmap_append(c->arena, &c->slot_index, owned, key_len, c->keys.count - 1);
+    return (uint32_t)(c->keys.count - 1);
+}
+
+// tokens arrive file by file, so comparing against the last name interns them
+static uint32_t intern_file(compiler_t *c, const char *file) {
+    if (c->files.count == 0 || (c->last_file != file && strcmp(c->last_file, file) != 0)) {
+        DYN_ARR_APPEND(c->arena, &c->files, arena_strdup(c->arena, file));
+        c->last_file = file;
+    }
+
+    return (uint32_t)(c->files.count - 1);
+}
+
+static void emit(compiler_t *c, opcode_t op, uint32_t slot, uint32_t offset, uint32_t len, instruction_site_t site) {
+    c->code[c->code_count] = (instruction_t){.op = op, .slot = slot, .offset = offset, .len = len};
+    c->sites[c->code_count] = site;
+    ++c->code_count;
+}
+
+static uint32_t pool_append(compiler_t *c, const char *bytes, size_t len) {
+    uint32_t offset = (uint32_t)c->pool_len;
+    memcpy(c->pool + c->pool_len, bytes, len);
+    c->pool_len += len;
+    return offset;
+}
+
+result_t compile_program(arena_t *arena, const token_list_t *tokens, program_t *program) {
+    // every value token compiles to at most one instruction and one stretch of the pool
+    size_t max_code = 0;
+    size_t max_pool = 0;
+    for (size_t ti = 0; ti < tokens->count; ++ti) {
+        if (!is_assembled_token(tokens, ti)) {
+            continue;
+        }
+
+        size_t first = tokens->first_values[ti];
+        max_code += tokens->value_counts[ti] + 1;
+        for (size_t v = first; v < first + tokens->value_counts[ti]; ++v) {
+            max_pool += tokens->lens[v];
+        }
+    }
+
+    if (max_pool > UINT32_MAX || max_code > UINT32_MAX || tokens->count > UINT32_MAX) {
+        return operation_error("The .env files are too large to compile; aborting.\n");
+    }
+
+    compiler_t c = {.arena = arena};
+    c.code = arena_alloc(arena, max_code * sizeof(*c.code));
+    c.sites = arena_alloc(arena, max_code * sizeof(*c.sites));
+    c.pool = arena_alloc(arena, max_pool);
+
+    for (size_t ti = 0; ti < tokens->count; ++ti) {
+        // comments compile to nothing; a dry run logs them from the tokens
+        if (!is_assembled_token(tokens, ti)) {
+            continue;
+        }
+
+        // a literal only merges into the OP_LIT right before it within one value
+        size_t value_start = c.code_count;
+        size_t first = tokens->first_values[ti];
+
+        for (size_t v = first; v < first + tokens->value_counts[ti]; ++v) {
+            const char *raw_value = token_value(tokens, ti, v);
+            uint32_t raw_value_len = tokens->lens[v];
+            instruction_site_t site = {.line = tokens->lines[v], .byte = tokens->bytes[v]};
+
+            switch ((value_kind_t)tokens->kinds[v]) {
+                case LITERAL_VALUE: {
+                    if (raw_value_len == 0) {
+                        break;
+                    }
+
+                    uint32_t offset = pool_append(&c, raw_value, raw_value_len);
+                    instruction_t *last = c.code_count > value_start ? &c.code[c.code_count - 1] : NULL;
+                    if (last != NULL && last->op == OP_LIT && last->offset + last->len == offset) {
+                        last->len += raw_value_len;
+                    } else {
+                        emit(&c, OP_LIT, 0, offset, raw_value_len, site);
+                    }
+                    break;
+                }
+                case INTERPOLATED_KEY: {
+                    size_t key_len = get_interpolated_key_len(raw_value, raw_value_len);
+                    uint32_t slot = intern_slot(&c, raw_value, key_len);
+                    c.referenced.items[slot] = true;
+
+                    if (key_len == raw_value_len) {
+                        emit(&c, OP_REF, slot, 0, 0, site);
+                        break;
+                    }
+
+                    size_t fallback_len = raw_value_len - key_len - 2;
+                    uint32_t offset = pool_append(&c, raw_value + key_len + 2, fallback_len);
+                    emit(&c, OP_REF_DEFAULT, slot, offset, (uint32_t)fallback_len, site);
+                    break;
+                }
+                case COMMENTED_LINE: {
+                    break;
+                }
+            }
+        }
+
+        const char *key = token_key(tokens, ti);
+        uint32_t file = intern_file(&c, token_file(tokens, ti));
+        if (key == NULL) {
+            emit(&c, OP_DROP, 0, file, (uint32_t)ti, (instruction_site_t){0});
+            continue;
+        }
+
+        size_t key_len = strlen(key);
+        uint32_t slot = intern_slot(&c, key, key_len);
+        emit(&c, OP_STORE, slot, file, (uint32_t)ti, (instruction_site_t){0});
+
+        if (!c.stored.items[slot]) {
+            c.stored.items[slot] = true;
+            DYN_ARR_APPEND(arena, &c.env_slots, slot);
+            hashmap_append(arena, &c.env_index, c.keys.items[slot], key_len, c.env_slots.count - 1);
+        }
+    }
+
+    *program = (program_t){
+        .code = c.code,
+        .sites = c.sites,
+        .code_count = c.code_count,
+        .pool = c.pool,
+        .pool_len = c.pool_len,
+        .files = c.files.items,
+        .keys = c.keys.items,
+        .referenced = c.referenced.items,
+        .slot_count = c.keys.count,
+        .env_slots = c.env_slots.items,
+        .env_count = c.env_slots.count,
+        .env_index = c.env_index,
+    };
+
+    return RESULT_OK;
+}
+
+// the value an instruction belongs to ends at the next OP_STORE or OP_DROP, which names its file
+// (and the OP_STORE its key)
+static const instruction_t *owner(const program_t *program, size_t i) {
+    while (program->code[i].op != OP_STORE && program->code[i].op != OP_DROP) {
+        ++i;
+    }
+
+    return &program->code[i];
+}
+
+static const char *owner_key(const program_t *program, const instruction_t *store) {
+    return store->op == OP_STORE ? program->keys[store->slot] : "(none)";
+}
+
+result_t run_program(arena_t *arena, const args_t *args, const program_t *program, parser_t *parser,
+                     token_hook_t hook, void *hook_ctx) {
+    size_t slot_count = program->slot_count;
+    env_map_t *env_map = &parser->env_map;
+
+    // a slot's value is an offset into the map's pool (which moves as it grows) or NO_VALUE
+    size_t *values = arena_alloc(arena, slot_count * sizeof(*values));
+    for (size_t slot = 0; slot < slot_count; ++slot) {
+        values[slot] = NO_VALUE;
+    }
+    size_t *lengths = arena_alloc_zeroed(arena, slot_count * sizeof(*lengths));
+    const char **process = arena_alloc_zeroed(arena, slot_count * sizeof(*process));
+    size_t *process_lengths = arena_alloc_zeroed(arena, slot_count * sizeof(*process_lengths));
+
+    // interpolation reads the process ENVs first, and nothing sets them while a program runs
+    for (size_t slot = 0; slot < slot_count; ++slot) {
+        if (program->referenced[slot]) {
+            process[slot] = getenv(program->keys[slot]);
+            process_lengths[slot] = process[slot] != NULL ? strlen(process[slot]) : 0;
+        }
+    }
+
+    // room for every literal plus a guess at the keys; only interpolation grows it past that
+    strpool_reserve(arena, &env_map->pool, program->pool_len + program->env_count * 16, program->env_count * 2);
+
+    buf_t value = {.arena = arena};
+
+    // running total of the KEY=value bytes that would be emitted; bounded so
+    // per-key interpolation amplification can't compound into an OOM abort
+    size_t total_output = 0;
+
+    for (size_t i = 0; i < program->code_count; ++i) {
+        const instruction_t *instruction = &program->code[i];
+        uint32_t slot = instruction->slot;
+
+        switch ((opcode_t)instruction->op) {
+            case OP_LIT: {
+                DYN_ARR_APPEND_MANY(arena, &value, program->pool + instruction->offset, instruction->len);
+                break;
+            }
+            case OP_REF:
+            case OP_REF_DEFAULT: {
+                const char *env = process[slot];
+                if (env == NULL && values[slot] != NO_VALUE) {
+                    env = strpool_at(&env_map->pool, values[slot]);
+                }
+                size_t env_len = process[slot] != NULL ? process_lengths[slot] : lengths[slot];
+
+                if (env == NULL && instruction->op == OP_REF) {
+                    const instruction_t *store = owner(program, i);
+                    return operation_error("The '%s' key contains an interpolated key variable %s (%s:%zu:%zu) that "
+                                           "is not defined.\n",
+                                           owner_key(program, store), program->keys[slot],
+                                           program->files[store->offset], (size_t)program->sites[i].line,
+                                           (size_t)program->sites[i].byte);
+                }
+
+                if (env != NULL && env_len > 0) {
+                    DYN_ARR_APPEND_MANY(arena, &value, env, env_len);
+                } else if (instruction->op == OP_REF_DEFAULT) {
+                    DYN_ARR_APPEND_MANY(arena, &value, program->pool + instruction->offset, instruction->len);
+                }
+                break;
+            }
+            case OP_STORE: {
+                const char *key = program->keys[slot];
+                const char *bytes = value.items != NULL ? value.items : "";
+                size_t offset = strpool_intern(arena, &env_map->pool, bytes, value.count);
+
+                if (values[slot] != NO_VALUE) {
+                    total_output -= lengths[slot];
+                    total_output += value.count;
+                } else {
+                    // KEY=value plus a delimiter, mirroring the emitted layout
+                    total_output += strlen(key) + value.count + 2;
+                }
+                if (hook != NULL) {
+                    const char *previous = values[slot] != NO_VALUE ? strpool_at(&env_map->pool, values[slot]) : NULL;
+                    hook(hook_ctx, instruction->len, key, previous, strpool_at(&env_map->pool, offset));
+                }
+                values[slot] = offset;
+                lengths[slot] = value.count;
+                value.count = 0;
+
+                if (total_output > MAX_PARSED_OUTPUT) {
+                    return operation_error(
+                        "The total parsed ENV output exceeds %zu bytes after the '%s' key (%s); aborting.\n",
+                        (size_t)MAX_PARSED_OUTPUT, key, program->files[instruction->offset]);
+                }
+                continue;
+            }
+            case OP_DROP: {
+                if (hook != NULL) {
+                    hook(hook_ctx, instruction->len, NULL, NULL, NULL);
+                }
+                value.count = 0;
+                continue;
+            }
+        }
+
+        // every appended chunk is independently bounded, so checking after each instruction
+        // catches runaway expansion before it can compound
+        if (value.count > MAX_ENV_VALUE_SIZE) {
+            const instruction_t *store = owner(program, i);
+            return operation_error(
+                "The '%s' key's value exceeds %zu bytes after interpolation (%s:%zu:%zu); aborting.\n",
+                owner_key(program, store), (size_t)MAX_ENV_VALUE_SIZE, program->files[store->offset],
+                (size_t)program->sites[i].line, (size_t)program->sites[i].byte);
+        }
+    }
+
+    if (program->env_count == 0) {
+        return operation_error("After parsing .env tokens, there aren't any ENVs to emit; aborting.\n");
+    }
+
+    // the index was built at compile time; a copy keeps a cached program's untouched
+    env_map->items = arena_alloc(arena, program->env_count * sizeof(*env_map->items));
+    env_map->count = program->env_count;
+    env_map->capacity = program->env_count;
+    size_t *value_offsets = arena_alloc(arena, program->env_count * sizeof(*value_offsets));
+    for (size_t e = 0; e < program->env_count; ++e) {
+        uint32_t slot = program->env_slots[e];
+        env_map->items[e] = (env_t){.key = program->keys[slot]};
+        value_offsets[e] = values[slot];
+    }
+    seal_env_map(arena, env_map, value_offsets);
+    env_map->index = (hashmap_t){
+        .items = arena_memdup(arena, program->env_index.items,
+                              program->env_index.capacity * sizeof(*program->env_index.items)),
+        .capacity = program->env_index.capacity,
+        .count = program->env_index.count,
+        .counts = env_map->index.counts,
+    };
+
+    for (size_t i = 0; i < args->required.count; ++i) {
+        const char *required_key = args->required.items[i];
+        const env_t *entry = get_env_from_map(env_map, required_key);
+        if (entry == NULL || entry->value[0] == '\0') {
+            DYN_ARR_APPEND(arena, &parser->missing_envs, required_key);
+        }
+    }
+
+    if (!args->dry_run && args->command.count > 0 && parser->missing_envs.count > 0) {
+        return report_missing_envs(&parser->missing_envs);
+    }
+
+    return RESULT_OK;
+}
@@ -0,0 +1,77 @@
+#ifndef PROGRAM_H
+#define PROGRAM_H
+
+#include "arena.h"
+#include "arg.h"
+#include "hashmap.h"
+#include "parser.h"
+#include "result.h"
+#include "tokenizer.h"
+#include <stddef.h>
+#include <stdint.h>
+
+// A token list compiled into a flat instruction stream, so evaluating it is one tight loop
+// with no key scanning, hashing or copying of lookup keys:
+//
+// OP_LIT         appends 'len' bytes of the literal pool at 'offset'
+// OP_REF         appends the value of key 'slot' (a process ENV first, then a stored one)
+// OP_REF_DEFAULT like OP_REF, but appends the literal at 'offset' when the key is unset or empty
+// OP_STORE       ends the value being assembled and stores it under key 'slot'; 'offset' is
+//                the index of its file and 'len' the index of its token
+// OP_DROP        ends the value of a keyless token, which is assembled (so an undefined
+//                interpolation still fails) but never stored; 'offset' and 'len' as for OP_STORE
+//
+// Every key (stored or interpolated) is interned to an integer slot once, at compile time,
+// and the ENV map's index is built then too. Comments compile to nothing, and adjacent
+// literals merge into one OP_LIT.
+//
+// A program owns copies of everything it refers to (keys, literals, file names), so it
+// outlives the tokens it was compiled from and can be cached and replayed: `nvi serve`
+// keeps the programs of the file sets it has parsed. A replay reads the process ENVs again.
+
+typedef enum { OP_LIT, OP_REF, OP_REF_DEFAULT, OP_STORE, OP_DROP } opcode_t;
+
+typedef struct {
+    uint32_t op;
+    uint32_t slot;
+    uint32_t offset;
+    uint32_t len;
+} instruction_t;
+
+// Where an instruction came from, only read to report an error (the file is its OP_STORE's
+// or OP_DROP's)
+typedef struct {
+    uint32_t line;
+    uint32_t byte;
+} instruction_site_t;
+
+typedef struct {
+    instruction_t *code;
+    instruction_site_t *sites; // parallel to 'code'
+    size_t code_count;
+    const char *pool; // the literal bytes
+    size_t pool_len;
+    const char **files;
+    const char **keys;    // slot -> key
+    bool *referenced;     // slot -> some instruction interpolates it
+    size_t slot_count;
+    uint32_t *env_slots;  // the stored slots, in the order their keys are first defined
+    size_t env_count;
+    hashmap_t env_index;  // key -> position in 'env_slots', as an env map's index
+} program_t;
+
+// Called as each assembled token's value is evaluated: 'token' is its index in the compiled token
+// list, 'key' is NULL for a keyless token, and 'previous' is the value a redefined key replaces
+// (else NULL). The strings are only valid for the call.
+typedef void (*token_hook_t)(void *ctx, size_t token, const char *key, const char *previous, const char *value);
+
+// Compiles 'tokens' into 'program', allocated from 'arena'
+result_t compile_program(arena_t *arena, const token_list_t *tokens, program_t *program);
+
+// Evaluates 'program' into 'parser', allocating the values from 'arena' and calling 'hook' (when
+// not NULL) with 'hook_ctx' after each token. A dry run lists the missing required keys in
+// 'parser' without failing.
+result_t run_program(arena_t *arena, const args_t *args, const program_t *program, parser_t *parser,
+                     token_hook_t hook, void *hook_ctx);
+
+#endif // PROGRAM_H
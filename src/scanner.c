@@ -6,11 +6,18 @@
 #include "dynarr.h"
 #include "errors.h"
 #include "file.h"
+#include "gitindex.h"
 #include "hashset.h"
+#include "ignore.h"
+#include "lines.h"
 #include "log.h"
 #include "macros.h"
 #include "matcher.h"
 #include "nthread.h"
+#include "sniff.h"
+#include "stats.h"
+#include "timer.h"
+#include "trace.h"
 #include "tty.h"
 #include "utils.h"
 #include <errno.h>
@@ -27,30 +34,93 @@ typedef enum {
     ENTRY_FILE,
 } entry_kind_t;
 
+// a directory to walk, with the ignore rules of every directory above it
 typedef struct {
-    char **items;
+    char *path;
+    const ignore_t *ignore;
+} queued_dir_t;
+
+typedef struct {
+    queued_dir_t *items;
     size_t count;
     size_t capacity;
 } dir_queue_t;
 
+// Walking and scanning are separate stages: a walker collects the candidate files of a
+// directory into batches and queues them, so the files of one huge directory spread across
+// every worker. The queue is bounded; a walker that finds it full scans its batch itself.
+#define FILE_BATCH_FILES 32
+#define FILE_BATCHES_PER_WORKER 4
+
+typedef struct file_batch_t {
+    struct file_batch_t *next; // the queue or free list it's on
+    size_t count;
+    size_t used;
+    char paths[2 * PATH_MAX]; // 'count' NUL-terminated paths, back to back
+    // the order to scan them in: where each path starts in 'paths', and its size when the
+    // schedule is largest-first (largest first; all 0, so in walk order, otherwise)
+    uint16_t offsets[FILE_BATCH_FILES];
+    size_t sizes[FILE_BATCH_FILES];
+} file_batch_t;
+
+// A file over MATCH_CHUNK_SIZE * 2 bytes is matched in MATCH_CHUNK_SIZE chunks that any worker
+// can claim, so one huge file doesn't pin its worker while the rest go idle
+#define MATCH_CHUNK_SIZE ((size_t)512 * 1024)
+
+typedef struct match_job_t {
+    struct match_job_t *next; // the jobs with chunks left to claim
+    const file_details_t *file;
+    const file_ext_t *file_ext;
+    match_chunk_t *chunks;
+    arena_t *arenas; // one per chunk, since any worker may match it
+    size_t count;
+    size_t claimed;
+    size_t finished;
+} match_job_t;
+
+struct scan_worker_t;
+
 typedef struct {
     const args_t *args;
     mutex_t lock;
     cond_t work_ready;
+    cond_t chunks_done;   // a job's last chunk finished
+    cond_t memory_freed;  // a file released its share of the memory budget
+    size_t memory_budget; // bytes of file contents workers may hold at once; 0 for no limit
+    size_t in_flight;     // bytes currently reserved against 'memory_budget'
     arena_t arena; // shared queue storage; only ever touched under 'lock'
     dir_queue_t dirs;
-    size_t pending;  // dirs queued or currently being processed
+    file_batch_t *batches; // queued file batches
+    size_t batch_count;
+    size_t max_batches;
+    file_batch_t *free_batches;
+    match_job_t *jobs;
+    size_t pending;  // dirs and file batches queued or currently being processed
     result_t result; // first error wins
     bool failed;
+    trace_t *trace;
+    dir_hook_t before_dir;
+    void *hook_data;
+    const char **files; // a listed scan's candidates, claimed in batches instead of walking
+    size_t file_count;
+    size_t next_file;
+    struct scan_worker_t *workers;
+    uint8_t max_workers;
+    uint8_t started;      // workers running or done; the first runs on the calling thread
+    bool spawn_on_demand; // --threads auto: start workers as queued work outgrows the idle ones
+    size_t waiting;       // workers blocked on 'work_ready'
 } walk_ctx_t;
 
-typedef struct {
+typedef struct scan_worker_t {
     walk_ctx_t *ctx;
     scanner_t scanner; // share-nothing: private counters and env hashset
     buf_t report;      // per-worker report buffer; each flush is one fwrite,
                        // so blocks land whole even under concurrency
     arena_t arena;     // worker lifetime: env key set, report buffer, path scratch
     arena_t scratch;   // file lifetime: contents and match list, reset after each file
+    file_batch_t *batch; // the candidates being collected from the directory being walked
+    trace_ring_t trace;
+    uint32_t id;
     thread_t thread;
 } scan_worker_t;
 
@@ -86,12 +156,20 @@ static void report_empty_file_warning(const args_t *args, buf_t *buf, const char
     log_buf_flush(buf);
 }
 
-static void report_file_scan_results(const args_t *args, buf_t *buf, const char *path,
-                                     const env_key_matches_t *matches) {
+// 'positions' holds the matches' positions when the file was streamed, and is NULL when
+// they're resolved from the contents
+static void report_file_scan_results(const args_t *args, arena_t *scratch, buf_t *buf, const file_details_t *file,
+                                     const env_key_matches_t *matches, const match_positions_t *positions) {
     if (!args->dry_run || matches->count == 0) {
         return;
     }
 
+    const char *path = file->path;
+    line_index_t lines = {0};
+    if (positions == NULL) {
+        build_line_index(scratch, file->contents, file->len, &lines);
+    }
+
     log_info(SINK_BUF(buf), "[INFO]");
     log_f(SINK_BUF(buf), " Scanned ");
     log_fi(SINK_BUF(buf), "%s", path);
@@ -101,7 +179,14 @@ static void report_file_scan_results(const args_t *args, buf_t *buf, const char
         const env_key_match_t *m = &matches->items[i];
         log_f(SINK_BUF(buf), "    %s ", BULLET);
         log_bold_info(SINK_BUF(buf), "%.*s", (int)m->key_len, m->key);
-        log_comment(SINK_BUF(buf), " [%zu:%zu]\n", m->line, m->byte);
+        size_t line, byte;
+        if (positions != NULL) {
+            line = positions->items[i].line;
+            byte = positions->items[i].byte;
+        } else {
+            line_index_position(&lines, m->offset, &line, &byte);
+        }
+        log_comment(SINK_BUF(buf), " [%zu:%zu]\n", line, byte);
     }
 
     log_f(SINK_BUF(buf), "\n");
@@ -118,6 +203,14 @@ static void report_scan_summary(const args_t *args, const scanner_t *scanner) {
           scanner->dirs_scanned, TO_PLURAL(scanner->dirs_scanned, "ies", "y"), scanner->files_scanned,
           TO_PLURAL(scanner->files_scanned), scanner->references, TO_PLURAL(scanner->references),
           scanner->env_keys.count, TO_PLURAL(scanner->env_keys.count));
+
+    const size_t *skipped = scanner->stats.skipped;
+    size_t sniffed = skipped[SKIP_BINARY] + skipped[SKIP_MINIFIED] + skipped[SKIP_GENERATED];
+    if (sniffed > 0) {
+        log_info(SINK_STDERR, "[INFO]");
+        log_f(SINK_STDERR, " Skipped %zu binary, %zu minified and %zu generated file%s (see --scan-skip)\n\n",
+              skipped[SKIP_BINARY], skipped[SKIP_MINIFIED], skipped[SKIP_GENERATED], TO_PLURAL(sniffed));
+    }
 }
 
 static void report_required_keys(const args_t *args) {
@@ -164,53 +257,378 @@ static void copy_unique_env_key(arena_t *worker_arena, scanner_t *scanner, const
     hashset_append(worker_arena, &scanner->env_keys, new_key, env_match->key_len);
 }
 
-static result_t scan_file(const args_t *args, scan_worker_t *worker, const char *path, const char *name) {
-    const file_ext_t *file_ext_match = get_file_accessors(&args->scan_exts, name);
-    if (file_ext_match == NULL) {
-        return RESULT_OK;
+static thread_ret_t THREAD_CALL scan_worker(void *arg);
+
+// Starts another worker when there's more queued work than idle workers to take it; called
+// with 'lock' held, so the queue can only grow as fast as workers can be started
+static void spawn_worker_on_demand(walk_ctx_t *ctx) {
+    if (!ctx->spawn_on_demand || ctx->failed || ctx->started == ctx->max_workers) {
+        return;
     }
 
-    file_details_t file = open_file(&worker->scratch, path);
-    if (file.contents == NULL) {
-        arena_reset(&worker->scratch);
-        return RESULT_OK;
+    size_t queued = ctx->dirs.count + ctx->batch_count;
+    queued += (ctx->file_count - ctx->next_file + FILE_BATCH_FILES - 1) / FILE_BATCH_FILES;
+    for (const match_job_t *job = ctx->jobs; job != NULL; job = job->next) {
+        queued += job->count - job->claimed;
     }
 
-    if (file.len == 0) {
-        report_empty_file_warning(args, &worker->report, path);
-        arena_reset(&worker->scratch);
-        return RESULT_OK;
+    if (queued <= ctx->waiting) {
+        return;
     }
 
-    ++worker->scanner.files_scanned;
+    scan_worker_t *worker = &ctx->workers[ctx->started];
+    if (thread_create(&worker->thread, scan_worker, worker) == 0) {
+        ++ctx->started;
+    } else {
+        // out of threads: the ones already running will get through the queue
+        ctx->spawn_on_demand = false;
+    }
+}
+
+// Matches the next unclaimed chunk of 'job'. Called and returns with ctx->lock held.
+static void match_next_chunk(walk_ctx_t *ctx, trace_ring_t *ring, match_job_t *job) {
+    size_t i = job->claimed++;
+    if (job->claimed == job->count) {
+        match_job_t **link = &ctx->jobs;
+        while (*link != job) {
+            link = &(*link)->next;
+        }
+        *link = job->next;
+    }
+    mutex_unlock(&ctx->lock);
+
+    scan_file_chunk(&job->arenas[i], job->file, job->file_ext, &job->chunks[i]);
+
+    trace_mutex_lock(ring, &ctx->lock);
+    if (++job->finished == job->count) {
+        cond_broadcast(&ctx->chunks_done);
+    }
+}
+
+// Offers the chunks of a large file to every worker, matches the ones nobody else claims,
+// then waits for the rest and joins their matches in file order
+static void match_in_chunks(scan_worker_t *worker, const file_details_t *file, const file_ext_t *file_ext,
+                            env_key_matches_t *env_key_matches) {
+    walk_ctx_t *ctx = worker->ctx;
+
+    match_job_t *job = arena_alloc_zeroed(&worker->scratch, sizeof(*job));
+    job->file = file;
+    job->file_ext = file_ext;
+    job->count = (file->len + MATCH_CHUNK_SIZE - 1) / MATCH_CHUNK_SIZE;
+    job->chunks = arena_alloc_zeroed(&worker->scratch, job->count * sizeof(*job->chunks));
+    job->arenas = arena_alloc_zeroed(&worker->scratch, job->count * sizeof(*job->arenas));
+    for (size_t i = 0; i < job->count; ++i) {
+        job->chunks[i].from = i * MATCH_CHUNK_SIZE;
+        job->chunks[i].to = i + 1 == job->count ? file->len : (i + 1) * MATCH_CHUNK_SIZE;
+    }
+
+    trace_mutex_lock(&worker->trace, &ctx->lock);
+    job->next = ctx->jobs;
+    ctx->jobs = job;
+    cond_broadcast(&ctx->work_ready);
+    spawn_worker_on_demand(ctx);
+
+    while (job->claimed < job->count) {
+        match_next_chunk(ctx, &worker->trace, job);
+    }
+    while (job->finished < job->count) {
+        cond_wait(&ctx->chunks_done, &ctx->lock);
+    }
+    mutex_unlock(&ctx->lock);
+
+    merge_match_chunks(&worker->scratch, file, file_ext, job->chunks, job->count, env_key_matches);
+
+    for (size_t i = 0; i < job->count; ++i) {
+        arena_free(&job->arenas[i]);
+    }
+}
+
+static skip_reason_t get_sniff_skip_reason(sniff_kind_t kind) {
+    switch (kind) {
+        case SNIFF_BINARY:
+            return SKIP_BINARY;
+        case SNIFF_MINIFIED:
+            return SKIP_MINIFIED;
+        default:
+            return SKIP_GENERATED;
+    }
+}
+
+// Waits until 'bytes' fit in the scan's memory budget, then takes them; returns the seconds
+// spent waiting when timed. A file larger than the whole budget waits until nothing else is in
+// flight and then runs alone, rather than failing.
+static double reserve_scan_memory(scan_worker_t *worker, size_t bytes, bool timed) {
+    walk_ctx_t *ctx = worker->ctx;
+    if (ctx->memory_budget == 0) {
+        return 0;
+    }
+
+    double wait_start = 0;
+    trace_mutex_lock(&worker->trace, &ctx->lock);
+    if (ctx->in_flight > 0 && ctx->in_flight + bytes > ctx->memory_budget && timed) {
+        wait_start = monotonic_seconds();
+    }
+    while (ctx->in_flight > 0 && ctx->in_flight + bytes > ctx->memory_budget) {
+        cond_wait(&ctx->memory_freed, &ctx->lock);
+    }
+    ctx->in_flight += bytes;
+    mutex_unlock(&ctx->lock);
+
+    if (wait_start == 0) {
+        return 0;
+    }
+
+    double now = monotonic_seconds();
+    trace_span(&worker->trace, "memory_wait", NULL, wait_start, now);
+    return now - wait_start;
+}
+
+static void release_scan_memory(scan_worker_t *worker, size_t bytes) {
+    walk_ctx_t *ctx = worker->ctx;
+    if (ctx->memory_budget == 0) {
+        return;
+    }
+
+    trace_mutex_lock(&worker->trace, &ctx->lock);
+    ctx->in_flight -= bytes;
+    cond_broadcast(&ctx->memory_freed);
+    mutex_unlock(&ctx->lock);
+}
+
+// Folds a streamed window's matches into the worker's keys, so they needn't outlive it
+static void take_window_matches(void *ctx, const env_key_matches_t *matches) {
+    scan_worker_t *worker = ctx;
+    for (size_t i = 0; i < matches->count; ++i) {
+        ++worker->scanner.references;
+        copy_unique_env_key(&worker->arena, &worker->scanner, &matches->items[i]);
+    }
+}
+
+// Reads (or streams) and matches an opened candidate; everything it allocates is in the
+// worker's scratch arena
+static void scan_open_file(const args_t *args, scan_worker_t *worker, file_stream_t *stream,
+                           const file_ext_t *file_ext_match, bool timed, double start) {
+    scan_stats_t *stats = &worker->scanner.stats;
+    const char *path = stream->path;
+
+    // a file over MAX_FILE_SIZE is read as it's matched, so all of its time counts as matching
+    bool streamed = stream->size > MAX_FILE_SIZE;
+    file_details_t file = {.path = path, .len = stream->size};
+    if (!streamed) {
+        file = read_file_stream_contents(&worker->scratch, stream);
+        if (file.contents == NULL) {
+            ++stats->skipped[SKIP_UNREADABLE];
+            return;
+        }
+
+        if (file.len == 0) {
+            ++stats->skipped[SKIP_EMPTY];
+            report_empty_file_warning(args, &worker->report, path);
+            return;
+        }
+    }
+
+    sniff_kind_t sniffed = streamed ? SNIFF_NONE : sniff_contents(file.contents, file.len, args->scan_skip);
+    if (sniffed != SNIFF_NONE) {
+        ++stats->skipped[get_sniff_skip_reason(sniffed)];
+        return;
+    }
+
+    double read_done = timed ? monotonic_seconds() : 0;
 
     env_key_matches_t env_key_matches = {0};
-    scan_file_content(&worker->scratch, &file, file_ext_match, &env_key_matches);
+    match_positions_t positions = {0};
+    if (streamed) {
+        // a dry run lists every match, so only then are they kept past their window
+        bool read = scan_file_stream(&worker->scratch, stream, file_ext_match, args->scan_skip, &sniffed,
+                                     &env_key_matches, args->dry_run ? &positions : NULL,
+                                     args->dry_run ? NULL : take_window_matches, worker);
+        if (!read || sniffed != SNIFF_NONE) {
+            ++stats->skipped[read ? get_sniff_skip_reason(sniffed) : SKIP_UNREADABLE];
+            return;
+        }
+    } else if (args->scan_threads > 1 && file.len > MATCH_CHUNK_SIZE * 2) {
+        match_in_chunks(worker, &file, file_ext_match, &env_key_matches);
+    } else {
+        scan_file_content(&worker->scratch, &file, file_ext_match, &env_key_matches);
+    }
+
+    ++worker->scanner.files_scanned;
 
-    report_file_scan_results(args, &worker->report, path, &env_key_matches);
+    if (timed) {
+        double match_done = monotonic_seconds();
+        stats->totals.read += read_done - start;
+        stats->totals.match += match_done - read_done;
+        stats->totals.bytes_read += file.len;
+        if (args->stats != STATS_OFF) {
+            stats_record_file(&worker->arena, stats, path, file.len, match_done - start);
+        }
+
+        trace_span(&worker->trace, "scan_file", path, start, match_done);
+        trace_span(&worker->trace, "read", NULL, start, read_done);
+        trace_span(&worker->trace, "match", NULL, read_done, match_done);
+    }
+
+    report_file_scan_results(args, &worker->scratch, &worker->report, &file, &env_key_matches,
+                             streamed ? &positions : NULL);
 
     for (size_t i = 0; i < env_key_matches.count; ++i) {
         ++worker->scanner.references;
         copy_unique_env_key(&worker->arena, &worker->scanner, &env_key_matches.items[i]);
     }
+}
+
+static result_t scan_file(const args_t *args, scan_worker_t *worker, const char *path, const char *name) {
+    scan_stats_t *stats = &worker->scanner.stats;
+
+    const file_ext_t *file_ext_match = get_file_accessors(&args->scan_exts, name);
+    if (file_ext_match == NULL) {
+        ++stats->skipped[SKIP_EXTENSION];
+        return RESULT_OK;
+    }
+
+    sniff_kind_t sniffed = sniff_name(name, args->scan_skip);
+    if (sniffed != SNIFF_NONE) {
+        ++stats->skipped[get_sniff_skip_reason(sniffed)];
+        return RESULT_OK;
+    }
+
+    bool timed = args->stats != STATS_OFF || trace_enabled(&worker->trace);
+    double start = timed ? monotonic_seconds() : 0;
+
+    file_stream_t stream;
+    if (!open_file_stream(path, &stream)) {
+        ++stats->skipped[SKIP_UNREADABLE];
+        return RESULT_OK;
+    }
+
+    // the budget covers what a file holds while it's read: all of it, or one streaming window
+    size_t reserved = stream.size > MAX_FILE_SIZE ? STREAM_WINDOW_SIZE + STREAM_MAX_SPAN : stream.size;
+    start += reserve_scan_memory(worker, reserved, timed);
+
+    scan_open_file(args, worker, &stream, file_ext_match, timed, start);
 
+    close_file_stream(&stream);
     arena_reset(&worker->scratch);
+    release_scan_memory(worker, reserved);
 
     return RESULT_OK;
 }
 
-static void queue_dir(walk_ctx_t *ctx, const char *path) {
-    mutex_lock(&ctx->lock);
-    char *copy = arena_strdup(&ctx->arena, path);
-    DYN_ARR_APPEND(&ctx->arena, &ctx->dirs, copy);
+static void queue_dir(walk_ctx_t *ctx, trace_ring_t *ring, const char *path, const ignore_t *ignore) {
+    trace_mutex_lock(ring, &ctx->lock);
+    queued_dir_t dir = {.path = arena_strdup(&ctx->arena, path), .ignore = ignore};
+    DYN_ARR_APPEND(&ctx->arena, &ctx->dirs, dir);
     ++ctx->pending;
     cond_signal(&ctx->work_ready);
+    spawn_worker_on_demand(ctx);
     mutex_unlock(&ctx->lock);
 }
 
-static result_t handle_entry(scan_worker_t *worker, const char *parent, const char *name, char *path,
-                             entry_kind_t kind) {
-    if (name[0] == '.' || is_blacklisted(name)) {
+static result_t scan_batch(scan_worker_t *worker, file_batch_t *batch) {
+    for (size_t i = 0; i < batch->count; ++i) {
+        const char *path = batch->paths + batch->offsets[i];
+        result_t result = scan_file(worker->ctx->args, worker, path, path_basename(path));
+        if (!result.ok) {
+            return result;
+        }
+    }
+
+    batch->count = 0;
+    batch->used = 0;
+    return RESULT_OK;
+}
+
+// Queues 'batch' behind every batch whose largest file is at least as large, so the queue
+// stays largest-first; with the walk schedule every size is 0 and it's simply pushed. Called
+// with 'lock' held.
+static void enqueue_batch(walk_ctx_t *ctx, file_batch_t *batch) {
+    file_batch_t **link = &ctx->batches;
+    while (*link != NULL && (*link)->sizes[0] > batch->sizes[0]) {
+        link = &(*link)->next;
+    }
+    batch->next = *link;
+    *link = batch;
+}
+
+// Hands the worker's batch to the queue for any worker to scan, or scans it right away when
+// the queue is full. Largest-first, a full queue instead gives up its largest batch when that
+// holds larger files than the worker's, so the largest work found so far is what starts first.
+static result_t submit_batch(scan_worker_t *worker) {
+    walk_ctx_t *ctx = worker->ctx;
+
+    trace_mutex_lock(&worker->trace, &ctx->lock);
+    if (ctx->batch_count == ctx->max_batches) {
+        file_batch_t *inline_batch = worker->batch;
+        if (ctx->batches->sizes[0] > worker->batch->sizes[0]) {
+            inline_batch = ctx->batches;
+            ctx->batches = inline_batch->next;
+            enqueue_batch(ctx, worker->batch);
+            worker->batch = inline_batch;
+        }
+        mutex_unlock(&ctx->lock);
+
+        return scan_batch(worker, inline_batch);
+    }
+
+    enqueue_batch(ctx, worker->batch);
+    ++ctx->batch_count;
+    ++ctx->pending;
+
+    file_batch_t *empty = ctx->free_batches;
+    if (empty != NULL) {
+        ctx->free_batches = empty->next;
+    } else {
+        empty = arena_alloc(&ctx->arena, sizeof(*empty));
+    }
+
+    cond_signal(&ctx->work_ready);
+    spawn_worker_on_demand(ctx);
+    mutex_unlock(&ctx->lock);
+
+    empty->count = 0;
+    empty->used = 0;
+    worker->batch = empty;
+    return RESULT_OK;
+}
+
+static result_t batch_file(scan_worker_t *worker, const char *path, size_t size) {
+    size_t len = strlen(path) + 1;
+    if (worker->batch->count == FILE_BATCH_FILES || worker->batch->used + len > sizeof(worker->batch->paths)) {
+        result_t result = submit_batch(worker);
+        if (!result.ok) {
+            return result;
+        }
+    }
+
+    file_batch_t *batch = worker->batch;
+    size_t at = batch->count;
+    while (at > 0 && batch->sizes[at - 1] < size) {
+        batch->offsets[at] = batch->offsets[at - 1];
+        batch->sizes[at] = batch->sizes[at - 1];
+        --at;
+    }
+    batch->offsets[at] = (uint16_t)batch->used;
+    batch->sizes[at] = size;
+
+    memcpy(batch->paths + batch->used, path, len);
+    batch->used += len;
+    ++batch->count;
+    return RESULT_OK;
+}
+
+static result_t handle_entry(scan_worker_t *worker, const char *parent, const ignore_t *ignore, const char *name,
+                             char *path, entry_kind_t kind) {
+    if (name[0] == '.') {
+        // '.' and '..' aren't real entries, so they don't count as skipped
+        if (name[1] != '\0' && (name[1] != '.' || name[2] != '\0')) {
+            ++worker->scanner.stats.skipped[SKIP_HIDDEN];
+        }
+        return RESULT_OK;
+    }
+
+    if (is_blacklisted(name)) {
+        ++worker->scanner.stats.skipped[SKIP_BLACKLISTED];
         return RESULT_OK;
     }
 
@@ -222,8 +640,10 @@ static result_t handle_entry(scan_worker_t *worker, const char *parent, const ch
     // only classify via stat_path() when the directory listing couldn't
     // (e.g. DT_UNKNOWN filesystems, or links: stat_path is lstat on POSIX,
     // so links classify as neither dir nor file and are skipped)
+    struct stat st;
+    bool stated = false;
     if (kind == ENTRY_UNKNOWN) {
-        struct stat st;
+        stated = true;
         if (stat_path(path, &st) != 0) {
             return operation_error("Cannot locate '%s': %s\n", path, strerror(errno));
         }
@@ -233,20 +653,41 @@ static result_t handle_entry(scan_worker_t *worker, const char *parent, const ch
         } else if (S_ISREG(st.st_mode)) {
             kind = ENTRY_FILE;
         } else {
+            ++worker->scanner.stats.skipped[SKIP_SPECIAL];
             return RESULT_OK;
         }
     }
 
+    // ignored directories are pruned here, before they're ever queued
+    if (is_ignored(ignore, path, name, kind == ENTRY_DIR)) {
+        ++worker->scanner.stats.skipped[SKIP_IGNORED];
+        return RESULT_OK;
+    }
+
     if (kind == ENTRY_DIR) {
-        queue_dir(worker->ctx, path);
+        queue_dir(worker->ctx, &worker->trace, path, ignore);
         return RESULT_OK;
     }
 
-    return scan_file(worker->ctx->args, worker, path, name);
+    if (get_file_accessors(&worker->ctx->args->scan_exts, name) == NULL) {
+        ++worker->scanner.stats.skipped[SKIP_EXTENSION];
+        return RESULT_OK;
+    }
+
+    // a file that can't be stat'd here is left for scan_file to report
+    size_t size = 0;
+    if (worker->ctx->args->scan_schedule == SCAN_SCHEDULE_LARGEST_FIRST &&
+        (stated || stat_path(path, &st) == 0)) {
+        size = (size_t)st.st_size;
+    }
+
+    return batch_file(worker, path, size);
 }
 
-static result_t process_dir(scan_worker_t *worker, const char *path, char *scratch) {
+static result_t process_dir(scan_worker_t *worker, const queued_dir_t *queued, char *scratch) {
     result_t result = RESULT_OK;
+    const char *path = queued->path;
+    const ignore_t *ignore = load_ignore(&worker->arena, queued->ignore, path);
 
 #if defined(_WIN32) && defined(_MSC_VER)
     int n = snprintf(scratch, PATH_MAX, "%s" PATH_SEP "*", path);
@@ -269,7 +710,7 @@ static result_t process_dir(scan_worker_t *worker, const char *path, char *scrat
 
         entry_kind_t kind = (fd.dwFileAttributes & FILE_ATTRIBUTE_DIRECTORY) ? ENTRY_DIR : ENTRY_FILE;
 
-        result = handle_entry(worker, path, fd.cFileName, scratch, kind);
+        result = handle_entry(worker, path, ignore, fd.cFileName, scratch, kind);
         if (!result.ok) {
             break;
         }
@@ -299,7 +740,7 @@ static result_t process_dir(scan_worker_t *worker, const char *path, char *scrat
         }
 #endif
 
-        result = handle_entry(worker, path, entry->d_name, scratch, kind);
+        result = handle_entry(worker, path, ignore, entry->d_name, scratch, kind);
         if (!result.ok) {
             break;
         }
@@ -308,38 +749,181 @@ static result_t process_dir(scan_worker_t *worker, const char *path, char *scrat
     closedir(dir);
 #endif
 
+    // the last few candidates stay with the walker rather than making a batch of their own,
+    // unless they're to be scanned largest-first along with every other batch
+    if (result.ok && worker->ctx->args->scan_schedule == SCAN_SCHEDULE_LARGEST_FIRST && worker->batch->count > 0) {
+        result = submit_batch(worker);
+    } else if (result.ok) {
+        result = scan_batch(worker, worker->batch);
+    }
+    worker->batch->count = 0;
+    worker->batch->used = 0;
+
     return result;
 }
 
-// worker loop: pop a directory, process it, repeat. Exits when a failure is
-// flagged or when the queue is empty with no directories still in flight
+// a listed scan has no directories to walk: each worker claims the next batch of candidates
+// until none are left
+static void scan_listed_files(scan_worker_t *worker, bool timed) {
+    walk_ctx_t *ctx = worker->ctx;
+    worker_stats_t *totals = &worker->scanner.stats.totals;
+
+    for (;;) {
+        trace_mutex_lock(&worker->trace, &ctx->lock);
+        size_t begin = ctx->next_file;
+        size_t end = ctx->file_count - begin > FILE_BATCH_FILES ? begin + FILE_BATCH_FILES : ctx->file_count;
+        ctx->next_file = end;
+        bool done = ctx->failed || begin == end;
+        if (!done) {
+            // keeps the workers that run out of candidates around to help with large files
+            ++ctx->pending;
+            spawn_worker_on_demand(ctx);
+        }
+        mutex_unlock(&ctx->lock);
+
+        if (done) {
+            return;
+        }
+
+        double busy_start = timed ? monotonic_seconds() : 0;
+
+        result_t result = RESULT_OK;
+        for (size_t i = begin; i < end && result.ok; ++i) {
+            result = scan_file(ctx->args, worker, ctx->files[i], path_basename(ctx->files[i]));
+        }
+
+        if (timed) {
+            double now = monotonic_seconds();
+            totals->busy += now - busy_start;
+            trace_span(&worker->trace, "scan_batch", NULL, busy_start, now);
+        }
+
+        trace_mutex_lock(&worker->trace, &ctx->lock);
+        if (!result.ok && !ctx->failed) {
+            ctx->failed = true;
+            ctx->result = result;
+        }
+        --ctx->pending;
+        if (ctx->pending == 0 || ctx->failed) {
+            cond_broadcast(&ctx->work_ready);
+        }
+        bool failed = ctx->failed;
+        mutex_unlock(&ctx->lock);
+
+        if (failed) {
+            return;
+        }
+    }
+}
+
+// worker loop: help match a large file's chunks, else pop a file batch (or a directory when
+// there's none), process it, repeat. Batches go before directories, so the candidates already
+// found are scanned before the walk finds more.
+// Exits when a failure is flagged or when both queues are empty with nothing still in flight
 static thread_ret_t THREAD_CALL scan_worker(void *arg) {
     scan_worker_t *worker = arg;
     walk_ctx_t *ctx = worker->ctx;
 
     char *scratch = arena_alloc(&worker->arena, PATH_MAX);
+    worker->batch = arena_alloc(&worker->arena, sizeof(*worker->batch));
+    worker->batch->count = 0;
+    worker->batch->used = 0;
+
+    char thread_name[32];
+    snprintf(thread_name, sizeof(thread_name), "scan worker %u", worker->id);
+    trace_ring_init(&worker->trace, ctx->trace, worker->id + 1, thread_name);
+
+    bool timed = ctx->args->stats != STATS_OFF || trace_enabled(&worker->trace);
+    worker_stats_t *totals = &worker->scanner.stats.totals;
+
+    // perf counters only follow the thread that opened them, so every worker counts itself
+    perf_group_t perf = {0};
+    perf_counts_t perf_start = {0};
+    bool counting = ctx->args->stats != STATS_OFF && perf_group_open(&perf) && perf_group_read(&perf, &perf_start);
+
+    if (ctx->files != NULL) {
+        scan_listed_files(worker, timed);
+    }
 
     for (;;) {
-        mutex_lock(&ctx->lock);
-        while (ctx->dirs.count == 0 && ctx->pending > 0 && !ctx->failed) {
+        double wait_start = timed ? monotonic_seconds() : 0;
+
+        trace_mutex_lock(&worker->trace, &ctx->lock);
+        while (ctx->jobs == NULL && ctx->batches == NULL && ctx->dirs.count == 0 && ctx->pending > 0 &&
+               !ctx->failed) {
+            ++ctx->waiting;
             cond_wait(&ctx->work_ready, &ctx->lock);
+            --ctx->waiting;
         }
 
-        if (ctx->failed || ctx->dirs.count == 0) {
+        // a worker is waiting on these chunks, so they go before any new work
+        if (ctx->jobs != NULL) {
+            double busy_start = timed ? monotonic_seconds() : 0;
+            match_next_chunk(ctx, &worker->trace, ctx->jobs);
             mutex_unlock(&ctx->lock);
+            if (timed) {
+                double now = monotonic_seconds();
+                totals->idle += busy_start - wait_start;
+                totals->busy += now - busy_start;
+                trace_span(&worker->trace, "match_chunk", NULL, busy_start, now);
+            }
+            continue;
+        }
+
+        if (ctx->failed || (ctx->batches == NULL && ctx->dirs.count == 0)) {
+            mutex_unlock(&ctx->lock);
+            if (timed) {
+                double now = monotonic_seconds();
+                totals->idle += now - wait_start;
+                trace_span(&worker->trace, "queue_wait", NULL, wait_start, now);
+            }
             break;
         }
 
-        char *dir = ctx->dirs.items[--ctx->dirs.count];
+        // largest-first expands every directory it can before scanning files, so the walk
+        // fans out across the workers early and the batch queue ranks more of the tree
+        bool dirs_first = ctx->args->scan_schedule == SCAN_SCHEDULE_LARGEST_FIRST;
+        file_batch_t *batch = dirs_first && ctx->dirs.count > 0 ? NULL : ctx->batches;
+        queued_dir_t dir = {0};
+        if (batch != NULL) {
+            ctx->batches = batch->next;
+            --ctx->batch_count;
+        } else {
+            dir = ctx->dirs.items[--ctx->dirs.count];
+        }
         mutex_unlock(&ctx->lock);
 
-        result_t result = process_dir(worker, dir, scratch);
+        if (batch == NULL && ctx->before_dir != NULL) {
+            ctx->before_dir(ctx->hook_data, dir.path);
+        }
+
+        double busy_start = timed ? monotonic_seconds() : 0;
+        if (timed) {
+            totals->idle += busy_start - wait_start;
+            trace_span(&worker->trace, "queue_wait", NULL, wait_start, busy_start);
+        }
 
-        mutex_lock(&ctx->lock);
+        result_t result = batch != NULL ? scan_batch(worker, batch) : process_dir(worker, &dir, scratch);
+
+        if (timed) {
+            double now = monotonic_seconds();
+            totals->busy += now - busy_start;
+            if (batch != NULL) {
+                trace_span(&worker->trace, "scan_batch", NULL, busy_start, now);
+            } else {
+                trace_span(&worker->trace, "process_dir", dir.path, busy_start, now);
+            }
+        }
+
+        trace_mutex_lock(&worker->trace, &ctx->lock);
         if (!result.ok && !ctx->failed) {
             ctx->failed = true;
             ctx->result = result;
         }
+        if (batch != NULL) {
+            batch->next = ctx->free_batches;
+            ctx->free_batches = batch;
+        }
         --ctx->pending;
         if (ctx->pending == 0 || ctx->failed) {
             cond_broadcast(&ctx->work_ready);
@@ -347,6 +931,14 @@ static thread_ret_t THREAD_CALL scan_worker(void *arg) {
         mutex_unlock(&ctx->lock);
     }
 
+    perf_counts_t perf_end;
+    if (counting && perf_group_read(&perf, &perf_end)) {
+        totals->perf = perf_counts_sub(&perf_end, &perf_start);
+    }
+    perf_group_close(&perf);
+
+    trace_ring_finish(&worker->trace);
+
     return 0;
 }
 
@@ -355,6 +947,15 @@ static void merge_worker_scanner(arena_t *main_arena, scanner_t *dst, scanner_t
     dst->files_scanned += src->files_scanned;
     dst->references += src->references;
 
+    src->stats.totals.dirs = src->dirs_scanned;
+    src->stats.totals.files = src->files_scanned;
+    dst->workers[dst->worker_count++] = src->stats.totals;
+    stats_merge(main_arena, &dst->stats, &src->stats);
+
+    // the merged set reports every probe run against a scan key set, worker or merged
+    dst->key_probes.lookups += src->key_probes.lookups;
+    dst->key_probes.probes += src->key_probes.probes;
+
     for (size_t i = 0; i < src->env_keys.capacity; ++i) {
         const hashset_entry_t *entry = &src->env_keys.items[i];
         if (entry->key == NULL || hashset_contains(&dst->env_keys, entry->key, entry->len)) {
@@ -397,50 +998,241 @@ void merge_required_envs(arena_t *main_arena, args_t *args, const scanner_t *sca
     report_required_keys(args);
 }
 
+// The walk never enters dot or blacklisted entries, so neither does a listed scan
+static bool skip_listed_path(scan_stats_t *stats, const char *path) {
+    char name[PATH_MAX];
+    while (*path != '\0') {
+        size_t len = 0;
+        while (path[len] != '\0' && !is_path_sep(path[len])) {
+            ++len;
+        }
+
+        if (len > 0 && len < sizeof(name)) {
+            memcpy(name, path, len);
+            name[len] = '\0';
+
+            if (name[0] == DOT && !(len == 1 || (len == 2 && name[1] == DOT))) {
+                ++stats->skipped[SKIP_HIDDEN];
+                return true;
+            }
+
+            if (is_blacklisted(name)) {
+                ++stats->skipped[SKIP_BLACKLISTED];
+                return true;
+            }
+        }
+
+        path += len;
+        while (is_path_sep(*path)) {
+            ++path;
+        }
+    }
+
+    return false;
+}
+
+// Lists the tracked files with a scanned extension as the scan's candidates
+static result_t list_git_index(arena_t *main_arena, const args_t *args, scanner_t *scanner, walk_ctx_t *ctx) {
+    git_paths_t paths = {0};
+    result_t result = read_git_index(main_arena, &paths);
+    if (!result.ok) {
+        return result;
+    }
+
+    size_t count = 0;
+    for (size_t i = 0; i < paths.count; ++i) {
+        const char *path = paths.items[i];
+        if (get_file_accessors(&args->scan_exts, path_basename(path)) == NULL) {
+            ++scanner->stats.skipped[SKIP_EXTENSION];
+            continue;
+        }
+
+        if (!skip_listed_path(&scanner->stats, path)) {
+            paths.items[count++] = path;
+        }
+    }
+
+    ctx->files = paths.items;
+    ctx->file_count = count;
+    return RESULT_OK;
+}
+
+// Lists the paths of --scan-from with a scanned extension as the scan's candidates. The list
+// is split on NULs when it has any (eg. `git ls-files -z`, `fd -0`), otherwise on newlines.
+static result_t list_scan_from(arena_t *main_arena, const args_t *args, scanner_t *scanner, walk_ctx_t *ctx) {
+    bool from_stdin = strcmp(args->scan_from, "-") == 0;
+    char *data;
+    size_t len;
+    if (!(from_stdin ? read_stream(main_arena, stdin, &data, &len)
+                     : read_whole_file(main_arena, args->scan_from, &data, &len))) {
+        return operation_error("Unable to read the files to scan from '%s'.\n", from_stdin ? "stdin" : args->scan_from);
+    }
+
+    char delimiter = memchr(data, '\0', len) != NULL ? '\0' : LINE_DELIMITER;
+    dir_list_t paths = {0};
+
+    char *end = data + len;
+    for (char *path = data; path < end;) {
+        char *next = memchr(path, delimiter, (size_t)(end - path));
+        if (next == NULL) {
+            next = end;
+        }
+
+        *next = '\0';
+        if (delimiter == LINE_DELIMITER && next > path && next[-1] == CARRIAGE_RETURN) {
+            next[-1] = '\0';
+        }
+
+        if (path[0] != '\0') {
+            if (get_file_accessors(&args->scan_exts, path_basename(path)) != NULL) {
+                DYN_ARR_APPEND(main_arena, &paths, path);
+            } else {
+                ++scanner->stats.skipped[SKIP_EXTENSION];
+            }
+        }
+
+        path = next + 1;
+    }
+
+    ctx->files = paths.items;
+    ctx->file_count = paths.count;
+    return RESULT_OK;
+}
+
+typedef struct {
+    const char *path;
+    size_t size;
+} sized_path_t;
+
+static int compare_larger_first(const void *a, const void *b) {
+    size_t x = ((const sized_path_t *)a)->size;
+    size_t y = ((const sized_path_t *)b)->size;
+    return (x < y) - (x > y);
+}
+
+// Orders a listed scan's candidates largest first; one that can't be stat'd goes last and is
+// left for scan_file to report
+static void order_listed_by_size(arena_t *main_arena, walk_ctx_t *ctx) {
+    if (ctx->file_count < 2) {
+        return;
+    }
+
+    sized_path_t *sized = arena_alloc(main_arena, ctx->file_count * sizeof(*sized));
+    for (size_t i = 0; i < ctx->file_count; ++i) {
+        struct stat st;
+        size_t size = stat_path(ctx->files[i], &st) == 0 ? (size_t)st.st_size : 0;
+        sized[i] = (sized_path_t){.path = ctx->files[i], .size = size};
+    }
+
+    qsort(sized, ctx->file_count, sizeof(*sized), compare_larger_first);
+    for (size_t i = 0; i < ctx->file_count; ++i) {
+        ctx->files[i] = sized[i].path;
+    }
+}
+
 result_t run_scanner(arena_t *main_arena, args_t *args, scanner_t *scanner) {
     scanner->scan_exts = &args->scan_exts;
 
     report_scan_start(args);
 
-    walk_ctx_t ctx = {.args = args, .result = RESULT_OK};
+    walk_ctx_t ctx = {.args = args,
+                      .result = RESULT_OK,
+                      .trace = scanner->trace,
+                      .before_dir = scanner->before_dir,
+                      .hook_data = scanner->hook_data};
     mutex_init(&ctx.lock);
     cond_init(&ctx.work_ready);
+    cond_init(&ctx.chunks_done);
+    cond_init(&ctx.memory_freed);
 
-    queue_dir(&ctx, ".");
+    if (args->scan_from != NULL || args->scan_source == SCAN_SOURCE_GIT_INDEX) {
+        result_t result = args->scan_from != NULL ? list_scan_from(main_arena, args, scanner, &ctx)
+                                                  : list_git_index(main_arena, args, scanner, &ctx);
+        if (!result.ok) {
+            cond_destroy(&ctx.memory_freed);
+            cond_destroy(&ctx.chunks_done);
+            cond_destroy(&ctx.work_ready);
+            mutex_destroy(&ctx.lock);
+            return result;
+        }
+
+        if (args->scan_schedule == SCAN_SCHEDULE_LARGEST_FIRST) {
+            order_listed_by_size(main_arena, &ctx);
+        }
+    } else {
+        queue_dir(&ctx, NULL, ".", NULL);
+    }
 
     uint8_t nthreads = args->scan_threads;
+    ctx.max_batches = (size_t)nthreads * FILE_BATCHES_PER_WORKER;
+    // a lone worker only ever holds one file
+    ctx.memory_budget = nthreads > 1 ? args->scan_memory : 0;
     scan_worker_t *workers = arena_alloc_zeroed(main_arena, nthreads * sizeof(*workers));
 
     for (uint8_t i = 0; i < nthreads; ++i) {
         workers[i].ctx = &ctx;
+        workers[i].id = i;
         workers[i].scanner.scan_exts = &args->scan_exts;
+        if (args->stats != STATS_OFF) {
+            workers[i].scanner.env_keys.counts = &workers[i].scanner.key_probes;
+        }
         workers[i].report.arena = &workers[i].arena;
     }
 
-    uint8_t spawned = 0;
-    while (spawned < nthreads) {
-        if (thread_create(&workers[spawned].thread, scan_worker, &workers[spawned]) != 0) {
-            break;
-        }
-        ++spawned;
-    }
+    ctx.workers = workers;
+    ctx.max_workers = nthreads;
 
-    if (spawned == 0) {
+    if (args->scan_threads_auto) {
+        // this thread is the first worker; the rest start as the queues grow
+        ctx.spawn_on_demand = true;
+        ctx.started = 1;
         scan_worker(&workers[0]);
-    } else {
-        for (uint8_t i = 0; i < spawned; ++i) {
+
+        // nothing can be queued once the first worker is done, except by the workers still
+        // running, so every worker started is joined by the time this sees no new ones
+        for (uint8_t i = 1;; ++i) {
+            mutex_lock(&ctx.lock);
+            uint8_t started = ctx.started;
+            mutex_unlock(&ctx.lock);
+            if (i >= started) {
+                break;
+            }
             thread_join(workers[i].thread);
         }
+    } else {
+        uint8_t spawned = 0;
+        while (spawned < nthreads) {
+            if (thread_create(&workers[spawned].thread, scan_worker, &workers[spawned]) != 0) {
+                break;
+            }
+            ++spawned;
+        }
+
+        if (spawned == 0) {
+            scan_worker(&workers[0]);
+        } else {
+            for (uint8_t i = 0; i < spawned; ++i) {
+                thread_join(workers[i].thread);
+            }
+        }
+        ctx.started = spawned == 0 ? 1 : spawned;
     }
 
-    for (uint8_t i = 0; i < nthreads; ++i) {
+    scanner->workers = arena_alloc_zeroed(main_arena, nthreads * sizeof(*scanner->workers));
+    scanner->worker_count = 0;
+
+    for (uint8_t i = 0; i < ctx.started; ++i) {
         merge_worker_scanner(main_arena, scanner, &workers[i].scanner);
+    }
+    for (uint8_t i = 0; i < nthreads; ++i) {
         arena_free(&workers[i].scratch);
         arena_free(&workers[i].arena);
     }
 
     arena_free(&ctx.arena);
 
+    cond_destroy(&ctx.memory_freed);
+    cond_destroy(&ctx.chunks_done);
     cond_destroy(&ctx.work_ready);
     mutex_destroy(&ctx.lock);
 
@@ -5,18 +5,35 @@
 #include "arena.h"
 #include "arg.h"
 #include "hashset.h"
+#include "stats.h"
+#include "trace.h"
 
 // The scanner is strictly responsible for recursively walking through the CWD for files
 // containing ENV keys and marking them as required. The goal for scanner is to
 // allow an engineer to jump into the codebase knowing that ENVs are at least defined
 // before a command is ran.
 
+typedef struct {
+    const char **items;
+    size_t count;
+    size_t capacity;
+} dir_list_t;
+
+typedef void (*dir_hook_t)(void *data, const char *path);
+
 typedef struct {
     size_t dirs_scanned;
     size_t files_scanned;
     size_t references;
     hashset_t env_keys;
+    probe_counts_t key_probes; // env_keys' probes, counted only with --stats
     const file_ext_map_t *scan_exts;
+    scan_stats_t stats;       // filled in only with --stats
+    worker_stats_t *workers;  // per worker, merged into stats.totals
+    size_t worker_count;
+    trace_t *trace;           // set by the caller for --trace; NULL records nothing
+    dir_hook_t before_dir;    // set by the caller to see each walked directory before it's read; runs on any worker
+    void *hook_data;
 } scanner_t;
 
 result_t run_scanner(arena_t *arena, args_t *args, scanner_t *scanner);
@@ -0,0 +1,35 @@
+#ifndef SCHEDULE_H
+#define SCHEDULE_H
+#include <string.h>
+
+// The order a multi-threaded scan hands out work: as the walk finds it, or every directory
+// first (so the walk fans out early) and then the largest files first (so a huge file found
+// late doesn't run on alone after the rest are done)
+typedef enum { SCAN_SCHEDULE_WALK, SCAN_SCHEDULE_LARGEST_FIRST, SCAN_SCHEDULE_UNKNOWN } scan_schedule_t;
+
+static inline const char *get_scan_schedule_name(const scan_schedule_t s) {
+    switch (s) {
+        case SCAN_SCHEDULE_WALK: {
+            return "walk";
+        }
+        case SCAN_SCHEDULE_LARGEST_FIRST: {
+            return "largest-first";
+        }
+        default:
+            return "unknown";
+    }
+}
+
+static inline scan_schedule_t get_scan_schedule(const char *arg) {
+    if (strcmp(arg, "walk") == 0) {
+        return SCAN_SCHEDULE_WALK;
+    }
+
+    if (strcmp(arg, "largest-first") == 0) {
+        return SCAN_SCHEDULE_LARGEST_FIRST;
+    }
+
+    return SCAN_SCHEDULE_UNKNOWN;
+}
+
+#endif // SCHEDULE_H
@@ -0,0 +1,1063 @@
+#if defined(__linux__)
+#define _GNU_SOURCE // struct ucred for SO_PEERCRED
+#endif
+
+#include "serve.h"
+#include "arena.h"
+#include "buf.h"
+#include "dynarr.h"
+#include "errors.h"
+#include "file.h"
+#include "log.h"
+#include "nthread.h"
+#include "parser.h"
+#include "program.h"
+#include "scanner.h"
+#include "tokenizer.h"
+#include "tty.h"
+#include <errno.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#if defined(_WIN32) && defined(_MSC_VER)
+
+result_t run_server(int argc, const char **argv, serve_handler_t handler) {
+    (void)argc;
+    (void)argv;
+    (void)handler;
+    return operation_error("The 'serve' command is not supported on Windows.\n");
+}
+
+result_t run_client(int argc, const char **argv) {
+    (void)argc;
+    (void)argv;
+    return operation_error("The '--client' flag is not supported on Windows.\n");
+}
+
+result_t serve_scan(serve_cache_t *cache, arena_t *arena, args_t *args, scanner_t *scanner) {
+    (void)cache;
+    return run_scanner(arena, args, scanner);
+}
+
+result_t serve_tokenize(serve_cache_t *cache, arena_t *arena, const args_t *args, tokenizer_t *tokenizer) {
+    (void)cache;
+    return run_tokenizer(arena, args, tokenizer);
+}
+
+result_t serve_parse(serve_cache_t *cache, arena_t *arena, const args_t *args, const token_list_t *tokens,
+                     parser_t *parser) {
+    (void)cache;
+    return run_parser(arena, args, tokens, parser);
+}
+
+#else
+
+#include <fcntl.h>
+#include <poll.h>
+#include <signal.h>
+#include <sys/socket.h>
+#include <sys/stat.h>
+#include <sys/time.h>
+#include <sys/un.h>
+#include <time.h>
+#include <unistd.h>
+
+#if defined(__linux__)
+#include <sys/inotify.h>
+
+// anything that can change what a scan finds in a directory; reads don't count
+#define WATCH_MASK                                                                                                     \
+    (IN_ATTRIB | IN_CLOSE_WRITE | IN_CREATE | IN_DELETE | IN_DELETE_SELF | IN_MODIFY | IN_MOVE_SELF | IN_MOVED_FROM |  \
+     IN_MOVED_TO)
+#endif
+
+#if defined(MSG_NOSIGNAL)
+#define SEND_FLAGS MSG_NOSIGNAL
+#else
+#define SEND_FLAGS 0
+#endif
+
+extern char **environ;
+
+// first string of every request; bumped whenever the layout changes
+#define REQUEST_MAGIC "nvi-serve-1"
+
+// files modified this recently may still be written to within the same timestamp tick, so
+// they are tokenized but not cached
+#define RACY_WINDOW_SECONDS 2.0
+
+typedef struct {
+    const char *cwd;
+    int argc;
+    const char **argv;
+    char **env; // NULL-terminated, swapped in as the process environment
+} request_t;
+
+static volatile sig_atomic_t stop_requested = 0;
+static volatile sig_atomic_t flush_requested = 0;
+
+static void on_stop(int sig) {
+    (void)sig;
+    stop_requested = 1;
+}
+
+static void on_flush(int sig) {
+    (void)sig;
+    flush_requested = 1;
+}
+
+// ---------------------------------------------------------------------------
+// socket plumbing
+// ---------------------------------------------------------------------------
+
+static const char *socket_path(arena_t *arena) {
+    const char *path = getenv("NVI_SOCKET");
+    if (path != NULL && path[0] != '\0') {
+        return path;
+    }
+
+    const char *runtime_dir = getenv("XDG_RUNTIME_DIR");
+    if (runtime_dir != NULL && runtime_dir[0] != '\0') {
+        return arena_sprintf(arena, "%s/nvi.sock", runtime_dir);
+    }
+
+    return arena_sprintf(arena, "/tmp/nvi-%u.sock", (unsigned)getuid());
+}
+
+static result_t socket_address(const char *path, struct sockaddr_un *addr) {
+    memset(addr, 0, sizeof(*addr));
+    addr->sun_family = AF_UNIX;
+
+    size_t len = strlen(path);
+    if (len >= sizeof(addr->sun_path)) {
+        return operation_error("The socket path '%s' is too long (max: %zu bytes).\n", path,
+                               sizeof(addr->sun_path) - 1);
+    }
+
+    memcpy(addr->sun_path, path, len + 1);
+    return RESULT_OK;
+}
+
+static bool write_exact(int fd, const void *data, size_t len) {
+    const char *p = data;
+    while (len > 0) {
+        ssize_t n = send(fd, p, len, SEND_FLAGS);
+        if (n < 0 && errno == EINTR) {
+            continue;
+        }
+        if (n <= 0) {
+            return false;
+        }
+        p += n;
+        len -= (size_t)n;
+    }
+    return true;
+}
+
+static bool read_exact(int fd, void *data, size_t len) {
+    char *p = data;
+    while (len > 0) {
+        ssize_t n = read(fd, p, len);
+        if (n < 0 && errno == EINTR) {
+            continue;
+        }
+        if (n <= 0) {
+            return false;
+        }
+        p += n;
+        len -= (size_t)n;
+    }
+    return true;
+}
+
+// the ancillary buffer for the client's stdout and stderr, aligned for cmsghdr
+typedef union {
+    struct cmsghdr header;
+    char bytes[CMSG_SPACE(2 * sizeof(int))];
+} fd_control_t;
+
+// sends the payload length with the client's stdout and stderr attached, then the payload
+static bool send_request(int fd, const buf_t *payload) {
+    uint32_t len = (uint32_t)payload->count;
+    int fds[2] = {STDOUT_FILENO, STDERR_FILENO};
+
+    fd_control_t control;
+    memset(&control, 0, sizeof(control));
+    struct iovec iov = {.iov_base = &len, .iov_len = sizeof(len)};
+    struct msghdr msg = {
+        .msg_iov = &iov, .msg_iovlen = 1, .msg_control = control.bytes, .msg_controllen = sizeof(control.bytes)};
+
+    struct cmsghdr *cmsg = CMSG_FIRSTHDR(&msg);
+    cmsg->cmsg_level = SOL_SOCKET;
+    cmsg->cmsg_type = SCM_RIGHTS;
+    cmsg->cmsg_len = CMSG_LEN(sizeof(fds));
+    memcpy(CMSG_DATA(cmsg), fds, sizeof(fds));
+
+    ssize_t n;
+    do {
+        n = sendmsg(fd, &msg, SEND_FLAGS);
+    } while (n < 0 && errno == EINTR);
+
+    return n == (ssize_t)sizeof(len) && write_exact(fd, payload->items, payload->count);
+}
+
+static void close_fds(int *fds, size_t count) {
+    for (size_t i = 0; i < count; ++i) {
+        if (fds[i] >= 0) {
+            close(fds[i]);
+            fds[i] = -1;
+        }
+    }
+}
+
+// reads the payload length and the client's stdout and stderr; every other fd the message
+// carried is closed, and so are those two when the header turns out to be malformed
+static bool receive_header(int fd, uint32_t *len, int fds[2]) {
+    fd_control_t control;
+    memset(&control, 0, sizeof(control));
+    struct iovec iov = {.iov_base = len, .iov_len = sizeof(*len)};
+    struct msghdr msg = {
+        .msg_iov = &iov, .msg_iovlen = 1, .msg_control = control.bytes, .msg_controllen = sizeof(control.bytes)};
+
+    ssize_t n;
+    do {
+        n = recvmsg(fd, &msg, 0);
+    } while (n < 0 && errno == EINTR);
+
+    bool valid = n == (ssize_t)sizeof(*len) && (msg.msg_flags & MSG_CTRUNC) == 0;
+    bool received = false;
+    for (struct cmsghdr *cmsg = n < 0 ? NULL : CMSG_FIRSTHDR(&msg); cmsg != NULL; cmsg = CMSG_NXTHDR(&msg, cmsg)) {
+        if (cmsg->cmsg_level != SOL_SOCKET || cmsg->cmsg_type != SCM_RIGHTS) {
+            continue;
+        }
+
+        int passed[2] = {-1, -1};
+        size_t count = (cmsg->cmsg_len - CMSG_LEN(0)) / sizeof(int);
+        for (size_t i = 0; i < count; ++i) {
+            int passed_fd;
+            memcpy(&passed_fd, CMSG_DATA(cmsg) + i * sizeof(int), sizeof(int));
+            if (count == 2 && !received) {
+                passed[i] = passed_fd;
+            } else {
+                close(passed_fd);
+            }
+        }
+
+        if (count == 2 && !received) {
+            memcpy(fds, passed, sizeof(passed));
+            received = true;
+        } else {
+            valid = false;
+        }
+    }
+
+    if (!valid || !received) {
+        close_fds(fds, 2);
+        return false;
+    }
+
+    return true;
+}
+
+static bool peer_is_same_user(int fd) {
+#if defined(__linux__)
+    struct ucred cred;
+    socklen_t len = sizeof(cred);
+    return getsockopt(fd, SOL_SOCKET, SO_PEERCRED, &cred, &len) == 0 && cred.uid == getuid();
+#else
+    uid_t uid;
+    gid_t gid;
+    return getpeereid(fd, &uid, &gid) == 0 && uid == getuid();
+#endif
+}
+
+// ---------------------------------------------------------------------------
+// client
+// ---------------------------------------------------------------------------
+
+static void append_string(buf_t *payload, const char *s) {
+    DYN_ARR_APPEND_MANY(payload->arena, payload, s, strlen(s) + 1);
+}
+
+result_t run_client(int argc, const char **argv) {
+    arena_t arena = {0};
+    result_t result = RESULT_OK;
+    int fd = -1;
+
+    char cwd[PATH_MAX];
+    if (getcwd(cwd, sizeof(cwd)) == NULL) {
+        result = operation_error("Unable to determine the current directory: %s\n", strerror(errno));
+        goto done;
+    }
+
+    // magic, cwd, argc, argv (without --client), then the environment
+    buf_t payload = {.arena = &arena};
+    append_string(&payload, REQUEST_MAGIC);
+    append_string(&payload, cwd);
+    append_string(&payload, arena_sprintf(&arena, "%d", argc - 1));
+    append_string(&payload, argv[0]);
+    for (int i = 2; i < argc; ++i) {
+        append_string(&payload, argv[i]);
+    }
+    for (char **env = environ; *env != NULL; ++env) {
+        append_string(&payload, *env);
+    }
+
+    if (payload.count > SERVE_MAX_REQUEST) {
+        result = operation_error("The request exceeds %zu bytes; run nvi without '--client'.\n",
+                                 (size_t)SERVE_MAX_REQUEST);
+        goto done;
+    }
+
+    const char *path = socket_path(&arena);
+    struct sockaddr_un addr;
+    result = socket_address(path, &addr);
+    if (!result.ok) {
+        goto done;
+    }
+
+    fd = socket(AF_UNIX, SOCK_STREAM, 0);
+    if (fd < 0 || connect(fd, (const struct sockaddr *)&addr, sizeof(addr)) != 0) {
+        result = operation_error("Unable to connect to the nvi server at '%s': %s (is 'nvi serve' running?)\n", path,
+                                 strerror(errno));
+        goto done;
+    }
+
+    int32_t code = 0;
+    if (!send_request(fd, &payload) || !read_exact(fd, &code, sizeof(code))) {
+        result = operation_error("The nvi server at '%s' closed the connection before replying.\n", path);
+        goto done;
+    }
+
+    result = (result_t){.ok = code == 0, .code = code};
+
+done:
+    if (fd >= 0) {
+        close(fd);
+    }
+    arena_free(&arena);
+    return result;
+}
+
+// ---------------------------------------------------------------------------
+// cache
+// ---------------------------------------------------------------------------
+
+static double wall_seconds(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_REALTIME, &ts);
+    return (double)ts.tv_sec + (double)ts.tv_nsec / 1e9;
+}
+
+static bool cacheable(const serve_cache_t *cache, const args_t *args) {
+    return cache != NULL && !args->dry_run && args->stats == STATS_OFF && args->trace_path == NULL;
+}
+
+static bool racily_clean(const serve_cache_t *cache, const file_identity_t *id) {
+    int64_t changed = id->mtime_sec > id->ctime_sec ? id->mtime_sec : id->ctime_sec;
+    return (double)changed + 1.0 + RACY_WINDOW_SECONDS > cache->request_start;
+}
+
+static void evict_file(serve_cache_t *cache, size_t i) {
+    arena_free(&cache->files[i].arena);
+    cache->files[i] = cache->files[--cache->file_count];
+    memset(&cache->files[cache->file_count], 0, sizeof(cache->files[0]));
+}
+
+#if defined(__linux__)
+#define WATCH_REFS_INIT_CAP 64
+
+static size_t watch_slot(const watch_refs_t *refs, int wd) {
+    return ((uint32_t)wd * 2654435761u) & (refs->capacity - 1);
+}
+
+// Probes for wd. Returns the index of its entry if held, otherwise the empty slot it would take.
+static size_t watch_refs_probe(const watch_refs_t *refs, int wd) {
+    size_t mask = refs->capacity - 1;
+    size_t i = watch_slot(refs, wd);
+    while (refs->refs[i] != 0 && refs->wds[i] != wd) {
+        i = (i + 1) & mask;
+    }
+    return i;
+}
+
+// rehashes into a fresh arena and frees the old one, so the table never holds more than its
+// current arrays however many watches came and went
+static void watch_refs_grow(watch_refs_t *refs) {
+    // load factor capped at 0.7, as in hashset.c
+    if (refs->capacity > 0 && (refs->count + 1) * 10 <= refs->capacity * 7) {
+        return;
+    }
+
+    watch_refs_t grown = {.count = refs->count};
+    grown.capacity = refs->capacity == 0 ? WATCH_REFS_INIT_CAP : refs->capacity * 2;
+    grown.wds = arena_alloc(&grown.arena, grown.capacity * sizeof(*grown.wds));
+    grown.refs = arena_alloc_zeroed(&grown.arena, grown.capacity * sizeof(*grown.refs));
+
+    for (size_t i = 0; i < refs->capacity; ++i) {
+        if (refs->refs[i] != 0) {
+            size_t j = watch_refs_probe(&grown, refs->wds[i]);
+            grown.wds[j] = refs->wds[i];
+            grown.refs[j] = refs->refs[i];
+        }
+    }
+
+    arena_free(&refs->arena);
+    *refs = grown;
+}
+
+// empties slot i, shifting back the entries after it that probed past it so every lookup
+// still finds its entry without tombstones
+static void watch_refs_remove(watch_refs_t *refs, size_t i) {
+    size_t mask = refs->capacity - 1;
+    for (size_t j = (i + 1) & mask; refs->refs[j] != 0; j = (j + 1) & mask) {
+        // j may move into the hole when the hole lies between its home slot and j
+        if (((j - watch_slot(refs, refs->wds[j])) & mask) >= ((j - i) & mask)) {
+            refs->wds[i] = refs->wds[j];
+            refs->refs[i] = refs->refs[j];
+            i = j;
+        }
+    }
+    refs->refs[i] = 0;
+    --refs->count;
+}
+
+static void hold_watches(serve_cache_t *cache, const int *wds, size_t count) {
+    for (size_t w = 0; w < count; ++w) {
+        watch_refs_grow(&cache->watch_refs);
+        size_t i = watch_refs_probe(&cache->watch_refs, wds[w]);
+        if (cache->watch_refs.refs[i] == 0) {
+            cache->watch_refs.wds[i] = wds[w];
+            ++cache->watch_refs.count;
+        }
+        ++cache->watch_refs.refs[i];
+    }
+}
+
+// drops one hold on each watch, removing the watches no cached scan holds anymore; one the
+// kernel already dropped (its directory was deleted) fails with EINVAL, which changes nothing
+static void release_watches(serve_cache_t *cache, const int *wds, size_t count) {
+    watch_refs_t *refs = &cache->watch_refs;
+    for (size_t w = 0; w < count; ++w) {
+        size_t i = watch_refs_probe(refs, wds[w]);
+        if (refs->refs[i] > 1) {
+            --refs->refs[i];
+            continue;
+        }
+
+        watch_refs_remove(refs, i);
+        inotify_rm_watch(cache->inotify_fd, wds[w]);
+    }
+}
+
+// removes the watches a walk added that no cached scan holds, for a walk that wasn't cached
+static void drop_unheld_watches(serve_cache_t *cache, const int *wds, size_t count) {
+    const watch_refs_t *refs = &cache->watch_refs;
+    for (size_t w = 0; w < count; ++w) {
+        if (refs->capacity == 0 || refs->refs[watch_refs_probe(refs, wds[w])] == 0) {
+            inotify_rm_watch(cache->inotify_fd, wds[w]);
+        }
+    }
+}
+#endif
+
+static void evict_scan(serve_cache_t *cache, size_t i) {
+#if defined(__linux__)
+    release_watches(cache, cache->scans[i].watches, cache->scans[i].watch_count);
+#endif
+    arena_free(&cache->scans[i].arena);
+    cache->scans[i] = cache->scans[--cache->scan_count];
+    memset(&cache->scans[cache->scan_count], 0, sizeof(cache->scans[0]));
+}
+
+static void evict_program(serve_cache_t *cache, size_t i) {
+    arena_free(&cache->programs[i].arena);
+    cache->programs[i] = cache->programs[--cache->program_count];
+    memset(&cache->programs[cache->program_count], 0, sizeof(cache->programs[0]));
+}
+
+static void clear_cache(serve_cache_t *cache) {
+    while (cache->file_count > 0) {
+        evict_file(cache, cache->file_count - 1);
+    }
+    while (cache->scan_count > 0) {
+        evict_scan(cache, cache->scan_count - 1);
+    }
+    while (cache->program_count > 0) {
+        evict_program(cache, cache->program_count - 1);
+    }
+}
+
+// drops every scan that walked a directory inotify reported a change in
+static void drain_watches(serve_cache_t *cache) {
+#if defined(__linux__)
+    if (cache->inotify_fd < 0) {
+        return;
+    }
+
+    union {
+        struct inotify_event event;
+        char bytes[16 * 1024];
+    } events;
+
+    for (;;) {
+        ssize_t n = read(cache->inotify_fd, events.bytes, sizeof(events.bytes));
+        if (n <= 0) {
+            break;
+        }
+
+        for (ssize_t off = 0; off < n;) {
+            const struct inotify_event *event = (const struct inotify_event *)(events.bytes + off);
+            off += (ssize_t)(sizeof(*event) + event->len);
+
+            for (size_t i = cache->scan_count; i-- > 0;) {
+                const cached_scan_t *scan = &cache->scans[i];
+                bool affected = (event->mask & IN_Q_OVERFLOW) != 0;
+                for (size_t w = 0; !affected && w < scan->watch_count; ++w) {
+                    affected = scan->watches[w] == event->wd;
+                }
+                if (affected) {
+                    evict_scan(cache, i);
+                }
+            }
+        }
+    }
+#else
+    (void)cache;
+#endif
+}
+
+static void unpin_files(serve_cache_t *cache) {
+    for (size_t i = 0; i < cache->file_count; ++i) {
+        cache->files[i].pinned = false;
+    }
+}
+
+static cached_file_t *find_file(serve_cache_t *cache, const char *key, const file_identity_t *id) {
+    for (size_t i = cache->file_count; i-- > 0;) {
+        if (strcmp(cache->files[i].key, key) != 0) {
+            continue;
+        }
+
+        if (same_file_identity(&cache->files[i].id, id)) {
+            return &cache->files[i];
+        }
+
+        // a stale entry this request already took tokens from stays until the request is done
+        if (!cache->files[i].pinned) {
+            evict_file(cache, i);
+        }
+    }
+
+    return NULL;
+}
+
+// tokenizes 'path' into a new cache slot, or returns NULL when it failed (with *result set) or
+// every slot is pinned by this request
+static cached_file_t *cache_file(serve_cache_t *cache, const args_t *args, const char *key, const char *path,
+                                 const file_identity_t *id, result_t *result) {
+    if (cache->file_count == SERVE_MAX_FILES) {
+        size_t victim = 0;
+        while (victim < cache->file_count && cache->files[victim].pinned) {
+            ++victim;
+        }
+        if (victim == cache->file_count) {
+            return NULL;
+        }
+        evict_file(cache, victim);
+    }
+
+    cached_file_t *entry = &cache->files[cache->file_count];
+    memset(entry, 0, sizeof(*entry));
+    entry->key = arena_strdup(&entry->arena, key);
+    entry->path = arena_strdup(&entry->arena, path);
+    entry->id = *id;
+
+    arena_t scratch = {0};
+    tokenizer_t tokenizer = {0};
+    *result = tokenize_file(&entry->arena, &scratch, args, entry->path, &tokenizer);
+    arena_free(&scratch);
+
+    if (!result->ok) {
+        arena_free(&entry->arena);
+        return NULL;
+    }
+
+    entry->tokens = tokenizer.tokens;
+    entry->bytes = tokenizer.bytes_read;
+    entry->serial = ++cache->next_serial;
+    ++cache->file_count;
+    return entry;
+}
+
+result_t serve_tokenize(serve_cache_t *cache, arena_t *arena, const args_t *args, tokenizer_t *tokenizer) {
+    if (!cacheable(cache, args)) {
+        return run_tokenizer(arena, args, tokenizer);
+    }
+
+    // a request tokenizes once, so whatever the last request pinned is free again
+    unpin_files(cache);
+
+    arena_t scratch = {0};
+    result_t result = RESULT_OK;
+    cache->request_serials = arena_alloc(arena, args->files.count * sizeof(*cache->request_serials));
+    cache->request_serial_count = 0;
+    cache->request_cached = true;
+
+    for (size_t fi = 0; fi < args->files.count && result.ok; ++fi) {
+        const char *path = args->files.items[fi];
+
+        // unreadable, special or racily clean files take the uncached path (and its errors)
+        file_identity_t id;
+        if (!get_file_identity(path, &id) || racily_clean(cache, &id)) {
+            cache->request_cached = false;
+            result = tokenize_file(arena, &scratch, args, path, tokenizer);
+            arena_reset(&scratch);
+            continue;
+        }
+
+        const char *key = path[0] == '/' ? path : arena_sprintf(arena, "%s/%s", cache->cwd, path);
+        cached_file_t *entry = find_file(cache, key, &id);
+        if (entry == NULL) {
+            entry = cache_file(cache, args, key, path, &id, &result);
+        }
+
+        if (entry == NULL && result.ok) {
+            cache->request_cached = false;
+            result = tokenize_file(arena, &scratch, args, path, tokenizer);
+            arena_reset(&scratch);
+        } else if (entry != NULL) {
+            // the tokens are shared, not copied, so the entry can't be evicted until the request is done
+            entry->pinned = true;
+            result = token_list_append(arena, &tokenizer->tokens, &entry->tokens);
+            tokenizer->bytes_read += entry->bytes;
+            cache->request_serials[cache->request_serial_count++] = entry->serial;
+        }
+    }
+
+    arena_free(&scratch);
+    return result;
+}
+
+static cached_program_t *find_program(serve_cache_t *cache) {
+    size_t bytes = cache->request_serial_count * sizeof(*cache->request_serials);
+    for (size_t i = 0; i < cache->program_count; ++i) {
+        const cached_program_t *entry = &cache->programs[i];
+        if (entry->serial_count == cache->request_serial_count &&
+            memcmp(entry->serials, cache->request_serials, bytes) == 0) {
+            return &cache->programs[i];
+        }
+    }
+
+    return NULL;
+}
+
+// compiles the request's tokens into a new cache slot, or returns NULL (with *result set)
+static cached_program_t *cache_program(serve_cache_t *cache, const token_list_t *tokens, result_t *result) {
+    // a program whose files were evicted can't match again, so the oldest goes first
+    if (cache->program_count == SERVE_MAX_PROGRAMS) {
+        evict_program(cache, 0);
+    }
+
+    cached_program_t *entry = &cache->programs[cache->program_count];
+    memset(entry, 0, sizeof(*entry));
+    *result = compile_program(&entry->arena, tokens, &entry->program);
+    if (!result->ok) {
+        arena_free(&entry->arena);
+        return NULL;
+    }
+
+    entry->serial_count = cache->request_serial_count;
+    entry->serials =
+        arena_memdup(&entry->arena, cache->request_serials, entry->serial_count * sizeof(*entry->serials));
+    ++cache->program_count;
+    return entry;
+}
+
+result_t serve_parse(serve_cache_t *cache, arena_t *arena, const args_t *args, const token_list_t *tokens,
+                     parser_t *parser) {
+    if (!cacheable(cache, args) || !cache->request_cached) {
+        return run_parser(arena, args, tokens, parser);
+    }
+
+    result_t result = RESULT_OK;
+    cached_program_t *entry = find_program(cache);
+    if (entry == NULL) {
+        entry = cache_program(cache, tokens, &result);
+    }
+
+    return entry != NULL ? run_program(arena, args, &entry->program, parser, NULL, NULL) : result;
+}
+
+static const char *join_exts(arena_t *arena, const file_ext_map_t *exts) {
+    buf_t joined = {.arena = arena};
+    for (size_t i = 0; i < exts->count; ++i) {
+        DYN_ARR_APPEND_MANY(arena, &joined, exts->items[i].ext, strlen(exts->items[i].ext));
+        DYN_ARR_APPEND(arena, &joined, i + 1 < exts->count ? ' ' : '\0');
+    }
+    return exts->count > 0 ? joined.items : "";
+}
+
+#if defined(__linux__)
+// the watches a walk adds, each just before the walk reads its directory, so a change made
+// while the walk is still running evicts the scan once it's cached
+typedef struct {
+    mutex_t lock;
+    int inotify_fd;
+    arena_t arena; // becomes the cached scan's arena
+    struct {
+        int *items;
+        size_t count;
+        size_t capacity;
+    } watches;
+    bool failed; // a directory couldn't be watched (eg. fs.inotify.max_user_watches reached)
+} scan_watches_t;
+
+static void watch_dir(void *data, const char *path) {
+    scan_watches_t *pending = data;
+    int wd = inotify_add_watch(pending->inotify_fd, path, WATCH_MASK);
+
+    mutex_lock(&pending->lock);
+    if (wd < 0) {
+        pending->failed = true;
+    } else {
+        DYN_ARR_APPEND(&pending->arena, &pending->watches, wd);
+    }
+    mutex_unlock(&pending->lock);
+}
+
+// without a watch on every walked directory a change could go unnoticed, so a scan that
+// couldn't be fully watched isn't cached
+static void cache_scan(serve_cache_t *cache, const char *exts, const scanner_t *scanner, scan_watches_t *pending) {
+    if (pending->failed) {
+        drop_unheld_watches(cache, pending->watches.items, pending->watches.count);
+        arena_free(&pending->arena);
+        return;
+    }
+
+    // held before the eviction, so the watches this walk shares with the evicted scan stay
+    hold_watches(cache, pending->watches.items, pending->watches.count);
+    if (cache->scan_count == SERVE_MAX_SCANS) {
+        evict_scan(cache, 0);
+    }
+
+    cached_scan_t *entry = &cache->scans[cache->scan_count];
+    memset(entry, 0, sizeof(*entry));
+    entry->arena = pending->arena;
+    entry->cwd = arena_strdup(&entry->arena, cache->cwd);
+    entry->exts = arena_strdup(&entry->arena, exts);
+    entry->watches = pending->watches.items;
+    entry->watch_count = pending->watches.count;
+
+    for (size_t i = 0; i < scanner->env_keys.capacity; ++i) {
+        const hashset_entry_t *key = &scanner->env_keys.items[i];
+        if (key->key != NULL) {
+            hashset_append(&entry->arena, &entry->env_keys, arena_strndup(&entry->arena, key->key, key->len),
+                           key->len);
+        }
+    }
+
+    ++cache->scan_count;
+}
+#endif
+
+result_t serve_scan(serve_cache_t *cache, arena_t *arena, args_t *args, scanner_t *scanner) {
+    if (args->scan_from != NULL && strcmp(args->scan_from, "-") == 0) {
+        return operation_error("The '--scan-from -' flag reads the server's stdin; pass a file instead.\n");
+    }
+
+    // only a walk watches the directories it reads, so only a walk's keys can be kept
+    if (!cacheable(cache, args) || cache->inotify_fd < 0 || args->scan_source != SCAN_SOURCE_WALK ||
+        args->scan_from != NULL) {
+        return run_scanner(arena, args, scanner);
+    }
+
+    // which kinds of files are sniffed out changes the keys as much as the extensions do
+    const char *exts = arena_sprintf(arena, "%s skip=%u", join_exts(arena, &args->scan_exts), args->scan_skip);
+    for (size_t i = 0; i < cache->scan_count; ++i) {
+        const cached_scan_t *entry = &cache->scans[i];
+        if (strcmp(entry->cwd, cache->cwd) == 0 && strcmp(entry->exts, exts) == 0) {
+            scanner->scan_exts = &args->scan_exts;
+            scanner->env_keys = entry->env_keys;
+            merge_required_envs(arena, args, scanner);
+            return RESULT_OK;
+        }
+    }
+
+#if defined(__linux__)
+    scan_watches_t pending = {.inotify_fd = cache->inotify_fd};
+    mutex_init(&pending.lock);
+    scanner->before_dir = watch_dir;
+    scanner->hook_data = &pending;
+
+    result_t result = run_scanner(arena, args, scanner);
+    scanner->before_dir = NULL;
+    scanner->hook_data = NULL;
+    mutex_destroy(&pending.lock);
+
+    if (result.ok) {
+        cache_scan(cache, exts, scanner, &pending);
+    } else {
+        drop_unheld_watches(cache, pending.watches.items, pending.watches.count);
+        arena_free(&pending.arena);
+    }
+
+    return result;
+#else
+    return run_scanner(arena, args, scanner);
+#endif
+}
+
+// ---------------------------------------------------------------------------
+// server
+// ---------------------------------------------------------------------------
+
+static bool parse_request(arena_t *arena, char *payload, size_t len, request_t *req) {
+    if (len == 0 || payload[len - 1] != '\0') {
+        return false;
+    }
+
+    size_t count = 0;
+    for (size_t i = 0; i < len; ++i) {
+        count += payload[i] == '\0';
+    }
+
+    char **strings = arena_alloc(arena, (count + 1) * sizeof(*strings));
+    char *p = payload;
+    for (size_t i = 0; i < count; ++i) {
+        strings[i] = p;
+        p += strlen(p) + 1;
+    }
+    strings[count] = NULL;
+
+    if (count < 4 || strcmp(strings[0], REQUEST_MAGIC) != 0) {
+        return false;
+    }
+
+    char *end = NULL;
+    long argc = strtol(strings[2], &end, 10);
+    if (*end != '\0' || argc < 1 || (size_t)argc > count - 3) {
+        return false;
+    }
+
+    // argv runs up to the environment, which ends at the NULL after the last string
+    req->cwd = strings[1];
+    req->argc = (int)argc;
+    req->argv = (const char **)(strings + 3);
+    req->env = strings + 3 + argc;
+
+    return true;
+}
+
+// runs the request as if the client's process did: its working directory, environment,
+// stdout and stderr
+static int handle_request(serve_cache_t *cache, const request_t *req, const int fds[2], serve_handler_t handler) {
+    int saved_cwd = open(".", O_RDONLY);
+    fflush(stdout);
+    fflush(stderr);
+    int saved_out = dup(STDOUT_FILENO);
+    int saved_err = dup(STDERR_FILENO);
+    dup2(fds[0], STDOUT_FILENO);
+    dup2(fds[1], STDERR_FILENO);
+    char **saved_env = environ;
+    environ = req->env;
+    tty_init();
+
+    int code = 0;
+    if (chdir(req->cwd) != 0) {
+        code = operation_error("Unable to enter the client's directory '%s': %s\n", req->cwd, strerror(errno)).code;
+    } else {
+        cache->cwd = req->cwd;
+        cache->request_start = wall_seconds();
+        cache->request_cached = false;
+        drain_watches(cache);
+        code = handler(req->argc, req->argv, cache);
+        cache->cwd = NULL;
+    }
+
+    fflush(stdout);
+    fflush(stderr);
+    environ = saved_env;
+    dup2(saved_out, STDOUT_FILENO);
+    dup2(saved_err, STDERR_FILENO);
+    close(saved_out);
+    close(saved_err);
+    if (saved_cwd >= 0) {
+        if (fchdir(saved_cwd) != 0) {
+            log_error(SINK_STDERR, "[ERROR] Unable to return to the server's directory: %s\n", strerror(errno));
+        }
+        close(saved_cwd);
+    }
+    tty_init();
+
+    return code;
+}
+
+static void serve_connection(serve_cache_t *cache, int conn, serve_handler_t handler) {
+    arena_t arena = {0};
+    int fds[2] = {-1, -1};
+    uint32_t len = 0;
+    request_t req;
+
+    // a client that stalls mid-request would otherwise hold up every other client
+    struct timeval timeout = {.tv_sec = SERVE_IO_TIMEOUT_SECONDS};
+    setsockopt(conn, SOL_SOCKET, SO_RCVTIMEO, &timeout, sizeof(timeout));
+    setsockopt(conn, SOL_SOCKET, SO_SNDTIMEO, &timeout, sizeof(timeout));
+
+    if (!peer_is_same_user(conn)) {
+        log_error(SINK_STDERR, "[ERROR] Rejected a connection from another user.\n");
+    } else if (!receive_header(conn, &len, fds) || len == 0 || len > SERVE_MAX_REQUEST) {
+        log_error(SINK_STDERR, "[ERROR] Rejected a malformed request.\n");
+    } else {
+        char *payload = arena_alloc(&arena, len);
+        if (!read_exact(conn, payload, len) || !parse_request(&arena, payload, len, &req)) {
+            log_error(SINK_STDERR, "[ERROR] Rejected a malformed request.\n");
+        } else {
+            int32_t code = handle_request(cache, &req, fds, handler);
+            write_exact(conn, &code, sizeof(code));
+        }
+    }
+
+    close_fds(fds, 2);
+    arena_free(&arena);
+}
+
+// binds the socket, replacing a stale one left by a server that didn't shut down cleanly
+static result_t bind_socket(int fd, const char *path, const struct sockaddr_un *addr) {
+    mode_t mask = umask(0077);
+    int rc = bind(fd, (const struct sockaddr *)addr, sizeof(*addr));
+    if (rc != 0 && errno == EADDRINUSE) {
+        int probe = socket(AF_UNIX, SOCK_STREAM, 0);
+        bool live = probe >= 0 && connect(probe, (const struct sockaddr *)addr, sizeof(*addr)) == 0;
+        if (probe >= 0) {
+            close(probe);
+        }
+
+        if (live) {
+            umask(mask);
+            return operation_error("An nvi server is already listening on '%s'.\n", path);
+        }
+
+        unlink(path);
+        rc = bind(fd, (const struct sockaddr *)addr, sizeof(*addr));
+    }
+    umask(mask);
+
+    if (rc != 0) {
+        return operation_error("Unable to listen on '%s': %s\n", path, strerror(errno));
+    }
+
+    return RESULT_OK;
+}
+
+static void install_signal(int sig, void (*handler)(int)) {
+    struct sigaction action;
+    memset(&action, 0, sizeof(action));
+    action.sa_handler = handler;
+    sigemptyset(&action.sa_mask);
+    // no SA_RESTART: poll has to return so the loop sees the flag
+    sigaction(sig, &action, NULL);
+}
+
+result_t run_server(int argc, const char **argv, serve_handler_t handler) {
+    if (argc > 2) {
+        return usage_error("The 'serve' command doesn't take arguments, instead found '%s' (set the socket with "
+                           "NVI_SOCKET)",
+                           argv[2]);
+    }
+
+    arena_t arena = {0};
+    const char *path = socket_path(&arena);
+    struct sockaddr_un addr;
+    result_t result = socket_address(path, &addr);
+    if (!result.ok) {
+        arena_free(&arena);
+        return result;
+    }
+
+    int listener = socket(AF_UNIX, SOCK_STREAM, 0);
+    if (listener < 0) {
+        arena_free(&arena);
+        return operation_error("Unable to create a socket: %s\n", strerror(errno));
+    }
+    fcntl(listener, F_SETFD, FD_CLOEXEC);
+
+    result = bind_socket(listener, path, &addr);
+    if (!result.ok) {
+        close(listener);
+        arena_free(&arena);
+        return result;
+    }
+
+    if (listen(listener, 64) != 0) {
+        result = operation_error("Unable to listen on '%s': %s\n", path, strerror(errno));
+        goto done;
+    }
+
+    serve_cache_t cache = {.inotify_fd = -1};
+    cache.files = arena_alloc_zeroed(&arena, SERVE_MAX_FILES * sizeof(*cache.files));
+    cache.scans = arena_alloc_zeroed(&arena, SERVE_MAX_SCANS * sizeof(*cache.scans));
+    cache.programs = arena_alloc_zeroed(&arena, SERVE_MAX_PROGRAMS * sizeof(*cache.programs));
+#if defined(__linux__)
+    cache.inotify_fd = inotify_init1(IN_NONBLOCK | IN_CLOEXEC);
+    if (cache.inotify_fd < 0) {
+        log_warning(SINK_STDERR, "[WARNING] inotify is unavailable (%s); scans won't be cached.\n", strerror(errno));
+    }
+#endif
+
+    install_signal(SIGINT, on_stop);
+    install_signal(SIGTERM, on_stop);
+    install_signal(SIGHUP, on_flush);
+    signal(SIGPIPE, SIG_IGN);
+
+    log_info(SINK_STDERR, "[INFO]");
+    log_f(SINK_STDERR, " Serving on '%s' (pid %ld)...\n", path, (long)getpid());
+
+    while (!stop_requested) {
+        if (flush_requested) {
+            flush_requested = 0;
+            clear_cache(&cache);
+            log_info(SINK_STDERR, "[INFO]");
+            log_f(SINK_STDERR, " Dropped every cached entry.\n");
+        }
+
+        struct pollfd fds[2] = {{.fd = listener, .events = POLLIN}, {.fd = cache.inotify_fd, .events = POLLIN}};
+        if (poll(fds, cache.inotify_fd >= 0 ? 2 : 1, -1) < 0) {
+            if (errno == EINTR) {
+                continue;
+            }
+            result = operation_error("Unable to wait for requests: %s\n", strerror(errno));
+            break;
+        }
+
+        if (cache.inotify_fd >= 0 && (fds[1].revents & POLLIN)) {
+            drain_watches(&cache);
+        }
+
+        if (fds[0].revents & POLLIN) {
+            int conn = accept(listener, NULL, NULL);
+            if (conn >= 0) {
+                serve_connection(&cache, conn, handler);
+                close(conn);
+            }
+        }
+    }
+
+    clear_cache(&cache);
+    arena_free(&cache.watch_refs.arena);
+    if (cache.inotify_fd >= 0) {
+        close(cache.inotify_fd);
+    }
+
+    log_info(SINK_STDERR, "[INFO]");
+    log_f(SINK_STDERR, " Stopped serving on '%s'.\n", path);
+
+done:
+    close(listener);
+    unlink(path);
+    arena_free(&arena);
+    return result;
+}
+
+#endif
@@ -0,0 +1,115 @@
+#ifndef SERVE_H
+#define SERVE_H
+
+#include "arena.h"
+#include "arg.h"
+#include "file.h"
+#include "hashset.h"
+#include "parser.h"
+#include "program.h"
+#include "result.h"
+#include "scanner.h"
+#include "tokenizer.h"
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+// `nvi serve` is a long-running process listening on a Unix domain socket; `nvi --client
+// <flags>` forwards its argv, working directory and environment to it instead of running the
+// pipeline itself. The client's stdout and stderr travel with the request (SCM_RIGHTS), so
+// the server writes the emitted ENVs and any diagnostics straight to them and replies with
+// nothing but the exit code: one round trip.
+//
+// Between requests the server caches:
+// - the tokens of every .env file it has read, revalidated per request against the file's
+//   device, inode, size, mtime and ctime (one stat per file)
+// - the compiled program (program.h) of each set of cached files a request parsed, until
+//   one of the files is tokenized again
+// - the keys found by each scan, keyed by working directory and scan extensions, until
+//   inotify reports a change in one of the walked directories (Linux only; elsewhere scans
+//   always run). A directory's watch is removed with the last cached scan that walked it.
+//
+// Evaluation always runs, since interpolation reads the client's environment. Runs with
+// --dry-run, --stats or --trace bypass the caches so their reports describe a full run.
+// SIGHUP drops every cached entry; SIGINT and SIGTERM stop the server and remove the socket.
+//
+// The socket is $NVI_SOCKET, else $XDG_RUNTIME_DIR/nvi.sock, else /tmp/nvi-<uid>.sock, and
+// only accepts connections from the user running the server. Not supported on Windows.
+
+#define SERVE_MAX_REQUEST ((size_t)4 * 1024 * 1024)
+#define SERVE_MAX_FILES 1024
+#define SERVE_MAX_SCANS 64
+#define SERVE_MAX_PROGRAMS 64
+#define SERVE_IO_TIMEOUT_SECONDS 5 // how long a connection may stall sending its request or reading the reply
+
+typedef struct {
+    const char *key;  // the request's working directory joined with 'path'
+    const char *path; // as the request named it; the cached tokens refer to it
+    file_identity_t id;
+    token_list_t tokens;
+    size_t bytes;
+    uint64_t serial; // unique across the server's lifetime, so programs can name their files
+    bool pinned;     // the current request shares its tokens, so it can't be evicted until that's done
+    arena_t arena;   // everything above, released on eviction
+} cached_file_t;
+
+typedef struct {
+    uint64_t *serials; // the cached files compiled, in --files order
+    size_t serial_count;
+    program_t program;
+    arena_t arena;
+} cached_program_t;
+
+typedef struct {
+    const char *cwd;
+    const char *exts; // the scan extensions, space separated
+    hashset_t env_keys;
+    int *watches; // inotify watch descriptors of the walked directories
+    size_t watch_count;
+    arena_t arena;
+} cached_scan_t;
+
+// how many cached scans hold each inotify watch descriptor; a walk of a directory another scan
+// already watches gets the same descriptor back, so a watch is removed with its last scan
+typedef struct {
+    int *wds;
+    uint32_t *refs; // 0 marks an empty slot
+    size_t count;
+    size_t capacity; // a power of two
+    arena_t arena;
+} watch_refs_t;
+
+typedef struct {
+    cached_file_t *files; // SERVE_MAX_FILES slots
+    size_t file_count;
+    cached_scan_t *scans; // SERVE_MAX_SCANS slots
+    size_t scan_count;
+    cached_program_t *programs; // SERVE_MAX_PROGRAMS slots
+    size_t program_count;
+    uint64_t next_serial;
+    uint64_t *request_serials; // the cached files serve_tokenize served the request from
+    size_t request_serial_count;
+    bool request_cached;       // every one of the request's files was
+    int inotify_fd;       // -1 without inotify
+    watch_refs_t watch_refs;
+    const char *cwd;      // the working directory of the request being served
+    double request_start; // wall clock, for the racily-clean check
+} serve_cache_t;
+
+// Runs one request exactly like main would, with 'cache' for the cached stages
+typedef int (*serve_handler_t)(int argc, const char **argv, serve_cache_t *cache);
+
+result_t run_server(int argc, const char **argv, serve_handler_t handler);
+
+// Forwards argv (without the leading --client) to the server and returns its exit code
+result_t run_client(int argc, const char **argv);
+
+// run_scanner and run_tokenizer, served from the cache when the request allows it
+result_t serve_scan(serve_cache_t *cache, arena_t *arena, args_t *args, scanner_t *scanner);
+result_t serve_tokenize(serve_cache_t *cache, arena_t *arena, const args_t *args, tokenizer_t *tokenizer);
+
+// run_parser, replaying a cached program when serve_tokenize served every file from the cache
+result_t serve_parse(serve_cache_t *cache, arena_t *arena, const args_t *args, const token_list_t *tokens,
+                     parser_t *parser);
+
+#endif // SERVE_H
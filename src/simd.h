@@ -0,0 +1,32 @@
+#ifndef SIMD_H
+#define SIMD_H
+
+// SSE2 where the target always has it (every x86-64, and 32-bit x86 built for it), with the
+// bit helpers its 16-byte compare masks need. Callers keep a scalar path for the rest.
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define NVI_SSE2 1
+#include <emmintrin.h>
+
+#if defined(_MSC_VER)
+#include <intrin.h>
+
+// __popcnt emits POPCNT, which SSE2 doesn't imply, so MSVC counts the bits itself
+static inline unsigned mask_popcount(unsigned mask) {
+    mask = mask - ((mask >> 1) & 0x55555555u);
+    mask = (mask & 0x33333333u) + ((mask >> 2) & 0x33333333u);
+    return (((mask + (mask >> 4)) & 0x0F0F0F0Fu) * 0x01010101u) >> 24;
+}
+
+static inline unsigned mask_ctz(unsigned mask) {
+    unsigned long i;
+    _BitScanForward(&i, mask);
+    return (unsigned)i;
+}
+#else
+static inline unsigned mask_popcount(unsigned mask) { return (unsigned)__builtin_popcount(mask); }
+static inline unsigned mask_ctz(unsigned mask) { return (unsigned)__builtin_ctz(mask); }
+#endif
+#endif
+
+#endif // SIMD_H
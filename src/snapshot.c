@@ -0,0 +1,393 @@
+#include "snapshot.h"
+#include "arena.h"
+#include "dynarr.h"
+#include "emitter.h"
+#include "errors.h"
+#include "hash.h"
+#include "log.h"
+#include "macros.h"
+#include "tty.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/stat.h>
+
+bool is_valid_snapshot_name(const char *name) {
+    size_t len = strlen(name);
+    if (len == 0 || len > SNAPSHOT_MAX_NAME) {
+        return false;
+    }
+
+    for (size_t i = 0; i < len; ++i) {
+        char c = name[i];
+        bool valid = (c >= 'a' && c <= 'z') || (c >= 'A' && c <= 'Z') || (c >= '0' && c <= '9') || c == '.' ||
+                     c == '_' || c == '-';
+        if (!valid) {
+            return false;
+        }
+    }
+
+    // keeps "." and ".." from reading as directories once prefixed
+    return name[0] != '.';
+}
+
+static bool is_unset(const char *dir) { return dir == NULL || dir[0] == '\0'; }
+
+const char *get_snapshot_path(arena_t *arena, const char *name) {
+    const char *dir = getenv("NVI_SNAPSHOT_DIR");
+    if (is_unset(dir)) {
+        // private to the user (0700), unlike the shared directories below
+        dir = getenv("XDG_RUNTIME_DIR");
+    }
+#if !defined(_WIN32)
+    struct stat st;
+    if (is_unset(dir) && stat("/dev/shm", &st) == 0 && S_ISDIR(st.st_mode)) {
+        dir = "/dev/shm";
+    }
+#endif
+    if (is_unset(dir)) {
+        dir = getenv("TMPDIR");
+    }
+    if (is_unset(dir)) {
+        dir = "/tmp";
+    }
+
+    return arena_sprintf(arena, "%s/nvi-%s.snap", dir, name);
+}
+
+const snapshot_entry_t *snapshot_get(const snapshot_t *snapshot, const char *key, size_t key_len) {
+    const uint32_t mask = snapshot->header->index_capacity - 1;
+    uint32_t slot = (uint32_t)(fnv1a(key, key_len) & mask);
+
+    // the capacity always exceeds the count, so an empty slot ends every probe
+    while (snapshot->index[slot] != 0) {
+        const snapshot_entry_t *entry = &snapshot->entries[snapshot->index[slot] - 1];
+        if (entry->key_len == key_len && memcmp(snapshot->data + entry->key, key, key_len) == 0) {
+            return entry;
+        }
+        slot = (slot + 1) & mask;
+    }
+
+    return NULL;
+}
+
+#if defined(_WIN32) && defined(_MSC_VER)
+
+result_t publish_snapshot(arena_t *arena, const char *name, const env_map_t *env_map, uint64_t *generation) {
+    (void)arena;
+    (void)name;
+    (void)env_map;
+    (void)generation;
+    return operation_error("The '--publish' flag is not supported on Windows.\n");
+}
+
+result_t open_snapshot(arena_t *arena, const char *name, snapshot_t *snapshot) {
+    (void)arena;
+    (void)name;
+    (void)snapshot;
+    return operation_error("The '--snapshot' flag is not supported on Windows.\n");
+}
+
+void close_snapshot(snapshot_t *snapshot) { (void)snapshot; }
+
+#else
+
+#include <errno.h>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <unistd.h>
+
+// returns NULL when 'map' is a complete snapshot, else what is wrong with it
+static const char *validate_snapshot(const void *map, size_t size, snapshot_t *snapshot) {
+    const size_t header_size = sizeof(snapshot_header_t);
+    if (size < header_size) {
+        return "truncated header";
+    }
+
+    const snapshot_header_t *header = map;
+    if (memcmp(header->magic, SNAPSHOT_MAGIC, sizeof(header->magic)) != 0) {
+        return "not a snapshot";
+    }
+    if (header->layout != SNAPSHOT_LAYOUT) {
+        return "unsupported layout version";
+    }
+
+    const uint64_t capacity = header->index_capacity;
+    const uint64_t index_off = header_size + (uint64_t)header->count * sizeof(snapshot_entry_t);
+    const uint64_t data_off = index_off + capacity * sizeof(uint32_t);
+    if (capacity == 0 || (capacity & (capacity - 1)) != 0 || capacity <= header->count ||
+        header->size != (uint64_t)size || data_off + header->data_len != (uint64_t)size) {
+        return "inconsistent sizes";
+    }
+
+    const char *bytes = map;
+    if (fnv1a(bytes + header_size, size - header_size) != header->checksum) {
+        return "checksum mismatch";
+    }
+
+    const snapshot_entry_t *entries = (const snapshot_entry_t *)(bytes + header_size);
+    const uint32_t *index = (const uint32_t *)(bytes + index_off);
+    const char *data = bytes + data_off;
+
+    // the checksum catches torn or damaged files; these catch a writer that got it wrong
+    for (uint32_t i = 0; i < header->count; ++i) {
+        const snapshot_entry_t *e = &entries[i];
+        if ((uint64_t)e->key + e->key_len >= header->data_len || data[e->key + e->key_len] != '=' ||
+            e->value != e->key + e->key_len + 1 || (uint64_t)e->value + e->value_len >= header->data_len ||
+            data[e->value + e->value_len] != '\0') {
+            return "entry out of bounds";
+        }
+    }
+    for (uint64_t i = 0; i < capacity; ++i) {
+        if (index[i] > header->count) {
+            return "index out of bounds";
+        }
+    }
+
+    snapshot->header = header;
+    snapshot->entries = entries;
+    snapshot->index = index;
+    snapshot->data = data;
+    return NULL;
+}
+
+// maps 'path' read only; the mapping outlives the descriptor and a later rename over it
+static const char *map_snapshot(const char *path, snapshot_t *snapshot) {
+    int fd = open(path, O_RDONLY | O_CLOEXEC);
+    if (fd == -1) {
+        return strerror(errno);
+    }
+
+    struct stat st;
+    if (fstat(fd, &st) != 0) {
+        close(fd);
+        return strerror(errno);
+    }
+
+    // the name is predictable, so in a shared directory anyone could have planted it
+    if (!S_ISREG(st.st_mode) || st.st_uid != geteuid() || (st.st_mode & (S_IWGRP | S_IWOTH)) != 0) {
+        close(fd);
+        return "not a file only its owner, this user, can write";
+    }
+
+    size_t size = (size_t)st.st_size;
+    if (size < sizeof(snapshot_header_t)) {
+        close(fd);
+        return "truncated header";
+    }
+
+    void *map = mmap(NULL, size, PROT_READ, MAP_SHARED, fd, 0);
+    close(fd);
+    if (map == MAP_FAILED) {
+        return strerror(errno);
+    }
+
+    const char *reason = validate_snapshot(map, size, snapshot);
+    if (reason != NULL) {
+        munmap(map, size);
+        return reason;
+    }
+
+    snapshot->map = map;
+    snapshot->size = size;
+    snapshot->path = path;
+    return NULL;
+}
+
+result_t open_snapshot(arena_t *arena, const char *name, snapshot_t *snapshot) {
+    const char *path = get_snapshot_path(arena, name);
+    const char *reason = map_snapshot(path, snapshot);
+    if (reason != NULL) {
+        return operation_error("Unable to read the '%s' snapshot at '%s' (%s).\n", name, path, reason);
+    }
+
+    return RESULT_OK;
+}
+
+void close_snapshot(snapshot_t *snapshot) {
+    if (snapshot->map != NULL) {
+        munmap(snapshot->map, snapshot->size);
+    }
+    *snapshot = (snapshot_t){0};
+}
+
+// lays out 'env_map' in a single arena buffer that is written out as is
+static char *build_image(arena_t *arena, const env_map_t *env_map, uint64_t generation, size_t *size) {
+    uint32_t capacity = 8;
+    while (capacity < env_map->count * 2) {
+        capacity *= 2;
+    }
+
+    size_t data_len = 0;
+    for (size_t i = 0; i < env_map->count; ++i) {
+        data_len += strlen(env_map->items[i].key) + strlen(env_map->items[i].value) + 2;
+    }
+
+    const size_t header_size = sizeof(snapshot_header_t);
+    const size_t index_off = header_size + env_map->count * sizeof(snapshot_entry_t);
+    const size_t data_off = index_off + capacity * sizeof(uint32_t);
+    *size = data_off + data_len;
+
+    char *image = arena_alloc_zeroed(arena, *size);
+    snapshot_header_t *header = (snapshot_header_t *)image;
+    snapshot_entry_t *entries = (snapshot_entry_t *)(image + header_size);
+    uint32_t *index = (uint32_t *)(image + index_off);
+    char *data = image + data_off;
+
+    size_t at = 0;
+    for (size_t i = 0; i < env_map->count; ++i) {
+        const env_t *env = &env_map->items[i];
+        size_t key_len = strlen(env->key);
+        size_t value_len = strlen(env->value);
+
+        entries[i] = (snapshot_entry_t){(uint32_t)at, (uint32_t)key_len, (uint32_t)(at + key_len + 1),
+                                        (uint32_t)value_len};
+        memcpy(data + at, env->key, key_len);
+        data[at + key_len] = '=';
+        memcpy(data + at + key_len + 1, env->value, value_len + 1);
+        at += key_len + value_len + 2;
+
+        // the env map already holds unique keys, so every insert takes a fresh slot
+        uint32_t slot = (uint32_t)(fnv1a(env->key, key_len) & (capacity - 1));
+        while (index[slot] != 0) {
+            slot = (slot + 1) & (capacity - 1);
+        }
+        index[slot] = (uint32_t)i + 1;
+    }
+
+    memcpy(header->magic, SNAPSHOT_MAGIC, sizeof(header->magic));
+    header->layout = SNAPSHOT_LAYOUT;
+    header->count = (uint32_t)env_map->count;
+    header->generation = generation;
+    header->size = *size;
+    header->index_capacity = capacity;
+    header->data_len = (uint32_t)data_len;
+    header->checksum = fnv1a(image + header_size, *size - header_size);
+
+    return image;
+}
+
+static bool write_all(int fd, const char *buf, size_t len) {
+    while (len > 0) {
+        ssize_t n = write(fd, buf, len);
+        if (n < 0) {
+            if (errno == EINTR) {
+                continue;
+            }
+            return false;
+        }
+        buf += n;
+        len -= (size_t)n;
+    }
+    return true;
+}
+
+result_t publish_snapshot(arena_t *arena, const char *name, const env_map_t *env_map, uint64_t *generation) {
+    const char *path = get_snapshot_path(arena, name);
+
+    // concurrent publishers may pick the same generation; the last rename still wins whole
+    snapshot_t previous = {0};
+    *generation = map_snapshot(path, &previous) == NULL ? previous.header->generation + 1 : 1;
+    close_snapshot(&previous);
+
+    size_t size = 0;
+    const char *image = build_image(arena, env_map, *generation, &size);
+
+    // written under a fresh private name first: readers only ever find a complete file, and
+    // mkstemp won't follow or reuse a name someone else created
+    char *tmp_path = arena_sprintf(arena, "%s.XXXXXX", path);
+    int fd = mkstemp(tmp_path);
+    if (fd == -1) {
+        return operation_error("Unable to create the '%s' snapshot at '%s' (%s).\n", name, tmp_path,
+                               strerror(errno));
+    }
+
+    bool written = fcntl(fd, F_SETFD, FD_CLOEXEC) == 0 && fchmod(fd, 0400) == 0 && write_all(fd, image, size);
+    int write_errno = errno;
+    if (close(fd) != 0 && written) {
+        written = false;
+        write_errno = errno;
+    }
+
+    if (!written || rename(tmp_path, path) != 0) {
+        const char *reason = strerror(written ? errno : write_errno);
+        unlink(tmp_path);
+        return operation_error("Unable to publish the '%s' snapshot at '%s' (%s).\n", name, path, reason);
+    }
+
+    return RESULT_OK;
+}
+
+#endif
+
+static void report_snapshot(const args_t *args, const snapshot_t *snapshot) {
+    const snapshot_header_t *header = snapshot->header;
+    log_info(SINK_STDERR, "[INFO]");
+    log_f(SINK_STDERR, " Mapped generation %llu of the '%s' snapshot (%s) with %u ENV%s...\n",
+          (unsigned long long)header->generation, args->snapshot, snapshot->path, header->count,
+          TO_PLURAL(header->count));
+    for (uint32_t i = 0; i < header->count; ++i) {
+        const snapshot_entry_t *entry = &snapshot->entries[i];
+        log_f(SINK_STDERR, "    %s ", BULLET);
+        log_bold_info(SINK_STDERR, "%.*s=", (int)entry->key_len, snapshot->data + entry->key);
+        log_bold_info(SINK_STDERR, "%s", args->reveal ? snapshot->data + entry->value : "*****");
+        log_f(SINK_STDERR, "\n");
+    }
+    log_f(SINK_STDERR, "\n");
+}
+
+result_t run_publish(arena_t *arena, const args_t *args, const env_map_t *env_map) {
+    if (args->dry_run) {
+        log_info(SINK_STDERR, "[INFO]");
+        log_f(SINK_STDERR, " Skipped publishing the '%s' snapshot (%s) during a dry run.\n\n", args->publish,
+              get_snapshot_path(arena, args->publish));
+        return RESULT_OK;
+    }
+
+    uint64_t generation = 0;
+    return publish_snapshot(arena, args->publish, env_map, &generation);
+}
+
+result_t run_snapshot(arena_t *arena, const args_t *args) {
+    snapshot_t snapshot = {0};
+    result_t result = open_snapshot(arena, args->snapshot, &snapshot);
+    if (!result.ok) {
+        return result;
+    }
+
+    if (args->dry_run) {
+        report_snapshot(args, &snapshot);
+        close_snapshot(&snapshot);
+        return RESULT_OK;
+    }
+
+    list_t missing_envs = {0};
+    for (size_t i = 0; i < args->required.count; ++i) {
+        const char *key = args->required.items[i];
+        const snapshot_entry_t *entry = snapshot_get(&snapshot, key, strlen(key));
+        if (entry == NULL || entry->value_len == 0) {
+            DYN_ARR_APPEND(arena, &missing_envs, key);
+        }
+    }
+
+    if (args->command.count > 0 && missing_envs.count > 0) {
+        close_snapshot(&snapshot);
+        return report_missing_envs(&missing_envs);
+    }
+
+    if (args->command.count > 0) {
+        if (args->format == FORMAT_POWERSHELL) {
+            for (uint32_t i = 0; i < snapshot.header->count; ++i) {
+                const snapshot_entry_t *entry = &snapshot.entries[i];
+                emit_env(args->format, snapshot.data + entry->key, entry->key_len, snapshot.data + entry->value);
+            }
+        } else {
+            // the data block is already in the nul format
+            fwrite(snapshot.data, 1, snapshot.header->data_len, stdout);
+        }
+        emit_command(args);
+    }
+
+    close_snapshot(&snapshot);
+    return RESULT_OK;
+}
@@ -0,0 +1,78 @@
+#ifndef SNAPSHOT_H
+#define SNAPSHOT_H
+
+#include "arena.h"
+#include "arg.h"
+#include "parser.h"
+#include "result.h"
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+// A snapshot is a parsed env map published once (`--publish <name>`) and read by any
+// number of processes on the host (`--snapshot <name>`) without tokenizing or parsing.
+//
+// It's a single read-only file on a tmpfs ($NVI_SNAPSHOT_DIR, else $XDG_RUNTIME_DIR, else
+// /dev/shm, else $TMPDIR or /tmp) named nvi-<name>.snap, laid out as:
+// - a header: magic, layout version, generation, entry count, sizes and a checksum of the body
+// - entries: offsets of each key and value within the data block, in emit order
+// - index: an open-addressed hash table (FNV-1a, linear probing) of entry numbers
+// - data: the "KEY=value\0" pairs, exactly as the nul format emits them
+//
+// Publishing writes a new file next to the old one and renames it over it, so a reader
+// maps either the previous generation or the next one, never a partially written map;
+// readers that already mapped the previous one keep it until they unmap. Readers refuse a
+// file that another user owns or that group or others can write.
+
+#define SNAPSHOT_MAGIC "NVISNAP"
+#define SNAPSHOT_LAYOUT 1
+#define SNAPSHOT_MAX_NAME 64
+
+typedef struct {
+    char magic[8];
+    uint32_t layout;
+    uint32_t count;           // entries
+    uint64_t generation;      // one more than the snapshot it replaced
+    uint64_t size;            // the whole file
+    uint64_t checksum;        // FNV-1a of everything after the header
+    uint32_t index_capacity;  // a power of two
+    uint32_t data_len;
+} snapshot_header_t;
+
+typedef struct {
+    uint32_t key; // offset within the data block; keys are '=' terminated
+    uint32_t key_len;
+    uint32_t value; // offset within the data block; values are NUL terminated
+    uint32_t value_len;
+} snapshot_entry_t;
+
+typedef struct {
+    const char *path;
+    const snapshot_header_t *header;
+    const snapshot_entry_t *entries;
+    const uint32_t *index; // entry number + 1, 0 for an empty slot
+    const char *data;
+    void *map;
+    size_t size;
+} snapshot_t;
+
+bool is_valid_snapshot_name(const char *name);
+const char *get_snapshot_path(arena_t *arena, const char *name);
+
+// Writes 'env_map' as the next generation of the 'name' snapshot
+result_t publish_snapshot(arena_t *arena, const char *name, const env_map_t *env_map, uint64_t *generation);
+
+// Maps the 'name' snapshot and validates its header, checksum and offsets
+result_t open_snapshot(arena_t *arena, const char *name, snapshot_t *snapshot);
+void close_snapshot(snapshot_t *snapshot);
+
+// Returns the entry of 'key' or NULL
+const snapshot_entry_t *snapshot_get(const snapshot_t *snapshot, const char *key, size_t key_len);
+
+// --publish: publishes the parsed ENVs unless it's a dry run
+result_t run_publish(arena_t *arena, const args_t *args, const env_map_t *env_map);
+
+// --snapshot: checks the required keys and emits the snapshot with the command
+result_t run_snapshot(arena_t *arena, const args_t *args);
+
+#endif // SNAPSHOT_H
@@ -0,0 +1,100 @@
+#include "sniff.h"
+#include "chars.h"
+#include "macros.h"
+#include "simd.h"
+#include <stdbool.h>
+#include <string.h>
+
+static const char *lockfile_names[] = {
+    "Cargo.lock", "Gemfile.lock", "composer.lock", "package-lock.json", "pnpm-lock.yaml", "poetry.lock", "yarn.lock",
+};
+
+static const char *generated_suffixes[] = {
+    ".designer.cs", ".g.dart", ".pb.go", "_pb2.py", "_pb2.pyi",
+};
+
+static bool ends_with(const char *s, size_t len, const char *suffix) {
+    size_t suffix_len = strlen(suffix);
+    return len >= suffix_len && memcmp(s + len - suffix_len, suffix, suffix_len) == 0;
+}
+
+static bool contains(const char *s, size_t len, const char *needle) {
+    size_t needle_len = strlen(needle);
+    for (const char *p = s; (size_t)(s + len - p) >= needle_len; ++p) {
+        p = memchr(p, needle[0], (size_t)(s + len - p) - needle_len + 1);
+        if (p == NULL) {
+            return false;
+        }
+
+        if (memcmp(p, needle, needle_len) == 0) {
+            return true;
+        }
+    }
+
+    return false;
+}
+
+sniff_kind_t sniff_name(const char *name, unsigned enabled) {
+    size_t len = strlen(name);
+
+    if ((enabled & SNIFF_BIT(SNIFF_MINIFIED)) && contains(name, len, ".min.")) {
+        return SNIFF_MINIFIED;
+    }
+
+    if (enabled & SNIFF_BIT(SNIFF_GENERATED)) {
+        for (size_t i = 0; i < ARR_LEN(lockfile_names); ++i) {
+            if (strcmp(name, lockfile_names[i]) == 0) {
+                return SNIFF_GENERATED;
+            }
+        }
+
+        for (size_t i = 0; i < ARR_LEN(generated_suffixes); ++i) {
+            if (ends_with(name, len, generated_suffixes[i])) {
+                return SNIFF_GENERATED;
+            }
+        }
+    }
+
+    return SNIFF_NONE;
+}
+
+sniff_kind_t sniff_contents(const char *s, size_t len, unsigned enabled) {
+    if (len > SNIFF_SIZE) {
+        len = SNIFF_SIZE;
+    }
+
+    // one pass: whether there's a NUL, and how many lines the head holds
+    bool has_nul = false;
+    size_t newlines = 0;
+    size_t k = 0;
+#ifdef NVI_SSE2
+    const __m128i nul = _mm_setzero_si128();
+    const __m128i newline = _mm_set1_epi8(LINE_DELIMITER);
+    unsigned nul_mask = 0;
+    for (; k + 16 <= len; k += 16) {
+        __m128i block = _mm_loadu_si128((const __m128i *)(s + k));
+        nul_mask |= (unsigned)_mm_movemask_epi8(_mm_cmpeq_epi8(block, nul));
+        newlines += mask_popcount((unsigned)_mm_movemask_epi8(_mm_cmpeq_epi8(block, newline)));
+    }
+    has_nul = nul_mask != 0;
+#endif
+    for (; k < len; ++k) {
+        has_nul |= s[k] == '\0';
+        newlines += s[k] == LINE_DELIMITER;
+    }
+
+    if ((enabled & SNIFF_BIT(SNIFF_BINARY)) && has_nul) {
+        return SNIFF_BINARY;
+    }
+
+    if ((enabled & SNIFF_BIT(SNIFF_MINIFIED)) && len >= SNIFF_MINIFIED_MIN &&
+        len / (newlines + 1) > SNIFF_MINIFIED_LINE) {
+        return SNIFF_MINIFIED;
+    }
+
+    if ((enabled & SNIFF_BIT(SNIFF_GENERATED)) && contains(s, len, SNIFF_GENERATED_MARKER)) {
+        return SNIFF_GENERATED;
+    }
+
+    return SNIFF_NONE;
+}
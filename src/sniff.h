@@ -0,0 +1,72 @@
+#ifndef SNIFF_H
+#define SNIFF_H
+
+#include <stddef.h>
+#include <string.h>
+
+// Cheap checks for scan candidates whose matches would only be noise: binary files, minified
+// bundles (and source maps saved as .js) and generated code. A name is checked before the
+// file is opened; the contents by their first SNIFF_SIZE bytes, in one pass.
+typedef enum { SNIFF_NONE, SNIFF_BINARY, SNIFF_MINIFIED, SNIFF_GENERATED, SNIFF_UNKNOWN } sniff_kind_t;
+
+#define SNIFF_BIT(kind) (1u << (kind))
+#define SNIFF_ALL (SNIFF_BIT(SNIFF_BINARY) | SNIFF_BIT(SNIFF_MINIFIED) | SNIFF_BIT(SNIFF_GENERATED))
+// a binary file never holds a key worth requiring; minified and generated ones may, so
+// skipping them is opt-in (--scan-skip)
+#define SNIFF_DEFAULT SNIFF_BIT(SNIFF_BINARY)
+
+#define SNIFF_SIZE 4096
+// a head at least this long whose lines average more than SNIFF_MINIFIED_LINE bytes is minified
+#define SNIFF_MINIFIED_MIN 1024
+#define SNIFF_MINIFIED_LINE 500
+
+#define SNIFF_GENERATED_MARKER "@generated"
+
+static inline const char *get_sniff_name(const sniff_kind_t kind) {
+    switch (kind) {
+        case SNIFF_BINARY: {
+            return "binary";
+        }
+        case SNIFF_MINIFIED: {
+            return "minified";
+        }
+        case SNIFF_GENERATED: {
+            return "generated";
+        }
+        case SNIFF_NONE: {
+            return "none";
+        }
+        default:
+            return "unknown";
+    }
+}
+
+static inline sniff_kind_t get_sniff(const char *arg) {
+    if (strcmp(arg, "binary") == 0) {
+        return SNIFF_BINARY;
+    }
+
+    if (strcmp(arg, "minified") == 0) {
+        return SNIFF_MINIFIED;
+    }
+
+    if (strcmp(arg, "generated") == 0) {
+        return SNIFF_GENERATED;
+    }
+
+    if (strcmp(arg, "none") == 0) {
+        return SNIFF_NONE;
+    }
+
+    return SNIFF_UNKNOWN;
+}
+
+// 'enabled' is a mask of SNIFF_BIT kinds; a kind that isn't enabled is never returned.
+// '.min.' names are minified; lockfiles and the usual code generator suffixes are generated.
+sniff_kind_t sniff_name(const char *name, unsigned enabled);
+
+// Checks the first SNIFF_SIZE bytes of 's' for NUL bytes, an extreme average line length and
+// the SNIFF_GENERATED_MARKER, in that order
+sniff_kind_t sniff_contents(const char *s, size_t len, unsigned enabled);
+
+#endif // SNIFF_H
@@ -0,0 +1,34 @@
+#ifndef SOURCE_H
+#define SOURCE_H
+#include <string.h>
+
+// Where a scan finds its candidate files: walking the CWD, or the tracked files listed by the
+// git index of the checkout at the CWD
+typedef enum { SCAN_SOURCE_WALK, SCAN_SOURCE_GIT_INDEX, SCAN_SOURCE_UNKNOWN } scan_source_t;
+
+static inline const char *get_scan_source_name(const scan_source_t s) {
+    switch (s) {
+        case SCAN_SOURCE_WALK: {
+            return "walk";
+        }
+        case SCAN_SOURCE_GIT_INDEX: {
+            return "git-index";
+        }
+        default:
+            return "unknown";
+    }
+}
+
+static inline scan_source_t get_scan_source(const char *arg) {
+    if (strcmp(arg, "walk") == 0) {
+        return SCAN_SOURCE_WALK;
+    }
+
+    if (strcmp(arg, "git-index") == 0) {
+        return SCAN_SOURCE_GIT_INDEX;
+    }
+
+    return SCAN_SOURCE_UNKNOWN;
+}
+
+#endif // SOURCE_H
@@ -0,0 +1,380 @@
+#include "stats.h"
+#include "arena.h"
+#include "json.h"
+#include "log.h"
+#include "macros.h"
+#include "tty.h"
+#include <inttypes.h>
+#include <stdio.h>
+#include <string.h>
+
+#define MB (1024.0 * 1024.0)
+
+size_t stats_latency_bucket(double seconds) {
+    double us = seconds * 1e6;
+    size_t bucket = 0;
+    double upper = 1.0;
+
+    while (us >= upper && bucket < STATS_LATENCY_BUCKETS - 1) {
+        upper *= 2.0;
+        ++bucket;
+    }
+
+    return bucket;
+}
+
+static void insert_slowest(arena_t *arena, scan_stats_t *stats, const char *path, size_t bytes, double seconds) {
+    if (stats->slowest_count == STATS_SLOWEST && seconds <= stats->slowest[STATS_SLOWEST - 1].seconds) {
+        return;
+    }
+
+    size_t i = stats->slowest_count < STATS_SLOWEST ? stats->slowest_count++ : STATS_SLOWEST - 1;
+    while (i > 0 && stats->slowest[i - 1].seconds < seconds) {
+        stats->slowest[i] = stats->slowest[i - 1];
+        --i;
+    }
+
+    stats->slowest[i] = (file_latency_t){.path = arena_strdup(arena, path), .bytes = bytes, .seconds = seconds};
+}
+
+void stats_record_file(arena_t *arena, scan_stats_t *stats, const char *path, size_t bytes, double seconds) {
+    ++stats->latency[stats_latency_bucket(seconds)];
+    insert_slowest(arena, stats, path, bytes, seconds);
+}
+
+void stats_merge(arena_t *arena, scan_stats_t *dst, const scan_stats_t *src) {
+    dst->totals.dirs += src->totals.dirs;
+    dst->totals.files += src->totals.files;
+    dst->totals.bytes_read += src->totals.bytes_read;
+    dst->totals.busy += src->totals.busy;
+    dst->totals.idle += src->totals.idle;
+    dst->totals.read += src->totals.read;
+    dst->totals.match += src->totals.match;
+    perf_counts_add(&dst->totals.perf, &src->totals.perf);
+
+    for (size_t i = 0; i < SKIP_COUNT; ++i) {
+        dst->skipped[i] += src->skipped[i];
+    }
+
+    for (size_t i = 0; i < STATS_LATENCY_BUCKETS; ++i) {
+        dst->latency[i] += src->latency[i];
+    }
+
+    for (size_t i = 0; i < src->slowest_count; ++i) {
+        const file_latency_t *f = &src->slowest[i];
+        insert_slowest(arena, dst, f->path, f->bytes, f->seconds);
+    }
+}
+
+// ---------------------------------------------------------------------------
+// text report
+// ---------------------------------------------------------------------------
+
+static double per_second(double amount, double seconds) { return seconds > 0 ? amount / seconds : 0; }
+
+static double probes_per_lookup(const probe_stats_t *p) {
+    return p->lookups > 0 ? (double)p->probes / (double)p->lookups : 0;
+}
+
+static void report_text_phases(const stats_t *stats) {
+    log_info(SINK_STDERR, "[STATS]");
+    log_f(SINK_STDERR, " Phase timings...\n");
+
+    for (size_t i = 0; i < PHASE_COUNT; ++i) {
+        log_f(SINK_STDERR, "    %s %-10s", BULLET, get_phase_name((phase_t)i));
+        log_bold_info(SINK_STDERR, "%10.3fms\n", stats->phases[i] * 1000.0);
+    }
+
+    log_f(SINK_STDERR, "    %s %-10s", BULLET, "total");
+    log_bold_info(SINK_STDERR, "%10.3fms\n", stats->total * 1000.0);
+    log_f(SINK_STDERR, "\n");
+}
+
+static const char *perf_unavailable_reason(const stats_t *stats) {
+    return stats->perf_error != NULL ? stats->perf_error : "not measured";
+}
+
+static double ratio(uint64_t a, uint64_t b) { return b > 0 ? (double)a / (double)b : 0; }
+
+static void report_text_perf_line(const char *label, const perf_counts_t *p, size_t bytes) {
+    const uint64_t *c = p->counts;
+    log_f(SINK_STDERR, "    %s %-10s IPC %.2f, %" PRIu64 " instructions", BULLET, label,
+          ratio(c[PERF_INSTRUCTIONS], c[PERF_CYCLES]), c[PERF_INSTRUCTIONS]);
+
+    if (bytes > 0) {
+        double kb = (double)bytes / 1024.0;
+        log_f(SINK_STDERR, " (%.1f per byte), %.2f cache misses/KB, %.2f branch misses/KB\n",
+              ratio(c[PERF_INSTRUCTIONS], bytes), (double)c[PERF_CACHE_MISSES] / kb,
+              (double)c[PERF_BRANCH_MISSES] / kb);
+    } else {
+        log_f(SINK_STDERR, ", %" PRIu64 " cache misses, %" PRIu64 " branch misses\n", c[PERF_CACHE_MISSES],
+              c[PERF_BRANCH_MISSES]);
+    }
+}
+
+static void report_text_perf(const stats_t *stats) {
+    log_info(SINK_STDERR, "[STATS]");
+    if (!stats->perf_ok) {
+        log_f(SINK_STDERR, " Hardware counters unavailable: %s\n\n", perf_unavailable_reason(stats));
+        return;
+    }
+
+    log_f(SINK_STDERR, " Hardware counters ");
+    log_comment(SINK_STDERR, "(user space)");
+    log_f(SINK_STDERR, "...\n");
+
+    for (size_t i = 0; i < PHASE_COUNT; ++i) {
+        if (stats->perf_measured[i]) {
+            report_text_perf_line(get_phase_name((phase_t)i), &stats->perf[i], stats->bytes[i]);
+        }
+    }
+
+    for (size_t i = 0; i < stats->worker_count; ++i) {
+        char label[32];
+        snprintf(label, sizeof(label), "worker %zu", i);
+        report_text_perf_line(label, &stats->workers[i].perf, stats->workers[i].bytes_read);
+    }
+
+    log_f(SINK_STDERR, "\n");
+}
+
+static void report_text_scan(const stats_t *stats) {
+    const scan_stats_t *scan = stats->scan;
+    const worker_stats_t *t = &scan->totals;
+    double wall = stats->phases[PHASE_SCAN];
+
+    log_info(SINK_STDERR, "[STATS]");
+    log_f(SINK_STDERR, " Scanned %zu director%s and %zu file%s (%.2f MB) at %.0f files/s, %.1f MB/s\n",
+          t->dirs, TO_PLURAL(t->dirs, "ies", "y"), t->files, TO_PLURAL(t->files), (double)t->bytes_read / MB,
+          per_second((double)t->files, wall), per_second((double)t->bytes_read / MB, wall));
+
+    double walk = t->busy - t->read - t->match;
+    log_f(SINK_STDERR, "    %s walk %.3fms, read %.3fms, match %.3fms ", BULLET, walk * 1000.0, t->read * 1000.0,
+          t->match * 1000.0);
+    log_comment(SINK_STDERR, "(summed across workers)\n");
+
+    for (size_t i = 0; i < stats->worker_count; ++i) {
+        const worker_stats_t *w = &stats->workers[i];
+        log_f(SINK_STDERR, "    %s worker %zu: busy %.3fms, idle %.3fms, %zu director%s, %zu file%s, %.2f MB\n",
+              BULLET, i, w->busy * 1000.0, w->idle * 1000.0, w->dirs, TO_PLURAL(w->dirs, "ies", "y"), w->files,
+              TO_PLURAL(w->files), (double)w->bytes_read / MB);
+    }
+
+    log_f(SINK_STDERR, "    %s skipped:", BULLET);
+    for (size_t i = 0; i < SKIP_COUNT; ++i) {
+        log_f(SINK_STDERR, "%s %s %zu", i == 0 ? "" : ",", get_skip_reason_name((skip_reason_t)i), scan->skipped[i]);
+    }
+    log_f(SINK_STDERR, "\n\n");
+
+    size_t first = STATS_LATENCY_BUCKETS;
+    size_t last = 0;
+    size_t peak = 0;
+    for (size_t i = 0; i < STATS_LATENCY_BUCKETS; ++i) {
+        if (scan->latency[i] == 0) {
+            continue;
+        }
+        if (first == STATS_LATENCY_BUCKETS) {
+            first = i;
+        }
+        last = i;
+        if (scan->latency[i] > peak) {
+            peak = scan->latency[i];
+        }
+    }
+
+    if (first < STATS_LATENCY_BUCKETS) {
+        log_info(SINK_STDERR, "[STATS]");
+        log_f(SINK_STDERR, " Per-file scan latency...\n");
+
+        for (size_t i = first; i <= last; ++i) {
+            char range[48];
+            if (i == 0) {
+                snprintf(range, sizeof(range), "<1us");
+            } else if (i == STATS_LATENCY_BUCKETS - 1) {
+                snprintf(range, sizeof(range), ">=%zuus", (size_t)1 << (i - 1));
+            } else {
+                snprintf(range, sizeof(range), "%zu-%zuus", (size_t)1 << (i - 1), (size_t)1 << i);
+            }
+
+            int bar = (int)((scan->latency[i] * 40 + peak - 1) / peak);
+            log_f(SINK_STDERR, "    %-12s %8zu ", range, scan->latency[i]);
+            log_comment(SINK_STDERR, "%.*s\n", bar, "########################################");
+        }
+
+        log_f(SINK_STDERR, "\n");
+    }
+
+    if (scan->slowest_count > 0) {
+        log_info(SINK_STDERR, "[STATS]");
+        log_f(SINK_STDERR, " Slowest file%s...\n", TO_PLURAL(scan->slowest_count));
+
+        for (size_t i = 0; i < scan->slowest_count; ++i) {
+            const file_latency_t *f = &scan->slowest[i];
+            log_f(SINK_STDERR, "    %s ", BULLET);
+            log_bold_info(SINK_STDERR, "%.3fms", f->seconds * 1000.0);
+            log_f(SINK_STDERR, " %s ", f->path);
+            log_comment(SINK_STDERR, "(%zu byte%s)\n", f->bytes, TO_PLURAL(f->bytes));
+        }
+
+        log_f(SINK_STDERR, "\n");
+    }
+}
+
+static void report_text_probes(const char *label, const probe_stats_t *p) {
+    log_f(SINK_STDERR, "    %s %s: %zu entr%s, %zu lookup%s, %zu probe%s (%.2f per lookup)\n", BULLET, label,
+          p->entries, TO_PLURAL(p->entries, "ies", "y"), p->lookups, TO_PLURAL(p->lookups), p->probes,
+          TO_PLURAL(p->probes), probes_per_lookup(p));
+}
+
+static void report_text(const stats_t *stats) {
+    report_text_phases(stats);
+    report_text_perf(stats);
+
+    if (stats->scan != NULL) {
+        report_text_scan(stats);
+    }
+
+    log_info(SINK_STDERR, "[STATS]");
+    log_f(SINK_STDERR, " Hash tables...\n");
+    if (stats->scan != NULL) {
+        report_text_probes("scan keys", &stats->scan_keys);
+    }
+    report_text_probes("env map", &stats->env_map);
+    log_f(SINK_STDERR, "\n");
+}
+
+// ---------------------------------------------------------------------------
+// json report (one object on a single line)
+// ---------------------------------------------------------------------------
+
+static void json_probes(const char *name, const probe_stats_t *p) {
+    fprintf(stderr, "\"%s\":{\"entries\":%zu,\"lookups\":%zu,\"probes\":%zu}", name, p->entries, p->lookups,
+            p->probes);
+}
+
+static void json_perf_counts(const perf_counts_t *p, size_t bytes) {
+    fputc('{', stderr);
+    for (size_t i = 0; i < PERF_COUNTER_COUNT; ++i) {
+        fprintf(stderr, "\"%s\":%" PRIu64 ",", get_perf_counter_name((perf_counter_t)i), p->counts[i]);
+    }
+    fprintf(stderr, "\"bytes\":%zu,\"ipc\":%.3f,\"instructions_per_byte\":%.3f}", bytes,
+            ratio(p->counts[PERF_INSTRUCTIONS], p->counts[PERF_CYCLES]), ratio(p->counts[PERF_INSTRUCTIONS], bytes));
+}
+
+static void json_perf(const stats_t *stats) {
+    fputs("\"perf\":{\"available\":", stderr);
+    if (!stats->perf_ok) {
+        fputs("false,\"error\":", stderr);
+        json_write_string(stderr, perf_unavailable_reason(stats));
+        fputs("},", stderr);
+        return;
+    }
+
+    fputs("true,\"phases\":{", stderr);
+    bool first = true;
+    for (size_t i = 0; i < PHASE_COUNT; ++i) {
+        if (!stats->perf_measured[i]) {
+            continue;
+        }
+        fprintf(stderr, "%s\"%s\":", first ? "" : ",", get_phase_name((phase_t)i));
+        json_perf_counts(&stats->perf[i], stats->bytes[i]);
+        first = false;
+    }
+    fputs("}},", stderr);
+}
+
+static void json_worker(const stats_t *stats, const worker_stats_t *w) {
+    fprintf(stderr,
+            "{\"dirs\":%zu,\"files\":%zu,\"bytes_read\":%zu,\"busy_ms\":%.3f,\"idle_ms\":%.3f,\"read_ms\":%.3f,"
+            "\"match_ms\":%.3f",
+            w->dirs, w->files, w->bytes_read, w->busy * 1000.0, w->idle * 1000.0, w->read * 1000.0,
+            w->match * 1000.0);
+    if (stats->perf_ok) {
+        fputs(",\"perf\":", stderr);
+        json_perf_counts(&w->perf, w->bytes_read);
+    }
+    fputc('}', stderr);
+}
+
+static void json_scan(const stats_t *stats) {
+    const scan_stats_t *scan = stats->scan;
+    const worker_stats_t *t = &scan->totals;
+    double wall = stats->phases[PHASE_SCAN];
+
+    fprintf(stderr,
+            "\"scan\":{\"dirs\":%zu,\"files\":%zu,\"bytes_read\":%zu,\"files_per_sec\":%.1f,\"mb_per_sec\":%.3f,"
+            "\"walk_ms\":%.3f,\"read_ms\":%.3f,\"match_ms\":%.3f,",
+            t->dirs, t->files, t->bytes_read, per_second((double)t->files, wall),
+            per_second((double)t->bytes_read / MB, wall), (t->busy - t->read - t->match) * 1000.0, t->read * 1000.0,
+            t->match * 1000.0);
+
+    fputs("\"skipped\":{", stderr);
+    for (size_t i = 0; i < SKIP_COUNT; ++i) {
+        fprintf(stderr, "%s\"%s\":%zu", i == 0 ? "" : ",", get_skip_reason_name((skip_reason_t)i), scan->skipped[i]);
+    }
+
+    fputs("},\"workers\":[", stderr);
+    for (size_t i = 0; i < stats->worker_count; ++i) {
+        if (i != 0) {
+            fputc(',', stderr);
+        }
+        json_worker(stats, &stats->workers[i]);
+    }
+
+    // histogram buckets keyed by their exclusive upper bound in microseconds (null for the
+    // open-ended last bucket)
+    fputs("],\"latency_us\":[", stderr);
+    for (size_t i = 0; i < STATS_LATENCY_BUCKETS; ++i) {
+        if (i != 0) {
+            fputc(',', stderr);
+        }
+        if (i == STATS_LATENCY_BUCKETS - 1) {
+            fprintf(stderr, "{\"lt\":null,\"count\":%zu}", scan->latency[i]);
+        } else {
+            fprintf(stderr, "{\"lt\":%zu,\"count\":%zu}", (size_t)1 << i, scan->latency[i]);
+        }
+    }
+
+    fputs("],\"slowest\":[", stderr);
+    for (size_t i = 0; i < scan->slowest_count; ++i) {
+        const file_latency_t *f = &scan->slowest[i];
+        fputs(i == 0 ? "{\"path\":" : ",{\"path\":", stderr);
+        json_write_string(stderr, f->path);
+        fprintf(stderr, ",\"bytes\":%zu,\"ms\":%.3f}", f->bytes, f->seconds * 1000.0);
+    }
+    fputs("]},", stderr);
+}
+
+static void report_json(const stats_t *stats) {
+    fputs("{\"phases_ms\":{", stderr);
+    for (size_t i = 0; i < PHASE_COUNT; ++i) {
+        fprintf(stderr, "\"%s\":%.3f,", get_phase_name((phase_t)i), stats->phases[i] * 1000.0);
+    }
+    fprintf(stderr, "\"total\":%.3f},", stats->total * 1000.0);
+    json_perf(stats);
+
+    if (stats->scan != NULL) {
+        json_scan(stats);
+    }
+
+    fputs("\"hash\":{", stderr);
+    if (stats->scan != NULL) {
+        json_probes("scan_keys", &stats->scan_keys);
+        fputc(',', stderr);
+    }
+    json_probes("env_map", &stats->env_map);
+    fputs("}}\n", stderr);
+}
+
+void report_stats(const stats_t *stats) {
+    switch (stats->format) {
+        case STATS_TEXT:
+            report_text(stats);
+            break;
+        case STATS_JSON:
+            report_json(stats);
+            break;
+        default:
+            break;
+    }
+}
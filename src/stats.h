@@ -0,0 +1,182 @@
+#ifndef STATS_H
+#define STATS_H
+
+#include "arena.h"
+#include "perf.h"
+#include <stdbool.h>
+#include <stddef.h>
+#include <string.h>
+
+// Run statistics for --stats: wall time per phase, scan throughput, per-worker busy/idle
+// time, skipped entries by reason, hash table probe counts and a per-file scan latency
+// histogram with the slowest files. Phase timings are always taken (a handful of clock
+// reads per run); the per-file scan measurements and hardware counters (see perf.h) only
+// when --stats is set.
+
+typedef enum { STATS_OFF, STATS_TEXT, STATS_JSON, STATS_UNKNOWN } stats_format_t;
+
+static inline const char *get_stats_format_name(const stats_format_t f) {
+    switch (f) {
+        case STATS_TEXT: {
+            return "text";
+        }
+        case STATS_JSON: {
+            return "json";
+        }
+        case STATS_OFF: {
+            return "off";
+        }
+        default:
+            return "unknown";
+    }
+}
+
+static inline stats_format_t get_stats_format(const char *arg) {
+    if (strcmp(arg, "text") == 0) {
+        return STATS_TEXT;
+    }
+
+    if (strcmp(arg, "json") == 0) {
+        return STATS_JSON;
+    }
+
+    return STATS_UNKNOWN;
+}
+
+typedef enum {
+    PHASE_CONFIG,
+    PHASE_ARGS,
+    PHASE_SCAN,
+    PHASE_TOKENIZE,
+    PHASE_PARSE,
+    PHASE_EMIT,
+    PHASE_COUNT
+} phase_t;
+
+typedef enum {
+    SKIP_HIDDEN,      // dot-prefixed entries
+    SKIP_BLACKLISTED, // build output and dependency directories (see is_blacklisted)
+    SKIP_IGNORED,     // entries matched by a .gitignore or .nviignore rule
+    SKIP_SPECIAL,     // links, sockets, devices
+    SKIP_EXTENSION,   // files without a scanned extension
+    SKIP_BINARY,      // the SNIFF_BINARY, SNIFF_MINIFIED and SNIFF_GENERATED files (see sniff.h)
+    SKIP_MINIFIED,
+    SKIP_GENERATED,
+    SKIP_UNREADABLE,
+    SKIP_EMPTY,
+    SKIP_COUNT
+} skip_reason_t;
+
+// bucket 0 counts scans under 1us; bucket i (i > 0) counts [2^(i-1), 2^i) us, and the last
+// bucket also takes everything slower
+#define STATS_LATENCY_BUCKETS 24
+#define STATS_SLOWEST 10
+
+typedef struct {
+    const char *path;
+    size_t bytes;
+    double seconds;
+} file_latency_t;
+
+typedef struct {
+    size_t dirs;
+    size_t files;
+    size_t bytes_read;
+    double busy;  // processing directories, including the files in them
+    double idle;  // waiting for a directory to be queued
+    double read;  // opening and reading files
+    double match; // matching accessors over file contents
+    perf_counts_t perf;
+} worker_stats_t;
+
+typedef struct {
+    worker_stats_t totals;
+    size_t skipped[SKIP_COUNT];
+    size_t latency[STATS_LATENCY_BUCKETS];
+    file_latency_t slowest[STATS_SLOWEST]; // sorted slowest first
+    size_t slowest_count;
+} scan_stats_t;
+
+typedef struct {
+    size_t entries;
+    size_t lookups;
+    size_t probes;
+} probe_stats_t;
+
+typedef struct {
+    stats_format_t format;
+    double phases[PHASE_COUNT];
+    double total;
+    const scan_stats_t *scan; // NULL when no scan ran
+    const worker_stats_t *workers;
+    size_t worker_count;
+    probe_stats_t scan_keys;
+    probe_stats_t env_map;
+    bool perf_ok;
+    const char *perf_error; // why the counters are unavailable, when !perf_ok
+    perf_counts_t perf[PHASE_COUNT];
+    bool perf_measured[PHASE_COUNT]; // config and args run before --stats is known
+    size_t bytes[PHASE_COUNT];       // input bytes per phase, for the per-KB figures
+} stats_t;
+
+static inline const char *get_phase_name(phase_t phase) {
+    switch (phase) {
+        case PHASE_CONFIG:
+            return "config";
+        case PHASE_ARGS:
+            return "args";
+        case PHASE_SCAN:
+            return "scan";
+        case PHASE_TOKENIZE:
+            return "tokenize";
+        case PHASE_PARSE:
+            return "parse";
+        case PHASE_EMIT:
+            return "emit";
+        case PHASE_COUNT:
+            break;
+    }
+
+    return "unknown";
+}
+
+static inline const char *get_skip_reason_name(skip_reason_t reason) {
+    switch (reason) {
+        case SKIP_HIDDEN:
+            return "hidden";
+        case SKIP_BLACKLISTED:
+            return "blacklisted";
+        case SKIP_IGNORED:
+            return "ignored";
+        case SKIP_SPECIAL:
+            return "special";
+        case SKIP_EXTENSION:
+            return "extension";
+        case SKIP_BINARY:
+            return "binary";
+        case SKIP_MINIFIED:
+            return "minified";
+        case SKIP_GENERATED:
+            return "generated";
+        case SKIP_UNREADABLE:
+            return "unreadable";
+        case SKIP_EMPTY:
+            return "empty";
+        case SKIP_COUNT:
+            break;
+    }
+
+    return "unknown";
+}
+
+size_t stats_latency_bucket(double seconds);
+
+// Records one scanned file; the path is copied into 'arena' only if it makes the slowest list
+void stats_record_file(arena_t *arena, scan_stats_t *stats, const char *path, size_t bytes, double seconds);
+
+// Adds src's counters, histogram and slowest files into dst (paths are copied into 'arena')
+void stats_merge(arena_t *arena, scan_stats_t *dst, const scan_stats_t *src);
+
+void report_stats(const stats_t *stats);
+
+#endif // STATS_H
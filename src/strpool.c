@@ -0,0 +1,72 @@
+#include "strpool.h"
+#include "arena.h"
+#include "dynarr.h"
+#include "hash.h"
+#include <string.h>
+
+#define STRPOOL_INIT_CAP 16
+
+// Load factor capped at 0.7, as in hashmap.c
+static void strpool_grow(arena_t *arena, strpool_t *pool, size_t need) {
+    size_t new_cap = pool->capacity == 0 ? STRPOOL_INIT_CAP : pool->capacity;
+    while (new_cap * 7 < (pool->count + need) * 10) {
+        new_cap *= 2;
+    }
+
+    if (new_cap == pool->capacity) {
+        return;
+    }
+
+    strpool_slot_t *new_slots = arena_alloc_zeroed(arena, new_cap * sizeof(*new_slots));
+
+    size_t mask = new_cap - 1;
+    for (size_t i = 0; i < pool->capacity; ++i) {
+        if (pool->slots[i].offset == 0) {
+            continue;
+        }
+
+        size_t j = pool->slots[i].hash & mask;
+        while (new_slots[j].offset != 0) {
+            j = (j + 1) & mask;
+        }
+
+        new_slots[j] = pool->slots[i];
+    }
+
+    pool->slots = new_slots;
+    pool->capacity = new_cap;
+}
+
+void strpool_reserve(arena_t *arena, strpool_t *pool, size_t bytes, size_t strings) {
+    strpool_grow(arena, pool, strings);
+
+    if (pool->bytes.count + bytes > pool->bytes.capacity) {
+        size_t new_cap = pool->bytes.count + bytes;
+        pool->bytes.items = arena_extend(arena, pool->bytes.items, pool->bytes.capacity, new_cap);
+        pool->bytes.capacity = new_cap;
+    }
+}
+
+size_t strpool_intern(arena_t *arena, strpool_t *pool, const char *s, size_t len) {
+    strpool_grow(arena, pool, 1);
+
+    uint64_t hash = fnv1a(s, len);
+    size_t mask = pool->capacity - 1;
+    size_t i = hash & mask;
+
+    while (pool->slots[i].offset != 0) {
+        const strpool_slot_t *slot = &pool->slots[i];
+        if (slot->hash == hash && slot->len == len && memcmp(pool->bytes.items + slot->offset - 1, s, len) == 0) {
+            return slot->offset - 1;
+        }
+        i = (i + 1) & mask;
+    }
+
+    size_t offset = pool->bytes.count;
+    DYN_ARR_APPEND_MANY(arena, &pool->bytes, s, len);
+    DYN_ARR_APPEND(arena, &pool->bytes, '\0');
+
+    pool->slots[i] = (strpool_slot_t){.hash = hash, .offset = offset + 1, .len = len};
+    ++pool->count;
+    return offset;
+}
@@ -0,0 +1,38 @@
+#ifndef STRPOOL_H
+#define STRPOOL_H
+
+#include "arena.h"
+#include "buf.h"
+#include <stddef.h>
+#include <stdint.h>
+
+// An append-only pool of NUL-terminated strings in one contiguous buffer, addressed by
+// (offset, len). Identical strings are interned, so each distinct one is stored once.
+//
+// The buffer moves as it grows, so hold offsets while interning and only turn them into
+// pointers (strpool_at) once the pool is done growing. That's also why the index is its own
+// linear probing table of offsets rather than a hashmap_t, which borrows key pointers.
+typedef struct {
+    uint64_t hash;
+    size_t offset; // plus one, so a zeroed slot is empty
+    size_t len;
+} strpool_slot_t;
+
+typedef struct {
+    buf_t bytes;
+    strpool_slot_t *slots;
+    size_t capacity;
+    size_t count;
+} strpool_t;
+
+// Makes room for 'bytes' more bytes of strings and 'strings' more distinct strings, so a
+// caller that can estimate them skips the copies of growing
+void strpool_reserve(arena_t *arena, strpool_t *pool, size_t bytes, size_t strings);
+
+// Returns the offset of a copy of the 'len' bytes at 's', appending one if the pool has none.
+// 's' must not point into the pool.
+size_t strpool_intern(arena_t *arena, strpool_t *pool, const char *s, size_t len);
+
+static inline const char *strpool_at(const strpool_t *pool, size_t offset) { return pool->bytes.items + offset; }
+
+#endif // STRPOOL_H
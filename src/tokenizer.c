@@ -57,34 +57,36 @@ static void report_tokenizer_summary(const args_t *args, const tokenizer_t *toke
     log_fi(SINK_STDERR, ".env");
     log_f(SINK_STDERR, " file%s...\n", TO_PLURAL(args->files.count));
 
-    for (size_t ti = 0; ti < tokenizer->tokens.count; ++ti) {
-        const token_t *token = &tokenizer->tokens.items[ti];
+    const token_list_t *tokens = &tokenizer->tokens;
+    for (size_t ti = 0; ti < tokens->count; ++ti) {
+        const char *key = token_key(tokens, ti);
+        size_t first = tokens->first_values[ti];
+        size_t end = first + tokens->value_counts[ti];
 
         log_info(SINK_STDERR, "\n[INFO]");
         log_f(SINK_STDERR, " Token #%zu\n", ti + 1);
         log_f(SINK_STDERR, "    %s file: ", BULLET);
-        log_fi(SINK_STDERR, "%s", token->file);
+        log_fi(SINK_STDERR, "%s", token_file(tokens, ti));
         log_f(SINK_STDERR, "\n");
         log_f(SINK_STDERR, "    %s key: ", BULLET);
-        log_bold_info(SINK_STDERR, "%s \n", token->key ? token->key : "(none)");
-        log_f(SINK_STDERR, "    %s value%s:", BULLET, TO_PLURAL(token->values.count));
+        log_bold_info(SINK_STDERR, "%s \n", key ? key : "(none)");
+        log_f(SINK_STDERR, "    %s value%s:", BULLET, TO_PLURAL(tokens->value_counts[ti]));
 
-        for (size_t vi = 0; vi < token->values.count; ++vi) {
-            const value_token_t *v = &token->values.items[vi];
-            bool is_last_value_token = vi == token->values.count - 1;
+        for (size_t v = first; v < end; ++v) {
+            bool is_last_value_token = v == end - 1;
             const char *sub_stem_sym = is_last_value_token ? TREE_END : TREE_BRANCH;
 
             log_f(SINK_STDERR, "\n      %s%s ", sub_stem_sym, TREE_RUNG);
-            log_info(SINK_STDERR, "%s: ", get_value_kind_name(v->kind));
+            log_info(SINK_STDERR, "%s: ", get_value_kind_name((value_kind_t)tokens->kinds[v]));
             if (args->reveal) {
-                log_f(SINK_STDERR, "%.*s", (int)v->value_len, v->value);
+                log_f(SINK_STDERR, "%.*s", (int)tokens->lens[v], token_value(tokens, ti, v));
             } else {
                 log_f(SINK_STDERR, "*****");
             }
-            log_comment(SINK_STDERR, " [%zu:%zu]", v->line, v->byte);
+            log_comment(SINK_STDERR, " [%zu:%zu]", (size_t)tokens->lines[v], (size_t)tokens->bytes[v]);
         }
 
-        if (ti != tokenizer->tokens.count - 1) {
+        if (ti != tokens->count - 1) {
             log_f(SINK_STDERR, "\n");
         }
     }
@@ -94,23 +96,28 @@ static void report_tokenizer_summary(const args_t *args, const tokenizer_t *toke
 
 static void report_value(const char *s, size_t len, bool reveal) {
     if (reveal) {
-        fwrite(s, 1, len, stderr);
+        fwrite(s, 1, len, diag_stream());
         return;
     }
 
-    fput_repeat(stderr, '*', len);
+    fput_repeat(diag_stream(), '*', len);
 }
 
-static size_t report_token_line(const token_t *token, bool reveal) {
-    const char *key = token->key ? token->key : "(none)";
+// the key of the token being built
+static const char *pending_key(const tokenizer_t *tokenizer) {
+    return tokenizer->key != NO_KEY ? tokenizer->pool.items + tokenizer->key : "(none)";
+}
+
+static size_t report_token_line(const tokenizer_t *tokenizer) {
+    const char *key = pending_key(tokenizer);
     log_f(SINK_STDERR, "   %s=", key);
 
+    const token_list_t *tokens = &tokenizer->tokens;
     size_t prefix_len = strlen(key) + 1;
-    for (size_t k = 0; k < token->values.count; ++k) {
-        const value_token_t *v = &token->values.items[k];
-        if (v->kind == LITERAL_VALUE) {
-            report_value(v->value, v->value_len, reveal);
-            prefix_len += v->value_len;
+    for (size_t v = tokenizer->first_value; v < tokens->value_count; ++v) {
+        if (tokens->kinds[v] == LITERAL_VALUE) {
+            report_value(tokenizer->pool.items + tokens->offsets[v], tokens->lens[v], tokenizer->reveal);
+            prefix_len += tokens->lens[v];
         }
     }
 
@@ -119,32 +126,32 @@ static size_t report_token_line(const token_t *token, bool reveal) {
 
 static void report_token_error(const tokenizer_t *tokenizer) {
     log_error(SINK_STDERR, "[ERROR] A tokenizing error occurred in %s:%zu:%zu. ", tokenizer->file_name, tokenizer->line,
-              tokenizer->byte);
+              tokenizer->i - tokenizer->line_start + 1);
 }
 
 static void report_token_error_at(size_t pad, size_t tildes, const char *hint_fmt, ...) {
     log_f(SINK_STDERR, "   ");
-    fput_repeat(stderr, ' ', pad);
-    fputc('^', stderr);
-    fput_repeat(stderr, '~', tildes);
-    fputc(' ', stderr);
+    fput_repeat(diag_stream(), ' ', pad);
+    fputc('^', diag_stream());
+    fput_repeat(diag_stream(), '~', tildes);
+    fputc(' ', diag_stream());
 
     va_list args;
     va_start(args, hint_fmt);
-    vfprintf(stderr, hint_fmt, args);
+    vfprintf(diag_stream(), hint_fmt, args);
     va_end(args);
 
-    fputc('\n', stderr);
+    fputc('\n', diag_stream());
 }
 
-static result_t report_quote_error(const tokenizer_t *tokenizer, const token_t *token, const buf_t *value, char quote) {
+static result_t report_quote_error(const tokenizer_t *tokenizer, const buf_t *value, char quote) {
     report_token_error(tokenizer);
-    log_error(SINK_STDERR, "The %s key has an unterminated quoted value.\n", token->key ? token->key : "(none)");
+    log_error(SINK_STDERR, "The %s key has an unterminated quoted value.\n", pending_key(tokenizer));
 
-    size_t prefix_len = report_token_line(token, tokenizer->reveal);
-    fputc(quote, stderr);
+    size_t prefix_len = report_token_line(tokenizer);
+    fputc(quote, diag_stream());
     report_value(value->items, value->count, tokenizer->reveal);
-    fputc('\n', stderr);
+    fputc('\n', diag_stream());
     report_token_error_at(prefix_len, value->count, "(missing a closing quote %c)", quote);
 
     return OPERATION_FAILURE;
@@ -169,10 +176,10 @@ static result_t report_missing_key_error(const tokenizer_t *tokenizer) {
 
     log_f(SINK_STDERR, "   ");
     if (rest_len > 0) {
-        fputc(rest[0], stderr);
+        fputc(rest[0], diag_stream());
         report_value(rest + 1, rest_len - 1, tokenizer->reveal);
     }
-    fputc('\n', stderr);
+    fputc('\n', diag_stream());
     report_token_error_at(0, rest_len > 1 ? rest_len - 1 : 0, "(missing key)");
 
     return OPERATION_FAILURE;
@@ -188,35 +195,33 @@ static result_t report_invalid_key_error(const tokenizer_t *tokenizer, const cha
     return OPERATION_FAILURE;
 }
 
-static result_t report_unterminated_interpolation_error(const tokenizer_t *tokenizer, const token_t *token,
-                                                        const buf_t *value) {
+static result_t report_unterminated_interpolation_error(const tokenizer_t *tokenizer, const buf_t *value) {
     report_token_error(tokenizer);
-    log_error(SINK_STDERR, "The %s key has an unterminated value interpolation.\n", token->key ? token->key : "(none)");
+    log_error(SINK_STDERR, "The %s key has an unterminated value interpolation.\n", pending_key(tokenizer));
 
-    size_t prefix_len = report_token_line(token, tokenizer->reveal);
+    size_t prefix_len = report_token_line(tokenizer);
     log_f(SINK_STDERR, "${%.*s\n", (int)value->count, value->items);
     report_token_error_at(prefix_len + 1, value->count, "(missing a closing brace '}')");
 
     return OPERATION_FAILURE;
 }
 
-static result_t report_empty_interpolation_error(const tokenizer_t *tokenizer, const token_t *token) {
+static result_t report_empty_interpolation_error(const tokenizer_t *tokenizer) {
     report_token_error(tokenizer);
-    log_error(SINK_STDERR, "The %s key has an undefined key interpolation.\n", token->key ? token->key : "(none)");
+    log_error(SINK_STDERR, "The %s key has an undefined key interpolation.\n", pending_key(tokenizer));
 
-    size_t prefix_len = report_token_line(token, tokenizer->reveal);
+    size_t prefix_len = report_token_line(tokenizer);
     log_f(SINK_STDERR, "${}\n");
     report_token_error_at(prefix_len + 1, 1, "(unresolvable interpolation key)");
 
     return OPERATION_FAILURE;
 }
 
-static result_t report_trailing_chars_error(const tokenizer_t *tokenizer, const token_t *token) {
+static result_t report_trailing_chars_error(const tokenizer_t *tokenizer) {
     report_token_error(tokenizer);
-    log_error(SINK_STDERR, "The %s key has unexpected characters after a closing quote.\n",
-              token->key ? token->key : "(none)");
+    log_error(SINK_STDERR, "The %s key has unexpected characters after a closing quote.\n", pending_key(tokenizer));
 
-    size_t line_start = tokenizer->i - (tokenizer->byte - 1);
+    size_t line_start = tokenizer->line_start;
 
     size_t line_end = index_of_scalar(tokenizer->file, tokenizer->file_len, tokenizer->i, LINE_DELIMITER);
     if (line_end > line_start && tokenizer->file[line_end - 1] == CARRIAGE_RETURN) {
@@ -233,7 +238,7 @@ static result_t report_trailing_chars_error(const tokenizer_t *tokenizer, const
 
     log_f(SINK_STDERR, "   %.*s", (int)visible_len, line);
     report_value(line + visible_len, line_len - visible_len, tokenizer->reveal);
-    fputc('\n', stderr);
+    fputc('\n', diag_stream());
     report_token_error_at(caret_col, rest_len > 1 ? rest_len - 1 : 0, "(only whitespace may follow a closing quote)");
 
     return OPERATION_FAILURE;
@@ -263,10 +268,7 @@ static const size_t STOP_NL_LEN = ARR_LEN(STOP_NL);
 static const unsigned char STOP_BRACE_NL[] = {NULL_CHAR, CLOSE_BRACE, LINE_DELIMITER, CARRIAGE_RETURN};
 static const size_t STOP_BRACE_NL_LEN = ARR_LEN(STOP_BRACE_NL);
 
-static void skip_byte(tokenizer_t *tokenizer, size_t offset) {
-    tokenizer->byte += offset;
-    tokenizer->i += offset;
-}
+static void skip_byte(tokenizer_t *tokenizer, size_t offset) { tokenizer->i += offset; }
 
 static int peek(const tokenizer_t *tokenizer, size_t offset) {
     size_t index = tokenizer->i + offset;
@@ -292,49 +294,140 @@ static void scan_until(arena_t *scratch, tokenizer_t *tokenizer, buf_t *value, c
 
     DYN_ARR_APPEND_MANY(scratch, value, tokenizer->file + tokenizer->i, end - tokenizer->i);
 
-    tokenizer->byte += end - tokenizer->i;
     tokenizer->i = end;
 }
 
-static void commit_token(arena_t *arena, value_kind_t kind, tokenizer_t *tokenizer, token_t *token,
-                         const buf_t *value) {
-    char *copy = arena_alloc(arena, value->count + 1);
+// Keys and values are packed back to back, each NUL terminated, into the file's pool instead
+// of being allocated one by one, which would pad every one of them to ARENA_ALIGNMENT
+static uint32_t pool_copy(tokenizer_t *tokenizer, const char *bytes, size_t len) {
+    buf_t *pool = &tokenizer->pool;
+    uint32_t offset = (uint32_t)pool->count;
+    DYN_ARR_APPEND_MANY(pool->arena, pool, bytes, len);
+    DYN_ARR_APPEND(pool->arena, pool, '\0');
+    return offset;
+}
 
-    if (value->count > 0) {
-        memcpy(copy, value->items, value->count);
+static void *grow_array(arena_t *arena, void *items, size_t item_size, size_t capacity, size_t new_capacity) {
+    return arena_extend(arena, items, capacity * item_size, new_capacity * item_size);
+}
+
+static size_t grown_capacity(size_t capacity, size_t needed) {
+    size_t new_capacity = capacity == 0 ? DYN_ARR_INIT_CAP : capacity;
+    while (new_capacity < needed) {
+        new_capacity *= 2;
     }
-    copy[value->count] = '\0';
+    return new_capacity;
+}
 
-    value_token_t vt = {
-        .value = copy,
-        .value_len = value->count,
-        .kind = kind,
-        .line = tokenizer->line,
-        .byte = tokenizer->byte,
-    };
+// makes room for 'n' more tokens, growing every per-token array together
+static void reserve_tokens(arena_t *arena, token_list_t *tokens, size_t n) {
+    if (tokens->count + n <= tokens->capacity) {
+        return;
+    }
 
-    DYN_ARR_APPEND(arena, &token->values, vt);
+    size_t cap = tokens->capacity;
+    size_t new_cap = grown_capacity(cap, tokens->count + n);
+    tokens->keys = grow_array(arena, tokens->keys, sizeof(*tokens->keys), cap, new_cap);
+    tokens->file_indexes = grow_array(arena, tokens->file_indexes, sizeof(*tokens->file_indexes), cap, new_cap);
+    tokens->first_values = grow_array(arena, tokens->first_values, sizeof(*tokens->first_values), cap, new_cap);
+    tokens->value_counts = grow_array(arena, tokens->value_counts, sizeof(*tokens->value_counts), cap, new_cap);
+    tokens->capacity = new_cap;
 }
 
-static void append_token(arena_t *arena, tokenizer_t *tokenizer, token_t *token) {
-    DYN_ARR_APPEND(arena, &tokenizer->tokens, *token);
-    *token = (token_t){.file = tokenizer->file_name};
+// makes room for 'n' more values, growing every per-value array together
+static void reserve_values(arena_t *arena, token_list_t *tokens, size_t n) {
+    if (tokens->value_count + n <= tokens->value_capacity) {
+        return;
+    }
+
+    size_t cap = tokens->value_capacity;
+    size_t new_cap = grown_capacity(cap, tokens->value_count + n);
+    tokens->kinds = grow_array(arena, tokens->kinds, sizeof(*tokens->kinds), cap, new_cap);
+    tokens->offsets = grow_array(arena, tokens->offsets, sizeof(*tokens->offsets), cap, new_cap);
+    tokens->lens = grow_array(arena, tokens->lens, sizeof(*tokens->lens), cap, new_cap);
+    tokens->lines = grow_array(arena, tokens->lines, sizeof(*tokens->lines), cap, new_cap);
+    tokens->bytes = grow_array(arena, tokens->bytes, sizeof(*tokens->bytes), cap, new_cap);
+    tokens->value_capacity = new_cap;
 }
 
-static result_t validate_and_append_token(arena_t *arena, tokenizer_t *tokenizer, token_t *token, buf_t *value,
-                                          bool allow_empty) {
-    if (value->count > 0 || token->values.count == 0) {
-        commit_token(arena, LITERAL_VALUE, tokenizer, token, value);
+result_t token_list_append(arena_t *arena, token_list_t *dst, const token_list_t *src) {
+    // first values and file indexes are 32-bit too
+    if (src->value_count > UINT32_MAX - dst->value_count || src->files.count > UINT32_MAX - dst->files.count) {
+        return operation_error("The .env files have too many tokens to parse together; aborting.\n");
+    }
+
+    reserve_tokens(arena, dst, src->count);
+    reserve_values(arena, dst, src->value_count);
+
+    uint32_t file_base = (uint32_t)dst->files.count;
+    uint32_t value_base = (uint32_t)dst->value_count;
+    size_t t0 = dst->count;
+    for (size_t t = 0; t < src->count; ++t) {
+        dst->file_indexes[t0 + t] = src->file_indexes[t] + file_base;
+        dst->first_values[t0 + t] = src->first_values[t] + value_base;
+    }
+    if (src->count > 0) {
+        memcpy(dst->keys + t0, src->keys, src->count * sizeof(*src->keys));
+        memcpy(dst->value_counts + t0, src->value_counts, src->count * sizeof(*src->value_counts));
+    }
+    dst->count += src->count;
+
+    size_t v0 = dst->value_count;
+    if (src->value_count > 0) {
+        memcpy(dst->kinds + v0, src->kinds, src->value_count * sizeof(*src->kinds));
+        memcpy(dst->offsets + v0, src->offsets, src->value_count * sizeof(*src->offsets));
+        memcpy(dst->lens + v0, src->lens, src->value_count * sizeof(*src->lens));
+        memcpy(dst->lines + v0, src->lines, src->value_count * sizeof(*src->lines));
+        memcpy(dst->bytes + v0, src->bytes, src->value_count * sizeof(*src->bytes));
+    }
+    dst->value_count += src->value_count;
+
+    DYN_ARR_APPEND_MANY(arena, &dst->files, src->files.items, src->files.count);
+    return RESULT_OK;
+}
+
+// adds a value to the token being built
+static void commit_value(arena_t *arena, value_kind_t kind, tokenizer_t *tokenizer, const buf_t *value) {
+    token_list_t *tokens = &tokenizer->tokens;
+    reserve_values(arena, tokens, 1);
+
+    size_t v = tokens->value_count++;
+    tokens->kinds[v] = (uint8_t)kind;
+    tokens->offsets[v] = pool_copy(tokenizer, value->items, value->count);
+    tokens->lens[v] = (uint32_t)value->count;
+    tokens->lines[v] = (uint32_t)tokenizer->line;
+    tokens->bytes[v] = (uint32_t)(tokenizer->i - tokenizer->line_start + 1);
+}
+
+static void append_token(arena_t *arena, tokenizer_t *tokenizer) {
+    token_list_t *tokens = &tokenizer->tokens;
+    reserve_tokens(arena, tokens, 1);
+
+    size_t t = tokens->count++;
+    tokens->keys[t] = tokenizer->key;
+    tokens->file_indexes[t] = (uint32_t)(tokens->files.count - 1);
+    tokens->first_values[t] = (uint32_t)tokenizer->first_value;
+    tokens->value_counts[t] = (uint32_t)(tokens->value_count - tokenizer->first_value);
+
+    // the next token starts with the next value
+    tokenizer->key = NO_KEY;
+    tokenizer->first_value = tokens->value_count;
+}
+
+static result_t validate_and_append_token(arena_t *arena, tokenizer_t *tokenizer, buf_t *value, bool allow_empty) {
+    const token_list_t *tokens = &tokenizer->tokens;
+    if (value->count > 0 || tokens->value_count == tokenizer->first_value) {
+        commit_value(arena, LITERAL_VALUE, tokenizer, value);
     }
 
     value->count = 0;
 
-    if (!allow_empty &&
-        (token->values.count == 0 || (token->values.count == 1 && token->values.items[0].value_len == 0))) {
-        return report_empty_value_error(tokenizer, token->key);
+    size_t value_count = tokens->value_count - tokenizer->first_value;
+    if (!allow_empty && (value_count == 0 || (value_count == 1 && tokens->lens[tokenizer->first_value] == 0))) {
+        return report_empty_value_error(tokenizer, pending_key(tokenizer));
     }
 
-    append_token(arena, tokenizer, token);
+    append_token(arena, tokenizer);
 
     return RESULT_OK;
 }
@@ -345,19 +438,39 @@ result_t generate_tokens(arena_t *main_arena, arena_t *scratch, const args_t *ar
     tokenizer->file = file->contents;
     tokenizer->file_len = file->len;
     tokenizer->i = 0;
-    tokenizer->byte = 1;
     tokenizer->line = 1;
+    tokenizer->line_start = 0;
     tokenizer->reveal = args->reveal;
 
+    // token positions are 32-bit; open_file already skips anything larger
+    if (file->len > MAX_FILE_SIZE) {
+        return operation_error("The '%s' file exceeds %zu bytes; aborting.\n", file->path, MAX_FILE_SIZE);
+    }
+
+    // a file has at most one value per byte (and one more at its end), and value indexes are 32-bit
+    token_list_t *tokens = &tokenizer->tokens;
+    if (tokens->value_count > UINT32_MAX - file->len - 1) {
+        return operation_error("The .env files have too many tokens to parse together; aborting.\n");
+    }
+
+    // the pool rarely outgrows the file: the quotes, '=' and "${}" are dropped, and a NUL takes the
+    // place of the delimiter after each key and value
+    tokenizer->pool = (buf_t){.arena = scratch, .capacity = file->len + 1};
+    tokenizer->pool.items = arena_alloc(scratch, tokenizer->pool.capacity);
+    tokenizer->key = NO_KEY;
+    tokenizer->first_value = tokens->value_count;
+    token_file_t token_file = {.path = file->path};
+    DYN_ARR_APPEND(main_arena, &tokens->files, token_file);
+
     // skip a UTF-8 BOM so it doesn't become part of the first key
     if (tokenizer->file_len >= 3 && memcmp(tokenizer->file, "\xEF\xBB\xBF", 3) == 0) {
         tokenizer->i = 3;
+        tokenizer->line_start = 3;
     }
 
     report_tokenizing_file(args, file->path);
 
-    size_t prev_token_count = tokenizer->tokens.count;
-    token_t token = {.file = tokenizer->file_name};
+    size_t prev_token_count = tokens->count;
     buf_t value = {.arena = scratch};
     result_t result = RESULT_OK;
 
@@ -387,12 +500,12 @@ result_t generate_tokens(arena_t *main_arena, arena_t *scratch, const args_t *ar
             }
             case LINE_DELIMITER: {
                 if (quote != 0) {
-                    result = report_quote_error(tokenizer, &token, &value, quote);
+                    result = report_quote_error(tokenizer, &value, quote);
                     goto done;
                 }
 
-                if (token.key != NULL) {
-                    result = validate_and_append_token(main_arena, tokenizer, &token, &value, quoted);
+                if (tokenizer->key != NO_KEY) {
+                    result = validate_and_append_token(main_arena, tokenizer, &value, quoted);
                     if (!result.ok) {
                         goto done;
                     }
@@ -403,12 +516,12 @@ result_t generate_tokens(arena_t *main_arena, arena_t *scratch, const args_t *ar
                 value.count = 0;
                 ++tokenizer->line;
                 skip_byte(tokenizer, 1);
-                tokenizer->byte = 1;
+                tokenizer->line_start = tokenizer->i;
                 break;
             }
             case ASSIGN_OP: {
                 // '=' inside a value is literal
-                if (token.key != NULL) {
+                if (tokenizer->key != NO_KEY) {
                     commit_byte(scratch, tokenizer, &value);
                     continue;
                 }
@@ -443,7 +556,7 @@ result_t generate_tokens(arena_t *main_arena, arena_t *scratch, const args_t *ar
                     goto done;
                 }
 
-                token.key = arena_strndup(main_arena, value.items + start, end - start);
+                tokenizer->key = pool_copy(tokenizer, value.items + start, end - start);
 
                 value.count = 0;
                 // skip '='
@@ -463,15 +576,15 @@ result_t generate_tokens(arena_t *main_arena, arena_t *scratch, const args_t *ar
             }
             case HASH:
                 // commit literal hash
-                if (token.key != NULL) {
+                if (tokenizer->key != NO_KEY) {
                     commit_byte(scratch, tokenizer, &value);
                     continue;
                 }
 
                 scan_until(scratch, tokenizer, &value, STOP_NL, STOP_NL_LEN);
 
-                commit_token(main_arena, COMMENTED_LINE, tokenizer, &token, &value);
-                append_token(main_arena, tokenizer, &token);
+                commit_value(main_arena, COMMENTED_LINE, tokenizer, &value);
+                append_token(main_arena, tokenizer);
                 value.count = 0;
                 break;
             case DOLLAR_SIGN: {
@@ -484,7 +597,7 @@ result_t generate_tokens(arena_t *main_arena, arena_t *scratch, const args_t *ar
 
                 // commit anything accumulated before the "${"
                 if (value.count != 0) {
-                    commit_token(main_arena, LITERAL_VALUE, tokenizer, &token, &value);
+                    commit_value(main_arena, LITERAL_VALUE, tokenizer, &value);
                     value.count = 0;
                 }
 
@@ -494,7 +607,7 @@ result_t generate_tokens(arena_t *main_arena, arena_t *scratch, const args_t *ar
                 scan_until(scratch, tokenizer, &value, STOP_BRACE_NL, STOP_BRACE_NL_LEN);
 
                 if (peek(tokenizer, 0) != CLOSE_BRACE) {
-                    result = report_unterminated_interpolation_error(tokenizer, &token, &value);
+                    result = report_unterminated_interpolation_error(tokenizer, &value);
                     goto done;
                 }
 
@@ -502,11 +615,11 @@ result_t generate_tokens(arena_t *main_arena, arena_t *scratch, const args_t *ar
                 skip_byte(tokenizer, 1);
 
                 if (value.count == 0) {
-                    result = report_empty_interpolation_error(tokenizer, &token);
+                    result = report_empty_interpolation_error(tokenizer);
                     goto done;
                 }
 
-                commit_token(main_arena, INTERPOLATED_KEY, tokenizer, &token, &value);
+                commit_value(main_arena, INTERPOLATED_KEY, tokenizer, &value);
                 value.count = 0;
                 break;
             }
@@ -527,14 +640,14 @@ result_t generate_tokens(arena_t *main_arena, arena_t *scratch, const args_t *ar
                 // the same token, so '$', '#', and '=' on continuation lines are
                 // handled normally by the main loop
                 if (value.count != 0) {
-                    commit_token(main_arena, LITERAL_VALUE, tokenizer, &token, &value);
+                    commit_value(main_arena, LITERAL_VALUE, tokenizer, &value);
                 }
 
                 value.count = 0;
                 // skip "\\\n" (or "\\\r\n")
                 skip_byte(tokenizer, crlf ? 3 : 2);
                 ++tokenizer->line;
-                tokenizer->byte = 1;
+                tokenizer->line_start = tokenizer->i;
                 break;
             }
             case DOUBLE_QUOTE:
@@ -555,7 +668,7 @@ result_t generate_tokens(arena_t *main_arena, arena_t *scratch, const args_t *ar
                 bool trailing_crlf = next_char == CARRIAGE_RETURN && peek(tokenizer, 1) == LINE_DELIMITER;
                 bool is_end_of_line = next_char == LINE_DELIMITER;
                 if (next_char != -1 && !is_end_of_line && !trailing_crlf) {
-                    result = report_trailing_chars_error(tokenizer, &token);
+                    result = report_trailing_chars_error(tokenizer);
                     goto done;
                 }
                 break;
@@ -580,16 +693,16 @@ result_t generate_tokens(arena_t *main_arena, arena_t *scratch, const args_t *ar
 
     // a quote may still be open at end-of-file
     if (quote != 0) {
-        result = report_quote_error(tokenizer, &token, &value, quote);
+        result = report_quote_error(tokenizer, &value, quote);
         goto done;
     }
 
     // flush a pending token if the file doesn't end with a newline
-    if (token.key != NULL) {
-        result = validate_and_append_token(main_arena, tokenizer, &token, &value, quoted);
+    if (tokenizer->key != NO_KEY) {
+        result = validate_and_append_token(main_arena, tokenizer, &value, quoted);
     }
 
-    if (tokenizer->tokens.count == prev_token_count) {
+    if (tokens->count == prev_token_count) {
         log_error(SINK_STDERR,
                   "[ERROR] Unable to generate tokens for %s. Ensure the .env file is valid by following the KEY=VALUE "
                   "spec; aborting.",
@@ -600,6 +713,40 @@ result_t generate_tokens(arena_t *main_arena, arena_t *scratch, const args_t *ar
     }
 
 done:
+    // values left on a line that never became a token are dropped, and the kept ones move to
+    // the main arena with the pool
+    tokens->value_count = tokenizer->first_value;
+    tokens->files.items[tokens->files.count - 1].pool = arena_memdup(main_arena, tokenizer->pool.items,
+                                                                    tokenizer->pool.count);
+    tokenizer->pool = (buf_t){0};
+    return result;
+}
+
+result_t read_env_file(arena_t *scratch, const char *path, file_details_t *file) {
+    *file = open_file(scratch, path);
+    if (file->contents == NULL) {
+        return OPERATION_FAILURE;
+    }
+
+    if (file->len == 0) {
+        return operation_error("The '%s' file is empty; expected at least one KEY=VALUE assignment.\n", path);
+    }
+
+    return RESULT_OK;
+}
+
+result_t tokenize_file(arena_t *main_arena, arena_t *scratch, const args_t *args, const char *path,
+                       tokenizer_t *tokenizer) {
+    file_details_t file;
+    result_t result = read_env_file(scratch, path, &file);
+    if (!result.ok) {
+        return result;
+    }
+
+    tokenizer->bytes_read += file.len;
+    result = generate_tokens(main_arena, scratch, args, &file, tokenizer);
+    tokenizer->file = NULL;
+
     return result;
 }
 
@@ -616,21 +763,7 @@ result_t run_tokenizer(arena_t *main_arena, const args_t *args, tokenizer_t *tok
     arena_t scratch = {0};
 
     for (size_t fi = 0; fi < args->files.count; ++fi) {
-        const char *path = args->files.items[fi];
-
-        file_details_t file = open_file(&scratch, path);
-        if (file.contents == NULL) {
-            arena_free(&scratch);
-            return OPERATION_FAILURE;
-        }
-
-        if (file.len == 0) {
-            arena_free(&scratch);
-            return operation_error("The '%s' file is empty; expected at least one KEY=VALUE assignment.\n", path);
-        }
-
-        result = generate_tokens(main_arena, &scratch, args, &file, tokenizer);
-        tokenizer->file = NULL;
+        result = tokenize_file(main_arena, &scratch, args, args->files.items[fi], tokenizer);
         arena_reset(&scratch);
 
         if (!result.ok) {
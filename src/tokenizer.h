@@ -3,10 +3,12 @@
 
 #include "arena.h"
 #include "arg.h"
+#include "buf.h"
 #include "file.h"
 #include "result.h"
 #include <stdbool.h>
 #include <stddef.h>
+#include <stdint.h>
 
 // The tokenizer is responsible for converting .env files into value tokens the parser can
 // understand. It also does a little bit of syntax checking to ensure ENV keys aren't missing
@@ -15,43 +17,80 @@
 
 typedef enum { LITERAL_VALUE, COMMENTED_LINE, INTERPOLATED_KEY } value_kind_t;
 
+#define NO_KEY UINT32_MAX
+
+// A tokenized file: its name, and the pool its tokens' keys and values are packed into, back
+// to back and each NUL terminated
 typedef struct {
-    char *value;
-    size_t value_len;
-    value_kind_t kind;
-    size_t line;
-    size_t byte;
-} value_token_t;
+    const char *path;
+    const char *pool;
+} token_file_t;
 
 typedef struct {
-    value_token_t *items;
+    token_file_t *items;
     size_t count;
     size_t capacity;
-} value_token_list_t;
-
-typedef struct {
-    char *key;
-    const char *file;
-    value_token_list_t values;
-} token_t;
+} token_files_t;
 
+// Tokens as a structure of parallel arrays, so a pass reads only the fields it needs. Token t
+// has the key at keys[t] in its file's pool (NO_KEY when it has none), its file at
+// file_indexes[t] in 'files', and the value_counts[t] values from first_values[t]. Value v is
+// a kinds[v] of lens[v] bytes at offsets[v] in the same pool, which ended at lines[v]:bytes[v].
+//
+// An .env file is at most MAX_FILE_SIZE, so offsets, lengths and positions fit in 32 bits, and
+// each offset is into its own file's pool however many files a list holds.
 typedef struct {
-    token_t *items;
+    uint32_t *keys;
+    uint32_t *file_indexes;
+    uint32_t *first_values;
+    uint32_t *value_counts;
     size_t count;
     size_t capacity;
+
+    uint8_t *kinds;
+    uint32_t *offsets;
+    uint32_t *lens;
+    uint32_t *lines;
+    uint32_t *bytes;
+    size_t value_count;
+    size_t value_capacity;
+
+    token_files_t files;
 } token_list_t;
 
 typedef struct {
     size_t i;
-    size_t byte;
     size_t line;
+    size_t line_start; // where the current line begins; a position's byte is i - line_start + 1
     const char *file;
     size_t file_len;
     const char *file_name;
     bool reveal;
+    size_t bytes_read;   // across every tokenized file
+    buf_t pool;          // the current file's keys and values, copied to the main arena once it's done
+    uint32_t key;        // the pool offset of the key of the token being built, NO_KEY until its '='
+    size_t first_value;  // the first value of the token being built
     token_list_t tokens;
 } tokenizer_t;
 
+static inline const char *token_pool(const token_list_t *tokens, size_t t) {
+    return tokens->files.items[tokens->file_indexes[t]].pool;
+}
+
+static inline const char *token_file(const token_list_t *tokens, size_t t) {
+    return tokens->files.items[tokens->file_indexes[t]].path;
+}
+
+// NULL for a keyless token
+static inline const char *token_key(const token_list_t *tokens, size_t t) {
+    return tokens->keys[t] != NO_KEY ? token_pool(tokens, t) + tokens->keys[t] : NULL;
+}
+
+// The bytes of value 'v', which belongs to token 't'
+static inline const char *token_value(const token_list_t *tokens, size_t t, size_t v) {
+    return token_pool(tokens, t) + tokens->offsets[v];
+}
+
 static inline const char *get_value_kind_name(value_kind_t kind) {
     switch (kind) {
         case LITERAL_VALUE:
@@ -66,6 +105,17 @@ static inline const char *get_value_kind_name(value_kind_t kind) {
 }
 
 result_t run_tokenizer(arena_t *main_arena, const args_t *args, tokenizer_t *tokenizer);
+
+// Reads one file into 'scratch', failing when it can't be read or is empty
+result_t read_env_file(arena_t *scratch, const char *path, file_details_t *file);
+
+// Reads one file into 'scratch' and appends its tokens (allocated from 'main_arena'); the
+// tokens refer to 'path' as their file
+result_t tokenize_file(arena_t *main_arena, arena_t *scratch, const args_t *args, const char *path,
+                       tokenizer_t *tokenizer);
+// Appends the tokens of 'src' to 'dst', sharing its files' pools rather than copying them
+result_t token_list_append(arena_t *arena, token_list_t *dst, const token_list_t *src);
+
 result_t generate_tokens(arena_t *main_arena, arena_t *scratch, const args_t *args, const file_details_t *file,
                          tokenizer_t *tokenizer);
 
@@ -0,0 +1,121 @@
+#include "trace.h"
+#include "arena.h"
+#include "errors.h"
+#include "json.h"
+#include "nthread.h"
+#include <errno.h>
+#include <stdio.h>
+#include <string.h>
+
+// every event belongs to this one process
+#define TRACE_PID 1
+
+result_t trace_open(trace_t *trace, const char *path, double origin) {
+    FILE *file = fopen(path, "wb");
+    if (file == NULL) {
+        return operation_error("Unable to open the trace file '%s': %s\n", path, strerror(errno));
+    }
+
+    trace->file = file;
+    trace->origin = origin;
+    trace->first = true;
+    mutex_init(&trace->lock);
+
+    fputs("{\"displayTimeUnit\":\"ms\",\"traceEvents\":[", file);
+
+    return RESULT_OK;
+}
+
+void trace_close(trace_t *trace) {
+    if (trace->file == NULL) {
+        return;
+    }
+
+    fputs("\n]}\n", trace->file);
+    fclose(trace->file);
+    trace->file = NULL;
+    mutex_destroy(&trace->lock);
+}
+
+// caller holds trace->lock
+static void write_separator(trace_t *trace) {
+    fputs(trace->first ? "\n" : ",\n", trace->file);
+    trace->first = false;
+}
+
+static void write_event(trace_t *trace, uint32_t tid, const trace_event_t *e) {
+    write_separator(trace);
+
+    // timestamps and durations are in microseconds
+    fprintf(trace->file, "{\"name\":\"%s\",\"ph\":\"X\",\"pid\":%d,\"tid\":%u,\"ts\":%.3f,\"dur\":%.3f", e->name,
+            TRACE_PID, tid, (e->start - trace->origin) * 1e6, (e->end - e->start) * 1e6);
+
+    if (e->detail != NULL) {
+        fputs(",\"args\":{\"path\":", trace->file);
+        json_write_string(trace->file, e->detail);
+        fputc('}', trace->file);
+    }
+
+    fputc('}', trace->file);
+}
+
+static void trace_ring_flush(trace_ring_t *ring) {
+    if (ring->count == 0) {
+        return;
+    }
+
+    trace_t *trace = ring->trace;
+    mutex_lock(&trace->lock);
+    for (size_t i = 0; i < ring->count; ++i) {
+        write_event(trace, ring->tid, &ring->events[i]);
+    }
+    mutex_unlock(&trace->lock);
+
+    ring->count = 0;
+    arena_reset(&ring->details);
+}
+
+void trace_ring_init(trace_ring_t *ring, trace_t *trace, uint32_t tid, const char *thread_name) {
+    *ring = (trace_ring_t){.trace = trace, .tid = tid};
+    if (trace == NULL) {
+        return;
+    }
+
+    ring->events = arena_alloc(&ring->arena, TRACE_RING_SIZE * sizeof(*ring->events));
+
+    mutex_lock(&trace->lock);
+    write_separator(trace);
+    fprintf(trace->file, "{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":%d,\"tid\":%u,\"args\":{\"name\":", TRACE_PID,
+            tid);
+    json_write_string(trace->file, thread_name);
+    fputs("}}", trace->file);
+    mutex_unlock(&trace->lock);
+}
+
+void trace_ring_finish(trace_ring_t *ring) {
+    if (!trace_enabled(ring)) {
+        return;
+    }
+
+    trace_ring_flush(ring);
+    arena_free(&ring->details);
+    arena_free(&ring->arena);
+    *ring = (trace_ring_t){0};
+}
+
+void trace_span(trace_ring_t *ring, const char *name, const char *detail, double start, double end) {
+    if (!trace_enabled(ring)) {
+        return;
+    }
+
+    if (ring->count == TRACE_RING_SIZE) {
+        trace_ring_flush(ring);
+    }
+
+    ring->events[ring->count++] = (trace_event_t){
+        .name = name,
+        .detail = detail != NULL ? arena_strdup(&ring->details, detail) : NULL,
+        .start = start,
+        .end = end,
+    };
+}
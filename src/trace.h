@@ -0,0 +1,82 @@
+#ifndef TRACE_H
+#define TRACE_H
+
+#include "arena.h"
+#include "nthread.h"
+#include "result.h"
+#include "timer.h"
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <stdio.h>
+
+// Chrome trace-event output for --trace <file>: the written JSON loads directly into
+// Perfetto (ui.perfetto.dev) or chrome://tracing.
+//
+// Every thread records complete ("X") spans into its own fixed-size ring, so recording a
+// span is a few stores with no locking. A full ring is flushed to the file under the
+// trace lock, then reused; whatever is left is flushed when the thread is done. A
+// zero-initialized ring (or one whose trace is NULL) records nothing, so call sites
+// don't need to check whether tracing is on.
+
+#define TRACE_RING_SIZE 4096
+
+// uncontended lock acquisitions take tens of nanoseconds and would drown the trace, so only
+// acquisitions at least this long are recorded
+#define TRACE_MIN_LOCK_SPAN 1e-6
+
+typedef struct {
+    FILE *file;
+    mutex_t lock;  // serializes ring flushes into 'file'
+    double origin; // monotonic_seconds() at ts 0
+    bool first;    // no event written yet (comma placement)
+} trace_t;
+
+typedef struct {
+    const char *name;
+    const char *detail; // optional path argument, copied into the ring's arena
+    double start;
+    double end;
+} trace_event_t;
+
+typedef struct {
+    trace_t *trace;
+    uint32_t tid;
+    trace_event_t *events;
+    size_t count;
+    arena_t arena;   // the event array
+    arena_t details; // event details; reset with each flush
+} trace_ring_t;
+
+result_t trace_open(trace_t *trace, const char *path, double origin);
+void trace_close(trace_t *trace);
+
+// Attaches a ring to 'trace' (NULL leaves it disabled) and names its thread in the trace
+void trace_ring_init(trace_ring_t *ring, trace_t *trace, uint32_t tid, const char *thread_name);
+
+// Flushes the remaining events and releases the ring's memory
+void trace_ring_finish(trace_ring_t *ring);
+
+void trace_span(trace_ring_t *ring, const char *name, const char *detail, double start, double end);
+
+static inline bool trace_enabled(const trace_ring_t *ring) { return ring != NULL && ring->trace != NULL; }
+
+// A timestamp for trace_span, or 0 without the clock read when tracing is off
+static inline double trace_now(const trace_ring_t *ring) { return trace_enabled(ring) ? monotonic_seconds() : 0; }
+
+// mutex_lock that records the acquisition when it had to wait
+static inline void trace_mutex_lock(trace_ring_t *ring, mutex_t *m) {
+    if (!trace_enabled(ring)) {
+        mutex_lock(m);
+        return;
+    }
+
+    double start = monotonic_seconds();
+    mutex_lock(m);
+    double end = monotonic_seconds();
+    if (end - start >= TRACE_MIN_LOCK_SPAN) {
+        trace_span(ring, "lock", NULL, start, end);
+    }
+}
+
+#endif // TRACE_H
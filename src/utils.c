@@ -161,3 +161,27 @@ int str_to_u8(const char *s) {
 
     return (*p == '\0') ? (int)v : -1;
 }
+
+bool str_to_size(const char *s, size_t max, size_t *out) {
+    const char *p = s;
+    if (*p < '0' || *p > '9' || (*p == '0' && *(p + 1) != '\0')) {
+        return false;
+    }
+
+    size_t v = 0;
+    while (*p >= '0' && *p <= '9') {
+        size_t digit = (size_t)(*p - '0');
+        if (v > (max - digit) / 10) {
+            return false;
+        }
+        v = v * 10 + digit;
+        ++p;
+    }
+
+    if (*p != '\0') {
+        return false;
+    }
+
+    *out = v;
+    return true;
+}
@@ -21,5 +21,7 @@ bool is_ident_char(char c);
 bool is_valid_key(const char *key, size_t len);
 void fput_repeat(FILE *f, char c, size_t n);
 int str_to_u8(const char *s);
+// Parses a plain decimal number of at most 'max'; false for anything else
+bool str_to_size(const char *s, size_t max, size_t *out);
 
 #endif // UTILS_H
@@ -0,0 +1,541 @@
+#include "watch.h"
+#include "errors.h"
+
+#if defined(_WIN32) && defined(_MSC_VER)
+
+result_t run_watch(const args_t *args) {
+    (void)args;
+    return operation_error("The '--watch' flag is not supported on Windows.\n");
+}
+
+#else
+
+#include "arena.h"
+#include "engine.h"
+#include "file.h"
+#include "log.h"
+#include "macros.h"
+#include "parser.h"
+#include "timer.h"
+#include "tokenizer.h"
+#include "utils.h"
+#include <errno.h>
+#include <fcntl.h>
+#include <poll.h>
+#include <signal.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/wait.h>
+#include <unistd.h>
+
+#if defined(__linux__)
+#include <sys/inotify.h>
+
+// anything that can replace a file's contents; editors either write in place or rename a
+// new file over the old one
+#define WATCH_MASK (IN_ATTRIB | IN_CLOSE_WRITE | IN_CREATE | IN_DELETE | IN_MODIFY | IN_MOVED_FROM | IN_MOVED_TO)
+#endif
+
+typedef struct {
+    const char *path;
+    const char *name; // the basename, as inotify names it within its directory
+    int wd;           // the watch on its directory, -1 without inotify
+    bool known;       // 'id' was read
+    bool dirty;       // an event named it since its tokens were last kept
+    file_identity_t id;
+    token_list_t tokens;
+    arena_t arena; // 'tokens'
+
+    // a reload tokenizes into these, kept until the parse decides whether they replace the above
+    bool retokenized;
+    file_identity_t next_id;
+    token_list_t next_tokens;
+    arena_t next_arena;
+} watched_file_t;
+
+typedef struct {
+    const args_t *args;
+    watched_file_t *files;
+    size_t file_count;
+    char **command;      // NULL terminated
+    engine_t engine;     // its env map holds the ENVs the running command was started with
+    pid_t child;         // also its process group; 0 when none is running
+    bool owns_terminal;  // nvi is the foreground job of its controlling terminal
+    bool stopping;       // a forwarded signal is ending the command, so nothing restarts it
+    int inotify_fd;      // -1 when polling
+    double last_event;   // when a change was last seen, 0 with nothing pending
+} watch_t;
+
+static int signal_pipe[2] = {-1, -1};
+
+// the loop learns about signals by reading their numbers from the pipe, so one arriving
+// right before poll still wakes it
+static void on_signal(int sig) {
+    int saved = errno;
+    unsigned char byte = (unsigned char)sig;
+    ssize_t n = write(signal_pipe[1], &byte, 1);
+    (void)n;
+    errno = saved;
+}
+
+static const int forwarded_signals[] = {SIGINT, SIGTERM, SIGHUP, SIGQUIT, SIGUSR1, SIGUSR2};
+
+static void install_signals(void) {
+    struct sigaction action;
+    memset(&action, 0, sizeof(action));
+    action.sa_handler = on_signal;
+    sigemptyset(&action.sa_mask);
+    action.sa_flags = SA_RESTART;
+
+    sigaction(SIGCHLD, &action, NULL);
+    for (size_t i = 0; i < sizeof(forwarded_signals) / sizeof(forwarded_signals[0]); ++i) {
+        sigaction(forwarded_signals[i], &action, NULL);
+    }
+}
+
+static void set_flags(int fd) {
+    fcntl(fd, F_SETFD, FD_CLOEXEC);
+    fcntl(fd, F_SETFL, fcntl(fd, F_GETFL) | O_NONBLOCK);
+}
+
+// makes 'pgid' the terminal's foreground job; a background process changing it would be
+// stopped by SIGTTOU, so it's blocked meanwhile
+static void hand_terminal(const watch_t *watch, pid_t pgid) {
+    if (!watch->owns_terminal) {
+        return;
+    }
+
+    sigset_t ttou;
+    sigset_t saved;
+    sigemptyset(&ttou);
+    sigaddset(&ttou, SIGTTOU);
+    sigprocmask(SIG_BLOCK, &ttou, &saved);
+    tcsetpgrp(STDIN_FILENO, pgid);
+    sigprocmask(SIG_SETMASK, &saved, NULL);
+}
+
+static void spawn_child(watch_t *watch) {
+    fflush(stdout);
+    fflush(stderr);
+
+    pid_t pid = fork();
+    if (pid < 0) {
+        log_error(SINK_STDERR, "[ERROR] Unable to start '%s': %s\n", watch->command[0], strerror(errno));
+        return;
+    }
+
+    if (pid == 0) {
+        setpgid(0, 0);
+        hand_terminal(watch, getpid());
+        close(signal_pipe[0]);
+        close(signal_pipe[1]);
+
+        const env_map_t *env_map = &watch->engine.env_map;
+        for (size_t i = 0; i < env_map->count; ++i) {
+            setenv(env_map->items[i].key, env_map->items[i].value, 1);
+        }
+
+        execvp(watch->command[0], watch->command);
+        int code = errno == ENOENT ? 127 : 126;
+        log_error(SINK_STDERR, "[ERROR] Unable to run '%s': %s\n", watch->command[0], strerror(errno));
+        _exit(code);
+    }
+
+    // both sides set the group, so neither a signal nor the terminal can reach the child
+    // before it's in it
+    setpgid(pid, pid);
+    hand_terminal(watch, pid);
+    watch->child = pid;
+}
+
+static int exit_code(int status) { return WIFSIGNALED(status) ? 128 + WTERMSIG(status) : WEXITSTATUS(status); }
+
+// true once the child is gone, with its exit code in 'code'
+static bool reap_child(watch_t *watch, int *code) {
+    int status = 0;
+    pid_t pid = waitpid(watch->child, &status, WNOHANG | WUNTRACED);
+    if (pid <= 0) {
+        return false;
+    }
+
+    if (WIFSTOPPED(status)) {
+        // ctrl-z stopped the foreground child: stop with it so the shell gets the terminal
+        // back, then hand it over again and resume the child on `fg`
+        if (watch->owns_terminal) {
+            hand_terminal(watch, getpgrp());
+            raise(SIGTSTP);
+            hand_terminal(watch, watch->child);
+            kill(-watch->child, SIGCONT);
+        }
+        return false;
+    }
+
+    *code = exit_code(status);
+    watch->child = 0;
+    hand_terminal(watch, getpgrp());
+    return true;
+}
+
+static void stop_child(watch_t *watch) {
+    kill(-watch->child, SIGTERM);
+    kill(-watch->child, SIGCONT);
+
+    int status = 0;
+    const double deadline = monotonic_seconds() + WATCH_STOP_SECONDS;
+    while (waitpid(watch->child, &status, WNOHANG) == 0) {
+        if (monotonic_seconds() >= deadline) {
+            log_warning(SINK_STDERR, "[WARNING] '%s' didn't stop within %ds of SIGTERM; killing it.\n",
+                        watch->command[0], WATCH_STOP_SECONDS);
+            kill(-watch->child, SIGKILL);
+            waitpid(watch->child, &status, 0);
+            break;
+        }
+        usleep(10 * 1000);
+    }
+
+    watch->child = 0;
+    hand_terminal(watch, getpgrp());
+}
+
+static void forward_signal(watch_t *watch, int sig) {
+    if (watch->child == 0) {
+        return;
+    }
+
+    kill(-watch->child, sig);
+    if (sig != SIGUSR1 && sig != SIGUSR2) {
+        watch->stopping = true;
+    }
+}
+
+static bool tokenize_into(const watch_t *watch, const char *path, arena_t *arena, token_list_t *tokens) {
+    arena_t scratch = {0};
+    tokenizer_t tokenizer = {0};
+    result_t result = tokenize_file(arena, &scratch, watch->args, path, &tokenizer);
+    arena_free(&scratch);
+
+    *tokens = tokenizer.tokens;
+    return result.ok;
+}
+
+// every file's tokens in --files order, the reloaded ones in place of what they replace; the
+// engine re-evaluates only the definitions those changed and the keys that depend on them
+static result_t parse_files(watch_t *watch, list_t *changed) {
+    arena_t scratch = {0};
+    token_list_t tokens = {0};
+    result_t result = RESULT_OK;
+    for (size_t i = 0; i < watch->file_count && result.ok; ++i) {
+        const watched_file_t *file = &watch->files[i];
+        result = token_list_append(&scratch, &tokens, file->retokenized ? &file->next_tokens : &file->tokens);
+    }
+
+    if (result.ok) {
+        result = engine_update(&watch->engine, watch->args, &tokens, changed);
+    }
+    arena_free(&scratch);
+    return result;
+}
+
+static void log_reloaded_files(const watch_t *watch) {
+    for (size_t i = 0, n = 0; i < watch->file_count; ++i) {
+        if (watch->files[i].retokenized) {
+            log_f(SINK_STDERR, "%s'%s'", n++ == 0 ? " " : ", ", watch->files[i].path);
+        }
+    }
+}
+
+// drops whatever the reload tokenized; the files stay dirty, so the next reload retries them
+static void discard_reload(watch_t *watch) {
+    for (size_t i = 0; i < watch->file_count; ++i) {
+        watched_file_t *file = &watch->files[i];
+        if (file->retokenized) {
+            arena_free(&file->next_arena);
+            file->next_tokens = (token_list_t){0};
+            file->retokenized = false;
+        }
+    }
+
+    log_warning(SINK_STDERR, "[WARNING]");
+    log_f(SINK_STDERR, " '%s' keeps running with its current ENVs until the .env files parse again.\n",
+          watch->command[0]);
+}
+
+static void reload(watch_t *watch) {
+    bool tokenized = true;
+    bool changed_files = false;
+
+    for (size_t i = 0; i < watch->file_count; ++i) {
+        watched_file_t *file = &watch->files[i];
+        if (!file->dirty) {
+            continue;
+        }
+
+        // a write that left the file as it was (or a bare chmod) changes nothing
+        file_identity_t id;
+        bool exists = get_file_identity(file->path, &id);
+        if (exists && file->known && same_file_identity(&id, &file->id)) {
+            file->dirty = false;
+            continue;
+        }
+
+        file->next_arena = (arena_t){0};
+        if (!tokenize_into(watch, file->path, &file->next_arena, &file->next_tokens)) {
+            arena_free(&file->next_arena);
+            tokenized = false;
+            continue;
+        }
+
+        file->next_id = id;
+        file->retokenized = true;
+        changed_files = true;
+    }
+
+    if (!tokenized) {
+        discard_reload(watch);
+        return;
+    }
+    if (!changed_files) {
+        return;
+    }
+
+    list_t changed_keys = {0};
+    if (!parse_files(watch, &changed_keys).ok) {
+        discard_reload(watch);
+        return;
+    }
+
+    bool changed = changed_keys.count > 0;
+    log_info(SINK_STDERR, "[INFO]");
+    if (changed) {
+        log_f(SINK_STDERR, " The");
+        for (size_t i = 0; i < changed_keys.count; ++i) {
+            log_f(SINK_STDERR, "%s%s", i == 0 ? " " : ", ", changed_keys.items[i]);
+        }
+        log_f(SINK_STDERR, " ENV%s changed in", TO_PLURAL(changed_keys.count));
+    } else {
+        log_f(SINK_STDERR, " Reloaded");
+    }
+    log_reloaded_files(watch);
+    log_f(SINK_STDERR, changed ? "; restarting '%s'...\n" : " without changing the ENVs; '%s' keeps running.\n",
+          watch->command[0]);
+
+    // the engine now borrows the new tokens, so the ones they replace can go
+    for (size_t i = 0; i < watch->file_count; ++i) {
+        watched_file_t *file = &watch->files[i];
+        if (file->retokenized) {
+            arena_free(&file->arena);
+            file->arena = file->next_arena;
+            file->tokens = file->next_tokens;
+            file->id = file->next_id;
+            file->known = true;
+            file->dirty = false;
+            file->retokenized = false;
+        }
+    }
+
+    if (changed && watch->child != 0 && !watch->stopping) {
+        stop_child(watch);
+        spawn_child(watch);
+    }
+}
+
+static void mark_dirty(watch_t *watch, int wd, const char *name) {
+    for (size_t i = 0; i < watch->file_count; ++i) {
+        watched_file_t *file = &watch->files[i];
+        if (wd < 0 || (file->wd == wd && strcmp(file->name, name) == 0)) {
+            file->dirty = true;
+            watch->last_event = monotonic_seconds();
+        }
+    }
+}
+
+static void drain_events(watch_t *watch) {
+#if defined(__linux__)
+    union {
+        struct inotify_event event;
+        char bytes[16 * 1024];
+    } events;
+
+    for (;;) {
+        ssize_t n = read(watch->inotify_fd, events.bytes, sizeof(events.bytes));
+        if (n <= 0) {
+            break;
+        }
+
+        for (ssize_t off = 0; off < n;) {
+            const struct inotify_event *event = (const struct inotify_event *)(events.bytes + off);
+            off += (ssize_t)(sizeof(*event) + event->len);
+
+            // an overflowed queue may have dropped any file's event
+            if (event->mask & IN_Q_OVERFLOW) {
+                mark_dirty(watch, -1, NULL);
+            } else if (event->len > 0) {
+                mark_dirty(watch, event->wd, event->name);
+            }
+        }
+    }
+#else
+    (void)watch;
+#endif
+}
+
+// without inotify, a file is dirty once its identity differs from the kept one
+static void poll_files(watch_t *watch) {
+    for (size_t i = 0; i < watch->file_count; ++i) {
+        watched_file_t *file = &watch->files[i];
+        file_identity_t id;
+        bool exists = get_file_identity(file->path, &id);
+        if (exists != file->known || (exists && !same_file_identity(&id, &file->id))) {
+            file->dirty = true;
+            watch->last_event = monotonic_seconds();
+        }
+    }
+}
+
+static void watch_files(arena_t *arena, watch_t *watch) {
+    watch->inotify_fd = -1;
+#if defined(__linux__)
+    watch->inotify_fd = inotify_init1(IN_NONBLOCK | IN_CLOEXEC);
+    if (watch->inotify_fd < 0) {
+        log_warning(SINK_STDERR, "[WARNING] inotify is unavailable (%s); polling the .env files instead.\n",
+                    strerror(errno));
+        return;
+    }
+
+    for (size_t i = 0; i < watch->file_count; ++i) {
+        watched_file_t *file = &watch->files[i];
+        size_t dir_len = (size_t)(file->name - file->path);
+        const char *dir = dir_len == 0 ? "." : arena_strndup(arena, file->path, dir_len);
+
+        // inotify returns the same descriptor for every file in one directory
+        file->wd = inotify_add_watch(watch->inotify_fd, dir, WATCH_MASK);
+        if (file->wd < 0) {
+            log_warning(SINK_STDERR, "[WARNING] Unable to watch '%s' (%s); polling the .env files instead.\n", dir,
+                        strerror(errno));
+            close(watch->inotify_fd);
+            watch->inotify_fd = -1;
+            return;
+        }
+    }
+#else
+    (void)arena;
+#endif
+}
+
+// waits for the next signal, event or debounce deadline; false once the child has exited
+static bool wait_once(watch_t *watch, int *code) {
+    int timeout = -1;
+    if (watch->last_event > 0) {
+        double remaining = watch->last_event + WATCH_DEBOUNCE_MS / 1000.0 - monotonic_seconds();
+        timeout = remaining > 0 ? (int)(remaining * 1000.0) + 1 : 0;
+    } else if (watch->inotify_fd < 0) {
+        timeout = WATCH_POLL_MS;
+    }
+
+    struct pollfd fds[2] = {{.fd = signal_pipe[0], .events = POLLIN}, {.fd = watch->inotify_fd, .events = POLLIN}};
+    int ready = poll(fds, watch->inotify_fd >= 0 ? 2 : 1, timeout);
+    if (ready < 0 && errno != EINTR) {
+        log_error(SINK_STDERR, "[ERROR] Unable to wait for changes: %s\n", strerror(errno));
+        forward_signal(watch, SIGTERM);
+    }
+
+    if (ready > 0 && (fds[0].revents & POLLIN)) {
+        unsigned char sigs[64];
+        ssize_t n = 0;
+        while ((n = read(signal_pipe[0], sigs, sizeof(sigs))) > 0) {
+            for (ssize_t i = 0; i < n; ++i) {
+                if (sigs[i] != SIGCHLD) {
+                    forward_signal(watch, sigs[i]);
+                }
+            }
+        }
+    }
+
+    if (watch->child != 0 && reap_child(watch, code)) {
+        return false;
+    }
+    if (watch->child == 0) {
+        *code = 1;
+        return false;
+    }
+
+    if (ready > 0 && watch->inotify_fd >= 0 && (fds[1].revents & POLLIN)) {
+        drain_events(watch);
+    } else if (ready == 0 && watch->inotify_fd < 0 && watch->last_event == 0) {
+        poll_files(watch);
+    }
+
+    if (watch->last_event > 0 && monotonic_seconds() - watch->last_event >= WATCH_DEBOUNCE_MS / 1000.0) {
+        watch->last_event = 0;
+        if (!watch->stopping) {
+            reload(watch);
+        }
+    }
+
+    return true;
+}
+
+result_t run_watch(const args_t *args) {
+    arena_t arena = {0};
+    watch_t watch = {.args = args, .file_count = args->files.count, .inotify_fd = -1};
+    watch.files = arena_alloc_zeroed(&arena, watch.file_count * sizeof(*watch.files));
+    watch.command = arena_alloc(&arena, (args->command.count + 1) * sizeof(*watch.command));
+    for (size_t i = 0; i < args->command.count; ++i) {
+        watch.command[i] = (char *)args->command.items[i];
+    }
+    watch.command[args->command.count] = NULL;
+
+    list_t changed = {0};
+    int code = 0;
+    result_t result = RESULT_OK;
+    for (size_t i = 0; i < watch.file_count; ++i) {
+        watched_file_t *file = &watch.files[i];
+        file->path = args->files.items[i];
+        file->name = path_basename(file->path);
+        file->wd = -1;
+        file->known = get_file_identity(file->path, &file->id);
+        if (!tokenize_into(&watch, file->path, &file->arena, &file->tokens)) {
+            result = OPERATION_FAILURE;
+            goto done;
+        }
+    }
+
+    result = parse_files(&watch, &changed);
+    if (!result.ok) {
+        goto done;
+    }
+
+    if (pipe(signal_pipe) != 0) {
+        result = operation_error("Unable to create the watch's signal pipe: %s\n", strerror(errno));
+        goto done;
+    }
+    set_flags(signal_pipe[0]);
+    set_flags(signal_pipe[1]);
+    install_signals();
+
+    watch_files(&arena, &watch);
+    watch.owns_terminal = isatty(STDIN_FILENO) && tcgetpgrp(STDIN_FILENO) == getpgrp();
+
+    log_info(SINK_STDERR, "[INFO]");
+    log_f(SINK_STDERR, " Running '%s' and watching %zu .env file%s for changes...\n", watch.command[0],
+          watch.file_count, TO_PLURAL(watch.file_count));
+
+    spawn_child(&watch);
+    while (wait_once(&watch, &code)) {
+    }
+    result = code == 0 ? RESULT_OK : (result_t){.ok = false, .code = code};
+
+done:
+    if (watch.inotify_fd >= 0) {
+        close(watch.inotify_fd);
+    }
+    for (size_t i = 0; i < watch.file_count; ++i) {
+        arena_free(&watch.files[i].arena);
+    }
+    engine_free(&watch.engine);
+    arena_free(&arena);
+    return result;
+}
+
+#endif
@@ -0,0 +1,32 @@
+#ifndef WATCH_H
+#define WATCH_H
+
+#include "arg.h"
+#include "result.h"
+
+// `nvi --watch --files <paths> -- <command>` runs the command itself, with the parsed ENVs
+// added to its environment, and supervises it instead of emitting it for a consumer:
+// - the directories of the .env files are watched with inotify, so editors that save by
+//   renaming a new file over the old one are seen too (elsewhere, and when inotify is
+//   unavailable, the files are stat'ed every WATCH_POLL_MS)
+// - a burst of writes is collected until the files have been quiet for WATCH_DEBOUNCE_MS
+// - only the files whose identity (inode, size, timestamps) changed are tokenized again;
+//   the parse engine (engine.h) then re-evaluates only the keys their changes affect, and
+//   the command is restarted, naming the changed keys, only when an emitted ENV differs
+// - a file that no longer tokenizes or parses is reported and the command keeps running
+//   with its current ENVs until the file is fixed
+//
+// The command runs in its own process group (and, when nvi is the terminal's foreground
+// job, as the foreground job), so a restart stops everything it started: SIGTERM, then
+// SIGKILL after WATCH_STOP_SECONDS. SIGINT, SIGTERM, SIGHUP, SIGQUIT, SIGUSR1 and SIGUSR2
+// sent to nvi are forwarded to the group. The watch ends when the command exits on its own
+// (or after a forwarded signal), with its exit code, or 128 + the signal that ended it.
+// Not supported on Windows.
+
+#define WATCH_DEBOUNCE_MS 150
+#define WATCH_POLL_MS 500
+#define WATCH_STOP_SECONDS 5
+
+result_t run_watch(const args_t *args);
+
+#endif // WATCH_H
@@ -0,0 +1,62 @@
+#!/usr/bin/env bash
+# Per-call cost of running a command with the ENVs of a .env file from a shell loop:
+# the `nvix` pipeline (nvi | xargs -0 env) against the nvi bash builtin.
+#
+# Usage: tests/bench/builtin.sh <nvi> <nvi_builtin.so> [calls]
+# Run from the repository root (nvi only reads .env files below the working directory).
+
+set -euo pipefail
+
+if (($# < 2)); then
+    echo "usage: $0 <nvi> <nvi_builtin.so> [calls]" >&2
+    exit 2
+fi
+
+nvi_bin=$1
+builtin_so=$2
+calls=${3:-${BENCH_CALLS:-500}}
+keys=${BENCH_ENV_KEYS:-50}
+
+work=build/bench/builtin
+env_file=$work/bench.env
+mkdir -p "$work"
+: >"$env_file"
+for ((i = 0; i < keys; i++)); do
+    echo "BENCH_KEY_$i=value-$i" >>"$env_file"
+done
+echo 'BENCH_URL=http://${BENCH_KEY_0}:${BENCH_KEY_1}' >>"$env_file"
+
+nvix() { "$nvi_bin" "$@" | xargs -0 -r env; }
+
+enable -f "$builtin_so" nvi
+
+# prints the mean wall time per call in microseconds
+per_call() {
+    local start=$EPOCHREALTIME
+    for ((i = 0; i < calls; i++)); do
+        "$@" >/dev/null
+    done
+    local end=$EPOCHREALTIME
+    awk -v s="$start" -v e="$end" -v n="$calls" 'BEGIN { printf "%.1f", (e - s) * 1e6 / n }'
+}
+
+# the same environment must reach the command either way (bash sets $_ to xargs for the pipeline)
+diff <(nvix --files "$env_file" -- env | grep -v '^_=' | sort) \
+    <(nvi -f "$env_file" -- env | grep -v '^_=' | sort) >/dev/null || {
+    echo "the builtin and the pipeline produced different environments" >&2
+    exit 1
+}
+
+# one warm-up round so both read a cached .env file
+per_call nvix --files "$env_file" -- true >/dev/null
+per_call nvi -f "$env_file" -- true >/dev/null
+
+pipeline=$(per_call nvix --files "$env_file" -- true)
+builtin=$(per_call nvi -f "$env_file" -- true)
+exported=$(per_call nvi -f "$env_file")
+
+printf '%s calls, %s keys\n' "$calls" "$((keys + 1))"
+printf '  %-40s %10s us/call\n' "nvix (nvi | xargs -0 env) -- true" "$pipeline"
+printf '  %-40s %10s us/call  (%sx)\n' "builtin: nvi -f -- true" "$builtin" \
+    "$(awk -v p="$pipeline" -v b="$builtin" 'BEGIN { printf "%.1f", p / b }')"
+printf '  %-40s %10s us/call\n' "builtin: nvi -f (export, no command)" "$exported"
@@ -0,0 +1,760 @@
+// Run via `./nob bench` (or `./nob bench update` to rewrite the baseline), which
+// builds the release binary first and executes this runner from the repository root.
+//
+// The runner generates a deterministic synthetic workload under build/bench/work
+// (a source tree plus .env files), runs the built nvi against it phase by phase,
+// and reports wall time, throughput, and peak RSS per phase. Results are written
+// to build/bench/results.json and compared against tests/bench/baseline.json;
+// any phase slower (or hungrier) than the baseline beyond the tolerance fails.
+//
+// POSIX only: each nvi run is reaped with wait4() for its rusage.
+
+#include <errno.h>
+#include <fcntl.h>
+#include <stdarg.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/resource.h>
+#include <sys/stat.h>
+#include <sys/time.h>
+#include <sys/wait.h>
+#include <time.h>
+#include <unistd.h>
+
+#define BENCH_DIR "build/bench"
+#define WORK_DIR BENCH_DIR "/work"
+#define RESULTS_PATH BENCH_DIR "/results.json"
+#define BASELINE_PATH "tests/bench/baseline.json"
+#define MAX_PHASES 8
+#define MAX_LANGS 16
+
+// ---------------------------------------------------------------------------
+// workload configuration (BENCH_* environment variables)
+// ---------------------------------------------------------------------------
+
+typedef struct {
+    const char *ext;
+    const char *comment;   // single-line comment prefix for filler lines
+    const char *filler;    // a representative line of code, with %d for variety
+    const char *accessors; // '|'-separated accessor templates; %s is the key
+} lang_t;
+
+static const lang_t langs[] = {
+    {"ts", "//", "const value%d = compute(value, %d);",
+     "process.env.%s|process.env[\"%s\"]|import.meta.env.%s"},
+    {"js", "//", "let item%d = list.map((x) => x + %d);", "process.env.%s|process.env['%s']"},
+    {"py", "#", "value%d = compute(value, %d)", "os.getenv(\"%s\")|os.environ[\"%s\"]|os.environ.get('%s')"},
+    {"go", "//", "value%d := compute(value, %d)", "os.Getenv(\"%s\")|os.LookupEnv(\"%s\")"},
+    {"rs", "//", "let value%d = compute(value, %d);", "env::var(\"%s\")|env::var_os(\"%s\")"},
+    {"rb", "#", "value%d = compute(value, %d)", "ENV[\"%s\"]|ENV.fetch('%s')"},
+    {"c", "//", "int value%d = compute(value, %d);", "getenv(\"%s\")"},
+    {"java", "//", "int value%d = compute(value, %d);", "System.getenv(\"%s\")"},
+};
+
+typedef struct {
+    const lang_t *lang;
+    unsigned weight;
+} lang_weight_t;
+
+typedef struct {
+    unsigned depth;        // directory levels below the root
+    unsigned fanout;       // subdirectories per directory
+    unsigned files;        // files per directory
+    unsigned file_size;    // approximate bytes per file
+    unsigned density;      // accessor references per KB of source
+    unsigned env_keys;     // keys in the generated .env file
+    unsigned interp_depth; // length of ${KEY} reference chains
+    unsigned multiline;    // percent of values split with '\' continuations
+    unsigned threads;      // scanner threads for the multi-threaded phases
+    unsigned runs;         // timed runs per phase (the median is reported)
+    double tolerance;      // allowed regression in percent
+    uint64_t seed;
+    lang_weight_t langs[MAX_LANGS];
+    size_t lang_count;
+    char lang_spec[256];
+} config_t;
+
+static unsigned env_uint(const char *name, unsigned fallback, unsigned min, unsigned max) {
+    const char *v = getenv(name);
+    if (v == NULL || v[0] == '\0') {
+        return fallback;
+    }
+
+    char *end = NULL;
+    unsigned long n = strtoul(v, &end, 10);
+    if (*end != '\0' || n < min || n > max) {
+        fprintf(stderr, "[ERROR] %s must be an integer in [%u, %u] (found '%s')\n", name, min, max, v);
+        exit(2);
+    }
+
+    return (unsigned)n;
+}
+
+static const lang_t *find_lang(const char *ext, size_t len) {
+    for (size_t i = 0; i < sizeof(langs) / sizeof(langs[0]); ++i) {
+        if (strlen(langs[i].ext) == len && memcmp(langs[i].ext, ext, len) == 0) {
+            return &langs[i];
+        }
+    }
+    return NULL;
+}
+
+// BENCH_LANGS is a comma-separated list of ext[:weight] entries, eg. "ts:5,py:3,go:2"
+static void parse_lang_mix(config_t *cfg) {
+    const char *spec = getenv("BENCH_LANGS");
+    if (spec == NULL || spec[0] == '\0') {
+        spec = "ts:4,py:3,go:2,rs:1";
+    }
+    snprintf(cfg->lang_spec, sizeof(cfg->lang_spec), "%s", spec);
+
+    const char *p = spec;
+    while (*p != '\0') {
+        const char *end = strchr(p, ',');
+        size_t len = end != NULL ? (size_t)(end - p) : strlen(p);
+        const char *colon = memchr(p, ':', len);
+        size_t ext_len = colon != NULL ? (size_t)(colon - p) : len;
+
+        const lang_t *lang = find_lang(p, ext_len);
+        if (lang == NULL || cfg->lang_count == MAX_LANGS) {
+            fprintf(stderr, "[ERROR] BENCH_LANGS contains an unsupported entry '%.*s'\n", (int)len, p);
+            exit(2);
+        }
+
+        unsigned weight = colon != NULL ? (unsigned)strtoul(colon + 1, NULL, 10) : 1;
+        cfg->langs[cfg->lang_count++] = (lang_weight_t){.lang = lang, .weight = weight > 0 ? weight : 1};
+
+        p += len;
+        if (*p == ',') {
+            ++p;
+        }
+    }
+}
+
+static config_t load_config(void) {
+    config_t cfg = {0};
+    cfg.depth = env_uint("BENCH_DEPTH", 3, 0, 8);
+    cfg.fanout = env_uint("BENCH_FANOUT", 4, 1, 64);
+    cfg.files = env_uint("BENCH_FILES", 12, 1, 10000);
+    cfg.file_size = env_uint("BENCH_FILE_SIZE", 8192, 64, 64 * 1024 * 1024);
+    cfg.density = env_uint("BENCH_DENSITY", 2, 0, 100);
+    cfg.env_keys = env_uint("BENCH_ENV_KEYS", 2000, 1, 1000000);
+    cfg.interp_depth = env_uint("BENCH_INTERP_DEPTH", 4, 0, 64);
+    cfg.multiline = env_uint("BENCH_MULTILINE", 10, 0, 100);
+    cfg.threads = env_uint("BENCH_THREADS", 4, 1, 255);
+    cfg.runs = env_uint("BENCH_RUNS", 5, 1, 1000);
+    cfg.tolerance = env_uint("BENCH_TOLERANCE", 25, 0, 1000);
+    cfg.seed = env_uint("BENCH_SEED", 1337, 0, UINT32_MAX);
+    parse_lang_mix(&cfg);
+
+    long online = sysconf(_SC_NPROCESSORS_ONLN);
+    if (online > 0 && cfg.threads > (unsigned)online) {
+        cfg.threads = (unsigned)online;
+    }
+
+    return cfg;
+}
+
+// the workload fingerprint: a baseline only applies to the workload it was recorded on
+static void describe_workload(const config_t *cfg, char *out, size_t cap) {
+    snprintf(out, cap,
+             "depth=%u fanout=%u files=%u file_size=%u density=%u env_keys=%u interp_depth=%u multiline=%u "
+             "threads=%u seed=%llu langs=%s",
+             cfg->depth, cfg->fanout, cfg->files, cfg->file_size, cfg->density, cfg->env_keys, cfg->interp_depth,
+             cfg->multiline, cfg->threads, (unsigned long long)cfg->seed, cfg->lang_spec);
+}
+
+// ---------------------------------------------------------------------------
+// deterministic generation
+// ---------------------------------------------------------------------------
+
+// xorshift64*: tiny, fast, and identical on every platform for a given seed
+static uint64_t rng_state;
+
+static uint64_t rng_next(void) {
+    rng_state ^= rng_state >> 12;
+    rng_state ^= rng_state << 25;
+    rng_state ^= rng_state >> 27;
+    return rng_state * 2685821657736338717ULL;
+}
+
+static unsigned rng_below(unsigned n) { return n == 0 ? 0 : (unsigned)(rng_next() % n); }
+
+typedef struct {
+    char *items;
+    size_t count;
+    size_t capacity;
+} text_t;
+
+static void text_appendf(text_t *t, const char *fmt, ...) {
+    va_list args;
+    va_start(args, fmt);
+    va_list measure;
+    va_copy(measure, args);
+    int n = vsnprintf(NULL, 0, fmt, measure);
+    va_end(measure);
+
+    if (n < 0) {
+        va_end(args);
+        return;
+    }
+
+    if (t->count + (size_t)n + 1 > t->capacity) {
+        size_t cap = t->capacity ? t->capacity * 2 : 4096;
+        while (cap < t->count + (size_t)n + 1) {
+            cap *= 2;
+        }
+        t->items = realloc(t->items, cap);
+        if (t->items == NULL) {
+            fprintf(stderr, "[ERROR] out of memory while generating the workload\n");
+            exit(1);
+        }
+        t->capacity = cap;
+    }
+
+    vsnprintf(t->items + t->count, (size_t)n + 1, fmt, args);
+    t->count += (size_t)n;
+    va_end(args);
+}
+
+static void write_text(const char *path, const text_t *t) {
+    FILE *f = fopen(path, "wb");
+    if (f == NULL) {
+        fprintf(stderr, "[ERROR] cannot create '%s': %s\n", path, strerror(errno));
+        exit(1);
+    }
+    fwrite(t->items, 1, t->count, f);
+    fclose(f);
+}
+
+static void make_dir(const char *path) {
+    if (mkdir(path, 0755) != 0 && errno != EEXIST) {
+        fprintf(stderr, "[ERROR] cannot create directory '%s': %s\n", path, strerror(errno));
+        exit(1);
+    }
+}
+
+static void remove_tree(const char *path) {
+    char cmd[4096];
+    snprintf(cmd, sizeof(cmd), "rm -rf '%s'", path);
+    (void)system(cmd);
+}
+
+static const lang_t *pick_lang(const config_t *cfg) {
+    unsigned total = 0;
+    for (size_t i = 0; i < cfg->lang_count; ++i) {
+        total += cfg->langs[i].weight;
+    }
+
+    unsigned r = rng_below(total);
+    for (size_t i = 0; i < cfg->lang_count; ++i) {
+        if (r < cfg->langs[i].weight) {
+            return cfg->langs[i].lang;
+        }
+        r -= cfg->langs[i].weight;
+    }
+
+    return cfg->langs[0].lang;
+}
+
+static void env_key_name(char *out, size_t cap, unsigned i) { snprintf(out, cap, "BENCH_KEY_%05u", i); }
+
+static void append_accessor(text_t *t, const lang_t *lang, const char *key) {
+    // count the '|'-separated templates and pick one
+    unsigned n = 1;
+    for (const char *p = lang->accessors; *p; ++p) {
+        n += *p == '|';
+    }
+
+    unsigned pick = rng_below(n);
+    const char *start = lang->accessors;
+    while (pick-- > 0) {
+        start = strchr(start, '|') + 1;
+    }
+    const char *end = strchr(start, '|');
+    size_t len = end != NULL ? (size_t)(end - start) : strlen(start);
+
+    char tmpl[128];
+    snprintf(tmpl, sizeof(tmpl), "%.*s", (int)len, start);
+    text_appendf(t, "const v = ");
+    text_appendf(t, tmpl, key);
+    text_appendf(t, ";\n");
+}
+
+typedef struct {
+    size_t files;
+    size_t dirs;
+    size_t bytes;
+} tree_totals_t;
+
+static void generate_file(const config_t *cfg, const char *path, const lang_t *lang, tree_totals_t *totals) {
+    text_t t = {0};
+
+    // accessors are spread uniformly: one roughly every (1024 / density) bytes
+    size_t gap = cfg->density > 0 ? 1024 / cfg->density : SIZE_MAX;
+    size_t next_accessor = cfg->density > 0 ? rng_below((unsigned)gap) : SIZE_MAX;
+
+    while (t.count < cfg->file_size) {
+        if (t.count >= next_accessor) {
+            char key[32];
+            env_key_name(key, sizeof(key), rng_below(cfg->env_keys));
+            append_accessor(&t, lang, key);
+            next_accessor = t.count + gap / 2 + rng_below((unsigned)gap);
+            continue;
+        }
+
+        int n = (int)rng_below(100000);
+        if (rng_below(8) == 0) {
+            text_appendf(&t, "%s note %d: keep this in sync with the handler\n", lang->comment, n);
+        } else {
+            text_appendf(&t, lang->filler, n, n % 97);
+            text_appendf(&t, "\n");
+        }
+    }
+
+    write_text(path, &t);
+    ++totals->files;
+    totals->bytes += t.count;
+    free(t.items);
+}
+
+static void generate_dir(const config_t *cfg, const char *path, unsigned level, tree_totals_t *totals) {
+    make_dir(path);
+    ++totals->dirs;
+
+    char child[4096];
+    for (unsigned i = 0; i < cfg->files; ++i) {
+        const lang_t *lang = pick_lang(cfg);
+        snprintf(child, sizeof(child), "%s/file_%u.%s", path, i, lang->ext);
+        generate_file(cfg, child, lang, totals);
+    }
+
+    if (level == cfg->depth) {
+        return;
+    }
+
+    for (unsigned i = 0; i < cfg->fanout; ++i) {
+        snprintf(child, sizeof(child), "%s/dir_%u", path, i);
+        generate_dir(cfg, child, level + 1, totals);
+    }
+}
+
+// Keys are grouped into chains of interp_depth: the first key of a chain holds a
+// literal and every following key interpolates its predecessor, so the parser
+// resolves references interp_depth deep. A share of values span several lines
+// through '\' continuations.
+static size_t generate_env(const config_t *cfg, const char *path) {
+    text_t t = {0};
+    text_appendf(&t, "# generated by the nvi benchmark runner (seed %llu)\n", (unsigned long long)cfg->seed);
+
+    unsigned chain = cfg->interp_depth + 1;
+    char key[32];
+    char prev[32];
+
+    for (unsigned i = 0; i < cfg->env_keys; ++i) {
+        env_key_name(key, sizeof(key), i);
+
+        if (i % chain != 0) {
+            env_key_name(prev, sizeof(prev), i - 1);
+            text_appendf(&t, "%s=${%s}/%u\n", key, prev, i);
+            continue;
+        }
+
+        if (rng_below(100) < cfg->multiline) {
+            text_appendf(&t, "%s=first line of %u\\\n  second line\\\n  third line\n", key, i);
+            continue;
+        }
+
+        switch (rng_below(3)) {
+            case 0:
+                text_appendf(&t, "%s=https://service-%u.internal.example.com:8443/api/v1\n", key, rng_below(50));
+                break;
+            case 1:
+                text_appendf(&t, "%s=\"quoted value %u with spaces\"\n", key, i);
+                break;
+            default:
+                text_appendf(&t, "%s=%s\n", key, rng_below(2) ? "true" : "false");
+                break;
+        }
+    }
+
+    write_text(path, &t);
+    size_t len = t.count;
+    free(t.items);
+    return len;
+}
+
+// ---------------------------------------------------------------------------
+// measurement
+// ---------------------------------------------------------------------------
+
+typedef struct {
+    const char *name;
+    double wall_ms;    // median over the timed runs
+    long peak_rss_kb;  // max over the timed runs
+    size_t files;      // inputs processed per run
+    size_t bytes;      // input bytes processed per run
+    bool ok;
+} phase_t;
+
+static double now_ms(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (double)ts.tv_sec * 1000.0 + (double)ts.tv_nsec / 1e6;
+}
+
+static int cmp_double(const void *a, const void *b) {
+    double x = *(const double *)a;
+    double y = *(const double *)b;
+    return (x > y) - (x < y);
+}
+
+// runs argv inside cwd with stdout discarded and stderr captured to err_path;
+// returns the exit code (-1 when the child did not exit normally)
+static int run_once(const char *cwd, char *const argv[], const char *err_path, double *wall_ms, long *rss_kb) {
+    double start = now_ms();
+
+    pid_t pid = fork();
+    if (pid < 0) {
+        fprintf(stderr, "[ERROR] fork failed: %s\n", strerror(errno));
+        return -1;
+    }
+
+    if (pid == 0) {
+        int devnull = open("/dev/null", O_WRONLY);
+        int err = open(err_path, O_WRONLY | O_CREAT | O_TRUNC, 0644);
+        if (devnull < 0 || err < 0 || chdir(cwd) != 0) {
+            _exit(127);
+        }
+        dup2(devnull, STDOUT_FILENO);
+        dup2(err, STDERR_FILENO);
+        execv(argv[0], argv);
+        _exit(127);
+    }
+
+    int status = 0;
+    struct rusage ru;
+    if (wait4(pid, &status, 0, &ru) < 0) {
+        fprintf(stderr, "[ERROR] wait4 failed: %s\n", strerror(errno));
+        return -1;
+    }
+
+    *wall_ms = now_ms() - start;
+#if defined(__APPLE__)
+    *rss_kb = ru.ru_maxrss / 1024; // bytes on macOS
+#else
+    *rss_kb = ru.ru_maxrss; // kilobytes on Linux
+#endif
+
+    return WIFEXITED(status) ? WEXITSTATUS(status) : -1;
+}
+
+static void print_file(const char *path) {
+    FILE *f = fopen(path, "rb");
+    if (f == NULL) {
+        return;
+    }
+    char buf[4096];
+    size_t n;
+    while ((n = fread(buf, 1, sizeof(buf), f)) > 0) {
+        fwrite(buf, 1, n, stderr);
+    }
+    fclose(f);
+}
+
+static phase_t run_phase(const config_t *cfg, const char *name, const char *cwd, char *const argv[], size_t files,
+                         size_t bytes) {
+    phase_t phase = {.name = name, .files = files, .bytes = bytes, .ok = true};
+    const char *err_path = BENCH_DIR "/stderr.txt";
+
+    char abs_err[4096];
+    if (realpath(BENCH_DIR, abs_err) == NULL) {
+        snprintf(abs_err, sizeof(abs_err), "%s", err_path);
+    } else {
+        strncat(abs_err, "/stderr.txt", sizeof(abs_err) - strlen(abs_err) - 1);
+    }
+
+    // one untimed warm-up run primes the page cache so every timed run sees the same state
+    double samples[1000];
+    long rss = 0;
+    for (unsigned r = 0; r <= cfg->runs; ++r) {
+        double wall = 0;
+        long run_rss = 0;
+        int rc = run_once(cwd, argv, abs_err, &wall, &run_rss);
+        if (rc != 0) {
+            fprintf(stderr, "[ERROR] phase '%s' exited with %d; nvi reported:\n", name, rc);
+            print_file(abs_err);
+            phase.ok = false;
+            return phase;
+        }
+
+        if (r == 0) {
+            continue;
+        }
+
+        samples[r - 1] = wall;
+        if (run_rss > rss) {
+            rss = run_rss;
+        }
+    }
+
+    qsort(samples, cfg->runs, sizeof(samples[0]), cmp_double);
+    phase.wall_ms = samples[cfg->runs / 2];
+    phase.peak_rss_kb = rss;
+    return phase;
+}
+
+// ---------------------------------------------------------------------------
+// baseline
+// ---------------------------------------------------------------------------
+
+static char *read_all(const char *path) {
+    FILE *f = fopen(path, "rb");
+    if (f == NULL) {
+        return NULL;
+    }
+
+    fseek(f, 0, SEEK_END);
+    long len = ftell(f);
+    fseek(f, 0, SEEK_SET);
+    if (len < 0) {
+        fclose(f);
+        return NULL;
+    }
+
+    char *buf = malloc((size_t)len + 1);
+    size_t n = buf != NULL ? fread(buf, 1, (size_t)len, f) : 0;
+    fclose(f);
+    if (buf != NULL) {
+        buf[n] = '\0';
+    }
+    return buf;
+}
+
+static double throughput(double count, double wall_ms) { return wall_ms > 0 ? count / (wall_ms / 1000.0) : 0; }
+
+static void write_results(const char *path, const char *workload, const phase_t *phases, size_t count) {
+    FILE *f = fopen(path, "wb");
+    if (f == NULL) {
+        fprintf(stderr, "[ERROR] cannot write '%s': %s\n", path, strerror(errno));
+        exit(1);
+    }
+
+    fprintf(f, "{\n  \"workload\": \"%s\",\n  \"phases\": [\n", workload);
+    for (size_t i = 0; i < count; ++i) {
+        const phase_t *p = &phases[i];
+        fprintf(f,
+                "    {\"name\": \"%s\", \"wall_ms\": %.3f, \"files_per_sec\": %.1f, \"mb_per_sec\": %.2f, "
+                "\"peak_rss_kb\": %ld, \"files\": %zu, \"bytes\": %zu}%s\n",
+                p->name, p->wall_ms, throughput((double)p->files, p->wall_ms),
+                throughput((double)p->bytes / (1024.0 * 1024.0), p->wall_ms), p->peak_rss_kb, p->files, p->bytes,
+                i + 1 < count ? "," : "");
+    }
+    fprintf(f, "  ]\n}\n");
+    fclose(f);
+}
+
+// The baseline is written by this runner (one phase object per line), so a
+// field lookup only needs to find the phase's line and the key within it.
+static bool baseline_field(const char *json, const char *phase, const char *field, double *out) {
+    char needle[128];
+    snprintf(needle, sizeof(needle), "\"name\": \"%s\"", phase);
+    const char *line = strstr(json, needle);
+    if (line == NULL) {
+        return false;
+    }
+
+    const char *eol = strchr(line, '\n');
+    snprintf(needle, sizeof(needle), "\"%s\": ", field);
+    const char *at = strstr(line, needle);
+    if (at == NULL || (eol != NULL && at > eol)) {
+        return false;
+    }
+
+    *out = strtod(at + strlen(needle), NULL);
+    return true;
+}
+
+static bool baseline_matches_workload(const char *json, const char *workload) {
+    char needle[1100];
+    snprintf(needle, sizeof(needle), "\"workload\": \"%s\"", workload);
+    return strstr(json, needle) != NULL;
+}
+
+// wall times under a few milliseconds are dominated by process startup noise,
+// so allow a small absolute slack on top of the relative tolerance
+#define WALL_SLACK_MS 2.0
+
+static size_t compare_to_baseline(const config_t *cfg, const char *json, const phase_t *phases, size_t count) {
+    size_t regressions = 0;
+    double limit = 1.0 + cfg->tolerance / 100.0;
+
+    printf("\n%-14s %12s %12s %9s %12s %12s %9s\n", "phase", "wall ms", "baseline", "delta", "rss KB", "baseline",
+           "delta");
+    for (size_t i = 0; i < count; ++i) {
+        const phase_t *p = &phases[i];
+        double base_wall = 0;
+        double base_rss = 0;
+        if (!baseline_field(json, p->name, "wall_ms", &base_wall) ||
+            !baseline_field(json, p->name, "peak_rss_kb", &base_rss)) {
+            printf("%-14s %12.3f %12s %9s %12ld %12s %9s\n", p->name, p->wall_ms, "-", "new", p->peak_rss_kb, "-",
+                   "new");
+            continue;
+        }
+
+        double wall_delta = base_wall > 0 ? (p->wall_ms / base_wall - 1.0) * 100.0 : 0;
+        double rss_delta = base_rss > 0 ? ((double)p->peak_rss_kb / base_rss - 1.0) * 100.0 : 0;
+        bool wall_regressed = p->wall_ms > base_wall * limit + WALL_SLACK_MS;
+        bool rss_regressed = (double)p->peak_rss_kb > base_rss * limit;
+
+        printf("%-14s %12.3f %12.3f %+8.1f%% %12ld %12.0f %+8.1f%%%s\n", p->name, p->wall_ms, base_wall, wall_delta,
+               p->peak_rss_kb, base_rss, rss_delta, wall_regressed || rss_regressed ? "  REGRESSED" : "");
+
+        if (wall_regressed || rss_regressed) {
+            ++regressions;
+        }
+    }
+
+    return regressions;
+}
+
+// ---------------------------------------------------------------------------
+// main
+// ---------------------------------------------------------------------------
+
+static void usage(void) {
+    fprintf(stderr, "usage: bench-runner <nvi binary> [update]\n");
+    exit(2);
+}
+
+int main(int argc, char **argv) {
+    if (argc < 2 || argc > 3) {
+        usage();
+    }
+
+    bool update = argc == 3 && strcmp(argv[2], "update") == 0;
+    if (argc == 3 && !update) {
+        usage();
+    }
+
+    char nvi[4096];
+    if (realpath(argv[1], nvi) == NULL) {
+        fprintf(stderr, "[ERROR] cannot locate the nvi binary '%s'\n", argv[1]);
+        return 1;
+    }
+
+    config_t cfg = load_config();
+    char workload[1024];
+    describe_workload(&cfg, workload, sizeof(workload));
+
+    make_dir("build");
+    make_dir(BENCH_DIR);
+    remove_tree(WORK_DIR);
+    make_dir(WORK_DIR);
+
+    rng_state = cfg.seed * 0x9E3779B97F4A7C15ULL + 1;
+
+    double gen_start = now_ms();
+    tree_totals_t tree = {0};
+    generate_dir(&cfg, WORK_DIR "/tree", 0, &tree);
+    size_t env_bytes = generate_env(&cfg, WORK_DIR "/tree/bench.env");
+    printf("generated %zu files in %zu directories (%.1f MB) and a %u-key .env file (%.1f KB) in %.0f ms\n",
+           tree.files, tree.dirs, (double)tree.bytes / (1024.0 * 1024.0), cfg.env_keys, (double)env_bytes / 1024.0,
+           now_ms() - gen_start);
+    printf("workload: %s\n", workload);
+
+    // the scan argument list names every extension in the language mix
+    char *scan_argv[64];
+    size_t scan_argc = 0;
+    scan_argv[scan_argc++] = nvi;
+    scan_argv[scan_argc++] = "--scan";
+    for (size_t i = 0; i < cfg.lang_count; ++i) {
+        scan_argv[scan_argc++] = (char *)cfg.langs[i].lang->ext;
+    }
+    size_t scan_prefix = scan_argc;
+
+    char threads[8];
+    snprintf(threads, sizeof(threads), "%u", cfg.threads);
+
+    const char *cwd = WORK_DIR "/tree";
+    phase_t phases[MAX_PHASES];
+    size_t count = 0;
+
+    // scan (single thread): walk + match only; --files keeps it a valid non-dry run
+    scan_argc = scan_prefix;
+    scan_argv[scan_argc++] = "--files";
+    scan_argv[scan_argc++] = "bench.env";
+    scan_argv[scan_argc++] = "--threads";
+    scan_argv[scan_argc++] = "1";
+    scan_argv[scan_argc] = NULL;
+    phases[count++] = run_phase(&cfg, "scan-1t", cwd, scan_argv, tree.files, tree.bytes);
+
+    // scan (multi-threaded)
+    scan_argv[scan_argc - 1] = threads;
+    phases[count++] = run_phase(&cfg, "scan-nt", cwd, scan_argv, tree.files, tree.bytes);
+
+    // parse: tokenize, parse and emit the .env file
+    char *parse_argv[] = {nvi, "--files", "bench.env", "-F", "nul", "--", "true", NULL};
+    phases[count++] = run_phase(&cfg, "parse", cwd, parse_argv, 1, env_bytes);
+
+    // end to end: scan-required keys are checked against the parsed .env before emitting
+    scan_argc = scan_prefix;
+    scan_argv[scan_argc++] = "--files";
+    scan_argv[scan_argc++] = "bench.env";
+    scan_argv[scan_argc++] = "--threads";
+    scan_argv[scan_argc++] = threads;
+    scan_argv[scan_argc++] = "-F";
+    scan_argv[scan_argc++] = "nul";
+    scan_argv[scan_argc++] = "--";
+    scan_argv[scan_argc++] = "true";
+    scan_argv[scan_argc] = NULL;
+    phases[count++] = run_phase(&cfg, "end-to-end", cwd, scan_argv, tree.files + 1, tree.bytes + env_bytes);
+
+    for (size_t i = 0; i < count; ++i) {
+        if (!phases[i].ok) {
+            return 1;
+        }
+    }
+
+    printf("\n%-14s %12s %12s %12s %12s\n", "phase", "wall ms", "files/s", "MB/s", "peak RSS KB");
+    for (size_t i = 0; i < count; ++i) {
+        const phase_t *p = &phases[i];
+        printf("%-14s %12.3f %12.1f %12.2f %12ld\n", p->name, p->wall_ms, throughput((double)p->files, p->wall_ms),
+               throughput((double)p->bytes / (1024.0 * 1024.0), p->wall_ms), p->peak_rss_kb);
+    }
+
+    write_results(RESULTS_PATH, workload, phases, count);
+    printf("\nwrote " RESULTS_PATH "\n");
+
+    if (update) {
+        write_results(BASELINE_PATH, workload, phases, count);
+        printf("updated " BASELINE_PATH "\n");
+        return 0;
+    }
+
+    char *baseline = read_all(BASELINE_PATH);
+    if (baseline == NULL) {
+        printf("no baseline at " BASELINE_PATH "; run `./nob bench update` to record one\n");
+        return 0;
+    }
+
+    if (!baseline_matches_workload(baseline, workload)) {
+        printf("the baseline was recorded on a different workload; skipping the comparison\n");
+        free(baseline);
+        return 0;
+    }
+
+    size_t regressions = compare_to_baseline(&cfg, baseline, phases, count);
+    free(baseline);
+
+    if (regressions > 0) {
+        printf("\n%zu phase%s regressed beyond the %.0f%% tolerance (BENCH_TOLERANCE)\n", regressions,
+               regressions == 1 ? "" : "s", cfg.tolerance);
+        return 1;
+    }
+
+    printf("\nno regressions beyond the %.0f%% tolerance\n", cfg.tolerance);
+    return 0;
+}
@@ -0,0 +1,562 @@
+// Run via `./nob bench micro [filter]`, which builds this harness against every
+// source except main.c (like the Unity test binaries, but optimized and without
+// sanitizers) and runs it from the repository root.
+//
+// Each kernel runs on a fixed, deterministically generated input. A benchmark is
+// calibrated so one sample takes roughly SAMPLE_TARGET_NS, then timed over
+// SAMPLES samples; the table reports the median ns/op, the sample-to-sample
+// variation (coefficient of variation), and for byte-oriented kernels the
+// throughput in bytes/cycle. Cycles come from the time-stamp counter on x86-64
+// (reference cycles, so frequency scaling shows up as drift in ns/op rather than
+// in bytes/cycle) and are reported as n/a elsewhere.
+
+#include "accessors.h"
+#include "arena.h"
+#include "arg.h"
+#include "file.h"
+#include "hash.h"
+#include "hashmap.h"
+#include "hashset.h"
+#include "matcher.h"
+#include "parser.h"
+#include "timer.h"
+#include "tokenizer.h"
+#include <math.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#if defined(__x86_64__) || defined(_M_X64)
+#if defined(_MSC_VER)
+#include <intrin.h>
+#else
+#include <x86intrin.h>
+#endif
+#define HAVE_CYCLES 1
+static inline uint64_t cycles_now(void) { return __rdtsc(); }
+#else
+#define HAVE_CYCLES 0
+static inline uint64_t cycles_now(void) { return 0; }
+#endif
+
+#define SAMPLES 15
+#define SAMPLE_TARGET_NS 20e6
+
+// ---------------------------------------------------------------------------
+// harness
+// ---------------------------------------------------------------------------
+
+typedef struct {
+    const char *name;
+    const size_t *bytes_per_op; // input bytes per op, read after setup; NULL for non-streaming kernels
+    void (*setup)(void);
+    void (*run)(size_t iters);
+    void (*teardown)(void);
+} bench_t;
+
+typedef struct {
+    double ns_per_op;
+    double cv; // stddev / mean over the samples, in percent
+    double bytes_per_cycle;
+} bench_result_t;
+
+static volatile size_t sink; // defeats dead-code elimination of kernel results
+
+static int cmp_double(const void *a, const void *b) {
+    double x = *(const double *)a;
+    double y = *(const double *)b;
+    return (x > y) - (x < y);
+}
+
+static bench_result_t measure(const bench_t *b) {
+    if (b->setup != NULL) {
+        b->setup();
+    }
+
+    // calibrate: double the iteration count until one sample is long enough to time reliably
+    size_t iters = 1;
+    for (;;) {
+        double start = monotonic_seconds();
+        b->run(iters);
+        double ns = (monotonic_seconds() - start) * 1e9;
+        if (ns >= SAMPLE_TARGET_NS / 4 || iters >= ((size_t)1 << 30)) {
+            double scale = ns > 0 ? SAMPLE_TARGET_NS / ns : 2.0;
+            iters = (size_t)((double)iters * scale);
+            break;
+        }
+        iters *= 2;
+    }
+    if (iters == 0) {
+        iters = 1;
+    }
+
+    double ns_per_op[SAMPLES];
+    double cycles_per_op[SAMPLES];
+    for (int s = 0; s < SAMPLES; ++s) {
+        uint64_t c0 = cycles_now();
+        double start = monotonic_seconds();
+        b->run(iters);
+        double ns = (monotonic_seconds() - start) * 1e9;
+        uint64_t c1 = cycles_now();
+
+        ns_per_op[s] = ns / (double)iters;
+        cycles_per_op[s] = (double)(c1 - c0) / (double)iters;
+    }
+
+    double mean = 0;
+    for (int s = 0; s < SAMPLES; ++s) {
+        mean += ns_per_op[s];
+    }
+    mean /= SAMPLES;
+
+    double var = 0;
+    for (int s = 0; s < SAMPLES; ++s) {
+        var += (ns_per_op[s] - mean) * (ns_per_op[s] - mean);
+    }
+    var /= SAMPLES - 1;
+
+    qsort(ns_per_op, SAMPLES, sizeof(double), cmp_double);
+    qsort(cycles_per_op, SAMPLES, sizeof(double), cmp_double);
+
+    bench_result_t r = {
+        .ns_per_op = ns_per_op[SAMPLES / 2],
+        .cv = mean > 0 ? sqrt(var) / mean * 100.0 : 0,
+        .bytes_per_cycle = 0,
+    };
+
+    double cyc = cycles_per_op[SAMPLES / 2];
+    if (HAVE_CYCLES && b->bytes_per_op != NULL && cyc > 0) {
+        r.bytes_per_cycle = (double)*b->bytes_per_op / cyc;
+    }
+
+    return r;
+}
+
+static void print_row(const bench_t *b, bench_result_t r) {
+    size_t bytes = b->bytes_per_op != NULL ? *b->bytes_per_op : 0;
+
+    char bpc[32] = "-";
+    if (bytes > 0) {
+        snprintf(bpc, sizeof(bpc), HAVE_CYCLES ? "%.3f" : "n/a", r.bytes_per_cycle);
+    }
+
+    char mbs[32] = "-";
+    if (bytes > 0 && r.ns_per_op > 0) {
+        snprintf(mbs, sizeof(mbs), "%.1f", (double)bytes / r.ns_per_op * 1e9 / (1024.0 * 1024.0));
+    }
+
+    printf("%-26s %14.1f %9.2f%% %12s %10s\n", b->name, r.ns_per_op, r.cv, bpc, mbs);
+    fflush(stdout);
+}
+
+static void run_bench(const bench_t *b) {
+    bench_result_t r = measure(b);
+    print_row(b, r);
+
+    if (b->teardown != NULL) {
+        b->teardown();
+    }
+}
+
+// ---------------------------------------------------------------------------
+// fixed inputs
+// ---------------------------------------------------------------------------
+
+static uint64_t rng_state = 0x6e7669;
+
+static uint64_t rng_next(void) {
+    rng_state ^= rng_state >> 12;
+    rng_state ^= rng_state << 25;
+    rng_state ^= rng_state >> 27;
+    return rng_state * 2685821657736338717ULL;
+}
+
+static unsigned rng_below(unsigned n) { return (unsigned)(rng_next() % n); }
+
+typedef struct {
+    char *items;
+    size_t count;
+    size_t capacity;
+} text_t;
+
+static void text_append(text_t *t, const char *s, size_t n) {
+    if (t->count + n + 1 > t->capacity) {
+        size_t cap = t->capacity ? t->capacity * 2 : 4096;
+        while (cap < t->count + n + 1) {
+            cap *= 2;
+        }
+        t->items = realloc(t->items, cap);
+        if (t->items == NULL) {
+            fprintf(stderr, "out of memory\n");
+            exit(1);
+        }
+        t->capacity = cap;
+    }
+    memcpy(t->items + t->count, s, n);
+    t->count += n;
+    t->items[t->count] = '\0';
+}
+
+static void text_cstr(text_t *t, const char *s) { text_append(t, s, strlen(s)); }
+
+#define ENV_INPUT_KEYS 2048
+
+// a .env file exercising every tokenizer path: literals, quotes, comments,
+// interpolations with and without defaults, and line continuations
+static text_t make_env_input(void) {
+    text_t t = {0};
+    char line[256];
+
+    for (unsigned i = 0; i < ENV_INPUT_KEYS; ++i) {
+        int n = 0;
+        switch (i % 6) {
+            case 0:
+                n = snprintf(line, sizeof(line), "KEY_%04u=https://service-%u.example.com/api/v1\n", i, i % 50);
+                break;
+            case 1:
+                n = snprintf(line, sizeof(line), "KEY_%04u=\"double quoted value %u with spaces\"\n", i, i);
+                break;
+            case 2:
+                n = snprintf(line, sizeof(line), "# comment about KEY_%04u and its purpose\n", i);
+                break;
+            case 3:
+                n = snprintf(line, sizeof(line), "KEY_%04u=${KEY_%04u}/path/${MISSING_%u:-fallback}\n", i, i - 3, i);
+                break;
+            case 4:
+                n = snprintf(line, sizeof(line), "KEY_%04u='single ${NOT_INTERPOLATED} %u'\n", i, i);
+                break;
+            default:
+                n = snprintf(line, sizeof(line), "KEY_%04u=first line\\\nsecond line %u\n", i, i);
+                break;
+        }
+        text_append(&t, line, (size_t)n);
+    }
+
+    return t;
+}
+
+// source text for one accessor family: filler code with every accessor of the
+// family used roughly once per KB, shaped to satisfy its pattern
+#define SOURCE_INPUT_SIZE (256 * 1024)
+
+static text_t make_source_input(const file_ext_t *ext) {
+    text_t t = {0};
+    char line[256];
+    size_t next = 0;
+
+    while (t.count < SOURCE_INPUT_SIZE) {
+        if (t.count >= next) {
+            const accessor_t *acc = &ext->accessors[rng_below((unsigned)ext->accessor_count)];
+            unsigned key = rng_below(512);
+            int n = 0;
+            switch (acc->pattern) {
+                case ident:
+                    n = snprintf(line, sizeof(line), "value = %sAPP_KEY_%u;\n", acc->prefix, key);
+                    break;
+                case quoted:
+                    n = snprintf(line, sizeof(line), "value = %s\"APP_KEY_%u\");\n", acc->prefix, key);
+                    break;
+                case braced:
+                case expansion:
+                    n = snprintf(line, sizeof(line), "value = %sAPP_KEY_%u};\n", acc->prefix, key);
+                    break;
+                case parened:
+                    n = snprintf(line, sizeof(line), "value = %sAPP_KEY_%u);\n", acc->prefix, key);
+                    break;
+            }
+            text_append(&t, line, (size_t)n);
+            next = t.count + 512 + rng_below(1024);
+            continue;
+        }
+
+        unsigned r = rng_below(4);
+        if (r == 0) {
+            text_cstr(&t, "    // keep the handler in sync with the schema; see the design notes\n");
+        } else if (r == 1) {
+            text_cstr(&t, "    result = transform(input, options.limit, options.offset);\n");
+        } else if (r == 2) {
+            text_cstr(&t, "    if (result == null || result.length == 0) { return fallback(\"empty\"); }\n");
+        } else {
+            text_cstr(&t, "    items.push({ id: index, name: `item-${index}`, $value: total / count });\n");
+        }
+    }
+
+    return t;
+}
+
+// ---------------------------------------------------------------------------
+// tokenizer
+// ---------------------------------------------------------------------------
+
+static text_t env_input;
+static arena_t main_arena;
+static arena_t scratch_arena;
+
+static void tokenizer_setup(void) { env_input = make_env_input(); }
+
+static void tokenizer_run(size_t iters) {
+    args_t args = {0};
+    file_details_t file = {.contents = env_input.items, .path = "micro.env", .len = env_input.count};
+
+    for (size_t i = 0; i < iters; ++i) {
+        tokenizer_t tokenizer = {0};
+        result_t r = generate_tokens(&main_arena, &scratch_arena, &args, &file, &tokenizer);
+        if (!r.ok) {
+            fprintf(stderr, "generate_tokens failed on the fixed input\n");
+            exit(1);
+        }
+        sink += tokenizer.tokens.count;
+        arena_reset(&main_arena);
+        arena_reset(&scratch_arena);
+    }
+}
+
+static void tokenizer_teardown(void) {
+    arena_free(&main_arena);
+    arena_free(&scratch_arena);
+    free(env_input.items);
+    env_input = (text_t){0};
+}
+
+// ---------------------------------------------------------------------------
+// parser
+// ---------------------------------------------------------------------------
+
+static arena_t token_arena;
+static token_list_t env_tokens;
+
+static void parser_setup(void) {
+    env_input = make_env_input();
+    args_t args = {0};
+    file_details_t file = {.contents = env_input.items, .path = "micro.env", .len = env_input.count};
+    tokenizer_t tokenizer = {0};
+    if (!generate_tokens(&token_arena, &scratch_arena, &args, &file, &tokenizer).ok) {
+        fprintf(stderr, "generate_tokens failed on the fixed input\n");
+        exit(1);
+    }
+    env_tokens = tokenizer.tokens;
+}
+
+// one op = run_parser over every token of the fixed input: compiling it, then running it
+static void parser_run(size_t iters) {
+    args_t args = {0};
+    for (size_t i = 0; i < iters; ++i) {
+        parser_t parser = {0};
+        if (!run_parser(&main_arena, &args, &env_tokens, &parser).ok) {
+            fprintf(stderr, "run_parser failed on the fixed input\n");
+            exit(1);
+        }
+        sink += parser.env_map.count;
+        arena_reset(&main_arena);
+    }
+}
+
+static void parser_teardown(void) {
+    arena_free(&token_arena);
+    tokenizer_teardown();
+}
+
+// ---------------------------------------------------------------------------
+// matcher (one benchmark per accessor family)
+// ---------------------------------------------------------------------------
+
+static const char *families[] = {
+    "js", "py", "go", "rs",  "rb", "zig", "java", "scala", "clj", "c",   "cpp", "cs",  "vb", "php", "pl", "ps1", "swift", "m",
+    "dart", "ex", "erl", "hs", "ml", "lua", "r", "jl", "cr", "nim", "d", "v", "f90", "pas", "tcl", "nu", "yaml",
+};
+
+#define FAMILY_COUNT (sizeof(families) / sizeof(families[0]))
+
+static const file_ext_t *family_ext;
+static text_t family_input;
+
+static void matcher_run(size_t iters) {
+    file_details_t file = {.contents = family_input.items, .path = "micro.src", .len = family_input.count};
+
+    for (size_t i = 0; i < iters; ++i) {
+        env_key_matches_t matches = {0};
+        scan_file_content(&scratch_arena, &file, family_ext, &matches);
+        sink += matches.count;
+        arena_reset(&scratch_arena);
+    }
+}
+
+static void matcher_teardown(void) {
+    arena_free(&scratch_arena);
+    free(family_input.items);
+    family_input = (text_t){0};
+}
+
+// ---------------------------------------------------------------------------
+// hashing and hash tables
+// ---------------------------------------------------------------------------
+
+#define HASH_KEYS 4096
+
+static char hash_keys[HASH_KEYS][32];
+static size_t hash_key_lens[HASH_KEYS];
+
+static void hash_keys_setup(void) {
+    for (size_t i = 0; i < HASH_KEYS; ++i) {
+        int n = snprintf(hash_keys[i], sizeof(hash_keys[i]), "SERVICE_%zu_%s", i * 2654435761u % 100000,
+                         (i & 1) ? "DATABASE_URL" : "API_KEY");
+        hash_key_lens[i] = (size_t)n;
+    }
+}
+
+static char fnv_input[64];
+static const size_t fnv_input_len = sizeof(fnv_input);
+
+static void fnv1a_run(size_t iters) {
+    uint64_t acc = 0;
+    for (size_t i = 0; i < iters; ++i) {
+        fnv_input[0] = (char)i;
+        acc ^= fnv1a(fnv_input, sizeof(fnv_input));
+    }
+    sink += (size_t)acc;
+}
+
+static void fnv1a_key_run(size_t iters) {
+    uint64_t acc = 0;
+    for (size_t i = 0; i < iters; ++i) {
+        size_t k = i & (HASH_KEYS - 1);
+        acc ^= fnv1a(hash_keys[k], hash_key_lens[k]);
+    }
+    sink += (size_t)acc;
+}
+
+// one op = filling a fresh map with HASH_KEYS keys
+static void hashmap_append_run(size_t iters) {
+    for (size_t i = 0; i < iters; ++i) {
+        hashmap_t map = {0};
+        for (size_t k = 0; k < HASH_KEYS; ++k) {
+            hashmap_append(&main_arena, &map, hash_keys[k], hash_key_lens[k], k);
+        }
+        sink += map.count;
+        arena_reset(&main_arena);
+    }
+}
+
+static hashmap_t lookup_map;
+
+static void hashmap_get_setup(void) {
+    hash_keys_setup();
+    lookup_map = (hashmap_t){0};
+    for (size_t k = 0; k < HASH_KEYS; ++k) {
+        hashmap_append(&main_arena, &lookup_map, hash_keys[k], hash_key_lens[k], k);
+    }
+}
+
+// one op = a single lookup; every other lookup misses (one character shorter)
+static void hashmap_get_run(size_t iters) {
+    size_t acc = 0;
+    for (size_t i = 0; i < iters; ++i) {
+        size_t k = i & (HASH_KEYS - 1);
+        acc += hashmap_get(&lookup_map, hash_keys[k], hash_key_lens[k] - (i & 1));
+    }
+    sink += acc;
+}
+
+static void arena_teardown(void) { arena_free(&main_arena); }
+
+// one op = filling a fresh set with HASH_KEYS keys, each appended twice
+static void hashset_append_run(size_t iters) {
+    for (size_t i = 0; i < iters; ++i) {
+        hashset_t set = {0};
+        for (size_t k = 0; k < HASH_KEYS; ++k) {
+            hashset_append(&main_arena, &set, hash_keys[k], hash_key_lens[k]);
+            hashset_append(&main_arena, &set, hash_keys[k], hash_key_lens[k]);
+        }
+        sink += set.count;
+        arena_reset(&main_arena);
+    }
+}
+
+// ---------------------------------------------------------------------------
+// arena
+// ---------------------------------------------------------------------------
+
+#define ARENA_OPS 4096
+
+static const size_t arena_extend_bytes = ARENA_OPS * 16;
+
+// one op = ARENA_OPS small, mixed-size allocations
+static void arena_alloc_run(size_t iters) {
+    for (size_t i = 0; i < iters; ++i) {
+        for (size_t k = 0; k < ARENA_OPS; ++k) {
+            char *p = arena_alloc(&main_arena, 8 + (k & 63));
+            p[0] = (char)k;
+        }
+        sink += (size_t)main_arena.head->offset;
+        arena_reset(&main_arena);
+    }
+}
+
+// one op = growing a buffer byte-run by byte-run to ARENA_OPS * 16 bytes, the
+// DYN_ARR_APPEND_MANY pattern (in place while it is the latest allocation)
+static void arena_extend_run(size_t iters) {
+    for (size_t i = 0; i < iters; ++i) {
+        char *p = NULL;
+        size_t len = 0;
+        for (size_t k = 0; k < ARENA_OPS; ++k) {
+            p = arena_extend(&main_arena, p, len, len + 16);
+            memset(p + len, 'x', 16);
+            len += 16;
+        }
+        sink += (size_t)p[len - 1];
+        arena_reset(&main_arena);
+    }
+}
+
+// ---------------------------------------------------------------------------
+// main
+// ---------------------------------------------------------------------------
+
+static bool selected(const char *filter, const char *name) { return filter == NULL || strstr(name, filter) != NULL; }
+
+int main(int argc, char **argv) {
+    const char *filter = argc > 1 ? argv[1] : NULL;
+
+    printf("%-26s %14s %10s %12s %10s\n", "benchmark", "ns/op", "variation", "bytes/cycle", "MB/s");
+
+    const bench_t fixed[] = {
+        {"tokenizer/generate_tokens", &env_input.count, tokenizer_setup, tokenizer_run, tokenizer_teardown},
+        {"parser/run_parser", &env_input.count, parser_setup, parser_run, parser_teardown},
+        {"hash/fnv1a-64b", &fnv_input_len, NULL, fnv1a_run, NULL},
+        {"hash/fnv1a-key", NULL, hash_keys_setup, fnv1a_key_run, NULL},
+        {"hashmap/append-4096", NULL, hash_keys_setup, hashmap_append_run, arena_teardown},
+        {"hashmap/get", NULL, hashmap_get_setup, hashmap_get_run, arena_teardown},
+        {"hashset/append-4096x2", NULL, hash_keys_setup, hashset_append_run, arena_teardown},
+        {"arena/alloc-4096", NULL, NULL, arena_alloc_run, arena_teardown},
+        {"arena/extend-4096", &arena_extend_bytes, NULL, arena_extend_run, arena_teardown},
+    };
+
+    for (size_t i = 0; i < sizeof(fixed) / sizeof(fixed[0]); ++i) {
+        if (selected(filter, fixed[i].name)) {
+            run_bench(&fixed[i]);
+        }
+    }
+
+    for (size_t f = 0; f < FAMILY_COUNT; ++f) {
+        char name[64];
+        snprintf(name, sizeof(name), "matcher/%s", families[f]);
+        if (!selected(filter, name)) {
+            continue;
+        }
+
+        family_ext = get_scan_extension(families[f]);
+        if (family_ext == NULL) {
+            fprintf(stderr, "unknown accessor family '%s'\n", families[f]);
+            return 1;
+        }
+
+        family_input = make_source_input(family_ext);
+
+        bench_t b = {name, &family_input.count, NULL, matcher_run, matcher_teardown};
+        run_bench(&b);
+    }
+
+    return 0;
+}
@@ -14,6 +14,7 @@
 #define NVI_FROM_SCANROOT "..\\..\\..\\nvi.exe"
 static void set_env(const char *k, const char *v) { _putenv_s(k, v); }
 #else
+#include <signal.h>
 #include <sys/stat.h>
 #include <sys/wait.h>
 #include <unistd.h>
@@ -138,6 +139,75 @@ static void check(const char *name, const char *bin, const char *args, int exit_
     check_full(name, bin, args, exit_code, expected_stdout, expected_stdout_len, stderr_contains, NULL);
 }
 
+// asserts a file written by the previous check contains 'needle'
+static void check_file_contains(const char *name, const char *path, const char *needle) {
+    ++total;
+
+    static char contents[65536];
+    read_file(path, contents, sizeof(contents));
+
+    if (strstr(contents, needle) != NULL) {
+        printf("PASS %zu - %s\n", total, name);
+        return;
+    }
+
+    ++failed;
+    printf("FAIL %zu - %s\n", total, name);
+    fprintf(stderr, "  %s must contain: %s\n", path, needle);
+    print_bytes("actual contents", contents, strlen(contents));
+}
+
+#if !defined(_WIN32)
+// waits up to 5s for 'path' to exist (or, with exists false, to be gone)
+static bool wait_for_path(const char *path, bool exists) {
+    struct stat st;
+    for (int i = 0; i < 100; ++i) {
+        if ((stat(path, &st) == 0) == exists) {
+            return true;
+        }
+        usleep(50 * 1000);
+    }
+    return false;
+}
+
+// starts `nvi serve` in the background on 'socket', writing its pid to 'pid_path'
+static bool start_server(const char *bin, const char *socket, const char *pid_path) {
+    char cmd[2048];
+    snprintf(cmd, sizeof(cmd), "NVI_SOCKET=%s %s serve >/dev/null 2>serve.log & echo $! >%s", socket, bin, pid_path);
+    return system(cmd) == 0 && wait_for_path(socket, true);
+}
+
+// waits up to 5s for 'path' to contain 'needle'
+static bool wait_for_contents(const char *path, const char *needle) {
+    static char contents[65536];
+    for (int i = 0; i < 100; ++i) {
+        read_file(path, contents, sizeof(contents));
+        if (strstr(contents, needle) != NULL) {
+            return true;
+        }
+        usleep(50 * 1000);
+    }
+    return false;
+}
+
+static void check_true(const char *name, bool ok) {
+    ++total;
+    if (ok) {
+        printf("PASS %zu - %s\n", total, name);
+    } else {
+        ++failed;
+        printf("FAIL %zu - %s\n", total, name);
+    }
+}
+
+static bool stop_server(const char *socket, const char *pid_path) {
+    char pid[32] = {0};
+    read_file(pid_path, pid, sizeof(pid));
+    remove(pid_path);
+    return kill((pid_t)atol(pid), SIGTERM) == 0 && wait_for_path(socket, false);
+}
+#endif
+
 #define EXPECT(lit) (lit), sizeof(lit) - 1
 #define NO_STDOUT NULL, 0         // asserts stdout is exactly empty
 #define ANY_STDOUT &any_stdout, 0 // skips the stdout assertion (eg. help/version)
@@ -170,13 +240,34 @@ static void setup_inputs(void) {
     write_file(IT_DIR "/export.env", EXPECT("export EXPORTED=value\n"));
     write_file(IT_DIR "/fallback.env", EXPECT("FB=${NVI_IT_NOT_SET:-fell back}\n"));
     write_file(IT_DIR "/undef.env", EXPECT("U=${NVI_IT_DEFINITELY_NOT_SET}\n"));
+    write_file(IT_DIR "/undef_keyless.env", EXPECT("K=\rA\n'x' x\r\r${ :#{xx:'$}# Bx\r"));
     write_file(IT_DIR "/badkey.env", EXPECT("MY KEY=1\n"));
     write_file(IT_DIR "/req_empty.env", EXPECT("EMPTYV=${NVI_IT_UNSET_EMPTY:-}\n"));
     make_dir(IT_DIR "/dir.env");
 
     write_file(IT_DIR "/scanroot/it.env", EXPECT("IT_SCAN_KEY=1\n"));
     write_file(IT_DIR "/scanroot/partial.env", EXPECT("UNRELATED=1\n"));
+    write_file(IT_DIR "/scanroot/interp.env", EXPECT("X=${NVI_IT_FROM_SHELL}\n"));
+    write_file(IT_DIR "/scanroot/empty.env", "", 0);
     write_file(IT_DIR "/scanroot/src.ts", EXPECT("const k = process.env.IT_SCAN_KEY;\n"));
+
+    // pruned by the scan's ignore files
+    write_file(IT_DIR "/scanroot/.gitignore", EXPECT("# build output\ngenerated/\n"));
+    make_dir(IT_DIR "/scanroot/generated");
+    write_file(IT_DIR "/scanroot/generated/gen.ts", EXPECT("const k = process.env.IT_GENERATED_KEY;\n"));
+    make_dir(IT_DIR "/scanroot/lib");
+    write_file(IT_DIR "/scanroot/lib/.nviignore", EXPECT("*.ts\n"));
+    write_file(IT_DIR "/scanroot/lib/skip.ts", EXPECT("const k = process.env.IT_NVIIGNORED_KEY;\n"));
+    // skipped by default for its NUL byte
+    write_file(IT_DIR "/scanroot/blob.ts", EXPECT("const k = process.env.IT_BINARY_KEY;\0\1\2\n"));
+
+    // sniffed by a NUL byte, by name and by an @generated marker; kept apart so the minified and
+    // generated keys, scanned by default, aren't required by the scanroot cases
+    make_dir(IT_DIR "/sniffroot");
+    write_file(IT_DIR "/sniffroot/it.env", EXPECT("IT_SNIFF_KEY=1\n"));
+    write_file(IT_DIR "/sniffroot/blob.ts", EXPECT("const k = process.env.IT_BINARY_KEY;\0\1\2\n"));
+    write_file(IT_DIR "/sniffroot/vendor.min.ts", EXPECT("const k = process.env.IT_MINIFIED_KEY;\n"));
+    write_file(IT_DIR "/sniffroot/schema.ts", EXPECT("// @generated\nconst k = process.env.IT_MARKED_KEY;\n"));
 }
 
 int main(void) {
@@ -247,6 +338,9 @@ int main(void) {
     check("an undefined interpolation without a fallback is a loud error", NVI_BIN, "--files build/it/undef.env -- x",
           1, NO_STDOUT, "not defined");
 
+    check("an undefined interpolation in a keyless value is a loud error", NVI_BIN,
+          "--files build/it/undef_keyless.env -- x", 1, NO_STDOUT, "The '(none)' key contains an interpolated key");
+
     check("a required key that resolves empty is a loud error", NVI_BIN,
           "--files build/it/req_empty.env --required EMPTYV -- x", 1, NO_STDOUT, "EMPTYV");
 
@@ -292,6 +386,24 @@ int main(void) {
     check_full("dry run with -R exposes values", NVI_BIN, "--files build/it/secret.env --dry-run -R", 0, NO_STDOUT,
                "s3cr3tvalue", "*****");
 
+    // --- stats ---
+
+    check("stats leave stdout untouched and report phases to stderr", NVI_BIN,
+          "--files build/it/a.env --stats -F nul -- x", 0, EXPECT("MESSAGE=hello\0GREETING=hello world\0x\0"),
+          "Phase timings");
+
+    check("json stats report the env map probes", NVI_BIN, "--files build/it/a.env --stats json", 0, NO_STDOUT,
+          "\"env_map\":{\"entries\":2,");
+
+    check("stats report the hardware counters or why they are unavailable", NVI_BIN,
+          "--files build/it/a.env --stats", 0, NO_STDOUT, "Hardware counters");
+
+    check("json stats report the hardware counter availability", NVI_BIN, "--files build/it/a.env --stats json", 0,
+          NO_STDOUT, "\"perf\":{\"available\":");
+
+    check("an unknown stats format is a usage error", NVI_BIN, "--files build/it/a.env --stats yaml", 2, NO_STDOUT,
+          "expected: text|json");
+
     // --- config file ---
 
     check("a config file supplies flags", NVI_BIN, "@build/it/config.nvi -- echo hi", 0,
@@ -314,6 +426,44 @@ int main(void) {
     check("the example config file loads end to end", NVI_BIN, "@fixtures/.nvi.example", 0, NO_STDOUT,
           "fixtures/.nvi.example");
 
+#if !defined(_WIN32)
+    // --- snapshots ---
+
+    set_env("NVI_SNAPSHOT_DIR", IT_DIR);
+    remove(IT_DIR "/nvi-it.snap");
+
+    check("publishing a snapshot still emits the command", NVI_BIN, "--files build/it/a.env --publish it -F nul -- x",
+          0, EXPECT("MESSAGE=hello\0GREETING=hello world\0x\0"), NULL);
+
+    check("a snapshot emits the published ENVs", NVI_BIN, "--snapshot it -F nul -- echo hi", 0,
+          EXPECT("MESSAGE=hello\0GREETING=hello world\0echo\0hi\0"), NULL);
+
+    check("a snapshot emits in the powershell format", NVI_BIN, "--snapshot it -F powershell -- x", 0,
+          EXPECT("$env:MESSAGE = 'hello'\n$env:GREETING = 'hello world'\n& 'x'\n"), NULL);
+
+    check("a snapshot checks the required keys", NVI_BIN, "--snapshot it --required MISSING_KEY -- x", 1, NO_STDOUT,
+          "MISSING_KEY");
+
+    check("publishing only needs --files", NVI_BIN, "--files build/it/b.env --publish it", 0, NO_STDOUT, NULL);
+
+    check("republishing bumps the generation", NVI_BIN, "--snapshot it --dry-run", 0, NO_STDOUT,
+          "Mapped generation 2 of the 'it' snapshot");
+
+    check("an unpublished snapshot is a loud error", NVI_BIN, "--snapshot never-published -- x", 1, NO_STDOUT,
+          "Unable to read the 'never-published' snapshot");
+
+    write_file(IT_DIR "/nvi-torn.snap", EXPECT("NVISNAP\0 not a complete snapshot"));
+    check("a truncated snapshot is a loud error", NVI_BIN, "--snapshot torn -- x", 1, NO_STDOUT, "truncated header");
+
+    check("a snapshot name with a path is a usage error", NVI_BIN, "--snapshot ../it -- x", 2, NO_STDOUT,
+          "invalid snapshot name");
+
+    check("--snapshot with --files is a usage error", NVI_BIN, "--snapshot it --files build/it/a.env -- x", 2,
+          NO_STDOUT, "can't be combined with the '--files' flag");
+
+    set_env("NVI_SNAPSHOT_DIR", "");
+#endif
+
     // --- scanner (runs relative to cwd, so hop into the scratch tree) ---
 
     if (chdir(IT_DIR "/scanroot") != 0) {
@@ -332,7 +482,158 @@ int main(void) {
     check("scan-required key rescued by --ignored passes", NVI_FROM_SCANROOT,
           "--scan ts --ignored IT_SCAN_KEY --files partial.env -F nul -- x", 0, EXPECT("UNRELATED=1\0x\0"), NULL);
 
+    check("json stats count scanned and skipped files", NVI_FROM_SCANROOT, "--scan ts --files it.env --stats json", 0,
+          NO_STDOUT, "\"files\":1,\"bytes_read\":35,");
+
+    check_full("gitignored directories are never walked", NVI_FROM_SCANROOT, "--scan ts --dry-run", 0, NO_STDOUT,
+               "IT_SCAN_KEY", "IT_GENERATED_KEY");
+    check_full(".nviignore rules skip files", NVI_FROM_SCANROOT, "--scan ts --dry-run", 0, NO_STDOUT, "IT_SCAN_KEY",
+               "IT_NVIIGNORED_KEY");
+    check("stats count ignored entries", NVI_FROM_SCANROOT, "--scan ts --files it.env --stats json", 0, NO_STDOUT,
+          "\"ignored\":2,");
+
+    // the sibling sniffroot sits as deep as scanroot, so the binary path holds
+    if (chdir("../sniffroot") == 0) {
+        check_full("only binary files are skipped by default", NVI_FROM_SCANROOT, "--scan ts --dry-run", 0, NO_STDOUT,
+                   "Skipped 1 binary, 0 minified and 0 generated file", "IT_BINARY_KEY");
+        check("minified and generated files are scanned by default", NVI_FROM_SCANROOT, "--scan ts --dry-run", 0,
+              NO_STDOUT, "IT_MARKED_KEY");
+        check_full("--scan-skip skips minified and generated files on request", NVI_FROM_SCANROOT,
+                   "--scan ts --scan-skip binary minified generated --dry-run", 0, NO_STDOUT,
+                   "Skipped 1 binary, 1 minified and 1 generated files", "IT_MARKED_KEY");
+        check("stats count sniffed files by kind", NVI_FROM_SCANROOT,
+              "--scan ts --scan-skip binary minified generated --files it.env --stats json", 0, NO_STDOUT,
+              "\"binary\":1,\"minified\":1,\"generated\":1,");
+        check("--scan-skip picks the kinds to skip", NVI_FROM_SCANROOT,
+              "--scan ts --scan-skip binary minified --dry-run", 0, NO_STDOUT, "IT_MARKED_KEY");
+        (void)!chdir("../scanroot");
+    }
+
+    check("--threads auto scans with what the CPU quota allows", NVI_FROM_SCANROOT,
+          "--scan ts --files it.env --threads auto -- x", 0, EXPECT("IT_SCAN_KEY=1\0x\0"), NULL);
+
+    check("--scan-schedule largest-first finds the same keys", NVI_FROM_SCANROOT,
+          "--scan ts --files it.env --scan-schedule largest-first -- x", 0, EXPECT("IT_SCAN_KEY=1\0x\0"), NULL);
+
+    check("a trace leaves stdout untouched", NVI_FROM_SCANROOT, "--scan ts --files it.env --trace it_trace.json -- x",
+          0, EXPECT("IT_SCAN_KEY=1\0x\0"), NULL);
+    check_file_contains("the trace records scanned files", "it_trace.json",
+                        "\"name\":\"scan_file\",\"ph\":\"X\"");
+    check_file_contains("the trace names the scan workers", "it_trace.json", "\"name\":\"scan worker 0\"");
+    check_file_contains("the trace is a closed trace-event document", "it_trace.json", "\n]}\n");
+
+    check("an unwritable trace file is a loud error", NVI_FROM_SCANROOT,
+          "--scan ts --files it.env --trace missing/trace.json -- x", 1, NO_STDOUT, "Unable to open the trace file");
+
 #if !defined(_WIN32)
+    // --- serve ---
+
+    static char socket_path[1024];
+    if (getcwd(socket_path, sizeof(socket_path) - 16) == NULL) {
+        fprintf(stderr, "[ERROR] cannot determine the scratch directory\n");
+        return 1;
+    }
+    strcat(socket_path, "/nvi.sock");
+
+    ++total;
+    if (start_server(NVI_FROM_SCANROOT, socket_path, "serve.pid")) {
+        printf("PASS %zu - the server listens on NVI_SOCKET\n", total);
+    } else {
+        ++failed;
+        printf("FAIL %zu - the server listens on NVI_SOCKET\n", total);
+    }
+    set_env("NVI_SOCKET", socket_path);
+
+    check("a client emits what a local run would", NVI_FROM_SCANROOT,
+          "--client --scan ts --files it.env -F nul -- x", 0, EXPECT("IT_SCAN_KEY=1\0x\0"), NULL);
+    check("a cached scan is served again", NVI_FROM_SCANROOT, "--client --scan ts --files it.env -F nul -- x", 0,
+          EXPECT("IT_SCAN_KEY=1\0x\0"), NULL);
+
+    write_file("added.ts", EXPECT("const k = process.env.IT_ADDED_KEY;\n"));
+    check("a new file in a watched directory invalidates the cached scan", NVI_FROM_SCANROOT,
+          "--client --scan ts --files it.env -F nul -- x", 1, NO_STDOUT, "IT_ADDED_KEY");
+    remove("added.ts");
+
+    check("a client request interpolates the client's environment", NVI_FROM_SCANROOT,
+          "--client --files interp.env -F nul -- x", 0, EXPECT("X=fromshell\0x\0"), NULL);
+    check("a client request reports errors on the client's stderr", NVI_FROM_SCANROOT,
+          "--client --files empty.env -- x", 1, NO_STDOUT, "is empty");
+    check("a second server on the same socket is refused", NVI_FROM_SCANROOT, "serve", 1, NO_STDOUT,
+          "already listening");
+
+    ++total;
+    if (stop_server(socket_path, "serve.pid")) {
+        printf("PASS %zu - the server removes its socket when stopped\n", total);
+    } else {
+        ++failed;
+        printf("FAIL %zu - the server removes its socket when stopped\n", total);
+    }
+
+    check("a client without a server is a loud error", NVI_FROM_SCANROOT, "--client --files it.env", 1, NO_STDOUT,
+          "Unable to connect to the nvi server");
+    set_env("NVI_SOCKET", "");
+
+    // --- watch ---
+
+    check("--watch without a command is a usage error", NVI_FROM_SCANROOT, "--watch --files it.env", 2, NO_STDOUT,
+          "requires a '--' command");
+
+    // the command logs each start with its ENV and each SIGTERM it receives
+    remove("watch.out");
+    write_file("watch.env", EXPECT("IT_WATCH=1\n"));
+    (void)system(NVI_FROM_SCANROOT " --watch --files watch.env -- sh -c 'trap \"echo stopped >>watch.out; exit 0\" "
+                 "TERM; echo start $IT_WATCH >>watch.out; while :; do sleep 0.05; done' 2>watch.log & echo $! "
+                 ">watch.pid");
+    check_true("--watch runs the command with the ENVs", wait_for_contents("watch.out", "start 1\n"));
+
+    write_file("watch.env", EXPECT("IT_WATCH=2\n"));
+    check_true("--watch restarts the command when the ENVs change",
+               wait_for_contents("watch.out", "start 1\nstopped\nstart 2\n"));
+
+    write_file("watch.env", EXPECT("# unrelated\nIT_WATCH=2\n"));
+    check_true("--watch keeps the command running when the ENVs didn't change",
+               wait_for_contents("watch.log", "without changing the ENVs"));
+
+    char watch_pid[32] = {0};
+    read_file("watch.pid", watch_pid, sizeof(watch_pid));
+    kill((pid_t)atol(watch_pid), SIGTERM);
+    check_true("--watch forwards SIGTERM to the command",
+               wait_for_contents("watch.out", "start 1\nstopped\nstart 2\nstopped\n"));
+    remove("watch.env");
+    remove("watch.out");
+    remove("watch.log");
+    remove("watch.pid");
+
+    write_file("listed.txt", EXPECT("generated/gen.ts\r\nREADME.md\n"));
+    check_full("--scan-from scans only the listed files", NVI_FROM_SCANROOT,
+               "--scan ts --scan-from listed.txt --dry-run --stats json", 0, NO_STDOUT, "\"extension\":1,",
+               "IT_SCAN_KEY");
+    check("--scan-from reads NUL-delimited paths from stdin",
+          "printf 'src.ts\\0generated/gen.ts\\0' | " NVI_FROM_SCANROOT, "--scan ts --scan-from - --dry-run", 0,
+          NO_STDOUT, "IT_GENERATED_KEY");
+    check("--scan-from works with a largest-first schedule",
+          "printf 'src.ts\\0generated/gen.ts\\0' | " NVI_FROM_SCANROOT,
+          "--scan ts --scan-from - --scan-schedule largest-first --dry-run", 0, NO_STDOUT, "IT_GENERATED_KEY");
+    remove("listed.txt");
+
+    check("a git-index scan outside a checkout is a loud error", NVI_FROM_SCANROOT,
+          "--scan ts --scan-source git-index --dry-run", 1, NO_STDOUT, "Unable to read the git index");
+
+    // only tracked files are scanned from the git index (needs a git binary to build one)
+    if (system("git --version >/dev/null 2>&1") == 0) {
+        make_dir("gitroot");
+        write_file("gitroot/tracked.ts", EXPECT("const k = process.env.IT_TRACKED_KEY;\n"));
+        write_file("gitroot/untracked.ts", EXPECT("const k = process.env.IT_UNTRACKED_KEY;\n"));
+        (void)system("cd gitroot && git init -q . && git add tracked.ts");
+        if (chdir("gitroot") == 0) {
+            check_full("a git-index scan reads only tracked files", "../" NVI_FROM_SCANROOT,
+                       "--scan ts --scan-source git-index --dry-run", 0, NO_STDOUT, "IT_TRACKED_KEY",
+                       "IT_UNTRACKED_KEY");
+            (void)!chdir("..");
+        }
+        (void)system("rm -rf gitroot");
+    }
+
     // a symlink cycle must be skipped, not followed to death
     (void)system("ln -sfn .. loop");
     check("symlinked directories are not followed", NVI_FROM_SCANROOT, "--scan ts --files it.env -F nul -- x", 0,
@@ -6,6 +6,7 @@
 #include "nthread.h"
 #include "test_capture.h"
 #include "unity.h"
+#include <stdio.h>
 #include <string.h>
 
 static arena_t test_arena;
@@ -96,6 +97,39 @@ static void test_errors_on_invalid_format(void) {
     TEST_ASSERT_FALSE(r.ok);
 }
 
+static void test_stats_defaults_to_off(void) {
+    const char *argv[] = {"nvi", "--files", ".env"};
+    args_t a = {0};
+    result_t r = parse_args_silent(ARR_LEN(argv), argv, &a);
+    TEST_ASSERT_TRUE(r.ok);
+    TEST_ASSERT_EQUAL_INT(STATS_OFF, a.stats);
+}
+
+static void test_bare_stats_flag_reports_text(void) {
+    const char *argv[] = {"nvi", "--stats", "--files", ".env"};
+    args_t a = {0};
+    result_t r = parse_args_silent(ARR_LEN(argv), argv, &a);
+    TEST_ASSERT_TRUE(r.ok);
+    TEST_ASSERT_EQUAL_INT(STATS_TEXT, a.stats);
+    TEST_ASSERT_EQUAL_size_t(1, a.files.count);
+}
+
+static void test_parses_stats_json_format(void) {
+    const char *argv[] = {"nvi", "--files", ".env", "--stats", "json"};
+    args_t a = {0};
+    result_t r = parse_args_silent(ARR_LEN(argv), argv, &a);
+    TEST_ASSERT_TRUE(r.ok);
+    TEST_ASSERT_EQUAL_INT(STATS_JSON, a.stats);
+}
+
+static void test_errors_on_invalid_stats_format(void) {
+    const char *argv[] = {"nvi", "--files", ".env", "--stats", "yaml"};
+    args_t a = {0};
+    result_t r = parse_args_silent(ARR_LEN(argv), argv, &a);
+    TEST_ASSERT_FALSE(r.ok);
+    TEST_ASSERT_EQUAL_INT(2, r.code);
+}
+
 // --- required / ignored ---
 
 static void test_parses_required_envs(void) {
@@ -133,6 +167,16 @@ static void test_parses_threads_flag(void) {
     TEST_ASSERT_EQUAL_size_t((size_t)max, a.scan_threads);
 }
 
+static void test_parses_threads_auto(void) {
+    const char *argv[] = {"nvi", "--scan", "c", "--threads", "auto", "--", "echo", "hello"};
+    args_t a = {0};
+    result_t r = parse_args_direct(ARR_LEN(argv), argv, &a);
+    TEST_ASSERT_TRUE(r.ok);
+    TEST_ASSERT_TRUE(a.scan_threads_auto);
+    TEST_ASSERT_EQUAL_size_t(available_thread_count(), a.scan_threads);
+    TEST_ASSERT_TRUE(a.scan_threads >= 1 && a.scan_threads <= thread_count());
+}
+
 static void test_errors_on_invalid_threads_flag(void) {
     const char *argv[] = {"nvi", "--threads", "abc"};
     args_t a = {0};
@@ -159,6 +203,150 @@ static void test_errors_on_unsupported_scan_extension(void) {
     TEST_ASSERT_FALSE(r.ok);
 }
 
+static void test_scan_source_defaults_to_walk(void) {
+    const char *argv[] = {"nvi", "--scan", "ts", "--dry-run"};
+    args_t a = {0};
+    result_t r = parse_args_silent(ARR_LEN(argv), argv, &a);
+    TEST_ASSERT_TRUE(r.ok);
+    TEST_ASSERT_EQUAL_INT(SCAN_SOURCE_WALK, a.scan_source);
+}
+
+static void test_parses_scan_source_flag(void) {
+    const char *argv[] = {"nvi", "--scan", "ts", "--scan-source", "git-index", "--dry-run"};
+    args_t a = {0};
+    result_t r = parse_args_silent(ARR_LEN(argv), argv, &a);
+    TEST_ASSERT_TRUE(r.ok);
+    TEST_ASSERT_EQUAL_INT(SCAN_SOURCE_GIT_INDEX, a.scan_source);
+}
+
+static void test_errors_on_scan_source_without_scan(void) {
+    const char *argv[] = {"nvi", "--files", ".env", "--scan-source", "git-index"};
+    args_t a = {0};
+    result_t r = parse_args_silent(ARR_LEN(argv), argv, &a);
+    TEST_ASSERT_FALSE(r.ok);
+    TEST_ASSERT_EQUAL_INT(2, r.code);
+}
+
+static void test_errors_on_invalid_scan_source(void) {
+    const char *argv[] = {"nvi", "--scan", "ts", "--scan-source", "svn", "--dry-run"};
+    args_t a = {0};
+    result_t r = parse_args_silent(ARR_LEN(argv), argv, &a);
+    TEST_ASSERT_FALSE(r.ok);
+}
+
+static void test_scan_skip_defaults_to_binary(void) {
+    const char *argv[] = {"nvi", "--scan", "ts", "--dry-run"};
+    args_t a = {0};
+    result_t r = parse_args_silent(ARR_LEN(argv), argv, &a);
+    TEST_ASSERT_TRUE(r.ok);
+    TEST_ASSERT_EQUAL_UINT(SNIFF_BIT(SNIFF_BINARY), a.scan_skip);
+}
+
+static void test_parses_scan_skip_flag(void) {
+    const char *argv[] = {"nvi", "--scan", "ts", "--scan-skip", "binary", "generated", "--dry-run"};
+    args_t a = {0};
+    result_t r = parse_args_silent(ARR_LEN(argv), argv, &a);
+    TEST_ASSERT_TRUE(r.ok);
+    TEST_ASSERT_EQUAL_UINT(SNIFF_BIT(SNIFF_BINARY) | SNIFF_BIT(SNIFF_GENERATED), a.scan_skip);
+
+    const char *none[] = {"nvi", "--scan", "ts", "--scan-skip", "none", "--dry-run"};
+    args_t b = {0};
+    r = parse_args_silent(ARR_LEN(none), none, &b);
+    TEST_ASSERT_TRUE(r.ok);
+    TEST_ASSERT_EQUAL_UINT(0, b.scan_skip);
+}
+
+static void test_errors_on_invalid_scan_skip(void) {
+    const char *argv[] = {"nvi", "--scan", "ts", "--scan-skip", "vendored", "--dry-run"};
+    args_t a = {0};
+    result_t r = parse_args_silent(ARR_LEN(argv), argv, &a);
+    TEST_ASSERT_FALSE(r.ok);
+    TEST_ASSERT_EQUAL_INT(2, r.code);
+}
+
+static void test_scan_memory_defaults_to_512mb(void) {
+    const char *argv[] = {"nvi", "--scan", "ts", "--dry-run"};
+    args_t a = {0};
+    result_t r = parse_args_silent(ARR_LEN(argv), argv, &a);
+    TEST_ASSERT_TRUE(r.ok);
+    TEST_ASSERT_EQUAL_size_t(SCAN_MEMORY_DEFAULT_MB * SCAN_MEMORY_MB, a.scan_memory);
+}
+
+static void test_parses_scan_memory_flag(void) {
+    const char *argv[] = {"nvi", "--scan", "ts", "--scan-memory", "64", "--dry-run"};
+    args_t a = {0};
+    result_t r = parse_args_silent(ARR_LEN(argv), argv, &a);
+    TEST_ASSERT_TRUE(r.ok);
+    TEST_ASSERT_EQUAL_size_t(64 * SCAN_MEMORY_MB, a.scan_memory);
+}
+
+static void test_errors_on_invalid_scan_memory(void) {
+    const char *invalid[] = {"0", "-1", "64MB", "", "99999999999999999999"};
+    for (size_t i = 0; i < ARR_LEN(invalid); ++i) {
+        const char *argv[] = {"nvi", "--scan", "ts", "--scan-memory", invalid[i], "--dry-run"};
+        args_t a = {0};
+        result_t r = parse_args_silent(ARR_LEN(argv), argv, &a);
+        TEST_ASSERT_FALSE(r.ok);
+        TEST_ASSERT_EQUAL_INT(2, r.code);
+    }
+}
+
+static void test_scan_memory_cap_fits_in_size_t(void) {
+    char max[32];
+    char over[32];
+    snprintf(max, sizeof(max), "%zu", SCAN_MEMORY_MAX_MB);
+    snprintf(over, sizeof(over), "%zu", SCAN_MEMORY_MAX_MB + 1);
+
+    const char *argv[] = {"nvi", "--scan", "ts", "--scan-memory", max, "--dry-run"};
+    args_t a = {0};
+    TEST_ASSERT_TRUE(parse_args_silent(ARR_LEN(argv), argv, &a).ok);
+    TEST_ASSERT_EQUAL_size_t(SCAN_MEMORY_MAX_MB, a.scan_memory / SCAN_MEMORY_MB);
+
+    argv[4] = over;
+    args_t b = {0};
+    TEST_ASSERT_FALSE(parse_args_silent(ARR_LEN(argv), argv, &b).ok);
+}
+
+static void test_parses_scan_schedule_flag(void) {
+    const char *argv[] = {"nvi", "--scan", "ts", "--dry-run"};
+    args_t a = {0};
+    result_t r = parse_args_silent(ARR_LEN(argv), argv, &a);
+    TEST_ASSERT_TRUE(r.ok);
+    TEST_ASSERT_EQUAL_INT(SCAN_SCHEDULE_WALK, a.scan_schedule);
+
+    const char *largest[] = {"nvi", "--scan", "ts", "--scan-schedule", "largest-first", "--dry-run"};
+    args_t b = {0};
+    r = parse_args_silent(ARR_LEN(largest), largest, &b);
+    TEST_ASSERT_TRUE(r.ok);
+    TEST_ASSERT_EQUAL_INT(SCAN_SCHEDULE_LARGEST_FIRST, b.scan_schedule);
+}
+
+static void test_errors_on_invalid_scan_schedule(void) {
+    const char *argv[] = {"nvi", "--scan", "ts", "--scan-schedule", "fastest", "--dry-run"};
+    args_t a = {0};
+    result_t r = parse_args_silent(ARR_LEN(argv), argv, &a);
+    TEST_ASSERT_FALSE(r.ok);
+    TEST_ASSERT_EQUAL_INT(2, r.code);
+}
+
+static void test_parses_scan_from_stdin(void) {
+    const char *argv[] = {"nvi", "--scan", "ts", "--scan-from", "-", "--dry-run"};
+    args_t a = {0};
+    result_t r = parse_args_silent(ARR_LEN(argv), argv, &a);
+    TEST_ASSERT_TRUE(r.ok);
+    TEST_ASSERT_EQUAL_STRING("-", a.scan_from);
+    TEST_ASSERT_TRUE(a.dry_run);
+}
+
+static void test_errors_on_scan_from_with_scan_source(void) {
+    const char *argv[] = {"nvi", "--scan", "ts", "--scan-from", "staged.txt", "--scan-source", "git-index",
+                          "--dry-run"};
+    args_t a = {0};
+    result_t r = parse_args_silent(ARR_LEN(argv), argv, &a);
+    TEST_ASSERT_FALSE(r.ok);
+    TEST_ASSERT_EQUAL_INT(2, r.code);
+}
+
 // --- dry-run, delimiter, unknown, help/version ---
 
 static void test_parses_dry_run_flag(void) {
@@ -221,6 +409,29 @@ static void test_delimiter_sets_command(void) {
     TEST_ASSERT_EQUAL_STRING("hi", a.command.items[1]);
 }
 
+static void test_parses_watch_flag(void) {
+    const char *argv[] = {"nvi", "--watch", "--files", ".env", "--", "npm", "start"};
+    args_t a = {0};
+    result_t r = parse_args_direct(ARR_LEN(argv), argv, &a);
+    TEST_ASSERT_TRUE(r.ok);
+    TEST_ASSERT_TRUE(a.watch);
+    TEST_ASSERT_EQUAL_size_t(2, a.command.count);
+}
+
+static void test_errors_on_watch_without_command_or_files(void) {
+    const char *no_command[] = {"nvi", "--watch", "--files", ".env"};
+    args_t a = {0};
+    result_t r = parse_args_silent(ARR_LEN(no_command), no_command, &a);
+    TEST_ASSERT_FALSE(r.ok);
+    TEST_ASSERT_EQUAL_INT(USAGE_FAILURE.code, r.code);
+
+    const char *no_files[] = {"nvi", "--watch", "--scan", "ts", "--", "npm", "start"};
+    args_t b = {0};
+    r = parse_args_silent(ARR_LEN(no_files), no_files, &b);
+    TEST_ASSERT_FALSE(r.ok);
+    TEST_ASSERT_EQUAL_INT(USAGE_FAILURE.code, r.code);
+}
+
 static void test_errors_on_unknown_flag(void) {
     const char *argv[] = {"nvi", "--files", ".env", "--unknown", "x"};
     args_t a = {0};
@@ -257,12 +468,32 @@ int main(void) {
     RUN_TEST(test_errors_on_missing_files_param);
     RUN_TEST(test_parses_format_flag);
     RUN_TEST(test_errors_on_invalid_format);
+    RUN_TEST(test_stats_defaults_to_off);
+    RUN_TEST(test_bare_stats_flag_reports_text);
+    RUN_TEST(test_parses_stats_json_format);
+    RUN_TEST(test_errors_on_invalid_stats_format);
     RUN_TEST(test_parses_required_envs);
     RUN_TEST(test_parses_ignored_envs);
     RUN_TEST(test_parses_threads_flag);
+    RUN_TEST(test_parses_threads_auto);
     RUN_TEST(test_errors_on_invalid_threads_flag);
     RUN_TEST(test_parses_scan_extensions);
     RUN_TEST(test_errors_on_unsupported_scan_extension);
+    RUN_TEST(test_scan_source_defaults_to_walk);
+    RUN_TEST(test_parses_scan_source_flag);
+    RUN_TEST(test_errors_on_scan_source_without_scan);
+    RUN_TEST(test_errors_on_invalid_scan_source);
+    RUN_TEST(test_scan_skip_defaults_to_binary);
+    RUN_TEST(test_parses_scan_skip_flag);
+    RUN_TEST(test_errors_on_invalid_scan_skip);
+    RUN_TEST(test_scan_memory_defaults_to_512mb);
+    RUN_TEST(test_parses_scan_memory_flag);
+    RUN_TEST(test_errors_on_invalid_scan_memory);
+    RUN_TEST(test_scan_memory_cap_fits_in_size_t);
+    RUN_TEST(test_parses_scan_schedule_flag);
+    RUN_TEST(test_errors_on_invalid_scan_schedule);
+    RUN_TEST(test_parses_scan_from_stdin);
+    RUN_TEST(test_errors_on_scan_from_with_scan_source);
     RUN_TEST(test_parses_dry_run_flag);
     RUN_TEST(test_reveal_defaults_to_false);
     RUN_TEST(test_parses_reveal_flag);
@@ -270,6 +501,8 @@ int main(void) {
     RUN_TEST(test_copies_config_path_from_config);
     RUN_TEST(test_config_path_defaults_to_null);
     RUN_TEST(test_delimiter_sets_command);
+    RUN_TEST(test_parses_watch_flag);
+    RUN_TEST(test_errors_on_watch_without_command_or_files);
     RUN_TEST(test_errors_on_unknown_flag);
     RUN_TEST(test_help_short_circuits);
     RUN_TEST(test_version_short_circuits);
@@ -0,0 +1,256 @@
+#include "arena.h"
+#include "arg.h"
+#include "engine.h"
+#include "parser.h"
+#include "test_capture.h"
+#include "tokenizer.h"
+#include "unity.h"
+#include <stdlib.h>
+#include <string.h>
+
+static arena_t test_arena;
+static engine_t engine;
+static args_t args;
+
+void setUp(void) {
+    test_arena = (arena_t){0};
+    engine = (engine_t){0};
+    args = (args_t){0};
+}
+
+void tearDown(void) {
+    engine_free(&engine);
+    arena_free(&test_arena);
+}
+
+#if defined(_WIN32) && defined(_MSC_VER)
+static void set_env(const char *k, const char *v) { _putenv_s(k, v); }
+static void clear_env(const char *k) { _putenv_s(k, ""); }
+#else
+static void set_env(const char *k, const char *v) { setenv(k, v, 1); }
+static void clear_env(const char *k) { unsetenv(k); }
+#endif
+
+// each call tokenizes a fresh copy, like a watched file that was read again
+static token_list_t tokenize(const char *src) {
+    file_details_t file = {.contents = arena_strdup(&test_arena, src), .path = "test.env", .len = strlen(src)};
+    arena_t scratch = {0};
+    tokenizer_t tokenizer = {0};
+    result_t r = generate_tokens(&test_arena, &scratch, &args, &file, &tokenizer);
+    arena_free(&scratch);
+    TEST_ASSERT_TRUE(r.ok);
+    return tokenizer.tokens;
+}
+
+typedef struct {
+    const token_list_t *tokens;
+    list_t *changed;
+    result_t result;
+} update_ctx_t;
+
+static void call_update(void *ctx) {
+    update_ctx_t *c = ctx;
+    c->result = engine_update(&engine, &args, c->tokens, c->changed);
+}
+
+static result_t update_silent(const token_list_t *tokens, list_t *changed) {
+    update_ctx_t ctx = {.tokens = tokens, .changed = changed};
+    char sink[1];
+    capture_fd(stderr, sink, sizeof(sink), call_update, &ctx);
+    return ctx.result;
+}
+
+static const char *value_of(const char *key) {
+    const env_t *env = get_env_from_map(&engine.env_map, key);
+    return env != NULL ? env->value : NULL;
+}
+
+static bool lists(const list_t *changed, const char *key) {
+    for (size_t i = 0; i < changed->count; ++i) {
+        if (strcmp(changed->items[i], key) == 0) {
+            return true;
+        }
+    }
+    return false;
+}
+
+static void test_first_update_evaluates_everything(void) {
+    token_list_t tokens = tokenize("A=1\nB=${A}2\nC=3\n");
+    list_t changed = {0};
+
+    TEST_ASSERT_TRUE(engine_update(&engine, &args, &tokens, &changed).ok);
+    TEST_ASSERT_EQUAL_size_t(3, engine.evaluated);
+    TEST_ASSERT_EQUAL_size_t(3, changed.count);
+    TEST_ASSERT_EQUAL_STRING("12", value_of("B"));
+}
+
+static void test_recomputes_only_changed_keys_and_dependents(void) {
+    token_list_t tokens = tokenize("A=1\nB=${A}2\nC=3\nD=${C}\n");
+    list_t changed = {0};
+    TEST_ASSERT_TRUE(engine_update(&engine, &args, &tokens, &changed).ok);
+
+    tokens = tokenize("A=9\nB=${A}2\nC=3\nD=${C}\n");
+    TEST_ASSERT_TRUE(engine_update(&engine, &args, &tokens, &changed).ok);
+
+    // A and its dependent B; C and D keep their values
+    TEST_ASSERT_EQUAL_size_t(2, engine.evaluated);
+    TEST_ASSERT_EQUAL_size_t(2, changed.count);
+    TEST_ASSERT_TRUE(lists(&changed, "A"));
+    TEST_ASSERT_TRUE(lists(&changed, "B"));
+    TEST_ASSERT_EQUAL_STRING("92", value_of("B"));
+    TEST_ASSERT_EQUAL_STRING("3", value_of("D"));
+}
+
+static size_t generation_bytes(void) {
+    size_t bytes = 0;
+    for (const arena_chunk_t *chunk = engine.generation_arena.head; chunk != NULL; chunk = chunk->next) {
+        bytes += chunk->capacity;
+    }
+    return bytes;
+}
+
+static void test_updates_free_the_generation_they_replace(void) {
+    list_t changed = {0};
+    token_list_t tokens = tokenize("A=1\nB=${A}2\nC=3\nD=${C}\n");
+    TEST_ASSERT_TRUE(engine_update(&engine, &args, &tokens, &changed).ok);
+    size_t first = generation_bytes();
+
+    for (int i = 0; i < 500; ++i) {
+        tokens = tokenize(i % 2 == 0 ? "A=9\nB=${A}2\nC=3\nD=${C}\n" : "A=1\nB=${A}2\nC=3\nD=${C}\n");
+        TEST_ASSERT_TRUE(engine_update(&engine, &args, &tokens, &changed).ok);
+    }
+
+    TEST_ASSERT_EQUAL_size_t(first, generation_bytes());
+    TEST_ASSERT_EQUAL_STRING("12", value_of("B"));
+    TEST_ASSERT_EQUAL_STRING("3", value_of("D"));
+}
+
+static void test_unchanged_tokens_evaluate_nothing(void) {
+    token_list_t tokens = tokenize("A=1\nB=${A}\n");
+    list_t changed = {0};
+    TEST_ASSERT_TRUE(engine_update(&engine, &args, &tokens, &changed).ok);
+
+    tokens = tokenize("# a new comment\nA=1\nB=${A}\n");
+    TEST_ASSERT_TRUE(engine_update(&engine, &args, &tokens, &changed).ok);
+    TEST_ASSERT_EQUAL_size_t(0, engine.evaluated);
+    TEST_ASSERT_EQUAL_size_t(0, changed.count);
+}
+
+static void test_reports_added_and_removed_keys(void) {
+    token_list_t tokens = tokenize("A=1\nB=2\n");
+    list_t changed = {0};
+    TEST_ASSERT_TRUE(engine_update(&engine, &args, &tokens, &changed).ok);
+
+    tokens = tokenize("A=1\nC=3\n");
+    TEST_ASSERT_TRUE(engine_update(&engine, &args, &tokens, &changed).ok);
+    TEST_ASSERT_EQUAL_size_t(2, changed.count);
+    TEST_ASSERT_TRUE(lists(&changed, "B"));
+    TEST_ASSERT_TRUE(lists(&changed, "C"));
+    TEST_ASSERT_NULL(value_of("B"));
+}
+
+static void test_redefinition_rebinds_later_readers(void) {
+    token_list_t tokens = tokenize("A=1\nB=${A}\nA=2\nC=${A}\n");
+    list_t changed = {0};
+    TEST_ASSERT_TRUE(engine_update(&engine, &args, &tokens, &changed).ok);
+    TEST_ASSERT_EQUAL_STRING("1", value_of("B"));
+    TEST_ASSERT_EQUAL_STRING("2", value_of("C"));
+    TEST_ASSERT_EQUAL_STRING("2", value_of("A"));
+
+    tokens = tokenize("A=1\nB=${A}\nA=5\nC=${A}\n");
+    TEST_ASSERT_TRUE(engine_update(&engine, &args, &tokens, &changed).ok);
+    TEST_ASSERT_EQUAL_size_t(2, engine.evaluated);
+    TEST_ASSERT_EQUAL_STRING("1", value_of("B"));
+    TEST_ASSERT_EQUAL_STRING("5", value_of("C"));
+}
+
+static void test_failed_update_keeps_previous_results(void) {
+    token_list_t tokens = tokenize("A=1\nB=${A}\n");
+    list_t changed = {0};
+    TEST_ASSERT_TRUE(engine_update(&engine, &args, &tokens, &changed).ok);
+
+    clear_env("NVI_ENGINE_UNDEFINED");
+    tokens = tokenize("A=2\nB=${NVI_ENGINE_UNDEFINED}\n");
+    TEST_ASSERT_FALSE(update_silent(&tokens, &changed).ok);
+    TEST_ASSERT_EQUAL_STRING("1", value_of("A"));
+    TEST_ASSERT_EQUAL_STRING("1", value_of("B"));
+}
+
+static void test_keyless_values_are_checked_but_not_emitted(void) {
+    token_list_t tokens = tokenize("K=\rA\n'x' x\r\r${ :#{xx:'$}# Bx\r");
+    list_t changed = {0};
+
+    TEST_ASSERT_FALSE(update_silent(&tokens, &changed).ok);
+    TEST_ASSERT_EQUAL_size_t(0, engine.env_map.count);
+}
+
+static void test_refresh_reevaluates_readers_of_changed_variables(void) {
+    set_env("NVI_ENGINE_HOST", "localhost");
+    token_list_t tokens = tokenize("HOST_URL=http://${NVI_ENGINE_HOST}\nAPI=${HOST_URL}/api\nOTHER=${A:-x}\n");
+    list_t changed = {0};
+    TEST_ASSERT_TRUE(engine_update(&engine, &args, &tokens, &changed).ok);
+    TEST_ASSERT_EQUAL_STRING("http://localhost/api", value_of("API"));
+
+    TEST_ASSERT_TRUE(engine_refresh_env(&engine, &changed).ok);
+    TEST_ASSERT_EQUAL_size_t(0, engine.evaluated);
+    TEST_ASSERT_EQUAL_size_t(0, changed.count);
+
+    set_env("NVI_ENGINE_HOST", "example.com");
+    TEST_ASSERT_TRUE(engine_refresh_env(&engine, &changed).ok);
+    TEST_ASSERT_EQUAL_size_t(2, engine.evaluated);
+    TEST_ASSERT_EQUAL_size_t(2, changed.count);
+    TEST_ASSERT_EQUAL_STRING("http://example.com/api", value_of("API"));
+    TEST_ASSERT_EQUAL_STRING("x", value_of("OTHER"));
+    clear_env("NVI_ENGINE_HOST");
+}
+
+static void test_refresh_prefers_process_variables_over_definitions(void) {
+    clear_env("NVI_ENGINE_SHADOW");
+    token_list_t tokens = tokenize("NVI_ENGINE_SHADOW=file\nB=${NVI_ENGINE_SHADOW}\n");
+    list_t changed = {0};
+    TEST_ASSERT_TRUE(engine_update(&engine, &args, &tokens, &changed).ok);
+    TEST_ASSERT_EQUAL_STRING("file", value_of("B"));
+
+    set_env("NVI_ENGINE_SHADOW", "process");
+    TEST_ASSERT_TRUE(engine_refresh_env(&engine, &changed).ok);
+    TEST_ASSERT_EQUAL_size_t(1, changed.count);
+    TEST_ASSERT_EQUAL_STRING("process", value_of("B"));
+    TEST_ASSERT_EQUAL_STRING("file", value_of("NVI_ENGINE_SHADOW"));
+
+    clear_env("NVI_ENGINE_SHADOW");
+    TEST_ASSERT_TRUE(engine_refresh_env(&engine, &changed).ok);
+    TEST_ASSERT_EQUAL_STRING("file", value_of("B"));
+}
+
+static void test_matches_run_parser(void) {
+    set_env("NVI_ENGINE_PORT", "8080");
+    const char *src = "A=1\nB=${A}-${NVI_ENGINE_PORT}\nA=2\nC='${A}'\nD=\"${A} ${B}\"\nE=${MISSING:-fallback}\n";
+    token_list_t tokens = tokenize(src);
+    list_t changed = {0};
+    TEST_ASSERT_TRUE(engine_update(&engine, &args, &tokens, &changed).ok);
+
+    parser_t parser = {0};
+    TEST_ASSERT_TRUE(run_parser(&test_arena, &args, &tokens, &parser).ok);
+    TEST_ASSERT_EQUAL_size_t(parser.env_map.count, engine.env_map.count);
+    for (size_t i = 0; i < parser.env_map.count; ++i) {
+        TEST_ASSERT_EQUAL_STRING(parser.env_map.items[i].key, engine.env_map.items[i].key);
+        TEST_ASSERT_EQUAL_STRING(parser.env_map.items[i].value, engine.env_map.items[i].value);
+    }
+    clear_env("NVI_ENGINE_PORT");
+}
+
+int main(void) {
+    UNITY_BEGIN();
+    RUN_TEST(test_first_update_evaluates_everything);
+    RUN_TEST(test_recomputes_only_changed_keys_and_dependents);
+    RUN_TEST(test_updates_free_the_generation_they_replace);
+    RUN_TEST(test_unchanged_tokens_evaluate_nothing);
+    RUN_TEST(test_reports_added_and_removed_keys);
+    RUN_TEST(test_redefinition_rebinds_later_readers);
+    RUN_TEST(test_failed_update_keeps_previous_results);
+    RUN_TEST(test_keyless_values_are_checked_but_not_emitted);
+    RUN_TEST(test_refresh_reevaluates_readers_of_changed_variables);
+    RUN_TEST(test_refresh_prefers_process_variables_over_definitions);
+    RUN_TEST(test_matches_run_parser);
+    return UNITY_END();
+}
@@ -0,0 +1,170 @@
+#include "arena.h"
+#include "buf.h"
+#include "dynarr.h"
+#include "gitindex.h"
+#include "test_capture.h"
+#include "unity.h"
+#include <stdint.h>
+#include <string.h>
+
+#define SHA1_LEN 20
+
+#define MODE_FILE 0100644
+#define MODE_LINK 0120000
+#define MODE_GITLINK 0160000
+
+static arena_t test_arena;
+
+void setUp(void) { test_arena = (arena_t){0}; }
+void tearDown(void) { arena_free(&test_arena); }
+
+static void put_be32(buf_t *b, uint32_t v) {
+    char bytes[4] = {(char)(v >> 24), (char)(v >> 16), (char)(v >> 8), (char)v};
+    DYN_ARR_APPEND_MANY(&test_arena, b, bytes, 4);
+}
+
+static void put_be16(buf_t *b, uint16_t v) {
+    char bytes[2] = {(char)(v >> 8), (char)v};
+    DYN_ARR_APPEND_MANY(&test_arena, b, bytes, 2);
+}
+
+static void put_header(buf_t *b, uint32_t version, uint32_t count) {
+    DYN_ARR_APPEND_MANY(&test_arena, b, "DIRC", 4);
+    put_be32(b, version);
+    put_be32(b, count);
+}
+
+// the stat data, object id and flags every version shares
+static void put_entry_head(buf_t *b, uint32_t mode, uint16_t flags, uint16_t extended) {
+    for (int i = 0; i < 10; ++i) {
+        put_be32(b, i == 6 ? mode : 0);
+    }
+    for (int i = 0; i < SHA1_LEN; ++i) {
+        DYN_ARR_APPEND(&test_arena, b, (char)0xAB);
+    }
+    put_be16(b, flags);
+    if (flags & 0x4000) {
+        put_be16(b, extended);
+    }
+}
+
+static void put_entry(buf_t *b, const char *path, uint32_t mode, unsigned stage, uint16_t extended) {
+    size_t start = b->count;
+    uint16_t flags = (uint16_t)((stage << 12) | (extended != 0 ? 0x4000 : 0) | strlen(path));
+    put_entry_head(b, mode, flags, extended);
+    DYN_ARR_APPEND_MANY(&test_arena, b, path, strlen(path));
+
+    size_t len = ((b->count - start) + 8) & ~(size_t)7;
+    while (b->count - start < len) {
+        DYN_ARR_APPEND(&test_arena, b, '\0');
+    }
+}
+
+static void put_entry_v4(buf_t *b, const char *suffix, unsigned char strip) {
+    put_entry_head(b, MODE_FILE, (uint16_t)strlen(suffix), 0);
+    DYN_ARR_APPEND(&test_arena, b, (char)strip);
+    DYN_ARR_APPEND_MANY(&test_arena, b, suffix, strlen(suffix) + 1);
+}
+
+static void test_lists_regular_files_of_a_v2_index(void) {
+    buf_t b = {.arena = &test_arena};
+    put_header(&b, 2, 4);
+    put_entry(&b, "README.md", MODE_FILE, 0, 0);
+    put_entry(&b, "lib", MODE_GITLINK, 0, 0);
+    put_entry(&b, "link.ts", MODE_LINK, 0, 0);
+    put_entry(&b, "src/index.ts", MODE_FILE, 0, 0);
+
+    git_paths_t paths = {0};
+    result_t r = parse_git_index(&test_arena, b.items, b.count, SHA1_LEN, &paths);
+
+    TEST_ASSERT_TRUE(r.ok);
+    TEST_ASSERT_EQUAL_size_t(2, paths.count);
+    TEST_ASSERT_EQUAL_STRING("README.md", paths.items[0]);
+    TEST_ASSERT_EQUAL_STRING("src/index.ts", paths.items[1]);
+}
+
+static void test_lists_conflicted_paths_once(void) {
+    buf_t b = {.arena = &test_arena};
+    put_header(&b, 2, 4);
+    put_entry(&b, "a.ts", MODE_FILE, 1, 0);
+    put_entry(&b, "a.ts", MODE_FILE, 2, 0);
+    put_entry(&b, "a.ts", MODE_FILE, 3, 0);
+    put_entry(&b, "b.ts", MODE_FILE, 0, 0);
+
+    git_paths_t paths = {0};
+    result_t r = parse_git_index(&test_arena, b.items, b.count, SHA1_LEN, &paths);
+
+    TEST_ASSERT_TRUE(r.ok);
+    TEST_ASSERT_EQUAL_size_t(2, paths.count);
+    TEST_ASSERT_EQUAL_STRING("a.ts", paths.items[0]);
+    TEST_ASSERT_EQUAL_STRING("b.ts", paths.items[1]);
+}
+
+static void test_skips_entries_outside_a_sparse_checkout(void) {
+    buf_t b = {.arena = &test_arena};
+    put_header(&b, 3, 2);
+    put_entry(&b, "away.ts", MODE_FILE, 0, 0x4000);
+    put_entry(&b, "here.ts", MODE_FILE, 0, 0);
+
+    git_paths_t paths = {0};
+    result_t r = parse_git_index(&test_arena, b.items, b.count, SHA1_LEN, &paths);
+
+    TEST_ASSERT_TRUE(r.ok);
+    TEST_ASSERT_EQUAL_size_t(1, paths.count);
+    TEST_ASSERT_EQUAL_STRING("here.ts", paths.items[0]);
+}
+
+static void test_expands_v4_prefix_compressed_paths(void) {
+    buf_t b = {.arena = &test_arena};
+    put_header(&b, 4, 3);
+    put_entry_v4(&b, "src/app.ts", 0);
+    put_entry_v4(&b, "env.ts", 6);   // "src/" + "env.ts"
+    put_entry_v4(&b, "lib/db.ts", 6); // "src/" + "lib/db.ts"
+
+    git_paths_t paths = {0};
+    result_t r = parse_git_index(&test_arena, b.items, b.count, SHA1_LEN, &paths);
+
+    TEST_ASSERT_TRUE(r.ok);
+    TEST_ASSERT_EQUAL_size_t(3, paths.count);
+    TEST_ASSERT_EQUAL_STRING("src/app.ts", paths.items[0]);
+    TEST_ASSERT_EQUAL_STRING("src/env.ts", paths.items[1]);
+    TEST_ASSERT_EQUAL_STRING("src/lib/db.ts", paths.items[2]);
+}
+
+typedef struct {
+    const char *data;
+    size_t len;
+    result_t result;
+} parse_ctx_t;
+
+static void call_parse(void *ctx) {
+    parse_ctx_t *c = ctx;
+    git_paths_t paths = {0};
+    c->result = parse_git_index(&test_arena, c->data, c->len, SHA1_LEN, &paths);
+}
+
+static void test_errors_on_a_malformed_index(void) {
+    buf_t b = {.arena = &test_arena};
+    put_header(&b, 2, 2);
+    put_entry(&b, "a.ts", MODE_FILE, 0, 0);
+
+    char err[256] = {0};
+    parse_ctx_t truncated = {.data = b.items, .len = b.count};
+    capture_fd(stderr, err, sizeof(err), call_parse, &truncated);
+    TEST_ASSERT_FALSE(truncated.result.ok);
+    TEST_ASSERT_NOT_NULL(strstr(err, "truncated entry"));
+
+    parse_ctx_t unsigned_index = {.data = "DIRX\0\0\0\2\0\0\0\0", .len = 12};
+    capture_fd(stderr, err, sizeof(err), call_parse, &unsigned_index);
+    TEST_ASSERT_FALSE(unsigned_index.result.ok);
+}
+
+int main(void) {
+    UNITY_BEGIN();
+    RUN_TEST(test_lists_regular_files_of_a_v2_index);
+    RUN_TEST(test_lists_conflicted_paths_once);
+    RUN_TEST(test_skips_entries_outside_a_sparse_checkout);
+    RUN_TEST(test_expands_v4_prefix_compressed_paths);
+    RUN_TEST(test_errors_on_a_malformed_index);
+    return UNITY_END();
+}
@@ -0,0 +1,115 @@
+#include "arena.h"
+#include "ignore.h"
+#include "unity.h"
+#include <string.h>
+
+static arena_t test_arena;
+
+void setUp(void) { test_arena = (arena_t){0}; }
+void tearDown(void) { arena_free(&test_arena); }
+
+static bool glob(const char *pattern, const char *s) { return glob_match(pattern, strlen(pattern), s, strlen(s)); }
+
+static ignore_t compile(const char *src, size_t base_len) {
+    ignore_t ignore = {.base_len = base_len};
+    compile_ignore_rules(&test_arena, &ignore, src, strlen(src));
+    return ignore;
+}
+
+static void test_glob_single_segment_wildcards(void) {
+    TEST_ASSERT_TRUE(glob("*.log", "debug.log"));
+    TEST_ASSERT_TRUE(glob("*.log", ".log"));
+    TEST_ASSERT_FALSE(glob("*.log", "logs/debug.log"));
+    TEST_ASSERT_TRUE(glob("debug?.log", "debug1.log"));
+    TEST_ASSERT_FALSE(glob("debug?.log", "debug/.log"));
+    TEST_ASSERT_TRUE(glob("build-[0-9].js", "build-7.js"));
+    TEST_ASSERT_FALSE(glob("build-[!0-9].js", "build-7.js"));
+    TEST_ASSERT_TRUE(glob("a[.js", "a[.js"));
+    TEST_ASSERT_TRUE(glob("\\*.js", "*.js"));
+    TEST_ASSERT_FALSE(glob("\\*.js", "a.js"));
+}
+
+static void test_glob_double_star_spans_directories(void) {
+    TEST_ASSERT_TRUE(glob("a/**/b", "a/b"));
+    TEST_ASSERT_TRUE(glob("a/**/b", "a/x/y/b"));
+    TEST_ASSERT_FALSE(glob("a/**/b", "a/x/yb"));
+    TEST_ASSERT_TRUE(glob("**/out", "src/gen/out"));
+    TEST_ASSERT_TRUE(glob("gen/**", "gen/a/b.ts"));
+    TEST_ASSERT_FALSE(glob("gen/**", "generated/a.ts"));
+    TEST_ASSERT_FALSE(glob("a**b", "a/b"));
+}
+
+static void test_common_patterns_compile_to_direct_comparisons(void) {
+    ignore_t ignore = compile("dist\n*.min.js\ntmp-*\n/src/*.gen.ts\n", 2);
+
+    TEST_ASSERT_EQUAL_size_t(4, ignore.count);
+    TEST_ASSERT_EQUAL_INT(IGNORE_LITERAL, ignore.items[0].kind);
+    TEST_ASSERT_EQUAL_INT(IGNORE_SUFFIX, ignore.items[1].kind);
+    TEST_ASSERT_EQUAL_INT(IGNORE_PREFIX, ignore.items[2].kind);
+    TEST_ASSERT_EQUAL_INT(IGNORE_GLOB, ignore.items[3].kind);
+    TEST_ASSERT_TRUE(ignore.items[3].anchored);
+}
+
+static void test_comments_blanks_and_trailing_spaces_are_skipped(void) {
+    ignore_t ignore = compile("# a comment\n\n   \r\nkeep.ts  \r\n\\#hash.ts\n", 2);
+
+    TEST_ASSERT_EQUAL_size_t(2, ignore.count);
+    TEST_ASSERT_TRUE(is_ignored(&ignore, "./keep.ts", "keep.ts", false));
+    TEST_ASSERT_TRUE(is_ignored(&ignore, "./#hash.ts", "#hash.ts", false));
+}
+
+static void test_unanchored_rules_match_names_at_any_depth(void) {
+    ignore_t ignore = compile("*.gen.ts\n**/fixtures\n", 2);
+
+    TEST_ASSERT_TRUE(is_ignored(&ignore, "./a/b/c.gen.ts", "c.gen.ts", false));
+    TEST_ASSERT_TRUE(is_ignored(&ignore, "./a/fixtures", "fixtures", true));
+    TEST_ASSERT_FALSE(is_ignored(&ignore, "./a/c.ts", "c.ts", false));
+}
+
+static void test_anchored_rules_match_paths_below_their_directory(void) {
+    ignore_t ignore = compile("/out\nsrc/gen\n", strlen("./pkg") + 1);
+
+    TEST_ASSERT_TRUE(is_ignored(&ignore, "./pkg/out", "out", true));
+    TEST_ASSERT_FALSE(is_ignored(&ignore, "./pkg/src/out", "out", true));
+    TEST_ASSERT_TRUE(is_ignored(&ignore, "./pkg/src/gen", "gen", true));
+    TEST_ASSERT_FALSE(is_ignored(&ignore, "./pkg/lib/src/gen", "gen", true));
+}
+
+static void test_directory_rules_skip_files(void) {
+    ignore_t ignore = compile("cache/\n", 2);
+
+    TEST_ASSERT_TRUE(is_ignored(&ignore, "./cache", "cache", true));
+    TEST_ASSERT_FALSE(is_ignored(&ignore, "./cache", "cache", false));
+}
+
+static void test_last_matching_rule_wins(void) {
+    ignore_t ignore = compile("*.ts\n!keep.ts\n", 2);
+
+    TEST_ASSERT_TRUE(is_ignored(&ignore, "./drop.ts", "drop.ts", false));
+    TEST_ASSERT_FALSE(is_ignored(&ignore, "./keep.ts", "keep.ts", false));
+}
+
+static void test_deeper_rules_override_their_parents(void) {
+    ignore_t root = compile("*.ts\n*.js\n", 2);
+    ignore_t pkg = compile("!*.ts\n", strlen("./pkg") + 1);
+    pkg.parent = &root;
+
+    TEST_ASSERT_TRUE(is_ignored(&root, "./a.ts", "a.ts", false));
+    TEST_ASSERT_FALSE(is_ignored(&pkg, "./pkg/a.ts", "a.ts", false));
+    TEST_ASSERT_TRUE(is_ignored(&pkg, "./pkg/a.js", "a.js", false));
+    TEST_ASSERT_FALSE(is_ignored(NULL, "./a.ts", "a.ts", false));
+}
+
+int main(void) {
+    UNITY_BEGIN();
+    RUN_TEST(test_glob_single_segment_wildcards);
+    RUN_TEST(test_glob_double_star_spans_directories);
+    RUN_TEST(test_common_patterns_compile_to_direct_comparisons);
+    RUN_TEST(test_comments_blanks_and_trailing_spaces_are_skipped);
+    RUN_TEST(test_unanchored_rules_match_names_at_any_depth);
+    RUN_TEST(test_anchored_rules_match_paths_below_their_directory);
+    RUN_TEST(test_directory_rules_skip_files);
+    RUN_TEST(test_last_matching_rule_wins);
+    RUN_TEST(test_deeper_rules_override_their_parents);
+    return UNITY_END();
+}
@@ -0,0 +1,146 @@
+#include "nvi.h"
+#include "test_capture.h"
+#include "unity.h"
+#include <stdio.h>
+#include <string.h>
+
+#define LIBNVI_TEST_BASE "build/tests/test_libnvi_base.env"
+#define LIBNVI_TEST_LOCAL "build/tests/test_libnvi_local.env"
+
+static nvi_arena_t *arena;
+static nvi_error_t error;
+
+static void write_env(const char *path, const char *contents) {
+    FILE *f = fopen(path, "wb");
+    TEST_ASSERT_NOT_NULL(f);
+    fputs(contents, f);
+    fclose(f);
+}
+
+void setUp(void) {
+    arena = nvi_arena_create();
+    TEST_ASSERT_NOT_NULL(arena);
+    memset(&error, 0, sizeof(error));
+}
+
+void tearDown(void) {
+    nvi_arena_destroy(arena);
+    remove(LIBNVI_TEST_BASE);
+    remove(LIBNVI_TEST_LOCAL);
+}
+
+static void test_load_files_overrides_and_interpolates_in_order(void) {
+    write_env(LIBNVI_TEST_BASE, "HOST=localhost\nURL=http://${HOST}\n");
+    write_env(LIBNVI_TEST_LOCAL, "HOST=example.com\nEXTRA=${HOST}\n");
+    const char *paths[] = {LIBNVI_TEST_BASE, LIBNVI_TEST_LOCAL};
+
+    nvi_env_map_t *map = NULL;
+    TEST_ASSERT_EQUAL_INT(NVI_OK, nvi_load_files(arena, paths, 2, &map, &error));
+    TEST_ASSERT_EQUAL_INT(NVI_OK, error.status);
+
+    const char *key;
+    const char *value;
+    TEST_ASSERT_EQUAL_size_t(3, nvi_env_map_count(map));
+    TEST_ASSERT_TRUE(nvi_env_map_at(map, 0, &key, &value));
+    TEST_ASSERT_EQUAL_STRING("HOST", key);
+    TEST_ASSERT_EQUAL_STRING("example.com", value);
+    TEST_ASSERT_TRUE(nvi_env_map_at(map, 2, &key, &value));
+    TEST_ASSERT_EQUAL_STRING("EXTRA", key);
+    TEST_ASSERT_FALSE(nvi_env_map_at(map, 3, &key, &value));
+
+    TEST_ASSERT_EQUAL_STRING("http://localhost", nvi_env_map_get(map, "URL"));
+    TEST_ASSERT_NULL(nvi_env_map_get(map, "MISSING"));
+}
+
+static void call_parse_bad_quote(void *ctx) {
+    nvi_status_t *status = ctx;
+    nvi_env_map_t *map = NULL;
+    const char *data = "GOOD=1\nBAD=\"unterminated\n";
+    *status = nvi_parse_buffer(arena, "inline.env", data, strlen(data), &map, &error);
+}
+
+static void test_errors_are_returned_instead_of_printed(void) {
+    nvi_status_t status = NVI_OK;
+    char err[1024] = {0};
+    capture_fd(stderr, err, sizeof(err) - 1, call_parse_bad_quote, &status);
+
+    TEST_ASSERT_EQUAL_INT(NVI_ERR_SYNTAX, status);
+    TEST_ASSERT_EQUAL_INT(NVI_ERR_SYNTAX, error.status);
+    TEST_ASSERT_NOT_NULL(strstr(error.message, "inline.env:2"));
+    TEST_ASSERT_NOT_NULL(strstr(error.message, "unterminated quoted value"));
+    TEST_ASSERT_EQUAL_STRING("", err);
+}
+
+static void test_unreadable_and_undefined_inputs_have_their_own_codes(void) {
+    const char *missing[] = {"build/tests/test_libnvi_missing.env"};
+    nvi_env_map_t *map = NULL;
+    TEST_ASSERT_EQUAL_INT(NVI_ERR_READ, nvi_load_files(arena, missing, 1, &map, &error));
+    TEST_ASSERT_NOT_NULL(strstr(error.message, "test_libnvi_missing.env"));
+
+    const char *undefined = "A=${NVI_LIBNVI_TEST_UNDEFINED}\n";
+    TEST_ASSERT_EQUAL_INT(NVI_ERR_PARSE, nvi_parse_buffer(arena, NULL, undefined, strlen(undefined), &map, &error));
+
+    TEST_ASSERT_EQUAL_INT(NVI_ERR_INVALID_ARGUMENT, nvi_load_files(arena, NULL, 0, &map, &error));
+}
+
+static void test_require_lists_every_missing_key(void) {
+    const char *data = "SET=1\nEMPTY=\"\"\n";
+    nvi_env_map_t *map = NULL;
+    TEST_ASSERT_EQUAL_INT(NVI_OK, nvi_parse_buffer(arena, NULL, data, strlen(data), &map, &error));
+
+    const char *present[] = {"SET"};
+    TEST_ASSERT_EQUAL_INT(NVI_OK, nvi_env_map_require(map, present, 1, &error));
+
+    const char *keys[] = {"SET", "EMPTY", "UNSET"};
+    TEST_ASSERT_EQUAL_INT(NVI_ERR_MISSING_REQUIRED, nvi_env_map_require(map, keys, 3, &error));
+    TEST_ASSERT_NOT_NULL(strstr(error.message, "EMPTY"));
+    TEST_ASSERT_NOT_NULL(strstr(error.message, "UNSET"));
+    TEST_ASSERT_NULL(strstr(error.message, "SET\n"));
+}
+
+static void test_scan_buffer_reports_keys_with_positions(void) {
+    const char *source = "const a = process.env.API_KEY;\nconst b = process.env[\"DB_URL\"];\n";
+    nvi_keys_t *keys = NULL;
+    TEST_ASSERT_EQUAL_INT(NVI_OK, nvi_scan_buffer(arena, "ts", source, strlen(source), &keys, &error));
+
+    const char *key;
+    size_t line;
+    size_t column;
+    TEST_ASSERT_EQUAL_size_t(2, nvi_keys_count(keys));
+    TEST_ASSERT_TRUE(nvi_keys_at(keys, 0, &key, &line, &column));
+    TEST_ASSERT_EQUAL_STRING("API_KEY", key);
+    TEST_ASSERT_EQUAL_size_t(1, line);
+    TEST_ASSERT_TRUE(nvi_keys_at(keys, 1, &key, &line, NULL));
+    TEST_ASSERT_EQUAL_STRING("DB_URL", key);
+    TEST_ASSERT_EQUAL_size_t(2, line);
+
+    TEST_ASSERT_EQUAL_INT(NVI_ERR_INVALID_ARGUMENT, nvi_scan_buffer(arena, "txt", source, 1, &keys, &error));
+}
+
+static void test_scan_buffer_keeps_source_order_across_accessors(void) {
+    const char *source = "process.env.A;\nimport.meta.env.B + process.env.C;\nDeno.env.get(\"D\");\n";
+    nvi_keys_t *keys = NULL;
+    TEST_ASSERT_EQUAL_INT(NVI_OK, nvi_scan_buffer(arena, "ts", source, strlen(source), &keys, &error));
+
+    const char *expected[] = {"A", "B", "C", "D"};
+    const size_t expected_lines[] = {1, 2, 2, 3};
+    TEST_ASSERT_EQUAL_size_t(4, nvi_keys_count(keys));
+    for (size_t i = 0; i < 4; ++i) {
+        const char *key;
+        size_t line;
+        TEST_ASSERT_TRUE(nvi_keys_at(keys, i, &key, &line, NULL));
+        TEST_ASSERT_EQUAL_STRING(expected[i], key);
+        TEST_ASSERT_EQUAL_size_t(expected_lines[i], line);
+    }
+}
+
+int main(void) {
+    UNITY_BEGIN();
+    RUN_TEST(test_load_files_overrides_and_interpolates_in_order);
+    RUN_TEST(test_errors_are_returned_instead_of_printed);
+    RUN_TEST(test_unreadable_and_undefined_inputs_have_their_own_codes);
+    RUN_TEST(test_require_lists_every_missing_key);
+    RUN_TEST(test_scan_buffer_reports_keys_with_positions);
+    RUN_TEST(test_scan_buffer_keeps_source_order_across_accessors);
+    return UNITY_END();
+}
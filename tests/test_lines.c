@@ -0,0 +1,65 @@
+#include "arena.h"
+#include "lines.h"
+#include "unity.h"
+#include <string.h>
+
+static arena_t test_arena;
+
+void setUp(void) { test_arena = (arena_t){0}; }
+void tearDown(void) { arena_free(&test_arena); }
+
+static void expect_position(const line_index_t *lines, size_t offset, size_t want_line, size_t want_byte) {
+    size_t line, byte;
+    line_index_position(lines, offset, &line, &byte);
+    TEST_ASSERT_EQUAL_size_t(want_line, line);
+    TEST_ASSERT_EQUAL_size_t(want_byte, byte);
+}
+
+static void test_empty_input_is_one_line(void) {
+    line_index_t lines;
+    build_line_index(&test_arena, "", 0, &lines);
+
+    TEST_ASSERT_EQUAL_size_t(0, lines.count);
+    expect_position(&lines, 0, 1, 1);
+}
+
+static void test_positions_around_newlines(void) {
+    const char *src = "ab\n\ncd\n";
+    line_index_t lines;
+    build_line_index(&test_arena, src, strlen(src), &lines);
+
+    TEST_ASSERT_EQUAL_size_t(3, lines.count);
+    expect_position(&lines, 0, 1, 1);
+    expect_position(&lines, 2, 1, 3); // a newline belongs to the line it ends
+    expect_position(&lines, 3, 2, 1);
+    expect_position(&lines, 5, 3, 2);
+    expect_position(&lines, 7, 4, 1);
+}
+
+// newlines at both edges of 16-byte blocks and in the unaligned tail
+static void test_counts_across_blocks_and_the_tail(void) {
+    char src[70];
+    memset(src, 'x', sizeof(src));
+    const size_t newlines[] = {0, 15, 16, 31, 32, 47, 63, 64, 69};
+    for (size_t i = 0; i < sizeof(newlines) / sizeof(newlines[0]); ++i) {
+        src[newlines[i]] = '\n';
+    }
+
+    line_index_t lines;
+    build_line_index(&test_arena, src, sizeof(src), &lines);
+
+    TEST_ASSERT_EQUAL_size_t(sizeof(newlines) / sizeof(newlines[0]), lines.count);
+    for (size_t i = 0; i < lines.count; ++i) {
+        TEST_ASSERT_EQUAL_size_t(newlines[i], lines.items[i]);
+    }
+    expect_position(&lines, 20, 4, 4);
+    expect_position(&lines, 65, 9, 1);
+}
+
+int main(void) {
+    UNITY_BEGIN();
+    RUN_TEST(test_empty_input_is_one_line);
+    RUN_TEST(test_positions_around_newlines);
+    RUN_TEST(test_counts_across_blocks_and_the_tail);
+    return UNITY_END();
+}
@@ -1,10 +1,14 @@
 #include "accessors.h"
 #include "arena.h"
 #include "file.h"
+#include "lines.h"
 #include "matcher.h"
 #include "unity.h"
+#include <stdio.h>
 #include <string.h>
 
+#define STREAM_TEST_PATH "build/tests/test_matcher_stream.ts"
+
 static arena_t test_arena;
 
 void setUp(void) { test_arena = (arena_t){0}; }
@@ -21,6 +25,16 @@ static file_details_t mock_file(const char *src) {
     return f;
 }
 
+// resolves a match's offset the way a dry run reports it
+static void expect_position(const file_details_t *f, const env_key_match_t *m, size_t want_line, size_t want_byte) {
+    line_index_t lines;
+    build_line_index(&test_arena, f->contents, f->len, &lines);
+    size_t line, byte;
+    line_index_position(&lines, m->offset, &line, &byte);
+    TEST_ASSERT_EQUAL_size_t(want_line, line);
+    TEST_ASSERT_EQUAL_size_t(want_byte, byte);
+}
+
 static void expect_key(const env_key_match_t *m, const char *want) {
     TEST_ASSERT_EQUAL_size_t(strlen(want), m->key_len);
     TEST_ASSERT_EQUAL_STRING_LEN(want, m->key, m->key_len);
@@ -35,8 +49,7 @@ static void test_ident_key_with_location(void) {
 
     TEST_ASSERT_EQUAL_size_t(1, matches.count);
     expect_key(&matches.items[0], "API_KEY");
-    TEST_ASSERT_EQUAL_size_t(1, matches.items[0].line);
-    TEST_ASSERT_EQUAL_size_t(23, matches.items[0].byte);
+    expect_position(&f, &matches.items[0], 1, 23);
 }
 
 static void test_bracket_quoted_key_with_location(void) {
@@ -48,8 +61,7 @@ static void test_bracket_quoted_key_with_location(void) {
 
     TEST_ASSERT_EQUAL_size_t(1, matches.count);
     expect_key(&matches.items[0], "API_KEY");
-    TEST_ASSERT_EQUAL_size_t(1, matches.items[0].line);
-    TEST_ASSERT_EQUAL_size_t(24, matches.items[0].byte);
+    expect_position(&f, &matches.items[0], 1, 24);
 }
 
 static void test_tracks_lines_across_quoted_keys(void) {
@@ -61,11 +73,9 @@ static void test_tracks_lines_across_quoted_keys(void) {
 
     TEST_ASSERT_EQUAL_size_t(2, matches.count);
     expect_key(&matches.items[0], "FOO");
-    TEST_ASSERT_EQUAL_size_t(3, matches.items[0].line);
-    TEST_ASSERT_EQUAL_size_t(12, matches.items[0].byte);
+    expect_position(&f, &matches.items[0], 3, 12);
     expect_key(&matches.items[1], "BAR");
-    TEST_ASSERT_EQUAL_size_t(4, matches.items[1].line);
-    TEST_ASSERT_EQUAL_size_t(12, matches.items[1].byte);
+    expect_position(&f, &matches.items[1], 4, 12);
 }
 
 static void test_skips_dynamic_keys(void) {
@@ -166,8 +176,7 @@ static void test_yaml_expansion_with_location(void) {
 
     TEST_ASSERT_EQUAL_size_t(1, matches.count);
     expect_key(&matches.items[0], "IMAGE_TAG");
-    TEST_ASSERT_EQUAL_size_t(1, matches.items[0].line);
-    TEST_ASSERT_EQUAL_size_t(10, matches.items[0].byte);
+    expect_position(&f, &matches.items[0], 1, 10);
 }
 
 static void test_yaml_expansion_operator_forms(void) {
@@ -217,6 +226,130 @@ static void test_yaml_expansion_skips_actions_and_unterminated(void) {
     expect_key(&matches.items[0], "VALID");
 }
 
+static void expect_same_matches(const env_key_matches_t *want, const env_key_matches_t *got) {
+    TEST_ASSERT_EQUAL_size_t(want->count, got->count);
+    for (size_t i = 0; i < want->count; ++i) {
+        TEST_ASSERT_EQUAL_PTR(want->items[i].key, got->items[i].key);
+        TEST_ASSERT_EQUAL_size_t(want->items[i].key_len, got->items[i].key_len);
+        TEST_ASSERT_EQUAL_size_t(want->items[i].offset, got->items[i].offset);
+    }
+}
+
+static void test_chunked_matching_agrees_at_every_split(void) {
+    file_ext_t fe = ext_for("ts");
+    file_details_t f = mock_file("a = process.env.FIRST; b = process.env[\"SECOND\"]\n"
+                                 "c = import.meta.env.THIRD + process.env.FOURTH;\n");
+
+    env_key_matches_t want = {0};
+    scan_file_content(&test_arena, &f, &fe, &want);
+    TEST_ASSERT_EQUAL_size_t(4, want.count);
+
+    // every split point lands a boundary before, inside or after a prefix or a key
+    for (size_t split = 1; split < f.len; ++split) {
+        match_chunk_t chunks[3] = {{.from = 0, .to = split / 2},
+                                   {.from = split / 2, .to = split},
+                                   {.from = split, .to = f.len}};
+        for (size_t i = 0; i < 3; ++i) {
+            scan_file_chunk(&test_arena, &f, &fe, &chunks[i]);
+        }
+
+        env_key_matches_t got = {0};
+        merge_match_chunks(&test_arena, &f, &fe, chunks, 3, &got);
+        expect_same_matches(&want, &got);
+    }
+}
+
+static void test_streamed_matching_agrees_across_windows(void) {
+    // lines of varying length put window boundaries before, inside and after keys
+    FILE *out = fopen(STREAM_TEST_PATH, "wb");
+    TEST_ASSERT_NOT_NULL_MESSAGE(out, "cannot create stream fixture");
+    size_t written = 0;
+    for (unsigned i = 0; written <= MAX_FILE_SIZE; ++i) {
+        int n = fprintf(out, "%*sconst v = process.env.KEY_%u;\n", (int)(i % 13), "", i % 1000);
+        written += (size_t)n;
+    }
+    fclose(out);
+
+    file_ext_t fe = ext_for("ts");
+    file_stream_t stream;
+    TEST_ASSERT_TRUE(open_file_stream(STREAM_TEST_PATH, &stream));
+    TEST_ASSERT_TRUE(stream.size > MAX_FILE_SIZE);
+
+    env_key_matches_t got = {0};
+    match_positions_t positions = {0};
+    sniff_kind_t sniffed;
+    TEST_ASSERT_TRUE(scan_file_stream(&test_arena, &stream, &fe, SNIFF_ALL, &sniffed, &got, &positions, NULL, NULL));
+    TEST_ASSERT_EQUAL_INT(SNIFF_NONE, sniffed);
+    close_file_stream(&stream);
+
+    file_details_t f = {.path = STREAM_TEST_PATH};
+    TEST_ASSERT_TRUE(read_whole_file(&test_arena, STREAM_TEST_PATH, &f.contents, &f.len));
+    remove(STREAM_TEST_PATH);
+
+    env_key_matches_t want = {0};
+    scan_file_content(&test_arena, &f, &fe, &want);
+
+    line_index_t lines;
+    build_line_index(&test_arena, f.contents, f.len, &lines);
+
+    TEST_ASSERT_EQUAL_size_t(want.count, got.count);
+    TEST_ASSERT_EQUAL_size_t(got.count, positions.count);
+    for (size_t i = 0; i < want.count; ++i) {
+        TEST_ASSERT_EQUAL_size_t(want.items[i].offset, got.items[i].offset);
+        TEST_ASSERT_EQUAL_STRING_LEN(want.items[i].key, got.items[i].key, want.items[i].key_len);
+
+        size_t line, byte;
+        line_index_position(&lines, want.items[i].offset, &line, &byte);
+        TEST_ASSERT_EQUAL_size_t(line, positions.items[i].line);
+        TEST_ASSERT_EQUAL_size_t(byte, positions.items[i].byte);
+    }
+}
+
+typedef struct {
+    const env_key_matches_t *want;
+    size_t next;
+    size_t windows;
+} sink_check_t;
+
+static void check_window(void *ctx, const env_key_matches_t *matches) {
+    sink_check_t *check = ctx;
+    ++check->windows;
+    for (size_t i = 0; i < matches->count; ++i) {
+        const env_key_match_t *want = &check->want->items[check->next++];
+        TEST_ASSERT_EQUAL_STRING_LEN(want->key, matches->items[i].key, want->key_len);
+    }
+}
+
+static void test_a_sink_takes_each_window_of_streamed_matches(void) {
+    FILE *out = fopen(STREAM_TEST_PATH, "wb");
+    TEST_ASSERT_NOT_NULL_MESSAGE(out, "cannot create stream fixture");
+    for (size_t written = 0; written <= MAX_FILE_SIZE + STREAM_WINDOW_SIZE;) {
+        written += (size_t)fprintf(out, "const v = process.env.KEY_%zu;\n", written % 997);
+    }
+    fclose(out);
+
+    file_ext_t fe = ext_for("ts");
+    file_details_t f = {.path = STREAM_TEST_PATH};
+    TEST_ASSERT_TRUE(read_whole_file(&test_arena, STREAM_TEST_PATH, &f.contents, &f.len));
+    env_key_matches_t want = {0};
+    scan_file_content(&test_arena, &f, &fe, &want);
+
+    file_stream_t stream;
+    TEST_ASSERT_TRUE(open_file_stream(STREAM_TEST_PATH, &stream));
+    env_key_matches_t kept = {0};
+    sink_check_t check = {.want = &want};
+    sniff_kind_t sniffed;
+    TEST_ASSERT_TRUE(
+        scan_file_stream(&test_arena, &stream, &fe, SNIFF_ALL, &sniffed, &kept, NULL, check_window, &check));
+    close_file_stream(&stream);
+    remove(STREAM_TEST_PATH);
+
+    // every match reached the sink, a window at a time, and none were kept
+    TEST_ASSERT_EQUAL_size_t(want.count, check.next);
+    TEST_ASSERT_GREATER_THAN_size_t(1, check.windows);
+    TEST_ASSERT_EQUAL_size_t(0, kept.count);
+}
+
 int main(void) {
     UNITY_BEGIN();
     RUN_TEST(test_ident_key_with_location);
@@ -234,5 +367,8 @@ int main(void) {
     RUN_TEST(test_yaml_expansion_nested_default);
     RUN_TEST(test_yaml_expansion_skips_escaped_dollars);
     RUN_TEST(test_yaml_expansion_skips_actions_and_unterminated);
+    RUN_TEST(test_chunked_matching_agrees_at_every_split);
+    RUN_TEST(test_streamed_matching_agrees_across_windows);
+    RUN_TEST(test_a_sink_takes_each_window_of_streamed_matches);
     return UNITY_END();
 }
@@ -0,0 +1,32 @@
+#include "nthread.h"
+#include "unity.h"
+
+void setUp(void) {}
+void tearDown(void) {}
+
+static void test_cpu_max_rounds_a_quota_up_to_whole_threads(void) {
+    TEST_ASSERT_EQUAL_size_t(2, cpu_max_threads("200000 100000\n"));
+    TEST_ASSERT_EQUAL_size_t(2, cpu_max_threads("150000 100000"));
+    TEST_ASSERT_EQUAL_size_t(1, cpu_max_threads("50000 100000"));
+}
+
+static void test_cpu_max_without_a_quota_is_unlimited(void) {
+    TEST_ASSERT_EQUAL_size_t(0, cpu_max_threads("max 100000\n"));
+    TEST_ASSERT_EQUAL_size_t(0, cpu_max_threads("-1 100000"));
+    TEST_ASSERT_EQUAL_size_t(0, cpu_max_threads("100000"));
+    TEST_ASSERT_EQUAL_size_t(0, cpu_max_threads(""));
+}
+
+static void test_available_threads_never_exceed_the_online_cpus(void) {
+    size_t n = available_thread_count();
+    TEST_ASSERT_TRUE(n >= 1);
+    TEST_ASSERT_TRUE(n <= thread_count());
+}
+
+int main(void) {
+    UNITY_BEGIN();
+    RUN_TEST(test_cpu_max_rounds_a_quota_up_to_whole_threads);
+    RUN_TEST(test_cpu_max_without_a_quota_is_unlimited);
+    RUN_TEST(test_available_threads_never_exceed_the_online_cpus);
+    return UNITY_END();
+}
@@ -49,19 +49,30 @@ static const char *lookup(const env_map_t *m, const char *key) {
     return NULL;
 }
 
-static token_t make_token(const char *key, value_kind_t kind, const char *value, value_token_t *slot) {
-    *slot = (value_token_t){.value = (char *)value, .value_len = strlen(value), .kind = kind, .line = 1, .byte = 1};
-    token_t tok = {.key = (char *)key, .file = "testp.env"};
-    tok.values.items = slot;
-    tok.values.count = 1;
-    tok.values.capacity = 1;
-    return tok;
+static token_list_t tokenize(const char *src) {
+    args_t args = {0};
+    file_details_t file = {.contents = arena_strdup(&test_arena, src), .path = "testp.env", .len = strlen(src)};
+    arena_t scratch = {0};
+    tokenizer_t tokenizer = {0};
+    result_t r = generate_tokens(&test_arena, &scratch, &args, &file, &tokenizer);
+    arena_free(&scratch);
+    TEST_ASSERT_TRUE(r.ok);
+    return tokenizer.tokens;
+}
+
+// "KEY=" then 'len' copies of 'fill' and a newline, for values too large to spell out
+static char *filled_line(const char *key, char fill, size_t len) {
+    size_t key_len = strlen(key);
+    char *line = arena_alloc(&test_arena, key_len + len + 3);
+    memcpy(line, key, key_len);
+    line[key_len] = '=';
+    memset(line + key_len + 1, fill, len);
+    memcpy(line + key_len + 1 + len, "\n", 2);
+    return line;
 }
 
 static void test_sets_normalized_key_value(void) {
-    value_token_t v;
-    token_t toks[] = {make_token("KEY", LITERAL_VALUE, "value", &v)};
-    token_list_t tl = {.items = toks, .count = 1, .capacity = 1};
+    token_list_t tl = tokenize("KEY=value\n");
     args_t args = {0};
 
     parser_t parser = {0};
@@ -72,15 +83,8 @@ static void test_sets_normalized_key_value(void) {
 }
 
 static void test_concatenates_multiple_value_tokens(void) {
-    value_token_t vs[2] = {
-        {.value = (char *)"12", .value_len = 2, .kind = LITERAL_VALUE, .line = 1, .byte = 1},
-        {.value = (char *)"34", .value_len = 2, .kind = LITERAL_VALUE, .line = 2, .byte = 1},
-    };
-    token_t tok = {.key = (char *)"MULTI", .file = "testp.env"};
-    tok.values.items = vs;
-    tok.values.count = 2;
-    tok.values.capacity = 2;
-    token_list_t tl = {.items = &tok, .count = 1, .capacity = 1};
+    token_list_t tl = tokenize("MULTI=12\\\n34\n");
+    TEST_ASSERT_EQUAL_UINT32(2, tl.value_counts[0]);
     args_t args = {0};
 
     parser_t parser = {0};
@@ -92,9 +96,7 @@ static void test_concatenates_multiple_value_tokens(void) {
 static void test_resolves_interpolation_from_environment(void) {
     set_env("NVI_TEST_HOME", "/home/test");
 
-    value_token_t v;
-    token_t toks[] = {make_token("DIR", INTERPOLATED_KEY, "NVI_TEST_HOME", &v)};
-    token_list_t tl = {.items = toks, .count = 1, .capacity = 1};
+    token_list_t tl = tokenize("DIR=${NVI_TEST_HOME}\n");
     args_t args = {0};
 
     parser_t parser = {0};
@@ -108,12 +110,7 @@ static void test_resolves_interpolation_from_environment(void) {
 static void test_resolves_interpolation_from_previous_env(void) {
     clear_env("NVI_TEST_FOO");
 
-    value_token_t vfoo, vbaz;
-    token_t toks[] = {
-        make_token("NVI_TEST_FOO", LITERAL_VALUE, "bar", &vfoo),
-        make_token("NVI_TEST_BAZ", INTERPOLATED_KEY, "NVI_TEST_FOO", &vbaz),
-    };
-    token_list_t tl = {.items = toks, .count = 2, .capacity = 2};
+    token_list_t tl = tokenize("NVI_TEST_FOO=bar\nNVI_TEST_BAZ=${NVI_TEST_FOO}\n");
     args_t args = {0};
 
     parser_t parser = {0};
@@ -123,9 +120,7 @@ static void test_resolves_interpolation_from_previous_env(void) {
 }
 
 static void test_required_env_present_passes(void) {
-    value_token_t v;
-    token_t toks[] = {make_token("REQUIRED", LITERAL_VALUE, "ok", &v)};
-    token_list_t tl = {.items = toks, .count = 1, .capacity = 1};
+    token_list_t tl = tokenize("REQUIRED=ok\n");
 
     args_t args = {0};
     const char *req[] = {"REQUIRED"};
@@ -150,12 +145,7 @@ static void test_errors_when_nothing_parses(void) {
 }
 
 static void test_duplicate_key_updates_in_place(void) {
-    value_token_t v1, v2;
-    token_t toks[] = {
-        make_token("KEY", LITERAL_VALUE, "first", &v1),
-        make_token("KEY", LITERAL_VALUE, "second", &v2),
-    };
-    token_list_t tl = {.items = toks, .count = 2, .capacity = 2};
+    token_list_t tl = tokenize("KEY=first\nKEY=second\n");
     args_t args = {0};
 
     parser_t parser = {0};
@@ -167,16 +157,14 @@ static void test_duplicate_key_updates_in_place(void) {
 
 static void test_index_survives_growth(void) {
     enum { N = 100 };
-    static char keys[N][16];
-    static value_token_t vs[N];
-    static token_t toks[N];
+    static char src[N * 16];
+    size_t len = 0;
 
     for (size_t i = 0; i < N; ++i) {
-        snprintf(keys[i], sizeof(keys[i]), "KEY_%zu", i);
-        toks[i] = make_token(keys[i], LITERAL_VALUE, "v", &vs[i]);
+        len += (size_t)snprintf(src + len, sizeof(src) - len, "KEY_%zu=v\n", i);
     }
 
-    token_list_t tl = {.items = toks, .count = N, .capacity = N};
+    token_list_t tl = tokenize(src);
     args_t args = {0};
 
     parser_t parser = {0};
@@ -194,9 +182,7 @@ static void test_index_survives_growth(void) {
 }
 
 static void test_errors_when_required_env_missing(void) {
-    value_token_t v;
-    token_t toks[] = {make_token("OTHER", LITERAL_VALUE, "x", &v)};
-    token_list_t tl = {.items = toks, .count = 1, .capacity = 1};
+    token_list_t tl = tokenize("OTHER=x\n");
 
     args_t args = {0};
     const char *req[] = {"REQUIRED"};
@@ -213,9 +199,7 @@ static void test_errors_when_required_env_missing(void) {
 
 static void test_fallback_used_when_unset(void) {
     clear_env("NVI_TEST_FB_UNSET");
-    value_token_t v;
-    token_t toks[] = {make_token("KEY", INTERPOLATED_KEY, "NVI_TEST_FB_UNSET:-fell back", &v)};
-    token_list_t tl = {.items = toks, .count = 1, .capacity = 1};
+    token_list_t tl = tokenize("KEY=${NVI_TEST_FB_UNSET:-fell back}\n");
 
     args_t args = {0};
     parser_t parser = {0};
@@ -225,13 +209,7 @@ static void test_fallback_used_when_unset(void) {
 }
 
 static void test_fallback_used_when_map_value_empty(void) {
-    value_token_t v1;
-    value_token_t v2;
-    token_t toks[] = {
-        make_token("EMPTYSRC", LITERAL_VALUE, "", &v1),
-        make_token("KEY", INTERPOLATED_KEY, "EMPTYSRC:-fb", &v2),
-    };
-    token_list_t tl = {.items = toks, .count = 2, .capacity = 2};
+    token_list_t tl = tokenize("EMPTYSRC=\"\"\nKEY=${EMPTYSRC:-fb}\n");
 
     args_t args = {0};
     parser_t parser = {0};
@@ -242,9 +220,7 @@ static void test_fallback_used_when_map_value_empty(void) {
 
 static void test_value_wins_over_fallback(void) {
     set_env("NVI_TEST_FB_SET", "real");
-    value_token_t v;
-    token_t toks[] = {make_token("KEY", INTERPOLATED_KEY, "NVI_TEST_FB_SET:-fb", &v)};
-    token_list_t tl = {.items = toks, .count = 1, .capacity = 1};
+    token_list_t tl = tokenize("KEY=${NVI_TEST_FB_SET:-fb}\n");
 
     args_t args = {0};
     parser_t parser = {0};
@@ -255,13 +231,7 @@ static void test_value_wins_over_fallback(void) {
 }
 
 static void test_defined_empty_without_fallback_resolves_empty(void) {
-    value_token_t v1;
-    value_token_t v2;
-    token_t toks[] = {
-        make_token("EMPTYSRC", LITERAL_VALUE, "", &v1),
-        make_token("KEY", INTERPOLATED_KEY, "EMPTYSRC", &v2),
-    };
-    token_list_t tl = {.items = toks, .count = 2, .capacity = 2};
+    token_list_t tl = tokenize("EMPTYSRC=\"\"\nKEY=${EMPTYSRC}\n");
 
     args_t args = {0};
     parser_t parser = {0};
@@ -274,22 +244,8 @@ static void test_defined_empty_without_fallback_resolves_empty(void) {
 // (~1.2MB), which must trip MAX_ENV_VALUE_SIZE instead of compounding
 static void test_errors_when_interpolation_exceeds_max_value_size(void) {
     const size_t seed_len = (MAX_ENV_VALUE_SIZE / 2) + (64 * 1024);
-    char *seed = arena_alloc(&test_arena, seed_len + 1);
-    memset(seed, 'x', seed_len);
-    seed[seed_len] = '\0';
-
-    value_token_t seed_v;
-    value_token_t bomb_v[2];
-    token_t toks[] = {make_token("SEED", LITERAL_VALUE, seed, &seed_v), {0}};
-
-    bomb_v[0] = (value_token_t){.value = "SEED", .value_len = 4, .kind = INTERPOLATED_KEY, .line = 2, .byte = 1};
-    bomb_v[1] = bomb_v[0];
-    toks[1] = (token_t){.key = "BOMB", .file = "testp.env"};
-    toks[1].values.items = bomb_v;
-    toks[1].values.count = 2;
-    toks[1].values.capacity = 2;
-
-    token_list_t tl = {.items = toks, .count = 2, .capacity = 2};
+    char *src = arena_sprintf(&test_arena, "%sBOMB=${SEED}${SEED}\n", filled_line("SEED", 'x', seed_len));
+    token_list_t tl = tokenize(src);
 
     args_t args = {0};
     parser_t parser = {0};
@@ -299,13 +255,7 @@ static void test_errors_when_interpolation_exceeds_max_value_size(void) {
 }
 
 static void test_value_at_max_value_size_passes(void) {
-    char *max = arena_alloc(&test_arena, MAX_ENV_VALUE_SIZE + 1);
-    memset(max, 'x', MAX_ENV_VALUE_SIZE);
-    max[MAX_ENV_VALUE_SIZE] = '\0';
-
-    value_token_t v;
-    token_t toks[] = {make_token("KEY", LITERAL_VALUE, max, &v)};
-    token_list_t tl = {.items = toks, .count = 1, .capacity = 1};
+    token_list_t tl = tokenize(filled_line("KEY", 'x', MAX_ENV_VALUE_SIZE));
 
     args_t args = {0};
     parser_t parser = {0};
@@ -318,20 +268,14 @@ static void test_value_at_max_value_size_passes(void) {
 // each expand to 1MB, which must trip MAX_PARSED_OUTPUT instead of compounding
 // toward an OOM abort
 static void test_errors_when_total_output_exceeds_max(void) {
-    char *seed = arena_alloc(&test_arena, MAX_ENV_VALUE_SIZE + 1);
-    memset(seed, 'x', MAX_ENV_VALUE_SIZE);
-    seed[MAX_ENV_VALUE_SIZE] = '\0';
-
     static const char *keys[] = {"K1", "K2", "K3", "K4", "K5", "K6", "K7", "K8"};
-    value_token_t vs[1 + ARR_LEN(keys)];
-    token_t toks[1 + ARR_LEN(keys)];
-
-    toks[0] = make_token("SEED", LITERAL_VALUE, seed, &vs[0]);
+    char *src = filled_line("SEED", 'x', MAX_ENV_VALUE_SIZE);
     for (size_t i = 0; i < ARR_LEN(keys); ++i) {
-        toks[1 + i] = make_token(keys[i], INTERPOLATED_KEY, "SEED", &vs[1 + i]);
+        src = arena_sprintf(&test_arena, "%s%s=${SEED}\n", src, keys[i]);
     }
 
-    token_list_t tl = {.items = toks, .count = ARR_LEN(toks), .capacity = ARR_LEN(toks)};
+    token_list_t tl = tokenize(src);
+    TEST_ASSERT_EQUAL_size_t(1 + ARR_LEN(keys), tl.count);
 
     args_t args = {0};
     parser_t parser = {0};
@@ -344,17 +288,16 @@ static void test_errors_when_total_output_exceeds_max(void) {
 // update replaces the previous value in place, so the running total must stay
 // at ~1MB and pass
 static void test_duplicate_updates_do_not_compound_total(void) {
-    char *big = arena_alloc(&test_arena, MAX_ENV_VALUE_SIZE + 1);
-    memset(big, 'x', MAX_ENV_VALUE_SIZE);
-    big[MAX_ENV_VALUE_SIZE] = '\0';
-
-    value_token_t vs[9];
-    token_t toks[9];
-    for (size_t i = 0; i < ARR_LEN(toks); ++i) {
-        toks[i] = make_token("BIG", LITERAL_VALUE, big, &vs[i]);
+    const char *line = filled_line("BIG", 'x', MAX_ENV_VALUE_SIZE);
+    size_t line_len = strlen(line);
+    char *src = arena_alloc(&test_arena, 9 * line_len + 1);
+    for (size_t i = 0; i < 9; ++i) {
+        memcpy(src + i * line_len, line, line_len);
     }
+    src[9 * line_len] = '\0';
 
-    token_list_t tl = {.items = toks, .count = ARR_LEN(toks), .capacity = ARR_LEN(toks)};
+    token_list_t tl = tokenize(src);
+    TEST_ASSERT_EQUAL_size_t(9, tl.count);
 
     args_t args = {0};
     parser_t parser = {0};
@@ -366,9 +309,7 @@ static void test_duplicate_updates_do_not_compound_total(void) {
 
 static void test_errors_on_undefined_interpolation(void) {
     clear_env("NVI_TEST_UNDEF");
-    value_token_t v;
-    token_t toks[] = {make_token("KEY", INTERPOLATED_KEY, "NVI_TEST_UNDEF", &v)};
-    token_list_t tl = {.items = toks, .count = 1, .capacity = 1};
+    token_list_t tl = tokenize("KEY=${NVI_TEST_UNDEF}\n");
 
     args_t args = {0};
     parser_t parser = {0};
@@ -378,9 +319,7 @@ static void test_errors_on_undefined_interpolation(void) {
 }
 
 static void test_errors_when_required_env_is_empty(void) {
-    value_token_t v;
-    token_t toks[] = {make_token("KEY", LITERAL_VALUE, "", &v)};
-    token_list_t tl = {.items = toks, .count = 1, .capacity = 1};
+    token_list_t tl = tokenize("KEY=\"\"\n");
 
     args_t args = {0};
     const char *req[] = {"KEY"};
@@ -395,6 +334,46 @@ static void test_errors_when_required_env_is_empty(void) {
     TEST_ASSERT_FALSE(r.ok);
 }
 
+static void test_dry_run_parses_like_a_normal_run(void) {
+    set_env("NVI_TEST_DRY_PORT", "8080");
+    clear_env("NVI_TEST_DRY_UNSET");
+    token_list_t tl = tokenize("# leading\nA=1\nB=${A}-${NVI_TEST_DRY_PORT}\nA=2\n# redefined\n"
+                               "C=${NVI_TEST_DRY_UNSET:-dflt}\nD=\"${A} ${B}\"\n# trailing\n");
+
+    args_t args = {0};
+    parser_t normal = {0};
+    TEST_ASSERT_TRUE(run_parser(&test_arena, &args, &tl, &normal).ok);
+
+    args_t dry_args = {.dry_run = true, .reveal = true};
+    parser_t dry = {0};
+    parser_ctx_t ctx = {.args = &dry_args, .tl = &tl, .parser = &dry};
+    char log[4096];
+    capture_fd(stderr, log, sizeof(log), call_parser, &ctx);
+    TEST_ASSERT_TRUE(ctx.result.ok);
+
+    TEST_ASSERT_EQUAL_size_t(4, normal.env_map.count);
+    TEST_ASSERT_EQUAL_size_t(normal.env_map.count, dry.env_map.count);
+    for (size_t i = 0; i < normal.env_map.count; ++i) {
+        TEST_ASSERT_EQUAL_STRING(normal.env_map.items[i].key, dry.env_map.items[i].key);
+        TEST_ASSERT_EQUAL_STRING(normal.env_map.items[i].value, dry.env_map.items[i].value);
+    }
+    TEST_ASSERT_EQUAL_STRING("2", lookup(&dry.env_map, "A"));
+    TEST_ASSERT_EQUAL_STRING("1-8080", lookup(&dry.env_map, "B"));
+    TEST_ASSERT_EQUAL_STRING("dflt", lookup(&dry.env_map, "C"));
+    TEST_ASSERT_EQUAL_STRING("2 1-8080", lookup(&dry.env_map, "D"));
+
+    // the logs still cover the redefinition and every comment, in token order
+    const char *updated = strstr(log, " key's value from 1 to 2");
+    const char *leading = strstr(log, "leading");
+    const char *trailing = strstr(log, "trailing");
+    TEST_ASSERT_NOT_NULL(updated);
+    TEST_ASSERT_NOT_NULL(leading);
+    TEST_ASSERT_NOT_NULL(strstr(log, "redefined"));
+    TEST_ASSERT_NOT_NULL(trailing);
+    TEST_ASSERT_TRUE(leading < updated && updated < trailing);
+    clear_env("NVI_TEST_DRY_PORT");
+}
+
 int main(void) {
     UNITY_BEGIN();
     RUN_TEST(test_sets_normalized_key_value);
@@ -416,5 +395,6 @@ int main(void) {
     RUN_TEST(test_errors_when_total_output_exceeds_max);
     RUN_TEST(test_duplicate_updates_do_not_compound_total);
     RUN_TEST(test_errors_when_required_env_is_empty);
+    RUN_TEST(test_dry_run_parses_like_a_normal_run);
     return UNITY_END();
 }
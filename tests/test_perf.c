@@ -0,0 +1,90 @@
+#include "perf.h"
+#include "unity.h"
+#include <errno.h>
+#include <string.h>
+
+void setUp(void) {}
+void tearDown(void) {}
+
+static void test_counts_sub_is_a_per_counter_delta(void) {
+    perf_counts_t start = {{100, 200, 3, 4}};
+    perf_counts_t end = {{150, 260, 5, 4}};
+
+    perf_counts_t delta = perf_counts_sub(&end, &start);
+
+    TEST_ASSERT_EQUAL_UINT64(50, delta.counts[PERF_INSTRUCTIONS]);
+    TEST_ASSERT_EQUAL_UINT64(60, delta.counts[PERF_CYCLES]);
+    TEST_ASSERT_EQUAL_UINT64(2, delta.counts[PERF_CACHE_MISSES]);
+    TEST_ASSERT_EQUAL_UINT64(0, delta.counts[PERF_BRANCH_MISSES]);
+}
+
+static void test_counts_sub_never_wraps(void) {
+    perf_counts_t start = {{10, 10, 10, 10}};
+    perf_counts_t end = {{5, 10, 10, 10}};
+
+    perf_counts_t delta = perf_counts_sub(&end, &start);
+
+    TEST_ASSERT_EQUAL_UINT64(0, delta.counts[PERF_INSTRUCTIONS]);
+}
+
+static void test_counts_add_sums_every_counter(void) {
+    perf_counts_t total = {{1, 2, 3, 4}};
+    perf_counts_t more = {{10, 20, 30, 40}};
+
+    perf_counts_add(&total, &more);
+
+    TEST_ASSERT_EQUAL_UINT64(11, total.counts[PERF_INSTRUCTIONS]);
+    TEST_ASSERT_EQUAL_UINT64(22, total.counts[PERF_CYCLES]);
+    TEST_ASSERT_EQUAL_UINT64(33, total.counts[PERF_CACHE_MISSES]);
+    TEST_ASSERT_EQUAL_UINT64(44, total.counts[PERF_BRANCH_MISSES]);
+}
+
+// whether the counters exist depends on the machine, so either outcome must be clean
+static void test_group_opens_or_reports_why_not(void) {
+    perf_group_t g = {0};
+    perf_counts_t first = {0};
+    perf_counts_t second = {0};
+
+    if (perf_group_open(&g)) {
+        TEST_ASSERT_TRUE(g.open);
+        TEST_ASSERT_TRUE(perf_group_read(&g, &first));
+        TEST_ASSERT_TRUE(perf_group_read(&g, &second));
+        TEST_ASSERT_TRUE(second.counts[PERF_INSTRUCTIONS] >= first.counts[PERF_INSTRUCTIONS]);
+    } else {
+        TEST_ASSERT_FALSE(g.open);
+        TEST_ASSERT_NOT_EQUAL(0, g.error);
+        TEST_ASSERT_FALSE(perf_group_read(&g, &first));
+    }
+
+    perf_group_close(&g);
+    TEST_ASSERT_FALSE(g.open);
+    TEST_ASSERT_FALSE(perf_group_read(&g, &first));
+}
+
+static void test_closing_an_unopened_group_is_a_no_op(void) {
+    perf_group_t g = {0};
+    perf_group_close(&g);
+    perf_group_close(&g);
+    TEST_ASSERT_FALSE(g.open);
+}
+
+static void test_error_text_names_the_reason(void) {
+    perf_group_t g = {0};
+    g.error = EACCES;
+#if defined(__linux__)
+    TEST_ASSERT_NOT_NULL(strstr(perf_error_text(&g), "perf_event_paranoid"));
+#else
+    TEST_ASSERT_NOT_NULL(strstr(perf_error_text(&g), "Linux"));
+#endif
+}
+
+int main(void) {
+    UNITY_BEGIN();
+    RUN_TEST(test_counts_sub_is_a_per_counter_delta);
+    RUN_TEST(test_counts_sub_never_wraps);
+    RUN_TEST(test_counts_add_sums_every_counter);
+    RUN_TEST(test_group_opens_or_reports_why_not);
+    RUN_TEST(test_closing_an_unopened_group_is_a_no_op);
+    RUN_TEST(test_error_text_names_the_reason);
+    return UNITY_END();
+}
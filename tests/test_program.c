@@ -0,0 +1,222 @@
+#include "arena.h"
+#include "arg.h"
+#include "parser.h"
+#include "program.h"
+#include "test_capture.h"
+#include "tokenizer.h"
+#include "unity.h"
+#include <stdlib.h>
+#include <string.h>
+
+static arena_t test_arena;
+static args_t args;
+
+void setUp(void) {
+    test_arena = (arena_t){0};
+    args = (args_t){0};
+}
+
+void tearDown(void) { arena_free(&test_arena); }
+
+#if defined(_WIN32) && defined(_MSC_VER)
+static void set_env(const char *k, const char *v) { _putenv_s(k, v); }
+static void clear_env(const char *k) { _putenv_s(k, ""); }
+#else
+static void set_env(const char *k, const char *v) { setenv(k, v, 1); }
+static void clear_env(const char *k) { unsetenv(k); }
+#endif
+
+static token_list_t tokenize(const char *src) {
+    file_details_t file = {.contents = arena_strdup(&test_arena, src), .path = "test.env", .len = strlen(src)};
+    arena_t scratch = {0};
+    tokenizer_t tokenizer = {0};
+    result_t r = generate_tokens(&test_arena, &scratch, &args, &file, &tokenizer);
+    arena_free(&scratch);
+    TEST_ASSERT_TRUE(r.ok);
+    return tokenizer.tokens;
+}
+
+static program_t compile(const char *src) {
+    token_list_t tokens = tokenize(src);
+    program_t program;
+    TEST_ASSERT_TRUE(compile_program(&test_arena, &tokens, &program).ok);
+    return program;
+}
+
+typedef struct {
+    const program_t *program;
+    parser_t *parser;
+    result_t result;
+} run_ctx_t;
+
+static void call_run(void *ctx) {
+    run_ctx_t *c = ctx;
+    c->result = run_program(&test_arena, &args, c->program, c->parser, NULL, NULL);
+}
+
+static result_t run_silent(const program_t *program, parser_t *parser, char *sink, size_t sink_len) {
+    run_ctx_t ctx = {.program = program, .parser = parser};
+    capture_fd(stderr, sink, sink_len, call_run, &ctx);
+    return ctx.result;
+}
+
+static void test_interns_each_key_to_one_slot(void) {
+    program_t program = compile("A=1\nB=${A}${A}\nA=${B:-x}\n");
+
+    TEST_ASSERT_EQUAL_size_t(2, program.slot_count);
+    TEST_ASSERT_EQUAL_size_t(2, program.env_count);
+    TEST_ASSERT_EQUAL_STRING("A", program.keys[program.env_slots[0]]);
+    TEST_ASSERT_EQUAL_STRING("B", program.keys[program.env_slots[1]]);
+}
+
+static void test_compiles_to_flat_instructions(void) {
+    program_t program = compile("A=1\nB=\"x${A}y${C:-z}\"\n");
+
+    const opcode_t expected[] = {OP_LIT, OP_STORE, OP_LIT, OP_REF, OP_LIT, OP_REF_DEFAULT, OP_STORE};
+    TEST_ASSERT_EQUAL_size_t(sizeof(expected) / sizeof(expected[0]), program.code_count);
+    for (size_t i = 0; i < program.code_count; ++i) {
+        TEST_ASSERT_EQUAL_UINT32(expected[i], program.code[i].op);
+    }
+
+    const instruction_t *fallback = &program.code[5];
+    TEST_ASSERT_EQUAL_STRING("C", program.keys[fallback->slot]);
+    TEST_ASSERT_EQUAL_STRING_LEN("z", program.pool + fallback->offset, fallback->len);
+}
+
+static void test_merges_adjacent_literals(void) {
+    program_t program = compile("A=one\\\ntwo\\\nthree\n");
+
+    TEST_ASSERT_EQUAL_size_t(2, program.code_count);
+    TEST_ASSERT_EQUAL_UINT32(OP_LIT, program.code[0].op);
+
+    parser_t parser = {0};
+    TEST_ASSERT_TRUE(run_program(&test_arena, &args, &program, &parser, NULL, NULL).ok);
+    TEST_ASSERT_EQUAL_STRING_LEN(parser.env_map.items[0].value, program.pool + program.code[0].offset,
+                                 program.code[0].len);
+}
+
+static void test_runs_like_the_parser(void) {
+    set_env("NVI_PROGRAM_PORT", "8080");
+    token_list_t tokens =
+        tokenize("A=1\nB=${A}-${NVI_PROGRAM_PORT}\nA=2\nC='${A}'\nD=\"${A} ${B}\"\nE=${NOPE:-dflt}\n");
+
+    program_t program;
+    TEST_ASSERT_TRUE(compile_program(&test_arena, &tokens, &program).ok);
+    parser_t compiled = {0};
+    TEST_ASSERT_TRUE(run_program(&test_arena, &args, &program, &compiled, NULL, NULL).ok);
+
+    TEST_ASSERT_EQUAL_size_t(5, compiled.env_map.count);
+    TEST_ASSERT_EQUAL_STRING("2", get_env_from_map(&compiled.env_map, "A")->value);
+    TEST_ASSERT_EQUAL_STRING("1-8080", get_env_from_map(&compiled.env_map, "B")->value);
+    TEST_ASSERT_EQUAL_STRING("${A}", get_env_from_map(&compiled.env_map, "C")->value);
+    TEST_ASSERT_EQUAL_STRING("2 1-8080", get_env_from_map(&compiled.env_map, "D")->value);
+    TEST_ASSERT_EQUAL_STRING("dflt", get_env_from_map(&compiled.env_map, "E")->value);
+    clear_env("NVI_PROGRAM_PORT");
+}
+
+static void test_replays_with_the_current_environment(void) {
+    program_t program = compile("URL=http://${NVI_PROGRAM_HOST:-localhost}\n");
+
+    parser_t first = {0};
+    TEST_ASSERT_TRUE(run_program(&test_arena, &args, &program, &first, NULL, NULL).ok);
+    TEST_ASSERT_EQUAL_STRING("http://localhost", first.env_map.items[0].value);
+
+    set_env("NVI_PROGRAM_HOST", "example.com");
+    parser_t second = {0};
+    TEST_ASSERT_TRUE(run_program(&test_arena, &args, &program, &second, NULL, NULL).ok);
+    TEST_ASSERT_EQUAL_STRING("http://example.com", second.env_map.items[0].value);
+    TEST_ASSERT_EQUAL_STRING("http://localhost", first.env_map.items[0].value);
+    clear_env("NVI_PROGRAM_HOST");
+}
+
+static void test_outlives_its_tokens(void) {
+    arena_t token_arena = {0};
+    const char *src = "A=1\nB=${A}2\n";
+    file_details_t file = {.contents = arena_strdup(&token_arena, src), .path = "test.env", .len = strlen(src)};
+    arena_t scratch = {0};
+    tokenizer_t tokenizer = {0};
+    TEST_ASSERT_TRUE(generate_tokens(&token_arena, &scratch, &args, &file, &tokenizer).ok);
+    arena_free(&scratch);
+
+    program_t program;
+    TEST_ASSERT_TRUE(compile_program(&test_arena, &tokenizer.tokens, &program).ok);
+    arena_free(&token_arena);
+
+    parser_t parser = {0};
+    TEST_ASSERT_TRUE(run_program(&test_arena, &args, &program, &parser, NULL, NULL).ok);
+    TEST_ASSERT_EQUAL_STRING("12", get_env_from_map(&parser.env_map, "B")->value);
+}
+
+static void test_identical_values_share_one_copy(void) {
+    program_t program =
+        compile("A=https://example.com\nB=https://example.com\nC=${A}\nA=true\nA=https://example.com\n");
+
+    parser_t parser = {0};
+    TEST_ASSERT_TRUE(run_program(&test_arena, &args, &program, &parser, NULL, NULL).ok);
+    const env_map_t *env_map = &parser.env_map;
+    TEST_ASSERT_EQUAL_size_t(3, env_map->count);
+    TEST_ASSERT_EQUAL_PTR(env_map->items[0].value, env_map->items[1].value);
+    TEST_ASSERT_EQUAL_PTR(env_map->items[0].value, env_map->items[2].value);
+
+    // every key and each distinct value once: the URL, "true", A, B and C
+    TEST_ASSERT_EQUAL_size_t(strlen("https://example.com") + 1 + 5 + 3 * 2, env_map->pool.bytes.count);
+}
+
+static void test_errors_on_undefined_interpolation(void) {
+    clear_env("NVI_PROGRAM_UNDEFINED");
+    program_t program = compile("A=x\nB=\"a${NVI_PROGRAM_UNDEFINED}\"\n");
+
+    parser_t parser = {0};
+    char sink[512];
+    TEST_ASSERT_FALSE(run_silent(&program, &parser, sink, sizeof(sink)).ok);
+    TEST_ASSERT_NOT_NULL(strstr(sink, "The 'B' key contains an interpolated key variable NVI_PROGRAM_UNDEFINED"));
+}
+
+static void test_errors_on_undefined_interpolation_in_a_keyless_value(void) {
+    // a keyless token's value isn't stored, but run_parser still assembles it
+    program_t program = compile("K=\rA\n'x' x\r\r${ :#{xx:'$}# Bx\r");
+
+    parser_t parser = {0};
+    char sink[512];
+    TEST_ASSERT_FALSE(run_silent(&program, &parser, sink, sizeof(sink)).ok);
+    TEST_ASSERT_NOT_NULL(strstr(sink, "The '(none)' key contains an interpolated key variable"));
+}
+
+static void test_errors_on_a_key_used_before_its_definition(void) {
+    program_t program = compile("A=${B}\nB=1\n");
+
+    parser_t parser = {0};
+    char sink[512];
+    TEST_ASSERT_FALSE(run_silent(&program, &parser, sink, sizeof(sink)).ok);
+}
+
+static void test_errors_when_required_env_missing(void) {
+    program_t program = compile("A=1\n");
+    const char *required[] = {"MISSING"};
+    args.required.items = required;
+    args.required.count = 1;
+    const char *command[] = {"true"};
+    args.command.items = command;
+    args.command.count = 1;
+
+    parser_t parser = {0};
+    char sink[512];
+    TEST_ASSERT_FALSE(run_silent(&program, &parser, sink, sizeof(sink)).ok);
+    TEST_ASSERT_EQUAL_size_t(1, parser.missing_envs.count);
+}
+
+int main(void) {
+    UNITY_BEGIN();
+    RUN_TEST(test_interns_each_key_to_one_slot);
+    RUN_TEST(test_compiles_to_flat_instructions);
+    RUN_TEST(test_merges_adjacent_literals);
+    RUN_TEST(test_runs_like_the_parser);
+    RUN_TEST(test_replays_with_the_current_environment);
+    RUN_TEST(test_outlives_its_tokens);
+    RUN_TEST(test_identical_values_share_one_copy);
+    RUN_TEST(test_errors_on_undefined_interpolation);
+    RUN_TEST(test_errors_on_undefined_interpolation_in_a_keyless_value);
+    RUN_TEST(test_errors_on_a_key_used_before_its_definition);
+    RUN_TEST(test_errors_when_required_env_missing);
+    return UNITY_END();
+}
@@ -1,11 +1,22 @@
+#include "accessors.h"
 #include "arena.h"
 #include "arg.h"
 #include "dynarr.h"
 #include "hashset.h"
 #include "scanner.h"
 #include "unity.h"
+#include <stdio.h>
 #include <string.h>
 
+#if !defined(_WIN32)
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+#define SCAN_TEST_DIR "build/tests/scan_tree"
+#define SCAN_TEST_FILES 600
+#define SCAN_TEST_BIG_FILES 3
+
 static arena_t test_arena;
 
 void setUp(void) { test_arena = (arena_t){0}; }
@@ -50,10 +61,130 @@ static void test_merge_empty_envs_is_noop(void) {
     TEST_ASSERT_EQUAL_size_t(0, args.required.count);
 }
 
+#if !defined(_WIN32)
+
+static char repo_dir[4096];
+
+static const char *tree_path(size_t i) {
+    static char path[64];
+    snprintf(path, sizeof(path), i < SCAN_TEST_FILES ? "f%03zu.ts" : "big%zu.ts", i % SCAN_TEST_FILES);
+    return path;
+}
+
+// a flat directory of small files, each reading its own key and a shared one; big files are
+// 'big_size' bytes of comments between a key at either end
+static void write_tree(size_t big_size) {
+    TEST_ASSERT_NOT_NULL(getcwd(repo_dir, sizeof(repo_dir)));
+    mkdir(SCAN_TEST_DIR, 0755);
+    TEST_ASSERT_EQUAL_INT(0, chdir(SCAN_TEST_DIR));
+
+    size_t count = SCAN_TEST_FILES + (big_size > 0 ? SCAN_TEST_BIG_FILES : 0);
+    for (size_t i = 0; i < count; ++i) {
+        FILE *f = fopen(tree_path(i), "wb");
+        TEST_ASSERT_NOT_NULL(f);
+        if (i < SCAN_TEST_FILES) {
+            fprintf(f, "const a = process.env.KEY_%zu;\nconst b = process.env.SHARED;\n", i);
+            for (size_t line = 0; line < 256; ++line) {
+                fputs("// padding padding padding pad\n", f);
+            }
+        } else {
+            fprintf(f, "const a = process.env.BIG_%zu_START;\n", i);
+            for (size_t written = 0; written < big_size; written += 32) {
+                fputs("// padding padding padding pad\n", f);
+            }
+            fprintf(f, "const b = process.env.BIG_%zu_END;\n", i);
+        }
+        fclose(f);
+    }
+}
+
+static void remove_tree(void) {
+    for (size_t i = 0; i < SCAN_TEST_FILES + SCAN_TEST_BIG_FILES; ++i) {
+        remove(tree_path(i));
+    }
+    TEST_ASSERT_EQUAL_INT(0, chdir(repo_dir));
+    rmdir(SCAN_TEST_DIR);
+}
+
+static scanner_t scan_tree(uint8_t threads, bool on_demand, size_t memory) {
+    args_t args = {.scan_threads = threads, .scan_threads_auto = on_demand, .scan_memory = memory};
+    args.stats = STATS_TEXT; // for the per-worker counts
+    append_file_extension(&test_arena, &args.scan_exts, get_scan_extension("ts"));
+
+    scanner_t scanner = {0};
+    TEST_ASSERT_TRUE(run_scanner(&test_arena, &args, &scanner).ok);
+    return scanner;
+}
+
+static void assert_same_scan(const scanner_t *expected, const scanner_t *actual) {
+    TEST_ASSERT_EQUAL_size_t(expected->files_scanned, actual->files_scanned);
+    TEST_ASSERT_EQUAL_size_t(expected->references, actual->references);
+    TEST_ASSERT_EQUAL_size_t(expected->env_keys.count, actual->env_keys.count);
+    for (size_t i = 0; i < expected->env_keys.capacity; ++i) {
+        const hashset_entry_t *entry = &expected->env_keys.items[i];
+        if (entry->key != NULL) {
+            TEST_ASSERT_TRUE(hashset_contains(&actual->env_keys, entry->key, entry->len));
+        }
+    }
+}
+
+static size_t workers_with_files(const scanner_t *scanner) {
+    size_t busy = 0;
+    for (size_t i = 0; i < scanner->worker_count; ++i) {
+        busy += scanner->workers[i].files > 0;
+    }
+    return busy;
+}
+
+static void test_a_flat_directory_is_shared_across_workers(void) {
+    write_tree(0);
+
+    scanner_t single = scan_tree(1, false, 0);
+    scanner_t fixed = scan_tree(4, false, 0);
+    scanner_t on_demand = scan_tree(4, true, 0);
+
+    // one directory's files are handed out in batches, not scanned by whoever read it; on a
+    // single CPU the first worker can still drain every batch before the others wake, so
+    // that gets a few tries
+    size_t sharing = workers_with_files(&fixed);
+    for (int attempt = 0; sharing < 2 && attempt < 3; ++attempt) {
+        scanner_t again = scan_tree(4, false, 0);
+        sharing = workers_with_files(&again);
+    }
+    remove_tree();
+
+    TEST_ASSERT_EQUAL_size_t(SCAN_TEST_FILES, single.files_scanned);
+    TEST_ASSERT_EQUAL_size_t(SCAN_TEST_FILES + 1, single.env_keys.count);
+    assert_same_scan(&single, &fixed);
+    assert_same_scan(&single, &on_demand);
+    TEST_ASSERT_GREATER_THAN_size_t(1, sharing);
+}
+
+static void test_files_over_the_memory_budget_still_scan(void) {
+    // three files of 2MB, each over the whole 1MB budget, so each has to run alone
+    write_tree((size_t)2 * 1024 * 1024);
+
+    scanner_t single = scan_tree(1, false, 0);
+    scanner_t budgeted = scan_tree(4, false, (size_t)1024 * 1024);
+    scanner_t on_demand = scan_tree(4, true, (size_t)1024 * 1024);
+    remove_tree();
+
+    TEST_ASSERT_EQUAL_size_t(SCAN_TEST_FILES + SCAN_TEST_BIG_FILES, single.files_scanned);
+    TEST_ASSERT_TRUE(hashset_contains(&single.env_keys, "BIG_601_END", strlen("BIG_601_END")));
+    assert_same_scan(&single, &budgeted);
+    assert_same_scan(&single, &on_demand);
+}
+
+#endif
+
 int main(void) {
     UNITY_BEGIN();
     RUN_TEST(test_merge_skips_ignored_keys);
     RUN_TEST(test_merge_dedups_already_required);
     RUN_TEST(test_merge_empty_envs_is_noop);
+#if !defined(_WIN32)
+    RUN_TEST(test_a_flat_directory_is_shared_across_workers);
+    RUN_TEST(test_files_over_the_memory_budget_still_scan);
+#endif
     return UNITY_END();
 }
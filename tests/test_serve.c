@@ -0,0 +1,230 @@
+#include "accessors.h"
+#include "arena.h"
+#include "arg.h"
+#include "dynarr.h"
+#include "serve.h"
+#include "test_capture.h"
+#include "tokenizer.h"
+#include "unity.h"
+#include <stdio.h>
+#include <string.h>
+#include <time.h>
+
+#if defined(__linux__)
+#include <sys/inotify.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+#define SERVE_TEST_PATH "build/tests/test_serve.env"
+#define SERVE_SCAN_DIR "build/tests/serve_scan"
+
+static arena_t test_arena;
+static serve_cache_t cache;
+static cached_file_t files[4];
+static cached_scan_t scans[SERVE_MAX_SCANS];
+
+void setUp(void) {
+    test_arena = (arena_t){0};
+    memset(files, 0, sizeof(files));
+    memset(scans, 0, sizeof(scans));
+    // a request long after the file was written, so it isn't racily clean
+    cache = (serve_cache_t){.files = files, .scans = scans, .inotify_fd = -1, .cwd = "/test"};
+    cache.request_start = (double)time(NULL) + 60;
+}
+
+void tearDown(void) {
+    for (size_t i = 0; i < cache.file_count; ++i) {
+        arena_free(&files[i].arena);
+    }
+    for (size_t i = 0; i < cache.scan_count; ++i) {
+        arena_free(&scans[i].arena);
+    }
+    arena_free(&cache.watch_refs.arena);
+    if (cache.inotify_fd >= 0) {
+        close(cache.inotify_fd);
+    }
+    arena_free(&test_arena);
+    remove(SERVE_TEST_PATH);
+}
+
+#if !defined(_WIN32)
+
+static void write_env(const char *contents) {
+    FILE *f = fopen(SERVE_TEST_PATH, "wb");
+    TEST_ASSERT_NOT_NULL(f);
+    fputs(contents, f);
+    fclose(f);
+}
+
+static args_t file_args(void) {
+    args_t args = {0};
+    DYN_ARR_APPEND(&test_arena, &args.files, SERVE_TEST_PATH);
+    return args;
+}
+
+static tokenizer_t tokenize(const args_t *args) {
+    tokenizer_t tokenizer = {0};
+    TEST_ASSERT_TRUE(serve_tokenize(&cache, &test_arena, args, &tokenizer).ok);
+    return tokenizer;
+}
+
+static void test_tokens_are_cached_between_requests(void) {
+    write_env("A=1\nB=2\n");
+    args_t args = file_args();
+
+    tokenizer_t first = tokenize(&args);
+    tokenizer_t second = tokenize(&args);
+
+    TEST_ASSERT_EQUAL_size_t(1, cache.file_count);
+    TEST_ASSERT_EQUAL_size_t(2, second.tokens.count);
+    TEST_ASSERT_EQUAL_STRING("B", token_key(&second.tokens, 1));
+    TEST_ASSERT_EQUAL_PTR(token_key(&first.tokens, 0), token_key(&second.tokens, 0));
+    TEST_ASSERT_EQUAL_STRING(SERVE_TEST_PATH, token_file(&second.tokens, 0));
+}
+
+static void test_a_changed_file_is_tokenized_again(void) {
+    write_env("A=1\n");
+    args_t args = file_args();
+    tokenize(&args);
+
+    write_env("A=1\nCHANGED=yes\n");
+    tokenizer_t tokenizer = tokenize(&args);
+
+    TEST_ASSERT_EQUAL_size_t(1, cache.file_count);
+    TEST_ASSERT_EQUAL_size_t(2, tokenizer.tokens.count);
+    TEST_ASSERT_EQUAL_STRING("CHANGED", token_key(&tokenizer.tokens, 1));
+}
+
+static void test_racily_clean_files_are_not_cached(void) {
+    write_env("A=1\n");
+    args_t args = file_args();
+    cache.request_start = (double)time(NULL);
+
+    tokenizer_t tokenizer = tokenize(&args);
+
+    TEST_ASSERT_EQUAL_size_t(0, cache.file_count);
+    TEST_ASSERT_EQUAL_size_t(1, tokenizer.tokens.count);
+}
+
+static void test_stats_runs_bypass_the_cache(void) {
+    write_env("A=1\n");
+    args_t args = file_args();
+    args.stats = STATS_JSON;
+
+    tokenize(&args);
+
+    TEST_ASSERT_EQUAL_size_t(0, cache.file_count);
+}
+
+typedef struct {
+    const args_t *args;
+    result_t result;
+} serve_ctx_t;
+
+static void call_serve_tokenize(void *ctx) {
+    serve_ctx_t *c = ctx;
+    tokenizer_t tokenizer = {0};
+    c->result = serve_tokenize(&cache, &test_arena, c->args, &tokenizer);
+}
+
+static void test_failed_files_are_not_cached(void) {
+    write_env("A=\"unterminated\n");
+    args_t args = file_args();
+    serve_ctx_t ctx = {.args = &args};
+
+    char err[1024] = {0};
+    capture_fd(stderr, err, sizeof(err) - 1, call_serve_tokenize, &ctx);
+
+    TEST_ASSERT_FALSE(ctx.result.ok);
+    TEST_ASSERT_NOT_NULL(strstr(err, SERVE_TEST_PATH));
+    TEST_ASSERT_EQUAL_size_t(0, cache.file_count);
+}
+
+#if defined(__linux__)
+// the watches on an inotify fd, as /proc lists them
+static size_t watch_count(int fd) {
+    char path[64];
+    snprintf(path, sizeof(path), "/proc/self/fdinfo/%d", fd);
+    FILE *f = fopen(path, "r");
+    TEST_ASSERT_NOT_NULL(f);
+
+    char line[512];
+    size_t count = 0;
+    while (fgets(line, sizeof(line), f) != NULL) {
+        count += strncmp(line, "inotify wd:", 11) == 0;
+    }
+    fclose(f);
+    return count;
+}
+
+// walks 'dir', cached under 'label' as the request's working directory
+static void scan_in(const char *dir, const char *label) {
+    char repo_dir[4096];
+    TEST_ASSERT_NOT_NULL(getcwd(repo_dir, sizeof(repo_dir)));
+    TEST_ASSERT_EQUAL_INT(0, chdir(dir));
+
+    cache.cwd = label;
+    args_t args = {.scan_threads = 1};
+    append_file_extension(&test_arena, &args.scan_exts, get_scan_extension("ts"));
+    scanner_t scanner = {0};
+    result_t result = serve_scan(&cache, &test_arena, &args, &scanner);
+
+    TEST_ASSERT_EQUAL_INT(0, chdir(repo_dir));
+    TEST_ASSERT_TRUE(result.ok);
+}
+
+static void test_watches_are_removed_with_their_last_scan(void) {
+    cache.inotify_fd = inotify_init1(IN_NONBLOCK | IN_CLOEXEC);
+    TEST_ASSERT_TRUE(cache.inotify_fd >= 0);
+    mkdir(SERVE_SCAN_DIR, 0755);
+    mkdir(SERVE_SCAN_DIR "/old", 0755);
+    mkdir(SERVE_SCAN_DIR "/old/a", 0755);
+    mkdir(SERVE_SCAN_DIR "/new", 0755);
+    mkdir(SERVE_SCAN_DIR "/new/b", 0755);
+    mkdir(SERVE_SCAN_DIR "/new/c", 0755);
+
+    scan_in(SERVE_SCAN_DIR "/old", "old");
+    TEST_ASSERT_EQUAL_size_t(2, watch_count(cache.inotify_fd));
+
+    // every scan of 'new' shares its three watches
+    for (size_t i = 1; i < SERVE_MAX_SCANS; ++i) {
+        scan_in(SERVE_SCAN_DIR "/new", arena_sprintf(&test_arena, "new %zu", i));
+    }
+    TEST_ASSERT_EQUAL_size_t(SERVE_MAX_SCANS, cache.scan_count);
+    TEST_ASSERT_EQUAL_size_t(5, watch_count(cache.inotify_fd));
+
+    // the cache is full, so the next scan evicts the oldest, the only one holding 'old'
+    scan_in(SERVE_SCAN_DIR "/new", "new 64");
+    TEST_ASSERT_EQUAL_size_t(3, watch_count(cache.inotify_fd));
+
+    // and evicting one of the scans of 'new' leaves the watches the others still hold
+    scan_in(SERVE_SCAN_DIR "/new", "new 65");
+    TEST_ASSERT_EQUAL_size_t(SERVE_MAX_SCANS, cache.scan_count);
+    TEST_ASSERT_EQUAL_size_t(3, watch_count(cache.inotify_fd));
+
+    rmdir(SERVE_SCAN_DIR "/new/c");
+    rmdir(SERVE_SCAN_DIR "/new/b");
+    rmdir(SERVE_SCAN_DIR "/new");
+    rmdir(SERVE_SCAN_DIR "/old/a");
+    rmdir(SERVE_SCAN_DIR "/old");
+    rmdir(SERVE_SCAN_DIR);
+}
+#endif
+
+#endif
+
+int main(void) {
+    UNITY_BEGIN();
+#if !defined(_WIN32)
+    RUN_TEST(test_tokens_are_cached_between_requests);
+    RUN_TEST(test_a_changed_file_is_tokenized_again);
+    RUN_TEST(test_racily_clean_files_are_not_cached);
+    RUN_TEST(test_stats_runs_bypass_the_cache);
+    RUN_TEST(test_failed_files_are_not_cached);
+#if defined(__linux__)
+    RUN_TEST(test_watches_are_removed_with_their_last_scan);
+#endif
+#endif
+    return UNITY_END();
+}
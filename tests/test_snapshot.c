@@ -0,0 +1,158 @@
+#include "arena.h"
+#include "parser.h"
+#include "snapshot.h"
+#include "test_capture.h"
+#include "unity.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/stat.h>
+
+#define SNAPSHOT_TEST_DIR "build/tests"
+#define SNAPSHOT_TEST_PATH SNAPSHOT_TEST_DIR "/nvi-unit.snap"
+
+static arena_t test_arena;
+
+void setUp(void) {
+    test_arena = (arena_t){0};
+    setenv("NVI_SNAPSHOT_DIR", SNAPSHOT_TEST_DIR, 1);
+    remove(SNAPSHOT_TEST_PATH);
+}
+
+void tearDown(void) {
+    remove(SNAPSHOT_TEST_PATH);
+    unsetenv("NVI_SNAPSHOT_DIR");
+    arena_free(&test_arena);
+}
+
+static void test_names_are_a_single_path_component(void) {
+    TEST_ASSERT_TRUE(is_valid_snapshot_name("web-1.prod_env"));
+    TEST_ASSERT_FALSE(is_valid_snapshot_name(""));
+    TEST_ASSERT_FALSE(is_valid_snapshot_name(".."));
+    TEST_ASSERT_FALSE(is_valid_snapshot_name("../etc"));
+    TEST_ASSERT_FALSE(is_valid_snapshot_name("a/b"));
+
+    char long_name[SNAPSHOT_MAX_NAME + 2];
+    memset(long_name, 'a', sizeof(long_name) - 1);
+    long_name[sizeof(long_name) - 1] = '\0';
+    TEST_ASSERT_FALSE(is_valid_snapshot_name(long_name));
+}
+
+#if !defined(_WIN32)
+
+static env_t envs[] = {{"A", "1"}, {"GREETING", "hello world"}, {"EMPTY", ""}};
+
+static env_map_t test_map(void) {
+    return (env_map_t){.items = envs, .count = sizeof(envs) / sizeof(envs[0])};
+}
+
+static void publish(uint64_t expected_generation) {
+    env_map_t map = test_map();
+    uint64_t generation = 0;
+    TEST_ASSERT_TRUE(publish_snapshot(&test_arena, "unit", &map, &generation).ok);
+    TEST_ASSERT_EQUAL_UINT64(expected_generation, generation);
+}
+
+static void test_a_published_snapshot_round_trips(void) {
+    publish(1);
+
+    snapshot_t snapshot = {0};
+    TEST_ASSERT_TRUE(open_snapshot(&test_arena, "unit", &snapshot).ok);
+
+    TEST_ASSERT_EQUAL_UINT32(3, snapshot.header->count);
+    TEST_ASSERT_EQUAL_MEMORY("A=1\0GREETING=hello world\0EMPTY=\0", snapshot.data, snapshot.header->data_len);
+
+    const snapshot_entry_t *entry = snapshot_get(&snapshot, "GREETING", 8);
+    TEST_ASSERT_NOT_NULL(entry);
+    TEST_ASSERT_EQUAL_STRING("hello world", snapshot.data + entry->value);
+    TEST_ASSERT_EQUAL_UINT32(0, snapshot_get(&snapshot, "EMPTY", 5)->value_len);
+    TEST_ASSERT_NULL(snapshot_get(&snapshot, "GREET", 5));
+
+    close_snapshot(&snapshot);
+}
+
+static void test_readers_keep_their_generation_across_a_publish(void) {
+    publish(1);
+    snapshot_t old = {0};
+    TEST_ASSERT_TRUE(open_snapshot(&test_arena, "unit", &old).ok);
+
+    envs[0].value = "2";
+    publish(2);
+    envs[0].value = "1";
+
+    snapshot_t current = {0};
+    TEST_ASSERT_TRUE(open_snapshot(&test_arena, "unit", &current).ok);
+    TEST_ASSERT_EQUAL_UINT64(1, old.header->generation);
+    TEST_ASSERT_EQUAL_STRING("1", old.data + snapshot_get(&old, "A", 1)->value);
+    TEST_ASSERT_EQUAL_UINT64(2, current.header->generation);
+    TEST_ASSERT_EQUAL_STRING("2", current.data + snapshot_get(&current, "A", 1)->value);
+
+    close_snapshot(&old);
+    close_snapshot(&current);
+}
+
+typedef struct {
+    result_t result;
+} open_ctx_t;
+
+static void call_open_snapshot(void *ctx) {
+    snapshot_t snapshot = {0};
+    ((open_ctx_t *)ctx)->result = open_snapshot(&test_arena, "unit", &snapshot);
+    close_snapshot(&snapshot);
+}
+
+static void test_a_damaged_snapshot_fails_the_checksum(void) {
+    publish(1);
+
+    // flip the last byte of the data block, the NUL after "EMPTY="
+    FILE *f = fopen(SNAPSHOT_TEST_PATH, "rb");
+    TEST_ASSERT_NOT_NULL(f);
+    char image[1024];
+    size_t size = fread(image, 1, sizeof(image), f);
+    fclose(f);
+    image[size - 1] = 'x';
+    remove(SNAPSHOT_TEST_PATH);
+    f = fopen(SNAPSHOT_TEST_PATH, "wb");
+    TEST_ASSERT_NOT_NULL(f);
+    fwrite(image, 1, size, f);
+    fclose(f);
+
+    open_ctx_t ctx = {0};
+    char err[1024] = {0};
+    capture_fd(stderr, err, sizeof(err) - 1, call_open_snapshot, &ctx);
+
+    TEST_ASSERT_FALSE(ctx.result.ok);
+    TEST_ASSERT_NOT_NULL(strstr(err, "checksum mismatch"));
+}
+
+static void test_a_snapshot_others_can_write_is_refused(void) {
+    publish(1);
+    TEST_ASSERT_EQUAL_INT(0, chmod(SNAPSHOT_TEST_PATH, 0622));
+
+    open_ctx_t ctx = {0};
+    char err[1024] = {0};
+    capture_fd(stderr, err, sizeof(err) - 1, call_open_snapshot, &ctx);
+
+    TEST_ASSERT_FALSE(ctx.result.ok);
+    TEST_ASSERT_NOT_NULL(strstr(err, "only its owner"));
+
+    // republishing replaces it with a file only its owner can read
+    publish(1);
+    snapshot_t snapshot = {0};
+    TEST_ASSERT_TRUE(open_snapshot(&test_arena, "unit", &snapshot).ok);
+    close_snapshot(&snapshot);
+}
+
+#endif
+
+int main(void) {
+    UNITY_BEGIN();
+    RUN_TEST(test_names_are_a_single_path_component);
+#if !defined(_WIN32)
+    RUN_TEST(test_a_published_snapshot_round_trips);
+    RUN_TEST(test_readers_keep_their_generation_across_a_publish);
+    RUN_TEST(test_a_damaged_snapshot_fails_the_checksum);
+    RUN_TEST(test_a_snapshot_others_can_write_is_refused);
+#endif
+    return UNITY_END();
+}
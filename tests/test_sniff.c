@@ -0,0 +1,78 @@
+#include "sniff.h"
+#include "unity.h"
+#include <string.h>
+
+void setUp(void) {}
+void tearDown(void) {}
+
+static void test_sniffs_minified_and_generated_names(void) {
+    TEST_ASSERT_EQUAL_INT(SNIFF_MINIFIED, sniff_name("vendor.min.js", SNIFF_ALL));
+    TEST_ASSERT_EQUAL_INT(SNIFF_GENERATED, sniff_name("pnpm-lock.yaml", SNIFF_ALL));
+    TEST_ASSERT_EQUAL_INT(SNIFF_GENERATED, sniff_name("service.pb.go", SNIFF_ALL));
+    TEST_ASSERT_EQUAL_INT(SNIFF_GENERATED, sniff_name("model_pb2.py", SNIFF_ALL));
+    TEST_ASSERT_EQUAL_INT(SNIFF_NONE, sniff_name("admin.js", SNIFF_ALL));
+    TEST_ASSERT_EQUAL_INT(SNIFF_NONE, sniff_name("lock.yaml", SNIFF_ALL));
+}
+
+static void test_sniffs_a_nul_byte_as_binary(void) {
+    const char s[] = "const k = process.env.KEY;\0\x01\x02";
+    TEST_ASSERT_EQUAL_INT(SNIFF_BINARY, sniff_contents(s, sizeof(s) - 1, SNIFF_ALL));
+}
+
+static void test_sniffs_a_nul_byte_past_the_vector_blocks(void) {
+    // 40 bytes: two 16-byte blocks, then the NUL in the scalar tail
+    char s[40];
+    memset(s, 'a', sizeof(s));
+    s[37] = '\0';
+    TEST_ASSERT_EQUAL_INT(SNIFF_BINARY, sniff_contents(s, sizeof(s), SNIFF_ALL));
+}
+
+static void test_sniffs_long_lines_as_minified(void) {
+    char s[SNIFF_SIZE];
+    memset(s, 'x', sizeof(s));
+    s[2000] = '\n';
+    TEST_ASSERT_EQUAL_INT(SNIFF_MINIFIED, sniff_contents(s, sizeof(s), SNIFF_ALL));
+
+    // the same bytes broken into 80 column lines are ordinary source
+    for (size_t i = 80; i < sizeof(s); i += 81) {
+        s[i] = '\n';
+    }
+    TEST_ASSERT_EQUAL_INT(SNIFF_NONE, sniff_contents(s, sizeof(s), SNIFF_ALL));
+}
+
+static void test_does_not_call_a_short_single_line_minified(void) {
+    const char *s = "module.exports = { url: process.env.URL };";
+    TEST_ASSERT_EQUAL_INT(SNIFF_NONE, sniff_contents(s, strlen(s), SNIFF_ALL));
+}
+
+static void test_sniffs_the_generated_marker(void) {
+    const char *s = "// Code below is @generated by protoc; do not edit\nexport const x = 1;\n";
+    TEST_ASSERT_EQUAL_INT(SNIFF_GENERATED, sniff_contents(s, strlen(s), SNIFF_ALL));
+}
+
+static void test_only_sniffs_enabled_kinds(void) {
+    const char s[] = "// @generated\n\0";
+    TEST_ASSERT_EQUAL_INT(SNIFF_GENERATED, sniff_contents(s, sizeof(s) - 1, SNIFF_BIT(SNIFF_GENERATED)));
+    TEST_ASSERT_EQUAL_INT(SNIFF_NONE, sniff_contents(s, sizeof(s) - 1, 0));
+    TEST_ASSERT_EQUAL_INT(SNIFF_NONE, sniff_name("vendor.min.js", SNIFF_BIT(SNIFF_BINARY)));
+}
+
+static void test_sniff_names_round_trip(void) {
+    for (sniff_kind_t kind = SNIFF_NONE; kind < SNIFF_UNKNOWN; ++kind) {
+        TEST_ASSERT_EQUAL_INT(kind, get_sniff(get_sniff_name(kind)));
+    }
+    TEST_ASSERT_EQUAL_INT(SNIFF_UNKNOWN, get_sniff("vendored"));
+}
+
+int main(void) {
+    UNITY_BEGIN();
+    RUN_TEST(test_sniffs_minified_and_generated_names);
+    RUN_TEST(test_sniffs_a_nul_byte_as_binary);
+    RUN_TEST(test_sniffs_a_nul_byte_past_the_vector_blocks);
+    RUN_TEST(test_sniffs_long_lines_as_minified);
+    RUN_TEST(test_does_not_call_a_short_single_line_minified);
+    RUN_TEST(test_sniffs_the_generated_marker);
+    RUN_TEST(test_only_sniffs_enabled_kinds);
+    RUN_TEST(test_sniff_names_round_trip);
+    return UNITY_END();
+}
@@ -0,0 +1,107 @@
+#include "arena.h"
+#include "stats.h"
+#include "unity.h"
+#include <stdio.h>
+#include <string.h>
+
+static arena_t test_arena;
+
+void setUp(void) { test_arena = (arena_t){0}; }
+void tearDown(void) { arena_free(&test_arena); }
+
+static void test_latency_buckets_are_log2_microseconds(void) {
+    TEST_ASSERT_EQUAL_size_t(0, stats_latency_bucket(0));
+    TEST_ASSERT_EQUAL_size_t(0, stats_latency_bucket(0.5e-6));
+    TEST_ASSERT_EQUAL_size_t(1, stats_latency_bucket(1e-6));
+    TEST_ASSERT_EQUAL_size_t(2, stats_latency_bucket(2e-6));
+    TEST_ASSERT_EQUAL_size_t(2, stats_latency_bucket(3.9e-6));
+    TEST_ASSERT_EQUAL_size_t(11, stats_latency_bucket(1.5e-3));
+}
+
+static void test_latency_bucket_caps_at_the_last_bucket(void) {
+    TEST_ASSERT_EQUAL_size_t(STATS_LATENCY_BUCKETS - 1, stats_latency_bucket(3600.0));
+}
+
+static void test_record_file_counts_into_the_histogram(void) {
+    scan_stats_t stats = {0};
+    stats_record_file(&test_arena, &stats, "a.ts", 10, 3e-6);
+    stats_record_file(&test_arena, &stats, "b.ts", 10, 3.5e-6);
+    TEST_ASSERT_EQUAL_size_t(2, stats.latency[2]);
+    TEST_ASSERT_EQUAL_size_t(2, stats.slowest_count);
+}
+
+static void test_slowest_files_are_sorted_and_capped(void) {
+    scan_stats_t stats = {0};
+    char path[16];
+
+    for (size_t i = 0; i < STATS_SLOWEST * 2; ++i) {
+        // interleave fast and slow files so insertion has to shift entries
+        double seconds = (i % 2 == 0 ? (double)i : (double)(100 + i)) * 1e-6;
+        snprintf(path, sizeof(path), "f%zu.ts", i);
+        stats_record_file(&test_arena, &stats, path, i, seconds);
+    }
+
+    TEST_ASSERT_EQUAL_size_t(STATS_SLOWEST, stats.slowest_count);
+    TEST_ASSERT_EQUAL_STRING("f19.ts", stats.slowest[0].path);
+    TEST_ASSERT_EQUAL_STRING("f1.ts", stats.slowest[STATS_SLOWEST - 1].path);
+    for (size_t i = 1; i < stats.slowest_count; ++i) {
+        TEST_ASSERT_TRUE(stats.slowest[i - 1].seconds >= stats.slowest[i].seconds);
+    }
+}
+
+static void test_slowest_paths_are_copied(void) {
+    scan_stats_t stats = {0};
+    char path[] = "src/app.ts";
+    stats_record_file(&test_arena, &stats, path, 1, 1e-3);
+    path[0] = 'X';
+    TEST_ASSERT_EQUAL_STRING("src/app.ts", stats.slowest[0].path);
+}
+
+static void test_merge_sums_counters_and_keeps_the_slowest(void) {
+    scan_stats_t a = {0};
+    scan_stats_t b = {0};
+    a.totals = (worker_stats_t){.dirs = 1, .files = 2, .bytes_read = 30, .busy = 1.0, .idle = 0.5};
+    b.totals = (worker_stats_t){.dirs = 3, .files = 4, .bytes_read = 70, .busy = 2.0, .idle = 0.25};
+    a.totals.perf.counts[PERF_INSTRUCTIONS] = 1000;
+    b.totals.perf.counts[PERF_INSTRUCTIONS] = 500;
+    a.skipped[SKIP_HIDDEN] = 2;
+    b.skipped[SKIP_HIDDEN] = 1;
+    b.skipped[SKIP_UNREADABLE] = 1;
+    stats_record_file(&test_arena, &a, "a.ts", 30, 2e-3);
+    stats_record_file(&test_arena, &b, "b.ts", 70, 5e-3);
+
+    scan_stats_t merged = {0};
+    stats_merge(&test_arena, &merged, &a);
+    stats_merge(&test_arena, &merged, &b);
+
+    TEST_ASSERT_EQUAL_size_t(4, merged.totals.dirs);
+    TEST_ASSERT_EQUAL_size_t(6, merged.totals.files);
+    TEST_ASSERT_EQUAL_size_t(100, merged.totals.bytes_read);
+    TEST_ASSERT_TRUE(merged.totals.busy == 3.0);
+    TEST_ASSERT_TRUE(merged.totals.idle == 0.75);
+    TEST_ASSERT_EQUAL_UINT64(1500, merged.totals.perf.counts[PERF_INSTRUCTIONS]);
+    TEST_ASSERT_EQUAL_size_t(3, merged.skipped[SKIP_HIDDEN]);
+    TEST_ASSERT_EQUAL_size_t(1, merged.skipped[SKIP_UNREADABLE]);
+    TEST_ASSERT_EQUAL_size_t(2, merged.slowest_count);
+    TEST_ASSERT_EQUAL_STRING("b.ts", merged.slowest[0].path);
+    TEST_ASSERT_EQUAL_STRING("a.ts", merged.slowest[1].path);
+}
+
+static void test_stats_format_names_round_trip(void) {
+    TEST_ASSERT_EQUAL_INT(STATS_TEXT, get_stats_format("text"));
+    TEST_ASSERT_EQUAL_INT(STATS_JSON, get_stats_format("json"));
+    TEST_ASSERT_EQUAL_INT(STATS_UNKNOWN, get_stats_format("yaml"));
+    TEST_ASSERT_EQUAL_STRING("json", get_stats_format_name(STATS_JSON));
+}
+
+int main(void) {
+    UNITY_BEGIN();
+    RUN_TEST(test_latency_buckets_are_log2_microseconds);
+    RUN_TEST(test_latency_bucket_caps_at_the_last_bucket);
+    RUN_TEST(test_record_file_counts_into_the_histogram);
+    RUN_TEST(test_slowest_files_are_sorted_and_capped);
+    RUN_TEST(test_slowest_paths_are_copied);
+    RUN_TEST(test_merge_sums_counters_and_keeps_the_slowest);
+    RUN_TEST(test_stats_format_names_round_trip);
+    return UNITY_END();
+}
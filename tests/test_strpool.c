@@ -0,0 +1,73 @@
+#include "arena.h"
+#include "strpool.h"
+#include "unity.h"
+#include <stdio.h>
+#include <string.h>
+
+static arena_t test_arena;
+
+void setUp(void) { test_arena = (arena_t){0}; }
+void tearDown(void) { arena_free(&test_arena); }
+
+static void test_intern_stores_a_terminated_copy(void) {
+    strpool_t pool = {0};
+    const char src[] = "https://example.com";
+    size_t offset = strpool_intern(&test_arena, &pool, src, strlen(src));
+
+    TEST_ASSERT_EQUAL_STRING(src, strpool_at(&pool, offset));
+    TEST_ASSERT_NOT_EQUAL(src, strpool_at(&pool, offset));
+    TEST_ASSERT_EQUAL_size_t(sizeof(src), pool.bytes.count);
+}
+
+static void test_identical_strings_are_stored_once(void) {
+    strpool_t pool = {0};
+    size_t first = strpool_intern(&test_arena, &pool, "true", 4);
+    size_t other = strpool_intern(&test_arena, &pool, "false", 5);
+    size_t again = strpool_intern(&test_arena, &pool, "true", 4);
+
+    TEST_ASSERT_EQUAL_size_t(first, again);
+    TEST_ASSERT_NOT_EQUAL(first, other);
+    TEST_ASSERT_EQUAL_size_t(5 + 6, pool.bytes.count);
+}
+
+static void test_prefixes_and_empty_strings_are_distinct(void) {
+    strpool_t pool = {0};
+    size_t empty = strpool_intern(&test_arena, &pool, "", 0);
+    size_t whole = strpool_intern(&test_arena, &pool, "abc", 3);
+    size_t prefix = strpool_intern(&test_arena, &pool, "abc", 2);
+
+    TEST_ASSERT_EQUAL_STRING("", strpool_at(&pool, empty));
+    TEST_ASSERT_EQUAL_STRING("abc", strpool_at(&pool, whole));
+    TEST_ASSERT_EQUAL_STRING("ab", strpool_at(&pool, prefix));
+    TEST_ASSERT_EQUAL_size_t(empty, strpool_intern(&test_arena, &pool, "", 0));
+}
+
+// enough strings to move the buffer many times; lookups must follow it
+static void test_growth_keeps_every_string_interned(void) {
+    enum { N = 500 };
+    static size_t offsets[N];
+    char s[32];
+
+    strpool_t pool = {0};
+    for (int i = 0; i < N; ++i) {
+        int n = snprintf(s, sizeof(s), "value-%d", i);
+        offsets[i] = strpool_intern(&test_arena, &pool, s, (size_t)n);
+    }
+
+    size_t len = pool.bytes.count;
+    for (int i = 0; i < N; ++i) {
+        int n = snprintf(s, sizeof(s), "value-%d", i);
+        TEST_ASSERT_EQUAL_size_t(offsets[i], strpool_intern(&test_arena, &pool, s, (size_t)n));
+        TEST_ASSERT_EQUAL_STRING(s, strpool_at(&pool, offsets[i]));
+    }
+    TEST_ASSERT_EQUAL_size_t(len, pool.bytes.count);
+}
+
+int main(void) {
+    UNITY_BEGIN();
+    RUN_TEST(test_intern_stores_a_terminated_copy);
+    RUN_TEST(test_identical_strings_are_stored_once);
+    RUN_TEST(test_prefixes_and_empty_strings_are_distinct);
+    RUN_TEST(test_growth_keeps_every_string_interned);
+    return UNITY_END();
+}
@@ -21,8 +21,18 @@ static result_t tokenize(const char *src, tokenizer_t *out) {
     return generate_tokens(&test_arena, &test_arena, &args, &file, out);
 }
 
-static const value_token_t *val(const tokenizer_t *t, size_t tok, size_t v) {
-    return &t->tokens.items[tok].values.items[v];
+typedef struct {
+    value_kind_t kind;
+    const char *value;
+    size_t line;
+} value_view_t;
+
+// value 'v' of token 'tok'
+static value_view_t val(const tokenizer_t *t, size_t tok, size_t v) {
+    const token_list_t *tokens = &t->tokens;
+    size_t i = tokens->first_values[tok] + v;
+    return (value_view_t){
+        .kind = (value_kind_t)tokens->kinds[i], .value = token_value(tokens, tok, i), .line = tokens->lines[i]};
 }
 
 typedef struct {
@@ -48,10 +58,51 @@ static void test_simple_key_value(void) {
     result_t r = tokenize("KEY=value\n", &t);
     TEST_ASSERT_TRUE(r.ok);
     TEST_ASSERT_EQUAL_size_t(1, t.tokens.count);
-    TEST_ASSERT_EQUAL_STRING("KEY", t.tokens.items[0].key);
-    TEST_ASSERT_EQUAL_size_t(1, t.tokens.items[0].values.count);
-    TEST_ASSERT_EQUAL_INT(LITERAL_VALUE, val(&t, 0, 0)->kind);
-    TEST_ASSERT_EQUAL_STRING("value", val(&t, 0, 0)->value);
+    TEST_ASSERT_EQUAL_STRING("KEY", token_key(&t.tokens, 0));
+    TEST_ASSERT_EQUAL_size_t(1, t.tokens.value_counts[0]);
+    TEST_ASSERT_EQUAL_INT(LITERAL_VALUE, val(&t, 0, 0).kind);
+    TEST_ASSERT_EQUAL_STRING("value", val(&t, 0, 0).value);
+}
+
+static void test_values_are_parallel_arrays_into_one_pool(void) {
+    tokenizer_t t;
+    result_t r = tokenize("A=one\nB=x${A}y\n", &t);
+    TEST_ASSERT_TRUE(r.ok);
+    TEST_ASSERT_EQUAL_size_t(2, t.tokens.count);
+    TEST_ASSERT_EQUAL_size_t(4, t.tokens.value_count);
+    TEST_ASSERT_EQUAL_size_t(1, t.tokens.files.count);
+    TEST_ASSERT_EQUAL_UINT32(0, t.tokens.first_values[0]);
+    TEST_ASSERT_EQUAL_UINT32(1, t.tokens.first_values[1]);
+    TEST_ASSERT_EQUAL_UINT32(3, t.tokens.value_counts[1]);
+    TEST_ASSERT_EQUAL_UINT8(INTERPOLATED_KEY, t.tokens.kinds[2]);
+    TEST_ASSERT_EQUAL_UINT32(1, t.tokens.lens[2]);
+
+    // keys and values sit back to back in the file's pool
+    TEST_ASSERT_EQUAL_UINT32(0, t.tokens.keys[0]);
+    TEST_ASSERT_EQUAL_UINT32(2, t.tokens.offsets[0]);
+    TEST_ASSERT_EQUAL_UINT32(6, t.tokens.keys[1]);
+    TEST_ASSERT_EQUAL_MEMORY("A\0one\0B\0x\0A\0y\0", t.tokens.files.items[0].pool, 14);
+}
+
+static void test_appending_shares_the_pools(void) {
+    tokenizer_t a;
+    tokenizer_t b;
+    TEST_ASSERT_TRUE(tokenize("A=1\n# note\n", &a).ok);
+    TEST_ASSERT_TRUE(tokenize("B=${A}2\n", &b).ok);
+
+    token_list_t both = {0};
+    TEST_ASSERT_TRUE(token_list_append(&test_arena, &both, &a.tokens).ok);
+    TEST_ASSERT_TRUE(token_list_append(&test_arena, &both, &b.tokens).ok);
+
+    TEST_ASSERT_EQUAL_size_t(3, both.count);
+    TEST_ASSERT_EQUAL_size_t(4, both.value_count);
+    TEST_ASSERT_EQUAL_size_t(2, both.files.count);
+    TEST_ASSERT_EQUAL_UINT32(1, both.file_indexes[2]);
+    TEST_ASSERT_EQUAL_UINT32(2, both.first_values[2]);
+    TEST_ASSERT_EQUAL_PTR(token_key(&b.tokens, 0), token_key(&both, 2));
+    TEST_ASSERT_NULL(token_key(&both, 1));
+    TEST_ASSERT_EQUAL_STRING("A", token_value(&both, 2, 2));
+    TEST_ASSERT_EQUAL_STRING("2", token_value(&both, 2, 3));
 }
 
 static void test_key_value_without_trailing_newline(void) {
@@ -59,8 +110,8 @@ static void test_key_value_without_trailing_newline(void) {
     result_t r = tokenize("KEY=value", &t);
     TEST_ASSERT_TRUE(r.ok);
     TEST_ASSERT_EQUAL_size_t(1, t.tokens.count);
-    TEST_ASSERT_EQUAL_STRING("KEY", t.tokens.items[0].key);
-    TEST_ASSERT_EQUAL_STRING("value", val(&t, 0, 0)->value);
+    TEST_ASSERT_EQUAL_STRING("KEY", token_key(&t.tokens, 0));
+    TEST_ASSERT_EQUAL_STRING("value", val(&t, 0, 0).value);
 }
 
 static void test_multiline_continuation(void) {
@@ -68,12 +119,12 @@ static void test_multiline_continuation(void) {
     result_t r = tokenize("A=123\\\n456\n", &t);
     TEST_ASSERT_TRUE(r.ok);
     TEST_ASSERT_EQUAL_size_t(1, t.tokens.count);
-    TEST_ASSERT_EQUAL_STRING("A", t.tokens.items[0].key);
-    TEST_ASSERT_EQUAL_size_t(2, t.tokens.items[0].values.count);
-    TEST_ASSERT_EQUAL_STRING("123", val(&t, 0, 0)->value);
-    TEST_ASSERT_EQUAL_STRING("456", val(&t, 0, 1)->value);
-    TEST_ASSERT_EQUAL_size_t(1, val(&t, 0, 0)->line);
-    TEST_ASSERT_EQUAL_size_t(2, val(&t, 0, 1)->line);
+    TEST_ASSERT_EQUAL_STRING("A", token_key(&t.tokens, 0));
+    TEST_ASSERT_EQUAL_size_t(2, t.tokens.value_counts[0]);
+    TEST_ASSERT_EQUAL_STRING("123", val(&t, 0, 0).value);
+    TEST_ASSERT_EQUAL_STRING("456", val(&t, 0, 1).value);
+    TEST_ASSERT_EQUAL_size_t(1, val(&t, 0, 0).line);
+    TEST_ASSERT_EQUAL_size_t(2, val(&t, 0, 1).line);
 }
 
 static void test_interpolation_inside_multiline(void) {
@@ -81,13 +132,13 @@ static void test_interpolation_inside_multiline(void) {
     result_t r = tokenize("KEY=abc\\\n${OTHER}def\n", &t);
     TEST_ASSERT_TRUE(r.ok);
     TEST_ASSERT_EQUAL_size_t(1, t.tokens.count);
-    TEST_ASSERT_EQUAL_size_t(3, t.tokens.items[0].values.count);
-    TEST_ASSERT_EQUAL_INT(LITERAL_VALUE, val(&t, 0, 0)->kind);
-    TEST_ASSERT_EQUAL_STRING("abc", val(&t, 0, 0)->value);
-    TEST_ASSERT_EQUAL_INT(INTERPOLATED_KEY, val(&t, 0, 1)->kind);
-    TEST_ASSERT_EQUAL_STRING("OTHER", val(&t, 0, 1)->value);
-    TEST_ASSERT_EQUAL_INT(LITERAL_VALUE, val(&t, 0, 2)->kind);
-    TEST_ASSERT_EQUAL_STRING("def", val(&t, 0, 2)->value);
+    TEST_ASSERT_EQUAL_size_t(3, t.tokens.value_counts[0]);
+    TEST_ASSERT_EQUAL_INT(LITERAL_VALUE, val(&t, 0, 0).kind);
+    TEST_ASSERT_EQUAL_STRING("abc", val(&t, 0, 0).value);
+    TEST_ASSERT_EQUAL_INT(INTERPOLATED_KEY, val(&t, 0, 1).kind);
+    TEST_ASSERT_EQUAL_STRING("OTHER", val(&t, 0, 1).value);
+    TEST_ASSERT_EQUAL_INT(LITERAL_VALUE, val(&t, 0, 2).kind);
+    TEST_ASSERT_EQUAL_STRING("def", val(&t, 0, 2).value);
 }
 
 static void test_multiline_ssh_key_with_interp_and_literals(void) {
@@ -95,23 +146,23 @@ static void test_multiline_ssh_key_with_interp_and_literals(void) {
     result_t r = tokenize("MULTI=ssh-rsa ABC\\\ng3HI$\\\n+jk${MESSAGE}/4\\\nLm5Mn== test@example.com\n", &t);
     TEST_ASSERT_TRUE(r.ok);
     TEST_ASSERT_EQUAL_size_t(1, t.tokens.count);
-    TEST_ASSERT_EQUAL_STRING("MULTI", t.tokens.items[0].key);
-    TEST_ASSERT_EQUAL_size_t(6, t.tokens.items[0].values.count);
-    TEST_ASSERT_EQUAL_STRING("ssh-rsa ABC", val(&t, 0, 0)->value);
-    TEST_ASSERT_EQUAL_STRING("g3HI$", val(&t, 0, 1)->value);
-    TEST_ASSERT_EQUAL_STRING("+jk", val(&t, 0, 2)->value);
-    TEST_ASSERT_EQUAL_INT(INTERPOLATED_KEY, val(&t, 0, 3)->kind);
-    TEST_ASSERT_EQUAL_STRING("MESSAGE", val(&t, 0, 3)->value);
-    TEST_ASSERT_EQUAL_STRING("/4", val(&t, 0, 4)->value);
-    TEST_ASSERT_EQUAL_STRING("Lm5Mn== test@example.com", val(&t, 0, 5)->value);
+    TEST_ASSERT_EQUAL_STRING("MULTI", token_key(&t.tokens, 0));
+    TEST_ASSERT_EQUAL_size_t(6, t.tokens.value_counts[0]);
+    TEST_ASSERT_EQUAL_STRING("ssh-rsa ABC", val(&t, 0, 0).value);
+    TEST_ASSERT_EQUAL_STRING("g3HI$", val(&t, 0, 1).value);
+    TEST_ASSERT_EQUAL_STRING("+jk", val(&t, 0, 2).value);
+    TEST_ASSERT_EQUAL_INT(INTERPOLATED_KEY, val(&t, 0, 3).kind);
+    TEST_ASSERT_EQUAL_STRING("MESSAGE", val(&t, 0, 3).value);
+    TEST_ASSERT_EQUAL_STRING("/4", val(&t, 0, 4).value);
+    TEST_ASSERT_EQUAL_STRING("Lm5Mn== test@example.com", val(&t, 0, 5).value);
 }
 
 static void test_equals_is_literal_after_key(void) {
     tokenizer_t t;
     result_t r = tokenize("KEY=a==b\n", &t);
     TEST_ASSERT_TRUE(r.ok);
-    TEST_ASSERT_EQUAL_STRING("KEY", t.tokens.items[0].key);
-    TEST_ASSERT_EQUAL_STRING("a==b", val(&t, 0, 0)->value);
+    TEST_ASSERT_EQUAL_STRING("KEY", token_key(&t.tokens, 0));
+    TEST_ASSERT_EQUAL_STRING("a==b", val(&t, 0, 0).value);
 }
 
 static void test_parses_a_comment(void) {
@@ -119,18 +170,18 @@ static void test_parses_a_comment(void) {
     result_t r = tokenize("# a comment\n", &t);
     TEST_ASSERT_TRUE(r.ok);
     TEST_ASSERT_EQUAL_size_t(1, t.tokens.count);
-    TEST_ASSERT_NULL(t.tokens.items[0].key);
-    TEST_ASSERT_EQUAL_INT(COMMENTED_LINE, val(&t, 0, 0)->kind);
-    TEST_ASSERT_EQUAL_STRING("# a comment", val(&t, 0, 0)->value);
+    TEST_ASSERT_NULL(token_key(&t.tokens, 0));
+    TEST_ASSERT_EQUAL_INT(COMMENTED_LINE, val(&t, 0, 0).kind);
+    TEST_ASSERT_EQUAL_STRING("# a comment", val(&t, 0, 0).value);
 }
 
 static void test_parses_interpolated_value(void) {
     tokenizer_t t;
     result_t r = tokenize("KEY=${OTHER}\n", &t);
     TEST_ASSERT_TRUE(r.ok);
-    TEST_ASSERT_EQUAL_STRING("KEY", t.tokens.items[0].key);
-    TEST_ASSERT_EQUAL_INT(INTERPOLATED_KEY, val(&t, 0, 0)->kind);
-    TEST_ASSERT_EQUAL_STRING("OTHER", val(&t, 0, 0)->value);
+    TEST_ASSERT_EQUAL_STRING("KEY", token_key(&t.tokens, 0));
+    TEST_ASSERT_EQUAL_INT(INTERPOLATED_KEY, val(&t, 0, 0).kind);
+    TEST_ASSERT_EQUAL_STRING("OTHER", val(&t, 0, 0).value);
 }
 
 // --- error paths (these intentionally log diagnostics to stderr) ---
@@ -178,16 +229,16 @@ static void test_crlf_line_endings(void) {
     result_t r = tokenize("A=1\r\nB=2\r\n", &t);
     TEST_ASSERT_TRUE(r.ok);
     TEST_ASSERT_EQUAL_size_t(2, t.tokens.count);
-    TEST_ASSERT_EQUAL_STRING("1", val(&t, 0, 0)->value);
-    TEST_ASSERT_EQUAL_STRING("2", val(&t, 1, 0)->value);
-    TEST_ASSERT_EQUAL_size_t(2, val(&t, 1, 0)->line);
+    TEST_ASSERT_EQUAL_STRING("1", val(&t, 0, 0).value);
+    TEST_ASSERT_EQUAL_STRING("2", val(&t, 1, 0).value);
+    TEST_ASSERT_EQUAL_size_t(2, val(&t, 1, 0).line);
 }
 
 static void test_lone_carriage_return_is_literal(void) {
     tokenizer_t t;
     result_t r = tokenize("KEY=a\rb\n", &t);
     TEST_ASSERT_TRUE(r.ok);
-    TEST_ASSERT_EQUAL_STRING("a\rb", val(&t, 0, 0)->value);
+    TEST_ASSERT_EQUAL_STRING("a\rb", val(&t, 0, 0).value);
 }
 
 static void test_crlf_multiline_continuation(void) {
@@ -195,9 +246,9 @@ static void test_crlf_multiline_continuation(void) {
     result_t r = tokenize("A=123\\\r\n456\r\n", &t);
     TEST_ASSERT_TRUE(r.ok);
     TEST_ASSERT_EQUAL_size_t(1, t.tokens.count);
-    TEST_ASSERT_EQUAL_size_t(2, t.tokens.items[0].values.count);
-    TEST_ASSERT_EQUAL_STRING("123", val(&t, 0, 0)->value);
-    TEST_ASSERT_EQUAL_STRING("456", val(&t, 0, 1)->value);
+    TEST_ASSERT_EQUAL_size_t(2, t.tokens.value_counts[0]);
+    TEST_ASSERT_EQUAL_STRING("123", val(&t, 0, 0).value);
+    TEST_ASSERT_EQUAL_STRING("456", val(&t, 0, 1).value);
 }
 
 static void test_crlf_after_interpolation(void) {
@@ -205,9 +256,9 @@ static void test_crlf_after_interpolation(void) {
     result_t r = tokenize("KEY=${OTHER}\r\nB=2\r\n", &t);
     TEST_ASSERT_TRUE(r.ok);
     TEST_ASSERT_EQUAL_size_t(2, t.tokens.count);
-    TEST_ASSERT_EQUAL_INT(INTERPOLATED_KEY, val(&t, 0, 0)->kind);
-    TEST_ASSERT_EQUAL_STRING("OTHER", val(&t, 0, 0)->value);
-    TEST_ASSERT_EQUAL_STRING("2", val(&t, 1, 0)->value);
+    TEST_ASSERT_EQUAL_INT(INTERPOLATED_KEY, val(&t, 0, 0).kind);
+    TEST_ASSERT_EQUAL_STRING("OTHER", val(&t, 0, 0).value);
+    TEST_ASSERT_EQUAL_STRING("2", val(&t, 1, 0).value);
 }
 
 static void test_crlf_comment(void) {
@@ -215,8 +266,8 @@ static void test_crlf_comment(void) {
     result_t r = tokenize("# a comment\r\nA=1\r\n", &t);
     TEST_ASSERT_TRUE(r.ok);
     TEST_ASSERT_EQUAL_size_t(2, t.tokens.count);
-    TEST_ASSERT_EQUAL_INT(COMMENTED_LINE, val(&t, 0, 0)->kind);
-    TEST_ASSERT_EQUAL_STRING("# a comment", val(&t, 0, 0)->value);
+    TEST_ASSERT_EQUAL_INT(COMMENTED_LINE, val(&t, 0, 0).kind);
+    TEST_ASSERT_EQUAL_STRING("# a comment", val(&t, 0, 0).value);
 }
 
 static void test_errors_on_unterminated_interpolation_crlf(void) {
@@ -229,8 +280,8 @@ static void test_utf8_bom_is_stripped(void) {
     tokenizer_t t;
     result_t r = tokenize("\xEF\xBB\xBFKEY=value\n", &t);
     TEST_ASSERT_TRUE(r.ok);
-    TEST_ASSERT_EQUAL_STRING("KEY", t.tokens.items[0].key);
-    TEST_ASSERT_EQUAL_STRING("value", val(&t, 0, 0)->value);
+    TEST_ASSERT_EQUAL_STRING("KEY", token_key(&t.tokens, 0));
+    TEST_ASSERT_EQUAL_STRING("value", val(&t, 0, 0).value);
 }
 
 typedef struct {
@@ -271,49 +322,49 @@ static void test_double_quotes_are_stripped(void) {
     result_t r = tokenize("KEY=\"hello world\"\n", &t);
     TEST_ASSERT_TRUE(r.ok);
     TEST_ASSERT_EQUAL_size_t(1, t.tokens.count);
-    TEST_ASSERT_EQUAL_STRING("hello world", val(&t, 0, 0)->value);
+    TEST_ASSERT_EQUAL_STRING("hello world", val(&t, 0, 0).value);
 }
 
 static void test_double_quotes_preserve_inner_whitespace(void) {
     tokenizer_t t;
     result_t r = tokenize("KEY=\"  padded  \"\n", &t);
     TEST_ASSERT_TRUE(r.ok);
-    TEST_ASSERT_EQUAL_STRING("  padded  ", val(&t, 0, 0)->value);
+    TEST_ASSERT_EQUAL_STRING("  padded  ", val(&t, 0, 0).value);
 }
 
 static void test_single_quotes_suppress_interpolation(void) {
     tokenizer_t t;
     result_t r = tokenize("KEY='${OTHER}'\n", &t);
     TEST_ASSERT_TRUE(r.ok);
-    TEST_ASSERT_EQUAL_size_t(1, t.tokens.items[0].values.count);
-    TEST_ASSERT_EQUAL_INT(LITERAL_VALUE, val(&t, 0, 0)->kind);
-    TEST_ASSERT_EQUAL_STRING("${OTHER}", val(&t, 0, 0)->value);
+    TEST_ASSERT_EQUAL_size_t(1, t.tokens.value_counts[0]);
+    TEST_ASSERT_EQUAL_INT(LITERAL_VALUE, val(&t, 0, 0).kind);
+    TEST_ASSERT_EQUAL_STRING("${OTHER}", val(&t, 0, 0).value);
 }
 
 static void test_single_quotes_keep_backslashes_literal(void) {
     tokenizer_t t;
     result_t r = tokenize("KEY='a\\b'\n", &t);
     TEST_ASSERT_TRUE(r.ok);
-    TEST_ASSERT_EQUAL_STRING("a\\b", val(&t, 0, 0)->value);
+    TEST_ASSERT_EQUAL_STRING("a\\b", val(&t, 0, 0).value);
 }
 
 static void test_interpolation_inside_double_quotes(void) {
     tokenizer_t t;
     result_t r = tokenize("KEY=\"${A}b\"\n", &t);
     TEST_ASSERT_TRUE(r.ok);
-    TEST_ASSERT_EQUAL_size_t(2, t.tokens.items[0].values.count);
-    TEST_ASSERT_EQUAL_INT(INTERPOLATED_KEY, val(&t, 0, 0)->kind);
-    TEST_ASSERT_EQUAL_STRING("A", val(&t, 0, 0)->value);
-    TEST_ASSERT_EQUAL_STRING("b", val(&t, 0, 1)->value);
+    TEST_ASSERT_EQUAL_size_t(2, t.tokens.value_counts[0]);
+    TEST_ASSERT_EQUAL_INT(INTERPOLATED_KEY, val(&t, 0, 0).kind);
+    TEST_ASSERT_EQUAL_STRING("A", val(&t, 0, 0).value);
+    TEST_ASSERT_EQUAL_STRING("b", val(&t, 0, 1).value);
 }
 
 static void test_continuation_inside_double_quotes(void) {
     tokenizer_t t;
     result_t r = tokenize("KEY=\"a\\\nb\"\n", &t);
     TEST_ASSERT_TRUE(r.ok);
-    TEST_ASSERT_EQUAL_size_t(2, t.tokens.items[0].values.count);
-    TEST_ASSERT_EQUAL_STRING("a", val(&t, 0, 0)->value);
-    TEST_ASSERT_EQUAL_STRING("b", val(&t, 0, 1)->value);
+    TEST_ASSERT_EQUAL_size_t(2, t.tokens.value_counts[0]);
+    TEST_ASSERT_EQUAL_STRING("a", val(&t, 0, 0).value);
+    TEST_ASSERT_EQUAL_STRING("b", val(&t, 0, 1).value);
 }
 
 static void test_quoted_empty_values_are_allowed(void) {
@@ -321,23 +372,23 @@ static void test_quoted_empty_values_are_allowed(void) {
     result_t r = tokenize("A=\"\"\nB=''\n", &t);
     TEST_ASSERT_TRUE(r.ok);
     TEST_ASSERT_EQUAL_size_t(2, t.tokens.count);
-    TEST_ASSERT_EQUAL_STRING("", val(&t, 0, 0)->value);
-    TEST_ASSERT_EQUAL_STRING("", val(&t, 1, 0)->value);
+    TEST_ASSERT_EQUAL_STRING("", val(&t, 0, 0).value);
+    TEST_ASSERT_EQUAL_STRING("", val(&t, 1, 0).value);
 }
 
 static void test_mid_value_quotes_stay_literal(void) {
     tokenizer_t t;
     result_t r = tokenize("KEY=it's\nQ=sad\"wow\"bak\n", &t);
     TEST_ASSERT_TRUE(r.ok);
-    TEST_ASSERT_EQUAL_STRING("it's", val(&t, 0, 0)->value);
-    TEST_ASSERT_EQUAL_STRING("sad\"wow\"bak", val(&t, 1, 0)->value);
+    TEST_ASSERT_EQUAL_STRING("it's", val(&t, 0, 0).value);
+    TEST_ASSERT_EQUAL_STRING("sad\"wow\"bak", val(&t, 1, 0).value);
 }
 
 static void test_trailing_whitespace_after_closing_quote_ok(void) {
     tokenizer_t t;
     result_t r = tokenize("KEY=\"a\"  \n", &t);
     TEST_ASSERT_TRUE(r.ok);
-    TEST_ASSERT_EQUAL_STRING("a", val(&t, 0, 0)->value);
+    TEST_ASSERT_EQUAL_STRING("a", val(&t, 0, 0).value);
 }
 
 static void test_errors_on_unterminated_quote(void) {
@@ -364,15 +415,15 @@ static void test_export_prefix_is_stripped(void) {
     tokenizer_t t;
     result_t r = tokenize("export KEY=value\n", &t);
     TEST_ASSERT_TRUE(r.ok);
-    TEST_ASSERT_EQUAL_STRING("KEY", t.tokens.items[0].key);
-    TEST_ASSERT_EQUAL_STRING("value", val(&t, 0, 0)->value);
+    TEST_ASSERT_EQUAL_STRING("KEY", token_key(&t.tokens, 0));
+    TEST_ASSERT_EQUAL_STRING("value", val(&t, 0, 0).value);
 }
 
 static void test_export_alone_is_a_key(void) {
     tokenizer_t t;
     result_t r = tokenize("export=value\n", &t);
     TEST_ASSERT_TRUE(r.ok);
-    TEST_ASSERT_EQUAL_STRING("export", t.tokens.items[0].key);
+    TEST_ASSERT_EQUAL_STRING("export", token_key(&t.tokens, 0));
 }
 
 static void test_errors_on_key_with_space(void) {
@@ -452,5 +503,7 @@ int main(void) {
     RUN_TEST(test_errors_on_key_with_space);
     RUN_TEST(test_errors_on_key_starting_with_digit);
     RUN_TEST(test_errors_on_nul_inside_interpolation);
+    RUN_TEST(test_values_are_parallel_arrays_into_one_pool);
+    RUN_TEST(test_appending_shares_the_pools);
     return UNITY_END();
 }
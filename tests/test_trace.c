@@ -0,0 +1,104 @@
+#include "test_capture.h"
+#include "trace.h"
+#include "unity.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define TRACE_TEST_PATH "build/tests/test_trace.json"
+
+void setUp(void) {}
+void tearDown(void) { remove(TRACE_TEST_PATH); }
+
+static char *read_trace(void) {
+    FILE *f = fopen(TRACE_TEST_PATH, "rb");
+    TEST_ASSERT_NOT_NULL(f);
+    fseek(f, 0, SEEK_END);
+    long len = ftell(f);
+    fseek(f, 0, SEEK_SET);
+
+    char *contents = malloc((size_t)len + 1);
+    TEST_ASSERT_NOT_NULL(contents);
+    size_t n = fread(contents, 1, (size_t)len, f);
+    contents[n] = '\0';
+    fclose(f);
+    return contents;
+}
+
+static size_t count_occurrences(const char *haystack, const char *needle) {
+    size_t count = 0;
+    for (const char *p = strstr(haystack, needle); p != NULL; p = strstr(p + 1, needle)) {
+        ++count;
+    }
+    return count;
+}
+
+static void test_disabled_ring_records_nothing(void) {
+    trace_ring_t ring = {0};
+    TEST_ASSERT_FALSE(trace_enabled(&ring));
+    TEST_ASSERT_TRUE(trace_now(&ring) == 0);
+    trace_span(&ring, "scan_file", "a.ts", 1.0, 2.0);
+    TEST_ASSERT_EQUAL_size_t(0, ring.count);
+    trace_ring_finish(&ring);
+}
+
+static void test_writes_spans_relative_to_the_origin(void) {
+    trace_t trace = {0};
+    TEST_ASSERT_TRUE(trace_open(&trace, TRACE_TEST_PATH, 10.0).ok);
+
+    trace_ring_t ring;
+    trace_ring_init(&ring, &trace, 3, "scan worker 2");
+    trace_span(&ring, "scan_file", "src/\"quoted\".ts", 10.5, 10.75);
+    trace_ring_finish(&ring);
+    trace_close(&trace);
+
+    char *contents = read_trace();
+    TEST_ASSERT_NOT_NULL(strstr(contents, "{\"displayTimeUnit\":\"ms\",\"traceEvents\":["));
+    TEST_ASSERT_NOT_NULL(strstr(contents, "\"args\":{\"name\":\"scan worker 2\"}"));
+    TEST_ASSERT_NOT_NULL(strstr(contents, "\"tid\":3,\"ts\":500000.000,\"dur\":250000.000"));
+    TEST_ASSERT_NOT_NULL(strstr(contents, "\"path\":\"src/\\\"quoted\\\".ts\""));
+    TEST_ASSERT_EQUAL_STRING("\n]}\n", contents + strlen(contents) - 4);
+    free(contents);
+}
+
+static void test_full_rings_flush_without_losing_events(void) {
+    trace_t trace = {0};
+    TEST_ASSERT_TRUE(trace_open(&trace, TRACE_TEST_PATH, 0).ok);
+
+    trace_ring_t ring;
+    trace_ring_init(&ring, &trace, 1, "scan worker 0");
+    size_t spans = TRACE_RING_SIZE * 2 + 7;
+    for (size_t i = 0; i < spans; ++i) {
+        trace_span(&ring, "match", "f.ts", (double)i, (double)i + 0.5);
+        TEST_ASSERT_TRUE(ring.count <= TRACE_RING_SIZE);
+    }
+    trace_ring_finish(&ring);
+    trace_close(&trace);
+
+    char *contents = read_trace();
+    TEST_ASSERT_EQUAL_size_t(spans, count_occurrences(contents, "\"name\":\"match\""));
+    free(contents);
+}
+
+static void call_trace_open(void *ctx) {
+    trace_t trace = {0};
+    *(result_t *)ctx = trace_open(&trace, "build/tests/missing/trace.json", 0);
+}
+
+static void test_unwritable_path_is_an_operation_error(void) {
+    result_t result = RESULT_OK;
+    char err[256] = {0};
+    capture_fd(stderr, err, sizeof(err) - 1, call_trace_open, &result);
+    TEST_ASSERT_FALSE(result.ok);
+    TEST_ASSERT_EQUAL_INT(1, result.code);
+    TEST_ASSERT_NOT_NULL(strstr(err, "Unable to open the trace file"));
+}
+
+int main(void) {
+    UNITY_BEGIN();
+    RUN_TEST(test_disabled_ring_records_nothing);
+    RUN_TEST(test_writes_spans_relative_to_the_origin);
+    RUN_TEST(test_full_rings_flush_without_losing_events);
+    RUN_TEST(test_unwritable_path_is_an_operation_error);
+    return UNITY_END();
+}